@@ -0,0 +1,10302 @@
+
+obj/user/spawnfaultio.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 77 00 00 00       	call   8000a8 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 08             	sub    $0x8,%esp
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  800039:	89 e2                	mov    %esp,%edx
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80003b:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  800041:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800046:	77 18                	ja     800060 <umain+0x2d>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800048:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80004d:	29 d0                	sub    %edx,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  80004f:	c1 e8 10             	shr    $0x10,%eax
+  800052:	74 0c                	je     800060 <umain+0x2d>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800054:	c1 e0 10             	shl    $0x10,%eax
+  800057:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80005c:	29 c2                	sub    %eax,%edx
+  80005e:	eb 06                	jmp    800066 <umain+0x33>
+		return pthread_main_tls;
+  800060:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+	int r;
+	cprintf("i am parent environment %08x\n", thisenv->env_id);
+  800066:	8b 02                	mov    (%edx),%eax
+  800068:	8b 40 48             	mov    0x48(%eax),%eax
+  80006b:	83 ec 08             	sub    $0x8,%esp
+  80006e:	50                   	push   %eax
+  80006f:	68 60 4d 80 00       	push   $0x804d60
+  800074:	e8 ad 01 00 00       	call   800226 <cprintf>
+	if ((r = spawnl("faultio", "faultio", 0)) < 0)
+  800079:	83 c4 0c             	add    $0xc,%esp
+  80007c:	6a 00                	push   $0x0
+  80007e:	68 7e 4d 80 00       	push   $0x804d7e
+  800083:	68 7e 4d 80 00       	push   $0x804d7e
+  800088:	e8 f8 2b 00 00       	call   802c85 <spawnl>
+  80008d:	83 c4 10             	add    $0x10,%esp
+  800090:	85 c0                	test   %eax,%eax
+  800092:	78 02                	js     800096 <umain+0x63>
+		panic("spawn(faultio) failed: %e", r);
+}
+  800094:	c9                   	leave
+  800095:	c3                   	ret
+		panic("spawn(faultio) failed: %e", r);
+  800096:	50                   	push   %eax
+  800097:	68 86 4d 80 00       	push   $0x804d86
+  80009c:	6a 09                	push   $0x9
+  80009e:	68 a0 4d 80 00       	push   $0x804da0
+  8000a3:	e8 a3 00 00 00       	call   80014b <_panic>
+
+008000a8 <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000a8:	55                   	push   %ebp
+  8000a9:	89 e5                	mov    %esp,%ebp
+  8000ab:	57                   	push   %edi
+  8000ac:	56                   	push   %esi
+  8000ad:	53                   	push   %ebx
+  8000ae:	83 ec 1c             	sub    $0x1c,%esp
+  8000b1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000b4:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  8000b7:	e8 34 0b 00 00       	call   800bf0 <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  8000bc:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  8000bf:	89 15 c0 72 80 00    	mov    %edx,0x8072c0
+	thisenv = &envs[ENVX(eid)];
+  8000c5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000ca:	89 c1                	mov    %eax,%ecx
+  8000cc:	89 e7                	mov    %esp,%edi
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8000ce:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  8000d4:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8000d9:	77 16                	ja     8000f1 <libmain+0x49>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8000db:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8000e0:	29 f8                	sub    %edi,%eax
+	if (t == 0)
+  8000e2:	c1 e8 10             	shr    $0x10,%eax
+  8000e5:	74 0a                	je     8000f1 <libmain+0x49>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8000e7:	c1 e0 10             	shl    $0x10,%eax
+  8000ea:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8000ef:	29 c2                	sub    %eax,%edx
+  8000f1:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  8000f4:	c1 e0 04             	shl    $0x4,%eax
+  8000f7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000fc:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000fe:	85 db                	test   %ebx,%ebx
+  800100:	7e 07                	jle    800109 <libmain+0x61>
+		binaryname = argv[0];
+  800102:	8b 06                	mov    (%esi),%eax
+  800104:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// call user main routine
+	umain(argc, argv);
+  800109:	83 ec 08             	sub    $0x8,%esp
+  80010c:	56                   	push   %esi
+  80010d:	53                   	push   %ebx
+  80010e:	e8 20 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800113:	e8 0b 00 00 00       	call   800123 <exit>
+}
+  800118:	83 c4 10             	add    $0x10,%esp
+  80011b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80011e:	5b                   	pop    %ebx
+  80011f:	5e                   	pop    %esi
+  800120:	5f                   	pop    %edi
+  800121:	5d                   	pop    %ebp
+  800122:	c3                   	ret
+
+00800123 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800123:	55                   	push   %ebp
+  800124:	89 e5                	mov    %esp,%ebp
+  800126:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  800129:	6a 00                	push   $0x0
+  80012b:	e8 15 21 00 00       	call   802245 <fflush>
+	pthread_kill_others();
+  800130:	e8 9d 3d 00 00       	call   803ed2 <pthread_kill_others>
+	close_all();
+  800135:	e8 ae 11 00 00       	call   8012e8 <close_all>
+	sys_env_destroy(0);
+  80013a:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800141:	e8 5f 0a 00 00       	call   800ba5 <sys_env_destroy>
+}
+  800146:	83 c4 10             	add    $0x10,%esp
+  800149:	c9                   	leave
+  80014a:	c3                   	ret
+
+0080014b <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80014b:	55                   	push   %ebp
+  80014c:	89 e5                	mov    %esp,%ebp
+  80014e:	56                   	push   %esi
+  80014f:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800150:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800153:	8b 35 00 60 80 00    	mov    0x806000,%esi
+  800159:	e8 92 0a 00 00       	call   800bf0 <sys_getenvid>
+  80015e:	83 ec 0c             	sub    $0xc,%esp
+  800161:	ff 75 0c             	push   0xc(%ebp)
+  800164:	ff 75 08             	push   0x8(%ebp)
+  800167:	56                   	push   %esi
+  800168:	50                   	push   %eax
+  800169:	68 c0 4d 80 00       	push   $0x804dc0
+  80016e:	e8 b3 00 00 00       	call   800226 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800173:	83 c4 18             	add    $0x18,%esp
+  800176:	53                   	push   %ebx
+  800177:	ff 75 10             	push   0x10(%ebp)
+  80017a:	e8 56 00 00 00       	call   8001d5 <vcprintf>
+	cprintf("\n");
+  80017f:	c7 04 24 4e 55 80 00 	movl   $0x80554e,(%esp)
+  800186:	e8 9b 00 00 00       	call   800226 <cprintf>
+  80018b:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80018e:	cc                   	int3
+	while (1)
+  80018f:	eb fd                	jmp    80018e <_panic+0x43>
+
+00800191 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800191:	55                   	push   %ebp
+  800192:	89 e5                	mov    %esp,%ebp
+  800194:	53                   	push   %ebx
+  800195:	83 ec 04             	sub    $0x4,%esp
+  800198:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80019b:	8b 13                	mov    (%ebx),%edx
+  80019d:	8d 42 01             	lea    0x1(%edx),%eax
+  8001a0:	89 03                	mov    %eax,(%ebx)
+  8001a2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001a5:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001a9:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001ae:	74 09                	je     8001b9 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001b0:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001b4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001b7:	c9                   	leave
+  8001b8:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001b9:	83 ec 08             	sub    $0x8,%esp
+  8001bc:	68 ff 00 00 00       	push   $0xff
+  8001c1:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001c4:	50                   	push   %eax
+  8001c5:	e8 84 09 00 00       	call   800b4e <sys_cputs>
+		b->idx = 0;
+  8001ca:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001d0:	83 c4 10             	add    $0x10,%esp
+  8001d3:	eb db                	jmp    8001b0 <putch+0x1f>
+
+008001d5 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001d5:	55                   	push   %ebp
+  8001d6:	89 e5                	mov    %esp,%ebp
+  8001d8:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001de:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001e5:	00 00 00 
+	b.cnt = 0;
+  8001e8:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001ef:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001f2:	ff 75 0c             	push   0xc(%ebp)
+  8001f5:	ff 75 08             	push   0x8(%ebp)
+  8001f8:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001fe:	50                   	push   %eax
+  8001ff:	68 91 01 80 00       	push   $0x800191
+  800204:	e8 14 01 00 00       	call   80031d <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800209:	83 c4 08             	add    $0x8,%esp
+  80020c:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800212:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800218:	50                   	push   %eax
+  800219:	e8 30 09 00 00       	call   800b4e <sys_cputs>
+
+	return b.cnt;
+}
+  80021e:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800224:	c9                   	leave
+  800225:	c3                   	ret
+
+00800226 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800226:	55                   	push   %ebp
+  800227:	89 e5                	mov    %esp,%ebp
+  800229:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80022c:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80022f:	50                   	push   %eax
+  800230:	ff 75 08             	push   0x8(%ebp)
+  800233:	e8 9d ff ff ff       	call   8001d5 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800238:	c9                   	leave
+  800239:	c3                   	ret
+
+0080023a <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80023a:	55                   	push   %ebp
+  80023b:	89 e5                	mov    %esp,%ebp
+  80023d:	57                   	push   %edi
+  80023e:	56                   	push   %esi
+  80023f:	53                   	push   %ebx
+  800240:	83 ec 1c             	sub    $0x1c,%esp
+  800243:	89 c7                	mov    %eax,%edi
+  800245:	89 d6                	mov    %edx,%esi
+  800247:	8b 45 08             	mov    0x8(%ebp),%eax
+  80024a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80024d:	89 d1                	mov    %edx,%ecx
+  80024f:	89 c2                	mov    %eax,%edx
+  800251:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800254:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800257:	8b 45 10             	mov    0x10(%ebp),%eax
+  80025a:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80025d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800260:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800267:	39 c2                	cmp    %eax,%edx
+  800269:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80026c:	72 3e                	jb     8002ac <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80026e:	83 ec 0c             	sub    $0xc,%esp
+  800271:	ff 75 18             	push   0x18(%ebp)
+  800274:	83 eb 01             	sub    $0x1,%ebx
+  800277:	53                   	push   %ebx
+  800278:	50                   	push   %eax
+  800279:	83 ec 08             	sub    $0x8,%esp
+  80027c:	ff 75 e4             	push   -0x1c(%ebp)
+  80027f:	ff 75 e0             	push   -0x20(%ebp)
+  800282:	ff 75 dc             	push   -0x24(%ebp)
+  800285:	ff 75 d8             	push   -0x28(%ebp)
+  800288:	e8 3e 49 00 00       	call   804bcb <__udivdi3>
+  80028d:	83 c4 18             	add    $0x18,%esp
+  800290:	52                   	push   %edx
+  800291:	50                   	push   %eax
+  800292:	89 f2                	mov    %esi,%edx
+  800294:	89 f8                	mov    %edi,%eax
+  800296:	e8 9f ff ff ff       	call   80023a <printnum>
+  80029b:	83 c4 20             	add    $0x20,%esp
+  80029e:	eb 13                	jmp    8002b3 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8002a0:	83 ec 08             	sub    $0x8,%esp
+  8002a3:	56                   	push   %esi
+  8002a4:	ff 75 18             	push   0x18(%ebp)
+  8002a7:	ff d7                	call   *%edi
+  8002a9:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8002ac:	83 eb 01             	sub    $0x1,%ebx
+  8002af:	85 db                	test   %ebx,%ebx
+  8002b1:	7f ed                	jg     8002a0 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8002b3:	83 ec 08             	sub    $0x8,%esp
+  8002b6:	56                   	push   %esi
+  8002b7:	83 ec 04             	sub    $0x4,%esp
+  8002ba:	ff 75 e4             	push   -0x1c(%ebp)
+  8002bd:	ff 75 e0             	push   -0x20(%ebp)
+  8002c0:	ff 75 dc             	push   -0x24(%ebp)
+  8002c3:	ff 75 d8             	push   -0x28(%ebp)
+  8002c6:	e8 21 49 00 00       	call   804bec <__umoddi3>
+  8002cb:	83 c4 14             	add    $0x14,%esp
+  8002ce:	0f be 80 e3 4d 80 00 	movsbl 0x804de3(%eax),%eax
+  8002d5:	50                   	push   %eax
+  8002d6:	ff d7                	call   *%edi
+}
+  8002d8:	83 c4 10             	add    $0x10,%esp
+  8002db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002de:	5b                   	pop    %ebx
+  8002df:	5e                   	pop    %esi
+  8002e0:	5f                   	pop    %edi
+  8002e1:	5d                   	pop    %ebp
+  8002e2:	c3                   	ret
+
+008002e3 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002e3:	55                   	push   %ebp
+  8002e4:	89 e5                	mov    %esp,%ebp
+  8002e6:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002e9:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002ed:	8b 10                	mov    (%eax),%edx
+  8002ef:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002f2:	73 0a                	jae    8002fe <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002f4:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002f7:	89 08                	mov    %ecx,(%eax)
+  8002f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002fc:	88 02                	mov    %al,(%edx)
+}
+  8002fe:	5d                   	pop    %ebp
+  8002ff:	c3                   	ret
+
+00800300 <printfmt>:
+{
+  800300:	55                   	push   %ebp
+  800301:	89 e5                	mov    %esp,%ebp
+  800303:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800306:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800309:	50                   	push   %eax
+  80030a:	ff 75 10             	push   0x10(%ebp)
+  80030d:	ff 75 0c             	push   0xc(%ebp)
+  800310:	ff 75 08             	push   0x8(%ebp)
+  800313:	e8 05 00 00 00       	call   80031d <vprintfmt>
+}
+  800318:	83 c4 10             	add    $0x10,%esp
+  80031b:	c9                   	leave
+  80031c:	c3                   	ret
+
+0080031d <vprintfmt>:
+{
+  80031d:	55                   	push   %ebp
+  80031e:	89 e5                	mov    %esp,%ebp
+  800320:	57                   	push   %edi
+  800321:	56                   	push   %esi
+  800322:	53                   	push   %ebx
+  800323:	83 ec 2c             	sub    $0x2c,%esp
+  800326:	8b 75 08             	mov    0x8(%ebp),%esi
+  800329:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80032c:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80032f:	eb 0a                	jmp    80033b <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800331:	83 ec 08             	sub    $0x8,%esp
+  800334:	53                   	push   %ebx
+  800335:	50                   	push   %eax
+  800336:	ff d6                	call   *%esi
+  800338:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  80033b:	83 c7 01             	add    $0x1,%edi
+  80033e:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  800342:	83 f8 25             	cmp    $0x25,%eax
+  800345:	74 0c                	je     800353 <vprintfmt+0x36>
+			if (ch == '\0')
+  800347:	85 c0                	test   %eax,%eax
+  800349:	75 e6                	jne    800331 <vprintfmt+0x14>
+}
+  80034b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80034e:	5b                   	pop    %ebx
+  80034f:	5e                   	pop    %esi
+  800350:	5f                   	pop    %edi
+  800351:	5d                   	pop    %ebp
+  800352:	c3                   	ret
+		padc = ' ';
+  800353:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800357:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80035e:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800365:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80036c:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  800371:	8d 47 01             	lea    0x1(%edi),%eax
+  800374:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800377:	0f b6 17             	movzbl (%edi),%edx
+  80037a:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80037d:	3c 55                	cmp    $0x55,%al
+  80037f:	0f 87 c5 03 00 00    	ja     80074a <vprintfmt+0x42d>
+  800385:	0f b6 c0             	movzbl %al,%eax
+  800388:	ff 24 85 60 4f 80 00 	jmp    *0x804f60(,%eax,4)
+  80038f:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  800392:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800395:	eb da                	jmp    800371 <vprintfmt+0x54>
+  800397:	0f be d2             	movsbl %dl,%edx
+  80039a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80039d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a2:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8003a5:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003a8:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8003ac:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8003af:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8003b2:	83 f9 09             	cmp    $0x9,%ecx
+  8003b5:	77 55                	ja     80040c <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  8003b7:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8003ba:	eb e9                	jmp    8003a5 <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  8003bc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003bf:	8b 00                	mov    (%eax),%eax
+  8003c1:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003c4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003c7:	8d 40 04             	lea    0x4(%eax),%eax
+  8003ca:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  8003cd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8003d0:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003d4:	79 9b                	jns    800371 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8003d6:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003d9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003dc:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003e3:	eb 8c                	jmp    800371 <vprintfmt+0x54>
+			if (width < 0)
+  8003e5:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003e8:	85 d2                	test   %edx,%edx
+  8003ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ef:	0f 49 c2             	cmovns %edx,%eax
+  8003f2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  8003f5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003f8:	e9 74 ff ff ff       	jmp    800371 <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  8003fd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800400:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800407:	e9 65 ff ff ff       	jmp    800371 <vprintfmt+0x54>
+  80040c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80040f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800412:	eb bc                	jmp    8003d0 <vprintfmt+0xb3>
+			lflag++;
+  800414:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  800417:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80041a:	e9 52 ff ff ff       	jmp    800371 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80041f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800422:	8d 78 04             	lea    0x4(%eax),%edi
+  800425:	83 ec 08             	sub    $0x8,%esp
+  800428:	53                   	push   %ebx
+  800429:	ff 30                	push   (%eax)
+  80042b:	ff d6                	call   *%esi
+			break;
+  80042d:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800430:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800433:	e9 b1 02 00 00       	jmp    8006e9 <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  800438:	8b 45 14             	mov    0x14(%ebp),%eax
+  80043b:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80043e:	8b 10                	mov    (%eax),%edx
+  800440:	89 d0                	mov    %edx,%eax
+  800442:	f7 d8                	neg    %eax
+  800444:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800447:	83 f8 14             	cmp    $0x14,%eax
+  80044a:	7f 23                	jg     80046f <vprintfmt+0x152>
+  80044c:	8b 14 85 c0 50 80 00 	mov    0x8050c0(,%eax,4),%edx
+  800453:	85 d2                	test   %edx,%edx
+  800455:	74 18                	je     80046f <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  800457:	52                   	push   %edx
+  800458:	68 2f 52 80 00       	push   $0x80522f
+  80045d:	53                   	push   %ebx
+  80045e:	56                   	push   %esi
+  80045f:	e8 9c fe ff ff       	call   800300 <printfmt>
+  800464:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800467:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80046a:	e9 7a 02 00 00       	jmp    8006e9 <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  80046f:	50                   	push   %eax
+  800470:	68 fb 4d 80 00       	push   $0x804dfb
+  800475:	53                   	push   %ebx
+  800476:	56                   	push   %esi
+  800477:	e8 84 fe ff ff       	call   800300 <printfmt>
+  80047c:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80047f:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800482:	e9 62 02 00 00       	jmp    8006e9 <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800487:	8b 45 14             	mov    0x14(%ebp),%eax
+  80048a:	83 c0 04             	add    $0x4,%eax
+  80048d:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800490:	8b 45 14             	mov    0x14(%ebp),%eax
+  800493:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800495:	85 c9                	test   %ecx,%ecx
+  800497:	b8 f4 4d 80 00       	mov    $0x804df4,%eax
+  80049c:	0f 45 c1             	cmovne %ecx,%eax
+  80049f:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8004a2:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004a6:	7e 06                	jle    8004ae <vprintfmt+0x191>
+  8004a8:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8004ac:	75 0b                	jne    8004b9 <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004ae:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8004b1:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8004b4:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004b7:	eb 5c                	jmp    800515 <vprintfmt+0x1f8>
+  8004b9:	83 ec 08             	sub    $0x8,%esp
+  8004bc:	ff 75 d0             	push   -0x30(%ebp)
+  8004bf:	ff 75 cc             	push   -0x34(%ebp)
+  8004c2:	e8 20 03 00 00       	call   8007e7 <strnlen>
+  8004c7:	89 c2                	mov    %eax,%edx
+  8004c9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004cc:	29 d0                	sub    %edx,%eax
+  8004ce:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8004d1:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004d5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004d8:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004db:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004dd:	eb 0e                	jmp    8004ed <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  8004df:	83 ec 08             	sub    $0x8,%esp
+  8004e2:	53                   	push   %ebx
+  8004e3:	57                   	push   %edi
+  8004e4:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004e7:	83 ee 01             	sub    $0x1,%esi
+  8004ea:	83 c4 10             	add    $0x10,%esp
+  8004ed:	85 f6                	test   %esi,%esi
+  8004ef:	7f ee                	jg     8004df <vprintfmt+0x1c2>
+  8004f1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004f4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004f7:	85 c0                	test   %eax,%eax
+  8004f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004fe:	0f 49 d0             	cmovns %eax,%edx
+  800501:	29 d0                	sub    %edx,%eax
+  800503:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800506:	eb a6                	jmp    8004ae <vprintfmt+0x191>
+					putch(ch, putdat);
+  800508:	83 ec 08             	sub    $0x8,%esp
+  80050b:	53                   	push   %ebx
+  80050c:	52                   	push   %edx
+  80050d:	ff 55 08             	call   *0x8(%ebp)
+  800510:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800513:	89 f1                	mov    %esi,%ecx
+  800515:	8d 71 01             	lea    0x1(%ecx),%esi
+  800518:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80051c:	0f be d0             	movsbl %al,%edx
+  80051f:	85 d2                	test   %edx,%edx
+  800521:	74 28                	je     80054b <vprintfmt+0x22e>
+  800523:	85 ff                	test   %edi,%edi
+  800525:	78 05                	js     80052c <vprintfmt+0x20f>
+  800527:	83 ef 01             	sub    $0x1,%edi
+  80052a:	78 30                	js     80055c <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80052c:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800530:	74 d6                	je     800508 <vprintfmt+0x1eb>
+  800532:	0f be c0             	movsbl %al,%eax
+  800535:	83 e8 20             	sub    $0x20,%eax
+  800538:	83 f8 5e             	cmp    $0x5e,%eax
+  80053b:	76 cb                	jbe    800508 <vprintfmt+0x1eb>
+					putch('?', putdat);
+  80053d:	83 ec 08             	sub    $0x8,%esp
+  800540:	53                   	push   %ebx
+  800541:	6a 3f                	push   $0x3f
+  800543:	ff 55 08             	call   *0x8(%ebp)
+  800546:	83 c4 10             	add    $0x10,%esp
+  800549:	eb c8                	jmp    800513 <vprintfmt+0x1f6>
+  80054b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80054e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800551:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800554:	01 d0                	add    %edx,%eax
+  800556:	29 c8                	sub    %ecx,%eax
+  800558:	89 c7                	mov    %eax,%edi
+  80055a:	eb 13                	jmp    80056f <vprintfmt+0x252>
+  80055c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80055f:	eb ed                	jmp    80054e <vprintfmt+0x231>
+				putch(' ', putdat);
+  800561:	83 ec 08             	sub    $0x8,%esp
+  800564:	53                   	push   %ebx
+  800565:	6a 20                	push   $0x20
+  800567:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800569:	83 ef 01             	sub    $0x1,%edi
+  80056c:	83 c4 10             	add    $0x10,%esp
+  80056f:	85 ff                	test   %edi,%edi
+  800571:	7f ee                	jg     800561 <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800573:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800576:	89 45 14             	mov    %eax,0x14(%ebp)
+  800579:	e9 6b 01 00 00       	jmp    8006e9 <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  80057e:	83 f9 01             	cmp    $0x1,%ecx
+  800581:	7f 1f                	jg     8005a2 <vprintfmt+0x285>
+	else if (lflag)
+  800583:	85 c9                	test   %ecx,%ecx
+  800585:	74 67                	je     8005ee <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  800587:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058a:	8b 00                	mov    (%eax),%eax
+  80058c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80058f:	89 c1                	mov    %eax,%ecx
+  800591:	c1 f9 1f             	sar    $0x1f,%ecx
+  800594:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800597:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059a:	8d 40 04             	lea    0x4(%eax),%eax
+  80059d:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005a0:	eb 17                	jmp    8005b9 <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  8005a2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a5:	8b 50 04             	mov    0x4(%eax),%edx
+  8005a8:	8b 00                	mov    (%eax),%eax
+  8005aa:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005ad:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b3:	8d 40 08             	lea    0x8(%eax),%eax
+  8005b6:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005b9:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005bc:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8005bf:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8005c4:	85 c9                	test   %ecx,%ecx
+  8005c6:	0f 89 03 01 00 00    	jns    8006cf <vprintfmt+0x3b2>
+				putch('-', putdat);
+  8005cc:	83 ec 08             	sub    $0x8,%esp
+  8005cf:	53                   	push   %ebx
+  8005d0:	6a 2d                	push   $0x2d
+  8005d2:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8005d4:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005d7:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005da:	f7 da                	neg    %edx
+  8005dc:	83 d1 00             	adc    $0x0,%ecx
+  8005df:	f7 d9                	neg    %ecx
+  8005e1:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8005e4:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005e9:	e9 e1 00 00 00       	jmp    8006cf <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  8005ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f1:	8b 00                	mov    (%eax),%eax
+  8005f3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005f6:	89 c1                	mov    %eax,%ecx
+  8005f8:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005fb:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800601:	8d 40 04             	lea    0x4(%eax),%eax
+  800604:	89 45 14             	mov    %eax,0x14(%ebp)
+  800607:	eb b0                	jmp    8005b9 <vprintfmt+0x29c>
+	if (lflag >= 2)
+  800609:	83 f9 01             	cmp    $0x1,%ecx
+  80060c:	7f 1e                	jg     80062c <vprintfmt+0x30f>
+	else if (lflag)
+  80060e:	85 c9                	test   %ecx,%ecx
+  800610:	74 32                	je     800644 <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  800612:	8b 45 14             	mov    0x14(%ebp),%eax
+  800615:	8b 10                	mov    (%eax),%edx
+  800617:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80061c:	8d 40 04             	lea    0x4(%eax),%eax
+  80061f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800622:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800627:	e9 a3 00 00 00       	jmp    8006cf <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  80062c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062f:	8b 10                	mov    (%eax),%edx
+  800631:	8b 48 04             	mov    0x4(%eax),%ecx
+  800634:	8d 40 08             	lea    0x8(%eax),%eax
+  800637:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80063a:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80063f:	e9 8b 00 00 00       	jmp    8006cf <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800644:	8b 45 14             	mov    0x14(%ebp),%eax
+  800647:	8b 10                	mov    (%eax),%edx
+  800649:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80064e:	8d 40 04             	lea    0x4(%eax),%eax
+  800651:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800654:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800659:	eb 74                	jmp    8006cf <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  80065b:	83 f9 01             	cmp    $0x1,%ecx
+  80065e:	7f 1b                	jg     80067b <vprintfmt+0x35e>
+	else if (lflag)
+  800660:	85 c9                	test   %ecx,%ecx
+  800662:	74 2c                	je     800690 <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  800664:	8b 45 14             	mov    0x14(%ebp),%eax
+  800667:	8b 10                	mov    (%eax),%edx
+  800669:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80066e:	8d 40 04             	lea    0x4(%eax),%eax
+  800671:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800674:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800679:	eb 54                	jmp    8006cf <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  80067b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067e:	8b 10                	mov    (%eax),%edx
+  800680:	8b 48 04             	mov    0x4(%eax),%ecx
+  800683:	8d 40 08             	lea    0x8(%eax),%eax
+  800686:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800689:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  80068e:	eb 3f                	jmp    8006cf <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800690:	8b 45 14             	mov    0x14(%ebp),%eax
+  800693:	8b 10                	mov    (%eax),%edx
+  800695:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80069a:	8d 40 04             	lea    0x4(%eax),%eax
+  80069d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006a0:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8006a5:	eb 28                	jmp    8006cf <vprintfmt+0x3b2>
+			putch('0', putdat);
+  8006a7:	83 ec 08             	sub    $0x8,%esp
+  8006aa:	53                   	push   %ebx
+  8006ab:	6a 30                	push   $0x30
+  8006ad:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8006af:	83 c4 08             	add    $0x8,%esp
+  8006b2:	53                   	push   %ebx
+  8006b3:	6a 78                	push   $0x78
+  8006b5:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8006b7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ba:	8b 10                	mov    (%eax),%edx
+  8006bc:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8006c1:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006c4:	8d 40 04             	lea    0x4(%eax),%eax
+  8006c7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006ca:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8006cf:	83 ec 0c             	sub    $0xc,%esp
+  8006d2:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8006d6:	50                   	push   %eax
+  8006d7:	ff 75 e0             	push   -0x20(%ebp)
+  8006da:	57                   	push   %edi
+  8006db:	51                   	push   %ecx
+  8006dc:	52                   	push   %edx
+  8006dd:	89 da                	mov    %ebx,%edx
+  8006df:	89 f0                	mov    %esi,%eax
+  8006e1:	e8 54 fb ff ff       	call   80023a <printnum>
+			break;
+  8006e6:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8006e9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  8006ec:	e9 4a fc ff ff       	jmp    80033b <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8006f1:	83 f9 01             	cmp    $0x1,%ecx
+  8006f4:	7f 1b                	jg     800711 <vprintfmt+0x3f4>
+	else if (lflag)
+  8006f6:	85 c9                	test   %ecx,%ecx
+  8006f8:	74 2c                	je     800726 <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  8006fa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006fd:	8b 10                	mov    (%eax),%edx
+  8006ff:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800704:	8d 40 04             	lea    0x4(%eax),%eax
+  800707:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80070a:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80070f:	eb be                	jmp    8006cf <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800711:	8b 45 14             	mov    0x14(%ebp),%eax
+  800714:	8b 10                	mov    (%eax),%edx
+  800716:	8b 48 04             	mov    0x4(%eax),%ecx
+  800719:	8d 40 08             	lea    0x8(%eax),%eax
+  80071c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80071f:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800724:	eb a9                	jmp    8006cf <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800726:	8b 45 14             	mov    0x14(%ebp),%eax
+  800729:	8b 10                	mov    (%eax),%edx
+  80072b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800730:	8d 40 04             	lea    0x4(%eax),%eax
+  800733:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800736:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80073b:	eb 92                	jmp    8006cf <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  80073d:	83 ec 08             	sub    $0x8,%esp
+  800740:	53                   	push   %ebx
+  800741:	6a 25                	push   $0x25
+  800743:	ff d6                	call   *%esi
+			break;
+  800745:	83 c4 10             	add    $0x10,%esp
+  800748:	eb 9f                	jmp    8006e9 <vprintfmt+0x3cc>
+			putch('%', putdat);
+  80074a:	83 ec 08             	sub    $0x8,%esp
+  80074d:	53                   	push   %ebx
+  80074e:	6a 25                	push   $0x25
+  800750:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800752:	83 c4 10             	add    $0x10,%esp
+  800755:	89 f8                	mov    %edi,%eax
+  800757:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80075b:	74 05                	je     800762 <vprintfmt+0x445>
+  80075d:	83 e8 01             	sub    $0x1,%eax
+  800760:	eb f5                	jmp    800757 <vprintfmt+0x43a>
+  800762:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800765:	eb 82                	jmp    8006e9 <vprintfmt+0x3cc>
+
+00800767 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800767:	55                   	push   %ebp
+  800768:	89 e5                	mov    %esp,%ebp
+  80076a:	83 ec 18             	sub    $0x18,%esp
+  80076d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800770:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800773:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800776:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80077a:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80077d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800784:	85 c0                	test   %eax,%eax
+  800786:	74 26                	je     8007ae <vsnprintf+0x47>
+  800788:	85 d2                	test   %edx,%edx
+  80078a:	7e 22                	jle    8007ae <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80078c:	ff 75 14             	push   0x14(%ebp)
+  80078f:	ff 75 10             	push   0x10(%ebp)
+  800792:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800795:	50                   	push   %eax
+  800796:	68 e3 02 80 00       	push   $0x8002e3
+  80079b:	e8 7d fb ff ff       	call   80031d <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8007a0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007a3:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8007a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007a9:	83 c4 10             	add    $0x10,%esp
+}
+  8007ac:	c9                   	leave
+  8007ad:	c3                   	ret
+		return -E_INVAL;
+  8007ae:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007b3:	eb f7                	jmp    8007ac <vsnprintf+0x45>
+
+008007b5 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8007b5:	55                   	push   %ebp
+  8007b6:	89 e5                	mov    %esp,%ebp
+  8007b8:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8007bb:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8007be:	50                   	push   %eax
+  8007bf:	ff 75 10             	push   0x10(%ebp)
+  8007c2:	ff 75 0c             	push   0xc(%ebp)
+  8007c5:	ff 75 08             	push   0x8(%ebp)
+  8007c8:	e8 9a ff ff ff       	call   800767 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8007cd:	c9                   	leave
+  8007ce:	c3                   	ret
+
+008007cf <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007cf:	55                   	push   %ebp
+  8007d0:	89 e5                	mov    %esp,%ebp
+  8007d2:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8007d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007da:	eb 03                	jmp    8007df <strlen+0x10>
+		n++;
+  8007dc:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8007df:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007e3:	75 f7                	jne    8007dc <strlen+0xd>
+	return n;
+}
+  8007e5:	5d                   	pop    %ebp
+  8007e6:	c3                   	ret
+
+008007e7 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8007e7:	55                   	push   %ebp
+  8007e8:	89 e5                	mov    %esp,%ebp
+  8007ea:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007ed:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007f5:	eb 03                	jmp    8007fa <strnlen+0x13>
+		n++;
+  8007f7:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007fa:	39 d0                	cmp    %edx,%eax
+  8007fc:	74 08                	je     800806 <strnlen+0x1f>
+  8007fe:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800802:	75 f3                	jne    8007f7 <strnlen+0x10>
+  800804:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800806:	89 d0                	mov    %edx,%eax
+  800808:	5d                   	pop    %ebp
+  800809:	c3                   	ret
+
+0080080a <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80080a:	55                   	push   %ebp
+  80080b:	89 e5                	mov    %esp,%ebp
+  80080d:	53                   	push   %ebx
+  80080e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800811:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800814:	b8 00 00 00 00       	mov    $0x0,%eax
+  800819:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80081d:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800820:	83 c0 01             	add    $0x1,%eax
+  800823:	84 d2                	test   %dl,%dl
+  800825:	75 f2                	jne    800819 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800827:	89 c8                	mov    %ecx,%eax
+  800829:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80082c:	c9                   	leave
+  80082d:	c3                   	ret
+
+0080082e <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80082e:	55                   	push   %ebp
+  80082f:	89 e5                	mov    %esp,%ebp
+  800831:	53                   	push   %ebx
+  800832:	83 ec 10             	sub    $0x10,%esp
+  800835:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800838:	53                   	push   %ebx
+  800839:	e8 91 ff ff ff       	call   8007cf <strlen>
+  80083e:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800841:	ff 75 0c             	push   0xc(%ebp)
+  800844:	01 d8                	add    %ebx,%eax
+  800846:	50                   	push   %eax
+  800847:	e8 be ff ff ff       	call   80080a <strcpy>
+	return dst;
+}
+  80084c:	89 d8                	mov    %ebx,%eax
+  80084e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800851:	c9                   	leave
+  800852:	c3                   	ret
+
+00800853 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800853:	55                   	push   %ebp
+  800854:	89 e5                	mov    %esp,%ebp
+  800856:	56                   	push   %esi
+  800857:	53                   	push   %ebx
+  800858:	8b 75 08             	mov    0x8(%ebp),%esi
+  80085b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80085e:	89 f3                	mov    %esi,%ebx
+  800860:	03 5d 10             	add    0x10(%ebp),%ebx
+  800863:	89 f0                	mov    %esi,%eax
+  800865:	eb 0f                	jmp    800876 <strncpy+0x23>
+		*dst++ = *src;
+  800867:	83 c0 01             	add    $0x1,%eax
+  80086a:	0f b6 0a             	movzbl (%edx),%ecx
+  80086d:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800870:	80 f9 01             	cmp    $0x1,%cl
+  800873:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800876:	39 d8                	cmp    %ebx,%eax
+  800878:	75 ed                	jne    800867 <strncpy+0x14>
+	}
+	return ret;
+}
+  80087a:	89 f0                	mov    %esi,%eax
+  80087c:	5b                   	pop    %ebx
+  80087d:	5e                   	pop    %esi
+  80087e:	5d                   	pop    %ebp
+  80087f:	c3                   	ret
+
+00800880 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800880:	55                   	push   %ebp
+  800881:	89 e5                	mov    %esp,%ebp
+  800883:	56                   	push   %esi
+  800884:	53                   	push   %ebx
+  800885:	8b 75 08             	mov    0x8(%ebp),%esi
+  800888:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80088b:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80088e:	89 f0                	mov    %esi,%eax
+  800890:	85 d2                	test   %edx,%edx
+  800892:	74 21                	je     8008b5 <strlcpy+0x35>
+  800894:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800898:	89 f2                	mov    %esi,%edx
+  80089a:	eb 09                	jmp    8008a5 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80089c:	83 c1 01             	add    $0x1,%ecx
+  80089f:	83 c2 01             	add    $0x1,%edx
+  8008a2:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8008a5:	39 c2                	cmp    %eax,%edx
+  8008a7:	74 09                	je     8008b2 <strlcpy+0x32>
+  8008a9:	0f b6 19             	movzbl (%ecx),%ebx
+  8008ac:	84 db                	test   %bl,%bl
+  8008ae:	75 ec                	jne    80089c <strlcpy+0x1c>
+  8008b0:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8008b2:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8008b5:	29 f0                	sub    %esi,%eax
+}
+  8008b7:	5b                   	pop    %ebx
+  8008b8:	5e                   	pop    %esi
+  8008b9:	5d                   	pop    %ebp
+  8008ba:	c3                   	ret
+
+008008bb <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8008bb:	55                   	push   %ebp
+  8008bc:	89 e5                	mov    %esp,%ebp
+  8008be:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008c1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8008c4:	eb 06                	jmp    8008cc <strcmp+0x11>
+		p++, q++;
+  8008c6:	83 c1 01             	add    $0x1,%ecx
+  8008c9:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8008cc:	0f b6 01             	movzbl (%ecx),%eax
+  8008cf:	84 c0                	test   %al,%al
+  8008d1:	74 04                	je     8008d7 <strcmp+0x1c>
+  8008d3:	3a 02                	cmp    (%edx),%al
+  8008d5:	74 ef                	je     8008c6 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008d7:	0f b6 c0             	movzbl %al,%eax
+  8008da:	0f b6 12             	movzbl (%edx),%edx
+  8008dd:	29 d0                	sub    %edx,%eax
+}
+  8008df:	5d                   	pop    %ebp
+  8008e0:	c3                   	ret
+
+008008e1 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008e1:	55                   	push   %ebp
+  8008e2:	89 e5                	mov    %esp,%ebp
+  8008e4:	53                   	push   %ebx
+  8008e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008e8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008eb:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8008ee:	eb 09                	jmp    8008f9 <strncmp+0x18>
+		n--, p++, q++;
+  8008f0:	83 ea 01             	sub    $0x1,%edx
+  8008f3:	83 c0 01             	add    $0x1,%eax
+  8008f6:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8008f9:	85 d2                	test   %edx,%edx
+  8008fb:	74 18                	je     800915 <strncmp+0x34>
+  8008fd:	0f b6 18             	movzbl (%eax),%ebx
+  800900:	84 db                	test   %bl,%bl
+  800902:	74 04                	je     800908 <strncmp+0x27>
+  800904:	3a 19                	cmp    (%ecx),%bl
+  800906:	74 e8                	je     8008f0 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800908:	0f b6 00             	movzbl (%eax),%eax
+  80090b:	0f b6 11             	movzbl (%ecx),%edx
+  80090e:	29 d0                	sub    %edx,%eax
+}
+  800910:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800913:	c9                   	leave
+  800914:	c3                   	ret
+		return 0;
+  800915:	b8 00 00 00 00       	mov    $0x0,%eax
+  80091a:	eb f4                	jmp    800910 <strncmp+0x2f>
+
+0080091c <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80091c:	55                   	push   %ebp
+  80091d:	89 e5                	mov    %esp,%ebp
+  80091f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800922:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800926:	eb 03                	jmp    80092b <strchr+0xf>
+  800928:	83 c0 01             	add    $0x1,%eax
+  80092b:	0f b6 10             	movzbl (%eax),%edx
+  80092e:	84 d2                	test   %dl,%dl
+  800930:	74 06                	je     800938 <strchr+0x1c>
+		if (*s == c)
+  800932:	38 ca                	cmp    %cl,%dl
+  800934:	75 f2                	jne    800928 <strchr+0xc>
+  800936:	eb 05                	jmp    80093d <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800938:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80093d:	5d                   	pop    %ebp
+  80093e:	c3                   	ret
+
+0080093f <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80093f:	55                   	push   %ebp
+  800940:	89 e5                	mov    %esp,%ebp
+  800942:	8b 45 08             	mov    0x8(%ebp),%eax
+  800945:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800949:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  80094c:	38 ca                	cmp    %cl,%dl
+  80094e:	74 09                	je     800959 <strfind+0x1a>
+  800950:	84 d2                	test   %dl,%dl
+  800952:	74 05                	je     800959 <strfind+0x1a>
+	for (; *s; s++)
+  800954:	83 c0 01             	add    $0x1,%eax
+  800957:	eb f0                	jmp    800949 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800959:	5d                   	pop    %ebp
+  80095a:	c3                   	ret
+
+0080095b <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  80095b:	55                   	push   %ebp
+  80095c:	89 e5                	mov    %esp,%ebp
+  80095e:	57                   	push   %edi
+  80095f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800962:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800965:	85 c9                	test   %ecx,%ecx
+  800967:	74 20                	je     800989 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800969:	89 f8                	mov    %edi,%eax
+  80096b:	09 c8                	or     %ecx,%eax
+  80096d:	a8 03                	test   $0x3,%al
+  80096f:	75 12                	jne    800983 <memset+0x28>
+		c &= 0xFF;
+  800971:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800975:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  80097b:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  80097e:	fc                   	cld
+  80097f:	f3 ab                	rep stos %eax,%es:(%edi)
+  800981:	eb 06                	jmp    800989 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800983:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800986:	fc                   	cld
+  800987:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800989:	89 f8                	mov    %edi,%eax
+  80098b:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  80098e:	c9                   	leave
+  80098f:	c3                   	ret
+
+00800990 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800990:	55                   	push   %ebp
+  800991:	89 e5                	mov    %esp,%ebp
+  800993:	57                   	push   %edi
+  800994:	56                   	push   %esi
+  800995:	8b 45 08             	mov    0x8(%ebp),%eax
+  800998:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80099b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  80099e:	39 c6                	cmp    %eax,%esi
+  8009a0:	73 32                	jae    8009d4 <memmove+0x44>
+  8009a2:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8009a5:	39 d0                	cmp    %edx,%eax
+  8009a7:	73 2b                	jae    8009d4 <memmove+0x44>
+		s += n;
+		d += n;
+  8009a9:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009ac:	89 d6                	mov    %edx,%esi
+  8009ae:	09 fe                	or     %edi,%esi
+  8009b0:	09 ce                	or     %ecx,%esi
+  8009b2:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8009b8:	75 0e                	jne    8009c8 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8009ba:	83 ef 04             	sub    $0x4,%edi
+  8009bd:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009c0:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8009c3:	fd                   	std
+  8009c4:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009c6:	eb 09                	jmp    8009d1 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009c8:	83 ef 01             	sub    $0x1,%edi
+  8009cb:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8009ce:	fd                   	std
+  8009cf:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8009d1:	fc                   	cld
+  8009d2:	eb 1a                	jmp    8009ee <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009d4:	89 f2                	mov    %esi,%edx
+  8009d6:	09 c2                	or     %eax,%edx
+  8009d8:	09 ca                	or     %ecx,%edx
+  8009da:	f6 c2 03             	test   $0x3,%dl
+  8009dd:	75 0a                	jne    8009e9 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009df:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8009e2:	89 c7                	mov    %eax,%edi
+  8009e4:	fc                   	cld
+  8009e5:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009e7:	eb 05                	jmp    8009ee <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8009e9:	89 c7                	mov    %eax,%edi
+  8009eb:	fc                   	cld
+  8009ec:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8009ee:	5e                   	pop    %esi
+  8009ef:	5f                   	pop    %edi
+  8009f0:	5d                   	pop    %ebp
+  8009f1:	c3                   	ret
+
+008009f2 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8009f2:	55                   	push   %ebp
+  8009f3:	89 e5                	mov    %esp,%ebp
+  8009f5:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8009f8:	ff 75 10             	push   0x10(%ebp)
+  8009fb:	ff 75 0c             	push   0xc(%ebp)
+  8009fe:	ff 75 08             	push   0x8(%ebp)
+  800a01:	e8 8a ff ff ff       	call   800990 <memmove>
+}
+  800a06:	c9                   	leave
+  800a07:	c3                   	ret
+
+00800a08 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a08:	55                   	push   %ebp
+  800a09:	89 e5                	mov    %esp,%ebp
+  800a0b:	56                   	push   %esi
+  800a0c:	53                   	push   %ebx
+  800a0d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a10:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a13:	89 c6                	mov    %eax,%esi
+  800a15:	03 75 10             	add    0x10(%ebp),%esi
+  800a18:	eb 06                	jmp    800a20 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a1a:	83 c0 01             	add    $0x1,%eax
+  800a1d:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a20:	39 f0                	cmp    %esi,%eax
+  800a22:	74 14                	je     800a38 <memcmp+0x30>
+		if (*s1 != *s2)
+  800a24:	0f b6 08             	movzbl (%eax),%ecx
+  800a27:	0f b6 1a             	movzbl (%edx),%ebx
+  800a2a:	38 d9                	cmp    %bl,%cl
+  800a2c:	74 ec                	je     800a1a <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a2e:	0f b6 c1             	movzbl %cl,%eax
+  800a31:	0f b6 db             	movzbl %bl,%ebx
+  800a34:	29 d8                	sub    %ebx,%eax
+  800a36:	eb 05                	jmp    800a3d <memcmp+0x35>
+	}
+
+	return 0;
+  800a38:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a3d:	5b                   	pop    %ebx
+  800a3e:	5e                   	pop    %esi
+  800a3f:	5d                   	pop    %ebp
+  800a40:	c3                   	ret
+
+00800a41 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a41:	55                   	push   %ebp
+  800a42:	89 e5                	mov    %esp,%ebp
+  800a44:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a47:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a4a:	89 c2                	mov    %eax,%edx
+  800a4c:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a4f:	eb 03                	jmp    800a54 <memfind+0x13>
+  800a51:	83 c0 01             	add    $0x1,%eax
+  800a54:	39 d0                	cmp    %edx,%eax
+  800a56:	73 04                	jae    800a5c <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a58:	38 08                	cmp    %cl,(%eax)
+  800a5a:	75 f5                	jne    800a51 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a5c:	5d                   	pop    %ebp
+  800a5d:	c3                   	ret
+
+00800a5e <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a5e:	55                   	push   %ebp
+  800a5f:	89 e5                	mov    %esp,%ebp
+  800a61:	57                   	push   %edi
+  800a62:	56                   	push   %esi
+  800a63:	53                   	push   %ebx
+  800a64:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a67:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a6a:	eb 03                	jmp    800a6f <strtol+0x11>
+		s++;
+  800a6c:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a6f:	0f b6 02             	movzbl (%edx),%eax
+  800a72:	3c 20                	cmp    $0x20,%al
+  800a74:	74 f6                	je     800a6c <strtol+0xe>
+  800a76:	3c 09                	cmp    $0x9,%al
+  800a78:	74 f2                	je     800a6c <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a7a:	3c 2b                	cmp    $0x2b,%al
+  800a7c:	74 2a                	je     800aa8 <strtol+0x4a>
+	int neg = 0;
+  800a7e:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a83:	3c 2d                	cmp    $0x2d,%al
+  800a85:	74 2b                	je     800ab2 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a87:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a8d:	75 0f                	jne    800a9e <strtol+0x40>
+  800a8f:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a92:	74 28                	je     800abc <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a94:	85 db                	test   %ebx,%ebx
+  800a96:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a9b:	0f 44 d8             	cmove  %eax,%ebx
+  800a9e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800aa3:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800aa6:	eb 46                	jmp    800aee <strtol+0x90>
+		s++;
+  800aa8:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800aab:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ab0:	eb d5                	jmp    800a87 <strtol+0x29>
+		s++, neg = 1;
+  800ab2:	83 c2 01             	add    $0x1,%edx
+  800ab5:	bf 01 00 00 00       	mov    $0x1,%edi
+  800aba:	eb cb                	jmp    800a87 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800abc:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800ac0:	74 0e                	je     800ad0 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800ac2:	85 db                	test   %ebx,%ebx
+  800ac4:	75 d8                	jne    800a9e <strtol+0x40>
+		s++, base = 8;
+  800ac6:	83 c2 01             	add    $0x1,%edx
+  800ac9:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800ace:	eb ce                	jmp    800a9e <strtol+0x40>
+		s += 2, base = 16;
+  800ad0:	83 c2 02             	add    $0x2,%edx
+  800ad3:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800ad8:	eb c4                	jmp    800a9e <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800ada:	0f be c0             	movsbl %al,%eax
+  800add:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800ae0:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800ae3:	7d 3a                	jge    800b1f <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800ae5:	83 c2 01             	add    $0x1,%edx
+  800ae8:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800aec:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800aee:	0f b6 02             	movzbl (%edx),%eax
+  800af1:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800af4:	89 f3                	mov    %esi,%ebx
+  800af6:	80 fb 09             	cmp    $0x9,%bl
+  800af9:	76 df                	jbe    800ada <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800afb:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800afe:	89 f3                	mov    %esi,%ebx
+  800b00:	80 fb 19             	cmp    $0x19,%bl
+  800b03:	77 08                	ja     800b0d <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800b05:	0f be c0             	movsbl %al,%eax
+  800b08:	83 e8 57             	sub    $0x57,%eax
+  800b0b:	eb d3                	jmp    800ae0 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b0d:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b10:	89 f3                	mov    %esi,%ebx
+  800b12:	80 fb 19             	cmp    $0x19,%bl
+  800b15:	77 08                	ja     800b1f <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800b17:	0f be c0             	movsbl %al,%eax
+  800b1a:	83 e8 37             	sub    $0x37,%eax
+  800b1d:	eb c1                	jmp    800ae0 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b1f:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b23:	74 05                	je     800b2a <strtol+0xcc>
+		*endptr = (char *) s;
+  800b25:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b28:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b2a:	89 c8                	mov    %ecx,%eax
+  800b2c:	f7 d8                	neg    %eax
+  800b2e:	85 ff                	test   %edi,%edi
+  800b30:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b33:	89 c8                	mov    %ecx,%eax
+  800b35:	5b                   	pop    %ebx
+  800b36:	5e                   	pop    %esi
+  800b37:	5f                   	pop    %edi
+  800b38:	5d                   	pop    %ebp
+  800b39:	c3                   	ret
+
+00800b3a <atoi>:
+
+int
+atoi(const char* s)
+{
+  800b3a:	55                   	push   %ebp
+  800b3b:	89 e5                	mov    %esp,%ebp
+  800b3d:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  800b40:	6a 00                	push   $0x0
+  800b42:	6a 00                	push   $0x0
+  800b44:	ff 75 08             	push   0x8(%ebp)
+  800b47:	e8 12 ff ff ff       	call   800a5e <strtol>
+}
+  800b4c:	c9                   	leave
+  800b4d:	c3                   	ret
+
+00800b4e <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800b4e:	55                   	push   %ebp
+  800b4f:	89 e5                	mov    %esp,%ebp
+  800b51:	57                   	push   %edi
+  800b52:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800b53:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b58:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b5b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b5e:	89 c3                	mov    %eax,%ebx
+  800b60:	89 c7                	mov    %eax,%edi
+  800b62:	6a 00                	push   $0x0
+  800b64:	55                   	push   %ebp
+  800b65:	56                   	push   %esi
+  800b66:	89 e5                	mov    %esp,%ebp
+  800b68:	8d 35 70 0b 80 00    	lea    0x800b70,%esi
+  800b6e:	0f 34                	sysenter
+
+00800b70 <after_sysenter_label_47>:
+  800b70:	5e                   	pop    %esi
+  800b71:	5d                   	pop    %ebp
+  800b72:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800b75:	5b                   	pop    %ebx
+  800b76:	5f                   	pop    %edi
+  800b77:	5d                   	pop    %ebp
+  800b78:	c3                   	ret
+
+00800b79 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800b79:	55                   	push   %ebp
+  800b7a:	89 e5                	mov    %esp,%ebp
+  800b7c:	57                   	push   %edi
+  800b7d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800b7e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b83:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b88:	89 d1                	mov    %edx,%ecx
+  800b8a:	89 d3                	mov    %edx,%ebx
+  800b8c:	89 d7                	mov    %edx,%edi
+  800b8e:	6a 00                	push   $0x0
+  800b90:	55                   	push   %ebp
+  800b91:	56                   	push   %esi
+  800b92:	89 e5                	mov    %esp,%ebp
+  800b94:	8d 35 9c 0b 80 00    	lea    0x800b9c,%esi
+  800b9a:	0f 34                	sysenter
+
+00800b9c <after_sysenter_label_128>:
+  800b9c:	5e                   	pop    %esi
+  800b9d:	5d                   	pop    %ebp
+  800b9e:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800ba1:	5b                   	pop    %ebx
+  800ba2:	5f                   	pop    %edi
+  800ba3:	5d                   	pop    %ebp
+  800ba4:	c3                   	ret
+
+00800ba5 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800ba5:	55                   	push   %ebp
+  800ba6:	89 e5                	mov    %esp,%ebp
+  800ba8:	57                   	push   %edi
+  800ba9:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800baa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bad:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bb2:	b8 03 00 00 00       	mov    $0x3,%eax
+  800bb7:	89 cb                	mov    %ecx,%ebx
+  800bb9:	89 cf                	mov    %ecx,%edi
+  800bbb:	6a 00                	push   $0x0
+  800bbd:	55                   	push   %ebp
+  800bbe:	56                   	push   %esi
+  800bbf:	89 e5                	mov    %esp,%ebp
+  800bc1:	8d 35 c9 0b 80 00    	lea    0x800bc9,%esi
+  800bc7:	0f 34                	sysenter
+
+00800bc9 <after_sysenter_label_212>:
+  800bc9:	5e                   	pop    %esi
+  800bca:	5d                   	pop    %ebp
+  800bcb:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800bce:	85 c0                	test   %eax,%eax
+  800bd0:	7f 07                	jg     800bd9 <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800bd2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800bd5:	5b                   	pop    %ebx
+  800bd6:	5f                   	pop    %edi
+  800bd7:	5d                   	pop    %ebp
+  800bd8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800bd9:	83 ec 0c             	sub    $0xc,%esp
+  800bdc:	50                   	push   %eax
+  800bdd:	6a 03                	push   $0x3
+  800bdf:	68 55 51 80 00       	push   $0x805155
+  800be4:	6a 54                	push   $0x54
+  800be6:	68 72 51 80 00       	push   $0x805172
+  800beb:	e8 5b f5 ff ff       	call   80014b <_panic>
+
+00800bf0 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800bf0:	55                   	push   %ebp
+  800bf1:	89 e5                	mov    %esp,%ebp
+  800bf3:	57                   	push   %edi
+  800bf4:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800bf5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bfa:	b8 02 00 00 00       	mov    $0x2,%eax
+  800bff:	89 d1                	mov    %edx,%ecx
+  800c01:	89 d3                	mov    %edx,%ebx
+  800c03:	89 d7                	mov    %edx,%edi
+  800c05:	6a 00                	push   $0x0
+  800c07:	55                   	push   %ebp
+  800c08:	56                   	push   %esi
+  800c09:	89 e5                	mov    %esp,%ebp
+  800c0b:	8d 35 13 0c 80 00    	lea    0x800c13,%esi
+  800c11:	0f 34                	sysenter
+
+00800c13 <after_sysenter_label_309>:
+  800c13:	5e                   	pop    %esi
+  800c14:	5d                   	pop    %ebp
+  800c15:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800c18:	5b                   	pop    %ebx
+  800c19:	5f                   	pop    %edi
+  800c1a:	5d                   	pop    %ebp
+  800c1b:	c3                   	ret
+
+00800c1c <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800c1c:	55                   	push   %ebp
+  800c1d:	89 e5                	mov    %esp,%ebp
+  800c1f:	57                   	push   %edi
+  800c20:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c21:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c26:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800c2b:	89 d1                	mov    %edx,%ecx
+  800c2d:	89 d3                	mov    %edx,%ebx
+  800c2f:	89 d7                	mov    %edx,%edi
+  800c31:	6a 00                	push   $0x0
+  800c33:	55                   	push   %ebp
+  800c34:	56                   	push   %esi
+  800c35:	89 e5                	mov    %esp,%ebp
+  800c37:	8d 35 3f 0c 80 00    	lea    0x800c3f,%esi
+  800c3d:	0f 34                	sysenter
+
+00800c3f <after_sysenter_label_391>:
+  800c3f:	5e                   	pop    %esi
+  800c40:	5d                   	pop    %ebp
+  800c41:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800c44:	5b                   	pop    %ebx
+  800c45:	5f                   	pop    %edi
+  800c46:	5d                   	pop    %ebp
+  800c47:	c3                   	ret
+
+00800c48 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c48:	55                   	push   %ebp
+  800c49:	89 e5                	mov    %esp,%ebp
+  800c4b:	57                   	push   %edi
+  800c4c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c4d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c50:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c53:	b8 04 00 00 00       	mov    $0x4,%eax
+  800c58:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c5d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c60:	6a 00                	push   $0x0
+  800c62:	55                   	push   %ebp
+  800c63:	56                   	push   %esi
+  800c64:	89 e5                	mov    %esp,%ebp
+  800c66:	8d 35 6e 0c 80 00    	lea    0x800c6e,%esi
+  800c6c:	0f 34                	sysenter
+
+00800c6e <after_sysenter_label_479>:
+  800c6e:	5e                   	pop    %esi
+  800c6f:	5d                   	pop    %ebp
+  800c70:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800c73:	85 c0                	test   %eax,%eax
+  800c75:	7f 07                	jg     800c7e <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800c77:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c7a:	5b                   	pop    %ebx
+  800c7b:	5f                   	pop    %edi
+  800c7c:	5d                   	pop    %ebp
+  800c7d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c7e:	83 ec 0c             	sub    $0xc,%esp
+  800c81:	50                   	push   %eax
+  800c82:	6a 04                	push   $0x4
+  800c84:	68 55 51 80 00       	push   $0x805155
+  800c89:	6a 54                	push   $0x54
+  800c8b:	68 72 51 80 00       	push   $0x805172
+  800c90:	e8 b6 f4 ff ff       	call   80014b <_panic>
+
+00800c95 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800c95:	55                   	push   %ebp
+  800c96:	89 e5                	mov    %esp,%ebp
+  800c98:	57                   	push   %edi
+  800c99:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c9a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c9d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ca0:	b8 05 00 00 00       	mov    $0x5,%eax
+  800ca5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ca8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800cab:	ff 75 18             	push   0x18(%ebp)
+  800cae:	55                   	push   %ebp
+  800caf:	56                   	push   %esi
+  800cb0:	89 e5                	mov    %esp,%ebp
+  800cb2:	8d 35 ba 0c 80 00    	lea    0x800cba,%esi
+  800cb8:	0f 34                	sysenter
+
+00800cba <after_sysenter_label_593>:
+  800cba:	5e                   	pop    %esi
+  800cbb:	5d                   	pop    %ebp
+  800cbc:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800cbf:	85 c0                	test   %eax,%eax
+  800cc1:	7f 07                	jg     800cca <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800cc3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800cc6:	5b                   	pop    %ebx
+  800cc7:	5f                   	pop    %edi
+  800cc8:	5d                   	pop    %ebp
+  800cc9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cca:	83 ec 0c             	sub    $0xc,%esp
+  800ccd:	50                   	push   %eax
+  800cce:	6a 05                	push   $0x5
+  800cd0:	68 55 51 80 00       	push   $0x805155
+  800cd5:	6a 54                	push   $0x54
+  800cd7:	68 72 51 80 00       	push   $0x805172
+  800cdc:	e8 6a f4 ff ff       	call   80014b <_panic>
+
+00800ce1 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800ce1:	55                   	push   %ebp
+  800ce2:	89 e5                	mov    %esp,%ebp
+  800ce4:	57                   	push   %edi
+  800ce5:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ce6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ceb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cf1:	b8 06 00 00 00       	mov    $0x6,%eax
+  800cf6:	89 df                	mov    %ebx,%edi
+  800cf8:	6a 00                	push   $0x0
+  800cfa:	55                   	push   %ebp
+  800cfb:	56                   	push   %esi
+  800cfc:	89 e5                	mov    %esp,%ebp
+  800cfe:	8d 35 06 0d 80 00    	lea    0x800d06,%esi
+  800d04:	0f 34                	sysenter
+
+00800d06 <after_sysenter_label_704>:
+  800d06:	5e                   	pop    %esi
+  800d07:	5d                   	pop    %ebp
+  800d08:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d0b:	85 c0                	test   %eax,%eax
+  800d0d:	7f 07                	jg     800d16 <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d0f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d12:	5b                   	pop    %ebx
+  800d13:	5f                   	pop    %edi
+  800d14:	5d                   	pop    %ebp
+  800d15:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d16:	83 ec 0c             	sub    $0xc,%esp
+  800d19:	50                   	push   %eax
+  800d1a:	6a 06                	push   $0x6
+  800d1c:	68 55 51 80 00       	push   $0x805155
+  800d21:	6a 54                	push   $0x54
+  800d23:	68 72 51 80 00       	push   $0x805172
+  800d28:	e8 1e f4 ff ff       	call   80014b <_panic>
+
+00800d2d <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800d2d:	55                   	push   %ebp
+  800d2e:	89 e5                	mov    %esp,%ebp
+  800d30:	57                   	push   %edi
+  800d31:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d32:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d37:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d3a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d3d:	b8 08 00 00 00       	mov    $0x8,%eax
+  800d42:	89 df                	mov    %ebx,%edi
+  800d44:	6a 00                	push   $0x0
+  800d46:	55                   	push   %ebp
+  800d47:	56                   	push   %esi
+  800d48:	89 e5                	mov    %esp,%ebp
+  800d4a:	8d 35 52 0d 80 00    	lea    0x800d52,%esi
+  800d50:	0f 34                	sysenter
+
+00800d52 <after_sysenter_label_808>:
+  800d52:	5e                   	pop    %esi
+  800d53:	5d                   	pop    %ebp
+  800d54:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d57:	85 c0                	test   %eax,%eax
+  800d59:	7f 07                	jg     800d62 <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800d5b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d5e:	5b                   	pop    %ebx
+  800d5f:	5f                   	pop    %edi
+  800d60:	5d                   	pop    %ebp
+  800d61:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d62:	83 ec 0c             	sub    $0xc,%esp
+  800d65:	50                   	push   %eax
+  800d66:	6a 08                	push   $0x8
+  800d68:	68 55 51 80 00       	push   $0x805155
+  800d6d:	6a 54                	push   $0x54
+  800d6f:	68 72 51 80 00       	push   $0x805172
+  800d74:	e8 d2 f3 ff ff       	call   80014b <_panic>
+
+00800d79 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800d79:	55                   	push   %ebp
+  800d7a:	89 e5                	mov    %esp,%ebp
+  800d7c:	57                   	push   %edi
+  800d7d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d7e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d83:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d86:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d89:	b8 09 00 00 00       	mov    $0x9,%eax
+  800d8e:	89 df                	mov    %ebx,%edi
+  800d90:	6a 00                	push   $0x0
+  800d92:	55                   	push   %ebp
+  800d93:	56                   	push   %esi
+  800d94:	89 e5                	mov    %esp,%ebp
+  800d96:	8d 35 9e 0d 80 00    	lea    0x800d9e,%esi
+  800d9c:	0f 34                	sysenter
+
+00800d9e <after_sysenter_label_912>:
+  800d9e:	5e                   	pop    %esi
+  800d9f:	5d                   	pop    %ebp
+  800da0:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800da3:	85 c0                	test   %eax,%eax
+  800da5:	7f 07                	jg     800dae <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800da7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800daa:	5b                   	pop    %ebx
+  800dab:	5f                   	pop    %edi
+  800dac:	5d                   	pop    %ebp
+  800dad:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dae:	83 ec 0c             	sub    $0xc,%esp
+  800db1:	50                   	push   %eax
+  800db2:	6a 09                	push   $0x9
+  800db4:	68 55 51 80 00       	push   $0x805155
+  800db9:	6a 54                	push   $0x54
+  800dbb:	68 72 51 80 00       	push   $0x805172
+  800dc0:	e8 86 f3 ff ff       	call   80014b <_panic>
+
+00800dc5 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800dc5:	55                   	push   %ebp
+  800dc6:	89 e5                	mov    %esp,%ebp
+  800dc8:	57                   	push   %edi
+  800dc9:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800dca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dcf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dd5:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800dda:	89 df                	mov    %ebx,%edi
+  800ddc:	6a 00                	push   $0x0
+  800dde:	55                   	push   %ebp
+  800ddf:	56                   	push   %esi
+  800de0:	89 e5                	mov    %esp,%ebp
+  800de2:	8d 35 ea 0d 80 00    	lea    0x800dea,%esi
+  800de8:	0f 34                	sysenter
+
+00800dea <after_sysenter_label_1016>:
+  800dea:	5e                   	pop    %esi
+  800deb:	5d                   	pop    %ebp
+  800dec:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800def:	85 c0                	test   %eax,%eax
+  800df1:	7f 07                	jg     800dfa <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800df3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800df6:	5b                   	pop    %ebx
+  800df7:	5f                   	pop    %edi
+  800df8:	5d                   	pop    %ebp
+  800df9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dfa:	83 ec 0c             	sub    $0xc,%esp
+  800dfd:	50                   	push   %eax
+  800dfe:	6a 0a                	push   $0xa
+  800e00:	68 55 51 80 00       	push   $0x805155
+  800e05:	6a 54                	push   $0x54
+  800e07:	68 72 51 80 00       	push   $0x805172
+  800e0c:	e8 3a f3 ff ff       	call   80014b <_panic>
+
+00800e11 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800e11:	55                   	push   %ebp
+  800e12:	89 e5                	mov    %esp,%ebp
+  800e14:	57                   	push   %edi
+  800e15:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e16:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e19:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e1c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800e21:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e24:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e27:	6a 00                	push   $0x0
+  800e29:	55                   	push   %ebp
+  800e2a:	56                   	push   %esi
+  800e2b:	89 e5                	mov    %esp,%ebp
+  800e2d:	8d 35 35 0e 80 00    	lea    0x800e35,%esi
+  800e33:	0f 34                	sysenter
+
+00800e35 <after_sysenter_label_1126>:
+  800e35:	5e                   	pop    %esi
+  800e36:	5d                   	pop    %ebp
+  800e37:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800e3a:	5b                   	pop    %ebx
+  800e3b:	5f                   	pop    %edi
+  800e3c:	5d                   	pop    %ebp
+  800e3d:	c3                   	ret
+
+00800e3e <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800e3e:	55                   	push   %ebp
+  800e3f:	89 e5                	mov    %esp,%ebp
+  800e41:	57                   	push   %edi
+  800e42:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e43:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e46:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e4b:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e50:	89 cb                	mov    %ecx,%ebx
+  800e52:	89 cf                	mov    %ecx,%edi
+  800e54:	6a 00                	push   $0x0
+  800e56:	55                   	push   %ebp
+  800e57:	56                   	push   %esi
+  800e58:	89 e5                	mov    %esp,%ebp
+  800e5a:	8d 35 62 0e 80 00    	lea    0x800e62,%esi
+  800e60:	0f 34                	sysenter
+
+00800e62 <after_sysenter_label_1210>:
+  800e62:	5e                   	pop    %esi
+  800e63:	5d                   	pop    %ebp
+  800e64:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e67:	85 c0                	test   %eax,%eax
+  800e69:	7f 07                	jg     800e72 <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800e6b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e6e:	5b                   	pop    %ebx
+  800e6f:	5f                   	pop    %edi
+  800e70:	5d                   	pop    %ebp
+  800e71:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e72:	83 ec 0c             	sub    $0xc,%esp
+  800e75:	50                   	push   %eax
+  800e76:	6a 0d                	push   $0xd
+  800e78:	68 55 51 80 00       	push   $0x805155
+  800e7d:	6a 54                	push   $0x54
+  800e7f:	68 72 51 80 00       	push   $0x805172
+  800e84:	e8 c2 f2 ff ff       	call   80014b <_panic>
+
+00800e89 <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  800e89:	55                   	push   %ebp
+  800e8a:	89 e5                	mov    %esp,%ebp
+  800e8c:	57                   	push   %edi
+  800e8d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e8e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e93:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e96:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e99:	b8 42 00 00 00       	mov    $0x42,%eax
+  800e9e:	89 df                	mov    %ebx,%edi
+  800ea0:	6a 00                	push   $0x0
+  800ea2:	55                   	push   %ebp
+  800ea3:	56                   	push   %esi
+  800ea4:	89 e5                	mov    %esp,%ebp
+  800ea6:	8d 35 ae 0e 80 00    	lea    0x800eae,%esi
+  800eac:	0f 34                	sysenter
+
+00800eae <after_sysenter_label_1311>:
+  800eae:	5e                   	pop    %esi
+  800eaf:	5d                   	pop    %ebp
+  800eb0:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800eb3:	85 c0                	test   %eax,%eax
+  800eb5:	7f 07                	jg     800ebe <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  800eb7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800eba:	5b                   	pop    %ebx
+  800ebb:	5f                   	pop    %edi
+  800ebc:	5d                   	pop    %ebp
+  800ebd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ebe:	83 ec 0c             	sub    $0xc,%esp
+  800ec1:	50                   	push   %eax
+  800ec2:	6a 42                	push   $0x42
+  800ec4:	68 55 51 80 00       	push   $0x805155
+  800ec9:	6a 54                	push   $0x54
+  800ecb:	68 72 51 80 00       	push   $0x805172
+  800ed0:	e8 76 f2 ff ff       	call   80014b <_panic>
+
+00800ed5 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800ed5:	55                   	push   %ebp
+  800ed6:	89 e5                	mov    %esp,%ebp
+  800ed8:	57                   	push   %edi
+  800ed9:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800eda:	ba 00 00 00 00       	mov    $0x0,%edx
+  800edf:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800ee4:	89 d1                	mov    %edx,%ecx
+  800ee6:	89 d3                	mov    %edx,%ebx
+  800ee8:	89 d7                	mov    %edx,%edi
+  800eea:	6a 00                	push   $0x0
+  800eec:	55                   	push   %ebp
+  800eed:	56                   	push   %esi
+  800eee:	89 e5                	mov    %esp,%ebp
+  800ef0:	8d 35 f8 0e 80 00    	lea    0x800ef8,%esi
+  800ef6:	0f 34                	sysenter
+
+00800ef8 <after_sysenter_label_1411>:
+  800ef8:	5e                   	pop    %esi
+  800ef9:	5d                   	pop    %ebp
+  800efa:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800efd:	5b                   	pop    %ebx
+  800efe:	5f                   	pop    %edi
+  800eff:	5d                   	pop    %ebp
+  800f00:	c3                   	ret
+
+00800f01 <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  800f01:	55                   	push   %ebp
+  800f02:	89 e5                	mov    %esp,%ebp
+  800f04:	57                   	push   %edi
+  800f05:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f06:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f0b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f0e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f11:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f16:	89 df                	mov    %ebx,%edi
+  800f18:	6a 00                	push   $0x0
+  800f1a:	55                   	push   %ebp
+  800f1b:	56                   	push   %esi
+  800f1c:	89 e5                	mov    %esp,%ebp
+  800f1e:	8d 35 26 0f 80 00    	lea    0x800f26,%esi
+  800f24:	0f 34                	sysenter
+
+00800f26 <after_sysenter_label_1497>:
+  800f26:	5e                   	pop    %esi
+  800f27:	5d                   	pop    %ebp
+  800f28:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  800f2b:	5b                   	pop    %ebx
+  800f2c:	5f                   	pop    %edi
+  800f2d:	5d                   	pop    %ebp
+  800f2e:	c3                   	ret
+
+00800f2f <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  800f2f:	55                   	push   %ebp
+  800f30:	89 e5                	mov    %esp,%ebp
+  800f32:	57                   	push   %edi
+  800f33:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f34:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f39:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f3c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f3f:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f44:	89 df                	mov    %ebx,%edi
+  800f46:	6a 00                	push   $0x0
+  800f48:	55                   	push   %ebp
+  800f49:	56                   	push   %esi
+  800f4a:	89 e5                	mov    %esp,%ebp
+  800f4c:	8d 35 54 0f 80 00    	lea    0x800f54,%esi
+  800f52:	0f 34                	sysenter
+
+00800f54 <after_sysenter_label_1583>:
+  800f54:	5e                   	pop    %esi
+  800f55:	5d                   	pop    %ebp
+  800f56:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  800f59:	5b                   	pop    %ebx
+  800f5a:	5f                   	pop    %edi
+  800f5b:	5d                   	pop    %ebp
+  800f5c:	c3                   	ret
+
+00800f5d <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  800f5d:	55                   	push   %ebp
+  800f5e:	89 e5                	mov    %esp,%ebp
+  800f60:	57                   	push   %edi
+  800f61:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f62:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f65:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f68:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f6d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f72:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f75:	6a 00                	push   $0x0
+  800f77:	55                   	push   %ebp
+  800f78:	56                   	push   %esi
+  800f79:	89 e5                	mov    %esp,%ebp
+  800f7b:	8d 35 83 0f 80 00    	lea    0x800f83,%esi
+  800f81:	0f 34                	sysenter
+
+00800f83 <after_sysenter_label_1672>:
+  800f83:	5e                   	pop    %esi
+  800f84:	5d                   	pop    %ebp
+  800f85:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  800f88:	5b                   	pop    %ebx
+  800f89:	5f                   	pop    %edi
+  800f8a:	5d                   	pop    %ebp
+  800f8b:	c3                   	ret
+
+00800f8c <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  800f8c:	55                   	push   %ebp
+  800f8d:	89 e5                	mov    %esp,%ebp
+  800f8f:	57                   	push   %edi
+  800f90:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f91:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f96:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f99:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f9c:	b8 12 00 00 00       	mov    $0x12,%eax
+  800fa1:	89 df                	mov    %ebx,%edi
+  800fa3:	6a 00                	push   $0x0
+  800fa5:	55                   	push   %ebp
+  800fa6:	56                   	push   %esi
+  800fa7:	89 e5                	mov    %esp,%ebp
+  800fa9:	8d 35 b1 0f 80 00    	lea    0x800fb1,%esi
+  800faf:	0f 34                	sysenter
+
+00800fb1 <after_sysenter_label_1758>:
+  800fb1:	5e                   	pop    %esi
+  800fb2:	5d                   	pop    %ebp
+  800fb3:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  800fb6:	5b                   	pop    %ebx
+  800fb7:	5f                   	pop    %edi
+  800fb8:	5d                   	pop    %ebp
+  800fb9:	c3                   	ret
+
+00800fba <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  800fba:	55                   	push   %ebp
+  800fbb:	89 e5                	mov    %esp,%ebp
+  800fbd:	57                   	push   %edi
+  800fbe:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fbf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fc7:	b8 13 00 00 00       	mov    $0x13,%eax
+  800fcc:	89 cb                	mov    %ecx,%ebx
+  800fce:	89 cf                	mov    %ecx,%edi
+  800fd0:	6a 00                	push   $0x0
+  800fd2:	55                   	push   %ebp
+  800fd3:	56                   	push   %esi
+  800fd4:	89 e5                	mov    %esp,%ebp
+  800fd6:	8d 35 de 0f 80 00    	lea    0x800fde,%esi
+  800fdc:	0f 34                	sysenter
+
+00800fde <after_sysenter_label_1842>:
+  800fde:	5e                   	pop    %esi
+  800fdf:	5d                   	pop    %ebp
+  800fe0:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800fe3:	85 c0                	test   %eax,%eax
+  800fe5:	7f 07                	jg     800fee <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  800fe7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fea:	5b                   	pop    %ebx
+  800feb:	5f                   	pop    %edi
+  800fec:	5d                   	pop    %ebp
+  800fed:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fee:	83 ec 0c             	sub    $0xc,%esp
+  800ff1:	50                   	push   %eax
+  800ff2:	6a 13                	push   $0x13
+  800ff4:	68 55 51 80 00       	push   $0x805155
+  800ff9:	6a 54                	push   $0x54
+  800ffb:	68 72 51 80 00       	push   $0x805172
+  801000:	e8 46 f1 ff ff       	call   80014b <_panic>
+
+00801005 <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  801005:	55                   	push   %ebp
+  801006:	89 e5                	mov    %esp,%ebp
+  801008:	57                   	push   %edi
+  801009:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80100a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80100f:	b8 14 00 00 00       	mov    $0x14,%eax
+  801014:	89 d1                	mov    %edx,%ecx
+  801016:	89 d3                	mov    %edx,%ebx
+  801018:	89 d7                	mov    %edx,%edi
+  80101a:	6a 00                	push   $0x0
+  80101c:	55                   	push   %ebp
+  80101d:	56                   	push   %esi
+  80101e:	89 e5                	mov    %esp,%ebp
+  801020:	8d 35 28 10 80 00    	lea    0x801028,%esi
+  801026:	0f 34                	sysenter
+
+00801028 <after_sysenter_label_1939>:
+  801028:	5e                   	pop    %esi
+  801029:	5d                   	pop    %ebp
+  80102a:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  80102d:	5b                   	pop    %ebx
+  80102e:	5f                   	pop    %edi
+  80102f:	5d                   	pop    %ebp
+  801030:	c3                   	ret
+
+00801031 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  801031:	55                   	push   %ebp
+  801032:	89 e5                	mov    %esp,%ebp
+  801034:	57                   	push   %edi
+  801035:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801036:	8b 55 08             	mov    0x8(%ebp),%edx
+  801039:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80103c:	b8 15 00 00 00       	mov    $0x15,%eax
+  801041:	bf 00 00 00 00       	mov    $0x0,%edi
+  801046:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801049:	6a 00                	push   $0x0
+  80104b:	55                   	push   %ebp
+  80104c:	56                   	push   %esi
+  80104d:	89 e5                	mov    %esp,%ebp
+  80104f:	8d 35 57 10 80 00    	lea    0x801057,%esi
+  801055:	0f 34                	sysenter
+
+00801057 <after_sysenter_label_2028>:
+  801057:	5e                   	pop    %esi
+  801058:	5d                   	pop    %ebp
+  801059:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  80105c:	5b                   	pop    %ebx
+  80105d:	5f                   	pop    %edi
+  80105e:	5d                   	pop    %ebp
+  80105f:	c3                   	ret
+
+00801060 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  801060:	55                   	push   %ebp
+  801061:	89 e5                	mov    %esp,%ebp
+  801063:	57                   	push   %edi
+  801064:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801065:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80106a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80106d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801070:	b8 16 00 00 00       	mov    $0x16,%eax
+  801075:	89 df                	mov    %ebx,%edi
+  801077:	6a 00                	push   $0x0
+  801079:	55                   	push   %ebp
+  80107a:	56                   	push   %esi
+  80107b:	89 e5                	mov    %esp,%ebp
+  80107d:	8d 35 85 10 80 00    	lea    0x801085,%esi
+  801083:	0f 34                	sysenter
+
+00801085 <after_sysenter_label_2114>:
+  801085:	5e                   	pop    %esi
+  801086:	5d                   	pop    %ebp
+  801087:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  80108a:	5b                   	pop    %ebx
+  80108b:	5f                   	pop    %edi
+  80108c:	5d                   	pop    %ebp
+  80108d:	c3                   	ret
+
+0080108e <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  80108e:	55                   	push   %ebp
+  80108f:	89 e5                	mov    %esp,%ebp
+  801091:	57                   	push   %edi
+  801092:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801093:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801098:	8b 55 08             	mov    0x8(%ebp),%edx
+  80109b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80109e:	b8 17 00 00 00       	mov    $0x17,%eax
+  8010a3:	89 df                	mov    %ebx,%edi
+  8010a5:	6a 00                	push   $0x0
+  8010a7:	55                   	push   %ebp
+  8010a8:	56                   	push   %esi
+  8010a9:	89 e5                	mov    %esp,%ebp
+  8010ab:	8d 35 b3 10 80 00    	lea    0x8010b3,%esi
+  8010b1:	0f 34                	sysenter
+
+008010b3 <after_sysenter_label_2200>:
+  8010b3:	5e                   	pop    %esi
+  8010b4:	5d                   	pop    %ebp
+  8010b5:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  8010b8:	5b                   	pop    %ebx
+  8010b9:	5f                   	pop    %edi
+  8010ba:	5d                   	pop    %ebp
+  8010bb:	c3                   	ret
+
+008010bc <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  8010bc:	55                   	push   %ebp
+  8010bd:	89 e5                	mov    %esp,%ebp
+  8010bf:	57                   	push   %edi
+  8010c0:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010cc:	b8 18 00 00 00       	mov    $0x18,%eax
+  8010d1:	89 df                	mov    %ebx,%edi
+  8010d3:	6a 00                	push   $0x0
+  8010d5:	55                   	push   %ebp
+  8010d6:	56                   	push   %esi
+  8010d7:	89 e5                	mov    %esp,%ebp
+  8010d9:	8d 35 e1 10 80 00    	lea    0x8010e1,%esi
+  8010df:	0f 34                	sysenter
+
+008010e1 <after_sysenter_label_2286>:
+  8010e1:	5e                   	pop    %esi
+  8010e2:	5d                   	pop    %ebp
+  8010e3:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  8010e6:	5b                   	pop    %ebx
+  8010e7:	5f                   	pop    %edi
+  8010e8:	5d                   	pop    %ebp
+  8010e9:	c3                   	ret
+
+008010ea <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8010ea:	55                   	push   %ebp
+  8010eb:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8010ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010f0:	05 00 00 00 30       	add    $0x30000000,%eax
+  8010f5:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8010f8:	5d                   	pop    %ebp
+  8010f9:	c3                   	ret
+
+008010fa <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8010fa:	55                   	push   %ebp
+  8010fb:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8010fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801100:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801105:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80110a:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80110f:	5d                   	pop    %ebp
+  801110:	c3                   	ret
+
+00801111 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801111:	55                   	push   %ebp
+  801112:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801114:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801119:	eb 02                	jmp    80111d <fd_alloc+0xc>
+  80111b:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80111d:	89 c2                	mov    %eax,%edx
+  80111f:	c1 ea 16             	shr    $0x16,%edx
+  801122:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801129:	f6 c2 01             	test   $0x1,%dl
+  80112c:	74 2b                	je     801159 <fd_alloc+0x48>
+  80112e:	89 c2                	mov    %eax,%edx
+  801130:	c1 ea 0c             	shr    $0xc,%edx
+  801133:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80113a:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801140:	f6 c1 01             	test   $0x1,%cl
+  801143:	74 14                	je     801159 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801145:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80114b:	75 ce                	jne    80111b <fd_alloc+0xa>
+  80114d:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801152:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801157:	eb 05                	jmp    80115e <fd_alloc+0x4d>
+			return 0;
+  801159:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80115e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801161:	89 02                	mov    %eax,(%edx)
+}
+  801163:	89 c8                	mov    %ecx,%eax
+  801165:	5d                   	pop    %ebp
+  801166:	c3                   	ret
+
+00801167 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801167:	55                   	push   %ebp
+  801168:	89 e5                	mov    %esp,%ebp
+  80116a:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80116d:	83 f8 1f             	cmp    $0x1f,%eax
+  801170:	77 30                	ja     8011a2 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801172:	c1 e0 0c             	shl    $0xc,%eax
+  801175:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80117a:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801180:	f6 c2 01             	test   $0x1,%dl
+  801183:	74 24                	je     8011a9 <fd_lookup+0x42>
+  801185:	89 c2                	mov    %eax,%edx
+  801187:	c1 ea 0c             	shr    $0xc,%edx
+  80118a:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801191:	f6 c2 01             	test   $0x1,%dl
+  801194:	74 1a                	je     8011b0 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801196:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801199:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80119b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011a0:	5d                   	pop    %ebp
+  8011a1:	c3                   	ret
+		return -E_INVAL;
+  8011a2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011a7:	eb f7                	jmp    8011a0 <fd_lookup+0x39>
+		return -E_INVAL;
+  8011a9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011ae:	eb f0                	jmp    8011a0 <fd_lookup+0x39>
+  8011b0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011b5:	eb e9                	jmp    8011a0 <fd_lookup+0x39>
+
+008011b7 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8011b7:	55                   	push   %ebp
+  8011b8:	89 e5                	mov    %esp,%ebp
+  8011ba:	53                   	push   %ebx
+  8011bb:	83 ec 04             	sub    $0x4,%esp
+  8011be:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8011c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011c6:	eb 03                	jmp    8011cb <dev_lookup+0x14>
+  8011c8:	83 c0 01             	add    $0x1,%eax
+  8011cb:	8b 1c 85 fc 51 80 00 	mov    0x8051fc(,%eax,4),%ebx
+  8011d2:	85 db                	test   %ebx,%ebx
+  8011d4:	74 0b                	je     8011e1 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8011d6:	39 13                	cmp    %edx,(%ebx)
+  8011d8:	75 ee                	jne    8011c8 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8011da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011df:	eb 49                	jmp    80122a <dev_lookup+0x73>
+  8011e1:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8011e3:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  8011e9:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8011ee:	77 18                	ja     801208 <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8011f0:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8011f5:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  8011f7:	c1 e8 10             	shr    $0x10,%eax
+  8011fa:	74 0c                	je     801208 <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8011fc:	c1 e0 10             	shl    $0x10,%eax
+  8011ff:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  801204:	29 c1                	sub    %eax,%ecx
+  801206:	eb 06                	jmp    80120e <dev_lookup+0x57>
+		return pthread_main_tls;
+  801208:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80120e:	8b 01                	mov    (%ecx),%eax
+  801210:	8b 40 48             	mov    0x48(%eax),%eax
+  801213:	83 ec 04             	sub    $0x4,%esp
+  801216:	52                   	push   %edx
+  801217:	50                   	push   %eax
+  801218:	68 80 51 80 00       	push   $0x805180
+  80121d:	e8 04 f0 ff ff       	call   800226 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801222:	83 c4 10             	add    $0x10,%esp
+  801225:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80122a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80122d:	89 1a                	mov    %ebx,(%edx)
+}
+  80122f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801232:	c9                   	leave
+  801233:	c3                   	ret
+
+00801234 <fd_close>:
+{
+  801234:	55                   	push   %ebp
+  801235:	89 e5                	mov    %esp,%ebp
+  801237:	57                   	push   %edi
+  801238:	56                   	push   %esi
+  801239:	53                   	push   %ebx
+  80123a:	83 ec 24             	sub    $0x24,%esp
+  80123d:	8b 75 08             	mov    0x8(%ebp),%esi
+  801240:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801243:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801246:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801247:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80124d:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801250:	50                   	push   %eax
+  801251:	e8 11 ff ff ff       	call   801167 <fd_lookup>
+  801256:	89 c3                	mov    %eax,%ebx
+  801258:	83 c4 10             	add    $0x10,%esp
+  80125b:	85 c0                	test   %eax,%eax
+  80125d:	78 05                	js     801264 <fd_close+0x30>
+	    || fd != fd2)
+  80125f:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801262:	74 16                	je     80127a <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801264:	89 f8                	mov    %edi,%eax
+  801266:	84 c0                	test   %al,%al
+  801268:	b8 00 00 00 00       	mov    $0x0,%eax
+  80126d:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801270:	89 d8                	mov    %ebx,%eax
+  801272:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801275:	5b                   	pop    %ebx
+  801276:	5e                   	pop    %esi
+  801277:	5f                   	pop    %edi
+  801278:	5d                   	pop    %ebp
+  801279:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80127a:	83 ec 08             	sub    $0x8,%esp
+  80127d:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801280:	50                   	push   %eax
+  801281:	ff 36                	push   (%esi)
+  801283:	e8 2f ff ff ff       	call   8011b7 <dev_lookup>
+  801288:	89 c3                	mov    %eax,%ebx
+  80128a:	83 c4 10             	add    $0x10,%esp
+  80128d:	85 c0                	test   %eax,%eax
+  80128f:	78 1a                	js     8012ab <fd_close+0x77>
+		if (dev->dev_close)
+  801291:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801294:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801297:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80129c:	85 c0                	test   %eax,%eax
+  80129e:	74 0b                	je     8012ab <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8012a0:	83 ec 0c             	sub    $0xc,%esp
+  8012a3:	56                   	push   %esi
+  8012a4:	ff d0                	call   *%eax
+  8012a6:	89 c3                	mov    %eax,%ebx
+  8012a8:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8012ab:	83 ec 08             	sub    $0x8,%esp
+  8012ae:	56                   	push   %esi
+  8012af:	6a 00                	push   $0x0
+  8012b1:	e8 2b fa ff ff       	call   800ce1 <sys_page_unmap>
+	return r;
+  8012b6:	83 c4 10             	add    $0x10,%esp
+  8012b9:	eb b5                	jmp    801270 <fd_close+0x3c>
+
+008012bb <close>:
+
+int
+close(int fdnum)
+{
+  8012bb:	55                   	push   %ebp
+  8012bc:	89 e5                	mov    %esp,%ebp
+  8012be:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8012c1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8012c4:	50                   	push   %eax
+  8012c5:	ff 75 08             	push   0x8(%ebp)
+  8012c8:	e8 9a fe ff ff       	call   801167 <fd_lookup>
+  8012cd:	83 c4 10             	add    $0x10,%esp
+  8012d0:	85 c0                	test   %eax,%eax
+  8012d2:	79 02                	jns    8012d6 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8012d4:	c9                   	leave
+  8012d5:	c3                   	ret
+		return fd_close(fd, 1);
+  8012d6:	83 ec 08             	sub    $0x8,%esp
+  8012d9:	6a 01                	push   $0x1
+  8012db:	ff 75 f4             	push   -0xc(%ebp)
+  8012de:	e8 51 ff ff ff       	call   801234 <fd_close>
+  8012e3:	83 c4 10             	add    $0x10,%esp
+  8012e6:	eb ec                	jmp    8012d4 <close+0x19>
+
+008012e8 <close_all>:
+
+void
+close_all(void)
+{
+  8012e8:	55                   	push   %ebp
+  8012e9:	89 e5                	mov    %esp,%ebp
+  8012eb:	53                   	push   %ebx
+  8012ec:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8012ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8012f4:	83 ec 0c             	sub    $0xc,%esp
+  8012f7:	53                   	push   %ebx
+  8012f8:	e8 be ff ff ff       	call   8012bb <close>
+	for (i = 0; i < MAXFD; i++)
+  8012fd:	83 c3 01             	add    $0x1,%ebx
+  801300:	83 c4 10             	add    $0x10,%esp
+  801303:	83 fb 20             	cmp    $0x20,%ebx
+  801306:	75 ec                	jne    8012f4 <close_all+0xc>
+}
+  801308:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80130b:	c9                   	leave
+  80130c:	c3                   	ret
+
+0080130d <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80130d:	55                   	push   %ebp
+  80130e:	89 e5                	mov    %esp,%ebp
+  801310:	57                   	push   %edi
+  801311:	56                   	push   %esi
+  801312:	53                   	push   %ebx
+  801313:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801316:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801319:	50                   	push   %eax
+  80131a:	ff 75 08             	push   0x8(%ebp)
+  80131d:	e8 45 fe ff ff       	call   801167 <fd_lookup>
+  801322:	89 c3                	mov    %eax,%ebx
+  801324:	83 c4 10             	add    $0x10,%esp
+  801327:	85 c0                	test   %eax,%eax
+  801329:	78 7f                	js     8013aa <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80132b:	83 ec 0c             	sub    $0xc,%esp
+  80132e:	ff 75 0c             	push   0xc(%ebp)
+  801331:	e8 85 ff ff ff       	call   8012bb <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801336:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801339:	c1 e6 0c             	shl    $0xc,%esi
+  80133c:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801342:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801345:	89 3c 24             	mov    %edi,(%esp)
+  801348:	e8 ad fd ff ff       	call   8010fa <fd2data>
+  80134d:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80134f:	89 34 24             	mov    %esi,(%esp)
+  801352:	e8 a3 fd ff ff       	call   8010fa <fd2data>
+  801357:	83 c4 10             	add    $0x10,%esp
+  80135a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80135d:	89 d8                	mov    %ebx,%eax
+  80135f:	c1 e8 16             	shr    $0x16,%eax
+  801362:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801369:	a8 01                	test   $0x1,%al
+  80136b:	74 11                	je     80137e <dup+0x71>
+  80136d:	89 d8                	mov    %ebx,%eax
+  80136f:	c1 e8 0c             	shr    $0xc,%eax
+  801372:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801379:	f6 c2 01             	test   $0x1,%dl
+  80137c:	75 36                	jne    8013b4 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80137e:	89 f8                	mov    %edi,%eax
+  801380:	c1 e8 0c             	shr    $0xc,%eax
+  801383:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80138a:	83 ec 0c             	sub    $0xc,%esp
+  80138d:	25 07 0e 00 00       	and    $0xe07,%eax
+  801392:	50                   	push   %eax
+  801393:	56                   	push   %esi
+  801394:	6a 00                	push   $0x0
+  801396:	57                   	push   %edi
+  801397:	6a 00                	push   $0x0
+  801399:	e8 f7 f8 ff ff       	call   800c95 <sys_page_map>
+  80139e:	89 c3                	mov    %eax,%ebx
+  8013a0:	83 c4 20             	add    $0x20,%esp
+  8013a3:	85 c0                	test   %eax,%eax
+  8013a5:	78 33                	js     8013da <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8013a7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8013aa:	89 d8                	mov    %ebx,%eax
+  8013ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013af:	5b                   	pop    %ebx
+  8013b0:	5e                   	pop    %esi
+  8013b1:	5f                   	pop    %edi
+  8013b2:	5d                   	pop    %ebp
+  8013b3:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8013b4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8013bb:	83 ec 0c             	sub    $0xc,%esp
+  8013be:	25 07 0e 00 00       	and    $0xe07,%eax
+  8013c3:	50                   	push   %eax
+  8013c4:	ff 75 d4             	push   -0x2c(%ebp)
+  8013c7:	6a 00                	push   $0x0
+  8013c9:	53                   	push   %ebx
+  8013ca:	6a 00                	push   $0x0
+  8013cc:	e8 c4 f8 ff ff       	call   800c95 <sys_page_map>
+  8013d1:	89 c3                	mov    %eax,%ebx
+  8013d3:	83 c4 20             	add    $0x20,%esp
+  8013d6:	85 c0                	test   %eax,%eax
+  8013d8:	79 a4                	jns    80137e <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8013da:	83 ec 08             	sub    $0x8,%esp
+  8013dd:	56                   	push   %esi
+  8013de:	6a 00                	push   $0x0
+  8013e0:	e8 fc f8 ff ff       	call   800ce1 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8013e5:	83 c4 08             	add    $0x8,%esp
+  8013e8:	ff 75 d4             	push   -0x2c(%ebp)
+  8013eb:	6a 00                	push   $0x0
+  8013ed:	e8 ef f8 ff ff       	call   800ce1 <sys_page_unmap>
+	return r;
+  8013f2:	83 c4 10             	add    $0x10,%esp
+  8013f5:	eb b3                	jmp    8013aa <dup+0x9d>
+
+008013f7 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8013f7:	55                   	push   %ebp
+  8013f8:	89 e5                	mov    %esp,%ebp
+  8013fa:	56                   	push   %esi
+  8013fb:	53                   	push   %ebx
+  8013fc:	83 ec 18             	sub    $0x18,%esp
+  8013ff:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801402:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801405:	50                   	push   %eax
+  801406:	53                   	push   %ebx
+  801407:	e8 5b fd ff ff       	call   801167 <fd_lookup>
+  80140c:	83 c4 10             	add    $0x10,%esp
+  80140f:	85 c0                	test   %eax,%eax
+  801411:	78 3c                	js     80144f <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801413:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801416:	83 ec 08             	sub    $0x8,%esp
+  801419:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80141c:	50                   	push   %eax
+  80141d:	ff 36                	push   (%esi)
+  80141f:	e8 93 fd ff ff       	call   8011b7 <dev_lookup>
+  801424:	83 c4 10             	add    $0x10,%esp
+  801427:	85 c0                	test   %eax,%eax
+  801429:	78 24                	js     80144f <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80142b:	8b 46 08             	mov    0x8(%esi),%eax
+  80142e:	83 e0 03             	and    $0x3,%eax
+  801431:	83 f8 01             	cmp    $0x1,%eax
+  801434:	74 20                	je     801456 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801436:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801439:	8b 40 08             	mov    0x8(%eax),%eax
+  80143c:	85 c0                	test   %eax,%eax
+  80143e:	74 61                	je     8014a1 <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801440:	83 ec 04             	sub    $0x4,%esp
+  801443:	ff 75 10             	push   0x10(%ebp)
+  801446:	ff 75 0c             	push   0xc(%ebp)
+  801449:	56                   	push   %esi
+  80144a:	ff d0                	call   *%eax
+  80144c:	83 c4 10             	add    $0x10,%esp
+}
+  80144f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801452:	5b                   	pop    %ebx
+  801453:	5e                   	pop    %esi
+  801454:	5d                   	pop    %ebp
+  801455:	c3                   	ret
+  801456:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801458:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80145e:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801463:	77 18                	ja     80147d <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801465:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80146a:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80146c:	c1 e8 10             	shr    $0x10,%eax
+  80146f:	74 0c                	je     80147d <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801471:	c1 e0 10             	shl    $0x10,%eax
+  801474:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801479:	29 c2                	sub    %eax,%edx
+  80147b:	eb 06                	jmp    801483 <read+0x8c>
+		return pthread_main_tls;
+  80147d:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801483:	8b 02                	mov    (%edx),%eax
+  801485:	8b 40 48             	mov    0x48(%eax),%eax
+  801488:	83 ec 04             	sub    $0x4,%esp
+  80148b:	53                   	push   %ebx
+  80148c:	50                   	push   %eax
+  80148d:	68 c1 51 80 00       	push   $0x8051c1
+  801492:	e8 8f ed ff ff       	call   800226 <cprintf>
+		return -E_INVAL;
+  801497:	83 c4 10             	add    $0x10,%esp
+  80149a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80149f:	eb ae                	jmp    80144f <read+0x58>
+		return -E_NOT_SUPP;
+  8014a1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8014a6:	eb a7                	jmp    80144f <read+0x58>
+
+008014a8 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8014a8:	55                   	push   %ebp
+  8014a9:	89 e5                	mov    %esp,%ebp
+  8014ab:	57                   	push   %edi
+  8014ac:	56                   	push   %esi
+  8014ad:	53                   	push   %ebx
+  8014ae:	83 ec 0c             	sub    $0xc,%esp
+  8014b1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8014b4:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8014b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014bc:	eb 02                	jmp    8014c0 <readn+0x18>
+  8014be:	01 c3                	add    %eax,%ebx
+  8014c0:	39 f3                	cmp    %esi,%ebx
+  8014c2:	73 21                	jae    8014e5 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8014c4:	83 ec 04             	sub    $0x4,%esp
+  8014c7:	89 f0                	mov    %esi,%eax
+  8014c9:	29 d8                	sub    %ebx,%eax
+  8014cb:	50                   	push   %eax
+  8014cc:	89 d8                	mov    %ebx,%eax
+  8014ce:	03 45 0c             	add    0xc(%ebp),%eax
+  8014d1:	50                   	push   %eax
+  8014d2:	57                   	push   %edi
+  8014d3:	e8 1f ff ff ff       	call   8013f7 <read>
+		if (m < 0)
+  8014d8:	83 c4 10             	add    $0x10,%esp
+  8014db:	85 c0                	test   %eax,%eax
+  8014dd:	78 04                	js     8014e3 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8014df:	75 dd                	jne    8014be <readn+0x16>
+  8014e1:	eb 02                	jmp    8014e5 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8014e3:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8014e5:	89 d8                	mov    %ebx,%eax
+  8014e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014ea:	5b                   	pop    %ebx
+  8014eb:	5e                   	pop    %esi
+  8014ec:	5f                   	pop    %edi
+  8014ed:	5d                   	pop    %ebp
+  8014ee:	c3                   	ret
+
+008014ef <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8014ef:	55                   	push   %ebp
+  8014f0:	89 e5                	mov    %esp,%ebp
+  8014f2:	56                   	push   %esi
+  8014f3:	53                   	push   %ebx
+  8014f4:	83 ec 18             	sub    $0x18,%esp
+  8014f7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014fa:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014fd:	50                   	push   %eax
+  8014fe:	53                   	push   %ebx
+  8014ff:	e8 63 fc ff ff       	call   801167 <fd_lookup>
+  801504:	83 c4 10             	add    $0x10,%esp
+  801507:	85 c0                	test   %eax,%eax
+  801509:	78 37                	js     801542 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80150b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80150e:	83 ec 08             	sub    $0x8,%esp
+  801511:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801514:	50                   	push   %eax
+  801515:	ff 36                	push   (%esi)
+  801517:	e8 9b fc ff ff       	call   8011b7 <dev_lookup>
+  80151c:	83 c4 10             	add    $0x10,%esp
+  80151f:	85 c0                	test   %eax,%eax
+  801521:	78 1f                	js     801542 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801523:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801527:	74 20                	je     801549 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801529:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80152c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80152f:	85 c0                	test   %eax,%eax
+  801531:	74 61                	je     801594 <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801533:	83 ec 04             	sub    $0x4,%esp
+  801536:	ff 75 10             	push   0x10(%ebp)
+  801539:	ff 75 0c             	push   0xc(%ebp)
+  80153c:	56                   	push   %esi
+  80153d:	ff d0                	call   *%eax
+  80153f:	83 c4 10             	add    $0x10,%esp
+}
+  801542:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801545:	5b                   	pop    %ebx
+  801546:	5e                   	pop    %esi
+  801547:	5d                   	pop    %ebp
+  801548:	c3                   	ret
+  801549:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80154b:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801551:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801556:	77 18                	ja     801570 <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801558:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80155d:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80155f:	c1 e8 10             	shr    $0x10,%eax
+  801562:	74 0c                	je     801570 <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801564:	c1 e0 10             	shl    $0x10,%eax
+  801567:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80156c:	29 c2                	sub    %eax,%edx
+  80156e:	eb 06                	jmp    801576 <write+0x87>
+		return pthread_main_tls;
+  801570:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801576:	8b 02                	mov    (%edx),%eax
+  801578:	8b 40 48             	mov    0x48(%eax),%eax
+  80157b:	83 ec 04             	sub    $0x4,%esp
+  80157e:	53                   	push   %ebx
+  80157f:	50                   	push   %eax
+  801580:	68 dd 51 80 00       	push   $0x8051dd
+  801585:	e8 9c ec ff ff       	call   800226 <cprintf>
+		return -E_INVAL;
+  80158a:	83 c4 10             	add    $0x10,%esp
+  80158d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801592:	eb ae                	jmp    801542 <write+0x53>
+		return -E_NOT_SUPP;
+  801594:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801599:	eb a7                	jmp    801542 <write+0x53>
+
+0080159b <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80159b:	55                   	push   %ebp
+  80159c:	89 e5                	mov    %esp,%ebp
+  80159e:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8015a1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015a4:	50                   	push   %eax
+  8015a5:	ff 75 08             	push   0x8(%ebp)
+  8015a8:	e8 ba fb ff ff       	call   801167 <fd_lookup>
+  8015ad:	83 c4 10             	add    $0x10,%esp
+  8015b0:	85 c0                	test   %eax,%eax
+  8015b2:	78 0e                	js     8015c2 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8015b4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8015b7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015ba:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8015bd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015c2:	c9                   	leave
+  8015c3:	c3                   	ret
+
+008015c4 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8015c4:	55                   	push   %ebp
+  8015c5:	89 e5                	mov    %esp,%ebp
+  8015c7:	56                   	push   %esi
+  8015c8:	53                   	push   %ebx
+  8015c9:	83 ec 18             	sub    $0x18,%esp
+  8015cc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015cf:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015d2:	50                   	push   %eax
+  8015d3:	53                   	push   %ebx
+  8015d4:	e8 8e fb ff ff       	call   801167 <fd_lookup>
+  8015d9:	83 c4 10             	add    $0x10,%esp
+  8015dc:	85 c0                	test   %eax,%eax
+  8015de:	78 34                	js     801614 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015e0:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8015e3:	83 ec 08             	sub    $0x8,%esp
+  8015e6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015e9:	50                   	push   %eax
+  8015ea:	ff 36                	push   (%esi)
+  8015ec:	e8 c6 fb ff ff       	call   8011b7 <dev_lookup>
+  8015f1:	83 c4 10             	add    $0x10,%esp
+  8015f4:	85 c0                	test   %eax,%eax
+  8015f6:	78 1c                	js     801614 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8015f8:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8015fc:	74 1d                	je     80161b <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8015fe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801601:	8b 40 18             	mov    0x18(%eax),%eax
+  801604:	85 c0                	test   %eax,%eax
+  801606:	74 5e                	je     801666 <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801608:	83 ec 08             	sub    $0x8,%esp
+  80160b:	ff 75 0c             	push   0xc(%ebp)
+  80160e:	56                   	push   %esi
+  80160f:	ff d0                	call   *%eax
+  801611:	83 c4 10             	add    $0x10,%esp
+}
+  801614:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801617:	5b                   	pop    %ebx
+  801618:	5e                   	pop    %esi
+  801619:	5d                   	pop    %ebp
+  80161a:	c3                   	ret
+  80161b:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80161d:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801623:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801628:	77 18                	ja     801642 <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80162a:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80162f:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801631:	c1 e8 10             	shr    $0x10,%eax
+  801634:	74 0c                	je     801642 <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801636:	c1 e0 10             	shl    $0x10,%eax
+  801639:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80163e:	29 c2                	sub    %eax,%edx
+  801640:	eb 06                	jmp    801648 <ftruncate+0x84>
+		return pthread_main_tls;
+  801642:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+			thisenv->env_id, fdnum);
+  801648:	8b 02                	mov    (%edx),%eax
+  80164a:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80164d:	83 ec 04             	sub    $0x4,%esp
+  801650:	53                   	push   %ebx
+  801651:	50                   	push   %eax
+  801652:	68 a0 51 80 00       	push   $0x8051a0
+  801657:	e8 ca eb ff ff       	call   800226 <cprintf>
+		return -E_INVAL;
+  80165c:	83 c4 10             	add    $0x10,%esp
+  80165f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801664:	eb ae                	jmp    801614 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801666:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80166b:	eb a7                	jmp    801614 <ftruncate+0x50>
+
+0080166d <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80166d:	55                   	push   %ebp
+  80166e:	89 e5                	mov    %esp,%ebp
+  801670:	56                   	push   %esi
+  801671:	53                   	push   %ebx
+  801672:	83 ec 18             	sub    $0x18,%esp
+  801675:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801678:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80167b:	50                   	push   %eax
+  80167c:	ff 75 08             	push   0x8(%ebp)
+  80167f:	e8 e3 fa ff ff       	call   801167 <fd_lookup>
+  801684:	83 c4 10             	add    $0x10,%esp
+  801687:	85 c0                	test   %eax,%eax
+  801689:	78 49                	js     8016d4 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80168b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80168e:	83 ec 08             	sub    $0x8,%esp
+  801691:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801694:	50                   	push   %eax
+  801695:	ff 36                	push   (%esi)
+  801697:	e8 1b fb ff ff       	call   8011b7 <dev_lookup>
+  80169c:	83 c4 10             	add    $0x10,%esp
+  80169f:	85 c0                	test   %eax,%eax
+  8016a1:	78 31                	js     8016d4 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8016a3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016a6:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8016aa:	74 2f                	je     8016db <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8016ac:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8016af:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8016b6:	00 00 00 
+	stat->st_isdir = 0;
+  8016b9:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8016c0:	00 00 00 
+	stat->st_dev = dev;
+  8016c3:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8016c9:	83 ec 08             	sub    $0x8,%esp
+  8016cc:	53                   	push   %ebx
+  8016cd:	56                   	push   %esi
+  8016ce:	ff 50 14             	call   *0x14(%eax)
+  8016d1:	83 c4 10             	add    $0x10,%esp
+}
+  8016d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016d7:	5b                   	pop    %ebx
+  8016d8:	5e                   	pop    %esi
+  8016d9:	5d                   	pop    %ebp
+  8016da:	c3                   	ret
+		return -E_NOT_SUPP;
+  8016db:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016e0:	eb f2                	jmp    8016d4 <fstat+0x67>
+
+008016e2 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8016e2:	55                   	push   %ebp
+  8016e3:	89 e5                	mov    %esp,%ebp
+  8016e5:	56                   	push   %esi
+  8016e6:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8016e7:	83 ec 08             	sub    $0x8,%esp
+  8016ea:	6a 00                	push   $0x0
+  8016ec:	ff 75 08             	push   0x8(%ebp)
+  8016ef:	e8 4b 03 00 00       	call   801a3f <open>
+  8016f4:	89 c3                	mov    %eax,%ebx
+  8016f6:	83 c4 10             	add    $0x10,%esp
+  8016f9:	85 c0                	test   %eax,%eax
+  8016fb:	78 1b                	js     801718 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8016fd:	83 ec 08             	sub    $0x8,%esp
+  801700:	ff 75 0c             	push   0xc(%ebp)
+  801703:	50                   	push   %eax
+  801704:	e8 64 ff ff ff       	call   80166d <fstat>
+  801709:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80170b:	89 1c 24             	mov    %ebx,(%esp)
+  80170e:	e8 a8 fb ff ff       	call   8012bb <close>
+	return r;
+  801713:	83 c4 10             	add    $0x10,%esp
+  801716:	89 f3                	mov    %esi,%ebx
+}
+  801718:	89 d8                	mov    %ebx,%eax
+  80171a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80171d:	5b                   	pop    %ebx
+  80171e:	5e                   	pop    %esi
+  80171f:	5d                   	pop    %ebp
+  801720:	c3                   	ret
+
+00801721 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801721:	55                   	push   %ebp
+  801722:	89 e5                	mov    %esp,%ebp
+  801724:	56                   	push   %esi
+  801725:	53                   	push   %ebx
+  801726:	89 c6                	mov    %eax,%esi
+  801728:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  80172a:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  801731:	74 27                	je     80175a <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801733:	6a 07                	push   $0x7
+  801735:	68 00 80 80 00       	push   $0x808000
+  80173a:	56                   	push   %esi
+  80173b:	ff 35 00 70 80 00    	push   0x807000
+  801741:	e8 6b 32 00 00       	call   8049b1 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801746:	83 c4 0c             	add    $0xc,%esp
+  801749:	6a 00                	push   $0x0
+  80174b:	53                   	push   %ebx
+  80174c:	6a 00                	push   $0x0
+  80174e:	e8 68 31 00 00       	call   8048bb <ipc_recv>
+}
+  801753:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801756:	5b                   	pop    %ebx
+  801757:	5e                   	pop    %esi
+  801758:	5d                   	pop    %ebp
+  801759:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80175a:	83 ec 0c             	sub    $0xc,%esp
+  80175d:	6a 01                	push   $0x1
+  80175f:	e8 a3 32 00 00       	call   804a07 <ipc_find_env>
+  801764:	a3 00 70 80 00       	mov    %eax,0x807000
+  801769:	83 c4 10             	add    $0x10,%esp
+  80176c:	eb c5                	jmp    801733 <fsipc+0x12>
+
+0080176e <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80176e:	55                   	push   %ebp
+  80176f:	89 e5                	mov    %esp,%ebp
+  801771:	53                   	push   %ebx
+  801772:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801775:	68 04 70 80 00       	push   $0x807004
+  80177a:	e8 46 21 00 00       	call   8038c5 <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80177f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801782:	8b 40 0c             	mov    0xc(%eax),%eax
+  801785:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.set_size.req_size = newsize;
+  80178a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80178d:	a3 04 80 80 00       	mov    %eax,0x808004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  801792:	ba 00 00 00 00       	mov    $0x0,%edx
+  801797:	b8 02 00 00 00       	mov    $0x2,%eax
+  80179c:	e8 80 ff ff ff       	call   801721 <fsipc>
+  8017a1:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8017a3:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  8017aa:	e8 83 21 00 00       	call   803932 <mutex_unlock>
+	return r;
+}
+  8017af:	89 d8                	mov    %ebx,%eax
+  8017b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017b4:	c9                   	leave
+  8017b5:	c3                   	ret
+
+008017b6 <devfile_flush>:
+{
+  8017b6:	55                   	push   %ebp
+  8017b7:	89 e5                	mov    %esp,%ebp
+  8017b9:	53                   	push   %ebx
+  8017ba:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  8017bd:	68 04 70 80 00       	push   $0x807004
+  8017c2:	e8 fe 20 00 00       	call   8038c5 <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8017c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017ca:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017cd:	a3 00 80 80 00       	mov    %eax,0x808000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  8017d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017d7:	b8 06 00 00 00       	mov    $0x6,%eax
+  8017dc:	e8 40 ff ff ff       	call   801721 <fsipc>
+  8017e1:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8017e3:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  8017ea:	e8 43 21 00 00       	call   803932 <mutex_unlock>
+}
+  8017ef:	89 d8                	mov    %ebx,%eax
+  8017f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017f4:	c9                   	leave
+  8017f5:	c3                   	ret
+
+008017f6 <devfile_stat>:
+{
+  8017f6:	55                   	push   %ebp
+  8017f7:	89 e5                	mov    %esp,%ebp
+  8017f9:	56                   	push   %esi
+  8017fa:	53                   	push   %ebx
+  8017fb:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  8017fe:	83 ec 0c             	sub    $0xc,%esp
+  801801:	68 04 70 80 00       	push   $0x807004
+  801806:	e8 ba 20 00 00       	call   8038c5 <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80180b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80180e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801811:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  801816:	ba 00 00 00 00       	mov    $0x0,%edx
+  80181b:	b8 05 00 00 00       	mov    $0x5,%eax
+  801820:	e8 fc fe ff ff       	call   801721 <fsipc>
+  801825:	89 c3                	mov    %eax,%ebx
+  801827:	83 c4 10             	add    $0x10,%esp
+  80182a:	85 c0                	test   %eax,%eax
+  80182c:	79 16                	jns    801844 <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  80182e:	83 ec 0c             	sub    $0xc,%esp
+  801831:	68 04 70 80 00       	push   $0x807004
+  801836:	e8 f7 20 00 00       	call   803932 <mutex_unlock>
+}
+  80183b:	89 d8                	mov    %ebx,%eax
+  80183d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801840:	5b                   	pop    %ebx
+  801841:	5e                   	pop    %esi
+  801842:	5d                   	pop    %ebp
+  801843:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801844:	83 ec 08             	sub    $0x8,%esp
+  801847:	68 00 80 80 00       	push   $0x808000
+  80184c:	56                   	push   %esi
+  80184d:	e8 b8 ef ff ff       	call   80080a <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  801852:	a1 80 80 80 00       	mov    0x808080,%eax
+  801857:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80185d:	a1 84 80 80 00       	mov    0x808084,%eax
+  801862:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  801868:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  80186b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801870:	eb bc                	jmp    80182e <devfile_stat+0x38>
+
+00801872 <devfile_write>:
+{
+  801872:	55                   	push   %ebp
+  801873:	89 e5                	mov    %esp,%ebp
+  801875:	53                   	push   %ebx
+  801876:	83 ec 10             	sub    $0x10,%esp
+  801879:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  80187c:	68 04 70 80 00       	push   $0x807004
+  801881:	e8 3f 20 00 00       	call   8038c5 <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801886:	8b 45 08             	mov    0x8(%ebp),%eax
+  801889:	8b 40 0c             	mov    0xc(%eax),%eax
+  80188c:	a3 00 80 80 00       	mov    %eax,0x808000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801891:	83 c4 10             	add    $0x10,%esp
+  801894:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  80189a:	76 3d                	jbe    8018d9 <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  80189c:	b8 00 00 10 00       	mov    $0x100000,%eax
+  8018a1:	39 c3                	cmp    %eax,%ebx
+  8018a3:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  8018a6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8018a9:	a3 08 80 80 00       	mov    %eax,0x808008
+	fsipcbuf.write.req_n = n;
+  8018ae:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	r = fsipc(FSREQ_WRITE, NULL);
+  8018b4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018b9:	b8 04 00 00 00       	mov    $0x4,%eax
+  8018be:	e8 5e fe ff ff       	call   801721 <fsipc>
+  8018c3:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8018c5:	83 ec 0c             	sub    $0xc,%esp
+  8018c8:	68 04 70 80 00       	push   $0x807004
+  8018cd:	e8 60 20 00 00       	call   803932 <mutex_unlock>
+}
+  8018d2:	89 d8                	mov    %ebx,%eax
+  8018d4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018d7:	c9                   	leave
+  8018d8:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  8018d9:	83 ec 04             	sub    $0x4,%esp
+  8018dc:	53                   	push   %ebx
+  8018dd:	ff 75 0c             	push   0xc(%ebp)
+  8018e0:	68 0c 80 80 00       	push   $0x80800c
+  8018e5:	e8 a6 f0 ff ff       	call   800990 <memmove>
+  8018ea:	83 c4 10             	add    $0x10,%esp
+  8018ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018f2:	eb b5                	jmp    8018a9 <devfile_write+0x37>
+
+008018f4 <devfile_read>:
+{
+  8018f4:	55                   	push   %ebp
+  8018f5:	89 e5                	mov    %esp,%ebp
+  8018f7:	57                   	push   %edi
+  8018f8:	56                   	push   %esi
+  8018f9:	53                   	push   %ebx
+  8018fa:	83 ec 0c             	sub    $0xc,%esp
+  8018fd:	8b 75 08             	mov    0x8(%ebp),%esi
+  801900:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801903:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  801906:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  80190c:	0f 86 8c 00 00 00    	jbe    80199e <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  801912:	b8 00 00 10 00       	mov    $0x100000,%eax
+  801917:	39 c3                	cmp    %eax,%ebx
+  801919:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  80191c:	89 f8                	mov    %edi,%eax
+  80191e:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801921:	eb 0f                	jmp    801932 <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  801923:	0f b6 08             	movzbl (%eax),%ecx
+  801926:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  801928:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80192d:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  801932:	39 d0                	cmp    %edx,%eax
+  801934:	72 ed                	jb     801923 <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  801936:	83 ec 0c             	sub    $0xc,%esp
+  801939:	68 04 70 80 00       	push   $0x807004
+  80193e:	e8 82 1f 00 00       	call   8038c5 <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801943:	8b 46 0c             	mov    0xc(%esi),%eax
+  801946:	a3 00 80 80 00       	mov    %eax,0x808000
+		fsipcbuf.read.req_n = n;
+  80194b:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  801951:	89 3d 08 80 80 00    	mov    %edi,0x808008
+		r = fsipc(FSREQ_READ, NULL);
+  801957:	ba 00 00 00 00       	mov    $0x0,%edx
+  80195c:	b8 03 00 00 00       	mov    $0x3,%eax
+  801961:	e8 bb fd ff ff       	call   801721 <fsipc>
+  801966:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  801968:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  80196f:	e8 be 1f 00 00       	call   803932 <mutex_unlock>
+		assert(r <= (int) n);
+  801974:	83 c4 10             	add    $0x10,%esp
+  801977:	39 f3                	cmp    %esi,%ebx
+  801979:	7c 0a                	jl     801985 <devfile_read+0x91>
+}
+  80197b:	89 f0                	mov    %esi,%eax
+  80197d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801980:	5b                   	pop    %ebx
+  801981:	5e                   	pop    %esi
+  801982:	5f                   	pop    %edi
+  801983:	5d                   	pop    %ebp
+  801984:	c3                   	ret
+		assert(r <= (int) n);
+  801985:	68 10 52 80 00       	push   $0x805210
+  80198a:	68 1d 52 80 00       	push   $0x80521d
+  80198f:	68 90 00 00 00       	push   $0x90
+  801994:	68 32 52 80 00       	push   $0x805232
+  801999:	e8 ad e7 ff ff       	call   80014b <_panic>
+	mutex_lock(&fsipc_mu);
+  80199e:	83 ec 0c             	sub    $0xc,%esp
+  8019a1:	68 04 70 80 00       	push   $0x807004
+  8019a6:	e8 1a 1f 00 00       	call   8038c5 <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8019ab:	8b 46 0c             	mov    0xc(%esi),%eax
+  8019ae:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.read.req_n = n;
+  8019b3:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	fsipcbuf.read.req_va = 0;
+  8019b9:	c7 05 08 80 80 00 00 	movl   $0x0,0x808008
+  8019c0:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  8019c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019c8:	b8 03 00 00 00       	mov    $0x3,%eax
+  8019cd:	e8 4f fd ff ff       	call   801721 <fsipc>
+  8019d2:	89 c6                	mov    %eax,%esi
+  8019d4:	83 c4 10             	add    $0x10,%esp
+  8019d7:	85 c0                	test   %eax,%eax
+  8019d9:	78 1d                	js     8019f8 <devfile_read+0x104>
+		assert(r <= n);
+  8019db:	39 c3                	cmp    %eax,%ebx
+  8019dd:	72 2e                	jb     801a0d <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  8019df:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8019e4:	7f 40                	jg     801a26 <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8019e6:	83 ec 04             	sub    $0x4,%esp
+  8019e9:	50                   	push   %eax
+  8019ea:	68 00 80 80 00       	push   $0x808000
+  8019ef:	57                   	push   %edi
+  8019f0:	e8 9b ef ff ff       	call   800990 <memmove>
+  8019f5:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  8019f8:	83 ec 0c             	sub    $0xc,%esp
+  8019fb:	68 04 70 80 00       	push   $0x807004
+  801a00:	e8 2d 1f 00 00       	call   803932 <mutex_unlock>
+	return r;
+  801a05:	83 c4 10             	add    $0x10,%esp
+  801a08:	e9 6e ff ff ff       	jmp    80197b <devfile_read+0x87>
+		assert(r <= n);
+  801a0d:	68 3d 52 80 00       	push   $0x80523d
+  801a12:	68 1d 52 80 00       	push   $0x80521d
+  801a17:	68 99 00 00 00       	push   $0x99
+  801a1c:	68 32 52 80 00       	push   $0x805232
+  801a21:	e8 25 e7 ff ff       	call   80014b <_panic>
+		assert(r <= PGSIZE);
+  801a26:	68 44 52 80 00       	push   $0x805244
+  801a2b:	68 1d 52 80 00       	push   $0x80521d
+  801a30:	68 9a 00 00 00       	push   $0x9a
+  801a35:	68 32 52 80 00       	push   $0x805232
+  801a3a:	e8 0c e7 ff ff       	call   80014b <_panic>
+
+00801a3f <open>:
+{
+  801a3f:	55                   	push   %ebp
+  801a40:	89 e5                	mov    %esp,%ebp
+  801a42:	56                   	push   %esi
+  801a43:	53                   	push   %ebx
+  801a44:	83 ec 1c             	sub    $0x1c,%esp
+  801a47:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801a4a:	56                   	push   %esi
+  801a4b:	e8 7f ed ff ff       	call   8007cf <strlen>
+  801a50:	83 c4 10             	add    $0x10,%esp
+  801a53:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801a58:	0f 8f 85 00 00 00    	jg     801ae3 <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  801a5e:	83 ec 0c             	sub    $0xc,%esp
+  801a61:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a64:	50                   	push   %eax
+  801a65:	e8 a7 f6 ff ff       	call   801111 <fd_alloc>
+  801a6a:	89 c3                	mov    %eax,%ebx
+  801a6c:	83 c4 10             	add    $0x10,%esp
+  801a6f:	85 c0                	test   %eax,%eax
+  801a71:	78 55                	js     801ac8 <open+0x89>
+	mutex_lock(&fsipc_mu);
+  801a73:	83 ec 0c             	sub    $0xc,%esp
+  801a76:	68 04 70 80 00       	push   $0x807004
+  801a7b:	e8 45 1e 00 00       	call   8038c5 <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  801a80:	83 c4 08             	add    $0x8,%esp
+  801a83:	56                   	push   %esi
+  801a84:	68 00 80 80 00       	push   $0x808000
+  801a89:	e8 7c ed ff ff       	call   80080a <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801a8e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a91:	a3 00 84 80 00       	mov    %eax,0x808400
+	r = fsipc(FSREQ_OPEN, fd);
+  801a96:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801a99:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a9e:	e8 7e fc ff ff       	call   801721 <fsipc>
+  801aa3:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801aa5:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801aac:	e8 81 1e 00 00       	call   803932 <mutex_unlock>
+	if (r < 0) {
+  801ab1:	83 c4 10             	add    $0x10,%esp
+  801ab4:	85 db                	test   %ebx,%ebx
+  801ab6:	78 19                	js     801ad1 <open+0x92>
+	return fd2num(fd);
+  801ab8:	83 ec 0c             	sub    $0xc,%esp
+  801abb:	ff 75 f4             	push   -0xc(%ebp)
+  801abe:	e8 27 f6 ff ff       	call   8010ea <fd2num>
+  801ac3:	89 c3                	mov    %eax,%ebx
+  801ac5:	83 c4 10             	add    $0x10,%esp
+}
+  801ac8:	89 d8                	mov    %ebx,%eax
+  801aca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801acd:	5b                   	pop    %ebx
+  801ace:	5e                   	pop    %esi
+  801acf:	5d                   	pop    %ebp
+  801ad0:	c3                   	ret
+		fd_close(fd, 0);
+  801ad1:	83 ec 08             	sub    $0x8,%esp
+  801ad4:	6a 00                	push   $0x0
+  801ad6:	ff 75 f4             	push   -0xc(%ebp)
+  801ad9:	e8 56 f7 ff ff       	call   801234 <fd_close>
+		return r;
+  801ade:	83 c4 10             	add    $0x10,%esp
+  801ae1:	eb e5                	jmp    801ac8 <open+0x89>
+		return -E_BAD_PATH;
+  801ae3:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801ae8:	eb de                	jmp    801ac8 <open+0x89>
+
+00801aea <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  801aea:	55                   	push   %ebp
+  801aeb:	89 e5                	mov    %esp,%ebp
+  801aed:	53                   	push   %ebx
+  801aee:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801af1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801af4:	50                   	push   %eax
+  801af5:	ff 75 08             	push   0x8(%ebp)
+  801af8:	e8 6a f6 ff ff       	call   801167 <fd_lookup>
+  801afd:	89 c3                	mov    %eax,%ebx
+  801aff:	83 c4 10             	add    $0x10,%esp
+  801b02:	85 c0                	test   %eax,%eax
+  801b04:	78 5b                	js     801b61 <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801b06:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b09:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  801b0f:	39 08                	cmp    %ecx,(%eax)
+  801b11:	75 55                	jne    801b68 <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  801b13:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  801b17:	74 56                	je     801b6f <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  801b19:	83 ec 0c             	sub    $0xc,%esp
+  801b1c:	68 04 70 80 00       	push   $0x807004
+  801b21:	e8 9f 1d 00 00       	call   8038c5 <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  801b26:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b29:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b2c:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.allocate.req_offset = offset;
+  801b31:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b34:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.allocate.req_len = len;
+  801b39:	8b 45 10             	mov    0x10(%ebp),%eax
+  801b3c:	a3 08 80 80 00       	mov    %eax,0x808008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  801b41:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b46:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801b4b:	e8 d1 fb ff ff       	call   801721 <fsipc>
+  801b50:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801b52:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801b59:	e8 d4 1d 00 00       	call   803932 <mutex_unlock>
+	return r;
+  801b5e:	83 c4 10             	add    $0x10,%esp
+}
+  801b61:	89 d8                	mov    %ebx,%eax
+  801b63:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b66:	c9                   	leave
+  801b67:	c3                   	ret
+		return -E_NOT_SUPP;
+  801b68:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801b6d:	eb f2                	jmp    801b61 <fallocate+0x77>
+		return -E_INVAL;
+  801b6f:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801b74:	eb eb                	jmp    801b61 <fallocate+0x77>
+
+00801b76 <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  801b76:	55                   	push   %ebp
+  801b77:	89 e5                	mov    %esp,%ebp
+  801b79:	56                   	push   %esi
+  801b7a:	53                   	push   %ebx
+  801b7b:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801b7e:	89 f3                	mov    %esi,%ebx
+  801b80:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801b86:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801b89:	eb 06                	jmp    801b91 <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801b8b:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801b91:	39 f3                	cmp    %esi,%ebx
+  801b93:	73 14                	jae    801ba9 <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  801b95:	83 ec 08             	sub    $0x8,%esp
+  801b98:	53                   	push   %ebx
+  801b99:	6a 00                	push   $0x0
+  801b9b:	e8 41 f1 ff ff       	call   800ce1 <sys_page_unmap>
+  801ba0:	83 c4 10             	add    $0x10,%esp
+  801ba3:	85 c0                	test   %eax,%eax
+  801ba5:	79 e4                	jns    801b8b <munmap+0x15>
+  801ba7:	eb 05                	jmp    801bae <munmap+0x38>
+			return r;
+	return 0;
+  801ba9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801bae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bb1:	5b                   	pop    %ebx
+  801bb2:	5e                   	pop    %esi
+  801bb3:	5d                   	pop    %ebp
+  801bb4:	c3                   	ret
+
+00801bb5 <mmap>:
+{
+  801bb5:	55                   	push   %ebp
+  801bb6:	89 e5                	mov    %esp,%ebp
+  801bb8:	57                   	push   %edi
+  801bb9:	56                   	push   %esi
+  801bba:	53                   	push   %ebx
+  801bbb:	83 ec 24             	sub    $0x24,%esp
+  801bbe:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801bc1:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801bc4:	50                   	push   %eax
+  801bc5:	ff 75 08             	push   0x8(%ebp)
+  801bc8:	e8 9a f5 ff ff       	call   801167 <fd_lookup>
+  801bcd:	83 c4 10             	add    $0x10,%esp
+  801bd0:	85 c0                	test   %eax,%eax
+  801bd2:	0f 88 37 01 00 00    	js     801d0f <mmap+0x15a>
+		return NULL;
+  801bd8:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801bdd:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801be0:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  801be6:	39 0a                	cmp    %ecx,(%edx)
+  801be8:	0f 85 05 01 00 00    	jne    801cf3 <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  801bee:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801bf5:	0f 85 1b 01 00 00    	jne    801d16 <mmap+0x161>
+  801bfb:	89 f0                	mov    %esi,%eax
+  801bfd:	83 e8 01             	sub    $0x1,%eax
+  801c00:	0f 88 17 01 00 00    	js     801d1d <mmap+0x168>
+	if (prot & PROT_WRITE)
+  801c06:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  801c0a:	75 28                	jne    801c34 <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  801c0c:	83 ec 0c             	sub    $0xc,%esp
+  801c0f:	68 04 70 80 00       	push   $0x807004
+  801c14:	e8 ac 1c 00 00       	call   8038c5 <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801c19:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  801c1f:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  801c25:	83 c4 10             	add    $0x10,%esp
+  801c28:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  801c2d:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  801c32:	eb 2b                	jmp    801c5f <mmap+0xaa>
+		cow_enable();
+  801c34:	e8 11 28 00 00       	call   80444a <cow_enable>
+  801c39:	eb d1                	jmp    801c0c <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  801c3b:	89 c2                	mov    %eax,%edx
+  801c3d:	c1 ea 0c             	shr    $0xc,%edx
+  801c40:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  801c47:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801c4d:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  801c53:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  801c56:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  801c58:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  801c5d:	77 25                	ja     801c84 <mmap+0xcf>
+  801c5f:	89 c2                	mov    %eax,%edx
+  801c61:	29 da                	sub    %ebx,%edx
+  801c63:	39 ca                	cmp    %ecx,%edx
+  801c65:	73 3a                	jae    801ca1 <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  801c67:	89 c2                	mov    %eax,%edx
+  801c69:	c1 ea 16             	shr    $0x16,%edx
+  801c6c:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801c73:	f6 c2 01             	test   $0x1,%dl
+  801c76:	75 c3                	jne    801c3b <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  801c78:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  801c7d:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  801c82:	eb d4                	jmp    801c58 <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  801c84:	29 d8                	sub    %ebx,%eax
+  801c86:	39 c8                	cmp    %ecx,%eax
+  801c88:	73 17                	jae    801ca1 <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  801c8a:	83 ec 0c             	sub    $0xc,%esp
+  801c8d:	68 04 70 80 00       	push   $0x807004
+  801c92:	e8 9b 1c 00 00       	call   803932 <mutex_unlock>
+		return NULL;
+  801c97:	83 c4 10             	add    $0x10,%esp
+  801c9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c9f:	eb 52                	jmp    801cf3 <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801ca1:	85 db                	test   %ebx,%ebx
+  801ca3:	74 e5                	je     801c8a <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801ca5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801ca8:	8b 40 0c             	mov    0xc(%eax),%eax
+  801cab:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.map.req_offset = offset;
+  801cb0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801cb3:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.map.req_len = len;
+  801cb8:	89 35 08 80 80 00    	mov    %esi,0x808008
+	fsipcbuf.map.req_va = va;
+  801cbe:	89 1d 0c 80 80 00    	mov    %ebx,0x80800c
+	fsipcbuf.map.req_prot = prot;
+  801cc4:	8b 45 14             	mov    0x14(%ebp),%eax
+  801cc7:	a3 10 80 80 00       	mov    %eax,0x808010
+	r = fsipc(FSREQ_MAP, NULL);
+  801ccc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cd1:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801cd6:	e8 46 fa ff ff       	call   801721 <fsipc>
+  801cdb:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  801cdd:	83 ec 0c             	sub    $0xc,%esp
+  801ce0:	68 04 70 80 00       	push   $0x807004
+  801ce5:	e8 48 1c 00 00       	call   803932 <mutex_unlock>
+	if (r < 0) {
+  801cea:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  801ced:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  801cef:	85 ff                	test   %edi,%edi
+  801cf1:	78 08                	js     801cfb <mmap+0x146>
+}
+  801cf3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cf6:	5b                   	pop    %ebx
+  801cf7:	5e                   	pop    %esi
+  801cf8:	5f                   	pop    %edi
+  801cf9:	5d                   	pop    %ebp
+  801cfa:	c3                   	ret
+		munmap((void*) va, len);
+  801cfb:	83 ec 08             	sub    $0x8,%esp
+  801cfe:	56                   	push   %esi
+  801cff:	53                   	push   %ebx
+  801d00:	e8 71 fe ff ff       	call   801b76 <munmap>
+		return NULL;
+  801d05:	83 c4 10             	add    $0x10,%esp
+  801d08:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d0d:	eb e4                	jmp    801cf3 <mmap+0x13e>
+		return NULL;
+  801d0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d14:	eb dd                	jmp    801cf3 <mmap+0x13e>
+		return NULL;
+  801d16:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d1b:	eb d6                	jmp    801cf3 <mmap+0x13e>
+  801d1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d22:	eb cf                	jmp    801cf3 <mmap+0x13e>
+
+00801d24 <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  801d24:	55                   	push   %ebp
+  801d25:	89 e5                	mov    %esp,%ebp
+  801d27:	53                   	push   %ebx
+  801d28:	83 ec 10             	sub    $0x10,%esp
+  801d2b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  801d2e:	53                   	push   %ebx
+  801d2f:	e8 9b ea ff ff       	call   8007cf <strlen>
+  801d34:	83 c4 10             	add    $0x10,%esp
+  801d37:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801d3c:	7f 42                	jg     801d80 <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  801d3e:	83 ec 0c             	sub    $0xc,%esp
+  801d41:	68 04 70 80 00       	push   $0x807004
+  801d46:	e8 7a 1b 00 00       	call   8038c5 <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  801d4b:	83 c4 08             	add    $0x8,%esp
+  801d4e:	53                   	push   %ebx
+  801d4f:	68 00 80 80 00       	push   $0x808000
+  801d54:	e8 b1 ea ff ff       	call   80080a <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  801d59:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d5e:	b8 07 00 00 00       	mov    $0x7,%eax
+  801d63:	e8 b9 f9 ff ff       	call   801721 <fsipc>
+  801d68:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801d6a:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801d71:	e8 bc 1b 00 00       	call   803932 <mutex_unlock>
+	return r;
+  801d76:	83 c4 10             	add    $0x10,%esp
+}
+  801d79:	89 d8                	mov    %ebx,%eax
+  801d7b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d7e:	c9                   	leave
+  801d7f:	c3                   	ret
+		return -E_BAD_PATH;
+  801d80:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801d85:	eb f2                	jmp    801d79 <remove+0x55>
+
+00801d87 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801d87:	55                   	push   %ebp
+  801d88:	89 e5                	mov    %esp,%ebp
+  801d8a:	53                   	push   %ebx
+  801d8b:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801d8e:	68 04 70 80 00       	push   $0x807004
+  801d93:	e8 2d 1b 00 00       	call   8038c5 <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  801d98:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d9d:	b8 08 00 00 00       	mov    $0x8,%eax
+  801da2:	e8 7a f9 ff ff       	call   801721 <fsipc>
+  801da7:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801da9:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801db0:	e8 7d 1b 00 00       	call   803932 <mutex_unlock>
+	return r;
+}
+  801db5:	89 d8                	mov    %ebx,%eax
+  801db7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801dba:	c9                   	leave
+  801dbb:	c3                   	ret
+
+00801dbc <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  801dbc:	55                   	push   %ebp
+  801dbd:	89 e5                	mov    %esp,%ebp
+  801dbf:	56                   	push   %esi
+  801dc0:	53                   	push   %ebx
+  801dc1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801dc4:	83 ec 0c             	sub    $0xc,%esp
+  801dc7:	68 04 70 80 00       	push   $0x807004
+  801dcc:	e8 f4 1a 00 00       	call   8038c5 <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  801dd1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dd4:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  801dd9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dde:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801de3:	e8 39 f9 ff ff       	call   801721 <fsipc>
+  801de8:	89 c6                	mov    %eax,%esi
+  801dea:	83 c4 10             	add    $0x10,%esp
+  801ded:	85 db                	test   %ebx,%ebx
+  801def:	74 7b                	je     801e6c <fs_bcstat+0xb0>
+  801df1:	85 c0                	test   %eax,%eax
+  801df3:	78 77                	js     801e6c <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  801df5:	a1 00 80 80 00       	mov    0x808000,%eax
+  801dfa:	89 03                	mov    %eax,(%ebx)
+  801dfc:	a1 04 80 80 00       	mov    0x808004,%eax
+  801e01:	89 43 04             	mov    %eax,0x4(%ebx)
+  801e04:	a1 08 80 80 00       	mov    0x808008,%eax
+  801e09:	89 43 08             	mov    %eax,0x8(%ebx)
+  801e0c:	a1 0c 80 80 00       	mov    0x80800c,%eax
+  801e11:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801e14:	a1 10 80 80 00       	mov    0x808010,%eax
+  801e19:	89 43 10             	mov    %eax,0x10(%ebx)
+  801e1c:	a1 14 80 80 00       	mov    0x808014,%eax
+  801e21:	89 43 14             	mov    %eax,0x14(%ebx)
+  801e24:	a1 18 80 80 00       	mov    0x808018,%eax
+  801e29:	89 43 18             	mov    %eax,0x18(%ebx)
+  801e2c:	a1 1c 80 80 00       	mov    0x80801c,%eax
+  801e31:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  801e34:	a1 20 80 80 00       	mov    0x808020,%eax
+  801e39:	89 43 20             	mov    %eax,0x20(%ebx)
+  801e3c:	a1 24 80 80 00       	mov    0x808024,%eax
+  801e41:	89 43 24             	mov    %eax,0x24(%ebx)
+  801e44:	a1 28 80 80 00       	mov    0x808028,%eax
+  801e49:	89 43 28             	mov    %eax,0x28(%ebx)
+  801e4c:	a1 2c 80 80 00       	mov    0x80802c,%eax
+  801e51:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  801e54:	a1 30 80 80 00       	mov    0x808030,%eax
+  801e59:	89 43 30             	mov    %eax,0x30(%ebx)
+  801e5c:	a1 34 80 80 00       	mov    0x808034,%eax
+  801e61:	89 43 34             	mov    %eax,0x34(%ebx)
+  801e64:	a1 38 80 80 00       	mov    0x808038,%eax
+  801e69:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  801e6c:	83 ec 0c             	sub    $0xc,%esp
+  801e6f:	68 04 70 80 00       	push   $0x807004
+  801e74:	e8 b9 1a 00 00       	call   803932 <mutex_unlock>
+	return r;
+}
+  801e79:	89 f0                	mov    %esi,%eax
+  801e7b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e7e:	5b                   	pop    %ebx
+  801e7f:	5e                   	pop    %esi
+  801e80:	5d                   	pop    %ebp
+  801e81:	c3                   	ret
+
+00801e82 <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  801e82:	55                   	push   %ebp
+  801e83:	89 e5                	mov    %esp,%ebp
+  801e85:	56                   	push   %esi
+  801e86:	53                   	push   %ebx
+  801e87:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  801e89:	0f b6 10             	movzbl (%eax),%edx
+  801e8c:	80 fa 72             	cmp    $0x72,%dl
+  801e8f:	74 44                	je     801ed5 <parse_mode+0x53>
+  801e91:	80 fa 77             	cmp    $0x77,%dl
+  801e94:	74 4b                	je     801ee1 <parse_mode+0x5f>
+  801e96:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801e9b:	80 fa 61             	cmp    $0x61,%dl
+  801e9e:	74 09                	je     801ea9 <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  801ea0:	89 d8                	mov    %ebx,%eax
+  801ea2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ea5:	5b                   	pop    %ebx
+  801ea6:	5e                   	pop    %esi
+  801ea7:	5d                   	pop    %ebp
+  801ea8:	c3                   	ret
+	switch (mode[0]) {
+  801ea9:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  801eae:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  801eb3:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  801eb5:	83 ec 08             	sub    $0x8,%esp
+  801eb8:	6a 2b                	push   $0x2b
+  801eba:	50                   	push   %eax
+  801ebb:	e8 5c ea ff ff       	call   80091c <strchr>
+  801ec0:	83 c4 10             	add    $0x10,%esp
+  801ec3:	85 c0                	test   %eax,%eax
+  801ec5:	74 d9                	je     801ea0 <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  801ec7:	83 e3 fc             	and    $0xfffffffc,%ebx
+  801eca:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  801ecd:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  801ed3:	eb cb                	jmp    801ea0 <parse_mode+0x1e>
+	switch (mode[0]) {
+  801ed5:	ba 01 00 00 00       	mov    $0x1,%edx
+  801eda:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801edf:	eb d2                	jmp    801eb3 <parse_mode+0x31>
+  801ee1:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  801ee6:	bb 01 03 00 00       	mov    $0x301,%ebx
+  801eeb:	eb c6                	jmp    801eb3 <parse_mode+0x31>
+
+00801eed <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  801eed:	55                   	push   %ebp
+  801eee:	89 e5                	mov    %esp,%ebp
+  801ef0:	57                   	push   %edi
+  801ef1:	56                   	push   %esi
+  801ef2:	53                   	push   %ebx
+  801ef3:	83 ec 1c             	sub    $0x1c,%esp
+  801ef6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801ef9:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  801efc:	b8 24 60 80 00       	mov    $0x806024,%eax
+  801f01:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  801f06:	83 c0 24             	add    $0x24,%eax
+  801f09:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  801f0d:	74 17                	je     801f26 <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  801f0f:	83 c3 01             	add    $0x1,%ebx
+  801f12:	83 fb 10             	cmp    $0x10,%ebx
+  801f15:	75 ef                	jne    801f06 <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  801f17:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  801f1c:	89 f0                	mov    %esi,%eax
+  801f1e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f21:	5b                   	pop    %ebx
+  801f22:	5e                   	pop    %esi
+  801f23:	5f                   	pop    %edi
+  801f24:	5d                   	pop    %ebp
+  801f25:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  801f26:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  801f2d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801f30:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  801f33:	c1 e7 02             	shl    $0x2,%edi
+  801f36:	8d b7 20 60 80 00    	lea    0x806020(%edi),%esi
+  801f3c:	83 ec 04             	sub    $0x4,%esp
+  801f3f:	6a 24                	push   $0x24
+  801f41:	6a 00                	push   $0x0
+  801f43:	56                   	push   %esi
+  801f44:	e8 12 ea ff ff       	call   80095b <memset>
+			streams[i].f_fd = fd;
+  801f49:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801f4c:	89 8f 20 60 80 00    	mov    %ecx,0x806020(%edi)
+			streams[i].f_flags = flags;
+  801f52:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  801f55:	01 d8                	add    %ebx,%eax
+  801f57:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801f5a:	89 0c 85 24 60 80 00 	mov    %ecx,0x806024(,%eax,4)
+			return &streams[i];
+  801f61:	83 c4 10             	add    $0x10,%esp
+  801f64:	eb b6                	jmp    801f1c <stream_alloc+0x2f>
+
+00801f66 <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  801f66:	55                   	push   %ebp
+  801f67:	89 e5                	mov    %esp,%ebp
+  801f69:	53                   	push   %ebx
+  801f6a:	83 ec 14             	sub    $0x14,%esp
+  801f6d:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  801f6f:	8b 40 18             	mov    0x18(%eax),%eax
+  801f72:	39 43 14             	cmp    %eax,0x14(%ebx)
+  801f75:	74 4a                	je     801fc1 <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801f77:	83 ec 08             	sub    $0x8,%esp
+  801f7a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f7d:	50                   	push   %eax
+  801f7e:	ff 33                	push   (%ebx)
+  801f80:	e8 e2 f1 ff ff       	call   801167 <fd_lookup>
+  801f85:	89 c2                	mov    %eax,%edx
+  801f87:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801f8a:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801f8f:	85 d2                	test   %edx,%edx
+  801f91:	78 41                	js     801fd4 <stream_unread+0x6e>
+  801f93:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801f96:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  801f9c:	39 0a                	cmp    %ecx,(%edx)
+  801f9e:	75 34                	jne    801fd4 <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  801fa0:	8b 43 14             	mov    0x14(%ebx),%eax
+  801fa3:	03 42 04             	add    0x4(%edx),%eax
+  801fa6:	2b 43 18             	sub    0x18(%ebx),%eax
+  801fa9:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  801fac:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  801fb3:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  801fba:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fbf:	eb 13                	jmp    801fd4 <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  801fc1:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  801fc8:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  801fcf:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801fd4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fd7:	c9                   	leave
+  801fd8:	c3                   	ret
+
+00801fd9 <stream_drain>:
+{
+  801fd9:	55                   	push   %ebp
+  801fda:	89 e5                	mov    %esp,%ebp
+  801fdc:	56                   	push   %esi
+  801fdd:	53                   	push   %ebx
+  801fde:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  801fe0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801fe5:	eb 02                	jmp    801fe9 <stream_drain+0x10>
+  801fe7:	01 c3                	add    %eax,%ebx
+  801fe9:	8b 46 1c             	mov    0x1c(%esi),%eax
+  801fec:	39 c3                	cmp    %eax,%ebx
+  801fee:	73 43                	jae    802033 <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  801ff0:	83 ec 04             	sub    $0x4,%esp
+  801ff3:	29 d8                	sub    %ebx,%eax
+  801ff5:	50                   	push   %eax
+  801ff6:	89 d8                	mov    %ebx,%eax
+  801ff8:	03 46 0c             	add    0xc(%esi),%eax
+  801ffb:	50                   	push   %eax
+  801ffc:	ff 36                	push   (%esi)
+  801ffe:	e8 ec f4 ff ff       	call   8014ef <write>
+  802003:	83 c4 10             	add    $0x10,%esp
+  802006:	85 c0                	test   %eax,%eax
+  802008:	7f dd                	jg     801fe7 <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  80200a:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  80200e:	8b 56 0c             	mov    0xc(%esi),%edx
+  802011:	83 ec 04             	sub    $0x4,%esp
+  802014:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802017:	29 d8                	sub    %ebx,%eax
+  802019:	50                   	push   %eax
+  80201a:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  80201d:	50                   	push   %eax
+  80201e:	52                   	push   %edx
+  80201f:	e8 6c e9 ff ff       	call   800990 <memmove>
+			f->f_wend -= done;
+  802024:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802027:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  802029:	83 c4 10             	add    $0x10,%esp
+  80202c:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  802031:	eb 0a                	jmp    80203d <stream_drain+0x64>
+  802033:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  802038:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  80203d:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  802040:	89 d0                	mov    %edx,%eax
+  802042:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802045:	5b                   	pop    %ebx
+  802046:	5e                   	pop    %esi
+  802047:	5d                   	pop    %ebp
+  802048:	c3                   	ret
+
+00802049 <stream_setup>:
+	if (f->f_buf)
+  802049:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  80204d:	74 01                	je     802050 <stream_setup+0x7>
+  80204f:	c3                   	ret
+{
+  802050:	55                   	push   %ebp
+  802051:	89 e5                	mov    %esp,%ebp
+  802053:	53                   	push   %ebx
+  802054:	83 ec 04             	sub    $0x4,%esp
+  802057:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  802059:	8b 40 08             	mov    0x8(%eax),%eax
+  80205c:	85 c0                	test   %eax,%eax
+  80205e:	74 17                	je     802077 <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  802060:	83 f8 03             	cmp    $0x3,%eax
+  802063:	75 2d                	jne    802092 <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  802065:	8d 43 20             	lea    0x20(%ebx),%eax
+  802068:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  80206b:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  802072:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802075:	c9                   	leave
+  802076:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  802077:	83 ec 0c             	sub    $0xc,%esp
+  80207a:	ff 33                	push   (%ebx)
+  80207c:	e8 46 21 00 00       	call   8041c7 <iscons>
+  802081:	83 c4 10             	add    $0x10,%esp
+  802084:	85 c0                	test   %eax,%eax
+  802086:	0f 9f c0             	setg   %al
+  802089:	0f b6 c0             	movzbl %al,%eax
+  80208c:	83 c0 01             	add    $0x1,%eax
+  80208f:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  802092:	83 ec 0c             	sub    $0xc,%esp
+  802095:	68 00 10 00 00       	push   $0x1000
+  80209a:	e8 8b 11 00 00       	call   80322a <malloc>
+  80209f:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8020a2:	83 c4 10             	add    $0x10,%esp
+  8020a5:	85 c0                	test   %eax,%eax
+  8020a7:	74 bc                	je     802065 <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  8020a9:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  8020b0:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  8020b4:	eb bc                	jmp    802072 <stream_setup+0x29>
+
+008020b6 <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  8020b6:	55                   	push   %ebp
+  8020b7:	89 e5                	mov    %esp,%ebp
+  8020b9:	53                   	push   %ebx
+  8020ba:	83 ec 04             	sub    $0x4,%esp
+  8020bd:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  8020bf:	e8 85 ff ff ff       	call   802049 <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  8020c4:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  8020c9:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  8020cd:	74 3d                	je     80210c <stream_fill+0x56>
+  8020cf:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  8020d3:	74 10                	je     8020e5 <stream_fill+0x2f>
+  8020d5:	89 d8                	mov    %ebx,%eax
+  8020d7:	e8 fd fe ff ff       	call   801fd9 <stream_drain>
+		return 0;
+  8020dc:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  8020e1:	85 c0                	test   %eax,%eax
+  8020e3:	78 27                	js     80210c <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  8020e5:	83 ec 04             	sub    $0x4,%esp
+  8020e8:	ff 73 10             	push   0x10(%ebx)
+  8020eb:	ff 73 0c             	push   0xc(%ebx)
+  8020ee:	ff 33                	push   (%ebx)
+  8020f0:	e8 02 f3 ff ff       	call   8013f7 <read>
+  8020f5:	83 c4 10             	add    $0x10,%esp
+  8020f8:	85 c0                	test   %eax,%eax
+  8020fa:	7e 17                	jle    802113 <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  8020fc:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  802100:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  802107:	89 c2                	mov    %eax,%edx
+  802109:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  80210c:	89 d0                	mov    %edx,%eax
+  80210e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802111:	c9                   	leave
+  802112:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802113:	c1 f8 1f             	sar    $0x1f,%eax
+  802116:	83 e0 04             	and    $0x4,%eax
+  802119:	83 c0 04             	add    $0x4,%eax
+  80211c:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  80211f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802124:	eb e6                	jmp    80210c <stream_fill+0x56>
+
+00802126 <fopen>:
+{
+  802126:	55                   	push   %ebp
+  802127:	89 e5                	mov    %esp,%ebp
+  802129:	57                   	push   %edi
+  80212a:	56                   	push   %esi
+  80212b:	53                   	push   %ebx
+  80212c:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  802132:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  802135:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  80213b:	89 f0                	mov    %esi,%eax
+  80213d:	e8 40 fd ff ff       	call   801e82 <parse_mode>
+		return 0;
+  802142:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  802147:	85 c0                	test   %eax,%eax
+  802149:	78 2d                	js     802178 <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  80214b:	83 ec 08             	sub    $0x8,%esp
+  80214e:	50                   	push   %eax
+  80214f:	ff 75 08             	push   0x8(%ebp)
+  802152:	e8 e8 f8 ff ff       	call   801a3f <open>
+  802157:	89 c7                	mov    %eax,%edi
+  802159:	83 c4 10             	add    $0x10,%esp
+  80215c:	85 c0                	test   %eax,%eax
+  80215e:	78 58                	js     8021b8 <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  802160:	80 3e 61             	cmpb   $0x61,(%esi)
+  802163:	74 1d                	je     802182 <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  802165:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  80216b:	89 f8                	mov    %edi,%eax
+  80216d:	e8 7b fd ff ff       	call   801eed <stream_alloc>
+  802172:	89 c3                	mov    %eax,%ebx
+  802174:	85 c0                	test   %eax,%eax
+  802176:	74 32                	je     8021aa <fopen+0x84>
+}
+  802178:	89 d8                	mov    %ebx,%eax
+  80217a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80217d:	5b                   	pop    %ebx
+  80217e:	5e                   	pop    %esi
+  80217f:	5f                   	pop    %edi
+  802180:	5d                   	pop    %ebp
+  802181:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  802182:	83 ec 08             	sub    $0x8,%esp
+  802185:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  80218b:	50                   	push   %eax
+  80218c:	57                   	push   %edi
+  80218d:	e8 db f4 ff ff       	call   80166d <fstat>
+  802192:	83 c4 10             	add    $0x10,%esp
+  802195:	85 c0                	test   %eax,%eax
+  802197:	78 cc                	js     802165 <fopen+0x3f>
+		seek(fd, st.st_size);
+  802199:	83 ec 08             	sub    $0x8,%esp
+  80219c:	ff 75 dc             	push   -0x24(%ebp)
+  80219f:	57                   	push   %edi
+  8021a0:	e8 f6 f3 ff ff       	call   80159b <seek>
+  8021a5:	83 c4 10             	add    $0x10,%esp
+  8021a8:	eb bb                	jmp    802165 <fopen+0x3f>
+		close(fd);
+  8021aa:	83 ec 0c             	sub    $0xc,%esp
+  8021ad:	57                   	push   %edi
+  8021ae:	e8 08 f1 ff ff       	call   8012bb <close>
+  8021b3:	83 c4 10             	add    $0x10,%esp
+  8021b6:	eb c0                	jmp    802178 <fopen+0x52>
+		return 0;
+  8021b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8021bd:	eb b9                	jmp    802178 <fopen+0x52>
+
+008021bf <fdopen>:
+{
+  8021bf:	55                   	push   %ebp
+  8021c0:	89 e5                	mov    %esp,%ebp
+  8021c2:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  8021c5:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8021c8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021cb:	e8 b2 fc ff ff       	call   801e82 <parse_mode>
+  8021d0:	89 c2                	mov    %eax,%edx
+		return 0;
+  8021d2:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  8021d7:	85 d2                	test   %edx,%edx
+  8021d9:	78 0b                	js     8021e6 <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  8021db:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8021de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021e1:	e8 07 fd ff ff       	call   801eed <stream_alloc>
+}
+  8021e6:	c9                   	leave
+  8021e7:	c3                   	ret
+
+008021e8 <setvbuf>:
+{
+  8021e8:	55                   	push   %ebp
+  8021e9:	89 e5                	mov    %esp,%ebp
+  8021eb:	57                   	push   %edi
+  8021ec:	56                   	push   %esi
+  8021ed:	53                   	push   %ebx
+  8021ee:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021f1:	8b 55 10             	mov    0x10(%ebp),%edx
+  8021f4:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  8021f7:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8021fb:	75 3a                	jne    802237 <setvbuf+0x4f>
+  8021fd:	8d 72 ff             	lea    -0x1(%edx),%esi
+  802200:	83 fe 02             	cmp    $0x2,%esi
+  802203:	77 39                	ja     80223e <setvbuf+0x56>
+	f->f_bufmode = mode;
+  802205:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  802208:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80220c:	0f 95 c3             	setne  %bl
+  80220f:	85 ff                	test   %edi,%edi
+  802211:	0f 95 c1             	setne  %cl
+  802214:	84 cb                	test   %cl,%bl
+  802216:	74 05                	je     80221d <setvbuf+0x35>
+  802218:	83 fa 03             	cmp    $0x3,%edx
+  80221b:	75 0a                	jne    802227 <setvbuf+0x3f>
+	return 0;
+  80221d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802222:	5b                   	pop    %ebx
+  802223:	5e                   	pop    %esi
+  802224:	5f                   	pop    %edi
+  802225:	5d                   	pop    %ebp
+  802226:	c3                   	ret
+		f->f_buf = buf;
+  802227:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80222a:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  80222d:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  802230:	b8 00 00 00 00       	mov    $0x0,%eax
+  802235:	eb eb                	jmp    802222 <setvbuf+0x3a>
+		return EOF;
+  802237:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80223c:	eb e4                	jmp    802222 <setvbuf+0x3a>
+  80223e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802243:	eb dd                	jmp    802222 <setvbuf+0x3a>
+
+00802245 <fflush>:
+{
+  802245:	55                   	push   %ebp
+  802246:	89 e5                	mov    %esp,%ebp
+  802248:	57                   	push   %edi
+  802249:	56                   	push   %esi
+  80224a:	53                   	push   %ebx
+  80224b:	83 ec 0c             	sub    $0xc,%esp
+  80224e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  802251:	85 db                	test   %ebx,%ebx
+  802253:	74 1a                	je     80226f <fflush+0x2a>
+	stream_unread(f);
+  802255:	89 d8                	mov    %ebx,%eax
+  802257:	e8 0a fd ff ff       	call   801f66 <stream_unread>
+	return stream_drain(f);
+  80225c:	89 d8                	mov    %ebx,%eax
+  80225e:	e8 76 fd ff ff       	call   801fd9 <stream_drain>
+  802263:	89 c7                	mov    %eax,%edi
+}
+  802265:	89 f8                	mov    %edi,%eax
+  802267:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80226a:	5b                   	pop    %ebx
+  80226b:	5e                   	pop    %esi
+  80226c:	5f                   	pop    %edi
+  80226d:	5d                   	pop    %ebp
+  80226e:	c3                   	ret
+  80226f:	bb 20 60 80 00       	mov    $0x806020,%ebx
+  802274:	be 60 62 80 00       	mov    $0x806260,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  802279:	bf 00 00 00 00       	mov    $0x0,%edi
+  80227e:	eb 03                	jmp    802283 <fflush+0x3e>
+  802280:	83 c3 24             	add    $0x24,%ebx
+  802283:	39 f3                	cmp    %esi,%ebx
+  802285:	74 de                	je     802265 <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  802287:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  80228b:	74 f3                	je     802280 <fflush+0x3b>
+  80228d:	83 ec 0c             	sub    $0xc,%esp
+  802290:	53                   	push   %ebx
+  802291:	e8 af ff ff ff       	call   802245 <fflush>
+  802296:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  802299:	85 c0                	test   %eax,%eax
+  80229b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8022a0:	0f 48 f8             	cmovs  %eax,%edi
+  8022a3:	eb db                	jmp    802280 <fflush+0x3b>
+
+008022a5 <fclose>:
+{
+  8022a5:	55                   	push   %ebp
+  8022a6:	89 e5                	mov    %esp,%ebp
+  8022a8:	56                   	push   %esi
+  8022a9:	53                   	push   %ebx
+  8022aa:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  8022ad:	83 ec 0c             	sub    $0xc,%esp
+  8022b0:	56                   	push   %esi
+  8022b1:	e8 8f ff ff ff       	call   802245 <fflush>
+  8022b6:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  8022b8:	83 c4 04             	add    $0x4,%esp
+  8022bb:	ff 36                	push   (%esi)
+  8022bd:	e8 f9 ef ff ff       	call   8012bb <close>
+  8022c2:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  8022c5:	85 c0                	test   %eax,%eax
+  8022c7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8022cc:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  8022cf:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  8022d3:	75 10                	jne    8022e5 <fclose+0x40>
+	f->f_flags = 0;
+  8022d5:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  8022dc:	89 d8                	mov    %ebx,%eax
+  8022de:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022e1:	5b                   	pop    %ebx
+  8022e2:	5e                   	pop    %esi
+  8022e3:	5d                   	pop    %ebp
+  8022e4:	c3                   	ret
+		free(f->f_buf);
+  8022e5:	83 ec 0c             	sub    $0xc,%esp
+  8022e8:	ff 76 0c             	push   0xc(%esi)
+  8022eb:	e8 71 0e 00 00       	call   803161 <free>
+  8022f0:	83 c4 10             	add    $0x10,%esp
+  8022f3:	eb e0                	jmp    8022d5 <fclose+0x30>
+
+008022f5 <fileno>:
+{
+  8022f5:	55                   	push   %ebp
+  8022f6:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  8022f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022fb:	8b 00                	mov    (%eax),%eax
+}
+  8022fd:	5d                   	pop    %ebp
+  8022fe:	c3                   	ret
+
+008022ff <feof>:
+{
+  8022ff:	55                   	push   %ebp
+  802300:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  802302:	8b 45 08             	mov    0x8(%ebp),%eax
+  802305:	8b 40 04             	mov    0x4(%eax),%eax
+  802308:	c1 e8 02             	shr    $0x2,%eax
+  80230b:	83 e0 01             	and    $0x1,%eax
+}
+  80230e:	5d                   	pop    %ebp
+  80230f:	c3                   	ret
+
+00802310 <ferror>:
+{
+  802310:	55                   	push   %ebp
+  802311:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  802313:	8b 45 08             	mov    0x8(%ebp),%eax
+  802316:	8b 40 04             	mov    0x4(%eax),%eax
+  802319:	c1 e8 03             	shr    $0x3,%eax
+  80231c:	83 e0 01             	and    $0x1,%eax
+}
+  80231f:	5d                   	pop    %ebp
+  802320:	c3                   	ret
+
+00802321 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  802321:	55                   	push   %ebp
+  802322:	89 e5                	mov    %esp,%ebp
+  802324:	53                   	push   %ebx
+  802325:	83 ec 04             	sub    $0x4,%esp
+  802328:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  80232b:	8b 43 18             	mov    0x18(%ebx),%eax
+  80232e:	39 43 14             	cmp    %eax,0x14(%ebx)
+  802331:	74 15                	je     802348 <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  802333:	8b 53 0c             	mov    0xc(%ebx),%edx
+  802336:	8b 43 14             	mov    0x14(%ebx),%eax
+  802339:	8d 48 01             	lea    0x1(%eax),%ecx
+  80233c:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  80233f:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  802343:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802346:	c9                   	leave
+  802347:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802348:	89 d8                	mov    %ebx,%eax
+  80234a:	e8 67 fd ff ff       	call   8020b6 <stream_fill>
+  80234f:	85 c0                	test   %eax,%eax
+  802351:	75 e0                	jne    802333 <fgetc+0x12>
+		return EOF;
+  802353:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802358:	eb e9                	jmp    802343 <fgetc+0x22>
+
+0080235a <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  80235a:	55                   	push   %ebp
+  80235b:	89 e5                	mov    %esp,%ebp
+  80235d:	57                   	push   %edi
+  80235e:	56                   	push   %esi
+  80235f:	53                   	push   %ebx
+  802360:	83 ec 1c             	sub    $0x1c,%esp
+  802363:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  802366:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  80236b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80236e:	83 e8 01             	sub    $0x1,%eax
+  802371:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  802374:	eb 66                	jmp    8023dc <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802376:	8b 46 14             	mov    0x14(%esi),%eax
+  802379:	8b 5e 18             	mov    0x18(%esi),%ebx
+  80237c:	29 c3                	sub    %eax,%ebx
+  80237e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802381:	29 fa                	sub    %edi,%edx
+  802383:	39 d3                	cmp    %edx,%ebx
+  802385:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802388:	83 ec 04             	sub    $0x4,%esp
+  80238b:	53                   	push   %ebx
+  80238c:	6a 0a                	push   $0xa
+  80238e:	03 46 0c             	add    0xc(%esi),%eax
+  802391:	50                   	push   %eax
+  802392:	e8 aa e6 ff ff       	call   800a41 <memfind>
+  802397:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  80239a:	8b 46 0c             	mov    0xc(%esi),%eax
+  80239d:	8b 4e 14             	mov    0x14(%esi),%ecx
+  8023a0:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  8023a3:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  8023a5:	83 c4 10             	add    $0x10,%esp
+  8023a8:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  8023ab:	74 0b                	je     8023b8 <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  8023ad:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8023b0:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8023b3:	29 d3                	sub    %edx,%ebx
+  8023b5:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  8023b8:	83 ec 04             	sub    $0x4,%esp
+  8023bb:	53                   	push   %ebx
+  8023bc:	01 c8                	add    %ecx,%eax
+  8023be:	50                   	push   %eax
+  8023bf:	89 f8                	mov    %edi,%eax
+  8023c1:	03 45 08             	add    0x8(%ebp),%eax
+  8023c4:	50                   	push   %eax
+  8023c5:	e8 c6 e5 ff ff       	call   800990 <memmove>
+		f->f_rpos += m;
+  8023ca:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  8023cd:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  8023cf:	83 c4 10             	add    $0x10,%esp
+  8023d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023d5:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  8023da:	74 1f                	je     8023fb <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  8023dc:	8d 47 01             	lea    0x1(%edi),%eax
+  8023df:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  8023e2:	73 17                	jae    8023fb <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8023e4:	8b 46 18             	mov    0x18(%esi),%eax
+  8023e7:	39 46 14             	cmp    %eax,0x14(%esi)
+  8023ea:	75 8a                	jne    802376 <fgets+0x1c>
+  8023ec:	89 f0                	mov    %esi,%eax
+  8023ee:	e8 c3 fc ff ff       	call   8020b6 <stream_fill>
+  8023f3:	85 c0                	test   %eax,%eax
+  8023f5:	0f 85 7b ff ff ff    	jne    802376 <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  8023fb:	85 ff                	test   %edi,%edi
+  8023fd:	74 0f                	je     80240e <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  8023ff:	8b 45 08             	mov    0x8(%ebp),%eax
+  802402:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  802406:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802409:	5b                   	pop    %ebx
+  80240a:	5e                   	pop    %esi
+  80240b:	5f                   	pop    %edi
+  80240c:	5d                   	pop    %ebp
+  80240d:	c3                   	ret
+		return 0;
+  80240e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802413:	eb f1                	jmp    802406 <fgets+0xac>
+
+00802415 <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  802415:	55                   	push   %ebp
+  802416:	89 e5                	mov    %esp,%ebp
+  802418:	57                   	push   %edi
+  802419:	56                   	push   %esi
+  80241a:	53                   	push   %ebx
+  80241b:	83 ec 1c             	sub    $0x1c,%esp
+  80241e:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  802421:	89 f0                	mov    %esi,%eax
+  802423:	e8 21 fc ff ff       	call   802049 <stream_setup>
+	want = size * n;
+  802428:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80242b:	0f af 45 10          	imul   0x10(%ebp),%eax
+  80242f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  802432:	bf 00 00 00 00       	mov    $0x0,%edi
+  802437:	eb 43                	jmp    80247c <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  802439:	29 d3                	sub    %edx,%ebx
+  80243b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80243e:	29 f8                	sub    %edi,%eax
+  802440:	39 c3                	cmp    %eax,%ebx
+  802442:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  802445:	83 ec 04             	sub    $0x4,%esp
+  802448:	53                   	push   %ebx
+  802449:	03 56 0c             	add    0xc(%esi),%edx
+  80244c:	52                   	push   %edx
+  80244d:	89 f8                	mov    %edi,%eax
+  80244f:	03 45 08             	add    0x8(%ebp),%eax
+  802452:	50                   	push   %eax
+  802453:	e8 38 e5 ff ff       	call   800990 <memmove>
+			f->f_rpos += m;
+  802458:	01 5e 14             	add    %ebx,0x14(%esi)
+  80245b:	83 c4 10             	add    $0x10,%esp
+  80245e:	eb 1a                	jmp    80247a <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  802460:	83 ec 04             	sub    $0x4,%esp
+  802463:	53                   	push   %ebx
+  802464:	89 f8                	mov    %edi,%eax
+  802466:	03 45 08             	add    0x8(%ebp),%eax
+  802469:	50                   	push   %eax
+  80246a:	ff 36                	push   (%esi)
+  80246c:	e8 86 ef ff ff       	call   8013f7 <read>
+  802471:	89 c3                	mov    %eax,%ebx
+  802473:	83 c4 10             	add    $0x10,%esp
+  802476:	85 c0                	test   %eax,%eax
+  802478:	7e 36                	jle    8024b0 <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  80247a:	01 df                	add    %ebx,%edi
+  80247c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80247f:	39 c7                	cmp    %eax,%edi
+  802481:	73 39                	jae    8024bc <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  802483:	8b 56 14             	mov    0x14(%esi),%edx
+  802486:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802489:	39 da                	cmp    %ebx,%edx
+  80248b:	72 ac                	jb     802439 <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  80248d:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802490:	29 fb                	sub    %edi,%ebx
+  802492:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  802495:	72 3e                	jb     8024d5 <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  802497:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  80249b:	74 1f                	je     8024bc <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  80249d:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  8024a1:	74 bd                	je     802460 <fread+0x4b>
+  8024a3:	89 f0                	mov    %esi,%eax
+  8024a5:	e8 2f fb ff ff       	call   801fd9 <stream_drain>
+  8024aa:	85 c0                	test   %eax,%eax
+  8024ac:	79 b2                	jns    802460 <fread+0x4b>
+  8024ae:	eb 0c                	jmp    8024bc <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  8024b0:	c1 fb 1f             	sar    $0x1f,%ebx
+  8024b3:	83 e3 04             	and    $0x4,%ebx
+  8024b6:	83 c3 04             	add    $0x4,%ebx
+  8024b9:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  8024bc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024bf:	85 c0                	test   %eax,%eax
+  8024c1:	74 0a                	je     8024cd <fread+0xb8>
+  8024c3:	89 f8                	mov    %edi,%eax
+  8024c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024ca:	f7 75 0c             	divl   0xc(%ebp)
+}
+  8024cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024d0:	5b                   	pop    %ebx
+  8024d1:	5e                   	pop    %esi
+  8024d2:	5f                   	pop    %edi
+  8024d3:	5d                   	pop    %ebp
+  8024d4:	c3                   	ret
+		} else if (!stream_fill(f))
+  8024d5:	89 f0                	mov    %esi,%eax
+  8024d7:	e8 da fb ff ff       	call   8020b6 <stream_fill>
+  8024dc:	85 c0                	test   %eax,%eax
+  8024de:	74 dc                	je     8024bc <fread+0xa7>
+			m = 0;
+  8024e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024e5:	eb 93                	jmp    80247a <fread+0x65>
+
+008024e7 <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  8024e7:	55                   	push   %ebp
+  8024e8:	89 e5                	mov    %esp,%ebp
+  8024ea:	57                   	push   %edi
+  8024eb:	56                   	push   %esi
+  8024ec:	53                   	push   %ebx
+  8024ed:	83 ec 1c             	sub    $0x1c,%esp
+  8024f0:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  8024f3:	8b 43 04             	mov    0x4(%ebx),%eax
+  8024f6:	a8 02                	test   $0x2,%al
+  8024f8:	75 13                	jne    80250d <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  8024fa:	83 c8 08             	or     $0x8,%eax
+  8024fd:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  802500:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  802505:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802508:	5b                   	pop    %ebx
+  802509:	5e                   	pop    %esi
+  80250a:	5f                   	pop    %edi
+  80250b:	5d                   	pop    %ebp
+  80250c:	c3                   	ret
+	stream_setup(f);
+  80250d:	89 d8                	mov    %ebx,%eax
+  80250f:	e8 35 fb ff ff       	call   802049 <stream_setup>
+	want = size * n;
+  802514:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802517:	0f af 45 10          	imul   0x10(%ebp),%eax
+  80251b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  80251e:	89 d8                	mov    %ebx,%eax
+  802520:	e8 41 fa ff ff       	call   801f66 <stream_unread>
+	for (done = 0; done < want; ) {
+  802525:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  80252a:	84 c0                	test   %al,%al
+  80252c:	75 7b                	jne    8025a9 <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  80252e:	be 00 00 00 00       	mov    $0x0,%esi
+  802533:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802536:	39 fe                	cmp    %edi,%esi
+  802538:	73 24                	jae    80255e <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  80253a:	83 ec 04             	sub    $0x4,%esp
+  80253d:	89 f8                	mov    %edi,%eax
+  80253f:	29 f0                	sub    %esi,%eax
+  802541:	50                   	push   %eax
+  802542:	89 f0                	mov    %esi,%eax
+  802544:	03 45 08             	add    0x8(%ebp),%eax
+  802547:	50                   	push   %eax
+  802548:	ff 33                	push   (%ebx)
+  80254a:	e8 a0 ef ff ff       	call   8014ef <write>
+  80254f:	83 c4 10             	add    $0x10,%esp
+  802552:	85 c0                	test   %eax,%eax
+  802554:	7e 04                	jle    80255a <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  802556:	01 c6                	add    %eax,%esi
+  802558:	eb dc                	jmp    802536 <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  80255a:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  80255e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802561:	85 c0                	test   %eax,%eax
+  802563:	74 a0                	je     802505 <fwrite+0x1e>
+  802565:	89 f0                	mov    %esi,%eax
+  802567:	ba 00 00 00 00       	mov    $0x0,%edx
+  80256c:	f7 75 0c             	divl   0xc(%ebp)
+  80256f:	eb 94                	jmp    802505 <fwrite+0x1e>
+			done += r;
+  802571:	01 c7                	add    %eax,%edi
+			continue;
+  802573:	eb 34                	jmp    8025a9 <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  802575:	8b 73 10             	mov    0x10(%ebx),%esi
+  802578:	29 c6                	sub    %eax,%esi
+  80257a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80257d:	29 fa                	sub    %edi,%edx
+  80257f:	39 d6                	cmp    %edx,%esi
+  802581:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  802584:	83 ec 04             	sub    $0x4,%esp
+  802587:	56                   	push   %esi
+  802588:	89 fa                	mov    %edi,%edx
+  80258a:	03 55 08             	add    0x8(%ebp),%edx
+  80258d:	52                   	push   %edx
+  80258e:	03 43 0c             	add    0xc(%ebx),%eax
+  802591:	50                   	push   %eax
+  802592:	e8 f9 e3 ff ff       	call   800990 <memmove>
+		f->f_wend += m;
+  802597:	89 f0                	mov    %esi,%eax
+  802599:	03 43 1c             	add    0x1c(%ebx),%eax
+  80259c:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  80259f:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  8025a1:	83 c4 10             	add    $0x10,%esp
+  8025a4:	3b 43 10             	cmp    0x10(%ebx),%eax
+  8025a7:	74 5b                	je     802604 <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  8025a9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8025ac:	39 c7                	cmp    %eax,%edi
+  8025ae:	73 2d                	jae    8025dd <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  8025b0:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8025b3:	85 c0                	test   %eax,%eax
+  8025b5:	75 be                	jne    802575 <fwrite+0x8e>
+  8025b7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8025ba:	29 fa                	sub    %edi,%edx
+  8025bc:	3b 53 10             	cmp    0x10(%ebx),%edx
+  8025bf:	72 b4                	jb     802575 <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  8025c1:	83 ec 04             	sub    $0x4,%esp
+  8025c4:	52                   	push   %edx
+  8025c5:	89 f8                	mov    %edi,%eax
+  8025c7:	03 45 08             	add    0x8(%ebp),%eax
+  8025ca:	50                   	push   %eax
+  8025cb:	ff 33                	push   (%ebx)
+  8025cd:	e8 1d ef ff ff       	call   8014ef <write>
+  8025d2:	83 c4 10             	add    $0x10,%esp
+  8025d5:	85 c0                	test   %eax,%eax
+  8025d7:	7f 98                	jg     802571 <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  8025d9:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  8025dd:	8b 43 08             	mov    0x8(%ebx),%eax
+  8025e0:	83 f8 03             	cmp    $0x3,%eax
+  8025e3:	74 48                	je     80262d <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  8025e5:	83 f8 02             	cmp    $0x2,%eax
+  8025e8:	74 27                	je     802611 <fwrite+0x12a>
+	return size ? done / size : 0;
+  8025ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025ed:	85 c0                	test   %eax,%eax
+  8025ef:	0f 84 10 ff ff ff    	je     802505 <fwrite+0x1e>
+  8025f5:	89 f8                	mov    %edi,%eax
+  8025f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025fc:	f7 75 0c             	divl   0xc(%ebp)
+  8025ff:	e9 01 ff ff ff       	jmp    802505 <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802604:	89 d8                	mov    %ebx,%eax
+  802606:	e8 ce f9 ff ff       	call   801fd9 <stream_drain>
+  80260b:	85 c0                	test   %eax,%eax
+  80260d:	79 9a                	jns    8025a9 <fwrite+0xc2>
+  80260f:	eb cc                	jmp    8025dd <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802611:	83 ec 04             	sub    $0x4,%esp
+  802614:	57                   	push   %edi
+  802615:	6a 0a                	push   $0xa
+  802617:	ff 75 08             	push   0x8(%ebp)
+  80261a:	e8 22 e4 ff ff       	call   800a41 <memfind>
+  80261f:	89 c2                	mov    %eax,%edx
+  802621:	89 f8                	mov    %edi,%eax
+  802623:	03 45 08             	add    0x8(%ebp),%eax
+  802626:	83 c4 10             	add    $0x10,%esp
+  802629:	39 c2                	cmp    %eax,%edx
+  80262b:	74 bd                	je     8025ea <fwrite+0x103>
+		stream_drain(f);
+  80262d:	89 d8                	mov    %ebx,%eax
+  80262f:	e8 a5 f9 ff ff       	call   801fd9 <stream_drain>
+  802634:	eb b4                	jmp    8025ea <fwrite+0x103>
+
+00802636 <fputc>:
+{
+  802636:	55                   	push   %ebp
+  802637:	89 e5                	mov    %esp,%ebp
+  802639:	53                   	push   %ebx
+  80263a:	83 ec 14             	sub    $0x14,%esp
+  80263d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  802640:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  802643:	ff 75 0c             	push   0xc(%ebp)
+  802646:	6a 01                	push   $0x1
+  802648:	6a 01                	push   $0x1
+  80264a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80264d:	50                   	push   %eax
+  80264e:	e8 94 fe ff ff       	call   8024e7 <fwrite>
+  802653:	83 c4 10             	add    $0x10,%esp
+  802656:	0f b6 db             	movzbl %bl,%ebx
+  802659:	83 f8 01             	cmp    $0x1,%eax
+  80265c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802661:	0f 44 c3             	cmove  %ebx,%eax
+}
+  802664:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802667:	c9                   	leave
+  802668:	c3                   	ret
+
+00802669 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  802669:	55                   	push   %ebp
+  80266a:	89 e5                	mov    %esp,%ebp
+  80266c:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  80266f:	ff 75 0c             	push   0xc(%ebp)
+  802672:	ff 75 08             	push   0x8(%ebp)
+  802675:	e8 bc ff ff ff       	call   802636 <fputc>
+}
+  80267a:	83 c4 10             	add    $0x10,%esp
+  80267d:	c9                   	leave
+  80267e:	c3                   	ret
+
+0080267f <fputs>:
+{
+  80267f:	55                   	push   %ebp
+  802680:	89 e5                	mov    %esp,%ebp
+  802682:	56                   	push   %esi
+  802683:	53                   	push   %ebx
+  802684:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  802687:	83 ec 0c             	sub    $0xc,%esp
+  80268a:	56                   	push   %esi
+  80268b:	e8 3f e1 ff ff       	call   8007cf <strlen>
+  802690:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  802692:	ff 75 0c             	push   0xc(%ebp)
+  802695:	50                   	push   %eax
+  802696:	6a 01                	push   $0x1
+  802698:	56                   	push   %esi
+  802699:	e8 49 fe ff ff       	call   8024e7 <fwrite>
+  80269e:	83 c4 20             	add    $0x20,%esp
+  8026a1:	39 d8                	cmp    %ebx,%eax
+  8026a3:	0f 95 c0             	setne  %al
+  8026a6:	0f b6 c0             	movzbl %al,%eax
+  8026a9:	f7 d8                	neg    %eax
+}
+  8026ab:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026ae:	5b                   	pop    %ebx
+  8026af:	5e                   	pop    %esi
+  8026b0:	5d                   	pop    %ebp
+  8026b1:	c3                   	ret
+
+008026b2 <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  8026b2:	55                   	push   %ebp
+  8026b3:	89 e5                	mov    %esp,%ebp
+  8026b5:	53                   	push   %ebx
+  8026b6:	83 ec 04             	sub    $0x4,%esp
+  8026b9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8026bc:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  8026bf:	50                   	push   %eax
+  8026c0:	ff 75 0c             	push   0xc(%ebp)
+  8026c3:	53                   	push   %ebx
+  8026c4:	68 69 26 80 00       	push   $0x802669
+  8026c9:	e8 4f dc ff ff       	call   80031d <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  8026ce:	8b 43 04             	mov    0x4(%ebx),%eax
+  8026d1:	c1 e0 1c             	shl    $0x1c,%eax
+  8026d4:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  8026d7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026da:	c9                   	leave
+  8026db:	c3                   	ret
+
+008026dc <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  8026dc:	55                   	push   %ebp
+  8026dd:	89 e5                	mov    %esp,%ebp
+  8026df:	57                   	push   %edi
+  8026e0:	56                   	push   %esi
+  8026e1:	53                   	push   %ebx
+  8026e2:	81 ec 84 02 00 00    	sub    $0x284,%esp
+	//   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+	//     correct initial eip and esp values in the child.
+	//
+	//   - Start the child process running with sys_env_set_status().
+
+	if ((r = open(prog, O_RDONLY)) < 0)
+  8026e8:	6a 00                	push   $0x0
+  8026ea:	ff 75 08             	push   0x8(%ebp)
+  8026ed:	e8 4d f3 ff ff       	call   801a3f <open>
+  8026f2:	89 85 88 fd ff ff    	mov    %eax,-0x278(%ebp)
+  8026f8:	83 c4 10             	add    $0x10,%esp
+  8026fb:	85 c0                	test   %eax,%eax
+  8026fd:	0f 88 df 04 00 00    	js     802be2 <spawn+0x506>
+  802703:	89 c1                	mov    %eax,%ecx
+		return r;
+	fd = r;
+
+	// Read elf header
+	elf = (struct Elf*) elf_buf;
+	if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf)
+  802705:	83 ec 04             	sub    $0x4,%esp
+  802708:	68 00 02 00 00       	push   $0x200
+  80270d:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  802713:	50                   	push   %eax
+  802714:	51                   	push   %ecx
+  802715:	e8 8e ed ff ff       	call   8014a8 <readn>
+  80271a:	83 c4 10             	add    $0x10,%esp
+  80271d:	3d 00 02 00 00       	cmp    $0x200,%eax
+  802722:	75 5a                	jne    80277e <spawn+0xa2>
+	    || elf->e_magic != ELF_MAGIC) {
+  802724:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  80272b:	45 4c 46 
+  80272e:	75 4e                	jne    80277e <spawn+0xa2>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  802730:	b8 07 00 00 00       	mov    $0x7,%eax
+  802735:	cd 30                	int    $0x30
+  802737:	89 85 90 fd ff ff    	mov    %eax,-0x270(%ebp)
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+		return -E_NOT_EXEC;
+	}
+
+	// Create new child environment
+	if ((r = sys_exofork()) < 0)
+  80273d:	85 c0                	test   %eax,%eax
+  80273f:	0f 88 91 04 00 00    	js     802bd6 <spawn+0x4fa>
+		return r;
+	child = r;
+
+	// Set up trap frame, including initial stack.
+	child_tf = envs[ENVX(child)].env_tf;
+  802745:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80274a:	8d 34 c0             	lea    (%eax,%eax,8),%esi
+  80274d:	c1 e6 04             	shl    $0x4,%esi
+  802750:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  802756:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  80275c:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802761:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	child_tf.tf_eip = elf->e_entry;
+  802763:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  802769:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+	uintptr_t *argv_store;
+
+	// Count the number of arguments (argc)
+	// and the total amount of space needed for strings (string_size).
+	string_size = 0;
+	for (argc = 0; argv[argc] != 0; argc++)
+  80276f:	bb 00 00 00 00       	mov    $0x0,%ebx
+	string_size = 0;
+  802774:	be 00 00 00 00       	mov    $0x0,%esi
+  802779:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	for (argc = 0; argv[argc] != 0; argc++)
+  80277c:	eb 4b                	jmp    8027c9 <spawn+0xed>
+		close(fd);
+  80277e:	83 ec 0c             	sub    $0xc,%esp
+  802781:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  802787:	e8 2f eb ff ff       	call   8012bb <close>
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  80278c:	83 c4 0c             	add    $0xc,%esp
+  80278f:	68 7f 45 4c 46       	push   $0x464c457f
+  802794:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  80279a:	68 58 52 80 00       	push   $0x805258
+  80279f:	e8 82 da ff ff       	call   800226 <cprintf>
+		return -E_NOT_EXEC;
+  8027a4:	83 c4 10             	add    $0x10,%esp
+  8027a7:	c7 85 88 fd ff ff f2 	movl   $0xfffffff2,-0x278(%ebp)
+  8027ae:	ff ff ff 
+  8027b1:	e9 2c 04 00 00       	jmp    802be2 <spawn+0x506>
+		string_size += strlen(argv[argc]) + 1;
+  8027b6:	83 ec 0c             	sub    $0xc,%esp
+  8027b9:	50                   	push   %eax
+  8027ba:	e8 10 e0 ff ff       	call   8007cf <strlen>
+  8027bf:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+	for (argc = 0; argv[argc] != 0; argc++)
+  8027c3:	83 c3 01             	add    $0x1,%ebx
+  8027c6:	83 c4 10             	add    $0x10,%esp
+  8027c9:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  8027cc:	85 c0                	test   %eax,%eax
+  8027ce:	75 e6                	jne    8027b6 <spawn+0xda>
+	// Determine where to place the strings and the argv array.
+	// Set up pointers into the temporary page 'UTEMP'; we'll map a page
+	// there later, then remap that page into the child environment
+	// at (USTACKTOP - PGSIZE).
+	// strings is the topmost thing on the stack.
+	string_store = (char*) UTEMP + PGSIZE - string_size;
+  8027d0:	89 9d 84 fd ff ff    	mov    %ebx,-0x27c(%ebp)
+  8027d6:	bf 00 10 40 00       	mov    $0x401000,%edi
+  8027db:	29 f7                	sub    %esi,%edi
+	// argv is below that.  There's one argument pointer per argument, plus
+	// a null pointer.
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  8027dd:	89 fa                	mov    %edi,%edx
+  8027df:	83 e2 fc             	and    $0xfffffffc,%edx
+  8027e2:	8d 04 9d 04 00 00 00 	lea    0x4(,%ebx,4),%eax
+  8027e9:	29 c2                	sub    %eax,%edx
+  8027eb:	89 95 94 fd ff ff    	mov    %edx,-0x26c(%ebp)
+
+	// Make sure that argv, strings, and the 2 words that hold 'argc'
+	// and 'argv' themselves will all fit in a single stack page.
+	if ((void*) (argv_store - 2) < (void*) UTEMP)
+  8027f1:	8d 42 f8             	lea    -0x8(%edx),%eax
+  8027f4:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  8027f9:	0f 86 06 04 00 00    	jbe    802c05 <spawn+0x529>
+		return -E_NO_MEM;
+
+	// Allocate the single stack page at UTEMP.
+	if ((r = sys_page_alloc(0, (void*) UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  8027ff:	83 ec 04             	sub    $0x4,%esp
+  802802:	6a 07                	push   $0x7
+  802804:	68 00 00 40 00       	push   $0x400000
+  802809:	6a 00                	push   $0x0
+  80280b:	e8 38 e4 ff ff       	call   800c48 <sys_page_alloc>
+  802810:	83 c4 10             	add    $0x10,%esp
+  802813:	85 c0                	test   %eax,%eax
+  802815:	0f 88 ef 03 00 00    	js     802c0a <spawn+0x52e>
+	//	  (Again, argv should use an address valid in the child's
+	//	  environment.)
+	//
+	//	* Set *init_esp to the initial stack pointer for the child,
+	//	  (Again, use an address valid in the child's environment.)
+	for (i = 0; i < argc; i++) {
+  80281b:	be 00 00 00 00       	mov    $0x0,%esi
+  802820:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+  802826:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802829:	39 b5 8c fd ff ff    	cmp    %esi,-0x274(%ebp)
+  80282f:	7e 32                	jle    802863 <spawn+0x187>
+		argv_store[i] = UTEMP2USTACK(string_store);
+  802831:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  802837:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  80283d:	89 04 b1             	mov    %eax,(%ecx,%esi,4)
+		strcpy(string_store, argv[i]);
+  802840:	83 ec 08             	sub    $0x8,%esp
+  802843:	ff 34 b3             	push   (%ebx,%esi,4)
+  802846:	57                   	push   %edi
+  802847:	e8 be df ff ff       	call   80080a <strcpy>
+		string_store += strlen(argv[i]) + 1;
+  80284c:	83 c4 04             	add    $0x4,%esp
+  80284f:	ff 34 b3             	push   (%ebx,%esi,4)
+  802852:	e8 78 df ff ff       	call   8007cf <strlen>
+  802857:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+	for (i = 0; i < argc; i++) {
+  80285b:	83 c6 01             	add    $0x1,%esi
+  80285e:	83 c4 10             	add    $0x10,%esp
+  802861:	eb c6                	jmp    802829 <spawn+0x14d>
+	}
+	argv_store[argc] = 0;
+  802863:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  802869:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  80286f:	c7 04 88 00 00 00 00 	movl   $0x0,(%eax,%ecx,4)
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  802876:	81 ff 00 10 40 00    	cmp    $0x401000,%edi
+  80287c:	0f 85 87 00 00 00    	jne    802909 <spawn+0x22d>
+
+	argv_store[-1] = UTEMP2USTACK(argv_store);
+  802882:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  802888:	8d 81 00 d0 7f ee    	lea    -0x11803000(%ecx),%eax
+  80288e:	89 41 fc             	mov    %eax,-0x4(%ecx)
+	argv_store[-2] = argc;
+  802891:	89 c8                	mov    %ecx,%eax
+  802893:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  802899:	89 48 f8             	mov    %ecx,-0x8(%eax)
+
+	*init_esp = UTEMP2USTACK(&argv_store[-2]);
+  80289c:	2d 08 30 80 11       	sub    $0x11803008,%eax
+  8028a1:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+	// After completing the stack, map it into the child's address space
+	// and unmap it from ours!
+	if ((r = sys_page_map(0, UTEMP, child, (void*) (USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  8028a7:	83 ec 0c             	sub    $0xc,%esp
+  8028aa:	6a 07                	push   $0x7
+  8028ac:	68 00 d0 bf ee       	push   $0xeebfd000
+  8028b1:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  8028b7:	68 00 00 40 00       	push   $0x400000
+  8028bc:	6a 00                	push   $0x0
+  8028be:	e8 d2 e3 ff ff       	call   800c95 <sys_page_map>
+  8028c3:	89 c3                	mov    %eax,%ebx
+  8028c5:	83 c4 20             	add    $0x20,%esp
+  8028c8:	85 c0                	test   %eax,%eax
+  8028ca:	0f 88 98 03 00 00    	js     802c68 <spawn+0x58c>
+		goto error;
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  8028d0:	83 ec 08             	sub    $0x8,%esp
+  8028d3:	68 00 00 40 00       	push   $0x400000
+  8028d8:	6a 00                	push   $0x0
+  8028da:	e8 02 e4 ff ff       	call   800ce1 <sys_page_unmap>
+  8028df:	89 c3                	mov    %eax,%ebx
+  8028e1:	83 c4 10             	add    $0x10,%esp
+  8028e4:	85 c0                	test   %eax,%eax
+  8028e6:	0f 88 7c 03 00 00    	js     802c68 <spawn+0x58c>
+	ph = (struct Proghdr*) (elf_buf + elf->e_phoff);
+  8028ec:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  8028f2:	8d 8c 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%ecx
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  8028f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028fe:	89 c8                	mov    %ecx,%eax
+  802900:	89 d1                	mov    %edx,%ecx
+  802902:	89 c2                	mov    %eax,%edx
+  802904:	e9 5a 01 00 00       	jmp    802a63 <spawn+0x387>
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  802909:	68 e4 52 80 00       	push   $0x8052e4
+  80290e:	68 1d 52 80 00       	push   $0x80521d
+  802913:	68 06 01 00 00       	push   $0x106
+  802918:	68 72 52 80 00       	push   $0x805272
+  80291d:	e8 29 d8 ff ff       	call   80014b <_panic>
+			// allocate a blank page
+			if ((r = sys_page_alloc(child, (void*) (va + i), perm)) < 0)
+				return r;
+		} else {
+			// from file
+			if ((r = sys_page_alloc(0, UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  802922:	83 ec 04             	sub    $0x4,%esp
+  802925:	6a 07                	push   $0x7
+  802927:	68 00 00 40 00       	push   $0x400000
+  80292c:	6a 00                	push   $0x0
+  80292e:	e8 15 e3 ff ff       	call   800c48 <sys_page_alloc>
+  802933:	83 c4 10             	add    $0x10,%esp
+  802936:	85 c0                	test   %eax,%eax
+  802938:	0f 88 b2 02 00 00    	js     802bf0 <spawn+0x514>
+				return r;
+			if ((r = seek(fd, fileoffset + i)) < 0)
+  80293e:	83 ec 08             	sub    $0x8,%esp
+  802941:	8b 95 80 fd ff ff    	mov    -0x280(%ebp),%edx
+  802947:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  80294d:	01 d0                	add    %edx,%eax
+  80294f:	50                   	push   %eax
+  802950:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  802956:	e8 40 ec ff ff       	call   80159b <seek>
+  80295b:	83 c4 10             	add    $0x10,%esp
+  80295e:	85 c0                	test   %eax,%eax
+  802960:	0f 88 91 02 00 00    	js     802bf7 <spawn+0x51b>
+				return r;
+			if ((r = readn(fd, UTEMP, MIN(PGSIZE, filesz-i))) < 0)
+  802966:	83 ec 04             	sub    $0x4,%esp
+  802969:	89 fa                	mov    %edi,%edx
+  80296b:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  802971:	29 ca                	sub    %ecx,%edx
+  802973:	89 d0                	mov    %edx,%eax
+  802975:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80297a:	39 d0                	cmp    %edx,%eax
+  80297c:	0f 47 c2             	cmova  %edx,%eax
+  80297f:	50                   	push   %eax
+  802980:	68 00 00 40 00       	push   $0x400000
+  802985:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  80298b:	e8 18 eb ff ff       	call   8014a8 <readn>
+  802990:	83 c4 10             	add    $0x10,%esp
+  802993:	85 c0                	test   %eax,%eax
+  802995:	0f 88 63 02 00 00    	js     802bfe <spawn+0x522>
+				return r;
+			if ((r = sys_page_map(0, UTEMP, child, (void*) (va + i), perm)) < 0)
+  80299b:	83 ec 0c             	sub    $0xc,%esp
+  80299e:	ff b5 84 fd ff ff    	push   -0x27c(%ebp)
+  8029a4:	56                   	push   %esi
+  8029a5:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  8029ab:	68 00 00 40 00       	push   $0x400000
+  8029b0:	6a 00                	push   $0x0
+  8029b2:	e8 de e2 ff ff       	call   800c95 <sys_page_map>
+  8029b7:	83 c4 20             	add    $0x20,%esp
+  8029ba:	85 c0                	test   %eax,%eax
+  8029bc:	78 7e                	js     802a3c <spawn+0x360>
+				panic("spawn: sys_page_map data: %e", r);
+			sys_page_unmap(0, UTEMP);
+  8029be:	83 ec 08             	sub    $0x8,%esp
+  8029c1:	68 00 00 40 00       	push   $0x400000
+  8029c6:	6a 00                	push   $0x0
+  8029c8:	e8 14 e3 ff ff       	call   800ce1 <sys_page_unmap>
+  8029cd:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < memsz; i += PGSIZE) {
+  8029d0:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8029d6:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8029dc:	89 9d 94 fd ff ff    	mov    %ebx,-0x26c(%ebp)
+  8029e2:	8b 85 8c fd ff ff    	mov    -0x274(%ebp),%eax
+  8029e8:	39 c3                	cmp    %eax,%ebx
+  8029ea:	73 65                	jae    802a51 <spawn+0x375>
+		if (i >= filesz) {
+  8029ec:	39 fb                	cmp    %edi,%ebx
+  8029ee:	0f 82 2e ff ff ff    	jb     802922 <spawn+0x246>
+			if ((r = sys_page_alloc(child, (void*) (va + i), perm)) < 0)
+  8029f4:	83 ec 04             	sub    $0x4,%esp
+  8029f7:	ff b5 84 fd ff ff    	push   -0x27c(%ebp)
+  8029fd:	56                   	push   %esi
+  8029fe:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802a04:	e8 3f e2 ff ff       	call   800c48 <sys_page_alloc>
+  802a09:	83 c4 10             	add    $0x10,%esp
+  802a0c:	85 c0                	test   %eax,%eax
+  802a0e:	79 c0                	jns    8029d0 <spawn+0x2f4>
+  802a10:	89 c7                	mov    %eax,%edi
+	sys_env_destroy(child);
+  802a12:	83 ec 0c             	sub    $0xc,%esp
+  802a15:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802a1b:	e8 85 e1 ff ff       	call   800ba5 <sys_env_destroy>
+	close(fd);
+  802a20:	83 c4 04             	add    $0x4,%esp
+  802a23:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  802a29:	e8 8d e8 ff ff       	call   8012bb <close>
+	return r;
+  802a2e:	83 c4 10             	add    $0x10,%esp
+  802a31:	89 bd 88 fd ff ff    	mov    %edi,-0x278(%ebp)
+  802a37:	e9 a6 01 00 00       	jmp    802be2 <spawn+0x506>
+				panic("spawn: sys_page_map data: %e", r);
+  802a3c:	50                   	push   %eax
+  802a3d:	68 7e 52 80 00       	push   $0x80527e
+  802a42:	68 39 01 00 00       	push   $0x139
+  802a47:	68 72 52 80 00       	push   $0x805272
+  802a4c:	e8 fa d6 ff ff       	call   80014b <_panic>
+  802a51:	8b 8d 7c fd ff ff    	mov    -0x284(%ebp),%ecx
+  802a57:	8b 95 78 fd ff ff    	mov    -0x288(%ebp),%edx
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  802a5d:	83 c1 01             	add    $0x1,%ecx
+  802a60:	83 c2 20             	add    $0x20,%edx
+  802a63:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  802a6a:	39 c8                	cmp    %ecx,%eax
+  802a6c:	0f 8e 88 00 00 00    	jle    802afa <spawn+0x41e>
+		if (ph->p_type != ELF_PROG_LOAD)
+  802a72:	83 3a 01             	cmpl   $0x1,(%edx)
+  802a75:	75 e6                	jne    802a5d <spawn+0x381>
+		if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  802a77:	8b 42 18             	mov    0x18(%edx),%eax
+  802a7a:	83 e0 02             	and    $0x2,%eax
+		perm = PTE_P | PTE_U;
+  802a7d:	83 f8 01             	cmp    $0x1,%eax
+  802a80:	19 c0                	sbb    %eax,%eax
+  802a82:	83 e0 fe             	and    $0xfffffffe,%eax
+  802a85:	83 c0 07             	add    $0x7,%eax
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  802a88:	8b 72 04             	mov    0x4(%edx),%esi
+  802a8b:	89 b5 80 fd ff ff    	mov    %esi,-0x280(%ebp)
+  802a91:	8b 7a 10             	mov    0x10(%edx),%edi
+  802a94:	89 bd 94 fd ff ff    	mov    %edi,-0x26c(%ebp)
+  802a9a:	8b 5a 14             	mov    0x14(%edx),%ebx
+  802a9d:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+  802aa3:	8b 7a 08             	mov    0x8(%edx),%edi
+  802aa6:	89 bd 84 fd ff ff    	mov    %edi,-0x27c(%ebp)
+	if ((i = PGOFF(va))) {
+  802aac:	89 fb                	mov    %edi,%ebx
+  802aae:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  802ab4:	74 1c                	je     802ad2 <spawn+0x3f6>
+		va -= i;
+  802ab6:	29 df                	sub    %ebx,%edi
+  802ab8:	89 bd 84 fd ff ff    	mov    %edi,-0x27c(%ebp)
+		memsz += i;
+  802abe:	01 9d 8c fd ff ff    	add    %ebx,-0x274(%ebp)
+		filesz += i;
+  802ac4:	01 9d 94 fd ff ff    	add    %ebx,-0x26c(%ebp)
+		fileoffset -= i;
+  802aca:	29 de                	sub    %ebx,%esi
+  802acc:	89 b5 80 fd ff ff    	mov    %esi,-0x280(%ebp)
+	for (i = 0; i < memsz; i += PGSIZE) {
+  802ad2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ad7:	8b bd 94 fd ff ff    	mov    -0x26c(%ebp),%edi
+  802add:	8b b5 84 fd ff ff    	mov    -0x27c(%ebp),%esi
+  802ae3:	89 8d 7c fd ff ff    	mov    %ecx,-0x284(%ebp)
+  802ae9:	89 95 78 fd ff ff    	mov    %edx,-0x288(%ebp)
+  802aef:	89 85 84 fd ff ff    	mov    %eax,-0x27c(%ebp)
+  802af5:	e9 e2 fe ff ff       	jmp    8029dc <spawn+0x300>
+	close(fd);
+  802afa:	83 ec 0c             	sub    $0xc,%esp
+  802afd:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  802b03:	e8 b3 e7 ff ff       	call   8012bb <close>
+  802b08:	83 c4 10             	add    $0x10,%esp
+	// LAB 5: Your code here.
+	int r;
+	extern volatile pte_t uvpt[];     // VA of "virtual page table"
+	extern volatile pde_t uvpd[];     // VA of current page directory
+
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  802b0b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b10:	eb 75                	jmp    802b87 <spawn+0x4ab>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+			int entry_num = NPTENTRIES;
+			if (pdeno == PDX(UTOP-1)) {
+				entry_num = PTX(UTOP-1)+1;
+			}
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  802b12:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802b18:	83 c6 01             	add    $0x1,%esi
+  802b1b:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+  802b21:	74 4f                	je     802b72 <spawn+0x496>
+				pte_t pte = uvpt[pdeno * NPDENTRIES + pteno];
+  802b23:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+				if ((pte & PTE_P) && (pte & PTE_U) && (pte & PTE_SHARE)) {
+  802b2a:	89 c2                	mov    %eax,%edx
+  802b2c:	81 e2 05 04 00 00    	and    $0x405,%edx
+  802b32:	81 fa 05 04 00 00    	cmp    $0x405,%edx
+  802b38:	75 d8                	jne    802b12 <spawn+0x436>
+					void* va = (void*)PGADDR(pdeno, pteno, 0);
+  802b3a:	89 da                	mov    %ebx,%edx
+  802b3c:	09 fa                	or     %edi,%edx
+					if ((r = sys_page_map(0, va, child, va, pte & PTE_SYSCALL)) < 0) {
+  802b3e:	83 ec 0c             	sub    $0xc,%esp
+  802b41:	25 07 0e 00 00       	and    $0xe07,%eax
+  802b46:	50                   	push   %eax
+  802b47:	52                   	push   %edx
+  802b48:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802b4e:	52                   	push   %edx
+  802b4f:	6a 00                	push   $0x0
+  802b51:	e8 3f e1 ff ff       	call   800c95 <sys_page_map>
+  802b56:	83 c4 20             	add    $0x20,%esp
+  802b59:	85 c0                	test   %eax,%eax
+  802b5b:	79 b5                	jns    802b12 <spawn+0x436>
+		panic("copy_shared_pages: %e", r);
+  802b5d:	50                   	push   %eax
+  802b5e:	68 cc 52 80 00       	push   $0x8052cc
+  802b63:	68 94 00 00 00       	push   $0x94
+  802b68:	68 72 52 80 00       	push   $0x805272
+  802b6d:	e8 d9 d5 ff ff       	call   80014b <_panic>
+  802b72:	8b 95 94 fd ff ff    	mov    -0x26c(%ebp),%edx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  802b78:	83 c2 01             	add    $0x1,%edx
+  802b7b:	81 fa bb 03 00 00    	cmp    $0x3bb,%edx
+  802b81:	0f 84 8b 00 00 00    	je     802c12 <spawn+0x536>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  802b87:	8b 04 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%eax
+  802b8e:	a8 07                	test   $0x7,%al
+  802b90:	74 e6                	je     802b78 <spawn+0x49c>
+  802b92:	89 d6                	mov    %edx,%esi
+  802b94:	c1 e6 0a             	shl    $0xa,%esi
+  802b97:	89 d7                	mov    %edx,%edi
+  802b99:	c1 e7 16             	shl    $0x16,%edi
+  802b9c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ba1:	89 95 94 fd ff ff    	mov    %edx,-0x26c(%ebp)
+  802ba7:	e9 77 ff ff ff       	jmp    802b23 <spawn+0x447>
+		panic("sys_env_set_trapframe: %e", r);
+  802bac:	50                   	push   %eax
+  802bad:	68 9b 52 80 00       	push   $0x80529b
+  802bb2:	68 98 00 00 00       	push   $0x98
+  802bb7:	68 72 52 80 00       	push   $0x805272
+  802bbc:	e8 8a d5 ff ff       	call   80014b <_panic>
+		panic("sys_env_set_status: %e", r);
+  802bc1:	50                   	push   %eax
+  802bc2:	68 b5 52 80 00       	push   $0x8052b5
+  802bc7:	68 9b 00 00 00       	push   $0x9b
+  802bcc:	68 72 52 80 00       	push   $0x805272
+  802bd1:	e8 75 d5 ff ff       	call   80014b <_panic>
+		return r;
+  802bd6:	8b 85 90 fd ff ff    	mov    -0x270(%ebp),%eax
+  802bdc:	89 85 88 fd ff ff    	mov    %eax,-0x278(%ebp)
+}
+  802be2:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  802be8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802beb:	5b                   	pop    %ebx
+  802bec:	5e                   	pop    %esi
+  802bed:	5f                   	pop    %edi
+  802bee:	5d                   	pop    %ebp
+  802bef:	c3                   	ret
+  802bf0:	89 c7                	mov    %eax,%edi
+  802bf2:	e9 1b fe ff ff       	jmp    802a12 <spawn+0x336>
+  802bf7:	89 c7                	mov    %eax,%edi
+  802bf9:	e9 14 fe ff ff       	jmp    802a12 <spawn+0x336>
+  802bfe:	89 c7                	mov    %eax,%edi
+  802c00:	e9 0d fe ff ff       	jmp    802a12 <spawn+0x336>
+		return -E_NO_MEM;
+  802c05:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+	return r;
+  802c0a:	89 85 88 fd ff ff    	mov    %eax,-0x278(%ebp)
+  802c10:	eb d0                	jmp    802be2 <spawn+0x506>
+	child_tf.tf_eflags |= FL_IOPL_3;   // devious: see user/faultio.c
+  802c12:	81 8d dc fd ff ff 00 	orl    $0x3000,-0x224(%ebp)
+  802c19:	30 00 00 
+	if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  802c1c:	83 ec 08             	sub    $0x8,%esp
+  802c1f:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  802c25:	50                   	push   %eax
+  802c26:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802c2c:	e8 48 e1 ff ff       	call   800d79 <sys_env_set_trapframe>
+  802c31:	83 c4 10             	add    $0x10,%esp
+  802c34:	85 c0                	test   %eax,%eax
+  802c36:	0f 88 70 ff ff ff    	js     802bac <spawn+0x4d0>
+	if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  802c3c:	83 ec 08             	sub    $0x8,%esp
+  802c3f:	6a 02                	push   $0x2
+  802c41:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802c47:	e8 e1 e0 ff ff       	call   800d2d <sys_env_set_status>
+  802c4c:	83 c4 10             	add    $0x10,%esp
+  802c4f:	85 c0                	test   %eax,%eax
+  802c51:	0f 88 6a ff ff ff    	js     802bc1 <spawn+0x4e5>
+	return child;
+  802c57:	8b 85 90 fd ff ff    	mov    -0x270(%ebp),%eax
+  802c5d:	89 85 88 fd ff ff    	mov    %eax,-0x278(%ebp)
+  802c63:	e9 7a ff ff ff       	jmp    802be2 <spawn+0x506>
+	sys_page_unmap(0, UTEMP);
+  802c68:	83 ec 08             	sub    $0x8,%esp
+  802c6b:	68 00 00 40 00       	push   $0x400000
+  802c70:	6a 00                	push   $0x0
+  802c72:	e8 6a e0 ff ff       	call   800ce1 <sys_page_unmap>
+  802c77:	83 c4 10             	add    $0x10,%esp
+  802c7a:	89 9d 88 fd ff ff    	mov    %ebx,-0x278(%ebp)
+  802c80:	e9 5d ff ff ff       	jmp    802be2 <spawn+0x506>
+
+00802c85 <spawnl>:
+{
+  802c85:	55                   	push   %ebp
+  802c86:	89 e5                	mov    %esp,%ebp
+  802c88:	56                   	push   %esi
+  802c89:	53                   	push   %ebx
+	va_start(vl, arg0);
+  802c8a:	8d 55 10             	lea    0x10(%ebp),%edx
+	int argc=0;
+  802c8d:	b8 00 00 00 00       	mov    $0x0,%eax
+	while(va_arg(vl, void *) != NULL)
+  802c92:	eb 05                	jmp    802c99 <spawnl+0x14>
+		argc++;
+  802c94:	83 c0 01             	add    $0x1,%eax
+	while(va_arg(vl, void *) != NULL)
+  802c97:	89 ca                	mov    %ecx,%edx
+  802c99:	8d 4a 04             	lea    0x4(%edx),%ecx
+  802c9c:	83 3a 00             	cmpl   $0x0,(%edx)
+  802c9f:	75 f3                	jne    802c94 <spawnl+0xf>
+	const char *argv[argc+2];
+  802ca1:	8d 14 85 17 00 00 00 	lea    0x17(,%eax,4),%edx
+  802ca8:	83 e2 f0             	and    $0xfffffff0,%edx
+  802cab:	29 d4                	sub    %edx,%esp
+  802cad:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  802cb1:	89 da                	mov    %ebx,%edx
+  802cb3:	c1 ea 02             	shr    $0x2,%edx
+  802cb6:	83 e3 fc             	and    $0xfffffffc,%ebx
+	argv[0] = arg0;
+  802cb9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802cbc:	89 0c 95 00 00 00 00 	mov    %ecx,0x0(,%edx,4)
+	argv[argc+1] = NULL;
+  802cc3:	c7 44 83 04 00 00 00 	movl   $0x0,0x4(%ebx,%eax,4)
+  802cca:	00 
+	va_start(vl, arg0);
+  802ccb:	8d 4d 10             	lea    0x10(%ebp),%ecx
+	for(i=0;i<argc;i++)
+  802cce:	89 c2                	mov    %eax,%edx
+  802cd0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cd5:	eb 0b                	jmp    802ce2 <spawnl+0x5d>
+		argv[i+1] = va_arg(vl, const char *);
+  802cd7:	83 c0 01             	add    $0x1,%eax
+  802cda:	8b 31                	mov    (%ecx),%esi
+  802cdc:	89 34 83             	mov    %esi,(%ebx,%eax,4)
+  802cdf:	8d 49 04             	lea    0x4(%ecx),%ecx
+	for(i=0;i<argc;i++)
+  802ce2:	39 d0                	cmp    %edx,%eax
+  802ce4:	75 f1                	jne    802cd7 <spawnl+0x52>
+	return spawn(prog, argv);
+  802ce6:	83 ec 08             	sub    $0x8,%esp
+  802ce9:	53                   	push   %ebx
+  802cea:	ff 75 08             	push   0x8(%ebp)
+  802ced:	e8 ea f9 ff ff       	call   8026dc <spawn>
+}
+  802cf2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802cf5:	5b                   	pop    %ebx
+  802cf6:	5e                   	pop    %esi
+  802cf7:	5d                   	pop    %ebp
+  802cf8:	c3                   	ret
+
+00802cf9 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802cf9:	55                   	push   %ebp
+  802cfa:	89 e5                	mov    %esp,%ebp
+  802cfc:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802cff:	68 0a 53 80 00       	push   $0x80530a
+  802d04:	ff 75 0c             	push   0xc(%ebp)
+  802d07:	e8 fe da ff ff       	call   80080a <strcpy>
+	return 0;
+}
+  802d0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d11:	c9                   	leave
+  802d12:	c3                   	ret
+
+00802d13 <devsock_close>:
+{
+  802d13:	55                   	push   %ebp
+  802d14:	89 e5                	mov    %esp,%ebp
+  802d16:	53                   	push   %ebx
+  802d17:	83 ec 10             	sub    $0x10,%esp
+  802d1a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802d1d:	53                   	push   %ebx
+  802d1e:	e8 23 1d 00 00       	call   804a46 <pageref>
+  802d23:	89 c2                	mov    %eax,%edx
+  802d25:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802d28:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802d2d:	83 fa 01             	cmp    $0x1,%edx
+  802d30:	74 05                	je     802d37 <devsock_close+0x24>
+}
+  802d32:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d35:	c9                   	leave
+  802d36:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802d37:	83 ec 0c             	sub    $0xc,%esp
+  802d3a:	ff 73 0c             	push   0xc(%ebx)
+  802d3d:	e8 b7 02 00 00       	call   802ff9 <nsipc_close>
+  802d42:	83 c4 10             	add    $0x10,%esp
+  802d45:	eb eb                	jmp    802d32 <devsock_close+0x1f>
+
+00802d47 <devsock_write>:
+{
+  802d47:	55                   	push   %ebp
+  802d48:	89 e5                	mov    %esp,%ebp
+  802d4a:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802d4d:	6a 00                	push   $0x0
+  802d4f:	ff 75 10             	push   0x10(%ebp)
+  802d52:	ff 75 0c             	push   0xc(%ebp)
+  802d55:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d58:	ff 70 0c             	push   0xc(%eax)
+  802d5b:	e8 79 03 00 00       	call   8030d9 <nsipc_send>
+}
+  802d60:	c9                   	leave
+  802d61:	c3                   	ret
+
+00802d62 <devsock_read>:
+{
+  802d62:	55                   	push   %ebp
+  802d63:	89 e5                	mov    %esp,%ebp
+  802d65:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802d68:	6a 00                	push   $0x0
+  802d6a:	ff 75 10             	push   0x10(%ebp)
+  802d6d:	ff 75 0c             	push   0xc(%ebp)
+  802d70:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d73:	ff 70 0c             	push   0xc(%eax)
+  802d76:	e8 ef 02 00 00       	call   80306a <nsipc_recv>
+}
+  802d7b:	c9                   	leave
+  802d7c:	c3                   	ret
+
+00802d7d <fd2sockid>:
+{
+  802d7d:	55                   	push   %ebp
+  802d7e:	89 e5                	mov    %esp,%ebp
+  802d80:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802d83:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802d86:	52                   	push   %edx
+  802d87:	50                   	push   %eax
+  802d88:	e8 da e3 ff ff       	call   801167 <fd_lookup>
+  802d8d:	83 c4 10             	add    $0x10,%esp
+  802d90:	85 c0                	test   %eax,%eax
+  802d92:	78 10                	js     802da4 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802d94:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d97:	8b 0d 60 62 80 00    	mov    0x806260,%ecx
+  802d9d:	39 08                	cmp    %ecx,(%eax)
+  802d9f:	75 05                	jne    802da6 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802da1:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802da4:	c9                   	leave
+  802da5:	c3                   	ret
+		return -E_NOT_SUPP;
+  802da6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802dab:	eb f7                	jmp    802da4 <fd2sockid+0x27>
+
+00802dad <alloc_sockfd>:
+{
+  802dad:	55                   	push   %ebp
+  802dae:	89 e5                	mov    %esp,%ebp
+  802db0:	56                   	push   %esi
+  802db1:	53                   	push   %ebx
+  802db2:	83 ec 1c             	sub    $0x1c,%esp
+  802db5:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802db7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802dba:	50                   	push   %eax
+  802dbb:	e8 51 e3 ff ff       	call   801111 <fd_alloc>
+  802dc0:	89 c3                	mov    %eax,%ebx
+  802dc2:	83 c4 10             	add    $0x10,%esp
+  802dc5:	85 c0                	test   %eax,%eax
+  802dc7:	78 43                	js     802e0c <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802dc9:	83 ec 04             	sub    $0x4,%esp
+  802dcc:	68 07 04 00 00       	push   $0x407
+  802dd1:	ff 75 f4             	push   -0xc(%ebp)
+  802dd4:	6a 00                	push   $0x0
+  802dd6:	e8 6d de ff ff       	call   800c48 <sys_page_alloc>
+  802ddb:	89 c3                	mov    %eax,%ebx
+  802ddd:	83 c4 10             	add    $0x10,%esp
+  802de0:	85 c0                	test   %eax,%eax
+  802de2:	78 28                	js     802e0c <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802de4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802de7:	8b 15 60 62 80 00    	mov    0x806260,%edx
+  802ded:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802def:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802df2:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802df9:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802dfc:	83 ec 0c             	sub    $0xc,%esp
+  802dff:	50                   	push   %eax
+  802e00:	e8 e5 e2 ff ff       	call   8010ea <fd2num>
+  802e05:	89 c3                	mov    %eax,%ebx
+  802e07:	83 c4 10             	add    $0x10,%esp
+  802e0a:	eb 0c                	jmp    802e18 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802e0c:	83 ec 0c             	sub    $0xc,%esp
+  802e0f:	56                   	push   %esi
+  802e10:	e8 e4 01 00 00       	call   802ff9 <nsipc_close>
+		return r;
+  802e15:	83 c4 10             	add    $0x10,%esp
+}
+  802e18:	89 d8                	mov    %ebx,%eax
+  802e1a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e1d:	5b                   	pop    %ebx
+  802e1e:	5e                   	pop    %esi
+  802e1f:	5d                   	pop    %ebp
+  802e20:	c3                   	ret
+
+00802e21 <accept>:
+{
+  802e21:	55                   	push   %ebp
+  802e22:	89 e5                	mov    %esp,%ebp
+  802e24:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802e27:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e2a:	e8 4e ff ff ff       	call   802d7d <fd2sockid>
+  802e2f:	85 c0                	test   %eax,%eax
+  802e31:	78 1b                	js     802e4e <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802e33:	83 ec 04             	sub    $0x4,%esp
+  802e36:	ff 75 10             	push   0x10(%ebp)
+  802e39:	ff 75 0c             	push   0xc(%ebp)
+  802e3c:	50                   	push   %eax
+  802e3d:	e8 0e 01 00 00       	call   802f50 <nsipc_accept>
+  802e42:	83 c4 10             	add    $0x10,%esp
+  802e45:	85 c0                	test   %eax,%eax
+  802e47:	78 05                	js     802e4e <accept+0x2d>
+	return alloc_sockfd(r);
+  802e49:	e8 5f ff ff ff       	call   802dad <alloc_sockfd>
+}
+  802e4e:	c9                   	leave
+  802e4f:	c3                   	ret
+
+00802e50 <bind>:
+{
+  802e50:	55                   	push   %ebp
+  802e51:	89 e5                	mov    %esp,%ebp
+  802e53:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802e56:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e59:	e8 1f ff ff ff       	call   802d7d <fd2sockid>
+  802e5e:	85 c0                	test   %eax,%eax
+  802e60:	78 12                	js     802e74 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802e62:	83 ec 04             	sub    $0x4,%esp
+  802e65:	ff 75 10             	push   0x10(%ebp)
+  802e68:	ff 75 0c             	push   0xc(%ebp)
+  802e6b:	50                   	push   %eax
+  802e6c:	e8 31 01 00 00       	call   802fa2 <nsipc_bind>
+  802e71:	83 c4 10             	add    $0x10,%esp
+}
+  802e74:	c9                   	leave
+  802e75:	c3                   	ret
+
+00802e76 <shutdown>:
+{
+  802e76:	55                   	push   %ebp
+  802e77:	89 e5                	mov    %esp,%ebp
+  802e79:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802e7c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e7f:	e8 f9 fe ff ff       	call   802d7d <fd2sockid>
+  802e84:	85 c0                	test   %eax,%eax
+  802e86:	78 0f                	js     802e97 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802e88:	83 ec 08             	sub    $0x8,%esp
+  802e8b:	ff 75 0c             	push   0xc(%ebp)
+  802e8e:	50                   	push   %eax
+  802e8f:	e8 43 01 00 00       	call   802fd7 <nsipc_shutdown>
+  802e94:	83 c4 10             	add    $0x10,%esp
+}
+  802e97:	c9                   	leave
+  802e98:	c3                   	ret
+
+00802e99 <connect>:
+{
+  802e99:	55                   	push   %ebp
+  802e9a:	89 e5                	mov    %esp,%ebp
+  802e9c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802e9f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ea2:	e8 d6 fe ff ff       	call   802d7d <fd2sockid>
+  802ea7:	85 c0                	test   %eax,%eax
+  802ea9:	78 12                	js     802ebd <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802eab:	83 ec 04             	sub    $0x4,%esp
+  802eae:	ff 75 10             	push   0x10(%ebp)
+  802eb1:	ff 75 0c             	push   0xc(%ebp)
+  802eb4:	50                   	push   %eax
+  802eb5:	e8 59 01 00 00       	call   803013 <nsipc_connect>
+  802eba:	83 c4 10             	add    $0x10,%esp
+}
+  802ebd:	c9                   	leave
+  802ebe:	c3                   	ret
+
+00802ebf <listen>:
+{
+  802ebf:	55                   	push   %ebp
+  802ec0:	89 e5                	mov    %esp,%ebp
+  802ec2:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802ec5:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ec8:	e8 b0 fe ff ff       	call   802d7d <fd2sockid>
+  802ecd:	85 c0                	test   %eax,%eax
+  802ecf:	78 0f                	js     802ee0 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802ed1:	83 ec 08             	sub    $0x8,%esp
+  802ed4:	ff 75 0c             	push   0xc(%ebp)
+  802ed7:	50                   	push   %eax
+  802ed8:	e8 6b 01 00 00       	call   803048 <nsipc_listen>
+  802edd:	83 c4 10             	add    $0x10,%esp
+}
+  802ee0:	c9                   	leave
+  802ee1:	c3                   	ret
+
+00802ee2 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802ee2:	55                   	push   %ebp
+  802ee3:	89 e5                	mov    %esp,%ebp
+  802ee5:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802ee8:	ff 75 10             	push   0x10(%ebp)
+  802eeb:	ff 75 0c             	push   0xc(%ebp)
+  802eee:	ff 75 08             	push   0x8(%ebp)
+  802ef1:	e8 41 02 00 00       	call   803137 <nsipc_socket>
+  802ef6:	83 c4 10             	add    $0x10,%esp
+  802ef9:	85 c0                	test   %eax,%eax
+  802efb:	78 05                	js     802f02 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802efd:	e8 ab fe ff ff       	call   802dad <alloc_sockfd>
+}
+  802f02:	c9                   	leave
+  802f03:	c3                   	ret
+
+00802f04 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802f04:	55                   	push   %ebp
+  802f05:	89 e5                	mov    %esp,%ebp
+  802f07:	53                   	push   %ebx
+  802f08:	83 ec 04             	sub    $0x4,%esp
+  802f0b:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802f0d:	83 3d 08 70 80 00 00 	cmpl   $0x0,0x807008
+  802f14:	74 26                	je     802f3c <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802f16:	6a 07                	push   $0x7
+  802f18:	68 00 90 80 00       	push   $0x809000
+  802f1d:	53                   	push   %ebx
+  802f1e:	ff 35 08 70 80 00    	push   0x807008
+  802f24:	e8 88 1a 00 00       	call   8049b1 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802f29:	83 c4 0c             	add    $0xc,%esp
+  802f2c:	6a 00                	push   $0x0
+  802f2e:	6a 00                	push   $0x0
+  802f30:	6a 00                	push   $0x0
+  802f32:	e8 84 19 00 00       	call   8048bb <ipc_recv>
+}
+  802f37:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f3a:	c9                   	leave
+  802f3b:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802f3c:	83 ec 0c             	sub    $0xc,%esp
+  802f3f:	6a 02                	push   $0x2
+  802f41:	e8 c1 1a 00 00       	call   804a07 <ipc_find_env>
+  802f46:	a3 08 70 80 00       	mov    %eax,0x807008
+  802f4b:	83 c4 10             	add    $0x10,%esp
+  802f4e:	eb c6                	jmp    802f16 <nsipc+0x12>
+
+00802f50 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802f50:	55                   	push   %ebp
+  802f51:	89 e5                	mov    %esp,%ebp
+  802f53:	56                   	push   %esi
+  802f54:	53                   	push   %ebx
+  802f55:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802f58:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f5b:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802f60:	8b 06                	mov    (%esi),%eax
+  802f62:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802f67:	b8 01 00 00 00       	mov    $0x1,%eax
+  802f6c:	e8 93 ff ff ff       	call   802f04 <nsipc>
+  802f71:	89 c3                	mov    %eax,%ebx
+  802f73:	85 c0                	test   %eax,%eax
+  802f75:	79 09                	jns    802f80 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802f77:	89 d8                	mov    %ebx,%eax
+  802f79:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f7c:	5b                   	pop    %ebx
+  802f7d:	5e                   	pop    %esi
+  802f7e:	5d                   	pop    %ebp
+  802f7f:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802f80:	83 ec 04             	sub    $0x4,%esp
+  802f83:	ff 35 10 90 80 00    	push   0x809010
+  802f89:	68 00 90 80 00       	push   $0x809000
+  802f8e:	ff 75 0c             	push   0xc(%ebp)
+  802f91:	e8 fa d9 ff ff       	call   800990 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802f96:	a1 10 90 80 00       	mov    0x809010,%eax
+  802f9b:	89 06                	mov    %eax,(%esi)
+  802f9d:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802fa0:	eb d5                	jmp    802f77 <nsipc_accept+0x27>
+
+00802fa2 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802fa2:	55                   	push   %ebp
+  802fa3:	89 e5                	mov    %esp,%ebp
+  802fa5:	53                   	push   %ebx
+  802fa6:	83 ec 08             	sub    $0x8,%esp
+  802fa9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802fac:	8b 45 08             	mov    0x8(%ebp),%eax
+  802faf:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802fb4:	53                   	push   %ebx
+  802fb5:	ff 75 0c             	push   0xc(%ebp)
+  802fb8:	68 04 90 80 00       	push   $0x809004
+  802fbd:	e8 ce d9 ff ff       	call   800990 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802fc2:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  802fc8:	b8 02 00 00 00       	mov    $0x2,%eax
+  802fcd:	e8 32 ff ff ff       	call   802f04 <nsipc>
+}
+  802fd2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802fd5:	c9                   	leave
+  802fd6:	c3                   	ret
+
+00802fd7 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802fd7:	55                   	push   %ebp
+  802fd8:	89 e5                	mov    %esp,%ebp
+  802fda:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802fdd:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fe0:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  802fe5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802fe8:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  802fed:	b8 03 00 00 00       	mov    $0x3,%eax
+  802ff2:	e8 0d ff ff ff       	call   802f04 <nsipc>
+}
+  802ff7:	c9                   	leave
+  802ff8:	c3                   	ret
+
+00802ff9 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802ff9:	55                   	push   %ebp
+  802ffa:	89 e5                	mov    %esp,%ebp
+  802ffc:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802fff:	8b 45 08             	mov    0x8(%ebp),%eax
+  803002:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  803007:	b8 04 00 00 00       	mov    $0x4,%eax
+  80300c:	e8 f3 fe ff ff       	call   802f04 <nsipc>
+}
+  803011:	c9                   	leave
+  803012:	c3                   	ret
+
+00803013 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  803013:	55                   	push   %ebp
+  803014:	89 e5                	mov    %esp,%ebp
+  803016:	53                   	push   %ebx
+  803017:	83 ec 08             	sub    $0x8,%esp
+  80301a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  80301d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803020:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  803025:	53                   	push   %ebx
+  803026:	ff 75 0c             	push   0xc(%ebp)
+  803029:	68 04 90 80 00       	push   $0x809004
+  80302e:	e8 5d d9 ff ff       	call   800990 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  803033:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  803039:	b8 05 00 00 00       	mov    $0x5,%eax
+  80303e:	e8 c1 fe ff ff       	call   802f04 <nsipc>
+}
+  803043:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803046:	c9                   	leave
+  803047:	c3                   	ret
+
+00803048 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  803048:	55                   	push   %ebp
+  803049:	89 e5                	mov    %esp,%ebp
+  80304b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  80304e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803051:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  803056:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803059:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  80305e:	b8 06 00 00 00       	mov    $0x6,%eax
+  803063:	e8 9c fe ff ff       	call   802f04 <nsipc>
+}
+  803068:	c9                   	leave
+  803069:	c3                   	ret
+
+0080306a <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  80306a:	55                   	push   %ebp
+  80306b:	89 e5                	mov    %esp,%ebp
+  80306d:	56                   	push   %esi
+  80306e:	53                   	push   %ebx
+  80306f:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  803072:	8b 45 08             	mov    0x8(%ebp),%eax
+  803075:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  80307a:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  803080:	8b 45 14             	mov    0x14(%ebp),%eax
+  803083:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  803088:	b8 07 00 00 00       	mov    $0x7,%eax
+  80308d:	e8 72 fe ff ff       	call   802f04 <nsipc>
+  803092:	89 c3                	mov    %eax,%ebx
+  803094:	85 c0                	test   %eax,%eax
+  803096:	78 22                	js     8030ba <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  803098:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80309d:	39 c6                	cmp    %eax,%esi
+  80309f:	0f 4e c6             	cmovle %esi,%eax
+  8030a2:	39 c3                	cmp    %eax,%ebx
+  8030a4:	7f 1d                	jg     8030c3 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8030a6:	83 ec 04             	sub    $0x4,%esp
+  8030a9:	53                   	push   %ebx
+  8030aa:	68 00 90 80 00       	push   $0x809000
+  8030af:	ff 75 0c             	push   0xc(%ebp)
+  8030b2:	e8 d9 d8 ff ff       	call   800990 <memmove>
+  8030b7:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8030ba:	89 d8                	mov    %ebx,%eax
+  8030bc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8030bf:	5b                   	pop    %ebx
+  8030c0:	5e                   	pop    %esi
+  8030c1:	5d                   	pop    %ebp
+  8030c2:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8030c3:	68 16 53 80 00       	push   $0x805316
+  8030c8:	68 1d 52 80 00       	push   $0x80521d
+  8030cd:	6a 62                	push   $0x62
+  8030cf:	68 2b 53 80 00       	push   $0x80532b
+  8030d4:	e8 72 d0 ff ff       	call   80014b <_panic>
+
+008030d9 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8030d9:	55                   	push   %ebp
+  8030da:	89 e5                	mov    %esp,%ebp
+  8030dc:	53                   	push   %ebx
+  8030dd:	83 ec 04             	sub    $0x4,%esp
+  8030e0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8030e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030e6:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  8030eb:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8030f1:	7f 2e                	jg     803121 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8030f3:	83 ec 04             	sub    $0x4,%esp
+  8030f6:	53                   	push   %ebx
+  8030f7:	ff 75 0c             	push   0xc(%ebp)
+  8030fa:	68 0c 90 80 00       	push   $0x80900c
+  8030ff:	e8 8c d8 ff ff       	call   800990 <memmove>
+	nsipcbuf.send.req_size = size;
+  803104:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  80310a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80310d:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  803112:	b8 08 00 00 00       	mov    $0x8,%eax
+  803117:	e8 e8 fd ff ff       	call   802f04 <nsipc>
+}
+  80311c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80311f:	c9                   	leave
+  803120:	c3                   	ret
+	assert(size < 1600);
+  803121:	68 37 53 80 00       	push   $0x805337
+  803126:	68 1d 52 80 00       	push   $0x80521d
+  80312b:	6a 6d                	push   $0x6d
+  80312d:	68 2b 53 80 00       	push   $0x80532b
+  803132:	e8 14 d0 ff ff       	call   80014b <_panic>
+
+00803137 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  803137:	55                   	push   %ebp
+  803138:	89 e5                	mov    %esp,%ebp
+  80313a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  80313d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803140:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  803145:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803148:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  80314d:	8b 45 10             	mov    0x10(%ebp),%eax
+  803150:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  803155:	b8 09 00 00 00       	mov    $0x9,%eax
+  80315a:	e8 a5 fd ff ff       	call   802f04 <nsipc>
+}
+  80315f:	c9                   	leave
+  803160:	c3                   	ret
+
+00803161 <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  803161:	55                   	push   %ebp
+  803162:	89 e5                	mov    %esp,%ebp
+  803164:	53                   	push   %ebx
+  803165:	83 ec 10             	sub    $0x10,%esp
+  803168:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  80316b:	68 0c 70 80 00       	push   $0x80700c
+  803170:	e8 50 07 00 00       	call   8038c5 <mutex_lock>
+	if (v == 0)
+  803175:	83 c4 10             	add    $0x10,%esp
+  803178:	85 db                	test   %ebx,%ebx
+  80317a:	0f 84 85 00 00 00    	je     803205 <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  803180:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  803186:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  80318b:	77 51                	ja     8031de <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  80318d:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  803193:	89 d8                	mov    %ebx,%eax
+  803195:	c1 e8 0c             	shr    $0xc,%eax
+  803198:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80319f:	f6 c4 02             	test   $0x2,%ah
+  8031a2:	74 50                	je     8031f4 <free+0x93>
+		sys_page_unmap(0, c);
+  8031a4:	83 ec 08             	sub    $0x8,%esp
+  8031a7:	53                   	push   %ebx
+  8031a8:	6a 00                	push   $0x0
+  8031aa:	e8 32 db ff ff       	call   800ce1 <sys_page_unmap>
+		c += PGSIZE;
+  8031af:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  8031b5:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  8031bb:	83 c4 10             	add    $0x10,%esp
+  8031be:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  8031c3:	76 ce                	jbe    803193 <free+0x32>
+  8031c5:	68 7f 53 80 00       	push   $0x80537f
+  8031ca:	68 1d 52 80 00       	push   $0x80521d
+  8031cf:	68 82 00 00 00       	push   $0x82
+  8031d4:	68 72 53 80 00       	push   $0x805372
+  8031d9:	e8 6d cf ff ff       	call   80014b <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  8031de:	68 44 53 80 00       	push   $0x805344
+  8031e3:	68 1d 52 80 00       	push   $0x80521d
+  8031e8:	6a 7b                	push   $0x7b
+  8031ea:	68 72 53 80 00       	push   $0x805372
+  8031ef:	e8 57 cf ff ff       	call   80014b <_panic>
+	if (--(*ref) == 0)
+  8031f4:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  8031fa:	83 e8 01             	sub    $0x1,%eax
+  8031fd:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  803203:	74 15                	je     80321a <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  803205:	83 ec 0c             	sub    $0xc,%esp
+  803208:	68 0c 70 80 00       	push   $0x80700c
+  80320d:	e8 20 07 00 00       	call   803932 <mutex_unlock>
+}
+  803212:	83 c4 10             	add    $0x10,%esp
+  803215:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803218:	c9                   	leave
+  803219:	c3                   	ret
+		sys_page_unmap(0, c);
+  80321a:	83 ec 08             	sub    $0x8,%esp
+  80321d:	53                   	push   %ebx
+  80321e:	6a 00                	push   $0x0
+  803220:	e8 bc da ff ff       	call   800ce1 <sys_page_unmap>
+  803225:	83 c4 10             	add    $0x10,%esp
+  803228:	eb db                	jmp    803205 <free+0xa4>
+
+0080322a <malloc>:
+{
+  80322a:	55                   	push   %ebp
+  80322b:	89 e5                	mov    %esp,%ebp
+  80322d:	57                   	push   %edi
+  80322e:	56                   	push   %esi
+  80322f:	53                   	push   %ebx
+  803230:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  803233:	68 0c 70 80 00       	push   $0x80700c
+  803238:	e8 88 06 00 00       	call   8038c5 <mutex_lock>
+	if (mptr == 0)
+  80323d:	8b 3d 10 70 80 00    	mov    0x807010,%edi
+  803243:	83 c4 10             	add    $0x10,%esp
+  803246:	85 ff                	test   %edi,%edi
+  803248:	74 6c                	je     8032b6 <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  80324a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80324d:	83 c0 03             	add    $0x3,%eax
+  803250:	83 e0 fc             	and    $0xfffffffc,%eax
+  803253:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  803255:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  80325a:	0f 87 64 01 00 00    	ja     8033c4 <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  803260:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803266:	74 30                	je     803298 <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  803268:	89 f9                	mov    %edi,%ecx
+  80326a:	c1 e9 0c             	shr    $0xc,%ecx
+  80326d:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  803271:	c1 e8 0c             	shr    $0xc,%eax
+  803274:	39 c1                	cmp    %eax,%ecx
+  803276:	74 5f                	je     8032d7 <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  803278:	83 ec 0c             	sub    $0xc,%esp
+  80327b:	57                   	push   %edi
+  80327c:	e8 e0 fe ff ff       	call   803161 <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  803281:	a1 10 70 80 00       	mov    0x807010,%eax
+  803286:	05 00 10 00 00       	add    $0x1000,%eax
+  80328b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803290:	a3 10 70 80 00       	mov    %eax,0x807010
+  803295:	83 c4 10             	add    $0x10,%esp
+  803298:	8b 0d 10 70 80 00    	mov    0x807010,%ecx
+{
+  80329e:	ba 02 00 00 00       	mov    $0x2,%edx
+  8032a3:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  8032a7:	8d 7e 04             	lea    0x4(%esi),%edi
+  8032aa:	89 cb                	mov    %ecx,%ebx
+  8032ac:	01 f9                	add    %edi,%ecx
+  8032ae:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8032b1:	e9 8b 00 00 00       	jmp    803341 <malloc+0x117>
+		mptr = mbegin;
+  8032b6:	c7 05 10 70 80 00 00 	movl   $0x8000000,0x807010
+  8032bd:	00 00 08 
+	n = ROUNDUP(n, 4);
+  8032c0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032c3:	83 c0 03             	add    $0x3,%eax
+  8032c6:	83 e0 fc             	and    $0xfffffffc,%eax
+  8032c9:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  8032cb:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  8032d0:	76 c6                	jbe    803298 <malloc+0x6e>
+  8032d2:	e9 d6 00 00 00       	jmp    8033ad <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  8032d7:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  8032dd:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  8032e2:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  8032e6:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  8032e9:	a3 10 70 80 00       	mov    %eax,0x807010
+			return v;
+  8032ee:	e9 ba 00 00 00       	jmp    8033ad <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  8032f3:	05 00 10 00 00       	add    $0x1000,%eax
+  8032f8:	39 c8                	cmp    %ecx,%eax
+  8032fa:	0f 83 cb 00 00 00    	jae    8033cb <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  803300:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  803305:	77 22                	ja     803329 <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  803307:	89 c2                	mov    %eax,%edx
+  803309:	c1 ea 16             	shr    $0x16,%edx
+  80330c:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  803313:	f6 c2 01             	test   $0x1,%dl
+  803316:	74 db                	je     8032f3 <malloc+0xc9>
+  803318:	89 c2                	mov    %eax,%edx
+  80331a:	c1 ea 0c             	shr    $0xc,%edx
+  80331d:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  803324:	f6 c2 01             	test   $0x1,%dl
+  803327:	74 ca                	je     8032f3 <malloc+0xc9>
+		if (mptr == mend) {
+  803329:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80332f:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  803335:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  803339:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  80333f:	74 04                	je     803345 <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  803341:	89 d8                	mov    %ebx,%eax
+  803343:	eb b3                	jmp    8032f8 <malloc+0xce>
+  803345:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  803348:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  80334d:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  803351:	83 ea 01             	sub    $0x1,%edx
+  803354:	0f 85 50 ff ff ff    	jne    8032aa <malloc+0x80>
+  80335a:	c7 05 10 70 80 00 00 	movl   $0x8000000,0x807010
+  803361:	00 00 08 
+				return 0;	/* out of address space */
+  803364:	bf 00 00 00 00       	mov    $0x0,%edi
+  803369:	eb 42                	jmp    8033ad <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  80336b:	85 db                	test   %ebx,%ebx
+  80336d:	78 1e                	js     80338d <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  80336f:	83 ec 08             	sub    $0x8,%esp
+  803372:	89 d8                	mov    %ebx,%eax
+  803374:	03 05 10 70 80 00    	add    0x807010,%eax
+  80337a:	50                   	push   %eax
+  80337b:	6a 00                	push   $0x0
+  80337d:	e8 5f d9 ff ff       	call   800ce1 <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  803382:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  803388:	83 c4 10             	add    $0x10,%esp
+  80338b:	eb de                	jmp    80336b <malloc+0x141>
+			return 0;	/* out of physical memory */
+  80338d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803392:	eb 19                	jmp    8033ad <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  803394:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803397:	8b 3d 10 70 80 00    	mov    0x807010,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  80339d:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  8033a4:	00 
+	mptr += n;
+  8033a5:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  8033a8:	a3 10 70 80 00       	mov    %eax,0x807010
+	mutex_unlock(&malloc_mu);
+  8033ad:	83 ec 0c             	sub    $0xc,%esp
+  8033b0:	68 0c 70 80 00       	push   $0x80700c
+  8033b5:	e8 78 05 00 00       	call   803932 <mutex_unlock>
+}
+  8033ba:	89 f8                	mov    %edi,%eax
+  8033bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033bf:	5b                   	pop    %ebx
+  8033c0:	5e                   	pop    %esi
+  8033c1:	5f                   	pop    %edi
+  8033c2:	5d                   	pop    %ebp
+  8033c3:	c3                   	ret
+		return 0;
+  8033c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033c9:	eb e2                	jmp    8033ad <malloc+0x183>
+  8033cb:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  8033cf:	74 06                	je     8033d7 <malloc+0x1ad>
+  8033d1:	89 1d 10 70 80 00    	mov    %ebx,0x807010
+	for (i = 0; i < n + 4; i += PGSIZE){
+  8033d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8033dc:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8033df:	39 fb                	cmp    %edi,%ebx
+  8033e1:	73 b1                	jae    803394 <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  8033e3:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  8033e9:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  8033ec:	39 fe                	cmp    %edi,%esi
+  8033ee:	0f 92 c0             	setb   %al
+  8033f1:	0f b6 c0             	movzbl %al,%eax
+  8033f4:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  8033f7:	83 c8 07             	or     $0x7,%eax
+  8033fa:	50                   	push   %eax
+  8033fb:	89 d8                	mov    %ebx,%eax
+  8033fd:	03 05 10 70 80 00    	add    0x807010,%eax
+  803403:	50                   	push   %eax
+  803404:	6a 00                	push   $0x0
+  803406:	e8 3d d8 ff ff       	call   800c48 <sys_page_alloc>
+  80340b:	83 c4 10             	add    $0x10,%esp
+  80340e:	85 c0                	test   %eax,%eax
+  803410:	0f 88 55 ff ff ff    	js     80336b <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  803416:	89 f3                	mov    %esi,%ebx
+  803418:	eb c5                	jmp    8033df <malloc+0x1b5>
+
+0080341a <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80341a:	55                   	push   %ebp
+  80341b:	89 e5                	mov    %esp,%ebp
+  80341d:	56                   	push   %esi
+  80341e:	53                   	push   %ebx
+  80341f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803422:	83 ec 0c             	sub    $0xc,%esp
+  803425:	ff 75 08             	push   0x8(%ebp)
+  803428:	e8 cd dc ff ff       	call   8010fa <fd2data>
+  80342d:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80342f:	83 c4 08             	add    $0x8,%esp
+  803432:	68 97 53 80 00       	push   $0x805397
+  803437:	53                   	push   %ebx
+  803438:	e8 cd d3 ff ff       	call   80080a <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  80343d:	8b 46 04             	mov    0x4(%esi),%eax
+  803440:	2b 06                	sub    (%esi),%eax
+  803442:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  803448:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80344f:	00 00 00 
+	stat->st_dev = &devpipe;
+  803452:	c7 83 88 00 00 00 7c 	movl   $0x80627c,0x88(%ebx)
+  803459:	62 80 00 
+	return 0;
+}
+  80345c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803461:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803464:	5b                   	pop    %ebx
+  803465:	5e                   	pop    %esi
+  803466:	5d                   	pop    %ebp
+  803467:	c3                   	ret
+
+00803468 <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  803468:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80346d:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  803471:	85 c9                	test   %ecx,%ecx
+  803473:	75 01                	jne    803476 <pipewake+0xe>
+  803475:	c3                   	ret
+{
+  803476:	55                   	push   %ebp
+  803477:	89 e5                	mov    %esp,%ebp
+  803479:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  80347c:	68 00 04 00 00       	push   $0x400
+  803481:	52                   	push   %edx
+  803482:	e8 05 db ff ff       	call   800f8c <sys_futex_wake>
+  803487:	83 c4 10             	add    $0x10,%esp
+}
+  80348a:	c9                   	leave
+  80348b:	c3                   	ret
+
+0080348c <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80348c:	55                   	push   %ebp
+  80348d:	89 e5                	mov    %esp,%ebp
+  80348f:	56                   	push   %esi
+  803490:	53                   	push   %ebx
+  803491:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803494:	83 ec 0c             	sub    $0xc,%esp
+  803497:	56                   	push   %esi
+  803498:	e8 5d dc ff ff       	call   8010fa <fd2data>
+  80349d:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  80349f:	83 c4 08             	add    $0x8,%esp
+  8034a2:	56                   	push   %esi
+  8034a3:	6a 00                	push   $0x0
+  8034a5:	e8 37 d8 ff ff       	call   800ce1 <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  8034aa:	8d 53 04             	lea    0x4(%ebx),%edx
+  8034ad:	8d 43 08             	lea    0x8(%ebx),%eax
+  8034b0:	e8 b3 ff ff ff       	call   803468 <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  8034b5:	8d 43 0c             	lea    0xc(%ebx),%eax
+  8034b8:	89 da                	mov    %ebx,%edx
+  8034ba:	e8 a9 ff ff ff       	call   803468 <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  8034bf:	89 34 24             	mov    %esi,(%esp)
+  8034c2:	e8 33 dc ff ff       	call   8010fa <fd2data>
+  8034c7:	83 c4 08             	add    $0x8,%esp
+  8034ca:	50                   	push   %eax
+  8034cb:	6a 00                	push   $0x0
+  8034cd:	e8 0f d8 ff ff       	call   800ce1 <sys_page_unmap>
+}
+  8034d2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8034d5:	5b                   	pop    %ebx
+  8034d6:	5e                   	pop    %esi
+  8034d7:	5d                   	pop    %ebp
+  8034d8:	c3                   	ret
+
+008034d9 <_pipeisclosed>:
+{
+  8034d9:	55                   	push   %ebp
+  8034da:	89 e5                	mov    %esp,%ebp
+  8034dc:	57                   	push   %edi
+  8034dd:	56                   	push   %esi
+  8034de:	53                   	push   %ebx
+  8034df:	83 ec 1c             	sub    $0x1c,%esp
+  8034e2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8034e5:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8034e7:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  8034ec:	eb 5d                	jmp    80354b <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  8034ee:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		n = thisenv->env_runs;
+  8034f4:	8b 02                	mov    (%edx),%eax
+  8034f6:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8034f9:	83 ec 0c             	sub    $0xc,%esp
+  8034fc:	ff 75 e0             	push   -0x20(%ebp)
+  8034ff:	e8 42 15 00 00       	call   804a46 <pageref>
+  803504:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803507:	89 3c 24             	mov    %edi,(%esp)
+  80350a:	e8 37 15 00 00       	call   804a46 <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  80350f:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803511:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  803517:	83 c4 10             	add    $0x10,%esp
+  80351a:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803520:	77 15                	ja     803537 <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803522:	89 f2                	mov    %esi,%edx
+  803524:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  803526:	c1 ea 10             	shr    $0x10,%edx
+  803529:	74 0c                	je     803537 <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80352b:	c1 e2 10             	shl    $0x10,%edx
+  80352e:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  803533:	29 d1                	sub    %edx,%ecx
+  803535:	eb 06                	jmp    80353d <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  803537:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		nn = thisenv->env_runs;
+  80353d:	8b 11                	mov    (%ecx),%edx
+  80353f:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  803542:	39 d3                	cmp    %edx,%ebx
+  803544:	74 6e                	je     8035b4 <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  803546:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803549:	74 24                	je     80356f <_pipeisclosed+0x96>
+  80354b:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80354d:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803553:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803558:	77 94                	ja     8034ee <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80355a:	89 f0                	mov    %esi,%eax
+  80355c:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80355e:	c1 e8 10             	shr    $0x10,%eax
+  803561:	74 8b                	je     8034ee <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803563:	c1 e0 10             	shl    $0x10,%eax
+  803566:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80356b:	29 c2                	sub    %eax,%edx
+  80356d:	eb 85                	jmp    8034f4 <_pipeisclosed+0x1b>
+  80356f:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803571:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803577:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80357c:	77 18                	ja     803596 <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80357e:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803583:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803585:	c1 e8 10             	shr    $0x10,%eax
+  803588:	74 0c                	je     803596 <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80358a:	c1 e0 10             	shl    $0x10,%eax
+  80358d:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803592:	29 c2                	sub    %eax,%edx
+  803594:	eb 06                	jmp    80359c <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  803596:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80359c:	8b 02                	mov    (%edx),%eax
+  80359e:	8b 40 58             	mov    0x58(%eax),%eax
+  8035a1:	6a 01                	push   $0x1
+  8035a3:	50                   	push   %eax
+  8035a4:	53                   	push   %ebx
+  8035a5:	68 9e 53 80 00       	push   $0x80539e
+  8035aa:	e8 77 cc ff ff       	call   800226 <cprintf>
+  8035af:	83 c4 10             	add    $0x10,%esp
+  8035b2:	eb 97                	jmp    80354b <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  8035b4:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8035b7:	0f 94 c0             	sete   %al
+  8035ba:	0f b6 c0             	movzbl %al,%eax
+}
+  8035bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8035c0:	5b                   	pop    %ebx
+  8035c1:	5e                   	pop    %esi
+  8035c2:	5f                   	pop    %edi
+  8035c3:	5d                   	pop    %ebp
+  8035c4:	c3                   	ret
+
+008035c5 <devpipe_write>:
+{
+  8035c5:	55                   	push   %ebp
+  8035c6:	89 e5                	mov    %esp,%ebp
+  8035c8:	57                   	push   %edi
+  8035c9:	56                   	push   %esi
+  8035ca:	53                   	push   %ebx
+  8035cb:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  8035ce:	ff 75 08             	push   0x8(%ebp)
+  8035d1:	e8 24 db ff ff       	call   8010fa <fd2data>
+  8035d6:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8035d8:	83 c4 10             	add    $0x10,%esp
+  8035db:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  8035e2:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  8035e5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8035e8:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8035eb:	0f 84 96 00 00 00    	je     803687 <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  8035f1:	8d 73 08             	lea    0x8(%ebx),%esi
+  8035f4:	eb 32                	jmp    803628 <devpipe_write+0x63>
+  8035f6:	89 fa                	mov    %edi,%edx
+  8035f8:	89 f0                	mov    %esi,%eax
+  8035fa:	e8 69 fe ff ff       	call   803468 <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  8035ff:	8b 43 04             	mov    0x4(%ebx),%eax
+  803602:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  803605:	ba 01 00 00 00       	mov    $0x1,%edx
+  80360a:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  80360f:	83 ec 04             	sub    $0x4,%esp
+  803612:	6a 0a                	push   $0xa
+  803614:	50                   	push   %eax
+  803615:	53                   	push   %ebx
+  803616:	e8 42 d9 ff ff       	call   800f5d <sys_futex_wait>
+  80361b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803620:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  803625:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  803628:	8b 43 04             	mov    0x4(%ebx),%eax
+  80362b:	8b 0b                	mov    (%ebx),%ecx
+  80362d:	8d 51 20             	lea    0x20(%ecx),%edx
+  803630:	39 d0                	cmp    %edx,%eax
+  803632:	72 1b                	jb     80364f <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  803634:	89 da                	mov    %ebx,%edx
+  803636:	8b 45 08             	mov    0x8(%ebp),%eax
+  803639:	e8 9b fe ff ff       	call   8034d9 <_pipeisclosed>
+  80363e:	85 c0                	test   %eax,%eax
+  803640:	74 b4                	je     8035f6 <devpipe_write+0x31>
+				return 0;
+  803642:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803647:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80364a:	5b                   	pop    %ebx
+  80364b:	5e                   	pop    %esi
+  80364c:	5f                   	pop    %edi
+  80364d:	5d                   	pop    %ebp
+  80364e:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80364f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803652:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803655:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  803659:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  80365c:	89 c2                	mov    %eax,%edx
+  80365e:	c1 fa 1f             	sar    $0x1f,%edx
+  803661:	89 d1                	mov    %edx,%ecx
+  803663:	c1 e9 1b             	shr    $0x1b,%ecx
+  803666:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  803669:	83 e2 1f             	and    $0x1f,%edx
+  80366c:	29 ca                	sub    %ecx,%edx
+  80366e:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  803672:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  803676:	83 c0 01             	add    $0x1,%eax
+  803679:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  80367c:	83 c6 01             	add    $0x1,%esi
+  80367f:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803682:	e9 5e ff ff ff       	jmp    8035e5 <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  803687:	8d 53 04             	lea    0x4(%ebx),%edx
+  80368a:	8d 43 08             	lea    0x8(%ebx),%eax
+  80368d:	e8 d6 fd ff ff       	call   803468 <pipewake>
+	return i;
+  803692:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803695:	eb b0                	jmp    803647 <devpipe_write+0x82>
+
+00803697 <devpipe_read>:
+{
+  803697:	55                   	push   %ebp
+  803698:	89 e5                	mov    %esp,%ebp
+  80369a:	57                   	push   %edi
+  80369b:	56                   	push   %esi
+  80369c:	53                   	push   %ebx
+  80369d:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  8036a0:	ff 75 08             	push   0x8(%ebp)
+  8036a3:	e8 52 da ff ff       	call   8010fa <fd2data>
+  8036a8:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8036aa:	83 c4 10             	add    $0x10,%esp
+  8036ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8036b2:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8036b5:	74 6c                	je     803723 <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  8036b7:	8d 7b 04             	lea    0x4(%ebx),%edi
+  8036ba:	eb 25                	jmp    8036e1 <devpipe_read+0x4a>
+  8036bc:	8b 13                	mov    (%ebx),%edx
+  8036be:	b8 01 00 00 00       	mov    $0x1,%eax
+  8036c3:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  8036c8:	83 ec 04             	sub    $0x4,%esp
+  8036cb:	6a 0a                	push   $0xa
+  8036cd:	52                   	push   %edx
+  8036ce:	57                   	push   %edi
+  8036cf:	e8 89 d8 ff ff       	call   800f5d <sys_futex_wait>
+  8036d4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8036d9:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  8036de:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  8036e1:	8b 03                	mov    (%ebx),%eax
+  8036e3:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8036e6:	75 19                	jne    803701 <devpipe_read+0x6a>
+			if (i > 0)
+  8036e8:	85 f6                	test   %esi,%esi
+  8036ea:	75 3a                	jne    803726 <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  8036ec:	89 da                	mov    %ebx,%edx
+  8036ee:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036f1:	e8 e3 fd ff ff       	call   8034d9 <_pipeisclosed>
+  8036f6:	85 c0                	test   %eax,%eax
+  8036f8:	74 c2                	je     8036bc <devpipe_read+0x25>
+				return 0;
+  8036fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036ff:	eb 31                	jmp    803732 <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803701:	89 c1                	mov    %eax,%ecx
+  803703:	c1 f9 1f             	sar    $0x1f,%ecx
+  803706:	c1 e9 1b             	shr    $0x1b,%ecx
+  803709:	01 c8                	add    %ecx,%eax
+  80370b:	83 e0 1f             	and    $0x1f,%eax
+  80370e:	29 c8                	sub    %ecx,%eax
+  803710:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  803715:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803718:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80371b:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80371e:	83 c6 01             	add    $0x1,%esi
+  803721:	eb 8f                	jmp    8036b2 <devpipe_read+0x1b>
+out:
+  803723:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  803726:	8d 43 0c             	lea    0xc(%ebx),%eax
+  803729:	89 da                	mov    %ebx,%edx
+  80372b:	e8 38 fd ff ff       	call   803468 <pipewake>
+	return i;
+  803730:	89 f0                	mov    %esi,%eax
+}
+  803732:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803735:	5b                   	pop    %ebx
+  803736:	5e                   	pop    %esi
+  803737:	5f                   	pop    %edi
+  803738:	5d                   	pop    %ebp
+  803739:	c3                   	ret
+
+0080373a <pipe>:
+{
+  80373a:	55                   	push   %ebp
+  80373b:	89 e5                	mov    %esp,%ebp
+  80373d:	56                   	push   %esi
+  80373e:	53                   	push   %ebx
+  80373f:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803742:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803745:	50                   	push   %eax
+  803746:	e8 c6 d9 ff ff       	call   801111 <fd_alloc>
+  80374b:	89 c3                	mov    %eax,%ebx
+  80374d:	83 c4 10             	add    $0x10,%esp
+  803750:	85 c0                	test   %eax,%eax
+  803752:	0f 88 23 01 00 00    	js     80387b <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803758:	83 ec 04             	sub    $0x4,%esp
+  80375b:	68 07 04 00 00       	push   $0x407
+  803760:	ff 75 f4             	push   -0xc(%ebp)
+  803763:	6a 00                	push   $0x0
+  803765:	e8 de d4 ff ff       	call   800c48 <sys_page_alloc>
+  80376a:	89 c3                	mov    %eax,%ebx
+  80376c:	83 c4 10             	add    $0x10,%esp
+  80376f:	85 c0                	test   %eax,%eax
+  803771:	0f 88 04 01 00 00    	js     80387b <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803777:	83 ec 0c             	sub    $0xc,%esp
+  80377a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80377d:	50                   	push   %eax
+  80377e:	e8 8e d9 ff ff       	call   801111 <fd_alloc>
+  803783:	89 c3                	mov    %eax,%ebx
+  803785:	83 c4 10             	add    $0x10,%esp
+  803788:	85 c0                	test   %eax,%eax
+  80378a:	0f 88 db 00 00 00    	js     80386b <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803790:	83 ec 04             	sub    $0x4,%esp
+  803793:	68 07 04 00 00       	push   $0x407
+  803798:	ff 75 f0             	push   -0x10(%ebp)
+  80379b:	6a 00                	push   $0x0
+  80379d:	e8 a6 d4 ff ff       	call   800c48 <sys_page_alloc>
+  8037a2:	89 c3                	mov    %eax,%ebx
+  8037a4:	83 c4 10             	add    $0x10,%esp
+  8037a7:	85 c0                	test   %eax,%eax
+  8037a9:	0f 88 bc 00 00 00    	js     80386b <pipe+0x131>
+	va = fd2data(fd0);
+  8037af:	83 ec 0c             	sub    $0xc,%esp
+  8037b2:	ff 75 f4             	push   -0xc(%ebp)
+  8037b5:	e8 40 d9 ff ff       	call   8010fa <fd2data>
+  8037ba:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8037bc:	83 c4 0c             	add    $0xc,%esp
+  8037bf:	68 07 04 00 00       	push   $0x407
+  8037c4:	50                   	push   %eax
+  8037c5:	6a 00                	push   $0x0
+  8037c7:	e8 7c d4 ff ff       	call   800c48 <sys_page_alloc>
+  8037cc:	89 c3                	mov    %eax,%ebx
+  8037ce:	83 c4 10             	add    $0x10,%esp
+  8037d1:	85 c0                	test   %eax,%eax
+  8037d3:	0f 88 82 00 00 00    	js     80385b <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8037d9:	83 ec 0c             	sub    $0xc,%esp
+  8037dc:	ff 75 f0             	push   -0x10(%ebp)
+  8037df:	e8 16 d9 ff ff       	call   8010fa <fd2data>
+  8037e4:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8037eb:	50                   	push   %eax
+  8037ec:	6a 00                	push   $0x0
+  8037ee:	56                   	push   %esi
+  8037ef:	6a 00                	push   $0x0
+  8037f1:	e8 9f d4 ff ff       	call   800c95 <sys_page_map>
+  8037f6:	89 c3                	mov    %eax,%ebx
+  8037f8:	83 c4 20             	add    $0x20,%esp
+  8037fb:	85 c0                	test   %eax,%eax
+  8037fd:	78 4e                	js     80384d <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8037ff:	a1 7c 62 80 00       	mov    0x80627c,%eax
+  803804:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803807:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803809:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80380c:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803813:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803816:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803818:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80381b:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803822:	83 ec 0c             	sub    $0xc,%esp
+  803825:	ff 75 f4             	push   -0xc(%ebp)
+  803828:	e8 bd d8 ff ff       	call   8010ea <fd2num>
+  80382d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803830:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803832:	83 c4 04             	add    $0x4,%esp
+  803835:	ff 75 f0             	push   -0x10(%ebp)
+  803838:	e8 ad d8 ff ff       	call   8010ea <fd2num>
+  80383d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803840:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803843:	83 c4 10             	add    $0x10,%esp
+  803846:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80384b:	eb 2e                	jmp    80387b <pipe+0x141>
+	sys_page_unmap(0, va);
+  80384d:	83 ec 08             	sub    $0x8,%esp
+  803850:	56                   	push   %esi
+  803851:	6a 00                	push   $0x0
+  803853:	e8 89 d4 ff ff       	call   800ce1 <sys_page_unmap>
+  803858:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80385b:	83 ec 08             	sub    $0x8,%esp
+  80385e:	ff 75 f0             	push   -0x10(%ebp)
+  803861:	6a 00                	push   $0x0
+  803863:	e8 79 d4 ff ff       	call   800ce1 <sys_page_unmap>
+  803868:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80386b:	83 ec 08             	sub    $0x8,%esp
+  80386e:	ff 75 f4             	push   -0xc(%ebp)
+  803871:	6a 00                	push   $0x0
+  803873:	e8 69 d4 ff ff       	call   800ce1 <sys_page_unmap>
+  803878:	83 c4 10             	add    $0x10,%esp
+}
+  80387b:	89 d8                	mov    %ebx,%eax
+  80387d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803880:	5b                   	pop    %ebx
+  803881:	5e                   	pop    %esi
+  803882:	5d                   	pop    %ebp
+  803883:	c3                   	ret
+
+00803884 <pipeisclosed>:
+{
+  803884:	55                   	push   %ebp
+  803885:	89 e5                	mov    %esp,%ebp
+  803887:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80388a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80388d:	50                   	push   %eax
+  80388e:	ff 75 08             	push   0x8(%ebp)
+  803891:	e8 d1 d8 ff ff       	call   801167 <fd_lookup>
+  803896:	83 c4 10             	add    $0x10,%esp
+  803899:	85 c0                	test   %eax,%eax
+  80389b:	78 18                	js     8038b5 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80389d:	83 ec 0c             	sub    $0xc,%esp
+  8038a0:	ff 75 f4             	push   -0xc(%ebp)
+  8038a3:	e8 52 d8 ff ff       	call   8010fa <fd2data>
+  8038a8:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8038aa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8038ad:	e8 27 fc ff ff       	call   8034d9 <_pipeisclosed>
+  8038b2:	83 c4 10             	add    $0x10,%esp
+}
+  8038b5:	c9                   	leave
+  8038b6:	c3                   	ret
+
+008038b7 <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  8038b7:	55                   	push   %ebp
+  8038b8:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  8038ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8038bd:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8038c3:	5d                   	pop    %ebp
+  8038c4:	c3                   	ret
+
+008038c5 <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  8038c5:	55                   	push   %ebp
+  8038c6:	89 e5                	mov    %esp,%ebp
+  8038c8:	56                   	push   %esi
+  8038c9:	53                   	push   %ebx
+  8038ca:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  8038cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8038d2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8038d7:	89 d0                	mov    %edx,%eax
+  8038d9:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  8038dd:	85 c0                	test   %eax,%eax
+  8038df:	74 2d                	je     80390e <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  8038e1:	83 f8 02             	cmp    $0x2,%eax
+  8038e4:	74 08                	je     8038ee <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  8038e6:	b8 02 00 00 00       	mov    $0x2,%eax
+  8038eb:	f0 87 03             	lock xchg %eax,(%ebx)
+  8038ee:	be 02 00 00 00       	mov    $0x2,%esi
+  8038f3:	eb 15                	jmp    80390a <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  8038f5:	83 ec 04             	sub    $0x4,%esp
+  8038f8:	6a 00                	push   $0x0
+  8038fa:	6a 02                	push   $0x2
+  8038fc:	53                   	push   %ebx
+  8038fd:	e8 5b d6 ff ff       	call   800f5d <sys_futex_wait>
+  803902:	89 f0                	mov    %esi,%eax
+  803904:	f0 87 03             	lock xchg %eax,(%ebx)
+  803907:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  80390a:	85 c0                	test   %eax,%eax
+  80390c:	75 e7                	jne    8038f5 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  80390e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803911:	5b                   	pop    %ebx
+  803912:	5e                   	pop    %esi
+  803913:	5d                   	pop    %ebp
+  803914:	c3                   	ret
+
+00803915 <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  803915:	55                   	push   %ebp
+  803916:	89 e5                	mov    %esp,%ebp
+  803918:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  80391b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803920:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803925:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  803929:	f7 d8                	neg    %eax
+  80392b:	19 c0                	sbb    %eax,%eax
+  80392d:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  803930:	5d                   	pop    %ebp
+  803931:	c3                   	ret
+
+00803932 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  803932:	55                   	push   %ebp
+  803933:	89 e5                	mov    %esp,%ebp
+  803935:	83 ec 08             	sub    $0x8,%esp
+  803938:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  80393b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803940:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  803943:	83 f8 02             	cmp    $0x2,%eax
+  803946:	74 02                	je     80394a <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  803948:	c9                   	leave
+  803949:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  80394a:	83 ec 08             	sub    $0x8,%esp
+  80394d:	6a 01                	push   $0x1
+  80394f:	52                   	push   %edx
+  803950:	e8 37 d6 ff ff       	call   800f8c <sys_futex_wake>
+  803955:	83 c4 10             	add    $0x10,%esp
+}
+  803958:	eb ee                	jmp    803948 <mutex_unlock+0x16>
+
+0080395a <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  80395a:	55                   	push   %ebp
+  80395b:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  80395d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803960:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803966:	5d                   	pop    %ebp
+  803967:	c3                   	ret
+
+00803968 <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  803968:	55                   	push   %ebp
+  803969:	89 e5                	mov    %esp,%ebp
+  80396b:	57                   	push   %edi
+  80396c:	56                   	push   %esi
+  80396d:	53                   	push   %ebx
+  80396e:	83 ec 18             	sub    $0x18,%esp
+  803971:	8b 75 08             	mov    0x8(%ebp),%esi
+  803974:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  803977:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  803979:	53                   	push   %ebx
+  80397a:	e8 b3 ff ff ff       	call   803932 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  80397f:	83 c4 0c             	add    $0xc,%esp
+  803982:	ff 75 10             	push   0x10(%ebp)
+  803985:	57                   	push   %edi
+  803986:	56                   	push   %esi
+  803987:	e8 d1 d5 ff ff       	call   800f5d <sys_futex_wait>
+  80398c:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  80398e:	83 c4 10             	add    $0x10,%esp
+  803991:	be 02 00 00 00       	mov    $0x2,%esi
+  803996:	eb 10                	jmp    8039a8 <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  803998:	83 ec 04             	sub    $0x4,%esp
+  80399b:	6a 00                	push   $0x0
+  80399d:	6a 02                	push   $0x2
+  80399f:	53                   	push   %ebx
+  8039a0:	e8 b8 d5 ff ff       	call   800f5d <sys_futex_wait>
+  8039a5:	83 c4 10             	add    $0x10,%esp
+  8039a8:	89 f0                	mov    %esi,%eax
+  8039aa:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  8039ad:	85 c0                	test   %eax,%eax
+  8039af:	75 e7                	jne    803998 <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  8039b1:	83 ff ec             	cmp    $0xffffffec,%edi
+  8039b4:	74 05                	je     8039bb <cond_timedwait+0x53>
+  8039b6:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  8039bb:	89 f8                	mov    %edi,%eax
+  8039bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8039c0:	5b                   	pop    %ebx
+  8039c1:	5e                   	pop    %esi
+  8039c2:	5f                   	pop    %edi
+  8039c3:	5d                   	pop    %ebp
+  8039c4:	c3                   	ret
+
+008039c5 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  8039c5:	55                   	push   %ebp
+  8039c6:	89 e5                	mov    %esp,%ebp
+  8039c8:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  8039cb:	6a 00                	push   $0x0
+  8039cd:	ff 75 0c             	push   0xc(%ebp)
+  8039d0:	ff 75 08             	push   0x8(%ebp)
+  8039d3:	e8 90 ff ff ff       	call   803968 <cond_timedwait>
+}
+  8039d8:	83 c4 10             	add    $0x10,%esp
+  8039db:	c9                   	leave
+  8039dc:	c3                   	ret
+
+008039dd <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  8039dd:	55                   	push   %ebp
+  8039de:	89 e5                	mov    %esp,%ebp
+  8039e0:	83 ec 10             	sub    $0x10,%esp
+  8039e3:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  8039e6:	ba 01 00 00 00       	mov    $0x1,%edx
+  8039eb:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  8039ef:	6a 01                	push   $0x1
+  8039f1:	50                   	push   %eax
+  8039f2:	e8 95 d5 ff ff       	call   800f8c <sys_futex_wake>
+}
+  8039f7:	83 c4 10             	add    $0x10,%esp
+  8039fa:	c9                   	leave
+  8039fb:	c3                   	ret
+
+008039fc <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  8039fc:	55                   	push   %ebp
+  8039fd:	89 e5                	mov    %esp,%ebp
+  8039ff:	83 ec 10             	sub    $0x10,%esp
+  803a02:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a05:	ba 01 00 00 00       	mov    $0x1,%edx
+  803a0a:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  803a0e:	68 00 04 00 00       	push   $0x400
+  803a13:	50                   	push   %eax
+  803a14:	e8 73 d5 ff ff       	call   800f8c <sys_futex_wake>
+}
+  803a19:	83 c4 10             	add    $0x10,%esp
+  803a1c:	c9                   	leave
+  803a1d:	c3                   	ret
+
+00803a1e <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  803a1e:	55                   	push   %ebp
+  803a1f:	89 e5                	mov    %esp,%ebp
+  803a21:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  803a24:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803a27:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  803a29:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  803a30:	5d                   	pop    %ebp
+  803a31:	c3                   	ret
+
+00803a32 <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  803a32:	55                   	push   %ebp
+  803a33:	89 e5                	mov    %esp,%ebp
+  803a35:	53                   	push   %ebx
+  803a36:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  803a39:	8b 11                	mov    (%ecx),%edx
+  803a3b:	85 d2                	test   %edx,%edx
+  803a3d:	74 14                	je     803a53 <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  803a3f:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803a42:	89 d0                	mov    %edx,%eax
+  803a44:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  803a48:	39 c2                	cmp    %eax,%edx
+  803a4a:	75 ed                	jne    803a39 <sem_trywait+0x7>
+			return 0;
+  803a4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a51:	eb 05                	jmp    803a58 <sem_trywait+0x26>
+	return -E_AGAIN;
+  803a53:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  803a58:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803a5b:	c9                   	leave
+  803a5c:	c3                   	ret
+
+00803a5d <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  803a5d:	55                   	push   %ebp
+  803a5e:	89 e5                	mov    %esp,%ebp
+  803a60:	57                   	push   %edi
+  803a61:	56                   	push   %esi
+  803a62:	53                   	push   %ebx
+  803a63:	83 ec 1c             	sub    $0x1c,%esp
+  803a66:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803a69:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  803a6c:	e8 64 d4 ff ff       	call   800ed5 <sys_time_msec>
+  803a71:	01 f8                	add    %edi,%eax
+  803a73:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  803a76:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  803a7b:	eb 28                	jmp    803aa5 <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  803a7d:	b8 01 00 00 00       	mov    $0x1,%eax
+  803a82:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  803a87:	83 ec 04             	sub    $0x4,%esp
+  803a8a:	56                   	push   %esi
+  803a8b:	6a 00                	push   $0x0
+  803a8d:	53                   	push   %ebx
+  803a8e:	e8 ca d4 ff ff       	call   800f5d <sys_futex_wait>
+  803a93:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  803a98:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  803a9d:	83 c4 10             	add    $0x10,%esp
+  803aa0:	83 f8 ec             	cmp    $0xffffffec,%eax
+  803aa3:	74 2e                	je     803ad3 <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  803aa5:	83 ec 0c             	sub    $0xc,%esp
+  803aa8:	53                   	push   %ebx
+  803aa9:	e8 84 ff ff ff       	call   803a32 <sem_trywait>
+  803aae:	83 c4 10             	add    $0x10,%esp
+  803ab1:	85 c0                	test   %eax,%eax
+  803ab3:	79 19                	jns    803ace <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  803ab5:	85 ff                	test   %edi,%edi
+  803ab7:	74 c4                	je     803a7d <sem_timedwait+0x20>
+  803ab9:	e8 17 d4 ff ff       	call   800ed5 <sys_time_msec>
+  803abe:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803ac1:	29 c6                	sub    %eax,%esi
+  803ac3:	85 f6                	test   %esi,%esi
+  803ac5:	7f b6                	jg     803a7d <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  803ac7:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  803acc:	eb 05                	jmp    803ad3 <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  803ace:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ad3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ad6:	5b                   	pop    %ebx
+  803ad7:	5e                   	pop    %esi
+  803ad8:	5f                   	pop    %edi
+  803ad9:	5d                   	pop    %ebp
+  803ada:	c3                   	ret
+
+00803adb <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  803adb:	55                   	push   %ebp
+  803adc:	89 e5                	mov    %esp,%ebp
+  803ade:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  803ae1:	6a 00                	push   $0x0
+  803ae3:	ff 75 08             	push   0x8(%ebp)
+  803ae6:	e8 72 ff ff ff       	call   803a5d <sem_timedwait>
+}
+  803aeb:	83 c4 10             	add    $0x10,%esp
+  803aee:	c9                   	leave
+  803aef:	c3                   	ret
+
+00803af0 <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  803af0:	55                   	push   %ebp
+  803af1:	89 e5                	mov    %esp,%ebp
+  803af3:	83 ec 08             	sub    $0x8,%esp
+  803af6:	8b 45 08             	mov    0x8(%ebp),%eax
+  803af9:	ba 01 00 00 00       	mov    $0x1,%edx
+  803afe:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  803b02:	8b 50 04             	mov    0x4(%eax),%edx
+  803b05:	85 d2                	test   %edx,%edx
+  803b07:	75 02                	jne    803b0b <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  803b09:	c9                   	leave
+  803b0a:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  803b0b:	83 ec 08             	sub    $0x8,%esp
+  803b0e:	6a 01                	push   $0x1
+  803b10:	50                   	push   %eax
+  803b11:	e8 76 d4 ff ff       	call   800f8c <sys_futex_wake>
+  803b16:	83 c4 10             	add    $0x10,%esp
+}
+  803b19:	eb ee                	jmp    803b09 <sem_post+0x19>
+
+00803b1b <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  803b1b:	55                   	push   %ebp
+  803b1c:	89 e5                	mov    %esp,%ebp
+  803b1e:	57                   	push   %edi
+  803b1f:	56                   	push   %esi
+  803b20:	53                   	push   %ebx
+  803b21:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  803b24:	68 20 70 80 00       	push   $0x807020
+  803b29:	e8 97 fd ff ff       	call   8038c5 <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  803b2e:	a1 44 70 80 00       	mov    0x807044,%eax
+  803b33:	83 c4 10             	add    $0x10,%esp
+  803b36:	85 c0                	test   %eax,%eax
+  803b38:	75 19                	jne    803b53 <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  803b3a:	a1 c0 72 80 00       	mov    0x8072c0,%eax
+  803b3f:	8b 00                	mov    (%eax),%eax
+  803b41:	8b 40 48             	mov    0x48(%eax),%eax
+  803b44:	a3 40 70 80 00       	mov    %eax,0x807040
+		threads[0].th_state = PTH_RUNNING;
+  803b49:	c7 05 44 70 80 00 01 	movl   $0x1,0x807044
+  803b50:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803b53:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  803b58:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803b5b:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803b62:	8b 40 04             	mov    0x4(%eax),%eax
+  803b65:	85 c0                	test   %eax,%eax
+  803b67:	0f 84 e4 00 00 00    	je     803c51 <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803b6d:	83 c3 01             	add    $0x1,%ebx
+  803b70:	83 fb 20             	cmp    $0x20,%ebx
+  803b73:	75 e3                	jne    803b58 <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  803b75:	83 ec 0c             	sub    $0xc,%esp
+  803b78:	68 20 70 80 00       	push   $0x807020
+  803b7d:	e8 b0 fd ff ff       	call   803932 <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  803b82:	83 c4 10             	add    $0x10,%esp
+  803b85:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  803b8a:	e9 b8 00 00 00       	jmp    803c47 <pthread_create+0x12c>
+  803b8f:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  803b92:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  803b95:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  803b97:	39 f3                	cmp    %esi,%ebx
+  803b99:	73 16                	jae    803bb1 <pthread_create+0x96>
+		va -= PGSIZE;
+  803b9b:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  803ba1:	83 ec 08             	sub    $0x8,%esp
+  803ba4:	56                   	push   %esi
+  803ba5:	6a 00                	push   $0x0
+  803ba7:	e8 35 d1 ff ff       	call   800ce1 <sys_page_unmap>
+  803bac:	83 c4 10             	add    $0x10,%esp
+  803baf:	eb e6                	jmp    803b97 <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  803bb1:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803bb4:	83 ec 08             	sub    $0x8,%esp
+  803bb7:	ff 75 e4             	push   -0x1c(%ebp)
+  803bba:	6a 00                	push   $0x0
+  803bbc:	e8 20 d1 ff ff       	call   800ce1 <sys_page_unmap>
+	return r;
+  803bc1:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  803bc4:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803bc7:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803bce:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  803bd5:	eb 70                	jmp    803c47 <pthread_create+0x12c>
+	th->th_fn = fn;
+  803bd7:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803bda:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803be1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803be4:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  803be7:	8b 55 10             	mov    0x10(%ebp),%edx
+  803bea:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  803bed:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  803bf4:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  803bf9:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803bfc:	29 c8                	sub    %ecx,%eax
+  803bfe:	85 db                	test   %ebx,%ebx
+  803c00:	0f 44 05 c0 72 80 00 	cmove  0x8072c0,%eax
+	*--esp = t;
+  803c07:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  803c0a:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803c11:	83 ec 04             	sub    $0x4,%esp
+  803c14:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803c19:	29 ca                	sub    %ecx,%edx
+  803c1b:	52                   	push   %edx
+	*--esp = 0;
+  803c1c:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803c1f:	50                   	push   %eax
+  803c20:	68 78 3e 80 00       	push   $0x803e78
+  803c25:	e8 07 d4 ff ff       	call   801031 <sys_thread_create>
+  803c2a:	89 c7                	mov    %eax,%edi
+  803c2c:	83 c4 10             	add    $0x10,%esp
+  803c2f:	85 c0                	test   %eax,%eax
+  803c31:	78 91                	js     803bc4 <pthread_create+0xa9>
+	th->th_env = id;
+  803c33:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803c36:	89 3c 85 40 70 80 00 	mov    %edi,0x807040(,%eax,4)
+	*tp = t;
+  803c3d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803c40:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  803c42:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803c47:	89 f8                	mov    %edi,%eax
+  803c49:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c4c:	5b                   	pop    %ebx
+  803c4d:	5e                   	pop    %esi
+  803c4e:	5f                   	pop    %edi
+  803c4f:	5d                   	pop    %ebp
+  803c50:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  803c51:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803c54:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803c5b:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  803c62:	83 ec 0c             	sub    $0xc,%esp
+  803c65:	68 20 70 80 00       	push   $0x807020
+  803c6a:	e8 c3 fc ff ff       	call   803932 <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  803c6f:	89 d9                	mov    %ebx,%ecx
+  803c71:	c1 e1 10             	shl    $0x10,%ecx
+  803c74:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  803c77:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  803c7c:	29 c8                	sub    %ecx,%eax
+  803c7e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  803c81:	c1 e8 16             	shr    $0x16,%eax
+  803c84:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803c8b:	83 c4 10             	add    $0x10,%esp
+  803c8e:	a8 01                	test   $0x1,%al
+  803c90:	74 15                	je     803ca7 <pthread_create+0x18c>
+  803c92:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803c95:	c1 e8 0c             	shr    $0xc,%eax
+  803c98:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803c9f:	a8 01                	test   $0x1,%al
+  803ca1:	0f 85 30 ff ff ff    	jne    803bd7 <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803ca7:	83 ec 04             	sub    $0x4,%esp
+  803caa:	6a 07                	push   $0x7
+  803cac:	ff 75 e4             	push   -0x1c(%ebp)
+  803caf:	6a 00                	push   $0x0
+  803cb1:	e8 92 cf ff ff       	call   800c48 <sys_page_alloc>
+  803cb6:	89 c7                	mov    %eax,%edi
+  803cb8:	83 c4 10             	add    $0x10,%esp
+  803cbb:	85 c0                	test   %eax,%eax
+  803cbd:	0f 88 01 ff ff ff    	js     803bc4 <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  803cc3:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  803cc8:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  803ccb:	29 d0                	sub    %edx,%eax
+  803ccd:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  803cd0:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803cd2:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  803cd7:	29 d0                	sub    %edx,%eax
+  803cd9:	89 c7                	mov    %eax,%edi
+  803cdb:	39 fe                	cmp    %edi,%esi
+  803cdd:	0f 83 f4 fe ff ff    	jae    803bd7 <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803ce3:	83 ec 04             	sub    $0x4,%esp
+  803ce6:	6a 07                	push   $0x7
+  803ce8:	56                   	push   %esi
+  803ce9:	6a 00                	push   $0x0
+  803ceb:	e8 58 cf ff ff       	call   800c48 <sys_page_alloc>
+  803cf0:	83 c4 10             	add    $0x10,%esp
+  803cf3:	85 c0                	test   %eax,%eax
+  803cf5:	0f 88 94 fe ff ff    	js     803b8f <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803cfb:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803d01:	eb d8                	jmp    803cdb <pthread_create+0x1c0>
+
+00803d03 <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  803d03:	55                   	push   %ebp
+  803d04:	89 e5                	mov    %esp,%ebp
+  803d06:	57                   	push   %edi
+  803d07:	56                   	push   %esi
+  803d08:	53                   	push   %ebx
+  803d09:	83 ec 0c             	sub    $0xc,%esp
+  803d0c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  803d0f:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  803d12:	83 f8 1e             	cmp    $0x1e,%eax
+  803d15:	0f 87 c7 00 00 00    	ja     803de2 <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  803d1b:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803d1d:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803d23:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803d28:	77 12                	ja     803d3c <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803d2a:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803d2f:	29 d0                	sub    %edx,%eax
+  803d31:	c1 e8 10             	shr    $0x10,%eax
+  803d34:	39 c3                	cmp    %eax,%ebx
+  803d36:	0f 84 ad 00 00 00    	je     803de9 <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803d3c:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803d3f:	8d 3c 85 44 70 80 00 	lea    0x807044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  803d46:	8d 34 85 40 70 80 00 	lea    0x807040(,%eax,4),%esi
+  803d4d:	eb 10                	jmp    803d5f <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803d4f:	83 ec 04             	sub    $0x4,%esp
+  803d52:	6a 00                	push   $0x0
+  803d54:	6a 01                	push   $0x1
+  803d56:	57                   	push   %edi
+  803d57:	e8 01 d2 ff ff       	call   800f5d <sys_futex_wait>
+  803d5c:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  803d5f:	8b 46 04             	mov    0x4(%esi),%eax
+  803d62:	83 f8 01             	cmp    $0x1,%eax
+  803d65:	74 e8                	je     803d4f <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  803d67:	83 f8 02             	cmp    $0x2,%eax
+  803d6a:	0f 85 80 00 00 00    	jne    803df0 <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  803d70:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  803d73:	c1 e6 02             	shl    $0x2,%esi
+  803d76:	eb 05                	jmp    803d7d <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  803d78:	e8 9f ce ff ff       	call   800c1c <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  803d7d:	8b 8e 40 70 80 00    	mov    0x807040(%esi),%ecx
+  803d83:	89 ca                	mov    %ecx,%edx
+  803d85:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  803d8b:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803d8e:	c1 e0 04             	shl    $0x4,%eax
+  803d91:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803d96:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  803d99:	39 c1                	cmp    %eax,%ecx
+  803d9b:	75 12                	jne    803daf <pthread_join+0xac>
+  803d9d:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803da0:	c1 e0 04             	shl    $0x4,%eax
+  803da3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803da8:	8b 40 54             	mov    0x54(%eax),%eax
+  803dab:	85 c0                	test   %eax,%eax
+  803dad:	75 c9                	jne    803d78 <pthread_join+0x75>
+	if (ret_store)
+  803daf:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803db3:	74 0f                	je     803dc4 <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  803db5:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803db8:	8b 04 85 50 70 80 00 	mov    0x807050(,%eax,4),%eax
+  803dbf:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803dc2:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  803dc4:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803dc7:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803dce:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  803dd5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803dda:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ddd:	5b                   	pop    %ebx
+  803dde:	5e                   	pop    %esi
+  803ddf:	5f                   	pop    %edi
+  803de0:	5d                   	pop    %ebp
+  803de1:	c3                   	ret
+		return -E_INVAL;
+  803de2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803de7:	eb f1                	jmp    803dda <pthread_join+0xd7>
+  803de9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803dee:	eb ea                	jmp    803dda <pthread_join+0xd7>
+		return -E_INVAL;
+  803df0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803df5:	eb e3                	jmp    803dda <pthread_join+0xd7>
+
+00803df7 <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  803df7:	55                   	push   %ebp
+  803df8:	89 e5                	mov    %esp,%ebp
+  803dfa:	53                   	push   %ebx
+  803dfb:	83 ec 04             	sub    $0x4,%esp
+  803dfe:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803e00:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803e06:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803e0b:	77 0c                	ja     803e19 <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803e0d:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803e12:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  803e14:	c1 e8 10             	shr    $0x10,%eax
+  803e17:	75 0a                	jne    803e23 <pthread_exit+0x2c>
+		exit();
+  803e19:	e8 05 c3 ff ff       	call   800123 <exit>
+  803e1e:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  803e23:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  803e2a:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  803e2d:	8d 0c 8d 40 70 80 00 	lea    0x807040(,%ecx,4),%ecx
+  803e34:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803e37:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  803e3a:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  803e41:	83 ec 08             	sub    $0x8,%esp
+  803e44:	6a 20                	push   $0x20
+  803e46:	01 c2                	add    %eax,%edx
+  803e48:	8d 04 95 44 70 80 00 	lea    0x807044(,%edx,4),%eax
+  803e4f:	50                   	push   %eax
+  803e50:	e8 37 d1 ff ff       	call   800f8c <sys_futex_wake>
+	sys_env_destroy(0);
+  803e55:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  803e5c:	e8 44 cd ff ff       	call   800ba5 <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  803e61:	83 c4 0c             	add    $0xc,%esp
+  803e64:	68 b6 53 80 00       	push   $0x8053b6
+  803e69:	68 a5 00 00 00       	push   $0xa5
+  803e6e:	68 d0 53 80 00       	push   $0x8053d0
+  803e73:	e8 d3 c2 ff ff       	call   80014b <_panic>
+
+00803e78 <pthread_start>:
+{
+  803e78:	55                   	push   %ebp
+  803e79:	89 e5                	mov    %esp,%ebp
+  803e7b:	53                   	push   %ebx
+  803e7c:	83 ec 04             	sub    $0x4,%esp
+  803e7f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  803e82:	e8 69 cd ff ff       	call   800bf0 <sys_getenvid>
+  803e87:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  803e8c:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+	if (t == 0)
+  803e92:	85 db                	test   %ebx,%ebx
+  803e94:	74 0c                	je     803ea2 <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803e96:	89 d9                	mov    %ebx,%ecx
+  803e98:	c1 e1 10             	shl    $0x10,%ecx
+  803e9b:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803ea0:	29 ca                	sub    %ecx,%edx
+  803ea2:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  803ea5:	c1 e0 04             	shl    $0x4,%eax
+  803ea8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803ead:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  803eaf:	83 ec 0c             	sub    $0xc,%esp
+  803eb2:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803eb9:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803ebc:	ff 34 95 4c 70 80 00 	push   0x80704c(,%edx,4)
+  803ec3:	ff 14 95 48 70 80 00 	call   *0x807048(,%edx,4)
+  803eca:	89 04 24             	mov    %eax,(%esp)
+  803ecd:	e8 25 ff ff ff       	call   803df7 <pthread_exit>
+
+00803ed2 <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  803ed2:	55                   	push   %ebp
+  803ed3:	89 e5                	mov    %esp,%ebp
+  803ed5:	57                   	push   %edi
+  803ed6:	56                   	push   %esi
+  803ed7:	53                   	push   %ebx
+  803ed8:	83 ec 1c             	sub    $0x1c,%esp
+  803edb:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803edd:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  803ee3:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803eea:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803eef:	77 0d                	ja     803efe <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803ef1:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803ef6:	29 d0                	sub    %edx,%eax
+  803ef8:	c1 e8 10             	shr    $0x10,%eax
+  803efb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  803efe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803f03:	eb 2f                	jmp    803f34 <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  803f05:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803f0b:	8b 01                	mov    (%ecx),%eax
+  803f0d:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  803f10:	39 c2                	cmp    %eax,%edx
+  803f12:	75 14                	jne    803f28 <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  803f14:	83 ec 0c             	sub    $0xc,%esp
+  803f17:	57                   	push   %edi
+  803f18:	e8 88 cc ff ff       	call   800ba5 <sys_env_destroy>
+  803f1d:	83 c4 10             	add    $0x10,%esp
+  803f20:	85 c0                	test   %eax,%eax
+  803f22:	0f 88 97 00 00 00    	js     803fbf <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  803f28:	83 c3 01             	add    $0x1,%ebx
+  803f2b:	83 fb 20             	cmp    $0x20,%ebx
+  803f2e:	0f 84 d2 00 00 00    	je     804006 <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  803f34:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  803f37:	74 ef                	je     803f28 <pthread_kill_others+0x56>
+  803f39:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803f3c:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803f43:	8b 40 04             	mov    0x4(%eax),%eax
+  803f46:	83 f8 01             	cmp    $0x1,%eax
+  803f49:	75 dd                	jne    803f28 <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  803f4b:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803f4e:	8b 3c 85 40 70 80 00 	mov    0x807040(,%eax,4),%edi
+  803f55:	89 fe                	mov    %edi,%esi
+  803f57:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  803f5d:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803f60:	c1 e0 04             	shl    $0x4,%eax
+  803f63:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803f68:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803f6b:	39 c7                	cmp    %eax,%edi
+  803f6d:	75 b9                	jne    803f28 <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  803f6f:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803f72:	c1 e0 04             	shl    $0x4,%eax
+  803f75:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803f7a:	8b 40 54             	mov    0x54(%eax),%eax
+  803f7d:	85 c0                	test   %eax,%eax
+  803f7f:	74 a7                	je     803f28 <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803f81:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803f84:	c1 e0 04             	shl    $0x4,%eax
+  803f87:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  803f8d:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803f8f:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  803f95:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803f9a:	0f 87 65 ff ff ff    	ja     803f05 <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803fa0:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803fa5:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  803fa7:	c1 e8 10             	shr    $0x10,%eax
+  803faa:	0f 84 55 ff ff ff    	je     803f05 <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803fb0:	c1 e0 10             	shl    $0x10,%eax
+  803fb3:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  803fb8:	29 c1                	sub    %eax,%ecx
+  803fba:	e9 4c ff ff ff       	jmp    803f0b <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  803fbf:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  803fc2:	c1 e2 04             	shl    $0x4,%edx
+  803fc5:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803fcb:	8b 52 48             	mov    0x48(%edx),%edx
+  803fce:	39 fa                	cmp    %edi,%edx
+  803fd0:	0f 85 52 ff ff ff    	jne    803f28 <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  803fd6:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  803fd9:	c1 e2 04             	shl    $0x4,%edx
+  803fdc:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803fe2:	8b 52 54             	mov    0x54(%edx),%edx
+  803fe5:	85 d2                	test   %edx,%edx
+  803fe7:	0f 84 3b ff ff ff    	je     803f28 <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  803fed:	83 ec 0c             	sub    $0xc,%esp
+  803ff0:	50                   	push   %eax
+  803ff1:	57                   	push   %edi
+  803ff2:	68 e0 53 80 00       	push   $0x8053e0
+  803ff7:	68 bb 00 00 00       	push   $0xbb
+  803ffc:	68 d0 53 80 00       	push   $0x8053d0
+  804001:	e8 45 c1 ff ff       	call   80014b <_panic>
+	}
+}
+  804006:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804009:	5b                   	pop    %ebx
+  80400a:	5e                   	pop    %esi
+  80400b:	5f                   	pop    %edi
+  80400c:	5d                   	pop    %ebp
+  80400d:	c3                   	ret
+
+0080400e <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  80400e:	55                   	push   %ebp
+  80400f:	89 e5                	mov    %esp,%ebp
+  804011:	53                   	push   %ebx
+  804012:	83 ec 04             	sub    $0x4,%esp
+  804015:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804017:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  80401d:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  804023:	0f 87 85 00 00 00    	ja     8040ae <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804029:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  80402e:	29 c3                	sub    %eax,%ebx
+  804030:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  804033:	83 ec 04             	sub    $0x4,%esp
+  804036:	68 80 02 00 00       	push   $0x280
+  80403b:	6a 00                	push   $0x0
+  80403d:	68 40 70 80 00       	push   $0x807040
+  804042:	e8 14 c9 ff ff       	call   80095b <memset>
+	threads_mu.m_state = 0;
+  804047:	c7 05 20 70 80 00 00 	movl   $0x0,0x807020
+  80404e:	00 00 00 
+	if (self != 0) {
+  804051:	83 c4 10             	add    $0x10,%esp
+  804054:	85 db                	test   %ebx,%ebx
+  804056:	74 51                	je     8040a9 <pthread_fork_child+0x9b>
+  804058:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80405a:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804060:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804065:	77 18                	ja     80407f <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804067:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80406c:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80406e:	c1 e8 10             	shr    $0x10,%eax
+  804071:	74 0c                	je     80407f <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804073:	c1 e0 10             	shl    $0x10,%eax
+  804076:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80407b:	29 c2                	sub    %eax,%edx
+  80407d:	eb 06                	jmp    804085 <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  80407f:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		threads[self].th_env = thisenv->env_id;
+  804085:	8b 02                	mov    (%edx),%eax
+  804087:	8b 48 48             	mov    0x48(%eax),%ecx
+  80408a:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  804091:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  804094:	89 0c 95 40 70 80 00 	mov    %ecx,0x807040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  80409b:	8d 04 95 40 70 80 00 	lea    0x807040(,%edx,4),%eax
+  8040a2:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  8040a9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8040ac:	c9                   	leave
+  8040ad:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  8040ae:	83 ec 04             	sub    $0x4,%esp
+  8040b1:	68 80 02 00 00       	push   $0x280
+  8040b6:	6a 00                	push   $0x0
+  8040b8:	68 40 70 80 00       	push   $0x807040
+  8040bd:	e8 99 c8 ff ff       	call   80095b <memset>
+	threads_mu.m_state = 0;
+  8040c2:	c7 05 20 70 80 00 00 	movl   $0x0,0x807020
+  8040c9:	00 00 00 
+  8040cc:	83 c4 10             	add    $0x10,%esp
+  8040cf:	eb d8                	jmp    8040a9 <pthread_fork_child+0x9b>
+
+008040d1 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8040d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040d6:	c3                   	ret
+
+008040d7 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8040d7:	55                   	push   %ebp
+  8040d8:	89 e5                	mov    %esp,%ebp
+  8040da:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8040dd:	68 05 54 80 00       	push   $0x805405
+  8040e2:	ff 75 0c             	push   0xc(%ebp)
+  8040e5:	e8 20 c7 ff ff       	call   80080a <strcpy>
+	return 0;
+}
+  8040ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040ef:	c9                   	leave
+  8040f0:	c3                   	ret
+
+008040f1 <devcons_write>:
+{
+  8040f1:	55                   	push   %ebp
+  8040f2:	89 e5                	mov    %esp,%ebp
+  8040f4:	57                   	push   %edi
+  8040f5:	56                   	push   %esi
+  8040f6:	53                   	push   %ebx
+  8040f7:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8040fd:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  804102:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  804108:	eb 2e                	jmp    804138 <devcons_write+0x47>
+		m = n - tot;
+  80410a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80410d:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80410f:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804114:	39 c3                	cmp    %eax,%ebx
+  804116:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  804119:	83 ec 04             	sub    $0x4,%esp
+  80411c:	53                   	push   %ebx
+  80411d:	89 f0                	mov    %esi,%eax
+  80411f:	03 45 0c             	add    0xc(%ebp),%eax
+  804122:	50                   	push   %eax
+  804123:	57                   	push   %edi
+  804124:	e8 67 c8 ff ff       	call   800990 <memmove>
+		sys_cputs(buf, m);
+  804129:	83 c4 08             	add    $0x8,%esp
+  80412c:	53                   	push   %ebx
+  80412d:	57                   	push   %edi
+  80412e:	e8 1b ca ff ff       	call   800b4e <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  804133:	01 de                	add    %ebx,%esi
+  804135:	83 c4 10             	add    $0x10,%esp
+  804138:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80413b:	72 cd                	jb     80410a <devcons_write+0x19>
+}
+  80413d:	89 f0                	mov    %esi,%eax
+  80413f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804142:	5b                   	pop    %ebx
+  804143:	5e                   	pop    %esi
+  804144:	5f                   	pop    %edi
+  804145:	5d                   	pop    %ebp
+  804146:	c3                   	ret
+
+00804147 <devcons_read>:
+{
+  804147:	55                   	push   %ebp
+  804148:	89 e5                	mov    %esp,%ebp
+  80414a:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80414d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804152:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804156:	75 07                	jne    80415f <devcons_read+0x18>
+  804158:	eb 1f                	jmp    804179 <devcons_read+0x32>
+		sys_yield();
+  80415a:	e8 bd ca ff ff       	call   800c1c <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80415f:	e8 15 ca ff ff       	call   800b79 <sys_cgetc>
+  804164:	85 c0                	test   %eax,%eax
+  804166:	74 f2                	je     80415a <devcons_read+0x13>
+	if (c < 0)
+  804168:	78 0f                	js     804179 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80416a:	83 f8 04             	cmp    $0x4,%eax
+  80416d:	74 0c                	je     80417b <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80416f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804172:	88 02                	mov    %al,(%edx)
+	return 1;
+  804174:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  804179:	c9                   	leave
+  80417a:	c3                   	ret
+		return 0;
+  80417b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804180:	eb f7                	jmp    804179 <devcons_read+0x32>
+
+00804182 <cputchar>:
+{
+  804182:	55                   	push   %ebp
+  804183:	89 e5                	mov    %esp,%ebp
+  804185:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  804188:	8b 45 08             	mov    0x8(%ebp),%eax
+  80418b:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80418e:	6a 01                	push   $0x1
+  804190:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804193:	50                   	push   %eax
+  804194:	e8 b5 c9 ff ff       	call   800b4e <sys_cputs>
+}
+  804199:	83 c4 10             	add    $0x10,%esp
+  80419c:	c9                   	leave
+  80419d:	c3                   	ret
+
+0080419e <getchar>:
+{
+  80419e:	55                   	push   %ebp
+  80419f:	89 e5                	mov    %esp,%ebp
+  8041a1:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8041a4:	6a 01                	push   $0x1
+  8041a6:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8041a9:	50                   	push   %eax
+  8041aa:	6a 00                	push   $0x0
+  8041ac:	e8 46 d2 ff ff       	call   8013f7 <read>
+	if (r < 0)
+  8041b1:	83 c4 10             	add    $0x10,%esp
+  8041b4:	85 c0                	test   %eax,%eax
+  8041b6:	78 06                	js     8041be <getchar+0x20>
+	if (r < 1)
+  8041b8:	74 06                	je     8041c0 <getchar+0x22>
+	return c;
+  8041ba:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8041be:	c9                   	leave
+  8041bf:	c3                   	ret
+		return -E_EOF;
+  8041c0:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8041c5:	eb f7                	jmp    8041be <getchar+0x20>
+
+008041c7 <iscons>:
+{
+  8041c7:	55                   	push   %ebp
+  8041c8:	89 e5                	mov    %esp,%ebp
+  8041ca:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8041cd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8041d0:	50                   	push   %eax
+  8041d1:	ff 75 08             	push   0x8(%ebp)
+  8041d4:	e8 8e cf ff ff       	call   801167 <fd_lookup>
+  8041d9:	83 c4 10             	add    $0x10,%esp
+  8041dc:	85 c0                	test   %eax,%eax
+  8041de:	78 11                	js     8041f1 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8041e0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8041e3:	8b 15 98 62 80 00    	mov    0x806298,%edx
+  8041e9:	39 10                	cmp    %edx,(%eax)
+  8041eb:	0f 94 c0             	sete   %al
+  8041ee:	0f b6 c0             	movzbl %al,%eax
+}
+  8041f1:	c9                   	leave
+  8041f2:	c3                   	ret
+
+008041f3 <opencons>:
+{
+  8041f3:	55                   	push   %ebp
+  8041f4:	89 e5                	mov    %esp,%ebp
+  8041f6:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8041f9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8041fc:	50                   	push   %eax
+  8041fd:	e8 0f cf ff ff       	call   801111 <fd_alloc>
+  804202:	83 c4 10             	add    $0x10,%esp
+  804205:	85 c0                	test   %eax,%eax
+  804207:	78 3a                	js     804243 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  804209:	83 ec 04             	sub    $0x4,%esp
+  80420c:	68 07 04 00 00       	push   $0x407
+  804211:	ff 75 f4             	push   -0xc(%ebp)
+  804214:	6a 00                	push   $0x0
+  804216:	e8 2d ca ff ff       	call   800c48 <sys_page_alloc>
+  80421b:	83 c4 10             	add    $0x10,%esp
+  80421e:	85 c0                	test   %eax,%eax
+  804220:	78 21                	js     804243 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  804222:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804225:	8b 15 98 62 80 00    	mov    0x806298,%edx
+  80422b:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80422d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804230:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  804237:	83 ec 0c             	sub    $0xc,%esp
+  80423a:	50                   	push   %eax
+  80423b:	e8 aa ce ff ff       	call   8010ea <fd2num>
+  804240:	83 c4 10             	add    $0x10,%esp
+}
+  804243:	c9                   	leave
+  804244:	c3                   	ret
+
+00804245 <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  804245:	55                   	push   %ebp
+  804246:	89 e5                	mov    %esp,%ebp
+  804248:	57                   	push   %edi
+  804249:	56                   	push   %esi
+  80424a:	53                   	push   %ebx
+  80424b:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  80424e:	89 d6                	mov    %edx,%esi
+  804250:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  804253:	89 cf                	mov    %ecx,%edi
+  804255:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  804258:	89 fa                	mov    %edi,%edx
+  80425a:	80 ce 08             	or     $0x8,%dh
+  80425d:	f6 c5 08             	test   $0x8,%ch
+  804260:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  804263:	57                   	push   %edi
+  804264:	56                   	push   %esi
+  804265:	50                   	push   %eax
+  804266:	56                   	push   %esi
+  804267:	6a 00                	push   $0x0
+  804269:	e8 27 ca ff ff       	call   800c95 <sys_page_map>
+	if (r < 0) {
+  80426e:	83 c4 20             	add    $0x20,%esp
+  804271:	85 c0                	test   %eax,%eax
+  804273:	78 27                	js     80429c <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  804275:	83 ec 0c             	sub    $0xc,%esp
+  804278:	57                   	push   %edi
+  804279:	56                   	push   %esi
+  80427a:	6a 00                	push   $0x0
+  80427c:	56                   	push   %esi
+  80427d:	6a 00                	push   $0x0
+  80427f:	e8 11 ca ff ff       	call   800c95 <sys_page_map>
+  804284:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  804286:	83 c4 20             	add    $0x20,%esp
+  804289:	85 c0                	test   %eax,%eax
+  80428b:	78 24                	js     8042b1 <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  80428d:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  804292:	89 d8                	mov    %ebx,%eax
+  804294:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804297:	5b                   	pop    %ebx
+  804298:	5e                   	pop    %esi
+  804299:	5f                   	pop    %edi
+  80429a:	5d                   	pop    %ebp
+  80429b:	c3                   	ret
+  80429c:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  80429e:	83 ec 08             	sub    $0x8,%esp
+  8042a1:	50                   	push   %eax
+  8042a2:	68 14 54 80 00       	push   $0x805414
+  8042a7:	e8 7a bf ff ff       	call   800226 <cprintf>
+		return r;
+  8042ac:	83 c4 10             	add    $0x10,%esp
+  8042af:	eb e1                	jmp    804292 <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  8042b1:	83 ec 08             	sub    $0x8,%esp
+  8042b4:	50                   	push   %eax
+  8042b5:	68 44 54 80 00       	push   $0x805444
+  8042ba:	e8 67 bf ff ff       	call   800226 <cprintf>
+		return r;
+  8042bf:	83 c4 10             	add    $0x10,%esp
+  8042c2:	eb ce                	jmp    804292 <duppage_cow+0x4d>
+
+008042c4 <duppage>:
+{
+  8042c4:	55                   	push   %ebp
+  8042c5:	89 e5                	mov    %esp,%ebp
+  8042c7:	53                   	push   %ebx
+  8042c8:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  8042cb:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  8042ce:	51                   	push   %ecx
+  8042cf:	52                   	push   %edx
+  8042d0:	50                   	push   %eax
+  8042d1:	52                   	push   %edx
+  8042d2:	6a 00                	push   $0x0
+  8042d4:	e8 bc c9 ff ff       	call   800c95 <sys_page_map>
+	if (r < 0) {
+  8042d9:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  8042dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  8042e1:	85 c0                	test   %eax,%eax
+  8042e3:	78 07                	js     8042ec <duppage+0x28>
+}
+  8042e5:	89 d8                	mov    %ebx,%eax
+  8042e7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8042ea:	c9                   	leave
+  8042eb:	c3                   	ret
+  8042ec:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  8042ee:	83 ec 08             	sub    $0x8,%esp
+  8042f1:	50                   	push   %eax
+  8042f2:	68 14 54 80 00       	push   $0x805414
+  8042f7:	e8 2a bf ff ff       	call   800226 <cprintf>
+		return r;
+  8042fc:	83 c4 10             	add    $0x10,%esp
+  8042ff:	eb e4                	jmp    8042e5 <duppage+0x21>
+
+00804301 <cow_copy>:
+{
+  804301:	55                   	push   %ebp
+  804302:	89 e5                	mov    %esp,%ebp
+  804304:	56                   	push   %esi
+  804305:	53                   	push   %ebx
+  804306:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  804308:	83 ec 04             	sub    $0x4,%esp
+  80430b:	6a 07                	push   $0x7
+  80430d:	68 00 f0 7f 00       	push   $0x7ff000
+  804312:	6a 00                	push   $0x0
+  804314:	e8 2f c9 ff ff       	call   800c48 <sys_page_alloc>
+	if (r < 0) {
+  804319:	83 c4 10             	add    $0x10,%esp
+  80431c:	85 c0                	test   %eax,%eax
+  80431e:	78 58                	js     804378 <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  804320:	83 ec 04             	sub    $0x4,%esp
+  804323:	68 00 10 00 00       	push   $0x1000
+  804328:	56                   	push   %esi
+  804329:	68 00 f0 7f 00       	push   $0x7ff000
+  80432e:	e8 5d c6 ff ff       	call   800990 <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  804333:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80433a:	56                   	push   %esi
+  80433b:	6a 00                	push   $0x0
+  80433d:	68 00 f0 7f 00       	push   $0x7ff000
+  804342:	6a 00                	push   $0x0
+  804344:	e8 4c c9 ff ff       	call   800c95 <sys_page_map>
+  804349:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  80434b:	83 c4 20             	add    $0x20,%esp
+  80434e:	85 c0                	test   %eax,%eax
+  804350:	78 3b                	js     80438d <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  804352:	83 ec 08             	sub    $0x8,%esp
+  804355:	68 00 f0 7f 00       	push   $0x7ff000
+  80435a:	6a 00                	push   $0x0
+  80435c:	e8 80 c9 ff ff       	call   800ce1 <sys_page_unmap>
+  804361:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  804363:	83 c4 10             	add    $0x10,%esp
+  804366:	85 c0                	test   %eax,%eax
+  804368:	78 45                	js     8043af <cow_copy+0xae>
+	return 0;
+  80436a:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  80436f:	89 d8                	mov    %ebx,%eax
+  804371:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804374:	5b                   	pop    %ebx
+  804375:	5e                   	pop    %esi
+  804376:	5d                   	pop    %ebp
+  804377:	c3                   	ret
+  804378:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  80437a:	83 ec 08             	sub    $0x8,%esp
+  80437d:	50                   	push   %eax
+  80437e:	68 34 55 80 00       	push   $0x805534
+  804383:	e8 9e be ff ff       	call   800226 <cprintf>
+		return r;
+  804388:	83 c4 10             	add    $0x10,%esp
+  80438b:	eb e2                	jmp    80436f <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  80438d:	83 ec 08             	sub    $0x8,%esp
+  804390:	50                   	push   %eax
+  804391:	68 50 55 80 00       	push   $0x805550
+  804396:	e8 8b be ff ff       	call   800226 <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  80439b:	83 c4 08             	add    $0x8,%esp
+  80439e:	68 00 f0 7f 00       	push   $0x7ff000
+  8043a3:	6a 00                	push   $0x0
+  8043a5:	e8 37 c9 ff ff       	call   800ce1 <sys_page_unmap>
+		return r;
+  8043aa:	83 c4 10             	add    $0x10,%esp
+  8043ad:	eb c0                	jmp    80436f <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  8043af:	83 ec 08             	sub    $0x8,%esp
+  8043b2:	50                   	push   %eax
+  8043b3:	68 6c 54 80 00       	push   $0x80546c
+  8043b8:	e8 69 be ff ff       	call   800226 <cprintf>
+		return r;
+  8043bd:	83 c4 10             	add    $0x10,%esp
+  8043c0:	eb ad                	jmp    80436f <cow_copy+0x6e>
+
+008043c2 <pgfault>:
+{
+  8043c2:	55                   	push   %ebp
+  8043c3:	89 e5                	mov    %esp,%ebp
+  8043c5:	56                   	push   %esi
+  8043c6:	53                   	push   %ebx
+  8043c7:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  8043ca:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  8043cc:	89 d8                	mov    %ebx,%eax
+  8043ce:	c1 e8 16             	shr    $0x16,%eax
+  8043d1:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  8043d8:	89 de                	mov    %ebx,%esi
+  8043da:	c1 ee 0c             	shr    $0xc,%esi
+  8043dd:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  8043e4:	a8 07                	test   $0x7,%al
+  8043e6:	74 3b                	je     804423 <pgfault+0x61>
+  8043e8:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  8043ee:	74 33                	je     804423 <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  8043f0:	83 ec 0c             	sub    $0xc,%esp
+  8043f3:	68 00 f0 bf ee       	push   $0xeebff000
+  8043f8:	e8 c8 f4 ff ff       	call   8038c5 <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  8043fd:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  804404:	83 c4 10             	add    $0x10,%esp
+  804407:	f6 c4 08             	test   $0x8,%ah
+  80440a:	75 30                	jne    80443c <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  80440c:	83 ec 0c             	sub    $0xc,%esp
+  80440f:	68 00 f0 bf ee       	push   $0xeebff000
+  804414:	e8 19 f5 ff ff       	call   803932 <mutex_unlock>
+}
+  804419:	83 c4 10             	add    $0x10,%esp
+  80441c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80441f:	5b                   	pop    %ebx
+  804420:	5e                   	pop    %esi
+  804421:	5d                   	pop    %ebp
+  804422:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  804423:	83 ec 08             	sub    $0x8,%esp
+  804426:	ff 72 28             	push   0x28(%edx)
+  804429:	51                   	push   %ecx
+  80442a:	50                   	push   %eax
+  80442b:	68 90 54 80 00       	push   $0x805490
+  804430:	6a 3f                	push   $0x3f
+  804432:	68 6a 55 80 00       	push   $0x80556a
+  804437:	e8 0f bd ff ff       	call   80014b <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  80443c:	89 d8                	mov    %ebx,%eax
+  80443e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  804443:	e8 b9 fe ff ff       	call   804301 <cow_copy>
+  804448:	eb c2                	jmp    80440c <pgfault+0x4a>
+
+0080444a <cow_enable>:
+{
+  80444a:	55                   	push   %ebp
+  80444b:	89 e5                	mov    %esp,%ebp
+  80444d:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  804450:	68 c2 43 80 00       	push   $0x8043c2
+  804455:	e8 28 06 00 00       	call   804a82 <set_pgfault_handler>
+}
+  80445a:	83 c4 10             	add    $0x10,%esp
+  80445d:	c9                   	leave
+  80445e:	c3                   	ret
+
+0080445f <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  80445f:	55                   	push   %ebp
+  804460:	89 e5                	mov    %esp,%ebp
+  804462:	57                   	push   %edi
+  804463:	56                   	push   %esi
+  804464:	53                   	push   %ebx
+  804465:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  804468:	68 c2 43 80 00       	push   $0x8043c2
+  80446d:	e8 10 06 00 00       	call   804a82 <set_pgfault_handler>
+  804472:	b8 07 00 00 00       	mov    $0x7,%eax
+  804477:	cd 30                	int    $0x30
+  804479:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  80447c:	83 c4 10             	add    $0x10,%esp
+  80447f:	85 c0                	test   %eax,%eax
+  804481:	78 4b                	js     8044ce <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  804483:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804488:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80448d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  804490:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  804494:	0f 85 16 01 00 00    	jne    8045b0 <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80449a:	e8 51 c7 ff ff       	call   800bf0 <sys_getenvid>
+  80449f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8044a4:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8044a6:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  8044ac:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8044b2:	77 32                	ja     8044e6 <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8044b4:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  8044b9:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  8044bb:	c1 ea 10             	shr    $0x10,%edx
+  8044be:	74 26                	je     8044e6 <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8044c0:	c1 e2 10             	shl    $0x10,%edx
+  8044c3:	89 d1                	mov    %edx,%ecx
+  8044c5:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8044ca:	29 ca                	sub    %ecx,%edx
+  8044cc:	eb 1e                	jmp    8044ec <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  8044ce:	83 ec 08             	sub    $0x8,%esp
+  8044d1:	89 c7                	mov    %eax,%edi
+  8044d3:	50                   	push   %eax
+  8044d4:	68 75 55 80 00       	push   $0x805575
+  8044d9:	e8 48 bd ff ff       	call   800226 <cprintf>
+		return eid;
+  8044de:	83 c4 10             	add    $0x10,%esp
+  8044e1:	e9 6c 01 00 00       	jmp    804652 <fork+0x1f3>
+		return pthread_main_tls;
+  8044e6:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8044ec:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8044ef:	c1 e0 04             	shl    $0x4,%eax
+  8044f2:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8044f7:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  8044f9:	e8 10 fb ff ff       	call   80400e <pthread_fork_child>
+		return eid;
+  8044fe:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804501:	e9 4c 01 00 00       	jmp    804652 <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  804506:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  80450c:	89 da                	mov    %ebx,%edx
+  80450e:	89 f8                	mov    %edi,%eax
+  804510:	e8 af fd ff ff       	call   8042c4 <duppage>
+  804515:	85 c0                	test   %eax,%eax
+  804517:	79 28                	jns    804541 <fork+0xe2>
+  804519:	89 c7                	mov    %eax,%edi
+  80451b:	e9 32 01 00 00       	jmp    804652 <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  804520:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  804526:	83 f9 05             	cmp    $0x5,%ecx
+  804529:	75 58                	jne    804583 <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  80452b:	b9 05 00 00 00       	mov    $0x5,%ecx
+  804530:	89 da                	mov    %ebx,%edx
+  804532:	89 f8                	mov    %edi,%eax
+  804534:	e8 8b fd ff ff       	call   8042c4 <duppage>
+  804539:	85 c0                	test   %eax,%eax
+  80453b:	0f 88 0f 01 00 00    	js     804650 <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  804541:	83 c3 01             	add    $0x1,%ebx
+  804544:	39 de                	cmp    %ebx,%esi
+  804546:	74 54                	je     80459c <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  804548:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  80454f:	f6 c1 05             	test   $0x5,%cl
+  804552:	74 ed                	je     804541 <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  804554:	f6 c5 04             	test   $0x4,%ch
+  804557:	75 ad                	jne    804506 <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  804559:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  80455f:	74 bf                	je     804520 <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  804561:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  804567:	74 d8                	je     804541 <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  804569:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  80456f:	89 da                	mov    %ebx,%edx
+  804571:	89 f8                	mov    %edi,%eax
+  804573:	e8 cd fc ff ff       	call   804245 <duppage_cow>
+  804578:	85 c0                	test   %eax,%eax
+  80457a:	79 c5                	jns    804541 <fork+0xe2>
+  80457c:	89 c7                	mov    %eax,%edi
+  80457e:	e9 cf 00 00 00       	jmp    804652 <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  804583:	68 c0 54 80 00       	push   $0x8054c0
+  804588:	68 1d 52 80 00       	push   $0x80521d
+  80458d:	68 c6 00 00 00       	push   $0xc6
+  804592:	68 6a 55 80 00       	push   $0x80556a
+  804597:	e8 af bb ff ff       	call   80014b <_panic>
+  80459c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80459f:	83 c1 01             	add    $0x1,%ecx
+  8045a2:	81 c6 00 04 00 00    	add    $0x400,%esi
+  8045a8:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  8045ae:	74 18                	je     8045c8 <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  8045b0:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  8045b7:	a8 07                	test   $0x7,%al
+  8045b9:	74 e4                	je     80459f <fork+0x140>
+  8045bb:	89 cb                	mov    %ecx,%ebx
+  8045bd:	c1 e3 0a             	shl    $0xa,%ebx
+  8045c0:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8045c3:	e9 7c ff ff ff       	jmp    804544 <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  8045c8:	83 ec 04             	sub    $0x4,%esp
+  8045cb:	6a 07                	push   $0x7
+  8045cd:	68 00 f0 bf ee       	push   $0xeebff000
+  8045d2:	ff 75 e4             	push   -0x1c(%ebp)
+  8045d5:	e8 6e c6 ff ff       	call   800c48 <sys_page_alloc>
+  8045da:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8045dc:	83 c4 10             	add    $0x10,%esp
+  8045df:	85 c0                	test   %eax,%eax
+  8045e1:	78 34                	js     804617 <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  8045e3:	83 ec 08             	sub    $0x8,%esp
+  8045e6:	68 c0 4a 80 00       	push   $0x804ac0
+  8045eb:	ff 75 e4             	push   -0x1c(%ebp)
+  8045ee:	e8 d2 c7 ff ff       	call   800dc5 <sys_env_set_pgfault_upcall>
+  8045f3:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8045f5:	83 c4 10             	add    $0x10,%esp
+  8045f8:	85 c0                	test   %eax,%eax
+  8045fa:	78 2e                	js     80462a <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  8045fc:	83 ec 08             	sub    $0x8,%esp
+  8045ff:	6a 02                	push   $0x2
+  804601:	ff 75 e4             	push   -0x1c(%ebp)
+  804604:	e8 24 c7 ff ff       	call   800d2d <sys_env_set_status>
+  804609:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80460b:	83 c4 10             	add    $0x10,%esp
+  80460e:	85 c0                	test   %eax,%eax
+  804610:	78 2b                	js     80463d <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  804612:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804615:	eb 3b                	jmp    804652 <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  804617:	83 ec 08             	sub    $0x8,%esp
+  80461a:	50                   	push   %eax
+  80461b:	68 e8 54 80 00       	push   $0x8054e8
+  804620:	e8 01 bc ff ff       	call   800226 <cprintf>
+		return r;
+  804625:	83 c4 10             	add    $0x10,%esp
+  804628:	eb 28                	jmp    804652 <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  80462a:	83 ec 08             	sub    $0x8,%esp
+  80462d:	50                   	push   %eax
+  80462e:	68 10 55 80 00       	push   $0x805510
+  804633:	e8 ee bb ff ff       	call   800226 <cprintf>
+		return r;
+  804638:	83 c4 10             	add    $0x10,%esp
+  80463b:	eb 15                	jmp    804652 <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  80463d:	83 ec 08             	sub    $0x8,%esp
+  804640:	50                   	push   %eax
+  804641:	68 85 55 80 00       	push   $0x805585
+  804646:	e8 db bb ff ff       	call   800226 <cprintf>
+		return r;
+  80464b:	83 c4 10             	add    $0x10,%esp
+  80464e:	eb 02                	jmp    804652 <fork+0x1f3>
+  804650:	89 c7                	mov    %eax,%edi
+}
+  804652:	89 f8                	mov    %edi,%eax
+  804654:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804657:	5b                   	pop    %ebx
+  804658:	5e                   	pop    %esi
+  804659:	5f                   	pop    %edi
+  80465a:	5d                   	pop    %ebp
+  80465b:	c3                   	ret
+
+0080465c <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  80465c:	55                   	push   %ebp
+  80465d:	89 e5                	mov    %esp,%ebp
+  80465f:	57                   	push   %edi
+  804660:	56                   	push   %esi
+  804661:	53                   	push   %ebx
+  804662:	83 ec 2c             	sub    $0x2c,%esp
+  804665:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804667:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  80466d:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804672:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  804678:	77 0a                	ja     804684 <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80467a:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  80467f:	29 c3                	sub    %eax,%ebx
+  804681:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  804684:	83 ec 0c             	sub    $0xc,%esp
+  804687:	68 c2 43 80 00       	push   $0x8043c2
+  80468c:	e8 f1 03 00 00       	call   804a82 <set_pgfault_handler>
+  804691:	b8 07 00 00 00       	mov    $0x7,%eax
+  804696:	cd 30                	int    $0x30
+  804698:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  80469b:	83 c4 10             	add    $0x10,%esp
+  80469e:	85 c0                	test   %eax,%eax
+  8046a0:	78 30                	js     8046d2 <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  8046a2:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8046a6:	74 42                	je     8046ea <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  8046a8:	c1 e3 10             	shl    $0x10,%ebx
+  8046ab:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  8046b0:	29 d8                	sub    %ebx,%eax
+  8046b2:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8046b5:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  8046ba:	29 d8                	sub    %ebx,%eax
+  8046bc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8046bf:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8046c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8046c9:	89 f7                	mov    %esi,%edi
+  8046cb:	89 d6                	mov    %edx,%esi
+  8046cd:	e9 2c 01 00 00       	jmp    8047fe <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  8046d2:	83 ec 08             	sub    $0x8,%esp
+  8046d5:	89 c7                	mov    %eax,%edi
+  8046d7:	50                   	push   %eax
+  8046d8:	68 75 55 80 00       	push   $0x805575
+  8046dd:	e8 44 bb ff ff       	call   800226 <cprintf>
+		return eid;
+  8046e2:	83 c4 10             	add    $0x10,%esp
+  8046e5:	e9 d5 00 00 00       	jmp    8047bf <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8046ea:	e8 01 c5 ff ff       	call   800bf0 <sys_getenvid>
+  8046ef:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8046f4:	89 c2                	mov    %eax,%edx
+  8046f6:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8046f8:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  8046fe:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804703:	77 18                	ja     80471d <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804705:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80470a:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  80470c:	c1 e8 10             	shr    $0x10,%eax
+  80470f:	74 0c                	je     80471d <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804711:	c1 e0 10             	shl    $0x10,%eax
+  804714:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  804719:	29 c1                	sub    %eax,%ecx
+  80471b:	eb 06                	jmp    804723 <sfork+0xc7>
+		return pthread_main_tls;
+  80471d:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+  804723:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804726:	c1 e0 04             	shl    $0x4,%eax
+  804729:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80472e:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  804730:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  804733:	e9 87 00 00 00       	jmp    8047bf <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  804738:	f6 c5 04             	test   $0x4,%ch
+  80473b:	74 6c                	je     8047a9 <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  80473d:	89 ca                	mov    %ecx,%edx
+  80473f:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  804745:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  80474b:	74 7c                	je     8047c9 <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  80474d:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  804753:	89 da                	mov    %ebx,%edx
+  804755:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804758:	e8 67 fb ff ff       	call   8042c4 <duppage>
+  80475d:	85 c0                	test   %eax,%eax
+  80475f:	0f 88 4f 01 00 00    	js     8048b4 <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  804765:	83 c3 01             	add    $0x1,%ebx
+  804768:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  80476b:	74 7a                	je     8047e7 <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  80476d:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  80476f:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  804776:	f6 c1 01             	test   $0x1,%cl
+  804779:	74 ea                	je     804765 <sfork+0x109>
+  80477b:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  804781:	74 e2                	je     804765 <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  804783:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  804789:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  80478c:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  804791:	76 a5                	jbe    804738 <sfork+0xdc>
+  804793:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  804799:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  80479c:	39 fa                	cmp    %edi,%edx
+  80479e:	73 9d                	jae    80473d <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  8047a0:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  8047a3:	39 fa                	cmp    %edi,%edx
+  8047a5:	72 96                	jb     80473d <sfork+0xe1>
+  8047a7:	eb 8f                	jmp    804738 <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8047a9:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8047af:	89 da                	mov    %ebx,%edx
+  8047b1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8047b4:	e8 8c fa ff ff       	call   804245 <duppage_cow>
+  8047b9:	85 c0                	test   %eax,%eax
+  8047bb:	79 a8                	jns    804765 <sfork+0x109>
+  8047bd:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  8047bf:	89 f8                	mov    %edi,%eax
+  8047c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8047c4:	5b                   	pop    %ebx
+  8047c5:	5e                   	pop    %esi
+  8047c6:	5f                   	pop    %edi
+  8047c7:	5d                   	pop    %ebp
+  8047c8:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  8047c9:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  8047ce:	e8 2e fb ff ff       	call   804301 <cow_copy>
+  8047d3:	85 c0                	test   %eax,%eax
+  8047d5:	0f 88 d2 00 00 00    	js     8048ad <sfork+0x251>
+				pte = uvpt[pn];
+  8047db:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  8047e2:	e9 66 ff ff ff       	jmp    80474d <sfork+0xf1>
+  8047e7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8047ea:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8047ed:	83 c6 01             	add    $0x1,%esi
+  8047f0:	81 c7 00 04 00 00    	add    $0x400,%edi
+  8047f6:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  8047fc:	74 1b                	je     804819 <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  8047fe:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  804805:	a8 01                	test   $0x1,%al
+  804807:	74 e4                	je     8047ed <sfork+0x191>
+  804809:	89 f3                	mov    %esi,%ebx
+  80480b:	c1 e3 0a             	shl    $0xa,%ebx
+  80480e:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  804811:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  804814:	e9 4f ff ff ff       	jmp    804768 <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  804819:	83 ec 04             	sub    $0x4,%esp
+  80481c:	6a 07                	push   $0x7
+  80481e:	68 00 f0 bf ee       	push   $0xeebff000
+  804823:	ff 75 e0             	push   -0x20(%ebp)
+  804826:	e8 1d c4 ff ff       	call   800c48 <sys_page_alloc>
+  80482b:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80482d:	83 c4 10             	add    $0x10,%esp
+  804830:	85 c0                	test   %eax,%eax
+  804832:	78 37                	js     80486b <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  804834:	83 ec 08             	sub    $0x8,%esp
+  804837:	68 c0 4a 80 00       	push   $0x804ac0
+  80483c:	ff 75 e0             	push   -0x20(%ebp)
+  80483f:	e8 81 c5 ff ff       	call   800dc5 <sys_env_set_pgfault_upcall>
+  804844:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804846:	83 c4 10             	add    $0x10,%esp
+  804849:	85 c0                	test   %eax,%eax
+  80484b:	78 34                	js     804881 <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  80484d:	83 ec 08             	sub    $0x8,%esp
+  804850:	6a 02                	push   $0x2
+  804852:	ff 75 e0             	push   -0x20(%ebp)
+  804855:	e8 d3 c4 ff ff       	call   800d2d <sys_env_set_status>
+  80485a:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80485c:	83 c4 10             	add    $0x10,%esp
+  80485f:	85 c0                	test   %eax,%eax
+  804861:	78 34                	js     804897 <sfork+0x23b>
+	return eid;
+  804863:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  804866:	e9 54 ff ff ff       	jmp    8047bf <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  80486b:	83 ec 08             	sub    $0x8,%esp
+  80486e:	50                   	push   %eax
+  80486f:	68 e8 54 80 00       	push   $0x8054e8
+  804874:	e8 ad b9 ff ff       	call   800226 <cprintf>
+		return r;
+  804879:	83 c4 10             	add    $0x10,%esp
+  80487c:	e9 3e ff ff ff       	jmp    8047bf <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  804881:	83 ec 08             	sub    $0x8,%esp
+  804884:	50                   	push   %eax
+  804885:	68 10 55 80 00       	push   $0x805510
+  80488a:	e8 97 b9 ff ff       	call   800226 <cprintf>
+		return r;
+  80488f:	83 c4 10             	add    $0x10,%esp
+  804892:	e9 28 ff ff ff       	jmp    8047bf <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  804897:	83 ec 08             	sub    $0x8,%esp
+  80489a:	50                   	push   %eax
+  80489b:	68 85 55 80 00       	push   $0x805585
+  8048a0:	e8 81 b9 ff ff       	call   800226 <cprintf>
+		return r;
+  8048a5:	83 c4 10             	add    $0x10,%esp
+  8048a8:	e9 12 ff ff ff       	jmp    8047bf <sfork+0x163>
+  8048ad:	89 c7                	mov    %eax,%edi
+  8048af:	e9 0b ff ff ff       	jmp    8047bf <sfork+0x163>
+  8048b4:	89 c7                	mov    %eax,%edi
+  8048b6:	e9 04 ff ff ff       	jmp    8047bf <sfork+0x163>
+
+008048bb <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8048bb:	55                   	push   %ebp
+  8048bc:	89 e5                	mov    %esp,%ebp
+  8048be:	57                   	push   %edi
+  8048bf:	56                   	push   %esi
+  8048c0:	53                   	push   %ebx
+  8048c1:	83 ec 18             	sub    $0x18,%esp
+  8048c4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8048c7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8048ca:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  8048cd:	85 c0                	test   %eax,%eax
+  8048cf:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8048d4:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  8048d7:	50                   	push   %eax
+  8048d8:	e8 61 c5 ff ff       	call   800e3e <sys_ipc_recv>
+	if (r < 0) {
+  8048dd:	83 c4 10             	add    $0x10,%esp
+  8048e0:	85 c0                	test   %eax,%eax
+  8048e2:	78 2b                	js     80490f <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  8048e4:	85 ff                	test   %edi,%edi
+  8048e6:	74 55                	je     80493d <ipc_recv+0x82>
+  8048e8:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8048ea:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8048f0:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8048f5:	77 39                	ja     804930 <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8048f7:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8048fc:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8048fe:	c1 e8 10             	shr    $0x10,%eax
+  804901:	74 2d                	je     804930 <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804903:	c1 e0 10             	shl    $0x10,%eax
+  804906:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80490b:	29 c2                	sub    %eax,%edx
+  80490d:	eb 27                	jmp    804936 <ipc_recv+0x7b>
+  80490f:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  804911:	83 ec 08             	sub    $0x8,%esp
+  804914:	50                   	push   %eax
+  804915:	68 a3 55 80 00       	push   $0x8055a3
+  80491a:	e8 07 b9 ff ff       	call   800226 <cprintf>
+		*from_env_store = 0;
+  80491f:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  804925:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  80492b:	83 c4 10             	add    $0x10,%esp
+  80492e:	eb 77                	jmp    8049a7 <ipc_recv+0xec>
+		return pthread_main_tls;
+  804930:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  804936:	8b 02                	mov    (%edx),%eax
+  804938:	8b 40 78             	mov    0x78(%eax),%eax
+  80493b:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  80493d:	85 f6                	test   %esi,%esi
+  80493f:	74 34                	je     804975 <ipc_recv+0xba>
+  804941:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804943:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804949:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80494e:	77 18                	ja     804968 <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804950:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804955:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804957:	c1 e8 10             	shr    $0x10,%eax
+  80495a:	74 0c                	je     804968 <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80495c:	c1 e0 10             	shl    $0x10,%eax
+  80495f:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804964:	29 c2                	sub    %eax,%edx
+  804966:	eb 06                	jmp    80496e <ipc_recv+0xb3>
+		return pthread_main_tls;
+  804968:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  80496e:	8b 02                	mov    (%edx),%eax
+  804970:	8b 40 7c             	mov    0x7c(%eax),%eax
+  804973:	89 06                	mov    %eax,(%esi)
+  804975:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804977:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80497d:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804982:	77 18                	ja     80499c <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804984:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804989:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80498b:	c1 e8 10             	shr    $0x10,%eax
+  80498e:	74 0c                	je     80499c <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804990:	c1 e0 10             	shl    $0x10,%eax
+  804993:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804998:	29 c2                	sub    %eax,%edx
+  80499a:	eb 06                	jmp    8049a2 <ipc_recv+0xe7>
+		return pthread_main_tls;
+  80499c:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+	}
+	return thisenv->env_ipc_value;
+  8049a2:	8b 02                	mov    (%edx),%eax
+  8049a4:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  8049a7:	89 d8                	mov    %ebx,%eax
+  8049a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8049ac:	5b                   	pop    %ebx
+  8049ad:	5e                   	pop    %esi
+  8049ae:	5f                   	pop    %edi
+  8049af:	5d                   	pop    %ebp
+  8049b0:	c3                   	ret
+
+008049b1 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8049b1:	55                   	push   %ebp
+  8049b2:	89 e5                	mov    %esp,%ebp
+  8049b4:	57                   	push   %edi
+  8049b5:	56                   	push   %esi
+  8049b6:	53                   	push   %ebx
+  8049b7:	83 ec 0c             	sub    $0xc,%esp
+  8049ba:	8b 75 08             	mov    0x8(%ebp),%esi
+  8049bd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8049c0:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  8049c3:	85 db                	test   %ebx,%ebx
+  8049c5:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8049ca:	0f 44 d8             	cmove  %eax,%ebx
+  8049cd:	eb 05                	jmp    8049d4 <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  8049cf:	e8 48 c2 ff ff       	call   800c1c <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  8049d4:	57                   	push   %edi
+  8049d5:	53                   	push   %ebx
+  8049d6:	ff 75 0c             	push   0xc(%ebp)
+  8049d9:	56                   	push   %esi
+  8049da:	e8 32 c4 ff ff       	call   800e11 <sys_ipc_try_send>
+		if (r == 0) {
+  8049df:	83 c4 10             	add    $0x10,%esp
+  8049e2:	85 c0                	test   %eax,%eax
+  8049e4:	74 19                	je     8049ff <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  8049e6:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8049e9:	74 e4                	je     8049cf <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  8049eb:	83 ec 0c             	sub    $0xc,%esp
+  8049ee:	50                   	push   %eax
+  8049ef:	57                   	push   %edi
+  8049f0:	53                   	push   %ebx
+  8049f1:	56                   	push   %esi
+  8049f2:	68 bc 55 80 00       	push   $0x8055bc
+  8049f7:	e8 2a b8 ff ff       	call   800226 <cprintf>
+			return;
+  8049fc:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  8049ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804a02:	5b                   	pop    %ebx
+  804a03:	5e                   	pop    %esi
+  804a04:	5f                   	pop    %edi
+  804a05:	5d                   	pop    %ebp
+  804a06:	c3                   	ret
+
+00804a07 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804a07:	55                   	push   %ebp
+  804a08:	89 e5                	mov    %esp,%ebp
+  804a0a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  804a0d:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  804a12:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804a15:	c1 e0 04             	shl    $0x4,%eax
+  804a18:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804a1d:	8b 40 50             	mov    0x50(%eax),%eax
+  804a20:	39 c8                	cmp    %ecx,%eax
+  804a22:	74 12                	je     804a36 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804a24:	83 c2 01             	add    $0x1,%edx
+  804a27:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  804a2d:	75 e3                	jne    804a12 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  804a2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a34:	eb 0e                	jmp    804a44 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  804a36:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804a39:	c1 e0 04             	shl    $0x4,%eax
+  804a3c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804a41:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  804a44:	5d                   	pop    %ebp
+  804a45:	c3                   	ret
+
+00804a46 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804a46:	55                   	push   %ebp
+  804a47:	89 e5                	mov    %esp,%ebp
+  804a49:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804a4c:	89 c2                	mov    %eax,%edx
+  804a4e:	c1 ea 16             	shr    $0x16,%edx
+  804a51:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  804a58:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804a5d:	f6 c1 01             	test   $0x1,%cl
+  804a60:	74 1c                	je     804a7e <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  804a62:	c1 e8 0c             	shr    $0xc,%eax
+  804a65:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  804a6c:	a8 01                	test   $0x1,%al
+  804a6e:	74 0e                	je     804a7e <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  804a70:	c1 e8 0c             	shr    $0xc,%eax
+  804a73:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  804a7a:	ef 
+  804a7b:	0f b7 d2             	movzwl %dx,%edx
+}
+  804a7e:	89 d0                	mov    %edx,%eax
+  804a80:	5d                   	pop    %ebp
+  804a81:	c3                   	ret
+
+00804a82 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804a82:	55                   	push   %ebp
+  804a83:	89 e5                	mov    %esp,%ebp
+  804a85:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  804a88:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  804a8f:	74 0a                	je     804a9b <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804a91:	8b 45 08             	mov    0x8(%ebp),%eax
+  804a94:	a3 00 a0 80 00       	mov    %eax,0x80a000
+}
+  804a99:	c9                   	leave
+  804a9a:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  804a9b:	83 ec 04             	sub    $0x4,%esp
+  804a9e:	6a 07                	push   $0x7
+  804aa0:	68 00 f0 bf ee       	push   $0xeebff000
+  804aa5:	6a 00                	push   $0x0
+  804aa7:	e8 9c c1 ff ff       	call   800c48 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804aac:	83 c4 08             	add    $0x8,%esp
+  804aaf:	68 c0 4a 80 00       	push   $0x804ac0
+  804ab4:	6a 00                	push   $0x0
+  804ab6:	e8 0a c3 ff ff       	call   800dc5 <sys_env_set_pgfault_upcall>
+  804abb:	83 c4 10             	add    $0x10,%esp
+  804abe:	eb d1                	jmp    804a91 <set_pgfault_handler+0xf>
+
+00804ac0 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804ac0:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804ac1:	a1 00 a0 80 00       	mov    0x80a000,%eax
+	call *%eax
+  804ac6:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804ac8:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  804acb:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  804acf:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  804ad3:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  804ad6:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  804ada:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  804adc:	83 c4 08             	add    $0x8,%esp
+	popal
+  804adf:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  804ae0:	83 c4 04             	add    $0x4,%esp
+	popfl
+  804ae3:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  804ae4:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  804ae5:	c3                   	ret
+
+00804ae6 <udm>:
+  804ae6:	57                   	push   %edi
+  804ae7:	56                   	push   %esi
+  804ae8:	53                   	push   %ebx
+  804ae9:	83 ec 20             	sub    $0x20,%esp
+  804aec:	89 44 24 10          	mov    %eax,0x10(%esp)
+  804af0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804af4:	8b 44 24 30          	mov    0x30(%esp),%eax
+  804af8:	8b 54 24 34          	mov    0x34(%esp),%edx
+  804afc:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804b00:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804b04:	89 d1                	mov    %edx,%ecx
+  804b06:	09 c1                	or     %eax,%ecx
+  804b08:	0f 84 91 00 00 00    	je     804b9f <udm+0xb9>
+  804b0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b13:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b18:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804b1d:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804b24:	00 
+  804b25:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  804b2c:	00 
+  804b2d:	eb 08                	jmp    804b37 <udm+0x51>
+  804b2f:	83 e9 01             	sub    $0x1,%ecx
+  804b32:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  804b35:	74 7c                	je     804bb3 <udm+0xcd>
+  804b37:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804b3b:	01 c0                	add    %eax,%eax
+  804b3d:	89 c6                	mov    %eax,%esi
+  804b3f:	89 d7                	mov    %edx,%edi
+  804b41:	8b 44 24 10          	mov    0x10(%esp),%eax
+  804b45:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804b49:	0f ad d0             	shrd   %cl,%edx,%eax
+  804b4c:	d3 ea                	shr    %cl,%edx
+  804b4e:	f6 c1 20             	test   $0x20,%cl
+  804b51:	74 04                	je     804b57 <udm+0x71>
+  804b53:	89 d0                	mov    %edx,%eax
+  804b55:	31 d2                	xor    %edx,%edx
+  804b57:	83 e0 01             	and    $0x1,%eax
+  804b5a:	89 04 24             	mov    %eax,(%esp)
+  804b5d:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804b64:	00 
+  804b65:	8b 04 24             	mov    (%esp),%eax
+  804b68:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804b6c:	09 f0                	or     %esi,%eax
+  804b6e:	09 fa                	or     %edi,%edx
+  804b70:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804b74:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804b78:	39 f0                	cmp    %esi,%eax
+  804b7a:	89 d3                	mov    %edx,%ebx
+  804b7c:	19 fb                	sbb    %edi,%ebx
+  804b7e:	72 af                	jb     804b2f <udm+0x49>
+  804b80:	29 f0                	sub    %esi,%eax
+  804b82:	19 fa                	sbb    %edi,%edx
+  804b84:	89 cf                	mov    %ecx,%edi
+  804b86:	c1 ef 05             	shr    $0x5,%edi
+  804b89:	83 e7 01             	and    $0x1,%edi
+  804b8c:	89 fe                	mov    %edi,%esi
+  804b8e:	83 f6 01             	xor    $0x1,%esi
+  804b91:	d3 e6                	shl    %cl,%esi
+  804b93:	d3 e7                	shl    %cl,%edi
+  804b95:	09 74 24 18          	or     %esi,0x18(%esp)
+  804b99:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804b9d:	eb 90                	jmp    804b2f <udm+0x49>
+  804b9f:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804ba3:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804ba7:	89 f0                	mov    %esi,%eax
+  804ba9:	89 fa                	mov    %edi,%edx
+  804bab:	89 74 24 18          	mov    %esi,0x18(%esp)
+  804baf:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  804bb3:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  804bb7:	89 01                	mov    %eax,(%ecx)
+  804bb9:	89 51 04             	mov    %edx,0x4(%ecx)
+  804bbc:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804bc0:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804bc4:	83 c4 20             	add    $0x20,%esp
+  804bc7:	5b                   	pop    %ebx
+  804bc8:	5e                   	pop    %esi
+  804bc9:	5f                   	pop    %edi
+  804bca:	c3                   	ret
+
+00804bcb <__udivdi3>:
+  804bcb:	83 ec 18             	sub    $0x18,%esp
+  804bce:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804bd2:	50                   	push   %eax
+  804bd3:	ff 74 24 2c          	push   0x2c(%esp)
+  804bd7:	ff 74 24 2c          	push   0x2c(%esp)
+  804bdb:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804bdf:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804be3:	e8 fe fe ff ff       	call   804ae6 <udm>
+  804be8:	83 c4 24             	add    $0x24,%esp
+  804beb:	c3                   	ret
+
+00804bec <__umoddi3>:
+  804bec:	83 ec 18             	sub    $0x18,%esp
+  804bef:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804bf3:	50                   	push   %eax
+  804bf4:	ff 74 24 2c          	push   0x2c(%esp)
+  804bf8:	ff 74 24 2c          	push   0x2c(%esp)
+  804bfc:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804c00:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804c04:	e8 dd fe ff ff       	call   804ae6 <udm>
+  804c09:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804c0d:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804c11:	83 c4 24             	add    $0x24,%esp
+  804c14:	c3                   	ret
+
+00804c15 <__divdi3>:
+  804c15:	56                   	push   %esi
+  804c16:	53                   	push   %ebx
+  804c17:	83 ec 14             	sub    $0x14,%esp
+  804c1a:	8b 44 24 20          	mov    0x20(%esp),%eax
+  804c1e:	8b 54 24 24          	mov    0x24(%esp),%edx
+  804c22:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  804c26:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  804c2a:	85 d2                	test   %edx,%edx
+  804c2c:	78 18                	js     804c46 <__divdi3+0x31>
+  804c2e:	85 db                	test   %ebx,%ebx
+  804c30:	78 3e                	js     804c70 <__divdi3+0x5b>
+  804c32:	83 ec 04             	sub    $0x4,%esp
+  804c35:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804c39:	56                   	push   %esi
+  804c3a:	53                   	push   %ebx
+  804c3b:	51                   	push   %ecx
+  804c3c:	e8 a5 fe ff ff       	call   804ae6 <udm>
+  804c41:	83 c4 10             	add    $0x10,%esp
+  804c44:	eb 24                	jmp    804c6a <__divdi3+0x55>
+  804c46:	f7 d8                	neg    %eax
+  804c48:	83 d2 00             	adc    $0x0,%edx
+  804c4b:	f7 da                	neg    %edx
+  804c4d:	85 db                	test   %ebx,%ebx
+  804c4f:	78 3a                	js     804c8b <__divdi3+0x76>
+  804c51:	83 ec 04             	sub    $0x4,%esp
+  804c54:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804c58:	56                   	push   %esi
+  804c59:	53                   	push   %ebx
+  804c5a:	51                   	push   %ecx
+  804c5b:	e8 86 fe ff ff       	call   804ae6 <udm>
+  804c60:	83 c4 10             	add    $0x10,%esp
+  804c63:	f7 d8                	neg    %eax
+  804c65:	83 d2 00             	adc    $0x0,%edx
+  804c68:	f7 da                	neg    %edx
+  804c6a:	83 c4 14             	add    $0x14,%esp
+  804c6d:	5b                   	pop    %ebx
+  804c6e:	5e                   	pop    %esi
+  804c6f:	c3                   	ret
+  804c70:	83 ec 04             	sub    $0x4,%esp
+  804c73:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804c77:	56                   	push   %esi
+  804c78:	f7 d9                	neg    %ecx
+  804c7a:	83 d3 00             	adc    $0x0,%ebx
+  804c7d:	f7 db                	neg    %ebx
+  804c7f:	53                   	push   %ebx
+  804c80:	51                   	push   %ecx
+  804c81:	e8 60 fe ff ff       	call   804ae6 <udm>
+  804c86:	83 c4 10             	add    $0x10,%esp
+  804c89:	eb d8                	jmp    804c63 <__divdi3+0x4e>
+  804c8b:	83 ec 04             	sub    $0x4,%esp
+  804c8e:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804c92:	56                   	push   %esi
+  804c93:	f7 d9                	neg    %ecx
+  804c95:	83 d3 00             	adc    $0x0,%ebx
+  804c98:	f7 db                	neg    %ebx
+  804c9a:	53                   	push   %ebx
+  804c9b:	51                   	push   %ecx
+  804c9c:	e8 45 fe ff ff       	call   804ae6 <udm>
+  804ca1:	83 c4 10             	add    $0x10,%esp
+  804ca4:	eb c4                	jmp    804c6a <__divdi3+0x55>
+
+00804ca6 <__moddi3>:
+  804ca6:	55                   	push   %ebp
+  804ca7:	57                   	push   %edi
+  804ca8:	56                   	push   %esi
+  804ca9:	53                   	push   %ebx
+  804caa:	83 ec 24             	sub    $0x24,%esp
+  804cad:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804cb1:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804cb5:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  804cb9:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  804cbd:	85 d2                	test   %edx,%edx
+  804cbf:	78 3b                	js     804cfc <__moddi3+0x56>
+  804cc1:	83 ec 04             	sub    $0x4,%esp
+  804cc4:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804cc8:	56                   	push   %esi
+  804cc9:	89 ce                	mov    %ecx,%esi
+  804ccb:	f7 de                	neg    %esi
+  804ccd:	89 74 24 08          	mov    %esi,0x8(%esp)
+  804cd1:	89 de                	mov    %ebx,%esi
+  804cd3:	83 d6 00             	adc    $0x0,%esi
+  804cd6:	f7 de                	neg    %esi
+  804cd8:	89 74 24 14          	mov    %esi,0x14(%esp)
+  804cdc:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804ce0:	0f 48 f1             	cmovs  %ecx,%esi
+  804ce3:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  804ce8:	53                   	push   %ebx
+  804ce9:	56                   	push   %esi
+  804cea:	e8 f7 fd ff ff       	call   804ae6 <udm>
+  804cef:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804cf3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804cf7:	83 c4 10             	add    $0x10,%esp
+  804cfa:	eb 47                	jmp    804d43 <__moddi3+0x9d>
+  804cfc:	f7 d8                	neg    %eax
+  804cfe:	83 d2 00             	adc    $0x0,%edx
+  804d01:	f7 da                	neg    %edx
+  804d03:	83 ec 04             	sub    $0x4,%esp
+  804d06:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804d0a:	56                   	push   %esi
+  804d0b:	89 cf                	mov    %ecx,%edi
+  804d0d:	f7 df                	neg    %edi
+  804d0f:	89 de                	mov    %ebx,%esi
+  804d11:	83 d6 00             	adc    $0x0,%esi
+  804d14:	f7 de                	neg    %esi
+  804d16:	0f 49 cf             	cmovns %edi,%ecx
+  804d19:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  804d1d:	0f 49 de             	cmovns %esi,%ebx
+  804d20:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  804d24:	ff 74 24 0c          	push   0xc(%esp)
+  804d28:	ff 74 24 0c          	push   0xc(%esp)
+  804d2c:	e8 b5 fd ff ff       	call   804ae6 <udm>
+  804d31:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804d35:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804d39:	f7 d8                	neg    %eax
+  804d3b:	83 d2 00             	adc    $0x0,%edx
+  804d3e:	f7 da                	neg    %edx
+  804d40:	83 c4 10             	add    $0x10,%esp
+  804d43:	83 c4 24             	add    $0x24,%esp
+  804d46:	5b                   	pop    %ebx
+  804d47:	5e                   	pop    %esi
+  804d48:	5f                   	pop    %edi
+  804d49:	5d                   	pop    %ebp
+  804d4a:	c3                   	ret
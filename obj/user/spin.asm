@@ -0,0 +1,9733 @@
+
+obj/user/spin.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 84 00 00 00       	call   8000b5 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 10             	sub    $0x10,%esp
+	envid_t env;
+
+	cprintf("I am the parent.  Forking the child...\n");
+  80003a:	68 40 47 80 00       	push   $0x804740
+  80003f:	e8 a9 01 00 00       	call   8001ed <cprintf>
+	if ((env = fork()) == 0) {
+  800044:	e8 82 12 00 00       	call   8012cb <fork>
+  800049:	83 c4 10             	add    $0x10,%esp
+  80004c:	85 c0                	test   %eax,%eax
+  80004e:	75 12                	jne    800062 <umain+0x2f>
+		cprintf("I am the child.  Spinning...\n");
+  800050:	83 ec 0c             	sub    $0xc,%esp
+  800053:	68 b8 47 80 00       	push   $0x8047b8
+  800058:	e8 90 01 00 00       	call   8001ed <cprintf>
+  80005d:	83 c4 10             	add    $0x10,%esp
+		while (1)
+  800060:	eb fe                	jmp    800060 <umain+0x2d>
+  800062:	89 c3                	mov    %eax,%ebx
+			/* do nothing */;
+	}
+
+	cprintf("I am the parent.  Running the child...\n");
+  800064:	83 ec 0c             	sub    $0xc,%esp
+  800067:	68 68 47 80 00       	push   $0x804768
+  80006c:	e8 7c 01 00 00       	call   8001ed <cprintf>
+	sys_yield();
+  800071:	e8 6d 0b 00 00       	call   800be3 <sys_yield>
+	sys_yield();
+  800076:	e8 68 0b 00 00       	call   800be3 <sys_yield>
+	sys_yield();
+  80007b:	e8 63 0b 00 00       	call   800be3 <sys_yield>
+	sys_yield();
+  800080:	e8 5e 0b 00 00       	call   800be3 <sys_yield>
+	sys_yield();
+  800085:	e8 59 0b 00 00       	call   800be3 <sys_yield>
+	sys_yield();
+  80008a:	e8 54 0b 00 00       	call   800be3 <sys_yield>
+	sys_yield();
+  80008f:	e8 4f 0b 00 00       	call   800be3 <sys_yield>
+	sys_yield();
+  800094:	e8 4a 0b 00 00       	call   800be3 <sys_yield>
+
+	cprintf("I am the parent.  Killing the child...\n");
+  800099:	c7 04 24 90 47 80 00 	movl   $0x804790,(%esp)
+  8000a0:	e8 48 01 00 00       	call   8001ed <cprintf>
+	sys_env_destroy(env);
+  8000a5:	89 1c 24             	mov    %ebx,(%esp)
+  8000a8:	e8 bf 0a 00 00       	call   800b6c <sys_env_destroy>
+}
+  8000ad:	83 c4 10             	add    $0x10,%esp
+  8000b0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000b3:	c9                   	leave
+  8000b4:	c3                   	ret
+
+008000b5 <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000b5:	55                   	push   %ebp
+  8000b6:	89 e5                	mov    %esp,%ebp
+  8000b8:	57                   	push   %edi
+  8000b9:	56                   	push   %esi
+  8000ba:	53                   	push   %ebx
+  8000bb:	83 ec 1c             	sub    $0x1c,%esp
+  8000be:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000c1:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  8000c4:	e8 ee 0a 00 00       	call   800bb7 <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  8000c9:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  8000cc:	89 15 c0 62 80 00    	mov    %edx,0x8062c0
+	thisenv = &envs[ENVX(eid)];
+  8000d2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000d7:	89 c1                	mov    %eax,%ecx
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  8000d9:	89 e7                	mov    %esp,%edi
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8000db:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  8000e1:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8000e6:	77 16                	ja     8000fe <libmain+0x49>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8000e8:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8000ed:	29 f8                	sub    %edi,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  8000ef:	c1 e8 10             	shr    $0x10,%eax
+  8000f2:	74 0a                	je     8000fe <libmain+0x49>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8000f4:	c1 e0 10             	shl    $0x10,%eax
+  8000f7:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8000fc:	29 c2                	sub    %eax,%edx
+  8000fe:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  800101:	c1 e0 04             	shl    $0x4,%eax
+  800104:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800109:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80010b:	85 db                	test   %ebx,%ebx
+  80010d:	7e 07                	jle    800116 <libmain+0x61>
+		binaryname = argv[0];
+  80010f:	8b 06                	mov    (%esi),%eax
+  800111:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  800116:	83 ec 08             	sub    $0x8,%esp
+  800119:	56                   	push   %esi
+  80011a:	53                   	push   %ebx
+  80011b:	e8 13 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800120:	e8 0b 00 00 00       	call   800130 <exit>
+}
+  800125:	83 c4 10             	add    $0x10,%esp
+  800128:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80012b:	5b                   	pop    %ebx
+  80012c:	5e                   	pop    %esi
+  80012d:	5f                   	pop    %edi
+  80012e:	5d                   	pop    %ebp
+  80012f:	c3                   	ret
+
+00800130 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800130:	55                   	push   %ebp
+  800131:	89 e5                	mov    %esp,%ebp
+  800133:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  800136:	6a 00                	push   $0x0
+  800138:	e8 45 27 00 00       	call   802882 <fflush>
+	pthread_kill_others();
+  80013d:	e8 b0 3d 00 00       	call   803ef2 <pthread_kill_others>
+	close_all();
+  800142:	e8 de 17 00 00       	call   801925 <close_all>
+	sys_env_destroy(0);
+  800147:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80014e:	e8 19 0a 00 00       	call   800b6c <sys_env_destroy>
+}
+  800153:	83 c4 10             	add    $0x10,%esp
+  800156:	c9                   	leave
+  800157:	c3                   	ret
+
+00800158 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800158:	55                   	push   %ebp
+  800159:	89 e5                	mov    %esp,%ebp
+  80015b:	53                   	push   %ebx
+  80015c:	83 ec 04             	sub    $0x4,%esp
+  80015f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800162:	8b 13                	mov    (%ebx),%edx
+  800164:	8d 42 01             	lea    0x1(%edx),%eax
+  800167:	89 03                	mov    %eax,(%ebx)
+  800169:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80016c:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800170:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800175:	74 09                	je     800180 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800177:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80017b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80017e:	c9                   	leave
+  80017f:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800180:	83 ec 08             	sub    $0x8,%esp
+  800183:	68 ff 00 00 00       	push   $0xff
+  800188:	8d 43 08             	lea    0x8(%ebx),%eax
+  80018b:	50                   	push   %eax
+  80018c:	e8 84 09 00 00       	call   800b15 <sys_cputs>
+		b->idx = 0;
+  800191:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800197:	83 c4 10             	add    $0x10,%esp
+  80019a:	eb db                	jmp    800177 <putch+0x1f>
+
+0080019c <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80019c:	55                   	push   %ebp
+  80019d:	89 e5                	mov    %esp,%ebp
+  80019f:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001a5:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001ac:	00 00 00 
+	b.cnt = 0;
+  8001af:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001b6:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001b9:	ff 75 0c             	push   0xc(%ebp)
+  8001bc:	ff 75 08             	push   0x8(%ebp)
+  8001bf:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001c5:	50                   	push   %eax
+  8001c6:	68 58 01 80 00       	push   $0x800158
+  8001cb:	e8 14 01 00 00       	call   8002e4 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8001d0:	83 c4 08             	add    $0x8,%esp
+  8001d3:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001d9:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001df:	50                   	push   %eax
+  8001e0:	e8 30 09 00 00       	call   800b15 <sys_cputs>
+
+	return b.cnt;
+}
+  8001e5:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001eb:	c9                   	leave
+  8001ec:	c3                   	ret
+
+008001ed <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001ed:	55                   	push   %ebp
+  8001ee:	89 e5                	mov    %esp,%ebp
+  8001f0:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8001f3:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8001f6:	50                   	push   %eax
+  8001f7:	ff 75 08             	push   0x8(%ebp)
+  8001fa:	e8 9d ff ff ff       	call   80019c <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8001ff:	c9                   	leave
+  800200:	c3                   	ret
+
+00800201 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800201:	55                   	push   %ebp
+  800202:	89 e5                	mov    %esp,%ebp
+  800204:	57                   	push   %edi
+  800205:	56                   	push   %esi
+  800206:	53                   	push   %ebx
+  800207:	83 ec 1c             	sub    $0x1c,%esp
+  80020a:	89 c7                	mov    %eax,%edi
+  80020c:	89 d6                	mov    %edx,%esi
+  80020e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800211:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800214:	89 d1                	mov    %edx,%ecx
+  800216:	89 c2                	mov    %eax,%edx
+  800218:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80021b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80021e:	8b 45 10             	mov    0x10(%ebp),%eax
+  800221:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800224:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800227:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80022e:	39 c2                	cmp    %eax,%edx
+  800230:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800233:	72 3e                	jb     800273 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800235:	83 ec 0c             	sub    $0xc,%esp
+  800238:	ff 75 18             	push   0x18(%ebp)
+  80023b:	83 eb 01             	sub    $0x1,%ebx
+  80023e:	53                   	push   %ebx
+  80023f:	50                   	push   %eax
+  800240:	83 ec 08             	sub    $0x8,%esp
+  800243:	ff 75 e4             	push   -0x1c(%ebp)
+  800246:	ff 75 e0             	push   -0x20(%ebp)
+  800249:	ff 75 dc             	push   -0x24(%ebp)
+  80024c:	ff 75 d8             	push   -0x28(%ebp)
+  80024f:	e8 67 43 00 00       	call   8045bb <__udivdi3>
+  800254:	83 c4 18             	add    $0x18,%esp
+  800257:	52                   	push   %edx
+  800258:	50                   	push   %eax
+  800259:	89 f2                	mov    %esi,%edx
+  80025b:	89 f8                	mov    %edi,%eax
+  80025d:	e8 9f ff ff ff       	call   800201 <printnum>
+  800262:	83 c4 20             	add    $0x20,%esp
+  800265:	eb 13                	jmp    80027a <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800267:	83 ec 08             	sub    $0x8,%esp
+  80026a:	56                   	push   %esi
+  80026b:	ff 75 18             	push   0x18(%ebp)
+  80026e:	ff d7                	call   *%edi
+  800270:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800273:	83 eb 01             	sub    $0x1,%ebx
+  800276:	85 db                	test   %ebx,%ebx
+  800278:	7f ed                	jg     800267 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80027a:	83 ec 08             	sub    $0x8,%esp
+  80027d:	56                   	push   %esi
+  80027e:	83 ec 04             	sub    $0x4,%esp
+  800281:	ff 75 e4             	push   -0x1c(%ebp)
+  800284:	ff 75 e0             	push   -0x20(%ebp)
+  800287:	ff 75 dc             	push   -0x24(%ebp)
+  80028a:	ff 75 d8             	push   -0x28(%ebp)
+  80028d:	e8 4a 43 00 00       	call   8045dc <__umoddi3>
+  800292:	83 c4 14             	add    $0x14,%esp
+  800295:	0f be 80 e0 47 80 00 	movsbl 0x8047e0(%eax),%eax
+  80029c:	50                   	push   %eax
+  80029d:	ff d7                	call   *%edi
+}
+  80029f:	83 c4 10             	add    $0x10,%esp
+  8002a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002a5:	5b                   	pop    %ebx
+  8002a6:	5e                   	pop    %esi
+  8002a7:	5f                   	pop    %edi
+  8002a8:	5d                   	pop    %ebp
+  8002a9:	c3                   	ret
+
+008002aa <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002aa:	55                   	push   %ebp
+  8002ab:	89 e5                	mov    %esp,%ebp
+  8002ad:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002b0:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002b4:	8b 10                	mov    (%eax),%edx
+  8002b6:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002b9:	73 0a                	jae    8002c5 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002bb:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002be:	89 08                	mov    %ecx,(%eax)
+  8002c0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002c3:	88 02                	mov    %al,(%edx)
+}
+  8002c5:	5d                   	pop    %ebp
+  8002c6:	c3                   	ret
+
+008002c7 <printfmt>:
+{
+  8002c7:	55                   	push   %ebp
+  8002c8:	89 e5                	mov    %esp,%ebp
+  8002ca:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8002cd:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8002d0:	50                   	push   %eax
+  8002d1:	ff 75 10             	push   0x10(%ebp)
+  8002d4:	ff 75 0c             	push   0xc(%ebp)
+  8002d7:	ff 75 08             	push   0x8(%ebp)
+  8002da:	e8 05 00 00 00       	call   8002e4 <vprintfmt>
+}
+  8002df:	83 c4 10             	add    $0x10,%esp
+  8002e2:	c9                   	leave
+  8002e3:	c3                   	ret
+
+008002e4 <vprintfmt>:
+{
+  8002e4:	55                   	push   %ebp
+  8002e5:	89 e5                	mov    %esp,%ebp
+  8002e7:	57                   	push   %edi
+  8002e8:	56                   	push   %esi
+  8002e9:	53                   	push   %ebx
+  8002ea:	83 ec 2c             	sub    $0x2c,%esp
+  8002ed:	8b 75 08             	mov    0x8(%ebp),%esi
+  8002f0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002f3:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002f6:	eb 0a                	jmp    800302 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8002f8:	83 ec 08             	sub    $0x8,%esp
+  8002fb:	53                   	push   %ebx
+  8002fc:	50                   	push   %eax
+  8002fd:	ff d6                	call   *%esi
+  8002ff:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  800302:	83 c7 01             	add    $0x1,%edi
+  800305:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  800309:	83 f8 25             	cmp    $0x25,%eax
+  80030c:	74 0c                	je     80031a <vprintfmt+0x36>
+			if (ch == '\0')
+  80030e:	85 c0                	test   %eax,%eax
+  800310:	75 e6                	jne    8002f8 <vprintfmt+0x14>
+}
+  800312:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800315:	5b                   	pop    %ebx
+  800316:	5e                   	pop    %esi
+  800317:	5f                   	pop    %edi
+  800318:	5d                   	pop    %ebp
+  800319:	c3                   	ret
+		padc = ' ';
+  80031a:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80031e:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800325:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80032c:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800333:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  800338:	8d 47 01             	lea    0x1(%edi),%eax
+  80033b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80033e:	0f b6 17             	movzbl (%edi),%edx
+  800341:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800344:	3c 55                	cmp    $0x55,%al
+  800346:	0f 87 c5 03 00 00    	ja     800711 <vprintfmt+0x42d>
+  80034c:	0f b6 c0             	movzbl %al,%eax
+  80034f:	ff 24 85 60 49 80 00 	jmp    *0x804960(,%eax,4)
+  800356:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  800359:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80035c:	eb da                	jmp    800338 <vprintfmt+0x54>
+  80035e:	0f be d2             	movsbl %dl,%edx
+  800361:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800364:	b8 00 00 00 00       	mov    $0x0,%eax
+  800369:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80036c:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80036f:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800373:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800376:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800379:	83 f9 09             	cmp    $0x9,%ecx
+  80037c:	77 55                	ja     8003d3 <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  80037e:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800381:	eb e9                	jmp    80036c <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  800383:	8b 45 14             	mov    0x14(%ebp),%eax
+  800386:	8b 00                	mov    (%eax),%eax
+  800388:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80038b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80038e:	8d 40 04             	lea    0x4(%eax),%eax
+  800391:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  800394:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800397:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80039b:	79 9b                	jns    800338 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80039d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003a0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003a3:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003aa:	eb 8c                	jmp    800338 <vprintfmt+0x54>
+			if (width < 0)
+  8003ac:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003af:	85 d2                	test   %edx,%edx
+  8003b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003b6:	0f 49 c2             	cmovns %edx,%eax
+  8003b9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  8003bc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003bf:	e9 74 ff ff ff       	jmp    800338 <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  8003c4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8003c7:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003ce:	e9 65 ff ff ff       	jmp    800338 <vprintfmt+0x54>
+  8003d3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003d6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003d9:	eb bc                	jmp    800397 <vprintfmt+0xb3>
+			lflag++;
+  8003db:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  8003de:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003e1:	e9 52 ff ff ff       	jmp    800338 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8003e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003e9:	8d 78 04             	lea    0x4(%eax),%edi
+  8003ec:	83 ec 08             	sub    $0x8,%esp
+  8003ef:	53                   	push   %ebx
+  8003f0:	ff 30                	push   (%eax)
+  8003f2:	ff d6                	call   *%esi
+			break;
+  8003f4:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8003f7:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8003fa:	e9 b1 02 00 00       	jmp    8006b0 <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  8003ff:	8b 45 14             	mov    0x14(%ebp),%eax
+  800402:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800405:	8b 10                	mov    (%eax),%edx
+  800407:	89 d0                	mov    %edx,%eax
+  800409:	f7 d8                	neg    %eax
+  80040b:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80040e:	83 f8 14             	cmp    $0x14,%eax
+  800411:	7f 23                	jg     800436 <vprintfmt+0x152>
+  800413:	8b 14 85 c0 4a 80 00 	mov    0x804ac0(,%eax,4),%edx
+  80041a:	85 d2                	test   %edx,%edx
+  80041c:	74 18                	je     800436 <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  80041e:	52                   	push   %edx
+  80041f:	68 03 4d 80 00       	push   $0x804d03
+  800424:	53                   	push   %ebx
+  800425:	56                   	push   %esi
+  800426:	e8 9c fe ff ff       	call   8002c7 <printfmt>
+  80042b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80042e:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800431:	e9 7a 02 00 00       	jmp    8006b0 <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  800436:	50                   	push   %eax
+  800437:	68 f8 47 80 00       	push   $0x8047f8
+  80043c:	53                   	push   %ebx
+  80043d:	56                   	push   %esi
+  80043e:	e8 84 fe ff ff       	call   8002c7 <printfmt>
+  800443:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800446:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800449:	e9 62 02 00 00       	jmp    8006b0 <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80044e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800451:	83 c0 04             	add    $0x4,%eax
+  800454:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800457:	8b 45 14             	mov    0x14(%ebp),%eax
+  80045a:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80045c:	85 c9                	test   %ecx,%ecx
+  80045e:	b8 f1 47 80 00       	mov    $0x8047f1,%eax
+  800463:	0f 45 c1             	cmovne %ecx,%eax
+  800466:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800469:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80046d:	7e 06                	jle    800475 <vprintfmt+0x191>
+  80046f:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800473:	75 0b                	jne    800480 <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800475:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800478:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80047b:	89 75 08             	mov    %esi,0x8(%ebp)
+  80047e:	eb 5c                	jmp    8004dc <vprintfmt+0x1f8>
+  800480:	83 ec 08             	sub    $0x8,%esp
+  800483:	ff 75 d0             	push   -0x30(%ebp)
+  800486:	ff 75 cc             	push   -0x34(%ebp)
+  800489:	e8 20 03 00 00       	call   8007ae <strnlen>
+  80048e:	89 c2                	mov    %eax,%edx
+  800490:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800493:	29 d0                	sub    %edx,%eax
+  800495:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800498:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80049c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80049f:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004a2:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004a4:	eb 0e                	jmp    8004b4 <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  8004a6:	83 ec 08             	sub    $0x8,%esp
+  8004a9:	53                   	push   %ebx
+  8004aa:	57                   	push   %edi
+  8004ab:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004ae:	83 ee 01             	sub    $0x1,%esi
+  8004b1:	83 c4 10             	add    $0x10,%esp
+  8004b4:	85 f6                	test   %esi,%esi
+  8004b6:	7f ee                	jg     8004a6 <vprintfmt+0x1c2>
+  8004b8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004bb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004be:	85 c0                	test   %eax,%eax
+  8004c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004c5:	0f 49 d0             	cmovns %eax,%edx
+  8004c8:	29 d0                	sub    %edx,%eax
+  8004ca:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004cd:	eb a6                	jmp    800475 <vprintfmt+0x191>
+					putch(ch, putdat);
+  8004cf:	83 ec 08             	sub    $0x8,%esp
+  8004d2:	53                   	push   %ebx
+  8004d3:	52                   	push   %edx
+  8004d4:	ff 55 08             	call   *0x8(%ebp)
+  8004d7:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004da:	89 f1                	mov    %esi,%ecx
+  8004dc:	8d 71 01             	lea    0x1(%ecx),%esi
+  8004df:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004e3:	0f be d0             	movsbl %al,%edx
+  8004e6:	85 d2                	test   %edx,%edx
+  8004e8:	74 28                	je     800512 <vprintfmt+0x22e>
+  8004ea:	85 ff                	test   %edi,%edi
+  8004ec:	78 05                	js     8004f3 <vprintfmt+0x20f>
+  8004ee:	83 ef 01             	sub    $0x1,%edi
+  8004f1:	78 30                	js     800523 <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8004f3:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8004f7:	74 d6                	je     8004cf <vprintfmt+0x1eb>
+  8004f9:	0f be c0             	movsbl %al,%eax
+  8004fc:	83 e8 20             	sub    $0x20,%eax
+  8004ff:	83 f8 5e             	cmp    $0x5e,%eax
+  800502:	76 cb                	jbe    8004cf <vprintfmt+0x1eb>
+					putch('?', putdat);
+  800504:	83 ec 08             	sub    $0x8,%esp
+  800507:	53                   	push   %ebx
+  800508:	6a 3f                	push   $0x3f
+  80050a:	ff 55 08             	call   *0x8(%ebp)
+  80050d:	83 c4 10             	add    $0x10,%esp
+  800510:	eb c8                	jmp    8004da <vprintfmt+0x1f6>
+  800512:	8b 75 08             	mov    0x8(%ebp),%esi
+  800515:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800518:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80051b:	01 d0                	add    %edx,%eax
+  80051d:	29 c8                	sub    %ecx,%eax
+  80051f:	89 c7                	mov    %eax,%edi
+  800521:	eb 13                	jmp    800536 <vprintfmt+0x252>
+  800523:	8b 75 08             	mov    0x8(%ebp),%esi
+  800526:	eb ed                	jmp    800515 <vprintfmt+0x231>
+				putch(' ', putdat);
+  800528:	83 ec 08             	sub    $0x8,%esp
+  80052b:	53                   	push   %ebx
+  80052c:	6a 20                	push   $0x20
+  80052e:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800530:	83 ef 01             	sub    $0x1,%edi
+  800533:	83 c4 10             	add    $0x10,%esp
+  800536:	85 ff                	test   %edi,%edi
+  800538:	7f ee                	jg     800528 <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80053a:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80053d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800540:	e9 6b 01 00 00       	jmp    8006b0 <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  800545:	83 f9 01             	cmp    $0x1,%ecx
+  800548:	7f 1f                	jg     800569 <vprintfmt+0x285>
+	else if (lflag)
+  80054a:	85 c9                	test   %ecx,%ecx
+  80054c:	74 67                	je     8005b5 <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  80054e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800551:	8b 00                	mov    (%eax),%eax
+  800553:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800556:	89 c1                	mov    %eax,%ecx
+  800558:	c1 f9 1f             	sar    $0x1f,%ecx
+  80055b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80055e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800561:	8d 40 04             	lea    0x4(%eax),%eax
+  800564:	89 45 14             	mov    %eax,0x14(%ebp)
+  800567:	eb 17                	jmp    800580 <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  800569:	8b 45 14             	mov    0x14(%ebp),%eax
+  80056c:	8b 50 04             	mov    0x4(%eax),%edx
+  80056f:	8b 00                	mov    (%eax),%eax
+  800571:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800574:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800577:	8b 45 14             	mov    0x14(%ebp),%eax
+  80057a:	8d 40 08             	lea    0x8(%eax),%eax
+  80057d:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800580:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800583:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800586:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80058b:	85 c9                	test   %ecx,%ecx
+  80058d:	0f 89 03 01 00 00    	jns    800696 <vprintfmt+0x3b2>
+				putch('-', putdat);
+  800593:	83 ec 08             	sub    $0x8,%esp
+  800596:	53                   	push   %ebx
+  800597:	6a 2d                	push   $0x2d
+  800599:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80059b:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80059e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005a1:	f7 da                	neg    %edx
+  8005a3:	83 d1 00             	adc    $0x0,%ecx
+  8005a6:	f7 d9                	neg    %ecx
+  8005a8:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8005ab:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005b0:	e9 e1 00 00 00       	jmp    800696 <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  8005b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b8:	8b 00                	mov    (%eax),%eax
+  8005ba:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005bd:	89 c1                	mov    %eax,%ecx
+  8005bf:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005c2:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005c5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c8:	8d 40 04             	lea    0x4(%eax),%eax
+  8005cb:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005ce:	eb b0                	jmp    800580 <vprintfmt+0x29c>
+	if (lflag >= 2)
+  8005d0:	83 f9 01             	cmp    $0x1,%ecx
+  8005d3:	7f 1e                	jg     8005f3 <vprintfmt+0x30f>
+	else if (lflag)
+  8005d5:	85 c9                	test   %ecx,%ecx
+  8005d7:	74 32                	je     80060b <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  8005d9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005dc:	8b 10                	mov    (%eax),%edx
+  8005de:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005e3:	8d 40 04             	lea    0x4(%eax),%eax
+  8005e6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005e9:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8005ee:	e9 a3 00 00 00       	jmp    800696 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8005f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f6:	8b 10                	mov    (%eax),%edx
+  8005f8:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005fb:	8d 40 08             	lea    0x8(%eax),%eax
+  8005fe:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800601:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800606:	e9 8b 00 00 00       	jmp    800696 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  80060b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060e:	8b 10                	mov    (%eax),%edx
+  800610:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800615:	8d 40 04             	lea    0x4(%eax),%eax
+  800618:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80061b:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800620:	eb 74                	jmp    800696 <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  800622:	83 f9 01             	cmp    $0x1,%ecx
+  800625:	7f 1b                	jg     800642 <vprintfmt+0x35e>
+	else if (lflag)
+  800627:	85 c9                	test   %ecx,%ecx
+  800629:	74 2c                	je     800657 <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  80062b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062e:	8b 10                	mov    (%eax),%edx
+  800630:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800635:	8d 40 04             	lea    0x4(%eax),%eax
+  800638:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80063b:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800640:	eb 54                	jmp    800696 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800642:	8b 45 14             	mov    0x14(%ebp),%eax
+  800645:	8b 10                	mov    (%eax),%edx
+  800647:	8b 48 04             	mov    0x4(%eax),%ecx
+  80064a:	8d 40 08             	lea    0x8(%eax),%eax
+  80064d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800650:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800655:	eb 3f                	jmp    800696 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800657:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065a:	8b 10                	mov    (%eax),%edx
+  80065c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800661:	8d 40 04             	lea    0x4(%eax),%eax
+  800664:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800667:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  80066c:	eb 28                	jmp    800696 <vprintfmt+0x3b2>
+			putch('0', putdat);
+  80066e:	83 ec 08             	sub    $0x8,%esp
+  800671:	53                   	push   %ebx
+  800672:	6a 30                	push   $0x30
+  800674:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800676:	83 c4 08             	add    $0x8,%esp
+  800679:	53                   	push   %ebx
+  80067a:	6a 78                	push   $0x78
+  80067c:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80067e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800681:	8b 10                	mov    (%eax),%edx
+  800683:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800688:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80068b:	8d 40 04             	lea    0x4(%eax),%eax
+  80068e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800691:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800696:	83 ec 0c             	sub    $0xc,%esp
+  800699:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80069d:	50                   	push   %eax
+  80069e:	ff 75 e0             	push   -0x20(%ebp)
+  8006a1:	57                   	push   %edi
+  8006a2:	51                   	push   %ecx
+  8006a3:	52                   	push   %edx
+  8006a4:	89 da                	mov    %ebx,%edx
+  8006a6:	89 f0                	mov    %esi,%eax
+  8006a8:	e8 54 fb ff ff       	call   800201 <printnum>
+			break;
+  8006ad:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8006b0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  8006b3:	e9 4a fc ff ff       	jmp    800302 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8006b8:	83 f9 01             	cmp    $0x1,%ecx
+  8006bb:	7f 1b                	jg     8006d8 <vprintfmt+0x3f4>
+	else if (lflag)
+  8006bd:	85 c9                	test   %ecx,%ecx
+  8006bf:	74 2c                	je     8006ed <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  8006c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c4:	8b 10                	mov    (%eax),%edx
+  8006c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006cb:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ce:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006d1:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8006d6:	eb be                	jmp    800696 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8006d8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006db:	8b 10                	mov    (%eax),%edx
+  8006dd:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006e0:	8d 40 08             	lea    0x8(%eax),%eax
+  8006e3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006e6:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8006eb:	eb a9                	jmp    800696 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8006ed:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f0:	8b 10                	mov    (%eax),%edx
+  8006f2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006f7:	8d 40 04             	lea    0x4(%eax),%eax
+  8006fa:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006fd:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800702:	eb 92                	jmp    800696 <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  800704:	83 ec 08             	sub    $0x8,%esp
+  800707:	53                   	push   %ebx
+  800708:	6a 25                	push   $0x25
+  80070a:	ff d6                	call   *%esi
+			break;
+  80070c:	83 c4 10             	add    $0x10,%esp
+  80070f:	eb 9f                	jmp    8006b0 <vprintfmt+0x3cc>
+			putch('%', putdat);
+  800711:	83 ec 08             	sub    $0x8,%esp
+  800714:	53                   	push   %ebx
+  800715:	6a 25                	push   $0x25
+  800717:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800719:	83 c4 10             	add    $0x10,%esp
+  80071c:	89 f8                	mov    %edi,%eax
+  80071e:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800722:	74 05                	je     800729 <vprintfmt+0x445>
+  800724:	83 e8 01             	sub    $0x1,%eax
+  800727:	eb f5                	jmp    80071e <vprintfmt+0x43a>
+  800729:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80072c:	eb 82                	jmp    8006b0 <vprintfmt+0x3cc>
+
+0080072e <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80072e:	55                   	push   %ebp
+  80072f:	89 e5                	mov    %esp,%ebp
+  800731:	83 ec 18             	sub    $0x18,%esp
+  800734:	8b 45 08             	mov    0x8(%ebp),%eax
+  800737:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80073a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80073d:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800741:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800744:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80074b:	85 c0                	test   %eax,%eax
+  80074d:	74 26                	je     800775 <vsnprintf+0x47>
+  80074f:	85 d2                	test   %edx,%edx
+  800751:	7e 22                	jle    800775 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800753:	ff 75 14             	push   0x14(%ebp)
+  800756:	ff 75 10             	push   0x10(%ebp)
+  800759:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80075c:	50                   	push   %eax
+  80075d:	68 aa 02 80 00       	push   $0x8002aa
+  800762:	e8 7d fb ff ff       	call   8002e4 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800767:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80076a:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80076d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800770:	83 c4 10             	add    $0x10,%esp
+}
+  800773:	c9                   	leave
+  800774:	c3                   	ret
+		return -E_INVAL;
+  800775:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80077a:	eb f7                	jmp    800773 <vsnprintf+0x45>
+
+0080077c <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80077c:	55                   	push   %ebp
+  80077d:	89 e5                	mov    %esp,%ebp
+  80077f:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800782:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800785:	50                   	push   %eax
+  800786:	ff 75 10             	push   0x10(%ebp)
+  800789:	ff 75 0c             	push   0xc(%ebp)
+  80078c:	ff 75 08             	push   0x8(%ebp)
+  80078f:	e8 9a ff ff ff       	call   80072e <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800794:	c9                   	leave
+  800795:	c3                   	ret
+
+00800796 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800796:	55                   	push   %ebp
+  800797:	89 e5                	mov    %esp,%ebp
+  800799:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80079c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007a1:	eb 03                	jmp    8007a6 <strlen+0x10>
+		n++;
+  8007a3:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8007a6:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007aa:	75 f7                	jne    8007a3 <strlen+0xd>
+	return n;
+}
+  8007ac:	5d                   	pop    %ebp
+  8007ad:	c3                   	ret
+
+008007ae <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8007ae:	55                   	push   %ebp
+  8007af:	89 e5                	mov    %esp,%ebp
+  8007b1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007b4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007bc:	eb 03                	jmp    8007c1 <strnlen+0x13>
+		n++;
+  8007be:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007c1:	39 d0                	cmp    %edx,%eax
+  8007c3:	74 08                	je     8007cd <strnlen+0x1f>
+  8007c5:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8007c9:	75 f3                	jne    8007be <strnlen+0x10>
+  8007cb:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8007cd:	89 d0                	mov    %edx,%eax
+  8007cf:	5d                   	pop    %ebp
+  8007d0:	c3                   	ret
+
+008007d1 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8007d1:	55                   	push   %ebp
+  8007d2:	89 e5                	mov    %esp,%ebp
+  8007d4:	53                   	push   %ebx
+  8007d5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007d8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8007db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007e0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8007e4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8007e7:	83 c0 01             	add    $0x1,%eax
+  8007ea:	84 d2                	test   %dl,%dl
+  8007ec:	75 f2                	jne    8007e0 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8007ee:	89 c8                	mov    %ecx,%eax
+  8007f0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007f3:	c9                   	leave
+  8007f4:	c3                   	ret
+
+008007f5 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8007f5:	55                   	push   %ebp
+  8007f6:	89 e5                	mov    %esp,%ebp
+  8007f8:	53                   	push   %ebx
+  8007f9:	83 ec 10             	sub    $0x10,%esp
+  8007fc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8007ff:	53                   	push   %ebx
+  800800:	e8 91 ff ff ff       	call   800796 <strlen>
+  800805:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800808:	ff 75 0c             	push   0xc(%ebp)
+  80080b:	01 d8                	add    %ebx,%eax
+  80080d:	50                   	push   %eax
+  80080e:	e8 be ff ff ff       	call   8007d1 <strcpy>
+	return dst;
+}
+  800813:	89 d8                	mov    %ebx,%eax
+  800815:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800818:	c9                   	leave
+  800819:	c3                   	ret
+
+0080081a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80081a:	55                   	push   %ebp
+  80081b:	89 e5                	mov    %esp,%ebp
+  80081d:	56                   	push   %esi
+  80081e:	53                   	push   %ebx
+  80081f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800822:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800825:	89 f3                	mov    %esi,%ebx
+  800827:	03 5d 10             	add    0x10(%ebp),%ebx
+  80082a:	89 f0                	mov    %esi,%eax
+  80082c:	eb 0f                	jmp    80083d <strncpy+0x23>
+		*dst++ = *src;
+  80082e:	83 c0 01             	add    $0x1,%eax
+  800831:	0f b6 0a             	movzbl (%edx),%ecx
+  800834:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800837:	80 f9 01             	cmp    $0x1,%cl
+  80083a:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80083d:	39 d8                	cmp    %ebx,%eax
+  80083f:	75 ed                	jne    80082e <strncpy+0x14>
+	}
+	return ret;
+}
+  800841:	89 f0                	mov    %esi,%eax
+  800843:	5b                   	pop    %ebx
+  800844:	5e                   	pop    %esi
+  800845:	5d                   	pop    %ebp
+  800846:	c3                   	ret
+
+00800847 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800847:	55                   	push   %ebp
+  800848:	89 e5                	mov    %esp,%ebp
+  80084a:	56                   	push   %esi
+  80084b:	53                   	push   %ebx
+  80084c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80084f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800852:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800855:	89 f0                	mov    %esi,%eax
+  800857:	85 d2                	test   %edx,%edx
+  800859:	74 21                	je     80087c <strlcpy+0x35>
+  80085b:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80085f:	89 f2                	mov    %esi,%edx
+  800861:	eb 09                	jmp    80086c <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800863:	83 c1 01             	add    $0x1,%ecx
+  800866:	83 c2 01             	add    $0x1,%edx
+  800869:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80086c:	39 c2                	cmp    %eax,%edx
+  80086e:	74 09                	je     800879 <strlcpy+0x32>
+  800870:	0f b6 19             	movzbl (%ecx),%ebx
+  800873:	84 db                	test   %bl,%bl
+  800875:	75 ec                	jne    800863 <strlcpy+0x1c>
+  800877:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800879:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80087c:	29 f0                	sub    %esi,%eax
+}
+  80087e:	5b                   	pop    %ebx
+  80087f:	5e                   	pop    %esi
+  800880:	5d                   	pop    %ebp
+  800881:	c3                   	ret
+
+00800882 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800882:	55                   	push   %ebp
+  800883:	89 e5                	mov    %esp,%ebp
+  800885:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800888:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80088b:	eb 06                	jmp    800893 <strcmp+0x11>
+		p++, q++;
+  80088d:	83 c1 01             	add    $0x1,%ecx
+  800890:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800893:	0f b6 01             	movzbl (%ecx),%eax
+  800896:	84 c0                	test   %al,%al
+  800898:	74 04                	je     80089e <strcmp+0x1c>
+  80089a:	3a 02                	cmp    (%edx),%al
+  80089c:	74 ef                	je     80088d <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80089e:	0f b6 c0             	movzbl %al,%eax
+  8008a1:	0f b6 12             	movzbl (%edx),%edx
+  8008a4:	29 d0                	sub    %edx,%eax
+}
+  8008a6:	5d                   	pop    %ebp
+  8008a7:	c3                   	ret
+
+008008a8 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008a8:	55                   	push   %ebp
+  8008a9:	89 e5                	mov    %esp,%ebp
+  8008ab:	53                   	push   %ebx
+  8008ac:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008b2:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8008b5:	eb 09                	jmp    8008c0 <strncmp+0x18>
+		n--, p++, q++;
+  8008b7:	83 ea 01             	sub    $0x1,%edx
+  8008ba:	83 c0 01             	add    $0x1,%eax
+  8008bd:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8008c0:	85 d2                	test   %edx,%edx
+  8008c2:	74 18                	je     8008dc <strncmp+0x34>
+  8008c4:	0f b6 18             	movzbl (%eax),%ebx
+  8008c7:	84 db                	test   %bl,%bl
+  8008c9:	74 04                	je     8008cf <strncmp+0x27>
+  8008cb:	3a 19                	cmp    (%ecx),%bl
+  8008cd:	74 e8                	je     8008b7 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008cf:	0f b6 00             	movzbl (%eax),%eax
+  8008d2:	0f b6 11             	movzbl (%ecx),%edx
+  8008d5:	29 d0                	sub    %edx,%eax
+}
+  8008d7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008da:	c9                   	leave
+  8008db:	c3                   	ret
+		return 0;
+  8008dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008e1:	eb f4                	jmp    8008d7 <strncmp+0x2f>
+
+008008e3 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8008e3:	55                   	push   %ebp
+  8008e4:	89 e5                	mov    %esp,%ebp
+  8008e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008e9:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008ed:	eb 03                	jmp    8008f2 <strchr+0xf>
+  8008ef:	83 c0 01             	add    $0x1,%eax
+  8008f2:	0f b6 10             	movzbl (%eax),%edx
+  8008f5:	84 d2                	test   %dl,%dl
+  8008f7:	74 06                	je     8008ff <strchr+0x1c>
+		if (*s == c)
+  8008f9:	38 ca                	cmp    %cl,%dl
+  8008fb:	75 f2                	jne    8008ef <strchr+0xc>
+  8008fd:	eb 05                	jmp    800904 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8008ff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800904:	5d                   	pop    %ebp
+  800905:	c3                   	ret
+
+00800906 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800906:	55                   	push   %ebp
+  800907:	89 e5                	mov    %esp,%ebp
+  800909:	8b 45 08             	mov    0x8(%ebp),%eax
+  80090c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800910:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800913:	38 ca                	cmp    %cl,%dl
+  800915:	74 09                	je     800920 <strfind+0x1a>
+  800917:	84 d2                	test   %dl,%dl
+  800919:	74 05                	je     800920 <strfind+0x1a>
+	for (; *s; s++)
+  80091b:	83 c0 01             	add    $0x1,%eax
+  80091e:	eb f0                	jmp    800910 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800920:	5d                   	pop    %ebp
+  800921:	c3                   	ret
+
+00800922 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800922:	55                   	push   %ebp
+  800923:	89 e5                	mov    %esp,%ebp
+  800925:	57                   	push   %edi
+  800926:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800929:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80092c:	85 c9                	test   %ecx,%ecx
+  80092e:	74 20                	je     800950 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800930:	89 f8                	mov    %edi,%eax
+  800932:	09 c8                	or     %ecx,%eax
+  800934:	a8 03                	test   $0x3,%al
+  800936:	75 12                	jne    80094a <memset+0x28>
+		c &= 0xFF;
+  800938:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80093c:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800942:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800945:	fc                   	cld
+  800946:	f3 ab                	rep stos %eax,%es:(%edi)
+  800948:	eb 06                	jmp    800950 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80094a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80094d:	fc                   	cld
+  80094e:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800950:	89 f8                	mov    %edi,%eax
+  800952:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800955:	c9                   	leave
+  800956:	c3                   	ret
+
+00800957 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800957:	55                   	push   %ebp
+  800958:	89 e5                	mov    %esp,%ebp
+  80095a:	57                   	push   %edi
+  80095b:	56                   	push   %esi
+  80095c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80095f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800962:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800965:	39 c6                	cmp    %eax,%esi
+  800967:	73 32                	jae    80099b <memmove+0x44>
+  800969:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80096c:	39 d0                	cmp    %edx,%eax
+  80096e:	73 2b                	jae    80099b <memmove+0x44>
+		s += n;
+		d += n;
+  800970:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800973:	89 d6                	mov    %edx,%esi
+  800975:	09 fe                	or     %edi,%esi
+  800977:	09 ce                	or     %ecx,%esi
+  800979:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  80097f:	75 0e                	jne    80098f <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800981:	83 ef 04             	sub    $0x4,%edi
+  800984:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800987:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  80098a:	fd                   	std
+  80098b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80098d:	eb 09                	jmp    800998 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80098f:	83 ef 01             	sub    $0x1,%edi
+  800992:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800995:	fd                   	std
+  800996:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800998:	fc                   	cld
+  800999:	eb 1a                	jmp    8009b5 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80099b:	89 f2                	mov    %esi,%edx
+  80099d:	09 c2                	or     %eax,%edx
+  80099f:	09 ca                	or     %ecx,%edx
+  8009a1:	f6 c2 03             	test   $0x3,%dl
+  8009a4:	75 0a                	jne    8009b0 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009a6:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8009a9:	89 c7                	mov    %eax,%edi
+  8009ab:	fc                   	cld
+  8009ac:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009ae:	eb 05                	jmp    8009b5 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8009b0:	89 c7                	mov    %eax,%edi
+  8009b2:	fc                   	cld
+  8009b3:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8009b5:	5e                   	pop    %esi
+  8009b6:	5f                   	pop    %edi
+  8009b7:	5d                   	pop    %ebp
+  8009b8:	c3                   	ret
+
+008009b9 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8009b9:	55                   	push   %ebp
+  8009ba:	89 e5                	mov    %esp,%ebp
+  8009bc:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8009bf:	ff 75 10             	push   0x10(%ebp)
+  8009c2:	ff 75 0c             	push   0xc(%ebp)
+  8009c5:	ff 75 08             	push   0x8(%ebp)
+  8009c8:	e8 8a ff ff ff       	call   800957 <memmove>
+}
+  8009cd:	c9                   	leave
+  8009ce:	c3                   	ret
+
+008009cf <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8009cf:	55                   	push   %ebp
+  8009d0:	89 e5                	mov    %esp,%ebp
+  8009d2:	56                   	push   %esi
+  8009d3:	53                   	push   %ebx
+  8009d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009d7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8009da:	89 c6                	mov    %eax,%esi
+  8009dc:	03 75 10             	add    0x10(%ebp),%esi
+  8009df:	eb 06                	jmp    8009e7 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8009e1:	83 c0 01             	add    $0x1,%eax
+  8009e4:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8009e7:	39 f0                	cmp    %esi,%eax
+  8009e9:	74 14                	je     8009ff <memcmp+0x30>
+		if (*s1 != *s2)
+  8009eb:	0f b6 08             	movzbl (%eax),%ecx
+  8009ee:	0f b6 1a             	movzbl (%edx),%ebx
+  8009f1:	38 d9                	cmp    %bl,%cl
+  8009f3:	74 ec                	je     8009e1 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  8009f5:	0f b6 c1             	movzbl %cl,%eax
+  8009f8:	0f b6 db             	movzbl %bl,%ebx
+  8009fb:	29 d8                	sub    %ebx,%eax
+  8009fd:	eb 05                	jmp    800a04 <memcmp+0x35>
+	}
+
+	return 0;
+  8009ff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a04:	5b                   	pop    %ebx
+  800a05:	5e                   	pop    %esi
+  800a06:	5d                   	pop    %ebp
+  800a07:	c3                   	ret
+
+00800a08 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a08:	55                   	push   %ebp
+  800a09:	89 e5                	mov    %esp,%ebp
+  800a0b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a0e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a11:	89 c2                	mov    %eax,%edx
+  800a13:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a16:	eb 03                	jmp    800a1b <memfind+0x13>
+  800a18:	83 c0 01             	add    $0x1,%eax
+  800a1b:	39 d0                	cmp    %edx,%eax
+  800a1d:	73 04                	jae    800a23 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a1f:	38 08                	cmp    %cl,(%eax)
+  800a21:	75 f5                	jne    800a18 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a23:	5d                   	pop    %ebp
+  800a24:	c3                   	ret
+
+00800a25 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a25:	55                   	push   %ebp
+  800a26:	89 e5                	mov    %esp,%ebp
+  800a28:	57                   	push   %edi
+  800a29:	56                   	push   %esi
+  800a2a:	53                   	push   %ebx
+  800a2b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a2e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a31:	eb 03                	jmp    800a36 <strtol+0x11>
+		s++;
+  800a33:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a36:	0f b6 02             	movzbl (%edx),%eax
+  800a39:	3c 20                	cmp    $0x20,%al
+  800a3b:	74 f6                	je     800a33 <strtol+0xe>
+  800a3d:	3c 09                	cmp    $0x9,%al
+  800a3f:	74 f2                	je     800a33 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a41:	3c 2b                	cmp    $0x2b,%al
+  800a43:	74 2a                	je     800a6f <strtol+0x4a>
+	int neg = 0;
+  800a45:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a4a:	3c 2d                	cmp    $0x2d,%al
+  800a4c:	74 2b                	je     800a79 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a4e:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a54:	75 0f                	jne    800a65 <strtol+0x40>
+  800a56:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a59:	74 28                	je     800a83 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a5b:	85 db                	test   %ebx,%ebx
+  800a5d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a62:	0f 44 d8             	cmove  %eax,%ebx
+  800a65:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a6a:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a6d:	eb 46                	jmp    800ab5 <strtol+0x90>
+		s++;
+  800a6f:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a72:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a77:	eb d5                	jmp    800a4e <strtol+0x29>
+		s++, neg = 1;
+  800a79:	83 c2 01             	add    $0x1,%edx
+  800a7c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a81:	eb cb                	jmp    800a4e <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a83:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a87:	74 0e                	je     800a97 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a89:	85 db                	test   %ebx,%ebx
+  800a8b:	75 d8                	jne    800a65 <strtol+0x40>
+		s++, base = 8;
+  800a8d:	83 c2 01             	add    $0x1,%edx
+  800a90:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a95:	eb ce                	jmp    800a65 <strtol+0x40>
+		s += 2, base = 16;
+  800a97:	83 c2 02             	add    $0x2,%edx
+  800a9a:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a9f:	eb c4                	jmp    800a65 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800aa1:	0f be c0             	movsbl %al,%eax
+  800aa4:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800aa7:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800aaa:	7d 3a                	jge    800ae6 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800aac:	83 c2 01             	add    $0x1,%edx
+  800aaf:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800ab3:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800ab5:	0f b6 02             	movzbl (%edx),%eax
+  800ab8:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800abb:	89 f3                	mov    %esi,%ebx
+  800abd:	80 fb 09             	cmp    $0x9,%bl
+  800ac0:	76 df                	jbe    800aa1 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800ac2:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800ac5:	89 f3                	mov    %esi,%ebx
+  800ac7:	80 fb 19             	cmp    $0x19,%bl
+  800aca:	77 08                	ja     800ad4 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800acc:	0f be c0             	movsbl %al,%eax
+  800acf:	83 e8 57             	sub    $0x57,%eax
+  800ad2:	eb d3                	jmp    800aa7 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800ad4:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800ad7:	89 f3                	mov    %esi,%ebx
+  800ad9:	80 fb 19             	cmp    $0x19,%bl
+  800adc:	77 08                	ja     800ae6 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800ade:	0f be c0             	movsbl %al,%eax
+  800ae1:	83 e8 37             	sub    $0x37,%eax
+  800ae4:	eb c1                	jmp    800aa7 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800ae6:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800aea:	74 05                	je     800af1 <strtol+0xcc>
+		*endptr = (char *) s;
+  800aec:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800aef:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800af1:	89 c8                	mov    %ecx,%eax
+  800af3:	f7 d8                	neg    %eax
+  800af5:	85 ff                	test   %edi,%edi
+  800af7:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800afa:	89 c8                	mov    %ecx,%eax
+  800afc:	5b                   	pop    %ebx
+  800afd:	5e                   	pop    %esi
+  800afe:	5f                   	pop    %edi
+  800aff:	5d                   	pop    %ebp
+  800b00:	c3                   	ret
+
+00800b01 <atoi>:
+
+int
+atoi(const char* s)
+{
+  800b01:	55                   	push   %ebp
+  800b02:	89 e5                	mov    %esp,%ebp
+  800b04:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  800b07:	6a 00                	push   $0x0
+  800b09:	6a 00                	push   $0x0
+  800b0b:	ff 75 08             	push   0x8(%ebp)
+  800b0e:	e8 12 ff ff ff       	call   800a25 <strtol>
+}
+  800b13:	c9                   	leave
+  800b14:	c3                   	ret
+
+00800b15 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800b15:	55                   	push   %ebp
+  800b16:	89 e5                	mov    %esp,%ebp
+  800b18:	57                   	push   %edi
+  800b19:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800b1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b1f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b22:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b25:	89 c3                	mov    %eax,%ebx
+  800b27:	89 c7                	mov    %eax,%edi
+  800b29:	6a 00                	push   $0x0
+  800b2b:	55                   	push   %ebp
+  800b2c:	56                   	push   %esi
+  800b2d:	89 e5                	mov    %esp,%ebp
+  800b2f:	8d 35 37 0b 80 00    	lea    0x800b37,%esi
+  800b35:	0f 34                	sysenter
+
+00800b37 <after_sysenter_label_47>:
+  800b37:	5e                   	pop    %esi
+  800b38:	5d                   	pop    %ebp
+  800b39:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800b3c:	5b                   	pop    %ebx
+  800b3d:	5f                   	pop    %edi
+  800b3e:	5d                   	pop    %ebp
+  800b3f:	c3                   	ret
+
+00800b40 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800b40:	55                   	push   %ebp
+  800b41:	89 e5                	mov    %esp,%ebp
+  800b43:	57                   	push   %edi
+  800b44:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800b45:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b4a:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b4f:	89 d1                	mov    %edx,%ecx
+  800b51:	89 d3                	mov    %edx,%ebx
+  800b53:	89 d7                	mov    %edx,%edi
+  800b55:	6a 00                	push   $0x0
+  800b57:	55                   	push   %ebp
+  800b58:	56                   	push   %esi
+  800b59:	89 e5                	mov    %esp,%ebp
+  800b5b:	8d 35 63 0b 80 00    	lea    0x800b63,%esi
+  800b61:	0f 34                	sysenter
+
+00800b63 <after_sysenter_label_128>:
+  800b63:	5e                   	pop    %esi
+  800b64:	5d                   	pop    %ebp
+  800b65:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800b68:	5b                   	pop    %ebx
+  800b69:	5f                   	pop    %edi
+  800b6a:	5d                   	pop    %ebp
+  800b6b:	c3                   	ret
+
+00800b6c <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800b6c:	55                   	push   %ebp
+  800b6d:	89 e5                	mov    %esp,%ebp
+  800b6f:	57                   	push   %edi
+  800b70:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800b71:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b74:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b79:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b7e:	89 cb                	mov    %ecx,%ebx
+  800b80:	89 cf                	mov    %ecx,%edi
+  800b82:	6a 00                	push   $0x0
+  800b84:	55                   	push   %ebp
+  800b85:	56                   	push   %esi
+  800b86:	89 e5                	mov    %esp,%ebp
+  800b88:	8d 35 90 0b 80 00    	lea    0x800b90,%esi
+  800b8e:	0f 34                	sysenter
+
+00800b90 <after_sysenter_label_212>:
+  800b90:	5e                   	pop    %esi
+  800b91:	5d                   	pop    %ebp
+  800b92:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800b95:	85 c0                	test   %eax,%eax
+  800b97:	7f 07                	jg     800ba0 <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800b99:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b9c:	5b                   	pop    %ebx
+  800b9d:	5f                   	pop    %edi
+  800b9e:	5d                   	pop    %ebp
+  800b9f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ba0:	83 ec 0c             	sub    $0xc,%esp
+  800ba3:	50                   	push   %eax
+  800ba4:	6a 03                	push   $0x3
+  800ba6:	68 55 4b 80 00       	push   $0x804b55
+  800bab:	6a 54                	push   $0x54
+  800bad:	68 72 4b 80 00       	push   $0x804b72
+  800bb2:	e8 ae 36 00 00       	call   804265 <_panic>
+
+00800bb7 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800bb7:	55                   	push   %ebp
+  800bb8:	89 e5                	mov    %esp,%ebp
+  800bba:	57                   	push   %edi
+  800bbb:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800bbc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bc1:	b8 02 00 00 00       	mov    $0x2,%eax
+  800bc6:	89 d1                	mov    %edx,%ecx
+  800bc8:	89 d3                	mov    %edx,%ebx
+  800bca:	89 d7                	mov    %edx,%edi
+  800bcc:	6a 00                	push   $0x0
+  800bce:	55                   	push   %ebp
+  800bcf:	56                   	push   %esi
+  800bd0:	89 e5                	mov    %esp,%ebp
+  800bd2:	8d 35 da 0b 80 00    	lea    0x800bda,%esi
+  800bd8:	0f 34                	sysenter
+
+00800bda <after_sysenter_label_309>:
+  800bda:	5e                   	pop    %esi
+  800bdb:	5d                   	pop    %ebp
+  800bdc:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800bdf:	5b                   	pop    %ebx
+  800be0:	5f                   	pop    %edi
+  800be1:	5d                   	pop    %ebp
+  800be2:	c3                   	ret
+
+00800be3 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800be3:	55                   	push   %ebp
+  800be4:	89 e5                	mov    %esp,%ebp
+  800be6:	57                   	push   %edi
+  800be7:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800be8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bed:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800bf2:	89 d1                	mov    %edx,%ecx
+  800bf4:	89 d3                	mov    %edx,%ebx
+  800bf6:	89 d7                	mov    %edx,%edi
+  800bf8:	6a 00                	push   $0x0
+  800bfa:	55                   	push   %ebp
+  800bfb:	56                   	push   %esi
+  800bfc:	89 e5                	mov    %esp,%ebp
+  800bfe:	8d 35 06 0c 80 00    	lea    0x800c06,%esi
+  800c04:	0f 34                	sysenter
+
+00800c06 <after_sysenter_label_391>:
+  800c06:	5e                   	pop    %esi
+  800c07:	5d                   	pop    %ebp
+  800c08:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800c0b:	5b                   	pop    %ebx
+  800c0c:	5f                   	pop    %edi
+  800c0d:	5d                   	pop    %ebp
+  800c0e:	c3                   	ret
+
+00800c0f <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c0f:	55                   	push   %ebp
+  800c10:	89 e5                	mov    %esp,%ebp
+  800c12:	57                   	push   %edi
+  800c13:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c14:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c17:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c1a:	b8 04 00 00 00       	mov    $0x4,%eax
+  800c1f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c24:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c27:	6a 00                	push   $0x0
+  800c29:	55                   	push   %ebp
+  800c2a:	56                   	push   %esi
+  800c2b:	89 e5                	mov    %esp,%ebp
+  800c2d:	8d 35 35 0c 80 00    	lea    0x800c35,%esi
+  800c33:	0f 34                	sysenter
+
+00800c35 <after_sysenter_label_479>:
+  800c35:	5e                   	pop    %esi
+  800c36:	5d                   	pop    %ebp
+  800c37:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800c3a:	85 c0                	test   %eax,%eax
+  800c3c:	7f 07                	jg     800c45 <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800c3e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c41:	5b                   	pop    %ebx
+  800c42:	5f                   	pop    %edi
+  800c43:	5d                   	pop    %ebp
+  800c44:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c45:	83 ec 0c             	sub    $0xc,%esp
+  800c48:	50                   	push   %eax
+  800c49:	6a 04                	push   $0x4
+  800c4b:	68 55 4b 80 00       	push   $0x804b55
+  800c50:	6a 54                	push   $0x54
+  800c52:	68 72 4b 80 00       	push   $0x804b72
+  800c57:	e8 09 36 00 00       	call   804265 <_panic>
+
+00800c5c <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800c5c:	55                   	push   %ebp
+  800c5d:	89 e5                	mov    %esp,%ebp
+  800c5f:	57                   	push   %edi
+  800c60:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c61:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c64:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c67:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c6c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c6f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c72:	ff 75 18             	push   0x18(%ebp)
+  800c75:	55                   	push   %ebp
+  800c76:	56                   	push   %esi
+  800c77:	89 e5                	mov    %esp,%ebp
+  800c79:	8d 35 81 0c 80 00    	lea    0x800c81,%esi
+  800c7f:	0f 34                	sysenter
+
+00800c81 <after_sysenter_label_593>:
+  800c81:	5e                   	pop    %esi
+  800c82:	5d                   	pop    %ebp
+  800c83:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800c86:	85 c0                	test   %eax,%eax
+  800c88:	7f 07                	jg     800c91 <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800c8a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c8d:	5b                   	pop    %ebx
+  800c8e:	5f                   	pop    %edi
+  800c8f:	5d                   	pop    %ebp
+  800c90:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c91:	83 ec 0c             	sub    $0xc,%esp
+  800c94:	50                   	push   %eax
+  800c95:	6a 05                	push   $0x5
+  800c97:	68 55 4b 80 00       	push   $0x804b55
+  800c9c:	6a 54                	push   $0x54
+  800c9e:	68 72 4b 80 00       	push   $0x804b72
+  800ca3:	e8 bd 35 00 00       	call   804265 <_panic>
+
+00800ca8 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800ca8:	55                   	push   %ebp
+  800ca9:	89 e5                	mov    %esp,%ebp
+  800cab:	57                   	push   %edi
+  800cac:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800cad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cb2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cb5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cb8:	b8 06 00 00 00       	mov    $0x6,%eax
+  800cbd:	89 df                	mov    %ebx,%edi
+  800cbf:	6a 00                	push   $0x0
+  800cc1:	55                   	push   %ebp
+  800cc2:	56                   	push   %esi
+  800cc3:	89 e5                	mov    %esp,%ebp
+  800cc5:	8d 35 cd 0c 80 00    	lea    0x800ccd,%esi
+  800ccb:	0f 34                	sysenter
+
+00800ccd <after_sysenter_label_704>:
+  800ccd:	5e                   	pop    %esi
+  800cce:	5d                   	pop    %ebp
+  800ccf:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800cd2:	85 c0                	test   %eax,%eax
+  800cd4:	7f 07                	jg     800cdd <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800cd6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800cd9:	5b                   	pop    %ebx
+  800cda:	5f                   	pop    %edi
+  800cdb:	5d                   	pop    %ebp
+  800cdc:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cdd:	83 ec 0c             	sub    $0xc,%esp
+  800ce0:	50                   	push   %eax
+  800ce1:	6a 06                	push   $0x6
+  800ce3:	68 55 4b 80 00       	push   $0x804b55
+  800ce8:	6a 54                	push   $0x54
+  800cea:	68 72 4b 80 00       	push   $0x804b72
+  800cef:	e8 71 35 00 00       	call   804265 <_panic>
+
+00800cf4 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800cf4:	55                   	push   %ebp
+  800cf5:	89 e5                	mov    %esp,%ebp
+  800cf7:	57                   	push   %edi
+  800cf8:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800cf9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cfe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d01:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d04:	b8 08 00 00 00       	mov    $0x8,%eax
+  800d09:	89 df                	mov    %ebx,%edi
+  800d0b:	6a 00                	push   $0x0
+  800d0d:	55                   	push   %ebp
+  800d0e:	56                   	push   %esi
+  800d0f:	89 e5                	mov    %esp,%ebp
+  800d11:	8d 35 19 0d 80 00    	lea    0x800d19,%esi
+  800d17:	0f 34                	sysenter
+
+00800d19 <after_sysenter_label_808>:
+  800d19:	5e                   	pop    %esi
+  800d1a:	5d                   	pop    %ebp
+  800d1b:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d1e:	85 c0                	test   %eax,%eax
+  800d20:	7f 07                	jg     800d29 <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800d22:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d25:	5b                   	pop    %ebx
+  800d26:	5f                   	pop    %edi
+  800d27:	5d                   	pop    %ebp
+  800d28:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d29:	83 ec 0c             	sub    $0xc,%esp
+  800d2c:	50                   	push   %eax
+  800d2d:	6a 08                	push   $0x8
+  800d2f:	68 55 4b 80 00       	push   $0x804b55
+  800d34:	6a 54                	push   $0x54
+  800d36:	68 72 4b 80 00       	push   $0x804b72
+  800d3b:	e8 25 35 00 00       	call   804265 <_panic>
+
+00800d40 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800d40:	55                   	push   %ebp
+  800d41:	89 e5                	mov    %esp,%ebp
+  800d43:	57                   	push   %edi
+  800d44:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d45:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d4a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d4d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d50:	b8 09 00 00 00       	mov    $0x9,%eax
+  800d55:	89 df                	mov    %ebx,%edi
+  800d57:	6a 00                	push   $0x0
+  800d59:	55                   	push   %ebp
+  800d5a:	56                   	push   %esi
+  800d5b:	89 e5                	mov    %esp,%ebp
+  800d5d:	8d 35 65 0d 80 00    	lea    0x800d65,%esi
+  800d63:	0f 34                	sysenter
+
+00800d65 <after_sysenter_label_912>:
+  800d65:	5e                   	pop    %esi
+  800d66:	5d                   	pop    %ebp
+  800d67:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d6a:	85 c0                	test   %eax,%eax
+  800d6c:	7f 07                	jg     800d75 <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800d6e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d71:	5b                   	pop    %ebx
+  800d72:	5f                   	pop    %edi
+  800d73:	5d                   	pop    %ebp
+  800d74:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d75:	83 ec 0c             	sub    $0xc,%esp
+  800d78:	50                   	push   %eax
+  800d79:	6a 09                	push   $0x9
+  800d7b:	68 55 4b 80 00       	push   $0x804b55
+  800d80:	6a 54                	push   $0x54
+  800d82:	68 72 4b 80 00       	push   $0x804b72
+  800d87:	e8 d9 34 00 00       	call   804265 <_panic>
+
+00800d8c <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800d8c:	55                   	push   %ebp
+  800d8d:	89 e5                	mov    %esp,%ebp
+  800d8f:	57                   	push   %edi
+  800d90:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d91:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d96:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d99:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d9c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800da1:	89 df                	mov    %ebx,%edi
+  800da3:	6a 00                	push   $0x0
+  800da5:	55                   	push   %ebp
+  800da6:	56                   	push   %esi
+  800da7:	89 e5                	mov    %esp,%ebp
+  800da9:	8d 35 b1 0d 80 00    	lea    0x800db1,%esi
+  800daf:	0f 34                	sysenter
+
+00800db1 <after_sysenter_label_1016>:
+  800db1:	5e                   	pop    %esi
+  800db2:	5d                   	pop    %ebp
+  800db3:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800db6:	85 c0                	test   %eax,%eax
+  800db8:	7f 07                	jg     800dc1 <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800dba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800dbd:	5b                   	pop    %ebx
+  800dbe:	5f                   	pop    %edi
+  800dbf:	5d                   	pop    %ebp
+  800dc0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dc1:	83 ec 0c             	sub    $0xc,%esp
+  800dc4:	50                   	push   %eax
+  800dc5:	6a 0a                	push   $0xa
+  800dc7:	68 55 4b 80 00       	push   $0x804b55
+  800dcc:	6a 54                	push   $0x54
+  800dce:	68 72 4b 80 00       	push   $0x804b72
+  800dd3:	e8 8d 34 00 00       	call   804265 <_panic>
+
+00800dd8 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800dd8:	55                   	push   %ebp
+  800dd9:	89 e5                	mov    %esp,%ebp
+  800ddb:	57                   	push   %edi
+  800ddc:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ddd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800de0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800de3:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800de8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800deb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dee:	6a 00                	push   $0x0
+  800df0:	55                   	push   %ebp
+  800df1:	56                   	push   %esi
+  800df2:	89 e5                	mov    %esp,%ebp
+  800df4:	8d 35 fc 0d 80 00    	lea    0x800dfc,%esi
+  800dfa:	0f 34                	sysenter
+
+00800dfc <after_sysenter_label_1126>:
+  800dfc:	5e                   	pop    %esi
+  800dfd:	5d                   	pop    %ebp
+  800dfe:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800e01:	5b                   	pop    %ebx
+  800e02:	5f                   	pop    %edi
+  800e03:	5d                   	pop    %ebp
+  800e04:	c3                   	ret
+
+00800e05 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800e05:	55                   	push   %ebp
+  800e06:	89 e5                	mov    %esp,%ebp
+  800e08:	57                   	push   %edi
+  800e09:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e0a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e0d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e12:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e17:	89 cb                	mov    %ecx,%ebx
+  800e19:	89 cf                	mov    %ecx,%edi
+  800e1b:	6a 00                	push   $0x0
+  800e1d:	55                   	push   %ebp
+  800e1e:	56                   	push   %esi
+  800e1f:	89 e5                	mov    %esp,%ebp
+  800e21:	8d 35 29 0e 80 00    	lea    0x800e29,%esi
+  800e27:	0f 34                	sysenter
+
+00800e29 <after_sysenter_label_1210>:
+  800e29:	5e                   	pop    %esi
+  800e2a:	5d                   	pop    %ebp
+  800e2b:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e2e:	85 c0                	test   %eax,%eax
+  800e30:	7f 07                	jg     800e39 <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800e32:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e35:	5b                   	pop    %ebx
+  800e36:	5f                   	pop    %edi
+  800e37:	5d                   	pop    %ebp
+  800e38:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e39:	83 ec 0c             	sub    $0xc,%esp
+  800e3c:	50                   	push   %eax
+  800e3d:	6a 0d                	push   $0xd
+  800e3f:	68 55 4b 80 00       	push   $0x804b55
+  800e44:	6a 54                	push   $0x54
+  800e46:	68 72 4b 80 00       	push   $0x804b72
+  800e4b:	e8 15 34 00 00       	call   804265 <_panic>
+
+00800e50 <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  800e50:	55                   	push   %ebp
+  800e51:	89 e5                	mov    %esp,%ebp
+  800e53:	57                   	push   %edi
+  800e54:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e55:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e5a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e5d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e60:	b8 42 00 00 00       	mov    $0x42,%eax
+  800e65:	89 df                	mov    %ebx,%edi
+  800e67:	6a 00                	push   $0x0
+  800e69:	55                   	push   %ebp
+  800e6a:	56                   	push   %esi
+  800e6b:	89 e5                	mov    %esp,%ebp
+  800e6d:	8d 35 75 0e 80 00    	lea    0x800e75,%esi
+  800e73:	0f 34                	sysenter
+
+00800e75 <after_sysenter_label_1311>:
+  800e75:	5e                   	pop    %esi
+  800e76:	5d                   	pop    %ebp
+  800e77:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e7a:	85 c0                	test   %eax,%eax
+  800e7c:	7f 07                	jg     800e85 <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  800e7e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e81:	5b                   	pop    %ebx
+  800e82:	5f                   	pop    %edi
+  800e83:	5d                   	pop    %ebp
+  800e84:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e85:	83 ec 0c             	sub    $0xc,%esp
+  800e88:	50                   	push   %eax
+  800e89:	6a 42                	push   $0x42
+  800e8b:	68 55 4b 80 00       	push   $0x804b55
+  800e90:	6a 54                	push   $0x54
+  800e92:	68 72 4b 80 00       	push   $0x804b72
+  800e97:	e8 c9 33 00 00       	call   804265 <_panic>
+
+00800e9c <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800e9c:	55                   	push   %ebp
+  800e9d:	89 e5                	mov    %esp,%ebp
+  800e9f:	57                   	push   %edi
+  800ea0:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ea1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ea6:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800eab:	89 d1                	mov    %edx,%ecx
+  800ead:	89 d3                	mov    %edx,%ebx
+  800eaf:	89 d7                	mov    %edx,%edi
+  800eb1:	6a 00                	push   $0x0
+  800eb3:	55                   	push   %ebp
+  800eb4:	56                   	push   %esi
+  800eb5:	89 e5                	mov    %esp,%ebp
+  800eb7:	8d 35 bf 0e 80 00    	lea    0x800ebf,%esi
+  800ebd:	0f 34                	sysenter
+
+00800ebf <after_sysenter_label_1411>:
+  800ebf:	5e                   	pop    %esi
+  800ec0:	5d                   	pop    %ebp
+  800ec1:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800ec4:	5b                   	pop    %ebx
+  800ec5:	5f                   	pop    %edi
+  800ec6:	5d                   	pop    %ebp
+  800ec7:	c3                   	ret
+
+00800ec8 <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  800ec8:	55                   	push   %ebp
+  800ec9:	89 e5                	mov    %esp,%ebp
+  800ecb:	57                   	push   %edi
+  800ecc:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ecd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ed2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ed8:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800edd:	89 df                	mov    %ebx,%edi
+  800edf:	6a 00                	push   $0x0
+  800ee1:	55                   	push   %ebp
+  800ee2:	56                   	push   %esi
+  800ee3:	89 e5                	mov    %esp,%ebp
+  800ee5:	8d 35 ed 0e 80 00    	lea    0x800eed,%esi
+  800eeb:	0f 34                	sysenter
+
+00800eed <after_sysenter_label_1497>:
+  800eed:	5e                   	pop    %esi
+  800eee:	5d                   	pop    %ebp
+  800eef:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  800ef2:	5b                   	pop    %ebx
+  800ef3:	5f                   	pop    %edi
+  800ef4:	5d                   	pop    %ebp
+  800ef5:	c3                   	ret
+
+00800ef6 <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  800ef6:	55                   	push   %ebp
+  800ef7:	89 e5                	mov    %esp,%ebp
+  800ef9:	57                   	push   %edi
+  800efa:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800efb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f00:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f03:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f06:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f0b:	89 df                	mov    %ebx,%edi
+  800f0d:	6a 00                	push   $0x0
+  800f0f:	55                   	push   %ebp
+  800f10:	56                   	push   %esi
+  800f11:	89 e5                	mov    %esp,%ebp
+  800f13:	8d 35 1b 0f 80 00    	lea    0x800f1b,%esi
+  800f19:	0f 34                	sysenter
+
+00800f1b <after_sysenter_label_1583>:
+  800f1b:	5e                   	pop    %esi
+  800f1c:	5d                   	pop    %ebp
+  800f1d:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  800f20:	5b                   	pop    %ebx
+  800f21:	5f                   	pop    %edi
+  800f22:	5d                   	pop    %ebp
+  800f23:	c3                   	ret
+
+00800f24 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  800f24:	55                   	push   %ebp
+  800f25:	89 e5                	mov    %esp,%ebp
+  800f27:	57                   	push   %edi
+  800f28:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f29:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f2c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f2f:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f34:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f39:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f3c:	6a 00                	push   $0x0
+  800f3e:	55                   	push   %ebp
+  800f3f:	56                   	push   %esi
+  800f40:	89 e5                	mov    %esp,%ebp
+  800f42:	8d 35 4a 0f 80 00    	lea    0x800f4a,%esi
+  800f48:	0f 34                	sysenter
+
+00800f4a <after_sysenter_label_1672>:
+  800f4a:	5e                   	pop    %esi
+  800f4b:	5d                   	pop    %ebp
+  800f4c:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  800f4f:	5b                   	pop    %ebx
+  800f50:	5f                   	pop    %edi
+  800f51:	5d                   	pop    %ebp
+  800f52:	c3                   	ret
+
+00800f53 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  800f53:	55                   	push   %ebp
+  800f54:	89 e5                	mov    %esp,%ebp
+  800f56:	57                   	push   %edi
+  800f57:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f58:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f5d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f60:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f63:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f68:	89 df                	mov    %ebx,%edi
+  800f6a:	6a 00                	push   $0x0
+  800f6c:	55                   	push   %ebp
+  800f6d:	56                   	push   %esi
+  800f6e:	89 e5                	mov    %esp,%ebp
+  800f70:	8d 35 78 0f 80 00    	lea    0x800f78,%esi
+  800f76:	0f 34                	sysenter
+
+00800f78 <after_sysenter_label_1758>:
+  800f78:	5e                   	pop    %esi
+  800f79:	5d                   	pop    %ebp
+  800f7a:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  800f7d:	5b                   	pop    %ebx
+  800f7e:	5f                   	pop    %edi
+  800f7f:	5d                   	pop    %ebp
+  800f80:	c3                   	ret
+
+00800f81 <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  800f81:	55                   	push   %ebp
+  800f82:	89 e5                	mov    %esp,%ebp
+  800f84:	57                   	push   %edi
+  800f85:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f86:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f89:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f8e:	b8 13 00 00 00       	mov    $0x13,%eax
+  800f93:	89 cb                	mov    %ecx,%ebx
+  800f95:	89 cf                	mov    %ecx,%edi
+  800f97:	6a 00                	push   $0x0
+  800f99:	55                   	push   %ebp
+  800f9a:	56                   	push   %esi
+  800f9b:	89 e5                	mov    %esp,%ebp
+  800f9d:	8d 35 a5 0f 80 00    	lea    0x800fa5,%esi
+  800fa3:	0f 34                	sysenter
+
+00800fa5 <after_sysenter_label_1842>:
+  800fa5:	5e                   	pop    %esi
+  800fa6:	5d                   	pop    %ebp
+  800fa7:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800faa:	85 c0                	test   %eax,%eax
+  800fac:	7f 07                	jg     800fb5 <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  800fae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fb1:	5b                   	pop    %ebx
+  800fb2:	5f                   	pop    %edi
+  800fb3:	5d                   	pop    %ebp
+  800fb4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fb5:	83 ec 0c             	sub    $0xc,%esp
+  800fb8:	50                   	push   %eax
+  800fb9:	6a 13                	push   $0x13
+  800fbb:	68 55 4b 80 00       	push   $0x804b55
+  800fc0:	6a 54                	push   $0x54
+  800fc2:	68 72 4b 80 00       	push   $0x804b72
+  800fc7:	e8 99 32 00 00       	call   804265 <_panic>
+
+00800fcc <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  800fcc:	55                   	push   %ebp
+  800fcd:	89 e5                	mov    %esp,%ebp
+  800fcf:	57                   	push   %edi
+  800fd0:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fd1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fd6:	b8 14 00 00 00       	mov    $0x14,%eax
+  800fdb:	89 d1                	mov    %edx,%ecx
+  800fdd:	89 d3                	mov    %edx,%ebx
+  800fdf:	89 d7                	mov    %edx,%edi
+  800fe1:	6a 00                	push   $0x0
+  800fe3:	55                   	push   %ebp
+  800fe4:	56                   	push   %esi
+  800fe5:	89 e5                	mov    %esp,%ebp
+  800fe7:	8d 35 ef 0f 80 00    	lea    0x800fef,%esi
+  800fed:	0f 34                	sysenter
+
+00800fef <after_sysenter_label_1939>:
+  800fef:	5e                   	pop    %esi
+  800ff0:	5d                   	pop    %ebp
+  800ff1:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  800ff4:	5b                   	pop    %ebx
+  800ff5:	5f                   	pop    %edi
+  800ff6:	5d                   	pop    %ebp
+  800ff7:	c3                   	ret
+
+00800ff8 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  800ff8:	55                   	push   %ebp
+  800ff9:	89 e5                	mov    %esp,%ebp
+  800ffb:	57                   	push   %edi
+  800ffc:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ffd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801000:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801003:	b8 15 00 00 00       	mov    $0x15,%eax
+  801008:	bf 00 00 00 00       	mov    $0x0,%edi
+  80100d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801010:	6a 00                	push   $0x0
+  801012:	55                   	push   %ebp
+  801013:	56                   	push   %esi
+  801014:	89 e5                	mov    %esp,%ebp
+  801016:	8d 35 1e 10 80 00    	lea    0x80101e,%esi
+  80101c:	0f 34                	sysenter
+
+0080101e <after_sysenter_label_2028>:
+  80101e:	5e                   	pop    %esi
+  80101f:	5d                   	pop    %ebp
+  801020:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  801023:	5b                   	pop    %ebx
+  801024:	5f                   	pop    %edi
+  801025:	5d                   	pop    %ebp
+  801026:	c3                   	ret
+
+00801027 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  801027:	55                   	push   %ebp
+  801028:	89 e5                	mov    %esp,%ebp
+  80102a:	57                   	push   %edi
+  80102b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80102c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801031:	8b 55 08             	mov    0x8(%ebp),%edx
+  801034:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801037:	b8 16 00 00 00       	mov    $0x16,%eax
+  80103c:	89 df                	mov    %ebx,%edi
+  80103e:	6a 00                	push   $0x0
+  801040:	55                   	push   %ebp
+  801041:	56                   	push   %esi
+  801042:	89 e5                	mov    %esp,%ebp
+  801044:	8d 35 4c 10 80 00    	lea    0x80104c,%esi
+  80104a:	0f 34                	sysenter
+
+0080104c <after_sysenter_label_2114>:
+  80104c:	5e                   	pop    %esi
+  80104d:	5d                   	pop    %ebp
+  80104e:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  801051:	5b                   	pop    %ebx
+  801052:	5f                   	pop    %edi
+  801053:	5d                   	pop    %ebp
+  801054:	c3                   	ret
+
+00801055 <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  801055:	55                   	push   %ebp
+  801056:	89 e5                	mov    %esp,%ebp
+  801058:	57                   	push   %edi
+  801059:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80105a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80105f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801062:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801065:	b8 17 00 00 00       	mov    $0x17,%eax
+  80106a:	89 df                	mov    %ebx,%edi
+  80106c:	6a 00                	push   $0x0
+  80106e:	55                   	push   %ebp
+  80106f:	56                   	push   %esi
+  801070:	89 e5                	mov    %esp,%ebp
+  801072:	8d 35 7a 10 80 00    	lea    0x80107a,%esi
+  801078:	0f 34                	sysenter
+
+0080107a <after_sysenter_label_2200>:
+  80107a:	5e                   	pop    %esi
+  80107b:	5d                   	pop    %ebp
+  80107c:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  80107f:	5b                   	pop    %ebx
+  801080:	5f                   	pop    %edi
+  801081:	5d                   	pop    %ebp
+  801082:	c3                   	ret
+
+00801083 <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  801083:	55                   	push   %ebp
+  801084:	89 e5                	mov    %esp,%ebp
+  801086:	57                   	push   %edi
+  801087:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801088:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80108d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801090:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801093:	b8 18 00 00 00       	mov    $0x18,%eax
+  801098:	89 df                	mov    %ebx,%edi
+  80109a:	6a 00                	push   $0x0
+  80109c:	55                   	push   %ebp
+  80109d:	56                   	push   %esi
+  80109e:	89 e5                	mov    %esp,%ebp
+  8010a0:	8d 35 a8 10 80 00    	lea    0x8010a8,%esi
+  8010a6:	0f 34                	sysenter
+
+008010a8 <after_sysenter_label_2286>:
+  8010a8:	5e                   	pop    %esi
+  8010a9:	5d                   	pop    %ebp
+  8010aa:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  8010ad:	5b                   	pop    %ebx
+  8010ae:	5f                   	pop    %edi
+  8010af:	5d                   	pop    %ebp
+  8010b0:	c3                   	ret
+
+008010b1 <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  8010b1:	55                   	push   %ebp
+  8010b2:	89 e5                	mov    %esp,%ebp
+  8010b4:	57                   	push   %edi
+  8010b5:	56                   	push   %esi
+  8010b6:	53                   	push   %ebx
+  8010b7:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  8010ba:	89 d6                	mov    %edx,%esi
+  8010bc:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  8010bf:	89 cf                	mov    %ecx,%edi
+  8010c1:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  8010c4:	89 fa                	mov    %edi,%edx
+  8010c6:	80 ce 08             	or     $0x8,%dh
+  8010c9:	f6 c5 08             	test   $0x8,%ch
+  8010cc:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  8010cf:	57                   	push   %edi
+  8010d0:	56                   	push   %esi
+  8010d1:	50                   	push   %eax
+  8010d2:	56                   	push   %esi
+  8010d3:	6a 00                	push   $0x0
+  8010d5:	e8 82 fb ff ff       	call   800c5c <sys_page_map>
+	if (r < 0) {
+  8010da:	83 c4 20             	add    $0x20,%esp
+  8010dd:	85 c0                	test   %eax,%eax
+  8010df:	78 27                	js     801108 <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  8010e1:	83 ec 0c             	sub    $0xc,%esp
+  8010e4:	57                   	push   %edi
+  8010e5:	56                   	push   %esi
+  8010e6:	6a 00                	push   $0x0
+  8010e8:	56                   	push   %esi
+  8010e9:	6a 00                	push   $0x0
+  8010eb:	e8 6c fb ff ff       	call   800c5c <sys_page_map>
+  8010f0:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  8010f2:	83 c4 20             	add    $0x20,%esp
+  8010f5:	85 c0                	test   %eax,%eax
+  8010f7:	78 24                	js     80111d <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  8010f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8010fe:	89 d8                	mov    %ebx,%eax
+  801100:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801103:	5b                   	pop    %ebx
+  801104:	5e                   	pop    %esi
+  801105:	5f                   	pop    %edi
+  801106:	5d                   	pop    %ebp
+  801107:	c3                   	ret
+  801108:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  80110a:	83 ec 08             	sub    $0x8,%esp
+  80110d:	50                   	push   %eax
+  80110e:	68 80 4b 80 00       	push   $0x804b80
+  801113:	e8 d5 f0 ff ff       	call   8001ed <cprintf>
+		return r;
+  801118:	83 c4 10             	add    $0x10,%esp
+  80111b:	eb e1                	jmp    8010fe <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  80111d:	83 ec 08             	sub    $0x8,%esp
+  801120:	50                   	push   %eax
+  801121:	68 b0 4b 80 00       	push   $0x804bb0
+  801126:	e8 c2 f0 ff ff       	call   8001ed <cprintf>
+		return r;
+  80112b:	83 c4 10             	add    $0x10,%esp
+  80112e:	eb ce                	jmp    8010fe <duppage_cow+0x4d>
+
+00801130 <duppage>:
+{
+  801130:	55                   	push   %ebp
+  801131:	89 e5                	mov    %esp,%ebp
+  801133:	53                   	push   %ebx
+  801134:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  801137:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  80113a:	51                   	push   %ecx
+  80113b:	52                   	push   %edx
+  80113c:	50                   	push   %eax
+  80113d:	52                   	push   %edx
+  80113e:	6a 00                	push   $0x0
+  801140:	e8 17 fb ff ff       	call   800c5c <sys_page_map>
+	if (r < 0) {
+  801145:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  801148:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  80114d:	85 c0                	test   %eax,%eax
+  80114f:	78 07                	js     801158 <duppage+0x28>
+}
+  801151:	89 d8                	mov    %ebx,%eax
+  801153:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801156:	c9                   	leave
+  801157:	c3                   	ret
+  801158:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  80115a:	83 ec 08             	sub    $0x8,%esp
+  80115d:	50                   	push   %eax
+  80115e:	68 80 4b 80 00       	push   $0x804b80
+  801163:	e8 85 f0 ff ff       	call   8001ed <cprintf>
+		return r;
+  801168:	83 c4 10             	add    $0x10,%esp
+  80116b:	eb e4                	jmp    801151 <duppage+0x21>
+
+0080116d <cow_copy>:
+{
+  80116d:	55                   	push   %ebp
+  80116e:	89 e5                	mov    %esp,%ebp
+  801170:	56                   	push   %esi
+  801171:	53                   	push   %ebx
+  801172:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  801174:	83 ec 04             	sub    $0x4,%esp
+  801177:	6a 07                	push   $0x7
+  801179:	68 00 f0 7f 00       	push   $0x7ff000
+  80117e:	6a 00                	push   $0x0
+  801180:	e8 8a fa ff ff       	call   800c0f <sys_page_alloc>
+	if (r < 0) {
+  801185:	83 c4 10             	add    $0x10,%esp
+  801188:	85 c0                	test   %eax,%eax
+  80118a:	78 58                	js     8011e4 <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  80118c:	83 ec 04             	sub    $0x4,%esp
+  80118f:	68 00 10 00 00       	push   $0x1000
+  801194:	56                   	push   %esi
+  801195:	68 00 f0 7f 00       	push   $0x7ff000
+  80119a:	e8 b8 f7 ff ff       	call   800957 <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  80119f:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8011a6:	56                   	push   %esi
+  8011a7:	6a 00                	push   $0x0
+  8011a9:	68 00 f0 7f 00       	push   $0x7ff000
+  8011ae:	6a 00                	push   $0x0
+  8011b0:	e8 a7 fa ff ff       	call   800c5c <sys_page_map>
+  8011b5:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  8011b7:	83 c4 20             	add    $0x20,%esp
+  8011ba:	85 c0                	test   %eax,%eax
+  8011bc:	78 3b                	js     8011f9 <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  8011be:	83 ec 08             	sub    $0x8,%esp
+  8011c1:	68 00 f0 7f 00       	push   $0x7ff000
+  8011c6:	6a 00                	push   $0x0
+  8011c8:	e8 db fa ff ff       	call   800ca8 <sys_page_unmap>
+  8011cd:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  8011cf:	83 c4 10             	add    $0x10,%esp
+  8011d2:	85 c0                	test   %eax,%eax
+  8011d4:	78 45                	js     80121b <cow_copy+0xae>
+	return 0;
+  8011d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8011db:	89 d8                	mov    %ebx,%eax
+  8011dd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8011e0:	5b                   	pop    %ebx
+  8011e1:	5e                   	pop    %esi
+  8011e2:	5d                   	pop    %ebp
+  8011e3:	c3                   	ret
+  8011e4:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  8011e6:	83 ec 08             	sub    $0x8,%esp
+  8011e9:	50                   	push   %eax
+  8011ea:	68 a0 4c 80 00       	push   $0x804ca0
+  8011ef:	e8 f9 ef ff ff       	call   8001ed <cprintf>
+		return r;
+  8011f4:	83 c4 10             	add    $0x10,%esp
+  8011f7:	eb e2                	jmp    8011db <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  8011f9:	83 ec 08             	sub    $0x8,%esp
+  8011fc:	50                   	push   %eax
+  8011fd:	68 bc 4c 80 00       	push   $0x804cbc
+  801202:	e8 e6 ef ff ff       	call   8001ed <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  801207:	83 c4 08             	add    $0x8,%esp
+  80120a:	68 00 f0 7f 00       	push   $0x7ff000
+  80120f:	6a 00                	push   $0x0
+  801211:	e8 92 fa ff ff       	call   800ca8 <sys_page_unmap>
+		return r;
+  801216:	83 c4 10             	add    $0x10,%esp
+  801219:	eb c0                	jmp    8011db <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  80121b:	83 ec 08             	sub    $0x8,%esp
+  80121e:	50                   	push   %eax
+  80121f:	68 d8 4b 80 00       	push   $0x804bd8
+  801224:	e8 c4 ef ff ff       	call   8001ed <cprintf>
+		return r;
+  801229:	83 c4 10             	add    $0x10,%esp
+  80122c:	eb ad                	jmp    8011db <cow_copy+0x6e>
+
+0080122e <pgfault>:
+{
+  80122e:	55                   	push   %ebp
+  80122f:	89 e5                	mov    %esp,%ebp
+  801231:	56                   	push   %esi
+  801232:	53                   	push   %ebx
+  801233:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  801236:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  801238:	89 d8                	mov    %ebx,%eax
+  80123a:	c1 e8 16             	shr    $0x16,%eax
+  80123d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  801244:	89 de                	mov    %ebx,%esi
+  801246:	c1 ee 0c             	shr    $0xc,%esi
+  801249:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  801250:	a8 07                	test   $0x7,%al
+  801252:	74 3b                	je     80128f <pgfault+0x61>
+  801254:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  80125a:	74 33                	je     80128f <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  80125c:	83 ec 0c             	sub    $0xc,%esp
+  80125f:	68 00 f0 bf ee       	push   $0xeebff000
+  801264:	e8 7c 26 00 00       	call   8038e5 <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  801269:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  801270:	83 c4 10             	add    $0x10,%esp
+  801273:	f6 c4 08             	test   $0x8,%ah
+  801276:	75 30                	jne    8012a8 <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  801278:	83 ec 0c             	sub    $0xc,%esp
+  80127b:	68 00 f0 bf ee       	push   $0xeebff000
+  801280:	e8 cd 26 00 00       	call   803952 <mutex_unlock>
+}
+  801285:	83 c4 10             	add    $0x10,%esp
+  801288:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80128b:	5b                   	pop    %ebx
+  80128c:	5e                   	pop    %esi
+  80128d:	5d                   	pop    %ebp
+  80128e:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  80128f:	83 ec 08             	sub    $0x8,%esp
+  801292:	ff 72 28             	push   0x28(%edx)
+  801295:	51                   	push   %ecx
+  801296:	50                   	push   %eax
+  801297:	68 fc 4b 80 00       	push   $0x804bfc
+  80129c:	6a 3f                	push   $0x3f
+  80129e:	68 d6 4c 80 00       	push   $0x804cd6
+  8012a3:	e8 bd 2f 00 00       	call   804265 <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  8012a8:	89 d8                	mov    %ebx,%eax
+  8012aa:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  8012af:	e8 b9 fe ff ff       	call   80116d <cow_copy>
+  8012b4:	eb c2                	jmp    801278 <pgfault+0x4a>
+
+008012b6 <cow_enable>:
+{
+  8012b6:	55                   	push   %ebp
+  8012b7:	89 e5                	mov    %esp,%ebp
+  8012b9:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  8012bc:	68 2e 12 80 00       	push   $0x80122e
+  8012c1:	e8 e5 2f 00 00       	call   8042ab <set_pgfault_handler>
+}
+  8012c6:	83 c4 10             	add    $0x10,%esp
+  8012c9:	c9                   	leave
+  8012ca:	c3                   	ret
+
+008012cb <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  8012cb:	55                   	push   %ebp
+  8012cc:	89 e5                	mov    %esp,%ebp
+  8012ce:	57                   	push   %edi
+  8012cf:	56                   	push   %esi
+  8012d0:	53                   	push   %ebx
+  8012d1:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  8012d4:	68 2e 12 80 00       	push   $0x80122e
+  8012d9:	e8 cd 2f 00 00       	call   8042ab <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  8012de:	b8 07 00 00 00       	mov    $0x7,%eax
+  8012e3:	cd 30                	int    $0x30
+  8012e5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  8012e8:	83 c4 10             	add    $0x10,%esp
+  8012eb:	85 c0                	test   %eax,%eax
+  8012ed:	78 4b                	js     80133a <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  8012ef:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8012f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012f9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  8012fc:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  801300:	0f 85 16 01 00 00    	jne    80141c <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801306:	e8 ac f8 ff ff       	call   800bb7 <sys_getenvid>
+  80130b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801310:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801312:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  801318:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  80131e:	77 32                	ja     801352 <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801320:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  801325:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  801327:	c1 ea 10             	shr    $0x10,%edx
+  80132a:	74 26                	je     801352 <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80132c:	c1 e2 10             	shl    $0x10,%edx
+  80132f:	89 d1                	mov    %edx,%ecx
+  801331:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801336:	29 ca                	sub    %ecx,%edx
+  801338:	eb 1e                	jmp    801358 <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  80133a:	83 ec 08             	sub    $0x8,%esp
+  80133d:	89 c7                	mov    %eax,%edi
+  80133f:	50                   	push   %eax
+  801340:	68 e1 4c 80 00       	push   $0x804ce1
+  801345:	e8 a3 ee ff ff       	call   8001ed <cprintf>
+		return eid;
+  80134a:	83 c4 10             	add    $0x10,%esp
+  80134d:	e9 6c 01 00 00       	jmp    8014be <fork+0x1f3>
+		return pthread_main_tls;
+  801352:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801358:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80135b:	c1 e0 04             	shl    $0x4,%eax
+  80135e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801363:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  801365:	e8 c4 2c 00 00       	call   80402e <pthread_fork_child>
+		return eid;
+  80136a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80136d:	e9 4c 01 00 00       	jmp    8014be <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  801372:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  801378:	89 da                	mov    %ebx,%edx
+  80137a:	89 f8                	mov    %edi,%eax
+  80137c:	e8 af fd ff ff       	call   801130 <duppage>
+  801381:	85 c0                	test   %eax,%eax
+  801383:	79 28                	jns    8013ad <fork+0xe2>
+  801385:	89 c7                	mov    %eax,%edi
+  801387:	e9 32 01 00 00       	jmp    8014be <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  80138c:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  801392:	83 f9 05             	cmp    $0x5,%ecx
+  801395:	75 58                	jne    8013ef <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  801397:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80139c:	89 da                	mov    %ebx,%edx
+  80139e:	89 f8                	mov    %edi,%eax
+  8013a0:	e8 8b fd ff ff       	call   801130 <duppage>
+  8013a5:	85 c0                	test   %eax,%eax
+  8013a7:	0f 88 0f 01 00 00    	js     8014bc <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  8013ad:	83 c3 01             	add    $0x1,%ebx
+  8013b0:	39 de                	cmp    %ebx,%esi
+  8013b2:	74 54                	je     801408 <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  8013b4:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  8013bb:	f6 c1 05             	test   $0x5,%cl
+  8013be:	74 ed                	je     8013ad <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  8013c0:	f6 c5 04             	test   $0x4,%ch
+  8013c3:	75 ad                	jne    801372 <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  8013c5:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  8013cb:	74 bf                	je     80138c <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  8013cd:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8013d3:	74 d8                	je     8013ad <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  8013d5:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  8013db:	89 da                	mov    %ebx,%edx
+  8013dd:	89 f8                	mov    %edi,%eax
+  8013df:	e8 cd fc ff ff       	call   8010b1 <duppage_cow>
+  8013e4:	85 c0                	test   %eax,%eax
+  8013e6:	79 c5                	jns    8013ad <fork+0xe2>
+  8013e8:	89 c7                	mov    %eax,%edi
+  8013ea:	e9 cf 00 00 00       	jmp    8014be <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  8013ef:	68 2c 4c 80 00       	push   $0x804c2c
+  8013f4:	68 f1 4c 80 00       	push   $0x804cf1
+  8013f9:	68 c6 00 00 00       	push   $0xc6
+  8013fe:	68 d6 4c 80 00       	push   $0x804cd6
+  801403:	e8 5d 2e 00 00       	call   804265 <_panic>
+  801408:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80140b:	83 c1 01             	add    $0x1,%ecx
+  80140e:	81 c6 00 04 00 00    	add    $0x400,%esi
+  801414:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  80141a:	74 18                	je     801434 <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  80141c:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  801423:	a8 07                	test   $0x7,%al
+  801425:	74 e4                	je     80140b <fork+0x140>
+  801427:	89 cb                	mov    %ecx,%ebx
+  801429:	c1 e3 0a             	shl    $0xa,%ebx
+  80142c:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80142f:	e9 7c ff ff ff       	jmp    8013b0 <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  801434:	83 ec 04             	sub    $0x4,%esp
+  801437:	6a 07                	push   $0x7
+  801439:	68 00 f0 bf ee       	push   $0xeebff000
+  80143e:	ff 75 e4             	push   -0x1c(%ebp)
+  801441:	e8 c9 f7 ff ff       	call   800c0f <sys_page_alloc>
+  801446:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801448:	83 c4 10             	add    $0x10,%esp
+  80144b:	85 c0                	test   %eax,%eax
+  80144d:	78 34                	js     801483 <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  80144f:	83 ec 08             	sub    $0x8,%esp
+  801452:	68 e9 42 80 00       	push   $0x8042e9
+  801457:	ff 75 e4             	push   -0x1c(%ebp)
+  80145a:	e8 2d f9 ff ff       	call   800d8c <sys_env_set_pgfault_upcall>
+  80145f:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801461:	83 c4 10             	add    $0x10,%esp
+  801464:	85 c0                	test   %eax,%eax
+  801466:	78 2e                	js     801496 <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  801468:	83 ec 08             	sub    $0x8,%esp
+  80146b:	6a 02                	push   $0x2
+  80146d:	ff 75 e4             	push   -0x1c(%ebp)
+  801470:	e8 7f f8 ff ff       	call   800cf4 <sys_env_set_status>
+  801475:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801477:	83 c4 10             	add    $0x10,%esp
+  80147a:	85 c0                	test   %eax,%eax
+  80147c:	78 2b                	js     8014a9 <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  80147e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801481:	eb 3b                	jmp    8014be <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  801483:	83 ec 08             	sub    $0x8,%esp
+  801486:	50                   	push   %eax
+  801487:	68 54 4c 80 00       	push   $0x804c54
+  80148c:	e8 5c ed ff ff       	call   8001ed <cprintf>
+		return r;
+  801491:	83 c4 10             	add    $0x10,%esp
+  801494:	eb 28                	jmp    8014be <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  801496:	83 ec 08             	sub    $0x8,%esp
+  801499:	50                   	push   %eax
+  80149a:	68 7c 4c 80 00       	push   $0x804c7c
+  80149f:	e8 49 ed ff ff       	call   8001ed <cprintf>
+		return r;
+  8014a4:	83 c4 10             	add    $0x10,%esp
+  8014a7:	eb 15                	jmp    8014be <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  8014a9:	83 ec 08             	sub    $0x8,%esp
+  8014ac:	50                   	push   %eax
+  8014ad:	68 06 4d 80 00       	push   $0x804d06
+  8014b2:	e8 36 ed ff ff       	call   8001ed <cprintf>
+		return r;
+  8014b7:	83 c4 10             	add    $0x10,%esp
+  8014ba:	eb 02                	jmp    8014be <fork+0x1f3>
+  8014bc:	89 c7                	mov    %eax,%edi
+}
+  8014be:	89 f8                	mov    %edi,%eax
+  8014c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014c3:	5b                   	pop    %ebx
+  8014c4:	5e                   	pop    %esi
+  8014c5:	5f                   	pop    %edi
+  8014c6:	5d                   	pop    %ebp
+  8014c7:	c3                   	ret
+
+008014c8 <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  8014c8:	55                   	push   %ebp
+  8014c9:	89 e5                	mov    %esp,%ebp
+  8014cb:	57                   	push   %edi
+  8014cc:	56                   	push   %esi
+  8014cd:	53                   	push   %ebx
+  8014ce:	83 ec 2c             	sub    $0x2c,%esp
+  8014d1:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8014d3:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  8014d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8014de:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8014e4:	77 0a                	ja     8014f0 <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8014e6:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  8014eb:	29 c3                	sub    %eax,%ebx
+  8014ed:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  8014f0:	83 ec 0c             	sub    $0xc,%esp
+  8014f3:	68 2e 12 80 00       	push   $0x80122e
+  8014f8:	e8 ae 2d 00 00       	call   8042ab <set_pgfault_handler>
+  8014fd:	b8 07 00 00 00       	mov    $0x7,%eax
+  801502:	cd 30                	int    $0x30
+  801504:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  801507:	83 c4 10             	add    $0x10,%esp
+  80150a:	85 c0                	test   %eax,%eax
+  80150c:	78 30                	js     80153e <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  80150e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801512:	74 42                	je     801556 <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  801514:	c1 e3 10             	shl    $0x10,%ebx
+  801517:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  80151c:	29 d8                	sub    %ebx,%eax
+  80151e:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801521:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  801526:	29 d8                	sub    %ebx,%eax
+  801528:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80152b:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  801530:	ba 00 00 00 00       	mov    $0x0,%edx
+  801535:	89 f7                	mov    %esi,%edi
+  801537:	89 d6                	mov    %edx,%esi
+  801539:	e9 2c 01 00 00       	jmp    80166a <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  80153e:	83 ec 08             	sub    $0x8,%esp
+  801541:	89 c7                	mov    %eax,%edi
+  801543:	50                   	push   %eax
+  801544:	68 e1 4c 80 00       	push   $0x804ce1
+  801549:	e8 9f ec ff ff       	call   8001ed <cprintf>
+		return eid;
+  80154e:	83 c4 10             	add    $0x10,%esp
+  801551:	e9 d5 00 00 00       	jmp    80162b <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801556:	e8 5c f6 ff ff       	call   800bb7 <sys_getenvid>
+  80155b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801560:	89 c2                	mov    %eax,%edx
+  801562:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801564:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  80156a:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80156f:	77 18                	ja     801589 <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801571:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801576:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  801578:	c1 e8 10             	shr    $0x10,%eax
+  80157b:	74 0c                	je     801589 <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80157d:	c1 e0 10             	shl    $0x10,%eax
+  801580:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  801585:	29 c1                	sub    %eax,%ecx
+  801587:	eb 06                	jmp    80158f <sfork+0xc7>
+		return pthread_main_tls;
+  801589:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+  80158f:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  801592:	c1 e0 04             	shl    $0x4,%eax
+  801595:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80159a:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  80159c:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  80159f:	e9 87 00 00 00       	jmp    80162b <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  8015a4:	f6 c5 04             	test   $0x4,%ch
+  8015a7:	74 6c                	je     801615 <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  8015a9:	89 ca                	mov    %ecx,%edx
+  8015ab:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  8015b1:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  8015b7:	74 7c                	je     801635 <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8015b9:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8015bf:	89 da                	mov    %ebx,%edx
+  8015c1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8015c4:	e8 67 fb ff ff       	call   801130 <duppage>
+  8015c9:	85 c0                	test   %eax,%eax
+  8015cb:	0f 88 4f 01 00 00    	js     801720 <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  8015d1:	83 c3 01             	add    $0x1,%ebx
+  8015d4:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  8015d7:	74 7a                	je     801653 <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  8015d9:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  8015db:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  8015e2:	f6 c1 01             	test   $0x1,%cl
+  8015e5:	74 ea                	je     8015d1 <sfork+0x109>
+  8015e7:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8015ed:	74 e2                	je     8015d1 <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  8015ef:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  8015f5:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  8015f8:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  8015fd:	76 a5                	jbe    8015a4 <sfork+0xdc>
+  8015ff:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  801605:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  801608:	39 fa                	cmp    %edi,%edx
+  80160a:	73 9d                	jae    8015a9 <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  80160c:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  80160f:	39 fa                	cmp    %edi,%edx
+  801611:	72 96                	jb     8015a9 <sfork+0xe1>
+  801613:	eb 8f                	jmp    8015a4 <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  801615:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  80161b:	89 da                	mov    %ebx,%edx
+  80161d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801620:	e8 8c fa ff ff       	call   8010b1 <duppage_cow>
+  801625:	85 c0                	test   %eax,%eax
+  801627:	79 a8                	jns    8015d1 <sfork+0x109>
+  801629:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  80162b:	89 f8                	mov    %edi,%eax
+  80162d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801630:	5b                   	pop    %ebx
+  801631:	5e                   	pop    %esi
+  801632:	5f                   	pop    %edi
+  801633:	5d                   	pop    %ebp
+  801634:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  801635:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  80163a:	e8 2e fb ff ff       	call   80116d <cow_copy>
+  80163f:	85 c0                	test   %eax,%eax
+  801641:	0f 88 d2 00 00 00    	js     801719 <sfork+0x251>
+				pte = uvpt[pn];
+  801647:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  80164e:	e9 66 ff ff ff       	jmp    8015b9 <sfork+0xf1>
+  801653:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801656:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  801659:	83 c6 01             	add    $0x1,%esi
+  80165c:	81 c7 00 04 00 00    	add    $0x400,%edi
+  801662:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  801668:	74 1b                	je     801685 <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  80166a:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  801671:	a8 01                	test   $0x1,%al
+  801673:	74 e4                	je     801659 <sfork+0x191>
+  801675:	89 f3                	mov    %esi,%ebx
+  801677:	c1 e3 0a             	shl    $0xa,%ebx
+  80167a:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  80167d:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  801680:	e9 4f ff ff ff       	jmp    8015d4 <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  801685:	83 ec 04             	sub    $0x4,%esp
+  801688:	6a 07                	push   $0x7
+  80168a:	68 00 f0 bf ee       	push   $0xeebff000
+  80168f:	ff 75 e0             	push   -0x20(%ebp)
+  801692:	e8 78 f5 ff ff       	call   800c0f <sys_page_alloc>
+  801697:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801699:	83 c4 10             	add    $0x10,%esp
+  80169c:	85 c0                	test   %eax,%eax
+  80169e:	78 37                	js     8016d7 <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  8016a0:	83 ec 08             	sub    $0x8,%esp
+  8016a3:	68 e9 42 80 00       	push   $0x8042e9
+  8016a8:	ff 75 e0             	push   -0x20(%ebp)
+  8016ab:	e8 dc f6 ff ff       	call   800d8c <sys_env_set_pgfault_upcall>
+  8016b0:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8016b2:	83 c4 10             	add    $0x10,%esp
+  8016b5:	85 c0                	test   %eax,%eax
+  8016b7:	78 34                	js     8016ed <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  8016b9:	83 ec 08             	sub    $0x8,%esp
+  8016bc:	6a 02                	push   $0x2
+  8016be:	ff 75 e0             	push   -0x20(%ebp)
+  8016c1:	e8 2e f6 ff ff       	call   800cf4 <sys_env_set_status>
+  8016c6:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8016c8:	83 c4 10             	add    $0x10,%esp
+  8016cb:	85 c0                	test   %eax,%eax
+  8016cd:	78 34                	js     801703 <sfork+0x23b>
+	return eid;
+  8016cf:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8016d2:	e9 54 ff ff ff       	jmp    80162b <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  8016d7:	83 ec 08             	sub    $0x8,%esp
+  8016da:	50                   	push   %eax
+  8016db:	68 54 4c 80 00       	push   $0x804c54
+  8016e0:	e8 08 eb ff ff       	call   8001ed <cprintf>
+		return r;
+  8016e5:	83 c4 10             	add    $0x10,%esp
+  8016e8:	e9 3e ff ff ff       	jmp    80162b <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  8016ed:	83 ec 08             	sub    $0x8,%esp
+  8016f0:	50                   	push   %eax
+  8016f1:	68 7c 4c 80 00       	push   $0x804c7c
+  8016f6:	e8 f2 ea ff ff       	call   8001ed <cprintf>
+		return r;
+  8016fb:	83 c4 10             	add    $0x10,%esp
+  8016fe:	e9 28 ff ff ff       	jmp    80162b <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  801703:	83 ec 08             	sub    $0x8,%esp
+  801706:	50                   	push   %eax
+  801707:	68 06 4d 80 00       	push   $0x804d06
+  80170c:	e8 dc ea ff ff       	call   8001ed <cprintf>
+		return r;
+  801711:	83 c4 10             	add    $0x10,%esp
+  801714:	e9 12 ff ff ff       	jmp    80162b <sfork+0x163>
+  801719:	89 c7                	mov    %eax,%edi
+  80171b:	e9 0b ff ff ff       	jmp    80162b <sfork+0x163>
+  801720:	89 c7                	mov    %eax,%edi
+  801722:	e9 04 ff ff ff       	jmp    80162b <sfork+0x163>
+
+00801727 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801727:	55                   	push   %ebp
+  801728:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80172a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80172d:	05 00 00 00 30       	add    $0x30000000,%eax
+  801732:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801735:	5d                   	pop    %ebp
+  801736:	c3                   	ret
+
+00801737 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801737:	55                   	push   %ebp
+  801738:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80173a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80173d:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801742:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801747:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80174c:	5d                   	pop    %ebp
+  80174d:	c3                   	ret
+
+0080174e <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80174e:	55                   	push   %ebp
+  80174f:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801751:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801756:	eb 02                	jmp    80175a <fd_alloc+0xc>
+  801758:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80175a:	89 c2                	mov    %eax,%edx
+  80175c:	c1 ea 16             	shr    $0x16,%edx
+  80175f:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801766:	f6 c2 01             	test   $0x1,%dl
+  801769:	74 2b                	je     801796 <fd_alloc+0x48>
+  80176b:	89 c2                	mov    %eax,%edx
+  80176d:	c1 ea 0c             	shr    $0xc,%edx
+  801770:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801777:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80177d:	f6 c1 01             	test   $0x1,%cl
+  801780:	74 14                	je     801796 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801782:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801788:	75 ce                	jne    801758 <fd_alloc+0xa>
+  80178a:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80178f:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801794:	eb 05                	jmp    80179b <fd_alloc+0x4d>
+			return 0;
+  801796:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80179b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80179e:	89 02                	mov    %eax,(%edx)
+}
+  8017a0:	89 c8                	mov    %ecx,%eax
+  8017a2:	5d                   	pop    %ebp
+  8017a3:	c3                   	ret
+
+008017a4 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8017a4:	55                   	push   %ebp
+  8017a5:	89 e5                	mov    %esp,%ebp
+  8017a7:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8017aa:	83 f8 1f             	cmp    $0x1f,%eax
+  8017ad:	77 30                	ja     8017df <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8017af:	c1 e0 0c             	shl    $0xc,%eax
+  8017b2:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8017b7:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8017bd:	f6 c2 01             	test   $0x1,%dl
+  8017c0:	74 24                	je     8017e6 <fd_lookup+0x42>
+  8017c2:	89 c2                	mov    %eax,%edx
+  8017c4:	c1 ea 0c             	shr    $0xc,%edx
+  8017c7:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8017ce:	f6 c2 01             	test   $0x1,%dl
+  8017d1:	74 1a                	je     8017ed <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8017d3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8017d6:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8017d8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017dd:	5d                   	pop    %ebp
+  8017de:	c3                   	ret
+		return -E_INVAL;
+  8017df:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017e4:	eb f7                	jmp    8017dd <fd_lookup+0x39>
+		return -E_INVAL;
+  8017e6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017eb:	eb f0                	jmp    8017dd <fd_lookup+0x39>
+  8017ed:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017f2:	eb e9                	jmp    8017dd <fd_lookup+0x39>
+
+008017f4 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8017f4:	55                   	push   %ebp
+  8017f5:	89 e5                	mov    %esp,%ebp
+  8017f7:	53                   	push   %ebx
+  8017f8:	83 ec 04             	sub    $0x4,%esp
+  8017fb:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8017fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801803:	eb 03                	jmp    801808 <dev_lookup+0x14>
+  801805:	83 c0 01             	add    $0x1,%eax
+  801808:	8b 1c 85 a0 4d 80 00 	mov    0x804da0(,%eax,4),%ebx
+  80180f:	85 db                	test   %ebx,%ebx
+  801811:	74 0b                	je     80181e <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801813:	39 13                	cmp    %edx,(%ebx)
+  801815:	75 ee                	jne    801805 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801817:	b8 00 00 00 00       	mov    $0x0,%eax
+  80181c:	eb 49                	jmp    801867 <dev_lookup+0x73>
+  80181e:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801820:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  801826:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80182b:	77 18                	ja     801845 <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80182d:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801832:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  801834:	c1 e8 10             	shr    $0x10,%eax
+  801837:	74 0c                	je     801845 <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801839:	c1 e0 10             	shl    $0x10,%eax
+  80183c:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  801841:	29 c1                	sub    %eax,%ecx
+  801843:	eb 06                	jmp    80184b <dev_lookup+0x57>
+		return pthread_main_tls;
+  801845:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80184b:	8b 01                	mov    (%ecx),%eax
+  80184d:	8b 40 48             	mov    0x48(%eax),%eax
+  801850:	83 ec 04             	sub    $0x4,%esp
+  801853:	52                   	push   %edx
+  801854:	50                   	push   %eax
+  801855:	68 24 4d 80 00       	push   $0x804d24
+  80185a:	e8 8e e9 ff ff       	call   8001ed <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80185f:	83 c4 10             	add    $0x10,%esp
+  801862:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801867:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80186a:	89 1a                	mov    %ebx,(%edx)
+}
+  80186c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80186f:	c9                   	leave
+  801870:	c3                   	ret
+
+00801871 <fd_close>:
+{
+  801871:	55                   	push   %ebp
+  801872:	89 e5                	mov    %esp,%ebp
+  801874:	57                   	push   %edi
+  801875:	56                   	push   %esi
+  801876:	53                   	push   %ebx
+  801877:	83 ec 24             	sub    $0x24,%esp
+  80187a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80187d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801880:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801883:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801884:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80188a:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80188d:	50                   	push   %eax
+  80188e:	e8 11 ff ff ff       	call   8017a4 <fd_lookup>
+  801893:	89 c3                	mov    %eax,%ebx
+  801895:	83 c4 10             	add    $0x10,%esp
+  801898:	85 c0                	test   %eax,%eax
+  80189a:	78 05                	js     8018a1 <fd_close+0x30>
+	    || fd != fd2)
+  80189c:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80189f:	74 16                	je     8018b7 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8018a1:	89 f8                	mov    %edi,%eax
+  8018a3:	84 c0                	test   %al,%al
+  8018a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018aa:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8018ad:	89 d8                	mov    %ebx,%eax
+  8018af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018b2:	5b                   	pop    %ebx
+  8018b3:	5e                   	pop    %esi
+  8018b4:	5f                   	pop    %edi
+  8018b5:	5d                   	pop    %ebp
+  8018b6:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8018b7:	83 ec 08             	sub    $0x8,%esp
+  8018ba:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8018bd:	50                   	push   %eax
+  8018be:	ff 36                	push   (%esi)
+  8018c0:	e8 2f ff ff ff       	call   8017f4 <dev_lookup>
+  8018c5:	89 c3                	mov    %eax,%ebx
+  8018c7:	83 c4 10             	add    $0x10,%esp
+  8018ca:	85 c0                	test   %eax,%eax
+  8018cc:	78 1a                	js     8018e8 <fd_close+0x77>
+		if (dev->dev_close)
+  8018ce:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8018d1:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8018d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8018d9:	85 c0                	test   %eax,%eax
+  8018db:	74 0b                	je     8018e8 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8018dd:	83 ec 0c             	sub    $0xc,%esp
+  8018e0:	56                   	push   %esi
+  8018e1:	ff d0                	call   *%eax
+  8018e3:	89 c3                	mov    %eax,%ebx
+  8018e5:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8018e8:	83 ec 08             	sub    $0x8,%esp
+  8018eb:	56                   	push   %esi
+  8018ec:	6a 00                	push   $0x0
+  8018ee:	e8 b5 f3 ff ff       	call   800ca8 <sys_page_unmap>
+	return r;
+  8018f3:	83 c4 10             	add    $0x10,%esp
+  8018f6:	eb b5                	jmp    8018ad <fd_close+0x3c>
+
+008018f8 <close>:
+
+int
+close(int fdnum)
+{
+  8018f8:	55                   	push   %ebp
+  8018f9:	89 e5                	mov    %esp,%ebp
+  8018fb:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8018fe:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801901:	50                   	push   %eax
+  801902:	ff 75 08             	push   0x8(%ebp)
+  801905:	e8 9a fe ff ff       	call   8017a4 <fd_lookup>
+  80190a:	83 c4 10             	add    $0x10,%esp
+  80190d:	85 c0                	test   %eax,%eax
+  80190f:	79 02                	jns    801913 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801911:	c9                   	leave
+  801912:	c3                   	ret
+		return fd_close(fd, 1);
+  801913:	83 ec 08             	sub    $0x8,%esp
+  801916:	6a 01                	push   $0x1
+  801918:	ff 75 f4             	push   -0xc(%ebp)
+  80191b:	e8 51 ff ff ff       	call   801871 <fd_close>
+  801920:	83 c4 10             	add    $0x10,%esp
+  801923:	eb ec                	jmp    801911 <close+0x19>
+
+00801925 <close_all>:
+
+void
+close_all(void)
+{
+  801925:	55                   	push   %ebp
+  801926:	89 e5                	mov    %esp,%ebp
+  801928:	53                   	push   %ebx
+  801929:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80192c:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801931:	83 ec 0c             	sub    $0xc,%esp
+  801934:	53                   	push   %ebx
+  801935:	e8 be ff ff ff       	call   8018f8 <close>
+	for (i = 0; i < MAXFD; i++)
+  80193a:	83 c3 01             	add    $0x1,%ebx
+  80193d:	83 c4 10             	add    $0x10,%esp
+  801940:	83 fb 20             	cmp    $0x20,%ebx
+  801943:	75 ec                	jne    801931 <close_all+0xc>
+}
+  801945:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801948:	c9                   	leave
+  801949:	c3                   	ret
+
+0080194a <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80194a:	55                   	push   %ebp
+  80194b:	89 e5                	mov    %esp,%ebp
+  80194d:	57                   	push   %edi
+  80194e:	56                   	push   %esi
+  80194f:	53                   	push   %ebx
+  801950:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801953:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801956:	50                   	push   %eax
+  801957:	ff 75 08             	push   0x8(%ebp)
+  80195a:	e8 45 fe ff ff       	call   8017a4 <fd_lookup>
+  80195f:	89 c3                	mov    %eax,%ebx
+  801961:	83 c4 10             	add    $0x10,%esp
+  801964:	85 c0                	test   %eax,%eax
+  801966:	78 7f                	js     8019e7 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801968:	83 ec 0c             	sub    $0xc,%esp
+  80196b:	ff 75 0c             	push   0xc(%ebp)
+  80196e:	e8 85 ff ff ff       	call   8018f8 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801973:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801976:	c1 e6 0c             	shl    $0xc,%esi
+  801979:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80197f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801982:	89 3c 24             	mov    %edi,(%esp)
+  801985:	e8 ad fd ff ff       	call   801737 <fd2data>
+  80198a:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80198c:	89 34 24             	mov    %esi,(%esp)
+  80198f:	e8 a3 fd ff ff       	call   801737 <fd2data>
+  801994:	83 c4 10             	add    $0x10,%esp
+  801997:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80199a:	89 d8                	mov    %ebx,%eax
+  80199c:	c1 e8 16             	shr    $0x16,%eax
+  80199f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8019a6:	a8 01                	test   $0x1,%al
+  8019a8:	74 11                	je     8019bb <dup+0x71>
+  8019aa:	89 d8                	mov    %ebx,%eax
+  8019ac:	c1 e8 0c             	shr    $0xc,%eax
+  8019af:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8019b6:	f6 c2 01             	test   $0x1,%dl
+  8019b9:	75 36                	jne    8019f1 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8019bb:	89 f8                	mov    %edi,%eax
+  8019bd:	c1 e8 0c             	shr    $0xc,%eax
+  8019c0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8019c7:	83 ec 0c             	sub    $0xc,%esp
+  8019ca:	25 07 0e 00 00       	and    $0xe07,%eax
+  8019cf:	50                   	push   %eax
+  8019d0:	56                   	push   %esi
+  8019d1:	6a 00                	push   $0x0
+  8019d3:	57                   	push   %edi
+  8019d4:	6a 00                	push   $0x0
+  8019d6:	e8 81 f2 ff ff       	call   800c5c <sys_page_map>
+  8019db:	89 c3                	mov    %eax,%ebx
+  8019dd:	83 c4 20             	add    $0x20,%esp
+  8019e0:	85 c0                	test   %eax,%eax
+  8019e2:	78 33                	js     801a17 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8019e4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8019e7:	89 d8                	mov    %ebx,%eax
+  8019e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019ec:	5b                   	pop    %ebx
+  8019ed:	5e                   	pop    %esi
+  8019ee:	5f                   	pop    %edi
+  8019ef:	5d                   	pop    %ebp
+  8019f0:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8019f1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8019f8:	83 ec 0c             	sub    $0xc,%esp
+  8019fb:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a00:	50                   	push   %eax
+  801a01:	ff 75 d4             	push   -0x2c(%ebp)
+  801a04:	6a 00                	push   $0x0
+  801a06:	53                   	push   %ebx
+  801a07:	6a 00                	push   $0x0
+  801a09:	e8 4e f2 ff ff       	call   800c5c <sys_page_map>
+  801a0e:	89 c3                	mov    %eax,%ebx
+  801a10:	83 c4 20             	add    $0x20,%esp
+  801a13:	85 c0                	test   %eax,%eax
+  801a15:	79 a4                	jns    8019bb <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801a17:	83 ec 08             	sub    $0x8,%esp
+  801a1a:	56                   	push   %esi
+  801a1b:	6a 00                	push   $0x0
+  801a1d:	e8 86 f2 ff ff       	call   800ca8 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801a22:	83 c4 08             	add    $0x8,%esp
+  801a25:	ff 75 d4             	push   -0x2c(%ebp)
+  801a28:	6a 00                	push   $0x0
+  801a2a:	e8 79 f2 ff ff       	call   800ca8 <sys_page_unmap>
+	return r;
+  801a2f:	83 c4 10             	add    $0x10,%esp
+  801a32:	eb b3                	jmp    8019e7 <dup+0x9d>
+
+00801a34 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801a34:	55                   	push   %ebp
+  801a35:	89 e5                	mov    %esp,%ebp
+  801a37:	56                   	push   %esi
+  801a38:	53                   	push   %ebx
+  801a39:	83 ec 18             	sub    $0x18,%esp
+  801a3c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a3f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a42:	50                   	push   %eax
+  801a43:	53                   	push   %ebx
+  801a44:	e8 5b fd ff ff       	call   8017a4 <fd_lookup>
+  801a49:	83 c4 10             	add    $0x10,%esp
+  801a4c:	85 c0                	test   %eax,%eax
+  801a4e:	78 3c                	js     801a8c <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a50:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a53:	83 ec 08             	sub    $0x8,%esp
+  801a56:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a59:	50                   	push   %eax
+  801a5a:	ff 36                	push   (%esi)
+  801a5c:	e8 93 fd ff ff       	call   8017f4 <dev_lookup>
+  801a61:	83 c4 10             	add    $0x10,%esp
+  801a64:	85 c0                	test   %eax,%eax
+  801a66:	78 24                	js     801a8c <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801a68:	8b 46 08             	mov    0x8(%esi),%eax
+  801a6b:	83 e0 03             	and    $0x3,%eax
+  801a6e:	83 f8 01             	cmp    $0x1,%eax
+  801a71:	74 20                	je     801a93 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801a73:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a76:	8b 40 08             	mov    0x8(%eax),%eax
+  801a79:	85 c0                	test   %eax,%eax
+  801a7b:	74 61                	je     801ade <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801a7d:	83 ec 04             	sub    $0x4,%esp
+  801a80:	ff 75 10             	push   0x10(%ebp)
+  801a83:	ff 75 0c             	push   0xc(%ebp)
+  801a86:	56                   	push   %esi
+  801a87:	ff d0                	call   *%eax
+  801a89:	83 c4 10             	add    $0x10,%esp
+}
+  801a8c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a8f:	5b                   	pop    %ebx
+  801a90:	5e                   	pop    %esi
+  801a91:	5d                   	pop    %ebp
+  801a92:	c3                   	ret
+  801a93:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801a95:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801a9b:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801aa0:	77 18                	ja     801aba <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801aa2:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801aa7:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801aa9:	c1 e8 10             	shr    $0x10,%eax
+  801aac:	74 0c                	je     801aba <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801aae:	c1 e0 10             	shl    $0x10,%eax
+  801ab1:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801ab6:	29 c2                	sub    %eax,%edx
+  801ab8:	eb 06                	jmp    801ac0 <read+0x8c>
+		return pthread_main_tls;
+  801aba:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801ac0:	8b 02                	mov    (%edx),%eax
+  801ac2:	8b 40 48             	mov    0x48(%eax),%eax
+  801ac5:	83 ec 04             	sub    $0x4,%esp
+  801ac8:	53                   	push   %ebx
+  801ac9:	50                   	push   %eax
+  801aca:	68 65 4d 80 00       	push   $0x804d65
+  801acf:	e8 19 e7 ff ff       	call   8001ed <cprintf>
+		return -E_INVAL;
+  801ad4:	83 c4 10             	add    $0x10,%esp
+  801ad7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801adc:	eb ae                	jmp    801a8c <read+0x58>
+		return -E_NOT_SUPP;
+  801ade:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ae3:	eb a7                	jmp    801a8c <read+0x58>
+
+00801ae5 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801ae5:	55                   	push   %ebp
+  801ae6:	89 e5                	mov    %esp,%ebp
+  801ae8:	57                   	push   %edi
+  801ae9:	56                   	push   %esi
+  801aea:	53                   	push   %ebx
+  801aeb:	83 ec 0c             	sub    $0xc,%esp
+  801aee:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801af1:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801af4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801af9:	eb 02                	jmp    801afd <readn+0x18>
+  801afb:	01 c3                	add    %eax,%ebx
+  801afd:	39 f3                	cmp    %esi,%ebx
+  801aff:	73 21                	jae    801b22 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801b01:	83 ec 04             	sub    $0x4,%esp
+  801b04:	89 f0                	mov    %esi,%eax
+  801b06:	29 d8                	sub    %ebx,%eax
+  801b08:	50                   	push   %eax
+  801b09:	89 d8                	mov    %ebx,%eax
+  801b0b:	03 45 0c             	add    0xc(%ebp),%eax
+  801b0e:	50                   	push   %eax
+  801b0f:	57                   	push   %edi
+  801b10:	e8 1f ff ff ff       	call   801a34 <read>
+		if (m < 0)
+  801b15:	83 c4 10             	add    $0x10,%esp
+  801b18:	85 c0                	test   %eax,%eax
+  801b1a:	78 04                	js     801b20 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801b1c:	75 dd                	jne    801afb <readn+0x16>
+  801b1e:	eb 02                	jmp    801b22 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801b20:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801b22:	89 d8                	mov    %ebx,%eax
+  801b24:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b27:	5b                   	pop    %ebx
+  801b28:	5e                   	pop    %esi
+  801b29:	5f                   	pop    %edi
+  801b2a:	5d                   	pop    %ebp
+  801b2b:	c3                   	ret
+
+00801b2c <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801b2c:	55                   	push   %ebp
+  801b2d:	89 e5                	mov    %esp,%ebp
+  801b2f:	56                   	push   %esi
+  801b30:	53                   	push   %ebx
+  801b31:	83 ec 18             	sub    $0x18,%esp
+  801b34:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b37:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b3a:	50                   	push   %eax
+  801b3b:	53                   	push   %ebx
+  801b3c:	e8 63 fc ff ff       	call   8017a4 <fd_lookup>
+  801b41:	83 c4 10             	add    $0x10,%esp
+  801b44:	85 c0                	test   %eax,%eax
+  801b46:	78 37                	js     801b7f <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801b48:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b4b:	83 ec 08             	sub    $0x8,%esp
+  801b4e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b51:	50                   	push   %eax
+  801b52:	ff 36                	push   (%esi)
+  801b54:	e8 9b fc ff ff       	call   8017f4 <dev_lookup>
+  801b59:	83 c4 10             	add    $0x10,%esp
+  801b5c:	85 c0                	test   %eax,%eax
+  801b5e:	78 1f                	js     801b7f <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801b60:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801b64:	74 20                	je     801b86 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801b66:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b69:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b6c:	85 c0                	test   %eax,%eax
+  801b6e:	74 61                	je     801bd1 <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801b70:	83 ec 04             	sub    $0x4,%esp
+  801b73:	ff 75 10             	push   0x10(%ebp)
+  801b76:	ff 75 0c             	push   0xc(%ebp)
+  801b79:	56                   	push   %esi
+  801b7a:	ff d0                	call   *%eax
+  801b7c:	83 c4 10             	add    $0x10,%esp
+}
+  801b7f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b82:	5b                   	pop    %ebx
+  801b83:	5e                   	pop    %esi
+  801b84:	5d                   	pop    %ebp
+  801b85:	c3                   	ret
+  801b86:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801b88:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801b8e:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801b93:	77 18                	ja     801bad <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801b95:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801b9a:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801b9c:	c1 e8 10             	shr    $0x10,%eax
+  801b9f:	74 0c                	je     801bad <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801ba1:	c1 e0 10             	shl    $0x10,%eax
+  801ba4:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801ba9:	29 c2                	sub    %eax,%edx
+  801bab:	eb 06                	jmp    801bb3 <write+0x87>
+		return pthread_main_tls;
+  801bad:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801bb3:	8b 02                	mov    (%edx),%eax
+  801bb5:	8b 40 48             	mov    0x48(%eax),%eax
+  801bb8:	83 ec 04             	sub    $0x4,%esp
+  801bbb:	53                   	push   %ebx
+  801bbc:	50                   	push   %eax
+  801bbd:	68 81 4d 80 00       	push   $0x804d81
+  801bc2:	e8 26 e6 ff ff       	call   8001ed <cprintf>
+		return -E_INVAL;
+  801bc7:	83 c4 10             	add    $0x10,%esp
+  801bca:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801bcf:	eb ae                	jmp    801b7f <write+0x53>
+		return -E_NOT_SUPP;
+  801bd1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801bd6:	eb a7                	jmp    801b7f <write+0x53>
+
+00801bd8 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801bd8:	55                   	push   %ebp
+  801bd9:	89 e5                	mov    %esp,%ebp
+  801bdb:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801bde:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801be1:	50                   	push   %eax
+  801be2:	ff 75 08             	push   0x8(%ebp)
+  801be5:	e8 ba fb ff ff       	call   8017a4 <fd_lookup>
+  801bea:	83 c4 10             	add    $0x10,%esp
+  801bed:	85 c0                	test   %eax,%eax
+  801bef:	78 0e                	js     801bff <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801bf1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801bf4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bf7:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801bfa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801bff:	c9                   	leave
+  801c00:	c3                   	ret
+
+00801c01 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801c01:	55                   	push   %ebp
+  801c02:	89 e5                	mov    %esp,%ebp
+  801c04:	56                   	push   %esi
+  801c05:	53                   	push   %ebx
+  801c06:	83 ec 18             	sub    $0x18,%esp
+  801c09:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c0c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c0f:	50                   	push   %eax
+  801c10:	53                   	push   %ebx
+  801c11:	e8 8e fb ff ff       	call   8017a4 <fd_lookup>
+  801c16:	83 c4 10             	add    $0x10,%esp
+  801c19:	85 c0                	test   %eax,%eax
+  801c1b:	78 34                	js     801c51 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c1d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c20:	83 ec 08             	sub    $0x8,%esp
+  801c23:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c26:	50                   	push   %eax
+  801c27:	ff 36                	push   (%esi)
+  801c29:	e8 c6 fb ff ff       	call   8017f4 <dev_lookup>
+  801c2e:	83 c4 10             	add    $0x10,%esp
+  801c31:	85 c0                	test   %eax,%eax
+  801c33:	78 1c                	js     801c51 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c35:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801c39:	74 1d                	je     801c58 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801c3b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c3e:	8b 40 18             	mov    0x18(%eax),%eax
+  801c41:	85 c0                	test   %eax,%eax
+  801c43:	74 5e                	je     801ca3 <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801c45:	83 ec 08             	sub    $0x8,%esp
+  801c48:	ff 75 0c             	push   0xc(%ebp)
+  801c4b:	56                   	push   %esi
+  801c4c:	ff d0                	call   *%eax
+  801c4e:	83 c4 10             	add    $0x10,%esp
+}
+  801c51:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c54:	5b                   	pop    %ebx
+  801c55:	5e                   	pop    %esi
+  801c56:	5d                   	pop    %ebp
+  801c57:	c3                   	ret
+  801c58:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801c5a:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801c60:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801c65:	77 18                	ja     801c7f <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801c67:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801c6c:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801c6e:	c1 e8 10             	shr    $0x10,%eax
+  801c71:	74 0c                	je     801c7f <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801c73:	c1 e0 10             	shl    $0x10,%eax
+  801c76:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801c7b:	29 c2                	sub    %eax,%edx
+  801c7d:	eb 06                	jmp    801c85 <ftruncate+0x84>
+		return pthread_main_tls;
+  801c7f:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+			thisenv->env_id, fdnum);
+  801c85:	8b 02                	mov    (%edx),%eax
+  801c87:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801c8a:	83 ec 04             	sub    $0x4,%esp
+  801c8d:	53                   	push   %ebx
+  801c8e:	50                   	push   %eax
+  801c8f:	68 44 4d 80 00       	push   $0x804d44
+  801c94:	e8 54 e5 ff ff       	call   8001ed <cprintf>
+		return -E_INVAL;
+  801c99:	83 c4 10             	add    $0x10,%esp
+  801c9c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ca1:	eb ae                	jmp    801c51 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801ca3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ca8:	eb a7                	jmp    801c51 <ftruncate+0x50>
+
+00801caa <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801caa:	55                   	push   %ebp
+  801cab:	89 e5                	mov    %esp,%ebp
+  801cad:	56                   	push   %esi
+  801cae:	53                   	push   %ebx
+  801caf:	83 ec 18             	sub    $0x18,%esp
+  801cb2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801cb5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801cb8:	50                   	push   %eax
+  801cb9:	ff 75 08             	push   0x8(%ebp)
+  801cbc:	e8 e3 fa ff ff       	call   8017a4 <fd_lookup>
+  801cc1:	83 c4 10             	add    $0x10,%esp
+  801cc4:	85 c0                	test   %eax,%eax
+  801cc6:	78 49                	js     801d11 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801cc8:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801ccb:	83 ec 08             	sub    $0x8,%esp
+  801cce:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cd1:	50                   	push   %eax
+  801cd2:	ff 36                	push   (%esi)
+  801cd4:	e8 1b fb ff ff       	call   8017f4 <dev_lookup>
+  801cd9:	83 c4 10             	add    $0x10,%esp
+  801cdc:	85 c0                	test   %eax,%eax
+  801cde:	78 31                	js     801d11 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801ce0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ce3:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801ce7:	74 2f                	je     801d18 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801ce9:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801cec:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801cf3:	00 00 00 
+	stat->st_isdir = 0;
+  801cf6:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801cfd:	00 00 00 
+	stat->st_dev = dev;
+  801d00:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801d06:	83 ec 08             	sub    $0x8,%esp
+  801d09:	53                   	push   %ebx
+  801d0a:	56                   	push   %esi
+  801d0b:	ff 50 14             	call   *0x14(%eax)
+  801d0e:	83 c4 10             	add    $0x10,%esp
+}
+  801d11:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d14:	5b                   	pop    %ebx
+  801d15:	5e                   	pop    %esi
+  801d16:	5d                   	pop    %ebp
+  801d17:	c3                   	ret
+		return -E_NOT_SUPP;
+  801d18:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d1d:	eb f2                	jmp    801d11 <fstat+0x67>
+
+00801d1f <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801d1f:	55                   	push   %ebp
+  801d20:	89 e5                	mov    %esp,%ebp
+  801d22:	56                   	push   %esi
+  801d23:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801d24:	83 ec 08             	sub    $0x8,%esp
+  801d27:	6a 00                	push   $0x0
+  801d29:	ff 75 08             	push   0x8(%ebp)
+  801d2c:	e8 4b 03 00 00       	call   80207c <open>
+  801d31:	89 c3                	mov    %eax,%ebx
+  801d33:	83 c4 10             	add    $0x10,%esp
+  801d36:	85 c0                	test   %eax,%eax
+  801d38:	78 1b                	js     801d55 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801d3a:	83 ec 08             	sub    $0x8,%esp
+  801d3d:	ff 75 0c             	push   0xc(%ebp)
+  801d40:	50                   	push   %eax
+  801d41:	e8 64 ff ff ff       	call   801caa <fstat>
+  801d46:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801d48:	89 1c 24             	mov    %ebx,(%esp)
+  801d4b:	e8 a8 fb ff ff       	call   8018f8 <close>
+	return r;
+  801d50:	83 c4 10             	add    $0x10,%esp
+  801d53:	89 f3                	mov    %esi,%ebx
+}
+  801d55:	89 d8                	mov    %ebx,%eax
+  801d57:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d5a:	5b                   	pop    %ebx
+  801d5b:	5e                   	pop    %esi
+  801d5c:	5d                   	pop    %ebp
+  801d5d:	c3                   	ret
+
+00801d5e <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801d5e:	55                   	push   %ebp
+  801d5f:	89 e5                	mov    %esp,%ebp
+  801d61:	56                   	push   %esi
+  801d62:	53                   	push   %ebx
+  801d63:	89 c6                	mov    %eax,%esi
+  801d65:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801d67:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  801d6e:	74 27                	je     801d97 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801d70:	6a 07                	push   $0x7
+  801d72:	68 00 70 80 00       	push   $0x807000
+  801d77:	56                   	push   %esi
+  801d78:	ff 35 00 60 80 00    	push   0x806000
+  801d7e:	e8 82 26 00 00       	call   804405 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801d83:	83 c4 0c             	add    $0xc,%esp
+  801d86:	6a 00                	push   $0x0
+  801d88:	53                   	push   %ebx
+  801d89:	6a 00                	push   $0x0
+  801d8b:	e8 7f 25 00 00       	call   80430f <ipc_recv>
+}
+  801d90:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d93:	5b                   	pop    %ebx
+  801d94:	5e                   	pop    %esi
+  801d95:	5d                   	pop    %ebp
+  801d96:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801d97:	83 ec 0c             	sub    $0xc,%esp
+  801d9a:	6a 01                	push   $0x1
+  801d9c:	e8 ba 26 00 00       	call   80445b <ipc_find_env>
+  801da1:	a3 00 60 80 00       	mov    %eax,0x806000
+  801da6:	83 c4 10             	add    $0x10,%esp
+  801da9:	eb c5                	jmp    801d70 <fsipc+0x12>
+
+00801dab <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801dab:	55                   	push   %ebp
+  801dac:	89 e5                	mov    %esp,%ebp
+  801dae:	53                   	push   %ebx
+  801daf:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801db2:	68 04 60 80 00       	push   $0x806004
+  801db7:	e8 29 1b 00 00       	call   8038e5 <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801dbc:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dbf:	8b 40 0c             	mov    0xc(%eax),%eax
+  801dc2:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  801dc7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801dca:	a3 04 70 80 00       	mov    %eax,0x807004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  801dcf:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dd4:	b8 02 00 00 00       	mov    $0x2,%eax
+  801dd9:	e8 80 ff ff ff       	call   801d5e <fsipc>
+  801dde:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801de0:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801de7:	e8 66 1b 00 00       	call   803952 <mutex_unlock>
+	return r;
+}
+  801dec:	89 d8                	mov    %ebx,%eax
+  801dee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801df1:	c9                   	leave
+  801df2:	c3                   	ret
+
+00801df3 <devfile_flush>:
+{
+  801df3:	55                   	push   %ebp
+  801df4:	89 e5                	mov    %esp,%ebp
+  801df6:	53                   	push   %ebx
+  801df7:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  801dfa:	68 04 60 80 00       	push   $0x806004
+  801dff:	e8 e1 1a 00 00       	call   8038e5 <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801e04:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e07:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e0a:	a3 00 70 80 00       	mov    %eax,0x807000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  801e0f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e14:	b8 06 00 00 00       	mov    $0x6,%eax
+  801e19:	e8 40 ff ff ff       	call   801d5e <fsipc>
+  801e1e:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801e20:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801e27:	e8 26 1b 00 00       	call   803952 <mutex_unlock>
+}
+  801e2c:	89 d8                	mov    %ebx,%eax
+  801e2e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e31:	c9                   	leave
+  801e32:	c3                   	ret
+
+00801e33 <devfile_stat>:
+{
+  801e33:	55                   	push   %ebp
+  801e34:	89 e5                	mov    %esp,%ebp
+  801e36:	56                   	push   %esi
+  801e37:	53                   	push   %ebx
+  801e38:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  801e3b:	83 ec 0c             	sub    $0xc,%esp
+  801e3e:	68 04 60 80 00       	push   $0x806004
+  801e43:	e8 9d 1a 00 00       	call   8038e5 <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801e48:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e4b:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e4e:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  801e53:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e58:	b8 05 00 00 00       	mov    $0x5,%eax
+  801e5d:	e8 fc fe ff ff       	call   801d5e <fsipc>
+  801e62:	89 c3                	mov    %eax,%ebx
+  801e64:	83 c4 10             	add    $0x10,%esp
+  801e67:	85 c0                	test   %eax,%eax
+  801e69:	79 16                	jns    801e81 <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  801e6b:	83 ec 0c             	sub    $0xc,%esp
+  801e6e:	68 04 60 80 00       	push   $0x806004
+  801e73:	e8 da 1a 00 00       	call   803952 <mutex_unlock>
+}
+  801e78:	89 d8                	mov    %ebx,%eax
+  801e7a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e7d:	5b                   	pop    %ebx
+  801e7e:	5e                   	pop    %esi
+  801e7f:	5d                   	pop    %ebp
+  801e80:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801e81:	83 ec 08             	sub    $0x8,%esp
+  801e84:	68 00 70 80 00       	push   $0x807000
+  801e89:	56                   	push   %esi
+  801e8a:	e8 42 e9 ff ff       	call   8007d1 <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  801e8f:	a1 80 70 80 00       	mov    0x807080,%eax
+  801e94:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801e9a:	a1 84 70 80 00       	mov    0x807084,%eax
+  801e9f:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  801ea5:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  801ea8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ead:	eb bc                	jmp    801e6b <devfile_stat+0x38>
+
+00801eaf <devfile_write>:
+{
+  801eaf:	55                   	push   %ebp
+  801eb0:	89 e5                	mov    %esp,%ebp
+  801eb2:	53                   	push   %ebx
+  801eb3:	83 ec 10             	sub    $0x10,%esp
+  801eb6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  801eb9:	68 04 60 80 00       	push   $0x806004
+  801ebe:	e8 22 1a 00 00       	call   8038e5 <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801ec3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ec6:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ec9:	a3 00 70 80 00       	mov    %eax,0x807000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801ece:	83 c4 10             	add    $0x10,%esp
+  801ed1:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  801ed7:	76 3d                	jbe    801f16 <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  801ed9:	b8 00 00 10 00       	mov    $0x100000,%eax
+  801ede:	39 c3                	cmp    %eax,%ebx
+  801ee0:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  801ee3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ee6:	a3 08 70 80 00       	mov    %eax,0x807008
+	fsipcbuf.write.req_n = n;
+  801eeb:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	r = fsipc(FSREQ_WRITE, NULL);
+  801ef1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ef6:	b8 04 00 00 00       	mov    $0x4,%eax
+  801efb:	e8 5e fe ff ff       	call   801d5e <fsipc>
+  801f00:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801f02:	83 ec 0c             	sub    $0xc,%esp
+  801f05:	68 04 60 80 00       	push   $0x806004
+  801f0a:	e8 43 1a 00 00       	call   803952 <mutex_unlock>
+}
+  801f0f:	89 d8                	mov    %ebx,%eax
+  801f11:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f14:	c9                   	leave
+  801f15:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  801f16:	83 ec 04             	sub    $0x4,%esp
+  801f19:	53                   	push   %ebx
+  801f1a:	ff 75 0c             	push   0xc(%ebp)
+  801f1d:	68 0c 70 80 00       	push   $0x80700c
+  801f22:	e8 30 ea ff ff       	call   800957 <memmove>
+  801f27:	83 c4 10             	add    $0x10,%esp
+  801f2a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f2f:	eb b5                	jmp    801ee6 <devfile_write+0x37>
+
+00801f31 <devfile_read>:
+{
+  801f31:	55                   	push   %ebp
+  801f32:	89 e5                	mov    %esp,%ebp
+  801f34:	57                   	push   %edi
+  801f35:	56                   	push   %esi
+  801f36:	53                   	push   %ebx
+  801f37:	83 ec 0c             	sub    $0xc,%esp
+  801f3a:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f3d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801f40:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  801f43:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801f49:	0f 86 8c 00 00 00    	jbe    801fdb <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  801f4f:	b8 00 00 10 00       	mov    $0x100000,%eax
+  801f54:	39 c3                	cmp    %eax,%ebx
+  801f56:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  801f59:	89 f8                	mov    %edi,%eax
+  801f5b:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801f5e:	eb 0f                	jmp    801f6f <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  801f60:	0f b6 08             	movzbl (%eax),%ecx
+  801f63:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  801f65:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801f6a:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  801f6f:	39 d0                	cmp    %edx,%eax
+  801f71:	72 ed                	jb     801f60 <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  801f73:	83 ec 0c             	sub    $0xc,%esp
+  801f76:	68 04 60 80 00       	push   $0x806004
+  801f7b:	e8 65 19 00 00       	call   8038e5 <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801f80:	8b 46 0c             	mov    0xc(%esi),%eax
+  801f83:	a3 00 70 80 00       	mov    %eax,0x807000
+		fsipcbuf.read.req_n = n;
+  801f88:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  801f8e:	89 3d 08 70 80 00    	mov    %edi,0x807008
+		r = fsipc(FSREQ_READ, NULL);
+  801f94:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f99:	b8 03 00 00 00       	mov    $0x3,%eax
+  801f9e:	e8 bb fd ff ff       	call   801d5e <fsipc>
+  801fa3:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  801fa5:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801fac:	e8 a1 19 00 00       	call   803952 <mutex_unlock>
+		assert(r <= (int) n);
+  801fb1:	83 c4 10             	add    $0x10,%esp
+  801fb4:	39 f3                	cmp    %esi,%ebx
+  801fb6:	7c 0a                	jl     801fc2 <devfile_read+0x91>
+}
+  801fb8:	89 f0                	mov    %esi,%eax
+  801fba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fbd:	5b                   	pop    %ebx
+  801fbe:	5e                   	pop    %esi
+  801fbf:	5f                   	pop    %edi
+  801fc0:	5d                   	pop    %ebp
+  801fc1:	c3                   	ret
+		assert(r <= (int) n);
+  801fc2:	68 b4 4d 80 00       	push   $0x804db4
+  801fc7:	68 f1 4c 80 00       	push   $0x804cf1
+  801fcc:	68 90 00 00 00       	push   $0x90
+  801fd1:	68 c1 4d 80 00       	push   $0x804dc1
+  801fd6:	e8 8a 22 00 00       	call   804265 <_panic>
+	mutex_lock(&fsipc_mu);
+  801fdb:	83 ec 0c             	sub    $0xc,%esp
+  801fde:	68 04 60 80 00       	push   $0x806004
+  801fe3:	e8 fd 18 00 00       	call   8038e5 <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801fe8:	8b 46 0c             	mov    0xc(%esi),%eax
+  801feb:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  801ff0:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	fsipcbuf.read.req_va = 0;
+  801ff6:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  801ffd:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  802000:	ba 00 00 00 00       	mov    $0x0,%edx
+  802005:	b8 03 00 00 00       	mov    $0x3,%eax
+  80200a:	e8 4f fd ff ff       	call   801d5e <fsipc>
+  80200f:	89 c6                	mov    %eax,%esi
+  802011:	83 c4 10             	add    $0x10,%esp
+  802014:	85 c0                	test   %eax,%eax
+  802016:	78 1d                	js     802035 <devfile_read+0x104>
+		assert(r <= n);
+  802018:	39 c3                	cmp    %eax,%ebx
+  80201a:	72 2e                	jb     80204a <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  80201c:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802021:	7f 40                	jg     802063 <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  802023:	83 ec 04             	sub    $0x4,%esp
+  802026:	50                   	push   %eax
+  802027:	68 00 70 80 00       	push   $0x807000
+  80202c:	57                   	push   %edi
+  80202d:	e8 25 e9 ff ff       	call   800957 <memmove>
+  802032:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  802035:	83 ec 0c             	sub    $0xc,%esp
+  802038:	68 04 60 80 00       	push   $0x806004
+  80203d:	e8 10 19 00 00       	call   803952 <mutex_unlock>
+	return r;
+  802042:	83 c4 10             	add    $0x10,%esp
+  802045:	e9 6e ff ff ff       	jmp    801fb8 <devfile_read+0x87>
+		assert(r <= n);
+  80204a:	68 cc 4d 80 00       	push   $0x804dcc
+  80204f:	68 f1 4c 80 00       	push   $0x804cf1
+  802054:	68 99 00 00 00       	push   $0x99
+  802059:	68 c1 4d 80 00       	push   $0x804dc1
+  80205e:	e8 02 22 00 00       	call   804265 <_panic>
+		assert(r <= PGSIZE);
+  802063:	68 d3 4d 80 00       	push   $0x804dd3
+  802068:	68 f1 4c 80 00       	push   $0x804cf1
+  80206d:	68 9a 00 00 00       	push   $0x9a
+  802072:	68 c1 4d 80 00       	push   $0x804dc1
+  802077:	e8 e9 21 00 00       	call   804265 <_panic>
+
+0080207c <open>:
+{
+  80207c:	55                   	push   %ebp
+  80207d:	89 e5                	mov    %esp,%ebp
+  80207f:	56                   	push   %esi
+  802080:	53                   	push   %ebx
+  802081:	83 ec 1c             	sub    $0x1c,%esp
+  802084:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802087:	56                   	push   %esi
+  802088:	e8 09 e7 ff ff       	call   800796 <strlen>
+  80208d:	83 c4 10             	add    $0x10,%esp
+  802090:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802095:	0f 8f 85 00 00 00    	jg     802120 <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  80209b:	83 ec 0c             	sub    $0xc,%esp
+  80209e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020a1:	50                   	push   %eax
+  8020a2:	e8 a7 f6 ff ff       	call   80174e <fd_alloc>
+  8020a7:	89 c3                	mov    %eax,%ebx
+  8020a9:	83 c4 10             	add    $0x10,%esp
+  8020ac:	85 c0                	test   %eax,%eax
+  8020ae:	78 55                	js     802105 <open+0x89>
+	mutex_lock(&fsipc_mu);
+  8020b0:	83 ec 0c             	sub    $0xc,%esp
+  8020b3:	68 04 60 80 00       	push   $0x806004
+  8020b8:	e8 28 18 00 00       	call   8038e5 <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  8020bd:	83 c4 08             	add    $0x8,%esp
+  8020c0:	56                   	push   %esi
+  8020c1:	68 00 70 80 00       	push   $0x807000
+  8020c6:	e8 06 e7 ff ff       	call   8007d1 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8020cb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020ce:	a3 00 74 80 00       	mov    %eax,0x807400
+	r = fsipc(FSREQ_OPEN, fd);
+  8020d3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8020d6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8020db:	e8 7e fc ff ff       	call   801d5e <fsipc>
+  8020e0:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8020e2:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  8020e9:	e8 64 18 00 00       	call   803952 <mutex_unlock>
+	if (r < 0) {
+  8020ee:	83 c4 10             	add    $0x10,%esp
+  8020f1:	85 db                	test   %ebx,%ebx
+  8020f3:	78 19                	js     80210e <open+0x92>
+	return fd2num(fd);
+  8020f5:	83 ec 0c             	sub    $0xc,%esp
+  8020f8:	ff 75 f4             	push   -0xc(%ebp)
+  8020fb:	e8 27 f6 ff ff       	call   801727 <fd2num>
+  802100:	89 c3                	mov    %eax,%ebx
+  802102:	83 c4 10             	add    $0x10,%esp
+}
+  802105:	89 d8                	mov    %ebx,%eax
+  802107:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80210a:	5b                   	pop    %ebx
+  80210b:	5e                   	pop    %esi
+  80210c:	5d                   	pop    %ebp
+  80210d:	c3                   	ret
+		fd_close(fd, 0);
+  80210e:	83 ec 08             	sub    $0x8,%esp
+  802111:	6a 00                	push   $0x0
+  802113:	ff 75 f4             	push   -0xc(%ebp)
+  802116:	e8 56 f7 ff ff       	call   801871 <fd_close>
+		return r;
+  80211b:	83 c4 10             	add    $0x10,%esp
+  80211e:	eb e5                	jmp    802105 <open+0x89>
+		return -E_BAD_PATH;
+  802120:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802125:	eb de                	jmp    802105 <open+0x89>
+
+00802127 <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  802127:	55                   	push   %ebp
+  802128:	89 e5                	mov    %esp,%ebp
+  80212a:	53                   	push   %ebx
+  80212b:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80212e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802131:	50                   	push   %eax
+  802132:	ff 75 08             	push   0x8(%ebp)
+  802135:	e8 6a f6 ff ff       	call   8017a4 <fd_lookup>
+  80213a:	89 c3                	mov    %eax,%ebx
+  80213c:	83 c4 10             	add    $0x10,%esp
+  80213f:	85 c0                	test   %eax,%eax
+  802141:	78 5b                	js     80219e <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  802143:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802146:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  80214c:	39 08                	cmp    %ecx,(%eax)
+  80214e:	75 55                	jne    8021a5 <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  802150:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802154:	74 56                	je     8021ac <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  802156:	83 ec 0c             	sub    $0xc,%esp
+  802159:	68 04 60 80 00       	push   $0x806004
+  80215e:	e8 82 17 00 00       	call   8038e5 <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  802163:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802166:	8b 40 0c             	mov    0xc(%eax),%eax
+  802169:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.allocate.req_offset = offset;
+  80216e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802171:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.allocate.req_len = len;
+  802176:	8b 45 10             	mov    0x10(%ebp),%eax
+  802179:	a3 08 70 80 00       	mov    %eax,0x807008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  80217e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802183:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802188:	e8 d1 fb ff ff       	call   801d5e <fsipc>
+  80218d:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80218f:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  802196:	e8 b7 17 00 00       	call   803952 <mutex_unlock>
+	return r;
+  80219b:	83 c4 10             	add    $0x10,%esp
+}
+  80219e:	89 d8                	mov    %ebx,%eax
+  8021a0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021a3:	c9                   	leave
+  8021a4:	c3                   	ret
+		return -E_NOT_SUPP;
+  8021a5:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8021aa:	eb f2                	jmp    80219e <fallocate+0x77>
+		return -E_INVAL;
+  8021ac:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8021b1:	eb eb                	jmp    80219e <fallocate+0x77>
+
+008021b3 <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  8021b3:	55                   	push   %ebp
+  8021b4:	89 e5                	mov    %esp,%ebp
+  8021b6:	56                   	push   %esi
+  8021b7:	53                   	push   %ebx
+  8021b8:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  8021bb:	89 f3                	mov    %esi,%ebx
+  8021bd:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  8021c3:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  8021c6:	eb 06                	jmp    8021ce <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  8021c8:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8021ce:	39 f3                	cmp    %esi,%ebx
+  8021d0:	73 14                	jae    8021e6 <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  8021d2:	83 ec 08             	sub    $0x8,%esp
+  8021d5:	53                   	push   %ebx
+  8021d6:	6a 00                	push   $0x0
+  8021d8:	e8 cb ea ff ff       	call   800ca8 <sys_page_unmap>
+  8021dd:	83 c4 10             	add    $0x10,%esp
+  8021e0:	85 c0                	test   %eax,%eax
+  8021e2:	79 e4                	jns    8021c8 <munmap+0x15>
+  8021e4:	eb 05                	jmp    8021eb <munmap+0x38>
+			return r;
+	return 0;
+  8021e6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021eb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021ee:	5b                   	pop    %ebx
+  8021ef:	5e                   	pop    %esi
+  8021f0:	5d                   	pop    %ebp
+  8021f1:	c3                   	ret
+
+008021f2 <mmap>:
+{
+  8021f2:	55                   	push   %ebp
+  8021f3:	89 e5                	mov    %esp,%ebp
+  8021f5:	57                   	push   %edi
+  8021f6:	56                   	push   %esi
+  8021f7:	53                   	push   %ebx
+  8021f8:	83 ec 24             	sub    $0x24,%esp
+  8021fb:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  8021fe:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802201:	50                   	push   %eax
+  802202:	ff 75 08             	push   0x8(%ebp)
+  802205:	e8 9a f5 ff ff       	call   8017a4 <fd_lookup>
+  80220a:	83 c4 10             	add    $0x10,%esp
+  80220d:	85 c0                	test   %eax,%eax
+  80220f:	0f 88 37 01 00 00    	js     80234c <mmap+0x15a>
+		return NULL;
+  802215:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  80221a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80221d:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  802223:	39 0a                	cmp    %ecx,(%edx)
+  802225:	0f 85 05 01 00 00    	jne    802330 <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  80222b:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  802232:	0f 85 1b 01 00 00    	jne    802353 <mmap+0x161>
+  802238:	89 f0                	mov    %esi,%eax
+  80223a:	83 e8 01             	sub    $0x1,%eax
+  80223d:	0f 88 17 01 00 00    	js     80235a <mmap+0x168>
+	if (prot & PROT_WRITE)
+  802243:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  802247:	75 28                	jne    802271 <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  802249:	83 ec 0c             	sub    $0xc,%esp
+  80224c:	68 04 60 80 00       	push   $0x806004
+  802251:	e8 8f 16 00 00       	call   8038e5 <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  802256:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  80225c:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  802262:	83 c4 10             	add    $0x10,%esp
+  802265:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  80226a:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  80226f:	eb 2b                	jmp    80229c <mmap+0xaa>
+		cow_enable();
+  802271:	e8 40 f0 ff ff       	call   8012b6 <cow_enable>
+  802276:	eb d1                	jmp    802249 <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  802278:	89 c2                	mov    %eax,%edx
+  80227a:	c1 ea 0c             	shr    $0xc,%edx
+  80227d:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  802284:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80228a:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  802290:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  802293:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  802295:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  80229a:	77 25                	ja     8022c1 <mmap+0xcf>
+  80229c:	89 c2                	mov    %eax,%edx
+  80229e:	29 da                	sub    %ebx,%edx
+  8022a0:	39 ca                	cmp    %ecx,%edx
+  8022a2:	73 3a                	jae    8022de <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  8022a4:	89 c2                	mov    %eax,%edx
+  8022a6:	c1 ea 16             	shr    $0x16,%edx
+  8022a9:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8022b0:	f6 c2 01             	test   $0x1,%dl
+  8022b3:	75 c3                	jne    802278 <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  8022b5:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  8022ba:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  8022bf:	eb d4                	jmp    802295 <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  8022c1:	29 d8                	sub    %ebx,%eax
+  8022c3:	39 c8                	cmp    %ecx,%eax
+  8022c5:	73 17                	jae    8022de <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  8022c7:	83 ec 0c             	sub    $0xc,%esp
+  8022ca:	68 04 60 80 00       	push   $0x806004
+  8022cf:	e8 7e 16 00 00       	call   803952 <mutex_unlock>
+		return NULL;
+  8022d4:	83 c4 10             	add    $0x10,%esp
+  8022d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022dc:	eb 52                	jmp    802330 <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  8022de:	85 db                	test   %ebx,%ebx
+  8022e0:	74 e5                	je     8022c7 <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8022e2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8022e5:	8b 40 0c             	mov    0xc(%eax),%eax
+  8022e8:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  8022ed:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022f0:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_len = len;
+  8022f5:	89 35 08 70 80 00    	mov    %esi,0x807008
+	fsipcbuf.map.req_va = va;
+  8022fb:	89 1d 0c 70 80 00    	mov    %ebx,0x80700c
+	fsipcbuf.map.req_prot = prot;
+  802301:	8b 45 14             	mov    0x14(%ebp),%eax
+  802304:	a3 10 70 80 00       	mov    %eax,0x807010
+	r = fsipc(FSREQ_MAP, NULL);
+  802309:	ba 00 00 00 00       	mov    $0x0,%edx
+  80230e:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802313:	e8 46 fa ff ff       	call   801d5e <fsipc>
+  802318:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  80231a:	83 ec 0c             	sub    $0xc,%esp
+  80231d:	68 04 60 80 00       	push   $0x806004
+  802322:	e8 2b 16 00 00       	call   803952 <mutex_unlock>
+	if (r < 0) {
+  802327:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  80232a:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  80232c:	85 ff                	test   %edi,%edi
+  80232e:	78 08                	js     802338 <mmap+0x146>
+}
+  802330:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802333:	5b                   	pop    %ebx
+  802334:	5e                   	pop    %esi
+  802335:	5f                   	pop    %edi
+  802336:	5d                   	pop    %ebp
+  802337:	c3                   	ret
+		munmap((void*) va, len);
+  802338:	83 ec 08             	sub    $0x8,%esp
+  80233b:	56                   	push   %esi
+  80233c:	53                   	push   %ebx
+  80233d:	e8 71 fe ff ff       	call   8021b3 <munmap>
+		return NULL;
+  802342:	83 c4 10             	add    $0x10,%esp
+  802345:	b8 00 00 00 00       	mov    $0x0,%eax
+  80234a:	eb e4                	jmp    802330 <mmap+0x13e>
+		return NULL;
+  80234c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802351:	eb dd                	jmp    802330 <mmap+0x13e>
+		return NULL;
+  802353:	b8 00 00 00 00       	mov    $0x0,%eax
+  802358:	eb d6                	jmp    802330 <mmap+0x13e>
+  80235a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80235f:	eb cf                	jmp    802330 <mmap+0x13e>
+
+00802361 <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  802361:	55                   	push   %ebp
+  802362:	89 e5                	mov    %esp,%ebp
+  802364:	53                   	push   %ebx
+  802365:	83 ec 10             	sub    $0x10,%esp
+  802368:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  80236b:	53                   	push   %ebx
+  80236c:	e8 25 e4 ff ff       	call   800796 <strlen>
+  802371:	83 c4 10             	add    $0x10,%esp
+  802374:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802379:	7f 42                	jg     8023bd <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  80237b:	83 ec 0c             	sub    $0xc,%esp
+  80237e:	68 04 60 80 00       	push   $0x806004
+  802383:	e8 5d 15 00 00       	call   8038e5 <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  802388:	83 c4 08             	add    $0x8,%esp
+  80238b:	53                   	push   %ebx
+  80238c:	68 00 70 80 00       	push   $0x807000
+  802391:	e8 3b e4 ff ff       	call   8007d1 <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  802396:	ba 00 00 00 00       	mov    $0x0,%edx
+  80239b:	b8 07 00 00 00       	mov    $0x7,%eax
+  8023a0:	e8 b9 f9 ff ff       	call   801d5e <fsipc>
+  8023a5:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8023a7:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  8023ae:	e8 9f 15 00 00       	call   803952 <mutex_unlock>
+	return r;
+  8023b3:	83 c4 10             	add    $0x10,%esp
+}
+  8023b6:	89 d8                	mov    %ebx,%eax
+  8023b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023bb:	c9                   	leave
+  8023bc:	c3                   	ret
+		return -E_BAD_PATH;
+  8023bd:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8023c2:	eb f2                	jmp    8023b6 <remove+0x55>
+
+008023c4 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8023c4:	55                   	push   %ebp
+  8023c5:	89 e5                	mov    %esp,%ebp
+  8023c7:	53                   	push   %ebx
+  8023c8:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  8023cb:	68 04 60 80 00       	push   $0x806004
+  8023d0:	e8 10 15 00 00       	call   8038e5 <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  8023d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023da:	b8 08 00 00 00       	mov    $0x8,%eax
+  8023df:	e8 7a f9 ff ff       	call   801d5e <fsipc>
+  8023e4:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8023e6:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  8023ed:	e8 60 15 00 00       	call   803952 <mutex_unlock>
+	return r;
+}
+  8023f2:	89 d8                	mov    %ebx,%eax
+  8023f4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023f7:	c9                   	leave
+  8023f8:	c3                   	ret
+
+008023f9 <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  8023f9:	55                   	push   %ebp
+  8023fa:	89 e5                	mov    %esp,%ebp
+  8023fc:	56                   	push   %esi
+  8023fd:	53                   	push   %ebx
+  8023fe:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  802401:	83 ec 0c             	sub    $0xc,%esp
+  802404:	68 04 60 80 00       	push   $0x806004
+  802409:	e8 d7 14 00 00       	call   8038e5 <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  80240e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802411:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  802416:	ba 00 00 00 00       	mov    $0x0,%edx
+  80241b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802420:	e8 39 f9 ff ff       	call   801d5e <fsipc>
+  802425:	89 c6                	mov    %eax,%esi
+  802427:	83 c4 10             	add    $0x10,%esp
+  80242a:	85 db                	test   %ebx,%ebx
+  80242c:	74 7b                	je     8024a9 <fs_bcstat+0xb0>
+  80242e:	85 c0                	test   %eax,%eax
+  802430:	78 77                	js     8024a9 <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  802432:	a1 00 70 80 00       	mov    0x807000,%eax
+  802437:	89 03                	mov    %eax,(%ebx)
+  802439:	a1 04 70 80 00       	mov    0x807004,%eax
+  80243e:	89 43 04             	mov    %eax,0x4(%ebx)
+  802441:	a1 08 70 80 00       	mov    0x807008,%eax
+  802446:	89 43 08             	mov    %eax,0x8(%ebx)
+  802449:	a1 0c 70 80 00       	mov    0x80700c,%eax
+  80244e:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802451:	a1 10 70 80 00       	mov    0x807010,%eax
+  802456:	89 43 10             	mov    %eax,0x10(%ebx)
+  802459:	a1 14 70 80 00       	mov    0x807014,%eax
+  80245e:	89 43 14             	mov    %eax,0x14(%ebx)
+  802461:	a1 18 70 80 00       	mov    0x807018,%eax
+  802466:	89 43 18             	mov    %eax,0x18(%ebx)
+  802469:	a1 1c 70 80 00       	mov    0x80701c,%eax
+  80246e:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  802471:	a1 20 70 80 00       	mov    0x807020,%eax
+  802476:	89 43 20             	mov    %eax,0x20(%ebx)
+  802479:	a1 24 70 80 00       	mov    0x807024,%eax
+  80247e:	89 43 24             	mov    %eax,0x24(%ebx)
+  802481:	a1 28 70 80 00       	mov    0x807028,%eax
+  802486:	89 43 28             	mov    %eax,0x28(%ebx)
+  802489:	a1 2c 70 80 00       	mov    0x80702c,%eax
+  80248e:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  802491:	a1 30 70 80 00       	mov    0x807030,%eax
+  802496:	89 43 30             	mov    %eax,0x30(%ebx)
+  802499:	a1 34 70 80 00       	mov    0x807034,%eax
+  80249e:	89 43 34             	mov    %eax,0x34(%ebx)
+  8024a1:	a1 38 70 80 00       	mov    0x807038,%eax
+  8024a6:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  8024a9:	83 ec 0c             	sub    $0xc,%esp
+  8024ac:	68 04 60 80 00       	push   $0x806004
+  8024b1:	e8 9c 14 00 00       	call   803952 <mutex_unlock>
+	return r;
+}
+  8024b6:	89 f0                	mov    %esi,%eax
+  8024b8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024bb:	5b                   	pop    %ebx
+  8024bc:	5e                   	pop    %esi
+  8024bd:	5d                   	pop    %ebp
+  8024be:	c3                   	ret
+
+008024bf <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  8024bf:	55                   	push   %ebp
+  8024c0:	89 e5                	mov    %esp,%ebp
+  8024c2:	56                   	push   %esi
+  8024c3:	53                   	push   %ebx
+  8024c4:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  8024c6:	0f b6 10             	movzbl (%eax),%edx
+  8024c9:	80 fa 72             	cmp    $0x72,%dl
+  8024cc:	74 44                	je     802512 <parse_mode+0x53>
+  8024ce:	80 fa 77             	cmp    $0x77,%dl
+  8024d1:	74 4b                	je     80251e <parse_mode+0x5f>
+  8024d3:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8024d8:	80 fa 61             	cmp    $0x61,%dl
+  8024db:	74 09                	je     8024e6 <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  8024dd:	89 d8                	mov    %ebx,%eax
+  8024df:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024e2:	5b                   	pop    %ebx
+  8024e3:	5e                   	pop    %esi
+  8024e4:	5d                   	pop    %ebp
+  8024e5:	c3                   	ret
+	switch (mode[0]) {
+  8024e6:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  8024eb:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  8024f0:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  8024f2:	83 ec 08             	sub    $0x8,%esp
+  8024f5:	6a 2b                	push   $0x2b
+  8024f7:	50                   	push   %eax
+  8024f8:	e8 e6 e3 ff ff       	call   8008e3 <strchr>
+  8024fd:	83 c4 10             	add    $0x10,%esp
+  802500:	85 c0                	test   %eax,%eax
+  802502:	74 d9                	je     8024dd <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  802504:	83 e3 fc             	and    $0xfffffffc,%ebx
+  802507:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  80250a:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  802510:	eb cb                	jmp    8024dd <parse_mode+0x1e>
+	switch (mode[0]) {
+  802512:	ba 01 00 00 00       	mov    $0x1,%edx
+  802517:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80251c:	eb d2                	jmp    8024f0 <parse_mode+0x31>
+  80251e:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  802523:	bb 01 03 00 00       	mov    $0x301,%ebx
+  802528:	eb c6                	jmp    8024f0 <parse_mode+0x31>
+
+0080252a <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  80252a:	55                   	push   %ebp
+  80252b:	89 e5                	mov    %esp,%ebp
+  80252d:	57                   	push   %edi
+  80252e:	56                   	push   %esi
+  80252f:	53                   	push   %ebx
+  802530:	83 ec 1c             	sub    $0x1c,%esp
+  802533:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802536:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  802539:	b8 24 50 80 00       	mov    $0x805024,%eax
+  80253e:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  802543:	83 c0 24             	add    $0x24,%eax
+  802546:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  80254a:	74 17                	je     802563 <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  80254c:	83 c3 01             	add    $0x1,%ebx
+  80254f:	83 fb 10             	cmp    $0x10,%ebx
+  802552:	75 ef                	jne    802543 <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  802554:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  802559:	89 f0                	mov    %esi,%eax
+  80255b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80255e:	5b                   	pop    %ebx
+  80255f:	5e                   	pop    %esi
+  802560:	5f                   	pop    %edi
+  802561:	5d                   	pop    %ebp
+  802562:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  802563:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  80256a:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80256d:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  802570:	c1 e7 02             	shl    $0x2,%edi
+  802573:	8d b7 20 50 80 00    	lea    0x805020(%edi),%esi
+  802579:	83 ec 04             	sub    $0x4,%esp
+  80257c:	6a 24                	push   $0x24
+  80257e:	6a 00                	push   $0x0
+  802580:	56                   	push   %esi
+  802581:	e8 9c e3 ff ff       	call   800922 <memset>
+			streams[i].f_fd = fd;
+  802586:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802589:	89 8f 20 50 80 00    	mov    %ecx,0x805020(%edi)
+			streams[i].f_flags = flags;
+  80258f:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802592:	01 d8                	add    %ebx,%eax
+  802594:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802597:	89 0c 85 24 50 80 00 	mov    %ecx,0x805024(,%eax,4)
+			return &streams[i];
+  80259e:	83 c4 10             	add    $0x10,%esp
+  8025a1:	eb b6                	jmp    802559 <stream_alloc+0x2f>
+
+008025a3 <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  8025a3:	55                   	push   %ebp
+  8025a4:	89 e5                	mov    %esp,%ebp
+  8025a6:	53                   	push   %ebx
+  8025a7:	83 ec 14             	sub    $0x14,%esp
+  8025aa:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  8025ac:	8b 40 18             	mov    0x18(%eax),%eax
+  8025af:	39 43 14             	cmp    %eax,0x14(%ebx)
+  8025b2:	74 4a                	je     8025fe <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  8025b4:	83 ec 08             	sub    $0x8,%esp
+  8025b7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8025ba:	50                   	push   %eax
+  8025bb:	ff 33                	push   (%ebx)
+  8025bd:	e8 e2 f1 ff ff       	call   8017a4 <fd_lookup>
+  8025c2:	89 c2                	mov    %eax,%edx
+  8025c4:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8025c7:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  8025cc:	85 d2                	test   %edx,%edx
+  8025ce:	78 41                	js     802611 <stream_unread+0x6e>
+  8025d0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8025d3:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  8025d9:	39 0a                	cmp    %ecx,(%edx)
+  8025db:	75 34                	jne    802611 <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  8025dd:	8b 43 14             	mov    0x14(%ebx),%eax
+  8025e0:	03 42 04             	add    0x4(%edx),%eax
+  8025e3:	2b 43 18             	sub    0x18(%ebx),%eax
+  8025e6:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  8025e9:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  8025f0:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  8025f7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025fc:	eb 13                	jmp    802611 <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  8025fe:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  802605:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  80260c:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802611:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802614:	c9                   	leave
+  802615:	c3                   	ret
+
+00802616 <stream_drain>:
+{
+  802616:	55                   	push   %ebp
+  802617:	89 e5                	mov    %esp,%ebp
+  802619:	56                   	push   %esi
+  80261a:	53                   	push   %ebx
+  80261b:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  80261d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802622:	eb 02                	jmp    802626 <stream_drain+0x10>
+  802624:	01 c3                	add    %eax,%ebx
+  802626:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802629:	39 c3                	cmp    %eax,%ebx
+  80262b:	73 43                	jae    802670 <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  80262d:	83 ec 04             	sub    $0x4,%esp
+  802630:	29 d8                	sub    %ebx,%eax
+  802632:	50                   	push   %eax
+  802633:	89 d8                	mov    %ebx,%eax
+  802635:	03 46 0c             	add    0xc(%esi),%eax
+  802638:	50                   	push   %eax
+  802639:	ff 36                	push   (%esi)
+  80263b:	e8 ec f4 ff ff       	call   801b2c <write>
+  802640:	83 c4 10             	add    $0x10,%esp
+  802643:	85 c0                	test   %eax,%eax
+  802645:	7f dd                	jg     802624 <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  802647:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  80264b:	8b 56 0c             	mov    0xc(%esi),%edx
+  80264e:	83 ec 04             	sub    $0x4,%esp
+  802651:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802654:	29 d8                	sub    %ebx,%eax
+  802656:	50                   	push   %eax
+  802657:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  80265a:	50                   	push   %eax
+  80265b:	52                   	push   %edx
+  80265c:	e8 f6 e2 ff ff       	call   800957 <memmove>
+			f->f_wend -= done;
+  802661:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802664:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  802666:	83 c4 10             	add    $0x10,%esp
+  802669:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  80266e:	eb 0a                	jmp    80267a <stream_drain+0x64>
+  802670:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  802675:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  80267a:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  80267d:	89 d0                	mov    %edx,%eax
+  80267f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802682:	5b                   	pop    %ebx
+  802683:	5e                   	pop    %esi
+  802684:	5d                   	pop    %ebp
+  802685:	c3                   	ret
+
+00802686 <stream_setup>:
+	if (f->f_buf)
+  802686:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  80268a:	74 01                	je     80268d <stream_setup+0x7>
+  80268c:	c3                   	ret
+{
+  80268d:	55                   	push   %ebp
+  80268e:	89 e5                	mov    %esp,%ebp
+  802690:	53                   	push   %ebx
+  802691:	83 ec 04             	sub    $0x4,%esp
+  802694:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  802696:	8b 40 08             	mov    0x8(%eax),%eax
+  802699:	85 c0                	test   %eax,%eax
+  80269b:	74 17                	je     8026b4 <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  80269d:	83 f8 03             	cmp    $0x3,%eax
+  8026a0:	75 2d                	jne    8026cf <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  8026a2:	8d 43 20             	lea    0x20(%ebx),%eax
+  8026a5:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  8026a8:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  8026af:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026b2:	c9                   	leave
+  8026b3:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  8026b4:	83 ec 0c             	sub    $0xc,%esp
+  8026b7:	ff 33                	push   (%ebx)
+  8026b9:	e8 29 1b 00 00       	call   8041e7 <iscons>
+  8026be:	83 c4 10             	add    $0x10,%esp
+  8026c1:	85 c0                	test   %eax,%eax
+  8026c3:	0f 9f c0             	setg   %al
+  8026c6:	0f b6 c0             	movzbl %al,%eax
+  8026c9:	83 c0 01             	add    $0x1,%eax
+  8026cc:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  8026cf:	83 ec 0c             	sub    $0xc,%esp
+  8026d2:	68 00 10 00 00       	push   $0x1000
+  8026d7:	e8 6e 0b 00 00       	call   80324a <malloc>
+  8026dc:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8026df:	83 c4 10             	add    $0x10,%esp
+  8026e2:	85 c0                	test   %eax,%eax
+  8026e4:	74 bc                	je     8026a2 <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  8026e6:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  8026ed:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  8026f1:	eb bc                	jmp    8026af <stream_setup+0x29>
+
+008026f3 <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  8026f3:	55                   	push   %ebp
+  8026f4:	89 e5                	mov    %esp,%ebp
+  8026f6:	53                   	push   %ebx
+  8026f7:	83 ec 04             	sub    $0x4,%esp
+  8026fa:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  8026fc:	e8 85 ff ff ff       	call   802686 <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  802701:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  802706:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  80270a:	74 3d                	je     802749 <stream_fill+0x56>
+  80270c:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  802710:	74 10                	je     802722 <stream_fill+0x2f>
+  802712:	89 d8                	mov    %ebx,%eax
+  802714:	e8 fd fe ff ff       	call   802616 <stream_drain>
+		return 0;
+  802719:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  80271e:	85 c0                	test   %eax,%eax
+  802720:	78 27                	js     802749 <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  802722:	83 ec 04             	sub    $0x4,%esp
+  802725:	ff 73 10             	push   0x10(%ebx)
+  802728:	ff 73 0c             	push   0xc(%ebx)
+  80272b:	ff 33                	push   (%ebx)
+  80272d:	e8 02 f3 ff ff       	call   801a34 <read>
+  802732:	83 c4 10             	add    $0x10,%esp
+  802735:	85 c0                	test   %eax,%eax
+  802737:	7e 17                	jle    802750 <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  802739:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  80273d:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  802744:	89 c2                	mov    %eax,%edx
+  802746:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  802749:	89 d0                	mov    %edx,%eax
+  80274b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80274e:	c9                   	leave
+  80274f:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802750:	c1 f8 1f             	sar    $0x1f,%eax
+  802753:	83 e0 04             	and    $0x4,%eax
+  802756:	83 c0 04             	add    $0x4,%eax
+  802759:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  80275c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802761:	eb e6                	jmp    802749 <stream_fill+0x56>
+
+00802763 <fopen>:
+{
+  802763:	55                   	push   %ebp
+  802764:	89 e5                	mov    %esp,%ebp
+  802766:	57                   	push   %edi
+  802767:	56                   	push   %esi
+  802768:	53                   	push   %ebx
+  802769:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  80276f:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  802772:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  802778:	89 f0                	mov    %esi,%eax
+  80277a:	e8 40 fd ff ff       	call   8024bf <parse_mode>
+		return 0;
+  80277f:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  802784:	85 c0                	test   %eax,%eax
+  802786:	78 2d                	js     8027b5 <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  802788:	83 ec 08             	sub    $0x8,%esp
+  80278b:	50                   	push   %eax
+  80278c:	ff 75 08             	push   0x8(%ebp)
+  80278f:	e8 e8 f8 ff ff       	call   80207c <open>
+  802794:	89 c7                	mov    %eax,%edi
+  802796:	83 c4 10             	add    $0x10,%esp
+  802799:	85 c0                	test   %eax,%eax
+  80279b:	78 58                	js     8027f5 <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  80279d:	80 3e 61             	cmpb   $0x61,(%esi)
+  8027a0:	74 1d                	je     8027bf <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  8027a2:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  8027a8:	89 f8                	mov    %edi,%eax
+  8027aa:	e8 7b fd ff ff       	call   80252a <stream_alloc>
+  8027af:	89 c3                	mov    %eax,%ebx
+  8027b1:	85 c0                	test   %eax,%eax
+  8027b3:	74 32                	je     8027e7 <fopen+0x84>
+}
+  8027b5:	89 d8                	mov    %ebx,%eax
+  8027b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027ba:	5b                   	pop    %ebx
+  8027bb:	5e                   	pop    %esi
+  8027bc:	5f                   	pop    %edi
+  8027bd:	5d                   	pop    %ebp
+  8027be:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  8027bf:	83 ec 08             	sub    $0x8,%esp
+  8027c2:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  8027c8:	50                   	push   %eax
+  8027c9:	57                   	push   %edi
+  8027ca:	e8 db f4 ff ff       	call   801caa <fstat>
+  8027cf:	83 c4 10             	add    $0x10,%esp
+  8027d2:	85 c0                	test   %eax,%eax
+  8027d4:	78 cc                	js     8027a2 <fopen+0x3f>
+		seek(fd, st.st_size);
+  8027d6:	83 ec 08             	sub    $0x8,%esp
+  8027d9:	ff 75 dc             	push   -0x24(%ebp)
+  8027dc:	57                   	push   %edi
+  8027dd:	e8 f6 f3 ff ff       	call   801bd8 <seek>
+  8027e2:	83 c4 10             	add    $0x10,%esp
+  8027e5:	eb bb                	jmp    8027a2 <fopen+0x3f>
+		close(fd);
+  8027e7:	83 ec 0c             	sub    $0xc,%esp
+  8027ea:	57                   	push   %edi
+  8027eb:	e8 08 f1 ff ff       	call   8018f8 <close>
+  8027f0:	83 c4 10             	add    $0x10,%esp
+  8027f3:	eb c0                	jmp    8027b5 <fopen+0x52>
+		return 0;
+  8027f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027fa:	eb b9                	jmp    8027b5 <fopen+0x52>
+
+008027fc <fdopen>:
+{
+  8027fc:	55                   	push   %ebp
+  8027fd:	89 e5                	mov    %esp,%ebp
+  8027ff:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  802802:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802805:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802808:	e8 b2 fc ff ff       	call   8024bf <parse_mode>
+  80280d:	89 c2                	mov    %eax,%edx
+		return 0;
+  80280f:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  802814:	85 d2                	test   %edx,%edx
+  802816:	78 0b                	js     802823 <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  802818:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80281b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80281e:	e8 07 fd ff ff       	call   80252a <stream_alloc>
+}
+  802823:	c9                   	leave
+  802824:	c3                   	ret
+
+00802825 <setvbuf>:
+{
+  802825:	55                   	push   %ebp
+  802826:	89 e5                	mov    %esp,%ebp
+  802828:	57                   	push   %edi
+  802829:	56                   	push   %esi
+  80282a:	53                   	push   %ebx
+  80282b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80282e:	8b 55 10             	mov    0x10(%ebp),%edx
+  802831:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  802834:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802838:	75 3a                	jne    802874 <setvbuf+0x4f>
+  80283a:	8d 72 ff             	lea    -0x1(%edx),%esi
+  80283d:	83 fe 02             	cmp    $0x2,%esi
+  802840:	77 39                	ja     80287b <setvbuf+0x56>
+	f->f_bufmode = mode;
+  802842:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  802845:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802849:	0f 95 c3             	setne  %bl
+  80284c:	85 ff                	test   %edi,%edi
+  80284e:	0f 95 c1             	setne  %cl
+  802851:	84 cb                	test   %cl,%bl
+  802853:	74 05                	je     80285a <setvbuf+0x35>
+  802855:	83 fa 03             	cmp    $0x3,%edx
+  802858:	75 0a                	jne    802864 <setvbuf+0x3f>
+	return 0;
+  80285a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80285f:	5b                   	pop    %ebx
+  802860:	5e                   	pop    %esi
+  802861:	5f                   	pop    %edi
+  802862:	5d                   	pop    %ebp
+  802863:	c3                   	ret
+		f->f_buf = buf;
+  802864:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802867:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  80286a:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  80286d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802872:	eb eb                	jmp    80285f <setvbuf+0x3a>
+		return EOF;
+  802874:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802879:	eb e4                	jmp    80285f <setvbuf+0x3a>
+  80287b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802880:	eb dd                	jmp    80285f <setvbuf+0x3a>
+
+00802882 <fflush>:
+{
+  802882:	55                   	push   %ebp
+  802883:	89 e5                	mov    %esp,%ebp
+  802885:	57                   	push   %edi
+  802886:	56                   	push   %esi
+  802887:	53                   	push   %ebx
+  802888:	83 ec 0c             	sub    $0xc,%esp
+  80288b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  80288e:	85 db                	test   %ebx,%ebx
+  802890:	74 1a                	je     8028ac <fflush+0x2a>
+	stream_unread(f);
+  802892:	89 d8                	mov    %ebx,%eax
+  802894:	e8 0a fd ff ff       	call   8025a3 <stream_unread>
+	return stream_drain(f);
+  802899:	89 d8                	mov    %ebx,%eax
+  80289b:	e8 76 fd ff ff       	call   802616 <stream_drain>
+  8028a0:	89 c7                	mov    %eax,%edi
+}
+  8028a2:	89 f8                	mov    %edi,%eax
+  8028a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028a7:	5b                   	pop    %ebx
+  8028a8:	5e                   	pop    %esi
+  8028a9:	5f                   	pop    %edi
+  8028aa:	5d                   	pop    %ebp
+  8028ab:	c3                   	ret
+  8028ac:	bb 20 50 80 00       	mov    $0x805020,%ebx
+  8028b1:	be 60 52 80 00       	mov    $0x805260,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  8028b6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028bb:	eb 03                	jmp    8028c0 <fflush+0x3e>
+  8028bd:	83 c3 24             	add    $0x24,%ebx
+  8028c0:	39 f3                	cmp    %esi,%ebx
+  8028c2:	74 de                	je     8028a2 <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  8028c4:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  8028c8:	74 f3                	je     8028bd <fflush+0x3b>
+  8028ca:	83 ec 0c             	sub    $0xc,%esp
+  8028cd:	53                   	push   %ebx
+  8028ce:	e8 af ff ff ff       	call   802882 <fflush>
+  8028d3:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  8028d6:	85 c0                	test   %eax,%eax
+  8028d8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8028dd:	0f 48 f8             	cmovs  %eax,%edi
+  8028e0:	eb db                	jmp    8028bd <fflush+0x3b>
+
+008028e2 <fclose>:
+{
+  8028e2:	55                   	push   %ebp
+  8028e3:	89 e5                	mov    %esp,%ebp
+  8028e5:	56                   	push   %esi
+  8028e6:	53                   	push   %ebx
+  8028e7:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  8028ea:	83 ec 0c             	sub    $0xc,%esp
+  8028ed:	56                   	push   %esi
+  8028ee:	e8 8f ff ff ff       	call   802882 <fflush>
+  8028f3:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  8028f5:	83 c4 04             	add    $0x4,%esp
+  8028f8:	ff 36                	push   (%esi)
+  8028fa:	e8 f9 ef ff ff       	call   8018f8 <close>
+  8028ff:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  802902:	85 c0                	test   %eax,%eax
+  802904:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802909:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  80290c:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  802910:	75 10                	jne    802922 <fclose+0x40>
+	f->f_flags = 0;
+  802912:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  802919:	89 d8                	mov    %ebx,%eax
+  80291b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80291e:	5b                   	pop    %ebx
+  80291f:	5e                   	pop    %esi
+  802920:	5d                   	pop    %ebp
+  802921:	c3                   	ret
+		free(f->f_buf);
+  802922:	83 ec 0c             	sub    $0xc,%esp
+  802925:	ff 76 0c             	push   0xc(%esi)
+  802928:	e8 54 08 00 00       	call   803181 <free>
+  80292d:	83 c4 10             	add    $0x10,%esp
+  802930:	eb e0                	jmp    802912 <fclose+0x30>
+
+00802932 <fileno>:
+{
+  802932:	55                   	push   %ebp
+  802933:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  802935:	8b 45 08             	mov    0x8(%ebp),%eax
+  802938:	8b 00                	mov    (%eax),%eax
+}
+  80293a:	5d                   	pop    %ebp
+  80293b:	c3                   	ret
+
+0080293c <feof>:
+{
+  80293c:	55                   	push   %ebp
+  80293d:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  80293f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802942:	8b 40 04             	mov    0x4(%eax),%eax
+  802945:	c1 e8 02             	shr    $0x2,%eax
+  802948:	83 e0 01             	and    $0x1,%eax
+}
+  80294b:	5d                   	pop    %ebp
+  80294c:	c3                   	ret
+
+0080294d <ferror>:
+{
+  80294d:	55                   	push   %ebp
+  80294e:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  802950:	8b 45 08             	mov    0x8(%ebp),%eax
+  802953:	8b 40 04             	mov    0x4(%eax),%eax
+  802956:	c1 e8 03             	shr    $0x3,%eax
+  802959:	83 e0 01             	and    $0x1,%eax
+}
+  80295c:	5d                   	pop    %ebp
+  80295d:	c3                   	ret
+
+0080295e <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  80295e:	55                   	push   %ebp
+  80295f:	89 e5                	mov    %esp,%ebp
+  802961:	53                   	push   %ebx
+  802962:	83 ec 04             	sub    $0x4,%esp
+  802965:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802968:	8b 43 18             	mov    0x18(%ebx),%eax
+  80296b:	39 43 14             	cmp    %eax,0x14(%ebx)
+  80296e:	74 15                	je     802985 <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  802970:	8b 53 0c             	mov    0xc(%ebx),%edx
+  802973:	8b 43 14             	mov    0x14(%ebx),%eax
+  802976:	8d 48 01             	lea    0x1(%eax),%ecx
+  802979:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  80297c:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  802980:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802983:	c9                   	leave
+  802984:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802985:	89 d8                	mov    %ebx,%eax
+  802987:	e8 67 fd ff ff       	call   8026f3 <stream_fill>
+  80298c:	85 c0                	test   %eax,%eax
+  80298e:	75 e0                	jne    802970 <fgetc+0x12>
+		return EOF;
+  802990:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802995:	eb e9                	jmp    802980 <fgetc+0x22>
+
+00802997 <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  802997:	55                   	push   %ebp
+  802998:	89 e5                	mov    %esp,%ebp
+  80299a:	57                   	push   %edi
+  80299b:	56                   	push   %esi
+  80299c:	53                   	push   %ebx
+  80299d:	83 ec 1c             	sub    $0x1c,%esp
+  8029a0:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  8029a3:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  8029a8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8029ab:	83 e8 01             	sub    $0x1,%eax
+  8029ae:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  8029b1:	eb 66                	jmp    802a19 <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  8029b3:	8b 46 14             	mov    0x14(%esi),%eax
+  8029b6:	8b 5e 18             	mov    0x18(%esi),%ebx
+  8029b9:	29 c3                	sub    %eax,%ebx
+  8029bb:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8029be:	29 fa                	sub    %edi,%edx
+  8029c0:	39 d3                	cmp    %edx,%ebx
+  8029c2:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  8029c5:	83 ec 04             	sub    $0x4,%esp
+  8029c8:	53                   	push   %ebx
+  8029c9:	6a 0a                	push   $0xa
+  8029cb:	03 46 0c             	add    0xc(%esi),%eax
+  8029ce:	50                   	push   %eax
+  8029cf:	e8 34 e0 ff ff       	call   800a08 <memfind>
+  8029d4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  8029d7:	8b 46 0c             	mov    0xc(%esi),%eax
+  8029da:	8b 4e 14             	mov    0x14(%esi),%ecx
+  8029dd:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  8029e0:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  8029e2:	83 c4 10             	add    $0x10,%esp
+  8029e5:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  8029e8:	74 0b                	je     8029f5 <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  8029ea:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8029ed:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8029f0:	29 d3                	sub    %edx,%ebx
+  8029f2:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  8029f5:	83 ec 04             	sub    $0x4,%esp
+  8029f8:	53                   	push   %ebx
+  8029f9:	01 c8                	add    %ecx,%eax
+  8029fb:	50                   	push   %eax
+  8029fc:	89 f8                	mov    %edi,%eax
+  8029fe:	03 45 08             	add    0x8(%ebp),%eax
+  802a01:	50                   	push   %eax
+  802a02:	e8 50 df ff ff       	call   800957 <memmove>
+		f->f_rpos += m;
+  802a07:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  802a0a:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  802a0c:	83 c4 10             	add    $0x10,%esp
+  802a0f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a12:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  802a17:	74 1f                	je     802a38 <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  802a19:	8d 47 01             	lea    0x1(%edi),%eax
+  802a1c:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  802a1f:	73 17                	jae    802a38 <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802a21:	8b 46 18             	mov    0x18(%esi),%eax
+  802a24:	39 46 14             	cmp    %eax,0x14(%esi)
+  802a27:	75 8a                	jne    8029b3 <fgets+0x1c>
+  802a29:	89 f0                	mov    %esi,%eax
+  802a2b:	e8 c3 fc ff ff       	call   8026f3 <stream_fill>
+  802a30:	85 c0                	test   %eax,%eax
+  802a32:	0f 85 7b ff ff ff    	jne    8029b3 <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  802a38:	85 ff                	test   %edi,%edi
+  802a3a:	74 0f                	je     802a4b <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  802a3c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a3f:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  802a43:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a46:	5b                   	pop    %ebx
+  802a47:	5e                   	pop    %esi
+  802a48:	5f                   	pop    %edi
+  802a49:	5d                   	pop    %ebp
+  802a4a:	c3                   	ret
+		return 0;
+  802a4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a50:	eb f1                	jmp    802a43 <fgets+0xac>
+
+00802a52 <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  802a52:	55                   	push   %ebp
+  802a53:	89 e5                	mov    %esp,%ebp
+  802a55:	57                   	push   %edi
+  802a56:	56                   	push   %esi
+  802a57:	53                   	push   %ebx
+  802a58:	83 ec 1c             	sub    $0x1c,%esp
+  802a5b:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  802a5e:	89 f0                	mov    %esi,%eax
+  802a60:	e8 21 fc ff ff       	call   802686 <stream_setup>
+	want = size * n;
+  802a65:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a68:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802a6c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  802a6f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a74:	eb 43                	jmp    802ab9 <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  802a76:	29 d3                	sub    %edx,%ebx
+  802a78:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802a7b:	29 f8                	sub    %edi,%eax
+  802a7d:	39 c3                	cmp    %eax,%ebx
+  802a7f:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  802a82:	83 ec 04             	sub    $0x4,%esp
+  802a85:	53                   	push   %ebx
+  802a86:	03 56 0c             	add    0xc(%esi),%edx
+  802a89:	52                   	push   %edx
+  802a8a:	89 f8                	mov    %edi,%eax
+  802a8c:	03 45 08             	add    0x8(%ebp),%eax
+  802a8f:	50                   	push   %eax
+  802a90:	e8 c2 de ff ff       	call   800957 <memmove>
+			f->f_rpos += m;
+  802a95:	01 5e 14             	add    %ebx,0x14(%esi)
+  802a98:	83 c4 10             	add    $0x10,%esp
+  802a9b:	eb 1a                	jmp    802ab7 <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  802a9d:	83 ec 04             	sub    $0x4,%esp
+  802aa0:	53                   	push   %ebx
+  802aa1:	89 f8                	mov    %edi,%eax
+  802aa3:	03 45 08             	add    0x8(%ebp),%eax
+  802aa6:	50                   	push   %eax
+  802aa7:	ff 36                	push   (%esi)
+  802aa9:	e8 86 ef ff ff       	call   801a34 <read>
+  802aae:	89 c3                	mov    %eax,%ebx
+  802ab0:	83 c4 10             	add    $0x10,%esp
+  802ab3:	85 c0                	test   %eax,%eax
+  802ab5:	7e 36                	jle    802aed <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  802ab7:	01 df                	add    %ebx,%edi
+  802ab9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802abc:	39 c7                	cmp    %eax,%edi
+  802abe:	73 39                	jae    802af9 <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  802ac0:	8b 56 14             	mov    0x14(%esi),%edx
+  802ac3:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802ac6:	39 da                	cmp    %ebx,%edx
+  802ac8:	72 ac                	jb     802a76 <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  802aca:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802acd:	29 fb                	sub    %edi,%ebx
+  802acf:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  802ad2:	72 3e                	jb     802b12 <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  802ad4:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  802ad8:	74 1f                	je     802af9 <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  802ada:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  802ade:	74 bd                	je     802a9d <fread+0x4b>
+  802ae0:	89 f0                	mov    %esi,%eax
+  802ae2:	e8 2f fb ff ff       	call   802616 <stream_drain>
+  802ae7:	85 c0                	test   %eax,%eax
+  802ae9:	79 b2                	jns    802a9d <fread+0x4b>
+  802aeb:	eb 0c                	jmp    802af9 <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802aed:	c1 fb 1f             	sar    $0x1f,%ebx
+  802af0:	83 e3 04             	and    $0x4,%ebx
+  802af3:	83 c3 04             	add    $0x4,%ebx
+  802af6:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  802af9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802afc:	85 c0                	test   %eax,%eax
+  802afe:	74 0a                	je     802b0a <fread+0xb8>
+  802b00:	89 f8                	mov    %edi,%eax
+  802b02:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b07:	f7 75 0c             	divl   0xc(%ebp)
+}
+  802b0a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b0d:	5b                   	pop    %ebx
+  802b0e:	5e                   	pop    %esi
+  802b0f:	5f                   	pop    %edi
+  802b10:	5d                   	pop    %ebp
+  802b11:	c3                   	ret
+		} else if (!stream_fill(f))
+  802b12:	89 f0                	mov    %esi,%eax
+  802b14:	e8 da fb ff ff       	call   8026f3 <stream_fill>
+  802b19:	85 c0                	test   %eax,%eax
+  802b1b:	74 dc                	je     802af9 <fread+0xa7>
+			m = 0;
+  802b1d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b22:	eb 93                	jmp    802ab7 <fread+0x65>
+
+00802b24 <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  802b24:	55                   	push   %ebp
+  802b25:	89 e5                	mov    %esp,%ebp
+  802b27:	57                   	push   %edi
+  802b28:	56                   	push   %esi
+  802b29:	53                   	push   %ebx
+  802b2a:	83 ec 1c             	sub    $0x1c,%esp
+  802b2d:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  802b30:	8b 43 04             	mov    0x4(%ebx),%eax
+  802b33:	a8 02                	test   $0x2,%al
+  802b35:	75 13                	jne    802b4a <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  802b37:	83 c8 08             	or     $0x8,%eax
+  802b3a:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  802b3d:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  802b42:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b45:	5b                   	pop    %ebx
+  802b46:	5e                   	pop    %esi
+  802b47:	5f                   	pop    %edi
+  802b48:	5d                   	pop    %ebp
+  802b49:	c3                   	ret
+	stream_setup(f);
+  802b4a:	89 d8                	mov    %ebx,%eax
+  802b4c:	e8 35 fb ff ff       	call   802686 <stream_setup>
+	want = size * n;
+  802b51:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b54:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802b58:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  802b5b:	89 d8                	mov    %ebx,%eax
+  802b5d:	e8 41 fa ff ff       	call   8025a3 <stream_unread>
+	for (done = 0; done < want; ) {
+  802b62:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  802b67:	84 c0                	test   %al,%al
+  802b69:	75 7b                	jne    802be6 <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  802b6b:	be 00 00 00 00       	mov    $0x0,%esi
+  802b70:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802b73:	39 fe                	cmp    %edi,%esi
+  802b75:	73 24                	jae    802b9b <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802b77:	83 ec 04             	sub    $0x4,%esp
+  802b7a:	89 f8                	mov    %edi,%eax
+  802b7c:	29 f0                	sub    %esi,%eax
+  802b7e:	50                   	push   %eax
+  802b7f:	89 f0                	mov    %esi,%eax
+  802b81:	03 45 08             	add    0x8(%ebp),%eax
+  802b84:	50                   	push   %eax
+  802b85:	ff 33                	push   (%ebx)
+  802b87:	e8 a0 ef ff ff       	call   801b2c <write>
+  802b8c:	83 c4 10             	add    $0x10,%esp
+  802b8f:	85 c0                	test   %eax,%eax
+  802b91:	7e 04                	jle    802b97 <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  802b93:	01 c6                	add    %eax,%esi
+  802b95:	eb dc                	jmp    802b73 <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  802b97:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  802b9b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b9e:	85 c0                	test   %eax,%eax
+  802ba0:	74 a0                	je     802b42 <fwrite+0x1e>
+  802ba2:	89 f0                	mov    %esi,%eax
+  802ba4:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ba9:	f7 75 0c             	divl   0xc(%ebp)
+  802bac:	eb 94                	jmp    802b42 <fwrite+0x1e>
+			done += r;
+  802bae:	01 c7                	add    %eax,%edi
+			continue;
+  802bb0:	eb 34                	jmp    802be6 <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  802bb2:	8b 73 10             	mov    0x10(%ebx),%esi
+  802bb5:	29 c6                	sub    %eax,%esi
+  802bb7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802bba:	29 fa                	sub    %edi,%edx
+  802bbc:	39 d6                	cmp    %edx,%esi
+  802bbe:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  802bc1:	83 ec 04             	sub    $0x4,%esp
+  802bc4:	56                   	push   %esi
+  802bc5:	89 fa                	mov    %edi,%edx
+  802bc7:	03 55 08             	add    0x8(%ebp),%edx
+  802bca:	52                   	push   %edx
+  802bcb:	03 43 0c             	add    0xc(%ebx),%eax
+  802bce:	50                   	push   %eax
+  802bcf:	e8 83 dd ff ff       	call   800957 <memmove>
+		f->f_wend += m;
+  802bd4:	89 f0                	mov    %esi,%eax
+  802bd6:	03 43 1c             	add    0x1c(%ebx),%eax
+  802bd9:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  802bdc:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802bde:	83 c4 10             	add    $0x10,%esp
+  802be1:	3b 43 10             	cmp    0x10(%ebx),%eax
+  802be4:	74 5b                	je     802c41 <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  802be6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802be9:	39 c7                	cmp    %eax,%edi
+  802beb:	73 2d                	jae    802c1a <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  802bed:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802bf0:	85 c0                	test   %eax,%eax
+  802bf2:	75 be                	jne    802bb2 <fwrite+0x8e>
+  802bf4:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802bf7:	29 fa                	sub    %edi,%edx
+  802bf9:	3b 53 10             	cmp    0x10(%ebx),%edx
+  802bfc:	72 b4                	jb     802bb2 <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802bfe:	83 ec 04             	sub    $0x4,%esp
+  802c01:	52                   	push   %edx
+  802c02:	89 f8                	mov    %edi,%eax
+  802c04:	03 45 08             	add    0x8(%ebp),%eax
+  802c07:	50                   	push   %eax
+  802c08:	ff 33                	push   (%ebx)
+  802c0a:	e8 1d ef ff ff       	call   801b2c <write>
+  802c0f:	83 c4 10             	add    $0x10,%esp
+  802c12:	85 c0                	test   %eax,%eax
+  802c14:	7f 98                	jg     802bae <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  802c16:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  802c1a:	8b 43 08             	mov    0x8(%ebx),%eax
+  802c1d:	83 f8 03             	cmp    $0x3,%eax
+  802c20:	74 48                	je     802c6a <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802c22:	83 f8 02             	cmp    $0x2,%eax
+  802c25:	74 27                	je     802c4e <fwrite+0x12a>
+	return size ? done / size : 0;
+  802c27:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c2a:	85 c0                	test   %eax,%eax
+  802c2c:	0f 84 10 ff ff ff    	je     802b42 <fwrite+0x1e>
+  802c32:	89 f8                	mov    %edi,%eax
+  802c34:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c39:	f7 75 0c             	divl   0xc(%ebp)
+  802c3c:	e9 01 ff ff ff       	jmp    802b42 <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802c41:	89 d8                	mov    %ebx,%eax
+  802c43:	e8 ce f9 ff ff       	call   802616 <stream_drain>
+  802c48:	85 c0                	test   %eax,%eax
+  802c4a:	79 9a                	jns    802be6 <fwrite+0xc2>
+  802c4c:	eb cc                	jmp    802c1a <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802c4e:	83 ec 04             	sub    $0x4,%esp
+  802c51:	57                   	push   %edi
+  802c52:	6a 0a                	push   $0xa
+  802c54:	ff 75 08             	push   0x8(%ebp)
+  802c57:	e8 ac dd ff ff       	call   800a08 <memfind>
+  802c5c:	89 c2                	mov    %eax,%edx
+  802c5e:	89 f8                	mov    %edi,%eax
+  802c60:	03 45 08             	add    0x8(%ebp),%eax
+  802c63:	83 c4 10             	add    $0x10,%esp
+  802c66:	39 c2                	cmp    %eax,%edx
+  802c68:	74 bd                	je     802c27 <fwrite+0x103>
+		stream_drain(f);
+  802c6a:	89 d8                	mov    %ebx,%eax
+  802c6c:	e8 a5 f9 ff ff       	call   802616 <stream_drain>
+  802c71:	eb b4                	jmp    802c27 <fwrite+0x103>
+
+00802c73 <fputc>:
+{
+  802c73:	55                   	push   %ebp
+  802c74:	89 e5                	mov    %esp,%ebp
+  802c76:	53                   	push   %ebx
+  802c77:	83 ec 14             	sub    $0x14,%esp
+  802c7a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  802c7d:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  802c80:	ff 75 0c             	push   0xc(%ebp)
+  802c83:	6a 01                	push   $0x1
+  802c85:	6a 01                	push   $0x1
+  802c87:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802c8a:	50                   	push   %eax
+  802c8b:	e8 94 fe ff ff       	call   802b24 <fwrite>
+  802c90:	83 c4 10             	add    $0x10,%esp
+  802c93:	0f b6 db             	movzbl %bl,%ebx
+  802c96:	83 f8 01             	cmp    $0x1,%eax
+  802c99:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802c9e:	0f 44 c3             	cmove  %ebx,%eax
+}
+  802ca1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ca4:	c9                   	leave
+  802ca5:	c3                   	ret
+
+00802ca6 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  802ca6:	55                   	push   %ebp
+  802ca7:	89 e5                	mov    %esp,%ebp
+  802ca9:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  802cac:	ff 75 0c             	push   0xc(%ebp)
+  802caf:	ff 75 08             	push   0x8(%ebp)
+  802cb2:	e8 bc ff ff ff       	call   802c73 <fputc>
+}
+  802cb7:	83 c4 10             	add    $0x10,%esp
+  802cba:	c9                   	leave
+  802cbb:	c3                   	ret
+
+00802cbc <fputs>:
+{
+  802cbc:	55                   	push   %ebp
+  802cbd:	89 e5                	mov    %esp,%ebp
+  802cbf:	56                   	push   %esi
+  802cc0:	53                   	push   %ebx
+  802cc1:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  802cc4:	83 ec 0c             	sub    $0xc,%esp
+  802cc7:	56                   	push   %esi
+  802cc8:	e8 c9 da ff ff       	call   800796 <strlen>
+  802ccd:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  802ccf:	ff 75 0c             	push   0xc(%ebp)
+  802cd2:	50                   	push   %eax
+  802cd3:	6a 01                	push   $0x1
+  802cd5:	56                   	push   %esi
+  802cd6:	e8 49 fe ff ff       	call   802b24 <fwrite>
+  802cdb:	83 c4 20             	add    $0x20,%esp
+  802cde:	39 d8                	cmp    %ebx,%eax
+  802ce0:	0f 95 c0             	setne  %al
+  802ce3:	0f b6 c0             	movzbl %al,%eax
+  802ce6:	f7 d8                	neg    %eax
+}
+  802ce8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ceb:	5b                   	pop    %ebx
+  802cec:	5e                   	pop    %esi
+  802ced:	5d                   	pop    %ebp
+  802cee:	c3                   	ret
+
+00802cef <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  802cef:	55                   	push   %ebp
+  802cf0:	89 e5                	mov    %esp,%ebp
+  802cf2:	53                   	push   %ebx
+  802cf3:	83 ec 04             	sub    $0x4,%esp
+  802cf6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802cf9:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  802cfc:	50                   	push   %eax
+  802cfd:	ff 75 0c             	push   0xc(%ebp)
+  802d00:	53                   	push   %ebx
+  802d01:	68 a6 2c 80 00       	push   $0x802ca6
+  802d06:	e8 d9 d5 ff ff       	call   8002e4 <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  802d0b:	8b 43 04             	mov    0x4(%ebx),%eax
+  802d0e:	c1 e0 1c             	shl    $0x1c,%eax
+  802d11:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  802d14:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d17:	c9                   	leave
+  802d18:	c3                   	ret
+
+00802d19 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802d19:	55                   	push   %ebp
+  802d1a:	89 e5                	mov    %esp,%ebp
+  802d1c:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802d1f:	68 e8 4d 80 00       	push   $0x804de8
+  802d24:	ff 75 0c             	push   0xc(%ebp)
+  802d27:	e8 a5 da ff ff       	call   8007d1 <strcpy>
+	return 0;
+}
+  802d2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d31:	c9                   	leave
+  802d32:	c3                   	ret
+
+00802d33 <devsock_close>:
+{
+  802d33:	55                   	push   %ebp
+  802d34:	89 e5                	mov    %esp,%ebp
+  802d36:	53                   	push   %ebx
+  802d37:	83 ec 10             	sub    $0x10,%esp
+  802d3a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802d3d:	53                   	push   %ebx
+  802d3e:	e8 57 17 00 00       	call   80449a <pageref>
+  802d43:	89 c2                	mov    %eax,%edx
+  802d45:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802d48:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802d4d:	83 fa 01             	cmp    $0x1,%edx
+  802d50:	74 05                	je     802d57 <devsock_close+0x24>
+}
+  802d52:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d55:	c9                   	leave
+  802d56:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802d57:	83 ec 0c             	sub    $0xc,%esp
+  802d5a:	ff 73 0c             	push   0xc(%ebx)
+  802d5d:	e8 b7 02 00 00       	call   803019 <nsipc_close>
+  802d62:	83 c4 10             	add    $0x10,%esp
+  802d65:	eb eb                	jmp    802d52 <devsock_close+0x1f>
+
+00802d67 <devsock_write>:
+{
+  802d67:	55                   	push   %ebp
+  802d68:	89 e5                	mov    %esp,%ebp
+  802d6a:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802d6d:	6a 00                	push   $0x0
+  802d6f:	ff 75 10             	push   0x10(%ebp)
+  802d72:	ff 75 0c             	push   0xc(%ebp)
+  802d75:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d78:	ff 70 0c             	push   0xc(%eax)
+  802d7b:	e8 79 03 00 00       	call   8030f9 <nsipc_send>
+}
+  802d80:	c9                   	leave
+  802d81:	c3                   	ret
+
+00802d82 <devsock_read>:
+{
+  802d82:	55                   	push   %ebp
+  802d83:	89 e5                	mov    %esp,%ebp
+  802d85:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802d88:	6a 00                	push   $0x0
+  802d8a:	ff 75 10             	push   0x10(%ebp)
+  802d8d:	ff 75 0c             	push   0xc(%ebp)
+  802d90:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d93:	ff 70 0c             	push   0xc(%eax)
+  802d96:	e8 ef 02 00 00       	call   80308a <nsipc_recv>
+}
+  802d9b:	c9                   	leave
+  802d9c:	c3                   	ret
+
+00802d9d <fd2sockid>:
+{
+  802d9d:	55                   	push   %ebp
+  802d9e:	89 e5                	mov    %esp,%ebp
+  802da0:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802da3:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802da6:	52                   	push   %edx
+  802da7:	50                   	push   %eax
+  802da8:	e8 f7 e9 ff ff       	call   8017a4 <fd_lookup>
+  802dad:	83 c4 10             	add    $0x10,%esp
+  802db0:	85 c0                	test   %eax,%eax
+  802db2:	78 10                	js     802dc4 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802db4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802db7:	8b 0d 60 52 80 00    	mov    0x805260,%ecx
+  802dbd:	39 08                	cmp    %ecx,(%eax)
+  802dbf:	75 05                	jne    802dc6 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802dc1:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802dc4:	c9                   	leave
+  802dc5:	c3                   	ret
+		return -E_NOT_SUPP;
+  802dc6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802dcb:	eb f7                	jmp    802dc4 <fd2sockid+0x27>
+
+00802dcd <alloc_sockfd>:
+{
+  802dcd:	55                   	push   %ebp
+  802dce:	89 e5                	mov    %esp,%ebp
+  802dd0:	56                   	push   %esi
+  802dd1:	53                   	push   %ebx
+  802dd2:	83 ec 1c             	sub    $0x1c,%esp
+  802dd5:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802dd7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802dda:	50                   	push   %eax
+  802ddb:	e8 6e e9 ff ff       	call   80174e <fd_alloc>
+  802de0:	89 c3                	mov    %eax,%ebx
+  802de2:	83 c4 10             	add    $0x10,%esp
+  802de5:	85 c0                	test   %eax,%eax
+  802de7:	78 43                	js     802e2c <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802de9:	83 ec 04             	sub    $0x4,%esp
+  802dec:	68 07 04 00 00       	push   $0x407
+  802df1:	ff 75 f4             	push   -0xc(%ebp)
+  802df4:	6a 00                	push   $0x0
+  802df6:	e8 14 de ff ff       	call   800c0f <sys_page_alloc>
+  802dfb:	89 c3                	mov    %eax,%ebx
+  802dfd:	83 c4 10             	add    $0x10,%esp
+  802e00:	85 c0                	test   %eax,%eax
+  802e02:	78 28                	js     802e2c <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802e04:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e07:	8b 15 60 52 80 00    	mov    0x805260,%edx
+  802e0d:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802e0f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e12:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802e19:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802e1c:	83 ec 0c             	sub    $0xc,%esp
+  802e1f:	50                   	push   %eax
+  802e20:	e8 02 e9 ff ff       	call   801727 <fd2num>
+  802e25:	89 c3                	mov    %eax,%ebx
+  802e27:	83 c4 10             	add    $0x10,%esp
+  802e2a:	eb 0c                	jmp    802e38 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802e2c:	83 ec 0c             	sub    $0xc,%esp
+  802e2f:	56                   	push   %esi
+  802e30:	e8 e4 01 00 00       	call   803019 <nsipc_close>
+		return r;
+  802e35:	83 c4 10             	add    $0x10,%esp
+}
+  802e38:	89 d8                	mov    %ebx,%eax
+  802e3a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e3d:	5b                   	pop    %ebx
+  802e3e:	5e                   	pop    %esi
+  802e3f:	5d                   	pop    %ebp
+  802e40:	c3                   	ret
+
+00802e41 <accept>:
+{
+  802e41:	55                   	push   %ebp
+  802e42:	89 e5                	mov    %esp,%ebp
+  802e44:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802e47:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e4a:	e8 4e ff ff ff       	call   802d9d <fd2sockid>
+  802e4f:	85 c0                	test   %eax,%eax
+  802e51:	78 1b                	js     802e6e <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802e53:	83 ec 04             	sub    $0x4,%esp
+  802e56:	ff 75 10             	push   0x10(%ebp)
+  802e59:	ff 75 0c             	push   0xc(%ebp)
+  802e5c:	50                   	push   %eax
+  802e5d:	e8 0e 01 00 00       	call   802f70 <nsipc_accept>
+  802e62:	83 c4 10             	add    $0x10,%esp
+  802e65:	85 c0                	test   %eax,%eax
+  802e67:	78 05                	js     802e6e <accept+0x2d>
+	return alloc_sockfd(r);
+  802e69:	e8 5f ff ff ff       	call   802dcd <alloc_sockfd>
+}
+  802e6e:	c9                   	leave
+  802e6f:	c3                   	ret
+
+00802e70 <bind>:
+{
+  802e70:	55                   	push   %ebp
+  802e71:	89 e5                	mov    %esp,%ebp
+  802e73:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802e76:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e79:	e8 1f ff ff ff       	call   802d9d <fd2sockid>
+  802e7e:	85 c0                	test   %eax,%eax
+  802e80:	78 12                	js     802e94 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802e82:	83 ec 04             	sub    $0x4,%esp
+  802e85:	ff 75 10             	push   0x10(%ebp)
+  802e88:	ff 75 0c             	push   0xc(%ebp)
+  802e8b:	50                   	push   %eax
+  802e8c:	e8 31 01 00 00       	call   802fc2 <nsipc_bind>
+  802e91:	83 c4 10             	add    $0x10,%esp
+}
+  802e94:	c9                   	leave
+  802e95:	c3                   	ret
+
+00802e96 <shutdown>:
+{
+  802e96:	55                   	push   %ebp
+  802e97:	89 e5                	mov    %esp,%ebp
+  802e99:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802e9c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e9f:	e8 f9 fe ff ff       	call   802d9d <fd2sockid>
+  802ea4:	85 c0                	test   %eax,%eax
+  802ea6:	78 0f                	js     802eb7 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802ea8:	83 ec 08             	sub    $0x8,%esp
+  802eab:	ff 75 0c             	push   0xc(%ebp)
+  802eae:	50                   	push   %eax
+  802eaf:	e8 43 01 00 00       	call   802ff7 <nsipc_shutdown>
+  802eb4:	83 c4 10             	add    $0x10,%esp
+}
+  802eb7:	c9                   	leave
+  802eb8:	c3                   	ret
+
+00802eb9 <connect>:
+{
+  802eb9:	55                   	push   %ebp
+  802eba:	89 e5                	mov    %esp,%ebp
+  802ebc:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802ebf:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ec2:	e8 d6 fe ff ff       	call   802d9d <fd2sockid>
+  802ec7:	85 c0                	test   %eax,%eax
+  802ec9:	78 12                	js     802edd <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802ecb:	83 ec 04             	sub    $0x4,%esp
+  802ece:	ff 75 10             	push   0x10(%ebp)
+  802ed1:	ff 75 0c             	push   0xc(%ebp)
+  802ed4:	50                   	push   %eax
+  802ed5:	e8 59 01 00 00       	call   803033 <nsipc_connect>
+  802eda:	83 c4 10             	add    $0x10,%esp
+}
+  802edd:	c9                   	leave
+  802ede:	c3                   	ret
+
+00802edf <listen>:
+{
+  802edf:	55                   	push   %ebp
+  802ee0:	89 e5                	mov    %esp,%ebp
+  802ee2:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802ee5:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ee8:	e8 b0 fe ff ff       	call   802d9d <fd2sockid>
+  802eed:	85 c0                	test   %eax,%eax
+  802eef:	78 0f                	js     802f00 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802ef1:	83 ec 08             	sub    $0x8,%esp
+  802ef4:	ff 75 0c             	push   0xc(%ebp)
+  802ef7:	50                   	push   %eax
+  802ef8:	e8 6b 01 00 00       	call   803068 <nsipc_listen>
+  802efd:	83 c4 10             	add    $0x10,%esp
+}
+  802f00:	c9                   	leave
+  802f01:	c3                   	ret
+
+00802f02 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802f02:	55                   	push   %ebp
+  802f03:	89 e5                	mov    %esp,%ebp
+  802f05:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802f08:	ff 75 10             	push   0x10(%ebp)
+  802f0b:	ff 75 0c             	push   0xc(%ebp)
+  802f0e:	ff 75 08             	push   0x8(%ebp)
+  802f11:	e8 41 02 00 00       	call   803157 <nsipc_socket>
+  802f16:	83 c4 10             	add    $0x10,%esp
+  802f19:	85 c0                	test   %eax,%eax
+  802f1b:	78 05                	js     802f22 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802f1d:	e8 ab fe ff ff       	call   802dcd <alloc_sockfd>
+}
+  802f22:	c9                   	leave
+  802f23:	c3                   	ret
+
+00802f24 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802f24:	55                   	push   %ebp
+  802f25:	89 e5                	mov    %esp,%ebp
+  802f27:	53                   	push   %ebx
+  802f28:	83 ec 04             	sub    $0x4,%esp
+  802f2b:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802f2d:	83 3d 08 60 80 00 00 	cmpl   $0x0,0x806008
+  802f34:	74 26                	je     802f5c <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802f36:	6a 07                	push   $0x7
+  802f38:	68 00 80 80 00       	push   $0x808000
+  802f3d:	53                   	push   %ebx
+  802f3e:	ff 35 08 60 80 00    	push   0x806008
+  802f44:	e8 bc 14 00 00       	call   804405 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802f49:	83 c4 0c             	add    $0xc,%esp
+  802f4c:	6a 00                	push   $0x0
+  802f4e:	6a 00                	push   $0x0
+  802f50:	6a 00                	push   $0x0
+  802f52:	e8 b8 13 00 00       	call   80430f <ipc_recv>
+}
+  802f57:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f5a:	c9                   	leave
+  802f5b:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802f5c:	83 ec 0c             	sub    $0xc,%esp
+  802f5f:	6a 02                	push   $0x2
+  802f61:	e8 f5 14 00 00       	call   80445b <ipc_find_env>
+  802f66:	a3 08 60 80 00       	mov    %eax,0x806008
+  802f6b:	83 c4 10             	add    $0x10,%esp
+  802f6e:	eb c6                	jmp    802f36 <nsipc+0x12>
+
+00802f70 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802f70:	55                   	push   %ebp
+  802f71:	89 e5                	mov    %esp,%ebp
+  802f73:	56                   	push   %esi
+  802f74:	53                   	push   %ebx
+  802f75:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802f78:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f7b:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802f80:	8b 06                	mov    (%esi),%eax
+  802f82:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802f87:	b8 01 00 00 00       	mov    $0x1,%eax
+  802f8c:	e8 93 ff ff ff       	call   802f24 <nsipc>
+  802f91:	89 c3                	mov    %eax,%ebx
+  802f93:	85 c0                	test   %eax,%eax
+  802f95:	79 09                	jns    802fa0 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802f97:	89 d8                	mov    %ebx,%eax
+  802f99:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f9c:	5b                   	pop    %ebx
+  802f9d:	5e                   	pop    %esi
+  802f9e:	5d                   	pop    %ebp
+  802f9f:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802fa0:	83 ec 04             	sub    $0x4,%esp
+  802fa3:	ff 35 10 80 80 00    	push   0x808010
+  802fa9:	68 00 80 80 00       	push   $0x808000
+  802fae:	ff 75 0c             	push   0xc(%ebp)
+  802fb1:	e8 a1 d9 ff ff       	call   800957 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802fb6:	a1 10 80 80 00       	mov    0x808010,%eax
+  802fbb:	89 06                	mov    %eax,(%esi)
+  802fbd:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802fc0:	eb d5                	jmp    802f97 <nsipc_accept+0x27>
+
+00802fc2 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802fc2:	55                   	push   %ebp
+  802fc3:	89 e5                	mov    %esp,%ebp
+  802fc5:	53                   	push   %ebx
+  802fc6:	83 ec 08             	sub    $0x8,%esp
+  802fc9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802fcc:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fcf:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802fd4:	53                   	push   %ebx
+  802fd5:	ff 75 0c             	push   0xc(%ebp)
+  802fd8:	68 04 80 80 00       	push   $0x808004
+  802fdd:	e8 75 d9 ff ff       	call   800957 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802fe2:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  802fe8:	b8 02 00 00 00       	mov    $0x2,%eax
+  802fed:	e8 32 ff ff ff       	call   802f24 <nsipc>
+}
+  802ff2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ff5:	c9                   	leave
+  802ff6:	c3                   	ret
+
+00802ff7 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802ff7:	55                   	push   %ebp
+  802ff8:	89 e5                	mov    %esp,%ebp
+  802ffa:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802ffd:	8b 45 08             	mov    0x8(%ebp),%eax
+  803000:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  803005:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803008:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  80300d:	b8 03 00 00 00       	mov    $0x3,%eax
+  803012:	e8 0d ff ff ff       	call   802f24 <nsipc>
+}
+  803017:	c9                   	leave
+  803018:	c3                   	ret
+
+00803019 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  803019:	55                   	push   %ebp
+  80301a:	89 e5                	mov    %esp,%ebp
+  80301c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  80301f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803022:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  803027:	b8 04 00 00 00       	mov    $0x4,%eax
+  80302c:	e8 f3 fe ff ff       	call   802f24 <nsipc>
+}
+  803031:	c9                   	leave
+  803032:	c3                   	ret
+
+00803033 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  803033:	55                   	push   %ebp
+  803034:	89 e5                	mov    %esp,%ebp
+  803036:	53                   	push   %ebx
+  803037:	83 ec 08             	sub    $0x8,%esp
+  80303a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  80303d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803040:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  803045:	53                   	push   %ebx
+  803046:	ff 75 0c             	push   0xc(%ebp)
+  803049:	68 04 80 80 00       	push   $0x808004
+  80304e:	e8 04 d9 ff ff       	call   800957 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  803053:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  803059:	b8 05 00 00 00       	mov    $0x5,%eax
+  80305e:	e8 c1 fe ff ff       	call   802f24 <nsipc>
+}
+  803063:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803066:	c9                   	leave
+  803067:	c3                   	ret
+
+00803068 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  803068:	55                   	push   %ebp
+  803069:	89 e5                	mov    %esp,%ebp
+  80306b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  80306e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803071:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  803076:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803079:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  80307e:	b8 06 00 00 00       	mov    $0x6,%eax
+  803083:	e8 9c fe ff ff       	call   802f24 <nsipc>
+}
+  803088:	c9                   	leave
+  803089:	c3                   	ret
+
+0080308a <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  80308a:	55                   	push   %ebp
+  80308b:	89 e5                	mov    %esp,%ebp
+  80308d:	56                   	push   %esi
+  80308e:	53                   	push   %ebx
+  80308f:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  803092:	8b 45 08             	mov    0x8(%ebp),%eax
+  803095:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  80309a:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  8030a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8030a3:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8030a8:	b8 07 00 00 00       	mov    $0x7,%eax
+  8030ad:	e8 72 fe ff ff       	call   802f24 <nsipc>
+  8030b2:	89 c3                	mov    %eax,%ebx
+  8030b4:	85 c0                	test   %eax,%eax
+  8030b6:	78 22                	js     8030da <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8030b8:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8030bd:	39 c6                	cmp    %eax,%esi
+  8030bf:	0f 4e c6             	cmovle %esi,%eax
+  8030c2:	39 c3                	cmp    %eax,%ebx
+  8030c4:	7f 1d                	jg     8030e3 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8030c6:	83 ec 04             	sub    $0x4,%esp
+  8030c9:	53                   	push   %ebx
+  8030ca:	68 00 80 80 00       	push   $0x808000
+  8030cf:	ff 75 0c             	push   0xc(%ebp)
+  8030d2:	e8 80 d8 ff ff       	call   800957 <memmove>
+  8030d7:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8030da:	89 d8                	mov    %ebx,%eax
+  8030dc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8030df:	5b                   	pop    %ebx
+  8030e0:	5e                   	pop    %esi
+  8030e1:	5d                   	pop    %ebp
+  8030e2:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8030e3:	68 f4 4d 80 00       	push   $0x804df4
+  8030e8:	68 f1 4c 80 00       	push   $0x804cf1
+  8030ed:	6a 62                	push   $0x62
+  8030ef:	68 09 4e 80 00       	push   $0x804e09
+  8030f4:	e8 6c 11 00 00       	call   804265 <_panic>
+
+008030f9 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8030f9:	55                   	push   %ebp
+  8030fa:	89 e5                	mov    %esp,%ebp
+  8030fc:	53                   	push   %ebx
+  8030fd:	83 ec 04             	sub    $0x4,%esp
+  803100:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  803103:	8b 45 08             	mov    0x8(%ebp),%eax
+  803106:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  80310b:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  803111:	7f 2e                	jg     803141 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  803113:	83 ec 04             	sub    $0x4,%esp
+  803116:	53                   	push   %ebx
+  803117:	ff 75 0c             	push   0xc(%ebp)
+  80311a:	68 0c 80 80 00       	push   $0x80800c
+  80311f:	e8 33 d8 ff ff       	call   800957 <memmove>
+	nsipcbuf.send.req_size = size;
+  803124:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  80312a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80312d:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  803132:	b8 08 00 00 00       	mov    $0x8,%eax
+  803137:	e8 e8 fd ff ff       	call   802f24 <nsipc>
+}
+  80313c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80313f:	c9                   	leave
+  803140:	c3                   	ret
+	assert(size < 1600);
+  803141:	68 15 4e 80 00       	push   $0x804e15
+  803146:	68 f1 4c 80 00       	push   $0x804cf1
+  80314b:	6a 6d                	push   $0x6d
+  80314d:	68 09 4e 80 00       	push   $0x804e09
+  803152:	e8 0e 11 00 00       	call   804265 <_panic>
+
+00803157 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  803157:	55                   	push   %ebp
+  803158:	89 e5                	mov    %esp,%ebp
+  80315a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  80315d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803160:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  803165:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803168:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  80316d:	8b 45 10             	mov    0x10(%ebp),%eax
+  803170:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  803175:	b8 09 00 00 00       	mov    $0x9,%eax
+  80317a:	e8 a5 fd ff ff       	call   802f24 <nsipc>
+}
+  80317f:	c9                   	leave
+  803180:	c3                   	ret
+
+00803181 <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  803181:	55                   	push   %ebp
+  803182:	89 e5                	mov    %esp,%ebp
+  803184:	53                   	push   %ebx
+  803185:	83 ec 10             	sub    $0x10,%esp
+  803188:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  80318b:	68 0c 60 80 00       	push   $0x80600c
+  803190:	e8 50 07 00 00       	call   8038e5 <mutex_lock>
+	if (v == 0)
+  803195:	83 c4 10             	add    $0x10,%esp
+  803198:	85 db                	test   %ebx,%ebx
+  80319a:	0f 84 85 00 00 00    	je     803225 <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  8031a0:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  8031a6:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  8031ab:	77 51                	ja     8031fe <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  8031ad:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  8031b3:	89 d8                	mov    %ebx,%eax
+  8031b5:	c1 e8 0c             	shr    $0xc,%eax
+  8031b8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8031bf:	f6 c4 02             	test   $0x2,%ah
+  8031c2:	74 50                	je     803214 <free+0x93>
+		sys_page_unmap(0, c);
+  8031c4:	83 ec 08             	sub    $0x8,%esp
+  8031c7:	53                   	push   %ebx
+  8031c8:	6a 00                	push   $0x0
+  8031ca:	e8 d9 da ff ff       	call   800ca8 <sys_page_unmap>
+		c += PGSIZE;
+  8031cf:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  8031d5:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  8031db:	83 c4 10             	add    $0x10,%esp
+  8031de:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  8031e3:	76 ce                	jbe    8031b3 <free+0x32>
+  8031e5:	68 5f 4e 80 00       	push   $0x804e5f
+  8031ea:	68 f1 4c 80 00       	push   $0x804cf1
+  8031ef:	68 82 00 00 00       	push   $0x82
+  8031f4:	68 52 4e 80 00       	push   $0x804e52
+  8031f9:	e8 67 10 00 00       	call   804265 <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  8031fe:	68 24 4e 80 00       	push   $0x804e24
+  803203:	68 f1 4c 80 00       	push   $0x804cf1
+  803208:	6a 7b                	push   $0x7b
+  80320a:	68 52 4e 80 00       	push   $0x804e52
+  80320f:	e8 51 10 00 00       	call   804265 <_panic>
+	if (--(*ref) == 0)
+  803214:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  80321a:	83 e8 01             	sub    $0x1,%eax
+  80321d:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  803223:	74 15                	je     80323a <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  803225:	83 ec 0c             	sub    $0xc,%esp
+  803228:	68 0c 60 80 00       	push   $0x80600c
+  80322d:	e8 20 07 00 00       	call   803952 <mutex_unlock>
+}
+  803232:	83 c4 10             	add    $0x10,%esp
+  803235:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803238:	c9                   	leave
+  803239:	c3                   	ret
+		sys_page_unmap(0, c);
+  80323a:	83 ec 08             	sub    $0x8,%esp
+  80323d:	53                   	push   %ebx
+  80323e:	6a 00                	push   $0x0
+  803240:	e8 63 da ff ff       	call   800ca8 <sys_page_unmap>
+  803245:	83 c4 10             	add    $0x10,%esp
+  803248:	eb db                	jmp    803225 <free+0xa4>
+
+0080324a <malloc>:
+{
+  80324a:	55                   	push   %ebp
+  80324b:	89 e5                	mov    %esp,%ebp
+  80324d:	57                   	push   %edi
+  80324e:	56                   	push   %esi
+  80324f:	53                   	push   %ebx
+  803250:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  803253:	68 0c 60 80 00       	push   $0x80600c
+  803258:	e8 88 06 00 00       	call   8038e5 <mutex_lock>
+	if (mptr == 0)
+  80325d:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+  803263:	83 c4 10             	add    $0x10,%esp
+  803266:	85 ff                	test   %edi,%edi
+  803268:	74 6c                	je     8032d6 <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  80326a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80326d:	83 c0 03             	add    $0x3,%eax
+  803270:	83 e0 fc             	and    $0xfffffffc,%eax
+  803273:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  803275:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  80327a:	0f 87 64 01 00 00    	ja     8033e4 <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  803280:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803286:	74 30                	je     8032b8 <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  803288:	89 f9                	mov    %edi,%ecx
+  80328a:	c1 e9 0c             	shr    $0xc,%ecx
+  80328d:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  803291:	c1 e8 0c             	shr    $0xc,%eax
+  803294:	39 c1                	cmp    %eax,%ecx
+  803296:	74 5f                	je     8032f7 <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  803298:	83 ec 0c             	sub    $0xc,%esp
+  80329b:	57                   	push   %edi
+  80329c:	e8 e0 fe ff ff       	call   803181 <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  8032a1:	a1 10 60 80 00       	mov    0x806010,%eax
+  8032a6:	05 00 10 00 00       	add    $0x1000,%eax
+  8032ab:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8032b0:	a3 10 60 80 00       	mov    %eax,0x806010
+  8032b5:	83 c4 10             	add    $0x10,%esp
+  8032b8:	8b 0d 10 60 80 00    	mov    0x806010,%ecx
+{
+  8032be:	ba 02 00 00 00       	mov    $0x2,%edx
+  8032c3:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  8032c7:	8d 7e 04             	lea    0x4(%esi),%edi
+  8032ca:	89 cb                	mov    %ecx,%ebx
+  8032cc:	01 f9                	add    %edi,%ecx
+  8032ce:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8032d1:	e9 8b 00 00 00       	jmp    803361 <malloc+0x117>
+		mptr = mbegin;
+  8032d6:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  8032dd:	00 00 08 
+	n = ROUNDUP(n, 4);
+  8032e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032e3:	83 c0 03             	add    $0x3,%eax
+  8032e6:	83 e0 fc             	and    $0xfffffffc,%eax
+  8032e9:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  8032eb:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  8032f0:	76 c6                	jbe    8032b8 <malloc+0x6e>
+  8032f2:	e9 d6 00 00 00       	jmp    8033cd <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  8032f7:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  8032fd:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  803302:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  803306:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  803309:	a3 10 60 80 00       	mov    %eax,0x806010
+			return v;
+  80330e:	e9 ba 00 00 00       	jmp    8033cd <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  803313:	05 00 10 00 00       	add    $0x1000,%eax
+  803318:	39 c8                	cmp    %ecx,%eax
+  80331a:	0f 83 cb 00 00 00    	jae    8033eb <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  803320:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  803325:	77 22                	ja     803349 <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  803327:	89 c2                	mov    %eax,%edx
+  803329:	c1 ea 16             	shr    $0x16,%edx
+  80332c:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  803333:	f6 c2 01             	test   $0x1,%dl
+  803336:	74 db                	je     803313 <malloc+0xc9>
+  803338:	89 c2                	mov    %eax,%edx
+  80333a:	c1 ea 0c             	shr    $0xc,%edx
+  80333d:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  803344:	f6 c2 01             	test   $0x1,%dl
+  803347:	74 ca                	je     803313 <malloc+0xc9>
+		if (mptr == mend) {
+  803349:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80334f:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  803355:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  803359:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  80335f:	74 04                	je     803365 <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  803361:	89 d8                	mov    %ebx,%eax
+  803363:	eb b3                	jmp    803318 <malloc+0xce>
+  803365:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  803368:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  80336d:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  803371:	83 ea 01             	sub    $0x1,%edx
+  803374:	0f 85 50 ff ff ff    	jne    8032ca <malloc+0x80>
+  80337a:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  803381:	00 00 08 
+				return 0;	/* out of address space */
+  803384:	bf 00 00 00 00       	mov    $0x0,%edi
+  803389:	eb 42                	jmp    8033cd <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  80338b:	85 db                	test   %ebx,%ebx
+  80338d:	78 1e                	js     8033ad <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  80338f:	83 ec 08             	sub    $0x8,%esp
+  803392:	89 d8                	mov    %ebx,%eax
+  803394:	03 05 10 60 80 00    	add    0x806010,%eax
+  80339a:	50                   	push   %eax
+  80339b:	6a 00                	push   $0x0
+  80339d:	e8 06 d9 ff ff       	call   800ca8 <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  8033a2:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  8033a8:	83 c4 10             	add    $0x10,%esp
+  8033ab:	eb de                	jmp    80338b <malloc+0x141>
+			return 0;	/* out of physical memory */
+  8033ad:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033b2:	eb 19                	jmp    8033cd <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  8033b4:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8033b7:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  8033bd:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  8033c4:	00 
+	mptr += n;
+  8033c5:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  8033c8:	a3 10 60 80 00       	mov    %eax,0x806010
+	mutex_unlock(&malloc_mu);
+  8033cd:	83 ec 0c             	sub    $0xc,%esp
+  8033d0:	68 0c 60 80 00       	push   $0x80600c
+  8033d5:	e8 78 05 00 00       	call   803952 <mutex_unlock>
+}
+  8033da:	89 f8                	mov    %edi,%eax
+  8033dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033df:	5b                   	pop    %ebx
+  8033e0:	5e                   	pop    %esi
+  8033e1:	5f                   	pop    %edi
+  8033e2:	5d                   	pop    %ebp
+  8033e3:	c3                   	ret
+		return 0;
+  8033e4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033e9:	eb e2                	jmp    8033cd <malloc+0x183>
+  8033eb:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  8033ef:	74 06                	je     8033f7 <malloc+0x1ad>
+  8033f1:	89 1d 10 60 80 00    	mov    %ebx,0x806010
+	for (i = 0; i < n + 4; i += PGSIZE){
+  8033f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8033fc:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8033ff:	39 fb                	cmp    %edi,%ebx
+  803401:	73 b1                	jae    8033b4 <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  803403:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  803409:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  80340c:	39 fe                	cmp    %edi,%esi
+  80340e:	0f 92 c0             	setb   %al
+  803411:	0f b6 c0             	movzbl %al,%eax
+  803414:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  803417:	83 c8 07             	or     $0x7,%eax
+  80341a:	50                   	push   %eax
+  80341b:	89 d8                	mov    %ebx,%eax
+  80341d:	03 05 10 60 80 00    	add    0x806010,%eax
+  803423:	50                   	push   %eax
+  803424:	6a 00                	push   $0x0
+  803426:	e8 e4 d7 ff ff       	call   800c0f <sys_page_alloc>
+  80342b:	83 c4 10             	add    $0x10,%esp
+  80342e:	85 c0                	test   %eax,%eax
+  803430:	0f 88 55 ff ff ff    	js     80338b <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  803436:	89 f3                	mov    %esi,%ebx
+  803438:	eb c5                	jmp    8033ff <malloc+0x1b5>
+
+0080343a <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80343a:	55                   	push   %ebp
+  80343b:	89 e5                	mov    %esp,%ebp
+  80343d:	56                   	push   %esi
+  80343e:	53                   	push   %ebx
+  80343f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803442:	83 ec 0c             	sub    $0xc,%esp
+  803445:	ff 75 08             	push   0x8(%ebp)
+  803448:	e8 ea e2 ff ff       	call   801737 <fd2data>
+  80344d:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80344f:	83 c4 08             	add    $0x8,%esp
+  803452:	68 77 4e 80 00       	push   $0x804e77
+  803457:	53                   	push   %ebx
+  803458:	e8 74 d3 ff ff       	call   8007d1 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  80345d:	8b 46 04             	mov    0x4(%esi),%eax
+  803460:	2b 06                	sub    (%esi),%eax
+  803462:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  803468:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80346f:	00 00 00 
+	stat->st_dev = &devpipe;
+  803472:	c7 83 88 00 00 00 7c 	movl   $0x80527c,0x88(%ebx)
+  803479:	52 80 00 
+	return 0;
+}
+  80347c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803481:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803484:	5b                   	pop    %ebx
+  803485:	5e                   	pop    %esi
+  803486:	5d                   	pop    %ebp
+  803487:	c3                   	ret
+
+00803488 <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  803488:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80348d:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  803491:	85 c9                	test   %ecx,%ecx
+  803493:	75 01                	jne    803496 <pipewake+0xe>
+  803495:	c3                   	ret
+{
+  803496:	55                   	push   %ebp
+  803497:	89 e5                	mov    %esp,%ebp
+  803499:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  80349c:	68 00 04 00 00       	push   $0x400
+  8034a1:	52                   	push   %edx
+  8034a2:	e8 ac da ff ff       	call   800f53 <sys_futex_wake>
+  8034a7:	83 c4 10             	add    $0x10,%esp
+}
+  8034aa:	c9                   	leave
+  8034ab:	c3                   	ret
+
+008034ac <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8034ac:	55                   	push   %ebp
+  8034ad:	89 e5                	mov    %esp,%ebp
+  8034af:	56                   	push   %esi
+  8034b0:	53                   	push   %ebx
+  8034b1:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8034b4:	83 ec 0c             	sub    $0xc,%esp
+  8034b7:	56                   	push   %esi
+  8034b8:	e8 7a e2 ff ff       	call   801737 <fd2data>
+  8034bd:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  8034bf:	83 c4 08             	add    $0x8,%esp
+  8034c2:	56                   	push   %esi
+  8034c3:	6a 00                	push   $0x0
+  8034c5:	e8 de d7 ff ff       	call   800ca8 <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  8034ca:	8d 53 04             	lea    0x4(%ebx),%edx
+  8034cd:	8d 43 08             	lea    0x8(%ebx),%eax
+  8034d0:	e8 b3 ff ff ff       	call   803488 <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  8034d5:	8d 43 0c             	lea    0xc(%ebx),%eax
+  8034d8:	89 da                	mov    %ebx,%edx
+  8034da:	e8 a9 ff ff ff       	call   803488 <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  8034df:	89 34 24             	mov    %esi,(%esp)
+  8034e2:	e8 50 e2 ff ff       	call   801737 <fd2data>
+  8034e7:	83 c4 08             	add    $0x8,%esp
+  8034ea:	50                   	push   %eax
+  8034eb:	6a 00                	push   $0x0
+  8034ed:	e8 b6 d7 ff ff       	call   800ca8 <sys_page_unmap>
+}
+  8034f2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8034f5:	5b                   	pop    %ebx
+  8034f6:	5e                   	pop    %esi
+  8034f7:	5d                   	pop    %ebp
+  8034f8:	c3                   	ret
+
+008034f9 <_pipeisclosed>:
+{
+  8034f9:	55                   	push   %ebp
+  8034fa:	89 e5                	mov    %esp,%ebp
+  8034fc:	57                   	push   %edi
+  8034fd:	56                   	push   %esi
+  8034fe:	53                   	push   %ebx
+  8034ff:	83 ec 1c             	sub    $0x1c,%esp
+  803502:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803505:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803507:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  80350c:	eb 5d                	jmp    80356b <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  80350e:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		n = thisenv->env_runs;
+  803514:	8b 02                	mov    (%edx),%eax
+  803516:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  803519:	83 ec 0c             	sub    $0xc,%esp
+  80351c:	ff 75 e0             	push   -0x20(%ebp)
+  80351f:	e8 76 0f 00 00       	call   80449a <pageref>
+  803524:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803527:	89 3c 24             	mov    %edi,(%esp)
+  80352a:	e8 6b 0f 00 00       	call   80449a <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  80352f:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803531:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  803537:	83 c4 10             	add    $0x10,%esp
+  80353a:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803540:	77 15                	ja     803557 <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803542:	89 f2                	mov    %esi,%edx
+  803544:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  803546:	c1 ea 10             	shr    $0x10,%edx
+  803549:	74 0c                	je     803557 <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80354b:	c1 e2 10             	shl    $0x10,%edx
+  80354e:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  803553:	29 d1                	sub    %edx,%ecx
+  803555:	eb 06                	jmp    80355d <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  803557:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		nn = thisenv->env_runs;
+  80355d:	8b 11                	mov    (%ecx),%edx
+  80355f:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  803562:	39 d3                	cmp    %edx,%ebx
+  803564:	74 6e                	je     8035d4 <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  803566:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803569:	74 24                	je     80358f <_pipeisclosed+0x96>
+  80356b:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80356d:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803573:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803578:	77 94                	ja     80350e <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80357a:	89 f0                	mov    %esi,%eax
+  80357c:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80357e:	c1 e8 10             	shr    $0x10,%eax
+  803581:	74 8b                	je     80350e <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803583:	c1 e0 10             	shl    $0x10,%eax
+  803586:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80358b:	29 c2                	sub    %eax,%edx
+  80358d:	eb 85                	jmp    803514 <_pipeisclosed+0x1b>
+  80358f:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803591:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803597:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80359c:	77 18                	ja     8035b6 <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80359e:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8035a3:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8035a5:	c1 e8 10             	shr    $0x10,%eax
+  8035a8:	74 0c                	je     8035b6 <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8035aa:	c1 e0 10             	shl    $0x10,%eax
+  8035ad:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8035b2:	29 c2                	sub    %eax,%edx
+  8035b4:	eb 06                	jmp    8035bc <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  8035b6:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8035bc:	8b 02                	mov    (%edx),%eax
+  8035be:	8b 40 58             	mov    0x58(%eax),%eax
+  8035c1:	6a 01                	push   $0x1
+  8035c3:	50                   	push   %eax
+  8035c4:	53                   	push   %ebx
+  8035c5:	68 7e 4e 80 00       	push   $0x804e7e
+  8035ca:	e8 1e cc ff ff       	call   8001ed <cprintf>
+  8035cf:	83 c4 10             	add    $0x10,%esp
+  8035d2:	eb 97                	jmp    80356b <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  8035d4:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8035d7:	0f 94 c0             	sete   %al
+  8035da:	0f b6 c0             	movzbl %al,%eax
+}
+  8035dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8035e0:	5b                   	pop    %ebx
+  8035e1:	5e                   	pop    %esi
+  8035e2:	5f                   	pop    %edi
+  8035e3:	5d                   	pop    %ebp
+  8035e4:	c3                   	ret
+
+008035e5 <devpipe_write>:
+{
+  8035e5:	55                   	push   %ebp
+  8035e6:	89 e5                	mov    %esp,%ebp
+  8035e8:	57                   	push   %edi
+  8035e9:	56                   	push   %esi
+  8035ea:	53                   	push   %ebx
+  8035eb:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  8035ee:	ff 75 08             	push   0x8(%ebp)
+  8035f1:	e8 41 e1 ff ff       	call   801737 <fd2data>
+  8035f6:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8035f8:	83 c4 10             	add    $0x10,%esp
+  8035fb:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  803602:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  803605:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803608:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80360b:	0f 84 96 00 00 00    	je     8036a7 <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  803611:	8d 73 08             	lea    0x8(%ebx),%esi
+  803614:	eb 32                	jmp    803648 <devpipe_write+0x63>
+  803616:	89 fa                	mov    %edi,%edx
+  803618:	89 f0                	mov    %esi,%eax
+  80361a:	e8 69 fe ff ff       	call   803488 <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  80361f:	8b 43 04             	mov    0x4(%ebx),%eax
+  803622:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  803625:	ba 01 00 00 00       	mov    $0x1,%edx
+  80362a:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  80362f:	83 ec 04             	sub    $0x4,%esp
+  803632:	6a 0a                	push   $0xa
+  803634:	50                   	push   %eax
+  803635:	53                   	push   %ebx
+  803636:	e8 e9 d8 ff ff       	call   800f24 <sys_futex_wait>
+  80363b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803640:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  803645:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  803648:	8b 43 04             	mov    0x4(%ebx),%eax
+  80364b:	8b 0b                	mov    (%ebx),%ecx
+  80364d:	8d 51 20             	lea    0x20(%ecx),%edx
+  803650:	39 d0                	cmp    %edx,%eax
+  803652:	72 1b                	jb     80366f <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  803654:	89 da                	mov    %ebx,%edx
+  803656:	8b 45 08             	mov    0x8(%ebp),%eax
+  803659:	e8 9b fe ff ff       	call   8034f9 <_pipeisclosed>
+  80365e:	85 c0                	test   %eax,%eax
+  803660:	74 b4                	je     803616 <devpipe_write+0x31>
+				return 0;
+  803662:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803667:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80366a:	5b                   	pop    %ebx
+  80366b:	5e                   	pop    %esi
+  80366c:	5f                   	pop    %edi
+  80366d:	5d                   	pop    %ebp
+  80366e:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80366f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803672:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803675:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  803679:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  80367c:	89 c2                	mov    %eax,%edx
+  80367e:	c1 fa 1f             	sar    $0x1f,%edx
+  803681:	89 d1                	mov    %edx,%ecx
+  803683:	c1 e9 1b             	shr    $0x1b,%ecx
+  803686:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  803689:	83 e2 1f             	and    $0x1f,%edx
+  80368c:	29 ca                	sub    %ecx,%edx
+  80368e:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  803692:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  803696:	83 c0 01             	add    $0x1,%eax
+  803699:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  80369c:	83 c6 01             	add    $0x1,%esi
+  80369f:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8036a2:	e9 5e ff ff ff       	jmp    803605 <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  8036a7:	8d 53 04             	lea    0x4(%ebx),%edx
+  8036aa:	8d 43 08             	lea    0x8(%ebx),%eax
+  8036ad:	e8 d6 fd ff ff       	call   803488 <pipewake>
+	return i;
+  8036b2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8036b5:	eb b0                	jmp    803667 <devpipe_write+0x82>
+
+008036b7 <devpipe_read>:
+{
+  8036b7:	55                   	push   %ebp
+  8036b8:	89 e5                	mov    %esp,%ebp
+  8036ba:	57                   	push   %edi
+  8036bb:	56                   	push   %esi
+  8036bc:	53                   	push   %ebx
+  8036bd:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  8036c0:	ff 75 08             	push   0x8(%ebp)
+  8036c3:	e8 6f e0 ff ff       	call   801737 <fd2data>
+  8036c8:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8036ca:	83 c4 10             	add    $0x10,%esp
+  8036cd:	be 00 00 00 00       	mov    $0x0,%esi
+  8036d2:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8036d5:	74 6c                	je     803743 <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  8036d7:	8d 7b 04             	lea    0x4(%ebx),%edi
+  8036da:	eb 25                	jmp    803701 <devpipe_read+0x4a>
+  8036dc:	8b 13                	mov    (%ebx),%edx
+  8036de:	b8 01 00 00 00       	mov    $0x1,%eax
+  8036e3:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  8036e8:	83 ec 04             	sub    $0x4,%esp
+  8036eb:	6a 0a                	push   $0xa
+  8036ed:	52                   	push   %edx
+  8036ee:	57                   	push   %edi
+  8036ef:	e8 30 d8 ff ff       	call   800f24 <sys_futex_wait>
+  8036f4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8036f9:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  8036fe:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  803701:	8b 03                	mov    (%ebx),%eax
+  803703:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803706:	75 19                	jne    803721 <devpipe_read+0x6a>
+			if (i > 0)
+  803708:	85 f6                	test   %esi,%esi
+  80370a:	75 3a                	jne    803746 <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  80370c:	89 da                	mov    %ebx,%edx
+  80370e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803711:	e8 e3 fd ff ff       	call   8034f9 <_pipeisclosed>
+  803716:	85 c0                	test   %eax,%eax
+  803718:	74 c2                	je     8036dc <devpipe_read+0x25>
+				return 0;
+  80371a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80371f:	eb 31                	jmp    803752 <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803721:	89 c1                	mov    %eax,%ecx
+  803723:	c1 f9 1f             	sar    $0x1f,%ecx
+  803726:	c1 e9 1b             	shr    $0x1b,%ecx
+  803729:	01 c8                	add    %ecx,%eax
+  80372b:	83 e0 1f             	and    $0x1f,%eax
+  80372e:	29 c8                	sub    %ecx,%eax
+  803730:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  803735:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803738:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80373b:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80373e:	83 c6 01             	add    $0x1,%esi
+  803741:	eb 8f                	jmp    8036d2 <devpipe_read+0x1b>
+out:
+  803743:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  803746:	8d 43 0c             	lea    0xc(%ebx),%eax
+  803749:	89 da                	mov    %ebx,%edx
+  80374b:	e8 38 fd ff ff       	call   803488 <pipewake>
+	return i;
+  803750:	89 f0                	mov    %esi,%eax
+}
+  803752:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803755:	5b                   	pop    %ebx
+  803756:	5e                   	pop    %esi
+  803757:	5f                   	pop    %edi
+  803758:	5d                   	pop    %ebp
+  803759:	c3                   	ret
+
+0080375a <pipe>:
+{
+  80375a:	55                   	push   %ebp
+  80375b:	89 e5                	mov    %esp,%ebp
+  80375d:	56                   	push   %esi
+  80375e:	53                   	push   %ebx
+  80375f:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803762:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803765:	50                   	push   %eax
+  803766:	e8 e3 df ff ff       	call   80174e <fd_alloc>
+  80376b:	89 c3                	mov    %eax,%ebx
+  80376d:	83 c4 10             	add    $0x10,%esp
+  803770:	85 c0                	test   %eax,%eax
+  803772:	0f 88 23 01 00 00    	js     80389b <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803778:	83 ec 04             	sub    $0x4,%esp
+  80377b:	68 07 04 00 00       	push   $0x407
+  803780:	ff 75 f4             	push   -0xc(%ebp)
+  803783:	6a 00                	push   $0x0
+  803785:	e8 85 d4 ff ff       	call   800c0f <sys_page_alloc>
+  80378a:	89 c3                	mov    %eax,%ebx
+  80378c:	83 c4 10             	add    $0x10,%esp
+  80378f:	85 c0                	test   %eax,%eax
+  803791:	0f 88 04 01 00 00    	js     80389b <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803797:	83 ec 0c             	sub    $0xc,%esp
+  80379a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80379d:	50                   	push   %eax
+  80379e:	e8 ab df ff ff       	call   80174e <fd_alloc>
+  8037a3:	89 c3                	mov    %eax,%ebx
+  8037a5:	83 c4 10             	add    $0x10,%esp
+  8037a8:	85 c0                	test   %eax,%eax
+  8037aa:	0f 88 db 00 00 00    	js     80388b <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8037b0:	83 ec 04             	sub    $0x4,%esp
+  8037b3:	68 07 04 00 00       	push   $0x407
+  8037b8:	ff 75 f0             	push   -0x10(%ebp)
+  8037bb:	6a 00                	push   $0x0
+  8037bd:	e8 4d d4 ff ff       	call   800c0f <sys_page_alloc>
+  8037c2:	89 c3                	mov    %eax,%ebx
+  8037c4:	83 c4 10             	add    $0x10,%esp
+  8037c7:	85 c0                	test   %eax,%eax
+  8037c9:	0f 88 bc 00 00 00    	js     80388b <pipe+0x131>
+	va = fd2data(fd0);
+  8037cf:	83 ec 0c             	sub    $0xc,%esp
+  8037d2:	ff 75 f4             	push   -0xc(%ebp)
+  8037d5:	e8 5d df ff ff       	call   801737 <fd2data>
+  8037da:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8037dc:	83 c4 0c             	add    $0xc,%esp
+  8037df:	68 07 04 00 00       	push   $0x407
+  8037e4:	50                   	push   %eax
+  8037e5:	6a 00                	push   $0x0
+  8037e7:	e8 23 d4 ff ff       	call   800c0f <sys_page_alloc>
+  8037ec:	89 c3                	mov    %eax,%ebx
+  8037ee:	83 c4 10             	add    $0x10,%esp
+  8037f1:	85 c0                	test   %eax,%eax
+  8037f3:	0f 88 82 00 00 00    	js     80387b <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8037f9:	83 ec 0c             	sub    $0xc,%esp
+  8037fc:	ff 75 f0             	push   -0x10(%ebp)
+  8037ff:	e8 33 df ff ff       	call   801737 <fd2data>
+  803804:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80380b:	50                   	push   %eax
+  80380c:	6a 00                	push   $0x0
+  80380e:	56                   	push   %esi
+  80380f:	6a 00                	push   $0x0
+  803811:	e8 46 d4 ff ff       	call   800c5c <sys_page_map>
+  803816:	89 c3                	mov    %eax,%ebx
+  803818:	83 c4 20             	add    $0x20,%esp
+  80381b:	85 c0                	test   %eax,%eax
+  80381d:	78 4e                	js     80386d <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80381f:	a1 7c 52 80 00       	mov    0x80527c,%eax
+  803824:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803827:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803829:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80382c:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803833:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803836:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803838:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80383b:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803842:	83 ec 0c             	sub    $0xc,%esp
+  803845:	ff 75 f4             	push   -0xc(%ebp)
+  803848:	e8 da de ff ff       	call   801727 <fd2num>
+  80384d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803850:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803852:	83 c4 04             	add    $0x4,%esp
+  803855:	ff 75 f0             	push   -0x10(%ebp)
+  803858:	e8 ca de ff ff       	call   801727 <fd2num>
+  80385d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803860:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803863:	83 c4 10             	add    $0x10,%esp
+  803866:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80386b:	eb 2e                	jmp    80389b <pipe+0x141>
+	sys_page_unmap(0, va);
+  80386d:	83 ec 08             	sub    $0x8,%esp
+  803870:	56                   	push   %esi
+  803871:	6a 00                	push   $0x0
+  803873:	e8 30 d4 ff ff       	call   800ca8 <sys_page_unmap>
+  803878:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80387b:	83 ec 08             	sub    $0x8,%esp
+  80387e:	ff 75 f0             	push   -0x10(%ebp)
+  803881:	6a 00                	push   $0x0
+  803883:	e8 20 d4 ff ff       	call   800ca8 <sys_page_unmap>
+  803888:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80388b:	83 ec 08             	sub    $0x8,%esp
+  80388e:	ff 75 f4             	push   -0xc(%ebp)
+  803891:	6a 00                	push   $0x0
+  803893:	e8 10 d4 ff ff       	call   800ca8 <sys_page_unmap>
+  803898:	83 c4 10             	add    $0x10,%esp
+}
+  80389b:	89 d8                	mov    %ebx,%eax
+  80389d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8038a0:	5b                   	pop    %ebx
+  8038a1:	5e                   	pop    %esi
+  8038a2:	5d                   	pop    %ebp
+  8038a3:	c3                   	ret
+
+008038a4 <pipeisclosed>:
+{
+  8038a4:	55                   	push   %ebp
+  8038a5:	89 e5                	mov    %esp,%ebp
+  8038a7:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8038aa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8038ad:	50                   	push   %eax
+  8038ae:	ff 75 08             	push   0x8(%ebp)
+  8038b1:	e8 ee de ff ff       	call   8017a4 <fd_lookup>
+  8038b6:	83 c4 10             	add    $0x10,%esp
+  8038b9:	85 c0                	test   %eax,%eax
+  8038bb:	78 18                	js     8038d5 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8038bd:	83 ec 0c             	sub    $0xc,%esp
+  8038c0:	ff 75 f4             	push   -0xc(%ebp)
+  8038c3:	e8 6f de ff ff       	call   801737 <fd2data>
+  8038c8:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8038ca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8038cd:	e8 27 fc ff ff       	call   8034f9 <_pipeisclosed>
+  8038d2:	83 c4 10             	add    $0x10,%esp
+}
+  8038d5:	c9                   	leave
+  8038d6:	c3                   	ret
+
+008038d7 <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  8038d7:	55                   	push   %ebp
+  8038d8:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  8038da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8038dd:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8038e3:	5d                   	pop    %ebp
+  8038e4:	c3                   	ret
+
+008038e5 <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  8038e5:	55                   	push   %ebp
+  8038e6:	89 e5                	mov    %esp,%ebp
+  8038e8:	56                   	push   %esi
+  8038e9:	53                   	push   %ebx
+  8038ea:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  8038ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8038f2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8038f7:	89 d0                	mov    %edx,%eax
+  8038f9:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  8038fd:	85 c0                	test   %eax,%eax
+  8038ff:	74 2d                	je     80392e <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  803901:	83 f8 02             	cmp    $0x2,%eax
+  803904:	74 08                	je     80390e <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  803906:	b8 02 00 00 00       	mov    $0x2,%eax
+  80390b:	f0 87 03             	lock xchg %eax,(%ebx)
+  80390e:	be 02 00 00 00       	mov    $0x2,%esi
+  803913:	eb 15                	jmp    80392a <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  803915:	83 ec 04             	sub    $0x4,%esp
+  803918:	6a 00                	push   $0x0
+  80391a:	6a 02                	push   $0x2
+  80391c:	53                   	push   %ebx
+  80391d:	e8 02 d6 ff ff       	call   800f24 <sys_futex_wait>
+  803922:	89 f0                	mov    %esi,%eax
+  803924:	f0 87 03             	lock xchg %eax,(%ebx)
+  803927:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  80392a:	85 c0                	test   %eax,%eax
+  80392c:	75 e7                	jne    803915 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  80392e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803931:	5b                   	pop    %ebx
+  803932:	5e                   	pop    %esi
+  803933:	5d                   	pop    %ebp
+  803934:	c3                   	ret
+
+00803935 <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  803935:	55                   	push   %ebp
+  803936:	89 e5                	mov    %esp,%ebp
+  803938:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  80393b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803940:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803945:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  803949:	f7 d8                	neg    %eax
+  80394b:	19 c0                	sbb    %eax,%eax
+  80394d:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  803950:	5d                   	pop    %ebp
+  803951:	c3                   	ret
+
+00803952 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  803952:	55                   	push   %ebp
+  803953:	89 e5                	mov    %esp,%ebp
+  803955:	83 ec 08             	sub    $0x8,%esp
+  803958:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  80395b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803960:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  803963:	83 f8 02             	cmp    $0x2,%eax
+  803966:	74 02                	je     80396a <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  803968:	c9                   	leave
+  803969:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  80396a:	83 ec 08             	sub    $0x8,%esp
+  80396d:	6a 01                	push   $0x1
+  80396f:	52                   	push   %edx
+  803970:	e8 de d5 ff ff       	call   800f53 <sys_futex_wake>
+  803975:	83 c4 10             	add    $0x10,%esp
+}
+  803978:	eb ee                	jmp    803968 <mutex_unlock+0x16>
+
+0080397a <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  80397a:	55                   	push   %ebp
+  80397b:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  80397d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803980:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803986:	5d                   	pop    %ebp
+  803987:	c3                   	ret
+
+00803988 <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  803988:	55                   	push   %ebp
+  803989:	89 e5                	mov    %esp,%ebp
+  80398b:	57                   	push   %edi
+  80398c:	56                   	push   %esi
+  80398d:	53                   	push   %ebx
+  80398e:	83 ec 18             	sub    $0x18,%esp
+  803991:	8b 75 08             	mov    0x8(%ebp),%esi
+  803994:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  803997:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  803999:	53                   	push   %ebx
+  80399a:	e8 b3 ff ff ff       	call   803952 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  80399f:	83 c4 0c             	add    $0xc,%esp
+  8039a2:	ff 75 10             	push   0x10(%ebp)
+  8039a5:	57                   	push   %edi
+  8039a6:	56                   	push   %esi
+  8039a7:	e8 78 d5 ff ff       	call   800f24 <sys_futex_wait>
+  8039ac:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  8039ae:	83 c4 10             	add    $0x10,%esp
+  8039b1:	be 02 00 00 00       	mov    $0x2,%esi
+  8039b6:	eb 10                	jmp    8039c8 <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  8039b8:	83 ec 04             	sub    $0x4,%esp
+  8039bb:	6a 00                	push   $0x0
+  8039bd:	6a 02                	push   $0x2
+  8039bf:	53                   	push   %ebx
+  8039c0:	e8 5f d5 ff ff       	call   800f24 <sys_futex_wait>
+  8039c5:	83 c4 10             	add    $0x10,%esp
+  8039c8:	89 f0                	mov    %esi,%eax
+  8039ca:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  8039cd:	85 c0                	test   %eax,%eax
+  8039cf:	75 e7                	jne    8039b8 <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  8039d1:	83 ff ec             	cmp    $0xffffffec,%edi
+  8039d4:	74 05                	je     8039db <cond_timedwait+0x53>
+  8039d6:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  8039db:	89 f8                	mov    %edi,%eax
+  8039dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8039e0:	5b                   	pop    %ebx
+  8039e1:	5e                   	pop    %esi
+  8039e2:	5f                   	pop    %edi
+  8039e3:	5d                   	pop    %ebp
+  8039e4:	c3                   	ret
+
+008039e5 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  8039e5:	55                   	push   %ebp
+  8039e6:	89 e5                	mov    %esp,%ebp
+  8039e8:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  8039eb:	6a 00                	push   $0x0
+  8039ed:	ff 75 0c             	push   0xc(%ebp)
+  8039f0:	ff 75 08             	push   0x8(%ebp)
+  8039f3:	e8 90 ff ff ff       	call   803988 <cond_timedwait>
+}
+  8039f8:	83 c4 10             	add    $0x10,%esp
+  8039fb:	c9                   	leave
+  8039fc:	c3                   	ret
+
+008039fd <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  8039fd:	55                   	push   %ebp
+  8039fe:	89 e5                	mov    %esp,%ebp
+  803a00:	83 ec 10             	sub    $0x10,%esp
+  803a03:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  803a06:	ba 01 00 00 00       	mov    $0x1,%edx
+  803a0b:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  803a0f:	6a 01                	push   $0x1
+  803a11:	50                   	push   %eax
+  803a12:	e8 3c d5 ff ff       	call   800f53 <sys_futex_wake>
+}
+  803a17:	83 c4 10             	add    $0x10,%esp
+  803a1a:	c9                   	leave
+  803a1b:	c3                   	ret
+
+00803a1c <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  803a1c:	55                   	push   %ebp
+  803a1d:	89 e5                	mov    %esp,%ebp
+  803a1f:	83 ec 10             	sub    $0x10,%esp
+  803a22:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a25:	ba 01 00 00 00       	mov    $0x1,%edx
+  803a2a:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  803a2e:	68 00 04 00 00       	push   $0x400
+  803a33:	50                   	push   %eax
+  803a34:	e8 1a d5 ff ff       	call   800f53 <sys_futex_wake>
+}
+  803a39:	83 c4 10             	add    $0x10,%esp
+  803a3c:	c9                   	leave
+  803a3d:	c3                   	ret
+
+00803a3e <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  803a3e:	55                   	push   %ebp
+  803a3f:	89 e5                	mov    %esp,%ebp
+  803a41:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  803a44:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803a47:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  803a49:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  803a50:	5d                   	pop    %ebp
+  803a51:	c3                   	ret
+
+00803a52 <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  803a52:	55                   	push   %ebp
+  803a53:	89 e5                	mov    %esp,%ebp
+  803a55:	53                   	push   %ebx
+  803a56:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  803a59:	8b 11                	mov    (%ecx),%edx
+  803a5b:	85 d2                	test   %edx,%edx
+  803a5d:	74 14                	je     803a73 <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  803a5f:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803a62:	89 d0                	mov    %edx,%eax
+  803a64:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  803a68:	39 c2                	cmp    %eax,%edx
+  803a6a:	75 ed                	jne    803a59 <sem_trywait+0x7>
+			return 0;
+  803a6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a71:	eb 05                	jmp    803a78 <sem_trywait+0x26>
+	return -E_AGAIN;
+  803a73:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  803a78:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803a7b:	c9                   	leave
+  803a7c:	c3                   	ret
+
+00803a7d <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  803a7d:	55                   	push   %ebp
+  803a7e:	89 e5                	mov    %esp,%ebp
+  803a80:	57                   	push   %edi
+  803a81:	56                   	push   %esi
+  803a82:	53                   	push   %ebx
+  803a83:	83 ec 1c             	sub    $0x1c,%esp
+  803a86:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803a89:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  803a8c:	e8 0b d4 ff ff       	call   800e9c <sys_time_msec>
+  803a91:	01 f8                	add    %edi,%eax
+  803a93:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  803a96:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  803a9b:	eb 28                	jmp    803ac5 <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  803a9d:	b8 01 00 00 00       	mov    $0x1,%eax
+  803aa2:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  803aa7:	83 ec 04             	sub    $0x4,%esp
+  803aaa:	56                   	push   %esi
+  803aab:	6a 00                	push   $0x0
+  803aad:	53                   	push   %ebx
+  803aae:	e8 71 d4 ff ff       	call   800f24 <sys_futex_wait>
+  803ab3:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  803ab8:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  803abd:	83 c4 10             	add    $0x10,%esp
+  803ac0:	83 f8 ec             	cmp    $0xffffffec,%eax
+  803ac3:	74 2e                	je     803af3 <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  803ac5:	83 ec 0c             	sub    $0xc,%esp
+  803ac8:	53                   	push   %ebx
+  803ac9:	e8 84 ff ff ff       	call   803a52 <sem_trywait>
+  803ace:	83 c4 10             	add    $0x10,%esp
+  803ad1:	85 c0                	test   %eax,%eax
+  803ad3:	79 19                	jns    803aee <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  803ad5:	85 ff                	test   %edi,%edi
+  803ad7:	74 c4                	je     803a9d <sem_timedwait+0x20>
+  803ad9:	e8 be d3 ff ff       	call   800e9c <sys_time_msec>
+  803ade:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803ae1:	29 c6                	sub    %eax,%esi
+  803ae3:	85 f6                	test   %esi,%esi
+  803ae5:	7f b6                	jg     803a9d <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  803ae7:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  803aec:	eb 05                	jmp    803af3 <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  803aee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803af3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803af6:	5b                   	pop    %ebx
+  803af7:	5e                   	pop    %esi
+  803af8:	5f                   	pop    %edi
+  803af9:	5d                   	pop    %ebp
+  803afa:	c3                   	ret
+
+00803afb <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  803afb:	55                   	push   %ebp
+  803afc:	89 e5                	mov    %esp,%ebp
+  803afe:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  803b01:	6a 00                	push   $0x0
+  803b03:	ff 75 08             	push   0x8(%ebp)
+  803b06:	e8 72 ff ff ff       	call   803a7d <sem_timedwait>
+}
+  803b0b:	83 c4 10             	add    $0x10,%esp
+  803b0e:	c9                   	leave
+  803b0f:	c3                   	ret
+
+00803b10 <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  803b10:	55                   	push   %ebp
+  803b11:	89 e5                	mov    %esp,%ebp
+  803b13:	83 ec 08             	sub    $0x8,%esp
+  803b16:	8b 45 08             	mov    0x8(%ebp),%eax
+  803b19:	ba 01 00 00 00       	mov    $0x1,%edx
+  803b1e:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  803b22:	8b 50 04             	mov    0x4(%eax),%edx
+  803b25:	85 d2                	test   %edx,%edx
+  803b27:	75 02                	jne    803b2b <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  803b29:	c9                   	leave
+  803b2a:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  803b2b:	83 ec 08             	sub    $0x8,%esp
+  803b2e:	6a 01                	push   $0x1
+  803b30:	50                   	push   %eax
+  803b31:	e8 1d d4 ff ff       	call   800f53 <sys_futex_wake>
+  803b36:	83 c4 10             	add    $0x10,%esp
+}
+  803b39:	eb ee                	jmp    803b29 <sem_post+0x19>
+
+00803b3b <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  803b3b:	55                   	push   %ebp
+  803b3c:	89 e5                	mov    %esp,%ebp
+  803b3e:	57                   	push   %edi
+  803b3f:	56                   	push   %esi
+  803b40:	53                   	push   %ebx
+  803b41:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  803b44:	68 20 60 80 00       	push   $0x806020
+  803b49:	e8 97 fd ff ff       	call   8038e5 <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  803b4e:	a1 44 60 80 00       	mov    0x806044,%eax
+  803b53:	83 c4 10             	add    $0x10,%esp
+  803b56:	85 c0                	test   %eax,%eax
+  803b58:	75 19                	jne    803b73 <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  803b5a:	a1 c0 62 80 00       	mov    0x8062c0,%eax
+  803b5f:	8b 00                	mov    (%eax),%eax
+  803b61:	8b 40 48             	mov    0x48(%eax),%eax
+  803b64:	a3 40 60 80 00       	mov    %eax,0x806040
+		threads[0].th_state = PTH_RUNNING;
+  803b69:	c7 05 44 60 80 00 01 	movl   $0x1,0x806044
+  803b70:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803b73:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  803b78:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803b7b:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803b82:	8b 40 04             	mov    0x4(%eax),%eax
+  803b85:	85 c0                	test   %eax,%eax
+  803b87:	0f 84 e4 00 00 00    	je     803c71 <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803b8d:	83 c3 01             	add    $0x1,%ebx
+  803b90:	83 fb 20             	cmp    $0x20,%ebx
+  803b93:	75 e3                	jne    803b78 <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  803b95:	83 ec 0c             	sub    $0xc,%esp
+  803b98:	68 20 60 80 00       	push   $0x806020
+  803b9d:	e8 b0 fd ff ff       	call   803952 <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  803ba2:	83 c4 10             	add    $0x10,%esp
+  803ba5:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  803baa:	e9 b8 00 00 00       	jmp    803c67 <pthread_create+0x12c>
+  803baf:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  803bb2:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  803bb5:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  803bb7:	39 f3                	cmp    %esi,%ebx
+  803bb9:	73 16                	jae    803bd1 <pthread_create+0x96>
+		va -= PGSIZE;
+  803bbb:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  803bc1:	83 ec 08             	sub    $0x8,%esp
+  803bc4:	56                   	push   %esi
+  803bc5:	6a 00                	push   $0x0
+  803bc7:	e8 dc d0 ff ff       	call   800ca8 <sys_page_unmap>
+  803bcc:	83 c4 10             	add    $0x10,%esp
+  803bcf:	eb e6                	jmp    803bb7 <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  803bd1:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803bd4:	83 ec 08             	sub    $0x8,%esp
+  803bd7:	ff 75 e4             	push   -0x1c(%ebp)
+  803bda:	6a 00                	push   $0x0
+  803bdc:	e8 c7 d0 ff ff       	call   800ca8 <sys_page_unmap>
+	return r;
+  803be1:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  803be4:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803be7:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803bee:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  803bf5:	eb 70                	jmp    803c67 <pthread_create+0x12c>
+	th->th_fn = fn;
+  803bf7:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803bfa:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803c01:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803c04:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  803c07:	8b 55 10             	mov    0x10(%ebp),%edx
+  803c0a:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  803c0d:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  803c14:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  803c19:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803c1c:	29 c8                	sub    %ecx,%eax
+  803c1e:	85 db                	test   %ebx,%ebx
+  803c20:	0f 44 05 c0 62 80 00 	cmove  0x8062c0,%eax
+	*--esp = t;
+  803c27:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  803c2a:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803c31:	83 ec 04             	sub    $0x4,%esp
+  803c34:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803c39:	29 ca                	sub    %ecx,%edx
+  803c3b:	52                   	push   %edx
+	*--esp = 0;
+  803c3c:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803c3f:	50                   	push   %eax
+  803c40:	68 98 3e 80 00       	push   $0x803e98
+  803c45:	e8 ae d3 ff ff       	call   800ff8 <sys_thread_create>
+  803c4a:	89 c7                	mov    %eax,%edi
+  803c4c:	83 c4 10             	add    $0x10,%esp
+  803c4f:	85 c0                	test   %eax,%eax
+  803c51:	78 91                	js     803be4 <pthread_create+0xa9>
+	th->th_env = id;
+  803c53:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803c56:	89 3c 85 40 60 80 00 	mov    %edi,0x806040(,%eax,4)
+	*tp = t;
+  803c5d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803c60:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  803c62:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803c67:	89 f8                	mov    %edi,%eax
+  803c69:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c6c:	5b                   	pop    %ebx
+  803c6d:	5e                   	pop    %esi
+  803c6e:	5f                   	pop    %edi
+  803c6f:	5d                   	pop    %ebp
+  803c70:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  803c71:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803c74:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803c7b:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  803c82:	83 ec 0c             	sub    $0xc,%esp
+  803c85:	68 20 60 80 00       	push   $0x806020
+  803c8a:	e8 c3 fc ff ff       	call   803952 <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  803c8f:	89 d9                	mov    %ebx,%ecx
+  803c91:	c1 e1 10             	shl    $0x10,%ecx
+  803c94:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  803c97:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  803c9c:	29 c8                	sub    %ecx,%eax
+  803c9e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  803ca1:	c1 e8 16             	shr    $0x16,%eax
+  803ca4:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803cab:	83 c4 10             	add    $0x10,%esp
+  803cae:	a8 01                	test   $0x1,%al
+  803cb0:	74 15                	je     803cc7 <pthread_create+0x18c>
+  803cb2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803cb5:	c1 e8 0c             	shr    $0xc,%eax
+  803cb8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803cbf:	a8 01                	test   $0x1,%al
+  803cc1:	0f 85 30 ff ff ff    	jne    803bf7 <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803cc7:	83 ec 04             	sub    $0x4,%esp
+  803cca:	6a 07                	push   $0x7
+  803ccc:	ff 75 e4             	push   -0x1c(%ebp)
+  803ccf:	6a 00                	push   $0x0
+  803cd1:	e8 39 cf ff ff       	call   800c0f <sys_page_alloc>
+  803cd6:	89 c7                	mov    %eax,%edi
+  803cd8:	83 c4 10             	add    $0x10,%esp
+  803cdb:	85 c0                	test   %eax,%eax
+  803cdd:	0f 88 01 ff ff ff    	js     803be4 <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  803ce3:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  803ce8:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  803ceb:	29 d0                	sub    %edx,%eax
+  803ced:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  803cf0:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803cf2:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  803cf7:	29 d0                	sub    %edx,%eax
+  803cf9:	89 c7                	mov    %eax,%edi
+  803cfb:	39 fe                	cmp    %edi,%esi
+  803cfd:	0f 83 f4 fe ff ff    	jae    803bf7 <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803d03:	83 ec 04             	sub    $0x4,%esp
+  803d06:	6a 07                	push   $0x7
+  803d08:	56                   	push   %esi
+  803d09:	6a 00                	push   $0x0
+  803d0b:	e8 ff ce ff ff       	call   800c0f <sys_page_alloc>
+  803d10:	83 c4 10             	add    $0x10,%esp
+  803d13:	85 c0                	test   %eax,%eax
+  803d15:	0f 88 94 fe ff ff    	js     803baf <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803d1b:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803d21:	eb d8                	jmp    803cfb <pthread_create+0x1c0>
+
+00803d23 <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  803d23:	55                   	push   %ebp
+  803d24:	89 e5                	mov    %esp,%ebp
+  803d26:	57                   	push   %edi
+  803d27:	56                   	push   %esi
+  803d28:	53                   	push   %ebx
+  803d29:	83 ec 0c             	sub    $0xc,%esp
+  803d2c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  803d2f:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  803d32:	83 f8 1e             	cmp    $0x1e,%eax
+  803d35:	0f 87 c7 00 00 00    	ja     803e02 <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  803d3b:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803d3d:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803d43:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803d48:	77 12                	ja     803d5c <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803d4a:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803d4f:	29 d0                	sub    %edx,%eax
+  803d51:	c1 e8 10             	shr    $0x10,%eax
+  803d54:	39 c3                	cmp    %eax,%ebx
+  803d56:	0f 84 ad 00 00 00    	je     803e09 <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803d5c:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803d5f:	8d 3c 85 44 60 80 00 	lea    0x806044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  803d66:	8d 34 85 40 60 80 00 	lea    0x806040(,%eax,4),%esi
+  803d6d:	eb 10                	jmp    803d7f <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803d6f:	83 ec 04             	sub    $0x4,%esp
+  803d72:	6a 00                	push   $0x0
+  803d74:	6a 01                	push   $0x1
+  803d76:	57                   	push   %edi
+  803d77:	e8 a8 d1 ff ff       	call   800f24 <sys_futex_wait>
+  803d7c:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  803d7f:	8b 46 04             	mov    0x4(%esi),%eax
+  803d82:	83 f8 01             	cmp    $0x1,%eax
+  803d85:	74 e8                	je     803d6f <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  803d87:	83 f8 02             	cmp    $0x2,%eax
+  803d8a:	0f 85 80 00 00 00    	jne    803e10 <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  803d90:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  803d93:	c1 e6 02             	shl    $0x2,%esi
+  803d96:	eb 05                	jmp    803d9d <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  803d98:	e8 46 ce ff ff       	call   800be3 <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  803d9d:	8b 8e 40 60 80 00    	mov    0x806040(%esi),%ecx
+  803da3:	89 ca                	mov    %ecx,%edx
+  803da5:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  803dab:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803dae:	c1 e0 04             	shl    $0x4,%eax
+  803db1:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803db6:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  803db9:	39 c1                	cmp    %eax,%ecx
+  803dbb:	75 12                	jne    803dcf <pthread_join+0xac>
+  803dbd:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803dc0:	c1 e0 04             	shl    $0x4,%eax
+  803dc3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803dc8:	8b 40 54             	mov    0x54(%eax),%eax
+  803dcb:	85 c0                	test   %eax,%eax
+  803dcd:	75 c9                	jne    803d98 <pthread_join+0x75>
+	if (ret_store)
+  803dcf:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803dd3:	74 0f                	je     803de4 <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  803dd5:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803dd8:	8b 04 85 50 60 80 00 	mov    0x806050(,%eax,4),%eax
+  803ddf:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803de2:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  803de4:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803de7:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803dee:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  803df5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803dfa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803dfd:	5b                   	pop    %ebx
+  803dfe:	5e                   	pop    %esi
+  803dff:	5f                   	pop    %edi
+  803e00:	5d                   	pop    %ebp
+  803e01:	c3                   	ret
+		return -E_INVAL;
+  803e02:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803e07:	eb f1                	jmp    803dfa <pthread_join+0xd7>
+  803e09:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803e0e:	eb ea                	jmp    803dfa <pthread_join+0xd7>
+		return -E_INVAL;
+  803e10:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803e15:	eb e3                	jmp    803dfa <pthread_join+0xd7>
+
+00803e17 <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  803e17:	55                   	push   %ebp
+  803e18:	89 e5                	mov    %esp,%ebp
+  803e1a:	53                   	push   %ebx
+  803e1b:	83 ec 04             	sub    $0x4,%esp
+  803e1e:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803e20:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803e26:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803e2b:	77 0c                	ja     803e39 <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803e2d:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803e32:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  803e34:	c1 e8 10             	shr    $0x10,%eax
+  803e37:	75 0a                	jne    803e43 <pthread_exit+0x2c>
+		exit();
+  803e39:	e8 f2 c2 ff ff       	call   800130 <exit>
+  803e3e:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  803e43:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  803e4a:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  803e4d:	8d 0c 8d 40 60 80 00 	lea    0x806040(,%ecx,4),%ecx
+  803e54:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803e57:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  803e5a:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  803e61:	83 ec 08             	sub    $0x8,%esp
+  803e64:	6a 20                	push   $0x20
+  803e66:	01 c2                	add    %eax,%edx
+  803e68:	8d 04 95 44 60 80 00 	lea    0x806044(,%edx,4),%eax
+  803e6f:	50                   	push   %eax
+  803e70:	e8 de d0 ff ff       	call   800f53 <sys_futex_wake>
+	sys_env_destroy(0);
+  803e75:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  803e7c:	e8 eb cc ff ff       	call   800b6c <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  803e81:	83 c4 0c             	add    $0xc,%esp
+  803e84:	68 96 4e 80 00       	push   $0x804e96
+  803e89:	68 a5 00 00 00       	push   $0xa5
+  803e8e:	68 b0 4e 80 00       	push   $0x804eb0
+  803e93:	e8 cd 03 00 00       	call   804265 <_panic>
+
+00803e98 <pthread_start>:
+{
+  803e98:	55                   	push   %ebp
+  803e99:	89 e5                	mov    %esp,%ebp
+  803e9b:	53                   	push   %ebx
+  803e9c:	83 ec 04             	sub    $0x4,%esp
+  803e9f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  803ea2:	e8 10 cd ff ff       	call   800bb7 <sys_getenvid>
+  803ea7:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  803eac:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	if (t == 0)
+  803eb2:	85 db                	test   %ebx,%ebx
+  803eb4:	74 0c                	je     803ec2 <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803eb6:	89 d9                	mov    %ebx,%ecx
+  803eb8:	c1 e1 10             	shl    $0x10,%ecx
+  803ebb:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803ec0:	29 ca                	sub    %ecx,%edx
+  803ec2:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  803ec5:	c1 e0 04             	shl    $0x4,%eax
+  803ec8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803ecd:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  803ecf:	83 ec 0c             	sub    $0xc,%esp
+  803ed2:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803ed9:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803edc:	ff 34 95 4c 60 80 00 	push   0x80604c(,%edx,4)
+  803ee3:	ff 14 95 48 60 80 00 	call   *0x806048(,%edx,4)
+  803eea:	89 04 24             	mov    %eax,(%esp)
+  803eed:	e8 25 ff ff ff       	call   803e17 <pthread_exit>
+
+00803ef2 <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  803ef2:	55                   	push   %ebp
+  803ef3:	89 e5                	mov    %esp,%ebp
+  803ef5:	57                   	push   %edi
+  803ef6:	56                   	push   %esi
+  803ef7:	53                   	push   %ebx
+  803ef8:	83 ec 1c             	sub    $0x1c,%esp
+  803efb:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803efd:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  803f03:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803f0a:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803f0f:	77 0d                	ja     803f1e <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803f11:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803f16:	29 d0                	sub    %edx,%eax
+  803f18:	c1 e8 10             	shr    $0x10,%eax
+  803f1b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  803f1e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803f23:	eb 2f                	jmp    803f54 <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  803f25:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803f2b:	8b 01                	mov    (%ecx),%eax
+  803f2d:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  803f30:	39 c2                	cmp    %eax,%edx
+  803f32:	75 14                	jne    803f48 <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  803f34:	83 ec 0c             	sub    $0xc,%esp
+  803f37:	57                   	push   %edi
+  803f38:	e8 2f cc ff ff       	call   800b6c <sys_env_destroy>
+  803f3d:	83 c4 10             	add    $0x10,%esp
+  803f40:	85 c0                	test   %eax,%eax
+  803f42:	0f 88 97 00 00 00    	js     803fdf <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  803f48:	83 c3 01             	add    $0x1,%ebx
+  803f4b:	83 fb 20             	cmp    $0x20,%ebx
+  803f4e:	0f 84 d2 00 00 00    	je     804026 <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  803f54:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  803f57:	74 ef                	je     803f48 <pthread_kill_others+0x56>
+  803f59:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803f5c:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803f63:	8b 40 04             	mov    0x4(%eax),%eax
+  803f66:	83 f8 01             	cmp    $0x1,%eax
+  803f69:	75 dd                	jne    803f48 <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  803f6b:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803f6e:	8b 3c 85 40 60 80 00 	mov    0x806040(,%eax,4),%edi
+  803f75:	89 fe                	mov    %edi,%esi
+  803f77:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  803f7d:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803f80:	c1 e0 04             	shl    $0x4,%eax
+  803f83:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803f88:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803f8b:	39 c7                	cmp    %eax,%edi
+  803f8d:	75 b9                	jne    803f48 <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  803f8f:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803f92:	c1 e0 04             	shl    $0x4,%eax
+  803f95:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803f9a:	8b 40 54             	mov    0x54(%eax),%eax
+  803f9d:	85 c0                	test   %eax,%eax
+  803f9f:	74 a7                	je     803f48 <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803fa1:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803fa4:	c1 e0 04             	shl    $0x4,%eax
+  803fa7:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  803fad:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803faf:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  803fb5:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803fba:	0f 87 65 ff ff ff    	ja     803f25 <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803fc0:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803fc5:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  803fc7:	c1 e8 10             	shr    $0x10,%eax
+  803fca:	0f 84 55 ff ff ff    	je     803f25 <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803fd0:	c1 e0 10             	shl    $0x10,%eax
+  803fd3:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  803fd8:	29 c1                	sub    %eax,%ecx
+  803fda:	e9 4c ff ff ff       	jmp    803f2b <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  803fdf:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  803fe2:	c1 e2 04             	shl    $0x4,%edx
+  803fe5:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803feb:	8b 52 48             	mov    0x48(%edx),%edx
+  803fee:	39 fa                	cmp    %edi,%edx
+  803ff0:	0f 85 52 ff ff ff    	jne    803f48 <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  803ff6:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  803ff9:	c1 e2 04             	shl    $0x4,%edx
+  803ffc:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  804002:	8b 52 54             	mov    0x54(%edx),%edx
+  804005:	85 d2                	test   %edx,%edx
+  804007:	0f 84 3b ff ff ff    	je     803f48 <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  80400d:	83 ec 0c             	sub    $0xc,%esp
+  804010:	50                   	push   %eax
+  804011:	57                   	push   %edi
+  804012:	68 c0 4e 80 00       	push   $0x804ec0
+  804017:	68 bb 00 00 00       	push   $0xbb
+  80401c:	68 b0 4e 80 00       	push   $0x804eb0
+  804021:	e8 3f 02 00 00       	call   804265 <_panic>
+	}
+}
+  804026:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804029:	5b                   	pop    %ebx
+  80402a:	5e                   	pop    %esi
+  80402b:	5f                   	pop    %edi
+  80402c:	5d                   	pop    %ebp
+  80402d:	c3                   	ret
+
+0080402e <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  80402e:	55                   	push   %ebp
+  80402f:	89 e5                	mov    %esp,%ebp
+  804031:	53                   	push   %ebx
+  804032:	83 ec 04             	sub    $0x4,%esp
+  804035:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804037:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  80403d:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  804043:	0f 87 85 00 00 00    	ja     8040ce <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804049:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  80404e:	29 c3                	sub    %eax,%ebx
+  804050:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  804053:	83 ec 04             	sub    $0x4,%esp
+  804056:	68 80 02 00 00       	push   $0x280
+  80405b:	6a 00                	push   $0x0
+  80405d:	68 40 60 80 00       	push   $0x806040
+  804062:	e8 bb c8 ff ff       	call   800922 <memset>
+	threads_mu.m_state = 0;
+  804067:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  80406e:	00 00 00 
+	if (self != 0) {
+  804071:	83 c4 10             	add    $0x10,%esp
+  804074:	85 db                	test   %ebx,%ebx
+  804076:	74 51                	je     8040c9 <pthread_fork_child+0x9b>
+  804078:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80407a:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804080:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804085:	77 18                	ja     80409f <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804087:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80408c:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80408e:	c1 e8 10             	shr    $0x10,%eax
+  804091:	74 0c                	je     80409f <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804093:	c1 e0 10             	shl    $0x10,%eax
+  804096:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80409b:	29 c2                	sub    %eax,%edx
+  80409d:	eb 06                	jmp    8040a5 <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  80409f:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		threads[self].th_env = thisenv->env_id;
+  8040a5:	8b 02                	mov    (%edx),%eax
+  8040a7:	8b 48 48             	mov    0x48(%eax),%ecx
+  8040aa:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  8040b1:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  8040b4:	89 0c 95 40 60 80 00 	mov    %ecx,0x806040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  8040bb:	8d 04 95 40 60 80 00 	lea    0x806040(,%edx,4),%eax
+  8040c2:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  8040c9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8040cc:	c9                   	leave
+  8040cd:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  8040ce:	83 ec 04             	sub    $0x4,%esp
+  8040d1:	68 80 02 00 00       	push   $0x280
+  8040d6:	6a 00                	push   $0x0
+  8040d8:	68 40 60 80 00       	push   $0x806040
+  8040dd:	e8 40 c8 ff ff       	call   800922 <memset>
+	threads_mu.m_state = 0;
+  8040e2:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  8040e9:	00 00 00 
+  8040ec:	83 c4 10             	add    $0x10,%esp
+  8040ef:	eb d8                	jmp    8040c9 <pthread_fork_child+0x9b>
+
+008040f1 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8040f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040f6:	c3                   	ret
+
+008040f7 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8040f7:	55                   	push   %ebp
+  8040f8:	89 e5                	mov    %esp,%ebp
+  8040fa:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8040fd:	68 e5 4e 80 00       	push   $0x804ee5
+  804102:	ff 75 0c             	push   0xc(%ebp)
+  804105:	e8 c7 c6 ff ff       	call   8007d1 <strcpy>
+	return 0;
+}
+  80410a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80410f:	c9                   	leave
+  804110:	c3                   	ret
+
+00804111 <devcons_write>:
+{
+  804111:	55                   	push   %ebp
+  804112:	89 e5                	mov    %esp,%ebp
+  804114:	57                   	push   %edi
+  804115:	56                   	push   %esi
+  804116:	53                   	push   %ebx
+  804117:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80411d:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  804122:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  804128:	eb 2e                	jmp    804158 <devcons_write+0x47>
+		m = n - tot;
+  80412a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80412d:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80412f:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804134:	39 c3                	cmp    %eax,%ebx
+  804136:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  804139:	83 ec 04             	sub    $0x4,%esp
+  80413c:	53                   	push   %ebx
+  80413d:	89 f0                	mov    %esi,%eax
+  80413f:	03 45 0c             	add    0xc(%ebp),%eax
+  804142:	50                   	push   %eax
+  804143:	57                   	push   %edi
+  804144:	e8 0e c8 ff ff       	call   800957 <memmove>
+		sys_cputs(buf, m);
+  804149:	83 c4 08             	add    $0x8,%esp
+  80414c:	53                   	push   %ebx
+  80414d:	57                   	push   %edi
+  80414e:	e8 c2 c9 ff ff       	call   800b15 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  804153:	01 de                	add    %ebx,%esi
+  804155:	83 c4 10             	add    $0x10,%esp
+  804158:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80415b:	72 cd                	jb     80412a <devcons_write+0x19>
+}
+  80415d:	89 f0                	mov    %esi,%eax
+  80415f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804162:	5b                   	pop    %ebx
+  804163:	5e                   	pop    %esi
+  804164:	5f                   	pop    %edi
+  804165:	5d                   	pop    %ebp
+  804166:	c3                   	ret
+
+00804167 <devcons_read>:
+{
+  804167:	55                   	push   %ebp
+  804168:	89 e5                	mov    %esp,%ebp
+  80416a:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80416d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804172:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804176:	75 07                	jne    80417f <devcons_read+0x18>
+  804178:	eb 1f                	jmp    804199 <devcons_read+0x32>
+		sys_yield();
+  80417a:	e8 64 ca ff ff       	call   800be3 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80417f:	e8 bc c9 ff ff       	call   800b40 <sys_cgetc>
+  804184:	85 c0                	test   %eax,%eax
+  804186:	74 f2                	je     80417a <devcons_read+0x13>
+	if (c < 0)
+  804188:	78 0f                	js     804199 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80418a:	83 f8 04             	cmp    $0x4,%eax
+  80418d:	74 0c                	je     80419b <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80418f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804192:	88 02                	mov    %al,(%edx)
+	return 1;
+  804194:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  804199:	c9                   	leave
+  80419a:	c3                   	ret
+		return 0;
+  80419b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041a0:	eb f7                	jmp    804199 <devcons_read+0x32>
+
+008041a2 <cputchar>:
+{
+  8041a2:	55                   	push   %ebp
+  8041a3:	89 e5                	mov    %esp,%ebp
+  8041a5:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8041a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8041ab:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8041ae:	6a 01                	push   $0x1
+  8041b0:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8041b3:	50                   	push   %eax
+  8041b4:	e8 5c c9 ff ff       	call   800b15 <sys_cputs>
+}
+  8041b9:	83 c4 10             	add    $0x10,%esp
+  8041bc:	c9                   	leave
+  8041bd:	c3                   	ret
+
+008041be <getchar>:
+{
+  8041be:	55                   	push   %ebp
+  8041bf:	89 e5                	mov    %esp,%ebp
+  8041c1:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8041c4:	6a 01                	push   $0x1
+  8041c6:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8041c9:	50                   	push   %eax
+  8041ca:	6a 00                	push   $0x0
+  8041cc:	e8 63 d8 ff ff       	call   801a34 <read>
+	if (r < 0)
+  8041d1:	83 c4 10             	add    $0x10,%esp
+  8041d4:	85 c0                	test   %eax,%eax
+  8041d6:	78 06                	js     8041de <getchar+0x20>
+	if (r < 1)
+  8041d8:	74 06                	je     8041e0 <getchar+0x22>
+	return c;
+  8041da:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8041de:	c9                   	leave
+  8041df:	c3                   	ret
+		return -E_EOF;
+  8041e0:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8041e5:	eb f7                	jmp    8041de <getchar+0x20>
+
+008041e7 <iscons>:
+{
+  8041e7:	55                   	push   %ebp
+  8041e8:	89 e5                	mov    %esp,%ebp
+  8041ea:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8041ed:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8041f0:	50                   	push   %eax
+  8041f1:	ff 75 08             	push   0x8(%ebp)
+  8041f4:	e8 ab d5 ff ff       	call   8017a4 <fd_lookup>
+  8041f9:	83 c4 10             	add    $0x10,%esp
+  8041fc:	85 c0                	test   %eax,%eax
+  8041fe:	78 11                	js     804211 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  804200:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804203:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  804209:	39 10                	cmp    %edx,(%eax)
+  80420b:	0f 94 c0             	sete   %al
+  80420e:	0f b6 c0             	movzbl %al,%eax
+}
+  804211:	c9                   	leave
+  804212:	c3                   	ret
+
+00804213 <opencons>:
+{
+  804213:	55                   	push   %ebp
+  804214:	89 e5                	mov    %esp,%ebp
+  804216:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  804219:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80421c:	50                   	push   %eax
+  80421d:	e8 2c d5 ff ff       	call   80174e <fd_alloc>
+  804222:	83 c4 10             	add    $0x10,%esp
+  804225:	85 c0                	test   %eax,%eax
+  804227:	78 3a                	js     804263 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  804229:	83 ec 04             	sub    $0x4,%esp
+  80422c:	68 07 04 00 00       	push   $0x407
+  804231:	ff 75 f4             	push   -0xc(%ebp)
+  804234:	6a 00                	push   $0x0
+  804236:	e8 d4 c9 ff ff       	call   800c0f <sys_page_alloc>
+  80423b:	83 c4 10             	add    $0x10,%esp
+  80423e:	85 c0                	test   %eax,%eax
+  804240:	78 21                	js     804263 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  804242:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804245:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  80424b:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80424d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804250:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  804257:	83 ec 0c             	sub    $0xc,%esp
+  80425a:	50                   	push   %eax
+  80425b:	e8 c7 d4 ff ff       	call   801727 <fd2num>
+  804260:	83 c4 10             	add    $0x10,%esp
+}
+  804263:	c9                   	leave
+  804264:	c3                   	ret
+
+00804265 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  804265:	55                   	push   %ebp
+  804266:	89 e5                	mov    %esp,%ebp
+  804268:	56                   	push   %esi
+  804269:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80426a:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80426d:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  804273:	e8 3f c9 ff ff       	call   800bb7 <sys_getenvid>
+  804278:	83 ec 0c             	sub    $0xc,%esp
+  80427b:	ff 75 0c             	push   0xc(%ebp)
+  80427e:	ff 75 08             	push   0x8(%ebp)
+  804281:	56                   	push   %esi
+  804282:	50                   	push   %eax
+  804283:	68 f4 4e 80 00       	push   $0x804ef4
+  804288:	e8 60 bf ff ff       	call   8001ed <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80428d:	83 c4 18             	add    $0x18,%esp
+  804290:	53                   	push   %ebx
+  804291:	ff 75 10             	push   0x10(%ebp)
+  804294:	e8 03 bf ff ff       	call   80019c <vcprintf>
+	cprintf("\n");
+  804299:	c7 04 24 d4 47 80 00 	movl   $0x8047d4,(%esp)
+  8042a0:	e8 48 bf ff ff       	call   8001ed <cprintf>
+  8042a5:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8042a8:	cc                   	int3
+	while (1)
+  8042a9:	eb fd                	jmp    8042a8 <_panic+0x43>
+
+008042ab <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8042ab:	55                   	push   %ebp
+  8042ac:	89 e5                	mov    %esp,%ebp
+  8042ae:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  8042b1:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  8042b8:	74 0a                	je     8042c4 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8042ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8042bd:	a3 00 90 80 00       	mov    %eax,0x809000
+}
+  8042c2:	c9                   	leave
+  8042c3:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  8042c4:	83 ec 04             	sub    $0x4,%esp
+  8042c7:	6a 07                	push   $0x7
+  8042c9:	68 00 f0 bf ee       	push   $0xeebff000
+  8042ce:	6a 00                	push   $0x0
+  8042d0:	e8 3a c9 ff ff       	call   800c0f <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8042d5:	83 c4 08             	add    $0x8,%esp
+  8042d8:	68 e9 42 80 00       	push   $0x8042e9
+  8042dd:	6a 00                	push   $0x0
+  8042df:	e8 a8 ca ff ff       	call   800d8c <sys_env_set_pgfault_upcall>
+  8042e4:	83 c4 10             	add    $0x10,%esp
+  8042e7:	eb d1                	jmp    8042ba <set_pgfault_handler+0xf>
+
+008042e9 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8042e9:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8042ea:	a1 00 90 80 00       	mov    0x809000,%eax
+	call *%eax
+  8042ef:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8042f1:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  8042f4:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  8042f8:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  8042fc:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  8042ff:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  804303:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  804305:	83 c4 08             	add    $0x8,%esp
+	popal
+  804308:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  804309:	83 c4 04             	add    $0x4,%esp
+	popfl
+  80430c:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  80430d:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  80430e:	c3                   	ret
+
+0080430f <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80430f:	55                   	push   %ebp
+  804310:	89 e5                	mov    %esp,%ebp
+  804312:	57                   	push   %edi
+  804313:	56                   	push   %esi
+  804314:	53                   	push   %ebx
+  804315:	83 ec 18             	sub    $0x18,%esp
+  804318:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80431b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80431e:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  804321:	85 c0                	test   %eax,%eax
+  804323:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804328:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  80432b:	50                   	push   %eax
+  80432c:	e8 d4 ca ff ff       	call   800e05 <sys_ipc_recv>
+	if (r < 0) {
+  804331:	83 c4 10             	add    $0x10,%esp
+  804334:	85 c0                	test   %eax,%eax
+  804336:	78 2b                	js     804363 <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  804338:	85 ff                	test   %edi,%edi
+  80433a:	74 55                	je     804391 <ipc_recv+0x82>
+  80433c:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80433e:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804344:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804349:	77 39                	ja     804384 <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80434b:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804350:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804352:	c1 e8 10             	shr    $0x10,%eax
+  804355:	74 2d                	je     804384 <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804357:	c1 e0 10             	shl    $0x10,%eax
+  80435a:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80435f:	29 c2                	sub    %eax,%edx
+  804361:	eb 27                	jmp    80438a <ipc_recv+0x7b>
+  804363:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  804365:	83 ec 08             	sub    $0x8,%esp
+  804368:	50                   	push   %eax
+  804369:	68 17 4f 80 00       	push   $0x804f17
+  80436e:	e8 7a be ff ff       	call   8001ed <cprintf>
+		*from_env_store = 0;
+  804373:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  804379:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  80437f:	83 c4 10             	add    $0x10,%esp
+  804382:	eb 77                	jmp    8043fb <ipc_recv+0xec>
+		return pthread_main_tls;
+  804384:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  80438a:	8b 02                	mov    (%edx),%eax
+  80438c:	8b 40 78             	mov    0x78(%eax),%eax
+  80438f:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804391:	85 f6                	test   %esi,%esi
+  804393:	74 34                	je     8043c9 <ipc_recv+0xba>
+  804395:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804397:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80439d:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8043a2:	77 18                	ja     8043bc <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8043a4:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8043a9:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8043ab:	c1 e8 10             	shr    $0x10,%eax
+  8043ae:	74 0c                	je     8043bc <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8043b0:	c1 e0 10             	shl    $0x10,%eax
+  8043b3:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8043b8:	29 c2                	sub    %eax,%edx
+  8043ba:	eb 06                	jmp    8043c2 <ipc_recv+0xb3>
+		return pthread_main_tls;
+  8043bc:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  8043c2:	8b 02                	mov    (%edx),%eax
+  8043c4:	8b 40 7c             	mov    0x7c(%eax),%eax
+  8043c7:	89 06                	mov    %eax,(%esi)
+  8043c9:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8043cb:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8043d1:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8043d6:	77 18                	ja     8043f0 <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8043d8:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8043dd:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8043df:	c1 e8 10             	shr    $0x10,%eax
+  8043e2:	74 0c                	je     8043f0 <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8043e4:	c1 e0 10             	shl    $0x10,%eax
+  8043e7:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8043ec:	29 c2                	sub    %eax,%edx
+  8043ee:	eb 06                	jmp    8043f6 <ipc_recv+0xe7>
+		return pthread_main_tls;
+  8043f0:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	}
+	return thisenv->env_ipc_value;
+  8043f6:	8b 02                	mov    (%edx),%eax
+  8043f8:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  8043fb:	89 d8                	mov    %ebx,%eax
+  8043fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804400:	5b                   	pop    %ebx
+  804401:	5e                   	pop    %esi
+  804402:	5f                   	pop    %edi
+  804403:	5d                   	pop    %ebp
+  804404:	c3                   	ret
+
+00804405 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  804405:	55                   	push   %ebp
+  804406:	89 e5                	mov    %esp,%ebp
+  804408:	57                   	push   %edi
+  804409:	56                   	push   %esi
+  80440a:	53                   	push   %ebx
+  80440b:	83 ec 0c             	sub    $0xc,%esp
+  80440e:	8b 75 08             	mov    0x8(%ebp),%esi
+  804411:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804414:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  804417:	85 db                	test   %ebx,%ebx
+  804419:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80441e:	0f 44 d8             	cmove  %eax,%ebx
+  804421:	eb 05                	jmp    804428 <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  804423:	e8 bb c7 ff ff       	call   800be3 <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  804428:	57                   	push   %edi
+  804429:	53                   	push   %ebx
+  80442a:	ff 75 0c             	push   0xc(%ebp)
+  80442d:	56                   	push   %esi
+  80442e:	e8 a5 c9 ff ff       	call   800dd8 <sys_ipc_try_send>
+		if (r == 0) {
+  804433:	83 c4 10             	add    $0x10,%esp
+  804436:	85 c0                	test   %eax,%eax
+  804438:	74 19                	je     804453 <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  80443a:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80443d:	74 e4                	je     804423 <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  80443f:	83 ec 0c             	sub    $0xc,%esp
+  804442:	50                   	push   %eax
+  804443:	57                   	push   %edi
+  804444:	53                   	push   %ebx
+  804445:	56                   	push   %esi
+  804446:	68 30 4f 80 00       	push   $0x804f30
+  80444b:	e8 9d bd ff ff       	call   8001ed <cprintf>
+			return;
+  804450:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  804453:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804456:	5b                   	pop    %ebx
+  804457:	5e                   	pop    %esi
+  804458:	5f                   	pop    %edi
+  804459:	5d                   	pop    %ebp
+  80445a:	c3                   	ret
+
+0080445b <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80445b:	55                   	push   %ebp
+  80445c:	89 e5                	mov    %esp,%ebp
+  80445e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  804461:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  804466:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804469:	c1 e0 04             	shl    $0x4,%eax
+  80446c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804471:	8b 40 50             	mov    0x50(%eax),%eax
+  804474:	39 c8                	cmp    %ecx,%eax
+  804476:	74 12                	je     80448a <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804478:	83 c2 01             	add    $0x1,%edx
+  80447b:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  804481:	75 e3                	jne    804466 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  804483:	b8 00 00 00 00       	mov    $0x0,%eax
+  804488:	eb 0e                	jmp    804498 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80448a:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80448d:	c1 e0 04             	shl    $0x4,%eax
+  804490:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804495:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  804498:	5d                   	pop    %ebp
+  804499:	c3                   	ret
+
+0080449a <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80449a:	55                   	push   %ebp
+  80449b:	89 e5                	mov    %esp,%ebp
+  80449d:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8044a0:	89 c2                	mov    %eax,%edx
+  8044a2:	c1 ea 16             	shr    $0x16,%edx
+  8044a5:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8044ac:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8044b1:	f6 c1 01             	test   $0x1,%cl
+  8044b4:	74 1c                	je     8044d2 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  8044b6:	c1 e8 0c             	shr    $0xc,%eax
+  8044b9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8044c0:	a8 01                	test   $0x1,%al
+  8044c2:	74 0e                	je     8044d2 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8044c4:	c1 e8 0c             	shr    $0xc,%eax
+  8044c7:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  8044ce:	ef 
+  8044cf:	0f b7 d2             	movzwl %dx,%edx
+}
+  8044d2:	89 d0                	mov    %edx,%eax
+  8044d4:	5d                   	pop    %ebp
+  8044d5:	c3                   	ret
+
+008044d6 <udm>:
+  8044d6:	57                   	push   %edi
+  8044d7:	56                   	push   %esi
+  8044d8:	53                   	push   %ebx
+  8044d9:	83 ec 20             	sub    $0x20,%esp
+  8044dc:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8044e0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8044e4:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8044e8:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8044ec:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8044f0:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8044f4:	89 d1                	mov    %edx,%ecx
+  8044f6:	09 c1                	or     %eax,%ecx
+  8044f8:	0f 84 91 00 00 00    	je     80458f <udm+0xb9>
+  8044fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  804503:	ba 00 00 00 00       	mov    $0x0,%edx
+  804508:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80450d:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804514:	00 
+  804515:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80451c:	00 
+  80451d:	eb 08                	jmp    804527 <udm+0x51>
+  80451f:	83 e9 01             	sub    $0x1,%ecx
+  804522:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  804525:	74 7c                	je     8045a3 <udm+0xcd>
+  804527:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80452b:	01 c0                	add    %eax,%eax
+  80452d:	89 c6                	mov    %eax,%esi
+  80452f:	89 d7                	mov    %edx,%edi
+  804531:	8b 44 24 10          	mov    0x10(%esp),%eax
+  804535:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804539:	0f ad d0             	shrd   %cl,%edx,%eax
+  80453c:	d3 ea                	shr    %cl,%edx
+  80453e:	f6 c1 20             	test   $0x20,%cl
+  804541:	74 04                	je     804547 <udm+0x71>
+  804543:	89 d0                	mov    %edx,%eax
+  804545:	31 d2                	xor    %edx,%edx
+  804547:	83 e0 01             	and    $0x1,%eax
+  80454a:	89 04 24             	mov    %eax,(%esp)
+  80454d:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804554:	00 
+  804555:	8b 04 24             	mov    (%esp),%eax
+  804558:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80455c:	09 f0                	or     %esi,%eax
+  80455e:	09 fa                	or     %edi,%edx
+  804560:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804564:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804568:	39 f0                	cmp    %esi,%eax
+  80456a:	89 d3                	mov    %edx,%ebx
+  80456c:	19 fb                	sbb    %edi,%ebx
+  80456e:	72 af                	jb     80451f <udm+0x49>
+  804570:	29 f0                	sub    %esi,%eax
+  804572:	19 fa                	sbb    %edi,%edx
+  804574:	89 cf                	mov    %ecx,%edi
+  804576:	c1 ef 05             	shr    $0x5,%edi
+  804579:	83 e7 01             	and    $0x1,%edi
+  80457c:	89 fe                	mov    %edi,%esi
+  80457e:	83 f6 01             	xor    $0x1,%esi
+  804581:	d3 e6                	shl    %cl,%esi
+  804583:	d3 e7                	shl    %cl,%edi
+  804585:	09 74 24 18          	or     %esi,0x18(%esp)
+  804589:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80458d:	eb 90                	jmp    80451f <udm+0x49>
+  80458f:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804593:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804597:	89 f0                	mov    %esi,%eax
+  804599:	89 fa                	mov    %edi,%edx
+  80459b:	89 74 24 18          	mov    %esi,0x18(%esp)
+  80459f:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  8045a3:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  8045a7:	89 01                	mov    %eax,(%ecx)
+  8045a9:	89 51 04             	mov    %edx,0x4(%ecx)
+  8045ac:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8045b0:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8045b4:	83 c4 20             	add    $0x20,%esp
+  8045b7:	5b                   	pop    %ebx
+  8045b8:	5e                   	pop    %esi
+  8045b9:	5f                   	pop    %edi
+  8045ba:	c3                   	ret
+
+008045bb <__udivdi3>:
+  8045bb:	83 ec 18             	sub    $0x18,%esp
+  8045be:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8045c2:	50                   	push   %eax
+  8045c3:	ff 74 24 2c          	push   0x2c(%esp)
+  8045c7:	ff 74 24 2c          	push   0x2c(%esp)
+  8045cb:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8045cf:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8045d3:	e8 fe fe ff ff       	call   8044d6 <udm>
+  8045d8:	83 c4 24             	add    $0x24,%esp
+  8045db:	c3                   	ret
+
+008045dc <__umoddi3>:
+  8045dc:	83 ec 18             	sub    $0x18,%esp
+  8045df:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8045e3:	50                   	push   %eax
+  8045e4:	ff 74 24 2c          	push   0x2c(%esp)
+  8045e8:	ff 74 24 2c          	push   0x2c(%esp)
+  8045ec:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8045f0:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8045f4:	e8 dd fe ff ff       	call   8044d6 <udm>
+  8045f9:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8045fd:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804601:	83 c4 24             	add    $0x24,%esp
+  804604:	c3                   	ret
+
+00804605 <__divdi3>:
+  804605:	56                   	push   %esi
+  804606:	53                   	push   %ebx
+  804607:	83 ec 14             	sub    $0x14,%esp
+  80460a:	8b 44 24 20          	mov    0x20(%esp),%eax
+  80460e:	8b 54 24 24          	mov    0x24(%esp),%edx
+  804612:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  804616:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  80461a:	85 d2                	test   %edx,%edx
+  80461c:	78 18                	js     804636 <__divdi3+0x31>
+  80461e:	85 db                	test   %ebx,%ebx
+  804620:	78 3e                	js     804660 <__divdi3+0x5b>
+  804622:	83 ec 04             	sub    $0x4,%esp
+  804625:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804629:	56                   	push   %esi
+  80462a:	53                   	push   %ebx
+  80462b:	51                   	push   %ecx
+  80462c:	e8 a5 fe ff ff       	call   8044d6 <udm>
+  804631:	83 c4 10             	add    $0x10,%esp
+  804634:	eb 24                	jmp    80465a <__divdi3+0x55>
+  804636:	f7 d8                	neg    %eax
+  804638:	83 d2 00             	adc    $0x0,%edx
+  80463b:	f7 da                	neg    %edx
+  80463d:	85 db                	test   %ebx,%ebx
+  80463f:	78 3a                	js     80467b <__divdi3+0x76>
+  804641:	83 ec 04             	sub    $0x4,%esp
+  804644:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804648:	56                   	push   %esi
+  804649:	53                   	push   %ebx
+  80464a:	51                   	push   %ecx
+  80464b:	e8 86 fe ff ff       	call   8044d6 <udm>
+  804650:	83 c4 10             	add    $0x10,%esp
+  804653:	f7 d8                	neg    %eax
+  804655:	83 d2 00             	adc    $0x0,%edx
+  804658:	f7 da                	neg    %edx
+  80465a:	83 c4 14             	add    $0x14,%esp
+  80465d:	5b                   	pop    %ebx
+  80465e:	5e                   	pop    %esi
+  80465f:	c3                   	ret
+  804660:	83 ec 04             	sub    $0x4,%esp
+  804663:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804667:	56                   	push   %esi
+  804668:	f7 d9                	neg    %ecx
+  80466a:	83 d3 00             	adc    $0x0,%ebx
+  80466d:	f7 db                	neg    %ebx
+  80466f:	53                   	push   %ebx
+  804670:	51                   	push   %ecx
+  804671:	e8 60 fe ff ff       	call   8044d6 <udm>
+  804676:	83 c4 10             	add    $0x10,%esp
+  804679:	eb d8                	jmp    804653 <__divdi3+0x4e>
+  80467b:	83 ec 04             	sub    $0x4,%esp
+  80467e:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804682:	56                   	push   %esi
+  804683:	f7 d9                	neg    %ecx
+  804685:	83 d3 00             	adc    $0x0,%ebx
+  804688:	f7 db                	neg    %ebx
+  80468a:	53                   	push   %ebx
+  80468b:	51                   	push   %ecx
+  80468c:	e8 45 fe ff ff       	call   8044d6 <udm>
+  804691:	83 c4 10             	add    $0x10,%esp
+  804694:	eb c4                	jmp    80465a <__divdi3+0x55>
+
+00804696 <__moddi3>:
+  804696:	55                   	push   %ebp
+  804697:	57                   	push   %edi
+  804698:	56                   	push   %esi
+  804699:	53                   	push   %ebx
+  80469a:	83 ec 24             	sub    $0x24,%esp
+  80469d:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8046a1:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8046a5:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8046a9:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8046ad:	85 d2                	test   %edx,%edx
+  8046af:	78 3b                	js     8046ec <__moddi3+0x56>
+  8046b1:	83 ec 04             	sub    $0x4,%esp
+  8046b4:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8046b8:	56                   	push   %esi
+  8046b9:	89 ce                	mov    %ecx,%esi
+  8046bb:	f7 de                	neg    %esi
+  8046bd:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8046c1:	89 de                	mov    %ebx,%esi
+  8046c3:	83 d6 00             	adc    $0x0,%esi
+  8046c6:	f7 de                	neg    %esi
+  8046c8:	89 74 24 14          	mov    %esi,0x14(%esp)
+  8046cc:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8046d0:	0f 48 f1             	cmovs  %ecx,%esi
+  8046d3:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  8046d8:	53                   	push   %ebx
+  8046d9:	56                   	push   %esi
+  8046da:	e8 f7 fd ff ff       	call   8044d6 <udm>
+  8046df:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8046e3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8046e7:	83 c4 10             	add    $0x10,%esp
+  8046ea:	eb 47                	jmp    804733 <__moddi3+0x9d>
+  8046ec:	f7 d8                	neg    %eax
+  8046ee:	83 d2 00             	adc    $0x0,%edx
+  8046f1:	f7 da                	neg    %edx
+  8046f3:	83 ec 04             	sub    $0x4,%esp
+  8046f6:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8046fa:	56                   	push   %esi
+  8046fb:	89 cf                	mov    %ecx,%edi
+  8046fd:	f7 df                	neg    %edi
+  8046ff:	89 de                	mov    %ebx,%esi
+  804701:	83 d6 00             	adc    $0x0,%esi
+  804704:	f7 de                	neg    %esi
+  804706:	0f 49 cf             	cmovns %edi,%ecx
+  804709:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  80470d:	0f 49 de             	cmovns %esi,%ebx
+  804710:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  804714:	ff 74 24 0c          	push   0xc(%esp)
+  804718:	ff 74 24 0c          	push   0xc(%esp)
+  80471c:	e8 b5 fd ff ff       	call   8044d6 <udm>
+  804721:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804725:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804729:	f7 d8                	neg    %eax
+  80472b:	83 d2 00             	adc    $0x0,%edx
+  80472e:	f7 da                	neg    %edx
+  804730:	83 c4 10             	add    $0x10,%esp
+  804733:	83 c4 24             	add    $0x24,%esp
+  804736:	5b                   	pop    %ebx
+  804737:	5e                   	pop    %esi
+  804738:	5f                   	pop    %edi
+  804739:	5d                   	pop    %ebp
+  80473a:	c3                   	ret
@@ -0,0 +1,9810 @@
+
+obj/user/stresssched.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 16 01 00 00       	call   800147 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+volatile int counter;
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+	int i, j;
+	int seen;
+	envid_t parent = sys_getenvid();
+  800038:	e8 52 0c 00 00       	call   800c8f <sys_getenvid>
+  80003d:	89 c6                	mov    %eax,%esi
+
+	// Fork several environments
+	for (i = 0; i < 20; i++)
+  80003f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (fork() == 0)
+  800044:	e8 5a 13 00 00       	call   8013a3 <fork>
+  800049:	85 c0                	test   %eax,%eax
+  80004b:	74 12                	je     80005f <umain+0x2c>
+	for (i = 0; i < 20; i++)
+  80004d:	83 c3 01             	add    $0x1,%ebx
+  800050:	83 fb 14             	cmp    $0x14,%ebx
+  800053:	75 ef                	jne    800044 <umain+0x11>
+			break;
+	if (i == 20) {
+		sys_yield();
+  800055:	e8 61 0c 00 00       	call   800cbb <sys_yield>
+		return;
+  80005a:	e9 e1 00 00 00       	jmp    800140 <umain+0x10d>
+	}
+
+	// Wait for the parent to finish forking
+	while (envs[ENVX(parent)].env_status != ENV_FREE)
+  80005f:	89 f0                	mov    %esi,%eax
+  800061:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800066:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  800069:	c1 e2 04             	shl    $0x4,%edx
+  80006c:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800072:	eb 02                	jmp    800076 <umain+0x43>
+		asm volatile("pause");
+  800074:	f3 90                	pause
+	while (envs[ENVX(parent)].env_status != ENV_FREE)
+  800076:	8b 42 54             	mov    0x54(%edx),%eax
+  800079:	85 c0                	test   %eax,%eax
+  80007b:	75 f7                	jne    800074 <umain+0x41>
+  80007d:	bb 0b 00 00 00       	mov    $0xb,%ebx
+  800082:	eb 12                	jmp    800096 <umain+0x63>
+
+	// Check that one environment doesn't run on two CPUs at once
+	for (i = 0; i < 10; i++) {
+		sys_yield();
+		for (j = 0; j < 10000; j++)
+			counter++;
+  800084:	a1 c0 62 80 00       	mov    0x8062c0,%eax
+  800089:	83 c0 01             	add    $0x1,%eax
+  80008c:	a3 c0 62 80 00       	mov    %eax,0x8062c0
+		for (j = 0; j < 10000; j++)
+  800091:	83 ea 01             	sub    $0x1,%edx
+  800094:	75 ee                	jne    800084 <umain+0x51>
+	for (i = 0; i < 10; i++) {
+  800096:	83 eb 01             	sub    $0x1,%ebx
+  800099:	74 0c                	je     8000a7 <umain+0x74>
+		sys_yield();
+  80009b:	e8 1b 0c 00 00       	call   800cbb <sys_yield>
+		for (j = 0; j < 10000; j++)
+  8000a0:	ba 11 27 00 00       	mov    $0x2711,%edx
+  8000a5:	eb ea                	jmp    800091 <umain+0x5e>
+	}
+
+	if (counter != 10*10000)
+  8000a7:	a1 c0 62 80 00       	mov    0x8062c0,%eax
+  8000ac:	3d a0 86 01 00       	cmp    $0x186a0,%eax
+  8000b1:	75 27                	jne    8000da <umain+0xa7>
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  8000b3:	89 e2                	mov    %esp,%edx
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8000b5:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8000bb:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8000c0:	77 2f                	ja     8000f1 <umain+0xbe>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8000c2:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8000c7:	29 d0                	sub    %edx,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  8000c9:	c1 e8 10             	shr    $0x10,%eax
+  8000cc:	74 23                	je     8000f1 <umain+0xbe>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8000ce:	c1 e0 10             	shl    $0x10,%eax
+  8000d1:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8000d6:	29 c2                	sub    %eax,%edx
+  8000d8:	eb 1d                	jmp    8000f7 <umain+0xc4>
+		panic("ran on two CPUs at once (counter is %d)", counter);
+  8000da:	a1 c0 62 80 00       	mov    0x8062c0,%eax
+  8000df:	50                   	push   %eax
+  8000e0:	68 e0 47 80 00       	push   $0x8047e0
+  8000e5:	6a 21                	push   $0x21
+  8000e7:	68 08 48 80 00       	push   $0x804808
+  8000ec:	e8 f9 00 00 00       	call   8001ea <_panic>
+		return pthread_main_tls;
+  8000f1:	8b 15 c4 62 80 00    	mov    0x8062c4,%edx
+
+	// Check that we see environments running on different CPUs
+	cprintf("[%08x] stresssched on CPU %d\n", thisenv->env_id, thisenv->env_cpunum);
+  8000f7:	8b 02                	mov    (%edx),%eax
+  8000f9:	8b 48 5c             	mov    0x5c(%eax),%ecx
+  8000fc:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8000fe:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  800104:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800109:	77 18                	ja     800123 <umain+0xf0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80010b:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800110:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  800112:	c1 e8 10             	shr    $0x10,%eax
+  800115:	74 0c                	je     800123 <umain+0xf0>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800117:	c1 e0 10             	shl    $0x10,%eax
+  80011a:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80011f:	29 c2                	sub    %eax,%edx
+  800121:	eb 06                	jmp    800129 <umain+0xf6>
+		return pthread_main_tls;
+  800123:	8b 15 c4 62 80 00    	mov    0x8062c4,%edx
+  800129:	8b 02                	mov    (%edx),%eax
+  80012b:	8b 40 48             	mov    0x48(%eax),%eax
+  80012e:	83 ec 04             	sub    $0x4,%esp
+  800131:	51                   	push   %ecx
+  800132:	50                   	push   %eax
+  800133:	68 1b 48 80 00       	push   $0x80481b
+  800138:	e8 88 01 00 00       	call   8002c5 <cprintf>
+  80013d:	83 c4 10             	add    $0x10,%esp
+
+}
+  800140:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800143:	5b                   	pop    %ebx
+  800144:	5e                   	pop    %esi
+  800145:	5d                   	pop    %ebp
+  800146:	c3                   	ret
+
+00800147 <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800147:	55                   	push   %ebp
+  800148:	89 e5                	mov    %esp,%ebp
+  80014a:	57                   	push   %edi
+  80014b:	56                   	push   %esi
+  80014c:	53                   	push   %ebx
+  80014d:	83 ec 1c             	sub    $0x1c,%esp
+  800150:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800153:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  800156:	e8 34 0b 00 00       	call   800c8f <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  80015b:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  80015e:	89 15 c4 62 80 00    	mov    %edx,0x8062c4
+	thisenv = &envs[ENVX(eid)];
+  800164:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800169:	89 c1                	mov    %eax,%ecx
+  80016b:	89 e7                	mov    %esp,%edi
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80016d:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  800173:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800178:	77 16                	ja     800190 <libmain+0x49>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80017a:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80017f:	29 f8                	sub    %edi,%eax
+	if (t == 0)
+  800181:	c1 e8 10             	shr    $0x10,%eax
+  800184:	74 0a                	je     800190 <libmain+0x49>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800186:	c1 e0 10             	shl    $0x10,%eax
+  800189:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80018e:	29 c2                	sub    %eax,%edx
+  800190:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  800193:	c1 e0 04             	shl    $0x4,%eax
+  800196:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80019b:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80019d:	85 db                	test   %ebx,%ebx
+  80019f:	7e 07                	jle    8001a8 <libmain+0x61>
+		binaryname = argv[0];
+  8001a1:	8b 06                	mov    (%esi),%eax
+  8001a3:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  8001a8:	83 ec 08             	sub    $0x8,%esp
+  8001ab:	56                   	push   %esi
+  8001ac:	53                   	push   %ebx
+  8001ad:	e8 81 fe ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8001b2:	e8 0b 00 00 00       	call   8001c2 <exit>
+}
+  8001b7:	83 c4 10             	add    $0x10,%esp
+  8001ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001bd:	5b                   	pop    %ebx
+  8001be:	5e                   	pop    %esi
+  8001bf:	5f                   	pop    %edi
+  8001c0:	5d                   	pop    %ebp
+  8001c1:	c3                   	ret
+
+008001c2 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8001c2:	55                   	push   %ebp
+  8001c3:	89 e5                	mov    %esp,%ebp
+  8001c5:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  8001c8:	6a 00                	push   $0x0
+  8001ca:	e8 8b 27 00 00       	call   80295a <fflush>
+	pthread_kill_others();
+  8001cf:	e8 f6 3d 00 00       	call   803fca <pthread_kill_others>
+	close_all();
+  8001d4:	e8 24 18 00 00       	call   8019fd <close_all>
+	sys_env_destroy(0);
+  8001d9:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8001e0:	e8 5f 0a 00 00       	call   800c44 <sys_env_destroy>
+}
+  8001e5:	83 c4 10             	add    $0x10,%esp
+  8001e8:	c9                   	leave
+  8001e9:	c3                   	ret
+
+008001ea <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8001ea:	55                   	push   %ebp
+  8001eb:	89 e5                	mov    %esp,%ebp
+  8001ed:	56                   	push   %esi
+  8001ee:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8001ef:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8001f2:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  8001f8:	e8 92 0a 00 00       	call   800c8f <sys_getenvid>
+  8001fd:	83 ec 0c             	sub    $0xc,%esp
+  800200:	ff 75 0c             	push   0xc(%ebp)
+  800203:	ff 75 08             	push   0x8(%ebp)
+  800206:	56                   	push   %esi
+  800207:	50                   	push   %eax
+  800208:	68 44 48 80 00       	push   $0x804844
+  80020d:	e8 b3 00 00 00       	call   8002c5 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800212:	83 c4 18             	add    $0x18,%esp
+  800215:	53                   	push   %ebx
+  800216:	ff 75 10             	push   0x10(%ebp)
+  800219:	e8 56 00 00 00       	call   800274 <vcprintf>
+	cprintf("\n");
+  80021e:	c7 04 24 3a 4d 80 00 	movl   $0x804d3a,(%esp)
+  800225:	e8 9b 00 00 00       	call   8002c5 <cprintf>
+  80022a:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80022d:	cc                   	int3
+	while (1)
+  80022e:	eb fd                	jmp    80022d <_panic+0x43>
+
+00800230 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800230:	55                   	push   %ebp
+  800231:	89 e5                	mov    %esp,%ebp
+  800233:	53                   	push   %ebx
+  800234:	83 ec 04             	sub    $0x4,%esp
+  800237:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80023a:	8b 13                	mov    (%ebx),%edx
+  80023c:	8d 42 01             	lea    0x1(%edx),%eax
+  80023f:	89 03                	mov    %eax,(%ebx)
+  800241:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800244:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800248:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80024d:	74 09                	je     800258 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80024f:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800253:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800256:	c9                   	leave
+  800257:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800258:	83 ec 08             	sub    $0x8,%esp
+  80025b:	68 ff 00 00 00       	push   $0xff
+  800260:	8d 43 08             	lea    0x8(%ebx),%eax
+  800263:	50                   	push   %eax
+  800264:	e8 84 09 00 00       	call   800bed <sys_cputs>
+		b->idx = 0;
+  800269:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80026f:	83 c4 10             	add    $0x10,%esp
+  800272:	eb db                	jmp    80024f <putch+0x1f>
+
+00800274 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800274:	55                   	push   %ebp
+  800275:	89 e5                	mov    %esp,%ebp
+  800277:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80027d:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800284:	00 00 00 
+	b.cnt = 0;
+  800287:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80028e:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800291:	ff 75 0c             	push   0xc(%ebp)
+  800294:	ff 75 08             	push   0x8(%ebp)
+  800297:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80029d:	50                   	push   %eax
+  80029e:	68 30 02 80 00       	push   $0x800230
+  8002a3:	e8 14 01 00 00       	call   8003bc <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8002a8:	83 c4 08             	add    $0x8,%esp
+  8002ab:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002b1:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8002b7:	50                   	push   %eax
+  8002b8:	e8 30 09 00 00       	call   800bed <sys_cputs>
+
+	return b.cnt;
+}
+  8002bd:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8002c3:	c9                   	leave
+  8002c4:	c3                   	ret
+
+008002c5 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8002c5:	55                   	push   %ebp
+  8002c6:	89 e5                	mov    %esp,%ebp
+  8002c8:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8002cb:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8002ce:	50                   	push   %eax
+  8002cf:	ff 75 08             	push   0x8(%ebp)
+  8002d2:	e8 9d ff ff ff       	call   800274 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8002d7:	c9                   	leave
+  8002d8:	c3                   	ret
+
+008002d9 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8002d9:	55                   	push   %ebp
+  8002da:	89 e5                	mov    %esp,%ebp
+  8002dc:	57                   	push   %edi
+  8002dd:	56                   	push   %esi
+  8002de:	53                   	push   %ebx
+  8002df:	83 ec 1c             	sub    $0x1c,%esp
+  8002e2:	89 c7                	mov    %eax,%edi
+  8002e4:	89 d6                	mov    %edx,%esi
+  8002e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002e9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8002ec:	89 d1                	mov    %edx,%ecx
+  8002ee:	89 c2                	mov    %eax,%edx
+  8002f0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8002f3:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8002f6:	8b 45 10             	mov    0x10(%ebp),%eax
+  8002f9:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8002fc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8002ff:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800306:	39 c2                	cmp    %eax,%edx
+  800308:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80030b:	72 3e                	jb     80034b <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80030d:	83 ec 0c             	sub    $0xc,%esp
+  800310:	ff 75 18             	push   0x18(%ebp)
+  800313:	83 eb 01             	sub    $0x1,%ebx
+  800316:	53                   	push   %ebx
+  800317:	50                   	push   %eax
+  800318:	83 ec 08             	sub    $0x8,%esp
+  80031b:	ff 75 e4             	push   -0x1c(%ebp)
+  80031e:	ff 75 e0             	push   -0x20(%ebp)
+  800321:	ff 75 dc             	push   -0x24(%ebp)
+  800324:	ff 75 d8             	push   -0x28(%ebp)
+  800327:	e8 21 43 00 00       	call   80464d <__udivdi3>
+  80032c:	83 c4 18             	add    $0x18,%esp
+  80032f:	52                   	push   %edx
+  800330:	50                   	push   %eax
+  800331:	89 f2                	mov    %esi,%edx
+  800333:	89 f8                	mov    %edi,%eax
+  800335:	e8 9f ff ff ff       	call   8002d9 <printnum>
+  80033a:	83 c4 20             	add    $0x20,%esp
+  80033d:	eb 13                	jmp    800352 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80033f:	83 ec 08             	sub    $0x8,%esp
+  800342:	56                   	push   %esi
+  800343:	ff 75 18             	push   0x18(%ebp)
+  800346:	ff d7                	call   *%edi
+  800348:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80034b:	83 eb 01             	sub    $0x1,%ebx
+  80034e:	85 db                	test   %ebx,%ebx
+  800350:	7f ed                	jg     80033f <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800352:	83 ec 08             	sub    $0x8,%esp
+  800355:	56                   	push   %esi
+  800356:	83 ec 04             	sub    $0x4,%esp
+  800359:	ff 75 e4             	push   -0x1c(%ebp)
+  80035c:	ff 75 e0             	push   -0x20(%ebp)
+  80035f:	ff 75 dc             	push   -0x24(%ebp)
+  800362:	ff 75 d8             	push   -0x28(%ebp)
+  800365:	e8 04 43 00 00       	call   80466e <__umoddi3>
+  80036a:	83 c4 14             	add    $0x14,%esp
+  80036d:	0f be 80 67 48 80 00 	movsbl 0x804867(%eax),%eax
+  800374:	50                   	push   %eax
+  800375:	ff d7                	call   *%edi
+}
+  800377:	83 c4 10             	add    $0x10,%esp
+  80037a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80037d:	5b                   	pop    %ebx
+  80037e:	5e                   	pop    %esi
+  80037f:	5f                   	pop    %edi
+  800380:	5d                   	pop    %ebp
+  800381:	c3                   	ret
+
+00800382 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800382:	55                   	push   %ebp
+  800383:	89 e5                	mov    %esp,%ebp
+  800385:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800388:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80038c:	8b 10                	mov    (%eax),%edx
+  80038e:	3b 50 04             	cmp    0x4(%eax),%edx
+  800391:	73 0a                	jae    80039d <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800393:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800396:	89 08                	mov    %ecx,(%eax)
+  800398:	8b 45 08             	mov    0x8(%ebp),%eax
+  80039b:	88 02                	mov    %al,(%edx)
+}
+  80039d:	5d                   	pop    %ebp
+  80039e:	c3                   	ret
+
+0080039f <printfmt>:
+{
+  80039f:	55                   	push   %ebp
+  8003a0:	89 e5                	mov    %esp,%ebp
+  8003a2:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8003a5:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8003a8:	50                   	push   %eax
+  8003a9:	ff 75 10             	push   0x10(%ebp)
+  8003ac:	ff 75 0c             	push   0xc(%ebp)
+  8003af:	ff 75 08             	push   0x8(%ebp)
+  8003b2:	e8 05 00 00 00       	call   8003bc <vprintfmt>
+}
+  8003b7:	83 c4 10             	add    $0x10,%esp
+  8003ba:	c9                   	leave
+  8003bb:	c3                   	ret
+
+008003bc <vprintfmt>:
+{
+  8003bc:	55                   	push   %ebp
+  8003bd:	89 e5                	mov    %esp,%ebp
+  8003bf:	57                   	push   %edi
+  8003c0:	56                   	push   %esi
+  8003c1:	53                   	push   %ebx
+  8003c2:	83 ec 2c             	sub    $0x2c,%esp
+  8003c5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8003c8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8003cb:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8003ce:	eb 0a                	jmp    8003da <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8003d0:	83 ec 08             	sub    $0x8,%esp
+  8003d3:	53                   	push   %ebx
+  8003d4:	50                   	push   %eax
+  8003d5:	ff d6                	call   *%esi
+  8003d7:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  8003da:	83 c7 01             	add    $0x1,%edi
+  8003dd:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  8003e1:	83 f8 25             	cmp    $0x25,%eax
+  8003e4:	74 0c                	je     8003f2 <vprintfmt+0x36>
+			if (ch == '\0')
+  8003e6:	85 c0                	test   %eax,%eax
+  8003e8:	75 e6                	jne    8003d0 <vprintfmt+0x14>
+}
+  8003ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003ed:	5b                   	pop    %ebx
+  8003ee:	5e                   	pop    %esi
+  8003ef:	5f                   	pop    %edi
+  8003f0:	5d                   	pop    %ebp
+  8003f1:	c3                   	ret
+		padc = ' ';
+  8003f2:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8003f6:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8003fd:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800404:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80040b:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  800410:	8d 47 01             	lea    0x1(%edi),%eax
+  800413:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800416:	0f b6 17             	movzbl (%edi),%edx
+  800419:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80041c:	3c 55                	cmp    $0x55,%al
+  80041e:	0f 87 c5 03 00 00    	ja     8007e9 <vprintfmt+0x42d>
+  800424:	0f b6 c0             	movzbl %al,%eax
+  800427:	ff 24 85 e0 49 80 00 	jmp    *0x8049e0(,%eax,4)
+  80042e:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  800431:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800434:	eb da                	jmp    800410 <vprintfmt+0x54>
+  800436:	0f be d2             	movsbl %dl,%edx
+  800439:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80043c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800441:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800444:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800447:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80044b:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80044e:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800451:	83 f9 09             	cmp    $0x9,%ecx
+  800454:	77 55                	ja     8004ab <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  800456:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800459:	eb e9                	jmp    800444 <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  80045b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80045e:	8b 00                	mov    (%eax),%eax
+  800460:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800463:	8b 45 14             	mov    0x14(%ebp),%eax
+  800466:	8d 40 04             	lea    0x4(%eax),%eax
+  800469:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  80046c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80046f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800473:	79 9b                	jns    800410 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800475:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800478:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80047b:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800482:	eb 8c                	jmp    800410 <vprintfmt+0x54>
+			if (width < 0)
+  800484:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800487:	85 d2                	test   %edx,%edx
+  800489:	b8 00 00 00 00       	mov    $0x0,%eax
+  80048e:	0f 49 c2             	cmovns %edx,%eax
+  800491:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  800494:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800497:	e9 74 ff ff ff       	jmp    800410 <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  80049c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80049f:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8004a6:	e9 65 ff ff ff       	jmp    800410 <vprintfmt+0x54>
+  8004ab:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004ae:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004b1:	eb bc                	jmp    80046f <vprintfmt+0xb3>
+			lflag++;
+  8004b3:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  8004b6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8004b9:	e9 52 ff ff ff       	jmp    800410 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8004be:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004c1:	8d 78 04             	lea    0x4(%eax),%edi
+  8004c4:	83 ec 08             	sub    $0x8,%esp
+  8004c7:	53                   	push   %ebx
+  8004c8:	ff 30                	push   (%eax)
+  8004ca:	ff d6                	call   *%esi
+			break;
+  8004cc:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8004cf:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8004d2:	e9 b1 02 00 00       	jmp    800788 <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  8004d7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004da:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8004dd:	8b 10                	mov    (%eax),%edx
+  8004df:	89 d0                	mov    %edx,%eax
+  8004e1:	f7 d8                	neg    %eax
+  8004e3:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8004e6:	83 f8 14             	cmp    $0x14,%eax
+  8004e9:	7f 23                	jg     80050e <vprintfmt+0x152>
+  8004eb:	8b 14 85 40 4b 80 00 	mov    0x804b40(,%eax,4),%edx
+  8004f2:	85 d2                	test   %edx,%edx
+  8004f4:	74 18                	je     80050e <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  8004f6:	52                   	push   %edx
+  8004f7:	68 83 4d 80 00       	push   $0x804d83
+  8004fc:	53                   	push   %ebx
+  8004fd:	56                   	push   %esi
+  8004fe:	e8 9c fe ff ff       	call   80039f <printfmt>
+  800503:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800506:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800509:	e9 7a 02 00 00       	jmp    800788 <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  80050e:	50                   	push   %eax
+  80050f:	68 7f 48 80 00       	push   $0x80487f
+  800514:	53                   	push   %ebx
+  800515:	56                   	push   %esi
+  800516:	e8 84 fe ff ff       	call   80039f <printfmt>
+  80051b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80051e:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800521:	e9 62 02 00 00       	jmp    800788 <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800526:	8b 45 14             	mov    0x14(%ebp),%eax
+  800529:	83 c0 04             	add    $0x4,%eax
+  80052c:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80052f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800532:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800534:	85 c9                	test   %ecx,%ecx
+  800536:	b8 78 48 80 00       	mov    $0x804878,%eax
+  80053b:	0f 45 c1             	cmovne %ecx,%eax
+  80053e:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800541:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800545:	7e 06                	jle    80054d <vprintfmt+0x191>
+  800547:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80054b:	75 0b                	jne    800558 <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80054d:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800550:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800553:	89 75 08             	mov    %esi,0x8(%ebp)
+  800556:	eb 5c                	jmp    8005b4 <vprintfmt+0x1f8>
+  800558:	83 ec 08             	sub    $0x8,%esp
+  80055b:	ff 75 d0             	push   -0x30(%ebp)
+  80055e:	ff 75 cc             	push   -0x34(%ebp)
+  800561:	e8 20 03 00 00       	call   800886 <strnlen>
+  800566:	89 c2                	mov    %eax,%edx
+  800568:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80056b:	29 d0                	sub    %edx,%eax
+  80056d:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800570:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800574:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800577:	89 75 08             	mov    %esi,0x8(%ebp)
+  80057a:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80057c:	eb 0e                	jmp    80058c <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  80057e:	83 ec 08             	sub    $0x8,%esp
+  800581:	53                   	push   %ebx
+  800582:	57                   	push   %edi
+  800583:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800586:	83 ee 01             	sub    $0x1,%esi
+  800589:	83 c4 10             	add    $0x10,%esp
+  80058c:	85 f6                	test   %esi,%esi
+  80058e:	7f ee                	jg     80057e <vprintfmt+0x1c2>
+  800590:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800593:	8b 75 08             	mov    0x8(%ebp),%esi
+  800596:	85 c0                	test   %eax,%eax
+  800598:	ba 00 00 00 00       	mov    $0x0,%edx
+  80059d:	0f 49 d0             	cmovns %eax,%edx
+  8005a0:	29 d0                	sub    %edx,%eax
+  8005a2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005a5:	eb a6                	jmp    80054d <vprintfmt+0x191>
+					putch(ch, putdat);
+  8005a7:	83 ec 08             	sub    $0x8,%esp
+  8005aa:	53                   	push   %ebx
+  8005ab:	52                   	push   %edx
+  8005ac:	ff 55 08             	call   *0x8(%ebp)
+  8005af:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005b2:	89 f1                	mov    %esi,%ecx
+  8005b4:	8d 71 01             	lea    0x1(%ecx),%esi
+  8005b7:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8005bb:	0f be d0             	movsbl %al,%edx
+  8005be:	85 d2                	test   %edx,%edx
+  8005c0:	74 28                	je     8005ea <vprintfmt+0x22e>
+  8005c2:	85 ff                	test   %edi,%edi
+  8005c4:	78 05                	js     8005cb <vprintfmt+0x20f>
+  8005c6:	83 ef 01             	sub    $0x1,%edi
+  8005c9:	78 30                	js     8005fb <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8005cb:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8005cf:	74 d6                	je     8005a7 <vprintfmt+0x1eb>
+  8005d1:	0f be c0             	movsbl %al,%eax
+  8005d4:	83 e8 20             	sub    $0x20,%eax
+  8005d7:	83 f8 5e             	cmp    $0x5e,%eax
+  8005da:	76 cb                	jbe    8005a7 <vprintfmt+0x1eb>
+					putch('?', putdat);
+  8005dc:	83 ec 08             	sub    $0x8,%esp
+  8005df:	53                   	push   %ebx
+  8005e0:	6a 3f                	push   $0x3f
+  8005e2:	ff 55 08             	call   *0x8(%ebp)
+  8005e5:	83 c4 10             	add    $0x10,%esp
+  8005e8:	eb c8                	jmp    8005b2 <vprintfmt+0x1f6>
+  8005ea:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005ed:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005f0:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005f3:	01 d0                	add    %edx,%eax
+  8005f5:	29 c8                	sub    %ecx,%eax
+  8005f7:	89 c7                	mov    %eax,%edi
+  8005f9:	eb 13                	jmp    80060e <vprintfmt+0x252>
+  8005fb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005fe:	eb ed                	jmp    8005ed <vprintfmt+0x231>
+				putch(' ', putdat);
+  800600:	83 ec 08             	sub    $0x8,%esp
+  800603:	53                   	push   %ebx
+  800604:	6a 20                	push   $0x20
+  800606:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800608:	83 ef 01             	sub    $0x1,%edi
+  80060b:	83 c4 10             	add    $0x10,%esp
+  80060e:	85 ff                	test   %edi,%edi
+  800610:	7f ee                	jg     800600 <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800612:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800615:	89 45 14             	mov    %eax,0x14(%ebp)
+  800618:	e9 6b 01 00 00       	jmp    800788 <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  80061d:	83 f9 01             	cmp    $0x1,%ecx
+  800620:	7f 1f                	jg     800641 <vprintfmt+0x285>
+	else if (lflag)
+  800622:	85 c9                	test   %ecx,%ecx
+  800624:	74 67                	je     80068d <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  800626:	8b 45 14             	mov    0x14(%ebp),%eax
+  800629:	8b 00                	mov    (%eax),%eax
+  80062b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80062e:	89 c1                	mov    %eax,%ecx
+  800630:	c1 f9 1f             	sar    $0x1f,%ecx
+  800633:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800636:	8b 45 14             	mov    0x14(%ebp),%eax
+  800639:	8d 40 04             	lea    0x4(%eax),%eax
+  80063c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80063f:	eb 17                	jmp    800658 <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  800641:	8b 45 14             	mov    0x14(%ebp),%eax
+  800644:	8b 50 04             	mov    0x4(%eax),%edx
+  800647:	8b 00                	mov    (%eax),%eax
+  800649:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80064c:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80064f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800652:	8d 40 08             	lea    0x8(%eax),%eax
+  800655:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800658:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80065b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80065e:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800663:	85 c9                	test   %ecx,%ecx
+  800665:	0f 89 03 01 00 00    	jns    80076e <vprintfmt+0x3b2>
+				putch('-', putdat);
+  80066b:	83 ec 08             	sub    $0x8,%esp
+  80066e:	53                   	push   %ebx
+  80066f:	6a 2d                	push   $0x2d
+  800671:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800673:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800676:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800679:	f7 da                	neg    %edx
+  80067b:	83 d1 00             	adc    $0x0,%ecx
+  80067e:	f7 d9                	neg    %ecx
+  800680:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800683:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800688:	e9 e1 00 00 00       	jmp    80076e <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  80068d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800690:	8b 00                	mov    (%eax),%eax
+  800692:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800695:	89 c1                	mov    %eax,%ecx
+  800697:	c1 f9 1f             	sar    $0x1f,%ecx
+  80069a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80069d:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a0:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006a6:	eb b0                	jmp    800658 <vprintfmt+0x29c>
+	if (lflag >= 2)
+  8006a8:	83 f9 01             	cmp    $0x1,%ecx
+  8006ab:	7f 1e                	jg     8006cb <vprintfmt+0x30f>
+	else if (lflag)
+  8006ad:	85 c9                	test   %ecx,%ecx
+  8006af:	74 32                	je     8006e3 <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  8006b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b4:	8b 10                	mov    (%eax),%edx
+  8006b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006bb:	8d 40 04             	lea    0x4(%eax),%eax
+  8006be:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006c1:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8006c6:	e9 a3 00 00 00       	jmp    80076e <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8006cb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ce:	8b 10                	mov    (%eax),%edx
+  8006d0:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006d3:	8d 40 08             	lea    0x8(%eax),%eax
+  8006d6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006d9:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8006de:	e9 8b 00 00 00       	jmp    80076e <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8006e3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e6:	8b 10                	mov    (%eax),%edx
+  8006e8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006ed:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006f3:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8006f8:	eb 74                	jmp    80076e <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  8006fa:	83 f9 01             	cmp    $0x1,%ecx
+  8006fd:	7f 1b                	jg     80071a <vprintfmt+0x35e>
+	else if (lflag)
+  8006ff:	85 c9                	test   %ecx,%ecx
+  800701:	74 2c                	je     80072f <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  800703:	8b 45 14             	mov    0x14(%ebp),%eax
+  800706:	8b 10                	mov    (%eax),%edx
+  800708:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80070d:	8d 40 04             	lea    0x4(%eax),%eax
+  800710:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800713:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800718:	eb 54                	jmp    80076e <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  80071a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071d:	8b 10                	mov    (%eax),%edx
+  80071f:	8b 48 04             	mov    0x4(%eax),%ecx
+  800722:	8d 40 08             	lea    0x8(%eax),%eax
+  800725:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800728:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  80072d:	eb 3f                	jmp    80076e <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  80072f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800732:	8b 10                	mov    (%eax),%edx
+  800734:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800739:	8d 40 04             	lea    0x4(%eax),%eax
+  80073c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80073f:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800744:	eb 28                	jmp    80076e <vprintfmt+0x3b2>
+			putch('0', putdat);
+  800746:	83 ec 08             	sub    $0x8,%esp
+  800749:	53                   	push   %ebx
+  80074a:	6a 30                	push   $0x30
+  80074c:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80074e:	83 c4 08             	add    $0x8,%esp
+  800751:	53                   	push   %ebx
+  800752:	6a 78                	push   $0x78
+  800754:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800756:	8b 45 14             	mov    0x14(%ebp),%eax
+  800759:	8b 10                	mov    (%eax),%edx
+  80075b:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800760:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800763:	8d 40 04             	lea    0x4(%eax),%eax
+  800766:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800769:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80076e:	83 ec 0c             	sub    $0xc,%esp
+  800771:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800775:	50                   	push   %eax
+  800776:	ff 75 e0             	push   -0x20(%ebp)
+  800779:	57                   	push   %edi
+  80077a:	51                   	push   %ecx
+  80077b:	52                   	push   %edx
+  80077c:	89 da                	mov    %ebx,%edx
+  80077e:	89 f0                	mov    %esi,%eax
+  800780:	e8 54 fb ff ff       	call   8002d9 <printnum>
+			break;
+  800785:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800788:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  80078b:	e9 4a fc ff ff       	jmp    8003da <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800790:	83 f9 01             	cmp    $0x1,%ecx
+  800793:	7f 1b                	jg     8007b0 <vprintfmt+0x3f4>
+	else if (lflag)
+  800795:	85 c9                	test   %ecx,%ecx
+  800797:	74 2c                	je     8007c5 <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  800799:	8b 45 14             	mov    0x14(%ebp),%eax
+  80079c:	8b 10                	mov    (%eax),%edx
+  80079e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007a3:	8d 40 04             	lea    0x4(%eax),%eax
+  8007a6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007a9:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8007ae:	eb be                	jmp    80076e <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8007b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b3:	8b 10                	mov    (%eax),%edx
+  8007b5:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007b8:	8d 40 08             	lea    0x8(%eax),%eax
+  8007bb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007be:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8007c3:	eb a9                	jmp    80076e <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8007c5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c8:	8b 10                	mov    (%eax),%edx
+  8007ca:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007cf:	8d 40 04             	lea    0x4(%eax),%eax
+  8007d2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007d5:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8007da:	eb 92                	jmp    80076e <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  8007dc:	83 ec 08             	sub    $0x8,%esp
+  8007df:	53                   	push   %ebx
+  8007e0:	6a 25                	push   $0x25
+  8007e2:	ff d6                	call   *%esi
+			break;
+  8007e4:	83 c4 10             	add    $0x10,%esp
+  8007e7:	eb 9f                	jmp    800788 <vprintfmt+0x3cc>
+			putch('%', putdat);
+  8007e9:	83 ec 08             	sub    $0x8,%esp
+  8007ec:	53                   	push   %ebx
+  8007ed:	6a 25                	push   $0x25
+  8007ef:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8007f1:	83 c4 10             	add    $0x10,%esp
+  8007f4:	89 f8                	mov    %edi,%eax
+  8007f6:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8007fa:	74 05                	je     800801 <vprintfmt+0x445>
+  8007fc:	83 e8 01             	sub    $0x1,%eax
+  8007ff:	eb f5                	jmp    8007f6 <vprintfmt+0x43a>
+  800801:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800804:	eb 82                	jmp    800788 <vprintfmt+0x3cc>
+
+00800806 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800806:	55                   	push   %ebp
+  800807:	89 e5                	mov    %esp,%ebp
+  800809:	83 ec 18             	sub    $0x18,%esp
+  80080c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80080f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800812:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800815:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800819:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80081c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800823:	85 c0                	test   %eax,%eax
+  800825:	74 26                	je     80084d <vsnprintf+0x47>
+  800827:	85 d2                	test   %edx,%edx
+  800829:	7e 22                	jle    80084d <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80082b:	ff 75 14             	push   0x14(%ebp)
+  80082e:	ff 75 10             	push   0x10(%ebp)
+  800831:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800834:	50                   	push   %eax
+  800835:	68 82 03 80 00       	push   $0x800382
+  80083a:	e8 7d fb ff ff       	call   8003bc <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80083f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800842:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800845:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800848:	83 c4 10             	add    $0x10,%esp
+}
+  80084b:	c9                   	leave
+  80084c:	c3                   	ret
+		return -E_INVAL;
+  80084d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800852:	eb f7                	jmp    80084b <vsnprintf+0x45>
+
+00800854 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800854:	55                   	push   %ebp
+  800855:	89 e5                	mov    %esp,%ebp
+  800857:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80085a:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80085d:	50                   	push   %eax
+  80085e:	ff 75 10             	push   0x10(%ebp)
+  800861:	ff 75 0c             	push   0xc(%ebp)
+  800864:	ff 75 08             	push   0x8(%ebp)
+  800867:	e8 9a ff ff ff       	call   800806 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80086c:	c9                   	leave
+  80086d:	c3                   	ret
+
+0080086e <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80086e:	55                   	push   %ebp
+  80086f:	89 e5                	mov    %esp,%ebp
+  800871:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800874:	b8 00 00 00 00       	mov    $0x0,%eax
+  800879:	eb 03                	jmp    80087e <strlen+0x10>
+		n++;
+  80087b:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80087e:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800882:	75 f7                	jne    80087b <strlen+0xd>
+	return n;
+}
+  800884:	5d                   	pop    %ebp
+  800885:	c3                   	ret
+
+00800886 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800886:	55                   	push   %ebp
+  800887:	89 e5                	mov    %esp,%ebp
+  800889:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80088c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80088f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800894:	eb 03                	jmp    800899 <strnlen+0x13>
+		n++;
+  800896:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800899:	39 d0                	cmp    %edx,%eax
+  80089b:	74 08                	je     8008a5 <strnlen+0x1f>
+  80089d:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008a1:	75 f3                	jne    800896 <strnlen+0x10>
+  8008a3:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8008a5:	89 d0                	mov    %edx,%eax
+  8008a7:	5d                   	pop    %ebp
+  8008a8:	c3                   	ret
+
+008008a9 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8008a9:	55                   	push   %ebp
+  8008aa:	89 e5                	mov    %esp,%ebp
+  8008ac:	53                   	push   %ebx
+  8008ad:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008b0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8008b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b8:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8008bc:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8008bf:	83 c0 01             	add    $0x1,%eax
+  8008c2:	84 d2                	test   %dl,%dl
+  8008c4:	75 f2                	jne    8008b8 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8008c6:	89 c8                	mov    %ecx,%eax
+  8008c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008cb:	c9                   	leave
+  8008cc:	c3                   	ret
+
+008008cd <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8008cd:	55                   	push   %ebp
+  8008ce:	89 e5                	mov    %esp,%ebp
+  8008d0:	53                   	push   %ebx
+  8008d1:	83 ec 10             	sub    $0x10,%esp
+  8008d4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8008d7:	53                   	push   %ebx
+  8008d8:	e8 91 ff ff ff       	call   80086e <strlen>
+  8008dd:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8008e0:	ff 75 0c             	push   0xc(%ebp)
+  8008e3:	01 d8                	add    %ebx,%eax
+  8008e5:	50                   	push   %eax
+  8008e6:	e8 be ff ff ff       	call   8008a9 <strcpy>
+	return dst;
+}
+  8008eb:	89 d8                	mov    %ebx,%eax
+  8008ed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008f0:	c9                   	leave
+  8008f1:	c3                   	ret
+
+008008f2 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8008f2:	55                   	push   %ebp
+  8008f3:	89 e5                	mov    %esp,%ebp
+  8008f5:	56                   	push   %esi
+  8008f6:	53                   	push   %ebx
+  8008f7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008fa:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8008fd:	89 f3                	mov    %esi,%ebx
+  8008ff:	03 5d 10             	add    0x10(%ebp),%ebx
+  800902:	89 f0                	mov    %esi,%eax
+  800904:	eb 0f                	jmp    800915 <strncpy+0x23>
+		*dst++ = *src;
+  800906:	83 c0 01             	add    $0x1,%eax
+  800909:	0f b6 0a             	movzbl (%edx),%ecx
+  80090c:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80090f:	80 f9 01             	cmp    $0x1,%cl
+  800912:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800915:	39 d8                	cmp    %ebx,%eax
+  800917:	75 ed                	jne    800906 <strncpy+0x14>
+	}
+	return ret;
+}
+  800919:	89 f0                	mov    %esi,%eax
+  80091b:	5b                   	pop    %ebx
+  80091c:	5e                   	pop    %esi
+  80091d:	5d                   	pop    %ebp
+  80091e:	c3                   	ret
+
+0080091f <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80091f:	55                   	push   %ebp
+  800920:	89 e5                	mov    %esp,%ebp
+  800922:	56                   	push   %esi
+  800923:	53                   	push   %ebx
+  800924:	8b 75 08             	mov    0x8(%ebp),%esi
+  800927:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80092a:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80092d:	89 f0                	mov    %esi,%eax
+  80092f:	85 d2                	test   %edx,%edx
+  800931:	74 21                	je     800954 <strlcpy+0x35>
+  800933:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800937:	89 f2                	mov    %esi,%edx
+  800939:	eb 09                	jmp    800944 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80093b:	83 c1 01             	add    $0x1,%ecx
+  80093e:	83 c2 01             	add    $0x1,%edx
+  800941:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800944:	39 c2                	cmp    %eax,%edx
+  800946:	74 09                	je     800951 <strlcpy+0x32>
+  800948:	0f b6 19             	movzbl (%ecx),%ebx
+  80094b:	84 db                	test   %bl,%bl
+  80094d:	75 ec                	jne    80093b <strlcpy+0x1c>
+  80094f:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800951:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800954:	29 f0                	sub    %esi,%eax
+}
+  800956:	5b                   	pop    %ebx
+  800957:	5e                   	pop    %esi
+  800958:	5d                   	pop    %ebp
+  800959:	c3                   	ret
+
+0080095a <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80095a:	55                   	push   %ebp
+  80095b:	89 e5                	mov    %esp,%ebp
+  80095d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800960:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800963:	eb 06                	jmp    80096b <strcmp+0x11>
+		p++, q++;
+  800965:	83 c1 01             	add    $0x1,%ecx
+  800968:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80096b:	0f b6 01             	movzbl (%ecx),%eax
+  80096e:	84 c0                	test   %al,%al
+  800970:	74 04                	je     800976 <strcmp+0x1c>
+  800972:	3a 02                	cmp    (%edx),%al
+  800974:	74 ef                	je     800965 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800976:	0f b6 c0             	movzbl %al,%eax
+  800979:	0f b6 12             	movzbl (%edx),%edx
+  80097c:	29 d0                	sub    %edx,%eax
+}
+  80097e:	5d                   	pop    %ebp
+  80097f:	c3                   	ret
+
+00800980 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800980:	55                   	push   %ebp
+  800981:	89 e5                	mov    %esp,%ebp
+  800983:	53                   	push   %ebx
+  800984:	8b 45 08             	mov    0x8(%ebp),%eax
+  800987:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80098a:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80098d:	eb 09                	jmp    800998 <strncmp+0x18>
+		n--, p++, q++;
+  80098f:	83 ea 01             	sub    $0x1,%edx
+  800992:	83 c0 01             	add    $0x1,%eax
+  800995:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800998:	85 d2                	test   %edx,%edx
+  80099a:	74 18                	je     8009b4 <strncmp+0x34>
+  80099c:	0f b6 18             	movzbl (%eax),%ebx
+  80099f:	84 db                	test   %bl,%bl
+  8009a1:	74 04                	je     8009a7 <strncmp+0x27>
+  8009a3:	3a 19                	cmp    (%ecx),%bl
+  8009a5:	74 e8                	je     80098f <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009a7:	0f b6 00             	movzbl (%eax),%eax
+  8009aa:	0f b6 11             	movzbl (%ecx),%edx
+  8009ad:	29 d0                	sub    %edx,%eax
+}
+  8009af:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009b2:	c9                   	leave
+  8009b3:	c3                   	ret
+		return 0;
+  8009b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009b9:	eb f4                	jmp    8009af <strncmp+0x2f>
+
+008009bb <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8009bb:	55                   	push   %ebp
+  8009bc:	89 e5                	mov    %esp,%ebp
+  8009be:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009c1:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009c5:	eb 03                	jmp    8009ca <strchr+0xf>
+  8009c7:	83 c0 01             	add    $0x1,%eax
+  8009ca:	0f b6 10             	movzbl (%eax),%edx
+  8009cd:	84 d2                	test   %dl,%dl
+  8009cf:	74 06                	je     8009d7 <strchr+0x1c>
+		if (*s == c)
+  8009d1:	38 ca                	cmp    %cl,%dl
+  8009d3:	75 f2                	jne    8009c7 <strchr+0xc>
+  8009d5:	eb 05                	jmp    8009dc <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8009d7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009dc:	5d                   	pop    %ebp
+  8009dd:	c3                   	ret
+
+008009de <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8009de:	55                   	push   %ebp
+  8009df:	89 e5                	mov    %esp,%ebp
+  8009e1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009e4:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009e8:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8009eb:	38 ca                	cmp    %cl,%dl
+  8009ed:	74 09                	je     8009f8 <strfind+0x1a>
+  8009ef:	84 d2                	test   %dl,%dl
+  8009f1:	74 05                	je     8009f8 <strfind+0x1a>
+	for (; *s; s++)
+  8009f3:	83 c0 01             	add    $0x1,%eax
+  8009f6:	eb f0                	jmp    8009e8 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8009f8:	5d                   	pop    %ebp
+  8009f9:	c3                   	ret
+
+008009fa <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8009fa:	55                   	push   %ebp
+  8009fb:	89 e5                	mov    %esp,%ebp
+  8009fd:	57                   	push   %edi
+  8009fe:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a01:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a04:	85 c9                	test   %ecx,%ecx
+  800a06:	74 20                	je     800a28 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a08:	89 f8                	mov    %edi,%eax
+  800a0a:	09 c8                	or     %ecx,%eax
+  800a0c:	a8 03                	test   $0x3,%al
+  800a0e:	75 12                	jne    800a22 <memset+0x28>
+		c &= 0xFF;
+  800a10:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a14:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a1a:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a1d:	fc                   	cld
+  800a1e:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a20:	eb 06                	jmp    800a28 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a22:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a25:	fc                   	cld
+  800a26:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a28:	89 f8                	mov    %edi,%eax
+  800a2a:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a2d:	c9                   	leave
+  800a2e:	c3                   	ret
+
+00800a2f <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a2f:	55                   	push   %ebp
+  800a30:	89 e5                	mov    %esp,%ebp
+  800a32:	57                   	push   %edi
+  800a33:	56                   	push   %esi
+  800a34:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a37:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a3a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a3d:	39 c6                	cmp    %eax,%esi
+  800a3f:	73 32                	jae    800a73 <memmove+0x44>
+  800a41:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a44:	39 d0                	cmp    %edx,%eax
+  800a46:	73 2b                	jae    800a73 <memmove+0x44>
+		s += n;
+		d += n;
+  800a48:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a4b:	89 d6                	mov    %edx,%esi
+  800a4d:	09 fe                	or     %edi,%esi
+  800a4f:	09 ce                	or     %ecx,%esi
+  800a51:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a57:	75 0e                	jne    800a67 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a59:	83 ef 04             	sub    $0x4,%edi
+  800a5c:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a5f:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a62:	fd                   	std
+  800a63:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a65:	eb 09                	jmp    800a70 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a67:	83 ef 01             	sub    $0x1,%edi
+  800a6a:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a6d:	fd                   	std
+  800a6e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a70:	fc                   	cld
+  800a71:	eb 1a                	jmp    800a8d <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a73:	89 f2                	mov    %esi,%edx
+  800a75:	09 c2                	or     %eax,%edx
+  800a77:	09 ca                	or     %ecx,%edx
+  800a79:	f6 c2 03             	test   $0x3,%dl
+  800a7c:	75 0a                	jne    800a88 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a7e:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a81:	89 c7                	mov    %eax,%edi
+  800a83:	fc                   	cld
+  800a84:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a86:	eb 05                	jmp    800a8d <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a88:	89 c7                	mov    %eax,%edi
+  800a8a:	fc                   	cld
+  800a8b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a8d:	5e                   	pop    %esi
+  800a8e:	5f                   	pop    %edi
+  800a8f:	5d                   	pop    %ebp
+  800a90:	c3                   	ret
+
+00800a91 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a91:	55                   	push   %ebp
+  800a92:	89 e5                	mov    %esp,%ebp
+  800a94:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a97:	ff 75 10             	push   0x10(%ebp)
+  800a9a:	ff 75 0c             	push   0xc(%ebp)
+  800a9d:	ff 75 08             	push   0x8(%ebp)
+  800aa0:	e8 8a ff ff ff       	call   800a2f <memmove>
+}
+  800aa5:	c9                   	leave
+  800aa6:	c3                   	ret
+
+00800aa7 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800aa7:	55                   	push   %ebp
+  800aa8:	89 e5                	mov    %esp,%ebp
+  800aaa:	56                   	push   %esi
+  800aab:	53                   	push   %ebx
+  800aac:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aaf:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800ab2:	89 c6                	mov    %eax,%esi
+  800ab4:	03 75 10             	add    0x10(%ebp),%esi
+  800ab7:	eb 06                	jmp    800abf <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800ab9:	83 c0 01             	add    $0x1,%eax
+  800abc:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800abf:	39 f0                	cmp    %esi,%eax
+  800ac1:	74 14                	je     800ad7 <memcmp+0x30>
+		if (*s1 != *s2)
+  800ac3:	0f b6 08             	movzbl (%eax),%ecx
+  800ac6:	0f b6 1a             	movzbl (%edx),%ebx
+  800ac9:	38 d9                	cmp    %bl,%cl
+  800acb:	74 ec                	je     800ab9 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800acd:	0f b6 c1             	movzbl %cl,%eax
+  800ad0:	0f b6 db             	movzbl %bl,%ebx
+  800ad3:	29 d8                	sub    %ebx,%eax
+  800ad5:	eb 05                	jmp    800adc <memcmp+0x35>
+	}
+
+	return 0;
+  800ad7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800adc:	5b                   	pop    %ebx
+  800add:	5e                   	pop    %esi
+  800ade:	5d                   	pop    %ebp
+  800adf:	c3                   	ret
+
+00800ae0 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800ae0:	55                   	push   %ebp
+  800ae1:	89 e5                	mov    %esp,%ebp
+  800ae3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ae6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800ae9:	89 c2                	mov    %eax,%edx
+  800aeb:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800aee:	eb 03                	jmp    800af3 <memfind+0x13>
+  800af0:	83 c0 01             	add    $0x1,%eax
+  800af3:	39 d0                	cmp    %edx,%eax
+  800af5:	73 04                	jae    800afb <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800af7:	38 08                	cmp    %cl,(%eax)
+  800af9:	75 f5                	jne    800af0 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800afb:	5d                   	pop    %ebp
+  800afc:	c3                   	ret
+
+00800afd <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800afd:	55                   	push   %ebp
+  800afe:	89 e5                	mov    %esp,%ebp
+  800b00:	57                   	push   %edi
+  800b01:	56                   	push   %esi
+  800b02:	53                   	push   %ebx
+  800b03:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b06:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b09:	eb 03                	jmp    800b0e <strtol+0x11>
+		s++;
+  800b0b:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800b0e:	0f b6 02             	movzbl (%edx),%eax
+  800b11:	3c 20                	cmp    $0x20,%al
+  800b13:	74 f6                	je     800b0b <strtol+0xe>
+  800b15:	3c 09                	cmp    $0x9,%al
+  800b17:	74 f2                	je     800b0b <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b19:	3c 2b                	cmp    $0x2b,%al
+  800b1b:	74 2a                	je     800b47 <strtol+0x4a>
+	int neg = 0;
+  800b1d:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800b22:	3c 2d                	cmp    $0x2d,%al
+  800b24:	74 2b                	je     800b51 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b26:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b2c:	75 0f                	jne    800b3d <strtol+0x40>
+  800b2e:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b31:	74 28                	je     800b5b <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b33:	85 db                	test   %ebx,%ebx
+  800b35:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b3a:	0f 44 d8             	cmove  %eax,%ebx
+  800b3d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b42:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b45:	eb 46                	jmp    800b8d <strtol+0x90>
+		s++;
+  800b47:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800b4a:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b4f:	eb d5                	jmp    800b26 <strtol+0x29>
+		s++, neg = 1;
+  800b51:	83 c2 01             	add    $0x1,%edx
+  800b54:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b59:	eb cb                	jmp    800b26 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b5b:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b5f:	74 0e                	je     800b6f <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800b61:	85 db                	test   %ebx,%ebx
+  800b63:	75 d8                	jne    800b3d <strtol+0x40>
+		s++, base = 8;
+  800b65:	83 c2 01             	add    $0x1,%edx
+  800b68:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b6d:	eb ce                	jmp    800b3d <strtol+0x40>
+		s += 2, base = 16;
+  800b6f:	83 c2 02             	add    $0x2,%edx
+  800b72:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b77:	eb c4                	jmp    800b3d <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800b79:	0f be c0             	movsbl %al,%eax
+  800b7c:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800b7f:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b82:	7d 3a                	jge    800bbe <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800b84:	83 c2 01             	add    $0x1,%edx
+  800b87:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b8b:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800b8d:	0f b6 02             	movzbl (%edx),%eax
+  800b90:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b93:	89 f3                	mov    %esi,%ebx
+  800b95:	80 fb 09             	cmp    $0x9,%bl
+  800b98:	76 df                	jbe    800b79 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800b9a:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b9d:	89 f3                	mov    %esi,%ebx
+  800b9f:	80 fb 19             	cmp    $0x19,%bl
+  800ba2:	77 08                	ja     800bac <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800ba4:	0f be c0             	movsbl %al,%eax
+  800ba7:	83 e8 57             	sub    $0x57,%eax
+  800baa:	eb d3                	jmp    800b7f <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800bac:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800baf:	89 f3                	mov    %esi,%ebx
+  800bb1:	80 fb 19             	cmp    $0x19,%bl
+  800bb4:	77 08                	ja     800bbe <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800bb6:	0f be c0             	movsbl %al,%eax
+  800bb9:	83 e8 37             	sub    $0x37,%eax
+  800bbc:	eb c1                	jmp    800b7f <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800bbe:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800bc2:	74 05                	je     800bc9 <strtol+0xcc>
+		*endptr = (char *) s;
+  800bc4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bc7:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800bc9:	89 c8                	mov    %ecx,%eax
+  800bcb:	f7 d8                	neg    %eax
+  800bcd:	85 ff                	test   %edi,%edi
+  800bcf:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800bd2:	89 c8                	mov    %ecx,%eax
+  800bd4:	5b                   	pop    %ebx
+  800bd5:	5e                   	pop    %esi
+  800bd6:	5f                   	pop    %edi
+  800bd7:	5d                   	pop    %ebp
+  800bd8:	c3                   	ret
+
+00800bd9 <atoi>:
+
+int
+atoi(const char* s)
+{
+  800bd9:	55                   	push   %ebp
+  800bda:	89 e5                	mov    %esp,%ebp
+  800bdc:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  800bdf:	6a 00                	push   $0x0
+  800be1:	6a 00                	push   $0x0
+  800be3:	ff 75 08             	push   0x8(%ebp)
+  800be6:	e8 12 ff ff ff       	call   800afd <strtol>
+}
+  800beb:	c9                   	leave
+  800bec:	c3                   	ret
+
+00800bed <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800bed:	55                   	push   %ebp
+  800bee:	89 e5                	mov    %esp,%ebp
+  800bf0:	57                   	push   %edi
+  800bf1:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800bf2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bf7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bfa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bfd:	89 c3                	mov    %eax,%ebx
+  800bff:	89 c7                	mov    %eax,%edi
+  800c01:	6a 00                	push   $0x0
+  800c03:	55                   	push   %ebp
+  800c04:	56                   	push   %esi
+  800c05:	89 e5                	mov    %esp,%ebp
+  800c07:	8d 35 0f 0c 80 00    	lea    0x800c0f,%esi
+  800c0d:	0f 34                	sysenter
+
+00800c0f <after_sysenter_label_47>:
+  800c0f:	5e                   	pop    %esi
+  800c10:	5d                   	pop    %ebp
+  800c11:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c14:	5b                   	pop    %ebx
+  800c15:	5f                   	pop    %edi
+  800c16:	5d                   	pop    %ebp
+  800c17:	c3                   	ret
+
+00800c18 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c18:	55                   	push   %ebp
+  800c19:	89 e5                	mov    %esp,%ebp
+  800c1b:	57                   	push   %edi
+  800c1c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c1d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c22:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c27:	89 d1                	mov    %edx,%ecx
+  800c29:	89 d3                	mov    %edx,%ebx
+  800c2b:	89 d7                	mov    %edx,%edi
+  800c2d:	6a 00                	push   $0x0
+  800c2f:	55                   	push   %ebp
+  800c30:	56                   	push   %esi
+  800c31:	89 e5                	mov    %esp,%ebp
+  800c33:	8d 35 3b 0c 80 00    	lea    0x800c3b,%esi
+  800c39:	0f 34                	sysenter
+
+00800c3b <after_sysenter_label_128>:
+  800c3b:	5e                   	pop    %esi
+  800c3c:	5d                   	pop    %ebp
+  800c3d:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c40:	5b                   	pop    %ebx
+  800c41:	5f                   	pop    %edi
+  800c42:	5d                   	pop    %ebp
+  800c43:	c3                   	ret
+
+00800c44 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c44:	55                   	push   %ebp
+  800c45:	89 e5                	mov    %esp,%ebp
+  800c47:	57                   	push   %edi
+  800c48:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c49:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c4c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c51:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c56:	89 cb                	mov    %ecx,%ebx
+  800c58:	89 cf                	mov    %ecx,%edi
+  800c5a:	6a 00                	push   $0x0
+  800c5c:	55                   	push   %ebp
+  800c5d:	56                   	push   %esi
+  800c5e:	89 e5                	mov    %esp,%ebp
+  800c60:	8d 35 68 0c 80 00    	lea    0x800c68,%esi
+  800c66:	0f 34                	sysenter
+
+00800c68 <after_sysenter_label_212>:
+  800c68:	5e                   	pop    %esi
+  800c69:	5d                   	pop    %ebp
+  800c6a:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800c6d:	85 c0                	test   %eax,%eax
+  800c6f:	7f 07                	jg     800c78 <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c71:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c74:	5b                   	pop    %ebx
+  800c75:	5f                   	pop    %edi
+  800c76:	5d                   	pop    %ebp
+  800c77:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c78:	83 ec 0c             	sub    $0xc,%esp
+  800c7b:	50                   	push   %eax
+  800c7c:	6a 03                	push   $0x3
+  800c7e:	68 d5 4b 80 00       	push   $0x804bd5
+  800c83:	6a 54                	push   $0x54
+  800c85:	68 f2 4b 80 00       	push   $0x804bf2
+  800c8a:	e8 5b f5 ff ff       	call   8001ea <_panic>
+
+00800c8f <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800c8f:	55                   	push   %ebp
+  800c90:	89 e5                	mov    %esp,%ebp
+  800c92:	57                   	push   %edi
+  800c93:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c94:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c99:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c9e:	89 d1                	mov    %edx,%ecx
+  800ca0:	89 d3                	mov    %edx,%ebx
+  800ca2:	89 d7                	mov    %edx,%edi
+  800ca4:	6a 00                	push   $0x0
+  800ca6:	55                   	push   %ebp
+  800ca7:	56                   	push   %esi
+  800ca8:	89 e5                	mov    %esp,%ebp
+  800caa:	8d 35 b2 0c 80 00    	lea    0x800cb2,%esi
+  800cb0:	0f 34                	sysenter
+
+00800cb2 <after_sysenter_label_309>:
+  800cb2:	5e                   	pop    %esi
+  800cb3:	5d                   	pop    %ebp
+  800cb4:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800cb7:	5b                   	pop    %ebx
+  800cb8:	5f                   	pop    %edi
+  800cb9:	5d                   	pop    %ebp
+  800cba:	c3                   	ret
+
+00800cbb <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800cbb:	55                   	push   %ebp
+  800cbc:	89 e5                	mov    %esp,%ebp
+  800cbe:	57                   	push   %edi
+  800cbf:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800cc0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cc5:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800cca:	89 d1                	mov    %edx,%ecx
+  800ccc:	89 d3                	mov    %edx,%ebx
+  800cce:	89 d7                	mov    %edx,%edi
+  800cd0:	6a 00                	push   $0x0
+  800cd2:	55                   	push   %ebp
+  800cd3:	56                   	push   %esi
+  800cd4:	89 e5                	mov    %esp,%ebp
+  800cd6:	8d 35 de 0c 80 00    	lea    0x800cde,%esi
+  800cdc:	0f 34                	sysenter
+
+00800cde <after_sysenter_label_391>:
+  800cde:	5e                   	pop    %esi
+  800cdf:	5d                   	pop    %ebp
+  800ce0:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800ce3:	5b                   	pop    %ebx
+  800ce4:	5f                   	pop    %edi
+  800ce5:	5d                   	pop    %ebp
+  800ce6:	c3                   	ret
+
+00800ce7 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800ce7:	55                   	push   %ebp
+  800ce8:	89 e5                	mov    %esp,%ebp
+  800cea:	57                   	push   %edi
+  800ceb:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800cec:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cf2:	b8 04 00 00 00       	mov    $0x4,%eax
+  800cf7:	bf 00 00 00 00       	mov    $0x0,%edi
+  800cfc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cff:	6a 00                	push   $0x0
+  800d01:	55                   	push   %ebp
+  800d02:	56                   	push   %esi
+  800d03:	89 e5                	mov    %esp,%ebp
+  800d05:	8d 35 0d 0d 80 00    	lea    0x800d0d,%esi
+  800d0b:	0f 34                	sysenter
+
+00800d0d <after_sysenter_label_479>:
+  800d0d:	5e                   	pop    %esi
+  800d0e:	5d                   	pop    %ebp
+  800d0f:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d12:	85 c0                	test   %eax,%eax
+  800d14:	7f 07                	jg     800d1d <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d16:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d19:	5b                   	pop    %ebx
+  800d1a:	5f                   	pop    %edi
+  800d1b:	5d                   	pop    %ebp
+  800d1c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d1d:	83 ec 0c             	sub    $0xc,%esp
+  800d20:	50                   	push   %eax
+  800d21:	6a 04                	push   $0x4
+  800d23:	68 d5 4b 80 00       	push   $0x804bd5
+  800d28:	6a 54                	push   $0x54
+  800d2a:	68 f2 4b 80 00       	push   $0x804bf2
+  800d2f:	e8 b6 f4 ff ff       	call   8001ea <_panic>
+
+00800d34 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d34:	55                   	push   %ebp
+  800d35:	89 e5                	mov    %esp,%ebp
+  800d37:	57                   	push   %edi
+  800d38:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d39:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d3c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d3f:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d44:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d47:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d4a:	ff 75 18             	push   0x18(%ebp)
+  800d4d:	55                   	push   %ebp
+  800d4e:	56                   	push   %esi
+  800d4f:	89 e5                	mov    %esp,%ebp
+  800d51:	8d 35 59 0d 80 00    	lea    0x800d59,%esi
+  800d57:	0f 34                	sysenter
+
+00800d59 <after_sysenter_label_593>:
+  800d59:	5e                   	pop    %esi
+  800d5a:	5d                   	pop    %ebp
+  800d5b:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d5e:	85 c0                	test   %eax,%eax
+  800d60:	7f 07                	jg     800d69 <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800d62:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d65:	5b                   	pop    %ebx
+  800d66:	5f                   	pop    %edi
+  800d67:	5d                   	pop    %ebp
+  800d68:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d69:	83 ec 0c             	sub    $0xc,%esp
+  800d6c:	50                   	push   %eax
+  800d6d:	6a 05                	push   $0x5
+  800d6f:	68 d5 4b 80 00       	push   $0x804bd5
+  800d74:	6a 54                	push   $0x54
+  800d76:	68 f2 4b 80 00       	push   $0x804bf2
+  800d7b:	e8 6a f4 ff ff       	call   8001ea <_panic>
+
+00800d80 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800d80:	55                   	push   %ebp
+  800d81:	89 e5                	mov    %esp,%ebp
+  800d83:	57                   	push   %edi
+  800d84:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d85:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d8a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d8d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d90:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d95:	89 df                	mov    %ebx,%edi
+  800d97:	6a 00                	push   $0x0
+  800d99:	55                   	push   %ebp
+  800d9a:	56                   	push   %esi
+  800d9b:	89 e5                	mov    %esp,%ebp
+  800d9d:	8d 35 a5 0d 80 00    	lea    0x800da5,%esi
+  800da3:	0f 34                	sysenter
+
+00800da5 <after_sysenter_label_704>:
+  800da5:	5e                   	pop    %esi
+  800da6:	5d                   	pop    %ebp
+  800da7:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800daa:	85 c0                	test   %eax,%eax
+  800dac:	7f 07                	jg     800db5 <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800dae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800db1:	5b                   	pop    %ebx
+  800db2:	5f                   	pop    %edi
+  800db3:	5d                   	pop    %ebp
+  800db4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800db5:	83 ec 0c             	sub    $0xc,%esp
+  800db8:	50                   	push   %eax
+  800db9:	6a 06                	push   $0x6
+  800dbb:	68 d5 4b 80 00       	push   $0x804bd5
+  800dc0:	6a 54                	push   $0x54
+  800dc2:	68 f2 4b 80 00       	push   $0x804bf2
+  800dc7:	e8 1e f4 ff ff       	call   8001ea <_panic>
+
+00800dcc <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800dcc:	55                   	push   %ebp
+  800dcd:	89 e5                	mov    %esp,%ebp
+  800dcf:	57                   	push   %edi
+  800dd0:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800dd1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dd6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ddc:	b8 08 00 00 00       	mov    $0x8,%eax
+  800de1:	89 df                	mov    %ebx,%edi
+  800de3:	6a 00                	push   $0x0
+  800de5:	55                   	push   %ebp
+  800de6:	56                   	push   %esi
+  800de7:	89 e5                	mov    %esp,%ebp
+  800de9:	8d 35 f1 0d 80 00    	lea    0x800df1,%esi
+  800def:	0f 34                	sysenter
+
+00800df1 <after_sysenter_label_808>:
+  800df1:	5e                   	pop    %esi
+  800df2:	5d                   	pop    %ebp
+  800df3:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800df6:	85 c0                	test   %eax,%eax
+  800df8:	7f 07                	jg     800e01 <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800dfa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800dfd:	5b                   	pop    %ebx
+  800dfe:	5f                   	pop    %edi
+  800dff:	5d                   	pop    %ebp
+  800e00:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e01:	83 ec 0c             	sub    $0xc,%esp
+  800e04:	50                   	push   %eax
+  800e05:	6a 08                	push   $0x8
+  800e07:	68 d5 4b 80 00       	push   $0x804bd5
+  800e0c:	6a 54                	push   $0x54
+  800e0e:	68 f2 4b 80 00       	push   $0x804bf2
+  800e13:	e8 d2 f3 ff ff       	call   8001ea <_panic>
+
+00800e18 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800e18:	55                   	push   %ebp
+  800e19:	89 e5                	mov    %esp,%ebp
+  800e1b:	57                   	push   %edi
+  800e1c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e1d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e22:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e25:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e28:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e2d:	89 df                	mov    %ebx,%edi
+  800e2f:	6a 00                	push   $0x0
+  800e31:	55                   	push   %ebp
+  800e32:	56                   	push   %esi
+  800e33:	89 e5                	mov    %esp,%ebp
+  800e35:	8d 35 3d 0e 80 00    	lea    0x800e3d,%esi
+  800e3b:	0f 34                	sysenter
+
+00800e3d <after_sysenter_label_912>:
+  800e3d:	5e                   	pop    %esi
+  800e3e:	5d                   	pop    %ebp
+  800e3f:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e42:	85 c0                	test   %eax,%eax
+  800e44:	7f 07                	jg     800e4d <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800e46:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e49:	5b                   	pop    %ebx
+  800e4a:	5f                   	pop    %edi
+  800e4b:	5d                   	pop    %ebp
+  800e4c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e4d:	83 ec 0c             	sub    $0xc,%esp
+  800e50:	50                   	push   %eax
+  800e51:	6a 09                	push   $0x9
+  800e53:	68 d5 4b 80 00       	push   $0x804bd5
+  800e58:	6a 54                	push   $0x54
+  800e5a:	68 f2 4b 80 00       	push   $0x804bf2
+  800e5f:	e8 86 f3 ff ff       	call   8001ea <_panic>
+
+00800e64 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800e64:	55                   	push   %ebp
+  800e65:	89 e5                	mov    %esp,%ebp
+  800e67:	57                   	push   %edi
+  800e68:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e69:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e6e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e71:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e74:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e79:	89 df                	mov    %ebx,%edi
+  800e7b:	6a 00                	push   $0x0
+  800e7d:	55                   	push   %ebp
+  800e7e:	56                   	push   %esi
+  800e7f:	89 e5                	mov    %esp,%ebp
+  800e81:	8d 35 89 0e 80 00    	lea    0x800e89,%esi
+  800e87:	0f 34                	sysenter
+
+00800e89 <after_sysenter_label_1016>:
+  800e89:	5e                   	pop    %esi
+  800e8a:	5d                   	pop    %ebp
+  800e8b:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e8e:	85 c0                	test   %eax,%eax
+  800e90:	7f 07                	jg     800e99 <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800e92:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e95:	5b                   	pop    %ebx
+  800e96:	5f                   	pop    %edi
+  800e97:	5d                   	pop    %ebp
+  800e98:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e99:	83 ec 0c             	sub    $0xc,%esp
+  800e9c:	50                   	push   %eax
+  800e9d:	6a 0a                	push   $0xa
+  800e9f:	68 d5 4b 80 00       	push   $0x804bd5
+  800ea4:	6a 54                	push   $0x54
+  800ea6:	68 f2 4b 80 00       	push   $0x804bf2
+  800eab:	e8 3a f3 ff ff       	call   8001ea <_panic>
+
+00800eb0 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800eb0:	55                   	push   %ebp
+  800eb1:	89 e5                	mov    %esp,%ebp
+  800eb3:	57                   	push   %edi
+  800eb4:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800eb5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ebb:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800ec0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ec3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ec6:	6a 00                	push   $0x0
+  800ec8:	55                   	push   %ebp
+  800ec9:	56                   	push   %esi
+  800eca:	89 e5                	mov    %esp,%ebp
+  800ecc:	8d 35 d4 0e 80 00    	lea    0x800ed4,%esi
+  800ed2:	0f 34                	sysenter
+
+00800ed4 <after_sysenter_label_1126>:
+  800ed4:	5e                   	pop    %esi
+  800ed5:	5d                   	pop    %ebp
+  800ed6:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800ed9:	5b                   	pop    %ebx
+  800eda:	5f                   	pop    %edi
+  800edb:	5d                   	pop    %ebp
+  800edc:	c3                   	ret
+
+00800edd <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800edd:	55                   	push   %ebp
+  800ede:	89 e5                	mov    %esp,%ebp
+  800ee0:	57                   	push   %edi
+  800ee1:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ee2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800eea:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800eef:	89 cb                	mov    %ecx,%ebx
+  800ef1:	89 cf                	mov    %ecx,%edi
+  800ef3:	6a 00                	push   $0x0
+  800ef5:	55                   	push   %ebp
+  800ef6:	56                   	push   %esi
+  800ef7:	89 e5                	mov    %esp,%ebp
+  800ef9:	8d 35 01 0f 80 00    	lea    0x800f01,%esi
+  800eff:	0f 34                	sysenter
+
+00800f01 <after_sysenter_label_1210>:
+  800f01:	5e                   	pop    %esi
+  800f02:	5d                   	pop    %ebp
+  800f03:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800f06:	85 c0                	test   %eax,%eax
+  800f08:	7f 07                	jg     800f11 <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800f0a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f0d:	5b                   	pop    %ebx
+  800f0e:	5f                   	pop    %edi
+  800f0f:	5d                   	pop    %ebp
+  800f10:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f11:	83 ec 0c             	sub    $0xc,%esp
+  800f14:	50                   	push   %eax
+  800f15:	6a 0d                	push   $0xd
+  800f17:	68 d5 4b 80 00       	push   $0x804bd5
+  800f1c:	6a 54                	push   $0x54
+  800f1e:	68 f2 4b 80 00       	push   $0x804bf2
+  800f23:	e8 c2 f2 ff ff       	call   8001ea <_panic>
+
+00800f28 <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  800f28:	55                   	push   %ebp
+  800f29:	89 e5                	mov    %esp,%ebp
+  800f2b:	57                   	push   %edi
+  800f2c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f2d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f32:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f35:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f38:	b8 42 00 00 00       	mov    $0x42,%eax
+  800f3d:	89 df                	mov    %ebx,%edi
+  800f3f:	6a 00                	push   $0x0
+  800f41:	55                   	push   %ebp
+  800f42:	56                   	push   %esi
+  800f43:	89 e5                	mov    %esp,%ebp
+  800f45:	8d 35 4d 0f 80 00    	lea    0x800f4d,%esi
+  800f4b:	0f 34                	sysenter
+
+00800f4d <after_sysenter_label_1311>:
+  800f4d:	5e                   	pop    %esi
+  800f4e:	5d                   	pop    %ebp
+  800f4f:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800f52:	85 c0                	test   %eax,%eax
+  800f54:	7f 07                	jg     800f5d <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  800f56:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f59:	5b                   	pop    %ebx
+  800f5a:	5f                   	pop    %edi
+  800f5b:	5d                   	pop    %ebp
+  800f5c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f5d:	83 ec 0c             	sub    $0xc,%esp
+  800f60:	50                   	push   %eax
+  800f61:	6a 42                	push   $0x42
+  800f63:	68 d5 4b 80 00       	push   $0x804bd5
+  800f68:	6a 54                	push   $0x54
+  800f6a:	68 f2 4b 80 00       	push   $0x804bf2
+  800f6f:	e8 76 f2 ff ff       	call   8001ea <_panic>
+
+00800f74 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800f74:	55                   	push   %ebp
+  800f75:	89 e5                	mov    %esp,%ebp
+  800f77:	57                   	push   %edi
+  800f78:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f79:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f7e:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800f83:	89 d1                	mov    %edx,%ecx
+  800f85:	89 d3                	mov    %edx,%ebx
+  800f87:	89 d7                	mov    %edx,%edi
+  800f89:	6a 00                	push   $0x0
+  800f8b:	55                   	push   %ebp
+  800f8c:	56                   	push   %esi
+  800f8d:	89 e5                	mov    %esp,%ebp
+  800f8f:	8d 35 97 0f 80 00    	lea    0x800f97,%esi
+  800f95:	0f 34                	sysenter
+
+00800f97 <after_sysenter_label_1411>:
+  800f97:	5e                   	pop    %esi
+  800f98:	5d                   	pop    %ebp
+  800f99:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800f9c:	5b                   	pop    %ebx
+  800f9d:	5f                   	pop    %edi
+  800f9e:	5d                   	pop    %ebp
+  800f9f:	c3                   	ret
+
+00800fa0 <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  800fa0:	55                   	push   %ebp
+  800fa1:	89 e5                	mov    %esp,%ebp
+  800fa3:	57                   	push   %edi
+  800fa4:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fa5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800faa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fb0:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800fb5:	89 df                	mov    %ebx,%edi
+  800fb7:	6a 00                	push   $0x0
+  800fb9:	55                   	push   %ebp
+  800fba:	56                   	push   %esi
+  800fbb:	89 e5                	mov    %esp,%ebp
+  800fbd:	8d 35 c5 0f 80 00    	lea    0x800fc5,%esi
+  800fc3:	0f 34                	sysenter
+
+00800fc5 <after_sysenter_label_1497>:
+  800fc5:	5e                   	pop    %esi
+  800fc6:	5d                   	pop    %ebp
+  800fc7:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  800fca:	5b                   	pop    %ebx
+  800fcb:	5f                   	pop    %edi
+  800fcc:	5d                   	pop    %ebp
+  800fcd:	c3                   	ret
+
+00800fce <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  800fce:	55                   	push   %ebp
+  800fcf:	89 e5                	mov    %esp,%ebp
+  800fd1:	57                   	push   %edi
+  800fd2:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fd3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fd8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fdb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fde:	b8 10 00 00 00       	mov    $0x10,%eax
+  800fe3:	89 df                	mov    %ebx,%edi
+  800fe5:	6a 00                	push   $0x0
+  800fe7:	55                   	push   %ebp
+  800fe8:	56                   	push   %esi
+  800fe9:	89 e5                	mov    %esp,%ebp
+  800feb:	8d 35 f3 0f 80 00    	lea    0x800ff3,%esi
+  800ff1:	0f 34                	sysenter
+
+00800ff3 <after_sysenter_label_1583>:
+  800ff3:	5e                   	pop    %esi
+  800ff4:	5d                   	pop    %ebp
+  800ff5:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  800ff8:	5b                   	pop    %ebx
+  800ff9:	5f                   	pop    %edi
+  800ffa:	5d                   	pop    %ebp
+  800ffb:	c3                   	ret
+
+00800ffc <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  800ffc:	55                   	push   %ebp
+  800ffd:	89 e5                	mov    %esp,%ebp
+  800fff:	57                   	push   %edi
+  801000:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801001:	8b 55 08             	mov    0x8(%ebp),%edx
+  801004:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801007:	b8 11 00 00 00       	mov    $0x11,%eax
+  80100c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801011:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801014:	6a 00                	push   $0x0
+  801016:	55                   	push   %ebp
+  801017:	56                   	push   %esi
+  801018:	89 e5                	mov    %esp,%ebp
+  80101a:	8d 35 22 10 80 00    	lea    0x801022,%esi
+  801020:	0f 34                	sysenter
+
+00801022 <after_sysenter_label_1672>:
+  801022:	5e                   	pop    %esi
+  801023:	5d                   	pop    %ebp
+  801024:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  801027:	5b                   	pop    %ebx
+  801028:	5f                   	pop    %edi
+  801029:	5d                   	pop    %ebp
+  80102a:	c3                   	ret
+
+0080102b <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  80102b:	55                   	push   %ebp
+  80102c:	89 e5                	mov    %esp,%ebp
+  80102e:	57                   	push   %edi
+  80102f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801030:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801035:	8b 55 08             	mov    0x8(%ebp),%edx
+  801038:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80103b:	b8 12 00 00 00       	mov    $0x12,%eax
+  801040:	89 df                	mov    %ebx,%edi
+  801042:	6a 00                	push   $0x0
+  801044:	55                   	push   %ebp
+  801045:	56                   	push   %esi
+  801046:	89 e5                	mov    %esp,%ebp
+  801048:	8d 35 50 10 80 00    	lea    0x801050,%esi
+  80104e:	0f 34                	sysenter
+
+00801050 <after_sysenter_label_1758>:
+  801050:	5e                   	pop    %esi
+  801051:	5d                   	pop    %ebp
+  801052:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  801055:	5b                   	pop    %ebx
+  801056:	5f                   	pop    %edi
+  801057:	5d                   	pop    %ebp
+  801058:	c3                   	ret
+
+00801059 <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  801059:	55                   	push   %ebp
+  80105a:	89 e5                	mov    %esp,%ebp
+  80105c:	57                   	push   %edi
+  80105d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80105e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801061:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801066:	b8 13 00 00 00       	mov    $0x13,%eax
+  80106b:	89 cb                	mov    %ecx,%ebx
+  80106d:	89 cf                	mov    %ecx,%edi
+  80106f:	6a 00                	push   $0x0
+  801071:	55                   	push   %ebp
+  801072:	56                   	push   %esi
+  801073:	89 e5                	mov    %esp,%ebp
+  801075:	8d 35 7d 10 80 00    	lea    0x80107d,%esi
+  80107b:	0f 34                	sysenter
+
+0080107d <after_sysenter_label_1842>:
+  80107d:	5e                   	pop    %esi
+  80107e:	5d                   	pop    %ebp
+  80107f:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801082:	85 c0                	test   %eax,%eax
+  801084:	7f 07                	jg     80108d <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  801086:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801089:	5b                   	pop    %ebx
+  80108a:	5f                   	pop    %edi
+  80108b:	5d                   	pop    %ebp
+  80108c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80108d:	83 ec 0c             	sub    $0xc,%esp
+  801090:	50                   	push   %eax
+  801091:	6a 13                	push   $0x13
+  801093:	68 d5 4b 80 00       	push   $0x804bd5
+  801098:	6a 54                	push   $0x54
+  80109a:	68 f2 4b 80 00       	push   $0x804bf2
+  80109f:	e8 46 f1 ff ff       	call   8001ea <_panic>
+
+008010a4 <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  8010a4:	55                   	push   %ebp
+  8010a5:	89 e5                	mov    %esp,%ebp
+  8010a7:	57                   	push   %edi
+  8010a8:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010ae:	b8 14 00 00 00       	mov    $0x14,%eax
+  8010b3:	89 d1                	mov    %edx,%ecx
+  8010b5:	89 d3                	mov    %edx,%ebx
+  8010b7:	89 d7                	mov    %edx,%edi
+  8010b9:	6a 00                	push   $0x0
+  8010bb:	55                   	push   %ebp
+  8010bc:	56                   	push   %esi
+  8010bd:	89 e5                	mov    %esp,%ebp
+  8010bf:	8d 35 c7 10 80 00    	lea    0x8010c7,%esi
+  8010c5:	0f 34                	sysenter
+
+008010c7 <after_sysenter_label_1939>:
+  8010c7:	5e                   	pop    %esi
+  8010c8:	5d                   	pop    %ebp
+  8010c9:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  8010cc:	5b                   	pop    %ebx
+  8010cd:	5f                   	pop    %edi
+  8010ce:	5d                   	pop    %ebp
+  8010cf:	c3                   	ret
+
+008010d0 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  8010d0:	55                   	push   %ebp
+  8010d1:	89 e5                	mov    %esp,%ebp
+  8010d3:	57                   	push   %edi
+  8010d4:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010db:	b8 15 00 00 00       	mov    $0x15,%eax
+  8010e0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010e5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010e8:	6a 00                	push   $0x0
+  8010ea:	55                   	push   %ebp
+  8010eb:	56                   	push   %esi
+  8010ec:	89 e5                	mov    %esp,%ebp
+  8010ee:	8d 35 f6 10 80 00    	lea    0x8010f6,%esi
+  8010f4:	0f 34                	sysenter
+
+008010f6 <after_sysenter_label_2028>:
+  8010f6:	5e                   	pop    %esi
+  8010f7:	5d                   	pop    %ebp
+  8010f8:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  8010fb:	5b                   	pop    %ebx
+  8010fc:	5f                   	pop    %edi
+  8010fd:	5d                   	pop    %ebp
+  8010fe:	c3                   	ret
+
+008010ff <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  8010ff:	55                   	push   %ebp
+  801100:	89 e5                	mov    %esp,%ebp
+  801102:	57                   	push   %edi
+  801103:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801104:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801109:	8b 55 08             	mov    0x8(%ebp),%edx
+  80110c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80110f:	b8 16 00 00 00       	mov    $0x16,%eax
+  801114:	89 df                	mov    %ebx,%edi
+  801116:	6a 00                	push   $0x0
+  801118:	55                   	push   %ebp
+  801119:	56                   	push   %esi
+  80111a:	89 e5                	mov    %esp,%ebp
+  80111c:	8d 35 24 11 80 00    	lea    0x801124,%esi
+  801122:	0f 34                	sysenter
+
+00801124 <after_sysenter_label_2114>:
+  801124:	5e                   	pop    %esi
+  801125:	5d                   	pop    %ebp
+  801126:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  801129:	5b                   	pop    %ebx
+  80112a:	5f                   	pop    %edi
+  80112b:	5d                   	pop    %ebp
+  80112c:	c3                   	ret
+
+0080112d <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  80112d:	55                   	push   %ebp
+  80112e:	89 e5                	mov    %esp,%ebp
+  801130:	57                   	push   %edi
+  801131:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801132:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801137:	8b 55 08             	mov    0x8(%ebp),%edx
+  80113a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80113d:	b8 17 00 00 00       	mov    $0x17,%eax
+  801142:	89 df                	mov    %ebx,%edi
+  801144:	6a 00                	push   $0x0
+  801146:	55                   	push   %ebp
+  801147:	56                   	push   %esi
+  801148:	89 e5                	mov    %esp,%ebp
+  80114a:	8d 35 52 11 80 00    	lea    0x801152,%esi
+  801150:	0f 34                	sysenter
+
+00801152 <after_sysenter_label_2200>:
+  801152:	5e                   	pop    %esi
+  801153:	5d                   	pop    %ebp
+  801154:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  801157:	5b                   	pop    %ebx
+  801158:	5f                   	pop    %edi
+  801159:	5d                   	pop    %ebp
+  80115a:	c3                   	ret
+
+0080115b <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  80115b:	55                   	push   %ebp
+  80115c:	89 e5                	mov    %esp,%ebp
+  80115e:	57                   	push   %edi
+  80115f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801160:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801165:	8b 55 08             	mov    0x8(%ebp),%edx
+  801168:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80116b:	b8 18 00 00 00       	mov    $0x18,%eax
+  801170:	89 df                	mov    %ebx,%edi
+  801172:	6a 00                	push   $0x0
+  801174:	55                   	push   %ebp
+  801175:	56                   	push   %esi
+  801176:	89 e5                	mov    %esp,%ebp
+  801178:	8d 35 80 11 80 00    	lea    0x801180,%esi
+  80117e:	0f 34                	sysenter
+
+00801180 <after_sysenter_label_2286>:
+  801180:	5e                   	pop    %esi
+  801181:	5d                   	pop    %ebp
+  801182:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  801185:	5b                   	pop    %ebx
+  801186:	5f                   	pop    %edi
+  801187:	5d                   	pop    %ebp
+  801188:	c3                   	ret
+
+00801189 <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  801189:	55                   	push   %ebp
+  80118a:	89 e5                	mov    %esp,%ebp
+  80118c:	57                   	push   %edi
+  80118d:	56                   	push   %esi
+  80118e:	53                   	push   %ebx
+  80118f:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  801192:	89 d6                	mov    %edx,%esi
+  801194:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  801197:	89 cf                	mov    %ecx,%edi
+  801199:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  80119c:	89 fa                	mov    %edi,%edx
+  80119e:	80 ce 08             	or     $0x8,%dh
+  8011a1:	f6 c5 08             	test   $0x8,%ch
+  8011a4:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  8011a7:	57                   	push   %edi
+  8011a8:	56                   	push   %esi
+  8011a9:	50                   	push   %eax
+  8011aa:	56                   	push   %esi
+  8011ab:	6a 00                	push   $0x0
+  8011ad:	e8 82 fb ff ff       	call   800d34 <sys_page_map>
+	if (r < 0) {
+  8011b2:	83 c4 20             	add    $0x20,%esp
+  8011b5:	85 c0                	test   %eax,%eax
+  8011b7:	78 27                	js     8011e0 <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  8011b9:	83 ec 0c             	sub    $0xc,%esp
+  8011bc:	57                   	push   %edi
+  8011bd:	56                   	push   %esi
+  8011be:	6a 00                	push   $0x0
+  8011c0:	56                   	push   %esi
+  8011c1:	6a 00                	push   $0x0
+  8011c3:	e8 6c fb ff ff       	call   800d34 <sys_page_map>
+  8011c8:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  8011ca:	83 c4 20             	add    $0x20,%esp
+  8011cd:	85 c0                	test   %eax,%eax
+  8011cf:	78 24                	js     8011f5 <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  8011d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8011d6:	89 d8                	mov    %ebx,%eax
+  8011d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011db:	5b                   	pop    %ebx
+  8011dc:	5e                   	pop    %esi
+  8011dd:	5f                   	pop    %edi
+  8011de:	5d                   	pop    %ebp
+  8011df:	c3                   	ret
+  8011e0:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  8011e2:	83 ec 08             	sub    $0x8,%esp
+  8011e5:	50                   	push   %eax
+  8011e6:	68 00 4c 80 00       	push   $0x804c00
+  8011eb:	e8 d5 f0 ff ff       	call   8002c5 <cprintf>
+		return r;
+  8011f0:	83 c4 10             	add    $0x10,%esp
+  8011f3:	eb e1                	jmp    8011d6 <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  8011f5:	83 ec 08             	sub    $0x8,%esp
+  8011f8:	50                   	push   %eax
+  8011f9:	68 30 4c 80 00       	push   $0x804c30
+  8011fe:	e8 c2 f0 ff ff       	call   8002c5 <cprintf>
+		return r;
+  801203:	83 c4 10             	add    $0x10,%esp
+  801206:	eb ce                	jmp    8011d6 <duppage_cow+0x4d>
+
+00801208 <duppage>:
+{
+  801208:	55                   	push   %ebp
+  801209:	89 e5                	mov    %esp,%ebp
+  80120b:	53                   	push   %ebx
+  80120c:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  80120f:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  801212:	51                   	push   %ecx
+  801213:	52                   	push   %edx
+  801214:	50                   	push   %eax
+  801215:	52                   	push   %edx
+  801216:	6a 00                	push   $0x0
+  801218:	e8 17 fb ff ff       	call   800d34 <sys_page_map>
+	if (r < 0) {
+  80121d:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  801220:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  801225:	85 c0                	test   %eax,%eax
+  801227:	78 07                	js     801230 <duppage+0x28>
+}
+  801229:	89 d8                	mov    %ebx,%eax
+  80122b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80122e:	c9                   	leave
+  80122f:	c3                   	ret
+  801230:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  801232:	83 ec 08             	sub    $0x8,%esp
+  801235:	50                   	push   %eax
+  801236:	68 00 4c 80 00       	push   $0x804c00
+  80123b:	e8 85 f0 ff ff       	call   8002c5 <cprintf>
+		return r;
+  801240:	83 c4 10             	add    $0x10,%esp
+  801243:	eb e4                	jmp    801229 <duppage+0x21>
+
+00801245 <cow_copy>:
+{
+  801245:	55                   	push   %ebp
+  801246:	89 e5                	mov    %esp,%ebp
+  801248:	56                   	push   %esi
+  801249:	53                   	push   %ebx
+  80124a:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  80124c:	83 ec 04             	sub    $0x4,%esp
+  80124f:	6a 07                	push   $0x7
+  801251:	68 00 f0 7f 00       	push   $0x7ff000
+  801256:	6a 00                	push   $0x0
+  801258:	e8 8a fa ff ff       	call   800ce7 <sys_page_alloc>
+	if (r < 0) {
+  80125d:	83 c4 10             	add    $0x10,%esp
+  801260:	85 c0                	test   %eax,%eax
+  801262:	78 58                	js     8012bc <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  801264:	83 ec 04             	sub    $0x4,%esp
+  801267:	68 00 10 00 00       	push   $0x1000
+  80126c:	56                   	push   %esi
+  80126d:	68 00 f0 7f 00       	push   $0x7ff000
+  801272:	e8 b8 f7 ff ff       	call   800a2f <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  801277:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80127e:	56                   	push   %esi
+  80127f:	6a 00                	push   $0x0
+  801281:	68 00 f0 7f 00       	push   $0x7ff000
+  801286:	6a 00                	push   $0x0
+  801288:	e8 a7 fa ff ff       	call   800d34 <sys_page_map>
+  80128d:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  80128f:	83 c4 20             	add    $0x20,%esp
+  801292:	85 c0                	test   %eax,%eax
+  801294:	78 3b                	js     8012d1 <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  801296:	83 ec 08             	sub    $0x8,%esp
+  801299:	68 00 f0 7f 00       	push   $0x7ff000
+  80129e:	6a 00                	push   $0x0
+  8012a0:	e8 db fa ff ff       	call   800d80 <sys_page_unmap>
+  8012a5:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  8012a7:	83 c4 10             	add    $0x10,%esp
+  8012aa:	85 c0                	test   %eax,%eax
+  8012ac:	78 45                	js     8012f3 <cow_copy+0xae>
+	return 0;
+  8012ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8012b3:	89 d8                	mov    %ebx,%eax
+  8012b5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8012b8:	5b                   	pop    %ebx
+  8012b9:	5e                   	pop    %esi
+  8012ba:	5d                   	pop    %ebp
+  8012bb:	c3                   	ret
+  8012bc:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  8012be:	83 ec 08             	sub    $0x8,%esp
+  8012c1:	50                   	push   %eax
+  8012c2:	68 20 4d 80 00       	push   $0x804d20
+  8012c7:	e8 f9 ef ff ff       	call   8002c5 <cprintf>
+		return r;
+  8012cc:	83 c4 10             	add    $0x10,%esp
+  8012cf:	eb e2                	jmp    8012b3 <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  8012d1:	83 ec 08             	sub    $0x8,%esp
+  8012d4:	50                   	push   %eax
+  8012d5:	68 3c 4d 80 00       	push   $0x804d3c
+  8012da:	e8 e6 ef ff ff       	call   8002c5 <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  8012df:	83 c4 08             	add    $0x8,%esp
+  8012e2:	68 00 f0 7f 00       	push   $0x7ff000
+  8012e7:	6a 00                	push   $0x0
+  8012e9:	e8 92 fa ff ff       	call   800d80 <sys_page_unmap>
+		return r;
+  8012ee:	83 c4 10             	add    $0x10,%esp
+  8012f1:	eb c0                	jmp    8012b3 <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  8012f3:	83 ec 08             	sub    $0x8,%esp
+  8012f6:	50                   	push   %eax
+  8012f7:	68 58 4c 80 00       	push   $0x804c58
+  8012fc:	e8 c4 ef ff ff       	call   8002c5 <cprintf>
+		return r;
+  801301:	83 c4 10             	add    $0x10,%esp
+  801304:	eb ad                	jmp    8012b3 <cow_copy+0x6e>
+
+00801306 <pgfault>:
+{
+  801306:	55                   	push   %ebp
+  801307:	89 e5                	mov    %esp,%ebp
+  801309:	56                   	push   %esi
+  80130a:	53                   	push   %ebx
+  80130b:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  80130e:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  801310:	89 d8                	mov    %ebx,%eax
+  801312:	c1 e8 16             	shr    $0x16,%eax
+  801315:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  80131c:	89 de                	mov    %ebx,%esi
+  80131e:	c1 ee 0c             	shr    $0xc,%esi
+  801321:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  801328:	a8 07                	test   $0x7,%al
+  80132a:	74 3b                	je     801367 <pgfault+0x61>
+  80132c:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  801332:	74 33                	je     801367 <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  801334:	83 ec 0c             	sub    $0xc,%esp
+  801337:	68 00 f0 bf ee       	push   $0xeebff000
+  80133c:	e8 7c 26 00 00       	call   8039bd <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  801341:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  801348:	83 c4 10             	add    $0x10,%esp
+  80134b:	f6 c4 08             	test   $0x8,%ah
+  80134e:	75 30                	jne    801380 <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  801350:	83 ec 0c             	sub    $0xc,%esp
+  801353:	68 00 f0 bf ee       	push   $0xeebff000
+  801358:	e8 cd 26 00 00       	call   803a2a <mutex_unlock>
+}
+  80135d:	83 c4 10             	add    $0x10,%esp
+  801360:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801363:	5b                   	pop    %ebx
+  801364:	5e                   	pop    %esi
+  801365:	5d                   	pop    %ebp
+  801366:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  801367:	83 ec 08             	sub    $0x8,%esp
+  80136a:	ff 72 28             	push   0x28(%edx)
+  80136d:	51                   	push   %ecx
+  80136e:	50                   	push   %eax
+  80136f:	68 7c 4c 80 00       	push   $0x804c7c
+  801374:	6a 3f                	push   $0x3f
+  801376:	68 56 4d 80 00       	push   $0x804d56
+  80137b:	e8 6a ee ff ff       	call   8001ea <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  801380:	89 d8                	mov    %ebx,%eax
+  801382:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  801387:	e8 b9 fe ff ff       	call   801245 <cow_copy>
+  80138c:	eb c2                	jmp    801350 <pgfault+0x4a>
+
+0080138e <cow_enable>:
+{
+  80138e:	55                   	push   %ebp
+  80138f:	89 e5                	mov    %esp,%ebp
+  801391:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  801394:	68 06 13 80 00       	push   $0x801306
+  801399:	e8 9f 2f 00 00       	call   80433d <set_pgfault_handler>
+}
+  80139e:	83 c4 10             	add    $0x10,%esp
+  8013a1:	c9                   	leave
+  8013a2:	c3                   	ret
+
+008013a3 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  8013a3:	55                   	push   %ebp
+  8013a4:	89 e5                	mov    %esp,%ebp
+  8013a6:	57                   	push   %edi
+  8013a7:	56                   	push   %esi
+  8013a8:	53                   	push   %ebx
+  8013a9:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  8013ac:	68 06 13 80 00       	push   $0x801306
+  8013b1:	e8 87 2f 00 00       	call   80433d <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  8013b6:	b8 07 00 00 00       	mov    $0x7,%eax
+  8013bb:	cd 30                	int    $0x30
+  8013bd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  8013c0:	83 c4 10             	add    $0x10,%esp
+  8013c3:	85 c0                	test   %eax,%eax
+  8013c5:	78 4b                	js     801412 <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  8013c7:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8013cc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013d1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  8013d4:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8013d8:	0f 85 16 01 00 00    	jne    8014f4 <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8013de:	e8 ac f8 ff ff       	call   800c8f <sys_getenvid>
+  8013e3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8013e8:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8013ea:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  8013f0:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8013f6:	77 32                	ja     80142a <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8013f8:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  8013fd:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  8013ff:	c1 ea 10             	shr    $0x10,%edx
+  801402:	74 26                	je     80142a <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801404:	c1 e2 10             	shl    $0x10,%edx
+  801407:	89 d1                	mov    %edx,%ecx
+  801409:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80140e:	29 ca                	sub    %ecx,%edx
+  801410:	eb 1e                	jmp    801430 <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  801412:	83 ec 08             	sub    $0x8,%esp
+  801415:	89 c7                	mov    %eax,%edi
+  801417:	50                   	push   %eax
+  801418:	68 61 4d 80 00       	push   $0x804d61
+  80141d:	e8 a3 ee ff ff       	call   8002c5 <cprintf>
+		return eid;
+  801422:	83 c4 10             	add    $0x10,%esp
+  801425:	e9 6c 01 00 00       	jmp    801596 <fork+0x1f3>
+		return pthread_main_tls;
+  80142a:	8b 15 c4 62 80 00    	mov    0x8062c4,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801430:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  801433:	c1 e0 04             	shl    $0x4,%eax
+  801436:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80143b:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  80143d:	e8 c4 2c 00 00       	call   804106 <pthread_fork_child>
+		return eid;
+  801442:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801445:	e9 4c 01 00 00       	jmp    801596 <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  80144a:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  801450:	89 da                	mov    %ebx,%edx
+  801452:	89 f8                	mov    %edi,%eax
+  801454:	e8 af fd ff ff       	call   801208 <duppage>
+  801459:	85 c0                	test   %eax,%eax
+  80145b:	79 28                	jns    801485 <fork+0xe2>
+  80145d:	89 c7                	mov    %eax,%edi
+  80145f:	e9 32 01 00 00       	jmp    801596 <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  801464:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  80146a:	83 f9 05             	cmp    $0x5,%ecx
+  80146d:	75 58                	jne    8014c7 <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  80146f:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801474:	89 da                	mov    %ebx,%edx
+  801476:	89 f8                	mov    %edi,%eax
+  801478:	e8 8b fd ff ff       	call   801208 <duppage>
+  80147d:	85 c0                	test   %eax,%eax
+  80147f:	0f 88 0f 01 00 00    	js     801594 <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  801485:	83 c3 01             	add    $0x1,%ebx
+  801488:	39 de                	cmp    %ebx,%esi
+  80148a:	74 54                	je     8014e0 <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  80148c:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  801493:	f6 c1 05             	test   $0x5,%cl
+  801496:	74 ed                	je     801485 <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  801498:	f6 c5 04             	test   $0x4,%ch
+  80149b:	75 ad                	jne    80144a <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  80149d:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  8014a3:	74 bf                	je     801464 <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  8014a5:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8014ab:	74 d8                	je     801485 <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  8014ad:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  8014b3:	89 da                	mov    %ebx,%edx
+  8014b5:	89 f8                	mov    %edi,%eax
+  8014b7:	e8 cd fc ff ff       	call   801189 <duppage_cow>
+  8014bc:	85 c0                	test   %eax,%eax
+  8014be:	79 c5                	jns    801485 <fork+0xe2>
+  8014c0:	89 c7                	mov    %eax,%edi
+  8014c2:	e9 cf 00 00 00       	jmp    801596 <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  8014c7:	68 ac 4c 80 00       	push   $0x804cac
+  8014cc:	68 71 4d 80 00       	push   $0x804d71
+  8014d1:	68 c6 00 00 00       	push   $0xc6
+  8014d6:	68 56 4d 80 00       	push   $0x804d56
+  8014db:	e8 0a ed ff ff       	call   8001ea <_panic>
+  8014e0:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8014e3:	83 c1 01             	add    $0x1,%ecx
+  8014e6:	81 c6 00 04 00 00    	add    $0x400,%esi
+  8014ec:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  8014f2:	74 18                	je     80150c <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  8014f4:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  8014fb:	a8 07                	test   $0x7,%al
+  8014fd:	74 e4                	je     8014e3 <fork+0x140>
+  8014ff:	89 cb                	mov    %ecx,%ebx
+  801501:	c1 e3 0a             	shl    $0xa,%ebx
+  801504:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801507:	e9 7c ff ff ff       	jmp    801488 <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  80150c:	83 ec 04             	sub    $0x4,%esp
+  80150f:	6a 07                	push   $0x7
+  801511:	68 00 f0 bf ee       	push   $0xeebff000
+  801516:	ff 75 e4             	push   -0x1c(%ebp)
+  801519:	e8 c9 f7 ff ff       	call   800ce7 <sys_page_alloc>
+  80151e:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801520:	83 c4 10             	add    $0x10,%esp
+  801523:	85 c0                	test   %eax,%eax
+  801525:	78 34                	js     80155b <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  801527:	83 ec 08             	sub    $0x8,%esp
+  80152a:	68 7b 43 80 00       	push   $0x80437b
+  80152f:	ff 75 e4             	push   -0x1c(%ebp)
+  801532:	e8 2d f9 ff ff       	call   800e64 <sys_env_set_pgfault_upcall>
+  801537:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801539:	83 c4 10             	add    $0x10,%esp
+  80153c:	85 c0                	test   %eax,%eax
+  80153e:	78 2e                	js     80156e <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  801540:	83 ec 08             	sub    $0x8,%esp
+  801543:	6a 02                	push   $0x2
+  801545:	ff 75 e4             	push   -0x1c(%ebp)
+  801548:	e8 7f f8 ff ff       	call   800dcc <sys_env_set_status>
+  80154d:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80154f:	83 c4 10             	add    $0x10,%esp
+  801552:	85 c0                	test   %eax,%eax
+  801554:	78 2b                	js     801581 <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  801556:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801559:	eb 3b                	jmp    801596 <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  80155b:	83 ec 08             	sub    $0x8,%esp
+  80155e:	50                   	push   %eax
+  80155f:	68 d4 4c 80 00       	push   $0x804cd4
+  801564:	e8 5c ed ff ff       	call   8002c5 <cprintf>
+		return r;
+  801569:	83 c4 10             	add    $0x10,%esp
+  80156c:	eb 28                	jmp    801596 <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  80156e:	83 ec 08             	sub    $0x8,%esp
+  801571:	50                   	push   %eax
+  801572:	68 fc 4c 80 00       	push   $0x804cfc
+  801577:	e8 49 ed ff ff       	call   8002c5 <cprintf>
+		return r;
+  80157c:	83 c4 10             	add    $0x10,%esp
+  80157f:	eb 15                	jmp    801596 <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  801581:	83 ec 08             	sub    $0x8,%esp
+  801584:	50                   	push   %eax
+  801585:	68 86 4d 80 00       	push   $0x804d86
+  80158a:	e8 36 ed ff ff       	call   8002c5 <cprintf>
+		return r;
+  80158f:	83 c4 10             	add    $0x10,%esp
+  801592:	eb 02                	jmp    801596 <fork+0x1f3>
+  801594:	89 c7                	mov    %eax,%edi
+}
+  801596:	89 f8                	mov    %edi,%eax
+  801598:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80159b:	5b                   	pop    %ebx
+  80159c:	5e                   	pop    %esi
+  80159d:	5f                   	pop    %edi
+  80159e:	5d                   	pop    %ebp
+  80159f:	c3                   	ret
+
+008015a0 <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  8015a0:	55                   	push   %ebp
+  8015a1:	89 e5                	mov    %esp,%ebp
+  8015a3:	57                   	push   %edi
+  8015a4:	56                   	push   %esi
+  8015a5:	53                   	push   %ebx
+  8015a6:	83 ec 2c             	sub    $0x2c,%esp
+  8015a9:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8015ab:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  8015b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8015b6:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8015bc:	77 0a                	ja     8015c8 <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8015be:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  8015c3:	29 c3                	sub    %eax,%ebx
+  8015c5:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  8015c8:	83 ec 0c             	sub    $0xc,%esp
+  8015cb:	68 06 13 80 00       	push   $0x801306
+  8015d0:	e8 68 2d 00 00       	call   80433d <set_pgfault_handler>
+  8015d5:	b8 07 00 00 00       	mov    $0x7,%eax
+  8015da:	cd 30                	int    $0x30
+  8015dc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  8015df:	83 c4 10             	add    $0x10,%esp
+  8015e2:	85 c0                	test   %eax,%eax
+  8015e4:	78 30                	js     801616 <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  8015e6:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8015ea:	74 42                	je     80162e <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  8015ec:	c1 e3 10             	shl    $0x10,%ebx
+  8015ef:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  8015f4:	29 d8                	sub    %ebx,%eax
+  8015f6:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8015f9:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  8015fe:	29 d8                	sub    %ebx,%eax
+  801600:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801603:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  801608:	ba 00 00 00 00       	mov    $0x0,%edx
+  80160d:	89 f7                	mov    %esi,%edi
+  80160f:	89 d6                	mov    %edx,%esi
+  801611:	e9 2c 01 00 00       	jmp    801742 <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  801616:	83 ec 08             	sub    $0x8,%esp
+  801619:	89 c7                	mov    %eax,%edi
+  80161b:	50                   	push   %eax
+  80161c:	68 61 4d 80 00       	push   $0x804d61
+  801621:	e8 9f ec ff ff       	call   8002c5 <cprintf>
+		return eid;
+  801626:	83 c4 10             	add    $0x10,%esp
+  801629:	e9 d5 00 00 00       	jmp    801703 <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80162e:	e8 5c f6 ff ff       	call   800c8f <sys_getenvid>
+  801633:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801638:	89 c2                	mov    %eax,%edx
+  80163a:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80163c:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  801642:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801647:	77 18                	ja     801661 <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801649:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80164e:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  801650:	c1 e8 10             	shr    $0x10,%eax
+  801653:	74 0c                	je     801661 <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801655:	c1 e0 10             	shl    $0x10,%eax
+  801658:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80165d:	29 c1                	sub    %eax,%ecx
+  80165f:	eb 06                	jmp    801667 <sfork+0xc7>
+		return pthread_main_tls;
+  801661:	8b 0d c4 62 80 00    	mov    0x8062c4,%ecx
+  801667:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80166a:	c1 e0 04             	shl    $0x4,%eax
+  80166d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801672:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  801674:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801677:	e9 87 00 00 00       	jmp    801703 <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  80167c:	f6 c5 04             	test   $0x4,%ch
+  80167f:	74 6c                	je     8016ed <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  801681:	89 ca                	mov    %ecx,%edx
+  801683:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  801689:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  80168f:	74 7c                	je     80170d <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  801691:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  801697:	89 da                	mov    %ebx,%edx
+  801699:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80169c:	e8 67 fb ff ff       	call   801208 <duppage>
+  8016a1:	85 c0                	test   %eax,%eax
+  8016a3:	0f 88 4f 01 00 00    	js     8017f8 <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  8016a9:	83 c3 01             	add    $0x1,%ebx
+  8016ac:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  8016af:	74 7a                	je     80172b <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  8016b1:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  8016b3:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  8016ba:	f6 c1 01             	test   $0x1,%cl
+  8016bd:	74 ea                	je     8016a9 <sfork+0x109>
+  8016bf:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8016c5:	74 e2                	je     8016a9 <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  8016c7:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  8016cd:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  8016d0:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  8016d5:	76 a5                	jbe    80167c <sfork+0xdc>
+  8016d7:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  8016dd:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8016e0:	39 fa                	cmp    %edi,%edx
+  8016e2:	73 9d                	jae    801681 <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  8016e4:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  8016e7:	39 fa                	cmp    %edi,%edx
+  8016e9:	72 96                	jb     801681 <sfork+0xe1>
+  8016eb:	eb 8f                	jmp    80167c <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8016ed:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8016f3:	89 da                	mov    %ebx,%edx
+  8016f5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8016f8:	e8 8c fa ff ff       	call   801189 <duppage_cow>
+  8016fd:	85 c0                	test   %eax,%eax
+  8016ff:	79 a8                	jns    8016a9 <sfork+0x109>
+  801701:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  801703:	89 f8                	mov    %edi,%eax
+  801705:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801708:	5b                   	pop    %ebx
+  801709:	5e                   	pop    %esi
+  80170a:	5f                   	pop    %edi
+  80170b:	5d                   	pop    %ebp
+  80170c:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  80170d:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  801712:	e8 2e fb ff ff       	call   801245 <cow_copy>
+  801717:	85 c0                	test   %eax,%eax
+  801719:	0f 88 d2 00 00 00    	js     8017f1 <sfork+0x251>
+				pte = uvpt[pn];
+  80171f:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  801726:	e9 66 ff ff ff       	jmp    801691 <sfork+0xf1>
+  80172b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80172e:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  801731:	83 c6 01             	add    $0x1,%esi
+  801734:	81 c7 00 04 00 00    	add    $0x400,%edi
+  80173a:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  801740:	74 1b                	je     80175d <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  801742:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  801749:	a8 01                	test   $0x1,%al
+  80174b:	74 e4                	je     801731 <sfork+0x191>
+  80174d:	89 f3                	mov    %esi,%ebx
+  80174f:	c1 e3 0a             	shl    $0xa,%ebx
+  801752:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  801755:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  801758:	e9 4f ff ff ff       	jmp    8016ac <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  80175d:	83 ec 04             	sub    $0x4,%esp
+  801760:	6a 07                	push   $0x7
+  801762:	68 00 f0 bf ee       	push   $0xeebff000
+  801767:	ff 75 e0             	push   -0x20(%ebp)
+  80176a:	e8 78 f5 ff ff       	call   800ce7 <sys_page_alloc>
+  80176f:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801771:	83 c4 10             	add    $0x10,%esp
+  801774:	85 c0                	test   %eax,%eax
+  801776:	78 37                	js     8017af <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  801778:	83 ec 08             	sub    $0x8,%esp
+  80177b:	68 7b 43 80 00       	push   $0x80437b
+  801780:	ff 75 e0             	push   -0x20(%ebp)
+  801783:	e8 dc f6 ff ff       	call   800e64 <sys_env_set_pgfault_upcall>
+  801788:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80178a:	83 c4 10             	add    $0x10,%esp
+  80178d:	85 c0                	test   %eax,%eax
+  80178f:	78 34                	js     8017c5 <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  801791:	83 ec 08             	sub    $0x8,%esp
+  801794:	6a 02                	push   $0x2
+  801796:	ff 75 e0             	push   -0x20(%ebp)
+  801799:	e8 2e f6 ff ff       	call   800dcc <sys_env_set_status>
+  80179e:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8017a0:	83 c4 10             	add    $0x10,%esp
+  8017a3:	85 c0                	test   %eax,%eax
+  8017a5:	78 34                	js     8017db <sfork+0x23b>
+	return eid;
+  8017a7:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8017aa:	e9 54 ff ff ff       	jmp    801703 <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  8017af:	83 ec 08             	sub    $0x8,%esp
+  8017b2:	50                   	push   %eax
+  8017b3:	68 d4 4c 80 00       	push   $0x804cd4
+  8017b8:	e8 08 eb ff ff       	call   8002c5 <cprintf>
+		return r;
+  8017bd:	83 c4 10             	add    $0x10,%esp
+  8017c0:	e9 3e ff ff ff       	jmp    801703 <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  8017c5:	83 ec 08             	sub    $0x8,%esp
+  8017c8:	50                   	push   %eax
+  8017c9:	68 fc 4c 80 00       	push   $0x804cfc
+  8017ce:	e8 f2 ea ff ff       	call   8002c5 <cprintf>
+		return r;
+  8017d3:	83 c4 10             	add    $0x10,%esp
+  8017d6:	e9 28 ff ff ff       	jmp    801703 <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  8017db:	83 ec 08             	sub    $0x8,%esp
+  8017de:	50                   	push   %eax
+  8017df:	68 86 4d 80 00       	push   $0x804d86
+  8017e4:	e8 dc ea ff ff       	call   8002c5 <cprintf>
+		return r;
+  8017e9:	83 c4 10             	add    $0x10,%esp
+  8017ec:	e9 12 ff ff ff       	jmp    801703 <sfork+0x163>
+  8017f1:	89 c7                	mov    %eax,%edi
+  8017f3:	e9 0b ff ff ff       	jmp    801703 <sfork+0x163>
+  8017f8:	89 c7                	mov    %eax,%edi
+  8017fa:	e9 04 ff ff ff       	jmp    801703 <sfork+0x163>
+
+008017ff <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8017ff:	55                   	push   %ebp
+  801800:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801802:	8b 45 08             	mov    0x8(%ebp),%eax
+  801805:	05 00 00 00 30       	add    $0x30000000,%eax
+  80180a:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80180d:	5d                   	pop    %ebp
+  80180e:	c3                   	ret
+
+0080180f <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80180f:	55                   	push   %ebp
+  801810:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801812:	8b 45 08             	mov    0x8(%ebp),%eax
+  801815:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80181a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80181f:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801824:	5d                   	pop    %ebp
+  801825:	c3                   	ret
+
+00801826 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801826:	55                   	push   %ebp
+  801827:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801829:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80182e:	eb 02                	jmp    801832 <fd_alloc+0xc>
+  801830:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801832:	89 c2                	mov    %eax,%edx
+  801834:	c1 ea 16             	shr    $0x16,%edx
+  801837:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80183e:	f6 c2 01             	test   $0x1,%dl
+  801841:	74 2b                	je     80186e <fd_alloc+0x48>
+  801843:	89 c2                	mov    %eax,%edx
+  801845:	c1 ea 0c             	shr    $0xc,%edx
+  801848:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80184f:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801855:	f6 c1 01             	test   $0x1,%cl
+  801858:	74 14                	je     80186e <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80185a:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801860:	75 ce                	jne    801830 <fd_alloc+0xa>
+  801862:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801867:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80186c:	eb 05                	jmp    801873 <fd_alloc+0x4d>
+			return 0;
+  80186e:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801873:	8b 55 08             	mov    0x8(%ebp),%edx
+  801876:	89 02                	mov    %eax,(%edx)
+}
+  801878:	89 c8                	mov    %ecx,%eax
+  80187a:	5d                   	pop    %ebp
+  80187b:	c3                   	ret
+
+0080187c <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80187c:	55                   	push   %ebp
+  80187d:	89 e5                	mov    %esp,%ebp
+  80187f:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801882:	83 f8 1f             	cmp    $0x1f,%eax
+  801885:	77 30                	ja     8018b7 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801887:	c1 e0 0c             	shl    $0xc,%eax
+  80188a:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80188f:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801895:	f6 c2 01             	test   $0x1,%dl
+  801898:	74 24                	je     8018be <fd_lookup+0x42>
+  80189a:	89 c2                	mov    %eax,%edx
+  80189c:	c1 ea 0c             	shr    $0xc,%edx
+  80189f:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8018a6:	f6 c2 01             	test   $0x1,%dl
+  8018a9:	74 1a                	je     8018c5 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8018ab:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8018ae:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8018b0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018b5:	5d                   	pop    %ebp
+  8018b6:	c3                   	ret
+		return -E_INVAL;
+  8018b7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018bc:	eb f7                	jmp    8018b5 <fd_lookup+0x39>
+		return -E_INVAL;
+  8018be:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018c3:	eb f0                	jmp    8018b5 <fd_lookup+0x39>
+  8018c5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018ca:	eb e9                	jmp    8018b5 <fd_lookup+0x39>
+
+008018cc <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8018cc:	55                   	push   %ebp
+  8018cd:	89 e5                	mov    %esp,%ebp
+  8018cf:	53                   	push   %ebx
+  8018d0:	83 ec 04             	sub    $0x4,%esp
+  8018d3:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8018d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018db:	eb 03                	jmp    8018e0 <dev_lookup+0x14>
+  8018dd:	83 c0 01             	add    $0x1,%eax
+  8018e0:	8b 1c 85 20 4e 80 00 	mov    0x804e20(,%eax,4),%ebx
+  8018e7:	85 db                	test   %ebx,%ebx
+  8018e9:	74 0b                	je     8018f6 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8018eb:	39 13                	cmp    %edx,(%ebx)
+  8018ed:	75 ee                	jne    8018dd <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8018ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018f4:	eb 49                	jmp    80193f <dev_lookup+0x73>
+  8018f6:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8018f8:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  8018fe:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801903:	77 18                	ja     80191d <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801905:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80190a:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  80190c:	c1 e8 10             	shr    $0x10,%eax
+  80190f:	74 0c                	je     80191d <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801911:	c1 e0 10             	shl    $0x10,%eax
+  801914:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  801919:	29 c1                	sub    %eax,%ecx
+  80191b:	eb 06                	jmp    801923 <dev_lookup+0x57>
+		return pthread_main_tls;
+  80191d:	8b 0d c4 62 80 00    	mov    0x8062c4,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801923:	8b 01                	mov    (%ecx),%eax
+  801925:	8b 40 48             	mov    0x48(%eax),%eax
+  801928:	83 ec 04             	sub    $0x4,%esp
+  80192b:	52                   	push   %edx
+  80192c:	50                   	push   %eax
+  80192d:	68 a4 4d 80 00       	push   $0x804da4
+  801932:	e8 8e e9 ff ff       	call   8002c5 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801937:	83 c4 10             	add    $0x10,%esp
+  80193a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80193f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801942:	89 1a                	mov    %ebx,(%edx)
+}
+  801944:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801947:	c9                   	leave
+  801948:	c3                   	ret
+
+00801949 <fd_close>:
+{
+  801949:	55                   	push   %ebp
+  80194a:	89 e5                	mov    %esp,%ebp
+  80194c:	57                   	push   %edi
+  80194d:	56                   	push   %esi
+  80194e:	53                   	push   %ebx
+  80194f:	83 ec 24             	sub    $0x24,%esp
+  801952:	8b 75 08             	mov    0x8(%ebp),%esi
+  801955:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801958:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80195b:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80195c:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801962:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801965:	50                   	push   %eax
+  801966:	e8 11 ff ff ff       	call   80187c <fd_lookup>
+  80196b:	89 c3                	mov    %eax,%ebx
+  80196d:	83 c4 10             	add    $0x10,%esp
+  801970:	85 c0                	test   %eax,%eax
+  801972:	78 05                	js     801979 <fd_close+0x30>
+	    || fd != fd2)
+  801974:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801977:	74 16                	je     80198f <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801979:	89 f8                	mov    %edi,%eax
+  80197b:	84 c0                	test   %al,%al
+  80197d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801982:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801985:	89 d8                	mov    %ebx,%eax
+  801987:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80198a:	5b                   	pop    %ebx
+  80198b:	5e                   	pop    %esi
+  80198c:	5f                   	pop    %edi
+  80198d:	5d                   	pop    %ebp
+  80198e:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80198f:	83 ec 08             	sub    $0x8,%esp
+  801992:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801995:	50                   	push   %eax
+  801996:	ff 36                	push   (%esi)
+  801998:	e8 2f ff ff ff       	call   8018cc <dev_lookup>
+  80199d:	89 c3                	mov    %eax,%ebx
+  80199f:	83 c4 10             	add    $0x10,%esp
+  8019a2:	85 c0                	test   %eax,%eax
+  8019a4:	78 1a                	js     8019c0 <fd_close+0x77>
+		if (dev->dev_close)
+  8019a6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8019a9:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8019ac:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8019b1:	85 c0                	test   %eax,%eax
+  8019b3:	74 0b                	je     8019c0 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8019b5:	83 ec 0c             	sub    $0xc,%esp
+  8019b8:	56                   	push   %esi
+  8019b9:	ff d0                	call   *%eax
+  8019bb:	89 c3                	mov    %eax,%ebx
+  8019bd:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8019c0:	83 ec 08             	sub    $0x8,%esp
+  8019c3:	56                   	push   %esi
+  8019c4:	6a 00                	push   $0x0
+  8019c6:	e8 b5 f3 ff ff       	call   800d80 <sys_page_unmap>
+	return r;
+  8019cb:	83 c4 10             	add    $0x10,%esp
+  8019ce:	eb b5                	jmp    801985 <fd_close+0x3c>
+
+008019d0 <close>:
+
+int
+close(int fdnum)
+{
+  8019d0:	55                   	push   %ebp
+  8019d1:	89 e5                	mov    %esp,%ebp
+  8019d3:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8019d6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019d9:	50                   	push   %eax
+  8019da:	ff 75 08             	push   0x8(%ebp)
+  8019dd:	e8 9a fe ff ff       	call   80187c <fd_lookup>
+  8019e2:	83 c4 10             	add    $0x10,%esp
+  8019e5:	85 c0                	test   %eax,%eax
+  8019e7:	79 02                	jns    8019eb <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8019e9:	c9                   	leave
+  8019ea:	c3                   	ret
+		return fd_close(fd, 1);
+  8019eb:	83 ec 08             	sub    $0x8,%esp
+  8019ee:	6a 01                	push   $0x1
+  8019f0:	ff 75 f4             	push   -0xc(%ebp)
+  8019f3:	e8 51 ff ff ff       	call   801949 <fd_close>
+  8019f8:	83 c4 10             	add    $0x10,%esp
+  8019fb:	eb ec                	jmp    8019e9 <close+0x19>
+
+008019fd <close_all>:
+
+void
+close_all(void)
+{
+  8019fd:	55                   	push   %ebp
+  8019fe:	89 e5                	mov    %esp,%ebp
+  801a00:	53                   	push   %ebx
+  801a01:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801a04:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801a09:	83 ec 0c             	sub    $0xc,%esp
+  801a0c:	53                   	push   %ebx
+  801a0d:	e8 be ff ff ff       	call   8019d0 <close>
+	for (i = 0; i < MAXFD; i++)
+  801a12:	83 c3 01             	add    $0x1,%ebx
+  801a15:	83 c4 10             	add    $0x10,%esp
+  801a18:	83 fb 20             	cmp    $0x20,%ebx
+  801a1b:	75 ec                	jne    801a09 <close_all+0xc>
+}
+  801a1d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a20:	c9                   	leave
+  801a21:	c3                   	ret
+
+00801a22 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801a22:	55                   	push   %ebp
+  801a23:	89 e5                	mov    %esp,%ebp
+  801a25:	57                   	push   %edi
+  801a26:	56                   	push   %esi
+  801a27:	53                   	push   %ebx
+  801a28:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801a2b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801a2e:	50                   	push   %eax
+  801a2f:	ff 75 08             	push   0x8(%ebp)
+  801a32:	e8 45 fe ff ff       	call   80187c <fd_lookup>
+  801a37:	89 c3                	mov    %eax,%ebx
+  801a39:	83 c4 10             	add    $0x10,%esp
+  801a3c:	85 c0                	test   %eax,%eax
+  801a3e:	78 7f                	js     801abf <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801a40:	83 ec 0c             	sub    $0xc,%esp
+  801a43:	ff 75 0c             	push   0xc(%ebp)
+  801a46:	e8 85 ff ff ff       	call   8019d0 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801a4b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801a4e:	c1 e6 0c             	shl    $0xc,%esi
+  801a51:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801a57:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801a5a:	89 3c 24             	mov    %edi,(%esp)
+  801a5d:	e8 ad fd ff ff       	call   80180f <fd2data>
+  801a62:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801a64:	89 34 24             	mov    %esi,(%esp)
+  801a67:	e8 a3 fd ff ff       	call   80180f <fd2data>
+  801a6c:	83 c4 10             	add    $0x10,%esp
+  801a6f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801a72:	89 d8                	mov    %ebx,%eax
+  801a74:	c1 e8 16             	shr    $0x16,%eax
+  801a77:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801a7e:	a8 01                	test   $0x1,%al
+  801a80:	74 11                	je     801a93 <dup+0x71>
+  801a82:	89 d8                	mov    %ebx,%eax
+  801a84:	c1 e8 0c             	shr    $0xc,%eax
+  801a87:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801a8e:	f6 c2 01             	test   $0x1,%dl
+  801a91:	75 36                	jne    801ac9 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801a93:	89 f8                	mov    %edi,%eax
+  801a95:	c1 e8 0c             	shr    $0xc,%eax
+  801a98:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a9f:	83 ec 0c             	sub    $0xc,%esp
+  801aa2:	25 07 0e 00 00       	and    $0xe07,%eax
+  801aa7:	50                   	push   %eax
+  801aa8:	56                   	push   %esi
+  801aa9:	6a 00                	push   $0x0
+  801aab:	57                   	push   %edi
+  801aac:	6a 00                	push   $0x0
+  801aae:	e8 81 f2 ff ff       	call   800d34 <sys_page_map>
+  801ab3:	89 c3                	mov    %eax,%ebx
+  801ab5:	83 c4 20             	add    $0x20,%esp
+  801ab8:	85 c0                	test   %eax,%eax
+  801aba:	78 33                	js     801aef <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801abc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801abf:	89 d8                	mov    %ebx,%eax
+  801ac1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ac4:	5b                   	pop    %ebx
+  801ac5:	5e                   	pop    %esi
+  801ac6:	5f                   	pop    %edi
+  801ac7:	5d                   	pop    %ebp
+  801ac8:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801ac9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801ad0:	83 ec 0c             	sub    $0xc,%esp
+  801ad3:	25 07 0e 00 00       	and    $0xe07,%eax
+  801ad8:	50                   	push   %eax
+  801ad9:	ff 75 d4             	push   -0x2c(%ebp)
+  801adc:	6a 00                	push   $0x0
+  801ade:	53                   	push   %ebx
+  801adf:	6a 00                	push   $0x0
+  801ae1:	e8 4e f2 ff ff       	call   800d34 <sys_page_map>
+  801ae6:	89 c3                	mov    %eax,%ebx
+  801ae8:	83 c4 20             	add    $0x20,%esp
+  801aeb:	85 c0                	test   %eax,%eax
+  801aed:	79 a4                	jns    801a93 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801aef:	83 ec 08             	sub    $0x8,%esp
+  801af2:	56                   	push   %esi
+  801af3:	6a 00                	push   $0x0
+  801af5:	e8 86 f2 ff ff       	call   800d80 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801afa:	83 c4 08             	add    $0x8,%esp
+  801afd:	ff 75 d4             	push   -0x2c(%ebp)
+  801b00:	6a 00                	push   $0x0
+  801b02:	e8 79 f2 ff ff       	call   800d80 <sys_page_unmap>
+	return r;
+  801b07:	83 c4 10             	add    $0x10,%esp
+  801b0a:	eb b3                	jmp    801abf <dup+0x9d>
+
+00801b0c <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801b0c:	55                   	push   %ebp
+  801b0d:	89 e5                	mov    %esp,%ebp
+  801b0f:	56                   	push   %esi
+  801b10:	53                   	push   %ebx
+  801b11:	83 ec 18             	sub    $0x18,%esp
+  801b14:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b17:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b1a:	50                   	push   %eax
+  801b1b:	53                   	push   %ebx
+  801b1c:	e8 5b fd ff ff       	call   80187c <fd_lookup>
+  801b21:	83 c4 10             	add    $0x10,%esp
+  801b24:	85 c0                	test   %eax,%eax
+  801b26:	78 3c                	js     801b64 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801b28:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b2b:	83 ec 08             	sub    $0x8,%esp
+  801b2e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b31:	50                   	push   %eax
+  801b32:	ff 36                	push   (%esi)
+  801b34:	e8 93 fd ff ff       	call   8018cc <dev_lookup>
+  801b39:	83 c4 10             	add    $0x10,%esp
+  801b3c:	85 c0                	test   %eax,%eax
+  801b3e:	78 24                	js     801b64 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801b40:	8b 46 08             	mov    0x8(%esi),%eax
+  801b43:	83 e0 03             	and    $0x3,%eax
+  801b46:	83 f8 01             	cmp    $0x1,%eax
+  801b49:	74 20                	je     801b6b <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801b4b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b4e:	8b 40 08             	mov    0x8(%eax),%eax
+  801b51:	85 c0                	test   %eax,%eax
+  801b53:	74 61                	je     801bb6 <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801b55:	83 ec 04             	sub    $0x4,%esp
+  801b58:	ff 75 10             	push   0x10(%ebp)
+  801b5b:	ff 75 0c             	push   0xc(%ebp)
+  801b5e:	56                   	push   %esi
+  801b5f:	ff d0                	call   *%eax
+  801b61:	83 c4 10             	add    $0x10,%esp
+}
+  801b64:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b67:	5b                   	pop    %ebx
+  801b68:	5e                   	pop    %esi
+  801b69:	5d                   	pop    %ebp
+  801b6a:	c3                   	ret
+  801b6b:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801b6d:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801b73:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801b78:	77 18                	ja     801b92 <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801b7a:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801b7f:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801b81:	c1 e8 10             	shr    $0x10,%eax
+  801b84:	74 0c                	je     801b92 <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801b86:	c1 e0 10             	shl    $0x10,%eax
+  801b89:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801b8e:	29 c2                	sub    %eax,%edx
+  801b90:	eb 06                	jmp    801b98 <read+0x8c>
+		return pthread_main_tls;
+  801b92:	8b 15 c4 62 80 00    	mov    0x8062c4,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b98:	8b 02                	mov    (%edx),%eax
+  801b9a:	8b 40 48             	mov    0x48(%eax),%eax
+  801b9d:	83 ec 04             	sub    $0x4,%esp
+  801ba0:	53                   	push   %ebx
+  801ba1:	50                   	push   %eax
+  801ba2:	68 e5 4d 80 00       	push   $0x804de5
+  801ba7:	e8 19 e7 ff ff       	call   8002c5 <cprintf>
+		return -E_INVAL;
+  801bac:	83 c4 10             	add    $0x10,%esp
+  801baf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801bb4:	eb ae                	jmp    801b64 <read+0x58>
+		return -E_NOT_SUPP;
+  801bb6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801bbb:	eb a7                	jmp    801b64 <read+0x58>
+
+00801bbd <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801bbd:	55                   	push   %ebp
+  801bbe:	89 e5                	mov    %esp,%ebp
+  801bc0:	57                   	push   %edi
+  801bc1:	56                   	push   %esi
+  801bc2:	53                   	push   %ebx
+  801bc3:	83 ec 0c             	sub    $0xc,%esp
+  801bc6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801bc9:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801bcc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bd1:	eb 02                	jmp    801bd5 <readn+0x18>
+  801bd3:	01 c3                	add    %eax,%ebx
+  801bd5:	39 f3                	cmp    %esi,%ebx
+  801bd7:	73 21                	jae    801bfa <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801bd9:	83 ec 04             	sub    $0x4,%esp
+  801bdc:	89 f0                	mov    %esi,%eax
+  801bde:	29 d8                	sub    %ebx,%eax
+  801be0:	50                   	push   %eax
+  801be1:	89 d8                	mov    %ebx,%eax
+  801be3:	03 45 0c             	add    0xc(%ebp),%eax
+  801be6:	50                   	push   %eax
+  801be7:	57                   	push   %edi
+  801be8:	e8 1f ff ff ff       	call   801b0c <read>
+		if (m < 0)
+  801bed:	83 c4 10             	add    $0x10,%esp
+  801bf0:	85 c0                	test   %eax,%eax
+  801bf2:	78 04                	js     801bf8 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801bf4:	75 dd                	jne    801bd3 <readn+0x16>
+  801bf6:	eb 02                	jmp    801bfa <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801bf8:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801bfa:	89 d8                	mov    %ebx,%eax
+  801bfc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bff:	5b                   	pop    %ebx
+  801c00:	5e                   	pop    %esi
+  801c01:	5f                   	pop    %edi
+  801c02:	5d                   	pop    %ebp
+  801c03:	c3                   	ret
+
+00801c04 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801c04:	55                   	push   %ebp
+  801c05:	89 e5                	mov    %esp,%ebp
+  801c07:	56                   	push   %esi
+  801c08:	53                   	push   %ebx
+  801c09:	83 ec 18             	sub    $0x18,%esp
+  801c0c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c0f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c12:	50                   	push   %eax
+  801c13:	53                   	push   %ebx
+  801c14:	e8 63 fc ff ff       	call   80187c <fd_lookup>
+  801c19:	83 c4 10             	add    $0x10,%esp
+  801c1c:	85 c0                	test   %eax,%eax
+  801c1e:	78 37                	js     801c57 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c20:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c23:	83 ec 08             	sub    $0x8,%esp
+  801c26:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c29:	50                   	push   %eax
+  801c2a:	ff 36                	push   (%esi)
+  801c2c:	e8 9b fc ff ff       	call   8018cc <dev_lookup>
+  801c31:	83 c4 10             	add    $0x10,%esp
+  801c34:	85 c0                	test   %eax,%eax
+  801c36:	78 1f                	js     801c57 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c38:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801c3c:	74 20                	je     801c5e <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801c3e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c41:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c44:	85 c0                	test   %eax,%eax
+  801c46:	74 61                	je     801ca9 <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801c48:	83 ec 04             	sub    $0x4,%esp
+  801c4b:	ff 75 10             	push   0x10(%ebp)
+  801c4e:	ff 75 0c             	push   0xc(%ebp)
+  801c51:	56                   	push   %esi
+  801c52:	ff d0                	call   *%eax
+  801c54:	83 c4 10             	add    $0x10,%esp
+}
+  801c57:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c5a:	5b                   	pop    %ebx
+  801c5b:	5e                   	pop    %esi
+  801c5c:	5d                   	pop    %ebp
+  801c5d:	c3                   	ret
+  801c5e:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801c60:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801c66:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801c6b:	77 18                	ja     801c85 <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801c6d:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801c72:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801c74:	c1 e8 10             	shr    $0x10,%eax
+  801c77:	74 0c                	je     801c85 <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801c79:	c1 e0 10             	shl    $0x10,%eax
+  801c7c:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801c81:	29 c2                	sub    %eax,%edx
+  801c83:	eb 06                	jmp    801c8b <write+0x87>
+		return pthread_main_tls;
+  801c85:	8b 15 c4 62 80 00    	mov    0x8062c4,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c8b:	8b 02                	mov    (%edx),%eax
+  801c8d:	8b 40 48             	mov    0x48(%eax),%eax
+  801c90:	83 ec 04             	sub    $0x4,%esp
+  801c93:	53                   	push   %ebx
+  801c94:	50                   	push   %eax
+  801c95:	68 01 4e 80 00       	push   $0x804e01
+  801c9a:	e8 26 e6 ff ff       	call   8002c5 <cprintf>
+		return -E_INVAL;
+  801c9f:	83 c4 10             	add    $0x10,%esp
+  801ca2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ca7:	eb ae                	jmp    801c57 <write+0x53>
+		return -E_NOT_SUPP;
+  801ca9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801cae:	eb a7                	jmp    801c57 <write+0x53>
+
+00801cb0 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801cb0:	55                   	push   %ebp
+  801cb1:	89 e5                	mov    %esp,%ebp
+  801cb3:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801cb6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cb9:	50                   	push   %eax
+  801cba:	ff 75 08             	push   0x8(%ebp)
+  801cbd:	e8 ba fb ff ff       	call   80187c <fd_lookup>
+  801cc2:	83 c4 10             	add    $0x10,%esp
+  801cc5:	85 c0                	test   %eax,%eax
+  801cc7:	78 0e                	js     801cd7 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801cc9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ccc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ccf:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801cd2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801cd7:	c9                   	leave
+  801cd8:	c3                   	ret
+
+00801cd9 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801cd9:	55                   	push   %ebp
+  801cda:	89 e5                	mov    %esp,%ebp
+  801cdc:	56                   	push   %esi
+  801cdd:	53                   	push   %ebx
+  801cde:	83 ec 18             	sub    $0x18,%esp
+  801ce1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ce4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ce7:	50                   	push   %eax
+  801ce8:	53                   	push   %ebx
+  801ce9:	e8 8e fb ff ff       	call   80187c <fd_lookup>
+  801cee:	83 c4 10             	add    $0x10,%esp
+  801cf1:	85 c0                	test   %eax,%eax
+  801cf3:	78 34                	js     801d29 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801cf5:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801cf8:	83 ec 08             	sub    $0x8,%esp
+  801cfb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cfe:	50                   	push   %eax
+  801cff:	ff 36                	push   (%esi)
+  801d01:	e8 c6 fb ff ff       	call   8018cc <dev_lookup>
+  801d06:	83 c4 10             	add    $0x10,%esp
+  801d09:	85 c0                	test   %eax,%eax
+  801d0b:	78 1c                	js     801d29 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d0d:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801d11:	74 1d                	je     801d30 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801d13:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d16:	8b 40 18             	mov    0x18(%eax),%eax
+  801d19:	85 c0                	test   %eax,%eax
+  801d1b:	74 5e                	je     801d7b <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801d1d:	83 ec 08             	sub    $0x8,%esp
+  801d20:	ff 75 0c             	push   0xc(%ebp)
+  801d23:	56                   	push   %esi
+  801d24:	ff d0                	call   *%eax
+  801d26:	83 c4 10             	add    $0x10,%esp
+}
+  801d29:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d2c:	5b                   	pop    %ebx
+  801d2d:	5e                   	pop    %esi
+  801d2e:	5d                   	pop    %ebp
+  801d2f:	c3                   	ret
+  801d30:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801d32:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801d38:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801d3d:	77 18                	ja     801d57 <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801d3f:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801d44:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801d46:	c1 e8 10             	shr    $0x10,%eax
+  801d49:	74 0c                	je     801d57 <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801d4b:	c1 e0 10             	shl    $0x10,%eax
+  801d4e:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801d53:	29 c2                	sub    %eax,%edx
+  801d55:	eb 06                	jmp    801d5d <ftruncate+0x84>
+		return pthread_main_tls;
+  801d57:	8b 15 c4 62 80 00    	mov    0x8062c4,%edx
+			thisenv->env_id, fdnum);
+  801d5d:	8b 02                	mov    (%edx),%eax
+  801d5f:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801d62:	83 ec 04             	sub    $0x4,%esp
+  801d65:	53                   	push   %ebx
+  801d66:	50                   	push   %eax
+  801d67:	68 c4 4d 80 00       	push   $0x804dc4
+  801d6c:	e8 54 e5 ff ff       	call   8002c5 <cprintf>
+		return -E_INVAL;
+  801d71:	83 c4 10             	add    $0x10,%esp
+  801d74:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d79:	eb ae                	jmp    801d29 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801d7b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d80:	eb a7                	jmp    801d29 <ftruncate+0x50>
+
+00801d82 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801d82:	55                   	push   %ebp
+  801d83:	89 e5                	mov    %esp,%ebp
+  801d85:	56                   	push   %esi
+  801d86:	53                   	push   %ebx
+  801d87:	83 ec 18             	sub    $0x18,%esp
+  801d8a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d8d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d90:	50                   	push   %eax
+  801d91:	ff 75 08             	push   0x8(%ebp)
+  801d94:	e8 e3 fa ff ff       	call   80187c <fd_lookup>
+  801d99:	83 c4 10             	add    $0x10,%esp
+  801d9c:	85 c0                	test   %eax,%eax
+  801d9e:	78 49                	js     801de9 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801da0:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801da3:	83 ec 08             	sub    $0x8,%esp
+  801da6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801da9:	50                   	push   %eax
+  801daa:	ff 36                	push   (%esi)
+  801dac:	e8 1b fb ff ff       	call   8018cc <dev_lookup>
+  801db1:	83 c4 10             	add    $0x10,%esp
+  801db4:	85 c0                	test   %eax,%eax
+  801db6:	78 31                	js     801de9 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801db8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dbb:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801dbf:	74 2f                	je     801df0 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801dc1:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801dc4:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801dcb:	00 00 00 
+	stat->st_isdir = 0;
+  801dce:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801dd5:	00 00 00 
+	stat->st_dev = dev;
+  801dd8:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801dde:	83 ec 08             	sub    $0x8,%esp
+  801de1:	53                   	push   %ebx
+  801de2:	56                   	push   %esi
+  801de3:	ff 50 14             	call   *0x14(%eax)
+  801de6:	83 c4 10             	add    $0x10,%esp
+}
+  801de9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dec:	5b                   	pop    %ebx
+  801ded:	5e                   	pop    %esi
+  801dee:	5d                   	pop    %ebp
+  801def:	c3                   	ret
+		return -E_NOT_SUPP;
+  801df0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801df5:	eb f2                	jmp    801de9 <fstat+0x67>
+
+00801df7 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801df7:	55                   	push   %ebp
+  801df8:	89 e5                	mov    %esp,%ebp
+  801dfa:	56                   	push   %esi
+  801dfb:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801dfc:	83 ec 08             	sub    $0x8,%esp
+  801dff:	6a 00                	push   $0x0
+  801e01:	ff 75 08             	push   0x8(%ebp)
+  801e04:	e8 4b 03 00 00       	call   802154 <open>
+  801e09:	89 c3                	mov    %eax,%ebx
+  801e0b:	83 c4 10             	add    $0x10,%esp
+  801e0e:	85 c0                	test   %eax,%eax
+  801e10:	78 1b                	js     801e2d <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801e12:	83 ec 08             	sub    $0x8,%esp
+  801e15:	ff 75 0c             	push   0xc(%ebp)
+  801e18:	50                   	push   %eax
+  801e19:	e8 64 ff ff ff       	call   801d82 <fstat>
+  801e1e:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801e20:	89 1c 24             	mov    %ebx,(%esp)
+  801e23:	e8 a8 fb ff ff       	call   8019d0 <close>
+	return r;
+  801e28:	83 c4 10             	add    $0x10,%esp
+  801e2b:	89 f3                	mov    %esi,%ebx
+}
+  801e2d:	89 d8                	mov    %ebx,%eax
+  801e2f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e32:	5b                   	pop    %ebx
+  801e33:	5e                   	pop    %esi
+  801e34:	5d                   	pop    %ebp
+  801e35:	c3                   	ret
+
+00801e36 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801e36:	55                   	push   %ebp
+  801e37:	89 e5                	mov    %esp,%ebp
+  801e39:	56                   	push   %esi
+  801e3a:	53                   	push   %ebx
+  801e3b:	89 c6                	mov    %eax,%esi
+  801e3d:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801e3f:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  801e46:	74 27                	je     801e6f <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801e48:	6a 07                	push   $0x7
+  801e4a:	68 00 70 80 00       	push   $0x807000
+  801e4f:	56                   	push   %esi
+  801e50:	ff 35 00 60 80 00    	push   0x806000
+  801e56:	e8 3c 26 00 00       	call   804497 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801e5b:	83 c4 0c             	add    $0xc,%esp
+  801e5e:	6a 00                	push   $0x0
+  801e60:	53                   	push   %ebx
+  801e61:	6a 00                	push   $0x0
+  801e63:	e8 39 25 00 00       	call   8043a1 <ipc_recv>
+}
+  801e68:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e6b:	5b                   	pop    %ebx
+  801e6c:	5e                   	pop    %esi
+  801e6d:	5d                   	pop    %ebp
+  801e6e:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801e6f:	83 ec 0c             	sub    $0xc,%esp
+  801e72:	6a 01                	push   $0x1
+  801e74:	e8 74 26 00 00       	call   8044ed <ipc_find_env>
+  801e79:	a3 00 60 80 00       	mov    %eax,0x806000
+  801e7e:	83 c4 10             	add    $0x10,%esp
+  801e81:	eb c5                	jmp    801e48 <fsipc+0x12>
+
+00801e83 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801e83:	55                   	push   %ebp
+  801e84:	89 e5                	mov    %esp,%ebp
+  801e86:	53                   	push   %ebx
+  801e87:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801e8a:	68 04 60 80 00       	push   $0x806004
+  801e8f:	e8 29 1b 00 00       	call   8039bd <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801e94:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e97:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e9a:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  801e9f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ea2:	a3 04 70 80 00       	mov    %eax,0x807004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  801ea7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801eac:	b8 02 00 00 00       	mov    $0x2,%eax
+  801eb1:	e8 80 ff ff ff       	call   801e36 <fsipc>
+  801eb6:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801eb8:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801ebf:	e8 66 1b 00 00       	call   803a2a <mutex_unlock>
+	return r;
+}
+  801ec4:	89 d8                	mov    %ebx,%eax
+  801ec6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ec9:	c9                   	leave
+  801eca:	c3                   	ret
+
+00801ecb <devfile_flush>:
+{
+  801ecb:	55                   	push   %ebp
+  801ecc:	89 e5                	mov    %esp,%ebp
+  801ece:	53                   	push   %ebx
+  801ecf:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  801ed2:	68 04 60 80 00       	push   $0x806004
+  801ed7:	e8 e1 1a 00 00       	call   8039bd <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801edc:	8b 45 08             	mov    0x8(%ebp),%eax
+  801edf:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ee2:	a3 00 70 80 00       	mov    %eax,0x807000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  801ee7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801eec:	b8 06 00 00 00       	mov    $0x6,%eax
+  801ef1:	e8 40 ff ff ff       	call   801e36 <fsipc>
+  801ef6:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801ef8:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801eff:	e8 26 1b 00 00       	call   803a2a <mutex_unlock>
+}
+  801f04:	89 d8                	mov    %ebx,%eax
+  801f06:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f09:	c9                   	leave
+  801f0a:	c3                   	ret
+
+00801f0b <devfile_stat>:
+{
+  801f0b:	55                   	push   %ebp
+  801f0c:	89 e5                	mov    %esp,%ebp
+  801f0e:	56                   	push   %esi
+  801f0f:	53                   	push   %ebx
+  801f10:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  801f13:	83 ec 0c             	sub    $0xc,%esp
+  801f16:	68 04 60 80 00       	push   $0x806004
+  801f1b:	e8 9d 1a 00 00       	call   8039bd <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801f20:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f23:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f26:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  801f2b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f30:	b8 05 00 00 00       	mov    $0x5,%eax
+  801f35:	e8 fc fe ff ff       	call   801e36 <fsipc>
+  801f3a:	89 c3                	mov    %eax,%ebx
+  801f3c:	83 c4 10             	add    $0x10,%esp
+  801f3f:	85 c0                	test   %eax,%eax
+  801f41:	79 16                	jns    801f59 <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  801f43:	83 ec 0c             	sub    $0xc,%esp
+  801f46:	68 04 60 80 00       	push   $0x806004
+  801f4b:	e8 da 1a 00 00       	call   803a2a <mutex_unlock>
+}
+  801f50:	89 d8                	mov    %ebx,%eax
+  801f52:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f55:	5b                   	pop    %ebx
+  801f56:	5e                   	pop    %esi
+  801f57:	5d                   	pop    %ebp
+  801f58:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801f59:	83 ec 08             	sub    $0x8,%esp
+  801f5c:	68 00 70 80 00       	push   $0x807000
+  801f61:	56                   	push   %esi
+  801f62:	e8 42 e9 ff ff       	call   8008a9 <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  801f67:	a1 80 70 80 00       	mov    0x807080,%eax
+  801f6c:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801f72:	a1 84 70 80 00       	mov    0x807084,%eax
+  801f77:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  801f7d:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  801f80:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f85:	eb bc                	jmp    801f43 <devfile_stat+0x38>
+
+00801f87 <devfile_write>:
+{
+  801f87:	55                   	push   %ebp
+  801f88:	89 e5                	mov    %esp,%ebp
+  801f8a:	53                   	push   %ebx
+  801f8b:	83 ec 10             	sub    $0x10,%esp
+  801f8e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  801f91:	68 04 60 80 00       	push   $0x806004
+  801f96:	e8 22 1a 00 00       	call   8039bd <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801f9b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f9e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801fa1:	a3 00 70 80 00       	mov    %eax,0x807000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801fa6:	83 c4 10             	add    $0x10,%esp
+  801fa9:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  801faf:	76 3d                	jbe    801fee <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  801fb1:	b8 00 00 10 00       	mov    $0x100000,%eax
+  801fb6:	39 c3                	cmp    %eax,%ebx
+  801fb8:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  801fbb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fbe:	a3 08 70 80 00       	mov    %eax,0x807008
+	fsipcbuf.write.req_n = n;
+  801fc3:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	r = fsipc(FSREQ_WRITE, NULL);
+  801fc9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fce:	b8 04 00 00 00       	mov    $0x4,%eax
+  801fd3:	e8 5e fe ff ff       	call   801e36 <fsipc>
+  801fd8:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801fda:	83 ec 0c             	sub    $0xc,%esp
+  801fdd:	68 04 60 80 00       	push   $0x806004
+  801fe2:	e8 43 1a 00 00       	call   803a2a <mutex_unlock>
+}
+  801fe7:	89 d8                	mov    %ebx,%eax
+  801fe9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fec:	c9                   	leave
+  801fed:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  801fee:	83 ec 04             	sub    $0x4,%esp
+  801ff1:	53                   	push   %ebx
+  801ff2:	ff 75 0c             	push   0xc(%ebp)
+  801ff5:	68 0c 70 80 00       	push   $0x80700c
+  801ffa:	e8 30 ea ff ff       	call   800a2f <memmove>
+  801fff:	83 c4 10             	add    $0x10,%esp
+  802002:	b8 00 00 00 00       	mov    $0x0,%eax
+  802007:	eb b5                	jmp    801fbe <devfile_write+0x37>
+
+00802009 <devfile_read>:
+{
+  802009:	55                   	push   %ebp
+  80200a:	89 e5                	mov    %esp,%ebp
+  80200c:	57                   	push   %edi
+  80200d:	56                   	push   %esi
+  80200e:	53                   	push   %ebx
+  80200f:	83 ec 0c             	sub    $0xc,%esp
+  802012:	8b 75 08             	mov    0x8(%ebp),%esi
+  802015:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802018:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  80201b:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  802021:	0f 86 8c 00 00 00    	jbe    8020b3 <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  802027:	b8 00 00 10 00       	mov    $0x100000,%eax
+  80202c:	39 c3                	cmp    %eax,%ebx
+  80202e:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  802031:	89 f8                	mov    %edi,%eax
+  802033:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  802036:	eb 0f                	jmp    802047 <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  802038:	0f b6 08             	movzbl (%eax),%ecx
+  80203b:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  80203d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802042:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  802047:	39 d0                	cmp    %edx,%eax
+  802049:	72 ed                	jb     802038 <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  80204b:	83 ec 0c             	sub    $0xc,%esp
+  80204e:	68 04 60 80 00       	push   $0x806004
+  802053:	e8 65 19 00 00       	call   8039bd <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802058:	8b 46 0c             	mov    0xc(%esi),%eax
+  80205b:	a3 00 70 80 00       	mov    %eax,0x807000
+		fsipcbuf.read.req_n = n;
+  802060:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  802066:	89 3d 08 70 80 00    	mov    %edi,0x807008
+		r = fsipc(FSREQ_READ, NULL);
+  80206c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802071:	b8 03 00 00 00       	mov    $0x3,%eax
+  802076:	e8 bb fd ff ff       	call   801e36 <fsipc>
+  80207b:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  80207d:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  802084:	e8 a1 19 00 00       	call   803a2a <mutex_unlock>
+		assert(r <= (int) n);
+  802089:	83 c4 10             	add    $0x10,%esp
+  80208c:	39 f3                	cmp    %esi,%ebx
+  80208e:	7c 0a                	jl     80209a <devfile_read+0x91>
+}
+  802090:	89 f0                	mov    %esi,%eax
+  802092:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802095:	5b                   	pop    %ebx
+  802096:	5e                   	pop    %esi
+  802097:	5f                   	pop    %edi
+  802098:	5d                   	pop    %ebp
+  802099:	c3                   	ret
+		assert(r <= (int) n);
+  80209a:	68 34 4e 80 00       	push   $0x804e34
+  80209f:	68 71 4d 80 00       	push   $0x804d71
+  8020a4:	68 90 00 00 00       	push   $0x90
+  8020a9:	68 41 4e 80 00       	push   $0x804e41
+  8020ae:	e8 37 e1 ff ff       	call   8001ea <_panic>
+	mutex_lock(&fsipc_mu);
+  8020b3:	83 ec 0c             	sub    $0xc,%esp
+  8020b6:	68 04 60 80 00       	push   $0x806004
+  8020bb:	e8 fd 18 00 00       	call   8039bd <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8020c0:	8b 46 0c             	mov    0xc(%esi),%eax
+  8020c3:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  8020c8:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	fsipcbuf.read.req_va = 0;
+  8020ce:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  8020d5:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  8020d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020dd:	b8 03 00 00 00       	mov    $0x3,%eax
+  8020e2:	e8 4f fd ff ff       	call   801e36 <fsipc>
+  8020e7:	89 c6                	mov    %eax,%esi
+  8020e9:	83 c4 10             	add    $0x10,%esp
+  8020ec:	85 c0                	test   %eax,%eax
+  8020ee:	78 1d                	js     80210d <devfile_read+0x104>
+		assert(r <= n);
+  8020f0:	39 c3                	cmp    %eax,%ebx
+  8020f2:	72 2e                	jb     802122 <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  8020f4:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8020f9:	7f 40                	jg     80213b <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8020fb:	83 ec 04             	sub    $0x4,%esp
+  8020fe:	50                   	push   %eax
+  8020ff:	68 00 70 80 00       	push   $0x807000
+  802104:	57                   	push   %edi
+  802105:	e8 25 e9 ff ff       	call   800a2f <memmove>
+  80210a:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  80210d:	83 ec 0c             	sub    $0xc,%esp
+  802110:	68 04 60 80 00       	push   $0x806004
+  802115:	e8 10 19 00 00       	call   803a2a <mutex_unlock>
+	return r;
+  80211a:	83 c4 10             	add    $0x10,%esp
+  80211d:	e9 6e ff ff ff       	jmp    802090 <devfile_read+0x87>
+		assert(r <= n);
+  802122:	68 4c 4e 80 00       	push   $0x804e4c
+  802127:	68 71 4d 80 00       	push   $0x804d71
+  80212c:	68 99 00 00 00       	push   $0x99
+  802131:	68 41 4e 80 00       	push   $0x804e41
+  802136:	e8 af e0 ff ff       	call   8001ea <_panic>
+		assert(r <= PGSIZE);
+  80213b:	68 53 4e 80 00       	push   $0x804e53
+  802140:	68 71 4d 80 00       	push   $0x804d71
+  802145:	68 9a 00 00 00       	push   $0x9a
+  80214a:	68 41 4e 80 00       	push   $0x804e41
+  80214f:	e8 96 e0 ff ff       	call   8001ea <_panic>
+
+00802154 <open>:
+{
+  802154:	55                   	push   %ebp
+  802155:	89 e5                	mov    %esp,%ebp
+  802157:	56                   	push   %esi
+  802158:	53                   	push   %ebx
+  802159:	83 ec 1c             	sub    $0x1c,%esp
+  80215c:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  80215f:	56                   	push   %esi
+  802160:	e8 09 e7 ff ff       	call   80086e <strlen>
+  802165:	83 c4 10             	add    $0x10,%esp
+  802168:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80216d:	0f 8f 85 00 00 00    	jg     8021f8 <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  802173:	83 ec 0c             	sub    $0xc,%esp
+  802176:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802179:	50                   	push   %eax
+  80217a:	e8 a7 f6 ff ff       	call   801826 <fd_alloc>
+  80217f:	89 c3                	mov    %eax,%ebx
+  802181:	83 c4 10             	add    $0x10,%esp
+  802184:	85 c0                	test   %eax,%eax
+  802186:	78 55                	js     8021dd <open+0x89>
+	mutex_lock(&fsipc_mu);
+  802188:	83 ec 0c             	sub    $0xc,%esp
+  80218b:	68 04 60 80 00       	push   $0x806004
+  802190:	e8 28 18 00 00       	call   8039bd <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  802195:	83 c4 08             	add    $0x8,%esp
+  802198:	56                   	push   %esi
+  802199:	68 00 70 80 00       	push   $0x807000
+  80219e:	e8 06 e7 ff ff       	call   8008a9 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8021a3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021a6:	a3 00 74 80 00       	mov    %eax,0x807400
+	r = fsipc(FSREQ_OPEN, fd);
+  8021ab:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8021ae:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021b3:	e8 7e fc ff ff       	call   801e36 <fsipc>
+  8021b8:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8021ba:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  8021c1:	e8 64 18 00 00       	call   803a2a <mutex_unlock>
+	if (r < 0) {
+  8021c6:	83 c4 10             	add    $0x10,%esp
+  8021c9:	85 db                	test   %ebx,%ebx
+  8021cb:	78 19                	js     8021e6 <open+0x92>
+	return fd2num(fd);
+  8021cd:	83 ec 0c             	sub    $0xc,%esp
+  8021d0:	ff 75 f4             	push   -0xc(%ebp)
+  8021d3:	e8 27 f6 ff ff       	call   8017ff <fd2num>
+  8021d8:	89 c3                	mov    %eax,%ebx
+  8021da:	83 c4 10             	add    $0x10,%esp
+}
+  8021dd:	89 d8                	mov    %ebx,%eax
+  8021df:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021e2:	5b                   	pop    %ebx
+  8021e3:	5e                   	pop    %esi
+  8021e4:	5d                   	pop    %ebp
+  8021e5:	c3                   	ret
+		fd_close(fd, 0);
+  8021e6:	83 ec 08             	sub    $0x8,%esp
+  8021e9:	6a 00                	push   $0x0
+  8021eb:	ff 75 f4             	push   -0xc(%ebp)
+  8021ee:	e8 56 f7 ff ff       	call   801949 <fd_close>
+		return r;
+  8021f3:	83 c4 10             	add    $0x10,%esp
+  8021f6:	eb e5                	jmp    8021dd <open+0x89>
+		return -E_BAD_PATH;
+  8021f8:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8021fd:	eb de                	jmp    8021dd <open+0x89>
+
+008021ff <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  8021ff:	55                   	push   %ebp
+  802200:	89 e5                	mov    %esp,%ebp
+  802202:	53                   	push   %ebx
+  802203:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802206:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802209:	50                   	push   %eax
+  80220a:	ff 75 08             	push   0x8(%ebp)
+  80220d:	e8 6a f6 ff ff       	call   80187c <fd_lookup>
+  802212:	89 c3                	mov    %eax,%ebx
+  802214:	83 c4 10             	add    $0x10,%esp
+  802217:	85 c0                	test   %eax,%eax
+  802219:	78 5b                	js     802276 <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  80221b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80221e:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  802224:	39 08                	cmp    %ecx,(%eax)
+  802226:	75 55                	jne    80227d <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  802228:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  80222c:	74 56                	je     802284 <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  80222e:	83 ec 0c             	sub    $0xc,%esp
+  802231:	68 04 60 80 00       	push   $0x806004
+  802236:	e8 82 17 00 00       	call   8039bd <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  80223b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80223e:	8b 40 0c             	mov    0xc(%eax),%eax
+  802241:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.allocate.req_offset = offset;
+  802246:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802249:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.allocate.req_len = len;
+  80224e:	8b 45 10             	mov    0x10(%ebp),%eax
+  802251:	a3 08 70 80 00       	mov    %eax,0x807008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  802256:	ba 00 00 00 00       	mov    $0x0,%edx
+  80225b:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802260:	e8 d1 fb ff ff       	call   801e36 <fsipc>
+  802265:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802267:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  80226e:	e8 b7 17 00 00       	call   803a2a <mutex_unlock>
+	return r;
+  802273:	83 c4 10             	add    $0x10,%esp
+}
+  802276:	89 d8                	mov    %ebx,%eax
+  802278:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80227b:	c9                   	leave
+  80227c:	c3                   	ret
+		return -E_NOT_SUPP;
+  80227d:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802282:	eb f2                	jmp    802276 <fallocate+0x77>
+		return -E_INVAL;
+  802284:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802289:	eb eb                	jmp    802276 <fallocate+0x77>
+
+0080228b <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  80228b:	55                   	push   %ebp
+  80228c:	89 e5                	mov    %esp,%ebp
+  80228e:	56                   	push   %esi
+  80228f:	53                   	push   %ebx
+  802290:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  802293:	89 f3                	mov    %esi,%ebx
+  802295:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  80229b:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  80229e:	eb 06                	jmp    8022a6 <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  8022a0:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8022a6:	39 f3                	cmp    %esi,%ebx
+  8022a8:	73 14                	jae    8022be <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  8022aa:	83 ec 08             	sub    $0x8,%esp
+  8022ad:	53                   	push   %ebx
+  8022ae:	6a 00                	push   $0x0
+  8022b0:	e8 cb ea ff ff       	call   800d80 <sys_page_unmap>
+  8022b5:	83 c4 10             	add    $0x10,%esp
+  8022b8:	85 c0                	test   %eax,%eax
+  8022ba:	79 e4                	jns    8022a0 <munmap+0x15>
+  8022bc:	eb 05                	jmp    8022c3 <munmap+0x38>
+			return r;
+	return 0;
+  8022be:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022c3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022c6:	5b                   	pop    %ebx
+  8022c7:	5e                   	pop    %esi
+  8022c8:	5d                   	pop    %ebp
+  8022c9:	c3                   	ret
+
+008022ca <mmap>:
+{
+  8022ca:	55                   	push   %ebp
+  8022cb:	89 e5                	mov    %esp,%ebp
+  8022cd:	57                   	push   %edi
+  8022ce:	56                   	push   %esi
+  8022cf:	53                   	push   %ebx
+  8022d0:	83 ec 24             	sub    $0x24,%esp
+  8022d3:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  8022d6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8022d9:	50                   	push   %eax
+  8022da:	ff 75 08             	push   0x8(%ebp)
+  8022dd:	e8 9a f5 ff ff       	call   80187c <fd_lookup>
+  8022e2:	83 c4 10             	add    $0x10,%esp
+  8022e5:	85 c0                	test   %eax,%eax
+  8022e7:	0f 88 37 01 00 00    	js     802424 <mmap+0x15a>
+		return NULL;
+  8022ed:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  8022f2:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8022f5:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  8022fb:	39 0a                	cmp    %ecx,(%edx)
+  8022fd:	0f 85 05 01 00 00    	jne    802408 <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  802303:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  80230a:	0f 85 1b 01 00 00    	jne    80242b <mmap+0x161>
+  802310:	89 f0                	mov    %esi,%eax
+  802312:	83 e8 01             	sub    $0x1,%eax
+  802315:	0f 88 17 01 00 00    	js     802432 <mmap+0x168>
+	if (prot & PROT_WRITE)
+  80231b:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  80231f:	75 28                	jne    802349 <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  802321:	83 ec 0c             	sub    $0xc,%esp
+  802324:	68 04 60 80 00       	push   $0x806004
+  802329:	e8 8f 16 00 00       	call   8039bd <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  80232e:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  802334:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  80233a:	83 c4 10             	add    $0x10,%esp
+  80233d:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  802342:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  802347:	eb 2b                	jmp    802374 <mmap+0xaa>
+		cow_enable();
+  802349:	e8 40 f0 ff ff       	call   80138e <cow_enable>
+  80234e:	eb d1                	jmp    802321 <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  802350:	89 c2                	mov    %eax,%edx
+  802352:	c1 ea 0c             	shr    $0xc,%edx
+  802355:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  80235c:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  802362:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  802368:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  80236b:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  80236d:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  802372:	77 25                	ja     802399 <mmap+0xcf>
+  802374:	89 c2                	mov    %eax,%edx
+  802376:	29 da                	sub    %ebx,%edx
+  802378:	39 ca                	cmp    %ecx,%edx
+  80237a:	73 3a                	jae    8023b6 <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  80237c:	89 c2                	mov    %eax,%edx
+  80237e:	c1 ea 16             	shr    $0x16,%edx
+  802381:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802388:	f6 c2 01             	test   $0x1,%dl
+  80238b:	75 c3                	jne    802350 <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  80238d:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  802392:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  802397:	eb d4                	jmp    80236d <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  802399:	29 d8                	sub    %ebx,%eax
+  80239b:	39 c8                	cmp    %ecx,%eax
+  80239d:	73 17                	jae    8023b6 <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  80239f:	83 ec 0c             	sub    $0xc,%esp
+  8023a2:	68 04 60 80 00       	push   $0x806004
+  8023a7:	e8 7e 16 00 00       	call   803a2a <mutex_unlock>
+		return NULL;
+  8023ac:	83 c4 10             	add    $0x10,%esp
+  8023af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023b4:	eb 52                	jmp    802408 <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  8023b6:	85 db                	test   %ebx,%ebx
+  8023b8:	74 e5                	je     80239f <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8023ba:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8023bd:	8b 40 0c             	mov    0xc(%eax),%eax
+  8023c0:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  8023c5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023c8:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_len = len;
+  8023cd:	89 35 08 70 80 00    	mov    %esi,0x807008
+	fsipcbuf.map.req_va = va;
+  8023d3:	89 1d 0c 70 80 00    	mov    %ebx,0x80700c
+	fsipcbuf.map.req_prot = prot;
+  8023d9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8023dc:	a3 10 70 80 00       	mov    %eax,0x807010
+	r = fsipc(FSREQ_MAP, NULL);
+  8023e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023e6:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8023eb:	e8 46 fa ff ff       	call   801e36 <fsipc>
+  8023f0:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  8023f2:	83 ec 0c             	sub    $0xc,%esp
+  8023f5:	68 04 60 80 00       	push   $0x806004
+  8023fa:	e8 2b 16 00 00       	call   803a2a <mutex_unlock>
+	if (r < 0) {
+  8023ff:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  802402:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  802404:	85 ff                	test   %edi,%edi
+  802406:	78 08                	js     802410 <mmap+0x146>
+}
+  802408:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80240b:	5b                   	pop    %ebx
+  80240c:	5e                   	pop    %esi
+  80240d:	5f                   	pop    %edi
+  80240e:	5d                   	pop    %ebp
+  80240f:	c3                   	ret
+		munmap((void*) va, len);
+  802410:	83 ec 08             	sub    $0x8,%esp
+  802413:	56                   	push   %esi
+  802414:	53                   	push   %ebx
+  802415:	e8 71 fe ff ff       	call   80228b <munmap>
+		return NULL;
+  80241a:	83 c4 10             	add    $0x10,%esp
+  80241d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802422:	eb e4                	jmp    802408 <mmap+0x13e>
+		return NULL;
+  802424:	b8 00 00 00 00       	mov    $0x0,%eax
+  802429:	eb dd                	jmp    802408 <mmap+0x13e>
+		return NULL;
+  80242b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802430:	eb d6                	jmp    802408 <mmap+0x13e>
+  802432:	b8 00 00 00 00       	mov    $0x0,%eax
+  802437:	eb cf                	jmp    802408 <mmap+0x13e>
+
+00802439 <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  802439:	55                   	push   %ebp
+  80243a:	89 e5                	mov    %esp,%ebp
+  80243c:	53                   	push   %ebx
+  80243d:	83 ec 10             	sub    $0x10,%esp
+  802440:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802443:	53                   	push   %ebx
+  802444:	e8 25 e4 ff ff       	call   80086e <strlen>
+  802449:	83 c4 10             	add    $0x10,%esp
+  80244c:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802451:	7f 42                	jg     802495 <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  802453:	83 ec 0c             	sub    $0xc,%esp
+  802456:	68 04 60 80 00       	push   $0x806004
+  80245b:	e8 5d 15 00 00       	call   8039bd <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  802460:	83 c4 08             	add    $0x8,%esp
+  802463:	53                   	push   %ebx
+  802464:	68 00 70 80 00       	push   $0x807000
+  802469:	e8 3b e4 ff ff       	call   8008a9 <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  80246e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802473:	b8 07 00 00 00       	mov    $0x7,%eax
+  802478:	e8 b9 f9 ff ff       	call   801e36 <fsipc>
+  80247d:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80247f:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  802486:	e8 9f 15 00 00       	call   803a2a <mutex_unlock>
+	return r;
+  80248b:	83 c4 10             	add    $0x10,%esp
+}
+  80248e:	89 d8                	mov    %ebx,%eax
+  802490:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802493:	c9                   	leave
+  802494:	c3                   	ret
+		return -E_BAD_PATH;
+  802495:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80249a:	eb f2                	jmp    80248e <remove+0x55>
+
+0080249c <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80249c:	55                   	push   %ebp
+  80249d:	89 e5                	mov    %esp,%ebp
+  80249f:	53                   	push   %ebx
+  8024a0:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  8024a3:	68 04 60 80 00       	push   $0x806004
+  8024a8:	e8 10 15 00 00       	call   8039bd <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  8024ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024b2:	b8 08 00 00 00       	mov    $0x8,%eax
+  8024b7:	e8 7a f9 ff ff       	call   801e36 <fsipc>
+  8024bc:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8024be:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  8024c5:	e8 60 15 00 00       	call   803a2a <mutex_unlock>
+	return r;
+}
+  8024ca:	89 d8                	mov    %ebx,%eax
+  8024cc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024cf:	c9                   	leave
+  8024d0:	c3                   	ret
+
+008024d1 <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  8024d1:	55                   	push   %ebp
+  8024d2:	89 e5                	mov    %esp,%ebp
+  8024d4:	56                   	push   %esi
+  8024d5:	53                   	push   %ebx
+  8024d6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  8024d9:	83 ec 0c             	sub    $0xc,%esp
+  8024dc:	68 04 60 80 00       	push   $0x806004
+  8024e1:	e8 d7 14 00 00       	call   8039bd <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  8024e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024e9:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  8024ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024f3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8024f8:	e8 39 f9 ff ff       	call   801e36 <fsipc>
+  8024fd:	89 c6                	mov    %eax,%esi
+  8024ff:	83 c4 10             	add    $0x10,%esp
+  802502:	85 db                	test   %ebx,%ebx
+  802504:	74 7b                	je     802581 <fs_bcstat+0xb0>
+  802506:	85 c0                	test   %eax,%eax
+  802508:	78 77                	js     802581 <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  80250a:	a1 00 70 80 00       	mov    0x807000,%eax
+  80250f:	89 03                	mov    %eax,(%ebx)
+  802511:	a1 04 70 80 00       	mov    0x807004,%eax
+  802516:	89 43 04             	mov    %eax,0x4(%ebx)
+  802519:	a1 08 70 80 00       	mov    0x807008,%eax
+  80251e:	89 43 08             	mov    %eax,0x8(%ebx)
+  802521:	a1 0c 70 80 00       	mov    0x80700c,%eax
+  802526:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802529:	a1 10 70 80 00       	mov    0x807010,%eax
+  80252e:	89 43 10             	mov    %eax,0x10(%ebx)
+  802531:	a1 14 70 80 00       	mov    0x807014,%eax
+  802536:	89 43 14             	mov    %eax,0x14(%ebx)
+  802539:	a1 18 70 80 00       	mov    0x807018,%eax
+  80253e:	89 43 18             	mov    %eax,0x18(%ebx)
+  802541:	a1 1c 70 80 00       	mov    0x80701c,%eax
+  802546:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  802549:	a1 20 70 80 00       	mov    0x807020,%eax
+  80254e:	89 43 20             	mov    %eax,0x20(%ebx)
+  802551:	a1 24 70 80 00       	mov    0x807024,%eax
+  802556:	89 43 24             	mov    %eax,0x24(%ebx)
+  802559:	a1 28 70 80 00       	mov    0x807028,%eax
+  80255e:	89 43 28             	mov    %eax,0x28(%ebx)
+  802561:	a1 2c 70 80 00       	mov    0x80702c,%eax
+  802566:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  802569:	a1 30 70 80 00       	mov    0x807030,%eax
+  80256e:	89 43 30             	mov    %eax,0x30(%ebx)
+  802571:	a1 34 70 80 00       	mov    0x807034,%eax
+  802576:	89 43 34             	mov    %eax,0x34(%ebx)
+  802579:	a1 38 70 80 00       	mov    0x807038,%eax
+  80257e:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  802581:	83 ec 0c             	sub    $0xc,%esp
+  802584:	68 04 60 80 00       	push   $0x806004
+  802589:	e8 9c 14 00 00       	call   803a2a <mutex_unlock>
+	return r;
+}
+  80258e:	89 f0                	mov    %esi,%eax
+  802590:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802593:	5b                   	pop    %ebx
+  802594:	5e                   	pop    %esi
+  802595:	5d                   	pop    %ebp
+  802596:	c3                   	ret
+
+00802597 <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  802597:	55                   	push   %ebp
+  802598:	89 e5                	mov    %esp,%ebp
+  80259a:	56                   	push   %esi
+  80259b:	53                   	push   %ebx
+  80259c:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  80259e:	0f b6 10             	movzbl (%eax),%edx
+  8025a1:	80 fa 72             	cmp    $0x72,%dl
+  8025a4:	74 44                	je     8025ea <parse_mode+0x53>
+  8025a6:	80 fa 77             	cmp    $0x77,%dl
+  8025a9:	74 4b                	je     8025f6 <parse_mode+0x5f>
+  8025ab:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8025b0:	80 fa 61             	cmp    $0x61,%dl
+  8025b3:	74 09                	je     8025be <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  8025b5:	89 d8                	mov    %ebx,%eax
+  8025b7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025ba:	5b                   	pop    %ebx
+  8025bb:	5e                   	pop    %esi
+  8025bc:	5d                   	pop    %ebp
+  8025bd:	c3                   	ret
+	switch (mode[0]) {
+  8025be:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  8025c3:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  8025c8:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  8025ca:	83 ec 08             	sub    $0x8,%esp
+  8025cd:	6a 2b                	push   $0x2b
+  8025cf:	50                   	push   %eax
+  8025d0:	e8 e6 e3 ff ff       	call   8009bb <strchr>
+  8025d5:	83 c4 10             	add    $0x10,%esp
+  8025d8:	85 c0                	test   %eax,%eax
+  8025da:	74 d9                	je     8025b5 <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  8025dc:	83 e3 fc             	and    $0xfffffffc,%ebx
+  8025df:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  8025e2:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  8025e8:	eb cb                	jmp    8025b5 <parse_mode+0x1e>
+	switch (mode[0]) {
+  8025ea:	ba 01 00 00 00       	mov    $0x1,%edx
+  8025ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025f4:	eb d2                	jmp    8025c8 <parse_mode+0x31>
+  8025f6:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  8025fb:	bb 01 03 00 00       	mov    $0x301,%ebx
+  802600:	eb c6                	jmp    8025c8 <parse_mode+0x31>
+
+00802602 <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  802602:	55                   	push   %ebp
+  802603:	89 e5                	mov    %esp,%ebp
+  802605:	57                   	push   %edi
+  802606:	56                   	push   %esi
+  802607:	53                   	push   %ebx
+  802608:	83 ec 1c             	sub    $0x1c,%esp
+  80260b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80260e:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  802611:	b8 24 50 80 00       	mov    $0x805024,%eax
+  802616:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  80261b:	83 c0 24             	add    $0x24,%eax
+  80261e:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  802622:	74 17                	je     80263b <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  802624:	83 c3 01             	add    $0x1,%ebx
+  802627:	83 fb 10             	cmp    $0x10,%ebx
+  80262a:	75 ef                	jne    80261b <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  80262c:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  802631:	89 f0                	mov    %esi,%eax
+  802633:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802636:	5b                   	pop    %ebx
+  802637:	5e                   	pop    %esi
+  802638:	5f                   	pop    %edi
+  802639:	5d                   	pop    %ebp
+  80263a:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  80263b:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  802642:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802645:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  802648:	c1 e7 02             	shl    $0x2,%edi
+  80264b:	8d b7 20 50 80 00    	lea    0x805020(%edi),%esi
+  802651:	83 ec 04             	sub    $0x4,%esp
+  802654:	6a 24                	push   $0x24
+  802656:	6a 00                	push   $0x0
+  802658:	56                   	push   %esi
+  802659:	e8 9c e3 ff ff       	call   8009fa <memset>
+			streams[i].f_fd = fd;
+  80265e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802661:	89 8f 20 50 80 00    	mov    %ecx,0x805020(%edi)
+			streams[i].f_flags = flags;
+  802667:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80266a:	01 d8                	add    %ebx,%eax
+  80266c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80266f:	89 0c 85 24 50 80 00 	mov    %ecx,0x805024(,%eax,4)
+			return &streams[i];
+  802676:	83 c4 10             	add    $0x10,%esp
+  802679:	eb b6                	jmp    802631 <stream_alloc+0x2f>
+
+0080267b <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  80267b:	55                   	push   %ebp
+  80267c:	89 e5                	mov    %esp,%ebp
+  80267e:	53                   	push   %ebx
+  80267f:	83 ec 14             	sub    $0x14,%esp
+  802682:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  802684:	8b 40 18             	mov    0x18(%eax),%eax
+  802687:	39 43 14             	cmp    %eax,0x14(%ebx)
+  80268a:	74 4a                	je     8026d6 <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  80268c:	83 ec 08             	sub    $0x8,%esp
+  80268f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802692:	50                   	push   %eax
+  802693:	ff 33                	push   (%ebx)
+  802695:	e8 e2 f1 ff ff       	call   80187c <fd_lookup>
+  80269a:	89 c2                	mov    %eax,%edx
+  80269c:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80269f:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  8026a4:	85 d2                	test   %edx,%edx
+  8026a6:	78 41                	js     8026e9 <stream_unread+0x6e>
+  8026a8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8026ab:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  8026b1:	39 0a                	cmp    %ecx,(%edx)
+  8026b3:	75 34                	jne    8026e9 <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  8026b5:	8b 43 14             	mov    0x14(%ebx),%eax
+  8026b8:	03 42 04             	add    0x4(%edx),%eax
+  8026bb:	2b 43 18             	sub    0x18(%ebx),%eax
+  8026be:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  8026c1:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  8026c8:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  8026cf:	b8 01 00 00 00       	mov    $0x1,%eax
+  8026d4:	eb 13                	jmp    8026e9 <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  8026d6:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  8026dd:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  8026e4:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8026e9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026ec:	c9                   	leave
+  8026ed:	c3                   	ret
+
+008026ee <stream_drain>:
+{
+  8026ee:	55                   	push   %ebp
+  8026ef:	89 e5                	mov    %esp,%ebp
+  8026f1:	56                   	push   %esi
+  8026f2:	53                   	push   %ebx
+  8026f3:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  8026f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026fa:	eb 02                	jmp    8026fe <stream_drain+0x10>
+  8026fc:	01 c3                	add    %eax,%ebx
+  8026fe:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802701:	39 c3                	cmp    %eax,%ebx
+  802703:	73 43                	jae    802748 <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  802705:	83 ec 04             	sub    $0x4,%esp
+  802708:	29 d8                	sub    %ebx,%eax
+  80270a:	50                   	push   %eax
+  80270b:	89 d8                	mov    %ebx,%eax
+  80270d:	03 46 0c             	add    0xc(%esi),%eax
+  802710:	50                   	push   %eax
+  802711:	ff 36                	push   (%esi)
+  802713:	e8 ec f4 ff ff       	call   801c04 <write>
+  802718:	83 c4 10             	add    $0x10,%esp
+  80271b:	85 c0                	test   %eax,%eax
+  80271d:	7f dd                	jg     8026fc <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  80271f:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  802723:	8b 56 0c             	mov    0xc(%esi),%edx
+  802726:	83 ec 04             	sub    $0x4,%esp
+  802729:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80272c:	29 d8                	sub    %ebx,%eax
+  80272e:	50                   	push   %eax
+  80272f:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  802732:	50                   	push   %eax
+  802733:	52                   	push   %edx
+  802734:	e8 f6 e2 ff ff       	call   800a2f <memmove>
+			f->f_wend -= done;
+  802739:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80273c:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  80273e:	83 c4 10             	add    $0x10,%esp
+  802741:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  802746:	eb 0a                	jmp    802752 <stream_drain+0x64>
+  802748:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  80274d:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  802752:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  802755:	89 d0                	mov    %edx,%eax
+  802757:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80275a:	5b                   	pop    %ebx
+  80275b:	5e                   	pop    %esi
+  80275c:	5d                   	pop    %ebp
+  80275d:	c3                   	ret
+
+0080275e <stream_setup>:
+	if (f->f_buf)
+  80275e:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802762:	74 01                	je     802765 <stream_setup+0x7>
+  802764:	c3                   	ret
+{
+  802765:	55                   	push   %ebp
+  802766:	89 e5                	mov    %esp,%ebp
+  802768:	53                   	push   %ebx
+  802769:	83 ec 04             	sub    $0x4,%esp
+  80276c:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  80276e:	8b 40 08             	mov    0x8(%eax),%eax
+  802771:	85 c0                	test   %eax,%eax
+  802773:	74 17                	je     80278c <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  802775:	83 f8 03             	cmp    $0x3,%eax
+  802778:	75 2d                	jne    8027a7 <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  80277a:	8d 43 20             	lea    0x20(%ebx),%eax
+  80277d:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  802780:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  802787:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80278a:	c9                   	leave
+  80278b:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  80278c:	83 ec 0c             	sub    $0xc,%esp
+  80278f:	ff 33                	push   (%ebx)
+  802791:	e8 29 1b 00 00       	call   8042bf <iscons>
+  802796:	83 c4 10             	add    $0x10,%esp
+  802799:	85 c0                	test   %eax,%eax
+  80279b:	0f 9f c0             	setg   %al
+  80279e:	0f b6 c0             	movzbl %al,%eax
+  8027a1:	83 c0 01             	add    $0x1,%eax
+  8027a4:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  8027a7:	83 ec 0c             	sub    $0xc,%esp
+  8027aa:	68 00 10 00 00       	push   $0x1000
+  8027af:	e8 6e 0b 00 00       	call   803322 <malloc>
+  8027b4:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8027b7:	83 c4 10             	add    $0x10,%esp
+  8027ba:	85 c0                	test   %eax,%eax
+  8027bc:	74 bc                	je     80277a <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  8027be:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  8027c5:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  8027c9:	eb bc                	jmp    802787 <stream_setup+0x29>
+
+008027cb <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  8027cb:	55                   	push   %ebp
+  8027cc:	89 e5                	mov    %esp,%ebp
+  8027ce:	53                   	push   %ebx
+  8027cf:	83 ec 04             	sub    $0x4,%esp
+  8027d2:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  8027d4:	e8 85 ff ff ff       	call   80275e <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  8027d9:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  8027de:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  8027e2:	74 3d                	je     802821 <stream_fill+0x56>
+  8027e4:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  8027e8:	74 10                	je     8027fa <stream_fill+0x2f>
+  8027ea:	89 d8                	mov    %ebx,%eax
+  8027ec:	e8 fd fe ff ff       	call   8026ee <stream_drain>
+		return 0;
+  8027f1:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  8027f6:	85 c0                	test   %eax,%eax
+  8027f8:	78 27                	js     802821 <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  8027fa:	83 ec 04             	sub    $0x4,%esp
+  8027fd:	ff 73 10             	push   0x10(%ebx)
+  802800:	ff 73 0c             	push   0xc(%ebx)
+  802803:	ff 33                	push   (%ebx)
+  802805:	e8 02 f3 ff ff       	call   801b0c <read>
+  80280a:	83 c4 10             	add    $0x10,%esp
+  80280d:	85 c0                	test   %eax,%eax
+  80280f:	7e 17                	jle    802828 <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  802811:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  802815:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  80281c:	89 c2                	mov    %eax,%edx
+  80281e:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  802821:	89 d0                	mov    %edx,%eax
+  802823:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802826:	c9                   	leave
+  802827:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802828:	c1 f8 1f             	sar    $0x1f,%eax
+  80282b:	83 e0 04             	and    $0x4,%eax
+  80282e:	83 c0 04             	add    $0x4,%eax
+  802831:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  802834:	ba 00 00 00 00       	mov    $0x0,%edx
+  802839:	eb e6                	jmp    802821 <stream_fill+0x56>
+
+0080283b <fopen>:
+{
+  80283b:	55                   	push   %ebp
+  80283c:	89 e5                	mov    %esp,%ebp
+  80283e:	57                   	push   %edi
+  80283f:	56                   	push   %esi
+  802840:	53                   	push   %ebx
+  802841:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  802847:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  80284a:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  802850:	89 f0                	mov    %esi,%eax
+  802852:	e8 40 fd ff ff       	call   802597 <parse_mode>
+		return 0;
+  802857:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  80285c:	85 c0                	test   %eax,%eax
+  80285e:	78 2d                	js     80288d <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  802860:	83 ec 08             	sub    $0x8,%esp
+  802863:	50                   	push   %eax
+  802864:	ff 75 08             	push   0x8(%ebp)
+  802867:	e8 e8 f8 ff ff       	call   802154 <open>
+  80286c:	89 c7                	mov    %eax,%edi
+  80286e:	83 c4 10             	add    $0x10,%esp
+  802871:	85 c0                	test   %eax,%eax
+  802873:	78 58                	js     8028cd <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  802875:	80 3e 61             	cmpb   $0x61,(%esi)
+  802878:	74 1d                	je     802897 <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  80287a:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  802880:	89 f8                	mov    %edi,%eax
+  802882:	e8 7b fd ff ff       	call   802602 <stream_alloc>
+  802887:	89 c3                	mov    %eax,%ebx
+  802889:	85 c0                	test   %eax,%eax
+  80288b:	74 32                	je     8028bf <fopen+0x84>
+}
+  80288d:	89 d8                	mov    %ebx,%eax
+  80288f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802892:	5b                   	pop    %ebx
+  802893:	5e                   	pop    %esi
+  802894:	5f                   	pop    %edi
+  802895:	5d                   	pop    %ebp
+  802896:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  802897:	83 ec 08             	sub    $0x8,%esp
+  80289a:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  8028a0:	50                   	push   %eax
+  8028a1:	57                   	push   %edi
+  8028a2:	e8 db f4 ff ff       	call   801d82 <fstat>
+  8028a7:	83 c4 10             	add    $0x10,%esp
+  8028aa:	85 c0                	test   %eax,%eax
+  8028ac:	78 cc                	js     80287a <fopen+0x3f>
+		seek(fd, st.st_size);
+  8028ae:	83 ec 08             	sub    $0x8,%esp
+  8028b1:	ff 75 dc             	push   -0x24(%ebp)
+  8028b4:	57                   	push   %edi
+  8028b5:	e8 f6 f3 ff ff       	call   801cb0 <seek>
+  8028ba:	83 c4 10             	add    $0x10,%esp
+  8028bd:	eb bb                	jmp    80287a <fopen+0x3f>
+		close(fd);
+  8028bf:	83 ec 0c             	sub    $0xc,%esp
+  8028c2:	57                   	push   %edi
+  8028c3:	e8 08 f1 ff ff       	call   8019d0 <close>
+  8028c8:	83 c4 10             	add    $0x10,%esp
+  8028cb:	eb c0                	jmp    80288d <fopen+0x52>
+		return 0;
+  8028cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028d2:	eb b9                	jmp    80288d <fopen+0x52>
+
+008028d4 <fdopen>:
+{
+  8028d4:	55                   	push   %ebp
+  8028d5:	89 e5                	mov    %esp,%ebp
+  8028d7:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  8028da:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8028dd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8028e0:	e8 b2 fc ff ff       	call   802597 <parse_mode>
+  8028e5:	89 c2                	mov    %eax,%edx
+		return 0;
+  8028e7:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  8028ec:	85 d2                	test   %edx,%edx
+  8028ee:	78 0b                	js     8028fb <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  8028f0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8028f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028f6:	e8 07 fd ff ff       	call   802602 <stream_alloc>
+}
+  8028fb:	c9                   	leave
+  8028fc:	c3                   	ret
+
+008028fd <setvbuf>:
+{
+  8028fd:	55                   	push   %ebp
+  8028fe:	89 e5                	mov    %esp,%ebp
+  802900:	57                   	push   %edi
+  802901:	56                   	push   %esi
+  802902:	53                   	push   %ebx
+  802903:	8b 45 08             	mov    0x8(%ebp),%eax
+  802906:	8b 55 10             	mov    0x10(%ebp),%edx
+  802909:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  80290c:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802910:	75 3a                	jne    80294c <setvbuf+0x4f>
+  802912:	8d 72 ff             	lea    -0x1(%edx),%esi
+  802915:	83 fe 02             	cmp    $0x2,%esi
+  802918:	77 39                	ja     802953 <setvbuf+0x56>
+	f->f_bufmode = mode;
+  80291a:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  80291d:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802921:	0f 95 c3             	setne  %bl
+  802924:	85 ff                	test   %edi,%edi
+  802926:	0f 95 c1             	setne  %cl
+  802929:	84 cb                	test   %cl,%bl
+  80292b:	74 05                	je     802932 <setvbuf+0x35>
+  80292d:	83 fa 03             	cmp    $0x3,%edx
+  802930:	75 0a                	jne    80293c <setvbuf+0x3f>
+	return 0;
+  802932:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802937:	5b                   	pop    %ebx
+  802938:	5e                   	pop    %esi
+  802939:	5f                   	pop    %edi
+  80293a:	5d                   	pop    %ebp
+  80293b:	c3                   	ret
+		f->f_buf = buf;
+  80293c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80293f:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  802942:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  802945:	b8 00 00 00 00       	mov    $0x0,%eax
+  80294a:	eb eb                	jmp    802937 <setvbuf+0x3a>
+		return EOF;
+  80294c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802951:	eb e4                	jmp    802937 <setvbuf+0x3a>
+  802953:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802958:	eb dd                	jmp    802937 <setvbuf+0x3a>
+
+0080295a <fflush>:
+{
+  80295a:	55                   	push   %ebp
+  80295b:	89 e5                	mov    %esp,%ebp
+  80295d:	57                   	push   %edi
+  80295e:	56                   	push   %esi
+  80295f:	53                   	push   %ebx
+  802960:	83 ec 0c             	sub    $0xc,%esp
+  802963:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  802966:	85 db                	test   %ebx,%ebx
+  802968:	74 1a                	je     802984 <fflush+0x2a>
+	stream_unread(f);
+  80296a:	89 d8                	mov    %ebx,%eax
+  80296c:	e8 0a fd ff ff       	call   80267b <stream_unread>
+	return stream_drain(f);
+  802971:	89 d8                	mov    %ebx,%eax
+  802973:	e8 76 fd ff ff       	call   8026ee <stream_drain>
+  802978:	89 c7                	mov    %eax,%edi
+}
+  80297a:	89 f8                	mov    %edi,%eax
+  80297c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80297f:	5b                   	pop    %ebx
+  802980:	5e                   	pop    %esi
+  802981:	5f                   	pop    %edi
+  802982:	5d                   	pop    %ebp
+  802983:	c3                   	ret
+  802984:	bb 20 50 80 00       	mov    $0x805020,%ebx
+  802989:	be 60 52 80 00       	mov    $0x805260,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  80298e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802993:	eb 03                	jmp    802998 <fflush+0x3e>
+  802995:	83 c3 24             	add    $0x24,%ebx
+  802998:	39 f3                	cmp    %esi,%ebx
+  80299a:	74 de                	je     80297a <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  80299c:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  8029a0:	74 f3                	je     802995 <fflush+0x3b>
+  8029a2:	83 ec 0c             	sub    $0xc,%esp
+  8029a5:	53                   	push   %ebx
+  8029a6:	e8 af ff ff ff       	call   80295a <fflush>
+  8029ab:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  8029ae:	85 c0                	test   %eax,%eax
+  8029b0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8029b5:	0f 48 f8             	cmovs  %eax,%edi
+  8029b8:	eb db                	jmp    802995 <fflush+0x3b>
+
+008029ba <fclose>:
+{
+  8029ba:	55                   	push   %ebp
+  8029bb:	89 e5                	mov    %esp,%ebp
+  8029bd:	56                   	push   %esi
+  8029be:	53                   	push   %ebx
+  8029bf:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  8029c2:	83 ec 0c             	sub    $0xc,%esp
+  8029c5:	56                   	push   %esi
+  8029c6:	e8 8f ff ff ff       	call   80295a <fflush>
+  8029cb:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  8029cd:	83 c4 04             	add    $0x4,%esp
+  8029d0:	ff 36                	push   (%esi)
+  8029d2:	e8 f9 ef ff ff       	call   8019d0 <close>
+  8029d7:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  8029da:	85 c0                	test   %eax,%eax
+  8029dc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8029e1:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  8029e4:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  8029e8:	75 10                	jne    8029fa <fclose+0x40>
+	f->f_flags = 0;
+  8029ea:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  8029f1:	89 d8                	mov    %ebx,%eax
+  8029f3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8029f6:	5b                   	pop    %ebx
+  8029f7:	5e                   	pop    %esi
+  8029f8:	5d                   	pop    %ebp
+  8029f9:	c3                   	ret
+		free(f->f_buf);
+  8029fa:	83 ec 0c             	sub    $0xc,%esp
+  8029fd:	ff 76 0c             	push   0xc(%esi)
+  802a00:	e8 54 08 00 00       	call   803259 <free>
+  802a05:	83 c4 10             	add    $0x10,%esp
+  802a08:	eb e0                	jmp    8029ea <fclose+0x30>
+
+00802a0a <fileno>:
+{
+  802a0a:	55                   	push   %ebp
+  802a0b:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  802a0d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a10:	8b 00                	mov    (%eax),%eax
+}
+  802a12:	5d                   	pop    %ebp
+  802a13:	c3                   	ret
+
+00802a14 <feof>:
+{
+  802a14:	55                   	push   %ebp
+  802a15:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  802a17:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a1a:	8b 40 04             	mov    0x4(%eax),%eax
+  802a1d:	c1 e8 02             	shr    $0x2,%eax
+  802a20:	83 e0 01             	and    $0x1,%eax
+}
+  802a23:	5d                   	pop    %ebp
+  802a24:	c3                   	ret
+
+00802a25 <ferror>:
+{
+  802a25:	55                   	push   %ebp
+  802a26:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  802a28:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a2b:	8b 40 04             	mov    0x4(%eax),%eax
+  802a2e:	c1 e8 03             	shr    $0x3,%eax
+  802a31:	83 e0 01             	and    $0x1,%eax
+}
+  802a34:	5d                   	pop    %ebp
+  802a35:	c3                   	ret
+
+00802a36 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  802a36:	55                   	push   %ebp
+  802a37:	89 e5                	mov    %esp,%ebp
+  802a39:	53                   	push   %ebx
+  802a3a:	83 ec 04             	sub    $0x4,%esp
+  802a3d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802a40:	8b 43 18             	mov    0x18(%ebx),%eax
+  802a43:	39 43 14             	cmp    %eax,0x14(%ebx)
+  802a46:	74 15                	je     802a5d <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  802a48:	8b 53 0c             	mov    0xc(%ebx),%edx
+  802a4b:	8b 43 14             	mov    0x14(%ebx),%eax
+  802a4e:	8d 48 01             	lea    0x1(%eax),%ecx
+  802a51:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  802a54:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  802a58:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a5b:	c9                   	leave
+  802a5c:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802a5d:	89 d8                	mov    %ebx,%eax
+  802a5f:	e8 67 fd ff ff       	call   8027cb <stream_fill>
+  802a64:	85 c0                	test   %eax,%eax
+  802a66:	75 e0                	jne    802a48 <fgetc+0x12>
+		return EOF;
+  802a68:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802a6d:	eb e9                	jmp    802a58 <fgetc+0x22>
+
+00802a6f <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  802a6f:	55                   	push   %ebp
+  802a70:	89 e5                	mov    %esp,%ebp
+  802a72:	57                   	push   %edi
+  802a73:	56                   	push   %esi
+  802a74:	53                   	push   %ebx
+  802a75:	83 ec 1c             	sub    $0x1c,%esp
+  802a78:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  802a7b:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802a80:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a83:	83 e8 01             	sub    $0x1,%eax
+  802a86:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  802a89:	eb 66                	jmp    802af1 <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802a8b:	8b 46 14             	mov    0x14(%esi),%eax
+  802a8e:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802a91:	29 c3                	sub    %eax,%ebx
+  802a93:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802a96:	29 fa                	sub    %edi,%edx
+  802a98:	39 d3                	cmp    %edx,%ebx
+  802a9a:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802a9d:	83 ec 04             	sub    $0x4,%esp
+  802aa0:	53                   	push   %ebx
+  802aa1:	6a 0a                	push   $0xa
+  802aa3:	03 46 0c             	add    0xc(%esi),%eax
+  802aa6:	50                   	push   %eax
+  802aa7:	e8 34 e0 ff ff       	call   800ae0 <memfind>
+  802aac:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  802aaf:	8b 46 0c             	mov    0xc(%esi),%eax
+  802ab2:	8b 4e 14             	mov    0x14(%esi),%ecx
+  802ab5:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  802ab8:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802aba:	83 c4 10             	add    $0x10,%esp
+  802abd:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802ac0:	74 0b                	je     802acd <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  802ac2:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802ac5:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802ac8:	29 d3                	sub    %edx,%ebx
+  802aca:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  802acd:	83 ec 04             	sub    $0x4,%esp
+  802ad0:	53                   	push   %ebx
+  802ad1:	01 c8                	add    %ecx,%eax
+  802ad3:	50                   	push   %eax
+  802ad4:	89 f8                	mov    %edi,%eax
+  802ad6:	03 45 08             	add    0x8(%ebp),%eax
+  802ad9:	50                   	push   %eax
+  802ada:	e8 50 df ff ff       	call   800a2f <memmove>
+		f->f_rpos += m;
+  802adf:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  802ae2:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  802ae4:	83 c4 10             	add    $0x10,%esp
+  802ae7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802aea:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  802aef:	74 1f                	je     802b10 <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  802af1:	8d 47 01             	lea    0x1(%edi),%eax
+  802af4:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  802af7:	73 17                	jae    802b10 <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802af9:	8b 46 18             	mov    0x18(%esi),%eax
+  802afc:	39 46 14             	cmp    %eax,0x14(%esi)
+  802aff:	75 8a                	jne    802a8b <fgets+0x1c>
+  802b01:	89 f0                	mov    %esi,%eax
+  802b03:	e8 c3 fc ff ff       	call   8027cb <stream_fill>
+  802b08:	85 c0                	test   %eax,%eax
+  802b0a:	0f 85 7b ff ff ff    	jne    802a8b <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  802b10:	85 ff                	test   %edi,%edi
+  802b12:	74 0f                	je     802b23 <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  802b14:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b17:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  802b1b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b1e:	5b                   	pop    %ebx
+  802b1f:	5e                   	pop    %esi
+  802b20:	5f                   	pop    %edi
+  802b21:	5d                   	pop    %ebp
+  802b22:	c3                   	ret
+		return 0;
+  802b23:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b28:	eb f1                	jmp    802b1b <fgets+0xac>
+
+00802b2a <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  802b2a:	55                   	push   %ebp
+  802b2b:	89 e5                	mov    %esp,%ebp
+  802b2d:	57                   	push   %edi
+  802b2e:	56                   	push   %esi
+  802b2f:	53                   	push   %ebx
+  802b30:	83 ec 1c             	sub    $0x1c,%esp
+  802b33:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  802b36:	89 f0                	mov    %esi,%eax
+  802b38:	e8 21 fc ff ff       	call   80275e <stream_setup>
+	want = size * n;
+  802b3d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b40:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802b44:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  802b47:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b4c:	eb 43                	jmp    802b91 <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  802b4e:	29 d3                	sub    %edx,%ebx
+  802b50:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802b53:	29 f8                	sub    %edi,%eax
+  802b55:	39 c3                	cmp    %eax,%ebx
+  802b57:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  802b5a:	83 ec 04             	sub    $0x4,%esp
+  802b5d:	53                   	push   %ebx
+  802b5e:	03 56 0c             	add    0xc(%esi),%edx
+  802b61:	52                   	push   %edx
+  802b62:	89 f8                	mov    %edi,%eax
+  802b64:	03 45 08             	add    0x8(%ebp),%eax
+  802b67:	50                   	push   %eax
+  802b68:	e8 c2 de ff ff       	call   800a2f <memmove>
+			f->f_rpos += m;
+  802b6d:	01 5e 14             	add    %ebx,0x14(%esi)
+  802b70:	83 c4 10             	add    $0x10,%esp
+  802b73:	eb 1a                	jmp    802b8f <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  802b75:	83 ec 04             	sub    $0x4,%esp
+  802b78:	53                   	push   %ebx
+  802b79:	89 f8                	mov    %edi,%eax
+  802b7b:	03 45 08             	add    0x8(%ebp),%eax
+  802b7e:	50                   	push   %eax
+  802b7f:	ff 36                	push   (%esi)
+  802b81:	e8 86 ef ff ff       	call   801b0c <read>
+  802b86:	89 c3                	mov    %eax,%ebx
+  802b88:	83 c4 10             	add    $0x10,%esp
+  802b8b:	85 c0                	test   %eax,%eax
+  802b8d:	7e 36                	jle    802bc5 <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  802b8f:	01 df                	add    %ebx,%edi
+  802b91:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802b94:	39 c7                	cmp    %eax,%edi
+  802b96:	73 39                	jae    802bd1 <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  802b98:	8b 56 14             	mov    0x14(%esi),%edx
+  802b9b:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802b9e:	39 da                	cmp    %ebx,%edx
+  802ba0:	72 ac                	jb     802b4e <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  802ba2:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802ba5:	29 fb                	sub    %edi,%ebx
+  802ba7:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  802baa:	72 3e                	jb     802bea <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  802bac:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  802bb0:	74 1f                	je     802bd1 <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  802bb2:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  802bb6:	74 bd                	je     802b75 <fread+0x4b>
+  802bb8:	89 f0                	mov    %esi,%eax
+  802bba:	e8 2f fb ff ff       	call   8026ee <stream_drain>
+  802bbf:	85 c0                	test   %eax,%eax
+  802bc1:	79 b2                	jns    802b75 <fread+0x4b>
+  802bc3:	eb 0c                	jmp    802bd1 <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802bc5:	c1 fb 1f             	sar    $0x1f,%ebx
+  802bc8:	83 e3 04             	and    $0x4,%ebx
+  802bcb:	83 c3 04             	add    $0x4,%ebx
+  802bce:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  802bd1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802bd4:	85 c0                	test   %eax,%eax
+  802bd6:	74 0a                	je     802be2 <fread+0xb8>
+  802bd8:	89 f8                	mov    %edi,%eax
+  802bda:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bdf:	f7 75 0c             	divl   0xc(%ebp)
+}
+  802be2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802be5:	5b                   	pop    %ebx
+  802be6:	5e                   	pop    %esi
+  802be7:	5f                   	pop    %edi
+  802be8:	5d                   	pop    %ebp
+  802be9:	c3                   	ret
+		} else if (!stream_fill(f))
+  802bea:	89 f0                	mov    %esi,%eax
+  802bec:	e8 da fb ff ff       	call   8027cb <stream_fill>
+  802bf1:	85 c0                	test   %eax,%eax
+  802bf3:	74 dc                	je     802bd1 <fread+0xa7>
+			m = 0;
+  802bf5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802bfa:	eb 93                	jmp    802b8f <fread+0x65>
+
+00802bfc <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  802bfc:	55                   	push   %ebp
+  802bfd:	89 e5                	mov    %esp,%ebp
+  802bff:	57                   	push   %edi
+  802c00:	56                   	push   %esi
+  802c01:	53                   	push   %ebx
+  802c02:	83 ec 1c             	sub    $0x1c,%esp
+  802c05:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  802c08:	8b 43 04             	mov    0x4(%ebx),%eax
+  802c0b:	a8 02                	test   $0x2,%al
+  802c0d:	75 13                	jne    802c22 <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  802c0f:	83 c8 08             	or     $0x8,%eax
+  802c12:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  802c15:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  802c1a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c1d:	5b                   	pop    %ebx
+  802c1e:	5e                   	pop    %esi
+  802c1f:	5f                   	pop    %edi
+  802c20:	5d                   	pop    %ebp
+  802c21:	c3                   	ret
+	stream_setup(f);
+  802c22:	89 d8                	mov    %ebx,%eax
+  802c24:	e8 35 fb ff ff       	call   80275e <stream_setup>
+	want = size * n;
+  802c29:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c2c:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802c30:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  802c33:	89 d8                	mov    %ebx,%eax
+  802c35:	e8 41 fa ff ff       	call   80267b <stream_unread>
+	for (done = 0; done < want; ) {
+  802c3a:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  802c3f:	84 c0                	test   %al,%al
+  802c41:	75 7b                	jne    802cbe <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  802c43:	be 00 00 00 00       	mov    $0x0,%esi
+  802c48:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802c4b:	39 fe                	cmp    %edi,%esi
+  802c4d:	73 24                	jae    802c73 <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802c4f:	83 ec 04             	sub    $0x4,%esp
+  802c52:	89 f8                	mov    %edi,%eax
+  802c54:	29 f0                	sub    %esi,%eax
+  802c56:	50                   	push   %eax
+  802c57:	89 f0                	mov    %esi,%eax
+  802c59:	03 45 08             	add    0x8(%ebp),%eax
+  802c5c:	50                   	push   %eax
+  802c5d:	ff 33                	push   (%ebx)
+  802c5f:	e8 a0 ef ff ff       	call   801c04 <write>
+  802c64:	83 c4 10             	add    $0x10,%esp
+  802c67:	85 c0                	test   %eax,%eax
+  802c69:	7e 04                	jle    802c6f <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  802c6b:	01 c6                	add    %eax,%esi
+  802c6d:	eb dc                	jmp    802c4b <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  802c6f:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  802c73:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c76:	85 c0                	test   %eax,%eax
+  802c78:	74 a0                	je     802c1a <fwrite+0x1e>
+  802c7a:	89 f0                	mov    %esi,%eax
+  802c7c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c81:	f7 75 0c             	divl   0xc(%ebp)
+  802c84:	eb 94                	jmp    802c1a <fwrite+0x1e>
+			done += r;
+  802c86:	01 c7                	add    %eax,%edi
+			continue;
+  802c88:	eb 34                	jmp    802cbe <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  802c8a:	8b 73 10             	mov    0x10(%ebx),%esi
+  802c8d:	29 c6                	sub    %eax,%esi
+  802c8f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802c92:	29 fa                	sub    %edi,%edx
+  802c94:	39 d6                	cmp    %edx,%esi
+  802c96:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  802c99:	83 ec 04             	sub    $0x4,%esp
+  802c9c:	56                   	push   %esi
+  802c9d:	89 fa                	mov    %edi,%edx
+  802c9f:	03 55 08             	add    0x8(%ebp),%edx
+  802ca2:	52                   	push   %edx
+  802ca3:	03 43 0c             	add    0xc(%ebx),%eax
+  802ca6:	50                   	push   %eax
+  802ca7:	e8 83 dd ff ff       	call   800a2f <memmove>
+		f->f_wend += m;
+  802cac:	89 f0                	mov    %esi,%eax
+  802cae:	03 43 1c             	add    0x1c(%ebx),%eax
+  802cb1:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  802cb4:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802cb6:	83 c4 10             	add    $0x10,%esp
+  802cb9:	3b 43 10             	cmp    0x10(%ebx),%eax
+  802cbc:	74 5b                	je     802d19 <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  802cbe:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802cc1:	39 c7                	cmp    %eax,%edi
+  802cc3:	73 2d                	jae    802cf2 <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  802cc5:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802cc8:	85 c0                	test   %eax,%eax
+  802cca:	75 be                	jne    802c8a <fwrite+0x8e>
+  802ccc:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802ccf:	29 fa                	sub    %edi,%edx
+  802cd1:	3b 53 10             	cmp    0x10(%ebx),%edx
+  802cd4:	72 b4                	jb     802c8a <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802cd6:	83 ec 04             	sub    $0x4,%esp
+  802cd9:	52                   	push   %edx
+  802cda:	89 f8                	mov    %edi,%eax
+  802cdc:	03 45 08             	add    0x8(%ebp),%eax
+  802cdf:	50                   	push   %eax
+  802ce0:	ff 33                	push   (%ebx)
+  802ce2:	e8 1d ef ff ff       	call   801c04 <write>
+  802ce7:	83 c4 10             	add    $0x10,%esp
+  802cea:	85 c0                	test   %eax,%eax
+  802cec:	7f 98                	jg     802c86 <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  802cee:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  802cf2:	8b 43 08             	mov    0x8(%ebx),%eax
+  802cf5:	83 f8 03             	cmp    $0x3,%eax
+  802cf8:	74 48                	je     802d42 <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802cfa:	83 f8 02             	cmp    $0x2,%eax
+  802cfd:	74 27                	je     802d26 <fwrite+0x12a>
+	return size ? done / size : 0;
+  802cff:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d02:	85 c0                	test   %eax,%eax
+  802d04:	0f 84 10 ff ff ff    	je     802c1a <fwrite+0x1e>
+  802d0a:	89 f8                	mov    %edi,%eax
+  802d0c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d11:	f7 75 0c             	divl   0xc(%ebp)
+  802d14:	e9 01 ff ff ff       	jmp    802c1a <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802d19:	89 d8                	mov    %ebx,%eax
+  802d1b:	e8 ce f9 ff ff       	call   8026ee <stream_drain>
+  802d20:	85 c0                	test   %eax,%eax
+  802d22:	79 9a                	jns    802cbe <fwrite+0xc2>
+  802d24:	eb cc                	jmp    802cf2 <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802d26:	83 ec 04             	sub    $0x4,%esp
+  802d29:	57                   	push   %edi
+  802d2a:	6a 0a                	push   $0xa
+  802d2c:	ff 75 08             	push   0x8(%ebp)
+  802d2f:	e8 ac dd ff ff       	call   800ae0 <memfind>
+  802d34:	89 c2                	mov    %eax,%edx
+  802d36:	89 f8                	mov    %edi,%eax
+  802d38:	03 45 08             	add    0x8(%ebp),%eax
+  802d3b:	83 c4 10             	add    $0x10,%esp
+  802d3e:	39 c2                	cmp    %eax,%edx
+  802d40:	74 bd                	je     802cff <fwrite+0x103>
+		stream_drain(f);
+  802d42:	89 d8                	mov    %ebx,%eax
+  802d44:	e8 a5 f9 ff ff       	call   8026ee <stream_drain>
+  802d49:	eb b4                	jmp    802cff <fwrite+0x103>
+
+00802d4b <fputc>:
+{
+  802d4b:	55                   	push   %ebp
+  802d4c:	89 e5                	mov    %esp,%ebp
+  802d4e:	53                   	push   %ebx
+  802d4f:	83 ec 14             	sub    $0x14,%esp
+  802d52:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  802d55:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  802d58:	ff 75 0c             	push   0xc(%ebp)
+  802d5b:	6a 01                	push   $0x1
+  802d5d:	6a 01                	push   $0x1
+  802d5f:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802d62:	50                   	push   %eax
+  802d63:	e8 94 fe ff ff       	call   802bfc <fwrite>
+  802d68:	83 c4 10             	add    $0x10,%esp
+  802d6b:	0f b6 db             	movzbl %bl,%ebx
+  802d6e:	83 f8 01             	cmp    $0x1,%eax
+  802d71:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802d76:	0f 44 c3             	cmove  %ebx,%eax
+}
+  802d79:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d7c:	c9                   	leave
+  802d7d:	c3                   	ret
+
+00802d7e <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  802d7e:	55                   	push   %ebp
+  802d7f:	89 e5                	mov    %esp,%ebp
+  802d81:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  802d84:	ff 75 0c             	push   0xc(%ebp)
+  802d87:	ff 75 08             	push   0x8(%ebp)
+  802d8a:	e8 bc ff ff ff       	call   802d4b <fputc>
+}
+  802d8f:	83 c4 10             	add    $0x10,%esp
+  802d92:	c9                   	leave
+  802d93:	c3                   	ret
+
+00802d94 <fputs>:
+{
+  802d94:	55                   	push   %ebp
+  802d95:	89 e5                	mov    %esp,%ebp
+  802d97:	56                   	push   %esi
+  802d98:	53                   	push   %ebx
+  802d99:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  802d9c:	83 ec 0c             	sub    $0xc,%esp
+  802d9f:	56                   	push   %esi
+  802da0:	e8 c9 da ff ff       	call   80086e <strlen>
+  802da5:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  802da7:	ff 75 0c             	push   0xc(%ebp)
+  802daa:	50                   	push   %eax
+  802dab:	6a 01                	push   $0x1
+  802dad:	56                   	push   %esi
+  802dae:	e8 49 fe ff ff       	call   802bfc <fwrite>
+  802db3:	83 c4 20             	add    $0x20,%esp
+  802db6:	39 d8                	cmp    %ebx,%eax
+  802db8:	0f 95 c0             	setne  %al
+  802dbb:	0f b6 c0             	movzbl %al,%eax
+  802dbe:	f7 d8                	neg    %eax
+}
+  802dc0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802dc3:	5b                   	pop    %ebx
+  802dc4:	5e                   	pop    %esi
+  802dc5:	5d                   	pop    %ebp
+  802dc6:	c3                   	ret
+
+00802dc7 <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  802dc7:	55                   	push   %ebp
+  802dc8:	89 e5                	mov    %esp,%ebp
+  802dca:	53                   	push   %ebx
+  802dcb:	83 ec 04             	sub    $0x4,%esp
+  802dce:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802dd1:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  802dd4:	50                   	push   %eax
+  802dd5:	ff 75 0c             	push   0xc(%ebp)
+  802dd8:	53                   	push   %ebx
+  802dd9:	68 7e 2d 80 00       	push   $0x802d7e
+  802dde:	e8 d9 d5 ff ff       	call   8003bc <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  802de3:	8b 43 04             	mov    0x4(%ebx),%eax
+  802de6:	c1 e0 1c             	shl    $0x1c,%eax
+  802de9:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  802dec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802def:	c9                   	leave
+  802df0:	c3                   	ret
+
+00802df1 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802df1:	55                   	push   %ebp
+  802df2:	89 e5                	mov    %esp,%ebp
+  802df4:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802df7:	68 68 4e 80 00       	push   $0x804e68
+  802dfc:	ff 75 0c             	push   0xc(%ebp)
+  802dff:	e8 a5 da ff ff       	call   8008a9 <strcpy>
+	return 0;
+}
+  802e04:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e09:	c9                   	leave
+  802e0a:	c3                   	ret
+
+00802e0b <devsock_close>:
+{
+  802e0b:	55                   	push   %ebp
+  802e0c:	89 e5                	mov    %esp,%ebp
+  802e0e:	53                   	push   %ebx
+  802e0f:	83 ec 10             	sub    $0x10,%esp
+  802e12:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802e15:	53                   	push   %ebx
+  802e16:	e8 11 17 00 00       	call   80452c <pageref>
+  802e1b:	89 c2                	mov    %eax,%edx
+  802e1d:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802e20:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802e25:	83 fa 01             	cmp    $0x1,%edx
+  802e28:	74 05                	je     802e2f <devsock_close+0x24>
+}
+  802e2a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e2d:	c9                   	leave
+  802e2e:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802e2f:	83 ec 0c             	sub    $0xc,%esp
+  802e32:	ff 73 0c             	push   0xc(%ebx)
+  802e35:	e8 b7 02 00 00       	call   8030f1 <nsipc_close>
+  802e3a:	83 c4 10             	add    $0x10,%esp
+  802e3d:	eb eb                	jmp    802e2a <devsock_close+0x1f>
+
+00802e3f <devsock_write>:
+{
+  802e3f:	55                   	push   %ebp
+  802e40:	89 e5                	mov    %esp,%ebp
+  802e42:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802e45:	6a 00                	push   $0x0
+  802e47:	ff 75 10             	push   0x10(%ebp)
+  802e4a:	ff 75 0c             	push   0xc(%ebp)
+  802e4d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e50:	ff 70 0c             	push   0xc(%eax)
+  802e53:	e8 79 03 00 00       	call   8031d1 <nsipc_send>
+}
+  802e58:	c9                   	leave
+  802e59:	c3                   	ret
+
+00802e5a <devsock_read>:
+{
+  802e5a:	55                   	push   %ebp
+  802e5b:	89 e5                	mov    %esp,%ebp
+  802e5d:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802e60:	6a 00                	push   $0x0
+  802e62:	ff 75 10             	push   0x10(%ebp)
+  802e65:	ff 75 0c             	push   0xc(%ebp)
+  802e68:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e6b:	ff 70 0c             	push   0xc(%eax)
+  802e6e:	e8 ef 02 00 00       	call   803162 <nsipc_recv>
+}
+  802e73:	c9                   	leave
+  802e74:	c3                   	ret
+
+00802e75 <fd2sockid>:
+{
+  802e75:	55                   	push   %ebp
+  802e76:	89 e5                	mov    %esp,%ebp
+  802e78:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802e7b:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802e7e:	52                   	push   %edx
+  802e7f:	50                   	push   %eax
+  802e80:	e8 f7 e9 ff ff       	call   80187c <fd_lookup>
+  802e85:	83 c4 10             	add    $0x10,%esp
+  802e88:	85 c0                	test   %eax,%eax
+  802e8a:	78 10                	js     802e9c <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802e8c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e8f:	8b 0d 60 52 80 00    	mov    0x805260,%ecx
+  802e95:	39 08                	cmp    %ecx,(%eax)
+  802e97:	75 05                	jne    802e9e <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802e99:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802e9c:	c9                   	leave
+  802e9d:	c3                   	ret
+		return -E_NOT_SUPP;
+  802e9e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802ea3:	eb f7                	jmp    802e9c <fd2sockid+0x27>
+
+00802ea5 <alloc_sockfd>:
+{
+  802ea5:	55                   	push   %ebp
+  802ea6:	89 e5                	mov    %esp,%ebp
+  802ea8:	56                   	push   %esi
+  802ea9:	53                   	push   %ebx
+  802eaa:	83 ec 1c             	sub    $0x1c,%esp
+  802ead:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802eaf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802eb2:	50                   	push   %eax
+  802eb3:	e8 6e e9 ff ff       	call   801826 <fd_alloc>
+  802eb8:	89 c3                	mov    %eax,%ebx
+  802eba:	83 c4 10             	add    $0x10,%esp
+  802ebd:	85 c0                	test   %eax,%eax
+  802ebf:	78 43                	js     802f04 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802ec1:	83 ec 04             	sub    $0x4,%esp
+  802ec4:	68 07 04 00 00       	push   $0x407
+  802ec9:	ff 75 f4             	push   -0xc(%ebp)
+  802ecc:	6a 00                	push   $0x0
+  802ece:	e8 14 de ff ff       	call   800ce7 <sys_page_alloc>
+  802ed3:	89 c3                	mov    %eax,%ebx
+  802ed5:	83 c4 10             	add    $0x10,%esp
+  802ed8:	85 c0                	test   %eax,%eax
+  802eda:	78 28                	js     802f04 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802edc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802edf:	8b 15 60 52 80 00    	mov    0x805260,%edx
+  802ee5:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802ee7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802eea:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802ef1:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802ef4:	83 ec 0c             	sub    $0xc,%esp
+  802ef7:	50                   	push   %eax
+  802ef8:	e8 02 e9 ff ff       	call   8017ff <fd2num>
+  802efd:	89 c3                	mov    %eax,%ebx
+  802eff:	83 c4 10             	add    $0x10,%esp
+  802f02:	eb 0c                	jmp    802f10 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802f04:	83 ec 0c             	sub    $0xc,%esp
+  802f07:	56                   	push   %esi
+  802f08:	e8 e4 01 00 00       	call   8030f1 <nsipc_close>
+		return r;
+  802f0d:	83 c4 10             	add    $0x10,%esp
+}
+  802f10:	89 d8                	mov    %ebx,%eax
+  802f12:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f15:	5b                   	pop    %ebx
+  802f16:	5e                   	pop    %esi
+  802f17:	5d                   	pop    %ebp
+  802f18:	c3                   	ret
+
+00802f19 <accept>:
+{
+  802f19:	55                   	push   %ebp
+  802f1a:	89 e5                	mov    %esp,%ebp
+  802f1c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802f1f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f22:	e8 4e ff ff ff       	call   802e75 <fd2sockid>
+  802f27:	85 c0                	test   %eax,%eax
+  802f29:	78 1b                	js     802f46 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802f2b:	83 ec 04             	sub    $0x4,%esp
+  802f2e:	ff 75 10             	push   0x10(%ebp)
+  802f31:	ff 75 0c             	push   0xc(%ebp)
+  802f34:	50                   	push   %eax
+  802f35:	e8 0e 01 00 00       	call   803048 <nsipc_accept>
+  802f3a:	83 c4 10             	add    $0x10,%esp
+  802f3d:	85 c0                	test   %eax,%eax
+  802f3f:	78 05                	js     802f46 <accept+0x2d>
+	return alloc_sockfd(r);
+  802f41:	e8 5f ff ff ff       	call   802ea5 <alloc_sockfd>
+}
+  802f46:	c9                   	leave
+  802f47:	c3                   	ret
+
+00802f48 <bind>:
+{
+  802f48:	55                   	push   %ebp
+  802f49:	89 e5                	mov    %esp,%ebp
+  802f4b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802f4e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f51:	e8 1f ff ff ff       	call   802e75 <fd2sockid>
+  802f56:	85 c0                	test   %eax,%eax
+  802f58:	78 12                	js     802f6c <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802f5a:	83 ec 04             	sub    $0x4,%esp
+  802f5d:	ff 75 10             	push   0x10(%ebp)
+  802f60:	ff 75 0c             	push   0xc(%ebp)
+  802f63:	50                   	push   %eax
+  802f64:	e8 31 01 00 00       	call   80309a <nsipc_bind>
+  802f69:	83 c4 10             	add    $0x10,%esp
+}
+  802f6c:	c9                   	leave
+  802f6d:	c3                   	ret
+
+00802f6e <shutdown>:
+{
+  802f6e:	55                   	push   %ebp
+  802f6f:	89 e5                	mov    %esp,%ebp
+  802f71:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802f74:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f77:	e8 f9 fe ff ff       	call   802e75 <fd2sockid>
+  802f7c:	85 c0                	test   %eax,%eax
+  802f7e:	78 0f                	js     802f8f <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802f80:	83 ec 08             	sub    $0x8,%esp
+  802f83:	ff 75 0c             	push   0xc(%ebp)
+  802f86:	50                   	push   %eax
+  802f87:	e8 43 01 00 00       	call   8030cf <nsipc_shutdown>
+  802f8c:	83 c4 10             	add    $0x10,%esp
+}
+  802f8f:	c9                   	leave
+  802f90:	c3                   	ret
+
+00802f91 <connect>:
+{
+  802f91:	55                   	push   %ebp
+  802f92:	89 e5                	mov    %esp,%ebp
+  802f94:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802f97:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f9a:	e8 d6 fe ff ff       	call   802e75 <fd2sockid>
+  802f9f:	85 c0                	test   %eax,%eax
+  802fa1:	78 12                	js     802fb5 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802fa3:	83 ec 04             	sub    $0x4,%esp
+  802fa6:	ff 75 10             	push   0x10(%ebp)
+  802fa9:	ff 75 0c             	push   0xc(%ebp)
+  802fac:	50                   	push   %eax
+  802fad:	e8 59 01 00 00       	call   80310b <nsipc_connect>
+  802fb2:	83 c4 10             	add    $0x10,%esp
+}
+  802fb5:	c9                   	leave
+  802fb6:	c3                   	ret
+
+00802fb7 <listen>:
+{
+  802fb7:	55                   	push   %ebp
+  802fb8:	89 e5                	mov    %esp,%ebp
+  802fba:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802fbd:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fc0:	e8 b0 fe ff ff       	call   802e75 <fd2sockid>
+  802fc5:	85 c0                	test   %eax,%eax
+  802fc7:	78 0f                	js     802fd8 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802fc9:	83 ec 08             	sub    $0x8,%esp
+  802fcc:	ff 75 0c             	push   0xc(%ebp)
+  802fcf:	50                   	push   %eax
+  802fd0:	e8 6b 01 00 00       	call   803140 <nsipc_listen>
+  802fd5:	83 c4 10             	add    $0x10,%esp
+}
+  802fd8:	c9                   	leave
+  802fd9:	c3                   	ret
+
+00802fda <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802fda:	55                   	push   %ebp
+  802fdb:	89 e5                	mov    %esp,%ebp
+  802fdd:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802fe0:	ff 75 10             	push   0x10(%ebp)
+  802fe3:	ff 75 0c             	push   0xc(%ebp)
+  802fe6:	ff 75 08             	push   0x8(%ebp)
+  802fe9:	e8 41 02 00 00       	call   80322f <nsipc_socket>
+  802fee:	83 c4 10             	add    $0x10,%esp
+  802ff1:	85 c0                	test   %eax,%eax
+  802ff3:	78 05                	js     802ffa <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802ff5:	e8 ab fe ff ff       	call   802ea5 <alloc_sockfd>
+}
+  802ffa:	c9                   	leave
+  802ffb:	c3                   	ret
+
+00802ffc <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802ffc:	55                   	push   %ebp
+  802ffd:	89 e5                	mov    %esp,%ebp
+  802fff:	53                   	push   %ebx
+  803000:	83 ec 04             	sub    $0x4,%esp
+  803003:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  803005:	83 3d 08 60 80 00 00 	cmpl   $0x0,0x806008
+  80300c:	74 26                	je     803034 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  80300e:	6a 07                	push   $0x7
+  803010:	68 00 80 80 00       	push   $0x808000
+  803015:	53                   	push   %ebx
+  803016:	ff 35 08 60 80 00    	push   0x806008
+  80301c:	e8 76 14 00 00       	call   804497 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  803021:	83 c4 0c             	add    $0xc,%esp
+  803024:	6a 00                	push   $0x0
+  803026:	6a 00                	push   $0x0
+  803028:	6a 00                	push   $0x0
+  80302a:	e8 72 13 00 00       	call   8043a1 <ipc_recv>
+}
+  80302f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803032:	c9                   	leave
+  803033:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  803034:	83 ec 0c             	sub    $0xc,%esp
+  803037:	6a 02                	push   $0x2
+  803039:	e8 af 14 00 00       	call   8044ed <ipc_find_env>
+  80303e:	a3 08 60 80 00       	mov    %eax,0x806008
+  803043:	83 c4 10             	add    $0x10,%esp
+  803046:	eb c6                	jmp    80300e <nsipc+0x12>
+
+00803048 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  803048:	55                   	push   %ebp
+  803049:	89 e5                	mov    %esp,%ebp
+  80304b:	56                   	push   %esi
+  80304c:	53                   	push   %ebx
+  80304d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  803050:	8b 45 08             	mov    0x8(%ebp),%eax
+  803053:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  803058:	8b 06                	mov    (%esi),%eax
+  80305a:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80305f:	b8 01 00 00 00       	mov    $0x1,%eax
+  803064:	e8 93 ff ff ff       	call   802ffc <nsipc>
+  803069:	89 c3                	mov    %eax,%ebx
+  80306b:	85 c0                	test   %eax,%eax
+  80306d:	79 09                	jns    803078 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  80306f:	89 d8                	mov    %ebx,%eax
+  803071:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803074:	5b                   	pop    %ebx
+  803075:	5e                   	pop    %esi
+  803076:	5d                   	pop    %ebp
+  803077:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  803078:	83 ec 04             	sub    $0x4,%esp
+  80307b:	ff 35 10 80 80 00    	push   0x808010
+  803081:	68 00 80 80 00       	push   $0x808000
+  803086:	ff 75 0c             	push   0xc(%ebp)
+  803089:	e8 a1 d9 ff ff       	call   800a2f <memmove>
+		*addrlen = ret->ret_addrlen;
+  80308e:	a1 10 80 80 00       	mov    0x808010,%eax
+  803093:	89 06                	mov    %eax,(%esi)
+  803095:	83 c4 10             	add    $0x10,%esp
+	return r;
+  803098:	eb d5                	jmp    80306f <nsipc_accept+0x27>
+
+0080309a <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80309a:	55                   	push   %ebp
+  80309b:	89 e5                	mov    %esp,%ebp
+  80309d:	53                   	push   %ebx
+  80309e:	83 ec 08             	sub    $0x8,%esp
+  8030a1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8030a4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030a7:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8030ac:	53                   	push   %ebx
+  8030ad:	ff 75 0c             	push   0xc(%ebp)
+  8030b0:	68 04 80 80 00       	push   $0x808004
+  8030b5:	e8 75 d9 ff ff       	call   800a2f <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8030ba:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  8030c0:	b8 02 00 00 00       	mov    $0x2,%eax
+  8030c5:	e8 32 ff ff ff       	call   802ffc <nsipc>
+}
+  8030ca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8030cd:	c9                   	leave
+  8030ce:	c3                   	ret
+
+008030cf <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8030cf:	55                   	push   %ebp
+  8030d0:	89 e5                	mov    %esp,%ebp
+  8030d2:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8030d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030d8:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  8030dd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8030e0:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  8030e5:	b8 03 00 00 00       	mov    $0x3,%eax
+  8030ea:	e8 0d ff ff ff       	call   802ffc <nsipc>
+}
+  8030ef:	c9                   	leave
+  8030f0:	c3                   	ret
+
+008030f1 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8030f1:	55                   	push   %ebp
+  8030f2:	89 e5                	mov    %esp,%ebp
+  8030f4:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8030f7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030fa:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  8030ff:	b8 04 00 00 00       	mov    $0x4,%eax
+  803104:	e8 f3 fe ff ff       	call   802ffc <nsipc>
+}
+  803109:	c9                   	leave
+  80310a:	c3                   	ret
+
+0080310b <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80310b:	55                   	push   %ebp
+  80310c:	89 e5                	mov    %esp,%ebp
+  80310e:	53                   	push   %ebx
+  80310f:	83 ec 08             	sub    $0x8,%esp
+  803112:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  803115:	8b 45 08             	mov    0x8(%ebp),%eax
+  803118:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  80311d:	53                   	push   %ebx
+  80311e:	ff 75 0c             	push   0xc(%ebp)
+  803121:	68 04 80 80 00       	push   $0x808004
+  803126:	e8 04 d9 ff ff       	call   800a2f <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  80312b:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  803131:	b8 05 00 00 00       	mov    $0x5,%eax
+  803136:	e8 c1 fe ff ff       	call   802ffc <nsipc>
+}
+  80313b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80313e:	c9                   	leave
+  80313f:	c3                   	ret
+
+00803140 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  803140:	55                   	push   %ebp
+  803141:	89 e5                	mov    %esp,%ebp
+  803143:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  803146:	8b 45 08             	mov    0x8(%ebp),%eax
+  803149:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  80314e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803151:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  803156:	b8 06 00 00 00       	mov    $0x6,%eax
+  80315b:	e8 9c fe ff ff       	call   802ffc <nsipc>
+}
+  803160:	c9                   	leave
+  803161:	c3                   	ret
+
+00803162 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  803162:	55                   	push   %ebp
+  803163:	89 e5                	mov    %esp,%ebp
+  803165:	56                   	push   %esi
+  803166:	53                   	push   %ebx
+  803167:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80316a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80316d:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  803172:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  803178:	8b 45 14             	mov    0x14(%ebp),%eax
+  80317b:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  803180:	b8 07 00 00 00       	mov    $0x7,%eax
+  803185:	e8 72 fe ff ff       	call   802ffc <nsipc>
+  80318a:	89 c3                	mov    %eax,%ebx
+  80318c:	85 c0                	test   %eax,%eax
+  80318e:	78 22                	js     8031b2 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  803190:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  803195:	39 c6                	cmp    %eax,%esi
+  803197:	0f 4e c6             	cmovle %esi,%eax
+  80319a:	39 c3                	cmp    %eax,%ebx
+  80319c:	7f 1d                	jg     8031bb <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  80319e:	83 ec 04             	sub    $0x4,%esp
+  8031a1:	53                   	push   %ebx
+  8031a2:	68 00 80 80 00       	push   $0x808000
+  8031a7:	ff 75 0c             	push   0xc(%ebp)
+  8031aa:	e8 80 d8 ff ff       	call   800a2f <memmove>
+  8031af:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8031b2:	89 d8                	mov    %ebx,%eax
+  8031b4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8031b7:	5b                   	pop    %ebx
+  8031b8:	5e                   	pop    %esi
+  8031b9:	5d                   	pop    %ebp
+  8031ba:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8031bb:	68 74 4e 80 00       	push   $0x804e74
+  8031c0:	68 71 4d 80 00       	push   $0x804d71
+  8031c5:	6a 62                	push   $0x62
+  8031c7:	68 89 4e 80 00       	push   $0x804e89
+  8031cc:	e8 19 d0 ff ff       	call   8001ea <_panic>
+
+008031d1 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8031d1:	55                   	push   %ebp
+  8031d2:	89 e5                	mov    %esp,%ebp
+  8031d4:	53                   	push   %ebx
+  8031d5:	83 ec 04             	sub    $0x4,%esp
+  8031d8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8031db:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031de:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  8031e3:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8031e9:	7f 2e                	jg     803219 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8031eb:	83 ec 04             	sub    $0x4,%esp
+  8031ee:	53                   	push   %ebx
+  8031ef:	ff 75 0c             	push   0xc(%ebp)
+  8031f2:	68 0c 80 80 00       	push   $0x80800c
+  8031f7:	e8 33 d8 ff ff       	call   800a2f <memmove>
+	nsipcbuf.send.req_size = size;
+  8031fc:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  803202:	8b 45 14             	mov    0x14(%ebp),%eax
+  803205:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  80320a:	b8 08 00 00 00       	mov    $0x8,%eax
+  80320f:	e8 e8 fd ff ff       	call   802ffc <nsipc>
+}
+  803214:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803217:	c9                   	leave
+  803218:	c3                   	ret
+	assert(size < 1600);
+  803219:	68 95 4e 80 00       	push   $0x804e95
+  80321e:	68 71 4d 80 00       	push   $0x804d71
+  803223:	6a 6d                	push   $0x6d
+  803225:	68 89 4e 80 00       	push   $0x804e89
+  80322a:	e8 bb cf ff ff       	call   8001ea <_panic>
+
+0080322f <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80322f:	55                   	push   %ebp
+  803230:	89 e5                	mov    %esp,%ebp
+  803232:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  803235:	8b 45 08             	mov    0x8(%ebp),%eax
+  803238:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  80323d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803240:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  803245:	8b 45 10             	mov    0x10(%ebp),%eax
+  803248:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  80324d:	b8 09 00 00 00       	mov    $0x9,%eax
+  803252:	e8 a5 fd ff ff       	call   802ffc <nsipc>
+}
+  803257:	c9                   	leave
+  803258:	c3                   	ret
+
+00803259 <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  803259:	55                   	push   %ebp
+  80325a:	89 e5                	mov    %esp,%ebp
+  80325c:	53                   	push   %ebx
+  80325d:	83 ec 10             	sub    $0x10,%esp
+  803260:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  803263:	68 0c 60 80 00       	push   $0x80600c
+  803268:	e8 50 07 00 00       	call   8039bd <mutex_lock>
+	if (v == 0)
+  80326d:	83 c4 10             	add    $0x10,%esp
+  803270:	85 db                	test   %ebx,%ebx
+  803272:	0f 84 85 00 00 00    	je     8032fd <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  803278:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  80327e:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  803283:	77 51                	ja     8032d6 <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  803285:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  80328b:	89 d8                	mov    %ebx,%eax
+  80328d:	c1 e8 0c             	shr    $0xc,%eax
+  803290:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803297:	f6 c4 02             	test   $0x2,%ah
+  80329a:	74 50                	je     8032ec <free+0x93>
+		sys_page_unmap(0, c);
+  80329c:	83 ec 08             	sub    $0x8,%esp
+  80329f:	53                   	push   %ebx
+  8032a0:	6a 00                	push   $0x0
+  8032a2:	e8 d9 da ff ff       	call   800d80 <sys_page_unmap>
+		c += PGSIZE;
+  8032a7:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  8032ad:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  8032b3:	83 c4 10             	add    $0x10,%esp
+  8032b6:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  8032bb:	76 ce                	jbe    80328b <free+0x32>
+  8032bd:	68 df 4e 80 00       	push   $0x804edf
+  8032c2:	68 71 4d 80 00       	push   $0x804d71
+  8032c7:	68 82 00 00 00       	push   $0x82
+  8032cc:	68 d2 4e 80 00       	push   $0x804ed2
+  8032d1:	e8 14 cf ff ff       	call   8001ea <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  8032d6:	68 a4 4e 80 00       	push   $0x804ea4
+  8032db:	68 71 4d 80 00       	push   $0x804d71
+  8032e0:	6a 7b                	push   $0x7b
+  8032e2:	68 d2 4e 80 00       	push   $0x804ed2
+  8032e7:	e8 fe ce ff ff       	call   8001ea <_panic>
+	if (--(*ref) == 0)
+  8032ec:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  8032f2:	83 e8 01             	sub    $0x1,%eax
+  8032f5:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  8032fb:	74 15                	je     803312 <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  8032fd:	83 ec 0c             	sub    $0xc,%esp
+  803300:	68 0c 60 80 00       	push   $0x80600c
+  803305:	e8 20 07 00 00       	call   803a2a <mutex_unlock>
+}
+  80330a:	83 c4 10             	add    $0x10,%esp
+  80330d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803310:	c9                   	leave
+  803311:	c3                   	ret
+		sys_page_unmap(0, c);
+  803312:	83 ec 08             	sub    $0x8,%esp
+  803315:	53                   	push   %ebx
+  803316:	6a 00                	push   $0x0
+  803318:	e8 63 da ff ff       	call   800d80 <sys_page_unmap>
+  80331d:	83 c4 10             	add    $0x10,%esp
+  803320:	eb db                	jmp    8032fd <free+0xa4>
+
+00803322 <malloc>:
+{
+  803322:	55                   	push   %ebp
+  803323:	89 e5                	mov    %esp,%ebp
+  803325:	57                   	push   %edi
+  803326:	56                   	push   %esi
+  803327:	53                   	push   %ebx
+  803328:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  80332b:	68 0c 60 80 00       	push   $0x80600c
+  803330:	e8 88 06 00 00       	call   8039bd <mutex_lock>
+	if (mptr == 0)
+  803335:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+  80333b:	83 c4 10             	add    $0x10,%esp
+  80333e:	85 ff                	test   %edi,%edi
+  803340:	74 6c                	je     8033ae <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  803342:	8b 45 08             	mov    0x8(%ebp),%eax
+  803345:	83 c0 03             	add    $0x3,%eax
+  803348:	83 e0 fc             	and    $0xfffffffc,%eax
+  80334b:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  80334d:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  803352:	0f 87 64 01 00 00    	ja     8034bc <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  803358:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  80335e:	74 30                	je     803390 <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  803360:	89 f9                	mov    %edi,%ecx
+  803362:	c1 e9 0c             	shr    $0xc,%ecx
+  803365:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  803369:	c1 e8 0c             	shr    $0xc,%eax
+  80336c:	39 c1                	cmp    %eax,%ecx
+  80336e:	74 5f                	je     8033cf <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  803370:	83 ec 0c             	sub    $0xc,%esp
+  803373:	57                   	push   %edi
+  803374:	e8 e0 fe ff ff       	call   803259 <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  803379:	a1 10 60 80 00       	mov    0x806010,%eax
+  80337e:	05 00 10 00 00       	add    $0x1000,%eax
+  803383:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803388:	a3 10 60 80 00       	mov    %eax,0x806010
+  80338d:	83 c4 10             	add    $0x10,%esp
+  803390:	8b 0d 10 60 80 00    	mov    0x806010,%ecx
+{
+  803396:	ba 02 00 00 00       	mov    $0x2,%edx
+  80339b:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  80339f:	8d 7e 04             	lea    0x4(%esi),%edi
+  8033a2:	89 cb                	mov    %ecx,%ebx
+  8033a4:	01 f9                	add    %edi,%ecx
+  8033a6:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8033a9:	e9 8b 00 00 00       	jmp    803439 <malloc+0x117>
+		mptr = mbegin;
+  8033ae:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  8033b5:	00 00 08 
+	n = ROUNDUP(n, 4);
+  8033b8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033bb:	83 c0 03             	add    $0x3,%eax
+  8033be:	83 e0 fc             	and    $0xfffffffc,%eax
+  8033c1:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  8033c3:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  8033c8:	76 c6                	jbe    803390 <malloc+0x6e>
+  8033ca:	e9 d6 00 00 00       	jmp    8034a5 <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  8033cf:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  8033d5:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  8033da:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  8033de:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  8033e1:	a3 10 60 80 00       	mov    %eax,0x806010
+			return v;
+  8033e6:	e9 ba 00 00 00       	jmp    8034a5 <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  8033eb:	05 00 10 00 00       	add    $0x1000,%eax
+  8033f0:	39 c8                	cmp    %ecx,%eax
+  8033f2:	0f 83 cb 00 00 00    	jae    8034c3 <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  8033f8:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  8033fd:	77 22                	ja     803421 <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  8033ff:	89 c2                	mov    %eax,%edx
+  803401:	c1 ea 16             	shr    $0x16,%edx
+  803404:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80340b:	f6 c2 01             	test   $0x1,%dl
+  80340e:	74 db                	je     8033eb <malloc+0xc9>
+  803410:	89 c2                	mov    %eax,%edx
+  803412:	c1 ea 0c             	shr    $0xc,%edx
+  803415:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80341c:	f6 c2 01             	test   $0x1,%dl
+  80341f:	74 ca                	je     8033eb <malloc+0xc9>
+		if (mptr == mend) {
+  803421:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803427:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  80342d:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  803431:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  803437:	74 04                	je     80343d <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  803439:	89 d8                	mov    %ebx,%eax
+  80343b:	eb b3                	jmp    8033f0 <malloc+0xce>
+  80343d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  803440:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  803445:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  803449:	83 ea 01             	sub    $0x1,%edx
+  80344c:	0f 85 50 ff ff ff    	jne    8033a2 <malloc+0x80>
+  803452:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  803459:	00 00 08 
+				return 0;	/* out of address space */
+  80345c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803461:	eb 42                	jmp    8034a5 <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  803463:	85 db                	test   %ebx,%ebx
+  803465:	78 1e                	js     803485 <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  803467:	83 ec 08             	sub    $0x8,%esp
+  80346a:	89 d8                	mov    %ebx,%eax
+  80346c:	03 05 10 60 80 00    	add    0x806010,%eax
+  803472:	50                   	push   %eax
+  803473:	6a 00                	push   $0x0
+  803475:	e8 06 d9 ff ff       	call   800d80 <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  80347a:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  803480:	83 c4 10             	add    $0x10,%esp
+  803483:	eb de                	jmp    803463 <malloc+0x141>
+			return 0;	/* out of physical memory */
+  803485:	bf 00 00 00 00       	mov    $0x0,%edi
+  80348a:	eb 19                	jmp    8034a5 <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  80348c:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80348f:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  803495:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  80349c:	00 
+	mptr += n;
+  80349d:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  8034a0:	a3 10 60 80 00       	mov    %eax,0x806010
+	mutex_unlock(&malloc_mu);
+  8034a5:	83 ec 0c             	sub    $0xc,%esp
+  8034a8:	68 0c 60 80 00       	push   $0x80600c
+  8034ad:	e8 78 05 00 00       	call   803a2a <mutex_unlock>
+}
+  8034b2:	89 f8                	mov    %edi,%eax
+  8034b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034b7:	5b                   	pop    %ebx
+  8034b8:	5e                   	pop    %esi
+  8034b9:	5f                   	pop    %edi
+  8034ba:	5d                   	pop    %ebp
+  8034bb:	c3                   	ret
+		return 0;
+  8034bc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034c1:	eb e2                	jmp    8034a5 <malloc+0x183>
+  8034c3:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  8034c7:	74 06                	je     8034cf <malloc+0x1ad>
+  8034c9:	89 1d 10 60 80 00    	mov    %ebx,0x806010
+	for (i = 0; i < n + 4; i += PGSIZE){
+  8034cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8034d4:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8034d7:	39 fb                	cmp    %edi,%ebx
+  8034d9:	73 b1                	jae    80348c <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  8034db:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  8034e1:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  8034e4:	39 fe                	cmp    %edi,%esi
+  8034e6:	0f 92 c0             	setb   %al
+  8034e9:	0f b6 c0             	movzbl %al,%eax
+  8034ec:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  8034ef:	83 c8 07             	or     $0x7,%eax
+  8034f2:	50                   	push   %eax
+  8034f3:	89 d8                	mov    %ebx,%eax
+  8034f5:	03 05 10 60 80 00    	add    0x806010,%eax
+  8034fb:	50                   	push   %eax
+  8034fc:	6a 00                	push   $0x0
+  8034fe:	e8 e4 d7 ff ff       	call   800ce7 <sys_page_alloc>
+  803503:	83 c4 10             	add    $0x10,%esp
+  803506:	85 c0                	test   %eax,%eax
+  803508:	0f 88 55 ff ff ff    	js     803463 <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  80350e:	89 f3                	mov    %esi,%ebx
+  803510:	eb c5                	jmp    8034d7 <malloc+0x1b5>
+
+00803512 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  803512:	55                   	push   %ebp
+  803513:	89 e5                	mov    %esp,%ebp
+  803515:	56                   	push   %esi
+  803516:	53                   	push   %ebx
+  803517:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80351a:	83 ec 0c             	sub    $0xc,%esp
+  80351d:	ff 75 08             	push   0x8(%ebp)
+  803520:	e8 ea e2 ff ff       	call   80180f <fd2data>
+  803525:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  803527:	83 c4 08             	add    $0x8,%esp
+  80352a:	68 f7 4e 80 00       	push   $0x804ef7
+  80352f:	53                   	push   %ebx
+  803530:	e8 74 d3 ff ff       	call   8008a9 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  803535:	8b 46 04             	mov    0x4(%esi),%eax
+  803538:	2b 06                	sub    (%esi),%eax
+  80353a:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  803540:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803547:	00 00 00 
+	stat->st_dev = &devpipe;
+  80354a:	c7 83 88 00 00 00 7c 	movl   $0x80527c,0x88(%ebx)
+  803551:	52 80 00 
+	return 0;
+}
+  803554:	b8 00 00 00 00       	mov    $0x0,%eax
+  803559:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80355c:	5b                   	pop    %ebx
+  80355d:	5e                   	pop    %esi
+  80355e:	5d                   	pop    %ebp
+  80355f:	c3                   	ret
+
+00803560 <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  803560:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803565:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  803569:	85 c9                	test   %ecx,%ecx
+  80356b:	75 01                	jne    80356e <pipewake+0xe>
+  80356d:	c3                   	ret
+{
+  80356e:	55                   	push   %ebp
+  80356f:	89 e5                	mov    %esp,%ebp
+  803571:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  803574:	68 00 04 00 00       	push   $0x400
+  803579:	52                   	push   %edx
+  80357a:	e8 ac da ff ff       	call   80102b <sys_futex_wake>
+  80357f:	83 c4 10             	add    $0x10,%esp
+}
+  803582:	c9                   	leave
+  803583:	c3                   	ret
+
+00803584 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803584:	55                   	push   %ebp
+  803585:	89 e5                	mov    %esp,%ebp
+  803587:	56                   	push   %esi
+  803588:	53                   	push   %ebx
+  803589:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80358c:	83 ec 0c             	sub    $0xc,%esp
+  80358f:	56                   	push   %esi
+  803590:	e8 7a e2 ff ff       	call   80180f <fd2data>
+  803595:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  803597:	83 c4 08             	add    $0x8,%esp
+  80359a:	56                   	push   %esi
+  80359b:	6a 00                	push   $0x0
+  80359d:	e8 de d7 ff ff       	call   800d80 <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  8035a2:	8d 53 04             	lea    0x4(%ebx),%edx
+  8035a5:	8d 43 08             	lea    0x8(%ebx),%eax
+  8035a8:	e8 b3 ff ff ff       	call   803560 <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  8035ad:	8d 43 0c             	lea    0xc(%ebx),%eax
+  8035b0:	89 da                	mov    %ebx,%edx
+  8035b2:	e8 a9 ff ff ff       	call   803560 <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  8035b7:	89 34 24             	mov    %esi,(%esp)
+  8035ba:	e8 50 e2 ff ff       	call   80180f <fd2data>
+  8035bf:	83 c4 08             	add    $0x8,%esp
+  8035c2:	50                   	push   %eax
+  8035c3:	6a 00                	push   $0x0
+  8035c5:	e8 b6 d7 ff ff       	call   800d80 <sys_page_unmap>
+}
+  8035ca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8035cd:	5b                   	pop    %ebx
+  8035ce:	5e                   	pop    %esi
+  8035cf:	5d                   	pop    %ebp
+  8035d0:	c3                   	ret
+
+008035d1 <_pipeisclosed>:
+{
+  8035d1:	55                   	push   %ebp
+  8035d2:	89 e5                	mov    %esp,%ebp
+  8035d4:	57                   	push   %edi
+  8035d5:	56                   	push   %esi
+  8035d6:	53                   	push   %ebx
+  8035d7:	83 ec 1c             	sub    $0x1c,%esp
+  8035da:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8035dd:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8035df:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  8035e4:	eb 5d                	jmp    803643 <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  8035e6:	8b 15 c4 62 80 00    	mov    0x8062c4,%edx
+		n = thisenv->env_runs;
+  8035ec:	8b 02                	mov    (%edx),%eax
+  8035ee:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8035f1:	83 ec 0c             	sub    $0xc,%esp
+  8035f4:	ff 75 e0             	push   -0x20(%ebp)
+  8035f7:	e8 30 0f 00 00       	call   80452c <pageref>
+  8035fc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8035ff:	89 3c 24             	mov    %edi,(%esp)
+  803602:	e8 25 0f 00 00       	call   80452c <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  803607:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803609:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  80360f:	83 c4 10             	add    $0x10,%esp
+  803612:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803618:	77 15                	ja     80362f <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80361a:	89 f2                	mov    %esi,%edx
+  80361c:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  80361e:	c1 ea 10             	shr    $0x10,%edx
+  803621:	74 0c                	je     80362f <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803623:	c1 e2 10             	shl    $0x10,%edx
+  803626:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80362b:	29 d1                	sub    %edx,%ecx
+  80362d:	eb 06                	jmp    803635 <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  80362f:	8b 0d c4 62 80 00    	mov    0x8062c4,%ecx
+		nn = thisenv->env_runs;
+  803635:	8b 11                	mov    (%ecx),%edx
+  803637:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  80363a:	39 d3                	cmp    %edx,%ebx
+  80363c:	74 6e                	je     8036ac <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  80363e:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803641:	74 24                	je     803667 <_pipeisclosed+0x96>
+  803643:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803645:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80364b:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803650:	77 94                	ja     8035e6 <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803652:	89 f0                	mov    %esi,%eax
+  803654:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803656:	c1 e8 10             	shr    $0x10,%eax
+  803659:	74 8b                	je     8035e6 <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80365b:	c1 e0 10             	shl    $0x10,%eax
+  80365e:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803663:	29 c2                	sub    %eax,%edx
+  803665:	eb 85                	jmp    8035ec <_pipeisclosed+0x1b>
+  803667:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803669:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80366f:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803674:	77 18                	ja     80368e <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803676:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80367b:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80367d:	c1 e8 10             	shr    $0x10,%eax
+  803680:	74 0c                	je     80368e <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803682:	c1 e0 10             	shl    $0x10,%eax
+  803685:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80368a:	29 c2                	sub    %eax,%edx
+  80368c:	eb 06                	jmp    803694 <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  80368e:	8b 15 c4 62 80 00    	mov    0x8062c4,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803694:	8b 02                	mov    (%edx),%eax
+  803696:	8b 40 58             	mov    0x58(%eax),%eax
+  803699:	6a 01                	push   $0x1
+  80369b:	50                   	push   %eax
+  80369c:	53                   	push   %ebx
+  80369d:	68 fe 4e 80 00       	push   $0x804efe
+  8036a2:	e8 1e cc ff ff       	call   8002c5 <cprintf>
+  8036a7:	83 c4 10             	add    $0x10,%esp
+  8036aa:	eb 97                	jmp    803643 <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  8036ac:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8036af:	0f 94 c0             	sete   %al
+  8036b2:	0f b6 c0             	movzbl %al,%eax
+}
+  8036b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036b8:	5b                   	pop    %ebx
+  8036b9:	5e                   	pop    %esi
+  8036ba:	5f                   	pop    %edi
+  8036bb:	5d                   	pop    %ebp
+  8036bc:	c3                   	ret
+
+008036bd <devpipe_write>:
+{
+  8036bd:	55                   	push   %ebp
+  8036be:	89 e5                	mov    %esp,%ebp
+  8036c0:	57                   	push   %edi
+  8036c1:	56                   	push   %esi
+  8036c2:	53                   	push   %ebx
+  8036c3:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  8036c6:	ff 75 08             	push   0x8(%ebp)
+  8036c9:	e8 41 e1 ff ff       	call   80180f <fd2data>
+  8036ce:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8036d0:	83 c4 10             	add    $0x10,%esp
+  8036d3:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  8036da:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  8036dd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8036e0:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8036e3:	0f 84 96 00 00 00    	je     80377f <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  8036e9:	8d 73 08             	lea    0x8(%ebx),%esi
+  8036ec:	eb 32                	jmp    803720 <devpipe_write+0x63>
+  8036ee:	89 fa                	mov    %edi,%edx
+  8036f0:	89 f0                	mov    %esi,%eax
+  8036f2:	e8 69 fe ff ff       	call   803560 <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  8036f7:	8b 43 04             	mov    0x4(%ebx),%eax
+  8036fa:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  8036fd:	ba 01 00 00 00       	mov    $0x1,%edx
+  803702:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  803707:	83 ec 04             	sub    $0x4,%esp
+  80370a:	6a 0a                	push   $0xa
+  80370c:	50                   	push   %eax
+  80370d:	53                   	push   %ebx
+  80370e:	e8 e9 d8 ff ff       	call   800ffc <sys_futex_wait>
+  803713:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803718:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  80371d:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  803720:	8b 43 04             	mov    0x4(%ebx),%eax
+  803723:	8b 0b                	mov    (%ebx),%ecx
+  803725:	8d 51 20             	lea    0x20(%ecx),%edx
+  803728:	39 d0                	cmp    %edx,%eax
+  80372a:	72 1b                	jb     803747 <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  80372c:	89 da                	mov    %ebx,%edx
+  80372e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803731:	e8 9b fe ff ff       	call   8035d1 <_pipeisclosed>
+  803736:	85 c0                	test   %eax,%eax
+  803738:	74 b4                	je     8036ee <devpipe_write+0x31>
+				return 0;
+  80373a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80373f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803742:	5b                   	pop    %ebx
+  803743:	5e                   	pop    %esi
+  803744:	5f                   	pop    %edi
+  803745:	5d                   	pop    %ebp
+  803746:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803747:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80374a:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80374d:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  803751:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  803754:	89 c2                	mov    %eax,%edx
+  803756:	c1 fa 1f             	sar    $0x1f,%edx
+  803759:	89 d1                	mov    %edx,%ecx
+  80375b:	c1 e9 1b             	shr    $0x1b,%ecx
+  80375e:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  803761:	83 e2 1f             	and    $0x1f,%edx
+  803764:	29 ca                	sub    %ecx,%edx
+  803766:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  80376a:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  80376e:	83 c0 01             	add    $0x1,%eax
+  803771:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  803774:	83 c6 01             	add    $0x1,%esi
+  803777:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  80377a:	e9 5e ff ff ff       	jmp    8036dd <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  80377f:	8d 53 04             	lea    0x4(%ebx),%edx
+  803782:	8d 43 08             	lea    0x8(%ebx),%eax
+  803785:	e8 d6 fd ff ff       	call   803560 <pipewake>
+	return i;
+  80378a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80378d:	eb b0                	jmp    80373f <devpipe_write+0x82>
+
+0080378f <devpipe_read>:
+{
+  80378f:	55                   	push   %ebp
+  803790:	89 e5                	mov    %esp,%ebp
+  803792:	57                   	push   %edi
+  803793:	56                   	push   %esi
+  803794:	53                   	push   %ebx
+  803795:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  803798:	ff 75 08             	push   0x8(%ebp)
+  80379b:	e8 6f e0 ff ff       	call   80180f <fd2data>
+  8037a0:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8037a2:	83 c4 10             	add    $0x10,%esp
+  8037a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8037aa:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8037ad:	74 6c                	je     80381b <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  8037af:	8d 7b 04             	lea    0x4(%ebx),%edi
+  8037b2:	eb 25                	jmp    8037d9 <devpipe_read+0x4a>
+  8037b4:	8b 13                	mov    (%ebx),%edx
+  8037b6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8037bb:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  8037c0:	83 ec 04             	sub    $0x4,%esp
+  8037c3:	6a 0a                	push   $0xa
+  8037c5:	52                   	push   %edx
+  8037c6:	57                   	push   %edi
+  8037c7:	e8 30 d8 ff ff       	call   800ffc <sys_futex_wait>
+  8037cc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8037d1:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  8037d6:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  8037d9:	8b 03                	mov    (%ebx),%eax
+  8037db:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8037de:	75 19                	jne    8037f9 <devpipe_read+0x6a>
+			if (i > 0)
+  8037e0:	85 f6                	test   %esi,%esi
+  8037e2:	75 3a                	jne    80381e <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  8037e4:	89 da                	mov    %ebx,%edx
+  8037e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037e9:	e8 e3 fd ff ff       	call   8035d1 <_pipeisclosed>
+  8037ee:	85 c0                	test   %eax,%eax
+  8037f0:	74 c2                	je     8037b4 <devpipe_read+0x25>
+				return 0;
+  8037f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037f7:	eb 31                	jmp    80382a <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8037f9:	89 c1                	mov    %eax,%ecx
+  8037fb:	c1 f9 1f             	sar    $0x1f,%ecx
+  8037fe:	c1 e9 1b             	shr    $0x1b,%ecx
+  803801:	01 c8                	add    %ecx,%eax
+  803803:	83 e0 1f             	and    $0x1f,%eax
+  803806:	29 c8                	sub    %ecx,%eax
+  803808:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  80380d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803810:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  803813:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  803816:	83 c6 01             	add    $0x1,%esi
+  803819:	eb 8f                	jmp    8037aa <devpipe_read+0x1b>
+out:
+  80381b:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  80381e:	8d 43 0c             	lea    0xc(%ebx),%eax
+  803821:	89 da                	mov    %ebx,%edx
+  803823:	e8 38 fd ff ff       	call   803560 <pipewake>
+	return i;
+  803828:	89 f0                	mov    %esi,%eax
+}
+  80382a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80382d:	5b                   	pop    %ebx
+  80382e:	5e                   	pop    %esi
+  80382f:	5f                   	pop    %edi
+  803830:	5d                   	pop    %ebp
+  803831:	c3                   	ret
+
+00803832 <pipe>:
+{
+  803832:	55                   	push   %ebp
+  803833:	89 e5                	mov    %esp,%ebp
+  803835:	56                   	push   %esi
+  803836:	53                   	push   %ebx
+  803837:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80383a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80383d:	50                   	push   %eax
+  80383e:	e8 e3 df ff ff       	call   801826 <fd_alloc>
+  803843:	89 c3                	mov    %eax,%ebx
+  803845:	83 c4 10             	add    $0x10,%esp
+  803848:	85 c0                	test   %eax,%eax
+  80384a:	0f 88 23 01 00 00    	js     803973 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803850:	83 ec 04             	sub    $0x4,%esp
+  803853:	68 07 04 00 00       	push   $0x407
+  803858:	ff 75 f4             	push   -0xc(%ebp)
+  80385b:	6a 00                	push   $0x0
+  80385d:	e8 85 d4 ff ff       	call   800ce7 <sys_page_alloc>
+  803862:	89 c3                	mov    %eax,%ebx
+  803864:	83 c4 10             	add    $0x10,%esp
+  803867:	85 c0                	test   %eax,%eax
+  803869:	0f 88 04 01 00 00    	js     803973 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80386f:	83 ec 0c             	sub    $0xc,%esp
+  803872:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803875:	50                   	push   %eax
+  803876:	e8 ab df ff ff       	call   801826 <fd_alloc>
+  80387b:	89 c3                	mov    %eax,%ebx
+  80387d:	83 c4 10             	add    $0x10,%esp
+  803880:	85 c0                	test   %eax,%eax
+  803882:	0f 88 db 00 00 00    	js     803963 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803888:	83 ec 04             	sub    $0x4,%esp
+  80388b:	68 07 04 00 00       	push   $0x407
+  803890:	ff 75 f0             	push   -0x10(%ebp)
+  803893:	6a 00                	push   $0x0
+  803895:	e8 4d d4 ff ff       	call   800ce7 <sys_page_alloc>
+  80389a:	89 c3                	mov    %eax,%ebx
+  80389c:	83 c4 10             	add    $0x10,%esp
+  80389f:	85 c0                	test   %eax,%eax
+  8038a1:	0f 88 bc 00 00 00    	js     803963 <pipe+0x131>
+	va = fd2data(fd0);
+  8038a7:	83 ec 0c             	sub    $0xc,%esp
+  8038aa:	ff 75 f4             	push   -0xc(%ebp)
+  8038ad:	e8 5d df ff ff       	call   80180f <fd2data>
+  8038b2:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8038b4:	83 c4 0c             	add    $0xc,%esp
+  8038b7:	68 07 04 00 00       	push   $0x407
+  8038bc:	50                   	push   %eax
+  8038bd:	6a 00                	push   $0x0
+  8038bf:	e8 23 d4 ff ff       	call   800ce7 <sys_page_alloc>
+  8038c4:	89 c3                	mov    %eax,%ebx
+  8038c6:	83 c4 10             	add    $0x10,%esp
+  8038c9:	85 c0                	test   %eax,%eax
+  8038cb:	0f 88 82 00 00 00    	js     803953 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8038d1:	83 ec 0c             	sub    $0xc,%esp
+  8038d4:	ff 75 f0             	push   -0x10(%ebp)
+  8038d7:	e8 33 df ff ff       	call   80180f <fd2data>
+  8038dc:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8038e3:	50                   	push   %eax
+  8038e4:	6a 00                	push   $0x0
+  8038e6:	56                   	push   %esi
+  8038e7:	6a 00                	push   $0x0
+  8038e9:	e8 46 d4 ff ff       	call   800d34 <sys_page_map>
+  8038ee:	89 c3                	mov    %eax,%ebx
+  8038f0:	83 c4 20             	add    $0x20,%esp
+  8038f3:	85 c0                	test   %eax,%eax
+  8038f5:	78 4e                	js     803945 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8038f7:	a1 7c 52 80 00       	mov    0x80527c,%eax
+  8038fc:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8038ff:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803901:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803904:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80390b:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80390e:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803910:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803913:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80391a:	83 ec 0c             	sub    $0xc,%esp
+  80391d:	ff 75 f4             	push   -0xc(%ebp)
+  803920:	e8 da de ff ff       	call   8017ff <fd2num>
+  803925:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803928:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80392a:	83 c4 04             	add    $0x4,%esp
+  80392d:	ff 75 f0             	push   -0x10(%ebp)
+  803930:	e8 ca de ff ff       	call   8017ff <fd2num>
+  803935:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803938:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80393b:	83 c4 10             	add    $0x10,%esp
+  80393e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803943:	eb 2e                	jmp    803973 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803945:	83 ec 08             	sub    $0x8,%esp
+  803948:	56                   	push   %esi
+  803949:	6a 00                	push   $0x0
+  80394b:	e8 30 d4 ff ff       	call   800d80 <sys_page_unmap>
+  803950:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803953:	83 ec 08             	sub    $0x8,%esp
+  803956:	ff 75 f0             	push   -0x10(%ebp)
+  803959:	6a 00                	push   $0x0
+  80395b:	e8 20 d4 ff ff       	call   800d80 <sys_page_unmap>
+  803960:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803963:	83 ec 08             	sub    $0x8,%esp
+  803966:	ff 75 f4             	push   -0xc(%ebp)
+  803969:	6a 00                	push   $0x0
+  80396b:	e8 10 d4 ff ff       	call   800d80 <sys_page_unmap>
+  803970:	83 c4 10             	add    $0x10,%esp
+}
+  803973:	89 d8                	mov    %ebx,%eax
+  803975:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803978:	5b                   	pop    %ebx
+  803979:	5e                   	pop    %esi
+  80397a:	5d                   	pop    %ebp
+  80397b:	c3                   	ret
+
+0080397c <pipeisclosed>:
+{
+  80397c:	55                   	push   %ebp
+  80397d:	89 e5                	mov    %esp,%ebp
+  80397f:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803982:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803985:	50                   	push   %eax
+  803986:	ff 75 08             	push   0x8(%ebp)
+  803989:	e8 ee de ff ff       	call   80187c <fd_lookup>
+  80398e:	83 c4 10             	add    $0x10,%esp
+  803991:	85 c0                	test   %eax,%eax
+  803993:	78 18                	js     8039ad <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803995:	83 ec 0c             	sub    $0xc,%esp
+  803998:	ff 75 f4             	push   -0xc(%ebp)
+  80399b:	e8 6f de ff ff       	call   80180f <fd2data>
+  8039a0:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8039a2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8039a5:	e8 27 fc ff ff       	call   8035d1 <_pipeisclosed>
+  8039aa:	83 c4 10             	add    $0x10,%esp
+}
+  8039ad:	c9                   	leave
+  8039ae:	c3                   	ret
+
+008039af <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  8039af:	55                   	push   %ebp
+  8039b0:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  8039b2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8039b5:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8039bb:	5d                   	pop    %ebp
+  8039bc:	c3                   	ret
+
+008039bd <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  8039bd:	55                   	push   %ebp
+  8039be:	89 e5                	mov    %esp,%ebp
+  8039c0:	56                   	push   %esi
+  8039c1:	53                   	push   %ebx
+  8039c2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  8039c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8039ca:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8039cf:	89 d0                	mov    %edx,%eax
+  8039d1:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  8039d5:	85 c0                	test   %eax,%eax
+  8039d7:	74 2d                	je     803a06 <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  8039d9:	83 f8 02             	cmp    $0x2,%eax
+  8039dc:	74 08                	je     8039e6 <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  8039de:	b8 02 00 00 00       	mov    $0x2,%eax
+  8039e3:	f0 87 03             	lock xchg %eax,(%ebx)
+  8039e6:	be 02 00 00 00       	mov    $0x2,%esi
+  8039eb:	eb 15                	jmp    803a02 <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  8039ed:	83 ec 04             	sub    $0x4,%esp
+  8039f0:	6a 00                	push   $0x0
+  8039f2:	6a 02                	push   $0x2
+  8039f4:	53                   	push   %ebx
+  8039f5:	e8 02 d6 ff ff       	call   800ffc <sys_futex_wait>
+  8039fa:	89 f0                	mov    %esi,%eax
+  8039fc:	f0 87 03             	lock xchg %eax,(%ebx)
+  8039ff:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  803a02:	85 c0                	test   %eax,%eax
+  803a04:	75 e7                	jne    8039ed <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  803a06:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803a09:	5b                   	pop    %ebx
+  803a0a:	5e                   	pop    %esi
+  803a0b:	5d                   	pop    %ebp
+  803a0c:	c3                   	ret
+
+00803a0d <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  803a0d:	55                   	push   %ebp
+  803a0e:	89 e5                	mov    %esp,%ebp
+  803a10:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803a13:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a18:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803a1d:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  803a21:	f7 d8                	neg    %eax
+  803a23:	19 c0                	sbb    %eax,%eax
+  803a25:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  803a28:	5d                   	pop    %ebp
+  803a29:	c3                   	ret
+
+00803a2a <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  803a2a:	55                   	push   %ebp
+  803a2b:	89 e5                	mov    %esp,%ebp
+  803a2d:	83 ec 08             	sub    $0x8,%esp
+  803a30:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  803a33:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a38:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  803a3b:	83 f8 02             	cmp    $0x2,%eax
+  803a3e:	74 02                	je     803a42 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  803a40:	c9                   	leave
+  803a41:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  803a42:	83 ec 08             	sub    $0x8,%esp
+  803a45:	6a 01                	push   $0x1
+  803a47:	52                   	push   %edx
+  803a48:	e8 de d5 ff ff       	call   80102b <sys_futex_wake>
+  803a4d:	83 c4 10             	add    $0x10,%esp
+}
+  803a50:	eb ee                	jmp    803a40 <mutex_unlock+0x16>
+
+00803a52 <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  803a52:	55                   	push   %ebp
+  803a53:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  803a55:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a58:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803a5e:	5d                   	pop    %ebp
+  803a5f:	c3                   	ret
+
+00803a60 <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  803a60:	55                   	push   %ebp
+  803a61:	89 e5                	mov    %esp,%ebp
+  803a63:	57                   	push   %edi
+  803a64:	56                   	push   %esi
+  803a65:	53                   	push   %ebx
+  803a66:	83 ec 18             	sub    $0x18,%esp
+  803a69:	8b 75 08             	mov    0x8(%ebp),%esi
+  803a6c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  803a6f:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  803a71:	53                   	push   %ebx
+  803a72:	e8 b3 ff ff ff       	call   803a2a <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  803a77:	83 c4 0c             	add    $0xc,%esp
+  803a7a:	ff 75 10             	push   0x10(%ebp)
+  803a7d:	57                   	push   %edi
+  803a7e:	56                   	push   %esi
+  803a7f:	e8 78 d5 ff ff       	call   800ffc <sys_futex_wait>
+  803a84:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  803a86:	83 c4 10             	add    $0x10,%esp
+  803a89:	be 02 00 00 00       	mov    $0x2,%esi
+  803a8e:	eb 10                	jmp    803aa0 <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  803a90:	83 ec 04             	sub    $0x4,%esp
+  803a93:	6a 00                	push   $0x0
+  803a95:	6a 02                	push   $0x2
+  803a97:	53                   	push   %ebx
+  803a98:	e8 5f d5 ff ff       	call   800ffc <sys_futex_wait>
+  803a9d:	83 c4 10             	add    $0x10,%esp
+  803aa0:	89 f0                	mov    %esi,%eax
+  803aa2:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  803aa5:	85 c0                	test   %eax,%eax
+  803aa7:	75 e7                	jne    803a90 <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  803aa9:	83 ff ec             	cmp    $0xffffffec,%edi
+  803aac:	74 05                	je     803ab3 <cond_timedwait+0x53>
+  803aae:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803ab3:	89 f8                	mov    %edi,%eax
+  803ab5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ab8:	5b                   	pop    %ebx
+  803ab9:	5e                   	pop    %esi
+  803aba:	5f                   	pop    %edi
+  803abb:	5d                   	pop    %ebp
+  803abc:	c3                   	ret
+
+00803abd <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  803abd:	55                   	push   %ebp
+  803abe:	89 e5                	mov    %esp,%ebp
+  803ac0:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  803ac3:	6a 00                	push   $0x0
+  803ac5:	ff 75 0c             	push   0xc(%ebp)
+  803ac8:	ff 75 08             	push   0x8(%ebp)
+  803acb:	e8 90 ff ff ff       	call   803a60 <cond_timedwait>
+}
+  803ad0:	83 c4 10             	add    $0x10,%esp
+  803ad3:	c9                   	leave
+  803ad4:	c3                   	ret
+
+00803ad5 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  803ad5:	55                   	push   %ebp
+  803ad6:	89 e5                	mov    %esp,%ebp
+  803ad8:	83 ec 10             	sub    $0x10,%esp
+  803adb:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  803ade:	ba 01 00 00 00       	mov    $0x1,%edx
+  803ae3:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  803ae7:	6a 01                	push   $0x1
+  803ae9:	50                   	push   %eax
+  803aea:	e8 3c d5 ff ff       	call   80102b <sys_futex_wake>
+}
+  803aef:	83 c4 10             	add    $0x10,%esp
+  803af2:	c9                   	leave
+  803af3:	c3                   	ret
+
+00803af4 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  803af4:	55                   	push   %ebp
+  803af5:	89 e5                	mov    %esp,%ebp
+  803af7:	83 ec 10             	sub    $0x10,%esp
+  803afa:	8b 45 08             	mov    0x8(%ebp),%eax
+  803afd:	ba 01 00 00 00       	mov    $0x1,%edx
+  803b02:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  803b06:	68 00 04 00 00       	push   $0x400
+  803b0b:	50                   	push   %eax
+  803b0c:	e8 1a d5 ff ff       	call   80102b <sys_futex_wake>
+}
+  803b11:	83 c4 10             	add    $0x10,%esp
+  803b14:	c9                   	leave
+  803b15:	c3                   	ret
+
+00803b16 <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  803b16:	55                   	push   %ebp
+  803b17:	89 e5                	mov    %esp,%ebp
+  803b19:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  803b1c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803b1f:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  803b21:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  803b28:	5d                   	pop    %ebp
+  803b29:	c3                   	ret
+
+00803b2a <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  803b2a:	55                   	push   %ebp
+  803b2b:	89 e5                	mov    %esp,%ebp
+  803b2d:	53                   	push   %ebx
+  803b2e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  803b31:	8b 11                	mov    (%ecx),%edx
+  803b33:	85 d2                	test   %edx,%edx
+  803b35:	74 14                	je     803b4b <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  803b37:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803b3a:	89 d0                	mov    %edx,%eax
+  803b3c:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  803b40:	39 c2                	cmp    %eax,%edx
+  803b42:	75 ed                	jne    803b31 <sem_trywait+0x7>
+			return 0;
+  803b44:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b49:	eb 05                	jmp    803b50 <sem_trywait+0x26>
+	return -E_AGAIN;
+  803b4b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  803b50:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803b53:	c9                   	leave
+  803b54:	c3                   	ret
+
+00803b55 <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  803b55:	55                   	push   %ebp
+  803b56:	89 e5                	mov    %esp,%ebp
+  803b58:	57                   	push   %edi
+  803b59:	56                   	push   %esi
+  803b5a:	53                   	push   %ebx
+  803b5b:	83 ec 1c             	sub    $0x1c,%esp
+  803b5e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803b61:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  803b64:	e8 0b d4 ff ff       	call   800f74 <sys_time_msec>
+  803b69:	01 f8                	add    %edi,%eax
+  803b6b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  803b6e:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  803b73:	eb 28                	jmp    803b9d <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  803b75:	b8 01 00 00 00       	mov    $0x1,%eax
+  803b7a:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  803b7f:	83 ec 04             	sub    $0x4,%esp
+  803b82:	56                   	push   %esi
+  803b83:	6a 00                	push   $0x0
+  803b85:	53                   	push   %ebx
+  803b86:	e8 71 d4 ff ff       	call   800ffc <sys_futex_wait>
+  803b8b:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  803b90:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  803b95:	83 c4 10             	add    $0x10,%esp
+  803b98:	83 f8 ec             	cmp    $0xffffffec,%eax
+  803b9b:	74 2e                	je     803bcb <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  803b9d:	83 ec 0c             	sub    $0xc,%esp
+  803ba0:	53                   	push   %ebx
+  803ba1:	e8 84 ff ff ff       	call   803b2a <sem_trywait>
+  803ba6:	83 c4 10             	add    $0x10,%esp
+  803ba9:	85 c0                	test   %eax,%eax
+  803bab:	79 19                	jns    803bc6 <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  803bad:	85 ff                	test   %edi,%edi
+  803baf:	74 c4                	je     803b75 <sem_timedwait+0x20>
+  803bb1:	e8 be d3 ff ff       	call   800f74 <sys_time_msec>
+  803bb6:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803bb9:	29 c6                	sub    %eax,%esi
+  803bbb:	85 f6                	test   %esi,%esi
+  803bbd:	7f b6                	jg     803b75 <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  803bbf:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  803bc4:	eb 05                	jmp    803bcb <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  803bc6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803bcb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803bce:	5b                   	pop    %ebx
+  803bcf:	5e                   	pop    %esi
+  803bd0:	5f                   	pop    %edi
+  803bd1:	5d                   	pop    %ebp
+  803bd2:	c3                   	ret
+
+00803bd3 <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  803bd3:	55                   	push   %ebp
+  803bd4:	89 e5                	mov    %esp,%ebp
+  803bd6:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  803bd9:	6a 00                	push   $0x0
+  803bdb:	ff 75 08             	push   0x8(%ebp)
+  803bde:	e8 72 ff ff ff       	call   803b55 <sem_timedwait>
+}
+  803be3:	83 c4 10             	add    $0x10,%esp
+  803be6:	c9                   	leave
+  803be7:	c3                   	ret
+
+00803be8 <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  803be8:	55                   	push   %ebp
+  803be9:	89 e5                	mov    %esp,%ebp
+  803beb:	83 ec 08             	sub    $0x8,%esp
+  803bee:	8b 45 08             	mov    0x8(%ebp),%eax
+  803bf1:	ba 01 00 00 00       	mov    $0x1,%edx
+  803bf6:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  803bfa:	8b 50 04             	mov    0x4(%eax),%edx
+  803bfd:	85 d2                	test   %edx,%edx
+  803bff:	75 02                	jne    803c03 <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  803c01:	c9                   	leave
+  803c02:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  803c03:	83 ec 08             	sub    $0x8,%esp
+  803c06:	6a 01                	push   $0x1
+  803c08:	50                   	push   %eax
+  803c09:	e8 1d d4 ff ff       	call   80102b <sys_futex_wake>
+  803c0e:	83 c4 10             	add    $0x10,%esp
+}
+  803c11:	eb ee                	jmp    803c01 <sem_post+0x19>
+
+00803c13 <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  803c13:	55                   	push   %ebp
+  803c14:	89 e5                	mov    %esp,%ebp
+  803c16:	57                   	push   %edi
+  803c17:	56                   	push   %esi
+  803c18:	53                   	push   %ebx
+  803c19:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  803c1c:	68 20 60 80 00       	push   $0x806020
+  803c21:	e8 97 fd ff ff       	call   8039bd <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  803c26:	a1 44 60 80 00       	mov    0x806044,%eax
+  803c2b:	83 c4 10             	add    $0x10,%esp
+  803c2e:	85 c0                	test   %eax,%eax
+  803c30:	75 19                	jne    803c4b <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  803c32:	a1 c4 62 80 00       	mov    0x8062c4,%eax
+  803c37:	8b 00                	mov    (%eax),%eax
+  803c39:	8b 40 48             	mov    0x48(%eax),%eax
+  803c3c:	a3 40 60 80 00       	mov    %eax,0x806040
+		threads[0].th_state = PTH_RUNNING;
+  803c41:	c7 05 44 60 80 00 01 	movl   $0x1,0x806044
+  803c48:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803c4b:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  803c50:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803c53:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803c5a:	8b 40 04             	mov    0x4(%eax),%eax
+  803c5d:	85 c0                	test   %eax,%eax
+  803c5f:	0f 84 e4 00 00 00    	je     803d49 <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803c65:	83 c3 01             	add    $0x1,%ebx
+  803c68:	83 fb 20             	cmp    $0x20,%ebx
+  803c6b:	75 e3                	jne    803c50 <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  803c6d:	83 ec 0c             	sub    $0xc,%esp
+  803c70:	68 20 60 80 00       	push   $0x806020
+  803c75:	e8 b0 fd ff ff       	call   803a2a <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  803c7a:	83 c4 10             	add    $0x10,%esp
+  803c7d:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  803c82:	e9 b8 00 00 00       	jmp    803d3f <pthread_create+0x12c>
+  803c87:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  803c8a:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  803c8d:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  803c8f:	39 f3                	cmp    %esi,%ebx
+  803c91:	73 16                	jae    803ca9 <pthread_create+0x96>
+		va -= PGSIZE;
+  803c93:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  803c99:	83 ec 08             	sub    $0x8,%esp
+  803c9c:	56                   	push   %esi
+  803c9d:	6a 00                	push   $0x0
+  803c9f:	e8 dc d0 ff ff       	call   800d80 <sys_page_unmap>
+  803ca4:	83 c4 10             	add    $0x10,%esp
+  803ca7:	eb e6                	jmp    803c8f <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  803ca9:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803cac:	83 ec 08             	sub    $0x8,%esp
+  803caf:	ff 75 e4             	push   -0x1c(%ebp)
+  803cb2:	6a 00                	push   $0x0
+  803cb4:	e8 c7 d0 ff ff       	call   800d80 <sys_page_unmap>
+	return r;
+  803cb9:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  803cbc:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803cbf:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803cc6:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  803ccd:	eb 70                	jmp    803d3f <pthread_create+0x12c>
+	th->th_fn = fn;
+  803ccf:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803cd2:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803cd9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803cdc:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  803cdf:	8b 55 10             	mov    0x10(%ebp),%edx
+  803ce2:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  803ce5:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  803cec:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  803cf1:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803cf4:	29 c8                	sub    %ecx,%eax
+  803cf6:	85 db                	test   %ebx,%ebx
+  803cf8:	0f 44 05 c4 62 80 00 	cmove  0x8062c4,%eax
+	*--esp = t;
+  803cff:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  803d02:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803d09:	83 ec 04             	sub    $0x4,%esp
+  803d0c:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803d11:	29 ca                	sub    %ecx,%edx
+  803d13:	52                   	push   %edx
+	*--esp = 0;
+  803d14:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803d17:	50                   	push   %eax
+  803d18:	68 70 3f 80 00       	push   $0x803f70
+  803d1d:	e8 ae d3 ff ff       	call   8010d0 <sys_thread_create>
+  803d22:	89 c7                	mov    %eax,%edi
+  803d24:	83 c4 10             	add    $0x10,%esp
+  803d27:	85 c0                	test   %eax,%eax
+  803d29:	78 91                	js     803cbc <pthread_create+0xa9>
+	th->th_env = id;
+  803d2b:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803d2e:	89 3c 85 40 60 80 00 	mov    %edi,0x806040(,%eax,4)
+	*tp = t;
+  803d35:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d38:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  803d3a:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803d3f:	89 f8                	mov    %edi,%eax
+  803d41:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d44:	5b                   	pop    %ebx
+  803d45:	5e                   	pop    %esi
+  803d46:	5f                   	pop    %edi
+  803d47:	5d                   	pop    %ebp
+  803d48:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  803d49:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803d4c:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803d53:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  803d5a:	83 ec 0c             	sub    $0xc,%esp
+  803d5d:	68 20 60 80 00       	push   $0x806020
+  803d62:	e8 c3 fc ff ff       	call   803a2a <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  803d67:	89 d9                	mov    %ebx,%ecx
+  803d69:	c1 e1 10             	shl    $0x10,%ecx
+  803d6c:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  803d6f:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  803d74:	29 c8                	sub    %ecx,%eax
+  803d76:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  803d79:	c1 e8 16             	shr    $0x16,%eax
+  803d7c:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803d83:	83 c4 10             	add    $0x10,%esp
+  803d86:	a8 01                	test   $0x1,%al
+  803d88:	74 15                	je     803d9f <pthread_create+0x18c>
+  803d8a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803d8d:	c1 e8 0c             	shr    $0xc,%eax
+  803d90:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803d97:	a8 01                	test   $0x1,%al
+  803d99:	0f 85 30 ff ff ff    	jne    803ccf <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803d9f:	83 ec 04             	sub    $0x4,%esp
+  803da2:	6a 07                	push   $0x7
+  803da4:	ff 75 e4             	push   -0x1c(%ebp)
+  803da7:	6a 00                	push   $0x0
+  803da9:	e8 39 cf ff ff       	call   800ce7 <sys_page_alloc>
+  803dae:	89 c7                	mov    %eax,%edi
+  803db0:	83 c4 10             	add    $0x10,%esp
+  803db3:	85 c0                	test   %eax,%eax
+  803db5:	0f 88 01 ff ff ff    	js     803cbc <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  803dbb:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  803dc0:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  803dc3:	29 d0                	sub    %edx,%eax
+  803dc5:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  803dc8:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803dca:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  803dcf:	29 d0                	sub    %edx,%eax
+  803dd1:	89 c7                	mov    %eax,%edi
+  803dd3:	39 fe                	cmp    %edi,%esi
+  803dd5:	0f 83 f4 fe ff ff    	jae    803ccf <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803ddb:	83 ec 04             	sub    $0x4,%esp
+  803dde:	6a 07                	push   $0x7
+  803de0:	56                   	push   %esi
+  803de1:	6a 00                	push   $0x0
+  803de3:	e8 ff ce ff ff       	call   800ce7 <sys_page_alloc>
+  803de8:	83 c4 10             	add    $0x10,%esp
+  803deb:	85 c0                	test   %eax,%eax
+  803ded:	0f 88 94 fe ff ff    	js     803c87 <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803df3:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803df9:	eb d8                	jmp    803dd3 <pthread_create+0x1c0>
+
+00803dfb <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  803dfb:	55                   	push   %ebp
+  803dfc:	89 e5                	mov    %esp,%ebp
+  803dfe:	57                   	push   %edi
+  803dff:	56                   	push   %esi
+  803e00:	53                   	push   %ebx
+  803e01:	83 ec 0c             	sub    $0xc,%esp
+  803e04:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  803e07:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  803e0a:	83 f8 1e             	cmp    $0x1e,%eax
+  803e0d:	0f 87 c7 00 00 00    	ja     803eda <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  803e13:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803e15:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803e1b:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803e20:	77 12                	ja     803e34 <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803e22:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803e27:	29 d0                	sub    %edx,%eax
+  803e29:	c1 e8 10             	shr    $0x10,%eax
+  803e2c:	39 c3                	cmp    %eax,%ebx
+  803e2e:	0f 84 ad 00 00 00    	je     803ee1 <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803e34:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803e37:	8d 3c 85 44 60 80 00 	lea    0x806044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  803e3e:	8d 34 85 40 60 80 00 	lea    0x806040(,%eax,4),%esi
+  803e45:	eb 10                	jmp    803e57 <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803e47:	83 ec 04             	sub    $0x4,%esp
+  803e4a:	6a 00                	push   $0x0
+  803e4c:	6a 01                	push   $0x1
+  803e4e:	57                   	push   %edi
+  803e4f:	e8 a8 d1 ff ff       	call   800ffc <sys_futex_wait>
+  803e54:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  803e57:	8b 46 04             	mov    0x4(%esi),%eax
+  803e5a:	83 f8 01             	cmp    $0x1,%eax
+  803e5d:	74 e8                	je     803e47 <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  803e5f:	83 f8 02             	cmp    $0x2,%eax
+  803e62:	0f 85 80 00 00 00    	jne    803ee8 <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  803e68:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  803e6b:	c1 e6 02             	shl    $0x2,%esi
+  803e6e:	eb 05                	jmp    803e75 <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  803e70:	e8 46 ce ff ff       	call   800cbb <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  803e75:	8b 8e 40 60 80 00    	mov    0x806040(%esi),%ecx
+  803e7b:	89 ca                	mov    %ecx,%edx
+  803e7d:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  803e83:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803e86:	c1 e0 04             	shl    $0x4,%eax
+  803e89:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803e8e:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  803e91:	39 c1                	cmp    %eax,%ecx
+  803e93:	75 12                	jne    803ea7 <pthread_join+0xac>
+  803e95:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803e98:	c1 e0 04             	shl    $0x4,%eax
+  803e9b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803ea0:	8b 40 54             	mov    0x54(%eax),%eax
+  803ea3:	85 c0                	test   %eax,%eax
+  803ea5:	75 c9                	jne    803e70 <pthread_join+0x75>
+	if (ret_store)
+  803ea7:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803eab:	74 0f                	je     803ebc <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  803ead:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803eb0:	8b 04 85 50 60 80 00 	mov    0x806050(,%eax,4),%eax
+  803eb7:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803eba:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  803ebc:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803ebf:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803ec6:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  803ecd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ed2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ed5:	5b                   	pop    %ebx
+  803ed6:	5e                   	pop    %esi
+  803ed7:	5f                   	pop    %edi
+  803ed8:	5d                   	pop    %ebp
+  803ed9:	c3                   	ret
+		return -E_INVAL;
+  803eda:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803edf:	eb f1                	jmp    803ed2 <pthread_join+0xd7>
+  803ee1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803ee6:	eb ea                	jmp    803ed2 <pthread_join+0xd7>
+		return -E_INVAL;
+  803ee8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803eed:	eb e3                	jmp    803ed2 <pthread_join+0xd7>
+
+00803eef <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  803eef:	55                   	push   %ebp
+  803ef0:	89 e5                	mov    %esp,%ebp
+  803ef2:	53                   	push   %ebx
+  803ef3:	83 ec 04             	sub    $0x4,%esp
+  803ef6:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803ef8:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803efe:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803f03:	77 0c                	ja     803f11 <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803f05:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803f0a:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  803f0c:	c1 e8 10             	shr    $0x10,%eax
+  803f0f:	75 0a                	jne    803f1b <pthread_exit+0x2c>
+		exit();
+  803f11:	e8 ac c2 ff ff       	call   8001c2 <exit>
+  803f16:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  803f1b:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  803f22:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  803f25:	8d 0c 8d 40 60 80 00 	lea    0x806040(,%ecx,4),%ecx
+  803f2c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803f2f:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  803f32:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  803f39:	83 ec 08             	sub    $0x8,%esp
+  803f3c:	6a 20                	push   $0x20
+  803f3e:	01 c2                	add    %eax,%edx
+  803f40:	8d 04 95 44 60 80 00 	lea    0x806044(,%edx,4),%eax
+  803f47:	50                   	push   %eax
+  803f48:	e8 de d0 ff ff       	call   80102b <sys_futex_wake>
+	sys_env_destroy(0);
+  803f4d:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  803f54:	e8 eb cc ff ff       	call   800c44 <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  803f59:	83 c4 0c             	add    $0xc,%esp
+  803f5c:	68 16 4f 80 00       	push   $0x804f16
+  803f61:	68 a5 00 00 00       	push   $0xa5
+  803f66:	68 30 4f 80 00       	push   $0x804f30
+  803f6b:	e8 7a c2 ff ff       	call   8001ea <_panic>
+
+00803f70 <pthread_start>:
+{
+  803f70:	55                   	push   %ebp
+  803f71:	89 e5                	mov    %esp,%ebp
+  803f73:	53                   	push   %ebx
+  803f74:	83 ec 04             	sub    $0x4,%esp
+  803f77:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  803f7a:	e8 10 cd ff ff       	call   800c8f <sys_getenvid>
+  803f7f:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  803f84:	8b 15 c4 62 80 00    	mov    0x8062c4,%edx
+	if (t == 0)
+  803f8a:	85 db                	test   %ebx,%ebx
+  803f8c:	74 0c                	je     803f9a <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803f8e:	89 d9                	mov    %ebx,%ecx
+  803f90:	c1 e1 10             	shl    $0x10,%ecx
+  803f93:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803f98:	29 ca                	sub    %ecx,%edx
+  803f9a:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  803f9d:	c1 e0 04             	shl    $0x4,%eax
+  803fa0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803fa5:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  803fa7:	83 ec 0c             	sub    $0xc,%esp
+  803faa:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803fb1:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803fb4:	ff 34 95 4c 60 80 00 	push   0x80604c(,%edx,4)
+  803fbb:	ff 14 95 48 60 80 00 	call   *0x806048(,%edx,4)
+  803fc2:	89 04 24             	mov    %eax,(%esp)
+  803fc5:	e8 25 ff ff ff       	call   803eef <pthread_exit>
+
+00803fca <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  803fca:	55                   	push   %ebp
+  803fcb:	89 e5                	mov    %esp,%ebp
+  803fcd:	57                   	push   %edi
+  803fce:	56                   	push   %esi
+  803fcf:	53                   	push   %ebx
+  803fd0:	83 ec 1c             	sub    $0x1c,%esp
+  803fd3:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803fd5:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  803fdb:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803fe2:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803fe7:	77 0d                	ja     803ff6 <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803fe9:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803fee:	29 d0                	sub    %edx,%eax
+  803ff0:	c1 e8 10             	shr    $0x10,%eax
+  803ff3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  803ff6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803ffb:	eb 2f                	jmp    80402c <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  803ffd:	8b 0d c4 62 80 00    	mov    0x8062c4,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  804003:	8b 01                	mov    (%ecx),%eax
+  804005:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  804008:	39 c2                	cmp    %eax,%edx
+  80400a:	75 14                	jne    804020 <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  80400c:	83 ec 0c             	sub    $0xc,%esp
+  80400f:	57                   	push   %edi
+  804010:	e8 2f cc ff ff       	call   800c44 <sys_env_destroy>
+  804015:	83 c4 10             	add    $0x10,%esp
+  804018:	85 c0                	test   %eax,%eax
+  80401a:	0f 88 97 00 00 00    	js     8040b7 <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  804020:	83 c3 01             	add    $0x1,%ebx
+  804023:	83 fb 20             	cmp    $0x20,%ebx
+  804026:	0f 84 d2 00 00 00    	je     8040fe <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  80402c:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  80402f:	74 ef                	je     804020 <pthread_kill_others+0x56>
+  804031:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  804034:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  80403b:	8b 40 04             	mov    0x4(%eax),%eax
+  80403e:	83 f8 01             	cmp    $0x1,%eax
+  804041:	75 dd                	jne    804020 <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  804043:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  804046:	8b 3c 85 40 60 80 00 	mov    0x806040(,%eax,4),%edi
+  80404d:	89 fe                	mov    %edi,%esi
+  80404f:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  804055:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  804058:	c1 e0 04             	shl    $0x4,%eax
+  80405b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804060:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  804063:	39 c7                	cmp    %eax,%edi
+  804065:	75 b9                	jne    804020 <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  804067:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  80406a:	c1 e0 04             	shl    $0x4,%eax
+  80406d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804072:	8b 40 54             	mov    0x54(%eax),%eax
+  804075:	85 c0                	test   %eax,%eax
+  804077:	74 a7                	je     804020 <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  804079:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  80407c:	c1 e0 04             	shl    $0x4,%eax
+  80407f:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  804085:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804087:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  80408d:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804092:	0f 87 65 ff ff ff    	ja     803ffd <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804098:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80409d:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  80409f:	c1 e8 10             	shr    $0x10,%eax
+  8040a2:	0f 84 55 ff ff ff    	je     803ffd <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8040a8:	c1 e0 10             	shl    $0x10,%eax
+  8040ab:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8040b0:	29 c1                	sub    %eax,%ecx
+  8040b2:	e9 4c ff ff ff       	jmp    804003 <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  8040b7:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  8040ba:	c1 e2 04             	shl    $0x4,%edx
+  8040bd:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8040c3:	8b 52 48             	mov    0x48(%edx),%edx
+  8040c6:	39 fa                	cmp    %edi,%edx
+  8040c8:	0f 85 52 ff ff ff    	jne    804020 <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  8040ce:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  8040d1:	c1 e2 04             	shl    $0x4,%edx
+  8040d4:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8040da:	8b 52 54             	mov    0x54(%edx),%edx
+  8040dd:	85 d2                	test   %edx,%edx
+  8040df:	0f 84 3b ff ff ff    	je     804020 <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  8040e5:	83 ec 0c             	sub    $0xc,%esp
+  8040e8:	50                   	push   %eax
+  8040e9:	57                   	push   %edi
+  8040ea:	68 40 4f 80 00       	push   $0x804f40
+  8040ef:	68 bb 00 00 00       	push   $0xbb
+  8040f4:	68 30 4f 80 00       	push   $0x804f30
+  8040f9:	e8 ec c0 ff ff       	call   8001ea <_panic>
+	}
+}
+  8040fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804101:	5b                   	pop    %ebx
+  804102:	5e                   	pop    %esi
+  804103:	5f                   	pop    %edi
+  804104:	5d                   	pop    %ebp
+  804105:	c3                   	ret
+
+00804106 <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  804106:	55                   	push   %ebp
+  804107:	89 e5                	mov    %esp,%ebp
+  804109:	53                   	push   %ebx
+  80410a:	83 ec 04             	sub    $0x4,%esp
+  80410d:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80410f:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  804115:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  80411b:	0f 87 85 00 00 00    	ja     8041a6 <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804121:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  804126:	29 c3                	sub    %eax,%ebx
+  804128:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  80412b:	83 ec 04             	sub    $0x4,%esp
+  80412e:	68 80 02 00 00       	push   $0x280
+  804133:	6a 00                	push   $0x0
+  804135:	68 40 60 80 00       	push   $0x806040
+  80413a:	e8 bb c8 ff ff       	call   8009fa <memset>
+	threads_mu.m_state = 0;
+  80413f:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  804146:	00 00 00 
+	if (self != 0) {
+  804149:	83 c4 10             	add    $0x10,%esp
+  80414c:	85 db                	test   %ebx,%ebx
+  80414e:	74 51                	je     8041a1 <pthread_fork_child+0x9b>
+  804150:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804152:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804158:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80415d:	77 18                	ja     804177 <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80415f:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804164:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804166:	c1 e8 10             	shr    $0x10,%eax
+  804169:	74 0c                	je     804177 <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80416b:	c1 e0 10             	shl    $0x10,%eax
+  80416e:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804173:	29 c2                	sub    %eax,%edx
+  804175:	eb 06                	jmp    80417d <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  804177:	8b 15 c4 62 80 00    	mov    0x8062c4,%edx
+		threads[self].th_env = thisenv->env_id;
+  80417d:	8b 02                	mov    (%edx),%eax
+  80417f:	8b 48 48             	mov    0x48(%eax),%ecx
+  804182:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  804189:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  80418c:	89 0c 95 40 60 80 00 	mov    %ecx,0x806040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  804193:	8d 04 95 40 60 80 00 	lea    0x806040(,%edx,4),%eax
+  80419a:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  8041a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8041a4:	c9                   	leave
+  8041a5:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  8041a6:	83 ec 04             	sub    $0x4,%esp
+  8041a9:	68 80 02 00 00       	push   $0x280
+  8041ae:	6a 00                	push   $0x0
+  8041b0:	68 40 60 80 00       	push   $0x806040
+  8041b5:	e8 40 c8 ff ff       	call   8009fa <memset>
+	threads_mu.m_state = 0;
+  8041ba:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  8041c1:	00 00 00 
+  8041c4:	83 c4 10             	add    $0x10,%esp
+  8041c7:	eb d8                	jmp    8041a1 <pthread_fork_child+0x9b>
+
+008041c9 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8041c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041ce:	c3                   	ret
+
+008041cf <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8041cf:	55                   	push   %ebp
+  8041d0:	89 e5                	mov    %esp,%ebp
+  8041d2:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8041d5:	68 65 4f 80 00       	push   $0x804f65
+  8041da:	ff 75 0c             	push   0xc(%ebp)
+  8041dd:	e8 c7 c6 ff ff       	call   8008a9 <strcpy>
+	return 0;
+}
+  8041e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041e7:	c9                   	leave
+  8041e8:	c3                   	ret
+
+008041e9 <devcons_write>:
+{
+  8041e9:	55                   	push   %ebp
+  8041ea:	89 e5                	mov    %esp,%ebp
+  8041ec:	57                   	push   %edi
+  8041ed:	56                   	push   %esi
+  8041ee:	53                   	push   %ebx
+  8041ef:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8041f5:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8041fa:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  804200:	eb 2e                	jmp    804230 <devcons_write+0x47>
+		m = n - tot;
+  804202:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804205:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  804207:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80420c:	39 c3                	cmp    %eax,%ebx
+  80420e:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  804211:	83 ec 04             	sub    $0x4,%esp
+  804214:	53                   	push   %ebx
+  804215:	89 f0                	mov    %esi,%eax
+  804217:	03 45 0c             	add    0xc(%ebp),%eax
+  80421a:	50                   	push   %eax
+  80421b:	57                   	push   %edi
+  80421c:	e8 0e c8 ff ff       	call   800a2f <memmove>
+		sys_cputs(buf, m);
+  804221:	83 c4 08             	add    $0x8,%esp
+  804224:	53                   	push   %ebx
+  804225:	57                   	push   %edi
+  804226:	e8 c2 c9 ff ff       	call   800bed <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80422b:	01 de                	add    %ebx,%esi
+  80422d:	83 c4 10             	add    $0x10,%esp
+  804230:	3b 75 10             	cmp    0x10(%ebp),%esi
+  804233:	72 cd                	jb     804202 <devcons_write+0x19>
+}
+  804235:	89 f0                	mov    %esi,%eax
+  804237:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80423a:	5b                   	pop    %ebx
+  80423b:	5e                   	pop    %esi
+  80423c:	5f                   	pop    %edi
+  80423d:	5d                   	pop    %ebp
+  80423e:	c3                   	ret
+
+0080423f <devcons_read>:
+{
+  80423f:	55                   	push   %ebp
+  804240:	89 e5                	mov    %esp,%ebp
+  804242:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  804245:	b8 00 00 00 00       	mov    $0x0,%eax
+  80424a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80424e:	75 07                	jne    804257 <devcons_read+0x18>
+  804250:	eb 1f                	jmp    804271 <devcons_read+0x32>
+		sys_yield();
+  804252:	e8 64 ca ff ff       	call   800cbb <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  804257:	e8 bc c9 ff ff       	call   800c18 <sys_cgetc>
+  80425c:	85 c0                	test   %eax,%eax
+  80425e:	74 f2                	je     804252 <devcons_read+0x13>
+	if (c < 0)
+  804260:	78 0f                	js     804271 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  804262:	83 f8 04             	cmp    $0x4,%eax
+  804265:	74 0c                	je     804273 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  804267:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80426a:	88 02                	mov    %al,(%edx)
+	return 1;
+  80426c:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  804271:	c9                   	leave
+  804272:	c3                   	ret
+		return 0;
+  804273:	b8 00 00 00 00       	mov    $0x0,%eax
+  804278:	eb f7                	jmp    804271 <devcons_read+0x32>
+
+0080427a <cputchar>:
+{
+  80427a:	55                   	push   %ebp
+  80427b:	89 e5                	mov    %esp,%ebp
+  80427d:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  804280:	8b 45 08             	mov    0x8(%ebp),%eax
+  804283:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  804286:	6a 01                	push   $0x1
+  804288:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80428b:	50                   	push   %eax
+  80428c:	e8 5c c9 ff ff       	call   800bed <sys_cputs>
+}
+  804291:	83 c4 10             	add    $0x10,%esp
+  804294:	c9                   	leave
+  804295:	c3                   	ret
+
+00804296 <getchar>:
+{
+  804296:	55                   	push   %ebp
+  804297:	89 e5                	mov    %esp,%ebp
+  804299:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80429c:	6a 01                	push   $0x1
+  80429e:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8042a1:	50                   	push   %eax
+  8042a2:	6a 00                	push   $0x0
+  8042a4:	e8 63 d8 ff ff       	call   801b0c <read>
+	if (r < 0)
+  8042a9:	83 c4 10             	add    $0x10,%esp
+  8042ac:	85 c0                	test   %eax,%eax
+  8042ae:	78 06                	js     8042b6 <getchar+0x20>
+	if (r < 1)
+  8042b0:	74 06                	je     8042b8 <getchar+0x22>
+	return c;
+  8042b2:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8042b6:	c9                   	leave
+  8042b7:	c3                   	ret
+		return -E_EOF;
+  8042b8:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8042bd:	eb f7                	jmp    8042b6 <getchar+0x20>
+
+008042bf <iscons>:
+{
+  8042bf:	55                   	push   %ebp
+  8042c0:	89 e5                	mov    %esp,%ebp
+  8042c2:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8042c5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8042c8:	50                   	push   %eax
+  8042c9:	ff 75 08             	push   0x8(%ebp)
+  8042cc:	e8 ab d5 ff ff       	call   80187c <fd_lookup>
+  8042d1:	83 c4 10             	add    $0x10,%esp
+  8042d4:	85 c0                	test   %eax,%eax
+  8042d6:	78 11                	js     8042e9 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8042d8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8042db:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  8042e1:	39 10                	cmp    %edx,(%eax)
+  8042e3:	0f 94 c0             	sete   %al
+  8042e6:	0f b6 c0             	movzbl %al,%eax
+}
+  8042e9:	c9                   	leave
+  8042ea:	c3                   	ret
+
+008042eb <opencons>:
+{
+  8042eb:	55                   	push   %ebp
+  8042ec:	89 e5                	mov    %esp,%ebp
+  8042ee:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8042f1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8042f4:	50                   	push   %eax
+  8042f5:	e8 2c d5 ff ff       	call   801826 <fd_alloc>
+  8042fa:	83 c4 10             	add    $0x10,%esp
+  8042fd:	85 c0                	test   %eax,%eax
+  8042ff:	78 3a                	js     80433b <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  804301:	83 ec 04             	sub    $0x4,%esp
+  804304:	68 07 04 00 00       	push   $0x407
+  804309:	ff 75 f4             	push   -0xc(%ebp)
+  80430c:	6a 00                	push   $0x0
+  80430e:	e8 d4 c9 ff ff       	call   800ce7 <sys_page_alloc>
+  804313:	83 c4 10             	add    $0x10,%esp
+  804316:	85 c0                	test   %eax,%eax
+  804318:	78 21                	js     80433b <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80431a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80431d:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  804323:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  804325:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804328:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80432f:	83 ec 0c             	sub    $0xc,%esp
+  804332:	50                   	push   %eax
+  804333:	e8 c7 d4 ff ff       	call   8017ff <fd2num>
+  804338:	83 c4 10             	add    $0x10,%esp
+}
+  80433b:	c9                   	leave
+  80433c:	c3                   	ret
+
+0080433d <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  80433d:	55                   	push   %ebp
+  80433e:	89 e5                	mov    %esp,%ebp
+  804340:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  804343:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  80434a:	74 0a                	je     804356 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  80434c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80434f:	a3 00 90 80 00       	mov    %eax,0x809000
+}
+  804354:	c9                   	leave
+  804355:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  804356:	83 ec 04             	sub    $0x4,%esp
+  804359:	6a 07                	push   $0x7
+  80435b:	68 00 f0 bf ee       	push   $0xeebff000
+  804360:	6a 00                	push   $0x0
+  804362:	e8 80 c9 ff ff       	call   800ce7 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804367:	83 c4 08             	add    $0x8,%esp
+  80436a:	68 7b 43 80 00       	push   $0x80437b
+  80436f:	6a 00                	push   $0x0
+  804371:	e8 ee ca ff ff       	call   800e64 <sys_env_set_pgfault_upcall>
+  804376:	83 c4 10             	add    $0x10,%esp
+  804379:	eb d1                	jmp    80434c <set_pgfault_handler+0xf>
+
+0080437b <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80437b:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80437c:	a1 00 90 80 00       	mov    0x809000,%eax
+	call *%eax
+  804381:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804383:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  804386:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  80438a:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  80438e:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  804391:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  804395:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  804397:	83 c4 08             	add    $0x8,%esp
+	popal
+  80439a:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  80439b:	83 c4 04             	add    $0x4,%esp
+	popfl
+  80439e:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  80439f:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  8043a0:	c3                   	ret
+
+008043a1 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8043a1:	55                   	push   %ebp
+  8043a2:	89 e5                	mov    %esp,%ebp
+  8043a4:	57                   	push   %edi
+  8043a5:	56                   	push   %esi
+  8043a6:	53                   	push   %ebx
+  8043a7:	83 ec 18             	sub    $0x18,%esp
+  8043aa:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8043ad:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8043b0:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  8043b3:	85 c0                	test   %eax,%eax
+  8043b5:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8043ba:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  8043bd:	50                   	push   %eax
+  8043be:	e8 1a cb ff ff       	call   800edd <sys_ipc_recv>
+	if (r < 0) {
+  8043c3:	83 c4 10             	add    $0x10,%esp
+  8043c6:	85 c0                	test   %eax,%eax
+  8043c8:	78 2b                	js     8043f5 <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  8043ca:	85 ff                	test   %edi,%edi
+  8043cc:	74 55                	je     804423 <ipc_recv+0x82>
+  8043ce:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8043d0:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8043d6:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8043db:	77 39                	ja     804416 <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8043dd:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8043e2:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8043e4:	c1 e8 10             	shr    $0x10,%eax
+  8043e7:	74 2d                	je     804416 <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8043e9:	c1 e0 10             	shl    $0x10,%eax
+  8043ec:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8043f1:	29 c2                	sub    %eax,%edx
+  8043f3:	eb 27                	jmp    80441c <ipc_recv+0x7b>
+  8043f5:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  8043f7:	83 ec 08             	sub    $0x8,%esp
+  8043fa:	50                   	push   %eax
+  8043fb:	68 71 4f 80 00       	push   $0x804f71
+  804400:	e8 c0 be ff ff       	call   8002c5 <cprintf>
+		*from_env_store = 0;
+  804405:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  80440b:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  804411:	83 c4 10             	add    $0x10,%esp
+  804414:	eb 77                	jmp    80448d <ipc_recv+0xec>
+		return pthread_main_tls;
+  804416:	8b 15 c4 62 80 00    	mov    0x8062c4,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  80441c:	8b 02                	mov    (%edx),%eax
+  80441e:	8b 40 78             	mov    0x78(%eax),%eax
+  804421:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804423:	85 f6                	test   %esi,%esi
+  804425:	74 34                	je     80445b <ipc_recv+0xba>
+  804427:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804429:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80442f:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804434:	77 18                	ja     80444e <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804436:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80443b:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80443d:	c1 e8 10             	shr    $0x10,%eax
+  804440:	74 0c                	je     80444e <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804442:	c1 e0 10             	shl    $0x10,%eax
+  804445:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80444a:	29 c2                	sub    %eax,%edx
+  80444c:	eb 06                	jmp    804454 <ipc_recv+0xb3>
+		return pthread_main_tls;
+  80444e:	8b 15 c4 62 80 00    	mov    0x8062c4,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  804454:	8b 02                	mov    (%edx),%eax
+  804456:	8b 40 7c             	mov    0x7c(%eax),%eax
+  804459:	89 06                	mov    %eax,(%esi)
+  80445b:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80445d:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804463:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804468:	77 18                	ja     804482 <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80446a:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80446f:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804471:	c1 e8 10             	shr    $0x10,%eax
+  804474:	74 0c                	je     804482 <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804476:	c1 e0 10             	shl    $0x10,%eax
+  804479:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80447e:	29 c2                	sub    %eax,%edx
+  804480:	eb 06                	jmp    804488 <ipc_recv+0xe7>
+		return pthread_main_tls;
+  804482:	8b 15 c4 62 80 00    	mov    0x8062c4,%edx
+	}
+	return thisenv->env_ipc_value;
+  804488:	8b 02                	mov    (%edx),%eax
+  80448a:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  80448d:	89 d8                	mov    %ebx,%eax
+  80448f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804492:	5b                   	pop    %ebx
+  804493:	5e                   	pop    %esi
+  804494:	5f                   	pop    %edi
+  804495:	5d                   	pop    %ebp
+  804496:	c3                   	ret
+
+00804497 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  804497:	55                   	push   %ebp
+  804498:	89 e5                	mov    %esp,%ebp
+  80449a:	57                   	push   %edi
+  80449b:	56                   	push   %esi
+  80449c:	53                   	push   %ebx
+  80449d:	83 ec 0c             	sub    $0xc,%esp
+  8044a0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8044a3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8044a6:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  8044a9:	85 db                	test   %ebx,%ebx
+  8044ab:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8044b0:	0f 44 d8             	cmove  %eax,%ebx
+  8044b3:	eb 05                	jmp    8044ba <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  8044b5:	e8 01 c8 ff ff       	call   800cbb <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  8044ba:	57                   	push   %edi
+  8044bb:	53                   	push   %ebx
+  8044bc:	ff 75 0c             	push   0xc(%ebp)
+  8044bf:	56                   	push   %esi
+  8044c0:	e8 eb c9 ff ff       	call   800eb0 <sys_ipc_try_send>
+		if (r == 0) {
+  8044c5:	83 c4 10             	add    $0x10,%esp
+  8044c8:	85 c0                	test   %eax,%eax
+  8044ca:	74 19                	je     8044e5 <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  8044cc:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8044cf:	74 e4                	je     8044b5 <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  8044d1:	83 ec 0c             	sub    $0xc,%esp
+  8044d4:	50                   	push   %eax
+  8044d5:	57                   	push   %edi
+  8044d6:	53                   	push   %ebx
+  8044d7:	56                   	push   %esi
+  8044d8:	68 8c 4f 80 00       	push   $0x804f8c
+  8044dd:	e8 e3 bd ff ff       	call   8002c5 <cprintf>
+			return;
+  8044e2:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  8044e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8044e8:	5b                   	pop    %ebx
+  8044e9:	5e                   	pop    %esi
+  8044ea:	5f                   	pop    %edi
+  8044eb:	5d                   	pop    %ebp
+  8044ec:	c3                   	ret
+
+008044ed <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8044ed:	55                   	push   %ebp
+  8044ee:	89 e5                	mov    %esp,%ebp
+  8044f0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8044f3:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  8044f8:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8044fb:	c1 e0 04             	shl    $0x4,%eax
+  8044fe:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804503:	8b 40 50             	mov    0x50(%eax),%eax
+  804506:	39 c8                	cmp    %ecx,%eax
+  804508:	74 12                	je     80451c <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80450a:	83 c2 01             	add    $0x1,%edx
+  80450d:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  804513:	75 e3                	jne    8044f8 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  804515:	b8 00 00 00 00       	mov    $0x0,%eax
+  80451a:	eb 0e                	jmp    80452a <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80451c:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80451f:	c1 e0 04             	shl    $0x4,%eax
+  804522:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804527:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80452a:	5d                   	pop    %ebp
+  80452b:	c3                   	ret
+
+0080452c <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80452c:	55                   	push   %ebp
+  80452d:	89 e5                	mov    %esp,%ebp
+  80452f:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804532:	89 c2                	mov    %eax,%edx
+  804534:	c1 ea 16             	shr    $0x16,%edx
+  804537:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80453e:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804543:	f6 c1 01             	test   $0x1,%cl
+  804546:	74 1c                	je     804564 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  804548:	c1 e8 0c             	shr    $0xc,%eax
+  80454b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  804552:	a8 01                	test   $0x1,%al
+  804554:	74 0e                	je     804564 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  804556:	c1 e8 0c             	shr    $0xc,%eax
+  804559:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  804560:	ef 
+  804561:	0f b7 d2             	movzwl %dx,%edx
+}
+  804564:	89 d0                	mov    %edx,%eax
+  804566:	5d                   	pop    %ebp
+  804567:	c3                   	ret
+
+00804568 <udm>:
+  804568:	57                   	push   %edi
+  804569:	56                   	push   %esi
+  80456a:	53                   	push   %ebx
+  80456b:	83 ec 20             	sub    $0x20,%esp
+  80456e:	89 44 24 10          	mov    %eax,0x10(%esp)
+  804572:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804576:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80457a:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80457e:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804582:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804586:	89 d1                	mov    %edx,%ecx
+  804588:	09 c1                	or     %eax,%ecx
+  80458a:	0f 84 91 00 00 00    	je     804621 <udm+0xb9>
+  804590:	b8 00 00 00 00       	mov    $0x0,%eax
+  804595:	ba 00 00 00 00       	mov    $0x0,%edx
+  80459a:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80459f:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8045a6:	00 
+  8045a7:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8045ae:	00 
+  8045af:	eb 08                	jmp    8045b9 <udm+0x51>
+  8045b1:	83 e9 01             	sub    $0x1,%ecx
+  8045b4:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8045b7:	74 7c                	je     804635 <udm+0xcd>
+  8045b9:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8045bd:	01 c0                	add    %eax,%eax
+  8045bf:	89 c6                	mov    %eax,%esi
+  8045c1:	89 d7                	mov    %edx,%edi
+  8045c3:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8045c7:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8045cb:	0f ad d0             	shrd   %cl,%edx,%eax
+  8045ce:	d3 ea                	shr    %cl,%edx
+  8045d0:	f6 c1 20             	test   $0x20,%cl
+  8045d3:	74 04                	je     8045d9 <udm+0x71>
+  8045d5:	89 d0                	mov    %edx,%eax
+  8045d7:	31 d2                	xor    %edx,%edx
+  8045d9:	83 e0 01             	and    $0x1,%eax
+  8045dc:	89 04 24             	mov    %eax,(%esp)
+  8045df:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8045e6:	00 
+  8045e7:	8b 04 24             	mov    (%esp),%eax
+  8045ea:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8045ee:	09 f0                	or     %esi,%eax
+  8045f0:	09 fa                	or     %edi,%edx
+  8045f2:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8045f6:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8045fa:	39 f0                	cmp    %esi,%eax
+  8045fc:	89 d3                	mov    %edx,%ebx
+  8045fe:	19 fb                	sbb    %edi,%ebx
+  804600:	72 af                	jb     8045b1 <udm+0x49>
+  804602:	29 f0                	sub    %esi,%eax
+  804604:	19 fa                	sbb    %edi,%edx
+  804606:	89 cf                	mov    %ecx,%edi
+  804608:	c1 ef 05             	shr    $0x5,%edi
+  80460b:	83 e7 01             	and    $0x1,%edi
+  80460e:	89 fe                	mov    %edi,%esi
+  804610:	83 f6 01             	xor    $0x1,%esi
+  804613:	d3 e6                	shl    %cl,%esi
+  804615:	d3 e7                	shl    %cl,%edi
+  804617:	09 74 24 18          	or     %esi,0x18(%esp)
+  80461b:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80461f:	eb 90                	jmp    8045b1 <udm+0x49>
+  804621:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804625:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804629:	89 f0                	mov    %esi,%eax
+  80462b:	89 fa                	mov    %edi,%edx
+  80462d:	89 74 24 18          	mov    %esi,0x18(%esp)
+  804631:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  804635:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  804639:	89 01                	mov    %eax,(%ecx)
+  80463b:	89 51 04             	mov    %edx,0x4(%ecx)
+  80463e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804642:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804646:	83 c4 20             	add    $0x20,%esp
+  804649:	5b                   	pop    %ebx
+  80464a:	5e                   	pop    %esi
+  80464b:	5f                   	pop    %edi
+  80464c:	c3                   	ret
+
+0080464d <__udivdi3>:
+  80464d:	83 ec 18             	sub    $0x18,%esp
+  804650:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804654:	50                   	push   %eax
+  804655:	ff 74 24 2c          	push   0x2c(%esp)
+  804659:	ff 74 24 2c          	push   0x2c(%esp)
+  80465d:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804661:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804665:	e8 fe fe ff ff       	call   804568 <udm>
+  80466a:	83 c4 24             	add    $0x24,%esp
+  80466d:	c3                   	ret
+
+0080466e <__umoddi3>:
+  80466e:	83 ec 18             	sub    $0x18,%esp
+  804671:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804675:	50                   	push   %eax
+  804676:	ff 74 24 2c          	push   0x2c(%esp)
+  80467a:	ff 74 24 2c          	push   0x2c(%esp)
+  80467e:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804682:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804686:	e8 dd fe ff ff       	call   804568 <udm>
+  80468b:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80468f:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804693:	83 c4 24             	add    $0x24,%esp
+  804696:	c3                   	ret
+
+00804697 <__divdi3>:
+  804697:	56                   	push   %esi
+  804698:	53                   	push   %ebx
+  804699:	83 ec 14             	sub    $0x14,%esp
+  80469c:	8b 44 24 20          	mov    0x20(%esp),%eax
+  8046a0:	8b 54 24 24          	mov    0x24(%esp),%edx
+  8046a4:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  8046a8:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  8046ac:	85 d2                	test   %edx,%edx
+  8046ae:	78 18                	js     8046c8 <__divdi3+0x31>
+  8046b0:	85 db                	test   %ebx,%ebx
+  8046b2:	78 3e                	js     8046f2 <__divdi3+0x5b>
+  8046b4:	83 ec 04             	sub    $0x4,%esp
+  8046b7:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8046bb:	56                   	push   %esi
+  8046bc:	53                   	push   %ebx
+  8046bd:	51                   	push   %ecx
+  8046be:	e8 a5 fe ff ff       	call   804568 <udm>
+  8046c3:	83 c4 10             	add    $0x10,%esp
+  8046c6:	eb 24                	jmp    8046ec <__divdi3+0x55>
+  8046c8:	f7 d8                	neg    %eax
+  8046ca:	83 d2 00             	adc    $0x0,%edx
+  8046cd:	f7 da                	neg    %edx
+  8046cf:	85 db                	test   %ebx,%ebx
+  8046d1:	78 3a                	js     80470d <__divdi3+0x76>
+  8046d3:	83 ec 04             	sub    $0x4,%esp
+  8046d6:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8046da:	56                   	push   %esi
+  8046db:	53                   	push   %ebx
+  8046dc:	51                   	push   %ecx
+  8046dd:	e8 86 fe ff ff       	call   804568 <udm>
+  8046e2:	83 c4 10             	add    $0x10,%esp
+  8046e5:	f7 d8                	neg    %eax
+  8046e7:	83 d2 00             	adc    $0x0,%edx
+  8046ea:	f7 da                	neg    %edx
+  8046ec:	83 c4 14             	add    $0x14,%esp
+  8046ef:	5b                   	pop    %ebx
+  8046f0:	5e                   	pop    %esi
+  8046f1:	c3                   	ret
+  8046f2:	83 ec 04             	sub    $0x4,%esp
+  8046f5:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8046f9:	56                   	push   %esi
+  8046fa:	f7 d9                	neg    %ecx
+  8046fc:	83 d3 00             	adc    $0x0,%ebx
+  8046ff:	f7 db                	neg    %ebx
+  804701:	53                   	push   %ebx
+  804702:	51                   	push   %ecx
+  804703:	e8 60 fe ff ff       	call   804568 <udm>
+  804708:	83 c4 10             	add    $0x10,%esp
+  80470b:	eb d8                	jmp    8046e5 <__divdi3+0x4e>
+  80470d:	83 ec 04             	sub    $0x4,%esp
+  804710:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804714:	56                   	push   %esi
+  804715:	f7 d9                	neg    %ecx
+  804717:	83 d3 00             	adc    $0x0,%ebx
+  80471a:	f7 db                	neg    %ebx
+  80471c:	53                   	push   %ebx
+  80471d:	51                   	push   %ecx
+  80471e:	e8 45 fe ff ff       	call   804568 <udm>
+  804723:	83 c4 10             	add    $0x10,%esp
+  804726:	eb c4                	jmp    8046ec <__divdi3+0x55>
+
+00804728 <__moddi3>:
+  804728:	55                   	push   %ebp
+  804729:	57                   	push   %edi
+  80472a:	56                   	push   %esi
+  80472b:	53                   	push   %ebx
+  80472c:	83 ec 24             	sub    $0x24,%esp
+  80472f:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804733:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804737:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  80473b:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  80473f:	85 d2                	test   %edx,%edx
+  804741:	78 3b                	js     80477e <__moddi3+0x56>
+  804743:	83 ec 04             	sub    $0x4,%esp
+  804746:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80474a:	56                   	push   %esi
+  80474b:	89 ce                	mov    %ecx,%esi
+  80474d:	f7 de                	neg    %esi
+  80474f:	89 74 24 08          	mov    %esi,0x8(%esp)
+  804753:	89 de                	mov    %ebx,%esi
+  804755:	83 d6 00             	adc    $0x0,%esi
+  804758:	f7 de                	neg    %esi
+  80475a:	89 74 24 14          	mov    %esi,0x14(%esp)
+  80475e:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804762:	0f 48 f1             	cmovs  %ecx,%esi
+  804765:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  80476a:	53                   	push   %ebx
+  80476b:	56                   	push   %esi
+  80476c:	e8 f7 fd ff ff       	call   804568 <udm>
+  804771:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804775:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804779:	83 c4 10             	add    $0x10,%esp
+  80477c:	eb 47                	jmp    8047c5 <__moddi3+0x9d>
+  80477e:	f7 d8                	neg    %eax
+  804780:	83 d2 00             	adc    $0x0,%edx
+  804783:	f7 da                	neg    %edx
+  804785:	83 ec 04             	sub    $0x4,%esp
+  804788:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80478c:	56                   	push   %esi
+  80478d:	89 cf                	mov    %ecx,%edi
+  80478f:	f7 df                	neg    %edi
+  804791:	89 de                	mov    %ebx,%esi
+  804793:	83 d6 00             	adc    $0x0,%esi
+  804796:	f7 de                	neg    %esi
+  804798:	0f 49 cf             	cmovns %edi,%ecx
+  80479b:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  80479f:	0f 49 de             	cmovns %esi,%ebx
+  8047a2:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  8047a6:	ff 74 24 0c          	push   0xc(%esp)
+  8047aa:	ff 74 24 0c          	push   0xc(%esp)
+  8047ae:	e8 b5 fd ff ff       	call   804568 <udm>
+  8047b3:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8047b7:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8047bb:	f7 d8                	neg    %eax
+  8047bd:	83 d2 00             	adc    $0x0,%edx
+  8047c0:	f7 da                	neg    %edx
+  8047c2:	83 c4 10             	add    $0x10,%esp
+  8047c5:	83 c4 24             	add    $0x24,%esp
+  8047c8:	5b                   	pop    %ebx
+  8047c9:	5e                   	pop    %esi
+  8047ca:	5f                   	pop    %edi
+  8047cb:	5d                   	pop    %ebp
+  8047cc:	c3                   	ret
@@ -0,0 +1,9843 @@
+
+obj/user/sysbench.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 7d 01 00 00       	call   8001ae <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+	return ret;
+}
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 20             	sub    $0x20,%esp
+	uint64_t tsc, trap, fast;
+	int i, r;
+
+	// five-argument calls take their last argument from the user stack
+	if ((r = sys_page_alloc(0, VA, PTE_P|PTE_U|PTE_W)) < 0)
+  80003c:	6a 07                	push   $0x7
+  80003e:	68 00 00 00 a0       	push   $0xa0000000
+  800043:	6a 00                	push   $0x0
+  800045:	e8 04 0d 00 00       	call   800d4e <sys_page_alloc>
+  80004a:	83 c4 10             	add    $0x10,%esp
+  80004d:	85 c0                	test   %eax,%eax
+  80004f:	0f 88 9a 00 00 00    	js     8000ef <umain+0xbc>
+		panic("sys_page_alloc: %e", r);
+	strcpy(VA, "sysenter");
+  800055:	83 ec 08             	sub    $0x8,%esp
+  800058:	68 63 48 80 00       	push   $0x804863
+  80005d:	68 00 00 00 a0       	push   $0xa0000000
+  800062:	e8 a9 08 00 00       	call   800910 <strcpy>
+	if ((r = sys_page_map(0, VA, 0, VA2, PTE_P|PTE_U)) < 0)
+  800067:	c7 04 24 05 00 00 00 	movl   $0x5,(%esp)
+  80006e:	68 00 10 00 a0       	push   $0xa0001000
+  800073:	6a 00                	push   $0x0
+  800075:	68 00 00 00 a0       	push   $0xa0000000
+  80007a:	6a 00                	push   $0x0
+  80007c:	e8 1a 0d 00 00       	call   800d9b <sys_page_map>
+  800081:	83 c4 20             	add    $0x20,%esp
+  800084:	85 c0                	test   %eax,%eax
+  800086:	78 79                	js     800101 <umain+0xce>
+		panic("sys_page_map: %e", r);
+	if (strcmp(VA2, "sysenter") != 0 || (uvpt[PGNUM(VA2)] & PTE_W))
+  800088:	83 ec 08             	sub    $0x8,%esp
+  80008b:	68 63 48 80 00       	push   $0x804863
+  800090:	68 00 10 00 a0       	push   $0xa0001000
+  800095:	e8 27 09 00 00       	call   8009c1 <strcmp>
+  80009a:	83 c4 10             	add    $0x10,%esp
+  80009d:	85 c0                	test   %eax,%eax
+  80009f:	75 72                	jne    800113 <umain+0xe0>
+  8000a1:	a1 04 00 68 ef       	mov    0xef680004,%eax
+  8000a6:	a8 02                	test   $0x2,%al
+  8000a8:	75 69                	jne    800113 <umain+0xe0>
+		panic("sys_page_map through sysenter is wrong");
+	sys_page_unmap(0, VA2);
+  8000aa:	83 ec 08             	sub    $0x8,%esp
+  8000ad:	68 00 10 00 a0       	push   $0xa0001000
+  8000b2:	6a 00                	push   $0x0
+  8000b4:	e8 2e 0d 00 00       	call   800de7 <sys_page_unmap>
+	sys_page_unmap(0, VA);
+  8000b9:	83 c4 08             	add    $0x8,%esp
+  8000bc:	68 00 00 00 a0       	push   $0xa0000000
+  8000c1:	6a 00                	push   $0x0
+  8000c3:	e8 1f 0d 00 00       	call   800de7 <sys_page_unmap>
+	asm volatile("int %1"
+  8000c8:	b8 02 00 00 00       	mov    $0x2,%eax
+  8000cd:	cd 30                	int    $0x30
+  8000cf:	89 c3                	mov    %eax,%ebx
+
+	if (getenvid_trap() != sys_getenvid())
+  8000d1:	e8 20 0c 00 00       	call   800cf6 <sys_getenvid>
+  8000d6:	83 c4 10             	add    $0x10,%esp
+  8000d9:	39 d8                	cmp    %ebx,%eax
+  8000db:	75 4a                	jne    800127 <umain+0xf4>
+
+static inline uint64_t
+read_tsc(void)
+{
+	uint64_t tsc;
+	asm volatile("rdtsc" : "=A" (tsc));
+  8000dd:	0f 31                	rdtsc
+  8000df:	89 c1                	mov    %eax,%ecx
+  8000e1:	89 d3                	mov    %edx,%ebx
+		panic("int 0x30 and sysenter disagree");
+
+	tsc = read_tsc();
+	for (i = 0; i < NCALLS; i++)
+  8000e3:	ba a1 86 01 00       	mov    $0x186a1,%edx
+	asm volatile("int %1"
+  8000e8:	be 02 00 00 00       	mov    $0x2,%esi
+	for (i = 0; i < NCALLS; i++)
+  8000ed:	eb 50                	jmp    80013f <umain+0x10c>
+		panic("sys_page_alloc: %e", r);
+  8000ef:	50                   	push   %eax
+  8000f0:	68 40 48 80 00       	push   $0x804840
+  8000f5:	6a 1f                	push   $0x1f
+  8000f7:	68 53 48 80 00       	push   $0x804853
+  8000fc:	e8 50 01 00 00       	call   800251 <_panic>
+		panic("sys_page_map: %e", r);
+  800101:	50                   	push   %eax
+  800102:	68 6c 48 80 00       	push   $0x80486c
+  800107:	6a 22                	push   $0x22
+  800109:	68 53 48 80 00       	push   $0x804853
+  80010e:	e8 3e 01 00 00       	call   800251 <_panic>
+		panic("sys_page_map through sysenter is wrong");
+  800113:	83 ec 04             	sub    $0x4,%esp
+  800116:	68 80 48 80 00       	push   $0x804880
+  80011b:	6a 24                	push   $0x24
+  80011d:	68 53 48 80 00       	push   $0x804853
+  800122:	e8 2a 01 00 00       	call   800251 <_panic>
+		panic("int 0x30 and sysenter disagree");
+  800127:	83 ec 04             	sub    $0x4,%esp
+  80012a:	68 a8 48 80 00       	push   $0x8048a8
+  80012f:	6a 29                	push   $0x29
+  800131:	68 53 48 80 00       	push   $0x804853
+  800136:	e8 16 01 00 00       	call   800251 <_panic>
+	asm volatile("int %1"
+  80013b:	89 f0                	mov    %esi,%eax
+  80013d:	cd 30                	int    $0x30
+	for (i = 0; i < NCALLS; i++)
+  80013f:	83 ea 01             	sub    $0x1,%edx
+  800142:	75 f7                	jne    80013b <umain+0x108>
+  800144:	0f 31                	rdtsc
+		getenvid_trap();
+	trap = read_tsc() - tsc;
+  800146:	29 c8                	sub    %ecx,%eax
+  800148:	19 da                	sbb    %ebx,%edx
+  80014a:	89 c6                	mov    %eax,%esi
+  80014c:	89 d7                	mov    %edx,%edi
+  80014e:	0f 31                	rdtsc
+  800150:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800153:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+
+	tsc = read_tsc();
+	for (i = 0; i < NCALLS; i++)
+  800156:	bb a1 86 01 00       	mov    $0x186a1,%ebx
+  80015b:	eb 05                	jmp    800162 <umain+0x12f>
+		sys_getenvid();
+  80015d:	e8 94 0b 00 00       	call   800cf6 <sys_getenvid>
+	for (i = 0; i < NCALLS; i++)
+  800162:	83 eb 01             	sub    $0x1,%ebx
+  800165:	75 f6                	jne    80015d <umain+0x12a>
+  800167:	0f 31                	rdtsc
+	fast = read_tsc() - tsc;
+
+	cprintf("sys_getenvid: int 0x30 %d cycles, sysenter %d cycles\n",
+  800169:	83 ec 10             	sub    $0x10,%esp
+	fast = read_tsc() - tsc;
+  80016c:	2b 45 e0             	sub    -0x20(%ebp),%eax
+  80016f:	1b 55 e4             	sbb    -0x1c(%ebp),%edx
+		(uint32_t) (trap / NCALLS), (uint32_t) (fast / NCALLS));
+  800172:	6a 00                	push   $0x0
+  800174:	68 a0 86 01 00       	push   $0x186a0
+  800179:	52                   	push   %edx
+  80017a:	50                   	push   %eax
+  80017b:	e8 34 45 00 00       	call   8046b4 <__udivdi3>
+  800180:	83 c4 1c             	add    $0x1c,%esp
+	cprintf("sys_getenvid: int 0x30 %d cycles, sysenter %d cycles\n",
+  800183:	50                   	push   %eax
+		(uint32_t) (trap / NCALLS), (uint32_t) (fast / NCALLS));
+  800184:	83 ec 08             	sub    $0x8,%esp
+  800187:	6a 00                	push   $0x0
+  800189:	68 a0 86 01 00       	push   $0x186a0
+  80018e:	57                   	push   %edi
+  80018f:	56                   	push   %esi
+  800190:	e8 1f 45 00 00       	call   8046b4 <__udivdi3>
+  800195:	83 c4 18             	add    $0x18,%esp
+	cprintf("sys_getenvid: int 0x30 %d cycles, sysenter %d cycles\n",
+  800198:	50                   	push   %eax
+  800199:	68 c8 48 80 00       	push   $0x8048c8
+  80019e:	e8 89 01 00 00       	call   80032c <cprintf>
+}
+  8001a3:	83 c4 10             	add    $0x10,%esp
+  8001a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001a9:	5b                   	pop    %ebx
+  8001aa:	5e                   	pop    %esi
+  8001ab:	5f                   	pop    %edi
+  8001ac:	5d                   	pop    %ebp
+  8001ad:	c3                   	ret
+
+008001ae <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001ae:	55                   	push   %ebp
+  8001af:	89 e5                	mov    %esp,%ebp
+  8001b1:	57                   	push   %edi
+  8001b2:	56                   	push   %esi
+  8001b3:	53                   	push   %ebx
+  8001b4:	83 ec 1c             	sub    $0x1c,%esp
+  8001b7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001ba:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  8001bd:	e8 34 0b 00 00       	call   800cf6 <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  8001c2:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  8001c5:	89 15 c0 72 80 00    	mov    %edx,0x8072c0
+	thisenv = &envs[ENVX(eid)];
+  8001cb:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001d0:	89 c1                	mov    %eax,%ecx
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  8001d2:	89 e7                	mov    %esp,%edi
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8001d4:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  8001da:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8001df:	77 16                	ja     8001f7 <libmain+0x49>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8001e1:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8001e6:	29 f8                	sub    %edi,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  8001e8:	c1 e8 10             	shr    $0x10,%eax
+  8001eb:	74 0a                	je     8001f7 <libmain+0x49>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8001ed:	c1 e0 10             	shl    $0x10,%eax
+  8001f0:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8001f5:	29 c2                	sub    %eax,%edx
+  8001f7:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  8001fa:	c1 e0 04             	shl    $0x4,%eax
+  8001fd:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800202:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800204:	85 db                	test   %ebx,%ebx
+  800206:	7e 07                	jle    80020f <libmain+0x61>
+		binaryname = argv[0];
+  800208:	8b 06                	mov    (%esi),%eax
+  80020a:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// call user main routine
+	umain(argc, argv);
+  80020f:	83 ec 08             	sub    $0x8,%esp
+  800212:	56                   	push   %esi
+  800213:	53                   	push   %ebx
+  800214:	e8 1a fe ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800219:	e8 0b 00 00 00       	call   800229 <exit>
+}
+  80021e:	83 c4 10             	add    $0x10,%esp
+  800221:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800224:	5b                   	pop    %ebx
+  800225:	5e                   	pop    %esi
+  800226:	5f                   	pop    %edi
+  800227:	5d                   	pop    %ebp
+  800228:	c3                   	ret
+
+00800229 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800229:	55                   	push   %ebp
+  80022a:	89 e5                	mov    %esp,%ebp
+  80022c:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  80022f:	6a 00                	push   $0x0
+  800231:	e8 15 21 00 00       	call   80234b <fflush>
+	pthread_kill_others();
+  800236:	e8 80 37 00 00       	call   8039bb <pthread_kill_others>
+	close_all();
+  80023b:	e8 ae 11 00 00       	call   8013ee <close_all>
+	sys_env_destroy(0);
+  800240:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800247:	e8 5f 0a 00 00       	call   800cab <sys_env_destroy>
+}
+  80024c:	83 c4 10             	add    $0x10,%esp
+  80024f:	c9                   	leave
+  800250:	c3                   	ret
+
+00800251 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800251:	55                   	push   %ebp
+  800252:	89 e5                	mov    %esp,%ebp
+  800254:	56                   	push   %esi
+  800255:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800256:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800259:	8b 35 00 60 80 00    	mov    0x806000,%esi
+  80025f:	e8 92 0a 00 00       	call   800cf6 <sys_getenvid>
+  800264:	83 ec 0c             	sub    $0xc,%esp
+  800267:	ff 75 0c             	push   0xc(%ebp)
+  80026a:	ff 75 08             	push   0x8(%ebp)
+  80026d:	56                   	push   %esi
+  80026e:	50                   	push   %eax
+  80026f:	68 08 49 80 00       	push   $0x804908
+  800274:	e8 b3 00 00 00       	call   80032c <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800279:	83 c4 18             	add    $0x18,%esp
+  80027c:	53                   	push   %ebx
+  80027d:	ff 75 10             	push   0x10(%ebp)
+  800280:	e8 56 00 00 00       	call   8002db <vcprintf>
+	cprintf("\n");
+  800285:	c7 04 24 de 4f 80 00 	movl   $0x804fde,(%esp)
+  80028c:	e8 9b 00 00 00       	call   80032c <cprintf>
+  800291:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800294:	cc                   	int3
+	while (1)
+  800295:	eb fd                	jmp    800294 <_panic+0x43>
+
+00800297 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800297:	55                   	push   %ebp
+  800298:	89 e5                	mov    %esp,%ebp
+  80029a:	53                   	push   %ebx
+  80029b:	83 ec 04             	sub    $0x4,%esp
+  80029e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8002a1:	8b 13                	mov    (%ebx),%edx
+  8002a3:	8d 42 01             	lea    0x1(%edx),%eax
+  8002a6:	89 03                	mov    %eax,(%ebx)
+  8002a8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8002ab:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8002af:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8002b4:	74 09                	je     8002bf <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8002b6:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8002ba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8002bd:	c9                   	leave
+  8002be:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8002bf:	83 ec 08             	sub    $0x8,%esp
+  8002c2:	68 ff 00 00 00       	push   $0xff
+  8002c7:	8d 43 08             	lea    0x8(%ebx),%eax
+  8002ca:	50                   	push   %eax
+  8002cb:	e8 84 09 00 00       	call   800c54 <sys_cputs>
+		b->idx = 0;
+  8002d0:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8002d6:	83 c4 10             	add    $0x10,%esp
+  8002d9:	eb db                	jmp    8002b6 <putch+0x1f>
+
+008002db <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8002db:	55                   	push   %ebp
+  8002dc:	89 e5                	mov    %esp,%ebp
+  8002de:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8002e4:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002eb:	00 00 00 
+	b.cnt = 0;
+  8002ee:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8002f5:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8002f8:	ff 75 0c             	push   0xc(%ebp)
+  8002fb:	ff 75 08             	push   0x8(%ebp)
+  8002fe:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800304:	50                   	push   %eax
+  800305:	68 97 02 80 00       	push   $0x800297
+  80030a:	e8 14 01 00 00       	call   800423 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80030f:	83 c4 08             	add    $0x8,%esp
+  800312:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800318:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80031e:	50                   	push   %eax
+  80031f:	e8 30 09 00 00       	call   800c54 <sys_cputs>
+
+	return b.cnt;
+}
+  800324:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80032a:	c9                   	leave
+  80032b:	c3                   	ret
+
+0080032c <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80032c:	55                   	push   %ebp
+  80032d:	89 e5                	mov    %esp,%ebp
+  80032f:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800332:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800335:	50                   	push   %eax
+  800336:	ff 75 08             	push   0x8(%ebp)
+  800339:	e8 9d ff ff ff       	call   8002db <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80033e:	c9                   	leave
+  80033f:	c3                   	ret
+
+00800340 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800340:	55                   	push   %ebp
+  800341:	89 e5                	mov    %esp,%ebp
+  800343:	57                   	push   %edi
+  800344:	56                   	push   %esi
+  800345:	53                   	push   %ebx
+  800346:	83 ec 1c             	sub    $0x1c,%esp
+  800349:	89 c7                	mov    %eax,%edi
+  80034b:	89 d6                	mov    %edx,%esi
+  80034d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800350:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800353:	89 d1                	mov    %edx,%ecx
+  800355:	89 c2                	mov    %eax,%edx
+  800357:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80035a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80035d:	8b 45 10             	mov    0x10(%ebp),%eax
+  800360:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800363:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800366:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80036d:	39 c2                	cmp    %eax,%edx
+  80036f:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800372:	72 3e                	jb     8003b2 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800374:	83 ec 0c             	sub    $0xc,%esp
+  800377:	ff 75 18             	push   0x18(%ebp)
+  80037a:	83 eb 01             	sub    $0x1,%ebx
+  80037d:	53                   	push   %ebx
+  80037e:	50                   	push   %eax
+  80037f:	83 ec 08             	sub    $0x8,%esp
+  800382:	ff 75 e4             	push   -0x1c(%ebp)
+  800385:	ff 75 e0             	push   -0x20(%ebp)
+  800388:	ff 75 dc             	push   -0x24(%ebp)
+  80038b:	ff 75 d8             	push   -0x28(%ebp)
+  80038e:	e8 21 43 00 00       	call   8046b4 <__udivdi3>
+  800393:	83 c4 18             	add    $0x18,%esp
+  800396:	52                   	push   %edx
+  800397:	50                   	push   %eax
+  800398:	89 f2                	mov    %esi,%edx
+  80039a:	89 f8                	mov    %edi,%eax
+  80039c:	e8 9f ff ff ff       	call   800340 <printnum>
+  8003a1:	83 c4 20             	add    $0x20,%esp
+  8003a4:	eb 13                	jmp    8003b9 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8003a6:	83 ec 08             	sub    $0x8,%esp
+  8003a9:	56                   	push   %esi
+  8003aa:	ff 75 18             	push   0x18(%ebp)
+  8003ad:	ff d7                	call   *%edi
+  8003af:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8003b2:	83 eb 01             	sub    $0x1,%ebx
+  8003b5:	85 db                	test   %ebx,%ebx
+  8003b7:	7f ed                	jg     8003a6 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8003b9:	83 ec 08             	sub    $0x8,%esp
+  8003bc:	56                   	push   %esi
+  8003bd:	83 ec 04             	sub    $0x4,%esp
+  8003c0:	ff 75 e4             	push   -0x1c(%ebp)
+  8003c3:	ff 75 e0             	push   -0x20(%ebp)
+  8003c6:	ff 75 dc             	push   -0x24(%ebp)
+  8003c9:	ff 75 d8             	push   -0x28(%ebp)
+  8003cc:	e8 04 43 00 00       	call   8046d5 <__umoddi3>
+  8003d1:	83 c4 14             	add    $0x14,%esp
+  8003d4:	0f be 80 2b 49 80 00 	movsbl 0x80492b(%eax),%eax
+  8003db:	50                   	push   %eax
+  8003dc:	ff d7                	call   *%edi
+}
+  8003de:	83 c4 10             	add    $0x10,%esp
+  8003e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003e4:	5b                   	pop    %ebx
+  8003e5:	5e                   	pop    %esi
+  8003e6:	5f                   	pop    %edi
+  8003e7:	5d                   	pop    %ebp
+  8003e8:	c3                   	ret
+
+008003e9 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8003e9:	55                   	push   %ebp
+  8003ea:	89 e5                	mov    %esp,%ebp
+  8003ec:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8003ef:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8003f3:	8b 10                	mov    (%eax),%edx
+  8003f5:	3b 50 04             	cmp    0x4(%eax),%edx
+  8003f8:	73 0a                	jae    800404 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8003fa:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003fd:	89 08                	mov    %ecx,(%eax)
+  8003ff:	8b 45 08             	mov    0x8(%ebp),%eax
+  800402:	88 02                	mov    %al,(%edx)
+}
+  800404:	5d                   	pop    %ebp
+  800405:	c3                   	ret
+
+00800406 <printfmt>:
+{
+  800406:	55                   	push   %ebp
+  800407:	89 e5                	mov    %esp,%ebp
+  800409:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80040c:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80040f:	50                   	push   %eax
+  800410:	ff 75 10             	push   0x10(%ebp)
+  800413:	ff 75 0c             	push   0xc(%ebp)
+  800416:	ff 75 08             	push   0x8(%ebp)
+  800419:	e8 05 00 00 00       	call   800423 <vprintfmt>
+}
+  80041e:	83 c4 10             	add    $0x10,%esp
+  800421:	c9                   	leave
+  800422:	c3                   	ret
+
+00800423 <vprintfmt>:
+{
+  800423:	55                   	push   %ebp
+  800424:	89 e5                	mov    %esp,%ebp
+  800426:	57                   	push   %edi
+  800427:	56                   	push   %esi
+  800428:	53                   	push   %ebx
+  800429:	83 ec 2c             	sub    $0x2c,%esp
+  80042c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80042f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800432:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800435:	eb 0a                	jmp    800441 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800437:	83 ec 08             	sub    $0x8,%esp
+  80043a:	53                   	push   %ebx
+  80043b:	50                   	push   %eax
+  80043c:	ff d6                	call   *%esi
+  80043e:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  800441:	83 c7 01             	add    $0x1,%edi
+  800444:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  800448:	83 f8 25             	cmp    $0x25,%eax
+  80044b:	74 0c                	je     800459 <vprintfmt+0x36>
+			if (ch == '\0')
+  80044d:	85 c0                	test   %eax,%eax
+  80044f:	75 e6                	jne    800437 <vprintfmt+0x14>
+}
+  800451:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800454:	5b                   	pop    %ebx
+  800455:	5e                   	pop    %esi
+  800456:	5f                   	pop    %edi
+  800457:	5d                   	pop    %ebp
+  800458:	c3                   	ret
+		padc = ' ';
+  800459:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80045d:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800464:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80046b:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800472:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  800477:	8d 47 01             	lea    0x1(%edi),%eax
+  80047a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80047d:	0f b6 17             	movzbl (%edi),%edx
+  800480:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800483:	3c 55                	cmp    $0x55,%al
+  800485:	0f 87 c5 03 00 00    	ja     800850 <vprintfmt+0x42d>
+  80048b:	0f b6 c0             	movzbl %al,%eax
+  80048e:	ff 24 85 a0 4a 80 00 	jmp    *0x804aa0(,%eax,4)
+  800495:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  800498:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80049b:	eb da                	jmp    800477 <vprintfmt+0x54>
+  80049d:	0f be d2             	movsbl %dl,%edx
+  8004a0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8004a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004a8:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8004ab:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8004ae:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8004b2:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8004b5:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8004b8:	83 f9 09             	cmp    $0x9,%ecx
+  8004bb:	77 55                	ja     800512 <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  8004bd:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8004c0:	eb e9                	jmp    8004ab <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  8004c2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004c5:	8b 00                	mov    (%eax),%eax
+  8004c7:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004cd:	8d 40 04             	lea    0x4(%eax),%eax
+  8004d0:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  8004d3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8004d6:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004da:	79 9b                	jns    800477 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8004dc:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004df:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004e2:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8004e9:	eb 8c                	jmp    800477 <vprintfmt+0x54>
+			if (width < 0)
+  8004eb:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004ee:	85 d2                	test   %edx,%edx
+  8004f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004f5:	0f 49 c2             	cmovns %edx,%eax
+  8004f8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  8004fb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8004fe:	e9 74 ff ff ff       	jmp    800477 <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  800503:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800506:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80050d:	e9 65 ff ff ff       	jmp    800477 <vprintfmt+0x54>
+  800512:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800515:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800518:	eb bc                	jmp    8004d6 <vprintfmt+0xb3>
+			lflag++;
+  80051a:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  80051d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800520:	e9 52 ff ff ff       	jmp    800477 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800525:	8b 45 14             	mov    0x14(%ebp),%eax
+  800528:	8d 78 04             	lea    0x4(%eax),%edi
+  80052b:	83 ec 08             	sub    $0x8,%esp
+  80052e:	53                   	push   %ebx
+  80052f:	ff 30                	push   (%eax)
+  800531:	ff d6                	call   *%esi
+			break;
+  800533:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800536:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800539:	e9 b1 02 00 00       	jmp    8007ef <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  80053e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800541:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800544:	8b 10                	mov    (%eax),%edx
+  800546:	89 d0                	mov    %edx,%eax
+  800548:	f7 d8                	neg    %eax
+  80054a:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80054d:	83 f8 14             	cmp    $0x14,%eax
+  800550:	7f 23                	jg     800575 <vprintfmt+0x152>
+  800552:	8b 14 85 00 4c 80 00 	mov    0x804c00(,%eax,4),%edx
+  800559:	85 d2                	test   %edx,%edx
+  80055b:	74 18                	je     800575 <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  80055d:	52                   	push   %edx
+  80055e:	68 6f 4d 80 00       	push   $0x804d6f
+  800563:	53                   	push   %ebx
+  800564:	56                   	push   %esi
+  800565:	e8 9c fe ff ff       	call   800406 <printfmt>
+  80056a:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80056d:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800570:	e9 7a 02 00 00       	jmp    8007ef <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  800575:	50                   	push   %eax
+  800576:	68 43 49 80 00       	push   $0x804943
+  80057b:	53                   	push   %ebx
+  80057c:	56                   	push   %esi
+  80057d:	e8 84 fe ff ff       	call   800406 <printfmt>
+  800582:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800585:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800588:	e9 62 02 00 00       	jmp    8007ef <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80058d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800590:	83 c0 04             	add    $0x4,%eax
+  800593:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800596:	8b 45 14             	mov    0x14(%ebp),%eax
+  800599:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80059b:	85 c9                	test   %ecx,%ecx
+  80059d:	b8 3c 49 80 00       	mov    $0x80493c,%eax
+  8005a2:	0f 45 c1             	cmovne %ecx,%eax
+  8005a5:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8005a8:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005ac:	7e 06                	jle    8005b4 <vprintfmt+0x191>
+  8005ae:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8005b2:	75 0b                	jne    8005bf <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005b4:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8005b7:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8005ba:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005bd:	eb 5c                	jmp    80061b <vprintfmt+0x1f8>
+  8005bf:	83 ec 08             	sub    $0x8,%esp
+  8005c2:	ff 75 d0             	push   -0x30(%ebp)
+  8005c5:	ff 75 cc             	push   -0x34(%ebp)
+  8005c8:	e8 20 03 00 00       	call   8008ed <strnlen>
+  8005cd:	89 c2                	mov    %eax,%edx
+  8005cf:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005d2:	29 d0                	sub    %edx,%eax
+  8005d4:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8005d7:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8005db:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005de:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005e1:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005e3:	eb 0e                	jmp    8005f3 <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  8005e5:	83 ec 08             	sub    $0x8,%esp
+  8005e8:	53                   	push   %ebx
+  8005e9:	57                   	push   %edi
+  8005ea:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005ed:	83 ee 01             	sub    $0x1,%esi
+  8005f0:	83 c4 10             	add    $0x10,%esp
+  8005f3:	85 f6                	test   %esi,%esi
+  8005f5:	7f ee                	jg     8005e5 <vprintfmt+0x1c2>
+  8005f7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005fa:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005fd:	85 c0                	test   %eax,%eax
+  8005ff:	ba 00 00 00 00       	mov    $0x0,%edx
+  800604:	0f 49 d0             	cmovns %eax,%edx
+  800607:	29 d0                	sub    %edx,%eax
+  800609:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80060c:	eb a6                	jmp    8005b4 <vprintfmt+0x191>
+					putch(ch, putdat);
+  80060e:	83 ec 08             	sub    $0x8,%esp
+  800611:	53                   	push   %ebx
+  800612:	52                   	push   %edx
+  800613:	ff 55 08             	call   *0x8(%ebp)
+  800616:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800619:	89 f1                	mov    %esi,%ecx
+  80061b:	8d 71 01             	lea    0x1(%ecx),%esi
+  80061e:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800622:	0f be d0             	movsbl %al,%edx
+  800625:	85 d2                	test   %edx,%edx
+  800627:	74 28                	je     800651 <vprintfmt+0x22e>
+  800629:	85 ff                	test   %edi,%edi
+  80062b:	78 05                	js     800632 <vprintfmt+0x20f>
+  80062d:	83 ef 01             	sub    $0x1,%edi
+  800630:	78 30                	js     800662 <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800632:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800636:	74 d6                	je     80060e <vprintfmt+0x1eb>
+  800638:	0f be c0             	movsbl %al,%eax
+  80063b:	83 e8 20             	sub    $0x20,%eax
+  80063e:	83 f8 5e             	cmp    $0x5e,%eax
+  800641:	76 cb                	jbe    80060e <vprintfmt+0x1eb>
+					putch('?', putdat);
+  800643:	83 ec 08             	sub    $0x8,%esp
+  800646:	53                   	push   %ebx
+  800647:	6a 3f                	push   $0x3f
+  800649:	ff 55 08             	call   *0x8(%ebp)
+  80064c:	83 c4 10             	add    $0x10,%esp
+  80064f:	eb c8                	jmp    800619 <vprintfmt+0x1f6>
+  800651:	8b 75 08             	mov    0x8(%ebp),%esi
+  800654:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800657:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80065a:	01 d0                	add    %edx,%eax
+  80065c:	29 c8                	sub    %ecx,%eax
+  80065e:	89 c7                	mov    %eax,%edi
+  800660:	eb 13                	jmp    800675 <vprintfmt+0x252>
+  800662:	8b 75 08             	mov    0x8(%ebp),%esi
+  800665:	eb ed                	jmp    800654 <vprintfmt+0x231>
+				putch(' ', putdat);
+  800667:	83 ec 08             	sub    $0x8,%esp
+  80066a:	53                   	push   %ebx
+  80066b:	6a 20                	push   $0x20
+  80066d:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80066f:	83 ef 01             	sub    $0x1,%edi
+  800672:	83 c4 10             	add    $0x10,%esp
+  800675:	85 ff                	test   %edi,%edi
+  800677:	7f ee                	jg     800667 <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800679:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80067c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80067f:	e9 6b 01 00 00       	jmp    8007ef <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  800684:	83 f9 01             	cmp    $0x1,%ecx
+  800687:	7f 1f                	jg     8006a8 <vprintfmt+0x285>
+	else if (lflag)
+  800689:	85 c9                	test   %ecx,%ecx
+  80068b:	74 67                	je     8006f4 <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  80068d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800690:	8b 00                	mov    (%eax),%eax
+  800692:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800695:	89 c1                	mov    %eax,%ecx
+  800697:	c1 f9 1f             	sar    $0x1f,%ecx
+  80069a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80069d:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a0:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006a6:	eb 17                	jmp    8006bf <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  8006a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ab:	8b 50 04             	mov    0x4(%eax),%edx
+  8006ae:	8b 00                	mov    (%eax),%eax
+  8006b0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006b3:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006b6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b9:	8d 40 08             	lea    0x8(%eax),%eax
+  8006bc:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8006bf:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006c2:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8006c5:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8006ca:	85 c9                	test   %ecx,%ecx
+  8006cc:	0f 89 03 01 00 00    	jns    8007d5 <vprintfmt+0x3b2>
+				putch('-', putdat);
+  8006d2:	83 ec 08             	sub    $0x8,%esp
+  8006d5:	53                   	push   %ebx
+  8006d6:	6a 2d                	push   $0x2d
+  8006d8:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8006da:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006dd:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8006e0:	f7 da                	neg    %edx
+  8006e2:	83 d1 00             	adc    $0x0,%ecx
+  8006e5:	f7 d9                	neg    %ecx
+  8006e7:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8006ea:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8006ef:	e9 e1 00 00 00       	jmp    8007d5 <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  8006f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f7:	8b 00                	mov    (%eax),%eax
+  8006f9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006fc:	89 c1                	mov    %eax,%ecx
+  8006fe:	c1 f9 1f             	sar    $0x1f,%ecx
+  800701:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800704:	8b 45 14             	mov    0x14(%ebp),%eax
+  800707:	8d 40 04             	lea    0x4(%eax),%eax
+  80070a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80070d:	eb b0                	jmp    8006bf <vprintfmt+0x29c>
+	if (lflag >= 2)
+  80070f:	83 f9 01             	cmp    $0x1,%ecx
+  800712:	7f 1e                	jg     800732 <vprintfmt+0x30f>
+	else if (lflag)
+  800714:	85 c9                	test   %ecx,%ecx
+  800716:	74 32                	je     80074a <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  800718:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071b:	8b 10                	mov    (%eax),%edx
+  80071d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800722:	8d 40 04             	lea    0x4(%eax),%eax
+  800725:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800728:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80072d:	e9 a3 00 00 00       	jmp    8007d5 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800732:	8b 45 14             	mov    0x14(%ebp),%eax
+  800735:	8b 10                	mov    (%eax),%edx
+  800737:	8b 48 04             	mov    0x4(%eax),%ecx
+  80073a:	8d 40 08             	lea    0x8(%eax),%eax
+  80073d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800740:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800745:	e9 8b 00 00 00       	jmp    8007d5 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  80074a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80074d:	8b 10                	mov    (%eax),%edx
+  80074f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800754:	8d 40 04             	lea    0x4(%eax),%eax
+  800757:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80075a:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80075f:	eb 74                	jmp    8007d5 <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  800761:	83 f9 01             	cmp    $0x1,%ecx
+  800764:	7f 1b                	jg     800781 <vprintfmt+0x35e>
+	else if (lflag)
+  800766:	85 c9                	test   %ecx,%ecx
+  800768:	74 2c                	je     800796 <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  80076a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80076d:	8b 10                	mov    (%eax),%edx
+  80076f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800774:	8d 40 04             	lea    0x4(%eax),%eax
+  800777:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80077a:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  80077f:	eb 54                	jmp    8007d5 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800781:	8b 45 14             	mov    0x14(%ebp),%eax
+  800784:	8b 10                	mov    (%eax),%edx
+  800786:	8b 48 04             	mov    0x4(%eax),%ecx
+  800789:	8d 40 08             	lea    0x8(%eax),%eax
+  80078c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80078f:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800794:	eb 3f                	jmp    8007d5 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800796:	8b 45 14             	mov    0x14(%ebp),%eax
+  800799:	8b 10                	mov    (%eax),%edx
+  80079b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007a0:	8d 40 04             	lea    0x4(%eax),%eax
+  8007a3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007a6:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8007ab:	eb 28                	jmp    8007d5 <vprintfmt+0x3b2>
+			putch('0', putdat);
+  8007ad:	83 ec 08             	sub    $0x8,%esp
+  8007b0:	53                   	push   %ebx
+  8007b1:	6a 30                	push   $0x30
+  8007b3:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8007b5:	83 c4 08             	add    $0x8,%esp
+  8007b8:	53                   	push   %ebx
+  8007b9:	6a 78                	push   $0x78
+  8007bb:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8007bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c0:	8b 10                	mov    (%eax),%edx
+  8007c2:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8007c7:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8007ca:	8d 40 04             	lea    0x4(%eax),%eax
+  8007cd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007d0:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8007d5:	83 ec 0c             	sub    $0xc,%esp
+  8007d8:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8007dc:	50                   	push   %eax
+  8007dd:	ff 75 e0             	push   -0x20(%ebp)
+  8007e0:	57                   	push   %edi
+  8007e1:	51                   	push   %ecx
+  8007e2:	52                   	push   %edx
+  8007e3:	89 da                	mov    %ebx,%edx
+  8007e5:	89 f0                	mov    %esi,%eax
+  8007e7:	e8 54 fb ff ff       	call   800340 <printnum>
+			break;
+  8007ec:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8007ef:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  8007f2:	e9 4a fc ff ff       	jmp    800441 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8007f7:	83 f9 01             	cmp    $0x1,%ecx
+  8007fa:	7f 1b                	jg     800817 <vprintfmt+0x3f4>
+	else if (lflag)
+  8007fc:	85 c9                	test   %ecx,%ecx
+  8007fe:	74 2c                	je     80082c <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  800800:	8b 45 14             	mov    0x14(%ebp),%eax
+  800803:	8b 10                	mov    (%eax),%edx
+  800805:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80080a:	8d 40 04             	lea    0x4(%eax),%eax
+  80080d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800810:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800815:	eb be                	jmp    8007d5 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800817:	8b 45 14             	mov    0x14(%ebp),%eax
+  80081a:	8b 10                	mov    (%eax),%edx
+  80081c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80081f:	8d 40 08             	lea    0x8(%eax),%eax
+  800822:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800825:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80082a:	eb a9                	jmp    8007d5 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  80082c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80082f:	8b 10                	mov    (%eax),%edx
+  800831:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800836:	8d 40 04             	lea    0x4(%eax),%eax
+  800839:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80083c:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800841:	eb 92                	jmp    8007d5 <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  800843:	83 ec 08             	sub    $0x8,%esp
+  800846:	53                   	push   %ebx
+  800847:	6a 25                	push   $0x25
+  800849:	ff d6                	call   *%esi
+			break;
+  80084b:	83 c4 10             	add    $0x10,%esp
+  80084e:	eb 9f                	jmp    8007ef <vprintfmt+0x3cc>
+			putch('%', putdat);
+  800850:	83 ec 08             	sub    $0x8,%esp
+  800853:	53                   	push   %ebx
+  800854:	6a 25                	push   $0x25
+  800856:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800858:	83 c4 10             	add    $0x10,%esp
+  80085b:	89 f8                	mov    %edi,%eax
+  80085d:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800861:	74 05                	je     800868 <vprintfmt+0x445>
+  800863:	83 e8 01             	sub    $0x1,%eax
+  800866:	eb f5                	jmp    80085d <vprintfmt+0x43a>
+  800868:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80086b:	eb 82                	jmp    8007ef <vprintfmt+0x3cc>
+
+0080086d <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80086d:	55                   	push   %ebp
+  80086e:	89 e5                	mov    %esp,%ebp
+  800870:	83 ec 18             	sub    $0x18,%esp
+  800873:	8b 45 08             	mov    0x8(%ebp),%eax
+  800876:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800879:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80087c:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800880:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800883:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80088a:	85 c0                	test   %eax,%eax
+  80088c:	74 26                	je     8008b4 <vsnprintf+0x47>
+  80088e:	85 d2                	test   %edx,%edx
+  800890:	7e 22                	jle    8008b4 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800892:	ff 75 14             	push   0x14(%ebp)
+  800895:	ff 75 10             	push   0x10(%ebp)
+  800898:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80089b:	50                   	push   %eax
+  80089c:	68 e9 03 80 00       	push   $0x8003e9
+  8008a1:	e8 7d fb ff ff       	call   800423 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8008a6:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8008a9:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8008ac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008af:	83 c4 10             	add    $0x10,%esp
+}
+  8008b2:	c9                   	leave
+  8008b3:	c3                   	ret
+		return -E_INVAL;
+  8008b4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008b9:	eb f7                	jmp    8008b2 <vsnprintf+0x45>
+
+008008bb <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8008bb:	55                   	push   %ebp
+  8008bc:	89 e5                	mov    %esp,%ebp
+  8008be:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8008c1:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8008c4:	50                   	push   %eax
+  8008c5:	ff 75 10             	push   0x10(%ebp)
+  8008c8:	ff 75 0c             	push   0xc(%ebp)
+  8008cb:	ff 75 08             	push   0x8(%ebp)
+  8008ce:	e8 9a ff ff ff       	call   80086d <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8008d3:	c9                   	leave
+  8008d4:	c3                   	ret
+
+008008d5 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8008d5:	55                   	push   %ebp
+  8008d6:	89 e5                	mov    %esp,%ebp
+  8008d8:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8008db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008e0:	eb 03                	jmp    8008e5 <strlen+0x10>
+		n++;
+  8008e2:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8008e5:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008e9:	75 f7                	jne    8008e2 <strlen+0xd>
+	return n;
+}
+  8008eb:	5d                   	pop    %ebp
+  8008ec:	c3                   	ret
+
+008008ed <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8008ed:	55                   	push   %ebp
+  8008ee:	89 e5                	mov    %esp,%ebp
+  8008f0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008f3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008fb:	eb 03                	jmp    800900 <strnlen+0x13>
+		n++;
+  8008fd:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800900:	39 d0                	cmp    %edx,%eax
+  800902:	74 08                	je     80090c <strnlen+0x1f>
+  800904:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800908:	75 f3                	jne    8008fd <strnlen+0x10>
+  80090a:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80090c:	89 d0                	mov    %edx,%eax
+  80090e:	5d                   	pop    %ebp
+  80090f:	c3                   	ret
+
+00800910 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800910:	55                   	push   %ebp
+  800911:	89 e5                	mov    %esp,%ebp
+  800913:	53                   	push   %ebx
+  800914:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800917:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80091a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80091f:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800923:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800926:	83 c0 01             	add    $0x1,%eax
+  800929:	84 d2                	test   %dl,%dl
+  80092b:	75 f2                	jne    80091f <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80092d:	89 c8                	mov    %ecx,%eax
+  80092f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800932:	c9                   	leave
+  800933:	c3                   	ret
+
+00800934 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800934:	55                   	push   %ebp
+  800935:	89 e5                	mov    %esp,%ebp
+  800937:	53                   	push   %ebx
+  800938:	83 ec 10             	sub    $0x10,%esp
+  80093b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80093e:	53                   	push   %ebx
+  80093f:	e8 91 ff ff ff       	call   8008d5 <strlen>
+  800944:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800947:	ff 75 0c             	push   0xc(%ebp)
+  80094a:	01 d8                	add    %ebx,%eax
+  80094c:	50                   	push   %eax
+  80094d:	e8 be ff ff ff       	call   800910 <strcpy>
+	return dst;
+}
+  800952:	89 d8                	mov    %ebx,%eax
+  800954:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800957:	c9                   	leave
+  800958:	c3                   	ret
+
+00800959 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800959:	55                   	push   %ebp
+  80095a:	89 e5                	mov    %esp,%ebp
+  80095c:	56                   	push   %esi
+  80095d:	53                   	push   %ebx
+  80095e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800961:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800964:	89 f3                	mov    %esi,%ebx
+  800966:	03 5d 10             	add    0x10(%ebp),%ebx
+  800969:	89 f0                	mov    %esi,%eax
+  80096b:	eb 0f                	jmp    80097c <strncpy+0x23>
+		*dst++ = *src;
+  80096d:	83 c0 01             	add    $0x1,%eax
+  800970:	0f b6 0a             	movzbl (%edx),%ecx
+  800973:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800976:	80 f9 01             	cmp    $0x1,%cl
+  800979:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80097c:	39 d8                	cmp    %ebx,%eax
+  80097e:	75 ed                	jne    80096d <strncpy+0x14>
+	}
+	return ret;
+}
+  800980:	89 f0                	mov    %esi,%eax
+  800982:	5b                   	pop    %ebx
+  800983:	5e                   	pop    %esi
+  800984:	5d                   	pop    %ebp
+  800985:	c3                   	ret
+
+00800986 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800986:	55                   	push   %ebp
+  800987:	89 e5                	mov    %esp,%ebp
+  800989:	56                   	push   %esi
+  80098a:	53                   	push   %ebx
+  80098b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80098e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800991:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800994:	89 f0                	mov    %esi,%eax
+  800996:	85 d2                	test   %edx,%edx
+  800998:	74 21                	je     8009bb <strlcpy+0x35>
+  80099a:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80099e:	89 f2                	mov    %esi,%edx
+  8009a0:	eb 09                	jmp    8009ab <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8009a2:	83 c1 01             	add    $0x1,%ecx
+  8009a5:	83 c2 01             	add    $0x1,%edx
+  8009a8:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8009ab:	39 c2                	cmp    %eax,%edx
+  8009ad:	74 09                	je     8009b8 <strlcpy+0x32>
+  8009af:	0f b6 19             	movzbl (%ecx),%ebx
+  8009b2:	84 db                	test   %bl,%bl
+  8009b4:	75 ec                	jne    8009a2 <strlcpy+0x1c>
+  8009b6:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8009b8:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8009bb:	29 f0                	sub    %esi,%eax
+}
+  8009bd:	5b                   	pop    %ebx
+  8009be:	5e                   	pop    %esi
+  8009bf:	5d                   	pop    %ebp
+  8009c0:	c3                   	ret
+
+008009c1 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8009c1:	55                   	push   %ebp
+  8009c2:	89 e5                	mov    %esp,%ebp
+  8009c4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009c7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8009ca:	eb 06                	jmp    8009d2 <strcmp+0x11>
+		p++, q++;
+  8009cc:	83 c1 01             	add    $0x1,%ecx
+  8009cf:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8009d2:	0f b6 01             	movzbl (%ecx),%eax
+  8009d5:	84 c0                	test   %al,%al
+  8009d7:	74 04                	je     8009dd <strcmp+0x1c>
+  8009d9:	3a 02                	cmp    (%edx),%al
+  8009db:	74 ef                	je     8009cc <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009dd:	0f b6 c0             	movzbl %al,%eax
+  8009e0:	0f b6 12             	movzbl (%edx),%edx
+  8009e3:	29 d0                	sub    %edx,%eax
+}
+  8009e5:	5d                   	pop    %ebp
+  8009e6:	c3                   	ret
+
+008009e7 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8009e7:	55                   	push   %ebp
+  8009e8:	89 e5                	mov    %esp,%ebp
+  8009ea:	53                   	push   %ebx
+  8009eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009f1:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8009f4:	eb 09                	jmp    8009ff <strncmp+0x18>
+		n--, p++, q++;
+  8009f6:	83 ea 01             	sub    $0x1,%edx
+  8009f9:	83 c0 01             	add    $0x1,%eax
+  8009fc:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8009ff:	85 d2                	test   %edx,%edx
+  800a01:	74 18                	je     800a1b <strncmp+0x34>
+  800a03:	0f b6 18             	movzbl (%eax),%ebx
+  800a06:	84 db                	test   %bl,%bl
+  800a08:	74 04                	je     800a0e <strncmp+0x27>
+  800a0a:	3a 19                	cmp    (%ecx),%bl
+  800a0c:	74 e8                	je     8009f6 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a0e:	0f b6 00             	movzbl (%eax),%eax
+  800a11:	0f b6 11             	movzbl (%ecx),%edx
+  800a14:	29 d0                	sub    %edx,%eax
+}
+  800a16:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a19:	c9                   	leave
+  800a1a:	c3                   	ret
+		return 0;
+  800a1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a20:	eb f4                	jmp    800a16 <strncmp+0x2f>
+
+00800a22 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a22:	55                   	push   %ebp
+  800a23:	89 e5                	mov    %esp,%ebp
+  800a25:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a28:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a2c:	eb 03                	jmp    800a31 <strchr+0xf>
+  800a2e:	83 c0 01             	add    $0x1,%eax
+  800a31:	0f b6 10             	movzbl (%eax),%edx
+  800a34:	84 d2                	test   %dl,%dl
+  800a36:	74 06                	je     800a3e <strchr+0x1c>
+		if (*s == c)
+  800a38:	38 ca                	cmp    %cl,%dl
+  800a3a:	75 f2                	jne    800a2e <strchr+0xc>
+  800a3c:	eb 05                	jmp    800a43 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800a3e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a43:	5d                   	pop    %ebp
+  800a44:	c3                   	ret
+
+00800a45 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a45:	55                   	push   %ebp
+  800a46:	89 e5                	mov    %esp,%ebp
+  800a48:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a4b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a4f:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a52:	38 ca                	cmp    %cl,%dl
+  800a54:	74 09                	je     800a5f <strfind+0x1a>
+  800a56:	84 d2                	test   %dl,%dl
+  800a58:	74 05                	je     800a5f <strfind+0x1a>
+	for (; *s; s++)
+  800a5a:	83 c0 01             	add    $0x1,%eax
+  800a5d:	eb f0                	jmp    800a4f <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a5f:	5d                   	pop    %ebp
+  800a60:	c3                   	ret
+
+00800a61 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a61:	55                   	push   %ebp
+  800a62:	89 e5                	mov    %esp,%ebp
+  800a64:	57                   	push   %edi
+  800a65:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a68:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a6b:	85 c9                	test   %ecx,%ecx
+  800a6d:	74 20                	je     800a8f <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a6f:	89 f8                	mov    %edi,%eax
+  800a71:	09 c8                	or     %ecx,%eax
+  800a73:	a8 03                	test   $0x3,%al
+  800a75:	75 12                	jne    800a89 <memset+0x28>
+		c &= 0xFF;
+  800a77:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a7b:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a81:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a84:	fc                   	cld
+  800a85:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a87:	eb 06                	jmp    800a8f <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a89:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a8c:	fc                   	cld
+  800a8d:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a8f:	89 f8                	mov    %edi,%eax
+  800a91:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a94:	c9                   	leave
+  800a95:	c3                   	ret
+
+00800a96 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a96:	55                   	push   %ebp
+  800a97:	89 e5                	mov    %esp,%ebp
+  800a99:	57                   	push   %edi
+  800a9a:	56                   	push   %esi
+  800a9b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a9e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800aa1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800aa4:	39 c6                	cmp    %eax,%esi
+  800aa6:	73 32                	jae    800ada <memmove+0x44>
+  800aa8:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800aab:	39 d0                	cmp    %edx,%eax
+  800aad:	73 2b                	jae    800ada <memmove+0x44>
+		s += n;
+		d += n;
+  800aaf:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ab2:	89 d6                	mov    %edx,%esi
+  800ab4:	09 fe                	or     %edi,%esi
+  800ab6:	09 ce                	or     %ecx,%esi
+  800ab8:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800abe:	75 0e                	jne    800ace <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800ac0:	83 ef 04             	sub    $0x4,%edi
+  800ac3:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800ac6:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800ac9:	fd                   	std
+  800aca:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800acc:	eb 09                	jmp    800ad7 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800ace:	83 ef 01             	sub    $0x1,%edi
+  800ad1:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800ad4:	fd                   	std
+  800ad5:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800ad7:	fc                   	cld
+  800ad8:	eb 1a                	jmp    800af4 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ada:	89 f2                	mov    %esi,%edx
+  800adc:	09 c2                	or     %eax,%edx
+  800ade:	09 ca                	or     %ecx,%edx
+  800ae0:	f6 c2 03             	test   $0x3,%dl
+  800ae3:	75 0a                	jne    800aef <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800ae5:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800ae8:	89 c7                	mov    %eax,%edi
+  800aea:	fc                   	cld
+  800aeb:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800aed:	eb 05                	jmp    800af4 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800aef:	89 c7                	mov    %eax,%edi
+  800af1:	fc                   	cld
+  800af2:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800af4:	5e                   	pop    %esi
+  800af5:	5f                   	pop    %edi
+  800af6:	5d                   	pop    %ebp
+  800af7:	c3                   	ret
+
+00800af8 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800af8:	55                   	push   %ebp
+  800af9:	89 e5                	mov    %esp,%ebp
+  800afb:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800afe:	ff 75 10             	push   0x10(%ebp)
+  800b01:	ff 75 0c             	push   0xc(%ebp)
+  800b04:	ff 75 08             	push   0x8(%ebp)
+  800b07:	e8 8a ff ff ff       	call   800a96 <memmove>
+}
+  800b0c:	c9                   	leave
+  800b0d:	c3                   	ret
+
+00800b0e <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800b0e:	55                   	push   %ebp
+  800b0f:	89 e5                	mov    %esp,%ebp
+  800b11:	56                   	push   %esi
+  800b12:	53                   	push   %ebx
+  800b13:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b16:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800b19:	89 c6                	mov    %eax,%esi
+  800b1b:	03 75 10             	add    0x10(%ebp),%esi
+  800b1e:	eb 06                	jmp    800b26 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b20:	83 c0 01             	add    $0x1,%eax
+  800b23:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b26:	39 f0                	cmp    %esi,%eax
+  800b28:	74 14                	je     800b3e <memcmp+0x30>
+		if (*s1 != *s2)
+  800b2a:	0f b6 08             	movzbl (%eax),%ecx
+  800b2d:	0f b6 1a             	movzbl (%edx),%ebx
+  800b30:	38 d9                	cmp    %bl,%cl
+  800b32:	74 ec                	je     800b20 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800b34:	0f b6 c1             	movzbl %cl,%eax
+  800b37:	0f b6 db             	movzbl %bl,%ebx
+  800b3a:	29 d8                	sub    %ebx,%eax
+  800b3c:	eb 05                	jmp    800b43 <memcmp+0x35>
+	}
+
+	return 0;
+  800b3e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b43:	5b                   	pop    %ebx
+  800b44:	5e                   	pop    %esi
+  800b45:	5d                   	pop    %ebp
+  800b46:	c3                   	ret
+
+00800b47 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b47:	55                   	push   %ebp
+  800b48:	89 e5                	mov    %esp,%ebp
+  800b4a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b4d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b50:	89 c2                	mov    %eax,%edx
+  800b52:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b55:	eb 03                	jmp    800b5a <memfind+0x13>
+  800b57:	83 c0 01             	add    $0x1,%eax
+  800b5a:	39 d0                	cmp    %edx,%eax
+  800b5c:	73 04                	jae    800b62 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b5e:	38 08                	cmp    %cl,(%eax)
+  800b60:	75 f5                	jne    800b57 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b62:	5d                   	pop    %ebp
+  800b63:	c3                   	ret
+
+00800b64 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b64:	55                   	push   %ebp
+  800b65:	89 e5                	mov    %esp,%ebp
+  800b67:	57                   	push   %edi
+  800b68:	56                   	push   %esi
+  800b69:	53                   	push   %ebx
+  800b6a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b6d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b70:	eb 03                	jmp    800b75 <strtol+0x11>
+		s++;
+  800b72:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800b75:	0f b6 02             	movzbl (%edx),%eax
+  800b78:	3c 20                	cmp    $0x20,%al
+  800b7a:	74 f6                	je     800b72 <strtol+0xe>
+  800b7c:	3c 09                	cmp    $0x9,%al
+  800b7e:	74 f2                	je     800b72 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b80:	3c 2b                	cmp    $0x2b,%al
+  800b82:	74 2a                	je     800bae <strtol+0x4a>
+	int neg = 0;
+  800b84:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 2b                	je     800bb8 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b8d:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b93:	75 0f                	jne    800ba4 <strtol+0x40>
+  800b95:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b98:	74 28                	je     800bc2 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b9a:	85 db                	test   %ebx,%ebx
+  800b9c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ba1:	0f 44 d8             	cmove  %eax,%ebx
+  800ba4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ba9:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800bac:	eb 46                	jmp    800bf4 <strtol+0x90>
+		s++;
+  800bae:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800bb1:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bb6:	eb d5                	jmp    800b8d <strtol+0x29>
+		s++, neg = 1;
+  800bb8:	83 c2 01             	add    $0x1,%edx
+  800bbb:	bf 01 00 00 00       	mov    $0x1,%edi
+  800bc0:	eb cb                	jmp    800b8d <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bc2:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800bc6:	74 0e                	je     800bd6 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800bc8:	85 db                	test   %ebx,%ebx
+  800bca:	75 d8                	jne    800ba4 <strtol+0x40>
+		s++, base = 8;
+  800bcc:	83 c2 01             	add    $0x1,%edx
+  800bcf:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800bd4:	eb ce                	jmp    800ba4 <strtol+0x40>
+		s += 2, base = 16;
+  800bd6:	83 c2 02             	add    $0x2,%edx
+  800bd9:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800bde:	eb c4                	jmp    800ba4 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800be0:	0f be c0             	movsbl %al,%eax
+  800be3:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800be6:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800be9:	7d 3a                	jge    800c25 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800beb:	83 c2 01             	add    $0x1,%edx
+  800bee:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800bf2:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800bf4:	0f b6 02             	movzbl (%edx),%eax
+  800bf7:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800bfa:	89 f3                	mov    %esi,%ebx
+  800bfc:	80 fb 09             	cmp    $0x9,%bl
+  800bff:	76 df                	jbe    800be0 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800c01:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c04:	89 f3                	mov    %esi,%ebx
+  800c06:	80 fb 19             	cmp    $0x19,%bl
+  800c09:	77 08                	ja     800c13 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800c0b:	0f be c0             	movsbl %al,%eax
+  800c0e:	83 e8 57             	sub    $0x57,%eax
+  800c11:	eb d3                	jmp    800be6 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c13:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c16:	89 f3                	mov    %esi,%ebx
+  800c18:	80 fb 19             	cmp    $0x19,%bl
+  800c1b:	77 08                	ja     800c25 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800c1d:	0f be c0             	movsbl %al,%eax
+  800c20:	83 e8 37             	sub    $0x37,%eax
+  800c23:	eb c1                	jmp    800be6 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c25:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c29:	74 05                	je     800c30 <strtol+0xcc>
+		*endptr = (char *) s;
+  800c2b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c2e:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800c30:	89 c8                	mov    %ecx,%eax
+  800c32:	f7 d8                	neg    %eax
+  800c34:	85 ff                	test   %edi,%edi
+  800c36:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800c39:	89 c8                	mov    %ecx,%eax
+  800c3b:	5b                   	pop    %ebx
+  800c3c:	5e                   	pop    %esi
+  800c3d:	5f                   	pop    %edi
+  800c3e:	5d                   	pop    %ebp
+  800c3f:	c3                   	ret
+
+00800c40 <atoi>:
+
+int
+atoi(const char* s)
+{
+  800c40:	55                   	push   %ebp
+  800c41:	89 e5                	mov    %esp,%ebp
+  800c43:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  800c46:	6a 00                	push   $0x0
+  800c48:	6a 00                	push   $0x0
+  800c4a:	ff 75 08             	push   0x8(%ebp)
+  800c4d:	e8 12 ff ff ff       	call   800b64 <strtol>
+}
+  800c52:	c9                   	leave
+  800c53:	c3                   	ret
+
+00800c54 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c54:	55                   	push   %ebp
+  800c55:	89 e5                	mov    %esp,%ebp
+  800c57:	57                   	push   %edi
+  800c58:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c59:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c5e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c61:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c64:	89 c3                	mov    %eax,%ebx
+  800c66:	89 c7                	mov    %eax,%edi
+  800c68:	6a 00                	push   $0x0
+  800c6a:	55                   	push   %ebp
+  800c6b:	56                   	push   %esi
+  800c6c:	89 e5                	mov    %esp,%ebp
+  800c6e:	8d 35 76 0c 80 00    	lea    0x800c76,%esi
+  800c74:	0f 34                	sysenter
+
+00800c76 <after_sysenter_label_47>:
+  800c76:	5e                   	pop    %esi
+  800c77:	5d                   	pop    %ebp
+  800c78:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c7b:	5b                   	pop    %ebx
+  800c7c:	5f                   	pop    %edi
+  800c7d:	5d                   	pop    %ebp
+  800c7e:	c3                   	ret
+
+00800c7f <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c7f:	55                   	push   %ebp
+  800c80:	89 e5                	mov    %esp,%ebp
+  800c82:	57                   	push   %edi
+  800c83:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c84:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c89:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c8e:	89 d1                	mov    %edx,%ecx
+  800c90:	89 d3                	mov    %edx,%ebx
+  800c92:	89 d7                	mov    %edx,%edi
+  800c94:	6a 00                	push   $0x0
+  800c96:	55                   	push   %ebp
+  800c97:	56                   	push   %esi
+  800c98:	89 e5                	mov    %esp,%ebp
+  800c9a:	8d 35 a2 0c 80 00    	lea    0x800ca2,%esi
+  800ca0:	0f 34                	sysenter
+
+00800ca2 <after_sysenter_label_128>:
+  800ca2:	5e                   	pop    %esi
+  800ca3:	5d                   	pop    %ebp
+  800ca4:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800ca7:	5b                   	pop    %ebx
+  800ca8:	5f                   	pop    %edi
+  800ca9:	5d                   	pop    %ebp
+  800caa:	c3                   	ret
+
+00800cab <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800cab:	55                   	push   %ebp
+  800cac:	89 e5                	mov    %esp,%ebp
+  800cae:	57                   	push   %edi
+  800caf:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800cb0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cb3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cb8:	b8 03 00 00 00       	mov    $0x3,%eax
+  800cbd:	89 cb                	mov    %ecx,%ebx
+  800cbf:	89 cf                	mov    %ecx,%edi
+  800cc1:	6a 00                	push   $0x0
+  800cc3:	55                   	push   %ebp
+  800cc4:	56                   	push   %esi
+  800cc5:	89 e5                	mov    %esp,%ebp
+  800cc7:	8d 35 cf 0c 80 00    	lea    0x800ccf,%esi
+  800ccd:	0f 34                	sysenter
+
+00800ccf <after_sysenter_label_212>:
+  800ccf:	5e                   	pop    %esi
+  800cd0:	5d                   	pop    %ebp
+  800cd1:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800cd4:	85 c0                	test   %eax,%eax
+  800cd6:	7f 07                	jg     800cdf <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800cd8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800cdb:	5b                   	pop    %ebx
+  800cdc:	5f                   	pop    %edi
+  800cdd:	5d                   	pop    %ebp
+  800cde:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cdf:	83 ec 0c             	sub    $0xc,%esp
+  800ce2:	50                   	push   %eax
+  800ce3:	6a 03                	push   $0x3
+  800ce5:	68 95 4c 80 00       	push   $0x804c95
+  800cea:	6a 54                	push   $0x54
+  800cec:	68 b2 4c 80 00       	push   $0x804cb2
+  800cf1:	e8 5b f5 ff ff       	call   800251 <_panic>
+
+00800cf6 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800cf6:	55                   	push   %ebp
+  800cf7:	89 e5                	mov    %esp,%ebp
+  800cf9:	57                   	push   %edi
+  800cfa:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800cfb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d00:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d05:	89 d1                	mov    %edx,%ecx
+  800d07:	89 d3                	mov    %edx,%ebx
+  800d09:	89 d7                	mov    %edx,%edi
+  800d0b:	6a 00                	push   $0x0
+  800d0d:	55                   	push   %ebp
+  800d0e:	56                   	push   %esi
+  800d0f:	89 e5                	mov    %esp,%ebp
+  800d11:	8d 35 19 0d 80 00    	lea    0x800d19,%esi
+  800d17:	0f 34                	sysenter
+
+00800d19 <after_sysenter_label_309>:
+  800d19:	5e                   	pop    %esi
+  800d1a:	5d                   	pop    %ebp
+  800d1b:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800d1e:	5b                   	pop    %ebx
+  800d1f:	5f                   	pop    %edi
+  800d20:	5d                   	pop    %ebp
+  800d21:	c3                   	ret
+
+00800d22 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800d22:	55                   	push   %ebp
+  800d23:	89 e5                	mov    %esp,%ebp
+  800d25:	57                   	push   %edi
+  800d26:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d27:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d2c:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d31:	89 d1                	mov    %edx,%ecx
+  800d33:	89 d3                	mov    %edx,%ebx
+  800d35:	89 d7                	mov    %edx,%edi
+  800d37:	6a 00                	push   $0x0
+  800d39:	55                   	push   %ebp
+  800d3a:	56                   	push   %esi
+  800d3b:	89 e5                	mov    %esp,%ebp
+  800d3d:	8d 35 45 0d 80 00    	lea    0x800d45,%esi
+  800d43:	0f 34                	sysenter
+
+00800d45 <after_sysenter_label_391>:
+  800d45:	5e                   	pop    %esi
+  800d46:	5d                   	pop    %ebp
+  800d47:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d4a:	5b                   	pop    %ebx
+  800d4b:	5f                   	pop    %edi
+  800d4c:	5d                   	pop    %ebp
+  800d4d:	c3                   	ret
+
+00800d4e <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d4e:	55                   	push   %ebp
+  800d4f:	89 e5                	mov    %esp,%ebp
+  800d51:	57                   	push   %edi
+  800d52:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d53:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d56:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d59:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d5e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d63:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d66:	6a 00                	push   $0x0
+  800d68:	55                   	push   %ebp
+  800d69:	56                   	push   %esi
+  800d6a:	89 e5                	mov    %esp,%ebp
+  800d6c:	8d 35 74 0d 80 00    	lea    0x800d74,%esi
+  800d72:	0f 34                	sysenter
+
+00800d74 <after_sysenter_label_479>:
+  800d74:	5e                   	pop    %esi
+  800d75:	5d                   	pop    %ebp
+  800d76:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d79:	85 c0                	test   %eax,%eax
+  800d7b:	7f 07                	jg     800d84 <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d7d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d80:	5b                   	pop    %ebx
+  800d81:	5f                   	pop    %edi
+  800d82:	5d                   	pop    %ebp
+  800d83:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d84:	83 ec 0c             	sub    $0xc,%esp
+  800d87:	50                   	push   %eax
+  800d88:	6a 04                	push   $0x4
+  800d8a:	68 95 4c 80 00       	push   $0x804c95
+  800d8f:	6a 54                	push   $0x54
+  800d91:	68 b2 4c 80 00       	push   $0x804cb2
+  800d96:	e8 b6 f4 ff ff       	call   800251 <_panic>
+
+00800d9b <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d9b:	55                   	push   %ebp
+  800d9c:	89 e5                	mov    %esp,%ebp
+  800d9e:	57                   	push   %edi
+  800d9f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800da0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800da3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800da6:	b8 05 00 00 00       	mov    $0x5,%eax
+  800dab:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dae:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800db1:	ff 75 18             	push   0x18(%ebp)
+  800db4:	55                   	push   %ebp
+  800db5:	56                   	push   %esi
+  800db6:	89 e5                	mov    %esp,%ebp
+  800db8:	8d 35 c0 0d 80 00    	lea    0x800dc0,%esi
+  800dbe:	0f 34                	sysenter
+
+00800dc0 <after_sysenter_label_593>:
+  800dc0:	5e                   	pop    %esi
+  800dc1:	5d                   	pop    %ebp
+  800dc2:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800dc5:	85 c0                	test   %eax,%eax
+  800dc7:	7f 07                	jg     800dd0 <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800dc9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800dcc:	5b                   	pop    %ebx
+  800dcd:	5f                   	pop    %edi
+  800dce:	5d                   	pop    %ebp
+  800dcf:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dd0:	83 ec 0c             	sub    $0xc,%esp
+  800dd3:	50                   	push   %eax
+  800dd4:	6a 05                	push   $0x5
+  800dd6:	68 95 4c 80 00       	push   $0x804c95
+  800ddb:	6a 54                	push   $0x54
+  800ddd:	68 b2 4c 80 00       	push   $0x804cb2
+  800de2:	e8 6a f4 ff ff       	call   800251 <_panic>
+
+00800de7 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800de7:	55                   	push   %ebp
+  800de8:	89 e5                	mov    %esp,%ebp
+  800dea:	57                   	push   %edi
+  800deb:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800dec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800df1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800df7:	b8 06 00 00 00       	mov    $0x6,%eax
+  800dfc:	89 df                	mov    %ebx,%edi
+  800dfe:	6a 00                	push   $0x0
+  800e00:	55                   	push   %ebp
+  800e01:	56                   	push   %esi
+  800e02:	89 e5                	mov    %esp,%ebp
+  800e04:	8d 35 0c 0e 80 00    	lea    0x800e0c,%esi
+  800e0a:	0f 34                	sysenter
+
+00800e0c <after_sysenter_label_704>:
+  800e0c:	5e                   	pop    %esi
+  800e0d:	5d                   	pop    %ebp
+  800e0e:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e11:	85 c0                	test   %eax,%eax
+  800e13:	7f 07                	jg     800e1c <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e15:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e18:	5b                   	pop    %ebx
+  800e19:	5f                   	pop    %edi
+  800e1a:	5d                   	pop    %ebp
+  800e1b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e1c:	83 ec 0c             	sub    $0xc,%esp
+  800e1f:	50                   	push   %eax
+  800e20:	6a 06                	push   $0x6
+  800e22:	68 95 4c 80 00       	push   $0x804c95
+  800e27:	6a 54                	push   $0x54
+  800e29:	68 b2 4c 80 00       	push   $0x804cb2
+  800e2e:	e8 1e f4 ff ff       	call   800251 <_panic>
+
+00800e33 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e33:	55                   	push   %ebp
+  800e34:	89 e5                	mov    %esp,%ebp
+  800e36:	57                   	push   %edi
+  800e37:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e38:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e3d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e40:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e43:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e48:	89 df                	mov    %ebx,%edi
+  800e4a:	6a 00                	push   $0x0
+  800e4c:	55                   	push   %ebp
+  800e4d:	56                   	push   %esi
+  800e4e:	89 e5                	mov    %esp,%ebp
+  800e50:	8d 35 58 0e 80 00    	lea    0x800e58,%esi
+  800e56:	0f 34                	sysenter
+
+00800e58 <after_sysenter_label_808>:
+  800e58:	5e                   	pop    %esi
+  800e59:	5d                   	pop    %ebp
+  800e5a:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e5d:	85 c0                	test   %eax,%eax
+  800e5f:	7f 07                	jg     800e68 <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800e61:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e64:	5b                   	pop    %ebx
+  800e65:	5f                   	pop    %edi
+  800e66:	5d                   	pop    %ebp
+  800e67:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e68:	83 ec 0c             	sub    $0xc,%esp
+  800e6b:	50                   	push   %eax
+  800e6c:	6a 08                	push   $0x8
+  800e6e:	68 95 4c 80 00       	push   $0x804c95
+  800e73:	6a 54                	push   $0x54
+  800e75:	68 b2 4c 80 00       	push   $0x804cb2
+  800e7a:	e8 d2 f3 ff ff       	call   800251 <_panic>
+
+00800e7f <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800e7f:	55                   	push   %ebp
+  800e80:	89 e5                	mov    %esp,%ebp
+  800e82:	57                   	push   %edi
+  800e83:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e84:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e89:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e8c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e8f:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e94:	89 df                	mov    %ebx,%edi
+  800e96:	6a 00                	push   $0x0
+  800e98:	55                   	push   %ebp
+  800e99:	56                   	push   %esi
+  800e9a:	89 e5                	mov    %esp,%ebp
+  800e9c:	8d 35 a4 0e 80 00    	lea    0x800ea4,%esi
+  800ea2:	0f 34                	sysenter
+
+00800ea4 <after_sysenter_label_912>:
+  800ea4:	5e                   	pop    %esi
+  800ea5:	5d                   	pop    %ebp
+  800ea6:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800ea9:	85 c0                	test   %eax,%eax
+  800eab:	7f 07                	jg     800eb4 <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800ead:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800eb0:	5b                   	pop    %ebx
+  800eb1:	5f                   	pop    %edi
+  800eb2:	5d                   	pop    %ebp
+  800eb3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eb4:	83 ec 0c             	sub    $0xc,%esp
+  800eb7:	50                   	push   %eax
+  800eb8:	6a 09                	push   $0x9
+  800eba:	68 95 4c 80 00       	push   $0x804c95
+  800ebf:	6a 54                	push   $0x54
+  800ec1:	68 b2 4c 80 00       	push   $0x804cb2
+  800ec6:	e8 86 f3 ff ff       	call   800251 <_panic>
+
+00800ecb <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800ecb:	55                   	push   %ebp
+  800ecc:	89 e5                	mov    %esp,%ebp
+  800ece:	57                   	push   %edi
+  800ecf:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ed0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ed5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800edb:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ee0:	89 df                	mov    %ebx,%edi
+  800ee2:	6a 00                	push   $0x0
+  800ee4:	55                   	push   %ebp
+  800ee5:	56                   	push   %esi
+  800ee6:	89 e5                	mov    %esp,%ebp
+  800ee8:	8d 35 f0 0e 80 00    	lea    0x800ef0,%esi
+  800eee:	0f 34                	sysenter
+
+00800ef0 <after_sysenter_label_1016>:
+  800ef0:	5e                   	pop    %esi
+  800ef1:	5d                   	pop    %ebp
+  800ef2:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800ef5:	85 c0                	test   %eax,%eax
+  800ef7:	7f 07                	jg     800f00 <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800ef9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800efc:	5b                   	pop    %ebx
+  800efd:	5f                   	pop    %edi
+  800efe:	5d                   	pop    %ebp
+  800eff:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f00:	83 ec 0c             	sub    $0xc,%esp
+  800f03:	50                   	push   %eax
+  800f04:	6a 0a                	push   $0xa
+  800f06:	68 95 4c 80 00       	push   $0x804c95
+  800f0b:	6a 54                	push   $0x54
+  800f0d:	68 b2 4c 80 00       	push   $0x804cb2
+  800f12:	e8 3a f3 ff ff       	call   800251 <_panic>
+
+00800f17 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800f17:	55                   	push   %ebp
+  800f18:	89 e5                	mov    %esp,%ebp
+  800f1a:	57                   	push   %edi
+  800f1b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f1c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f1f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f22:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f27:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f2a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f2d:	6a 00                	push   $0x0
+  800f2f:	55                   	push   %ebp
+  800f30:	56                   	push   %esi
+  800f31:	89 e5                	mov    %esp,%ebp
+  800f33:	8d 35 3b 0f 80 00    	lea    0x800f3b,%esi
+  800f39:	0f 34                	sysenter
+
+00800f3b <after_sysenter_label_1126>:
+  800f3b:	5e                   	pop    %esi
+  800f3c:	5d                   	pop    %ebp
+  800f3d:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800f40:	5b                   	pop    %ebx
+  800f41:	5f                   	pop    %edi
+  800f42:	5d                   	pop    %ebp
+  800f43:	c3                   	ret
+
+00800f44 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800f44:	55                   	push   %ebp
+  800f45:	89 e5                	mov    %esp,%ebp
+  800f47:	57                   	push   %edi
+  800f48:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f49:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f4c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f51:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f56:	89 cb                	mov    %ecx,%ebx
+  800f58:	89 cf                	mov    %ecx,%edi
+  800f5a:	6a 00                	push   $0x0
+  800f5c:	55                   	push   %ebp
+  800f5d:	56                   	push   %esi
+  800f5e:	89 e5                	mov    %esp,%ebp
+  800f60:	8d 35 68 0f 80 00    	lea    0x800f68,%esi
+  800f66:	0f 34                	sysenter
+
+00800f68 <after_sysenter_label_1210>:
+  800f68:	5e                   	pop    %esi
+  800f69:	5d                   	pop    %ebp
+  800f6a:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800f6d:	85 c0                	test   %eax,%eax
+  800f6f:	7f 07                	jg     800f78 <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800f71:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f74:	5b                   	pop    %ebx
+  800f75:	5f                   	pop    %edi
+  800f76:	5d                   	pop    %ebp
+  800f77:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f78:	83 ec 0c             	sub    $0xc,%esp
+  800f7b:	50                   	push   %eax
+  800f7c:	6a 0d                	push   $0xd
+  800f7e:	68 95 4c 80 00       	push   $0x804c95
+  800f83:	6a 54                	push   $0x54
+  800f85:	68 b2 4c 80 00       	push   $0x804cb2
+  800f8a:	e8 c2 f2 ff ff       	call   800251 <_panic>
+
+00800f8f <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  800f8f:	55                   	push   %ebp
+  800f90:	89 e5                	mov    %esp,%ebp
+  800f92:	57                   	push   %edi
+  800f93:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f94:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f99:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f9c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f9f:	b8 42 00 00 00       	mov    $0x42,%eax
+  800fa4:	89 df                	mov    %ebx,%edi
+  800fa6:	6a 00                	push   $0x0
+  800fa8:	55                   	push   %ebp
+  800fa9:	56                   	push   %esi
+  800faa:	89 e5                	mov    %esp,%ebp
+  800fac:	8d 35 b4 0f 80 00    	lea    0x800fb4,%esi
+  800fb2:	0f 34                	sysenter
+
+00800fb4 <after_sysenter_label_1311>:
+  800fb4:	5e                   	pop    %esi
+  800fb5:	5d                   	pop    %ebp
+  800fb6:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800fb9:	85 c0                	test   %eax,%eax
+  800fbb:	7f 07                	jg     800fc4 <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  800fbd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fc0:	5b                   	pop    %ebx
+  800fc1:	5f                   	pop    %edi
+  800fc2:	5d                   	pop    %ebp
+  800fc3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fc4:	83 ec 0c             	sub    $0xc,%esp
+  800fc7:	50                   	push   %eax
+  800fc8:	6a 42                	push   $0x42
+  800fca:	68 95 4c 80 00       	push   $0x804c95
+  800fcf:	6a 54                	push   $0x54
+  800fd1:	68 b2 4c 80 00       	push   $0x804cb2
+  800fd6:	e8 76 f2 ff ff       	call   800251 <_panic>
+
+00800fdb <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800fdb:	55                   	push   %ebp
+  800fdc:	89 e5                	mov    %esp,%ebp
+  800fde:	57                   	push   %edi
+  800fdf:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fe0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fe5:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800fea:	89 d1                	mov    %edx,%ecx
+  800fec:	89 d3                	mov    %edx,%ebx
+  800fee:	89 d7                	mov    %edx,%edi
+  800ff0:	6a 00                	push   $0x0
+  800ff2:	55                   	push   %ebp
+  800ff3:	56                   	push   %esi
+  800ff4:	89 e5                	mov    %esp,%ebp
+  800ff6:	8d 35 fe 0f 80 00    	lea    0x800ffe,%esi
+  800ffc:	0f 34                	sysenter
+
+00800ffe <after_sysenter_label_1411>:
+  800ffe:	5e                   	pop    %esi
+  800fff:	5d                   	pop    %ebp
+  801000:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801003:	5b                   	pop    %ebx
+  801004:	5f                   	pop    %edi
+  801005:	5d                   	pop    %ebp
+  801006:	c3                   	ret
+
+00801007 <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  801007:	55                   	push   %ebp
+  801008:	89 e5                	mov    %esp,%ebp
+  80100a:	57                   	push   %edi
+  80100b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80100c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801011:	8b 55 08             	mov    0x8(%ebp),%edx
+  801014:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801017:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80101c:	89 df                	mov    %ebx,%edi
+  80101e:	6a 00                	push   $0x0
+  801020:	55                   	push   %ebp
+  801021:	56                   	push   %esi
+  801022:	89 e5                	mov    %esp,%ebp
+  801024:	8d 35 2c 10 80 00    	lea    0x80102c,%esi
+  80102a:	0f 34                	sysenter
+
+0080102c <after_sysenter_label_1497>:
+  80102c:	5e                   	pop    %esi
+  80102d:	5d                   	pop    %ebp
+  80102e:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  801031:	5b                   	pop    %ebx
+  801032:	5f                   	pop    %edi
+  801033:	5d                   	pop    %ebp
+  801034:	c3                   	ret
+
+00801035 <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  801035:	55                   	push   %ebp
+  801036:	89 e5                	mov    %esp,%ebp
+  801038:	57                   	push   %edi
+  801039:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80103a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80103f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801042:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801045:	b8 10 00 00 00       	mov    $0x10,%eax
+  80104a:	89 df                	mov    %ebx,%edi
+  80104c:	6a 00                	push   $0x0
+  80104e:	55                   	push   %ebp
+  80104f:	56                   	push   %esi
+  801050:	89 e5                	mov    %esp,%ebp
+  801052:	8d 35 5a 10 80 00    	lea    0x80105a,%esi
+  801058:	0f 34                	sysenter
+
+0080105a <after_sysenter_label_1583>:
+  80105a:	5e                   	pop    %esi
+  80105b:	5d                   	pop    %ebp
+  80105c:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  80105f:	5b                   	pop    %ebx
+  801060:	5f                   	pop    %edi
+  801061:	5d                   	pop    %ebp
+  801062:	c3                   	ret
+
+00801063 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  801063:	55                   	push   %ebp
+  801064:	89 e5                	mov    %esp,%ebp
+  801066:	57                   	push   %edi
+  801067:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801068:	8b 55 08             	mov    0x8(%ebp),%edx
+  80106b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80106e:	b8 11 00 00 00       	mov    $0x11,%eax
+  801073:	bf 00 00 00 00       	mov    $0x0,%edi
+  801078:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80107b:	6a 00                	push   $0x0
+  80107d:	55                   	push   %ebp
+  80107e:	56                   	push   %esi
+  80107f:	89 e5                	mov    %esp,%ebp
+  801081:	8d 35 89 10 80 00    	lea    0x801089,%esi
+  801087:	0f 34                	sysenter
+
+00801089 <after_sysenter_label_1672>:
+  801089:	5e                   	pop    %esi
+  80108a:	5d                   	pop    %ebp
+  80108b:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  80108e:	5b                   	pop    %ebx
+  80108f:	5f                   	pop    %edi
+  801090:	5d                   	pop    %ebp
+  801091:	c3                   	ret
+
+00801092 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  801092:	55                   	push   %ebp
+  801093:	89 e5                	mov    %esp,%ebp
+  801095:	57                   	push   %edi
+  801096:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801097:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80109c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80109f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a2:	b8 12 00 00 00       	mov    $0x12,%eax
+  8010a7:	89 df                	mov    %ebx,%edi
+  8010a9:	6a 00                	push   $0x0
+  8010ab:	55                   	push   %ebp
+  8010ac:	56                   	push   %esi
+  8010ad:	89 e5                	mov    %esp,%ebp
+  8010af:	8d 35 b7 10 80 00    	lea    0x8010b7,%esi
+  8010b5:	0f 34                	sysenter
+
+008010b7 <after_sysenter_label_1758>:
+  8010b7:	5e                   	pop    %esi
+  8010b8:	5d                   	pop    %ebp
+  8010b9:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  8010bc:	5b                   	pop    %ebx
+  8010bd:	5f                   	pop    %edi
+  8010be:	5d                   	pop    %ebp
+  8010bf:	c3                   	ret
+
+008010c0 <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  8010c0:	55                   	push   %ebp
+  8010c1:	89 e5                	mov    %esp,%ebp
+  8010c3:	57                   	push   %edi
+  8010c4:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010cd:	b8 13 00 00 00       	mov    $0x13,%eax
+  8010d2:	89 cb                	mov    %ecx,%ebx
+  8010d4:	89 cf                	mov    %ecx,%edi
+  8010d6:	6a 00                	push   $0x0
+  8010d8:	55                   	push   %ebp
+  8010d9:	56                   	push   %esi
+  8010da:	89 e5                	mov    %esp,%ebp
+  8010dc:	8d 35 e4 10 80 00    	lea    0x8010e4,%esi
+  8010e2:	0f 34                	sysenter
+
+008010e4 <after_sysenter_label_1842>:
+  8010e4:	5e                   	pop    %esi
+  8010e5:	5d                   	pop    %ebp
+  8010e6:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8010e9:	85 c0                	test   %eax,%eax
+  8010eb:	7f 07                	jg     8010f4 <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  8010ed:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8010f0:	5b                   	pop    %ebx
+  8010f1:	5f                   	pop    %edi
+  8010f2:	5d                   	pop    %ebp
+  8010f3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010f4:	83 ec 0c             	sub    $0xc,%esp
+  8010f7:	50                   	push   %eax
+  8010f8:	6a 13                	push   $0x13
+  8010fa:	68 95 4c 80 00       	push   $0x804c95
+  8010ff:	6a 54                	push   $0x54
+  801101:	68 b2 4c 80 00       	push   $0x804cb2
+  801106:	e8 46 f1 ff ff       	call   800251 <_panic>
+
+0080110b <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  80110b:	55                   	push   %ebp
+  80110c:	89 e5                	mov    %esp,%ebp
+  80110e:	57                   	push   %edi
+  80110f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801110:	ba 00 00 00 00       	mov    $0x0,%edx
+  801115:	b8 14 00 00 00       	mov    $0x14,%eax
+  80111a:	89 d1                	mov    %edx,%ecx
+  80111c:	89 d3                	mov    %edx,%ebx
+  80111e:	89 d7                	mov    %edx,%edi
+  801120:	6a 00                	push   $0x0
+  801122:	55                   	push   %ebp
+  801123:	56                   	push   %esi
+  801124:	89 e5                	mov    %esp,%ebp
+  801126:	8d 35 2e 11 80 00    	lea    0x80112e,%esi
+  80112c:	0f 34                	sysenter
+
+0080112e <after_sysenter_label_1939>:
+  80112e:	5e                   	pop    %esi
+  80112f:	5d                   	pop    %ebp
+  801130:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  801133:	5b                   	pop    %ebx
+  801134:	5f                   	pop    %edi
+  801135:	5d                   	pop    %ebp
+  801136:	c3                   	ret
+
+00801137 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  801137:	55                   	push   %ebp
+  801138:	89 e5                	mov    %esp,%ebp
+  80113a:	57                   	push   %edi
+  80113b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80113c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80113f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801142:	b8 15 00 00 00       	mov    $0x15,%eax
+  801147:	bf 00 00 00 00       	mov    $0x0,%edi
+  80114c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80114f:	6a 00                	push   $0x0
+  801151:	55                   	push   %ebp
+  801152:	56                   	push   %esi
+  801153:	89 e5                	mov    %esp,%ebp
+  801155:	8d 35 5d 11 80 00    	lea    0x80115d,%esi
+  80115b:	0f 34                	sysenter
+
+0080115d <after_sysenter_label_2028>:
+  80115d:	5e                   	pop    %esi
+  80115e:	5d                   	pop    %ebp
+  80115f:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  801162:	5b                   	pop    %ebx
+  801163:	5f                   	pop    %edi
+  801164:	5d                   	pop    %ebp
+  801165:	c3                   	ret
+
+00801166 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  801166:	55                   	push   %ebp
+  801167:	89 e5                	mov    %esp,%ebp
+  801169:	57                   	push   %edi
+  80116a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80116b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801170:	8b 55 08             	mov    0x8(%ebp),%edx
+  801173:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801176:	b8 16 00 00 00       	mov    $0x16,%eax
+  80117b:	89 df                	mov    %ebx,%edi
+  80117d:	6a 00                	push   $0x0
+  80117f:	55                   	push   %ebp
+  801180:	56                   	push   %esi
+  801181:	89 e5                	mov    %esp,%ebp
+  801183:	8d 35 8b 11 80 00    	lea    0x80118b,%esi
+  801189:	0f 34                	sysenter
+
+0080118b <after_sysenter_label_2114>:
+  80118b:	5e                   	pop    %esi
+  80118c:	5d                   	pop    %ebp
+  80118d:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  801190:	5b                   	pop    %ebx
+  801191:	5f                   	pop    %edi
+  801192:	5d                   	pop    %ebp
+  801193:	c3                   	ret
+
+00801194 <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  801194:	55                   	push   %ebp
+  801195:	89 e5                	mov    %esp,%ebp
+  801197:	57                   	push   %edi
+  801198:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801199:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80119e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011a4:	b8 17 00 00 00       	mov    $0x17,%eax
+  8011a9:	89 df                	mov    %ebx,%edi
+  8011ab:	6a 00                	push   $0x0
+  8011ad:	55                   	push   %ebp
+  8011ae:	56                   	push   %esi
+  8011af:	89 e5                	mov    %esp,%ebp
+  8011b1:	8d 35 b9 11 80 00    	lea    0x8011b9,%esi
+  8011b7:	0f 34                	sysenter
+
+008011b9 <after_sysenter_label_2200>:
+  8011b9:	5e                   	pop    %esi
+  8011ba:	5d                   	pop    %ebp
+  8011bb:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  8011be:	5b                   	pop    %ebx
+  8011bf:	5f                   	pop    %edi
+  8011c0:	5d                   	pop    %ebp
+  8011c1:	c3                   	ret
+
+008011c2 <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  8011c2:	55                   	push   %ebp
+  8011c3:	89 e5                	mov    %esp,%ebp
+  8011c5:	57                   	push   %edi
+  8011c6:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8011c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011cf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d2:	b8 18 00 00 00       	mov    $0x18,%eax
+  8011d7:	89 df                	mov    %ebx,%edi
+  8011d9:	6a 00                	push   $0x0
+  8011db:	55                   	push   %ebp
+  8011dc:	56                   	push   %esi
+  8011dd:	89 e5                	mov    %esp,%ebp
+  8011df:	8d 35 e7 11 80 00    	lea    0x8011e7,%esi
+  8011e5:	0f 34                	sysenter
+
+008011e7 <after_sysenter_label_2286>:
+  8011e7:	5e                   	pop    %esi
+  8011e8:	5d                   	pop    %ebp
+  8011e9:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  8011ec:	5b                   	pop    %ebx
+  8011ed:	5f                   	pop    %edi
+  8011ee:	5d                   	pop    %ebp
+  8011ef:	c3                   	ret
+
+008011f0 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8011f0:	55                   	push   %ebp
+  8011f1:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8011f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011f6:	05 00 00 00 30       	add    $0x30000000,%eax
+  8011fb:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8011fe:	5d                   	pop    %ebp
+  8011ff:	c3                   	ret
+
+00801200 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801200:	55                   	push   %ebp
+  801201:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801203:	8b 45 08             	mov    0x8(%ebp),%eax
+  801206:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80120b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801210:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801215:	5d                   	pop    %ebp
+  801216:	c3                   	ret
+
+00801217 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801217:	55                   	push   %ebp
+  801218:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80121a:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80121f:	eb 02                	jmp    801223 <fd_alloc+0xc>
+  801221:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801223:	89 c2                	mov    %eax,%edx
+  801225:	c1 ea 16             	shr    $0x16,%edx
+  801228:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80122f:	f6 c2 01             	test   $0x1,%dl
+  801232:	74 2b                	je     80125f <fd_alloc+0x48>
+  801234:	89 c2                	mov    %eax,%edx
+  801236:	c1 ea 0c             	shr    $0xc,%edx
+  801239:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801240:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801246:	f6 c1 01             	test   $0x1,%cl
+  801249:	74 14                	je     80125f <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80124b:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801251:	75 ce                	jne    801221 <fd_alloc+0xa>
+  801253:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801258:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80125d:	eb 05                	jmp    801264 <fd_alloc+0x4d>
+			return 0;
+  80125f:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801264:	8b 55 08             	mov    0x8(%ebp),%edx
+  801267:	89 02                	mov    %eax,(%edx)
+}
+  801269:	89 c8                	mov    %ecx,%eax
+  80126b:	5d                   	pop    %ebp
+  80126c:	c3                   	ret
+
+0080126d <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80126d:	55                   	push   %ebp
+  80126e:	89 e5                	mov    %esp,%ebp
+  801270:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801273:	83 f8 1f             	cmp    $0x1f,%eax
+  801276:	77 30                	ja     8012a8 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801278:	c1 e0 0c             	shl    $0xc,%eax
+  80127b:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801280:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801286:	f6 c2 01             	test   $0x1,%dl
+  801289:	74 24                	je     8012af <fd_lookup+0x42>
+  80128b:	89 c2                	mov    %eax,%edx
+  80128d:	c1 ea 0c             	shr    $0xc,%edx
+  801290:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801297:	f6 c2 01             	test   $0x1,%dl
+  80129a:	74 1a                	je     8012b6 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80129c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80129f:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8012a1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8012a6:	5d                   	pop    %ebp
+  8012a7:	c3                   	ret
+		return -E_INVAL;
+  8012a8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012ad:	eb f7                	jmp    8012a6 <fd_lookup+0x39>
+		return -E_INVAL;
+  8012af:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012b4:	eb f0                	jmp    8012a6 <fd_lookup+0x39>
+  8012b6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012bb:	eb e9                	jmp    8012a6 <fd_lookup+0x39>
+
+008012bd <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8012bd:	55                   	push   %ebp
+  8012be:	89 e5                	mov    %esp,%ebp
+  8012c0:	53                   	push   %ebx
+  8012c1:	83 ec 04             	sub    $0x4,%esp
+  8012c4:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8012c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012cc:	eb 03                	jmp    8012d1 <dev_lookup+0x14>
+  8012ce:	83 c0 01             	add    $0x1,%eax
+  8012d1:	8b 1c 85 3c 4d 80 00 	mov    0x804d3c(,%eax,4),%ebx
+  8012d8:	85 db                	test   %ebx,%ebx
+  8012da:	74 0b                	je     8012e7 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8012dc:	39 13                	cmp    %edx,(%ebx)
+  8012de:	75 ee                	jne    8012ce <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8012e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012e5:	eb 49                	jmp    801330 <dev_lookup+0x73>
+  8012e7:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8012e9:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  8012ef:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8012f4:	77 18                	ja     80130e <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8012f6:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8012fb:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  8012fd:	c1 e8 10             	shr    $0x10,%eax
+  801300:	74 0c                	je     80130e <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801302:	c1 e0 10             	shl    $0x10,%eax
+  801305:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80130a:	29 c1                	sub    %eax,%ecx
+  80130c:	eb 06                	jmp    801314 <dev_lookup+0x57>
+		return pthread_main_tls;
+  80130e:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801314:	8b 01                	mov    (%ecx),%eax
+  801316:	8b 40 48             	mov    0x48(%eax),%eax
+  801319:	83 ec 04             	sub    $0x4,%esp
+  80131c:	52                   	push   %edx
+  80131d:	50                   	push   %eax
+  80131e:	68 c0 4c 80 00       	push   $0x804cc0
+  801323:	e8 04 f0 ff ff       	call   80032c <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801328:	83 c4 10             	add    $0x10,%esp
+  80132b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801330:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801333:	89 1a                	mov    %ebx,(%edx)
+}
+  801335:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801338:	c9                   	leave
+  801339:	c3                   	ret
+
+0080133a <fd_close>:
+{
+  80133a:	55                   	push   %ebp
+  80133b:	89 e5                	mov    %esp,%ebp
+  80133d:	57                   	push   %edi
+  80133e:	56                   	push   %esi
+  80133f:	53                   	push   %ebx
+  801340:	83 ec 24             	sub    $0x24,%esp
+  801343:	8b 75 08             	mov    0x8(%ebp),%esi
+  801346:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801349:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80134c:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80134d:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801353:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801356:	50                   	push   %eax
+  801357:	e8 11 ff ff ff       	call   80126d <fd_lookup>
+  80135c:	89 c3                	mov    %eax,%ebx
+  80135e:	83 c4 10             	add    $0x10,%esp
+  801361:	85 c0                	test   %eax,%eax
+  801363:	78 05                	js     80136a <fd_close+0x30>
+	    || fd != fd2)
+  801365:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801368:	74 16                	je     801380 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80136a:	89 f8                	mov    %edi,%eax
+  80136c:	84 c0                	test   %al,%al
+  80136e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801373:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801376:	89 d8                	mov    %ebx,%eax
+  801378:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80137b:	5b                   	pop    %ebx
+  80137c:	5e                   	pop    %esi
+  80137d:	5f                   	pop    %edi
+  80137e:	5d                   	pop    %ebp
+  80137f:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801380:	83 ec 08             	sub    $0x8,%esp
+  801383:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801386:	50                   	push   %eax
+  801387:	ff 36                	push   (%esi)
+  801389:	e8 2f ff ff ff       	call   8012bd <dev_lookup>
+  80138e:	89 c3                	mov    %eax,%ebx
+  801390:	83 c4 10             	add    $0x10,%esp
+  801393:	85 c0                	test   %eax,%eax
+  801395:	78 1a                	js     8013b1 <fd_close+0x77>
+		if (dev->dev_close)
+  801397:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80139a:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80139d:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8013a2:	85 c0                	test   %eax,%eax
+  8013a4:	74 0b                	je     8013b1 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8013a6:	83 ec 0c             	sub    $0xc,%esp
+  8013a9:	56                   	push   %esi
+  8013aa:	ff d0                	call   *%eax
+  8013ac:	89 c3                	mov    %eax,%ebx
+  8013ae:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8013b1:	83 ec 08             	sub    $0x8,%esp
+  8013b4:	56                   	push   %esi
+  8013b5:	6a 00                	push   $0x0
+  8013b7:	e8 2b fa ff ff       	call   800de7 <sys_page_unmap>
+	return r;
+  8013bc:	83 c4 10             	add    $0x10,%esp
+  8013bf:	eb b5                	jmp    801376 <fd_close+0x3c>
+
+008013c1 <close>:
+
+int
+close(int fdnum)
+{
+  8013c1:	55                   	push   %ebp
+  8013c2:	89 e5                	mov    %esp,%ebp
+  8013c4:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8013c7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013ca:	50                   	push   %eax
+  8013cb:	ff 75 08             	push   0x8(%ebp)
+  8013ce:	e8 9a fe ff ff       	call   80126d <fd_lookup>
+  8013d3:	83 c4 10             	add    $0x10,%esp
+  8013d6:	85 c0                	test   %eax,%eax
+  8013d8:	79 02                	jns    8013dc <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8013da:	c9                   	leave
+  8013db:	c3                   	ret
+		return fd_close(fd, 1);
+  8013dc:	83 ec 08             	sub    $0x8,%esp
+  8013df:	6a 01                	push   $0x1
+  8013e1:	ff 75 f4             	push   -0xc(%ebp)
+  8013e4:	e8 51 ff ff ff       	call   80133a <fd_close>
+  8013e9:	83 c4 10             	add    $0x10,%esp
+  8013ec:	eb ec                	jmp    8013da <close+0x19>
+
+008013ee <close_all>:
+
+void
+close_all(void)
+{
+  8013ee:	55                   	push   %ebp
+  8013ef:	89 e5                	mov    %esp,%ebp
+  8013f1:	53                   	push   %ebx
+  8013f2:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8013f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8013fa:	83 ec 0c             	sub    $0xc,%esp
+  8013fd:	53                   	push   %ebx
+  8013fe:	e8 be ff ff ff       	call   8013c1 <close>
+	for (i = 0; i < MAXFD; i++)
+  801403:	83 c3 01             	add    $0x1,%ebx
+  801406:	83 c4 10             	add    $0x10,%esp
+  801409:	83 fb 20             	cmp    $0x20,%ebx
+  80140c:	75 ec                	jne    8013fa <close_all+0xc>
+}
+  80140e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801411:	c9                   	leave
+  801412:	c3                   	ret
+
+00801413 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801413:	55                   	push   %ebp
+  801414:	89 e5                	mov    %esp,%ebp
+  801416:	57                   	push   %edi
+  801417:	56                   	push   %esi
+  801418:	53                   	push   %ebx
+  801419:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80141c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80141f:	50                   	push   %eax
+  801420:	ff 75 08             	push   0x8(%ebp)
+  801423:	e8 45 fe ff ff       	call   80126d <fd_lookup>
+  801428:	89 c3                	mov    %eax,%ebx
+  80142a:	83 c4 10             	add    $0x10,%esp
+  80142d:	85 c0                	test   %eax,%eax
+  80142f:	78 7f                	js     8014b0 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801431:	83 ec 0c             	sub    $0xc,%esp
+  801434:	ff 75 0c             	push   0xc(%ebp)
+  801437:	e8 85 ff ff ff       	call   8013c1 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80143c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80143f:	c1 e6 0c             	shl    $0xc,%esi
+  801442:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801448:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80144b:	89 3c 24             	mov    %edi,(%esp)
+  80144e:	e8 ad fd ff ff       	call   801200 <fd2data>
+  801453:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801455:	89 34 24             	mov    %esi,(%esp)
+  801458:	e8 a3 fd ff ff       	call   801200 <fd2data>
+  80145d:	83 c4 10             	add    $0x10,%esp
+  801460:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801463:	89 d8                	mov    %ebx,%eax
+  801465:	c1 e8 16             	shr    $0x16,%eax
+  801468:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80146f:	a8 01                	test   $0x1,%al
+  801471:	74 11                	je     801484 <dup+0x71>
+  801473:	89 d8                	mov    %ebx,%eax
+  801475:	c1 e8 0c             	shr    $0xc,%eax
+  801478:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80147f:	f6 c2 01             	test   $0x1,%dl
+  801482:	75 36                	jne    8014ba <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801484:	89 f8                	mov    %edi,%eax
+  801486:	c1 e8 0c             	shr    $0xc,%eax
+  801489:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801490:	83 ec 0c             	sub    $0xc,%esp
+  801493:	25 07 0e 00 00       	and    $0xe07,%eax
+  801498:	50                   	push   %eax
+  801499:	56                   	push   %esi
+  80149a:	6a 00                	push   $0x0
+  80149c:	57                   	push   %edi
+  80149d:	6a 00                	push   $0x0
+  80149f:	e8 f7 f8 ff ff       	call   800d9b <sys_page_map>
+  8014a4:	89 c3                	mov    %eax,%ebx
+  8014a6:	83 c4 20             	add    $0x20,%esp
+  8014a9:	85 c0                	test   %eax,%eax
+  8014ab:	78 33                	js     8014e0 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8014ad:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8014b0:	89 d8                	mov    %ebx,%eax
+  8014b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014b5:	5b                   	pop    %ebx
+  8014b6:	5e                   	pop    %esi
+  8014b7:	5f                   	pop    %edi
+  8014b8:	5d                   	pop    %ebp
+  8014b9:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8014ba:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8014c1:	83 ec 0c             	sub    $0xc,%esp
+  8014c4:	25 07 0e 00 00       	and    $0xe07,%eax
+  8014c9:	50                   	push   %eax
+  8014ca:	ff 75 d4             	push   -0x2c(%ebp)
+  8014cd:	6a 00                	push   $0x0
+  8014cf:	53                   	push   %ebx
+  8014d0:	6a 00                	push   $0x0
+  8014d2:	e8 c4 f8 ff ff       	call   800d9b <sys_page_map>
+  8014d7:	89 c3                	mov    %eax,%ebx
+  8014d9:	83 c4 20             	add    $0x20,%esp
+  8014dc:	85 c0                	test   %eax,%eax
+  8014de:	79 a4                	jns    801484 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8014e0:	83 ec 08             	sub    $0x8,%esp
+  8014e3:	56                   	push   %esi
+  8014e4:	6a 00                	push   $0x0
+  8014e6:	e8 fc f8 ff ff       	call   800de7 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8014eb:	83 c4 08             	add    $0x8,%esp
+  8014ee:	ff 75 d4             	push   -0x2c(%ebp)
+  8014f1:	6a 00                	push   $0x0
+  8014f3:	e8 ef f8 ff ff       	call   800de7 <sys_page_unmap>
+	return r;
+  8014f8:	83 c4 10             	add    $0x10,%esp
+  8014fb:	eb b3                	jmp    8014b0 <dup+0x9d>
+
+008014fd <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8014fd:	55                   	push   %ebp
+  8014fe:	89 e5                	mov    %esp,%ebp
+  801500:	56                   	push   %esi
+  801501:	53                   	push   %ebx
+  801502:	83 ec 18             	sub    $0x18,%esp
+  801505:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801508:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80150b:	50                   	push   %eax
+  80150c:	53                   	push   %ebx
+  80150d:	e8 5b fd ff ff       	call   80126d <fd_lookup>
+  801512:	83 c4 10             	add    $0x10,%esp
+  801515:	85 c0                	test   %eax,%eax
+  801517:	78 3c                	js     801555 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801519:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80151c:	83 ec 08             	sub    $0x8,%esp
+  80151f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801522:	50                   	push   %eax
+  801523:	ff 36                	push   (%esi)
+  801525:	e8 93 fd ff ff       	call   8012bd <dev_lookup>
+  80152a:	83 c4 10             	add    $0x10,%esp
+  80152d:	85 c0                	test   %eax,%eax
+  80152f:	78 24                	js     801555 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801531:	8b 46 08             	mov    0x8(%esi),%eax
+  801534:	83 e0 03             	and    $0x3,%eax
+  801537:	83 f8 01             	cmp    $0x1,%eax
+  80153a:	74 20                	je     80155c <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80153c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80153f:	8b 40 08             	mov    0x8(%eax),%eax
+  801542:	85 c0                	test   %eax,%eax
+  801544:	74 61                	je     8015a7 <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801546:	83 ec 04             	sub    $0x4,%esp
+  801549:	ff 75 10             	push   0x10(%ebp)
+  80154c:	ff 75 0c             	push   0xc(%ebp)
+  80154f:	56                   	push   %esi
+  801550:	ff d0                	call   *%eax
+  801552:	83 c4 10             	add    $0x10,%esp
+}
+  801555:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801558:	5b                   	pop    %ebx
+  801559:	5e                   	pop    %esi
+  80155a:	5d                   	pop    %ebp
+  80155b:	c3                   	ret
+  80155c:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80155e:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801564:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801569:	77 18                	ja     801583 <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80156b:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801570:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801572:	c1 e8 10             	shr    $0x10,%eax
+  801575:	74 0c                	je     801583 <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801577:	c1 e0 10             	shl    $0x10,%eax
+  80157a:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80157f:	29 c2                	sub    %eax,%edx
+  801581:	eb 06                	jmp    801589 <read+0x8c>
+		return pthread_main_tls;
+  801583:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801589:	8b 02                	mov    (%edx),%eax
+  80158b:	8b 40 48             	mov    0x48(%eax),%eax
+  80158e:	83 ec 04             	sub    $0x4,%esp
+  801591:	53                   	push   %ebx
+  801592:	50                   	push   %eax
+  801593:	68 01 4d 80 00       	push   $0x804d01
+  801598:	e8 8f ed ff ff       	call   80032c <cprintf>
+		return -E_INVAL;
+  80159d:	83 c4 10             	add    $0x10,%esp
+  8015a0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015a5:	eb ae                	jmp    801555 <read+0x58>
+		return -E_NOT_SUPP;
+  8015a7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015ac:	eb a7                	jmp    801555 <read+0x58>
+
+008015ae <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8015ae:	55                   	push   %ebp
+  8015af:	89 e5                	mov    %esp,%ebp
+  8015b1:	57                   	push   %edi
+  8015b2:	56                   	push   %esi
+  8015b3:	53                   	push   %ebx
+  8015b4:	83 ec 0c             	sub    $0xc,%esp
+  8015b7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8015ba:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8015bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015c2:	eb 02                	jmp    8015c6 <readn+0x18>
+  8015c4:	01 c3                	add    %eax,%ebx
+  8015c6:	39 f3                	cmp    %esi,%ebx
+  8015c8:	73 21                	jae    8015eb <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8015ca:	83 ec 04             	sub    $0x4,%esp
+  8015cd:	89 f0                	mov    %esi,%eax
+  8015cf:	29 d8                	sub    %ebx,%eax
+  8015d1:	50                   	push   %eax
+  8015d2:	89 d8                	mov    %ebx,%eax
+  8015d4:	03 45 0c             	add    0xc(%ebp),%eax
+  8015d7:	50                   	push   %eax
+  8015d8:	57                   	push   %edi
+  8015d9:	e8 1f ff ff ff       	call   8014fd <read>
+		if (m < 0)
+  8015de:	83 c4 10             	add    $0x10,%esp
+  8015e1:	85 c0                	test   %eax,%eax
+  8015e3:	78 04                	js     8015e9 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8015e5:	75 dd                	jne    8015c4 <readn+0x16>
+  8015e7:	eb 02                	jmp    8015eb <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8015e9:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8015eb:	89 d8                	mov    %ebx,%eax
+  8015ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015f0:	5b                   	pop    %ebx
+  8015f1:	5e                   	pop    %esi
+  8015f2:	5f                   	pop    %edi
+  8015f3:	5d                   	pop    %ebp
+  8015f4:	c3                   	ret
+
+008015f5 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8015f5:	55                   	push   %ebp
+  8015f6:	89 e5                	mov    %esp,%ebp
+  8015f8:	56                   	push   %esi
+  8015f9:	53                   	push   %ebx
+  8015fa:	83 ec 18             	sub    $0x18,%esp
+  8015fd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801600:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801603:	50                   	push   %eax
+  801604:	53                   	push   %ebx
+  801605:	e8 63 fc ff ff       	call   80126d <fd_lookup>
+  80160a:	83 c4 10             	add    $0x10,%esp
+  80160d:	85 c0                	test   %eax,%eax
+  80160f:	78 37                	js     801648 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801611:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801614:	83 ec 08             	sub    $0x8,%esp
+  801617:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80161a:	50                   	push   %eax
+  80161b:	ff 36                	push   (%esi)
+  80161d:	e8 9b fc ff ff       	call   8012bd <dev_lookup>
+  801622:	83 c4 10             	add    $0x10,%esp
+  801625:	85 c0                	test   %eax,%eax
+  801627:	78 1f                	js     801648 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801629:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80162d:	74 20                	je     80164f <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80162f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801632:	8b 40 0c             	mov    0xc(%eax),%eax
+  801635:	85 c0                	test   %eax,%eax
+  801637:	74 61                	je     80169a <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801639:	83 ec 04             	sub    $0x4,%esp
+  80163c:	ff 75 10             	push   0x10(%ebp)
+  80163f:	ff 75 0c             	push   0xc(%ebp)
+  801642:	56                   	push   %esi
+  801643:	ff d0                	call   *%eax
+  801645:	83 c4 10             	add    $0x10,%esp
+}
+  801648:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80164b:	5b                   	pop    %ebx
+  80164c:	5e                   	pop    %esi
+  80164d:	5d                   	pop    %ebp
+  80164e:	c3                   	ret
+  80164f:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801651:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801657:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80165c:	77 18                	ja     801676 <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80165e:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801663:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801665:	c1 e8 10             	shr    $0x10,%eax
+  801668:	74 0c                	je     801676 <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80166a:	c1 e0 10             	shl    $0x10,%eax
+  80166d:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801672:	29 c2                	sub    %eax,%edx
+  801674:	eb 06                	jmp    80167c <write+0x87>
+		return pthread_main_tls;
+  801676:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80167c:	8b 02                	mov    (%edx),%eax
+  80167e:	8b 40 48             	mov    0x48(%eax),%eax
+  801681:	83 ec 04             	sub    $0x4,%esp
+  801684:	53                   	push   %ebx
+  801685:	50                   	push   %eax
+  801686:	68 1d 4d 80 00       	push   $0x804d1d
+  80168b:	e8 9c ec ff ff       	call   80032c <cprintf>
+		return -E_INVAL;
+  801690:	83 c4 10             	add    $0x10,%esp
+  801693:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801698:	eb ae                	jmp    801648 <write+0x53>
+		return -E_NOT_SUPP;
+  80169a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80169f:	eb a7                	jmp    801648 <write+0x53>
+
+008016a1 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8016a1:	55                   	push   %ebp
+  8016a2:	89 e5                	mov    %esp,%ebp
+  8016a4:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8016a7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016aa:	50                   	push   %eax
+  8016ab:	ff 75 08             	push   0x8(%ebp)
+  8016ae:	e8 ba fb ff ff       	call   80126d <fd_lookup>
+  8016b3:	83 c4 10             	add    $0x10,%esp
+  8016b6:	85 c0                	test   %eax,%eax
+  8016b8:	78 0e                	js     8016c8 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8016ba:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8016bd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016c0:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8016c3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8016c8:	c9                   	leave
+  8016c9:	c3                   	ret
+
+008016ca <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8016ca:	55                   	push   %ebp
+  8016cb:	89 e5                	mov    %esp,%ebp
+  8016cd:	56                   	push   %esi
+  8016ce:	53                   	push   %ebx
+  8016cf:	83 ec 18             	sub    $0x18,%esp
+  8016d2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016d5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016d8:	50                   	push   %eax
+  8016d9:	53                   	push   %ebx
+  8016da:	e8 8e fb ff ff       	call   80126d <fd_lookup>
+  8016df:	83 c4 10             	add    $0x10,%esp
+  8016e2:	85 c0                	test   %eax,%eax
+  8016e4:	78 34                	js     80171a <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016e6:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8016e9:	83 ec 08             	sub    $0x8,%esp
+  8016ec:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016ef:	50                   	push   %eax
+  8016f0:	ff 36                	push   (%esi)
+  8016f2:	e8 c6 fb ff ff       	call   8012bd <dev_lookup>
+  8016f7:	83 c4 10             	add    $0x10,%esp
+  8016fa:	85 c0                	test   %eax,%eax
+  8016fc:	78 1c                	js     80171a <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8016fe:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801702:	74 1d                	je     801721 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801704:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801707:	8b 40 18             	mov    0x18(%eax),%eax
+  80170a:	85 c0                	test   %eax,%eax
+  80170c:	74 5e                	je     80176c <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80170e:	83 ec 08             	sub    $0x8,%esp
+  801711:	ff 75 0c             	push   0xc(%ebp)
+  801714:	56                   	push   %esi
+  801715:	ff d0                	call   *%eax
+  801717:	83 c4 10             	add    $0x10,%esp
+}
+  80171a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80171d:	5b                   	pop    %ebx
+  80171e:	5e                   	pop    %esi
+  80171f:	5d                   	pop    %ebp
+  801720:	c3                   	ret
+  801721:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801723:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801729:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80172e:	77 18                	ja     801748 <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801730:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801735:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801737:	c1 e8 10             	shr    $0x10,%eax
+  80173a:	74 0c                	je     801748 <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80173c:	c1 e0 10             	shl    $0x10,%eax
+  80173f:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801744:	29 c2                	sub    %eax,%edx
+  801746:	eb 06                	jmp    80174e <ftruncate+0x84>
+		return pthread_main_tls;
+  801748:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+			thisenv->env_id, fdnum);
+  80174e:	8b 02                	mov    (%edx),%eax
+  801750:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801753:	83 ec 04             	sub    $0x4,%esp
+  801756:	53                   	push   %ebx
+  801757:	50                   	push   %eax
+  801758:	68 e0 4c 80 00       	push   $0x804ce0
+  80175d:	e8 ca eb ff ff       	call   80032c <cprintf>
+		return -E_INVAL;
+  801762:	83 c4 10             	add    $0x10,%esp
+  801765:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80176a:	eb ae                	jmp    80171a <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80176c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801771:	eb a7                	jmp    80171a <ftruncate+0x50>
+
+00801773 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801773:	55                   	push   %ebp
+  801774:	89 e5                	mov    %esp,%ebp
+  801776:	56                   	push   %esi
+  801777:	53                   	push   %ebx
+  801778:	83 ec 18             	sub    $0x18,%esp
+  80177b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80177e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801781:	50                   	push   %eax
+  801782:	ff 75 08             	push   0x8(%ebp)
+  801785:	e8 e3 fa ff ff       	call   80126d <fd_lookup>
+  80178a:	83 c4 10             	add    $0x10,%esp
+  80178d:	85 c0                	test   %eax,%eax
+  80178f:	78 49                	js     8017da <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801791:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801794:	83 ec 08             	sub    $0x8,%esp
+  801797:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80179a:	50                   	push   %eax
+  80179b:	ff 36                	push   (%esi)
+  80179d:	e8 1b fb ff ff       	call   8012bd <dev_lookup>
+  8017a2:	83 c4 10             	add    $0x10,%esp
+  8017a5:	85 c0                	test   %eax,%eax
+  8017a7:	78 31                	js     8017da <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8017a9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017ac:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8017b0:	74 2f                	je     8017e1 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8017b2:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8017b5:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8017bc:	00 00 00 
+	stat->st_isdir = 0;
+  8017bf:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8017c6:	00 00 00 
+	stat->st_dev = dev;
+  8017c9:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8017cf:	83 ec 08             	sub    $0x8,%esp
+  8017d2:	53                   	push   %ebx
+  8017d3:	56                   	push   %esi
+  8017d4:	ff 50 14             	call   *0x14(%eax)
+  8017d7:	83 c4 10             	add    $0x10,%esp
+}
+  8017da:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017dd:	5b                   	pop    %ebx
+  8017de:	5e                   	pop    %esi
+  8017df:	5d                   	pop    %ebp
+  8017e0:	c3                   	ret
+		return -E_NOT_SUPP;
+  8017e1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017e6:	eb f2                	jmp    8017da <fstat+0x67>
+
+008017e8 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8017e8:	55                   	push   %ebp
+  8017e9:	89 e5                	mov    %esp,%ebp
+  8017eb:	56                   	push   %esi
+  8017ec:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8017ed:	83 ec 08             	sub    $0x8,%esp
+  8017f0:	6a 00                	push   $0x0
+  8017f2:	ff 75 08             	push   0x8(%ebp)
+  8017f5:	e8 4b 03 00 00       	call   801b45 <open>
+  8017fa:	89 c3                	mov    %eax,%ebx
+  8017fc:	83 c4 10             	add    $0x10,%esp
+  8017ff:	85 c0                	test   %eax,%eax
+  801801:	78 1b                	js     80181e <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801803:	83 ec 08             	sub    $0x8,%esp
+  801806:	ff 75 0c             	push   0xc(%ebp)
+  801809:	50                   	push   %eax
+  80180a:	e8 64 ff ff ff       	call   801773 <fstat>
+  80180f:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801811:	89 1c 24             	mov    %ebx,(%esp)
+  801814:	e8 a8 fb ff ff       	call   8013c1 <close>
+	return r;
+  801819:	83 c4 10             	add    $0x10,%esp
+  80181c:	89 f3                	mov    %esi,%ebx
+}
+  80181e:	89 d8                	mov    %ebx,%eax
+  801820:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801823:	5b                   	pop    %ebx
+  801824:	5e                   	pop    %esi
+  801825:	5d                   	pop    %ebp
+  801826:	c3                   	ret
+
+00801827 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801827:	55                   	push   %ebp
+  801828:	89 e5                	mov    %esp,%ebp
+  80182a:	56                   	push   %esi
+  80182b:	53                   	push   %ebx
+  80182c:	89 c6                	mov    %eax,%esi
+  80182e:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801830:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  801837:	74 27                	je     801860 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801839:	6a 07                	push   $0x7
+  80183b:	68 00 80 80 00       	push   $0x808000
+  801840:	56                   	push   %esi
+  801841:	ff 35 00 70 80 00    	push   0x807000
+  801847:	e8 4e 2c 00 00       	call   80449a <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  80184c:	83 c4 0c             	add    $0xc,%esp
+  80184f:	6a 00                	push   $0x0
+  801851:	53                   	push   %ebx
+  801852:	6a 00                	push   $0x0
+  801854:	e8 4b 2b 00 00       	call   8043a4 <ipc_recv>
+}
+  801859:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80185c:	5b                   	pop    %ebx
+  80185d:	5e                   	pop    %esi
+  80185e:	5d                   	pop    %ebp
+  80185f:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801860:	83 ec 0c             	sub    $0xc,%esp
+  801863:	6a 01                	push   $0x1
+  801865:	e8 86 2c 00 00       	call   8044f0 <ipc_find_env>
+  80186a:	a3 00 70 80 00       	mov    %eax,0x807000
+  80186f:	83 c4 10             	add    $0x10,%esp
+  801872:	eb c5                	jmp    801839 <fsipc+0x12>
+
+00801874 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801874:	55                   	push   %ebp
+  801875:	89 e5                	mov    %esp,%ebp
+  801877:	53                   	push   %ebx
+  801878:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  80187b:	68 04 70 80 00       	push   $0x807004
+  801880:	e8 29 1b 00 00       	call   8033ae <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801885:	8b 45 08             	mov    0x8(%ebp),%eax
+  801888:	8b 40 0c             	mov    0xc(%eax),%eax
+  80188b:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.set_size.req_size = newsize;
+  801890:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801893:	a3 04 80 80 00       	mov    %eax,0x808004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  801898:	ba 00 00 00 00       	mov    $0x0,%edx
+  80189d:	b8 02 00 00 00       	mov    $0x2,%eax
+  8018a2:	e8 80 ff ff ff       	call   801827 <fsipc>
+  8018a7:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8018a9:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  8018b0:	e8 66 1b 00 00       	call   80341b <mutex_unlock>
+	return r;
+}
+  8018b5:	89 d8                	mov    %ebx,%eax
+  8018b7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018ba:	c9                   	leave
+  8018bb:	c3                   	ret
+
+008018bc <devfile_flush>:
+{
+  8018bc:	55                   	push   %ebp
+  8018bd:	89 e5                	mov    %esp,%ebp
+  8018bf:	53                   	push   %ebx
+  8018c0:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  8018c3:	68 04 70 80 00       	push   $0x807004
+  8018c8:	e8 e1 1a 00 00       	call   8033ae <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8018cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018d0:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018d3:	a3 00 80 80 00       	mov    %eax,0x808000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  8018d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018dd:	b8 06 00 00 00       	mov    $0x6,%eax
+  8018e2:	e8 40 ff ff ff       	call   801827 <fsipc>
+  8018e7:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8018e9:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  8018f0:	e8 26 1b 00 00       	call   80341b <mutex_unlock>
+}
+  8018f5:	89 d8                	mov    %ebx,%eax
+  8018f7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018fa:	c9                   	leave
+  8018fb:	c3                   	ret
+
+008018fc <devfile_stat>:
+{
+  8018fc:	55                   	push   %ebp
+  8018fd:	89 e5                	mov    %esp,%ebp
+  8018ff:	56                   	push   %esi
+  801900:	53                   	push   %ebx
+  801901:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  801904:	83 ec 0c             	sub    $0xc,%esp
+  801907:	68 04 70 80 00       	push   $0x807004
+  80190c:	e8 9d 1a 00 00       	call   8033ae <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801911:	8b 45 08             	mov    0x8(%ebp),%eax
+  801914:	8b 40 0c             	mov    0xc(%eax),%eax
+  801917:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  80191c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801921:	b8 05 00 00 00       	mov    $0x5,%eax
+  801926:	e8 fc fe ff ff       	call   801827 <fsipc>
+  80192b:	89 c3                	mov    %eax,%ebx
+  80192d:	83 c4 10             	add    $0x10,%esp
+  801930:	85 c0                	test   %eax,%eax
+  801932:	79 16                	jns    80194a <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  801934:	83 ec 0c             	sub    $0xc,%esp
+  801937:	68 04 70 80 00       	push   $0x807004
+  80193c:	e8 da 1a 00 00       	call   80341b <mutex_unlock>
+}
+  801941:	89 d8                	mov    %ebx,%eax
+  801943:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801946:	5b                   	pop    %ebx
+  801947:	5e                   	pop    %esi
+  801948:	5d                   	pop    %ebp
+  801949:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80194a:	83 ec 08             	sub    $0x8,%esp
+  80194d:	68 00 80 80 00       	push   $0x808000
+  801952:	56                   	push   %esi
+  801953:	e8 b8 ef ff ff       	call   800910 <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  801958:	a1 80 80 80 00       	mov    0x808080,%eax
+  80195d:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801963:	a1 84 80 80 00       	mov    0x808084,%eax
+  801968:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  80196e:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  801971:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801976:	eb bc                	jmp    801934 <devfile_stat+0x38>
+
+00801978 <devfile_write>:
+{
+  801978:	55                   	push   %ebp
+  801979:	89 e5                	mov    %esp,%ebp
+  80197b:	53                   	push   %ebx
+  80197c:	83 ec 10             	sub    $0x10,%esp
+  80197f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  801982:	68 04 70 80 00       	push   $0x807004
+  801987:	e8 22 1a 00 00       	call   8033ae <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80198c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80198f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801992:	a3 00 80 80 00       	mov    %eax,0x808000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801997:	83 c4 10             	add    $0x10,%esp
+  80199a:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  8019a0:	76 3d                	jbe    8019df <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  8019a2:	b8 00 00 10 00       	mov    $0x100000,%eax
+  8019a7:	39 c3                	cmp    %eax,%ebx
+  8019a9:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  8019ac:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019af:	a3 08 80 80 00       	mov    %eax,0x808008
+	fsipcbuf.write.req_n = n;
+  8019b4:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	r = fsipc(FSREQ_WRITE, NULL);
+  8019ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019bf:	b8 04 00 00 00       	mov    $0x4,%eax
+  8019c4:	e8 5e fe ff ff       	call   801827 <fsipc>
+  8019c9:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8019cb:	83 ec 0c             	sub    $0xc,%esp
+  8019ce:	68 04 70 80 00       	push   $0x807004
+  8019d3:	e8 43 1a 00 00       	call   80341b <mutex_unlock>
+}
+  8019d8:	89 d8                	mov    %ebx,%eax
+  8019da:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019dd:	c9                   	leave
+  8019de:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  8019df:	83 ec 04             	sub    $0x4,%esp
+  8019e2:	53                   	push   %ebx
+  8019e3:	ff 75 0c             	push   0xc(%ebp)
+  8019e6:	68 0c 80 80 00       	push   $0x80800c
+  8019eb:	e8 a6 f0 ff ff       	call   800a96 <memmove>
+  8019f0:	83 c4 10             	add    $0x10,%esp
+  8019f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019f8:	eb b5                	jmp    8019af <devfile_write+0x37>
+
+008019fa <devfile_read>:
+{
+  8019fa:	55                   	push   %ebp
+  8019fb:	89 e5                	mov    %esp,%ebp
+  8019fd:	57                   	push   %edi
+  8019fe:	56                   	push   %esi
+  8019ff:	53                   	push   %ebx
+  801a00:	83 ec 0c             	sub    $0xc,%esp
+  801a03:	8b 75 08             	mov    0x8(%ebp),%esi
+  801a06:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801a09:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  801a0c:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801a12:	0f 86 8c 00 00 00    	jbe    801aa4 <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  801a18:	b8 00 00 10 00       	mov    $0x100000,%eax
+  801a1d:	39 c3                	cmp    %eax,%ebx
+  801a1f:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  801a22:	89 f8                	mov    %edi,%eax
+  801a24:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801a27:	eb 0f                	jmp    801a38 <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  801a29:	0f b6 08             	movzbl (%eax),%ecx
+  801a2c:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  801a2e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801a33:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  801a38:	39 d0                	cmp    %edx,%eax
+  801a3a:	72 ed                	jb     801a29 <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  801a3c:	83 ec 0c             	sub    $0xc,%esp
+  801a3f:	68 04 70 80 00       	push   $0x807004
+  801a44:	e8 65 19 00 00       	call   8033ae <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801a49:	8b 46 0c             	mov    0xc(%esi),%eax
+  801a4c:	a3 00 80 80 00       	mov    %eax,0x808000
+		fsipcbuf.read.req_n = n;
+  801a51:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  801a57:	89 3d 08 80 80 00    	mov    %edi,0x808008
+		r = fsipc(FSREQ_READ, NULL);
+  801a5d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a62:	b8 03 00 00 00       	mov    $0x3,%eax
+  801a67:	e8 bb fd ff ff       	call   801827 <fsipc>
+  801a6c:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  801a6e:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801a75:	e8 a1 19 00 00       	call   80341b <mutex_unlock>
+		assert(r <= (int) n);
+  801a7a:	83 c4 10             	add    $0x10,%esp
+  801a7d:	39 f3                	cmp    %esi,%ebx
+  801a7f:	7c 0a                	jl     801a8b <devfile_read+0x91>
+}
+  801a81:	89 f0                	mov    %esi,%eax
+  801a83:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a86:	5b                   	pop    %ebx
+  801a87:	5e                   	pop    %esi
+  801a88:	5f                   	pop    %edi
+  801a89:	5d                   	pop    %ebp
+  801a8a:	c3                   	ret
+		assert(r <= (int) n);
+  801a8b:	68 50 4d 80 00       	push   $0x804d50
+  801a90:	68 5d 4d 80 00       	push   $0x804d5d
+  801a95:	68 90 00 00 00       	push   $0x90
+  801a9a:	68 72 4d 80 00       	push   $0x804d72
+  801a9f:	e8 ad e7 ff ff       	call   800251 <_panic>
+	mutex_lock(&fsipc_mu);
+  801aa4:	83 ec 0c             	sub    $0xc,%esp
+  801aa7:	68 04 70 80 00       	push   $0x807004
+  801aac:	e8 fd 18 00 00       	call   8033ae <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801ab1:	8b 46 0c             	mov    0xc(%esi),%eax
+  801ab4:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.read.req_n = n;
+  801ab9:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	fsipcbuf.read.req_va = 0;
+  801abf:	c7 05 08 80 80 00 00 	movl   $0x0,0x808008
+  801ac6:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  801ac9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ace:	b8 03 00 00 00       	mov    $0x3,%eax
+  801ad3:	e8 4f fd ff ff       	call   801827 <fsipc>
+  801ad8:	89 c6                	mov    %eax,%esi
+  801ada:	83 c4 10             	add    $0x10,%esp
+  801add:	85 c0                	test   %eax,%eax
+  801adf:	78 1d                	js     801afe <devfile_read+0x104>
+		assert(r <= n);
+  801ae1:	39 c3                	cmp    %eax,%ebx
+  801ae3:	72 2e                	jb     801b13 <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  801ae5:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801aea:	7f 40                	jg     801b2c <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801aec:	83 ec 04             	sub    $0x4,%esp
+  801aef:	50                   	push   %eax
+  801af0:	68 00 80 80 00       	push   $0x808000
+  801af5:	57                   	push   %edi
+  801af6:	e8 9b ef ff ff       	call   800a96 <memmove>
+  801afb:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  801afe:	83 ec 0c             	sub    $0xc,%esp
+  801b01:	68 04 70 80 00       	push   $0x807004
+  801b06:	e8 10 19 00 00       	call   80341b <mutex_unlock>
+	return r;
+  801b0b:	83 c4 10             	add    $0x10,%esp
+  801b0e:	e9 6e ff ff ff       	jmp    801a81 <devfile_read+0x87>
+		assert(r <= n);
+  801b13:	68 7d 4d 80 00       	push   $0x804d7d
+  801b18:	68 5d 4d 80 00       	push   $0x804d5d
+  801b1d:	68 99 00 00 00       	push   $0x99
+  801b22:	68 72 4d 80 00       	push   $0x804d72
+  801b27:	e8 25 e7 ff ff       	call   800251 <_panic>
+		assert(r <= PGSIZE);
+  801b2c:	68 84 4d 80 00       	push   $0x804d84
+  801b31:	68 5d 4d 80 00       	push   $0x804d5d
+  801b36:	68 9a 00 00 00       	push   $0x9a
+  801b3b:	68 72 4d 80 00       	push   $0x804d72
+  801b40:	e8 0c e7 ff ff       	call   800251 <_panic>
+
+00801b45 <open>:
+{
+  801b45:	55                   	push   %ebp
+  801b46:	89 e5                	mov    %esp,%ebp
+  801b48:	56                   	push   %esi
+  801b49:	53                   	push   %ebx
+  801b4a:	83 ec 1c             	sub    $0x1c,%esp
+  801b4d:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801b50:	56                   	push   %esi
+  801b51:	e8 7f ed ff ff       	call   8008d5 <strlen>
+  801b56:	83 c4 10             	add    $0x10,%esp
+  801b59:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801b5e:	0f 8f 85 00 00 00    	jg     801be9 <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  801b64:	83 ec 0c             	sub    $0xc,%esp
+  801b67:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b6a:	50                   	push   %eax
+  801b6b:	e8 a7 f6 ff ff       	call   801217 <fd_alloc>
+  801b70:	89 c3                	mov    %eax,%ebx
+  801b72:	83 c4 10             	add    $0x10,%esp
+  801b75:	85 c0                	test   %eax,%eax
+  801b77:	78 55                	js     801bce <open+0x89>
+	mutex_lock(&fsipc_mu);
+  801b79:	83 ec 0c             	sub    $0xc,%esp
+  801b7c:	68 04 70 80 00       	push   $0x807004
+  801b81:	e8 28 18 00 00       	call   8033ae <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  801b86:	83 c4 08             	add    $0x8,%esp
+  801b89:	56                   	push   %esi
+  801b8a:	68 00 80 80 00       	push   $0x808000
+  801b8f:	e8 7c ed ff ff       	call   800910 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801b94:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b97:	a3 00 84 80 00       	mov    %eax,0x808400
+	r = fsipc(FSREQ_OPEN, fd);
+  801b9c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801b9f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ba4:	e8 7e fc ff ff       	call   801827 <fsipc>
+  801ba9:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801bab:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801bb2:	e8 64 18 00 00       	call   80341b <mutex_unlock>
+	if (r < 0) {
+  801bb7:	83 c4 10             	add    $0x10,%esp
+  801bba:	85 db                	test   %ebx,%ebx
+  801bbc:	78 19                	js     801bd7 <open+0x92>
+	return fd2num(fd);
+  801bbe:	83 ec 0c             	sub    $0xc,%esp
+  801bc1:	ff 75 f4             	push   -0xc(%ebp)
+  801bc4:	e8 27 f6 ff ff       	call   8011f0 <fd2num>
+  801bc9:	89 c3                	mov    %eax,%ebx
+  801bcb:	83 c4 10             	add    $0x10,%esp
+}
+  801bce:	89 d8                	mov    %ebx,%eax
+  801bd0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bd3:	5b                   	pop    %ebx
+  801bd4:	5e                   	pop    %esi
+  801bd5:	5d                   	pop    %ebp
+  801bd6:	c3                   	ret
+		fd_close(fd, 0);
+  801bd7:	83 ec 08             	sub    $0x8,%esp
+  801bda:	6a 00                	push   $0x0
+  801bdc:	ff 75 f4             	push   -0xc(%ebp)
+  801bdf:	e8 56 f7 ff ff       	call   80133a <fd_close>
+		return r;
+  801be4:	83 c4 10             	add    $0x10,%esp
+  801be7:	eb e5                	jmp    801bce <open+0x89>
+		return -E_BAD_PATH;
+  801be9:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801bee:	eb de                	jmp    801bce <open+0x89>
+
+00801bf0 <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  801bf0:	55                   	push   %ebp
+  801bf1:	89 e5                	mov    %esp,%ebp
+  801bf3:	53                   	push   %ebx
+  801bf4:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801bf7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bfa:	50                   	push   %eax
+  801bfb:	ff 75 08             	push   0x8(%ebp)
+  801bfe:	e8 6a f6 ff ff       	call   80126d <fd_lookup>
+  801c03:	89 c3                	mov    %eax,%ebx
+  801c05:	83 c4 10             	add    $0x10,%esp
+  801c08:	85 c0                	test   %eax,%eax
+  801c0a:	78 5b                	js     801c67 <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801c0c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c0f:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  801c15:	39 08                	cmp    %ecx,(%eax)
+  801c17:	75 55                	jne    801c6e <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  801c19:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  801c1d:	74 56                	je     801c75 <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  801c1f:	83 ec 0c             	sub    $0xc,%esp
+  801c22:	68 04 70 80 00       	push   $0x807004
+  801c27:	e8 82 17 00 00       	call   8033ae <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  801c2c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c2f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c32:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.allocate.req_offset = offset;
+  801c37:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c3a:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.allocate.req_len = len;
+  801c3f:	8b 45 10             	mov    0x10(%ebp),%eax
+  801c42:	a3 08 80 80 00       	mov    %eax,0x808008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  801c47:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c4c:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801c51:	e8 d1 fb ff ff       	call   801827 <fsipc>
+  801c56:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801c58:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801c5f:	e8 b7 17 00 00       	call   80341b <mutex_unlock>
+	return r;
+  801c64:	83 c4 10             	add    $0x10,%esp
+}
+  801c67:	89 d8                	mov    %ebx,%eax
+  801c69:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c6c:	c9                   	leave
+  801c6d:	c3                   	ret
+		return -E_NOT_SUPP;
+  801c6e:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801c73:	eb f2                	jmp    801c67 <fallocate+0x77>
+		return -E_INVAL;
+  801c75:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801c7a:	eb eb                	jmp    801c67 <fallocate+0x77>
+
+00801c7c <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  801c7c:	55                   	push   %ebp
+  801c7d:	89 e5                	mov    %esp,%ebp
+  801c7f:	56                   	push   %esi
+  801c80:	53                   	push   %ebx
+  801c81:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801c84:	89 f3                	mov    %esi,%ebx
+  801c86:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801c8c:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801c8f:	eb 06                	jmp    801c97 <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801c91:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801c97:	39 f3                	cmp    %esi,%ebx
+  801c99:	73 14                	jae    801caf <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  801c9b:	83 ec 08             	sub    $0x8,%esp
+  801c9e:	53                   	push   %ebx
+  801c9f:	6a 00                	push   $0x0
+  801ca1:	e8 41 f1 ff ff       	call   800de7 <sys_page_unmap>
+  801ca6:	83 c4 10             	add    $0x10,%esp
+  801ca9:	85 c0                	test   %eax,%eax
+  801cab:	79 e4                	jns    801c91 <munmap+0x15>
+  801cad:	eb 05                	jmp    801cb4 <munmap+0x38>
+			return r;
+	return 0;
+  801caf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801cb4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cb7:	5b                   	pop    %ebx
+  801cb8:	5e                   	pop    %esi
+  801cb9:	5d                   	pop    %ebp
+  801cba:	c3                   	ret
+
+00801cbb <mmap>:
+{
+  801cbb:	55                   	push   %ebp
+  801cbc:	89 e5                	mov    %esp,%ebp
+  801cbe:	57                   	push   %edi
+  801cbf:	56                   	push   %esi
+  801cc0:	53                   	push   %ebx
+  801cc1:	83 ec 24             	sub    $0x24,%esp
+  801cc4:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801cc7:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801cca:	50                   	push   %eax
+  801ccb:	ff 75 08             	push   0x8(%ebp)
+  801cce:	e8 9a f5 ff ff       	call   80126d <fd_lookup>
+  801cd3:	83 c4 10             	add    $0x10,%esp
+  801cd6:	85 c0                	test   %eax,%eax
+  801cd8:	0f 88 37 01 00 00    	js     801e15 <mmap+0x15a>
+		return NULL;
+  801cde:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801ce3:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801ce6:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  801cec:	39 0a                	cmp    %ecx,(%edx)
+  801cee:	0f 85 05 01 00 00    	jne    801df9 <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  801cf4:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801cfb:	0f 85 1b 01 00 00    	jne    801e1c <mmap+0x161>
+  801d01:	89 f0                	mov    %esi,%eax
+  801d03:	83 e8 01             	sub    $0x1,%eax
+  801d06:	0f 88 17 01 00 00    	js     801e23 <mmap+0x168>
+	if (prot & PROT_WRITE)
+  801d0c:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  801d10:	75 28                	jne    801d3a <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  801d12:	83 ec 0c             	sub    $0xc,%esp
+  801d15:	68 04 70 80 00       	push   $0x807004
+  801d1a:	e8 8f 16 00 00       	call   8033ae <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801d1f:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  801d25:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  801d2b:	83 c4 10             	add    $0x10,%esp
+  801d2e:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  801d33:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  801d38:	eb 2b                	jmp    801d65 <mmap+0xaa>
+		cow_enable();
+  801d3a:	e8 f4 21 00 00       	call   803f33 <cow_enable>
+  801d3f:	eb d1                	jmp    801d12 <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  801d41:	89 c2                	mov    %eax,%edx
+  801d43:	c1 ea 0c             	shr    $0xc,%edx
+  801d46:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  801d4d:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801d53:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  801d59:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  801d5c:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  801d5e:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  801d63:	77 25                	ja     801d8a <mmap+0xcf>
+  801d65:	89 c2                	mov    %eax,%edx
+  801d67:	29 da                	sub    %ebx,%edx
+  801d69:	39 ca                	cmp    %ecx,%edx
+  801d6b:	73 3a                	jae    801da7 <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  801d6d:	89 c2                	mov    %eax,%edx
+  801d6f:	c1 ea 16             	shr    $0x16,%edx
+  801d72:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801d79:	f6 c2 01             	test   $0x1,%dl
+  801d7c:	75 c3                	jne    801d41 <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  801d7e:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  801d83:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  801d88:	eb d4                	jmp    801d5e <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  801d8a:	29 d8                	sub    %ebx,%eax
+  801d8c:	39 c8                	cmp    %ecx,%eax
+  801d8e:	73 17                	jae    801da7 <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  801d90:	83 ec 0c             	sub    $0xc,%esp
+  801d93:	68 04 70 80 00       	push   $0x807004
+  801d98:	e8 7e 16 00 00       	call   80341b <mutex_unlock>
+		return NULL;
+  801d9d:	83 c4 10             	add    $0x10,%esp
+  801da0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801da5:	eb 52                	jmp    801df9 <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801da7:	85 db                	test   %ebx,%ebx
+  801da9:	74 e5                	je     801d90 <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801dab:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801dae:	8b 40 0c             	mov    0xc(%eax),%eax
+  801db1:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.map.req_offset = offset;
+  801db6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801db9:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.map.req_len = len;
+  801dbe:	89 35 08 80 80 00    	mov    %esi,0x808008
+	fsipcbuf.map.req_va = va;
+  801dc4:	89 1d 0c 80 80 00    	mov    %ebx,0x80800c
+	fsipcbuf.map.req_prot = prot;
+  801dca:	8b 45 14             	mov    0x14(%ebp),%eax
+  801dcd:	a3 10 80 80 00       	mov    %eax,0x808010
+	r = fsipc(FSREQ_MAP, NULL);
+  801dd2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dd7:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801ddc:	e8 46 fa ff ff       	call   801827 <fsipc>
+  801de1:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  801de3:	83 ec 0c             	sub    $0xc,%esp
+  801de6:	68 04 70 80 00       	push   $0x807004
+  801deb:	e8 2b 16 00 00       	call   80341b <mutex_unlock>
+	if (r < 0) {
+  801df0:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  801df3:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  801df5:	85 ff                	test   %edi,%edi
+  801df7:	78 08                	js     801e01 <mmap+0x146>
+}
+  801df9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801dfc:	5b                   	pop    %ebx
+  801dfd:	5e                   	pop    %esi
+  801dfe:	5f                   	pop    %edi
+  801dff:	5d                   	pop    %ebp
+  801e00:	c3                   	ret
+		munmap((void*) va, len);
+  801e01:	83 ec 08             	sub    $0x8,%esp
+  801e04:	56                   	push   %esi
+  801e05:	53                   	push   %ebx
+  801e06:	e8 71 fe ff ff       	call   801c7c <munmap>
+		return NULL;
+  801e0b:	83 c4 10             	add    $0x10,%esp
+  801e0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e13:	eb e4                	jmp    801df9 <mmap+0x13e>
+		return NULL;
+  801e15:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e1a:	eb dd                	jmp    801df9 <mmap+0x13e>
+		return NULL;
+  801e1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e21:	eb d6                	jmp    801df9 <mmap+0x13e>
+  801e23:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e28:	eb cf                	jmp    801df9 <mmap+0x13e>
+
+00801e2a <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  801e2a:	55                   	push   %ebp
+  801e2b:	89 e5                	mov    %esp,%ebp
+  801e2d:	53                   	push   %ebx
+  801e2e:	83 ec 10             	sub    $0x10,%esp
+  801e31:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  801e34:	53                   	push   %ebx
+  801e35:	e8 9b ea ff ff       	call   8008d5 <strlen>
+  801e3a:	83 c4 10             	add    $0x10,%esp
+  801e3d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801e42:	7f 42                	jg     801e86 <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  801e44:	83 ec 0c             	sub    $0xc,%esp
+  801e47:	68 04 70 80 00       	push   $0x807004
+  801e4c:	e8 5d 15 00 00       	call   8033ae <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  801e51:	83 c4 08             	add    $0x8,%esp
+  801e54:	53                   	push   %ebx
+  801e55:	68 00 80 80 00       	push   $0x808000
+  801e5a:	e8 b1 ea ff ff       	call   800910 <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  801e5f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e64:	b8 07 00 00 00       	mov    $0x7,%eax
+  801e69:	e8 b9 f9 ff ff       	call   801827 <fsipc>
+  801e6e:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801e70:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801e77:	e8 9f 15 00 00       	call   80341b <mutex_unlock>
+	return r;
+  801e7c:	83 c4 10             	add    $0x10,%esp
+}
+  801e7f:	89 d8                	mov    %ebx,%eax
+  801e81:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e84:	c9                   	leave
+  801e85:	c3                   	ret
+		return -E_BAD_PATH;
+  801e86:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801e8b:	eb f2                	jmp    801e7f <remove+0x55>
+
+00801e8d <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801e8d:	55                   	push   %ebp
+  801e8e:	89 e5                	mov    %esp,%ebp
+  801e90:	53                   	push   %ebx
+  801e91:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801e94:	68 04 70 80 00       	push   $0x807004
+  801e99:	e8 10 15 00 00       	call   8033ae <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  801e9e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ea3:	b8 08 00 00 00       	mov    $0x8,%eax
+  801ea8:	e8 7a f9 ff ff       	call   801827 <fsipc>
+  801ead:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801eaf:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801eb6:	e8 60 15 00 00       	call   80341b <mutex_unlock>
+	return r;
+}
+  801ebb:	89 d8                	mov    %ebx,%eax
+  801ebd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ec0:	c9                   	leave
+  801ec1:	c3                   	ret
+
+00801ec2 <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  801ec2:	55                   	push   %ebp
+  801ec3:	89 e5                	mov    %esp,%ebp
+  801ec5:	56                   	push   %esi
+  801ec6:	53                   	push   %ebx
+  801ec7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801eca:	83 ec 0c             	sub    $0xc,%esp
+  801ecd:	68 04 70 80 00       	push   $0x807004
+  801ed2:	e8 d7 14 00 00       	call   8033ae <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  801ed7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eda:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  801edf:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ee4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801ee9:	e8 39 f9 ff ff       	call   801827 <fsipc>
+  801eee:	89 c6                	mov    %eax,%esi
+  801ef0:	83 c4 10             	add    $0x10,%esp
+  801ef3:	85 db                	test   %ebx,%ebx
+  801ef5:	74 7b                	je     801f72 <fs_bcstat+0xb0>
+  801ef7:	85 c0                	test   %eax,%eax
+  801ef9:	78 77                	js     801f72 <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  801efb:	a1 00 80 80 00       	mov    0x808000,%eax
+  801f00:	89 03                	mov    %eax,(%ebx)
+  801f02:	a1 04 80 80 00       	mov    0x808004,%eax
+  801f07:	89 43 04             	mov    %eax,0x4(%ebx)
+  801f0a:	a1 08 80 80 00       	mov    0x808008,%eax
+  801f0f:	89 43 08             	mov    %eax,0x8(%ebx)
+  801f12:	a1 0c 80 80 00       	mov    0x80800c,%eax
+  801f17:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801f1a:	a1 10 80 80 00       	mov    0x808010,%eax
+  801f1f:	89 43 10             	mov    %eax,0x10(%ebx)
+  801f22:	a1 14 80 80 00       	mov    0x808014,%eax
+  801f27:	89 43 14             	mov    %eax,0x14(%ebx)
+  801f2a:	a1 18 80 80 00       	mov    0x808018,%eax
+  801f2f:	89 43 18             	mov    %eax,0x18(%ebx)
+  801f32:	a1 1c 80 80 00       	mov    0x80801c,%eax
+  801f37:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  801f3a:	a1 20 80 80 00       	mov    0x808020,%eax
+  801f3f:	89 43 20             	mov    %eax,0x20(%ebx)
+  801f42:	a1 24 80 80 00       	mov    0x808024,%eax
+  801f47:	89 43 24             	mov    %eax,0x24(%ebx)
+  801f4a:	a1 28 80 80 00       	mov    0x808028,%eax
+  801f4f:	89 43 28             	mov    %eax,0x28(%ebx)
+  801f52:	a1 2c 80 80 00       	mov    0x80802c,%eax
+  801f57:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  801f5a:	a1 30 80 80 00       	mov    0x808030,%eax
+  801f5f:	89 43 30             	mov    %eax,0x30(%ebx)
+  801f62:	a1 34 80 80 00       	mov    0x808034,%eax
+  801f67:	89 43 34             	mov    %eax,0x34(%ebx)
+  801f6a:	a1 38 80 80 00       	mov    0x808038,%eax
+  801f6f:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  801f72:	83 ec 0c             	sub    $0xc,%esp
+  801f75:	68 04 70 80 00       	push   $0x807004
+  801f7a:	e8 9c 14 00 00       	call   80341b <mutex_unlock>
+	return r;
+}
+  801f7f:	89 f0                	mov    %esi,%eax
+  801f81:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f84:	5b                   	pop    %ebx
+  801f85:	5e                   	pop    %esi
+  801f86:	5d                   	pop    %ebp
+  801f87:	c3                   	ret
+
+00801f88 <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  801f88:	55                   	push   %ebp
+  801f89:	89 e5                	mov    %esp,%ebp
+  801f8b:	56                   	push   %esi
+  801f8c:	53                   	push   %ebx
+  801f8d:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  801f8f:	0f b6 10             	movzbl (%eax),%edx
+  801f92:	80 fa 72             	cmp    $0x72,%dl
+  801f95:	74 44                	je     801fdb <parse_mode+0x53>
+  801f97:	80 fa 77             	cmp    $0x77,%dl
+  801f9a:	74 4b                	je     801fe7 <parse_mode+0x5f>
+  801f9c:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801fa1:	80 fa 61             	cmp    $0x61,%dl
+  801fa4:	74 09                	je     801faf <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  801fa6:	89 d8                	mov    %ebx,%eax
+  801fa8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fab:	5b                   	pop    %ebx
+  801fac:	5e                   	pop    %esi
+  801fad:	5d                   	pop    %ebp
+  801fae:	c3                   	ret
+	switch (mode[0]) {
+  801faf:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  801fb4:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  801fb9:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  801fbb:	83 ec 08             	sub    $0x8,%esp
+  801fbe:	6a 2b                	push   $0x2b
+  801fc0:	50                   	push   %eax
+  801fc1:	e8 5c ea ff ff       	call   800a22 <strchr>
+  801fc6:	83 c4 10             	add    $0x10,%esp
+  801fc9:	85 c0                	test   %eax,%eax
+  801fcb:	74 d9                	je     801fa6 <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  801fcd:	83 e3 fc             	and    $0xfffffffc,%ebx
+  801fd0:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  801fd3:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  801fd9:	eb cb                	jmp    801fa6 <parse_mode+0x1e>
+	switch (mode[0]) {
+  801fdb:	ba 01 00 00 00       	mov    $0x1,%edx
+  801fe0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801fe5:	eb d2                	jmp    801fb9 <parse_mode+0x31>
+  801fe7:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  801fec:	bb 01 03 00 00       	mov    $0x301,%ebx
+  801ff1:	eb c6                	jmp    801fb9 <parse_mode+0x31>
+
+00801ff3 <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  801ff3:	55                   	push   %ebp
+  801ff4:	89 e5                	mov    %esp,%ebp
+  801ff6:	57                   	push   %edi
+  801ff7:	56                   	push   %esi
+  801ff8:	53                   	push   %ebx
+  801ff9:	83 ec 1c             	sub    $0x1c,%esp
+  801ffc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801fff:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  802002:	b8 24 60 80 00       	mov    $0x806024,%eax
+  802007:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  80200c:	83 c0 24             	add    $0x24,%eax
+  80200f:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  802013:	74 17                	je     80202c <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  802015:	83 c3 01             	add    $0x1,%ebx
+  802018:	83 fb 10             	cmp    $0x10,%ebx
+  80201b:	75 ef                	jne    80200c <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  80201d:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  802022:	89 f0                	mov    %esi,%eax
+  802024:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802027:	5b                   	pop    %ebx
+  802028:	5e                   	pop    %esi
+  802029:	5f                   	pop    %edi
+  80202a:	5d                   	pop    %ebp
+  80202b:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  80202c:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  802033:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802036:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  802039:	c1 e7 02             	shl    $0x2,%edi
+  80203c:	8d b7 20 60 80 00    	lea    0x806020(%edi),%esi
+  802042:	83 ec 04             	sub    $0x4,%esp
+  802045:	6a 24                	push   $0x24
+  802047:	6a 00                	push   $0x0
+  802049:	56                   	push   %esi
+  80204a:	e8 12 ea ff ff       	call   800a61 <memset>
+			streams[i].f_fd = fd;
+  80204f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802052:	89 8f 20 60 80 00    	mov    %ecx,0x806020(%edi)
+			streams[i].f_flags = flags;
+  802058:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80205b:	01 d8                	add    %ebx,%eax
+  80205d:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802060:	89 0c 85 24 60 80 00 	mov    %ecx,0x806024(,%eax,4)
+			return &streams[i];
+  802067:	83 c4 10             	add    $0x10,%esp
+  80206a:	eb b6                	jmp    802022 <stream_alloc+0x2f>
+
+0080206c <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  80206c:	55                   	push   %ebp
+  80206d:	89 e5                	mov    %esp,%ebp
+  80206f:	53                   	push   %ebx
+  802070:	83 ec 14             	sub    $0x14,%esp
+  802073:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  802075:	8b 40 18             	mov    0x18(%eax),%eax
+  802078:	39 43 14             	cmp    %eax,0x14(%ebx)
+  80207b:	74 4a                	je     8020c7 <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  80207d:	83 ec 08             	sub    $0x8,%esp
+  802080:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802083:	50                   	push   %eax
+  802084:	ff 33                	push   (%ebx)
+  802086:	e8 e2 f1 ff ff       	call   80126d <fd_lookup>
+  80208b:	89 c2                	mov    %eax,%edx
+  80208d:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802090:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802095:	85 d2                	test   %edx,%edx
+  802097:	78 41                	js     8020da <stream_unread+0x6e>
+  802099:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80209c:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  8020a2:	39 0a                	cmp    %ecx,(%edx)
+  8020a4:	75 34                	jne    8020da <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  8020a6:	8b 43 14             	mov    0x14(%ebx),%eax
+  8020a9:	03 42 04             	add    0x4(%edx),%eax
+  8020ac:	2b 43 18             	sub    0x18(%ebx),%eax
+  8020af:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  8020b2:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  8020b9:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  8020c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8020c5:	eb 13                	jmp    8020da <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  8020c7:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  8020ce:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  8020d5:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8020da:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020dd:	c9                   	leave
+  8020de:	c3                   	ret
+
+008020df <stream_drain>:
+{
+  8020df:	55                   	push   %ebp
+  8020e0:	89 e5                	mov    %esp,%ebp
+  8020e2:	56                   	push   %esi
+  8020e3:	53                   	push   %ebx
+  8020e4:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  8020e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020eb:	eb 02                	jmp    8020ef <stream_drain+0x10>
+  8020ed:	01 c3                	add    %eax,%ebx
+  8020ef:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8020f2:	39 c3                	cmp    %eax,%ebx
+  8020f4:	73 43                	jae    802139 <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  8020f6:	83 ec 04             	sub    $0x4,%esp
+  8020f9:	29 d8                	sub    %ebx,%eax
+  8020fb:	50                   	push   %eax
+  8020fc:	89 d8                	mov    %ebx,%eax
+  8020fe:	03 46 0c             	add    0xc(%esi),%eax
+  802101:	50                   	push   %eax
+  802102:	ff 36                	push   (%esi)
+  802104:	e8 ec f4 ff ff       	call   8015f5 <write>
+  802109:	83 c4 10             	add    $0x10,%esp
+  80210c:	85 c0                	test   %eax,%eax
+  80210e:	7f dd                	jg     8020ed <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  802110:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  802114:	8b 56 0c             	mov    0xc(%esi),%edx
+  802117:	83 ec 04             	sub    $0x4,%esp
+  80211a:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80211d:	29 d8                	sub    %ebx,%eax
+  80211f:	50                   	push   %eax
+  802120:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  802123:	50                   	push   %eax
+  802124:	52                   	push   %edx
+  802125:	e8 6c e9 ff ff       	call   800a96 <memmove>
+			f->f_wend -= done;
+  80212a:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80212d:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  80212f:	83 c4 10             	add    $0x10,%esp
+  802132:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  802137:	eb 0a                	jmp    802143 <stream_drain+0x64>
+  802139:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  80213e:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  802143:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  802146:	89 d0                	mov    %edx,%eax
+  802148:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80214b:	5b                   	pop    %ebx
+  80214c:	5e                   	pop    %esi
+  80214d:	5d                   	pop    %ebp
+  80214e:	c3                   	ret
+
+0080214f <stream_setup>:
+	if (f->f_buf)
+  80214f:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802153:	74 01                	je     802156 <stream_setup+0x7>
+  802155:	c3                   	ret
+{
+  802156:	55                   	push   %ebp
+  802157:	89 e5                	mov    %esp,%ebp
+  802159:	53                   	push   %ebx
+  80215a:	83 ec 04             	sub    $0x4,%esp
+  80215d:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  80215f:	8b 40 08             	mov    0x8(%eax),%eax
+  802162:	85 c0                	test   %eax,%eax
+  802164:	74 17                	je     80217d <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  802166:	83 f8 03             	cmp    $0x3,%eax
+  802169:	75 2d                	jne    802198 <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  80216b:	8d 43 20             	lea    0x20(%ebx),%eax
+  80216e:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  802171:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  802178:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80217b:	c9                   	leave
+  80217c:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  80217d:	83 ec 0c             	sub    $0xc,%esp
+  802180:	ff 33                	push   (%ebx)
+  802182:	e8 29 1b 00 00       	call   803cb0 <iscons>
+  802187:	83 c4 10             	add    $0x10,%esp
+  80218a:	85 c0                	test   %eax,%eax
+  80218c:	0f 9f c0             	setg   %al
+  80218f:	0f b6 c0             	movzbl %al,%eax
+  802192:	83 c0 01             	add    $0x1,%eax
+  802195:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  802198:	83 ec 0c             	sub    $0xc,%esp
+  80219b:	68 00 10 00 00       	push   $0x1000
+  8021a0:	e8 6e 0b 00 00       	call   802d13 <malloc>
+  8021a5:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8021a8:	83 c4 10             	add    $0x10,%esp
+  8021ab:	85 c0                	test   %eax,%eax
+  8021ad:	74 bc                	je     80216b <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  8021af:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  8021b6:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  8021ba:	eb bc                	jmp    802178 <stream_setup+0x29>
+
+008021bc <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  8021bc:	55                   	push   %ebp
+  8021bd:	89 e5                	mov    %esp,%ebp
+  8021bf:	53                   	push   %ebx
+  8021c0:	83 ec 04             	sub    $0x4,%esp
+  8021c3:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  8021c5:	e8 85 ff ff ff       	call   80214f <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  8021ca:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  8021cf:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  8021d3:	74 3d                	je     802212 <stream_fill+0x56>
+  8021d5:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  8021d9:	74 10                	je     8021eb <stream_fill+0x2f>
+  8021db:	89 d8                	mov    %ebx,%eax
+  8021dd:	e8 fd fe ff ff       	call   8020df <stream_drain>
+		return 0;
+  8021e2:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  8021e7:	85 c0                	test   %eax,%eax
+  8021e9:	78 27                	js     802212 <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  8021eb:	83 ec 04             	sub    $0x4,%esp
+  8021ee:	ff 73 10             	push   0x10(%ebx)
+  8021f1:	ff 73 0c             	push   0xc(%ebx)
+  8021f4:	ff 33                	push   (%ebx)
+  8021f6:	e8 02 f3 ff ff       	call   8014fd <read>
+  8021fb:	83 c4 10             	add    $0x10,%esp
+  8021fe:	85 c0                	test   %eax,%eax
+  802200:	7e 17                	jle    802219 <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  802202:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  802206:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  80220d:	89 c2                	mov    %eax,%edx
+  80220f:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  802212:	89 d0                	mov    %edx,%eax
+  802214:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802217:	c9                   	leave
+  802218:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802219:	c1 f8 1f             	sar    $0x1f,%eax
+  80221c:	83 e0 04             	and    $0x4,%eax
+  80221f:	83 c0 04             	add    $0x4,%eax
+  802222:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  802225:	ba 00 00 00 00       	mov    $0x0,%edx
+  80222a:	eb e6                	jmp    802212 <stream_fill+0x56>
+
+0080222c <fopen>:
+{
+  80222c:	55                   	push   %ebp
+  80222d:	89 e5                	mov    %esp,%ebp
+  80222f:	57                   	push   %edi
+  802230:	56                   	push   %esi
+  802231:	53                   	push   %ebx
+  802232:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  802238:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  80223b:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  802241:	89 f0                	mov    %esi,%eax
+  802243:	e8 40 fd ff ff       	call   801f88 <parse_mode>
+		return 0;
+  802248:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  80224d:	85 c0                	test   %eax,%eax
+  80224f:	78 2d                	js     80227e <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  802251:	83 ec 08             	sub    $0x8,%esp
+  802254:	50                   	push   %eax
+  802255:	ff 75 08             	push   0x8(%ebp)
+  802258:	e8 e8 f8 ff ff       	call   801b45 <open>
+  80225d:	89 c7                	mov    %eax,%edi
+  80225f:	83 c4 10             	add    $0x10,%esp
+  802262:	85 c0                	test   %eax,%eax
+  802264:	78 58                	js     8022be <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  802266:	80 3e 61             	cmpb   $0x61,(%esi)
+  802269:	74 1d                	je     802288 <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  80226b:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  802271:	89 f8                	mov    %edi,%eax
+  802273:	e8 7b fd ff ff       	call   801ff3 <stream_alloc>
+  802278:	89 c3                	mov    %eax,%ebx
+  80227a:	85 c0                	test   %eax,%eax
+  80227c:	74 32                	je     8022b0 <fopen+0x84>
+}
+  80227e:	89 d8                	mov    %ebx,%eax
+  802280:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802283:	5b                   	pop    %ebx
+  802284:	5e                   	pop    %esi
+  802285:	5f                   	pop    %edi
+  802286:	5d                   	pop    %ebp
+  802287:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  802288:	83 ec 08             	sub    $0x8,%esp
+  80228b:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  802291:	50                   	push   %eax
+  802292:	57                   	push   %edi
+  802293:	e8 db f4 ff ff       	call   801773 <fstat>
+  802298:	83 c4 10             	add    $0x10,%esp
+  80229b:	85 c0                	test   %eax,%eax
+  80229d:	78 cc                	js     80226b <fopen+0x3f>
+		seek(fd, st.st_size);
+  80229f:	83 ec 08             	sub    $0x8,%esp
+  8022a2:	ff 75 dc             	push   -0x24(%ebp)
+  8022a5:	57                   	push   %edi
+  8022a6:	e8 f6 f3 ff ff       	call   8016a1 <seek>
+  8022ab:	83 c4 10             	add    $0x10,%esp
+  8022ae:	eb bb                	jmp    80226b <fopen+0x3f>
+		close(fd);
+  8022b0:	83 ec 0c             	sub    $0xc,%esp
+  8022b3:	57                   	push   %edi
+  8022b4:	e8 08 f1 ff ff       	call   8013c1 <close>
+  8022b9:	83 c4 10             	add    $0x10,%esp
+  8022bc:	eb c0                	jmp    80227e <fopen+0x52>
+		return 0;
+  8022be:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8022c3:	eb b9                	jmp    80227e <fopen+0x52>
+
+008022c5 <fdopen>:
+{
+  8022c5:	55                   	push   %ebp
+  8022c6:	89 e5                	mov    %esp,%ebp
+  8022c8:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  8022cb:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8022ce:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022d1:	e8 b2 fc ff ff       	call   801f88 <parse_mode>
+  8022d6:	89 c2                	mov    %eax,%edx
+		return 0;
+  8022d8:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  8022dd:	85 d2                	test   %edx,%edx
+  8022df:	78 0b                	js     8022ec <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  8022e1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8022e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022e7:	e8 07 fd ff ff       	call   801ff3 <stream_alloc>
+}
+  8022ec:	c9                   	leave
+  8022ed:	c3                   	ret
+
+008022ee <setvbuf>:
+{
+  8022ee:	55                   	push   %ebp
+  8022ef:	89 e5                	mov    %esp,%ebp
+  8022f1:	57                   	push   %edi
+  8022f2:	56                   	push   %esi
+  8022f3:	53                   	push   %ebx
+  8022f4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022f7:	8b 55 10             	mov    0x10(%ebp),%edx
+  8022fa:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  8022fd:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802301:	75 3a                	jne    80233d <setvbuf+0x4f>
+  802303:	8d 72 ff             	lea    -0x1(%edx),%esi
+  802306:	83 fe 02             	cmp    $0x2,%esi
+  802309:	77 39                	ja     802344 <setvbuf+0x56>
+	f->f_bufmode = mode;
+  80230b:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  80230e:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802312:	0f 95 c3             	setne  %bl
+  802315:	85 ff                	test   %edi,%edi
+  802317:	0f 95 c1             	setne  %cl
+  80231a:	84 cb                	test   %cl,%bl
+  80231c:	74 05                	je     802323 <setvbuf+0x35>
+  80231e:	83 fa 03             	cmp    $0x3,%edx
+  802321:	75 0a                	jne    80232d <setvbuf+0x3f>
+	return 0;
+  802323:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802328:	5b                   	pop    %ebx
+  802329:	5e                   	pop    %esi
+  80232a:	5f                   	pop    %edi
+  80232b:	5d                   	pop    %ebp
+  80232c:	c3                   	ret
+		f->f_buf = buf;
+  80232d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802330:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  802333:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  802336:	b8 00 00 00 00       	mov    $0x0,%eax
+  80233b:	eb eb                	jmp    802328 <setvbuf+0x3a>
+		return EOF;
+  80233d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802342:	eb e4                	jmp    802328 <setvbuf+0x3a>
+  802344:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802349:	eb dd                	jmp    802328 <setvbuf+0x3a>
+
+0080234b <fflush>:
+{
+  80234b:	55                   	push   %ebp
+  80234c:	89 e5                	mov    %esp,%ebp
+  80234e:	57                   	push   %edi
+  80234f:	56                   	push   %esi
+  802350:	53                   	push   %ebx
+  802351:	83 ec 0c             	sub    $0xc,%esp
+  802354:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  802357:	85 db                	test   %ebx,%ebx
+  802359:	74 1a                	je     802375 <fflush+0x2a>
+	stream_unread(f);
+  80235b:	89 d8                	mov    %ebx,%eax
+  80235d:	e8 0a fd ff ff       	call   80206c <stream_unread>
+	return stream_drain(f);
+  802362:	89 d8                	mov    %ebx,%eax
+  802364:	e8 76 fd ff ff       	call   8020df <stream_drain>
+  802369:	89 c7                	mov    %eax,%edi
+}
+  80236b:	89 f8                	mov    %edi,%eax
+  80236d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802370:	5b                   	pop    %ebx
+  802371:	5e                   	pop    %esi
+  802372:	5f                   	pop    %edi
+  802373:	5d                   	pop    %ebp
+  802374:	c3                   	ret
+  802375:	bb 20 60 80 00       	mov    $0x806020,%ebx
+  80237a:	be 60 62 80 00       	mov    $0x806260,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  80237f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802384:	eb 03                	jmp    802389 <fflush+0x3e>
+  802386:	83 c3 24             	add    $0x24,%ebx
+  802389:	39 f3                	cmp    %esi,%ebx
+  80238b:	74 de                	je     80236b <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  80238d:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  802391:	74 f3                	je     802386 <fflush+0x3b>
+  802393:	83 ec 0c             	sub    $0xc,%esp
+  802396:	53                   	push   %ebx
+  802397:	e8 af ff ff ff       	call   80234b <fflush>
+  80239c:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  80239f:	85 c0                	test   %eax,%eax
+  8023a1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8023a6:	0f 48 f8             	cmovs  %eax,%edi
+  8023a9:	eb db                	jmp    802386 <fflush+0x3b>
+
+008023ab <fclose>:
+{
+  8023ab:	55                   	push   %ebp
+  8023ac:	89 e5                	mov    %esp,%ebp
+  8023ae:	56                   	push   %esi
+  8023af:	53                   	push   %ebx
+  8023b0:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  8023b3:	83 ec 0c             	sub    $0xc,%esp
+  8023b6:	56                   	push   %esi
+  8023b7:	e8 8f ff ff ff       	call   80234b <fflush>
+  8023bc:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  8023be:	83 c4 04             	add    $0x4,%esp
+  8023c1:	ff 36                	push   (%esi)
+  8023c3:	e8 f9 ef ff ff       	call   8013c1 <close>
+  8023c8:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  8023cb:	85 c0                	test   %eax,%eax
+  8023cd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8023d2:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  8023d5:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  8023d9:	75 10                	jne    8023eb <fclose+0x40>
+	f->f_flags = 0;
+  8023db:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  8023e2:	89 d8                	mov    %ebx,%eax
+  8023e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023e7:	5b                   	pop    %ebx
+  8023e8:	5e                   	pop    %esi
+  8023e9:	5d                   	pop    %ebp
+  8023ea:	c3                   	ret
+		free(f->f_buf);
+  8023eb:	83 ec 0c             	sub    $0xc,%esp
+  8023ee:	ff 76 0c             	push   0xc(%esi)
+  8023f1:	e8 54 08 00 00       	call   802c4a <free>
+  8023f6:	83 c4 10             	add    $0x10,%esp
+  8023f9:	eb e0                	jmp    8023db <fclose+0x30>
+
+008023fb <fileno>:
+{
+  8023fb:	55                   	push   %ebp
+  8023fc:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  8023fe:	8b 45 08             	mov    0x8(%ebp),%eax
+  802401:	8b 00                	mov    (%eax),%eax
+}
+  802403:	5d                   	pop    %ebp
+  802404:	c3                   	ret
+
+00802405 <feof>:
+{
+  802405:	55                   	push   %ebp
+  802406:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  802408:	8b 45 08             	mov    0x8(%ebp),%eax
+  80240b:	8b 40 04             	mov    0x4(%eax),%eax
+  80240e:	c1 e8 02             	shr    $0x2,%eax
+  802411:	83 e0 01             	and    $0x1,%eax
+}
+  802414:	5d                   	pop    %ebp
+  802415:	c3                   	ret
+
+00802416 <ferror>:
+{
+  802416:	55                   	push   %ebp
+  802417:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  802419:	8b 45 08             	mov    0x8(%ebp),%eax
+  80241c:	8b 40 04             	mov    0x4(%eax),%eax
+  80241f:	c1 e8 03             	shr    $0x3,%eax
+  802422:	83 e0 01             	and    $0x1,%eax
+}
+  802425:	5d                   	pop    %ebp
+  802426:	c3                   	ret
+
+00802427 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  802427:	55                   	push   %ebp
+  802428:	89 e5                	mov    %esp,%ebp
+  80242a:	53                   	push   %ebx
+  80242b:	83 ec 04             	sub    $0x4,%esp
+  80242e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802431:	8b 43 18             	mov    0x18(%ebx),%eax
+  802434:	39 43 14             	cmp    %eax,0x14(%ebx)
+  802437:	74 15                	je     80244e <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  802439:	8b 53 0c             	mov    0xc(%ebx),%edx
+  80243c:	8b 43 14             	mov    0x14(%ebx),%eax
+  80243f:	8d 48 01             	lea    0x1(%eax),%ecx
+  802442:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  802445:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  802449:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80244c:	c9                   	leave
+  80244d:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  80244e:	89 d8                	mov    %ebx,%eax
+  802450:	e8 67 fd ff ff       	call   8021bc <stream_fill>
+  802455:	85 c0                	test   %eax,%eax
+  802457:	75 e0                	jne    802439 <fgetc+0x12>
+		return EOF;
+  802459:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80245e:	eb e9                	jmp    802449 <fgetc+0x22>
+
+00802460 <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  802460:	55                   	push   %ebp
+  802461:	89 e5                	mov    %esp,%ebp
+  802463:	57                   	push   %edi
+  802464:	56                   	push   %esi
+  802465:	53                   	push   %ebx
+  802466:	83 ec 1c             	sub    $0x1c,%esp
+  802469:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  80246c:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802471:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802474:	83 e8 01             	sub    $0x1,%eax
+  802477:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  80247a:	eb 66                	jmp    8024e2 <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  80247c:	8b 46 14             	mov    0x14(%esi),%eax
+  80247f:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802482:	29 c3                	sub    %eax,%ebx
+  802484:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802487:	29 fa                	sub    %edi,%edx
+  802489:	39 d3                	cmp    %edx,%ebx
+  80248b:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  80248e:	83 ec 04             	sub    $0x4,%esp
+  802491:	53                   	push   %ebx
+  802492:	6a 0a                	push   $0xa
+  802494:	03 46 0c             	add    0xc(%esi),%eax
+  802497:	50                   	push   %eax
+  802498:	e8 aa e6 ff ff       	call   800b47 <memfind>
+  80249d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  8024a0:	8b 46 0c             	mov    0xc(%esi),%eax
+  8024a3:	8b 4e 14             	mov    0x14(%esi),%ecx
+  8024a6:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  8024a9:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  8024ab:	83 c4 10             	add    $0x10,%esp
+  8024ae:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  8024b1:	74 0b                	je     8024be <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  8024b3:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8024b6:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8024b9:	29 d3                	sub    %edx,%ebx
+  8024bb:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  8024be:	83 ec 04             	sub    $0x4,%esp
+  8024c1:	53                   	push   %ebx
+  8024c2:	01 c8                	add    %ecx,%eax
+  8024c4:	50                   	push   %eax
+  8024c5:	89 f8                	mov    %edi,%eax
+  8024c7:	03 45 08             	add    0x8(%ebp),%eax
+  8024ca:	50                   	push   %eax
+  8024cb:	e8 c6 e5 ff ff       	call   800a96 <memmove>
+		f->f_rpos += m;
+  8024d0:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  8024d3:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  8024d5:	83 c4 10             	add    $0x10,%esp
+  8024d8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024db:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  8024e0:	74 1f                	je     802501 <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  8024e2:	8d 47 01             	lea    0x1(%edi),%eax
+  8024e5:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  8024e8:	73 17                	jae    802501 <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8024ea:	8b 46 18             	mov    0x18(%esi),%eax
+  8024ed:	39 46 14             	cmp    %eax,0x14(%esi)
+  8024f0:	75 8a                	jne    80247c <fgets+0x1c>
+  8024f2:	89 f0                	mov    %esi,%eax
+  8024f4:	e8 c3 fc ff ff       	call   8021bc <stream_fill>
+  8024f9:	85 c0                	test   %eax,%eax
+  8024fb:	0f 85 7b ff ff ff    	jne    80247c <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  802501:	85 ff                	test   %edi,%edi
+  802503:	74 0f                	je     802514 <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  802505:	8b 45 08             	mov    0x8(%ebp),%eax
+  802508:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  80250c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80250f:	5b                   	pop    %ebx
+  802510:	5e                   	pop    %esi
+  802511:	5f                   	pop    %edi
+  802512:	5d                   	pop    %ebp
+  802513:	c3                   	ret
+		return 0;
+  802514:	b8 00 00 00 00       	mov    $0x0,%eax
+  802519:	eb f1                	jmp    80250c <fgets+0xac>
+
+0080251b <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  80251b:	55                   	push   %ebp
+  80251c:	89 e5                	mov    %esp,%ebp
+  80251e:	57                   	push   %edi
+  80251f:	56                   	push   %esi
+  802520:	53                   	push   %ebx
+  802521:	83 ec 1c             	sub    $0x1c,%esp
+  802524:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  802527:	89 f0                	mov    %esi,%eax
+  802529:	e8 21 fc ff ff       	call   80214f <stream_setup>
+	want = size * n;
+  80252e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802531:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802535:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  802538:	bf 00 00 00 00       	mov    $0x0,%edi
+  80253d:	eb 43                	jmp    802582 <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  80253f:	29 d3                	sub    %edx,%ebx
+  802541:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802544:	29 f8                	sub    %edi,%eax
+  802546:	39 c3                	cmp    %eax,%ebx
+  802548:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  80254b:	83 ec 04             	sub    $0x4,%esp
+  80254e:	53                   	push   %ebx
+  80254f:	03 56 0c             	add    0xc(%esi),%edx
+  802552:	52                   	push   %edx
+  802553:	89 f8                	mov    %edi,%eax
+  802555:	03 45 08             	add    0x8(%ebp),%eax
+  802558:	50                   	push   %eax
+  802559:	e8 38 e5 ff ff       	call   800a96 <memmove>
+			f->f_rpos += m;
+  80255e:	01 5e 14             	add    %ebx,0x14(%esi)
+  802561:	83 c4 10             	add    $0x10,%esp
+  802564:	eb 1a                	jmp    802580 <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  802566:	83 ec 04             	sub    $0x4,%esp
+  802569:	53                   	push   %ebx
+  80256a:	89 f8                	mov    %edi,%eax
+  80256c:	03 45 08             	add    0x8(%ebp),%eax
+  80256f:	50                   	push   %eax
+  802570:	ff 36                	push   (%esi)
+  802572:	e8 86 ef ff ff       	call   8014fd <read>
+  802577:	89 c3                	mov    %eax,%ebx
+  802579:	83 c4 10             	add    $0x10,%esp
+  80257c:	85 c0                	test   %eax,%eax
+  80257e:	7e 36                	jle    8025b6 <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  802580:	01 df                	add    %ebx,%edi
+  802582:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802585:	39 c7                	cmp    %eax,%edi
+  802587:	73 39                	jae    8025c2 <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  802589:	8b 56 14             	mov    0x14(%esi),%edx
+  80258c:	8b 5e 18             	mov    0x18(%esi),%ebx
+  80258f:	39 da                	cmp    %ebx,%edx
+  802591:	72 ac                	jb     80253f <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  802593:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802596:	29 fb                	sub    %edi,%ebx
+  802598:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  80259b:	72 3e                	jb     8025db <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  80259d:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  8025a1:	74 1f                	je     8025c2 <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  8025a3:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  8025a7:	74 bd                	je     802566 <fread+0x4b>
+  8025a9:	89 f0                	mov    %esi,%eax
+  8025ab:	e8 2f fb ff ff       	call   8020df <stream_drain>
+  8025b0:	85 c0                	test   %eax,%eax
+  8025b2:	79 b2                	jns    802566 <fread+0x4b>
+  8025b4:	eb 0c                	jmp    8025c2 <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  8025b6:	c1 fb 1f             	sar    $0x1f,%ebx
+  8025b9:	83 e3 04             	and    $0x4,%ebx
+  8025bc:	83 c3 04             	add    $0x4,%ebx
+  8025bf:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  8025c2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025c5:	85 c0                	test   %eax,%eax
+  8025c7:	74 0a                	je     8025d3 <fread+0xb8>
+  8025c9:	89 f8                	mov    %edi,%eax
+  8025cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025d0:	f7 75 0c             	divl   0xc(%ebp)
+}
+  8025d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025d6:	5b                   	pop    %ebx
+  8025d7:	5e                   	pop    %esi
+  8025d8:	5f                   	pop    %edi
+  8025d9:	5d                   	pop    %ebp
+  8025da:	c3                   	ret
+		} else if (!stream_fill(f))
+  8025db:	89 f0                	mov    %esi,%eax
+  8025dd:	e8 da fb ff ff       	call   8021bc <stream_fill>
+  8025e2:	85 c0                	test   %eax,%eax
+  8025e4:	74 dc                	je     8025c2 <fread+0xa7>
+			m = 0;
+  8025e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025eb:	eb 93                	jmp    802580 <fread+0x65>
+
+008025ed <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  8025ed:	55                   	push   %ebp
+  8025ee:	89 e5                	mov    %esp,%ebp
+  8025f0:	57                   	push   %edi
+  8025f1:	56                   	push   %esi
+  8025f2:	53                   	push   %ebx
+  8025f3:	83 ec 1c             	sub    $0x1c,%esp
+  8025f6:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  8025f9:	8b 43 04             	mov    0x4(%ebx),%eax
+  8025fc:	a8 02                	test   $0x2,%al
+  8025fe:	75 13                	jne    802613 <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  802600:	83 c8 08             	or     $0x8,%eax
+  802603:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  802606:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  80260b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80260e:	5b                   	pop    %ebx
+  80260f:	5e                   	pop    %esi
+  802610:	5f                   	pop    %edi
+  802611:	5d                   	pop    %ebp
+  802612:	c3                   	ret
+	stream_setup(f);
+  802613:	89 d8                	mov    %ebx,%eax
+  802615:	e8 35 fb ff ff       	call   80214f <stream_setup>
+	want = size * n;
+  80261a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80261d:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802621:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  802624:	89 d8                	mov    %ebx,%eax
+  802626:	e8 41 fa ff ff       	call   80206c <stream_unread>
+	for (done = 0; done < want; ) {
+  80262b:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  802630:	84 c0                	test   %al,%al
+  802632:	75 7b                	jne    8026af <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  802634:	be 00 00 00 00       	mov    $0x0,%esi
+  802639:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80263c:	39 fe                	cmp    %edi,%esi
+  80263e:	73 24                	jae    802664 <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802640:	83 ec 04             	sub    $0x4,%esp
+  802643:	89 f8                	mov    %edi,%eax
+  802645:	29 f0                	sub    %esi,%eax
+  802647:	50                   	push   %eax
+  802648:	89 f0                	mov    %esi,%eax
+  80264a:	03 45 08             	add    0x8(%ebp),%eax
+  80264d:	50                   	push   %eax
+  80264e:	ff 33                	push   (%ebx)
+  802650:	e8 a0 ef ff ff       	call   8015f5 <write>
+  802655:	83 c4 10             	add    $0x10,%esp
+  802658:	85 c0                	test   %eax,%eax
+  80265a:	7e 04                	jle    802660 <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  80265c:	01 c6                	add    %eax,%esi
+  80265e:	eb dc                	jmp    80263c <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  802660:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  802664:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802667:	85 c0                	test   %eax,%eax
+  802669:	74 a0                	je     80260b <fwrite+0x1e>
+  80266b:	89 f0                	mov    %esi,%eax
+  80266d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802672:	f7 75 0c             	divl   0xc(%ebp)
+  802675:	eb 94                	jmp    80260b <fwrite+0x1e>
+			done += r;
+  802677:	01 c7                	add    %eax,%edi
+			continue;
+  802679:	eb 34                	jmp    8026af <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  80267b:	8b 73 10             	mov    0x10(%ebx),%esi
+  80267e:	29 c6                	sub    %eax,%esi
+  802680:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802683:	29 fa                	sub    %edi,%edx
+  802685:	39 d6                	cmp    %edx,%esi
+  802687:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  80268a:	83 ec 04             	sub    $0x4,%esp
+  80268d:	56                   	push   %esi
+  80268e:	89 fa                	mov    %edi,%edx
+  802690:	03 55 08             	add    0x8(%ebp),%edx
+  802693:	52                   	push   %edx
+  802694:	03 43 0c             	add    0xc(%ebx),%eax
+  802697:	50                   	push   %eax
+  802698:	e8 f9 e3 ff ff       	call   800a96 <memmove>
+		f->f_wend += m;
+  80269d:	89 f0                	mov    %esi,%eax
+  80269f:	03 43 1c             	add    0x1c(%ebx),%eax
+  8026a2:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  8026a5:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  8026a7:	83 c4 10             	add    $0x10,%esp
+  8026aa:	3b 43 10             	cmp    0x10(%ebx),%eax
+  8026ad:	74 5b                	je     80270a <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  8026af:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8026b2:	39 c7                	cmp    %eax,%edi
+  8026b4:	73 2d                	jae    8026e3 <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  8026b6:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8026b9:	85 c0                	test   %eax,%eax
+  8026bb:	75 be                	jne    80267b <fwrite+0x8e>
+  8026bd:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8026c0:	29 fa                	sub    %edi,%edx
+  8026c2:	3b 53 10             	cmp    0x10(%ebx),%edx
+  8026c5:	72 b4                	jb     80267b <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  8026c7:	83 ec 04             	sub    $0x4,%esp
+  8026ca:	52                   	push   %edx
+  8026cb:	89 f8                	mov    %edi,%eax
+  8026cd:	03 45 08             	add    0x8(%ebp),%eax
+  8026d0:	50                   	push   %eax
+  8026d1:	ff 33                	push   (%ebx)
+  8026d3:	e8 1d ef ff ff       	call   8015f5 <write>
+  8026d8:	83 c4 10             	add    $0x10,%esp
+  8026db:	85 c0                	test   %eax,%eax
+  8026dd:	7f 98                	jg     802677 <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  8026df:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  8026e3:	8b 43 08             	mov    0x8(%ebx),%eax
+  8026e6:	83 f8 03             	cmp    $0x3,%eax
+  8026e9:	74 48                	je     802733 <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  8026eb:	83 f8 02             	cmp    $0x2,%eax
+  8026ee:	74 27                	je     802717 <fwrite+0x12a>
+	return size ? done / size : 0;
+  8026f0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8026f3:	85 c0                	test   %eax,%eax
+  8026f5:	0f 84 10 ff ff ff    	je     80260b <fwrite+0x1e>
+  8026fb:	89 f8                	mov    %edi,%eax
+  8026fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  802702:	f7 75 0c             	divl   0xc(%ebp)
+  802705:	e9 01 ff ff ff       	jmp    80260b <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  80270a:	89 d8                	mov    %ebx,%eax
+  80270c:	e8 ce f9 ff ff       	call   8020df <stream_drain>
+  802711:	85 c0                	test   %eax,%eax
+  802713:	79 9a                	jns    8026af <fwrite+0xc2>
+  802715:	eb cc                	jmp    8026e3 <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802717:	83 ec 04             	sub    $0x4,%esp
+  80271a:	57                   	push   %edi
+  80271b:	6a 0a                	push   $0xa
+  80271d:	ff 75 08             	push   0x8(%ebp)
+  802720:	e8 22 e4 ff ff       	call   800b47 <memfind>
+  802725:	89 c2                	mov    %eax,%edx
+  802727:	89 f8                	mov    %edi,%eax
+  802729:	03 45 08             	add    0x8(%ebp),%eax
+  80272c:	83 c4 10             	add    $0x10,%esp
+  80272f:	39 c2                	cmp    %eax,%edx
+  802731:	74 bd                	je     8026f0 <fwrite+0x103>
+		stream_drain(f);
+  802733:	89 d8                	mov    %ebx,%eax
+  802735:	e8 a5 f9 ff ff       	call   8020df <stream_drain>
+  80273a:	eb b4                	jmp    8026f0 <fwrite+0x103>
+
+0080273c <fputc>:
+{
+  80273c:	55                   	push   %ebp
+  80273d:	89 e5                	mov    %esp,%ebp
+  80273f:	53                   	push   %ebx
+  802740:	83 ec 14             	sub    $0x14,%esp
+  802743:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  802746:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  802749:	ff 75 0c             	push   0xc(%ebp)
+  80274c:	6a 01                	push   $0x1
+  80274e:	6a 01                	push   $0x1
+  802750:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802753:	50                   	push   %eax
+  802754:	e8 94 fe ff ff       	call   8025ed <fwrite>
+  802759:	83 c4 10             	add    $0x10,%esp
+  80275c:	0f b6 db             	movzbl %bl,%ebx
+  80275f:	83 f8 01             	cmp    $0x1,%eax
+  802762:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802767:	0f 44 c3             	cmove  %ebx,%eax
+}
+  80276a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80276d:	c9                   	leave
+  80276e:	c3                   	ret
+
+0080276f <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  80276f:	55                   	push   %ebp
+  802770:	89 e5                	mov    %esp,%ebp
+  802772:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  802775:	ff 75 0c             	push   0xc(%ebp)
+  802778:	ff 75 08             	push   0x8(%ebp)
+  80277b:	e8 bc ff ff ff       	call   80273c <fputc>
+}
+  802780:	83 c4 10             	add    $0x10,%esp
+  802783:	c9                   	leave
+  802784:	c3                   	ret
+
+00802785 <fputs>:
+{
+  802785:	55                   	push   %ebp
+  802786:	89 e5                	mov    %esp,%ebp
+  802788:	56                   	push   %esi
+  802789:	53                   	push   %ebx
+  80278a:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  80278d:	83 ec 0c             	sub    $0xc,%esp
+  802790:	56                   	push   %esi
+  802791:	e8 3f e1 ff ff       	call   8008d5 <strlen>
+  802796:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  802798:	ff 75 0c             	push   0xc(%ebp)
+  80279b:	50                   	push   %eax
+  80279c:	6a 01                	push   $0x1
+  80279e:	56                   	push   %esi
+  80279f:	e8 49 fe ff ff       	call   8025ed <fwrite>
+  8027a4:	83 c4 20             	add    $0x20,%esp
+  8027a7:	39 d8                	cmp    %ebx,%eax
+  8027a9:	0f 95 c0             	setne  %al
+  8027ac:	0f b6 c0             	movzbl %al,%eax
+  8027af:	f7 d8                	neg    %eax
+}
+  8027b1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027b4:	5b                   	pop    %ebx
+  8027b5:	5e                   	pop    %esi
+  8027b6:	5d                   	pop    %ebp
+  8027b7:	c3                   	ret
+
+008027b8 <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  8027b8:	55                   	push   %ebp
+  8027b9:	89 e5                	mov    %esp,%ebp
+  8027bb:	53                   	push   %ebx
+  8027bc:	83 ec 04             	sub    $0x4,%esp
+  8027bf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8027c2:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  8027c5:	50                   	push   %eax
+  8027c6:	ff 75 0c             	push   0xc(%ebp)
+  8027c9:	53                   	push   %ebx
+  8027ca:	68 6f 27 80 00       	push   $0x80276f
+  8027cf:	e8 4f dc ff ff       	call   800423 <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  8027d4:	8b 43 04             	mov    0x4(%ebx),%eax
+  8027d7:	c1 e0 1c             	shl    $0x1c,%eax
+  8027da:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  8027dd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027e0:	c9                   	leave
+  8027e1:	c3                   	ret
+
+008027e2 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8027e2:	55                   	push   %ebp
+  8027e3:	89 e5                	mov    %esp,%ebp
+  8027e5:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8027e8:	68 98 4d 80 00       	push   $0x804d98
+  8027ed:	ff 75 0c             	push   0xc(%ebp)
+  8027f0:	e8 1b e1 ff ff       	call   800910 <strcpy>
+	return 0;
+}
+  8027f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027fa:	c9                   	leave
+  8027fb:	c3                   	ret
+
+008027fc <devsock_close>:
+{
+  8027fc:	55                   	push   %ebp
+  8027fd:	89 e5                	mov    %esp,%ebp
+  8027ff:	53                   	push   %ebx
+  802800:	83 ec 10             	sub    $0x10,%esp
+  802803:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802806:	53                   	push   %ebx
+  802807:	e8 23 1d 00 00       	call   80452f <pageref>
+  80280c:	89 c2                	mov    %eax,%edx
+  80280e:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802811:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802816:	83 fa 01             	cmp    $0x1,%edx
+  802819:	74 05                	je     802820 <devsock_close+0x24>
+}
+  80281b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80281e:	c9                   	leave
+  80281f:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802820:	83 ec 0c             	sub    $0xc,%esp
+  802823:	ff 73 0c             	push   0xc(%ebx)
+  802826:	e8 b7 02 00 00       	call   802ae2 <nsipc_close>
+  80282b:	83 c4 10             	add    $0x10,%esp
+  80282e:	eb eb                	jmp    80281b <devsock_close+0x1f>
+
+00802830 <devsock_write>:
+{
+  802830:	55                   	push   %ebp
+  802831:	89 e5                	mov    %esp,%ebp
+  802833:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802836:	6a 00                	push   $0x0
+  802838:	ff 75 10             	push   0x10(%ebp)
+  80283b:	ff 75 0c             	push   0xc(%ebp)
+  80283e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802841:	ff 70 0c             	push   0xc(%eax)
+  802844:	e8 79 03 00 00       	call   802bc2 <nsipc_send>
+}
+  802849:	c9                   	leave
+  80284a:	c3                   	ret
+
+0080284b <devsock_read>:
+{
+  80284b:	55                   	push   %ebp
+  80284c:	89 e5                	mov    %esp,%ebp
+  80284e:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802851:	6a 00                	push   $0x0
+  802853:	ff 75 10             	push   0x10(%ebp)
+  802856:	ff 75 0c             	push   0xc(%ebp)
+  802859:	8b 45 08             	mov    0x8(%ebp),%eax
+  80285c:	ff 70 0c             	push   0xc(%eax)
+  80285f:	e8 ef 02 00 00       	call   802b53 <nsipc_recv>
+}
+  802864:	c9                   	leave
+  802865:	c3                   	ret
+
+00802866 <fd2sockid>:
+{
+  802866:	55                   	push   %ebp
+  802867:	89 e5                	mov    %esp,%ebp
+  802869:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  80286c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80286f:	52                   	push   %edx
+  802870:	50                   	push   %eax
+  802871:	e8 f7 e9 ff ff       	call   80126d <fd_lookup>
+  802876:	83 c4 10             	add    $0x10,%esp
+  802879:	85 c0                	test   %eax,%eax
+  80287b:	78 10                	js     80288d <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  80287d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802880:	8b 0d 60 62 80 00    	mov    0x806260,%ecx
+  802886:	39 08                	cmp    %ecx,(%eax)
+  802888:	75 05                	jne    80288f <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  80288a:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  80288d:	c9                   	leave
+  80288e:	c3                   	ret
+		return -E_NOT_SUPP;
+  80288f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802894:	eb f7                	jmp    80288d <fd2sockid+0x27>
+
+00802896 <alloc_sockfd>:
+{
+  802896:	55                   	push   %ebp
+  802897:	89 e5                	mov    %esp,%ebp
+  802899:	56                   	push   %esi
+  80289a:	53                   	push   %ebx
+  80289b:	83 ec 1c             	sub    $0x1c,%esp
+  80289e:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8028a0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8028a3:	50                   	push   %eax
+  8028a4:	e8 6e e9 ff ff       	call   801217 <fd_alloc>
+  8028a9:	89 c3                	mov    %eax,%ebx
+  8028ab:	83 c4 10             	add    $0x10,%esp
+  8028ae:	85 c0                	test   %eax,%eax
+  8028b0:	78 43                	js     8028f5 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8028b2:	83 ec 04             	sub    $0x4,%esp
+  8028b5:	68 07 04 00 00       	push   $0x407
+  8028ba:	ff 75 f4             	push   -0xc(%ebp)
+  8028bd:	6a 00                	push   $0x0
+  8028bf:	e8 8a e4 ff ff       	call   800d4e <sys_page_alloc>
+  8028c4:	89 c3                	mov    %eax,%ebx
+  8028c6:	83 c4 10             	add    $0x10,%esp
+  8028c9:	85 c0                	test   %eax,%eax
+  8028cb:	78 28                	js     8028f5 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8028cd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028d0:	8b 15 60 62 80 00    	mov    0x806260,%edx
+  8028d6:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8028d8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028db:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8028e2:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8028e5:	83 ec 0c             	sub    $0xc,%esp
+  8028e8:	50                   	push   %eax
+  8028e9:	e8 02 e9 ff ff       	call   8011f0 <fd2num>
+  8028ee:	89 c3                	mov    %eax,%ebx
+  8028f0:	83 c4 10             	add    $0x10,%esp
+  8028f3:	eb 0c                	jmp    802901 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8028f5:	83 ec 0c             	sub    $0xc,%esp
+  8028f8:	56                   	push   %esi
+  8028f9:	e8 e4 01 00 00       	call   802ae2 <nsipc_close>
+		return r;
+  8028fe:	83 c4 10             	add    $0x10,%esp
+}
+  802901:	89 d8                	mov    %ebx,%eax
+  802903:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802906:	5b                   	pop    %ebx
+  802907:	5e                   	pop    %esi
+  802908:	5d                   	pop    %ebp
+  802909:	c3                   	ret
+
+0080290a <accept>:
+{
+  80290a:	55                   	push   %ebp
+  80290b:	89 e5                	mov    %esp,%ebp
+  80290d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802910:	8b 45 08             	mov    0x8(%ebp),%eax
+  802913:	e8 4e ff ff ff       	call   802866 <fd2sockid>
+  802918:	85 c0                	test   %eax,%eax
+  80291a:	78 1b                	js     802937 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  80291c:	83 ec 04             	sub    $0x4,%esp
+  80291f:	ff 75 10             	push   0x10(%ebp)
+  802922:	ff 75 0c             	push   0xc(%ebp)
+  802925:	50                   	push   %eax
+  802926:	e8 0e 01 00 00       	call   802a39 <nsipc_accept>
+  80292b:	83 c4 10             	add    $0x10,%esp
+  80292e:	85 c0                	test   %eax,%eax
+  802930:	78 05                	js     802937 <accept+0x2d>
+	return alloc_sockfd(r);
+  802932:	e8 5f ff ff ff       	call   802896 <alloc_sockfd>
+}
+  802937:	c9                   	leave
+  802938:	c3                   	ret
+
+00802939 <bind>:
+{
+  802939:	55                   	push   %ebp
+  80293a:	89 e5                	mov    %esp,%ebp
+  80293c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80293f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802942:	e8 1f ff ff ff       	call   802866 <fd2sockid>
+  802947:	85 c0                	test   %eax,%eax
+  802949:	78 12                	js     80295d <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80294b:	83 ec 04             	sub    $0x4,%esp
+  80294e:	ff 75 10             	push   0x10(%ebp)
+  802951:	ff 75 0c             	push   0xc(%ebp)
+  802954:	50                   	push   %eax
+  802955:	e8 31 01 00 00       	call   802a8b <nsipc_bind>
+  80295a:	83 c4 10             	add    $0x10,%esp
+}
+  80295d:	c9                   	leave
+  80295e:	c3                   	ret
+
+0080295f <shutdown>:
+{
+  80295f:	55                   	push   %ebp
+  802960:	89 e5                	mov    %esp,%ebp
+  802962:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802965:	8b 45 08             	mov    0x8(%ebp),%eax
+  802968:	e8 f9 fe ff ff       	call   802866 <fd2sockid>
+  80296d:	85 c0                	test   %eax,%eax
+  80296f:	78 0f                	js     802980 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802971:	83 ec 08             	sub    $0x8,%esp
+  802974:	ff 75 0c             	push   0xc(%ebp)
+  802977:	50                   	push   %eax
+  802978:	e8 43 01 00 00       	call   802ac0 <nsipc_shutdown>
+  80297d:	83 c4 10             	add    $0x10,%esp
+}
+  802980:	c9                   	leave
+  802981:	c3                   	ret
+
+00802982 <connect>:
+{
+  802982:	55                   	push   %ebp
+  802983:	89 e5                	mov    %esp,%ebp
+  802985:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802988:	8b 45 08             	mov    0x8(%ebp),%eax
+  80298b:	e8 d6 fe ff ff       	call   802866 <fd2sockid>
+  802990:	85 c0                	test   %eax,%eax
+  802992:	78 12                	js     8029a6 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802994:	83 ec 04             	sub    $0x4,%esp
+  802997:	ff 75 10             	push   0x10(%ebp)
+  80299a:	ff 75 0c             	push   0xc(%ebp)
+  80299d:	50                   	push   %eax
+  80299e:	e8 59 01 00 00       	call   802afc <nsipc_connect>
+  8029a3:	83 c4 10             	add    $0x10,%esp
+}
+  8029a6:	c9                   	leave
+  8029a7:	c3                   	ret
+
+008029a8 <listen>:
+{
+  8029a8:	55                   	push   %ebp
+  8029a9:	89 e5                	mov    %esp,%ebp
+  8029ab:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8029ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029b1:	e8 b0 fe ff ff       	call   802866 <fd2sockid>
+  8029b6:	85 c0                	test   %eax,%eax
+  8029b8:	78 0f                	js     8029c9 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8029ba:	83 ec 08             	sub    $0x8,%esp
+  8029bd:	ff 75 0c             	push   0xc(%ebp)
+  8029c0:	50                   	push   %eax
+  8029c1:	e8 6b 01 00 00       	call   802b31 <nsipc_listen>
+  8029c6:	83 c4 10             	add    $0x10,%esp
+}
+  8029c9:	c9                   	leave
+  8029ca:	c3                   	ret
+
+008029cb <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8029cb:	55                   	push   %ebp
+  8029cc:	89 e5                	mov    %esp,%ebp
+  8029ce:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8029d1:	ff 75 10             	push   0x10(%ebp)
+  8029d4:	ff 75 0c             	push   0xc(%ebp)
+  8029d7:	ff 75 08             	push   0x8(%ebp)
+  8029da:	e8 41 02 00 00       	call   802c20 <nsipc_socket>
+  8029df:	83 c4 10             	add    $0x10,%esp
+  8029e2:	85 c0                	test   %eax,%eax
+  8029e4:	78 05                	js     8029eb <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8029e6:	e8 ab fe ff ff       	call   802896 <alloc_sockfd>
+}
+  8029eb:	c9                   	leave
+  8029ec:	c3                   	ret
+
+008029ed <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8029ed:	55                   	push   %ebp
+  8029ee:	89 e5                	mov    %esp,%ebp
+  8029f0:	53                   	push   %ebx
+  8029f1:	83 ec 04             	sub    $0x4,%esp
+  8029f4:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8029f6:	83 3d 08 70 80 00 00 	cmpl   $0x0,0x807008
+  8029fd:	74 26                	je     802a25 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8029ff:	6a 07                	push   $0x7
+  802a01:	68 00 90 80 00       	push   $0x809000
+  802a06:	53                   	push   %ebx
+  802a07:	ff 35 08 70 80 00    	push   0x807008
+  802a0d:	e8 88 1a 00 00       	call   80449a <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802a12:	83 c4 0c             	add    $0xc,%esp
+  802a15:	6a 00                	push   $0x0
+  802a17:	6a 00                	push   $0x0
+  802a19:	6a 00                	push   $0x0
+  802a1b:	e8 84 19 00 00       	call   8043a4 <ipc_recv>
+}
+  802a20:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a23:	c9                   	leave
+  802a24:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802a25:	83 ec 0c             	sub    $0xc,%esp
+  802a28:	6a 02                	push   $0x2
+  802a2a:	e8 c1 1a 00 00       	call   8044f0 <ipc_find_env>
+  802a2f:	a3 08 70 80 00       	mov    %eax,0x807008
+  802a34:	83 c4 10             	add    $0x10,%esp
+  802a37:	eb c6                	jmp    8029ff <nsipc+0x12>
+
+00802a39 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802a39:	55                   	push   %ebp
+  802a3a:	89 e5                	mov    %esp,%ebp
+  802a3c:	56                   	push   %esi
+  802a3d:	53                   	push   %ebx
+  802a3e:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802a41:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a44:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802a49:	8b 06                	mov    (%esi),%eax
+  802a4b:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802a50:	b8 01 00 00 00       	mov    $0x1,%eax
+  802a55:	e8 93 ff ff ff       	call   8029ed <nsipc>
+  802a5a:	89 c3                	mov    %eax,%ebx
+  802a5c:	85 c0                	test   %eax,%eax
+  802a5e:	79 09                	jns    802a69 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802a60:	89 d8                	mov    %ebx,%eax
+  802a62:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a65:	5b                   	pop    %ebx
+  802a66:	5e                   	pop    %esi
+  802a67:	5d                   	pop    %ebp
+  802a68:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802a69:	83 ec 04             	sub    $0x4,%esp
+  802a6c:	ff 35 10 90 80 00    	push   0x809010
+  802a72:	68 00 90 80 00       	push   $0x809000
+  802a77:	ff 75 0c             	push   0xc(%ebp)
+  802a7a:	e8 17 e0 ff ff       	call   800a96 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802a7f:	a1 10 90 80 00       	mov    0x809010,%eax
+  802a84:	89 06                	mov    %eax,(%esi)
+  802a86:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802a89:	eb d5                	jmp    802a60 <nsipc_accept+0x27>
+
+00802a8b <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802a8b:	55                   	push   %ebp
+  802a8c:	89 e5                	mov    %esp,%ebp
+  802a8e:	53                   	push   %ebx
+  802a8f:	83 ec 08             	sub    $0x8,%esp
+  802a92:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802a95:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a98:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802a9d:	53                   	push   %ebx
+  802a9e:	ff 75 0c             	push   0xc(%ebp)
+  802aa1:	68 04 90 80 00       	push   $0x809004
+  802aa6:	e8 eb df ff ff       	call   800a96 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802aab:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  802ab1:	b8 02 00 00 00       	mov    $0x2,%eax
+  802ab6:	e8 32 ff ff ff       	call   8029ed <nsipc>
+}
+  802abb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802abe:	c9                   	leave
+  802abf:	c3                   	ret
+
+00802ac0 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802ac0:	55                   	push   %ebp
+  802ac1:	89 e5                	mov    %esp,%ebp
+  802ac3:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802ac6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ac9:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  802ace:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ad1:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  802ad6:	b8 03 00 00 00       	mov    $0x3,%eax
+  802adb:	e8 0d ff ff ff       	call   8029ed <nsipc>
+}
+  802ae0:	c9                   	leave
+  802ae1:	c3                   	ret
+
+00802ae2 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802ae2:	55                   	push   %ebp
+  802ae3:	89 e5                	mov    %esp,%ebp
+  802ae5:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802ae8:	8b 45 08             	mov    0x8(%ebp),%eax
+  802aeb:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  802af0:	b8 04 00 00 00       	mov    $0x4,%eax
+  802af5:	e8 f3 fe ff ff       	call   8029ed <nsipc>
+}
+  802afa:	c9                   	leave
+  802afb:	c3                   	ret
+
+00802afc <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802afc:	55                   	push   %ebp
+  802afd:	89 e5                	mov    %esp,%ebp
+  802aff:	53                   	push   %ebx
+  802b00:	83 ec 08             	sub    $0x8,%esp
+  802b03:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802b06:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b09:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802b0e:	53                   	push   %ebx
+  802b0f:	ff 75 0c             	push   0xc(%ebp)
+  802b12:	68 04 90 80 00       	push   $0x809004
+  802b17:	e8 7a df ff ff       	call   800a96 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802b1c:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  802b22:	b8 05 00 00 00       	mov    $0x5,%eax
+  802b27:	e8 c1 fe ff ff       	call   8029ed <nsipc>
+}
+  802b2c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b2f:	c9                   	leave
+  802b30:	c3                   	ret
+
+00802b31 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802b31:	55                   	push   %ebp
+  802b32:	89 e5                	mov    %esp,%ebp
+  802b34:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802b37:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b3a:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  802b3f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b42:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  802b47:	b8 06 00 00 00       	mov    $0x6,%eax
+  802b4c:	e8 9c fe ff ff       	call   8029ed <nsipc>
+}
+  802b51:	c9                   	leave
+  802b52:	c3                   	ret
+
+00802b53 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802b53:	55                   	push   %ebp
+  802b54:	89 e5                	mov    %esp,%ebp
+  802b56:	56                   	push   %esi
+  802b57:	53                   	push   %ebx
+  802b58:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802b5b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b5e:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  802b63:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  802b69:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b6c:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802b71:	b8 07 00 00 00       	mov    $0x7,%eax
+  802b76:	e8 72 fe ff ff       	call   8029ed <nsipc>
+  802b7b:	89 c3                	mov    %eax,%ebx
+  802b7d:	85 c0                	test   %eax,%eax
+  802b7f:	78 22                	js     802ba3 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802b81:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802b86:	39 c6                	cmp    %eax,%esi
+  802b88:	0f 4e c6             	cmovle %esi,%eax
+  802b8b:	39 c3                	cmp    %eax,%ebx
+  802b8d:	7f 1d                	jg     802bac <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802b8f:	83 ec 04             	sub    $0x4,%esp
+  802b92:	53                   	push   %ebx
+  802b93:	68 00 90 80 00       	push   $0x809000
+  802b98:	ff 75 0c             	push   0xc(%ebp)
+  802b9b:	e8 f6 de ff ff       	call   800a96 <memmove>
+  802ba0:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802ba3:	89 d8                	mov    %ebx,%eax
+  802ba5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ba8:	5b                   	pop    %ebx
+  802ba9:	5e                   	pop    %esi
+  802baa:	5d                   	pop    %ebp
+  802bab:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802bac:	68 a4 4d 80 00       	push   $0x804da4
+  802bb1:	68 5d 4d 80 00       	push   $0x804d5d
+  802bb6:	6a 62                	push   $0x62
+  802bb8:	68 b9 4d 80 00       	push   $0x804db9
+  802bbd:	e8 8f d6 ff ff       	call   800251 <_panic>
+
+00802bc2 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802bc2:	55                   	push   %ebp
+  802bc3:	89 e5                	mov    %esp,%ebp
+  802bc5:	53                   	push   %ebx
+  802bc6:	83 ec 04             	sub    $0x4,%esp
+  802bc9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802bcc:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bcf:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  802bd4:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802bda:	7f 2e                	jg     802c0a <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802bdc:	83 ec 04             	sub    $0x4,%esp
+  802bdf:	53                   	push   %ebx
+  802be0:	ff 75 0c             	push   0xc(%ebp)
+  802be3:	68 0c 90 80 00       	push   $0x80900c
+  802be8:	e8 a9 de ff ff       	call   800a96 <memmove>
+	nsipcbuf.send.req_size = size;
+  802bed:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  802bf3:	8b 45 14             	mov    0x14(%ebp),%eax
+  802bf6:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  802bfb:	b8 08 00 00 00       	mov    $0x8,%eax
+  802c00:	e8 e8 fd ff ff       	call   8029ed <nsipc>
+}
+  802c05:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c08:	c9                   	leave
+  802c09:	c3                   	ret
+	assert(size < 1600);
+  802c0a:	68 c5 4d 80 00       	push   $0x804dc5
+  802c0f:	68 5d 4d 80 00       	push   $0x804d5d
+  802c14:	6a 6d                	push   $0x6d
+  802c16:	68 b9 4d 80 00       	push   $0x804db9
+  802c1b:	e8 31 d6 ff ff       	call   800251 <_panic>
+
+00802c20 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802c20:	55                   	push   %ebp
+  802c21:	89 e5                	mov    %esp,%ebp
+  802c23:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802c26:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c29:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  802c2e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c31:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  802c36:	8b 45 10             	mov    0x10(%ebp),%eax
+  802c39:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  802c3e:	b8 09 00 00 00       	mov    $0x9,%eax
+  802c43:	e8 a5 fd ff ff       	call   8029ed <nsipc>
+}
+  802c48:	c9                   	leave
+  802c49:	c3                   	ret
+
+00802c4a <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  802c4a:	55                   	push   %ebp
+  802c4b:	89 e5                	mov    %esp,%ebp
+  802c4d:	53                   	push   %ebx
+  802c4e:	83 ec 10             	sub    $0x10,%esp
+  802c51:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  802c54:	68 0c 70 80 00       	push   $0x80700c
+  802c59:	e8 50 07 00 00       	call   8033ae <mutex_lock>
+	if (v == 0)
+  802c5e:	83 c4 10             	add    $0x10,%esp
+  802c61:	85 db                	test   %ebx,%ebx
+  802c63:	0f 84 85 00 00 00    	je     802cee <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802c69:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802c6f:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802c74:	77 51                	ja     802cc7 <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  802c76:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  802c7c:	89 d8                	mov    %ebx,%eax
+  802c7e:	c1 e8 0c             	shr    $0xc,%eax
+  802c81:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802c88:	f6 c4 02             	test   $0x2,%ah
+  802c8b:	74 50                	je     802cdd <free+0x93>
+		sys_page_unmap(0, c);
+  802c8d:	83 ec 08             	sub    $0x8,%esp
+  802c90:	53                   	push   %ebx
+  802c91:	6a 00                	push   $0x0
+  802c93:	e8 4f e1 ff ff       	call   800de7 <sys_page_unmap>
+		c += PGSIZE;
+  802c98:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  802c9e:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802ca4:	83 c4 10             	add    $0x10,%esp
+  802ca7:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802cac:	76 ce                	jbe    802c7c <free+0x32>
+  802cae:	68 0f 4e 80 00       	push   $0x804e0f
+  802cb3:	68 5d 4d 80 00       	push   $0x804d5d
+  802cb8:	68 82 00 00 00       	push   $0x82
+  802cbd:	68 02 4e 80 00       	push   $0x804e02
+  802cc2:	e8 8a d5 ff ff       	call   800251 <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802cc7:	68 d4 4d 80 00       	push   $0x804dd4
+  802ccc:	68 5d 4d 80 00       	push   $0x804d5d
+  802cd1:	6a 7b                	push   $0x7b
+  802cd3:	68 02 4e 80 00       	push   $0x804e02
+  802cd8:	e8 74 d5 ff ff       	call   800251 <_panic>
+	if (--(*ref) == 0)
+  802cdd:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  802ce3:	83 e8 01             	sub    $0x1,%eax
+  802ce6:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  802cec:	74 15                	je     802d03 <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  802cee:	83 ec 0c             	sub    $0xc,%esp
+  802cf1:	68 0c 70 80 00       	push   $0x80700c
+  802cf6:	e8 20 07 00 00       	call   80341b <mutex_unlock>
+}
+  802cfb:	83 c4 10             	add    $0x10,%esp
+  802cfe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d01:	c9                   	leave
+  802d02:	c3                   	ret
+		sys_page_unmap(0, c);
+  802d03:	83 ec 08             	sub    $0x8,%esp
+  802d06:	53                   	push   %ebx
+  802d07:	6a 00                	push   $0x0
+  802d09:	e8 d9 e0 ff ff       	call   800de7 <sys_page_unmap>
+  802d0e:	83 c4 10             	add    $0x10,%esp
+  802d11:	eb db                	jmp    802cee <free+0xa4>
+
+00802d13 <malloc>:
+{
+  802d13:	55                   	push   %ebp
+  802d14:	89 e5                	mov    %esp,%ebp
+  802d16:	57                   	push   %edi
+  802d17:	56                   	push   %esi
+  802d18:	53                   	push   %ebx
+  802d19:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  802d1c:	68 0c 70 80 00       	push   $0x80700c
+  802d21:	e8 88 06 00 00       	call   8033ae <mutex_lock>
+	if (mptr == 0)
+  802d26:	8b 3d 10 70 80 00    	mov    0x807010,%edi
+  802d2c:	83 c4 10             	add    $0x10,%esp
+  802d2f:	85 ff                	test   %edi,%edi
+  802d31:	74 6c                	je     802d9f <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  802d33:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d36:	83 c0 03             	add    $0x3,%eax
+  802d39:	83 e0 fc             	and    $0xfffffffc,%eax
+  802d3c:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  802d3e:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  802d43:	0f 87 64 01 00 00    	ja     802ead <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  802d49:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  802d4f:	74 30                	je     802d81 <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  802d51:	89 f9                	mov    %edi,%ecx
+  802d53:	c1 e9 0c             	shr    $0xc,%ecx
+  802d56:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  802d5a:	c1 e8 0c             	shr    $0xc,%eax
+  802d5d:	39 c1                	cmp    %eax,%ecx
+  802d5f:	74 5f                	je     802dc0 <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  802d61:	83 ec 0c             	sub    $0xc,%esp
+  802d64:	57                   	push   %edi
+  802d65:	e8 e0 fe ff ff       	call   802c4a <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  802d6a:	a1 10 70 80 00       	mov    0x807010,%eax
+  802d6f:	05 00 10 00 00       	add    $0x1000,%eax
+  802d74:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802d79:	a3 10 70 80 00       	mov    %eax,0x807010
+  802d7e:	83 c4 10             	add    $0x10,%esp
+  802d81:	8b 0d 10 70 80 00    	mov    0x807010,%ecx
+{
+  802d87:	ba 02 00 00 00       	mov    $0x2,%edx
+  802d8c:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  802d90:	8d 7e 04             	lea    0x4(%esi),%edi
+  802d93:	89 cb                	mov    %ecx,%ebx
+  802d95:	01 f9                	add    %edi,%ecx
+  802d97:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802d9a:	e9 8b 00 00 00       	jmp    802e2a <malloc+0x117>
+		mptr = mbegin;
+  802d9f:	c7 05 10 70 80 00 00 	movl   $0x8000000,0x807010
+  802da6:	00 00 08 
+	n = ROUNDUP(n, 4);
+  802da9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dac:	83 c0 03             	add    $0x3,%eax
+  802daf:	83 e0 fc             	and    $0xfffffffc,%eax
+  802db2:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  802db4:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  802db9:	76 c6                	jbe    802d81 <malloc+0x6e>
+  802dbb:	e9 d6 00 00 00       	jmp    802e96 <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  802dc0:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802dc6:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  802dcb:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  802dcf:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  802dd2:	a3 10 70 80 00       	mov    %eax,0x807010
+			return v;
+  802dd7:	e9 ba 00 00 00       	jmp    802e96 <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  802ddc:	05 00 10 00 00       	add    $0x1000,%eax
+  802de1:	39 c8                	cmp    %ecx,%eax
+  802de3:	0f 83 cb 00 00 00    	jae    802eb4 <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  802de9:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  802dee:	77 22                	ja     802e12 <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  802df0:	89 c2                	mov    %eax,%edx
+  802df2:	c1 ea 16             	shr    $0x16,%edx
+  802df5:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802dfc:	f6 c2 01             	test   $0x1,%dl
+  802dff:	74 db                	je     802ddc <malloc+0xc9>
+  802e01:	89 c2                	mov    %eax,%edx
+  802e03:	c1 ea 0c             	shr    $0xc,%edx
+  802e06:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802e0d:	f6 c2 01             	test   $0x1,%dl
+  802e10:	74 ca                	je     802ddc <malloc+0xc9>
+		if (mptr == mend) {
+  802e12:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802e18:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  802e1e:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  802e22:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  802e28:	74 04                	je     802e2e <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  802e2a:	89 d8                	mov    %ebx,%eax
+  802e2c:	eb b3                	jmp    802de1 <malloc+0xce>
+  802e2e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  802e31:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  802e36:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  802e3a:	83 ea 01             	sub    $0x1,%edx
+  802e3d:	0f 85 50 ff ff ff    	jne    802d93 <malloc+0x80>
+  802e43:	c7 05 10 70 80 00 00 	movl   $0x8000000,0x807010
+  802e4a:	00 00 08 
+				return 0;	/* out of address space */
+  802e4d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e52:	eb 42                	jmp    802e96 <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  802e54:	85 db                	test   %ebx,%ebx
+  802e56:	78 1e                	js     802e76 <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  802e58:	83 ec 08             	sub    $0x8,%esp
+  802e5b:	89 d8                	mov    %ebx,%eax
+  802e5d:	03 05 10 70 80 00    	add    0x807010,%eax
+  802e63:	50                   	push   %eax
+  802e64:	6a 00                	push   $0x0
+  802e66:	e8 7c df ff ff       	call   800de7 <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  802e6b:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  802e71:	83 c4 10             	add    $0x10,%esp
+  802e74:	eb de                	jmp    802e54 <malloc+0x141>
+			return 0;	/* out of physical memory */
+  802e76:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e7b:	eb 19                	jmp    802e96 <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  802e7d:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802e80:	8b 3d 10 70 80 00    	mov    0x807010,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  802e86:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  802e8d:	00 
+	mptr += n;
+  802e8e:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  802e91:	a3 10 70 80 00       	mov    %eax,0x807010
+	mutex_unlock(&malloc_mu);
+  802e96:	83 ec 0c             	sub    $0xc,%esp
+  802e99:	68 0c 70 80 00       	push   $0x80700c
+  802e9e:	e8 78 05 00 00       	call   80341b <mutex_unlock>
+}
+  802ea3:	89 f8                	mov    %edi,%eax
+  802ea5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ea8:	5b                   	pop    %ebx
+  802ea9:	5e                   	pop    %esi
+  802eaa:	5f                   	pop    %edi
+  802eab:	5d                   	pop    %ebp
+  802eac:	c3                   	ret
+		return 0;
+  802ead:	bf 00 00 00 00       	mov    $0x0,%edi
+  802eb2:	eb e2                	jmp    802e96 <malloc+0x183>
+  802eb4:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  802eb8:	74 06                	je     802ec0 <malloc+0x1ad>
+  802eba:	89 1d 10 70 80 00    	mov    %ebx,0x807010
+	for (i = 0; i < n + 4; i += PGSIZE){
+  802ec0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ec5:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  802ec8:	39 fb                	cmp    %edi,%ebx
+  802eca:	73 b1                	jae    802e7d <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  802ecc:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  802ed2:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  802ed5:	39 fe                	cmp    %edi,%esi
+  802ed7:	0f 92 c0             	setb   %al
+  802eda:	0f b6 c0             	movzbl %al,%eax
+  802edd:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  802ee0:	83 c8 07             	or     $0x7,%eax
+  802ee3:	50                   	push   %eax
+  802ee4:	89 d8                	mov    %ebx,%eax
+  802ee6:	03 05 10 70 80 00    	add    0x807010,%eax
+  802eec:	50                   	push   %eax
+  802eed:	6a 00                	push   $0x0
+  802eef:	e8 5a de ff ff       	call   800d4e <sys_page_alloc>
+  802ef4:	83 c4 10             	add    $0x10,%esp
+  802ef7:	85 c0                	test   %eax,%eax
+  802ef9:	0f 88 55 ff ff ff    	js     802e54 <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  802eff:	89 f3                	mov    %esi,%ebx
+  802f01:	eb c5                	jmp    802ec8 <malloc+0x1b5>
+
+00802f03 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802f03:	55                   	push   %ebp
+  802f04:	89 e5                	mov    %esp,%ebp
+  802f06:	56                   	push   %esi
+  802f07:	53                   	push   %ebx
+  802f08:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802f0b:	83 ec 0c             	sub    $0xc,%esp
+  802f0e:	ff 75 08             	push   0x8(%ebp)
+  802f11:	e8 ea e2 ff ff       	call   801200 <fd2data>
+  802f16:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802f18:	83 c4 08             	add    $0x8,%esp
+  802f1b:	68 27 4e 80 00       	push   $0x804e27
+  802f20:	53                   	push   %ebx
+  802f21:	e8 ea d9 ff ff       	call   800910 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802f26:	8b 46 04             	mov    0x4(%esi),%eax
+  802f29:	2b 06                	sub    (%esi),%eax
+  802f2b:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802f31:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802f38:	00 00 00 
+	stat->st_dev = &devpipe;
+  802f3b:	c7 83 88 00 00 00 7c 	movl   $0x80627c,0x88(%ebx)
+  802f42:	62 80 00 
+	return 0;
+}
+  802f45:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f4a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f4d:	5b                   	pop    %ebx
+  802f4e:	5e                   	pop    %esi
+  802f4f:	5d                   	pop    %ebp
+  802f50:	c3                   	ret
+
+00802f51 <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  802f51:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f56:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  802f5a:	85 c9                	test   %ecx,%ecx
+  802f5c:	75 01                	jne    802f5f <pipewake+0xe>
+  802f5e:	c3                   	ret
+{
+  802f5f:	55                   	push   %ebp
+  802f60:	89 e5                	mov    %esp,%ebp
+  802f62:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  802f65:	68 00 04 00 00       	push   $0x400
+  802f6a:	52                   	push   %edx
+  802f6b:	e8 22 e1 ff ff       	call   801092 <sys_futex_wake>
+  802f70:	83 c4 10             	add    $0x10,%esp
+}
+  802f73:	c9                   	leave
+  802f74:	c3                   	ret
+
+00802f75 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802f75:	55                   	push   %ebp
+  802f76:	89 e5                	mov    %esp,%ebp
+  802f78:	56                   	push   %esi
+  802f79:	53                   	push   %ebx
+  802f7a:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802f7d:	83 ec 0c             	sub    $0xc,%esp
+  802f80:	56                   	push   %esi
+  802f81:	e8 7a e2 ff ff       	call   801200 <fd2data>
+  802f86:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  802f88:	83 c4 08             	add    $0x8,%esp
+  802f8b:	56                   	push   %esi
+  802f8c:	6a 00                	push   $0x0
+  802f8e:	e8 54 de ff ff       	call   800de7 <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  802f93:	8d 53 04             	lea    0x4(%ebx),%edx
+  802f96:	8d 43 08             	lea    0x8(%ebx),%eax
+  802f99:	e8 b3 ff ff ff       	call   802f51 <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  802f9e:	8d 43 0c             	lea    0xc(%ebx),%eax
+  802fa1:	89 da                	mov    %ebx,%edx
+  802fa3:	e8 a9 ff ff ff       	call   802f51 <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  802fa8:	89 34 24             	mov    %esi,(%esp)
+  802fab:	e8 50 e2 ff ff       	call   801200 <fd2data>
+  802fb0:	83 c4 08             	add    $0x8,%esp
+  802fb3:	50                   	push   %eax
+  802fb4:	6a 00                	push   $0x0
+  802fb6:	e8 2c de ff ff       	call   800de7 <sys_page_unmap>
+}
+  802fbb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802fbe:	5b                   	pop    %ebx
+  802fbf:	5e                   	pop    %esi
+  802fc0:	5d                   	pop    %ebp
+  802fc1:	c3                   	ret
+
+00802fc2 <_pipeisclosed>:
+{
+  802fc2:	55                   	push   %ebp
+  802fc3:	89 e5                	mov    %esp,%ebp
+  802fc5:	57                   	push   %edi
+  802fc6:	56                   	push   %esi
+  802fc7:	53                   	push   %ebx
+  802fc8:	83 ec 1c             	sub    $0x1c,%esp
+  802fcb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802fce:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802fd0:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  802fd5:	eb 5d                	jmp    803034 <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  802fd7:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		n = thisenv->env_runs;
+  802fdd:	8b 02                	mov    (%edx),%eax
+  802fdf:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802fe2:	83 ec 0c             	sub    $0xc,%esp
+  802fe5:	ff 75 e0             	push   -0x20(%ebp)
+  802fe8:	e8 42 15 00 00       	call   80452f <pageref>
+  802fed:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802ff0:	89 3c 24             	mov    %edi,(%esp)
+  802ff3:	e8 37 15 00 00       	call   80452f <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  802ff8:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802ffa:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  803000:	83 c4 10             	add    $0x10,%esp
+  803003:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803009:	77 15                	ja     803020 <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80300b:	89 f2                	mov    %esi,%edx
+  80300d:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  80300f:	c1 ea 10             	shr    $0x10,%edx
+  803012:	74 0c                	je     803020 <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803014:	c1 e2 10             	shl    $0x10,%edx
+  803017:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80301c:	29 d1                	sub    %edx,%ecx
+  80301e:	eb 06                	jmp    803026 <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  803020:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		nn = thisenv->env_runs;
+  803026:	8b 11                	mov    (%ecx),%edx
+  803028:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  80302b:	39 d3                	cmp    %edx,%ebx
+  80302d:	74 6e                	je     80309d <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  80302f:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803032:	74 24                	je     803058 <_pipeisclosed+0x96>
+  803034:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803036:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80303c:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803041:	77 94                	ja     802fd7 <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803043:	89 f0                	mov    %esi,%eax
+  803045:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803047:	c1 e8 10             	shr    $0x10,%eax
+  80304a:	74 8b                	je     802fd7 <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80304c:	c1 e0 10             	shl    $0x10,%eax
+  80304f:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803054:	29 c2                	sub    %eax,%edx
+  803056:	eb 85                	jmp    802fdd <_pipeisclosed+0x1b>
+  803058:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80305a:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803060:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803065:	77 18                	ja     80307f <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803067:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80306c:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80306e:	c1 e8 10             	shr    $0x10,%eax
+  803071:	74 0c                	je     80307f <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803073:	c1 e0 10             	shl    $0x10,%eax
+  803076:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80307b:	29 c2                	sub    %eax,%edx
+  80307d:	eb 06                	jmp    803085 <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  80307f:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803085:	8b 02                	mov    (%edx),%eax
+  803087:	8b 40 58             	mov    0x58(%eax),%eax
+  80308a:	6a 01                	push   $0x1
+  80308c:	50                   	push   %eax
+  80308d:	53                   	push   %ebx
+  80308e:	68 2e 4e 80 00       	push   $0x804e2e
+  803093:	e8 94 d2 ff ff       	call   80032c <cprintf>
+  803098:	83 c4 10             	add    $0x10,%esp
+  80309b:	eb 97                	jmp    803034 <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  80309d:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8030a0:	0f 94 c0             	sete   %al
+  8030a3:	0f b6 c0             	movzbl %al,%eax
+}
+  8030a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030a9:	5b                   	pop    %ebx
+  8030aa:	5e                   	pop    %esi
+  8030ab:	5f                   	pop    %edi
+  8030ac:	5d                   	pop    %ebp
+  8030ad:	c3                   	ret
+
+008030ae <devpipe_write>:
+{
+  8030ae:	55                   	push   %ebp
+  8030af:	89 e5                	mov    %esp,%ebp
+  8030b1:	57                   	push   %edi
+  8030b2:	56                   	push   %esi
+  8030b3:	53                   	push   %ebx
+  8030b4:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  8030b7:	ff 75 08             	push   0x8(%ebp)
+  8030ba:	e8 41 e1 ff ff       	call   801200 <fd2data>
+  8030bf:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8030c1:	83 c4 10             	add    $0x10,%esp
+  8030c4:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  8030cb:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  8030ce:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8030d1:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8030d4:	0f 84 96 00 00 00    	je     803170 <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  8030da:	8d 73 08             	lea    0x8(%ebx),%esi
+  8030dd:	eb 32                	jmp    803111 <devpipe_write+0x63>
+  8030df:	89 fa                	mov    %edi,%edx
+  8030e1:	89 f0                	mov    %esi,%eax
+  8030e3:	e8 69 fe ff ff       	call   802f51 <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  8030e8:	8b 43 04             	mov    0x4(%ebx),%eax
+  8030eb:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  8030ee:	ba 01 00 00 00       	mov    $0x1,%edx
+  8030f3:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  8030f8:	83 ec 04             	sub    $0x4,%esp
+  8030fb:	6a 0a                	push   $0xa
+  8030fd:	50                   	push   %eax
+  8030fe:	53                   	push   %ebx
+  8030ff:	e8 5f df ff ff       	call   801063 <sys_futex_wait>
+  803104:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803109:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  80310e:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  803111:	8b 43 04             	mov    0x4(%ebx),%eax
+  803114:	8b 0b                	mov    (%ebx),%ecx
+  803116:	8d 51 20             	lea    0x20(%ecx),%edx
+  803119:	39 d0                	cmp    %edx,%eax
+  80311b:	72 1b                	jb     803138 <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  80311d:	89 da                	mov    %ebx,%edx
+  80311f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803122:	e8 9b fe ff ff       	call   802fc2 <_pipeisclosed>
+  803127:	85 c0                	test   %eax,%eax
+  803129:	74 b4                	je     8030df <devpipe_write+0x31>
+				return 0;
+  80312b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803130:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803133:	5b                   	pop    %ebx
+  803134:	5e                   	pop    %esi
+  803135:	5f                   	pop    %edi
+  803136:	5d                   	pop    %ebp
+  803137:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803138:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80313b:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80313e:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  803142:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  803145:	89 c2                	mov    %eax,%edx
+  803147:	c1 fa 1f             	sar    $0x1f,%edx
+  80314a:	89 d1                	mov    %edx,%ecx
+  80314c:	c1 e9 1b             	shr    $0x1b,%ecx
+  80314f:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  803152:	83 e2 1f             	and    $0x1f,%edx
+  803155:	29 ca                	sub    %ecx,%edx
+  803157:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  80315b:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  80315f:	83 c0 01             	add    $0x1,%eax
+  803162:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  803165:	83 c6 01             	add    $0x1,%esi
+  803168:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  80316b:	e9 5e ff ff ff       	jmp    8030ce <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  803170:	8d 53 04             	lea    0x4(%ebx),%edx
+  803173:	8d 43 08             	lea    0x8(%ebx),%eax
+  803176:	e8 d6 fd ff ff       	call   802f51 <pipewake>
+	return i;
+  80317b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80317e:	eb b0                	jmp    803130 <devpipe_write+0x82>
+
+00803180 <devpipe_read>:
+{
+  803180:	55                   	push   %ebp
+  803181:	89 e5                	mov    %esp,%ebp
+  803183:	57                   	push   %edi
+  803184:	56                   	push   %esi
+  803185:	53                   	push   %ebx
+  803186:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  803189:	ff 75 08             	push   0x8(%ebp)
+  80318c:	e8 6f e0 ff ff       	call   801200 <fd2data>
+  803191:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803193:	83 c4 10             	add    $0x10,%esp
+  803196:	be 00 00 00 00       	mov    $0x0,%esi
+  80319b:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80319e:	74 6c                	je     80320c <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  8031a0:	8d 7b 04             	lea    0x4(%ebx),%edi
+  8031a3:	eb 25                	jmp    8031ca <devpipe_read+0x4a>
+  8031a5:	8b 13                	mov    (%ebx),%edx
+  8031a7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8031ac:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  8031b1:	83 ec 04             	sub    $0x4,%esp
+  8031b4:	6a 0a                	push   $0xa
+  8031b6:	52                   	push   %edx
+  8031b7:	57                   	push   %edi
+  8031b8:	e8 a6 de ff ff       	call   801063 <sys_futex_wait>
+  8031bd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8031c2:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  8031c7:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  8031ca:	8b 03                	mov    (%ebx),%eax
+  8031cc:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8031cf:	75 19                	jne    8031ea <devpipe_read+0x6a>
+			if (i > 0)
+  8031d1:	85 f6                	test   %esi,%esi
+  8031d3:	75 3a                	jne    80320f <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  8031d5:	89 da                	mov    %ebx,%edx
+  8031d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031da:	e8 e3 fd ff ff       	call   802fc2 <_pipeisclosed>
+  8031df:	85 c0                	test   %eax,%eax
+  8031e1:	74 c2                	je     8031a5 <devpipe_read+0x25>
+				return 0;
+  8031e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031e8:	eb 31                	jmp    80321b <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8031ea:	89 c1                	mov    %eax,%ecx
+  8031ec:	c1 f9 1f             	sar    $0x1f,%ecx
+  8031ef:	c1 e9 1b             	shr    $0x1b,%ecx
+  8031f2:	01 c8                	add    %ecx,%eax
+  8031f4:	83 e0 1f             	and    $0x1f,%eax
+  8031f7:	29 c8                	sub    %ecx,%eax
+  8031f9:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  8031fe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803201:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  803204:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  803207:	83 c6 01             	add    $0x1,%esi
+  80320a:	eb 8f                	jmp    80319b <devpipe_read+0x1b>
+out:
+  80320c:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  80320f:	8d 43 0c             	lea    0xc(%ebx),%eax
+  803212:	89 da                	mov    %ebx,%edx
+  803214:	e8 38 fd ff ff       	call   802f51 <pipewake>
+	return i;
+  803219:	89 f0                	mov    %esi,%eax
+}
+  80321b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80321e:	5b                   	pop    %ebx
+  80321f:	5e                   	pop    %esi
+  803220:	5f                   	pop    %edi
+  803221:	5d                   	pop    %ebp
+  803222:	c3                   	ret
+
+00803223 <pipe>:
+{
+  803223:	55                   	push   %ebp
+  803224:	89 e5                	mov    %esp,%ebp
+  803226:	56                   	push   %esi
+  803227:	53                   	push   %ebx
+  803228:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80322b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80322e:	50                   	push   %eax
+  80322f:	e8 e3 df ff ff       	call   801217 <fd_alloc>
+  803234:	89 c3                	mov    %eax,%ebx
+  803236:	83 c4 10             	add    $0x10,%esp
+  803239:	85 c0                	test   %eax,%eax
+  80323b:	0f 88 23 01 00 00    	js     803364 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803241:	83 ec 04             	sub    $0x4,%esp
+  803244:	68 07 04 00 00       	push   $0x407
+  803249:	ff 75 f4             	push   -0xc(%ebp)
+  80324c:	6a 00                	push   $0x0
+  80324e:	e8 fb da ff ff       	call   800d4e <sys_page_alloc>
+  803253:	89 c3                	mov    %eax,%ebx
+  803255:	83 c4 10             	add    $0x10,%esp
+  803258:	85 c0                	test   %eax,%eax
+  80325a:	0f 88 04 01 00 00    	js     803364 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803260:	83 ec 0c             	sub    $0xc,%esp
+  803263:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803266:	50                   	push   %eax
+  803267:	e8 ab df ff ff       	call   801217 <fd_alloc>
+  80326c:	89 c3                	mov    %eax,%ebx
+  80326e:	83 c4 10             	add    $0x10,%esp
+  803271:	85 c0                	test   %eax,%eax
+  803273:	0f 88 db 00 00 00    	js     803354 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803279:	83 ec 04             	sub    $0x4,%esp
+  80327c:	68 07 04 00 00       	push   $0x407
+  803281:	ff 75 f0             	push   -0x10(%ebp)
+  803284:	6a 00                	push   $0x0
+  803286:	e8 c3 da ff ff       	call   800d4e <sys_page_alloc>
+  80328b:	89 c3                	mov    %eax,%ebx
+  80328d:	83 c4 10             	add    $0x10,%esp
+  803290:	85 c0                	test   %eax,%eax
+  803292:	0f 88 bc 00 00 00    	js     803354 <pipe+0x131>
+	va = fd2data(fd0);
+  803298:	83 ec 0c             	sub    $0xc,%esp
+  80329b:	ff 75 f4             	push   -0xc(%ebp)
+  80329e:	e8 5d df ff ff       	call   801200 <fd2data>
+  8032a3:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8032a5:	83 c4 0c             	add    $0xc,%esp
+  8032a8:	68 07 04 00 00       	push   $0x407
+  8032ad:	50                   	push   %eax
+  8032ae:	6a 00                	push   $0x0
+  8032b0:	e8 99 da ff ff       	call   800d4e <sys_page_alloc>
+  8032b5:	89 c3                	mov    %eax,%ebx
+  8032b7:	83 c4 10             	add    $0x10,%esp
+  8032ba:	85 c0                	test   %eax,%eax
+  8032bc:	0f 88 82 00 00 00    	js     803344 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8032c2:	83 ec 0c             	sub    $0xc,%esp
+  8032c5:	ff 75 f0             	push   -0x10(%ebp)
+  8032c8:	e8 33 df ff ff       	call   801200 <fd2data>
+  8032cd:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8032d4:	50                   	push   %eax
+  8032d5:	6a 00                	push   $0x0
+  8032d7:	56                   	push   %esi
+  8032d8:	6a 00                	push   $0x0
+  8032da:	e8 bc da ff ff       	call   800d9b <sys_page_map>
+  8032df:	89 c3                	mov    %eax,%ebx
+  8032e1:	83 c4 20             	add    $0x20,%esp
+  8032e4:	85 c0                	test   %eax,%eax
+  8032e6:	78 4e                	js     803336 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8032e8:	a1 7c 62 80 00       	mov    0x80627c,%eax
+  8032ed:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8032f0:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8032f2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8032f5:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8032fc:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8032ff:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803301:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803304:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80330b:	83 ec 0c             	sub    $0xc,%esp
+  80330e:	ff 75 f4             	push   -0xc(%ebp)
+  803311:	e8 da de ff ff       	call   8011f0 <fd2num>
+  803316:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803319:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80331b:	83 c4 04             	add    $0x4,%esp
+  80331e:	ff 75 f0             	push   -0x10(%ebp)
+  803321:	e8 ca de ff ff       	call   8011f0 <fd2num>
+  803326:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803329:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80332c:	83 c4 10             	add    $0x10,%esp
+  80332f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803334:	eb 2e                	jmp    803364 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803336:	83 ec 08             	sub    $0x8,%esp
+  803339:	56                   	push   %esi
+  80333a:	6a 00                	push   $0x0
+  80333c:	e8 a6 da ff ff       	call   800de7 <sys_page_unmap>
+  803341:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803344:	83 ec 08             	sub    $0x8,%esp
+  803347:	ff 75 f0             	push   -0x10(%ebp)
+  80334a:	6a 00                	push   $0x0
+  80334c:	e8 96 da ff ff       	call   800de7 <sys_page_unmap>
+  803351:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803354:	83 ec 08             	sub    $0x8,%esp
+  803357:	ff 75 f4             	push   -0xc(%ebp)
+  80335a:	6a 00                	push   $0x0
+  80335c:	e8 86 da ff ff       	call   800de7 <sys_page_unmap>
+  803361:	83 c4 10             	add    $0x10,%esp
+}
+  803364:	89 d8                	mov    %ebx,%eax
+  803366:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803369:	5b                   	pop    %ebx
+  80336a:	5e                   	pop    %esi
+  80336b:	5d                   	pop    %ebp
+  80336c:	c3                   	ret
+
+0080336d <pipeisclosed>:
+{
+  80336d:	55                   	push   %ebp
+  80336e:	89 e5                	mov    %esp,%ebp
+  803370:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803373:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803376:	50                   	push   %eax
+  803377:	ff 75 08             	push   0x8(%ebp)
+  80337a:	e8 ee de ff ff       	call   80126d <fd_lookup>
+  80337f:	83 c4 10             	add    $0x10,%esp
+  803382:	85 c0                	test   %eax,%eax
+  803384:	78 18                	js     80339e <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803386:	83 ec 0c             	sub    $0xc,%esp
+  803389:	ff 75 f4             	push   -0xc(%ebp)
+  80338c:	e8 6f de ff ff       	call   801200 <fd2data>
+  803391:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803393:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803396:	e8 27 fc ff ff       	call   802fc2 <_pipeisclosed>
+  80339b:	83 c4 10             	add    $0x10,%esp
+}
+  80339e:	c9                   	leave
+  80339f:	c3                   	ret
+
+008033a0 <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  8033a0:	55                   	push   %ebp
+  8033a1:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  8033a3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033a6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8033ac:	5d                   	pop    %ebp
+  8033ad:	c3                   	ret
+
+008033ae <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  8033ae:	55                   	push   %ebp
+  8033af:	89 e5                	mov    %esp,%ebp
+  8033b1:	56                   	push   %esi
+  8033b2:	53                   	push   %ebx
+  8033b3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  8033b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033bb:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8033c0:	89 d0                	mov    %edx,%eax
+  8033c2:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  8033c6:	85 c0                	test   %eax,%eax
+  8033c8:	74 2d                	je     8033f7 <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  8033ca:	83 f8 02             	cmp    $0x2,%eax
+  8033cd:	74 08                	je     8033d7 <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  8033cf:	b8 02 00 00 00       	mov    $0x2,%eax
+  8033d4:	f0 87 03             	lock xchg %eax,(%ebx)
+  8033d7:	be 02 00 00 00       	mov    $0x2,%esi
+  8033dc:	eb 15                	jmp    8033f3 <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  8033de:	83 ec 04             	sub    $0x4,%esp
+  8033e1:	6a 00                	push   $0x0
+  8033e3:	6a 02                	push   $0x2
+  8033e5:	53                   	push   %ebx
+  8033e6:	e8 78 dc ff ff       	call   801063 <sys_futex_wait>
+  8033eb:	89 f0                	mov    %esi,%eax
+  8033ed:	f0 87 03             	lock xchg %eax,(%ebx)
+  8033f0:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  8033f3:	85 c0                	test   %eax,%eax
+  8033f5:	75 e7                	jne    8033de <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  8033f7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8033fa:	5b                   	pop    %ebx
+  8033fb:	5e                   	pop    %esi
+  8033fc:	5d                   	pop    %ebp
+  8033fd:	c3                   	ret
+
+008033fe <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  8033fe:	55                   	push   %ebp
+  8033ff:	89 e5                	mov    %esp,%ebp
+  803401:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803404:	b8 00 00 00 00       	mov    $0x0,%eax
+  803409:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80340e:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  803412:	f7 d8                	neg    %eax
+  803414:	19 c0                	sbb    %eax,%eax
+  803416:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  803419:	5d                   	pop    %ebp
+  80341a:	c3                   	ret
+
+0080341b <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  80341b:	55                   	push   %ebp
+  80341c:	89 e5                	mov    %esp,%ebp
+  80341e:	83 ec 08             	sub    $0x8,%esp
+  803421:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  803424:	b8 00 00 00 00       	mov    $0x0,%eax
+  803429:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  80342c:	83 f8 02             	cmp    $0x2,%eax
+  80342f:	74 02                	je     803433 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  803431:	c9                   	leave
+  803432:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  803433:	83 ec 08             	sub    $0x8,%esp
+  803436:	6a 01                	push   $0x1
+  803438:	52                   	push   %edx
+  803439:	e8 54 dc ff ff       	call   801092 <sys_futex_wake>
+  80343e:	83 c4 10             	add    $0x10,%esp
+}
+  803441:	eb ee                	jmp    803431 <mutex_unlock+0x16>
+
+00803443 <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  803443:	55                   	push   %ebp
+  803444:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  803446:	8b 45 08             	mov    0x8(%ebp),%eax
+  803449:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  80344f:	5d                   	pop    %ebp
+  803450:	c3                   	ret
+
+00803451 <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  803451:	55                   	push   %ebp
+  803452:	89 e5                	mov    %esp,%ebp
+  803454:	57                   	push   %edi
+  803455:	56                   	push   %esi
+  803456:	53                   	push   %ebx
+  803457:	83 ec 18             	sub    $0x18,%esp
+  80345a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80345d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  803460:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  803462:	53                   	push   %ebx
+  803463:	e8 b3 ff ff ff       	call   80341b <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  803468:	83 c4 0c             	add    $0xc,%esp
+  80346b:	ff 75 10             	push   0x10(%ebp)
+  80346e:	57                   	push   %edi
+  80346f:	56                   	push   %esi
+  803470:	e8 ee db ff ff       	call   801063 <sys_futex_wait>
+  803475:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  803477:	83 c4 10             	add    $0x10,%esp
+  80347a:	be 02 00 00 00       	mov    $0x2,%esi
+  80347f:	eb 10                	jmp    803491 <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  803481:	83 ec 04             	sub    $0x4,%esp
+  803484:	6a 00                	push   $0x0
+  803486:	6a 02                	push   $0x2
+  803488:	53                   	push   %ebx
+  803489:	e8 d5 db ff ff       	call   801063 <sys_futex_wait>
+  80348e:	83 c4 10             	add    $0x10,%esp
+  803491:	89 f0                	mov    %esi,%eax
+  803493:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  803496:	85 c0                	test   %eax,%eax
+  803498:	75 e7                	jne    803481 <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  80349a:	83 ff ec             	cmp    $0xffffffec,%edi
+  80349d:	74 05                	je     8034a4 <cond_timedwait+0x53>
+  80349f:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  8034a4:	89 f8                	mov    %edi,%eax
+  8034a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034a9:	5b                   	pop    %ebx
+  8034aa:	5e                   	pop    %esi
+  8034ab:	5f                   	pop    %edi
+  8034ac:	5d                   	pop    %ebp
+  8034ad:	c3                   	ret
+
+008034ae <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  8034ae:	55                   	push   %ebp
+  8034af:	89 e5                	mov    %esp,%ebp
+  8034b1:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  8034b4:	6a 00                	push   $0x0
+  8034b6:	ff 75 0c             	push   0xc(%ebp)
+  8034b9:	ff 75 08             	push   0x8(%ebp)
+  8034bc:	e8 90 ff ff ff       	call   803451 <cond_timedwait>
+}
+  8034c1:	83 c4 10             	add    $0x10,%esp
+  8034c4:	c9                   	leave
+  8034c5:	c3                   	ret
+
+008034c6 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  8034c6:	55                   	push   %ebp
+  8034c7:	89 e5                	mov    %esp,%ebp
+  8034c9:	83 ec 10             	sub    $0x10,%esp
+  8034cc:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  8034cf:	ba 01 00 00 00       	mov    $0x1,%edx
+  8034d4:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  8034d8:	6a 01                	push   $0x1
+  8034da:	50                   	push   %eax
+  8034db:	e8 b2 db ff ff       	call   801092 <sys_futex_wake>
+}
+  8034e0:	83 c4 10             	add    $0x10,%esp
+  8034e3:	c9                   	leave
+  8034e4:	c3                   	ret
+
+008034e5 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  8034e5:	55                   	push   %ebp
+  8034e6:	89 e5                	mov    %esp,%ebp
+  8034e8:	83 ec 10             	sub    $0x10,%esp
+  8034eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034ee:	ba 01 00 00 00       	mov    $0x1,%edx
+  8034f3:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  8034f7:	68 00 04 00 00       	push   $0x400
+  8034fc:	50                   	push   %eax
+  8034fd:	e8 90 db ff ff       	call   801092 <sys_futex_wake>
+}
+  803502:	83 c4 10             	add    $0x10,%esp
+  803505:	c9                   	leave
+  803506:	c3                   	ret
+
+00803507 <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  803507:	55                   	push   %ebp
+  803508:	89 e5                	mov    %esp,%ebp
+  80350a:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  80350d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803510:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  803512:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  803519:	5d                   	pop    %ebp
+  80351a:	c3                   	ret
+
+0080351b <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  80351b:	55                   	push   %ebp
+  80351c:	89 e5                	mov    %esp,%ebp
+  80351e:	53                   	push   %ebx
+  80351f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  803522:	8b 11                	mov    (%ecx),%edx
+  803524:	85 d2                	test   %edx,%edx
+  803526:	74 14                	je     80353c <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  803528:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  80352b:	89 d0                	mov    %edx,%eax
+  80352d:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  803531:	39 c2                	cmp    %eax,%edx
+  803533:	75 ed                	jne    803522 <sem_trywait+0x7>
+			return 0;
+  803535:	b8 00 00 00 00       	mov    $0x0,%eax
+  80353a:	eb 05                	jmp    803541 <sem_trywait+0x26>
+	return -E_AGAIN;
+  80353c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  803541:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803544:	c9                   	leave
+  803545:	c3                   	ret
+
+00803546 <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  803546:	55                   	push   %ebp
+  803547:	89 e5                	mov    %esp,%ebp
+  803549:	57                   	push   %edi
+  80354a:	56                   	push   %esi
+  80354b:	53                   	push   %ebx
+  80354c:	83 ec 1c             	sub    $0x1c,%esp
+  80354f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803552:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  803555:	e8 81 da ff ff       	call   800fdb <sys_time_msec>
+  80355a:	01 f8                	add    %edi,%eax
+  80355c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  80355f:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  803564:	eb 28                	jmp    80358e <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  803566:	b8 01 00 00 00       	mov    $0x1,%eax
+  80356b:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  803570:	83 ec 04             	sub    $0x4,%esp
+  803573:	56                   	push   %esi
+  803574:	6a 00                	push   $0x0
+  803576:	53                   	push   %ebx
+  803577:	e8 e7 da ff ff       	call   801063 <sys_futex_wait>
+  80357c:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  803581:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  803586:	83 c4 10             	add    $0x10,%esp
+  803589:	83 f8 ec             	cmp    $0xffffffec,%eax
+  80358c:	74 2e                	je     8035bc <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  80358e:	83 ec 0c             	sub    $0xc,%esp
+  803591:	53                   	push   %ebx
+  803592:	e8 84 ff ff ff       	call   80351b <sem_trywait>
+  803597:	83 c4 10             	add    $0x10,%esp
+  80359a:	85 c0                	test   %eax,%eax
+  80359c:	79 19                	jns    8035b7 <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  80359e:	85 ff                	test   %edi,%edi
+  8035a0:	74 c4                	je     803566 <sem_timedwait+0x20>
+  8035a2:	e8 34 da ff ff       	call   800fdb <sys_time_msec>
+  8035a7:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8035aa:	29 c6                	sub    %eax,%esi
+  8035ac:	85 f6                	test   %esi,%esi
+  8035ae:	7f b6                	jg     803566 <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  8035b0:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  8035b5:	eb 05                	jmp    8035bc <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  8035b7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8035bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8035bf:	5b                   	pop    %ebx
+  8035c0:	5e                   	pop    %esi
+  8035c1:	5f                   	pop    %edi
+  8035c2:	5d                   	pop    %ebp
+  8035c3:	c3                   	ret
+
+008035c4 <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  8035c4:	55                   	push   %ebp
+  8035c5:	89 e5                	mov    %esp,%ebp
+  8035c7:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  8035ca:	6a 00                	push   $0x0
+  8035cc:	ff 75 08             	push   0x8(%ebp)
+  8035cf:	e8 72 ff ff ff       	call   803546 <sem_timedwait>
+}
+  8035d4:	83 c4 10             	add    $0x10,%esp
+  8035d7:	c9                   	leave
+  8035d8:	c3                   	ret
+
+008035d9 <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  8035d9:	55                   	push   %ebp
+  8035da:	89 e5                	mov    %esp,%ebp
+  8035dc:	83 ec 08             	sub    $0x8,%esp
+  8035df:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035e2:	ba 01 00 00 00       	mov    $0x1,%edx
+  8035e7:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  8035eb:	8b 50 04             	mov    0x4(%eax),%edx
+  8035ee:	85 d2                	test   %edx,%edx
+  8035f0:	75 02                	jne    8035f4 <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  8035f2:	c9                   	leave
+  8035f3:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  8035f4:	83 ec 08             	sub    $0x8,%esp
+  8035f7:	6a 01                	push   $0x1
+  8035f9:	50                   	push   %eax
+  8035fa:	e8 93 da ff ff       	call   801092 <sys_futex_wake>
+  8035ff:	83 c4 10             	add    $0x10,%esp
+}
+  803602:	eb ee                	jmp    8035f2 <sem_post+0x19>
+
+00803604 <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  803604:	55                   	push   %ebp
+  803605:	89 e5                	mov    %esp,%ebp
+  803607:	57                   	push   %edi
+  803608:	56                   	push   %esi
+  803609:	53                   	push   %ebx
+  80360a:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  80360d:	68 20 70 80 00       	push   $0x807020
+  803612:	e8 97 fd ff ff       	call   8033ae <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  803617:	a1 44 70 80 00       	mov    0x807044,%eax
+  80361c:	83 c4 10             	add    $0x10,%esp
+  80361f:	85 c0                	test   %eax,%eax
+  803621:	75 19                	jne    80363c <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  803623:	a1 c0 72 80 00       	mov    0x8072c0,%eax
+  803628:	8b 00                	mov    (%eax),%eax
+  80362a:	8b 40 48             	mov    0x48(%eax),%eax
+  80362d:	a3 40 70 80 00       	mov    %eax,0x807040
+		threads[0].th_state = PTH_RUNNING;
+  803632:	c7 05 44 70 80 00 01 	movl   $0x1,0x807044
+  803639:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  80363c:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  803641:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803644:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  80364b:	8b 40 04             	mov    0x4(%eax),%eax
+  80364e:	85 c0                	test   %eax,%eax
+  803650:	0f 84 e4 00 00 00    	je     80373a <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803656:	83 c3 01             	add    $0x1,%ebx
+  803659:	83 fb 20             	cmp    $0x20,%ebx
+  80365c:	75 e3                	jne    803641 <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  80365e:	83 ec 0c             	sub    $0xc,%esp
+  803661:	68 20 70 80 00       	push   $0x807020
+  803666:	e8 b0 fd ff ff       	call   80341b <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  80366b:	83 c4 10             	add    $0x10,%esp
+  80366e:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  803673:	e9 b8 00 00 00       	jmp    803730 <pthread_create+0x12c>
+  803678:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  80367b:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  80367e:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  803680:	39 f3                	cmp    %esi,%ebx
+  803682:	73 16                	jae    80369a <pthread_create+0x96>
+		va -= PGSIZE;
+  803684:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  80368a:	83 ec 08             	sub    $0x8,%esp
+  80368d:	56                   	push   %esi
+  80368e:	6a 00                	push   $0x0
+  803690:	e8 52 d7 ff ff       	call   800de7 <sys_page_unmap>
+  803695:	83 c4 10             	add    $0x10,%esp
+  803698:	eb e6                	jmp    803680 <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  80369a:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80369d:	83 ec 08             	sub    $0x8,%esp
+  8036a0:	ff 75 e4             	push   -0x1c(%ebp)
+  8036a3:	6a 00                	push   $0x0
+  8036a5:	e8 3d d7 ff ff       	call   800de7 <sys_page_unmap>
+	return r;
+  8036aa:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  8036ad:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8036b0:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  8036b7:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  8036be:	eb 70                	jmp    803730 <pthread_create+0x12c>
+	th->th_fn = fn;
+  8036c0:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8036c3:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  8036ca:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8036cd:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  8036d0:	8b 55 10             	mov    0x10(%ebp),%edx
+  8036d3:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  8036d6:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  8036dd:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  8036e2:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8036e5:	29 c8                	sub    %ecx,%eax
+  8036e7:	85 db                	test   %ebx,%ebx
+  8036e9:	0f 44 05 c0 72 80 00 	cmove  0x8072c0,%eax
+	*--esp = t;
+  8036f0:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  8036f3:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  8036fa:	83 ec 04             	sub    $0x4,%esp
+  8036fd:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803702:	29 ca                	sub    %ecx,%edx
+  803704:	52                   	push   %edx
+	*--esp = 0;
+  803705:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803708:	50                   	push   %eax
+  803709:	68 61 39 80 00       	push   $0x803961
+  80370e:	e8 24 da ff ff       	call   801137 <sys_thread_create>
+  803713:	89 c7                	mov    %eax,%edi
+  803715:	83 c4 10             	add    $0x10,%esp
+  803718:	85 c0                	test   %eax,%eax
+  80371a:	78 91                	js     8036ad <pthread_create+0xa9>
+	th->th_env = id;
+  80371c:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80371f:	89 3c 85 40 70 80 00 	mov    %edi,0x807040(,%eax,4)
+	*tp = t;
+  803726:	8b 45 08             	mov    0x8(%ebp),%eax
+  803729:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  80372b:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803730:	89 f8                	mov    %edi,%eax
+  803732:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803735:	5b                   	pop    %ebx
+  803736:	5e                   	pop    %esi
+  803737:	5f                   	pop    %edi
+  803738:	5d                   	pop    %ebp
+  803739:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  80373a:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80373d:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803744:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  80374b:	83 ec 0c             	sub    $0xc,%esp
+  80374e:	68 20 70 80 00       	push   $0x807020
+  803753:	e8 c3 fc ff ff       	call   80341b <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  803758:	89 d9                	mov    %ebx,%ecx
+  80375a:	c1 e1 10             	shl    $0x10,%ecx
+  80375d:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  803760:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  803765:	29 c8                	sub    %ecx,%eax
+  803767:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  80376a:	c1 e8 16             	shr    $0x16,%eax
+  80376d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803774:	83 c4 10             	add    $0x10,%esp
+  803777:	a8 01                	test   $0x1,%al
+  803779:	74 15                	je     803790 <pthread_create+0x18c>
+  80377b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80377e:	c1 e8 0c             	shr    $0xc,%eax
+  803781:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803788:	a8 01                	test   $0x1,%al
+  80378a:	0f 85 30 ff ff ff    	jne    8036c0 <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803790:	83 ec 04             	sub    $0x4,%esp
+  803793:	6a 07                	push   $0x7
+  803795:	ff 75 e4             	push   -0x1c(%ebp)
+  803798:	6a 00                	push   $0x0
+  80379a:	e8 af d5 ff ff       	call   800d4e <sys_page_alloc>
+  80379f:	89 c7                	mov    %eax,%edi
+  8037a1:	83 c4 10             	add    $0x10,%esp
+  8037a4:	85 c0                	test   %eax,%eax
+  8037a6:	0f 88 01 ff ff ff    	js     8036ad <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  8037ac:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  8037b1:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8037b4:	29 d0                	sub    %edx,%eax
+  8037b6:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8037b9:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  8037bb:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  8037c0:	29 d0                	sub    %edx,%eax
+  8037c2:	89 c7                	mov    %eax,%edi
+  8037c4:	39 fe                	cmp    %edi,%esi
+  8037c6:	0f 83 f4 fe ff ff    	jae    8036c0 <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  8037cc:	83 ec 04             	sub    $0x4,%esp
+  8037cf:	6a 07                	push   $0x7
+  8037d1:	56                   	push   %esi
+  8037d2:	6a 00                	push   $0x0
+  8037d4:	e8 75 d5 ff ff       	call   800d4e <sys_page_alloc>
+  8037d9:	83 c4 10             	add    $0x10,%esp
+  8037dc:	85 c0                	test   %eax,%eax
+  8037de:	0f 88 94 fe ff ff    	js     803678 <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  8037e4:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8037ea:	eb d8                	jmp    8037c4 <pthread_create+0x1c0>
+
+008037ec <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  8037ec:	55                   	push   %ebp
+  8037ed:	89 e5                	mov    %esp,%ebp
+  8037ef:	57                   	push   %edi
+  8037f0:	56                   	push   %esi
+  8037f1:	53                   	push   %ebx
+  8037f2:	83 ec 0c             	sub    $0xc,%esp
+  8037f5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  8037f8:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  8037fb:	83 f8 1e             	cmp    $0x1e,%eax
+  8037fe:	0f 87 c7 00 00 00    	ja     8038cb <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  803804:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803806:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80380c:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803811:	77 12                	ja     803825 <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803813:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803818:	29 d0                	sub    %edx,%eax
+  80381a:	c1 e8 10             	shr    $0x10,%eax
+  80381d:	39 c3                	cmp    %eax,%ebx
+  80381f:	0f 84 ad 00 00 00    	je     8038d2 <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803825:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803828:	8d 3c 85 44 70 80 00 	lea    0x807044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  80382f:	8d 34 85 40 70 80 00 	lea    0x807040(,%eax,4),%esi
+  803836:	eb 10                	jmp    803848 <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803838:	83 ec 04             	sub    $0x4,%esp
+  80383b:	6a 00                	push   $0x0
+  80383d:	6a 01                	push   $0x1
+  80383f:	57                   	push   %edi
+  803840:	e8 1e d8 ff ff       	call   801063 <sys_futex_wait>
+  803845:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  803848:	8b 46 04             	mov    0x4(%esi),%eax
+  80384b:	83 f8 01             	cmp    $0x1,%eax
+  80384e:	74 e8                	je     803838 <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  803850:	83 f8 02             	cmp    $0x2,%eax
+  803853:	0f 85 80 00 00 00    	jne    8038d9 <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  803859:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  80385c:	c1 e6 02             	shl    $0x2,%esi
+  80385f:	eb 05                	jmp    803866 <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  803861:	e8 bc d4 ff ff       	call   800d22 <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  803866:	8b 8e 40 70 80 00    	mov    0x807040(%esi),%ecx
+  80386c:	89 ca                	mov    %ecx,%edx
+  80386e:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  803874:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803877:	c1 e0 04             	shl    $0x4,%eax
+  80387a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80387f:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  803882:	39 c1                	cmp    %eax,%ecx
+  803884:	75 12                	jne    803898 <pthread_join+0xac>
+  803886:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803889:	c1 e0 04             	shl    $0x4,%eax
+  80388c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803891:	8b 40 54             	mov    0x54(%eax),%eax
+  803894:	85 c0                	test   %eax,%eax
+  803896:	75 c9                	jne    803861 <pthread_join+0x75>
+	if (ret_store)
+  803898:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80389c:	74 0f                	je     8038ad <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  80389e:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8038a1:	8b 04 85 50 70 80 00 	mov    0x807050(,%eax,4),%eax
+  8038a8:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8038ab:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  8038ad:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8038b0:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  8038b7:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  8038be:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8038c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8038c6:	5b                   	pop    %ebx
+  8038c7:	5e                   	pop    %esi
+  8038c8:	5f                   	pop    %edi
+  8038c9:	5d                   	pop    %ebp
+  8038ca:	c3                   	ret
+		return -E_INVAL;
+  8038cb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8038d0:	eb f1                	jmp    8038c3 <pthread_join+0xd7>
+  8038d2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8038d7:	eb ea                	jmp    8038c3 <pthread_join+0xd7>
+		return -E_INVAL;
+  8038d9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8038de:	eb e3                	jmp    8038c3 <pthread_join+0xd7>
+
+008038e0 <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  8038e0:	55                   	push   %ebp
+  8038e1:	89 e5                	mov    %esp,%ebp
+  8038e3:	53                   	push   %ebx
+  8038e4:	83 ec 04             	sub    $0x4,%esp
+  8038e7:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8038e9:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8038ef:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8038f4:	77 0c                	ja     803902 <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8038f6:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8038fb:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  8038fd:	c1 e8 10             	shr    $0x10,%eax
+  803900:	75 0a                	jne    80390c <pthread_exit+0x2c>
+		exit();
+  803902:	e8 22 c9 ff ff       	call   800229 <exit>
+  803907:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  80390c:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  803913:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  803916:	8d 0c 8d 40 70 80 00 	lea    0x807040(,%ecx,4),%ecx
+  80391d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803920:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  803923:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  80392a:	83 ec 08             	sub    $0x8,%esp
+  80392d:	6a 20                	push   $0x20
+  80392f:	01 c2                	add    %eax,%edx
+  803931:	8d 04 95 44 70 80 00 	lea    0x807044(,%edx,4),%eax
+  803938:	50                   	push   %eax
+  803939:	e8 54 d7 ff ff       	call   801092 <sys_futex_wake>
+	sys_env_destroy(0);
+  80393e:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  803945:	e8 61 d3 ff ff       	call   800cab <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  80394a:	83 c4 0c             	add    $0xc,%esp
+  80394d:	68 46 4e 80 00       	push   $0x804e46
+  803952:	68 a5 00 00 00       	push   $0xa5
+  803957:	68 60 4e 80 00       	push   $0x804e60
+  80395c:	e8 f0 c8 ff ff       	call   800251 <_panic>
+
+00803961 <pthread_start>:
+{
+  803961:	55                   	push   %ebp
+  803962:	89 e5                	mov    %esp,%ebp
+  803964:	53                   	push   %ebx
+  803965:	83 ec 04             	sub    $0x4,%esp
+  803968:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  80396b:	e8 86 d3 ff ff       	call   800cf6 <sys_getenvid>
+  803970:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  803975:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+	if (t == 0)
+  80397b:	85 db                	test   %ebx,%ebx
+  80397d:	74 0c                	je     80398b <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80397f:	89 d9                	mov    %ebx,%ecx
+  803981:	c1 e1 10             	shl    $0x10,%ecx
+  803984:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803989:	29 ca                	sub    %ecx,%edx
+  80398b:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80398e:	c1 e0 04             	shl    $0x4,%eax
+  803991:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803996:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  803998:	83 ec 0c             	sub    $0xc,%esp
+  80399b:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  8039a2:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  8039a5:	ff 34 95 4c 70 80 00 	push   0x80704c(,%edx,4)
+  8039ac:	ff 14 95 48 70 80 00 	call   *0x807048(,%edx,4)
+  8039b3:	89 04 24             	mov    %eax,(%esp)
+  8039b6:	e8 25 ff ff ff       	call   8038e0 <pthread_exit>
+
+008039bb <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  8039bb:	55                   	push   %ebp
+  8039bc:	89 e5                	mov    %esp,%ebp
+  8039be:	57                   	push   %edi
+  8039bf:	56                   	push   %esi
+  8039c0:	53                   	push   %ebx
+  8039c1:	83 ec 1c             	sub    $0x1c,%esp
+  8039c4:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8039c6:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  8039cc:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8039d3:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8039d8:	77 0d                	ja     8039e7 <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8039da:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8039df:	29 d0                	sub    %edx,%eax
+  8039e1:	c1 e8 10             	shr    $0x10,%eax
+  8039e4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  8039e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8039ec:	eb 2f                	jmp    803a1d <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  8039ee:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  8039f4:	8b 01                	mov    (%ecx),%eax
+  8039f6:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  8039f9:	39 c2                	cmp    %eax,%edx
+  8039fb:	75 14                	jne    803a11 <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  8039fd:	83 ec 0c             	sub    $0xc,%esp
+  803a00:	57                   	push   %edi
+  803a01:	e8 a5 d2 ff ff       	call   800cab <sys_env_destroy>
+  803a06:	83 c4 10             	add    $0x10,%esp
+  803a09:	85 c0                	test   %eax,%eax
+  803a0b:	0f 88 97 00 00 00    	js     803aa8 <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  803a11:	83 c3 01             	add    $0x1,%ebx
+  803a14:	83 fb 20             	cmp    $0x20,%ebx
+  803a17:	0f 84 d2 00 00 00    	je     803aef <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  803a1d:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  803a20:	74 ef                	je     803a11 <pthread_kill_others+0x56>
+  803a22:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803a25:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803a2c:	8b 40 04             	mov    0x4(%eax),%eax
+  803a2f:	83 f8 01             	cmp    $0x1,%eax
+  803a32:	75 dd                	jne    803a11 <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  803a34:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803a37:	8b 3c 85 40 70 80 00 	mov    0x807040(,%eax,4),%edi
+  803a3e:	89 fe                	mov    %edi,%esi
+  803a40:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  803a46:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803a49:	c1 e0 04             	shl    $0x4,%eax
+  803a4c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803a51:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803a54:	39 c7                	cmp    %eax,%edi
+  803a56:	75 b9                	jne    803a11 <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  803a58:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803a5b:	c1 e0 04             	shl    $0x4,%eax
+  803a5e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803a63:	8b 40 54             	mov    0x54(%eax),%eax
+  803a66:	85 c0                	test   %eax,%eax
+  803a68:	74 a7                	je     803a11 <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803a6a:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803a6d:	c1 e0 04             	shl    $0x4,%eax
+  803a70:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  803a76:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803a78:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  803a7e:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803a83:	0f 87 65 ff ff ff    	ja     8039ee <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803a89:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803a8e:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  803a90:	c1 e8 10             	shr    $0x10,%eax
+  803a93:	0f 84 55 ff ff ff    	je     8039ee <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803a99:	c1 e0 10             	shl    $0x10,%eax
+  803a9c:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  803aa1:	29 c1                	sub    %eax,%ecx
+  803aa3:	e9 4c ff ff ff       	jmp    8039f4 <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  803aa8:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  803aab:	c1 e2 04             	shl    $0x4,%edx
+  803aae:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803ab4:	8b 52 48             	mov    0x48(%edx),%edx
+  803ab7:	39 fa                	cmp    %edi,%edx
+  803ab9:	0f 85 52 ff ff ff    	jne    803a11 <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  803abf:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  803ac2:	c1 e2 04             	shl    $0x4,%edx
+  803ac5:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803acb:	8b 52 54             	mov    0x54(%edx),%edx
+  803ace:	85 d2                	test   %edx,%edx
+  803ad0:	0f 84 3b ff ff ff    	je     803a11 <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  803ad6:	83 ec 0c             	sub    $0xc,%esp
+  803ad9:	50                   	push   %eax
+  803ada:	57                   	push   %edi
+  803adb:	68 70 4e 80 00       	push   $0x804e70
+  803ae0:	68 bb 00 00 00       	push   $0xbb
+  803ae5:	68 60 4e 80 00       	push   $0x804e60
+  803aea:	e8 62 c7 ff ff       	call   800251 <_panic>
+	}
+}
+  803aef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803af2:	5b                   	pop    %ebx
+  803af3:	5e                   	pop    %esi
+  803af4:	5f                   	pop    %edi
+  803af5:	5d                   	pop    %ebp
+  803af6:	c3                   	ret
+
+00803af7 <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  803af7:	55                   	push   %ebp
+  803af8:	89 e5                	mov    %esp,%ebp
+  803afa:	53                   	push   %ebx
+  803afb:	83 ec 04             	sub    $0x4,%esp
+  803afe:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803b00:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  803b06:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803b0c:	0f 87 85 00 00 00    	ja     803b97 <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803b12:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  803b17:	29 c3                	sub    %eax,%ebx
+  803b19:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  803b1c:	83 ec 04             	sub    $0x4,%esp
+  803b1f:	68 80 02 00 00       	push   $0x280
+  803b24:	6a 00                	push   $0x0
+  803b26:	68 40 70 80 00       	push   $0x807040
+  803b2b:	e8 31 cf ff ff       	call   800a61 <memset>
+	threads_mu.m_state = 0;
+  803b30:	c7 05 20 70 80 00 00 	movl   $0x0,0x807020
+  803b37:	00 00 00 
+	if (self != 0) {
+  803b3a:	83 c4 10             	add    $0x10,%esp
+  803b3d:	85 db                	test   %ebx,%ebx
+  803b3f:	74 51                	je     803b92 <pthread_fork_child+0x9b>
+  803b41:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803b43:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803b49:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803b4e:	77 18                	ja     803b68 <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803b50:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803b55:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803b57:	c1 e8 10             	shr    $0x10,%eax
+  803b5a:	74 0c                	je     803b68 <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803b5c:	c1 e0 10             	shl    $0x10,%eax
+  803b5f:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803b64:	29 c2                	sub    %eax,%edx
+  803b66:	eb 06                	jmp    803b6e <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  803b68:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		threads[self].th_env = thisenv->env_id;
+  803b6e:	8b 02                	mov    (%edx),%eax
+  803b70:	8b 48 48             	mov    0x48(%eax),%ecx
+  803b73:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803b7a:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803b7d:	89 0c 95 40 70 80 00 	mov    %ecx,0x807040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  803b84:	8d 04 95 40 70 80 00 	lea    0x807040(,%edx,4),%eax
+  803b8b:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  803b92:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803b95:	c9                   	leave
+  803b96:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  803b97:	83 ec 04             	sub    $0x4,%esp
+  803b9a:	68 80 02 00 00       	push   $0x280
+  803b9f:	6a 00                	push   $0x0
+  803ba1:	68 40 70 80 00       	push   $0x807040
+  803ba6:	e8 b6 ce ff ff       	call   800a61 <memset>
+	threads_mu.m_state = 0;
+  803bab:	c7 05 20 70 80 00 00 	movl   $0x0,0x807020
+  803bb2:	00 00 00 
+  803bb5:	83 c4 10             	add    $0x10,%esp
+  803bb8:	eb d8                	jmp    803b92 <pthread_fork_child+0x9b>
+
+00803bba <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803bba:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bbf:	c3                   	ret
+
+00803bc0 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803bc0:	55                   	push   %ebp
+  803bc1:	89 e5                	mov    %esp,%ebp
+  803bc3:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803bc6:	68 95 4e 80 00       	push   $0x804e95
+  803bcb:	ff 75 0c             	push   0xc(%ebp)
+  803bce:	e8 3d cd ff ff       	call   800910 <strcpy>
+	return 0;
+}
+  803bd3:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bd8:	c9                   	leave
+  803bd9:	c3                   	ret
+
+00803bda <devcons_write>:
+{
+  803bda:	55                   	push   %ebp
+  803bdb:	89 e5                	mov    %esp,%ebp
+  803bdd:	57                   	push   %edi
+  803bde:	56                   	push   %esi
+  803bdf:	53                   	push   %ebx
+  803be0:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803be6:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803beb:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803bf1:	eb 2e                	jmp    803c21 <devcons_write+0x47>
+		m = n - tot;
+  803bf3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803bf6:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803bf8:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803bfd:	39 c3                	cmp    %eax,%ebx
+  803bff:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803c02:	83 ec 04             	sub    $0x4,%esp
+  803c05:	53                   	push   %ebx
+  803c06:	89 f0                	mov    %esi,%eax
+  803c08:	03 45 0c             	add    0xc(%ebp),%eax
+  803c0b:	50                   	push   %eax
+  803c0c:	57                   	push   %edi
+  803c0d:	e8 84 ce ff ff       	call   800a96 <memmove>
+		sys_cputs(buf, m);
+  803c12:	83 c4 08             	add    $0x8,%esp
+  803c15:	53                   	push   %ebx
+  803c16:	57                   	push   %edi
+  803c17:	e8 38 d0 ff ff       	call   800c54 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803c1c:	01 de                	add    %ebx,%esi
+  803c1e:	83 c4 10             	add    $0x10,%esp
+  803c21:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803c24:	72 cd                	jb     803bf3 <devcons_write+0x19>
+}
+  803c26:	89 f0                	mov    %esi,%eax
+  803c28:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c2b:	5b                   	pop    %ebx
+  803c2c:	5e                   	pop    %esi
+  803c2d:	5f                   	pop    %edi
+  803c2e:	5d                   	pop    %ebp
+  803c2f:	c3                   	ret
+
+00803c30 <devcons_read>:
+{
+  803c30:	55                   	push   %ebp
+  803c31:	89 e5                	mov    %esp,%ebp
+  803c33:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  803c36:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c3b:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803c3f:	75 07                	jne    803c48 <devcons_read+0x18>
+  803c41:	eb 1f                	jmp    803c62 <devcons_read+0x32>
+		sys_yield();
+  803c43:	e8 da d0 ff ff       	call   800d22 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  803c48:	e8 32 d0 ff ff       	call   800c7f <sys_cgetc>
+  803c4d:	85 c0                	test   %eax,%eax
+  803c4f:	74 f2                	je     803c43 <devcons_read+0x13>
+	if (c < 0)
+  803c51:	78 0f                	js     803c62 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  803c53:	83 f8 04             	cmp    $0x4,%eax
+  803c56:	74 0c                	je     803c64 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  803c58:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803c5b:	88 02                	mov    %al,(%edx)
+	return 1;
+  803c5d:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803c62:	c9                   	leave
+  803c63:	c3                   	ret
+		return 0;
+  803c64:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c69:	eb f7                	jmp    803c62 <devcons_read+0x32>
+
+00803c6b <cputchar>:
+{
+  803c6b:	55                   	push   %ebp
+  803c6c:	89 e5                	mov    %esp,%ebp
+  803c6e:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803c71:	8b 45 08             	mov    0x8(%ebp),%eax
+  803c74:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803c77:	6a 01                	push   $0x1
+  803c79:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803c7c:	50                   	push   %eax
+  803c7d:	e8 d2 cf ff ff       	call   800c54 <sys_cputs>
+}
+  803c82:	83 c4 10             	add    $0x10,%esp
+  803c85:	c9                   	leave
+  803c86:	c3                   	ret
+
+00803c87 <getchar>:
+{
+  803c87:	55                   	push   %ebp
+  803c88:	89 e5                	mov    %esp,%ebp
+  803c8a:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803c8d:	6a 01                	push   $0x1
+  803c8f:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803c92:	50                   	push   %eax
+  803c93:	6a 00                	push   $0x0
+  803c95:	e8 63 d8 ff ff       	call   8014fd <read>
+	if (r < 0)
+  803c9a:	83 c4 10             	add    $0x10,%esp
+  803c9d:	85 c0                	test   %eax,%eax
+  803c9f:	78 06                	js     803ca7 <getchar+0x20>
+	if (r < 1)
+  803ca1:	74 06                	je     803ca9 <getchar+0x22>
+	return c;
+  803ca3:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803ca7:	c9                   	leave
+  803ca8:	c3                   	ret
+		return -E_EOF;
+  803ca9:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803cae:	eb f7                	jmp    803ca7 <getchar+0x20>
+
+00803cb0 <iscons>:
+{
+  803cb0:	55                   	push   %ebp
+  803cb1:	89 e5                	mov    %esp,%ebp
+  803cb3:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803cb6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803cb9:	50                   	push   %eax
+  803cba:	ff 75 08             	push   0x8(%ebp)
+  803cbd:	e8 ab d5 ff ff       	call   80126d <fd_lookup>
+  803cc2:	83 c4 10             	add    $0x10,%esp
+  803cc5:	85 c0                	test   %eax,%eax
+  803cc7:	78 11                	js     803cda <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803cc9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803ccc:	8b 15 98 62 80 00    	mov    0x806298,%edx
+  803cd2:	39 10                	cmp    %edx,(%eax)
+  803cd4:	0f 94 c0             	sete   %al
+  803cd7:	0f b6 c0             	movzbl %al,%eax
+}
+  803cda:	c9                   	leave
+  803cdb:	c3                   	ret
+
+00803cdc <opencons>:
+{
+  803cdc:	55                   	push   %ebp
+  803cdd:	89 e5                	mov    %esp,%ebp
+  803cdf:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803ce2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803ce5:	50                   	push   %eax
+  803ce6:	e8 2c d5 ff ff       	call   801217 <fd_alloc>
+  803ceb:	83 c4 10             	add    $0x10,%esp
+  803cee:	85 c0                	test   %eax,%eax
+  803cf0:	78 3a                	js     803d2c <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803cf2:	83 ec 04             	sub    $0x4,%esp
+  803cf5:	68 07 04 00 00       	push   $0x407
+  803cfa:	ff 75 f4             	push   -0xc(%ebp)
+  803cfd:	6a 00                	push   $0x0
+  803cff:	e8 4a d0 ff ff       	call   800d4e <sys_page_alloc>
+  803d04:	83 c4 10             	add    $0x10,%esp
+  803d07:	85 c0                	test   %eax,%eax
+  803d09:	78 21                	js     803d2c <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803d0b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803d0e:	8b 15 98 62 80 00    	mov    0x806298,%edx
+  803d14:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803d16:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803d19:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803d20:	83 ec 0c             	sub    $0xc,%esp
+  803d23:	50                   	push   %eax
+  803d24:	e8 c7 d4 ff ff       	call   8011f0 <fd2num>
+  803d29:	83 c4 10             	add    $0x10,%esp
+}
+  803d2c:	c9                   	leave
+  803d2d:	c3                   	ret
+
+00803d2e <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  803d2e:	55                   	push   %ebp
+  803d2f:	89 e5                	mov    %esp,%ebp
+  803d31:	57                   	push   %edi
+  803d32:	56                   	push   %esi
+  803d33:	53                   	push   %ebx
+  803d34:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  803d37:	89 d6                	mov    %edx,%esi
+  803d39:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  803d3c:	89 cf                	mov    %ecx,%edi
+  803d3e:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  803d41:	89 fa                	mov    %edi,%edx
+  803d43:	80 ce 08             	or     $0x8,%dh
+  803d46:	f6 c5 08             	test   $0x8,%ch
+  803d49:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  803d4c:	57                   	push   %edi
+  803d4d:	56                   	push   %esi
+  803d4e:	50                   	push   %eax
+  803d4f:	56                   	push   %esi
+  803d50:	6a 00                	push   $0x0
+  803d52:	e8 44 d0 ff ff       	call   800d9b <sys_page_map>
+	if (r < 0) {
+  803d57:	83 c4 20             	add    $0x20,%esp
+  803d5a:	85 c0                	test   %eax,%eax
+  803d5c:	78 27                	js     803d85 <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  803d5e:	83 ec 0c             	sub    $0xc,%esp
+  803d61:	57                   	push   %edi
+  803d62:	56                   	push   %esi
+  803d63:	6a 00                	push   $0x0
+  803d65:	56                   	push   %esi
+  803d66:	6a 00                	push   $0x0
+  803d68:	e8 2e d0 ff ff       	call   800d9b <sys_page_map>
+  803d6d:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803d6f:	83 c4 20             	add    $0x20,%esp
+  803d72:	85 c0                	test   %eax,%eax
+  803d74:	78 24                	js     803d9a <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  803d76:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803d7b:	89 d8                	mov    %ebx,%eax
+  803d7d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d80:	5b                   	pop    %ebx
+  803d81:	5e                   	pop    %esi
+  803d82:	5f                   	pop    %edi
+  803d83:	5d                   	pop    %ebp
+  803d84:	c3                   	ret
+  803d85:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803d87:	83 ec 08             	sub    $0x8,%esp
+  803d8a:	50                   	push   %eax
+  803d8b:	68 a4 4e 80 00       	push   $0x804ea4
+  803d90:	e8 97 c5 ff ff       	call   80032c <cprintf>
+		return r;
+  803d95:	83 c4 10             	add    $0x10,%esp
+  803d98:	eb e1                	jmp    803d7b <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  803d9a:	83 ec 08             	sub    $0x8,%esp
+  803d9d:	50                   	push   %eax
+  803d9e:	68 d4 4e 80 00       	push   $0x804ed4
+  803da3:	e8 84 c5 ff ff       	call   80032c <cprintf>
+		return r;
+  803da8:	83 c4 10             	add    $0x10,%esp
+  803dab:	eb ce                	jmp    803d7b <duppage_cow+0x4d>
+
+00803dad <duppage>:
+{
+  803dad:	55                   	push   %ebp
+  803dae:	89 e5                	mov    %esp,%ebp
+  803db0:	53                   	push   %ebx
+  803db1:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  803db4:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  803db7:	51                   	push   %ecx
+  803db8:	52                   	push   %edx
+  803db9:	50                   	push   %eax
+  803dba:	52                   	push   %edx
+  803dbb:	6a 00                	push   $0x0
+  803dbd:	e8 d9 cf ff ff       	call   800d9b <sys_page_map>
+	if (r < 0) {
+  803dc2:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  803dc5:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  803dca:	85 c0                	test   %eax,%eax
+  803dcc:	78 07                	js     803dd5 <duppage+0x28>
+}
+  803dce:	89 d8                	mov    %ebx,%eax
+  803dd0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803dd3:	c9                   	leave
+  803dd4:	c3                   	ret
+  803dd5:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803dd7:	83 ec 08             	sub    $0x8,%esp
+  803dda:	50                   	push   %eax
+  803ddb:	68 a4 4e 80 00       	push   $0x804ea4
+  803de0:	e8 47 c5 ff ff       	call   80032c <cprintf>
+		return r;
+  803de5:	83 c4 10             	add    $0x10,%esp
+  803de8:	eb e4                	jmp    803dce <duppage+0x21>
+
+00803dea <cow_copy>:
+{
+  803dea:	55                   	push   %ebp
+  803deb:	89 e5                	mov    %esp,%ebp
+  803ded:	56                   	push   %esi
+  803dee:	53                   	push   %ebx
+  803def:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  803df1:	83 ec 04             	sub    $0x4,%esp
+  803df4:	6a 07                	push   $0x7
+  803df6:	68 00 f0 7f 00       	push   $0x7ff000
+  803dfb:	6a 00                	push   $0x0
+  803dfd:	e8 4c cf ff ff       	call   800d4e <sys_page_alloc>
+	if (r < 0) {
+  803e02:	83 c4 10             	add    $0x10,%esp
+  803e05:	85 c0                	test   %eax,%eax
+  803e07:	78 58                	js     803e61 <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  803e09:	83 ec 04             	sub    $0x4,%esp
+  803e0c:	68 00 10 00 00       	push   $0x1000
+  803e11:	56                   	push   %esi
+  803e12:	68 00 f0 7f 00       	push   $0x7ff000
+  803e17:	e8 7a cc ff ff       	call   800a96 <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  803e1c:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  803e23:	56                   	push   %esi
+  803e24:	6a 00                	push   $0x0
+  803e26:	68 00 f0 7f 00       	push   $0x7ff000
+  803e2b:	6a 00                	push   $0x0
+  803e2d:	e8 69 cf ff ff       	call   800d9b <sys_page_map>
+  803e32:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803e34:	83 c4 20             	add    $0x20,%esp
+  803e37:	85 c0                	test   %eax,%eax
+  803e39:	78 3b                	js     803e76 <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  803e3b:	83 ec 08             	sub    $0x8,%esp
+  803e3e:	68 00 f0 7f 00       	push   $0x7ff000
+  803e43:	6a 00                	push   $0x0
+  803e45:	e8 9d cf ff ff       	call   800de7 <sys_page_unmap>
+  803e4a:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803e4c:	83 c4 10             	add    $0x10,%esp
+  803e4f:	85 c0                	test   %eax,%eax
+  803e51:	78 45                	js     803e98 <cow_copy+0xae>
+	return 0;
+  803e53:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803e58:	89 d8                	mov    %ebx,%eax
+  803e5a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803e5d:	5b                   	pop    %ebx
+  803e5e:	5e                   	pop    %esi
+  803e5f:	5d                   	pop    %ebp
+  803e60:	c3                   	ret
+  803e61:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  803e63:	83 ec 08             	sub    $0x8,%esp
+  803e66:	50                   	push   %eax
+  803e67:	68 c4 4f 80 00       	push   $0x804fc4
+  803e6c:	e8 bb c4 ff ff       	call   80032c <cprintf>
+		return r;
+  803e71:	83 c4 10             	add    $0x10,%esp
+  803e74:	eb e2                	jmp    803e58 <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  803e76:	83 ec 08             	sub    $0x8,%esp
+  803e79:	50                   	push   %eax
+  803e7a:	68 e0 4f 80 00       	push   $0x804fe0
+  803e7f:	e8 a8 c4 ff ff       	call   80032c <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  803e84:	83 c4 08             	add    $0x8,%esp
+  803e87:	68 00 f0 7f 00       	push   $0x7ff000
+  803e8c:	6a 00                	push   $0x0
+  803e8e:	e8 54 cf ff ff       	call   800de7 <sys_page_unmap>
+		return r;
+  803e93:	83 c4 10             	add    $0x10,%esp
+  803e96:	eb c0                	jmp    803e58 <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  803e98:	83 ec 08             	sub    $0x8,%esp
+  803e9b:	50                   	push   %eax
+  803e9c:	68 fc 4e 80 00       	push   $0x804efc
+  803ea1:	e8 86 c4 ff ff       	call   80032c <cprintf>
+		return r;
+  803ea6:	83 c4 10             	add    $0x10,%esp
+  803ea9:	eb ad                	jmp    803e58 <cow_copy+0x6e>
+
+00803eab <pgfault>:
+{
+  803eab:	55                   	push   %ebp
+  803eac:	89 e5                	mov    %esp,%ebp
+  803eae:	56                   	push   %esi
+  803eaf:	53                   	push   %ebx
+  803eb0:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  803eb3:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  803eb5:	89 d8                	mov    %ebx,%eax
+  803eb7:	c1 e8 16             	shr    $0x16,%eax
+  803eba:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  803ec1:	89 de                	mov    %ebx,%esi
+  803ec3:	c1 ee 0c             	shr    $0xc,%esi
+  803ec6:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  803ecd:	a8 07                	test   $0x7,%al
+  803ecf:	74 3b                	je     803f0c <pgfault+0x61>
+  803ed1:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  803ed7:	74 33                	je     803f0c <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  803ed9:	83 ec 0c             	sub    $0xc,%esp
+  803edc:	68 00 f0 bf ee       	push   $0xeebff000
+  803ee1:	e8 c8 f4 ff ff       	call   8033ae <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  803ee6:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  803eed:	83 c4 10             	add    $0x10,%esp
+  803ef0:	f6 c4 08             	test   $0x8,%ah
+  803ef3:	75 30                	jne    803f25 <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  803ef5:	83 ec 0c             	sub    $0xc,%esp
+  803ef8:	68 00 f0 bf ee       	push   $0xeebff000
+  803efd:	e8 19 f5 ff ff       	call   80341b <mutex_unlock>
+}
+  803f02:	83 c4 10             	add    $0x10,%esp
+  803f05:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803f08:	5b                   	pop    %ebx
+  803f09:	5e                   	pop    %esi
+  803f0a:	5d                   	pop    %ebp
+  803f0b:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  803f0c:	83 ec 08             	sub    $0x8,%esp
+  803f0f:	ff 72 28             	push   0x28(%edx)
+  803f12:	51                   	push   %ecx
+  803f13:	50                   	push   %eax
+  803f14:	68 20 4f 80 00       	push   $0x804f20
+  803f19:	6a 3f                	push   $0x3f
+  803f1b:	68 fa 4f 80 00       	push   $0x804ffa
+  803f20:	e8 2c c3 ff ff       	call   800251 <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  803f25:	89 d8                	mov    %ebx,%eax
+  803f27:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  803f2c:	e8 b9 fe ff ff       	call   803dea <cow_copy>
+  803f31:	eb c2                	jmp    803ef5 <pgfault+0x4a>
+
+00803f33 <cow_enable>:
+{
+  803f33:	55                   	push   %ebp
+  803f34:	89 e5                	mov    %esp,%ebp
+  803f36:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  803f39:	68 ab 3e 80 00       	push   $0x803eab
+  803f3e:	e8 28 06 00 00       	call   80456b <set_pgfault_handler>
+}
+  803f43:	83 c4 10             	add    $0x10,%esp
+  803f46:	c9                   	leave
+  803f47:	c3                   	ret
+
+00803f48 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  803f48:	55                   	push   %ebp
+  803f49:	89 e5                	mov    %esp,%ebp
+  803f4b:	57                   	push   %edi
+  803f4c:	56                   	push   %esi
+  803f4d:	53                   	push   %ebx
+  803f4e:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  803f51:	68 ab 3e 80 00       	push   $0x803eab
+  803f56:	e8 10 06 00 00       	call   80456b <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  803f5b:	b8 07 00 00 00       	mov    $0x7,%eax
+  803f60:	cd 30                	int    $0x30
+  803f62:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  803f65:	83 c4 10             	add    $0x10,%esp
+  803f68:	85 c0                	test   %eax,%eax
+  803f6a:	78 4b                	js     803fb7 <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  803f6c:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  803f71:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803f76:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  803f79:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  803f7d:	0f 85 16 01 00 00    	jne    804099 <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803f83:	e8 6e cd ff ff       	call   800cf6 <sys_getenvid>
+  803f88:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803f8d:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803f8f:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  803f95:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803f9b:	77 32                	ja     803fcf <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803f9d:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  803fa2:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  803fa4:	c1 ea 10             	shr    $0x10,%edx
+  803fa7:	74 26                	je     803fcf <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803fa9:	c1 e2 10             	shl    $0x10,%edx
+  803fac:	89 d1                	mov    %edx,%ecx
+  803fae:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803fb3:	29 ca                	sub    %ecx,%edx
+  803fb5:	eb 1e                	jmp    803fd5 <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  803fb7:	83 ec 08             	sub    $0x8,%esp
+  803fba:	89 c7                	mov    %eax,%edi
+  803fbc:	50                   	push   %eax
+  803fbd:	68 05 50 80 00       	push   $0x805005
+  803fc2:	e8 65 c3 ff ff       	call   80032c <cprintf>
+		return eid;
+  803fc7:	83 c4 10             	add    $0x10,%esp
+  803fca:	e9 6c 01 00 00       	jmp    80413b <fork+0x1f3>
+		return pthread_main_tls;
+  803fcf:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803fd5:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  803fd8:	c1 e0 04             	shl    $0x4,%eax
+  803fdb:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803fe0:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  803fe2:	e8 10 fb ff ff       	call   803af7 <pthread_fork_child>
+		return eid;
+  803fe7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  803fea:	e9 4c 01 00 00       	jmp    80413b <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  803fef:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  803ff5:	89 da                	mov    %ebx,%edx
+  803ff7:	89 f8                	mov    %edi,%eax
+  803ff9:	e8 af fd ff ff       	call   803dad <duppage>
+  803ffe:	85 c0                	test   %eax,%eax
+  804000:	79 28                	jns    80402a <fork+0xe2>
+  804002:	89 c7                	mov    %eax,%edi
+  804004:	e9 32 01 00 00       	jmp    80413b <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  804009:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  80400f:	83 f9 05             	cmp    $0x5,%ecx
+  804012:	75 58                	jne    80406c <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  804014:	b9 05 00 00 00       	mov    $0x5,%ecx
+  804019:	89 da                	mov    %ebx,%edx
+  80401b:	89 f8                	mov    %edi,%eax
+  80401d:	e8 8b fd ff ff       	call   803dad <duppage>
+  804022:	85 c0                	test   %eax,%eax
+  804024:	0f 88 0f 01 00 00    	js     804139 <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  80402a:	83 c3 01             	add    $0x1,%ebx
+  80402d:	39 de                	cmp    %ebx,%esi
+  80402f:	74 54                	je     804085 <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  804031:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  804038:	f6 c1 05             	test   $0x5,%cl
+  80403b:	74 ed                	je     80402a <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  80403d:	f6 c5 04             	test   $0x4,%ch
+  804040:	75 ad                	jne    803fef <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  804042:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  804048:	74 bf                	je     804009 <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  80404a:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  804050:	74 d8                	je     80402a <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  804052:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  804058:	89 da                	mov    %ebx,%edx
+  80405a:	89 f8                	mov    %edi,%eax
+  80405c:	e8 cd fc ff ff       	call   803d2e <duppage_cow>
+  804061:	85 c0                	test   %eax,%eax
+  804063:	79 c5                	jns    80402a <fork+0xe2>
+  804065:	89 c7                	mov    %eax,%edi
+  804067:	e9 cf 00 00 00       	jmp    80413b <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  80406c:	68 50 4f 80 00       	push   $0x804f50
+  804071:	68 5d 4d 80 00       	push   $0x804d5d
+  804076:	68 c6 00 00 00       	push   $0xc6
+  80407b:	68 fa 4f 80 00       	push   $0x804ffa
+  804080:	e8 cc c1 ff ff       	call   800251 <_panic>
+  804085:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804088:	83 c1 01             	add    $0x1,%ecx
+  80408b:	81 c6 00 04 00 00    	add    $0x400,%esi
+  804091:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  804097:	74 18                	je     8040b1 <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  804099:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  8040a0:	a8 07                	test   $0x7,%al
+  8040a2:	74 e4                	je     804088 <fork+0x140>
+  8040a4:	89 cb                	mov    %ecx,%ebx
+  8040a6:	c1 e3 0a             	shl    $0xa,%ebx
+  8040a9:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8040ac:	e9 7c ff ff ff       	jmp    80402d <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  8040b1:	83 ec 04             	sub    $0x4,%esp
+  8040b4:	6a 07                	push   $0x7
+  8040b6:	68 00 f0 bf ee       	push   $0xeebff000
+  8040bb:	ff 75 e4             	push   -0x1c(%ebp)
+  8040be:	e8 8b cc ff ff       	call   800d4e <sys_page_alloc>
+  8040c3:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8040c5:	83 c4 10             	add    $0x10,%esp
+  8040c8:	85 c0                	test   %eax,%eax
+  8040ca:	78 34                	js     804100 <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  8040cc:	83 ec 08             	sub    $0x8,%esp
+  8040cf:	68 a9 45 80 00       	push   $0x8045a9
+  8040d4:	ff 75 e4             	push   -0x1c(%ebp)
+  8040d7:	e8 ef cd ff ff       	call   800ecb <sys_env_set_pgfault_upcall>
+  8040dc:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8040de:	83 c4 10             	add    $0x10,%esp
+  8040e1:	85 c0                	test   %eax,%eax
+  8040e3:	78 2e                	js     804113 <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  8040e5:	83 ec 08             	sub    $0x8,%esp
+  8040e8:	6a 02                	push   $0x2
+  8040ea:	ff 75 e4             	push   -0x1c(%ebp)
+  8040ed:	e8 41 cd ff ff       	call   800e33 <sys_env_set_status>
+  8040f2:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8040f4:	83 c4 10             	add    $0x10,%esp
+  8040f7:	85 c0                	test   %eax,%eax
+  8040f9:	78 2b                	js     804126 <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  8040fb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8040fe:	eb 3b                	jmp    80413b <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  804100:	83 ec 08             	sub    $0x8,%esp
+  804103:	50                   	push   %eax
+  804104:	68 78 4f 80 00       	push   $0x804f78
+  804109:	e8 1e c2 ff ff       	call   80032c <cprintf>
+		return r;
+  80410e:	83 c4 10             	add    $0x10,%esp
+  804111:	eb 28                	jmp    80413b <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  804113:	83 ec 08             	sub    $0x8,%esp
+  804116:	50                   	push   %eax
+  804117:	68 a0 4f 80 00       	push   $0x804fa0
+  80411c:	e8 0b c2 ff ff       	call   80032c <cprintf>
+		return r;
+  804121:	83 c4 10             	add    $0x10,%esp
+  804124:	eb 15                	jmp    80413b <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  804126:	83 ec 08             	sub    $0x8,%esp
+  804129:	50                   	push   %eax
+  80412a:	68 15 50 80 00       	push   $0x805015
+  80412f:	e8 f8 c1 ff ff       	call   80032c <cprintf>
+		return r;
+  804134:	83 c4 10             	add    $0x10,%esp
+  804137:	eb 02                	jmp    80413b <fork+0x1f3>
+  804139:	89 c7                	mov    %eax,%edi
+}
+  80413b:	89 f8                	mov    %edi,%eax
+  80413d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804140:	5b                   	pop    %ebx
+  804141:	5e                   	pop    %esi
+  804142:	5f                   	pop    %edi
+  804143:	5d                   	pop    %ebp
+  804144:	c3                   	ret
+
+00804145 <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  804145:	55                   	push   %ebp
+  804146:	89 e5                	mov    %esp,%ebp
+  804148:	57                   	push   %edi
+  804149:	56                   	push   %esi
+  80414a:	53                   	push   %ebx
+  80414b:	83 ec 2c             	sub    $0x2c,%esp
+  80414e:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804150:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  804156:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80415b:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  804161:	77 0a                	ja     80416d <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804163:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  804168:	29 c3                	sub    %eax,%ebx
+  80416a:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  80416d:	83 ec 0c             	sub    $0xc,%esp
+  804170:	68 ab 3e 80 00       	push   $0x803eab
+  804175:	e8 f1 03 00 00       	call   80456b <set_pgfault_handler>
+  80417a:	b8 07 00 00 00       	mov    $0x7,%eax
+  80417f:	cd 30                	int    $0x30
+  804181:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  804184:	83 c4 10             	add    $0x10,%esp
+  804187:	85 c0                	test   %eax,%eax
+  804189:	78 30                	js     8041bb <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  80418b:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80418f:	74 42                	je     8041d3 <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  804191:	c1 e3 10             	shl    $0x10,%ebx
+  804194:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  804199:	29 d8                	sub    %ebx,%eax
+  80419b:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80419e:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  8041a3:	29 d8                	sub    %ebx,%eax
+  8041a5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8041a8:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8041ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8041b2:	89 f7                	mov    %esi,%edi
+  8041b4:	89 d6                	mov    %edx,%esi
+  8041b6:	e9 2c 01 00 00       	jmp    8042e7 <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  8041bb:	83 ec 08             	sub    $0x8,%esp
+  8041be:	89 c7                	mov    %eax,%edi
+  8041c0:	50                   	push   %eax
+  8041c1:	68 05 50 80 00       	push   $0x805005
+  8041c6:	e8 61 c1 ff ff       	call   80032c <cprintf>
+		return eid;
+  8041cb:	83 c4 10             	add    $0x10,%esp
+  8041ce:	e9 d5 00 00 00       	jmp    8042a8 <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8041d3:	e8 1e cb ff ff       	call   800cf6 <sys_getenvid>
+  8041d8:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8041dd:	89 c2                	mov    %eax,%edx
+  8041df:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8041e1:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  8041e7:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8041ec:	77 18                	ja     804206 <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8041ee:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8041f3:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  8041f5:	c1 e8 10             	shr    $0x10,%eax
+  8041f8:	74 0c                	je     804206 <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8041fa:	c1 e0 10             	shl    $0x10,%eax
+  8041fd:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  804202:	29 c1                	sub    %eax,%ecx
+  804204:	eb 06                	jmp    80420c <sfork+0xc7>
+		return pthread_main_tls;
+  804206:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+  80420c:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80420f:	c1 e0 04             	shl    $0x4,%eax
+  804212:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804217:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  804219:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  80421c:	e9 87 00 00 00       	jmp    8042a8 <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  804221:	f6 c5 04             	test   $0x4,%ch
+  804224:	74 6c                	je     804292 <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  804226:	89 ca                	mov    %ecx,%edx
+  804228:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  80422e:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  804234:	74 7c                	je     8042b2 <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  804236:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  80423c:	89 da                	mov    %ebx,%edx
+  80423e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804241:	e8 67 fb ff ff       	call   803dad <duppage>
+  804246:	85 c0                	test   %eax,%eax
+  804248:	0f 88 4f 01 00 00    	js     80439d <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  80424e:	83 c3 01             	add    $0x1,%ebx
+  804251:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  804254:	74 7a                	je     8042d0 <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  804256:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  804258:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  80425f:	f6 c1 01             	test   $0x1,%cl
+  804262:	74 ea                	je     80424e <sfork+0x109>
+  804264:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  80426a:	74 e2                	je     80424e <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  80426c:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  804272:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  804275:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  80427a:	76 a5                	jbe    804221 <sfork+0xdc>
+  80427c:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  804282:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  804285:	39 fa                	cmp    %edi,%edx
+  804287:	73 9d                	jae    804226 <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  804289:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  80428c:	39 fa                	cmp    %edi,%edx
+  80428e:	72 96                	jb     804226 <sfork+0xe1>
+  804290:	eb 8f                	jmp    804221 <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  804292:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  804298:	89 da                	mov    %ebx,%edx
+  80429a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80429d:	e8 8c fa ff ff       	call   803d2e <duppage_cow>
+  8042a2:	85 c0                	test   %eax,%eax
+  8042a4:	79 a8                	jns    80424e <sfork+0x109>
+  8042a6:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  8042a8:	89 f8                	mov    %edi,%eax
+  8042aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8042ad:	5b                   	pop    %ebx
+  8042ae:	5e                   	pop    %esi
+  8042af:	5f                   	pop    %edi
+  8042b0:	5d                   	pop    %ebp
+  8042b1:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  8042b2:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  8042b7:	e8 2e fb ff ff       	call   803dea <cow_copy>
+  8042bc:	85 c0                	test   %eax,%eax
+  8042be:	0f 88 d2 00 00 00    	js     804396 <sfork+0x251>
+				pte = uvpt[pn];
+  8042c4:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  8042cb:	e9 66 ff ff ff       	jmp    804236 <sfork+0xf1>
+  8042d0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8042d3:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8042d6:	83 c6 01             	add    $0x1,%esi
+  8042d9:	81 c7 00 04 00 00    	add    $0x400,%edi
+  8042df:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  8042e5:	74 1b                	je     804302 <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  8042e7:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  8042ee:	a8 01                	test   $0x1,%al
+  8042f0:	74 e4                	je     8042d6 <sfork+0x191>
+  8042f2:	89 f3                	mov    %esi,%ebx
+  8042f4:	c1 e3 0a             	shl    $0xa,%ebx
+  8042f7:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  8042fa:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  8042fd:	e9 4f ff ff ff       	jmp    804251 <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  804302:	83 ec 04             	sub    $0x4,%esp
+  804305:	6a 07                	push   $0x7
+  804307:	68 00 f0 bf ee       	push   $0xeebff000
+  80430c:	ff 75 e0             	push   -0x20(%ebp)
+  80430f:	e8 3a ca ff ff       	call   800d4e <sys_page_alloc>
+  804314:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804316:	83 c4 10             	add    $0x10,%esp
+  804319:	85 c0                	test   %eax,%eax
+  80431b:	78 37                	js     804354 <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  80431d:	83 ec 08             	sub    $0x8,%esp
+  804320:	68 a9 45 80 00       	push   $0x8045a9
+  804325:	ff 75 e0             	push   -0x20(%ebp)
+  804328:	e8 9e cb ff ff       	call   800ecb <sys_env_set_pgfault_upcall>
+  80432d:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80432f:	83 c4 10             	add    $0x10,%esp
+  804332:	85 c0                	test   %eax,%eax
+  804334:	78 34                	js     80436a <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  804336:	83 ec 08             	sub    $0x8,%esp
+  804339:	6a 02                	push   $0x2
+  80433b:	ff 75 e0             	push   -0x20(%ebp)
+  80433e:	e8 f0 ca ff ff       	call   800e33 <sys_env_set_status>
+  804343:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804345:	83 c4 10             	add    $0x10,%esp
+  804348:	85 c0                	test   %eax,%eax
+  80434a:	78 34                	js     804380 <sfork+0x23b>
+	return eid;
+  80434c:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  80434f:	e9 54 ff ff ff       	jmp    8042a8 <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  804354:	83 ec 08             	sub    $0x8,%esp
+  804357:	50                   	push   %eax
+  804358:	68 78 4f 80 00       	push   $0x804f78
+  80435d:	e8 ca bf ff ff       	call   80032c <cprintf>
+		return r;
+  804362:	83 c4 10             	add    $0x10,%esp
+  804365:	e9 3e ff ff ff       	jmp    8042a8 <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  80436a:	83 ec 08             	sub    $0x8,%esp
+  80436d:	50                   	push   %eax
+  80436e:	68 a0 4f 80 00       	push   $0x804fa0
+  804373:	e8 b4 bf ff ff       	call   80032c <cprintf>
+		return r;
+  804378:	83 c4 10             	add    $0x10,%esp
+  80437b:	e9 28 ff ff ff       	jmp    8042a8 <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  804380:	83 ec 08             	sub    $0x8,%esp
+  804383:	50                   	push   %eax
+  804384:	68 15 50 80 00       	push   $0x805015
+  804389:	e8 9e bf ff ff       	call   80032c <cprintf>
+		return r;
+  80438e:	83 c4 10             	add    $0x10,%esp
+  804391:	e9 12 ff ff ff       	jmp    8042a8 <sfork+0x163>
+  804396:	89 c7                	mov    %eax,%edi
+  804398:	e9 0b ff ff ff       	jmp    8042a8 <sfork+0x163>
+  80439d:	89 c7                	mov    %eax,%edi
+  80439f:	e9 04 ff ff ff       	jmp    8042a8 <sfork+0x163>
+
+008043a4 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8043a4:	55                   	push   %ebp
+  8043a5:	89 e5                	mov    %esp,%ebp
+  8043a7:	57                   	push   %edi
+  8043a8:	56                   	push   %esi
+  8043a9:	53                   	push   %ebx
+  8043aa:	83 ec 18             	sub    $0x18,%esp
+  8043ad:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8043b0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8043b3:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  8043b6:	85 c0                	test   %eax,%eax
+  8043b8:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8043bd:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  8043c0:	50                   	push   %eax
+  8043c1:	e8 7e cb ff ff       	call   800f44 <sys_ipc_recv>
+	if (r < 0) {
+  8043c6:	83 c4 10             	add    $0x10,%esp
+  8043c9:	85 c0                	test   %eax,%eax
+  8043cb:	78 2b                	js     8043f8 <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  8043cd:	85 ff                	test   %edi,%edi
+  8043cf:	74 55                	je     804426 <ipc_recv+0x82>
+  8043d1:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8043d3:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8043d9:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8043de:	77 39                	ja     804419 <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8043e0:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8043e5:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8043e7:	c1 e8 10             	shr    $0x10,%eax
+  8043ea:	74 2d                	je     804419 <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8043ec:	c1 e0 10             	shl    $0x10,%eax
+  8043ef:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8043f4:	29 c2                	sub    %eax,%edx
+  8043f6:	eb 27                	jmp    80441f <ipc_recv+0x7b>
+  8043f8:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  8043fa:	83 ec 08             	sub    $0x8,%esp
+  8043fd:	50                   	push   %eax
+  8043fe:	68 33 50 80 00       	push   $0x805033
+  804403:	e8 24 bf ff ff       	call   80032c <cprintf>
+		*from_env_store = 0;
+  804408:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  80440e:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  804414:	83 c4 10             	add    $0x10,%esp
+  804417:	eb 77                	jmp    804490 <ipc_recv+0xec>
+		return pthread_main_tls;
+  804419:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  80441f:	8b 02                	mov    (%edx),%eax
+  804421:	8b 40 78             	mov    0x78(%eax),%eax
+  804424:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804426:	85 f6                	test   %esi,%esi
+  804428:	74 34                	je     80445e <ipc_recv+0xba>
+  80442a:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80442c:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804432:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804437:	77 18                	ja     804451 <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804439:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80443e:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804440:	c1 e8 10             	shr    $0x10,%eax
+  804443:	74 0c                	je     804451 <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804445:	c1 e0 10             	shl    $0x10,%eax
+  804448:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80444d:	29 c2                	sub    %eax,%edx
+  80444f:	eb 06                	jmp    804457 <ipc_recv+0xb3>
+		return pthread_main_tls;
+  804451:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  804457:	8b 02                	mov    (%edx),%eax
+  804459:	8b 40 7c             	mov    0x7c(%eax),%eax
+  80445c:	89 06                	mov    %eax,(%esi)
+  80445e:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804460:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804466:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80446b:	77 18                	ja     804485 <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80446d:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804472:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804474:	c1 e8 10             	shr    $0x10,%eax
+  804477:	74 0c                	je     804485 <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804479:	c1 e0 10             	shl    $0x10,%eax
+  80447c:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804481:	29 c2                	sub    %eax,%edx
+  804483:	eb 06                	jmp    80448b <ipc_recv+0xe7>
+		return pthread_main_tls;
+  804485:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+	}
+	return thisenv->env_ipc_value;
+  80448b:	8b 02                	mov    (%edx),%eax
+  80448d:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  804490:	89 d8                	mov    %ebx,%eax
+  804492:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804495:	5b                   	pop    %ebx
+  804496:	5e                   	pop    %esi
+  804497:	5f                   	pop    %edi
+  804498:	5d                   	pop    %ebp
+  804499:	c3                   	ret
+
+0080449a <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  80449a:	55                   	push   %ebp
+  80449b:	89 e5                	mov    %esp,%ebp
+  80449d:	57                   	push   %edi
+  80449e:	56                   	push   %esi
+  80449f:	53                   	push   %ebx
+  8044a0:	83 ec 0c             	sub    $0xc,%esp
+  8044a3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8044a6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8044a9:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  8044ac:	85 db                	test   %ebx,%ebx
+  8044ae:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8044b3:	0f 44 d8             	cmove  %eax,%ebx
+  8044b6:	eb 05                	jmp    8044bd <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  8044b8:	e8 65 c8 ff ff       	call   800d22 <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  8044bd:	57                   	push   %edi
+  8044be:	53                   	push   %ebx
+  8044bf:	ff 75 0c             	push   0xc(%ebp)
+  8044c2:	56                   	push   %esi
+  8044c3:	e8 4f ca ff ff       	call   800f17 <sys_ipc_try_send>
+		if (r == 0) {
+  8044c8:	83 c4 10             	add    $0x10,%esp
+  8044cb:	85 c0                	test   %eax,%eax
+  8044cd:	74 19                	je     8044e8 <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  8044cf:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8044d2:	74 e4                	je     8044b8 <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  8044d4:	83 ec 0c             	sub    $0xc,%esp
+  8044d7:	50                   	push   %eax
+  8044d8:	57                   	push   %edi
+  8044d9:	53                   	push   %ebx
+  8044da:	56                   	push   %esi
+  8044db:	68 4c 50 80 00       	push   $0x80504c
+  8044e0:	e8 47 be ff ff       	call   80032c <cprintf>
+			return;
+  8044e5:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  8044e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8044eb:	5b                   	pop    %ebx
+  8044ec:	5e                   	pop    %esi
+  8044ed:	5f                   	pop    %edi
+  8044ee:	5d                   	pop    %ebp
+  8044ef:	c3                   	ret
+
+008044f0 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8044f0:	55                   	push   %ebp
+  8044f1:	89 e5                	mov    %esp,%ebp
+  8044f3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8044f6:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  8044fb:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8044fe:	c1 e0 04             	shl    $0x4,%eax
+  804501:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804506:	8b 40 50             	mov    0x50(%eax),%eax
+  804509:	39 c8                	cmp    %ecx,%eax
+  80450b:	74 12                	je     80451f <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80450d:	83 c2 01             	add    $0x1,%edx
+  804510:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  804516:	75 e3                	jne    8044fb <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  804518:	b8 00 00 00 00       	mov    $0x0,%eax
+  80451d:	eb 0e                	jmp    80452d <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80451f:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804522:	c1 e0 04             	shl    $0x4,%eax
+  804525:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80452a:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80452d:	5d                   	pop    %ebp
+  80452e:	c3                   	ret
+
+0080452f <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80452f:	55                   	push   %ebp
+  804530:	89 e5                	mov    %esp,%ebp
+  804532:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804535:	89 c2                	mov    %eax,%edx
+  804537:	c1 ea 16             	shr    $0x16,%edx
+  80453a:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  804541:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804546:	f6 c1 01             	test   $0x1,%cl
+  804549:	74 1c                	je     804567 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  80454b:	c1 e8 0c             	shr    $0xc,%eax
+  80454e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  804555:	a8 01                	test   $0x1,%al
+  804557:	74 0e                	je     804567 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  804559:	c1 e8 0c             	shr    $0xc,%eax
+  80455c:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  804563:	ef 
+  804564:	0f b7 d2             	movzwl %dx,%edx
+}
+  804567:	89 d0                	mov    %edx,%eax
+  804569:	5d                   	pop    %ebp
+  80456a:	c3                   	ret
+
+0080456b <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  80456b:	55                   	push   %ebp
+  80456c:	89 e5                	mov    %esp,%ebp
+  80456e:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  804571:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  804578:	74 0a                	je     804584 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  80457a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80457d:	a3 00 a0 80 00       	mov    %eax,0x80a000
+}
+  804582:	c9                   	leave
+  804583:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  804584:	83 ec 04             	sub    $0x4,%esp
+  804587:	6a 07                	push   $0x7
+  804589:	68 00 f0 bf ee       	push   $0xeebff000
+  80458e:	6a 00                	push   $0x0
+  804590:	e8 b9 c7 ff ff       	call   800d4e <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804595:	83 c4 08             	add    $0x8,%esp
+  804598:	68 a9 45 80 00       	push   $0x8045a9
+  80459d:	6a 00                	push   $0x0
+  80459f:	e8 27 c9 ff ff       	call   800ecb <sys_env_set_pgfault_upcall>
+  8045a4:	83 c4 10             	add    $0x10,%esp
+  8045a7:	eb d1                	jmp    80457a <set_pgfault_handler+0xf>
+
+008045a9 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8045a9:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8045aa:	a1 00 a0 80 00       	mov    0x80a000,%eax
+	call *%eax
+  8045af:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8045b1:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  8045b4:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  8045b8:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  8045bc:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  8045bf:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  8045c3:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  8045c5:	83 c4 08             	add    $0x8,%esp
+	popal
+  8045c8:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  8045c9:	83 c4 04             	add    $0x4,%esp
+	popfl
+  8045cc:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  8045cd:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  8045ce:	c3                   	ret
+
+008045cf <udm>:
+  8045cf:	57                   	push   %edi
+  8045d0:	56                   	push   %esi
+  8045d1:	53                   	push   %ebx
+  8045d2:	83 ec 20             	sub    $0x20,%esp
+  8045d5:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8045d9:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8045dd:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8045e1:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8045e5:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8045e9:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8045ed:	89 d1                	mov    %edx,%ecx
+  8045ef:	09 c1                	or     %eax,%ecx
+  8045f1:	0f 84 91 00 00 00    	je     804688 <udm+0xb9>
+  8045f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  804601:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804606:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80460d:	00 
+  80460e:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  804615:	00 
+  804616:	eb 08                	jmp    804620 <udm+0x51>
+  804618:	83 e9 01             	sub    $0x1,%ecx
+  80461b:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80461e:	74 7c                	je     80469c <udm+0xcd>
+  804620:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804624:	01 c0                	add    %eax,%eax
+  804626:	89 c6                	mov    %eax,%esi
+  804628:	89 d7                	mov    %edx,%edi
+  80462a:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80462e:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804632:	0f ad d0             	shrd   %cl,%edx,%eax
+  804635:	d3 ea                	shr    %cl,%edx
+  804637:	f6 c1 20             	test   $0x20,%cl
+  80463a:	74 04                	je     804640 <udm+0x71>
+  80463c:	89 d0                	mov    %edx,%eax
+  80463e:	31 d2                	xor    %edx,%edx
+  804640:	83 e0 01             	and    $0x1,%eax
+  804643:	89 04 24             	mov    %eax,(%esp)
+  804646:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80464d:	00 
+  80464e:	8b 04 24             	mov    (%esp),%eax
+  804651:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804655:	09 f0                	or     %esi,%eax
+  804657:	09 fa                	or     %edi,%edx
+  804659:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80465d:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804661:	39 f0                	cmp    %esi,%eax
+  804663:	89 d3                	mov    %edx,%ebx
+  804665:	19 fb                	sbb    %edi,%ebx
+  804667:	72 af                	jb     804618 <udm+0x49>
+  804669:	29 f0                	sub    %esi,%eax
+  80466b:	19 fa                	sbb    %edi,%edx
+  80466d:	89 cf                	mov    %ecx,%edi
+  80466f:	c1 ef 05             	shr    $0x5,%edi
+  804672:	83 e7 01             	and    $0x1,%edi
+  804675:	89 fe                	mov    %edi,%esi
+  804677:	83 f6 01             	xor    $0x1,%esi
+  80467a:	d3 e6                	shl    %cl,%esi
+  80467c:	d3 e7                	shl    %cl,%edi
+  80467e:	09 74 24 18          	or     %esi,0x18(%esp)
+  804682:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804686:	eb 90                	jmp    804618 <udm+0x49>
+  804688:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80468c:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804690:	89 f0                	mov    %esi,%eax
+  804692:	89 fa                	mov    %edi,%edx
+  804694:	89 74 24 18          	mov    %esi,0x18(%esp)
+  804698:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  80469c:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  8046a0:	89 01                	mov    %eax,(%ecx)
+  8046a2:	89 51 04             	mov    %edx,0x4(%ecx)
+  8046a5:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8046a9:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8046ad:	83 c4 20             	add    $0x20,%esp
+  8046b0:	5b                   	pop    %ebx
+  8046b1:	5e                   	pop    %esi
+  8046b2:	5f                   	pop    %edi
+  8046b3:	c3                   	ret
+
+008046b4 <__udivdi3>:
+  8046b4:	83 ec 18             	sub    $0x18,%esp
+  8046b7:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8046bb:	50                   	push   %eax
+  8046bc:	ff 74 24 2c          	push   0x2c(%esp)
+  8046c0:	ff 74 24 2c          	push   0x2c(%esp)
+  8046c4:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8046c8:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8046cc:	e8 fe fe ff ff       	call   8045cf <udm>
+  8046d1:	83 c4 24             	add    $0x24,%esp
+  8046d4:	c3                   	ret
+
+008046d5 <__umoddi3>:
+  8046d5:	83 ec 18             	sub    $0x18,%esp
+  8046d8:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8046dc:	50                   	push   %eax
+  8046dd:	ff 74 24 2c          	push   0x2c(%esp)
+  8046e1:	ff 74 24 2c          	push   0x2c(%esp)
+  8046e5:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8046e9:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8046ed:	e8 dd fe ff ff       	call   8045cf <udm>
+  8046f2:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8046f6:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8046fa:	83 c4 24             	add    $0x24,%esp
+  8046fd:	c3                   	ret
+
+008046fe <__divdi3>:
+  8046fe:	56                   	push   %esi
+  8046ff:	53                   	push   %ebx
+  804700:	83 ec 14             	sub    $0x14,%esp
+  804703:	8b 44 24 20          	mov    0x20(%esp),%eax
+  804707:	8b 54 24 24          	mov    0x24(%esp),%edx
+  80470b:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  80470f:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  804713:	85 d2                	test   %edx,%edx
+  804715:	78 18                	js     80472f <__divdi3+0x31>
+  804717:	85 db                	test   %ebx,%ebx
+  804719:	78 3e                	js     804759 <__divdi3+0x5b>
+  80471b:	83 ec 04             	sub    $0x4,%esp
+  80471e:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804722:	56                   	push   %esi
+  804723:	53                   	push   %ebx
+  804724:	51                   	push   %ecx
+  804725:	e8 a5 fe ff ff       	call   8045cf <udm>
+  80472a:	83 c4 10             	add    $0x10,%esp
+  80472d:	eb 24                	jmp    804753 <__divdi3+0x55>
+  80472f:	f7 d8                	neg    %eax
+  804731:	83 d2 00             	adc    $0x0,%edx
+  804734:	f7 da                	neg    %edx
+  804736:	85 db                	test   %ebx,%ebx
+  804738:	78 3a                	js     804774 <__divdi3+0x76>
+  80473a:	83 ec 04             	sub    $0x4,%esp
+  80473d:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804741:	56                   	push   %esi
+  804742:	53                   	push   %ebx
+  804743:	51                   	push   %ecx
+  804744:	e8 86 fe ff ff       	call   8045cf <udm>
+  804749:	83 c4 10             	add    $0x10,%esp
+  80474c:	f7 d8                	neg    %eax
+  80474e:	83 d2 00             	adc    $0x0,%edx
+  804751:	f7 da                	neg    %edx
+  804753:	83 c4 14             	add    $0x14,%esp
+  804756:	5b                   	pop    %ebx
+  804757:	5e                   	pop    %esi
+  804758:	c3                   	ret
+  804759:	83 ec 04             	sub    $0x4,%esp
+  80475c:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804760:	56                   	push   %esi
+  804761:	f7 d9                	neg    %ecx
+  804763:	83 d3 00             	adc    $0x0,%ebx
+  804766:	f7 db                	neg    %ebx
+  804768:	53                   	push   %ebx
+  804769:	51                   	push   %ecx
+  80476a:	e8 60 fe ff ff       	call   8045cf <udm>
+  80476f:	83 c4 10             	add    $0x10,%esp
+  804772:	eb d8                	jmp    80474c <__divdi3+0x4e>
+  804774:	83 ec 04             	sub    $0x4,%esp
+  804777:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80477b:	56                   	push   %esi
+  80477c:	f7 d9                	neg    %ecx
+  80477e:	83 d3 00             	adc    $0x0,%ebx
+  804781:	f7 db                	neg    %ebx
+  804783:	53                   	push   %ebx
+  804784:	51                   	push   %ecx
+  804785:	e8 45 fe ff ff       	call   8045cf <udm>
+  80478a:	83 c4 10             	add    $0x10,%esp
+  80478d:	eb c4                	jmp    804753 <__divdi3+0x55>
+
+0080478f <__moddi3>:
+  80478f:	55                   	push   %ebp
+  804790:	57                   	push   %edi
+  804791:	56                   	push   %esi
+  804792:	53                   	push   %ebx
+  804793:	83 ec 24             	sub    $0x24,%esp
+  804796:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80479a:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80479e:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8047a2:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8047a6:	85 d2                	test   %edx,%edx
+  8047a8:	78 3b                	js     8047e5 <__moddi3+0x56>
+  8047aa:	83 ec 04             	sub    $0x4,%esp
+  8047ad:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8047b1:	56                   	push   %esi
+  8047b2:	89 ce                	mov    %ecx,%esi
+  8047b4:	f7 de                	neg    %esi
+  8047b6:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8047ba:	89 de                	mov    %ebx,%esi
+  8047bc:	83 d6 00             	adc    $0x0,%esi
+  8047bf:	f7 de                	neg    %esi
+  8047c1:	89 74 24 14          	mov    %esi,0x14(%esp)
+  8047c5:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8047c9:	0f 48 f1             	cmovs  %ecx,%esi
+  8047cc:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  8047d1:	53                   	push   %ebx
+  8047d2:	56                   	push   %esi
+  8047d3:	e8 f7 fd ff ff       	call   8045cf <udm>
+  8047d8:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8047dc:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8047e0:	83 c4 10             	add    $0x10,%esp
+  8047e3:	eb 47                	jmp    80482c <__moddi3+0x9d>
+  8047e5:	f7 d8                	neg    %eax
+  8047e7:	83 d2 00             	adc    $0x0,%edx
+  8047ea:	f7 da                	neg    %edx
+  8047ec:	83 ec 04             	sub    $0x4,%esp
+  8047ef:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8047f3:	56                   	push   %esi
+  8047f4:	89 cf                	mov    %ecx,%edi
+  8047f6:	f7 df                	neg    %edi
+  8047f8:	89 de                	mov    %ebx,%esi
+  8047fa:	83 d6 00             	adc    $0x0,%esi
+  8047fd:	f7 de                	neg    %esi
+  8047ff:	0f 49 cf             	cmovns %edi,%ecx
+  804802:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  804806:	0f 49 de             	cmovns %esi,%ebx
+  804809:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  80480d:	ff 74 24 0c          	push   0xc(%esp)
+  804811:	ff 74 24 0c          	push   0xc(%esp)
+  804815:	e8 b5 fd ff ff       	call   8045cf <udm>
+  80481a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80481e:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804822:	f7 d8                	neg    %eax
+  804824:	83 d2 00             	adc    $0x0,%edx
+  804827:	f7 da                	neg    %edx
+  804829:	83 c4 10             	add    $0x10,%esp
+  80482c:	83 c4 24             	add    $0x24,%esp
+  80482f:	5b                   	pop    %ebx
+  804830:	5e                   	pop    %esi
+  804831:	5f                   	pop    %edi
+  804832:	5d                   	pop    %ebp
+  804833:	c3                   	ret
@@ -0,0 +1,9740 @@
+
+obj/user/testbss.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 ab 00 00 00       	call   8000dc <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+uint32_t bigarray[ARRAYSIZE];
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 14             	sub    $0x14,%esp
+	int i;
+
+	cprintf("Making sure bss works right...\n");
+  800039:	68 80 47 80 00       	push   $0x804780
+  80003e:	e8 17 02 00 00       	call   80025a <cprintf>
+  800043:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < ARRAYSIZE; i++)
+  800046:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (bigarray[i] != 0)
+  80004b:	83 3c 85 c0 62 80 00 	cmpl   $0x0,0x8062c0(,%eax,4)
+  800052:	00 
+  800053:	75 63                	jne    8000b8 <umain+0x85>
+	for (i = 0; i < ARRAYSIZE; i++)
+  800055:	83 c0 01             	add    $0x1,%eax
+  800058:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80005d:	75 ec                	jne    80004b <umain+0x18>
+			panic("bigarray[%d] isn't cleared!\n", i);
+	for (i = 0; i < ARRAYSIZE; i++)
+  80005f:	b8 00 00 00 00       	mov    $0x0,%eax
+		bigarray[i] = i;
+  800064:	89 04 85 c0 62 80 00 	mov    %eax,0x8062c0(,%eax,4)
+	for (i = 0; i < ARRAYSIZE; i++)
+  80006b:	83 c0 01             	add    $0x1,%eax
+  80006e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800073:	75 ef                	jne    800064 <umain+0x31>
+	for (i = 0; i < ARRAYSIZE; i++)
+  800075:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (bigarray[i] != i)
+  80007a:	39 04 85 c0 62 80 00 	cmp    %eax,0x8062c0(,%eax,4)
+  800081:	75 47                	jne    8000ca <umain+0x97>
+	for (i = 0; i < ARRAYSIZE; i++)
+  800083:	83 c0 01             	add    $0x1,%eax
+  800086:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80008b:	75 ed                	jne    80007a <umain+0x47>
+			panic("bigarray[%d] didn't hold its value!\n", i);
+
+	cprintf("Yes, good.  Now doing a wild write off the end...\n");
+  80008d:	83 ec 0c             	sub    $0xc,%esp
+  800090:	68 c8 47 80 00       	push   $0x8047c8
+  800095:	e8 c0 01 00 00       	call   80025a <cprintf>
+	bigarray[ARRAYSIZE+1024] = 0;
+  80009a:	c7 05 c0 72 c0 00 00 	movl   $0x0,0xc072c0
+  8000a1:	00 00 00 
+	panic("SHOULD HAVE TRAPPED!!!");
+  8000a4:	83 c4 0c             	add    $0xc,%esp
+  8000a7:	68 27 48 80 00       	push   $0x804827
+  8000ac:	6a 1a                	push   $0x1a
+  8000ae:	68 18 48 80 00       	push   $0x804818
+  8000b3:	e8 c7 00 00 00       	call   80017f <_panic>
+			panic("bigarray[%d] isn't cleared!\n", i);
+  8000b8:	50                   	push   %eax
+  8000b9:	68 fb 47 80 00       	push   $0x8047fb
+  8000be:	6a 11                	push   $0x11
+  8000c0:	68 18 48 80 00       	push   $0x804818
+  8000c5:	e8 b5 00 00 00       	call   80017f <_panic>
+			panic("bigarray[%d] didn't hold its value!\n", i);
+  8000ca:	50                   	push   %eax
+  8000cb:	68 a0 47 80 00       	push   $0x8047a0
+  8000d0:	6a 16                	push   $0x16
+  8000d2:	68 18 48 80 00       	push   $0x804818
+  8000d7:	e8 a3 00 00 00       	call   80017f <_panic>
+
+008000dc <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000dc:	55                   	push   %ebp
+  8000dd:	89 e5                	mov    %esp,%ebp
+  8000df:	57                   	push   %edi
+  8000e0:	56                   	push   %esi
+  8000e1:	53                   	push   %ebx
+  8000e2:	83 ec 1c             	sub    $0x1c,%esp
+  8000e5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000e8:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  8000eb:	e8 34 0b 00 00       	call   800c24 <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  8000f0:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  8000f3:	89 15 c0 62 c0 00    	mov    %edx,0xc062c0
+	thisenv = &envs[ENVX(eid)];
+  8000f9:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000fe:	89 c1                	mov    %eax,%ecx
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  800100:	89 e7                	mov    %esp,%edi
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800102:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  800108:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80010d:	77 16                	ja     800125 <libmain+0x49>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80010f:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800114:	29 f8                	sub    %edi,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  800116:	c1 e8 10             	shr    $0x10,%eax
+  800119:	74 0a                	je     800125 <libmain+0x49>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80011b:	c1 e0 10             	shl    $0x10,%eax
+  80011e:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800123:	29 c2                	sub    %eax,%edx
+  800125:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  800128:	c1 e0 04             	shl    $0x4,%eax
+  80012b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800130:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800132:	85 db                	test   %ebx,%ebx
+  800134:	7e 07                	jle    80013d <libmain+0x61>
+		binaryname = argv[0];
+  800136:	8b 06                	mov    (%esi),%eax
+  800138:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  80013d:	83 ec 08             	sub    $0x8,%esp
+  800140:	56                   	push   %esi
+  800141:	53                   	push   %ebx
+  800142:	e8 ec fe ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800147:	e8 0b 00 00 00       	call   800157 <exit>
+}
+  80014c:	83 c4 10             	add    $0x10,%esp
+  80014f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800152:	5b                   	pop    %ebx
+  800153:	5e                   	pop    %esi
+  800154:	5f                   	pop    %edi
+  800155:	5d                   	pop    %ebp
+  800156:	c3                   	ret
+
+00800157 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800157:	55                   	push   %ebp
+  800158:	89 e5                	mov    %esp,%ebp
+  80015a:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  80015d:	6a 00                	push   $0x0
+  80015f:	e8 15 21 00 00       	call   802279 <fflush>
+	pthread_kill_others();
+  800164:	e8 80 37 00 00       	call   8038e9 <pthread_kill_others>
+	close_all();
+  800169:	e8 ae 11 00 00       	call   80131c <close_all>
+	sys_env_destroy(0);
+  80016e:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800175:	e8 5f 0a 00 00       	call   800bd9 <sys_env_destroy>
+}
+  80017a:	83 c4 10             	add    $0x10,%esp
+  80017d:	c9                   	leave
+  80017e:	c3                   	ret
+
+0080017f <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80017f:	55                   	push   %ebp
+  800180:	89 e5                	mov    %esp,%ebp
+  800182:	56                   	push   %esi
+  800183:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800184:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800187:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  80018d:	e8 92 0a 00 00       	call   800c24 <sys_getenvid>
+  800192:	83 ec 0c             	sub    $0xc,%esp
+  800195:	ff 75 0c             	push   0xc(%ebp)
+  800198:	ff 75 08             	push   0x8(%ebp)
+  80019b:	56                   	push   %esi
+  80019c:	50                   	push   %eax
+  80019d:	68 48 48 80 00       	push   $0x804848
+  8001a2:	e8 b3 00 00 00       	call   80025a <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8001a7:	83 c4 18             	add    $0x18,%esp
+  8001aa:	53                   	push   %ebx
+  8001ab:	ff 75 10             	push   0x10(%ebp)
+  8001ae:	e8 56 00 00 00       	call   800209 <vcprintf>
+	cprintf("\n");
+  8001b3:	c7 04 24 16 48 80 00 	movl   $0x804816,(%esp)
+  8001ba:	e8 9b 00 00 00       	call   80025a <cprintf>
+  8001bf:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8001c2:	cc                   	int3
+	while (1)
+  8001c3:	eb fd                	jmp    8001c2 <_panic+0x43>
+
+008001c5 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8001c5:	55                   	push   %ebp
+  8001c6:	89 e5                	mov    %esp,%ebp
+  8001c8:	53                   	push   %ebx
+  8001c9:	83 ec 04             	sub    $0x4,%esp
+  8001cc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8001cf:	8b 13                	mov    (%ebx),%edx
+  8001d1:	8d 42 01             	lea    0x1(%edx),%eax
+  8001d4:	89 03                	mov    %eax,(%ebx)
+  8001d6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001d9:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001dd:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001e2:	74 09                	je     8001ed <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001e4:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001eb:	c9                   	leave
+  8001ec:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001ed:	83 ec 08             	sub    $0x8,%esp
+  8001f0:	68 ff 00 00 00       	push   $0xff
+  8001f5:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001f8:	50                   	push   %eax
+  8001f9:	e8 84 09 00 00       	call   800b82 <sys_cputs>
+		b->idx = 0;
+  8001fe:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800204:	83 c4 10             	add    $0x10,%esp
+  800207:	eb db                	jmp    8001e4 <putch+0x1f>
+
+00800209 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800209:	55                   	push   %ebp
+  80020a:	89 e5                	mov    %esp,%ebp
+  80020c:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800212:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800219:	00 00 00 
+	b.cnt = 0;
+  80021c:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800223:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800226:	ff 75 0c             	push   0xc(%ebp)
+  800229:	ff 75 08             	push   0x8(%ebp)
+  80022c:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800232:	50                   	push   %eax
+  800233:	68 c5 01 80 00       	push   $0x8001c5
+  800238:	e8 14 01 00 00       	call   800351 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80023d:	83 c4 08             	add    $0x8,%esp
+  800240:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800246:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80024c:	50                   	push   %eax
+  80024d:	e8 30 09 00 00       	call   800b82 <sys_cputs>
+
+	return b.cnt;
+}
+  800252:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800258:	c9                   	leave
+  800259:	c3                   	ret
+
+0080025a <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80025a:	55                   	push   %ebp
+  80025b:	89 e5                	mov    %esp,%ebp
+  80025d:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800260:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800263:	50                   	push   %eax
+  800264:	ff 75 08             	push   0x8(%ebp)
+  800267:	e8 9d ff ff ff       	call   800209 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80026c:	c9                   	leave
+  80026d:	c3                   	ret
+
+0080026e <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80026e:	55                   	push   %ebp
+  80026f:	89 e5                	mov    %esp,%ebp
+  800271:	57                   	push   %edi
+  800272:	56                   	push   %esi
+  800273:	53                   	push   %ebx
+  800274:	83 ec 1c             	sub    $0x1c,%esp
+  800277:	89 c7                	mov    %eax,%edi
+  800279:	89 d6                	mov    %edx,%esi
+  80027b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80027e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800281:	89 d1                	mov    %edx,%ecx
+  800283:	89 c2                	mov    %eax,%edx
+  800285:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800288:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80028b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80028e:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800291:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800294:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80029b:	39 c2                	cmp    %eax,%edx
+  80029d:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8002a0:	72 3e                	jb     8002e0 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8002a2:	83 ec 0c             	sub    $0xc,%esp
+  8002a5:	ff 75 18             	push   0x18(%ebp)
+  8002a8:	83 eb 01             	sub    $0x1,%ebx
+  8002ab:	53                   	push   %ebx
+  8002ac:	50                   	push   %eax
+  8002ad:	83 ec 08             	sub    $0x8,%esp
+  8002b0:	ff 75 e4             	push   -0x1c(%ebp)
+  8002b3:	ff 75 e0             	push   -0x20(%ebp)
+  8002b6:	ff 75 dc             	push   -0x24(%ebp)
+  8002b9:	ff 75 d8             	push   -0x28(%ebp)
+  8002bc:	e8 21 43 00 00       	call   8045e2 <__udivdi3>
+  8002c1:	83 c4 18             	add    $0x18,%esp
+  8002c4:	52                   	push   %edx
+  8002c5:	50                   	push   %eax
+  8002c6:	89 f2                	mov    %esi,%edx
+  8002c8:	89 f8                	mov    %edi,%eax
+  8002ca:	e8 9f ff ff ff       	call   80026e <printnum>
+  8002cf:	83 c4 20             	add    $0x20,%esp
+  8002d2:	eb 13                	jmp    8002e7 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8002d4:	83 ec 08             	sub    $0x8,%esp
+  8002d7:	56                   	push   %esi
+  8002d8:	ff 75 18             	push   0x18(%ebp)
+  8002db:	ff d7                	call   *%edi
+  8002dd:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8002e0:	83 eb 01             	sub    $0x1,%ebx
+  8002e3:	85 db                	test   %ebx,%ebx
+  8002e5:	7f ed                	jg     8002d4 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8002e7:	83 ec 08             	sub    $0x8,%esp
+  8002ea:	56                   	push   %esi
+  8002eb:	83 ec 04             	sub    $0x4,%esp
+  8002ee:	ff 75 e4             	push   -0x1c(%ebp)
+  8002f1:	ff 75 e0             	push   -0x20(%ebp)
+  8002f4:	ff 75 dc             	push   -0x24(%ebp)
+  8002f7:	ff 75 d8             	push   -0x28(%ebp)
+  8002fa:	e8 04 43 00 00       	call   804603 <__umoddi3>
+  8002ff:	83 c4 14             	add    $0x14,%esp
+  800302:	0f be 80 6b 48 80 00 	movsbl 0x80486b(%eax),%eax
+  800309:	50                   	push   %eax
+  80030a:	ff d7                	call   *%edi
+}
+  80030c:	83 c4 10             	add    $0x10,%esp
+  80030f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800312:	5b                   	pop    %ebx
+  800313:	5e                   	pop    %esi
+  800314:	5f                   	pop    %edi
+  800315:	5d                   	pop    %ebp
+  800316:	c3                   	ret
+
+00800317 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800317:	55                   	push   %ebp
+  800318:	89 e5                	mov    %esp,%ebp
+  80031a:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80031d:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800321:	8b 10                	mov    (%eax),%edx
+  800323:	3b 50 04             	cmp    0x4(%eax),%edx
+  800326:	73 0a                	jae    800332 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800328:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80032b:	89 08                	mov    %ecx,(%eax)
+  80032d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800330:	88 02                	mov    %al,(%edx)
+}
+  800332:	5d                   	pop    %ebp
+  800333:	c3                   	ret
+
+00800334 <printfmt>:
+{
+  800334:	55                   	push   %ebp
+  800335:	89 e5                	mov    %esp,%ebp
+  800337:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80033a:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80033d:	50                   	push   %eax
+  80033e:	ff 75 10             	push   0x10(%ebp)
+  800341:	ff 75 0c             	push   0xc(%ebp)
+  800344:	ff 75 08             	push   0x8(%ebp)
+  800347:	e8 05 00 00 00       	call   800351 <vprintfmt>
+}
+  80034c:	83 c4 10             	add    $0x10,%esp
+  80034f:	c9                   	leave
+  800350:	c3                   	ret
+
+00800351 <vprintfmt>:
+{
+  800351:	55                   	push   %ebp
+  800352:	89 e5                	mov    %esp,%ebp
+  800354:	57                   	push   %edi
+  800355:	56                   	push   %esi
+  800356:	53                   	push   %ebx
+  800357:	83 ec 2c             	sub    $0x2c,%esp
+  80035a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80035d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800360:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800363:	eb 0a                	jmp    80036f <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800365:	83 ec 08             	sub    $0x8,%esp
+  800368:	53                   	push   %ebx
+  800369:	50                   	push   %eax
+  80036a:	ff d6                	call   *%esi
+  80036c:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  80036f:	83 c7 01             	add    $0x1,%edi
+  800372:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  800376:	83 f8 25             	cmp    $0x25,%eax
+  800379:	74 0c                	je     800387 <vprintfmt+0x36>
+			if (ch == '\0')
+  80037b:	85 c0                	test   %eax,%eax
+  80037d:	75 e6                	jne    800365 <vprintfmt+0x14>
+}
+  80037f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800382:	5b                   	pop    %ebx
+  800383:	5e                   	pop    %esi
+  800384:	5f                   	pop    %edi
+  800385:	5d                   	pop    %ebp
+  800386:	c3                   	ret
+		padc = ' ';
+  800387:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80038b:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800392:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800399:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8003a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  8003a5:	8d 47 01             	lea    0x1(%edi),%eax
+  8003a8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003ab:	0f b6 17             	movzbl (%edi),%edx
+  8003ae:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8003b1:	3c 55                	cmp    $0x55,%al
+  8003b3:	0f 87 c5 03 00 00    	ja     80077e <vprintfmt+0x42d>
+  8003b9:	0f b6 c0             	movzbl %al,%eax
+  8003bc:	ff 24 85 e0 49 80 00 	jmp    *0x8049e0(,%eax,4)
+  8003c3:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  8003c6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003c9:	eb da                	jmp    8003a5 <vprintfmt+0x54>
+  8003cb:	0f be d2             	movsbl %dl,%edx
+  8003ce:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8003d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003d6:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8003d9:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003dc:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8003e0:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8003e3:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8003e6:	83 f9 09             	cmp    $0x9,%ecx
+  8003e9:	77 55                	ja     800440 <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  8003eb:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8003ee:	eb e9                	jmp    8003d9 <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  8003f0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003f3:	8b 00                	mov    (%eax),%eax
+  8003f5:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003fb:	8d 40 04             	lea    0x4(%eax),%eax
+  8003fe:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  800401:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800404:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800408:	79 9b                	jns    8003a5 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80040a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80040d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800410:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800417:	eb 8c                	jmp    8003a5 <vprintfmt+0x54>
+			if (width < 0)
+  800419:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80041c:	85 d2                	test   %edx,%edx
+  80041e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800423:	0f 49 c2             	cmovns %edx,%eax
+  800426:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  800429:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80042c:	e9 74 ff ff ff       	jmp    8003a5 <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  800431:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800434:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80043b:	e9 65 ff ff ff       	jmp    8003a5 <vprintfmt+0x54>
+  800440:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800443:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800446:	eb bc                	jmp    800404 <vprintfmt+0xb3>
+			lflag++;
+  800448:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  80044b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80044e:	e9 52 ff ff ff       	jmp    8003a5 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800453:	8b 45 14             	mov    0x14(%ebp),%eax
+  800456:	8d 78 04             	lea    0x4(%eax),%edi
+  800459:	83 ec 08             	sub    $0x8,%esp
+  80045c:	53                   	push   %ebx
+  80045d:	ff 30                	push   (%eax)
+  80045f:	ff d6                	call   *%esi
+			break;
+  800461:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800464:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800467:	e9 b1 02 00 00       	jmp    80071d <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  80046c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80046f:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800472:	8b 10                	mov    (%eax),%edx
+  800474:	89 d0                	mov    %edx,%eax
+  800476:	f7 d8                	neg    %eax
+  800478:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80047b:	83 f8 14             	cmp    $0x14,%eax
+  80047e:	7f 23                	jg     8004a3 <vprintfmt+0x152>
+  800480:	8b 14 85 40 4b 80 00 	mov    0x804b40(,%eax,4),%edx
+  800487:	85 d2                	test   %edx,%edx
+  800489:	74 18                	je     8004a3 <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  80048b:	52                   	push   %edx
+  80048c:	68 af 4c 80 00       	push   $0x804caf
+  800491:	53                   	push   %ebx
+  800492:	56                   	push   %esi
+  800493:	e8 9c fe ff ff       	call   800334 <printfmt>
+  800498:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80049b:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80049e:	e9 7a 02 00 00       	jmp    80071d <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  8004a3:	50                   	push   %eax
+  8004a4:	68 83 48 80 00       	push   $0x804883
+  8004a9:	53                   	push   %ebx
+  8004aa:	56                   	push   %esi
+  8004ab:	e8 84 fe ff ff       	call   800334 <printfmt>
+  8004b0:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004b3:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8004b6:	e9 62 02 00 00       	jmp    80071d <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004bb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004be:	83 c0 04             	add    $0x4,%eax
+  8004c1:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8004c4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004c7:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8004c9:	85 c9                	test   %ecx,%ecx
+  8004cb:	b8 7c 48 80 00       	mov    $0x80487c,%eax
+  8004d0:	0f 45 c1             	cmovne %ecx,%eax
+  8004d3:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8004d6:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004da:	7e 06                	jle    8004e2 <vprintfmt+0x191>
+  8004dc:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8004e0:	75 0b                	jne    8004ed <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004e2:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8004e5:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8004e8:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004eb:	eb 5c                	jmp    800549 <vprintfmt+0x1f8>
+  8004ed:	83 ec 08             	sub    $0x8,%esp
+  8004f0:	ff 75 d0             	push   -0x30(%ebp)
+  8004f3:	ff 75 cc             	push   -0x34(%ebp)
+  8004f6:	e8 20 03 00 00       	call   80081b <strnlen>
+  8004fb:	89 c2                	mov    %eax,%edx
+  8004fd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800500:	29 d0                	sub    %edx,%eax
+  800502:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800505:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800509:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80050c:	89 75 08             	mov    %esi,0x8(%ebp)
+  80050f:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800511:	eb 0e                	jmp    800521 <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  800513:	83 ec 08             	sub    $0x8,%esp
+  800516:	53                   	push   %ebx
+  800517:	57                   	push   %edi
+  800518:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80051b:	83 ee 01             	sub    $0x1,%esi
+  80051e:	83 c4 10             	add    $0x10,%esp
+  800521:	85 f6                	test   %esi,%esi
+  800523:	7f ee                	jg     800513 <vprintfmt+0x1c2>
+  800525:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800528:	8b 75 08             	mov    0x8(%ebp),%esi
+  80052b:	85 c0                	test   %eax,%eax
+  80052d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800532:	0f 49 d0             	cmovns %eax,%edx
+  800535:	29 d0                	sub    %edx,%eax
+  800537:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80053a:	eb a6                	jmp    8004e2 <vprintfmt+0x191>
+					putch(ch, putdat);
+  80053c:	83 ec 08             	sub    $0x8,%esp
+  80053f:	53                   	push   %ebx
+  800540:	52                   	push   %edx
+  800541:	ff 55 08             	call   *0x8(%ebp)
+  800544:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800547:	89 f1                	mov    %esi,%ecx
+  800549:	8d 71 01             	lea    0x1(%ecx),%esi
+  80054c:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800550:	0f be d0             	movsbl %al,%edx
+  800553:	85 d2                	test   %edx,%edx
+  800555:	74 28                	je     80057f <vprintfmt+0x22e>
+  800557:	85 ff                	test   %edi,%edi
+  800559:	78 05                	js     800560 <vprintfmt+0x20f>
+  80055b:	83 ef 01             	sub    $0x1,%edi
+  80055e:	78 30                	js     800590 <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800560:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800564:	74 d6                	je     80053c <vprintfmt+0x1eb>
+  800566:	0f be c0             	movsbl %al,%eax
+  800569:	83 e8 20             	sub    $0x20,%eax
+  80056c:	83 f8 5e             	cmp    $0x5e,%eax
+  80056f:	76 cb                	jbe    80053c <vprintfmt+0x1eb>
+					putch('?', putdat);
+  800571:	83 ec 08             	sub    $0x8,%esp
+  800574:	53                   	push   %ebx
+  800575:	6a 3f                	push   $0x3f
+  800577:	ff 55 08             	call   *0x8(%ebp)
+  80057a:	83 c4 10             	add    $0x10,%esp
+  80057d:	eb c8                	jmp    800547 <vprintfmt+0x1f6>
+  80057f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800582:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800585:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800588:	01 d0                	add    %edx,%eax
+  80058a:	29 c8                	sub    %ecx,%eax
+  80058c:	89 c7                	mov    %eax,%edi
+  80058e:	eb 13                	jmp    8005a3 <vprintfmt+0x252>
+  800590:	8b 75 08             	mov    0x8(%ebp),%esi
+  800593:	eb ed                	jmp    800582 <vprintfmt+0x231>
+				putch(' ', putdat);
+  800595:	83 ec 08             	sub    $0x8,%esp
+  800598:	53                   	push   %ebx
+  800599:	6a 20                	push   $0x20
+  80059b:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80059d:	83 ef 01             	sub    $0x1,%edi
+  8005a0:	83 c4 10             	add    $0x10,%esp
+  8005a3:	85 ff                	test   %edi,%edi
+  8005a5:	7f ee                	jg     800595 <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005a7:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8005aa:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005ad:	e9 6b 01 00 00       	jmp    80071d <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  8005b2:	83 f9 01             	cmp    $0x1,%ecx
+  8005b5:	7f 1f                	jg     8005d6 <vprintfmt+0x285>
+	else if (lflag)
+  8005b7:	85 c9                	test   %ecx,%ecx
+  8005b9:	74 67                	je     800622 <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  8005bb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005be:	8b 00                	mov    (%eax),%eax
+  8005c0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005c3:	89 c1                	mov    %eax,%ecx
+  8005c5:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005c8:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005cb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ce:	8d 40 04             	lea    0x4(%eax),%eax
+  8005d1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005d4:	eb 17                	jmp    8005ed <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  8005d6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d9:	8b 50 04             	mov    0x4(%eax),%edx
+  8005dc:	8b 00                	mov    (%eax),%eax
+  8005de:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005e1:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e7:	8d 40 08             	lea    0x8(%eax),%eax
+  8005ea:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005ed:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005f0:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8005f3:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8005f8:	85 c9                	test   %ecx,%ecx
+  8005fa:	0f 89 03 01 00 00    	jns    800703 <vprintfmt+0x3b2>
+				putch('-', putdat);
+  800600:	83 ec 08             	sub    $0x8,%esp
+  800603:	53                   	push   %ebx
+  800604:	6a 2d                	push   $0x2d
+  800606:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800608:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80060b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80060e:	f7 da                	neg    %edx
+  800610:	83 d1 00             	adc    $0x0,%ecx
+  800613:	f7 d9                	neg    %ecx
+  800615:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800618:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80061d:	e9 e1 00 00 00       	jmp    800703 <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  800622:	8b 45 14             	mov    0x14(%ebp),%eax
+  800625:	8b 00                	mov    (%eax),%eax
+  800627:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80062a:	89 c1                	mov    %eax,%ecx
+  80062c:	c1 f9 1f             	sar    $0x1f,%ecx
+  80062f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800632:	8b 45 14             	mov    0x14(%ebp),%eax
+  800635:	8d 40 04             	lea    0x4(%eax),%eax
+  800638:	89 45 14             	mov    %eax,0x14(%ebp)
+  80063b:	eb b0                	jmp    8005ed <vprintfmt+0x29c>
+	if (lflag >= 2)
+  80063d:	83 f9 01             	cmp    $0x1,%ecx
+  800640:	7f 1e                	jg     800660 <vprintfmt+0x30f>
+	else if (lflag)
+  800642:	85 c9                	test   %ecx,%ecx
+  800644:	74 32                	je     800678 <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  800646:	8b 45 14             	mov    0x14(%ebp),%eax
+  800649:	8b 10                	mov    (%eax),%edx
+  80064b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800650:	8d 40 04             	lea    0x4(%eax),%eax
+  800653:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800656:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80065b:	e9 a3 00 00 00       	jmp    800703 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800660:	8b 45 14             	mov    0x14(%ebp),%eax
+  800663:	8b 10                	mov    (%eax),%edx
+  800665:	8b 48 04             	mov    0x4(%eax),%ecx
+  800668:	8d 40 08             	lea    0x8(%eax),%eax
+  80066b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80066e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800673:	e9 8b 00 00 00       	jmp    800703 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800678:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067b:	8b 10                	mov    (%eax),%edx
+  80067d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800682:	8d 40 04             	lea    0x4(%eax),%eax
+  800685:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800688:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80068d:	eb 74                	jmp    800703 <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  80068f:	83 f9 01             	cmp    $0x1,%ecx
+  800692:	7f 1b                	jg     8006af <vprintfmt+0x35e>
+	else if (lflag)
+  800694:	85 c9                	test   %ecx,%ecx
+  800696:	74 2c                	je     8006c4 <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  800698:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069b:	8b 10                	mov    (%eax),%edx
+  80069d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006a2:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006a8:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8006ad:	eb 54                	jmp    800703 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8006af:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b2:	8b 10                	mov    (%eax),%edx
+  8006b4:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006b7:	8d 40 08             	lea    0x8(%eax),%eax
+  8006ba:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006bd:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8006c2:	eb 3f                	jmp    800703 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8006c4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c7:	8b 10                	mov    (%eax),%edx
+  8006c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006ce:	8d 40 04             	lea    0x4(%eax),%eax
+  8006d1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006d4:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8006d9:	eb 28                	jmp    800703 <vprintfmt+0x3b2>
+			putch('0', putdat);
+  8006db:	83 ec 08             	sub    $0x8,%esp
+  8006de:	53                   	push   %ebx
+  8006df:	6a 30                	push   $0x30
+  8006e1:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8006e3:	83 c4 08             	add    $0x8,%esp
+  8006e6:	53                   	push   %ebx
+  8006e7:	6a 78                	push   $0x78
+  8006e9:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8006eb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ee:	8b 10                	mov    (%eax),%edx
+  8006f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8006f5:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006f8:	8d 40 04             	lea    0x4(%eax),%eax
+  8006fb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006fe:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800703:	83 ec 0c             	sub    $0xc,%esp
+  800706:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80070a:	50                   	push   %eax
+  80070b:	ff 75 e0             	push   -0x20(%ebp)
+  80070e:	57                   	push   %edi
+  80070f:	51                   	push   %ecx
+  800710:	52                   	push   %edx
+  800711:	89 da                	mov    %ebx,%edx
+  800713:	89 f0                	mov    %esi,%eax
+  800715:	e8 54 fb ff ff       	call   80026e <printnum>
+			break;
+  80071a:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80071d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  800720:	e9 4a fc ff ff       	jmp    80036f <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800725:	83 f9 01             	cmp    $0x1,%ecx
+  800728:	7f 1b                	jg     800745 <vprintfmt+0x3f4>
+	else if (lflag)
+  80072a:	85 c9                	test   %ecx,%ecx
+  80072c:	74 2c                	je     80075a <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  80072e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800731:	8b 10                	mov    (%eax),%edx
+  800733:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800738:	8d 40 04             	lea    0x4(%eax),%eax
+  80073b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80073e:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800743:	eb be                	jmp    800703 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800745:	8b 45 14             	mov    0x14(%ebp),%eax
+  800748:	8b 10                	mov    (%eax),%edx
+  80074a:	8b 48 04             	mov    0x4(%eax),%ecx
+  80074d:	8d 40 08             	lea    0x8(%eax),%eax
+  800750:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800753:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800758:	eb a9                	jmp    800703 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  80075a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80075d:	8b 10                	mov    (%eax),%edx
+  80075f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800764:	8d 40 04             	lea    0x4(%eax),%eax
+  800767:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80076a:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80076f:	eb 92                	jmp    800703 <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  800771:	83 ec 08             	sub    $0x8,%esp
+  800774:	53                   	push   %ebx
+  800775:	6a 25                	push   $0x25
+  800777:	ff d6                	call   *%esi
+			break;
+  800779:	83 c4 10             	add    $0x10,%esp
+  80077c:	eb 9f                	jmp    80071d <vprintfmt+0x3cc>
+			putch('%', putdat);
+  80077e:	83 ec 08             	sub    $0x8,%esp
+  800781:	53                   	push   %ebx
+  800782:	6a 25                	push   $0x25
+  800784:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800786:	83 c4 10             	add    $0x10,%esp
+  800789:	89 f8                	mov    %edi,%eax
+  80078b:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80078f:	74 05                	je     800796 <vprintfmt+0x445>
+  800791:	83 e8 01             	sub    $0x1,%eax
+  800794:	eb f5                	jmp    80078b <vprintfmt+0x43a>
+  800796:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800799:	eb 82                	jmp    80071d <vprintfmt+0x3cc>
+
+0080079b <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80079b:	55                   	push   %ebp
+  80079c:	89 e5                	mov    %esp,%ebp
+  80079e:	83 ec 18             	sub    $0x18,%esp
+  8007a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007a4:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8007a7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8007aa:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8007ae:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8007b1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8007b8:	85 c0                	test   %eax,%eax
+  8007ba:	74 26                	je     8007e2 <vsnprintf+0x47>
+  8007bc:	85 d2                	test   %edx,%edx
+  8007be:	7e 22                	jle    8007e2 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8007c0:	ff 75 14             	push   0x14(%ebp)
+  8007c3:	ff 75 10             	push   0x10(%ebp)
+  8007c6:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007c9:	50                   	push   %eax
+  8007ca:	68 17 03 80 00       	push   $0x800317
+  8007cf:	e8 7d fb ff ff       	call   800351 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8007d4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007d7:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8007da:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007dd:	83 c4 10             	add    $0x10,%esp
+}
+  8007e0:	c9                   	leave
+  8007e1:	c3                   	ret
+		return -E_INVAL;
+  8007e2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007e7:	eb f7                	jmp    8007e0 <vsnprintf+0x45>
+
+008007e9 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8007e9:	55                   	push   %ebp
+  8007ea:	89 e5                	mov    %esp,%ebp
+  8007ec:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8007ef:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8007f2:	50                   	push   %eax
+  8007f3:	ff 75 10             	push   0x10(%ebp)
+  8007f6:	ff 75 0c             	push   0xc(%ebp)
+  8007f9:	ff 75 08             	push   0x8(%ebp)
+  8007fc:	e8 9a ff ff ff       	call   80079b <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800801:	c9                   	leave
+  800802:	c3                   	ret
+
+00800803 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800803:	55                   	push   %ebp
+  800804:	89 e5                	mov    %esp,%ebp
+  800806:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800809:	b8 00 00 00 00       	mov    $0x0,%eax
+  80080e:	eb 03                	jmp    800813 <strlen+0x10>
+		n++;
+  800810:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800813:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800817:	75 f7                	jne    800810 <strlen+0xd>
+	return n;
+}
+  800819:	5d                   	pop    %ebp
+  80081a:	c3                   	ret
+
+0080081b <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80081b:	55                   	push   %ebp
+  80081c:	89 e5                	mov    %esp,%ebp
+  80081e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800821:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800824:	b8 00 00 00 00       	mov    $0x0,%eax
+  800829:	eb 03                	jmp    80082e <strnlen+0x13>
+		n++;
+  80082b:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80082e:	39 d0                	cmp    %edx,%eax
+  800830:	74 08                	je     80083a <strnlen+0x1f>
+  800832:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800836:	75 f3                	jne    80082b <strnlen+0x10>
+  800838:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80083a:	89 d0                	mov    %edx,%eax
+  80083c:	5d                   	pop    %ebp
+  80083d:	c3                   	ret
+
+0080083e <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80083e:	55                   	push   %ebp
+  80083f:	89 e5                	mov    %esp,%ebp
+  800841:	53                   	push   %ebx
+  800842:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800845:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800848:	b8 00 00 00 00       	mov    $0x0,%eax
+  80084d:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800851:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800854:	83 c0 01             	add    $0x1,%eax
+  800857:	84 d2                	test   %dl,%dl
+  800859:	75 f2                	jne    80084d <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80085b:	89 c8                	mov    %ecx,%eax
+  80085d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800860:	c9                   	leave
+  800861:	c3                   	ret
+
+00800862 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800862:	55                   	push   %ebp
+  800863:	89 e5                	mov    %esp,%ebp
+  800865:	53                   	push   %ebx
+  800866:	83 ec 10             	sub    $0x10,%esp
+  800869:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80086c:	53                   	push   %ebx
+  80086d:	e8 91 ff ff ff       	call   800803 <strlen>
+  800872:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800875:	ff 75 0c             	push   0xc(%ebp)
+  800878:	01 d8                	add    %ebx,%eax
+  80087a:	50                   	push   %eax
+  80087b:	e8 be ff ff ff       	call   80083e <strcpy>
+	return dst;
+}
+  800880:	89 d8                	mov    %ebx,%eax
+  800882:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800885:	c9                   	leave
+  800886:	c3                   	ret
+
+00800887 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800887:	55                   	push   %ebp
+  800888:	89 e5                	mov    %esp,%ebp
+  80088a:	56                   	push   %esi
+  80088b:	53                   	push   %ebx
+  80088c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80088f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800892:	89 f3                	mov    %esi,%ebx
+  800894:	03 5d 10             	add    0x10(%ebp),%ebx
+  800897:	89 f0                	mov    %esi,%eax
+  800899:	eb 0f                	jmp    8008aa <strncpy+0x23>
+		*dst++ = *src;
+  80089b:	83 c0 01             	add    $0x1,%eax
+  80089e:	0f b6 0a             	movzbl (%edx),%ecx
+  8008a1:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8008a4:	80 f9 01             	cmp    $0x1,%cl
+  8008a7:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8008aa:	39 d8                	cmp    %ebx,%eax
+  8008ac:	75 ed                	jne    80089b <strncpy+0x14>
+	}
+	return ret;
+}
+  8008ae:	89 f0                	mov    %esi,%eax
+  8008b0:	5b                   	pop    %ebx
+  8008b1:	5e                   	pop    %esi
+  8008b2:	5d                   	pop    %ebp
+  8008b3:	c3                   	ret
+
+008008b4 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8008b4:	55                   	push   %ebp
+  8008b5:	89 e5                	mov    %esp,%ebp
+  8008b7:	56                   	push   %esi
+  8008b8:	53                   	push   %ebx
+  8008b9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008bc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008bf:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8008c2:	89 f0                	mov    %esi,%eax
+  8008c4:	85 d2                	test   %edx,%edx
+  8008c6:	74 21                	je     8008e9 <strlcpy+0x35>
+  8008c8:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8008cc:	89 f2                	mov    %esi,%edx
+  8008ce:	eb 09                	jmp    8008d9 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8008d0:	83 c1 01             	add    $0x1,%ecx
+  8008d3:	83 c2 01             	add    $0x1,%edx
+  8008d6:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8008d9:	39 c2                	cmp    %eax,%edx
+  8008db:	74 09                	je     8008e6 <strlcpy+0x32>
+  8008dd:	0f b6 19             	movzbl (%ecx),%ebx
+  8008e0:	84 db                	test   %bl,%bl
+  8008e2:	75 ec                	jne    8008d0 <strlcpy+0x1c>
+  8008e4:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8008e6:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8008e9:	29 f0                	sub    %esi,%eax
+}
+  8008eb:	5b                   	pop    %ebx
+  8008ec:	5e                   	pop    %esi
+  8008ed:	5d                   	pop    %ebp
+  8008ee:	c3                   	ret
+
+008008ef <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8008ef:	55                   	push   %ebp
+  8008f0:	89 e5                	mov    %esp,%ebp
+  8008f2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008f5:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8008f8:	eb 06                	jmp    800900 <strcmp+0x11>
+		p++, q++;
+  8008fa:	83 c1 01             	add    $0x1,%ecx
+  8008fd:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800900:	0f b6 01             	movzbl (%ecx),%eax
+  800903:	84 c0                	test   %al,%al
+  800905:	74 04                	je     80090b <strcmp+0x1c>
+  800907:	3a 02                	cmp    (%edx),%al
+  800909:	74 ef                	je     8008fa <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80090b:	0f b6 c0             	movzbl %al,%eax
+  80090e:	0f b6 12             	movzbl (%edx),%edx
+  800911:	29 d0                	sub    %edx,%eax
+}
+  800913:	5d                   	pop    %ebp
+  800914:	c3                   	ret
+
+00800915 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800915:	55                   	push   %ebp
+  800916:	89 e5                	mov    %esp,%ebp
+  800918:	53                   	push   %ebx
+  800919:	8b 45 08             	mov    0x8(%ebp),%eax
+  80091c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80091f:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800922:	eb 09                	jmp    80092d <strncmp+0x18>
+		n--, p++, q++;
+  800924:	83 ea 01             	sub    $0x1,%edx
+  800927:	83 c0 01             	add    $0x1,%eax
+  80092a:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80092d:	85 d2                	test   %edx,%edx
+  80092f:	74 18                	je     800949 <strncmp+0x34>
+  800931:	0f b6 18             	movzbl (%eax),%ebx
+  800934:	84 db                	test   %bl,%bl
+  800936:	74 04                	je     80093c <strncmp+0x27>
+  800938:	3a 19                	cmp    (%ecx),%bl
+  80093a:	74 e8                	je     800924 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80093c:	0f b6 00             	movzbl (%eax),%eax
+  80093f:	0f b6 11             	movzbl (%ecx),%edx
+  800942:	29 d0                	sub    %edx,%eax
+}
+  800944:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800947:	c9                   	leave
+  800948:	c3                   	ret
+		return 0;
+  800949:	b8 00 00 00 00       	mov    $0x0,%eax
+  80094e:	eb f4                	jmp    800944 <strncmp+0x2f>
+
+00800950 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800950:	55                   	push   %ebp
+  800951:	89 e5                	mov    %esp,%ebp
+  800953:	8b 45 08             	mov    0x8(%ebp),%eax
+  800956:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80095a:	eb 03                	jmp    80095f <strchr+0xf>
+  80095c:	83 c0 01             	add    $0x1,%eax
+  80095f:	0f b6 10             	movzbl (%eax),%edx
+  800962:	84 d2                	test   %dl,%dl
+  800964:	74 06                	je     80096c <strchr+0x1c>
+		if (*s == c)
+  800966:	38 ca                	cmp    %cl,%dl
+  800968:	75 f2                	jne    80095c <strchr+0xc>
+  80096a:	eb 05                	jmp    800971 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80096c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800971:	5d                   	pop    %ebp
+  800972:	c3                   	ret
+
+00800973 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800973:	55                   	push   %ebp
+  800974:	89 e5                	mov    %esp,%ebp
+  800976:	8b 45 08             	mov    0x8(%ebp),%eax
+  800979:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80097d:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800980:	38 ca                	cmp    %cl,%dl
+  800982:	74 09                	je     80098d <strfind+0x1a>
+  800984:	84 d2                	test   %dl,%dl
+  800986:	74 05                	je     80098d <strfind+0x1a>
+	for (; *s; s++)
+  800988:	83 c0 01             	add    $0x1,%eax
+  80098b:	eb f0                	jmp    80097d <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  80098d:	5d                   	pop    %ebp
+  80098e:	c3                   	ret
+
+0080098f <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  80098f:	55                   	push   %ebp
+  800990:	89 e5                	mov    %esp,%ebp
+  800992:	57                   	push   %edi
+  800993:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800996:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800999:	85 c9                	test   %ecx,%ecx
+  80099b:	74 20                	je     8009bd <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  80099d:	89 f8                	mov    %edi,%eax
+  80099f:	09 c8                	or     %ecx,%eax
+  8009a1:	a8 03                	test   $0x3,%al
+  8009a3:	75 12                	jne    8009b7 <memset+0x28>
+		c &= 0xFF;
+  8009a5:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8009a9:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8009af:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8009b2:	fc                   	cld
+  8009b3:	f3 ab                	rep stos %eax,%es:(%edi)
+  8009b5:	eb 06                	jmp    8009bd <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8009b7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8009ba:	fc                   	cld
+  8009bb:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8009bd:	89 f8                	mov    %edi,%eax
+  8009bf:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8009c2:	c9                   	leave
+  8009c3:	c3                   	ret
+
+008009c4 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8009c4:	55                   	push   %ebp
+  8009c5:	89 e5                	mov    %esp,%ebp
+  8009c7:	57                   	push   %edi
+  8009c8:	56                   	push   %esi
+  8009c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009cc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8009cf:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8009d2:	39 c6                	cmp    %eax,%esi
+  8009d4:	73 32                	jae    800a08 <memmove+0x44>
+  8009d6:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8009d9:	39 d0                	cmp    %edx,%eax
+  8009db:	73 2b                	jae    800a08 <memmove+0x44>
+		s += n;
+		d += n;
+  8009dd:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009e0:	89 d6                	mov    %edx,%esi
+  8009e2:	09 fe                	or     %edi,%esi
+  8009e4:	09 ce                	or     %ecx,%esi
+  8009e6:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8009ec:	75 0e                	jne    8009fc <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8009ee:	83 ef 04             	sub    $0x4,%edi
+  8009f1:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009f4:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8009f7:	fd                   	std
+  8009f8:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009fa:	eb 09                	jmp    800a05 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009fc:	83 ef 01             	sub    $0x1,%edi
+  8009ff:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a02:	fd                   	std
+  800a03:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a05:	fc                   	cld
+  800a06:	eb 1a                	jmp    800a22 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a08:	89 f2                	mov    %esi,%edx
+  800a0a:	09 c2                	or     %eax,%edx
+  800a0c:	09 ca                	or     %ecx,%edx
+  800a0e:	f6 c2 03             	test   $0x3,%dl
+  800a11:	75 0a                	jne    800a1d <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a13:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a16:	89 c7                	mov    %eax,%edi
+  800a18:	fc                   	cld
+  800a19:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a1b:	eb 05                	jmp    800a22 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a1d:	89 c7                	mov    %eax,%edi
+  800a1f:	fc                   	cld
+  800a20:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a22:	5e                   	pop    %esi
+  800a23:	5f                   	pop    %edi
+  800a24:	5d                   	pop    %ebp
+  800a25:	c3                   	ret
+
+00800a26 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a26:	55                   	push   %ebp
+  800a27:	89 e5                	mov    %esp,%ebp
+  800a29:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a2c:	ff 75 10             	push   0x10(%ebp)
+  800a2f:	ff 75 0c             	push   0xc(%ebp)
+  800a32:	ff 75 08             	push   0x8(%ebp)
+  800a35:	e8 8a ff ff ff       	call   8009c4 <memmove>
+}
+  800a3a:	c9                   	leave
+  800a3b:	c3                   	ret
+
+00800a3c <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a3c:	55                   	push   %ebp
+  800a3d:	89 e5                	mov    %esp,%ebp
+  800a3f:	56                   	push   %esi
+  800a40:	53                   	push   %ebx
+  800a41:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a44:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a47:	89 c6                	mov    %eax,%esi
+  800a49:	03 75 10             	add    0x10(%ebp),%esi
+  800a4c:	eb 06                	jmp    800a54 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a4e:	83 c0 01             	add    $0x1,%eax
+  800a51:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a54:	39 f0                	cmp    %esi,%eax
+  800a56:	74 14                	je     800a6c <memcmp+0x30>
+		if (*s1 != *s2)
+  800a58:	0f b6 08             	movzbl (%eax),%ecx
+  800a5b:	0f b6 1a             	movzbl (%edx),%ebx
+  800a5e:	38 d9                	cmp    %bl,%cl
+  800a60:	74 ec                	je     800a4e <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a62:	0f b6 c1             	movzbl %cl,%eax
+  800a65:	0f b6 db             	movzbl %bl,%ebx
+  800a68:	29 d8                	sub    %ebx,%eax
+  800a6a:	eb 05                	jmp    800a71 <memcmp+0x35>
+	}
+
+	return 0;
+  800a6c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a71:	5b                   	pop    %ebx
+  800a72:	5e                   	pop    %esi
+  800a73:	5d                   	pop    %ebp
+  800a74:	c3                   	ret
+
+00800a75 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a75:	55                   	push   %ebp
+  800a76:	89 e5                	mov    %esp,%ebp
+  800a78:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a7b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a7e:	89 c2                	mov    %eax,%edx
+  800a80:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a83:	eb 03                	jmp    800a88 <memfind+0x13>
+  800a85:	83 c0 01             	add    $0x1,%eax
+  800a88:	39 d0                	cmp    %edx,%eax
+  800a8a:	73 04                	jae    800a90 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a8c:	38 08                	cmp    %cl,(%eax)
+  800a8e:	75 f5                	jne    800a85 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a90:	5d                   	pop    %ebp
+  800a91:	c3                   	ret
+
+00800a92 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a92:	55                   	push   %ebp
+  800a93:	89 e5                	mov    %esp,%ebp
+  800a95:	57                   	push   %edi
+  800a96:	56                   	push   %esi
+  800a97:	53                   	push   %ebx
+  800a98:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a9b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a9e:	eb 03                	jmp    800aa3 <strtol+0x11>
+		s++;
+  800aa0:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800aa3:	0f b6 02             	movzbl (%edx),%eax
+  800aa6:	3c 20                	cmp    $0x20,%al
+  800aa8:	74 f6                	je     800aa0 <strtol+0xe>
+  800aaa:	3c 09                	cmp    $0x9,%al
+  800aac:	74 f2                	je     800aa0 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800aae:	3c 2b                	cmp    $0x2b,%al
+  800ab0:	74 2a                	je     800adc <strtol+0x4a>
+	int neg = 0;
+  800ab2:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800ab7:	3c 2d                	cmp    $0x2d,%al
+  800ab9:	74 2b                	je     800ae6 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800abb:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800ac1:	75 0f                	jne    800ad2 <strtol+0x40>
+  800ac3:	80 3a 30             	cmpb   $0x30,(%edx)
+  800ac6:	74 28                	je     800af0 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800ac8:	85 db                	test   %ebx,%ebx
+  800aca:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800acf:	0f 44 d8             	cmove  %eax,%ebx
+  800ad2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ad7:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800ada:	eb 46                	jmp    800b22 <strtol+0x90>
+		s++;
+  800adc:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800adf:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ae4:	eb d5                	jmp    800abb <strtol+0x29>
+		s++, neg = 1;
+  800ae6:	83 c2 01             	add    $0x1,%edx
+  800ae9:	bf 01 00 00 00       	mov    $0x1,%edi
+  800aee:	eb cb                	jmp    800abb <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800af0:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800af4:	74 0e                	je     800b04 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800af6:	85 db                	test   %ebx,%ebx
+  800af8:	75 d8                	jne    800ad2 <strtol+0x40>
+		s++, base = 8;
+  800afa:	83 c2 01             	add    $0x1,%edx
+  800afd:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b02:	eb ce                	jmp    800ad2 <strtol+0x40>
+		s += 2, base = 16;
+  800b04:	83 c2 02             	add    $0x2,%edx
+  800b07:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b0c:	eb c4                	jmp    800ad2 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800b0e:	0f be c0             	movsbl %al,%eax
+  800b11:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800b14:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b17:	7d 3a                	jge    800b53 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800b19:	83 c2 01             	add    $0x1,%edx
+  800b1c:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b20:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800b22:	0f b6 02             	movzbl (%edx),%eax
+  800b25:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b28:	89 f3                	mov    %esi,%ebx
+  800b2a:	80 fb 09             	cmp    $0x9,%bl
+  800b2d:	76 df                	jbe    800b0e <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800b2f:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b32:	89 f3                	mov    %esi,%ebx
+  800b34:	80 fb 19             	cmp    $0x19,%bl
+  800b37:	77 08                	ja     800b41 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800b39:	0f be c0             	movsbl %al,%eax
+  800b3c:	83 e8 57             	sub    $0x57,%eax
+  800b3f:	eb d3                	jmp    800b14 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b41:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b44:	89 f3                	mov    %esi,%ebx
+  800b46:	80 fb 19             	cmp    $0x19,%bl
+  800b49:	77 08                	ja     800b53 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800b4b:	0f be c0             	movsbl %al,%eax
+  800b4e:	83 e8 37             	sub    $0x37,%eax
+  800b51:	eb c1                	jmp    800b14 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b53:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b57:	74 05                	je     800b5e <strtol+0xcc>
+		*endptr = (char *) s;
+  800b59:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b5c:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b5e:	89 c8                	mov    %ecx,%eax
+  800b60:	f7 d8                	neg    %eax
+  800b62:	85 ff                	test   %edi,%edi
+  800b64:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b67:	89 c8                	mov    %ecx,%eax
+  800b69:	5b                   	pop    %ebx
+  800b6a:	5e                   	pop    %esi
+  800b6b:	5f                   	pop    %edi
+  800b6c:	5d                   	pop    %ebp
+  800b6d:	c3                   	ret
+
+00800b6e <atoi>:
+
+int
+atoi(const char* s)
+{
+  800b6e:	55                   	push   %ebp
+  800b6f:	89 e5                	mov    %esp,%ebp
+  800b71:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  800b74:	6a 00                	push   $0x0
+  800b76:	6a 00                	push   $0x0
+  800b78:	ff 75 08             	push   0x8(%ebp)
+  800b7b:	e8 12 ff ff ff       	call   800a92 <strtol>
+}
+  800b80:	c9                   	leave
+  800b81:	c3                   	ret
+
+00800b82 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800b82:	55                   	push   %ebp
+  800b83:	89 e5                	mov    %esp,%ebp
+  800b85:	57                   	push   %edi
+  800b86:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800b87:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b8c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b8f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b92:	89 c3                	mov    %eax,%ebx
+  800b94:	89 c7                	mov    %eax,%edi
+  800b96:	6a 00                	push   $0x0
+  800b98:	55                   	push   %ebp
+  800b99:	56                   	push   %esi
+  800b9a:	89 e5                	mov    %esp,%ebp
+  800b9c:	8d 35 a4 0b 80 00    	lea    0x800ba4,%esi
+  800ba2:	0f 34                	sysenter
+
+00800ba4 <after_sysenter_label_47>:
+  800ba4:	5e                   	pop    %esi
+  800ba5:	5d                   	pop    %ebp
+  800ba6:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800ba9:	5b                   	pop    %ebx
+  800baa:	5f                   	pop    %edi
+  800bab:	5d                   	pop    %ebp
+  800bac:	c3                   	ret
+
+00800bad <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800bad:	55                   	push   %ebp
+  800bae:	89 e5                	mov    %esp,%ebp
+  800bb0:	57                   	push   %edi
+  800bb1:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800bb2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bb7:	b8 01 00 00 00       	mov    $0x1,%eax
+  800bbc:	89 d1                	mov    %edx,%ecx
+  800bbe:	89 d3                	mov    %edx,%ebx
+  800bc0:	89 d7                	mov    %edx,%edi
+  800bc2:	6a 00                	push   $0x0
+  800bc4:	55                   	push   %ebp
+  800bc5:	56                   	push   %esi
+  800bc6:	89 e5                	mov    %esp,%ebp
+  800bc8:	8d 35 d0 0b 80 00    	lea    0x800bd0,%esi
+  800bce:	0f 34                	sysenter
+
+00800bd0 <after_sysenter_label_128>:
+  800bd0:	5e                   	pop    %esi
+  800bd1:	5d                   	pop    %ebp
+  800bd2:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800bd5:	5b                   	pop    %ebx
+  800bd6:	5f                   	pop    %edi
+  800bd7:	5d                   	pop    %ebp
+  800bd8:	c3                   	ret
+
+00800bd9 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800bd9:	55                   	push   %ebp
+  800bda:	89 e5                	mov    %esp,%ebp
+  800bdc:	57                   	push   %edi
+  800bdd:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800bde:	8b 55 08             	mov    0x8(%ebp),%edx
+  800be1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800be6:	b8 03 00 00 00       	mov    $0x3,%eax
+  800beb:	89 cb                	mov    %ecx,%ebx
+  800bed:	89 cf                	mov    %ecx,%edi
+  800bef:	6a 00                	push   $0x0
+  800bf1:	55                   	push   %ebp
+  800bf2:	56                   	push   %esi
+  800bf3:	89 e5                	mov    %esp,%ebp
+  800bf5:	8d 35 fd 0b 80 00    	lea    0x800bfd,%esi
+  800bfb:	0f 34                	sysenter
+
+00800bfd <after_sysenter_label_212>:
+  800bfd:	5e                   	pop    %esi
+  800bfe:	5d                   	pop    %ebp
+  800bff:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800c02:	85 c0                	test   %eax,%eax
+  800c04:	7f 07                	jg     800c0d <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c06:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c09:	5b                   	pop    %ebx
+  800c0a:	5f                   	pop    %edi
+  800c0b:	5d                   	pop    %ebp
+  800c0c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c0d:	83 ec 0c             	sub    $0xc,%esp
+  800c10:	50                   	push   %eax
+  800c11:	6a 03                	push   $0x3
+  800c13:	68 d5 4b 80 00       	push   $0x804bd5
+  800c18:	6a 54                	push   $0x54
+  800c1a:	68 f2 4b 80 00       	push   $0x804bf2
+  800c1f:	e8 5b f5 ff ff       	call   80017f <_panic>
+
+00800c24 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800c24:	55                   	push   %ebp
+  800c25:	89 e5                	mov    %esp,%ebp
+  800c27:	57                   	push   %edi
+  800c28:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c29:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c2e:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c33:	89 d1                	mov    %edx,%ecx
+  800c35:	89 d3                	mov    %edx,%ebx
+  800c37:	89 d7                	mov    %edx,%edi
+  800c39:	6a 00                	push   $0x0
+  800c3b:	55                   	push   %ebp
+  800c3c:	56                   	push   %esi
+  800c3d:	89 e5                	mov    %esp,%ebp
+  800c3f:	8d 35 47 0c 80 00    	lea    0x800c47,%esi
+  800c45:	0f 34                	sysenter
+
+00800c47 <after_sysenter_label_309>:
+  800c47:	5e                   	pop    %esi
+  800c48:	5d                   	pop    %ebp
+  800c49:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800c4c:	5b                   	pop    %ebx
+  800c4d:	5f                   	pop    %edi
+  800c4e:	5d                   	pop    %ebp
+  800c4f:	c3                   	ret
+
+00800c50 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800c50:	55                   	push   %ebp
+  800c51:	89 e5                	mov    %esp,%ebp
+  800c53:	57                   	push   %edi
+  800c54:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c55:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c5a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800c5f:	89 d1                	mov    %edx,%ecx
+  800c61:	89 d3                	mov    %edx,%ebx
+  800c63:	89 d7                	mov    %edx,%edi
+  800c65:	6a 00                	push   $0x0
+  800c67:	55                   	push   %ebp
+  800c68:	56                   	push   %esi
+  800c69:	89 e5                	mov    %esp,%ebp
+  800c6b:	8d 35 73 0c 80 00    	lea    0x800c73,%esi
+  800c71:	0f 34                	sysenter
+
+00800c73 <after_sysenter_label_391>:
+  800c73:	5e                   	pop    %esi
+  800c74:	5d                   	pop    %ebp
+  800c75:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800c78:	5b                   	pop    %ebx
+  800c79:	5f                   	pop    %edi
+  800c7a:	5d                   	pop    %ebp
+  800c7b:	c3                   	ret
+
+00800c7c <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c7c:	55                   	push   %ebp
+  800c7d:	89 e5                	mov    %esp,%ebp
+  800c7f:	57                   	push   %edi
+  800c80:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c81:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c84:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c87:	b8 04 00 00 00       	mov    $0x4,%eax
+  800c8c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c91:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c94:	6a 00                	push   $0x0
+  800c96:	55                   	push   %ebp
+  800c97:	56                   	push   %esi
+  800c98:	89 e5                	mov    %esp,%ebp
+  800c9a:	8d 35 a2 0c 80 00    	lea    0x800ca2,%esi
+  800ca0:	0f 34                	sysenter
+
+00800ca2 <after_sysenter_label_479>:
+  800ca2:	5e                   	pop    %esi
+  800ca3:	5d                   	pop    %ebp
+  800ca4:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800ca7:	85 c0                	test   %eax,%eax
+  800ca9:	7f 07                	jg     800cb2 <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800cab:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800cae:	5b                   	pop    %ebx
+  800caf:	5f                   	pop    %edi
+  800cb0:	5d                   	pop    %ebp
+  800cb1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cb2:	83 ec 0c             	sub    $0xc,%esp
+  800cb5:	50                   	push   %eax
+  800cb6:	6a 04                	push   $0x4
+  800cb8:	68 d5 4b 80 00       	push   $0x804bd5
+  800cbd:	6a 54                	push   $0x54
+  800cbf:	68 f2 4b 80 00       	push   $0x804bf2
+  800cc4:	e8 b6 f4 ff ff       	call   80017f <_panic>
+
+00800cc9 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800cc9:	55                   	push   %ebp
+  800cca:	89 e5                	mov    %esp,%ebp
+  800ccc:	57                   	push   %edi
+  800ccd:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800cce:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cd1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cd4:	b8 05 00 00 00       	mov    $0x5,%eax
+  800cd9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cdc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800cdf:	ff 75 18             	push   0x18(%ebp)
+  800ce2:	55                   	push   %ebp
+  800ce3:	56                   	push   %esi
+  800ce4:	89 e5                	mov    %esp,%ebp
+  800ce6:	8d 35 ee 0c 80 00    	lea    0x800cee,%esi
+  800cec:	0f 34                	sysenter
+
+00800cee <after_sysenter_label_593>:
+  800cee:	5e                   	pop    %esi
+  800cef:	5d                   	pop    %ebp
+  800cf0:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800cf3:	85 c0                	test   %eax,%eax
+  800cf5:	7f 07                	jg     800cfe <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800cf7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800cfa:	5b                   	pop    %ebx
+  800cfb:	5f                   	pop    %edi
+  800cfc:	5d                   	pop    %ebp
+  800cfd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cfe:	83 ec 0c             	sub    $0xc,%esp
+  800d01:	50                   	push   %eax
+  800d02:	6a 05                	push   $0x5
+  800d04:	68 d5 4b 80 00       	push   $0x804bd5
+  800d09:	6a 54                	push   $0x54
+  800d0b:	68 f2 4b 80 00       	push   $0x804bf2
+  800d10:	e8 6a f4 ff ff       	call   80017f <_panic>
+
+00800d15 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800d15:	55                   	push   %ebp
+  800d16:	89 e5                	mov    %esp,%ebp
+  800d18:	57                   	push   %edi
+  800d19:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d1a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d1f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d22:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d25:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d2a:	89 df                	mov    %ebx,%edi
+  800d2c:	6a 00                	push   $0x0
+  800d2e:	55                   	push   %ebp
+  800d2f:	56                   	push   %esi
+  800d30:	89 e5                	mov    %esp,%ebp
+  800d32:	8d 35 3a 0d 80 00    	lea    0x800d3a,%esi
+  800d38:	0f 34                	sysenter
+
+00800d3a <after_sysenter_label_704>:
+  800d3a:	5e                   	pop    %esi
+  800d3b:	5d                   	pop    %ebp
+  800d3c:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d3f:	85 c0                	test   %eax,%eax
+  800d41:	7f 07                	jg     800d4a <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d43:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d46:	5b                   	pop    %ebx
+  800d47:	5f                   	pop    %edi
+  800d48:	5d                   	pop    %ebp
+  800d49:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d4a:	83 ec 0c             	sub    $0xc,%esp
+  800d4d:	50                   	push   %eax
+  800d4e:	6a 06                	push   $0x6
+  800d50:	68 d5 4b 80 00       	push   $0x804bd5
+  800d55:	6a 54                	push   $0x54
+  800d57:	68 f2 4b 80 00       	push   $0x804bf2
+  800d5c:	e8 1e f4 ff ff       	call   80017f <_panic>
+
+00800d61 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800d61:	55                   	push   %ebp
+  800d62:	89 e5                	mov    %esp,%ebp
+  800d64:	57                   	push   %edi
+  800d65:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d66:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d6b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d6e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d71:	b8 08 00 00 00       	mov    $0x8,%eax
+  800d76:	89 df                	mov    %ebx,%edi
+  800d78:	6a 00                	push   $0x0
+  800d7a:	55                   	push   %ebp
+  800d7b:	56                   	push   %esi
+  800d7c:	89 e5                	mov    %esp,%ebp
+  800d7e:	8d 35 86 0d 80 00    	lea    0x800d86,%esi
+  800d84:	0f 34                	sysenter
+
+00800d86 <after_sysenter_label_808>:
+  800d86:	5e                   	pop    %esi
+  800d87:	5d                   	pop    %ebp
+  800d88:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d8b:	85 c0                	test   %eax,%eax
+  800d8d:	7f 07                	jg     800d96 <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800d8f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d92:	5b                   	pop    %ebx
+  800d93:	5f                   	pop    %edi
+  800d94:	5d                   	pop    %ebp
+  800d95:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d96:	83 ec 0c             	sub    $0xc,%esp
+  800d99:	50                   	push   %eax
+  800d9a:	6a 08                	push   $0x8
+  800d9c:	68 d5 4b 80 00       	push   $0x804bd5
+  800da1:	6a 54                	push   $0x54
+  800da3:	68 f2 4b 80 00       	push   $0x804bf2
+  800da8:	e8 d2 f3 ff ff       	call   80017f <_panic>
+
+00800dad <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800dad:	55                   	push   %ebp
+  800dae:	89 e5                	mov    %esp,%ebp
+  800db0:	57                   	push   %edi
+  800db1:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800db2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800db7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dbd:	b8 09 00 00 00       	mov    $0x9,%eax
+  800dc2:	89 df                	mov    %ebx,%edi
+  800dc4:	6a 00                	push   $0x0
+  800dc6:	55                   	push   %ebp
+  800dc7:	56                   	push   %esi
+  800dc8:	89 e5                	mov    %esp,%ebp
+  800dca:	8d 35 d2 0d 80 00    	lea    0x800dd2,%esi
+  800dd0:	0f 34                	sysenter
+
+00800dd2 <after_sysenter_label_912>:
+  800dd2:	5e                   	pop    %esi
+  800dd3:	5d                   	pop    %ebp
+  800dd4:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800dd7:	85 c0                	test   %eax,%eax
+  800dd9:	7f 07                	jg     800de2 <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800ddb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800dde:	5b                   	pop    %ebx
+  800ddf:	5f                   	pop    %edi
+  800de0:	5d                   	pop    %ebp
+  800de1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800de2:	83 ec 0c             	sub    $0xc,%esp
+  800de5:	50                   	push   %eax
+  800de6:	6a 09                	push   $0x9
+  800de8:	68 d5 4b 80 00       	push   $0x804bd5
+  800ded:	6a 54                	push   $0x54
+  800def:	68 f2 4b 80 00       	push   $0x804bf2
+  800df4:	e8 86 f3 ff ff       	call   80017f <_panic>
+
+00800df9 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800df9:	55                   	push   %ebp
+  800dfa:	89 e5                	mov    %esp,%ebp
+  800dfc:	57                   	push   %edi
+  800dfd:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800dfe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e03:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e06:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e09:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e0e:	89 df                	mov    %ebx,%edi
+  800e10:	6a 00                	push   $0x0
+  800e12:	55                   	push   %ebp
+  800e13:	56                   	push   %esi
+  800e14:	89 e5                	mov    %esp,%ebp
+  800e16:	8d 35 1e 0e 80 00    	lea    0x800e1e,%esi
+  800e1c:	0f 34                	sysenter
+
+00800e1e <after_sysenter_label_1016>:
+  800e1e:	5e                   	pop    %esi
+  800e1f:	5d                   	pop    %ebp
+  800e20:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e23:	85 c0                	test   %eax,%eax
+  800e25:	7f 07                	jg     800e2e <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800e27:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e2a:	5b                   	pop    %ebx
+  800e2b:	5f                   	pop    %edi
+  800e2c:	5d                   	pop    %ebp
+  800e2d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e2e:	83 ec 0c             	sub    $0xc,%esp
+  800e31:	50                   	push   %eax
+  800e32:	6a 0a                	push   $0xa
+  800e34:	68 d5 4b 80 00       	push   $0x804bd5
+  800e39:	6a 54                	push   $0x54
+  800e3b:	68 f2 4b 80 00       	push   $0x804bf2
+  800e40:	e8 3a f3 ff ff       	call   80017f <_panic>
+
+00800e45 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800e45:	55                   	push   %ebp
+  800e46:	89 e5                	mov    %esp,%ebp
+  800e48:	57                   	push   %edi
+  800e49:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e4a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e4d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e50:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800e55:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e58:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e5b:	6a 00                	push   $0x0
+  800e5d:	55                   	push   %ebp
+  800e5e:	56                   	push   %esi
+  800e5f:	89 e5                	mov    %esp,%ebp
+  800e61:	8d 35 69 0e 80 00    	lea    0x800e69,%esi
+  800e67:	0f 34                	sysenter
+
+00800e69 <after_sysenter_label_1126>:
+  800e69:	5e                   	pop    %esi
+  800e6a:	5d                   	pop    %ebp
+  800e6b:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800e6e:	5b                   	pop    %ebx
+  800e6f:	5f                   	pop    %edi
+  800e70:	5d                   	pop    %ebp
+  800e71:	c3                   	ret
+
+00800e72 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800e72:	55                   	push   %ebp
+  800e73:	89 e5                	mov    %esp,%ebp
+  800e75:	57                   	push   %edi
+  800e76:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e77:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e7a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e7f:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e84:	89 cb                	mov    %ecx,%ebx
+  800e86:	89 cf                	mov    %ecx,%edi
+  800e88:	6a 00                	push   $0x0
+  800e8a:	55                   	push   %ebp
+  800e8b:	56                   	push   %esi
+  800e8c:	89 e5                	mov    %esp,%ebp
+  800e8e:	8d 35 96 0e 80 00    	lea    0x800e96,%esi
+  800e94:	0f 34                	sysenter
+
+00800e96 <after_sysenter_label_1210>:
+  800e96:	5e                   	pop    %esi
+  800e97:	5d                   	pop    %ebp
+  800e98:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e9b:	85 c0                	test   %eax,%eax
+  800e9d:	7f 07                	jg     800ea6 <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800e9f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ea2:	5b                   	pop    %ebx
+  800ea3:	5f                   	pop    %edi
+  800ea4:	5d                   	pop    %ebp
+  800ea5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ea6:	83 ec 0c             	sub    $0xc,%esp
+  800ea9:	50                   	push   %eax
+  800eaa:	6a 0d                	push   $0xd
+  800eac:	68 d5 4b 80 00       	push   $0x804bd5
+  800eb1:	6a 54                	push   $0x54
+  800eb3:	68 f2 4b 80 00       	push   $0x804bf2
+  800eb8:	e8 c2 f2 ff ff       	call   80017f <_panic>
+
+00800ebd <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  800ebd:	55                   	push   %ebp
+  800ebe:	89 e5                	mov    %esp,%ebp
+  800ec0:	57                   	push   %edi
+  800ec1:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ec2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ec7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ecd:	b8 42 00 00 00       	mov    $0x42,%eax
+  800ed2:	89 df                	mov    %ebx,%edi
+  800ed4:	6a 00                	push   $0x0
+  800ed6:	55                   	push   %ebp
+  800ed7:	56                   	push   %esi
+  800ed8:	89 e5                	mov    %esp,%ebp
+  800eda:	8d 35 e2 0e 80 00    	lea    0x800ee2,%esi
+  800ee0:	0f 34                	sysenter
+
+00800ee2 <after_sysenter_label_1311>:
+  800ee2:	5e                   	pop    %esi
+  800ee3:	5d                   	pop    %ebp
+  800ee4:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800ee7:	85 c0                	test   %eax,%eax
+  800ee9:	7f 07                	jg     800ef2 <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  800eeb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800eee:	5b                   	pop    %ebx
+  800eef:	5f                   	pop    %edi
+  800ef0:	5d                   	pop    %ebp
+  800ef1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ef2:	83 ec 0c             	sub    $0xc,%esp
+  800ef5:	50                   	push   %eax
+  800ef6:	6a 42                	push   $0x42
+  800ef8:	68 d5 4b 80 00       	push   $0x804bd5
+  800efd:	6a 54                	push   $0x54
+  800eff:	68 f2 4b 80 00       	push   $0x804bf2
+  800f04:	e8 76 f2 ff ff       	call   80017f <_panic>
+
+00800f09 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800f09:	55                   	push   %ebp
+  800f0a:	89 e5                	mov    %esp,%ebp
+  800f0c:	57                   	push   %edi
+  800f0d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f0e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f13:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800f18:	89 d1                	mov    %edx,%ecx
+  800f1a:	89 d3                	mov    %edx,%ebx
+  800f1c:	89 d7                	mov    %edx,%edi
+  800f1e:	6a 00                	push   $0x0
+  800f20:	55                   	push   %ebp
+  800f21:	56                   	push   %esi
+  800f22:	89 e5                	mov    %esp,%ebp
+  800f24:	8d 35 2c 0f 80 00    	lea    0x800f2c,%esi
+  800f2a:	0f 34                	sysenter
+
+00800f2c <after_sysenter_label_1411>:
+  800f2c:	5e                   	pop    %esi
+  800f2d:	5d                   	pop    %ebp
+  800f2e:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800f31:	5b                   	pop    %ebx
+  800f32:	5f                   	pop    %edi
+  800f33:	5d                   	pop    %ebp
+  800f34:	c3                   	ret
+
+00800f35 <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  800f35:	55                   	push   %ebp
+  800f36:	89 e5                	mov    %esp,%ebp
+  800f38:	57                   	push   %edi
+  800f39:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f3a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f3f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f42:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f45:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f4a:	89 df                	mov    %ebx,%edi
+  800f4c:	6a 00                	push   $0x0
+  800f4e:	55                   	push   %ebp
+  800f4f:	56                   	push   %esi
+  800f50:	89 e5                	mov    %esp,%ebp
+  800f52:	8d 35 5a 0f 80 00    	lea    0x800f5a,%esi
+  800f58:	0f 34                	sysenter
+
+00800f5a <after_sysenter_label_1497>:
+  800f5a:	5e                   	pop    %esi
+  800f5b:	5d                   	pop    %ebp
+  800f5c:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  800f5f:	5b                   	pop    %ebx
+  800f60:	5f                   	pop    %edi
+  800f61:	5d                   	pop    %ebp
+  800f62:	c3                   	ret
+
+00800f63 <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  800f63:	55                   	push   %ebp
+  800f64:	89 e5                	mov    %esp,%ebp
+  800f66:	57                   	push   %edi
+  800f67:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f68:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f6d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f70:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f73:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f78:	89 df                	mov    %ebx,%edi
+  800f7a:	6a 00                	push   $0x0
+  800f7c:	55                   	push   %ebp
+  800f7d:	56                   	push   %esi
+  800f7e:	89 e5                	mov    %esp,%ebp
+  800f80:	8d 35 88 0f 80 00    	lea    0x800f88,%esi
+  800f86:	0f 34                	sysenter
+
+00800f88 <after_sysenter_label_1583>:
+  800f88:	5e                   	pop    %esi
+  800f89:	5d                   	pop    %ebp
+  800f8a:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  800f8d:	5b                   	pop    %ebx
+  800f8e:	5f                   	pop    %edi
+  800f8f:	5d                   	pop    %ebp
+  800f90:	c3                   	ret
+
+00800f91 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  800f91:	55                   	push   %ebp
+  800f92:	89 e5                	mov    %esp,%ebp
+  800f94:	57                   	push   %edi
+  800f95:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f96:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f99:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f9c:	b8 11 00 00 00       	mov    $0x11,%eax
+  800fa1:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fa6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fa9:	6a 00                	push   $0x0
+  800fab:	55                   	push   %ebp
+  800fac:	56                   	push   %esi
+  800fad:	89 e5                	mov    %esp,%ebp
+  800faf:	8d 35 b7 0f 80 00    	lea    0x800fb7,%esi
+  800fb5:	0f 34                	sysenter
+
+00800fb7 <after_sysenter_label_1672>:
+  800fb7:	5e                   	pop    %esi
+  800fb8:	5d                   	pop    %ebp
+  800fb9:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  800fbc:	5b                   	pop    %ebx
+  800fbd:	5f                   	pop    %edi
+  800fbe:	5d                   	pop    %ebp
+  800fbf:	c3                   	ret
+
+00800fc0 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  800fc0:	55                   	push   %ebp
+  800fc1:	89 e5                	mov    %esp,%ebp
+  800fc3:	57                   	push   %edi
+  800fc4:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fc5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fca:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fcd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fd0:	b8 12 00 00 00       	mov    $0x12,%eax
+  800fd5:	89 df                	mov    %ebx,%edi
+  800fd7:	6a 00                	push   $0x0
+  800fd9:	55                   	push   %ebp
+  800fda:	56                   	push   %esi
+  800fdb:	89 e5                	mov    %esp,%ebp
+  800fdd:	8d 35 e5 0f 80 00    	lea    0x800fe5,%esi
+  800fe3:	0f 34                	sysenter
+
+00800fe5 <after_sysenter_label_1758>:
+  800fe5:	5e                   	pop    %esi
+  800fe6:	5d                   	pop    %ebp
+  800fe7:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  800fea:	5b                   	pop    %ebx
+  800feb:	5f                   	pop    %edi
+  800fec:	5d                   	pop    %ebp
+  800fed:	c3                   	ret
+
+00800fee <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  800fee:	55                   	push   %ebp
+  800fef:	89 e5                	mov    %esp,%ebp
+  800ff1:	57                   	push   %edi
+  800ff2:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ff3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ff6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ffb:	b8 13 00 00 00       	mov    $0x13,%eax
+  801000:	89 cb                	mov    %ecx,%ebx
+  801002:	89 cf                	mov    %ecx,%edi
+  801004:	6a 00                	push   $0x0
+  801006:	55                   	push   %ebp
+  801007:	56                   	push   %esi
+  801008:	89 e5                	mov    %esp,%ebp
+  80100a:	8d 35 12 10 80 00    	lea    0x801012,%esi
+  801010:	0f 34                	sysenter
+
+00801012 <after_sysenter_label_1842>:
+  801012:	5e                   	pop    %esi
+  801013:	5d                   	pop    %ebp
+  801014:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801017:	85 c0                	test   %eax,%eax
+  801019:	7f 07                	jg     801022 <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  80101b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80101e:	5b                   	pop    %ebx
+  80101f:	5f                   	pop    %edi
+  801020:	5d                   	pop    %ebp
+  801021:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801022:	83 ec 0c             	sub    $0xc,%esp
+  801025:	50                   	push   %eax
+  801026:	6a 13                	push   $0x13
+  801028:	68 d5 4b 80 00       	push   $0x804bd5
+  80102d:	6a 54                	push   $0x54
+  80102f:	68 f2 4b 80 00       	push   $0x804bf2
+  801034:	e8 46 f1 ff ff       	call   80017f <_panic>
+
+00801039 <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  801039:	55                   	push   %ebp
+  80103a:	89 e5                	mov    %esp,%ebp
+  80103c:	57                   	push   %edi
+  80103d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80103e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801043:	b8 14 00 00 00       	mov    $0x14,%eax
+  801048:	89 d1                	mov    %edx,%ecx
+  80104a:	89 d3                	mov    %edx,%ebx
+  80104c:	89 d7                	mov    %edx,%edi
+  80104e:	6a 00                	push   $0x0
+  801050:	55                   	push   %ebp
+  801051:	56                   	push   %esi
+  801052:	89 e5                	mov    %esp,%ebp
+  801054:	8d 35 5c 10 80 00    	lea    0x80105c,%esi
+  80105a:	0f 34                	sysenter
+
+0080105c <after_sysenter_label_1939>:
+  80105c:	5e                   	pop    %esi
+  80105d:	5d                   	pop    %ebp
+  80105e:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  801061:	5b                   	pop    %ebx
+  801062:	5f                   	pop    %edi
+  801063:	5d                   	pop    %ebp
+  801064:	c3                   	ret
+
+00801065 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  801065:	55                   	push   %ebp
+  801066:	89 e5                	mov    %esp,%ebp
+  801068:	57                   	push   %edi
+  801069:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80106a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80106d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801070:	b8 15 00 00 00       	mov    $0x15,%eax
+  801075:	bf 00 00 00 00       	mov    $0x0,%edi
+  80107a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80107d:	6a 00                	push   $0x0
+  80107f:	55                   	push   %ebp
+  801080:	56                   	push   %esi
+  801081:	89 e5                	mov    %esp,%ebp
+  801083:	8d 35 8b 10 80 00    	lea    0x80108b,%esi
+  801089:	0f 34                	sysenter
+
+0080108b <after_sysenter_label_2028>:
+  80108b:	5e                   	pop    %esi
+  80108c:	5d                   	pop    %ebp
+  80108d:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  801090:	5b                   	pop    %ebx
+  801091:	5f                   	pop    %edi
+  801092:	5d                   	pop    %ebp
+  801093:	c3                   	ret
+
+00801094 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  801094:	55                   	push   %ebp
+  801095:	89 e5                	mov    %esp,%ebp
+  801097:	57                   	push   %edi
+  801098:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801099:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80109e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a4:	b8 16 00 00 00       	mov    $0x16,%eax
+  8010a9:	89 df                	mov    %ebx,%edi
+  8010ab:	6a 00                	push   $0x0
+  8010ad:	55                   	push   %ebp
+  8010ae:	56                   	push   %esi
+  8010af:	89 e5                	mov    %esp,%ebp
+  8010b1:	8d 35 b9 10 80 00    	lea    0x8010b9,%esi
+  8010b7:	0f 34                	sysenter
+
+008010b9 <after_sysenter_label_2114>:
+  8010b9:	5e                   	pop    %esi
+  8010ba:	5d                   	pop    %ebp
+  8010bb:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  8010be:	5b                   	pop    %ebx
+  8010bf:	5f                   	pop    %edi
+  8010c0:	5d                   	pop    %ebp
+  8010c1:	c3                   	ret
+
+008010c2 <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  8010c2:	55                   	push   %ebp
+  8010c3:	89 e5                	mov    %esp,%ebp
+  8010c5:	57                   	push   %edi
+  8010c6:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010cf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010d2:	b8 17 00 00 00       	mov    $0x17,%eax
+  8010d7:	89 df                	mov    %ebx,%edi
+  8010d9:	6a 00                	push   $0x0
+  8010db:	55                   	push   %ebp
+  8010dc:	56                   	push   %esi
+  8010dd:	89 e5                	mov    %esp,%ebp
+  8010df:	8d 35 e7 10 80 00    	lea    0x8010e7,%esi
+  8010e5:	0f 34                	sysenter
+
+008010e7 <after_sysenter_label_2200>:
+  8010e7:	5e                   	pop    %esi
+  8010e8:	5d                   	pop    %ebp
+  8010e9:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  8010ec:	5b                   	pop    %ebx
+  8010ed:	5f                   	pop    %edi
+  8010ee:	5d                   	pop    %ebp
+  8010ef:	c3                   	ret
+
+008010f0 <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  8010f0:	55                   	push   %ebp
+  8010f1:	89 e5                	mov    %esp,%ebp
+  8010f3:	57                   	push   %edi
+  8010f4:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010fa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010fd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801100:	b8 18 00 00 00       	mov    $0x18,%eax
+  801105:	89 df                	mov    %ebx,%edi
+  801107:	6a 00                	push   $0x0
+  801109:	55                   	push   %ebp
+  80110a:	56                   	push   %esi
+  80110b:	89 e5                	mov    %esp,%ebp
+  80110d:	8d 35 15 11 80 00    	lea    0x801115,%esi
+  801113:	0f 34                	sysenter
+
+00801115 <after_sysenter_label_2286>:
+  801115:	5e                   	pop    %esi
+  801116:	5d                   	pop    %ebp
+  801117:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  80111a:	5b                   	pop    %ebx
+  80111b:	5f                   	pop    %edi
+  80111c:	5d                   	pop    %ebp
+  80111d:	c3                   	ret
+
+0080111e <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80111e:	55                   	push   %ebp
+  80111f:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801121:	8b 45 08             	mov    0x8(%ebp),%eax
+  801124:	05 00 00 00 30       	add    $0x30000000,%eax
+  801129:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80112c:	5d                   	pop    %ebp
+  80112d:	c3                   	ret
+
+0080112e <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80112e:	55                   	push   %ebp
+  80112f:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801131:	8b 45 08             	mov    0x8(%ebp),%eax
+  801134:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801139:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80113e:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801143:	5d                   	pop    %ebp
+  801144:	c3                   	ret
+
+00801145 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801145:	55                   	push   %ebp
+  801146:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801148:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80114d:	eb 02                	jmp    801151 <fd_alloc+0xc>
+  80114f:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801151:	89 c2                	mov    %eax,%edx
+  801153:	c1 ea 16             	shr    $0x16,%edx
+  801156:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80115d:	f6 c2 01             	test   $0x1,%dl
+  801160:	74 2b                	je     80118d <fd_alloc+0x48>
+  801162:	89 c2                	mov    %eax,%edx
+  801164:	c1 ea 0c             	shr    $0xc,%edx
+  801167:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80116e:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801174:	f6 c1 01             	test   $0x1,%cl
+  801177:	74 14                	je     80118d <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801179:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80117f:	75 ce                	jne    80114f <fd_alloc+0xa>
+  801181:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801186:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80118b:	eb 05                	jmp    801192 <fd_alloc+0x4d>
+			return 0;
+  80118d:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801192:	8b 55 08             	mov    0x8(%ebp),%edx
+  801195:	89 02                	mov    %eax,(%edx)
+}
+  801197:	89 c8                	mov    %ecx,%eax
+  801199:	5d                   	pop    %ebp
+  80119a:	c3                   	ret
+
+0080119b <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80119b:	55                   	push   %ebp
+  80119c:	89 e5                	mov    %esp,%ebp
+  80119e:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8011a1:	83 f8 1f             	cmp    $0x1f,%eax
+  8011a4:	77 30                	ja     8011d6 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8011a6:	c1 e0 0c             	shl    $0xc,%eax
+  8011a9:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8011ae:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8011b4:	f6 c2 01             	test   $0x1,%dl
+  8011b7:	74 24                	je     8011dd <fd_lookup+0x42>
+  8011b9:	89 c2                	mov    %eax,%edx
+  8011bb:	c1 ea 0c             	shr    $0xc,%edx
+  8011be:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8011c5:	f6 c2 01             	test   $0x1,%dl
+  8011c8:	74 1a                	je     8011e4 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8011ca:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8011cd:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8011cf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011d4:	5d                   	pop    %ebp
+  8011d5:	c3                   	ret
+		return -E_INVAL;
+  8011d6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011db:	eb f7                	jmp    8011d4 <fd_lookup+0x39>
+		return -E_INVAL;
+  8011dd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011e2:	eb f0                	jmp    8011d4 <fd_lookup+0x39>
+  8011e4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011e9:	eb e9                	jmp    8011d4 <fd_lookup+0x39>
+
+008011eb <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8011eb:	55                   	push   %ebp
+  8011ec:	89 e5                	mov    %esp,%ebp
+  8011ee:	53                   	push   %ebx
+  8011ef:	83 ec 04             	sub    $0x4,%esp
+  8011f2:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8011f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011fa:	eb 03                	jmp    8011ff <dev_lookup+0x14>
+  8011fc:	83 c0 01             	add    $0x1,%eax
+  8011ff:	8b 1c 85 7c 4c 80 00 	mov    0x804c7c(,%eax,4),%ebx
+  801206:	85 db                	test   %ebx,%ebx
+  801208:	74 0b                	je     801215 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80120a:	39 13                	cmp    %edx,(%ebx)
+  80120c:	75 ee                	jne    8011fc <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80120e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801213:	eb 49                	jmp    80125e <dev_lookup+0x73>
+  801215:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801217:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  80121d:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801222:	77 18                	ja     80123c <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801224:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801229:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  80122b:	c1 e8 10             	shr    $0x10,%eax
+  80122e:	74 0c                	je     80123c <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801230:	c1 e0 10             	shl    $0x10,%eax
+  801233:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  801238:	29 c1                	sub    %eax,%ecx
+  80123a:	eb 06                	jmp    801242 <dev_lookup+0x57>
+		return pthread_main_tls;
+  80123c:	8b 0d c0 62 c0 00    	mov    0xc062c0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801242:	8b 01                	mov    (%ecx),%eax
+  801244:	8b 40 48             	mov    0x48(%eax),%eax
+  801247:	83 ec 04             	sub    $0x4,%esp
+  80124a:	52                   	push   %edx
+  80124b:	50                   	push   %eax
+  80124c:	68 00 4c 80 00       	push   $0x804c00
+  801251:	e8 04 f0 ff ff       	call   80025a <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801256:	83 c4 10             	add    $0x10,%esp
+  801259:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80125e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801261:	89 1a                	mov    %ebx,(%edx)
+}
+  801263:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801266:	c9                   	leave
+  801267:	c3                   	ret
+
+00801268 <fd_close>:
+{
+  801268:	55                   	push   %ebp
+  801269:	89 e5                	mov    %esp,%ebp
+  80126b:	57                   	push   %edi
+  80126c:	56                   	push   %esi
+  80126d:	53                   	push   %ebx
+  80126e:	83 ec 24             	sub    $0x24,%esp
+  801271:	8b 75 08             	mov    0x8(%ebp),%esi
+  801274:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801277:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80127a:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80127b:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801281:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801284:	50                   	push   %eax
+  801285:	e8 11 ff ff ff       	call   80119b <fd_lookup>
+  80128a:	89 c3                	mov    %eax,%ebx
+  80128c:	83 c4 10             	add    $0x10,%esp
+  80128f:	85 c0                	test   %eax,%eax
+  801291:	78 05                	js     801298 <fd_close+0x30>
+	    || fd != fd2)
+  801293:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801296:	74 16                	je     8012ae <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801298:	89 f8                	mov    %edi,%eax
+  80129a:	84 c0                	test   %al,%al
+  80129c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012a1:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8012a4:	89 d8                	mov    %ebx,%eax
+  8012a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012a9:	5b                   	pop    %ebx
+  8012aa:	5e                   	pop    %esi
+  8012ab:	5f                   	pop    %edi
+  8012ac:	5d                   	pop    %ebp
+  8012ad:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8012ae:	83 ec 08             	sub    $0x8,%esp
+  8012b1:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8012b4:	50                   	push   %eax
+  8012b5:	ff 36                	push   (%esi)
+  8012b7:	e8 2f ff ff ff       	call   8011eb <dev_lookup>
+  8012bc:	89 c3                	mov    %eax,%ebx
+  8012be:	83 c4 10             	add    $0x10,%esp
+  8012c1:	85 c0                	test   %eax,%eax
+  8012c3:	78 1a                	js     8012df <fd_close+0x77>
+		if (dev->dev_close)
+  8012c5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8012c8:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8012cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8012d0:	85 c0                	test   %eax,%eax
+  8012d2:	74 0b                	je     8012df <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8012d4:	83 ec 0c             	sub    $0xc,%esp
+  8012d7:	56                   	push   %esi
+  8012d8:	ff d0                	call   *%eax
+  8012da:	89 c3                	mov    %eax,%ebx
+  8012dc:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8012df:	83 ec 08             	sub    $0x8,%esp
+  8012e2:	56                   	push   %esi
+  8012e3:	6a 00                	push   $0x0
+  8012e5:	e8 2b fa ff ff       	call   800d15 <sys_page_unmap>
+	return r;
+  8012ea:	83 c4 10             	add    $0x10,%esp
+  8012ed:	eb b5                	jmp    8012a4 <fd_close+0x3c>
+
+008012ef <close>:
+
+int
+close(int fdnum)
+{
+  8012ef:	55                   	push   %ebp
+  8012f0:	89 e5                	mov    %esp,%ebp
+  8012f2:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8012f5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8012f8:	50                   	push   %eax
+  8012f9:	ff 75 08             	push   0x8(%ebp)
+  8012fc:	e8 9a fe ff ff       	call   80119b <fd_lookup>
+  801301:	83 c4 10             	add    $0x10,%esp
+  801304:	85 c0                	test   %eax,%eax
+  801306:	79 02                	jns    80130a <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801308:	c9                   	leave
+  801309:	c3                   	ret
+		return fd_close(fd, 1);
+  80130a:	83 ec 08             	sub    $0x8,%esp
+  80130d:	6a 01                	push   $0x1
+  80130f:	ff 75 f4             	push   -0xc(%ebp)
+  801312:	e8 51 ff ff ff       	call   801268 <fd_close>
+  801317:	83 c4 10             	add    $0x10,%esp
+  80131a:	eb ec                	jmp    801308 <close+0x19>
+
+0080131c <close_all>:
+
+void
+close_all(void)
+{
+  80131c:	55                   	push   %ebp
+  80131d:	89 e5                	mov    %esp,%ebp
+  80131f:	53                   	push   %ebx
+  801320:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801323:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801328:	83 ec 0c             	sub    $0xc,%esp
+  80132b:	53                   	push   %ebx
+  80132c:	e8 be ff ff ff       	call   8012ef <close>
+	for (i = 0; i < MAXFD; i++)
+  801331:	83 c3 01             	add    $0x1,%ebx
+  801334:	83 c4 10             	add    $0x10,%esp
+  801337:	83 fb 20             	cmp    $0x20,%ebx
+  80133a:	75 ec                	jne    801328 <close_all+0xc>
+}
+  80133c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80133f:	c9                   	leave
+  801340:	c3                   	ret
+
+00801341 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801341:	55                   	push   %ebp
+  801342:	89 e5                	mov    %esp,%ebp
+  801344:	57                   	push   %edi
+  801345:	56                   	push   %esi
+  801346:	53                   	push   %ebx
+  801347:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80134a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80134d:	50                   	push   %eax
+  80134e:	ff 75 08             	push   0x8(%ebp)
+  801351:	e8 45 fe ff ff       	call   80119b <fd_lookup>
+  801356:	89 c3                	mov    %eax,%ebx
+  801358:	83 c4 10             	add    $0x10,%esp
+  80135b:	85 c0                	test   %eax,%eax
+  80135d:	78 7f                	js     8013de <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80135f:	83 ec 0c             	sub    $0xc,%esp
+  801362:	ff 75 0c             	push   0xc(%ebp)
+  801365:	e8 85 ff ff ff       	call   8012ef <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80136a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80136d:	c1 e6 0c             	shl    $0xc,%esi
+  801370:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801376:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801379:	89 3c 24             	mov    %edi,(%esp)
+  80137c:	e8 ad fd ff ff       	call   80112e <fd2data>
+  801381:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801383:	89 34 24             	mov    %esi,(%esp)
+  801386:	e8 a3 fd ff ff       	call   80112e <fd2data>
+  80138b:	83 c4 10             	add    $0x10,%esp
+  80138e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801391:	89 d8                	mov    %ebx,%eax
+  801393:	c1 e8 16             	shr    $0x16,%eax
+  801396:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80139d:	a8 01                	test   $0x1,%al
+  80139f:	74 11                	je     8013b2 <dup+0x71>
+  8013a1:	89 d8                	mov    %ebx,%eax
+  8013a3:	c1 e8 0c             	shr    $0xc,%eax
+  8013a6:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8013ad:	f6 c2 01             	test   $0x1,%dl
+  8013b0:	75 36                	jne    8013e8 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8013b2:	89 f8                	mov    %edi,%eax
+  8013b4:	c1 e8 0c             	shr    $0xc,%eax
+  8013b7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8013be:	83 ec 0c             	sub    $0xc,%esp
+  8013c1:	25 07 0e 00 00       	and    $0xe07,%eax
+  8013c6:	50                   	push   %eax
+  8013c7:	56                   	push   %esi
+  8013c8:	6a 00                	push   $0x0
+  8013ca:	57                   	push   %edi
+  8013cb:	6a 00                	push   $0x0
+  8013cd:	e8 f7 f8 ff ff       	call   800cc9 <sys_page_map>
+  8013d2:	89 c3                	mov    %eax,%ebx
+  8013d4:	83 c4 20             	add    $0x20,%esp
+  8013d7:	85 c0                	test   %eax,%eax
+  8013d9:	78 33                	js     80140e <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8013db:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8013de:	89 d8                	mov    %ebx,%eax
+  8013e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013e3:	5b                   	pop    %ebx
+  8013e4:	5e                   	pop    %esi
+  8013e5:	5f                   	pop    %edi
+  8013e6:	5d                   	pop    %ebp
+  8013e7:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8013e8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8013ef:	83 ec 0c             	sub    $0xc,%esp
+  8013f2:	25 07 0e 00 00       	and    $0xe07,%eax
+  8013f7:	50                   	push   %eax
+  8013f8:	ff 75 d4             	push   -0x2c(%ebp)
+  8013fb:	6a 00                	push   $0x0
+  8013fd:	53                   	push   %ebx
+  8013fe:	6a 00                	push   $0x0
+  801400:	e8 c4 f8 ff ff       	call   800cc9 <sys_page_map>
+  801405:	89 c3                	mov    %eax,%ebx
+  801407:	83 c4 20             	add    $0x20,%esp
+  80140a:	85 c0                	test   %eax,%eax
+  80140c:	79 a4                	jns    8013b2 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80140e:	83 ec 08             	sub    $0x8,%esp
+  801411:	56                   	push   %esi
+  801412:	6a 00                	push   $0x0
+  801414:	e8 fc f8 ff ff       	call   800d15 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801419:	83 c4 08             	add    $0x8,%esp
+  80141c:	ff 75 d4             	push   -0x2c(%ebp)
+  80141f:	6a 00                	push   $0x0
+  801421:	e8 ef f8 ff ff       	call   800d15 <sys_page_unmap>
+	return r;
+  801426:	83 c4 10             	add    $0x10,%esp
+  801429:	eb b3                	jmp    8013de <dup+0x9d>
+
+0080142b <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80142b:	55                   	push   %ebp
+  80142c:	89 e5                	mov    %esp,%ebp
+  80142e:	56                   	push   %esi
+  80142f:	53                   	push   %ebx
+  801430:	83 ec 18             	sub    $0x18,%esp
+  801433:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801436:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801439:	50                   	push   %eax
+  80143a:	53                   	push   %ebx
+  80143b:	e8 5b fd ff ff       	call   80119b <fd_lookup>
+  801440:	83 c4 10             	add    $0x10,%esp
+  801443:	85 c0                	test   %eax,%eax
+  801445:	78 3c                	js     801483 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801447:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80144a:	83 ec 08             	sub    $0x8,%esp
+  80144d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801450:	50                   	push   %eax
+  801451:	ff 36                	push   (%esi)
+  801453:	e8 93 fd ff ff       	call   8011eb <dev_lookup>
+  801458:	83 c4 10             	add    $0x10,%esp
+  80145b:	85 c0                	test   %eax,%eax
+  80145d:	78 24                	js     801483 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80145f:	8b 46 08             	mov    0x8(%esi),%eax
+  801462:	83 e0 03             	and    $0x3,%eax
+  801465:	83 f8 01             	cmp    $0x1,%eax
+  801468:	74 20                	je     80148a <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80146a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80146d:	8b 40 08             	mov    0x8(%eax),%eax
+  801470:	85 c0                	test   %eax,%eax
+  801472:	74 61                	je     8014d5 <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801474:	83 ec 04             	sub    $0x4,%esp
+  801477:	ff 75 10             	push   0x10(%ebp)
+  80147a:	ff 75 0c             	push   0xc(%ebp)
+  80147d:	56                   	push   %esi
+  80147e:	ff d0                	call   *%eax
+  801480:	83 c4 10             	add    $0x10,%esp
+}
+  801483:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801486:	5b                   	pop    %ebx
+  801487:	5e                   	pop    %esi
+  801488:	5d                   	pop    %ebp
+  801489:	c3                   	ret
+  80148a:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80148c:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801492:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801497:	77 18                	ja     8014b1 <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801499:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80149e:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8014a0:	c1 e8 10             	shr    $0x10,%eax
+  8014a3:	74 0c                	je     8014b1 <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8014a5:	c1 e0 10             	shl    $0x10,%eax
+  8014a8:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8014ad:	29 c2                	sub    %eax,%edx
+  8014af:	eb 06                	jmp    8014b7 <read+0x8c>
+		return pthread_main_tls;
+  8014b1:	8b 15 c0 62 c0 00    	mov    0xc062c0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8014b7:	8b 02                	mov    (%edx),%eax
+  8014b9:	8b 40 48             	mov    0x48(%eax),%eax
+  8014bc:	83 ec 04             	sub    $0x4,%esp
+  8014bf:	53                   	push   %ebx
+  8014c0:	50                   	push   %eax
+  8014c1:	68 41 4c 80 00       	push   $0x804c41
+  8014c6:	e8 8f ed ff ff       	call   80025a <cprintf>
+		return -E_INVAL;
+  8014cb:	83 c4 10             	add    $0x10,%esp
+  8014ce:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014d3:	eb ae                	jmp    801483 <read+0x58>
+		return -E_NOT_SUPP;
+  8014d5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8014da:	eb a7                	jmp    801483 <read+0x58>
+
+008014dc <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8014dc:	55                   	push   %ebp
+  8014dd:	89 e5                	mov    %esp,%ebp
+  8014df:	57                   	push   %edi
+  8014e0:	56                   	push   %esi
+  8014e1:	53                   	push   %ebx
+  8014e2:	83 ec 0c             	sub    $0xc,%esp
+  8014e5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8014e8:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8014eb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014f0:	eb 02                	jmp    8014f4 <readn+0x18>
+  8014f2:	01 c3                	add    %eax,%ebx
+  8014f4:	39 f3                	cmp    %esi,%ebx
+  8014f6:	73 21                	jae    801519 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8014f8:	83 ec 04             	sub    $0x4,%esp
+  8014fb:	89 f0                	mov    %esi,%eax
+  8014fd:	29 d8                	sub    %ebx,%eax
+  8014ff:	50                   	push   %eax
+  801500:	89 d8                	mov    %ebx,%eax
+  801502:	03 45 0c             	add    0xc(%ebp),%eax
+  801505:	50                   	push   %eax
+  801506:	57                   	push   %edi
+  801507:	e8 1f ff ff ff       	call   80142b <read>
+		if (m < 0)
+  80150c:	83 c4 10             	add    $0x10,%esp
+  80150f:	85 c0                	test   %eax,%eax
+  801511:	78 04                	js     801517 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801513:	75 dd                	jne    8014f2 <readn+0x16>
+  801515:	eb 02                	jmp    801519 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801517:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801519:	89 d8                	mov    %ebx,%eax
+  80151b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80151e:	5b                   	pop    %ebx
+  80151f:	5e                   	pop    %esi
+  801520:	5f                   	pop    %edi
+  801521:	5d                   	pop    %ebp
+  801522:	c3                   	ret
+
+00801523 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801523:	55                   	push   %ebp
+  801524:	89 e5                	mov    %esp,%ebp
+  801526:	56                   	push   %esi
+  801527:	53                   	push   %ebx
+  801528:	83 ec 18             	sub    $0x18,%esp
+  80152b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80152e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801531:	50                   	push   %eax
+  801532:	53                   	push   %ebx
+  801533:	e8 63 fc ff ff       	call   80119b <fd_lookup>
+  801538:	83 c4 10             	add    $0x10,%esp
+  80153b:	85 c0                	test   %eax,%eax
+  80153d:	78 37                	js     801576 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80153f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801542:	83 ec 08             	sub    $0x8,%esp
+  801545:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801548:	50                   	push   %eax
+  801549:	ff 36                	push   (%esi)
+  80154b:	e8 9b fc ff ff       	call   8011eb <dev_lookup>
+  801550:	83 c4 10             	add    $0x10,%esp
+  801553:	85 c0                	test   %eax,%eax
+  801555:	78 1f                	js     801576 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801557:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80155b:	74 20                	je     80157d <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80155d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801560:	8b 40 0c             	mov    0xc(%eax),%eax
+  801563:	85 c0                	test   %eax,%eax
+  801565:	74 61                	je     8015c8 <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801567:	83 ec 04             	sub    $0x4,%esp
+  80156a:	ff 75 10             	push   0x10(%ebp)
+  80156d:	ff 75 0c             	push   0xc(%ebp)
+  801570:	56                   	push   %esi
+  801571:	ff d0                	call   *%eax
+  801573:	83 c4 10             	add    $0x10,%esp
+}
+  801576:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801579:	5b                   	pop    %ebx
+  80157a:	5e                   	pop    %esi
+  80157b:	5d                   	pop    %ebp
+  80157c:	c3                   	ret
+  80157d:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80157f:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801585:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80158a:	77 18                	ja     8015a4 <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80158c:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801591:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801593:	c1 e8 10             	shr    $0x10,%eax
+  801596:	74 0c                	je     8015a4 <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801598:	c1 e0 10             	shl    $0x10,%eax
+  80159b:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8015a0:	29 c2                	sub    %eax,%edx
+  8015a2:	eb 06                	jmp    8015aa <write+0x87>
+		return pthread_main_tls;
+  8015a4:	8b 15 c0 62 c0 00    	mov    0xc062c0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8015aa:	8b 02                	mov    (%edx),%eax
+  8015ac:	8b 40 48             	mov    0x48(%eax),%eax
+  8015af:	83 ec 04             	sub    $0x4,%esp
+  8015b2:	53                   	push   %ebx
+  8015b3:	50                   	push   %eax
+  8015b4:	68 5d 4c 80 00       	push   $0x804c5d
+  8015b9:	e8 9c ec ff ff       	call   80025a <cprintf>
+		return -E_INVAL;
+  8015be:	83 c4 10             	add    $0x10,%esp
+  8015c1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015c6:	eb ae                	jmp    801576 <write+0x53>
+		return -E_NOT_SUPP;
+  8015c8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015cd:	eb a7                	jmp    801576 <write+0x53>
+
+008015cf <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8015cf:	55                   	push   %ebp
+  8015d0:	89 e5                	mov    %esp,%ebp
+  8015d2:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8015d5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015d8:	50                   	push   %eax
+  8015d9:	ff 75 08             	push   0x8(%ebp)
+  8015dc:	e8 ba fb ff ff       	call   80119b <fd_lookup>
+  8015e1:	83 c4 10             	add    $0x10,%esp
+  8015e4:	85 c0                	test   %eax,%eax
+  8015e6:	78 0e                	js     8015f6 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8015e8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8015eb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015ee:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8015f1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015f6:	c9                   	leave
+  8015f7:	c3                   	ret
+
+008015f8 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8015f8:	55                   	push   %ebp
+  8015f9:	89 e5                	mov    %esp,%ebp
+  8015fb:	56                   	push   %esi
+  8015fc:	53                   	push   %ebx
+  8015fd:	83 ec 18             	sub    $0x18,%esp
+  801600:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801603:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801606:	50                   	push   %eax
+  801607:	53                   	push   %ebx
+  801608:	e8 8e fb ff ff       	call   80119b <fd_lookup>
+  80160d:	83 c4 10             	add    $0x10,%esp
+  801610:	85 c0                	test   %eax,%eax
+  801612:	78 34                	js     801648 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801614:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801617:	83 ec 08             	sub    $0x8,%esp
+  80161a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80161d:	50                   	push   %eax
+  80161e:	ff 36                	push   (%esi)
+  801620:	e8 c6 fb ff ff       	call   8011eb <dev_lookup>
+  801625:	83 c4 10             	add    $0x10,%esp
+  801628:	85 c0                	test   %eax,%eax
+  80162a:	78 1c                	js     801648 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80162c:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801630:	74 1d                	je     80164f <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801632:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801635:	8b 40 18             	mov    0x18(%eax),%eax
+  801638:	85 c0                	test   %eax,%eax
+  80163a:	74 5e                	je     80169a <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80163c:	83 ec 08             	sub    $0x8,%esp
+  80163f:	ff 75 0c             	push   0xc(%ebp)
+  801642:	56                   	push   %esi
+  801643:	ff d0                	call   *%eax
+  801645:	83 c4 10             	add    $0x10,%esp
+}
+  801648:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80164b:	5b                   	pop    %ebx
+  80164c:	5e                   	pop    %esi
+  80164d:	5d                   	pop    %ebp
+  80164e:	c3                   	ret
+  80164f:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801651:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801657:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80165c:	77 18                	ja     801676 <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80165e:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801663:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801665:	c1 e8 10             	shr    $0x10,%eax
+  801668:	74 0c                	je     801676 <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80166a:	c1 e0 10             	shl    $0x10,%eax
+  80166d:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801672:	29 c2                	sub    %eax,%edx
+  801674:	eb 06                	jmp    80167c <ftruncate+0x84>
+		return pthread_main_tls;
+  801676:	8b 15 c0 62 c0 00    	mov    0xc062c0,%edx
+			thisenv->env_id, fdnum);
+  80167c:	8b 02                	mov    (%edx),%eax
+  80167e:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801681:	83 ec 04             	sub    $0x4,%esp
+  801684:	53                   	push   %ebx
+  801685:	50                   	push   %eax
+  801686:	68 20 4c 80 00       	push   $0x804c20
+  80168b:	e8 ca eb ff ff       	call   80025a <cprintf>
+		return -E_INVAL;
+  801690:	83 c4 10             	add    $0x10,%esp
+  801693:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801698:	eb ae                	jmp    801648 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80169a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80169f:	eb a7                	jmp    801648 <ftruncate+0x50>
+
+008016a1 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8016a1:	55                   	push   %ebp
+  8016a2:	89 e5                	mov    %esp,%ebp
+  8016a4:	56                   	push   %esi
+  8016a5:	53                   	push   %ebx
+  8016a6:	83 ec 18             	sub    $0x18,%esp
+  8016a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016ac:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016af:	50                   	push   %eax
+  8016b0:	ff 75 08             	push   0x8(%ebp)
+  8016b3:	e8 e3 fa ff ff       	call   80119b <fd_lookup>
+  8016b8:	83 c4 10             	add    $0x10,%esp
+  8016bb:	85 c0                	test   %eax,%eax
+  8016bd:	78 49                	js     801708 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016bf:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8016c2:	83 ec 08             	sub    $0x8,%esp
+  8016c5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016c8:	50                   	push   %eax
+  8016c9:	ff 36                	push   (%esi)
+  8016cb:	e8 1b fb ff ff       	call   8011eb <dev_lookup>
+  8016d0:	83 c4 10             	add    $0x10,%esp
+  8016d3:	85 c0                	test   %eax,%eax
+  8016d5:	78 31                	js     801708 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8016d7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016da:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8016de:	74 2f                	je     80170f <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8016e0:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8016e3:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8016ea:	00 00 00 
+	stat->st_isdir = 0;
+  8016ed:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8016f4:	00 00 00 
+	stat->st_dev = dev;
+  8016f7:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8016fd:	83 ec 08             	sub    $0x8,%esp
+  801700:	53                   	push   %ebx
+  801701:	56                   	push   %esi
+  801702:	ff 50 14             	call   *0x14(%eax)
+  801705:	83 c4 10             	add    $0x10,%esp
+}
+  801708:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80170b:	5b                   	pop    %ebx
+  80170c:	5e                   	pop    %esi
+  80170d:	5d                   	pop    %ebp
+  80170e:	c3                   	ret
+		return -E_NOT_SUPP;
+  80170f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801714:	eb f2                	jmp    801708 <fstat+0x67>
+
+00801716 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801716:	55                   	push   %ebp
+  801717:	89 e5                	mov    %esp,%ebp
+  801719:	56                   	push   %esi
+  80171a:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80171b:	83 ec 08             	sub    $0x8,%esp
+  80171e:	6a 00                	push   $0x0
+  801720:	ff 75 08             	push   0x8(%ebp)
+  801723:	e8 4b 03 00 00       	call   801a73 <open>
+  801728:	89 c3                	mov    %eax,%ebx
+  80172a:	83 c4 10             	add    $0x10,%esp
+  80172d:	85 c0                	test   %eax,%eax
+  80172f:	78 1b                	js     80174c <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801731:	83 ec 08             	sub    $0x8,%esp
+  801734:	ff 75 0c             	push   0xc(%ebp)
+  801737:	50                   	push   %eax
+  801738:	e8 64 ff ff ff       	call   8016a1 <fstat>
+  80173d:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80173f:	89 1c 24             	mov    %ebx,(%esp)
+  801742:	e8 a8 fb ff ff       	call   8012ef <close>
+	return r;
+  801747:	83 c4 10             	add    $0x10,%esp
+  80174a:	89 f3                	mov    %esi,%ebx
+}
+  80174c:	89 d8                	mov    %ebx,%eax
+  80174e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801751:	5b                   	pop    %ebx
+  801752:	5e                   	pop    %esi
+  801753:	5d                   	pop    %ebp
+  801754:	c3                   	ret
+
+00801755 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801755:	55                   	push   %ebp
+  801756:	89 e5                	mov    %esp,%ebp
+  801758:	56                   	push   %esi
+  801759:	53                   	push   %ebx
+  80175a:	89 c6                	mov    %eax,%esi
+  80175c:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  80175e:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  801765:	74 27                	je     80178e <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801767:	6a 07                	push   $0x7
+  801769:	68 00 70 c0 00       	push   $0xc07000
+  80176e:	56                   	push   %esi
+  80176f:	ff 35 00 60 80 00    	push   0x806000
+  801775:	e8 4e 2c 00 00       	call   8043c8 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  80177a:	83 c4 0c             	add    $0xc,%esp
+  80177d:	6a 00                	push   $0x0
+  80177f:	53                   	push   %ebx
+  801780:	6a 00                	push   $0x0
+  801782:	e8 4b 2b 00 00       	call   8042d2 <ipc_recv>
+}
+  801787:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80178a:	5b                   	pop    %ebx
+  80178b:	5e                   	pop    %esi
+  80178c:	5d                   	pop    %ebp
+  80178d:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80178e:	83 ec 0c             	sub    $0xc,%esp
+  801791:	6a 01                	push   $0x1
+  801793:	e8 86 2c 00 00       	call   80441e <ipc_find_env>
+  801798:	a3 00 60 80 00       	mov    %eax,0x806000
+  80179d:	83 c4 10             	add    $0x10,%esp
+  8017a0:	eb c5                	jmp    801767 <fsipc+0x12>
+
+008017a2 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8017a2:	55                   	push   %ebp
+  8017a3:	89 e5                	mov    %esp,%ebp
+  8017a5:	53                   	push   %ebx
+  8017a6:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  8017a9:	68 04 60 80 00       	push   $0x806004
+  8017ae:	e8 29 1b 00 00       	call   8032dc <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8017b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017b6:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017b9:	a3 00 70 c0 00       	mov    %eax,0xc07000
+	fsipcbuf.set_size.req_size = newsize;
+  8017be:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8017c1:	a3 04 70 c0 00       	mov    %eax,0xc07004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  8017c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017cb:	b8 02 00 00 00       	mov    $0x2,%eax
+  8017d0:	e8 80 ff ff ff       	call   801755 <fsipc>
+  8017d5:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8017d7:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  8017de:	e8 66 1b 00 00       	call   803349 <mutex_unlock>
+	return r;
+}
+  8017e3:	89 d8                	mov    %ebx,%eax
+  8017e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017e8:	c9                   	leave
+  8017e9:	c3                   	ret
+
+008017ea <devfile_flush>:
+{
+  8017ea:	55                   	push   %ebp
+  8017eb:	89 e5                	mov    %esp,%ebp
+  8017ed:	53                   	push   %ebx
+  8017ee:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  8017f1:	68 04 60 80 00       	push   $0x806004
+  8017f6:	e8 e1 1a 00 00       	call   8032dc <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8017fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017fe:	8b 40 0c             	mov    0xc(%eax),%eax
+  801801:	a3 00 70 c0 00       	mov    %eax,0xc07000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  801806:	ba 00 00 00 00       	mov    $0x0,%edx
+  80180b:	b8 06 00 00 00       	mov    $0x6,%eax
+  801810:	e8 40 ff ff ff       	call   801755 <fsipc>
+  801815:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801817:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  80181e:	e8 26 1b 00 00       	call   803349 <mutex_unlock>
+}
+  801823:	89 d8                	mov    %ebx,%eax
+  801825:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801828:	c9                   	leave
+  801829:	c3                   	ret
+
+0080182a <devfile_stat>:
+{
+  80182a:	55                   	push   %ebp
+  80182b:	89 e5                	mov    %esp,%ebp
+  80182d:	56                   	push   %esi
+  80182e:	53                   	push   %ebx
+  80182f:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  801832:	83 ec 0c             	sub    $0xc,%esp
+  801835:	68 04 60 80 00       	push   $0x806004
+  80183a:	e8 9d 1a 00 00       	call   8032dc <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80183f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801842:	8b 40 0c             	mov    0xc(%eax),%eax
+  801845:	a3 00 70 c0 00       	mov    %eax,0xc07000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  80184a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80184f:	b8 05 00 00 00       	mov    $0x5,%eax
+  801854:	e8 fc fe ff ff       	call   801755 <fsipc>
+  801859:	89 c3                	mov    %eax,%ebx
+  80185b:	83 c4 10             	add    $0x10,%esp
+  80185e:	85 c0                	test   %eax,%eax
+  801860:	79 16                	jns    801878 <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  801862:	83 ec 0c             	sub    $0xc,%esp
+  801865:	68 04 60 80 00       	push   $0x806004
+  80186a:	e8 da 1a 00 00       	call   803349 <mutex_unlock>
+}
+  80186f:	89 d8                	mov    %ebx,%eax
+  801871:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801874:	5b                   	pop    %ebx
+  801875:	5e                   	pop    %esi
+  801876:	5d                   	pop    %ebp
+  801877:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801878:	83 ec 08             	sub    $0x8,%esp
+  80187b:	68 00 70 c0 00       	push   $0xc07000
+  801880:	56                   	push   %esi
+  801881:	e8 b8 ef ff ff       	call   80083e <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  801886:	a1 80 70 c0 00       	mov    0xc07080,%eax
+  80188b:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801891:	a1 84 70 c0 00       	mov    0xc07084,%eax
+  801896:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  80189c:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  80189f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018a4:	eb bc                	jmp    801862 <devfile_stat+0x38>
+
+008018a6 <devfile_write>:
+{
+  8018a6:	55                   	push   %ebp
+  8018a7:	89 e5                	mov    %esp,%ebp
+  8018a9:	53                   	push   %ebx
+  8018aa:	83 ec 10             	sub    $0x10,%esp
+  8018ad:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  8018b0:	68 04 60 80 00       	push   $0x806004
+  8018b5:	e8 22 1a 00 00       	call   8032dc <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8018ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018bd:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018c0:	a3 00 70 c0 00       	mov    %eax,0xc07000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  8018c5:	83 c4 10             	add    $0x10,%esp
+  8018c8:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  8018ce:	76 3d                	jbe    80190d <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  8018d0:	b8 00 00 10 00       	mov    $0x100000,%eax
+  8018d5:	39 c3                	cmp    %eax,%ebx
+  8018d7:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  8018da:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8018dd:	a3 08 70 c0 00       	mov    %eax,0xc07008
+	fsipcbuf.write.req_n = n;
+  8018e2:	89 1d 04 70 c0 00    	mov    %ebx,0xc07004
+	r = fsipc(FSREQ_WRITE, NULL);
+  8018e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018ed:	b8 04 00 00 00       	mov    $0x4,%eax
+  8018f2:	e8 5e fe ff ff       	call   801755 <fsipc>
+  8018f7:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8018f9:	83 ec 0c             	sub    $0xc,%esp
+  8018fc:	68 04 60 80 00       	push   $0x806004
+  801901:	e8 43 1a 00 00       	call   803349 <mutex_unlock>
+}
+  801906:	89 d8                	mov    %ebx,%eax
+  801908:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80190b:	c9                   	leave
+  80190c:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  80190d:	83 ec 04             	sub    $0x4,%esp
+  801910:	53                   	push   %ebx
+  801911:	ff 75 0c             	push   0xc(%ebp)
+  801914:	68 0c 70 c0 00       	push   $0xc0700c
+  801919:	e8 a6 f0 ff ff       	call   8009c4 <memmove>
+  80191e:	83 c4 10             	add    $0x10,%esp
+  801921:	b8 00 00 00 00       	mov    $0x0,%eax
+  801926:	eb b5                	jmp    8018dd <devfile_write+0x37>
+
+00801928 <devfile_read>:
+{
+  801928:	55                   	push   %ebp
+  801929:	89 e5                	mov    %esp,%ebp
+  80192b:	57                   	push   %edi
+  80192c:	56                   	push   %esi
+  80192d:	53                   	push   %ebx
+  80192e:	83 ec 0c             	sub    $0xc,%esp
+  801931:	8b 75 08             	mov    0x8(%ebp),%esi
+  801934:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801937:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  80193a:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801940:	0f 86 8c 00 00 00    	jbe    8019d2 <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  801946:	b8 00 00 10 00       	mov    $0x100000,%eax
+  80194b:	39 c3                	cmp    %eax,%ebx
+  80194d:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  801950:	89 f8                	mov    %edi,%eax
+  801952:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801955:	eb 0f                	jmp    801966 <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  801957:	0f b6 08             	movzbl (%eax),%ecx
+  80195a:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  80195c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801961:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  801966:	39 d0                	cmp    %edx,%eax
+  801968:	72 ed                	jb     801957 <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  80196a:	83 ec 0c             	sub    $0xc,%esp
+  80196d:	68 04 60 80 00       	push   $0x806004
+  801972:	e8 65 19 00 00       	call   8032dc <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801977:	8b 46 0c             	mov    0xc(%esi),%eax
+  80197a:	a3 00 70 c0 00       	mov    %eax,0xc07000
+		fsipcbuf.read.req_n = n;
+  80197f:	89 1d 04 70 c0 00    	mov    %ebx,0xc07004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  801985:	89 3d 08 70 c0 00    	mov    %edi,0xc07008
+		r = fsipc(FSREQ_READ, NULL);
+  80198b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801990:	b8 03 00 00 00       	mov    $0x3,%eax
+  801995:	e8 bb fd ff ff       	call   801755 <fsipc>
+  80199a:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  80199c:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  8019a3:	e8 a1 19 00 00       	call   803349 <mutex_unlock>
+		assert(r <= (int) n);
+  8019a8:	83 c4 10             	add    $0x10,%esp
+  8019ab:	39 f3                	cmp    %esi,%ebx
+  8019ad:	7c 0a                	jl     8019b9 <devfile_read+0x91>
+}
+  8019af:	89 f0                	mov    %esi,%eax
+  8019b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019b4:	5b                   	pop    %ebx
+  8019b5:	5e                   	pop    %esi
+  8019b6:	5f                   	pop    %edi
+  8019b7:	5d                   	pop    %ebp
+  8019b8:	c3                   	ret
+		assert(r <= (int) n);
+  8019b9:	68 90 4c 80 00       	push   $0x804c90
+  8019be:	68 9d 4c 80 00       	push   $0x804c9d
+  8019c3:	68 90 00 00 00       	push   $0x90
+  8019c8:	68 b2 4c 80 00       	push   $0x804cb2
+  8019cd:	e8 ad e7 ff ff       	call   80017f <_panic>
+	mutex_lock(&fsipc_mu);
+  8019d2:	83 ec 0c             	sub    $0xc,%esp
+  8019d5:	68 04 60 80 00       	push   $0x806004
+  8019da:	e8 fd 18 00 00       	call   8032dc <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8019df:	8b 46 0c             	mov    0xc(%esi),%eax
+  8019e2:	a3 00 70 c0 00       	mov    %eax,0xc07000
+	fsipcbuf.read.req_n = n;
+  8019e7:	89 1d 04 70 c0 00    	mov    %ebx,0xc07004
+	fsipcbuf.read.req_va = 0;
+  8019ed:	c7 05 08 70 c0 00 00 	movl   $0x0,0xc07008
+  8019f4:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  8019f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019fc:	b8 03 00 00 00       	mov    $0x3,%eax
+  801a01:	e8 4f fd ff ff       	call   801755 <fsipc>
+  801a06:	89 c6                	mov    %eax,%esi
+  801a08:	83 c4 10             	add    $0x10,%esp
+  801a0b:	85 c0                	test   %eax,%eax
+  801a0d:	78 1d                	js     801a2c <devfile_read+0x104>
+		assert(r <= n);
+  801a0f:	39 c3                	cmp    %eax,%ebx
+  801a11:	72 2e                	jb     801a41 <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  801a13:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801a18:	7f 40                	jg     801a5a <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801a1a:	83 ec 04             	sub    $0x4,%esp
+  801a1d:	50                   	push   %eax
+  801a1e:	68 00 70 c0 00       	push   $0xc07000
+  801a23:	57                   	push   %edi
+  801a24:	e8 9b ef ff ff       	call   8009c4 <memmove>
+  801a29:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  801a2c:	83 ec 0c             	sub    $0xc,%esp
+  801a2f:	68 04 60 80 00       	push   $0x806004
+  801a34:	e8 10 19 00 00       	call   803349 <mutex_unlock>
+	return r;
+  801a39:	83 c4 10             	add    $0x10,%esp
+  801a3c:	e9 6e ff ff ff       	jmp    8019af <devfile_read+0x87>
+		assert(r <= n);
+  801a41:	68 bd 4c 80 00       	push   $0x804cbd
+  801a46:	68 9d 4c 80 00       	push   $0x804c9d
+  801a4b:	68 99 00 00 00       	push   $0x99
+  801a50:	68 b2 4c 80 00       	push   $0x804cb2
+  801a55:	e8 25 e7 ff ff       	call   80017f <_panic>
+		assert(r <= PGSIZE);
+  801a5a:	68 c4 4c 80 00       	push   $0x804cc4
+  801a5f:	68 9d 4c 80 00       	push   $0x804c9d
+  801a64:	68 9a 00 00 00       	push   $0x9a
+  801a69:	68 b2 4c 80 00       	push   $0x804cb2
+  801a6e:	e8 0c e7 ff ff       	call   80017f <_panic>
+
+00801a73 <open>:
+{
+  801a73:	55                   	push   %ebp
+  801a74:	89 e5                	mov    %esp,%ebp
+  801a76:	56                   	push   %esi
+  801a77:	53                   	push   %ebx
+  801a78:	83 ec 1c             	sub    $0x1c,%esp
+  801a7b:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801a7e:	56                   	push   %esi
+  801a7f:	e8 7f ed ff ff       	call   800803 <strlen>
+  801a84:	83 c4 10             	add    $0x10,%esp
+  801a87:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801a8c:	0f 8f 85 00 00 00    	jg     801b17 <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  801a92:	83 ec 0c             	sub    $0xc,%esp
+  801a95:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a98:	50                   	push   %eax
+  801a99:	e8 a7 f6 ff ff       	call   801145 <fd_alloc>
+  801a9e:	89 c3                	mov    %eax,%ebx
+  801aa0:	83 c4 10             	add    $0x10,%esp
+  801aa3:	85 c0                	test   %eax,%eax
+  801aa5:	78 55                	js     801afc <open+0x89>
+	mutex_lock(&fsipc_mu);
+  801aa7:	83 ec 0c             	sub    $0xc,%esp
+  801aaa:	68 04 60 80 00       	push   $0x806004
+  801aaf:	e8 28 18 00 00       	call   8032dc <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  801ab4:	83 c4 08             	add    $0x8,%esp
+  801ab7:	56                   	push   %esi
+  801ab8:	68 00 70 c0 00       	push   $0xc07000
+  801abd:	e8 7c ed ff ff       	call   80083e <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801ac2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ac5:	a3 00 74 c0 00       	mov    %eax,0xc07400
+	r = fsipc(FSREQ_OPEN, fd);
+  801aca:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801acd:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ad2:	e8 7e fc ff ff       	call   801755 <fsipc>
+  801ad7:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801ad9:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801ae0:	e8 64 18 00 00       	call   803349 <mutex_unlock>
+	if (r < 0) {
+  801ae5:	83 c4 10             	add    $0x10,%esp
+  801ae8:	85 db                	test   %ebx,%ebx
+  801aea:	78 19                	js     801b05 <open+0x92>
+	return fd2num(fd);
+  801aec:	83 ec 0c             	sub    $0xc,%esp
+  801aef:	ff 75 f4             	push   -0xc(%ebp)
+  801af2:	e8 27 f6 ff ff       	call   80111e <fd2num>
+  801af7:	89 c3                	mov    %eax,%ebx
+  801af9:	83 c4 10             	add    $0x10,%esp
+}
+  801afc:	89 d8                	mov    %ebx,%eax
+  801afe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b01:	5b                   	pop    %ebx
+  801b02:	5e                   	pop    %esi
+  801b03:	5d                   	pop    %ebp
+  801b04:	c3                   	ret
+		fd_close(fd, 0);
+  801b05:	83 ec 08             	sub    $0x8,%esp
+  801b08:	6a 00                	push   $0x0
+  801b0a:	ff 75 f4             	push   -0xc(%ebp)
+  801b0d:	e8 56 f7 ff ff       	call   801268 <fd_close>
+		return r;
+  801b12:	83 c4 10             	add    $0x10,%esp
+  801b15:	eb e5                	jmp    801afc <open+0x89>
+		return -E_BAD_PATH;
+  801b17:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801b1c:	eb de                	jmp    801afc <open+0x89>
+
+00801b1e <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  801b1e:	55                   	push   %ebp
+  801b1f:	89 e5                	mov    %esp,%ebp
+  801b21:	53                   	push   %ebx
+  801b22:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801b25:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b28:	50                   	push   %eax
+  801b29:	ff 75 08             	push   0x8(%ebp)
+  801b2c:	e8 6a f6 ff ff       	call   80119b <fd_lookup>
+  801b31:	89 c3                	mov    %eax,%ebx
+  801b33:	83 c4 10             	add    $0x10,%esp
+  801b36:	85 c0                	test   %eax,%eax
+  801b38:	78 5b                	js     801b95 <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801b3a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b3d:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  801b43:	39 08                	cmp    %ecx,(%eax)
+  801b45:	75 55                	jne    801b9c <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  801b47:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  801b4b:	74 56                	je     801ba3 <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  801b4d:	83 ec 0c             	sub    $0xc,%esp
+  801b50:	68 04 60 80 00       	push   $0x806004
+  801b55:	e8 82 17 00 00       	call   8032dc <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  801b5a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b5d:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b60:	a3 00 70 c0 00       	mov    %eax,0xc07000
+	fsipcbuf.allocate.req_offset = offset;
+  801b65:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b68:	a3 04 70 c0 00       	mov    %eax,0xc07004
+	fsipcbuf.allocate.req_len = len;
+  801b6d:	8b 45 10             	mov    0x10(%ebp),%eax
+  801b70:	a3 08 70 c0 00       	mov    %eax,0xc07008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  801b75:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b7a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801b7f:	e8 d1 fb ff ff       	call   801755 <fsipc>
+  801b84:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801b86:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801b8d:	e8 b7 17 00 00       	call   803349 <mutex_unlock>
+	return r;
+  801b92:	83 c4 10             	add    $0x10,%esp
+}
+  801b95:	89 d8                	mov    %ebx,%eax
+  801b97:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b9a:	c9                   	leave
+  801b9b:	c3                   	ret
+		return -E_NOT_SUPP;
+  801b9c:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801ba1:	eb f2                	jmp    801b95 <fallocate+0x77>
+		return -E_INVAL;
+  801ba3:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801ba8:	eb eb                	jmp    801b95 <fallocate+0x77>
+
+00801baa <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  801baa:	55                   	push   %ebp
+  801bab:	89 e5                	mov    %esp,%ebp
+  801bad:	56                   	push   %esi
+  801bae:	53                   	push   %ebx
+  801baf:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801bb2:	89 f3                	mov    %esi,%ebx
+  801bb4:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801bba:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801bbd:	eb 06                	jmp    801bc5 <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801bbf:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801bc5:	39 f3                	cmp    %esi,%ebx
+  801bc7:	73 14                	jae    801bdd <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  801bc9:	83 ec 08             	sub    $0x8,%esp
+  801bcc:	53                   	push   %ebx
+  801bcd:	6a 00                	push   $0x0
+  801bcf:	e8 41 f1 ff ff       	call   800d15 <sys_page_unmap>
+  801bd4:	83 c4 10             	add    $0x10,%esp
+  801bd7:	85 c0                	test   %eax,%eax
+  801bd9:	79 e4                	jns    801bbf <munmap+0x15>
+  801bdb:	eb 05                	jmp    801be2 <munmap+0x38>
+			return r;
+	return 0;
+  801bdd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801be2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801be5:	5b                   	pop    %ebx
+  801be6:	5e                   	pop    %esi
+  801be7:	5d                   	pop    %ebp
+  801be8:	c3                   	ret
+
+00801be9 <mmap>:
+{
+  801be9:	55                   	push   %ebp
+  801bea:	89 e5                	mov    %esp,%ebp
+  801bec:	57                   	push   %edi
+  801bed:	56                   	push   %esi
+  801bee:	53                   	push   %ebx
+  801bef:	83 ec 24             	sub    $0x24,%esp
+  801bf2:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801bf5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801bf8:	50                   	push   %eax
+  801bf9:	ff 75 08             	push   0x8(%ebp)
+  801bfc:	e8 9a f5 ff ff       	call   80119b <fd_lookup>
+  801c01:	83 c4 10             	add    $0x10,%esp
+  801c04:	85 c0                	test   %eax,%eax
+  801c06:	0f 88 37 01 00 00    	js     801d43 <mmap+0x15a>
+		return NULL;
+  801c0c:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801c11:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801c14:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  801c1a:	39 0a                	cmp    %ecx,(%edx)
+  801c1c:	0f 85 05 01 00 00    	jne    801d27 <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  801c22:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801c29:	0f 85 1b 01 00 00    	jne    801d4a <mmap+0x161>
+  801c2f:	89 f0                	mov    %esi,%eax
+  801c31:	83 e8 01             	sub    $0x1,%eax
+  801c34:	0f 88 17 01 00 00    	js     801d51 <mmap+0x168>
+	if (prot & PROT_WRITE)
+  801c3a:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  801c3e:	75 28                	jne    801c68 <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  801c40:	83 ec 0c             	sub    $0xc,%esp
+  801c43:	68 04 60 80 00       	push   $0x806004
+  801c48:	e8 8f 16 00 00       	call   8032dc <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801c4d:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  801c53:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  801c59:	83 c4 10             	add    $0x10,%esp
+  801c5c:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  801c61:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  801c66:	eb 2b                	jmp    801c93 <mmap+0xaa>
+		cow_enable();
+  801c68:	e8 f4 21 00 00       	call   803e61 <cow_enable>
+  801c6d:	eb d1                	jmp    801c40 <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  801c6f:	89 c2                	mov    %eax,%edx
+  801c71:	c1 ea 0c             	shr    $0xc,%edx
+  801c74:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  801c7b:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801c81:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  801c87:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  801c8a:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  801c8c:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  801c91:	77 25                	ja     801cb8 <mmap+0xcf>
+  801c93:	89 c2                	mov    %eax,%edx
+  801c95:	29 da                	sub    %ebx,%edx
+  801c97:	39 ca                	cmp    %ecx,%edx
+  801c99:	73 3a                	jae    801cd5 <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  801c9b:	89 c2                	mov    %eax,%edx
+  801c9d:	c1 ea 16             	shr    $0x16,%edx
+  801ca0:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801ca7:	f6 c2 01             	test   $0x1,%dl
+  801caa:	75 c3                	jne    801c6f <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  801cac:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  801cb1:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  801cb6:	eb d4                	jmp    801c8c <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  801cb8:	29 d8                	sub    %ebx,%eax
+  801cba:	39 c8                	cmp    %ecx,%eax
+  801cbc:	73 17                	jae    801cd5 <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  801cbe:	83 ec 0c             	sub    $0xc,%esp
+  801cc1:	68 04 60 80 00       	push   $0x806004
+  801cc6:	e8 7e 16 00 00       	call   803349 <mutex_unlock>
+		return NULL;
+  801ccb:	83 c4 10             	add    $0x10,%esp
+  801cce:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cd3:	eb 52                	jmp    801d27 <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801cd5:	85 db                	test   %ebx,%ebx
+  801cd7:	74 e5                	je     801cbe <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801cd9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801cdc:	8b 40 0c             	mov    0xc(%eax),%eax
+  801cdf:	a3 00 70 c0 00       	mov    %eax,0xc07000
+	fsipcbuf.map.req_offset = offset;
+  801ce4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ce7:	a3 04 70 c0 00       	mov    %eax,0xc07004
+	fsipcbuf.map.req_len = len;
+  801cec:	89 35 08 70 c0 00    	mov    %esi,0xc07008
+	fsipcbuf.map.req_va = va;
+  801cf2:	89 1d 0c 70 c0 00    	mov    %ebx,0xc0700c
+	fsipcbuf.map.req_prot = prot;
+  801cf8:	8b 45 14             	mov    0x14(%ebp),%eax
+  801cfb:	a3 10 70 c0 00       	mov    %eax,0xc07010
+	r = fsipc(FSREQ_MAP, NULL);
+  801d00:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d05:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801d0a:	e8 46 fa ff ff       	call   801755 <fsipc>
+  801d0f:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  801d11:	83 ec 0c             	sub    $0xc,%esp
+  801d14:	68 04 60 80 00       	push   $0x806004
+  801d19:	e8 2b 16 00 00       	call   803349 <mutex_unlock>
+	if (r < 0) {
+  801d1e:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  801d21:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  801d23:	85 ff                	test   %edi,%edi
+  801d25:	78 08                	js     801d2f <mmap+0x146>
+}
+  801d27:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d2a:	5b                   	pop    %ebx
+  801d2b:	5e                   	pop    %esi
+  801d2c:	5f                   	pop    %edi
+  801d2d:	5d                   	pop    %ebp
+  801d2e:	c3                   	ret
+		munmap((void*) va, len);
+  801d2f:	83 ec 08             	sub    $0x8,%esp
+  801d32:	56                   	push   %esi
+  801d33:	53                   	push   %ebx
+  801d34:	e8 71 fe ff ff       	call   801baa <munmap>
+		return NULL;
+  801d39:	83 c4 10             	add    $0x10,%esp
+  801d3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d41:	eb e4                	jmp    801d27 <mmap+0x13e>
+		return NULL;
+  801d43:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d48:	eb dd                	jmp    801d27 <mmap+0x13e>
+		return NULL;
+  801d4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d4f:	eb d6                	jmp    801d27 <mmap+0x13e>
+  801d51:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d56:	eb cf                	jmp    801d27 <mmap+0x13e>
+
+00801d58 <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  801d58:	55                   	push   %ebp
+  801d59:	89 e5                	mov    %esp,%ebp
+  801d5b:	53                   	push   %ebx
+  801d5c:	83 ec 10             	sub    $0x10,%esp
+  801d5f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  801d62:	53                   	push   %ebx
+  801d63:	e8 9b ea ff ff       	call   800803 <strlen>
+  801d68:	83 c4 10             	add    $0x10,%esp
+  801d6b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801d70:	7f 42                	jg     801db4 <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  801d72:	83 ec 0c             	sub    $0xc,%esp
+  801d75:	68 04 60 80 00       	push   $0x806004
+  801d7a:	e8 5d 15 00 00       	call   8032dc <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  801d7f:	83 c4 08             	add    $0x8,%esp
+  801d82:	53                   	push   %ebx
+  801d83:	68 00 70 c0 00       	push   $0xc07000
+  801d88:	e8 b1 ea ff ff       	call   80083e <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  801d8d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d92:	b8 07 00 00 00       	mov    $0x7,%eax
+  801d97:	e8 b9 f9 ff ff       	call   801755 <fsipc>
+  801d9c:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801d9e:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801da5:	e8 9f 15 00 00       	call   803349 <mutex_unlock>
+	return r;
+  801daa:	83 c4 10             	add    $0x10,%esp
+}
+  801dad:	89 d8                	mov    %ebx,%eax
+  801daf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801db2:	c9                   	leave
+  801db3:	c3                   	ret
+		return -E_BAD_PATH;
+  801db4:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801db9:	eb f2                	jmp    801dad <remove+0x55>
+
+00801dbb <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801dbb:	55                   	push   %ebp
+  801dbc:	89 e5                	mov    %esp,%ebp
+  801dbe:	53                   	push   %ebx
+  801dbf:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801dc2:	68 04 60 80 00       	push   $0x806004
+  801dc7:	e8 10 15 00 00       	call   8032dc <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  801dcc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dd1:	b8 08 00 00 00       	mov    $0x8,%eax
+  801dd6:	e8 7a f9 ff ff       	call   801755 <fsipc>
+  801ddb:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801ddd:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801de4:	e8 60 15 00 00       	call   803349 <mutex_unlock>
+	return r;
+}
+  801de9:	89 d8                	mov    %ebx,%eax
+  801deb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801dee:	c9                   	leave
+  801def:	c3                   	ret
+
+00801df0 <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  801df0:	55                   	push   %ebp
+  801df1:	89 e5                	mov    %esp,%ebp
+  801df3:	56                   	push   %esi
+  801df4:	53                   	push   %ebx
+  801df5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801df8:	83 ec 0c             	sub    $0xc,%esp
+  801dfb:	68 04 60 80 00       	push   $0x806004
+  801e00:	e8 d7 14 00 00       	call   8032dc <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  801e05:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e08:	a3 00 70 c0 00       	mov    %eax,0xc07000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  801e0d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e12:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801e17:	e8 39 f9 ff ff       	call   801755 <fsipc>
+  801e1c:	89 c6                	mov    %eax,%esi
+  801e1e:	83 c4 10             	add    $0x10,%esp
+  801e21:	85 db                	test   %ebx,%ebx
+  801e23:	74 7b                	je     801ea0 <fs_bcstat+0xb0>
+  801e25:	85 c0                	test   %eax,%eax
+  801e27:	78 77                	js     801ea0 <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  801e29:	a1 00 70 c0 00       	mov    0xc07000,%eax
+  801e2e:	89 03                	mov    %eax,(%ebx)
+  801e30:	a1 04 70 c0 00       	mov    0xc07004,%eax
+  801e35:	89 43 04             	mov    %eax,0x4(%ebx)
+  801e38:	a1 08 70 c0 00       	mov    0xc07008,%eax
+  801e3d:	89 43 08             	mov    %eax,0x8(%ebx)
+  801e40:	a1 0c 70 c0 00       	mov    0xc0700c,%eax
+  801e45:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801e48:	a1 10 70 c0 00       	mov    0xc07010,%eax
+  801e4d:	89 43 10             	mov    %eax,0x10(%ebx)
+  801e50:	a1 14 70 c0 00       	mov    0xc07014,%eax
+  801e55:	89 43 14             	mov    %eax,0x14(%ebx)
+  801e58:	a1 18 70 c0 00       	mov    0xc07018,%eax
+  801e5d:	89 43 18             	mov    %eax,0x18(%ebx)
+  801e60:	a1 1c 70 c0 00       	mov    0xc0701c,%eax
+  801e65:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  801e68:	a1 20 70 c0 00       	mov    0xc07020,%eax
+  801e6d:	89 43 20             	mov    %eax,0x20(%ebx)
+  801e70:	a1 24 70 c0 00       	mov    0xc07024,%eax
+  801e75:	89 43 24             	mov    %eax,0x24(%ebx)
+  801e78:	a1 28 70 c0 00       	mov    0xc07028,%eax
+  801e7d:	89 43 28             	mov    %eax,0x28(%ebx)
+  801e80:	a1 2c 70 c0 00       	mov    0xc0702c,%eax
+  801e85:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  801e88:	a1 30 70 c0 00       	mov    0xc07030,%eax
+  801e8d:	89 43 30             	mov    %eax,0x30(%ebx)
+  801e90:	a1 34 70 c0 00       	mov    0xc07034,%eax
+  801e95:	89 43 34             	mov    %eax,0x34(%ebx)
+  801e98:	a1 38 70 c0 00       	mov    0xc07038,%eax
+  801e9d:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  801ea0:	83 ec 0c             	sub    $0xc,%esp
+  801ea3:	68 04 60 80 00       	push   $0x806004
+  801ea8:	e8 9c 14 00 00       	call   803349 <mutex_unlock>
+	return r;
+}
+  801ead:	89 f0                	mov    %esi,%eax
+  801eaf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801eb2:	5b                   	pop    %ebx
+  801eb3:	5e                   	pop    %esi
+  801eb4:	5d                   	pop    %ebp
+  801eb5:	c3                   	ret
+
+00801eb6 <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  801eb6:	55                   	push   %ebp
+  801eb7:	89 e5                	mov    %esp,%ebp
+  801eb9:	56                   	push   %esi
+  801eba:	53                   	push   %ebx
+  801ebb:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  801ebd:	0f b6 10             	movzbl (%eax),%edx
+  801ec0:	80 fa 72             	cmp    $0x72,%dl
+  801ec3:	74 44                	je     801f09 <parse_mode+0x53>
+  801ec5:	80 fa 77             	cmp    $0x77,%dl
+  801ec8:	74 4b                	je     801f15 <parse_mode+0x5f>
+  801eca:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801ecf:	80 fa 61             	cmp    $0x61,%dl
+  801ed2:	74 09                	je     801edd <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  801ed4:	89 d8                	mov    %ebx,%eax
+  801ed6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ed9:	5b                   	pop    %ebx
+  801eda:	5e                   	pop    %esi
+  801edb:	5d                   	pop    %ebp
+  801edc:	c3                   	ret
+	switch (mode[0]) {
+  801edd:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  801ee2:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  801ee7:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  801ee9:	83 ec 08             	sub    $0x8,%esp
+  801eec:	6a 2b                	push   $0x2b
+  801eee:	50                   	push   %eax
+  801eef:	e8 5c ea ff ff       	call   800950 <strchr>
+  801ef4:	83 c4 10             	add    $0x10,%esp
+  801ef7:	85 c0                	test   %eax,%eax
+  801ef9:	74 d9                	je     801ed4 <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  801efb:	83 e3 fc             	and    $0xfffffffc,%ebx
+  801efe:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  801f01:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  801f07:	eb cb                	jmp    801ed4 <parse_mode+0x1e>
+	switch (mode[0]) {
+  801f09:	ba 01 00 00 00       	mov    $0x1,%edx
+  801f0e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f13:	eb d2                	jmp    801ee7 <parse_mode+0x31>
+  801f15:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  801f1a:	bb 01 03 00 00       	mov    $0x301,%ebx
+  801f1f:	eb c6                	jmp    801ee7 <parse_mode+0x31>
+
+00801f21 <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  801f21:	55                   	push   %ebp
+  801f22:	89 e5                	mov    %esp,%ebp
+  801f24:	57                   	push   %edi
+  801f25:	56                   	push   %esi
+  801f26:	53                   	push   %ebx
+  801f27:	83 ec 1c             	sub    $0x1c,%esp
+  801f2a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801f2d:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  801f30:	b8 24 50 80 00       	mov    $0x805024,%eax
+  801f35:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  801f3a:	83 c0 24             	add    $0x24,%eax
+  801f3d:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  801f41:	74 17                	je     801f5a <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  801f43:	83 c3 01             	add    $0x1,%ebx
+  801f46:	83 fb 10             	cmp    $0x10,%ebx
+  801f49:	75 ef                	jne    801f3a <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  801f4b:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  801f50:	89 f0                	mov    %esi,%eax
+  801f52:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f55:	5b                   	pop    %ebx
+  801f56:	5e                   	pop    %esi
+  801f57:	5f                   	pop    %edi
+  801f58:	5d                   	pop    %ebp
+  801f59:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  801f5a:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  801f61:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801f64:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  801f67:	c1 e7 02             	shl    $0x2,%edi
+  801f6a:	8d b7 20 50 80 00    	lea    0x805020(%edi),%esi
+  801f70:	83 ec 04             	sub    $0x4,%esp
+  801f73:	6a 24                	push   $0x24
+  801f75:	6a 00                	push   $0x0
+  801f77:	56                   	push   %esi
+  801f78:	e8 12 ea ff ff       	call   80098f <memset>
+			streams[i].f_fd = fd;
+  801f7d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801f80:	89 8f 20 50 80 00    	mov    %ecx,0x805020(%edi)
+			streams[i].f_flags = flags;
+  801f86:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  801f89:	01 d8                	add    %ebx,%eax
+  801f8b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801f8e:	89 0c 85 24 50 80 00 	mov    %ecx,0x805024(,%eax,4)
+			return &streams[i];
+  801f95:	83 c4 10             	add    $0x10,%esp
+  801f98:	eb b6                	jmp    801f50 <stream_alloc+0x2f>
+
+00801f9a <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  801f9a:	55                   	push   %ebp
+  801f9b:	89 e5                	mov    %esp,%ebp
+  801f9d:	53                   	push   %ebx
+  801f9e:	83 ec 14             	sub    $0x14,%esp
+  801fa1:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  801fa3:	8b 40 18             	mov    0x18(%eax),%eax
+  801fa6:	39 43 14             	cmp    %eax,0x14(%ebx)
+  801fa9:	74 4a                	je     801ff5 <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801fab:	83 ec 08             	sub    $0x8,%esp
+  801fae:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fb1:	50                   	push   %eax
+  801fb2:	ff 33                	push   (%ebx)
+  801fb4:	e8 e2 f1 ff ff       	call   80119b <fd_lookup>
+  801fb9:	89 c2                	mov    %eax,%edx
+  801fbb:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801fbe:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801fc3:	85 d2                	test   %edx,%edx
+  801fc5:	78 41                	js     802008 <stream_unread+0x6e>
+  801fc7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801fca:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  801fd0:	39 0a                	cmp    %ecx,(%edx)
+  801fd2:	75 34                	jne    802008 <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  801fd4:	8b 43 14             	mov    0x14(%ebx),%eax
+  801fd7:	03 42 04             	add    0x4(%edx),%eax
+  801fda:	2b 43 18             	sub    0x18(%ebx),%eax
+  801fdd:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  801fe0:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  801fe7:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  801fee:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ff3:	eb 13                	jmp    802008 <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  801ff5:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  801ffc:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  802003:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802008:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80200b:	c9                   	leave
+  80200c:	c3                   	ret
+
+0080200d <stream_drain>:
+{
+  80200d:	55                   	push   %ebp
+  80200e:	89 e5                	mov    %esp,%ebp
+  802010:	56                   	push   %esi
+  802011:	53                   	push   %ebx
+  802012:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  802014:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802019:	eb 02                	jmp    80201d <stream_drain+0x10>
+  80201b:	01 c3                	add    %eax,%ebx
+  80201d:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802020:	39 c3                	cmp    %eax,%ebx
+  802022:	73 43                	jae    802067 <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  802024:	83 ec 04             	sub    $0x4,%esp
+  802027:	29 d8                	sub    %ebx,%eax
+  802029:	50                   	push   %eax
+  80202a:	89 d8                	mov    %ebx,%eax
+  80202c:	03 46 0c             	add    0xc(%esi),%eax
+  80202f:	50                   	push   %eax
+  802030:	ff 36                	push   (%esi)
+  802032:	e8 ec f4 ff ff       	call   801523 <write>
+  802037:	83 c4 10             	add    $0x10,%esp
+  80203a:	85 c0                	test   %eax,%eax
+  80203c:	7f dd                	jg     80201b <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  80203e:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  802042:	8b 56 0c             	mov    0xc(%esi),%edx
+  802045:	83 ec 04             	sub    $0x4,%esp
+  802048:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80204b:	29 d8                	sub    %ebx,%eax
+  80204d:	50                   	push   %eax
+  80204e:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  802051:	50                   	push   %eax
+  802052:	52                   	push   %edx
+  802053:	e8 6c e9 ff ff       	call   8009c4 <memmove>
+			f->f_wend -= done;
+  802058:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80205b:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  80205d:	83 c4 10             	add    $0x10,%esp
+  802060:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  802065:	eb 0a                	jmp    802071 <stream_drain+0x64>
+  802067:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  80206c:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  802071:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  802074:	89 d0                	mov    %edx,%eax
+  802076:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802079:	5b                   	pop    %ebx
+  80207a:	5e                   	pop    %esi
+  80207b:	5d                   	pop    %ebp
+  80207c:	c3                   	ret
+
+0080207d <stream_setup>:
+	if (f->f_buf)
+  80207d:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802081:	74 01                	je     802084 <stream_setup+0x7>
+  802083:	c3                   	ret
+{
+  802084:	55                   	push   %ebp
+  802085:	89 e5                	mov    %esp,%ebp
+  802087:	53                   	push   %ebx
+  802088:	83 ec 04             	sub    $0x4,%esp
+  80208b:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  80208d:	8b 40 08             	mov    0x8(%eax),%eax
+  802090:	85 c0                	test   %eax,%eax
+  802092:	74 17                	je     8020ab <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  802094:	83 f8 03             	cmp    $0x3,%eax
+  802097:	75 2d                	jne    8020c6 <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  802099:	8d 43 20             	lea    0x20(%ebx),%eax
+  80209c:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  80209f:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  8020a6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020a9:	c9                   	leave
+  8020aa:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  8020ab:	83 ec 0c             	sub    $0xc,%esp
+  8020ae:	ff 33                	push   (%ebx)
+  8020b0:	e8 29 1b 00 00       	call   803bde <iscons>
+  8020b5:	83 c4 10             	add    $0x10,%esp
+  8020b8:	85 c0                	test   %eax,%eax
+  8020ba:	0f 9f c0             	setg   %al
+  8020bd:	0f b6 c0             	movzbl %al,%eax
+  8020c0:	83 c0 01             	add    $0x1,%eax
+  8020c3:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  8020c6:	83 ec 0c             	sub    $0xc,%esp
+  8020c9:	68 00 10 00 00       	push   $0x1000
+  8020ce:	e8 6e 0b 00 00       	call   802c41 <malloc>
+  8020d3:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8020d6:	83 c4 10             	add    $0x10,%esp
+  8020d9:	85 c0                	test   %eax,%eax
+  8020db:	74 bc                	je     802099 <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  8020dd:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  8020e4:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  8020e8:	eb bc                	jmp    8020a6 <stream_setup+0x29>
+
+008020ea <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  8020ea:	55                   	push   %ebp
+  8020eb:	89 e5                	mov    %esp,%ebp
+  8020ed:	53                   	push   %ebx
+  8020ee:	83 ec 04             	sub    $0x4,%esp
+  8020f1:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  8020f3:	e8 85 ff ff ff       	call   80207d <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  8020f8:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  8020fd:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  802101:	74 3d                	je     802140 <stream_fill+0x56>
+  802103:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  802107:	74 10                	je     802119 <stream_fill+0x2f>
+  802109:	89 d8                	mov    %ebx,%eax
+  80210b:	e8 fd fe ff ff       	call   80200d <stream_drain>
+		return 0;
+  802110:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  802115:	85 c0                	test   %eax,%eax
+  802117:	78 27                	js     802140 <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  802119:	83 ec 04             	sub    $0x4,%esp
+  80211c:	ff 73 10             	push   0x10(%ebx)
+  80211f:	ff 73 0c             	push   0xc(%ebx)
+  802122:	ff 33                	push   (%ebx)
+  802124:	e8 02 f3 ff ff       	call   80142b <read>
+  802129:	83 c4 10             	add    $0x10,%esp
+  80212c:	85 c0                	test   %eax,%eax
+  80212e:	7e 17                	jle    802147 <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  802130:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  802134:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  80213b:	89 c2                	mov    %eax,%edx
+  80213d:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  802140:	89 d0                	mov    %edx,%eax
+  802142:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802145:	c9                   	leave
+  802146:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802147:	c1 f8 1f             	sar    $0x1f,%eax
+  80214a:	83 e0 04             	and    $0x4,%eax
+  80214d:	83 c0 04             	add    $0x4,%eax
+  802150:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  802153:	ba 00 00 00 00       	mov    $0x0,%edx
+  802158:	eb e6                	jmp    802140 <stream_fill+0x56>
+
+0080215a <fopen>:
+{
+  80215a:	55                   	push   %ebp
+  80215b:	89 e5                	mov    %esp,%ebp
+  80215d:	57                   	push   %edi
+  80215e:	56                   	push   %esi
+  80215f:	53                   	push   %ebx
+  802160:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  802166:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  802169:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  80216f:	89 f0                	mov    %esi,%eax
+  802171:	e8 40 fd ff ff       	call   801eb6 <parse_mode>
+		return 0;
+  802176:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  80217b:	85 c0                	test   %eax,%eax
+  80217d:	78 2d                	js     8021ac <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  80217f:	83 ec 08             	sub    $0x8,%esp
+  802182:	50                   	push   %eax
+  802183:	ff 75 08             	push   0x8(%ebp)
+  802186:	e8 e8 f8 ff ff       	call   801a73 <open>
+  80218b:	89 c7                	mov    %eax,%edi
+  80218d:	83 c4 10             	add    $0x10,%esp
+  802190:	85 c0                	test   %eax,%eax
+  802192:	78 58                	js     8021ec <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  802194:	80 3e 61             	cmpb   $0x61,(%esi)
+  802197:	74 1d                	je     8021b6 <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  802199:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  80219f:	89 f8                	mov    %edi,%eax
+  8021a1:	e8 7b fd ff ff       	call   801f21 <stream_alloc>
+  8021a6:	89 c3                	mov    %eax,%ebx
+  8021a8:	85 c0                	test   %eax,%eax
+  8021aa:	74 32                	je     8021de <fopen+0x84>
+}
+  8021ac:	89 d8                	mov    %ebx,%eax
+  8021ae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021b1:	5b                   	pop    %ebx
+  8021b2:	5e                   	pop    %esi
+  8021b3:	5f                   	pop    %edi
+  8021b4:	5d                   	pop    %ebp
+  8021b5:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  8021b6:	83 ec 08             	sub    $0x8,%esp
+  8021b9:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  8021bf:	50                   	push   %eax
+  8021c0:	57                   	push   %edi
+  8021c1:	e8 db f4 ff ff       	call   8016a1 <fstat>
+  8021c6:	83 c4 10             	add    $0x10,%esp
+  8021c9:	85 c0                	test   %eax,%eax
+  8021cb:	78 cc                	js     802199 <fopen+0x3f>
+		seek(fd, st.st_size);
+  8021cd:	83 ec 08             	sub    $0x8,%esp
+  8021d0:	ff 75 dc             	push   -0x24(%ebp)
+  8021d3:	57                   	push   %edi
+  8021d4:	e8 f6 f3 ff ff       	call   8015cf <seek>
+  8021d9:	83 c4 10             	add    $0x10,%esp
+  8021dc:	eb bb                	jmp    802199 <fopen+0x3f>
+		close(fd);
+  8021de:	83 ec 0c             	sub    $0xc,%esp
+  8021e1:	57                   	push   %edi
+  8021e2:	e8 08 f1 ff ff       	call   8012ef <close>
+  8021e7:	83 c4 10             	add    $0x10,%esp
+  8021ea:	eb c0                	jmp    8021ac <fopen+0x52>
+		return 0;
+  8021ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8021f1:	eb b9                	jmp    8021ac <fopen+0x52>
+
+008021f3 <fdopen>:
+{
+  8021f3:	55                   	push   %ebp
+  8021f4:	89 e5                	mov    %esp,%ebp
+  8021f6:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  8021f9:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8021fc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021ff:	e8 b2 fc ff ff       	call   801eb6 <parse_mode>
+  802204:	89 c2                	mov    %eax,%edx
+		return 0;
+  802206:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  80220b:	85 d2                	test   %edx,%edx
+  80220d:	78 0b                	js     80221a <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  80220f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802212:	8b 45 08             	mov    0x8(%ebp),%eax
+  802215:	e8 07 fd ff ff       	call   801f21 <stream_alloc>
+}
+  80221a:	c9                   	leave
+  80221b:	c3                   	ret
+
+0080221c <setvbuf>:
+{
+  80221c:	55                   	push   %ebp
+  80221d:	89 e5                	mov    %esp,%ebp
+  80221f:	57                   	push   %edi
+  802220:	56                   	push   %esi
+  802221:	53                   	push   %ebx
+  802222:	8b 45 08             	mov    0x8(%ebp),%eax
+  802225:	8b 55 10             	mov    0x10(%ebp),%edx
+  802228:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  80222b:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  80222f:	75 3a                	jne    80226b <setvbuf+0x4f>
+  802231:	8d 72 ff             	lea    -0x1(%edx),%esi
+  802234:	83 fe 02             	cmp    $0x2,%esi
+  802237:	77 39                	ja     802272 <setvbuf+0x56>
+	f->f_bufmode = mode;
+  802239:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  80223c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802240:	0f 95 c3             	setne  %bl
+  802243:	85 ff                	test   %edi,%edi
+  802245:	0f 95 c1             	setne  %cl
+  802248:	84 cb                	test   %cl,%bl
+  80224a:	74 05                	je     802251 <setvbuf+0x35>
+  80224c:	83 fa 03             	cmp    $0x3,%edx
+  80224f:	75 0a                	jne    80225b <setvbuf+0x3f>
+	return 0;
+  802251:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802256:	5b                   	pop    %ebx
+  802257:	5e                   	pop    %esi
+  802258:	5f                   	pop    %edi
+  802259:	5d                   	pop    %ebp
+  80225a:	c3                   	ret
+		f->f_buf = buf;
+  80225b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80225e:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  802261:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  802264:	b8 00 00 00 00       	mov    $0x0,%eax
+  802269:	eb eb                	jmp    802256 <setvbuf+0x3a>
+		return EOF;
+  80226b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802270:	eb e4                	jmp    802256 <setvbuf+0x3a>
+  802272:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802277:	eb dd                	jmp    802256 <setvbuf+0x3a>
+
+00802279 <fflush>:
+{
+  802279:	55                   	push   %ebp
+  80227a:	89 e5                	mov    %esp,%ebp
+  80227c:	57                   	push   %edi
+  80227d:	56                   	push   %esi
+  80227e:	53                   	push   %ebx
+  80227f:	83 ec 0c             	sub    $0xc,%esp
+  802282:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  802285:	85 db                	test   %ebx,%ebx
+  802287:	74 1a                	je     8022a3 <fflush+0x2a>
+	stream_unread(f);
+  802289:	89 d8                	mov    %ebx,%eax
+  80228b:	e8 0a fd ff ff       	call   801f9a <stream_unread>
+	return stream_drain(f);
+  802290:	89 d8                	mov    %ebx,%eax
+  802292:	e8 76 fd ff ff       	call   80200d <stream_drain>
+  802297:	89 c7                	mov    %eax,%edi
+}
+  802299:	89 f8                	mov    %edi,%eax
+  80229b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80229e:	5b                   	pop    %ebx
+  80229f:	5e                   	pop    %esi
+  8022a0:	5f                   	pop    %edi
+  8022a1:	5d                   	pop    %ebp
+  8022a2:	c3                   	ret
+  8022a3:	bb 20 50 80 00       	mov    $0x805020,%ebx
+  8022a8:	be 60 52 80 00       	mov    $0x805260,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  8022ad:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022b2:	eb 03                	jmp    8022b7 <fflush+0x3e>
+  8022b4:	83 c3 24             	add    $0x24,%ebx
+  8022b7:	39 f3                	cmp    %esi,%ebx
+  8022b9:	74 de                	je     802299 <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  8022bb:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  8022bf:	74 f3                	je     8022b4 <fflush+0x3b>
+  8022c1:	83 ec 0c             	sub    $0xc,%esp
+  8022c4:	53                   	push   %ebx
+  8022c5:	e8 af ff ff ff       	call   802279 <fflush>
+  8022ca:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  8022cd:	85 c0                	test   %eax,%eax
+  8022cf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8022d4:	0f 48 f8             	cmovs  %eax,%edi
+  8022d7:	eb db                	jmp    8022b4 <fflush+0x3b>
+
+008022d9 <fclose>:
+{
+  8022d9:	55                   	push   %ebp
+  8022da:	89 e5                	mov    %esp,%ebp
+  8022dc:	56                   	push   %esi
+  8022dd:	53                   	push   %ebx
+  8022de:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  8022e1:	83 ec 0c             	sub    $0xc,%esp
+  8022e4:	56                   	push   %esi
+  8022e5:	e8 8f ff ff ff       	call   802279 <fflush>
+  8022ea:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  8022ec:	83 c4 04             	add    $0x4,%esp
+  8022ef:	ff 36                	push   (%esi)
+  8022f1:	e8 f9 ef ff ff       	call   8012ef <close>
+  8022f6:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  8022f9:	85 c0                	test   %eax,%eax
+  8022fb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802300:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  802303:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  802307:	75 10                	jne    802319 <fclose+0x40>
+	f->f_flags = 0;
+  802309:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  802310:	89 d8                	mov    %ebx,%eax
+  802312:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802315:	5b                   	pop    %ebx
+  802316:	5e                   	pop    %esi
+  802317:	5d                   	pop    %ebp
+  802318:	c3                   	ret
+		free(f->f_buf);
+  802319:	83 ec 0c             	sub    $0xc,%esp
+  80231c:	ff 76 0c             	push   0xc(%esi)
+  80231f:	e8 54 08 00 00       	call   802b78 <free>
+  802324:	83 c4 10             	add    $0x10,%esp
+  802327:	eb e0                	jmp    802309 <fclose+0x30>
+
+00802329 <fileno>:
+{
+  802329:	55                   	push   %ebp
+  80232a:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  80232c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80232f:	8b 00                	mov    (%eax),%eax
+}
+  802331:	5d                   	pop    %ebp
+  802332:	c3                   	ret
+
+00802333 <feof>:
+{
+  802333:	55                   	push   %ebp
+  802334:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  802336:	8b 45 08             	mov    0x8(%ebp),%eax
+  802339:	8b 40 04             	mov    0x4(%eax),%eax
+  80233c:	c1 e8 02             	shr    $0x2,%eax
+  80233f:	83 e0 01             	and    $0x1,%eax
+}
+  802342:	5d                   	pop    %ebp
+  802343:	c3                   	ret
+
+00802344 <ferror>:
+{
+  802344:	55                   	push   %ebp
+  802345:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  802347:	8b 45 08             	mov    0x8(%ebp),%eax
+  80234a:	8b 40 04             	mov    0x4(%eax),%eax
+  80234d:	c1 e8 03             	shr    $0x3,%eax
+  802350:	83 e0 01             	and    $0x1,%eax
+}
+  802353:	5d                   	pop    %ebp
+  802354:	c3                   	ret
+
+00802355 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  802355:	55                   	push   %ebp
+  802356:	89 e5                	mov    %esp,%ebp
+  802358:	53                   	push   %ebx
+  802359:	83 ec 04             	sub    $0x4,%esp
+  80235c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  80235f:	8b 43 18             	mov    0x18(%ebx),%eax
+  802362:	39 43 14             	cmp    %eax,0x14(%ebx)
+  802365:	74 15                	je     80237c <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  802367:	8b 53 0c             	mov    0xc(%ebx),%edx
+  80236a:	8b 43 14             	mov    0x14(%ebx),%eax
+  80236d:	8d 48 01             	lea    0x1(%eax),%ecx
+  802370:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  802373:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  802377:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80237a:	c9                   	leave
+  80237b:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  80237c:	89 d8                	mov    %ebx,%eax
+  80237e:	e8 67 fd ff ff       	call   8020ea <stream_fill>
+  802383:	85 c0                	test   %eax,%eax
+  802385:	75 e0                	jne    802367 <fgetc+0x12>
+		return EOF;
+  802387:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80238c:	eb e9                	jmp    802377 <fgetc+0x22>
+
+0080238e <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  80238e:	55                   	push   %ebp
+  80238f:	89 e5                	mov    %esp,%ebp
+  802391:	57                   	push   %edi
+  802392:	56                   	push   %esi
+  802393:	53                   	push   %ebx
+  802394:	83 ec 1c             	sub    $0x1c,%esp
+  802397:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  80239a:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  80239f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023a2:	83 e8 01             	sub    $0x1,%eax
+  8023a5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  8023a8:	eb 66                	jmp    802410 <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  8023aa:	8b 46 14             	mov    0x14(%esi),%eax
+  8023ad:	8b 5e 18             	mov    0x18(%esi),%ebx
+  8023b0:	29 c3                	sub    %eax,%ebx
+  8023b2:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8023b5:	29 fa                	sub    %edi,%edx
+  8023b7:	39 d3                	cmp    %edx,%ebx
+  8023b9:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  8023bc:	83 ec 04             	sub    $0x4,%esp
+  8023bf:	53                   	push   %ebx
+  8023c0:	6a 0a                	push   $0xa
+  8023c2:	03 46 0c             	add    0xc(%esi),%eax
+  8023c5:	50                   	push   %eax
+  8023c6:	e8 aa e6 ff ff       	call   800a75 <memfind>
+  8023cb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  8023ce:	8b 46 0c             	mov    0xc(%esi),%eax
+  8023d1:	8b 4e 14             	mov    0x14(%esi),%ecx
+  8023d4:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  8023d7:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  8023d9:	83 c4 10             	add    $0x10,%esp
+  8023dc:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  8023df:	74 0b                	je     8023ec <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  8023e1:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8023e4:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8023e7:	29 d3                	sub    %edx,%ebx
+  8023e9:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  8023ec:	83 ec 04             	sub    $0x4,%esp
+  8023ef:	53                   	push   %ebx
+  8023f0:	01 c8                	add    %ecx,%eax
+  8023f2:	50                   	push   %eax
+  8023f3:	89 f8                	mov    %edi,%eax
+  8023f5:	03 45 08             	add    0x8(%ebp),%eax
+  8023f8:	50                   	push   %eax
+  8023f9:	e8 c6 e5 ff ff       	call   8009c4 <memmove>
+		f->f_rpos += m;
+  8023fe:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  802401:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  802403:	83 c4 10             	add    $0x10,%esp
+  802406:	8b 45 08             	mov    0x8(%ebp),%eax
+  802409:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  80240e:	74 1f                	je     80242f <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  802410:	8d 47 01             	lea    0x1(%edi),%eax
+  802413:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  802416:	73 17                	jae    80242f <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802418:	8b 46 18             	mov    0x18(%esi),%eax
+  80241b:	39 46 14             	cmp    %eax,0x14(%esi)
+  80241e:	75 8a                	jne    8023aa <fgets+0x1c>
+  802420:	89 f0                	mov    %esi,%eax
+  802422:	e8 c3 fc ff ff       	call   8020ea <stream_fill>
+  802427:	85 c0                	test   %eax,%eax
+  802429:	0f 85 7b ff ff ff    	jne    8023aa <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  80242f:	85 ff                	test   %edi,%edi
+  802431:	74 0f                	je     802442 <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  802433:	8b 45 08             	mov    0x8(%ebp),%eax
+  802436:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  80243a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80243d:	5b                   	pop    %ebx
+  80243e:	5e                   	pop    %esi
+  80243f:	5f                   	pop    %edi
+  802440:	5d                   	pop    %ebp
+  802441:	c3                   	ret
+		return 0;
+  802442:	b8 00 00 00 00       	mov    $0x0,%eax
+  802447:	eb f1                	jmp    80243a <fgets+0xac>
+
+00802449 <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  802449:	55                   	push   %ebp
+  80244a:	89 e5                	mov    %esp,%ebp
+  80244c:	57                   	push   %edi
+  80244d:	56                   	push   %esi
+  80244e:	53                   	push   %ebx
+  80244f:	83 ec 1c             	sub    $0x1c,%esp
+  802452:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  802455:	89 f0                	mov    %esi,%eax
+  802457:	e8 21 fc ff ff       	call   80207d <stream_setup>
+	want = size * n;
+  80245c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80245f:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802463:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  802466:	bf 00 00 00 00       	mov    $0x0,%edi
+  80246b:	eb 43                	jmp    8024b0 <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  80246d:	29 d3                	sub    %edx,%ebx
+  80246f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802472:	29 f8                	sub    %edi,%eax
+  802474:	39 c3                	cmp    %eax,%ebx
+  802476:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  802479:	83 ec 04             	sub    $0x4,%esp
+  80247c:	53                   	push   %ebx
+  80247d:	03 56 0c             	add    0xc(%esi),%edx
+  802480:	52                   	push   %edx
+  802481:	89 f8                	mov    %edi,%eax
+  802483:	03 45 08             	add    0x8(%ebp),%eax
+  802486:	50                   	push   %eax
+  802487:	e8 38 e5 ff ff       	call   8009c4 <memmove>
+			f->f_rpos += m;
+  80248c:	01 5e 14             	add    %ebx,0x14(%esi)
+  80248f:	83 c4 10             	add    $0x10,%esp
+  802492:	eb 1a                	jmp    8024ae <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  802494:	83 ec 04             	sub    $0x4,%esp
+  802497:	53                   	push   %ebx
+  802498:	89 f8                	mov    %edi,%eax
+  80249a:	03 45 08             	add    0x8(%ebp),%eax
+  80249d:	50                   	push   %eax
+  80249e:	ff 36                	push   (%esi)
+  8024a0:	e8 86 ef ff ff       	call   80142b <read>
+  8024a5:	89 c3                	mov    %eax,%ebx
+  8024a7:	83 c4 10             	add    $0x10,%esp
+  8024aa:	85 c0                	test   %eax,%eax
+  8024ac:	7e 36                	jle    8024e4 <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  8024ae:	01 df                	add    %ebx,%edi
+  8024b0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8024b3:	39 c7                	cmp    %eax,%edi
+  8024b5:	73 39                	jae    8024f0 <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  8024b7:	8b 56 14             	mov    0x14(%esi),%edx
+  8024ba:	8b 5e 18             	mov    0x18(%esi),%ebx
+  8024bd:	39 da                	cmp    %ebx,%edx
+  8024bf:	72 ac                	jb     80246d <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  8024c1:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8024c4:	29 fb                	sub    %edi,%ebx
+  8024c6:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  8024c9:	72 3e                	jb     802509 <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  8024cb:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  8024cf:	74 1f                	je     8024f0 <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  8024d1:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  8024d5:	74 bd                	je     802494 <fread+0x4b>
+  8024d7:	89 f0                	mov    %esi,%eax
+  8024d9:	e8 2f fb ff ff       	call   80200d <stream_drain>
+  8024de:	85 c0                	test   %eax,%eax
+  8024e0:	79 b2                	jns    802494 <fread+0x4b>
+  8024e2:	eb 0c                	jmp    8024f0 <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  8024e4:	c1 fb 1f             	sar    $0x1f,%ebx
+  8024e7:	83 e3 04             	and    $0x4,%ebx
+  8024ea:	83 c3 04             	add    $0x4,%ebx
+  8024ed:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  8024f0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024f3:	85 c0                	test   %eax,%eax
+  8024f5:	74 0a                	je     802501 <fread+0xb8>
+  8024f7:	89 f8                	mov    %edi,%eax
+  8024f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024fe:	f7 75 0c             	divl   0xc(%ebp)
+}
+  802501:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802504:	5b                   	pop    %ebx
+  802505:	5e                   	pop    %esi
+  802506:	5f                   	pop    %edi
+  802507:	5d                   	pop    %ebp
+  802508:	c3                   	ret
+		} else if (!stream_fill(f))
+  802509:	89 f0                	mov    %esi,%eax
+  80250b:	e8 da fb ff ff       	call   8020ea <stream_fill>
+  802510:	85 c0                	test   %eax,%eax
+  802512:	74 dc                	je     8024f0 <fread+0xa7>
+			m = 0;
+  802514:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802519:	eb 93                	jmp    8024ae <fread+0x65>
+
+0080251b <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  80251b:	55                   	push   %ebp
+  80251c:	89 e5                	mov    %esp,%ebp
+  80251e:	57                   	push   %edi
+  80251f:	56                   	push   %esi
+  802520:	53                   	push   %ebx
+  802521:	83 ec 1c             	sub    $0x1c,%esp
+  802524:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  802527:	8b 43 04             	mov    0x4(%ebx),%eax
+  80252a:	a8 02                	test   $0x2,%al
+  80252c:	75 13                	jne    802541 <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  80252e:	83 c8 08             	or     $0x8,%eax
+  802531:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  802534:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  802539:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80253c:	5b                   	pop    %ebx
+  80253d:	5e                   	pop    %esi
+  80253e:	5f                   	pop    %edi
+  80253f:	5d                   	pop    %ebp
+  802540:	c3                   	ret
+	stream_setup(f);
+  802541:	89 d8                	mov    %ebx,%eax
+  802543:	e8 35 fb ff ff       	call   80207d <stream_setup>
+	want = size * n;
+  802548:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80254b:	0f af 45 10          	imul   0x10(%ebp),%eax
+  80254f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  802552:	89 d8                	mov    %ebx,%eax
+  802554:	e8 41 fa ff ff       	call   801f9a <stream_unread>
+	for (done = 0; done < want; ) {
+  802559:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  80255e:	84 c0                	test   %al,%al
+  802560:	75 7b                	jne    8025dd <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  802562:	be 00 00 00 00       	mov    $0x0,%esi
+  802567:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80256a:	39 fe                	cmp    %edi,%esi
+  80256c:	73 24                	jae    802592 <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  80256e:	83 ec 04             	sub    $0x4,%esp
+  802571:	89 f8                	mov    %edi,%eax
+  802573:	29 f0                	sub    %esi,%eax
+  802575:	50                   	push   %eax
+  802576:	89 f0                	mov    %esi,%eax
+  802578:	03 45 08             	add    0x8(%ebp),%eax
+  80257b:	50                   	push   %eax
+  80257c:	ff 33                	push   (%ebx)
+  80257e:	e8 a0 ef ff ff       	call   801523 <write>
+  802583:	83 c4 10             	add    $0x10,%esp
+  802586:	85 c0                	test   %eax,%eax
+  802588:	7e 04                	jle    80258e <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  80258a:	01 c6                	add    %eax,%esi
+  80258c:	eb dc                	jmp    80256a <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  80258e:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  802592:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802595:	85 c0                	test   %eax,%eax
+  802597:	74 a0                	je     802539 <fwrite+0x1e>
+  802599:	89 f0                	mov    %esi,%eax
+  80259b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025a0:	f7 75 0c             	divl   0xc(%ebp)
+  8025a3:	eb 94                	jmp    802539 <fwrite+0x1e>
+			done += r;
+  8025a5:	01 c7                	add    %eax,%edi
+			continue;
+  8025a7:	eb 34                	jmp    8025dd <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  8025a9:	8b 73 10             	mov    0x10(%ebx),%esi
+  8025ac:	29 c6                	sub    %eax,%esi
+  8025ae:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8025b1:	29 fa                	sub    %edi,%edx
+  8025b3:	39 d6                	cmp    %edx,%esi
+  8025b5:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  8025b8:	83 ec 04             	sub    $0x4,%esp
+  8025bb:	56                   	push   %esi
+  8025bc:	89 fa                	mov    %edi,%edx
+  8025be:	03 55 08             	add    0x8(%ebp),%edx
+  8025c1:	52                   	push   %edx
+  8025c2:	03 43 0c             	add    0xc(%ebx),%eax
+  8025c5:	50                   	push   %eax
+  8025c6:	e8 f9 e3 ff ff       	call   8009c4 <memmove>
+		f->f_wend += m;
+  8025cb:	89 f0                	mov    %esi,%eax
+  8025cd:	03 43 1c             	add    0x1c(%ebx),%eax
+  8025d0:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  8025d3:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  8025d5:	83 c4 10             	add    $0x10,%esp
+  8025d8:	3b 43 10             	cmp    0x10(%ebx),%eax
+  8025db:	74 5b                	je     802638 <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  8025dd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8025e0:	39 c7                	cmp    %eax,%edi
+  8025e2:	73 2d                	jae    802611 <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  8025e4:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8025e7:	85 c0                	test   %eax,%eax
+  8025e9:	75 be                	jne    8025a9 <fwrite+0x8e>
+  8025eb:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8025ee:	29 fa                	sub    %edi,%edx
+  8025f0:	3b 53 10             	cmp    0x10(%ebx),%edx
+  8025f3:	72 b4                	jb     8025a9 <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  8025f5:	83 ec 04             	sub    $0x4,%esp
+  8025f8:	52                   	push   %edx
+  8025f9:	89 f8                	mov    %edi,%eax
+  8025fb:	03 45 08             	add    0x8(%ebp),%eax
+  8025fe:	50                   	push   %eax
+  8025ff:	ff 33                	push   (%ebx)
+  802601:	e8 1d ef ff ff       	call   801523 <write>
+  802606:	83 c4 10             	add    $0x10,%esp
+  802609:	85 c0                	test   %eax,%eax
+  80260b:	7f 98                	jg     8025a5 <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  80260d:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  802611:	8b 43 08             	mov    0x8(%ebx),%eax
+  802614:	83 f8 03             	cmp    $0x3,%eax
+  802617:	74 48                	je     802661 <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802619:	83 f8 02             	cmp    $0x2,%eax
+  80261c:	74 27                	je     802645 <fwrite+0x12a>
+	return size ? done / size : 0;
+  80261e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802621:	85 c0                	test   %eax,%eax
+  802623:	0f 84 10 ff ff ff    	je     802539 <fwrite+0x1e>
+  802629:	89 f8                	mov    %edi,%eax
+  80262b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802630:	f7 75 0c             	divl   0xc(%ebp)
+  802633:	e9 01 ff ff ff       	jmp    802539 <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802638:	89 d8                	mov    %ebx,%eax
+  80263a:	e8 ce f9 ff ff       	call   80200d <stream_drain>
+  80263f:	85 c0                	test   %eax,%eax
+  802641:	79 9a                	jns    8025dd <fwrite+0xc2>
+  802643:	eb cc                	jmp    802611 <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802645:	83 ec 04             	sub    $0x4,%esp
+  802648:	57                   	push   %edi
+  802649:	6a 0a                	push   $0xa
+  80264b:	ff 75 08             	push   0x8(%ebp)
+  80264e:	e8 22 e4 ff ff       	call   800a75 <memfind>
+  802653:	89 c2                	mov    %eax,%edx
+  802655:	89 f8                	mov    %edi,%eax
+  802657:	03 45 08             	add    0x8(%ebp),%eax
+  80265a:	83 c4 10             	add    $0x10,%esp
+  80265d:	39 c2                	cmp    %eax,%edx
+  80265f:	74 bd                	je     80261e <fwrite+0x103>
+		stream_drain(f);
+  802661:	89 d8                	mov    %ebx,%eax
+  802663:	e8 a5 f9 ff ff       	call   80200d <stream_drain>
+  802668:	eb b4                	jmp    80261e <fwrite+0x103>
+
+0080266a <fputc>:
+{
+  80266a:	55                   	push   %ebp
+  80266b:	89 e5                	mov    %esp,%ebp
+  80266d:	53                   	push   %ebx
+  80266e:	83 ec 14             	sub    $0x14,%esp
+  802671:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  802674:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  802677:	ff 75 0c             	push   0xc(%ebp)
+  80267a:	6a 01                	push   $0x1
+  80267c:	6a 01                	push   $0x1
+  80267e:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802681:	50                   	push   %eax
+  802682:	e8 94 fe ff ff       	call   80251b <fwrite>
+  802687:	83 c4 10             	add    $0x10,%esp
+  80268a:	0f b6 db             	movzbl %bl,%ebx
+  80268d:	83 f8 01             	cmp    $0x1,%eax
+  802690:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802695:	0f 44 c3             	cmove  %ebx,%eax
+}
+  802698:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80269b:	c9                   	leave
+  80269c:	c3                   	ret
+
+0080269d <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  80269d:	55                   	push   %ebp
+  80269e:	89 e5                	mov    %esp,%ebp
+  8026a0:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  8026a3:	ff 75 0c             	push   0xc(%ebp)
+  8026a6:	ff 75 08             	push   0x8(%ebp)
+  8026a9:	e8 bc ff ff ff       	call   80266a <fputc>
+}
+  8026ae:	83 c4 10             	add    $0x10,%esp
+  8026b1:	c9                   	leave
+  8026b2:	c3                   	ret
+
+008026b3 <fputs>:
+{
+  8026b3:	55                   	push   %ebp
+  8026b4:	89 e5                	mov    %esp,%ebp
+  8026b6:	56                   	push   %esi
+  8026b7:	53                   	push   %ebx
+  8026b8:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  8026bb:	83 ec 0c             	sub    $0xc,%esp
+  8026be:	56                   	push   %esi
+  8026bf:	e8 3f e1 ff ff       	call   800803 <strlen>
+  8026c4:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  8026c6:	ff 75 0c             	push   0xc(%ebp)
+  8026c9:	50                   	push   %eax
+  8026ca:	6a 01                	push   $0x1
+  8026cc:	56                   	push   %esi
+  8026cd:	e8 49 fe ff ff       	call   80251b <fwrite>
+  8026d2:	83 c4 20             	add    $0x20,%esp
+  8026d5:	39 d8                	cmp    %ebx,%eax
+  8026d7:	0f 95 c0             	setne  %al
+  8026da:	0f b6 c0             	movzbl %al,%eax
+  8026dd:	f7 d8                	neg    %eax
+}
+  8026df:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026e2:	5b                   	pop    %ebx
+  8026e3:	5e                   	pop    %esi
+  8026e4:	5d                   	pop    %ebp
+  8026e5:	c3                   	ret
+
+008026e6 <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  8026e6:	55                   	push   %ebp
+  8026e7:	89 e5                	mov    %esp,%ebp
+  8026e9:	53                   	push   %ebx
+  8026ea:	83 ec 04             	sub    $0x4,%esp
+  8026ed:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8026f0:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  8026f3:	50                   	push   %eax
+  8026f4:	ff 75 0c             	push   0xc(%ebp)
+  8026f7:	53                   	push   %ebx
+  8026f8:	68 9d 26 80 00       	push   $0x80269d
+  8026fd:	e8 4f dc ff ff       	call   800351 <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  802702:	8b 43 04             	mov    0x4(%ebx),%eax
+  802705:	c1 e0 1c             	shl    $0x1c,%eax
+  802708:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  80270b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80270e:	c9                   	leave
+  80270f:	c3                   	ret
+
+00802710 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802710:	55                   	push   %ebp
+  802711:	89 e5                	mov    %esp,%ebp
+  802713:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802716:	68 d8 4c 80 00       	push   $0x804cd8
+  80271b:	ff 75 0c             	push   0xc(%ebp)
+  80271e:	e8 1b e1 ff ff       	call   80083e <strcpy>
+	return 0;
+}
+  802723:	b8 00 00 00 00       	mov    $0x0,%eax
+  802728:	c9                   	leave
+  802729:	c3                   	ret
+
+0080272a <devsock_close>:
+{
+  80272a:	55                   	push   %ebp
+  80272b:	89 e5                	mov    %esp,%ebp
+  80272d:	53                   	push   %ebx
+  80272e:	83 ec 10             	sub    $0x10,%esp
+  802731:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802734:	53                   	push   %ebx
+  802735:	e8 23 1d 00 00       	call   80445d <pageref>
+  80273a:	89 c2                	mov    %eax,%edx
+  80273c:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80273f:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802744:	83 fa 01             	cmp    $0x1,%edx
+  802747:	74 05                	je     80274e <devsock_close+0x24>
+}
+  802749:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80274c:	c9                   	leave
+  80274d:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80274e:	83 ec 0c             	sub    $0xc,%esp
+  802751:	ff 73 0c             	push   0xc(%ebx)
+  802754:	e8 b7 02 00 00       	call   802a10 <nsipc_close>
+  802759:	83 c4 10             	add    $0x10,%esp
+  80275c:	eb eb                	jmp    802749 <devsock_close+0x1f>
+
+0080275e <devsock_write>:
+{
+  80275e:	55                   	push   %ebp
+  80275f:	89 e5                	mov    %esp,%ebp
+  802761:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802764:	6a 00                	push   $0x0
+  802766:	ff 75 10             	push   0x10(%ebp)
+  802769:	ff 75 0c             	push   0xc(%ebp)
+  80276c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80276f:	ff 70 0c             	push   0xc(%eax)
+  802772:	e8 79 03 00 00       	call   802af0 <nsipc_send>
+}
+  802777:	c9                   	leave
+  802778:	c3                   	ret
+
+00802779 <devsock_read>:
+{
+  802779:	55                   	push   %ebp
+  80277a:	89 e5                	mov    %esp,%ebp
+  80277c:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80277f:	6a 00                	push   $0x0
+  802781:	ff 75 10             	push   0x10(%ebp)
+  802784:	ff 75 0c             	push   0xc(%ebp)
+  802787:	8b 45 08             	mov    0x8(%ebp),%eax
+  80278a:	ff 70 0c             	push   0xc(%eax)
+  80278d:	e8 ef 02 00 00       	call   802a81 <nsipc_recv>
+}
+  802792:	c9                   	leave
+  802793:	c3                   	ret
+
+00802794 <fd2sockid>:
+{
+  802794:	55                   	push   %ebp
+  802795:	89 e5                	mov    %esp,%ebp
+  802797:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  80279a:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80279d:	52                   	push   %edx
+  80279e:	50                   	push   %eax
+  80279f:	e8 f7 e9 ff ff       	call   80119b <fd_lookup>
+  8027a4:	83 c4 10             	add    $0x10,%esp
+  8027a7:	85 c0                	test   %eax,%eax
+  8027a9:	78 10                	js     8027bb <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8027ab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027ae:	8b 0d 60 52 80 00    	mov    0x805260,%ecx
+  8027b4:	39 08                	cmp    %ecx,(%eax)
+  8027b6:	75 05                	jne    8027bd <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8027b8:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8027bb:	c9                   	leave
+  8027bc:	c3                   	ret
+		return -E_NOT_SUPP;
+  8027bd:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8027c2:	eb f7                	jmp    8027bb <fd2sockid+0x27>
+
+008027c4 <alloc_sockfd>:
+{
+  8027c4:	55                   	push   %ebp
+  8027c5:	89 e5                	mov    %esp,%ebp
+  8027c7:	56                   	push   %esi
+  8027c8:	53                   	push   %ebx
+  8027c9:	83 ec 1c             	sub    $0x1c,%esp
+  8027cc:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8027ce:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8027d1:	50                   	push   %eax
+  8027d2:	e8 6e e9 ff ff       	call   801145 <fd_alloc>
+  8027d7:	89 c3                	mov    %eax,%ebx
+  8027d9:	83 c4 10             	add    $0x10,%esp
+  8027dc:	85 c0                	test   %eax,%eax
+  8027de:	78 43                	js     802823 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8027e0:	83 ec 04             	sub    $0x4,%esp
+  8027e3:	68 07 04 00 00       	push   $0x407
+  8027e8:	ff 75 f4             	push   -0xc(%ebp)
+  8027eb:	6a 00                	push   $0x0
+  8027ed:	e8 8a e4 ff ff       	call   800c7c <sys_page_alloc>
+  8027f2:	89 c3                	mov    %eax,%ebx
+  8027f4:	83 c4 10             	add    $0x10,%esp
+  8027f7:	85 c0                	test   %eax,%eax
+  8027f9:	78 28                	js     802823 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8027fb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027fe:	8b 15 60 52 80 00    	mov    0x805260,%edx
+  802804:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802806:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802809:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802810:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802813:	83 ec 0c             	sub    $0xc,%esp
+  802816:	50                   	push   %eax
+  802817:	e8 02 e9 ff ff       	call   80111e <fd2num>
+  80281c:	89 c3                	mov    %eax,%ebx
+  80281e:	83 c4 10             	add    $0x10,%esp
+  802821:	eb 0c                	jmp    80282f <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802823:	83 ec 0c             	sub    $0xc,%esp
+  802826:	56                   	push   %esi
+  802827:	e8 e4 01 00 00       	call   802a10 <nsipc_close>
+		return r;
+  80282c:	83 c4 10             	add    $0x10,%esp
+}
+  80282f:	89 d8                	mov    %ebx,%eax
+  802831:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802834:	5b                   	pop    %ebx
+  802835:	5e                   	pop    %esi
+  802836:	5d                   	pop    %ebp
+  802837:	c3                   	ret
+
+00802838 <accept>:
+{
+  802838:	55                   	push   %ebp
+  802839:	89 e5                	mov    %esp,%ebp
+  80283b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80283e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802841:	e8 4e ff ff ff       	call   802794 <fd2sockid>
+  802846:	85 c0                	test   %eax,%eax
+  802848:	78 1b                	js     802865 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  80284a:	83 ec 04             	sub    $0x4,%esp
+  80284d:	ff 75 10             	push   0x10(%ebp)
+  802850:	ff 75 0c             	push   0xc(%ebp)
+  802853:	50                   	push   %eax
+  802854:	e8 0e 01 00 00       	call   802967 <nsipc_accept>
+  802859:	83 c4 10             	add    $0x10,%esp
+  80285c:	85 c0                	test   %eax,%eax
+  80285e:	78 05                	js     802865 <accept+0x2d>
+	return alloc_sockfd(r);
+  802860:	e8 5f ff ff ff       	call   8027c4 <alloc_sockfd>
+}
+  802865:	c9                   	leave
+  802866:	c3                   	ret
+
+00802867 <bind>:
+{
+  802867:	55                   	push   %ebp
+  802868:	89 e5                	mov    %esp,%ebp
+  80286a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80286d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802870:	e8 1f ff ff ff       	call   802794 <fd2sockid>
+  802875:	85 c0                	test   %eax,%eax
+  802877:	78 12                	js     80288b <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802879:	83 ec 04             	sub    $0x4,%esp
+  80287c:	ff 75 10             	push   0x10(%ebp)
+  80287f:	ff 75 0c             	push   0xc(%ebp)
+  802882:	50                   	push   %eax
+  802883:	e8 31 01 00 00       	call   8029b9 <nsipc_bind>
+  802888:	83 c4 10             	add    $0x10,%esp
+}
+  80288b:	c9                   	leave
+  80288c:	c3                   	ret
+
+0080288d <shutdown>:
+{
+  80288d:	55                   	push   %ebp
+  80288e:	89 e5                	mov    %esp,%ebp
+  802890:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802893:	8b 45 08             	mov    0x8(%ebp),%eax
+  802896:	e8 f9 fe ff ff       	call   802794 <fd2sockid>
+  80289b:	85 c0                	test   %eax,%eax
+  80289d:	78 0f                	js     8028ae <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  80289f:	83 ec 08             	sub    $0x8,%esp
+  8028a2:	ff 75 0c             	push   0xc(%ebp)
+  8028a5:	50                   	push   %eax
+  8028a6:	e8 43 01 00 00       	call   8029ee <nsipc_shutdown>
+  8028ab:	83 c4 10             	add    $0x10,%esp
+}
+  8028ae:	c9                   	leave
+  8028af:	c3                   	ret
+
+008028b0 <connect>:
+{
+  8028b0:	55                   	push   %ebp
+  8028b1:	89 e5                	mov    %esp,%ebp
+  8028b3:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8028b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028b9:	e8 d6 fe ff ff       	call   802794 <fd2sockid>
+  8028be:	85 c0                	test   %eax,%eax
+  8028c0:	78 12                	js     8028d4 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8028c2:	83 ec 04             	sub    $0x4,%esp
+  8028c5:	ff 75 10             	push   0x10(%ebp)
+  8028c8:	ff 75 0c             	push   0xc(%ebp)
+  8028cb:	50                   	push   %eax
+  8028cc:	e8 59 01 00 00       	call   802a2a <nsipc_connect>
+  8028d1:	83 c4 10             	add    $0x10,%esp
+}
+  8028d4:	c9                   	leave
+  8028d5:	c3                   	ret
+
+008028d6 <listen>:
+{
+  8028d6:	55                   	push   %ebp
+  8028d7:	89 e5                	mov    %esp,%ebp
+  8028d9:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8028dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028df:	e8 b0 fe ff ff       	call   802794 <fd2sockid>
+  8028e4:	85 c0                	test   %eax,%eax
+  8028e6:	78 0f                	js     8028f7 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8028e8:	83 ec 08             	sub    $0x8,%esp
+  8028eb:	ff 75 0c             	push   0xc(%ebp)
+  8028ee:	50                   	push   %eax
+  8028ef:	e8 6b 01 00 00       	call   802a5f <nsipc_listen>
+  8028f4:	83 c4 10             	add    $0x10,%esp
+}
+  8028f7:	c9                   	leave
+  8028f8:	c3                   	ret
+
+008028f9 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8028f9:	55                   	push   %ebp
+  8028fa:	89 e5                	mov    %esp,%ebp
+  8028fc:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8028ff:	ff 75 10             	push   0x10(%ebp)
+  802902:	ff 75 0c             	push   0xc(%ebp)
+  802905:	ff 75 08             	push   0x8(%ebp)
+  802908:	e8 41 02 00 00       	call   802b4e <nsipc_socket>
+  80290d:	83 c4 10             	add    $0x10,%esp
+  802910:	85 c0                	test   %eax,%eax
+  802912:	78 05                	js     802919 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802914:	e8 ab fe ff ff       	call   8027c4 <alloc_sockfd>
+}
+  802919:	c9                   	leave
+  80291a:	c3                   	ret
+
+0080291b <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80291b:	55                   	push   %ebp
+  80291c:	89 e5                	mov    %esp,%ebp
+  80291e:	53                   	push   %ebx
+  80291f:	83 ec 04             	sub    $0x4,%esp
+  802922:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802924:	83 3d 08 60 80 00 00 	cmpl   $0x0,0x806008
+  80292b:	74 26                	je     802953 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  80292d:	6a 07                	push   $0x7
+  80292f:	68 00 80 c0 00       	push   $0xc08000
+  802934:	53                   	push   %ebx
+  802935:	ff 35 08 60 80 00    	push   0x806008
+  80293b:	e8 88 1a 00 00       	call   8043c8 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802940:	83 c4 0c             	add    $0xc,%esp
+  802943:	6a 00                	push   $0x0
+  802945:	6a 00                	push   $0x0
+  802947:	6a 00                	push   $0x0
+  802949:	e8 84 19 00 00       	call   8042d2 <ipc_recv>
+}
+  80294e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802951:	c9                   	leave
+  802952:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802953:	83 ec 0c             	sub    $0xc,%esp
+  802956:	6a 02                	push   $0x2
+  802958:	e8 c1 1a 00 00       	call   80441e <ipc_find_env>
+  80295d:	a3 08 60 80 00       	mov    %eax,0x806008
+  802962:	83 c4 10             	add    $0x10,%esp
+  802965:	eb c6                	jmp    80292d <nsipc+0x12>
+
+00802967 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802967:	55                   	push   %ebp
+  802968:	89 e5                	mov    %esp,%ebp
+  80296a:	56                   	push   %esi
+  80296b:	53                   	push   %ebx
+  80296c:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80296f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802972:	a3 00 80 c0 00       	mov    %eax,0xc08000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802977:	8b 06                	mov    (%esi),%eax
+  802979:	a3 04 80 c0 00       	mov    %eax,0xc08004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80297e:	b8 01 00 00 00       	mov    $0x1,%eax
+  802983:	e8 93 ff ff ff       	call   80291b <nsipc>
+  802988:	89 c3                	mov    %eax,%ebx
+  80298a:	85 c0                	test   %eax,%eax
+  80298c:	79 09                	jns    802997 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  80298e:	89 d8                	mov    %ebx,%eax
+  802990:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802993:	5b                   	pop    %ebx
+  802994:	5e                   	pop    %esi
+  802995:	5d                   	pop    %ebp
+  802996:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802997:	83 ec 04             	sub    $0x4,%esp
+  80299a:	ff 35 10 80 c0 00    	push   0xc08010
+  8029a0:	68 00 80 c0 00       	push   $0xc08000
+  8029a5:	ff 75 0c             	push   0xc(%ebp)
+  8029a8:	e8 17 e0 ff ff       	call   8009c4 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8029ad:	a1 10 80 c0 00       	mov    0xc08010,%eax
+  8029b2:	89 06                	mov    %eax,(%esi)
+  8029b4:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8029b7:	eb d5                	jmp    80298e <nsipc_accept+0x27>
+
+008029b9 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8029b9:	55                   	push   %ebp
+  8029ba:	89 e5                	mov    %esp,%ebp
+  8029bc:	53                   	push   %ebx
+  8029bd:	83 ec 08             	sub    $0x8,%esp
+  8029c0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8029c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029c6:	a3 00 80 c0 00       	mov    %eax,0xc08000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8029cb:	53                   	push   %ebx
+  8029cc:	ff 75 0c             	push   0xc(%ebp)
+  8029cf:	68 04 80 c0 00       	push   $0xc08004
+  8029d4:	e8 eb df ff ff       	call   8009c4 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8029d9:	89 1d 14 80 c0 00    	mov    %ebx,0xc08014
+	return nsipc(NSREQ_BIND);
+  8029df:	b8 02 00 00 00       	mov    $0x2,%eax
+  8029e4:	e8 32 ff ff ff       	call   80291b <nsipc>
+}
+  8029e9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029ec:	c9                   	leave
+  8029ed:	c3                   	ret
+
+008029ee <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8029ee:	55                   	push   %ebp
+  8029ef:	89 e5                	mov    %esp,%ebp
+  8029f1:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8029f4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029f7:	a3 00 80 c0 00       	mov    %eax,0xc08000
+	nsipcbuf.shutdown.req_how = how;
+  8029fc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8029ff:	a3 04 80 c0 00       	mov    %eax,0xc08004
+	return nsipc(NSREQ_SHUTDOWN);
+  802a04:	b8 03 00 00 00       	mov    $0x3,%eax
+  802a09:	e8 0d ff ff ff       	call   80291b <nsipc>
+}
+  802a0e:	c9                   	leave
+  802a0f:	c3                   	ret
+
+00802a10 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802a10:	55                   	push   %ebp
+  802a11:	89 e5                	mov    %esp,%ebp
+  802a13:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802a16:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a19:	a3 00 80 c0 00       	mov    %eax,0xc08000
+	return nsipc(NSREQ_CLOSE);
+  802a1e:	b8 04 00 00 00       	mov    $0x4,%eax
+  802a23:	e8 f3 fe ff ff       	call   80291b <nsipc>
+}
+  802a28:	c9                   	leave
+  802a29:	c3                   	ret
+
+00802a2a <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802a2a:	55                   	push   %ebp
+  802a2b:	89 e5                	mov    %esp,%ebp
+  802a2d:	53                   	push   %ebx
+  802a2e:	83 ec 08             	sub    $0x8,%esp
+  802a31:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802a34:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a37:	a3 00 80 c0 00       	mov    %eax,0xc08000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802a3c:	53                   	push   %ebx
+  802a3d:	ff 75 0c             	push   0xc(%ebp)
+  802a40:	68 04 80 c0 00       	push   $0xc08004
+  802a45:	e8 7a df ff ff       	call   8009c4 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802a4a:	89 1d 14 80 c0 00    	mov    %ebx,0xc08014
+	return nsipc(NSREQ_CONNECT);
+  802a50:	b8 05 00 00 00       	mov    $0x5,%eax
+  802a55:	e8 c1 fe ff ff       	call   80291b <nsipc>
+}
+  802a5a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a5d:	c9                   	leave
+  802a5e:	c3                   	ret
+
+00802a5f <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802a5f:	55                   	push   %ebp
+  802a60:	89 e5                	mov    %esp,%ebp
+  802a62:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802a65:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a68:	a3 00 80 c0 00       	mov    %eax,0xc08000
+	nsipcbuf.listen.req_backlog = backlog;
+  802a6d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a70:	a3 04 80 c0 00       	mov    %eax,0xc08004
+	return nsipc(NSREQ_LISTEN);
+  802a75:	b8 06 00 00 00       	mov    $0x6,%eax
+  802a7a:	e8 9c fe ff ff       	call   80291b <nsipc>
+}
+  802a7f:	c9                   	leave
+  802a80:	c3                   	ret
+
+00802a81 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802a81:	55                   	push   %ebp
+  802a82:	89 e5                	mov    %esp,%ebp
+  802a84:	56                   	push   %esi
+  802a85:	53                   	push   %ebx
+  802a86:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802a89:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a8c:	a3 00 80 c0 00       	mov    %eax,0xc08000
+	nsipcbuf.recv.req_len = len;
+  802a91:	89 35 04 80 c0 00    	mov    %esi,0xc08004
+	nsipcbuf.recv.req_flags = flags;
+  802a97:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a9a:	a3 08 80 c0 00       	mov    %eax,0xc08008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802a9f:	b8 07 00 00 00       	mov    $0x7,%eax
+  802aa4:	e8 72 fe ff ff       	call   80291b <nsipc>
+  802aa9:	89 c3                	mov    %eax,%ebx
+  802aab:	85 c0                	test   %eax,%eax
+  802aad:	78 22                	js     802ad1 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802aaf:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802ab4:	39 c6                	cmp    %eax,%esi
+  802ab6:	0f 4e c6             	cmovle %esi,%eax
+  802ab9:	39 c3                	cmp    %eax,%ebx
+  802abb:	7f 1d                	jg     802ada <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802abd:	83 ec 04             	sub    $0x4,%esp
+  802ac0:	53                   	push   %ebx
+  802ac1:	68 00 80 c0 00       	push   $0xc08000
+  802ac6:	ff 75 0c             	push   0xc(%ebp)
+  802ac9:	e8 f6 de ff ff       	call   8009c4 <memmove>
+  802ace:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802ad1:	89 d8                	mov    %ebx,%eax
+  802ad3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ad6:	5b                   	pop    %ebx
+  802ad7:	5e                   	pop    %esi
+  802ad8:	5d                   	pop    %ebp
+  802ad9:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802ada:	68 e4 4c 80 00       	push   $0x804ce4
+  802adf:	68 9d 4c 80 00       	push   $0x804c9d
+  802ae4:	6a 62                	push   $0x62
+  802ae6:	68 f9 4c 80 00       	push   $0x804cf9
+  802aeb:	e8 8f d6 ff ff       	call   80017f <_panic>
+
+00802af0 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802af0:	55                   	push   %ebp
+  802af1:	89 e5                	mov    %esp,%ebp
+  802af3:	53                   	push   %ebx
+  802af4:	83 ec 04             	sub    $0x4,%esp
+  802af7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802afa:	8b 45 08             	mov    0x8(%ebp),%eax
+  802afd:	a3 00 80 c0 00       	mov    %eax,0xc08000
+	assert(size < 1600);
+  802b02:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802b08:	7f 2e                	jg     802b38 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802b0a:	83 ec 04             	sub    $0x4,%esp
+  802b0d:	53                   	push   %ebx
+  802b0e:	ff 75 0c             	push   0xc(%ebp)
+  802b11:	68 0c 80 c0 00       	push   $0xc0800c
+  802b16:	e8 a9 de ff ff       	call   8009c4 <memmove>
+	nsipcbuf.send.req_size = size;
+  802b1b:	89 1d 04 80 c0 00    	mov    %ebx,0xc08004
+	nsipcbuf.send.req_flags = flags;
+  802b21:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b24:	a3 08 80 c0 00       	mov    %eax,0xc08008
+	return nsipc(NSREQ_SEND);
+  802b29:	b8 08 00 00 00       	mov    $0x8,%eax
+  802b2e:	e8 e8 fd ff ff       	call   80291b <nsipc>
+}
+  802b33:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b36:	c9                   	leave
+  802b37:	c3                   	ret
+	assert(size < 1600);
+  802b38:	68 05 4d 80 00       	push   $0x804d05
+  802b3d:	68 9d 4c 80 00       	push   $0x804c9d
+  802b42:	6a 6d                	push   $0x6d
+  802b44:	68 f9 4c 80 00       	push   $0x804cf9
+  802b49:	e8 31 d6 ff ff       	call   80017f <_panic>
+
+00802b4e <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802b4e:	55                   	push   %ebp
+  802b4f:	89 e5                	mov    %esp,%ebp
+  802b51:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802b54:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b57:	a3 00 80 c0 00       	mov    %eax,0xc08000
+	nsipcbuf.socket.req_type = type;
+  802b5c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b5f:	a3 04 80 c0 00       	mov    %eax,0xc08004
+	nsipcbuf.socket.req_protocol = protocol;
+  802b64:	8b 45 10             	mov    0x10(%ebp),%eax
+  802b67:	a3 08 80 c0 00       	mov    %eax,0xc08008
+	return nsipc(NSREQ_SOCKET);
+  802b6c:	b8 09 00 00 00       	mov    $0x9,%eax
+  802b71:	e8 a5 fd ff ff       	call   80291b <nsipc>
+}
+  802b76:	c9                   	leave
+  802b77:	c3                   	ret
+
+00802b78 <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  802b78:	55                   	push   %ebp
+  802b79:	89 e5                	mov    %esp,%ebp
+  802b7b:	53                   	push   %ebx
+  802b7c:	83 ec 10             	sub    $0x10,%esp
+  802b7f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  802b82:	68 0c 60 80 00       	push   $0x80600c
+  802b87:	e8 50 07 00 00       	call   8032dc <mutex_lock>
+	if (v == 0)
+  802b8c:	83 c4 10             	add    $0x10,%esp
+  802b8f:	85 db                	test   %ebx,%ebx
+  802b91:	0f 84 85 00 00 00    	je     802c1c <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802b97:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802b9d:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802ba2:	77 51                	ja     802bf5 <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  802ba4:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  802baa:	89 d8                	mov    %ebx,%eax
+  802bac:	c1 e8 0c             	shr    $0xc,%eax
+  802baf:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802bb6:	f6 c4 02             	test   $0x2,%ah
+  802bb9:	74 50                	je     802c0b <free+0x93>
+		sys_page_unmap(0, c);
+  802bbb:	83 ec 08             	sub    $0x8,%esp
+  802bbe:	53                   	push   %ebx
+  802bbf:	6a 00                	push   $0x0
+  802bc1:	e8 4f e1 ff ff       	call   800d15 <sys_page_unmap>
+		c += PGSIZE;
+  802bc6:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  802bcc:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802bd2:	83 c4 10             	add    $0x10,%esp
+  802bd5:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802bda:	76 ce                	jbe    802baa <free+0x32>
+  802bdc:	68 4f 4d 80 00       	push   $0x804d4f
+  802be1:	68 9d 4c 80 00       	push   $0x804c9d
+  802be6:	68 82 00 00 00       	push   $0x82
+  802beb:	68 42 4d 80 00       	push   $0x804d42
+  802bf0:	e8 8a d5 ff ff       	call   80017f <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802bf5:	68 14 4d 80 00       	push   $0x804d14
+  802bfa:	68 9d 4c 80 00       	push   $0x804c9d
+  802bff:	6a 7b                	push   $0x7b
+  802c01:	68 42 4d 80 00       	push   $0x804d42
+  802c06:	e8 74 d5 ff ff       	call   80017f <_panic>
+	if (--(*ref) == 0)
+  802c0b:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  802c11:	83 e8 01             	sub    $0x1,%eax
+  802c14:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  802c1a:	74 15                	je     802c31 <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  802c1c:	83 ec 0c             	sub    $0xc,%esp
+  802c1f:	68 0c 60 80 00       	push   $0x80600c
+  802c24:	e8 20 07 00 00       	call   803349 <mutex_unlock>
+}
+  802c29:	83 c4 10             	add    $0x10,%esp
+  802c2c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c2f:	c9                   	leave
+  802c30:	c3                   	ret
+		sys_page_unmap(0, c);
+  802c31:	83 ec 08             	sub    $0x8,%esp
+  802c34:	53                   	push   %ebx
+  802c35:	6a 00                	push   $0x0
+  802c37:	e8 d9 e0 ff ff       	call   800d15 <sys_page_unmap>
+  802c3c:	83 c4 10             	add    $0x10,%esp
+  802c3f:	eb db                	jmp    802c1c <free+0xa4>
+
+00802c41 <malloc>:
+{
+  802c41:	55                   	push   %ebp
+  802c42:	89 e5                	mov    %esp,%ebp
+  802c44:	57                   	push   %edi
+  802c45:	56                   	push   %esi
+  802c46:	53                   	push   %ebx
+  802c47:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  802c4a:	68 0c 60 80 00       	push   $0x80600c
+  802c4f:	e8 88 06 00 00       	call   8032dc <mutex_lock>
+	if (mptr == 0)
+  802c54:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+  802c5a:	83 c4 10             	add    $0x10,%esp
+  802c5d:	85 ff                	test   %edi,%edi
+  802c5f:	74 6c                	je     802ccd <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  802c61:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c64:	83 c0 03             	add    $0x3,%eax
+  802c67:	83 e0 fc             	and    $0xfffffffc,%eax
+  802c6a:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  802c6c:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  802c71:	0f 87 64 01 00 00    	ja     802ddb <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  802c77:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  802c7d:	74 30                	je     802caf <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  802c7f:	89 f9                	mov    %edi,%ecx
+  802c81:	c1 e9 0c             	shr    $0xc,%ecx
+  802c84:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  802c88:	c1 e8 0c             	shr    $0xc,%eax
+  802c8b:	39 c1                	cmp    %eax,%ecx
+  802c8d:	74 5f                	je     802cee <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  802c8f:	83 ec 0c             	sub    $0xc,%esp
+  802c92:	57                   	push   %edi
+  802c93:	e8 e0 fe ff ff       	call   802b78 <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  802c98:	a1 10 60 80 00       	mov    0x806010,%eax
+  802c9d:	05 00 10 00 00       	add    $0x1000,%eax
+  802ca2:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802ca7:	a3 10 60 80 00       	mov    %eax,0x806010
+  802cac:	83 c4 10             	add    $0x10,%esp
+  802caf:	8b 0d 10 60 80 00    	mov    0x806010,%ecx
+{
+  802cb5:	ba 02 00 00 00       	mov    $0x2,%edx
+  802cba:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  802cbe:	8d 7e 04             	lea    0x4(%esi),%edi
+  802cc1:	89 cb                	mov    %ecx,%ebx
+  802cc3:	01 f9                	add    %edi,%ecx
+  802cc5:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802cc8:	e9 8b 00 00 00       	jmp    802d58 <malloc+0x117>
+		mptr = mbegin;
+  802ccd:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  802cd4:	00 00 08 
+	n = ROUNDUP(n, 4);
+  802cd7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cda:	83 c0 03             	add    $0x3,%eax
+  802cdd:	83 e0 fc             	and    $0xfffffffc,%eax
+  802ce0:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  802ce2:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  802ce7:	76 c6                	jbe    802caf <malloc+0x6e>
+  802ce9:	e9 d6 00 00 00       	jmp    802dc4 <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  802cee:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802cf4:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  802cf9:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  802cfd:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  802d00:	a3 10 60 80 00       	mov    %eax,0x806010
+			return v;
+  802d05:	e9 ba 00 00 00       	jmp    802dc4 <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  802d0a:	05 00 10 00 00       	add    $0x1000,%eax
+  802d0f:	39 c8                	cmp    %ecx,%eax
+  802d11:	0f 83 cb 00 00 00    	jae    802de2 <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  802d17:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  802d1c:	77 22                	ja     802d40 <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  802d1e:	89 c2                	mov    %eax,%edx
+  802d20:	c1 ea 16             	shr    $0x16,%edx
+  802d23:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802d2a:	f6 c2 01             	test   $0x1,%dl
+  802d2d:	74 db                	je     802d0a <malloc+0xc9>
+  802d2f:	89 c2                	mov    %eax,%edx
+  802d31:	c1 ea 0c             	shr    $0xc,%edx
+  802d34:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802d3b:	f6 c2 01             	test   $0x1,%dl
+  802d3e:	74 ca                	je     802d0a <malloc+0xc9>
+		if (mptr == mend) {
+  802d40:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802d46:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  802d4c:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  802d50:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  802d56:	74 04                	je     802d5c <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  802d58:	89 d8                	mov    %ebx,%eax
+  802d5a:	eb b3                	jmp    802d0f <malloc+0xce>
+  802d5c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  802d5f:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  802d64:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  802d68:	83 ea 01             	sub    $0x1,%edx
+  802d6b:	0f 85 50 ff ff ff    	jne    802cc1 <malloc+0x80>
+  802d71:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  802d78:	00 00 08 
+				return 0;	/* out of address space */
+  802d7b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d80:	eb 42                	jmp    802dc4 <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  802d82:	85 db                	test   %ebx,%ebx
+  802d84:	78 1e                	js     802da4 <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  802d86:	83 ec 08             	sub    $0x8,%esp
+  802d89:	89 d8                	mov    %ebx,%eax
+  802d8b:	03 05 10 60 80 00    	add    0x806010,%eax
+  802d91:	50                   	push   %eax
+  802d92:	6a 00                	push   $0x0
+  802d94:	e8 7c df ff ff       	call   800d15 <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  802d99:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  802d9f:	83 c4 10             	add    $0x10,%esp
+  802da2:	eb de                	jmp    802d82 <malloc+0x141>
+			return 0;	/* out of physical memory */
+  802da4:	bf 00 00 00 00       	mov    $0x0,%edi
+  802da9:	eb 19                	jmp    802dc4 <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  802dab:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802dae:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  802db4:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  802dbb:	00 
+	mptr += n;
+  802dbc:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  802dbf:	a3 10 60 80 00       	mov    %eax,0x806010
+	mutex_unlock(&malloc_mu);
+  802dc4:	83 ec 0c             	sub    $0xc,%esp
+  802dc7:	68 0c 60 80 00       	push   $0x80600c
+  802dcc:	e8 78 05 00 00       	call   803349 <mutex_unlock>
+}
+  802dd1:	89 f8                	mov    %edi,%eax
+  802dd3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802dd6:	5b                   	pop    %ebx
+  802dd7:	5e                   	pop    %esi
+  802dd8:	5f                   	pop    %edi
+  802dd9:	5d                   	pop    %ebp
+  802dda:	c3                   	ret
+		return 0;
+  802ddb:	bf 00 00 00 00       	mov    $0x0,%edi
+  802de0:	eb e2                	jmp    802dc4 <malloc+0x183>
+  802de2:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  802de6:	74 06                	je     802dee <malloc+0x1ad>
+  802de8:	89 1d 10 60 80 00    	mov    %ebx,0x806010
+	for (i = 0; i < n + 4; i += PGSIZE){
+  802dee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802df3:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  802df6:	39 fb                	cmp    %edi,%ebx
+  802df8:	73 b1                	jae    802dab <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  802dfa:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  802e00:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  802e03:	39 fe                	cmp    %edi,%esi
+  802e05:	0f 92 c0             	setb   %al
+  802e08:	0f b6 c0             	movzbl %al,%eax
+  802e0b:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  802e0e:	83 c8 07             	or     $0x7,%eax
+  802e11:	50                   	push   %eax
+  802e12:	89 d8                	mov    %ebx,%eax
+  802e14:	03 05 10 60 80 00    	add    0x806010,%eax
+  802e1a:	50                   	push   %eax
+  802e1b:	6a 00                	push   $0x0
+  802e1d:	e8 5a de ff ff       	call   800c7c <sys_page_alloc>
+  802e22:	83 c4 10             	add    $0x10,%esp
+  802e25:	85 c0                	test   %eax,%eax
+  802e27:	0f 88 55 ff ff ff    	js     802d82 <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  802e2d:	89 f3                	mov    %esi,%ebx
+  802e2f:	eb c5                	jmp    802df6 <malloc+0x1b5>
+
+00802e31 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802e31:	55                   	push   %ebp
+  802e32:	89 e5                	mov    %esp,%ebp
+  802e34:	56                   	push   %esi
+  802e35:	53                   	push   %ebx
+  802e36:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802e39:	83 ec 0c             	sub    $0xc,%esp
+  802e3c:	ff 75 08             	push   0x8(%ebp)
+  802e3f:	e8 ea e2 ff ff       	call   80112e <fd2data>
+  802e44:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802e46:	83 c4 08             	add    $0x8,%esp
+  802e49:	68 67 4d 80 00       	push   $0x804d67
+  802e4e:	53                   	push   %ebx
+  802e4f:	e8 ea d9 ff ff       	call   80083e <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802e54:	8b 46 04             	mov    0x4(%esi),%eax
+  802e57:	2b 06                	sub    (%esi),%eax
+  802e59:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802e5f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802e66:	00 00 00 
+	stat->st_dev = &devpipe;
+  802e69:	c7 83 88 00 00 00 7c 	movl   $0x80527c,0x88(%ebx)
+  802e70:	52 80 00 
+	return 0;
+}
+  802e73:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e78:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e7b:	5b                   	pop    %ebx
+  802e7c:	5e                   	pop    %esi
+  802e7d:	5d                   	pop    %ebp
+  802e7e:	c3                   	ret
+
+00802e7f <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  802e7f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802e84:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  802e88:	85 c9                	test   %ecx,%ecx
+  802e8a:	75 01                	jne    802e8d <pipewake+0xe>
+  802e8c:	c3                   	ret
+{
+  802e8d:	55                   	push   %ebp
+  802e8e:	89 e5                	mov    %esp,%ebp
+  802e90:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  802e93:	68 00 04 00 00       	push   $0x400
+  802e98:	52                   	push   %edx
+  802e99:	e8 22 e1 ff ff       	call   800fc0 <sys_futex_wake>
+  802e9e:	83 c4 10             	add    $0x10,%esp
+}
+  802ea1:	c9                   	leave
+  802ea2:	c3                   	ret
+
+00802ea3 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802ea3:	55                   	push   %ebp
+  802ea4:	89 e5                	mov    %esp,%ebp
+  802ea6:	56                   	push   %esi
+  802ea7:	53                   	push   %ebx
+  802ea8:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802eab:	83 ec 0c             	sub    $0xc,%esp
+  802eae:	56                   	push   %esi
+  802eaf:	e8 7a e2 ff ff       	call   80112e <fd2data>
+  802eb4:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  802eb6:	83 c4 08             	add    $0x8,%esp
+  802eb9:	56                   	push   %esi
+  802eba:	6a 00                	push   $0x0
+  802ebc:	e8 54 de ff ff       	call   800d15 <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  802ec1:	8d 53 04             	lea    0x4(%ebx),%edx
+  802ec4:	8d 43 08             	lea    0x8(%ebx),%eax
+  802ec7:	e8 b3 ff ff ff       	call   802e7f <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  802ecc:	8d 43 0c             	lea    0xc(%ebx),%eax
+  802ecf:	89 da                	mov    %ebx,%edx
+  802ed1:	e8 a9 ff ff ff       	call   802e7f <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  802ed6:	89 34 24             	mov    %esi,(%esp)
+  802ed9:	e8 50 e2 ff ff       	call   80112e <fd2data>
+  802ede:	83 c4 08             	add    $0x8,%esp
+  802ee1:	50                   	push   %eax
+  802ee2:	6a 00                	push   $0x0
+  802ee4:	e8 2c de ff ff       	call   800d15 <sys_page_unmap>
+}
+  802ee9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802eec:	5b                   	pop    %ebx
+  802eed:	5e                   	pop    %esi
+  802eee:	5d                   	pop    %ebp
+  802eef:	c3                   	ret
+
+00802ef0 <_pipeisclosed>:
+{
+  802ef0:	55                   	push   %ebp
+  802ef1:	89 e5                	mov    %esp,%ebp
+  802ef3:	57                   	push   %edi
+  802ef4:	56                   	push   %esi
+  802ef5:	53                   	push   %ebx
+  802ef6:	83 ec 1c             	sub    $0x1c,%esp
+  802ef9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802efc:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802efe:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  802f03:	eb 5d                	jmp    802f62 <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  802f05:	8b 15 c0 62 c0 00    	mov    0xc062c0,%edx
+		n = thisenv->env_runs;
+  802f0b:	8b 02                	mov    (%edx),%eax
+  802f0d:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802f10:	83 ec 0c             	sub    $0xc,%esp
+  802f13:	ff 75 e0             	push   -0x20(%ebp)
+  802f16:	e8 42 15 00 00       	call   80445d <pageref>
+  802f1b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802f1e:	89 3c 24             	mov    %edi,(%esp)
+  802f21:	e8 37 15 00 00       	call   80445d <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  802f26:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802f28:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  802f2e:	83 c4 10             	add    $0x10,%esp
+  802f31:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  802f37:	77 15                	ja     802f4e <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802f39:	89 f2                	mov    %esi,%edx
+  802f3b:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  802f3d:	c1 ea 10             	shr    $0x10,%edx
+  802f40:	74 0c                	je     802f4e <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802f42:	c1 e2 10             	shl    $0x10,%edx
+  802f45:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  802f4a:	29 d1                	sub    %edx,%ecx
+  802f4c:	eb 06                	jmp    802f54 <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  802f4e:	8b 0d c0 62 c0 00    	mov    0xc062c0,%ecx
+		nn = thisenv->env_runs;
+  802f54:	8b 11                	mov    (%ecx),%edx
+  802f56:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  802f59:	39 d3                	cmp    %edx,%ebx
+  802f5b:	74 6e                	je     802fcb <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  802f5d:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802f60:	74 24                	je     802f86 <_pipeisclosed+0x96>
+  802f62:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802f64:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802f6a:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802f6f:	77 94                	ja     802f05 <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802f71:	89 f0                	mov    %esi,%eax
+  802f73:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  802f75:	c1 e8 10             	shr    $0x10,%eax
+  802f78:	74 8b                	je     802f05 <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802f7a:	c1 e0 10             	shl    $0x10,%eax
+  802f7d:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802f82:	29 c2                	sub    %eax,%edx
+  802f84:	eb 85                	jmp    802f0b <_pipeisclosed+0x1b>
+  802f86:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802f88:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802f8e:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802f93:	77 18                	ja     802fad <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802f95:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802f9a:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  802f9c:	c1 e8 10             	shr    $0x10,%eax
+  802f9f:	74 0c                	je     802fad <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802fa1:	c1 e0 10             	shl    $0x10,%eax
+  802fa4:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802fa9:	29 c2                	sub    %eax,%edx
+  802fab:	eb 06                	jmp    802fb3 <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  802fad:	8b 15 c0 62 c0 00    	mov    0xc062c0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802fb3:	8b 02                	mov    (%edx),%eax
+  802fb5:	8b 40 58             	mov    0x58(%eax),%eax
+  802fb8:	6a 01                	push   $0x1
+  802fba:	50                   	push   %eax
+  802fbb:	53                   	push   %ebx
+  802fbc:	68 6e 4d 80 00       	push   $0x804d6e
+  802fc1:	e8 94 d2 ff ff       	call   80025a <cprintf>
+  802fc6:	83 c4 10             	add    $0x10,%esp
+  802fc9:	eb 97                	jmp    802f62 <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  802fcb:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802fce:	0f 94 c0             	sete   %al
+  802fd1:	0f b6 c0             	movzbl %al,%eax
+}
+  802fd4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fd7:	5b                   	pop    %ebx
+  802fd8:	5e                   	pop    %esi
+  802fd9:	5f                   	pop    %edi
+  802fda:	5d                   	pop    %ebp
+  802fdb:	c3                   	ret
+
+00802fdc <devpipe_write>:
+{
+  802fdc:	55                   	push   %ebp
+  802fdd:	89 e5                	mov    %esp,%ebp
+  802fdf:	57                   	push   %edi
+  802fe0:	56                   	push   %esi
+  802fe1:	53                   	push   %ebx
+  802fe2:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802fe5:	ff 75 08             	push   0x8(%ebp)
+  802fe8:	e8 41 e1 ff ff       	call   80112e <fd2data>
+  802fed:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802fef:	83 c4 10             	add    $0x10,%esp
+  802ff2:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  802ff9:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  802ffc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802fff:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803002:	0f 84 96 00 00 00    	je     80309e <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  803008:	8d 73 08             	lea    0x8(%ebx),%esi
+  80300b:	eb 32                	jmp    80303f <devpipe_write+0x63>
+  80300d:	89 fa                	mov    %edi,%edx
+  80300f:	89 f0                	mov    %esi,%eax
+  803011:	e8 69 fe ff ff       	call   802e7f <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  803016:	8b 43 04             	mov    0x4(%ebx),%eax
+  803019:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  80301c:	ba 01 00 00 00       	mov    $0x1,%edx
+  803021:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  803026:	83 ec 04             	sub    $0x4,%esp
+  803029:	6a 0a                	push   $0xa
+  80302b:	50                   	push   %eax
+  80302c:	53                   	push   %ebx
+  80302d:	e8 5f df ff ff       	call   800f91 <sys_futex_wait>
+  803032:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803037:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  80303c:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80303f:	8b 43 04             	mov    0x4(%ebx),%eax
+  803042:	8b 0b                	mov    (%ebx),%ecx
+  803044:	8d 51 20             	lea    0x20(%ecx),%edx
+  803047:	39 d0                	cmp    %edx,%eax
+  803049:	72 1b                	jb     803066 <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  80304b:	89 da                	mov    %ebx,%edx
+  80304d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803050:	e8 9b fe ff ff       	call   802ef0 <_pipeisclosed>
+  803055:	85 c0                	test   %eax,%eax
+  803057:	74 b4                	je     80300d <devpipe_write+0x31>
+				return 0;
+  803059:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80305e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803061:	5b                   	pop    %ebx
+  803062:	5e                   	pop    %esi
+  803063:	5f                   	pop    %edi
+  803064:	5d                   	pop    %ebp
+  803065:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803066:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803069:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80306c:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  803070:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  803073:	89 c2                	mov    %eax,%edx
+  803075:	c1 fa 1f             	sar    $0x1f,%edx
+  803078:	89 d1                	mov    %edx,%ecx
+  80307a:	c1 e9 1b             	shr    $0x1b,%ecx
+  80307d:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  803080:	83 e2 1f             	and    $0x1f,%edx
+  803083:	29 ca                	sub    %ecx,%edx
+  803085:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  803089:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  80308d:	83 c0 01             	add    $0x1,%eax
+  803090:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  803093:	83 c6 01             	add    $0x1,%esi
+  803096:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803099:	e9 5e ff ff ff       	jmp    802ffc <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  80309e:	8d 53 04             	lea    0x4(%ebx),%edx
+  8030a1:	8d 43 08             	lea    0x8(%ebx),%eax
+  8030a4:	e8 d6 fd ff ff       	call   802e7f <pipewake>
+	return i;
+  8030a9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8030ac:	eb b0                	jmp    80305e <devpipe_write+0x82>
+
+008030ae <devpipe_read>:
+{
+  8030ae:	55                   	push   %ebp
+  8030af:	89 e5                	mov    %esp,%ebp
+  8030b1:	57                   	push   %edi
+  8030b2:	56                   	push   %esi
+  8030b3:	53                   	push   %ebx
+  8030b4:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  8030b7:	ff 75 08             	push   0x8(%ebp)
+  8030ba:	e8 6f e0 ff ff       	call   80112e <fd2data>
+  8030bf:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8030c1:	83 c4 10             	add    $0x10,%esp
+  8030c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8030c9:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8030cc:	74 6c                	je     80313a <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  8030ce:	8d 7b 04             	lea    0x4(%ebx),%edi
+  8030d1:	eb 25                	jmp    8030f8 <devpipe_read+0x4a>
+  8030d3:	8b 13                	mov    (%ebx),%edx
+  8030d5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8030da:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  8030df:	83 ec 04             	sub    $0x4,%esp
+  8030e2:	6a 0a                	push   $0xa
+  8030e4:	52                   	push   %edx
+  8030e5:	57                   	push   %edi
+  8030e6:	e8 a6 de ff ff       	call   800f91 <sys_futex_wait>
+  8030eb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8030f0:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  8030f5:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  8030f8:	8b 03                	mov    (%ebx),%eax
+  8030fa:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8030fd:	75 19                	jne    803118 <devpipe_read+0x6a>
+			if (i > 0)
+  8030ff:	85 f6                	test   %esi,%esi
+  803101:	75 3a                	jne    80313d <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  803103:	89 da                	mov    %ebx,%edx
+  803105:	8b 45 08             	mov    0x8(%ebp),%eax
+  803108:	e8 e3 fd ff ff       	call   802ef0 <_pipeisclosed>
+  80310d:	85 c0                	test   %eax,%eax
+  80310f:	74 c2                	je     8030d3 <devpipe_read+0x25>
+				return 0;
+  803111:	b8 00 00 00 00       	mov    $0x0,%eax
+  803116:	eb 31                	jmp    803149 <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803118:	89 c1                	mov    %eax,%ecx
+  80311a:	c1 f9 1f             	sar    $0x1f,%ecx
+  80311d:	c1 e9 1b             	shr    $0x1b,%ecx
+  803120:	01 c8                	add    %ecx,%eax
+  803122:	83 e0 1f             	and    $0x1f,%eax
+  803125:	29 c8                	sub    %ecx,%eax
+  803127:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  80312c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80312f:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  803132:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  803135:	83 c6 01             	add    $0x1,%esi
+  803138:	eb 8f                	jmp    8030c9 <devpipe_read+0x1b>
+out:
+  80313a:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  80313d:	8d 43 0c             	lea    0xc(%ebx),%eax
+  803140:	89 da                	mov    %ebx,%edx
+  803142:	e8 38 fd ff ff       	call   802e7f <pipewake>
+	return i;
+  803147:	89 f0                	mov    %esi,%eax
+}
+  803149:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80314c:	5b                   	pop    %ebx
+  80314d:	5e                   	pop    %esi
+  80314e:	5f                   	pop    %edi
+  80314f:	5d                   	pop    %ebp
+  803150:	c3                   	ret
+
+00803151 <pipe>:
+{
+  803151:	55                   	push   %ebp
+  803152:	89 e5                	mov    %esp,%ebp
+  803154:	56                   	push   %esi
+  803155:	53                   	push   %ebx
+  803156:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803159:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80315c:	50                   	push   %eax
+  80315d:	e8 e3 df ff ff       	call   801145 <fd_alloc>
+  803162:	89 c3                	mov    %eax,%ebx
+  803164:	83 c4 10             	add    $0x10,%esp
+  803167:	85 c0                	test   %eax,%eax
+  803169:	0f 88 23 01 00 00    	js     803292 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80316f:	83 ec 04             	sub    $0x4,%esp
+  803172:	68 07 04 00 00       	push   $0x407
+  803177:	ff 75 f4             	push   -0xc(%ebp)
+  80317a:	6a 00                	push   $0x0
+  80317c:	e8 fb da ff ff       	call   800c7c <sys_page_alloc>
+  803181:	89 c3                	mov    %eax,%ebx
+  803183:	83 c4 10             	add    $0x10,%esp
+  803186:	85 c0                	test   %eax,%eax
+  803188:	0f 88 04 01 00 00    	js     803292 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80318e:	83 ec 0c             	sub    $0xc,%esp
+  803191:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803194:	50                   	push   %eax
+  803195:	e8 ab df ff ff       	call   801145 <fd_alloc>
+  80319a:	89 c3                	mov    %eax,%ebx
+  80319c:	83 c4 10             	add    $0x10,%esp
+  80319f:	85 c0                	test   %eax,%eax
+  8031a1:	0f 88 db 00 00 00    	js     803282 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8031a7:	83 ec 04             	sub    $0x4,%esp
+  8031aa:	68 07 04 00 00       	push   $0x407
+  8031af:	ff 75 f0             	push   -0x10(%ebp)
+  8031b2:	6a 00                	push   $0x0
+  8031b4:	e8 c3 da ff ff       	call   800c7c <sys_page_alloc>
+  8031b9:	89 c3                	mov    %eax,%ebx
+  8031bb:	83 c4 10             	add    $0x10,%esp
+  8031be:	85 c0                	test   %eax,%eax
+  8031c0:	0f 88 bc 00 00 00    	js     803282 <pipe+0x131>
+	va = fd2data(fd0);
+  8031c6:	83 ec 0c             	sub    $0xc,%esp
+  8031c9:	ff 75 f4             	push   -0xc(%ebp)
+  8031cc:	e8 5d df ff ff       	call   80112e <fd2data>
+  8031d1:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8031d3:	83 c4 0c             	add    $0xc,%esp
+  8031d6:	68 07 04 00 00       	push   $0x407
+  8031db:	50                   	push   %eax
+  8031dc:	6a 00                	push   $0x0
+  8031de:	e8 99 da ff ff       	call   800c7c <sys_page_alloc>
+  8031e3:	89 c3                	mov    %eax,%ebx
+  8031e5:	83 c4 10             	add    $0x10,%esp
+  8031e8:	85 c0                	test   %eax,%eax
+  8031ea:	0f 88 82 00 00 00    	js     803272 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8031f0:	83 ec 0c             	sub    $0xc,%esp
+  8031f3:	ff 75 f0             	push   -0x10(%ebp)
+  8031f6:	e8 33 df ff ff       	call   80112e <fd2data>
+  8031fb:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803202:	50                   	push   %eax
+  803203:	6a 00                	push   $0x0
+  803205:	56                   	push   %esi
+  803206:	6a 00                	push   $0x0
+  803208:	e8 bc da ff ff       	call   800cc9 <sys_page_map>
+  80320d:	89 c3                	mov    %eax,%ebx
+  80320f:	83 c4 20             	add    $0x20,%esp
+  803212:	85 c0                	test   %eax,%eax
+  803214:	78 4e                	js     803264 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803216:	a1 7c 52 80 00       	mov    0x80527c,%eax
+  80321b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80321e:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803220:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803223:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80322a:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80322d:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80322f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803232:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803239:	83 ec 0c             	sub    $0xc,%esp
+  80323c:	ff 75 f4             	push   -0xc(%ebp)
+  80323f:	e8 da de ff ff       	call   80111e <fd2num>
+  803244:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803247:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803249:	83 c4 04             	add    $0x4,%esp
+  80324c:	ff 75 f0             	push   -0x10(%ebp)
+  80324f:	e8 ca de ff ff       	call   80111e <fd2num>
+  803254:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803257:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80325a:	83 c4 10             	add    $0x10,%esp
+  80325d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803262:	eb 2e                	jmp    803292 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803264:	83 ec 08             	sub    $0x8,%esp
+  803267:	56                   	push   %esi
+  803268:	6a 00                	push   $0x0
+  80326a:	e8 a6 da ff ff       	call   800d15 <sys_page_unmap>
+  80326f:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803272:	83 ec 08             	sub    $0x8,%esp
+  803275:	ff 75 f0             	push   -0x10(%ebp)
+  803278:	6a 00                	push   $0x0
+  80327a:	e8 96 da ff ff       	call   800d15 <sys_page_unmap>
+  80327f:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803282:	83 ec 08             	sub    $0x8,%esp
+  803285:	ff 75 f4             	push   -0xc(%ebp)
+  803288:	6a 00                	push   $0x0
+  80328a:	e8 86 da ff ff       	call   800d15 <sys_page_unmap>
+  80328f:	83 c4 10             	add    $0x10,%esp
+}
+  803292:	89 d8                	mov    %ebx,%eax
+  803294:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803297:	5b                   	pop    %ebx
+  803298:	5e                   	pop    %esi
+  803299:	5d                   	pop    %ebp
+  80329a:	c3                   	ret
+
+0080329b <pipeisclosed>:
+{
+  80329b:	55                   	push   %ebp
+  80329c:	89 e5                	mov    %esp,%ebp
+  80329e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8032a1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8032a4:	50                   	push   %eax
+  8032a5:	ff 75 08             	push   0x8(%ebp)
+  8032a8:	e8 ee de ff ff       	call   80119b <fd_lookup>
+  8032ad:	83 c4 10             	add    $0x10,%esp
+  8032b0:	85 c0                	test   %eax,%eax
+  8032b2:	78 18                	js     8032cc <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8032b4:	83 ec 0c             	sub    $0xc,%esp
+  8032b7:	ff 75 f4             	push   -0xc(%ebp)
+  8032ba:	e8 6f de ff ff       	call   80112e <fd2data>
+  8032bf:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8032c1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8032c4:	e8 27 fc ff ff       	call   802ef0 <_pipeisclosed>
+  8032c9:	83 c4 10             	add    $0x10,%esp
+}
+  8032cc:	c9                   	leave
+  8032cd:	c3                   	ret
+
+008032ce <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  8032ce:	55                   	push   %ebp
+  8032cf:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  8032d1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032d4:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8032da:	5d                   	pop    %ebp
+  8032db:	c3                   	ret
+
+008032dc <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  8032dc:	55                   	push   %ebp
+  8032dd:	89 e5                	mov    %esp,%ebp
+  8032df:	56                   	push   %esi
+  8032e0:	53                   	push   %ebx
+  8032e1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  8032e4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032e9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8032ee:	89 d0                	mov    %edx,%eax
+  8032f0:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  8032f4:	85 c0                	test   %eax,%eax
+  8032f6:	74 2d                	je     803325 <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  8032f8:	83 f8 02             	cmp    $0x2,%eax
+  8032fb:	74 08                	je     803305 <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  8032fd:	b8 02 00 00 00       	mov    $0x2,%eax
+  803302:	f0 87 03             	lock xchg %eax,(%ebx)
+  803305:	be 02 00 00 00       	mov    $0x2,%esi
+  80330a:	eb 15                	jmp    803321 <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  80330c:	83 ec 04             	sub    $0x4,%esp
+  80330f:	6a 00                	push   $0x0
+  803311:	6a 02                	push   $0x2
+  803313:	53                   	push   %ebx
+  803314:	e8 78 dc ff ff       	call   800f91 <sys_futex_wait>
+  803319:	89 f0                	mov    %esi,%eax
+  80331b:	f0 87 03             	lock xchg %eax,(%ebx)
+  80331e:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  803321:	85 c0                	test   %eax,%eax
+  803323:	75 e7                	jne    80330c <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  803325:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803328:	5b                   	pop    %ebx
+  803329:	5e                   	pop    %esi
+  80332a:	5d                   	pop    %ebp
+  80332b:	c3                   	ret
+
+0080332c <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  80332c:	55                   	push   %ebp
+  80332d:	89 e5                	mov    %esp,%ebp
+  80332f:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803332:	b8 00 00 00 00       	mov    $0x0,%eax
+  803337:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80333c:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  803340:	f7 d8                	neg    %eax
+  803342:	19 c0                	sbb    %eax,%eax
+  803344:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  803347:	5d                   	pop    %ebp
+  803348:	c3                   	ret
+
+00803349 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  803349:	55                   	push   %ebp
+  80334a:	89 e5                	mov    %esp,%ebp
+  80334c:	83 ec 08             	sub    $0x8,%esp
+  80334f:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  803352:	b8 00 00 00 00       	mov    $0x0,%eax
+  803357:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  80335a:	83 f8 02             	cmp    $0x2,%eax
+  80335d:	74 02                	je     803361 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  80335f:	c9                   	leave
+  803360:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  803361:	83 ec 08             	sub    $0x8,%esp
+  803364:	6a 01                	push   $0x1
+  803366:	52                   	push   %edx
+  803367:	e8 54 dc ff ff       	call   800fc0 <sys_futex_wake>
+  80336c:	83 c4 10             	add    $0x10,%esp
+}
+  80336f:	eb ee                	jmp    80335f <mutex_unlock+0x16>
+
+00803371 <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  803371:	55                   	push   %ebp
+  803372:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  803374:	8b 45 08             	mov    0x8(%ebp),%eax
+  803377:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  80337d:	5d                   	pop    %ebp
+  80337e:	c3                   	ret
+
+0080337f <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  80337f:	55                   	push   %ebp
+  803380:	89 e5                	mov    %esp,%ebp
+  803382:	57                   	push   %edi
+  803383:	56                   	push   %esi
+  803384:	53                   	push   %ebx
+  803385:	83 ec 18             	sub    $0x18,%esp
+  803388:	8b 75 08             	mov    0x8(%ebp),%esi
+  80338b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  80338e:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  803390:	53                   	push   %ebx
+  803391:	e8 b3 ff ff ff       	call   803349 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  803396:	83 c4 0c             	add    $0xc,%esp
+  803399:	ff 75 10             	push   0x10(%ebp)
+  80339c:	57                   	push   %edi
+  80339d:	56                   	push   %esi
+  80339e:	e8 ee db ff ff       	call   800f91 <sys_futex_wait>
+  8033a3:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  8033a5:	83 c4 10             	add    $0x10,%esp
+  8033a8:	be 02 00 00 00       	mov    $0x2,%esi
+  8033ad:	eb 10                	jmp    8033bf <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  8033af:	83 ec 04             	sub    $0x4,%esp
+  8033b2:	6a 00                	push   $0x0
+  8033b4:	6a 02                	push   $0x2
+  8033b6:	53                   	push   %ebx
+  8033b7:	e8 d5 db ff ff       	call   800f91 <sys_futex_wait>
+  8033bc:	83 c4 10             	add    $0x10,%esp
+  8033bf:	89 f0                	mov    %esi,%eax
+  8033c1:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  8033c4:	85 c0                	test   %eax,%eax
+  8033c6:	75 e7                	jne    8033af <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  8033c8:	83 ff ec             	cmp    $0xffffffec,%edi
+  8033cb:	74 05                	je     8033d2 <cond_timedwait+0x53>
+  8033cd:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  8033d2:	89 f8                	mov    %edi,%eax
+  8033d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033d7:	5b                   	pop    %ebx
+  8033d8:	5e                   	pop    %esi
+  8033d9:	5f                   	pop    %edi
+  8033da:	5d                   	pop    %ebp
+  8033db:	c3                   	ret
+
+008033dc <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  8033dc:	55                   	push   %ebp
+  8033dd:	89 e5                	mov    %esp,%ebp
+  8033df:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  8033e2:	6a 00                	push   $0x0
+  8033e4:	ff 75 0c             	push   0xc(%ebp)
+  8033e7:	ff 75 08             	push   0x8(%ebp)
+  8033ea:	e8 90 ff ff ff       	call   80337f <cond_timedwait>
+}
+  8033ef:	83 c4 10             	add    $0x10,%esp
+  8033f2:	c9                   	leave
+  8033f3:	c3                   	ret
+
+008033f4 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  8033f4:	55                   	push   %ebp
+  8033f5:	89 e5                	mov    %esp,%ebp
+  8033f7:	83 ec 10             	sub    $0x10,%esp
+  8033fa:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  8033fd:	ba 01 00 00 00       	mov    $0x1,%edx
+  803402:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  803406:	6a 01                	push   $0x1
+  803408:	50                   	push   %eax
+  803409:	e8 b2 db ff ff       	call   800fc0 <sys_futex_wake>
+}
+  80340e:	83 c4 10             	add    $0x10,%esp
+  803411:	c9                   	leave
+  803412:	c3                   	ret
+
+00803413 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  803413:	55                   	push   %ebp
+  803414:	89 e5                	mov    %esp,%ebp
+  803416:	83 ec 10             	sub    $0x10,%esp
+  803419:	8b 45 08             	mov    0x8(%ebp),%eax
+  80341c:	ba 01 00 00 00       	mov    $0x1,%edx
+  803421:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  803425:	68 00 04 00 00       	push   $0x400
+  80342a:	50                   	push   %eax
+  80342b:	e8 90 db ff ff       	call   800fc0 <sys_futex_wake>
+}
+  803430:	83 c4 10             	add    $0x10,%esp
+  803433:	c9                   	leave
+  803434:	c3                   	ret
+
+00803435 <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  803435:	55                   	push   %ebp
+  803436:	89 e5                	mov    %esp,%ebp
+  803438:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  80343b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80343e:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  803440:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  803447:	5d                   	pop    %ebp
+  803448:	c3                   	ret
+
+00803449 <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  803449:	55                   	push   %ebp
+  80344a:	89 e5                	mov    %esp,%ebp
+  80344c:	53                   	push   %ebx
+  80344d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  803450:	8b 11                	mov    (%ecx),%edx
+  803452:	85 d2                	test   %edx,%edx
+  803454:	74 14                	je     80346a <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  803456:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803459:	89 d0                	mov    %edx,%eax
+  80345b:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  80345f:	39 c2                	cmp    %eax,%edx
+  803461:	75 ed                	jne    803450 <sem_trywait+0x7>
+			return 0;
+  803463:	b8 00 00 00 00       	mov    $0x0,%eax
+  803468:	eb 05                	jmp    80346f <sem_trywait+0x26>
+	return -E_AGAIN;
+  80346a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  80346f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803472:	c9                   	leave
+  803473:	c3                   	ret
+
+00803474 <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  803474:	55                   	push   %ebp
+  803475:	89 e5                	mov    %esp,%ebp
+  803477:	57                   	push   %edi
+  803478:	56                   	push   %esi
+  803479:	53                   	push   %ebx
+  80347a:	83 ec 1c             	sub    $0x1c,%esp
+  80347d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803480:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  803483:	e8 81 da ff ff       	call   800f09 <sys_time_msec>
+  803488:	01 f8                	add    %edi,%eax
+  80348a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  80348d:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  803492:	eb 28                	jmp    8034bc <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  803494:	b8 01 00 00 00       	mov    $0x1,%eax
+  803499:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  80349e:	83 ec 04             	sub    $0x4,%esp
+  8034a1:	56                   	push   %esi
+  8034a2:	6a 00                	push   $0x0
+  8034a4:	53                   	push   %ebx
+  8034a5:	e8 e7 da ff ff       	call   800f91 <sys_futex_wait>
+  8034aa:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8034af:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  8034b4:	83 c4 10             	add    $0x10,%esp
+  8034b7:	83 f8 ec             	cmp    $0xffffffec,%eax
+  8034ba:	74 2e                	je     8034ea <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  8034bc:	83 ec 0c             	sub    $0xc,%esp
+  8034bf:	53                   	push   %ebx
+  8034c0:	e8 84 ff ff ff       	call   803449 <sem_trywait>
+  8034c5:	83 c4 10             	add    $0x10,%esp
+  8034c8:	85 c0                	test   %eax,%eax
+  8034ca:	79 19                	jns    8034e5 <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  8034cc:	85 ff                	test   %edi,%edi
+  8034ce:	74 c4                	je     803494 <sem_timedwait+0x20>
+  8034d0:	e8 34 da ff ff       	call   800f09 <sys_time_msec>
+  8034d5:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8034d8:	29 c6                	sub    %eax,%esi
+  8034da:	85 f6                	test   %esi,%esi
+  8034dc:	7f b6                	jg     803494 <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  8034de:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  8034e3:	eb 05                	jmp    8034ea <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  8034e5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8034ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034ed:	5b                   	pop    %ebx
+  8034ee:	5e                   	pop    %esi
+  8034ef:	5f                   	pop    %edi
+  8034f0:	5d                   	pop    %ebp
+  8034f1:	c3                   	ret
+
+008034f2 <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  8034f2:	55                   	push   %ebp
+  8034f3:	89 e5                	mov    %esp,%ebp
+  8034f5:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  8034f8:	6a 00                	push   $0x0
+  8034fa:	ff 75 08             	push   0x8(%ebp)
+  8034fd:	e8 72 ff ff ff       	call   803474 <sem_timedwait>
+}
+  803502:	83 c4 10             	add    $0x10,%esp
+  803505:	c9                   	leave
+  803506:	c3                   	ret
+
+00803507 <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  803507:	55                   	push   %ebp
+  803508:	89 e5                	mov    %esp,%ebp
+  80350a:	83 ec 08             	sub    $0x8,%esp
+  80350d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803510:	ba 01 00 00 00       	mov    $0x1,%edx
+  803515:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  803519:	8b 50 04             	mov    0x4(%eax),%edx
+  80351c:	85 d2                	test   %edx,%edx
+  80351e:	75 02                	jne    803522 <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  803520:	c9                   	leave
+  803521:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  803522:	83 ec 08             	sub    $0x8,%esp
+  803525:	6a 01                	push   $0x1
+  803527:	50                   	push   %eax
+  803528:	e8 93 da ff ff       	call   800fc0 <sys_futex_wake>
+  80352d:	83 c4 10             	add    $0x10,%esp
+}
+  803530:	eb ee                	jmp    803520 <sem_post+0x19>
+
+00803532 <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  803532:	55                   	push   %ebp
+  803533:	89 e5                	mov    %esp,%ebp
+  803535:	57                   	push   %edi
+  803536:	56                   	push   %esi
+  803537:	53                   	push   %ebx
+  803538:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  80353b:	68 20 60 80 00       	push   $0x806020
+  803540:	e8 97 fd ff ff       	call   8032dc <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  803545:	a1 44 60 80 00       	mov    0x806044,%eax
+  80354a:	83 c4 10             	add    $0x10,%esp
+  80354d:	85 c0                	test   %eax,%eax
+  80354f:	75 19                	jne    80356a <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  803551:	a1 c0 62 c0 00       	mov    0xc062c0,%eax
+  803556:	8b 00                	mov    (%eax),%eax
+  803558:	8b 40 48             	mov    0x48(%eax),%eax
+  80355b:	a3 40 60 80 00       	mov    %eax,0x806040
+		threads[0].th_state = PTH_RUNNING;
+  803560:	c7 05 44 60 80 00 01 	movl   $0x1,0x806044
+  803567:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  80356a:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  80356f:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803572:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803579:	8b 40 04             	mov    0x4(%eax),%eax
+  80357c:	85 c0                	test   %eax,%eax
+  80357e:	0f 84 e4 00 00 00    	je     803668 <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803584:	83 c3 01             	add    $0x1,%ebx
+  803587:	83 fb 20             	cmp    $0x20,%ebx
+  80358a:	75 e3                	jne    80356f <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  80358c:	83 ec 0c             	sub    $0xc,%esp
+  80358f:	68 20 60 80 00       	push   $0x806020
+  803594:	e8 b0 fd ff ff       	call   803349 <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  803599:	83 c4 10             	add    $0x10,%esp
+  80359c:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  8035a1:	e9 b8 00 00 00       	jmp    80365e <pthread_create+0x12c>
+  8035a6:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  8035a9:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  8035ac:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  8035ae:	39 f3                	cmp    %esi,%ebx
+  8035b0:	73 16                	jae    8035c8 <pthread_create+0x96>
+		va -= PGSIZE;
+  8035b2:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  8035b8:	83 ec 08             	sub    $0x8,%esp
+  8035bb:	56                   	push   %esi
+  8035bc:	6a 00                	push   $0x0
+  8035be:	e8 52 d7 ff ff       	call   800d15 <sys_page_unmap>
+  8035c3:	83 c4 10             	add    $0x10,%esp
+  8035c6:	eb e6                	jmp    8035ae <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  8035c8:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8035cb:	83 ec 08             	sub    $0x8,%esp
+  8035ce:	ff 75 e4             	push   -0x1c(%ebp)
+  8035d1:	6a 00                	push   $0x0
+  8035d3:	e8 3d d7 ff ff       	call   800d15 <sys_page_unmap>
+	return r;
+  8035d8:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  8035db:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8035de:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  8035e5:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  8035ec:	eb 70                	jmp    80365e <pthread_create+0x12c>
+	th->th_fn = fn;
+  8035ee:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8035f1:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  8035f8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8035fb:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  8035fe:	8b 55 10             	mov    0x10(%ebp),%edx
+  803601:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  803604:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  80360b:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  803610:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803613:	29 c8                	sub    %ecx,%eax
+  803615:	85 db                	test   %ebx,%ebx
+  803617:	0f 44 05 c0 62 c0 00 	cmove  0xc062c0,%eax
+	*--esp = t;
+  80361e:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  803621:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803628:	83 ec 04             	sub    $0x4,%esp
+  80362b:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803630:	29 ca                	sub    %ecx,%edx
+  803632:	52                   	push   %edx
+	*--esp = 0;
+  803633:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803636:	50                   	push   %eax
+  803637:	68 8f 38 80 00       	push   $0x80388f
+  80363c:	e8 24 da ff ff       	call   801065 <sys_thread_create>
+  803641:	89 c7                	mov    %eax,%edi
+  803643:	83 c4 10             	add    $0x10,%esp
+  803646:	85 c0                	test   %eax,%eax
+  803648:	78 91                	js     8035db <pthread_create+0xa9>
+	th->th_env = id;
+  80364a:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80364d:	89 3c 85 40 60 80 00 	mov    %edi,0x806040(,%eax,4)
+	*tp = t;
+  803654:	8b 45 08             	mov    0x8(%ebp),%eax
+  803657:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  803659:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  80365e:	89 f8                	mov    %edi,%eax
+  803660:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803663:	5b                   	pop    %ebx
+  803664:	5e                   	pop    %esi
+  803665:	5f                   	pop    %edi
+  803666:	5d                   	pop    %ebp
+  803667:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  803668:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80366b:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803672:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  803679:	83 ec 0c             	sub    $0xc,%esp
+  80367c:	68 20 60 80 00       	push   $0x806020
+  803681:	e8 c3 fc ff ff       	call   803349 <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  803686:	89 d9                	mov    %ebx,%ecx
+  803688:	c1 e1 10             	shl    $0x10,%ecx
+  80368b:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  80368e:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  803693:	29 c8                	sub    %ecx,%eax
+  803695:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  803698:	c1 e8 16             	shr    $0x16,%eax
+  80369b:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8036a2:	83 c4 10             	add    $0x10,%esp
+  8036a5:	a8 01                	test   $0x1,%al
+  8036a7:	74 15                	je     8036be <pthread_create+0x18c>
+  8036a9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8036ac:	c1 e8 0c             	shr    $0xc,%eax
+  8036af:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8036b6:	a8 01                	test   $0x1,%al
+  8036b8:	0f 85 30 ff ff ff    	jne    8035ee <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  8036be:	83 ec 04             	sub    $0x4,%esp
+  8036c1:	6a 07                	push   $0x7
+  8036c3:	ff 75 e4             	push   -0x1c(%ebp)
+  8036c6:	6a 00                	push   $0x0
+  8036c8:	e8 af d5 ff ff       	call   800c7c <sys_page_alloc>
+  8036cd:	89 c7                	mov    %eax,%edi
+  8036cf:	83 c4 10             	add    $0x10,%esp
+  8036d2:	85 c0                	test   %eax,%eax
+  8036d4:	0f 88 01 ff ff ff    	js     8035db <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  8036da:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  8036df:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8036e2:	29 d0                	sub    %edx,%eax
+  8036e4:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8036e7:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  8036e9:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  8036ee:	29 d0                	sub    %edx,%eax
+  8036f0:	89 c7                	mov    %eax,%edi
+  8036f2:	39 fe                	cmp    %edi,%esi
+  8036f4:	0f 83 f4 fe ff ff    	jae    8035ee <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  8036fa:	83 ec 04             	sub    $0x4,%esp
+  8036fd:	6a 07                	push   $0x7
+  8036ff:	56                   	push   %esi
+  803700:	6a 00                	push   $0x0
+  803702:	e8 75 d5 ff ff       	call   800c7c <sys_page_alloc>
+  803707:	83 c4 10             	add    $0x10,%esp
+  80370a:	85 c0                	test   %eax,%eax
+  80370c:	0f 88 94 fe ff ff    	js     8035a6 <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803712:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803718:	eb d8                	jmp    8036f2 <pthread_create+0x1c0>
+
+0080371a <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  80371a:	55                   	push   %ebp
+  80371b:	89 e5                	mov    %esp,%ebp
+  80371d:	57                   	push   %edi
+  80371e:	56                   	push   %esi
+  80371f:	53                   	push   %ebx
+  803720:	83 ec 0c             	sub    $0xc,%esp
+  803723:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  803726:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  803729:	83 f8 1e             	cmp    $0x1e,%eax
+  80372c:	0f 87 c7 00 00 00    	ja     8037f9 <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  803732:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803734:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80373a:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80373f:	77 12                	ja     803753 <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803741:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803746:	29 d0                	sub    %edx,%eax
+  803748:	c1 e8 10             	shr    $0x10,%eax
+  80374b:	39 c3                	cmp    %eax,%ebx
+  80374d:	0f 84 ad 00 00 00    	je     803800 <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803753:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803756:	8d 3c 85 44 60 80 00 	lea    0x806044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  80375d:	8d 34 85 40 60 80 00 	lea    0x806040(,%eax,4),%esi
+  803764:	eb 10                	jmp    803776 <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803766:	83 ec 04             	sub    $0x4,%esp
+  803769:	6a 00                	push   $0x0
+  80376b:	6a 01                	push   $0x1
+  80376d:	57                   	push   %edi
+  80376e:	e8 1e d8 ff ff       	call   800f91 <sys_futex_wait>
+  803773:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  803776:	8b 46 04             	mov    0x4(%esi),%eax
+  803779:	83 f8 01             	cmp    $0x1,%eax
+  80377c:	74 e8                	je     803766 <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  80377e:	83 f8 02             	cmp    $0x2,%eax
+  803781:	0f 85 80 00 00 00    	jne    803807 <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  803787:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  80378a:	c1 e6 02             	shl    $0x2,%esi
+  80378d:	eb 05                	jmp    803794 <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  80378f:	e8 bc d4 ff ff       	call   800c50 <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  803794:	8b 8e 40 60 80 00    	mov    0x806040(%esi),%ecx
+  80379a:	89 ca                	mov    %ecx,%edx
+  80379c:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8037a2:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8037a5:	c1 e0 04             	shl    $0x4,%eax
+  8037a8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8037ad:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  8037b0:	39 c1                	cmp    %eax,%ecx
+  8037b2:	75 12                	jne    8037c6 <pthread_join+0xac>
+  8037b4:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8037b7:	c1 e0 04             	shl    $0x4,%eax
+  8037ba:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8037bf:	8b 40 54             	mov    0x54(%eax),%eax
+  8037c2:	85 c0                	test   %eax,%eax
+  8037c4:	75 c9                	jne    80378f <pthread_join+0x75>
+	if (ret_store)
+  8037c6:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8037ca:	74 0f                	je     8037db <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  8037cc:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8037cf:	8b 04 85 50 60 80 00 	mov    0x806050(,%eax,4),%eax
+  8037d6:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8037d9:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  8037db:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8037de:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  8037e5:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  8037ec:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8037f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8037f4:	5b                   	pop    %ebx
+  8037f5:	5e                   	pop    %esi
+  8037f6:	5f                   	pop    %edi
+  8037f7:	5d                   	pop    %ebp
+  8037f8:	c3                   	ret
+		return -E_INVAL;
+  8037f9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8037fe:	eb f1                	jmp    8037f1 <pthread_join+0xd7>
+  803800:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803805:	eb ea                	jmp    8037f1 <pthread_join+0xd7>
+		return -E_INVAL;
+  803807:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80380c:	eb e3                	jmp    8037f1 <pthread_join+0xd7>
+
+0080380e <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  80380e:	55                   	push   %ebp
+  80380f:	89 e5                	mov    %esp,%ebp
+  803811:	53                   	push   %ebx
+  803812:	83 ec 04             	sub    $0x4,%esp
+  803815:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803817:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80381d:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803822:	77 0c                	ja     803830 <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803824:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803829:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  80382b:	c1 e8 10             	shr    $0x10,%eax
+  80382e:	75 0a                	jne    80383a <pthread_exit+0x2c>
+		exit();
+  803830:	e8 22 c9 ff ff       	call   800157 <exit>
+  803835:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  80383a:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  803841:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  803844:	8d 0c 8d 40 60 80 00 	lea    0x806040(,%ecx,4),%ecx
+  80384b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80384e:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  803851:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  803858:	83 ec 08             	sub    $0x8,%esp
+  80385b:	6a 20                	push   $0x20
+  80385d:	01 c2                	add    %eax,%edx
+  80385f:	8d 04 95 44 60 80 00 	lea    0x806044(,%edx,4),%eax
+  803866:	50                   	push   %eax
+  803867:	e8 54 d7 ff ff       	call   800fc0 <sys_futex_wake>
+	sys_env_destroy(0);
+  80386c:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  803873:	e8 61 d3 ff ff       	call   800bd9 <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  803878:	83 c4 0c             	add    $0xc,%esp
+  80387b:	68 86 4d 80 00       	push   $0x804d86
+  803880:	68 a5 00 00 00       	push   $0xa5
+  803885:	68 a0 4d 80 00       	push   $0x804da0
+  80388a:	e8 f0 c8 ff ff       	call   80017f <_panic>
+
+0080388f <pthread_start>:
+{
+  80388f:	55                   	push   %ebp
+  803890:	89 e5                	mov    %esp,%ebp
+  803892:	53                   	push   %ebx
+  803893:	83 ec 04             	sub    $0x4,%esp
+  803896:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  803899:	e8 86 d3 ff ff       	call   800c24 <sys_getenvid>
+  80389e:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  8038a3:	8b 15 c0 62 c0 00    	mov    0xc062c0,%edx
+	if (t == 0)
+  8038a9:	85 db                	test   %ebx,%ebx
+  8038ab:	74 0c                	je     8038b9 <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8038ad:	89 d9                	mov    %ebx,%ecx
+  8038af:	c1 e1 10             	shl    $0x10,%ecx
+  8038b2:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8038b7:	29 ca                	sub    %ecx,%edx
+  8038b9:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8038bc:	c1 e0 04             	shl    $0x4,%eax
+  8038bf:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8038c4:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  8038c6:	83 ec 0c             	sub    $0xc,%esp
+  8038c9:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  8038d0:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  8038d3:	ff 34 95 4c 60 80 00 	push   0x80604c(,%edx,4)
+  8038da:	ff 14 95 48 60 80 00 	call   *0x806048(,%edx,4)
+  8038e1:	89 04 24             	mov    %eax,(%esp)
+  8038e4:	e8 25 ff ff ff       	call   80380e <pthread_exit>
+
+008038e9 <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  8038e9:	55                   	push   %ebp
+  8038ea:	89 e5                	mov    %esp,%ebp
+  8038ec:	57                   	push   %edi
+  8038ed:	56                   	push   %esi
+  8038ee:	53                   	push   %ebx
+  8038ef:	83 ec 1c             	sub    $0x1c,%esp
+  8038f2:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8038f4:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  8038fa:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803901:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803906:	77 0d                	ja     803915 <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803908:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80390d:	29 d0                	sub    %edx,%eax
+  80390f:	c1 e8 10             	shr    $0x10,%eax
+  803912:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  803915:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80391a:	eb 2f                	jmp    80394b <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  80391c:	8b 0d c0 62 c0 00    	mov    0xc062c0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803922:	8b 01                	mov    (%ecx),%eax
+  803924:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  803927:	39 c2                	cmp    %eax,%edx
+  803929:	75 14                	jne    80393f <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  80392b:	83 ec 0c             	sub    $0xc,%esp
+  80392e:	57                   	push   %edi
+  80392f:	e8 a5 d2 ff ff       	call   800bd9 <sys_env_destroy>
+  803934:	83 c4 10             	add    $0x10,%esp
+  803937:	85 c0                	test   %eax,%eax
+  803939:	0f 88 97 00 00 00    	js     8039d6 <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  80393f:	83 c3 01             	add    $0x1,%ebx
+  803942:	83 fb 20             	cmp    $0x20,%ebx
+  803945:	0f 84 d2 00 00 00    	je     803a1d <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  80394b:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  80394e:	74 ef                	je     80393f <pthread_kill_others+0x56>
+  803950:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803953:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  80395a:	8b 40 04             	mov    0x4(%eax),%eax
+  80395d:	83 f8 01             	cmp    $0x1,%eax
+  803960:	75 dd                	jne    80393f <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  803962:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803965:	8b 3c 85 40 60 80 00 	mov    0x806040(,%eax,4),%edi
+  80396c:	89 fe                	mov    %edi,%esi
+  80396e:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  803974:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803977:	c1 e0 04             	shl    $0x4,%eax
+  80397a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80397f:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803982:	39 c7                	cmp    %eax,%edi
+  803984:	75 b9                	jne    80393f <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  803986:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803989:	c1 e0 04             	shl    $0x4,%eax
+  80398c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803991:	8b 40 54             	mov    0x54(%eax),%eax
+  803994:	85 c0                	test   %eax,%eax
+  803996:	74 a7                	je     80393f <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803998:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  80399b:	c1 e0 04             	shl    $0x4,%eax
+  80399e:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  8039a4:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8039a6:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  8039ac:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8039b1:	0f 87 65 ff ff ff    	ja     80391c <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8039b7:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8039bc:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  8039be:	c1 e8 10             	shr    $0x10,%eax
+  8039c1:	0f 84 55 ff ff ff    	je     80391c <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8039c7:	c1 e0 10             	shl    $0x10,%eax
+  8039ca:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8039cf:	29 c1                	sub    %eax,%ecx
+  8039d1:	e9 4c ff ff ff       	jmp    803922 <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  8039d6:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  8039d9:	c1 e2 04             	shl    $0x4,%edx
+  8039dc:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8039e2:	8b 52 48             	mov    0x48(%edx),%edx
+  8039e5:	39 fa                	cmp    %edi,%edx
+  8039e7:	0f 85 52 ff ff ff    	jne    80393f <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  8039ed:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  8039f0:	c1 e2 04             	shl    $0x4,%edx
+  8039f3:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8039f9:	8b 52 54             	mov    0x54(%edx),%edx
+  8039fc:	85 d2                	test   %edx,%edx
+  8039fe:	0f 84 3b ff ff ff    	je     80393f <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  803a04:	83 ec 0c             	sub    $0xc,%esp
+  803a07:	50                   	push   %eax
+  803a08:	57                   	push   %edi
+  803a09:	68 b0 4d 80 00       	push   $0x804db0
+  803a0e:	68 bb 00 00 00       	push   $0xbb
+  803a13:	68 a0 4d 80 00       	push   $0x804da0
+  803a18:	e8 62 c7 ff ff       	call   80017f <_panic>
+	}
+}
+  803a1d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a20:	5b                   	pop    %ebx
+  803a21:	5e                   	pop    %esi
+  803a22:	5f                   	pop    %edi
+  803a23:	5d                   	pop    %ebp
+  803a24:	c3                   	ret
+
+00803a25 <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  803a25:	55                   	push   %ebp
+  803a26:	89 e5                	mov    %esp,%ebp
+  803a28:	53                   	push   %ebx
+  803a29:	83 ec 04             	sub    $0x4,%esp
+  803a2c:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803a2e:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  803a34:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803a3a:	0f 87 85 00 00 00    	ja     803ac5 <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803a40:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  803a45:	29 c3                	sub    %eax,%ebx
+  803a47:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  803a4a:	83 ec 04             	sub    $0x4,%esp
+  803a4d:	68 80 02 00 00       	push   $0x280
+  803a52:	6a 00                	push   $0x0
+  803a54:	68 40 60 80 00       	push   $0x806040
+  803a59:	e8 31 cf ff ff       	call   80098f <memset>
+	threads_mu.m_state = 0;
+  803a5e:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  803a65:	00 00 00 
+	if (self != 0) {
+  803a68:	83 c4 10             	add    $0x10,%esp
+  803a6b:	85 db                	test   %ebx,%ebx
+  803a6d:	74 51                	je     803ac0 <pthread_fork_child+0x9b>
+  803a6f:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803a71:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803a77:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803a7c:	77 18                	ja     803a96 <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803a7e:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803a83:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803a85:	c1 e8 10             	shr    $0x10,%eax
+  803a88:	74 0c                	je     803a96 <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803a8a:	c1 e0 10             	shl    $0x10,%eax
+  803a8d:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803a92:	29 c2                	sub    %eax,%edx
+  803a94:	eb 06                	jmp    803a9c <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  803a96:	8b 15 c0 62 c0 00    	mov    0xc062c0,%edx
+		threads[self].th_env = thisenv->env_id;
+  803a9c:	8b 02                	mov    (%edx),%eax
+  803a9e:	8b 48 48             	mov    0x48(%eax),%ecx
+  803aa1:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803aa8:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803aab:	89 0c 95 40 60 80 00 	mov    %ecx,0x806040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  803ab2:	8d 04 95 40 60 80 00 	lea    0x806040(,%edx,4),%eax
+  803ab9:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  803ac0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803ac3:	c9                   	leave
+  803ac4:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  803ac5:	83 ec 04             	sub    $0x4,%esp
+  803ac8:	68 80 02 00 00       	push   $0x280
+  803acd:	6a 00                	push   $0x0
+  803acf:	68 40 60 80 00       	push   $0x806040
+  803ad4:	e8 b6 ce ff ff       	call   80098f <memset>
+	threads_mu.m_state = 0;
+  803ad9:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  803ae0:	00 00 00 
+  803ae3:	83 c4 10             	add    $0x10,%esp
+  803ae6:	eb d8                	jmp    803ac0 <pthread_fork_child+0x9b>
+
+00803ae8 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803ae8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803aed:	c3                   	ret
+
+00803aee <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803aee:	55                   	push   %ebp
+  803aef:	89 e5                	mov    %esp,%ebp
+  803af1:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803af4:	68 d5 4d 80 00       	push   $0x804dd5
+  803af9:	ff 75 0c             	push   0xc(%ebp)
+  803afc:	e8 3d cd ff ff       	call   80083e <strcpy>
+	return 0;
+}
+  803b01:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b06:	c9                   	leave
+  803b07:	c3                   	ret
+
+00803b08 <devcons_write>:
+{
+  803b08:	55                   	push   %ebp
+  803b09:	89 e5                	mov    %esp,%ebp
+  803b0b:	57                   	push   %edi
+  803b0c:	56                   	push   %esi
+  803b0d:	53                   	push   %ebx
+  803b0e:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803b14:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803b19:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803b1f:	eb 2e                	jmp    803b4f <devcons_write+0x47>
+		m = n - tot;
+  803b21:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803b24:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803b26:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803b2b:	39 c3                	cmp    %eax,%ebx
+  803b2d:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803b30:	83 ec 04             	sub    $0x4,%esp
+  803b33:	53                   	push   %ebx
+  803b34:	89 f0                	mov    %esi,%eax
+  803b36:	03 45 0c             	add    0xc(%ebp),%eax
+  803b39:	50                   	push   %eax
+  803b3a:	57                   	push   %edi
+  803b3b:	e8 84 ce ff ff       	call   8009c4 <memmove>
+		sys_cputs(buf, m);
+  803b40:	83 c4 08             	add    $0x8,%esp
+  803b43:	53                   	push   %ebx
+  803b44:	57                   	push   %edi
+  803b45:	e8 38 d0 ff ff       	call   800b82 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803b4a:	01 de                	add    %ebx,%esi
+  803b4c:	83 c4 10             	add    $0x10,%esp
+  803b4f:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803b52:	72 cd                	jb     803b21 <devcons_write+0x19>
+}
+  803b54:	89 f0                	mov    %esi,%eax
+  803b56:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803b59:	5b                   	pop    %ebx
+  803b5a:	5e                   	pop    %esi
+  803b5b:	5f                   	pop    %edi
+  803b5c:	5d                   	pop    %ebp
+  803b5d:	c3                   	ret
+
+00803b5e <devcons_read>:
+{
+  803b5e:	55                   	push   %ebp
+  803b5f:	89 e5                	mov    %esp,%ebp
+  803b61:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  803b64:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b69:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803b6d:	75 07                	jne    803b76 <devcons_read+0x18>
+  803b6f:	eb 1f                	jmp    803b90 <devcons_read+0x32>
+		sys_yield();
+  803b71:	e8 da d0 ff ff       	call   800c50 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  803b76:	e8 32 d0 ff ff       	call   800bad <sys_cgetc>
+  803b7b:	85 c0                	test   %eax,%eax
+  803b7d:	74 f2                	je     803b71 <devcons_read+0x13>
+	if (c < 0)
+  803b7f:	78 0f                	js     803b90 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  803b81:	83 f8 04             	cmp    $0x4,%eax
+  803b84:	74 0c                	je     803b92 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  803b86:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803b89:	88 02                	mov    %al,(%edx)
+	return 1;
+  803b8b:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803b90:	c9                   	leave
+  803b91:	c3                   	ret
+		return 0;
+  803b92:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b97:	eb f7                	jmp    803b90 <devcons_read+0x32>
+
+00803b99 <cputchar>:
+{
+  803b99:	55                   	push   %ebp
+  803b9a:	89 e5                	mov    %esp,%ebp
+  803b9c:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803b9f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803ba2:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803ba5:	6a 01                	push   $0x1
+  803ba7:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803baa:	50                   	push   %eax
+  803bab:	e8 d2 cf ff ff       	call   800b82 <sys_cputs>
+}
+  803bb0:	83 c4 10             	add    $0x10,%esp
+  803bb3:	c9                   	leave
+  803bb4:	c3                   	ret
+
+00803bb5 <getchar>:
+{
+  803bb5:	55                   	push   %ebp
+  803bb6:	89 e5                	mov    %esp,%ebp
+  803bb8:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803bbb:	6a 01                	push   $0x1
+  803bbd:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803bc0:	50                   	push   %eax
+  803bc1:	6a 00                	push   $0x0
+  803bc3:	e8 63 d8 ff ff       	call   80142b <read>
+	if (r < 0)
+  803bc8:	83 c4 10             	add    $0x10,%esp
+  803bcb:	85 c0                	test   %eax,%eax
+  803bcd:	78 06                	js     803bd5 <getchar+0x20>
+	if (r < 1)
+  803bcf:	74 06                	je     803bd7 <getchar+0x22>
+	return c;
+  803bd1:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803bd5:	c9                   	leave
+  803bd6:	c3                   	ret
+		return -E_EOF;
+  803bd7:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803bdc:	eb f7                	jmp    803bd5 <getchar+0x20>
+
+00803bde <iscons>:
+{
+  803bde:	55                   	push   %ebp
+  803bdf:	89 e5                	mov    %esp,%ebp
+  803be1:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803be4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803be7:	50                   	push   %eax
+  803be8:	ff 75 08             	push   0x8(%ebp)
+  803beb:	e8 ab d5 ff ff       	call   80119b <fd_lookup>
+  803bf0:	83 c4 10             	add    $0x10,%esp
+  803bf3:	85 c0                	test   %eax,%eax
+  803bf5:	78 11                	js     803c08 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803bf7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803bfa:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  803c00:	39 10                	cmp    %edx,(%eax)
+  803c02:	0f 94 c0             	sete   %al
+  803c05:	0f b6 c0             	movzbl %al,%eax
+}
+  803c08:	c9                   	leave
+  803c09:	c3                   	ret
+
+00803c0a <opencons>:
+{
+  803c0a:	55                   	push   %ebp
+  803c0b:	89 e5                	mov    %esp,%ebp
+  803c0d:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803c10:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803c13:	50                   	push   %eax
+  803c14:	e8 2c d5 ff ff       	call   801145 <fd_alloc>
+  803c19:	83 c4 10             	add    $0x10,%esp
+  803c1c:	85 c0                	test   %eax,%eax
+  803c1e:	78 3a                	js     803c5a <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803c20:	83 ec 04             	sub    $0x4,%esp
+  803c23:	68 07 04 00 00       	push   $0x407
+  803c28:	ff 75 f4             	push   -0xc(%ebp)
+  803c2b:	6a 00                	push   $0x0
+  803c2d:	e8 4a d0 ff ff       	call   800c7c <sys_page_alloc>
+  803c32:	83 c4 10             	add    $0x10,%esp
+  803c35:	85 c0                	test   %eax,%eax
+  803c37:	78 21                	js     803c5a <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803c39:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803c3c:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  803c42:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803c44:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803c47:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803c4e:	83 ec 0c             	sub    $0xc,%esp
+  803c51:	50                   	push   %eax
+  803c52:	e8 c7 d4 ff ff       	call   80111e <fd2num>
+  803c57:	83 c4 10             	add    $0x10,%esp
+}
+  803c5a:	c9                   	leave
+  803c5b:	c3                   	ret
+
+00803c5c <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  803c5c:	55                   	push   %ebp
+  803c5d:	89 e5                	mov    %esp,%ebp
+  803c5f:	57                   	push   %edi
+  803c60:	56                   	push   %esi
+  803c61:	53                   	push   %ebx
+  803c62:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  803c65:	89 d6                	mov    %edx,%esi
+  803c67:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  803c6a:	89 cf                	mov    %ecx,%edi
+  803c6c:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  803c6f:	89 fa                	mov    %edi,%edx
+  803c71:	80 ce 08             	or     $0x8,%dh
+  803c74:	f6 c5 08             	test   $0x8,%ch
+  803c77:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  803c7a:	57                   	push   %edi
+  803c7b:	56                   	push   %esi
+  803c7c:	50                   	push   %eax
+  803c7d:	56                   	push   %esi
+  803c7e:	6a 00                	push   $0x0
+  803c80:	e8 44 d0 ff ff       	call   800cc9 <sys_page_map>
+	if (r < 0) {
+  803c85:	83 c4 20             	add    $0x20,%esp
+  803c88:	85 c0                	test   %eax,%eax
+  803c8a:	78 27                	js     803cb3 <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  803c8c:	83 ec 0c             	sub    $0xc,%esp
+  803c8f:	57                   	push   %edi
+  803c90:	56                   	push   %esi
+  803c91:	6a 00                	push   $0x0
+  803c93:	56                   	push   %esi
+  803c94:	6a 00                	push   $0x0
+  803c96:	e8 2e d0 ff ff       	call   800cc9 <sys_page_map>
+  803c9b:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803c9d:	83 c4 20             	add    $0x20,%esp
+  803ca0:	85 c0                	test   %eax,%eax
+  803ca2:	78 24                	js     803cc8 <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  803ca4:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803ca9:	89 d8                	mov    %ebx,%eax
+  803cab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803cae:	5b                   	pop    %ebx
+  803caf:	5e                   	pop    %esi
+  803cb0:	5f                   	pop    %edi
+  803cb1:	5d                   	pop    %ebp
+  803cb2:	c3                   	ret
+  803cb3:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803cb5:	83 ec 08             	sub    $0x8,%esp
+  803cb8:	50                   	push   %eax
+  803cb9:	68 e4 4d 80 00       	push   $0x804de4
+  803cbe:	e8 97 c5 ff ff       	call   80025a <cprintf>
+		return r;
+  803cc3:	83 c4 10             	add    $0x10,%esp
+  803cc6:	eb e1                	jmp    803ca9 <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  803cc8:	83 ec 08             	sub    $0x8,%esp
+  803ccb:	50                   	push   %eax
+  803ccc:	68 14 4e 80 00       	push   $0x804e14
+  803cd1:	e8 84 c5 ff ff       	call   80025a <cprintf>
+		return r;
+  803cd6:	83 c4 10             	add    $0x10,%esp
+  803cd9:	eb ce                	jmp    803ca9 <duppage_cow+0x4d>
+
+00803cdb <duppage>:
+{
+  803cdb:	55                   	push   %ebp
+  803cdc:	89 e5                	mov    %esp,%ebp
+  803cde:	53                   	push   %ebx
+  803cdf:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  803ce2:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  803ce5:	51                   	push   %ecx
+  803ce6:	52                   	push   %edx
+  803ce7:	50                   	push   %eax
+  803ce8:	52                   	push   %edx
+  803ce9:	6a 00                	push   $0x0
+  803ceb:	e8 d9 cf ff ff       	call   800cc9 <sys_page_map>
+	if (r < 0) {
+  803cf0:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  803cf3:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  803cf8:	85 c0                	test   %eax,%eax
+  803cfa:	78 07                	js     803d03 <duppage+0x28>
+}
+  803cfc:	89 d8                	mov    %ebx,%eax
+  803cfe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803d01:	c9                   	leave
+  803d02:	c3                   	ret
+  803d03:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803d05:	83 ec 08             	sub    $0x8,%esp
+  803d08:	50                   	push   %eax
+  803d09:	68 e4 4d 80 00       	push   $0x804de4
+  803d0e:	e8 47 c5 ff ff       	call   80025a <cprintf>
+		return r;
+  803d13:	83 c4 10             	add    $0x10,%esp
+  803d16:	eb e4                	jmp    803cfc <duppage+0x21>
+
+00803d18 <cow_copy>:
+{
+  803d18:	55                   	push   %ebp
+  803d19:	89 e5                	mov    %esp,%ebp
+  803d1b:	56                   	push   %esi
+  803d1c:	53                   	push   %ebx
+  803d1d:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  803d1f:	83 ec 04             	sub    $0x4,%esp
+  803d22:	6a 07                	push   $0x7
+  803d24:	68 00 f0 7f 00       	push   $0x7ff000
+  803d29:	6a 00                	push   $0x0
+  803d2b:	e8 4c cf ff ff       	call   800c7c <sys_page_alloc>
+	if (r < 0) {
+  803d30:	83 c4 10             	add    $0x10,%esp
+  803d33:	85 c0                	test   %eax,%eax
+  803d35:	78 58                	js     803d8f <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  803d37:	83 ec 04             	sub    $0x4,%esp
+  803d3a:	68 00 10 00 00       	push   $0x1000
+  803d3f:	56                   	push   %esi
+  803d40:	68 00 f0 7f 00       	push   $0x7ff000
+  803d45:	e8 7a cc ff ff       	call   8009c4 <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  803d4a:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  803d51:	56                   	push   %esi
+  803d52:	6a 00                	push   $0x0
+  803d54:	68 00 f0 7f 00       	push   $0x7ff000
+  803d59:	6a 00                	push   $0x0
+  803d5b:	e8 69 cf ff ff       	call   800cc9 <sys_page_map>
+  803d60:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803d62:	83 c4 20             	add    $0x20,%esp
+  803d65:	85 c0                	test   %eax,%eax
+  803d67:	78 3b                	js     803da4 <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  803d69:	83 ec 08             	sub    $0x8,%esp
+  803d6c:	68 00 f0 7f 00       	push   $0x7ff000
+  803d71:	6a 00                	push   $0x0
+  803d73:	e8 9d cf ff ff       	call   800d15 <sys_page_unmap>
+  803d78:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803d7a:	83 c4 10             	add    $0x10,%esp
+  803d7d:	85 c0                	test   %eax,%eax
+  803d7f:	78 45                	js     803dc6 <cow_copy+0xae>
+	return 0;
+  803d81:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803d86:	89 d8                	mov    %ebx,%eax
+  803d88:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803d8b:	5b                   	pop    %ebx
+  803d8c:	5e                   	pop    %esi
+  803d8d:	5d                   	pop    %ebp
+  803d8e:	c3                   	ret
+  803d8f:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  803d91:	83 ec 08             	sub    $0x8,%esp
+  803d94:	50                   	push   %eax
+  803d95:	68 04 4f 80 00       	push   $0x804f04
+  803d9a:	e8 bb c4 ff ff       	call   80025a <cprintf>
+		return r;
+  803d9f:	83 c4 10             	add    $0x10,%esp
+  803da2:	eb e2                	jmp    803d86 <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  803da4:	83 ec 08             	sub    $0x8,%esp
+  803da7:	50                   	push   %eax
+  803da8:	68 20 4f 80 00       	push   $0x804f20
+  803dad:	e8 a8 c4 ff ff       	call   80025a <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  803db2:	83 c4 08             	add    $0x8,%esp
+  803db5:	68 00 f0 7f 00       	push   $0x7ff000
+  803dba:	6a 00                	push   $0x0
+  803dbc:	e8 54 cf ff ff       	call   800d15 <sys_page_unmap>
+		return r;
+  803dc1:	83 c4 10             	add    $0x10,%esp
+  803dc4:	eb c0                	jmp    803d86 <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  803dc6:	83 ec 08             	sub    $0x8,%esp
+  803dc9:	50                   	push   %eax
+  803dca:	68 3c 4e 80 00       	push   $0x804e3c
+  803dcf:	e8 86 c4 ff ff       	call   80025a <cprintf>
+		return r;
+  803dd4:	83 c4 10             	add    $0x10,%esp
+  803dd7:	eb ad                	jmp    803d86 <cow_copy+0x6e>
+
+00803dd9 <pgfault>:
+{
+  803dd9:	55                   	push   %ebp
+  803dda:	89 e5                	mov    %esp,%ebp
+  803ddc:	56                   	push   %esi
+  803ddd:	53                   	push   %ebx
+  803dde:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  803de1:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  803de3:	89 d8                	mov    %ebx,%eax
+  803de5:	c1 e8 16             	shr    $0x16,%eax
+  803de8:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  803def:	89 de                	mov    %ebx,%esi
+  803df1:	c1 ee 0c             	shr    $0xc,%esi
+  803df4:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  803dfb:	a8 07                	test   $0x7,%al
+  803dfd:	74 3b                	je     803e3a <pgfault+0x61>
+  803dff:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  803e05:	74 33                	je     803e3a <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  803e07:	83 ec 0c             	sub    $0xc,%esp
+  803e0a:	68 00 f0 bf ee       	push   $0xeebff000
+  803e0f:	e8 c8 f4 ff ff       	call   8032dc <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  803e14:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  803e1b:	83 c4 10             	add    $0x10,%esp
+  803e1e:	f6 c4 08             	test   $0x8,%ah
+  803e21:	75 30                	jne    803e53 <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  803e23:	83 ec 0c             	sub    $0xc,%esp
+  803e26:	68 00 f0 bf ee       	push   $0xeebff000
+  803e2b:	e8 19 f5 ff ff       	call   803349 <mutex_unlock>
+}
+  803e30:	83 c4 10             	add    $0x10,%esp
+  803e33:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803e36:	5b                   	pop    %ebx
+  803e37:	5e                   	pop    %esi
+  803e38:	5d                   	pop    %ebp
+  803e39:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  803e3a:	83 ec 08             	sub    $0x8,%esp
+  803e3d:	ff 72 28             	push   0x28(%edx)
+  803e40:	51                   	push   %ecx
+  803e41:	50                   	push   %eax
+  803e42:	68 60 4e 80 00       	push   $0x804e60
+  803e47:	6a 3f                	push   $0x3f
+  803e49:	68 3a 4f 80 00       	push   $0x804f3a
+  803e4e:	e8 2c c3 ff ff       	call   80017f <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  803e53:	89 d8                	mov    %ebx,%eax
+  803e55:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  803e5a:	e8 b9 fe ff ff       	call   803d18 <cow_copy>
+  803e5f:	eb c2                	jmp    803e23 <pgfault+0x4a>
+
+00803e61 <cow_enable>:
+{
+  803e61:	55                   	push   %ebp
+  803e62:	89 e5                	mov    %esp,%ebp
+  803e64:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  803e67:	68 d9 3d 80 00       	push   $0x803dd9
+  803e6c:	e8 28 06 00 00       	call   804499 <set_pgfault_handler>
+}
+  803e71:	83 c4 10             	add    $0x10,%esp
+  803e74:	c9                   	leave
+  803e75:	c3                   	ret
+
+00803e76 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  803e76:	55                   	push   %ebp
+  803e77:	89 e5                	mov    %esp,%ebp
+  803e79:	57                   	push   %edi
+  803e7a:	56                   	push   %esi
+  803e7b:	53                   	push   %ebx
+  803e7c:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  803e7f:	68 d9 3d 80 00       	push   $0x803dd9
+  803e84:	e8 10 06 00 00       	call   804499 <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  803e89:	b8 07 00 00 00       	mov    $0x7,%eax
+  803e8e:	cd 30                	int    $0x30
+  803e90:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  803e93:	83 c4 10             	add    $0x10,%esp
+  803e96:	85 c0                	test   %eax,%eax
+  803e98:	78 4b                	js     803ee5 <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  803e9a:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  803e9f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803ea4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  803ea7:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  803eab:	0f 85 16 01 00 00    	jne    803fc7 <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803eb1:	e8 6e cd ff ff       	call   800c24 <sys_getenvid>
+  803eb6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803ebb:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803ebd:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  803ec3:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803ec9:	77 32                	ja     803efd <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803ecb:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  803ed0:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  803ed2:	c1 ea 10             	shr    $0x10,%edx
+  803ed5:	74 26                	je     803efd <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803ed7:	c1 e2 10             	shl    $0x10,%edx
+  803eda:	89 d1                	mov    %edx,%ecx
+  803edc:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803ee1:	29 ca                	sub    %ecx,%edx
+  803ee3:	eb 1e                	jmp    803f03 <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  803ee5:	83 ec 08             	sub    $0x8,%esp
+  803ee8:	89 c7                	mov    %eax,%edi
+  803eea:	50                   	push   %eax
+  803eeb:	68 45 4f 80 00       	push   $0x804f45
+  803ef0:	e8 65 c3 ff ff       	call   80025a <cprintf>
+		return eid;
+  803ef5:	83 c4 10             	add    $0x10,%esp
+  803ef8:	e9 6c 01 00 00       	jmp    804069 <fork+0x1f3>
+		return pthread_main_tls;
+  803efd:	8b 15 c0 62 c0 00    	mov    0xc062c0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803f03:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  803f06:	c1 e0 04             	shl    $0x4,%eax
+  803f09:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803f0e:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  803f10:	e8 10 fb ff ff       	call   803a25 <pthread_fork_child>
+		return eid;
+  803f15:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  803f18:	e9 4c 01 00 00       	jmp    804069 <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  803f1d:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  803f23:	89 da                	mov    %ebx,%edx
+  803f25:	89 f8                	mov    %edi,%eax
+  803f27:	e8 af fd ff ff       	call   803cdb <duppage>
+  803f2c:	85 c0                	test   %eax,%eax
+  803f2e:	79 28                	jns    803f58 <fork+0xe2>
+  803f30:	89 c7                	mov    %eax,%edi
+  803f32:	e9 32 01 00 00       	jmp    804069 <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  803f37:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  803f3d:	83 f9 05             	cmp    $0x5,%ecx
+  803f40:	75 58                	jne    803f9a <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  803f42:	b9 05 00 00 00       	mov    $0x5,%ecx
+  803f47:	89 da                	mov    %ebx,%edx
+  803f49:	89 f8                	mov    %edi,%eax
+  803f4b:	e8 8b fd ff ff       	call   803cdb <duppage>
+  803f50:	85 c0                	test   %eax,%eax
+  803f52:	0f 88 0f 01 00 00    	js     804067 <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  803f58:	83 c3 01             	add    $0x1,%ebx
+  803f5b:	39 de                	cmp    %ebx,%esi
+  803f5d:	74 54                	je     803fb3 <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  803f5f:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  803f66:	f6 c1 05             	test   $0x5,%cl
+  803f69:	74 ed                	je     803f58 <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  803f6b:	f6 c5 04             	test   $0x4,%ch
+  803f6e:	75 ad                	jne    803f1d <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  803f70:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  803f76:	74 bf                	je     803f37 <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  803f78:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  803f7e:	74 d8                	je     803f58 <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  803f80:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  803f86:	89 da                	mov    %ebx,%edx
+  803f88:	89 f8                	mov    %edi,%eax
+  803f8a:	e8 cd fc ff ff       	call   803c5c <duppage_cow>
+  803f8f:	85 c0                	test   %eax,%eax
+  803f91:	79 c5                	jns    803f58 <fork+0xe2>
+  803f93:	89 c7                	mov    %eax,%edi
+  803f95:	e9 cf 00 00 00       	jmp    804069 <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  803f9a:	68 90 4e 80 00       	push   $0x804e90
+  803f9f:	68 9d 4c 80 00       	push   $0x804c9d
+  803fa4:	68 c6 00 00 00       	push   $0xc6
+  803fa9:	68 3a 4f 80 00       	push   $0x804f3a
+  803fae:	e8 cc c1 ff ff       	call   80017f <_panic>
+  803fb3:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  803fb6:	83 c1 01             	add    $0x1,%ecx
+  803fb9:	81 c6 00 04 00 00    	add    $0x400,%esi
+  803fbf:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  803fc5:	74 18                	je     803fdf <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  803fc7:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  803fce:	a8 07                	test   $0x7,%al
+  803fd0:	74 e4                	je     803fb6 <fork+0x140>
+  803fd2:	89 cb                	mov    %ecx,%ebx
+  803fd4:	c1 e3 0a             	shl    $0xa,%ebx
+  803fd7:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  803fda:	e9 7c ff ff ff       	jmp    803f5b <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  803fdf:	83 ec 04             	sub    $0x4,%esp
+  803fe2:	6a 07                	push   $0x7
+  803fe4:	68 00 f0 bf ee       	push   $0xeebff000
+  803fe9:	ff 75 e4             	push   -0x1c(%ebp)
+  803fec:	e8 8b cc ff ff       	call   800c7c <sys_page_alloc>
+  803ff1:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  803ff3:	83 c4 10             	add    $0x10,%esp
+  803ff6:	85 c0                	test   %eax,%eax
+  803ff8:	78 34                	js     80402e <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  803ffa:	83 ec 08             	sub    $0x8,%esp
+  803ffd:	68 d7 44 80 00       	push   $0x8044d7
+  804002:	ff 75 e4             	push   -0x1c(%ebp)
+  804005:	e8 ef cd ff ff       	call   800df9 <sys_env_set_pgfault_upcall>
+  80400a:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80400c:	83 c4 10             	add    $0x10,%esp
+  80400f:	85 c0                	test   %eax,%eax
+  804011:	78 2e                	js     804041 <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  804013:	83 ec 08             	sub    $0x8,%esp
+  804016:	6a 02                	push   $0x2
+  804018:	ff 75 e4             	push   -0x1c(%ebp)
+  80401b:	e8 41 cd ff ff       	call   800d61 <sys_env_set_status>
+  804020:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804022:	83 c4 10             	add    $0x10,%esp
+  804025:	85 c0                	test   %eax,%eax
+  804027:	78 2b                	js     804054 <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  804029:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80402c:	eb 3b                	jmp    804069 <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  80402e:	83 ec 08             	sub    $0x8,%esp
+  804031:	50                   	push   %eax
+  804032:	68 b8 4e 80 00       	push   $0x804eb8
+  804037:	e8 1e c2 ff ff       	call   80025a <cprintf>
+		return r;
+  80403c:	83 c4 10             	add    $0x10,%esp
+  80403f:	eb 28                	jmp    804069 <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  804041:	83 ec 08             	sub    $0x8,%esp
+  804044:	50                   	push   %eax
+  804045:	68 e0 4e 80 00       	push   $0x804ee0
+  80404a:	e8 0b c2 ff ff       	call   80025a <cprintf>
+		return r;
+  80404f:	83 c4 10             	add    $0x10,%esp
+  804052:	eb 15                	jmp    804069 <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  804054:	83 ec 08             	sub    $0x8,%esp
+  804057:	50                   	push   %eax
+  804058:	68 55 4f 80 00       	push   $0x804f55
+  80405d:	e8 f8 c1 ff ff       	call   80025a <cprintf>
+		return r;
+  804062:	83 c4 10             	add    $0x10,%esp
+  804065:	eb 02                	jmp    804069 <fork+0x1f3>
+  804067:	89 c7                	mov    %eax,%edi
+}
+  804069:	89 f8                	mov    %edi,%eax
+  80406b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80406e:	5b                   	pop    %ebx
+  80406f:	5e                   	pop    %esi
+  804070:	5f                   	pop    %edi
+  804071:	5d                   	pop    %ebp
+  804072:	c3                   	ret
+
+00804073 <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  804073:	55                   	push   %ebp
+  804074:	89 e5                	mov    %esp,%ebp
+  804076:	57                   	push   %edi
+  804077:	56                   	push   %esi
+  804078:	53                   	push   %ebx
+  804079:	83 ec 2c             	sub    $0x2c,%esp
+  80407c:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80407e:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  804084:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804089:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  80408f:	77 0a                	ja     80409b <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804091:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  804096:	29 c3                	sub    %eax,%ebx
+  804098:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  80409b:	83 ec 0c             	sub    $0xc,%esp
+  80409e:	68 d9 3d 80 00       	push   $0x803dd9
+  8040a3:	e8 f1 03 00 00       	call   804499 <set_pgfault_handler>
+  8040a8:	b8 07 00 00 00       	mov    $0x7,%eax
+  8040ad:	cd 30                	int    $0x30
+  8040af:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  8040b2:	83 c4 10             	add    $0x10,%esp
+  8040b5:	85 c0                	test   %eax,%eax
+  8040b7:	78 30                	js     8040e9 <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  8040b9:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8040bd:	74 42                	je     804101 <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  8040bf:	c1 e3 10             	shl    $0x10,%ebx
+  8040c2:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  8040c7:	29 d8                	sub    %ebx,%eax
+  8040c9:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8040cc:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  8040d1:	29 d8                	sub    %ebx,%eax
+  8040d3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8040d6:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8040db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8040e0:	89 f7                	mov    %esi,%edi
+  8040e2:	89 d6                	mov    %edx,%esi
+  8040e4:	e9 2c 01 00 00       	jmp    804215 <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  8040e9:	83 ec 08             	sub    $0x8,%esp
+  8040ec:	89 c7                	mov    %eax,%edi
+  8040ee:	50                   	push   %eax
+  8040ef:	68 45 4f 80 00       	push   $0x804f45
+  8040f4:	e8 61 c1 ff ff       	call   80025a <cprintf>
+		return eid;
+  8040f9:	83 c4 10             	add    $0x10,%esp
+  8040fc:	e9 d5 00 00 00       	jmp    8041d6 <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  804101:	e8 1e cb ff ff       	call   800c24 <sys_getenvid>
+  804106:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80410b:	89 c2                	mov    %eax,%edx
+  80410d:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80410f:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  804115:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80411a:	77 18                	ja     804134 <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80411c:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804121:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  804123:	c1 e8 10             	shr    $0x10,%eax
+  804126:	74 0c                	je     804134 <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804128:	c1 e0 10             	shl    $0x10,%eax
+  80412b:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  804130:	29 c1                	sub    %eax,%ecx
+  804132:	eb 06                	jmp    80413a <sfork+0xc7>
+		return pthread_main_tls;
+  804134:	8b 0d c0 62 c0 00    	mov    0xc062c0,%ecx
+  80413a:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80413d:	c1 e0 04             	shl    $0x4,%eax
+  804140:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804145:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  804147:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  80414a:	e9 87 00 00 00       	jmp    8041d6 <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  80414f:	f6 c5 04             	test   $0x4,%ch
+  804152:	74 6c                	je     8041c0 <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  804154:	89 ca                	mov    %ecx,%edx
+  804156:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  80415c:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  804162:	74 7c                	je     8041e0 <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  804164:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  80416a:	89 da                	mov    %ebx,%edx
+  80416c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80416f:	e8 67 fb ff ff       	call   803cdb <duppage>
+  804174:	85 c0                	test   %eax,%eax
+  804176:	0f 88 4f 01 00 00    	js     8042cb <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  80417c:	83 c3 01             	add    $0x1,%ebx
+  80417f:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  804182:	74 7a                	je     8041fe <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  804184:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  804186:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  80418d:	f6 c1 01             	test   $0x1,%cl
+  804190:	74 ea                	je     80417c <sfork+0x109>
+  804192:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  804198:	74 e2                	je     80417c <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  80419a:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  8041a0:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  8041a3:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  8041a8:	76 a5                	jbe    80414f <sfork+0xdc>
+  8041aa:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  8041b0:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8041b3:	39 fa                	cmp    %edi,%edx
+  8041b5:	73 9d                	jae    804154 <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  8041b7:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  8041ba:	39 fa                	cmp    %edi,%edx
+  8041bc:	72 96                	jb     804154 <sfork+0xe1>
+  8041be:	eb 8f                	jmp    80414f <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8041c0:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8041c6:	89 da                	mov    %ebx,%edx
+  8041c8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8041cb:	e8 8c fa ff ff       	call   803c5c <duppage_cow>
+  8041d0:	85 c0                	test   %eax,%eax
+  8041d2:	79 a8                	jns    80417c <sfork+0x109>
+  8041d4:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  8041d6:	89 f8                	mov    %edi,%eax
+  8041d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8041db:	5b                   	pop    %ebx
+  8041dc:	5e                   	pop    %esi
+  8041dd:	5f                   	pop    %edi
+  8041de:	5d                   	pop    %ebp
+  8041df:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  8041e0:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  8041e5:	e8 2e fb ff ff       	call   803d18 <cow_copy>
+  8041ea:	85 c0                	test   %eax,%eax
+  8041ec:	0f 88 d2 00 00 00    	js     8042c4 <sfork+0x251>
+				pte = uvpt[pn];
+  8041f2:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  8041f9:	e9 66 ff ff ff       	jmp    804164 <sfork+0xf1>
+  8041fe:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804201:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804204:	83 c6 01             	add    $0x1,%esi
+  804207:	81 c7 00 04 00 00    	add    $0x400,%edi
+  80420d:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  804213:	74 1b                	je     804230 <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  804215:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  80421c:	a8 01                	test   $0x1,%al
+  80421e:	74 e4                	je     804204 <sfork+0x191>
+  804220:	89 f3                	mov    %esi,%ebx
+  804222:	c1 e3 0a             	shl    $0xa,%ebx
+  804225:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  804228:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  80422b:	e9 4f ff ff ff       	jmp    80417f <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  804230:	83 ec 04             	sub    $0x4,%esp
+  804233:	6a 07                	push   $0x7
+  804235:	68 00 f0 bf ee       	push   $0xeebff000
+  80423a:	ff 75 e0             	push   -0x20(%ebp)
+  80423d:	e8 3a ca ff ff       	call   800c7c <sys_page_alloc>
+  804242:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804244:	83 c4 10             	add    $0x10,%esp
+  804247:	85 c0                	test   %eax,%eax
+  804249:	78 37                	js     804282 <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  80424b:	83 ec 08             	sub    $0x8,%esp
+  80424e:	68 d7 44 80 00       	push   $0x8044d7
+  804253:	ff 75 e0             	push   -0x20(%ebp)
+  804256:	e8 9e cb ff ff       	call   800df9 <sys_env_set_pgfault_upcall>
+  80425b:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80425d:	83 c4 10             	add    $0x10,%esp
+  804260:	85 c0                	test   %eax,%eax
+  804262:	78 34                	js     804298 <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  804264:	83 ec 08             	sub    $0x8,%esp
+  804267:	6a 02                	push   $0x2
+  804269:	ff 75 e0             	push   -0x20(%ebp)
+  80426c:	e8 f0 ca ff ff       	call   800d61 <sys_env_set_status>
+  804271:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804273:	83 c4 10             	add    $0x10,%esp
+  804276:	85 c0                	test   %eax,%eax
+  804278:	78 34                	js     8042ae <sfork+0x23b>
+	return eid;
+  80427a:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  80427d:	e9 54 ff ff ff       	jmp    8041d6 <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  804282:	83 ec 08             	sub    $0x8,%esp
+  804285:	50                   	push   %eax
+  804286:	68 b8 4e 80 00       	push   $0x804eb8
+  80428b:	e8 ca bf ff ff       	call   80025a <cprintf>
+		return r;
+  804290:	83 c4 10             	add    $0x10,%esp
+  804293:	e9 3e ff ff ff       	jmp    8041d6 <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  804298:	83 ec 08             	sub    $0x8,%esp
+  80429b:	50                   	push   %eax
+  80429c:	68 e0 4e 80 00       	push   $0x804ee0
+  8042a1:	e8 b4 bf ff ff       	call   80025a <cprintf>
+		return r;
+  8042a6:	83 c4 10             	add    $0x10,%esp
+  8042a9:	e9 28 ff ff ff       	jmp    8041d6 <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  8042ae:	83 ec 08             	sub    $0x8,%esp
+  8042b1:	50                   	push   %eax
+  8042b2:	68 55 4f 80 00       	push   $0x804f55
+  8042b7:	e8 9e bf ff ff       	call   80025a <cprintf>
+		return r;
+  8042bc:	83 c4 10             	add    $0x10,%esp
+  8042bf:	e9 12 ff ff ff       	jmp    8041d6 <sfork+0x163>
+  8042c4:	89 c7                	mov    %eax,%edi
+  8042c6:	e9 0b ff ff ff       	jmp    8041d6 <sfork+0x163>
+  8042cb:	89 c7                	mov    %eax,%edi
+  8042cd:	e9 04 ff ff ff       	jmp    8041d6 <sfork+0x163>
+
+008042d2 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8042d2:	55                   	push   %ebp
+  8042d3:	89 e5                	mov    %esp,%ebp
+  8042d5:	57                   	push   %edi
+  8042d6:	56                   	push   %esi
+  8042d7:	53                   	push   %ebx
+  8042d8:	83 ec 18             	sub    $0x18,%esp
+  8042db:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8042de:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8042e1:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  8042e4:	85 c0                	test   %eax,%eax
+  8042e6:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8042eb:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  8042ee:	50                   	push   %eax
+  8042ef:	e8 7e cb ff ff       	call   800e72 <sys_ipc_recv>
+	if (r < 0) {
+  8042f4:	83 c4 10             	add    $0x10,%esp
+  8042f7:	85 c0                	test   %eax,%eax
+  8042f9:	78 2b                	js     804326 <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  8042fb:	85 ff                	test   %edi,%edi
+  8042fd:	74 55                	je     804354 <ipc_recv+0x82>
+  8042ff:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804301:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804307:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80430c:	77 39                	ja     804347 <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80430e:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804313:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804315:	c1 e8 10             	shr    $0x10,%eax
+  804318:	74 2d                	je     804347 <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80431a:	c1 e0 10             	shl    $0x10,%eax
+  80431d:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804322:	29 c2                	sub    %eax,%edx
+  804324:	eb 27                	jmp    80434d <ipc_recv+0x7b>
+  804326:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  804328:	83 ec 08             	sub    $0x8,%esp
+  80432b:	50                   	push   %eax
+  80432c:	68 73 4f 80 00       	push   $0x804f73
+  804331:	e8 24 bf ff ff       	call   80025a <cprintf>
+		*from_env_store = 0;
+  804336:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  80433c:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  804342:	83 c4 10             	add    $0x10,%esp
+  804345:	eb 77                	jmp    8043be <ipc_recv+0xec>
+		return pthread_main_tls;
+  804347:	8b 15 c0 62 c0 00    	mov    0xc062c0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  80434d:	8b 02                	mov    (%edx),%eax
+  80434f:	8b 40 78             	mov    0x78(%eax),%eax
+  804352:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804354:	85 f6                	test   %esi,%esi
+  804356:	74 34                	je     80438c <ipc_recv+0xba>
+  804358:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80435a:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804360:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804365:	77 18                	ja     80437f <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804367:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80436c:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80436e:	c1 e8 10             	shr    $0x10,%eax
+  804371:	74 0c                	je     80437f <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804373:	c1 e0 10             	shl    $0x10,%eax
+  804376:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80437b:	29 c2                	sub    %eax,%edx
+  80437d:	eb 06                	jmp    804385 <ipc_recv+0xb3>
+		return pthread_main_tls;
+  80437f:	8b 15 c0 62 c0 00    	mov    0xc062c0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  804385:	8b 02                	mov    (%edx),%eax
+  804387:	8b 40 7c             	mov    0x7c(%eax),%eax
+  80438a:	89 06                	mov    %eax,(%esi)
+  80438c:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80438e:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804394:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804399:	77 18                	ja     8043b3 <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80439b:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8043a0:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8043a2:	c1 e8 10             	shr    $0x10,%eax
+  8043a5:	74 0c                	je     8043b3 <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8043a7:	c1 e0 10             	shl    $0x10,%eax
+  8043aa:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8043af:	29 c2                	sub    %eax,%edx
+  8043b1:	eb 06                	jmp    8043b9 <ipc_recv+0xe7>
+		return pthread_main_tls;
+  8043b3:	8b 15 c0 62 c0 00    	mov    0xc062c0,%edx
+	}
+	return thisenv->env_ipc_value;
+  8043b9:	8b 02                	mov    (%edx),%eax
+  8043bb:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  8043be:	89 d8                	mov    %ebx,%eax
+  8043c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8043c3:	5b                   	pop    %ebx
+  8043c4:	5e                   	pop    %esi
+  8043c5:	5f                   	pop    %edi
+  8043c6:	5d                   	pop    %ebp
+  8043c7:	c3                   	ret
+
+008043c8 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8043c8:	55                   	push   %ebp
+  8043c9:	89 e5                	mov    %esp,%ebp
+  8043cb:	57                   	push   %edi
+  8043cc:	56                   	push   %esi
+  8043cd:	53                   	push   %ebx
+  8043ce:	83 ec 0c             	sub    $0xc,%esp
+  8043d1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8043d4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8043d7:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  8043da:	85 db                	test   %ebx,%ebx
+  8043dc:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8043e1:	0f 44 d8             	cmove  %eax,%ebx
+  8043e4:	eb 05                	jmp    8043eb <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  8043e6:	e8 65 c8 ff ff       	call   800c50 <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  8043eb:	57                   	push   %edi
+  8043ec:	53                   	push   %ebx
+  8043ed:	ff 75 0c             	push   0xc(%ebp)
+  8043f0:	56                   	push   %esi
+  8043f1:	e8 4f ca ff ff       	call   800e45 <sys_ipc_try_send>
+		if (r == 0) {
+  8043f6:	83 c4 10             	add    $0x10,%esp
+  8043f9:	85 c0                	test   %eax,%eax
+  8043fb:	74 19                	je     804416 <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  8043fd:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  804400:	74 e4                	je     8043e6 <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  804402:	83 ec 0c             	sub    $0xc,%esp
+  804405:	50                   	push   %eax
+  804406:	57                   	push   %edi
+  804407:	53                   	push   %ebx
+  804408:	56                   	push   %esi
+  804409:	68 8c 4f 80 00       	push   $0x804f8c
+  80440e:	e8 47 be ff ff       	call   80025a <cprintf>
+			return;
+  804413:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  804416:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804419:	5b                   	pop    %ebx
+  80441a:	5e                   	pop    %esi
+  80441b:	5f                   	pop    %edi
+  80441c:	5d                   	pop    %ebp
+  80441d:	c3                   	ret
+
+0080441e <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80441e:	55                   	push   %ebp
+  80441f:	89 e5                	mov    %esp,%ebp
+  804421:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  804424:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  804429:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80442c:	c1 e0 04             	shl    $0x4,%eax
+  80442f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804434:	8b 40 50             	mov    0x50(%eax),%eax
+  804437:	39 c8                	cmp    %ecx,%eax
+  804439:	74 12                	je     80444d <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80443b:	83 c2 01             	add    $0x1,%edx
+  80443e:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  804444:	75 e3                	jne    804429 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  804446:	b8 00 00 00 00       	mov    $0x0,%eax
+  80444b:	eb 0e                	jmp    80445b <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80444d:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804450:	c1 e0 04             	shl    $0x4,%eax
+  804453:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804458:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80445b:	5d                   	pop    %ebp
+  80445c:	c3                   	ret
+
+0080445d <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80445d:	55                   	push   %ebp
+  80445e:	89 e5                	mov    %esp,%ebp
+  804460:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804463:	89 c2                	mov    %eax,%edx
+  804465:	c1 ea 16             	shr    $0x16,%edx
+  804468:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80446f:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804474:	f6 c1 01             	test   $0x1,%cl
+  804477:	74 1c                	je     804495 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  804479:	c1 e8 0c             	shr    $0xc,%eax
+  80447c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  804483:	a8 01                	test   $0x1,%al
+  804485:	74 0e                	je     804495 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  804487:	c1 e8 0c             	shr    $0xc,%eax
+  80448a:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  804491:	ef 
+  804492:	0f b7 d2             	movzwl %dx,%edx
+}
+  804495:	89 d0                	mov    %edx,%eax
+  804497:	5d                   	pop    %ebp
+  804498:	c3                   	ret
+
+00804499 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804499:	55                   	push   %ebp
+  80449a:	89 e5                	mov    %esp,%ebp
+  80449c:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  80449f:	83 3d 00 90 c0 00 00 	cmpl   $0x0,0xc09000
+  8044a6:	74 0a                	je     8044b2 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8044a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8044ab:	a3 00 90 c0 00       	mov    %eax,0xc09000
+}
+  8044b0:	c9                   	leave
+  8044b1:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  8044b2:	83 ec 04             	sub    $0x4,%esp
+  8044b5:	6a 07                	push   $0x7
+  8044b7:	68 00 f0 bf ee       	push   $0xeebff000
+  8044bc:	6a 00                	push   $0x0
+  8044be:	e8 b9 c7 ff ff       	call   800c7c <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8044c3:	83 c4 08             	add    $0x8,%esp
+  8044c6:	68 d7 44 80 00       	push   $0x8044d7
+  8044cb:	6a 00                	push   $0x0
+  8044cd:	e8 27 c9 ff ff       	call   800df9 <sys_env_set_pgfault_upcall>
+  8044d2:	83 c4 10             	add    $0x10,%esp
+  8044d5:	eb d1                	jmp    8044a8 <set_pgfault_handler+0xf>
+
+008044d7 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8044d7:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8044d8:	a1 00 90 c0 00       	mov    0xc09000,%eax
+	call *%eax
+  8044dd:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8044df:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  8044e2:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  8044e6:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  8044ea:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  8044ed:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  8044f1:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  8044f3:	83 c4 08             	add    $0x8,%esp
+	popal
+  8044f6:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  8044f7:	83 c4 04             	add    $0x4,%esp
+	popfl
+  8044fa:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  8044fb:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  8044fc:	c3                   	ret
+
+008044fd <udm>:
+  8044fd:	57                   	push   %edi
+  8044fe:	56                   	push   %esi
+  8044ff:	53                   	push   %ebx
+  804500:	83 ec 20             	sub    $0x20,%esp
+  804503:	89 44 24 10          	mov    %eax,0x10(%esp)
+  804507:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80450b:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80450f:	8b 54 24 34          	mov    0x34(%esp),%edx
+  804513:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804517:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80451b:	89 d1                	mov    %edx,%ecx
+  80451d:	09 c1                	or     %eax,%ecx
+  80451f:	0f 84 91 00 00 00    	je     8045b6 <udm+0xb9>
+  804525:	b8 00 00 00 00       	mov    $0x0,%eax
+  80452a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80452f:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804534:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80453b:	00 
+  80453c:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  804543:	00 
+  804544:	eb 08                	jmp    80454e <udm+0x51>
+  804546:	83 e9 01             	sub    $0x1,%ecx
+  804549:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80454c:	74 7c                	je     8045ca <udm+0xcd>
+  80454e:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804552:	01 c0                	add    %eax,%eax
+  804554:	89 c6                	mov    %eax,%esi
+  804556:	89 d7                	mov    %edx,%edi
+  804558:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80455c:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804560:	0f ad d0             	shrd   %cl,%edx,%eax
+  804563:	d3 ea                	shr    %cl,%edx
+  804565:	f6 c1 20             	test   $0x20,%cl
+  804568:	74 04                	je     80456e <udm+0x71>
+  80456a:	89 d0                	mov    %edx,%eax
+  80456c:	31 d2                	xor    %edx,%edx
+  80456e:	83 e0 01             	and    $0x1,%eax
+  804571:	89 04 24             	mov    %eax,(%esp)
+  804574:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80457b:	00 
+  80457c:	8b 04 24             	mov    (%esp),%eax
+  80457f:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804583:	09 f0                	or     %esi,%eax
+  804585:	09 fa                	or     %edi,%edx
+  804587:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80458b:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  80458f:	39 f0                	cmp    %esi,%eax
+  804591:	89 d3                	mov    %edx,%ebx
+  804593:	19 fb                	sbb    %edi,%ebx
+  804595:	72 af                	jb     804546 <udm+0x49>
+  804597:	29 f0                	sub    %esi,%eax
+  804599:	19 fa                	sbb    %edi,%edx
+  80459b:	89 cf                	mov    %ecx,%edi
+  80459d:	c1 ef 05             	shr    $0x5,%edi
+  8045a0:	83 e7 01             	and    $0x1,%edi
+  8045a3:	89 fe                	mov    %edi,%esi
+  8045a5:	83 f6 01             	xor    $0x1,%esi
+  8045a8:	d3 e6                	shl    %cl,%esi
+  8045aa:	d3 e7                	shl    %cl,%edi
+  8045ac:	09 74 24 18          	or     %esi,0x18(%esp)
+  8045b0:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8045b4:	eb 90                	jmp    804546 <udm+0x49>
+  8045b6:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8045ba:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8045be:	89 f0                	mov    %esi,%eax
+  8045c0:	89 fa                	mov    %edi,%edx
+  8045c2:	89 74 24 18          	mov    %esi,0x18(%esp)
+  8045c6:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  8045ca:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  8045ce:	89 01                	mov    %eax,(%ecx)
+  8045d0:	89 51 04             	mov    %edx,0x4(%ecx)
+  8045d3:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8045d7:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8045db:	83 c4 20             	add    $0x20,%esp
+  8045de:	5b                   	pop    %ebx
+  8045df:	5e                   	pop    %esi
+  8045e0:	5f                   	pop    %edi
+  8045e1:	c3                   	ret
+
+008045e2 <__udivdi3>:
+  8045e2:	83 ec 18             	sub    $0x18,%esp
+  8045e5:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8045e9:	50                   	push   %eax
+  8045ea:	ff 74 24 2c          	push   0x2c(%esp)
+  8045ee:	ff 74 24 2c          	push   0x2c(%esp)
+  8045f2:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8045f6:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8045fa:	e8 fe fe ff ff       	call   8044fd <udm>
+  8045ff:	83 c4 24             	add    $0x24,%esp
+  804602:	c3                   	ret
+
+00804603 <__umoddi3>:
+  804603:	83 ec 18             	sub    $0x18,%esp
+  804606:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80460a:	50                   	push   %eax
+  80460b:	ff 74 24 2c          	push   0x2c(%esp)
+  80460f:	ff 74 24 2c          	push   0x2c(%esp)
+  804613:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804617:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80461b:	e8 dd fe ff ff       	call   8044fd <udm>
+  804620:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804624:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804628:	83 c4 24             	add    $0x24,%esp
+  80462b:	c3                   	ret
+
+0080462c <__divdi3>:
+  80462c:	56                   	push   %esi
+  80462d:	53                   	push   %ebx
+  80462e:	83 ec 14             	sub    $0x14,%esp
+  804631:	8b 44 24 20          	mov    0x20(%esp),%eax
+  804635:	8b 54 24 24          	mov    0x24(%esp),%edx
+  804639:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  80463d:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  804641:	85 d2                	test   %edx,%edx
+  804643:	78 18                	js     80465d <__divdi3+0x31>
+  804645:	85 db                	test   %ebx,%ebx
+  804647:	78 3e                	js     804687 <__divdi3+0x5b>
+  804649:	83 ec 04             	sub    $0x4,%esp
+  80464c:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804650:	56                   	push   %esi
+  804651:	53                   	push   %ebx
+  804652:	51                   	push   %ecx
+  804653:	e8 a5 fe ff ff       	call   8044fd <udm>
+  804658:	83 c4 10             	add    $0x10,%esp
+  80465b:	eb 24                	jmp    804681 <__divdi3+0x55>
+  80465d:	f7 d8                	neg    %eax
+  80465f:	83 d2 00             	adc    $0x0,%edx
+  804662:	f7 da                	neg    %edx
+  804664:	85 db                	test   %ebx,%ebx
+  804666:	78 3a                	js     8046a2 <__divdi3+0x76>
+  804668:	83 ec 04             	sub    $0x4,%esp
+  80466b:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80466f:	56                   	push   %esi
+  804670:	53                   	push   %ebx
+  804671:	51                   	push   %ecx
+  804672:	e8 86 fe ff ff       	call   8044fd <udm>
+  804677:	83 c4 10             	add    $0x10,%esp
+  80467a:	f7 d8                	neg    %eax
+  80467c:	83 d2 00             	adc    $0x0,%edx
+  80467f:	f7 da                	neg    %edx
+  804681:	83 c4 14             	add    $0x14,%esp
+  804684:	5b                   	pop    %ebx
+  804685:	5e                   	pop    %esi
+  804686:	c3                   	ret
+  804687:	83 ec 04             	sub    $0x4,%esp
+  80468a:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80468e:	56                   	push   %esi
+  80468f:	f7 d9                	neg    %ecx
+  804691:	83 d3 00             	adc    $0x0,%ebx
+  804694:	f7 db                	neg    %ebx
+  804696:	53                   	push   %ebx
+  804697:	51                   	push   %ecx
+  804698:	e8 60 fe ff ff       	call   8044fd <udm>
+  80469d:	83 c4 10             	add    $0x10,%esp
+  8046a0:	eb d8                	jmp    80467a <__divdi3+0x4e>
+  8046a2:	83 ec 04             	sub    $0x4,%esp
+  8046a5:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8046a9:	56                   	push   %esi
+  8046aa:	f7 d9                	neg    %ecx
+  8046ac:	83 d3 00             	adc    $0x0,%ebx
+  8046af:	f7 db                	neg    %ebx
+  8046b1:	53                   	push   %ebx
+  8046b2:	51                   	push   %ecx
+  8046b3:	e8 45 fe ff ff       	call   8044fd <udm>
+  8046b8:	83 c4 10             	add    $0x10,%esp
+  8046bb:	eb c4                	jmp    804681 <__divdi3+0x55>
+
+008046bd <__moddi3>:
+  8046bd:	55                   	push   %ebp
+  8046be:	57                   	push   %edi
+  8046bf:	56                   	push   %esi
+  8046c0:	53                   	push   %ebx
+  8046c1:	83 ec 24             	sub    $0x24,%esp
+  8046c4:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8046c8:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8046cc:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8046d0:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8046d4:	85 d2                	test   %edx,%edx
+  8046d6:	78 3b                	js     804713 <__moddi3+0x56>
+  8046d8:	83 ec 04             	sub    $0x4,%esp
+  8046db:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8046df:	56                   	push   %esi
+  8046e0:	89 ce                	mov    %ecx,%esi
+  8046e2:	f7 de                	neg    %esi
+  8046e4:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8046e8:	89 de                	mov    %ebx,%esi
+  8046ea:	83 d6 00             	adc    $0x0,%esi
+  8046ed:	f7 de                	neg    %esi
+  8046ef:	89 74 24 14          	mov    %esi,0x14(%esp)
+  8046f3:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8046f7:	0f 48 f1             	cmovs  %ecx,%esi
+  8046fa:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  8046ff:	53                   	push   %ebx
+  804700:	56                   	push   %esi
+  804701:	e8 f7 fd ff ff       	call   8044fd <udm>
+  804706:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80470a:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80470e:	83 c4 10             	add    $0x10,%esp
+  804711:	eb 47                	jmp    80475a <__moddi3+0x9d>
+  804713:	f7 d8                	neg    %eax
+  804715:	83 d2 00             	adc    $0x0,%edx
+  804718:	f7 da                	neg    %edx
+  80471a:	83 ec 04             	sub    $0x4,%esp
+  80471d:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804721:	56                   	push   %esi
+  804722:	89 cf                	mov    %ecx,%edi
+  804724:	f7 df                	neg    %edi
+  804726:	89 de                	mov    %ebx,%esi
+  804728:	83 d6 00             	adc    $0x0,%esi
+  80472b:	f7 de                	neg    %esi
+  80472d:	0f 49 cf             	cmovns %edi,%ecx
+  804730:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  804734:	0f 49 de             	cmovns %esi,%ebx
+  804737:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  80473b:	ff 74 24 0c          	push   0xc(%esp)
+  80473f:	ff 74 24 0c          	push   0xc(%esp)
+  804743:	e8 b5 fd ff ff       	call   8044fd <udm>
+  804748:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80474c:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804750:	f7 d8                	neg    %eax
+  804752:	83 d2 00             	adc    $0x0,%edx
+  804755:	f7 da                	neg    %edx
+  804757:	83 c4 10             	add    $0x10,%esp
+  80475a:	83 c4 24             	add    $0x24,%esp
+  80475d:	5b                   	pop    %ebx
+  80475e:	5e                   	pop    %esi
+  80475f:	5f                   	pop    %edi
+  804760:	5d                   	pop    %ebp
+  804761:	c3                   	ret
@@ -0,0 +1,9839 @@
+
+obj/user/testexec.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 77 00 00 00       	call   8000a8 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 08             	sub    $0x8,%esp
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  800039:	89 e2                	mov    %esp,%edx
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80003b:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  800041:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800046:	77 18                	ja     800060 <umain+0x2d>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800048:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80004d:	29 d0                	sub    %edx,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  80004f:	c1 e8 10             	shr    $0x10,%eax
+  800052:	74 0c                	je     800060 <umain+0x2d>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800054:	c1 e0 10             	shl    $0x10,%eax
+  800057:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80005c:	29 c2                	sub    %eax,%edx
+  80005e:	eb 06                	jmp    800066 <umain+0x33>
+		return pthread_main_tls;
+  800060:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+    int r;
+	cprintf("i am original environment %08x\n", thisenv->env_id);
+  800066:	8b 02                	mov    (%edx),%eax
+  800068:	8b 40 48             	mov    0x48(%eax),%eax
+  80006b:	83 ec 08             	sub    $0x8,%esp
+  80006e:	50                   	push   %eax
+  80006f:	68 00 48 80 00       	push   $0x804800
+  800074:	e8 ad 01 00 00       	call   800226 <cprintf>
+	if ((r = execl("ls", "ls", 0)) < 0)
+  800079:	83 c4 0c             	add    $0xc,%esp
+  80007c:	6a 00                	push   $0x0
+  80007e:	68 20 48 80 00       	push   $0x804820
+  800083:	68 20 48 80 00       	push   $0x804820
+  800088:	e8 52 32 00 00       	call   8032df <execl>
+  80008d:	83 c4 10             	add    $0x10,%esp
+  800090:	85 c0                	test   %eax,%eax
+  800092:	78 02                	js     800096 <umain+0x63>
+		panic("spawn(hello) failed: %e", r);
+  800094:	c9                   	leave
+  800095:	c3                   	ret
+		panic("spawn(hello) failed: %e", r);
+  800096:	50                   	push   %eax
+  800097:	68 23 48 80 00       	push   $0x804823
+  80009c:	6a 09                	push   $0x9
+  80009e:	68 3b 48 80 00       	push   $0x80483b
+  8000a3:	e8 a3 00 00 00       	call   80014b <_panic>
+
+008000a8 <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000a8:	55                   	push   %ebp
+  8000a9:	89 e5                	mov    %esp,%ebp
+  8000ab:	57                   	push   %edi
+  8000ac:	56                   	push   %esi
+  8000ad:	53                   	push   %ebx
+  8000ae:	83 ec 1c             	sub    $0x1c,%esp
+  8000b1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000b4:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  8000b7:	e8 34 0b 00 00       	call   800bf0 <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  8000bc:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  8000bf:	89 15 c0 62 80 00    	mov    %edx,0x8062c0
+	thisenv = &envs[ENVX(eid)];
+  8000c5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000ca:	89 c1                	mov    %eax,%ecx
+  8000cc:	89 e7                	mov    %esp,%edi
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8000ce:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  8000d4:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8000d9:	77 16                	ja     8000f1 <libmain+0x49>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8000db:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8000e0:	29 f8                	sub    %edi,%eax
+	if (t == 0)
+  8000e2:	c1 e8 10             	shr    $0x10,%eax
+  8000e5:	74 0a                	je     8000f1 <libmain+0x49>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8000e7:	c1 e0 10             	shl    $0x10,%eax
+  8000ea:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8000ef:	29 c2                	sub    %eax,%edx
+  8000f1:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  8000f4:	c1 e0 04             	shl    $0x4,%eax
+  8000f7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000fc:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000fe:	85 db                	test   %ebx,%ebx
+  800100:	7e 07                	jle    800109 <libmain+0x61>
+		binaryname = argv[0];
+  800102:	8b 06                	mov    (%esi),%eax
+  800104:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  800109:	83 ec 08             	sub    $0x8,%esp
+  80010c:	56                   	push   %esi
+  80010d:	53                   	push   %ebx
+  80010e:	e8 20 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800113:	e8 0b 00 00 00       	call   800123 <exit>
+}
+  800118:	83 c4 10             	add    $0x10,%esp
+  80011b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80011e:	5b                   	pop    %ebx
+  80011f:	5e                   	pop    %esi
+  800120:	5f                   	pop    %edi
+  800121:	5d                   	pop    %ebp
+  800122:	c3                   	ret
+
+00800123 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800123:	55                   	push   %ebp
+  800124:	89 e5                	mov    %esp,%ebp
+  800126:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  800129:	6a 00                	push   $0x0
+  80012b:	e8 15 21 00 00       	call   802245 <fflush>
+	pthread_kill_others();
+  800130:	e8 39 38 00 00       	call   80396e <pthread_kill_others>
+	close_all();
+  800135:	e8 ae 11 00 00       	call   8012e8 <close_all>
+	sys_env_destroy(0);
+  80013a:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800141:	e8 5f 0a 00 00       	call   800ba5 <sys_env_destroy>
+}
+  800146:	83 c4 10             	add    $0x10,%esp
+  800149:	c9                   	leave
+  80014a:	c3                   	ret
+
+0080014b <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80014b:	55                   	push   %ebp
+  80014c:	89 e5                	mov    %esp,%ebp
+  80014e:	56                   	push   %esi
+  80014f:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800150:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800153:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  800159:	e8 92 0a 00 00       	call   800bf0 <sys_getenvid>
+  80015e:	83 ec 0c             	sub    $0xc,%esp
+  800161:	ff 75 0c             	push   0xc(%ebp)
+  800164:	ff 75 08             	push   0x8(%ebp)
+  800167:	56                   	push   %esi
+  800168:	50                   	push   %eax
+  800169:	68 58 48 80 00       	push   $0x804858
+  80016e:	e8 b3 00 00 00       	call   800226 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800173:	83 c4 18             	add    $0x18,%esp
+  800176:	53                   	push   %ebx
+  800177:	ff 75 10             	push   0x10(%ebp)
+  80017a:	e8 56 00 00 00       	call   8001d5 <vcprintf>
+	cprintf("\n");
+  80017f:	c7 04 24 4e 4f 80 00 	movl   $0x804f4e,(%esp)
+  800186:	e8 9b 00 00 00       	call   800226 <cprintf>
+  80018b:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80018e:	cc                   	int3
+	while (1)
+  80018f:	eb fd                	jmp    80018e <_panic+0x43>
+
+00800191 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800191:	55                   	push   %ebp
+  800192:	89 e5                	mov    %esp,%ebp
+  800194:	53                   	push   %ebx
+  800195:	83 ec 04             	sub    $0x4,%esp
+  800198:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80019b:	8b 13                	mov    (%ebx),%edx
+  80019d:	8d 42 01             	lea    0x1(%edx),%eax
+  8001a0:	89 03                	mov    %eax,(%ebx)
+  8001a2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001a5:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001a9:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001ae:	74 09                	je     8001b9 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001b0:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001b4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001b7:	c9                   	leave
+  8001b8:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001b9:	83 ec 08             	sub    $0x8,%esp
+  8001bc:	68 ff 00 00 00       	push   $0xff
+  8001c1:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001c4:	50                   	push   %eax
+  8001c5:	e8 84 09 00 00       	call   800b4e <sys_cputs>
+		b->idx = 0;
+  8001ca:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001d0:	83 c4 10             	add    $0x10,%esp
+  8001d3:	eb db                	jmp    8001b0 <putch+0x1f>
+
+008001d5 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001d5:	55                   	push   %ebp
+  8001d6:	89 e5                	mov    %esp,%ebp
+  8001d8:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001de:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001e5:	00 00 00 
+	b.cnt = 0;
+  8001e8:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001ef:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001f2:	ff 75 0c             	push   0xc(%ebp)
+  8001f5:	ff 75 08             	push   0x8(%ebp)
+  8001f8:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001fe:	50                   	push   %eax
+  8001ff:	68 91 01 80 00       	push   $0x800191
+  800204:	e8 14 01 00 00       	call   80031d <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800209:	83 c4 08             	add    $0x8,%esp
+  80020c:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800212:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800218:	50                   	push   %eax
+  800219:	e8 30 09 00 00       	call   800b4e <sys_cputs>
+
+	return b.cnt;
+}
+  80021e:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800224:	c9                   	leave
+  800225:	c3                   	ret
+
+00800226 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800226:	55                   	push   %ebp
+  800227:	89 e5                	mov    %esp,%ebp
+  800229:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80022c:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80022f:	50                   	push   %eax
+  800230:	ff 75 08             	push   0x8(%ebp)
+  800233:	e8 9d ff ff ff       	call   8001d5 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800238:	c9                   	leave
+  800239:	c3                   	ret
+
+0080023a <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80023a:	55                   	push   %ebp
+  80023b:	89 e5                	mov    %esp,%ebp
+  80023d:	57                   	push   %edi
+  80023e:	56                   	push   %esi
+  80023f:	53                   	push   %ebx
+  800240:	83 ec 1c             	sub    $0x1c,%esp
+  800243:	89 c7                	mov    %eax,%edi
+  800245:	89 d6                	mov    %edx,%esi
+  800247:	8b 45 08             	mov    0x8(%ebp),%eax
+  80024a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80024d:	89 d1                	mov    %edx,%ecx
+  80024f:	89 c2                	mov    %eax,%edx
+  800251:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800254:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800257:	8b 45 10             	mov    0x10(%ebp),%eax
+  80025a:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80025d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800260:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800267:	39 c2                	cmp    %eax,%edx
+  800269:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80026c:	72 3e                	jb     8002ac <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80026e:	83 ec 0c             	sub    $0xc,%esp
+  800271:	ff 75 18             	push   0x18(%ebp)
+  800274:	83 eb 01             	sub    $0x1,%ebx
+  800277:	53                   	push   %ebx
+  800278:	50                   	push   %eax
+  800279:	83 ec 08             	sub    $0x8,%esp
+  80027c:	ff 75 e4             	push   -0x1c(%ebp)
+  80027f:	ff 75 e0             	push   -0x20(%ebp)
+  800282:	ff 75 dc             	push   -0x24(%ebp)
+  800285:	ff 75 d8             	push   -0x28(%ebp)
+  800288:	e8 da 43 00 00       	call   804667 <__udivdi3>
+  80028d:	83 c4 18             	add    $0x18,%esp
+  800290:	52                   	push   %edx
+  800291:	50                   	push   %eax
+  800292:	89 f2                	mov    %esi,%edx
+  800294:	89 f8                	mov    %edi,%eax
+  800296:	e8 9f ff ff ff       	call   80023a <printnum>
+  80029b:	83 c4 20             	add    $0x20,%esp
+  80029e:	eb 13                	jmp    8002b3 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8002a0:	83 ec 08             	sub    $0x8,%esp
+  8002a3:	56                   	push   %esi
+  8002a4:	ff 75 18             	push   0x18(%ebp)
+  8002a7:	ff d7                	call   *%edi
+  8002a9:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8002ac:	83 eb 01             	sub    $0x1,%ebx
+  8002af:	85 db                	test   %ebx,%ebx
+  8002b1:	7f ed                	jg     8002a0 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8002b3:	83 ec 08             	sub    $0x8,%esp
+  8002b6:	56                   	push   %esi
+  8002b7:	83 ec 04             	sub    $0x4,%esp
+  8002ba:	ff 75 e4             	push   -0x1c(%ebp)
+  8002bd:	ff 75 e0             	push   -0x20(%ebp)
+  8002c0:	ff 75 dc             	push   -0x24(%ebp)
+  8002c3:	ff 75 d8             	push   -0x28(%ebp)
+  8002c6:	e8 bd 43 00 00       	call   804688 <__umoddi3>
+  8002cb:	83 c4 14             	add    $0x14,%esp
+  8002ce:	0f be 80 7b 48 80 00 	movsbl 0x80487b(%eax),%eax
+  8002d5:	50                   	push   %eax
+  8002d6:	ff d7                	call   *%edi
+}
+  8002d8:	83 c4 10             	add    $0x10,%esp
+  8002db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002de:	5b                   	pop    %ebx
+  8002df:	5e                   	pop    %esi
+  8002e0:	5f                   	pop    %edi
+  8002e1:	5d                   	pop    %ebp
+  8002e2:	c3                   	ret
+
+008002e3 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002e3:	55                   	push   %ebp
+  8002e4:	89 e5                	mov    %esp,%ebp
+  8002e6:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002e9:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002ed:	8b 10                	mov    (%eax),%edx
+  8002ef:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002f2:	73 0a                	jae    8002fe <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002f4:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002f7:	89 08                	mov    %ecx,(%eax)
+  8002f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002fc:	88 02                	mov    %al,(%edx)
+}
+  8002fe:	5d                   	pop    %ebp
+  8002ff:	c3                   	ret
+
+00800300 <printfmt>:
+{
+  800300:	55                   	push   %ebp
+  800301:	89 e5                	mov    %esp,%ebp
+  800303:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800306:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800309:	50                   	push   %eax
+  80030a:	ff 75 10             	push   0x10(%ebp)
+  80030d:	ff 75 0c             	push   0xc(%ebp)
+  800310:	ff 75 08             	push   0x8(%ebp)
+  800313:	e8 05 00 00 00       	call   80031d <vprintfmt>
+}
+  800318:	83 c4 10             	add    $0x10,%esp
+  80031b:	c9                   	leave
+  80031c:	c3                   	ret
+
+0080031d <vprintfmt>:
+{
+  80031d:	55                   	push   %ebp
+  80031e:	89 e5                	mov    %esp,%ebp
+  800320:	57                   	push   %edi
+  800321:	56                   	push   %esi
+  800322:	53                   	push   %ebx
+  800323:	83 ec 2c             	sub    $0x2c,%esp
+  800326:	8b 75 08             	mov    0x8(%ebp),%esi
+  800329:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80032c:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80032f:	eb 0a                	jmp    80033b <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800331:	83 ec 08             	sub    $0x8,%esp
+  800334:	53                   	push   %ebx
+  800335:	50                   	push   %eax
+  800336:	ff d6                	call   *%esi
+  800338:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  80033b:	83 c7 01             	add    $0x1,%edi
+  80033e:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  800342:	83 f8 25             	cmp    $0x25,%eax
+  800345:	74 0c                	je     800353 <vprintfmt+0x36>
+			if (ch == '\0')
+  800347:	85 c0                	test   %eax,%eax
+  800349:	75 e6                	jne    800331 <vprintfmt+0x14>
+}
+  80034b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80034e:	5b                   	pop    %ebx
+  80034f:	5e                   	pop    %esi
+  800350:	5f                   	pop    %edi
+  800351:	5d                   	pop    %ebp
+  800352:	c3                   	ret
+		padc = ' ';
+  800353:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800357:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80035e:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800365:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80036c:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  800371:	8d 47 01             	lea    0x1(%edi),%eax
+  800374:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800377:	0f b6 17             	movzbl (%edi),%edx
+  80037a:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80037d:	3c 55                	cmp    $0x55,%al
+  80037f:	0f 87 c5 03 00 00    	ja     80074a <vprintfmt+0x42d>
+  800385:	0f b6 c0             	movzbl %al,%eax
+  800388:	ff 24 85 00 4a 80 00 	jmp    *0x804a00(,%eax,4)
+  80038f:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  800392:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800395:	eb da                	jmp    800371 <vprintfmt+0x54>
+  800397:	0f be d2             	movsbl %dl,%edx
+  80039a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80039d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a2:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8003a5:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003a8:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8003ac:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8003af:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8003b2:	83 f9 09             	cmp    $0x9,%ecx
+  8003b5:	77 55                	ja     80040c <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  8003b7:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8003ba:	eb e9                	jmp    8003a5 <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  8003bc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003bf:	8b 00                	mov    (%eax),%eax
+  8003c1:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003c4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003c7:	8d 40 04             	lea    0x4(%eax),%eax
+  8003ca:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  8003cd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8003d0:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003d4:	79 9b                	jns    800371 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8003d6:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003d9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003dc:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003e3:	eb 8c                	jmp    800371 <vprintfmt+0x54>
+			if (width < 0)
+  8003e5:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003e8:	85 d2                	test   %edx,%edx
+  8003ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ef:	0f 49 c2             	cmovns %edx,%eax
+  8003f2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  8003f5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003f8:	e9 74 ff ff ff       	jmp    800371 <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  8003fd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800400:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800407:	e9 65 ff ff ff       	jmp    800371 <vprintfmt+0x54>
+  80040c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80040f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800412:	eb bc                	jmp    8003d0 <vprintfmt+0xb3>
+			lflag++;
+  800414:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  800417:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80041a:	e9 52 ff ff ff       	jmp    800371 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80041f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800422:	8d 78 04             	lea    0x4(%eax),%edi
+  800425:	83 ec 08             	sub    $0x8,%esp
+  800428:	53                   	push   %ebx
+  800429:	ff 30                	push   (%eax)
+  80042b:	ff d6                	call   *%esi
+			break;
+  80042d:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800430:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800433:	e9 b1 02 00 00       	jmp    8006e9 <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  800438:	8b 45 14             	mov    0x14(%ebp),%eax
+  80043b:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80043e:	8b 10                	mov    (%eax),%edx
+  800440:	89 d0                	mov    %edx,%eax
+  800442:	f7 d8                	neg    %eax
+  800444:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800447:	83 f8 14             	cmp    $0x14,%eax
+  80044a:	7f 23                	jg     80046f <vprintfmt+0x152>
+  80044c:	8b 14 85 60 4b 80 00 	mov    0x804b60(,%eax,4),%edx
+  800453:	85 d2                	test   %edx,%edx
+  800455:	74 18                	je     80046f <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  800457:	52                   	push   %edx
+  800458:	68 cf 4c 80 00       	push   $0x804ccf
+  80045d:	53                   	push   %ebx
+  80045e:	56                   	push   %esi
+  80045f:	e8 9c fe ff ff       	call   800300 <printfmt>
+  800464:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800467:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80046a:	e9 7a 02 00 00       	jmp    8006e9 <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  80046f:	50                   	push   %eax
+  800470:	68 93 48 80 00       	push   $0x804893
+  800475:	53                   	push   %ebx
+  800476:	56                   	push   %esi
+  800477:	e8 84 fe ff ff       	call   800300 <printfmt>
+  80047c:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80047f:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800482:	e9 62 02 00 00       	jmp    8006e9 <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800487:	8b 45 14             	mov    0x14(%ebp),%eax
+  80048a:	83 c0 04             	add    $0x4,%eax
+  80048d:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800490:	8b 45 14             	mov    0x14(%ebp),%eax
+  800493:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800495:	85 c9                	test   %ecx,%ecx
+  800497:	b8 8c 48 80 00       	mov    $0x80488c,%eax
+  80049c:	0f 45 c1             	cmovne %ecx,%eax
+  80049f:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8004a2:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004a6:	7e 06                	jle    8004ae <vprintfmt+0x191>
+  8004a8:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8004ac:	75 0b                	jne    8004b9 <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004ae:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8004b1:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8004b4:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004b7:	eb 5c                	jmp    800515 <vprintfmt+0x1f8>
+  8004b9:	83 ec 08             	sub    $0x8,%esp
+  8004bc:	ff 75 d0             	push   -0x30(%ebp)
+  8004bf:	ff 75 cc             	push   -0x34(%ebp)
+  8004c2:	e8 20 03 00 00       	call   8007e7 <strnlen>
+  8004c7:	89 c2                	mov    %eax,%edx
+  8004c9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004cc:	29 d0                	sub    %edx,%eax
+  8004ce:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8004d1:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004d5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004d8:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004db:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004dd:	eb 0e                	jmp    8004ed <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  8004df:	83 ec 08             	sub    $0x8,%esp
+  8004e2:	53                   	push   %ebx
+  8004e3:	57                   	push   %edi
+  8004e4:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004e7:	83 ee 01             	sub    $0x1,%esi
+  8004ea:	83 c4 10             	add    $0x10,%esp
+  8004ed:	85 f6                	test   %esi,%esi
+  8004ef:	7f ee                	jg     8004df <vprintfmt+0x1c2>
+  8004f1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004f4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004f7:	85 c0                	test   %eax,%eax
+  8004f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004fe:	0f 49 d0             	cmovns %eax,%edx
+  800501:	29 d0                	sub    %edx,%eax
+  800503:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800506:	eb a6                	jmp    8004ae <vprintfmt+0x191>
+					putch(ch, putdat);
+  800508:	83 ec 08             	sub    $0x8,%esp
+  80050b:	53                   	push   %ebx
+  80050c:	52                   	push   %edx
+  80050d:	ff 55 08             	call   *0x8(%ebp)
+  800510:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800513:	89 f1                	mov    %esi,%ecx
+  800515:	8d 71 01             	lea    0x1(%ecx),%esi
+  800518:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80051c:	0f be d0             	movsbl %al,%edx
+  80051f:	85 d2                	test   %edx,%edx
+  800521:	74 28                	je     80054b <vprintfmt+0x22e>
+  800523:	85 ff                	test   %edi,%edi
+  800525:	78 05                	js     80052c <vprintfmt+0x20f>
+  800527:	83 ef 01             	sub    $0x1,%edi
+  80052a:	78 30                	js     80055c <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80052c:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800530:	74 d6                	je     800508 <vprintfmt+0x1eb>
+  800532:	0f be c0             	movsbl %al,%eax
+  800535:	83 e8 20             	sub    $0x20,%eax
+  800538:	83 f8 5e             	cmp    $0x5e,%eax
+  80053b:	76 cb                	jbe    800508 <vprintfmt+0x1eb>
+					putch('?', putdat);
+  80053d:	83 ec 08             	sub    $0x8,%esp
+  800540:	53                   	push   %ebx
+  800541:	6a 3f                	push   $0x3f
+  800543:	ff 55 08             	call   *0x8(%ebp)
+  800546:	83 c4 10             	add    $0x10,%esp
+  800549:	eb c8                	jmp    800513 <vprintfmt+0x1f6>
+  80054b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80054e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800551:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800554:	01 d0                	add    %edx,%eax
+  800556:	29 c8                	sub    %ecx,%eax
+  800558:	89 c7                	mov    %eax,%edi
+  80055a:	eb 13                	jmp    80056f <vprintfmt+0x252>
+  80055c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80055f:	eb ed                	jmp    80054e <vprintfmt+0x231>
+				putch(' ', putdat);
+  800561:	83 ec 08             	sub    $0x8,%esp
+  800564:	53                   	push   %ebx
+  800565:	6a 20                	push   $0x20
+  800567:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800569:	83 ef 01             	sub    $0x1,%edi
+  80056c:	83 c4 10             	add    $0x10,%esp
+  80056f:	85 ff                	test   %edi,%edi
+  800571:	7f ee                	jg     800561 <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800573:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800576:	89 45 14             	mov    %eax,0x14(%ebp)
+  800579:	e9 6b 01 00 00       	jmp    8006e9 <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  80057e:	83 f9 01             	cmp    $0x1,%ecx
+  800581:	7f 1f                	jg     8005a2 <vprintfmt+0x285>
+	else if (lflag)
+  800583:	85 c9                	test   %ecx,%ecx
+  800585:	74 67                	je     8005ee <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  800587:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058a:	8b 00                	mov    (%eax),%eax
+  80058c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80058f:	89 c1                	mov    %eax,%ecx
+  800591:	c1 f9 1f             	sar    $0x1f,%ecx
+  800594:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800597:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059a:	8d 40 04             	lea    0x4(%eax),%eax
+  80059d:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005a0:	eb 17                	jmp    8005b9 <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  8005a2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a5:	8b 50 04             	mov    0x4(%eax),%edx
+  8005a8:	8b 00                	mov    (%eax),%eax
+  8005aa:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005ad:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b3:	8d 40 08             	lea    0x8(%eax),%eax
+  8005b6:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005b9:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005bc:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8005bf:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8005c4:	85 c9                	test   %ecx,%ecx
+  8005c6:	0f 89 03 01 00 00    	jns    8006cf <vprintfmt+0x3b2>
+				putch('-', putdat);
+  8005cc:	83 ec 08             	sub    $0x8,%esp
+  8005cf:	53                   	push   %ebx
+  8005d0:	6a 2d                	push   $0x2d
+  8005d2:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8005d4:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005d7:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005da:	f7 da                	neg    %edx
+  8005dc:	83 d1 00             	adc    $0x0,%ecx
+  8005df:	f7 d9                	neg    %ecx
+  8005e1:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8005e4:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005e9:	e9 e1 00 00 00       	jmp    8006cf <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  8005ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f1:	8b 00                	mov    (%eax),%eax
+  8005f3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005f6:	89 c1                	mov    %eax,%ecx
+  8005f8:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005fb:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800601:	8d 40 04             	lea    0x4(%eax),%eax
+  800604:	89 45 14             	mov    %eax,0x14(%ebp)
+  800607:	eb b0                	jmp    8005b9 <vprintfmt+0x29c>
+	if (lflag >= 2)
+  800609:	83 f9 01             	cmp    $0x1,%ecx
+  80060c:	7f 1e                	jg     80062c <vprintfmt+0x30f>
+	else if (lflag)
+  80060e:	85 c9                	test   %ecx,%ecx
+  800610:	74 32                	je     800644 <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  800612:	8b 45 14             	mov    0x14(%ebp),%eax
+  800615:	8b 10                	mov    (%eax),%edx
+  800617:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80061c:	8d 40 04             	lea    0x4(%eax),%eax
+  80061f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800622:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800627:	e9 a3 00 00 00       	jmp    8006cf <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  80062c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062f:	8b 10                	mov    (%eax),%edx
+  800631:	8b 48 04             	mov    0x4(%eax),%ecx
+  800634:	8d 40 08             	lea    0x8(%eax),%eax
+  800637:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80063a:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80063f:	e9 8b 00 00 00       	jmp    8006cf <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800644:	8b 45 14             	mov    0x14(%ebp),%eax
+  800647:	8b 10                	mov    (%eax),%edx
+  800649:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80064e:	8d 40 04             	lea    0x4(%eax),%eax
+  800651:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800654:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800659:	eb 74                	jmp    8006cf <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  80065b:	83 f9 01             	cmp    $0x1,%ecx
+  80065e:	7f 1b                	jg     80067b <vprintfmt+0x35e>
+	else if (lflag)
+  800660:	85 c9                	test   %ecx,%ecx
+  800662:	74 2c                	je     800690 <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  800664:	8b 45 14             	mov    0x14(%ebp),%eax
+  800667:	8b 10                	mov    (%eax),%edx
+  800669:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80066e:	8d 40 04             	lea    0x4(%eax),%eax
+  800671:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800674:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800679:	eb 54                	jmp    8006cf <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  80067b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067e:	8b 10                	mov    (%eax),%edx
+  800680:	8b 48 04             	mov    0x4(%eax),%ecx
+  800683:	8d 40 08             	lea    0x8(%eax),%eax
+  800686:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800689:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  80068e:	eb 3f                	jmp    8006cf <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800690:	8b 45 14             	mov    0x14(%ebp),%eax
+  800693:	8b 10                	mov    (%eax),%edx
+  800695:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80069a:	8d 40 04             	lea    0x4(%eax),%eax
+  80069d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006a0:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8006a5:	eb 28                	jmp    8006cf <vprintfmt+0x3b2>
+			putch('0', putdat);
+  8006a7:	83 ec 08             	sub    $0x8,%esp
+  8006aa:	53                   	push   %ebx
+  8006ab:	6a 30                	push   $0x30
+  8006ad:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8006af:	83 c4 08             	add    $0x8,%esp
+  8006b2:	53                   	push   %ebx
+  8006b3:	6a 78                	push   $0x78
+  8006b5:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8006b7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ba:	8b 10                	mov    (%eax),%edx
+  8006bc:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8006c1:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006c4:	8d 40 04             	lea    0x4(%eax),%eax
+  8006c7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006ca:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8006cf:	83 ec 0c             	sub    $0xc,%esp
+  8006d2:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8006d6:	50                   	push   %eax
+  8006d7:	ff 75 e0             	push   -0x20(%ebp)
+  8006da:	57                   	push   %edi
+  8006db:	51                   	push   %ecx
+  8006dc:	52                   	push   %edx
+  8006dd:	89 da                	mov    %ebx,%edx
+  8006df:	89 f0                	mov    %esi,%eax
+  8006e1:	e8 54 fb ff ff       	call   80023a <printnum>
+			break;
+  8006e6:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8006e9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  8006ec:	e9 4a fc ff ff       	jmp    80033b <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8006f1:	83 f9 01             	cmp    $0x1,%ecx
+  8006f4:	7f 1b                	jg     800711 <vprintfmt+0x3f4>
+	else if (lflag)
+  8006f6:	85 c9                	test   %ecx,%ecx
+  8006f8:	74 2c                	je     800726 <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  8006fa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006fd:	8b 10                	mov    (%eax),%edx
+  8006ff:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800704:	8d 40 04             	lea    0x4(%eax),%eax
+  800707:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80070a:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80070f:	eb be                	jmp    8006cf <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800711:	8b 45 14             	mov    0x14(%ebp),%eax
+  800714:	8b 10                	mov    (%eax),%edx
+  800716:	8b 48 04             	mov    0x4(%eax),%ecx
+  800719:	8d 40 08             	lea    0x8(%eax),%eax
+  80071c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80071f:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800724:	eb a9                	jmp    8006cf <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800726:	8b 45 14             	mov    0x14(%ebp),%eax
+  800729:	8b 10                	mov    (%eax),%edx
+  80072b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800730:	8d 40 04             	lea    0x4(%eax),%eax
+  800733:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800736:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80073b:	eb 92                	jmp    8006cf <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  80073d:	83 ec 08             	sub    $0x8,%esp
+  800740:	53                   	push   %ebx
+  800741:	6a 25                	push   $0x25
+  800743:	ff d6                	call   *%esi
+			break;
+  800745:	83 c4 10             	add    $0x10,%esp
+  800748:	eb 9f                	jmp    8006e9 <vprintfmt+0x3cc>
+			putch('%', putdat);
+  80074a:	83 ec 08             	sub    $0x8,%esp
+  80074d:	53                   	push   %ebx
+  80074e:	6a 25                	push   $0x25
+  800750:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800752:	83 c4 10             	add    $0x10,%esp
+  800755:	89 f8                	mov    %edi,%eax
+  800757:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80075b:	74 05                	je     800762 <vprintfmt+0x445>
+  80075d:	83 e8 01             	sub    $0x1,%eax
+  800760:	eb f5                	jmp    800757 <vprintfmt+0x43a>
+  800762:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800765:	eb 82                	jmp    8006e9 <vprintfmt+0x3cc>
+
+00800767 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800767:	55                   	push   %ebp
+  800768:	89 e5                	mov    %esp,%ebp
+  80076a:	83 ec 18             	sub    $0x18,%esp
+  80076d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800770:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800773:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800776:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80077a:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80077d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800784:	85 c0                	test   %eax,%eax
+  800786:	74 26                	je     8007ae <vsnprintf+0x47>
+  800788:	85 d2                	test   %edx,%edx
+  80078a:	7e 22                	jle    8007ae <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80078c:	ff 75 14             	push   0x14(%ebp)
+  80078f:	ff 75 10             	push   0x10(%ebp)
+  800792:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800795:	50                   	push   %eax
+  800796:	68 e3 02 80 00       	push   $0x8002e3
+  80079b:	e8 7d fb ff ff       	call   80031d <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8007a0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007a3:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8007a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007a9:	83 c4 10             	add    $0x10,%esp
+}
+  8007ac:	c9                   	leave
+  8007ad:	c3                   	ret
+		return -E_INVAL;
+  8007ae:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007b3:	eb f7                	jmp    8007ac <vsnprintf+0x45>
+
+008007b5 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8007b5:	55                   	push   %ebp
+  8007b6:	89 e5                	mov    %esp,%ebp
+  8007b8:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8007bb:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8007be:	50                   	push   %eax
+  8007bf:	ff 75 10             	push   0x10(%ebp)
+  8007c2:	ff 75 0c             	push   0xc(%ebp)
+  8007c5:	ff 75 08             	push   0x8(%ebp)
+  8007c8:	e8 9a ff ff ff       	call   800767 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8007cd:	c9                   	leave
+  8007ce:	c3                   	ret
+
+008007cf <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007cf:	55                   	push   %ebp
+  8007d0:	89 e5                	mov    %esp,%ebp
+  8007d2:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8007d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007da:	eb 03                	jmp    8007df <strlen+0x10>
+		n++;
+  8007dc:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8007df:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007e3:	75 f7                	jne    8007dc <strlen+0xd>
+	return n;
+}
+  8007e5:	5d                   	pop    %ebp
+  8007e6:	c3                   	ret
+
+008007e7 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8007e7:	55                   	push   %ebp
+  8007e8:	89 e5                	mov    %esp,%ebp
+  8007ea:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007ed:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007f5:	eb 03                	jmp    8007fa <strnlen+0x13>
+		n++;
+  8007f7:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007fa:	39 d0                	cmp    %edx,%eax
+  8007fc:	74 08                	je     800806 <strnlen+0x1f>
+  8007fe:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800802:	75 f3                	jne    8007f7 <strnlen+0x10>
+  800804:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800806:	89 d0                	mov    %edx,%eax
+  800808:	5d                   	pop    %ebp
+  800809:	c3                   	ret
+
+0080080a <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80080a:	55                   	push   %ebp
+  80080b:	89 e5                	mov    %esp,%ebp
+  80080d:	53                   	push   %ebx
+  80080e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800811:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800814:	b8 00 00 00 00       	mov    $0x0,%eax
+  800819:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80081d:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800820:	83 c0 01             	add    $0x1,%eax
+  800823:	84 d2                	test   %dl,%dl
+  800825:	75 f2                	jne    800819 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800827:	89 c8                	mov    %ecx,%eax
+  800829:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80082c:	c9                   	leave
+  80082d:	c3                   	ret
+
+0080082e <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80082e:	55                   	push   %ebp
+  80082f:	89 e5                	mov    %esp,%ebp
+  800831:	53                   	push   %ebx
+  800832:	83 ec 10             	sub    $0x10,%esp
+  800835:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800838:	53                   	push   %ebx
+  800839:	e8 91 ff ff ff       	call   8007cf <strlen>
+  80083e:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800841:	ff 75 0c             	push   0xc(%ebp)
+  800844:	01 d8                	add    %ebx,%eax
+  800846:	50                   	push   %eax
+  800847:	e8 be ff ff ff       	call   80080a <strcpy>
+	return dst;
+}
+  80084c:	89 d8                	mov    %ebx,%eax
+  80084e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800851:	c9                   	leave
+  800852:	c3                   	ret
+
+00800853 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800853:	55                   	push   %ebp
+  800854:	89 e5                	mov    %esp,%ebp
+  800856:	56                   	push   %esi
+  800857:	53                   	push   %ebx
+  800858:	8b 75 08             	mov    0x8(%ebp),%esi
+  80085b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80085e:	89 f3                	mov    %esi,%ebx
+  800860:	03 5d 10             	add    0x10(%ebp),%ebx
+  800863:	89 f0                	mov    %esi,%eax
+  800865:	eb 0f                	jmp    800876 <strncpy+0x23>
+		*dst++ = *src;
+  800867:	83 c0 01             	add    $0x1,%eax
+  80086a:	0f b6 0a             	movzbl (%edx),%ecx
+  80086d:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800870:	80 f9 01             	cmp    $0x1,%cl
+  800873:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800876:	39 d8                	cmp    %ebx,%eax
+  800878:	75 ed                	jne    800867 <strncpy+0x14>
+	}
+	return ret;
+}
+  80087a:	89 f0                	mov    %esi,%eax
+  80087c:	5b                   	pop    %ebx
+  80087d:	5e                   	pop    %esi
+  80087e:	5d                   	pop    %ebp
+  80087f:	c3                   	ret
+
+00800880 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800880:	55                   	push   %ebp
+  800881:	89 e5                	mov    %esp,%ebp
+  800883:	56                   	push   %esi
+  800884:	53                   	push   %ebx
+  800885:	8b 75 08             	mov    0x8(%ebp),%esi
+  800888:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80088b:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80088e:	89 f0                	mov    %esi,%eax
+  800890:	85 d2                	test   %edx,%edx
+  800892:	74 21                	je     8008b5 <strlcpy+0x35>
+  800894:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800898:	89 f2                	mov    %esi,%edx
+  80089a:	eb 09                	jmp    8008a5 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80089c:	83 c1 01             	add    $0x1,%ecx
+  80089f:	83 c2 01             	add    $0x1,%edx
+  8008a2:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8008a5:	39 c2                	cmp    %eax,%edx
+  8008a7:	74 09                	je     8008b2 <strlcpy+0x32>
+  8008a9:	0f b6 19             	movzbl (%ecx),%ebx
+  8008ac:	84 db                	test   %bl,%bl
+  8008ae:	75 ec                	jne    80089c <strlcpy+0x1c>
+  8008b0:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8008b2:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8008b5:	29 f0                	sub    %esi,%eax
+}
+  8008b7:	5b                   	pop    %ebx
+  8008b8:	5e                   	pop    %esi
+  8008b9:	5d                   	pop    %ebp
+  8008ba:	c3                   	ret
+
+008008bb <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8008bb:	55                   	push   %ebp
+  8008bc:	89 e5                	mov    %esp,%ebp
+  8008be:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008c1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8008c4:	eb 06                	jmp    8008cc <strcmp+0x11>
+		p++, q++;
+  8008c6:	83 c1 01             	add    $0x1,%ecx
+  8008c9:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8008cc:	0f b6 01             	movzbl (%ecx),%eax
+  8008cf:	84 c0                	test   %al,%al
+  8008d1:	74 04                	je     8008d7 <strcmp+0x1c>
+  8008d3:	3a 02                	cmp    (%edx),%al
+  8008d5:	74 ef                	je     8008c6 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008d7:	0f b6 c0             	movzbl %al,%eax
+  8008da:	0f b6 12             	movzbl (%edx),%edx
+  8008dd:	29 d0                	sub    %edx,%eax
+}
+  8008df:	5d                   	pop    %ebp
+  8008e0:	c3                   	ret
+
+008008e1 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008e1:	55                   	push   %ebp
+  8008e2:	89 e5                	mov    %esp,%ebp
+  8008e4:	53                   	push   %ebx
+  8008e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008e8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008eb:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8008ee:	eb 09                	jmp    8008f9 <strncmp+0x18>
+		n--, p++, q++;
+  8008f0:	83 ea 01             	sub    $0x1,%edx
+  8008f3:	83 c0 01             	add    $0x1,%eax
+  8008f6:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8008f9:	85 d2                	test   %edx,%edx
+  8008fb:	74 18                	je     800915 <strncmp+0x34>
+  8008fd:	0f b6 18             	movzbl (%eax),%ebx
+  800900:	84 db                	test   %bl,%bl
+  800902:	74 04                	je     800908 <strncmp+0x27>
+  800904:	3a 19                	cmp    (%ecx),%bl
+  800906:	74 e8                	je     8008f0 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800908:	0f b6 00             	movzbl (%eax),%eax
+  80090b:	0f b6 11             	movzbl (%ecx),%edx
+  80090e:	29 d0                	sub    %edx,%eax
+}
+  800910:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800913:	c9                   	leave
+  800914:	c3                   	ret
+		return 0;
+  800915:	b8 00 00 00 00       	mov    $0x0,%eax
+  80091a:	eb f4                	jmp    800910 <strncmp+0x2f>
+
+0080091c <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80091c:	55                   	push   %ebp
+  80091d:	89 e5                	mov    %esp,%ebp
+  80091f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800922:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800926:	eb 03                	jmp    80092b <strchr+0xf>
+  800928:	83 c0 01             	add    $0x1,%eax
+  80092b:	0f b6 10             	movzbl (%eax),%edx
+  80092e:	84 d2                	test   %dl,%dl
+  800930:	74 06                	je     800938 <strchr+0x1c>
+		if (*s == c)
+  800932:	38 ca                	cmp    %cl,%dl
+  800934:	75 f2                	jne    800928 <strchr+0xc>
+  800936:	eb 05                	jmp    80093d <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800938:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80093d:	5d                   	pop    %ebp
+  80093e:	c3                   	ret
+
+0080093f <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80093f:	55                   	push   %ebp
+  800940:	89 e5                	mov    %esp,%ebp
+  800942:	8b 45 08             	mov    0x8(%ebp),%eax
+  800945:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800949:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  80094c:	38 ca                	cmp    %cl,%dl
+  80094e:	74 09                	je     800959 <strfind+0x1a>
+  800950:	84 d2                	test   %dl,%dl
+  800952:	74 05                	je     800959 <strfind+0x1a>
+	for (; *s; s++)
+  800954:	83 c0 01             	add    $0x1,%eax
+  800957:	eb f0                	jmp    800949 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800959:	5d                   	pop    %ebp
+  80095a:	c3                   	ret
+
+0080095b <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  80095b:	55                   	push   %ebp
+  80095c:	89 e5                	mov    %esp,%ebp
+  80095e:	57                   	push   %edi
+  80095f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800962:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800965:	85 c9                	test   %ecx,%ecx
+  800967:	74 20                	je     800989 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800969:	89 f8                	mov    %edi,%eax
+  80096b:	09 c8                	or     %ecx,%eax
+  80096d:	a8 03                	test   $0x3,%al
+  80096f:	75 12                	jne    800983 <memset+0x28>
+		c &= 0xFF;
+  800971:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800975:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  80097b:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  80097e:	fc                   	cld
+  80097f:	f3 ab                	rep stos %eax,%es:(%edi)
+  800981:	eb 06                	jmp    800989 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800983:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800986:	fc                   	cld
+  800987:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800989:	89 f8                	mov    %edi,%eax
+  80098b:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  80098e:	c9                   	leave
+  80098f:	c3                   	ret
+
+00800990 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800990:	55                   	push   %ebp
+  800991:	89 e5                	mov    %esp,%ebp
+  800993:	57                   	push   %edi
+  800994:	56                   	push   %esi
+  800995:	8b 45 08             	mov    0x8(%ebp),%eax
+  800998:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80099b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  80099e:	39 c6                	cmp    %eax,%esi
+  8009a0:	73 32                	jae    8009d4 <memmove+0x44>
+  8009a2:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8009a5:	39 d0                	cmp    %edx,%eax
+  8009a7:	73 2b                	jae    8009d4 <memmove+0x44>
+		s += n;
+		d += n;
+  8009a9:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009ac:	89 d6                	mov    %edx,%esi
+  8009ae:	09 fe                	or     %edi,%esi
+  8009b0:	09 ce                	or     %ecx,%esi
+  8009b2:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8009b8:	75 0e                	jne    8009c8 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8009ba:	83 ef 04             	sub    $0x4,%edi
+  8009bd:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009c0:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8009c3:	fd                   	std
+  8009c4:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009c6:	eb 09                	jmp    8009d1 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009c8:	83 ef 01             	sub    $0x1,%edi
+  8009cb:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8009ce:	fd                   	std
+  8009cf:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8009d1:	fc                   	cld
+  8009d2:	eb 1a                	jmp    8009ee <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009d4:	89 f2                	mov    %esi,%edx
+  8009d6:	09 c2                	or     %eax,%edx
+  8009d8:	09 ca                	or     %ecx,%edx
+  8009da:	f6 c2 03             	test   $0x3,%dl
+  8009dd:	75 0a                	jne    8009e9 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009df:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8009e2:	89 c7                	mov    %eax,%edi
+  8009e4:	fc                   	cld
+  8009e5:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009e7:	eb 05                	jmp    8009ee <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8009e9:	89 c7                	mov    %eax,%edi
+  8009eb:	fc                   	cld
+  8009ec:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8009ee:	5e                   	pop    %esi
+  8009ef:	5f                   	pop    %edi
+  8009f0:	5d                   	pop    %ebp
+  8009f1:	c3                   	ret
+
+008009f2 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8009f2:	55                   	push   %ebp
+  8009f3:	89 e5                	mov    %esp,%ebp
+  8009f5:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8009f8:	ff 75 10             	push   0x10(%ebp)
+  8009fb:	ff 75 0c             	push   0xc(%ebp)
+  8009fe:	ff 75 08             	push   0x8(%ebp)
+  800a01:	e8 8a ff ff ff       	call   800990 <memmove>
+}
+  800a06:	c9                   	leave
+  800a07:	c3                   	ret
+
+00800a08 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a08:	55                   	push   %ebp
+  800a09:	89 e5                	mov    %esp,%ebp
+  800a0b:	56                   	push   %esi
+  800a0c:	53                   	push   %ebx
+  800a0d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a10:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a13:	89 c6                	mov    %eax,%esi
+  800a15:	03 75 10             	add    0x10(%ebp),%esi
+  800a18:	eb 06                	jmp    800a20 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a1a:	83 c0 01             	add    $0x1,%eax
+  800a1d:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a20:	39 f0                	cmp    %esi,%eax
+  800a22:	74 14                	je     800a38 <memcmp+0x30>
+		if (*s1 != *s2)
+  800a24:	0f b6 08             	movzbl (%eax),%ecx
+  800a27:	0f b6 1a             	movzbl (%edx),%ebx
+  800a2a:	38 d9                	cmp    %bl,%cl
+  800a2c:	74 ec                	je     800a1a <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a2e:	0f b6 c1             	movzbl %cl,%eax
+  800a31:	0f b6 db             	movzbl %bl,%ebx
+  800a34:	29 d8                	sub    %ebx,%eax
+  800a36:	eb 05                	jmp    800a3d <memcmp+0x35>
+	}
+
+	return 0;
+  800a38:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a3d:	5b                   	pop    %ebx
+  800a3e:	5e                   	pop    %esi
+  800a3f:	5d                   	pop    %ebp
+  800a40:	c3                   	ret
+
+00800a41 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a41:	55                   	push   %ebp
+  800a42:	89 e5                	mov    %esp,%ebp
+  800a44:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a47:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a4a:	89 c2                	mov    %eax,%edx
+  800a4c:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a4f:	eb 03                	jmp    800a54 <memfind+0x13>
+  800a51:	83 c0 01             	add    $0x1,%eax
+  800a54:	39 d0                	cmp    %edx,%eax
+  800a56:	73 04                	jae    800a5c <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a58:	38 08                	cmp    %cl,(%eax)
+  800a5a:	75 f5                	jne    800a51 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a5c:	5d                   	pop    %ebp
+  800a5d:	c3                   	ret
+
+00800a5e <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a5e:	55                   	push   %ebp
+  800a5f:	89 e5                	mov    %esp,%ebp
+  800a61:	57                   	push   %edi
+  800a62:	56                   	push   %esi
+  800a63:	53                   	push   %ebx
+  800a64:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a67:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a6a:	eb 03                	jmp    800a6f <strtol+0x11>
+		s++;
+  800a6c:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a6f:	0f b6 02             	movzbl (%edx),%eax
+  800a72:	3c 20                	cmp    $0x20,%al
+  800a74:	74 f6                	je     800a6c <strtol+0xe>
+  800a76:	3c 09                	cmp    $0x9,%al
+  800a78:	74 f2                	je     800a6c <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a7a:	3c 2b                	cmp    $0x2b,%al
+  800a7c:	74 2a                	je     800aa8 <strtol+0x4a>
+	int neg = 0;
+  800a7e:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a83:	3c 2d                	cmp    $0x2d,%al
+  800a85:	74 2b                	je     800ab2 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a87:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a8d:	75 0f                	jne    800a9e <strtol+0x40>
+  800a8f:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a92:	74 28                	je     800abc <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a94:	85 db                	test   %ebx,%ebx
+  800a96:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a9b:	0f 44 d8             	cmove  %eax,%ebx
+  800a9e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800aa3:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800aa6:	eb 46                	jmp    800aee <strtol+0x90>
+		s++;
+  800aa8:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800aab:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ab0:	eb d5                	jmp    800a87 <strtol+0x29>
+		s++, neg = 1;
+  800ab2:	83 c2 01             	add    $0x1,%edx
+  800ab5:	bf 01 00 00 00       	mov    $0x1,%edi
+  800aba:	eb cb                	jmp    800a87 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800abc:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800ac0:	74 0e                	je     800ad0 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800ac2:	85 db                	test   %ebx,%ebx
+  800ac4:	75 d8                	jne    800a9e <strtol+0x40>
+		s++, base = 8;
+  800ac6:	83 c2 01             	add    $0x1,%edx
+  800ac9:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800ace:	eb ce                	jmp    800a9e <strtol+0x40>
+		s += 2, base = 16;
+  800ad0:	83 c2 02             	add    $0x2,%edx
+  800ad3:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800ad8:	eb c4                	jmp    800a9e <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800ada:	0f be c0             	movsbl %al,%eax
+  800add:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800ae0:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800ae3:	7d 3a                	jge    800b1f <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800ae5:	83 c2 01             	add    $0x1,%edx
+  800ae8:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800aec:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800aee:	0f b6 02             	movzbl (%edx),%eax
+  800af1:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800af4:	89 f3                	mov    %esi,%ebx
+  800af6:	80 fb 09             	cmp    $0x9,%bl
+  800af9:	76 df                	jbe    800ada <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800afb:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800afe:	89 f3                	mov    %esi,%ebx
+  800b00:	80 fb 19             	cmp    $0x19,%bl
+  800b03:	77 08                	ja     800b0d <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800b05:	0f be c0             	movsbl %al,%eax
+  800b08:	83 e8 57             	sub    $0x57,%eax
+  800b0b:	eb d3                	jmp    800ae0 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b0d:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b10:	89 f3                	mov    %esi,%ebx
+  800b12:	80 fb 19             	cmp    $0x19,%bl
+  800b15:	77 08                	ja     800b1f <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800b17:	0f be c0             	movsbl %al,%eax
+  800b1a:	83 e8 37             	sub    $0x37,%eax
+  800b1d:	eb c1                	jmp    800ae0 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b1f:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b23:	74 05                	je     800b2a <strtol+0xcc>
+		*endptr = (char *) s;
+  800b25:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b28:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b2a:	89 c8                	mov    %ecx,%eax
+  800b2c:	f7 d8                	neg    %eax
+  800b2e:	85 ff                	test   %edi,%edi
+  800b30:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b33:	89 c8                	mov    %ecx,%eax
+  800b35:	5b                   	pop    %ebx
+  800b36:	5e                   	pop    %esi
+  800b37:	5f                   	pop    %edi
+  800b38:	5d                   	pop    %ebp
+  800b39:	c3                   	ret
+
+00800b3a <atoi>:
+
+int
+atoi(const char* s)
+{
+  800b3a:	55                   	push   %ebp
+  800b3b:	89 e5                	mov    %esp,%ebp
+  800b3d:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  800b40:	6a 00                	push   $0x0
+  800b42:	6a 00                	push   $0x0
+  800b44:	ff 75 08             	push   0x8(%ebp)
+  800b47:	e8 12 ff ff ff       	call   800a5e <strtol>
+}
+  800b4c:	c9                   	leave
+  800b4d:	c3                   	ret
+
+00800b4e <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800b4e:	55                   	push   %ebp
+  800b4f:	89 e5                	mov    %esp,%ebp
+  800b51:	57                   	push   %edi
+  800b52:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800b53:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b58:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b5b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b5e:	89 c3                	mov    %eax,%ebx
+  800b60:	89 c7                	mov    %eax,%edi
+  800b62:	6a 00                	push   $0x0
+  800b64:	55                   	push   %ebp
+  800b65:	56                   	push   %esi
+  800b66:	89 e5                	mov    %esp,%ebp
+  800b68:	8d 35 70 0b 80 00    	lea    0x800b70,%esi
+  800b6e:	0f 34                	sysenter
+
+00800b70 <after_sysenter_label_47>:
+  800b70:	5e                   	pop    %esi
+  800b71:	5d                   	pop    %ebp
+  800b72:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800b75:	5b                   	pop    %ebx
+  800b76:	5f                   	pop    %edi
+  800b77:	5d                   	pop    %ebp
+  800b78:	c3                   	ret
+
+00800b79 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800b79:	55                   	push   %ebp
+  800b7a:	89 e5                	mov    %esp,%ebp
+  800b7c:	57                   	push   %edi
+  800b7d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800b7e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b83:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b88:	89 d1                	mov    %edx,%ecx
+  800b8a:	89 d3                	mov    %edx,%ebx
+  800b8c:	89 d7                	mov    %edx,%edi
+  800b8e:	6a 00                	push   $0x0
+  800b90:	55                   	push   %ebp
+  800b91:	56                   	push   %esi
+  800b92:	89 e5                	mov    %esp,%ebp
+  800b94:	8d 35 9c 0b 80 00    	lea    0x800b9c,%esi
+  800b9a:	0f 34                	sysenter
+
+00800b9c <after_sysenter_label_128>:
+  800b9c:	5e                   	pop    %esi
+  800b9d:	5d                   	pop    %ebp
+  800b9e:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800ba1:	5b                   	pop    %ebx
+  800ba2:	5f                   	pop    %edi
+  800ba3:	5d                   	pop    %ebp
+  800ba4:	c3                   	ret
+
+00800ba5 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800ba5:	55                   	push   %ebp
+  800ba6:	89 e5                	mov    %esp,%ebp
+  800ba8:	57                   	push   %edi
+  800ba9:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800baa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bad:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bb2:	b8 03 00 00 00       	mov    $0x3,%eax
+  800bb7:	89 cb                	mov    %ecx,%ebx
+  800bb9:	89 cf                	mov    %ecx,%edi
+  800bbb:	6a 00                	push   $0x0
+  800bbd:	55                   	push   %ebp
+  800bbe:	56                   	push   %esi
+  800bbf:	89 e5                	mov    %esp,%ebp
+  800bc1:	8d 35 c9 0b 80 00    	lea    0x800bc9,%esi
+  800bc7:	0f 34                	sysenter
+
+00800bc9 <after_sysenter_label_212>:
+  800bc9:	5e                   	pop    %esi
+  800bca:	5d                   	pop    %ebp
+  800bcb:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800bce:	85 c0                	test   %eax,%eax
+  800bd0:	7f 07                	jg     800bd9 <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800bd2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800bd5:	5b                   	pop    %ebx
+  800bd6:	5f                   	pop    %edi
+  800bd7:	5d                   	pop    %ebp
+  800bd8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800bd9:	83 ec 0c             	sub    $0xc,%esp
+  800bdc:	50                   	push   %eax
+  800bdd:	6a 03                	push   $0x3
+  800bdf:	68 f5 4b 80 00       	push   $0x804bf5
+  800be4:	6a 54                	push   $0x54
+  800be6:	68 12 4c 80 00       	push   $0x804c12
+  800beb:	e8 5b f5 ff ff       	call   80014b <_panic>
+
+00800bf0 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800bf0:	55                   	push   %ebp
+  800bf1:	89 e5                	mov    %esp,%ebp
+  800bf3:	57                   	push   %edi
+  800bf4:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800bf5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bfa:	b8 02 00 00 00       	mov    $0x2,%eax
+  800bff:	89 d1                	mov    %edx,%ecx
+  800c01:	89 d3                	mov    %edx,%ebx
+  800c03:	89 d7                	mov    %edx,%edi
+  800c05:	6a 00                	push   $0x0
+  800c07:	55                   	push   %ebp
+  800c08:	56                   	push   %esi
+  800c09:	89 e5                	mov    %esp,%ebp
+  800c0b:	8d 35 13 0c 80 00    	lea    0x800c13,%esi
+  800c11:	0f 34                	sysenter
+
+00800c13 <after_sysenter_label_309>:
+  800c13:	5e                   	pop    %esi
+  800c14:	5d                   	pop    %ebp
+  800c15:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800c18:	5b                   	pop    %ebx
+  800c19:	5f                   	pop    %edi
+  800c1a:	5d                   	pop    %ebp
+  800c1b:	c3                   	ret
+
+00800c1c <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800c1c:	55                   	push   %ebp
+  800c1d:	89 e5                	mov    %esp,%ebp
+  800c1f:	57                   	push   %edi
+  800c20:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c21:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c26:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800c2b:	89 d1                	mov    %edx,%ecx
+  800c2d:	89 d3                	mov    %edx,%ebx
+  800c2f:	89 d7                	mov    %edx,%edi
+  800c31:	6a 00                	push   $0x0
+  800c33:	55                   	push   %ebp
+  800c34:	56                   	push   %esi
+  800c35:	89 e5                	mov    %esp,%ebp
+  800c37:	8d 35 3f 0c 80 00    	lea    0x800c3f,%esi
+  800c3d:	0f 34                	sysenter
+
+00800c3f <after_sysenter_label_391>:
+  800c3f:	5e                   	pop    %esi
+  800c40:	5d                   	pop    %ebp
+  800c41:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800c44:	5b                   	pop    %ebx
+  800c45:	5f                   	pop    %edi
+  800c46:	5d                   	pop    %ebp
+  800c47:	c3                   	ret
+
+00800c48 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c48:	55                   	push   %ebp
+  800c49:	89 e5                	mov    %esp,%ebp
+  800c4b:	57                   	push   %edi
+  800c4c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c4d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c50:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c53:	b8 04 00 00 00       	mov    $0x4,%eax
+  800c58:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c5d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c60:	6a 00                	push   $0x0
+  800c62:	55                   	push   %ebp
+  800c63:	56                   	push   %esi
+  800c64:	89 e5                	mov    %esp,%ebp
+  800c66:	8d 35 6e 0c 80 00    	lea    0x800c6e,%esi
+  800c6c:	0f 34                	sysenter
+
+00800c6e <after_sysenter_label_479>:
+  800c6e:	5e                   	pop    %esi
+  800c6f:	5d                   	pop    %ebp
+  800c70:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800c73:	85 c0                	test   %eax,%eax
+  800c75:	7f 07                	jg     800c7e <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800c77:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c7a:	5b                   	pop    %ebx
+  800c7b:	5f                   	pop    %edi
+  800c7c:	5d                   	pop    %ebp
+  800c7d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c7e:	83 ec 0c             	sub    $0xc,%esp
+  800c81:	50                   	push   %eax
+  800c82:	6a 04                	push   $0x4
+  800c84:	68 f5 4b 80 00       	push   $0x804bf5
+  800c89:	6a 54                	push   $0x54
+  800c8b:	68 12 4c 80 00       	push   $0x804c12
+  800c90:	e8 b6 f4 ff ff       	call   80014b <_panic>
+
+00800c95 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800c95:	55                   	push   %ebp
+  800c96:	89 e5                	mov    %esp,%ebp
+  800c98:	57                   	push   %edi
+  800c99:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c9a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c9d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ca0:	b8 05 00 00 00       	mov    $0x5,%eax
+  800ca5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ca8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800cab:	ff 75 18             	push   0x18(%ebp)
+  800cae:	55                   	push   %ebp
+  800caf:	56                   	push   %esi
+  800cb0:	89 e5                	mov    %esp,%ebp
+  800cb2:	8d 35 ba 0c 80 00    	lea    0x800cba,%esi
+  800cb8:	0f 34                	sysenter
+
+00800cba <after_sysenter_label_593>:
+  800cba:	5e                   	pop    %esi
+  800cbb:	5d                   	pop    %ebp
+  800cbc:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800cbf:	85 c0                	test   %eax,%eax
+  800cc1:	7f 07                	jg     800cca <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800cc3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800cc6:	5b                   	pop    %ebx
+  800cc7:	5f                   	pop    %edi
+  800cc8:	5d                   	pop    %ebp
+  800cc9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cca:	83 ec 0c             	sub    $0xc,%esp
+  800ccd:	50                   	push   %eax
+  800cce:	6a 05                	push   $0x5
+  800cd0:	68 f5 4b 80 00       	push   $0x804bf5
+  800cd5:	6a 54                	push   $0x54
+  800cd7:	68 12 4c 80 00       	push   $0x804c12
+  800cdc:	e8 6a f4 ff ff       	call   80014b <_panic>
+
+00800ce1 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800ce1:	55                   	push   %ebp
+  800ce2:	89 e5                	mov    %esp,%ebp
+  800ce4:	57                   	push   %edi
+  800ce5:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ce6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ceb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cf1:	b8 06 00 00 00       	mov    $0x6,%eax
+  800cf6:	89 df                	mov    %ebx,%edi
+  800cf8:	6a 00                	push   $0x0
+  800cfa:	55                   	push   %ebp
+  800cfb:	56                   	push   %esi
+  800cfc:	89 e5                	mov    %esp,%ebp
+  800cfe:	8d 35 06 0d 80 00    	lea    0x800d06,%esi
+  800d04:	0f 34                	sysenter
+
+00800d06 <after_sysenter_label_704>:
+  800d06:	5e                   	pop    %esi
+  800d07:	5d                   	pop    %ebp
+  800d08:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d0b:	85 c0                	test   %eax,%eax
+  800d0d:	7f 07                	jg     800d16 <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d0f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d12:	5b                   	pop    %ebx
+  800d13:	5f                   	pop    %edi
+  800d14:	5d                   	pop    %ebp
+  800d15:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d16:	83 ec 0c             	sub    $0xc,%esp
+  800d19:	50                   	push   %eax
+  800d1a:	6a 06                	push   $0x6
+  800d1c:	68 f5 4b 80 00       	push   $0x804bf5
+  800d21:	6a 54                	push   $0x54
+  800d23:	68 12 4c 80 00       	push   $0x804c12
+  800d28:	e8 1e f4 ff ff       	call   80014b <_panic>
+
+00800d2d <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800d2d:	55                   	push   %ebp
+  800d2e:	89 e5                	mov    %esp,%ebp
+  800d30:	57                   	push   %edi
+  800d31:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d32:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d37:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d3a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d3d:	b8 08 00 00 00       	mov    $0x8,%eax
+  800d42:	89 df                	mov    %ebx,%edi
+  800d44:	6a 00                	push   $0x0
+  800d46:	55                   	push   %ebp
+  800d47:	56                   	push   %esi
+  800d48:	89 e5                	mov    %esp,%ebp
+  800d4a:	8d 35 52 0d 80 00    	lea    0x800d52,%esi
+  800d50:	0f 34                	sysenter
+
+00800d52 <after_sysenter_label_808>:
+  800d52:	5e                   	pop    %esi
+  800d53:	5d                   	pop    %ebp
+  800d54:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d57:	85 c0                	test   %eax,%eax
+  800d59:	7f 07                	jg     800d62 <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800d5b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d5e:	5b                   	pop    %ebx
+  800d5f:	5f                   	pop    %edi
+  800d60:	5d                   	pop    %ebp
+  800d61:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d62:	83 ec 0c             	sub    $0xc,%esp
+  800d65:	50                   	push   %eax
+  800d66:	6a 08                	push   $0x8
+  800d68:	68 f5 4b 80 00       	push   $0x804bf5
+  800d6d:	6a 54                	push   $0x54
+  800d6f:	68 12 4c 80 00       	push   $0x804c12
+  800d74:	e8 d2 f3 ff ff       	call   80014b <_panic>
+
+00800d79 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800d79:	55                   	push   %ebp
+  800d7a:	89 e5                	mov    %esp,%ebp
+  800d7c:	57                   	push   %edi
+  800d7d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d7e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d83:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d86:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d89:	b8 09 00 00 00       	mov    $0x9,%eax
+  800d8e:	89 df                	mov    %ebx,%edi
+  800d90:	6a 00                	push   $0x0
+  800d92:	55                   	push   %ebp
+  800d93:	56                   	push   %esi
+  800d94:	89 e5                	mov    %esp,%ebp
+  800d96:	8d 35 9e 0d 80 00    	lea    0x800d9e,%esi
+  800d9c:	0f 34                	sysenter
+
+00800d9e <after_sysenter_label_912>:
+  800d9e:	5e                   	pop    %esi
+  800d9f:	5d                   	pop    %ebp
+  800da0:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800da3:	85 c0                	test   %eax,%eax
+  800da5:	7f 07                	jg     800dae <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800da7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800daa:	5b                   	pop    %ebx
+  800dab:	5f                   	pop    %edi
+  800dac:	5d                   	pop    %ebp
+  800dad:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dae:	83 ec 0c             	sub    $0xc,%esp
+  800db1:	50                   	push   %eax
+  800db2:	6a 09                	push   $0x9
+  800db4:	68 f5 4b 80 00       	push   $0x804bf5
+  800db9:	6a 54                	push   $0x54
+  800dbb:	68 12 4c 80 00       	push   $0x804c12
+  800dc0:	e8 86 f3 ff ff       	call   80014b <_panic>
+
+00800dc5 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800dc5:	55                   	push   %ebp
+  800dc6:	89 e5                	mov    %esp,%ebp
+  800dc8:	57                   	push   %edi
+  800dc9:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800dca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dcf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dd5:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800dda:	89 df                	mov    %ebx,%edi
+  800ddc:	6a 00                	push   $0x0
+  800dde:	55                   	push   %ebp
+  800ddf:	56                   	push   %esi
+  800de0:	89 e5                	mov    %esp,%ebp
+  800de2:	8d 35 ea 0d 80 00    	lea    0x800dea,%esi
+  800de8:	0f 34                	sysenter
+
+00800dea <after_sysenter_label_1016>:
+  800dea:	5e                   	pop    %esi
+  800deb:	5d                   	pop    %ebp
+  800dec:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800def:	85 c0                	test   %eax,%eax
+  800df1:	7f 07                	jg     800dfa <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800df3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800df6:	5b                   	pop    %ebx
+  800df7:	5f                   	pop    %edi
+  800df8:	5d                   	pop    %ebp
+  800df9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dfa:	83 ec 0c             	sub    $0xc,%esp
+  800dfd:	50                   	push   %eax
+  800dfe:	6a 0a                	push   $0xa
+  800e00:	68 f5 4b 80 00       	push   $0x804bf5
+  800e05:	6a 54                	push   $0x54
+  800e07:	68 12 4c 80 00       	push   $0x804c12
+  800e0c:	e8 3a f3 ff ff       	call   80014b <_panic>
+
+00800e11 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800e11:	55                   	push   %ebp
+  800e12:	89 e5                	mov    %esp,%ebp
+  800e14:	57                   	push   %edi
+  800e15:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e16:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e19:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e1c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800e21:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e24:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e27:	6a 00                	push   $0x0
+  800e29:	55                   	push   %ebp
+  800e2a:	56                   	push   %esi
+  800e2b:	89 e5                	mov    %esp,%ebp
+  800e2d:	8d 35 35 0e 80 00    	lea    0x800e35,%esi
+  800e33:	0f 34                	sysenter
+
+00800e35 <after_sysenter_label_1126>:
+  800e35:	5e                   	pop    %esi
+  800e36:	5d                   	pop    %ebp
+  800e37:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800e3a:	5b                   	pop    %ebx
+  800e3b:	5f                   	pop    %edi
+  800e3c:	5d                   	pop    %ebp
+  800e3d:	c3                   	ret
+
+00800e3e <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800e3e:	55                   	push   %ebp
+  800e3f:	89 e5                	mov    %esp,%ebp
+  800e41:	57                   	push   %edi
+  800e42:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e43:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e46:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e4b:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e50:	89 cb                	mov    %ecx,%ebx
+  800e52:	89 cf                	mov    %ecx,%edi
+  800e54:	6a 00                	push   $0x0
+  800e56:	55                   	push   %ebp
+  800e57:	56                   	push   %esi
+  800e58:	89 e5                	mov    %esp,%ebp
+  800e5a:	8d 35 62 0e 80 00    	lea    0x800e62,%esi
+  800e60:	0f 34                	sysenter
+
+00800e62 <after_sysenter_label_1210>:
+  800e62:	5e                   	pop    %esi
+  800e63:	5d                   	pop    %ebp
+  800e64:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e67:	85 c0                	test   %eax,%eax
+  800e69:	7f 07                	jg     800e72 <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800e6b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e6e:	5b                   	pop    %ebx
+  800e6f:	5f                   	pop    %edi
+  800e70:	5d                   	pop    %ebp
+  800e71:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e72:	83 ec 0c             	sub    $0xc,%esp
+  800e75:	50                   	push   %eax
+  800e76:	6a 0d                	push   $0xd
+  800e78:	68 f5 4b 80 00       	push   $0x804bf5
+  800e7d:	6a 54                	push   $0x54
+  800e7f:	68 12 4c 80 00       	push   $0x804c12
+  800e84:	e8 c2 f2 ff ff       	call   80014b <_panic>
+
+00800e89 <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  800e89:	55                   	push   %ebp
+  800e8a:	89 e5                	mov    %esp,%ebp
+  800e8c:	57                   	push   %edi
+  800e8d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e8e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e93:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e96:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e99:	b8 42 00 00 00       	mov    $0x42,%eax
+  800e9e:	89 df                	mov    %ebx,%edi
+  800ea0:	6a 00                	push   $0x0
+  800ea2:	55                   	push   %ebp
+  800ea3:	56                   	push   %esi
+  800ea4:	89 e5                	mov    %esp,%ebp
+  800ea6:	8d 35 ae 0e 80 00    	lea    0x800eae,%esi
+  800eac:	0f 34                	sysenter
+
+00800eae <after_sysenter_label_1311>:
+  800eae:	5e                   	pop    %esi
+  800eaf:	5d                   	pop    %ebp
+  800eb0:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800eb3:	85 c0                	test   %eax,%eax
+  800eb5:	7f 07                	jg     800ebe <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  800eb7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800eba:	5b                   	pop    %ebx
+  800ebb:	5f                   	pop    %edi
+  800ebc:	5d                   	pop    %ebp
+  800ebd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ebe:	83 ec 0c             	sub    $0xc,%esp
+  800ec1:	50                   	push   %eax
+  800ec2:	6a 42                	push   $0x42
+  800ec4:	68 f5 4b 80 00       	push   $0x804bf5
+  800ec9:	6a 54                	push   $0x54
+  800ecb:	68 12 4c 80 00       	push   $0x804c12
+  800ed0:	e8 76 f2 ff ff       	call   80014b <_panic>
+
+00800ed5 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800ed5:	55                   	push   %ebp
+  800ed6:	89 e5                	mov    %esp,%ebp
+  800ed8:	57                   	push   %edi
+  800ed9:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800eda:	ba 00 00 00 00       	mov    $0x0,%edx
+  800edf:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800ee4:	89 d1                	mov    %edx,%ecx
+  800ee6:	89 d3                	mov    %edx,%ebx
+  800ee8:	89 d7                	mov    %edx,%edi
+  800eea:	6a 00                	push   $0x0
+  800eec:	55                   	push   %ebp
+  800eed:	56                   	push   %esi
+  800eee:	89 e5                	mov    %esp,%ebp
+  800ef0:	8d 35 f8 0e 80 00    	lea    0x800ef8,%esi
+  800ef6:	0f 34                	sysenter
+
+00800ef8 <after_sysenter_label_1411>:
+  800ef8:	5e                   	pop    %esi
+  800ef9:	5d                   	pop    %ebp
+  800efa:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800efd:	5b                   	pop    %ebx
+  800efe:	5f                   	pop    %edi
+  800eff:	5d                   	pop    %ebp
+  800f00:	c3                   	ret
+
+00800f01 <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  800f01:	55                   	push   %ebp
+  800f02:	89 e5                	mov    %esp,%ebp
+  800f04:	57                   	push   %edi
+  800f05:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f06:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f0b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f0e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f11:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f16:	89 df                	mov    %ebx,%edi
+  800f18:	6a 00                	push   $0x0
+  800f1a:	55                   	push   %ebp
+  800f1b:	56                   	push   %esi
+  800f1c:	89 e5                	mov    %esp,%ebp
+  800f1e:	8d 35 26 0f 80 00    	lea    0x800f26,%esi
+  800f24:	0f 34                	sysenter
+
+00800f26 <after_sysenter_label_1497>:
+  800f26:	5e                   	pop    %esi
+  800f27:	5d                   	pop    %ebp
+  800f28:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  800f2b:	5b                   	pop    %ebx
+  800f2c:	5f                   	pop    %edi
+  800f2d:	5d                   	pop    %ebp
+  800f2e:	c3                   	ret
+
+00800f2f <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  800f2f:	55                   	push   %ebp
+  800f30:	89 e5                	mov    %esp,%ebp
+  800f32:	57                   	push   %edi
+  800f33:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f34:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f39:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f3c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f3f:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f44:	89 df                	mov    %ebx,%edi
+  800f46:	6a 00                	push   $0x0
+  800f48:	55                   	push   %ebp
+  800f49:	56                   	push   %esi
+  800f4a:	89 e5                	mov    %esp,%ebp
+  800f4c:	8d 35 54 0f 80 00    	lea    0x800f54,%esi
+  800f52:	0f 34                	sysenter
+
+00800f54 <after_sysenter_label_1583>:
+  800f54:	5e                   	pop    %esi
+  800f55:	5d                   	pop    %ebp
+  800f56:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  800f59:	5b                   	pop    %ebx
+  800f5a:	5f                   	pop    %edi
+  800f5b:	5d                   	pop    %ebp
+  800f5c:	c3                   	ret
+
+00800f5d <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  800f5d:	55                   	push   %ebp
+  800f5e:	89 e5                	mov    %esp,%ebp
+  800f60:	57                   	push   %edi
+  800f61:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f62:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f65:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f68:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f6d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f72:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f75:	6a 00                	push   $0x0
+  800f77:	55                   	push   %ebp
+  800f78:	56                   	push   %esi
+  800f79:	89 e5                	mov    %esp,%ebp
+  800f7b:	8d 35 83 0f 80 00    	lea    0x800f83,%esi
+  800f81:	0f 34                	sysenter
+
+00800f83 <after_sysenter_label_1672>:
+  800f83:	5e                   	pop    %esi
+  800f84:	5d                   	pop    %ebp
+  800f85:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  800f88:	5b                   	pop    %ebx
+  800f89:	5f                   	pop    %edi
+  800f8a:	5d                   	pop    %ebp
+  800f8b:	c3                   	ret
+
+00800f8c <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  800f8c:	55                   	push   %ebp
+  800f8d:	89 e5                	mov    %esp,%ebp
+  800f8f:	57                   	push   %edi
+  800f90:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f91:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f96:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f99:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f9c:	b8 12 00 00 00       	mov    $0x12,%eax
+  800fa1:	89 df                	mov    %ebx,%edi
+  800fa3:	6a 00                	push   $0x0
+  800fa5:	55                   	push   %ebp
+  800fa6:	56                   	push   %esi
+  800fa7:	89 e5                	mov    %esp,%ebp
+  800fa9:	8d 35 b1 0f 80 00    	lea    0x800fb1,%esi
+  800faf:	0f 34                	sysenter
+
+00800fb1 <after_sysenter_label_1758>:
+  800fb1:	5e                   	pop    %esi
+  800fb2:	5d                   	pop    %ebp
+  800fb3:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  800fb6:	5b                   	pop    %ebx
+  800fb7:	5f                   	pop    %edi
+  800fb8:	5d                   	pop    %ebp
+  800fb9:	c3                   	ret
+
+00800fba <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  800fba:	55                   	push   %ebp
+  800fbb:	89 e5                	mov    %esp,%ebp
+  800fbd:	57                   	push   %edi
+  800fbe:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fbf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fc7:	b8 13 00 00 00       	mov    $0x13,%eax
+  800fcc:	89 cb                	mov    %ecx,%ebx
+  800fce:	89 cf                	mov    %ecx,%edi
+  800fd0:	6a 00                	push   $0x0
+  800fd2:	55                   	push   %ebp
+  800fd3:	56                   	push   %esi
+  800fd4:	89 e5                	mov    %esp,%ebp
+  800fd6:	8d 35 de 0f 80 00    	lea    0x800fde,%esi
+  800fdc:	0f 34                	sysenter
+
+00800fde <after_sysenter_label_1842>:
+  800fde:	5e                   	pop    %esi
+  800fdf:	5d                   	pop    %ebp
+  800fe0:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800fe3:	85 c0                	test   %eax,%eax
+  800fe5:	7f 07                	jg     800fee <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  800fe7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fea:	5b                   	pop    %ebx
+  800feb:	5f                   	pop    %edi
+  800fec:	5d                   	pop    %ebp
+  800fed:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fee:	83 ec 0c             	sub    $0xc,%esp
+  800ff1:	50                   	push   %eax
+  800ff2:	6a 13                	push   $0x13
+  800ff4:	68 f5 4b 80 00       	push   $0x804bf5
+  800ff9:	6a 54                	push   $0x54
+  800ffb:	68 12 4c 80 00       	push   $0x804c12
+  801000:	e8 46 f1 ff ff       	call   80014b <_panic>
+
+00801005 <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  801005:	55                   	push   %ebp
+  801006:	89 e5                	mov    %esp,%ebp
+  801008:	57                   	push   %edi
+  801009:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80100a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80100f:	b8 14 00 00 00       	mov    $0x14,%eax
+  801014:	89 d1                	mov    %edx,%ecx
+  801016:	89 d3                	mov    %edx,%ebx
+  801018:	89 d7                	mov    %edx,%edi
+  80101a:	6a 00                	push   $0x0
+  80101c:	55                   	push   %ebp
+  80101d:	56                   	push   %esi
+  80101e:	89 e5                	mov    %esp,%ebp
+  801020:	8d 35 28 10 80 00    	lea    0x801028,%esi
+  801026:	0f 34                	sysenter
+
+00801028 <after_sysenter_label_1939>:
+  801028:	5e                   	pop    %esi
+  801029:	5d                   	pop    %ebp
+  80102a:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  80102d:	5b                   	pop    %ebx
+  80102e:	5f                   	pop    %edi
+  80102f:	5d                   	pop    %ebp
+  801030:	c3                   	ret
+
+00801031 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  801031:	55                   	push   %ebp
+  801032:	89 e5                	mov    %esp,%ebp
+  801034:	57                   	push   %edi
+  801035:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801036:	8b 55 08             	mov    0x8(%ebp),%edx
+  801039:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80103c:	b8 15 00 00 00       	mov    $0x15,%eax
+  801041:	bf 00 00 00 00       	mov    $0x0,%edi
+  801046:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801049:	6a 00                	push   $0x0
+  80104b:	55                   	push   %ebp
+  80104c:	56                   	push   %esi
+  80104d:	89 e5                	mov    %esp,%ebp
+  80104f:	8d 35 57 10 80 00    	lea    0x801057,%esi
+  801055:	0f 34                	sysenter
+
+00801057 <after_sysenter_label_2028>:
+  801057:	5e                   	pop    %esi
+  801058:	5d                   	pop    %ebp
+  801059:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  80105c:	5b                   	pop    %ebx
+  80105d:	5f                   	pop    %edi
+  80105e:	5d                   	pop    %ebp
+  80105f:	c3                   	ret
+
+00801060 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  801060:	55                   	push   %ebp
+  801061:	89 e5                	mov    %esp,%ebp
+  801063:	57                   	push   %edi
+  801064:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801065:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80106a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80106d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801070:	b8 16 00 00 00       	mov    $0x16,%eax
+  801075:	89 df                	mov    %ebx,%edi
+  801077:	6a 00                	push   $0x0
+  801079:	55                   	push   %ebp
+  80107a:	56                   	push   %esi
+  80107b:	89 e5                	mov    %esp,%ebp
+  80107d:	8d 35 85 10 80 00    	lea    0x801085,%esi
+  801083:	0f 34                	sysenter
+
+00801085 <after_sysenter_label_2114>:
+  801085:	5e                   	pop    %esi
+  801086:	5d                   	pop    %ebp
+  801087:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  80108a:	5b                   	pop    %ebx
+  80108b:	5f                   	pop    %edi
+  80108c:	5d                   	pop    %ebp
+  80108d:	c3                   	ret
+
+0080108e <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  80108e:	55                   	push   %ebp
+  80108f:	89 e5                	mov    %esp,%ebp
+  801091:	57                   	push   %edi
+  801092:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801093:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801098:	8b 55 08             	mov    0x8(%ebp),%edx
+  80109b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80109e:	b8 17 00 00 00       	mov    $0x17,%eax
+  8010a3:	89 df                	mov    %ebx,%edi
+  8010a5:	6a 00                	push   $0x0
+  8010a7:	55                   	push   %ebp
+  8010a8:	56                   	push   %esi
+  8010a9:	89 e5                	mov    %esp,%ebp
+  8010ab:	8d 35 b3 10 80 00    	lea    0x8010b3,%esi
+  8010b1:	0f 34                	sysenter
+
+008010b3 <after_sysenter_label_2200>:
+  8010b3:	5e                   	pop    %esi
+  8010b4:	5d                   	pop    %ebp
+  8010b5:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  8010b8:	5b                   	pop    %ebx
+  8010b9:	5f                   	pop    %edi
+  8010ba:	5d                   	pop    %ebp
+  8010bb:	c3                   	ret
+
+008010bc <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  8010bc:	55                   	push   %ebp
+  8010bd:	89 e5                	mov    %esp,%ebp
+  8010bf:	57                   	push   %edi
+  8010c0:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010cc:	b8 18 00 00 00       	mov    $0x18,%eax
+  8010d1:	89 df                	mov    %ebx,%edi
+  8010d3:	6a 00                	push   $0x0
+  8010d5:	55                   	push   %ebp
+  8010d6:	56                   	push   %esi
+  8010d7:	89 e5                	mov    %esp,%ebp
+  8010d9:	8d 35 e1 10 80 00    	lea    0x8010e1,%esi
+  8010df:	0f 34                	sysenter
+
+008010e1 <after_sysenter_label_2286>:
+  8010e1:	5e                   	pop    %esi
+  8010e2:	5d                   	pop    %ebp
+  8010e3:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  8010e6:	5b                   	pop    %ebx
+  8010e7:	5f                   	pop    %edi
+  8010e8:	5d                   	pop    %ebp
+  8010e9:	c3                   	ret
+
+008010ea <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8010ea:	55                   	push   %ebp
+  8010eb:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8010ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010f0:	05 00 00 00 30       	add    $0x30000000,%eax
+  8010f5:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8010f8:	5d                   	pop    %ebp
+  8010f9:	c3                   	ret
+
+008010fa <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8010fa:	55                   	push   %ebp
+  8010fb:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8010fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801100:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801105:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80110a:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80110f:	5d                   	pop    %ebp
+  801110:	c3                   	ret
+
+00801111 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801111:	55                   	push   %ebp
+  801112:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801114:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801119:	eb 02                	jmp    80111d <fd_alloc+0xc>
+  80111b:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80111d:	89 c2                	mov    %eax,%edx
+  80111f:	c1 ea 16             	shr    $0x16,%edx
+  801122:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801129:	f6 c2 01             	test   $0x1,%dl
+  80112c:	74 2b                	je     801159 <fd_alloc+0x48>
+  80112e:	89 c2                	mov    %eax,%edx
+  801130:	c1 ea 0c             	shr    $0xc,%edx
+  801133:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80113a:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801140:	f6 c1 01             	test   $0x1,%cl
+  801143:	74 14                	je     801159 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801145:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80114b:	75 ce                	jne    80111b <fd_alloc+0xa>
+  80114d:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801152:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801157:	eb 05                	jmp    80115e <fd_alloc+0x4d>
+			return 0;
+  801159:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80115e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801161:	89 02                	mov    %eax,(%edx)
+}
+  801163:	89 c8                	mov    %ecx,%eax
+  801165:	5d                   	pop    %ebp
+  801166:	c3                   	ret
+
+00801167 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801167:	55                   	push   %ebp
+  801168:	89 e5                	mov    %esp,%ebp
+  80116a:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80116d:	83 f8 1f             	cmp    $0x1f,%eax
+  801170:	77 30                	ja     8011a2 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801172:	c1 e0 0c             	shl    $0xc,%eax
+  801175:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80117a:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801180:	f6 c2 01             	test   $0x1,%dl
+  801183:	74 24                	je     8011a9 <fd_lookup+0x42>
+  801185:	89 c2                	mov    %eax,%edx
+  801187:	c1 ea 0c             	shr    $0xc,%edx
+  80118a:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801191:	f6 c2 01             	test   $0x1,%dl
+  801194:	74 1a                	je     8011b0 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801196:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801199:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80119b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011a0:	5d                   	pop    %ebp
+  8011a1:	c3                   	ret
+		return -E_INVAL;
+  8011a2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011a7:	eb f7                	jmp    8011a0 <fd_lookup+0x39>
+		return -E_INVAL;
+  8011a9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011ae:	eb f0                	jmp    8011a0 <fd_lookup+0x39>
+  8011b0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011b5:	eb e9                	jmp    8011a0 <fd_lookup+0x39>
+
+008011b7 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8011b7:	55                   	push   %ebp
+  8011b8:	89 e5                	mov    %esp,%ebp
+  8011ba:	53                   	push   %ebx
+  8011bb:	83 ec 04             	sub    $0x4,%esp
+  8011be:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8011c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011c6:	eb 03                	jmp    8011cb <dev_lookup+0x14>
+  8011c8:	83 c0 01             	add    $0x1,%eax
+  8011cb:	8b 1c 85 9c 4c 80 00 	mov    0x804c9c(,%eax,4),%ebx
+  8011d2:	85 db                	test   %ebx,%ebx
+  8011d4:	74 0b                	je     8011e1 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8011d6:	39 13                	cmp    %edx,(%ebx)
+  8011d8:	75 ee                	jne    8011c8 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8011da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011df:	eb 49                	jmp    80122a <dev_lookup+0x73>
+  8011e1:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8011e3:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  8011e9:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8011ee:	77 18                	ja     801208 <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8011f0:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8011f5:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  8011f7:	c1 e8 10             	shr    $0x10,%eax
+  8011fa:	74 0c                	je     801208 <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8011fc:	c1 e0 10             	shl    $0x10,%eax
+  8011ff:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  801204:	29 c1                	sub    %eax,%ecx
+  801206:	eb 06                	jmp    80120e <dev_lookup+0x57>
+		return pthread_main_tls;
+  801208:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80120e:	8b 01                	mov    (%ecx),%eax
+  801210:	8b 40 48             	mov    0x48(%eax),%eax
+  801213:	83 ec 04             	sub    $0x4,%esp
+  801216:	52                   	push   %edx
+  801217:	50                   	push   %eax
+  801218:	68 20 4c 80 00       	push   $0x804c20
+  80121d:	e8 04 f0 ff ff       	call   800226 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801222:	83 c4 10             	add    $0x10,%esp
+  801225:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80122a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80122d:	89 1a                	mov    %ebx,(%edx)
+}
+  80122f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801232:	c9                   	leave
+  801233:	c3                   	ret
+
+00801234 <fd_close>:
+{
+  801234:	55                   	push   %ebp
+  801235:	89 e5                	mov    %esp,%ebp
+  801237:	57                   	push   %edi
+  801238:	56                   	push   %esi
+  801239:	53                   	push   %ebx
+  80123a:	83 ec 24             	sub    $0x24,%esp
+  80123d:	8b 75 08             	mov    0x8(%ebp),%esi
+  801240:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801243:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801246:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801247:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80124d:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801250:	50                   	push   %eax
+  801251:	e8 11 ff ff ff       	call   801167 <fd_lookup>
+  801256:	89 c3                	mov    %eax,%ebx
+  801258:	83 c4 10             	add    $0x10,%esp
+  80125b:	85 c0                	test   %eax,%eax
+  80125d:	78 05                	js     801264 <fd_close+0x30>
+	    || fd != fd2)
+  80125f:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801262:	74 16                	je     80127a <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801264:	89 f8                	mov    %edi,%eax
+  801266:	84 c0                	test   %al,%al
+  801268:	b8 00 00 00 00       	mov    $0x0,%eax
+  80126d:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801270:	89 d8                	mov    %ebx,%eax
+  801272:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801275:	5b                   	pop    %ebx
+  801276:	5e                   	pop    %esi
+  801277:	5f                   	pop    %edi
+  801278:	5d                   	pop    %ebp
+  801279:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80127a:	83 ec 08             	sub    $0x8,%esp
+  80127d:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801280:	50                   	push   %eax
+  801281:	ff 36                	push   (%esi)
+  801283:	e8 2f ff ff ff       	call   8011b7 <dev_lookup>
+  801288:	89 c3                	mov    %eax,%ebx
+  80128a:	83 c4 10             	add    $0x10,%esp
+  80128d:	85 c0                	test   %eax,%eax
+  80128f:	78 1a                	js     8012ab <fd_close+0x77>
+		if (dev->dev_close)
+  801291:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801294:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801297:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80129c:	85 c0                	test   %eax,%eax
+  80129e:	74 0b                	je     8012ab <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8012a0:	83 ec 0c             	sub    $0xc,%esp
+  8012a3:	56                   	push   %esi
+  8012a4:	ff d0                	call   *%eax
+  8012a6:	89 c3                	mov    %eax,%ebx
+  8012a8:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8012ab:	83 ec 08             	sub    $0x8,%esp
+  8012ae:	56                   	push   %esi
+  8012af:	6a 00                	push   $0x0
+  8012b1:	e8 2b fa ff ff       	call   800ce1 <sys_page_unmap>
+	return r;
+  8012b6:	83 c4 10             	add    $0x10,%esp
+  8012b9:	eb b5                	jmp    801270 <fd_close+0x3c>
+
+008012bb <close>:
+
+int
+close(int fdnum)
+{
+  8012bb:	55                   	push   %ebp
+  8012bc:	89 e5                	mov    %esp,%ebp
+  8012be:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8012c1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8012c4:	50                   	push   %eax
+  8012c5:	ff 75 08             	push   0x8(%ebp)
+  8012c8:	e8 9a fe ff ff       	call   801167 <fd_lookup>
+  8012cd:	83 c4 10             	add    $0x10,%esp
+  8012d0:	85 c0                	test   %eax,%eax
+  8012d2:	79 02                	jns    8012d6 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8012d4:	c9                   	leave
+  8012d5:	c3                   	ret
+		return fd_close(fd, 1);
+  8012d6:	83 ec 08             	sub    $0x8,%esp
+  8012d9:	6a 01                	push   $0x1
+  8012db:	ff 75 f4             	push   -0xc(%ebp)
+  8012de:	e8 51 ff ff ff       	call   801234 <fd_close>
+  8012e3:	83 c4 10             	add    $0x10,%esp
+  8012e6:	eb ec                	jmp    8012d4 <close+0x19>
+
+008012e8 <close_all>:
+
+void
+close_all(void)
+{
+  8012e8:	55                   	push   %ebp
+  8012e9:	89 e5                	mov    %esp,%ebp
+  8012eb:	53                   	push   %ebx
+  8012ec:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8012ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8012f4:	83 ec 0c             	sub    $0xc,%esp
+  8012f7:	53                   	push   %ebx
+  8012f8:	e8 be ff ff ff       	call   8012bb <close>
+	for (i = 0; i < MAXFD; i++)
+  8012fd:	83 c3 01             	add    $0x1,%ebx
+  801300:	83 c4 10             	add    $0x10,%esp
+  801303:	83 fb 20             	cmp    $0x20,%ebx
+  801306:	75 ec                	jne    8012f4 <close_all+0xc>
+}
+  801308:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80130b:	c9                   	leave
+  80130c:	c3                   	ret
+
+0080130d <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80130d:	55                   	push   %ebp
+  80130e:	89 e5                	mov    %esp,%ebp
+  801310:	57                   	push   %edi
+  801311:	56                   	push   %esi
+  801312:	53                   	push   %ebx
+  801313:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801316:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801319:	50                   	push   %eax
+  80131a:	ff 75 08             	push   0x8(%ebp)
+  80131d:	e8 45 fe ff ff       	call   801167 <fd_lookup>
+  801322:	89 c3                	mov    %eax,%ebx
+  801324:	83 c4 10             	add    $0x10,%esp
+  801327:	85 c0                	test   %eax,%eax
+  801329:	78 7f                	js     8013aa <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80132b:	83 ec 0c             	sub    $0xc,%esp
+  80132e:	ff 75 0c             	push   0xc(%ebp)
+  801331:	e8 85 ff ff ff       	call   8012bb <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801336:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801339:	c1 e6 0c             	shl    $0xc,%esi
+  80133c:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801342:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801345:	89 3c 24             	mov    %edi,(%esp)
+  801348:	e8 ad fd ff ff       	call   8010fa <fd2data>
+  80134d:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80134f:	89 34 24             	mov    %esi,(%esp)
+  801352:	e8 a3 fd ff ff       	call   8010fa <fd2data>
+  801357:	83 c4 10             	add    $0x10,%esp
+  80135a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80135d:	89 d8                	mov    %ebx,%eax
+  80135f:	c1 e8 16             	shr    $0x16,%eax
+  801362:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801369:	a8 01                	test   $0x1,%al
+  80136b:	74 11                	je     80137e <dup+0x71>
+  80136d:	89 d8                	mov    %ebx,%eax
+  80136f:	c1 e8 0c             	shr    $0xc,%eax
+  801372:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801379:	f6 c2 01             	test   $0x1,%dl
+  80137c:	75 36                	jne    8013b4 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80137e:	89 f8                	mov    %edi,%eax
+  801380:	c1 e8 0c             	shr    $0xc,%eax
+  801383:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80138a:	83 ec 0c             	sub    $0xc,%esp
+  80138d:	25 07 0e 00 00       	and    $0xe07,%eax
+  801392:	50                   	push   %eax
+  801393:	56                   	push   %esi
+  801394:	6a 00                	push   $0x0
+  801396:	57                   	push   %edi
+  801397:	6a 00                	push   $0x0
+  801399:	e8 f7 f8 ff ff       	call   800c95 <sys_page_map>
+  80139e:	89 c3                	mov    %eax,%ebx
+  8013a0:	83 c4 20             	add    $0x20,%esp
+  8013a3:	85 c0                	test   %eax,%eax
+  8013a5:	78 33                	js     8013da <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8013a7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8013aa:	89 d8                	mov    %ebx,%eax
+  8013ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013af:	5b                   	pop    %ebx
+  8013b0:	5e                   	pop    %esi
+  8013b1:	5f                   	pop    %edi
+  8013b2:	5d                   	pop    %ebp
+  8013b3:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8013b4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8013bb:	83 ec 0c             	sub    $0xc,%esp
+  8013be:	25 07 0e 00 00       	and    $0xe07,%eax
+  8013c3:	50                   	push   %eax
+  8013c4:	ff 75 d4             	push   -0x2c(%ebp)
+  8013c7:	6a 00                	push   $0x0
+  8013c9:	53                   	push   %ebx
+  8013ca:	6a 00                	push   $0x0
+  8013cc:	e8 c4 f8 ff ff       	call   800c95 <sys_page_map>
+  8013d1:	89 c3                	mov    %eax,%ebx
+  8013d3:	83 c4 20             	add    $0x20,%esp
+  8013d6:	85 c0                	test   %eax,%eax
+  8013d8:	79 a4                	jns    80137e <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8013da:	83 ec 08             	sub    $0x8,%esp
+  8013dd:	56                   	push   %esi
+  8013de:	6a 00                	push   $0x0
+  8013e0:	e8 fc f8 ff ff       	call   800ce1 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8013e5:	83 c4 08             	add    $0x8,%esp
+  8013e8:	ff 75 d4             	push   -0x2c(%ebp)
+  8013eb:	6a 00                	push   $0x0
+  8013ed:	e8 ef f8 ff ff       	call   800ce1 <sys_page_unmap>
+	return r;
+  8013f2:	83 c4 10             	add    $0x10,%esp
+  8013f5:	eb b3                	jmp    8013aa <dup+0x9d>
+
+008013f7 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8013f7:	55                   	push   %ebp
+  8013f8:	89 e5                	mov    %esp,%ebp
+  8013fa:	56                   	push   %esi
+  8013fb:	53                   	push   %ebx
+  8013fc:	83 ec 18             	sub    $0x18,%esp
+  8013ff:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801402:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801405:	50                   	push   %eax
+  801406:	53                   	push   %ebx
+  801407:	e8 5b fd ff ff       	call   801167 <fd_lookup>
+  80140c:	83 c4 10             	add    $0x10,%esp
+  80140f:	85 c0                	test   %eax,%eax
+  801411:	78 3c                	js     80144f <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801413:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801416:	83 ec 08             	sub    $0x8,%esp
+  801419:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80141c:	50                   	push   %eax
+  80141d:	ff 36                	push   (%esi)
+  80141f:	e8 93 fd ff ff       	call   8011b7 <dev_lookup>
+  801424:	83 c4 10             	add    $0x10,%esp
+  801427:	85 c0                	test   %eax,%eax
+  801429:	78 24                	js     80144f <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80142b:	8b 46 08             	mov    0x8(%esi),%eax
+  80142e:	83 e0 03             	and    $0x3,%eax
+  801431:	83 f8 01             	cmp    $0x1,%eax
+  801434:	74 20                	je     801456 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801436:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801439:	8b 40 08             	mov    0x8(%eax),%eax
+  80143c:	85 c0                	test   %eax,%eax
+  80143e:	74 61                	je     8014a1 <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801440:	83 ec 04             	sub    $0x4,%esp
+  801443:	ff 75 10             	push   0x10(%ebp)
+  801446:	ff 75 0c             	push   0xc(%ebp)
+  801449:	56                   	push   %esi
+  80144a:	ff d0                	call   *%eax
+  80144c:	83 c4 10             	add    $0x10,%esp
+}
+  80144f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801452:	5b                   	pop    %ebx
+  801453:	5e                   	pop    %esi
+  801454:	5d                   	pop    %ebp
+  801455:	c3                   	ret
+  801456:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801458:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80145e:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801463:	77 18                	ja     80147d <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801465:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80146a:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80146c:	c1 e8 10             	shr    $0x10,%eax
+  80146f:	74 0c                	je     80147d <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801471:	c1 e0 10             	shl    $0x10,%eax
+  801474:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801479:	29 c2                	sub    %eax,%edx
+  80147b:	eb 06                	jmp    801483 <read+0x8c>
+		return pthread_main_tls;
+  80147d:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801483:	8b 02                	mov    (%edx),%eax
+  801485:	8b 40 48             	mov    0x48(%eax),%eax
+  801488:	83 ec 04             	sub    $0x4,%esp
+  80148b:	53                   	push   %ebx
+  80148c:	50                   	push   %eax
+  80148d:	68 61 4c 80 00       	push   $0x804c61
+  801492:	e8 8f ed ff ff       	call   800226 <cprintf>
+		return -E_INVAL;
+  801497:	83 c4 10             	add    $0x10,%esp
+  80149a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80149f:	eb ae                	jmp    80144f <read+0x58>
+		return -E_NOT_SUPP;
+  8014a1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8014a6:	eb a7                	jmp    80144f <read+0x58>
+
+008014a8 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8014a8:	55                   	push   %ebp
+  8014a9:	89 e5                	mov    %esp,%ebp
+  8014ab:	57                   	push   %edi
+  8014ac:	56                   	push   %esi
+  8014ad:	53                   	push   %ebx
+  8014ae:	83 ec 0c             	sub    $0xc,%esp
+  8014b1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8014b4:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8014b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014bc:	eb 02                	jmp    8014c0 <readn+0x18>
+  8014be:	01 c3                	add    %eax,%ebx
+  8014c0:	39 f3                	cmp    %esi,%ebx
+  8014c2:	73 21                	jae    8014e5 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8014c4:	83 ec 04             	sub    $0x4,%esp
+  8014c7:	89 f0                	mov    %esi,%eax
+  8014c9:	29 d8                	sub    %ebx,%eax
+  8014cb:	50                   	push   %eax
+  8014cc:	89 d8                	mov    %ebx,%eax
+  8014ce:	03 45 0c             	add    0xc(%ebp),%eax
+  8014d1:	50                   	push   %eax
+  8014d2:	57                   	push   %edi
+  8014d3:	e8 1f ff ff ff       	call   8013f7 <read>
+		if (m < 0)
+  8014d8:	83 c4 10             	add    $0x10,%esp
+  8014db:	85 c0                	test   %eax,%eax
+  8014dd:	78 04                	js     8014e3 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8014df:	75 dd                	jne    8014be <readn+0x16>
+  8014e1:	eb 02                	jmp    8014e5 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8014e3:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8014e5:	89 d8                	mov    %ebx,%eax
+  8014e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014ea:	5b                   	pop    %ebx
+  8014eb:	5e                   	pop    %esi
+  8014ec:	5f                   	pop    %edi
+  8014ed:	5d                   	pop    %ebp
+  8014ee:	c3                   	ret
+
+008014ef <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8014ef:	55                   	push   %ebp
+  8014f0:	89 e5                	mov    %esp,%ebp
+  8014f2:	56                   	push   %esi
+  8014f3:	53                   	push   %ebx
+  8014f4:	83 ec 18             	sub    $0x18,%esp
+  8014f7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014fa:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014fd:	50                   	push   %eax
+  8014fe:	53                   	push   %ebx
+  8014ff:	e8 63 fc ff ff       	call   801167 <fd_lookup>
+  801504:	83 c4 10             	add    $0x10,%esp
+  801507:	85 c0                	test   %eax,%eax
+  801509:	78 37                	js     801542 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80150b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80150e:	83 ec 08             	sub    $0x8,%esp
+  801511:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801514:	50                   	push   %eax
+  801515:	ff 36                	push   (%esi)
+  801517:	e8 9b fc ff ff       	call   8011b7 <dev_lookup>
+  80151c:	83 c4 10             	add    $0x10,%esp
+  80151f:	85 c0                	test   %eax,%eax
+  801521:	78 1f                	js     801542 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801523:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801527:	74 20                	je     801549 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801529:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80152c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80152f:	85 c0                	test   %eax,%eax
+  801531:	74 61                	je     801594 <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801533:	83 ec 04             	sub    $0x4,%esp
+  801536:	ff 75 10             	push   0x10(%ebp)
+  801539:	ff 75 0c             	push   0xc(%ebp)
+  80153c:	56                   	push   %esi
+  80153d:	ff d0                	call   *%eax
+  80153f:	83 c4 10             	add    $0x10,%esp
+}
+  801542:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801545:	5b                   	pop    %ebx
+  801546:	5e                   	pop    %esi
+  801547:	5d                   	pop    %ebp
+  801548:	c3                   	ret
+  801549:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80154b:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801551:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801556:	77 18                	ja     801570 <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801558:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80155d:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80155f:	c1 e8 10             	shr    $0x10,%eax
+  801562:	74 0c                	je     801570 <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801564:	c1 e0 10             	shl    $0x10,%eax
+  801567:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80156c:	29 c2                	sub    %eax,%edx
+  80156e:	eb 06                	jmp    801576 <write+0x87>
+		return pthread_main_tls;
+  801570:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801576:	8b 02                	mov    (%edx),%eax
+  801578:	8b 40 48             	mov    0x48(%eax),%eax
+  80157b:	83 ec 04             	sub    $0x4,%esp
+  80157e:	53                   	push   %ebx
+  80157f:	50                   	push   %eax
+  801580:	68 7d 4c 80 00       	push   $0x804c7d
+  801585:	e8 9c ec ff ff       	call   800226 <cprintf>
+		return -E_INVAL;
+  80158a:	83 c4 10             	add    $0x10,%esp
+  80158d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801592:	eb ae                	jmp    801542 <write+0x53>
+		return -E_NOT_SUPP;
+  801594:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801599:	eb a7                	jmp    801542 <write+0x53>
+
+0080159b <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80159b:	55                   	push   %ebp
+  80159c:	89 e5                	mov    %esp,%ebp
+  80159e:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8015a1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015a4:	50                   	push   %eax
+  8015a5:	ff 75 08             	push   0x8(%ebp)
+  8015a8:	e8 ba fb ff ff       	call   801167 <fd_lookup>
+  8015ad:	83 c4 10             	add    $0x10,%esp
+  8015b0:	85 c0                	test   %eax,%eax
+  8015b2:	78 0e                	js     8015c2 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8015b4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8015b7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015ba:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8015bd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015c2:	c9                   	leave
+  8015c3:	c3                   	ret
+
+008015c4 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8015c4:	55                   	push   %ebp
+  8015c5:	89 e5                	mov    %esp,%ebp
+  8015c7:	56                   	push   %esi
+  8015c8:	53                   	push   %ebx
+  8015c9:	83 ec 18             	sub    $0x18,%esp
+  8015cc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015cf:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015d2:	50                   	push   %eax
+  8015d3:	53                   	push   %ebx
+  8015d4:	e8 8e fb ff ff       	call   801167 <fd_lookup>
+  8015d9:	83 c4 10             	add    $0x10,%esp
+  8015dc:	85 c0                	test   %eax,%eax
+  8015de:	78 34                	js     801614 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015e0:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8015e3:	83 ec 08             	sub    $0x8,%esp
+  8015e6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015e9:	50                   	push   %eax
+  8015ea:	ff 36                	push   (%esi)
+  8015ec:	e8 c6 fb ff ff       	call   8011b7 <dev_lookup>
+  8015f1:	83 c4 10             	add    $0x10,%esp
+  8015f4:	85 c0                	test   %eax,%eax
+  8015f6:	78 1c                	js     801614 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8015f8:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8015fc:	74 1d                	je     80161b <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8015fe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801601:	8b 40 18             	mov    0x18(%eax),%eax
+  801604:	85 c0                	test   %eax,%eax
+  801606:	74 5e                	je     801666 <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801608:	83 ec 08             	sub    $0x8,%esp
+  80160b:	ff 75 0c             	push   0xc(%ebp)
+  80160e:	56                   	push   %esi
+  80160f:	ff d0                	call   *%eax
+  801611:	83 c4 10             	add    $0x10,%esp
+}
+  801614:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801617:	5b                   	pop    %ebx
+  801618:	5e                   	pop    %esi
+  801619:	5d                   	pop    %ebp
+  80161a:	c3                   	ret
+  80161b:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80161d:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801623:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801628:	77 18                	ja     801642 <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80162a:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80162f:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801631:	c1 e8 10             	shr    $0x10,%eax
+  801634:	74 0c                	je     801642 <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801636:	c1 e0 10             	shl    $0x10,%eax
+  801639:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80163e:	29 c2                	sub    %eax,%edx
+  801640:	eb 06                	jmp    801648 <ftruncate+0x84>
+		return pthread_main_tls;
+  801642:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+			thisenv->env_id, fdnum);
+  801648:	8b 02                	mov    (%edx),%eax
+  80164a:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80164d:	83 ec 04             	sub    $0x4,%esp
+  801650:	53                   	push   %ebx
+  801651:	50                   	push   %eax
+  801652:	68 40 4c 80 00       	push   $0x804c40
+  801657:	e8 ca eb ff ff       	call   800226 <cprintf>
+		return -E_INVAL;
+  80165c:	83 c4 10             	add    $0x10,%esp
+  80165f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801664:	eb ae                	jmp    801614 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801666:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80166b:	eb a7                	jmp    801614 <ftruncate+0x50>
+
+0080166d <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80166d:	55                   	push   %ebp
+  80166e:	89 e5                	mov    %esp,%ebp
+  801670:	56                   	push   %esi
+  801671:	53                   	push   %ebx
+  801672:	83 ec 18             	sub    $0x18,%esp
+  801675:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801678:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80167b:	50                   	push   %eax
+  80167c:	ff 75 08             	push   0x8(%ebp)
+  80167f:	e8 e3 fa ff ff       	call   801167 <fd_lookup>
+  801684:	83 c4 10             	add    $0x10,%esp
+  801687:	85 c0                	test   %eax,%eax
+  801689:	78 49                	js     8016d4 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80168b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80168e:	83 ec 08             	sub    $0x8,%esp
+  801691:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801694:	50                   	push   %eax
+  801695:	ff 36                	push   (%esi)
+  801697:	e8 1b fb ff ff       	call   8011b7 <dev_lookup>
+  80169c:	83 c4 10             	add    $0x10,%esp
+  80169f:	85 c0                	test   %eax,%eax
+  8016a1:	78 31                	js     8016d4 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8016a3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016a6:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8016aa:	74 2f                	je     8016db <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8016ac:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8016af:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8016b6:	00 00 00 
+	stat->st_isdir = 0;
+  8016b9:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8016c0:	00 00 00 
+	stat->st_dev = dev;
+  8016c3:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8016c9:	83 ec 08             	sub    $0x8,%esp
+  8016cc:	53                   	push   %ebx
+  8016cd:	56                   	push   %esi
+  8016ce:	ff 50 14             	call   *0x14(%eax)
+  8016d1:	83 c4 10             	add    $0x10,%esp
+}
+  8016d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016d7:	5b                   	pop    %ebx
+  8016d8:	5e                   	pop    %esi
+  8016d9:	5d                   	pop    %ebp
+  8016da:	c3                   	ret
+		return -E_NOT_SUPP;
+  8016db:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016e0:	eb f2                	jmp    8016d4 <fstat+0x67>
+
+008016e2 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8016e2:	55                   	push   %ebp
+  8016e3:	89 e5                	mov    %esp,%ebp
+  8016e5:	56                   	push   %esi
+  8016e6:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8016e7:	83 ec 08             	sub    $0x8,%esp
+  8016ea:	6a 00                	push   $0x0
+  8016ec:	ff 75 08             	push   0x8(%ebp)
+  8016ef:	e8 4b 03 00 00       	call   801a3f <open>
+  8016f4:	89 c3                	mov    %eax,%ebx
+  8016f6:	83 c4 10             	add    $0x10,%esp
+  8016f9:	85 c0                	test   %eax,%eax
+  8016fb:	78 1b                	js     801718 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8016fd:	83 ec 08             	sub    $0x8,%esp
+  801700:	ff 75 0c             	push   0xc(%ebp)
+  801703:	50                   	push   %eax
+  801704:	e8 64 ff ff ff       	call   80166d <fstat>
+  801709:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80170b:	89 1c 24             	mov    %ebx,(%esp)
+  80170e:	e8 a8 fb ff ff       	call   8012bb <close>
+	return r;
+  801713:	83 c4 10             	add    $0x10,%esp
+  801716:	89 f3                	mov    %esi,%ebx
+}
+  801718:	89 d8                	mov    %ebx,%eax
+  80171a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80171d:	5b                   	pop    %ebx
+  80171e:	5e                   	pop    %esi
+  80171f:	5d                   	pop    %ebp
+  801720:	c3                   	ret
+
+00801721 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801721:	55                   	push   %ebp
+  801722:	89 e5                	mov    %esp,%ebp
+  801724:	56                   	push   %esi
+  801725:	53                   	push   %ebx
+  801726:	89 c6                	mov    %eax,%esi
+  801728:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  80172a:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  801731:	74 27                	je     80175a <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801733:	6a 07                	push   $0x7
+  801735:	68 00 70 80 00       	push   $0x807000
+  80173a:	56                   	push   %esi
+  80173b:	ff 35 00 60 80 00    	push   0x806000
+  801741:	e8 07 2d 00 00       	call   80444d <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801746:	83 c4 0c             	add    $0xc,%esp
+  801749:	6a 00                	push   $0x0
+  80174b:	53                   	push   %ebx
+  80174c:	6a 00                	push   $0x0
+  80174e:	e8 04 2c 00 00       	call   804357 <ipc_recv>
+}
+  801753:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801756:	5b                   	pop    %ebx
+  801757:	5e                   	pop    %esi
+  801758:	5d                   	pop    %ebp
+  801759:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80175a:	83 ec 0c             	sub    $0xc,%esp
+  80175d:	6a 01                	push   $0x1
+  80175f:	e8 3f 2d 00 00       	call   8044a3 <ipc_find_env>
+  801764:	a3 00 60 80 00       	mov    %eax,0x806000
+  801769:	83 c4 10             	add    $0x10,%esp
+  80176c:	eb c5                	jmp    801733 <fsipc+0x12>
+
+0080176e <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80176e:	55                   	push   %ebp
+  80176f:	89 e5                	mov    %esp,%ebp
+  801771:	53                   	push   %ebx
+  801772:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801775:	68 04 60 80 00       	push   $0x806004
+  80177a:	e8 e2 1b 00 00       	call   803361 <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80177f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801782:	8b 40 0c             	mov    0xc(%eax),%eax
+  801785:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  80178a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80178d:	a3 04 70 80 00       	mov    %eax,0x807004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  801792:	ba 00 00 00 00       	mov    $0x0,%edx
+  801797:	b8 02 00 00 00       	mov    $0x2,%eax
+  80179c:	e8 80 ff ff ff       	call   801721 <fsipc>
+  8017a1:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8017a3:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  8017aa:	e8 1f 1c 00 00       	call   8033ce <mutex_unlock>
+	return r;
+}
+  8017af:	89 d8                	mov    %ebx,%eax
+  8017b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017b4:	c9                   	leave
+  8017b5:	c3                   	ret
+
+008017b6 <devfile_flush>:
+{
+  8017b6:	55                   	push   %ebp
+  8017b7:	89 e5                	mov    %esp,%ebp
+  8017b9:	53                   	push   %ebx
+  8017ba:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  8017bd:	68 04 60 80 00       	push   $0x806004
+  8017c2:	e8 9a 1b 00 00       	call   803361 <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8017c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017ca:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017cd:	a3 00 70 80 00       	mov    %eax,0x807000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  8017d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017d7:	b8 06 00 00 00       	mov    $0x6,%eax
+  8017dc:	e8 40 ff ff ff       	call   801721 <fsipc>
+  8017e1:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8017e3:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  8017ea:	e8 df 1b 00 00       	call   8033ce <mutex_unlock>
+}
+  8017ef:	89 d8                	mov    %ebx,%eax
+  8017f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017f4:	c9                   	leave
+  8017f5:	c3                   	ret
+
+008017f6 <devfile_stat>:
+{
+  8017f6:	55                   	push   %ebp
+  8017f7:	89 e5                	mov    %esp,%ebp
+  8017f9:	56                   	push   %esi
+  8017fa:	53                   	push   %ebx
+  8017fb:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  8017fe:	83 ec 0c             	sub    $0xc,%esp
+  801801:	68 04 60 80 00       	push   $0x806004
+  801806:	e8 56 1b 00 00       	call   803361 <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80180b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80180e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801811:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  801816:	ba 00 00 00 00       	mov    $0x0,%edx
+  80181b:	b8 05 00 00 00       	mov    $0x5,%eax
+  801820:	e8 fc fe ff ff       	call   801721 <fsipc>
+  801825:	89 c3                	mov    %eax,%ebx
+  801827:	83 c4 10             	add    $0x10,%esp
+  80182a:	85 c0                	test   %eax,%eax
+  80182c:	79 16                	jns    801844 <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  80182e:	83 ec 0c             	sub    $0xc,%esp
+  801831:	68 04 60 80 00       	push   $0x806004
+  801836:	e8 93 1b 00 00       	call   8033ce <mutex_unlock>
+}
+  80183b:	89 d8                	mov    %ebx,%eax
+  80183d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801840:	5b                   	pop    %ebx
+  801841:	5e                   	pop    %esi
+  801842:	5d                   	pop    %ebp
+  801843:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801844:	83 ec 08             	sub    $0x8,%esp
+  801847:	68 00 70 80 00       	push   $0x807000
+  80184c:	56                   	push   %esi
+  80184d:	e8 b8 ef ff ff       	call   80080a <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  801852:	a1 80 70 80 00       	mov    0x807080,%eax
+  801857:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80185d:	a1 84 70 80 00       	mov    0x807084,%eax
+  801862:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  801868:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  80186b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801870:	eb bc                	jmp    80182e <devfile_stat+0x38>
+
+00801872 <devfile_write>:
+{
+  801872:	55                   	push   %ebp
+  801873:	89 e5                	mov    %esp,%ebp
+  801875:	53                   	push   %ebx
+  801876:	83 ec 10             	sub    $0x10,%esp
+  801879:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  80187c:	68 04 60 80 00       	push   $0x806004
+  801881:	e8 db 1a 00 00       	call   803361 <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801886:	8b 45 08             	mov    0x8(%ebp),%eax
+  801889:	8b 40 0c             	mov    0xc(%eax),%eax
+  80188c:	a3 00 70 80 00       	mov    %eax,0x807000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801891:	83 c4 10             	add    $0x10,%esp
+  801894:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  80189a:	76 3d                	jbe    8018d9 <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  80189c:	b8 00 00 10 00       	mov    $0x100000,%eax
+  8018a1:	39 c3                	cmp    %eax,%ebx
+  8018a3:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  8018a6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8018a9:	a3 08 70 80 00       	mov    %eax,0x807008
+	fsipcbuf.write.req_n = n;
+  8018ae:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	r = fsipc(FSREQ_WRITE, NULL);
+  8018b4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018b9:	b8 04 00 00 00       	mov    $0x4,%eax
+  8018be:	e8 5e fe ff ff       	call   801721 <fsipc>
+  8018c3:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8018c5:	83 ec 0c             	sub    $0xc,%esp
+  8018c8:	68 04 60 80 00       	push   $0x806004
+  8018cd:	e8 fc 1a 00 00       	call   8033ce <mutex_unlock>
+}
+  8018d2:	89 d8                	mov    %ebx,%eax
+  8018d4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018d7:	c9                   	leave
+  8018d8:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  8018d9:	83 ec 04             	sub    $0x4,%esp
+  8018dc:	53                   	push   %ebx
+  8018dd:	ff 75 0c             	push   0xc(%ebp)
+  8018e0:	68 0c 70 80 00       	push   $0x80700c
+  8018e5:	e8 a6 f0 ff ff       	call   800990 <memmove>
+  8018ea:	83 c4 10             	add    $0x10,%esp
+  8018ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018f2:	eb b5                	jmp    8018a9 <devfile_write+0x37>
+
+008018f4 <devfile_read>:
+{
+  8018f4:	55                   	push   %ebp
+  8018f5:	89 e5                	mov    %esp,%ebp
+  8018f7:	57                   	push   %edi
+  8018f8:	56                   	push   %esi
+  8018f9:	53                   	push   %ebx
+  8018fa:	83 ec 0c             	sub    $0xc,%esp
+  8018fd:	8b 75 08             	mov    0x8(%ebp),%esi
+  801900:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801903:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  801906:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  80190c:	0f 86 8c 00 00 00    	jbe    80199e <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  801912:	b8 00 00 10 00       	mov    $0x100000,%eax
+  801917:	39 c3                	cmp    %eax,%ebx
+  801919:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  80191c:	89 f8                	mov    %edi,%eax
+  80191e:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801921:	eb 0f                	jmp    801932 <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  801923:	0f b6 08             	movzbl (%eax),%ecx
+  801926:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  801928:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80192d:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  801932:	39 d0                	cmp    %edx,%eax
+  801934:	72 ed                	jb     801923 <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  801936:	83 ec 0c             	sub    $0xc,%esp
+  801939:	68 04 60 80 00       	push   $0x806004
+  80193e:	e8 1e 1a 00 00       	call   803361 <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801943:	8b 46 0c             	mov    0xc(%esi),%eax
+  801946:	a3 00 70 80 00       	mov    %eax,0x807000
+		fsipcbuf.read.req_n = n;
+  80194b:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  801951:	89 3d 08 70 80 00    	mov    %edi,0x807008
+		r = fsipc(FSREQ_READ, NULL);
+  801957:	ba 00 00 00 00       	mov    $0x0,%edx
+  80195c:	b8 03 00 00 00       	mov    $0x3,%eax
+  801961:	e8 bb fd ff ff       	call   801721 <fsipc>
+  801966:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  801968:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  80196f:	e8 5a 1a 00 00       	call   8033ce <mutex_unlock>
+		assert(r <= (int) n);
+  801974:	83 c4 10             	add    $0x10,%esp
+  801977:	39 f3                	cmp    %esi,%ebx
+  801979:	7c 0a                	jl     801985 <devfile_read+0x91>
+}
+  80197b:	89 f0                	mov    %esi,%eax
+  80197d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801980:	5b                   	pop    %ebx
+  801981:	5e                   	pop    %esi
+  801982:	5f                   	pop    %edi
+  801983:	5d                   	pop    %ebp
+  801984:	c3                   	ret
+		assert(r <= (int) n);
+  801985:	68 b0 4c 80 00       	push   $0x804cb0
+  80198a:	68 bd 4c 80 00       	push   $0x804cbd
+  80198f:	68 90 00 00 00       	push   $0x90
+  801994:	68 d2 4c 80 00       	push   $0x804cd2
+  801999:	e8 ad e7 ff ff       	call   80014b <_panic>
+	mutex_lock(&fsipc_mu);
+  80199e:	83 ec 0c             	sub    $0xc,%esp
+  8019a1:	68 04 60 80 00       	push   $0x806004
+  8019a6:	e8 b6 19 00 00       	call   803361 <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8019ab:	8b 46 0c             	mov    0xc(%esi),%eax
+  8019ae:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  8019b3:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	fsipcbuf.read.req_va = 0;
+  8019b9:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  8019c0:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  8019c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019c8:	b8 03 00 00 00       	mov    $0x3,%eax
+  8019cd:	e8 4f fd ff ff       	call   801721 <fsipc>
+  8019d2:	89 c6                	mov    %eax,%esi
+  8019d4:	83 c4 10             	add    $0x10,%esp
+  8019d7:	85 c0                	test   %eax,%eax
+  8019d9:	78 1d                	js     8019f8 <devfile_read+0x104>
+		assert(r <= n);
+  8019db:	39 c3                	cmp    %eax,%ebx
+  8019dd:	72 2e                	jb     801a0d <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  8019df:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8019e4:	7f 40                	jg     801a26 <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8019e6:	83 ec 04             	sub    $0x4,%esp
+  8019e9:	50                   	push   %eax
+  8019ea:	68 00 70 80 00       	push   $0x807000
+  8019ef:	57                   	push   %edi
+  8019f0:	e8 9b ef ff ff       	call   800990 <memmove>
+  8019f5:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  8019f8:	83 ec 0c             	sub    $0xc,%esp
+  8019fb:	68 04 60 80 00       	push   $0x806004
+  801a00:	e8 c9 19 00 00       	call   8033ce <mutex_unlock>
+	return r;
+  801a05:	83 c4 10             	add    $0x10,%esp
+  801a08:	e9 6e ff ff ff       	jmp    80197b <devfile_read+0x87>
+		assert(r <= n);
+  801a0d:	68 dd 4c 80 00       	push   $0x804cdd
+  801a12:	68 bd 4c 80 00       	push   $0x804cbd
+  801a17:	68 99 00 00 00       	push   $0x99
+  801a1c:	68 d2 4c 80 00       	push   $0x804cd2
+  801a21:	e8 25 e7 ff ff       	call   80014b <_panic>
+		assert(r <= PGSIZE);
+  801a26:	68 e4 4c 80 00       	push   $0x804ce4
+  801a2b:	68 bd 4c 80 00       	push   $0x804cbd
+  801a30:	68 9a 00 00 00       	push   $0x9a
+  801a35:	68 d2 4c 80 00       	push   $0x804cd2
+  801a3a:	e8 0c e7 ff ff       	call   80014b <_panic>
+
+00801a3f <open>:
+{
+  801a3f:	55                   	push   %ebp
+  801a40:	89 e5                	mov    %esp,%ebp
+  801a42:	56                   	push   %esi
+  801a43:	53                   	push   %ebx
+  801a44:	83 ec 1c             	sub    $0x1c,%esp
+  801a47:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801a4a:	56                   	push   %esi
+  801a4b:	e8 7f ed ff ff       	call   8007cf <strlen>
+  801a50:	83 c4 10             	add    $0x10,%esp
+  801a53:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801a58:	0f 8f 85 00 00 00    	jg     801ae3 <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  801a5e:	83 ec 0c             	sub    $0xc,%esp
+  801a61:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a64:	50                   	push   %eax
+  801a65:	e8 a7 f6 ff ff       	call   801111 <fd_alloc>
+  801a6a:	89 c3                	mov    %eax,%ebx
+  801a6c:	83 c4 10             	add    $0x10,%esp
+  801a6f:	85 c0                	test   %eax,%eax
+  801a71:	78 55                	js     801ac8 <open+0x89>
+	mutex_lock(&fsipc_mu);
+  801a73:	83 ec 0c             	sub    $0xc,%esp
+  801a76:	68 04 60 80 00       	push   $0x806004
+  801a7b:	e8 e1 18 00 00       	call   803361 <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  801a80:	83 c4 08             	add    $0x8,%esp
+  801a83:	56                   	push   %esi
+  801a84:	68 00 70 80 00       	push   $0x807000
+  801a89:	e8 7c ed ff ff       	call   80080a <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801a8e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a91:	a3 00 74 80 00       	mov    %eax,0x807400
+	r = fsipc(FSREQ_OPEN, fd);
+  801a96:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801a99:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a9e:	e8 7e fc ff ff       	call   801721 <fsipc>
+  801aa3:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801aa5:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801aac:	e8 1d 19 00 00       	call   8033ce <mutex_unlock>
+	if (r < 0) {
+  801ab1:	83 c4 10             	add    $0x10,%esp
+  801ab4:	85 db                	test   %ebx,%ebx
+  801ab6:	78 19                	js     801ad1 <open+0x92>
+	return fd2num(fd);
+  801ab8:	83 ec 0c             	sub    $0xc,%esp
+  801abb:	ff 75 f4             	push   -0xc(%ebp)
+  801abe:	e8 27 f6 ff ff       	call   8010ea <fd2num>
+  801ac3:	89 c3                	mov    %eax,%ebx
+  801ac5:	83 c4 10             	add    $0x10,%esp
+}
+  801ac8:	89 d8                	mov    %ebx,%eax
+  801aca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801acd:	5b                   	pop    %ebx
+  801ace:	5e                   	pop    %esi
+  801acf:	5d                   	pop    %ebp
+  801ad0:	c3                   	ret
+		fd_close(fd, 0);
+  801ad1:	83 ec 08             	sub    $0x8,%esp
+  801ad4:	6a 00                	push   $0x0
+  801ad6:	ff 75 f4             	push   -0xc(%ebp)
+  801ad9:	e8 56 f7 ff ff       	call   801234 <fd_close>
+		return r;
+  801ade:	83 c4 10             	add    $0x10,%esp
+  801ae1:	eb e5                	jmp    801ac8 <open+0x89>
+		return -E_BAD_PATH;
+  801ae3:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801ae8:	eb de                	jmp    801ac8 <open+0x89>
+
+00801aea <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  801aea:	55                   	push   %ebp
+  801aeb:	89 e5                	mov    %esp,%ebp
+  801aed:	53                   	push   %ebx
+  801aee:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801af1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801af4:	50                   	push   %eax
+  801af5:	ff 75 08             	push   0x8(%ebp)
+  801af8:	e8 6a f6 ff ff       	call   801167 <fd_lookup>
+  801afd:	89 c3                	mov    %eax,%ebx
+  801aff:	83 c4 10             	add    $0x10,%esp
+  801b02:	85 c0                	test   %eax,%eax
+  801b04:	78 5b                	js     801b61 <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801b06:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b09:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  801b0f:	39 08                	cmp    %ecx,(%eax)
+  801b11:	75 55                	jne    801b68 <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  801b13:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  801b17:	74 56                	je     801b6f <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  801b19:	83 ec 0c             	sub    $0xc,%esp
+  801b1c:	68 04 60 80 00       	push   $0x806004
+  801b21:	e8 3b 18 00 00       	call   803361 <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  801b26:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b29:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b2c:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.allocate.req_offset = offset;
+  801b31:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b34:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.allocate.req_len = len;
+  801b39:	8b 45 10             	mov    0x10(%ebp),%eax
+  801b3c:	a3 08 70 80 00       	mov    %eax,0x807008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  801b41:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b46:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801b4b:	e8 d1 fb ff ff       	call   801721 <fsipc>
+  801b50:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801b52:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801b59:	e8 70 18 00 00       	call   8033ce <mutex_unlock>
+	return r;
+  801b5e:	83 c4 10             	add    $0x10,%esp
+}
+  801b61:	89 d8                	mov    %ebx,%eax
+  801b63:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b66:	c9                   	leave
+  801b67:	c3                   	ret
+		return -E_NOT_SUPP;
+  801b68:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801b6d:	eb f2                	jmp    801b61 <fallocate+0x77>
+		return -E_INVAL;
+  801b6f:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801b74:	eb eb                	jmp    801b61 <fallocate+0x77>
+
+00801b76 <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  801b76:	55                   	push   %ebp
+  801b77:	89 e5                	mov    %esp,%ebp
+  801b79:	56                   	push   %esi
+  801b7a:	53                   	push   %ebx
+  801b7b:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801b7e:	89 f3                	mov    %esi,%ebx
+  801b80:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801b86:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801b89:	eb 06                	jmp    801b91 <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801b8b:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801b91:	39 f3                	cmp    %esi,%ebx
+  801b93:	73 14                	jae    801ba9 <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  801b95:	83 ec 08             	sub    $0x8,%esp
+  801b98:	53                   	push   %ebx
+  801b99:	6a 00                	push   $0x0
+  801b9b:	e8 41 f1 ff ff       	call   800ce1 <sys_page_unmap>
+  801ba0:	83 c4 10             	add    $0x10,%esp
+  801ba3:	85 c0                	test   %eax,%eax
+  801ba5:	79 e4                	jns    801b8b <munmap+0x15>
+  801ba7:	eb 05                	jmp    801bae <munmap+0x38>
+			return r;
+	return 0;
+  801ba9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801bae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bb1:	5b                   	pop    %ebx
+  801bb2:	5e                   	pop    %esi
+  801bb3:	5d                   	pop    %ebp
+  801bb4:	c3                   	ret
+
+00801bb5 <mmap>:
+{
+  801bb5:	55                   	push   %ebp
+  801bb6:	89 e5                	mov    %esp,%ebp
+  801bb8:	57                   	push   %edi
+  801bb9:	56                   	push   %esi
+  801bba:	53                   	push   %ebx
+  801bbb:	83 ec 24             	sub    $0x24,%esp
+  801bbe:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801bc1:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801bc4:	50                   	push   %eax
+  801bc5:	ff 75 08             	push   0x8(%ebp)
+  801bc8:	e8 9a f5 ff ff       	call   801167 <fd_lookup>
+  801bcd:	83 c4 10             	add    $0x10,%esp
+  801bd0:	85 c0                	test   %eax,%eax
+  801bd2:	0f 88 37 01 00 00    	js     801d0f <mmap+0x15a>
+		return NULL;
+  801bd8:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801bdd:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801be0:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  801be6:	39 0a                	cmp    %ecx,(%edx)
+  801be8:	0f 85 05 01 00 00    	jne    801cf3 <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  801bee:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801bf5:	0f 85 1b 01 00 00    	jne    801d16 <mmap+0x161>
+  801bfb:	89 f0                	mov    %esi,%eax
+  801bfd:	83 e8 01             	sub    $0x1,%eax
+  801c00:	0f 88 17 01 00 00    	js     801d1d <mmap+0x168>
+	if (prot & PROT_WRITE)
+  801c06:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  801c0a:	75 28                	jne    801c34 <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  801c0c:	83 ec 0c             	sub    $0xc,%esp
+  801c0f:	68 04 60 80 00       	push   $0x806004
+  801c14:	e8 48 17 00 00       	call   803361 <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801c19:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  801c1f:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  801c25:	83 c4 10             	add    $0x10,%esp
+  801c28:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  801c2d:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  801c32:	eb 2b                	jmp    801c5f <mmap+0xaa>
+		cow_enable();
+  801c34:	e8 ad 22 00 00       	call   803ee6 <cow_enable>
+  801c39:	eb d1                	jmp    801c0c <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  801c3b:	89 c2                	mov    %eax,%edx
+  801c3d:	c1 ea 0c             	shr    $0xc,%edx
+  801c40:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  801c47:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801c4d:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  801c53:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  801c56:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  801c58:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  801c5d:	77 25                	ja     801c84 <mmap+0xcf>
+  801c5f:	89 c2                	mov    %eax,%edx
+  801c61:	29 da                	sub    %ebx,%edx
+  801c63:	39 ca                	cmp    %ecx,%edx
+  801c65:	73 3a                	jae    801ca1 <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  801c67:	89 c2                	mov    %eax,%edx
+  801c69:	c1 ea 16             	shr    $0x16,%edx
+  801c6c:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801c73:	f6 c2 01             	test   $0x1,%dl
+  801c76:	75 c3                	jne    801c3b <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  801c78:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  801c7d:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  801c82:	eb d4                	jmp    801c58 <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  801c84:	29 d8                	sub    %ebx,%eax
+  801c86:	39 c8                	cmp    %ecx,%eax
+  801c88:	73 17                	jae    801ca1 <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  801c8a:	83 ec 0c             	sub    $0xc,%esp
+  801c8d:	68 04 60 80 00       	push   $0x806004
+  801c92:	e8 37 17 00 00       	call   8033ce <mutex_unlock>
+		return NULL;
+  801c97:	83 c4 10             	add    $0x10,%esp
+  801c9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c9f:	eb 52                	jmp    801cf3 <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801ca1:	85 db                	test   %ebx,%ebx
+  801ca3:	74 e5                	je     801c8a <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801ca5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801ca8:	8b 40 0c             	mov    0xc(%eax),%eax
+  801cab:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  801cb0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801cb3:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_len = len;
+  801cb8:	89 35 08 70 80 00    	mov    %esi,0x807008
+	fsipcbuf.map.req_va = va;
+  801cbe:	89 1d 0c 70 80 00    	mov    %ebx,0x80700c
+	fsipcbuf.map.req_prot = prot;
+  801cc4:	8b 45 14             	mov    0x14(%ebp),%eax
+  801cc7:	a3 10 70 80 00       	mov    %eax,0x807010
+	r = fsipc(FSREQ_MAP, NULL);
+  801ccc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cd1:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801cd6:	e8 46 fa ff ff       	call   801721 <fsipc>
+  801cdb:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  801cdd:	83 ec 0c             	sub    $0xc,%esp
+  801ce0:	68 04 60 80 00       	push   $0x806004
+  801ce5:	e8 e4 16 00 00       	call   8033ce <mutex_unlock>
+	if (r < 0) {
+  801cea:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  801ced:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  801cef:	85 ff                	test   %edi,%edi
+  801cf1:	78 08                	js     801cfb <mmap+0x146>
+}
+  801cf3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cf6:	5b                   	pop    %ebx
+  801cf7:	5e                   	pop    %esi
+  801cf8:	5f                   	pop    %edi
+  801cf9:	5d                   	pop    %ebp
+  801cfa:	c3                   	ret
+		munmap((void*) va, len);
+  801cfb:	83 ec 08             	sub    $0x8,%esp
+  801cfe:	56                   	push   %esi
+  801cff:	53                   	push   %ebx
+  801d00:	e8 71 fe ff ff       	call   801b76 <munmap>
+		return NULL;
+  801d05:	83 c4 10             	add    $0x10,%esp
+  801d08:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d0d:	eb e4                	jmp    801cf3 <mmap+0x13e>
+		return NULL;
+  801d0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d14:	eb dd                	jmp    801cf3 <mmap+0x13e>
+		return NULL;
+  801d16:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d1b:	eb d6                	jmp    801cf3 <mmap+0x13e>
+  801d1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d22:	eb cf                	jmp    801cf3 <mmap+0x13e>
+
+00801d24 <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  801d24:	55                   	push   %ebp
+  801d25:	89 e5                	mov    %esp,%ebp
+  801d27:	53                   	push   %ebx
+  801d28:	83 ec 10             	sub    $0x10,%esp
+  801d2b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  801d2e:	53                   	push   %ebx
+  801d2f:	e8 9b ea ff ff       	call   8007cf <strlen>
+  801d34:	83 c4 10             	add    $0x10,%esp
+  801d37:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801d3c:	7f 42                	jg     801d80 <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  801d3e:	83 ec 0c             	sub    $0xc,%esp
+  801d41:	68 04 60 80 00       	push   $0x806004
+  801d46:	e8 16 16 00 00       	call   803361 <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  801d4b:	83 c4 08             	add    $0x8,%esp
+  801d4e:	53                   	push   %ebx
+  801d4f:	68 00 70 80 00       	push   $0x807000
+  801d54:	e8 b1 ea ff ff       	call   80080a <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  801d59:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d5e:	b8 07 00 00 00       	mov    $0x7,%eax
+  801d63:	e8 b9 f9 ff ff       	call   801721 <fsipc>
+  801d68:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801d6a:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801d71:	e8 58 16 00 00       	call   8033ce <mutex_unlock>
+	return r;
+  801d76:	83 c4 10             	add    $0x10,%esp
+}
+  801d79:	89 d8                	mov    %ebx,%eax
+  801d7b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d7e:	c9                   	leave
+  801d7f:	c3                   	ret
+		return -E_BAD_PATH;
+  801d80:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801d85:	eb f2                	jmp    801d79 <remove+0x55>
+
+00801d87 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801d87:	55                   	push   %ebp
+  801d88:	89 e5                	mov    %esp,%ebp
+  801d8a:	53                   	push   %ebx
+  801d8b:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801d8e:	68 04 60 80 00       	push   $0x806004
+  801d93:	e8 c9 15 00 00       	call   803361 <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  801d98:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d9d:	b8 08 00 00 00       	mov    $0x8,%eax
+  801da2:	e8 7a f9 ff ff       	call   801721 <fsipc>
+  801da7:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801da9:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801db0:	e8 19 16 00 00       	call   8033ce <mutex_unlock>
+	return r;
+}
+  801db5:	89 d8                	mov    %ebx,%eax
+  801db7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801dba:	c9                   	leave
+  801dbb:	c3                   	ret
+
+00801dbc <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  801dbc:	55                   	push   %ebp
+  801dbd:	89 e5                	mov    %esp,%ebp
+  801dbf:	56                   	push   %esi
+  801dc0:	53                   	push   %ebx
+  801dc1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801dc4:	83 ec 0c             	sub    $0xc,%esp
+  801dc7:	68 04 60 80 00       	push   $0x806004
+  801dcc:	e8 90 15 00 00       	call   803361 <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  801dd1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dd4:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  801dd9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dde:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801de3:	e8 39 f9 ff ff       	call   801721 <fsipc>
+  801de8:	89 c6                	mov    %eax,%esi
+  801dea:	83 c4 10             	add    $0x10,%esp
+  801ded:	85 db                	test   %ebx,%ebx
+  801def:	74 7b                	je     801e6c <fs_bcstat+0xb0>
+  801df1:	85 c0                	test   %eax,%eax
+  801df3:	78 77                	js     801e6c <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  801df5:	a1 00 70 80 00       	mov    0x807000,%eax
+  801dfa:	89 03                	mov    %eax,(%ebx)
+  801dfc:	a1 04 70 80 00       	mov    0x807004,%eax
+  801e01:	89 43 04             	mov    %eax,0x4(%ebx)
+  801e04:	a1 08 70 80 00       	mov    0x807008,%eax
+  801e09:	89 43 08             	mov    %eax,0x8(%ebx)
+  801e0c:	a1 0c 70 80 00       	mov    0x80700c,%eax
+  801e11:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801e14:	a1 10 70 80 00       	mov    0x807010,%eax
+  801e19:	89 43 10             	mov    %eax,0x10(%ebx)
+  801e1c:	a1 14 70 80 00       	mov    0x807014,%eax
+  801e21:	89 43 14             	mov    %eax,0x14(%ebx)
+  801e24:	a1 18 70 80 00       	mov    0x807018,%eax
+  801e29:	89 43 18             	mov    %eax,0x18(%ebx)
+  801e2c:	a1 1c 70 80 00       	mov    0x80701c,%eax
+  801e31:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  801e34:	a1 20 70 80 00       	mov    0x807020,%eax
+  801e39:	89 43 20             	mov    %eax,0x20(%ebx)
+  801e3c:	a1 24 70 80 00       	mov    0x807024,%eax
+  801e41:	89 43 24             	mov    %eax,0x24(%ebx)
+  801e44:	a1 28 70 80 00       	mov    0x807028,%eax
+  801e49:	89 43 28             	mov    %eax,0x28(%ebx)
+  801e4c:	a1 2c 70 80 00       	mov    0x80702c,%eax
+  801e51:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  801e54:	a1 30 70 80 00       	mov    0x807030,%eax
+  801e59:	89 43 30             	mov    %eax,0x30(%ebx)
+  801e5c:	a1 34 70 80 00       	mov    0x807034,%eax
+  801e61:	89 43 34             	mov    %eax,0x34(%ebx)
+  801e64:	a1 38 70 80 00       	mov    0x807038,%eax
+  801e69:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  801e6c:	83 ec 0c             	sub    $0xc,%esp
+  801e6f:	68 04 60 80 00       	push   $0x806004
+  801e74:	e8 55 15 00 00       	call   8033ce <mutex_unlock>
+	return r;
+}
+  801e79:	89 f0                	mov    %esi,%eax
+  801e7b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e7e:	5b                   	pop    %ebx
+  801e7f:	5e                   	pop    %esi
+  801e80:	5d                   	pop    %ebp
+  801e81:	c3                   	ret
+
+00801e82 <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  801e82:	55                   	push   %ebp
+  801e83:	89 e5                	mov    %esp,%ebp
+  801e85:	56                   	push   %esi
+  801e86:	53                   	push   %ebx
+  801e87:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  801e89:	0f b6 10             	movzbl (%eax),%edx
+  801e8c:	80 fa 72             	cmp    $0x72,%dl
+  801e8f:	74 44                	je     801ed5 <parse_mode+0x53>
+  801e91:	80 fa 77             	cmp    $0x77,%dl
+  801e94:	74 4b                	je     801ee1 <parse_mode+0x5f>
+  801e96:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801e9b:	80 fa 61             	cmp    $0x61,%dl
+  801e9e:	74 09                	je     801ea9 <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  801ea0:	89 d8                	mov    %ebx,%eax
+  801ea2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ea5:	5b                   	pop    %ebx
+  801ea6:	5e                   	pop    %esi
+  801ea7:	5d                   	pop    %ebp
+  801ea8:	c3                   	ret
+	switch (mode[0]) {
+  801ea9:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  801eae:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  801eb3:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  801eb5:	83 ec 08             	sub    $0x8,%esp
+  801eb8:	6a 2b                	push   $0x2b
+  801eba:	50                   	push   %eax
+  801ebb:	e8 5c ea ff ff       	call   80091c <strchr>
+  801ec0:	83 c4 10             	add    $0x10,%esp
+  801ec3:	85 c0                	test   %eax,%eax
+  801ec5:	74 d9                	je     801ea0 <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  801ec7:	83 e3 fc             	and    $0xfffffffc,%ebx
+  801eca:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  801ecd:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  801ed3:	eb cb                	jmp    801ea0 <parse_mode+0x1e>
+	switch (mode[0]) {
+  801ed5:	ba 01 00 00 00       	mov    $0x1,%edx
+  801eda:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801edf:	eb d2                	jmp    801eb3 <parse_mode+0x31>
+  801ee1:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  801ee6:	bb 01 03 00 00       	mov    $0x301,%ebx
+  801eeb:	eb c6                	jmp    801eb3 <parse_mode+0x31>
+
+00801eed <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  801eed:	55                   	push   %ebp
+  801eee:	89 e5                	mov    %esp,%ebp
+  801ef0:	57                   	push   %edi
+  801ef1:	56                   	push   %esi
+  801ef2:	53                   	push   %ebx
+  801ef3:	83 ec 1c             	sub    $0x1c,%esp
+  801ef6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801ef9:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  801efc:	b8 24 50 80 00       	mov    $0x805024,%eax
+  801f01:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  801f06:	83 c0 24             	add    $0x24,%eax
+  801f09:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  801f0d:	74 17                	je     801f26 <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  801f0f:	83 c3 01             	add    $0x1,%ebx
+  801f12:	83 fb 10             	cmp    $0x10,%ebx
+  801f15:	75 ef                	jne    801f06 <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  801f17:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  801f1c:	89 f0                	mov    %esi,%eax
+  801f1e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f21:	5b                   	pop    %ebx
+  801f22:	5e                   	pop    %esi
+  801f23:	5f                   	pop    %edi
+  801f24:	5d                   	pop    %ebp
+  801f25:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  801f26:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  801f2d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801f30:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  801f33:	c1 e7 02             	shl    $0x2,%edi
+  801f36:	8d b7 20 50 80 00    	lea    0x805020(%edi),%esi
+  801f3c:	83 ec 04             	sub    $0x4,%esp
+  801f3f:	6a 24                	push   $0x24
+  801f41:	6a 00                	push   $0x0
+  801f43:	56                   	push   %esi
+  801f44:	e8 12 ea ff ff       	call   80095b <memset>
+			streams[i].f_fd = fd;
+  801f49:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801f4c:	89 8f 20 50 80 00    	mov    %ecx,0x805020(%edi)
+			streams[i].f_flags = flags;
+  801f52:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  801f55:	01 d8                	add    %ebx,%eax
+  801f57:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801f5a:	89 0c 85 24 50 80 00 	mov    %ecx,0x805024(,%eax,4)
+			return &streams[i];
+  801f61:	83 c4 10             	add    $0x10,%esp
+  801f64:	eb b6                	jmp    801f1c <stream_alloc+0x2f>
+
+00801f66 <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  801f66:	55                   	push   %ebp
+  801f67:	89 e5                	mov    %esp,%ebp
+  801f69:	53                   	push   %ebx
+  801f6a:	83 ec 14             	sub    $0x14,%esp
+  801f6d:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  801f6f:	8b 40 18             	mov    0x18(%eax),%eax
+  801f72:	39 43 14             	cmp    %eax,0x14(%ebx)
+  801f75:	74 4a                	je     801fc1 <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801f77:	83 ec 08             	sub    $0x8,%esp
+  801f7a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f7d:	50                   	push   %eax
+  801f7e:	ff 33                	push   (%ebx)
+  801f80:	e8 e2 f1 ff ff       	call   801167 <fd_lookup>
+  801f85:	89 c2                	mov    %eax,%edx
+  801f87:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801f8a:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801f8f:	85 d2                	test   %edx,%edx
+  801f91:	78 41                	js     801fd4 <stream_unread+0x6e>
+  801f93:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801f96:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  801f9c:	39 0a                	cmp    %ecx,(%edx)
+  801f9e:	75 34                	jne    801fd4 <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  801fa0:	8b 43 14             	mov    0x14(%ebx),%eax
+  801fa3:	03 42 04             	add    0x4(%edx),%eax
+  801fa6:	2b 43 18             	sub    0x18(%ebx),%eax
+  801fa9:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  801fac:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  801fb3:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  801fba:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fbf:	eb 13                	jmp    801fd4 <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  801fc1:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  801fc8:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  801fcf:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801fd4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fd7:	c9                   	leave
+  801fd8:	c3                   	ret
+
+00801fd9 <stream_drain>:
+{
+  801fd9:	55                   	push   %ebp
+  801fda:	89 e5                	mov    %esp,%ebp
+  801fdc:	56                   	push   %esi
+  801fdd:	53                   	push   %ebx
+  801fde:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  801fe0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801fe5:	eb 02                	jmp    801fe9 <stream_drain+0x10>
+  801fe7:	01 c3                	add    %eax,%ebx
+  801fe9:	8b 46 1c             	mov    0x1c(%esi),%eax
+  801fec:	39 c3                	cmp    %eax,%ebx
+  801fee:	73 43                	jae    802033 <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  801ff0:	83 ec 04             	sub    $0x4,%esp
+  801ff3:	29 d8                	sub    %ebx,%eax
+  801ff5:	50                   	push   %eax
+  801ff6:	89 d8                	mov    %ebx,%eax
+  801ff8:	03 46 0c             	add    0xc(%esi),%eax
+  801ffb:	50                   	push   %eax
+  801ffc:	ff 36                	push   (%esi)
+  801ffe:	e8 ec f4 ff ff       	call   8014ef <write>
+  802003:	83 c4 10             	add    $0x10,%esp
+  802006:	85 c0                	test   %eax,%eax
+  802008:	7f dd                	jg     801fe7 <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  80200a:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  80200e:	8b 56 0c             	mov    0xc(%esi),%edx
+  802011:	83 ec 04             	sub    $0x4,%esp
+  802014:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802017:	29 d8                	sub    %ebx,%eax
+  802019:	50                   	push   %eax
+  80201a:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  80201d:	50                   	push   %eax
+  80201e:	52                   	push   %edx
+  80201f:	e8 6c e9 ff ff       	call   800990 <memmove>
+			f->f_wend -= done;
+  802024:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802027:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  802029:	83 c4 10             	add    $0x10,%esp
+  80202c:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  802031:	eb 0a                	jmp    80203d <stream_drain+0x64>
+  802033:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  802038:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  80203d:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  802040:	89 d0                	mov    %edx,%eax
+  802042:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802045:	5b                   	pop    %ebx
+  802046:	5e                   	pop    %esi
+  802047:	5d                   	pop    %ebp
+  802048:	c3                   	ret
+
+00802049 <stream_setup>:
+	if (f->f_buf)
+  802049:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  80204d:	74 01                	je     802050 <stream_setup+0x7>
+  80204f:	c3                   	ret
+{
+  802050:	55                   	push   %ebp
+  802051:	89 e5                	mov    %esp,%ebp
+  802053:	53                   	push   %ebx
+  802054:	83 ec 04             	sub    $0x4,%esp
+  802057:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  802059:	8b 40 08             	mov    0x8(%eax),%eax
+  80205c:	85 c0                	test   %eax,%eax
+  80205e:	74 17                	je     802077 <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  802060:	83 f8 03             	cmp    $0x3,%eax
+  802063:	75 2d                	jne    802092 <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  802065:	8d 43 20             	lea    0x20(%ebx),%eax
+  802068:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  80206b:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  802072:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802075:	c9                   	leave
+  802076:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  802077:	83 ec 0c             	sub    $0xc,%esp
+  80207a:	ff 33                	push   (%ebx)
+  80207c:	e8 e2 1b 00 00       	call   803c63 <iscons>
+  802081:	83 c4 10             	add    $0x10,%esp
+  802084:	85 c0                	test   %eax,%eax
+  802086:	0f 9f c0             	setg   %al
+  802089:	0f b6 c0             	movzbl %al,%eax
+  80208c:	83 c0 01             	add    $0x1,%eax
+  80208f:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  802092:	83 ec 0c             	sub    $0xc,%esp
+  802095:	68 00 10 00 00       	push   $0x1000
+  80209a:	e8 6e 0b 00 00       	call   802c0d <malloc>
+  80209f:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8020a2:	83 c4 10             	add    $0x10,%esp
+  8020a5:	85 c0                	test   %eax,%eax
+  8020a7:	74 bc                	je     802065 <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  8020a9:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  8020b0:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  8020b4:	eb bc                	jmp    802072 <stream_setup+0x29>
+
+008020b6 <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  8020b6:	55                   	push   %ebp
+  8020b7:	89 e5                	mov    %esp,%ebp
+  8020b9:	53                   	push   %ebx
+  8020ba:	83 ec 04             	sub    $0x4,%esp
+  8020bd:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  8020bf:	e8 85 ff ff ff       	call   802049 <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  8020c4:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  8020c9:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  8020cd:	74 3d                	je     80210c <stream_fill+0x56>
+  8020cf:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  8020d3:	74 10                	je     8020e5 <stream_fill+0x2f>
+  8020d5:	89 d8                	mov    %ebx,%eax
+  8020d7:	e8 fd fe ff ff       	call   801fd9 <stream_drain>
+		return 0;
+  8020dc:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  8020e1:	85 c0                	test   %eax,%eax
+  8020e3:	78 27                	js     80210c <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  8020e5:	83 ec 04             	sub    $0x4,%esp
+  8020e8:	ff 73 10             	push   0x10(%ebx)
+  8020eb:	ff 73 0c             	push   0xc(%ebx)
+  8020ee:	ff 33                	push   (%ebx)
+  8020f0:	e8 02 f3 ff ff       	call   8013f7 <read>
+  8020f5:	83 c4 10             	add    $0x10,%esp
+  8020f8:	85 c0                	test   %eax,%eax
+  8020fa:	7e 17                	jle    802113 <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  8020fc:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  802100:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  802107:	89 c2                	mov    %eax,%edx
+  802109:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  80210c:	89 d0                	mov    %edx,%eax
+  80210e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802111:	c9                   	leave
+  802112:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802113:	c1 f8 1f             	sar    $0x1f,%eax
+  802116:	83 e0 04             	and    $0x4,%eax
+  802119:	83 c0 04             	add    $0x4,%eax
+  80211c:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  80211f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802124:	eb e6                	jmp    80210c <stream_fill+0x56>
+
+00802126 <fopen>:
+{
+  802126:	55                   	push   %ebp
+  802127:	89 e5                	mov    %esp,%ebp
+  802129:	57                   	push   %edi
+  80212a:	56                   	push   %esi
+  80212b:	53                   	push   %ebx
+  80212c:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  802132:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  802135:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  80213b:	89 f0                	mov    %esi,%eax
+  80213d:	e8 40 fd ff ff       	call   801e82 <parse_mode>
+		return 0;
+  802142:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  802147:	85 c0                	test   %eax,%eax
+  802149:	78 2d                	js     802178 <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  80214b:	83 ec 08             	sub    $0x8,%esp
+  80214e:	50                   	push   %eax
+  80214f:	ff 75 08             	push   0x8(%ebp)
+  802152:	e8 e8 f8 ff ff       	call   801a3f <open>
+  802157:	89 c7                	mov    %eax,%edi
+  802159:	83 c4 10             	add    $0x10,%esp
+  80215c:	85 c0                	test   %eax,%eax
+  80215e:	78 58                	js     8021b8 <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  802160:	80 3e 61             	cmpb   $0x61,(%esi)
+  802163:	74 1d                	je     802182 <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  802165:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  80216b:	89 f8                	mov    %edi,%eax
+  80216d:	e8 7b fd ff ff       	call   801eed <stream_alloc>
+  802172:	89 c3                	mov    %eax,%ebx
+  802174:	85 c0                	test   %eax,%eax
+  802176:	74 32                	je     8021aa <fopen+0x84>
+}
+  802178:	89 d8                	mov    %ebx,%eax
+  80217a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80217d:	5b                   	pop    %ebx
+  80217e:	5e                   	pop    %esi
+  80217f:	5f                   	pop    %edi
+  802180:	5d                   	pop    %ebp
+  802181:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  802182:	83 ec 08             	sub    $0x8,%esp
+  802185:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  80218b:	50                   	push   %eax
+  80218c:	57                   	push   %edi
+  80218d:	e8 db f4 ff ff       	call   80166d <fstat>
+  802192:	83 c4 10             	add    $0x10,%esp
+  802195:	85 c0                	test   %eax,%eax
+  802197:	78 cc                	js     802165 <fopen+0x3f>
+		seek(fd, st.st_size);
+  802199:	83 ec 08             	sub    $0x8,%esp
+  80219c:	ff 75 dc             	push   -0x24(%ebp)
+  80219f:	57                   	push   %edi
+  8021a0:	e8 f6 f3 ff ff       	call   80159b <seek>
+  8021a5:	83 c4 10             	add    $0x10,%esp
+  8021a8:	eb bb                	jmp    802165 <fopen+0x3f>
+		close(fd);
+  8021aa:	83 ec 0c             	sub    $0xc,%esp
+  8021ad:	57                   	push   %edi
+  8021ae:	e8 08 f1 ff ff       	call   8012bb <close>
+  8021b3:	83 c4 10             	add    $0x10,%esp
+  8021b6:	eb c0                	jmp    802178 <fopen+0x52>
+		return 0;
+  8021b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8021bd:	eb b9                	jmp    802178 <fopen+0x52>
+
+008021bf <fdopen>:
+{
+  8021bf:	55                   	push   %ebp
+  8021c0:	89 e5                	mov    %esp,%ebp
+  8021c2:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  8021c5:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8021c8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021cb:	e8 b2 fc ff ff       	call   801e82 <parse_mode>
+  8021d0:	89 c2                	mov    %eax,%edx
+		return 0;
+  8021d2:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  8021d7:	85 d2                	test   %edx,%edx
+  8021d9:	78 0b                	js     8021e6 <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  8021db:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8021de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021e1:	e8 07 fd ff ff       	call   801eed <stream_alloc>
+}
+  8021e6:	c9                   	leave
+  8021e7:	c3                   	ret
+
+008021e8 <setvbuf>:
+{
+  8021e8:	55                   	push   %ebp
+  8021e9:	89 e5                	mov    %esp,%ebp
+  8021eb:	57                   	push   %edi
+  8021ec:	56                   	push   %esi
+  8021ed:	53                   	push   %ebx
+  8021ee:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021f1:	8b 55 10             	mov    0x10(%ebp),%edx
+  8021f4:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  8021f7:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8021fb:	75 3a                	jne    802237 <setvbuf+0x4f>
+  8021fd:	8d 72 ff             	lea    -0x1(%edx),%esi
+  802200:	83 fe 02             	cmp    $0x2,%esi
+  802203:	77 39                	ja     80223e <setvbuf+0x56>
+	f->f_bufmode = mode;
+  802205:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  802208:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80220c:	0f 95 c3             	setne  %bl
+  80220f:	85 ff                	test   %edi,%edi
+  802211:	0f 95 c1             	setne  %cl
+  802214:	84 cb                	test   %cl,%bl
+  802216:	74 05                	je     80221d <setvbuf+0x35>
+  802218:	83 fa 03             	cmp    $0x3,%edx
+  80221b:	75 0a                	jne    802227 <setvbuf+0x3f>
+	return 0;
+  80221d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802222:	5b                   	pop    %ebx
+  802223:	5e                   	pop    %esi
+  802224:	5f                   	pop    %edi
+  802225:	5d                   	pop    %ebp
+  802226:	c3                   	ret
+		f->f_buf = buf;
+  802227:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80222a:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  80222d:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  802230:	b8 00 00 00 00       	mov    $0x0,%eax
+  802235:	eb eb                	jmp    802222 <setvbuf+0x3a>
+		return EOF;
+  802237:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80223c:	eb e4                	jmp    802222 <setvbuf+0x3a>
+  80223e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802243:	eb dd                	jmp    802222 <setvbuf+0x3a>
+
+00802245 <fflush>:
+{
+  802245:	55                   	push   %ebp
+  802246:	89 e5                	mov    %esp,%ebp
+  802248:	57                   	push   %edi
+  802249:	56                   	push   %esi
+  80224a:	53                   	push   %ebx
+  80224b:	83 ec 0c             	sub    $0xc,%esp
+  80224e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  802251:	85 db                	test   %ebx,%ebx
+  802253:	74 1a                	je     80226f <fflush+0x2a>
+	stream_unread(f);
+  802255:	89 d8                	mov    %ebx,%eax
+  802257:	e8 0a fd ff ff       	call   801f66 <stream_unread>
+	return stream_drain(f);
+  80225c:	89 d8                	mov    %ebx,%eax
+  80225e:	e8 76 fd ff ff       	call   801fd9 <stream_drain>
+  802263:	89 c7                	mov    %eax,%edi
+}
+  802265:	89 f8                	mov    %edi,%eax
+  802267:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80226a:	5b                   	pop    %ebx
+  80226b:	5e                   	pop    %esi
+  80226c:	5f                   	pop    %edi
+  80226d:	5d                   	pop    %ebp
+  80226e:	c3                   	ret
+  80226f:	bb 20 50 80 00       	mov    $0x805020,%ebx
+  802274:	be 60 52 80 00       	mov    $0x805260,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  802279:	bf 00 00 00 00       	mov    $0x0,%edi
+  80227e:	eb 03                	jmp    802283 <fflush+0x3e>
+  802280:	83 c3 24             	add    $0x24,%ebx
+  802283:	39 f3                	cmp    %esi,%ebx
+  802285:	74 de                	je     802265 <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  802287:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  80228b:	74 f3                	je     802280 <fflush+0x3b>
+  80228d:	83 ec 0c             	sub    $0xc,%esp
+  802290:	53                   	push   %ebx
+  802291:	e8 af ff ff ff       	call   802245 <fflush>
+  802296:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  802299:	85 c0                	test   %eax,%eax
+  80229b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8022a0:	0f 48 f8             	cmovs  %eax,%edi
+  8022a3:	eb db                	jmp    802280 <fflush+0x3b>
+
+008022a5 <fclose>:
+{
+  8022a5:	55                   	push   %ebp
+  8022a6:	89 e5                	mov    %esp,%ebp
+  8022a8:	56                   	push   %esi
+  8022a9:	53                   	push   %ebx
+  8022aa:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  8022ad:	83 ec 0c             	sub    $0xc,%esp
+  8022b0:	56                   	push   %esi
+  8022b1:	e8 8f ff ff ff       	call   802245 <fflush>
+  8022b6:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  8022b8:	83 c4 04             	add    $0x4,%esp
+  8022bb:	ff 36                	push   (%esi)
+  8022bd:	e8 f9 ef ff ff       	call   8012bb <close>
+  8022c2:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  8022c5:	85 c0                	test   %eax,%eax
+  8022c7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8022cc:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  8022cf:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  8022d3:	75 10                	jne    8022e5 <fclose+0x40>
+	f->f_flags = 0;
+  8022d5:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  8022dc:	89 d8                	mov    %ebx,%eax
+  8022de:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022e1:	5b                   	pop    %ebx
+  8022e2:	5e                   	pop    %esi
+  8022e3:	5d                   	pop    %ebp
+  8022e4:	c3                   	ret
+		free(f->f_buf);
+  8022e5:	83 ec 0c             	sub    $0xc,%esp
+  8022e8:	ff 76 0c             	push   0xc(%esi)
+  8022eb:	e8 54 08 00 00       	call   802b44 <free>
+  8022f0:	83 c4 10             	add    $0x10,%esp
+  8022f3:	eb e0                	jmp    8022d5 <fclose+0x30>
+
+008022f5 <fileno>:
+{
+  8022f5:	55                   	push   %ebp
+  8022f6:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  8022f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022fb:	8b 00                	mov    (%eax),%eax
+}
+  8022fd:	5d                   	pop    %ebp
+  8022fe:	c3                   	ret
+
+008022ff <feof>:
+{
+  8022ff:	55                   	push   %ebp
+  802300:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  802302:	8b 45 08             	mov    0x8(%ebp),%eax
+  802305:	8b 40 04             	mov    0x4(%eax),%eax
+  802308:	c1 e8 02             	shr    $0x2,%eax
+  80230b:	83 e0 01             	and    $0x1,%eax
+}
+  80230e:	5d                   	pop    %ebp
+  80230f:	c3                   	ret
+
+00802310 <ferror>:
+{
+  802310:	55                   	push   %ebp
+  802311:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  802313:	8b 45 08             	mov    0x8(%ebp),%eax
+  802316:	8b 40 04             	mov    0x4(%eax),%eax
+  802319:	c1 e8 03             	shr    $0x3,%eax
+  80231c:	83 e0 01             	and    $0x1,%eax
+}
+  80231f:	5d                   	pop    %ebp
+  802320:	c3                   	ret
+
+00802321 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  802321:	55                   	push   %ebp
+  802322:	89 e5                	mov    %esp,%ebp
+  802324:	53                   	push   %ebx
+  802325:	83 ec 04             	sub    $0x4,%esp
+  802328:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  80232b:	8b 43 18             	mov    0x18(%ebx),%eax
+  80232e:	39 43 14             	cmp    %eax,0x14(%ebx)
+  802331:	74 15                	je     802348 <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  802333:	8b 53 0c             	mov    0xc(%ebx),%edx
+  802336:	8b 43 14             	mov    0x14(%ebx),%eax
+  802339:	8d 48 01             	lea    0x1(%eax),%ecx
+  80233c:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  80233f:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  802343:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802346:	c9                   	leave
+  802347:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802348:	89 d8                	mov    %ebx,%eax
+  80234a:	e8 67 fd ff ff       	call   8020b6 <stream_fill>
+  80234f:	85 c0                	test   %eax,%eax
+  802351:	75 e0                	jne    802333 <fgetc+0x12>
+		return EOF;
+  802353:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802358:	eb e9                	jmp    802343 <fgetc+0x22>
+
+0080235a <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  80235a:	55                   	push   %ebp
+  80235b:	89 e5                	mov    %esp,%ebp
+  80235d:	57                   	push   %edi
+  80235e:	56                   	push   %esi
+  80235f:	53                   	push   %ebx
+  802360:	83 ec 1c             	sub    $0x1c,%esp
+  802363:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  802366:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  80236b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80236e:	83 e8 01             	sub    $0x1,%eax
+  802371:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  802374:	eb 66                	jmp    8023dc <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802376:	8b 46 14             	mov    0x14(%esi),%eax
+  802379:	8b 5e 18             	mov    0x18(%esi),%ebx
+  80237c:	29 c3                	sub    %eax,%ebx
+  80237e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802381:	29 fa                	sub    %edi,%edx
+  802383:	39 d3                	cmp    %edx,%ebx
+  802385:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802388:	83 ec 04             	sub    $0x4,%esp
+  80238b:	53                   	push   %ebx
+  80238c:	6a 0a                	push   $0xa
+  80238e:	03 46 0c             	add    0xc(%esi),%eax
+  802391:	50                   	push   %eax
+  802392:	e8 aa e6 ff ff       	call   800a41 <memfind>
+  802397:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  80239a:	8b 46 0c             	mov    0xc(%esi),%eax
+  80239d:	8b 4e 14             	mov    0x14(%esi),%ecx
+  8023a0:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  8023a3:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  8023a5:	83 c4 10             	add    $0x10,%esp
+  8023a8:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  8023ab:	74 0b                	je     8023b8 <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  8023ad:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8023b0:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8023b3:	29 d3                	sub    %edx,%ebx
+  8023b5:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  8023b8:	83 ec 04             	sub    $0x4,%esp
+  8023bb:	53                   	push   %ebx
+  8023bc:	01 c8                	add    %ecx,%eax
+  8023be:	50                   	push   %eax
+  8023bf:	89 f8                	mov    %edi,%eax
+  8023c1:	03 45 08             	add    0x8(%ebp),%eax
+  8023c4:	50                   	push   %eax
+  8023c5:	e8 c6 e5 ff ff       	call   800990 <memmove>
+		f->f_rpos += m;
+  8023ca:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  8023cd:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  8023cf:	83 c4 10             	add    $0x10,%esp
+  8023d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023d5:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  8023da:	74 1f                	je     8023fb <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  8023dc:	8d 47 01             	lea    0x1(%edi),%eax
+  8023df:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  8023e2:	73 17                	jae    8023fb <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8023e4:	8b 46 18             	mov    0x18(%esi),%eax
+  8023e7:	39 46 14             	cmp    %eax,0x14(%esi)
+  8023ea:	75 8a                	jne    802376 <fgets+0x1c>
+  8023ec:	89 f0                	mov    %esi,%eax
+  8023ee:	e8 c3 fc ff ff       	call   8020b6 <stream_fill>
+  8023f3:	85 c0                	test   %eax,%eax
+  8023f5:	0f 85 7b ff ff ff    	jne    802376 <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  8023fb:	85 ff                	test   %edi,%edi
+  8023fd:	74 0f                	je     80240e <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  8023ff:	8b 45 08             	mov    0x8(%ebp),%eax
+  802402:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  802406:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802409:	5b                   	pop    %ebx
+  80240a:	5e                   	pop    %esi
+  80240b:	5f                   	pop    %edi
+  80240c:	5d                   	pop    %ebp
+  80240d:	c3                   	ret
+		return 0;
+  80240e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802413:	eb f1                	jmp    802406 <fgets+0xac>
+
+00802415 <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  802415:	55                   	push   %ebp
+  802416:	89 e5                	mov    %esp,%ebp
+  802418:	57                   	push   %edi
+  802419:	56                   	push   %esi
+  80241a:	53                   	push   %ebx
+  80241b:	83 ec 1c             	sub    $0x1c,%esp
+  80241e:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  802421:	89 f0                	mov    %esi,%eax
+  802423:	e8 21 fc ff ff       	call   802049 <stream_setup>
+	want = size * n;
+  802428:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80242b:	0f af 45 10          	imul   0x10(%ebp),%eax
+  80242f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  802432:	bf 00 00 00 00       	mov    $0x0,%edi
+  802437:	eb 43                	jmp    80247c <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  802439:	29 d3                	sub    %edx,%ebx
+  80243b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80243e:	29 f8                	sub    %edi,%eax
+  802440:	39 c3                	cmp    %eax,%ebx
+  802442:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  802445:	83 ec 04             	sub    $0x4,%esp
+  802448:	53                   	push   %ebx
+  802449:	03 56 0c             	add    0xc(%esi),%edx
+  80244c:	52                   	push   %edx
+  80244d:	89 f8                	mov    %edi,%eax
+  80244f:	03 45 08             	add    0x8(%ebp),%eax
+  802452:	50                   	push   %eax
+  802453:	e8 38 e5 ff ff       	call   800990 <memmove>
+			f->f_rpos += m;
+  802458:	01 5e 14             	add    %ebx,0x14(%esi)
+  80245b:	83 c4 10             	add    $0x10,%esp
+  80245e:	eb 1a                	jmp    80247a <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  802460:	83 ec 04             	sub    $0x4,%esp
+  802463:	53                   	push   %ebx
+  802464:	89 f8                	mov    %edi,%eax
+  802466:	03 45 08             	add    0x8(%ebp),%eax
+  802469:	50                   	push   %eax
+  80246a:	ff 36                	push   (%esi)
+  80246c:	e8 86 ef ff ff       	call   8013f7 <read>
+  802471:	89 c3                	mov    %eax,%ebx
+  802473:	83 c4 10             	add    $0x10,%esp
+  802476:	85 c0                	test   %eax,%eax
+  802478:	7e 36                	jle    8024b0 <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  80247a:	01 df                	add    %ebx,%edi
+  80247c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80247f:	39 c7                	cmp    %eax,%edi
+  802481:	73 39                	jae    8024bc <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  802483:	8b 56 14             	mov    0x14(%esi),%edx
+  802486:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802489:	39 da                	cmp    %ebx,%edx
+  80248b:	72 ac                	jb     802439 <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  80248d:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802490:	29 fb                	sub    %edi,%ebx
+  802492:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  802495:	72 3e                	jb     8024d5 <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  802497:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  80249b:	74 1f                	je     8024bc <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  80249d:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  8024a1:	74 bd                	je     802460 <fread+0x4b>
+  8024a3:	89 f0                	mov    %esi,%eax
+  8024a5:	e8 2f fb ff ff       	call   801fd9 <stream_drain>
+  8024aa:	85 c0                	test   %eax,%eax
+  8024ac:	79 b2                	jns    802460 <fread+0x4b>
+  8024ae:	eb 0c                	jmp    8024bc <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  8024b0:	c1 fb 1f             	sar    $0x1f,%ebx
+  8024b3:	83 e3 04             	and    $0x4,%ebx
+  8024b6:	83 c3 04             	add    $0x4,%ebx
+  8024b9:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  8024bc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024bf:	85 c0                	test   %eax,%eax
+  8024c1:	74 0a                	je     8024cd <fread+0xb8>
+  8024c3:	89 f8                	mov    %edi,%eax
+  8024c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024ca:	f7 75 0c             	divl   0xc(%ebp)
+}
+  8024cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024d0:	5b                   	pop    %ebx
+  8024d1:	5e                   	pop    %esi
+  8024d2:	5f                   	pop    %edi
+  8024d3:	5d                   	pop    %ebp
+  8024d4:	c3                   	ret
+		} else if (!stream_fill(f))
+  8024d5:	89 f0                	mov    %esi,%eax
+  8024d7:	e8 da fb ff ff       	call   8020b6 <stream_fill>
+  8024dc:	85 c0                	test   %eax,%eax
+  8024de:	74 dc                	je     8024bc <fread+0xa7>
+			m = 0;
+  8024e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024e5:	eb 93                	jmp    80247a <fread+0x65>
+
+008024e7 <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  8024e7:	55                   	push   %ebp
+  8024e8:	89 e5                	mov    %esp,%ebp
+  8024ea:	57                   	push   %edi
+  8024eb:	56                   	push   %esi
+  8024ec:	53                   	push   %ebx
+  8024ed:	83 ec 1c             	sub    $0x1c,%esp
+  8024f0:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  8024f3:	8b 43 04             	mov    0x4(%ebx),%eax
+  8024f6:	a8 02                	test   $0x2,%al
+  8024f8:	75 13                	jne    80250d <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  8024fa:	83 c8 08             	or     $0x8,%eax
+  8024fd:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  802500:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  802505:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802508:	5b                   	pop    %ebx
+  802509:	5e                   	pop    %esi
+  80250a:	5f                   	pop    %edi
+  80250b:	5d                   	pop    %ebp
+  80250c:	c3                   	ret
+	stream_setup(f);
+  80250d:	89 d8                	mov    %ebx,%eax
+  80250f:	e8 35 fb ff ff       	call   802049 <stream_setup>
+	want = size * n;
+  802514:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802517:	0f af 45 10          	imul   0x10(%ebp),%eax
+  80251b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  80251e:	89 d8                	mov    %ebx,%eax
+  802520:	e8 41 fa ff ff       	call   801f66 <stream_unread>
+	for (done = 0; done < want; ) {
+  802525:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  80252a:	84 c0                	test   %al,%al
+  80252c:	75 7b                	jne    8025a9 <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  80252e:	be 00 00 00 00       	mov    $0x0,%esi
+  802533:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802536:	39 fe                	cmp    %edi,%esi
+  802538:	73 24                	jae    80255e <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  80253a:	83 ec 04             	sub    $0x4,%esp
+  80253d:	89 f8                	mov    %edi,%eax
+  80253f:	29 f0                	sub    %esi,%eax
+  802541:	50                   	push   %eax
+  802542:	89 f0                	mov    %esi,%eax
+  802544:	03 45 08             	add    0x8(%ebp),%eax
+  802547:	50                   	push   %eax
+  802548:	ff 33                	push   (%ebx)
+  80254a:	e8 a0 ef ff ff       	call   8014ef <write>
+  80254f:	83 c4 10             	add    $0x10,%esp
+  802552:	85 c0                	test   %eax,%eax
+  802554:	7e 04                	jle    80255a <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  802556:	01 c6                	add    %eax,%esi
+  802558:	eb dc                	jmp    802536 <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  80255a:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  80255e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802561:	85 c0                	test   %eax,%eax
+  802563:	74 a0                	je     802505 <fwrite+0x1e>
+  802565:	89 f0                	mov    %esi,%eax
+  802567:	ba 00 00 00 00       	mov    $0x0,%edx
+  80256c:	f7 75 0c             	divl   0xc(%ebp)
+  80256f:	eb 94                	jmp    802505 <fwrite+0x1e>
+			done += r;
+  802571:	01 c7                	add    %eax,%edi
+			continue;
+  802573:	eb 34                	jmp    8025a9 <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  802575:	8b 73 10             	mov    0x10(%ebx),%esi
+  802578:	29 c6                	sub    %eax,%esi
+  80257a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80257d:	29 fa                	sub    %edi,%edx
+  80257f:	39 d6                	cmp    %edx,%esi
+  802581:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  802584:	83 ec 04             	sub    $0x4,%esp
+  802587:	56                   	push   %esi
+  802588:	89 fa                	mov    %edi,%edx
+  80258a:	03 55 08             	add    0x8(%ebp),%edx
+  80258d:	52                   	push   %edx
+  80258e:	03 43 0c             	add    0xc(%ebx),%eax
+  802591:	50                   	push   %eax
+  802592:	e8 f9 e3 ff ff       	call   800990 <memmove>
+		f->f_wend += m;
+  802597:	89 f0                	mov    %esi,%eax
+  802599:	03 43 1c             	add    0x1c(%ebx),%eax
+  80259c:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  80259f:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  8025a1:	83 c4 10             	add    $0x10,%esp
+  8025a4:	3b 43 10             	cmp    0x10(%ebx),%eax
+  8025a7:	74 5b                	je     802604 <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  8025a9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8025ac:	39 c7                	cmp    %eax,%edi
+  8025ae:	73 2d                	jae    8025dd <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  8025b0:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8025b3:	85 c0                	test   %eax,%eax
+  8025b5:	75 be                	jne    802575 <fwrite+0x8e>
+  8025b7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8025ba:	29 fa                	sub    %edi,%edx
+  8025bc:	3b 53 10             	cmp    0x10(%ebx),%edx
+  8025bf:	72 b4                	jb     802575 <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  8025c1:	83 ec 04             	sub    $0x4,%esp
+  8025c4:	52                   	push   %edx
+  8025c5:	89 f8                	mov    %edi,%eax
+  8025c7:	03 45 08             	add    0x8(%ebp),%eax
+  8025ca:	50                   	push   %eax
+  8025cb:	ff 33                	push   (%ebx)
+  8025cd:	e8 1d ef ff ff       	call   8014ef <write>
+  8025d2:	83 c4 10             	add    $0x10,%esp
+  8025d5:	85 c0                	test   %eax,%eax
+  8025d7:	7f 98                	jg     802571 <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  8025d9:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  8025dd:	8b 43 08             	mov    0x8(%ebx),%eax
+  8025e0:	83 f8 03             	cmp    $0x3,%eax
+  8025e3:	74 48                	je     80262d <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  8025e5:	83 f8 02             	cmp    $0x2,%eax
+  8025e8:	74 27                	je     802611 <fwrite+0x12a>
+	return size ? done / size : 0;
+  8025ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025ed:	85 c0                	test   %eax,%eax
+  8025ef:	0f 84 10 ff ff ff    	je     802505 <fwrite+0x1e>
+  8025f5:	89 f8                	mov    %edi,%eax
+  8025f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025fc:	f7 75 0c             	divl   0xc(%ebp)
+  8025ff:	e9 01 ff ff ff       	jmp    802505 <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802604:	89 d8                	mov    %ebx,%eax
+  802606:	e8 ce f9 ff ff       	call   801fd9 <stream_drain>
+  80260b:	85 c0                	test   %eax,%eax
+  80260d:	79 9a                	jns    8025a9 <fwrite+0xc2>
+  80260f:	eb cc                	jmp    8025dd <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802611:	83 ec 04             	sub    $0x4,%esp
+  802614:	57                   	push   %edi
+  802615:	6a 0a                	push   $0xa
+  802617:	ff 75 08             	push   0x8(%ebp)
+  80261a:	e8 22 e4 ff ff       	call   800a41 <memfind>
+  80261f:	89 c2                	mov    %eax,%edx
+  802621:	89 f8                	mov    %edi,%eax
+  802623:	03 45 08             	add    0x8(%ebp),%eax
+  802626:	83 c4 10             	add    $0x10,%esp
+  802629:	39 c2                	cmp    %eax,%edx
+  80262b:	74 bd                	je     8025ea <fwrite+0x103>
+		stream_drain(f);
+  80262d:	89 d8                	mov    %ebx,%eax
+  80262f:	e8 a5 f9 ff ff       	call   801fd9 <stream_drain>
+  802634:	eb b4                	jmp    8025ea <fwrite+0x103>
+
+00802636 <fputc>:
+{
+  802636:	55                   	push   %ebp
+  802637:	89 e5                	mov    %esp,%ebp
+  802639:	53                   	push   %ebx
+  80263a:	83 ec 14             	sub    $0x14,%esp
+  80263d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  802640:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  802643:	ff 75 0c             	push   0xc(%ebp)
+  802646:	6a 01                	push   $0x1
+  802648:	6a 01                	push   $0x1
+  80264a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80264d:	50                   	push   %eax
+  80264e:	e8 94 fe ff ff       	call   8024e7 <fwrite>
+  802653:	83 c4 10             	add    $0x10,%esp
+  802656:	0f b6 db             	movzbl %bl,%ebx
+  802659:	83 f8 01             	cmp    $0x1,%eax
+  80265c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802661:	0f 44 c3             	cmove  %ebx,%eax
+}
+  802664:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802667:	c9                   	leave
+  802668:	c3                   	ret
+
+00802669 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  802669:	55                   	push   %ebp
+  80266a:	89 e5                	mov    %esp,%ebp
+  80266c:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  80266f:	ff 75 0c             	push   0xc(%ebp)
+  802672:	ff 75 08             	push   0x8(%ebp)
+  802675:	e8 bc ff ff ff       	call   802636 <fputc>
+}
+  80267a:	83 c4 10             	add    $0x10,%esp
+  80267d:	c9                   	leave
+  80267e:	c3                   	ret
+
+0080267f <fputs>:
+{
+  80267f:	55                   	push   %ebp
+  802680:	89 e5                	mov    %esp,%ebp
+  802682:	56                   	push   %esi
+  802683:	53                   	push   %ebx
+  802684:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  802687:	83 ec 0c             	sub    $0xc,%esp
+  80268a:	56                   	push   %esi
+  80268b:	e8 3f e1 ff ff       	call   8007cf <strlen>
+  802690:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  802692:	ff 75 0c             	push   0xc(%ebp)
+  802695:	50                   	push   %eax
+  802696:	6a 01                	push   $0x1
+  802698:	56                   	push   %esi
+  802699:	e8 49 fe ff ff       	call   8024e7 <fwrite>
+  80269e:	83 c4 20             	add    $0x20,%esp
+  8026a1:	39 d8                	cmp    %ebx,%eax
+  8026a3:	0f 95 c0             	setne  %al
+  8026a6:	0f b6 c0             	movzbl %al,%eax
+  8026a9:	f7 d8                	neg    %eax
+}
+  8026ab:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026ae:	5b                   	pop    %ebx
+  8026af:	5e                   	pop    %esi
+  8026b0:	5d                   	pop    %ebp
+  8026b1:	c3                   	ret
+
+008026b2 <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  8026b2:	55                   	push   %ebp
+  8026b3:	89 e5                	mov    %esp,%ebp
+  8026b5:	53                   	push   %ebx
+  8026b6:	83 ec 04             	sub    $0x4,%esp
+  8026b9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8026bc:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  8026bf:	50                   	push   %eax
+  8026c0:	ff 75 0c             	push   0xc(%ebp)
+  8026c3:	53                   	push   %ebx
+  8026c4:	68 69 26 80 00       	push   $0x802669
+  8026c9:	e8 4f dc ff ff       	call   80031d <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  8026ce:	8b 43 04             	mov    0x4(%ebx),%eax
+  8026d1:	c1 e0 1c             	shl    $0x1c,%eax
+  8026d4:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  8026d7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026da:	c9                   	leave
+  8026db:	c3                   	ret
+
+008026dc <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8026dc:	55                   	push   %ebp
+  8026dd:	89 e5                	mov    %esp,%ebp
+  8026df:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8026e2:	68 f8 4c 80 00       	push   $0x804cf8
+  8026e7:	ff 75 0c             	push   0xc(%ebp)
+  8026ea:	e8 1b e1 ff ff       	call   80080a <strcpy>
+	return 0;
+}
+  8026ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026f4:	c9                   	leave
+  8026f5:	c3                   	ret
+
+008026f6 <devsock_close>:
+{
+  8026f6:	55                   	push   %ebp
+  8026f7:	89 e5                	mov    %esp,%ebp
+  8026f9:	53                   	push   %ebx
+  8026fa:	83 ec 10             	sub    $0x10,%esp
+  8026fd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802700:	53                   	push   %ebx
+  802701:	e8 dc 1d 00 00       	call   8044e2 <pageref>
+  802706:	89 c2                	mov    %eax,%edx
+  802708:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80270b:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802710:	83 fa 01             	cmp    $0x1,%edx
+  802713:	74 05                	je     80271a <devsock_close+0x24>
+}
+  802715:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802718:	c9                   	leave
+  802719:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80271a:	83 ec 0c             	sub    $0xc,%esp
+  80271d:	ff 73 0c             	push   0xc(%ebx)
+  802720:	e8 b7 02 00 00       	call   8029dc <nsipc_close>
+  802725:	83 c4 10             	add    $0x10,%esp
+  802728:	eb eb                	jmp    802715 <devsock_close+0x1f>
+
+0080272a <devsock_write>:
+{
+  80272a:	55                   	push   %ebp
+  80272b:	89 e5                	mov    %esp,%ebp
+  80272d:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802730:	6a 00                	push   $0x0
+  802732:	ff 75 10             	push   0x10(%ebp)
+  802735:	ff 75 0c             	push   0xc(%ebp)
+  802738:	8b 45 08             	mov    0x8(%ebp),%eax
+  80273b:	ff 70 0c             	push   0xc(%eax)
+  80273e:	e8 79 03 00 00       	call   802abc <nsipc_send>
+}
+  802743:	c9                   	leave
+  802744:	c3                   	ret
+
+00802745 <devsock_read>:
+{
+  802745:	55                   	push   %ebp
+  802746:	89 e5                	mov    %esp,%ebp
+  802748:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80274b:	6a 00                	push   $0x0
+  80274d:	ff 75 10             	push   0x10(%ebp)
+  802750:	ff 75 0c             	push   0xc(%ebp)
+  802753:	8b 45 08             	mov    0x8(%ebp),%eax
+  802756:	ff 70 0c             	push   0xc(%eax)
+  802759:	e8 ef 02 00 00       	call   802a4d <nsipc_recv>
+}
+  80275e:	c9                   	leave
+  80275f:	c3                   	ret
+
+00802760 <fd2sockid>:
+{
+  802760:	55                   	push   %ebp
+  802761:	89 e5                	mov    %esp,%ebp
+  802763:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802766:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802769:	52                   	push   %edx
+  80276a:	50                   	push   %eax
+  80276b:	e8 f7 e9 ff ff       	call   801167 <fd_lookup>
+  802770:	83 c4 10             	add    $0x10,%esp
+  802773:	85 c0                	test   %eax,%eax
+  802775:	78 10                	js     802787 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802777:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80277a:	8b 0d 60 52 80 00    	mov    0x805260,%ecx
+  802780:	39 08                	cmp    %ecx,(%eax)
+  802782:	75 05                	jne    802789 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802784:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802787:	c9                   	leave
+  802788:	c3                   	ret
+		return -E_NOT_SUPP;
+  802789:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80278e:	eb f7                	jmp    802787 <fd2sockid+0x27>
+
+00802790 <alloc_sockfd>:
+{
+  802790:	55                   	push   %ebp
+  802791:	89 e5                	mov    %esp,%ebp
+  802793:	56                   	push   %esi
+  802794:	53                   	push   %ebx
+  802795:	83 ec 1c             	sub    $0x1c,%esp
+  802798:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  80279a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80279d:	50                   	push   %eax
+  80279e:	e8 6e e9 ff ff       	call   801111 <fd_alloc>
+  8027a3:	89 c3                	mov    %eax,%ebx
+  8027a5:	83 c4 10             	add    $0x10,%esp
+  8027a8:	85 c0                	test   %eax,%eax
+  8027aa:	78 43                	js     8027ef <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8027ac:	83 ec 04             	sub    $0x4,%esp
+  8027af:	68 07 04 00 00       	push   $0x407
+  8027b4:	ff 75 f4             	push   -0xc(%ebp)
+  8027b7:	6a 00                	push   $0x0
+  8027b9:	e8 8a e4 ff ff       	call   800c48 <sys_page_alloc>
+  8027be:	89 c3                	mov    %eax,%ebx
+  8027c0:	83 c4 10             	add    $0x10,%esp
+  8027c3:	85 c0                	test   %eax,%eax
+  8027c5:	78 28                	js     8027ef <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8027c7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027ca:	8b 15 60 52 80 00    	mov    0x805260,%edx
+  8027d0:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8027d2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027d5:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8027dc:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8027df:	83 ec 0c             	sub    $0xc,%esp
+  8027e2:	50                   	push   %eax
+  8027e3:	e8 02 e9 ff ff       	call   8010ea <fd2num>
+  8027e8:	89 c3                	mov    %eax,%ebx
+  8027ea:	83 c4 10             	add    $0x10,%esp
+  8027ed:	eb 0c                	jmp    8027fb <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8027ef:	83 ec 0c             	sub    $0xc,%esp
+  8027f2:	56                   	push   %esi
+  8027f3:	e8 e4 01 00 00       	call   8029dc <nsipc_close>
+		return r;
+  8027f8:	83 c4 10             	add    $0x10,%esp
+}
+  8027fb:	89 d8                	mov    %ebx,%eax
+  8027fd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802800:	5b                   	pop    %ebx
+  802801:	5e                   	pop    %esi
+  802802:	5d                   	pop    %ebp
+  802803:	c3                   	ret
+
+00802804 <accept>:
+{
+  802804:	55                   	push   %ebp
+  802805:	89 e5                	mov    %esp,%ebp
+  802807:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80280a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80280d:	e8 4e ff ff ff       	call   802760 <fd2sockid>
+  802812:	85 c0                	test   %eax,%eax
+  802814:	78 1b                	js     802831 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802816:	83 ec 04             	sub    $0x4,%esp
+  802819:	ff 75 10             	push   0x10(%ebp)
+  80281c:	ff 75 0c             	push   0xc(%ebp)
+  80281f:	50                   	push   %eax
+  802820:	e8 0e 01 00 00       	call   802933 <nsipc_accept>
+  802825:	83 c4 10             	add    $0x10,%esp
+  802828:	85 c0                	test   %eax,%eax
+  80282a:	78 05                	js     802831 <accept+0x2d>
+	return alloc_sockfd(r);
+  80282c:	e8 5f ff ff ff       	call   802790 <alloc_sockfd>
+}
+  802831:	c9                   	leave
+  802832:	c3                   	ret
+
+00802833 <bind>:
+{
+  802833:	55                   	push   %ebp
+  802834:	89 e5                	mov    %esp,%ebp
+  802836:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802839:	8b 45 08             	mov    0x8(%ebp),%eax
+  80283c:	e8 1f ff ff ff       	call   802760 <fd2sockid>
+  802841:	85 c0                	test   %eax,%eax
+  802843:	78 12                	js     802857 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802845:	83 ec 04             	sub    $0x4,%esp
+  802848:	ff 75 10             	push   0x10(%ebp)
+  80284b:	ff 75 0c             	push   0xc(%ebp)
+  80284e:	50                   	push   %eax
+  80284f:	e8 31 01 00 00       	call   802985 <nsipc_bind>
+  802854:	83 c4 10             	add    $0x10,%esp
+}
+  802857:	c9                   	leave
+  802858:	c3                   	ret
+
+00802859 <shutdown>:
+{
+  802859:	55                   	push   %ebp
+  80285a:	89 e5                	mov    %esp,%ebp
+  80285c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80285f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802862:	e8 f9 fe ff ff       	call   802760 <fd2sockid>
+  802867:	85 c0                	test   %eax,%eax
+  802869:	78 0f                	js     80287a <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  80286b:	83 ec 08             	sub    $0x8,%esp
+  80286e:	ff 75 0c             	push   0xc(%ebp)
+  802871:	50                   	push   %eax
+  802872:	e8 43 01 00 00       	call   8029ba <nsipc_shutdown>
+  802877:	83 c4 10             	add    $0x10,%esp
+}
+  80287a:	c9                   	leave
+  80287b:	c3                   	ret
+
+0080287c <connect>:
+{
+  80287c:	55                   	push   %ebp
+  80287d:	89 e5                	mov    %esp,%ebp
+  80287f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802882:	8b 45 08             	mov    0x8(%ebp),%eax
+  802885:	e8 d6 fe ff ff       	call   802760 <fd2sockid>
+  80288a:	85 c0                	test   %eax,%eax
+  80288c:	78 12                	js     8028a0 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  80288e:	83 ec 04             	sub    $0x4,%esp
+  802891:	ff 75 10             	push   0x10(%ebp)
+  802894:	ff 75 0c             	push   0xc(%ebp)
+  802897:	50                   	push   %eax
+  802898:	e8 59 01 00 00       	call   8029f6 <nsipc_connect>
+  80289d:	83 c4 10             	add    $0x10,%esp
+}
+  8028a0:	c9                   	leave
+  8028a1:	c3                   	ret
+
+008028a2 <listen>:
+{
+  8028a2:	55                   	push   %ebp
+  8028a3:	89 e5                	mov    %esp,%ebp
+  8028a5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8028a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028ab:	e8 b0 fe ff ff       	call   802760 <fd2sockid>
+  8028b0:	85 c0                	test   %eax,%eax
+  8028b2:	78 0f                	js     8028c3 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8028b4:	83 ec 08             	sub    $0x8,%esp
+  8028b7:	ff 75 0c             	push   0xc(%ebp)
+  8028ba:	50                   	push   %eax
+  8028bb:	e8 6b 01 00 00       	call   802a2b <nsipc_listen>
+  8028c0:	83 c4 10             	add    $0x10,%esp
+}
+  8028c3:	c9                   	leave
+  8028c4:	c3                   	ret
+
+008028c5 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8028c5:	55                   	push   %ebp
+  8028c6:	89 e5                	mov    %esp,%ebp
+  8028c8:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8028cb:	ff 75 10             	push   0x10(%ebp)
+  8028ce:	ff 75 0c             	push   0xc(%ebp)
+  8028d1:	ff 75 08             	push   0x8(%ebp)
+  8028d4:	e8 41 02 00 00       	call   802b1a <nsipc_socket>
+  8028d9:	83 c4 10             	add    $0x10,%esp
+  8028dc:	85 c0                	test   %eax,%eax
+  8028de:	78 05                	js     8028e5 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8028e0:	e8 ab fe ff ff       	call   802790 <alloc_sockfd>
+}
+  8028e5:	c9                   	leave
+  8028e6:	c3                   	ret
+
+008028e7 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8028e7:	55                   	push   %ebp
+  8028e8:	89 e5                	mov    %esp,%ebp
+  8028ea:	53                   	push   %ebx
+  8028eb:	83 ec 04             	sub    $0x4,%esp
+  8028ee:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8028f0:	83 3d 08 60 80 00 00 	cmpl   $0x0,0x806008
+  8028f7:	74 26                	je     80291f <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8028f9:	6a 07                	push   $0x7
+  8028fb:	68 00 80 80 00       	push   $0x808000
+  802900:	53                   	push   %ebx
+  802901:	ff 35 08 60 80 00    	push   0x806008
+  802907:	e8 41 1b 00 00       	call   80444d <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  80290c:	83 c4 0c             	add    $0xc,%esp
+  80290f:	6a 00                	push   $0x0
+  802911:	6a 00                	push   $0x0
+  802913:	6a 00                	push   $0x0
+  802915:	e8 3d 1a 00 00       	call   804357 <ipc_recv>
+}
+  80291a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80291d:	c9                   	leave
+  80291e:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80291f:	83 ec 0c             	sub    $0xc,%esp
+  802922:	6a 02                	push   $0x2
+  802924:	e8 7a 1b 00 00       	call   8044a3 <ipc_find_env>
+  802929:	a3 08 60 80 00       	mov    %eax,0x806008
+  80292e:	83 c4 10             	add    $0x10,%esp
+  802931:	eb c6                	jmp    8028f9 <nsipc+0x12>
+
+00802933 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802933:	55                   	push   %ebp
+  802934:	89 e5                	mov    %esp,%ebp
+  802936:	56                   	push   %esi
+  802937:	53                   	push   %ebx
+  802938:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80293b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80293e:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802943:	8b 06                	mov    (%esi),%eax
+  802945:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80294a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80294f:	e8 93 ff ff ff       	call   8028e7 <nsipc>
+  802954:	89 c3                	mov    %eax,%ebx
+  802956:	85 c0                	test   %eax,%eax
+  802958:	79 09                	jns    802963 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  80295a:	89 d8                	mov    %ebx,%eax
+  80295c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80295f:	5b                   	pop    %ebx
+  802960:	5e                   	pop    %esi
+  802961:	5d                   	pop    %ebp
+  802962:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802963:	83 ec 04             	sub    $0x4,%esp
+  802966:	ff 35 10 80 80 00    	push   0x808010
+  80296c:	68 00 80 80 00       	push   $0x808000
+  802971:	ff 75 0c             	push   0xc(%ebp)
+  802974:	e8 17 e0 ff ff       	call   800990 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802979:	a1 10 80 80 00       	mov    0x808010,%eax
+  80297e:	89 06                	mov    %eax,(%esi)
+  802980:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802983:	eb d5                	jmp    80295a <nsipc_accept+0x27>
+
+00802985 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802985:	55                   	push   %ebp
+  802986:	89 e5                	mov    %esp,%ebp
+  802988:	53                   	push   %ebx
+  802989:	83 ec 08             	sub    $0x8,%esp
+  80298c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  80298f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802992:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802997:	53                   	push   %ebx
+  802998:	ff 75 0c             	push   0xc(%ebp)
+  80299b:	68 04 80 80 00       	push   $0x808004
+  8029a0:	e8 eb df ff ff       	call   800990 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8029a5:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  8029ab:	b8 02 00 00 00       	mov    $0x2,%eax
+  8029b0:	e8 32 ff ff ff       	call   8028e7 <nsipc>
+}
+  8029b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029b8:	c9                   	leave
+  8029b9:	c3                   	ret
+
+008029ba <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8029ba:	55                   	push   %ebp
+  8029bb:	89 e5                	mov    %esp,%ebp
+  8029bd:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8029c0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029c3:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  8029c8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8029cb:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  8029d0:	b8 03 00 00 00       	mov    $0x3,%eax
+  8029d5:	e8 0d ff ff ff       	call   8028e7 <nsipc>
+}
+  8029da:	c9                   	leave
+  8029db:	c3                   	ret
+
+008029dc <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8029dc:	55                   	push   %ebp
+  8029dd:	89 e5                	mov    %esp,%ebp
+  8029df:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8029e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029e5:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  8029ea:	b8 04 00 00 00       	mov    $0x4,%eax
+  8029ef:	e8 f3 fe ff ff       	call   8028e7 <nsipc>
+}
+  8029f4:	c9                   	leave
+  8029f5:	c3                   	ret
+
+008029f6 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8029f6:	55                   	push   %ebp
+  8029f7:	89 e5                	mov    %esp,%ebp
+  8029f9:	53                   	push   %ebx
+  8029fa:	83 ec 08             	sub    $0x8,%esp
+  8029fd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802a00:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a03:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802a08:	53                   	push   %ebx
+  802a09:	ff 75 0c             	push   0xc(%ebp)
+  802a0c:	68 04 80 80 00       	push   $0x808004
+  802a11:	e8 7a df ff ff       	call   800990 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802a16:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  802a1c:	b8 05 00 00 00       	mov    $0x5,%eax
+  802a21:	e8 c1 fe ff ff       	call   8028e7 <nsipc>
+}
+  802a26:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a29:	c9                   	leave
+  802a2a:	c3                   	ret
+
+00802a2b <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802a2b:	55                   	push   %ebp
+  802a2c:	89 e5                	mov    %esp,%ebp
+  802a2e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802a31:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a34:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802a39:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a3c:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802a41:	b8 06 00 00 00       	mov    $0x6,%eax
+  802a46:	e8 9c fe ff ff       	call   8028e7 <nsipc>
+}
+  802a4b:	c9                   	leave
+  802a4c:	c3                   	ret
+
+00802a4d <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802a4d:	55                   	push   %ebp
+  802a4e:	89 e5                	mov    %esp,%ebp
+  802a50:	56                   	push   %esi
+  802a51:	53                   	push   %ebx
+  802a52:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802a55:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a58:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  802a5d:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  802a63:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a66:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802a6b:	b8 07 00 00 00       	mov    $0x7,%eax
+  802a70:	e8 72 fe ff ff       	call   8028e7 <nsipc>
+  802a75:	89 c3                	mov    %eax,%ebx
+  802a77:	85 c0                	test   %eax,%eax
+  802a79:	78 22                	js     802a9d <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802a7b:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802a80:	39 c6                	cmp    %eax,%esi
+  802a82:	0f 4e c6             	cmovle %esi,%eax
+  802a85:	39 c3                	cmp    %eax,%ebx
+  802a87:	7f 1d                	jg     802aa6 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802a89:	83 ec 04             	sub    $0x4,%esp
+  802a8c:	53                   	push   %ebx
+  802a8d:	68 00 80 80 00       	push   $0x808000
+  802a92:	ff 75 0c             	push   0xc(%ebp)
+  802a95:	e8 f6 de ff ff       	call   800990 <memmove>
+  802a9a:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802a9d:	89 d8                	mov    %ebx,%eax
+  802a9f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802aa2:	5b                   	pop    %ebx
+  802aa3:	5e                   	pop    %esi
+  802aa4:	5d                   	pop    %ebp
+  802aa5:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802aa6:	68 04 4d 80 00       	push   $0x804d04
+  802aab:	68 bd 4c 80 00       	push   $0x804cbd
+  802ab0:	6a 62                	push   $0x62
+  802ab2:	68 19 4d 80 00       	push   $0x804d19
+  802ab7:	e8 8f d6 ff ff       	call   80014b <_panic>
+
+00802abc <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802abc:	55                   	push   %ebp
+  802abd:	89 e5                	mov    %esp,%ebp
+  802abf:	53                   	push   %ebx
+  802ac0:	83 ec 04             	sub    $0x4,%esp
+  802ac3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802ac6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ac9:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802ace:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802ad4:	7f 2e                	jg     802b04 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802ad6:	83 ec 04             	sub    $0x4,%esp
+  802ad9:	53                   	push   %ebx
+  802ada:	ff 75 0c             	push   0xc(%ebp)
+  802add:	68 0c 80 80 00       	push   $0x80800c
+  802ae2:	e8 a9 de ff ff       	call   800990 <memmove>
+	nsipcbuf.send.req_size = size;
+  802ae7:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802aed:	8b 45 14             	mov    0x14(%ebp),%eax
+  802af0:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802af5:	b8 08 00 00 00       	mov    $0x8,%eax
+  802afa:	e8 e8 fd ff ff       	call   8028e7 <nsipc>
+}
+  802aff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b02:	c9                   	leave
+  802b03:	c3                   	ret
+	assert(size < 1600);
+  802b04:	68 25 4d 80 00       	push   $0x804d25
+  802b09:	68 bd 4c 80 00       	push   $0x804cbd
+  802b0e:	6a 6d                	push   $0x6d
+  802b10:	68 19 4d 80 00       	push   $0x804d19
+  802b15:	e8 31 d6 ff ff       	call   80014b <_panic>
+
+00802b1a <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802b1a:	55                   	push   %ebp
+  802b1b:	89 e5                	mov    %esp,%ebp
+  802b1d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802b20:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b23:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  802b28:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b2b:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802b30:	8b 45 10             	mov    0x10(%ebp),%eax
+  802b33:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802b38:	b8 09 00 00 00       	mov    $0x9,%eax
+  802b3d:	e8 a5 fd ff ff       	call   8028e7 <nsipc>
+}
+  802b42:	c9                   	leave
+  802b43:	c3                   	ret
+
+00802b44 <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  802b44:	55                   	push   %ebp
+  802b45:	89 e5                	mov    %esp,%ebp
+  802b47:	53                   	push   %ebx
+  802b48:	83 ec 10             	sub    $0x10,%esp
+  802b4b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  802b4e:	68 0c 60 80 00       	push   $0x80600c
+  802b53:	e8 09 08 00 00       	call   803361 <mutex_lock>
+	if (v == 0)
+  802b58:	83 c4 10             	add    $0x10,%esp
+  802b5b:	85 db                	test   %ebx,%ebx
+  802b5d:	0f 84 85 00 00 00    	je     802be8 <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802b63:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802b69:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802b6e:	77 51                	ja     802bc1 <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  802b70:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  802b76:	89 d8                	mov    %ebx,%eax
+  802b78:	c1 e8 0c             	shr    $0xc,%eax
+  802b7b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802b82:	f6 c4 02             	test   $0x2,%ah
+  802b85:	74 50                	je     802bd7 <free+0x93>
+		sys_page_unmap(0, c);
+  802b87:	83 ec 08             	sub    $0x8,%esp
+  802b8a:	53                   	push   %ebx
+  802b8b:	6a 00                	push   $0x0
+  802b8d:	e8 4f e1 ff ff       	call   800ce1 <sys_page_unmap>
+		c += PGSIZE;
+  802b92:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  802b98:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802b9e:	83 c4 10             	add    $0x10,%esp
+  802ba1:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802ba6:	76 ce                	jbe    802b76 <free+0x32>
+  802ba8:	68 6f 4d 80 00       	push   $0x804d6f
+  802bad:	68 bd 4c 80 00       	push   $0x804cbd
+  802bb2:	68 82 00 00 00       	push   $0x82
+  802bb7:	68 62 4d 80 00       	push   $0x804d62
+  802bbc:	e8 8a d5 ff ff       	call   80014b <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802bc1:	68 34 4d 80 00       	push   $0x804d34
+  802bc6:	68 bd 4c 80 00       	push   $0x804cbd
+  802bcb:	6a 7b                	push   $0x7b
+  802bcd:	68 62 4d 80 00       	push   $0x804d62
+  802bd2:	e8 74 d5 ff ff       	call   80014b <_panic>
+	if (--(*ref) == 0)
+  802bd7:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  802bdd:	83 e8 01             	sub    $0x1,%eax
+  802be0:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  802be6:	74 15                	je     802bfd <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  802be8:	83 ec 0c             	sub    $0xc,%esp
+  802beb:	68 0c 60 80 00       	push   $0x80600c
+  802bf0:	e8 d9 07 00 00       	call   8033ce <mutex_unlock>
+}
+  802bf5:	83 c4 10             	add    $0x10,%esp
+  802bf8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bfb:	c9                   	leave
+  802bfc:	c3                   	ret
+		sys_page_unmap(0, c);
+  802bfd:	83 ec 08             	sub    $0x8,%esp
+  802c00:	53                   	push   %ebx
+  802c01:	6a 00                	push   $0x0
+  802c03:	e8 d9 e0 ff ff       	call   800ce1 <sys_page_unmap>
+  802c08:	83 c4 10             	add    $0x10,%esp
+  802c0b:	eb db                	jmp    802be8 <free+0xa4>
+
+00802c0d <malloc>:
+{
+  802c0d:	55                   	push   %ebp
+  802c0e:	89 e5                	mov    %esp,%ebp
+  802c10:	57                   	push   %edi
+  802c11:	56                   	push   %esi
+  802c12:	53                   	push   %ebx
+  802c13:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  802c16:	68 0c 60 80 00       	push   $0x80600c
+  802c1b:	e8 41 07 00 00       	call   803361 <mutex_lock>
+	if (mptr == 0)
+  802c20:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+  802c26:	83 c4 10             	add    $0x10,%esp
+  802c29:	85 ff                	test   %edi,%edi
+  802c2b:	74 6c                	je     802c99 <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  802c2d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c30:	83 c0 03             	add    $0x3,%eax
+  802c33:	83 e0 fc             	and    $0xfffffffc,%eax
+  802c36:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  802c38:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  802c3d:	0f 87 64 01 00 00    	ja     802da7 <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  802c43:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  802c49:	74 30                	je     802c7b <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  802c4b:	89 f9                	mov    %edi,%ecx
+  802c4d:	c1 e9 0c             	shr    $0xc,%ecx
+  802c50:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  802c54:	c1 e8 0c             	shr    $0xc,%eax
+  802c57:	39 c1                	cmp    %eax,%ecx
+  802c59:	74 5f                	je     802cba <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  802c5b:	83 ec 0c             	sub    $0xc,%esp
+  802c5e:	57                   	push   %edi
+  802c5f:	e8 e0 fe ff ff       	call   802b44 <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  802c64:	a1 10 60 80 00       	mov    0x806010,%eax
+  802c69:	05 00 10 00 00       	add    $0x1000,%eax
+  802c6e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802c73:	a3 10 60 80 00       	mov    %eax,0x806010
+  802c78:	83 c4 10             	add    $0x10,%esp
+  802c7b:	8b 0d 10 60 80 00    	mov    0x806010,%ecx
+{
+  802c81:	ba 02 00 00 00       	mov    $0x2,%edx
+  802c86:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  802c8a:	8d 7e 04             	lea    0x4(%esi),%edi
+  802c8d:	89 cb                	mov    %ecx,%ebx
+  802c8f:	01 f9                	add    %edi,%ecx
+  802c91:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802c94:	e9 8b 00 00 00       	jmp    802d24 <malloc+0x117>
+		mptr = mbegin;
+  802c99:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  802ca0:	00 00 08 
+	n = ROUNDUP(n, 4);
+  802ca3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ca6:	83 c0 03             	add    $0x3,%eax
+  802ca9:	83 e0 fc             	and    $0xfffffffc,%eax
+  802cac:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  802cae:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  802cb3:	76 c6                	jbe    802c7b <malloc+0x6e>
+  802cb5:	e9 d6 00 00 00       	jmp    802d90 <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  802cba:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802cc0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  802cc5:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  802cc9:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  802ccc:	a3 10 60 80 00       	mov    %eax,0x806010
+			return v;
+  802cd1:	e9 ba 00 00 00       	jmp    802d90 <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  802cd6:	05 00 10 00 00       	add    $0x1000,%eax
+  802cdb:	39 c8                	cmp    %ecx,%eax
+  802cdd:	0f 83 cb 00 00 00    	jae    802dae <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  802ce3:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  802ce8:	77 22                	ja     802d0c <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  802cea:	89 c2                	mov    %eax,%edx
+  802cec:	c1 ea 16             	shr    $0x16,%edx
+  802cef:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802cf6:	f6 c2 01             	test   $0x1,%dl
+  802cf9:	74 db                	je     802cd6 <malloc+0xc9>
+  802cfb:	89 c2                	mov    %eax,%edx
+  802cfd:	c1 ea 0c             	shr    $0xc,%edx
+  802d00:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802d07:	f6 c2 01             	test   $0x1,%dl
+  802d0a:	74 ca                	je     802cd6 <malloc+0xc9>
+		if (mptr == mend) {
+  802d0c:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802d12:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  802d18:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  802d1c:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  802d22:	74 04                	je     802d28 <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  802d24:	89 d8                	mov    %ebx,%eax
+  802d26:	eb b3                	jmp    802cdb <malloc+0xce>
+  802d28:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  802d2b:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  802d30:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  802d34:	83 ea 01             	sub    $0x1,%edx
+  802d37:	0f 85 50 ff ff ff    	jne    802c8d <malloc+0x80>
+  802d3d:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  802d44:	00 00 08 
+				return 0;	/* out of address space */
+  802d47:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d4c:	eb 42                	jmp    802d90 <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  802d4e:	85 db                	test   %ebx,%ebx
+  802d50:	78 1e                	js     802d70 <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  802d52:	83 ec 08             	sub    $0x8,%esp
+  802d55:	89 d8                	mov    %ebx,%eax
+  802d57:	03 05 10 60 80 00    	add    0x806010,%eax
+  802d5d:	50                   	push   %eax
+  802d5e:	6a 00                	push   $0x0
+  802d60:	e8 7c df ff ff       	call   800ce1 <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  802d65:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  802d6b:	83 c4 10             	add    $0x10,%esp
+  802d6e:	eb de                	jmp    802d4e <malloc+0x141>
+			return 0;	/* out of physical memory */
+  802d70:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d75:	eb 19                	jmp    802d90 <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  802d77:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802d7a:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  802d80:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  802d87:	00 
+	mptr += n;
+  802d88:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  802d8b:	a3 10 60 80 00       	mov    %eax,0x806010
+	mutex_unlock(&malloc_mu);
+  802d90:	83 ec 0c             	sub    $0xc,%esp
+  802d93:	68 0c 60 80 00       	push   $0x80600c
+  802d98:	e8 31 06 00 00       	call   8033ce <mutex_unlock>
+}
+  802d9d:	89 f8                	mov    %edi,%eax
+  802d9f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802da2:	5b                   	pop    %ebx
+  802da3:	5e                   	pop    %esi
+  802da4:	5f                   	pop    %edi
+  802da5:	5d                   	pop    %ebp
+  802da6:	c3                   	ret
+		return 0;
+  802da7:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dac:	eb e2                	jmp    802d90 <malloc+0x183>
+  802dae:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  802db2:	74 06                	je     802dba <malloc+0x1ad>
+  802db4:	89 1d 10 60 80 00    	mov    %ebx,0x806010
+	for (i = 0; i < n + 4; i += PGSIZE){
+  802dba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802dbf:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  802dc2:	39 fb                	cmp    %edi,%ebx
+  802dc4:	73 b1                	jae    802d77 <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  802dc6:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  802dcc:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  802dcf:	39 fe                	cmp    %edi,%esi
+  802dd1:	0f 92 c0             	setb   %al
+  802dd4:	0f b6 c0             	movzbl %al,%eax
+  802dd7:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  802dda:	83 c8 07             	or     $0x7,%eax
+  802ddd:	50                   	push   %eax
+  802dde:	89 d8                	mov    %ebx,%eax
+  802de0:	03 05 10 60 80 00    	add    0x806010,%eax
+  802de6:	50                   	push   %eax
+  802de7:	6a 00                	push   $0x0
+  802de9:	e8 5a de ff ff       	call   800c48 <sys_page_alloc>
+  802dee:	83 c4 10             	add    $0x10,%esp
+  802df1:	85 c0                	test   %eax,%eax
+  802df3:	0f 88 55 ff ff ff    	js     802d4e <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  802df9:	89 f3                	mov    %esi,%ebx
+  802dfb:	eb c5                	jmp    802dc2 <malloc+0x1b5>
+
+00802dfd <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802dfd:	55                   	push   %ebp
+  802dfe:	89 e5                	mov    %esp,%ebp
+  802e00:	56                   	push   %esi
+  802e01:	53                   	push   %ebx
+  802e02:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802e05:	83 ec 0c             	sub    $0xc,%esp
+  802e08:	ff 75 08             	push   0x8(%ebp)
+  802e0b:	e8 ea e2 ff ff       	call   8010fa <fd2data>
+  802e10:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802e12:	83 c4 08             	add    $0x8,%esp
+  802e15:	68 87 4d 80 00       	push   $0x804d87
+  802e1a:	53                   	push   %ebx
+  802e1b:	e8 ea d9 ff ff       	call   80080a <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802e20:	8b 46 04             	mov    0x4(%esi),%eax
+  802e23:	2b 06                	sub    (%esi),%eax
+  802e25:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802e2b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802e32:	00 00 00 
+	stat->st_dev = &devpipe;
+  802e35:	c7 83 88 00 00 00 7c 	movl   $0x80527c,0x88(%ebx)
+  802e3c:	52 80 00 
+	return 0;
+}
+  802e3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e44:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e47:	5b                   	pop    %ebx
+  802e48:	5e                   	pop    %esi
+  802e49:	5d                   	pop    %ebp
+  802e4a:	c3                   	ret
+
+00802e4b <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  802e4b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802e50:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  802e54:	85 c9                	test   %ecx,%ecx
+  802e56:	75 01                	jne    802e59 <pipewake+0xe>
+  802e58:	c3                   	ret
+{
+  802e59:	55                   	push   %ebp
+  802e5a:	89 e5                	mov    %esp,%ebp
+  802e5c:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  802e5f:	68 00 04 00 00       	push   $0x400
+  802e64:	52                   	push   %edx
+  802e65:	e8 22 e1 ff ff       	call   800f8c <sys_futex_wake>
+  802e6a:	83 c4 10             	add    $0x10,%esp
+}
+  802e6d:	c9                   	leave
+  802e6e:	c3                   	ret
+
+00802e6f <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802e6f:	55                   	push   %ebp
+  802e70:	89 e5                	mov    %esp,%ebp
+  802e72:	56                   	push   %esi
+  802e73:	53                   	push   %ebx
+  802e74:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802e77:	83 ec 0c             	sub    $0xc,%esp
+  802e7a:	56                   	push   %esi
+  802e7b:	e8 7a e2 ff ff       	call   8010fa <fd2data>
+  802e80:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  802e82:	83 c4 08             	add    $0x8,%esp
+  802e85:	56                   	push   %esi
+  802e86:	6a 00                	push   $0x0
+  802e88:	e8 54 de ff ff       	call   800ce1 <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  802e8d:	8d 53 04             	lea    0x4(%ebx),%edx
+  802e90:	8d 43 08             	lea    0x8(%ebx),%eax
+  802e93:	e8 b3 ff ff ff       	call   802e4b <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  802e98:	8d 43 0c             	lea    0xc(%ebx),%eax
+  802e9b:	89 da                	mov    %ebx,%edx
+  802e9d:	e8 a9 ff ff ff       	call   802e4b <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  802ea2:	89 34 24             	mov    %esi,(%esp)
+  802ea5:	e8 50 e2 ff ff       	call   8010fa <fd2data>
+  802eaa:	83 c4 08             	add    $0x8,%esp
+  802ead:	50                   	push   %eax
+  802eae:	6a 00                	push   $0x0
+  802eb0:	e8 2c de ff ff       	call   800ce1 <sys_page_unmap>
+}
+  802eb5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802eb8:	5b                   	pop    %ebx
+  802eb9:	5e                   	pop    %esi
+  802eba:	5d                   	pop    %ebp
+  802ebb:	c3                   	ret
+
+00802ebc <_pipeisclosed>:
+{
+  802ebc:	55                   	push   %ebp
+  802ebd:	89 e5                	mov    %esp,%ebp
+  802ebf:	57                   	push   %edi
+  802ec0:	56                   	push   %esi
+  802ec1:	53                   	push   %ebx
+  802ec2:	83 ec 1c             	sub    $0x1c,%esp
+  802ec5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802ec8:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802eca:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  802ecf:	eb 5d                	jmp    802f2e <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  802ed1:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		n = thisenv->env_runs;
+  802ed7:	8b 02                	mov    (%edx),%eax
+  802ed9:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802edc:	83 ec 0c             	sub    $0xc,%esp
+  802edf:	ff 75 e0             	push   -0x20(%ebp)
+  802ee2:	e8 fb 15 00 00       	call   8044e2 <pageref>
+  802ee7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802eea:	89 3c 24             	mov    %edi,(%esp)
+  802eed:	e8 f0 15 00 00       	call   8044e2 <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  802ef2:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802ef4:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  802efa:	83 c4 10             	add    $0x10,%esp
+  802efd:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  802f03:	77 15                	ja     802f1a <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802f05:	89 f2                	mov    %esi,%edx
+  802f07:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  802f09:	c1 ea 10             	shr    $0x10,%edx
+  802f0c:	74 0c                	je     802f1a <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802f0e:	c1 e2 10             	shl    $0x10,%edx
+  802f11:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  802f16:	29 d1                	sub    %edx,%ecx
+  802f18:	eb 06                	jmp    802f20 <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  802f1a:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		nn = thisenv->env_runs;
+  802f20:	8b 11                	mov    (%ecx),%edx
+  802f22:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  802f25:	39 d3                	cmp    %edx,%ebx
+  802f27:	74 6e                	je     802f97 <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  802f29:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802f2c:	74 24                	je     802f52 <_pipeisclosed+0x96>
+  802f2e:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802f30:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802f36:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802f3b:	77 94                	ja     802ed1 <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802f3d:	89 f0                	mov    %esi,%eax
+  802f3f:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  802f41:	c1 e8 10             	shr    $0x10,%eax
+  802f44:	74 8b                	je     802ed1 <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802f46:	c1 e0 10             	shl    $0x10,%eax
+  802f49:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802f4e:	29 c2                	sub    %eax,%edx
+  802f50:	eb 85                	jmp    802ed7 <_pipeisclosed+0x1b>
+  802f52:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802f54:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802f5a:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802f5f:	77 18                	ja     802f79 <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802f61:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802f66:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  802f68:	c1 e8 10             	shr    $0x10,%eax
+  802f6b:	74 0c                	je     802f79 <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802f6d:	c1 e0 10             	shl    $0x10,%eax
+  802f70:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802f75:	29 c2                	sub    %eax,%edx
+  802f77:	eb 06                	jmp    802f7f <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  802f79:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802f7f:	8b 02                	mov    (%edx),%eax
+  802f81:	8b 40 58             	mov    0x58(%eax),%eax
+  802f84:	6a 01                	push   $0x1
+  802f86:	50                   	push   %eax
+  802f87:	53                   	push   %ebx
+  802f88:	68 8e 4d 80 00       	push   $0x804d8e
+  802f8d:	e8 94 d2 ff ff       	call   800226 <cprintf>
+  802f92:	83 c4 10             	add    $0x10,%esp
+  802f95:	eb 97                	jmp    802f2e <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  802f97:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802f9a:	0f 94 c0             	sete   %al
+  802f9d:	0f b6 c0             	movzbl %al,%eax
+}
+  802fa0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fa3:	5b                   	pop    %ebx
+  802fa4:	5e                   	pop    %esi
+  802fa5:	5f                   	pop    %edi
+  802fa6:	5d                   	pop    %ebp
+  802fa7:	c3                   	ret
+
+00802fa8 <devpipe_write>:
+{
+  802fa8:	55                   	push   %ebp
+  802fa9:	89 e5                	mov    %esp,%ebp
+  802fab:	57                   	push   %edi
+  802fac:	56                   	push   %esi
+  802fad:	53                   	push   %ebx
+  802fae:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802fb1:	ff 75 08             	push   0x8(%ebp)
+  802fb4:	e8 41 e1 ff ff       	call   8010fa <fd2data>
+  802fb9:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802fbb:	83 c4 10             	add    $0x10,%esp
+  802fbe:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  802fc5:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  802fc8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802fcb:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802fce:	0f 84 96 00 00 00    	je     80306a <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  802fd4:	8d 73 08             	lea    0x8(%ebx),%esi
+  802fd7:	eb 32                	jmp    80300b <devpipe_write+0x63>
+  802fd9:	89 fa                	mov    %edi,%edx
+  802fdb:	89 f0                	mov    %esi,%eax
+  802fdd:	e8 69 fe ff ff       	call   802e4b <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  802fe2:	8b 43 04             	mov    0x4(%ebx),%eax
+  802fe5:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  802fe8:	ba 01 00 00 00       	mov    $0x1,%edx
+  802fed:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  802ff2:	83 ec 04             	sub    $0x4,%esp
+  802ff5:	6a 0a                	push   $0xa
+  802ff7:	50                   	push   %eax
+  802ff8:	53                   	push   %ebx
+  802ff9:	e8 5f df ff ff       	call   800f5d <sys_futex_wait>
+  802ffe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803003:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  803008:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80300b:	8b 43 04             	mov    0x4(%ebx),%eax
+  80300e:	8b 0b                	mov    (%ebx),%ecx
+  803010:	8d 51 20             	lea    0x20(%ecx),%edx
+  803013:	39 d0                	cmp    %edx,%eax
+  803015:	72 1b                	jb     803032 <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  803017:	89 da                	mov    %ebx,%edx
+  803019:	8b 45 08             	mov    0x8(%ebp),%eax
+  80301c:	e8 9b fe ff ff       	call   802ebc <_pipeisclosed>
+  803021:	85 c0                	test   %eax,%eax
+  803023:	74 b4                	je     802fd9 <devpipe_write+0x31>
+				return 0;
+  803025:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80302a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80302d:	5b                   	pop    %ebx
+  80302e:	5e                   	pop    %esi
+  80302f:	5f                   	pop    %edi
+  803030:	5d                   	pop    %ebp
+  803031:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803032:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803035:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803038:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  80303c:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  80303f:	89 c2                	mov    %eax,%edx
+  803041:	c1 fa 1f             	sar    $0x1f,%edx
+  803044:	89 d1                	mov    %edx,%ecx
+  803046:	c1 e9 1b             	shr    $0x1b,%ecx
+  803049:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80304c:	83 e2 1f             	and    $0x1f,%edx
+  80304f:	29 ca                	sub    %ecx,%edx
+  803051:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  803055:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  803059:	83 c0 01             	add    $0x1,%eax
+  80305c:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  80305f:	83 c6 01             	add    $0x1,%esi
+  803062:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803065:	e9 5e ff ff ff       	jmp    802fc8 <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  80306a:	8d 53 04             	lea    0x4(%ebx),%edx
+  80306d:	8d 43 08             	lea    0x8(%ebx),%eax
+  803070:	e8 d6 fd ff ff       	call   802e4b <pipewake>
+	return i;
+  803075:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803078:	eb b0                	jmp    80302a <devpipe_write+0x82>
+
+0080307a <devpipe_read>:
+{
+  80307a:	55                   	push   %ebp
+  80307b:	89 e5                	mov    %esp,%ebp
+  80307d:	57                   	push   %edi
+  80307e:	56                   	push   %esi
+  80307f:	53                   	push   %ebx
+  803080:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  803083:	ff 75 08             	push   0x8(%ebp)
+  803086:	e8 6f e0 ff ff       	call   8010fa <fd2data>
+  80308b:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80308d:	83 c4 10             	add    $0x10,%esp
+  803090:	be 00 00 00 00       	mov    $0x0,%esi
+  803095:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803098:	74 6c                	je     803106 <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  80309a:	8d 7b 04             	lea    0x4(%ebx),%edi
+  80309d:	eb 25                	jmp    8030c4 <devpipe_read+0x4a>
+  80309f:	8b 13                	mov    (%ebx),%edx
+  8030a1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8030a6:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  8030ab:	83 ec 04             	sub    $0x4,%esp
+  8030ae:	6a 0a                	push   $0xa
+  8030b0:	52                   	push   %edx
+  8030b1:	57                   	push   %edi
+  8030b2:	e8 a6 de ff ff       	call   800f5d <sys_futex_wait>
+  8030b7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8030bc:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  8030c1:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  8030c4:	8b 03                	mov    (%ebx),%eax
+  8030c6:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8030c9:	75 19                	jne    8030e4 <devpipe_read+0x6a>
+			if (i > 0)
+  8030cb:	85 f6                	test   %esi,%esi
+  8030cd:	75 3a                	jne    803109 <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  8030cf:	89 da                	mov    %ebx,%edx
+  8030d1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030d4:	e8 e3 fd ff ff       	call   802ebc <_pipeisclosed>
+  8030d9:	85 c0                	test   %eax,%eax
+  8030db:	74 c2                	je     80309f <devpipe_read+0x25>
+				return 0;
+  8030dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030e2:	eb 31                	jmp    803115 <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8030e4:	89 c1                	mov    %eax,%ecx
+  8030e6:	c1 f9 1f             	sar    $0x1f,%ecx
+  8030e9:	c1 e9 1b             	shr    $0x1b,%ecx
+  8030ec:	01 c8                	add    %ecx,%eax
+  8030ee:	83 e0 1f             	and    $0x1f,%eax
+  8030f1:	29 c8                	sub    %ecx,%eax
+  8030f3:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  8030f8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8030fb:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8030fe:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  803101:	83 c6 01             	add    $0x1,%esi
+  803104:	eb 8f                	jmp    803095 <devpipe_read+0x1b>
+out:
+  803106:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  803109:	8d 43 0c             	lea    0xc(%ebx),%eax
+  80310c:	89 da                	mov    %ebx,%edx
+  80310e:	e8 38 fd ff ff       	call   802e4b <pipewake>
+	return i;
+  803113:	89 f0                	mov    %esi,%eax
+}
+  803115:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803118:	5b                   	pop    %ebx
+  803119:	5e                   	pop    %esi
+  80311a:	5f                   	pop    %edi
+  80311b:	5d                   	pop    %ebp
+  80311c:	c3                   	ret
+
+0080311d <pipe>:
+{
+  80311d:	55                   	push   %ebp
+  80311e:	89 e5                	mov    %esp,%ebp
+  803120:	56                   	push   %esi
+  803121:	53                   	push   %ebx
+  803122:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803125:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803128:	50                   	push   %eax
+  803129:	e8 e3 df ff ff       	call   801111 <fd_alloc>
+  80312e:	89 c3                	mov    %eax,%ebx
+  803130:	83 c4 10             	add    $0x10,%esp
+  803133:	85 c0                	test   %eax,%eax
+  803135:	0f 88 23 01 00 00    	js     80325e <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80313b:	83 ec 04             	sub    $0x4,%esp
+  80313e:	68 07 04 00 00       	push   $0x407
+  803143:	ff 75 f4             	push   -0xc(%ebp)
+  803146:	6a 00                	push   $0x0
+  803148:	e8 fb da ff ff       	call   800c48 <sys_page_alloc>
+  80314d:	89 c3                	mov    %eax,%ebx
+  80314f:	83 c4 10             	add    $0x10,%esp
+  803152:	85 c0                	test   %eax,%eax
+  803154:	0f 88 04 01 00 00    	js     80325e <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80315a:	83 ec 0c             	sub    $0xc,%esp
+  80315d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803160:	50                   	push   %eax
+  803161:	e8 ab df ff ff       	call   801111 <fd_alloc>
+  803166:	89 c3                	mov    %eax,%ebx
+  803168:	83 c4 10             	add    $0x10,%esp
+  80316b:	85 c0                	test   %eax,%eax
+  80316d:	0f 88 db 00 00 00    	js     80324e <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803173:	83 ec 04             	sub    $0x4,%esp
+  803176:	68 07 04 00 00       	push   $0x407
+  80317b:	ff 75 f0             	push   -0x10(%ebp)
+  80317e:	6a 00                	push   $0x0
+  803180:	e8 c3 da ff ff       	call   800c48 <sys_page_alloc>
+  803185:	89 c3                	mov    %eax,%ebx
+  803187:	83 c4 10             	add    $0x10,%esp
+  80318a:	85 c0                	test   %eax,%eax
+  80318c:	0f 88 bc 00 00 00    	js     80324e <pipe+0x131>
+	va = fd2data(fd0);
+  803192:	83 ec 0c             	sub    $0xc,%esp
+  803195:	ff 75 f4             	push   -0xc(%ebp)
+  803198:	e8 5d df ff ff       	call   8010fa <fd2data>
+  80319d:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80319f:	83 c4 0c             	add    $0xc,%esp
+  8031a2:	68 07 04 00 00       	push   $0x407
+  8031a7:	50                   	push   %eax
+  8031a8:	6a 00                	push   $0x0
+  8031aa:	e8 99 da ff ff       	call   800c48 <sys_page_alloc>
+  8031af:	89 c3                	mov    %eax,%ebx
+  8031b1:	83 c4 10             	add    $0x10,%esp
+  8031b4:	85 c0                	test   %eax,%eax
+  8031b6:	0f 88 82 00 00 00    	js     80323e <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8031bc:	83 ec 0c             	sub    $0xc,%esp
+  8031bf:	ff 75 f0             	push   -0x10(%ebp)
+  8031c2:	e8 33 df ff ff       	call   8010fa <fd2data>
+  8031c7:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8031ce:	50                   	push   %eax
+  8031cf:	6a 00                	push   $0x0
+  8031d1:	56                   	push   %esi
+  8031d2:	6a 00                	push   $0x0
+  8031d4:	e8 bc da ff ff       	call   800c95 <sys_page_map>
+  8031d9:	89 c3                	mov    %eax,%ebx
+  8031db:	83 c4 20             	add    $0x20,%esp
+  8031de:	85 c0                	test   %eax,%eax
+  8031e0:	78 4e                	js     803230 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8031e2:	a1 7c 52 80 00       	mov    0x80527c,%eax
+  8031e7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8031ea:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8031ec:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8031ef:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8031f6:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8031f9:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8031fb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8031fe:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803205:	83 ec 0c             	sub    $0xc,%esp
+  803208:	ff 75 f4             	push   -0xc(%ebp)
+  80320b:	e8 da de ff ff       	call   8010ea <fd2num>
+  803210:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803213:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803215:	83 c4 04             	add    $0x4,%esp
+  803218:	ff 75 f0             	push   -0x10(%ebp)
+  80321b:	e8 ca de ff ff       	call   8010ea <fd2num>
+  803220:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803223:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803226:	83 c4 10             	add    $0x10,%esp
+  803229:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80322e:	eb 2e                	jmp    80325e <pipe+0x141>
+	sys_page_unmap(0, va);
+  803230:	83 ec 08             	sub    $0x8,%esp
+  803233:	56                   	push   %esi
+  803234:	6a 00                	push   $0x0
+  803236:	e8 a6 da ff ff       	call   800ce1 <sys_page_unmap>
+  80323b:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80323e:	83 ec 08             	sub    $0x8,%esp
+  803241:	ff 75 f0             	push   -0x10(%ebp)
+  803244:	6a 00                	push   $0x0
+  803246:	e8 96 da ff ff       	call   800ce1 <sys_page_unmap>
+  80324b:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80324e:	83 ec 08             	sub    $0x8,%esp
+  803251:	ff 75 f4             	push   -0xc(%ebp)
+  803254:	6a 00                	push   $0x0
+  803256:	e8 86 da ff ff       	call   800ce1 <sys_page_unmap>
+  80325b:	83 c4 10             	add    $0x10,%esp
+}
+  80325e:	89 d8                	mov    %ebx,%eax
+  803260:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803263:	5b                   	pop    %ebx
+  803264:	5e                   	pop    %esi
+  803265:	5d                   	pop    %ebp
+  803266:	c3                   	ret
+
+00803267 <pipeisclosed>:
+{
+  803267:	55                   	push   %ebp
+  803268:	89 e5                	mov    %esp,%ebp
+  80326a:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80326d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803270:	50                   	push   %eax
+  803271:	ff 75 08             	push   0x8(%ebp)
+  803274:	e8 ee de ff ff       	call   801167 <fd_lookup>
+  803279:	83 c4 10             	add    $0x10,%esp
+  80327c:	85 c0                	test   %eax,%eax
+  80327e:	78 18                	js     803298 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803280:	83 ec 0c             	sub    $0xc,%esp
+  803283:	ff 75 f4             	push   -0xc(%ebp)
+  803286:	e8 6f de ff ff       	call   8010fa <fd2data>
+  80328b:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80328d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803290:	e8 27 fc ff ff       	call   802ebc <_pipeisclosed>
+  803295:	83 c4 10             	add    $0x10,%esp
+}
+  803298:	c9                   	leave
+  803299:	c3                   	ret
+
+0080329a <execv>:
+#include <inc/lib.h>
+
+int
+execv(const char *pathname, const char *argv[])
+{
+  80329a:	55                   	push   %ebp
+  80329b:	89 e5                	mov    %esp,%ebp
+  80329d:	53                   	push   %ebx
+  80329e:	83 ec 0c             	sub    $0xc,%esp
+    int r;
+    // close_all();
+    // // open fd 0 and 1 for the new program
+    // opencons();
+    // dup(0, 1);
+    r = sys_exec(pathname, argv);
+  8032a1:	ff 75 0c             	push   0xc(%ebp)
+  8032a4:	ff 75 08             	push   0x8(%ebp)
+  8032a7:	e8 dd db ff ff       	call   800e89 <sys_exec>
+    cprintf("exec failed, %e\n", r);
+  8032ac:	83 c4 08             	add    $0x8,%esp
+  8032af:	50                   	push   %eax
+  8032b0:	68 a6 4d 80 00       	push   $0x804da6
+  8032b5:	e8 6c cf ff ff       	call   800226 <cprintf>
+    // should never return
+    r = ipc_recv(NULL, NULL, NULL);
+  8032ba:	83 c4 0c             	add    $0xc,%esp
+  8032bd:	6a 00                	push   $0x0
+  8032bf:	6a 00                	push   $0x0
+  8032c1:	6a 00                	push   $0x0
+  8032c3:	e8 8f 10 00 00       	call   804357 <ipc_recv>
+  8032c8:	89 c3                	mov    %eax,%ebx
+    cprintf("exec failed, %e\n", r);
+  8032ca:	83 c4 08             	add    $0x8,%esp
+  8032cd:	50                   	push   %eax
+  8032ce:	68 a6 4d 80 00       	push   $0x804da6
+  8032d3:	e8 4e cf ff ff       	call   800226 <cprintf>
+    return r;
+}
+  8032d8:	89 d8                	mov    %ebx,%eax
+  8032da:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8032dd:	c9                   	leave
+  8032de:	c3                   	ret
+
+008032df <execl>:
+
+int
+execl(const char *pathname, const char *arg0, ...)
+{
+  8032df:	55                   	push   %ebp
+  8032e0:	89 e5                	mov    %esp,%ebp
+  8032e2:	56                   	push   %esi
+  8032e3:	53                   	push   %ebx
+	// The contract of the function guarantees that the last
+	// argument will always be NULL, and that none of the other
+	// arguments will be NULL.
+	int argc=0;
+	va_list vl;
+	va_start(vl, arg0);
+  8032e4:	8d 55 10             	lea    0x10(%ebp),%edx
+	int argc=0;
+  8032e7:	b8 00 00 00 00       	mov    $0x0,%eax
+	while(va_arg(vl, void *) != NULL)
+  8032ec:	eb 05                	jmp    8032f3 <execl+0x14>
+		argc++;
+  8032ee:	83 c0 01             	add    $0x1,%eax
+	while(va_arg(vl, void *) != NULL)
+  8032f1:	89 ca                	mov    %ecx,%edx
+  8032f3:	8d 4a 04             	lea    0x4(%edx),%ecx
+  8032f6:	83 3a 00             	cmpl   $0x0,(%edx)
+  8032f9:	75 f3                	jne    8032ee <execl+0xf>
+	va_end(vl);
+
+	// Now that we have the size of the args, do a second pass
+	// and store the values in a VLA, which has the format of argv
+	const char *argv[argc+2];
+  8032fb:	8d 14 85 17 00 00 00 	lea    0x17(,%eax,4),%edx
+  803302:	83 e2 f0             	and    $0xfffffff0,%edx
+  803305:	29 d4                	sub    %edx,%esp
+  803307:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  80330b:	89 da                	mov    %ebx,%edx
+  80330d:	c1 ea 02             	shr    $0x2,%edx
+  803310:	83 e3 fc             	and    $0xfffffffc,%ebx
+	argv[0] = arg0;
+  803313:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803316:	89 0c 95 00 00 00 00 	mov    %ecx,0x0(,%edx,4)
+	argv[argc+1] = NULL;
+  80331d:	c7 44 83 04 00 00 00 	movl   $0x0,0x4(%ebx,%eax,4)
+  803324:	00 
+
+	va_start(vl, arg0);
+  803325:	8d 4d 10             	lea    0x10(%ebp),%ecx
+	unsigned i;
+	for(i=0;i<argc;i++)
+  803328:	89 c2                	mov    %eax,%edx
+  80332a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80332f:	eb 0b                	jmp    80333c <execl+0x5d>
+		argv[i+1] = va_arg(vl, const char *);
+  803331:	83 c0 01             	add    $0x1,%eax
+  803334:	8b 31                	mov    (%ecx),%esi
+  803336:	89 34 83             	mov    %esi,(%ebx,%eax,4)
+  803339:	8d 49 04             	lea    0x4(%ecx),%ecx
+	for(i=0;i<argc;i++)
+  80333c:	39 d0                	cmp    %edx,%eax
+  80333e:	75 f1                	jne    803331 <execl+0x52>
+	va_end(vl);
+	return execv(pathname, argv);
+  803340:	83 ec 08             	sub    $0x8,%esp
+  803343:	53                   	push   %ebx
+  803344:	ff 75 08             	push   0x8(%ebp)
+  803347:	e8 4e ff ff ff       	call   80329a <execv>
+  80334c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80334f:	5b                   	pop    %ebx
+  803350:	5e                   	pop    %esi
+  803351:	5d                   	pop    %ebp
+  803352:	c3                   	ret
+
+00803353 <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  803353:	55                   	push   %ebp
+  803354:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  803356:	8b 45 08             	mov    0x8(%ebp),%eax
+  803359:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  80335f:	5d                   	pop    %ebp
+  803360:	c3                   	ret
+
+00803361 <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  803361:	55                   	push   %ebp
+  803362:	89 e5                	mov    %esp,%ebp
+  803364:	56                   	push   %esi
+  803365:	53                   	push   %ebx
+  803366:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803369:	ba 00 00 00 00       	mov    $0x0,%edx
+  80336e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803373:	89 d0                	mov    %edx,%eax
+  803375:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  803379:	85 c0                	test   %eax,%eax
+  80337b:	74 2d                	je     8033aa <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  80337d:	83 f8 02             	cmp    $0x2,%eax
+  803380:	74 08                	je     80338a <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  803382:	b8 02 00 00 00       	mov    $0x2,%eax
+  803387:	f0 87 03             	lock xchg %eax,(%ebx)
+  80338a:	be 02 00 00 00       	mov    $0x2,%esi
+  80338f:	eb 15                	jmp    8033a6 <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  803391:	83 ec 04             	sub    $0x4,%esp
+  803394:	6a 00                	push   $0x0
+  803396:	6a 02                	push   $0x2
+  803398:	53                   	push   %ebx
+  803399:	e8 bf db ff ff       	call   800f5d <sys_futex_wait>
+  80339e:	89 f0                	mov    %esi,%eax
+  8033a0:	f0 87 03             	lock xchg %eax,(%ebx)
+  8033a3:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  8033a6:	85 c0                	test   %eax,%eax
+  8033a8:	75 e7                	jne    803391 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  8033aa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8033ad:	5b                   	pop    %ebx
+  8033ae:	5e                   	pop    %esi
+  8033af:	5d                   	pop    %ebp
+  8033b0:	c3                   	ret
+
+008033b1 <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  8033b1:	55                   	push   %ebp
+  8033b2:	89 e5                	mov    %esp,%ebp
+  8033b4:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  8033b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033bc:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8033c1:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  8033c5:	f7 d8                	neg    %eax
+  8033c7:	19 c0                	sbb    %eax,%eax
+  8033c9:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  8033cc:	5d                   	pop    %ebp
+  8033cd:	c3                   	ret
+
+008033ce <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  8033ce:	55                   	push   %ebp
+  8033cf:	89 e5                	mov    %esp,%ebp
+  8033d1:	83 ec 08             	sub    $0x8,%esp
+  8033d4:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  8033d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033dc:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  8033df:	83 f8 02             	cmp    $0x2,%eax
+  8033e2:	74 02                	je     8033e6 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  8033e4:	c9                   	leave
+  8033e5:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  8033e6:	83 ec 08             	sub    $0x8,%esp
+  8033e9:	6a 01                	push   $0x1
+  8033eb:	52                   	push   %edx
+  8033ec:	e8 9b db ff ff       	call   800f8c <sys_futex_wake>
+  8033f1:	83 c4 10             	add    $0x10,%esp
+}
+  8033f4:	eb ee                	jmp    8033e4 <mutex_unlock+0x16>
+
+008033f6 <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  8033f6:	55                   	push   %ebp
+  8033f7:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  8033f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033fc:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803402:	5d                   	pop    %ebp
+  803403:	c3                   	ret
+
+00803404 <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  803404:	55                   	push   %ebp
+  803405:	89 e5                	mov    %esp,%ebp
+  803407:	57                   	push   %edi
+  803408:	56                   	push   %esi
+  803409:	53                   	push   %ebx
+  80340a:	83 ec 18             	sub    $0x18,%esp
+  80340d:	8b 75 08             	mov    0x8(%ebp),%esi
+  803410:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  803413:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  803415:	53                   	push   %ebx
+  803416:	e8 b3 ff ff ff       	call   8033ce <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  80341b:	83 c4 0c             	add    $0xc,%esp
+  80341e:	ff 75 10             	push   0x10(%ebp)
+  803421:	57                   	push   %edi
+  803422:	56                   	push   %esi
+  803423:	e8 35 db ff ff       	call   800f5d <sys_futex_wait>
+  803428:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  80342a:	83 c4 10             	add    $0x10,%esp
+  80342d:	be 02 00 00 00       	mov    $0x2,%esi
+  803432:	eb 10                	jmp    803444 <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  803434:	83 ec 04             	sub    $0x4,%esp
+  803437:	6a 00                	push   $0x0
+  803439:	6a 02                	push   $0x2
+  80343b:	53                   	push   %ebx
+  80343c:	e8 1c db ff ff       	call   800f5d <sys_futex_wait>
+  803441:	83 c4 10             	add    $0x10,%esp
+  803444:	89 f0                	mov    %esi,%eax
+  803446:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  803449:	85 c0                	test   %eax,%eax
+  80344b:	75 e7                	jne    803434 <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  80344d:	83 ff ec             	cmp    $0xffffffec,%edi
+  803450:	74 05                	je     803457 <cond_timedwait+0x53>
+  803452:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803457:	89 f8                	mov    %edi,%eax
+  803459:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80345c:	5b                   	pop    %ebx
+  80345d:	5e                   	pop    %esi
+  80345e:	5f                   	pop    %edi
+  80345f:	5d                   	pop    %ebp
+  803460:	c3                   	ret
+
+00803461 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  803461:	55                   	push   %ebp
+  803462:	89 e5                	mov    %esp,%ebp
+  803464:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  803467:	6a 00                	push   $0x0
+  803469:	ff 75 0c             	push   0xc(%ebp)
+  80346c:	ff 75 08             	push   0x8(%ebp)
+  80346f:	e8 90 ff ff ff       	call   803404 <cond_timedwait>
+}
+  803474:	83 c4 10             	add    $0x10,%esp
+  803477:	c9                   	leave
+  803478:	c3                   	ret
+
+00803479 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  803479:	55                   	push   %ebp
+  80347a:	89 e5                	mov    %esp,%ebp
+  80347c:	83 ec 10             	sub    $0x10,%esp
+  80347f:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  803482:	ba 01 00 00 00       	mov    $0x1,%edx
+  803487:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  80348b:	6a 01                	push   $0x1
+  80348d:	50                   	push   %eax
+  80348e:	e8 f9 da ff ff       	call   800f8c <sys_futex_wake>
+}
+  803493:	83 c4 10             	add    $0x10,%esp
+  803496:	c9                   	leave
+  803497:	c3                   	ret
+
+00803498 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  803498:	55                   	push   %ebp
+  803499:	89 e5                	mov    %esp,%ebp
+  80349b:	83 ec 10             	sub    $0x10,%esp
+  80349e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034a1:	ba 01 00 00 00       	mov    $0x1,%edx
+  8034a6:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  8034aa:	68 00 04 00 00       	push   $0x400
+  8034af:	50                   	push   %eax
+  8034b0:	e8 d7 da ff ff       	call   800f8c <sys_futex_wake>
+}
+  8034b5:	83 c4 10             	add    $0x10,%esp
+  8034b8:	c9                   	leave
+  8034b9:	c3                   	ret
+
+008034ba <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  8034ba:	55                   	push   %ebp
+  8034bb:	89 e5                	mov    %esp,%ebp
+  8034bd:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  8034c0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8034c3:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  8034c5:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  8034cc:	5d                   	pop    %ebp
+  8034cd:	c3                   	ret
+
+008034ce <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  8034ce:	55                   	push   %ebp
+  8034cf:	89 e5                	mov    %esp,%ebp
+  8034d1:	53                   	push   %ebx
+  8034d2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  8034d5:	8b 11                	mov    (%ecx),%edx
+  8034d7:	85 d2                	test   %edx,%edx
+  8034d9:	74 14                	je     8034ef <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  8034db:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  8034de:	89 d0                	mov    %edx,%eax
+  8034e0:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  8034e4:	39 c2                	cmp    %eax,%edx
+  8034e6:	75 ed                	jne    8034d5 <sem_trywait+0x7>
+			return 0;
+  8034e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034ed:	eb 05                	jmp    8034f4 <sem_trywait+0x26>
+	return -E_AGAIN;
+  8034ef:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  8034f4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8034f7:	c9                   	leave
+  8034f8:	c3                   	ret
+
+008034f9 <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  8034f9:	55                   	push   %ebp
+  8034fa:	89 e5                	mov    %esp,%ebp
+  8034fc:	57                   	push   %edi
+  8034fd:	56                   	push   %esi
+  8034fe:	53                   	push   %ebx
+  8034ff:	83 ec 1c             	sub    $0x1c,%esp
+  803502:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803505:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  803508:	e8 c8 d9 ff ff       	call   800ed5 <sys_time_msec>
+  80350d:	01 f8                	add    %edi,%eax
+  80350f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  803512:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  803517:	eb 28                	jmp    803541 <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  803519:	b8 01 00 00 00       	mov    $0x1,%eax
+  80351e:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  803523:	83 ec 04             	sub    $0x4,%esp
+  803526:	56                   	push   %esi
+  803527:	6a 00                	push   $0x0
+  803529:	53                   	push   %ebx
+  80352a:	e8 2e da ff ff       	call   800f5d <sys_futex_wait>
+  80352f:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  803534:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  803539:	83 c4 10             	add    $0x10,%esp
+  80353c:	83 f8 ec             	cmp    $0xffffffec,%eax
+  80353f:	74 2e                	je     80356f <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  803541:	83 ec 0c             	sub    $0xc,%esp
+  803544:	53                   	push   %ebx
+  803545:	e8 84 ff ff ff       	call   8034ce <sem_trywait>
+  80354a:	83 c4 10             	add    $0x10,%esp
+  80354d:	85 c0                	test   %eax,%eax
+  80354f:	79 19                	jns    80356a <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  803551:	85 ff                	test   %edi,%edi
+  803553:	74 c4                	je     803519 <sem_timedwait+0x20>
+  803555:	e8 7b d9 ff ff       	call   800ed5 <sys_time_msec>
+  80355a:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80355d:	29 c6                	sub    %eax,%esi
+  80355f:	85 f6                	test   %esi,%esi
+  803561:	7f b6                	jg     803519 <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  803563:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  803568:	eb 05                	jmp    80356f <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  80356a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80356f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803572:	5b                   	pop    %ebx
+  803573:	5e                   	pop    %esi
+  803574:	5f                   	pop    %edi
+  803575:	5d                   	pop    %ebp
+  803576:	c3                   	ret
+
+00803577 <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  803577:	55                   	push   %ebp
+  803578:	89 e5                	mov    %esp,%ebp
+  80357a:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  80357d:	6a 00                	push   $0x0
+  80357f:	ff 75 08             	push   0x8(%ebp)
+  803582:	e8 72 ff ff ff       	call   8034f9 <sem_timedwait>
+}
+  803587:	83 c4 10             	add    $0x10,%esp
+  80358a:	c9                   	leave
+  80358b:	c3                   	ret
+
+0080358c <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  80358c:	55                   	push   %ebp
+  80358d:	89 e5                	mov    %esp,%ebp
+  80358f:	83 ec 08             	sub    $0x8,%esp
+  803592:	8b 45 08             	mov    0x8(%ebp),%eax
+  803595:	ba 01 00 00 00       	mov    $0x1,%edx
+  80359a:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  80359e:	8b 50 04             	mov    0x4(%eax),%edx
+  8035a1:	85 d2                	test   %edx,%edx
+  8035a3:	75 02                	jne    8035a7 <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  8035a5:	c9                   	leave
+  8035a6:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  8035a7:	83 ec 08             	sub    $0x8,%esp
+  8035aa:	6a 01                	push   $0x1
+  8035ac:	50                   	push   %eax
+  8035ad:	e8 da d9 ff ff       	call   800f8c <sys_futex_wake>
+  8035b2:	83 c4 10             	add    $0x10,%esp
+}
+  8035b5:	eb ee                	jmp    8035a5 <sem_post+0x19>
+
+008035b7 <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  8035b7:	55                   	push   %ebp
+  8035b8:	89 e5                	mov    %esp,%ebp
+  8035ba:	57                   	push   %edi
+  8035bb:	56                   	push   %esi
+  8035bc:	53                   	push   %ebx
+  8035bd:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  8035c0:	68 20 60 80 00       	push   $0x806020
+  8035c5:	e8 97 fd ff ff       	call   803361 <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  8035ca:	a1 44 60 80 00       	mov    0x806044,%eax
+  8035cf:	83 c4 10             	add    $0x10,%esp
+  8035d2:	85 c0                	test   %eax,%eax
+  8035d4:	75 19                	jne    8035ef <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  8035d6:	a1 c0 62 80 00       	mov    0x8062c0,%eax
+  8035db:	8b 00                	mov    (%eax),%eax
+  8035dd:	8b 40 48             	mov    0x48(%eax),%eax
+  8035e0:	a3 40 60 80 00       	mov    %eax,0x806040
+		threads[0].th_state = PTH_RUNNING;
+  8035e5:	c7 05 44 60 80 00 01 	movl   $0x1,0x806044
+  8035ec:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  8035ef:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  8035f4:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8035f7:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  8035fe:	8b 40 04             	mov    0x4(%eax),%eax
+  803601:	85 c0                	test   %eax,%eax
+  803603:	0f 84 e4 00 00 00    	je     8036ed <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803609:	83 c3 01             	add    $0x1,%ebx
+  80360c:	83 fb 20             	cmp    $0x20,%ebx
+  80360f:	75 e3                	jne    8035f4 <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  803611:	83 ec 0c             	sub    $0xc,%esp
+  803614:	68 20 60 80 00       	push   $0x806020
+  803619:	e8 b0 fd ff ff       	call   8033ce <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  80361e:	83 c4 10             	add    $0x10,%esp
+  803621:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  803626:	e9 b8 00 00 00       	jmp    8036e3 <pthread_create+0x12c>
+  80362b:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  80362e:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  803631:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  803633:	39 f3                	cmp    %esi,%ebx
+  803635:	73 16                	jae    80364d <pthread_create+0x96>
+		va -= PGSIZE;
+  803637:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  80363d:	83 ec 08             	sub    $0x8,%esp
+  803640:	56                   	push   %esi
+  803641:	6a 00                	push   $0x0
+  803643:	e8 99 d6 ff ff       	call   800ce1 <sys_page_unmap>
+  803648:	83 c4 10             	add    $0x10,%esp
+  80364b:	eb e6                	jmp    803633 <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  80364d:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803650:	83 ec 08             	sub    $0x8,%esp
+  803653:	ff 75 e4             	push   -0x1c(%ebp)
+  803656:	6a 00                	push   $0x0
+  803658:	e8 84 d6 ff ff       	call   800ce1 <sys_page_unmap>
+	return r;
+  80365d:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  803660:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803663:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  80366a:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  803671:	eb 70                	jmp    8036e3 <pthread_create+0x12c>
+	th->th_fn = fn;
+  803673:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803676:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  80367d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803680:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  803683:	8b 55 10             	mov    0x10(%ebp),%edx
+  803686:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  803689:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  803690:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  803695:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803698:	29 c8                	sub    %ecx,%eax
+  80369a:	85 db                	test   %ebx,%ebx
+  80369c:	0f 44 05 c0 62 80 00 	cmove  0x8062c0,%eax
+	*--esp = t;
+  8036a3:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  8036a6:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  8036ad:	83 ec 04             	sub    $0x4,%esp
+  8036b0:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  8036b5:	29 ca                	sub    %ecx,%edx
+  8036b7:	52                   	push   %edx
+	*--esp = 0;
+  8036b8:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  8036bb:	50                   	push   %eax
+  8036bc:	68 14 39 80 00       	push   $0x803914
+  8036c1:	e8 6b d9 ff ff       	call   801031 <sys_thread_create>
+  8036c6:	89 c7                	mov    %eax,%edi
+  8036c8:	83 c4 10             	add    $0x10,%esp
+  8036cb:	85 c0                	test   %eax,%eax
+  8036cd:	78 91                	js     803660 <pthread_create+0xa9>
+	th->th_env = id;
+  8036cf:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8036d2:	89 3c 85 40 60 80 00 	mov    %edi,0x806040(,%eax,4)
+	*tp = t;
+  8036d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036dc:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  8036de:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  8036e3:	89 f8                	mov    %edi,%eax
+  8036e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036e8:	5b                   	pop    %ebx
+  8036e9:	5e                   	pop    %esi
+  8036ea:	5f                   	pop    %edi
+  8036eb:	5d                   	pop    %ebp
+  8036ec:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  8036ed:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8036f0:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  8036f7:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  8036fe:	83 ec 0c             	sub    $0xc,%esp
+  803701:	68 20 60 80 00       	push   $0x806020
+  803706:	e8 c3 fc ff ff       	call   8033ce <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  80370b:	89 d9                	mov    %ebx,%ecx
+  80370d:	c1 e1 10             	shl    $0x10,%ecx
+  803710:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  803713:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  803718:	29 c8                	sub    %ecx,%eax
+  80371a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  80371d:	c1 e8 16             	shr    $0x16,%eax
+  803720:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803727:	83 c4 10             	add    $0x10,%esp
+  80372a:	a8 01                	test   $0x1,%al
+  80372c:	74 15                	je     803743 <pthread_create+0x18c>
+  80372e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803731:	c1 e8 0c             	shr    $0xc,%eax
+  803734:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80373b:	a8 01                	test   $0x1,%al
+  80373d:	0f 85 30 ff ff ff    	jne    803673 <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803743:	83 ec 04             	sub    $0x4,%esp
+  803746:	6a 07                	push   $0x7
+  803748:	ff 75 e4             	push   -0x1c(%ebp)
+  80374b:	6a 00                	push   $0x0
+  80374d:	e8 f6 d4 ff ff       	call   800c48 <sys_page_alloc>
+  803752:	89 c7                	mov    %eax,%edi
+  803754:	83 c4 10             	add    $0x10,%esp
+  803757:	85 c0                	test   %eax,%eax
+  803759:	0f 88 01 ff ff ff    	js     803660 <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  80375f:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  803764:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  803767:	29 d0                	sub    %edx,%eax
+  803769:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80376c:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  80376e:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  803773:	29 d0                	sub    %edx,%eax
+  803775:	89 c7                	mov    %eax,%edi
+  803777:	39 fe                	cmp    %edi,%esi
+  803779:	0f 83 f4 fe ff ff    	jae    803673 <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  80377f:	83 ec 04             	sub    $0x4,%esp
+  803782:	6a 07                	push   $0x7
+  803784:	56                   	push   %esi
+  803785:	6a 00                	push   $0x0
+  803787:	e8 bc d4 ff ff       	call   800c48 <sys_page_alloc>
+  80378c:	83 c4 10             	add    $0x10,%esp
+  80378f:	85 c0                	test   %eax,%eax
+  803791:	0f 88 94 fe ff ff    	js     80362b <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803797:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80379d:	eb d8                	jmp    803777 <pthread_create+0x1c0>
+
+0080379f <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  80379f:	55                   	push   %ebp
+  8037a0:	89 e5                	mov    %esp,%ebp
+  8037a2:	57                   	push   %edi
+  8037a3:	56                   	push   %esi
+  8037a4:	53                   	push   %ebx
+  8037a5:	83 ec 0c             	sub    $0xc,%esp
+  8037a8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  8037ab:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  8037ae:	83 f8 1e             	cmp    $0x1e,%eax
+  8037b1:	0f 87 c7 00 00 00    	ja     80387e <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  8037b7:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8037b9:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8037bf:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8037c4:	77 12                	ja     8037d8 <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8037c6:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8037cb:	29 d0                	sub    %edx,%eax
+  8037cd:	c1 e8 10             	shr    $0x10,%eax
+  8037d0:	39 c3                	cmp    %eax,%ebx
+  8037d2:	0f 84 ad 00 00 00    	je     803885 <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  8037d8:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8037db:	8d 3c 85 44 60 80 00 	lea    0x806044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  8037e2:	8d 34 85 40 60 80 00 	lea    0x806040(,%eax,4),%esi
+  8037e9:	eb 10                	jmp    8037fb <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  8037eb:	83 ec 04             	sub    $0x4,%esp
+  8037ee:	6a 00                	push   $0x0
+  8037f0:	6a 01                	push   $0x1
+  8037f2:	57                   	push   %edi
+  8037f3:	e8 65 d7 ff ff       	call   800f5d <sys_futex_wait>
+  8037f8:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  8037fb:	8b 46 04             	mov    0x4(%esi),%eax
+  8037fe:	83 f8 01             	cmp    $0x1,%eax
+  803801:	74 e8                	je     8037eb <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  803803:	83 f8 02             	cmp    $0x2,%eax
+  803806:	0f 85 80 00 00 00    	jne    80388c <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  80380c:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  80380f:	c1 e6 02             	shl    $0x2,%esi
+  803812:	eb 05                	jmp    803819 <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  803814:	e8 03 d4 ff ff       	call   800c1c <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  803819:	8b 8e 40 60 80 00    	mov    0x806040(%esi),%ecx
+  80381f:	89 ca                	mov    %ecx,%edx
+  803821:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  803827:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80382a:	c1 e0 04             	shl    $0x4,%eax
+  80382d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803832:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  803835:	39 c1                	cmp    %eax,%ecx
+  803837:	75 12                	jne    80384b <pthread_join+0xac>
+  803839:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80383c:	c1 e0 04             	shl    $0x4,%eax
+  80383f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803844:	8b 40 54             	mov    0x54(%eax),%eax
+  803847:	85 c0                	test   %eax,%eax
+  803849:	75 c9                	jne    803814 <pthread_join+0x75>
+	if (ret_store)
+  80384b:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80384f:	74 0f                	je     803860 <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  803851:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803854:	8b 04 85 50 60 80 00 	mov    0x806050(,%eax,4),%eax
+  80385b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80385e:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  803860:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803863:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  80386a:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  803871:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803876:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803879:	5b                   	pop    %ebx
+  80387a:	5e                   	pop    %esi
+  80387b:	5f                   	pop    %edi
+  80387c:	5d                   	pop    %ebp
+  80387d:	c3                   	ret
+		return -E_INVAL;
+  80387e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803883:	eb f1                	jmp    803876 <pthread_join+0xd7>
+  803885:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80388a:	eb ea                	jmp    803876 <pthread_join+0xd7>
+		return -E_INVAL;
+  80388c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803891:	eb e3                	jmp    803876 <pthread_join+0xd7>
+
+00803893 <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  803893:	55                   	push   %ebp
+  803894:	89 e5                	mov    %esp,%ebp
+  803896:	53                   	push   %ebx
+  803897:	83 ec 04             	sub    $0x4,%esp
+  80389a:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80389c:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8038a2:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8038a7:	77 0c                	ja     8038b5 <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8038a9:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8038ae:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  8038b0:	c1 e8 10             	shr    $0x10,%eax
+  8038b3:	75 0a                	jne    8038bf <pthread_exit+0x2c>
+		exit();
+  8038b5:	e8 69 c8 ff ff       	call   800123 <exit>
+  8038ba:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  8038bf:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  8038c6:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  8038c9:	8d 0c 8d 40 60 80 00 	lea    0x806040(,%ecx,4),%ecx
+  8038d0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8038d3:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  8038d6:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  8038dd:	83 ec 08             	sub    $0x8,%esp
+  8038e0:	6a 20                	push   $0x20
+  8038e2:	01 c2                	add    %eax,%edx
+  8038e4:	8d 04 95 44 60 80 00 	lea    0x806044(,%edx,4),%eax
+  8038eb:	50                   	push   %eax
+  8038ec:	e8 9b d6 ff ff       	call   800f8c <sys_futex_wake>
+	sys_env_destroy(0);
+  8038f1:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8038f8:	e8 a8 d2 ff ff       	call   800ba5 <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  8038fd:	83 c4 0c             	add    $0xc,%esp
+  803900:	68 b7 4d 80 00       	push   $0x804db7
+  803905:	68 a5 00 00 00       	push   $0xa5
+  80390a:	68 d1 4d 80 00       	push   $0x804dd1
+  80390f:	e8 37 c8 ff ff       	call   80014b <_panic>
+
+00803914 <pthread_start>:
+{
+  803914:	55                   	push   %ebp
+  803915:	89 e5                	mov    %esp,%ebp
+  803917:	53                   	push   %ebx
+  803918:	83 ec 04             	sub    $0x4,%esp
+  80391b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  80391e:	e8 cd d2 ff ff       	call   800bf0 <sys_getenvid>
+  803923:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  803928:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	if (t == 0)
+  80392e:	85 db                	test   %ebx,%ebx
+  803930:	74 0c                	je     80393e <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803932:	89 d9                	mov    %ebx,%ecx
+  803934:	c1 e1 10             	shl    $0x10,%ecx
+  803937:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80393c:	29 ca                	sub    %ecx,%edx
+  80393e:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  803941:	c1 e0 04             	shl    $0x4,%eax
+  803944:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803949:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  80394b:	83 ec 0c             	sub    $0xc,%esp
+  80394e:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803955:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803958:	ff 34 95 4c 60 80 00 	push   0x80604c(,%edx,4)
+  80395f:	ff 14 95 48 60 80 00 	call   *0x806048(,%edx,4)
+  803966:	89 04 24             	mov    %eax,(%esp)
+  803969:	e8 25 ff ff ff       	call   803893 <pthread_exit>
+
+0080396e <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  80396e:	55                   	push   %ebp
+  80396f:	89 e5                	mov    %esp,%ebp
+  803971:	57                   	push   %edi
+  803972:	56                   	push   %esi
+  803973:	53                   	push   %ebx
+  803974:	83 ec 1c             	sub    $0x1c,%esp
+  803977:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803979:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  80397f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803986:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80398b:	77 0d                	ja     80399a <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80398d:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803992:	29 d0                	sub    %edx,%eax
+  803994:	c1 e8 10             	shr    $0x10,%eax
+  803997:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  80399a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80399f:	eb 2f                	jmp    8039d0 <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  8039a1:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  8039a7:	8b 01                	mov    (%ecx),%eax
+  8039a9:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  8039ac:	39 c2                	cmp    %eax,%edx
+  8039ae:	75 14                	jne    8039c4 <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  8039b0:	83 ec 0c             	sub    $0xc,%esp
+  8039b3:	57                   	push   %edi
+  8039b4:	e8 ec d1 ff ff       	call   800ba5 <sys_env_destroy>
+  8039b9:	83 c4 10             	add    $0x10,%esp
+  8039bc:	85 c0                	test   %eax,%eax
+  8039be:	0f 88 97 00 00 00    	js     803a5b <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  8039c4:	83 c3 01             	add    $0x1,%ebx
+  8039c7:	83 fb 20             	cmp    $0x20,%ebx
+  8039ca:	0f 84 d2 00 00 00    	je     803aa2 <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  8039d0:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  8039d3:	74 ef                	je     8039c4 <pthread_kill_others+0x56>
+  8039d5:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8039d8:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  8039df:	8b 40 04             	mov    0x4(%eax),%eax
+  8039e2:	83 f8 01             	cmp    $0x1,%eax
+  8039e5:	75 dd                	jne    8039c4 <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  8039e7:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8039ea:	8b 3c 85 40 60 80 00 	mov    0x806040(,%eax,4),%edi
+  8039f1:	89 fe                	mov    %edi,%esi
+  8039f3:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  8039f9:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  8039fc:	c1 e0 04             	shl    $0x4,%eax
+  8039ff:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803a04:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803a07:	39 c7                	cmp    %eax,%edi
+  803a09:	75 b9                	jne    8039c4 <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  803a0b:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803a0e:	c1 e0 04             	shl    $0x4,%eax
+  803a11:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803a16:	8b 40 54             	mov    0x54(%eax),%eax
+  803a19:	85 c0                	test   %eax,%eax
+  803a1b:	74 a7                	je     8039c4 <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803a1d:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803a20:	c1 e0 04             	shl    $0x4,%eax
+  803a23:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  803a29:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803a2b:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  803a31:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803a36:	0f 87 65 ff ff ff    	ja     8039a1 <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803a3c:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803a41:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  803a43:	c1 e8 10             	shr    $0x10,%eax
+  803a46:	0f 84 55 ff ff ff    	je     8039a1 <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803a4c:	c1 e0 10             	shl    $0x10,%eax
+  803a4f:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  803a54:	29 c1                	sub    %eax,%ecx
+  803a56:	e9 4c ff ff ff       	jmp    8039a7 <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  803a5b:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  803a5e:	c1 e2 04             	shl    $0x4,%edx
+  803a61:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803a67:	8b 52 48             	mov    0x48(%edx),%edx
+  803a6a:	39 fa                	cmp    %edi,%edx
+  803a6c:	0f 85 52 ff ff ff    	jne    8039c4 <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  803a72:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  803a75:	c1 e2 04             	shl    $0x4,%edx
+  803a78:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803a7e:	8b 52 54             	mov    0x54(%edx),%edx
+  803a81:	85 d2                	test   %edx,%edx
+  803a83:	0f 84 3b ff ff ff    	je     8039c4 <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  803a89:	83 ec 0c             	sub    $0xc,%esp
+  803a8c:	50                   	push   %eax
+  803a8d:	57                   	push   %edi
+  803a8e:	68 e0 4d 80 00       	push   $0x804de0
+  803a93:	68 bb 00 00 00       	push   $0xbb
+  803a98:	68 d1 4d 80 00       	push   $0x804dd1
+  803a9d:	e8 a9 c6 ff ff       	call   80014b <_panic>
+	}
+}
+  803aa2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803aa5:	5b                   	pop    %ebx
+  803aa6:	5e                   	pop    %esi
+  803aa7:	5f                   	pop    %edi
+  803aa8:	5d                   	pop    %ebp
+  803aa9:	c3                   	ret
+
+00803aaa <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  803aaa:	55                   	push   %ebp
+  803aab:	89 e5                	mov    %esp,%ebp
+  803aad:	53                   	push   %ebx
+  803aae:	83 ec 04             	sub    $0x4,%esp
+  803ab1:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803ab3:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  803ab9:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803abf:	0f 87 85 00 00 00    	ja     803b4a <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803ac5:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  803aca:	29 c3                	sub    %eax,%ebx
+  803acc:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  803acf:	83 ec 04             	sub    $0x4,%esp
+  803ad2:	68 80 02 00 00       	push   $0x280
+  803ad7:	6a 00                	push   $0x0
+  803ad9:	68 40 60 80 00       	push   $0x806040
+  803ade:	e8 78 ce ff ff       	call   80095b <memset>
+	threads_mu.m_state = 0;
+  803ae3:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  803aea:	00 00 00 
+	if (self != 0) {
+  803aed:	83 c4 10             	add    $0x10,%esp
+  803af0:	85 db                	test   %ebx,%ebx
+  803af2:	74 51                	je     803b45 <pthread_fork_child+0x9b>
+  803af4:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803af6:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803afc:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803b01:	77 18                	ja     803b1b <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803b03:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803b08:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803b0a:	c1 e8 10             	shr    $0x10,%eax
+  803b0d:	74 0c                	je     803b1b <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803b0f:	c1 e0 10             	shl    $0x10,%eax
+  803b12:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803b17:	29 c2                	sub    %eax,%edx
+  803b19:	eb 06                	jmp    803b21 <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  803b1b:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		threads[self].th_env = thisenv->env_id;
+  803b21:	8b 02                	mov    (%edx),%eax
+  803b23:	8b 48 48             	mov    0x48(%eax),%ecx
+  803b26:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803b2d:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803b30:	89 0c 95 40 60 80 00 	mov    %ecx,0x806040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  803b37:	8d 04 95 40 60 80 00 	lea    0x806040(,%edx,4),%eax
+  803b3e:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  803b45:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803b48:	c9                   	leave
+  803b49:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  803b4a:	83 ec 04             	sub    $0x4,%esp
+  803b4d:	68 80 02 00 00       	push   $0x280
+  803b52:	6a 00                	push   $0x0
+  803b54:	68 40 60 80 00       	push   $0x806040
+  803b59:	e8 fd cd ff ff       	call   80095b <memset>
+	threads_mu.m_state = 0;
+  803b5e:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  803b65:	00 00 00 
+  803b68:	83 c4 10             	add    $0x10,%esp
+  803b6b:	eb d8                	jmp    803b45 <pthread_fork_child+0x9b>
+
+00803b6d <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803b6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b72:	c3                   	ret
+
+00803b73 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803b73:	55                   	push   %ebp
+  803b74:	89 e5                	mov    %esp,%ebp
+  803b76:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803b79:	68 05 4e 80 00       	push   $0x804e05
+  803b7e:	ff 75 0c             	push   0xc(%ebp)
+  803b81:	e8 84 cc ff ff       	call   80080a <strcpy>
+	return 0;
+}
+  803b86:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b8b:	c9                   	leave
+  803b8c:	c3                   	ret
+
+00803b8d <devcons_write>:
+{
+  803b8d:	55                   	push   %ebp
+  803b8e:	89 e5                	mov    %esp,%ebp
+  803b90:	57                   	push   %edi
+  803b91:	56                   	push   %esi
+  803b92:	53                   	push   %ebx
+  803b93:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803b99:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803b9e:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803ba4:	eb 2e                	jmp    803bd4 <devcons_write+0x47>
+		m = n - tot;
+  803ba6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803ba9:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803bab:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803bb0:	39 c3                	cmp    %eax,%ebx
+  803bb2:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803bb5:	83 ec 04             	sub    $0x4,%esp
+  803bb8:	53                   	push   %ebx
+  803bb9:	89 f0                	mov    %esi,%eax
+  803bbb:	03 45 0c             	add    0xc(%ebp),%eax
+  803bbe:	50                   	push   %eax
+  803bbf:	57                   	push   %edi
+  803bc0:	e8 cb cd ff ff       	call   800990 <memmove>
+		sys_cputs(buf, m);
+  803bc5:	83 c4 08             	add    $0x8,%esp
+  803bc8:	53                   	push   %ebx
+  803bc9:	57                   	push   %edi
+  803bca:	e8 7f cf ff ff       	call   800b4e <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803bcf:	01 de                	add    %ebx,%esi
+  803bd1:	83 c4 10             	add    $0x10,%esp
+  803bd4:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803bd7:	72 cd                	jb     803ba6 <devcons_write+0x19>
+}
+  803bd9:	89 f0                	mov    %esi,%eax
+  803bdb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803bde:	5b                   	pop    %ebx
+  803bdf:	5e                   	pop    %esi
+  803be0:	5f                   	pop    %edi
+  803be1:	5d                   	pop    %ebp
+  803be2:	c3                   	ret
+
+00803be3 <devcons_read>:
+{
+  803be3:	55                   	push   %ebp
+  803be4:	89 e5                	mov    %esp,%ebp
+  803be6:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  803be9:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bee:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803bf2:	75 07                	jne    803bfb <devcons_read+0x18>
+  803bf4:	eb 1f                	jmp    803c15 <devcons_read+0x32>
+		sys_yield();
+  803bf6:	e8 21 d0 ff ff       	call   800c1c <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  803bfb:	e8 79 cf ff ff       	call   800b79 <sys_cgetc>
+  803c00:	85 c0                	test   %eax,%eax
+  803c02:	74 f2                	je     803bf6 <devcons_read+0x13>
+	if (c < 0)
+  803c04:	78 0f                	js     803c15 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  803c06:	83 f8 04             	cmp    $0x4,%eax
+  803c09:	74 0c                	je     803c17 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  803c0b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803c0e:	88 02                	mov    %al,(%edx)
+	return 1;
+  803c10:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803c15:	c9                   	leave
+  803c16:	c3                   	ret
+		return 0;
+  803c17:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c1c:	eb f7                	jmp    803c15 <devcons_read+0x32>
+
+00803c1e <cputchar>:
+{
+  803c1e:	55                   	push   %ebp
+  803c1f:	89 e5                	mov    %esp,%ebp
+  803c21:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803c24:	8b 45 08             	mov    0x8(%ebp),%eax
+  803c27:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803c2a:	6a 01                	push   $0x1
+  803c2c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803c2f:	50                   	push   %eax
+  803c30:	e8 19 cf ff ff       	call   800b4e <sys_cputs>
+}
+  803c35:	83 c4 10             	add    $0x10,%esp
+  803c38:	c9                   	leave
+  803c39:	c3                   	ret
+
+00803c3a <getchar>:
+{
+  803c3a:	55                   	push   %ebp
+  803c3b:	89 e5                	mov    %esp,%ebp
+  803c3d:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803c40:	6a 01                	push   $0x1
+  803c42:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803c45:	50                   	push   %eax
+  803c46:	6a 00                	push   $0x0
+  803c48:	e8 aa d7 ff ff       	call   8013f7 <read>
+	if (r < 0)
+  803c4d:	83 c4 10             	add    $0x10,%esp
+  803c50:	85 c0                	test   %eax,%eax
+  803c52:	78 06                	js     803c5a <getchar+0x20>
+	if (r < 1)
+  803c54:	74 06                	je     803c5c <getchar+0x22>
+	return c;
+  803c56:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803c5a:	c9                   	leave
+  803c5b:	c3                   	ret
+		return -E_EOF;
+  803c5c:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803c61:	eb f7                	jmp    803c5a <getchar+0x20>
+
+00803c63 <iscons>:
+{
+  803c63:	55                   	push   %ebp
+  803c64:	89 e5                	mov    %esp,%ebp
+  803c66:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803c69:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803c6c:	50                   	push   %eax
+  803c6d:	ff 75 08             	push   0x8(%ebp)
+  803c70:	e8 f2 d4 ff ff       	call   801167 <fd_lookup>
+  803c75:	83 c4 10             	add    $0x10,%esp
+  803c78:	85 c0                	test   %eax,%eax
+  803c7a:	78 11                	js     803c8d <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803c7c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803c7f:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  803c85:	39 10                	cmp    %edx,(%eax)
+  803c87:	0f 94 c0             	sete   %al
+  803c8a:	0f b6 c0             	movzbl %al,%eax
+}
+  803c8d:	c9                   	leave
+  803c8e:	c3                   	ret
+
+00803c8f <opencons>:
+{
+  803c8f:	55                   	push   %ebp
+  803c90:	89 e5                	mov    %esp,%ebp
+  803c92:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803c95:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803c98:	50                   	push   %eax
+  803c99:	e8 73 d4 ff ff       	call   801111 <fd_alloc>
+  803c9e:	83 c4 10             	add    $0x10,%esp
+  803ca1:	85 c0                	test   %eax,%eax
+  803ca3:	78 3a                	js     803cdf <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803ca5:	83 ec 04             	sub    $0x4,%esp
+  803ca8:	68 07 04 00 00       	push   $0x407
+  803cad:	ff 75 f4             	push   -0xc(%ebp)
+  803cb0:	6a 00                	push   $0x0
+  803cb2:	e8 91 cf ff ff       	call   800c48 <sys_page_alloc>
+  803cb7:	83 c4 10             	add    $0x10,%esp
+  803cba:	85 c0                	test   %eax,%eax
+  803cbc:	78 21                	js     803cdf <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803cbe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803cc1:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  803cc7:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803cc9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803ccc:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803cd3:	83 ec 0c             	sub    $0xc,%esp
+  803cd6:	50                   	push   %eax
+  803cd7:	e8 0e d4 ff ff       	call   8010ea <fd2num>
+  803cdc:	83 c4 10             	add    $0x10,%esp
+}
+  803cdf:	c9                   	leave
+  803ce0:	c3                   	ret
+
+00803ce1 <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  803ce1:	55                   	push   %ebp
+  803ce2:	89 e5                	mov    %esp,%ebp
+  803ce4:	57                   	push   %edi
+  803ce5:	56                   	push   %esi
+  803ce6:	53                   	push   %ebx
+  803ce7:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  803cea:	89 d6                	mov    %edx,%esi
+  803cec:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  803cef:	89 cf                	mov    %ecx,%edi
+  803cf1:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  803cf4:	89 fa                	mov    %edi,%edx
+  803cf6:	80 ce 08             	or     $0x8,%dh
+  803cf9:	f6 c5 08             	test   $0x8,%ch
+  803cfc:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  803cff:	57                   	push   %edi
+  803d00:	56                   	push   %esi
+  803d01:	50                   	push   %eax
+  803d02:	56                   	push   %esi
+  803d03:	6a 00                	push   $0x0
+  803d05:	e8 8b cf ff ff       	call   800c95 <sys_page_map>
+	if (r < 0) {
+  803d0a:	83 c4 20             	add    $0x20,%esp
+  803d0d:	85 c0                	test   %eax,%eax
+  803d0f:	78 27                	js     803d38 <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  803d11:	83 ec 0c             	sub    $0xc,%esp
+  803d14:	57                   	push   %edi
+  803d15:	56                   	push   %esi
+  803d16:	6a 00                	push   $0x0
+  803d18:	56                   	push   %esi
+  803d19:	6a 00                	push   $0x0
+  803d1b:	e8 75 cf ff ff       	call   800c95 <sys_page_map>
+  803d20:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803d22:	83 c4 20             	add    $0x20,%esp
+  803d25:	85 c0                	test   %eax,%eax
+  803d27:	78 24                	js     803d4d <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  803d29:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803d2e:	89 d8                	mov    %ebx,%eax
+  803d30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d33:	5b                   	pop    %ebx
+  803d34:	5e                   	pop    %esi
+  803d35:	5f                   	pop    %edi
+  803d36:	5d                   	pop    %ebp
+  803d37:	c3                   	ret
+  803d38:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803d3a:	83 ec 08             	sub    $0x8,%esp
+  803d3d:	50                   	push   %eax
+  803d3e:	68 14 4e 80 00       	push   $0x804e14
+  803d43:	e8 de c4 ff ff       	call   800226 <cprintf>
+		return r;
+  803d48:	83 c4 10             	add    $0x10,%esp
+  803d4b:	eb e1                	jmp    803d2e <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  803d4d:	83 ec 08             	sub    $0x8,%esp
+  803d50:	50                   	push   %eax
+  803d51:	68 44 4e 80 00       	push   $0x804e44
+  803d56:	e8 cb c4 ff ff       	call   800226 <cprintf>
+		return r;
+  803d5b:	83 c4 10             	add    $0x10,%esp
+  803d5e:	eb ce                	jmp    803d2e <duppage_cow+0x4d>
+
+00803d60 <duppage>:
+{
+  803d60:	55                   	push   %ebp
+  803d61:	89 e5                	mov    %esp,%ebp
+  803d63:	53                   	push   %ebx
+  803d64:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  803d67:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  803d6a:	51                   	push   %ecx
+  803d6b:	52                   	push   %edx
+  803d6c:	50                   	push   %eax
+  803d6d:	52                   	push   %edx
+  803d6e:	6a 00                	push   $0x0
+  803d70:	e8 20 cf ff ff       	call   800c95 <sys_page_map>
+	if (r < 0) {
+  803d75:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  803d78:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  803d7d:	85 c0                	test   %eax,%eax
+  803d7f:	78 07                	js     803d88 <duppage+0x28>
+}
+  803d81:	89 d8                	mov    %ebx,%eax
+  803d83:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803d86:	c9                   	leave
+  803d87:	c3                   	ret
+  803d88:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803d8a:	83 ec 08             	sub    $0x8,%esp
+  803d8d:	50                   	push   %eax
+  803d8e:	68 14 4e 80 00       	push   $0x804e14
+  803d93:	e8 8e c4 ff ff       	call   800226 <cprintf>
+		return r;
+  803d98:	83 c4 10             	add    $0x10,%esp
+  803d9b:	eb e4                	jmp    803d81 <duppage+0x21>
+
+00803d9d <cow_copy>:
+{
+  803d9d:	55                   	push   %ebp
+  803d9e:	89 e5                	mov    %esp,%ebp
+  803da0:	56                   	push   %esi
+  803da1:	53                   	push   %ebx
+  803da2:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  803da4:	83 ec 04             	sub    $0x4,%esp
+  803da7:	6a 07                	push   $0x7
+  803da9:	68 00 f0 7f 00       	push   $0x7ff000
+  803dae:	6a 00                	push   $0x0
+  803db0:	e8 93 ce ff ff       	call   800c48 <sys_page_alloc>
+	if (r < 0) {
+  803db5:	83 c4 10             	add    $0x10,%esp
+  803db8:	85 c0                	test   %eax,%eax
+  803dba:	78 58                	js     803e14 <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  803dbc:	83 ec 04             	sub    $0x4,%esp
+  803dbf:	68 00 10 00 00       	push   $0x1000
+  803dc4:	56                   	push   %esi
+  803dc5:	68 00 f0 7f 00       	push   $0x7ff000
+  803dca:	e8 c1 cb ff ff       	call   800990 <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  803dcf:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  803dd6:	56                   	push   %esi
+  803dd7:	6a 00                	push   $0x0
+  803dd9:	68 00 f0 7f 00       	push   $0x7ff000
+  803dde:	6a 00                	push   $0x0
+  803de0:	e8 b0 ce ff ff       	call   800c95 <sys_page_map>
+  803de5:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803de7:	83 c4 20             	add    $0x20,%esp
+  803dea:	85 c0                	test   %eax,%eax
+  803dec:	78 3b                	js     803e29 <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  803dee:	83 ec 08             	sub    $0x8,%esp
+  803df1:	68 00 f0 7f 00       	push   $0x7ff000
+  803df6:	6a 00                	push   $0x0
+  803df8:	e8 e4 ce ff ff       	call   800ce1 <sys_page_unmap>
+  803dfd:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803dff:	83 c4 10             	add    $0x10,%esp
+  803e02:	85 c0                	test   %eax,%eax
+  803e04:	78 45                	js     803e4b <cow_copy+0xae>
+	return 0;
+  803e06:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803e0b:	89 d8                	mov    %ebx,%eax
+  803e0d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803e10:	5b                   	pop    %ebx
+  803e11:	5e                   	pop    %esi
+  803e12:	5d                   	pop    %ebp
+  803e13:	c3                   	ret
+  803e14:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  803e16:	83 ec 08             	sub    $0x8,%esp
+  803e19:	50                   	push   %eax
+  803e1a:	68 34 4f 80 00       	push   $0x804f34
+  803e1f:	e8 02 c4 ff ff       	call   800226 <cprintf>
+		return r;
+  803e24:	83 c4 10             	add    $0x10,%esp
+  803e27:	eb e2                	jmp    803e0b <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  803e29:	83 ec 08             	sub    $0x8,%esp
+  803e2c:	50                   	push   %eax
+  803e2d:	68 50 4f 80 00       	push   $0x804f50
+  803e32:	e8 ef c3 ff ff       	call   800226 <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  803e37:	83 c4 08             	add    $0x8,%esp
+  803e3a:	68 00 f0 7f 00       	push   $0x7ff000
+  803e3f:	6a 00                	push   $0x0
+  803e41:	e8 9b ce ff ff       	call   800ce1 <sys_page_unmap>
+		return r;
+  803e46:	83 c4 10             	add    $0x10,%esp
+  803e49:	eb c0                	jmp    803e0b <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  803e4b:	83 ec 08             	sub    $0x8,%esp
+  803e4e:	50                   	push   %eax
+  803e4f:	68 6c 4e 80 00       	push   $0x804e6c
+  803e54:	e8 cd c3 ff ff       	call   800226 <cprintf>
+		return r;
+  803e59:	83 c4 10             	add    $0x10,%esp
+  803e5c:	eb ad                	jmp    803e0b <cow_copy+0x6e>
+
+00803e5e <pgfault>:
+{
+  803e5e:	55                   	push   %ebp
+  803e5f:	89 e5                	mov    %esp,%ebp
+  803e61:	56                   	push   %esi
+  803e62:	53                   	push   %ebx
+  803e63:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  803e66:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  803e68:	89 d8                	mov    %ebx,%eax
+  803e6a:	c1 e8 16             	shr    $0x16,%eax
+  803e6d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  803e74:	89 de                	mov    %ebx,%esi
+  803e76:	c1 ee 0c             	shr    $0xc,%esi
+  803e79:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  803e80:	a8 07                	test   $0x7,%al
+  803e82:	74 3b                	je     803ebf <pgfault+0x61>
+  803e84:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  803e8a:	74 33                	je     803ebf <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  803e8c:	83 ec 0c             	sub    $0xc,%esp
+  803e8f:	68 00 f0 bf ee       	push   $0xeebff000
+  803e94:	e8 c8 f4 ff ff       	call   803361 <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  803e99:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  803ea0:	83 c4 10             	add    $0x10,%esp
+  803ea3:	f6 c4 08             	test   $0x8,%ah
+  803ea6:	75 30                	jne    803ed8 <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  803ea8:	83 ec 0c             	sub    $0xc,%esp
+  803eab:	68 00 f0 bf ee       	push   $0xeebff000
+  803eb0:	e8 19 f5 ff ff       	call   8033ce <mutex_unlock>
+}
+  803eb5:	83 c4 10             	add    $0x10,%esp
+  803eb8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803ebb:	5b                   	pop    %ebx
+  803ebc:	5e                   	pop    %esi
+  803ebd:	5d                   	pop    %ebp
+  803ebe:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  803ebf:	83 ec 08             	sub    $0x8,%esp
+  803ec2:	ff 72 28             	push   0x28(%edx)
+  803ec5:	51                   	push   %ecx
+  803ec6:	50                   	push   %eax
+  803ec7:	68 90 4e 80 00       	push   $0x804e90
+  803ecc:	6a 3f                	push   $0x3f
+  803ece:	68 6a 4f 80 00       	push   $0x804f6a
+  803ed3:	e8 73 c2 ff ff       	call   80014b <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  803ed8:	89 d8                	mov    %ebx,%eax
+  803eda:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  803edf:	e8 b9 fe ff ff       	call   803d9d <cow_copy>
+  803ee4:	eb c2                	jmp    803ea8 <pgfault+0x4a>
+
+00803ee6 <cow_enable>:
+{
+  803ee6:	55                   	push   %ebp
+  803ee7:	89 e5                	mov    %esp,%ebp
+  803ee9:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  803eec:	68 5e 3e 80 00       	push   $0x803e5e
+  803ef1:	e8 28 06 00 00       	call   80451e <set_pgfault_handler>
+}
+  803ef6:	83 c4 10             	add    $0x10,%esp
+  803ef9:	c9                   	leave
+  803efa:	c3                   	ret
+
+00803efb <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  803efb:	55                   	push   %ebp
+  803efc:	89 e5                	mov    %esp,%ebp
+  803efe:	57                   	push   %edi
+  803eff:	56                   	push   %esi
+  803f00:	53                   	push   %ebx
+  803f01:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  803f04:	68 5e 3e 80 00       	push   $0x803e5e
+  803f09:	e8 10 06 00 00       	call   80451e <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  803f0e:	b8 07 00 00 00       	mov    $0x7,%eax
+  803f13:	cd 30                	int    $0x30
+  803f15:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  803f18:	83 c4 10             	add    $0x10,%esp
+  803f1b:	85 c0                	test   %eax,%eax
+  803f1d:	78 4b                	js     803f6a <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  803f1f:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  803f24:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803f29:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  803f2c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  803f30:	0f 85 16 01 00 00    	jne    80404c <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803f36:	e8 b5 cc ff ff       	call   800bf0 <sys_getenvid>
+  803f3b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803f40:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803f42:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  803f48:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803f4e:	77 32                	ja     803f82 <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803f50:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  803f55:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  803f57:	c1 ea 10             	shr    $0x10,%edx
+  803f5a:	74 26                	je     803f82 <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803f5c:	c1 e2 10             	shl    $0x10,%edx
+  803f5f:	89 d1                	mov    %edx,%ecx
+  803f61:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803f66:	29 ca                	sub    %ecx,%edx
+  803f68:	eb 1e                	jmp    803f88 <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  803f6a:	83 ec 08             	sub    $0x8,%esp
+  803f6d:	89 c7                	mov    %eax,%edi
+  803f6f:	50                   	push   %eax
+  803f70:	68 75 4f 80 00       	push   $0x804f75
+  803f75:	e8 ac c2 ff ff       	call   800226 <cprintf>
+		return eid;
+  803f7a:	83 c4 10             	add    $0x10,%esp
+  803f7d:	e9 6c 01 00 00       	jmp    8040ee <fork+0x1f3>
+		return pthread_main_tls;
+  803f82:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803f88:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  803f8b:	c1 e0 04             	shl    $0x4,%eax
+  803f8e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803f93:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  803f95:	e8 10 fb ff ff       	call   803aaa <pthread_fork_child>
+		return eid;
+  803f9a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  803f9d:	e9 4c 01 00 00       	jmp    8040ee <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  803fa2:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  803fa8:	89 da                	mov    %ebx,%edx
+  803faa:	89 f8                	mov    %edi,%eax
+  803fac:	e8 af fd ff ff       	call   803d60 <duppage>
+  803fb1:	85 c0                	test   %eax,%eax
+  803fb3:	79 28                	jns    803fdd <fork+0xe2>
+  803fb5:	89 c7                	mov    %eax,%edi
+  803fb7:	e9 32 01 00 00       	jmp    8040ee <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  803fbc:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  803fc2:	83 f9 05             	cmp    $0x5,%ecx
+  803fc5:	75 58                	jne    80401f <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  803fc7:	b9 05 00 00 00       	mov    $0x5,%ecx
+  803fcc:	89 da                	mov    %ebx,%edx
+  803fce:	89 f8                	mov    %edi,%eax
+  803fd0:	e8 8b fd ff ff       	call   803d60 <duppage>
+  803fd5:	85 c0                	test   %eax,%eax
+  803fd7:	0f 88 0f 01 00 00    	js     8040ec <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  803fdd:	83 c3 01             	add    $0x1,%ebx
+  803fe0:	39 de                	cmp    %ebx,%esi
+  803fe2:	74 54                	je     804038 <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  803fe4:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  803feb:	f6 c1 05             	test   $0x5,%cl
+  803fee:	74 ed                	je     803fdd <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  803ff0:	f6 c5 04             	test   $0x4,%ch
+  803ff3:	75 ad                	jne    803fa2 <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  803ff5:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  803ffb:	74 bf                	je     803fbc <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  803ffd:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  804003:	74 d8                	je     803fdd <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  804005:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  80400b:	89 da                	mov    %ebx,%edx
+  80400d:	89 f8                	mov    %edi,%eax
+  80400f:	e8 cd fc ff ff       	call   803ce1 <duppage_cow>
+  804014:	85 c0                	test   %eax,%eax
+  804016:	79 c5                	jns    803fdd <fork+0xe2>
+  804018:	89 c7                	mov    %eax,%edi
+  80401a:	e9 cf 00 00 00       	jmp    8040ee <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  80401f:	68 c0 4e 80 00       	push   $0x804ec0
+  804024:	68 bd 4c 80 00       	push   $0x804cbd
+  804029:	68 c6 00 00 00       	push   $0xc6
+  80402e:	68 6a 4f 80 00       	push   $0x804f6a
+  804033:	e8 13 c1 ff ff       	call   80014b <_panic>
+  804038:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80403b:	83 c1 01             	add    $0x1,%ecx
+  80403e:	81 c6 00 04 00 00    	add    $0x400,%esi
+  804044:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  80404a:	74 18                	je     804064 <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  80404c:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  804053:	a8 07                	test   $0x7,%al
+  804055:	74 e4                	je     80403b <fork+0x140>
+  804057:	89 cb                	mov    %ecx,%ebx
+  804059:	c1 e3 0a             	shl    $0xa,%ebx
+  80405c:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80405f:	e9 7c ff ff ff       	jmp    803fe0 <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  804064:	83 ec 04             	sub    $0x4,%esp
+  804067:	6a 07                	push   $0x7
+  804069:	68 00 f0 bf ee       	push   $0xeebff000
+  80406e:	ff 75 e4             	push   -0x1c(%ebp)
+  804071:	e8 d2 cb ff ff       	call   800c48 <sys_page_alloc>
+  804076:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804078:	83 c4 10             	add    $0x10,%esp
+  80407b:	85 c0                	test   %eax,%eax
+  80407d:	78 34                	js     8040b3 <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  80407f:	83 ec 08             	sub    $0x8,%esp
+  804082:	68 5c 45 80 00       	push   $0x80455c
+  804087:	ff 75 e4             	push   -0x1c(%ebp)
+  80408a:	e8 36 cd ff ff       	call   800dc5 <sys_env_set_pgfault_upcall>
+  80408f:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804091:	83 c4 10             	add    $0x10,%esp
+  804094:	85 c0                	test   %eax,%eax
+  804096:	78 2e                	js     8040c6 <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  804098:	83 ec 08             	sub    $0x8,%esp
+  80409b:	6a 02                	push   $0x2
+  80409d:	ff 75 e4             	push   -0x1c(%ebp)
+  8040a0:	e8 88 cc ff ff       	call   800d2d <sys_env_set_status>
+  8040a5:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8040a7:	83 c4 10             	add    $0x10,%esp
+  8040aa:	85 c0                	test   %eax,%eax
+  8040ac:	78 2b                	js     8040d9 <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  8040ae:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8040b1:	eb 3b                	jmp    8040ee <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  8040b3:	83 ec 08             	sub    $0x8,%esp
+  8040b6:	50                   	push   %eax
+  8040b7:	68 e8 4e 80 00       	push   $0x804ee8
+  8040bc:	e8 65 c1 ff ff       	call   800226 <cprintf>
+		return r;
+  8040c1:	83 c4 10             	add    $0x10,%esp
+  8040c4:	eb 28                	jmp    8040ee <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  8040c6:	83 ec 08             	sub    $0x8,%esp
+  8040c9:	50                   	push   %eax
+  8040ca:	68 10 4f 80 00       	push   $0x804f10
+  8040cf:	e8 52 c1 ff ff       	call   800226 <cprintf>
+		return r;
+  8040d4:	83 c4 10             	add    $0x10,%esp
+  8040d7:	eb 15                	jmp    8040ee <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  8040d9:	83 ec 08             	sub    $0x8,%esp
+  8040dc:	50                   	push   %eax
+  8040dd:	68 85 4f 80 00       	push   $0x804f85
+  8040e2:	e8 3f c1 ff ff       	call   800226 <cprintf>
+		return r;
+  8040e7:	83 c4 10             	add    $0x10,%esp
+  8040ea:	eb 02                	jmp    8040ee <fork+0x1f3>
+  8040ec:	89 c7                	mov    %eax,%edi
+}
+  8040ee:	89 f8                	mov    %edi,%eax
+  8040f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8040f3:	5b                   	pop    %ebx
+  8040f4:	5e                   	pop    %esi
+  8040f5:	5f                   	pop    %edi
+  8040f6:	5d                   	pop    %ebp
+  8040f7:	c3                   	ret
+
+008040f8 <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  8040f8:	55                   	push   %ebp
+  8040f9:	89 e5                	mov    %esp,%ebp
+  8040fb:	57                   	push   %edi
+  8040fc:	56                   	push   %esi
+  8040fd:	53                   	push   %ebx
+  8040fe:	83 ec 2c             	sub    $0x2c,%esp
+  804101:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804103:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  804109:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80410e:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  804114:	77 0a                	ja     804120 <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804116:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  80411b:	29 c3                	sub    %eax,%ebx
+  80411d:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  804120:	83 ec 0c             	sub    $0xc,%esp
+  804123:	68 5e 3e 80 00       	push   $0x803e5e
+  804128:	e8 f1 03 00 00       	call   80451e <set_pgfault_handler>
+  80412d:	b8 07 00 00 00       	mov    $0x7,%eax
+  804132:	cd 30                	int    $0x30
+  804134:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  804137:	83 c4 10             	add    $0x10,%esp
+  80413a:	85 c0                	test   %eax,%eax
+  80413c:	78 30                	js     80416e <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  80413e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  804142:	74 42                	je     804186 <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  804144:	c1 e3 10             	shl    $0x10,%ebx
+  804147:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  80414c:	29 d8                	sub    %ebx,%eax
+  80414e:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  804151:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  804156:	29 d8                	sub    %ebx,%eax
+  804158:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80415b:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804160:	ba 00 00 00 00       	mov    $0x0,%edx
+  804165:	89 f7                	mov    %esi,%edi
+  804167:	89 d6                	mov    %edx,%esi
+  804169:	e9 2c 01 00 00       	jmp    80429a <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  80416e:	83 ec 08             	sub    $0x8,%esp
+  804171:	89 c7                	mov    %eax,%edi
+  804173:	50                   	push   %eax
+  804174:	68 75 4f 80 00       	push   $0x804f75
+  804179:	e8 a8 c0 ff ff       	call   800226 <cprintf>
+		return eid;
+  80417e:	83 c4 10             	add    $0x10,%esp
+  804181:	e9 d5 00 00 00       	jmp    80425b <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  804186:	e8 65 ca ff ff       	call   800bf0 <sys_getenvid>
+  80418b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804190:	89 c2                	mov    %eax,%edx
+  804192:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804194:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  80419a:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80419f:	77 18                	ja     8041b9 <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8041a1:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8041a6:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  8041a8:	c1 e8 10             	shr    $0x10,%eax
+  8041ab:	74 0c                	je     8041b9 <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8041ad:	c1 e0 10             	shl    $0x10,%eax
+  8041b0:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8041b5:	29 c1                	sub    %eax,%ecx
+  8041b7:	eb 06                	jmp    8041bf <sfork+0xc7>
+		return pthread_main_tls;
+  8041b9:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+  8041bf:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8041c2:	c1 e0 04             	shl    $0x4,%eax
+  8041c5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8041ca:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  8041cc:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8041cf:	e9 87 00 00 00       	jmp    80425b <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  8041d4:	f6 c5 04             	test   $0x4,%ch
+  8041d7:	74 6c                	je     804245 <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  8041d9:	89 ca                	mov    %ecx,%edx
+  8041db:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  8041e1:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  8041e7:	74 7c                	je     804265 <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8041e9:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8041ef:	89 da                	mov    %ebx,%edx
+  8041f1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8041f4:	e8 67 fb ff ff       	call   803d60 <duppage>
+  8041f9:	85 c0                	test   %eax,%eax
+  8041fb:	0f 88 4f 01 00 00    	js     804350 <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  804201:	83 c3 01             	add    $0x1,%ebx
+  804204:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  804207:	74 7a                	je     804283 <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  804209:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  80420b:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  804212:	f6 c1 01             	test   $0x1,%cl
+  804215:	74 ea                	je     804201 <sfork+0x109>
+  804217:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  80421d:	74 e2                	je     804201 <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  80421f:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  804225:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  804228:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  80422d:	76 a5                	jbe    8041d4 <sfork+0xdc>
+  80422f:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  804235:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  804238:	39 fa                	cmp    %edi,%edx
+  80423a:	73 9d                	jae    8041d9 <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  80423c:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  80423f:	39 fa                	cmp    %edi,%edx
+  804241:	72 96                	jb     8041d9 <sfork+0xe1>
+  804243:	eb 8f                	jmp    8041d4 <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  804245:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  80424b:	89 da                	mov    %ebx,%edx
+  80424d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804250:	e8 8c fa ff ff       	call   803ce1 <duppage_cow>
+  804255:	85 c0                	test   %eax,%eax
+  804257:	79 a8                	jns    804201 <sfork+0x109>
+  804259:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  80425b:	89 f8                	mov    %edi,%eax
+  80425d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804260:	5b                   	pop    %ebx
+  804261:	5e                   	pop    %esi
+  804262:	5f                   	pop    %edi
+  804263:	5d                   	pop    %ebp
+  804264:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  804265:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  80426a:	e8 2e fb ff ff       	call   803d9d <cow_copy>
+  80426f:	85 c0                	test   %eax,%eax
+  804271:	0f 88 d2 00 00 00    	js     804349 <sfork+0x251>
+				pte = uvpt[pn];
+  804277:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  80427e:	e9 66 ff ff ff       	jmp    8041e9 <sfork+0xf1>
+  804283:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804286:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804289:	83 c6 01             	add    $0x1,%esi
+  80428c:	81 c7 00 04 00 00    	add    $0x400,%edi
+  804292:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  804298:	74 1b                	je     8042b5 <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  80429a:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  8042a1:	a8 01                	test   $0x1,%al
+  8042a3:	74 e4                	je     804289 <sfork+0x191>
+  8042a5:	89 f3                	mov    %esi,%ebx
+  8042a7:	c1 e3 0a             	shl    $0xa,%ebx
+  8042aa:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  8042ad:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  8042b0:	e9 4f ff ff ff       	jmp    804204 <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  8042b5:	83 ec 04             	sub    $0x4,%esp
+  8042b8:	6a 07                	push   $0x7
+  8042ba:	68 00 f0 bf ee       	push   $0xeebff000
+  8042bf:	ff 75 e0             	push   -0x20(%ebp)
+  8042c2:	e8 81 c9 ff ff       	call   800c48 <sys_page_alloc>
+  8042c7:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8042c9:	83 c4 10             	add    $0x10,%esp
+  8042cc:	85 c0                	test   %eax,%eax
+  8042ce:	78 37                	js     804307 <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  8042d0:	83 ec 08             	sub    $0x8,%esp
+  8042d3:	68 5c 45 80 00       	push   $0x80455c
+  8042d8:	ff 75 e0             	push   -0x20(%ebp)
+  8042db:	e8 e5 ca ff ff       	call   800dc5 <sys_env_set_pgfault_upcall>
+  8042e0:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8042e2:	83 c4 10             	add    $0x10,%esp
+  8042e5:	85 c0                	test   %eax,%eax
+  8042e7:	78 34                	js     80431d <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  8042e9:	83 ec 08             	sub    $0x8,%esp
+  8042ec:	6a 02                	push   $0x2
+  8042ee:	ff 75 e0             	push   -0x20(%ebp)
+  8042f1:	e8 37 ca ff ff       	call   800d2d <sys_env_set_status>
+  8042f6:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8042f8:	83 c4 10             	add    $0x10,%esp
+  8042fb:	85 c0                	test   %eax,%eax
+  8042fd:	78 34                	js     804333 <sfork+0x23b>
+	return eid;
+  8042ff:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  804302:	e9 54 ff ff ff       	jmp    80425b <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  804307:	83 ec 08             	sub    $0x8,%esp
+  80430a:	50                   	push   %eax
+  80430b:	68 e8 4e 80 00       	push   $0x804ee8
+  804310:	e8 11 bf ff ff       	call   800226 <cprintf>
+		return r;
+  804315:	83 c4 10             	add    $0x10,%esp
+  804318:	e9 3e ff ff ff       	jmp    80425b <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  80431d:	83 ec 08             	sub    $0x8,%esp
+  804320:	50                   	push   %eax
+  804321:	68 10 4f 80 00       	push   $0x804f10
+  804326:	e8 fb be ff ff       	call   800226 <cprintf>
+		return r;
+  80432b:	83 c4 10             	add    $0x10,%esp
+  80432e:	e9 28 ff ff ff       	jmp    80425b <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  804333:	83 ec 08             	sub    $0x8,%esp
+  804336:	50                   	push   %eax
+  804337:	68 85 4f 80 00       	push   $0x804f85
+  80433c:	e8 e5 be ff ff       	call   800226 <cprintf>
+		return r;
+  804341:	83 c4 10             	add    $0x10,%esp
+  804344:	e9 12 ff ff ff       	jmp    80425b <sfork+0x163>
+  804349:	89 c7                	mov    %eax,%edi
+  80434b:	e9 0b ff ff ff       	jmp    80425b <sfork+0x163>
+  804350:	89 c7                	mov    %eax,%edi
+  804352:	e9 04 ff ff ff       	jmp    80425b <sfork+0x163>
+
+00804357 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  804357:	55                   	push   %ebp
+  804358:	89 e5                	mov    %esp,%ebp
+  80435a:	57                   	push   %edi
+  80435b:	56                   	push   %esi
+  80435c:	53                   	push   %ebx
+  80435d:	83 ec 18             	sub    $0x18,%esp
+  804360:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804363:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804366:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  804369:	85 c0                	test   %eax,%eax
+  80436b:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804370:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  804373:	50                   	push   %eax
+  804374:	e8 c5 ca ff ff       	call   800e3e <sys_ipc_recv>
+	if (r < 0) {
+  804379:	83 c4 10             	add    $0x10,%esp
+  80437c:	85 c0                	test   %eax,%eax
+  80437e:	78 2b                	js     8043ab <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  804380:	85 ff                	test   %edi,%edi
+  804382:	74 55                	je     8043d9 <ipc_recv+0x82>
+  804384:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804386:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80438c:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804391:	77 39                	ja     8043cc <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804393:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804398:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80439a:	c1 e8 10             	shr    $0x10,%eax
+  80439d:	74 2d                	je     8043cc <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80439f:	c1 e0 10             	shl    $0x10,%eax
+  8043a2:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8043a7:	29 c2                	sub    %eax,%edx
+  8043a9:	eb 27                	jmp    8043d2 <ipc_recv+0x7b>
+  8043ab:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  8043ad:	83 ec 08             	sub    $0x8,%esp
+  8043b0:	50                   	push   %eax
+  8043b1:	68 a3 4f 80 00       	push   $0x804fa3
+  8043b6:	e8 6b be ff ff       	call   800226 <cprintf>
+		*from_env_store = 0;
+  8043bb:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  8043c1:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  8043c7:	83 c4 10             	add    $0x10,%esp
+  8043ca:	eb 77                	jmp    804443 <ipc_recv+0xec>
+		return pthread_main_tls;
+  8043cc:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  8043d2:	8b 02                	mov    (%edx),%eax
+  8043d4:	8b 40 78             	mov    0x78(%eax),%eax
+  8043d7:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8043d9:	85 f6                	test   %esi,%esi
+  8043db:	74 34                	je     804411 <ipc_recv+0xba>
+  8043dd:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8043df:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8043e5:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8043ea:	77 18                	ja     804404 <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8043ec:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8043f1:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8043f3:	c1 e8 10             	shr    $0x10,%eax
+  8043f6:	74 0c                	je     804404 <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8043f8:	c1 e0 10             	shl    $0x10,%eax
+  8043fb:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804400:	29 c2                	sub    %eax,%edx
+  804402:	eb 06                	jmp    80440a <ipc_recv+0xb3>
+		return pthread_main_tls;
+  804404:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  80440a:	8b 02                	mov    (%edx),%eax
+  80440c:	8b 40 7c             	mov    0x7c(%eax),%eax
+  80440f:	89 06                	mov    %eax,(%esi)
+  804411:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804413:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804419:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80441e:	77 18                	ja     804438 <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804420:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804425:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804427:	c1 e8 10             	shr    $0x10,%eax
+  80442a:	74 0c                	je     804438 <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80442c:	c1 e0 10             	shl    $0x10,%eax
+  80442f:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804434:	29 c2                	sub    %eax,%edx
+  804436:	eb 06                	jmp    80443e <ipc_recv+0xe7>
+		return pthread_main_tls;
+  804438:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	}
+	return thisenv->env_ipc_value;
+  80443e:	8b 02                	mov    (%edx),%eax
+  804440:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  804443:	89 d8                	mov    %ebx,%eax
+  804445:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804448:	5b                   	pop    %ebx
+  804449:	5e                   	pop    %esi
+  80444a:	5f                   	pop    %edi
+  80444b:	5d                   	pop    %ebp
+  80444c:	c3                   	ret
+
+0080444d <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  80444d:	55                   	push   %ebp
+  80444e:	89 e5                	mov    %esp,%ebp
+  804450:	57                   	push   %edi
+  804451:	56                   	push   %esi
+  804452:	53                   	push   %ebx
+  804453:	83 ec 0c             	sub    $0xc,%esp
+  804456:	8b 75 08             	mov    0x8(%ebp),%esi
+  804459:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80445c:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  80445f:	85 db                	test   %ebx,%ebx
+  804461:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  804466:	0f 44 d8             	cmove  %eax,%ebx
+  804469:	eb 05                	jmp    804470 <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  80446b:	e8 ac c7 ff ff       	call   800c1c <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  804470:	57                   	push   %edi
+  804471:	53                   	push   %ebx
+  804472:	ff 75 0c             	push   0xc(%ebp)
+  804475:	56                   	push   %esi
+  804476:	e8 96 c9 ff ff       	call   800e11 <sys_ipc_try_send>
+		if (r == 0) {
+  80447b:	83 c4 10             	add    $0x10,%esp
+  80447e:	85 c0                	test   %eax,%eax
+  804480:	74 19                	je     80449b <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  804482:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  804485:	74 e4                	je     80446b <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  804487:	83 ec 0c             	sub    $0xc,%esp
+  80448a:	50                   	push   %eax
+  80448b:	57                   	push   %edi
+  80448c:	53                   	push   %ebx
+  80448d:	56                   	push   %esi
+  80448e:	68 bc 4f 80 00       	push   $0x804fbc
+  804493:	e8 8e bd ff ff       	call   800226 <cprintf>
+			return;
+  804498:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  80449b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80449e:	5b                   	pop    %ebx
+  80449f:	5e                   	pop    %esi
+  8044a0:	5f                   	pop    %edi
+  8044a1:	5d                   	pop    %ebp
+  8044a2:	c3                   	ret
+
+008044a3 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8044a3:	55                   	push   %ebp
+  8044a4:	89 e5                	mov    %esp,%ebp
+  8044a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8044a9:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  8044ae:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8044b1:	c1 e0 04             	shl    $0x4,%eax
+  8044b4:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8044b9:	8b 40 50             	mov    0x50(%eax),%eax
+  8044bc:	39 c8                	cmp    %ecx,%eax
+  8044be:	74 12                	je     8044d2 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8044c0:	83 c2 01             	add    $0x1,%edx
+  8044c3:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8044c9:	75 e3                	jne    8044ae <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8044cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044d0:	eb 0e                	jmp    8044e0 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8044d2:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8044d5:	c1 e0 04             	shl    $0x4,%eax
+  8044d8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8044dd:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8044e0:	5d                   	pop    %ebp
+  8044e1:	c3                   	ret
+
+008044e2 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8044e2:	55                   	push   %ebp
+  8044e3:	89 e5                	mov    %esp,%ebp
+  8044e5:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8044e8:	89 c2                	mov    %eax,%edx
+  8044ea:	c1 ea 16             	shr    $0x16,%edx
+  8044ed:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8044f4:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8044f9:	f6 c1 01             	test   $0x1,%cl
+  8044fc:	74 1c                	je     80451a <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  8044fe:	c1 e8 0c             	shr    $0xc,%eax
+  804501:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  804508:	a8 01                	test   $0x1,%al
+  80450a:	74 0e                	je     80451a <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80450c:	c1 e8 0c             	shr    $0xc,%eax
+  80450f:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  804516:	ef 
+  804517:	0f b7 d2             	movzwl %dx,%edx
+}
+  80451a:	89 d0                	mov    %edx,%eax
+  80451c:	5d                   	pop    %ebp
+  80451d:	c3                   	ret
+
+0080451e <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  80451e:	55                   	push   %ebp
+  80451f:	89 e5                	mov    %esp,%ebp
+  804521:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  804524:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  80452b:	74 0a                	je     804537 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  80452d:	8b 45 08             	mov    0x8(%ebp),%eax
+  804530:	a3 00 90 80 00       	mov    %eax,0x809000
+}
+  804535:	c9                   	leave
+  804536:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  804537:	83 ec 04             	sub    $0x4,%esp
+  80453a:	6a 07                	push   $0x7
+  80453c:	68 00 f0 bf ee       	push   $0xeebff000
+  804541:	6a 00                	push   $0x0
+  804543:	e8 00 c7 ff ff       	call   800c48 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804548:	83 c4 08             	add    $0x8,%esp
+  80454b:	68 5c 45 80 00       	push   $0x80455c
+  804550:	6a 00                	push   $0x0
+  804552:	e8 6e c8 ff ff       	call   800dc5 <sys_env_set_pgfault_upcall>
+  804557:	83 c4 10             	add    $0x10,%esp
+  80455a:	eb d1                	jmp    80452d <set_pgfault_handler+0xf>
+
+0080455c <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80455c:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80455d:	a1 00 90 80 00       	mov    0x809000,%eax
+	call *%eax
+  804562:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804564:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  804567:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  80456b:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  80456f:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  804572:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  804576:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  804578:	83 c4 08             	add    $0x8,%esp
+	popal
+  80457b:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  80457c:	83 c4 04             	add    $0x4,%esp
+	popfl
+  80457f:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  804580:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  804581:	c3                   	ret
+
+00804582 <udm>:
+  804582:	57                   	push   %edi
+  804583:	56                   	push   %esi
+  804584:	53                   	push   %ebx
+  804585:	83 ec 20             	sub    $0x20,%esp
+  804588:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80458c:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804590:	8b 44 24 30          	mov    0x30(%esp),%eax
+  804594:	8b 54 24 34          	mov    0x34(%esp),%edx
+  804598:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80459c:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8045a0:	89 d1                	mov    %edx,%ecx
+  8045a2:	09 c1                	or     %eax,%ecx
+  8045a4:	0f 84 91 00 00 00    	je     80463b <udm+0xb9>
+  8045aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8045b4:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8045b9:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8045c0:	00 
+  8045c1:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8045c8:	00 
+  8045c9:	eb 08                	jmp    8045d3 <udm+0x51>
+  8045cb:	83 e9 01             	sub    $0x1,%ecx
+  8045ce:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8045d1:	74 7c                	je     80464f <udm+0xcd>
+  8045d3:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8045d7:	01 c0                	add    %eax,%eax
+  8045d9:	89 c6                	mov    %eax,%esi
+  8045db:	89 d7                	mov    %edx,%edi
+  8045dd:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8045e1:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8045e5:	0f ad d0             	shrd   %cl,%edx,%eax
+  8045e8:	d3 ea                	shr    %cl,%edx
+  8045ea:	f6 c1 20             	test   $0x20,%cl
+  8045ed:	74 04                	je     8045f3 <udm+0x71>
+  8045ef:	89 d0                	mov    %edx,%eax
+  8045f1:	31 d2                	xor    %edx,%edx
+  8045f3:	83 e0 01             	and    $0x1,%eax
+  8045f6:	89 04 24             	mov    %eax,(%esp)
+  8045f9:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804600:	00 
+  804601:	8b 04 24             	mov    (%esp),%eax
+  804604:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804608:	09 f0                	or     %esi,%eax
+  80460a:	09 fa                	or     %edi,%edx
+  80460c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804610:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804614:	39 f0                	cmp    %esi,%eax
+  804616:	89 d3                	mov    %edx,%ebx
+  804618:	19 fb                	sbb    %edi,%ebx
+  80461a:	72 af                	jb     8045cb <udm+0x49>
+  80461c:	29 f0                	sub    %esi,%eax
+  80461e:	19 fa                	sbb    %edi,%edx
+  804620:	89 cf                	mov    %ecx,%edi
+  804622:	c1 ef 05             	shr    $0x5,%edi
+  804625:	83 e7 01             	and    $0x1,%edi
+  804628:	89 fe                	mov    %edi,%esi
+  80462a:	83 f6 01             	xor    $0x1,%esi
+  80462d:	d3 e6                	shl    %cl,%esi
+  80462f:	d3 e7                	shl    %cl,%edi
+  804631:	09 74 24 18          	or     %esi,0x18(%esp)
+  804635:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804639:	eb 90                	jmp    8045cb <udm+0x49>
+  80463b:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80463f:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804643:	89 f0                	mov    %esi,%eax
+  804645:	89 fa                	mov    %edi,%edx
+  804647:	89 74 24 18          	mov    %esi,0x18(%esp)
+  80464b:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  80464f:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  804653:	89 01                	mov    %eax,(%ecx)
+  804655:	89 51 04             	mov    %edx,0x4(%ecx)
+  804658:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80465c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804660:	83 c4 20             	add    $0x20,%esp
+  804663:	5b                   	pop    %ebx
+  804664:	5e                   	pop    %esi
+  804665:	5f                   	pop    %edi
+  804666:	c3                   	ret
+
+00804667 <__udivdi3>:
+  804667:	83 ec 18             	sub    $0x18,%esp
+  80466a:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80466e:	50                   	push   %eax
+  80466f:	ff 74 24 2c          	push   0x2c(%esp)
+  804673:	ff 74 24 2c          	push   0x2c(%esp)
+  804677:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80467b:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80467f:	e8 fe fe ff ff       	call   804582 <udm>
+  804684:	83 c4 24             	add    $0x24,%esp
+  804687:	c3                   	ret
+
+00804688 <__umoddi3>:
+  804688:	83 ec 18             	sub    $0x18,%esp
+  80468b:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80468f:	50                   	push   %eax
+  804690:	ff 74 24 2c          	push   0x2c(%esp)
+  804694:	ff 74 24 2c          	push   0x2c(%esp)
+  804698:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80469c:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8046a0:	e8 dd fe ff ff       	call   804582 <udm>
+  8046a5:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8046a9:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8046ad:	83 c4 24             	add    $0x24,%esp
+  8046b0:	c3                   	ret
+
+008046b1 <__divdi3>:
+  8046b1:	56                   	push   %esi
+  8046b2:	53                   	push   %ebx
+  8046b3:	83 ec 14             	sub    $0x14,%esp
+  8046b6:	8b 44 24 20          	mov    0x20(%esp),%eax
+  8046ba:	8b 54 24 24          	mov    0x24(%esp),%edx
+  8046be:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  8046c2:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  8046c6:	85 d2                	test   %edx,%edx
+  8046c8:	78 18                	js     8046e2 <__divdi3+0x31>
+  8046ca:	85 db                	test   %ebx,%ebx
+  8046cc:	78 3e                	js     80470c <__divdi3+0x5b>
+  8046ce:	83 ec 04             	sub    $0x4,%esp
+  8046d1:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8046d5:	56                   	push   %esi
+  8046d6:	53                   	push   %ebx
+  8046d7:	51                   	push   %ecx
+  8046d8:	e8 a5 fe ff ff       	call   804582 <udm>
+  8046dd:	83 c4 10             	add    $0x10,%esp
+  8046e0:	eb 24                	jmp    804706 <__divdi3+0x55>
+  8046e2:	f7 d8                	neg    %eax
+  8046e4:	83 d2 00             	adc    $0x0,%edx
+  8046e7:	f7 da                	neg    %edx
+  8046e9:	85 db                	test   %ebx,%ebx
+  8046eb:	78 3a                	js     804727 <__divdi3+0x76>
+  8046ed:	83 ec 04             	sub    $0x4,%esp
+  8046f0:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8046f4:	56                   	push   %esi
+  8046f5:	53                   	push   %ebx
+  8046f6:	51                   	push   %ecx
+  8046f7:	e8 86 fe ff ff       	call   804582 <udm>
+  8046fc:	83 c4 10             	add    $0x10,%esp
+  8046ff:	f7 d8                	neg    %eax
+  804701:	83 d2 00             	adc    $0x0,%edx
+  804704:	f7 da                	neg    %edx
+  804706:	83 c4 14             	add    $0x14,%esp
+  804709:	5b                   	pop    %ebx
+  80470a:	5e                   	pop    %esi
+  80470b:	c3                   	ret
+  80470c:	83 ec 04             	sub    $0x4,%esp
+  80470f:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804713:	56                   	push   %esi
+  804714:	f7 d9                	neg    %ecx
+  804716:	83 d3 00             	adc    $0x0,%ebx
+  804719:	f7 db                	neg    %ebx
+  80471b:	53                   	push   %ebx
+  80471c:	51                   	push   %ecx
+  80471d:	e8 60 fe ff ff       	call   804582 <udm>
+  804722:	83 c4 10             	add    $0x10,%esp
+  804725:	eb d8                	jmp    8046ff <__divdi3+0x4e>
+  804727:	83 ec 04             	sub    $0x4,%esp
+  80472a:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80472e:	56                   	push   %esi
+  80472f:	f7 d9                	neg    %ecx
+  804731:	83 d3 00             	adc    $0x0,%ebx
+  804734:	f7 db                	neg    %ebx
+  804736:	53                   	push   %ebx
+  804737:	51                   	push   %ecx
+  804738:	e8 45 fe ff ff       	call   804582 <udm>
+  80473d:	83 c4 10             	add    $0x10,%esp
+  804740:	eb c4                	jmp    804706 <__divdi3+0x55>
+
+00804742 <__moddi3>:
+  804742:	55                   	push   %ebp
+  804743:	57                   	push   %edi
+  804744:	56                   	push   %esi
+  804745:	53                   	push   %ebx
+  804746:	83 ec 24             	sub    $0x24,%esp
+  804749:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80474d:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804751:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  804755:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  804759:	85 d2                	test   %edx,%edx
+  80475b:	78 3b                	js     804798 <__moddi3+0x56>
+  80475d:	83 ec 04             	sub    $0x4,%esp
+  804760:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804764:	56                   	push   %esi
+  804765:	89 ce                	mov    %ecx,%esi
+  804767:	f7 de                	neg    %esi
+  804769:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80476d:	89 de                	mov    %ebx,%esi
+  80476f:	83 d6 00             	adc    $0x0,%esi
+  804772:	f7 de                	neg    %esi
+  804774:	89 74 24 14          	mov    %esi,0x14(%esp)
+  804778:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80477c:	0f 48 f1             	cmovs  %ecx,%esi
+  80477f:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  804784:	53                   	push   %ebx
+  804785:	56                   	push   %esi
+  804786:	e8 f7 fd ff ff       	call   804582 <udm>
+  80478b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80478f:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804793:	83 c4 10             	add    $0x10,%esp
+  804796:	eb 47                	jmp    8047df <__moddi3+0x9d>
+  804798:	f7 d8                	neg    %eax
+  80479a:	83 d2 00             	adc    $0x0,%edx
+  80479d:	f7 da                	neg    %edx
+  80479f:	83 ec 04             	sub    $0x4,%esp
+  8047a2:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8047a6:	56                   	push   %esi
+  8047a7:	89 cf                	mov    %ecx,%edi
+  8047a9:	f7 df                	neg    %edi
+  8047ab:	89 de                	mov    %ebx,%esi
+  8047ad:	83 d6 00             	adc    $0x0,%esi
+  8047b0:	f7 de                	neg    %esi
+  8047b2:	0f 49 cf             	cmovns %edi,%ecx
+  8047b5:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8047b9:	0f 49 de             	cmovns %esi,%ebx
+  8047bc:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  8047c0:	ff 74 24 0c          	push   0xc(%esp)
+  8047c4:	ff 74 24 0c          	push   0xc(%esp)
+  8047c8:	e8 b5 fd ff ff       	call   804582 <udm>
+  8047cd:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8047d1:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8047d5:	f7 d8                	neg    %eax
+  8047d7:	83 d2 00             	adc    $0x0,%edx
+  8047da:	f7 da                	neg    %edx
+  8047dc:	83 c4 10             	add    $0x10,%esp
+  8047df:	83 c4 24             	add    $0x24,%esp
+  8047e2:	5b                   	pop    %ebx
+  8047e3:	5e                   	pop    %esi
+  8047e4:	5f                   	pop    %edi
+  8047e5:	5d                   	pop    %ebp
+  8047e6:	c3                   	ret
@@ -0,0 +1,9887 @@
+
+obj/user/testfdsharing.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 99 01 00 00       	call   8001ca <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+char buf[512], buf2[512];
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 14             	sub    $0x14,%esp
+	int fd, r, n, n2;
+
+	if ((fd = open("motd", O_RDONLY)) < 0)
+  80003c:	6a 00                	push   $0x0
+  80003e:	68 c0 48 80 00       	push   $0x8048c0
+  800043:	e8 8f 21 00 00       	call   8021d7 <open>
+  800048:	89 c3                	mov    %eax,%ebx
+  80004a:	83 c4 10             	add    $0x10,%esp
+  80004d:	85 c0                	test   %eax,%eax
+  80004f:	0f 88 ff 00 00 00    	js     800154 <umain+0x121>
+		panic("open motd: %e", fd);
+	seek(fd, 0);
+  800055:	83 ec 08             	sub    $0x8,%esp
+  800058:	6a 00                	push   $0x0
+  80005a:	50                   	push   %eax
+  80005b:	e8 d3 1c 00 00       	call   801d33 <seek>
+	if ((n = readn(fd, buf, sizeof buf)) <= 0)
+  800060:	83 c4 0c             	add    $0xc,%esp
+  800063:	68 00 02 00 00       	push   $0x200
+  800068:	68 c0 74 80 00       	push   $0x8074c0
+  80006d:	53                   	push   %ebx
+  80006e:	e8 cd 1b 00 00       	call   801c40 <readn>
+  800073:	89 c6                	mov    %eax,%esi
+  800075:	83 c4 10             	add    $0x10,%esp
+  800078:	85 c0                	test   %eax,%eax
+  80007a:	0f 8e e6 00 00 00    	jle    800166 <umain+0x133>
+		panic("readn: %e", n);
+
+	if ((r = fork()) < 0)
+  800080:	e8 a1 13 00 00       	call   801426 <fork>
+  800085:	89 c7                	mov    %eax,%edi
+  800087:	85 c0                	test   %eax,%eax
+  800089:	0f 88 e9 00 00 00    	js     800178 <umain+0x145>
+		panic("fork: %e", r);
+	if (r == 0) {
+  80008f:	75 7b                	jne    80010c <umain+0xd9>
+		seek(fd, 0);
+  800091:	83 ec 08             	sub    $0x8,%esp
+  800094:	6a 00                	push   $0x0
+  800096:	53                   	push   %ebx
+  800097:	e8 97 1c 00 00       	call   801d33 <seek>
+		cprintf("going to read in child (might page fault if your sharing is buggy)\n");
+  80009c:	c7 04 24 30 49 80 00 	movl   $0x804930,(%esp)
+  8000a3:	e8 a0 02 00 00       	call   800348 <cprintf>
+		if ((n2 = readn(fd, buf2, sizeof buf2)) != n)
+  8000a8:	83 c4 0c             	add    $0xc,%esp
+  8000ab:	68 00 02 00 00       	push   $0x200
+  8000b0:	68 c0 72 80 00       	push   $0x8072c0
+  8000b5:	53                   	push   %ebx
+  8000b6:	e8 85 1b 00 00       	call   801c40 <readn>
+  8000bb:	83 c4 10             	add    $0x10,%esp
+  8000be:	39 c6                	cmp    %eax,%esi
+  8000c0:	0f 85 c4 00 00 00    	jne    80018a <umain+0x157>
+			panic("read in parent got %d, read in child got %d", n, n2);
+		if (memcmp(buf, buf2, n) != 0)
+  8000c6:	83 ec 04             	sub    $0x4,%esp
+  8000c9:	56                   	push   %esi
+  8000ca:	68 c0 72 80 00       	push   $0x8072c0
+  8000cf:	68 c0 74 80 00       	push   $0x8074c0
+  8000d4:	e8 51 0a 00 00       	call   800b2a <memcmp>
+  8000d9:	83 c4 10             	add    $0x10,%esp
+  8000dc:	85 c0                	test   %eax,%eax
+  8000de:	0f 85 bc 00 00 00    	jne    8001a0 <umain+0x16d>
+			panic("read in parent got different bytes from read in child");
+		cprintf("read in child succeeded\n");
+  8000e4:	83 ec 0c             	sub    $0xc,%esp
+  8000e7:	68 fb 48 80 00       	push   $0x8048fb
+  8000ec:	e8 57 02 00 00       	call   800348 <cprintf>
+		seek(fd, 0);
+  8000f1:	83 c4 08             	add    $0x8,%esp
+  8000f4:	6a 00                	push   $0x0
+  8000f6:	53                   	push   %ebx
+  8000f7:	e8 37 1c 00 00       	call   801d33 <seek>
+		close(fd);
+  8000fc:	89 1c 24             	mov    %ebx,(%esp)
+  8000ff:	e8 4f 19 00 00       	call   801a53 <close>
+		exit();
+  800104:	e8 3c 01 00 00       	call   800245 <exit>
+  800109:	83 c4 10             	add    $0x10,%esp
+	}
+	wait(r);
+  80010c:	83 ec 0c             	sub    $0xc,%esp
+  80010f:	57                   	push   %edi
+  800110:	e8 1d 39 00 00       	call   803a32 <wait>
+	if ((n2 = readn(fd, buf2, sizeof buf2)) != n)
+  800115:	83 c4 0c             	add    $0xc,%esp
+  800118:	68 00 02 00 00       	push   $0x200
+  80011d:	68 c0 72 80 00       	push   $0x8072c0
+  800122:	53                   	push   %ebx
+  800123:	e8 18 1b 00 00       	call   801c40 <readn>
+  800128:	83 c4 10             	add    $0x10,%esp
+  80012b:	39 c6                	cmp    %eax,%esi
+  80012d:	0f 85 81 00 00 00    	jne    8001b4 <umain+0x181>
+		panic("read in parent got %d, then got %d", n, n2);
+	cprintf("read in parent succeeded\n");
+  800133:	83 ec 0c             	sub    $0xc,%esp
+  800136:	68 14 49 80 00       	push   $0x804914
+  80013b:	e8 08 02 00 00       	call   800348 <cprintf>
+	close(fd);
+  800140:	89 1c 24             	mov    %ebx,(%esp)
+  800143:	e8 0b 19 00 00       	call   801a53 <close>
+#include <inc/types.h>
+
+static inline void
+breakpoint(void)
+{
+	asm volatile("int3");
+  800148:	cc                   	int3
+
+	breakpoint();
+}
+  800149:	83 c4 10             	add    $0x10,%esp
+  80014c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80014f:	5b                   	pop    %ebx
+  800150:	5e                   	pop    %esi
+  800151:	5f                   	pop    %edi
+  800152:	5d                   	pop    %ebp
+  800153:	c3                   	ret
+		panic("open motd: %e", fd);
+  800154:	50                   	push   %eax
+  800155:	68 c5 48 80 00       	push   $0x8048c5
+  80015a:	6a 0c                	push   $0xc
+  80015c:	68 d3 48 80 00       	push   $0x8048d3
+  800161:	e8 07 01 00 00       	call   80026d <_panic>
+		panic("readn: %e", n);
+  800166:	50                   	push   %eax
+  800167:	68 e8 48 80 00       	push   $0x8048e8
+  80016c:	6a 0f                	push   $0xf
+  80016e:	68 d3 48 80 00       	push   $0x8048d3
+  800173:	e8 f5 00 00 00       	call   80026d <_panic>
+		panic("fork: %e", r);
+  800178:	50                   	push   %eax
+  800179:	68 f2 48 80 00       	push   $0x8048f2
+  80017e:	6a 12                	push   $0x12
+  800180:	68 d3 48 80 00       	push   $0x8048d3
+  800185:	e8 e3 00 00 00       	call   80026d <_panic>
+			panic("read in parent got %d, read in child got %d", n, n2);
+  80018a:	83 ec 0c             	sub    $0xc,%esp
+  80018d:	50                   	push   %eax
+  80018e:	56                   	push   %esi
+  80018f:	68 74 49 80 00       	push   $0x804974
+  800194:	6a 17                	push   $0x17
+  800196:	68 d3 48 80 00       	push   $0x8048d3
+  80019b:	e8 cd 00 00 00       	call   80026d <_panic>
+			panic("read in parent got different bytes from read in child");
+  8001a0:	83 ec 04             	sub    $0x4,%esp
+  8001a3:	68 a0 49 80 00       	push   $0x8049a0
+  8001a8:	6a 19                	push   $0x19
+  8001aa:	68 d3 48 80 00       	push   $0x8048d3
+  8001af:	e8 b9 00 00 00       	call   80026d <_panic>
+		panic("read in parent got %d, then got %d", n, n2);
+  8001b4:	83 ec 0c             	sub    $0xc,%esp
+  8001b7:	50                   	push   %eax
+  8001b8:	56                   	push   %esi
+  8001b9:	68 d8 49 80 00       	push   $0x8049d8
+  8001be:	6a 21                	push   $0x21
+  8001c0:	68 d3 48 80 00       	push   $0x8048d3
+  8001c5:	e8 a3 00 00 00       	call   80026d <_panic>
+
+008001ca <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001ca:	55                   	push   %ebp
+  8001cb:	89 e5                	mov    %esp,%ebp
+  8001cd:	57                   	push   %edi
+  8001ce:	56                   	push   %esi
+  8001cf:	53                   	push   %ebx
+  8001d0:	83 ec 1c             	sub    $0x1c,%esp
+  8001d3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001d6:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  8001d9:	e8 34 0b 00 00       	call   800d12 <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  8001de:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  8001e1:	89 15 c0 76 80 00    	mov    %edx,0x8076c0
+	thisenv = &envs[ENVX(eid)];
+  8001e7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001ec:	89 c1                	mov    %eax,%ecx
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  8001ee:	89 e7                	mov    %esp,%edi
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8001f0:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  8001f6:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8001fb:	77 16                	ja     800213 <libmain+0x49>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8001fd:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800202:	29 f8                	sub    %edi,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  800204:	c1 e8 10             	shr    $0x10,%eax
+  800207:	74 0a                	je     800213 <libmain+0x49>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800209:	c1 e0 10             	shl    $0x10,%eax
+  80020c:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800211:	29 c2                	sub    %eax,%edx
+  800213:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  800216:	c1 e0 04             	shl    $0x4,%eax
+  800219:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80021e:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800220:	85 db                	test   %ebx,%ebx
+  800222:	7e 07                	jle    80022b <libmain+0x61>
+		binaryname = argv[0];
+  800224:	8b 06                	mov    (%esi),%eax
+  800226:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// call user main routine
+	umain(argc, argv);
+  80022b:	83 ec 08             	sub    $0x8,%esp
+  80022e:	56                   	push   %esi
+  80022f:	53                   	push   %ebx
+  800230:	e8 fe fd ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800235:	e8 0b 00 00 00       	call   800245 <exit>
+}
+  80023a:	83 c4 10             	add    $0x10,%esp
+  80023d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800240:	5b                   	pop    %ebx
+  800241:	5e                   	pop    %esi
+  800242:	5f                   	pop    %edi
+  800243:	5d                   	pop    %ebp
+  800244:	c3                   	ret
+
+00800245 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800245:	55                   	push   %ebp
+  800246:	89 e5                	mov    %esp,%ebp
+  800248:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  80024b:	6a 00                	push   $0x0
+  80024d:	e8 8b 27 00 00       	call   8029dd <fflush>
+	pthread_kill_others();
+  800252:	e8 47 3e 00 00       	call   80409e <pthread_kill_others>
+	close_all();
+  800257:	e8 24 18 00 00       	call   801a80 <close_all>
+	sys_env_destroy(0);
+  80025c:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800263:	e8 5f 0a 00 00       	call   800cc7 <sys_env_destroy>
+}
+  800268:	83 c4 10             	add    $0x10,%esp
+  80026b:	c9                   	leave
+  80026c:	c3                   	ret
+
+0080026d <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80026d:	55                   	push   %ebp
+  80026e:	89 e5                	mov    %esp,%ebp
+  800270:	56                   	push   %esi
+  800271:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800272:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800275:	8b 35 00 60 80 00    	mov    0x806000,%esi
+  80027b:	e8 92 0a 00 00       	call   800d12 <sys_getenvid>
+  800280:	83 ec 0c             	sub    $0xc,%esp
+  800283:	ff 75 0c             	push   0xc(%ebp)
+  800286:	ff 75 08             	push   0x8(%ebp)
+  800289:	56                   	push   %esi
+  80028a:	50                   	push   %eax
+  80028b:	68 08 4a 80 00       	push   $0x804a08
+  800290:	e8 b3 00 00 00       	call   800348 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800295:	83 c4 18             	add    $0x18,%esp
+  800298:	53                   	push   %ebx
+  800299:	ff 75 10             	push   0x10(%ebp)
+  80029c:	e8 56 00 00 00       	call   8002f7 <vcprintf>
+	cprintf("\n");
+  8002a1:	c7 04 24 fa 4e 80 00 	movl   $0x804efa,(%esp)
+  8002a8:	e8 9b 00 00 00       	call   800348 <cprintf>
+  8002ad:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8002b0:	cc                   	int3
+	while (1)
+  8002b1:	eb fd                	jmp    8002b0 <_panic+0x43>
+
+008002b3 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8002b3:	55                   	push   %ebp
+  8002b4:	89 e5                	mov    %esp,%ebp
+  8002b6:	53                   	push   %ebx
+  8002b7:	83 ec 04             	sub    $0x4,%esp
+  8002ba:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8002bd:	8b 13                	mov    (%ebx),%edx
+  8002bf:	8d 42 01             	lea    0x1(%edx),%eax
+  8002c2:	89 03                	mov    %eax,(%ebx)
+  8002c4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8002c7:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8002cb:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8002d0:	74 09                	je     8002db <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8002d2:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8002d6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8002d9:	c9                   	leave
+  8002da:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8002db:	83 ec 08             	sub    $0x8,%esp
+  8002de:	68 ff 00 00 00       	push   $0xff
+  8002e3:	8d 43 08             	lea    0x8(%ebx),%eax
+  8002e6:	50                   	push   %eax
+  8002e7:	e8 84 09 00 00       	call   800c70 <sys_cputs>
+		b->idx = 0;
+  8002ec:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8002f2:	83 c4 10             	add    $0x10,%esp
+  8002f5:	eb db                	jmp    8002d2 <putch+0x1f>
+
+008002f7 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8002f7:	55                   	push   %ebp
+  8002f8:	89 e5                	mov    %esp,%ebp
+  8002fa:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800300:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800307:	00 00 00 
+	b.cnt = 0;
+  80030a:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800311:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800314:	ff 75 0c             	push   0xc(%ebp)
+  800317:	ff 75 08             	push   0x8(%ebp)
+  80031a:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800320:	50                   	push   %eax
+  800321:	68 b3 02 80 00       	push   $0x8002b3
+  800326:	e8 14 01 00 00       	call   80043f <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80032b:	83 c4 08             	add    $0x8,%esp
+  80032e:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800334:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80033a:	50                   	push   %eax
+  80033b:	e8 30 09 00 00       	call   800c70 <sys_cputs>
+
+	return b.cnt;
+}
+  800340:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800346:	c9                   	leave
+  800347:	c3                   	ret
+
+00800348 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800348:	55                   	push   %ebp
+  800349:	89 e5                	mov    %esp,%ebp
+  80034b:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80034e:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800351:	50                   	push   %eax
+  800352:	ff 75 08             	push   0x8(%ebp)
+  800355:	e8 9d ff ff ff       	call   8002f7 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80035a:	c9                   	leave
+  80035b:	c3                   	ret
+
+0080035c <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80035c:	55                   	push   %ebp
+  80035d:	89 e5                	mov    %esp,%ebp
+  80035f:	57                   	push   %edi
+  800360:	56                   	push   %esi
+  800361:	53                   	push   %ebx
+  800362:	83 ec 1c             	sub    $0x1c,%esp
+  800365:	89 c7                	mov    %eax,%edi
+  800367:	89 d6                	mov    %edx,%esi
+  800369:	8b 45 08             	mov    0x8(%ebp),%eax
+  80036c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80036f:	89 d1                	mov    %edx,%ecx
+  800371:	89 c2                	mov    %eax,%edx
+  800373:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800376:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800379:	8b 45 10             	mov    0x10(%ebp),%eax
+  80037c:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80037f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800382:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800389:	39 c2                	cmp    %eax,%edx
+  80038b:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80038e:	72 3e                	jb     8003ce <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800390:	83 ec 0c             	sub    $0xc,%esp
+  800393:	ff 75 18             	push   0x18(%ebp)
+  800396:	83 eb 01             	sub    $0x1,%ebx
+  800399:	53                   	push   %ebx
+  80039a:	50                   	push   %eax
+  80039b:	83 ec 08             	sub    $0x8,%esp
+  80039e:	ff 75 e4             	push   -0x1c(%ebp)
+  8003a1:	ff 75 e0             	push   -0x20(%ebp)
+  8003a4:	ff 75 dc             	push   -0x24(%ebp)
+  8003a7:	ff 75 d8             	push   -0x28(%ebp)
+  8003aa:	e8 72 43 00 00       	call   804721 <__udivdi3>
+  8003af:	83 c4 18             	add    $0x18,%esp
+  8003b2:	52                   	push   %edx
+  8003b3:	50                   	push   %eax
+  8003b4:	89 f2                	mov    %esi,%edx
+  8003b6:	89 f8                	mov    %edi,%eax
+  8003b8:	e8 9f ff ff ff       	call   80035c <printnum>
+  8003bd:	83 c4 20             	add    $0x20,%esp
+  8003c0:	eb 13                	jmp    8003d5 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8003c2:	83 ec 08             	sub    $0x8,%esp
+  8003c5:	56                   	push   %esi
+  8003c6:	ff 75 18             	push   0x18(%ebp)
+  8003c9:	ff d7                	call   *%edi
+  8003cb:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8003ce:	83 eb 01             	sub    $0x1,%ebx
+  8003d1:	85 db                	test   %ebx,%ebx
+  8003d3:	7f ed                	jg     8003c2 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8003d5:	83 ec 08             	sub    $0x8,%esp
+  8003d8:	56                   	push   %esi
+  8003d9:	83 ec 04             	sub    $0x4,%esp
+  8003dc:	ff 75 e4             	push   -0x1c(%ebp)
+  8003df:	ff 75 e0             	push   -0x20(%ebp)
+  8003e2:	ff 75 dc             	push   -0x24(%ebp)
+  8003e5:	ff 75 d8             	push   -0x28(%ebp)
+  8003e8:	e8 55 43 00 00       	call   804742 <__umoddi3>
+  8003ed:	83 c4 14             	add    $0x14,%esp
+  8003f0:	0f be 80 2b 4a 80 00 	movsbl 0x804a2b(%eax),%eax
+  8003f7:	50                   	push   %eax
+  8003f8:	ff d7                	call   *%edi
+}
+  8003fa:	83 c4 10             	add    $0x10,%esp
+  8003fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800400:	5b                   	pop    %ebx
+  800401:	5e                   	pop    %esi
+  800402:	5f                   	pop    %edi
+  800403:	5d                   	pop    %ebp
+  800404:	c3                   	ret
+
+00800405 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800405:	55                   	push   %ebp
+  800406:	89 e5                	mov    %esp,%ebp
+  800408:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80040b:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80040f:	8b 10                	mov    (%eax),%edx
+  800411:	3b 50 04             	cmp    0x4(%eax),%edx
+  800414:	73 0a                	jae    800420 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800416:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800419:	89 08                	mov    %ecx,(%eax)
+  80041b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80041e:	88 02                	mov    %al,(%edx)
+}
+  800420:	5d                   	pop    %ebp
+  800421:	c3                   	ret
+
+00800422 <printfmt>:
+{
+  800422:	55                   	push   %ebp
+  800423:	89 e5                	mov    %esp,%ebp
+  800425:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800428:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80042b:	50                   	push   %eax
+  80042c:	ff 75 10             	push   0x10(%ebp)
+  80042f:	ff 75 0c             	push   0xc(%ebp)
+  800432:	ff 75 08             	push   0x8(%ebp)
+  800435:	e8 05 00 00 00       	call   80043f <vprintfmt>
+}
+  80043a:	83 c4 10             	add    $0x10,%esp
+  80043d:	c9                   	leave
+  80043e:	c3                   	ret
+
+0080043f <vprintfmt>:
+{
+  80043f:	55                   	push   %ebp
+  800440:	89 e5                	mov    %esp,%ebp
+  800442:	57                   	push   %edi
+  800443:	56                   	push   %esi
+  800444:	53                   	push   %ebx
+  800445:	83 ec 2c             	sub    $0x2c,%esp
+  800448:	8b 75 08             	mov    0x8(%ebp),%esi
+  80044b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80044e:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800451:	eb 0a                	jmp    80045d <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800453:	83 ec 08             	sub    $0x8,%esp
+  800456:	53                   	push   %ebx
+  800457:	50                   	push   %eax
+  800458:	ff d6                	call   *%esi
+  80045a:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  80045d:	83 c7 01             	add    $0x1,%edi
+  800460:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  800464:	83 f8 25             	cmp    $0x25,%eax
+  800467:	74 0c                	je     800475 <vprintfmt+0x36>
+			if (ch == '\0')
+  800469:	85 c0                	test   %eax,%eax
+  80046b:	75 e6                	jne    800453 <vprintfmt+0x14>
+}
+  80046d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800470:	5b                   	pop    %ebx
+  800471:	5e                   	pop    %esi
+  800472:	5f                   	pop    %edi
+  800473:	5d                   	pop    %ebp
+  800474:	c3                   	ret
+		padc = ' ';
+  800475:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800479:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800480:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800487:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80048e:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  800493:	8d 47 01             	lea    0x1(%edi),%eax
+  800496:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800499:	0f b6 17             	movzbl (%edi),%edx
+  80049c:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80049f:	3c 55                	cmp    $0x55,%al
+  8004a1:	0f 87 c5 03 00 00    	ja     80086c <vprintfmt+0x42d>
+  8004a7:	0f b6 c0             	movzbl %al,%eax
+  8004aa:	ff 24 85 a0 4b 80 00 	jmp    *0x804ba0(,%eax,4)
+  8004b1:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  8004b4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8004b7:	eb da                	jmp    800493 <vprintfmt+0x54>
+  8004b9:	0f be d2             	movsbl %dl,%edx
+  8004bc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8004bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004c4:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8004c7:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8004ca:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8004ce:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8004d1:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8004d4:	83 f9 09             	cmp    $0x9,%ecx
+  8004d7:	77 55                	ja     80052e <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  8004d9:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8004dc:	eb e9                	jmp    8004c7 <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  8004de:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e1:	8b 00                	mov    (%eax),%eax
+  8004e3:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e9:	8d 40 04             	lea    0x4(%eax),%eax
+  8004ec:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  8004ef:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8004f2:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004f6:	79 9b                	jns    800493 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8004f8:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004fb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004fe:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800505:	eb 8c                	jmp    800493 <vprintfmt+0x54>
+			if (width < 0)
+  800507:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80050a:	85 d2                	test   %edx,%edx
+  80050c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800511:	0f 49 c2             	cmovns %edx,%eax
+  800514:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  800517:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80051a:	e9 74 ff ff ff       	jmp    800493 <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  80051f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800522:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800529:	e9 65 ff ff ff       	jmp    800493 <vprintfmt+0x54>
+  80052e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800531:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800534:	eb bc                	jmp    8004f2 <vprintfmt+0xb3>
+			lflag++;
+  800536:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  800539:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80053c:	e9 52 ff ff ff       	jmp    800493 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800541:	8b 45 14             	mov    0x14(%ebp),%eax
+  800544:	8d 78 04             	lea    0x4(%eax),%edi
+  800547:	83 ec 08             	sub    $0x8,%esp
+  80054a:	53                   	push   %ebx
+  80054b:	ff 30                	push   (%eax)
+  80054d:	ff d6                	call   *%esi
+			break;
+  80054f:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800552:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800555:	e9 b1 02 00 00       	jmp    80080b <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  80055a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80055d:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800560:	8b 10                	mov    (%eax),%edx
+  800562:	89 d0                	mov    %edx,%eax
+  800564:	f7 d8                	neg    %eax
+  800566:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800569:	83 f8 14             	cmp    $0x14,%eax
+  80056c:	7f 23                	jg     800591 <vprintfmt+0x152>
+  80056e:	8b 14 85 00 4d 80 00 	mov    0x804d00(,%eax,4),%edx
+  800575:	85 d2                	test   %edx,%edx
+  800577:	74 18                	je     800591 <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  800579:	52                   	push   %edx
+  80057a:	68 43 4f 80 00       	push   $0x804f43
+  80057f:	53                   	push   %ebx
+  800580:	56                   	push   %esi
+  800581:	e8 9c fe ff ff       	call   800422 <printfmt>
+  800586:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800589:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80058c:	e9 7a 02 00 00       	jmp    80080b <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  800591:	50                   	push   %eax
+  800592:	68 43 4a 80 00       	push   $0x804a43
+  800597:	53                   	push   %ebx
+  800598:	56                   	push   %esi
+  800599:	e8 84 fe ff ff       	call   800422 <printfmt>
+  80059e:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005a1:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8005a4:	e9 62 02 00 00       	jmp    80080b <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ac:	83 c0 04             	add    $0x4,%eax
+  8005af:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8005b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b5:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8005b7:	85 c9                	test   %ecx,%ecx
+  8005b9:	b8 3c 4a 80 00       	mov    $0x804a3c,%eax
+  8005be:	0f 45 c1             	cmovne %ecx,%eax
+  8005c1:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8005c4:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005c8:	7e 06                	jle    8005d0 <vprintfmt+0x191>
+  8005ca:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8005ce:	75 0b                	jne    8005db <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005d0:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8005d3:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8005d6:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005d9:	eb 5c                	jmp    800637 <vprintfmt+0x1f8>
+  8005db:	83 ec 08             	sub    $0x8,%esp
+  8005de:	ff 75 d0             	push   -0x30(%ebp)
+  8005e1:	ff 75 cc             	push   -0x34(%ebp)
+  8005e4:	e8 20 03 00 00       	call   800909 <strnlen>
+  8005e9:	89 c2                	mov    %eax,%edx
+  8005eb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005ee:	29 d0                	sub    %edx,%eax
+  8005f0:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8005f3:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8005f7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005fa:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005fd:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005ff:	eb 0e                	jmp    80060f <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  800601:	83 ec 08             	sub    $0x8,%esp
+  800604:	53                   	push   %ebx
+  800605:	57                   	push   %edi
+  800606:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800609:	83 ee 01             	sub    $0x1,%esi
+  80060c:	83 c4 10             	add    $0x10,%esp
+  80060f:	85 f6                	test   %esi,%esi
+  800611:	7f ee                	jg     800601 <vprintfmt+0x1c2>
+  800613:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800616:	8b 75 08             	mov    0x8(%ebp),%esi
+  800619:	85 c0                	test   %eax,%eax
+  80061b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800620:	0f 49 d0             	cmovns %eax,%edx
+  800623:	29 d0                	sub    %edx,%eax
+  800625:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800628:	eb a6                	jmp    8005d0 <vprintfmt+0x191>
+					putch(ch, putdat);
+  80062a:	83 ec 08             	sub    $0x8,%esp
+  80062d:	53                   	push   %ebx
+  80062e:	52                   	push   %edx
+  80062f:	ff 55 08             	call   *0x8(%ebp)
+  800632:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800635:	89 f1                	mov    %esi,%ecx
+  800637:	8d 71 01             	lea    0x1(%ecx),%esi
+  80063a:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80063e:	0f be d0             	movsbl %al,%edx
+  800641:	85 d2                	test   %edx,%edx
+  800643:	74 28                	je     80066d <vprintfmt+0x22e>
+  800645:	85 ff                	test   %edi,%edi
+  800647:	78 05                	js     80064e <vprintfmt+0x20f>
+  800649:	83 ef 01             	sub    $0x1,%edi
+  80064c:	78 30                	js     80067e <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80064e:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800652:	74 d6                	je     80062a <vprintfmt+0x1eb>
+  800654:	0f be c0             	movsbl %al,%eax
+  800657:	83 e8 20             	sub    $0x20,%eax
+  80065a:	83 f8 5e             	cmp    $0x5e,%eax
+  80065d:	76 cb                	jbe    80062a <vprintfmt+0x1eb>
+					putch('?', putdat);
+  80065f:	83 ec 08             	sub    $0x8,%esp
+  800662:	53                   	push   %ebx
+  800663:	6a 3f                	push   $0x3f
+  800665:	ff 55 08             	call   *0x8(%ebp)
+  800668:	83 c4 10             	add    $0x10,%esp
+  80066b:	eb c8                	jmp    800635 <vprintfmt+0x1f6>
+  80066d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800670:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800673:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800676:	01 d0                	add    %edx,%eax
+  800678:	29 c8                	sub    %ecx,%eax
+  80067a:	89 c7                	mov    %eax,%edi
+  80067c:	eb 13                	jmp    800691 <vprintfmt+0x252>
+  80067e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800681:	eb ed                	jmp    800670 <vprintfmt+0x231>
+				putch(' ', putdat);
+  800683:	83 ec 08             	sub    $0x8,%esp
+  800686:	53                   	push   %ebx
+  800687:	6a 20                	push   $0x20
+  800689:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80068b:	83 ef 01             	sub    $0x1,%edi
+  80068e:	83 c4 10             	add    $0x10,%esp
+  800691:	85 ff                	test   %edi,%edi
+  800693:	7f ee                	jg     800683 <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800695:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800698:	89 45 14             	mov    %eax,0x14(%ebp)
+  80069b:	e9 6b 01 00 00       	jmp    80080b <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  8006a0:	83 f9 01             	cmp    $0x1,%ecx
+  8006a3:	7f 1f                	jg     8006c4 <vprintfmt+0x285>
+	else if (lflag)
+  8006a5:	85 c9                	test   %ecx,%ecx
+  8006a7:	74 67                	je     800710 <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  8006a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ac:	8b 00                	mov    (%eax),%eax
+  8006ae:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006b1:	89 c1                	mov    %eax,%ecx
+  8006b3:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006b6:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006bc:	8d 40 04             	lea    0x4(%eax),%eax
+  8006bf:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006c2:	eb 17                	jmp    8006db <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  8006c4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c7:	8b 50 04             	mov    0x4(%eax),%edx
+  8006ca:	8b 00                	mov    (%eax),%eax
+  8006cc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006cf:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d5:	8d 40 08             	lea    0x8(%eax),%eax
+  8006d8:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8006db:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006de:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8006e1:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8006e6:	85 c9                	test   %ecx,%ecx
+  8006e8:	0f 89 03 01 00 00    	jns    8007f1 <vprintfmt+0x3b2>
+				putch('-', putdat);
+  8006ee:	83 ec 08             	sub    $0x8,%esp
+  8006f1:	53                   	push   %ebx
+  8006f2:	6a 2d                	push   $0x2d
+  8006f4:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8006f6:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006f9:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8006fc:	f7 da                	neg    %edx
+  8006fe:	83 d1 00             	adc    $0x0,%ecx
+  800701:	f7 d9                	neg    %ecx
+  800703:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800706:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80070b:	e9 e1 00 00 00       	jmp    8007f1 <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  800710:	8b 45 14             	mov    0x14(%ebp),%eax
+  800713:	8b 00                	mov    (%eax),%eax
+  800715:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800718:	89 c1                	mov    %eax,%ecx
+  80071a:	c1 f9 1f             	sar    $0x1f,%ecx
+  80071d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800720:	8b 45 14             	mov    0x14(%ebp),%eax
+  800723:	8d 40 04             	lea    0x4(%eax),%eax
+  800726:	89 45 14             	mov    %eax,0x14(%ebp)
+  800729:	eb b0                	jmp    8006db <vprintfmt+0x29c>
+	if (lflag >= 2)
+  80072b:	83 f9 01             	cmp    $0x1,%ecx
+  80072e:	7f 1e                	jg     80074e <vprintfmt+0x30f>
+	else if (lflag)
+  800730:	85 c9                	test   %ecx,%ecx
+  800732:	74 32                	je     800766 <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  800734:	8b 45 14             	mov    0x14(%ebp),%eax
+  800737:	8b 10                	mov    (%eax),%edx
+  800739:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80073e:	8d 40 04             	lea    0x4(%eax),%eax
+  800741:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800744:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800749:	e9 a3 00 00 00       	jmp    8007f1 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  80074e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800751:	8b 10                	mov    (%eax),%edx
+  800753:	8b 48 04             	mov    0x4(%eax),%ecx
+  800756:	8d 40 08             	lea    0x8(%eax),%eax
+  800759:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80075c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800761:	e9 8b 00 00 00       	jmp    8007f1 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800766:	8b 45 14             	mov    0x14(%ebp),%eax
+  800769:	8b 10                	mov    (%eax),%edx
+  80076b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800770:	8d 40 04             	lea    0x4(%eax),%eax
+  800773:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800776:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80077b:	eb 74                	jmp    8007f1 <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  80077d:	83 f9 01             	cmp    $0x1,%ecx
+  800780:	7f 1b                	jg     80079d <vprintfmt+0x35e>
+	else if (lflag)
+  800782:	85 c9                	test   %ecx,%ecx
+  800784:	74 2c                	je     8007b2 <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  800786:	8b 45 14             	mov    0x14(%ebp),%eax
+  800789:	8b 10                	mov    (%eax),%edx
+  80078b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800790:	8d 40 04             	lea    0x4(%eax),%eax
+  800793:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800796:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  80079b:	eb 54                	jmp    8007f1 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  80079d:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a0:	8b 10                	mov    (%eax),%edx
+  8007a2:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007a5:	8d 40 08             	lea    0x8(%eax),%eax
+  8007a8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007ab:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8007b0:	eb 3f                	jmp    8007f1 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8007b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b5:	8b 10                	mov    (%eax),%edx
+  8007b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007bc:	8d 40 04             	lea    0x4(%eax),%eax
+  8007bf:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007c2:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8007c7:	eb 28                	jmp    8007f1 <vprintfmt+0x3b2>
+			putch('0', putdat);
+  8007c9:	83 ec 08             	sub    $0x8,%esp
+  8007cc:	53                   	push   %ebx
+  8007cd:	6a 30                	push   $0x30
+  8007cf:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8007d1:	83 c4 08             	add    $0x8,%esp
+  8007d4:	53                   	push   %ebx
+  8007d5:	6a 78                	push   $0x78
+  8007d7:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8007d9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007dc:	8b 10                	mov    (%eax),%edx
+  8007de:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8007e3:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8007e6:	8d 40 04             	lea    0x4(%eax),%eax
+  8007e9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007ec:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8007f1:	83 ec 0c             	sub    $0xc,%esp
+  8007f4:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8007f8:	50                   	push   %eax
+  8007f9:	ff 75 e0             	push   -0x20(%ebp)
+  8007fc:	57                   	push   %edi
+  8007fd:	51                   	push   %ecx
+  8007fe:	52                   	push   %edx
+  8007ff:	89 da                	mov    %ebx,%edx
+  800801:	89 f0                	mov    %esi,%eax
+  800803:	e8 54 fb ff ff       	call   80035c <printnum>
+			break;
+  800808:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80080b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  80080e:	e9 4a fc ff ff       	jmp    80045d <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800813:	83 f9 01             	cmp    $0x1,%ecx
+  800816:	7f 1b                	jg     800833 <vprintfmt+0x3f4>
+	else if (lflag)
+  800818:	85 c9                	test   %ecx,%ecx
+  80081a:	74 2c                	je     800848 <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  80081c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80081f:	8b 10                	mov    (%eax),%edx
+  800821:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800826:	8d 40 04             	lea    0x4(%eax),%eax
+  800829:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80082c:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800831:	eb be                	jmp    8007f1 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800833:	8b 45 14             	mov    0x14(%ebp),%eax
+  800836:	8b 10                	mov    (%eax),%edx
+  800838:	8b 48 04             	mov    0x4(%eax),%ecx
+  80083b:	8d 40 08             	lea    0x8(%eax),%eax
+  80083e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800841:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800846:	eb a9                	jmp    8007f1 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800848:	8b 45 14             	mov    0x14(%ebp),%eax
+  80084b:	8b 10                	mov    (%eax),%edx
+  80084d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800852:	8d 40 04             	lea    0x4(%eax),%eax
+  800855:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800858:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80085d:	eb 92                	jmp    8007f1 <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  80085f:	83 ec 08             	sub    $0x8,%esp
+  800862:	53                   	push   %ebx
+  800863:	6a 25                	push   $0x25
+  800865:	ff d6                	call   *%esi
+			break;
+  800867:	83 c4 10             	add    $0x10,%esp
+  80086a:	eb 9f                	jmp    80080b <vprintfmt+0x3cc>
+			putch('%', putdat);
+  80086c:	83 ec 08             	sub    $0x8,%esp
+  80086f:	53                   	push   %ebx
+  800870:	6a 25                	push   $0x25
+  800872:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800874:	83 c4 10             	add    $0x10,%esp
+  800877:	89 f8                	mov    %edi,%eax
+  800879:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80087d:	74 05                	je     800884 <vprintfmt+0x445>
+  80087f:	83 e8 01             	sub    $0x1,%eax
+  800882:	eb f5                	jmp    800879 <vprintfmt+0x43a>
+  800884:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800887:	eb 82                	jmp    80080b <vprintfmt+0x3cc>
+
+00800889 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800889:	55                   	push   %ebp
+  80088a:	89 e5                	mov    %esp,%ebp
+  80088c:	83 ec 18             	sub    $0x18,%esp
+  80088f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800892:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800895:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800898:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80089c:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80089f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8008a6:	85 c0                	test   %eax,%eax
+  8008a8:	74 26                	je     8008d0 <vsnprintf+0x47>
+  8008aa:	85 d2                	test   %edx,%edx
+  8008ac:	7e 22                	jle    8008d0 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8008ae:	ff 75 14             	push   0x14(%ebp)
+  8008b1:	ff 75 10             	push   0x10(%ebp)
+  8008b4:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8008b7:	50                   	push   %eax
+  8008b8:	68 05 04 80 00       	push   $0x800405
+  8008bd:	e8 7d fb ff ff       	call   80043f <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8008c2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8008c5:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8008c8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008cb:	83 c4 10             	add    $0x10,%esp
+}
+  8008ce:	c9                   	leave
+  8008cf:	c3                   	ret
+		return -E_INVAL;
+  8008d0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008d5:	eb f7                	jmp    8008ce <vsnprintf+0x45>
+
+008008d7 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8008d7:	55                   	push   %ebp
+  8008d8:	89 e5                	mov    %esp,%ebp
+  8008da:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8008dd:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8008e0:	50                   	push   %eax
+  8008e1:	ff 75 10             	push   0x10(%ebp)
+  8008e4:	ff 75 0c             	push   0xc(%ebp)
+  8008e7:	ff 75 08             	push   0x8(%ebp)
+  8008ea:	e8 9a ff ff ff       	call   800889 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8008ef:	c9                   	leave
+  8008f0:	c3                   	ret
+
+008008f1 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8008f1:	55                   	push   %ebp
+  8008f2:	89 e5                	mov    %esp,%ebp
+  8008f4:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8008f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008fc:	eb 03                	jmp    800901 <strlen+0x10>
+		n++;
+  8008fe:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800901:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800905:	75 f7                	jne    8008fe <strlen+0xd>
+	return n;
+}
+  800907:	5d                   	pop    %ebp
+  800908:	c3                   	ret
+
+00800909 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800909:	55                   	push   %ebp
+  80090a:	89 e5                	mov    %esp,%ebp
+  80090c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80090f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800912:	b8 00 00 00 00       	mov    $0x0,%eax
+  800917:	eb 03                	jmp    80091c <strnlen+0x13>
+		n++;
+  800919:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80091c:	39 d0                	cmp    %edx,%eax
+  80091e:	74 08                	je     800928 <strnlen+0x1f>
+  800920:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800924:	75 f3                	jne    800919 <strnlen+0x10>
+  800926:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800928:	89 d0                	mov    %edx,%eax
+  80092a:	5d                   	pop    %ebp
+  80092b:	c3                   	ret
+
+0080092c <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80092c:	55                   	push   %ebp
+  80092d:	89 e5                	mov    %esp,%ebp
+  80092f:	53                   	push   %ebx
+  800930:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800933:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800936:	b8 00 00 00 00       	mov    $0x0,%eax
+  80093b:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80093f:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800942:	83 c0 01             	add    $0x1,%eax
+  800945:	84 d2                	test   %dl,%dl
+  800947:	75 f2                	jne    80093b <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800949:	89 c8                	mov    %ecx,%eax
+  80094b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80094e:	c9                   	leave
+  80094f:	c3                   	ret
+
+00800950 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800950:	55                   	push   %ebp
+  800951:	89 e5                	mov    %esp,%ebp
+  800953:	53                   	push   %ebx
+  800954:	83 ec 10             	sub    $0x10,%esp
+  800957:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80095a:	53                   	push   %ebx
+  80095b:	e8 91 ff ff ff       	call   8008f1 <strlen>
+  800960:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800963:	ff 75 0c             	push   0xc(%ebp)
+  800966:	01 d8                	add    %ebx,%eax
+  800968:	50                   	push   %eax
+  800969:	e8 be ff ff ff       	call   80092c <strcpy>
+	return dst;
+}
+  80096e:	89 d8                	mov    %ebx,%eax
+  800970:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800973:	c9                   	leave
+  800974:	c3                   	ret
+
+00800975 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800975:	55                   	push   %ebp
+  800976:	89 e5                	mov    %esp,%ebp
+  800978:	56                   	push   %esi
+  800979:	53                   	push   %ebx
+  80097a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80097d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800980:	89 f3                	mov    %esi,%ebx
+  800982:	03 5d 10             	add    0x10(%ebp),%ebx
+  800985:	89 f0                	mov    %esi,%eax
+  800987:	eb 0f                	jmp    800998 <strncpy+0x23>
+		*dst++ = *src;
+  800989:	83 c0 01             	add    $0x1,%eax
+  80098c:	0f b6 0a             	movzbl (%edx),%ecx
+  80098f:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800992:	80 f9 01             	cmp    $0x1,%cl
+  800995:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800998:	39 d8                	cmp    %ebx,%eax
+  80099a:	75 ed                	jne    800989 <strncpy+0x14>
+	}
+	return ret;
+}
+  80099c:	89 f0                	mov    %esi,%eax
+  80099e:	5b                   	pop    %ebx
+  80099f:	5e                   	pop    %esi
+  8009a0:	5d                   	pop    %ebp
+  8009a1:	c3                   	ret
+
+008009a2 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8009a2:	55                   	push   %ebp
+  8009a3:	89 e5                	mov    %esp,%ebp
+  8009a5:	56                   	push   %esi
+  8009a6:	53                   	push   %ebx
+  8009a7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009aa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009ad:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8009b0:	89 f0                	mov    %esi,%eax
+  8009b2:	85 d2                	test   %edx,%edx
+  8009b4:	74 21                	je     8009d7 <strlcpy+0x35>
+  8009b6:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8009ba:	89 f2                	mov    %esi,%edx
+  8009bc:	eb 09                	jmp    8009c7 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8009be:	83 c1 01             	add    $0x1,%ecx
+  8009c1:	83 c2 01             	add    $0x1,%edx
+  8009c4:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8009c7:	39 c2                	cmp    %eax,%edx
+  8009c9:	74 09                	je     8009d4 <strlcpy+0x32>
+  8009cb:	0f b6 19             	movzbl (%ecx),%ebx
+  8009ce:	84 db                	test   %bl,%bl
+  8009d0:	75 ec                	jne    8009be <strlcpy+0x1c>
+  8009d2:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8009d4:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8009d7:	29 f0                	sub    %esi,%eax
+}
+  8009d9:	5b                   	pop    %ebx
+  8009da:	5e                   	pop    %esi
+  8009db:	5d                   	pop    %ebp
+  8009dc:	c3                   	ret
+
+008009dd <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8009dd:	55                   	push   %ebp
+  8009de:	89 e5                	mov    %esp,%ebp
+  8009e0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009e3:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8009e6:	eb 06                	jmp    8009ee <strcmp+0x11>
+		p++, q++;
+  8009e8:	83 c1 01             	add    $0x1,%ecx
+  8009eb:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8009ee:	0f b6 01             	movzbl (%ecx),%eax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	74 04                	je     8009f9 <strcmp+0x1c>
+  8009f5:	3a 02                	cmp    (%edx),%al
+  8009f7:	74 ef                	je     8009e8 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009f9:	0f b6 c0             	movzbl %al,%eax
+  8009fc:	0f b6 12             	movzbl (%edx),%edx
+  8009ff:	29 d0                	sub    %edx,%eax
+}
+  800a01:	5d                   	pop    %ebp
+  800a02:	c3                   	ret
+
+00800a03 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800a03:	55                   	push   %ebp
+  800a04:	89 e5                	mov    %esp,%ebp
+  800a06:	53                   	push   %ebx
+  800a07:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a0a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a0d:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800a10:	eb 09                	jmp    800a1b <strncmp+0x18>
+		n--, p++, q++;
+  800a12:	83 ea 01             	sub    $0x1,%edx
+  800a15:	83 c0 01             	add    $0x1,%eax
+  800a18:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800a1b:	85 d2                	test   %edx,%edx
+  800a1d:	74 18                	je     800a37 <strncmp+0x34>
+  800a1f:	0f b6 18             	movzbl (%eax),%ebx
+  800a22:	84 db                	test   %bl,%bl
+  800a24:	74 04                	je     800a2a <strncmp+0x27>
+  800a26:	3a 19                	cmp    (%ecx),%bl
+  800a28:	74 e8                	je     800a12 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a2a:	0f b6 00             	movzbl (%eax),%eax
+  800a2d:	0f b6 11             	movzbl (%ecx),%edx
+  800a30:	29 d0                	sub    %edx,%eax
+}
+  800a32:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a35:	c9                   	leave
+  800a36:	c3                   	ret
+		return 0;
+  800a37:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a3c:	eb f4                	jmp    800a32 <strncmp+0x2f>
+
+00800a3e <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a3e:	55                   	push   %ebp
+  800a3f:	89 e5                	mov    %esp,%ebp
+  800a41:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a44:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a48:	eb 03                	jmp    800a4d <strchr+0xf>
+  800a4a:	83 c0 01             	add    $0x1,%eax
+  800a4d:	0f b6 10             	movzbl (%eax),%edx
+  800a50:	84 d2                	test   %dl,%dl
+  800a52:	74 06                	je     800a5a <strchr+0x1c>
+		if (*s == c)
+  800a54:	38 ca                	cmp    %cl,%dl
+  800a56:	75 f2                	jne    800a4a <strchr+0xc>
+  800a58:	eb 05                	jmp    800a5f <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800a5a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a5f:	5d                   	pop    %ebp
+  800a60:	c3                   	ret
+
+00800a61 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a61:	55                   	push   %ebp
+  800a62:	89 e5                	mov    %esp,%ebp
+  800a64:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a67:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a6b:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a6e:	38 ca                	cmp    %cl,%dl
+  800a70:	74 09                	je     800a7b <strfind+0x1a>
+  800a72:	84 d2                	test   %dl,%dl
+  800a74:	74 05                	je     800a7b <strfind+0x1a>
+	for (; *s; s++)
+  800a76:	83 c0 01             	add    $0x1,%eax
+  800a79:	eb f0                	jmp    800a6b <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a7b:	5d                   	pop    %ebp
+  800a7c:	c3                   	ret
+
+00800a7d <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a7d:	55                   	push   %ebp
+  800a7e:	89 e5                	mov    %esp,%ebp
+  800a80:	57                   	push   %edi
+  800a81:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a84:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a87:	85 c9                	test   %ecx,%ecx
+  800a89:	74 20                	je     800aab <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a8b:	89 f8                	mov    %edi,%eax
+  800a8d:	09 c8                	or     %ecx,%eax
+  800a8f:	a8 03                	test   $0x3,%al
+  800a91:	75 12                	jne    800aa5 <memset+0x28>
+		c &= 0xFF;
+  800a93:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a97:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a9d:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800aa0:	fc                   	cld
+  800aa1:	f3 ab                	rep stos %eax,%es:(%edi)
+  800aa3:	eb 06                	jmp    800aab <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800aa5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800aa8:	fc                   	cld
+  800aa9:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800aab:	89 f8                	mov    %edi,%eax
+  800aad:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800ab0:	c9                   	leave
+  800ab1:	c3                   	ret
+
+00800ab2 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800ab2:	55                   	push   %ebp
+  800ab3:	89 e5                	mov    %esp,%ebp
+  800ab5:	57                   	push   %edi
+  800ab6:	56                   	push   %esi
+  800ab7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aba:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800abd:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800ac0:	39 c6                	cmp    %eax,%esi
+  800ac2:	73 32                	jae    800af6 <memmove+0x44>
+  800ac4:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800ac7:	39 d0                	cmp    %edx,%eax
+  800ac9:	73 2b                	jae    800af6 <memmove+0x44>
+		s += n;
+		d += n;
+  800acb:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ace:	89 d6                	mov    %edx,%esi
+  800ad0:	09 fe                	or     %edi,%esi
+  800ad2:	09 ce                	or     %ecx,%esi
+  800ad4:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800ada:	75 0e                	jne    800aea <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800adc:	83 ef 04             	sub    $0x4,%edi
+  800adf:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800ae2:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800ae5:	fd                   	std
+  800ae6:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ae8:	eb 09                	jmp    800af3 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800aea:	83 ef 01             	sub    $0x1,%edi
+  800aed:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800af0:	fd                   	std
+  800af1:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800af3:	fc                   	cld
+  800af4:	eb 1a                	jmp    800b10 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800af6:	89 f2                	mov    %esi,%edx
+  800af8:	09 c2                	or     %eax,%edx
+  800afa:	09 ca                	or     %ecx,%edx
+  800afc:	f6 c2 03             	test   $0x3,%dl
+  800aff:	75 0a                	jne    800b0b <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800b01:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800b04:	89 c7                	mov    %eax,%edi
+  800b06:	fc                   	cld
+  800b07:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b09:	eb 05                	jmp    800b10 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800b0b:	89 c7                	mov    %eax,%edi
+  800b0d:	fc                   	cld
+  800b0e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800b10:	5e                   	pop    %esi
+  800b11:	5f                   	pop    %edi
+  800b12:	5d                   	pop    %ebp
+  800b13:	c3                   	ret
+
+00800b14 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800b14:	55                   	push   %ebp
+  800b15:	89 e5                	mov    %esp,%ebp
+  800b17:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800b1a:	ff 75 10             	push   0x10(%ebp)
+  800b1d:	ff 75 0c             	push   0xc(%ebp)
+  800b20:	ff 75 08             	push   0x8(%ebp)
+  800b23:	e8 8a ff ff ff       	call   800ab2 <memmove>
+}
+  800b28:	c9                   	leave
+  800b29:	c3                   	ret
+
+00800b2a <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800b2a:	55                   	push   %ebp
+  800b2b:	89 e5                	mov    %esp,%ebp
+  800b2d:	56                   	push   %esi
+  800b2e:	53                   	push   %ebx
+  800b2f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b32:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800b35:	89 c6                	mov    %eax,%esi
+  800b37:	03 75 10             	add    0x10(%ebp),%esi
+  800b3a:	eb 06                	jmp    800b42 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b3c:	83 c0 01             	add    $0x1,%eax
+  800b3f:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b42:	39 f0                	cmp    %esi,%eax
+  800b44:	74 14                	je     800b5a <memcmp+0x30>
+		if (*s1 != *s2)
+  800b46:	0f b6 08             	movzbl (%eax),%ecx
+  800b49:	0f b6 1a             	movzbl (%edx),%ebx
+  800b4c:	38 d9                	cmp    %bl,%cl
+  800b4e:	74 ec                	je     800b3c <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800b50:	0f b6 c1             	movzbl %cl,%eax
+  800b53:	0f b6 db             	movzbl %bl,%ebx
+  800b56:	29 d8                	sub    %ebx,%eax
+  800b58:	eb 05                	jmp    800b5f <memcmp+0x35>
+	}
+
+	return 0;
+  800b5a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b5f:	5b                   	pop    %ebx
+  800b60:	5e                   	pop    %esi
+  800b61:	5d                   	pop    %ebp
+  800b62:	c3                   	ret
+
+00800b63 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b63:	55                   	push   %ebp
+  800b64:	89 e5                	mov    %esp,%ebp
+  800b66:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b69:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b6c:	89 c2                	mov    %eax,%edx
+  800b6e:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b71:	eb 03                	jmp    800b76 <memfind+0x13>
+  800b73:	83 c0 01             	add    $0x1,%eax
+  800b76:	39 d0                	cmp    %edx,%eax
+  800b78:	73 04                	jae    800b7e <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b7a:	38 08                	cmp    %cl,(%eax)
+  800b7c:	75 f5                	jne    800b73 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b7e:	5d                   	pop    %ebp
+  800b7f:	c3                   	ret
+
+00800b80 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b80:	55                   	push   %ebp
+  800b81:	89 e5                	mov    %esp,%ebp
+  800b83:	57                   	push   %edi
+  800b84:	56                   	push   %esi
+  800b85:	53                   	push   %ebx
+  800b86:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b89:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b8c:	eb 03                	jmp    800b91 <strtol+0x11>
+		s++;
+  800b8e:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800b91:	0f b6 02             	movzbl (%edx),%eax
+  800b94:	3c 20                	cmp    $0x20,%al
+  800b96:	74 f6                	je     800b8e <strtol+0xe>
+  800b98:	3c 09                	cmp    $0x9,%al
+  800b9a:	74 f2                	je     800b8e <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b9c:	3c 2b                	cmp    $0x2b,%al
+  800b9e:	74 2a                	je     800bca <strtol+0x4a>
+	int neg = 0;
+  800ba0:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800ba5:	3c 2d                	cmp    $0x2d,%al
+  800ba7:	74 2b                	je     800bd4 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ba9:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800baf:	75 0f                	jne    800bc0 <strtol+0x40>
+  800bb1:	80 3a 30             	cmpb   $0x30,(%edx)
+  800bb4:	74 28                	je     800bde <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800bb6:	85 db                	test   %ebx,%ebx
+  800bb8:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800bbd:	0f 44 d8             	cmove  %eax,%ebx
+  800bc0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bc5:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800bc8:	eb 46                	jmp    800c10 <strtol+0x90>
+		s++;
+  800bca:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800bcd:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bd2:	eb d5                	jmp    800ba9 <strtol+0x29>
+		s++, neg = 1;
+  800bd4:	83 c2 01             	add    $0x1,%edx
+  800bd7:	bf 01 00 00 00       	mov    $0x1,%edi
+  800bdc:	eb cb                	jmp    800ba9 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bde:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800be2:	74 0e                	je     800bf2 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800be4:	85 db                	test   %ebx,%ebx
+  800be6:	75 d8                	jne    800bc0 <strtol+0x40>
+		s++, base = 8;
+  800be8:	83 c2 01             	add    $0x1,%edx
+  800beb:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800bf0:	eb ce                	jmp    800bc0 <strtol+0x40>
+		s += 2, base = 16;
+  800bf2:	83 c2 02             	add    $0x2,%edx
+  800bf5:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800bfa:	eb c4                	jmp    800bc0 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800bfc:	0f be c0             	movsbl %al,%eax
+  800bff:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800c02:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800c05:	7d 3a                	jge    800c41 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800c07:	83 c2 01             	add    $0x1,%edx
+  800c0a:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800c0e:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800c10:	0f b6 02             	movzbl (%edx),%eax
+  800c13:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800c16:	89 f3                	mov    %esi,%ebx
+  800c18:	80 fb 09             	cmp    $0x9,%bl
+  800c1b:	76 df                	jbe    800bfc <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800c1d:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c20:	89 f3                	mov    %esi,%ebx
+  800c22:	80 fb 19             	cmp    $0x19,%bl
+  800c25:	77 08                	ja     800c2f <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800c27:	0f be c0             	movsbl %al,%eax
+  800c2a:	83 e8 57             	sub    $0x57,%eax
+  800c2d:	eb d3                	jmp    800c02 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c2f:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c32:	89 f3                	mov    %esi,%ebx
+  800c34:	80 fb 19             	cmp    $0x19,%bl
+  800c37:	77 08                	ja     800c41 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800c39:	0f be c0             	movsbl %al,%eax
+  800c3c:	83 e8 37             	sub    $0x37,%eax
+  800c3f:	eb c1                	jmp    800c02 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c41:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c45:	74 05                	je     800c4c <strtol+0xcc>
+		*endptr = (char *) s;
+  800c47:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c4a:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800c4c:	89 c8                	mov    %ecx,%eax
+  800c4e:	f7 d8                	neg    %eax
+  800c50:	85 ff                	test   %edi,%edi
+  800c52:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800c55:	89 c8                	mov    %ecx,%eax
+  800c57:	5b                   	pop    %ebx
+  800c58:	5e                   	pop    %esi
+  800c59:	5f                   	pop    %edi
+  800c5a:	5d                   	pop    %ebp
+  800c5b:	c3                   	ret
+
+00800c5c <atoi>:
+
+int
+atoi(const char* s)
+{
+  800c5c:	55                   	push   %ebp
+  800c5d:	89 e5                	mov    %esp,%ebp
+  800c5f:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  800c62:	6a 00                	push   $0x0
+  800c64:	6a 00                	push   $0x0
+  800c66:	ff 75 08             	push   0x8(%ebp)
+  800c69:	e8 12 ff ff ff       	call   800b80 <strtol>
+}
+  800c6e:	c9                   	leave
+  800c6f:	c3                   	ret
+
+00800c70 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c70:	55                   	push   %ebp
+  800c71:	89 e5                	mov    %esp,%ebp
+  800c73:	57                   	push   %edi
+  800c74:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c75:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c7a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c7d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c80:	89 c3                	mov    %eax,%ebx
+  800c82:	89 c7                	mov    %eax,%edi
+  800c84:	6a 00                	push   $0x0
+  800c86:	55                   	push   %ebp
+  800c87:	56                   	push   %esi
+  800c88:	89 e5                	mov    %esp,%ebp
+  800c8a:	8d 35 92 0c 80 00    	lea    0x800c92,%esi
+  800c90:	0f 34                	sysenter
+
+00800c92 <after_sysenter_label_47>:
+  800c92:	5e                   	pop    %esi
+  800c93:	5d                   	pop    %ebp
+  800c94:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c97:	5b                   	pop    %ebx
+  800c98:	5f                   	pop    %edi
+  800c99:	5d                   	pop    %ebp
+  800c9a:	c3                   	ret
+
+00800c9b <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c9b:	55                   	push   %ebp
+  800c9c:	89 e5                	mov    %esp,%ebp
+  800c9e:	57                   	push   %edi
+  800c9f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ca0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ca5:	b8 01 00 00 00       	mov    $0x1,%eax
+  800caa:	89 d1                	mov    %edx,%ecx
+  800cac:	89 d3                	mov    %edx,%ebx
+  800cae:	89 d7                	mov    %edx,%edi
+  800cb0:	6a 00                	push   $0x0
+  800cb2:	55                   	push   %ebp
+  800cb3:	56                   	push   %esi
+  800cb4:	89 e5                	mov    %esp,%ebp
+  800cb6:	8d 35 be 0c 80 00    	lea    0x800cbe,%esi
+  800cbc:	0f 34                	sysenter
+
+00800cbe <after_sysenter_label_128>:
+  800cbe:	5e                   	pop    %esi
+  800cbf:	5d                   	pop    %ebp
+  800cc0:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800cc3:	5b                   	pop    %ebx
+  800cc4:	5f                   	pop    %edi
+  800cc5:	5d                   	pop    %ebp
+  800cc6:	c3                   	ret
+
+00800cc7 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800cc7:	55                   	push   %ebp
+  800cc8:	89 e5                	mov    %esp,%ebp
+  800cca:	57                   	push   %edi
+  800ccb:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ccc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ccf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cd4:	b8 03 00 00 00       	mov    $0x3,%eax
+  800cd9:	89 cb                	mov    %ecx,%ebx
+  800cdb:	89 cf                	mov    %ecx,%edi
+  800cdd:	6a 00                	push   $0x0
+  800cdf:	55                   	push   %ebp
+  800ce0:	56                   	push   %esi
+  800ce1:	89 e5                	mov    %esp,%ebp
+  800ce3:	8d 35 eb 0c 80 00    	lea    0x800ceb,%esi
+  800ce9:	0f 34                	sysenter
+
+00800ceb <after_sysenter_label_212>:
+  800ceb:	5e                   	pop    %esi
+  800cec:	5d                   	pop    %ebp
+  800ced:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800cf0:	85 c0                	test   %eax,%eax
+  800cf2:	7f 07                	jg     800cfb <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800cf4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800cf7:	5b                   	pop    %ebx
+  800cf8:	5f                   	pop    %edi
+  800cf9:	5d                   	pop    %ebp
+  800cfa:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cfb:	83 ec 0c             	sub    $0xc,%esp
+  800cfe:	50                   	push   %eax
+  800cff:	6a 03                	push   $0x3
+  800d01:	68 95 4d 80 00       	push   $0x804d95
+  800d06:	6a 54                	push   $0x54
+  800d08:	68 b2 4d 80 00       	push   $0x804db2
+  800d0d:	e8 5b f5 ff ff       	call   80026d <_panic>
+
+00800d12 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800d12:	55                   	push   %ebp
+  800d13:	89 e5                	mov    %esp,%ebp
+  800d15:	57                   	push   %edi
+  800d16:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d17:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d1c:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d21:	89 d1                	mov    %edx,%ecx
+  800d23:	89 d3                	mov    %edx,%ebx
+  800d25:	89 d7                	mov    %edx,%edi
+  800d27:	6a 00                	push   $0x0
+  800d29:	55                   	push   %ebp
+  800d2a:	56                   	push   %esi
+  800d2b:	89 e5                	mov    %esp,%ebp
+  800d2d:	8d 35 35 0d 80 00    	lea    0x800d35,%esi
+  800d33:	0f 34                	sysenter
+
+00800d35 <after_sysenter_label_309>:
+  800d35:	5e                   	pop    %esi
+  800d36:	5d                   	pop    %ebp
+  800d37:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800d3a:	5b                   	pop    %ebx
+  800d3b:	5f                   	pop    %edi
+  800d3c:	5d                   	pop    %ebp
+  800d3d:	c3                   	ret
+
+00800d3e <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800d3e:	55                   	push   %ebp
+  800d3f:	89 e5                	mov    %esp,%ebp
+  800d41:	57                   	push   %edi
+  800d42:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d43:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d48:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d4d:	89 d1                	mov    %edx,%ecx
+  800d4f:	89 d3                	mov    %edx,%ebx
+  800d51:	89 d7                	mov    %edx,%edi
+  800d53:	6a 00                	push   $0x0
+  800d55:	55                   	push   %ebp
+  800d56:	56                   	push   %esi
+  800d57:	89 e5                	mov    %esp,%ebp
+  800d59:	8d 35 61 0d 80 00    	lea    0x800d61,%esi
+  800d5f:	0f 34                	sysenter
+
+00800d61 <after_sysenter_label_391>:
+  800d61:	5e                   	pop    %esi
+  800d62:	5d                   	pop    %ebp
+  800d63:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d66:	5b                   	pop    %ebx
+  800d67:	5f                   	pop    %edi
+  800d68:	5d                   	pop    %ebp
+  800d69:	c3                   	ret
+
+00800d6a <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d6a:	55                   	push   %ebp
+  800d6b:	89 e5                	mov    %esp,%ebp
+  800d6d:	57                   	push   %edi
+  800d6e:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d6f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d72:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d75:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d7a:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d7f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d82:	6a 00                	push   $0x0
+  800d84:	55                   	push   %ebp
+  800d85:	56                   	push   %esi
+  800d86:	89 e5                	mov    %esp,%ebp
+  800d88:	8d 35 90 0d 80 00    	lea    0x800d90,%esi
+  800d8e:	0f 34                	sysenter
+
+00800d90 <after_sysenter_label_479>:
+  800d90:	5e                   	pop    %esi
+  800d91:	5d                   	pop    %ebp
+  800d92:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d95:	85 c0                	test   %eax,%eax
+  800d97:	7f 07                	jg     800da0 <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d99:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d9c:	5b                   	pop    %ebx
+  800d9d:	5f                   	pop    %edi
+  800d9e:	5d                   	pop    %ebp
+  800d9f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800da0:	83 ec 0c             	sub    $0xc,%esp
+  800da3:	50                   	push   %eax
+  800da4:	6a 04                	push   $0x4
+  800da6:	68 95 4d 80 00       	push   $0x804d95
+  800dab:	6a 54                	push   $0x54
+  800dad:	68 b2 4d 80 00       	push   $0x804db2
+  800db2:	e8 b6 f4 ff ff       	call   80026d <_panic>
+
+00800db7 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800db7:	55                   	push   %ebp
+  800db8:	89 e5                	mov    %esp,%ebp
+  800dba:	57                   	push   %edi
+  800dbb:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800dbc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dbf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dc2:	b8 05 00 00 00       	mov    $0x5,%eax
+  800dc7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dca:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dcd:	ff 75 18             	push   0x18(%ebp)
+  800dd0:	55                   	push   %ebp
+  800dd1:	56                   	push   %esi
+  800dd2:	89 e5                	mov    %esp,%ebp
+  800dd4:	8d 35 dc 0d 80 00    	lea    0x800ddc,%esi
+  800dda:	0f 34                	sysenter
+
+00800ddc <after_sysenter_label_593>:
+  800ddc:	5e                   	pop    %esi
+  800ddd:	5d                   	pop    %ebp
+  800dde:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800de1:	85 c0                	test   %eax,%eax
+  800de3:	7f 07                	jg     800dec <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800de5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800de8:	5b                   	pop    %ebx
+  800de9:	5f                   	pop    %edi
+  800dea:	5d                   	pop    %ebp
+  800deb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dec:	83 ec 0c             	sub    $0xc,%esp
+  800def:	50                   	push   %eax
+  800df0:	6a 05                	push   $0x5
+  800df2:	68 95 4d 80 00       	push   $0x804d95
+  800df7:	6a 54                	push   $0x54
+  800df9:	68 b2 4d 80 00       	push   $0x804db2
+  800dfe:	e8 6a f4 ff ff       	call   80026d <_panic>
+
+00800e03 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e03:	55                   	push   %ebp
+  800e04:	89 e5                	mov    %esp,%ebp
+  800e06:	57                   	push   %edi
+  800e07:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e08:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e0d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e10:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e13:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e18:	89 df                	mov    %ebx,%edi
+  800e1a:	6a 00                	push   $0x0
+  800e1c:	55                   	push   %ebp
+  800e1d:	56                   	push   %esi
+  800e1e:	89 e5                	mov    %esp,%ebp
+  800e20:	8d 35 28 0e 80 00    	lea    0x800e28,%esi
+  800e26:	0f 34                	sysenter
+
+00800e28 <after_sysenter_label_704>:
+  800e28:	5e                   	pop    %esi
+  800e29:	5d                   	pop    %ebp
+  800e2a:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e2d:	85 c0                	test   %eax,%eax
+  800e2f:	7f 07                	jg     800e38 <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e31:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e34:	5b                   	pop    %ebx
+  800e35:	5f                   	pop    %edi
+  800e36:	5d                   	pop    %ebp
+  800e37:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e38:	83 ec 0c             	sub    $0xc,%esp
+  800e3b:	50                   	push   %eax
+  800e3c:	6a 06                	push   $0x6
+  800e3e:	68 95 4d 80 00       	push   $0x804d95
+  800e43:	6a 54                	push   $0x54
+  800e45:	68 b2 4d 80 00       	push   $0x804db2
+  800e4a:	e8 1e f4 ff ff       	call   80026d <_panic>
+
+00800e4f <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e4f:	55                   	push   %ebp
+  800e50:	89 e5                	mov    %esp,%ebp
+  800e52:	57                   	push   %edi
+  800e53:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e54:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e59:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e5c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e5f:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e64:	89 df                	mov    %ebx,%edi
+  800e66:	6a 00                	push   $0x0
+  800e68:	55                   	push   %ebp
+  800e69:	56                   	push   %esi
+  800e6a:	89 e5                	mov    %esp,%ebp
+  800e6c:	8d 35 74 0e 80 00    	lea    0x800e74,%esi
+  800e72:	0f 34                	sysenter
+
+00800e74 <after_sysenter_label_808>:
+  800e74:	5e                   	pop    %esi
+  800e75:	5d                   	pop    %ebp
+  800e76:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e79:	85 c0                	test   %eax,%eax
+  800e7b:	7f 07                	jg     800e84 <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800e7d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e80:	5b                   	pop    %ebx
+  800e81:	5f                   	pop    %edi
+  800e82:	5d                   	pop    %ebp
+  800e83:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e84:	83 ec 0c             	sub    $0xc,%esp
+  800e87:	50                   	push   %eax
+  800e88:	6a 08                	push   $0x8
+  800e8a:	68 95 4d 80 00       	push   $0x804d95
+  800e8f:	6a 54                	push   $0x54
+  800e91:	68 b2 4d 80 00       	push   $0x804db2
+  800e96:	e8 d2 f3 ff ff       	call   80026d <_panic>
+
+00800e9b <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800e9b:	55                   	push   %ebp
+  800e9c:	89 e5                	mov    %esp,%ebp
+  800e9e:	57                   	push   %edi
+  800e9f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ea0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ea5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ea8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eab:	b8 09 00 00 00       	mov    $0x9,%eax
+  800eb0:	89 df                	mov    %ebx,%edi
+  800eb2:	6a 00                	push   $0x0
+  800eb4:	55                   	push   %ebp
+  800eb5:	56                   	push   %esi
+  800eb6:	89 e5                	mov    %esp,%ebp
+  800eb8:	8d 35 c0 0e 80 00    	lea    0x800ec0,%esi
+  800ebe:	0f 34                	sysenter
+
+00800ec0 <after_sysenter_label_912>:
+  800ec0:	5e                   	pop    %esi
+  800ec1:	5d                   	pop    %ebp
+  800ec2:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800ec5:	85 c0                	test   %eax,%eax
+  800ec7:	7f 07                	jg     800ed0 <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800ec9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ecc:	5b                   	pop    %ebx
+  800ecd:	5f                   	pop    %edi
+  800ece:	5d                   	pop    %ebp
+  800ecf:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ed0:	83 ec 0c             	sub    $0xc,%esp
+  800ed3:	50                   	push   %eax
+  800ed4:	6a 09                	push   $0x9
+  800ed6:	68 95 4d 80 00       	push   $0x804d95
+  800edb:	6a 54                	push   $0x54
+  800edd:	68 b2 4d 80 00       	push   $0x804db2
+  800ee2:	e8 86 f3 ff ff       	call   80026d <_panic>
+
+00800ee7 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800ee7:	55                   	push   %ebp
+  800ee8:	89 e5                	mov    %esp,%ebp
+  800eea:	57                   	push   %edi
+  800eeb:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800eec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ef1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef7:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800efc:	89 df                	mov    %ebx,%edi
+  800efe:	6a 00                	push   $0x0
+  800f00:	55                   	push   %ebp
+  800f01:	56                   	push   %esi
+  800f02:	89 e5                	mov    %esp,%ebp
+  800f04:	8d 35 0c 0f 80 00    	lea    0x800f0c,%esi
+  800f0a:	0f 34                	sysenter
+
+00800f0c <after_sysenter_label_1016>:
+  800f0c:	5e                   	pop    %esi
+  800f0d:	5d                   	pop    %ebp
+  800f0e:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800f11:	85 c0                	test   %eax,%eax
+  800f13:	7f 07                	jg     800f1c <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800f15:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f18:	5b                   	pop    %ebx
+  800f19:	5f                   	pop    %edi
+  800f1a:	5d                   	pop    %ebp
+  800f1b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f1c:	83 ec 0c             	sub    $0xc,%esp
+  800f1f:	50                   	push   %eax
+  800f20:	6a 0a                	push   $0xa
+  800f22:	68 95 4d 80 00       	push   $0x804d95
+  800f27:	6a 54                	push   $0x54
+  800f29:	68 b2 4d 80 00       	push   $0x804db2
+  800f2e:	e8 3a f3 ff ff       	call   80026d <_panic>
+
+00800f33 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800f33:	55                   	push   %ebp
+  800f34:	89 e5                	mov    %esp,%ebp
+  800f36:	57                   	push   %edi
+  800f37:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f38:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f3b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f3e:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f43:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f46:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f49:	6a 00                	push   $0x0
+  800f4b:	55                   	push   %ebp
+  800f4c:	56                   	push   %esi
+  800f4d:	89 e5                	mov    %esp,%ebp
+  800f4f:	8d 35 57 0f 80 00    	lea    0x800f57,%esi
+  800f55:	0f 34                	sysenter
+
+00800f57 <after_sysenter_label_1126>:
+  800f57:	5e                   	pop    %esi
+  800f58:	5d                   	pop    %ebp
+  800f59:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800f5c:	5b                   	pop    %ebx
+  800f5d:	5f                   	pop    %edi
+  800f5e:	5d                   	pop    %ebp
+  800f5f:	c3                   	ret
+
+00800f60 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800f60:	55                   	push   %ebp
+  800f61:	89 e5                	mov    %esp,%ebp
+  800f63:	57                   	push   %edi
+  800f64:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f65:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f68:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f6d:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f72:	89 cb                	mov    %ecx,%ebx
+  800f74:	89 cf                	mov    %ecx,%edi
+  800f76:	6a 00                	push   $0x0
+  800f78:	55                   	push   %ebp
+  800f79:	56                   	push   %esi
+  800f7a:	89 e5                	mov    %esp,%ebp
+  800f7c:	8d 35 84 0f 80 00    	lea    0x800f84,%esi
+  800f82:	0f 34                	sysenter
+
+00800f84 <after_sysenter_label_1210>:
+  800f84:	5e                   	pop    %esi
+  800f85:	5d                   	pop    %ebp
+  800f86:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800f89:	85 c0                	test   %eax,%eax
+  800f8b:	7f 07                	jg     800f94 <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800f8d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f90:	5b                   	pop    %ebx
+  800f91:	5f                   	pop    %edi
+  800f92:	5d                   	pop    %ebp
+  800f93:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f94:	83 ec 0c             	sub    $0xc,%esp
+  800f97:	50                   	push   %eax
+  800f98:	6a 0d                	push   $0xd
+  800f9a:	68 95 4d 80 00       	push   $0x804d95
+  800f9f:	6a 54                	push   $0x54
+  800fa1:	68 b2 4d 80 00       	push   $0x804db2
+  800fa6:	e8 c2 f2 ff ff       	call   80026d <_panic>
+
+00800fab <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  800fab:	55                   	push   %ebp
+  800fac:	89 e5                	mov    %esp,%ebp
+  800fae:	57                   	push   %edi
+  800faf:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fb0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fb5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fbb:	b8 42 00 00 00       	mov    $0x42,%eax
+  800fc0:	89 df                	mov    %ebx,%edi
+  800fc2:	6a 00                	push   $0x0
+  800fc4:	55                   	push   %ebp
+  800fc5:	56                   	push   %esi
+  800fc6:	89 e5                	mov    %esp,%ebp
+  800fc8:	8d 35 d0 0f 80 00    	lea    0x800fd0,%esi
+  800fce:	0f 34                	sysenter
+
+00800fd0 <after_sysenter_label_1311>:
+  800fd0:	5e                   	pop    %esi
+  800fd1:	5d                   	pop    %ebp
+  800fd2:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800fd5:	85 c0                	test   %eax,%eax
+  800fd7:	7f 07                	jg     800fe0 <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  800fd9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fdc:	5b                   	pop    %ebx
+  800fdd:	5f                   	pop    %edi
+  800fde:	5d                   	pop    %ebp
+  800fdf:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fe0:	83 ec 0c             	sub    $0xc,%esp
+  800fe3:	50                   	push   %eax
+  800fe4:	6a 42                	push   $0x42
+  800fe6:	68 95 4d 80 00       	push   $0x804d95
+  800feb:	6a 54                	push   $0x54
+  800fed:	68 b2 4d 80 00       	push   $0x804db2
+  800ff2:	e8 76 f2 ff ff       	call   80026d <_panic>
+
+00800ff7 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800ff7:	55                   	push   %ebp
+  800ff8:	89 e5                	mov    %esp,%ebp
+  800ffa:	57                   	push   %edi
+  800ffb:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ffc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801001:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801006:	89 d1                	mov    %edx,%ecx
+  801008:	89 d3                	mov    %edx,%ebx
+  80100a:	89 d7                	mov    %edx,%edi
+  80100c:	6a 00                	push   $0x0
+  80100e:	55                   	push   %ebp
+  80100f:	56                   	push   %esi
+  801010:	89 e5                	mov    %esp,%ebp
+  801012:	8d 35 1a 10 80 00    	lea    0x80101a,%esi
+  801018:	0f 34                	sysenter
+
+0080101a <after_sysenter_label_1411>:
+  80101a:	5e                   	pop    %esi
+  80101b:	5d                   	pop    %ebp
+  80101c:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80101f:	5b                   	pop    %ebx
+  801020:	5f                   	pop    %edi
+  801021:	5d                   	pop    %ebp
+  801022:	c3                   	ret
+
+00801023 <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  801023:	55                   	push   %ebp
+  801024:	89 e5                	mov    %esp,%ebp
+  801026:	57                   	push   %edi
+  801027:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801028:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80102d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801030:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801033:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801038:	89 df                	mov    %ebx,%edi
+  80103a:	6a 00                	push   $0x0
+  80103c:	55                   	push   %ebp
+  80103d:	56                   	push   %esi
+  80103e:	89 e5                	mov    %esp,%ebp
+  801040:	8d 35 48 10 80 00    	lea    0x801048,%esi
+  801046:	0f 34                	sysenter
+
+00801048 <after_sysenter_label_1497>:
+  801048:	5e                   	pop    %esi
+  801049:	5d                   	pop    %ebp
+  80104a:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  80104d:	5b                   	pop    %ebx
+  80104e:	5f                   	pop    %edi
+  80104f:	5d                   	pop    %ebp
+  801050:	c3                   	ret
+
+00801051 <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  801051:	55                   	push   %ebp
+  801052:	89 e5                	mov    %esp,%ebp
+  801054:	57                   	push   %edi
+  801055:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801056:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80105b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80105e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801061:	b8 10 00 00 00       	mov    $0x10,%eax
+  801066:	89 df                	mov    %ebx,%edi
+  801068:	6a 00                	push   $0x0
+  80106a:	55                   	push   %ebp
+  80106b:	56                   	push   %esi
+  80106c:	89 e5                	mov    %esp,%ebp
+  80106e:	8d 35 76 10 80 00    	lea    0x801076,%esi
+  801074:	0f 34                	sysenter
+
+00801076 <after_sysenter_label_1583>:
+  801076:	5e                   	pop    %esi
+  801077:	5d                   	pop    %ebp
+  801078:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  80107b:	5b                   	pop    %ebx
+  80107c:	5f                   	pop    %edi
+  80107d:	5d                   	pop    %ebp
+  80107e:	c3                   	ret
+
+0080107f <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  80107f:	55                   	push   %ebp
+  801080:	89 e5                	mov    %esp,%ebp
+  801082:	57                   	push   %edi
+  801083:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801084:	8b 55 08             	mov    0x8(%ebp),%edx
+  801087:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80108a:	b8 11 00 00 00       	mov    $0x11,%eax
+  80108f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801094:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801097:	6a 00                	push   $0x0
+  801099:	55                   	push   %ebp
+  80109a:	56                   	push   %esi
+  80109b:	89 e5                	mov    %esp,%ebp
+  80109d:	8d 35 a5 10 80 00    	lea    0x8010a5,%esi
+  8010a3:	0f 34                	sysenter
+
+008010a5 <after_sysenter_label_1672>:
+  8010a5:	5e                   	pop    %esi
+  8010a6:	5d                   	pop    %ebp
+  8010a7:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  8010aa:	5b                   	pop    %ebx
+  8010ab:	5f                   	pop    %edi
+  8010ac:	5d                   	pop    %ebp
+  8010ad:	c3                   	ret
+
+008010ae <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  8010ae:	55                   	push   %ebp
+  8010af:	89 e5                	mov    %esp,%ebp
+  8010b1:	57                   	push   %edi
+  8010b2:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010bb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010be:	b8 12 00 00 00       	mov    $0x12,%eax
+  8010c3:	89 df                	mov    %ebx,%edi
+  8010c5:	6a 00                	push   $0x0
+  8010c7:	55                   	push   %ebp
+  8010c8:	56                   	push   %esi
+  8010c9:	89 e5                	mov    %esp,%ebp
+  8010cb:	8d 35 d3 10 80 00    	lea    0x8010d3,%esi
+  8010d1:	0f 34                	sysenter
+
+008010d3 <after_sysenter_label_1758>:
+  8010d3:	5e                   	pop    %esi
+  8010d4:	5d                   	pop    %ebp
+  8010d5:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  8010d8:	5b                   	pop    %ebx
+  8010d9:	5f                   	pop    %edi
+  8010da:	5d                   	pop    %ebp
+  8010db:	c3                   	ret
+
+008010dc <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  8010dc:	55                   	push   %ebp
+  8010dd:	89 e5                	mov    %esp,%ebp
+  8010df:	57                   	push   %edi
+  8010e0:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010e1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010e9:	b8 13 00 00 00       	mov    $0x13,%eax
+  8010ee:	89 cb                	mov    %ecx,%ebx
+  8010f0:	89 cf                	mov    %ecx,%edi
+  8010f2:	6a 00                	push   $0x0
+  8010f4:	55                   	push   %ebp
+  8010f5:	56                   	push   %esi
+  8010f6:	89 e5                	mov    %esp,%ebp
+  8010f8:	8d 35 00 11 80 00    	lea    0x801100,%esi
+  8010fe:	0f 34                	sysenter
+
+00801100 <after_sysenter_label_1842>:
+  801100:	5e                   	pop    %esi
+  801101:	5d                   	pop    %ebp
+  801102:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801105:	85 c0                	test   %eax,%eax
+  801107:	7f 07                	jg     801110 <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  801109:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80110c:	5b                   	pop    %ebx
+  80110d:	5f                   	pop    %edi
+  80110e:	5d                   	pop    %ebp
+  80110f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801110:	83 ec 0c             	sub    $0xc,%esp
+  801113:	50                   	push   %eax
+  801114:	6a 13                	push   $0x13
+  801116:	68 95 4d 80 00       	push   $0x804d95
+  80111b:	6a 54                	push   $0x54
+  80111d:	68 b2 4d 80 00       	push   $0x804db2
+  801122:	e8 46 f1 ff ff       	call   80026d <_panic>
+
+00801127 <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  801127:	55                   	push   %ebp
+  801128:	89 e5                	mov    %esp,%ebp
+  80112a:	57                   	push   %edi
+  80112b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80112c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801131:	b8 14 00 00 00       	mov    $0x14,%eax
+  801136:	89 d1                	mov    %edx,%ecx
+  801138:	89 d3                	mov    %edx,%ebx
+  80113a:	89 d7                	mov    %edx,%edi
+  80113c:	6a 00                	push   $0x0
+  80113e:	55                   	push   %ebp
+  80113f:	56                   	push   %esi
+  801140:	89 e5                	mov    %esp,%ebp
+  801142:	8d 35 4a 11 80 00    	lea    0x80114a,%esi
+  801148:	0f 34                	sysenter
+
+0080114a <after_sysenter_label_1939>:
+  80114a:	5e                   	pop    %esi
+  80114b:	5d                   	pop    %ebp
+  80114c:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  80114f:	5b                   	pop    %ebx
+  801150:	5f                   	pop    %edi
+  801151:	5d                   	pop    %ebp
+  801152:	c3                   	ret
+
+00801153 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  801153:	55                   	push   %ebp
+  801154:	89 e5                	mov    %esp,%ebp
+  801156:	57                   	push   %edi
+  801157:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801158:	8b 55 08             	mov    0x8(%ebp),%edx
+  80115b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80115e:	b8 15 00 00 00       	mov    $0x15,%eax
+  801163:	bf 00 00 00 00       	mov    $0x0,%edi
+  801168:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80116b:	6a 00                	push   $0x0
+  80116d:	55                   	push   %ebp
+  80116e:	56                   	push   %esi
+  80116f:	89 e5                	mov    %esp,%ebp
+  801171:	8d 35 79 11 80 00    	lea    0x801179,%esi
+  801177:	0f 34                	sysenter
+
+00801179 <after_sysenter_label_2028>:
+  801179:	5e                   	pop    %esi
+  80117a:	5d                   	pop    %ebp
+  80117b:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  80117e:	5b                   	pop    %ebx
+  80117f:	5f                   	pop    %edi
+  801180:	5d                   	pop    %ebp
+  801181:	c3                   	ret
+
+00801182 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  801182:	55                   	push   %ebp
+  801183:	89 e5                	mov    %esp,%ebp
+  801185:	57                   	push   %edi
+  801186:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801187:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80118c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80118f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801192:	b8 16 00 00 00       	mov    $0x16,%eax
+  801197:	89 df                	mov    %ebx,%edi
+  801199:	6a 00                	push   $0x0
+  80119b:	55                   	push   %ebp
+  80119c:	56                   	push   %esi
+  80119d:	89 e5                	mov    %esp,%ebp
+  80119f:	8d 35 a7 11 80 00    	lea    0x8011a7,%esi
+  8011a5:	0f 34                	sysenter
+
+008011a7 <after_sysenter_label_2114>:
+  8011a7:	5e                   	pop    %esi
+  8011a8:	5d                   	pop    %ebp
+  8011a9:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  8011ac:	5b                   	pop    %ebx
+  8011ad:	5f                   	pop    %edi
+  8011ae:	5d                   	pop    %ebp
+  8011af:	c3                   	ret
+
+008011b0 <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  8011b0:	55                   	push   %ebp
+  8011b1:	89 e5                	mov    %esp,%ebp
+  8011b3:	57                   	push   %edi
+  8011b4:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8011b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011c0:	b8 17 00 00 00       	mov    $0x17,%eax
+  8011c5:	89 df                	mov    %ebx,%edi
+  8011c7:	6a 00                	push   $0x0
+  8011c9:	55                   	push   %ebp
+  8011ca:	56                   	push   %esi
+  8011cb:	89 e5                	mov    %esp,%ebp
+  8011cd:	8d 35 d5 11 80 00    	lea    0x8011d5,%esi
+  8011d3:	0f 34                	sysenter
+
+008011d5 <after_sysenter_label_2200>:
+  8011d5:	5e                   	pop    %esi
+  8011d6:	5d                   	pop    %ebp
+  8011d7:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  8011da:	5b                   	pop    %ebx
+  8011db:	5f                   	pop    %edi
+  8011dc:	5d                   	pop    %ebp
+  8011dd:	c3                   	ret
+
+008011de <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  8011de:	55                   	push   %ebp
+  8011df:	89 e5                	mov    %esp,%ebp
+  8011e1:	57                   	push   %edi
+  8011e2:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8011e3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011e8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011eb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ee:	b8 18 00 00 00       	mov    $0x18,%eax
+  8011f3:	89 df                	mov    %ebx,%edi
+  8011f5:	6a 00                	push   $0x0
+  8011f7:	55                   	push   %ebp
+  8011f8:	56                   	push   %esi
+  8011f9:	89 e5                	mov    %esp,%ebp
+  8011fb:	8d 35 03 12 80 00    	lea    0x801203,%esi
+  801201:	0f 34                	sysenter
+
+00801203 <after_sysenter_label_2286>:
+  801203:	5e                   	pop    %esi
+  801204:	5d                   	pop    %ebp
+  801205:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  801208:	5b                   	pop    %ebx
+  801209:	5f                   	pop    %edi
+  80120a:	5d                   	pop    %ebp
+  80120b:	c3                   	ret
+
+0080120c <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  80120c:	55                   	push   %ebp
+  80120d:	89 e5                	mov    %esp,%ebp
+  80120f:	57                   	push   %edi
+  801210:	56                   	push   %esi
+  801211:	53                   	push   %ebx
+  801212:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  801215:	89 d6                	mov    %edx,%esi
+  801217:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  80121a:	89 cf                	mov    %ecx,%edi
+  80121c:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  80121f:	89 fa                	mov    %edi,%edx
+  801221:	80 ce 08             	or     $0x8,%dh
+  801224:	f6 c5 08             	test   $0x8,%ch
+  801227:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  80122a:	57                   	push   %edi
+  80122b:	56                   	push   %esi
+  80122c:	50                   	push   %eax
+  80122d:	56                   	push   %esi
+  80122e:	6a 00                	push   $0x0
+  801230:	e8 82 fb ff ff       	call   800db7 <sys_page_map>
+	if (r < 0) {
+  801235:	83 c4 20             	add    $0x20,%esp
+  801238:	85 c0                	test   %eax,%eax
+  80123a:	78 27                	js     801263 <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  80123c:	83 ec 0c             	sub    $0xc,%esp
+  80123f:	57                   	push   %edi
+  801240:	56                   	push   %esi
+  801241:	6a 00                	push   $0x0
+  801243:	56                   	push   %esi
+  801244:	6a 00                	push   $0x0
+  801246:	e8 6c fb ff ff       	call   800db7 <sys_page_map>
+  80124b:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  80124d:	83 c4 20             	add    $0x20,%esp
+  801250:	85 c0                	test   %eax,%eax
+  801252:	78 24                	js     801278 <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  801254:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  801259:	89 d8                	mov    %ebx,%eax
+  80125b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80125e:	5b                   	pop    %ebx
+  80125f:	5e                   	pop    %esi
+  801260:	5f                   	pop    %edi
+  801261:	5d                   	pop    %ebp
+  801262:	c3                   	ret
+  801263:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  801265:	83 ec 08             	sub    $0x8,%esp
+  801268:	50                   	push   %eax
+  801269:	68 c0 4d 80 00       	push   $0x804dc0
+  80126e:	e8 d5 f0 ff ff       	call   800348 <cprintf>
+		return r;
+  801273:	83 c4 10             	add    $0x10,%esp
+  801276:	eb e1                	jmp    801259 <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  801278:	83 ec 08             	sub    $0x8,%esp
+  80127b:	50                   	push   %eax
+  80127c:	68 f0 4d 80 00       	push   $0x804df0
+  801281:	e8 c2 f0 ff ff       	call   800348 <cprintf>
+		return r;
+  801286:	83 c4 10             	add    $0x10,%esp
+  801289:	eb ce                	jmp    801259 <duppage_cow+0x4d>
+
+0080128b <duppage>:
+{
+  80128b:	55                   	push   %ebp
+  80128c:	89 e5                	mov    %esp,%ebp
+  80128e:	53                   	push   %ebx
+  80128f:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  801292:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  801295:	51                   	push   %ecx
+  801296:	52                   	push   %edx
+  801297:	50                   	push   %eax
+  801298:	52                   	push   %edx
+  801299:	6a 00                	push   $0x0
+  80129b:	e8 17 fb ff ff       	call   800db7 <sys_page_map>
+	if (r < 0) {
+  8012a0:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  8012a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  8012a8:	85 c0                	test   %eax,%eax
+  8012aa:	78 07                	js     8012b3 <duppage+0x28>
+}
+  8012ac:	89 d8                	mov    %ebx,%eax
+  8012ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012b1:	c9                   	leave
+  8012b2:	c3                   	ret
+  8012b3:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  8012b5:	83 ec 08             	sub    $0x8,%esp
+  8012b8:	50                   	push   %eax
+  8012b9:	68 c0 4d 80 00       	push   $0x804dc0
+  8012be:	e8 85 f0 ff ff       	call   800348 <cprintf>
+		return r;
+  8012c3:	83 c4 10             	add    $0x10,%esp
+  8012c6:	eb e4                	jmp    8012ac <duppage+0x21>
+
+008012c8 <cow_copy>:
+{
+  8012c8:	55                   	push   %ebp
+  8012c9:	89 e5                	mov    %esp,%ebp
+  8012cb:	56                   	push   %esi
+  8012cc:	53                   	push   %ebx
+  8012cd:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  8012cf:	83 ec 04             	sub    $0x4,%esp
+  8012d2:	6a 07                	push   $0x7
+  8012d4:	68 00 f0 7f 00       	push   $0x7ff000
+  8012d9:	6a 00                	push   $0x0
+  8012db:	e8 8a fa ff ff       	call   800d6a <sys_page_alloc>
+	if (r < 0) {
+  8012e0:	83 c4 10             	add    $0x10,%esp
+  8012e3:	85 c0                	test   %eax,%eax
+  8012e5:	78 58                	js     80133f <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  8012e7:	83 ec 04             	sub    $0x4,%esp
+  8012ea:	68 00 10 00 00       	push   $0x1000
+  8012ef:	56                   	push   %esi
+  8012f0:	68 00 f0 7f 00       	push   $0x7ff000
+  8012f5:	e8 b8 f7 ff ff       	call   800ab2 <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  8012fa:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801301:	56                   	push   %esi
+  801302:	6a 00                	push   $0x0
+  801304:	68 00 f0 7f 00       	push   $0x7ff000
+  801309:	6a 00                	push   $0x0
+  80130b:	e8 a7 fa ff ff       	call   800db7 <sys_page_map>
+  801310:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  801312:	83 c4 20             	add    $0x20,%esp
+  801315:	85 c0                	test   %eax,%eax
+  801317:	78 3b                	js     801354 <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  801319:	83 ec 08             	sub    $0x8,%esp
+  80131c:	68 00 f0 7f 00       	push   $0x7ff000
+  801321:	6a 00                	push   $0x0
+  801323:	e8 db fa ff ff       	call   800e03 <sys_page_unmap>
+  801328:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  80132a:	83 c4 10             	add    $0x10,%esp
+  80132d:	85 c0                	test   %eax,%eax
+  80132f:	78 45                	js     801376 <cow_copy+0xae>
+	return 0;
+  801331:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  801336:	89 d8                	mov    %ebx,%eax
+  801338:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80133b:	5b                   	pop    %ebx
+  80133c:	5e                   	pop    %esi
+  80133d:	5d                   	pop    %ebp
+  80133e:	c3                   	ret
+  80133f:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  801341:	83 ec 08             	sub    $0x8,%esp
+  801344:	50                   	push   %eax
+  801345:	68 e0 4e 80 00       	push   $0x804ee0
+  80134a:	e8 f9 ef ff ff       	call   800348 <cprintf>
+		return r;
+  80134f:	83 c4 10             	add    $0x10,%esp
+  801352:	eb e2                	jmp    801336 <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  801354:	83 ec 08             	sub    $0x8,%esp
+  801357:	50                   	push   %eax
+  801358:	68 fc 4e 80 00       	push   $0x804efc
+  80135d:	e8 e6 ef ff ff       	call   800348 <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  801362:	83 c4 08             	add    $0x8,%esp
+  801365:	68 00 f0 7f 00       	push   $0x7ff000
+  80136a:	6a 00                	push   $0x0
+  80136c:	e8 92 fa ff ff       	call   800e03 <sys_page_unmap>
+		return r;
+  801371:	83 c4 10             	add    $0x10,%esp
+  801374:	eb c0                	jmp    801336 <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  801376:	83 ec 08             	sub    $0x8,%esp
+  801379:	50                   	push   %eax
+  80137a:	68 18 4e 80 00       	push   $0x804e18
+  80137f:	e8 c4 ef ff ff       	call   800348 <cprintf>
+		return r;
+  801384:	83 c4 10             	add    $0x10,%esp
+  801387:	eb ad                	jmp    801336 <cow_copy+0x6e>
+
+00801389 <pgfault>:
+{
+  801389:	55                   	push   %ebp
+  80138a:	89 e5                	mov    %esp,%ebp
+  80138c:	56                   	push   %esi
+  80138d:	53                   	push   %ebx
+  80138e:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  801391:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  801393:	89 d8                	mov    %ebx,%eax
+  801395:	c1 e8 16             	shr    $0x16,%eax
+  801398:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  80139f:	89 de                	mov    %ebx,%esi
+  8013a1:	c1 ee 0c             	shr    $0xc,%esi
+  8013a4:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  8013ab:	a8 07                	test   $0x7,%al
+  8013ad:	74 3b                	je     8013ea <pgfault+0x61>
+  8013af:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  8013b5:	74 33                	je     8013ea <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  8013b7:	83 ec 0c             	sub    $0xc,%esp
+  8013ba:	68 00 f0 bf ee       	push   $0xeebff000
+  8013bf:	e8 cd 26 00 00       	call   803a91 <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  8013c4:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  8013cb:	83 c4 10             	add    $0x10,%esp
+  8013ce:	f6 c4 08             	test   $0x8,%ah
+  8013d1:	75 30                	jne    801403 <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  8013d3:	83 ec 0c             	sub    $0xc,%esp
+  8013d6:	68 00 f0 bf ee       	push   $0xeebff000
+  8013db:	e8 1e 27 00 00       	call   803afe <mutex_unlock>
+}
+  8013e0:	83 c4 10             	add    $0x10,%esp
+  8013e3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013e6:	5b                   	pop    %ebx
+  8013e7:	5e                   	pop    %esi
+  8013e8:	5d                   	pop    %ebp
+  8013e9:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  8013ea:	83 ec 08             	sub    $0x8,%esp
+  8013ed:	ff 72 28             	push   0x28(%edx)
+  8013f0:	51                   	push   %ecx
+  8013f1:	50                   	push   %eax
+  8013f2:	68 3c 4e 80 00       	push   $0x804e3c
+  8013f7:	6a 3f                	push   $0x3f
+  8013f9:	68 16 4f 80 00       	push   $0x804f16
+  8013fe:	e8 6a ee ff ff       	call   80026d <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  801403:	89 d8                	mov    %ebx,%eax
+  801405:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  80140a:	e8 b9 fe ff ff       	call   8012c8 <cow_copy>
+  80140f:	eb c2                	jmp    8013d3 <pgfault+0x4a>
+
+00801411 <cow_enable>:
+{
+  801411:	55                   	push   %ebp
+  801412:	89 e5                	mov    %esp,%ebp
+  801414:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  801417:	68 89 13 80 00       	push   $0x801389
+  80141c:	e8 f0 2f 00 00       	call   804411 <set_pgfault_handler>
+}
+  801421:	83 c4 10             	add    $0x10,%esp
+  801424:	c9                   	leave
+  801425:	c3                   	ret
+
+00801426 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  801426:	55                   	push   %ebp
+  801427:	89 e5                	mov    %esp,%ebp
+  801429:	57                   	push   %edi
+  80142a:	56                   	push   %esi
+  80142b:	53                   	push   %ebx
+  80142c:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  80142f:	68 89 13 80 00       	push   $0x801389
+  801434:	e8 d8 2f 00 00       	call   804411 <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  801439:	b8 07 00 00 00       	mov    $0x7,%eax
+  80143e:	cd 30                	int    $0x30
+  801440:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  801443:	83 c4 10             	add    $0x10,%esp
+  801446:	85 c0                	test   %eax,%eax
+  801448:	78 4b                	js     801495 <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  80144a:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80144f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801454:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  801457:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80145b:	0f 85 16 01 00 00    	jne    801577 <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801461:	e8 ac f8 ff ff       	call   800d12 <sys_getenvid>
+  801466:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80146b:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80146d:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  801473:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  801479:	77 32                	ja     8014ad <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80147b:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  801480:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  801482:	c1 ea 10             	shr    $0x10,%edx
+  801485:	74 26                	je     8014ad <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801487:	c1 e2 10             	shl    $0x10,%edx
+  80148a:	89 d1                	mov    %edx,%ecx
+  80148c:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801491:	29 ca                	sub    %ecx,%edx
+  801493:	eb 1e                	jmp    8014b3 <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  801495:	83 ec 08             	sub    $0x8,%esp
+  801498:	89 c7                	mov    %eax,%edi
+  80149a:	50                   	push   %eax
+  80149b:	68 21 4f 80 00       	push   $0x804f21
+  8014a0:	e8 a3 ee ff ff       	call   800348 <cprintf>
+		return eid;
+  8014a5:	83 c4 10             	add    $0x10,%esp
+  8014a8:	e9 6c 01 00 00       	jmp    801619 <fork+0x1f3>
+		return pthread_main_tls;
+  8014ad:	8b 15 c0 76 80 00    	mov    0x8076c0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8014b3:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8014b6:	c1 e0 04             	shl    $0x4,%eax
+  8014b9:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8014be:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  8014c0:	e8 15 2d 00 00       	call   8041da <pthread_fork_child>
+		return eid;
+  8014c5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8014c8:	e9 4c 01 00 00       	jmp    801619 <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8014cd:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8014d3:	89 da                	mov    %ebx,%edx
+  8014d5:	89 f8                	mov    %edi,%eax
+  8014d7:	e8 af fd ff ff       	call   80128b <duppage>
+  8014dc:	85 c0                	test   %eax,%eax
+  8014de:	79 28                	jns    801508 <fork+0xe2>
+  8014e0:	89 c7                	mov    %eax,%edi
+  8014e2:	e9 32 01 00 00       	jmp    801619 <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  8014e7:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8014ed:	83 f9 05             	cmp    $0x5,%ecx
+  8014f0:	75 58                	jne    80154a <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8014f2:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8014f7:	89 da                	mov    %ebx,%edx
+  8014f9:	89 f8                	mov    %edi,%eax
+  8014fb:	e8 8b fd ff ff       	call   80128b <duppage>
+  801500:	85 c0                	test   %eax,%eax
+  801502:	0f 88 0f 01 00 00    	js     801617 <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  801508:	83 c3 01             	add    $0x1,%ebx
+  80150b:	39 de                	cmp    %ebx,%esi
+  80150d:	74 54                	je     801563 <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  80150f:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  801516:	f6 c1 05             	test   $0x5,%cl
+  801519:	74 ed                	je     801508 <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  80151b:	f6 c5 04             	test   $0x4,%ch
+  80151e:	75 ad                	jne    8014cd <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  801520:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  801526:	74 bf                	je     8014e7 <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  801528:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  80152e:	74 d8                	je     801508 <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  801530:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  801536:	89 da                	mov    %ebx,%edx
+  801538:	89 f8                	mov    %edi,%eax
+  80153a:	e8 cd fc ff ff       	call   80120c <duppage_cow>
+  80153f:	85 c0                	test   %eax,%eax
+  801541:	79 c5                	jns    801508 <fork+0xe2>
+  801543:	89 c7                	mov    %eax,%edi
+  801545:	e9 cf 00 00 00       	jmp    801619 <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  80154a:	68 6c 4e 80 00       	push   $0x804e6c
+  80154f:	68 31 4f 80 00       	push   $0x804f31
+  801554:	68 c6 00 00 00       	push   $0xc6
+  801559:	68 16 4f 80 00       	push   $0x804f16
+  80155e:	e8 0a ed ff ff       	call   80026d <_panic>
+  801563:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  801566:	83 c1 01             	add    $0x1,%ecx
+  801569:	81 c6 00 04 00 00    	add    $0x400,%esi
+  80156f:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  801575:	74 18                	je     80158f <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  801577:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  80157e:	a8 07                	test   $0x7,%al
+  801580:	74 e4                	je     801566 <fork+0x140>
+  801582:	89 cb                	mov    %ecx,%ebx
+  801584:	c1 e3 0a             	shl    $0xa,%ebx
+  801587:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80158a:	e9 7c ff ff ff       	jmp    80150b <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  80158f:	83 ec 04             	sub    $0x4,%esp
+  801592:	6a 07                	push   $0x7
+  801594:	68 00 f0 bf ee       	push   $0xeebff000
+  801599:	ff 75 e4             	push   -0x1c(%ebp)
+  80159c:	e8 c9 f7 ff ff       	call   800d6a <sys_page_alloc>
+  8015a1:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8015a3:	83 c4 10             	add    $0x10,%esp
+  8015a6:	85 c0                	test   %eax,%eax
+  8015a8:	78 34                	js     8015de <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  8015aa:	83 ec 08             	sub    $0x8,%esp
+  8015ad:	68 4f 44 80 00       	push   $0x80444f
+  8015b2:	ff 75 e4             	push   -0x1c(%ebp)
+  8015b5:	e8 2d f9 ff ff       	call   800ee7 <sys_env_set_pgfault_upcall>
+  8015ba:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8015bc:	83 c4 10             	add    $0x10,%esp
+  8015bf:	85 c0                	test   %eax,%eax
+  8015c1:	78 2e                	js     8015f1 <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  8015c3:	83 ec 08             	sub    $0x8,%esp
+  8015c6:	6a 02                	push   $0x2
+  8015c8:	ff 75 e4             	push   -0x1c(%ebp)
+  8015cb:	e8 7f f8 ff ff       	call   800e4f <sys_env_set_status>
+  8015d0:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8015d2:	83 c4 10             	add    $0x10,%esp
+  8015d5:	85 c0                	test   %eax,%eax
+  8015d7:	78 2b                	js     801604 <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  8015d9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8015dc:	eb 3b                	jmp    801619 <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  8015de:	83 ec 08             	sub    $0x8,%esp
+  8015e1:	50                   	push   %eax
+  8015e2:	68 94 4e 80 00       	push   $0x804e94
+  8015e7:	e8 5c ed ff ff       	call   800348 <cprintf>
+		return r;
+  8015ec:	83 c4 10             	add    $0x10,%esp
+  8015ef:	eb 28                	jmp    801619 <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  8015f1:	83 ec 08             	sub    $0x8,%esp
+  8015f4:	50                   	push   %eax
+  8015f5:	68 bc 4e 80 00       	push   $0x804ebc
+  8015fa:	e8 49 ed ff ff       	call   800348 <cprintf>
+		return r;
+  8015ff:	83 c4 10             	add    $0x10,%esp
+  801602:	eb 15                	jmp    801619 <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  801604:	83 ec 08             	sub    $0x8,%esp
+  801607:	50                   	push   %eax
+  801608:	68 46 4f 80 00       	push   $0x804f46
+  80160d:	e8 36 ed ff ff       	call   800348 <cprintf>
+		return r;
+  801612:	83 c4 10             	add    $0x10,%esp
+  801615:	eb 02                	jmp    801619 <fork+0x1f3>
+  801617:	89 c7                	mov    %eax,%edi
+}
+  801619:	89 f8                	mov    %edi,%eax
+  80161b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80161e:	5b                   	pop    %ebx
+  80161f:	5e                   	pop    %esi
+  801620:	5f                   	pop    %edi
+  801621:	5d                   	pop    %ebp
+  801622:	c3                   	ret
+
+00801623 <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  801623:	55                   	push   %ebp
+  801624:	89 e5                	mov    %esp,%ebp
+  801626:	57                   	push   %edi
+  801627:	56                   	push   %esi
+  801628:	53                   	push   %ebx
+  801629:	83 ec 2c             	sub    $0x2c,%esp
+  80162c:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80162e:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  801634:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801639:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  80163f:	77 0a                	ja     80164b <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801641:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  801646:	29 c3                	sub    %eax,%ebx
+  801648:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  80164b:	83 ec 0c             	sub    $0xc,%esp
+  80164e:	68 89 13 80 00       	push   $0x801389
+  801653:	e8 b9 2d 00 00       	call   804411 <set_pgfault_handler>
+  801658:	b8 07 00 00 00       	mov    $0x7,%eax
+  80165d:	cd 30                	int    $0x30
+  80165f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  801662:	83 c4 10             	add    $0x10,%esp
+  801665:	85 c0                	test   %eax,%eax
+  801667:	78 30                	js     801699 <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  801669:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80166d:	74 42                	je     8016b1 <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  80166f:	c1 e3 10             	shl    $0x10,%ebx
+  801672:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  801677:	29 d8                	sub    %ebx,%eax
+  801679:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80167c:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  801681:	29 d8                	sub    %ebx,%eax
+  801683:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801686:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80168b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801690:	89 f7                	mov    %esi,%edi
+  801692:	89 d6                	mov    %edx,%esi
+  801694:	e9 2c 01 00 00       	jmp    8017c5 <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  801699:	83 ec 08             	sub    $0x8,%esp
+  80169c:	89 c7                	mov    %eax,%edi
+  80169e:	50                   	push   %eax
+  80169f:	68 21 4f 80 00       	push   $0x804f21
+  8016a4:	e8 9f ec ff ff       	call   800348 <cprintf>
+		return eid;
+  8016a9:	83 c4 10             	add    $0x10,%esp
+  8016ac:	e9 d5 00 00 00       	jmp    801786 <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8016b1:	e8 5c f6 ff ff       	call   800d12 <sys_getenvid>
+  8016b6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8016bb:	89 c2                	mov    %eax,%edx
+  8016bd:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8016bf:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  8016c5:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8016ca:	77 18                	ja     8016e4 <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8016cc:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8016d1:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  8016d3:	c1 e8 10             	shr    $0x10,%eax
+  8016d6:	74 0c                	je     8016e4 <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8016d8:	c1 e0 10             	shl    $0x10,%eax
+  8016db:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8016e0:	29 c1                	sub    %eax,%ecx
+  8016e2:	eb 06                	jmp    8016ea <sfork+0xc7>
+		return pthread_main_tls;
+  8016e4:	8b 0d c0 76 80 00    	mov    0x8076c0,%ecx
+  8016ea:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8016ed:	c1 e0 04             	shl    $0x4,%eax
+  8016f0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8016f5:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  8016f7:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8016fa:	e9 87 00 00 00       	jmp    801786 <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  8016ff:	f6 c5 04             	test   $0x4,%ch
+  801702:	74 6c                	je     801770 <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  801704:	89 ca                	mov    %ecx,%edx
+  801706:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  80170c:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  801712:	74 7c                	je     801790 <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  801714:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  80171a:	89 da                	mov    %ebx,%edx
+  80171c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80171f:	e8 67 fb ff ff       	call   80128b <duppage>
+  801724:	85 c0                	test   %eax,%eax
+  801726:	0f 88 4f 01 00 00    	js     80187b <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  80172c:	83 c3 01             	add    $0x1,%ebx
+  80172f:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  801732:	74 7a                	je     8017ae <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  801734:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  801736:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  80173d:	f6 c1 01             	test   $0x1,%cl
+  801740:	74 ea                	je     80172c <sfork+0x109>
+  801742:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  801748:	74 e2                	je     80172c <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  80174a:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  801750:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  801753:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  801758:	76 a5                	jbe    8016ff <sfork+0xdc>
+  80175a:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  801760:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  801763:	39 fa                	cmp    %edi,%edx
+  801765:	73 9d                	jae    801704 <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  801767:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  80176a:	39 fa                	cmp    %edi,%edx
+  80176c:	72 96                	jb     801704 <sfork+0xe1>
+  80176e:	eb 8f                	jmp    8016ff <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  801770:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  801776:	89 da                	mov    %ebx,%edx
+  801778:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80177b:	e8 8c fa ff ff       	call   80120c <duppage_cow>
+  801780:	85 c0                	test   %eax,%eax
+  801782:	79 a8                	jns    80172c <sfork+0x109>
+  801784:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  801786:	89 f8                	mov    %edi,%eax
+  801788:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80178b:	5b                   	pop    %ebx
+  80178c:	5e                   	pop    %esi
+  80178d:	5f                   	pop    %edi
+  80178e:	5d                   	pop    %ebp
+  80178f:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  801790:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  801795:	e8 2e fb ff ff       	call   8012c8 <cow_copy>
+  80179a:	85 c0                	test   %eax,%eax
+  80179c:	0f 88 d2 00 00 00    	js     801874 <sfork+0x251>
+				pte = uvpt[pn];
+  8017a2:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  8017a9:	e9 66 ff ff ff       	jmp    801714 <sfork+0xf1>
+  8017ae:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8017b1:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8017b4:	83 c6 01             	add    $0x1,%esi
+  8017b7:	81 c7 00 04 00 00    	add    $0x400,%edi
+  8017bd:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  8017c3:	74 1b                	je     8017e0 <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  8017c5:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  8017cc:	a8 01                	test   $0x1,%al
+  8017ce:	74 e4                	je     8017b4 <sfork+0x191>
+  8017d0:	89 f3                	mov    %esi,%ebx
+  8017d2:	c1 e3 0a             	shl    $0xa,%ebx
+  8017d5:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  8017d8:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  8017db:	e9 4f ff ff ff       	jmp    80172f <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  8017e0:	83 ec 04             	sub    $0x4,%esp
+  8017e3:	6a 07                	push   $0x7
+  8017e5:	68 00 f0 bf ee       	push   $0xeebff000
+  8017ea:	ff 75 e0             	push   -0x20(%ebp)
+  8017ed:	e8 78 f5 ff ff       	call   800d6a <sys_page_alloc>
+  8017f2:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8017f4:	83 c4 10             	add    $0x10,%esp
+  8017f7:	85 c0                	test   %eax,%eax
+  8017f9:	78 37                	js     801832 <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  8017fb:	83 ec 08             	sub    $0x8,%esp
+  8017fe:	68 4f 44 80 00       	push   $0x80444f
+  801803:	ff 75 e0             	push   -0x20(%ebp)
+  801806:	e8 dc f6 ff ff       	call   800ee7 <sys_env_set_pgfault_upcall>
+  80180b:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80180d:	83 c4 10             	add    $0x10,%esp
+  801810:	85 c0                	test   %eax,%eax
+  801812:	78 34                	js     801848 <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  801814:	83 ec 08             	sub    $0x8,%esp
+  801817:	6a 02                	push   $0x2
+  801819:	ff 75 e0             	push   -0x20(%ebp)
+  80181c:	e8 2e f6 ff ff       	call   800e4f <sys_env_set_status>
+  801821:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801823:	83 c4 10             	add    $0x10,%esp
+  801826:	85 c0                	test   %eax,%eax
+  801828:	78 34                	js     80185e <sfork+0x23b>
+	return eid;
+  80182a:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  80182d:	e9 54 ff ff ff       	jmp    801786 <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  801832:	83 ec 08             	sub    $0x8,%esp
+  801835:	50                   	push   %eax
+  801836:	68 94 4e 80 00       	push   $0x804e94
+  80183b:	e8 08 eb ff ff       	call   800348 <cprintf>
+		return r;
+  801840:	83 c4 10             	add    $0x10,%esp
+  801843:	e9 3e ff ff ff       	jmp    801786 <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  801848:	83 ec 08             	sub    $0x8,%esp
+  80184b:	50                   	push   %eax
+  80184c:	68 bc 4e 80 00       	push   $0x804ebc
+  801851:	e8 f2 ea ff ff       	call   800348 <cprintf>
+		return r;
+  801856:	83 c4 10             	add    $0x10,%esp
+  801859:	e9 28 ff ff ff       	jmp    801786 <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  80185e:	83 ec 08             	sub    $0x8,%esp
+  801861:	50                   	push   %eax
+  801862:	68 46 4f 80 00       	push   $0x804f46
+  801867:	e8 dc ea ff ff       	call   800348 <cprintf>
+		return r;
+  80186c:	83 c4 10             	add    $0x10,%esp
+  80186f:	e9 12 ff ff ff       	jmp    801786 <sfork+0x163>
+  801874:	89 c7                	mov    %eax,%edi
+  801876:	e9 0b ff ff ff       	jmp    801786 <sfork+0x163>
+  80187b:	89 c7                	mov    %eax,%edi
+  80187d:	e9 04 ff ff ff       	jmp    801786 <sfork+0x163>
+
+00801882 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801882:	55                   	push   %ebp
+  801883:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801885:	8b 45 08             	mov    0x8(%ebp),%eax
+  801888:	05 00 00 00 30       	add    $0x30000000,%eax
+  80188d:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801890:	5d                   	pop    %ebp
+  801891:	c3                   	ret
+
+00801892 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801892:	55                   	push   %ebp
+  801893:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801895:	8b 45 08             	mov    0x8(%ebp),%eax
+  801898:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80189d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8018a2:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8018a7:	5d                   	pop    %ebp
+  8018a8:	c3                   	ret
+
+008018a9 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8018a9:	55                   	push   %ebp
+  8018aa:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8018ac:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8018b1:	eb 02                	jmp    8018b5 <fd_alloc+0xc>
+  8018b3:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8018b5:	89 c2                	mov    %eax,%edx
+  8018b7:	c1 ea 16             	shr    $0x16,%edx
+  8018ba:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8018c1:	f6 c2 01             	test   $0x1,%dl
+  8018c4:	74 2b                	je     8018f1 <fd_alloc+0x48>
+  8018c6:	89 c2                	mov    %eax,%edx
+  8018c8:	c1 ea 0c             	shr    $0xc,%edx
+  8018cb:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8018d2:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8018d8:	f6 c1 01             	test   $0x1,%cl
+  8018db:	74 14                	je     8018f1 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8018dd:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8018e3:	75 ce                	jne    8018b3 <fd_alloc+0xa>
+  8018e5:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8018ea:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8018ef:	eb 05                	jmp    8018f6 <fd_alloc+0x4d>
+			return 0;
+  8018f1:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8018f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018f9:	89 02                	mov    %eax,(%edx)
+}
+  8018fb:	89 c8                	mov    %ecx,%eax
+  8018fd:	5d                   	pop    %ebp
+  8018fe:	c3                   	ret
+
+008018ff <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8018ff:	55                   	push   %ebp
+  801900:	89 e5                	mov    %esp,%ebp
+  801902:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801905:	83 f8 1f             	cmp    $0x1f,%eax
+  801908:	77 30                	ja     80193a <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80190a:	c1 e0 0c             	shl    $0xc,%eax
+  80190d:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801912:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801918:	f6 c2 01             	test   $0x1,%dl
+  80191b:	74 24                	je     801941 <fd_lookup+0x42>
+  80191d:	89 c2                	mov    %eax,%edx
+  80191f:	c1 ea 0c             	shr    $0xc,%edx
+  801922:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801929:	f6 c2 01             	test   $0x1,%dl
+  80192c:	74 1a                	je     801948 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80192e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801931:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801933:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801938:	5d                   	pop    %ebp
+  801939:	c3                   	ret
+		return -E_INVAL;
+  80193a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80193f:	eb f7                	jmp    801938 <fd_lookup+0x39>
+		return -E_INVAL;
+  801941:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801946:	eb f0                	jmp    801938 <fd_lookup+0x39>
+  801948:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80194d:	eb e9                	jmp    801938 <fd_lookup+0x39>
+
+0080194f <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80194f:	55                   	push   %ebp
+  801950:	89 e5                	mov    %esp,%ebp
+  801952:	53                   	push   %ebx
+  801953:	83 ec 04             	sub    $0x4,%esp
+  801956:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801959:	b8 00 00 00 00       	mov    $0x0,%eax
+  80195e:	eb 03                	jmp    801963 <dev_lookup+0x14>
+  801960:	83 c0 01             	add    $0x1,%eax
+  801963:	8b 1c 85 e0 4f 80 00 	mov    0x804fe0(,%eax,4),%ebx
+  80196a:	85 db                	test   %ebx,%ebx
+  80196c:	74 0b                	je     801979 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80196e:	39 13                	cmp    %edx,(%ebx)
+  801970:	75 ee                	jne    801960 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801972:	b8 00 00 00 00       	mov    $0x0,%eax
+  801977:	eb 49                	jmp    8019c2 <dev_lookup+0x73>
+  801979:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80197b:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  801981:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801986:	77 18                	ja     8019a0 <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801988:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80198d:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  80198f:	c1 e8 10             	shr    $0x10,%eax
+  801992:	74 0c                	je     8019a0 <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801994:	c1 e0 10             	shl    $0x10,%eax
+  801997:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80199c:	29 c1                	sub    %eax,%ecx
+  80199e:	eb 06                	jmp    8019a6 <dev_lookup+0x57>
+		return pthread_main_tls;
+  8019a0:	8b 0d c0 76 80 00    	mov    0x8076c0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8019a6:	8b 01                	mov    (%ecx),%eax
+  8019a8:	8b 40 48             	mov    0x48(%eax),%eax
+  8019ab:	83 ec 04             	sub    $0x4,%esp
+  8019ae:	52                   	push   %edx
+  8019af:	50                   	push   %eax
+  8019b0:	68 64 4f 80 00       	push   $0x804f64
+  8019b5:	e8 8e e9 ff ff       	call   800348 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8019ba:	83 c4 10             	add    $0x10,%esp
+  8019bd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8019c2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019c5:	89 1a                	mov    %ebx,(%edx)
+}
+  8019c7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019ca:	c9                   	leave
+  8019cb:	c3                   	ret
+
+008019cc <fd_close>:
+{
+  8019cc:	55                   	push   %ebp
+  8019cd:	89 e5                	mov    %esp,%ebp
+  8019cf:	57                   	push   %edi
+  8019d0:	56                   	push   %esi
+  8019d1:	53                   	push   %ebx
+  8019d2:	83 ec 24             	sub    $0x24,%esp
+  8019d5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8019d8:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8019db:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8019de:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8019df:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8019e5:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8019e8:	50                   	push   %eax
+  8019e9:	e8 11 ff ff ff       	call   8018ff <fd_lookup>
+  8019ee:	89 c3                	mov    %eax,%ebx
+  8019f0:	83 c4 10             	add    $0x10,%esp
+  8019f3:	85 c0                	test   %eax,%eax
+  8019f5:	78 05                	js     8019fc <fd_close+0x30>
+	    || fd != fd2)
+  8019f7:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8019fa:	74 16                	je     801a12 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8019fc:	89 f8                	mov    %edi,%eax
+  8019fe:	84 c0                	test   %al,%al
+  801a00:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a05:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801a08:	89 d8                	mov    %ebx,%eax
+  801a0a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a0d:	5b                   	pop    %ebx
+  801a0e:	5e                   	pop    %esi
+  801a0f:	5f                   	pop    %edi
+  801a10:	5d                   	pop    %ebp
+  801a11:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801a12:	83 ec 08             	sub    $0x8,%esp
+  801a15:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801a18:	50                   	push   %eax
+  801a19:	ff 36                	push   (%esi)
+  801a1b:	e8 2f ff ff ff       	call   80194f <dev_lookup>
+  801a20:	89 c3                	mov    %eax,%ebx
+  801a22:	83 c4 10             	add    $0x10,%esp
+  801a25:	85 c0                	test   %eax,%eax
+  801a27:	78 1a                	js     801a43 <fd_close+0x77>
+		if (dev->dev_close)
+  801a29:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801a2c:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801a2f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801a34:	85 c0                	test   %eax,%eax
+  801a36:	74 0b                	je     801a43 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801a38:	83 ec 0c             	sub    $0xc,%esp
+  801a3b:	56                   	push   %esi
+  801a3c:	ff d0                	call   *%eax
+  801a3e:	89 c3                	mov    %eax,%ebx
+  801a40:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801a43:	83 ec 08             	sub    $0x8,%esp
+  801a46:	56                   	push   %esi
+  801a47:	6a 00                	push   $0x0
+  801a49:	e8 b5 f3 ff ff       	call   800e03 <sys_page_unmap>
+	return r;
+  801a4e:	83 c4 10             	add    $0x10,%esp
+  801a51:	eb b5                	jmp    801a08 <fd_close+0x3c>
+
+00801a53 <close>:
+
+int
+close(int fdnum)
+{
+  801a53:	55                   	push   %ebp
+  801a54:	89 e5                	mov    %esp,%ebp
+  801a56:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801a59:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a5c:	50                   	push   %eax
+  801a5d:	ff 75 08             	push   0x8(%ebp)
+  801a60:	e8 9a fe ff ff       	call   8018ff <fd_lookup>
+  801a65:	83 c4 10             	add    $0x10,%esp
+  801a68:	85 c0                	test   %eax,%eax
+  801a6a:	79 02                	jns    801a6e <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801a6c:	c9                   	leave
+  801a6d:	c3                   	ret
+		return fd_close(fd, 1);
+  801a6e:	83 ec 08             	sub    $0x8,%esp
+  801a71:	6a 01                	push   $0x1
+  801a73:	ff 75 f4             	push   -0xc(%ebp)
+  801a76:	e8 51 ff ff ff       	call   8019cc <fd_close>
+  801a7b:	83 c4 10             	add    $0x10,%esp
+  801a7e:	eb ec                	jmp    801a6c <close+0x19>
+
+00801a80 <close_all>:
+
+void
+close_all(void)
+{
+  801a80:	55                   	push   %ebp
+  801a81:	89 e5                	mov    %esp,%ebp
+  801a83:	53                   	push   %ebx
+  801a84:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801a87:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801a8c:	83 ec 0c             	sub    $0xc,%esp
+  801a8f:	53                   	push   %ebx
+  801a90:	e8 be ff ff ff       	call   801a53 <close>
+	for (i = 0; i < MAXFD; i++)
+  801a95:	83 c3 01             	add    $0x1,%ebx
+  801a98:	83 c4 10             	add    $0x10,%esp
+  801a9b:	83 fb 20             	cmp    $0x20,%ebx
+  801a9e:	75 ec                	jne    801a8c <close_all+0xc>
+}
+  801aa0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801aa3:	c9                   	leave
+  801aa4:	c3                   	ret
+
+00801aa5 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801aa5:	55                   	push   %ebp
+  801aa6:	89 e5                	mov    %esp,%ebp
+  801aa8:	57                   	push   %edi
+  801aa9:	56                   	push   %esi
+  801aaa:	53                   	push   %ebx
+  801aab:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801aae:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ab1:	50                   	push   %eax
+  801ab2:	ff 75 08             	push   0x8(%ebp)
+  801ab5:	e8 45 fe ff ff       	call   8018ff <fd_lookup>
+  801aba:	89 c3                	mov    %eax,%ebx
+  801abc:	83 c4 10             	add    $0x10,%esp
+  801abf:	85 c0                	test   %eax,%eax
+  801ac1:	78 7f                	js     801b42 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801ac3:	83 ec 0c             	sub    $0xc,%esp
+  801ac6:	ff 75 0c             	push   0xc(%ebp)
+  801ac9:	e8 85 ff ff ff       	call   801a53 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801ace:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801ad1:	c1 e6 0c             	shl    $0xc,%esi
+  801ad4:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801ada:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801add:	89 3c 24             	mov    %edi,(%esp)
+  801ae0:	e8 ad fd ff ff       	call   801892 <fd2data>
+  801ae5:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801ae7:	89 34 24             	mov    %esi,(%esp)
+  801aea:	e8 a3 fd ff ff       	call   801892 <fd2data>
+  801aef:	83 c4 10             	add    $0x10,%esp
+  801af2:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801af5:	89 d8                	mov    %ebx,%eax
+  801af7:	c1 e8 16             	shr    $0x16,%eax
+  801afa:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801b01:	a8 01                	test   $0x1,%al
+  801b03:	74 11                	je     801b16 <dup+0x71>
+  801b05:	89 d8                	mov    %ebx,%eax
+  801b07:	c1 e8 0c             	shr    $0xc,%eax
+  801b0a:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801b11:	f6 c2 01             	test   $0x1,%dl
+  801b14:	75 36                	jne    801b4c <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801b16:	89 f8                	mov    %edi,%eax
+  801b18:	c1 e8 0c             	shr    $0xc,%eax
+  801b1b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801b22:	83 ec 0c             	sub    $0xc,%esp
+  801b25:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b2a:	50                   	push   %eax
+  801b2b:	56                   	push   %esi
+  801b2c:	6a 00                	push   $0x0
+  801b2e:	57                   	push   %edi
+  801b2f:	6a 00                	push   $0x0
+  801b31:	e8 81 f2 ff ff       	call   800db7 <sys_page_map>
+  801b36:	89 c3                	mov    %eax,%ebx
+  801b38:	83 c4 20             	add    $0x20,%esp
+  801b3b:	85 c0                	test   %eax,%eax
+  801b3d:	78 33                	js     801b72 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801b3f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801b42:	89 d8                	mov    %ebx,%eax
+  801b44:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b47:	5b                   	pop    %ebx
+  801b48:	5e                   	pop    %esi
+  801b49:	5f                   	pop    %edi
+  801b4a:	5d                   	pop    %ebp
+  801b4b:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801b4c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801b53:	83 ec 0c             	sub    $0xc,%esp
+  801b56:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b5b:	50                   	push   %eax
+  801b5c:	ff 75 d4             	push   -0x2c(%ebp)
+  801b5f:	6a 00                	push   $0x0
+  801b61:	53                   	push   %ebx
+  801b62:	6a 00                	push   $0x0
+  801b64:	e8 4e f2 ff ff       	call   800db7 <sys_page_map>
+  801b69:	89 c3                	mov    %eax,%ebx
+  801b6b:	83 c4 20             	add    $0x20,%esp
+  801b6e:	85 c0                	test   %eax,%eax
+  801b70:	79 a4                	jns    801b16 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801b72:	83 ec 08             	sub    $0x8,%esp
+  801b75:	56                   	push   %esi
+  801b76:	6a 00                	push   $0x0
+  801b78:	e8 86 f2 ff ff       	call   800e03 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801b7d:	83 c4 08             	add    $0x8,%esp
+  801b80:	ff 75 d4             	push   -0x2c(%ebp)
+  801b83:	6a 00                	push   $0x0
+  801b85:	e8 79 f2 ff ff       	call   800e03 <sys_page_unmap>
+	return r;
+  801b8a:	83 c4 10             	add    $0x10,%esp
+  801b8d:	eb b3                	jmp    801b42 <dup+0x9d>
+
+00801b8f <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801b8f:	55                   	push   %ebp
+  801b90:	89 e5                	mov    %esp,%ebp
+  801b92:	56                   	push   %esi
+  801b93:	53                   	push   %ebx
+  801b94:	83 ec 18             	sub    $0x18,%esp
+  801b97:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b9a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b9d:	50                   	push   %eax
+  801b9e:	53                   	push   %ebx
+  801b9f:	e8 5b fd ff ff       	call   8018ff <fd_lookup>
+  801ba4:	83 c4 10             	add    $0x10,%esp
+  801ba7:	85 c0                	test   %eax,%eax
+  801ba9:	78 3c                	js     801be7 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801bab:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801bae:	83 ec 08             	sub    $0x8,%esp
+  801bb1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bb4:	50                   	push   %eax
+  801bb5:	ff 36                	push   (%esi)
+  801bb7:	e8 93 fd ff ff       	call   80194f <dev_lookup>
+  801bbc:	83 c4 10             	add    $0x10,%esp
+  801bbf:	85 c0                	test   %eax,%eax
+  801bc1:	78 24                	js     801be7 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801bc3:	8b 46 08             	mov    0x8(%esi),%eax
+  801bc6:	83 e0 03             	and    $0x3,%eax
+  801bc9:	83 f8 01             	cmp    $0x1,%eax
+  801bcc:	74 20                	je     801bee <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801bce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bd1:	8b 40 08             	mov    0x8(%eax),%eax
+  801bd4:	85 c0                	test   %eax,%eax
+  801bd6:	74 61                	je     801c39 <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801bd8:	83 ec 04             	sub    $0x4,%esp
+  801bdb:	ff 75 10             	push   0x10(%ebp)
+  801bde:	ff 75 0c             	push   0xc(%ebp)
+  801be1:	56                   	push   %esi
+  801be2:	ff d0                	call   *%eax
+  801be4:	83 c4 10             	add    $0x10,%esp
+}
+  801be7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bea:	5b                   	pop    %ebx
+  801beb:	5e                   	pop    %esi
+  801bec:	5d                   	pop    %ebp
+  801bed:	c3                   	ret
+  801bee:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801bf0:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801bf6:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801bfb:	77 18                	ja     801c15 <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801bfd:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801c02:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801c04:	c1 e8 10             	shr    $0x10,%eax
+  801c07:	74 0c                	je     801c15 <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801c09:	c1 e0 10             	shl    $0x10,%eax
+  801c0c:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801c11:	29 c2                	sub    %eax,%edx
+  801c13:	eb 06                	jmp    801c1b <read+0x8c>
+		return pthread_main_tls;
+  801c15:	8b 15 c0 76 80 00    	mov    0x8076c0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c1b:	8b 02                	mov    (%edx),%eax
+  801c1d:	8b 40 48             	mov    0x48(%eax),%eax
+  801c20:	83 ec 04             	sub    $0x4,%esp
+  801c23:	53                   	push   %ebx
+  801c24:	50                   	push   %eax
+  801c25:	68 a5 4f 80 00       	push   $0x804fa5
+  801c2a:	e8 19 e7 ff ff       	call   800348 <cprintf>
+		return -E_INVAL;
+  801c2f:	83 c4 10             	add    $0x10,%esp
+  801c32:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c37:	eb ae                	jmp    801be7 <read+0x58>
+		return -E_NOT_SUPP;
+  801c39:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c3e:	eb a7                	jmp    801be7 <read+0x58>
+
+00801c40 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801c40:	55                   	push   %ebp
+  801c41:	89 e5                	mov    %esp,%ebp
+  801c43:	57                   	push   %edi
+  801c44:	56                   	push   %esi
+  801c45:	53                   	push   %ebx
+  801c46:	83 ec 0c             	sub    $0xc,%esp
+  801c49:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801c4c:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801c4f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c54:	eb 02                	jmp    801c58 <readn+0x18>
+  801c56:	01 c3                	add    %eax,%ebx
+  801c58:	39 f3                	cmp    %esi,%ebx
+  801c5a:	73 21                	jae    801c7d <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801c5c:	83 ec 04             	sub    $0x4,%esp
+  801c5f:	89 f0                	mov    %esi,%eax
+  801c61:	29 d8                	sub    %ebx,%eax
+  801c63:	50                   	push   %eax
+  801c64:	89 d8                	mov    %ebx,%eax
+  801c66:	03 45 0c             	add    0xc(%ebp),%eax
+  801c69:	50                   	push   %eax
+  801c6a:	57                   	push   %edi
+  801c6b:	e8 1f ff ff ff       	call   801b8f <read>
+		if (m < 0)
+  801c70:	83 c4 10             	add    $0x10,%esp
+  801c73:	85 c0                	test   %eax,%eax
+  801c75:	78 04                	js     801c7b <readn+0x3b>
+			return m;
+		if (m == 0)
+  801c77:	75 dd                	jne    801c56 <readn+0x16>
+  801c79:	eb 02                	jmp    801c7d <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801c7b:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801c7d:	89 d8                	mov    %ebx,%eax
+  801c7f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c82:	5b                   	pop    %ebx
+  801c83:	5e                   	pop    %esi
+  801c84:	5f                   	pop    %edi
+  801c85:	5d                   	pop    %ebp
+  801c86:	c3                   	ret
+
+00801c87 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801c87:	55                   	push   %ebp
+  801c88:	89 e5                	mov    %esp,%ebp
+  801c8a:	56                   	push   %esi
+  801c8b:	53                   	push   %ebx
+  801c8c:	83 ec 18             	sub    $0x18,%esp
+  801c8f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c92:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c95:	50                   	push   %eax
+  801c96:	53                   	push   %ebx
+  801c97:	e8 63 fc ff ff       	call   8018ff <fd_lookup>
+  801c9c:	83 c4 10             	add    $0x10,%esp
+  801c9f:	85 c0                	test   %eax,%eax
+  801ca1:	78 37                	js     801cda <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ca3:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801ca6:	83 ec 08             	sub    $0x8,%esp
+  801ca9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cac:	50                   	push   %eax
+  801cad:	ff 36                	push   (%esi)
+  801caf:	e8 9b fc ff ff       	call   80194f <dev_lookup>
+  801cb4:	83 c4 10             	add    $0x10,%esp
+  801cb7:	85 c0                	test   %eax,%eax
+  801cb9:	78 1f                	js     801cda <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801cbb:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801cbf:	74 20                	je     801ce1 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801cc1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cc4:	8b 40 0c             	mov    0xc(%eax),%eax
+  801cc7:	85 c0                	test   %eax,%eax
+  801cc9:	74 61                	je     801d2c <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801ccb:	83 ec 04             	sub    $0x4,%esp
+  801cce:	ff 75 10             	push   0x10(%ebp)
+  801cd1:	ff 75 0c             	push   0xc(%ebp)
+  801cd4:	56                   	push   %esi
+  801cd5:	ff d0                	call   *%eax
+  801cd7:	83 c4 10             	add    $0x10,%esp
+}
+  801cda:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cdd:	5b                   	pop    %ebx
+  801cde:	5e                   	pop    %esi
+  801cdf:	5d                   	pop    %ebp
+  801ce0:	c3                   	ret
+  801ce1:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801ce3:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801ce9:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801cee:	77 18                	ja     801d08 <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801cf0:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801cf5:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801cf7:	c1 e8 10             	shr    $0x10,%eax
+  801cfa:	74 0c                	je     801d08 <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801cfc:	c1 e0 10             	shl    $0x10,%eax
+  801cff:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801d04:	29 c2                	sub    %eax,%edx
+  801d06:	eb 06                	jmp    801d0e <write+0x87>
+		return pthread_main_tls;
+  801d08:	8b 15 c0 76 80 00    	mov    0x8076c0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d0e:	8b 02                	mov    (%edx),%eax
+  801d10:	8b 40 48             	mov    0x48(%eax),%eax
+  801d13:	83 ec 04             	sub    $0x4,%esp
+  801d16:	53                   	push   %ebx
+  801d17:	50                   	push   %eax
+  801d18:	68 c1 4f 80 00       	push   $0x804fc1
+  801d1d:	e8 26 e6 ff ff       	call   800348 <cprintf>
+		return -E_INVAL;
+  801d22:	83 c4 10             	add    $0x10,%esp
+  801d25:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d2a:	eb ae                	jmp    801cda <write+0x53>
+		return -E_NOT_SUPP;
+  801d2c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d31:	eb a7                	jmp    801cda <write+0x53>
+
+00801d33 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801d33:	55                   	push   %ebp
+  801d34:	89 e5                	mov    %esp,%ebp
+  801d36:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d39:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d3c:	50                   	push   %eax
+  801d3d:	ff 75 08             	push   0x8(%ebp)
+  801d40:	e8 ba fb ff ff       	call   8018ff <fd_lookup>
+  801d45:	83 c4 10             	add    $0x10,%esp
+  801d48:	85 c0                	test   %eax,%eax
+  801d4a:	78 0e                	js     801d5a <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801d4c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d4f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d52:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801d55:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d5a:	c9                   	leave
+  801d5b:	c3                   	ret
+
+00801d5c <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801d5c:	55                   	push   %ebp
+  801d5d:	89 e5                	mov    %esp,%ebp
+  801d5f:	56                   	push   %esi
+  801d60:	53                   	push   %ebx
+  801d61:	83 ec 18             	sub    $0x18,%esp
+  801d64:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d67:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d6a:	50                   	push   %eax
+  801d6b:	53                   	push   %ebx
+  801d6c:	e8 8e fb ff ff       	call   8018ff <fd_lookup>
+  801d71:	83 c4 10             	add    $0x10,%esp
+  801d74:	85 c0                	test   %eax,%eax
+  801d76:	78 34                	js     801dac <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d78:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d7b:	83 ec 08             	sub    $0x8,%esp
+  801d7e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d81:	50                   	push   %eax
+  801d82:	ff 36                	push   (%esi)
+  801d84:	e8 c6 fb ff ff       	call   80194f <dev_lookup>
+  801d89:	83 c4 10             	add    $0x10,%esp
+  801d8c:	85 c0                	test   %eax,%eax
+  801d8e:	78 1c                	js     801dac <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d90:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801d94:	74 1d                	je     801db3 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801d96:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d99:	8b 40 18             	mov    0x18(%eax),%eax
+  801d9c:	85 c0                	test   %eax,%eax
+  801d9e:	74 5e                	je     801dfe <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801da0:	83 ec 08             	sub    $0x8,%esp
+  801da3:	ff 75 0c             	push   0xc(%ebp)
+  801da6:	56                   	push   %esi
+  801da7:	ff d0                	call   *%eax
+  801da9:	83 c4 10             	add    $0x10,%esp
+}
+  801dac:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801daf:	5b                   	pop    %ebx
+  801db0:	5e                   	pop    %esi
+  801db1:	5d                   	pop    %ebp
+  801db2:	c3                   	ret
+  801db3:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801db5:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801dbb:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801dc0:	77 18                	ja     801dda <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801dc2:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801dc7:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801dc9:	c1 e8 10             	shr    $0x10,%eax
+  801dcc:	74 0c                	je     801dda <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801dce:	c1 e0 10             	shl    $0x10,%eax
+  801dd1:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801dd6:	29 c2                	sub    %eax,%edx
+  801dd8:	eb 06                	jmp    801de0 <ftruncate+0x84>
+		return pthread_main_tls;
+  801dda:	8b 15 c0 76 80 00    	mov    0x8076c0,%edx
+			thisenv->env_id, fdnum);
+  801de0:	8b 02                	mov    (%edx),%eax
+  801de2:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801de5:	83 ec 04             	sub    $0x4,%esp
+  801de8:	53                   	push   %ebx
+  801de9:	50                   	push   %eax
+  801dea:	68 84 4f 80 00       	push   $0x804f84
+  801def:	e8 54 e5 ff ff       	call   800348 <cprintf>
+		return -E_INVAL;
+  801df4:	83 c4 10             	add    $0x10,%esp
+  801df7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801dfc:	eb ae                	jmp    801dac <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801dfe:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e03:	eb a7                	jmp    801dac <ftruncate+0x50>
+
+00801e05 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801e05:	55                   	push   %ebp
+  801e06:	89 e5                	mov    %esp,%ebp
+  801e08:	56                   	push   %esi
+  801e09:	53                   	push   %ebx
+  801e0a:	83 ec 18             	sub    $0x18,%esp
+  801e0d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801e10:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e13:	50                   	push   %eax
+  801e14:	ff 75 08             	push   0x8(%ebp)
+  801e17:	e8 e3 fa ff ff       	call   8018ff <fd_lookup>
+  801e1c:	83 c4 10             	add    $0x10,%esp
+  801e1f:	85 c0                	test   %eax,%eax
+  801e21:	78 49                	js     801e6c <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801e23:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e26:	83 ec 08             	sub    $0x8,%esp
+  801e29:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e2c:	50                   	push   %eax
+  801e2d:	ff 36                	push   (%esi)
+  801e2f:	e8 1b fb ff ff       	call   80194f <dev_lookup>
+  801e34:	83 c4 10             	add    $0x10,%esp
+  801e37:	85 c0                	test   %eax,%eax
+  801e39:	78 31                	js     801e6c <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801e3b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e3e:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801e42:	74 2f                	je     801e73 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801e44:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801e47:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801e4e:	00 00 00 
+	stat->st_isdir = 0;
+  801e51:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801e58:	00 00 00 
+	stat->st_dev = dev;
+  801e5b:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801e61:	83 ec 08             	sub    $0x8,%esp
+  801e64:	53                   	push   %ebx
+  801e65:	56                   	push   %esi
+  801e66:	ff 50 14             	call   *0x14(%eax)
+  801e69:	83 c4 10             	add    $0x10,%esp
+}
+  801e6c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e6f:	5b                   	pop    %ebx
+  801e70:	5e                   	pop    %esi
+  801e71:	5d                   	pop    %ebp
+  801e72:	c3                   	ret
+		return -E_NOT_SUPP;
+  801e73:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e78:	eb f2                	jmp    801e6c <fstat+0x67>
+
+00801e7a <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801e7a:	55                   	push   %ebp
+  801e7b:	89 e5                	mov    %esp,%ebp
+  801e7d:	56                   	push   %esi
+  801e7e:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801e7f:	83 ec 08             	sub    $0x8,%esp
+  801e82:	6a 00                	push   $0x0
+  801e84:	ff 75 08             	push   0x8(%ebp)
+  801e87:	e8 4b 03 00 00       	call   8021d7 <open>
+  801e8c:	89 c3                	mov    %eax,%ebx
+  801e8e:	83 c4 10             	add    $0x10,%esp
+  801e91:	85 c0                	test   %eax,%eax
+  801e93:	78 1b                	js     801eb0 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801e95:	83 ec 08             	sub    $0x8,%esp
+  801e98:	ff 75 0c             	push   0xc(%ebp)
+  801e9b:	50                   	push   %eax
+  801e9c:	e8 64 ff ff ff       	call   801e05 <fstat>
+  801ea1:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801ea3:	89 1c 24             	mov    %ebx,(%esp)
+  801ea6:	e8 a8 fb ff ff       	call   801a53 <close>
+	return r;
+  801eab:	83 c4 10             	add    $0x10,%esp
+  801eae:	89 f3                	mov    %esi,%ebx
+}
+  801eb0:	89 d8                	mov    %ebx,%eax
+  801eb2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801eb5:	5b                   	pop    %ebx
+  801eb6:	5e                   	pop    %esi
+  801eb7:	5d                   	pop    %ebp
+  801eb8:	c3                   	ret
+
+00801eb9 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801eb9:	55                   	push   %ebp
+  801eba:	89 e5                	mov    %esp,%ebp
+  801ebc:	56                   	push   %esi
+  801ebd:	53                   	push   %ebx
+  801ebe:	89 c6                	mov    %eax,%esi
+  801ec0:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801ec2:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  801ec9:	74 27                	je     801ef2 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801ecb:	6a 07                	push   $0x7
+  801ecd:	68 00 80 80 00       	push   $0x808000
+  801ed2:	56                   	push   %esi
+  801ed3:	ff 35 00 70 80 00    	push   0x807000
+  801ed9:	e8 8d 26 00 00       	call   80456b <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801ede:	83 c4 0c             	add    $0xc,%esp
+  801ee1:	6a 00                	push   $0x0
+  801ee3:	53                   	push   %ebx
+  801ee4:	6a 00                	push   $0x0
+  801ee6:	e8 8a 25 00 00       	call   804475 <ipc_recv>
+}
+  801eeb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801eee:	5b                   	pop    %ebx
+  801eef:	5e                   	pop    %esi
+  801ef0:	5d                   	pop    %ebp
+  801ef1:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801ef2:	83 ec 0c             	sub    $0xc,%esp
+  801ef5:	6a 01                	push   $0x1
+  801ef7:	e8 c5 26 00 00       	call   8045c1 <ipc_find_env>
+  801efc:	a3 00 70 80 00       	mov    %eax,0x807000
+  801f01:	83 c4 10             	add    $0x10,%esp
+  801f04:	eb c5                	jmp    801ecb <fsipc+0x12>
+
+00801f06 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801f06:	55                   	push   %ebp
+  801f07:	89 e5                	mov    %esp,%ebp
+  801f09:	53                   	push   %ebx
+  801f0a:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801f0d:	68 04 70 80 00       	push   $0x807004
+  801f12:	e8 7a 1b 00 00       	call   803a91 <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801f17:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f1a:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f1d:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.set_size.req_size = newsize;
+  801f22:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f25:	a3 04 80 80 00       	mov    %eax,0x808004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  801f2a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f2f:	b8 02 00 00 00       	mov    $0x2,%eax
+  801f34:	e8 80 ff ff ff       	call   801eb9 <fsipc>
+  801f39:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801f3b:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801f42:	e8 b7 1b 00 00       	call   803afe <mutex_unlock>
+	return r;
+}
+  801f47:	89 d8                	mov    %ebx,%eax
+  801f49:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f4c:	c9                   	leave
+  801f4d:	c3                   	ret
+
+00801f4e <devfile_flush>:
+{
+  801f4e:	55                   	push   %ebp
+  801f4f:	89 e5                	mov    %esp,%ebp
+  801f51:	53                   	push   %ebx
+  801f52:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  801f55:	68 04 70 80 00       	push   $0x807004
+  801f5a:	e8 32 1b 00 00       	call   803a91 <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801f5f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f62:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f65:	a3 00 80 80 00       	mov    %eax,0x808000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  801f6a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f6f:	b8 06 00 00 00       	mov    $0x6,%eax
+  801f74:	e8 40 ff ff ff       	call   801eb9 <fsipc>
+  801f79:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801f7b:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801f82:	e8 77 1b 00 00       	call   803afe <mutex_unlock>
+}
+  801f87:	89 d8                	mov    %ebx,%eax
+  801f89:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f8c:	c9                   	leave
+  801f8d:	c3                   	ret
+
+00801f8e <devfile_stat>:
+{
+  801f8e:	55                   	push   %ebp
+  801f8f:	89 e5                	mov    %esp,%ebp
+  801f91:	56                   	push   %esi
+  801f92:	53                   	push   %ebx
+  801f93:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  801f96:	83 ec 0c             	sub    $0xc,%esp
+  801f99:	68 04 70 80 00       	push   $0x807004
+  801f9e:	e8 ee 1a 00 00       	call   803a91 <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801fa3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fa6:	8b 40 0c             	mov    0xc(%eax),%eax
+  801fa9:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  801fae:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fb3:	b8 05 00 00 00       	mov    $0x5,%eax
+  801fb8:	e8 fc fe ff ff       	call   801eb9 <fsipc>
+  801fbd:	89 c3                	mov    %eax,%ebx
+  801fbf:	83 c4 10             	add    $0x10,%esp
+  801fc2:	85 c0                	test   %eax,%eax
+  801fc4:	79 16                	jns    801fdc <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  801fc6:	83 ec 0c             	sub    $0xc,%esp
+  801fc9:	68 04 70 80 00       	push   $0x807004
+  801fce:	e8 2b 1b 00 00       	call   803afe <mutex_unlock>
+}
+  801fd3:	89 d8                	mov    %ebx,%eax
+  801fd5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fd8:	5b                   	pop    %ebx
+  801fd9:	5e                   	pop    %esi
+  801fda:	5d                   	pop    %ebp
+  801fdb:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801fdc:	83 ec 08             	sub    $0x8,%esp
+  801fdf:	68 00 80 80 00       	push   $0x808000
+  801fe4:	56                   	push   %esi
+  801fe5:	e8 42 e9 ff ff       	call   80092c <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  801fea:	a1 80 80 80 00       	mov    0x808080,%eax
+  801fef:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801ff5:	a1 84 80 80 00       	mov    0x808084,%eax
+  801ffa:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  802000:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  802003:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802008:	eb bc                	jmp    801fc6 <devfile_stat+0x38>
+
+0080200a <devfile_write>:
+{
+  80200a:	55                   	push   %ebp
+  80200b:	89 e5                	mov    %esp,%ebp
+  80200d:	53                   	push   %ebx
+  80200e:	83 ec 10             	sub    $0x10,%esp
+  802011:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  802014:	68 04 70 80 00       	push   $0x807004
+  802019:	e8 73 1a 00 00       	call   803a91 <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80201e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802021:	8b 40 0c             	mov    0xc(%eax),%eax
+  802024:	a3 00 80 80 00       	mov    %eax,0x808000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  802029:	83 c4 10             	add    $0x10,%esp
+  80202c:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  802032:	76 3d                	jbe    802071 <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  802034:	b8 00 00 10 00       	mov    $0x100000,%eax
+  802039:	39 c3                	cmp    %eax,%ebx
+  80203b:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  80203e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802041:	a3 08 80 80 00       	mov    %eax,0x808008
+	fsipcbuf.write.req_n = n;
+  802046:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	r = fsipc(FSREQ_WRITE, NULL);
+  80204c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802051:	b8 04 00 00 00       	mov    $0x4,%eax
+  802056:	e8 5e fe ff ff       	call   801eb9 <fsipc>
+  80205b:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80205d:	83 ec 0c             	sub    $0xc,%esp
+  802060:	68 04 70 80 00       	push   $0x807004
+  802065:	e8 94 1a 00 00       	call   803afe <mutex_unlock>
+}
+  80206a:	89 d8                	mov    %ebx,%eax
+  80206c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80206f:	c9                   	leave
+  802070:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  802071:	83 ec 04             	sub    $0x4,%esp
+  802074:	53                   	push   %ebx
+  802075:	ff 75 0c             	push   0xc(%ebp)
+  802078:	68 0c 80 80 00       	push   $0x80800c
+  80207d:	e8 30 ea ff ff       	call   800ab2 <memmove>
+  802082:	83 c4 10             	add    $0x10,%esp
+  802085:	b8 00 00 00 00       	mov    $0x0,%eax
+  80208a:	eb b5                	jmp    802041 <devfile_write+0x37>
+
+0080208c <devfile_read>:
+{
+  80208c:	55                   	push   %ebp
+  80208d:	89 e5                	mov    %esp,%ebp
+  80208f:	57                   	push   %edi
+  802090:	56                   	push   %esi
+  802091:	53                   	push   %ebx
+  802092:	83 ec 0c             	sub    $0xc,%esp
+  802095:	8b 75 08             	mov    0x8(%ebp),%esi
+  802098:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80209b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  80209e:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  8020a4:	0f 86 8c 00 00 00    	jbe    802136 <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  8020aa:	b8 00 00 10 00       	mov    $0x100000,%eax
+  8020af:	39 c3                	cmp    %eax,%ebx
+  8020b1:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  8020b4:	89 f8                	mov    %edi,%eax
+  8020b6:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  8020b9:	eb 0f                	jmp    8020ca <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  8020bb:	0f b6 08             	movzbl (%eax),%ecx
+  8020be:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  8020c0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8020c5:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  8020ca:	39 d0                	cmp    %edx,%eax
+  8020cc:	72 ed                	jb     8020bb <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  8020ce:	83 ec 0c             	sub    $0xc,%esp
+  8020d1:	68 04 70 80 00       	push   $0x807004
+  8020d6:	e8 b6 19 00 00       	call   803a91 <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8020db:	8b 46 0c             	mov    0xc(%esi),%eax
+  8020de:	a3 00 80 80 00       	mov    %eax,0x808000
+		fsipcbuf.read.req_n = n;
+  8020e3:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  8020e9:	89 3d 08 80 80 00    	mov    %edi,0x808008
+		r = fsipc(FSREQ_READ, NULL);
+  8020ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020f4:	b8 03 00 00 00       	mov    $0x3,%eax
+  8020f9:	e8 bb fd ff ff       	call   801eb9 <fsipc>
+  8020fe:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  802100:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  802107:	e8 f2 19 00 00       	call   803afe <mutex_unlock>
+		assert(r <= (int) n);
+  80210c:	83 c4 10             	add    $0x10,%esp
+  80210f:	39 f3                	cmp    %esi,%ebx
+  802111:	7c 0a                	jl     80211d <devfile_read+0x91>
+}
+  802113:	89 f0                	mov    %esi,%eax
+  802115:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802118:	5b                   	pop    %ebx
+  802119:	5e                   	pop    %esi
+  80211a:	5f                   	pop    %edi
+  80211b:	5d                   	pop    %ebp
+  80211c:	c3                   	ret
+		assert(r <= (int) n);
+  80211d:	68 f4 4f 80 00       	push   $0x804ff4
+  802122:	68 31 4f 80 00       	push   $0x804f31
+  802127:	68 90 00 00 00       	push   $0x90
+  80212c:	68 01 50 80 00       	push   $0x805001
+  802131:	e8 37 e1 ff ff       	call   80026d <_panic>
+	mutex_lock(&fsipc_mu);
+  802136:	83 ec 0c             	sub    $0xc,%esp
+  802139:	68 04 70 80 00       	push   $0x807004
+  80213e:	e8 4e 19 00 00       	call   803a91 <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802143:	8b 46 0c             	mov    0xc(%esi),%eax
+  802146:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.read.req_n = n;
+  80214b:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	fsipcbuf.read.req_va = 0;
+  802151:	c7 05 08 80 80 00 00 	movl   $0x0,0x808008
+  802158:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  80215b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802160:	b8 03 00 00 00       	mov    $0x3,%eax
+  802165:	e8 4f fd ff ff       	call   801eb9 <fsipc>
+  80216a:	89 c6                	mov    %eax,%esi
+  80216c:	83 c4 10             	add    $0x10,%esp
+  80216f:	85 c0                	test   %eax,%eax
+  802171:	78 1d                	js     802190 <devfile_read+0x104>
+		assert(r <= n);
+  802173:	39 c3                	cmp    %eax,%ebx
+  802175:	72 2e                	jb     8021a5 <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  802177:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80217c:	7f 40                	jg     8021be <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80217e:	83 ec 04             	sub    $0x4,%esp
+  802181:	50                   	push   %eax
+  802182:	68 00 80 80 00       	push   $0x808000
+  802187:	57                   	push   %edi
+  802188:	e8 25 e9 ff ff       	call   800ab2 <memmove>
+  80218d:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  802190:	83 ec 0c             	sub    $0xc,%esp
+  802193:	68 04 70 80 00       	push   $0x807004
+  802198:	e8 61 19 00 00       	call   803afe <mutex_unlock>
+	return r;
+  80219d:	83 c4 10             	add    $0x10,%esp
+  8021a0:	e9 6e ff ff ff       	jmp    802113 <devfile_read+0x87>
+		assert(r <= n);
+  8021a5:	68 0c 50 80 00       	push   $0x80500c
+  8021aa:	68 31 4f 80 00       	push   $0x804f31
+  8021af:	68 99 00 00 00       	push   $0x99
+  8021b4:	68 01 50 80 00       	push   $0x805001
+  8021b9:	e8 af e0 ff ff       	call   80026d <_panic>
+		assert(r <= PGSIZE);
+  8021be:	68 13 50 80 00       	push   $0x805013
+  8021c3:	68 31 4f 80 00       	push   $0x804f31
+  8021c8:	68 9a 00 00 00       	push   $0x9a
+  8021cd:	68 01 50 80 00       	push   $0x805001
+  8021d2:	e8 96 e0 ff ff       	call   80026d <_panic>
+
+008021d7 <open>:
+{
+  8021d7:	55                   	push   %ebp
+  8021d8:	89 e5                	mov    %esp,%ebp
+  8021da:	56                   	push   %esi
+  8021db:	53                   	push   %ebx
+  8021dc:	83 ec 1c             	sub    $0x1c,%esp
+  8021df:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  8021e2:	56                   	push   %esi
+  8021e3:	e8 09 e7 ff ff       	call   8008f1 <strlen>
+  8021e8:	83 c4 10             	add    $0x10,%esp
+  8021eb:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8021f0:	0f 8f 85 00 00 00    	jg     80227b <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  8021f6:	83 ec 0c             	sub    $0xc,%esp
+  8021f9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021fc:	50                   	push   %eax
+  8021fd:	e8 a7 f6 ff ff       	call   8018a9 <fd_alloc>
+  802202:	89 c3                	mov    %eax,%ebx
+  802204:	83 c4 10             	add    $0x10,%esp
+  802207:	85 c0                	test   %eax,%eax
+  802209:	78 55                	js     802260 <open+0x89>
+	mutex_lock(&fsipc_mu);
+  80220b:	83 ec 0c             	sub    $0xc,%esp
+  80220e:	68 04 70 80 00       	push   $0x807004
+  802213:	e8 79 18 00 00       	call   803a91 <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  802218:	83 c4 08             	add    $0x8,%esp
+  80221b:	56                   	push   %esi
+  80221c:	68 00 80 80 00       	push   $0x808000
+  802221:	e8 06 e7 ff ff       	call   80092c <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802226:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802229:	a3 00 84 80 00       	mov    %eax,0x808400
+	r = fsipc(FSREQ_OPEN, fd);
+  80222e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802231:	b8 01 00 00 00       	mov    $0x1,%eax
+  802236:	e8 7e fc ff ff       	call   801eb9 <fsipc>
+  80223b:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80223d:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  802244:	e8 b5 18 00 00       	call   803afe <mutex_unlock>
+	if (r < 0) {
+  802249:	83 c4 10             	add    $0x10,%esp
+  80224c:	85 db                	test   %ebx,%ebx
+  80224e:	78 19                	js     802269 <open+0x92>
+	return fd2num(fd);
+  802250:	83 ec 0c             	sub    $0xc,%esp
+  802253:	ff 75 f4             	push   -0xc(%ebp)
+  802256:	e8 27 f6 ff ff       	call   801882 <fd2num>
+  80225b:	89 c3                	mov    %eax,%ebx
+  80225d:	83 c4 10             	add    $0x10,%esp
+}
+  802260:	89 d8                	mov    %ebx,%eax
+  802262:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802265:	5b                   	pop    %ebx
+  802266:	5e                   	pop    %esi
+  802267:	5d                   	pop    %ebp
+  802268:	c3                   	ret
+		fd_close(fd, 0);
+  802269:	83 ec 08             	sub    $0x8,%esp
+  80226c:	6a 00                	push   $0x0
+  80226e:	ff 75 f4             	push   -0xc(%ebp)
+  802271:	e8 56 f7 ff ff       	call   8019cc <fd_close>
+		return r;
+  802276:	83 c4 10             	add    $0x10,%esp
+  802279:	eb e5                	jmp    802260 <open+0x89>
+		return -E_BAD_PATH;
+  80227b:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802280:	eb de                	jmp    802260 <open+0x89>
+
+00802282 <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  802282:	55                   	push   %ebp
+  802283:	89 e5                	mov    %esp,%ebp
+  802285:	53                   	push   %ebx
+  802286:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802289:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80228c:	50                   	push   %eax
+  80228d:	ff 75 08             	push   0x8(%ebp)
+  802290:	e8 6a f6 ff ff       	call   8018ff <fd_lookup>
+  802295:	89 c3                	mov    %eax,%ebx
+  802297:	83 c4 10             	add    $0x10,%esp
+  80229a:	85 c0                	test   %eax,%eax
+  80229c:	78 5b                	js     8022f9 <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  80229e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022a1:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  8022a7:	39 08                	cmp    %ecx,(%eax)
+  8022a9:	75 55                	jne    802300 <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  8022ab:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  8022af:	74 56                	je     802307 <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  8022b1:	83 ec 0c             	sub    $0xc,%esp
+  8022b4:	68 04 70 80 00       	push   $0x807004
+  8022b9:	e8 d3 17 00 00       	call   803a91 <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  8022be:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022c1:	8b 40 0c             	mov    0xc(%eax),%eax
+  8022c4:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.allocate.req_offset = offset;
+  8022c9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022cc:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.allocate.req_len = len;
+  8022d1:	8b 45 10             	mov    0x10(%ebp),%eax
+  8022d4:	a3 08 80 80 00       	mov    %eax,0x808008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  8022d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022de:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8022e3:	e8 d1 fb ff ff       	call   801eb9 <fsipc>
+  8022e8:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8022ea:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  8022f1:	e8 08 18 00 00       	call   803afe <mutex_unlock>
+	return r;
+  8022f6:	83 c4 10             	add    $0x10,%esp
+}
+  8022f9:	89 d8                	mov    %ebx,%eax
+  8022fb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022fe:	c9                   	leave
+  8022ff:	c3                   	ret
+		return -E_NOT_SUPP;
+  802300:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802305:	eb f2                	jmp    8022f9 <fallocate+0x77>
+		return -E_INVAL;
+  802307:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80230c:	eb eb                	jmp    8022f9 <fallocate+0x77>
+
+0080230e <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  80230e:	55                   	push   %ebp
+  80230f:	89 e5                	mov    %esp,%ebp
+  802311:	56                   	push   %esi
+  802312:	53                   	push   %ebx
+  802313:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  802316:	89 f3                	mov    %esi,%ebx
+  802318:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  80231e:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  802321:	eb 06                	jmp    802329 <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  802323:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802329:	39 f3                	cmp    %esi,%ebx
+  80232b:	73 14                	jae    802341 <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  80232d:	83 ec 08             	sub    $0x8,%esp
+  802330:	53                   	push   %ebx
+  802331:	6a 00                	push   $0x0
+  802333:	e8 cb ea ff ff       	call   800e03 <sys_page_unmap>
+  802338:	83 c4 10             	add    $0x10,%esp
+  80233b:	85 c0                	test   %eax,%eax
+  80233d:	79 e4                	jns    802323 <munmap+0x15>
+  80233f:	eb 05                	jmp    802346 <munmap+0x38>
+			return r;
+	return 0;
+  802341:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802346:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802349:	5b                   	pop    %ebx
+  80234a:	5e                   	pop    %esi
+  80234b:	5d                   	pop    %ebp
+  80234c:	c3                   	ret
+
+0080234d <mmap>:
+{
+  80234d:	55                   	push   %ebp
+  80234e:	89 e5                	mov    %esp,%ebp
+  802350:	57                   	push   %edi
+  802351:	56                   	push   %esi
+  802352:	53                   	push   %ebx
+  802353:	83 ec 24             	sub    $0x24,%esp
+  802356:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802359:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80235c:	50                   	push   %eax
+  80235d:	ff 75 08             	push   0x8(%ebp)
+  802360:	e8 9a f5 ff ff       	call   8018ff <fd_lookup>
+  802365:	83 c4 10             	add    $0x10,%esp
+  802368:	85 c0                	test   %eax,%eax
+  80236a:	0f 88 37 01 00 00    	js     8024a7 <mmap+0x15a>
+		return NULL;
+  802370:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802375:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802378:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  80237e:	39 0a                	cmp    %ecx,(%edx)
+  802380:	0f 85 05 01 00 00    	jne    80248b <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  802386:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  80238d:	0f 85 1b 01 00 00    	jne    8024ae <mmap+0x161>
+  802393:	89 f0                	mov    %esi,%eax
+  802395:	83 e8 01             	sub    $0x1,%eax
+  802398:	0f 88 17 01 00 00    	js     8024b5 <mmap+0x168>
+	if (prot & PROT_WRITE)
+  80239e:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  8023a2:	75 28                	jne    8023cc <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  8023a4:	83 ec 0c             	sub    $0xc,%esp
+  8023a7:	68 04 70 80 00       	push   $0x807004
+  8023ac:	e8 e0 16 00 00       	call   803a91 <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  8023b1:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  8023b7:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  8023bd:	83 c4 10             	add    $0x10,%esp
+  8023c0:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  8023c5:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  8023ca:	eb 2b                	jmp    8023f7 <mmap+0xaa>
+		cow_enable();
+  8023cc:	e8 40 f0 ff ff       	call   801411 <cow_enable>
+  8023d1:	eb d1                	jmp    8023a4 <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  8023d3:	89 c2                	mov    %eax,%edx
+  8023d5:	c1 ea 0c             	shr    $0xc,%edx
+  8023d8:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  8023df:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8023e5:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  8023eb:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  8023ee:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  8023f0:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  8023f5:	77 25                	ja     80241c <mmap+0xcf>
+  8023f7:	89 c2                	mov    %eax,%edx
+  8023f9:	29 da                	sub    %ebx,%edx
+  8023fb:	39 ca                	cmp    %ecx,%edx
+  8023fd:	73 3a                	jae    802439 <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  8023ff:	89 c2                	mov    %eax,%edx
+  802401:	c1 ea 16             	shr    $0x16,%edx
+  802404:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80240b:	f6 c2 01             	test   $0x1,%dl
+  80240e:	75 c3                	jne    8023d3 <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  802410:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  802415:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  80241a:	eb d4                	jmp    8023f0 <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  80241c:	29 d8                	sub    %ebx,%eax
+  80241e:	39 c8                	cmp    %ecx,%eax
+  802420:	73 17                	jae    802439 <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  802422:	83 ec 0c             	sub    $0xc,%esp
+  802425:	68 04 70 80 00       	push   $0x807004
+  80242a:	e8 cf 16 00 00       	call   803afe <mutex_unlock>
+		return NULL;
+  80242f:	83 c4 10             	add    $0x10,%esp
+  802432:	b8 00 00 00 00       	mov    $0x0,%eax
+  802437:	eb 52                	jmp    80248b <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  802439:	85 db                	test   %ebx,%ebx
+  80243b:	74 e5                	je     802422 <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80243d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802440:	8b 40 0c             	mov    0xc(%eax),%eax
+  802443:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.map.req_offset = offset;
+  802448:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80244b:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.map.req_len = len;
+  802450:	89 35 08 80 80 00    	mov    %esi,0x808008
+	fsipcbuf.map.req_va = va;
+  802456:	89 1d 0c 80 80 00    	mov    %ebx,0x80800c
+	fsipcbuf.map.req_prot = prot;
+  80245c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80245f:	a3 10 80 80 00       	mov    %eax,0x808010
+	r = fsipc(FSREQ_MAP, NULL);
+  802464:	ba 00 00 00 00       	mov    $0x0,%edx
+  802469:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80246e:	e8 46 fa ff ff       	call   801eb9 <fsipc>
+  802473:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  802475:	83 ec 0c             	sub    $0xc,%esp
+  802478:	68 04 70 80 00       	push   $0x807004
+  80247d:	e8 7c 16 00 00       	call   803afe <mutex_unlock>
+	if (r < 0) {
+  802482:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  802485:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  802487:	85 ff                	test   %edi,%edi
+  802489:	78 08                	js     802493 <mmap+0x146>
+}
+  80248b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80248e:	5b                   	pop    %ebx
+  80248f:	5e                   	pop    %esi
+  802490:	5f                   	pop    %edi
+  802491:	5d                   	pop    %ebp
+  802492:	c3                   	ret
+		munmap((void*) va, len);
+  802493:	83 ec 08             	sub    $0x8,%esp
+  802496:	56                   	push   %esi
+  802497:	53                   	push   %ebx
+  802498:	e8 71 fe ff ff       	call   80230e <munmap>
+		return NULL;
+  80249d:	83 c4 10             	add    $0x10,%esp
+  8024a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024a5:	eb e4                	jmp    80248b <mmap+0x13e>
+		return NULL;
+  8024a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024ac:	eb dd                	jmp    80248b <mmap+0x13e>
+		return NULL;
+  8024ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024b3:	eb d6                	jmp    80248b <mmap+0x13e>
+  8024b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024ba:	eb cf                	jmp    80248b <mmap+0x13e>
+
+008024bc <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  8024bc:	55                   	push   %ebp
+  8024bd:	89 e5                	mov    %esp,%ebp
+  8024bf:	53                   	push   %ebx
+  8024c0:	83 ec 10             	sub    $0x10,%esp
+  8024c3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8024c6:	53                   	push   %ebx
+  8024c7:	e8 25 e4 ff ff       	call   8008f1 <strlen>
+  8024cc:	83 c4 10             	add    $0x10,%esp
+  8024cf:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8024d4:	7f 42                	jg     802518 <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  8024d6:	83 ec 0c             	sub    $0xc,%esp
+  8024d9:	68 04 70 80 00       	push   $0x807004
+  8024de:	e8 ae 15 00 00       	call   803a91 <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  8024e3:	83 c4 08             	add    $0x8,%esp
+  8024e6:	53                   	push   %ebx
+  8024e7:	68 00 80 80 00       	push   $0x808000
+  8024ec:	e8 3b e4 ff ff       	call   80092c <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  8024f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024f6:	b8 07 00 00 00       	mov    $0x7,%eax
+  8024fb:	e8 b9 f9 ff ff       	call   801eb9 <fsipc>
+  802500:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802502:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  802509:	e8 f0 15 00 00       	call   803afe <mutex_unlock>
+	return r;
+  80250e:	83 c4 10             	add    $0x10,%esp
+}
+  802511:	89 d8                	mov    %ebx,%eax
+  802513:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802516:	c9                   	leave
+  802517:	c3                   	ret
+		return -E_BAD_PATH;
+  802518:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80251d:	eb f2                	jmp    802511 <remove+0x55>
+
+0080251f <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80251f:	55                   	push   %ebp
+  802520:	89 e5                	mov    %esp,%ebp
+  802522:	53                   	push   %ebx
+  802523:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  802526:	68 04 70 80 00       	push   $0x807004
+  80252b:	e8 61 15 00 00       	call   803a91 <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  802530:	ba 00 00 00 00       	mov    $0x0,%edx
+  802535:	b8 08 00 00 00       	mov    $0x8,%eax
+  80253a:	e8 7a f9 ff ff       	call   801eb9 <fsipc>
+  80253f:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802541:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  802548:	e8 b1 15 00 00       	call   803afe <mutex_unlock>
+	return r;
+}
+  80254d:	89 d8                	mov    %ebx,%eax
+  80254f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802552:	c9                   	leave
+  802553:	c3                   	ret
+
+00802554 <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  802554:	55                   	push   %ebp
+  802555:	89 e5                	mov    %esp,%ebp
+  802557:	56                   	push   %esi
+  802558:	53                   	push   %ebx
+  802559:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  80255c:	83 ec 0c             	sub    $0xc,%esp
+  80255f:	68 04 70 80 00       	push   $0x807004
+  802564:	e8 28 15 00 00       	call   803a91 <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  802569:	8b 45 08             	mov    0x8(%ebp),%eax
+  80256c:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  802571:	ba 00 00 00 00       	mov    $0x0,%edx
+  802576:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80257b:	e8 39 f9 ff ff       	call   801eb9 <fsipc>
+  802580:	89 c6                	mov    %eax,%esi
+  802582:	83 c4 10             	add    $0x10,%esp
+  802585:	85 db                	test   %ebx,%ebx
+  802587:	74 7b                	je     802604 <fs_bcstat+0xb0>
+  802589:	85 c0                	test   %eax,%eax
+  80258b:	78 77                	js     802604 <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  80258d:	a1 00 80 80 00       	mov    0x808000,%eax
+  802592:	89 03                	mov    %eax,(%ebx)
+  802594:	a1 04 80 80 00       	mov    0x808004,%eax
+  802599:	89 43 04             	mov    %eax,0x4(%ebx)
+  80259c:	a1 08 80 80 00       	mov    0x808008,%eax
+  8025a1:	89 43 08             	mov    %eax,0x8(%ebx)
+  8025a4:	a1 0c 80 80 00       	mov    0x80800c,%eax
+  8025a9:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8025ac:	a1 10 80 80 00       	mov    0x808010,%eax
+  8025b1:	89 43 10             	mov    %eax,0x10(%ebx)
+  8025b4:	a1 14 80 80 00       	mov    0x808014,%eax
+  8025b9:	89 43 14             	mov    %eax,0x14(%ebx)
+  8025bc:	a1 18 80 80 00       	mov    0x808018,%eax
+  8025c1:	89 43 18             	mov    %eax,0x18(%ebx)
+  8025c4:	a1 1c 80 80 00       	mov    0x80801c,%eax
+  8025c9:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  8025cc:	a1 20 80 80 00       	mov    0x808020,%eax
+  8025d1:	89 43 20             	mov    %eax,0x20(%ebx)
+  8025d4:	a1 24 80 80 00       	mov    0x808024,%eax
+  8025d9:	89 43 24             	mov    %eax,0x24(%ebx)
+  8025dc:	a1 28 80 80 00       	mov    0x808028,%eax
+  8025e1:	89 43 28             	mov    %eax,0x28(%ebx)
+  8025e4:	a1 2c 80 80 00       	mov    0x80802c,%eax
+  8025e9:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  8025ec:	a1 30 80 80 00       	mov    0x808030,%eax
+  8025f1:	89 43 30             	mov    %eax,0x30(%ebx)
+  8025f4:	a1 34 80 80 00       	mov    0x808034,%eax
+  8025f9:	89 43 34             	mov    %eax,0x34(%ebx)
+  8025fc:	a1 38 80 80 00       	mov    0x808038,%eax
+  802601:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  802604:	83 ec 0c             	sub    $0xc,%esp
+  802607:	68 04 70 80 00       	push   $0x807004
+  80260c:	e8 ed 14 00 00       	call   803afe <mutex_unlock>
+	return r;
+}
+  802611:	89 f0                	mov    %esi,%eax
+  802613:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802616:	5b                   	pop    %ebx
+  802617:	5e                   	pop    %esi
+  802618:	5d                   	pop    %ebp
+  802619:	c3                   	ret
+
+0080261a <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  80261a:	55                   	push   %ebp
+  80261b:	89 e5                	mov    %esp,%ebp
+  80261d:	56                   	push   %esi
+  80261e:	53                   	push   %ebx
+  80261f:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  802621:	0f b6 10             	movzbl (%eax),%edx
+  802624:	80 fa 72             	cmp    $0x72,%dl
+  802627:	74 44                	je     80266d <parse_mode+0x53>
+  802629:	80 fa 77             	cmp    $0x77,%dl
+  80262c:	74 4b                	je     802679 <parse_mode+0x5f>
+  80262e:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802633:	80 fa 61             	cmp    $0x61,%dl
+  802636:	74 09                	je     802641 <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  802638:	89 d8                	mov    %ebx,%eax
+  80263a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80263d:	5b                   	pop    %ebx
+  80263e:	5e                   	pop    %esi
+  80263f:	5d                   	pop    %ebp
+  802640:	c3                   	ret
+	switch (mode[0]) {
+  802641:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  802646:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  80264b:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  80264d:	83 ec 08             	sub    $0x8,%esp
+  802650:	6a 2b                	push   $0x2b
+  802652:	50                   	push   %eax
+  802653:	e8 e6 e3 ff ff       	call   800a3e <strchr>
+  802658:	83 c4 10             	add    $0x10,%esp
+  80265b:	85 c0                	test   %eax,%eax
+  80265d:	74 d9                	je     802638 <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  80265f:	83 e3 fc             	and    $0xfffffffc,%ebx
+  802662:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  802665:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  80266b:	eb cb                	jmp    802638 <parse_mode+0x1e>
+	switch (mode[0]) {
+  80266d:	ba 01 00 00 00       	mov    $0x1,%edx
+  802672:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802677:	eb d2                	jmp    80264b <parse_mode+0x31>
+  802679:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  80267e:	bb 01 03 00 00       	mov    $0x301,%ebx
+  802683:	eb c6                	jmp    80264b <parse_mode+0x31>
+
+00802685 <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  802685:	55                   	push   %ebp
+  802686:	89 e5                	mov    %esp,%ebp
+  802688:	57                   	push   %edi
+  802689:	56                   	push   %esi
+  80268a:	53                   	push   %ebx
+  80268b:	83 ec 1c             	sub    $0x1c,%esp
+  80268e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802691:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  802694:	b8 24 60 80 00       	mov    $0x806024,%eax
+  802699:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  80269e:	83 c0 24             	add    $0x24,%eax
+  8026a1:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  8026a5:	74 17                	je     8026be <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  8026a7:	83 c3 01             	add    $0x1,%ebx
+  8026aa:	83 fb 10             	cmp    $0x10,%ebx
+  8026ad:	75 ef                	jne    80269e <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  8026af:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  8026b4:	89 f0                	mov    %esi,%eax
+  8026b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026b9:	5b                   	pop    %ebx
+  8026ba:	5e                   	pop    %esi
+  8026bb:	5f                   	pop    %edi
+  8026bc:	5d                   	pop    %ebp
+  8026bd:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  8026be:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  8026c5:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8026c8:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  8026cb:	c1 e7 02             	shl    $0x2,%edi
+  8026ce:	8d b7 20 60 80 00    	lea    0x806020(%edi),%esi
+  8026d4:	83 ec 04             	sub    $0x4,%esp
+  8026d7:	6a 24                	push   $0x24
+  8026d9:	6a 00                	push   $0x0
+  8026db:	56                   	push   %esi
+  8026dc:	e8 9c e3 ff ff       	call   800a7d <memset>
+			streams[i].f_fd = fd;
+  8026e1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8026e4:	89 8f 20 60 80 00    	mov    %ecx,0x806020(%edi)
+			streams[i].f_flags = flags;
+  8026ea:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8026ed:	01 d8                	add    %ebx,%eax
+  8026ef:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8026f2:	89 0c 85 24 60 80 00 	mov    %ecx,0x806024(,%eax,4)
+			return &streams[i];
+  8026f9:	83 c4 10             	add    $0x10,%esp
+  8026fc:	eb b6                	jmp    8026b4 <stream_alloc+0x2f>
+
+008026fe <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  8026fe:	55                   	push   %ebp
+  8026ff:	89 e5                	mov    %esp,%ebp
+  802701:	53                   	push   %ebx
+  802702:	83 ec 14             	sub    $0x14,%esp
+  802705:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  802707:	8b 40 18             	mov    0x18(%eax),%eax
+  80270a:	39 43 14             	cmp    %eax,0x14(%ebx)
+  80270d:	74 4a                	je     802759 <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  80270f:	83 ec 08             	sub    $0x8,%esp
+  802712:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802715:	50                   	push   %eax
+  802716:	ff 33                	push   (%ebx)
+  802718:	e8 e2 f1 ff ff       	call   8018ff <fd_lookup>
+  80271d:	89 c2                	mov    %eax,%edx
+  80271f:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802722:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802727:	85 d2                	test   %edx,%edx
+  802729:	78 41                	js     80276c <stream_unread+0x6e>
+  80272b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80272e:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  802734:	39 0a                	cmp    %ecx,(%edx)
+  802736:	75 34                	jne    80276c <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  802738:	8b 43 14             	mov    0x14(%ebx),%eax
+  80273b:	03 42 04             	add    0x4(%edx),%eax
+  80273e:	2b 43 18             	sub    0x18(%ebx),%eax
+  802741:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  802744:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  80274b:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  802752:	b8 01 00 00 00       	mov    $0x1,%eax
+  802757:	eb 13                	jmp    80276c <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  802759:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  802760:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  802767:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80276c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80276f:	c9                   	leave
+  802770:	c3                   	ret
+
+00802771 <stream_drain>:
+{
+  802771:	55                   	push   %ebp
+  802772:	89 e5                	mov    %esp,%ebp
+  802774:	56                   	push   %esi
+  802775:	53                   	push   %ebx
+  802776:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  802778:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80277d:	eb 02                	jmp    802781 <stream_drain+0x10>
+  80277f:	01 c3                	add    %eax,%ebx
+  802781:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802784:	39 c3                	cmp    %eax,%ebx
+  802786:	73 43                	jae    8027cb <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  802788:	83 ec 04             	sub    $0x4,%esp
+  80278b:	29 d8                	sub    %ebx,%eax
+  80278d:	50                   	push   %eax
+  80278e:	89 d8                	mov    %ebx,%eax
+  802790:	03 46 0c             	add    0xc(%esi),%eax
+  802793:	50                   	push   %eax
+  802794:	ff 36                	push   (%esi)
+  802796:	e8 ec f4 ff ff       	call   801c87 <write>
+  80279b:	83 c4 10             	add    $0x10,%esp
+  80279e:	85 c0                	test   %eax,%eax
+  8027a0:	7f dd                	jg     80277f <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  8027a2:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  8027a6:	8b 56 0c             	mov    0xc(%esi),%edx
+  8027a9:	83 ec 04             	sub    $0x4,%esp
+  8027ac:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8027af:	29 d8                	sub    %ebx,%eax
+  8027b1:	50                   	push   %eax
+  8027b2:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  8027b5:	50                   	push   %eax
+  8027b6:	52                   	push   %edx
+  8027b7:	e8 f6 e2 ff ff       	call   800ab2 <memmove>
+			f->f_wend -= done;
+  8027bc:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8027bf:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  8027c1:	83 c4 10             	add    $0x10,%esp
+  8027c4:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8027c9:	eb 0a                	jmp    8027d5 <stream_drain+0x64>
+  8027cb:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  8027d0:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  8027d5:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  8027d8:	89 d0                	mov    %edx,%eax
+  8027da:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027dd:	5b                   	pop    %ebx
+  8027de:	5e                   	pop    %esi
+  8027df:	5d                   	pop    %ebp
+  8027e0:	c3                   	ret
+
+008027e1 <stream_setup>:
+	if (f->f_buf)
+  8027e1:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8027e5:	74 01                	je     8027e8 <stream_setup+0x7>
+  8027e7:	c3                   	ret
+{
+  8027e8:	55                   	push   %ebp
+  8027e9:	89 e5                	mov    %esp,%ebp
+  8027eb:	53                   	push   %ebx
+  8027ec:	83 ec 04             	sub    $0x4,%esp
+  8027ef:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  8027f1:	8b 40 08             	mov    0x8(%eax),%eax
+  8027f4:	85 c0                	test   %eax,%eax
+  8027f6:	74 17                	je     80280f <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  8027f8:	83 f8 03             	cmp    $0x3,%eax
+  8027fb:	75 2d                	jne    80282a <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  8027fd:	8d 43 20             	lea    0x20(%ebx),%eax
+  802800:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  802803:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  80280a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80280d:	c9                   	leave
+  80280e:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  80280f:	83 ec 0c             	sub    $0xc,%esp
+  802812:	ff 33                	push   (%ebx)
+  802814:	e8 7a 1b 00 00       	call   804393 <iscons>
+  802819:	83 c4 10             	add    $0x10,%esp
+  80281c:	85 c0                	test   %eax,%eax
+  80281e:	0f 9f c0             	setg   %al
+  802821:	0f b6 c0             	movzbl %al,%eax
+  802824:	83 c0 01             	add    $0x1,%eax
+  802827:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  80282a:	83 ec 0c             	sub    $0xc,%esp
+  80282d:	68 00 10 00 00       	push   $0x1000
+  802832:	e8 6e 0b 00 00       	call   8033a5 <malloc>
+  802837:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80283a:	83 c4 10             	add    $0x10,%esp
+  80283d:	85 c0                	test   %eax,%eax
+  80283f:	74 bc                	je     8027fd <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  802841:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  802848:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  80284c:	eb bc                	jmp    80280a <stream_setup+0x29>
+
+0080284e <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  80284e:	55                   	push   %ebp
+  80284f:	89 e5                	mov    %esp,%ebp
+  802851:	53                   	push   %ebx
+  802852:	83 ec 04             	sub    $0x4,%esp
+  802855:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  802857:	e8 85 ff ff ff       	call   8027e1 <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  80285c:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  802861:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  802865:	74 3d                	je     8028a4 <stream_fill+0x56>
+  802867:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  80286b:	74 10                	je     80287d <stream_fill+0x2f>
+  80286d:	89 d8                	mov    %ebx,%eax
+  80286f:	e8 fd fe ff ff       	call   802771 <stream_drain>
+		return 0;
+  802874:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  802879:	85 c0                	test   %eax,%eax
+  80287b:	78 27                	js     8028a4 <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  80287d:	83 ec 04             	sub    $0x4,%esp
+  802880:	ff 73 10             	push   0x10(%ebx)
+  802883:	ff 73 0c             	push   0xc(%ebx)
+  802886:	ff 33                	push   (%ebx)
+  802888:	e8 02 f3 ff ff       	call   801b8f <read>
+  80288d:	83 c4 10             	add    $0x10,%esp
+  802890:	85 c0                	test   %eax,%eax
+  802892:	7e 17                	jle    8028ab <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  802894:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  802898:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  80289f:	89 c2                	mov    %eax,%edx
+  8028a1:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  8028a4:	89 d0                	mov    %edx,%eax
+  8028a6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028a9:	c9                   	leave
+  8028aa:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  8028ab:	c1 f8 1f             	sar    $0x1f,%eax
+  8028ae:	83 e0 04             	and    $0x4,%eax
+  8028b1:	83 c0 04             	add    $0x4,%eax
+  8028b4:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  8028b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028bc:	eb e6                	jmp    8028a4 <stream_fill+0x56>
+
+008028be <fopen>:
+{
+  8028be:	55                   	push   %ebp
+  8028bf:	89 e5                	mov    %esp,%ebp
+  8028c1:	57                   	push   %edi
+  8028c2:	56                   	push   %esi
+  8028c3:	53                   	push   %ebx
+  8028c4:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  8028ca:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8028cd:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  8028d3:	89 f0                	mov    %esi,%eax
+  8028d5:	e8 40 fd ff ff       	call   80261a <parse_mode>
+		return 0;
+  8028da:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8028df:	85 c0                	test   %eax,%eax
+  8028e1:	78 2d                	js     802910 <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  8028e3:	83 ec 08             	sub    $0x8,%esp
+  8028e6:	50                   	push   %eax
+  8028e7:	ff 75 08             	push   0x8(%ebp)
+  8028ea:	e8 e8 f8 ff ff       	call   8021d7 <open>
+  8028ef:	89 c7                	mov    %eax,%edi
+  8028f1:	83 c4 10             	add    $0x10,%esp
+  8028f4:	85 c0                	test   %eax,%eax
+  8028f6:	78 58                	js     802950 <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  8028f8:	80 3e 61             	cmpb   $0x61,(%esi)
+  8028fb:	74 1d                	je     80291a <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  8028fd:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  802903:	89 f8                	mov    %edi,%eax
+  802905:	e8 7b fd ff ff       	call   802685 <stream_alloc>
+  80290a:	89 c3                	mov    %eax,%ebx
+  80290c:	85 c0                	test   %eax,%eax
+  80290e:	74 32                	je     802942 <fopen+0x84>
+}
+  802910:	89 d8                	mov    %ebx,%eax
+  802912:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802915:	5b                   	pop    %ebx
+  802916:	5e                   	pop    %esi
+  802917:	5f                   	pop    %edi
+  802918:	5d                   	pop    %ebp
+  802919:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  80291a:	83 ec 08             	sub    $0x8,%esp
+  80291d:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  802923:	50                   	push   %eax
+  802924:	57                   	push   %edi
+  802925:	e8 db f4 ff ff       	call   801e05 <fstat>
+  80292a:	83 c4 10             	add    $0x10,%esp
+  80292d:	85 c0                	test   %eax,%eax
+  80292f:	78 cc                	js     8028fd <fopen+0x3f>
+		seek(fd, st.st_size);
+  802931:	83 ec 08             	sub    $0x8,%esp
+  802934:	ff 75 dc             	push   -0x24(%ebp)
+  802937:	57                   	push   %edi
+  802938:	e8 f6 f3 ff ff       	call   801d33 <seek>
+  80293d:	83 c4 10             	add    $0x10,%esp
+  802940:	eb bb                	jmp    8028fd <fopen+0x3f>
+		close(fd);
+  802942:	83 ec 0c             	sub    $0xc,%esp
+  802945:	57                   	push   %edi
+  802946:	e8 08 f1 ff ff       	call   801a53 <close>
+  80294b:	83 c4 10             	add    $0x10,%esp
+  80294e:	eb c0                	jmp    802910 <fopen+0x52>
+		return 0;
+  802950:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802955:	eb b9                	jmp    802910 <fopen+0x52>
+
+00802957 <fdopen>:
+{
+  802957:	55                   	push   %ebp
+  802958:	89 e5                	mov    %esp,%ebp
+  80295a:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  80295d:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802960:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802963:	e8 b2 fc ff ff       	call   80261a <parse_mode>
+  802968:	89 c2                	mov    %eax,%edx
+		return 0;
+  80296a:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  80296f:	85 d2                	test   %edx,%edx
+  802971:	78 0b                	js     80297e <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  802973:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802976:	8b 45 08             	mov    0x8(%ebp),%eax
+  802979:	e8 07 fd ff ff       	call   802685 <stream_alloc>
+}
+  80297e:	c9                   	leave
+  80297f:	c3                   	ret
+
+00802980 <setvbuf>:
+{
+  802980:	55                   	push   %ebp
+  802981:	89 e5                	mov    %esp,%ebp
+  802983:	57                   	push   %edi
+  802984:	56                   	push   %esi
+  802985:	53                   	push   %ebx
+  802986:	8b 45 08             	mov    0x8(%ebp),%eax
+  802989:	8b 55 10             	mov    0x10(%ebp),%edx
+  80298c:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  80298f:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802993:	75 3a                	jne    8029cf <setvbuf+0x4f>
+  802995:	8d 72 ff             	lea    -0x1(%edx),%esi
+  802998:	83 fe 02             	cmp    $0x2,%esi
+  80299b:	77 39                	ja     8029d6 <setvbuf+0x56>
+	f->f_bufmode = mode;
+  80299d:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  8029a0:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8029a4:	0f 95 c3             	setne  %bl
+  8029a7:	85 ff                	test   %edi,%edi
+  8029a9:	0f 95 c1             	setne  %cl
+  8029ac:	84 cb                	test   %cl,%bl
+  8029ae:	74 05                	je     8029b5 <setvbuf+0x35>
+  8029b0:	83 fa 03             	cmp    $0x3,%edx
+  8029b3:	75 0a                	jne    8029bf <setvbuf+0x3f>
+	return 0;
+  8029b5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8029ba:	5b                   	pop    %ebx
+  8029bb:	5e                   	pop    %esi
+  8029bc:	5f                   	pop    %edi
+  8029bd:	5d                   	pop    %ebp
+  8029be:	c3                   	ret
+		f->f_buf = buf;
+  8029bf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8029c2:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  8029c5:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  8029c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029cd:	eb eb                	jmp    8029ba <setvbuf+0x3a>
+		return EOF;
+  8029cf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8029d4:	eb e4                	jmp    8029ba <setvbuf+0x3a>
+  8029d6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8029db:	eb dd                	jmp    8029ba <setvbuf+0x3a>
+
+008029dd <fflush>:
+{
+  8029dd:	55                   	push   %ebp
+  8029de:	89 e5                	mov    %esp,%ebp
+  8029e0:	57                   	push   %edi
+  8029e1:	56                   	push   %esi
+  8029e2:	53                   	push   %ebx
+  8029e3:	83 ec 0c             	sub    $0xc,%esp
+  8029e6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  8029e9:	85 db                	test   %ebx,%ebx
+  8029eb:	74 1a                	je     802a07 <fflush+0x2a>
+	stream_unread(f);
+  8029ed:	89 d8                	mov    %ebx,%eax
+  8029ef:	e8 0a fd ff ff       	call   8026fe <stream_unread>
+	return stream_drain(f);
+  8029f4:	89 d8                	mov    %ebx,%eax
+  8029f6:	e8 76 fd ff ff       	call   802771 <stream_drain>
+  8029fb:	89 c7                	mov    %eax,%edi
+}
+  8029fd:	89 f8                	mov    %edi,%eax
+  8029ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a02:	5b                   	pop    %ebx
+  802a03:	5e                   	pop    %esi
+  802a04:	5f                   	pop    %edi
+  802a05:	5d                   	pop    %ebp
+  802a06:	c3                   	ret
+  802a07:	bb 20 60 80 00       	mov    $0x806020,%ebx
+  802a0c:	be 60 62 80 00       	mov    $0x806260,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  802a11:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a16:	eb 03                	jmp    802a1b <fflush+0x3e>
+  802a18:	83 c3 24             	add    $0x24,%ebx
+  802a1b:	39 f3                	cmp    %esi,%ebx
+  802a1d:	74 de                	je     8029fd <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  802a1f:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  802a23:	74 f3                	je     802a18 <fflush+0x3b>
+  802a25:	83 ec 0c             	sub    $0xc,%esp
+  802a28:	53                   	push   %ebx
+  802a29:	e8 af ff ff ff       	call   8029dd <fflush>
+  802a2e:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  802a31:	85 c0                	test   %eax,%eax
+  802a33:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802a38:	0f 48 f8             	cmovs  %eax,%edi
+  802a3b:	eb db                	jmp    802a18 <fflush+0x3b>
+
+00802a3d <fclose>:
+{
+  802a3d:	55                   	push   %ebp
+  802a3e:	89 e5                	mov    %esp,%ebp
+  802a40:	56                   	push   %esi
+  802a41:	53                   	push   %ebx
+  802a42:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  802a45:	83 ec 0c             	sub    $0xc,%esp
+  802a48:	56                   	push   %esi
+  802a49:	e8 8f ff ff ff       	call   8029dd <fflush>
+  802a4e:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  802a50:	83 c4 04             	add    $0x4,%esp
+  802a53:	ff 36                	push   (%esi)
+  802a55:	e8 f9 ef ff ff       	call   801a53 <close>
+  802a5a:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  802a5d:	85 c0                	test   %eax,%eax
+  802a5f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802a64:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  802a67:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  802a6b:	75 10                	jne    802a7d <fclose+0x40>
+	f->f_flags = 0;
+  802a6d:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  802a74:	89 d8                	mov    %ebx,%eax
+  802a76:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a79:	5b                   	pop    %ebx
+  802a7a:	5e                   	pop    %esi
+  802a7b:	5d                   	pop    %ebp
+  802a7c:	c3                   	ret
+		free(f->f_buf);
+  802a7d:	83 ec 0c             	sub    $0xc,%esp
+  802a80:	ff 76 0c             	push   0xc(%esi)
+  802a83:	e8 54 08 00 00       	call   8032dc <free>
+  802a88:	83 c4 10             	add    $0x10,%esp
+  802a8b:	eb e0                	jmp    802a6d <fclose+0x30>
+
+00802a8d <fileno>:
+{
+  802a8d:	55                   	push   %ebp
+  802a8e:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  802a90:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a93:	8b 00                	mov    (%eax),%eax
+}
+  802a95:	5d                   	pop    %ebp
+  802a96:	c3                   	ret
+
+00802a97 <feof>:
+{
+  802a97:	55                   	push   %ebp
+  802a98:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  802a9a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a9d:	8b 40 04             	mov    0x4(%eax),%eax
+  802aa0:	c1 e8 02             	shr    $0x2,%eax
+  802aa3:	83 e0 01             	and    $0x1,%eax
+}
+  802aa6:	5d                   	pop    %ebp
+  802aa7:	c3                   	ret
+
+00802aa8 <ferror>:
+{
+  802aa8:	55                   	push   %ebp
+  802aa9:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  802aab:	8b 45 08             	mov    0x8(%ebp),%eax
+  802aae:	8b 40 04             	mov    0x4(%eax),%eax
+  802ab1:	c1 e8 03             	shr    $0x3,%eax
+  802ab4:	83 e0 01             	and    $0x1,%eax
+}
+  802ab7:	5d                   	pop    %ebp
+  802ab8:	c3                   	ret
+
+00802ab9 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  802ab9:	55                   	push   %ebp
+  802aba:	89 e5                	mov    %esp,%ebp
+  802abc:	53                   	push   %ebx
+  802abd:	83 ec 04             	sub    $0x4,%esp
+  802ac0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802ac3:	8b 43 18             	mov    0x18(%ebx),%eax
+  802ac6:	39 43 14             	cmp    %eax,0x14(%ebx)
+  802ac9:	74 15                	je     802ae0 <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  802acb:	8b 53 0c             	mov    0xc(%ebx),%edx
+  802ace:	8b 43 14             	mov    0x14(%ebx),%eax
+  802ad1:	8d 48 01             	lea    0x1(%eax),%ecx
+  802ad4:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  802ad7:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  802adb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ade:	c9                   	leave
+  802adf:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802ae0:	89 d8                	mov    %ebx,%eax
+  802ae2:	e8 67 fd ff ff       	call   80284e <stream_fill>
+  802ae7:	85 c0                	test   %eax,%eax
+  802ae9:	75 e0                	jne    802acb <fgetc+0x12>
+		return EOF;
+  802aeb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802af0:	eb e9                	jmp    802adb <fgetc+0x22>
+
+00802af2 <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  802af2:	55                   	push   %ebp
+  802af3:	89 e5                	mov    %esp,%ebp
+  802af5:	57                   	push   %edi
+  802af6:	56                   	push   %esi
+  802af7:	53                   	push   %ebx
+  802af8:	83 ec 1c             	sub    $0x1c,%esp
+  802afb:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  802afe:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802b03:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b06:	83 e8 01             	sub    $0x1,%eax
+  802b09:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  802b0c:	eb 66                	jmp    802b74 <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802b0e:	8b 46 14             	mov    0x14(%esi),%eax
+  802b11:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802b14:	29 c3                	sub    %eax,%ebx
+  802b16:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802b19:	29 fa                	sub    %edi,%edx
+  802b1b:	39 d3                	cmp    %edx,%ebx
+  802b1d:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802b20:	83 ec 04             	sub    $0x4,%esp
+  802b23:	53                   	push   %ebx
+  802b24:	6a 0a                	push   $0xa
+  802b26:	03 46 0c             	add    0xc(%esi),%eax
+  802b29:	50                   	push   %eax
+  802b2a:	e8 34 e0 ff ff       	call   800b63 <memfind>
+  802b2f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  802b32:	8b 46 0c             	mov    0xc(%esi),%eax
+  802b35:	8b 4e 14             	mov    0x14(%esi),%ecx
+  802b38:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  802b3b:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802b3d:	83 c4 10             	add    $0x10,%esp
+  802b40:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802b43:	74 0b                	je     802b50 <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  802b45:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802b48:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802b4b:	29 d3                	sub    %edx,%ebx
+  802b4d:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  802b50:	83 ec 04             	sub    $0x4,%esp
+  802b53:	53                   	push   %ebx
+  802b54:	01 c8                	add    %ecx,%eax
+  802b56:	50                   	push   %eax
+  802b57:	89 f8                	mov    %edi,%eax
+  802b59:	03 45 08             	add    0x8(%ebp),%eax
+  802b5c:	50                   	push   %eax
+  802b5d:	e8 50 df ff ff       	call   800ab2 <memmove>
+		f->f_rpos += m;
+  802b62:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  802b65:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  802b67:	83 c4 10             	add    $0x10,%esp
+  802b6a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b6d:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  802b72:	74 1f                	je     802b93 <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  802b74:	8d 47 01             	lea    0x1(%edi),%eax
+  802b77:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  802b7a:	73 17                	jae    802b93 <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802b7c:	8b 46 18             	mov    0x18(%esi),%eax
+  802b7f:	39 46 14             	cmp    %eax,0x14(%esi)
+  802b82:	75 8a                	jne    802b0e <fgets+0x1c>
+  802b84:	89 f0                	mov    %esi,%eax
+  802b86:	e8 c3 fc ff ff       	call   80284e <stream_fill>
+  802b8b:	85 c0                	test   %eax,%eax
+  802b8d:	0f 85 7b ff ff ff    	jne    802b0e <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  802b93:	85 ff                	test   %edi,%edi
+  802b95:	74 0f                	je     802ba6 <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  802b97:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b9a:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  802b9e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ba1:	5b                   	pop    %ebx
+  802ba2:	5e                   	pop    %esi
+  802ba3:	5f                   	pop    %edi
+  802ba4:	5d                   	pop    %ebp
+  802ba5:	c3                   	ret
+		return 0;
+  802ba6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bab:	eb f1                	jmp    802b9e <fgets+0xac>
+
+00802bad <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  802bad:	55                   	push   %ebp
+  802bae:	89 e5                	mov    %esp,%ebp
+  802bb0:	57                   	push   %edi
+  802bb1:	56                   	push   %esi
+  802bb2:	53                   	push   %ebx
+  802bb3:	83 ec 1c             	sub    $0x1c,%esp
+  802bb6:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  802bb9:	89 f0                	mov    %esi,%eax
+  802bbb:	e8 21 fc ff ff       	call   8027e1 <stream_setup>
+	want = size * n;
+  802bc0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802bc3:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802bc7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  802bca:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bcf:	eb 43                	jmp    802c14 <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  802bd1:	29 d3                	sub    %edx,%ebx
+  802bd3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802bd6:	29 f8                	sub    %edi,%eax
+  802bd8:	39 c3                	cmp    %eax,%ebx
+  802bda:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  802bdd:	83 ec 04             	sub    $0x4,%esp
+  802be0:	53                   	push   %ebx
+  802be1:	03 56 0c             	add    0xc(%esi),%edx
+  802be4:	52                   	push   %edx
+  802be5:	89 f8                	mov    %edi,%eax
+  802be7:	03 45 08             	add    0x8(%ebp),%eax
+  802bea:	50                   	push   %eax
+  802beb:	e8 c2 de ff ff       	call   800ab2 <memmove>
+			f->f_rpos += m;
+  802bf0:	01 5e 14             	add    %ebx,0x14(%esi)
+  802bf3:	83 c4 10             	add    $0x10,%esp
+  802bf6:	eb 1a                	jmp    802c12 <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  802bf8:	83 ec 04             	sub    $0x4,%esp
+  802bfb:	53                   	push   %ebx
+  802bfc:	89 f8                	mov    %edi,%eax
+  802bfe:	03 45 08             	add    0x8(%ebp),%eax
+  802c01:	50                   	push   %eax
+  802c02:	ff 36                	push   (%esi)
+  802c04:	e8 86 ef ff ff       	call   801b8f <read>
+  802c09:	89 c3                	mov    %eax,%ebx
+  802c0b:	83 c4 10             	add    $0x10,%esp
+  802c0e:	85 c0                	test   %eax,%eax
+  802c10:	7e 36                	jle    802c48 <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  802c12:	01 df                	add    %ebx,%edi
+  802c14:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802c17:	39 c7                	cmp    %eax,%edi
+  802c19:	73 39                	jae    802c54 <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  802c1b:	8b 56 14             	mov    0x14(%esi),%edx
+  802c1e:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802c21:	39 da                	cmp    %ebx,%edx
+  802c23:	72 ac                	jb     802bd1 <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  802c25:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802c28:	29 fb                	sub    %edi,%ebx
+  802c2a:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  802c2d:	72 3e                	jb     802c6d <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  802c2f:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  802c33:	74 1f                	je     802c54 <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  802c35:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  802c39:	74 bd                	je     802bf8 <fread+0x4b>
+  802c3b:	89 f0                	mov    %esi,%eax
+  802c3d:	e8 2f fb ff ff       	call   802771 <stream_drain>
+  802c42:	85 c0                	test   %eax,%eax
+  802c44:	79 b2                	jns    802bf8 <fread+0x4b>
+  802c46:	eb 0c                	jmp    802c54 <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802c48:	c1 fb 1f             	sar    $0x1f,%ebx
+  802c4b:	83 e3 04             	and    $0x4,%ebx
+  802c4e:	83 c3 04             	add    $0x4,%ebx
+  802c51:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  802c54:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c57:	85 c0                	test   %eax,%eax
+  802c59:	74 0a                	je     802c65 <fread+0xb8>
+  802c5b:	89 f8                	mov    %edi,%eax
+  802c5d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c62:	f7 75 0c             	divl   0xc(%ebp)
+}
+  802c65:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c68:	5b                   	pop    %ebx
+  802c69:	5e                   	pop    %esi
+  802c6a:	5f                   	pop    %edi
+  802c6b:	5d                   	pop    %ebp
+  802c6c:	c3                   	ret
+		} else if (!stream_fill(f))
+  802c6d:	89 f0                	mov    %esi,%eax
+  802c6f:	e8 da fb ff ff       	call   80284e <stream_fill>
+  802c74:	85 c0                	test   %eax,%eax
+  802c76:	74 dc                	je     802c54 <fread+0xa7>
+			m = 0;
+  802c78:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c7d:	eb 93                	jmp    802c12 <fread+0x65>
+
+00802c7f <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  802c7f:	55                   	push   %ebp
+  802c80:	89 e5                	mov    %esp,%ebp
+  802c82:	57                   	push   %edi
+  802c83:	56                   	push   %esi
+  802c84:	53                   	push   %ebx
+  802c85:	83 ec 1c             	sub    $0x1c,%esp
+  802c88:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  802c8b:	8b 43 04             	mov    0x4(%ebx),%eax
+  802c8e:	a8 02                	test   $0x2,%al
+  802c90:	75 13                	jne    802ca5 <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  802c92:	83 c8 08             	or     $0x8,%eax
+  802c95:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  802c98:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  802c9d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ca0:	5b                   	pop    %ebx
+  802ca1:	5e                   	pop    %esi
+  802ca2:	5f                   	pop    %edi
+  802ca3:	5d                   	pop    %ebp
+  802ca4:	c3                   	ret
+	stream_setup(f);
+  802ca5:	89 d8                	mov    %ebx,%eax
+  802ca7:	e8 35 fb ff ff       	call   8027e1 <stream_setup>
+	want = size * n;
+  802cac:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802caf:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802cb3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  802cb6:	89 d8                	mov    %ebx,%eax
+  802cb8:	e8 41 fa ff ff       	call   8026fe <stream_unread>
+	for (done = 0; done < want; ) {
+  802cbd:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  802cc2:	84 c0                	test   %al,%al
+  802cc4:	75 7b                	jne    802d41 <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  802cc6:	be 00 00 00 00       	mov    $0x0,%esi
+  802ccb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802cce:	39 fe                	cmp    %edi,%esi
+  802cd0:	73 24                	jae    802cf6 <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802cd2:	83 ec 04             	sub    $0x4,%esp
+  802cd5:	89 f8                	mov    %edi,%eax
+  802cd7:	29 f0                	sub    %esi,%eax
+  802cd9:	50                   	push   %eax
+  802cda:	89 f0                	mov    %esi,%eax
+  802cdc:	03 45 08             	add    0x8(%ebp),%eax
+  802cdf:	50                   	push   %eax
+  802ce0:	ff 33                	push   (%ebx)
+  802ce2:	e8 a0 ef ff ff       	call   801c87 <write>
+  802ce7:	83 c4 10             	add    $0x10,%esp
+  802cea:	85 c0                	test   %eax,%eax
+  802cec:	7e 04                	jle    802cf2 <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  802cee:	01 c6                	add    %eax,%esi
+  802cf0:	eb dc                	jmp    802cce <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  802cf2:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  802cf6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802cf9:	85 c0                	test   %eax,%eax
+  802cfb:	74 a0                	je     802c9d <fwrite+0x1e>
+  802cfd:	89 f0                	mov    %esi,%eax
+  802cff:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d04:	f7 75 0c             	divl   0xc(%ebp)
+  802d07:	eb 94                	jmp    802c9d <fwrite+0x1e>
+			done += r;
+  802d09:	01 c7                	add    %eax,%edi
+			continue;
+  802d0b:	eb 34                	jmp    802d41 <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  802d0d:	8b 73 10             	mov    0x10(%ebx),%esi
+  802d10:	29 c6                	sub    %eax,%esi
+  802d12:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802d15:	29 fa                	sub    %edi,%edx
+  802d17:	39 d6                	cmp    %edx,%esi
+  802d19:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  802d1c:	83 ec 04             	sub    $0x4,%esp
+  802d1f:	56                   	push   %esi
+  802d20:	89 fa                	mov    %edi,%edx
+  802d22:	03 55 08             	add    0x8(%ebp),%edx
+  802d25:	52                   	push   %edx
+  802d26:	03 43 0c             	add    0xc(%ebx),%eax
+  802d29:	50                   	push   %eax
+  802d2a:	e8 83 dd ff ff       	call   800ab2 <memmove>
+		f->f_wend += m;
+  802d2f:	89 f0                	mov    %esi,%eax
+  802d31:	03 43 1c             	add    0x1c(%ebx),%eax
+  802d34:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  802d37:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802d39:	83 c4 10             	add    $0x10,%esp
+  802d3c:	3b 43 10             	cmp    0x10(%ebx),%eax
+  802d3f:	74 5b                	je     802d9c <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  802d41:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802d44:	39 c7                	cmp    %eax,%edi
+  802d46:	73 2d                	jae    802d75 <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  802d48:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802d4b:	85 c0                	test   %eax,%eax
+  802d4d:	75 be                	jne    802d0d <fwrite+0x8e>
+  802d4f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802d52:	29 fa                	sub    %edi,%edx
+  802d54:	3b 53 10             	cmp    0x10(%ebx),%edx
+  802d57:	72 b4                	jb     802d0d <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802d59:	83 ec 04             	sub    $0x4,%esp
+  802d5c:	52                   	push   %edx
+  802d5d:	89 f8                	mov    %edi,%eax
+  802d5f:	03 45 08             	add    0x8(%ebp),%eax
+  802d62:	50                   	push   %eax
+  802d63:	ff 33                	push   (%ebx)
+  802d65:	e8 1d ef ff ff       	call   801c87 <write>
+  802d6a:	83 c4 10             	add    $0x10,%esp
+  802d6d:	85 c0                	test   %eax,%eax
+  802d6f:	7f 98                	jg     802d09 <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  802d71:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  802d75:	8b 43 08             	mov    0x8(%ebx),%eax
+  802d78:	83 f8 03             	cmp    $0x3,%eax
+  802d7b:	74 48                	je     802dc5 <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802d7d:	83 f8 02             	cmp    $0x2,%eax
+  802d80:	74 27                	je     802da9 <fwrite+0x12a>
+	return size ? done / size : 0;
+  802d82:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d85:	85 c0                	test   %eax,%eax
+  802d87:	0f 84 10 ff ff ff    	je     802c9d <fwrite+0x1e>
+  802d8d:	89 f8                	mov    %edi,%eax
+  802d8f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d94:	f7 75 0c             	divl   0xc(%ebp)
+  802d97:	e9 01 ff ff ff       	jmp    802c9d <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802d9c:	89 d8                	mov    %ebx,%eax
+  802d9e:	e8 ce f9 ff ff       	call   802771 <stream_drain>
+  802da3:	85 c0                	test   %eax,%eax
+  802da5:	79 9a                	jns    802d41 <fwrite+0xc2>
+  802da7:	eb cc                	jmp    802d75 <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802da9:	83 ec 04             	sub    $0x4,%esp
+  802dac:	57                   	push   %edi
+  802dad:	6a 0a                	push   $0xa
+  802daf:	ff 75 08             	push   0x8(%ebp)
+  802db2:	e8 ac dd ff ff       	call   800b63 <memfind>
+  802db7:	89 c2                	mov    %eax,%edx
+  802db9:	89 f8                	mov    %edi,%eax
+  802dbb:	03 45 08             	add    0x8(%ebp),%eax
+  802dbe:	83 c4 10             	add    $0x10,%esp
+  802dc1:	39 c2                	cmp    %eax,%edx
+  802dc3:	74 bd                	je     802d82 <fwrite+0x103>
+		stream_drain(f);
+  802dc5:	89 d8                	mov    %ebx,%eax
+  802dc7:	e8 a5 f9 ff ff       	call   802771 <stream_drain>
+  802dcc:	eb b4                	jmp    802d82 <fwrite+0x103>
+
+00802dce <fputc>:
+{
+  802dce:	55                   	push   %ebp
+  802dcf:	89 e5                	mov    %esp,%ebp
+  802dd1:	53                   	push   %ebx
+  802dd2:	83 ec 14             	sub    $0x14,%esp
+  802dd5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  802dd8:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  802ddb:	ff 75 0c             	push   0xc(%ebp)
+  802dde:	6a 01                	push   $0x1
+  802de0:	6a 01                	push   $0x1
+  802de2:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802de5:	50                   	push   %eax
+  802de6:	e8 94 fe ff ff       	call   802c7f <fwrite>
+  802deb:	83 c4 10             	add    $0x10,%esp
+  802dee:	0f b6 db             	movzbl %bl,%ebx
+  802df1:	83 f8 01             	cmp    $0x1,%eax
+  802df4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802df9:	0f 44 c3             	cmove  %ebx,%eax
+}
+  802dfc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802dff:	c9                   	leave
+  802e00:	c3                   	ret
+
+00802e01 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  802e01:	55                   	push   %ebp
+  802e02:	89 e5                	mov    %esp,%ebp
+  802e04:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  802e07:	ff 75 0c             	push   0xc(%ebp)
+  802e0a:	ff 75 08             	push   0x8(%ebp)
+  802e0d:	e8 bc ff ff ff       	call   802dce <fputc>
+}
+  802e12:	83 c4 10             	add    $0x10,%esp
+  802e15:	c9                   	leave
+  802e16:	c3                   	ret
+
+00802e17 <fputs>:
+{
+  802e17:	55                   	push   %ebp
+  802e18:	89 e5                	mov    %esp,%ebp
+  802e1a:	56                   	push   %esi
+  802e1b:	53                   	push   %ebx
+  802e1c:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  802e1f:	83 ec 0c             	sub    $0xc,%esp
+  802e22:	56                   	push   %esi
+  802e23:	e8 c9 da ff ff       	call   8008f1 <strlen>
+  802e28:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  802e2a:	ff 75 0c             	push   0xc(%ebp)
+  802e2d:	50                   	push   %eax
+  802e2e:	6a 01                	push   $0x1
+  802e30:	56                   	push   %esi
+  802e31:	e8 49 fe ff ff       	call   802c7f <fwrite>
+  802e36:	83 c4 20             	add    $0x20,%esp
+  802e39:	39 d8                	cmp    %ebx,%eax
+  802e3b:	0f 95 c0             	setne  %al
+  802e3e:	0f b6 c0             	movzbl %al,%eax
+  802e41:	f7 d8                	neg    %eax
+}
+  802e43:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e46:	5b                   	pop    %ebx
+  802e47:	5e                   	pop    %esi
+  802e48:	5d                   	pop    %ebp
+  802e49:	c3                   	ret
+
+00802e4a <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  802e4a:	55                   	push   %ebp
+  802e4b:	89 e5                	mov    %esp,%ebp
+  802e4d:	53                   	push   %ebx
+  802e4e:	83 ec 04             	sub    $0x4,%esp
+  802e51:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802e54:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  802e57:	50                   	push   %eax
+  802e58:	ff 75 0c             	push   0xc(%ebp)
+  802e5b:	53                   	push   %ebx
+  802e5c:	68 01 2e 80 00       	push   $0x802e01
+  802e61:	e8 d9 d5 ff ff       	call   80043f <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  802e66:	8b 43 04             	mov    0x4(%ebx),%eax
+  802e69:	c1 e0 1c             	shl    $0x1c,%eax
+  802e6c:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  802e6f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e72:	c9                   	leave
+  802e73:	c3                   	ret
+
+00802e74 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802e74:	55                   	push   %ebp
+  802e75:	89 e5                	mov    %esp,%ebp
+  802e77:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802e7a:	68 28 50 80 00       	push   $0x805028
+  802e7f:	ff 75 0c             	push   0xc(%ebp)
+  802e82:	e8 a5 da ff ff       	call   80092c <strcpy>
+	return 0;
+}
+  802e87:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e8c:	c9                   	leave
+  802e8d:	c3                   	ret
+
+00802e8e <devsock_close>:
+{
+  802e8e:	55                   	push   %ebp
+  802e8f:	89 e5                	mov    %esp,%ebp
+  802e91:	53                   	push   %ebx
+  802e92:	83 ec 10             	sub    $0x10,%esp
+  802e95:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802e98:	53                   	push   %ebx
+  802e99:	e8 62 17 00 00       	call   804600 <pageref>
+  802e9e:	89 c2                	mov    %eax,%edx
+  802ea0:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802ea3:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802ea8:	83 fa 01             	cmp    $0x1,%edx
+  802eab:	74 05                	je     802eb2 <devsock_close+0x24>
+}
+  802ead:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802eb0:	c9                   	leave
+  802eb1:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802eb2:	83 ec 0c             	sub    $0xc,%esp
+  802eb5:	ff 73 0c             	push   0xc(%ebx)
+  802eb8:	e8 b7 02 00 00       	call   803174 <nsipc_close>
+  802ebd:	83 c4 10             	add    $0x10,%esp
+  802ec0:	eb eb                	jmp    802ead <devsock_close+0x1f>
+
+00802ec2 <devsock_write>:
+{
+  802ec2:	55                   	push   %ebp
+  802ec3:	89 e5                	mov    %esp,%ebp
+  802ec5:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802ec8:	6a 00                	push   $0x0
+  802eca:	ff 75 10             	push   0x10(%ebp)
+  802ecd:	ff 75 0c             	push   0xc(%ebp)
+  802ed0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ed3:	ff 70 0c             	push   0xc(%eax)
+  802ed6:	e8 79 03 00 00       	call   803254 <nsipc_send>
+}
+  802edb:	c9                   	leave
+  802edc:	c3                   	ret
+
+00802edd <devsock_read>:
+{
+  802edd:	55                   	push   %ebp
+  802ede:	89 e5                	mov    %esp,%ebp
+  802ee0:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802ee3:	6a 00                	push   $0x0
+  802ee5:	ff 75 10             	push   0x10(%ebp)
+  802ee8:	ff 75 0c             	push   0xc(%ebp)
+  802eeb:	8b 45 08             	mov    0x8(%ebp),%eax
+  802eee:	ff 70 0c             	push   0xc(%eax)
+  802ef1:	e8 ef 02 00 00       	call   8031e5 <nsipc_recv>
+}
+  802ef6:	c9                   	leave
+  802ef7:	c3                   	ret
+
+00802ef8 <fd2sockid>:
+{
+  802ef8:	55                   	push   %ebp
+  802ef9:	89 e5                	mov    %esp,%ebp
+  802efb:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802efe:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802f01:	52                   	push   %edx
+  802f02:	50                   	push   %eax
+  802f03:	e8 f7 e9 ff ff       	call   8018ff <fd_lookup>
+  802f08:	83 c4 10             	add    $0x10,%esp
+  802f0b:	85 c0                	test   %eax,%eax
+  802f0d:	78 10                	js     802f1f <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802f0f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f12:	8b 0d 60 62 80 00    	mov    0x806260,%ecx
+  802f18:	39 08                	cmp    %ecx,(%eax)
+  802f1a:	75 05                	jne    802f21 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802f1c:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802f1f:	c9                   	leave
+  802f20:	c3                   	ret
+		return -E_NOT_SUPP;
+  802f21:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802f26:	eb f7                	jmp    802f1f <fd2sockid+0x27>
+
+00802f28 <alloc_sockfd>:
+{
+  802f28:	55                   	push   %ebp
+  802f29:	89 e5                	mov    %esp,%ebp
+  802f2b:	56                   	push   %esi
+  802f2c:	53                   	push   %ebx
+  802f2d:	83 ec 1c             	sub    $0x1c,%esp
+  802f30:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802f32:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802f35:	50                   	push   %eax
+  802f36:	e8 6e e9 ff ff       	call   8018a9 <fd_alloc>
+  802f3b:	89 c3                	mov    %eax,%ebx
+  802f3d:	83 c4 10             	add    $0x10,%esp
+  802f40:	85 c0                	test   %eax,%eax
+  802f42:	78 43                	js     802f87 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802f44:	83 ec 04             	sub    $0x4,%esp
+  802f47:	68 07 04 00 00       	push   $0x407
+  802f4c:	ff 75 f4             	push   -0xc(%ebp)
+  802f4f:	6a 00                	push   $0x0
+  802f51:	e8 14 de ff ff       	call   800d6a <sys_page_alloc>
+  802f56:	89 c3                	mov    %eax,%ebx
+  802f58:	83 c4 10             	add    $0x10,%esp
+  802f5b:	85 c0                	test   %eax,%eax
+  802f5d:	78 28                	js     802f87 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802f5f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f62:	8b 15 60 62 80 00    	mov    0x806260,%edx
+  802f68:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802f6a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f6d:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802f74:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802f77:	83 ec 0c             	sub    $0xc,%esp
+  802f7a:	50                   	push   %eax
+  802f7b:	e8 02 e9 ff ff       	call   801882 <fd2num>
+  802f80:	89 c3                	mov    %eax,%ebx
+  802f82:	83 c4 10             	add    $0x10,%esp
+  802f85:	eb 0c                	jmp    802f93 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802f87:	83 ec 0c             	sub    $0xc,%esp
+  802f8a:	56                   	push   %esi
+  802f8b:	e8 e4 01 00 00       	call   803174 <nsipc_close>
+		return r;
+  802f90:	83 c4 10             	add    $0x10,%esp
+}
+  802f93:	89 d8                	mov    %ebx,%eax
+  802f95:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f98:	5b                   	pop    %ebx
+  802f99:	5e                   	pop    %esi
+  802f9a:	5d                   	pop    %ebp
+  802f9b:	c3                   	ret
+
+00802f9c <accept>:
+{
+  802f9c:	55                   	push   %ebp
+  802f9d:	89 e5                	mov    %esp,%ebp
+  802f9f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802fa2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fa5:	e8 4e ff ff ff       	call   802ef8 <fd2sockid>
+  802faa:	85 c0                	test   %eax,%eax
+  802fac:	78 1b                	js     802fc9 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802fae:	83 ec 04             	sub    $0x4,%esp
+  802fb1:	ff 75 10             	push   0x10(%ebp)
+  802fb4:	ff 75 0c             	push   0xc(%ebp)
+  802fb7:	50                   	push   %eax
+  802fb8:	e8 0e 01 00 00       	call   8030cb <nsipc_accept>
+  802fbd:	83 c4 10             	add    $0x10,%esp
+  802fc0:	85 c0                	test   %eax,%eax
+  802fc2:	78 05                	js     802fc9 <accept+0x2d>
+	return alloc_sockfd(r);
+  802fc4:	e8 5f ff ff ff       	call   802f28 <alloc_sockfd>
+}
+  802fc9:	c9                   	leave
+  802fca:	c3                   	ret
+
+00802fcb <bind>:
+{
+  802fcb:	55                   	push   %ebp
+  802fcc:	89 e5                	mov    %esp,%ebp
+  802fce:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802fd1:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fd4:	e8 1f ff ff ff       	call   802ef8 <fd2sockid>
+  802fd9:	85 c0                	test   %eax,%eax
+  802fdb:	78 12                	js     802fef <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802fdd:	83 ec 04             	sub    $0x4,%esp
+  802fe0:	ff 75 10             	push   0x10(%ebp)
+  802fe3:	ff 75 0c             	push   0xc(%ebp)
+  802fe6:	50                   	push   %eax
+  802fe7:	e8 31 01 00 00       	call   80311d <nsipc_bind>
+  802fec:	83 c4 10             	add    $0x10,%esp
+}
+  802fef:	c9                   	leave
+  802ff0:	c3                   	ret
+
+00802ff1 <shutdown>:
+{
+  802ff1:	55                   	push   %ebp
+  802ff2:	89 e5                	mov    %esp,%ebp
+  802ff4:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802ff7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ffa:	e8 f9 fe ff ff       	call   802ef8 <fd2sockid>
+  802fff:	85 c0                	test   %eax,%eax
+  803001:	78 0f                	js     803012 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  803003:	83 ec 08             	sub    $0x8,%esp
+  803006:	ff 75 0c             	push   0xc(%ebp)
+  803009:	50                   	push   %eax
+  80300a:	e8 43 01 00 00       	call   803152 <nsipc_shutdown>
+  80300f:	83 c4 10             	add    $0x10,%esp
+}
+  803012:	c9                   	leave
+  803013:	c3                   	ret
+
+00803014 <connect>:
+{
+  803014:	55                   	push   %ebp
+  803015:	89 e5                	mov    %esp,%ebp
+  803017:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80301a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80301d:	e8 d6 fe ff ff       	call   802ef8 <fd2sockid>
+  803022:	85 c0                	test   %eax,%eax
+  803024:	78 12                	js     803038 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  803026:	83 ec 04             	sub    $0x4,%esp
+  803029:	ff 75 10             	push   0x10(%ebp)
+  80302c:	ff 75 0c             	push   0xc(%ebp)
+  80302f:	50                   	push   %eax
+  803030:	e8 59 01 00 00       	call   80318e <nsipc_connect>
+  803035:	83 c4 10             	add    $0x10,%esp
+}
+  803038:	c9                   	leave
+  803039:	c3                   	ret
+
+0080303a <listen>:
+{
+  80303a:	55                   	push   %ebp
+  80303b:	89 e5                	mov    %esp,%ebp
+  80303d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803040:	8b 45 08             	mov    0x8(%ebp),%eax
+  803043:	e8 b0 fe ff ff       	call   802ef8 <fd2sockid>
+  803048:	85 c0                	test   %eax,%eax
+  80304a:	78 0f                	js     80305b <listen+0x21>
+	return nsipc_listen(r, backlog);
+  80304c:	83 ec 08             	sub    $0x8,%esp
+  80304f:	ff 75 0c             	push   0xc(%ebp)
+  803052:	50                   	push   %eax
+  803053:	e8 6b 01 00 00       	call   8031c3 <nsipc_listen>
+  803058:	83 c4 10             	add    $0x10,%esp
+}
+  80305b:	c9                   	leave
+  80305c:	c3                   	ret
+
+0080305d <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80305d:	55                   	push   %ebp
+  80305e:	89 e5                	mov    %esp,%ebp
+  803060:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  803063:	ff 75 10             	push   0x10(%ebp)
+  803066:	ff 75 0c             	push   0xc(%ebp)
+  803069:	ff 75 08             	push   0x8(%ebp)
+  80306c:	e8 41 02 00 00       	call   8032b2 <nsipc_socket>
+  803071:	83 c4 10             	add    $0x10,%esp
+  803074:	85 c0                	test   %eax,%eax
+  803076:	78 05                	js     80307d <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  803078:	e8 ab fe ff ff       	call   802f28 <alloc_sockfd>
+}
+  80307d:	c9                   	leave
+  80307e:	c3                   	ret
+
+0080307f <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80307f:	55                   	push   %ebp
+  803080:	89 e5                	mov    %esp,%ebp
+  803082:	53                   	push   %ebx
+  803083:	83 ec 04             	sub    $0x4,%esp
+  803086:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  803088:	83 3d 08 70 80 00 00 	cmpl   $0x0,0x807008
+  80308f:	74 26                	je     8030b7 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  803091:	6a 07                	push   $0x7
+  803093:	68 00 90 80 00       	push   $0x809000
+  803098:	53                   	push   %ebx
+  803099:	ff 35 08 70 80 00    	push   0x807008
+  80309f:	e8 c7 14 00 00       	call   80456b <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8030a4:	83 c4 0c             	add    $0xc,%esp
+  8030a7:	6a 00                	push   $0x0
+  8030a9:	6a 00                	push   $0x0
+  8030ab:	6a 00                	push   $0x0
+  8030ad:	e8 c3 13 00 00       	call   804475 <ipc_recv>
+}
+  8030b2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8030b5:	c9                   	leave
+  8030b6:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8030b7:	83 ec 0c             	sub    $0xc,%esp
+  8030ba:	6a 02                	push   $0x2
+  8030bc:	e8 00 15 00 00       	call   8045c1 <ipc_find_env>
+  8030c1:	a3 08 70 80 00       	mov    %eax,0x807008
+  8030c6:	83 c4 10             	add    $0x10,%esp
+  8030c9:	eb c6                	jmp    803091 <nsipc+0x12>
+
+008030cb <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8030cb:	55                   	push   %ebp
+  8030cc:	89 e5                	mov    %esp,%ebp
+  8030ce:	56                   	push   %esi
+  8030cf:	53                   	push   %ebx
+  8030d0:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8030d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030d6:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  8030db:	8b 06                	mov    (%esi),%eax
+  8030dd:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8030e2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8030e7:	e8 93 ff ff ff       	call   80307f <nsipc>
+  8030ec:	89 c3                	mov    %eax,%ebx
+  8030ee:	85 c0                	test   %eax,%eax
+  8030f0:	79 09                	jns    8030fb <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8030f2:	89 d8                	mov    %ebx,%eax
+  8030f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8030f7:	5b                   	pop    %ebx
+  8030f8:	5e                   	pop    %esi
+  8030f9:	5d                   	pop    %ebp
+  8030fa:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8030fb:	83 ec 04             	sub    $0x4,%esp
+  8030fe:	ff 35 10 90 80 00    	push   0x809010
+  803104:	68 00 90 80 00       	push   $0x809000
+  803109:	ff 75 0c             	push   0xc(%ebp)
+  80310c:	e8 a1 d9 ff ff       	call   800ab2 <memmove>
+		*addrlen = ret->ret_addrlen;
+  803111:	a1 10 90 80 00       	mov    0x809010,%eax
+  803116:	89 06                	mov    %eax,(%esi)
+  803118:	83 c4 10             	add    $0x10,%esp
+	return r;
+  80311b:	eb d5                	jmp    8030f2 <nsipc_accept+0x27>
+
+0080311d <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80311d:	55                   	push   %ebp
+  80311e:	89 e5                	mov    %esp,%ebp
+  803120:	53                   	push   %ebx
+  803121:	83 ec 08             	sub    $0x8,%esp
+  803124:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  803127:	8b 45 08             	mov    0x8(%ebp),%eax
+  80312a:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  80312f:	53                   	push   %ebx
+  803130:	ff 75 0c             	push   0xc(%ebp)
+  803133:	68 04 90 80 00       	push   $0x809004
+  803138:	e8 75 d9 ff ff       	call   800ab2 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  80313d:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  803143:	b8 02 00 00 00       	mov    $0x2,%eax
+  803148:	e8 32 ff ff ff       	call   80307f <nsipc>
+}
+  80314d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803150:	c9                   	leave
+  803151:	c3                   	ret
+
+00803152 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  803152:	55                   	push   %ebp
+  803153:	89 e5                	mov    %esp,%ebp
+  803155:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  803158:	8b 45 08             	mov    0x8(%ebp),%eax
+  80315b:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  803160:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803163:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  803168:	b8 03 00 00 00       	mov    $0x3,%eax
+  80316d:	e8 0d ff ff ff       	call   80307f <nsipc>
+}
+  803172:	c9                   	leave
+  803173:	c3                   	ret
+
+00803174 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  803174:	55                   	push   %ebp
+  803175:	89 e5                	mov    %esp,%ebp
+  803177:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  80317a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80317d:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  803182:	b8 04 00 00 00       	mov    $0x4,%eax
+  803187:	e8 f3 fe ff ff       	call   80307f <nsipc>
+}
+  80318c:	c9                   	leave
+  80318d:	c3                   	ret
+
+0080318e <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80318e:	55                   	push   %ebp
+  80318f:	89 e5                	mov    %esp,%ebp
+  803191:	53                   	push   %ebx
+  803192:	83 ec 08             	sub    $0x8,%esp
+  803195:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  803198:	8b 45 08             	mov    0x8(%ebp),%eax
+  80319b:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8031a0:	53                   	push   %ebx
+  8031a1:	ff 75 0c             	push   0xc(%ebp)
+  8031a4:	68 04 90 80 00       	push   $0x809004
+  8031a9:	e8 04 d9 ff ff       	call   800ab2 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8031ae:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  8031b4:	b8 05 00 00 00       	mov    $0x5,%eax
+  8031b9:	e8 c1 fe ff ff       	call   80307f <nsipc>
+}
+  8031be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8031c1:	c9                   	leave
+  8031c2:	c3                   	ret
+
+008031c3 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8031c3:	55                   	push   %ebp
+  8031c4:	89 e5                	mov    %esp,%ebp
+  8031c6:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8031c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031cc:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  8031d1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8031d4:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  8031d9:	b8 06 00 00 00       	mov    $0x6,%eax
+  8031de:	e8 9c fe ff ff       	call   80307f <nsipc>
+}
+  8031e3:	c9                   	leave
+  8031e4:	c3                   	ret
+
+008031e5 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8031e5:	55                   	push   %ebp
+  8031e6:	89 e5                	mov    %esp,%ebp
+  8031e8:	56                   	push   %esi
+  8031e9:	53                   	push   %ebx
+  8031ea:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8031ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031f0:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  8031f5:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  8031fb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8031fe:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  803203:	b8 07 00 00 00       	mov    $0x7,%eax
+  803208:	e8 72 fe ff ff       	call   80307f <nsipc>
+  80320d:	89 c3                	mov    %eax,%ebx
+  80320f:	85 c0                	test   %eax,%eax
+  803211:	78 22                	js     803235 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  803213:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  803218:	39 c6                	cmp    %eax,%esi
+  80321a:	0f 4e c6             	cmovle %esi,%eax
+  80321d:	39 c3                	cmp    %eax,%ebx
+  80321f:	7f 1d                	jg     80323e <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  803221:	83 ec 04             	sub    $0x4,%esp
+  803224:	53                   	push   %ebx
+  803225:	68 00 90 80 00       	push   $0x809000
+  80322a:	ff 75 0c             	push   0xc(%ebp)
+  80322d:	e8 80 d8 ff ff       	call   800ab2 <memmove>
+  803232:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  803235:	89 d8                	mov    %ebx,%eax
+  803237:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80323a:	5b                   	pop    %ebx
+  80323b:	5e                   	pop    %esi
+  80323c:	5d                   	pop    %ebp
+  80323d:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  80323e:	68 34 50 80 00       	push   $0x805034
+  803243:	68 31 4f 80 00       	push   $0x804f31
+  803248:	6a 62                	push   $0x62
+  80324a:	68 49 50 80 00       	push   $0x805049
+  80324f:	e8 19 d0 ff ff       	call   80026d <_panic>
+
+00803254 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  803254:	55                   	push   %ebp
+  803255:	89 e5                	mov    %esp,%ebp
+  803257:	53                   	push   %ebx
+  803258:	83 ec 04             	sub    $0x4,%esp
+  80325b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  80325e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803261:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  803266:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80326c:	7f 2e                	jg     80329c <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  80326e:	83 ec 04             	sub    $0x4,%esp
+  803271:	53                   	push   %ebx
+  803272:	ff 75 0c             	push   0xc(%ebp)
+  803275:	68 0c 90 80 00       	push   $0x80900c
+  80327a:	e8 33 d8 ff ff       	call   800ab2 <memmove>
+	nsipcbuf.send.req_size = size;
+  80327f:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  803285:	8b 45 14             	mov    0x14(%ebp),%eax
+  803288:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  80328d:	b8 08 00 00 00       	mov    $0x8,%eax
+  803292:	e8 e8 fd ff ff       	call   80307f <nsipc>
+}
+  803297:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80329a:	c9                   	leave
+  80329b:	c3                   	ret
+	assert(size < 1600);
+  80329c:	68 55 50 80 00       	push   $0x805055
+  8032a1:	68 31 4f 80 00       	push   $0x804f31
+  8032a6:	6a 6d                	push   $0x6d
+  8032a8:	68 49 50 80 00       	push   $0x805049
+  8032ad:	e8 bb cf ff ff       	call   80026d <_panic>
+
+008032b2 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8032b2:	55                   	push   %ebp
+  8032b3:	89 e5                	mov    %esp,%ebp
+  8032b5:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8032b8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032bb:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  8032c0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8032c3:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  8032c8:	8b 45 10             	mov    0x10(%ebp),%eax
+  8032cb:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  8032d0:	b8 09 00 00 00       	mov    $0x9,%eax
+  8032d5:	e8 a5 fd ff ff       	call   80307f <nsipc>
+}
+  8032da:	c9                   	leave
+  8032db:	c3                   	ret
+
+008032dc <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  8032dc:	55                   	push   %ebp
+  8032dd:	89 e5                	mov    %esp,%ebp
+  8032df:	53                   	push   %ebx
+  8032e0:	83 ec 10             	sub    $0x10,%esp
+  8032e3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  8032e6:	68 0c 70 80 00       	push   $0x80700c
+  8032eb:	e8 a1 07 00 00       	call   803a91 <mutex_lock>
+	if (v == 0)
+  8032f0:	83 c4 10             	add    $0x10,%esp
+  8032f3:	85 db                	test   %ebx,%ebx
+  8032f5:	0f 84 85 00 00 00    	je     803380 <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  8032fb:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  803301:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  803306:	77 51                	ja     803359 <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  803308:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  80330e:	89 d8                	mov    %ebx,%eax
+  803310:	c1 e8 0c             	shr    $0xc,%eax
+  803313:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80331a:	f6 c4 02             	test   $0x2,%ah
+  80331d:	74 50                	je     80336f <free+0x93>
+		sys_page_unmap(0, c);
+  80331f:	83 ec 08             	sub    $0x8,%esp
+  803322:	53                   	push   %ebx
+  803323:	6a 00                	push   $0x0
+  803325:	e8 d9 da ff ff       	call   800e03 <sys_page_unmap>
+		c += PGSIZE;
+  80332a:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  803330:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  803336:	83 c4 10             	add    $0x10,%esp
+  803339:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  80333e:	76 ce                	jbe    80330e <free+0x32>
+  803340:	68 9f 50 80 00       	push   $0x80509f
+  803345:	68 31 4f 80 00       	push   $0x804f31
+  80334a:	68 82 00 00 00       	push   $0x82
+  80334f:	68 92 50 80 00       	push   $0x805092
+  803354:	e8 14 cf ff ff       	call   80026d <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  803359:	68 64 50 80 00       	push   $0x805064
+  80335e:	68 31 4f 80 00       	push   $0x804f31
+  803363:	6a 7b                	push   $0x7b
+  803365:	68 92 50 80 00       	push   $0x805092
+  80336a:	e8 fe ce ff ff       	call   80026d <_panic>
+	if (--(*ref) == 0)
+  80336f:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  803375:	83 e8 01             	sub    $0x1,%eax
+  803378:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  80337e:	74 15                	je     803395 <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  803380:	83 ec 0c             	sub    $0xc,%esp
+  803383:	68 0c 70 80 00       	push   $0x80700c
+  803388:	e8 71 07 00 00       	call   803afe <mutex_unlock>
+}
+  80338d:	83 c4 10             	add    $0x10,%esp
+  803390:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803393:	c9                   	leave
+  803394:	c3                   	ret
+		sys_page_unmap(0, c);
+  803395:	83 ec 08             	sub    $0x8,%esp
+  803398:	53                   	push   %ebx
+  803399:	6a 00                	push   $0x0
+  80339b:	e8 63 da ff ff       	call   800e03 <sys_page_unmap>
+  8033a0:	83 c4 10             	add    $0x10,%esp
+  8033a3:	eb db                	jmp    803380 <free+0xa4>
+
+008033a5 <malloc>:
+{
+  8033a5:	55                   	push   %ebp
+  8033a6:	89 e5                	mov    %esp,%ebp
+  8033a8:	57                   	push   %edi
+  8033a9:	56                   	push   %esi
+  8033aa:	53                   	push   %ebx
+  8033ab:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  8033ae:	68 0c 70 80 00       	push   $0x80700c
+  8033b3:	e8 d9 06 00 00       	call   803a91 <mutex_lock>
+	if (mptr == 0)
+  8033b8:	8b 3d 10 70 80 00    	mov    0x807010,%edi
+  8033be:	83 c4 10             	add    $0x10,%esp
+  8033c1:	85 ff                	test   %edi,%edi
+  8033c3:	74 6c                	je     803431 <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  8033c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033c8:	83 c0 03             	add    $0x3,%eax
+  8033cb:	83 e0 fc             	and    $0xfffffffc,%eax
+  8033ce:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  8033d0:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  8033d5:	0f 87 64 01 00 00    	ja     80353f <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  8033db:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8033e1:	74 30                	je     803413 <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  8033e3:	89 f9                	mov    %edi,%ecx
+  8033e5:	c1 e9 0c             	shr    $0xc,%ecx
+  8033e8:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  8033ec:	c1 e8 0c             	shr    $0xc,%eax
+  8033ef:	39 c1                	cmp    %eax,%ecx
+  8033f1:	74 5f                	je     803452 <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  8033f3:	83 ec 0c             	sub    $0xc,%esp
+  8033f6:	57                   	push   %edi
+  8033f7:	e8 e0 fe ff ff       	call   8032dc <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  8033fc:	a1 10 70 80 00       	mov    0x807010,%eax
+  803401:	05 00 10 00 00       	add    $0x1000,%eax
+  803406:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80340b:	a3 10 70 80 00       	mov    %eax,0x807010
+  803410:	83 c4 10             	add    $0x10,%esp
+  803413:	8b 0d 10 70 80 00    	mov    0x807010,%ecx
+{
+  803419:	ba 02 00 00 00       	mov    $0x2,%edx
+  80341e:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  803422:	8d 7e 04             	lea    0x4(%esi),%edi
+  803425:	89 cb                	mov    %ecx,%ebx
+  803427:	01 f9                	add    %edi,%ecx
+  803429:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  80342c:	e9 8b 00 00 00       	jmp    8034bc <malloc+0x117>
+		mptr = mbegin;
+  803431:	c7 05 10 70 80 00 00 	movl   $0x8000000,0x807010
+  803438:	00 00 08 
+	n = ROUNDUP(n, 4);
+  80343b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80343e:	83 c0 03             	add    $0x3,%eax
+  803441:	83 e0 fc             	and    $0xfffffffc,%eax
+  803444:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  803446:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  80344b:	76 c6                	jbe    803413 <malloc+0x6e>
+  80344d:	e9 d6 00 00 00       	jmp    803528 <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  803452:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  803458:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  80345d:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  803461:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  803464:	a3 10 70 80 00       	mov    %eax,0x807010
+			return v;
+  803469:	e9 ba 00 00 00       	jmp    803528 <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  80346e:	05 00 10 00 00       	add    $0x1000,%eax
+  803473:	39 c8                	cmp    %ecx,%eax
+  803475:	0f 83 cb 00 00 00    	jae    803546 <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  80347b:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  803480:	77 22                	ja     8034a4 <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  803482:	89 c2                	mov    %eax,%edx
+  803484:	c1 ea 16             	shr    $0x16,%edx
+  803487:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80348e:	f6 c2 01             	test   $0x1,%dl
+  803491:	74 db                	je     80346e <malloc+0xc9>
+  803493:	89 c2                	mov    %eax,%edx
+  803495:	c1 ea 0c             	shr    $0xc,%edx
+  803498:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80349f:	f6 c2 01             	test   $0x1,%dl
+  8034a2:	74 ca                	je     80346e <malloc+0xc9>
+		if (mptr == mend) {
+  8034a4:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8034aa:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  8034b0:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  8034b4:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  8034ba:	74 04                	je     8034c0 <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  8034bc:	89 d8                	mov    %ebx,%eax
+  8034be:	eb b3                	jmp    803473 <malloc+0xce>
+  8034c0:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  8034c3:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  8034c8:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  8034cc:	83 ea 01             	sub    $0x1,%edx
+  8034cf:	0f 85 50 ff ff ff    	jne    803425 <malloc+0x80>
+  8034d5:	c7 05 10 70 80 00 00 	movl   $0x8000000,0x807010
+  8034dc:	00 00 08 
+				return 0;	/* out of address space */
+  8034df:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034e4:	eb 42                	jmp    803528 <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  8034e6:	85 db                	test   %ebx,%ebx
+  8034e8:	78 1e                	js     803508 <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  8034ea:	83 ec 08             	sub    $0x8,%esp
+  8034ed:	89 d8                	mov    %ebx,%eax
+  8034ef:	03 05 10 70 80 00    	add    0x807010,%eax
+  8034f5:	50                   	push   %eax
+  8034f6:	6a 00                	push   $0x0
+  8034f8:	e8 06 d9 ff ff       	call   800e03 <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  8034fd:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  803503:	83 c4 10             	add    $0x10,%esp
+  803506:	eb de                	jmp    8034e6 <malloc+0x141>
+			return 0;	/* out of physical memory */
+  803508:	bf 00 00 00 00       	mov    $0x0,%edi
+  80350d:	eb 19                	jmp    803528 <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  80350f:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803512:	8b 3d 10 70 80 00    	mov    0x807010,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  803518:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  80351f:	00 
+	mptr += n;
+  803520:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  803523:	a3 10 70 80 00       	mov    %eax,0x807010
+	mutex_unlock(&malloc_mu);
+  803528:	83 ec 0c             	sub    $0xc,%esp
+  80352b:	68 0c 70 80 00       	push   $0x80700c
+  803530:	e8 c9 05 00 00       	call   803afe <mutex_unlock>
+}
+  803535:	89 f8                	mov    %edi,%eax
+  803537:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80353a:	5b                   	pop    %ebx
+  80353b:	5e                   	pop    %esi
+  80353c:	5f                   	pop    %edi
+  80353d:	5d                   	pop    %ebp
+  80353e:	c3                   	ret
+		return 0;
+  80353f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803544:	eb e2                	jmp    803528 <malloc+0x183>
+  803546:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  80354a:	74 06                	je     803552 <malloc+0x1ad>
+  80354c:	89 1d 10 70 80 00    	mov    %ebx,0x807010
+	for (i = 0; i < n + 4; i += PGSIZE){
+  803552:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803557:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  80355a:	39 fb                	cmp    %edi,%ebx
+  80355c:	73 b1                	jae    80350f <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  80355e:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  803564:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  803567:	39 fe                	cmp    %edi,%esi
+  803569:	0f 92 c0             	setb   %al
+  80356c:	0f b6 c0             	movzbl %al,%eax
+  80356f:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  803572:	83 c8 07             	or     $0x7,%eax
+  803575:	50                   	push   %eax
+  803576:	89 d8                	mov    %ebx,%eax
+  803578:	03 05 10 70 80 00    	add    0x807010,%eax
+  80357e:	50                   	push   %eax
+  80357f:	6a 00                	push   $0x0
+  803581:	e8 e4 d7 ff ff       	call   800d6a <sys_page_alloc>
+  803586:	83 c4 10             	add    $0x10,%esp
+  803589:	85 c0                	test   %eax,%eax
+  80358b:	0f 88 55 ff ff ff    	js     8034e6 <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  803591:	89 f3                	mov    %esi,%ebx
+  803593:	eb c5                	jmp    80355a <malloc+0x1b5>
+
+00803595 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  803595:	55                   	push   %ebp
+  803596:	89 e5                	mov    %esp,%ebp
+  803598:	56                   	push   %esi
+  803599:	53                   	push   %ebx
+  80359a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80359d:	83 ec 0c             	sub    $0xc,%esp
+  8035a0:	ff 75 08             	push   0x8(%ebp)
+  8035a3:	e8 ea e2 ff ff       	call   801892 <fd2data>
+  8035a8:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8035aa:	83 c4 08             	add    $0x8,%esp
+  8035ad:	68 b7 50 80 00       	push   $0x8050b7
+  8035b2:	53                   	push   %ebx
+  8035b3:	e8 74 d3 ff ff       	call   80092c <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8035b8:	8b 46 04             	mov    0x4(%esi),%eax
+  8035bb:	2b 06                	sub    (%esi),%eax
+  8035bd:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8035c3:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8035ca:	00 00 00 
+	stat->st_dev = &devpipe;
+  8035cd:	c7 83 88 00 00 00 7c 	movl   $0x80627c,0x88(%ebx)
+  8035d4:	62 80 00 
+	return 0;
+}
+  8035d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035dc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8035df:	5b                   	pop    %ebx
+  8035e0:	5e                   	pop    %esi
+  8035e1:	5d                   	pop    %ebp
+  8035e2:	c3                   	ret
+
+008035e3 <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  8035e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8035e8:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  8035ec:	85 c9                	test   %ecx,%ecx
+  8035ee:	75 01                	jne    8035f1 <pipewake+0xe>
+  8035f0:	c3                   	ret
+{
+  8035f1:	55                   	push   %ebp
+  8035f2:	89 e5                	mov    %esp,%ebp
+  8035f4:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  8035f7:	68 00 04 00 00       	push   $0x400
+  8035fc:	52                   	push   %edx
+  8035fd:	e8 ac da ff ff       	call   8010ae <sys_futex_wake>
+  803602:	83 c4 10             	add    $0x10,%esp
+}
+  803605:	c9                   	leave
+  803606:	c3                   	ret
+
+00803607 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803607:	55                   	push   %ebp
+  803608:	89 e5                	mov    %esp,%ebp
+  80360a:	56                   	push   %esi
+  80360b:	53                   	push   %ebx
+  80360c:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80360f:	83 ec 0c             	sub    $0xc,%esp
+  803612:	56                   	push   %esi
+  803613:	e8 7a e2 ff ff       	call   801892 <fd2data>
+  803618:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  80361a:	83 c4 08             	add    $0x8,%esp
+  80361d:	56                   	push   %esi
+  80361e:	6a 00                	push   $0x0
+  803620:	e8 de d7 ff ff       	call   800e03 <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  803625:	8d 53 04             	lea    0x4(%ebx),%edx
+  803628:	8d 43 08             	lea    0x8(%ebx),%eax
+  80362b:	e8 b3 ff ff ff       	call   8035e3 <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  803630:	8d 43 0c             	lea    0xc(%ebx),%eax
+  803633:	89 da                	mov    %ebx,%edx
+  803635:	e8 a9 ff ff ff       	call   8035e3 <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  80363a:	89 34 24             	mov    %esi,(%esp)
+  80363d:	e8 50 e2 ff ff       	call   801892 <fd2data>
+  803642:	83 c4 08             	add    $0x8,%esp
+  803645:	50                   	push   %eax
+  803646:	6a 00                	push   $0x0
+  803648:	e8 b6 d7 ff ff       	call   800e03 <sys_page_unmap>
+}
+  80364d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803650:	5b                   	pop    %ebx
+  803651:	5e                   	pop    %esi
+  803652:	5d                   	pop    %ebp
+  803653:	c3                   	ret
+
+00803654 <_pipeisclosed>:
+{
+  803654:	55                   	push   %ebp
+  803655:	89 e5                	mov    %esp,%ebp
+  803657:	57                   	push   %edi
+  803658:	56                   	push   %esi
+  803659:	53                   	push   %ebx
+  80365a:	83 ec 1c             	sub    $0x1c,%esp
+  80365d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803660:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803662:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  803667:	eb 5d                	jmp    8036c6 <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  803669:	8b 15 c0 76 80 00    	mov    0x8076c0,%edx
+		n = thisenv->env_runs;
+  80366f:	8b 02                	mov    (%edx),%eax
+  803671:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  803674:	83 ec 0c             	sub    $0xc,%esp
+  803677:	ff 75 e0             	push   -0x20(%ebp)
+  80367a:	e8 81 0f 00 00       	call   804600 <pageref>
+  80367f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803682:	89 3c 24             	mov    %edi,(%esp)
+  803685:	e8 76 0f 00 00       	call   804600 <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  80368a:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80368c:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  803692:	83 c4 10             	add    $0x10,%esp
+  803695:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  80369b:	77 15                	ja     8036b2 <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80369d:	89 f2                	mov    %esi,%edx
+  80369f:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  8036a1:	c1 ea 10             	shr    $0x10,%edx
+  8036a4:	74 0c                	je     8036b2 <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8036a6:	c1 e2 10             	shl    $0x10,%edx
+  8036a9:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8036ae:	29 d1                	sub    %edx,%ecx
+  8036b0:	eb 06                	jmp    8036b8 <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  8036b2:	8b 0d c0 76 80 00    	mov    0x8076c0,%ecx
+		nn = thisenv->env_runs;
+  8036b8:	8b 11                	mov    (%ecx),%edx
+  8036ba:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  8036bd:	39 d3                	cmp    %edx,%ebx
+  8036bf:	74 6e                	je     80372f <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  8036c1:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8036c4:	74 24                	je     8036ea <_pipeisclosed+0x96>
+  8036c6:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8036c8:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8036ce:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8036d3:	77 94                	ja     803669 <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8036d5:	89 f0                	mov    %esi,%eax
+  8036d7:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8036d9:	c1 e8 10             	shr    $0x10,%eax
+  8036dc:	74 8b                	je     803669 <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8036de:	c1 e0 10             	shl    $0x10,%eax
+  8036e1:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8036e6:	29 c2                	sub    %eax,%edx
+  8036e8:	eb 85                	jmp    80366f <_pipeisclosed+0x1b>
+  8036ea:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8036ec:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8036f2:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8036f7:	77 18                	ja     803711 <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8036f9:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8036fe:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803700:	c1 e8 10             	shr    $0x10,%eax
+  803703:	74 0c                	je     803711 <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803705:	c1 e0 10             	shl    $0x10,%eax
+  803708:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80370d:	29 c2                	sub    %eax,%edx
+  80370f:	eb 06                	jmp    803717 <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  803711:	8b 15 c0 76 80 00    	mov    0x8076c0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803717:	8b 02                	mov    (%edx),%eax
+  803719:	8b 40 58             	mov    0x58(%eax),%eax
+  80371c:	6a 01                	push   $0x1
+  80371e:	50                   	push   %eax
+  80371f:	53                   	push   %ebx
+  803720:	68 be 50 80 00       	push   $0x8050be
+  803725:	e8 1e cc ff ff       	call   800348 <cprintf>
+  80372a:	83 c4 10             	add    $0x10,%esp
+  80372d:	eb 97                	jmp    8036c6 <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  80372f:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803732:	0f 94 c0             	sete   %al
+  803735:	0f b6 c0             	movzbl %al,%eax
+}
+  803738:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80373b:	5b                   	pop    %ebx
+  80373c:	5e                   	pop    %esi
+  80373d:	5f                   	pop    %edi
+  80373e:	5d                   	pop    %ebp
+  80373f:	c3                   	ret
+
+00803740 <devpipe_write>:
+{
+  803740:	55                   	push   %ebp
+  803741:	89 e5                	mov    %esp,%ebp
+  803743:	57                   	push   %edi
+  803744:	56                   	push   %esi
+  803745:	53                   	push   %ebx
+  803746:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  803749:	ff 75 08             	push   0x8(%ebp)
+  80374c:	e8 41 e1 ff ff       	call   801892 <fd2data>
+  803751:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803753:	83 c4 10             	add    $0x10,%esp
+  803756:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  80375d:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  803760:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803763:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803766:	0f 84 96 00 00 00    	je     803802 <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  80376c:	8d 73 08             	lea    0x8(%ebx),%esi
+  80376f:	eb 32                	jmp    8037a3 <devpipe_write+0x63>
+  803771:	89 fa                	mov    %edi,%edx
+  803773:	89 f0                	mov    %esi,%eax
+  803775:	e8 69 fe ff ff       	call   8035e3 <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  80377a:	8b 43 04             	mov    0x4(%ebx),%eax
+  80377d:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  803780:	ba 01 00 00 00       	mov    $0x1,%edx
+  803785:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  80378a:	83 ec 04             	sub    $0x4,%esp
+  80378d:	6a 0a                	push   $0xa
+  80378f:	50                   	push   %eax
+  803790:	53                   	push   %ebx
+  803791:	e8 e9 d8 ff ff       	call   80107f <sys_futex_wait>
+  803796:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80379b:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  8037a0:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8037a3:	8b 43 04             	mov    0x4(%ebx),%eax
+  8037a6:	8b 0b                	mov    (%ebx),%ecx
+  8037a8:	8d 51 20             	lea    0x20(%ecx),%edx
+  8037ab:	39 d0                	cmp    %edx,%eax
+  8037ad:	72 1b                	jb     8037ca <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  8037af:	89 da                	mov    %ebx,%edx
+  8037b1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037b4:	e8 9b fe ff ff       	call   803654 <_pipeisclosed>
+  8037b9:	85 c0                	test   %eax,%eax
+  8037bb:	74 b4                	je     803771 <devpipe_write+0x31>
+				return 0;
+  8037bd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8037c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8037c5:	5b                   	pop    %ebx
+  8037c6:	5e                   	pop    %esi
+  8037c7:	5f                   	pop    %edi
+  8037c8:	5d                   	pop    %ebp
+  8037c9:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8037ca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8037cd:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8037d0:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  8037d4:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  8037d7:	89 c2                	mov    %eax,%edx
+  8037d9:	c1 fa 1f             	sar    $0x1f,%edx
+  8037dc:	89 d1                	mov    %edx,%ecx
+  8037de:	c1 e9 1b             	shr    $0x1b,%ecx
+  8037e1:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8037e4:	83 e2 1f             	and    $0x1f,%edx
+  8037e7:	29 ca                	sub    %ecx,%edx
+  8037e9:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  8037ed:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  8037f1:	83 c0 01             	add    $0x1,%eax
+  8037f4:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8037f7:	83 c6 01             	add    $0x1,%esi
+  8037fa:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8037fd:	e9 5e ff ff ff       	jmp    803760 <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  803802:	8d 53 04             	lea    0x4(%ebx),%edx
+  803805:	8d 43 08             	lea    0x8(%ebx),%eax
+  803808:	e8 d6 fd ff ff       	call   8035e3 <pipewake>
+	return i;
+  80380d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803810:	eb b0                	jmp    8037c2 <devpipe_write+0x82>
+
+00803812 <devpipe_read>:
+{
+  803812:	55                   	push   %ebp
+  803813:	89 e5                	mov    %esp,%ebp
+  803815:	57                   	push   %edi
+  803816:	56                   	push   %esi
+  803817:	53                   	push   %ebx
+  803818:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  80381b:	ff 75 08             	push   0x8(%ebp)
+  80381e:	e8 6f e0 ff ff       	call   801892 <fd2data>
+  803823:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803825:	83 c4 10             	add    $0x10,%esp
+  803828:	be 00 00 00 00       	mov    $0x0,%esi
+  80382d:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803830:	74 6c                	je     80389e <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  803832:	8d 7b 04             	lea    0x4(%ebx),%edi
+  803835:	eb 25                	jmp    80385c <devpipe_read+0x4a>
+  803837:	8b 13                	mov    (%ebx),%edx
+  803839:	b8 01 00 00 00       	mov    $0x1,%eax
+  80383e:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  803843:	83 ec 04             	sub    $0x4,%esp
+  803846:	6a 0a                	push   $0xa
+  803848:	52                   	push   %edx
+  803849:	57                   	push   %edi
+  80384a:	e8 30 d8 ff ff       	call   80107f <sys_futex_wait>
+  80384f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803854:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  803859:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  80385c:	8b 03                	mov    (%ebx),%eax
+  80385e:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803861:	75 19                	jne    80387c <devpipe_read+0x6a>
+			if (i > 0)
+  803863:	85 f6                	test   %esi,%esi
+  803865:	75 3a                	jne    8038a1 <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  803867:	89 da                	mov    %ebx,%edx
+  803869:	8b 45 08             	mov    0x8(%ebp),%eax
+  80386c:	e8 e3 fd ff ff       	call   803654 <_pipeisclosed>
+  803871:	85 c0                	test   %eax,%eax
+  803873:	74 c2                	je     803837 <devpipe_read+0x25>
+				return 0;
+  803875:	b8 00 00 00 00       	mov    $0x0,%eax
+  80387a:	eb 31                	jmp    8038ad <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80387c:	89 c1                	mov    %eax,%ecx
+  80387e:	c1 f9 1f             	sar    $0x1f,%ecx
+  803881:	c1 e9 1b             	shr    $0x1b,%ecx
+  803884:	01 c8                	add    %ecx,%eax
+  803886:	83 e0 1f             	and    $0x1f,%eax
+  803889:	29 c8                	sub    %ecx,%eax
+  80388b:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  803890:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803893:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  803896:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  803899:	83 c6 01             	add    $0x1,%esi
+  80389c:	eb 8f                	jmp    80382d <devpipe_read+0x1b>
+out:
+  80389e:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  8038a1:	8d 43 0c             	lea    0xc(%ebx),%eax
+  8038a4:	89 da                	mov    %ebx,%edx
+  8038a6:	e8 38 fd ff ff       	call   8035e3 <pipewake>
+	return i;
+  8038ab:	89 f0                	mov    %esi,%eax
+}
+  8038ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8038b0:	5b                   	pop    %ebx
+  8038b1:	5e                   	pop    %esi
+  8038b2:	5f                   	pop    %edi
+  8038b3:	5d                   	pop    %ebp
+  8038b4:	c3                   	ret
+
+008038b5 <pipe>:
+{
+  8038b5:	55                   	push   %ebp
+  8038b6:	89 e5                	mov    %esp,%ebp
+  8038b8:	56                   	push   %esi
+  8038b9:	53                   	push   %ebx
+  8038ba:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8038bd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8038c0:	50                   	push   %eax
+  8038c1:	e8 e3 df ff ff       	call   8018a9 <fd_alloc>
+  8038c6:	89 c3                	mov    %eax,%ebx
+  8038c8:	83 c4 10             	add    $0x10,%esp
+  8038cb:	85 c0                	test   %eax,%eax
+  8038cd:	0f 88 23 01 00 00    	js     8039f6 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8038d3:	83 ec 04             	sub    $0x4,%esp
+  8038d6:	68 07 04 00 00       	push   $0x407
+  8038db:	ff 75 f4             	push   -0xc(%ebp)
+  8038de:	6a 00                	push   $0x0
+  8038e0:	e8 85 d4 ff ff       	call   800d6a <sys_page_alloc>
+  8038e5:	89 c3                	mov    %eax,%ebx
+  8038e7:	83 c4 10             	add    $0x10,%esp
+  8038ea:	85 c0                	test   %eax,%eax
+  8038ec:	0f 88 04 01 00 00    	js     8039f6 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8038f2:	83 ec 0c             	sub    $0xc,%esp
+  8038f5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8038f8:	50                   	push   %eax
+  8038f9:	e8 ab df ff ff       	call   8018a9 <fd_alloc>
+  8038fe:	89 c3                	mov    %eax,%ebx
+  803900:	83 c4 10             	add    $0x10,%esp
+  803903:	85 c0                	test   %eax,%eax
+  803905:	0f 88 db 00 00 00    	js     8039e6 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80390b:	83 ec 04             	sub    $0x4,%esp
+  80390e:	68 07 04 00 00       	push   $0x407
+  803913:	ff 75 f0             	push   -0x10(%ebp)
+  803916:	6a 00                	push   $0x0
+  803918:	e8 4d d4 ff ff       	call   800d6a <sys_page_alloc>
+  80391d:	89 c3                	mov    %eax,%ebx
+  80391f:	83 c4 10             	add    $0x10,%esp
+  803922:	85 c0                	test   %eax,%eax
+  803924:	0f 88 bc 00 00 00    	js     8039e6 <pipe+0x131>
+	va = fd2data(fd0);
+  80392a:	83 ec 0c             	sub    $0xc,%esp
+  80392d:	ff 75 f4             	push   -0xc(%ebp)
+  803930:	e8 5d df ff ff       	call   801892 <fd2data>
+  803935:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803937:	83 c4 0c             	add    $0xc,%esp
+  80393a:	68 07 04 00 00       	push   $0x407
+  80393f:	50                   	push   %eax
+  803940:	6a 00                	push   $0x0
+  803942:	e8 23 d4 ff ff       	call   800d6a <sys_page_alloc>
+  803947:	89 c3                	mov    %eax,%ebx
+  803949:	83 c4 10             	add    $0x10,%esp
+  80394c:	85 c0                	test   %eax,%eax
+  80394e:	0f 88 82 00 00 00    	js     8039d6 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803954:	83 ec 0c             	sub    $0xc,%esp
+  803957:	ff 75 f0             	push   -0x10(%ebp)
+  80395a:	e8 33 df ff ff       	call   801892 <fd2data>
+  80395f:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803966:	50                   	push   %eax
+  803967:	6a 00                	push   $0x0
+  803969:	56                   	push   %esi
+  80396a:	6a 00                	push   $0x0
+  80396c:	e8 46 d4 ff ff       	call   800db7 <sys_page_map>
+  803971:	89 c3                	mov    %eax,%ebx
+  803973:	83 c4 20             	add    $0x20,%esp
+  803976:	85 c0                	test   %eax,%eax
+  803978:	78 4e                	js     8039c8 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80397a:	a1 7c 62 80 00       	mov    0x80627c,%eax
+  80397f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803982:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803984:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803987:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80398e:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803991:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803993:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803996:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80399d:	83 ec 0c             	sub    $0xc,%esp
+  8039a0:	ff 75 f4             	push   -0xc(%ebp)
+  8039a3:	e8 da de ff ff       	call   801882 <fd2num>
+  8039a8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8039ab:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8039ad:	83 c4 04             	add    $0x4,%esp
+  8039b0:	ff 75 f0             	push   -0x10(%ebp)
+  8039b3:	e8 ca de ff ff       	call   801882 <fd2num>
+  8039b8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8039bb:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8039be:	83 c4 10             	add    $0x10,%esp
+  8039c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8039c6:	eb 2e                	jmp    8039f6 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8039c8:	83 ec 08             	sub    $0x8,%esp
+  8039cb:	56                   	push   %esi
+  8039cc:	6a 00                	push   $0x0
+  8039ce:	e8 30 d4 ff ff       	call   800e03 <sys_page_unmap>
+  8039d3:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8039d6:	83 ec 08             	sub    $0x8,%esp
+  8039d9:	ff 75 f0             	push   -0x10(%ebp)
+  8039dc:	6a 00                	push   $0x0
+  8039de:	e8 20 d4 ff ff       	call   800e03 <sys_page_unmap>
+  8039e3:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8039e6:	83 ec 08             	sub    $0x8,%esp
+  8039e9:	ff 75 f4             	push   -0xc(%ebp)
+  8039ec:	6a 00                	push   $0x0
+  8039ee:	e8 10 d4 ff ff       	call   800e03 <sys_page_unmap>
+  8039f3:	83 c4 10             	add    $0x10,%esp
+}
+  8039f6:	89 d8                	mov    %ebx,%eax
+  8039f8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8039fb:	5b                   	pop    %ebx
+  8039fc:	5e                   	pop    %esi
+  8039fd:	5d                   	pop    %ebp
+  8039fe:	c3                   	ret
+
+008039ff <pipeisclosed>:
+{
+  8039ff:	55                   	push   %ebp
+  803a00:	89 e5                	mov    %esp,%ebp
+  803a02:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803a05:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803a08:	50                   	push   %eax
+  803a09:	ff 75 08             	push   0x8(%ebp)
+  803a0c:	e8 ee de ff ff       	call   8018ff <fd_lookup>
+  803a11:	83 c4 10             	add    $0x10,%esp
+  803a14:	85 c0                	test   %eax,%eax
+  803a16:	78 18                	js     803a30 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803a18:	83 ec 0c             	sub    $0xc,%esp
+  803a1b:	ff 75 f4             	push   -0xc(%ebp)
+  803a1e:	e8 6f de ff ff       	call   801892 <fd2data>
+  803a23:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803a25:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803a28:	e8 27 fc ff ff       	call   803654 <_pipeisclosed>
+  803a2d:	83 c4 10             	add    $0x10,%esp
+}
+  803a30:	c9                   	leave
+  803a31:	c3                   	ret
+
+00803a32 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  803a32:	55                   	push   %ebp
+  803a33:	89 e5                	mov    %esp,%ebp
+  803a35:	56                   	push   %esi
+  803a36:	53                   	push   %ebx
+  803a37:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  803a3a:	85 f6                	test   %esi,%esi
+  803a3c:	74 15                	je     803a53 <wait+0x21>
+	e = &envs[ENVX(envid)];
+  803a3e:	89 f0                	mov    %esi,%eax
+  803a40:	25 ff 03 00 00       	and    $0x3ff,%eax
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  803a45:	8d 1c c0             	lea    (%eax,%eax,8),%ebx
+  803a48:	c1 e3 04             	shl    $0x4,%ebx
+  803a4b:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  803a51:	eb 1b                	jmp    803a6e <wait+0x3c>
+	assert(envid != 0);
+  803a53:	68 d6 50 80 00       	push   $0x8050d6
+  803a58:	68 31 4f 80 00       	push   $0x804f31
+  803a5d:	6a 09                	push   $0x9
+  803a5f:	68 e1 50 80 00       	push   $0x8050e1
+  803a64:	e8 04 c8 ff ff       	call   80026d <_panic>
+		sys_yield();
+  803a69:	e8 d0 d2 ff ff       	call   800d3e <sys_yield>
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  803a6e:	8b 43 48             	mov    0x48(%ebx),%eax
+  803a71:	39 f0                	cmp    %esi,%eax
+  803a73:	75 07                	jne    803a7c <wait+0x4a>
+  803a75:	8b 43 54             	mov    0x54(%ebx),%eax
+  803a78:	85 c0                	test   %eax,%eax
+  803a7a:	75 ed                	jne    803a69 <wait+0x37>
+}
+  803a7c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803a7f:	5b                   	pop    %ebx
+  803a80:	5e                   	pop    %esi
+  803a81:	5d                   	pop    %ebp
+  803a82:	c3                   	ret
+
+00803a83 <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  803a83:	55                   	push   %ebp
+  803a84:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  803a86:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a89:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803a8f:	5d                   	pop    %ebp
+  803a90:	c3                   	ret
+
+00803a91 <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  803a91:	55                   	push   %ebp
+  803a92:	89 e5                	mov    %esp,%ebp
+  803a94:	56                   	push   %esi
+  803a95:	53                   	push   %ebx
+  803a96:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803a99:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a9e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803aa3:	89 d0                	mov    %edx,%eax
+  803aa5:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  803aa9:	85 c0                	test   %eax,%eax
+  803aab:	74 2d                	je     803ada <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  803aad:	83 f8 02             	cmp    $0x2,%eax
+  803ab0:	74 08                	je     803aba <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  803ab2:	b8 02 00 00 00       	mov    $0x2,%eax
+  803ab7:	f0 87 03             	lock xchg %eax,(%ebx)
+  803aba:	be 02 00 00 00       	mov    $0x2,%esi
+  803abf:	eb 15                	jmp    803ad6 <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  803ac1:	83 ec 04             	sub    $0x4,%esp
+  803ac4:	6a 00                	push   $0x0
+  803ac6:	6a 02                	push   $0x2
+  803ac8:	53                   	push   %ebx
+  803ac9:	e8 b1 d5 ff ff       	call   80107f <sys_futex_wait>
+  803ace:	89 f0                	mov    %esi,%eax
+  803ad0:	f0 87 03             	lock xchg %eax,(%ebx)
+  803ad3:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  803ad6:	85 c0                	test   %eax,%eax
+  803ad8:	75 e7                	jne    803ac1 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  803ada:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803add:	5b                   	pop    %ebx
+  803ade:	5e                   	pop    %esi
+  803adf:	5d                   	pop    %ebp
+  803ae0:	c3                   	ret
+
+00803ae1 <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  803ae1:	55                   	push   %ebp
+  803ae2:	89 e5                	mov    %esp,%ebp
+  803ae4:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803ae7:	b8 00 00 00 00       	mov    $0x0,%eax
+  803aec:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803af1:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  803af5:	f7 d8                	neg    %eax
+  803af7:	19 c0                	sbb    %eax,%eax
+  803af9:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  803afc:	5d                   	pop    %ebp
+  803afd:	c3                   	ret
+
+00803afe <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  803afe:	55                   	push   %ebp
+  803aff:	89 e5                	mov    %esp,%ebp
+  803b01:	83 ec 08             	sub    $0x8,%esp
+  803b04:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  803b07:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b0c:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  803b0f:	83 f8 02             	cmp    $0x2,%eax
+  803b12:	74 02                	je     803b16 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  803b14:	c9                   	leave
+  803b15:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  803b16:	83 ec 08             	sub    $0x8,%esp
+  803b19:	6a 01                	push   $0x1
+  803b1b:	52                   	push   %edx
+  803b1c:	e8 8d d5 ff ff       	call   8010ae <sys_futex_wake>
+  803b21:	83 c4 10             	add    $0x10,%esp
+}
+  803b24:	eb ee                	jmp    803b14 <mutex_unlock+0x16>
+
+00803b26 <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  803b26:	55                   	push   %ebp
+  803b27:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  803b29:	8b 45 08             	mov    0x8(%ebp),%eax
+  803b2c:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803b32:	5d                   	pop    %ebp
+  803b33:	c3                   	ret
+
+00803b34 <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  803b34:	55                   	push   %ebp
+  803b35:	89 e5                	mov    %esp,%ebp
+  803b37:	57                   	push   %edi
+  803b38:	56                   	push   %esi
+  803b39:	53                   	push   %ebx
+  803b3a:	83 ec 18             	sub    $0x18,%esp
+  803b3d:	8b 75 08             	mov    0x8(%ebp),%esi
+  803b40:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  803b43:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  803b45:	53                   	push   %ebx
+  803b46:	e8 b3 ff ff ff       	call   803afe <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  803b4b:	83 c4 0c             	add    $0xc,%esp
+  803b4e:	ff 75 10             	push   0x10(%ebp)
+  803b51:	57                   	push   %edi
+  803b52:	56                   	push   %esi
+  803b53:	e8 27 d5 ff ff       	call   80107f <sys_futex_wait>
+  803b58:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  803b5a:	83 c4 10             	add    $0x10,%esp
+  803b5d:	be 02 00 00 00       	mov    $0x2,%esi
+  803b62:	eb 10                	jmp    803b74 <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  803b64:	83 ec 04             	sub    $0x4,%esp
+  803b67:	6a 00                	push   $0x0
+  803b69:	6a 02                	push   $0x2
+  803b6b:	53                   	push   %ebx
+  803b6c:	e8 0e d5 ff ff       	call   80107f <sys_futex_wait>
+  803b71:	83 c4 10             	add    $0x10,%esp
+  803b74:	89 f0                	mov    %esi,%eax
+  803b76:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  803b79:	85 c0                	test   %eax,%eax
+  803b7b:	75 e7                	jne    803b64 <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  803b7d:	83 ff ec             	cmp    $0xffffffec,%edi
+  803b80:	74 05                	je     803b87 <cond_timedwait+0x53>
+  803b82:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803b87:	89 f8                	mov    %edi,%eax
+  803b89:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803b8c:	5b                   	pop    %ebx
+  803b8d:	5e                   	pop    %esi
+  803b8e:	5f                   	pop    %edi
+  803b8f:	5d                   	pop    %ebp
+  803b90:	c3                   	ret
+
+00803b91 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  803b91:	55                   	push   %ebp
+  803b92:	89 e5                	mov    %esp,%ebp
+  803b94:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  803b97:	6a 00                	push   $0x0
+  803b99:	ff 75 0c             	push   0xc(%ebp)
+  803b9c:	ff 75 08             	push   0x8(%ebp)
+  803b9f:	e8 90 ff ff ff       	call   803b34 <cond_timedwait>
+}
+  803ba4:	83 c4 10             	add    $0x10,%esp
+  803ba7:	c9                   	leave
+  803ba8:	c3                   	ret
+
+00803ba9 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  803ba9:	55                   	push   %ebp
+  803baa:	89 e5                	mov    %esp,%ebp
+  803bac:	83 ec 10             	sub    $0x10,%esp
+  803baf:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  803bb2:	ba 01 00 00 00       	mov    $0x1,%edx
+  803bb7:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  803bbb:	6a 01                	push   $0x1
+  803bbd:	50                   	push   %eax
+  803bbe:	e8 eb d4 ff ff       	call   8010ae <sys_futex_wake>
+}
+  803bc3:	83 c4 10             	add    $0x10,%esp
+  803bc6:	c9                   	leave
+  803bc7:	c3                   	ret
+
+00803bc8 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  803bc8:	55                   	push   %ebp
+  803bc9:	89 e5                	mov    %esp,%ebp
+  803bcb:	83 ec 10             	sub    $0x10,%esp
+  803bce:	8b 45 08             	mov    0x8(%ebp),%eax
+  803bd1:	ba 01 00 00 00       	mov    $0x1,%edx
+  803bd6:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  803bda:	68 00 04 00 00       	push   $0x400
+  803bdf:	50                   	push   %eax
+  803be0:	e8 c9 d4 ff ff       	call   8010ae <sys_futex_wake>
+}
+  803be5:	83 c4 10             	add    $0x10,%esp
+  803be8:	c9                   	leave
+  803be9:	c3                   	ret
+
+00803bea <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  803bea:	55                   	push   %ebp
+  803beb:	89 e5                	mov    %esp,%ebp
+  803bed:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  803bf0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803bf3:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  803bf5:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  803bfc:	5d                   	pop    %ebp
+  803bfd:	c3                   	ret
+
+00803bfe <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  803bfe:	55                   	push   %ebp
+  803bff:	89 e5                	mov    %esp,%ebp
+  803c01:	53                   	push   %ebx
+  803c02:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  803c05:	8b 11                	mov    (%ecx),%edx
+  803c07:	85 d2                	test   %edx,%edx
+  803c09:	74 14                	je     803c1f <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  803c0b:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803c0e:	89 d0                	mov    %edx,%eax
+  803c10:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  803c14:	39 c2                	cmp    %eax,%edx
+  803c16:	75 ed                	jne    803c05 <sem_trywait+0x7>
+			return 0;
+  803c18:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c1d:	eb 05                	jmp    803c24 <sem_trywait+0x26>
+	return -E_AGAIN;
+  803c1f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  803c24:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803c27:	c9                   	leave
+  803c28:	c3                   	ret
+
+00803c29 <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  803c29:	55                   	push   %ebp
+  803c2a:	89 e5                	mov    %esp,%ebp
+  803c2c:	57                   	push   %edi
+  803c2d:	56                   	push   %esi
+  803c2e:	53                   	push   %ebx
+  803c2f:	83 ec 1c             	sub    $0x1c,%esp
+  803c32:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803c35:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  803c38:	e8 ba d3 ff ff       	call   800ff7 <sys_time_msec>
+  803c3d:	01 f8                	add    %edi,%eax
+  803c3f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  803c42:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  803c47:	eb 28                	jmp    803c71 <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  803c49:	b8 01 00 00 00       	mov    $0x1,%eax
+  803c4e:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  803c53:	83 ec 04             	sub    $0x4,%esp
+  803c56:	56                   	push   %esi
+  803c57:	6a 00                	push   $0x0
+  803c59:	53                   	push   %ebx
+  803c5a:	e8 20 d4 ff ff       	call   80107f <sys_futex_wait>
+  803c5f:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  803c64:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  803c69:	83 c4 10             	add    $0x10,%esp
+  803c6c:	83 f8 ec             	cmp    $0xffffffec,%eax
+  803c6f:	74 2e                	je     803c9f <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  803c71:	83 ec 0c             	sub    $0xc,%esp
+  803c74:	53                   	push   %ebx
+  803c75:	e8 84 ff ff ff       	call   803bfe <sem_trywait>
+  803c7a:	83 c4 10             	add    $0x10,%esp
+  803c7d:	85 c0                	test   %eax,%eax
+  803c7f:	79 19                	jns    803c9a <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  803c81:	85 ff                	test   %edi,%edi
+  803c83:	74 c4                	je     803c49 <sem_timedwait+0x20>
+  803c85:	e8 6d d3 ff ff       	call   800ff7 <sys_time_msec>
+  803c8a:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803c8d:	29 c6                	sub    %eax,%esi
+  803c8f:	85 f6                	test   %esi,%esi
+  803c91:	7f b6                	jg     803c49 <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  803c93:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  803c98:	eb 05                	jmp    803c9f <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  803c9a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c9f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ca2:	5b                   	pop    %ebx
+  803ca3:	5e                   	pop    %esi
+  803ca4:	5f                   	pop    %edi
+  803ca5:	5d                   	pop    %ebp
+  803ca6:	c3                   	ret
+
+00803ca7 <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  803ca7:	55                   	push   %ebp
+  803ca8:	89 e5                	mov    %esp,%ebp
+  803caa:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  803cad:	6a 00                	push   $0x0
+  803caf:	ff 75 08             	push   0x8(%ebp)
+  803cb2:	e8 72 ff ff ff       	call   803c29 <sem_timedwait>
+}
+  803cb7:	83 c4 10             	add    $0x10,%esp
+  803cba:	c9                   	leave
+  803cbb:	c3                   	ret
+
+00803cbc <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  803cbc:	55                   	push   %ebp
+  803cbd:	89 e5                	mov    %esp,%ebp
+  803cbf:	83 ec 08             	sub    $0x8,%esp
+  803cc2:	8b 45 08             	mov    0x8(%ebp),%eax
+  803cc5:	ba 01 00 00 00       	mov    $0x1,%edx
+  803cca:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  803cce:	8b 50 04             	mov    0x4(%eax),%edx
+  803cd1:	85 d2                	test   %edx,%edx
+  803cd3:	75 02                	jne    803cd7 <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  803cd5:	c9                   	leave
+  803cd6:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  803cd7:	83 ec 08             	sub    $0x8,%esp
+  803cda:	6a 01                	push   $0x1
+  803cdc:	50                   	push   %eax
+  803cdd:	e8 cc d3 ff ff       	call   8010ae <sys_futex_wake>
+  803ce2:	83 c4 10             	add    $0x10,%esp
+}
+  803ce5:	eb ee                	jmp    803cd5 <sem_post+0x19>
+
+00803ce7 <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  803ce7:	55                   	push   %ebp
+  803ce8:	89 e5                	mov    %esp,%ebp
+  803cea:	57                   	push   %edi
+  803ceb:	56                   	push   %esi
+  803cec:	53                   	push   %ebx
+  803ced:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  803cf0:	68 20 70 80 00       	push   $0x807020
+  803cf5:	e8 97 fd ff ff       	call   803a91 <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  803cfa:	a1 44 70 80 00       	mov    0x807044,%eax
+  803cff:	83 c4 10             	add    $0x10,%esp
+  803d02:	85 c0                	test   %eax,%eax
+  803d04:	75 19                	jne    803d1f <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  803d06:	a1 c0 76 80 00       	mov    0x8076c0,%eax
+  803d0b:	8b 00                	mov    (%eax),%eax
+  803d0d:	8b 40 48             	mov    0x48(%eax),%eax
+  803d10:	a3 40 70 80 00       	mov    %eax,0x807040
+		threads[0].th_state = PTH_RUNNING;
+  803d15:	c7 05 44 70 80 00 01 	movl   $0x1,0x807044
+  803d1c:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803d1f:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  803d24:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803d27:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803d2e:	8b 40 04             	mov    0x4(%eax),%eax
+  803d31:	85 c0                	test   %eax,%eax
+  803d33:	0f 84 e4 00 00 00    	je     803e1d <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803d39:	83 c3 01             	add    $0x1,%ebx
+  803d3c:	83 fb 20             	cmp    $0x20,%ebx
+  803d3f:	75 e3                	jne    803d24 <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  803d41:	83 ec 0c             	sub    $0xc,%esp
+  803d44:	68 20 70 80 00       	push   $0x807020
+  803d49:	e8 b0 fd ff ff       	call   803afe <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  803d4e:	83 c4 10             	add    $0x10,%esp
+  803d51:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  803d56:	e9 b8 00 00 00       	jmp    803e13 <pthread_create+0x12c>
+  803d5b:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  803d5e:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  803d61:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  803d63:	39 f3                	cmp    %esi,%ebx
+  803d65:	73 16                	jae    803d7d <pthread_create+0x96>
+		va -= PGSIZE;
+  803d67:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  803d6d:	83 ec 08             	sub    $0x8,%esp
+  803d70:	56                   	push   %esi
+  803d71:	6a 00                	push   $0x0
+  803d73:	e8 8b d0 ff ff       	call   800e03 <sys_page_unmap>
+  803d78:	83 c4 10             	add    $0x10,%esp
+  803d7b:	eb e6                	jmp    803d63 <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  803d7d:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803d80:	83 ec 08             	sub    $0x8,%esp
+  803d83:	ff 75 e4             	push   -0x1c(%ebp)
+  803d86:	6a 00                	push   $0x0
+  803d88:	e8 76 d0 ff ff       	call   800e03 <sys_page_unmap>
+	return r;
+  803d8d:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  803d90:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803d93:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803d9a:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  803da1:	eb 70                	jmp    803e13 <pthread_create+0x12c>
+	th->th_fn = fn;
+  803da3:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803da6:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803dad:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803db0:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  803db3:	8b 55 10             	mov    0x10(%ebp),%edx
+  803db6:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  803db9:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  803dc0:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  803dc5:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803dc8:	29 c8                	sub    %ecx,%eax
+  803dca:	85 db                	test   %ebx,%ebx
+  803dcc:	0f 44 05 c0 76 80 00 	cmove  0x8076c0,%eax
+	*--esp = t;
+  803dd3:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  803dd6:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803ddd:	83 ec 04             	sub    $0x4,%esp
+  803de0:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803de5:	29 ca                	sub    %ecx,%edx
+  803de7:	52                   	push   %edx
+	*--esp = 0;
+  803de8:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803deb:	50                   	push   %eax
+  803dec:	68 44 40 80 00       	push   $0x804044
+  803df1:	e8 5d d3 ff ff       	call   801153 <sys_thread_create>
+  803df6:	89 c7                	mov    %eax,%edi
+  803df8:	83 c4 10             	add    $0x10,%esp
+  803dfb:	85 c0                	test   %eax,%eax
+  803dfd:	78 91                	js     803d90 <pthread_create+0xa9>
+	th->th_env = id;
+  803dff:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803e02:	89 3c 85 40 70 80 00 	mov    %edi,0x807040(,%eax,4)
+	*tp = t;
+  803e09:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e0c:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  803e0e:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803e13:	89 f8                	mov    %edi,%eax
+  803e15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e18:	5b                   	pop    %ebx
+  803e19:	5e                   	pop    %esi
+  803e1a:	5f                   	pop    %edi
+  803e1b:	5d                   	pop    %ebp
+  803e1c:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  803e1d:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803e20:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803e27:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  803e2e:	83 ec 0c             	sub    $0xc,%esp
+  803e31:	68 20 70 80 00       	push   $0x807020
+  803e36:	e8 c3 fc ff ff       	call   803afe <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  803e3b:	89 d9                	mov    %ebx,%ecx
+  803e3d:	c1 e1 10             	shl    $0x10,%ecx
+  803e40:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  803e43:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  803e48:	29 c8                	sub    %ecx,%eax
+  803e4a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  803e4d:	c1 e8 16             	shr    $0x16,%eax
+  803e50:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803e57:	83 c4 10             	add    $0x10,%esp
+  803e5a:	a8 01                	test   $0x1,%al
+  803e5c:	74 15                	je     803e73 <pthread_create+0x18c>
+  803e5e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803e61:	c1 e8 0c             	shr    $0xc,%eax
+  803e64:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803e6b:	a8 01                	test   $0x1,%al
+  803e6d:	0f 85 30 ff ff ff    	jne    803da3 <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803e73:	83 ec 04             	sub    $0x4,%esp
+  803e76:	6a 07                	push   $0x7
+  803e78:	ff 75 e4             	push   -0x1c(%ebp)
+  803e7b:	6a 00                	push   $0x0
+  803e7d:	e8 e8 ce ff ff       	call   800d6a <sys_page_alloc>
+  803e82:	89 c7                	mov    %eax,%edi
+  803e84:	83 c4 10             	add    $0x10,%esp
+  803e87:	85 c0                	test   %eax,%eax
+  803e89:	0f 88 01 ff ff ff    	js     803d90 <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  803e8f:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  803e94:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  803e97:	29 d0                	sub    %edx,%eax
+  803e99:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  803e9c:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803e9e:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  803ea3:	29 d0                	sub    %edx,%eax
+  803ea5:	89 c7                	mov    %eax,%edi
+  803ea7:	39 fe                	cmp    %edi,%esi
+  803ea9:	0f 83 f4 fe ff ff    	jae    803da3 <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803eaf:	83 ec 04             	sub    $0x4,%esp
+  803eb2:	6a 07                	push   $0x7
+  803eb4:	56                   	push   %esi
+  803eb5:	6a 00                	push   $0x0
+  803eb7:	e8 ae ce ff ff       	call   800d6a <sys_page_alloc>
+  803ebc:	83 c4 10             	add    $0x10,%esp
+  803ebf:	85 c0                	test   %eax,%eax
+  803ec1:	0f 88 94 fe ff ff    	js     803d5b <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803ec7:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803ecd:	eb d8                	jmp    803ea7 <pthread_create+0x1c0>
+
+00803ecf <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  803ecf:	55                   	push   %ebp
+  803ed0:	89 e5                	mov    %esp,%ebp
+  803ed2:	57                   	push   %edi
+  803ed3:	56                   	push   %esi
+  803ed4:	53                   	push   %ebx
+  803ed5:	83 ec 0c             	sub    $0xc,%esp
+  803ed8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  803edb:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  803ede:	83 f8 1e             	cmp    $0x1e,%eax
+  803ee1:	0f 87 c7 00 00 00    	ja     803fae <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  803ee7:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803ee9:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803eef:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803ef4:	77 12                	ja     803f08 <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803ef6:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803efb:	29 d0                	sub    %edx,%eax
+  803efd:	c1 e8 10             	shr    $0x10,%eax
+  803f00:	39 c3                	cmp    %eax,%ebx
+  803f02:	0f 84 ad 00 00 00    	je     803fb5 <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803f08:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803f0b:	8d 3c 85 44 70 80 00 	lea    0x807044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  803f12:	8d 34 85 40 70 80 00 	lea    0x807040(,%eax,4),%esi
+  803f19:	eb 10                	jmp    803f2b <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803f1b:	83 ec 04             	sub    $0x4,%esp
+  803f1e:	6a 00                	push   $0x0
+  803f20:	6a 01                	push   $0x1
+  803f22:	57                   	push   %edi
+  803f23:	e8 57 d1 ff ff       	call   80107f <sys_futex_wait>
+  803f28:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  803f2b:	8b 46 04             	mov    0x4(%esi),%eax
+  803f2e:	83 f8 01             	cmp    $0x1,%eax
+  803f31:	74 e8                	je     803f1b <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  803f33:	83 f8 02             	cmp    $0x2,%eax
+  803f36:	0f 85 80 00 00 00    	jne    803fbc <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  803f3c:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  803f3f:	c1 e6 02             	shl    $0x2,%esi
+  803f42:	eb 05                	jmp    803f49 <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  803f44:	e8 f5 cd ff ff       	call   800d3e <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  803f49:	8b 8e 40 70 80 00    	mov    0x807040(%esi),%ecx
+  803f4f:	89 ca                	mov    %ecx,%edx
+  803f51:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  803f57:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803f5a:	c1 e0 04             	shl    $0x4,%eax
+  803f5d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803f62:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  803f65:	39 c1                	cmp    %eax,%ecx
+  803f67:	75 12                	jne    803f7b <pthread_join+0xac>
+  803f69:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803f6c:	c1 e0 04             	shl    $0x4,%eax
+  803f6f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803f74:	8b 40 54             	mov    0x54(%eax),%eax
+  803f77:	85 c0                	test   %eax,%eax
+  803f79:	75 c9                	jne    803f44 <pthread_join+0x75>
+	if (ret_store)
+  803f7b:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803f7f:	74 0f                	je     803f90 <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  803f81:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803f84:	8b 04 85 50 70 80 00 	mov    0x807050(,%eax,4),%eax
+  803f8b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803f8e:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  803f90:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803f93:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803f9a:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  803fa1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803fa6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803fa9:	5b                   	pop    %ebx
+  803faa:	5e                   	pop    %esi
+  803fab:	5f                   	pop    %edi
+  803fac:	5d                   	pop    %ebp
+  803fad:	c3                   	ret
+		return -E_INVAL;
+  803fae:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803fb3:	eb f1                	jmp    803fa6 <pthread_join+0xd7>
+  803fb5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803fba:	eb ea                	jmp    803fa6 <pthread_join+0xd7>
+		return -E_INVAL;
+  803fbc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803fc1:	eb e3                	jmp    803fa6 <pthread_join+0xd7>
+
+00803fc3 <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  803fc3:	55                   	push   %ebp
+  803fc4:	89 e5                	mov    %esp,%ebp
+  803fc6:	53                   	push   %ebx
+  803fc7:	83 ec 04             	sub    $0x4,%esp
+  803fca:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803fcc:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803fd2:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803fd7:	77 0c                	ja     803fe5 <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803fd9:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803fde:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  803fe0:	c1 e8 10             	shr    $0x10,%eax
+  803fe3:	75 0a                	jne    803fef <pthread_exit+0x2c>
+		exit();
+  803fe5:	e8 5b c2 ff ff       	call   800245 <exit>
+  803fea:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  803fef:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  803ff6:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  803ff9:	8d 0c 8d 40 70 80 00 	lea    0x807040(,%ecx,4),%ecx
+  804000:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  804003:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  804006:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  80400d:	83 ec 08             	sub    $0x8,%esp
+  804010:	6a 20                	push   $0x20
+  804012:	01 c2                	add    %eax,%edx
+  804014:	8d 04 95 44 70 80 00 	lea    0x807044(,%edx,4),%eax
+  80401b:	50                   	push   %eax
+  80401c:	e8 8d d0 ff ff       	call   8010ae <sys_futex_wake>
+	sys_env_destroy(0);
+  804021:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  804028:	e8 9a cc ff ff       	call   800cc7 <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  80402d:	83 c4 0c             	add    $0xc,%esp
+  804030:	68 ec 50 80 00       	push   $0x8050ec
+  804035:	68 a5 00 00 00       	push   $0xa5
+  80403a:	68 06 51 80 00       	push   $0x805106
+  80403f:	e8 29 c2 ff ff       	call   80026d <_panic>
+
+00804044 <pthread_start>:
+{
+  804044:	55                   	push   %ebp
+  804045:	89 e5                	mov    %esp,%ebp
+  804047:	53                   	push   %ebx
+  804048:	83 ec 04             	sub    $0x4,%esp
+  80404b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  80404e:	e8 bf cc ff ff       	call   800d12 <sys_getenvid>
+  804053:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  804058:	8b 15 c0 76 80 00    	mov    0x8076c0,%edx
+	if (t == 0)
+  80405e:	85 db                	test   %ebx,%ebx
+  804060:	74 0c                	je     80406e <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804062:	89 d9                	mov    %ebx,%ecx
+  804064:	c1 e1 10             	shl    $0x10,%ecx
+  804067:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80406c:	29 ca                	sub    %ecx,%edx
+  80406e:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  804071:	c1 e0 04             	shl    $0x4,%eax
+  804074:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804079:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  80407b:	83 ec 0c             	sub    $0xc,%esp
+  80407e:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  804085:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  804088:	ff 34 95 4c 70 80 00 	push   0x80704c(,%edx,4)
+  80408f:	ff 14 95 48 70 80 00 	call   *0x807048(,%edx,4)
+  804096:	89 04 24             	mov    %eax,(%esp)
+  804099:	e8 25 ff ff ff       	call   803fc3 <pthread_exit>
+
+0080409e <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  80409e:	55                   	push   %ebp
+  80409f:	89 e5                	mov    %esp,%ebp
+  8040a1:	57                   	push   %edi
+  8040a2:	56                   	push   %esi
+  8040a3:	53                   	push   %ebx
+  8040a4:	83 ec 1c             	sub    $0x1c,%esp
+  8040a7:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8040a9:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  8040af:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8040b6:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8040bb:	77 0d                	ja     8040ca <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8040bd:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8040c2:	29 d0                	sub    %edx,%eax
+  8040c4:	c1 e8 10             	shr    $0x10,%eax
+  8040c7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  8040ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8040cf:	eb 2f                	jmp    804100 <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  8040d1:	8b 0d c0 76 80 00    	mov    0x8076c0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  8040d7:	8b 01                	mov    (%ecx),%eax
+  8040d9:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  8040dc:	39 c2                	cmp    %eax,%edx
+  8040de:	75 14                	jne    8040f4 <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  8040e0:	83 ec 0c             	sub    $0xc,%esp
+  8040e3:	57                   	push   %edi
+  8040e4:	e8 de cb ff ff       	call   800cc7 <sys_env_destroy>
+  8040e9:	83 c4 10             	add    $0x10,%esp
+  8040ec:	85 c0                	test   %eax,%eax
+  8040ee:	0f 88 97 00 00 00    	js     80418b <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  8040f4:	83 c3 01             	add    $0x1,%ebx
+  8040f7:	83 fb 20             	cmp    $0x20,%ebx
+  8040fa:	0f 84 d2 00 00 00    	je     8041d2 <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  804100:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  804103:	74 ef                	je     8040f4 <pthread_kill_others+0x56>
+  804105:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  804108:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  80410f:	8b 40 04             	mov    0x4(%eax),%eax
+  804112:	83 f8 01             	cmp    $0x1,%eax
+  804115:	75 dd                	jne    8040f4 <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  804117:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80411a:	8b 3c 85 40 70 80 00 	mov    0x807040(,%eax,4),%edi
+  804121:	89 fe                	mov    %edi,%esi
+  804123:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  804129:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  80412c:	c1 e0 04             	shl    $0x4,%eax
+  80412f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804134:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  804137:	39 c7                	cmp    %eax,%edi
+  804139:	75 b9                	jne    8040f4 <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  80413b:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  80413e:	c1 e0 04             	shl    $0x4,%eax
+  804141:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804146:	8b 40 54             	mov    0x54(%eax),%eax
+  804149:	85 c0                	test   %eax,%eax
+  80414b:	74 a7                	je     8040f4 <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  80414d:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  804150:	c1 e0 04             	shl    $0x4,%eax
+  804153:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  804159:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80415b:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  804161:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804166:	0f 87 65 ff ff ff    	ja     8040d1 <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80416c:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804171:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  804173:	c1 e8 10             	shr    $0x10,%eax
+  804176:	0f 84 55 ff ff ff    	je     8040d1 <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80417c:	c1 e0 10             	shl    $0x10,%eax
+  80417f:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  804184:	29 c1                	sub    %eax,%ecx
+  804186:	e9 4c ff ff ff       	jmp    8040d7 <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  80418b:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  80418e:	c1 e2 04             	shl    $0x4,%edx
+  804191:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  804197:	8b 52 48             	mov    0x48(%edx),%edx
+  80419a:	39 fa                	cmp    %edi,%edx
+  80419c:	0f 85 52 ff ff ff    	jne    8040f4 <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  8041a2:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  8041a5:	c1 e2 04             	shl    $0x4,%edx
+  8041a8:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8041ae:	8b 52 54             	mov    0x54(%edx),%edx
+  8041b1:	85 d2                	test   %edx,%edx
+  8041b3:	0f 84 3b ff ff ff    	je     8040f4 <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  8041b9:	83 ec 0c             	sub    $0xc,%esp
+  8041bc:	50                   	push   %eax
+  8041bd:	57                   	push   %edi
+  8041be:	68 14 51 80 00       	push   $0x805114
+  8041c3:	68 bb 00 00 00       	push   $0xbb
+  8041c8:	68 06 51 80 00       	push   $0x805106
+  8041cd:	e8 9b c0 ff ff       	call   80026d <_panic>
+	}
+}
+  8041d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8041d5:	5b                   	pop    %ebx
+  8041d6:	5e                   	pop    %esi
+  8041d7:	5f                   	pop    %edi
+  8041d8:	5d                   	pop    %ebp
+  8041d9:	c3                   	ret
+
+008041da <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  8041da:	55                   	push   %ebp
+  8041db:	89 e5                	mov    %esp,%ebp
+  8041dd:	53                   	push   %ebx
+  8041de:	83 ec 04             	sub    $0x4,%esp
+  8041e1:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8041e3:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  8041e9:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8041ef:	0f 87 85 00 00 00    	ja     80427a <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8041f5:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  8041fa:	29 c3                	sub    %eax,%ebx
+  8041fc:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  8041ff:	83 ec 04             	sub    $0x4,%esp
+  804202:	68 80 02 00 00       	push   $0x280
+  804207:	6a 00                	push   $0x0
+  804209:	68 40 70 80 00       	push   $0x807040
+  80420e:	e8 6a c8 ff ff       	call   800a7d <memset>
+	threads_mu.m_state = 0;
+  804213:	c7 05 20 70 80 00 00 	movl   $0x0,0x807020
+  80421a:	00 00 00 
+	if (self != 0) {
+  80421d:	83 c4 10             	add    $0x10,%esp
+  804220:	85 db                	test   %ebx,%ebx
+  804222:	74 51                	je     804275 <pthread_fork_child+0x9b>
+  804224:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804226:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80422c:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804231:	77 18                	ja     80424b <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804233:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804238:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80423a:	c1 e8 10             	shr    $0x10,%eax
+  80423d:	74 0c                	je     80424b <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80423f:	c1 e0 10             	shl    $0x10,%eax
+  804242:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804247:	29 c2                	sub    %eax,%edx
+  804249:	eb 06                	jmp    804251 <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  80424b:	8b 15 c0 76 80 00    	mov    0x8076c0,%edx
+		threads[self].th_env = thisenv->env_id;
+  804251:	8b 02                	mov    (%edx),%eax
+  804253:	8b 48 48             	mov    0x48(%eax),%ecx
+  804256:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  80425d:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  804260:	89 0c 95 40 70 80 00 	mov    %ecx,0x807040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  804267:	8d 04 95 40 70 80 00 	lea    0x807040(,%edx,4),%eax
+  80426e:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  804275:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804278:	c9                   	leave
+  804279:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  80427a:	83 ec 04             	sub    $0x4,%esp
+  80427d:	68 80 02 00 00       	push   $0x280
+  804282:	6a 00                	push   $0x0
+  804284:	68 40 70 80 00       	push   $0x807040
+  804289:	e8 ef c7 ff ff       	call   800a7d <memset>
+	threads_mu.m_state = 0;
+  80428e:	c7 05 20 70 80 00 00 	movl   $0x0,0x807020
+  804295:	00 00 00 
+  804298:	83 c4 10             	add    $0x10,%esp
+  80429b:	eb d8                	jmp    804275 <pthread_fork_child+0x9b>
+
+0080429d <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80429d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042a2:	c3                   	ret
+
+008042a3 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8042a3:	55                   	push   %ebp
+  8042a4:	89 e5                	mov    %esp,%ebp
+  8042a6:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8042a9:	68 39 51 80 00       	push   $0x805139
+  8042ae:	ff 75 0c             	push   0xc(%ebp)
+  8042b1:	e8 76 c6 ff ff       	call   80092c <strcpy>
+	return 0;
+}
+  8042b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042bb:	c9                   	leave
+  8042bc:	c3                   	ret
+
+008042bd <devcons_write>:
+{
+  8042bd:	55                   	push   %ebp
+  8042be:	89 e5                	mov    %esp,%ebp
+  8042c0:	57                   	push   %edi
+  8042c1:	56                   	push   %esi
+  8042c2:	53                   	push   %ebx
+  8042c3:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8042c9:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8042ce:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8042d4:	eb 2e                	jmp    804304 <devcons_write+0x47>
+		m = n - tot;
+  8042d6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8042d9:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8042db:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8042e0:	39 c3                	cmp    %eax,%ebx
+  8042e2:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8042e5:	83 ec 04             	sub    $0x4,%esp
+  8042e8:	53                   	push   %ebx
+  8042e9:	89 f0                	mov    %esi,%eax
+  8042eb:	03 45 0c             	add    0xc(%ebp),%eax
+  8042ee:	50                   	push   %eax
+  8042ef:	57                   	push   %edi
+  8042f0:	e8 bd c7 ff ff       	call   800ab2 <memmove>
+		sys_cputs(buf, m);
+  8042f5:	83 c4 08             	add    $0x8,%esp
+  8042f8:	53                   	push   %ebx
+  8042f9:	57                   	push   %edi
+  8042fa:	e8 71 c9 ff ff       	call   800c70 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8042ff:	01 de                	add    %ebx,%esi
+  804301:	83 c4 10             	add    $0x10,%esp
+  804304:	3b 75 10             	cmp    0x10(%ebp),%esi
+  804307:	72 cd                	jb     8042d6 <devcons_write+0x19>
+}
+  804309:	89 f0                	mov    %esi,%eax
+  80430b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80430e:	5b                   	pop    %ebx
+  80430f:	5e                   	pop    %esi
+  804310:	5f                   	pop    %edi
+  804311:	5d                   	pop    %ebp
+  804312:	c3                   	ret
+
+00804313 <devcons_read>:
+{
+  804313:	55                   	push   %ebp
+  804314:	89 e5                	mov    %esp,%ebp
+  804316:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  804319:	b8 00 00 00 00       	mov    $0x0,%eax
+  80431e:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804322:	75 07                	jne    80432b <devcons_read+0x18>
+  804324:	eb 1f                	jmp    804345 <devcons_read+0x32>
+		sys_yield();
+  804326:	e8 13 ca ff ff       	call   800d3e <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80432b:	e8 6b c9 ff ff       	call   800c9b <sys_cgetc>
+  804330:	85 c0                	test   %eax,%eax
+  804332:	74 f2                	je     804326 <devcons_read+0x13>
+	if (c < 0)
+  804334:	78 0f                	js     804345 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  804336:	83 f8 04             	cmp    $0x4,%eax
+  804339:	74 0c                	je     804347 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80433b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80433e:	88 02                	mov    %al,(%edx)
+	return 1;
+  804340:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  804345:	c9                   	leave
+  804346:	c3                   	ret
+		return 0;
+  804347:	b8 00 00 00 00       	mov    $0x0,%eax
+  80434c:	eb f7                	jmp    804345 <devcons_read+0x32>
+
+0080434e <cputchar>:
+{
+  80434e:	55                   	push   %ebp
+  80434f:	89 e5                	mov    %esp,%ebp
+  804351:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  804354:	8b 45 08             	mov    0x8(%ebp),%eax
+  804357:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80435a:	6a 01                	push   $0x1
+  80435c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80435f:	50                   	push   %eax
+  804360:	e8 0b c9 ff ff       	call   800c70 <sys_cputs>
+}
+  804365:	83 c4 10             	add    $0x10,%esp
+  804368:	c9                   	leave
+  804369:	c3                   	ret
+
+0080436a <getchar>:
+{
+  80436a:	55                   	push   %ebp
+  80436b:	89 e5                	mov    %esp,%ebp
+  80436d:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  804370:	6a 01                	push   $0x1
+  804372:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804375:	50                   	push   %eax
+  804376:	6a 00                	push   $0x0
+  804378:	e8 12 d8 ff ff       	call   801b8f <read>
+	if (r < 0)
+  80437d:	83 c4 10             	add    $0x10,%esp
+  804380:	85 c0                	test   %eax,%eax
+  804382:	78 06                	js     80438a <getchar+0x20>
+	if (r < 1)
+  804384:	74 06                	je     80438c <getchar+0x22>
+	return c;
+  804386:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80438a:	c9                   	leave
+  80438b:	c3                   	ret
+		return -E_EOF;
+  80438c:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804391:	eb f7                	jmp    80438a <getchar+0x20>
+
+00804393 <iscons>:
+{
+  804393:	55                   	push   %ebp
+  804394:	89 e5                	mov    %esp,%ebp
+  804396:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804399:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80439c:	50                   	push   %eax
+  80439d:	ff 75 08             	push   0x8(%ebp)
+  8043a0:	e8 5a d5 ff ff       	call   8018ff <fd_lookup>
+  8043a5:	83 c4 10             	add    $0x10,%esp
+  8043a8:	85 c0                	test   %eax,%eax
+  8043aa:	78 11                	js     8043bd <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8043ac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8043af:	8b 15 98 62 80 00    	mov    0x806298,%edx
+  8043b5:	39 10                	cmp    %edx,(%eax)
+  8043b7:	0f 94 c0             	sete   %al
+  8043ba:	0f b6 c0             	movzbl %al,%eax
+}
+  8043bd:	c9                   	leave
+  8043be:	c3                   	ret
+
+008043bf <opencons>:
+{
+  8043bf:	55                   	push   %ebp
+  8043c0:	89 e5                	mov    %esp,%ebp
+  8043c2:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8043c5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8043c8:	50                   	push   %eax
+  8043c9:	e8 db d4 ff ff       	call   8018a9 <fd_alloc>
+  8043ce:	83 c4 10             	add    $0x10,%esp
+  8043d1:	85 c0                	test   %eax,%eax
+  8043d3:	78 3a                	js     80440f <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8043d5:	83 ec 04             	sub    $0x4,%esp
+  8043d8:	68 07 04 00 00       	push   $0x407
+  8043dd:	ff 75 f4             	push   -0xc(%ebp)
+  8043e0:	6a 00                	push   $0x0
+  8043e2:	e8 83 c9 ff ff       	call   800d6a <sys_page_alloc>
+  8043e7:	83 c4 10             	add    $0x10,%esp
+  8043ea:	85 c0                	test   %eax,%eax
+  8043ec:	78 21                	js     80440f <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8043ee:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8043f1:	8b 15 98 62 80 00    	mov    0x806298,%edx
+  8043f7:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8043f9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8043fc:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  804403:	83 ec 0c             	sub    $0xc,%esp
+  804406:	50                   	push   %eax
+  804407:	e8 76 d4 ff ff       	call   801882 <fd2num>
+  80440c:	83 c4 10             	add    $0x10,%esp
+}
+  80440f:	c9                   	leave
+  804410:	c3                   	ret
+
+00804411 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804411:	55                   	push   %ebp
+  804412:	89 e5                	mov    %esp,%ebp
+  804414:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  804417:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  80441e:	74 0a                	je     80442a <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804420:	8b 45 08             	mov    0x8(%ebp),%eax
+  804423:	a3 00 a0 80 00       	mov    %eax,0x80a000
+}
+  804428:	c9                   	leave
+  804429:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  80442a:	83 ec 04             	sub    $0x4,%esp
+  80442d:	6a 07                	push   $0x7
+  80442f:	68 00 f0 bf ee       	push   $0xeebff000
+  804434:	6a 00                	push   $0x0
+  804436:	e8 2f c9 ff ff       	call   800d6a <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  80443b:	83 c4 08             	add    $0x8,%esp
+  80443e:	68 4f 44 80 00       	push   $0x80444f
+  804443:	6a 00                	push   $0x0
+  804445:	e8 9d ca ff ff       	call   800ee7 <sys_env_set_pgfault_upcall>
+  80444a:	83 c4 10             	add    $0x10,%esp
+  80444d:	eb d1                	jmp    804420 <set_pgfault_handler+0xf>
+
+0080444f <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80444f:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804450:	a1 00 a0 80 00       	mov    0x80a000,%eax
+	call *%eax
+  804455:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804457:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  80445a:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  80445e:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  804462:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  804465:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  804469:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  80446b:	83 c4 08             	add    $0x8,%esp
+	popal
+  80446e:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  80446f:	83 c4 04             	add    $0x4,%esp
+	popfl
+  804472:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  804473:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  804474:	c3                   	ret
+
+00804475 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  804475:	55                   	push   %ebp
+  804476:	89 e5                	mov    %esp,%ebp
+  804478:	57                   	push   %edi
+  804479:	56                   	push   %esi
+  80447a:	53                   	push   %ebx
+  80447b:	83 ec 18             	sub    $0x18,%esp
+  80447e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804481:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804484:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  804487:	85 c0                	test   %eax,%eax
+  804489:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80448e:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  804491:	50                   	push   %eax
+  804492:	e8 c9 ca ff ff       	call   800f60 <sys_ipc_recv>
+	if (r < 0) {
+  804497:	83 c4 10             	add    $0x10,%esp
+  80449a:	85 c0                	test   %eax,%eax
+  80449c:	78 2b                	js     8044c9 <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  80449e:	85 ff                	test   %edi,%edi
+  8044a0:	74 55                	je     8044f7 <ipc_recv+0x82>
+  8044a2:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8044a4:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8044aa:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8044af:	77 39                	ja     8044ea <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8044b1:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8044b6:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8044b8:	c1 e8 10             	shr    $0x10,%eax
+  8044bb:	74 2d                	je     8044ea <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8044bd:	c1 e0 10             	shl    $0x10,%eax
+  8044c0:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8044c5:	29 c2                	sub    %eax,%edx
+  8044c7:	eb 27                	jmp    8044f0 <ipc_recv+0x7b>
+  8044c9:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  8044cb:	83 ec 08             	sub    $0x8,%esp
+  8044ce:	50                   	push   %eax
+  8044cf:	68 45 51 80 00       	push   $0x805145
+  8044d4:	e8 6f be ff ff       	call   800348 <cprintf>
+		*from_env_store = 0;
+  8044d9:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  8044df:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  8044e5:	83 c4 10             	add    $0x10,%esp
+  8044e8:	eb 77                	jmp    804561 <ipc_recv+0xec>
+		return pthread_main_tls;
+  8044ea:	8b 15 c0 76 80 00    	mov    0x8076c0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  8044f0:	8b 02                	mov    (%edx),%eax
+  8044f2:	8b 40 78             	mov    0x78(%eax),%eax
+  8044f5:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8044f7:	85 f6                	test   %esi,%esi
+  8044f9:	74 34                	je     80452f <ipc_recv+0xba>
+  8044fb:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8044fd:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804503:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804508:	77 18                	ja     804522 <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80450a:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80450f:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804511:	c1 e8 10             	shr    $0x10,%eax
+  804514:	74 0c                	je     804522 <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804516:	c1 e0 10             	shl    $0x10,%eax
+  804519:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80451e:	29 c2                	sub    %eax,%edx
+  804520:	eb 06                	jmp    804528 <ipc_recv+0xb3>
+		return pthread_main_tls;
+  804522:	8b 15 c0 76 80 00    	mov    0x8076c0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  804528:	8b 02                	mov    (%edx),%eax
+  80452a:	8b 40 7c             	mov    0x7c(%eax),%eax
+  80452d:	89 06                	mov    %eax,(%esi)
+  80452f:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804531:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804537:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80453c:	77 18                	ja     804556 <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80453e:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804543:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804545:	c1 e8 10             	shr    $0x10,%eax
+  804548:	74 0c                	je     804556 <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80454a:	c1 e0 10             	shl    $0x10,%eax
+  80454d:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804552:	29 c2                	sub    %eax,%edx
+  804554:	eb 06                	jmp    80455c <ipc_recv+0xe7>
+		return pthread_main_tls;
+  804556:	8b 15 c0 76 80 00    	mov    0x8076c0,%edx
+	}
+	return thisenv->env_ipc_value;
+  80455c:	8b 02                	mov    (%edx),%eax
+  80455e:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  804561:	89 d8                	mov    %ebx,%eax
+  804563:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804566:	5b                   	pop    %ebx
+  804567:	5e                   	pop    %esi
+  804568:	5f                   	pop    %edi
+  804569:	5d                   	pop    %ebp
+  80456a:	c3                   	ret
+
+0080456b <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  80456b:	55                   	push   %ebp
+  80456c:	89 e5                	mov    %esp,%ebp
+  80456e:	57                   	push   %edi
+  80456f:	56                   	push   %esi
+  804570:	53                   	push   %ebx
+  804571:	83 ec 0c             	sub    $0xc,%esp
+  804574:	8b 75 08             	mov    0x8(%ebp),%esi
+  804577:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80457a:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  80457d:	85 db                	test   %ebx,%ebx
+  80457f:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  804584:	0f 44 d8             	cmove  %eax,%ebx
+  804587:	eb 05                	jmp    80458e <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  804589:	e8 b0 c7 ff ff       	call   800d3e <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  80458e:	57                   	push   %edi
+  80458f:	53                   	push   %ebx
+  804590:	ff 75 0c             	push   0xc(%ebp)
+  804593:	56                   	push   %esi
+  804594:	e8 9a c9 ff ff       	call   800f33 <sys_ipc_try_send>
+		if (r == 0) {
+  804599:	83 c4 10             	add    $0x10,%esp
+  80459c:	85 c0                	test   %eax,%eax
+  80459e:	74 19                	je     8045b9 <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  8045a0:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8045a3:	74 e4                	je     804589 <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  8045a5:	83 ec 0c             	sub    $0xc,%esp
+  8045a8:	50                   	push   %eax
+  8045a9:	57                   	push   %edi
+  8045aa:	53                   	push   %ebx
+  8045ab:	56                   	push   %esi
+  8045ac:	68 60 51 80 00       	push   $0x805160
+  8045b1:	e8 92 bd ff ff       	call   800348 <cprintf>
+			return;
+  8045b6:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  8045b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8045bc:	5b                   	pop    %ebx
+  8045bd:	5e                   	pop    %esi
+  8045be:	5f                   	pop    %edi
+  8045bf:	5d                   	pop    %ebp
+  8045c0:	c3                   	ret
+
+008045c1 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8045c1:	55                   	push   %ebp
+  8045c2:	89 e5                	mov    %esp,%ebp
+  8045c4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8045c7:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  8045cc:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8045cf:	c1 e0 04             	shl    $0x4,%eax
+  8045d2:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8045d7:	8b 40 50             	mov    0x50(%eax),%eax
+  8045da:	39 c8                	cmp    %ecx,%eax
+  8045dc:	74 12                	je     8045f0 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8045de:	83 c2 01             	add    $0x1,%edx
+  8045e1:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8045e7:	75 e3                	jne    8045cc <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8045e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045ee:	eb 0e                	jmp    8045fe <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8045f0:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8045f3:	c1 e0 04             	shl    $0x4,%eax
+  8045f6:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8045fb:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8045fe:	5d                   	pop    %ebp
+  8045ff:	c3                   	ret
+
+00804600 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804600:	55                   	push   %ebp
+  804601:	89 e5                	mov    %esp,%ebp
+  804603:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804606:	89 c2                	mov    %eax,%edx
+  804608:	c1 ea 16             	shr    $0x16,%edx
+  80460b:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  804612:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804617:	f6 c1 01             	test   $0x1,%cl
+  80461a:	74 1c                	je     804638 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  80461c:	c1 e8 0c             	shr    $0xc,%eax
+  80461f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  804626:	a8 01                	test   $0x1,%al
+  804628:	74 0e                	je     804638 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80462a:	c1 e8 0c             	shr    $0xc,%eax
+  80462d:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  804634:	ef 
+  804635:	0f b7 d2             	movzwl %dx,%edx
+}
+  804638:	89 d0                	mov    %edx,%eax
+  80463a:	5d                   	pop    %ebp
+  80463b:	c3                   	ret
+
+0080463c <udm>:
+  80463c:	57                   	push   %edi
+  80463d:	56                   	push   %esi
+  80463e:	53                   	push   %ebx
+  80463f:	83 ec 20             	sub    $0x20,%esp
+  804642:	89 44 24 10          	mov    %eax,0x10(%esp)
+  804646:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80464a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80464e:	8b 54 24 34          	mov    0x34(%esp),%edx
+  804652:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804656:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80465a:	89 d1                	mov    %edx,%ecx
+  80465c:	09 c1                	or     %eax,%ecx
+  80465e:	0f 84 91 00 00 00    	je     8046f5 <udm+0xb9>
+  804664:	b8 00 00 00 00       	mov    $0x0,%eax
+  804669:	ba 00 00 00 00       	mov    $0x0,%edx
+  80466e:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804673:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80467a:	00 
+  80467b:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  804682:	00 
+  804683:	eb 08                	jmp    80468d <udm+0x51>
+  804685:	83 e9 01             	sub    $0x1,%ecx
+  804688:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80468b:	74 7c                	je     804709 <udm+0xcd>
+  80468d:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804691:	01 c0                	add    %eax,%eax
+  804693:	89 c6                	mov    %eax,%esi
+  804695:	89 d7                	mov    %edx,%edi
+  804697:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80469b:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80469f:	0f ad d0             	shrd   %cl,%edx,%eax
+  8046a2:	d3 ea                	shr    %cl,%edx
+  8046a4:	f6 c1 20             	test   $0x20,%cl
+  8046a7:	74 04                	je     8046ad <udm+0x71>
+  8046a9:	89 d0                	mov    %edx,%eax
+  8046ab:	31 d2                	xor    %edx,%edx
+  8046ad:	83 e0 01             	and    $0x1,%eax
+  8046b0:	89 04 24             	mov    %eax,(%esp)
+  8046b3:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8046ba:	00 
+  8046bb:	8b 04 24             	mov    (%esp),%eax
+  8046be:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8046c2:	09 f0                	or     %esi,%eax
+  8046c4:	09 fa                	or     %edi,%edx
+  8046c6:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8046ca:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8046ce:	39 f0                	cmp    %esi,%eax
+  8046d0:	89 d3                	mov    %edx,%ebx
+  8046d2:	19 fb                	sbb    %edi,%ebx
+  8046d4:	72 af                	jb     804685 <udm+0x49>
+  8046d6:	29 f0                	sub    %esi,%eax
+  8046d8:	19 fa                	sbb    %edi,%edx
+  8046da:	89 cf                	mov    %ecx,%edi
+  8046dc:	c1 ef 05             	shr    $0x5,%edi
+  8046df:	83 e7 01             	and    $0x1,%edi
+  8046e2:	89 fe                	mov    %edi,%esi
+  8046e4:	83 f6 01             	xor    $0x1,%esi
+  8046e7:	d3 e6                	shl    %cl,%esi
+  8046e9:	d3 e7                	shl    %cl,%edi
+  8046eb:	09 74 24 18          	or     %esi,0x18(%esp)
+  8046ef:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8046f3:	eb 90                	jmp    804685 <udm+0x49>
+  8046f5:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8046f9:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8046fd:	89 f0                	mov    %esi,%eax
+  8046ff:	89 fa                	mov    %edi,%edx
+  804701:	89 74 24 18          	mov    %esi,0x18(%esp)
+  804705:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  804709:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  80470d:	89 01                	mov    %eax,(%ecx)
+  80470f:	89 51 04             	mov    %edx,0x4(%ecx)
+  804712:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804716:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80471a:	83 c4 20             	add    $0x20,%esp
+  80471d:	5b                   	pop    %ebx
+  80471e:	5e                   	pop    %esi
+  80471f:	5f                   	pop    %edi
+  804720:	c3                   	ret
+
+00804721 <__udivdi3>:
+  804721:	83 ec 18             	sub    $0x18,%esp
+  804724:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804728:	50                   	push   %eax
+  804729:	ff 74 24 2c          	push   0x2c(%esp)
+  80472d:	ff 74 24 2c          	push   0x2c(%esp)
+  804731:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804735:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804739:	e8 fe fe ff ff       	call   80463c <udm>
+  80473e:	83 c4 24             	add    $0x24,%esp
+  804741:	c3                   	ret
+
+00804742 <__umoddi3>:
+  804742:	83 ec 18             	sub    $0x18,%esp
+  804745:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804749:	50                   	push   %eax
+  80474a:	ff 74 24 2c          	push   0x2c(%esp)
+  80474e:	ff 74 24 2c          	push   0x2c(%esp)
+  804752:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804756:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80475a:	e8 dd fe ff ff       	call   80463c <udm>
+  80475f:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804763:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804767:	83 c4 24             	add    $0x24,%esp
+  80476a:	c3                   	ret
+
+0080476b <__divdi3>:
+  80476b:	56                   	push   %esi
+  80476c:	53                   	push   %ebx
+  80476d:	83 ec 14             	sub    $0x14,%esp
+  804770:	8b 44 24 20          	mov    0x20(%esp),%eax
+  804774:	8b 54 24 24          	mov    0x24(%esp),%edx
+  804778:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  80477c:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  804780:	85 d2                	test   %edx,%edx
+  804782:	78 18                	js     80479c <__divdi3+0x31>
+  804784:	85 db                	test   %ebx,%ebx
+  804786:	78 3e                	js     8047c6 <__divdi3+0x5b>
+  804788:	83 ec 04             	sub    $0x4,%esp
+  80478b:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80478f:	56                   	push   %esi
+  804790:	53                   	push   %ebx
+  804791:	51                   	push   %ecx
+  804792:	e8 a5 fe ff ff       	call   80463c <udm>
+  804797:	83 c4 10             	add    $0x10,%esp
+  80479a:	eb 24                	jmp    8047c0 <__divdi3+0x55>
+  80479c:	f7 d8                	neg    %eax
+  80479e:	83 d2 00             	adc    $0x0,%edx
+  8047a1:	f7 da                	neg    %edx
+  8047a3:	85 db                	test   %ebx,%ebx
+  8047a5:	78 3a                	js     8047e1 <__divdi3+0x76>
+  8047a7:	83 ec 04             	sub    $0x4,%esp
+  8047aa:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8047ae:	56                   	push   %esi
+  8047af:	53                   	push   %ebx
+  8047b0:	51                   	push   %ecx
+  8047b1:	e8 86 fe ff ff       	call   80463c <udm>
+  8047b6:	83 c4 10             	add    $0x10,%esp
+  8047b9:	f7 d8                	neg    %eax
+  8047bb:	83 d2 00             	adc    $0x0,%edx
+  8047be:	f7 da                	neg    %edx
+  8047c0:	83 c4 14             	add    $0x14,%esp
+  8047c3:	5b                   	pop    %ebx
+  8047c4:	5e                   	pop    %esi
+  8047c5:	c3                   	ret
+  8047c6:	83 ec 04             	sub    $0x4,%esp
+  8047c9:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8047cd:	56                   	push   %esi
+  8047ce:	f7 d9                	neg    %ecx
+  8047d0:	83 d3 00             	adc    $0x0,%ebx
+  8047d3:	f7 db                	neg    %ebx
+  8047d5:	53                   	push   %ebx
+  8047d6:	51                   	push   %ecx
+  8047d7:	e8 60 fe ff ff       	call   80463c <udm>
+  8047dc:	83 c4 10             	add    $0x10,%esp
+  8047df:	eb d8                	jmp    8047b9 <__divdi3+0x4e>
+  8047e1:	83 ec 04             	sub    $0x4,%esp
+  8047e4:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8047e8:	56                   	push   %esi
+  8047e9:	f7 d9                	neg    %ecx
+  8047eb:	83 d3 00             	adc    $0x0,%ebx
+  8047ee:	f7 db                	neg    %ebx
+  8047f0:	53                   	push   %ebx
+  8047f1:	51                   	push   %ecx
+  8047f2:	e8 45 fe ff ff       	call   80463c <udm>
+  8047f7:	83 c4 10             	add    $0x10,%esp
+  8047fa:	eb c4                	jmp    8047c0 <__divdi3+0x55>
+
+008047fc <__moddi3>:
+  8047fc:	55                   	push   %ebp
+  8047fd:	57                   	push   %edi
+  8047fe:	56                   	push   %esi
+  8047ff:	53                   	push   %ebx
+  804800:	83 ec 24             	sub    $0x24,%esp
+  804803:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804807:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80480b:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  80480f:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  804813:	85 d2                	test   %edx,%edx
+  804815:	78 3b                	js     804852 <__moddi3+0x56>
+  804817:	83 ec 04             	sub    $0x4,%esp
+  80481a:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80481e:	56                   	push   %esi
+  80481f:	89 ce                	mov    %ecx,%esi
+  804821:	f7 de                	neg    %esi
+  804823:	89 74 24 08          	mov    %esi,0x8(%esp)
+  804827:	89 de                	mov    %ebx,%esi
+  804829:	83 d6 00             	adc    $0x0,%esi
+  80482c:	f7 de                	neg    %esi
+  80482e:	89 74 24 14          	mov    %esi,0x14(%esp)
+  804832:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804836:	0f 48 f1             	cmovs  %ecx,%esi
+  804839:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  80483e:	53                   	push   %ebx
+  80483f:	56                   	push   %esi
+  804840:	e8 f7 fd ff ff       	call   80463c <udm>
+  804845:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804849:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80484d:	83 c4 10             	add    $0x10,%esp
+  804850:	eb 47                	jmp    804899 <__moddi3+0x9d>
+  804852:	f7 d8                	neg    %eax
+  804854:	83 d2 00             	adc    $0x0,%edx
+  804857:	f7 da                	neg    %edx
+  804859:	83 ec 04             	sub    $0x4,%esp
+  80485c:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804860:	56                   	push   %esi
+  804861:	89 cf                	mov    %ecx,%edi
+  804863:	f7 df                	neg    %edi
+  804865:	89 de                	mov    %ebx,%esi
+  804867:	83 d6 00             	adc    $0x0,%esi
+  80486a:	f7 de                	neg    %esi
+  80486c:	0f 49 cf             	cmovns %edi,%ecx
+  80486f:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  804873:	0f 49 de             	cmovns %esi,%ebx
+  804876:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  80487a:	ff 74 24 0c          	push   0xc(%esp)
+  80487e:	ff 74 24 0c          	push   0xc(%esp)
+  804882:	e8 b5 fd ff ff       	call   80463c <udm>
+  804887:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80488b:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80488f:	f7 d8                	neg    %eax
+  804891:	83 d2 00             	adc    $0x0,%edx
+  804894:	f7 da                	neg    %edx
+  804896:	83 c4 10             	add    $0x10,%esp
+  804899:	83 c4 24             	add    $0x24,%esp
+  80489c:	5b                   	pop    %ebx
+  80489d:	5e                   	pop    %esi
+  80489e:	5f                   	pop    %edi
+  80489f:	5d                   	pop    %ebp
+  8048a0:	c3                   	ret
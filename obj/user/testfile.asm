@@ -0,0 +1,10245 @@
+
+obj/user/testfile.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 4e 06 00 00       	call   80067f <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <xopen>:
+
+#define FVA ((struct Fd*)0xCCCCC000)
+
+static int
+xopen(const char *path, int mode)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 0c             	sub    $0xc,%esp
+  80003a:	89 d3                	mov    %edx,%ebx
+	extern union Fsipc fsipcbuf;
+	envid_t fsenv;
+	
+	strcpy(fsipcbuf.open.req_path, path);
+  80003c:	50                   	push   %eax
+  80003d:	68 00 80 80 00       	push   $0x808000
+  800042:	e8 9a 0d 00 00       	call   800de1 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  800047:	89 1d 00 84 80 00    	mov    %ebx,0x808400
+
+	fsenv = ipc_find_env(ENV_TYPE_FS);
+  80004d:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  800054:	e8 b4 17 00 00       	call   80180d <ipc_find_env>
+	ipc_send(fsenv, FSREQ_OPEN, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800059:	6a 07                	push   $0x7
+  80005b:	68 00 80 80 00       	push   $0x808000
+  800060:	6a 01                	push   $0x1
+  800062:	50                   	push   %eax
+  800063:	e8 4f 17 00 00       	call   8017b7 <ipc_send>
+	return ipc_recv(NULL, FVA, NULL);
+  800068:	83 c4 1c             	add    $0x1c,%esp
+  80006b:	6a 00                	push   $0x0
+  80006d:	68 00 c0 cc cc       	push   $0xccccc000
+  800072:	6a 00                	push   $0x0
+  800074:	e8 48 16 00 00       	call   8016c1 <ipc_recv>
+}
+  800079:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80007c:	c9                   	leave
+  80007d:	c3                   	ret
+
+0080007e <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  80007e:	55                   	push   %ebp
+  80007f:	89 e5                	mov    %esp,%ebp
+  800081:	57                   	push   %edi
+  800082:	56                   	push   %esi
+  800083:	53                   	push   %ebx
+  800084:	81 ec ac 02 00 00    	sub    $0x2ac,%esp
+	struct Fd fdcopy;
+	struct Stat st;
+	char buf[512];
+
+	// We open files manually first, to avoid the FD layer
+	if ((r = xopen("/not-found", O_RDONLY)) < 0 && r != -E_NOT_FOUND)
+  80008a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80008f:	b8 20 4d 80 00       	mov    $0x804d20,%eax
+  800094:	e8 9a ff ff ff       	call   800033 <xopen>
+  800099:	85 c0                	test   %eax,%eax
+  80009b:	0f 89 fa 03 00 00    	jns    80049b <umain+0x41d>
+  8000a1:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8000a4:	0f 85 df 03 00 00    	jne    800489 <umain+0x40b>
+		panic("serve_open /not-found: %e", r);
+	else if (r >= 0)
+		panic("serve_open /not-found succeeded!");
+
+	if ((r = xopen("/newmotd", O_RDONLY)) < 0)
+  8000aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000af:	b8 55 4d 80 00       	mov    $0x804d55,%eax
+  8000b4:	e8 7a ff ff ff       	call   800033 <xopen>
+  8000b9:	85 c0                	test   %eax,%eax
+  8000bb:	0f 88 ee 03 00 00    	js     8004af <umain+0x431>
+		panic("serve_open /newmotd: %e", r);
+	if (FVA->fd_dev_id != 'f' || FVA->fd_offset != 0 || FVA->fd_omode != O_RDONLY)
+  8000c1:	83 3d 00 c0 cc cc 66 	cmpl   $0x66,0xccccc000
+  8000c8:	0f 85 f3 03 00 00    	jne    8004c1 <umain+0x443>
+  8000ce:	83 3d 04 c0 cc cc 00 	cmpl   $0x0,0xccccc004
+  8000d5:	0f 85 e6 03 00 00    	jne    8004c1 <umain+0x443>
+  8000db:	83 3d 08 c0 cc cc 00 	cmpl   $0x0,0xccccc008
+  8000e2:	0f 85 d9 03 00 00    	jne    8004c1 <umain+0x443>
+		panic("serve_open did not fill struct Fd correctly\n");
+	cprintf("serve_open is good\n");
+  8000e8:	83 ec 0c             	sub    $0xc,%esp
+  8000eb:	68 76 4d 80 00       	push   $0x804d76
+  8000f0:	e8 08 07 00 00       	call   8007fd <cprintf>
+
+	if ((r = devfile.dev_stat(FVA, &st)) < 0)
+  8000f5:	83 c4 08             	add    $0x8,%esp
+  8000f8:	8d 85 4c ff ff ff    	lea    -0xb4(%ebp),%eax
+  8000fe:	50                   	push   %eax
+  8000ff:	68 00 c0 cc cc       	push   $0xccccc000
+  800104:	ff 15 1c 60 80 00    	call   *0x80601c
+  80010a:	83 c4 10             	add    $0x10,%esp
+  80010d:	85 c0                	test   %eax,%eax
+  80010f:	0f 88 c0 03 00 00    	js     8004d5 <umain+0x457>
+		panic("file_stat: %e", r);
+	if (strlen(msg) != st.st_size)
+  800115:	83 ec 0c             	sub    $0xc,%esp
+  800118:	ff 35 00 60 80 00    	push   0x806000
+  80011e:	e8 83 0c 00 00       	call   800da6 <strlen>
+  800123:	83 c4 10             	add    $0x10,%esp
+  800126:	3b 45 cc             	cmp    -0x34(%ebp),%eax
+  800129:	0f 85 b8 03 00 00    	jne    8004e7 <umain+0x469>
+		panic("file_stat returned size %d wanted %d\n", st.st_size, strlen(msg));
+	cprintf("file_stat is good\n");
+  80012f:	83 ec 0c             	sub    $0xc,%esp
+  800132:	68 98 4d 80 00       	push   $0x804d98
+  800137:	e8 c1 06 00 00       	call   8007fd <cprintf>
+
+	memset(buf, 0, sizeof buf);
+  80013c:	83 c4 0c             	add    $0xc,%esp
+  80013f:	68 00 02 00 00       	push   $0x200
+  800144:	6a 00                	push   $0x0
+  800146:	8d 9d 4c fd ff ff    	lea    -0x2b4(%ebp),%ebx
+  80014c:	53                   	push   %ebx
+  80014d:	e8 e0 0d 00 00       	call   800f32 <memset>
+	if ((r = devfile.dev_read(FVA, buf, sizeof buf)) < 0)
+  800152:	83 c4 0c             	add    $0xc,%esp
+  800155:	68 00 02 00 00       	push   $0x200
+  80015a:	53                   	push   %ebx
+  80015b:	68 00 c0 cc cc       	push   $0xccccc000
+  800160:	ff 15 10 60 80 00    	call   *0x806010
+  800166:	83 c4 10             	add    $0x10,%esp
+  800169:	85 c0                	test   %eax,%eax
+  80016b:	0f 88 9b 03 00 00    	js     80050c <umain+0x48e>
+		panic("file_read: %e", r);
+	if (strcmp(buf, msg) != 0)
+  800171:	83 ec 08             	sub    $0x8,%esp
+  800174:	ff 35 00 60 80 00    	push   0x806000
+  80017a:	8d 85 4c fd ff ff    	lea    -0x2b4(%ebp),%eax
+  800180:	50                   	push   %eax
+  800181:	e8 0c 0d 00 00       	call   800e92 <strcmp>
+  800186:	83 c4 10             	add    $0x10,%esp
+  800189:	85 c0                	test   %eax,%eax
+  80018b:	0f 85 8d 03 00 00    	jne    80051e <umain+0x4a0>
+		panic("file_read returned wrong data");
+	cprintf("file_read is good\n");
+  800191:	83 ec 0c             	sub    $0xc,%esp
+  800194:	68 d7 4d 80 00       	push   $0x804dd7
+  800199:	e8 5f 06 00 00       	call   8007fd <cprintf>
+
+	if ((r = devfile.dev_close(FVA)) < 0)
+  80019e:	c7 04 24 00 c0 cc cc 	movl   $0xccccc000,(%esp)
+  8001a5:	ff 15 18 60 80 00    	call   *0x806018
+  8001ab:	83 c4 10             	add    $0x10,%esp
+  8001ae:	85 c0                	test   %eax,%eax
+  8001b0:	0f 88 7c 03 00 00    	js     800532 <umain+0x4b4>
+		panic("file_close: %e", r);
+	cprintf("file_close is good\n");
+  8001b6:	83 ec 0c             	sub    $0xc,%esp
+  8001b9:	68 f9 4d 80 00       	push   $0x804df9
+  8001be:	e8 3a 06 00 00       	call   8007fd <cprintf>
+
+	// We're about to unmap the FD, but still need a way to get
+	// the stale filenum to serve_read, so we make a local copy.
+	// The file server won't think it's stale until we unmap the
+	// FD page.
+	fdcopy = *FVA;
+  8001c3:	a1 00 c0 cc cc       	mov    0xccccc000,%eax
+  8001c8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001cb:	a1 04 c0 cc cc       	mov    0xccccc004,%eax
+  8001d0:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8001d3:	a1 08 c0 cc cc       	mov    0xccccc008,%eax
+  8001d8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001db:	a1 0c c0 cc cc       	mov    0xccccc00c,%eax
+  8001e0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	sys_page_unmap(0, FVA);
+  8001e3:	83 c4 08             	add    $0x8,%esp
+  8001e6:	68 00 c0 cc cc       	push   $0xccccc000
+  8001eb:	6a 00                	push   $0x0
+  8001ed:	e8 c6 10 00 00       	call   8012b8 <sys_page_unmap>
+
+	if ((r = devfile.dev_read(&fdcopy, buf, sizeof buf)) != -E_INVAL)
+  8001f2:	83 c4 0c             	add    $0xc,%esp
+  8001f5:	68 00 02 00 00       	push   $0x200
+  8001fa:	8d 85 4c fd ff ff    	lea    -0x2b4(%ebp),%eax
+  800200:	50                   	push   %eax
+  800201:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  800204:	50                   	push   %eax
+  800205:	ff 15 10 60 80 00    	call   *0x806010
+  80020b:	83 c4 10             	add    $0x10,%esp
+  80020e:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  800211:	0f 85 2d 03 00 00    	jne    800544 <umain+0x4c6>
+		panic("serve_read does not handle stale fileids correctly: %e", r);
+	cprintf("stale fileid is good\n");
+  800217:	83 ec 0c             	sub    $0xc,%esp
+  80021a:	68 0d 4e 80 00       	push   $0x804e0d
+  80021f:	e8 d9 05 00 00       	call   8007fd <cprintf>
+
+	// Try writing
+	if ((r = xopen("/new-file", O_RDWR|O_CREAT)) < 0)
+  800224:	ba 02 01 00 00       	mov    $0x102,%edx
+  800229:	b8 23 4e 80 00       	mov    $0x804e23,%eax
+  80022e:	e8 00 fe ff ff       	call   800033 <xopen>
+  800233:	83 c4 10             	add    $0x10,%esp
+  800236:	85 c0                	test   %eax,%eax
+  800238:	0f 88 18 03 00 00    	js     800556 <umain+0x4d8>
+		panic("serve_open /new-file: %e", r);
+
+	if ((r = devfile.dev_write(FVA, msg, strlen(msg))) != strlen(msg))
+  80023e:	8b 1d 14 60 80 00    	mov    0x806014,%ebx
+  800244:	83 ec 0c             	sub    $0xc,%esp
+  800247:	ff 35 00 60 80 00    	push   0x806000
+  80024d:	e8 54 0b 00 00       	call   800da6 <strlen>
+  800252:	83 c4 0c             	add    $0xc,%esp
+  800255:	50                   	push   %eax
+  800256:	ff 35 00 60 80 00    	push   0x806000
+  80025c:	68 00 c0 cc cc       	push   $0xccccc000
+  800261:	ff d3                	call   *%ebx
+  800263:	89 c3                	mov    %eax,%ebx
+  800265:	83 c4 04             	add    $0x4,%esp
+  800268:	ff 35 00 60 80 00    	push   0x806000
+  80026e:	e8 33 0b 00 00       	call   800da6 <strlen>
+  800273:	83 c4 10             	add    $0x10,%esp
+  800276:	39 d8                	cmp    %ebx,%eax
+  800278:	0f 85 ea 02 00 00    	jne    800568 <umain+0x4ea>
+		panic("file_write: %e", r);
+	cprintf("file_write is good\n");
+  80027e:	83 ec 0c             	sub    $0xc,%esp
+  800281:	68 55 4e 80 00       	push   $0x804e55
+  800286:	e8 72 05 00 00       	call   8007fd <cprintf>
+
+	FVA->fd_offset = 0;
+  80028b:	c7 05 04 c0 cc cc 00 	movl   $0x0,0xccccc004
+  800292:	00 00 00 
+	memset(buf, 0, sizeof buf);
+  800295:	83 c4 0c             	add    $0xc,%esp
+  800298:	68 00 02 00 00       	push   $0x200
+  80029d:	6a 00                	push   $0x0
+  80029f:	8d 9d 4c fd ff ff    	lea    -0x2b4(%ebp),%ebx
+  8002a5:	53                   	push   %ebx
+  8002a6:	e8 87 0c 00 00       	call   800f32 <memset>
+	if ((r = devfile.dev_read(FVA, buf, sizeof buf)) < 0)
+  8002ab:	83 c4 0c             	add    $0xc,%esp
+  8002ae:	68 00 02 00 00       	push   $0x200
+  8002b3:	53                   	push   %ebx
+  8002b4:	68 00 c0 cc cc       	push   $0xccccc000
+  8002b9:	ff 15 10 60 80 00    	call   *0x806010
+  8002bf:	89 c3                	mov    %eax,%ebx
+  8002c1:	83 c4 10             	add    $0x10,%esp
+  8002c4:	85 c0                	test   %eax,%eax
+  8002c6:	0f 88 ae 02 00 00    	js     80057a <umain+0x4fc>
+		panic("file_read after file_write: %e", r);
+	if (r != strlen(msg))
+  8002cc:	83 ec 0c             	sub    $0xc,%esp
+  8002cf:	ff 35 00 60 80 00    	push   0x806000
+  8002d5:	e8 cc 0a 00 00       	call   800da6 <strlen>
+  8002da:	83 c4 10             	add    $0x10,%esp
+  8002dd:	39 d8                	cmp    %ebx,%eax
+  8002df:	0f 85 a7 02 00 00    	jne    80058c <umain+0x50e>
+		panic("file_read after file_write returned wrong length: %d", r);
+	if (strcmp(buf, msg) != 0)
+  8002e5:	83 ec 08             	sub    $0x8,%esp
+  8002e8:	ff 35 00 60 80 00    	push   0x806000
+  8002ee:	8d 85 4c fd ff ff    	lea    -0x2b4(%ebp),%eax
+  8002f4:	50                   	push   %eax
+  8002f5:	e8 98 0b 00 00       	call   800e92 <strcmp>
+  8002fa:	83 c4 10             	add    $0x10,%esp
+  8002fd:	85 c0                	test   %eax,%eax
+  8002ff:	0f 85 99 02 00 00    	jne    80059e <umain+0x520>
+		panic("file_read after file_write returned wrong data");
+	cprintf("file_read after file_write is good\n");
+  800305:	83 ec 0c             	sub    $0xc,%esp
+  800308:	68 1c 50 80 00       	push   $0x80501c
+  80030d:	e8 eb 04 00 00       	call   8007fd <cprintf>
+
+	// Now we'll try out open
+	if ((r = open("/not-found", O_RDONLY)) < 0 && r != -E_NOT_FOUND)
+  800312:	83 c4 08             	add    $0x8,%esp
+  800315:	6a 00                	push   $0x0
+  800317:	68 20 4d 80 00       	push   $0x804d20
+  80031c:	e8 80 1e 00 00       	call   8021a1 <open>
+  800321:	83 c4 10             	add    $0x10,%esp
+  800324:	85 c0                	test   %eax,%eax
+  800326:	0f 89 98 02 00 00    	jns    8005c4 <umain+0x546>
+  80032c:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80032f:	0f 85 7d 02 00 00    	jne    8005b2 <umain+0x534>
+		panic("open /not-found: %e", r);
+	else if (r >= 0)
+		panic("open /not-found succeeded!");
+
+	if ((r = open("/newmotd", O_RDONLY)) < 0)
+  800335:	83 ec 08             	sub    $0x8,%esp
+  800338:	6a 00                	push   $0x0
+  80033a:	68 55 4d 80 00       	push   $0x804d55
+  80033f:	e8 5d 1e 00 00       	call   8021a1 <open>
+  800344:	83 c4 10             	add    $0x10,%esp
+  800347:	85 c0                	test   %eax,%eax
+  800349:	0f 88 89 02 00 00    	js     8005d8 <umain+0x55a>
+		panic("open /newmotd: %e", r);
+	fd = (struct Fd*) (0xD0000000 + r*PGSIZE);
+  80034f:	c1 e0 0c             	shl    $0xc,%eax
+	if (fd->fd_dev_id != 'f' || fd->fd_offset != 0 || fd->fd_omode != O_RDONLY)
+  800352:	83 b8 00 00 00 d0 66 	cmpl   $0x66,-0x30000000(%eax)
+  800359:	0f 85 8b 02 00 00    	jne    8005ea <umain+0x56c>
+  80035f:	83 b8 04 00 00 d0 00 	cmpl   $0x0,-0x2ffffffc(%eax)
+  800366:	0f 85 7e 02 00 00    	jne    8005ea <umain+0x56c>
+  80036c:	8b 98 08 00 00 d0    	mov    -0x2ffffff8(%eax),%ebx
+  800372:	85 db                	test   %ebx,%ebx
+  800374:	0f 85 70 02 00 00    	jne    8005ea <umain+0x56c>
+		panic("open did not fill struct Fd correctly\n");
+	cprintf("open is good\n");
+  80037a:	83 ec 0c             	sub    $0xc,%esp
+  80037d:	68 7c 4d 80 00       	push   $0x804d7c
+  800382:	e8 76 04 00 00       	call   8007fd <cprintf>
+
+	// Try files with indirect blocks
+	if ((f = open("/big", O_WRONLY|O_CREAT)) < 0)
+  800387:	83 c4 08             	add    $0x8,%esp
+  80038a:	68 01 01 00 00       	push   $0x101
+  80038f:	68 84 4e 80 00       	push   $0x804e84
+  800394:	e8 08 1e 00 00       	call   8021a1 <open>
+  800399:	89 c7                	mov    %eax,%edi
+  80039b:	83 c4 10             	add    $0x10,%esp
+  80039e:	85 c0                	test   %eax,%eax
+  8003a0:	0f 88 58 02 00 00    	js     8005fe <umain+0x580>
+		panic("creat /big: %e", f);
+	memset(buf, 0, sizeof(buf));
+  8003a6:	83 ec 04             	sub    $0x4,%esp
+  8003a9:	68 00 02 00 00       	push   $0x200
+  8003ae:	6a 00                	push   $0x0
+  8003b0:	8d 85 4c fd ff ff    	lea    -0x2b4(%ebp),%eax
+  8003b6:	50                   	push   %eax
+  8003b7:	e8 76 0b 00 00       	call   800f32 <memset>
+  8003bc:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < (NDIRECT*3)*BLKSIZE; i += sizeof(buf)) {
+  8003bf:	89 de                	mov    %ebx,%esi
+		*(int*)buf = i;
+  8003c1:	89 b5 4c fd ff ff    	mov    %esi,-0x2b4(%ebp)
+		if ((r = write(f, buf, sizeof(buf))) < 0)
+  8003c7:	83 ec 04             	sub    $0x4,%esp
+  8003ca:	68 00 02 00 00       	push   $0x200
+  8003cf:	8d 85 4c fd ff ff    	lea    -0x2b4(%ebp),%eax
+  8003d5:	50                   	push   %eax
+  8003d6:	57                   	push   %edi
+  8003d7:	e8 75 18 00 00       	call   801c51 <write>
+  8003dc:	83 c4 10             	add    $0x10,%esp
+  8003df:	85 c0                	test   %eax,%eax
+  8003e1:	0f 88 29 02 00 00    	js     800610 <umain+0x592>
+	for (i = 0; i < (NDIRECT*3)*BLKSIZE; i += sizeof(buf)) {
+  8003e7:	8d 86 00 02 00 00    	lea    0x200(%esi),%eax
+  8003ed:	89 c6                	mov    %eax,%esi
+  8003ef:	3d 00 e0 01 00       	cmp    $0x1e000,%eax
+  8003f4:	75 cb                	jne    8003c1 <umain+0x343>
+			panic("write /big@%d: %e", i, r);
+	}
+	close(f);
+  8003f6:	83 ec 0c             	sub    $0xc,%esp
+  8003f9:	57                   	push   %edi
+  8003fa:	e8 1e 16 00 00       	call   801a1d <close>
+
+	if ((f = open("/big", O_RDONLY)) < 0)
+  8003ff:	83 c4 08             	add    $0x8,%esp
+  800402:	6a 00                	push   $0x0
+  800404:	68 84 4e 80 00       	push   $0x804e84
+  800409:	e8 93 1d 00 00       	call   8021a1 <open>
+  80040e:	89 c6                	mov    %eax,%esi
+  800410:	83 c4 10             	add    $0x10,%esp
+  800413:	85 c0                	test   %eax,%eax
+  800415:	0f 88 0b 02 00 00    	js     800626 <umain+0x5a8>
+		panic("open /big: %e", f);
+	for (i = 0; i < (NDIRECT*3)*BLKSIZE; i += sizeof(buf)) {
+		*(int*)buf = i;
+		if ((r = readn(f, buf, sizeof(buf))) < 0)
+  80041b:	8d bd 4c fd ff ff    	lea    -0x2b4(%ebp),%edi
+		*(int*)buf = i;
+  800421:	89 9d 4c fd ff ff    	mov    %ebx,-0x2b4(%ebp)
+		if ((r = readn(f, buf, sizeof(buf))) < 0)
+  800427:	83 ec 04             	sub    $0x4,%esp
+  80042a:	68 00 02 00 00       	push   $0x200
+  80042f:	57                   	push   %edi
+  800430:	56                   	push   %esi
+  800431:	e8 d4 17 00 00       	call   801c0a <readn>
+  800436:	83 c4 10             	add    $0x10,%esp
+  800439:	85 c0                	test   %eax,%eax
+  80043b:	0f 88 f7 01 00 00    	js     800638 <umain+0x5ba>
+			panic("read /big@%d: %e", i, r);
+		if (r != sizeof(buf))
+  800441:	3d 00 02 00 00       	cmp    $0x200,%eax
+  800446:	0f 85 02 02 00 00    	jne    80064e <umain+0x5d0>
+			panic("read /big from %d returned %d < %d bytes",
+			      i, r, sizeof(buf));
+		if (*(int*)buf != i)
+  80044c:	8b 85 4c fd ff ff    	mov    -0x2b4(%ebp),%eax
+  800452:	39 d8                	cmp    %ebx,%eax
+  800454:	0f 85 0f 02 00 00    	jne    800669 <umain+0x5eb>
+	for (i = 0; i < (NDIRECT*3)*BLKSIZE; i += sizeof(buf)) {
+  80045a:	8d 83 00 02 00 00    	lea    0x200(%ebx),%eax
+  800460:	89 c3                	mov    %eax,%ebx
+  800462:	3d 00 e0 01 00       	cmp    $0x1e000,%eax
+  800467:	75 b8                	jne    800421 <umain+0x3a3>
+			panic("read /big from %d returned bad data %d",
+			      i, *(int*)buf);
+	}
+	close(f);
+  800469:	83 ec 0c             	sub    $0xc,%esp
+  80046c:	56                   	push   %esi
+  80046d:	e8 ab 15 00 00       	call   801a1d <close>
+	cprintf("large file is good\n");
+  800472:	c7 04 24 c9 4e 80 00 	movl   $0x804ec9,(%esp)
+  800479:	e8 7f 03 00 00       	call   8007fd <cprintf>
+}
+  80047e:	83 c4 10             	add    $0x10,%esp
+  800481:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800484:	5b                   	pop    %ebx
+  800485:	5e                   	pop    %esi
+  800486:	5f                   	pop    %edi
+  800487:	5d                   	pop    %ebp
+  800488:	c3                   	ret
+		panic("serve_open /not-found: %e", r);
+  800489:	50                   	push   %eax
+  80048a:	68 2b 4d 80 00       	push   $0x804d2b
+  80048f:	6a 20                	push   $0x20
+  800491:	68 45 4d 80 00       	push   $0x804d45
+  800496:	e8 87 02 00 00       	call   800722 <_panic>
+		panic("serve_open /not-found succeeded!");
+  80049b:	83 ec 04             	sub    $0x4,%esp
+  80049e:	68 e0 4e 80 00       	push   $0x804ee0
+  8004a3:	6a 22                	push   $0x22
+  8004a5:	68 45 4d 80 00       	push   $0x804d45
+  8004aa:	e8 73 02 00 00       	call   800722 <_panic>
+		panic("serve_open /newmotd: %e", r);
+  8004af:	50                   	push   %eax
+  8004b0:	68 5e 4d 80 00       	push   $0x804d5e
+  8004b5:	6a 25                	push   $0x25
+  8004b7:	68 45 4d 80 00       	push   $0x804d45
+  8004bc:	e8 61 02 00 00       	call   800722 <_panic>
+		panic("serve_open did not fill struct Fd correctly\n");
+  8004c1:	83 ec 04             	sub    $0x4,%esp
+  8004c4:	68 04 4f 80 00       	push   $0x804f04
+  8004c9:	6a 27                	push   $0x27
+  8004cb:	68 45 4d 80 00       	push   $0x804d45
+  8004d0:	e8 4d 02 00 00       	call   800722 <_panic>
+		panic("file_stat: %e", r);
+  8004d5:	50                   	push   %eax
+  8004d6:	68 8a 4d 80 00       	push   $0x804d8a
+  8004db:	6a 2b                	push   $0x2b
+  8004dd:	68 45 4d 80 00       	push   $0x804d45
+  8004e2:	e8 3b 02 00 00       	call   800722 <_panic>
+		panic("file_stat returned size %d wanted %d\n", st.st_size, strlen(msg));
+  8004e7:	83 ec 0c             	sub    $0xc,%esp
+  8004ea:	ff 35 00 60 80 00    	push   0x806000
+  8004f0:	e8 b1 08 00 00       	call   800da6 <strlen>
+  8004f5:	89 04 24             	mov    %eax,(%esp)
+  8004f8:	ff 75 cc             	push   -0x34(%ebp)
+  8004fb:	68 34 4f 80 00       	push   $0x804f34
+  800500:	6a 2d                	push   $0x2d
+  800502:	68 45 4d 80 00       	push   $0x804d45
+  800507:	e8 16 02 00 00       	call   800722 <_panic>
+		panic("file_read: %e", r);
+  80050c:	50                   	push   %eax
+  80050d:	68 ab 4d 80 00       	push   $0x804dab
+  800512:	6a 32                	push   $0x32
+  800514:	68 45 4d 80 00       	push   $0x804d45
+  800519:	e8 04 02 00 00       	call   800722 <_panic>
+		panic("file_read returned wrong data");
+  80051e:	83 ec 04             	sub    $0x4,%esp
+  800521:	68 b9 4d 80 00       	push   $0x804db9
+  800526:	6a 34                	push   $0x34
+  800528:	68 45 4d 80 00       	push   $0x804d45
+  80052d:	e8 f0 01 00 00       	call   800722 <_panic>
+		panic("file_close: %e", r);
+  800532:	50                   	push   %eax
+  800533:	68 ea 4d 80 00       	push   $0x804dea
+  800538:	6a 38                	push   $0x38
+  80053a:	68 45 4d 80 00       	push   $0x804d45
+  80053f:	e8 de 01 00 00       	call   800722 <_panic>
+		panic("serve_read does not handle stale fileids correctly: %e", r);
+  800544:	50                   	push   %eax
+  800545:	68 5c 4f 80 00       	push   $0x804f5c
+  80054a:	6a 43                	push   $0x43
+  80054c:	68 45 4d 80 00       	push   $0x804d45
+  800551:	e8 cc 01 00 00       	call   800722 <_panic>
+		panic("serve_open /new-file: %e", r);
+  800556:	50                   	push   %eax
+  800557:	68 2d 4e 80 00       	push   $0x804e2d
+  80055c:	6a 48                	push   $0x48
+  80055e:	68 45 4d 80 00       	push   $0x804d45
+  800563:	e8 ba 01 00 00       	call   800722 <_panic>
+		panic("file_write: %e", r);
+  800568:	53                   	push   %ebx
+  800569:	68 46 4e 80 00       	push   $0x804e46
+  80056e:	6a 4b                	push   $0x4b
+  800570:	68 45 4d 80 00       	push   $0x804d45
+  800575:	e8 a8 01 00 00       	call   800722 <_panic>
+		panic("file_read after file_write: %e", r);
+  80057a:	50                   	push   %eax
+  80057b:	68 94 4f 80 00       	push   $0x804f94
+  800580:	6a 51                	push   $0x51
+  800582:	68 45 4d 80 00       	push   $0x804d45
+  800587:	e8 96 01 00 00       	call   800722 <_panic>
+		panic("file_read after file_write returned wrong length: %d", r);
+  80058c:	53                   	push   %ebx
+  80058d:	68 b4 4f 80 00       	push   $0x804fb4
+  800592:	6a 53                	push   $0x53
+  800594:	68 45 4d 80 00       	push   $0x804d45
+  800599:	e8 84 01 00 00       	call   800722 <_panic>
+		panic("file_read after file_write returned wrong data");
+  80059e:	83 ec 04             	sub    $0x4,%esp
+  8005a1:	68 ec 4f 80 00       	push   $0x804fec
+  8005a6:	6a 55                	push   $0x55
+  8005a8:	68 45 4d 80 00       	push   $0x804d45
+  8005ad:	e8 70 01 00 00       	call   800722 <_panic>
+		panic("open /not-found: %e", r);
+  8005b2:	50                   	push   %eax
+  8005b3:	68 31 4d 80 00       	push   $0x804d31
+  8005b8:	6a 5a                	push   $0x5a
+  8005ba:	68 45 4d 80 00       	push   $0x804d45
+  8005bf:	e8 5e 01 00 00       	call   800722 <_panic>
+		panic("open /not-found succeeded!");
+  8005c4:	83 ec 04             	sub    $0x4,%esp
+  8005c7:	68 69 4e 80 00       	push   $0x804e69
+  8005cc:	6a 5c                	push   $0x5c
+  8005ce:	68 45 4d 80 00       	push   $0x804d45
+  8005d3:	e8 4a 01 00 00       	call   800722 <_panic>
+		panic("open /newmotd: %e", r);
+  8005d8:	50                   	push   %eax
+  8005d9:	68 64 4d 80 00       	push   $0x804d64
+  8005de:	6a 5f                	push   $0x5f
+  8005e0:	68 45 4d 80 00       	push   $0x804d45
+  8005e5:	e8 38 01 00 00       	call   800722 <_panic>
+		panic("open did not fill struct Fd correctly\n");
+  8005ea:	83 ec 04             	sub    $0x4,%esp
+  8005ed:	68 40 50 80 00       	push   $0x805040
+  8005f2:	6a 62                	push   $0x62
+  8005f4:	68 45 4d 80 00       	push   $0x804d45
+  8005f9:	e8 24 01 00 00       	call   800722 <_panic>
+		panic("creat /big: %e", f);
+  8005fe:	50                   	push   %eax
+  8005ff:	68 89 4e 80 00       	push   $0x804e89
+  800604:	6a 67                	push   $0x67
+  800606:	68 45 4d 80 00       	push   $0x804d45
+  80060b:	e8 12 01 00 00       	call   800722 <_panic>
+			panic("write /big@%d: %e", i, r);
+  800610:	83 ec 0c             	sub    $0xc,%esp
+  800613:	50                   	push   %eax
+  800614:	56                   	push   %esi
+  800615:	68 98 4e 80 00       	push   $0x804e98
+  80061a:	6a 6c                	push   $0x6c
+  80061c:	68 45 4d 80 00       	push   $0x804d45
+  800621:	e8 fc 00 00 00       	call   800722 <_panic>
+		panic("open /big: %e", f);
+  800626:	50                   	push   %eax
+  800627:	68 aa 4e 80 00       	push   $0x804eaa
+  80062c:	6a 71                	push   $0x71
+  80062e:	68 45 4d 80 00       	push   $0x804d45
+  800633:	e8 ea 00 00 00       	call   800722 <_panic>
+			panic("read /big@%d: %e", i, r);
+  800638:	83 ec 0c             	sub    $0xc,%esp
+  80063b:	50                   	push   %eax
+  80063c:	53                   	push   %ebx
+  80063d:	68 b8 4e 80 00       	push   $0x804eb8
+  800642:	6a 75                	push   $0x75
+  800644:	68 45 4d 80 00       	push   $0x804d45
+  800649:	e8 d4 00 00 00       	call   800722 <_panic>
+			panic("read /big from %d returned %d < %d bytes",
+  80064e:	83 ec 08             	sub    $0x8,%esp
+  800651:	68 00 02 00 00       	push   $0x200
+  800656:	50                   	push   %eax
+  800657:	53                   	push   %ebx
+  800658:	68 68 50 80 00       	push   $0x805068
+  80065d:	6a 77                	push   $0x77
+  80065f:	68 45 4d 80 00       	push   $0x804d45
+  800664:	e8 b9 00 00 00       	call   800722 <_panic>
+			panic("read /big from %d returned bad data %d",
+  800669:	83 ec 0c             	sub    $0xc,%esp
+  80066c:	50                   	push   %eax
+  80066d:	53                   	push   %ebx
+  80066e:	68 94 50 80 00       	push   $0x805094
+  800673:	6a 7a                	push   $0x7a
+  800675:	68 45 4d 80 00       	push   $0x804d45
+  80067a:	e8 a3 00 00 00       	call   800722 <_panic>
+
+0080067f <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80067f:	55                   	push   %ebp
+  800680:	89 e5                	mov    %esp,%ebp
+  800682:	57                   	push   %edi
+  800683:	56                   	push   %esi
+  800684:	53                   	push   %ebx
+  800685:	83 ec 1c             	sub    $0x1c,%esp
+  800688:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80068b:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  80068e:	e8 34 0b 00 00       	call   8011c7 <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  800693:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  800696:	89 15 c0 72 80 00    	mov    %edx,0x8072c0
+	thisenv = &envs[ENVX(eid)];
+  80069c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8006a1:	89 c1                	mov    %eax,%ecx
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  8006a3:	89 e7                	mov    %esp,%edi
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8006a5:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  8006ab:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8006b0:	77 16                	ja     8006c8 <libmain+0x49>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8006b2:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8006b7:	29 f8                	sub    %edi,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  8006b9:	c1 e8 10             	shr    $0x10,%eax
+  8006bc:	74 0a                	je     8006c8 <libmain+0x49>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8006be:	c1 e0 10             	shl    $0x10,%eax
+  8006c1:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8006c6:	29 c2                	sub    %eax,%edx
+  8006c8:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  8006cb:	c1 e0 04             	shl    $0x4,%eax
+  8006ce:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8006d3:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8006d5:	85 db                	test   %ebx,%ebx
+  8006d7:	7e 07                	jle    8006e0 <libmain+0x61>
+		binaryname = argv[0];
+  8006d9:	8b 06                	mov    (%esi),%eax
+  8006db:	a3 04 60 80 00       	mov    %eax,0x806004
+
+	// call user main routine
+	umain(argc, argv);
+  8006e0:	83 ec 08             	sub    $0x8,%esp
+  8006e3:	56                   	push   %esi
+  8006e4:	53                   	push   %ebx
+  8006e5:	e8 94 f9 ff ff       	call   80007e <umain>
+
+	// exit gracefully
+	exit();
+  8006ea:	e8 0b 00 00 00       	call   8006fa <exit>
+}
+  8006ef:	83 c4 10             	add    $0x10,%esp
+  8006f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006f5:	5b                   	pop    %ebx
+  8006f6:	5e                   	pop    %esi
+  8006f7:	5f                   	pop    %edi
+  8006f8:	5d                   	pop    %ebp
+  8006f9:	c3                   	ret
+
+008006fa <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8006fa:	55                   	push   %ebp
+  8006fb:	89 e5                	mov    %esp,%ebp
+  8006fd:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  800700:	6a 00                	push   $0x0
+  800702:	e8 a0 22 00 00       	call   8029a7 <fflush>
+	pthread_kill_others();
+  800707:	e8 0b 39 00 00       	call   804017 <pthread_kill_others>
+	close_all();
+  80070c:	e8 39 13 00 00       	call   801a4a <close_all>
+	sys_env_destroy(0);
+  800711:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800718:	e8 5f 0a 00 00       	call   80117c <sys_env_destroy>
+}
+  80071d:	83 c4 10             	add    $0x10,%esp
+  800720:	c9                   	leave
+  800721:	c3                   	ret
+
+00800722 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800722:	55                   	push   %ebp
+  800723:	89 e5                	mov    %esp,%ebp
+  800725:	56                   	push   %esi
+  800726:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800727:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80072a:	8b 35 04 60 80 00    	mov    0x806004,%esi
+  800730:	e8 92 0a 00 00       	call   8011c7 <sys_getenvid>
+  800735:	83 ec 0c             	sub    $0xc,%esp
+  800738:	ff 75 0c             	push   0xc(%ebp)
+  80073b:	ff 75 08             	push   0x8(%ebp)
+  80073e:	56                   	push   %esi
+  80073f:	50                   	push   %eax
+  800740:	68 ec 50 80 00       	push   $0x8050ec
+  800745:	e8 b3 00 00 00       	call   8007fd <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80074a:	83 c4 18             	add    $0x18,%esp
+  80074d:	53                   	push   %ebx
+  80074e:	ff 75 10             	push   0x10(%ebp)
+  800751:	e8 56 00 00 00       	call   8007ac <vcprintf>
+	cprintf("\n");
+  800756:	c7 04 24 32 58 80 00 	movl   $0x805832,(%esp)
+  80075d:	e8 9b 00 00 00       	call   8007fd <cprintf>
+  800762:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800765:	cc                   	int3
+	while (1)
+  800766:	eb fd                	jmp    800765 <_panic+0x43>
+
+00800768 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800768:	55                   	push   %ebp
+  800769:	89 e5                	mov    %esp,%ebp
+  80076b:	53                   	push   %ebx
+  80076c:	83 ec 04             	sub    $0x4,%esp
+  80076f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800772:	8b 13                	mov    (%ebx),%edx
+  800774:	8d 42 01             	lea    0x1(%edx),%eax
+  800777:	89 03                	mov    %eax,(%ebx)
+  800779:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80077c:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800780:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800785:	74 09                	je     800790 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800787:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80078b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80078e:	c9                   	leave
+  80078f:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800790:	83 ec 08             	sub    $0x8,%esp
+  800793:	68 ff 00 00 00       	push   $0xff
+  800798:	8d 43 08             	lea    0x8(%ebx),%eax
+  80079b:	50                   	push   %eax
+  80079c:	e8 84 09 00 00       	call   801125 <sys_cputs>
+		b->idx = 0;
+  8007a1:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8007a7:	83 c4 10             	add    $0x10,%esp
+  8007aa:	eb db                	jmp    800787 <putch+0x1f>
+
+008007ac <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8007ac:	55                   	push   %ebp
+  8007ad:	89 e5                	mov    %esp,%ebp
+  8007af:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8007b5:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8007bc:	00 00 00 
+	b.cnt = 0;
+  8007bf:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8007c6:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8007c9:	ff 75 0c             	push   0xc(%ebp)
+  8007cc:	ff 75 08             	push   0x8(%ebp)
+  8007cf:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8007d5:	50                   	push   %eax
+  8007d6:	68 68 07 80 00       	push   $0x800768
+  8007db:	e8 14 01 00 00       	call   8008f4 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8007e0:	83 c4 08             	add    $0x8,%esp
+  8007e3:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8007e9:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8007ef:	50                   	push   %eax
+  8007f0:	e8 30 09 00 00       	call   801125 <sys_cputs>
+
+	return b.cnt;
+}
+  8007f5:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8007fb:	c9                   	leave
+  8007fc:	c3                   	ret
+
+008007fd <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8007fd:	55                   	push   %ebp
+  8007fe:	89 e5                	mov    %esp,%ebp
+  800800:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800803:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800806:	50                   	push   %eax
+  800807:	ff 75 08             	push   0x8(%ebp)
+  80080a:	e8 9d ff ff ff       	call   8007ac <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80080f:	c9                   	leave
+  800810:	c3                   	ret
+
+00800811 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800811:	55                   	push   %ebp
+  800812:	89 e5                	mov    %esp,%ebp
+  800814:	57                   	push   %edi
+  800815:	56                   	push   %esi
+  800816:	53                   	push   %ebx
+  800817:	83 ec 1c             	sub    $0x1c,%esp
+  80081a:	89 c7                	mov    %eax,%edi
+  80081c:	89 d6                	mov    %edx,%esi
+  80081e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800821:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800824:	89 d1                	mov    %edx,%ecx
+  800826:	89 c2                	mov    %eax,%edx
+  800828:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80082b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80082e:	8b 45 10             	mov    0x10(%ebp),%eax
+  800831:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800834:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800837:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80083e:	39 c2                	cmp    %eax,%edx
+  800840:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800843:	72 3e                	jb     800883 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800845:	83 ec 0c             	sub    $0xc,%esp
+  800848:	ff 75 18             	push   0x18(%ebp)
+  80084b:	83 eb 01             	sub    $0x1,%ebx
+  80084e:	53                   	push   %ebx
+  80084f:	50                   	push   %eax
+  800850:	83 ec 08             	sub    $0x8,%esp
+  800853:	ff 75 e4             	push   -0x1c(%ebp)
+  800856:	ff 75 e0             	push   -0x20(%ebp)
+  800859:	ff 75 dc             	push   -0x24(%ebp)
+  80085c:	ff 75 d8             	push   -0x28(%ebp)
+  80085f:	e8 21 43 00 00       	call   804b85 <__udivdi3>
+  800864:	83 c4 18             	add    $0x18,%esp
+  800867:	52                   	push   %edx
+  800868:	50                   	push   %eax
+  800869:	89 f2                	mov    %esi,%edx
+  80086b:	89 f8                	mov    %edi,%eax
+  80086d:	e8 9f ff ff ff       	call   800811 <printnum>
+  800872:	83 c4 20             	add    $0x20,%esp
+  800875:	eb 13                	jmp    80088a <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800877:	83 ec 08             	sub    $0x8,%esp
+  80087a:	56                   	push   %esi
+  80087b:	ff 75 18             	push   0x18(%ebp)
+  80087e:	ff d7                	call   *%edi
+  800880:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800883:	83 eb 01             	sub    $0x1,%ebx
+  800886:	85 db                	test   %ebx,%ebx
+  800888:	7f ed                	jg     800877 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80088a:	83 ec 08             	sub    $0x8,%esp
+  80088d:	56                   	push   %esi
+  80088e:	83 ec 04             	sub    $0x4,%esp
+  800891:	ff 75 e4             	push   -0x1c(%ebp)
+  800894:	ff 75 e0             	push   -0x20(%ebp)
+  800897:	ff 75 dc             	push   -0x24(%ebp)
+  80089a:	ff 75 d8             	push   -0x28(%ebp)
+  80089d:	e8 04 43 00 00       	call   804ba6 <__umoddi3>
+  8008a2:	83 c4 14             	add    $0x14,%esp
+  8008a5:	0f be 80 0f 51 80 00 	movsbl 0x80510f(%eax),%eax
+  8008ac:	50                   	push   %eax
+  8008ad:	ff d7                	call   *%edi
+}
+  8008af:	83 c4 10             	add    $0x10,%esp
+  8008b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008b5:	5b                   	pop    %ebx
+  8008b6:	5e                   	pop    %esi
+  8008b7:	5f                   	pop    %edi
+  8008b8:	5d                   	pop    %ebp
+  8008b9:	c3                   	ret
+
+008008ba <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8008ba:	55                   	push   %ebp
+  8008bb:	89 e5                	mov    %esp,%ebp
+  8008bd:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8008c0:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8008c4:	8b 10                	mov    (%eax),%edx
+  8008c6:	3b 50 04             	cmp    0x4(%eax),%edx
+  8008c9:	73 0a                	jae    8008d5 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8008cb:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8008ce:	89 08                	mov    %ecx,(%eax)
+  8008d0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008d3:	88 02                	mov    %al,(%edx)
+}
+  8008d5:	5d                   	pop    %ebp
+  8008d6:	c3                   	ret
+
+008008d7 <printfmt>:
+{
+  8008d7:	55                   	push   %ebp
+  8008d8:	89 e5                	mov    %esp,%ebp
+  8008da:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8008dd:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8008e0:	50                   	push   %eax
+  8008e1:	ff 75 10             	push   0x10(%ebp)
+  8008e4:	ff 75 0c             	push   0xc(%ebp)
+  8008e7:	ff 75 08             	push   0x8(%ebp)
+  8008ea:	e8 05 00 00 00       	call   8008f4 <vprintfmt>
+}
+  8008ef:	83 c4 10             	add    $0x10,%esp
+  8008f2:	c9                   	leave
+  8008f3:	c3                   	ret
+
+008008f4 <vprintfmt>:
+{
+  8008f4:	55                   	push   %ebp
+  8008f5:	89 e5                	mov    %esp,%ebp
+  8008f7:	57                   	push   %edi
+  8008f8:	56                   	push   %esi
+  8008f9:	53                   	push   %ebx
+  8008fa:	83 ec 2c             	sub    $0x2c,%esp
+  8008fd:	8b 75 08             	mov    0x8(%ebp),%esi
+  800900:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800903:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800906:	eb 0a                	jmp    800912 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800908:	83 ec 08             	sub    $0x8,%esp
+  80090b:	53                   	push   %ebx
+  80090c:	50                   	push   %eax
+  80090d:	ff d6                	call   *%esi
+  80090f:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  800912:	83 c7 01             	add    $0x1,%edi
+  800915:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  800919:	83 f8 25             	cmp    $0x25,%eax
+  80091c:	74 0c                	je     80092a <vprintfmt+0x36>
+			if (ch == '\0')
+  80091e:	85 c0                	test   %eax,%eax
+  800920:	75 e6                	jne    800908 <vprintfmt+0x14>
+}
+  800922:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800925:	5b                   	pop    %ebx
+  800926:	5e                   	pop    %esi
+  800927:	5f                   	pop    %edi
+  800928:	5d                   	pop    %ebp
+  800929:	c3                   	ret
+		padc = ' ';
+  80092a:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80092e:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800935:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80093c:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800943:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  800948:	8d 47 01             	lea    0x1(%edi),%eax
+  80094b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80094e:	0f b6 17             	movzbl (%edi),%edx
+  800951:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800954:	3c 55                	cmp    $0x55,%al
+  800956:	0f 87 c5 03 00 00    	ja     800d21 <vprintfmt+0x42d>
+  80095c:	0f b6 c0             	movzbl %al,%eax
+  80095f:	ff 24 85 a0 52 80 00 	jmp    *0x8052a0(,%eax,4)
+  800966:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  800969:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80096c:	eb da                	jmp    800948 <vprintfmt+0x54>
+  80096e:	0f be d2             	movsbl %dl,%edx
+  800971:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800974:	b8 00 00 00 00       	mov    $0x0,%eax
+  800979:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80097c:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80097f:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800983:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800986:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800989:	83 f9 09             	cmp    $0x9,%ecx
+  80098c:	77 55                	ja     8009e3 <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  80098e:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800991:	eb e9                	jmp    80097c <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  800993:	8b 45 14             	mov    0x14(%ebp),%eax
+  800996:	8b 00                	mov    (%eax),%eax
+  800998:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80099b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80099e:	8d 40 04             	lea    0x4(%eax),%eax
+  8009a1:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  8009a4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8009a7:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8009ab:	79 9b                	jns    800948 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8009ad:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8009b0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8009b3:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8009ba:	eb 8c                	jmp    800948 <vprintfmt+0x54>
+			if (width < 0)
+  8009bc:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8009bf:	85 d2                	test   %edx,%edx
+  8009c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009c6:	0f 49 c2             	cmovns %edx,%eax
+  8009c9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  8009cc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8009cf:	e9 74 ff ff ff       	jmp    800948 <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  8009d4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8009d7:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8009de:	e9 65 ff ff ff       	jmp    800948 <vprintfmt+0x54>
+  8009e3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8009e6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8009e9:	eb bc                	jmp    8009a7 <vprintfmt+0xb3>
+			lflag++;
+  8009eb:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  8009ee:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8009f1:	e9 52 ff ff ff       	jmp    800948 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8009f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009f9:	8d 78 04             	lea    0x4(%eax),%edi
+  8009fc:	83 ec 08             	sub    $0x8,%esp
+  8009ff:	53                   	push   %ebx
+  800a00:	ff 30                	push   (%eax)
+  800a02:	ff d6                	call   *%esi
+			break;
+  800a04:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800a07:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800a0a:	e9 b1 02 00 00       	jmp    800cc0 <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  800a0f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a12:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800a15:	8b 10                	mov    (%eax),%edx
+  800a17:	89 d0                	mov    %edx,%eax
+  800a19:	f7 d8                	neg    %eax
+  800a1b:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800a1e:	83 f8 14             	cmp    $0x14,%eax
+  800a21:	7f 23                	jg     800a46 <vprintfmt+0x152>
+  800a23:	8b 14 85 00 54 80 00 	mov    0x805400(,%eax,4),%edx
+  800a2a:	85 d2                	test   %edx,%edx
+  800a2c:	74 18                	je     800a46 <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  800a2e:	52                   	push   %edx
+  800a2f:	68 c3 55 80 00       	push   $0x8055c3
+  800a34:	53                   	push   %ebx
+  800a35:	56                   	push   %esi
+  800a36:	e8 9c fe ff ff       	call   8008d7 <printfmt>
+  800a3b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800a3e:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800a41:	e9 7a 02 00 00       	jmp    800cc0 <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  800a46:	50                   	push   %eax
+  800a47:	68 27 51 80 00       	push   $0x805127
+  800a4c:	53                   	push   %ebx
+  800a4d:	56                   	push   %esi
+  800a4e:	e8 84 fe ff ff       	call   8008d7 <printfmt>
+  800a53:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800a56:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800a59:	e9 62 02 00 00       	jmp    800cc0 <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800a5e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a61:	83 c0 04             	add    $0x4,%eax
+  800a64:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800a67:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a6a:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800a6c:	85 c9                	test   %ecx,%ecx
+  800a6e:	b8 20 51 80 00       	mov    $0x805120,%eax
+  800a73:	0f 45 c1             	cmovne %ecx,%eax
+  800a76:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800a79:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800a7d:	7e 06                	jle    800a85 <vprintfmt+0x191>
+  800a7f:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800a83:	75 0b                	jne    800a90 <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800a85:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800a88:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800a8b:	89 75 08             	mov    %esi,0x8(%ebp)
+  800a8e:	eb 5c                	jmp    800aec <vprintfmt+0x1f8>
+  800a90:	83 ec 08             	sub    $0x8,%esp
+  800a93:	ff 75 d0             	push   -0x30(%ebp)
+  800a96:	ff 75 cc             	push   -0x34(%ebp)
+  800a99:	e8 20 03 00 00       	call   800dbe <strnlen>
+  800a9e:	89 c2                	mov    %eax,%edx
+  800aa0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800aa3:	29 d0                	sub    %edx,%eax
+  800aa5:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800aa8:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800aac:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800aaf:	89 75 08             	mov    %esi,0x8(%ebp)
+  800ab2:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800ab4:	eb 0e                	jmp    800ac4 <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  800ab6:	83 ec 08             	sub    $0x8,%esp
+  800ab9:	53                   	push   %ebx
+  800aba:	57                   	push   %edi
+  800abb:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800abe:	83 ee 01             	sub    $0x1,%esi
+  800ac1:	83 c4 10             	add    $0x10,%esp
+  800ac4:	85 f6                	test   %esi,%esi
+  800ac6:	7f ee                	jg     800ab6 <vprintfmt+0x1c2>
+  800ac8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800acb:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ace:	85 c0                	test   %eax,%eax
+  800ad0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ad5:	0f 49 d0             	cmovns %eax,%edx
+  800ad8:	29 d0                	sub    %edx,%eax
+  800ada:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800add:	eb a6                	jmp    800a85 <vprintfmt+0x191>
+					putch(ch, putdat);
+  800adf:	83 ec 08             	sub    $0x8,%esp
+  800ae2:	53                   	push   %ebx
+  800ae3:	52                   	push   %edx
+  800ae4:	ff 55 08             	call   *0x8(%ebp)
+  800ae7:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800aea:	89 f1                	mov    %esi,%ecx
+  800aec:	8d 71 01             	lea    0x1(%ecx),%esi
+  800aef:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800af3:	0f be d0             	movsbl %al,%edx
+  800af6:	85 d2                	test   %edx,%edx
+  800af8:	74 28                	je     800b22 <vprintfmt+0x22e>
+  800afa:	85 ff                	test   %edi,%edi
+  800afc:	78 05                	js     800b03 <vprintfmt+0x20f>
+  800afe:	83 ef 01             	sub    $0x1,%edi
+  800b01:	78 30                	js     800b33 <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800b03:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800b07:	74 d6                	je     800adf <vprintfmt+0x1eb>
+  800b09:	0f be c0             	movsbl %al,%eax
+  800b0c:	83 e8 20             	sub    $0x20,%eax
+  800b0f:	83 f8 5e             	cmp    $0x5e,%eax
+  800b12:	76 cb                	jbe    800adf <vprintfmt+0x1eb>
+					putch('?', putdat);
+  800b14:	83 ec 08             	sub    $0x8,%esp
+  800b17:	53                   	push   %ebx
+  800b18:	6a 3f                	push   $0x3f
+  800b1a:	ff 55 08             	call   *0x8(%ebp)
+  800b1d:	83 c4 10             	add    $0x10,%esp
+  800b20:	eb c8                	jmp    800aea <vprintfmt+0x1f6>
+  800b22:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b25:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800b28:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800b2b:	01 d0                	add    %edx,%eax
+  800b2d:	29 c8                	sub    %ecx,%eax
+  800b2f:	89 c7                	mov    %eax,%edi
+  800b31:	eb 13                	jmp    800b46 <vprintfmt+0x252>
+  800b33:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b36:	eb ed                	jmp    800b25 <vprintfmt+0x231>
+				putch(' ', putdat);
+  800b38:	83 ec 08             	sub    $0x8,%esp
+  800b3b:	53                   	push   %ebx
+  800b3c:	6a 20                	push   $0x20
+  800b3e:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800b40:	83 ef 01             	sub    $0x1,%edi
+  800b43:	83 c4 10             	add    $0x10,%esp
+  800b46:	85 ff                	test   %edi,%edi
+  800b48:	7f ee                	jg     800b38 <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800b4a:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800b4d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b50:	e9 6b 01 00 00       	jmp    800cc0 <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  800b55:	83 f9 01             	cmp    $0x1,%ecx
+  800b58:	7f 1f                	jg     800b79 <vprintfmt+0x285>
+	else if (lflag)
+  800b5a:	85 c9                	test   %ecx,%ecx
+  800b5c:	74 67                	je     800bc5 <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  800b5e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b61:	8b 00                	mov    (%eax),%eax
+  800b63:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800b66:	89 c1                	mov    %eax,%ecx
+  800b68:	c1 f9 1f             	sar    $0x1f,%ecx
+  800b6b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800b6e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b71:	8d 40 04             	lea    0x4(%eax),%eax
+  800b74:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b77:	eb 17                	jmp    800b90 <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  800b79:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b7c:	8b 50 04             	mov    0x4(%eax),%edx
+  800b7f:	8b 00                	mov    (%eax),%eax
+  800b81:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800b84:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800b87:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b8a:	8d 40 08             	lea    0x8(%eax),%eax
+  800b8d:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800b90:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800b93:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800b96:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800b9b:	85 c9                	test   %ecx,%ecx
+  800b9d:	0f 89 03 01 00 00    	jns    800ca6 <vprintfmt+0x3b2>
+				putch('-', putdat);
+  800ba3:	83 ec 08             	sub    $0x8,%esp
+  800ba6:	53                   	push   %ebx
+  800ba7:	6a 2d                	push   $0x2d
+  800ba9:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800bab:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800bae:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800bb1:	f7 da                	neg    %edx
+  800bb3:	83 d1 00             	adc    $0x0,%ecx
+  800bb6:	f7 d9                	neg    %ecx
+  800bb8:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800bbb:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800bc0:	e9 e1 00 00 00       	jmp    800ca6 <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  800bc5:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bc8:	8b 00                	mov    (%eax),%eax
+  800bca:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800bcd:	89 c1                	mov    %eax,%ecx
+  800bcf:	c1 f9 1f             	sar    $0x1f,%ecx
+  800bd2:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800bd5:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bd8:	8d 40 04             	lea    0x4(%eax),%eax
+  800bdb:	89 45 14             	mov    %eax,0x14(%ebp)
+  800bde:	eb b0                	jmp    800b90 <vprintfmt+0x29c>
+	if (lflag >= 2)
+  800be0:	83 f9 01             	cmp    $0x1,%ecx
+  800be3:	7f 1e                	jg     800c03 <vprintfmt+0x30f>
+	else if (lflag)
+  800be5:	85 c9                	test   %ecx,%ecx
+  800be7:	74 32                	je     800c1b <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  800be9:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bec:	8b 10                	mov    (%eax),%edx
+  800bee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bf3:	8d 40 04             	lea    0x4(%eax),%eax
+  800bf6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800bf9:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800bfe:	e9 a3 00 00 00       	jmp    800ca6 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800c03:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c06:	8b 10                	mov    (%eax),%edx
+  800c08:	8b 48 04             	mov    0x4(%eax),%ecx
+  800c0b:	8d 40 08             	lea    0x8(%eax),%eax
+  800c0e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800c11:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800c16:	e9 8b 00 00 00       	jmp    800ca6 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800c1b:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c1e:	8b 10                	mov    (%eax),%edx
+  800c20:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c25:	8d 40 04             	lea    0x4(%eax),%eax
+  800c28:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800c2b:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800c30:	eb 74                	jmp    800ca6 <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  800c32:	83 f9 01             	cmp    $0x1,%ecx
+  800c35:	7f 1b                	jg     800c52 <vprintfmt+0x35e>
+	else if (lflag)
+  800c37:	85 c9                	test   %ecx,%ecx
+  800c39:	74 2c                	je     800c67 <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  800c3b:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c3e:	8b 10                	mov    (%eax),%edx
+  800c40:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c45:	8d 40 04             	lea    0x4(%eax),%eax
+  800c48:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800c4b:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800c50:	eb 54                	jmp    800ca6 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800c52:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c55:	8b 10                	mov    (%eax),%edx
+  800c57:	8b 48 04             	mov    0x4(%eax),%ecx
+  800c5a:	8d 40 08             	lea    0x8(%eax),%eax
+  800c5d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800c60:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800c65:	eb 3f                	jmp    800ca6 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800c67:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c6a:	8b 10                	mov    (%eax),%edx
+  800c6c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c71:	8d 40 04             	lea    0x4(%eax),%eax
+  800c74:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800c77:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800c7c:	eb 28                	jmp    800ca6 <vprintfmt+0x3b2>
+			putch('0', putdat);
+  800c7e:	83 ec 08             	sub    $0x8,%esp
+  800c81:	53                   	push   %ebx
+  800c82:	6a 30                	push   $0x30
+  800c84:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800c86:	83 c4 08             	add    $0x8,%esp
+  800c89:	53                   	push   %ebx
+  800c8a:	6a 78                	push   $0x78
+  800c8c:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800c8e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c91:	8b 10                	mov    (%eax),%edx
+  800c93:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800c98:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800c9b:	8d 40 04             	lea    0x4(%eax),%eax
+  800c9e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800ca1:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800ca6:	83 ec 0c             	sub    $0xc,%esp
+  800ca9:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800cad:	50                   	push   %eax
+  800cae:	ff 75 e0             	push   -0x20(%ebp)
+  800cb1:	57                   	push   %edi
+  800cb2:	51                   	push   %ecx
+  800cb3:	52                   	push   %edx
+  800cb4:	89 da                	mov    %ebx,%edx
+  800cb6:	89 f0                	mov    %esi,%eax
+  800cb8:	e8 54 fb ff ff       	call   800811 <printnum>
+			break;
+  800cbd:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800cc0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  800cc3:	e9 4a fc ff ff       	jmp    800912 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800cc8:	83 f9 01             	cmp    $0x1,%ecx
+  800ccb:	7f 1b                	jg     800ce8 <vprintfmt+0x3f4>
+	else if (lflag)
+  800ccd:	85 c9                	test   %ecx,%ecx
+  800ccf:	74 2c                	je     800cfd <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  800cd1:	8b 45 14             	mov    0x14(%ebp),%eax
+  800cd4:	8b 10                	mov    (%eax),%edx
+  800cd6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cdb:	8d 40 04             	lea    0x4(%eax),%eax
+  800cde:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800ce1:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800ce6:	eb be                	jmp    800ca6 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800ce8:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ceb:	8b 10                	mov    (%eax),%edx
+  800ced:	8b 48 04             	mov    0x4(%eax),%ecx
+  800cf0:	8d 40 08             	lea    0x8(%eax),%eax
+  800cf3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800cf6:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800cfb:	eb a9                	jmp    800ca6 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800cfd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d00:	8b 10                	mov    (%eax),%edx
+  800d02:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d07:	8d 40 04             	lea    0x4(%eax),%eax
+  800d0a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800d0d:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800d12:	eb 92                	jmp    800ca6 <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  800d14:	83 ec 08             	sub    $0x8,%esp
+  800d17:	53                   	push   %ebx
+  800d18:	6a 25                	push   $0x25
+  800d1a:	ff d6                	call   *%esi
+			break;
+  800d1c:	83 c4 10             	add    $0x10,%esp
+  800d1f:	eb 9f                	jmp    800cc0 <vprintfmt+0x3cc>
+			putch('%', putdat);
+  800d21:	83 ec 08             	sub    $0x8,%esp
+  800d24:	53                   	push   %ebx
+  800d25:	6a 25                	push   $0x25
+  800d27:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800d29:	83 c4 10             	add    $0x10,%esp
+  800d2c:	89 f8                	mov    %edi,%eax
+  800d2e:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800d32:	74 05                	je     800d39 <vprintfmt+0x445>
+  800d34:	83 e8 01             	sub    $0x1,%eax
+  800d37:	eb f5                	jmp    800d2e <vprintfmt+0x43a>
+  800d39:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800d3c:	eb 82                	jmp    800cc0 <vprintfmt+0x3cc>
+
+00800d3e <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800d3e:	55                   	push   %ebp
+  800d3f:	89 e5                	mov    %esp,%ebp
+  800d41:	83 ec 18             	sub    $0x18,%esp
+  800d44:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d47:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800d4a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800d4d:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800d51:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800d54:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800d5b:	85 c0                	test   %eax,%eax
+  800d5d:	74 26                	je     800d85 <vsnprintf+0x47>
+  800d5f:	85 d2                	test   %edx,%edx
+  800d61:	7e 22                	jle    800d85 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800d63:	ff 75 14             	push   0x14(%ebp)
+  800d66:	ff 75 10             	push   0x10(%ebp)
+  800d69:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800d6c:	50                   	push   %eax
+  800d6d:	68 ba 08 80 00       	push   $0x8008ba
+  800d72:	e8 7d fb ff ff       	call   8008f4 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800d77:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800d7a:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800d7d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800d80:	83 c4 10             	add    $0x10,%esp
+}
+  800d83:	c9                   	leave
+  800d84:	c3                   	ret
+		return -E_INVAL;
+  800d85:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d8a:	eb f7                	jmp    800d83 <vsnprintf+0x45>
+
+00800d8c <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800d8c:	55                   	push   %ebp
+  800d8d:	89 e5                	mov    %esp,%ebp
+  800d8f:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800d92:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800d95:	50                   	push   %eax
+  800d96:	ff 75 10             	push   0x10(%ebp)
+  800d99:	ff 75 0c             	push   0xc(%ebp)
+  800d9c:	ff 75 08             	push   0x8(%ebp)
+  800d9f:	e8 9a ff ff ff       	call   800d3e <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800da4:	c9                   	leave
+  800da5:	c3                   	ret
+
+00800da6 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800da6:	55                   	push   %ebp
+  800da7:	89 e5                	mov    %esp,%ebp
+  800da9:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800dac:	b8 00 00 00 00       	mov    $0x0,%eax
+  800db1:	eb 03                	jmp    800db6 <strlen+0x10>
+		n++;
+  800db3:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800db6:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800dba:	75 f7                	jne    800db3 <strlen+0xd>
+	return n;
+}
+  800dbc:	5d                   	pop    %ebp
+  800dbd:	c3                   	ret
+
+00800dbe <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800dbe:	55                   	push   %ebp
+  800dbf:	89 e5                	mov    %esp,%ebp
+  800dc1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800dc4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800dc7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dcc:	eb 03                	jmp    800dd1 <strnlen+0x13>
+		n++;
+  800dce:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800dd1:	39 d0                	cmp    %edx,%eax
+  800dd3:	74 08                	je     800ddd <strnlen+0x1f>
+  800dd5:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800dd9:	75 f3                	jne    800dce <strnlen+0x10>
+  800ddb:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800ddd:	89 d0                	mov    %edx,%eax
+  800ddf:	5d                   	pop    %ebp
+  800de0:	c3                   	ret
+
+00800de1 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800de1:	55                   	push   %ebp
+  800de2:	89 e5                	mov    %esp,%ebp
+  800de4:	53                   	push   %ebx
+  800de5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800de8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800deb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800df0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800df4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800df7:	83 c0 01             	add    $0x1,%eax
+  800dfa:	84 d2                	test   %dl,%dl
+  800dfc:	75 f2                	jne    800df0 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800dfe:	89 c8                	mov    %ecx,%eax
+  800e00:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e03:	c9                   	leave
+  800e04:	c3                   	ret
+
+00800e05 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800e05:	55                   	push   %ebp
+  800e06:	89 e5                	mov    %esp,%ebp
+  800e08:	53                   	push   %ebx
+  800e09:	83 ec 10             	sub    $0x10,%esp
+  800e0c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800e0f:	53                   	push   %ebx
+  800e10:	e8 91 ff ff ff       	call   800da6 <strlen>
+  800e15:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800e18:	ff 75 0c             	push   0xc(%ebp)
+  800e1b:	01 d8                	add    %ebx,%eax
+  800e1d:	50                   	push   %eax
+  800e1e:	e8 be ff ff ff       	call   800de1 <strcpy>
+	return dst;
+}
+  800e23:	89 d8                	mov    %ebx,%eax
+  800e25:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e28:	c9                   	leave
+  800e29:	c3                   	ret
+
+00800e2a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800e2a:	55                   	push   %ebp
+  800e2b:	89 e5                	mov    %esp,%ebp
+  800e2d:	56                   	push   %esi
+  800e2e:	53                   	push   %ebx
+  800e2f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e32:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800e35:	89 f3                	mov    %esi,%ebx
+  800e37:	03 5d 10             	add    0x10(%ebp),%ebx
+  800e3a:	89 f0                	mov    %esi,%eax
+  800e3c:	eb 0f                	jmp    800e4d <strncpy+0x23>
+		*dst++ = *src;
+  800e3e:	83 c0 01             	add    $0x1,%eax
+  800e41:	0f b6 0a             	movzbl (%edx),%ecx
+  800e44:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800e47:	80 f9 01             	cmp    $0x1,%cl
+  800e4a:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800e4d:	39 d8                	cmp    %ebx,%eax
+  800e4f:	75 ed                	jne    800e3e <strncpy+0x14>
+	}
+	return ret;
+}
+  800e51:	89 f0                	mov    %esi,%eax
+  800e53:	5b                   	pop    %ebx
+  800e54:	5e                   	pop    %esi
+  800e55:	5d                   	pop    %ebp
+  800e56:	c3                   	ret
+
+00800e57 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800e57:	55                   	push   %ebp
+  800e58:	89 e5                	mov    %esp,%ebp
+  800e5a:	56                   	push   %esi
+  800e5b:	53                   	push   %ebx
+  800e5c:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e5f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e62:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800e65:	89 f0                	mov    %esi,%eax
+  800e67:	85 d2                	test   %edx,%edx
+  800e69:	74 21                	je     800e8c <strlcpy+0x35>
+  800e6b:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800e6f:	89 f2                	mov    %esi,%edx
+  800e71:	eb 09                	jmp    800e7c <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800e73:	83 c1 01             	add    $0x1,%ecx
+  800e76:	83 c2 01             	add    $0x1,%edx
+  800e79:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800e7c:	39 c2                	cmp    %eax,%edx
+  800e7e:	74 09                	je     800e89 <strlcpy+0x32>
+  800e80:	0f b6 19             	movzbl (%ecx),%ebx
+  800e83:	84 db                	test   %bl,%bl
+  800e85:	75 ec                	jne    800e73 <strlcpy+0x1c>
+  800e87:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800e89:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800e8c:	29 f0                	sub    %esi,%eax
+}
+  800e8e:	5b                   	pop    %ebx
+  800e8f:	5e                   	pop    %esi
+  800e90:	5d                   	pop    %ebp
+  800e91:	c3                   	ret
+
+00800e92 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800e92:	55                   	push   %ebp
+  800e93:	89 e5                	mov    %esp,%ebp
+  800e95:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800e98:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800e9b:	eb 06                	jmp    800ea3 <strcmp+0x11>
+		p++, q++;
+  800e9d:	83 c1 01             	add    $0x1,%ecx
+  800ea0:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800ea3:	0f b6 01             	movzbl (%ecx),%eax
+  800ea6:	84 c0                	test   %al,%al
+  800ea8:	74 04                	je     800eae <strcmp+0x1c>
+  800eaa:	3a 02                	cmp    (%edx),%al
+  800eac:	74 ef                	je     800e9d <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800eae:	0f b6 c0             	movzbl %al,%eax
+  800eb1:	0f b6 12             	movzbl (%edx),%edx
+  800eb4:	29 d0                	sub    %edx,%eax
+}
+  800eb6:	5d                   	pop    %ebp
+  800eb7:	c3                   	ret
+
+00800eb8 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800eb8:	55                   	push   %ebp
+  800eb9:	89 e5                	mov    %esp,%ebp
+  800ebb:	53                   	push   %ebx
+  800ebc:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ebf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec2:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800ec5:	eb 09                	jmp    800ed0 <strncmp+0x18>
+		n--, p++, q++;
+  800ec7:	83 ea 01             	sub    $0x1,%edx
+  800eca:	83 c0 01             	add    $0x1,%eax
+  800ecd:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800ed0:	85 d2                	test   %edx,%edx
+  800ed2:	74 18                	je     800eec <strncmp+0x34>
+  800ed4:	0f b6 18             	movzbl (%eax),%ebx
+  800ed7:	84 db                	test   %bl,%bl
+  800ed9:	74 04                	je     800edf <strncmp+0x27>
+  800edb:	3a 19                	cmp    (%ecx),%bl
+  800edd:	74 e8                	je     800ec7 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800edf:	0f b6 00             	movzbl (%eax),%eax
+  800ee2:	0f b6 11             	movzbl (%ecx),%edx
+  800ee5:	29 d0                	sub    %edx,%eax
+}
+  800ee7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800eea:	c9                   	leave
+  800eeb:	c3                   	ret
+		return 0;
+  800eec:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ef1:	eb f4                	jmp    800ee7 <strncmp+0x2f>
+
+00800ef3 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800ef3:	55                   	push   %ebp
+  800ef4:	89 e5                	mov    %esp,%ebp
+  800ef6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ef9:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800efd:	eb 03                	jmp    800f02 <strchr+0xf>
+  800eff:	83 c0 01             	add    $0x1,%eax
+  800f02:	0f b6 10             	movzbl (%eax),%edx
+  800f05:	84 d2                	test   %dl,%dl
+  800f07:	74 06                	je     800f0f <strchr+0x1c>
+		if (*s == c)
+  800f09:	38 ca                	cmp    %cl,%dl
+  800f0b:	75 f2                	jne    800eff <strchr+0xc>
+  800f0d:	eb 05                	jmp    800f14 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800f0f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f14:	5d                   	pop    %ebp
+  800f15:	c3                   	ret
+
+00800f16 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800f16:	55                   	push   %ebp
+  800f17:	89 e5                	mov    %esp,%ebp
+  800f19:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f1c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800f20:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800f23:	38 ca                	cmp    %cl,%dl
+  800f25:	74 09                	je     800f30 <strfind+0x1a>
+  800f27:	84 d2                	test   %dl,%dl
+  800f29:	74 05                	je     800f30 <strfind+0x1a>
+	for (; *s; s++)
+  800f2b:	83 c0 01             	add    $0x1,%eax
+  800f2e:	eb f0                	jmp    800f20 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800f30:	5d                   	pop    %ebp
+  800f31:	c3                   	ret
+
+00800f32 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800f32:	55                   	push   %ebp
+  800f33:	89 e5                	mov    %esp,%ebp
+  800f35:	57                   	push   %edi
+  800f36:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800f39:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800f3c:	85 c9                	test   %ecx,%ecx
+  800f3e:	74 20                	je     800f60 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800f40:	89 f8                	mov    %edi,%eax
+  800f42:	09 c8                	or     %ecx,%eax
+  800f44:	a8 03                	test   $0x3,%al
+  800f46:	75 12                	jne    800f5a <memset+0x28>
+		c &= 0xFF;
+  800f48:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800f4c:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800f52:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800f55:	fc                   	cld
+  800f56:	f3 ab                	rep stos %eax,%es:(%edi)
+  800f58:	eb 06                	jmp    800f60 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800f5a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f5d:	fc                   	cld
+  800f5e:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800f60:	89 f8                	mov    %edi,%eax
+  800f62:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800f65:	c9                   	leave
+  800f66:	c3                   	ret
+
+00800f67 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800f67:	55                   	push   %ebp
+  800f68:	89 e5                	mov    %esp,%ebp
+  800f6a:	57                   	push   %edi
+  800f6b:	56                   	push   %esi
+  800f6c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f6f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800f72:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800f75:	39 c6                	cmp    %eax,%esi
+  800f77:	73 32                	jae    800fab <memmove+0x44>
+  800f79:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800f7c:	39 d0                	cmp    %edx,%eax
+  800f7e:	73 2b                	jae    800fab <memmove+0x44>
+		s += n;
+		d += n;
+  800f80:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800f83:	89 d6                	mov    %edx,%esi
+  800f85:	09 fe                	or     %edi,%esi
+  800f87:	09 ce                	or     %ecx,%esi
+  800f89:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800f8f:	75 0e                	jne    800f9f <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800f91:	83 ef 04             	sub    $0x4,%edi
+  800f94:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800f97:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800f9a:	fd                   	std
+  800f9b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800f9d:	eb 09                	jmp    800fa8 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800f9f:	83 ef 01             	sub    $0x1,%edi
+  800fa2:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800fa5:	fd                   	std
+  800fa6:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800fa8:	fc                   	cld
+  800fa9:	eb 1a                	jmp    800fc5 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800fab:	89 f2                	mov    %esi,%edx
+  800fad:	09 c2                	or     %eax,%edx
+  800faf:	09 ca                	or     %ecx,%edx
+  800fb1:	f6 c2 03             	test   $0x3,%dl
+  800fb4:	75 0a                	jne    800fc0 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800fb6:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800fb9:	89 c7                	mov    %eax,%edi
+  800fbb:	fc                   	cld
+  800fbc:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800fbe:	eb 05                	jmp    800fc5 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800fc0:	89 c7                	mov    %eax,%edi
+  800fc2:	fc                   	cld
+  800fc3:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800fc5:	5e                   	pop    %esi
+  800fc6:	5f                   	pop    %edi
+  800fc7:	5d                   	pop    %ebp
+  800fc8:	c3                   	ret
+
+00800fc9 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800fc9:	55                   	push   %ebp
+  800fca:	89 e5                	mov    %esp,%ebp
+  800fcc:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800fcf:	ff 75 10             	push   0x10(%ebp)
+  800fd2:	ff 75 0c             	push   0xc(%ebp)
+  800fd5:	ff 75 08             	push   0x8(%ebp)
+  800fd8:	e8 8a ff ff ff       	call   800f67 <memmove>
+}
+  800fdd:	c9                   	leave
+  800fde:	c3                   	ret
+
+00800fdf <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800fdf:	55                   	push   %ebp
+  800fe0:	89 e5                	mov    %esp,%ebp
+  800fe2:	56                   	push   %esi
+  800fe3:	53                   	push   %ebx
+  800fe4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fe7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800fea:	89 c6                	mov    %eax,%esi
+  800fec:	03 75 10             	add    0x10(%ebp),%esi
+  800fef:	eb 06                	jmp    800ff7 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800ff1:	83 c0 01             	add    $0x1,%eax
+  800ff4:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800ff7:	39 f0                	cmp    %esi,%eax
+  800ff9:	74 14                	je     80100f <memcmp+0x30>
+		if (*s1 != *s2)
+  800ffb:	0f b6 08             	movzbl (%eax),%ecx
+  800ffe:	0f b6 1a             	movzbl (%edx),%ebx
+  801001:	38 d9                	cmp    %bl,%cl
+  801003:	74 ec                	je     800ff1 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  801005:	0f b6 c1             	movzbl %cl,%eax
+  801008:	0f b6 db             	movzbl %bl,%ebx
+  80100b:	29 d8                	sub    %ebx,%eax
+  80100d:	eb 05                	jmp    801014 <memcmp+0x35>
+	}
+
+	return 0;
+  80100f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801014:	5b                   	pop    %ebx
+  801015:	5e                   	pop    %esi
+  801016:	5d                   	pop    %ebp
+  801017:	c3                   	ret
+
+00801018 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801018:	55                   	push   %ebp
+  801019:	89 e5                	mov    %esp,%ebp
+  80101b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80101e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  801021:	89 c2                	mov    %eax,%edx
+  801023:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  801026:	eb 03                	jmp    80102b <memfind+0x13>
+  801028:	83 c0 01             	add    $0x1,%eax
+  80102b:	39 d0                	cmp    %edx,%eax
+  80102d:	73 04                	jae    801033 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  80102f:	38 08                	cmp    %cl,(%eax)
+  801031:	75 f5                	jne    801028 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  801033:	5d                   	pop    %ebp
+  801034:	c3                   	ret
+
+00801035 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801035:	55                   	push   %ebp
+  801036:	89 e5                	mov    %esp,%ebp
+  801038:	57                   	push   %edi
+  801039:	56                   	push   %esi
+  80103a:	53                   	push   %ebx
+  80103b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80103e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801041:	eb 03                	jmp    801046 <strtol+0x11>
+		s++;
+  801043:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  801046:	0f b6 02             	movzbl (%edx),%eax
+  801049:	3c 20                	cmp    $0x20,%al
+  80104b:	74 f6                	je     801043 <strtol+0xe>
+  80104d:	3c 09                	cmp    $0x9,%al
+  80104f:	74 f2                	je     801043 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  801051:	3c 2b                	cmp    $0x2b,%al
+  801053:	74 2a                	je     80107f <strtol+0x4a>
+	int neg = 0;
+  801055:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  80105a:	3c 2d                	cmp    $0x2d,%al
+  80105c:	74 2b                	je     801089 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80105e:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  801064:	75 0f                	jne    801075 <strtol+0x40>
+  801066:	80 3a 30             	cmpb   $0x30,(%edx)
+  801069:	74 28                	je     801093 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  80106b:	85 db                	test   %ebx,%ebx
+  80106d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801072:	0f 44 d8             	cmove  %eax,%ebx
+  801075:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80107a:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  80107d:	eb 46                	jmp    8010c5 <strtol+0x90>
+		s++;
+  80107f:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  801082:	bf 00 00 00 00       	mov    $0x0,%edi
+  801087:	eb d5                	jmp    80105e <strtol+0x29>
+		s++, neg = 1;
+  801089:	83 c2 01             	add    $0x1,%edx
+  80108c:	bf 01 00 00 00       	mov    $0x1,%edi
+  801091:	eb cb                	jmp    80105e <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801093:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  801097:	74 0e                	je     8010a7 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  801099:	85 db                	test   %ebx,%ebx
+  80109b:	75 d8                	jne    801075 <strtol+0x40>
+		s++, base = 8;
+  80109d:	83 c2 01             	add    $0x1,%edx
+  8010a0:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8010a5:	eb ce                	jmp    801075 <strtol+0x40>
+		s += 2, base = 16;
+  8010a7:	83 c2 02             	add    $0x2,%edx
+  8010aa:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8010af:	eb c4                	jmp    801075 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  8010b1:	0f be c0             	movsbl %al,%eax
+  8010b4:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  8010b7:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8010ba:	7d 3a                	jge    8010f6 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  8010bc:	83 c2 01             	add    $0x1,%edx
+  8010bf:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8010c3:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  8010c5:	0f b6 02             	movzbl (%edx),%eax
+  8010c8:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8010cb:	89 f3                	mov    %esi,%ebx
+  8010cd:	80 fb 09             	cmp    $0x9,%bl
+  8010d0:	76 df                	jbe    8010b1 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  8010d2:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8010d5:	89 f3                	mov    %esi,%ebx
+  8010d7:	80 fb 19             	cmp    $0x19,%bl
+  8010da:	77 08                	ja     8010e4 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  8010dc:	0f be c0             	movsbl %al,%eax
+  8010df:	83 e8 57             	sub    $0x57,%eax
+  8010e2:	eb d3                	jmp    8010b7 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  8010e4:	8d 70 bf             	lea    -0x41(%eax),%esi
+  8010e7:	89 f3                	mov    %esi,%ebx
+  8010e9:	80 fb 19             	cmp    $0x19,%bl
+  8010ec:	77 08                	ja     8010f6 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  8010ee:	0f be c0             	movsbl %al,%eax
+  8010f1:	83 e8 37             	sub    $0x37,%eax
+  8010f4:	eb c1                	jmp    8010b7 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  8010f6:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8010fa:	74 05                	je     801101 <strtol+0xcc>
+		*endptr = (char *) s;
+  8010fc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8010ff:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  801101:	89 c8                	mov    %ecx,%eax
+  801103:	f7 d8                	neg    %eax
+  801105:	85 ff                	test   %edi,%edi
+  801107:	0f 45 c8             	cmovne %eax,%ecx
+}
+  80110a:	89 c8                	mov    %ecx,%eax
+  80110c:	5b                   	pop    %ebx
+  80110d:	5e                   	pop    %esi
+  80110e:	5f                   	pop    %edi
+  80110f:	5d                   	pop    %ebp
+  801110:	c3                   	ret
+
+00801111 <atoi>:
+
+int
+atoi(const char* s)
+{
+  801111:	55                   	push   %ebp
+  801112:	89 e5                	mov    %esp,%ebp
+  801114:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  801117:	6a 00                	push   $0x0
+  801119:	6a 00                	push   $0x0
+  80111b:	ff 75 08             	push   0x8(%ebp)
+  80111e:	e8 12 ff ff ff       	call   801035 <strtol>
+}
+  801123:	c9                   	leave
+  801124:	c3                   	ret
+
+00801125 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  801125:	55                   	push   %ebp
+  801126:	89 e5                	mov    %esp,%ebp
+  801128:	57                   	push   %edi
+  801129:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80112a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80112f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801132:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801135:	89 c3                	mov    %eax,%ebx
+  801137:	89 c7                	mov    %eax,%edi
+  801139:	6a 00                	push   $0x0
+  80113b:	55                   	push   %ebp
+  80113c:	56                   	push   %esi
+  80113d:	89 e5                	mov    %esp,%ebp
+  80113f:	8d 35 47 11 80 00    	lea    0x801147,%esi
+  801145:	0f 34                	sysenter
+
+00801147 <after_sysenter_label_47>:
+  801147:	5e                   	pop    %esi
+  801148:	5d                   	pop    %ebp
+  801149:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  80114c:	5b                   	pop    %ebx
+  80114d:	5f                   	pop    %edi
+  80114e:	5d                   	pop    %ebp
+  80114f:	c3                   	ret
+
+00801150 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  801150:	55                   	push   %ebp
+  801151:	89 e5                	mov    %esp,%ebp
+  801153:	57                   	push   %edi
+  801154:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801155:	ba 00 00 00 00       	mov    $0x0,%edx
+  80115a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80115f:	89 d1                	mov    %edx,%ecx
+  801161:	89 d3                	mov    %edx,%ebx
+  801163:	89 d7                	mov    %edx,%edi
+  801165:	6a 00                	push   $0x0
+  801167:	55                   	push   %ebp
+  801168:	56                   	push   %esi
+  801169:	89 e5                	mov    %esp,%ebp
+  80116b:	8d 35 73 11 80 00    	lea    0x801173,%esi
+  801171:	0f 34                	sysenter
+
+00801173 <after_sysenter_label_128>:
+  801173:	5e                   	pop    %esi
+  801174:	5d                   	pop    %ebp
+  801175:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  801178:	5b                   	pop    %ebx
+  801179:	5f                   	pop    %edi
+  80117a:	5d                   	pop    %ebp
+  80117b:	c3                   	ret
+
+0080117c <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  80117c:	55                   	push   %ebp
+  80117d:	89 e5                	mov    %esp,%ebp
+  80117f:	57                   	push   %edi
+  801180:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801181:	8b 55 08             	mov    0x8(%ebp),%edx
+  801184:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801189:	b8 03 00 00 00       	mov    $0x3,%eax
+  80118e:	89 cb                	mov    %ecx,%ebx
+  801190:	89 cf                	mov    %ecx,%edi
+  801192:	6a 00                	push   $0x0
+  801194:	55                   	push   %ebp
+  801195:	56                   	push   %esi
+  801196:	89 e5                	mov    %esp,%ebp
+  801198:	8d 35 a0 11 80 00    	lea    0x8011a0,%esi
+  80119e:	0f 34                	sysenter
+
+008011a0 <after_sysenter_label_212>:
+  8011a0:	5e                   	pop    %esi
+  8011a1:	5d                   	pop    %ebp
+  8011a2:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8011a5:	85 c0                	test   %eax,%eax
+  8011a7:	7f 07                	jg     8011b0 <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  8011a9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8011ac:	5b                   	pop    %ebx
+  8011ad:	5f                   	pop    %edi
+  8011ae:	5d                   	pop    %ebp
+  8011af:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011b0:	83 ec 0c             	sub    $0xc,%esp
+  8011b3:	50                   	push   %eax
+  8011b4:	6a 03                	push   $0x3
+  8011b6:	68 95 54 80 00       	push   $0x805495
+  8011bb:	6a 54                	push   $0x54
+  8011bd:	68 b2 54 80 00       	push   $0x8054b2
+  8011c2:	e8 5b f5 ff ff       	call   800722 <_panic>
+
+008011c7 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  8011c7:	55                   	push   %ebp
+  8011c8:	89 e5                	mov    %esp,%ebp
+  8011ca:	57                   	push   %edi
+  8011cb:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8011cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011d1:	b8 02 00 00 00       	mov    $0x2,%eax
+  8011d6:	89 d1                	mov    %edx,%ecx
+  8011d8:	89 d3                	mov    %edx,%ebx
+  8011da:	89 d7                	mov    %edx,%edi
+  8011dc:	6a 00                	push   $0x0
+  8011de:	55                   	push   %ebp
+  8011df:	56                   	push   %esi
+  8011e0:	89 e5                	mov    %esp,%ebp
+  8011e2:	8d 35 ea 11 80 00    	lea    0x8011ea,%esi
+  8011e8:	0f 34                	sysenter
+
+008011ea <after_sysenter_label_309>:
+  8011ea:	5e                   	pop    %esi
+  8011eb:	5d                   	pop    %ebp
+  8011ec:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  8011ef:	5b                   	pop    %ebx
+  8011f0:	5f                   	pop    %edi
+  8011f1:	5d                   	pop    %ebp
+  8011f2:	c3                   	ret
+
+008011f3 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  8011f3:	55                   	push   %ebp
+  8011f4:	89 e5                	mov    %esp,%ebp
+  8011f6:	57                   	push   %edi
+  8011f7:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8011f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011fd:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801202:	89 d1                	mov    %edx,%ecx
+  801204:	89 d3                	mov    %edx,%ebx
+  801206:	89 d7                	mov    %edx,%edi
+  801208:	6a 00                	push   $0x0
+  80120a:	55                   	push   %ebp
+  80120b:	56                   	push   %esi
+  80120c:	89 e5                	mov    %esp,%ebp
+  80120e:	8d 35 16 12 80 00    	lea    0x801216,%esi
+  801214:	0f 34                	sysenter
+
+00801216 <after_sysenter_label_391>:
+  801216:	5e                   	pop    %esi
+  801217:	5d                   	pop    %ebp
+  801218:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  80121b:	5b                   	pop    %ebx
+  80121c:	5f                   	pop    %edi
+  80121d:	5d                   	pop    %ebp
+  80121e:	c3                   	ret
+
+0080121f <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  80121f:	55                   	push   %ebp
+  801220:	89 e5                	mov    %esp,%ebp
+  801222:	57                   	push   %edi
+  801223:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801224:	8b 55 08             	mov    0x8(%ebp),%edx
+  801227:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80122a:	b8 04 00 00 00       	mov    $0x4,%eax
+  80122f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801234:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801237:	6a 00                	push   $0x0
+  801239:	55                   	push   %ebp
+  80123a:	56                   	push   %esi
+  80123b:	89 e5                	mov    %esp,%ebp
+  80123d:	8d 35 45 12 80 00    	lea    0x801245,%esi
+  801243:	0f 34                	sysenter
+
+00801245 <after_sysenter_label_479>:
+  801245:	5e                   	pop    %esi
+  801246:	5d                   	pop    %ebp
+  801247:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80124a:	85 c0                	test   %eax,%eax
+  80124c:	7f 07                	jg     801255 <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  80124e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801251:	5b                   	pop    %ebx
+  801252:	5f                   	pop    %edi
+  801253:	5d                   	pop    %ebp
+  801254:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801255:	83 ec 0c             	sub    $0xc,%esp
+  801258:	50                   	push   %eax
+  801259:	6a 04                	push   $0x4
+  80125b:	68 95 54 80 00       	push   $0x805495
+  801260:	6a 54                	push   $0x54
+  801262:	68 b2 54 80 00       	push   $0x8054b2
+  801267:	e8 b6 f4 ff ff       	call   800722 <_panic>
+
+0080126c <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  80126c:	55                   	push   %ebp
+  80126d:	89 e5                	mov    %esp,%ebp
+  80126f:	57                   	push   %edi
+  801270:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801271:	8b 55 08             	mov    0x8(%ebp),%edx
+  801274:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801277:	b8 05 00 00 00       	mov    $0x5,%eax
+  80127c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80127f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801282:	ff 75 18             	push   0x18(%ebp)
+  801285:	55                   	push   %ebp
+  801286:	56                   	push   %esi
+  801287:	89 e5                	mov    %esp,%ebp
+  801289:	8d 35 91 12 80 00    	lea    0x801291,%esi
+  80128f:	0f 34                	sysenter
+
+00801291 <after_sysenter_label_593>:
+  801291:	5e                   	pop    %esi
+  801292:	5d                   	pop    %ebp
+  801293:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801296:	85 c0                	test   %eax,%eax
+  801298:	7f 07                	jg     8012a1 <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  80129a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80129d:	5b                   	pop    %ebx
+  80129e:	5f                   	pop    %edi
+  80129f:	5d                   	pop    %ebp
+  8012a0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012a1:	83 ec 0c             	sub    $0xc,%esp
+  8012a4:	50                   	push   %eax
+  8012a5:	6a 05                	push   $0x5
+  8012a7:	68 95 54 80 00       	push   $0x805495
+  8012ac:	6a 54                	push   $0x54
+  8012ae:	68 b2 54 80 00       	push   $0x8054b2
+  8012b3:	e8 6a f4 ff ff       	call   800722 <_panic>
+
+008012b8 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8012b8:	55                   	push   %ebp
+  8012b9:	89 e5                	mov    %esp,%ebp
+  8012bb:	57                   	push   %edi
+  8012bc:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8012bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012c8:	b8 06 00 00 00       	mov    $0x6,%eax
+  8012cd:	89 df                	mov    %ebx,%edi
+  8012cf:	6a 00                	push   $0x0
+  8012d1:	55                   	push   %ebp
+  8012d2:	56                   	push   %esi
+  8012d3:	89 e5                	mov    %esp,%ebp
+  8012d5:	8d 35 dd 12 80 00    	lea    0x8012dd,%esi
+  8012db:	0f 34                	sysenter
+
+008012dd <after_sysenter_label_704>:
+  8012dd:	5e                   	pop    %esi
+  8012de:	5d                   	pop    %ebp
+  8012df:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8012e2:	85 c0                	test   %eax,%eax
+  8012e4:	7f 07                	jg     8012ed <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  8012e6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8012e9:	5b                   	pop    %ebx
+  8012ea:	5f                   	pop    %edi
+  8012eb:	5d                   	pop    %ebp
+  8012ec:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012ed:	83 ec 0c             	sub    $0xc,%esp
+  8012f0:	50                   	push   %eax
+  8012f1:	6a 06                	push   $0x6
+  8012f3:	68 95 54 80 00       	push   $0x805495
+  8012f8:	6a 54                	push   $0x54
+  8012fa:	68 b2 54 80 00       	push   $0x8054b2
+  8012ff:	e8 1e f4 ff ff       	call   800722 <_panic>
+
+00801304 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801304:	55                   	push   %ebp
+  801305:	89 e5                	mov    %esp,%ebp
+  801307:	57                   	push   %edi
+  801308:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801309:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80130e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801311:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801314:	b8 08 00 00 00       	mov    $0x8,%eax
+  801319:	89 df                	mov    %ebx,%edi
+  80131b:	6a 00                	push   $0x0
+  80131d:	55                   	push   %ebp
+  80131e:	56                   	push   %esi
+  80131f:	89 e5                	mov    %esp,%ebp
+  801321:	8d 35 29 13 80 00    	lea    0x801329,%esi
+  801327:	0f 34                	sysenter
+
+00801329 <after_sysenter_label_808>:
+  801329:	5e                   	pop    %esi
+  80132a:	5d                   	pop    %ebp
+  80132b:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80132e:	85 c0                	test   %eax,%eax
+  801330:	7f 07                	jg     801339 <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801332:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801335:	5b                   	pop    %ebx
+  801336:	5f                   	pop    %edi
+  801337:	5d                   	pop    %ebp
+  801338:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801339:	83 ec 0c             	sub    $0xc,%esp
+  80133c:	50                   	push   %eax
+  80133d:	6a 08                	push   $0x8
+  80133f:	68 95 54 80 00       	push   $0x805495
+  801344:	6a 54                	push   $0x54
+  801346:	68 b2 54 80 00       	push   $0x8054b2
+  80134b:	e8 d2 f3 ff ff       	call   800722 <_panic>
+
+00801350 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801350:	55                   	push   %ebp
+  801351:	89 e5                	mov    %esp,%ebp
+  801353:	57                   	push   %edi
+  801354:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801355:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80135a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80135d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801360:	b8 09 00 00 00       	mov    $0x9,%eax
+  801365:	89 df                	mov    %ebx,%edi
+  801367:	6a 00                	push   $0x0
+  801369:	55                   	push   %ebp
+  80136a:	56                   	push   %esi
+  80136b:	89 e5                	mov    %esp,%ebp
+  80136d:	8d 35 75 13 80 00    	lea    0x801375,%esi
+  801373:	0f 34                	sysenter
+
+00801375 <after_sysenter_label_912>:
+  801375:	5e                   	pop    %esi
+  801376:	5d                   	pop    %ebp
+  801377:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80137a:	85 c0                	test   %eax,%eax
+  80137c:	7f 07                	jg     801385 <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  80137e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801381:	5b                   	pop    %ebx
+  801382:	5f                   	pop    %edi
+  801383:	5d                   	pop    %ebp
+  801384:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801385:	83 ec 0c             	sub    $0xc,%esp
+  801388:	50                   	push   %eax
+  801389:	6a 09                	push   $0x9
+  80138b:	68 95 54 80 00       	push   $0x805495
+  801390:	6a 54                	push   $0x54
+  801392:	68 b2 54 80 00       	push   $0x8054b2
+  801397:	e8 86 f3 ff ff       	call   800722 <_panic>
+
+0080139c <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80139c:	55                   	push   %ebp
+  80139d:	89 e5                	mov    %esp,%ebp
+  80139f:	57                   	push   %edi
+  8013a0:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8013a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013a9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013ac:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8013b1:	89 df                	mov    %ebx,%edi
+  8013b3:	6a 00                	push   $0x0
+  8013b5:	55                   	push   %ebp
+  8013b6:	56                   	push   %esi
+  8013b7:	89 e5                	mov    %esp,%ebp
+  8013b9:	8d 35 c1 13 80 00    	lea    0x8013c1,%esi
+  8013bf:	0f 34                	sysenter
+
+008013c1 <after_sysenter_label_1016>:
+  8013c1:	5e                   	pop    %esi
+  8013c2:	5d                   	pop    %ebp
+  8013c3:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8013c6:	85 c0                	test   %eax,%eax
+  8013c8:	7f 07                	jg     8013d1 <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8013ca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013cd:	5b                   	pop    %ebx
+  8013ce:	5f                   	pop    %edi
+  8013cf:	5d                   	pop    %ebp
+  8013d0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013d1:	83 ec 0c             	sub    $0xc,%esp
+  8013d4:	50                   	push   %eax
+  8013d5:	6a 0a                	push   $0xa
+  8013d7:	68 95 54 80 00       	push   $0x805495
+  8013dc:	6a 54                	push   $0x54
+  8013de:	68 b2 54 80 00       	push   $0x8054b2
+  8013e3:	e8 3a f3 ff ff       	call   800722 <_panic>
+
+008013e8 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8013e8:	55                   	push   %ebp
+  8013e9:	89 e5                	mov    %esp,%ebp
+  8013eb:	57                   	push   %edi
+  8013ec:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8013ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013f0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013f3:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8013f8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013fb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013fe:	6a 00                	push   $0x0
+  801400:	55                   	push   %ebp
+  801401:	56                   	push   %esi
+  801402:	89 e5                	mov    %esp,%ebp
+  801404:	8d 35 0c 14 80 00    	lea    0x80140c,%esi
+  80140a:	0f 34                	sysenter
+
+0080140c <after_sysenter_label_1126>:
+  80140c:	5e                   	pop    %esi
+  80140d:	5d                   	pop    %ebp
+  80140e:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801411:	5b                   	pop    %ebx
+  801412:	5f                   	pop    %edi
+  801413:	5d                   	pop    %ebp
+  801414:	c3                   	ret
+
+00801415 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801415:	55                   	push   %ebp
+  801416:	89 e5                	mov    %esp,%ebp
+  801418:	57                   	push   %edi
+  801419:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80141a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80141d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801422:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801427:	89 cb                	mov    %ecx,%ebx
+  801429:	89 cf                	mov    %ecx,%edi
+  80142b:	6a 00                	push   $0x0
+  80142d:	55                   	push   %ebp
+  80142e:	56                   	push   %esi
+  80142f:	89 e5                	mov    %esp,%ebp
+  801431:	8d 35 39 14 80 00    	lea    0x801439,%esi
+  801437:	0f 34                	sysenter
+
+00801439 <after_sysenter_label_1210>:
+  801439:	5e                   	pop    %esi
+  80143a:	5d                   	pop    %ebp
+  80143b:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80143e:	85 c0                	test   %eax,%eax
+  801440:	7f 07                	jg     801449 <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801442:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801445:	5b                   	pop    %ebx
+  801446:	5f                   	pop    %edi
+  801447:	5d                   	pop    %ebp
+  801448:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801449:	83 ec 0c             	sub    $0xc,%esp
+  80144c:	50                   	push   %eax
+  80144d:	6a 0d                	push   $0xd
+  80144f:	68 95 54 80 00       	push   $0x805495
+  801454:	6a 54                	push   $0x54
+  801456:	68 b2 54 80 00       	push   $0x8054b2
+  80145b:	e8 c2 f2 ff ff       	call   800722 <_panic>
+
+00801460 <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  801460:	55                   	push   %ebp
+  801461:	89 e5                	mov    %esp,%ebp
+  801463:	57                   	push   %edi
+  801464:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801465:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80146a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80146d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801470:	b8 42 00 00 00       	mov    $0x42,%eax
+  801475:	89 df                	mov    %ebx,%edi
+  801477:	6a 00                	push   $0x0
+  801479:	55                   	push   %ebp
+  80147a:	56                   	push   %esi
+  80147b:	89 e5                	mov    %esp,%ebp
+  80147d:	8d 35 85 14 80 00    	lea    0x801485,%esi
+  801483:	0f 34                	sysenter
+
+00801485 <after_sysenter_label_1311>:
+  801485:	5e                   	pop    %esi
+  801486:	5d                   	pop    %ebp
+  801487:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80148a:	85 c0                	test   %eax,%eax
+  80148c:	7f 07                	jg     801495 <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  80148e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801491:	5b                   	pop    %ebx
+  801492:	5f                   	pop    %edi
+  801493:	5d                   	pop    %ebp
+  801494:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801495:	83 ec 0c             	sub    $0xc,%esp
+  801498:	50                   	push   %eax
+  801499:	6a 42                	push   $0x42
+  80149b:	68 95 54 80 00       	push   $0x805495
+  8014a0:	6a 54                	push   $0x54
+  8014a2:	68 b2 54 80 00       	push   $0x8054b2
+  8014a7:	e8 76 f2 ff ff       	call   800722 <_panic>
+
+008014ac <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8014ac:	55                   	push   %ebp
+  8014ad:	89 e5                	mov    %esp,%ebp
+  8014af:	57                   	push   %edi
+  8014b0:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8014b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014b6:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8014bb:	89 d1                	mov    %edx,%ecx
+  8014bd:	89 d3                	mov    %edx,%ebx
+  8014bf:	89 d7                	mov    %edx,%edi
+  8014c1:	6a 00                	push   $0x0
+  8014c3:	55                   	push   %ebp
+  8014c4:	56                   	push   %esi
+  8014c5:	89 e5                	mov    %esp,%ebp
+  8014c7:	8d 35 cf 14 80 00    	lea    0x8014cf,%esi
+  8014cd:	0f 34                	sysenter
+
+008014cf <after_sysenter_label_1411>:
+  8014cf:	5e                   	pop    %esi
+  8014d0:	5d                   	pop    %ebp
+  8014d1:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8014d4:	5b                   	pop    %ebx
+  8014d5:	5f                   	pop    %edi
+  8014d6:	5d                   	pop    %ebp
+  8014d7:	c3                   	ret
+
+008014d8 <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  8014d8:	55                   	push   %ebp
+  8014d9:	89 e5                	mov    %esp,%ebp
+  8014db:	57                   	push   %edi
+  8014dc:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8014dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014e5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014e8:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8014ed:	89 df                	mov    %ebx,%edi
+  8014ef:	6a 00                	push   $0x0
+  8014f1:	55                   	push   %ebp
+  8014f2:	56                   	push   %esi
+  8014f3:	89 e5                	mov    %esp,%ebp
+  8014f5:	8d 35 fd 14 80 00    	lea    0x8014fd,%esi
+  8014fb:	0f 34                	sysenter
+
+008014fd <after_sysenter_label_1497>:
+  8014fd:	5e                   	pop    %esi
+  8014fe:	5d                   	pop    %ebp
+  8014ff:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  801502:	5b                   	pop    %ebx
+  801503:	5f                   	pop    %edi
+  801504:	5d                   	pop    %ebp
+  801505:	c3                   	ret
+
+00801506 <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  801506:	55                   	push   %ebp
+  801507:	89 e5                	mov    %esp,%ebp
+  801509:	57                   	push   %edi
+  80150a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80150b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801510:	8b 55 08             	mov    0x8(%ebp),%edx
+  801513:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801516:	b8 10 00 00 00       	mov    $0x10,%eax
+  80151b:	89 df                	mov    %ebx,%edi
+  80151d:	6a 00                	push   $0x0
+  80151f:	55                   	push   %ebp
+  801520:	56                   	push   %esi
+  801521:	89 e5                	mov    %esp,%ebp
+  801523:	8d 35 2b 15 80 00    	lea    0x80152b,%esi
+  801529:	0f 34                	sysenter
+
+0080152b <after_sysenter_label_1583>:
+  80152b:	5e                   	pop    %esi
+  80152c:	5d                   	pop    %ebp
+  80152d:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  801530:	5b                   	pop    %ebx
+  801531:	5f                   	pop    %edi
+  801532:	5d                   	pop    %ebp
+  801533:	c3                   	ret
+
+00801534 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  801534:	55                   	push   %ebp
+  801535:	89 e5                	mov    %esp,%ebp
+  801537:	57                   	push   %edi
+  801538:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801539:	8b 55 08             	mov    0x8(%ebp),%edx
+  80153c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80153f:	b8 11 00 00 00       	mov    $0x11,%eax
+  801544:	bf 00 00 00 00       	mov    $0x0,%edi
+  801549:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80154c:	6a 00                	push   $0x0
+  80154e:	55                   	push   %ebp
+  80154f:	56                   	push   %esi
+  801550:	89 e5                	mov    %esp,%ebp
+  801552:	8d 35 5a 15 80 00    	lea    0x80155a,%esi
+  801558:	0f 34                	sysenter
+
+0080155a <after_sysenter_label_1672>:
+  80155a:	5e                   	pop    %esi
+  80155b:	5d                   	pop    %ebp
+  80155c:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  80155f:	5b                   	pop    %ebx
+  801560:	5f                   	pop    %edi
+  801561:	5d                   	pop    %ebp
+  801562:	c3                   	ret
+
+00801563 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  801563:	55                   	push   %ebp
+  801564:	89 e5                	mov    %esp,%ebp
+  801566:	57                   	push   %edi
+  801567:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801568:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80156d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801570:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801573:	b8 12 00 00 00       	mov    $0x12,%eax
+  801578:	89 df                	mov    %ebx,%edi
+  80157a:	6a 00                	push   $0x0
+  80157c:	55                   	push   %ebp
+  80157d:	56                   	push   %esi
+  80157e:	89 e5                	mov    %esp,%ebp
+  801580:	8d 35 88 15 80 00    	lea    0x801588,%esi
+  801586:	0f 34                	sysenter
+
+00801588 <after_sysenter_label_1758>:
+  801588:	5e                   	pop    %esi
+  801589:	5d                   	pop    %ebp
+  80158a:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  80158d:	5b                   	pop    %ebx
+  80158e:	5f                   	pop    %edi
+  80158f:	5d                   	pop    %ebp
+  801590:	c3                   	ret
+
+00801591 <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  801591:	55                   	push   %ebp
+  801592:	89 e5                	mov    %esp,%ebp
+  801594:	57                   	push   %edi
+  801595:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801596:	8b 55 08             	mov    0x8(%ebp),%edx
+  801599:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80159e:	b8 13 00 00 00       	mov    $0x13,%eax
+  8015a3:	89 cb                	mov    %ecx,%ebx
+  8015a5:	89 cf                	mov    %ecx,%edi
+  8015a7:	6a 00                	push   $0x0
+  8015a9:	55                   	push   %ebp
+  8015aa:	56                   	push   %esi
+  8015ab:	89 e5                	mov    %esp,%ebp
+  8015ad:	8d 35 b5 15 80 00    	lea    0x8015b5,%esi
+  8015b3:	0f 34                	sysenter
+
+008015b5 <after_sysenter_label_1842>:
+  8015b5:	5e                   	pop    %esi
+  8015b6:	5d                   	pop    %ebp
+  8015b7:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8015ba:	85 c0                	test   %eax,%eax
+  8015bc:	7f 07                	jg     8015c5 <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  8015be:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015c1:	5b                   	pop    %ebx
+  8015c2:	5f                   	pop    %edi
+  8015c3:	5d                   	pop    %ebp
+  8015c4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015c5:	83 ec 0c             	sub    $0xc,%esp
+  8015c8:	50                   	push   %eax
+  8015c9:	6a 13                	push   $0x13
+  8015cb:	68 95 54 80 00       	push   $0x805495
+  8015d0:	6a 54                	push   $0x54
+  8015d2:	68 b2 54 80 00       	push   $0x8054b2
+  8015d7:	e8 46 f1 ff ff       	call   800722 <_panic>
+
+008015dc <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  8015dc:	55                   	push   %ebp
+  8015dd:	89 e5                	mov    %esp,%ebp
+  8015df:	57                   	push   %edi
+  8015e0:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8015e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015e6:	b8 14 00 00 00       	mov    $0x14,%eax
+  8015eb:	89 d1                	mov    %edx,%ecx
+  8015ed:	89 d3                	mov    %edx,%ebx
+  8015ef:	89 d7                	mov    %edx,%edi
+  8015f1:	6a 00                	push   $0x0
+  8015f3:	55                   	push   %ebp
+  8015f4:	56                   	push   %esi
+  8015f5:	89 e5                	mov    %esp,%ebp
+  8015f7:	8d 35 ff 15 80 00    	lea    0x8015ff,%esi
+  8015fd:	0f 34                	sysenter
+
+008015ff <after_sysenter_label_1939>:
+  8015ff:	5e                   	pop    %esi
+  801600:	5d                   	pop    %ebp
+  801601:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  801604:	5b                   	pop    %ebx
+  801605:	5f                   	pop    %edi
+  801606:	5d                   	pop    %ebp
+  801607:	c3                   	ret
+
+00801608 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  801608:	55                   	push   %ebp
+  801609:	89 e5                	mov    %esp,%ebp
+  80160b:	57                   	push   %edi
+  80160c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80160d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801610:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801613:	b8 15 00 00 00       	mov    $0x15,%eax
+  801618:	bf 00 00 00 00       	mov    $0x0,%edi
+  80161d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801620:	6a 00                	push   $0x0
+  801622:	55                   	push   %ebp
+  801623:	56                   	push   %esi
+  801624:	89 e5                	mov    %esp,%ebp
+  801626:	8d 35 2e 16 80 00    	lea    0x80162e,%esi
+  80162c:	0f 34                	sysenter
+
+0080162e <after_sysenter_label_2028>:
+  80162e:	5e                   	pop    %esi
+  80162f:	5d                   	pop    %ebp
+  801630:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  801633:	5b                   	pop    %ebx
+  801634:	5f                   	pop    %edi
+  801635:	5d                   	pop    %ebp
+  801636:	c3                   	ret
+
+00801637 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  801637:	55                   	push   %ebp
+  801638:	89 e5                	mov    %esp,%ebp
+  80163a:	57                   	push   %edi
+  80163b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80163c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801641:	8b 55 08             	mov    0x8(%ebp),%edx
+  801644:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801647:	b8 16 00 00 00       	mov    $0x16,%eax
+  80164c:	89 df                	mov    %ebx,%edi
+  80164e:	6a 00                	push   $0x0
+  801650:	55                   	push   %ebp
+  801651:	56                   	push   %esi
+  801652:	89 e5                	mov    %esp,%ebp
+  801654:	8d 35 5c 16 80 00    	lea    0x80165c,%esi
+  80165a:	0f 34                	sysenter
+
+0080165c <after_sysenter_label_2114>:
+  80165c:	5e                   	pop    %esi
+  80165d:	5d                   	pop    %ebp
+  80165e:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  801661:	5b                   	pop    %ebx
+  801662:	5f                   	pop    %edi
+  801663:	5d                   	pop    %ebp
+  801664:	c3                   	ret
+
+00801665 <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  801665:	55                   	push   %ebp
+  801666:	89 e5                	mov    %esp,%ebp
+  801668:	57                   	push   %edi
+  801669:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80166a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80166f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801672:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801675:	b8 17 00 00 00       	mov    $0x17,%eax
+  80167a:	89 df                	mov    %ebx,%edi
+  80167c:	6a 00                	push   $0x0
+  80167e:	55                   	push   %ebp
+  80167f:	56                   	push   %esi
+  801680:	89 e5                	mov    %esp,%ebp
+  801682:	8d 35 8a 16 80 00    	lea    0x80168a,%esi
+  801688:	0f 34                	sysenter
+
+0080168a <after_sysenter_label_2200>:
+  80168a:	5e                   	pop    %esi
+  80168b:	5d                   	pop    %ebp
+  80168c:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  80168f:	5b                   	pop    %ebx
+  801690:	5f                   	pop    %edi
+  801691:	5d                   	pop    %ebp
+  801692:	c3                   	ret
+
+00801693 <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  801693:	55                   	push   %ebp
+  801694:	89 e5                	mov    %esp,%ebp
+  801696:	57                   	push   %edi
+  801697:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801698:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80169d:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016a0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016a3:	b8 18 00 00 00       	mov    $0x18,%eax
+  8016a8:	89 df                	mov    %ebx,%edi
+  8016aa:	6a 00                	push   $0x0
+  8016ac:	55                   	push   %ebp
+  8016ad:	56                   	push   %esi
+  8016ae:	89 e5                	mov    %esp,%ebp
+  8016b0:	8d 35 b8 16 80 00    	lea    0x8016b8,%esi
+  8016b6:	0f 34                	sysenter
+
+008016b8 <after_sysenter_label_2286>:
+  8016b8:	5e                   	pop    %esi
+  8016b9:	5d                   	pop    %ebp
+  8016ba:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  8016bd:	5b                   	pop    %ebx
+  8016be:	5f                   	pop    %edi
+  8016bf:	5d                   	pop    %ebp
+  8016c0:	c3                   	ret
+
+008016c1 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8016c1:	55                   	push   %ebp
+  8016c2:	89 e5                	mov    %esp,%ebp
+  8016c4:	57                   	push   %edi
+  8016c5:	56                   	push   %esi
+  8016c6:	53                   	push   %ebx
+  8016c7:	83 ec 18             	sub    $0x18,%esp
+  8016ca:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8016cd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8016d0:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  8016d3:	85 c0                	test   %eax,%eax
+  8016d5:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8016da:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  8016dd:	50                   	push   %eax
+  8016de:	e8 32 fd ff ff       	call   801415 <sys_ipc_recv>
+	if (r < 0) {
+  8016e3:	83 c4 10             	add    $0x10,%esp
+  8016e6:	85 c0                	test   %eax,%eax
+  8016e8:	78 2b                	js     801715 <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  8016ea:	85 ff                	test   %edi,%edi
+  8016ec:	74 55                	je     801743 <ipc_recv+0x82>
+  8016ee:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8016f0:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8016f6:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8016fb:	77 39                	ja     801736 <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8016fd:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801702:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801704:	c1 e8 10             	shr    $0x10,%eax
+  801707:	74 2d                	je     801736 <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801709:	c1 e0 10             	shl    $0x10,%eax
+  80170c:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801711:	29 c2                	sub    %eax,%edx
+  801713:	eb 27                	jmp    80173c <ipc_recv+0x7b>
+  801715:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  801717:	83 ec 08             	sub    $0x8,%esp
+  80171a:	50                   	push   %eax
+  80171b:	68 c0 54 80 00       	push   $0x8054c0
+  801720:	e8 d8 f0 ff ff       	call   8007fd <cprintf>
+		*from_env_store = 0;
+  801725:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  80172b:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  801731:	83 c4 10             	add    $0x10,%esp
+  801734:	eb 77                	jmp    8017ad <ipc_recv+0xec>
+		return pthread_main_tls;
+  801736:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  80173c:	8b 02                	mov    (%edx),%eax
+  80173e:	8b 40 78             	mov    0x78(%eax),%eax
+  801741:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  801743:	85 f6                	test   %esi,%esi
+  801745:	74 34                	je     80177b <ipc_recv+0xba>
+  801747:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801749:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80174f:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801754:	77 18                	ja     80176e <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801756:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80175b:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80175d:	c1 e8 10             	shr    $0x10,%eax
+  801760:	74 0c                	je     80176e <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801762:	c1 e0 10             	shl    $0x10,%eax
+  801765:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80176a:	29 c2                	sub    %eax,%edx
+  80176c:	eb 06                	jmp    801774 <ipc_recv+0xb3>
+		return pthread_main_tls;
+  80176e:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  801774:	8b 02                	mov    (%edx),%eax
+  801776:	8b 40 7c             	mov    0x7c(%eax),%eax
+  801779:	89 06                	mov    %eax,(%esi)
+  80177b:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80177d:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801783:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801788:	77 18                	ja     8017a2 <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80178a:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80178f:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801791:	c1 e8 10             	shr    $0x10,%eax
+  801794:	74 0c                	je     8017a2 <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801796:	c1 e0 10             	shl    $0x10,%eax
+  801799:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80179e:	29 c2                	sub    %eax,%edx
+  8017a0:	eb 06                	jmp    8017a8 <ipc_recv+0xe7>
+		return pthread_main_tls;
+  8017a2:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+	}
+	return thisenv->env_ipc_value;
+  8017a8:	8b 02                	mov    (%edx),%eax
+  8017aa:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  8017ad:	89 d8                	mov    %ebx,%eax
+  8017af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017b2:	5b                   	pop    %ebx
+  8017b3:	5e                   	pop    %esi
+  8017b4:	5f                   	pop    %edi
+  8017b5:	5d                   	pop    %ebp
+  8017b6:	c3                   	ret
+
+008017b7 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8017b7:	55                   	push   %ebp
+  8017b8:	89 e5                	mov    %esp,%ebp
+  8017ba:	57                   	push   %edi
+  8017bb:	56                   	push   %esi
+  8017bc:	53                   	push   %ebx
+  8017bd:	83 ec 0c             	sub    $0xc,%esp
+  8017c0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8017c3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8017c6:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  8017c9:	85 db                	test   %ebx,%ebx
+  8017cb:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8017d0:	0f 44 d8             	cmove  %eax,%ebx
+  8017d3:	eb 05                	jmp    8017da <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  8017d5:	e8 19 fa ff ff       	call   8011f3 <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  8017da:	57                   	push   %edi
+  8017db:	53                   	push   %ebx
+  8017dc:	ff 75 0c             	push   0xc(%ebp)
+  8017df:	56                   	push   %esi
+  8017e0:	e8 03 fc ff ff       	call   8013e8 <sys_ipc_try_send>
+		if (r == 0) {
+  8017e5:	83 c4 10             	add    $0x10,%esp
+  8017e8:	85 c0                	test   %eax,%eax
+  8017ea:	74 19                	je     801805 <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  8017ec:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8017ef:	74 e4                	je     8017d5 <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  8017f1:	83 ec 0c             	sub    $0xc,%esp
+  8017f4:	50                   	push   %eax
+  8017f5:	57                   	push   %edi
+  8017f6:	53                   	push   %ebx
+  8017f7:	56                   	push   %esi
+  8017f8:	68 dc 54 80 00       	push   $0x8054dc
+  8017fd:	e8 fb ef ff ff       	call   8007fd <cprintf>
+			return;
+  801802:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  801805:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801808:	5b                   	pop    %ebx
+  801809:	5e                   	pop    %esi
+  80180a:	5f                   	pop    %edi
+  80180b:	5d                   	pop    %ebp
+  80180c:	c3                   	ret
+
+0080180d <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80180d:	55                   	push   %ebp
+  80180e:	89 e5                	mov    %esp,%ebp
+  801810:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  801813:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  801818:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80181b:	c1 e0 04             	shl    $0x4,%eax
+  80181e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801823:	8b 40 50             	mov    0x50(%eax),%eax
+  801826:	39 c8                	cmp    %ecx,%eax
+  801828:	74 12                	je     80183c <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80182a:	83 c2 01             	add    $0x1,%edx
+  80182d:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  801833:	75 e3                	jne    801818 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  801835:	b8 00 00 00 00       	mov    $0x0,%eax
+  80183a:	eb 0e                	jmp    80184a <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80183c:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80183f:	c1 e0 04             	shl    $0x4,%eax
+  801842:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801847:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80184a:	5d                   	pop    %ebp
+  80184b:	c3                   	ret
+
+0080184c <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80184c:	55                   	push   %ebp
+  80184d:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80184f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801852:	05 00 00 00 30       	add    $0x30000000,%eax
+  801857:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80185a:	5d                   	pop    %ebp
+  80185b:	c3                   	ret
+
+0080185c <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80185c:	55                   	push   %ebp
+  80185d:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80185f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801862:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801867:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80186c:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801871:	5d                   	pop    %ebp
+  801872:	c3                   	ret
+
+00801873 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801873:	55                   	push   %ebp
+  801874:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801876:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80187b:	eb 02                	jmp    80187f <fd_alloc+0xc>
+  80187d:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80187f:	89 c2                	mov    %eax,%edx
+  801881:	c1 ea 16             	shr    $0x16,%edx
+  801884:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80188b:	f6 c2 01             	test   $0x1,%dl
+  80188e:	74 2b                	je     8018bb <fd_alloc+0x48>
+  801890:	89 c2                	mov    %eax,%edx
+  801892:	c1 ea 0c             	shr    $0xc,%edx
+  801895:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80189c:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8018a2:	f6 c1 01             	test   $0x1,%cl
+  8018a5:	74 14                	je     8018bb <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8018a7:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8018ad:	75 ce                	jne    80187d <fd_alloc+0xa>
+  8018af:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8018b4:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8018b9:	eb 05                	jmp    8018c0 <fd_alloc+0x4d>
+			return 0;
+  8018bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8018c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018c3:	89 02                	mov    %eax,(%edx)
+}
+  8018c5:	89 c8                	mov    %ecx,%eax
+  8018c7:	5d                   	pop    %ebp
+  8018c8:	c3                   	ret
+
+008018c9 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8018c9:	55                   	push   %ebp
+  8018ca:	89 e5                	mov    %esp,%ebp
+  8018cc:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8018cf:	83 f8 1f             	cmp    $0x1f,%eax
+  8018d2:	77 30                	ja     801904 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8018d4:	c1 e0 0c             	shl    $0xc,%eax
+  8018d7:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8018dc:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8018e2:	f6 c2 01             	test   $0x1,%dl
+  8018e5:	74 24                	je     80190b <fd_lookup+0x42>
+  8018e7:	89 c2                	mov    %eax,%edx
+  8018e9:	c1 ea 0c             	shr    $0xc,%edx
+  8018ec:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8018f3:	f6 c2 01             	test   $0x1,%dl
+  8018f6:	74 1a                	je     801912 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8018f8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8018fb:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8018fd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801902:	5d                   	pop    %ebp
+  801903:	c3                   	ret
+		return -E_INVAL;
+  801904:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801909:	eb f7                	jmp    801902 <fd_lookup+0x39>
+		return -E_INVAL;
+  80190b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801910:	eb f0                	jmp    801902 <fd_lookup+0x39>
+  801912:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801917:	eb e9                	jmp    801902 <fd_lookup+0x39>
+
+00801919 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801919:	55                   	push   %ebp
+  80191a:	89 e5                	mov    %esp,%ebp
+  80191c:	53                   	push   %ebx
+  80191d:	83 ec 04             	sub    $0x4,%esp
+  801920:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801923:	b8 00 00 00 00       	mov    $0x0,%eax
+  801928:	eb 03                	jmp    80192d <dev_lookup+0x14>
+  80192a:	83 c0 01             	add    $0x1,%eax
+  80192d:	8b 1c 85 90 55 80 00 	mov    0x805590(,%eax,4),%ebx
+  801934:	85 db                	test   %ebx,%ebx
+  801936:	74 0b                	je     801943 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801938:	39 13                	cmp    %edx,(%ebx)
+  80193a:	75 ee                	jne    80192a <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80193c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801941:	eb 49                	jmp    80198c <dev_lookup+0x73>
+  801943:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801945:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  80194b:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801950:	77 18                	ja     80196a <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801952:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801957:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  801959:	c1 e8 10             	shr    $0x10,%eax
+  80195c:	74 0c                	je     80196a <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80195e:	c1 e0 10             	shl    $0x10,%eax
+  801961:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  801966:	29 c1                	sub    %eax,%ecx
+  801968:	eb 06                	jmp    801970 <dev_lookup+0x57>
+		return pthread_main_tls;
+  80196a:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801970:	8b 01                	mov    (%ecx),%eax
+  801972:	8b 40 48             	mov    0x48(%eax),%eax
+  801975:	83 ec 04             	sub    $0x4,%esp
+  801978:	52                   	push   %edx
+  801979:	50                   	push   %eax
+  80197a:	68 14 55 80 00       	push   $0x805514
+  80197f:	e8 79 ee ff ff       	call   8007fd <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801984:	83 c4 10             	add    $0x10,%esp
+  801987:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80198c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80198f:	89 1a                	mov    %ebx,(%edx)
+}
+  801991:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801994:	c9                   	leave
+  801995:	c3                   	ret
+
+00801996 <fd_close>:
+{
+  801996:	55                   	push   %ebp
+  801997:	89 e5                	mov    %esp,%ebp
+  801999:	57                   	push   %edi
+  80199a:	56                   	push   %esi
+  80199b:	53                   	push   %ebx
+  80199c:	83 ec 24             	sub    $0x24,%esp
+  80199f:	8b 75 08             	mov    0x8(%ebp),%esi
+  8019a2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8019a5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8019a8:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8019a9:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8019af:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8019b2:	50                   	push   %eax
+  8019b3:	e8 11 ff ff ff       	call   8018c9 <fd_lookup>
+  8019b8:	89 c3                	mov    %eax,%ebx
+  8019ba:	83 c4 10             	add    $0x10,%esp
+  8019bd:	85 c0                	test   %eax,%eax
+  8019bf:	78 05                	js     8019c6 <fd_close+0x30>
+	    || fd != fd2)
+  8019c1:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8019c4:	74 16                	je     8019dc <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8019c6:	89 f8                	mov    %edi,%eax
+  8019c8:	84 c0                	test   %al,%al
+  8019ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019cf:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8019d2:	89 d8                	mov    %ebx,%eax
+  8019d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019d7:	5b                   	pop    %ebx
+  8019d8:	5e                   	pop    %esi
+  8019d9:	5f                   	pop    %edi
+  8019da:	5d                   	pop    %ebp
+  8019db:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8019dc:	83 ec 08             	sub    $0x8,%esp
+  8019df:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8019e2:	50                   	push   %eax
+  8019e3:	ff 36                	push   (%esi)
+  8019e5:	e8 2f ff ff ff       	call   801919 <dev_lookup>
+  8019ea:	89 c3                	mov    %eax,%ebx
+  8019ec:	83 c4 10             	add    $0x10,%esp
+  8019ef:	85 c0                	test   %eax,%eax
+  8019f1:	78 1a                	js     801a0d <fd_close+0x77>
+		if (dev->dev_close)
+  8019f3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8019f6:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8019f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8019fe:	85 c0                	test   %eax,%eax
+  801a00:	74 0b                	je     801a0d <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801a02:	83 ec 0c             	sub    $0xc,%esp
+  801a05:	56                   	push   %esi
+  801a06:	ff d0                	call   *%eax
+  801a08:	89 c3                	mov    %eax,%ebx
+  801a0a:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801a0d:	83 ec 08             	sub    $0x8,%esp
+  801a10:	56                   	push   %esi
+  801a11:	6a 00                	push   $0x0
+  801a13:	e8 a0 f8 ff ff       	call   8012b8 <sys_page_unmap>
+	return r;
+  801a18:	83 c4 10             	add    $0x10,%esp
+  801a1b:	eb b5                	jmp    8019d2 <fd_close+0x3c>
+
+00801a1d <close>:
+
+int
+close(int fdnum)
+{
+  801a1d:	55                   	push   %ebp
+  801a1e:	89 e5                	mov    %esp,%ebp
+  801a20:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801a23:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a26:	50                   	push   %eax
+  801a27:	ff 75 08             	push   0x8(%ebp)
+  801a2a:	e8 9a fe ff ff       	call   8018c9 <fd_lookup>
+  801a2f:	83 c4 10             	add    $0x10,%esp
+  801a32:	85 c0                	test   %eax,%eax
+  801a34:	79 02                	jns    801a38 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801a36:	c9                   	leave
+  801a37:	c3                   	ret
+		return fd_close(fd, 1);
+  801a38:	83 ec 08             	sub    $0x8,%esp
+  801a3b:	6a 01                	push   $0x1
+  801a3d:	ff 75 f4             	push   -0xc(%ebp)
+  801a40:	e8 51 ff ff ff       	call   801996 <fd_close>
+  801a45:	83 c4 10             	add    $0x10,%esp
+  801a48:	eb ec                	jmp    801a36 <close+0x19>
+
+00801a4a <close_all>:
+
+void
+close_all(void)
+{
+  801a4a:	55                   	push   %ebp
+  801a4b:	89 e5                	mov    %esp,%ebp
+  801a4d:	53                   	push   %ebx
+  801a4e:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801a51:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801a56:	83 ec 0c             	sub    $0xc,%esp
+  801a59:	53                   	push   %ebx
+  801a5a:	e8 be ff ff ff       	call   801a1d <close>
+	for (i = 0; i < MAXFD; i++)
+  801a5f:	83 c3 01             	add    $0x1,%ebx
+  801a62:	83 c4 10             	add    $0x10,%esp
+  801a65:	83 fb 20             	cmp    $0x20,%ebx
+  801a68:	75 ec                	jne    801a56 <close_all+0xc>
+}
+  801a6a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a6d:	c9                   	leave
+  801a6e:	c3                   	ret
+
+00801a6f <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801a6f:	55                   	push   %ebp
+  801a70:	89 e5                	mov    %esp,%ebp
+  801a72:	57                   	push   %edi
+  801a73:	56                   	push   %esi
+  801a74:	53                   	push   %ebx
+  801a75:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801a78:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801a7b:	50                   	push   %eax
+  801a7c:	ff 75 08             	push   0x8(%ebp)
+  801a7f:	e8 45 fe ff ff       	call   8018c9 <fd_lookup>
+  801a84:	89 c3                	mov    %eax,%ebx
+  801a86:	83 c4 10             	add    $0x10,%esp
+  801a89:	85 c0                	test   %eax,%eax
+  801a8b:	78 7f                	js     801b0c <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801a8d:	83 ec 0c             	sub    $0xc,%esp
+  801a90:	ff 75 0c             	push   0xc(%ebp)
+  801a93:	e8 85 ff ff ff       	call   801a1d <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801a98:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801a9b:	c1 e6 0c             	shl    $0xc,%esi
+  801a9e:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801aa4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801aa7:	89 3c 24             	mov    %edi,(%esp)
+  801aaa:	e8 ad fd ff ff       	call   80185c <fd2data>
+  801aaf:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801ab1:	89 34 24             	mov    %esi,(%esp)
+  801ab4:	e8 a3 fd ff ff       	call   80185c <fd2data>
+  801ab9:	83 c4 10             	add    $0x10,%esp
+  801abc:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801abf:	89 d8                	mov    %ebx,%eax
+  801ac1:	c1 e8 16             	shr    $0x16,%eax
+  801ac4:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801acb:	a8 01                	test   $0x1,%al
+  801acd:	74 11                	je     801ae0 <dup+0x71>
+  801acf:	89 d8                	mov    %ebx,%eax
+  801ad1:	c1 e8 0c             	shr    $0xc,%eax
+  801ad4:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801adb:	f6 c2 01             	test   $0x1,%dl
+  801ade:	75 36                	jne    801b16 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801ae0:	89 f8                	mov    %edi,%eax
+  801ae2:	c1 e8 0c             	shr    $0xc,%eax
+  801ae5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801aec:	83 ec 0c             	sub    $0xc,%esp
+  801aef:	25 07 0e 00 00       	and    $0xe07,%eax
+  801af4:	50                   	push   %eax
+  801af5:	56                   	push   %esi
+  801af6:	6a 00                	push   $0x0
+  801af8:	57                   	push   %edi
+  801af9:	6a 00                	push   $0x0
+  801afb:	e8 6c f7 ff ff       	call   80126c <sys_page_map>
+  801b00:	89 c3                	mov    %eax,%ebx
+  801b02:	83 c4 20             	add    $0x20,%esp
+  801b05:	85 c0                	test   %eax,%eax
+  801b07:	78 33                	js     801b3c <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801b09:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801b0c:	89 d8                	mov    %ebx,%eax
+  801b0e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b11:	5b                   	pop    %ebx
+  801b12:	5e                   	pop    %esi
+  801b13:	5f                   	pop    %edi
+  801b14:	5d                   	pop    %ebp
+  801b15:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801b16:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801b1d:	83 ec 0c             	sub    $0xc,%esp
+  801b20:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b25:	50                   	push   %eax
+  801b26:	ff 75 d4             	push   -0x2c(%ebp)
+  801b29:	6a 00                	push   $0x0
+  801b2b:	53                   	push   %ebx
+  801b2c:	6a 00                	push   $0x0
+  801b2e:	e8 39 f7 ff ff       	call   80126c <sys_page_map>
+  801b33:	89 c3                	mov    %eax,%ebx
+  801b35:	83 c4 20             	add    $0x20,%esp
+  801b38:	85 c0                	test   %eax,%eax
+  801b3a:	79 a4                	jns    801ae0 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801b3c:	83 ec 08             	sub    $0x8,%esp
+  801b3f:	56                   	push   %esi
+  801b40:	6a 00                	push   $0x0
+  801b42:	e8 71 f7 ff ff       	call   8012b8 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801b47:	83 c4 08             	add    $0x8,%esp
+  801b4a:	ff 75 d4             	push   -0x2c(%ebp)
+  801b4d:	6a 00                	push   $0x0
+  801b4f:	e8 64 f7 ff ff       	call   8012b8 <sys_page_unmap>
+	return r;
+  801b54:	83 c4 10             	add    $0x10,%esp
+  801b57:	eb b3                	jmp    801b0c <dup+0x9d>
+
+00801b59 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801b59:	55                   	push   %ebp
+  801b5a:	89 e5                	mov    %esp,%ebp
+  801b5c:	56                   	push   %esi
+  801b5d:	53                   	push   %ebx
+  801b5e:	83 ec 18             	sub    $0x18,%esp
+  801b61:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b64:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b67:	50                   	push   %eax
+  801b68:	53                   	push   %ebx
+  801b69:	e8 5b fd ff ff       	call   8018c9 <fd_lookup>
+  801b6e:	83 c4 10             	add    $0x10,%esp
+  801b71:	85 c0                	test   %eax,%eax
+  801b73:	78 3c                	js     801bb1 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801b75:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b78:	83 ec 08             	sub    $0x8,%esp
+  801b7b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b7e:	50                   	push   %eax
+  801b7f:	ff 36                	push   (%esi)
+  801b81:	e8 93 fd ff ff       	call   801919 <dev_lookup>
+  801b86:	83 c4 10             	add    $0x10,%esp
+  801b89:	85 c0                	test   %eax,%eax
+  801b8b:	78 24                	js     801bb1 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801b8d:	8b 46 08             	mov    0x8(%esi),%eax
+  801b90:	83 e0 03             	and    $0x3,%eax
+  801b93:	83 f8 01             	cmp    $0x1,%eax
+  801b96:	74 20                	je     801bb8 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801b98:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b9b:	8b 40 08             	mov    0x8(%eax),%eax
+  801b9e:	85 c0                	test   %eax,%eax
+  801ba0:	74 61                	je     801c03 <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801ba2:	83 ec 04             	sub    $0x4,%esp
+  801ba5:	ff 75 10             	push   0x10(%ebp)
+  801ba8:	ff 75 0c             	push   0xc(%ebp)
+  801bab:	56                   	push   %esi
+  801bac:	ff d0                	call   *%eax
+  801bae:	83 c4 10             	add    $0x10,%esp
+}
+  801bb1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bb4:	5b                   	pop    %ebx
+  801bb5:	5e                   	pop    %esi
+  801bb6:	5d                   	pop    %ebp
+  801bb7:	c3                   	ret
+  801bb8:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801bba:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801bc0:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801bc5:	77 18                	ja     801bdf <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801bc7:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801bcc:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801bce:	c1 e8 10             	shr    $0x10,%eax
+  801bd1:	74 0c                	je     801bdf <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801bd3:	c1 e0 10             	shl    $0x10,%eax
+  801bd6:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801bdb:	29 c2                	sub    %eax,%edx
+  801bdd:	eb 06                	jmp    801be5 <read+0x8c>
+		return pthread_main_tls;
+  801bdf:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801be5:	8b 02                	mov    (%edx),%eax
+  801be7:	8b 40 48             	mov    0x48(%eax),%eax
+  801bea:	83 ec 04             	sub    $0x4,%esp
+  801bed:	53                   	push   %ebx
+  801bee:	50                   	push   %eax
+  801bef:	68 55 55 80 00       	push   $0x805555
+  801bf4:	e8 04 ec ff ff       	call   8007fd <cprintf>
+		return -E_INVAL;
+  801bf9:	83 c4 10             	add    $0x10,%esp
+  801bfc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c01:	eb ae                	jmp    801bb1 <read+0x58>
+		return -E_NOT_SUPP;
+  801c03:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c08:	eb a7                	jmp    801bb1 <read+0x58>
+
+00801c0a <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801c0a:	55                   	push   %ebp
+  801c0b:	89 e5                	mov    %esp,%ebp
+  801c0d:	57                   	push   %edi
+  801c0e:	56                   	push   %esi
+  801c0f:	53                   	push   %ebx
+  801c10:	83 ec 0c             	sub    $0xc,%esp
+  801c13:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801c16:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801c19:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c1e:	eb 02                	jmp    801c22 <readn+0x18>
+  801c20:	01 c3                	add    %eax,%ebx
+  801c22:	39 f3                	cmp    %esi,%ebx
+  801c24:	73 21                	jae    801c47 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801c26:	83 ec 04             	sub    $0x4,%esp
+  801c29:	89 f0                	mov    %esi,%eax
+  801c2b:	29 d8                	sub    %ebx,%eax
+  801c2d:	50                   	push   %eax
+  801c2e:	89 d8                	mov    %ebx,%eax
+  801c30:	03 45 0c             	add    0xc(%ebp),%eax
+  801c33:	50                   	push   %eax
+  801c34:	57                   	push   %edi
+  801c35:	e8 1f ff ff ff       	call   801b59 <read>
+		if (m < 0)
+  801c3a:	83 c4 10             	add    $0x10,%esp
+  801c3d:	85 c0                	test   %eax,%eax
+  801c3f:	78 04                	js     801c45 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801c41:	75 dd                	jne    801c20 <readn+0x16>
+  801c43:	eb 02                	jmp    801c47 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801c45:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801c47:	89 d8                	mov    %ebx,%eax
+  801c49:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c4c:	5b                   	pop    %ebx
+  801c4d:	5e                   	pop    %esi
+  801c4e:	5f                   	pop    %edi
+  801c4f:	5d                   	pop    %ebp
+  801c50:	c3                   	ret
+
+00801c51 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801c51:	55                   	push   %ebp
+  801c52:	89 e5                	mov    %esp,%ebp
+  801c54:	56                   	push   %esi
+  801c55:	53                   	push   %ebx
+  801c56:	83 ec 18             	sub    $0x18,%esp
+  801c59:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c5c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c5f:	50                   	push   %eax
+  801c60:	53                   	push   %ebx
+  801c61:	e8 63 fc ff ff       	call   8018c9 <fd_lookup>
+  801c66:	83 c4 10             	add    $0x10,%esp
+  801c69:	85 c0                	test   %eax,%eax
+  801c6b:	78 37                	js     801ca4 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c6d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c70:	83 ec 08             	sub    $0x8,%esp
+  801c73:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c76:	50                   	push   %eax
+  801c77:	ff 36                	push   (%esi)
+  801c79:	e8 9b fc ff ff       	call   801919 <dev_lookup>
+  801c7e:	83 c4 10             	add    $0x10,%esp
+  801c81:	85 c0                	test   %eax,%eax
+  801c83:	78 1f                	js     801ca4 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c85:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801c89:	74 20                	je     801cab <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801c8b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c8e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c91:	85 c0                	test   %eax,%eax
+  801c93:	74 61                	je     801cf6 <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801c95:	83 ec 04             	sub    $0x4,%esp
+  801c98:	ff 75 10             	push   0x10(%ebp)
+  801c9b:	ff 75 0c             	push   0xc(%ebp)
+  801c9e:	56                   	push   %esi
+  801c9f:	ff d0                	call   *%eax
+  801ca1:	83 c4 10             	add    $0x10,%esp
+}
+  801ca4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ca7:	5b                   	pop    %ebx
+  801ca8:	5e                   	pop    %esi
+  801ca9:	5d                   	pop    %ebp
+  801caa:	c3                   	ret
+  801cab:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801cad:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801cb3:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801cb8:	77 18                	ja     801cd2 <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801cba:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801cbf:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801cc1:	c1 e8 10             	shr    $0x10,%eax
+  801cc4:	74 0c                	je     801cd2 <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801cc6:	c1 e0 10             	shl    $0x10,%eax
+  801cc9:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801cce:	29 c2                	sub    %eax,%edx
+  801cd0:	eb 06                	jmp    801cd8 <write+0x87>
+		return pthread_main_tls;
+  801cd2:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801cd8:	8b 02                	mov    (%edx),%eax
+  801cda:	8b 40 48             	mov    0x48(%eax),%eax
+  801cdd:	83 ec 04             	sub    $0x4,%esp
+  801ce0:	53                   	push   %ebx
+  801ce1:	50                   	push   %eax
+  801ce2:	68 71 55 80 00       	push   $0x805571
+  801ce7:	e8 11 eb ff ff       	call   8007fd <cprintf>
+		return -E_INVAL;
+  801cec:	83 c4 10             	add    $0x10,%esp
+  801cef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801cf4:	eb ae                	jmp    801ca4 <write+0x53>
+		return -E_NOT_SUPP;
+  801cf6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801cfb:	eb a7                	jmp    801ca4 <write+0x53>
+
+00801cfd <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801cfd:	55                   	push   %ebp
+  801cfe:	89 e5                	mov    %esp,%ebp
+  801d00:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d03:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d06:	50                   	push   %eax
+  801d07:	ff 75 08             	push   0x8(%ebp)
+  801d0a:	e8 ba fb ff ff       	call   8018c9 <fd_lookup>
+  801d0f:	83 c4 10             	add    $0x10,%esp
+  801d12:	85 c0                	test   %eax,%eax
+  801d14:	78 0e                	js     801d24 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801d16:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d19:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d1c:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801d1f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d24:	c9                   	leave
+  801d25:	c3                   	ret
+
+00801d26 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801d26:	55                   	push   %ebp
+  801d27:	89 e5                	mov    %esp,%ebp
+  801d29:	56                   	push   %esi
+  801d2a:	53                   	push   %ebx
+  801d2b:	83 ec 18             	sub    $0x18,%esp
+  801d2e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d31:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d34:	50                   	push   %eax
+  801d35:	53                   	push   %ebx
+  801d36:	e8 8e fb ff ff       	call   8018c9 <fd_lookup>
+  801d3b:	83 c4 10             	add    $0x10,%esp
+  801d3e:	85 c0                	test   %eax,%eax
+  801d40:	78 34                	js     801d76 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d42:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d45:	83 ec 08             	sub    $0x8,%esp
+  801d48:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d4b:	50                   	push   %eax
+  801d4c:	ff 36                	push   (%esi)
+  801d4e:	e8 c6 fb ff ff       	call   801919 <dev_lookup>
+  801d53:	83 c4 10             	add    $0x10,%esp
+  801d56:	85 c0                	test   %eax,%eax
+  801d58:	78 1c                	js     801d76 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d5a:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801d5e:	74 1d                	je     801d7d <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801d60:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d63:	8b 40 18             	mov    0x18(%eax),%eax
+  801d66:	85 c0                	test   %eax,%eax
+  801d68:	74 5e                	je     801dc8 <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801d6a:	83 ec 08             	sub    $0x8,%esp
+  801d6d:	ff 75 0c             	push   0xc(%ebp)
+  801d70:	56                   	push   %esi
+  801d71:	ff d0                	call   *%eax
+  801d73:	83 c4 10             	add    $0x10,%esp
+}
+  801d76:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d79:	5b                   	pop    %ebx
+  801d7a:	5e                   	pop    %esi
+  801d7b:	5d                   	pop    %ebp
+  801d7c:	c3                   	ret
+  801d7d:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801d7f:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801d85:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801d8a:	77 18                	ja     801da4 <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801d8c:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801d91:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801d93:	c1 e8 10             	shr    $0x10,%eax
+  801d96:	74 0c                	je     801da4 <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801d98:	c1 e0 10             	shl    $0x10,%eax
+  801d9b:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801da0:	29 c2                	sub    %eax,%edx
+  801da2:	eb 06                	jmp    801daa <ftruncate+0x84>
+		return pthread_main_tls;
+  801da4:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+			thisenv->env_id, fdnum);
+  801daa:	8b 02                	mov    (%edx),%eax
+  801dac:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801daf:	83 ec 04             	sub    $0x4,%esp
+  801db2:	53                   	push   %ebx
+  801db3:	50                   	push   %eax
+  801db4:	68 34 55 80 00       	push   $0x805534
+  801db9:	e8 3f ea ff ff       	call   8007fd <cprintf>
+		return -E_INVAL;
+  801dbe:	83 c4 10             	add    $0x10,%esp
+  801dc1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801dc6:	eb ae                	jmp    801d76 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801dc8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801dcd:	eb a7                	jmp    801d76 <ftruncate+0x50>
+
+00801dcf <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801dcf:	55                   	push   %ebp
+  801dd0:	89 e5                	mov    %esp,%ebp
+  801dd2:	56                   	push   %esi
+  801dd3:	53                   	push   %ebx
+  801dd4:	83 ec 18             	sub    $0x18,%esp
+  801dd7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801dda:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ddd:	50                   	push   %eax
+  801dde:	ff 75 08             	push   0x8(%ebp)
+  801de1:	e8 e3 fa ff ff       	call   8018c9 <fd_lookup>
+  801de6:	83 c4 10             	add    $0x10,%esp
+  801de9:	85 c0                	test   %eax,%eax
+  801deb:	78 49                	js     801e36 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ded:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801df0:	83 ec 08             	sub    $0x8,%esp
+  801df3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801df6:	50                   	push   %eax
+  801df7:	ff 36                	push   (%esi)
+  801df9:	e8 1b fb ff ff       	call   801919 <dev_lookup>
+  801dfe:	83 c4 10             	add    $0x10,%esp
+  801e01:	85 c0                	test   %eax,%eax
+  801e03:	78 31                	js     801e36 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801e05:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e08:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801e0c:	74 2f                	je     801e3d <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801e0e:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801e11:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801e18:	00 00 00 
+	stat->st_isdir = 0;
+  801e1b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801e22:	00 00 00 
+	stat->st_dev = dev;
+  801e25:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801e2b:	83 ec 08             	sub    $0x8,%esp
+  801e2e:	53                   	push   %ebx
+  801e2f:	56                   	push   %esi
+  801e30:	ff 50 14             	call   *0x14(%eax)
+  801e33:	83 c4 10             	add    $0x10,%esp
+}
+  801e36:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e39:	5b                   	pop    %ebx
+  801e3a:	5e                   	pop    %esi
+  801e3b:	5d                   	pop    %ebp
+  801e3c:	c3                   	ret
+		return -E_NOT_SUPP;
+  801e3d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e42:	eb f2                	jmp    801e36 <fstat+0x67>
+
+00801e44 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801e44:	55                   	push   %ebp
+  801e45:	89 e5                	mov    %esp,%ebp
+  801e47:	56                   	push   %esi
+  801e48:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801e49:	83 ec 08             	sub    $0x8,%esp
+  801e4c:	6a 00                	push   $0x0
+  801e4e:	ff 75 08             	push   0x8(%ebp)
+  801e51:	e8 4b 03 00 00       	call   8021a1 <open>
+  801e56:	89 c3                	mov    %eax,%ebx
+  801e58:	83 c4 10             	add    $0x10,%esp
+  801e5b:	85 c0                	test   %eax,%eax
+  801e5d:	78 1b                	js     801e7a <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801e5f:	83 ec 08             	sub    $0x8,%esp
+  801e62:	ff 75 0c             	push   0xc(%ebp)
+  801e65:	50                   	push   %eax
+  801e66:	e8 64 ff ff ff       	call   801dcf <fstat>
+  801e6b:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801e6d:	89 1c 24             	mov    %ebx,(%esp)
+  801e70:	e8 a8 fb ff ff       	call   801a1d <close>
+	return r;
+  801e75:	83 c4 10             	add    $0x10,%esp
+  801e78:	89 f3                	mov    %esi,%ebx
+}
+  801e7a:	89 d8                	mov    %ebx,%eax
+  801e7c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e7f:	5b                   	pop    %ebx
+  801e80:	5e                   	pop    %esi
+  801e81:	5d                   	pop    %ebp
+  801e82:	c3                   	ret
+
+00801e83 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801e83:	55                   	push   %ebp
+  801e84:	89 e5                	mov    %esp,%ebp
+  801e86:	56                   	push   %esi
+  801e87:	53                   	push   %ebx
+  801e88:	89 c6                	mov    %eax,%esi
+  801e8a:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801e8c:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  801e93:	74 27                	je     801ebc <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801e95:	6a 07                	push   $0x7
+  801e97:	68 00 80 80 00       	push   $0x808000
+  801e9c:	56                   	push   %esi
+  801e9d:	ff 35 00 70 80 00    	push   0x807000
+  801ea3:	e8 0f f9 ff ff       	call   8017b7 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801ea8:	83 c4 0c             	add    $0xc,%esp
+  801eab:	6a 00                	push   $0x0
+  801ead:	53                   	push   %ebx
+  801eae:	6a 00                	push   $0x0
+  801eb0:	e8 0c f8 ff ff       	call   8016c1 <ipc_recv>
+}
+  801eb5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801eb8:	5b                   	pop    %ebx
+  801eb9:	5e                   	pop    %esi
+  801eba:	5d                   	pop    %ebp
+  801ebb:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801ebc:	83 ec 0c             	sub    $0xc,%esp
+  801ebf:	6a 01                	push   $0x1
+  801ec1:	e8 47 f9 ff ff       	call   80180d <ipc_find_env>
+  801ec6:	a3 00 70 80 00       	mov    %eax,0x807000
+  801ecb:	83 c4 10             	add    $0x10,%esp
+  801ece:	eb c5                	jmp    801e95 <fsipc+0x12>
+
+00801ed0 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801ed0:	55                   	push   %ebp
+  801ed1:	89 e5                	mov    %esp,%ebp
+  801ed3:	53                   	push   %ebx
+  801ed4:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801ed7:	68 04 70 80 00       	push   $0x807004
+  801edc:	e8 29 1b 00 00       	call   803a0a <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801ee1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ee4:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ee7:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.set_size.req_size = newsize;
+  801eec:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801eef:	a3 04 80 80 00       	mov    %eax,0x808004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  801ef4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ef9:	b8 02 00 00 00       	mov    $0x2,%eax
+  801efe:	e8 80 ff ff ff       	call   801e83 <fsipc>
+  801f03:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801f05:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801f0c:	e8 66 1b 00 00       	call   803a77 <mutex_unlock>
+	return r;
+}
+  801f11:	89 d8                	mov    %ebx,%eax
+  801f13:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f16:	c9                   	leave
+  801f17:	c3                   	ret
+
+00801f18 <devfile_flush>:
+{
+  801f18:	55                   	push   %ebp
+  801f19:	89 e5                	mov    %esp,%ebp
+  801f1b:	53                   	push   %ebx
+  801f1c:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  801f1f:	68 04 70 80 00       	push   $0x807004
+  801f24:	e8 e1 1a 00 00       	call   803a0a <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801f29:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f2c:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f2f:	a3 00 80 80 00       	mov    %eax,0x808000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  801f34:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f39:	b8 06 00 00 00       	mov    $0x6,%eax
+  801f3e:	e8 40 ff ff ff       	call   801e83 <fsipc>
+  801f43:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801f45:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801f4c:	e8 26 1b 00 00       	call   803a77 <mutex_unlock>
+}
+  801f51:	89 d8                	mov    %ebx,%eax
+  801f53:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f56:	c9                   	leave
+  801f57:	c3                   	ret
+
+00801f58 <devfile_stat>:
+{
+  801f58:	55                   	push   %ebp
+  801f59:	89 e5                	mov    %esp,%ebp
+  801f5b:	56                   	push   %esi
+  801f5c:	53                   	push   %ebx
+  801f5d:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  801f60:	83 ec 0c             	sub    $0xc,%esp
+  801f63:	68 04 70 80 00       	push   $0x807004
+  801f68:	e8 9d 1a 00 00       	call   803a0a <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801f6d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f70:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f73:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  801f78:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f7d:	b8 05 00 00 00       	mov    $0x5,%eax
+  801f82:	e8 fc fe ff ff       	call   801e83 <fsipc>
+  801f87:	89 c3                	mov    %eax,%ebx
+  801f89:	83 c4 10             	add    $0x10,%esp
+  801f8c:	85 c0                	test   %eax,%eax
+  801f8e:	79 16                	jns    801fa6 <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  801f90:	83 ec 0c             	sub    $0xc,%esp
+  801f93:	68 04 70 80 00       	push   $0x807004
+  801f98:	e8 da 1a 00 00       	call   803a77 <mutex_unlock>
+}
+  801f9d:	89 d8                	mov    %ebx,%eax
+  801f9f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fa2:	5b                   	pop    %ebx
+  801fa3:	5e                   	pop    %esi
+  801fa4:	5d                   	pop    %ebp
+  801fa5:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801fa6:	83 ec 08             	sub    $0x8,%esp
+  801fa9:	68 00 80 80 00       	push   $0x808000
+  801fae:	56                   	push   %esi
+  801faf:	e8 2d ee ff ff       	call   800de1 <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  801fb4:	a1 80 80 80 00       	mov    0x808080,%eax
+  801fb9:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801fbf:	a1 84 80 80 00       	mov    0x808084,%eax
+  801fc4:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  801fca:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  801fcd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801fd2:	eb bc                	jmp    801f90 <devfile_stat+0x38>
+
+00801fd4 <devfile_write>:
+{
+  801fd4:	55                   	push   %ebp
+  801fd5:	89 e5                	mov    %esp,%ebp
+  801fd7:	53                   	push   %ebx
+  801fd8:	83 ec 10             	sub    $0x10,%esp
+  801fdb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  801fde:	68 04 70 80 00       	push   $0x807004
+  801fe3:	e8 22 1a 00 00       	call   803a0a <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801fe8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801feb:	8b 40 0c             	mov    0xc(%eax),%eax
+  801fee:	a3 00 80 80 00       	mov    %eax,0x808000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801ff3:	83 c4 10             	add    $0x10,%esp
+  801ff6:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  801ffc:	76 3d                	jbe    80203b <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  801ffe:	b8 00 00 10 00       	mov    $0x100000,%eax
+  802003:	39 c3                	cmp    %eax,%ebx
+  802005:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  802008:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80200b:	a3 08 80 80 00       	mov    %eax,0x808008
+	fsipcbuf.write.req_n = n;
+  802010:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	r = fsipc(FSREQ_WRITE, NULL);
+  802016:	ba 00 00 00 00       	mov    $0x0,%edx
+  80201b:	b8 04 00 00 00       	mov    $0x4,%eax
+  802020:	e8 5e fe ff ff       	call   801e83 <fsipc>
+  802025:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802027:	83 ec 0c             	sub    $0xc,%esp
+  80202a:	68 04 70 80 00       	push   $0x807004
+  80202f:	e8 43 1a 00 00       	call   803a77 <mutex_unlock>
+}
+  802034:	89 d8                	mov    %ebx,%eax
+  802036:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802039:	c9                   	leave
+  80203a:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  80203b:	83 ec 04             	sub    $0x4,%esp
+  80203e:	53                   	push   %ebx
+  80203f:	ff 75 0c             	push   0xc(%ebp)
+  802042:	68 0c 80 80 00       	push   $0x80800c
+  802047:	e8 1b ef ff ff       	call   800f67 <memmove>
+  80204c:	83 c4 10             	add    $0x10,%esp
+  80204f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802054:	eb b5                	jmp    80200b <devfile_write+0x37>
+
+00802056 <devfile_read>:
+{
+  802056:	55                   	push   %ebp
+  802057:	89 e5                	mov    %esp,%ebp
+  802059:	57                   	push   %edi
+  80205a:	56                   	push   %esi
+  80205b:	53                   	push   %ebx
+  80205c:	83 ec 0c             	sub    $0xc,%esp
+  80205f:	8b 75 08             	mov    0x8(%ebp),%esi
+  802062:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802065:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  802068:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  80206e:	0f 86 8c 00 00 00    	jbe    802100 <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  802074:	b8 00 00 10 00       	mov    $0x100000,%eax
+  802079:	39 c3                	cmp    %eax,%ebx
+  80207b:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  80207e:	89 f8                	mov    %edi,%eax
+  802080:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  802083:	eb 0f                	jmp    802094 <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  802085:	0f b6 08             	movzbl (%eax),%ecx
+  802088:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  80208a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80208f:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  802094:	39 d0                	cmp    %edx,%eax
+  802096:	72 ed                	jb     802085 <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  802098:	83 ec 0c             	sub    $0xc,%esp
+  80209b:	68 04 70 80 00       	push   $0x807004
+  8020a0:	e8 65 19 00 00       	call   803a0a <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8020a5:	8b 46 0c             	mov    0xc(%esi),%eax
+  8020a8:	a3 00 80 80 00       	mov    %eax,0x808000
+		fsipcbuf.read.req_n = n;
+  8020ad:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  8020b3:	89 3d 08 80 80 00    	mov    %edi,0x808008
+		r = fsipc(FSREQ_READ, NULL);
+  8020b9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020be:	b8 03 00 00 00       	mov    $0x3,%eax
+  8020c3:	e8 bb fd ff ff       	call   801e83 <fsipc>
+  8020c8:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  8020ca:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  8020d1:	e8 a1 19 00 00       	call   803a77 <mutex_unlock>
+		assert(r <= (int) n);
+  8020d6:	83 c4 10             	add    $0x10,%esp
+  8020d9:	39 f3                	cmp    %esi,%ebx
+  8020db:	7c 0a                	jl     8020e7 <devfile_read+0x91>
+}
+  8020dd:	89 f0                	mov    %esi,%eax
+  8020df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020e2:	5b                   	pop    %ebx
+  8020e3:	5e                   	pop    %esi
+  8020e4:	5f                   	pop    %edi
+  8020e5:	5d                   	pop    %ebp
+  8020e6:	c3                   	ret
+		assert(r <= (int) n);
+  8020e7:	68 a4 55 80 00       	push   $0x8055a4
+  8020ec:	68 b1 55 80 00       	push   $0x8055b1
+  8020f1:	68 90 00 00 00       	push   $0x90
+  8020f6:	68 c6 55 80 00       	push   $0x8055c6
+  8020fb:	e8 22 e6 ff ff       	call   800722 <_panic>
+	mutex_lock(&fsipc_mu);
+  802100:	83 ec 0c             	sub    $0xc,%esp
+  802103:	68 04 70 80 00       	push   $0x807004
+  802108:	e8 fd 18 00 00       	call   803a0a <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80210d:	8b 46 0c             	mov    0xc(%esi),%eax
+  802110:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.read.req_n = n;
+  802115:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	fsipcbuf.read.req_va = 0;
+  80211b:	c7 05 08 80 80 00 00 	movl   $0x0,0x808008
+  802122:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  802125:	ba 00 00 00 00       	mov    $0x0,%edx
+  80212a:	b8 03 00 00 00       	mov    $0x3,%eax
+  80212f:	e8 4f fd ff ff       	call   801e83 <fsipc>
+  802134:	89 c6                	mov    %eax,%esi
+  802136:	83 c4 10             	add    $0x10,%esp
+  802139:	85 c0                	test   %eax,%eax
+  80213b:	78 1d                	js     80215a <devfile_read+0x104>
+		assert(r <= n);
+  80213d:	39 c3                	cmp    %eax,%ebx
+  80213f:	72 2e                	jb     80216f <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  802141:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802146:	7f 40                	jg     802188 <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  802148:	83 ec 04             	sub    $0x4,%esp
+  80214b:	50                   	push   %eax
+  80214c:	68 00 80 80 00       	push   $0x808000
+  802151:	57                   	push   %edi
+  802152:	e8 10 ee ff ff       	call   800f67 <memmove>
+  802157:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  80215a:	83 ec 0c             	sub    $0xc,%esp
+  80215d:	68 04 70 80 00       	push   $0x807004
+  802162:	e8 10 19 00 00       	call   803a77 <mutex_unlock>
+	return r;
+  802167:	83 c4 10             	add    $0x10,%esp
+  80216a:	e9 6e ff ff ff       	jmp    8020dd <devfile_read+0x87>
+		assert(r <= n);
+  80216f:	68 d1 55 80 00       	push   $0x8055d1
+  802174:	68 b1 55 80 00       	push   $0x8055b1
+  802179:	68 99 00 00 00       	push   $0x99
+  80217e:	68 c6 55 80 00       	push   $0x8055c6
+  802183:	e8 9a e5 ff ff       	call   800722 <_panic>
+		assert(r <= PGSIZE);
+  802188:	68 d8 55 80 00       	push   $0x8055d8
+  80218d:	68 b1 55 80 00       	push   $0x8055b1
+  802192:	68 9a 00 00 00       	push   $0x9a
+  802197:	68 c6 55 80 00       	push   $0x8055c6
+  80219c:	e8 81 e5 ff ff       	call   800722 <_panic>
+
+008021a1 <open>:
+{
+  8021a1:	55                   	push   %ebp
+  8021a2:	89 e5                	mov    %esp,%ebp
+  8021a4:	56                   	push   %esi
+  8021a5:	53                   	push   %ebx
+  8021a6:	83 ec 1c             	sub    $0x1c,%esp
+  8021a9:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  8021ac:	56                   	push   %esi
+  8021ad:	e8 f4 eb ff ff       	call   800da6 <strlen>
+  8021b2:	83 c4 10             	add    $0x10,%esp
+  8021b5:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8021ba:	0f 8f 85 00 00 00    	jg     802245 <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  8021c0:	83 ec 0c             	sub    $0xc,%esp
+  8021c3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021c6:	50                   	push   %eax
+  8021c7:	e8 a7 f6 ff ff       	call   801873 <fd_alloc>
+  8021cc:	89 c3                	mov    %eax,%ebx
+  8021ce:	83 c4 10             	add    $0x10,%esp
+  8021d1:	85 c0                	test   %eax,%eax
+  8021d3:	78 55                	js     80222a <open+0x89>
+	mutex_lock(&fsipc_mu);
+  8021d5:	83 ec 0c             	sub    $0xc,%esp
+  8021d8:	68 04 70 80 00       	push   $0x807004
+  8021dd:	e8 28 18 00 00       	call   803a0a <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  8021e2:	83 c4 08             	add    $0x8,%esp
+  8021e5:	56                   	push   %esi
+  8021e6:	68 00 80 80 00       	push   $0x808000
+  8021eb:	e8 f1 eb ff ff       	call   800de1 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8021f0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021f3:	a3 00 84 80 00       	mov    %eax,0x808400
+	r = fsipc(FSREQ_OPEN, fd);
+  8021f8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8021fb:	b8 01 00 00 00       	mov    $0x1,%eax
+  802200:	e8 7e fc ff ff       	call   801e83 <fsipc>
+  802205:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802207:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  80220e:	e8 64 18 00 00       	call   803a77 <mutex_unlock>
+	if (r < 0) {
+  802213:	83 c4 10             	add    $0x10,%esp
+  802216:	85 db                	test   %ebx,%ebx
+  802218:	78 19                	js     802233 <open+0x92>
+	return fd2num(fd);
+  80221a:	83 ec 0c             	sub    $0xc,%esp
+  80221d:	ff 75 f4             	push   -0xc(%ebp)
+  802220:	e8 27 f6 ff ff       	call   80184c <fd2num>
+  802225:	89 c3                	mov    %eax,%ebx
+  802227:	83 c4 10             	add    $0x10,%esp
+}
+  80222a:	89 d8                	mov    %ebx,%eax
+  80222c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80222f:	5b                   	pop    %ebx
+  802230:	5e                   	pop    %esi
+  802231:	5d                   	pop    %ebp
+  802232:	c3                   	ret
+		fd_close(fd, 0);
+  802233:	83 ec 08             	sub    $0x8,%esp
+  802236:	6a 00                	push   $0x0
+  802238:	ff 75 f4             	push   -0xc(%ebp)
+  80223b:	e8 56 f7 ff ff       	call   801996 <fd_close>
+		return r;
+  802240:	83 c4 10             	add    $0x10,%esp
+  802243:	eb e5                	jmp    80222a <open+0x89>
+		return -E_BAD_PATH;
+  802245:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80224a:	eb de                	jmp    80222a <open+0x89>
+
+0080224c <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  80224c:	55                   	push   %ebp
+  80224d:	89 e5                	mov    %esp,%ebp
+  80224f:	53                   	push   %ebx
+  802250:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802253:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802256:	50                   	push   %eax
+  802257:	ff 75 08             	push   0x8(%ebp)
+  80225a:	e8 6a f6 ff ff       	call   8018c9 <fd_lookup>
+  80225f:	89 c3                	mov    %eax,%ebx
+  802261:	83 c4 10             	add    $0x10,%esp
+  802264:	85 c0                	test   %eax,%eax
+  802266:	78 5b                	js     8022c3 <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  802268:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80226b:	8b 0d 08 60 80 00    	mov    0x806008,%ecx
+  802271:	39 08                	cmp    %ecx,(%eax)
+  802273:	75 55                	jne    8022ca <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  802275:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802279:	74 56                	je     8022d1 <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  80227b:	83 ec 0c             	sub    $0xc,%esp
+  80227e:	68 04 70 80 00       	push   $0x807004
+  802283:	e8 82 17 00 00       	call   803a0a <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  802288:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80228b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80228e:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.allocate.req_offset = offset;
+  802293:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802296:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.allocate.req_len = len;
+  80229b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80229e:	a3 08 80 80 00       	mov    %eax,0x808008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  8022a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022a8:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8022ad:	e8 d1 fb ff ff       	call   801e83 <fsipc>
+  8022b2:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8022b4:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  8022bb:	e8 b7 17 00 00       	call   803a77 <mutex_unlock>
+	return r;
+  8022c0:	83 c4 10             	add    $0x10,%esp
+}
+  8022c3:	89 d8                	mov    %ebx,%eax
+  8022c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022c8:	c9                   	leave
+  8022c9:	c3                   	ret
+		return -E_NOT_SUPP;
+  8022ca:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8022cf:	eb f2                	jmp    8022c3 <fallocate+0x77>
+		return -E_INVAL;
+  8022d1:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8022d6:	eb eb                	jmp    8022c3 <fallocate+0x77>
+
+008022d8 <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  8022d8:	55                   	push   %ebp
+  8022d9:	89 e5                	mov    %esp,%ebp
+  8022db:	56                   	push   %esi
+  8022dc:	53                   	push   %ebx
+  8022dd:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  8022e0:	89 f3                	mov    %esi,%ebx
+  8022e2:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  8022e8:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  8022eb:	eb 06                	jmp    8022f3 <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  8022ed:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8022f3:	39 f3                	cmp    %esi,%ebx
+  8022f5:	73 14                	jae    80230b <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  8022f7:	83 ec 08             	sub    $0x8,%esp
+  8022fa:	53                   	push   %ebx
+  8022fb:	6a 00                	push   $0x0
+  8022fd:	e8 b6 ef ff ff       	call   8012b8 <sys_page_unmap>
+  802302:	83 c4 10             	add    $0x10,%esp
+  802305:	85 c0                	test   %eax,%eax
+  802307:	79 e4                	jns    8022ed <munmap+0x15>
+  802309:	eb 05                	jmp    802310 <munmap+0x38>
+			return r;
+	return 0;
+  80230b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802310:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802313:	5b                   	pop    %ebx
+  802314:	5e                   	pop    %esi
+  802315:	5d                   	pop    %ebp
+  802316:	c3                   	ret
+
+00802317 <mmap>:
+{
+  802317:	55                   	push   %ebp
+  802318:	89 e5                	mov    %esp,%ebp
+  80231a:	57                   	push   %edi
+  80231b:	56                   	push   %esi
+  80231c:	53                   	push   %ebx
+  80231d:	83 ec 24             	sub    $0x24,%esp
+  802320:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802323:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802326:	50                   	push   %eax
+  802327:	ff 75 08             	push   0x8(%ebp)
+  80232a:	e8 9a f5 ff ff       	call   8018c9 <fd_lookup>
+  80232f:	83 c4 10             	add    $0x10,%esp
+  802332:	85 c0                	test   %eax,%eax
+  802334:	0f 88 37 01 00 00    	js     802471 <mmap+0x15a>
+		return NULL;
+  80233a:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  80233f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802342:	8b 0d 08 60 80 00    	mov    0x806008,%ecx
+  802348:	39 0a                	cmp    %ecx,(%edx)
+  80234a:	0f 85 05 01 00 00    	jne    802455 <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  802350:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  802357:	0f 85 1b 01 00 00    	jne    802478 <mmap+0x161>
+  80235d:	89 f0                	mov    %esi,%eax
+  80235f:	83 e8 01             	sub    $0x1,%eax
+  802362:	0f 88 17 01 00 00    	js     80247f <mmap+0x168>
+	if (prot & PROT_WRITE)
+  802368:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  80236c:	75 28                	jne    802396 <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  80236e:	83 ec 0c             	sub    $0xc,%esp
+  802371:	68 04 70 80 00       	push   $0x807004
+  802376:	e8 8f 16 00 00       	call   803a0a <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  80237b:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  802381:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  802387:	83 c4 10             	add    $0x10,%esp
+  80238a:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  80238f:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  802394:	eb 2b                	jmp    8023c1 <mmap+0xaa>
+		cow_enable();
+  802396:	e8 f4 21 00 00       	call   80458f <cow_enable>
+  80239b:	eb d1                	jmp    80236e <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  80239d:	89 c2                	mov    %eax,%edx
+  80239f:	c1 ea 0c             	shr    $0xc,%edx
+  8023a2:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  8023a9:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8023af:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  8023b5:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  8023b8:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  8023ba:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  8023bf:	77 25                	ja     8023e6 <mmap+0xcf>
+  8023c1:	89 c2                	mov    %eax,%edx
+  8023c3:	29 da                	sub    %ebx,%edx
+  8023c5:	39 ca                	cmp    %ecx,%edx
+  8023c7:	73 3a                	jae    802403 <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  8023c9:	89 c2                	mov    %eax,%edx
+  8023cb:	c1 ea 16             	shr    $0x16,%edx
+  8023ce:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8023d5:	f6 c2 01             	test   $0x1,%dl
+  8023d8:	75 c3                	jne    80239d <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  8023da:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  8023df:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  8023e4:	eb d4                	jmp    8023ba <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  8023e6:	29 d8                	sub    %ebx,%eax
+  8023e8:	39 c8                	cmp    %ecx,%eax
+  8023ea:	73 17                	jae    802403 <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  8023ec:	83 ec 0c             	sub    $0xc,%esp
+  8023ef:	68 04 70 80 00       	push   $0x807004
+  8023f4:	e8 7e 16 00 00       	call   803a77 <mutex_unlock>
+		return NULL;
+  8023f9:	83 c4 10             	add    $0x10,%esp
+  8023fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802401:	eb 52                	jmp    802455 <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  802403:	85 db                	test   %ebx,%ebx
+  802405:	74 e5                	je     8023ec <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802407:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80240a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80240d:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.map.req_offset = offset;
+  802412:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802415:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.map.req_len = len;
+  80241a:	89 35 08 80 80 00    	mov    %esi,0x808008
+	fsipcbuf.map.req_va = va;
+  802420:	89 1d 0c 80 80 00    	mov    %ebx,0x80800c
+	fsipcbuf.map.req_prot = prot;
+  802426:	8b 45 14             	mov    0x14(%ebp),%eax
+  802429:	a3 10 80 80 00       	mov    %eax,0x808010
+	r = fsipc(FSREQ_MAP, NULL);
+  80242e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802433:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802438:	e8 46 fa ff ff       	call   801e83 <fsipc>
+  80243d:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  80243f:	83 ec 0c             	sub    $0xc,%esp
+  802442:	68 04 70 80 00       	push   $0x807004
+  802447:	e8 2b 16 00 00       	call   803a77 <mutex_unlock>
+	if (r < 0) {
+  80244c:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  80244f:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  802451:	85 ff                	test   %edi,%edi
+  802453:	78 08                	js     80245d <mmap+0x146>
+}
+  802455:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802458:	5b                   	pop    %ebx
+  802459:	5e                   	pop    %esi
+  80245a:	5f                   	pop    %edi
+  80245b:	5d                   	pop    %ebp
+  80245c:	c3                   	ret
+		munmap((void*) va, len);
+  80245d:	83 ec 08             	sub    $0x8,%esp
+  802460:	56                   	push   %esi
+  802461:	53                   	push   %ebx
+  802462:	e8 71 fe ff ff       	call   8022d8 <munmap>
+		return NULL;
+  802467:	83 c4 10             	add    $0x10,%esp
+  80246a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80246f:	eb e4                	jmp    802455 <mmap+0x13e>
+		return NULL;
+  802471:	b8 00 00 00 00       	mov    $0x0,%eax
+  802476:	eb dd                	jmp    802455 <mmap+0x13e>
+		return NULL;
+  802478:	b8 00 00 00 00       	mov    $0x0,%eax
+  80247d:	eb d6                	jmp    802455 <mmap+0x13e>
+  80247f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802484:	eb cf                	jmp    802455 <mmap+0x13e>
+
+00802486 <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  802486:	55                   	push   %ebp
+  802487:	89 e5                	mov    %esp,%ebp
+  802489:	53                   	push   %ebx
+  80248a:	83 ec 10             	sub    $0x10,%esp
+  80248d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802490:	53                   	push   %ebx
+  802491:	e8 10 e9 ff ff       	call   800da6 <strlen>
+  802496:	83 c4 10             	add    $0x10,%esp
+  802499:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80249e:	7f 42                	jg     8024e2 <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  8024a0:	83 ec 0c             	sub    $0xc,%esp
+  8024a3:	68 04 70 80 00       	push   $0x807004
+  8024a8:	e8 5d 15 00 00       	call   803a0a <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  8024ad:	83 c4 08             	add    $0x8,%esp
+  8024b0:	53                   	push   %ebx
+  8024b1:	68 00 80 80 00       	push   $0x808000
+  8024b6:	e8 26 e9 ff ff       	call   800de1 <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  8024bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024c0:	b8 07 00 00 00       	mov    $0x7,%eax
+  8024c5:	e8 b9 f9 ff ff       	call   801e83 <fsipc>
+  8024ca:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8024cc:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  8024d3:	e8 9f 15 00 00       	call   803a77 <mutex_unlock>
+	return r;
+  8024d8:	83 c4 10             	add    $0x10,%esp
+}
+  8024db:	89 d8                	mov    %ebx,%eax
+  8024dd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024e0:	c9                   	leave
+  8024e1:	c3                   	ret
+		return -E_BAD_PATH;
+  8024e2:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8024e7:	eb f2                	jmp    8024db <remove+0x55>
+
+008024e9 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8024e9:	55                   	push   %ebp
+  8024ea:	89 e5                	mov    %esp,%ebp
+  8024ec:	53                   	push   %ebx
+  8024ed:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  8024f0:	68 04 70 80 00       	push   $0x807004
+  8024f5:	e8 10 15 00 00       	call   803a0a <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  8024fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024ff:	b8 08 00 00 00       	mov    $0x8,%eax
+  802504:	e8 7a f9 ff ff       	call   801e83 <fsipc>
+  802509:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80250b:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  802512:	e8 60 15 00 00       	call   803a77 <mutex_unlock>
+	return r;
+}
+  802517:	89 d8                	mov    %ebx,%eax
+  802519:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80251c:	c9                   	leave
+  80251d:	c3                   	ret
+
+0080251e <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  80251e:	55                   	push   %ebp
+  80251f:	89 e5                	mov    %esp,%ebp
+  802521:	56                   	push   %esi
+  802522:	53                   	push   %ebx
+  802523:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  802526:	83 ec 0c             	sub    $0xc,%esp
+  802529:	68 04 70 80 00       	push   $0x807004
+  80252e:	e8 d7 14 00 00       	call   803a0a <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  802533:	8b 45 08             	mov    0x8(%ebp),%eax
+  802536:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  80253b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802540:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802545:	e8 39 f9 ff ff       	call   801e83 <fsipc>
+  80254a:	89 c6                	mov    %eax,%esi
+  80254c:	83 c4 10             	add    $0x10,%esp
+  80254f:	85 db                	test   %ebx,%ebx
+  802551:	74 7b                	je     8025ce <fs_bcstat+0xb0>
+  802553:	85 c0                	test   %eax,%eax
+  802555:	78 77                	js     8025ce <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  802557:	a1 00 80 80 00       	mov    0x808000,%eax
+  80255c:	89 03                	mov    %eax,(%ebx)
+  80255e:	a1 04 80 80 00       	mov    0x808004,%eax
+  802563:	89 43 04             	mov    %eax,0x4(%ebx)
+  802566:	a1 08 80 80 00       	mov    0x808008,%eax
+  80256b:	89 43 08             	mov    %eax,0x8(%ebx)
+  80256e:	a1 0c 80 80 00       	mov    0x80800c,%eax
+  802573:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802576:	a1 10 80 80 00       	mov    0x808010,%eax
+  80257b:	89 43 10             	mov    %eax,0x10(%ebx)
+  80257e:	a1 14 80 80 00       	mov    0x808014,%eax
+  802583:	89 43 14             	mov    %eax,0x14(%ebx)
+  802586:	a1 18 80 80 00       	mov    0x808018,%eax
+  80258b:	89 43 18             	mov    %eax,0x18(%ebx)
+  80258e:	a1 1c 80 80 00       	mov    0x80801c,%eax
+  802593:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  802596:	a1 20 80 80 00       	mov    0x808020,%eax
+  80259b:	89 43 20             	mov    %eax,0x20(%ebx)
+  80259e:	a1 24 80 80 00       	mov    0x808024,%eax
+  8025a3:	89 43 24             	mov    %eax,0x24(%ebx)
+  8025a6:	a1 28 80 80 00       	mov    0x808028,%eax
+  8025ab:	89 43 28             	mov    %eax,0x28(%ebx)
+  8025ae:	a1 2c 80 80 00       	mov    0x80802c,%eax
+  8025b3:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  8025b6:	a1 30 80 80 00       	mov    0x808030,%eax
+  8025bb:	89 43 30             	mov    %eax,0x30(%ebx)
+  8025be:	a1 34 80 80 00       	mov    0x808034,%eax
+  8025c3:	89 43 34             	mov    %eax,0x34(%ebx)
+  8025c6:	a1 38 80 80 00       	mov    0x808038,%eax
+  8025cb:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  8025ce:	83 ec 0c             	sub    $0xc,%esp
+  8025d1:	68 04 70 80 00       	push   $0x807004
+  8025d6:	e8 9c 14 00 00       	call   803a77 <mutex_unlock>
+	return r;
+}
+  8025db:	89 f0                	mov    %esi,%eax
+  8025dd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025e0:	5b                   	pop    %ebx
+  8025e1:	5e                   	pop    %esi
+  8025e2:	5d                   	pop    %ebp
+  8025e3:	c3                   	ret
+
+008025e4 <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  8025e4:	55                   	push   %ebp
+  8025e5:	89 e5                	mov    %esp,%ebp
+  8025e7:	56                   	push   %esi
+  8025e8:	53                   	push   %ebx
+  8025e9:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  8025eb:	0f b6 10             	movzbl (%eax),%edx
+  8025ee:	80 fa 72             	cmp    $0x72,%dl
+  8025f1:	74 44                	je     802637 <parse_mode+0x53>
+  8025f3:	80 fa 77             	cmp    $0x77,%dl
+  8025f6:	74 4b                	je     802643 <parse_mode+0x5f>
+  8025f8:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8025fd:	80 fa 61             	cmp    $0x61,%dl
+  802600:	74 09                	je     80260b <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  802602:	89 d8                	mov    %ebx,%eax
+  802604:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802607:	5b                   	pop    %ebx
+  802608:	5e                   	pop    %esi
+  802609:	5d                   	pop    %ebp
+  80260a:	c3                   	ret
+	switch (mode[0]) {
+  80260b:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  802610:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  802615:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  802617:	83 ec 08             	sub    $0x8,%esp
+  80261a:	6a 2b                	push   $0x2b
+  80261c:	50                   	push   %eax
+  80261d:	e8 d1 e8 ff ff       	call   800ef3 <strchr>
+  802622:	83 c4 10             	add    $0x10,%esp
+  802625:	85 c0                	test   %eax,%eax
+  802627:	74 d9                	je     802602 <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  802629:	83 e3 fc             	and    $0xfffffffc,%ebx
+  80262c:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  80262f:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  802635:	eb cb                	jmp    802602 <parse_mode+0x1e>
+	switch (mode[0]) {
+  802637:	ba 01 00 00 00       	mov    $0x1,%edx
+  80263c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802641:	eb d2                	jmp    802615 <parse_mode+0x31>
+  802643:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  802648:	bb 01 03 00 00       	mov    $0x301,%ebx
+  80264d:	eb c6                	jmp    802615 <parse_mode+0x31>
+
+0080264f <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  80264f:	55                   	push   %ebp
+  802650:	89 e5                	mov    %esp,%ebp
+  802652:	57                   	push   %edi
+  802653:	56                   	push   %esi
+  802654:	53                   	push   %ebx
+  802655:	83 ec 1c             	sub    $0x1c,%esp
+  802658:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80265b:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  80265e:	b8 44 60 80 00       	mov    $0x806044,%eax
+  802663:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  802668:	83 c0 24             	add    $0x24,%eax
+  80266b:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  80266f:	74 17                	je     802688 <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  802671:	83 c3 01             	add    $0x1,%ebx
+  802674:	83 fb 10             	cmp    $0x10,%ebx
+  802677:	75 ef                	jne    802668 <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  802679:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  80267e:	89 f0                	mov    %esi,%eax
+  802680:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802683:	5b                   	pop    %ebx
+  802684:	5e                   	pop    %esi
+  802685:	5f                   	pop    %edi
+  802686:	5d                   	pop    %ebp
+  802687:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  802688:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  80268f:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802692:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  802695:	c1 e7 02             	shl    $0x2,%edi
+  802698:	8d b7 40 60 80 00    	lea    0x806040(%edi),%esi
+  80269e:	83 ec 04             	sub    $0x4,%esp
+  8026a1:	6a 24                	push   $0x24
+  8026a3:	6a 00                	push   $0x0
+  8026a5:	56                   	push   %esi
+  8026a6:	e8 87 e8 ff ff       	call   800f32 <memset>
+			streams[i].f_fd = fd;
+  8026ab:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8026ae:	89 8f 40 60 80 00    	mov    %ecx,0x806040(%edi)
+			streams[i].f_flags = flags;
+  8026b4:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8026b7:	01 d8                	add    %ebx,%eax
+  8026b9:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8026bc:	89 0c 85 44 60 80 00 	mov    %ecx,0x806044(,%eax,4)
+			return &streams[i];
+  8026c3:	83 c4 10             	add    $0x10,%esp
+  8026c6:	eb b6                	jmp    80267e <stream_alloc+0x2f>
+
+008026c8 <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  8026c8:	55                   	push   %ebp
+  8026c9:	89 e5                	mov    %esp,%ebp
+  8026cb:	53                   	push   %ebx
+  8026cc:	83 ec 14             	sub    $0x14,%esp
+  8026cf:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  8026d1:	8b 40 18             	mov    0x18(%eax),%eax
+  8026d4:	39 43 14             	cmp    %eax,0x14(%ebx)
+  8026d7:	74 4a                	je     802723 <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  8026d9:	83 ec 08             	sub    $0x8,%esp
+  8026dc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026df:	50                   	push   %eax
+  8026e0:	ff 33                	push   (%ebx)
+  8026e2:	e8 e2 f1 ff ff       	call   8018c9 <fd_lookup>
+  8026e7:	89 c2                	mov    %eax,%edx
+  8026e9:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8026ec:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  8026f1:	85 d2                	test   %edx,%edx
+  8026f3:	78 41                	js     802736 <stream_unread+0x6e>
+  8026f5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8026f8:	8b 0d 08 60 80 00    	mov    0x806008,%ecx
+  8026fe:	39 0a                	cmp    %ecx,(%edx)
+  802700:	75 34                	jne    802736 <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  802702:	8b 43 14             	mov    0x14(%ebx),%eax
+  802705:	03 42 04             	add    0x4(%edx),%eax
+  802708:	2b 43 18             	sub    0x18(%ebx),%eax
+  80270b:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  80270e:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  802715:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  80271c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802721:	eb 13                	jmp    802736 <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  802723:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  80272a:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  802731:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802736:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802739:	c9                   	leave
+  80273a:	c3                   	ret
+
+0080273b <stream_drain>:
+{
+  80273b:	55                   	push   %ebp
+  80273c:	89 e5                	mov    %esp,%ebp
+  80273e:	56                   	push   %esi
+  80273f:	53                   	push   %ebx
+  802740:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  802742:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802747:	eb 02                	jmp    80274b <stream_drain+0x10>
+  802749:	01 c3                	add    %eax,%ebx
+  80274b:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80274e:	39 c3                	cmp    %eax,%ebx
+  802750:	73 43                	jae    802795 <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  802752:	83 ec 04             	sub    $0x4,%esp
+  802755:	29 d8                	sub    %ebx,%eax
+  802757:	50                   	push   %eax
+  802758:	89 d8                	mov    %ebx,%eax
+  80275a:	03 46 0c             	add    0xc(%esi),%eax
+  80275d:	50                   	push   %eax
+  80275e:	ff 36                	push   (%esi)
+  802760:	e8 ec f4 ff ff       	call   801c51 <write>
+  802765:	83 c4 10             	add    $0x10,%esp
+  802768:	85 c0                	test   %eax,%eax
+  80276a:	7f dd                	jg     802749 <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  80276c:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  802770:	8b 56 0c             	mov    0xc(%esi),%edx
+  802773:	83 ec 04             	sub    $0x4,%esp
+  802776:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802779:	29 d8                	sub    %ebx,%eax
+  80277b:	50                   	push   %eax
+  80277c:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  80277f:	50                   	push   %eax
+  802780:	52                   	push   %edx
+  802781:	e8 e1 e7 ff ff       	call   800f67 <memmove>
+			f->f_wend -= done;
+  802786:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802789:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  80278b:	83 c4 10             	add    $0x10,%esp
+  80278e:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  802793:	eb 0a                	jmp    80279f <stream_drain+0x64>
+  802795:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  80279a:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  80279f:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  8027a2:	89 d0                	mov    %edx,%eax
+  8027a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027a7:	5b                   	pop    %ebx
+  8027a8:	5e                   	pop    %esi
+  8027a9:	5d                   	pop    %ebp
+  8027aa:	c3                   	ret
+
+008027ab <stream_setup>:
+	if (f->f_buf)
+  8027ab:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8027af:	74 01                	je     8027b2 <stream_setup+0x7>
+  8027b1:	c3                   	ret
+{
+  8027b2:	55                   	push   %ebp
+  8027b3:	89 e5                	mov    %esp,%ebp
+  8027b5:	53                   	push   %ebx
+  8027b6:	83 ec 04             	sub    $0x4,%esp
+  8027b9:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  8027bb:	8b 40 08             	mov    0x8(%eax),%eax
+  8027be:	85 c0                	test   %eax,%eax
+  8027c0:	74 17                	je     8027d9 <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  8027c2:	83 f8 03             	cmp    $0x3,%eax
+  8027c5:	75 2d                	jne    8027f4 <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  8027c7:	8d 43 20             	lea    0x20(%ebx),%eax
+  8027ca:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  8027cd:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  8027d4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027d7:	c9                   	leave
+  8027d8:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  8027d9:	83 ec 0c             	sub    $0xc,%esp
+  8027dc:	ff 33                	push   (%ebx)
+  8027de:	e8 29 1b 00 00       	call   80430c <iscons>
+  8027e3:	83 c4 10             	add    $0x10,%esp
+  8027e6:	85 c0                	test   %eax,%eax
+  8027e8:	0f 9f c0             	setg   %al
+  8027eb:	0f b6 c0             	movzbl %al,%eax
+  8027ee:	83 c0 01             	add    $0x1,%eax
+  8027f1:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  8027f4:	83 ec 0c             	sub    $0xc,%esp
+  8027f7:	68 00 10 00 00       	push   $0x1000
+  8027fc:	e8 6e 0b 00 00       	call   80336f <malloc>
+  802801:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802804:	83 c4 10             	add    $0x10,%esp
+  802807:	85 c0                	test   %eax,%eax
+  802809:	74 bc                	je     8027c7 <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  80280b:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  802812:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  802816:	eb bc                	jmp    8027d4 <stream_setup+0x29>
+
+00802818 <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  802818:	55                   	push   %ebp
+  802819:	89 e5                	mov    %esp,%ebp
+  80281b:	53                   	push   %ebx
+  80281c:	83 ec 04             	sub    $0x4,%esp
+  80281f:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  802821:	e8 85 ff ff ff       	call   8027ab <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  802826:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  80282b:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  80282f:	74 3d                	je     80286e <stream_fill+0x56>
+  802831:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  802835:	74 10                	je     802847 <stream_fill+0x2f>
+  802837:	89 d8                	mov    %ebx,%eax
+  802839:	e8 fd fe ff ff       	call   80273b <stream_drain>
+		return 0;
+  80283e:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  802843:	85 c0                	test   %eax,%eax
+  802845:	78 27                	js     80286e <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  802847:	83 ec 04             	sub    $0x4,%esp
+  80284a:	ff 73 10             	push   0x10(%ebx)
+  80284d:	ff 73 0c             	push   0xc(%ebx)
+  802850:	ff 33                	push   (%ebx)
+  802852:	e8 02 f3 ff ff       	call   801b59 <read>
+  802857:	83 c4 10             	add    $0x10,%esp
+  80285a:	85 c0                	test   %eax,%eax
+  80285c:	7e 17                	jle    802875 <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  80285e:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  802862:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  802869:	89 c2                	mov    %eax,%edx
+  80286b:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  80286e:	89 d0                	mov    %edx,%eax
+  802870:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802873:	c9                   	leave
+  802874:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802875:	c1 f8 1f             	sar    $0x1f,%eax
+  802878:	83 e0 04             	and    $0x4,%eax
+  80287b:	83 c0 04             	add    $0x4,%eax
+  80287e:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  802881:	ba 00 00 00 00       	mov    $0x0,%edx
+  802886:	eb e6                	jmp    80286e <stream_fill+0x56>
+
+00802888 <fopen>:
+{
+  802888:	55                   	push   %ebp
+  802889:	89 e5                	mov    %esp,%ebp
+  80288b:	57                   	push   %edi
+  80288c:	56                   	push   %esi
+  80288d:	53                   	push   %ebx
+  80288e:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  802894:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  802897:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  80289d:	89 f0                	mov    %esi,%eax
+  80289f:	e8 40 fd ff ff       	call   8025e4 <parse_mode>
+		return 0;
+  8028a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8028a9:	85 c0                	test   %eax,%eax
+  8028ab:	78 2d                	js     8028da <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  8028ad:	83 ec 08             	sub    $0x8,%esp
+  8028b0:	50                   	push   %eax
+  8028b1:	ff 75 08             	push   0x8(%ebp)
+  8028b4:	e8 e8 f8 ff ff       	call   8021a1 <open>
+  8028b9:	89 c7                	mov    %eax,%edi
+  8028bb:	83 c4 10             	add    $0x10,%esp
+  8028be:	85 c0                	test   %eax,%eax
+  8028c0:	78 58                	js     80291a <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  8028c2:	80 3e 61             	cmpb   $0x61,(%esi)
+  8028c5:	74 1d                	je     8028e4 <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  8028c7:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  8028cd:	89 f8                	mov    %edi,%eax
+  8028cf:	e8 7b fd ff ff       	call   80264f <stream_alloc>
+  8028d4:	89 c3                	mov    %eax,%ebx
+  8028d6:	85 c0                	test   %eax,%eax
+  8028d8:	74 32                	je     80290c <fopen+0x84>
+}
+  8028da:	89 d8                	mov    %ebx,%eax
+  8028dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028df:	5b                   	pop    %ebx
+  8028e0:	5e                   	pop    %esi
+  8028e1:	5f                   	pop    %edi
+  8028e2:	5d                   	pop    %ebp
+  8028e3:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  8028e4:	83 ec 08             	sub    $0x8,%esp
+  8028e7:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  8028ed:	50                   	push   %eax
+  8028ee:	57                   	push   %edi
+  8028ef:	e8 db f4 ff ff       	call   801dcf <fstat>
+  8028f4:	83 c4 10             	add    $0x10,%esp
+  8028f7:	85 c0                	test   %eax,%eax
+  8028f9:	78 cc                	js     8028c7 <fopen+0x3f>
+		seek(fd, st.st_size);
+  8028fb:	83 ec 08             	sub    $0x8,%esp
+  8028fe:	ff 75 dc             	push   -0x24(%ebp)
+  802901:	57                   	push   %edi
+  802902:	e8 f6 f3 ff ff       	call   801cfd <seek>
+  802907:	83 c4 10             	add    $0x10,%esp
+  80290a:	eb bb                	jmp    8028c7 <fopen+0x3f>
+		close(fd);
+  80290c:	83 ec 0c             	sub    $0xc,%esp
+  80290f:	57                   	push   %edi
+  802910:	e8 08 f1 ff ff       	call   801a1d <close>
+  802915:	83 c4 10             	add    $0x10,%esp
+  802918:	eb c0                	jmp    8028da <fopen+0x52>
+		return 0;
+  80291a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80291f:	eb b9                	jmp    8028da <fopen+0x52>
+
+00802921 <fdopen>:
+{
+  802921:	55                   	push   %ebp
+  802922:	89 e5                	mov    %esp,%ebp
+  802924:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  802927:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80292a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80292d:	e8 b2 fc ff ff       	call   8025e4 <parse_mode>
+  802932:	89 c2                	mov    %eax,%edx
+		return 0;
+  802934:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  802939:	85 d2                	test   %edx,%edx
+  80293b:	78 0b                	js     802948 <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  80293d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802940:	8b 45 08             	mov    0x8(%ebp),%eax
+  802943:	e8 07 fd ff ff       	call   80264f <stream_alloc>
+}
+  802948:	c9                   	leave
+  802949:	c3                   	ret
+
+0080294a <setvbuf>:
+{
+  80294a:	55                   	push   %ebp
+  80294b:	89 e5                	mov    %esp,%ebp
+  80294d:	57                   	push   %edi
+  80294e:	56                   	push   %esi
+  80294f:	53                   	push   %ebx
+  802950:	8b 45 08             	mov    0x8(%ebp),%eax
+  802953:	8b 55 10             	mov    0x10(%ebp),%edx
+  802956:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  802959:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  80295d:	75 3a                	jne    802999 <setvbuf+0x4f>
+  80295f:	8d 72 ff             	lea    -0x1(%edx),%esi
+  802962:	83 fe 02             	cmp    $0x2,%esi
+  802965:	77 39                	ja     8029a0 <setvbuf+0x56>
+	f->f_bufmode = mode;
+  802967:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  80296a:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80296e:	0f 95 c3             	setne  %bl
+  802971:	85 ff                	test   %edi,%edi
+  802973:	0f 95 c1             	setne  %cl
+  802976:	84 cb                	test   %cl,%bl
+  802978:	74 05                	je     80297f <setvbuf+0x35>
+  80297a:	83 fa 03             	cmp    $0x3,%edx
+  80297d:	75 0a                	jne    802989 <setvbuf+0x3f>
+	return 0;
+  80297f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802984:	5b                   	pop    %ebx
+  802985:	5e                   	pop    %esi
+  802986:	5f                   	pop    %edi
+  802987:	5d                   	pop    %ebp
+  802988:	c3                   	ret
+		f->f_buf = buf;
+  802989:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80298c:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  80298f:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  802992:	b8 00 00 00 00       	mov    $0x0,%eax
+  802997:	eb eb                	jmp    802984 <setvbuf+0x3a>
+		return EOF;
+  802999:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80299e:	eb e4                	jmp    802984 <setvbuf+0x3a>
+  8029a0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8029a5:	eb dd                	jmp    802984 <setvbuf+0x3a>
+
+008029a7 <fflush>:
+{
+  8029a7:	55                   	push   %ebp
+  8029a8:	89 e5                	mov    %esp,%ebp
+  8029aa:	57                   	push   %edi
+  8029ab:	56                   	push   %esi
+  8029ac:	53                   	push   %ebx
+  8029ad:	83 ec 0c             	sub    $0xc,%esp
+  8029b0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  8029b3:	85 db                	test   %ebx,%ebx
+  8029b5:	74 1a                	je     8029d1 <fflush+0x2a>
+	stream_unread(f);
+  8029b7:	89 d8                	mov    %ebx,%eax
+  8029b9:	e8 0a fd ff ff       	call   8026c8 <stream_unread>
+	return stream_drain(f);
+  8029be:	89 d8                	mov    %ebx,%eax
+  8029c0:	e8 76 fd ff ff       	call   80273b <stream_drain>
+  8029c5:	89 c7                	mov    %eax,%edi
+}
+  8029c7:	89 f8                	mov    %edi,%eax
+  8029c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029cc:	5b                   	pop    %ebx
+  8029cd:	5e                   	pop    %esi
+  8029ce:	5f                   	pop    %edi
+  8029cf:	5d                   	pop    %ebp
+  8029d0:	c3                   	ret
+  8029d1:	bb 40 60 80 00       	mov    $0x806040,%ebx
+  8029d6:	be 80 62 80 00       	mov    $0x806280,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  8029db:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029e0:	eb 03                	jmp    8029e5 <fflush+0x3e>
+  8029e2:	83 c3 24             	add    $0x24,%ebx
+  8029e5:	39 f3                	cmp    %esi,%ebx
+  8029e7:	74 de                	je     8029c7 <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  8029e9:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  8029ed:	74 f3                	je     8029e2 <fflush+0x3b>
+  8029ef:	83 ec 0c             	sub    $0xc,%esp
+  8029f2:	53                   	push   %ebx
+  8029f3:	e8 af ff ff ff       	call   8029a7 <fflush>
+  8029f8:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  8029fb:	85 c0                	test   %eax,%eax
+  8029fd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802a02:	0f 48 f8             	cmovs  %eax,%edi
+  802a05:	eb db                	jmp    8029e2 <fflush+0x3b>
+
+00802a07 <fclose>:
+{
+  802a07:	55                   	push   %ebp
+  802a08:	89 e5                	mov    %esp,%ebp
+  802a0a:	56                   	push   %esi
+  802a0b:	53                   	push   %ebx
+  802a0c:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  802a0f:	83 ec 0c             	sub    $0xc,%esp
+  802a12:	56                   	push   %esi
+  802a13:	e8 8f ff ff ff       	call   8029a7 <fflush>
+  802a18:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  802a1a:	83 c4 04             	add    $0x4,%esp
+  802a1d:	ff 36                	push   (%esi)
+  802a1f:	e8 f9 ef ff ff       	call   801a1d <close>
+  802a24:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  802a27:	85 c0                	test   %eax,%eax
+  802a29:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802a2e:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  802a31:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  802a35:	75 10                	jne    802a47 <fclose+0x40>
+	f->f_flags = 0;
+  802a37:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  802a3e:	89 d8                	mov    %ebx,%eax
+  802a40:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a43:	5b                   	pop    %ebx
+  802a44:	5e                   	pop    %esi
+  802a45:	5d                   	pop    %ebp
+  802a46:	c3                   	ret
+		free(f->f_buf);
+  802a47:	83 ec 0c             	sub    $0xc,%esp
+  802a4a:	ff 76 0c             	push   0xc(%esi)
+  802a4d:	e8 54 08 00 00       	call   8032a6 <free>
+  802a52:	83 c4 10             	add    $0x10,%esp
+  802a55:	eb e0                	jmp    802a37 <fclose+0x30>
+
+00802a57 <fileno>:
+{
+  802a57:	55                   	push   %ebp
+  802a58:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  802a5a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a5d:	8b 00                	mov    (%eax),%eax
+}
+  802a5f:	5d                   	pop    %ebp
+  802a60:	c3                   	ret
+
+00802a61 <feof>:
+{
+  802a61:	55                   	push   %ebp
+  802a62:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  802a64:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a67:	8b 40 04             	mov    0x4(%eax),%eax
+  802a6a:	c1 e8 02             	shr    $0x2,%eax
+  802a6d:	83 e0 01             	and    $0x1,%eax
+}
+  802a70:	5d                   	pop    %ebp
+  802a71:	c3                   	ret
+
+00802a72 <ferror>:
+{
+  802a72:	55                   	push   %ebp
+  802a73:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  802a75:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a78:	8b 40 04             	mov    0x4(%eax),%eax
+  802a7b:	c1 e8 03             	shr    $0x3,%eax
+  802a7e:	83 e0 01             	and    $0x1,%eax
+}
+  802a81:	5d                   	pop    %ebp
+  802a82:	c3                   	ret
+
+00802a83 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  802a83:	55                   	push   %ebp
+  802a84:	89 e5                	mov    %esp,%ebp
+  802a86:	53                   	push   %ebx
+  802a87:	83 ec 04             	sub    $0x4,%esp
+  802a8a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802a8d:	8b 43 18             	mov    0x18(%ebx),%eax
+  802a90:	39 43 14             	cmp    %eax,0x14(%ebx)
+  802a93:	74 15                	je     802aaa <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  802a95:	8b 53 0c             	mov    0xc(%ebx),%edx
+  802a98:	8b 43 14             	mov    0x14(%ebx),%eax
+  802a9b:	8d 48 01             	lea    0x1(%eax),%ecx
+  802a9e:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  802aa1:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  802aa5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802aa8:	c9                   	leave
+  802aa9:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802aaa:	89 d8                	mov    %ebx,%eax
+  802aac:	e8 67 fd ff ff       	call   802818 <stream_fill>
+  802ab1:	85 c0                	test   %eax,%eax
+  802ab3:	75 e0                	jne    802a95 <fgetc+0x12>
+		return EOF;
+  802ab5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802aba:	eb e9                	jmp    802aa5 <fgetc+0x22>
+
+00802abc <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  802abc:	55                   	push   %ebp
+  802abd:	89 e5                	mov    %esp,%ebp
+  802abf:	57                   	push   %edi
+  802ac0:	56                   	push   %esi
+  802ac1:	53                   	push   %ebx
+  802ac2:	83 ec 1c             	sub    $0x1c,%esp
+  802ac5:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  802ac8:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802acd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ad0:	83 e8 01             	sub    $0x1,%eax
+  802ad3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  802ad6:	eb 66                	jmp    802b3e <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802ad8:	8b 46 14             	mov    0x14(%esi),%eax
+  802adb:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802ade:	29 c3                	sub    %eax,%ebx
+  802ae0:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802ae3:	29 fa                	sub    %edi,%edx
+  802ae5:	39 d3                	cmp    %edx,%ebx
+  802ae7:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802aea:	83 ec 04             	sub    $0x4,%esp
+  802aed:	53                   	push   %ebx
+  802aee:	6a 0a                	push   $0xa
+  802af0:	03 46 0c             	add    0xc(%esi),%eax
+  802af3:	50                   	push   %eax
+  802af4:	e8 1f e5 ff ff       	call   801018 <memfind>
+  802af9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  802afc:	8b 46 0c             	mov    0xc(%esi),%eax
+  802aff:	8b 4e 14             	mov    0x14(%esi),%ecx
+  802b02:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  802b05:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802b07:	83 c4 10             	add    $0x10,%esp
+  802b0a:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802b0d:	74 0b                	je     802b1a <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  802b0f:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802b12:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802b15:	29 d3                	sub    %edx,%ebx
+  802b17:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  802b1a:	83 ec 04             	sub    $0x4,%esp
+  802b1d:	53                   	push   %ebx
+  802b1e:	01 c8                	add    %ecx,%eax
+  802b20:	50                   	push   %eax
+  802b21:	89 f8                	mov    %edi,%eax
+  802b23:	03 45 08             	add    0x8(%ebp),%eax
+  802b26:	50                   	push   %eax
+  802b27:	e8 3b e4 ff ff       	call   800f67 <memmove>
+		f->f_rpos += m;
+  802b2c:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  802b2f:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  802b31:	83 c4 10             	add    $0x10,%esp
+  802b34:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b37:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  802b3c:	74 1f                	je     802b5d <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  802b3e:	8d 47 01             	lea    0x1(%edi),%eax
+  802b41:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  802b44:	73 17                	jae    802b5d <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802b46:	8b 46 18             	mov    0x18(%esi),%eax
+  802b49:	39 46 14             	cmp    %eax,0x14(%esi)
+  802b4c:	75 8a                	jne    802ad8 <fgets+0x1c>
+  802b4e:	89 f0                	mov    %esi,%eax
+  802b50:	e8 c3 fc ff ff       	call   802818 <stream_fill>
+  802b55:	85 c0                	test   %eax,%eax
+  802b57:	0f 85 7b ff ff ff    	jne    802ad8 <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  802b5d:	85 ff                	test   %edi,%edi
+  802b5f:	74 0f                	je     802b70 <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  802b61:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b64:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  802b68:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b6b:	5b                   	pop    %ebx
+  802b6c:	5e                   	pop    %esi
+  802b6d:	5f                   	pop    %edi
+  802b6e:	5d                   	pop    %ebp
+  802b6f:	c3                   	ret
+		return 0;
+  802b70:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b75:	eb f1                	jmp    802b68 <fgets+0xac>
+
+00802b77 <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  802b77:	55                   	push   %ebp
+  802b78:	89 e5                	mov    %esp,%ebp
+  802b7a:	57                   	push   %edi
+  802b7b:	56                   	push   %esi
+  802b7c:	53                   	push   %ebx
+  802b7d:	83 ec 1c             	sub    $0x1c,%esp
+  802b80:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  802b83:	89 f0                	mov    %esi,%eax
+  802b85:	e8 21 fc ff ff       	call   8027ab <stream_setup>
+	want = size * n;
+  802b8a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b8d:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802b91:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  802b94:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b99:	eb 43                	jmp    802bde <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  802b9b:	29 d3                	sub    %edx,%ebx
+  802b9d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802ba0:	29 f8                	sub    %edi,%eax
+  802ba2:	39 c3                	cmp    %eax,%ebx
+  802ba4:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  802ba7:	83 ec 04             	sub    $0x4,%esp
+  802baa:	53                   	push   %ebx
+  802bab:	03 56 0c             	add    0xc(%esi),%edx
+  802bae:	52                   	push   %edx
+  802baf:	89 f8                	mov    %edi,%eax
+  802bb1:	03 45 08             	add    0x8(%ebp),%eax
+  802bb4:	50                   	push   %eax
+  802bb5:	e8 ad e3 ff ff       	call   800f67 <memmove>
+			f->f_rpos += m;
+  802bba:	01 5e 14             	add    %ebx,0x14(%esi)
+  802bbd:	83 c4 10             	add    $0x10,%esp
+  802bc0:	eb 1a                	jmp    802bdc <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  802bc2:	83 ec 04             	sub    $0x4,%esp
+  802bc5:	53                   	push   %ebx
+  802bc6:	89 f8                	mov    %edi,%eax
+  802bc8:	03 45 08             	add    0x8(%ebp),%eax
+  802bcb:	50                   	push   %eax
+  802bcc:	ff 36                	push   (%esi)
+  802bce:	e8 86 ef ff ff       	call   801b59 <read>
+  802bd3:	89 c3                	mov    %eax,%ebx
+  802bd5:	83 c4 10             	add    $0x10,%esp
+  802bd8:	85 c0                	test   %eax,%eax
+  802bda:	7e 36                	jle    802c12 <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  802bdc:	01 df                	add    %ebx,%edi
+  802bde:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802be1:	39 c7                	cmp    %eax,%edi
+  802be3:	73 39                	jae    802c1e <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  802be5:	8b 56 14             	mov    0x14(%esi),%edx
+  802be8:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802beb:	39 da                	cmp    %ebx,%edx
+  802bed:	72 ac                	jb     802b9b <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  802bef:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802bf2:	29 fb                	sub    %edi,%ebx
+  802bf4:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  802bf7:	72 3e                	jb     802c37 <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  802bf9:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  802bfd:	74 1f                	je     802c1e <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  802bff:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  802c03:	74 bd                	je     802bc2 <fread+0x4b>
+  802c05:	89 f0                	mov    %esi,%eax
+  802c07:	e8 2f fb ff ff       	call   80273b <stream_drain>
+  802c0c:	85 c0                	test   %eax,%eax
+  802c0e:	79 b2                	jns    802bc2 <fread+0x4b>
+  802c10:	eb 0c                	jmp    802c1e <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802c12:	c1 fb 1f             	sar    $0x1f,%ebx
+  802c15:	83 e3 04             	and    $0x4,%ebx
+  802c18:	83 c3 04             	add    $0x4,%ebx
+  802c1b:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  802c1e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c21:	85 c0                	test   %eax,%eax
+  802c23:	74 0a                	je     802c2f <fread+0xb8>
+  802c25:	89 f8                	mov    %edi,%eax
+  802c27:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c2c:	f7 75 0c             	divl   0xc(%ebp)
+}
+  802c2f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c32:	5b                   	pop    %ebx
+  802c33:	5e                   	pop    %esi
+  802c34:	5f                   	pop    %edi
+  802c35:	5d                   	pop    %ebp
+  802c36:	c3                   	ret
+		} else if (!stream_fill(f))
+  802c37:	89 f0                	mov    %esi,%eax
+  802c39:	e8 da fb ff ff       	call   802818 <stream_fill>
+  802c3e:	85 c0                	test   %eax,%eax
+  802c40:	74 dc                	je     802c1e <fread+0xa7>
+			m = 0;
+  802c42:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c47:	eb 93                	jmp    802bdc <fread+0x65>
+
+00802c49 <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  802c49:	55                   	push   %ebp
+  802c4a:	89 e5                	mov    %esp,%ebp
+  802c4c:	57                   	push   %edi
+  802c4d:	56                   	push   %esi
+  802c4e:	53                   	push   %ebx
+  802c4f:	83 ec 1c             	sub    $0x1c,%esp
+  802c52:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  802c55:	8b 43 04             	mov    0x4(%ebx),%eax
+  802c58:	a8 02                	test   $0x2,%al
+  802c5a:	75 13                	jne    802c6f <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  802c5c:	83 c8 08             	or     $0x8,%eax
+  802c5f:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  802c62:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  802c67:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c6a:	5b                   	pop    %ebx
+  802c6b:	5e                   	pop    %esi
+  802c6c:	5f                   	pop    %edi
+  802c6d:	5d                   	pop    %ebp
+  802c6e:	c3                   	ret
+	stream_setup(f);
+  802c6f:	89 d8                	mov    %ebx,%eax
+  802c71:	e8 35 fb ff ff       	call   8027ab <stream_setup>
+	want = size * n;
+  802c76:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c79:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802c7d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  802c80:	89 d8                	mov    %ebx,%eax
+  802c82:	e8 41 fa ff ff       	call   8026c8 <stream_unread>
+	for (done = 0; done < want; ) {
+  802c87:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  802c8c:	84 c0                	test   %al,%al
+  802c8e:	75 7b                	jne    802d0b <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  802c90:	be 00 00 00 00       	mov    $0x0,%esi
+  802c95:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802c98:	39 fe                	cmp    %edi,%esi
+  802c9a:	73 24                	jae    802cc0 <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802c9c:	83 ec 04             	sub    $0x4,%esp
+  802c9f:	89 f8                	mov    %edi,%eax
+  802ca1:	29 f0                	sub    %esi,%eax
+  802ca3:	50                   	push   %eax
+  802ca4:	89 f0                	mov    %esi,%eax
+  802ca6:	03 45 08             	add    0x8(%ebp),%eax
+  802ca9:	50                   	push   %eax
+  802caa:	ff 33                	push   (%ebx)
+  802cac:	e8 a0 ef ff ff       	call   801c51 <write>
+  802cb1:	83 c4 10             	add    $0x10,%esp
+  802cb4:	85 c0                	test   %eax,%eax
+  802cb6:	7e 04                	jle    802cbc <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  802cb8:	01 c6                	add    %eax,%esi
+  802cba:	eb dc                	jmp    802c98 <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  802cbc:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  802cc0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802cc3:	85 c0                	test   %eax,%eax
+  802cc5:	74 a0                	je     802c67 <fwrite+0x1e>
+  802cc7:	89 f0                	mov    %esi,%eax
+  802cc9:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cce:	f7 75 0c             	divl   0xc(%ebp)
+  802cd1:	eb 94                	jmp    802c67 <fwrite+0x1e>
+			done += r;
+  802cd3:	01 c7                	add    %eax,%edi
+			continue;
+  802cd5:	eb 34                	jmp    802d0b <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  802cd7:	8b 73 10             	mov    0x10(%ebx),%esi
+  802cda:	29 c6                	sub    %eax,%esi
+  802cdc:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802cdf:	29 fa                	sub    %edi,%edx
+  802ce1:	39 d6                	cmp    %edx,%esi
+  802ce3:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  802ce6:	83 ec 04             	sub    $0x4,%esp
+  802ce9:	56                   	push   %esi
+  802cea:	89 fa                	mov    %edi,%edx
+  802cec:	03 55 08             	add    0x8(%ebp),%edx
+  802cef:	52                   	push   %edx
+  802cf0:	03 43 0c             	add    0xc(%ebx),%eax
+  802cf3:	50                   	push   %eax
+  802cf4:	e8 6e e2 ff ff       	call   800f67 <memmove>
+		f->f_wend += m;
+  802cf9:	89 f0                	mov    %esi,%eax
+  802cfb:	03 43 1c             	add    0x1c(%ebx),%eax
+  802cfe:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  802d01:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802d03:	83 c4 10             	add    $0x10,%esp
+  802d06:	3b 43 10             	cmp    0x10(%ebx),%eax
+  802d09:	74 5b                	je     802d66 <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  802d0b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802d0e:	39 c7                	cmp    %eax,%edi
+  802d10:	73 2d                	jae    802d3f <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  802d12:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802d15:	85 c0                	test   %eax,%eax
+  802d17:	75 be                	jne    802cd7 <fwrite+0x8e>
+  802d19:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802d1c:	29 fa                	sub    %edi,%edx
+  802d1e:	3b 53 10             	cmp    0x10(%ebx),%edx
+  802d21:	72 b4                	jb     802cd7 <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802d23:	83 ec 04             	sub    $0x4,%esp
+  802d26:	52                   	push   %edx
+  802d27:	89 f8                	mov    %edi,%eax
+  802d29:	03 45 08             	add    0x8(%ebp),%eax
+  802d2c:	50                   	push   %eax
+  802d2d:	ff 33                	push   (%ebx)
+  802d2f:	e8 1d ef ff ff       	call   801c51 <write>
+  802d34:	83 c4 10             	add    $0x10,%esp
+  802d37:	85 c0                	test   %eax,%eax
+  802d39:	7f 98                	jg     802cd3 <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  802d3b:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  802d3f:	8b 43 08             	mov    0x8(%ebx),%eax
+  802d42:	83 f8 03             	cmp    $0x3,%eax
+  802d45:	74 48                	je     802d8f <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802d47:	83 f8 02             	cmp    $0x2,%eax
+  802d4a:	74 27                	je     802d73 <fwrite+0x12a>
+	return size ? done / size : 0;
+  802d4c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d4f:	85 c0                	test   %eax,%eax
+  802d51:	0f 84 10 ff ff ff    	je     802c67 <fwrite+0x1e>
+  802d57:	89 f8                	mov    %edi,%eax
+  802d59:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d5e:	f7 75 0c             	divl   0xc(%ebp)
+  802d61:	e9 01 ff ff ff       	jmp    802c67 <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802d66:	89 d8                	mov    %ebx,%eax
+  802d68:	e8 ce f9 ff ff       	call   80273b <stream_drain>
+  802d6d:	85 c0                	test   %eax,%eax
+  802d6f:	79 9a                	jns    802d0b <fwrite+0xc2>
+  802d71:	eb cc                	jmp    802d3f <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802d73:	83 ec 04             	sub    $0x4,%esp
+  802d76:	57                   	push   %edi
+  802d77:	6a 0a                	push   $0xa
+  802d79:	ff 75 08             	push   0x8(%ebp)
+  802d7c:	e8 97 e2 ff ff       	call   801018 <memfind>
+  802d81:	89 c2                	mov    %eax,%edx
+  802d83:	89 f8                	mov    %edi,%eax
+  802d85:	03 45 08             	add    0x8(%ebp),%eax
+  802d88:	83 c4 10             	add    $0x10,%esp
+  802d8b:	39 c2                	cmp    %eax,%edx
+  802d8d:	74 bd                	je     802d4c <fwrite+0x103>
+		stream_drain(f);
+  802d8f:	89 d8                	mov    %ebx,%eax
+  802d91:	e8 a5 f9 ff ff       	call   80273b <stream_drain>
+  802d96:	eb b4                	jmp    802d4c <fwrite+0x103>
+
+00802d98 <fputc>:
+{
+  802d98:	55                   	push   %ebp
+  802d99:	89 e5                	mov    %esp,%ebp
+  802d9b:	53                   	push   %ebx
+  802d9c:	83 ec 14             	sub    $0x14,%esp
+  802d9f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  802da2:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  802da5:	ff 75 0c             	push   0xc(%ebp)
+  802da8:	6a 01                	push   $0x1
+  802daa:	6a 01                	push   $0x1
+  802dac:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802daf:	50                   	push   %eax
+  802db0:	e8 94 fe ff ff       	call   802c49 <fwrite>
+  802db5:	83 c4 10             	add    $0x10,%esp
+  802db8:	0f b6 db             	movzbl %bl,%ebx
+  802dbb:	83 f8 01             	cmp    $0x1,%eax
+  802dbe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802dc3:	0f 44 c3             	cmove  %ebx,%eax
+}
+  802dc6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802dc9:	c9                   	leave
+  802dca:	c3                   	ret
+
+00802dcb <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  802dcb:	55                   	push   %ebp
+  802dcc:	89 e5                	mov    %esp,%ebp
+  802dce:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  802dd1:	ff 75 0c             	push   0xc(%ebp)
+  802dd4:	ff 75 08             	push   0x8(%ebp)
+  802dd7:	e8 bc ff ff ff       	call   802d98 <fputc>
+}
+  802ddc:	83 c4 10             	add    $0x10,%esp
+  802ddf:	c9                   	leave
+  802de0:	c3                   	ret
+
+00802de1 <fputs>:
+{
+  802de1:	55                   	push   %ebp
+  802de2:	89 e5                	mov    %esp,%ebp
+  802de4:	56                   	push   %esi
+  802de5:	53                   	push   %ebx
+  802de6:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  802de9:	83 ec 0c             	sub    $0xc,%esp
+  802dec:	56                   	push   %esi
+  802ded:	e8 b4 df ff ff       	call   800da6 <strlen>
+  802df2:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  802df4:	ff 75 0c             	push   0xc(%ebp)
+  802df7:	50                   	push   %eax
+  802df8:	6a 01                	push   $0x1
+  802dfa:	56                   	push   %esi
+  802dfb:	e8 49 fe ff ff       	call   802c49 <fwrite>
+  802e00:	83 c4 20             	add    $0x20,%esp
+  802e03:	39 d8                	cmp    %ebx,%eax
+  802e05:	0f 95 c0             	setne  %al
+  802e08:	0f b6 c0             	movzbl %al,%eax
+  802e0b:	f7 d8                	neg    %eax
+}
+  802e0d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e10:	5b                   	pop    %ebx
+  802e11:	5e                   	pop    %esi
+  802e12:	5d                   	pop    %ebp
+  802e13:	c3                   	ret
+
+00802e14 <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  802e14:	55                   	push   %ebp
+  802e15:	89 e5                	mov    %esp,%ebp
+  802e17:	53                   	push   %ebx
+  802e18:	83 ec 04             	sub    $0x4,%esp
+  802e1b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802e1e:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  802e21:	50                   	push   %eax
+  802e22:	ff 75 0c             	push   0xc(%ebp)
+  802e25:	53                   	push   %ebx
+  802e26:	68 cb 2d 80 00       	push   $0x802dcb
+  802e2b:	e8 c4 da ff ff       	call   8008f4 <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  802e30:	8b 43 04             	mov    0x4(%ebx),%eax
+  802e33:	c1 e0 1c             	shl    $0x1c,%eax
+  802e36:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  802e39:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e3c:	c9                   	leave
+  802e3d:	c3                   	ret
+
+00802e3e <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802e3e:	55                   	push   %ebp
+  802e3f:	89 e5                	mov    %esp,%ebp
+  802e41:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802e44:	68 ec 55 80 00       	push   $0x8055ec
+  802e49:	ff 75 0c             	push   0xc(%ebp)
+  802e4c:	e8 90 df ff ff       	call   800de1 <strcpy>
+	return 0;
+}
+  802e51:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e56:	c9                   	leave
+  802e57:	c3                   	ret
+
+00802e58 <devsock_close>:
+{
+  802e58:	55                   	push   %ebp
+  802e59:	89 e5                	mov    %esp,%ebp
+  802e5b:	53                   	push   %ebx
+  802e5c:	83 ec 10             	sub    $0x10,%esp
+  802e5f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802e62:	53                   	push   %ebx
+  802e63:	e8 98 1b 00 00       	call   804a00 <pageref>
+  802e68:	89 c2                	mov    %eax,%edx
+  802e6a:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802e6d:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802e72:	83 fa 01             	cmp    $0x1,%edx
+  802e75:	74 05                	je     802e7c <devsock_close+0x24>
+}
+  802e77:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e7a:	c9                   	leave
+  802e7b:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802e7c:	83 ec 0c             	sub    $0xc,%esp
+  802e7f:	ff 73 0c             	push   0xc(%ebx)
+  802e82:	e8 b7 02 00 00       	call   80313e <nsipc_close>
+  802e87:	83 c4 10             	add    $0x10,%esp
+  802e8a:	eb eb                	jmp    802e77 <devsock_close+0x1f>
+
+00802e8c <devsock_write>:
+{
+  802e8c:	55                   	push   %ebp
+  802e8d:	89 e5                	mov    %esp,%ebp
+  802e8f:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802e92:	6a 00                	push   $0x0
+  802e94:	ff 75 10             	push   0x10(%ebp)
+  802e97:	ff 75 0c             	push   0xc(%ebp)
+  802e9a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e9d:	ff 70 0c             	push   0xc(%eax)
+  802ea0:	e8 79 03 00 00       	call   80321e <nsipc_send>
+}
+  802ea5:	c9                   	leave
+  802ea6:	c3                   	ret
+
+00802ea7 <devsock_read>:
+{
+  802ea7:	55                   	push   %ebp
+  802ea8:	89 e5                	mov    %esp,%ebp
+  802eaa:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802ead:	6a 00                	push   $0x0
+  802eaf:	ff 75 10             	push   0x10(%ebp)
+  802eb2:	ff 75 0c             	push   0xc(%ebp)
+  802eb5:	8b 45 08             	mov    0x8(%ebp),%eax
+  802eb8:	ff 70 0c             	push   0xc(%eax)
+  802ebb:	e8 ef 02 00 00       	call   8031af <nsipc_recv>
+}
+  802ec0:	c9                   	leave
+  802ec1:	c3                   	ret
+
+00802ec2 <fd2sockid>:
+{
+  802ec2:	55                   	push   %ebp
+  802ec3:	89 e5                	mov    %esp,%ebp
+  802ec5:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802ec8:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802ecb:	52                   	push   %edx
+  802ecc:	50                   	push   %eax
+  802ecd:	e8 f7 e9 ff ff       	call   8018c9 <fd_lookup>
+  802ed2:	83 c4 10             	add    $0x10,%esp
+  802ed5:	85 c0                	test   %eax,%eax
+  802ed7:	78 10                	js     802ee9 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802ed9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802edc:	8b 0d 80 62 80 00    	mov    0x806280,%ecx
+  802ee2:	39 08                	cmp    %ecx,(%eax)
+  802ee4:	75 05                	jne    802eeb <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802ee6:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802ee9:	c9                   	leave
+  802eea:	c3                   	ret
+		return -E_NOT_SUPP;
+  802eeb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802ef0:	eb f7                	jmp    802ee9 <fd2sockid+0x27>
+
+00802ef2 <alloc_sockfd>:
+{
+  802ef2:	55                   	push   %ebp
+  802ef3:	89 e5                	mov    %esp,%ebp
+  802ef5:	56                   	push   %esi
+  802ef6:	53                   	push   %ebx
+  802ef7:	83 ec 1c             	sub    $0x1c,%esp
+  802efa:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802efc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802eff:	50                   	push   %eax
+  802f00:	e8 6e e9 ff ff       	call   801873 <fd_alloc>
+  802f05:	89 c3                	mov    %eax,%ebx
+  802f07:	83 c4 10             	add    $0x10,%esp
+  802f0a:	85 c0                	test   %eax,%eax
+  802f0c:	78 43                	js     802f51 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802f0e:	83 ec 04             	sub    $0x4,%esp
+  802f11:	68 07 04 00 00       	push   $0x407
+  802f16:	ff 75 f4             	push   -0xc(%ebp)
+  802f19:	6a 00                	push   $0x0
+  802f1b:	e8 ff e2 ff ff       	call   80121f <sys_page_alloc>
+  802f20:	89 c3                	mov    %eax,%ebx
+  802f22:	83 c4 10             	add    $0x10,%esp
+  802f25:	85 c0                	test   %eax,%eax
+  802f27:	78 28                	js     802f51 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802f29:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f2c:	8b 15 80 62 80 00    	mov    0x806280,%edx
+  802f32:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802f34:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f37:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802f3e:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802f41:	83 ec 0c             	sub    $0xc,%esp
+  802f44:	50                   	push   %eax
+  802f45:	e8 02 e9 ff ff       	call   80184c <fd2num>
+  802f4a:	89 c3                	mov    %eax,%ebx
+  802f4c:	83 c4 10             	add    $0x10,%esp
+  802f4f:	eb 0c                	jmp    802f5d <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802f51:	83 ec 0c             	sub    $0xc,%esp
+  802f54:	56                   	push   %esi
+  802f55:	e8 e4 01 00 00       	call   80313e <nsipc_close>
+		return r;
+  802f5a:	83 c4 10             	add    $0x10,%esp
+}
+  802f5d:	89 d8                	mov    %ebx,%eax
+  802f5f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f62:	5b                   	pop    %ebx
+  802f63:	5e                   	pop    %esi
+  802f64:	5d                   	pop    %ebp
+  802f65:	c3                   	ret
+
+00802f66 <accept>:
+{
+  802f66:	55                   	push   %ebp
+  802f67:	89 e5                	mov    %esp,%ebp
+  802f69:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802f6c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f6f:	e8 4e ff ff ff       	call   802ec2 <fd2sockid>
+  802f74:	85 c0                	test   %eax,%eax
+  802f76:	78 1b                	js     802f93 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802f78:	83 ec 04             	sub    $0x4,%esp
+  802f7b:	ff 75 10             	push   0x10(%ebp)
+  802f7e:	ff 75 0c             	push   0xc(%ebp)
+  802f81:	50                   	push   %eax
+  802f82:	e8 0e 01 00 00       	call   803095 <nsipc_accept>
+  802f87:	83 c4 10             	add    $0x10,%esp
+  802f8a:	85 c0                	test   %eax,%eax
+  802f8c:	78 05                	js     802f93 <accept+0x2d>
+	return alloc_sockfd(r);
+  802f8e:	e8 5f ff ff ff       	call   802ef2 <alloc_sockfd>
+}
+  802f93:	c9                   	leave
+  802f94:	c3                   	ret
+
+00802f95 <bind>:
+{
+  802f95:	55                   	push   %ebp
+  802f96:	89 e5                	mov    %esp,%ebp
+  802f98:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802f9b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f9e:	e8 1f ff ff ff       	call   802ec2 <fd2sockid>
+  802fa3:	85 c0                	test   %eax,%eax
+  802fa5:	78 12                	js     802fb9 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802fa7:	83 ec 04             	sub    $0x4,%esp
+  802faa:	ff 75 10             	push   0x10(%ebp)
+  802fad:	ff 75 0c             	push   0xc(%ebp)
+  802fb0:	50                   	push   %eax
+  802fb1:	e8 31 01 00 00       	call   8030e7 <nsipc_bind>
+  802fb6:	83 c4 10             	add    $0x10,%esp
+}
+  802fb9:	c9                   	leave
+  802fba:	c3                   	ret
+
+00802fbb <shutdown>:
+{
+  802fbb:	55                   	push   %ebp
+  802fbc:	89 e5                	mov    %esp,%ebp
+  802fbe:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802fc1:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fc4:	e8 f9 fe ff ff       	call   802ec2 <fd2sockid>
+  802fc9:	85 c0                	test   %eax,%eax
+  802fcb:	78 0f                	js     802fdc <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802fcd:	83 ec 08             	sub    $0x8,%esp
+  802fd0:	ff 75 0c             	push   0xc(%ebp)
+  802fd3:	50                   	push   %eax
+  802fd4:	e8 43 01 00 00       	call   80311c <nsipc_shutdown>
+  802fd9:	83 c4 10             	add    $0x10,%esp
+}
+  802fdc:	c9                   	leave
+  802fdd:	c3                   	ret
+
+00802fde <connect>:
+{
+  802fde:	55                   	push   %ebp
+  802fdf:	89 e5                	mov    %esp,%ebp
+  802fe1:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802fe4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fe7:	e8 d6 fe ff ff       	call   802ec2 <fd2sockid>
+  802fec:	85 c0                	test   %eax,%eax
+  802fee:	78 12                	js     803002 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802ff0:	83 ec 04             	sub    $0x4,%esp
+  802ff3:	ff 75 10             	push   0x10(%ebp)
+  802ff6:	ff 75 0c             	push   0xc(%ebp)
+  802ff9:	50                   	push   %eax
+  802ffa:	e8 59 01 00 00       	call   803158 <nsipc_connect>
+  802fff:	83 c4 10             	add    $0x10,%esp
+}
+  803002:	c9                   	leave
+  803003:	c3                   	ret
+
+00803004 <listen>:
+{
+  803004:	55                   	push   %ebp
+  803005:	89 e5                	mov    %esp,%ebp
+  803007:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80300a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80300d:	e8 b0 fe ff ff       	call   802ec2 <fd2sockid>
+  803012:	85 c0                	test   %eax,%eax
+  803014:	78 0f                	js     803025 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  803016:	83 ec 08             	sub    $0x8,%esp
+  803019:	ff 75 0c             	push   0xc(%ebp)
+  80301c:	50                   	push   %eax
+  80301d:	e8 6b 01 00 00       	call   80318d <nsipc_listen>
+  803022:	83 c4 10             	add    $0x10,%esp
+}
+  803025:	c9                   	leave
+  803026:	c3                   	ret
+
+00803027 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  803027:	55                   	push   %ebp
+  803028:	89 e5                	mov    %esp,%ebp
+  80302a:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80302d:	ff 75 10             	push   0x10(%ebp)
+  803030:	ff 75 0c             	push   0xc(%ebp)
+  803033:	ff 75 08             	push   0x8(%ebp)
+  803036:	e8 41 02 00 00       	call   80327c <nsipc_socket>
+  80303b:	83 c4 10             	add    $0x10,%esp
+  80303e:	85 c0                	test   %eax,%eax
+  803040:	78 05                	js     803047 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  803042:	e8 ab fe ff ff       	call   802ef2 <alloc_sockfd>
+}
+  803047:	c9                   	leave
+  803048:	c3                   	ret
+
+00803049 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  803049:	55                   	push   %ebp
+  80304a:	89 e5                	mov    %esp,%ebp
+  80304c:	53                   	push   %ebx
+  80304d:	83 ec 04             	sub    $0x4,%esp
+  803050:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  803052:	83 3d 08 70 80 00 00 	cmpl   $0x0,0x807008
+  803059:	74 26                	je     803081 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  80305b:	6a 07                	push   $0x7
+  80305d:	68 00 90 80 00       	push   $0x809000
+  803062:	53                   	push   %ebx
+  803063:	ff 35 08 70 80 00    	push   0x807008
+  803069:	e8 49 e7 ff ff       	call   8017b7 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  80306e:	83 c4 0c             	add    $0xc,%esp
+  803071:	6a 00                	push   $0x0
+  803073:	6a 00                	push   $0x0
+  803075:	6a 00                	push   $0x0
+  803077:	e8 45 e6 ff ff       	call   8016c1 <ipc_recv>
+}
+  80307c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80307f:	c9                   	leave
+  803080:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  803081:	83 ec 0c             	sub    $0xc,%esp
+  803084:	6a 02                	push   $0x2
+  803086:	e8 82 e7 ff ff       	call   80180d <ipc_find_env>
+  80308b:	a3 08 70 80 00       	mov    %eax,0x807008
+  803090:	83 c4 10             	add    $0x10,%esp
+  803093:	eb c6                	jmp    80305b <nsipc+0x12>
+
+00803095 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  803095:	55                   	push   %ebp
+  803096:	89 e5                	mov    %esp,%ebp
+  803098:	56                   	push   %esi
+  803099:	53                   	push   %ebx
+  80309a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80309d:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030a0:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  8030a5:	8b 06                	mov    (%esi),%eax
+  8030a7:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8030ac:	b8 01 00 00 00       	mov    $0x1,%eax
+  8030b1:	e8 93 ff ff ff       	call   803049 <nsipc>
+  8030b6:	89 c3                	mov    %eax,%ebx
+  8030b8:	85 c0                	test   %eax,%eax
+  8030ba:	79 09                	jns    8030c5 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8030bc:	89 d8                	mov    %ebx,%eax
+  8030be:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8030c1:	5b                   	pop    %ebx
+  8030c2:	5e                   	pop    %esi
+  8030c3:	5d                   	pop    %ebp
+  8030c4:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8030c5:	83 ec 04             	sub    $0x4,%esp
+  8030c8:	ff 35 10 90 80 00    	push   0x809010
+  8030ce:	68 00 90 80 00       	push   $0x809000
+  8030d3:	ff 75 0c             	push   0xc(%ebp)
+  8030d6:	e8 8c de ff ff       	call   800f67 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8030db:	a1 10 90 80 00       	mov    0x809010,%eax
+  8030e0:	89 06                	mov    %eax,(%esi)
+  8030e2:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8030e5:	eb d5                	jmp    8030bc <nsipc_accept+0x27>
+
+008030e7 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8030e7:	55                   	push   %ebp
+  8030e8:	89 e5                	mov    %esp,%ebp
+  8030ea:	53                   	push   %ebx
+  8030eb:	83 ec 08             	sub    $0x8,%esp
+  8030ee:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8030f1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030f4:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8030f9:	53                   	push   %ebx
+  8030fa:	ff 75 0c             	push   0xc(%ebp)
+  8030fd:	68 04 90 80 00       	push   $0x809004
+  803102:	e8 60 de ff ff       	call   800f67 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  803107:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  80310d:	b8 02 00 00 00       	mov    $0x2,%eax
+  803112:	e8 32 ff ff ff       	call   803049 <nsipc>
+}
+  803117:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80311a:	c9                   	leave
+  80311b:	c3                   	ret
+
+0080311c <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80311c:	55                   	push   %ebp
+  80311d:	89 e5                	mov    %esp,%ebp
+  80311f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  803122:	8b 45 08             	mov    0x8(%ebp),%eax
+  803125:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  80312a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80312d:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  803132:	b8 03 00 00 00       	mov    $0x3,%eax
+  803137:	e8 0d ff ff ff       	call   803049 <nsipc>
+}
+  80313c:	c9                   	leave
+  80313d:	c3                   	ret
+
+0080313e <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80313e:	55                   	push   %ebp
+  80313f:	89 e5                	mov    %esp,%ebp
+  803141:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  803144:	8b 45 08             	mov    0x8(%ebp),%eax
+  803147:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  80314c:	b8 04 00 00 00       	mov    $0x4,%eax
+  803151:	e8 f3 fe ff ff       	call   803049 <nsipc>
+}
+  803156:	c9                   	leave
+  803157:	c3                   	ret
+
+00803158 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  803158:	55                   	push   %ebp
+  803159:	89 e5                	mov    %esp,%ebp
+  80315b:	53                   	push   %ebx
+  80315c:	83 ec 08             	sub    $0x8,%esp
+  80315f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  803162:	8b 45 08             	mov    0x8(%ebp),%eax
+  803165:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  80316a:	53                   	push   %ebx
+  80316b:	ff 75 0c             	push   0xc(%ebp)
+  80316e:	68 04 90 80 00       	push   $0x809004
+  803173:	e8 ef dd ff ff       	call   800f67 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  803178:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  80317e:	b8 05 00 00 00       	mov    $0x5,%eax
+  803183:	e8 c1 fe ff ff       	call   803049 <nsipc>
+}
+  803188:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80318b:	c9                   	leave
+  80318c:	c3                   	ret
+
+0080318d <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  80318d:	55                   	push   %ebp
+  80318e:	89 e5                	mov    %esp,%ebp
+  803190:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  803193:	8b 45 08             	mov    0x8(%ebp),%eax
+  803196:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  80319b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80319e:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  8031a3:	b8 06 00 00 00       	mov    $0x6,%eax
+  8031a8:	e8 9c fe ff ff       	call   803049 <nsipc>
+}
+  8031ad:	c9                   	leave
+  8031ae:	c3                   	ret
+
+008031af <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8031af:	55                   	push   %ebp
+  8031b0:	89 e5                	mov    %esp,%ebp
+  8031b2:	56                   	push   %esi
+  8031b3:	53                   	push   %ebx
+  8031b4:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8031b7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031ba:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  8031bf:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  8031c5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8031c8:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8031cd:	b8 07 00 00 00       	mov    $0x7,%eax
+  8031d2:	e8 72 fe ff ff       	call   803049 <nsipc>
+  8031d7:	89 c3                	mov    %eax,%ebx
+  8031d9:	85 c0                	test   %eax,%eax
+  8031db:	78 22                	js     8031ff <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8031dd:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8031e2:	39 c6                	cmp    %eax,%esi
+  8031e4:	0f 4e c6             	cmovle %esi,%eax
+  8031e7:	39 c3                	cmp    %eax,%ebx
+  8031e9:	7f 1d                	jg     803208 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8031eb:	83 ec 04             	sub    $0x4,%esp
+  8031ee:	53                   	push   %ebx
+  8031ef:	68 00 90 80 00       	push   $0x809000
+  8031f4:	ff 75 0c             	push   0xc(%ebp)
+  8031f7:	e8 6b dd ff ff       	call   800f67 <memmove>
+  8031fc:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8031ff:	89 d8                	mov    %ebx,%eax
+  803201:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803204:	5b                   	pop    %ebx
+  803205:	5e                   	pop    %esi
+  803206:	5d                   	pop    %ebp
+  803207:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  803208:	68 f8 55 80 00       	push   $0x8055f8
+  80320d:	68 b1 55 80 00       	push   $0x8055b1
+  803212:	6a 62                	push   $0x62
+  803214:	68 0d 56 80 00       	push   $0x80560d
+  803219:	e8 04 d5 ff ff       	call   800722 <_panic>
+
+0080321e <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80321e:	55                   	push   %ebp
+  80321f:	89 e5                	mov    %esp,%ebp
+  803221:	53                   	push   %ebx
+  803222:	83 ec 04             	sub    $0x4,%esp
+  803225:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  803228:	8b 45 08             	mov    0x8(%ebp),%eax
+  80322b:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  803230:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  803236:	7f 2e                	jg     803266 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  803238:	83 ec 04             	sub    $0x4,%esp
+  80323b:	53                   	push   %ebx
+  80323c:	ff 75 0c             	push   0xc(%ebp)
+  80323f:	68 0c 90 80 00       	push   $0x80900c
+  803244:	e8 1e dd ff ff       	call   800f67 <memmove>
+	nsipcbuf.send.req_size = size;
+  803249:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  80324f:	8b 45 14             	mov    0x14(%ebp),%eax
+  803252:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  803257:	b8 08 00 00 00       	mov    $0x8,%eax
+  80325c:	e8 e8 fd ff ff       	call   803049 <nsipc>
+}
+  803261:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803264:	c9                   	leave
+  803265:	c3                   	ret
+	assert(size < 1600);
+  803266:	68 19 56 80 00       	push   $0x805619
+  80326b:	68 b1 55 80 00       	push   $0x8055b1
+  803270:	6a 6d                	push   $0x6d
+  803272:	68 0d 56 80 00       	push   $0x80560d
+  803277:	e8 a6 d4 ff ff       	call   800722 <_panic>
+
+0080327c <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80327c:	55                   	push   %ebp
+  80327d:	89 e5                	mov    %esp,%ebp
+  80327f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  803282:	8b 45 08             	mov    0x8(%ebp),%eax
+  803285:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  80328a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80328d:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  803292:	8b 45 10             	mov    0x10(%ebp),%eax
+  803295:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  80329a:	b8 09 00 00 00       	mov    $0x9,%eax
+  80329f:	e8 a5 fd ff ff       	call   803049 <nsipc>
+}
+  8032a4:	c9                   	leave
+  8032a5:	c3                   	ret
+
+008032a6 <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  8032a6:	55                   	push   %ebp
+  8032a7:	89 e5                	mov    %esp,%ebp
+  8032a9:	53                   	push   %ebx
+  8032aa:	83 ec 10             	sub    $0x10,%esp
+  8032ad:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  8032b0:	68 0c 70 80 00       	push   $0x80700c
+  8032b5:	e8 50 07 00 00       	call   803a0a <mutex_lock>
+	if (v == 0)
+  8032ba:	83 c4 10             	add    $0x10,%esp
+  8032bd:	85 db                	test   %ebx,%ebx
+  8032bf:	0f 84 85 00 00 00    	je     80334a <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  8032c5:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  8032cb:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  8032d0:	77 51                	ja     803323 <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  8032d2:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  8032d8:	89 d8                	mov    %ebx,%eax
+  8032da:	c1 e8 0c             	shr    $0xc,%eax
+  8032dd:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8032e4:	f6 c4 02             	test   $0x2,%ah
+  8032e7:	74 50                	je     803339 <free+0x93>
+		sys_page_unmap(0, c);
+  8032e9:	83 ec 08             	sub    $0x8,%esp
+  8032ec:	53                   	push   %ebx
+  8032ed:	6a 00                	push   $0x0
+  8032ef:	e8 c4 df ff ff       	call   8012b8 <sys_page_unmap>
+		c += PGSIZE;
+  8032f4:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  8032fa:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  803300:	83 c4 10             	add    $0x10,%esp
+  803303:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  803308:	76 ce                	jbe    8032d8 <free+0x32>
+  80330a:	68 63 56 80 00       	push   $0x805663
+  80330f:	68 b1 55 80 00       	push   $0x8055b1
+  803314:	68 82 00 00 00       	push   $0x82
+  803319:	68 56 56 80 00       	push   $0x805656
+  80331e:	e8 ff d3 ff ff       	call   800722 <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  803323:	68 28 56 80 00       	push   $0x805628
+  803328:	68 b1 55 80 00       	push   $0x8055b1
+  80332d:	6a 7b                	push   $0x7b
+  80332f:	68 56 56 80 00       	push   $0x805656
+  803334:	e8 e9 d3 ff ff       	call   800722 <_panic>
+	if (--(*ref) == 0)
+  803339:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  80333f:	83 e8 01             	sub    $0x1,%eax
+  803342:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  803348:	74 15                	je     80335f <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  80334a:	83 ec 0c             	sub    $0xc,%esp
+  80334d:	68 0c 70 80 00       	push   $0x80700c
+  803352:	e8 20 07 00 00       	call   803a77 <mutex_unlock>
+}
+  803357:	83 c4 10             	add    $0x10,%esp
+  80335a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80335d:	c9                   	leave
+  80335e:	c3                   	ret
+		sys_page_unmap(0, c);
+  80335f:	83 ec 08             	sub    $0x8,%esp
+  803362:	53                   	push   %ebx
+  803363:	6a 00                	push   $0x0
+  803365:	e8 4e df ff ff       	call   8012b8 <sys_page_unmap>
+  80336a:	83 c4 10             	add    $0x10,%esp
+  80336d:	eb db                	jmp    80334a <free+0xa4>
+
+0080336f <malloc>:
+{
+  80336f:	55                   	push   %ebp
+  803370:	89 e5                	mov    %esp,%ebp
+  803372:	57                   	push   %edi
+  803373:	56                   	push   %esi
+  803374:	53                   	push   %ebx
+  803375:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  803378:	68 0c 70 80 00       	push   $0x80700c
+  80337d:	e8 88 06 00 00       	call   803a0a <mutex_lock>
+	if (mptr == 0)
+  803382:	8b 3d 10 70 80 00    	mov    0x807010,%edi
+  803388:	83 c4 10             	add    $0x10,%esp
+  80338b:	85 ff                	test   %edi,%edi
+  80338d:	74 6c                	je     8033fb <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  80338f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803392:	83 c0 03             	add    $0x3,%eax
+  803395:	83 e0 fc             	and    $0xfffffffc,%eax
+  803398:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  80339a:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  80339f:	0f 87 64 01 00 00    	ja     803509 <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  8033a5:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8033ab:	74 30                	je     8033dd <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  8033ad:	89 f9                	mov    %edi,%ecx
+  8033af:	c1 e9 0c             	shr    $0xc,%ecx
+  8033b2:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  8033b6:	c1 e8 0c             	shr    $0xc,%eax
+  8033b9:	39 c1                	cmp    %eax,%ecx
+  8033bb:	74 5f                	je     80341c <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  8033bd:	83 ec 0c             	sub    $0xc,%esp
+  8033c0:	57                   	push   %edi
+  8033c1:	e8 e0 fe ff ff       	call   8032a6 <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  8033c6:	a1 10 70 80 00       	mov    0x807010,%eax
+  8033cb:	05 00 10 00 00       	add    $0x1000,%eax
+  8033d0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8033d5:	a3 10 70 80 00       	mov    %eax,0x807010
+  8033da:	83 c4 10             	add    $0x10,%esp
+  8033dd:	8b 0d 10 70 80 00    	mov    0x807010,%ecx
+{
+  8033e3:	ba 02 00 00 00       	mov    $0x2,%edx
+  8033e8:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  8033ec:	8d 7e 04             	lea    0x4(%esi),%edi
+  8033ef:	89 cb                	mov    %ecx,%ebx
+  8033f1:	01 f9                	add    %edi,%ecx
+  8033f3:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8033f6:	e9 8b 00 00 00       	jmp    803486 <malloc+0x117>
+		mptr = mbegin;
+  8033fb:	c7 05 10 70 80 00 00 	movl   $0x8000000,0x807010
+  803402:	00 00 08 
+	n = ROUNDUP(n, 4);
+  803405:	8b 45 08             	mov    0x8(%ebp),%eax
+  803408:	83 c0 03             	add    $0x3,%eax
+  80340b:	83 e0 fc             	and    $0xfffffffc,%eax
+  80340e:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  803410:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  803415:	76 c6                	jbe    8033dd <malloc+0x6e>
+  803417:	e9 d6 00 00 00       	jmp    8034f2 <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  80341c:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  803422:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  803427:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  80342b:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  80342e:	a3 10 70 80 00       	mov    %eax,0x807010
+			return v;
+  803433:	e9 ba 00 00 00       	jmp    8034f2 <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  803438:	05 00 10 00 00       	add    $0x1000,%eax
+  80343d:	39 c8                	cmp    %ecx,%eax
+  80343f:	0f 83 cb 00 00 00    	jae    803510 <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  803445:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  80344a:	77 22                	ja     80346e <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  80344c:	89 c2                	mov    %eax,%edx
+  80344e:	c1 ea 16             	shr    $0x16,%edx
+  803451:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  803458:	f6 c2 01             	test   $0x1,%dl
+  80345b:	74 db                	je     803438 <malloc+0xc9>
+  80345d:	89 c2                	mov    %eax,%edx
+  80345f:	c1 ea 0c             	shr    $0xc,%edx
+  803462:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  803469:	f6 c2 01             	test   $0x1,%dl
+  80346c:	74 ca                	je     803438 <malloc+0xc9>
+		if (mptr == mend) {
+  80346e:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803474:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  80347a:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  80347e:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  803484:	74 04                	je     80348a <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  803486:	89 d8                	mov    %ebx,%eax
+  803488:	eb b3                	jmp    80343d <malloc+0xce>
+  80348a:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  80348d:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  803492:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  803496:	83 ea 01             	sub    $0x1,%edx
+  803499:	0f 85 50 ff ff ff    	jne    8033ef <malloc+0x80>
+  80349f:	c7 05 10 70 80 00 00 	movl   $0x8000000,0x807010
+  8034a6:	00 00 08 
+				return 0;	/* out of address space */
+  8034a9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034ae:	eb 42                	jmp    8034f2 <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  8034b0:	85 db                	test   %ebx,%ebx
+  8034b2:	78 1e                	js     8034d2 <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  8034b4:	83 ec 08             	sub    $0x8,%esp
+  8034b7:	89 d8                	mov    %ebx,%eax
+  8034b9:	03 05 10 70 80 00    	add    0x807010,%eax
+  8034bf:	50                   	push   %eax
+  8034c0:	6a 00                	push   $0x0
+  8034c2:	e8 f1 dd ff ff       	call   8012b8 <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  8034c7:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  8034cd:	83 c4 10             	add    $0x10,%esp
+  8034d0:	eb de                	jmp    8034b0 <malloc+0x141>
+			return 0;	/* out of physical memory */
+  8034d2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034d7:	eb 19                	jmp    8034f2 <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  8034d9:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8034dc:	8b 3d 10 70 80 00    	mov    0x807010,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  8034e2:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  8034e9:	00 
+	mptr += n;
+  8034ea:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  8034ed:	a3 10 70 80 00       	mov    %eax,0x807010
+	mutex_unlock(&malloc_mu);
+  8034f2:	83 ec 0c             	sub    $0xc,%esp
+  8034f5:	68 0c 70 80 00       	push   $0x80700c
+  8034fa:	e8 78 05 00 00       	call   803a77 <mutex_unlock>
+}
+  8034ff:	89 f8                	mov    %edi,%eax
+  803501:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803504:	5b                   	pop    %ebx
+  803505:	5e                   	pop    %esi
+  803506:	5f                   	pop    %edi
+  803507:	5d                   	pop    %ebp
+  803508:	c3                   	ret
+		return 0;
+  803509:	bf 00 00 00 00       	mov    $0x0,%edi
+  80350e:	eb e2                	jmp    8034f2 <malloc+0x183>
+  803510:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  803514:	74 06                	je     80351c <malloc+0x1ad>
+  803516:	89 1d 10 70 80 00    	mov    %ebx,0x807010
+	for (i = 0; i < n + 4; i += PGSIZE){
+  80351c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803521:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803524:	39 fb                	cmp    %edi,%ebx
+  803526:	73 b1                	jae    8034d9 <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  803528:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  80352e:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  803531:	39 fe                	cmp    %edi,%esi
+  803533:	0f 92 c0             	setb   %al
+  803536:	0f b6 c0             	movzbl %al,%eax
+  803539:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  80353c:	83 c8 07             	or     $0x7,%eax
+  80353f:	50                   	push   %eax
+  803540:	89 d8                	mov    %ebx,%eax
+  803542:	03 05 10 70 80 00    	add    0x807010,%eax
+  803548:	50                   	push   %eax
+  803549:	6a 00                	push   $0x0
+  80354b:	e8 cf dc ff ff       	call   80121f <sys_page_alloc>
+  803550:	83 c4 10             	add    $0x10,%esp
+  803553:	85 c0                	test   %eax,%eax
+  803555:	0f 88 55 ff ff ff    	js     8034b0 <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  80355b:	89 f3                	mov    %esi,%ebx
+  80355d:	eb c5                	jmp    803524 <malloc+0x1b5>
+
+0080355f <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80355f:	55                   	push   %ebp
+  803560:	89 e5                	mov    %esp,%ebp
+  803562:	56                   	push   %esi
+  803563:	53                   	push   %ebx
+  803564:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803567:	83 ec 0c             	sub    $0xc,%esp
+  80356a:	ff 75 08             	push   0x8(%ebp)
+  80356d:	e8 ea e2 ff ff       	call   80185c <fd2data>
+  803572:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  803574:	83 c4 08             	add    $0x8,%esp
+  803577:	68 7b 56 80 00       	push   $0x80567b
+  80357c:	53                   	push   %ebx
+  80357d:	e8 5f d8 ff ff       	call   800de1 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  803582:	8b 46 04             	mov    0x4(%esi),%eax
+  803585:	2b 06                	sub    (%esi),%eax
+  803587:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  80358d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803594:	00 00 00 
+	stat->st_dev = &devpipe;
+  803597:	c7 83 88 00 00 00 9c 	movl   $0x80629c,0x88(%ebx)
+  80359e:	62 80 00 
+	return 0;
+}
+  8035a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035a6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8035a9:	5b                   	pop    %ebx
+  8035aa:	5e                   	pop    %esi
+  8035ab:	5d                   	pop    %ebp
+  8035ac:	c3                   	ret
+
+008035ad <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  8035ad:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8035b2:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  8035b6:	85 c9                	test   %ecx,%ecx
+  8035b8:	75 01                	jne    8035bb <pipewake+0xe>
+  8035ba:	c3                   	ret
+{
+  8035bb:	55                   	push   %ebp
+  8035bc:	89 e5                	mov    %esp,%ebp
+  8035be:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  8035c1:	68 00 04 00 00       	push   $0x400
+  8035c6:	52                   	push   %edx
+  8035c7:	e8 97 df ff ff       	call   801563 <sys_futex_wake>
+  8035cc:	83 c4 10             	add    $0x10,%esp
+}
+  8035cf:	c9                   	leave
+  8035d0:	c3                   	ret
+
+008035d1 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8035d1:	55                   	push   %ebp
+  8035d2:	89 e5                	mov    %esp,%ebp
+  8035d4:	56                   	push   %esi
+  8035d5:	53                   	push   %ebx
+  8035d6:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8035d9:	83 ec 0c             	sub    $0xc,%esp
+  8035dc:	56                   	push   %esi
+  8035dd:	e8 7a e2 ff ff       	call   80185c <fd2data>
+  8035e2:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  8035e4:	83 c4 08             	add    $0x8,%esp
+  8035e7:	56                   	push   %esi
+  8035e8:	6a 00                	push   $0x0
+  8035ea:	e8 c9 dc ff ff       	call   8012b8 <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  8035ef:	8d 53 04             	lea    0x4(%ebx),%edx
+  8035f2:	8d 43 08             	lea    0x8(%ebx),%eax
+  8035f5:	e8 b3 ff ff ff       	call   8035ad <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  8035fa:	8d 43 0c             	lea    0xc(%ebx),%eax
+  8035fd:	89 da                	mov    %ebx,%edx
+  8035ff:	e8 a9 ff ff ff       	call   8035ad <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  803604:	89 34 24             	mov    %esi,(%esp)
+  803607:	e8 50 e2 ff ff       	call   80185c <fd2data>
+  80360c:	83 c4 08             	add    $0x8,%esp
+  80360f:	50                   	push   %eax
+  803610:	6a 00                	push   $0x0
+  803612:	e8 a1 dc ff ff       	call   8012b8 <sys_page_unmap>
+}
+  803617:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80361a:	5b                   	pop    %ebx
+  80361b:	5e                   	pop    %esi
+  80361c:	5d                   	pop    %ebp
+  80361d:	c3                   	ret
+
+0080361e <_pipeisclosed>:
+{
+  80361e:	55                   	push   %ebp
+  80361f:	89 e5                	mov    %esp,%ebp
+  803621:	57                   	push   %edi
+  803622:	56                   	push   %esi
+  803623:	53                   	push   %ebx
+  803624:	83 ec 1c             	sub    $0x1c,%esp
+  803627:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80362a:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80362c:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  803631:	eb 5d                	jmp    803690 <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  803633:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		n = thisenv->env_runs;
+  803639:	8b 02                	mov    (%edx),%eax
+  80363b:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  80363e:	83 ec 0c             	sub    $0xc,%esp
+  803641:	ff 75 e0             	push   -0x20(%ebp)
+  803644:	e8 b7 13 00 00       	call   804a00 <pageref>
+  803649:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80364c:	89 3c 24             	mov    %edi,(%esp)
+  80364f:	e8 ac 13 00 00       	call   804a00 <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  803654:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803656:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  80365c:	83 c4 10             	add    $0x10,%esp
+  80365f:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803665:	77 15                	ja     80367c <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803667:	89 f2                	mov    %esi,%edx
+  803669:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  80366b:	c1 ea 10             	shr    $0x10,%edx
+  80366e:	74 0c                	je     80367c <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803670:	c1 e2 10             	shl    $0x10,%edx
+  803673:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  803678:	29 d1                	sub    %edx,%ecx
+  80367a:	eb 06                	jmp    803682 <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  80367c:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		nn = thisenv->env_runs;
+  803682:	8b 11                	mov    (%ecx),%edx
+  803684:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  803687:	39 d3                	cmp    %edx,%ebx
+  803689:	74 6e                	je     8036f9 <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  80368b:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80368e:	74 24                	je     8036b4 <_pipeisclosed+0x96>
+  803690:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803692:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803698:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80369d:	77 94                	ja     803633 <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80369f:	89 f0                	mov    %esi,%eax
+  8036a1:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8036a3:	c1 e8 10             	shr    $0x10,%eax
+  8036a6:	74 8b                	je     803633 <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8036a8:	c1 e0 10             	shl    $0x10,%eax
+  8036ab:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8036b0:	29 c2                	sub    %eax,%edx
+  8036b2:	eb 85                	jmp    803639 <_pipeisclosed+0x1b>
+  8036b4:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8036b6:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8036bc:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8036c1:	77 18                	ja     8036db <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8036c3:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8036c8:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8036ca:	c1 e8 10             	shr    $0x10,%eax
+  8036cd:	74 0c                	je     8036db <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8036cf:	c1 e0 10             	shl    $0x10,%eax
+  8036d2:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8036d7:	29 c2                	sub    %eax,%edx
+  8036d9:	eb 06                	jmp    8036e1 <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  8036db:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8036e1:	8b 02                	mov    (%edx),%eax
+  8036e3:	8b 40 58             	mov    0x58(%eax),%eax
+  8036e6:	6a 01                	push   $0x1
+  8036e8:	50                   	push   %eax
+  8036e9:	53                   	push   %ebx
+  8036ea:	68 82 56 80 00       	push   $0x805682
+  8036ef:	e8 09 d1 ff ff       	call   8007fd <cprintf>
+  8036f4:	83 c4 10             	add    $0x10,%esp
+  8036f7:	eb 97                	jmp    803690 <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  8036f9:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8036fc:	0f 94 c0             	sete   %al
+  8036ff:	0f b6 c0             	movzbl %al,%eax
+}
+  803702:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803705:	5b                   	pop    %ebx
+  803706:	5e                   	pop    %esi
+  803707:	5f                   	pop    %edi
+  803708:	5d                   	pop    %ebp
+  803709:	c3                   	ret
+
+0080370a <devpipe_write>:
+{
+  80370a:	55                   	push   %ebp
+  80370b:	89 e5                	mov    %esp,%ebp
+  80370d:	57                   	push   %edi
+  80370e:	56                   	push   %esi
+  80370f:	53                   	push   %ebx
+  803710:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  803713:	ff 75 08             	push   0x8(%ebp)
+  803716:	e8 41 e1 ff ff       	call   80185c <fd2data>
+  80371b:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80371d:	83 c4 10             	add    $0x10,%esp
+  803720:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  803727:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  80372a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80372d:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803730:	0f 84 96 00 00 00    	je     8037cc <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  803736:	8d 73 08             	lea    0x8(%ebx),%esi
+  803739:	eb 32                	jmp    80376d <devpipe_write+0x63>
+  80373b:	89 fa                	mov    %edi,%edx
+  80373d:	89 f0                	mov    %esi,%eax
+  80373f:	e8 69 fe ff ff       	call   8035ad <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  803744:	8b 43 04             	mov    0x4(%ebx),%eax
+  803747:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  80374a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80374f:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  803754:	83 ec 04             	sub    $0x4,%esp
+  803757:	6a 0a                	push   $0xa
+  803759:	50                   	push   %eax
+  80375a:	53                   	push   %ebx
+  80375b:	e8 d4 dd ff ff       	call   801534 <sys_futex_wait>
+  803760:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803765:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  80376a:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80376d:	8b 43 04             	mov    0x4(%ebx),%eax
+  803770:	8b 0b                	mov    (%ebx),%ecx
+  803772:	8d 51 20             	lea    0x20(%ecx),%edx
+  803775:	39 d0                	cmp    %edx,%eax
+  803777:	72 1b                	jb     803794 <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  803779:	89 da                	mov    %ebx,%edx
+  80377b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80377e:	e8 9b fe ff ff       	call   80361e <_pipeisclosed>
+  803783:	85 c0                	test   %eax,%eax
+  803785:	74 b4                	je     80373b <devpipe_write+0x31>
+				return 0;
+  803787:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80378c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80378f:	5b                   	pop    %ebx
+  803790:	5e                   	pop    %esi
+  803791:	5f                   	pop    %edi
+  803792:	5d                   	pop    %ebp
+  803793:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803794:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803797:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80379a:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  80379e:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  8037a1:	89 c2                	mov    %eax,%edx
+  8037a3:	c1 fa 1f             	sar    $0x1f,%edx
+  8037a6:	89 d1                	mov    %edx,%ecx
+  8037a8:	c1 e9 1b             	shr    $0x1b,%ecx
+  8037ab:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8037ae:	83 e2 1f             	and    $0x1f,%edx
+  8037b1:	29 ca                	sub    %ecx,%edx
+  8037b3:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  8037b7:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  8037bb:	83 c0 01             	add    $0x1,%eax
+  8037be:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8037c1:	83 c6 01             	add    $0x1,%esi
+  8037c4:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8037c7:	e9 5e ff ff ff       	jmp    80372a <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  8037cc:	8d 53 04             	lea    0x4(%ebx),%edx
+  8037cf:	8d 43 08             	lea    0x8(%ebx),%eax
+  8037d2:	e8 d6 fd ff ff       	call   8035ad <pipewake>
+	return i;
+  8037d7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8037da:	eb b0                	jmp    80378c <devpipe_write+0x82>
+
+008037dc <devpipe_read>:
+{
+  8037dc:	55                   	push   %ebp
+  8037dd:	89 e5                	mov    %esp,%ebp
+  8037df:	57                   	push   %edi
+  8037e0:	56                   	push   %esi
+  8037e1:	53                   	push   %ebx
+  8037e2:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  8037e5:	ff 75 08             	push   0x8(%ebp)
+  8037e8:	e8 6f e0 ff ff       	call   80185c <fd2data>
+  8037ed:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8037ef:	83 c4 10             	add    $0x10,%esp
+  8037f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8037f7:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8037fa:	74 6c                	je     803868 <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  8037fc:	8d 7b 04             	lea    0x4(%ebx),%edi
+  8037ff:	eb 25                	jmp    803826 <devpipe_read+0x4a>
+  803801:	8b 13                	mov    (%ebx),%edx
+  803803:	b8 01 00 00 00       	mov    $0x1,%eax
+  803808:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  80380d:	83 ec 04             	sub    $0x4,%esp
+  803810:	6a 0a                	push   $0xa
+  803812:	52                   	push   %edx
+  803813:	57                   	push   %edi
+  803814:	e8 1b dd ff ff       	call   801534 <sys_futex_wait>
+  803819:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80381e:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  803823:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  803826:	8b 03                	mov    (%ebx),%eax
+  803828:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80382b:	75 19                	jne    803846 <devpipe_read+0x6a>
+			if (i > 0)
+  80382d:	85 f6                	test   %esi,%esi
+  80382f:	75 3a                	jne    80386b <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  803831:	89 da                	mov    %ebx,%edx
+  803833:	8b 45 08             	mov    0x8(%ebp),%eax
+  803836:	e8 e3 fd ff ff       	call   80361e <_pipeisclosed>
+  80383b:	85 c0                	test   %eax,%eax
+  80383d:	74 c2                	je     803801 <devpipe_read+0x25>
+				return 0;
+  80383f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803844:	eb 31                	jmp    803877 <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803846:	89 c1                	mov    %eax,%ecx
+  803848:	c1 f9 1f             	sar    $0x1f,%ecx
+  80384b:	c1 e9 1b             	shr    $0x1b,%ecx
+  80384e:	01 c8                	add    %ecx,%eax
+  803850:	83 e0 1f             	and    $0x1f,%eax
+  803853:	29 c8                	sub    %ecx,%eax
+  803855:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  80385a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80385d:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  803860:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  803863:	83 c6 01             	add    $0x1,%esi
+  803866:	eb 8f                	jmp    8037f7 <devpipe_read+0x1b>
+out:
+  803868:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  80386b:	8d 43 0c             	lea    0xc(%ebx),%eax
+  80386e:	89 da                	mov    %ebx,%edx
+  803870:	e8 38 fd ff ff       	call   8035ad <pipewake>
+	return i;
+  803875:	89 f0                	mov    %esi,%eax
+}
+  803877:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80387a:	5b                   	pop    %ebx
+  80387b:	5e                   	pop    %esi
+  80387c:	5f                   	pop    %edi
+  80387d:	5d                   	pop    %ebp
+  80387e:	c3                   	ret
+
+0080387f <pipe>:
+{
+  80387f:	55                   	push   %ebp
+  803880:	89 e5                	mov    %esp,%ebp
+  803882:	56                   	push   %esi
+  803883:	53                   	push   %ebx
+  803884:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803887:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80388a:	50                   	push   %eax
+  80388b:	e8 e3 df ff ff       	call   801873 <fd_alloc>
+  803890:	89 c3                	mov    %eax,%ebx
+  803892:	83 c4 10             	add    $0x10,%esp
+  803895:	85 c0                	test   %eax,%eax
+  803897:	0f 88 23 01 00 00    	js     8039c0 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80389d:	83 ec 04             	sub    $0x4,%esp
+  8038a0:	68 07 04 00 00       	push   $0x407
+  8038a5:	ff 75 f4             	push   -0xc(%ebp)
+  8038a8:	6a 00                	push   $0x0
+  8038aa:	e8 70 d9 ff ff       	call   80121f <sys_page_alloc>
+  8038af:	89 c3                	mov    %eax,%ebx
+  8038b1:	83 c4 10             	add    $0x10,%esp
+  8038b4:	85 c0                	test   %eax,%eax
+  8038b6:	0f 88 04 01 00 00    	js     8039c0 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8038bc:	83 ec 0c             	sub    $0xc,%esp
+  8038bf:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8038c2:	50                   	push   %eax
+  8038c3:	e8 ab df ff ff       	call   801873 <fd_alloc>
+  8038c8:	89 c3                	mov    %eax,%ebx
+  8038ca:	83 c4 10             	add    $0x10,%esp
+  8038cd:	85 c0                	test   %eax,%eax
+  8038cf:	0f 88 db 00 00 00    	js     8039b0 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8038d5:	83 ec 04             	sub    $0x4,%esp
+  8038d8:	68 07 04 00 00       	push   $0x407
+  8038dd:	ff 75 f0             	push   -0x10(%ebp)
+  8038e0:	6a 00                	push   $0x0
+  8038e2:	e8 38 d9 ff ff       	call   80121f <sys_page_alloc>
+  8038e7:	89 c3                	mov    %eax,%ebx
+  8038e9:	83 c4 10             	add    $0x10,%esp
+  8038ec:	85 c0                	test   %eax,%eax
+  8038ee:	0f 88 bc 00 00 00    	js     8039b0 <pipe+0x131>
+	va = fd2data(fd0);
+  8038f4:	83 ec 0c             	sub    $0xc,%esp
+  8038f7:	ff 75 f4             	push   -0xc(%ebp)
+  8038fa:	e8 5d df ff ff       	call   80185c <fd2data>
+  8038ff:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803901:	83 c4 0c             	add    $0xc,%esp
+  803904:	68 07 04 00 00       	push   $0x407
+  803909:	50                   	push   %eax
+  80390a:	6a 00                	push   $0x0
+  80390c:	e8 0e d9 ff ff       	call   80121f <sys_page_alloc>
+  803911:	89 c3                	mov    %eax,%ebx
+  803913:	83 c4 10             	add    $0x10,%esp
+  803916:	85 c0                	test   %eax,%eax
+  803918:	0f 88 82 00 00 00    	js     8039a0 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80391e:	83 ec 0c             	sub    $0xc,%esp
+  803921:	ff 75 f0             	push   -0x10(%ebp)
+  803924:	e8 33 df ff ff       	call   80185c <fd2data>
+  803929:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803930:	50                   	push   %eax
+  803931:	6a 00                	push   $0x0
+  803933:	56                   	push   %esi
+  803934:	6a 00                	push   $0x0
+  803936:	e8 31 d9 ff ff       	call   80126c <sys_page_map>
+  80393b:	89 c3                	mov    %eax,%ebx
+  80393d:	83 c4 20             	add    $0x20,%esp
+  803940:	85 c0                	test   %eax,%eax
+  803942:	78 4e                	js     803992 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803944:	a1 9c 62 80 00       	mov    0x80629c,%eax
+  803949:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80394c:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80394e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803951:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803958:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80395b:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80395d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803960:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803967:	83 ec 0c             	sub    $0xc,%esp
+  80396a:	ff 75 f4             	push   -0xc(%ebp)
+  80396d:	e8 da de ff ff       	call   80184c <fd2num>
+  803972:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803975:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803977:	83 c4 04             	add    $0x4,%esp
+  80397a:	ff 75 f0             	push   -0x10(%ebp)
+  80397d:	e8 ca de ff ff       	call   80184c <fd2num>
+  803982:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803985:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803988:	83 c4 10             	add    $0x10,%esp
+  80398b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803990:	eb 2e                	jmp    8039c0 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803992:	83 ec 08             	sub    $0x8,%esp
+  803995:	56                   	push   %esi
+  803996:	6a 00                	push   $0x0
+  803998:	e8 1b d9 ff ff       	call   8012b8 <sys_page_unmap>
+  80399d:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8039a0:	83 ec 08             	sub    $0x8,%esp
+  8039a3:	ff 75 f0             	push   -0x10(%ebp)
+  8039a6:	6a 00                	push   $0x0
+  8039a8:	e8 0b d9 ff ff       	call   8012b8 <sys_page_unmap>
+  8039ad:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8039b0:	83 ec 08             	sub    $0x8,%esp
+  8039b3:	ff 75 f4             	push   -0xc(%ebp)
+  8039b6:	6a 00                	push   $0x0
+  8039b8:	e8 fb d8 ff ff       	call   8012b8 <sys_page_unmap>
+  8039bd:	83 c4 10             	add    $0x10,%esp
+}
+  8039c0:	89 d8                	mov    %ebx,%eax
+  8039c2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8039c5:	5b                   	pop    %ebx
+  8039c6:	5e                   	pop    %esi
+  8039c7:	5d                   	pop    %ebp
+  8039c8:	c3                   	ret
+
+008039c9 <pipeisclosed>:
+{
+  8039c9:	55                   	push   %ebp
+  8039ca:	89 e5                	mov    %esp,%ebp
+  8039cc:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8039cf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8039d2:	50                   	push   %eax
+  8039d3:	ff 75 08             	push   0x8(%ebp)
+  8039d6:	e8 ee de ff ff       	call   8018c9 <fd_lookup>
+  8039db:	83 c4 10             	add    $0x10,%esp
+  8039de:	85 c0                	test   %eax,%eax
+  8039e0:	78 18                	js     8039fa <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8039e2:	83 ec 0c             	sub    $0xc,%esp
+  8039e5:	ff 75 f4             	push   -0xc(%ebp)
+  8039e8:	e8 6f de ff ff       	call   80185c <fd2data>
+  8039ed:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8039ef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8039f2:	e8 27 fc ff ff       	call   80361e <_pipeisclosed>
+  8039f7:	83 c4 10             	add    $0x10,%esp
+}
+  8039fa:	c9                   	leave
+  8039fb:	c3                   	ret
+
+008039fc <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  8039fc:	55                   	push   %ebp
+  8039fd:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  8039ff:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a02:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803a08:	5d                   	pop    %ebp
+  803a09:	c3                   	ret
+
+00803a0a <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  803a0a:	55                   	push   %ebp
+  803a0b:	89 e5                	mov    %esp,%ebp
+  803a0d:	56                   	push   %esi
+  803a0e:	53                   	push   %ebx
+  803a0f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803a12:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a17:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803a1c:	89 d0                	mov    %edx,%eax
+  803a1e:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  803a22:	85 c0                	test   %eax,%eax
+  803a24:	74 2d                	je     803a53 <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  803a26:	83 f8 02             	cmp    $0x2,%eax
+  803a29:	74 08                	je     803a33 <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  803a2b:	b8 02 00 00 00       	mov    $0x2,%eax
+  803a30:	f0 87 03             	lock xchg %eax,(%ebx)
+  803a33:	be 02 00 00 00       	mov    $0x2,%esi
+  803a38:	eb 15                	jmp    803a4f <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  803a3a:	83 ec 04             	sub    $0x4,%esp
+  803a3d:	6a 00                	push   $0x0
+  803a3f:	6a 02                	push   $0x2
+  803a41:	53                   	push   %ebx
+  803a42:	e8 ed da ff ff       	call   801534 <sys_futex_wait>
+  803a47:	89 f0                	mov    %esi,%eax
+  803a49:	f0 87 03             	lock xchg %eax,(%ebx)
+  803a4c:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  803a4f:	85 c0                	test   %eax,%eax
+  803a51:	75 e7                	jne    803a3a <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  803a53:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803a56:	5b                   	pop    %ebx
+  803a57:	5e                   	pop    %esi
+  803a58:	5d                   	pop    %ebp
+  803a59:	c3                   	ret
+
+00803a5a <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  803a5a:	55                   	push   %ebp
+  803a5b:	89 e5                	mov    %esp,%ebp
+  803a5d:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803a60:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a65:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803a6a:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  803a6e:	f7 d8                	neg    %eax
+  803a70:	19 c0                	sbb    %eax,%eax
+  803a72:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  803a75:	5d                   	pop    %ebp
+  803a76:	c3                   	ret
+
+00803a77 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  803a77:	55                   	push   %ebp
+  803a78:	89 e5                	mov    %esp,%ebp
+  803a7a:	83 ec 08             	sub    $0x8,%esp
+  803a7d:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  803a80:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a85:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  803a88:	83 f8 02             	cmp    $0x2,%eax
+  803a8b:	74 02                	je     803a8f <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  803a8d:	c9                   	leave
+  803a8e:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  803a8f:	83 ec 08             	sub    $0x8,%esp
+  803a92:	6a 01                	push   $0x1
+  803a94:	52                   	push   %edx
+  803a95:	e8 c9 da ff ff       	call   801563 <sys_futex_wake>
+  803a9a:	83 c4 10             	add    $0x10,%esp
+}
+  803a9d:	eb ee                	jmp    803a8d <mutex_unlock+0x16>
+
+00803a9f <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  803a9f:	55                   	push   %ebp
+  803aa0:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  803aa2:	8b 45 08             	mov    0x8(%ebp),%eax
+  803aa5:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803aab:	5d                   	pop    %ebp
+  803aac:	c3                   	ret
+
+00803aad <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  803aad:	55                   	push   %ebp
+  803aae:	89 e5                	mov    %esp,%ebp
+  803ab0:	57                   	push   %edi
+  803ab1:	56                   	push   %esi
+  803ab2:	53                   	push   %ebx
+  803ab3:	83 ec 18             	sub    $0x18,%esp
+  803ab6:	8b 75 08             	mov    0x8(%ebp),%esi
+  803ab9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  803abc:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  803abe:	53                   	push   %ebx
+  803abf:	e8 b3 ff ff ff       	call   803a77 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  803ac4:	83 c4 0c             	add    $0xc,%esp
+  803ac7:	ff 75 10             	push   0x10(%ebp)
+  803aca:	57                   	push   %edi
+  803acb:	56                   	push   %esi
+  803acc:	e8 63 da ff ff       	call   801534 <sys_futex_wait>
+  803ad1:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  803ad3:	83 c4 10             	add    $0x10,%esp
+  803ad6:	be 02 00 00 00       	mov    $0x2,%esi
+  803adb:	eb 10                	jmp    803aed <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  803add:	83 ec 04             	sub    $0x4,%esp
+  803ae0:	6a 00                	push   $0x0
+  803ae2:	6a 02                	push   $0x2
+  803ae4:	53                   	push   %ebx
+  803ae5:	e8 4a da ff ff       	call   801534 <sys_futex_wait>
+  803aea:	83 c4 10             	add    $0x10,%esp
+  803aed:	89 f0                	mov    %esi,%eax
+  803aef:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  803af2:	85 c0                	test   %eax,%eax
+  803af4:	75 e7                	jne    803add <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  803af6:	83 ff ec             	cmp    $0xffffffec,%edi
+  803af9:	74 05                	je     803b00 <cond_timedwait+0x53>
+  803afb:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803b00:	89 f8                	mov    %edi,%eax
+  803b02:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803b05:	5b                   	pop    %ebx
+  803b06:	5e                   	pop    %esi
+  803b07:	5f                   	pop    %edi
+  803b08:	5d                   	pop    %ebp
+  803b09:	c3                   	ret
+
+00803b0a <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  803b0a:	55                   	push   %ebp
+  803b0b:	89 e5                	mov    %esp,%ebp
+  803b0d:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  803b10:	6a 00                	push   $0x0
+  803b12:	ff 75 0c             	push   0xc(%ebp)
+  803b15:	ff 75 08             	push   0x8(%ebp)
+  803b18:	e8 90 ff ff ff       	call   803aad <cond_timedwait>
+}
+  803b1d:	83 c4 10             	add    $0x10,%esp
+  803b20:	c9                   	leave
+  803b21:	c3                   	ret
+
+00803b22 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  803b22:	55                   	push   %ebp
+  803b23:	89 e5                	mov    %esp,%ebp
+  803b25:	83 ec 10             	sub    $0x10,%esp
+  803b28:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  803b2b:	ba 01 00 00 00       	mov    $0x1,%edx
+  803b30:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  803b34:	6a 01                	push   $0x1
+  803b36:	50                   	push   %eax
+  803b37:	e8 27 da ff ff       	call   801563 <sys_futex_wake>
+}
+  803b3c:	83 c4 10             	add    $0x10,%esp
+  803b3f:	c9                   	leave
+  803b40:	c3                   	ret
+
+00803b41 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  803b41:	55                   	push   %ebp
+  803b42:	89 e5                	mov    %esp,%ebp
+  803b44:	83 ec 10             	sub    $0x10,%esp
+  803b47:	8b 45 08             	mov    0x8(%ebp),%eax
+  803b4a:	ba 01 00 00 00       	mov    $0x1,%edx
+  803b4f:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  803b53:	68 00 04 00 00       	push   $0x400
+  803b58:	50                   	push   %eax
+  803b59:	e8 05 da ff ff       	call   801563 <sys_futex_wake>
+}
+  803b5e:	83 c4 10             	add    $0x10,%esp
+  803b61:	c9                   	leave
+  803b62:	c3                   	ret
+
+00803b63 <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  803b63:	55                   	push   %ebp
+  803b64:	89 e5                	mov    %esp,%ebp
+  803b66:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  803b69:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803b6c:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  803b6e:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  803b75:	5d                   	pop    %ebp
+  803b76:	c3                   	ret
+
+00803b77 <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  803b77:	55                   	push   %ebp
+  803b78:	89 e5                	mov    %esp,%ebp
+  803b7a:	53                   	push   %ebx
+  803b7b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  803b7e:	8b 11                	mov    (%ecx),%edx
+  803b80:	85 d2                	test   %edx,%edx
+  803b82:	74 14                	je     803b98 <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  803b84:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803b87:	89 d0                	mov    %edx,%eax
+  803b89:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  803b8d:	39 c2                	cmp    %eax,%edx
+  803b8f:	75 ed                	jne    803b7e <sem_trywait+0x7>
+			return 0;
+  803b91:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b96:	eb 05                	jmp    803b9d <sem_trywait+0x26>
+	return -E_AGAIN;
+  803b98:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  803b9d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803ba0:	c9                   	leave
+  803ba1:	c3                   	ret
+
+00803ba2 <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  803ba2:	55                   	push   %ebp
+  803ba3:	89 e5                	mov    %esp,%ebp
+  803ba5:	57                   	push   %edi
+  803ba6:	56                   	push   %esi
+  803ba7:	53                   	push   %ebx
+  803ba8:	83 ec 1c             	sub    $0x1c,%esp
+  803bab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803bae:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  803bb1:	e8 f6 d8 ff ff       	call   8014ac <sys_time_msec>
+  803bb6:	01 f8                	add    %edi,%eax
+  803bb8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  803bbb:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  803bc0:	eb 28                	jmp    803bea <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  803bc2:	b8 01 00 00 00       	mov    $0x1,%eax
+  803bc7:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  803bcc:	83 ec 04             	sub    $0x4,%esp
+  803bcf:	56                   	push   %esi
+  803bd0:	6a 00                	push   $0x0
+  803bd2:	53                   	push   %ebx
+  803bd3:	e8 5c d9 ff ff       	call   801534 <sys_futex_wait>
+  803bd8:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  803bdd:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  803be2:	83 c4 10             	add    $0x10,%esp
+  803be5:	83 f8 ec             	cmp    $0xffffffec,%eax
+  803be8:	74 2e                	je     803c18 <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  803bea:	83 ec 0c             	sub    $0xc,%esp
+  803bed:	53                   	push   %ebx
+  803bee:	e8 84 ff ff ff       	call   803b77 <sem_trywait>
+  803bf3:	83 c4 10             	add    $0x10,%esp
+  803bf6:	85 c0                	test   %eax,%eax
+  803bf8:	79 19                	jns    803c13 <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  803bfa:	85 ff                	test   %edi,%edi
+  803bfc:	74 c4                	je     803bc2 <sem_timedwait+0x20>
+  803bfe:	e8 a9 d8 ff ff       	call   8014ac <sys_time_msec>
+  803c03:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803c06:	29 c6                	sub    %eax,%esi
+  803c08:	85 f6                	test   %esi,%esi
+  803c0a:	7f b6                	jg     803bc2 <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  803c0c:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  803c11:	eb 05                	jmp    803c18 <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  803c13:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c18:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c1b:	5b                   	pop    %ebx
+  803c1c:	5e                   	pop    %esi
+  803c1d:	5f                   	pop    %edi
+  803c1e:	5d                   	pop    %ebp
+  803c1f:	c3                   	ret
+
+00803c20 <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  803c20:	55                   	push   %ebp
+  803c21:	89 e5                	mov    %esp,%ebp
+  803c23:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  803c26:	6a 00                	push   $0x0
+  803c28:	ff 75 08             	push   0x8(%ebp)
+  803c2b:	e8 72 ff ff ff       	call   803ba2 <sem_timedwait>
+}
+  803c30:	83 c4 10             	add    $0x10,%esp
+  803c33:	c9                   	leave
+  803c34:	c3                   	ret
+
+00803c35 <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  803c35:	55                   	push   %ebp
+  803c36:	89 e5                	mov    %esp,%ebp
+  803c38:	83 ec 08             	sub    $0x8,%esp
+  803c3b:	8b 45 08             	mov    0x8(%ebp),%eax
+  803c3e:	ba 01 00 00 00       	mov    $0x1,%edx
+  803c43:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  803c47:	8b 50 04             	mov    0x4(%eax),%edx
+  803c4a:	85 d2                	test   %edx,%edx
+  803c4c:	75 02                	jne    803c50 <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  803c4e:	c9                   	leave
+  803c4f:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  803c50:	83 ec 08             	sub    $0x8,%esp
+  803c53:	6a 01                	push   $0x1
+  803c55:	50                   	push   %eax
+  803c56:	e8 08 d9 ff ff       	call   801563 <sys_futex_wake>
+  803c5b:	83 c4 10             	add    $0x10,%esp
+}
+  803c5e:	eb ee                	jmp    803c4e <sem_post+0x19>
+
+00803c60 <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  803c60:	55                   	push   %ebp
+  803c61:	89 e5                	mov    %esp,%ebp
+  803c63:	57                   	push   %edi
+  803c64:	56                   	push   %esi
+  803c65:	53                   	push   %ebx
+  803c66:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  803c69:	68 20 70 80 00       	push   $0x807020
+  803c6e:	e8 97 fd ff ff       	call   803a0a <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  803c73:	a1 44 70 80 00       	mov    0x807044,%eax
+  803c78:	83 c4 10             	add    $0x10,%esp
+  803c7b:	85 c0                	test   %eax,%eax
+  803c7d:	75 19                	jne    803c98 <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  803c7f:	a1 c0 72 80 00       	mov    0x8072c0,%eax
+  803c84:	8b 00                	mov    (%eax),%eax
+  803c86:	8b 40 48             	mov    0x48(%eax),%eax
+  803c89:	a3 40 70 80 00       	mov    %eax,0x807040
+		threads[0].th_state = PTH_RUNNING;
+  803c8e:	c7 05 44 70 80 00 01 	movl   $0x1,0x807044
+  803c95:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803c98:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  803c9d:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803ca0:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803ca7:	8b 40 04             	mov    0x4(%eax),%eax
+  803caa:	85 c0                	test   %eax,%eax
+  803cac:	0f 84 e4 00 00 00    	je     803d96 <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803cb2:	83 c3 01             	add    $0x1,%ebx
+  803cb5:	83 fb 20             	cmp    $0x20,%ebx
+  803cb8:	75 e3                	jne    803c9d <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  803cba:	83 ec 0c             	sub    $0xc,%esp
+  803cbd:	68 20 70 80 00       	push   $0x807020
+  803cc2:	e8 b0 fd ff ff       	call   803a77 <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  803cc7:	83 c4 10             	add    $0x10,%esp
+  803cca:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  803ccf:	e9 b8 00 00 00       	jmp    803d8c <pthread_create+0x12c>
+  803cd4:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  803cd7:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  803cda:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  803cdc:	39 f3                	cmp    %esi,%ebx
+  803cde:	73 16                	jae    803cf6 <pthread_create+0x96>
+		va -= PGSIZE;
+  803ce0:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  803ce6:	83 ec 08             	sub    $0x8,%esp
+  803ce9:	56                   	push   %esi
+  803cea:	6a 00                	push   $0x0
+  803cec:	e8 c7 d5 ff ff       	call   8012b8 <sys_page_unmap>
+  803cf1:	83 c4 10             	add    $0x10,%esp
+  803cf4:	eb e6                	jmp    803cdc <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  803cf6:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803cf9:	83 ec 08             	sub    $0x8,%esp
+  803cfc:	ff 75 e4             	push   -0x1c(%ebp)
+  803cff:	6a 00                	push   $0x0
+  803d01:	e8 b2 d5 ff ff       	call   8012b8 <sys_page_unmap>
+	return r;
+  803d06:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  803d09:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803d0c:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803d13:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  803d1a:	eb 70                	jmp    803d8c <pthread_create+0x12c>
+	th->th_fn = fn;
+  803d1c:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803d1f:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803d26:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803d29:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  803d2c:	8b 55 10             	mov    0x10(%ebp),%edx
+  803d2f:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  803d32:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  803d39:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  803d3e:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803d41:	29 c8                	sub    %ecx,%eax
+  803d43:	85 db                	test   %ebx,%ebx
+  803d45:	0f 44 05 c0 72 80 00 	cmove  0x8072c0,%eax
+	*--esp = t;
+  803d4c:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  803d4f:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803d56:	83 ec 04             	sub    $0x4,%esp
+  803d59:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803d5e:	29 ca                	sub    %ecx,%edx
+  803d60:	52                   	push   %edx
+	*--esp = 0;
+  803d61:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803d64:	50                   	push   %eax
+  803d65:	68 bd 3f 80 00       	push   $0x803fbd
+  803d6a:	e8 99 d8 ff ff       	call   801608 <sys_thread_create>
+  803d6f:	89 c7                	mov    %eax,%edi
+  803d71:	83 c4 10             	add    $0x10,%esp
+  803d74:	85 c0                	test   %eax,%eax
+  803d76:	78 91                	js     803d09 <pthread_create+0xa9>
+	th->th_env = id;
+  803d78:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803d7b:	89 3c 85 40 70 80 00 	mov    %edi,0x807040(,%eax,4)
+	*tp = t;
+  803d82:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d85:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  803d87:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803d8c:	89 f8                	mov    %edi,%eax
+  803d8e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d91:	5b                   	pop    %ebx
+  803d92:	5e                   	pop    %esi
+  803d93:	5f                   	pop    %edi
+  803d94:	5d                   	pop    %ebp
+  803d95:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  803d96:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803d99:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803da0:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  803da7:	83 ec 0c             	sub    $0xc,%esp
+  803daa:	68 20 70 80 00       	push   $0x807020
+  803daf:	e8 c3 fc ff ff       	call   803a77 <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  803db4:	89 d9                	mov    %ebx,%ecx
+  803db6:	c1 e1 10             	shl    $0x10,%ecx
+  803db9:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  803dbc:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  803dc1:	29 c8                	sub    %ecx,%eax
+  803dc3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  803dc6:	c1 e8 16             	shr    $0x16,%eax
+  803dc9:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803dd0:	83 c4 10             	add    $0x10,%esp
+  803dd3:	a8 01                	test   $0x1,%al
+  803dd5:	74 15                	je     803dec <pthread_create+0x18c>
+  803dd7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803dda:	c1 e8 0c             	shr    $0xc,%eax
+  803ddd:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803de4:	a8 01                	test   $0x1,%al
+  803de6:	0f 85 30 ff ff ff    	jne    803d1c <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803dec:	83 ec 04             	sub    $0x4,%esp
+  803def:	6a 07                	push   $0x7
+  803df1:	ff 75 e4             	push   -0x1c(%ebp)
+  803df4:	6a 00                	push   $0x0
+  803df6:	e8 24 d4 ff ff       	call   80121f <sys_page_alloc>
+  803dfb:	89 c7                	mov    %eax,%edi
+  803dfd:	83 c4 10             	add    $0x10,%esp
+  803e00:	85 c0                	test   %eax,%eax
+  803e02:	0f 88 01 ff ff ff    	js     803d09 <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  803e08:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  803e0d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  803e10:	29 d0                	sub    %edx,%eax
+  803e12:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  803e15:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803e17:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  803e1c:	29 d0                	sub    %edx,%eax
+  803e1e:	89 c7                	mov    %eax,%edi
+  803e20:	39 fe                	cmp    %edi,%esi
+  803e22:	0f 83 f4 fe ff ff    	jae    803d1c <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803e28:	83 ec 04             	sub    $0x4,%esp
+  803e2b:	6a 07                	push   $0x7
+  803e2d:	56                   	push   %esi
+  803e2e:	6a 00                	push   $0x0
+  803e30:	e8 ea d3 ff ff       	call   80121f <sys_page_alloc>
+  803e35:	83 c4 10             	add    $0x10,%esp
+  803e38:	85 c0                	test   %eax,%eax
+  803e3a:	0f 88 94 fe ff ff    	js     803cd4 <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803e40:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803e46:	eb d8                	jmp    803e20 <pthread_create+0x1c0>
+
+00803e48 <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  803e48:	55                   	push   %ebp
+  803e49:	89 e5                	mov    %esp,%ebp
+  803e4b:	57                   	push   %edi
+  803e4c:	56                   	push   %esi
+  803e4d:	53                   	push   %ebx
+  803e4e:	83 ec 0c             	sub    $0xc,%esp
+  803e51:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  803e54:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  803e57:	83 f8 1e             	cmp    $0x1e,%eax
+  803e5a:	0f 87 c7 00 00 00    	ja     803f27 <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  803e60:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803e62:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803e68:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803e6d:	77 12                	ja     803e81 <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803e6f:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803e74:	29 d0                	sub    %edx,%eax
+  803e76:	c1 e8 10             	shr    $0x10,%eax
+  803e79:	39 c3                	cmp    %eax,%ebx
+  803e7b:	0f 84 ad 00 00 00    	je     803f2e <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803e81:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803e84:	8d 3c 85 44 70 80 00 	lea    0x807044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  803e8b:	8d 34 85 40 70 80 00 	lea    0x807040(,%eax,4),%esi
+  803e92:	eb 10                	jmp    803ea4 <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803e94:	83 ec 04             	sub    $0x4,%esp
+  803e97:	6a 00                	push   $0x0
+  803e99:	6a 01                	push   $0x1
+  803e9b:	57                   	push   %edi
+  803e9c:	e8 93 d6 ff ff       	call   801534 <sys_futex_wait>
+  803ea1:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  803ea4:	8b 46 04             	mov    0x4(%esi),%eax
+  803ea7:	83 f8 01             	cmp    $0x1,%eax
+  803eaa:	74 e8                	je     803e94 <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  803eac:	83 f8 02             	cmp    $0x2,%eax
+  803eaf:	0f 85 80 00 00 00    	jne    803f35 <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  803eb5:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  803eb8:	c1 e6 02             	shl    $0x2,%esi
+  803ebb:	eb 05                	jmp    803ec2 <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  803ebd:	e8 31 d3 ff ff       	call   8011f3 <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  803ec2:	8b 8e 40 70 80 00    	mov    0x807040(%esi),%ecx
+  803ec8:	89 ca                	mov    %ecx,%edx
+  803eca:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  803ed0:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803ed3:	c1 e0 04             	shl    $0x4,%eax
+  803ed6:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803edb:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  803ede:	39 c1                	cmp    %eax,%ecx
+  803ee0:	75 12                	jne    803ef4 <pthread_join+0xac>
+  803ee2:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803ee5:	c1 e0 04             	shl    $0x4,%eax
+  803ee8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803eed:	8b 40 54             	mov    0x54(%eax),%eax
+  803ef0:	85 c0                	test   %eax,%eax
+  803ef2:	75 c9                	jne    803ebd <pthread_join+0x75>
+	if (ret_store)
+  803ef4:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803ef8:	74 0f                	je     803f09 <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  803efa:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803efd:	8b 04 85 50 70 80 00 	mov    0x807050(,%eax,4),%eax
+  803f04:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803f07:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  803f09:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803f0c:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803f13:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  803f1a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f1f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803f22:	5b                   	pop    %ebx
+  803f23:	5e                   	pop    %esi
+  803f24:	5f                   	pop    %edi
+  803f25:	5d                   	pop    %ebp
+  803f26:	c3                   	ret
+		return -E_INVAL;
+  803f27:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803f2c:	eb f1                	jmp    803f1f <pthread_join+0xd7>
+  803f2e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803f33:	eb ea                	jmp    803f1f <pthread_join+0xd7>
+		return -E_INVAL;
+  803f35:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803f3a:	eb e3                	jmp    803f1f <pthread_join+0xd7>
+
+00803f3c <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  803f3c:	55                   	push   %ebp
+  803f3d:	89 e5                	mov    %esp,%ebp
+  803f3f:	53                   	push   %ebx
+  803f40:	83 ec 04             	sub    $0x4,%esp
+  803f43:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803f45:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803f4b:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803f50:	77 0c                	ja     803f5e <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803f52:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803f57:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  803f59:	c1 e8 10             	shr    $0x10,%eax
+  803f5c:	75 0a                	jne    803f68 <pthread_exit+0x2c>
+		exit();
+  803f5e:	e8 97 c7 ff ff       	call   8006fa <exit>
+  803f63:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  803f68:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  803f6f:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  803f72:	8d 0c 8d 40 70 80 00 	lea    0x807040(,%ecx,4),%ecx
+  803f79:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803f7c:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  803f7f:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  803f86:	83 ec 08             	sub    $0x8,%esp
+  803f89:	6a 20                	push   $0x20
+  803f8b:	01 c2                	add    %eax,%edx
+  803f8d:	8d 04 95 44 70 80 00 	lea    0x807044(,%edx,4),%eax
+  803f94:	50                   	push   %eax
+  803f95:	e8 c9 d5 ff ff       	call   801563 <sys_futex_wake>
+	sys_env_destroy(0);
+  803f9a:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  803fa1:	e8 d6 d1 ff ff       	call   80117c <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  803fa6:	83 c4 0c             	add    $0xc,%esp
+  803fa9:	68 9a 56 80 00       	push   $0x80569a
+  803fae:	68 a5 00 00 00       	push   $0xa5
+  803fb3:	68 b4 56 80 00       	push   $0x8056b4
+  803fb8:	e8 65 c7 ff ff       	call   800722 <_panic>
+
+00803fbd <pthread_start>:
+{
+  803fbd:	55                   	push   %ebp
+  803fbe:	89 e5                	mov    %esp,%ebp
+  803fc0:	53                   	push   %ebx
+  803fc1:	83 ec 04             	sub    $0x4,%esp
+  803fc4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  803fc7:	e8 fb d1 ff ff       	call   8011c7 <sys_getenvid>
+  803fcc:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  803fd1:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+	if (t == 0)
+  803fd7:	85 db                	test   %ebx,%ebx
+  803fd9:	74 0c                	je     803fe7 <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803fdb:	89 d9                	mov    %ebx,%ecx
+  803fdd:	c1 e1 10             	shl    $0x10,%ecx
+  803fe0:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803fe5:	29 ca                	sub    %ecx,%edx
+  803fe7:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  803fea:	c1 e0 04             	shl    $0x4,%eax
+  803fed:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803ff2:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  803ff4:	83 ec 0c             	sub    $0xc,%esp
+  803ff7:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803ffe:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  804001:	ff 34 95 4c 70 80 00 	push   0x80704c(,%edx,4)
+  804008:	ff 14 95 48 70 80 00 	call   *0x807048(,%edx,4)
+  80400f:	89 04 24             	mov    %eax,(%esp)
+  804012:	e8 25 ff ff ff       	call   803f3c <pthread_exit>
+
+00804017 <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  804017:	55                   	push   %ebp
+  804018:	89 e5                	mov    %esp,%ebp
+  80401a:	57                   	push   %edi
+  80401b:	56                   	push   %esi
+  80401c:	53                   	push   %ebx
+  80401d:	83 ec 1c             	sub    $0x1c,%esp
+  804020:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804022:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  804028:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80402f:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804034:	77 0d                	ja     804043 <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804036:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80403b:	29 d0                	sub    %edx,%eax
+  80403d:	c1 e8 10             	shr    $0x10,%eax
+  804040:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  804043:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804048:	eb 2f                	jmp    804079 <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  80404a:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  804050:	8b 01                	mov    (%ecx),%eax
+  804052:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  804055:	39 c2                	cmp    %eax,%edx
+  804057:	75 14                	jne    80406d <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  804059:	83 ec 0c             	sub    $0xc,%esp
+  80405c:	57                   	push   %edi
+  80405d:	e8 1a d1 ff ff       	call   80117c <sys_env_destroy>
+  804062:	83 c4 10             	add    $0x10,%esp
+  804065:	85 c0                	test   %eax,%eax
+  804067:	0f 88 97 00 00 00    	js     804104 <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  80406d:	83 c3 01             	add    $0x1,%ebx
+  804070:	83 fb 20             	cmp    $0x20,%ebx
+  804073:	0f 84 d2 00 00 00    	je     80414b <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  804079:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  80407c:	74 ef                	je     80406d <pthread_kill_others+0x56>
+  80407e:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  804081:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  804088:	8b 40 04             	mov    0x4(%eax),%eax
+  80408b:	83 f8 01             	cmp    $0x1,%eax
+  80408e:	75 dd                	jne    80406d <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  804090:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  804093:	8b 3c 85 40 70 80 00 	mov    0x807040(,%eax,4),%edi
+  80409a:	89 fe                	mov    %edi,%esi
+  80409c:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  8040a2:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  8040a5:	c1 e0 04             	shl    $0x4,%eax
+  8040a8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8040ad:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  8040b0:	39 c7                	cmp    %eax,%edi
+  8040b2:	75 b9                	jne    80406d <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  8040b4:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  8040b7:	c1 e0 04             	shl    $0x4,%eax
+  8040ba:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8040bf:	8b 40 54             	mov    0x54(%eax),%eax
+  8040c2:	85 c0                	test   %eax,%eax
+  8040c4:	74 a7                	je     80406d <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  8040c6:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  8040c9:	c1 e0 04             	shl    $0x4,%eax
+  8040cc:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  8040d2:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8040d4:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  8040da:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8040df:	0f 87 65 ff ff ff    	ja     80404a <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8040e5:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8040ea:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  8040ec:	c1 e8 10             	shr    $0x10,%eax
+  8040ef:	0f 84 55 ff ff ff    	je     80404a <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8040f5:	c1 e0 10             	shl    $0x10,%eax
+  8040f8:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8040fd:	29 c1                	sub    %eax,%ecx
+  8040ff:	e9 4c ff ff ff       	jmp    804050 <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  804104:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  804107:	c1 e2 04             	shl    $0x4,%edx
+  80410a:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  804110:	8b 52 48             	mov    0x48(%edx),%edx
+  804113:	39 fa                	cmp    %edi,%edx
+  804115:	0f 85 52 ff ff ff    	jne    80406d <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  80411b:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  80411e:	c1 e2 04             	shl    $0x4,%edx
+  804121:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  804127:	8b 52 54             	mov    0x54(%edx),%edx
+  80412a:	85 d2                	test   %edx,%edx
+  80412c:	0f 84 3b ff ff ff    	je     80406d <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  804132:	83 ec 0c             	sub    $0xc,%esp
+  804135:	50                   	push   %eax
+  804136:	57                   	push   %edi
+  804137:	68 c4 56 80 00       	push   $0x8056c4
+  80413c:	68 bb 00 00 00       	push   $0xbb
+  804141:	68 b4 56 80 00       	push   $0x8056b4
+  804146:	e8 d7 c5 ff ff       	call   800722 <_panic>
+	}
+}
+  80414b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80414e:	5b                   	pop    %ebx
+  80414f:	5e                   	pop    %esi
+  804150:	5f                   	pop    %edi
+  804151:	5d                   	pop    %ebp
+  804152:	c3                   	ret
+
+00804153 <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  804153:	55                   	push   %ebp
+  804154:	89 e5                	mov    %esp,%ebp
+  804156:	53                   	push   %ebx
+  804157:	83 ec 04             	sub    $0x4,%esp
+  80415a:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80415c:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  804162:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  804168:	0f 87 85 00 00 00    	ja     8041f3 <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80416e:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  804173:	29 c3                	sub    %eax,%ebx
+  804175:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  804178:	83 ec 04             	sub    $0x4,%esp
+  80417b:	68 80 02 00 00       	push   $0x280
+  804180:	6a 00                	push   $0x0
+  804182:	68 40 70 80 00       	push   $0x807040
+  804187:	e8 a6 cd ff ff       	call   800f32 <memset>
+	threads_mu.m_state = 0;
+  80418c:	c7 05 20 70 80 00 00 	movl   $0x0,0x807020
+  804193:	00 00 00 
+	if (self != 0) {
+  804196:	83 c4 10             	add    $0x10,%esp
+  804199:	85 db                	test   %ebx,%ebx
+  80419b:	74 51                	je     8041ee <pthread_fork_child+0x9b>
+  80419d:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80419f:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8041a5:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8041aa:	77 18                	ja     8041c4 <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8041ac:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8041b1:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8041b3:	c1 e8 10             	shr    $0x10,%eax
+  8041b6:	74 0c                	je     8041c4 <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8041b8:	c1 e0 10             	shl    $0x10,%eax
+  8041bb:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8041c0:	29 c2                	sub    %eax,%edx
+  8041c2:	eb 06                	jmp    8041ca <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  8041c4:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		threads[self].th_env = thisenv->env_id;
+  8041ca:	8b 02                	mov    (%edx),%eax
+  8041cc:	8b 48 48             	mov    0x48(%eax),%ecx
+  8041cf:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  8041d6:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  8041d9:	89 0c 95 40 70 80 00 	mov    %ecx,0x807040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  8041e0:	8d 04 95 40 70 80 00 	lea    0x807040(,%edx,4),%eax
+  8041e7:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  8041ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8041f1:	c9                   	leave
+  8041f2:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  8041f3:	83 ec 04             	sub    $0x4,%esp
+  8041f6:	68 80 02 00 00       	push   $0x280
+  8041fb:	6a 00                	push   $0x0
+  8041fd:	68 40 70 80 00       	push   $0x807040
+  804202:	e8 2b cd ff ff       	call   800f32 <memset>
+	threads_mu.m_state = 0;
+  804207:	c7 05 20 70 80 00 00 	movl   $0x0,0x807020
+  80420e:	00 00 00 
+  804211:	83 c4 10             	add    $0x10,%esp
+  804214:	eb d8                	jmp    8041ee <pthread_fork_child+0x9b>
+
+00804216 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  804216:	b8 00 00 00 00       	mov    $0x0,%eax
+  80421b:	c3                   	ret
+
+0080421c <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80421c:	55                   	push   %ebp
+  80421d:	89 e5                	mov    %esp,%ebp
+  80421f:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  804222:	68 e9 56 80 00       	push   $0x8056e9
+  804227:	ff 75 0c             	push   0xc(%ebp)
+  80422a:	e8 b2 cb ff ff       	call   800de1 <strcpy>
+	return 0;
+}
+  80422f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804234:	c9                   	leave
+  804235:	c3                   	ret
+
+00804236 <devcons_write>:
+{
+  804236:	55                   	push   %ebp
+  804237:	89 e5                	mov    %esp,%ebp
+  804239:	57                   	push   %edi
+  80423a:	56                   	push   %esi
+  80423b:	53                   	push   %ebx
+  80423c:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  804242:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  804247:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80424d:	eb 2e                	jmp    80427d <devcons_write+0x47>
+		m = n - tot;
+  80424f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804252:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  804254:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804259:	39 c3                	cmp    %eax,%ebx
+  80425b:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80425e:	83 ec 04             	sub    $0x4,%esp
+  804261:	53                   	push   %ebx
+  804262:	89 f0                	mov    %esi,%eax
+  804264:	03 45 0c             	add    0xc(%ebp),%eax
+  804267:	50                   	push   %eax
+  804268:	57                   	push   %edi
+  804269:	e8 f9 cc ff ff       	call   800f67 <memmove>
+		sys_cputs(buf, m);
+  80426e:	83 c4 08             	add    $0x8,%esp
+  804271:	53                   	push   %ebx
+  804272:	57                   	push   %edi
+  804273:	e8 ad ce ff ff       	call   801125 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  804278:	01 de                	add    %ebx,%esi
+  80427a:	83 c4 10             	add    $0x10,%esp
+  80427d:	3b 75 10             	cmp    0x10(%ebp),%esi
+  804280:	72 cd                	jb     80424f <devcons_write+0x19>
+}
+  804282:	89 f0                	mov    %esi,%eax
+  804284:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804287:	5b                   	pop    %ebx
+  804288:	5e                   	pop    %esi
+  804289:	5f                   	pop    %edi
+  80428a:	5d                   	pop    %ebp
+  80428b:	c3                   	ret
+
+0080428c <devcons_read>:
+{
+  80428c:	55                   	push   %ebp
+  80428d:	89 e5                	mov    %esp,%ebp
+  80428f:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  804292:	b8 00 00 00 00       	mov    $0x0,%eax
+  804297:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80429b:	75 07                	jne    8042a4 <devcons_read+0x18>
+  80429d:	eb 1f                	jmp    8042be <devcons_read+0x32>
+		sys_yield();
+  80429f:	e8 4f cf ff ff       	call   8011f3 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8042a4:	e8 a7 ce ff ff       	call   801150 <sys_cgetc>
+  8042a9:	85 c0                	test   %eax,%eax
+  8042ab:	74 f2                	je     80429f <devcons_read+0x13>
+	if (c < 0)
+  8042ad:	78 0f                	js     8042be <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8042af:	83 f8 04             	cmp    $0x4,%eax
+  8042b2:	74 0c                	je     8042c0 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8042b4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8042b7:	88 02                	mov    %al,(%edx)
+	return 1;
+  8042b9:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8042be:	c9                   	leave
+  8042bf:	c3                   	ret
+		return 0;
+  8042c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042c5:	eb f7                	jmp    8042be <devcons_read+0x32>
+
+008042c7 <cputchar>:
+{
+  8042c7:	55                   	push   %ebp
+  8042c8:	89 e5                	mov    %esp,%ebp
+  8042ca:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8042cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8042d0:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8042d3:	6a 01                	push   $0x1
+  8042d5:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8042d8:	50                   	push   %eax
+  8042d9:	e8 47 ce ff ff       	call   801125 <sys_cputs>
+}
+  8042de:	83 c4 10             	add    $0x10,%esp
+  8042e1:	c9                   	leave
+  8042e2:	c3                   	ret
+
+008042e3 <getchar>:
+{
+  8042e3:	55                   	push   %ebp
+  8042e4:	89 e5                	mov    %esp,%ebp
+  8042e6:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8042e9:	6a 01                	push   $0x1
+  8042eb:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8042ee:	50                   	push   %eax
+  8042ef:	6a 00                	push   $0x0
+  8042f1:	e8 63 d8 ff ff       	call   801b59 <read>
+	if (r < 0)
+  8042f6:	83 c4 10             	add    $0x10,%esp
+  8042f9:	85 c0                	test   %eax,%eax
+  8042fb:	78 06                	js     804303 <getchar+0x20>
+	if (r < 1)
+  8042fd:	74 06                	je     804305 <getchar+0x22>
+	return c;
+  8042ff:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  804303:	c9                   	leave
+  804304:	c3                   	ret
+		return -E_EOF;
+  804305:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80430a:	eb f7                	jmp    804303 <getchar+0x20>
+
+0080430c <iscons>:
+{
+  80430c:	55                   	push   %ebp
+  80430d:	89 e5                	mov    %esp,%ebp
+  80430f:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804312:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804315:	50                   	push   %eax
+  804316:	ff 75 08             	push   0x8(%ebp)
+  804319:	e8 ab d5 ff ff       	call   8018c9 <fd_lookup>
+  80431e:	83 c4 10             	add    $0x10,%esp
+  804321:	85 c0                	test   %eax,%eax
+  804323:	78 11                	js     804336 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  804325:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804328:	8b 15 b8 62 80 00    	mov    0x8062b8,%edx
+  80432e:	39 10                	cmp    %edx,(%eax)
+  804330:	0f 94 c0             	sete   %al
+  804333:	0f b6 c0             	movzbl %al,%eax
+}
+  804336:	c9                   	leave
+  804337:	c3                   	ret
+
+00804338 <opencons>:
+{
+  804338:	55                   	push   %ebp
+  804339:	89 e5                	mov    %esp,%ebp
+  80433b:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80433e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804341:	50                   	push   %eax
+  804342:	e8 2c d5 ff ff       	call   801873 <fd_alloc>
+  804347:	83 c4 10             	add    $0x10,%esp
+  80434a:	85 c0                	test   %eax,%eax
+  80434c:	78 3a                	js     804388 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80434e:	83 ec 04             	sub    $0x4,%esp
+  804351:	68 07 04 00 00       	push   $0x407
+  804356:	ff 75 f4             	push   -0xc(%ebp)
+  804359:	6a 00                	push   $0x0
+  80435b:	e8 bf ce ff ff       	call   80121f <sys_page_alloc>
+  804360:	83 c4 10             	add    $0x10,%esp
+  804363:	85 c0                	test   %eax,%eax
+  804365:	78 21                	js     804388 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  804367:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80436a:	8b 15 b8 62 80 00    	mov    0x8062b8,%edx
+  804370:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  804372:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804375:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80437c:	83 ec 0c             	sub    $0xc,%esp
+  80437f:	50                   	push   %eax
+  804380:	e8 c7 d4 ff ff       	call   80184c <fd2num>
+  804385:	83 c4 10             	add    $0x10,%esp
+}
+  804388:	c9                   	leave
+  804389:	c3                   	ret
+
+0080438a <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  80438a:	55                   	push   %ebp
+  80438b:	89 e5                	mov    %esp,%ebp
+  80438d:	57                   	push   %edi
+  80438e:	56                   	push   %esi
+  80438f:	53                   	push   %ebx
+  804390:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  804393:	89 d6                	mov    %edx,%esi
+  804395:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  804398:	89 cf                	mov    %ecx,%edi
+  80439a:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  80439d:	89 fa                	mov    %edi,%edx
+  80439f:	80 ce 08             	or     $0x8,%dh
+  8043a2:	f6 c5 08             	test   $0x8,%ch
+  8043a5:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  8043a8:	57                   	push   %edi
+  8043a9:	56                   	push   %esi
+  8043aa:	50                   	push   %eax
+  8043ab:	56                   	push   %esi
+  8043ac:	6a 00                	push   $0x0
+  8043ae:	e8 b9 ce ff ff       	call   80126c <sys_page_map>
+	if (r < 0) {
+  8043b3:	83 c4 20             	add    $0x20,%esp
+  8043b6:	85 c0                	test   %eax,%eax
+  8043b8:	78 27                	js     8043e1 <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  8043ba:	83 ec 0c             	sub    $0xc,%esp
+  8043bd:	57                   	push   %edi
+  8043be:	56                   	push   %esi
+  8043bf:	6a 00                	push   $0x0
+  8043c1:	56                   	push   %esi
+  8043c2:	6a 00                	push   $0x0
+  8043c4:	e8 a3 ce ff ff       	call   80126c <sys_page_map>
+  8043c9:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  8043cb:	83 c4 20             	add    $0x20,%esp
+  8043ce:	85 c0                	test   %eax,%eax
+  8043d0:	78 24                	js     8043f6 <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  8043d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8043d7:	89 d8                	mov    %ebx,%eax
+  8043d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8043dc:	5b                   	pop    %ebx
+  8043dd:	5e                   	pop    %esi
+  8043de:	5f                   	pop    %edi
+  8043df:	5d                   	pop    %ebp
+  8043e0:	c3                   	ret
+  8043e1:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  8043e3:	83 ec 08             	sub    $0x8,%esp
+  8043e6:	50                   	push   %eax
+  8043e7:	68 f8 56 80 00       	push   $0x8056f8
+  8043ec:	e8 0c c4 ff ff       	call   8007fd <cprintf>
+		return r;
+  8043f1:	83 c4 10             	add    $0x10,%esp
+  8043f4:	eb e1                	jmp    8043d7 <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  8043f6:	83 ec 08             	sub    $0x8,%esp
+  8043f9:	50                   	push   %eax
+  8043fa:	68 28 57 80 00       	push   $0x805728
+  8043ff:	e8 f9 c3 ff ff       	call   8007fd <cprintf>
+		return r;
+  804404:	83 c4 10             	add    $0x10,%esp
+  804407:	eb ce                	jmp    8043d7 <duppage_cow+0x4d>
+
+00804409 <duppage>:
+{
+  804409:	55                   	push   %ebp
+  80440a:	89 e5                	mov    %esp,%ebp
+  80440c:	53                   	push   %ebx
+  80440d:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  804410:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  804413:	51                   	push   %ecx
+  804414:	52                   	push   %edx
+  804415:	50                   	push   %eax
+  804416:	52                   	push   %edx
+  804417:	6a 00                	push   $0x0
+  804419:	e8 4e ce ff ff       	call   80126c <sys_page_map>
+	if (r < 0) {
+  80441e:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  804421:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  804426:	85 c0                	test   %eax,%eax
+  804428:	78 07                	js     804431 <duppage+0x28>
+}
+  80442a:	89 d8                	mov    %ebx,%eax
+  80442c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80442f:	c9                   	leave
+  804430:	c3                   	ret
+  804431:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  804433:	83 ec 08             	sub    $0x8,%esp
+  804436:	50                   	push   %eax
+  804437:	68 f8 56 80 00       	push   $0x8056f8
+  80443c:	e8 bc c3 ff ff       	call   8007fd <cprintf>
+		return r;
+  804441:	83 c4 10             	add    $0x10,%esp
+  804444:	eb e4                	jmp    80442a <duppage+0x21>
+
+00804446 <cow_copy>:
+{
+  804446:	55                   	push   %ebp
+  804447:	89 e5                	mov    %esp,%ebp
+  804449:	56                   	push   %esi
+  80444a:	53                   	push   %ebx
+  80444b:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  80444d:	83 ec 04             	sub    $0x4,%esp
+  804450:	6a 07                	push   $0x7
+  804452:	68 00 f0 7f 00       	push   $0x7ff000
+  804457:	6a 00                	push   $0x0
+  804459:	e8 c1 cd ff ff       	call   80121f <sys_page_alloc>
+	if (r < 0) {
+  80445e:	83 c4 10             	add    $0x10,%esp
+  804461:	85 c0                	test   %eax,%eax
+  804463:	78 58                	js     8044bd <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  804465:	83 ec 04             	sub    $0x4,%esp
+  804468:	68 00 10 00 00       	push   $0x1000
+  80446d:	56                   	push   %esi
+  80446e:	68 00 f0 7f 00       	push   $0x7ff000
+  804473:	e8 ef ca ff ff       	call   800f67 <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  804478:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80447f:	56                   	push   %esi
+  804480:	6a 00                	push   $0x0
+  804482:	68 00 f0 7f 00       	push   $0x7ff000
+  804487:	6a 00                	push   $0x0
+  804489:	e8 de cd ff ff       	call   80126c <sys_page_map>
+  80448e:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  804490:	83 c4 20             	add    $0x20,%esp
+  804493:	85 c0                	test   %eax,%eax
+  804495:	78 3b                	js     8044d2 <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  804497:	83 ec 08             	sub    $0x8,%esp
+  80449a:	68 00 f0 7f 00       	push   $0x7ff000
+  80449f:	6a 00                	push   $0x0
+  8044a1:	e8 12 ce ff ff       	call   8012b8 <sys_page_unmap>
+  8044a6:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  8044a8:	83 c4 10             	add    $0x10,%esp
+  8044ab:	85 c0                	test   %eax,%eax
+  8044ad:	78 45                	js     8044f4 <cow_copy+0xae>
+	return 0;
+  8044af:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8044b4:	89 d8                	mov    %ebx,%eax
+  8044b6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8044b9:	5b                   	pop    %ebx
+  8044ba:	5e                   	pop    %esi
+  8044bb:	5d                   	pop    %ebp
+  8044bc:	c3                   	ret
+  8044bd:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  8044bf:	83 ec 08             	sub    $0x8,%esp
+  8044c2:	50                   	push   %eax
+  8044c3:	68 18 58 80 00       	push   $0x805818
+  8044c8:	e8 30 c3 ff ff       	call   8007fd <cprintf>
+		return r;
+  8044cd:	83 c4 10             	add    $0x10,%esp
+  8044d0:	eb e2                	jmp    8044b4 <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  8044d2:	83 ec 08             	sub    $0x8,%esp
+  8044d5:	50                   	push   %eax
+  8044d6:	68 34 58 80 00       	push   $0x805834
+  8044db:	e8 1d c3 ff ff       	call   8007fd <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  8044e0:	83 c4 08             	add    $0x8,%esp
+  8044e3:	68 00 f0 7f 00       	push   $0x7ff000
+  8044e8:	6a 00                	push   $0x0
+  8044ea:	e8 c9 cd ff ff       	call   8012b8 <sys_page_unmap>
+		return r;
+  8044ef:	83 c4 10             	add    $0x10,%esp
+  8044f2:	eb c0                	jmp    8044b4 <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  8044f4:	83 ec 08             	sub    $0x8,%esp
+  8044f7:	50                   	push   %eax
+  8044f8:	68 50 57 80 00       	push   $0x805750
+  8044fd:	e8 fb c2 ff ff       	call   8007fd <cprintf>
+		return r;
+  804502:	83 c4 10             	add    $0x10,%esp
+  804505:	eb ad                	jmp    8044b4 <cow_copy+0x6e>
+
+00804507 <pgfault>:
+{
+  804507:	55                   	push   %ebp
+  804508:	89 e5                	mov    %esp,%ebp
+  80450a:	56                   	push   %esi
+  80450b:	53                   	push   %ebx
+  80450c:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  80450f:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  804511:	89 d8                	mov    %ebx,%eax
+  804513:	c1 e8 16             	shr    $0x16,%eax
+  804516:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  80451d:	89 de                	mov    %ebx,%esi
+  80451f:	c1 ee 0c             	shr    $0xc,%esi
+  804522:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  804529:	a8 07                	test   $0x7,%al
+  80452b:	74 3b                	je     804568 <pgfault+0x61>
+  80452d:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  804533:	74 33                	je     804568 <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  804535:	83 ec 0c             	sub    $0xc,%esp
+  804538:	68 00 f0 bf ee       	push   $0xeebff000
+  80453d:	e8 c8 f4 ff ff       	call   803a0a <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  804542:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  804549:	83 c4 10             	add    $0x10,%esp
+  80454c:	f6 c4 08             	test   $0x8,%ah
+  80454f:	75 30                	jne    804581 <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  804551:	83 ec 0c             	sub    $0xc,%esp
+  804554:	68 00 f0 bf ee       	push   $0xeebff000
+  804559:	e8 19 f5 ff ff       	call   803a77 <mutex_unlock>
+}
+  80455e:	83 c4 10             	add    $0x10,%esp
+  804561:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804564:	5b                   	pop    %ebx
+  804565:	5e                   	pop    %esi
+  804566:	5d                   	pop    %ebp
+  804567:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  804568:	83 ec 08             	sub    $0x8,%esp
+  80456b:	ff 72 28             	push   0x28(%edx)
+  80456e:	51                   	push   %ecx
+  80456f:	50                   	push   %eax
+  804570:	68 74 57 80 00       	push   $0x805774
+  804575:	6a 3f                	push   $0x3f
+  804577:	68 4e 58 80 00       	push   $0x80584e
+  80457c:	e8 a1 c1 ff ff       	call   800722 <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  804581:	89 d8                	mov    %ebx,%eax
+  804583:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  804588:	e8 b9 fe ff ff       	call   804446 <cow_copy>
+  80458d:	eb c2                	jmp    804551 <pgfault+0x4a>
+
+0080458f <cow_enable>:
+{
+  80458f:	55                   	push   %ebp
+  804590:	89 e5                	mov    %esp,%ebp
+  804592:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  804595:	68 07 45 80 00       	push   $0x804507
+  80459a:	e8 9d 04 00 00       	call   804a3c <set_pgfault_handler>
+}
+  80459f:	83 c4 10             	add    $0x10,%esp
+  8045a2:	c9                   	leave
+  8045a3:	c3                   	ret
+
+008045a4 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  8045a4:	55                   	push   %ebp
+  8045a5:	89 e5                	mov    %esp,%ebp
+  8045a7:	57                   	push   %edi
+  8045a8:	56                   	push   %esi
+  8045a9:	53                   	push   %ebx
+  8045aa:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  8045ad:	68 07 45 80 00       	push   $0x804507
+  8045b2:	e8 85 04 00 00       	call   804a3c <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  8045b7:	b8 07 00 00 00       	mov    $0x7,%eax
+  8045bc:	cd 30                	int    $0x30
+  8045be:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  8045c1:	83 c4 10             	add    $0x10,%esp
+  8045c4:	85 c0                	test   %eax,%eax
+  8045c6:	78 4b                	js     804613 <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  8045c8:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8045cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8045d2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  8045d5:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8045d9:	0f 85 16 01 00 00    	jne    8046f5 <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8045df:	e8 e3 cb ff ff       	call   8011c7 <sys_getenvid>
+  8045e4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8045e9:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8045eb:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  8045f1:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8045f7:	77 32                	ja     80462b <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8045f9:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  8045fe:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  804600:	c1 ea 10             	shr    $0x10,%edx
+  804603:	74 26                	je     80462b <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804605:	c1 e2 10             	shl    $0x10,%edx
+  804608:	89 d1                	mov    %edx,%ecx
+  80460a:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80460f:	29 ca                	sub    %ecx,%edx
+  804611:	eb 1e                	jmp    804631 <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  804613:	83 ec 08             	sub    $0x8,%esp
+  804616:	89 c7                	mov    %eax,%edi
+  804618:	50                   	push   %eax
+  804619:	68 59 58 80 00       	push   $0x805859
+  80461e:	e8 da c1 ff ff       	call   8007fd <cprintf>
+		return eid;
+  804623:	83 c4 10             	add    $0x10,%esp
+  804626:	e9 6c 01 00 00       	jmp    804797 <fork+0x1f3>
+		return pthread_main_tls;
+  80462b:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  804631:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  804634:	c1 e0 04             	shl    $0x4,%eax
+  804637:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80463c:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  80463e:	e8 10 fb ff ff       	call   804153 <pthread_fork_child>
+		return eid;
+  804643:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804646:	e9 4c 01 00 00       	jmp    804797 <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  80464b:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  804651:	89 da                	mov    %ebx,%edx
+  804653:	89 f8                	mov    %edi,%eax
+  804655:	e8 af fd ff ff       	call   804409 <duppage>
+  80465a:	85 c0                	test   %eax,%eax
+  80465c:	79 28                	jns    804686 <fork+0xe2>
+  80465e:	89 c7                	mov    %eax,%edi
+  804660:	e9 32 01 00 00       	jmp    804797 <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  804665:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  80466b:	83 f9 05             	cmp    $0x5,%ecx
+  80466e:	75 58                	jne    8046c8 <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  804670:	b9 05 00 00 00       	mov    $0x5,%ecx
+  804675:	89 da                	mov    %ebx,%edx
+  804677:	89 f8                	mov    %edi,%eax
+  804679:	e8 8b fd ff ff       	call   804409 <duppage>
+  80467e:	85 c0                	test   %eax,%eax
+  804680:	0f 88 0f 01 00 00    	js     804795 <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  804686:	83 c3 01             	add    $0x1,%ebx
+  804689:	39 de                	cmp    %ebx,%esi
+  80468b:	74 54                	je     8046e1 <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  80468d:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  804694:	f6 c1 05             	test   $0x5,%cl
+  804697:	74 ed                	je     804686 <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  804699:	f6 c5 04             	test   $0x4,%ch
+  80469c:	75 ad                	jne    80464b <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  80469e:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  8046a4:	74 bf                	je     804665 <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  8046a6:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8046ac:	74 d8                	je     804686 <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  8046ae:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  8046b4:	89 da                	mov    %ebx,%edx
+  8046b6:	89 f8                	mov    %edi,%eax
+  8046b8:	e8 cd fc ff ff       	call   80438a <duppage_cow>
+  8046bd:	85 c0                	test   %eax,%eax
+  8046bf:	79 c5                	jns    804686 <fork+0xe2>
+  8046c1:	89 c7                	mov    %eax,%edi
+  8046c3:	e9 cf 00 00 00       	jmp    804797 <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  8046c8:	68 a4 57 80 00       	push   $0x8057a4
+  8046cd:	68 b1 55 80 00       	push   $0x8055b1
+  8046d2:	68 c6 00 00 00       	push   $0xc6
+  8046d7:	68 4e 58 80 00       	push   $0x80584e
+  8046dc:	e8 41 c0 ff ff       	call   800722 <_panic>
+  8046e1:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8046e4:	83 c1 01             	add    $0x1,%ecx
+  8046e7:	81 c6 00 04 00 00    	add    $0x400,%esi
+  8046ed:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  8046f3:	74 18                	je     80470d <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  8046f5:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  8046fc:	a8 07                	test   $0x7,%al
+  8046fe:	74 e4                	je     8046e4 <fork+0x140>
+  804700:	89 cb                	mov    %ecx,%ebx
+  804702:	c1 e3 0a             	shl    $0xa,%ebx
+  804705:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  804708:	e9 7c ff ff ff       	jmp    804689 <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  80470d:	83 ec 04             	sub    $0x4,%esp
+  804710:	6a 07                	push   $0x7
+  804712:	68 00 f0 bf ee       	push   $0xeebff000
+  804717:	ff 75 e4             	push   -0x1c(%ebp)
+  80471a:	e8 00 cb ff ff       	call   80121f <sys_page_alloc>
+  80471f:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804721:	83 c4 10             	add    $0x10,%esp
+  804724:	85 c0                	test   %eax,%eax
+  804726:	78 34                	js     80475c <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  804728:	83 ec 08             	sub    $0x8,%esp
+  80472b:	68 7a 4a 80 00       	push   $0x804a7a
+  804730:	ff 75 e4             	push   -0x1c(%ebp)
+  804733:	e8 64 cc ff ff       	call   80139c <sys_env_set_pgfault_upcall>
+  804738:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80473a:	83 c4 10             	add    $0x10,%esp
+  80473d:	85 c0                	test   %eax,%eax
+  80473f:	78 2e                	js     80476f <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  804741:	83 ec 08             	sub    $0x8,%esp
+  804744:	6a 02                	push   $0x2
+  804746:	ff 75 e4             	push   -0x1c(%ebp)
+  804749:	e8 b6 cb ff ff       	call   801304 <sys_env_set_status>
+  80474e:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804750:	83 c4 10             	add    $0x10,%esp
+  804753:	85 c0                	test   %eax,%eax
+  804755:	78 2b                	js     804782 <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  804757:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80475a:	eb 3b                	jmp    804797 <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  80475c:	83 ec 08             	sub    $0x8,%esp
+  80475f:	50                   	push   %eax
+  804760:	68 cc 57 80 00       	push   $0x8057cc
+  804765:	e8 93 c0 ff ff       	call   8007fd <cprintf>
+		return r;
+  80476a:	83 c4 10             	add    $0x10,%esp
+  80476d:	eb 28                	jmp    804797 <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  80476f:	83 ec 08             	sub    $0x8,%esp
+  804772:	50                   	push   %eax
+  804773:	68 f4 57 80 00       	push   $0x8057f4
+  804778:	e8 80 c0 ff ff       	call   8007fd <cprintf>
+		return r;
+  80477d:	83 c4 10             	add    $0x10,%esp
+  804780:	eb 15                	jmp    804797 <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  804782:	83 ec 08             	sub    $0x8,%esp
+  804785:	50                   	push   %eax
+  804786:	68 69 58 80 00       	push   $0x805869
+  80478b:	e8 6d c0 ff ff       	call   8007fd <cprintf>
+		return r;
+  804790:	83 c4 10             	add    $0x10,%esp
+  804793:	eb 02                	jmp    804797 <fork+0x1f3>
+  804795:	89 c7                	mov    %eax,%edi
+}
+  804797:	89 f8                	mov    %edi,%eax
+  804799:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80479c:	5b                   	pop    %ebx
+  80479d:	5e                   	pop    %esi
+  80479e:	5f                   	pop    %edi
+  80479f:	5d                   	pop    %ebp
+  8047a0:	c3                   	ret
+
+008047a1 <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  8047a1:	55                   	push   %ebp
+  8047a2:	89 e5                	mov    %esp,%ebp
+  8047a4:	57                   	push   %edi
+  8047a5:	56                   	push   %esi
+  8047a6:	53                   	push   %ebx
+  8047a7:	83 ec 2c             	sub    $0x2c,%esp
+  8047aa:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8047ac:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  8047b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8047b7:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8047bd:	77 0a                	ja     8047c9 <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8047bf:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  8047c4:	29 c3                	sub    %eax,%ebx
+  8047c6:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  8047c9:	83 ec 0c             	sub    $0xc,%esp
+  8047cc:	68 07 45 80 00       	push   $0x804507
+  8047d1:	e8 66 02 00 00       	call   804a3c <set_pgfault_handler>
+  8047d6:	b8 07 00 00 00       	mov    $0x7,%eax
+  8047db:	cd 30                	int    $0x30
+  8047dd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  8047e0:	83 c4 10             	add    $0x10,%esp
+  8047e3:	85 c0                	test   %eax,%eax
+  8047e5:	78 30                	js     804817 <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  8047e7:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8047eb:	74 42                	je     80482f <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  8047ed:	c1 e3 10             	shl    $0x10,%ebx
+  8047f0:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  8047f5:	29 d8                	sub    %ebx,%eax
+  8047f7:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8047fa:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  8047ff:	29 d8                	sub    %ebx,%eax
+  804801:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  804804:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804809:	ba 00 00 00 00       	mov    $0x0,%edx
+  80480e:	89 f7                	mov    %esi,%edi
+  804810:	89 d6                	mov    %edx,%esi
+  804812:	e9 2c 01 00 00       	jmp    804943 <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  804817:	83 ec 08             	sub    $0x8,%esp
+  80481a:	89 c7                	mov    %eax,%edi
+  80481c:	50                   	push   %eax
+  80481d:	68 59 58 80 00       	push   $0x805859
+  804822:	e8 d6 bf ff ff       	call   8007fd <cprintf>
+		return eid;
+  804827:	83 c4 10             	add    $0x10,%esp
+  80482a:	e9 d5 00 00 00       	jmp    804904 <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80482f:	e8 93 c9 ff ff       	call   8011c7 <sys_getenvid>
+  804834:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804839:	89 c2                	mov    %eax,%edx
+  80483b:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80483d:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  804843:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804848:	77 18                	ja     804862 <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80484a:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80484f:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  804851:	c1 e8 10             	shr    $0x10,%eax
+  804854:	74 0c                	je     804862 <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804856:	c1 e0 10             	shl    $0x10,%eax
+  804859:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80485e:	29 c1                	sub    %eax,%ecx
+  804860:	eb 06                	jmp    804868 <sfork+0xc7>
+		return pthread_main_tls;
+  804862:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+  804868:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80486b:	c1 e0 04             	shl    $0x4,%eax
+  80486e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804873:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  804875:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  804878:	e9 87 00 00 00       	jmp    804904 <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  80487d:	f6 c5 04             	test   $0x4,%ch
+  804880:	74 6c                	je     8048ee <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  804882:	89 ca                	mov    %ecx,%edx
+  804884:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  80488a:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  804890:	74 7c                	je     80490e <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  804892:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  804898:	89 da                	mov    %ebx,%edx
+  80489a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80489d:	e8 67 fb ff ff       	call   804409 <duppage>
+  8048a2:	85 c0                	test   %eax,%eax
+  8048a4:	0f 88 4f 01 00 00    	js     8049f9 <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  8048aa:	83 c3 01             	add    $0x1,%ebx
+  8048ad:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  8048b0:	74 7a                	je     80492c <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  8048b2:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  8048b4:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  8048bb:	f6 c1 01             	test   $0x1,%cl
+  8048be:	74 ea                	je     8048aa <sfork+0x109>
+  8048c0:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8048c6:	74 e2                	je     8048aa <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  8048c8:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  8048ce:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  8048d1:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  8048d6:	76 a5                	jbe    80487d <sfork+0xdc>
+  8048d8:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  8048de:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8048e1:	39 fa                	cmp    %edi,%edx
+  8048e3:	73 9d                	jae    804882 <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  8048e5:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  8048e8:	39 fa                	cmp    %edi,%edx
+  8048ea:	72 96                	jb     804882 <sfork+0xe1>
+  8048ec:	eb 8f                	jmp    80487d <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8048ee:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8048f4:	89 da                	mov    %ebx,%edx
+  8048f6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8048f9:	e8 8c fa ff ff       	call   80438a <duppage_cow>
+  8048fe:	85 c0                	test   %eax,%eax
+  804900:	79 a8                	jns    8048aa <sfork+0x109>
+  804902:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  804904:	89 f8                	mov    %edi,%eax
+  804906:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804909:	5b                   	pop    %ebx
+  80490a:	5e                   	pop    %esi
+  80490b:	5f                   	pop    %edi
+  80490c:	5d                   	pop    %ebp
+  80490d:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  80490e:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  804913:	e8 2e fb ff ff       	call   804446 <cow_copy>
+  804918:	85 c0                	test   %eax,%eax
+  80491a:	0f 88 d2 00 00 00    	js     8049f2 <sfork+0x251>
+				pte = uvpt[pn];
+  804920:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  804927:	e9 66 ff ff ff       	jmp    804892 <sfork+0xf1>
+  80492c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80492f:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804932:	83 c6 01             	add    $0x1,%esi
+  804935:	81 c7 00 04 00 00    	add    $0x400,%edi
+  80493b:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  804941:	74 1b                	je     80495e <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  804943:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  80494a:	a8 01                	test   $0x1,%al
+  80494c:	74 e4                	je     804932 <sfork+0x191>
+  80494e:	89 f3                	mov    %esi,%ebx
+  804950:	c1 e3 0a             	shl    $0xa,%ebx
+  804953:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  804956:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  804959:	e9 4f ff ff ff       	jmp    8048ad <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  80495e:	83 ec 04             	sub    $0x4,%esp
+  804961:	6a 07                	push   $0x7
+  804963:	68 00 f0 bf ee       	push   $0xeebff000
+  804968:	ff 75 e0             	push   -0x20(%ebp)
+  80496b:	e8 af c8 ff ff       	call   80121f <sys_page_alloc>
+  804970:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804972:	83 c4 10             	add    $0x10,%esp
+  804975:	85 c0                	test   %eax,%eax
+  804977:	78 37                	js     8049b0 <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  804979:	83 ec 08             	sub    $0x8,%esp
+  80497c:	68 7a 4a 80 00       	push   $0x804a7a
+  804981:	ff 75 e0             	push   -0x20(%ebp)
+  804984:	e8 13 ca ff ff       	call   80139c <sys_env_set_pgfault_upcall>
+  804989:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80498b:	83 c4 10             	add    $0x10,%esp
+  80498e:	85 c0                	test   %eax,%eax
+  804990:	78 34                	js     8049c6 <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  804992:	83 ec 08             	sub    $0x8,%esp
+  804995:	6a 02                	push   $0x2
+  804997:	ff 75 e0             	push   -0x20(%ebp)
+  80499a:	e8 65 c9 ff ff       	call   801304 <sys_env_set_status>
+  80499f:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8049a1:	83 c4 10             	add    $0x10,%esp
+  8049a4:	85 c0                	test   %eax,%eax
+  8049a6:	78 34                	js     8049dc <sfork+0x23b>
+	return eid;
+  8049a8:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8049ab:	e9 54 ff ff ff       	jmp    804904 <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  8049b0:	83 ec 08             	sub    $0x8,%esp
+  8049b3:	50                   	push   %eax
+  8049b4:	68 cc 57 80 00       	push   $0x8057cc
+  8049b9:	e8 3f be ff ff       	call   8007fd <cprintf>
+		return r;
+  8049be:	83 c4 10             	add    $0x10,%esp
+  8049c1:	e9 3e ff ff ff       	jmp    804904 <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  8049c6:	83 ec 08             	sub    $0x8,%esp
+  8049c9:	50                   	push   %eax
+  8049ca:	68 f4 57 80 00       	push   $0x8057f4
+  8049cf:	e8 29 be ff ff       	call   8007fd <cprintf>
+		return r;
+  8049d4:	83 c4 10             	add    $0x10,%esp
+  8049d7:	e9 28 ff ff ff       	jmp    804904 <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  8049dc:	83 ec 08             	sub    $0x8,%esp
+  8049df:	50                   	push   %eax
+  8049e0:	68 69 58 80 00       	push   $0x805869
+  8049e5:	e8 13 be ff ff       	call   8007fd <cprintf>
+		return r;
+  8049ea:	83 c4 10             	add    $0x10,%esp
+  8049ed:	e9 12 ff ff ff       	jmp    804904 <sfork+0x163>
+  8049f2:	89 c7                	mov    %eax,%edi
+  8049f4:	e9 0b ff ff ff       	jmp    804904 <sfork+0x163>
+  8049f9:	89 c7                	mov    %eax,%edi
+  8049fb:	e9 04 ff ff ff       	jmp    804904 <sfork+0x163>
+
+00804a00 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804a00:	55                   	push   %ebp
+  804a01:	89 e5                	mov    %esp,%ebp
+  804a03:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804a06:	89 c2                	mov    %eax,%edx
+  804a08:	c1 ea 16             	shr    $0x16,%edx
+  804a0b:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  804a12:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804a17:	f6 c1 01             	test   $0x1,%cl
+  804a1a:	74 1c                	je     804a38 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  804a1c:	c1 e8 0c             	shr    $0xc,%eax
+  804a1f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  804a26:	a8 01                	test   $0x1,%al
+  804a28:	74 0e                	je     804a38 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  804a2a:	c1 e8 0c             	shr    $0xc,%eax
+  804a2d:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  804a34:	ef 
+  804a35:	0f b7 d2             	movzwl %dx,%edx
+}
+  804a38:	89 d0                	mov    %edx,%eax
+  804a3a:	5d                   	pop    %ebp
+  804a3b:	c3                   	ret
+
+00804a3c <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804a3c:	55                   	push   %ebp
+  804a3d:	89 e5                	mov    %esp,%ebp
+  804a3f:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  804a42:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  804a49:	74 0a                	je     804a55 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804a4b:	8b 45 08             	mov    0x8(%ebp),%eax
+  804a4e:	a3 00 a0 80 00       	mov    %eax,0x80a000
+}
+  804a53:	c9                   	leave
+  804a54:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  804a55:	83 ec 04             	sub    $0x4,%esp
+  804a58:	6a 07                	push   $0x7
+  804a5a:	68 00 f0 bf ee       	push   $0xeebff000
+  804a5f:	6a 00                	push   $0x0
+  804a61:	e8 b9 c7 ff ff       	call   80121f <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804a66:	83 c4 08             	add    $0x8,%esp
+  804a69:	68 7a 4a 80 00       	push   $0x804a7a
+  804a6e:	6a 00                	push   $0x0
+  804a70:	e8 27 c9 ff ff       	call   80139c <sys_env_set_pgfault_upcall>
+  804a75:	83 c4 10             	add    $0x10,%esp
+  804a78:	eb d1                	jmp    804a4b <set_pgfault_handler+0xf>
+
+00804a7a <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804a7a:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804a7b:	a1 00 a0 80 00       	mov    0x80a000,%eax
+	call *%eax
+  804a80:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804a82:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  804a85:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  804a89:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  804a8d:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  804a90:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  804a94:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  804a96:	83 c4 08             	add    $0x8,%esp
+	popal
+  804a99:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  804a9a:	83 c4 04             	add    $0x4,%esp
+	popfl
+  804a9d:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  804a9e:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  804a9f:	c3                   	ret
+
+00804aa0 <udm>:
+  804aa0:	57                   	push   %edi
+  804aa1:	56                   	push   %esi
+  804aa2:	53                   	push   %ebx
+  804aa3:	83 ec 20             	sub    $0x20,%esp
+  804aa6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  804aaa:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804aae:	8b 44 24 30          	mov    0x30(%esp),%eax
+  804ab2:	8b 54 24 34          	mov    0x34(%esp),%edx
+  804ab6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804aba:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804abe:	89 d1                	mov    %edx,%ecx
+  804ac0:	09 c1                	or     %eax,%ecx
+  804ac2:	0f 84 91 00 00 00    	je     804b59 <udm+0xb9>
+  804ac8:	b8 00 00 00 00       	mov    $0x0,%eax
+  804acd:	ba 00 00 00 00       	mov    $0x0,%edx
+  804ad2:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804ad7:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804ade:	00 
+  804adf:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  804ae6:	00 
+  804ae7:	eb 08                	jmp    804af1 <udm+0x51>
+  804ae9:	83 e9 01             	sub    $0x1,%ecx
+  804aec:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  804aef:	74 7c                	je     804b6d <udm+0xcd>
+  804af1:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804af5:	01 c0                	add    %eax,%eax
+  804af7:	89 c6                	mov    %eax,%esi
+  804af9:	89 d7                	mov    %edx,%edi
+  804afb:	8b 44 24 10          	mov    0x10(%esp),%eax
+  804aff:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804b03:	0f ad d0             	shrd   %cl,%edx,%eax
+  804b06:	d3 ea                	shr    %cl,%edx
+  804b08:	f6 c1 20             	test   $0x20,%cl
+  804b0b:	74 04                	je     804b11 <udm+0x71>
+  804b0d:	89 d0                	mov    %edx,%eax
+  804b0f:	31 d2                	xor    %edx,%edx
+  804b11:	83 e0 01             	and    $0x1,%eax
+  804b14:	89 04 24             	mov    %eax,(%esp)
+  804b17:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804b1e:	00 
+  804b1f:	8b 04 24             	mov    (%esp),%eax
+  804b22:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804b26:	09 f0                	or     %esi,%eax
+  804b28:	09 fa                	or     %edi,%edx
+  804b2a:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804b2e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804b32:	39 f0                	cmp    %esi,%eax
+  804b34:	89 d3                	mov    %edx,%ebx
+  804b36:	19 fb                	sbb    %edi,%ebx
+  804b38:	72 af                	jb     804ae9 <udm+0x49>
+  804b3a:	29 f0                	sub    %esi,%eax
+  804b3c:	19 fa                	sbb    %edi,%edx
+  804b3e:	89 cf                	mov    %ecx,%edi
+  804b40:	c1 ef 05             	shr    $0x5,%edi
+  804b43:	83 e7 01             	and    $0x1,%edi
+  804b46:	89 fe                	mov    %edi,%esi
+  804b48:	83 f6 01             	xor    $0x1,%esi
+  804b4b:	d3 e6                	shl    %cl,%esi
+  804b4d:	d3 e7                	shl    %cl,%edi
+  804b4f:	09 74 24 18          	or     %esi,0x18(%esp)
+  804b53:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804b57:	eb 90                	jmp    804ae9 <udm+0x49>
+  804b59:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804b5d:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804b61:	89 f0                	mov    %esi,%eax
+  804b63:	89 fa                	mov    %edi,%edx
+  804b65:	89 74 24 18          	mov    %esi,0x18(%esp)
+  804b69:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  804b6d:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  804b71:	89 01                	mov    %eax,(%ecx)
+  804b73:	89 51 04             	mov    %edx,0x4(%ecx)
+  804b76:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804b7a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804b7e:	83 c4 20             	add    $0x20,%esp
+  804b81:	5b                   	pop    %ebx
+  804b82:	5e                   	pop    %esi
+  804b83:	5f                   	pop    %edi
+  804b84:	c3                   	ret
+
+00804b85 <__udivdi3>:
+  804b85:	83 ec 18             	sub    $0x18,%esp
+  804b88:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804b8c:	50                   	push   %eax
+  804b8d:	ff 74 24 2c          	push   0x2c(%esp)
+  804b91:	ff 74 24 2c          	push   0x2c(%esp)
+  804b95:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804b99:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804b9d:	e8 fe fe ff ff       	call   804aa0 <udm>
+  804ba2:	83 c4 24             	add    $0x24,%esp
+  804ba5:	c3                   	ret
+
+00804ba6 <__umoddi3>:
+  804ba6:	83 ec 18             	sub    $0x18,%esp
+  804ba9:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804bad:	50                   	push   %eax
+  804bae:	ff 74 24 2c          	push   0x2c(%esp)
+  804bb2:	ff 74 24 2c          	push   0x2c(%esp)
+  804bb6:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804bba:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804bbe:	e8 dd fe ff ff       	call   804aa0 <udm>
+  804bc3:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804bc7:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804bcb:	83 c4 24             	add    $0x24,%esp
+  804bce:	c3                   	ret
+
+00804bcf <__divdi3>:
+  804bcf:	56                   	push   %esi
+  804bd0:	53                   	push   %ebx
+  804bd1:	83 ec 14             	sub    $0x14,%esp
+  804bd4:	8b 44 24 20          	mov    0x20(%esp),%eax
+  804bd8:	8b 54 24 24          	mov    0x24(%esp),%edx
+  804bdc:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  804be0:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  804be4:	85 d2                	test   %edx,%edx
+  804be6:	78 18                	js     804c00 <__divdi3+0x31>
+  804be8:	85 db                	test   %ebx,%ebx
+  804bea:	78 3e                	js     804c2a <__divdi3+0x5b>
+  804bec:	83 ec 04             	sub    $0x4,%esp
+  804bef:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804bf3:	56                   	push   %esi
+  804bf4:	53                   	push   %ebx
+  804bf5:	51                   	push   %ecx
+  804bf6:	e8 a5 fe ff ff       	call   804aa0 <udm>
+  804bfb:	83 c4 10             	add    $0x10,%esp
+  804bfe:	eb 24                	jmp    804c24 <__divdi3+0x55>
+  804c00:	f7 d8                	neg    %eax
+  804c02:	83 d2 00             	adc    $0x0,%edx
+  804c05:	f7 da                	neg    %edx
+  804c07:	85 db                	test   %ebx,%ebx
+  804c09:	78 3a                	js     804c45 <__divdi3+0x76>
+  804c0b:	83 ec 04             	sub    $0x4,%esp
+  804c0e:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804c12:	56                   	push   %esi
+  804c13:	53                   	push   %ebx
+  804c14:	51                   	push   %ecx
+  804c15:	e8 86 fe ff ff       	call   804aa0 <udm>
+  804c1a:	83 c4 10             	add    $0x10,%esp
+  804c1d:	f7 d8                	neg    %eax
+  804c1f:	83 d2 00             	adc    $0x0,%edx
+  804c22:	f7 da                	neg    %edx
+  804c24:	83 c4 14             	add    $0x14,%esp
+  804c27:	5b                   	pop    %ebx
+  804c28:	5e                   	pop    %esi
+  804c29:	c3                   	ret
+  804c2a:	83 ec 04             	sub    $0x4,%esp
+  804c2d:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804c31:	56                   	push   %esi
+  804c32:	f7 d9                	neg    %ecx
+  804c34:	83 d3 00             	adc    $0x0,%ebx
+  804c37:	f7 db                	neg    %ebx
+  804c39:	53                   	push   %ebx
+  804c3a:	51                   	push   %ecx
+  804c3b:	e8 60 fe ff ff       	call   804aa0 <udm>
+  804c40:	83 c4 10             	add    $0x10,%esp
+  804c43:	eb d8                	jmp    804c1d <__divdi3+0x4e>
+  804c45:	83 ec 04             	sub    $0x4,%esp
+  804c48:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804c4c:	56                   	push   %esi
+  804c4d:	f7 d9                	neg    %ecx
+  804c4f:	83 d3 00             	adc    $0x0,%ebx
+  804c52:	f7 db                	neg    %ebx
+  804c54:	53                   	push   %ebx
+  804c55:	51                   	push   %ecx
+  804c56:	e8 45 fe ff ff       	call   804aa0 <udm>
+  804c5b:	83 c4 10             	add    $0x10,%esp
+  804c5e:	eb c4                	jmp    804c24 <__divdi3+0x55>
+
+00804c60 <__moddi3>:
+  804c60:	55                   	push   %ebp
+  804c61:	57                   	push   %edi
+  804c62:	56                   	push   %esi
+  804c63:	53                   	push   %ebx
+  804c64:	83 ec 24             	sub    $0x24,%esp
+  804c67:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804c6b:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804c6f:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  804c73:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  804c77:	85 d2                	test   %edx,%edx
+  804c79:	78 3b                	js     804cb6 <__moddi3+0x56>
+  804c7b:	83 ec 04             	sub    $0x4,%esp
+  804c7e:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804c82:	56                   	push   %esi
+  804c83:	89 ce                	mov    %ecx,%esi
+  804c85:	f7 de                	neg    %esi
+  804c87:	89 74 24 08          	mov    %esi,0x8(%esp)
+  804c8b:	89 de                	mov    %ebx,%esi
+  804c8d:	83 d6 00             	adc    $0x0,%esi
+  804c90:	f7 de                	neg    %esi
+  804c92:	89 74 24 14          	mov    %esi,0x14(%esp)
+  804c96:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804c9a:	0f 48 f1             	cmovs  %ecx,%esi
+  804c9d:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  804ca2:	53                   	push   %ebx
+  804ca3:	56                   	push   %esi
+  804ca4:	e8 f7 fd ff ff       	call   804aa0 <udm>
+  804ca9:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804cad:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804cb1:	83 c4 10             	add    $0x10,%esp
+  804cb4:	eb 47                	jmp    804cfd <__moddi3+0x9d>
+  804cb6:	f7 d8                	neg    %eax
+  804cb8:	83 d2 00             	adc    $0x0,%edx
+  804cbb:	f7 da                	neg    %edx
+  804cbd:	83 ec 04             	sub    $0x4,%esp
+  804cc0:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804cc4:	56                   	push   %esi
+  804cc5:	89 cf                	mov    %ecx,%edi
+  804cc7:	f7 df                	neg    %edi
+  804cc9:	89 de                	mov    %ebx,%esi
+  804ccb:	83 d6 00             	adc    $0x0,%esi
+  804cce:	f7 de                	neg    %esi
+  804cd0:	0f 49 cf             	cmovns %edi,%ecx
+  804cd3:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  804cd7:	0f 49 de             	cmovns %esi,%ebx
+  804cda:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  804cde:	ff 74 24 0c          	push   0xc(%esp)
+  804ce2:	ff 74 24 0c          	push   0xc(%esp)
+  804ce6:	e8 b5 fd ff ff       	call   804aa0 <udm>
+  804ceb:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804cef:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804cf3:	f7 d8                	neg    %eax
+  804cf5:	83 d2 00             	adc    $0x0,%edx
+  804cf8:	f7 da                	neg    %edx
+  804cfa:	83 c4 10             	add    $0x10,%esp
+  804cfd:	83 c4 24             	add    $0x24,%esp
+  804d00:	5b                   	pop    %ebx
+  804d01:	5e                   	pop    %esi
+  804d02:	5f                   	pop    %edi
+  804d03:	5d                   	pop    %ebp
+  804d04:	c3                   	ret
@@ -0,0 +1,9909 @@
+
+obj/user/testfutex.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 60 02 00 00       	call   800291 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+	int ready;
+};
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 20             	sub    $0x20,%esp
+	struct shared *sh = VA;
+	uint32_t word = 0;
+  80003c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	unsigned start;
+	int i, j, r;
+
+	// a mismatched value must not sleep
+	if ((r = sys_futex_wait(&word, 1, 0)) != -E_AGAIN)
+  800043:	6a 00                	push   $0x0
+  800045:	6a 01                	push   $0x1
+  800047:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80004a:	50                   	push   %eax
+  80004b:	e8 f6 10 00 00       	call   801146 <sys_futex_wait>
+  800050:	83 c4 10             	add    $0x10,%esp
+  800053:	83 f8 ed             	cmp    $0xffffffed,%eax
+  800056:	0f 85 9f 00 00 00    	jne    8000fb <umain+0xc8>
+		panic("futex_wait with stale value returned %e", r);
+
+	// a matching value sleeps until the timeout
+	start = sys_time_msec();
+  80005c:	e8 5d 10 00 00       	call   8010be <sys_time_msec>
+  800061:	89 c3                	mov    %eax,%ebx
+	if ((r = sys_futex_wait(&word, 0, 50)) != -E_TIMEOUT)
+  800063:	83 ec 04             	sub    $0x4,%esp
+  800066:	6a 32                	push   $0x32
+  800068:	6a 00                	push   $0x0
+  80006a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80006d:	50                   	push   %eax
+  80006e:	e8 d3 10 00 00       	call   801146 <sys_futex_wait>
+  800073:	83 c4 10             	add    $0x10,%esp
+  800076:	83 f8 ec             	cmp    $0xffffffec,%eax
+  800079:	0f 85 8e 00 00 00    	jne    80010d <umain+0xda>
+		panic("futex_wait timeout returned %e", r);
+	if (sys_time_msec() - start < 50)
+  80007f:	e8 3a 10 00 00       	call   8010be <sys_time_msec>
+  800084:	29 d8                	sub    %ebx,%eax
+  800086:	83 f8 31             	cmp    $0x31,%eax
+  800089:	0f 86 90 00 00 00    	jbe    80011f <umain+0xec>
+		panic("futex_wait woke up too early");
+	cprintf("futex timeout is good\n");
+  80008f:	83 ec 0c             	sub    $0xc,%esp
+  800092:	68 b5 49 80 00       	push   $0x8049b5
+  800097:	e8 73 03 00 00       	call   80040f <cprintf>
+
+	if ((r = sys_page_alloc(0, VA, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80009c:	83 c4 0c             	add    $0xc,%esp
+  80009f:	68 07 04 00 00       	push   $0x407
+  8000a4:	68 00 00 00 a0       	push   $0xa0000000
+  8000a9:	6a 00                	push   $0x0
+  8000ab:	e8 81 0d 00 00       	call   800e31 <sys_page_alloc>
+  8000b0:	83 c4 10             	add    $0x10,%esp
+  8000b3:	85 c0                	test   %eax,%eax
+  8000b5:	78 7c                	js     800133 <umain+0x100>
+		panic("sys_page_alloc: %e", r);
+	sem_init(&sh->done, 0);
+  8000b7:	83 ec 08             	sub    $0x8,%esp
+  8000ba:	6a 00                	push   $0x0
+  8000bc:	68 08 00 00 a0       	push   $0xa0000008
+  8000c1:	e8 9a 3b 00 00       	call   803c60 <sem_init>
+
+	for (i = 0; i < NCHILD; i++) {
+  8000c6:	83 c4 10             	add    $0x10,%esp
+  8000c9:	bf 05 00 00 00       	mov    $0x5,%edi
+  8000ce:	83 ef 01             	sub    $0x1,%edi
+  8000d1:	0f 84 1a 01 00 00    	je     8001f1 <umain+0x1be>
+		if ((r = fork()) < 0)
+  8000d7:	e8 11 14 00 00       	call   8014ed <fork>
+  8000dc:	89 c3                	mov    %eax,%ebx
+  8000de:	85 c0                	test   %eax,%eax
+  8000e0:	78 63                	js     800145 <umain+0x112>
+			panic("fork: %e", r);
+		if (r == 0) {
+  8000e2:	75 ea                	jne    8000ce <umain+0x9b>
+			// wait for the parent's go signal
+			mutex_lock(&sh->mu);
+  8000e4:	83 ec 0c             	sub    $0xc,%esp
+  8000e7:	68 00 00 00 a0       	push   $0xa0000000
+  8000ec:	e8 16 3a 00 00       	call   803b07 <mutex_lock>
+			while (!sh->ready)
+  8000f1:	83 c4 10             	add    $0x10,%esp
+  8000f4:	be 00 00 00 a0       	mov    $0xa0000000,%esi
+  8000f9:	eb 71                	jmp    80016c <umain+0x139>
+		panic("futex_wait with stale value returned %e", r);
+  8000fb:	50                   	push   %eax
+  8000fc:	68 20 49 80 00       	push   $0x804920
+  800101:	6a 19                	push   $0x19
+  800103:	68 87 49 80 00       	push   $0x804987
+  800108:	e8 27 02 00 00       	call   800334 <_panic>
+		panic("futex_wait timeout returned %e", r);
+  80010d:	50                   	push   %eax
+  80010e:	68 48 49 80 00       	push   $0x804948
+  800113:	6a 1e                	push   $0x1e
+  800115:	68 87 49 80 00       	push   $0x804987
+  80011a:	e8 15 02 00 00       	call   800334 <_panic>
+		panic("futex_wait woke up too early");
+  80011f:	83 ec 04             	sub    $0x4,%esp
+  800122:	68 98 49 80 00       	push   $0x804998
+  800127:	6a 20                	push   $0x20
+  800129:	68 87 49 80 00       	push   $0x804987
+  80012e:	e8 01 02 00 00       	call   800334 <_panic>
+		panic("sys_page_alloc: %e", r);
+  800133:	50                   	push   %eax
+  800134:	68 cc 49 80 00       	push   $0x8049cc
+  800139:	6a 24                	push   $0x24
+  80013b:	68 87 49 80 00       	push   $0x804987
+  800140:	e8 ef 01 00 00       	call   800334 <_panic>
+			panic("fork: %e", r);
+  800145:	50                   	push   %eax
+  800146:	68 df 49 80 00       	push   $0x8049df
+  80014b:	6a 29                	push   $0x29
+  80014d:	68 87 49 80 00       	push   $0x804987
+  800152:	e8 dd 01 00 00       	call   800334 <_panic>
+				cond_wait(&sh->cv, &sh->mu);
+  800157:	83 ec 08             	sub    $0x8,%esp
+  80015a:	68 00 00 00 a0       	push   $0xa0000000
+  80015f:	68 04 00 00 a0       	push   $0xa0000004
+  800164:	e8 9e 3a 00 00       	call   803c07 <cond_wait>
+  800169:	83 c4 10             	add    $0x10,%esp
+			while (!sh->ready)
+  80016c:	83 7e 14 00          	cmpl   $0x0,0x14(%esi)
+  800170:	74 e5                	je     800157 <umain+0x124>
+			mutex_unlock(&sh->mu);
+  800172:	83 ec 0c             	sub    $0xc,%esp
+  800175:	68 00 00 00 a0       	push   $0xa0000000
+  80017a:	e8 f5 39 00 00       	call   803b74 <mutex_unlock>
+  80017f:	83 c4 10             	add    $0x10,%esp
+
+			for (j = 0; j < NITER; j++) {
+				mutex_lock(&sh->mu);
+				sh->counter++;
+				if (j % 100 == 0)
+  800182:	be 1f 85 eb 51       	mov    $0x51eb851f,%esi
+  800187:	eb 1b                	jmp    8001a4 <umain+0x171>
+					sys_yield();
+				mutex_unlock(&sh->mu);
+  800189:	83 ec 0c             	sub    $0xc,%esp
+  80018c:	68 00 00 00 a0       	push   $0xa0000000
+  800191:	e8 de 39 00 00       	call   803b74 <mutex_unlock>
+			for (j = 0; j < NITER; j++) {
+  800196:	83 c3 01             	add    $0x1,%ebx
+  800199:	83 c4 10             	add    $0x10,%esp
+  80019c:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+  8001a2:	74 33                	je     8001d7 <umain+0x1a4>
+				mutex_lock(&sh->mu);
+  8001a4:	83 ec 0c             	sub    $0xc,%esp
+  8001a7:	68 00 00 00 a0       	push   $0xa0000000
+  8001ac:	e8 56 39 00 00       	call   803b07 <mutex_lock>
+				sh->counter++;
+  8001b1:	83 05 10 00 00 a0 01 	addl   $0x1,0xa0000010
+				if (j % 100 == 0)
+  8001b8:	89 d8                	mov    %ebx,%eax
+  8001ba:	f7 ee                	imul   %esi
+  8001bc:	c1 fa 05             	sar    $0x5,%edx
+  8001bf:	89 d8                	mov    %ebx,%eax
+  8001c1:	c1 f8 1f             	sar    $0x1f,%eax
+  8001c4:	29 c2                	sub    %eax,%edx
+  8001c6:	6b d2 64             	imul   $0x64,%edx,%edx
+  8001c9:	83 c4 10             	add    $0x10,%esp
+  8001cc:	39 d3                	cmp    %edx,%ebx
+  8001ce:	75 b9                	jne    800189 <umain+0x156>
+					sys_yield();
+  8001d0:	e8 30 0c 00 00       	call   800e05 <sys_yield>
+  8001d5:	eb b2                	jmp    800189 <umain+0x156>
+			}
+			sem_post(&sh->done);
+  8001d7:	83 ec 0c             	sub    $0xc,%esp
+  8001da:	68 08 00 00 a0       	push   $0xa0000008
+  8001df:	e8 4e 3b 00 00       	call   803d32 <sem_post>
+			exit();
+  8001e4:	e8 23 01 00 00       	call   80030c <exit>
+  8001e9:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NCHILD; i++) {
+  8001ec:	e9 dd fe ff ff       	jmp    8000ce <umain+0x9b>
+		}
+	}
+
+	mutex_lock(&sh->mu);
+  8001f1:	83 ec 0c             	sub    $0xc,%esp
+  8001f4:	68 00 00 00 a0       	push   $0xa0000000
+  8001f9:	e8 09 39 00 00       	call   803b07 <mutex_lock>
+	sh->ready = 1;
+  8001fe:	c7 05 14 00 00 a0 01 	movl   $0x1,0xa0000014
+  800205:	00 00 00 
+	cond_broadcast(&sh->cv);
+  800208:	c7 04 24 04 00 00 a0 	movl   $0xa0000004,(%esp)
+  80020f:	e8 2a 3a 00 00       	call   803c3e <cond_broadcast>
+	mutex_unlock(&sh->mu);
+  800214:	c7 04 24 00 00 00 a0 	movl   $0xa0000000,(%esp)
+  80021b:	e8 54 39 00 00       	call   803b74 <mutex_unlock>
+
+	for (i = 0; i < NCHILD; i++)
+		sem_wait(&sh->done);
+  800220:	c7 04 24 08 00 00 a0 	movl   $0xa0000008,(%esp)
+  800227:	e8 f1 3a 00 00       	call   803d1d <sem_wait>
+  80022c:	c7 04 24 08 00 00 a0 	movl   $0xa0000008,(%esp)
+  800233:	e8 e5 3a 00 00       	call   803d1d <sem_wait>
+  800238:	c7 04 24 08 00 00 a0 	movl   $0xa0000008,(%esp)
+  80023f:	e8 d9 3a 00 00       	call   803d1d <sem_wait>
+  800244:	c7 04 24 08 00 00 a0 	movl   $0xa0000008,(%esp)
+  80024b:	e8 cd 3a 00 00       	call   803d1d <sem_wait>
+
+	if (sh->counter != NCHILD * NITER)
+  800250:	a1 10 00 00 a0       	mov    0xa0000010,%eax
+  800255:	83 c4 10             	add    $0x10,%esp
+  800258:	3d a0 0f 00 00       	cmp    $0xfa0,%eax
+  80025d:	75 18                	jne    800277 <umain+0x244>
+		panic("counter is %d, want %d", sh->counter, NCHILD * NITER);
+	cprintf("futex mutex/cond/sem are good\n");
+  80025f:	83 ec 0c             	sub    $0xc,%esp
+  800262:	68 68 49 80 00       	push   $0x804968
+  800267:	e8 a3 01 00 00       	call   80040f <cprintf>
+}
+  80026c:	83 c4 10             	add    $0x10,%esp
+  80026f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800272:	5b                   	pop    %ebx
+  800273:	5e                   	pop    %esi
+  800274:	5f                   	pop    %edi
+  800275:	5d                   	pop    %ebp
+  800276:	c3                   	ret
+		panic("counter is %d, want %d", sh->counter, NCHILD * NITER);
+  800277:	83 ec 0c             	sub    $0xc,%esp
+  80027a:	68 a0 0f 00 00       	push   $0xfa0
+  80027f:	50                   	push   %eax
+  800280:	68 e8 49 80 00       	push   $0x8049e8
+  800285:	6a 46                	push   $0x46
+  800287:	68 87 49 80 00       	push   $0x804987
+  80028c:	e8 a3 00 00 00       	call   800334 <_panic>
+
+00800291 <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800291:	55                   	push   %ebp
+  800292:	89 e5                	mov    %esp,%ebp
+  800294:	57                   	push   %edi
+  800295:	56                   	push   %esi
+  800296:	53                   	push   %ebx
+  800297:	83 ec 1c             	sub    $0x1c,%esp
+  80029a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80029d:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  8002a0:	e8 34 0b 00 00       	call   800dd9 <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  8002a5:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  8002a8:	89 15 c0 72 80 00    	mov    %edx,0x8072c0
+	thisenv = &envs[ENVX(eid)];
+  8002ae:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8002b3:	89 c1                	mov    %eax,%ecx
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  8002b5:	89 e7                	mov    %esp,%edi
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8002b7:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  8002bd:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8002c2:	77 16                	ja     8002da <libmain+0x49>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8002c4:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8002c9:	29 f8                	sub    %edi,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  8002cb:	c1 e8 10             	shr    $0x10,%eax
+  8002ce:	74 0a                	je     8002da <libmain+0x49>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8002d0:	c1 e0 10             	shl    $0x10,%eax
+  8002d3:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8002d8:	29 c2                	sub    %eax,%edx
+  8002da:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  8002dd:	c1 e0 04             	shl    $0x4,%eax
+  8002e0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8002e5:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8002e7:	85 db                	test   %ebx,%ebx
+  8002e9:	7e 07                	jle    8002f2 <libmain+0x61>
+		binaryname = argv[0];
+  8002eb:	8b 06                	mov    (%esi),%eax
+  8002ed:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// call user main routine
+	umain(argc, argv);
+  8002f2:	83 ec 08             	sub    $0x8,%esp
+  8002f5:	56                   	push   %esi
+  8002f6:	53                   	push   %ebx
+  8002f7:	e8 37 fd ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8002fc:	e8 0b 00 00 00       	call   80030c <exit>
+}
+  800301:	83 c4 10             	add    $0x10,%esp
+  800304:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800307:	5b                   	pop    %ebx
+  800308:	5e                   	pop    %esi
+  800309:	5f                   	pop    %edi
+  80030a:	5d                   	pop    %ebp
+  80030b:	c3                   	ret
+
+0080030c <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80030c:	55                   	push   %ebp
+  80030d:	89 e5                	mov    %esp,%ebp
+  80030f:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  800312:	6a 00                	push   $0x0
+  800314:	e8 8b 27 00 00       	call   802aa4 <fflush>
+	pthread_kill_others();
+  800319:	e8 f6 3d 00 00       	call   804114 <pthread_kill_others>
+	close_all();
+  80031e:	e8 24 18 00 00       	call   801b47 <close_all>
+	sys_env_destroy(0);
+  800323:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80032a:	e8 5f 0a 00 00       	call   800d8e <sys_env_destroy>
+}
+  80032f:	83 c4 10             	add    $0x10,%esp
+  800332:	c9                   	leave
+  800333:	c3                   	ret
+
+00800334 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800334:	55                   	push   %ebp
+  800335:	89 e5                	mov    %esp,%ebp
+  800337:	56                   	push   %esi
+  800338:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800339:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80033c:	8b 35 00 60 80 00    	mov    0x806000,%esi
+  800342:	e8 92 0a 00 00       	call   800dd9 <sys_getenvid>
+  800347:	83 ec 0c             	sub    $0xc,%esp
+  80034a:	ff 75 0c             	push   0xc(%ebp)
+  80034d:	ff 75 08             	push   0x8(%ebp)
+  800350:	56                   	push   %esi
+  800351:	50                   	push   %eax
+  800352:	68 0c 4a 80 00       	push   $0x804a0c
+  800357:	e8 b3 00 00 00       	call   80040f <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80035c:	83 c4 18             	add    $0x18,%esp
+  80035f:	53                   	push   %ebx
+  800360:	ff 75 10             	push   0x10(%ebp)
+  800363:	e8 56 00 00 00       	call   8003be <vcprintf>
+	cprintf("\n");
+  800368:	c7 04 24 1a 4f 80 00 	movl   $0x804f1a,(%esp)
+  80036f:	e8 9b 00 00 00       	call   80040f <cprintf>
+  800374:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800377:	cc                   	int3
+	while (1)
+  800378:	eb fd                	jmp    800377 <_panic+0x43>
+
+0080037a <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80037a:	55                   	push   %ebp
+  80037b:	89 e5                	mov    %esp,%ebp
+  80037d:	53                   	push   %ebx
+  80037e:	83 ec 04             	sub    $0x4,%esp
+  800381:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800384:	8b 13                	mov    (%ebx),%edx
+  800386:	8d 42 01             	lea    0x1(%edx),%eax
+  800389:	89 03                	mov    %eax,(%ebx)
+  80038b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80038e:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800392:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800397:	74 09                	je     8003a2 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800399:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80039d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8003a0:	c9                   	leave
+  8003a1:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8003a2:	83 ec 08             	sub    $0x8,%esp
+  8003a5:	68 ff 00 00 00       	push   $0xff
+  8003aa:	8d 43 08             	lea    0x8(%ebx),%eax
+  8003ad:	50                   	push   %eax
+  8003ae:	e8 84 09 00 00       	call   800d37 <sys_cputs>
+		b->idx = 0;
+  8003b3:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8003b9:	83 c4 10             	add    $0x10,%esp
+  8003bc:	eb db                	jmp    800399 <putch+0x1f>
+
+008003be <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8003be:	55                   	push   %ebp
+  8003bf:	89 e5                	mov    %esp,%ebp
+  8003c1:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8003c7:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8003ce:	00 00 00 
+	b.cnt = 0;
+  8003d1:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8003d8:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8003db:	ff 75 0c             	push   0xc(%ebp)
+  8003de:	ff 75 08             	push   0x8(%ebp)
+  8003e1:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8003e7:	50                   	push   %eax
+  8003e8:	68 7a 03 80 00       	push   $0x80037a
+  8003ed:	e8 14 01 00 00       	call   800506 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8003f2:	83 c4 08             	add    $0x8,%esp
+  8003f5:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8003fb:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800401:	50                   	push   %eax
+  800402:	e8 30 09 00 00       	call   800d37 <sys_cputs>
+
+	return b.cnt;
+}
+  800407:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80040d:	c9                   	leave
+  80040e:	c3                   	ret
+
+0080040f <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80040f:	55                   	push   %ebp
+  800410:	89 e5                	mov    %esp,%ebp
+  800412:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800415:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800418:	50                   	push   %eax
+  800419:	ff 75 08             	push   0x8(%ebp)
+  80041c:	e8 9d ff ff ff       	call   8003be <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800421:	c9                   	leave
+  800422:	c3                   	ret
+
+00800423 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800423:	55                   	push   %ebp
+  800424:	89 e5                	mov    %esp,%ebp
+  800426:	57                   	push   %edi
+  800427:	56                   	push   %esi
+  800428:	53                   	push   %ebx
+  800429:	83 ec 1c             	sub    $0x1c,%esp
+  80042c:	89 c7                	mov    %eax,%edi
+  80042e:	89 d6                	mov    %edx,%esi
+  800430:	8b 45 08             	mov    0x8(%ebp),%eax
+  800433:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800436:	89 d1                	mov    %edx,%ecx
+  800438:	89 c2                	mov    %eax,%edx
+  80043a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80043d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800440:	8b 45 10             	mov    0x10(%ebp),%eax
+  800443:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800446:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800449:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800450:	39 c2                	cmp    %eax,%edx
+  800452:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800455:	72 3e                	jb     800495 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800457:	83 ec 0c             	sub    $0xc,%esp
+  80045a:	ff 75 18             	push   0x18(%ebp)
+  80045d:	83 eb 01             	sub    $0x1,%ebx
+  800460:	53                   	push   %ebx
+  800461:	50                   	push   %eax
+  800462:	83 ec 08             	sub    $0x8,%esp
+  800465:	ff 75 e4             	push   -0x1c(%ebp)
+  800468:	ff 75 e0             	push   -0x20(%ebp)
+  80046b:	ff 75 dc             	push   -0x24(%ebp)
+  80046e:	ff 75 d8             	push   -0x28(%ebp)
+  800471:	e8 21 43 00 00       	call   804797 <__udivdi3>
+  800476:	83 c4 18             	add    $0x18,%esp
+  800479:	52                   	push   %edx
+  80047a:	50                   	push   %eax
+  80047b:	89 f2                	mov    %esi,%edx
+  80047d:	89 f8                	mov    %edi,%eax
+  80047f:	e8 9f ff ff ff       	call   800423 <printnum>
+  800484:	83 c4 20             	add    $0x20,%esp
+  800487:	eb 13                	jmp    80049c <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800489:	83 ec 08             	sub    $0x8,%esp
+  80048c:	56                   	push   %esi
+  80048d:	ff 75 18             	push   0x18(%ebp)
+  800490:	ff d7                	call   *%edi
+  800492:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800495:	83 eb 01             	sub    $0x1,%ebx
+  800498:	85 db                	test   %ebx,%ebx
+  80049a:	7f ed                	jg     800489 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80049c:	83 ec 08             	sub    $0x8,%esp
+  80049f:	56                   	push   %esi
+  8004a0:	83 ec 04             	sub    $0x4,%esp
+  8004a3:	ff 75 e4             	push   -0x1c(%ebp)
+  8004a6:	ff 75 e0             	push   -0x20(%ebp)
+  8004a9:	ff 75 dc             	push   -0x24(%ebp)
+  8004ac:	ff 75 d8             	push   -0x28(%ebp)
+  8004af:	e8 04 43 00 00       	call   8047b8 <__umoddi3>
+  8004b4:	83 c4 14             	add    $0x14,%esp
+  8004b7:	0f be 80 2f 4a 80 00 	movsbl 0x804a2f(%eax),%eax
+  8004be:	50                   	push   %eax
+  8004bf:	ff d7                	call   *%edi
+}
+  8004c1:	83 c4 10             	add    $0x10,%esp
+  8004c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004c7:	5b                   	pop    %ebx
+  8004c8:	5e                   	pop    %esi
+  8004c9:	5f                   	pop    %edi
+  8004ca:	5d                   	pop    %ebp
+  8004cb:	c3                   	ret
+
+008004cc <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8004cc:	55                   	push   %ebp
+  8004cd:	89 e5                	mov    %esp,%ebp
+  8004cf:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8004d2:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8004d6:	8b 10                	mov    (%eax),%edx
+  8004d8:	3b 50 04             	cmp    0x4(%eax),%edx
+  8004db:	73 0a                	jae    8004e7 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8004dd:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8004e0:	89 08                	mov    %ecx,(%eax)
+  8004e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004e5:	88 02                	mov    %al,(%edx)
+}
+  8004e7:	5d                   	pop    %ebp
+  8004e8:	c3                   	ret
+
+008004e9 <printfmt>:
+{
+  8004e9:	55                   	push   %ebp
+  8004ea:	89 e5                	mov    %esp,%ebp
+  8004ec:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8004ef:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8004f2:	50                   	push   %eax
+  8004f3:	ff 75 10             	push   0x10(%ebp)
+  8004f6:	ff 75 0c             	push   0xc(%ebp)
+  8004f9:	ff 75 08             	push   0x8(%ebp)
+  8004fc:	e8 05 00 00 00       	call   800506 <vprintfmt>
+}
+  800501:	83 c4 10             	add    $0x10,%esp
+  800504:	c9                   	leave
+  800505:	c3                   	ret
+
+00800506 <vprintfmt>:
+{
+  800506:	55                   	push   %ebp
+  800507:	89 e5                	mov    %esp,%ebp
+  800509:	57                   	push   %edi
+  80050a:	56                   	push   %esi
+  80050b:	53                   	push   %ebx
+  80050c:	83 ec 2c             	sub    $0x2c,%esp
+  80050f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800512:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800515:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800518:	eb 0a                	jmp    800524 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80051a:	83 ec 08             	sub    $0x8,%esp
+  80051d:	53                   	push   %ebx
+  80051e:	50                   	push   %eax
+  80051f:	ff d6                	call   *%esi
+  800521:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  800524:	83 c7 01             	add    $0x1,%edi
+  800527:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  80052b:	83 f8 25             	cmp    $0x25,%eax
+  80052e:	74 0c                	je     80053c <vprintfmt+0x36>
+			if (ch == '\0')
+  800530:	85 c0                	test   %eax,%eax
+  800532:	75 e6                	jne    80051a <vprintfmt+0x14>
+}
+  800534:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800537:	5b                   	pop    %ebx
+  800538:	5e                   	pop    %esi
+  800539:	5f                   	pop    %edi
+  80053a:	5d                   	pop    %ebp
+  80053b:	c3                   	ret
+		padc = ' ';
+  80053c:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800540:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800547:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80054e:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800555:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  80055a:	8d 47 01             	lea    0x1(%edi),%eax
+  80055d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800560:	0f b6 17             	movzbl (%edi),%edx
+  800563:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800566:	3c 55                	cmp    $0x55,%al
+  800568:	0f 87 c5 03 00 00    	ja     800933 <vprintfmt+0x42d>
+  80056e:	0f b6 c0             	movzbl %al,%eax
+  800571:	ff 24 85 c0 4b 80 00 	jmp    *0x804bc0(,%eax,4)
+  800578:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  80057b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80057e:	eb da                	jmp    80055a <vprintfmt+0x54>
+  800580:	0f be d2             	movsbl %dl,%edx
+  800583:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800586:	b8 00 00 00 00       	mov    $0x0,%eax
+  80058b:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80058e:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800591:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800595:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800598:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80059b:	83 f9 09             	cmp    $0x9,%ecx
+  80059e:	77 55                	ja     8005f5 <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  8005a0:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8005a3:	eb e9                	jmp    80058e <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  8005a5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a8:	8b 00                	mov    (%eax),%eax
+  8005aa:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8005ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b0:	8d 40 04             	lea    0x4(%eax),%eax
+  8005b3:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  8005b6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8005b9:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005bd:	79 9b                	jns    80055a <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8005bf:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8005c2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005c5:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8005cc:	eb 8c                	jmp    80055a <vprintfmt+0x54>
+			if (width < 0)
+  8005ce:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005d1:	85 d2                	test   %edx,%edx
+  8005d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005d8:	0f 49 c2             	cmovns %edx,%eax
+  8005db:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  8005de:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8005e1:	e9 74 ff ff ff       	jmp    80055a <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  8005e6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8005e9:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8005f0:	e9 65 ff ff ff       	jmp    80055a <vprintfmt+0x54>
+  8005f5:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8005f8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8005fb:	eb bc                	jmp    8005b9 <vprintfmt+0xb3>
+			lflag++;
+  8005fd:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  800600:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800603:	e9 52 ff ff ff       	jmp    80055a <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800608:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060b:	8d 78 04             	lea    0x4(%eax),%edi
+  80060e:	83 ec 08             	sub    $0x8,%esp
+  800611:	53                   	push   %ebx
+  800612:	ff 30                	push   (%eax)
+  800614:	ff d6                	call   *%esi
+			break;
+  800616:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800619:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80061c:	e9 b1 02 00 00       	jmp    8008d2 <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  800621:	8b 45 14             	mov    0x14(%ebp),%eax
+  800624:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800627:	8b 10                	mov    (%eax),%edx
+  800629:	89 d0                	mov    %edx,%eax
+  80062b:	f7 d8                	neg    %eax
+  80062d:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800630:	83 f8 14             	cmp    $0x14,%eax
+  800633:	7f 23                	jg     800658 <vprintfmt+0x152>
+  800635:	8b 14 85 20 4d 80 00 	mov    0x804d20(,%eax,4),%edx
+  80063c:	85 d2                	test   %edx,%edx
+  80063e:	74 18                	je     800658 <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  800640:	52                   	push   %edx
+  800641:	68 63 4f 80 00       	push   $0x804f63
+  800646:	53                   	push   %ebx
+  800647:	56                   	push   %esi
+  800648:	e8 9c fe ff ff       	call   8004e9 <printfmt>
+  80064d:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800650:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800653:	e9 7a 02 00 00       	jmp    8008d2 <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  800658:	50                   	push   %eax
+  800659:	68 47 4a 80 00       	push   $0x804a47
+  80065e:	53                   	push   %ebx
+  80065f:	56                   	push   %esi
+  800660:	e8 84 fe ff ff       	call   8004e9 <printfmt>
+  800665:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800668:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80066b:	e9 62 02 00 00       	jmp    8008d2 <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800670:	8b 45 14             	mov    0x14(%ebp),%eax
+  800673:	83 c0 04             	add    $0x4,%eax
+  800676:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800679:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067c:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80067e:	85 c9                	test   %ecx,%ecx
+  800680:	b8 40 4a 80 00       	mov    $0x804a40,%eax
+  800685:	0f 45 c1             	cmovne %ecx,%eax
+  800688:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80068b:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80068f:	7e 06                	jle    800697 <vprintfmt+0x191>
+  800691:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800695:	75 0b                	jne    8006a2 <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800697:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80069a:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80069d:	89 75 08             	mov    %esi,0x8(%ebp)
+  8006a0:	eb 5c                	jmp    8006fe <vprintfmt+0x1f8>
+  8006a2:	83 ec 08             	sub    $0x8,%esp
+  8006a5:	ff 75 d0             	push   -0x30(%ebp)
+  8006a8:	ff 75 cc             	push   -0x34(%ebp)
+  8006ab:	e8 20 03 00 00       	call   8009d0 <strnlen>
+  8006b0:	89 c2                	mov    %eax,%edx
+  8006b2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006b5:	29 d0                	sub    %edx,%eax
+  8006b7:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8006ba:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8006be:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006c1:	89 75 08             	mov    %esi,0x8(%ebp)
+  8006c4:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8006c6:	eb 0e                	jmp    8006d6 <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  8006c8:	83 ec 08             	sub    $0x8,%esp
+  8006cb:	53                   	push   %ebx
+  8006cc:	57                   	push   %edi
+  8006cd:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8006d0:	83 ee 01             	sub    $0x1,%esi
+  8006d3:	83 c4 10             	add    $0x10,%esp
+  8006d6:	85 f6                	test   %esi,%esi
+  8006d8:	7f ee                	jg     8006c8 <vprintfmt+0x1c2>
+  8006da:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006dd:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006e0:	85 c0                	test   %eax,%eax
+  8006e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006e7:	0f 49 d0             	cmovns %eax,%edx
+  8006ea:	29 d0                	sub    %edx,%eax
+  8006ec:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006ef:	eb a6                	jmp    800697 <vprintfmt+0x191>
+					putch(ch, putdat);
+  8006f1:	83 ec 08             	sub    $0x8,%esp
+  8006f4:	53                   	push   %ebx
+  8006f5:	52                   	push   %edx
+  8006f6:	ff 55 08             	call   *0x8(%ebp)
+  8006f9:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8006fc:	89 f1                	mov    %esi,%ecx
+  8006fe:	8d 71 01             	lea    0x1(%ecx),%esi
+  800701:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800705:	0f be d0             	movsbl %al,%edx
+  800708:	85 d2                	test   %edx,%edx
+  80070a:	74 28                	je     800734 <vprintfmt+0x22e>
+  80070c:	85 ff                	test   %edi,%edi
+  80070e:	78 05                	js     800715 <vprintfmt+0x20f>
+  800710:	83 ef 01             	sub    $0x1,%edi
+  800713:	78 30                	js     800745 <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800715:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800719:	74 d6                	je     8006f1 <vprintfmt+0x1eb>
+  80071b:	0f be c0             	movsbl %al,%eax
+  80071e:	83 e8 20             	sub    $0x20,%eax
+  800721:	83 f8 5e             	cmp    $0x5e,%eax
+  800724:	76 cb                	jbe    8006f1 <vprintfmt+0x1eb>
+					putch('?', putdat);
+  800726:	83 ec 08             	sub    $0x8,%esp
+  800729:	53                   	push   %ebx
+  80072a:	6a 3f                	push   $0x3f
+  80072c:	ff 55 08             	call   *0x8(%ebp)
+  80072f:	83 c4 10             	add    $0x10,%esp
+  800732:	eb c8                	jmp    8006fc <vprintfmt+0x1f6>
+  800734:	8b 75 08             	mov    0x8(%ebp),%esi
+  800737:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80073a:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80073d:	01 d0                	add    %edx,%eax
+  80073f:	29 c8                	sub    %ecx,%eax
+  800741:	89 c7                	mov    %eax,%edi
+  800743:	eb 13                	jmp    800758 <vprintfmt+0x252>
+  800745:	8b 75 08             	mov    0x8(%ebp),%esi
+  800748:	eb ed                	jmp    800737 <vprintfmt+0x231>
+				putch(' ', putdat);
+  80074a:	83 ec 08             	sub    $0x8,%esp
+  80074d:	53                   	push   %ebx
+  80074e:	6a 20                	push   $0x20
+  800750:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800752:	83 ef 01             	sub    $0x1,%edi
+  800755:	83 c4 10             	add    $0x10,%esp
+  800758:	85 ff                	test   %edi,%edi
+  80075a:	7f ee                	jg     80074a <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80075c:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80075f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800762:	e9 6b 01 00 00       	jmp    8008d2 <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  800767:	83 f9 01             	cmp    $0x1,%ecx
+  80076a:	7f 1f                	jg     80078b <vprintfmt+0x285>
+	else if (lflag)
+  80076c:	85 c9                	test   %ecx,%ecx
+  80076e:	74 67                	je     8007d7 <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  800770:	8b 45 14             	mov    0x14(%ebp),%eax
+  800773:	8b 00                	mov    (%eax),%eax
+  800775:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800778:	89 c1                	mov    %eax,%ecx
+  80077a:	c1 f9 1f             	sar    $0x1f,%ecx
+  80077d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800780:	8b 45 14             	mov    0x14(%ebp),%eax
+  800783:	8d 40 04             	lea    0x4(%eax),%eax
+  800786:	89 45 14             	mov    %eax,0x14(%ebp)
+  800789:	eb 17                	jmp    8007a2 <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  80078b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80078e:	8b 50 04             	mov    0x4(%eax),%edx
+  800791:	8b 00                	mov    (%eax),%eax
+  800793:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800796:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800799:	8b 45 14             	mov    0x14(%ebp),%eax
+  80079c:	8d 40 08             	lea    0x8(%eax),%eax
+  80079f:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8007a2:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007a5:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8007a8:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8007ad:	85 c9                	test   %ecx,%ecx
+  8007af:	0f 89 03 01 00 00    	jns    8008b8 <vprintfmt+0x3b2>
+				putch('-', putdat);
+  8007b5:	83 ec 08             	sub    $0x8,%esp
+  8007b8:	53                   	push   %ebx
+  8007b9:	6a 2d                	push   $0x2d
+  8007bb:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8007bd:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007c0:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8007c3:	f7 da                	neg    %edx
+  8007c5:	83 d1 00             	adc    $0x0,%ecx
+  8007c8:	f7 d9                	neg    %ecx
+  8007ca:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8007cd:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8007d2:	e9 e1 00 00 00       	jmp    8008b8 <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  8007d7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007da:	8b 00                	mov    (%eax),%eax
+  8007dc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007df:	89 c1                	mov    %eax,%ecx
+  8007e1:	c1 f9 1f             	sar    $0x1f,%ecx
+  8007e4:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8007e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ea:	8d 40 04             	lea    0x4(%eax),%eax
+  8007ed:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007f0:	eb b0                	jmp    8007a2 <vprintfmt+0x29c>
+	if (lflag >= 2)
+  8007f2:	83 f9 01             	cmp    $0x1,%ecx
+  8007f5:	7f 1e                	jg     800815 <vprintfmt+0x30f>
+	else if (lflag)
+  8007f7:	85 c9                	test   %ecx,%ecx
+  8007f9:	74 32                	je     80082d <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  8007fb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007fe:	8b 10                	mov    (%eax),%edx
+  800800:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800805:	8d 40 04             	lea    0x4(%eax),%eax
+  800808:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80080b:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800810:	e9 a3 00 00 00       	jmp    8008b8 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800815:	8b 45 14             	mov    0x14(%ebp),%eax
+  800818:	8b 10                	mov    (%eax),%edx
+  80081a:	8b 48 04             	mov    0x4(%eax),%ecx
+  80081d:	8d 40 08             	lea    0x8(%eax),%eax
+  800820:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800823:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800828:	e9 8b 00 00 00       	jmp    8008b8 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  80082d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800830:	8b 10                	mov    (%eax),%edx
+  800832:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800837:	8d 40 04             	lea    0x4(%eax),%eax
+  80083a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80083d:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800842:	eb 74                	jmp    8008b8 <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  800844:	83 f9 01             	cmp    $0x1,%ecx
+  800847:	7f 1b                	jg     800864 <vprintfmt+0x35e>
+	else if (lflag)
+  800849:	85 c9                	test   %ecx,%ecx
+  80084b:	74 2c                	je     800879 <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  80084d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800850:	8b 10                	mov    (%eax),%edx
+  800852:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800857:	8d 40 04             	lea    0x4(%eax),%eax
+  80085a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80085d:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800862:	eb 54                	jmp    8008b8 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800864:	8b 45 14             	mov    0x14(%ebp),%eax
+  800867:	8b 10                	mov    (%eax),%edx
+  800869:	8b 48 04             	mov    0x4(%eax),%ecx
+  80086c:	8d 40 08             	lea    0x8(%eax),%eax
+  80086f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800872:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800877:	eb 3f                	jmp    8008b8 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800879:	8b 45 14             	mov    0x14(%ebp),%eax
+  80087c:	8b 10                	mov    (%eax),%edx
+  80087e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800883:	8d 40 04             	lea    0x4(%eax),%eax
+  800886:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800889:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  80088e:	eb 28                	jmp    8008b8 <vprintfmt+0x3b2>
+			putch('0', putdat);
+  800890:	83 ec 08             	sub    $0x8,%esp
+  800893:	53                   	push   %ebx
+  800894:	6a 30                	push   $0x30
+  800896:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800898:	83 c4 08             	add    $0x8,%esp
+  80089b:	53                   	push   %ebx
+  80089c:	6a 78                	push   $0x78
+  80089e:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8008a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008a3:	8b 10                	mov    (%eax),%edx
+  8008a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8008aa:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8008ad:	8d 40 04             	lea    0x4(%eax),%eax
+  8008b0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008b3:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8008b8:	83 ec 0c             	sub    $0xc,%esp
+  8008bb:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8008bf:	50                   	push   %eax
+  8008c0:	ff 75 e0             	push   -0x20(%ebp)
+  8008c3:	57                   	push   %edi
+  8008c4:	51                   	push   %ecx
+  8008c5:	52                   	push   %edx
+  8008c6:	89 da                	mov    %ebx,%edx
+  8008c8:	89 f0                	mov    %esi,%eax
+  8008ca:	e8 54 fb ff ff       	call   800423 <printnum>
+			break;
+  8008cf:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8008d2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  8008d5:	e9 4a fc ff ff       	jmp    800524 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8008da:	83 f9 01             	cmp    $0x1,%ecx
+  8008dd:	7f 1b                	jg     8008fa <vprintfmt+0x3f4>
+	else if (lflag)
+  8008df:	85 c9                	test   %ecx,%ecx
+  8008e1:	74 2c                	je     80090f <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  8008e3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008e6:	8b 10                	mov    (%eax),%edx
+  8008e8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008ed:	8d 40 04             	lea    0x4(%eax),%eax
+  8008f0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008f3:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8008f8:	eb be                	jmp    8008b8 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8008fa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008fd:	8b 10                	mov    (%eax),%edx
+  8008ff:	8b 48 04             	mov    0x4(%eax),%ecx
+  800902:	8d 40 08             	lea    0x8(%eax),%eax
+  800905:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800908:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80090d:	eb a9                	jmp    8008b8 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  80090f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800912:	8b 10                	mov    (%eax),%edx
+  800914:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800919:	8d 40 04             	lea    0x4(%eax),%eax
+  80091c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80091f:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800924:	eb 92                	jmp    8008b8 <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  800926:	83 ec 08             	sub    $0x8,%esp
+  800929:	53                   	push   %ebx
+  80092a:	6a 25                	push   $0x25
+  80092c:	ff d6                	call   *%esi
+			break;
+  80092e:	83 c4 10             	add    $0x10,%esp
+  800931:	eb 9f                	jmp    8008d2 <vprintfmt+0x3cc>
+			putch('%', putdat);
+  800933:	83 ec 08             	sub    $0x8,%esp
+  800936:	53                   	push   %ebx
+  800937:	6a 25                	push   $0x25
+  800939:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80093b:	83 c4 10             	add    $0x10,%esp
+  80093e:	89 f8                	mov    %edi,%eax
+  800940:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800944:	74 05                	je     80094b <vprintfmt+0x445>
+  800946:	83 e8 01             	sub    $0x1,%eax
+  800949:	eb f5                	jmp    800940 <vprintfmt+0x43a>
+  80094b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80094e:	eb 82                	jmp    8008d2 <vprintfmt+0x3cc>
+
+00800950 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800950:	55                   	push   %ebp
+  800951:	89 e5                	mov    %esp,%ebp
+  800953:	83 ec 18             	sub    $0x18,%esp
+  800956:	8b 45 08             	mov    0x8(%ebp),%eax
+  800959:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80095c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80095f:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800963:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800966:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80096d:	85 c0                	test   %eax,%eax
+  80096f:	74 26                	je     800997 <vsnprintf+0x47>
+  800971:	85 d2                	test   %edx,%edx
+  800973:	7e 22                	jle    800997 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800975:	ff 75 14             	push   0x14(%ebp)
+  800978:	ff 75 10             	push   0x10(%ebp)
+  80097b:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80097e:	50                   	push   %eax
+  80097f:	68 cc 04 80 00       	push   $0x8004cc
+  800984:	e8 7d fb ff ff       	call   800506 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800989:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80098c:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80098f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800992:	83 c4 10             	add    $0x10,%esp
+}
+  800995:	c9                   	leave
+  800996:	c3                   	ret
+		return -E_INVAL;
+  800997:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80099c:	eb f7                	jmp    800995 <vsnprintf+0x45>
+
+0080099e <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80099e:	55                   	push   %ebp
+  80099f:	89 e5                	mov    %esp,%ebp
+  8009a1:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8009a4:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8009a7:	50                   	push   %eax
+  8009a8:	ff 75 10             	push   0x10(%ebp)
+  8009ab:	ff 75 0c             	push   0xc(%ebp)
+  8009ae:	ff 75 08             	push   0x8(%ebp)
+  8009b1:	e8 9a ff ff ff       	call   800950 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8009b6:	c9                   	leave
+  8009b7:	c3                   	ret
+
+008009b8 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8009b8:	55                   	push   %ebp
+  8009b9:	89 e5                	mov    %esp,%ebp
+  8009bb:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8009be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009c3:	eb 03                	jmp    8009c8 <strlen+0x10>
+		n++;
+  8009c5:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8009c8:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8009cc:	75 f7                	jne    8009c5 <strlen+0xd>
+	return n;
+}
+  8009ce:	5d                   	pop    %ebp
+  8009cf:	c3                   	ret
+
+008009d0 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8009d0:	55                   	push   %ebp
+  8009d1:	89 e5                	mov    %esp,%ebp
+  8009d3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009d6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009de:	eb 03                	jmp    8009e3 <strnlen+0x13>
+		n++;
+  8009e0:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009e3:	39 d0                	cmp    %edx,%eax
+  8009e5:	74 08                	je     8009ef <strnlen+0x1f>
+  8009e7:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8009eb:	75 f3                	jne    8009e0 <strnlen+0x10>
+  8009ed:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8009ef:	89 d0                	mov    %edx,%eax
+  8009f1:	5d                   	pop    %ebp
+  8009f2:	c3                   	ret
+
+008009f3 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8009f3:	55                   	push   %ebp
+  8009f4:	89 e5                	mov    %esp,%ebp
+  8009f6:	53                   	push   %ebx
+  8009f7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009fa:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8009fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a02:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a06:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a09:	83 c0 01             	add    $0x1,%eax
+  800a0c:	84 d2                	test   %dl,%dl
+  800a0e:	75 f2                	jne    800a02 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800a10:	89 c8                	mov    %ecx,%eax
+  800a12:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a15:	c9                   	leave
+  800a16:	c3                   	ret
+
+00800a17 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800a17:	55                   	push   %ebp
+  800a18:	89 e5                	mov    %esp,%ebp
+  800a1a:	53                   	push   %ebx
+  800a1b:	83 ec 10             	sub    $0x10,%esp
+  800a1e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800a21:	53                   	push   %ebx
+  800a22:	e8 91 ff ff ff       	call   8009b8 <strlen>
+  800a27:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800a2a:	ff 75 0c             	push   0xc(%ebp)
+  800a2d:	01 d8                	add    %ebx,%eax
+  800a2f:	50                   	push   %eax
+  800a30:	e8 be ff ff ff       	call   8009f3 <strcpy>
+	return dst;
+}
+  800a35:	89 d8                	mov    %ebx,%eax
+  800a37:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a3a:	c9                   	leave
+  800a3b:	c3                   	ret
+
+00800a3c <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800a3c:	55                   	push   %ebp
+  800a3d:	89 e5                	mov    %esp,%ebp
+  800a3f:	56                   	push   %esi
+  800a40:	53                   	push   %ebx
+  800a41:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a44:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800a47:	89 f3                	mov    %esi,%ebx
+  800a49:	03 5d 10             	add    0x10(%ebp),%ebx
+  800a4c:	89 f0                	mov    %esi,%eax
+  800a4e:	eb 0f                	jmp    800a5f <strncpy+0x23>
+		*dst++ = *src;
+  800a50:	83 c0 01             	add    $0x1,%eax
+  800a53:	0f b6 0a             	movzbl (%edx),%ecx
+  800a56:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800a59:	80 f9 01             	cmp    $0x1,%cl
+  800a5c:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800a5f:	39 d8                	cmp    %ebx,%eax
+  800a61:	75 ed                	jne    800a50 <strncpy+0x14>
+	}
+	return ret;
+}
+  800a63:	89 f0                	mov    %esi,%eax
+  800a65:	5b                   	pop    %ebx
+  800a66:	5e                   	pop    %esi
+  800a67:	5d                   	pop    %ebp
+  800a68:	c3                   	ret
+
+00800a69 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800a69:	55                   	push   %ebp
+  800a6a:	89 e5                	mov    %esp,%ebp
+  800a6c:	56                   	push   %esi
+  800a6d:	53                   	push   %ebx
+  800a6e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a71:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a74:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800a77:	89 f0                	mov    %esi,%eax
+  800a79:	85 d2                	test   %edx,%edx
+  800a7b:	74 21                	je     800a9e <strlcpy+0x35>
+  800a7d:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800a81:	89 f2                	mov    %esi,%edx
+  800a83:	eb 09                	jmp    800a8e <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800a85:	83 c1 01             	add    $0x1,%ecx
+  800a88:	83 c2 01             	add    $0x1,%edx
+  800a8b:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800a8e:	39 c2                	cmp    %eax,%edx
+  800a90:	74 09                	je     800a9b <strlcpy+0x32>
+  800a92:	0f b6 19             	movzbl (%ecx),%ebx
+  800a95:	84 db                	test   %bl,%bl
+  800a97:	75 ec                	jne    800a85 <strlcpy+0x1c>
+  800a99:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800a9b:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800a9e:	29 f0                	sub    %esi,%eax
+}
+  800aa0:	5b                   	pop    %ebx
+  800aa1:	5e                   	pop    %esi
+  800aa2:	5d                   	pop    %ebp
+  800aa3:	c3                   	ret
+
+00800aa4 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800aa4:	55                   	push   %ebp
+  800aa5:	89 e5                	mov    %esp,%ebp
+  800aa7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800aaa:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800aad:	eb 06                	jmp    800ab5 <strcmp+0x11>
+		p++, q++;
+  800aaf:	83 c1 01             	add    $0x1,%ecx
+  800ab2:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800ab5:	0f b6 01             	movzbl (%ecx),%eax
+  800ab8:	84 c0                	test   %al,%al
+  800aba:	74 04                	je     800ac0 <strcmp+0x1c>
+  800abc:	3a 02                	cmp    (%edx),%al
+  800abe:	74 ef                	je     800aaf <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800ac0:	0f b6 c0             	movzbl %al,%eax
+  800ac3:	0f b6 12             	movzbl (%edx),%edx
+  800ac6:	29 d0                	sub    %edx,%eax
+}
+  800ac8:	5d                   	pop    %ebp
+  800ac9:	c3                   	ret
+
+00800aca <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800aca:	55                   	push   %ebp
+  800acb:	89 e5                	mov    %esp,%ebp
+  800acd:	53                   	push   %ebx
+  800ace:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ad1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ad4:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800ad7:	eb 09                	jmp    800ae2 <strncmp+0x18>
+		n--, p++, q++;
+  800ad9:	83 ea 01             	sub    $0x1,%edx
+  800adc:	83 c0 01             	add    $0x1,%eax
+  800adf:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800ae2:	85 d2                	test   %edx,%edx
+  800ae4:	74 18                	je     800afe <strncmp+0x34>
+  800ae6:	0f b6 18             	movzbl (%eax),%ebx
+  800ae9:	84 db                	test   %bl,%bl
+  800aeb:	74 04                	je     800af1 <strncmp+0x27>
+  800aed:	3a 19                	cmp    (%ecx),%bl
+  800aef:	74 e8                	je     800ad9 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800af1:	0f b6 00             	movzbl (%eax),%eax
+  800af4:	0f b6 11             	movzbl (%ecx),%edx
+  800af7:	29 d0                	sub    %edx,%eax
+}
+  800af9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800afc:	c9                   	leave
+  800afd:	c3                   	ret
+		return 0;
+  800afe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b03:	eb f4                	jmp    800af9 <strncmp+0x2f>
+
+00800b05 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800b05:	55                   	push   %ebp
+  800b06:	89 e5                	mov    %esp,%ebp
+  800b08:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b0b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b0f:	eb 03                	jmp    800b14 <strchr+0xf>
+  800b11:	83 c0 01             	add    $0x1,%eax
+  800b14:	0f b6 10             	movzbl (%eax),%edx
+  800b17:	84 d2                	test   %dl,%dl
+  800b19:	74 06                	je     800b21 <strchr+0x1c>
+		if (*s == c)
+  800b1b:	38 ca                	cmp    %cl,%dl
+  800b1d:	75 f2                	jne    800b11 <strchr+0xc>
+  800b1f:	eb 05                	jmp    800b26 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800b21:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b26:	5d                   	pop    %ebp
+  800b27:	c3                   	ret
+
+00800b28 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800b28:	55                   	push   %ebp
+  800b29:	89 e5                	mov    %esp,%ebp
+  800b2b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b2e:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b32:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800b35:	38 ca                	cmp    %cl,%dl
+  800b37:	74 09                	je     800b42 <strfind+0x1a>
+  800b39:	84 d2                	test   %dl,%dl
+  800b3b:	74 05                	je     800b42 <strfind+0x1a>
+	for (; *s; s++)
+  800b3d:	83 c0 01             	add    $0x1,%eax
+  800b40:	eb f0                	jmp    800b32 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800b42:	5d                   	pop    %ebp
+  800b43:	c3                   	ret
+
+00800b44 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800b44:	55                   	push   %ebp
+  800b45:	89 e5                	mov    %esp,%ebp
+  800b47:	57                   	push   %edi
+  800b48:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b4b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800b4e:	85 c9                	test   %ecx,%ecx
+  800b50:	74 20                	je     800b72 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800b52:	89 f8                	mov    %edi,%eax
+  800b54:	09 c8                	or     %ecx,%eax
+  800b56:	a8 03                	test   $0x3,%al
+  800b58:	75 12                	jne    800b6c <memset+0x28>
+		c &= 0xFF;
+  800b5a:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800b5e:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800b64:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800b67:	fc                   	cld
+  800b68:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b6a:	eb 06                	jmp    800b72 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800b6c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b6f:	fc                   	cld
+  800b70:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800b72:	89 f8                	mov    %edi,%eax
+  800b74:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800b77:	c9                   	leave
+  800b78:	c3                   	ret
+
+00800b79 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800b79:	55                   	push   %ebp
+  800b7a:	89 e5                	mov    %esp,%ebp
+  800b7c:	57                   	push   %edi
+  800b7d:	56                   	push   %esi
+  800b7e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b81:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b84:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800b87:	39 c6                	cmp    %eax,%esi
+  800b89:	73 32                	jae    800bbd <memmove+0x44>
+  800b8b:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800b8e:	39 d0                	cmp    %edx,%eax
+  800b90:	73 2b                	jae    800bbd <memmove+0x44>
+		s += n;
+		d += n;
+  800b92:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b95:	89 d6                	mov    %edx,%esi
+  800b97:	09 fe                	or     %edi,%esi
+  800b99:	09 ce                	or     %ecx,%esi
+  800b9b:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800ba1:	75 0e                	jne    800bb1 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800ba3:	83 ef 04             	sub    $0x4,%edi
+  800ba6:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800ba9:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800bac:	fd                   	std
+  800bad:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800baf:	eb 09                	jmp    800bba <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800bb1:	83 ef 01             	sub    $0x1,%edi
+  800bb4:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800bb7:	fd                   	std
+  800bb8:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800bba:	fc                   	cld
+  800bbb:	eb 1a                	jmp    800bd7 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800bbd:	89 f2                	mov    %esi,%edx
+  800bbf:	09 c2                	or     %eax,%edx
+  800bc1:	09 ca                	or     %ecx,%edx
+  800bc3:	f6 c2 03             	test   $0x3,%dl
+  800bc6:	75 0a                	jne    800bd2 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800bc8:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800bcb:	89 c7                	mov    %eax,%edi
+  800bcd:	fc                   	cld
+  800bce:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bd0:	eb 05                	jmp    800bd7 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800bd2:	89 c7                	mov    %eax,%edi
+  800bd4:	fc                   	cld
+  800bd5:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800bd7:	5e                   	pop    %esi
+  800bd8:	5f                   	pop    %edi
+  800bd9:	5d                   	pop    %ebp
+  800bda:	c3                   	ret
+
+00800bdb <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800bdb:	55                   	push   %ebp
+  800bdc:	89 e5                	mov    %esp,%ebp
+  800bde:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800be1:	ff 75 10             	push   0x10(%ebp)
+  800be4:	ff 75 0c             	push   0xc(%ebp)
+  800be7:	ff 75 08             	push   0x8(%ebp)
+  800bea:	e8 8a ff ff ff       	call   800b79 <memmove>
+}
+  800bef:	c9                   	leave
+  800bf0:	c3                   	ret
+
+00800bf1 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800bf1:	55                   	push   %ebp
+  800bf2:	89 e5                	mov    %esp,%ebp
+  800bf4:	56                   	push   %esi
+  800bf5:	53                   	push   %ebx
+  800bf6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bf9:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800bfc:	89 c6                	mov    %eax,%esi
+  800bfe:	03 75 10             	add    0x10(%ebp),%esi
+  800c01:	eb 06                	jmp    800c09 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800c03:	83 c0 01             	add    $0x1,%eax
+  800c06:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800c09:	39 f0                	cmp    %esi,%eax
+  800c0b:	74 14                	je     800c21 <memcmp+0x30>
+		if (*s1 != *s2)
+  800c0d:	0f b6 08             	movzbl (%eax),%ecx
+  800c10:	0f b6 1a             	movzbl (%edx),%ebx
+  800c13:	38 d9                	cmp    %bl,%cl
+  800c15:	74 ec                	je     800c03 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800c17:	0f b6 c1             	movzbl %cl,%eax
+  800c1a:	0f b6 db             	movzbl %bl,%ebx
+  800c1d:	29 d8                	sub    %ebx,%eax
+  800c1f:	eb 05                	jmp    800c26 <memcmp+0x35>
+	}
+
+	return 0;
+  800c21:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c26:	5b                   	pop    %ebx
+  800c27:	5e                   	pop    %esi
+  800c28:	5d                   	pop    %ebp
+  800c29:	c3                   	ret
+
+00800c2a <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800c2a:	55                   	push   %ebp
+  800c2b:	89 e5                	mov    %esp,%ebp
+  800c2d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c30:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800c33:	89 c2                	mov    %eax,%edx
+  800c35:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800c38:	eb 03                	jmp    800c3d <memfind+0x13>
+  800c3a:	83 c0 01             	add    $0x1,%eax
+  800c3d:	39 d0                	cmp    %edx,%eax
+  800c3f:	73 04                	jae    800c45 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800c41:	38 08                	cmp    %cl,(%eax)
+  800c43:	75 f5                	jne    800c3a <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800c45:	5d                   	pop    %ebp
+  800c46:	c3                   	ret
+
+00800c47 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800c47:	55                   	push   %ebp
+  800c48:	89 e5                	mov    %esp,%ebp
+  800c4a:	57                   	push   %edi
+  800c4b:	56                   	push   %esi
+  800c4c:	53                   	push   %ebx
+  800c4d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c50:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800c53:	eb 03                	jmp    800c58 <strtol+0x11>
+		s++;
+  800c55:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800c58:	0f b6 02             	movzbl (%edx),%eax
+  800c5b:	3c 20                	cmp    $0x20,%al
+  800c5d:	74 f6                	je     800c55 <strtol+0xe>
+  800c5f:	3c 09                	cmp    $0x9,%al
+  800c61:	74 f2                	je     800c55 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800c63:	3c 2b                	cmp    $0x2b,%al
+  800c65:	74 2a                	je     800c91 <strtol+0x4a>
+	int neg = 0;
+  800c67:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800c6c:	3c 2d                	cmp    $0x2d,%al
+  800c6e:	74 2b                	je     800c9b <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c70:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800c76:	75 0f                	jne    800c87 <strtol+0x40>
+  800c78:	80 3a 30             	cmpb   $0x30,(%edx)
+  800c7b:	74 28                	je     800ca5 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800c7d:	85 db                	test   %ebx,%ebx
+  800c7f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c84:	0f 44 d8             	cmove  %eax,%ebx
+  800c87:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c8c:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800c8f:	eb 46                	jmp    800cd7 <strtol+0x90>
+		s++;
+  800c91:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800c94:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c99:	eb d5                	jmp    800c70 <strtol+0x29>
+		s++, neg = 1;
+  800c9b:	83 c2 01             	add    $0x1,%edx
+  800c9e:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ca3:	eb cb                	jmp    800c70 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ca5:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800ca9:	74 0e                	je     800cb9 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800cab:	85 db                	test   %ebx,%ebx
+  800cad:	75 d8                	jne    800c87 <strtol+0x40>
+		s++, base = 8;
+  800caf:	83 c2 01             	add    $0x1,%edx
+  800cb2:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800cb7:	eb ce                	jmp    800c87 <strtol+0x40>
+		s += 2, base = 16;
+  800cb9:	83 c2 02             	add    $0x2,%edx
+  800cbc:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800cc1:	eb c4                	jmp    800c87 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800cc3:	0f be c0             	movsbl %al,%eax
+  800cc6:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800cc9:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800ccc:	7d 3a                	jge    800d08 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800cce:	83 c2 01             	add    $0x1,%edx
+  800cd1:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800cd5:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800cd7:	0f b6 02             	movzbl (%edx),%eax
+  800cda:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800cdd:	89 f3                	mov    %esi,%ebx
+  800cdf:	80 fb 09             	cmp    $0x9,%bl
+  800ce2:	76 df                	jbe    800cc3 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800ce4:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800ce7:	89 f3                	mov    %esi,%ebx
+  800ce9:	80 fb 19             	cmp    $0x19,%bl
+  800cec:	77 08                	ja     800cf6 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800cee:	0f be c0             	movsbl %al,%eax
+  800cf1:	83 e8 57             	sub    $0x57,%eax
+  800cf4:	eb d3                	jmp    800cc9 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800cf6:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800cf9:	89 f3                	mov    %esi,%ebx
+  800cfb:	80 fb 19             	cmp    $0x19,%bl
+  800cfe:	77 08                	ja     800d08 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800d00:	0f be c0             	movsbl %al,%eax
+  800d03:	83 e8 37             	sub    $0x37,%eax
+  800d06:	eb c1                	jmp    800cc9 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800d08:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d0c:	74 05                	je     800d13 <strtol+0xcc>
+		*endptr = (char *) s;
+  800d0e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d11:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800d13:	89 c8                	mov    %ecx,%eax
+  800d15:	f7 d8                	neg    %eax
+  800d17:	85 ff                	test   %edi,%edi
+  800d19:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800d1c:	89 c8                	mov    %ecx,%eax
+  800d1e:	5b                   	pop    %ebx
+  800d1f:	5e                   	pop    %esi
+  800d20:	5f                   	pop    %edi
+  800d21:	5d                   	pop    %ebp
+  800d22:	c3                   	ret
+
+00800d23 <atoi>:
+
+int
+atoi(const char* s)
+{
+  800d23:	55                   	push   %ebp
+  800d24:	89 e5                	mov    %esp,%ebp
+  800d26:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  800d29:	6a 00                	push   $0x0
+  800d2b:	6a 00                	push   $0x0
+  800d2d:	ff 75 08             	push   0x8(%ebp)
+  800d30:	e8 12 ff ff ff       	call   800c47 <strtol>
+}
+  800d35:	c9                   	leave
+  800d36:	c3                   	ret
+
+00800d37 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800d37:	55                   	push   %ebp
+  800d38:	89 e5                	mov    %esp,%ebp
+  800d3a:	57                   	push   %edi
+  800d3b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d41:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d44:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d47:	89 c3                	mov    %eax,%ebx
+  800d49:	89 c7                	mov    %eax,%edi
+  800d4b:	6a 00                	push   $0x0
+  800d4d:	55                   	push   %ebp
+  800d4e:	56                   	push   %esi
+  800d4f:	89 e5                	mov    %esp,%ebp
+  800d51:	8d 35 59 0d 80 00    	lea    0x800d59,%esi
+  800d57:	0f 34                	sysenter
+
+00800d59 <after_sysenter_label_47>:
+  800d59:	5e                   	pop    %esi
+  800d5a:	5d                   	pop    %ebp
+  800d5b:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800d5e:	5b                   	pop    %ebx
+  800d5f:	5f                   	pop    %edi
+  800d60:	5d                   	pop    %ebp
+  800d61:	c3                   	ret
+
+00800d62 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800d62:	55                   	push   %ebp
+  800d63:	89 e5                	mov    %esp,%ebp
+  800d65:	57                   	push   %edi
+  800d66:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d67:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d6c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d71:	89 d1                	mov    %edx,%ecx
+  800d73:	89 d3                	mov    %edx,%ebx
+  800d75:	89 d7                	mov    %edx,%edi
+  800d77:	6a 00                	push   $0x0
+  800d79:	55                   	push   %ebp
+  800d7a:	56                   	push   %esi
+  800d7b:	89 e5                	mov    %esp,%ebp
+  800d7d:	8d 35 85 0d 80 00    	lea    0x800d85,%esi
+  800d83:	0f 34                	sysenter
+
+00800d85 <after_sysenter_label_128>:
+  800d85:	5e                   	pop    %esi
+  800d86:	5d                   	pop    %ebp
+  800d87:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800d8a:	5b                   	pop    %ebx
+  800d8b:	5f                   	pop    %edi
+  800d8c:	5d                   	pop    %ebp
+  800d8d:	c3                   	ret
+
+00800d8e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800d8e:	55                   	push   %ebp
+  800d8f:	89 e5                	mov    %esp,%ebp
+  800d91:	57                   	push   %edi
+  800d92:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d93:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d96:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d9b:	b8 03 00 00 00       	mov    $0x3,%eax
+  800da0:	89 cb                	mov    %ecx,%ebx
+  800da2:	89 cf                	mov    %ecx,%edi
+  800da4:	6a 00                	push   $0x0
+  800da6:	55                   	push   %ebp
+  800da7:	56                   	push   %esi
+  800da8:	89 e5                	mov    %esp,%ebp
+  800daa:	8d 35 b2 0d 80 00    	lea    0x800db2,%esi
+  800db0:	0f 34                	sysenter
+
+00800db2 <after_sysenter_label_212>:
+  800db2:	5e                   	pop    %esi
+  800db3:	5d                   	pop    %ebp
+  800db4:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800db7:	85 c0                	test   %eax,%eax
+  800db9:	7f 07                	jg     800dc2 <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800dbb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800dbe:	5b                   	pop    %ebx
+  800dbf:	5f                   	pop    %edi
+  800dc0:	5d                   	pop    %ebp
+  800dc1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dc2:	83 ec 0c             	sub    $0xc,%esp
+  800dc5:	50                   	push   %eax
+  800dc6:	6a 03                	push   $0x3
+  800dc8:	68 b5 4d 80 00       	push   $0x804db5
+  800dcd:	6a 54                	push   $0x54
+  800dcf:	68 d2 4d 80 00       	push   $0x804dd2
+  800dd4:	e8 5b f5 ff ff       	call   800334 <_panic>
+
+00800dd9 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800dd9:	55                   	push   %ebp
+  800dda:	89 e5                	mov    %esp,%ebp
+  800ddc:	57                   	push   %edi
+  800ddd:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800dde:	ba 00 00 00 00       	mov    $0x0,%edx
+  800de3:	b8 02 00 00 00       	mov    $0x2,%eax
+  800de8:	89 d1                	mov    %edx,%ecx
+  800dea:	89 d3                	mov    %edx,%ebx
+  800dec:	89 d7                	mov    %edx,%edi
+  800dee:	6a 00                	push   $0x0
+  800df0:	55                   	push   %ebp
+  800df1:	56                   	push   %esi
+  800df2:	89 e5                	mov    %esp,%ebp
+  800df4:	8d 35 fc 0d 80 00    	lea    0x800dfc,%esi
+  800dfa:	0f 34                	sysenter
+
+00800dfc <after_sysenter_label_309>:
+  800dfc:	5e                   	pop    %esi
+  800dfd:	5d                   	pop    %ebp
+  800dfe:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800e01:	5b                   	pop    %ebx
+  800e02:	5f                   	pop    %edi
+  800e03:	5d                   	pop    %ebp
+  800e04:	c3                   	ret
+
+00800e05 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800e05:	55                   	push   %ebp
+  800e06:	89 e5                	mov    %esp,%ebp
+  800e08:	57                   	push   %edi
+  800e09:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e0a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e0f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e14:	89 d1                	mov    %edx,%ecx
+  800e16:	89 d3                	mov    %edx,%ebx
+  800e18:	89 d7                	mov    %edx,%edi
+  800e1a:	6a 00                	push   $0x0
+  800e1c:	55                   	push   %ebp
+  800e1d:	56                   	push   %esi
+  800e1e:	89 e5                	mov    %esp,%ebp
+  800e20:	8d 35 28 0e 80 00    	lea    0x800e28,%esi
+  800e26:	0f 34                	sysenter
+
+00800e28 <after_sysenter_label_391>:
+  800e28:	5e                   	pop    %esi
+  800e29:	5d                   	pop    %ebp
+  800e2a:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800e2d:	5b                   	pop    %ebx
+  800e2e:	5f                   	pop    %edi
+  800e2f:	5d                   	pop    %ebp
+  800e30:	c3                   	ret
+
+00800e31 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800e31:	55                   	push   %ebp
+  800e32:	89 e5                	mov    %esp,%ebp
+  800e34:	57                   	push   %edi
+  800e35:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e36:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e39:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e3c:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e41:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e46:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e49:	6a 00                	push   $0x0
+  800e4b:	55                   	push   %ebp
+  800e4c:	56                   	push   %esi
+  800e4d:	89 e5                	mov    %esp,%ebp
+  800e4f:	8d 35 57 0e 80 00    	lea    0x800e57,%esi
+  800e55:	0f 34                	sysenter
+
+00800e57 <after_sysenter_label_479>:
+  800e57:	5e                   	pop    %esi
+  800e58:	5d                   	pop    %ebp
+  800e59:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e5c:	85 c0                	test   %eax,%eax
+  800e5e:	7f 07                	jg     800e67 <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800e60:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e63:	5b                   	pop    %ebx
+  800e64:	5f                   	pop    %edi
+  800e65:	5d                   	pop    %ebp
+  800e66:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e67:	83 ec 0c             	sub    $0xc,%esp
+  800e6a:	50                   	push   %eax
+  800e6b:	6a 04                	push   $0x4
+  800e6d:	68 b5 4d 80 00       	push   $0x804db5
+  800e72:	6a 54                	push   $0x54
+  800e74:	68 d2 4d 80 00       	push   $0x804dd2
+  800e79:	e8 b6 f4 ff ff       	call   800334 <_panic>
+
+00800e7e <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e7e:	55                   	push   %ebp
+  800e7f:	89 e5                	mov    %esp,%ebp
+  800e81:	57                   	push   %edi
+  800e82:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e83:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e86:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e89:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e8e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e91:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e94:	ff 75 18             	push   0x18(%ebp)
+  800e97:	55                   	push   %ebp
+  800e98:	56                   	push   %esi
+  800e99:	89 e5                	mov    %esp,%ebp
+  800e9b:	8d 35 a3 0e 80 00    	lea    0x800ea3,%esi
+  800ea1:	0f 34                	sysenter
+
+00800ea3 <after_sysenter_label_593>:
+  800ea3:	5e                   	pop    %esi
+  800ea4:	5d                   	pop    %ebp
+  800ea5:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800ea8:	85 c0                	test   %eax,%eax
+  800eaa:	7f 07                	jg     800eb3 <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800eac:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800eaf:	5b                   	pop    %ebx
+  800eb0:	5f                   	pop    %edi
+  800eb1:	5d                   	pop    %ebp
+  800eb2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eb3:	83 ec 0c             	sub    $0xc,%esp
+  800eb6:	50                   	push   %eax
+  800eb7:	6a 05                	push   $0x5
+  800eb9:	68 b5 4d 80 00       	push   $0x804db5
+  800ebe:	6a 54                	push   $0x54
+  800ec0:	68 d2 4d 80 00       	push   $0x804dd2
+  800ec5:	e8 6a f4 ff ff       	call   800334 <_panic>
+
+00800eca <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800eca:	55                   	push   %ebp
+  800ecb:	89 e5                	mov    %esp,%ebp
+  800ecd:	57                   	push   %edi
+  800ece:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ecf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ed4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eda:	b8 06 00 00 00       	mov    $0x6,%eax
+  800edf:	89 df                	mov    %ebx,%edi
+  800ee1:	6a 00                	push   $0x0
+  800ee3:	55                   	push   %ebp
+  800ee4:	56                   	push   %esi
+  800ee5:	89 e5                	mov    %esp,%ebp
+  800ee7:	8d 35 ef 0e 80 00    	lea    0x800eef,%esi
+  800eed:	0f 34                	sysenter
+
+00800eef <after_sysenter_label_704>:
+  800eef:	5e                   	pop    %esi
+  800ef0:	5d                   	pop    %ebp
+  800ef1:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800ef4:	85 c0                	test   %eax,%eax
+  800ef6:	7f 07                	jg     800eff <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800ef8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800efb:	5b                   	pop    %ebx
+  800efc:	5f                   	pop    %edi
+  800efd:	5d                   	pop    %ebp
+  800efe:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eff:	83 ec 0c             	sub    $0xc,%esp
+  800f02:	50                   	push   %eax
+  800f03:	6a 06                	push   $0x6
+  800f05:	68 b5 4d 80 00       	push   $0x804db5
+  800f0a:	6a 54                	push   $0x54
+  800f0c:	68 d2 4d 80 00       	push   $0x804dd2
+  800f11:	e8 1e f4 ff ff       	call   800334 <_panic>
+
+00800f16 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f16:	55                   	push   %ebp
+  800f17:	89 e5                	mov    %esp,%ebp
+  800f19:	57                   	push   %edi
+  800f1a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f1b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f20:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f23:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f26:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f2b:	89 df                	mov    %ebx,%edi
+  800f2d:	6a 00                	push   $0x0
+  800f2f:	55                   	push   %ebp
+  800f30:	56                   	push   %esi
+  800f31:	89 e5                	mov    %esp,%ebp
+  800f33:	8d 35 3b 0f 80 00    	lea    0x800f3b,%esi
+  800f39:	0f 34                	sysenter
+
+00800f3b <after_sysenter_label_808>:
+  800f3b:	5e                   	pop    %esi
+  800f3c:	5d                   	pop    %ebp
+  800f3d:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800f40:	85 c0                	test   %eax,%eax
+  800f42:	7f 07                	jg     800f4b <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f44:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f47:	5b                   	pop    %ebx
+  800f48:	5f                   	pop    %edi
+  800f49:	5d                   	pop    %ebp
+  800f4a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f4b:	83 ec 0c             	sub    $0xc,%esp
+  800f4e:	50                   	push   %eax
+  800f4f:	6a 08                	push   $0x8
+  800f51:	68 b5 4d 80 00       	push   $0x804db5
+  800f56:	6a 54                	push   $0x54
+  800f58:	68 d2 4d 80 00       	push   $0x804dd2
+  800f5d:	e8 d2 f3 ff ff       	call   800334 <_panic>
+
+00800f62 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f62:	55                   	push   %ebp
+  800f63:	89 e5                	mov    %esp,%ebp
+  800f65:	57                   	push   %edi
+  800f66:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f67:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f6f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f72:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f77:	89 df                	mov    %ebx,%edi
+  800f79:	6a 00                	push   $0x0
+  800f7b:	55                   	push   %ebp
+  800f7c:	56                   	push   %esi
+  800f7d:	89 e5                	mov    %esp,%ebp
+  800f7f:	8d 35 87 0f 80 00    	lea    0x800f87,%esi
+  800f85:	0f 34                	sysenter
+
+00800f87 <after_sysenter_label_912>:
+  800f87:	5e                   	pop    %esi
+  800f88:	5d                   	pop    %ebp
+  800f89:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800f8c:	85 c0                	test   %eax,%eax
+  800f8e:	7f 07                	jg     800f97 <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800f90:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f93:	5b                   	pop    %ebx
+  800f94:	5f                   	pop    %edi
+  800f95:	5d                   	pop    %ebp
+  800f96:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f97:	83 ec 0c             	sub    $0xc,%esp
+  800f9a:	50                   	push   %eax
+  800f9b:	6a 09                	push   $0x9
+  800f9d:	68 b5 4d 80 00       	push   $0x804db5
+  800fa2:	6a 54                	push   $0x54
+  800fa4:	68 d2 4d 80 00       	push   $0x804dd2
+  800fa9:	e8 86 f3 ff ff       	call   800334 <_panic>
+
+00800fae <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800fae:	55                   	push   %ebp
+  800faf:	89 e5                	mov    %esp,%ebp
+  800fb1:	57                   	push   %edi
+  800fb2:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fb3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fb8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fbb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fbe:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fc3:	89 df                	mov    %ebx,%edi
+  800fc5:	6a 00                	push   $0x0
+  800fc7:	55                   	push   %ebp
+  800fc8:	56                   	push   %esi
+  800fc9:	89 e5                	mov    %esp,%ebp
+  800fcb:	8d 35 d3 0f 80 00    	lea    0x800fd3,%esi
+  800fd1:	0f 34                	sysenter
+
+00800fd3 <after_sysenter_label_1016>:
+  800fd3:	5e                   	pop    %esi
+  800fd4:	5d                   	pop    %ebp
+  800fd5:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800fd8:	85 c0                	test   %eax,%eax
+  800fda:	7f 07                	jg     800fe3 <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800fdc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fdf:	5b                   	pop    %ebx
+  800fe0:	5f                   	pop    %edi
+  800fe1:	5d                   	pop    %ebp
+  800fe2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fe3:	83 ec 0c             	sub    $0xc,%esp
+  800fe6:	50                   	push   %eax
+  800fe7:	6a 0a                	push   $0xa
+  800fe9:	68 b5 4d 80 00       	push   $0x804db5
+  800fee:	6a 54                	push   $0x54
+  800ff0:	68 d2 4d 80 00       	push   $0x804dd2
+  800ff5:	e8 3a f3 ff ff       	call   800334 <_panic>
+
+00800ffa <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800ffa:	55                   	push   %ebp
+  800ffb:	89 e5                	mov    %esp,%ebp
+  800ffd:	57                   	push   %edi
+  800ffe:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fff:	8b 55 08             	mov    0x8(%ebp),%edx
+  801002:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801005:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80100a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80100d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801010:	6a 00                	push   $0x0
+  801012:	55                   	push   %ebp
+  801013:	56                   	push   %esi
+  801014:	89 e5                	mov    %esp,%ebp
+  801016:	8d 35 1e 10 80 00    	lea    0x80101e,%esi
+  80101c:	0f 34                	sysenter
+
+0080101e <after_sysenter_label_1126>:
+  80101e:	5e                   	pop    %esi
+  80101f:	5d                   	pop    %ebp
+  801020:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801023:	5b                   	pop    %ebx
+  801024:	5f                   	pop    %edi
+  801025:	5d                   	pop    %ebp
+  801026:	c3                   	ret
+
+00801027 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801027:	55                   	push   %ebp
+  801028:	89 e5                	mov    %esp,%ebp
+  80102a:	57                   	push   %edi
+  80102b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80102c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801034:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801039:	89 cb                	mov    %ecx,%ebx
+  80103b:	89 cf                	mov    %ecx,%edi
+  80103d:	6a 00                	push   $0x0
+  80103f:	55                   	push   %ebp
+  801040:	56                   	push   %esi
+  801041:	89 e5                	mov    %esp,%ebp
+  801043:	8d 35 4b 10 80 00    	lea    0x80104b,%esi
+  801049:	0f 34                	sysenter
+
+0080104b <after_sysenter_label_1210>:
+  80104b:	5e                   	pop    %esi
+  80104c:	5d                   	pop    %ebp
+  80104d:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801050:	85 c0                	test   %eax,%eax
+  801052:	7f 07                	jg     80105b <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801054:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801057:	5b                   	pop    %ebx
+  801058:	5f                   	pop    %edi
+  801059:	5d                   	pop    %ebp
+  80105a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80105b:	83 ec 0c             	sub    $0xc,%esp
+  80105e:	50                   	push   %eax
+  80105f:	6a 0d                	push   $0xd
+  801061:	68 b5 4d 80 00       	push   $0x804db5
+  801066:	6a 54                	push   $0x54
+  801068:	68 d2 4d 80 00       	push   $0x804dd2
+  80106d:	e8 c2 f2 ff ff       	call   800334 <_panic>
+
+00801072 <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  801072:	55                   	push   %ebp
+  801073:	89 e5                	mov    %esp,%ebp
+  801075:	57                   	push   %edi
+  801076:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801077:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80107c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80107f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801082:	b8 42 00 00 00       	mov    $0x42,%eax
+  801087:	89 df                	mov    %ebx,%edi
+  801089:	6a 00                	push   $0x0
+  80108b:	55                   	push   %ebp
+  80108c:	56                   	push   %esi
+  80108d:	89 e5                	mov    %esp,%ebp
+  80108f:	8d 35 97 10 80 00    	lea    0x801097,%esi
+  801095:	0f 34                	sysenter
+
+00801097 <after_sysenter_label_1311>:
+  801097:	5e                   	pop    %esi
+  801098:	5d                   	pop    %ebp
+  801099:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80109c:	85 c0                	test   %eax,%eax
+  80109e:	7f 07                	jg     8010a7 <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  8010a0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8010a3:	5b                   	pop    %ebx
+  8010a4:	5f                   	pop    %edi
+  8010a5:	5d                   	pop    %ebp
+  8010a6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010a7:	83 ec 0c             	sub    $0xc,%esp
+  8010aa:	50                   	push   %eax
+  8010ab:	6a 42                	push   $0x42
+  8010ad:	68 b5 4d 80 00       	push   $0x804db5
+  8010b2:	6a 54                	push   $0x54
+  8010b4:	68 d2 4d 80 00       	push   $0x804dd2
+  8010b9:	e8 76 f2 ff ff       	call   800334 <_panic>
+
+008010be <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8010be:	55                   	push   %ebp
+  8010bf:	89 e5                	mov    %esp,%ebp
+  8010c1:	57                   	push   %edi
+  8010c2:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010c8:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8010cd:	89 d1                	mov    %edx,%ecx
+  8010cf:	89 d3                	mov    %edx,%ebx
+  8010d1:	89 d7                	mov    %edx,%edi
+  8010d3:	6a 00                	push   $0x0
+  8010d5:	55                   	push   %ebp
+  8010d6:	56                   	push   %esi
+  8010d7:	89 e5                	mov    %esp,%ebp
+  8010d9:	8d 35 e1 10 80 00    	lea    0x8010e1,%esi
+  8010df:	0f 34                	sysenter
+
+008010e1 <after_sysenter_label_1411>:
+  8010e1:	5e                   	pop    %esi
+  8010e2:	5d                   	pop    %ebp
+  8010e3:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8010e6:	5b                   	pop    %ebx
+  8010e7:	5f                   	pop    %edi
+  8010e8:	5d                   	pop    %ebp
+  8010e9:	c3                   	ret
+
+008010ea <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  8010ea:	55                   	push   %ebp
+  8010eb:	89 e5                	mov    %esp,%ebp
+  8010ed:	57                   	push   %edi
+  8010ee:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010fa:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8010ff:	89 df                	mov    %ebx,%edi
+  801101:	6a 00                	push   $0x0
+  801103:	55                   	push   %ebp
+  801104:	56                   	push   %esi
+  801105:	89 e5                	mov    %esp,%ebp
+  801107:	8d 35 0f 11 80 00    	lea    0x80110f,%esi
+  80110d:	0f 34                	sysenter
+
+0080110f <after_sysenter_label_1497>:
+  80110f:	5e                   	pop    %esi
+  801110:	5d                   	pop    %ebp
+  801111:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  801114:	5b                   	pop    %ebx
+  801115:	5f                   	pop    %edi
+  801116:	5d                   	pop    %ebp
+  801117:	c3                   	ret
+
+00801118 <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  801118:	55                   	push   %ebp
+  801119:	89 e5                	mov    %esp,%ebp
+  80111b:	57                   	push   %edi
+  80111c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80111d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801122:	8b 55 08             	mov    0x8(%ebp),%edx
+  801125:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801128:	b8 10 00 00 00       	mov    $0x10,%eax
+  80112d:	89 df                	mov    %ebx,%edi
+  80112f:	6a 00                	push   $0x0
+  801131:	55                   	push   %ebp
+  801132:	56                   	push   %esi
+  801133:	89 e5                	mov    %esp,%ebp
+  801135:	8d 35 3d 11 80 00    	lea    0x80113d,%esi
+  80113b:	0f 34                	sysenter
+
+0080113d <after_sysenter_label_1583>:
+  80113d:	5e                   	pop    %esi
+  80113e:	5d                   	pop    %ebp
+  80113f:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  801142:	5b                   	pop    %ebx
+  801143:	5f                   	pop    %edi
+  801144:	5d                   	pop    %ebp
+  801145:	c3                   	ret
+
+00801146 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  801146:	55                   	push   %ebp
+  801147:	89 e5                	mov    %esp,%ebp
+  801149:	57                   	push   %edi
+  80114a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80114b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80114e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801151:	b8 11 00 00 00       	mov    $0x11,%eax
+  801156:	bf 00 00 00 00       	mov    $0x0,%edi
+  80115b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80115e:	6a 00                	push   $0x0
+  801160:	55                   	push   %ebp
+  801161:	56                   	push   %esi
+  801162:	89 e5                	mov    %esp,%ebp
+  801164:	8d 35 6c 11 80 00    	lea    0x80116c,%esi
+  80116a:	0f 34                	sysenter
+
+0080116c <after_sysenter_label_1672>:
+  80116c:	5e                   	pop    %esi
+  80116d:	5d                   	pop    %ebp
+  80116e:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  801171:	5b                   	pop    %ebx
+  801172:	5f                   	pop    %edi
+  801173:	5d                   	pop    %ebp
+  801174:	c3                   	ret
+
+00801175 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  801175:	55                   	push   %ebp
+  801176:	89 e5                	mov    %esp,%ebp
+  801178:	57                   	push   %edi
+  801179:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80117a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80117f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801182:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801185:	b8 12 00 00 00       	mov    $0x12,%eax
+  80118a:	89 df                	mov    %ebx,%edi
+  80118c:	6a 00                	push   $0x0
+  80118e:	55                   	push   %ebp
+  80118f:	56                   	push   %esi
+  801190:	89 e5                	mov    %esp,%ebp
+  801192:	8d 35 9a 11 80 00    	lea    0x80119a,%esi
+  801198:	0f 34                	sysenter
+
+0080119a <after_sysenter_label_1758>:
+  80119a:	5e                   	pop    %esi
+  80119b:	5d                   	pop    %ebp
+  80119c:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  80119f:	5b                   	pop    %ebx
+  8011a0:	5f                   	pop    %edi
+  8011a1:	5d                   	pop    %ebp
+  8011a2:	c3                   	ret
+
+008011a3 <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  8011a3:	55                   	push   %ebp
+  8011a4:	89 e5                	mov    %esp,%ebp
+  8011a6:	57                   	push   %edi
+  8011a7:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8011a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011b0:	b8 13 00 00 00       	mov    $0x13,%eax
+  8011b5:	89 cb                	mov    %ecx,%ebx
+  8011b7:	89 cf                	mov    %ecx,%edi
+  8011b9:	6a 00                	push   $0x0
+  8011bb:	55                   	push   %ebp
+  8011bc:	56                   	push   %esi
+  8011bd:	89 e5                	mov    %esp,%ebp
+  8011bf:	8d 35 c7 11 80 00    	lea    0x8011c7,%esi
+  8011c5:	0f 34                	sysenter
+
+008011c7 <after_sysenter_label_1842>:
+  8011c7:	5e                   	pop    %esi
+  8011c8:	5d                   	pop    %ebp
+  8011c9:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8011cc:	85 c0                	test   %eax,%eax
+  8011ce:	7f 07                	jg     8011d7 <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  8011d0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8011d3:	5b                   	pop    %ebx
+  8011d4:	5f                   	pop    %edi
+  8011d5:	5d                   	pop    %ebp
+  8011d6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011d7:	83 ec 0c             	sub    $0xc,%esp
+  8011da:	50                   	push   %eax
+  8011db:	6a 13                	push   $0x13
+  8011dd:	68 b5 4d 80 00       	push   $0x804db5
+  8011e2:	6a 54                	push   $0x54
+  8011e4:	68 d2 4d 80 00       	push   $0x804dd2
+  8011e9:	e8 46 f1 ff ff       	call   800334 <_panic>
+
+008011ee <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  8011ee:	55                   	push   %ebp
+  8011ef:	89 e5                	mov    %esp,%ebp
+  8011f1:	57                   	push   %edi
+  8011f2:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8011f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011f8:	b8 14 00 00 00       	mov    $0x14,%eax
+  8011fd:	89 d1                	mov    %edx,%ecx
+  8011ff:	89 d3                	mov    %edx,%ebx
+  801201:	89 d7                	mov    %edx,%edi
+  801203:	6a 00                	push   $0x0
+  801205:	55                   	push   %ebp
+  801206:	56                   	push   %esi
+  801207:	89 e5                	mov    %esp,%ebp
+  801209:	8d 35 11 12 80 00    	lea    0x801211,%esi
+  80120f:	0f 34                	sysenter
+
+00801211 <after_sysenter_label_1939>:
+  801211:	5e                   	pop    %esi
+  801212:	5d                   	pop    %ebp
+  801213:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  801216:	5b                   	pop    %ebx
+  801217:	5f                   	pop    %edi
+  801218:	5d                   	pop    %ebp
+  801219:	c3                   	ret
+
+0080121a <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  80121a:	55                   	push   %ebp
+  80121b:	89 e5                	mov    %esp,%ebp
+  80121d:	57                   	push   %edi
+  80121e:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80121f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801222:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801225:	b8 15 00 00 00       	mov    $0x15,%eax
+  80122a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80122f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801232:	6a 00                	push   $0x0
+  801234:	55                   	push   %ebp
+  801235:	56                   	push   %esi
+  801236:	89 e5                	mov    %esp,%ebp
+  801238:	8d 35 40 12 80 00    	lea    0x801240,%esi
+  80123e:	0f 34                	sysenter
+
+00801240 <after_sysenter_label_2028>:
+  801240:	5e                   	pop    %esi
+  801241:	5d                   	pop    %ebp
+  801242:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  801245:	5b                   	pop    %ebx
+  801246:	5f                   	pop    %edi
+  801247:	5d                   	pop    %ebp
+  801248:	c3                   	ret
+
+00801249 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  801249:	55                   	push   %ebp
+  80124a:	89 e5                	mov    %esp,%ebp
+  80124c:	57                   	push   %edi
+  80124d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80124e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801253:	8b 55 08             	mov    0x8(%ebp),%edx
+  801256:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801259:	b8 16 00 00 00       	mov    $0x16,%eax
+  80125e:	89 df                	mov    %ebx,%edi
+  801260:	6a 00                	push   $0x0
+  801262:	55                   	push   %ebp
+  801263:	56                   	push   %esi
+  801264:	89 e5                	mov    %esp,%ebp
+  801266:	8d 35 6e 12 80 00    	lea    0x80126e,%esi
+  80126c:	0f 34                	sysenter
+
+0080126e <after_sysenter_label_2114>:
+  80126e:	5e                   	pop    %esi
+  80126f:	5d                   	pop    %ebp
+  801270:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  801273:	5b                   	pop    %ebx
+  801274:	5f                   	pop    %edi
+  801275:	5d                   	pop    %ebp
+  801276:	c3                   	ret
+
+00801277 <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  801277:	55                   	push   %ebp
+  801278:	89 e5                	mov    %esp,%ebp
+  80127a:	57                   	push   %edi
+  80127b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80127c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801281:	8b 55 08             	mov    0x8(%ebp),%edx
+  801284:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801287:	b8 17 00 00 00       	mov    $0x17,%eax
+  80128c:	89 df                	mov    %ebx,%edi
+  80128e:	6a 00                	push   $0x0
+  801290:	55                   	push   %ebp
+  801291:	56                   	push   %esi
+  801292:	89 e5                	mov    %esp,%ebp
+  801294:	8d 35 9c 12 80 00    	lea    0x80129c,%esi
+  80129a:	0f 34                	sysenter
+
+0080129c <after_sysenter_label_2200>:
+  80129c:	5e                   	pop    %esi
+  80129d:	5d                   	pop    %ebp
+  80129e:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  8012a1:	5b                   	pop    %ebx
+  8012a2:	5f                   	pop    %edi
+  8012a3:	5d                   	pop    %ebp
+  8012a4:	c3                   	ret
+
+008012a5 <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  8012a5:	55                   	push   %ebp
+  8012a6:	89 e5                	mov    %esp,%ebp
+  8012a8:	57                   	push   %edi
+  8012a9:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8012aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012b5:	b8 18 00 00 00       	mov    $0x18,%eax
+  8012ba:	89 df                	mov    %ebx,%edi
+  8012bc:	6a 00                	push   $0x0
+  8012be:	55                   	push   %ebp
+  8012bf:	56                   	push   %esi
+  8012c0:	89 e5                	mov    %esp,%ebp
+  8012c2:	8d 35 ca 12 80 00    	lea    0x8012ca,%esi
+  8012c8:	0f 34                	sysenter
+
+008012ca <after_sysenter_label_2286>:
+  8012ca:	5e                   	pop    %esi
+  8012cb:	5d                   	pop    %ebp
+  8012cc:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  8012cf:	5b                   	pop    %ebx
+  8012d0:	5f                   	pop    %edi
+  8012d1:	5d                   	pop    %ebp
+  8012d2:	c3                   	ret
+
+008012d3 <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  8012d3:	55                   	push   %ebp
+  8012d4:	89 e5                	mov    %esp,%ebp
+  8012d6:	57                   	push   %edi
+  8012d7:	56                   	push   %esi
+  8012d8:	53                   	push   %ebx
+  8012d9:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  8012dc:	89 d6                	mov    %edx,%esi
+  8012de:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  8012e1:	89 cf                	mov    %ecx,%edi
+  8012e3:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  8012e6:	89 fa                	mov    %edi,%edx
+  8012e8:	80 ce 08             	or     $0x8,%dh
+  8012eb:	f6 c5 08             	test   $0x8,%ch
+  8012ee:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  8012f1:	57                   	push   %edi
+  8012f2:	56                   	push   %esi
+  8012f3:	50                   	push   %eax
+  8012f4:	56                   	push   %esi
+  8012f5:	6a 00                	push   $0x0
+  8012f7:	e8 82 fb ff ff       	call   800e7e <sys_page_map>
+	if (r < 0) {
+  8012fc:	83 c4 20             	add    $0x20,%esp
+  8012ff:	85 c0                	test   %eax,%eax
+  801301:	78 27                	js     80132a <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  801303:	83 ec 0c             	sub    $0xc,%esp
+  801306:	57                   	push   %edi
+  801307:	56                   	push   %esi
+  801308:	6a 00                	push   $0x0
+  80130a:	56                   	push   %esi
+  80130b:	6a 00                	push   $0x0
+  80130d:	e8 6c fb ff ff       	call   800e7e <sys_page_map>
+  801312:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  801314:	83 c4 20             	add    $0x20,%esp
+  801317:	85 c0                	test   %eax,%eax
+  801319:	78 24                	js     80133f <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  80131b:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  801320:	89 d8                	mov    %ebx,%eax
+  801322:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801325:	5b                   	pop    %ebx
+  801326:	5e                   	pop    %esi
+  801327:	5f                   	pop    %edi
+  801328:	5d                   	pop    %ebp
+  801329:	c3                   	ret
+  80132a:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  80132c:	83 ec 08             	sub    $0x8,%esp
+  80132f:	50                   	push   %eax
+  801330:	68 e0 4d 80 00       	push   $0x804de0
+  801335:	e8 d5 f0 ff ff       	call   80040f <cprintf>
+		return r;
+  80133a:	83 c4 10             	add    $0x10,%esp
+  80133d:	eb e1                	jmp    801320 <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  80133f:	83 ec 08             	sub    $0x8,%esp
+  801342:	50                   	push   %eax
+  801343:	68 10 4e 80 00       	push   $0x804e10
+  801348:	e8 c2 f0 ff ff       	call   80040f <cprintf>
+		return r;
+  80134d:	83 c4 10             	add    $0x10,%esp
+  801350:	eb ce                	jmp    801320 <duppage_cow+0x4d>
+
+00801352 <duppage>:
+{
+  801352:	55                   	push   %ebp
+  801353:	89 e5                	mov    %esp,%ebp
+  801355:	53                   	push   %ebx
+  801356:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  801359:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  80135c:	51                   	push   %ecx
+  80135d:	52                   	push   %edx
+  80135e:	50                   	push   %eax
+  80135f:	52                   	push   %edx
+  801360:	6a 00                	push   $0x0
+  801362:	e8 17 fb ff ff       	call   800e7e <sys_page_map>
+	if (r < 0) {
+  801367:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  80136a:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  80136f:	85 c0                	test   %eax,%eax
+  801371:	78 07                	js     80137a <duppage+0x28>
+}
+  801373:	89 d8                	mov    %ebx,%eax
+  801375:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801378:	c9                   	leave
+  801379:	c3                   	ret
+  80137a:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  80137c:	83 ec 08             	sub    $0x8,%esp
+  80137f:	50                   	push   %eax
+  801380:	68 e0 4d 80 00       	push   $0x804de0
+  801385:	e8 85 f0 ff ff       	call   80040f <cprintf>
+		return r;
+  80138a:	83 c4 10             	add    $0x10,%esp
+  80138d:	eb e4                	jmp    801373 <duppage+0x21>
+
+0080138f <cow_copy>:
+{
+  80138f:	55                   	push   %ebp
+  801390:	89 e5                	mov    %esp,%ebp
+  801392:	56                   	push   %esi
+  801393:	53                   	push   %ebx
+  801394:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  801396:	83 ec 04             	sub    $0x4,%esp
+  801399:	6a 07                	push   $0x7
+  80139b:	68 00 f0 7f 00       	push   $0x7ff000
+  8013a0:	6a 00                	push   $0x0
+  8013a2:	e8 8a fa ff ff       	call   800e31 <sys_page_alloc>
+	if (r < 0) {
+  8013a7:	83 c4 10             	add    $0x10,%esp
+  8013aa:	85 c0                	test   %eax,%eax
+  8013ac:	78 58                	js     801406 <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  8013ae:	83 ec 04             	sub    $0x4,%esp
+  8013b1:	68 00 10 00 00       	push   $0x1000
+  8013b6:	56                   	push   %esi
+  8013b7:	68 00 f0 7f 00       	push   $0x7ff000
+  8013bc:	e8 b8 f7 ff ff       	call   800b79 <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  8013c1:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8013c8:	56                   	push   %esi
+  8013c9:	6a 00                	push   $0x0
+  8013cb:	68 00 f0 7f 00       	push   $0x7ff000
+  8013d0:	6a 00                	push   $0x0
+  8013d2:	e8 a7 fa ff ff       	call   800e7e <sys_page_map>
+  8013d7:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  8013d9:	83 c4 20             	add    $0x20,%esp
+  8013dc:	85 c0                	test   %eax,%eax
+  8013de:	78 3b                	js     80141b <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  8013e0:	83 ec 08             	sub    $0x8,%esp
+  8013e3:	68 00 f0 7f 00       	push   $0x7ff000
+  8013e8:	6a 00                	push   $0x0
+  8013ea:	e8 db fa ff ff       	call   800eca <sys_page_unmap>
+  8013ef:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  8013f1:	83 c4 10             	add    $0x10,%esp
+  8013f4:	85 c0                	test   %eax,%eax
+  8013f6:	78 45                	js     80143d <cow_copy+0xae>
+	return 0;
+  8013f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8013fd:	89 d8                	mov    %ebx,%eax
+  8013ff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801402:	5b                   	pop    %ebx
+  801403:	5e                   	pop    %esi
+  801404:	5d                   	pop    %ebp
+  801405:	c3                   	ret
+  801406:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  801408:	83 ec 08             	sub    $0x8,%esp
+  80140b:	50                   	push   %eax
+  80140c:	68 00 4f 80 00       	push   $0x804f00
+  801411:	e8 f9 ef ff ff       	call   80040f <cprintf>
+		return r;
+  801416:	83 c4 10             	add    $0x10,%esp
+  801419:	eb e2                	jmp    8013fd <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  80141b:	83 ec 08             	sub    $0x8,%esp
+  80141e:	50                   	push   %eax
+  80141f:	68 1c 4f 80 00       	push   $0x804f1c
+  801424:	e8 e6 ef ff ff       	call   80040f <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  801429:	83 c4 08             	add    $0x8,%esp
+  80142c:	68 00 f0 7f 00       	push   $0x7ff000
+  801431:	6a 00                	push   $0x0
+  801433:	e8 92 fa ff ff       	call   800eca <sys_page_unmap>
+		return r;
+  801438:	83 c4 10             	add    $0x10,%esp
+  80143b:	eb c0                	jmp    8013fd <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  80143d:	83 ec 08             	sub    $0x8,%esp
+  801440:	50                   	push   %eax
+  801441:	68 38 4e 80 00       	push   $0x804e38
+  801446:	e8 c4 ef ff ff       	call   80040f <cprintf>
+		return r;
+  80144b:	83 c4 10             	add    $0x10,%esp
+  80144e:	eb ad                	jmp    8013fd <cow_copy+0x6e>
+
+00801450 <pgfault>:
+{
+  801450:	55                   	push   %ebp
+  801451:	89 e5                	mov    %esp,%ebp
+  801453:	56                   	push   %esi
+  801454:	53                   	push   %ebx
+  801455:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  801458:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  80145a:	89 d8                	mov    %ebx,%eax
+  80145c:	c1 e8 16             	shr    $0x16,%eax
+  80145f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  801466:	89 de                	mov    %ebx,%esi
+  801468:	c1 ee 0c             	shr    $0xc,%esi
+  80146b:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  801472:	a8 07                	test   $0x7,%al
+  801474:	74 3b                	je     8014b1 <pgfault+0x61>
+  801476:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  80147c:	74 33                	je     8014b1 <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  80147e:	83 ec 0c             	sub    $0xc,%esp
+  801481:	68 00 f0 bf ee       	push   $0xeebff000
+  801486:	e8 7c 26 00 00       	call   803b07 <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  80148b:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  801492:	83 c4 10             	add    $0x10,%esp
+  801495:	f6 c4 08             	test   $0x8,%ah
+  801498:	75 30                	jne    8014ca <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  80149a:	83 ec 0c             	sub    $0xc,%esp
+  80149d:	68 00 f0 bf ee       	push   $0xeebff000
+  8014a2:	e8 cd 26 00 00       	call   803b74 <mutex_unlock>
+}
+  8014a7:	83 c4 10             	add    $0x10,%esp
+  8014aa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014ad:	5b                   	pop    %ebx
+  8014ae:	5e                   	pop    %esi
+  8014af:	5d                   	pop    %ebp
+  8014b0:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  8014b1:	83 ec 08             	sub    $0x8,%esp
+  8014b4:	ff 72 28             	push   0x28(%edx)
+  8014b7:	51                   	push   %ecx
+  8014b8:	50                   	push   %eax
+  8014b9:	68 5c 4e 80 00       	push   $0x804e5c
+  8014be:	6a 3f                	push   $0x3f
+  8014c0:	68 36 4f 80 00       	push   $0x804f36
+  8014c5:	e8 6a ee ff ff       	call   800334 <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  8014ca:	89 d8                	mov    %ebx,%eax
+  8014cc:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  8014d1:	e8 b9 fe ff ff       	call   80138f <cow_copy>
+  8014d6:	eb c2                	jmp    80149a <pgfault+0x4a>
+
+008014d8 <cow_enable>:
+{
+  8014d8:	55                   	push   %ebp
+  8014d9:	89 e5                	mov    %esp,%ebp
+  8014db:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  8014de:	68 50 14 80 00       	push   $0x801450
+  8014e3:	e8 9f 2f 00 00       	call   804487 <set_pgfault_handler>
+}
+  8014e8:	83 c4 10             	add    $0x10,%esp
+  8014eb:	c9                   	leave
+  8014ec:	c3                   	ret
+
+008014ed <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  8014ed:	55                   	push   %ebp
+  8014ee:	89 e5                	mov    %esp,%ebp
+  8014f0:	57                   	push   %edi
+  8014f1:	56                   	push   %esi
+  8014f2:	53                   	push   %ebx
+  8014f3:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  8014f6:	68 50 14 80 00       	push   $0x801450
+  8014fb:	e8 87 2f 00 00       	call   804487 <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  801500:	b8 07 00 00 00       	mov    $0x7,%eax
+  801505:	cd 30                	int    $0x30
+  801507:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  80150a:	83 c4 10             	add    $0x10,%esp
+  80150d:	85 c0                	test   %eax,%eax
+  80150f:	78 4b                	js     80155c <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  801511:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  801516:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80151b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  80151e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  801522:	0f 85 16 01 00 00    	jne    80163e <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801528:	e8 ac f8 ff ff       	call   800dd9 <sys_getenvid>
+  80152d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801532:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801534:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  80153a:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  801540:	77 32                	ja     801574 <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801542:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  801547:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  801549:	c1 ea 10             	shr    $0x10,%edx
+  80154c:	74 26                	je     801574 <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80154e:	c1 e2 10             	shl    $0x10,%edx
+  801551:	89 d1                	mov    %edx,%ecx
+  801553:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801558:	29 ca                	sub    %ecx,%edx
+  80155a:	eb 1e                	jmp    80157a <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  80155c:	83 ec 08             	sub    $0x8,%esp
+  80155f:	89 c7                	mov    %eax,%edi
+  801561:	50                   	push   %eax
+  801562:	68 41 4f 80 00       	push   $0x804f41
+  801567:	e8 a3 ee ff ff       	call   80040f <cprintf>
+		return eid;
+  80156c:	83 c4 10             	add    $0x10,%esp
+  80156f:	e9 6c 01 00 00       	jmp    8016e0 <fork+0x1f3>
+		return pthread_main_tls;
+  801574:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80157a:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80157d:	c1 e0 04             	shl    $0x4,%eax
+  801580:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801585:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  801587:	e8 c4 2c 00 00       	call   804250 <pthread_fork_child>
+		return eid;
+  80158c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80158f:	e9 4c 01 00 00       	jmp    8016e0 <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  801594:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  80159a:	89 da                	mov    %ebx,%edx
+  80159c:	89 f8                	mov    %edi,%eax
+  80159e:	e8 af fd ff ff       	call   801352 <duppage>
+  8015a3:	85 c0                	test   %eax,%eax
+  8015a5:	79 28                	jns    8015cf <fork+0xe2>
+  8015a7:	89 c7                	mov    %eax,%edi
+  8015a9:	e9 32 01 00 00       	jmp    8016e0 <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  8015ae:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8015b4:	83 f9 05             	cmp    $0x5,%ecx
+  8015b7:	75 58                	jne    801611 <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8015b9:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8015be:	89 da                	mov    %ebx,%edx
+  8015c0:	89 f8                	mov    %edi,%eax
+  8015c2:	e8 8b fd ff ff       	call   801352 <duppage>
+  8015c7:	85 c0                	test   %eax,%eax
+  8015c9:	0f 88 0f 01 00 00    	js     8016de <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  8015cf:	83 c3 01             	add    $0x1,%ebx
+  8015d2:	39 de                	cmp    %ebx,%esi
+  8015d4:	74 54                	je     80162a <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  8015d6:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  8015dd:	f6 c1 05             	test   $0x5,%cl
+  8015e0:	74 ed                	je     8015cf <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  8015e2:	f6 c5 04             	test   $0x4,%ch
+  8015e5:	75 ad                	jne    801594 <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  8015e7:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  8015ed:	74 bf                	je     8015ae <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  8015ef:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8015f5:	74 d8                	je     8015cf <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  8015f7:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  8015fd:	89 da                	mov    %ebx,%edx
+  8015ff:	89 f8                	mov    %edi,%eax
+  801601:	e8 cd fc ff ff       	call   8012d3 <duppage_cow>
+  801606:	85 c0                	test   %eax,%eax
+  801608:	79 c5                	jns    8015cf <fork+0xe2>
+  80160a:	89 c7                	mov    %eax,%edi
+  80160c:	e9 cf 00 00 00       	jmp    8016e0 <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  801611:	68 8c 4e 80 00       	push   $0x804e8c
+  801616:	68 51 4f 80 00       	push   $0x804f51
+  80161b:	68 c6 00 00 00       	push   $0xc6
+  801620:	68 36 4f 80 00       	push   $0x804f36
+  801625:	e8 0a ed ff ff       	call   800334 <_panic>
+  80162a:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80162d:	83 c1 01             	add    $0x1,%ecx
+  801630:	81 c6 00 04 00 00    	add    $0x400,%esi
+  801636:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  80163c:	74 18                	je     801656 <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  80163e:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  801645:	a8 07                	test   $0x7,%al
+  801647:	74 e4                	je     80162d <fork+0x140>
+  801649:	89 cb                	mov    %ecx,%ebx
+  80164b:	c1 e3 0a             	shl    $0xa,%ebx
+  80164e:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801651:	e9 7c ff ff ff       	jmp    8015d2 <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  801656:	83 ec 04             	sub    $0x4,%esp
+  801659:	6a 07                	push   $0x7
+  80165b:	68 00 f0 bf ee       	push   $0xeebff000
+  801660:	ff 75 e4             	push   -0x1c(%ebp)
+  801663:	e8 c9 f7 ff ff       	call   800e31 <sys_page_alloc>
+  801668:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80166a:	83 c4 10             	add    $0x10,%esp
+  80166d:	85 c0                	test   %eax,%eax
+  80166f:	78 34                	js     8016a5 <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  801671:	83 ec 08             	sub    $0x8,%esp
+  801674:	68 c5 44 80 00       	push   $0x8044c5
+  801679:	ff 75 e4             	push   -0x1c(%ebp)
+  80167c:	e8 2d f9 ff ff       	call   800fae <sys_env_set_pgfault_upcall>
+  801681:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801683:	83 c4 10             	add    $0x10,%esp
+  801686:	85 c0                	test   %eax,%eax
+  801688:	78 2e                	js     8016b8 <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  80168a:	83 ec 08             	sub    $0x8,%esp
+  80168d:	6a 02                	push   $0x2
+  80168f:	ff 75 e4             	push   -0x1c(%ebp)
+  801692:	e8 7f f8 ff ff       	call   800f16 <sys_env_set_status>
+  801697:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801699:	83 c4 10             	add    $0x10,%esp
+  80169c:	85 c0                	test   %eax,%eax
+  80169e:	78 2b                	js     8016cb <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  8016a0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8016a3:	eb 3b                	jmp    8016e0 <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  8016a5:	83 ec 08             	sub    $0x8,%esp
+  8016a8:	50                   	push   %eax
+  8016a9:	68 b4 4e 80 00       	push   $0x804eb4
+  8016ae:	e8 5c ed ff ff       	call   80040f <cprintf>
+		return r;
+  8016b3:	83 c4 10             	add    $0x10,%esp
+  8016b6:	eb 28                	jmp    8016e0 <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  8016b8:	83 ec 08             	sub    $0x8,%esp
+  8016bb:	50                   	push   %eax
+  8016bc:	68 dc 4e 80 00       	push   $0x804edc
+  8016c1:	e8 49 ed ff ff       	call   80040f <cprintf>
+		return r;
+  8016c6:	83 c4 10             	add    $0x10,%esp
+  8016c9:	eb 15                	jmp    8016e0 <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  8016cb:	83 ec 08             	sub    $0x8,%esp
+  8016ce:	50                   	push   %eax
+  8016cf:	68 66 4f 80 00       	push   $0x804f66
+  8016d4:	e8 36 ed ff ff       	call   80040f <cprintf>
+		return r;
+  8016d9:	83 c4 10             	add    $0x10,%esp
+  8016dc:	eb 02                	jmp    8016e0 <fork+0x1f3>
+  8016de:	89 c7                	mov    %eax,%edi
+}
+  8016e0:	89 f8                	mov    %edi,%eax
+  8016e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016e5:	5b                   	pop    %ebx
+  8016e6:	5e                   	pop    %esi
+  8016e7:	5f                   	pop    %edi
+  8016e8:	5d                   	pop    %ebp
+  8016e9:	c3                   	ret
+
+008016ea <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  8016ea:	55                   	push   %ebp
+  8016eb:	89 e5                	mov    %esp,%ebp
+  8016ed:	57                   	push   %edi
+  8016ee:	56                   	push   %esi
+  8016ef:	53                   	push   %ebx
+  8016f0:	83 ec 2c             	sub    $0x2c,%esp
+  8016f3:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8016f5:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  8016fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801700:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  801706:	77 0a                	ja     801712 <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801708:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  80170d:	29 c3                	sub    %eax,%ebx
+  80170f:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  801712:	83 ec 0c             	sub    $0xc,%esp
+  801715:	68 50 14 80 00       	push   $0x801450
+  80171a:	e8 68 2d 00 00       	call   804487 <set_pgfault_handler>
+  80171f:	b8 07 00 00 00       	mov    $0x7,%eax
+  801724:	cd 30                	int    $0x30
+  801726:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  801729:	83 c4 10             	add    $0x10,%esp
+  80172c:	85 c0                	test   %eax,%eax
+  80172e:	78 30                	js     801760 <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  801730:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801734:	74 42                	je     801778 <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  801736:	c1 e3 10             	shl    $0x10,%ebx
+  801739:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  80173e:	29 d8                	sub    %ebx,%eax
+  801740:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801743:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  801748:	29 d8                	sub    %ebx,%eax
+  80174a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80174d:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  801752:	ba 00 00 00 00       	mov    $0x0,%edx
+  801757:	89 f7                	mov    %esi,%edi
+  801759:	89 d6                	mov    %edx,%esi
+  80175b:	e9 2c 01 00 00       	jmp    80188c <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  801760:	83 ec 08             	sub    $0x8,%esp
+  801763:	89 c7                	mov    %eax,%edi
+  801765:	50                   	push   %eax
+  801766:	68 41 4f 80 00       	push   $0x804f41
+  80176b:	e8 9f ec ff ff       	call   80040f <cprintf>
+		return eid;
+  801770:	83 c4 10             	add    $0x10,%esp
+  801773:	e9 d5 00 00 00       	jmp    80184d <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801778:	e8 5c f6 ff ff       	call   800dd9 <sys_getenvid>
+  80177d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801782:	89 c2                	mov    %eax,%edx
+  801784:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801786:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  80178c:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801791:	77 18                	ja     8017ab <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801793:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801798:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  80179a:	c1 e8 10             	shr    $0x10,%eax
+  80179d:	74 0c                	je     8017ab <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80179f:	c1 e0 10             	shl    $0x10,%eax
+  8017a2:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8017a7:	29 c1                	sub    %eax,%ecx
+  8017a9:	eb 06                	jmp    8017b1 <sfork+0xc7>
+		return pthread_main_tls;
+  8017ab:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+  8017b1:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8017b4:	c1 e0 04             	shl    $0x4,%eax
+  8017b7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8017bc:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  8017be:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8017c1:	e9 87 00 00 00       	jmp    80184d <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  8017c6:	f6 c5 04             	test   $0x4,%ch
+  8017c9:	74 6c                	je     801837 <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  8017cb:	89 ca                	mov    %ecx,%edx
+  8017cd:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  8017d3:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  8017d9:	74 7c                	je     801857 <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8017db:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8017e1:	89 da                	mov    %ebx,%edx
+  8017e3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8017e6:	e8 67 fb ff ff       	call   801352 <duppage>
+  8017eb:	85 c0                	test   %eax,%eax
+  8017ed:	0f 88 4f 01 00 00    	js     801942 <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  8017f3:	83 c3 01             	add    $0x1,%ebx
+  8017f6:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  8017f9:	74 7a                	je     801875 <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  8017fb:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  8017fd:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  801804:	f6 c1 01             	test   $0x1,%cl
+  801807:	74 ea                	je     8017f3 <sfork+0x109>
+  801809:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  80180f:	74 e2                	je     8017f3 <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  801811:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  801817:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  80181a:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  80181f:	76 a5                	jbe    8017c6 <sfork+0xdc>
+  801821:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  801827:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  80182a:	39 fa                	cmp    %edi,%edx
+  80182c:	73 9d                	jae    8017cb <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  80182e:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  801831:	39 fa                	cmp    %edi,%edx
+  801833:	72 96                	jb     8017cb <sfork+0xe1>
+  801835:	eb 8f                	jmp    8017c6 <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  801837:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  80183d:	89 da                	mov    %ebx,%edx
+  80183f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801842:	e8 8c fa ff ff       	call   8012d3 <duppage_cow>
+  801847:	85 c0                	test   %eax,%eax
+  801849:	79 a8                	jns    8017f3 <sfork+0x109>
+  80184b:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  80184d:	89 f8                	mov    %edi,%eax
+  80184f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801852:	5b                   	pop    %ebx
+  801853:	5e                   	pop    %esi
+  801854:	5f                   	pop    %edi
+  801855:	5d                   	pop    %ebp
+  801856:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  801857:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  80185c:	e8 2e fb ff ff       	call   80138f <cow_copy>
+  801861:	85 c0                	test   %eax,%eax
+  801863:	0f 88 d2 00 00 00    	js     80193b <sfork+0x251>
+				pte = uvpt[pn];
+  801869:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  801870:	e9 66 ff ff ff       	jmp    8017db <sfork+0xf1>
+  801875:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801878:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80187b:	83 c6 01             	add    $0x1,%esi
+  80187e:	81 c7 00 04 00 00    	add    $0x400,%edi
+  801884:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  80188a:	74 1b                	je     8018a7 <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  80188c:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  801893:	a8 01                	test   $0x1,%al
+  801895:	74 e4                	je     80187b <sfork+0x191>
+  801897:	89 f3                	mov    %esi,%ebx
+  801899:	c1 e3 0a             	shl    $0xa,%ebx
+  80189c:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  80189f:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  8018a2:	e9 4f ff ff ff       	jmp    8017f6 <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  8018a7:	83 ec 04             	sub    $0x4,%esp
+  8018aa:	6a 07                	push   $0x7
+  8018ac:	68 00 f0 bf ee       	push   $0xeebff000
+  8018b1:	ff 75 e0             	push   -0x20(%ebp)
+  8018b4:	e8 78 f5 ff ff       	call   800e31 <sys_page_alloc>
+  8018b9:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8018bb:	83 c4 10             	add    $0x10,%esp
+  8018be:	85 c0                	test   %eax,%eax
+  8018c0:	78 37                	js     8018f9 <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  8018c2:	83 ec 08             	sub    $0x8,%esp
+  8018c5:	68 c5 44 80 00       	push   $0x8044c5
+  8018ca:	ff 75 e0             	push   -0x20(%ebp)
+  8018cd:	e8 dc f6 ff ff       	call   800fae <sys_env_set_pgfault_upcall>
+  8018d2:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8018d4:	83 c4 10             	add    $0x10,%esp
+  8018d7:	85 c0                	test   %eax,%eax
+  8018d9:	78 34                	js     80190f <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  8018db:	83 ec 08             	sub    $0x8,%esp
+  8018de:	6a 02                	push   $0x2
+  8018e0:	ff 75 e0             	push   -0x20(%ebp)
+  8018e3:	e8 2e f6 ff ff       	call   800f16 <sys_env_set_status>
+  8018e8:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8018ea:	83 c4 10             	add    $0x10,%esp
+  8018ed:	85 c0                	test   %eax,%eax
+  8018ef:	78 34                	js     801925 <sfork+0x23b>
+	return eid;
+  8018f1:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8018f4:	e9 54 ff ff ff       	jmp    80184d <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  8018f9:	83 ec 08             	sub    $0x8,%esp
+  8018fc:	50                   	push   %eax
+  8018fd:	68 b4 4e 80 00       	push   $0x804eb4
+  801902:	e8 08 eb ff ff       	call   80040f <cprintf>
+		return r;
+  801907:	83 c4 10             	add    $0x10,%esp
+  80190a:	e9 3e ff ff ff       	jmp    80184d <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  80190f:	83 ec 08             	sub    $0x8,%esp
+  801912:	50                   	push   %eax
+  801913:	68 dc 4e 80 00       	push   $0x804edc
+  801918:	e8 f2 ea ff ff       	call   80040f <cprintf>
+		return r;
+  80191d:	83 c4 10             	add    $0x10,%esp
+  801920:	e9 28 ff ff ff       	jmp    80184d <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  801925:	83 ec 08             	sub    $0x8,%esp
+  801928:	50                   	push   %eax
+  801929:	68 66 4f 80 00       	push   $0x804f66
+  80192e:	e8 dc ea ff ff       	call   80040f <cprintf>
+		return r;
+  801933:	83 c4 10             	add    $0x10,%esp
+  801936:	e9 12 ff ff ff       	jmp    80184d <sfork+0x163>
+  80193b:	89 c7                	mov    %eax,%edi
+  80193d:	e9 0b ff ff ff       	jmp    80184d <sfork+0x163>
+  801942:	89 c7                	mov    %eax,%edi
+  801944:	e9 04 ff ff ff       	jmp    80184d <sfork+0x163>
+
+00801949 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801949:	55                   	push   %ebp
+  80194a:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80194c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80194f:	05 00 00 00 30       	add    $0x30000000,%eax
+  801954:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801957:	5d                   	pop    %ebp
+  801958:	c3                   	ret
+
+00801959 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801959:	55                   	push   %ebp
+  80195a:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80195c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80195f:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801964:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801969:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80196e:	5d                   	pop    %ebp
+  80196f:	c3                   	ret
+
+00801970 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801970:	55                   	push   %ebp
+  801971:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801973:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801978:	eb 02                	jmp    80197c <fd_alloc+0xc>
+  80197a:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80197c:	89 c2                	mov    %eax,%edx
+  80197e:	c1 ea 16             	shr    $0x16,%edx
+  801981:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801988:	f6 c2 01             	test   $0x1,%dl
+  80198b:	74 2b                	je     8019b8 <fd_alloc+0x48>
+  80198d:	89 c2                	mov    %eax,%edx
+  80198f:	c1 ea 0c             	shr    $0xc,%edx
+  801992:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801999:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80199f:	f6 c1 01             	test   $0x1,%cl
+  8019a2:	74 14                	je     8019b8 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8019a4:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8019aa:	75 ce                	jne    80197a <fd_alloc+0xa>
+  8019ac:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8019b1:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8019b6:	eb 05                	jmp    8019bd <fd_alloc+0x4d>
+			return 0;
+  8019b8:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8019bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019c0:	89 02                	mov    %eax,(%edx)
+}
+  8019c2:	89 c8                	mov    %ecx,%eax
+  8019c4:	5d                   	pop    %ebp
+  8019c5:	c3                   	ret
+
+008019c6 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8019c6:	55                   	push   %ebp
+  8019c7:	89 e5                	mov    %esp,%ebp
+  8019c9:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8019cc:	83 f8 1f             	cmp    $0x1f,%eax
+  8019cf:	77 30                	ja     801a01 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8019d1:	c1 e0 0c             	shl    $0xc,%eax
+  8019d4:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8019d9:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8019df:	f6 c2 01             	test   $0x1,%dl
+  8019e2:	74 24                	je     801a08 <fd_lookup+0x42>
+  8019e4:	89 c2                	mov    %eax,%edx
+  8019e6:	c1 ea 0c             	shr    $0xc,%edx
+  8019e9:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8019f0:	f6 c2 01             	test   $0x1,%dl
+  8019f3:	74 1a                	je     801a0f <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8019f5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019f8:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8019fa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019ff:	5d                   	pop    %ebp
+  801a00:	c3                   	ret
+		return -E_INVAL;
+  801a01:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a06:	eb f7                	jmp    8019ff <fd_lookup+0x39>
+		return -E_INVAL;
+  801a08:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a0d:	eb f0                	jmp    8019ff <fd_lookup+0x39>
+  801a0f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a14:	eb e9                	jmp    8019ff <fd_lookup+0x39>
+
+00801a16 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801a16:	55                   	push   %ebp
+  801a17:	89 e5                	mov    %esp,%ebp
+  801a19:	53                   	push   %ebx
+  801a1a:	83 ec 04             	sub    $0x4,%esp
+  801a1d:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801a20:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a25:	eb 03                	jmp    801a2a <dev_lookup+0x14>
+  801a27:	83 c0 01             	add    $0x1,%eax
+  801a2a:	8b 1c 85 00 50 80 00 	mov    0x805000(,%eax,4),%ebx
+  801a31:	85 db                	test   %ebx,%ebx
+  801a33:	74 0b                	je     801a40 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801a35:	39 13                	cmp    %edx,(%ebx)
+  801a37:	75 ee                	jne    801a27 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801a39:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a3e:	eb 49                	jmp    801a89 <dev_lookup+0x73>
+  801a40:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801a42:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  801a48:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801a4d:	77 18                	ja     801a67 <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801a4f:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801a54:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  801a56:	c1 e8 10             	shr    $0x10,%eax
+  801a59:	74 0c                	je     801a67 <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801a5b:	c1 e0 10             	shl    $0x10,%eax
+  801a5e:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  801a63:	29 c1                	sub    %eax,%ecx
+  801a65:	eb 06                	jmp    801a6d <dev_lookup+0x57>
+		return pthread_main_tls;
+  801a67:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801a6d:	8b 01                	mov    (%ecx),%eax
+  801a6f:	8b 40 48             	mov    0x48(%eax),%eax
+  801a72:	83 ec 04             	sub    $0x4,%esp
+  801a75:	52                   	push   %edx
+  801a76:	50                   	push   %eax
+  801a77:	68 84 4f 80 00       	push   $0x804f84
+  801a7c:	e8 8e e9 ff ff       	call   80040f <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801a81:	83 c4 10             	add    $0x10,%esp
+  801a84:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801a89:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a8c:	89 1a                	mov    %ebx,(%edx)
+}
+  801a8e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a91:	c9                   	leave
+  801a92:	c3                   	ret
+
+00801a93 <fd_close>:
+{
+  801a93:	55                   	push   %ebp
+  801a94:	89 e5                	mov    %esp,%ebp
+  801a96:	57                   	push   %edi
+  801a97:	56                   	push   %esi
+  801a98:	53                   	push   %ebx
+  801a99:	83 ec 24             	sub    $0x24,%esp
+  801a9c:	8b 75 08             	mov    0x8(%ebp),%esi
+  801a9f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801aa2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801aa5:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801aa6:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801aac:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801aaf:	50                   	push   %eax
+  801ab0:	e8 11 ff ff ff       	call   8019c6 <fd_lookup>
+  801ab5:	89 c3                	mov    %eax,%ebx
+  801ab7:	83 c4 10             	add    $0x10,%esp
+  801aba:	85 c0                	test   %eax,%eax
+  801abc:	78 05                	js     801ac3 <fd_close+0x30>
+	    || fd != fd2)
+  801abe:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801ac1:	74 16                	je     801ad9 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801ac3:	89 f8                	mov    %edi,%eax
+  801ac5:	84 c0                	test   %al,%al
+  801ac7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801acc:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801acf:	89 d8                	mov    %ebx,%eax
+  801ad1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ad4:	5b                   	pop    %ebx
+  801ad5:	5e                   	pop    %esi
+  801ad6:	5f                   	pop    %edi
+  801ad7:	5d                   	pop    %ebp
+  801ad8:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801ad9:	83 ec 08             	sub    $0x8,%esp
+  801adc:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801adf:	50                   	push   %eax
+  801ae0:	ff 36                	push   (%esi)
+  801ae2:	e8 2f ff ff ff       	call   801a16 <dev_lookup>
+  801ae7:	89 c3                	mov    %eax,%ebx
+  801ae9:	83 c4 10             	add    $0x10,%esp
+  801aec:	85 c0                	test   %eax,%eax
+  801aee:	78 1a                	js     801b0a <fd_close+0x77>
+		if (dev->dev_close)
+  801af0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801af3:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801af6:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801afb:	85 c0                	test   %eax,%eax
+  801afd:	74 0b                	je     801b0a <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801aff:	83 ec 0c             	sub    $0xc,%esp
+  801b02:	56                   	push   %esi
+  801b03:	ff d0                	call   *%eax
+  801b05:	89 c3                	mov    %eax,%ebx
+  801b07:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801b0a:	83 ec 08             	sub    $0x8,%esp
+  801b0d:	56                   	push   %esi
+  801b0e:	6a 00                	push   $0x0
+  801b10:	e8 b5 f3 ff ff       	call   800eca <sys_page_unmap>
+	return r;
+  801b15:	83 c4 10             	add    $0x10,%esp
+  801b18:	eb b5                	jmp    801acf <fd_close+0x3c>
+
+00801b1a <close>:
+
+int
+close(int fdnum)
+{
+  801b1a:	55                   	push   %ebp
+  801b1b:	89 e5                	mov    %esp,%ebp
+  801b1d:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801b20:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b23:	50                   	push   %eax
+  801b24:	ff 75 08             	push   0x8(%ebp)
+  801b27:	e8 9a fe ff ff       	call   8019c6 <fd_lookup>
+  801b2c:	83 c4 10             	add    $0x10,%esp
+  801b2f:	85 c0                	test   %eax,%eax
+  801b31:	79 02                	jns    801b35 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801b33:	c9                   	leave
+  801b34:	c3                   	ret
+		return fd_close(fd, 1);
+  801b35:	83 ec 08             	sub    $0x8,%esp
+  801b38:	6a 01                	push   $0x1
+  801b3a:	ff 75 f4             	push   -0xc(%ebp)
+  801b3d:	e8 51 ff ff ff       	call   801a93 <fd_close>
+  801b42:	83 c4 10             	add    $0x10,%esp
+  801b45:	eb ec                	jmp    801b33 <close+0x19>
+
+00801b47 <close_all>:
+
+void
+close_all(void)
+{
+  801b47:	55                   	push   %ebp
+  801b48:	89 e5                	mov    %esp,%ebp
+  801b4a:	53                   	push   %ebx
+  801b4b:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801b4e:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801b53:	83 ec 0c             	sub    $0xc,%esp
+  801b56:	53                   	push   %ebx
+  801b57:	e8 be ff ff ff       	call   801b1a <close>
+	for (i = 0; i < MAXFD; i++)
+  801b5c:	83 c3 01             	add    $0x1,%ebx
+  801b5f:	83 c4 10             	add    $0x10,%esp
+  801b62:	83 fb 20             	cmp    $0x20,%ebx
+  801b65:	75 ec                	jne    801b53 <close_all+0xc>
+}
+  801b67:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b6a:	c9                   	leave
+  801b6b:	c3                   	ret
+
+00801b6c <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801b6c:	55                   	push   %ebp
+  801b6d:	89 e5                	mov    %esp,%ebp
+  801b6f:	57                   	push   %edi
+  801b70:	56                   	push   %esi
+  801b71:	53                   	push   %ebx
+  801b72:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801b75:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801b78:	50                   	push   %eax
+  801b79:	ff 75 08             	push   0x8(%ebp)
+  801b7c:	e8 45 fe ff ff       	call   8019c6 <fd_lookup>
+  801b81:	89 c3                	mov    %eax,%ebx
+  801b83:	83 c4 10             	add    $0x10,%esp
+  801b86:	85 c0                	test   %eax,%eax
+  801b88:	78 7f                	js     801c09 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801b8a:	83 ec 0c             	sub    $0xc,%esp
+  801b8d:	ff 75 0c             	push   0xc(%ebp)
+  801b90:	e8 85 ff ff ff       	call   801b1a <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801b95:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801b98:	c1 e6 0c             	shl    $0xc,%esi
+  801b9b:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801ba1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801ba4:	89 3c 24             	mov    %edi,(%esp)
+  801ba7:	e8 ad fd ff ff       	call   801959 <fd2data>
+  801bac:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801bae:	89 34 24             	mov    %esi,(%esp)
+  801bb1:	e8 a3 fd ff ff       	call   801959 <fd2data>
+  801bb6:	83 c4 10             	add    $0x10,%esp
+  801bb9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801bbc:	89 d8                	mov    %ebx,%eax
+  801bbe:	c1 e8 16             	shr    $0x16,%eax
+  801bc1:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801bc8:	a8 01                	test   $0x1,%al
+  801bca:	74 11                	je     801bdd <dup+0x71>
+  801bcc:	89 d8                	mov    %ebx,%eax
+  801bce:	c1 e8 0c             	shr    $0xc,%eax
+  801bd1:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801bd8:	f6 c2 01             	test   $0x1,%dl
+  801bdb:	75 36                	jne    801c13 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801bdd:	89 f8                	mov    %edi,%eax
+  801bdf:	c1 e8 0c             	shr    $0xc,%eax
+  801be2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801be9:	83 ec 0c             	sub    $0xc,%esp
+  801bec:	25 07 0e 00 00       	and    $0xe07,%eax
+  801bf1:	50                   	push   %eax
+  801bf2:	56                   	push   %esi
+  801bf3:	6a 00                	push   $0x0
+  801bf5:	57                   	push   %edi
+  801bf6:	6a 00                	push   $0x0
+  801bf8:	e8 81 f2 ff ff       	call   800e7e <sys_page_map>
+  801bfd:	89 c3                	mov    %eax,%ebx
+  801bff:	83 c4 20             	add    $0x20,%esp
+  801c02:	85 c0                	test   %eax,%eax
+  801c04:	78 33                	js     801c39 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801c06:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801c09:	89 d8                	mov    %ebx,%eax
+  801c0b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c0e:	5b                   	pop    %ebx
+  801c0f:	5e                   	pop    %esi
+  801c10:	5f                   	pop    %edi
+  801c11:	5d                   	pop    %ebp
+  801c12:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801c13:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801c1a:	83 ec 0c             	sub    $0xc,%esp
+  801c1d:	25 07 0e 00 00       	and    $0xe07,%eax
+  801c22:	50                   	push   %eax
+  801c23:	ff 75 d4             	push   -0x2c(%ebp)
+  801c26:	6a 00                	push   $0x0
+  801c28:	53                   	push   %ebx
+  801c29:	6a 00                	push   $0x0
+  801c2b:	e8 4e f2 ff ff       	call   800e7e <sys_page_map>
+  801c30:	89 c3                	mov    %eax,%ebx
+  801c32:	83 c4 20             	add    $0x20,%esp
+  801c35:	85 c0                	test   %eax,%eax
+  801c37:	79 a4                	jns    801bdd <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801c39:	83 ec 08             	sub    $0x8,%esp
+  801c3c:	56                   	push   %esi
+  801c3d:	6a 00                	push   $0x0
+  801c3f:	e8 86 f2 ff ff       	call   800eca <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801c44:	83 c4 08             	add    $0x8,%esp
+  801c47:	ff 75 d4             	push   -0x2c(%ebp)
+  801c4a:	6a 00                	push   $0x0
+  801c4c:	e8 79 f2 ff ff       	call   800eca <sys_page_unmap>
+	return r;
+  801c51:	83 c4 10             	add    $0x10,%esp
+  801c54:	eb b3                	jmp    801c09 <dup+0x9d>
+
+00801c56 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801c56:	55                   	push   %ebp
+  801c57:	89 e5                	mov    %esp,%ebp
+  801c59:	56                   	push   %esi
+  801c5a:	53                   	push   %ebx
+  801c5b:	83 ec 18             	sub    $0x18,%esp
+  801c5e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c61:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c64:	50                   	push   %eax
+  801c65:	53                   	push   %ebx
+  801c66:	e8 5b fd ff ff       	call   8019c6 <fd_lookup>
+  801c6b:	83 c4 10             	add    $0x10,%esp
+  801c6e:	85 c0                	test   %eax,%eax
+  801c70:	78 3c                	js     801cae <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c72:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c75:	83 ec 08             	sub    $0x8,%esp
+  801c78:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c7b:	50                   	push   %eax
+  801c7c:	ff 36                	push   (%esi)
+  801c7e:	e8 93 fd ff ff       	call   801a16 <dev_lookup>
+  801c83:	83 c4 10             	add    $0x10,%esp
+  801c86:	85 c0                	test   %eax,%eax
+  801c88:	78 24                	js     801cae <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801c8a:	8b 46 08             	mov    0x8(%esi),%eax
+  801c8d:	83 e0 03             	and    $0x3,%eax
+  801c90:	83 f8 01             	cmp    $0x1,%eax
+  801c93:	74 20                	je     801cb5 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801c95:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c98:	8b 40 08             	mov    0x8(%eax),%eax
+  801c9b:	85 c0                	test   %eax,%eax
+  801c9d:	74 61                	je     801d00 <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801c9f:	83 ec 04             	sub    $0x4,%esp
+  801ca2:	ff 75 10             	push   0x10(%ebp)
+  801ca5:	ff 75 0c             	push   0xc(%ebp)
+  801ca8:	56                   	push   %esi
+  801ca9:	ff d0                	call   *%eax
+  801cab:	83 c4 10             	add    $0x10,%esp
+}
+  801cae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cb1:	5b                   	pop    %ebx
+  801cb2:	5e                   	pop    %esi
+  801cb3:	5d                   	pop    %ebp
+  801cb4:	c3                   	ret
+  801cb5:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801cb7:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801cbd:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801cc2:	77 18                	ja     801cdc <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801cc4:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801cc9:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801ccb:	c1 e8 10             	shr    $0x10,%eax
+  801cce:	74 0c                	je     801cdc <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801cd0:	c1 e0 10             	shl    $0x10,%eax
+  801cd3:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801cd8:	29 c2                	sub    %eax,%edx
+  801cda:	eb 06                	jmp    801ce2 <read+0x8c>
+		return pthread_main_tls;
+  801cdc:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801ce2:	8b 02                	mov    (%edx),%eax
+  801ce4:	8b 40 48             	mov    0x48(%eax),%eax
+  801ce7:	83 ec 04             	sub    $0x4,%esp
+  801cea:	53                   	push   %ebx
+  801ceb:	50                   	push   %eax
+  801cec:	68 c5 4f 80 00       	push   $0x804fc5
+  801cf1:	e8 19 e7 ff ff       	call   80040f <cprintf>
+		return -E_INVAL;
+  801cf6:	83 c4 10             	add    $0x10,%esp
+  801cf9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801cfe:	eb ae                	jmp    801cae <read+0x58>
+		return -E_NOT_SUPP;
+  801d00:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d05:	eb a7                	jmp    801cae <read+0x58>
+
+00801d07 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801d07:	55                   	push   %ebp
+  801d08:	89 e5                	mov    %esp,%ebp
+  801d0a:	57                   	push   %edi
+  801d0b:	56                   	push   %esi
+  801d0c:	53                   	push   %ebx
+  801d0d:	83 ec 0c             	sub    $0xc,%esp
+  801d10:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801d13:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801d16:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d1b:	eb 02                	jmp    801d1f <readn+0x18>
+  801d1d:	01 c3                	add    %eax,%ebx
+  801d1f:	39 f3                	cmp    %esi,%ebx
+  801d21:	73 21                	jae    801d44 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801d23:	83 ec 04             	sub    $0x4,%esp
+  801d26:	89 f0                	mov    %esi,%eax
+  801d28:	29 d8                	sub    %ebx,%eax
+  801d2a:	50                   	push   %eax
+  801d2b:	89 d8                	mov    %ebx,%eax
+  801d2d:	03 45 0c             	add    0xc(%ebp),%eax
+  801d30:	50                   	push   %eax
+  801d31:	57                   	push   %edi
+  801d32:	e8 1f ff ff ff       	call   801c56 <read>
+		if (m < 0)
+  801d37:	83 c4 10             	add    $0x10,%esp
+  801d3a:	85 c0                	test   %eax,%eax
+  801d3c:	78 04                	js     801d42 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801d3e:	75 dd                	jne    801d1d <readn+0x16>
+  801d40:	eb 02                	jmp    801d44 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801d42:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801d44:	89 d8                	mov    %ebx,%eax
+  801d46:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d49:	5b                   	pop    %ebx
+  801d4a:	5e                   	pop    %esi
+  801d4b:	5f                   	pop    %edi
+  801d4c:	5d                   	pop    %ebp
+  801d4d:	c3                   	ret
+
+00801d4e <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801d4e:	55                   	push   %ebp
+  801d4f:	89 e5                	mov    %esp,%ebp
+  801d51:	56                   	push   %esi
+  801d52:	53                   	push   %ebx
+  801d53:	83 ec 18             	sub    $0x18,%esp
+  801d56:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d59:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d5c:	50                   	push   %eax
+  801d5d:	53                   	push   %ebx
+  801d5e:	e8 63 fc ff ff       	call   8019c6 <fd_lookup>
+  801d63:	83 c4 10             	add    $0x10,%esp
+  801d66:	85 c0                	test   %eax,%eax
+  801d68:	78 37                	js     801da1 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d6a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d6d:	83 ec 08             	sub    $0x8,%esp
+  801d70:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d73:	50                   	push   %eax
+  801d74:	ff 36                	push   (%esi)
+  801d76:	e8 9b fc ff ff       	call   801a16 <dev_lookup>
+  801d7b:	83 c4 10             	add    $0x10,%esp
+  801d7e:	85 c0                	test   %eax,%eax
+  801d80:	78 1f                	js     801da1 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d82:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801d86:	74 20                	je     801da8 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801d88:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d8b:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d8e:	85 c0                	test   %eax,%eax
+  801d90:	74 61                	je     801df3 <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801d92:	83 ec 04             	sub    $0x4,%esp
+  801d95:	ff 75 10             	push   0x10(%ebp)
+  801d98:	ff 75 0c             	push   0xc(%ebp)
+  801d9b:	56                   	push   %esi
+  801d9c:	ff d0                	call   *%eax
+  801d9e:	83 c4 10             	add    $0x10,%esp
+}
+  801da1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801da4:	5b                   	pop    %ebx
+  801da5:	5e                   	pop    %esi
+  801da6:	5d                   	pop    %ebp
+  801da7:	c3                   	ret
+  801da8:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801daa:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801db0:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801db5:	77 18                	ja     801dcf <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801db7:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801dbc:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801dbe:	c1 e8 10             	shr    $0x10,%eax
+  801dc1:	74 0c                	je     801dcf <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801dc3:	c1 e0 10             	shl    $0x10,%eax
+  801dc6:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801dcb:	29 c2                	sub    %eax,%edx
+  801dcd:	eb 06                	jmp    801dd5 <write+0x87>
+		return pthread_main_tls;
+  801dcf:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801dd5:	8b 02                	mov    (%edx),%eax
+  801dd7:	8b 40 48             	mov    0x48(%eax),%eax
+  801dda:	83 ec 04             	sub    $0x4,%esp
+  801ddd:	53                   	push   %ebx
+  801dde:	50                   	push   %eax
+  801ddf:	68 e1 4f 80 00       	push   $0x804fe1
+  801de4:	e8 26 e6 ff ff       	call   80040f <cprintf>
+		return -E_INVAL;
+  801de9:	83 c4 10             	add    $0x10,%esp
+  801dec:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801df1:	eb ae                	jmp    801da1 <write+0x53>
+		return -E_NOT_SUPP;
+  801df3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801df8:	eb a7                	jmp    801da1 <write+0x53>
+
+00801dfa <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801dfa:	55                   	push   %ebp
+  801dfb:	89 e5                	mov    %esp,%ebp
+  801dfd:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801e00:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e03:	50                   	push   %eax
+  801e04:	ff 75 08             	push   0x8(%ebp)
+  801e07:	e8 ba fb ff ff       	call   8019c6 <fd_lookup>
+  801e0c:	83 c4 10             	add    $0x10,%esp
+  801e0f:	85 c0                	test   %eax,%eax
+  801e11:	78 0e                	js     801e21 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801e13:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e16:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e19:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801e1c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e21:	c9                   	leave
+  801e22:	c3                   	ret
+
+00801e23 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801e23:	55                   	push   %ebp
+  801e24:	89 e5                	mov    %esp,%ebp
+  801e26:	56                   	push   %esi
+  801e27:	53                   	push   %ebx
+  801e28:	83 ec 18             	sub    $0x18,%esp
+  801e2b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801e2e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e31:	50                   	push   %eax
+  801e32:	53                   	push   %ebx
+  801e33:	e8 8e fb ff ff       	call   8019c6 <fd_lookup>
+  801e38:	83 c4 10             	add    $0x10,%esp
+  801e3b:	85 c0                	test   %eax,%eax
+  801e3d:	78 34                	js     801e73 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801e3f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e42:	83 ec 08             	sub    $0x8,%esp
+  801e45:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e48:	50                   	push   %eax
+  801e49:	ff 36                	push   (%esi)
+  801e4b:	e8 c6 fb ff ff       	call   801a16 <dev_lookup>
+  801e50:	83 c4 10             	add    $0x10,%esp
+  801e53:	85 c0                	test   %eax,%eax
+  801e55:	78 1c                	js     801e73 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e57:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801e5b:	74 1d                	je     801e7a <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801e5d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e60:	8b 40 18             	mov    0x18(%eax),%eax
+  801e63:	85 c0                	test   %eax,%eax
+  801e65:	74 5e                	je     801ec5 <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801e67:	83 ec 08             	sub    $0x8,%esp
+  801e6a:	ff 75 0c             	push   0xc(%ebp)
+  801e6d:	56                   	push   %esi
+  801e6e:	ff d0                	call   *%eax
+  801e70:	83 c4 10             	add    $0x10,%esp
+}
+  801e73:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e76:	5b                   	pop    %ebx
+  801e77:	5e                   	pop    %esi
+  801e78:	5d                   	pop    %ebp
+  801e79:	c3                   	ret
+  801e7a:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801e7c:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801e82:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801e87:	77 18                	ja     801ea1 <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801e89:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801e8e:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801e90:	c1 e8 10             	shr    $0x10,%eax
+  801e93:	74 0c                	je     801ea1 <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801e95:	c1 e0 10             	shl    $0x10,%eax
+  801e98:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801e9d:	29 c2                	sub    %eax,%edx
+  801e9f:	eb 06                	jmp    801ea7 <ftruncate+0x84>
+		return pthread_main_tls;
+  801ea1:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+			thisenv->env_id, fdnum);
+  801ea7:	8b 02                	mov    (%edx),%eax
+  801ea9:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801eac:	83 ec 04             	sub    $0x4,%esp
+  801eaf:	53                   	push   %ebx
+  801eb0:	50                   	push   %eax
+  801eb1:	68 a4 4f 80 00       	push   $0x804fa4
+  801eb6:	e8 54 e5 ff ff       	call   80040f <cprintf>
+		return -E_INVAL;
+  801ebb:	83 c4 10             	add    $0x10,%esp
+  801ebe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ec3:	eb ae                	jmp    801e73 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801ec5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801eca:	eb a7                	jmp    801e73 <ftruncate+0x50>
+
+00801ecc <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801ecc:	55                   	push   %ebp
+  801ecd:	89 e5                	mov    %esp,%ebp
+  801ecf:	56                   	push   %esi
+  801ed0:	53                   	push   %ebx
+  801ed1:	83 ec 18             	sub    $0x18,%esp
+  801ed4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ed7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801eda:	50                   	push   %eax
+  801edb:	ff 75 08             	push   0x8(%ebp)
+  801ede:	e8 e3 fa ff ff       	call   8019c6 <fd_lookup>
+  801ee3:	83 c4 10             	add    $0x10,%esp
+  801ee6:	85 c0                	test   %eax,%eax
+  801ee8:	78 49                	js     801f33 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801eea:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801eed:	83 ec 08             	sub    $0x8,%esp
+  801ef0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ef3:	50                   	push   %eax
+  801ef4:	ff 36                	push   (%esi)
+  801ef6:	e8 1b fb ff ff       	call   801a16 <dev_lookup>
+  801efb:	83 c4 10             	add    $0x10,%esp
+  801efe:	85 c0                	test   %eax,%eax
+  801f00:	78 31                	js     801f33 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801f02:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f05:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801f09:	74 2f                	je     801f3a <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801f0b:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801f0e:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801f15:	00 00 00 
+	stat->st_isdir = 0;
+  801f18:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801f1f:	00 00 00 
+	stat->st_dev = dev;
+  801f22:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801f28:	83 ec 08             	sub    $0x8,%esp
+  801f2b:	53                   	push   %ebx
+  801f2c:	56                   	push   %esi
+  801f2d:	ff 50 14             	call   *0x14(%eax)
+  801f30:	83 c4 10             	add    $0x10,%esp
+}
+  801f33:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f36:	5b                   	pop    %ebx
+  801f37:	5e                   	pop    %esi
+  801f38:	5d                   	pop    %ebp
+  801f39:	c3                   	ret
+		return -E_NOT_SUPP;
+  801f3a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f3f:	eb f2                	jmp    801f33 <fstat+0x67>
+
+00801f41 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801f41:	55                   	push   %ebp
+  801f42:	89 e5                	mov    %esp,%ebp
+  801f44:	56                   	push   %esi
+  801f45:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801f46:	83 ec 08             	sub    $0x8,%esp
+  801f49:	6a 00                	push   $0x0
+  801f4b:	ff 75 08             	push   0x8(%ebp)
+  801f4e:	e8 4b 03 00 00       	call   80229e <open>
+  801f53:	89 c3                	mov    %eax,%ebx
+  801f55:	83 c4 10             	add    $0x10,%esp
+  801f58:	85 c0                	test   %eax,%eax
+  801f5a:	78 1b                	js     801f77 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801f5c:	83 ec 08             	sub    $0x8,%esp
+  801f5f:	ff 75 0c             	push   0xc(%ebp)
+  801f62:	50                   	push   %eax
+  801f63:	e8 64 ff ff ff       	call   801ecc <fstat>
+  801f68:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801f6a:	89 1c 24             	mov    %ebx,(%esp)
+  801f6d:	e8 a8 fb ff ff       	call   801b1a <close>
+	return r;
+  801f72:	83 c4 10             	add    $0x10,%esp
+  801f75:	89 f3                	mov    %esi,%ebx
+}
+  801f77:	89 d8                	mov    %ebx,%eax
+  801f79:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f7c:	5b                   	pop    %ebx
+  801f7d:	5e                   	pop    %esi
+  801f7e:	5d                   	pop    %ebp
+  801f7f:	c3                   	ret
+
+00801f80 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801f80:	55                   	push   %ebp
+  801f81:	89 e5                	mov    %esp,%ebp
+  801f83:	56                   	push   %esi
+  801f84:	53                   	push   %ebx
+  801f85:	89 c6                	mov    %eax,%esi
+  801f87:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801f89:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  801f90:	74 27                	je     801fb9 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801f92:	6a 07                	push   $0x7
+  801f94:	68 00 80 80 00       	push   $0x808000
+  801f99:	56                   	push   %esi
+  801f9a:	ff 35 00 70 80 00    	push   0x807000
+  801fa0:	e8 3c 26 00 00       	call   8045e1 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801fa5:	83 c4 0c             	add    $0xc,%esp
+  801fa8:	6a 00                	push   $0x0
+  801faa:	53                   	push   %ebx
+  801fab:	6a 00                	push   $0x0
+  801fad:	e8 39 25 00 00       	call   8044eb <ipc_recv>
+}
+  801fb2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fb5:	5b                   	pop    %ebx
+  801fb6:	5e                   	pop    %esi
+  801fb7:	5d                   	pop    %ebp
+  801fb8:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801fb9:	83 ec 0c             	sub    $0xc,%esp
+  801fbc:	6a 01                	push   $0x1
+  801fbe:	e8 74 26 00 00       	call   804637 <ipc_find_env>
+  801fc3:	a3 00 70 80 00       	mov    %eax,0x807000
+  801fc8:	83 c4 10             	add    $0x10,%esp
+  801fcb:	eb c5                	jmp    801f92 <fsipc+0x12>
+
+00801fcd <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801fcd:	55                   	push   %ebp
+  801fce:	89 e5                	mov    %esp,%ebp
+  801fd0:	53                   	push   %ebx
+  801fd1:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801fd4:	68 04 70 80 00       	push   $0x807004
+  801fd9:	e8 29 1b 00 00       	call   803b07 <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801fde:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fe1:	8b 40 0c             	mov    0xc(%eax),%eax
+  801fe4:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.set_size.req_size = newsize;
+  801fe9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fec:	a3 04 80 80 00       	mov    %eax,0x808004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  801ff1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ff6:	b8 02 00 00 00       	mov    $0x2,%eax
+  801ffb:	e8 80 ff ff ff       	call   801f80 <fsipc>
+  802000:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802002:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  802009:	e8 66 1b 00 00       	call   803b74 <mutex_unlock>
+	return r;
+}
+  80200e:	89 d8                	mov    %ebx,%eax
+  802010:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802013:	c9                   	leave
+  802014:	c3                   	ret
+
+00802015 <devfile_flush>:
+{
+  802015:	55                   	push   %ebp
+  802016:	89 e5                	mov    %esp,%ebp
+  802018:	53                   	push   %ebx
+  802019:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  80201c:	68 04 70 80 00       	push   $0x807004
+  802021:	e8 e1 1a 00 00       	call   803b07 <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802026:	8b 45 08             	mov    0x8(%ebp),%eax
+  802029:	8b 40 0c             	mov    0xc(%eax),%eax
+  80202c:	a3 00 80 80 00       	mov    %eax,0x808000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  802031:	ba 00 00 00 00       	mov    $0x0,%edx
+  802036:	b8 06 00 00 00       	mov    $0x6,%eax
+  80203b:	e8 40 ff ff ff       	call   801f80 <fsipc>
+  802040:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802042:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  802049:	e8 26 1b 00 00       	call   803b74 <mutex_unlock>
+}
+  80204e:	89 d8                	mov    %ebx,%eax
+  802050:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802053:	c9                   	leave
+  802054:	c3                   	ret
+
+00802055 <devfile_stat>:
+{
+  802055:	55                   	push   %ebp
+  802056:	89 e5                	mov    %esp,%ebp
+  802058:	56                   	push   %esi
+  802059:	53                   	push   %ebx
+  80205a:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  80205d:	83 ec 0c             	sub    $0xc,%esp
+  802060:	68 04 70 80 00       	push   $0x807004
+  802065:	e8 9d 1a 00 00       	call   803b07 <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80206a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80206d:	8b 40 0c             	mov    0xc(%eax),%eax
+  802070:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  802075:	ba 00 00 00 00       	mov    $0x0,%edx
+  80207a:	b8 05 00 00 00       	mov    $0x5,%eax
+  80207f:	e8 fc fe ff ff       	call   801f80 <fsipc>
+  802084:	89 c3                	mov    %eax,%ebx
+  802086:	83 c4 10             	add    $0x10,%esp
+  802089:	85 c0                	test   %eax,%eax
+  80208b:	79 16                	jns    8020a3 <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  80208d:	83 ec 0c             	sub    $0xc,%esp
+  802090:	68 04 70 80 00       	push   $0x807004
+  802095:	e8 da 1a 00 00       	call   803b74 <mutex_unlock>
+}
+  80209a:	89 d8                	mov    %ebx,%eax
+  80209c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80209f:	5b                   	pop    %ebx
+  8020a0:	5e                   	pop    %esi
+  8020a1:	5d                   	pop    %ebp
+  8020a2:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8020a3:	83 ec 08             	sub    $0x8,%esp
+  8020a6:	68 00 80 80 00       	push   $0x808000
+  8020ab:	56                   	push   %esi
+  8020ac:	e8 42 e9 ff ff       	call   8009f3 <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  8020b1:	a1 80 80 80 00       	mov    0x808080,%eax
+  8020b6:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8020bc:	a1 84 80 80 00       	mov    0x808084,%eax
+  8020c1:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  8020c7:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  8020ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020cf:	eb bc                	jmp    80208d <devfile_stat+0x38>
+
+008020d1 <devfile_write>:
+{
+  8020d1:	55                   	push   %ebp
+  8020d2:	89 e5                	mov    %esp,%ebp
+  8020d4:	53                   	push   %ebx
+  8020d5:	83 ec 10             	sub    $0x10,%esp
+  8020d8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  8020db:	68 04 70 80 00       	push   $0x807004
+  8020e0:	e8 22 1a 00 00       	call   803b07 <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8020e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020e8:	8b 40 0c             	mov    0xc(%eax),%eax
+  8020eb:	a3 00 80 80 00       	mov    %eax,0x808000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  8020f0:	83 c4 10             	add    $0x10,%esp
+  8020f3:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  8020f9:	76 3d                	jbe    802138 <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  8020fb:	b8 00 00 10 00       	mov    $0x100000,%eax
+  802100:	39 c3                	cmp    %eax,%ebx
+  802102:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  802105:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802108:	a3 08 80 80 00       	mov    %eax,0x808008
+	fsipcbuf.write.req_n = n;
+  80210d:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	r = fsipc(FSREQ_WRITE, NULL);
+  802113:	ba 00 00 00 00       	mov    $0x0,%edx
+  802118:	b8 04 00 00 00       	mov    $0x4,%eax
+  80211d:	e8 5e fe ff ff       	call   801f80 <fsipc>
+  802122:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802124:	83 ec 0c             	sub    $0xc,%esp
+  802127:	68 04 70 80 00       	push   $0x807004
+  80212c:	e8 43 1a 00 00       	call   803b74 <mutex_unlock>
+}
+  802131:	89 d8                	mov    %ebx,%eax
+  802133:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802136:	c9                   	leave
+  802137:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  802138:	83 ec 04             	sub    $0x4,%esp
+  80213b:	53                   	push   %ebx
+  80213c:	ff 75 0c             	push   0xc(%ebp)
+  80213f:	68 0c 80 80 00       	push   $0x80800c
+  802144:	e8 30 ea ff ff       	call   800b79 <memmove>
+  802149:	83 c4 10             	add    $0x10,%esp
+  80214c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802151:	eb b5                	jmp    802108 <devfile_write+0x37>
+
+00802153 <devfile_read>:
+{
+  802153:	55                   	push   %ebp
+  802154:	89 e5                	mov    %esp,%ebp
+  802156:	57                   	push   %edi
+  802157:	56                   	push   %esi
+  802158:	53                   	push   %ebx
+  802159:	83 ec 0c             	sub    $0xc,%esp
+  80215c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80215f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802162:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  802165:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  80216b:	0f 86 8c 00 00 00    	jbe    8021fd <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  802171:	b8 00 00 10 00       	mov    $0x100000,%eax
+  802176:	39 c3                	cmp    %eax,%ebx
+  802178:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  80217b:	89 f8                	mov    %edi,%eax
+  80217d:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  802180:	eb 0f                	jmp    802191 <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  802182:	0f b6 08             	movzbl (%eax),%ecx
+  802185:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  802187:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80218c:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  802191:	39 d0                	cmp    %edx,%eax
+  802193:	72 ed                	jb     802182 <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  802195:	83 ec 0c             	sub    $0xc,%esp
+  802198:	68 04 70 80 00       	push   $0x807004
+  80219d:	e8 65 19 00 00       	call   803b07 <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8021a2:	8b 46 0c             	mov    0xc(%esi),%eax
+  8021a5:	a3 00 80 80 00       	mov    %eax,0x808000
+		fsipcbuf.read.req_n = n;
+  8021aa:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  8021b0:	89 3d 08 80 80 00    	mov    %edi,0x808008
+		r = fsipc(FSREQ_READ, NULL);
+  8021b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021bb:	b8 03 00 00 00       	mov    $0x3,%eax
+  8021c0:	e8 bb fd ff ff       	call   801f80 <fsipc>
+  8021c5:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  8021c7:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  8021ce:	e8 a1 19 00 00       	call   803b74 <mutex_unlock>
+		assert(r <= (int) n);
+  8021d3:	83 c4 10             	add    $0x10,%esp
+  8021d6:	39 f3                	cmp    %esi,%ebx
+  8021d8:	7c 0a                	jl     8021e4 <devfile_read+0x91>
+}
+  8021da:	89 f0                	mov    %esi,%eax
+  8021dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021df:	5b                   	pop    %ebx
+  8021e0:	5e                   	pop    %esi
+  8021e1:	5f                   	pop    %edi
+  8021e2:	5d                   	pop    %ebp
+  8021e3:	c3                   	ret
+		assert(r <= (int) n);
+  8021e4:	68 14 50 80 00       	push   $0x805014
+  8021e9:	68 51 4f 80 00       	push   $0x804f51
+  8021ee:	68 90 00 00 00       	push   $0x90
+  8021f3:	68 21 50 80 00       	push   $0x805021
+  8021f8:	e8 37 e1 ff ff       	call   800334 <_panic>
+	mutex_lock(&fsipc_mu);
+  8021fd:	83 ec 0c             	sub    $0xc,%esp
+  802200:	68 04 70 80 00       	push   $0x807004
+  802205:	e8 fd 18 00 00       	call   803b07 <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80220a:	8b 46 0c             	mov    0xc(%esi),%eax
+  80220d:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.read.req_n = n;
+  802212:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	fsipcbuf.read.req_va = 0;
+  802218:	c7 05 08 80 80 00 00 	movl   $0x0,0x808008
+  80221f:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  802222:	ba 00 00 00 00       	mov    $0x0,%edx
+  802227:	b8 03 00 00 00       	mov    $0x3,%eax
+  80222c:	e8 4f fd ff ff       	call   801f80 <fsipc>
+  802231:	89 c6                	mov    %eax,%esi
+  802233:	83 c4 10             	add    $0x10,%esp
+  802236:	85 c0                	test   %eax,%eax
+  802238:	78 1d                	js     802257 <devfile_read+0x104>
+		assert(r <= n);
+  80223a:	39 c3                	cmp    %eax,%ebx
+  80223c:	72 2e                	jb     80226c <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  80223e:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802243:	7f 40                	jg     802285 <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  802245:	83 ec 04             	sub    $0x4,%esp
+  802248:	50                   	push   %eax
+  802249:	68 00 80 80 00       	push   $0x808000
+  80224e:	57                   	push   %edi
+  80224f:	e8 25 e9 ff ff       	call   800b79 <memmove>
+  802254:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  802257:	83 ec 0c             	sub    $0xc,%esp
+  80225a:	68 04 70 80 00       	push   $0x807004
+  80225f:	e8 10 19 00 00       	call   803b74 <mutex_unlock>
+	return r;
+  802264:	83 c4 10             	add    $0x10,%esp
+  802267:	e9 6e ff ff ff       	jmp    8021da <devfile_read+0x87>
+		assert(r <= n);
+  80226c:	68 2c 50 80 00       	push   $0x80502c
+  802271:	68 51 4f 80 00       	push   $0x804f51
+  802276:	68 99 00 00 00       	push   $0x99
+  80227b:	68 21 50 80 00       	push   $0x805021
+  802280:	e8 af e0 ff ff       	call   800334 <_panic>
+		assert(r <= PGSIZE);
+  802285:	68 33 50 80 00       	push   $0x805033
+  80228a:	68 51 4f 80 00       	push   $0x804f51
+  80228f:	68 9a 00 00 00       	push   $0x9a
+  802294:	68 21 50 80 00       	push   $0x805021
+  802299:	e8 96 e0 ff ff       	call   800334 <_panic>
+
+0080229e <open>:
+{
+  80229e:	55                   	push   %ebp
+  80229f:	89 e5                	mov    %esp,%ebp
+  8022a1:	56                   	push   %esi
+  8022a2:	53                   	push   %ebx
+  8022a3:	83 ec 1c             	sub    $0x1c,%esp
+  8022a6:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  8022a9:	56                   	push   %esi
+  8022aa:	e8 09 e7 ff ff       	call   8009b8 <strlen>
+  8022af:	83 c4 10             	add    $0x10,%esp
+  8022b2:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8022b7:	0f 8f 85 00 00 00    	jg     802342 <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  8022bd:	83 ec 0c             	sub    $0xc,%esp
+  8022c0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022c3:	50                   	push   %eax
+  8022c4:	e8 a7 f6 ff ff       	call   801970 <fd_alloc>
+  8022c9:	89 c3                	mov    %eax,%ebx
+  8022cb:	83 c4 10             	add    $0x10,%esp
+  8022ce:	85 c0                	test   %eax,%eax
+  8022d0:	78 55                	js     802327 <open+0x89>
+	mutex_lock(&fsipc_mu);
+  8022d2:	83 ec 0c             	sub    $0xc,%esp
+  8022d5:	68 04 70 80 00       	push   $0x807004
+  8022da:	e8 28 18 00 00       	call   803b07 <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  8022df:	83 c4 08             	add    $0x8,%esp
+  8022e2:	56                   	push   %esi
+  8022e3:	68 00 80 80 00       	push   $0x808000
+  8022e8:	e8 06 e7 ff ff       	call   8009f3 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8022ed:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022f0:	a3 00 84 80 00       	mov    %eax,0x808400
+	r = fsipc(FSREQ_OPEN, fd);
+  8022f5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8022f8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022fd:	e8 7e fc ff ff       	call   801f80 <fsipc>
+  802302:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802304:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  80230b:	e8 64 18 00 00       	call   803b74 <mutex_unlock>
+	if (r < 0) {
+  802310:	83 c4 10             	add    $0x10,%esp
+  802313:	85 db                	test   %ebx,%ebx
+  802315:	78 19                	js     802330 <open+0x92>
+	return fd2num(fd);
+  802317:	83 ec 0c             	sub    $0xc,%esp
+  80231a:	ff 75 f4             	push   -0xc(%ebp)
+  80231d:	e8 27 f6 ff ff       	call   801949 <fd2num>
+  802322:	89 c3                	mov    %eax,%ebx
+  802324:	83 c4 10             	add    $0x10,%esp
+}
+  802327:	89 d8                	mov    %ebx,%eax
+  802329:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80232c:	5b                   	pop    %ebx
+  80232d:	5e                   	pop    %esi
+  80232e:	5d                   	pop    %ebp
+  80232f:	c3                   	ret
+		fd_close(fd, 0);
+  802330:	83 ec 08             	sub    $0x8,%esp
+  802333:	6a 00                	push   $0x0
+  802335:	ff 75 f4             	push   -0xc(%ebp)
+  802338:	e8 56 f7 ff ff       	call   801a93 <fd_close>
+		return r;
+  80233d:	83 c4 10             	add    $0x10,%esp
+  802340:	eb e5                	jmp    802327 <open+0x89>
+		return -E_BAD_PATH;
+  802342:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802347:	eb de                	jmp    802327 <open+0x89>
+
+00802349 <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  802349:	55                   	push   %ebp
+  80234a:	89 e5                	mov    %esp,%ebp
+  80234c:	53                   	push   %ebx
+  80234d:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802350:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802353:	50                   	push   %eax
+  802354:	ff 75 08             	push   0x8(%ebp)
+  802357:	e8 6a f6 ff ff       	call   8019c6 <fd_lookup>
+  80235c:	89 c3                	mov    %eax,%ebx
+  80235e:	83 c4 10             	add    $0x10,%esp
+  802361:	85 c0                	test   %eax,%eax
+  802363:	78 5b                	js     8023c0 <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  802365:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802368:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  80236e:	39 08                	cmp    %ecx,(%eax)
+  802370:	75 55                	jne    8023c7 <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  802372:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802376:	74 56                	je     8023ce <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  802378:	83 ec 0c             	sub    $0xc,%esp
+  80237b:	68 04 70 80 00       	push   $0x807004
+  802380:	e8 82 17 00 00       	call   803b07 <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  802385:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802388:	8b 40 0c             	mov    0xc(%eax),%eax
+  80238b:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.allocate.req_offset = offset;
+  802390:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802393:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.allocate.req_len = len;
+  802398:	8b 45 10             	mov    0x10(%ebp),%eax
+  80239b:	a3 08 80 80 00       	mov    %eax,0x808008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  8023a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023a5:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8023aa:	e8 d1 fb ff ff       	call   801f80 <fsipc>
+  8023af:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8023b1:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  8023b8:	e8 b7 17 00 00       	call   803b74 <mutex_unlock>
+	return r;
+  8023bd:	83 c4 10             	add    $0x10,%esp
+}
+  8023c0:	89 d8                	mov    %ebx,%eax
+  8023c2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023c5:	c9                   	leave
+  8023c6:	c3                   	ret
+		return -E_NOT_SUPP;
+  8023c7:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8023cc:	eb f2                	jmp    8023c0 <fallocate+0x77>
+		return -E_INVAL;
+  8023ce:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8023d3:	eb eb                	jmp    8023c0 <fallocate+0x77>
+
+008023d5 <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  8023d5:	55                   	push   %ebp
+  8023d6:	89 e5                	mov    %esp,%ebp
+  8023d8:	56                   	push   %esi
+  8023d9:	53                   	push   %ebx
+  8023da:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  8023dd:	89 f3                	mov    %esi,%ebx
+  8023df:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  8023e5:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  8023e8:	eb 06                	jmp    8023f0 <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  8023ea:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8023f0:	39 f3                	cmp    %esi,%ebx
+  8023f2:	73 14                	jae    802408 <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  8023f4:	83 ec 08             	sub    $0x8,%esp
+  8023f7:	53                   	push   %ebx
+  8023f8:	6a 00                	push   $0x0
+  8023fa:	e8 cb ea ff ff       	call   800eca <sys_page_unmap>
+  8023ff:	83 c4 10             	add    $0x10,%esp
+  802402:	85 c0                	test   %eax,%eax
+  802404:	79 e4                	jns    8023ea <munmap+0x15>
+  802406:	eb 05                	jmp    80240d <munmap+0x38>
+			return r;
+	return 0;
+  802408:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80240d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802410:	5b                   	pop    %ebx
+  802411:	5e                   	pop    %esi
+  802412:	5d                   	pop    %ebp
+  802413:	c3                   	ret
+
+00802414 <mmap>:
+{
+  802414:	55                   	push   %ebp
+  802415:	89 e5                	mov    %esp,%ebp
+  802417:	57                   	push   %edi
+  802418:	56                   	push   %esi
+  802419:	53                   	push   %ebx
+  80241a:	83 ec 24             	sub    $0x24,%esp
+  80241d:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802420:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802423:	50                   	push   %eax
+  802424:	ff 75 08             	push   0x8(%ebp)
+  802427:	e8 9a f5 ff ff       	call   8019c6 <fd_lookup>
+  80242c:	83 c4 10             	add    $0x10,%esp
+  80242f:	85 c0                	test   %eax,%eax
+  802431:	0f 88 37 01 00 00    	js     80256e <mmap+0x15a>
+		return NULL;
+  802437:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  80243c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80243f:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  802445:	39 0a                	cmp    %ecx,(%edx)
+  802447:	0f 85 05 01 00 00    	jne    802552 <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  80244d:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  802454:	0f 85 1b 01 00 00    	jne    802575 <mmap+0x161>
+  80245a:	89 f0                	mov    %esi,%eax
+  80245c:	83 e8 01             	sub    $0x1,%eax
+  80245f:	0f 88 17 01 00 00    	js     80257c <mmap+0x168>
+	if (prot & PROT_WRITE)
+  802465:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  802469:	75 28                	jne    802493 <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  80246b:	83 ec 0c             	sub    $0xc,%esp
+  80246e:	68 04 70 80 00       	push   $0x807004
+  802473:	e8 8f 16 00 00       	call   803b07 <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  802478:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  80247e:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  802484:	83 c4 10             	add    $0x10,%esp
+  802487:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  80248c:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  802491:	eb 2b                	jmp    8024be <mmap+0xaa>
+		cow_enable();
+  802493:	e8 40 f0 ff ff       	call   8014d8 <cow_enable>
+  802498:	eb d1                	jmp    80246b <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  80249a:	89 c2                	mov    %eax,%edx
+  80249c:	c1 ea 0c             	shr    $0xc,%edx
+  80249f:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  8024a6:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8024ac:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  8024b2:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  8024b5:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  8024b7:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  8024bc:	77 25                	ja     8024e3 <mmap+0xcf>
+  8024be:	89 c2                	mov    %eax,%edx
+  8024c0:	29 da                	sub    %ebx,%edx
+  8024c2:	39 ca                	cmp    %ecx,%edx
+  8024c4:	73 3a                	jae    802500 <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  8024c6:	89 c2                	mov    %eax,%edx
+  8024c8:	c1 ea 16             	shr    $0x16,%edx
+  8024cb:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8024d2:	f6 c2 01             	test   $0x1,%dl
+  8024d5:	75 c3                	jne    80249a <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  8024d7:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  8024dc:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  8024e1:	eb d4                	jmp    8024b7 <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  8024e3:	29 d8                	sub    %ebx,%eax
+  8024e5:	39 c8                	cmp    %ecx,%eax
+  8024e7:	73 17                	jae    802500 <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  8024e9:	83 ec 0c             	sub    $0xc,%esp
+  8024ec:	68 04 70 80 00       	push   $0x807004
+  8024f1:	e8 7e 16 00 00       	call   803b74 <mutex_unlock>
+		return NULL;
+  8024f6:	83 c4 10             	add    $0x10,%esp
+  8024f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024fe:	eb 52                	jmp    802552 <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  802500:	85 db                	test   %ebx,%ebx
+  802502:	74 e5                	je     8024e9 <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802504:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802507:	8b 40 0c             	mov    0xc(%eax),%eax
+  80250a:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.map.req_offset = offset;
+  80250f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802512:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.map.req_len = len;
+  802517:	89 35 08 80 80 00    	mov    %esi,0x808008
+	fsipcbuf.map.req_va = va;
+  80251d:	89 1d 0c 80 80 00    	mov    %ebx,0x80800c
+	fsipcbuf.map.req_prot = prot;
+  802523:	8b 45 14             	mov    0x14(%ebp),%eax
+  802526:	a3 10 80 80 00       	mov    %eax,0x808010
+	r = fsipc(FSREQ_MAP, NULL);
+  80252b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802530:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802535:	e8 46 fa ff ff       	call   801f80 <fsipc>
+  80253a:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  80253c:	83 ec 0c             	sub    $0xc,%esp
+  80253f:	68 04 70 80 00       	push   $0x807004
+  802544:	e8 2b 16 00 00       	call   803b74 <mutex_unlock>
+	if (r < 0) {
+  802549:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  80254c:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  80254e:	85 ff                	test   %edi,%edi
+  802550:	78 08                	js     80255a <mmap+0x146>
+}
+  802552:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802555:	5b                   	pop    %ebx
+  802556:	5e                   	pop    %esi
+  802557:	5f                   	pop    %edi
+  802558:	5d                   	pop    %ebp
+  802559:	c3                   	ret
+		munmap((void*) va, len);
+  80255a:	83 ec 08             	sub    $0x8,%esp
+  80255d:	56                   	push   %esi
+  80255e:	53                   	push   %ebx
+  80255f:	e8 71 fe ff ff       	call   8023d5 <munmap>
+		return NULL;
+  802564:	83 c4 10             	add    $0x10,%esp
+  802567:	b8 00 00 00 00       	mov    $0x0,%eax
+  80256c:	eb e4                	jmp    802552 <mmap+0x13e>
+		return NULL;
+  80256e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802573:	eb dd                	jmp    802552 <mmap+0x13e>
+		return NULL;
+  802575:	b8 00 00 00 00       	mov    $0x0,%eax
+  80257a:	eb d6                	jmp    802552 <mmap+0x13e>
+  80257c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802581:	eb cf                	jmp    802552 <mmap+0x13e>
+
+00802583 <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  802583:	55                   	push   %ebp
+  802584:	89 e5                	mov    %esp,%ebp
+  802586:	53                   	push   %ebx
+  802587:	83 ec 10             	sub    $0x10,%esp
+  80258a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  80258d:	53                   	push   %ebx
+  80258e:	e8 25 e4 ff ff       	call   8009b8 <strlen>
+  802593:	83 c4 10             	add    $0x10,%esp
+  802596:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80259b:	7f 42                	jg     8025df <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  80259d:	83 ec 0c             	sub    $0xc,%esp
+  8025a0:	68 04 70 80 00       	push   $0x807004
+  8025a5:	e8 5d 15 00 00       	call   803b07 <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  8025aa:	83 c4 08             	add    $0x8,%esp
+  8025ad:	53                   	push   %ebx
+  8025ae:	68 00 80 80 00       	push   $0x808000
+  8025b3:	e8 3b e4 ff ff       	call   8009f3 <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  8025b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025bd:	b8 07 00 00 00       	mov    $0x7,%eax
+  8025c2:	e8 b9 f9 ff ff       	call   801f80 <fsipc>
+  8025c7:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8025c9:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  8025d0:	e8 9f 15 00 00       	call   803b74 <mutex_unlock>
+	return r;
+  8025d5:	83 c4 10             	add    $0x10,%esp
+}
+  8025d8:	89 d8                	mov    %ebx,%eax
+  8025da:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025dd:	c9                   	leave
+  8025de:	c3                   	ret
+		return -E_BAD_PATH;
+  8025df:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8025e4:	eb f2                	jmp    8025d8 <remove+0x55>
+
+008025e6 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8025e6:	55                   	push   %ebp
+  8025e7:	89 e5                	mov    %esp,%ebp
+  8025e9:	53                   	push   %ebx
+  8025ea:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  8025ed:	68 04 70 80 00       	push   $0x807004
+  8025f2:	e8 10 15 00 00       	call   803b07 <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  8025f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025fc:	b8 08 00 00 00       	mov    $0x8,%eax
+  802601:	e8 7a f9 ff ff       	call   801f80 <fsipc>
+  802606:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802608:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  80260f:	e8 60 15 00 00       	call   803b74 <mutex_unlock>
+	return r;
+}
+  802614:	89 d8                	mov    %ebx,%eax
+  802616:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802619:	c9                   	leave
+  80261a:	c3                   	ret
+
+0080261b <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  80261b:	55                   	push   %ebp
+  80261c:	89 e5                	mov    %esp,%ebp
+  80261e:	56                   	push   %esi
+  80261f:	53                   	push   %ebx
+  802620:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  802623:	83 ec 0c             	sub    $0xc,%esp
+  802626:	68 04 70 80 00       	push   $0x807004
+  80262b:	e8 d7 14 00 00       	call   803b07 <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  802630:	8b 45 08             	mov    0x8(%ebp),%eax
+  802633:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  802638:	ba 00 00 00 00       	mov    $0x0,%edx
+  80263d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802642:	e8 39 f9 ff ff       	call   801f80 <fsipc>
+  802647:	89 c6                	mov    %eax,%esi
+  802649:	83 c4 10             	add    $0x10,%esp
+  80264c:	85 db                	test   %ebx,%ebx
+  80264e:	74 7b                	je     8026cb <fs_bcstat+0xb0>
+  802650:	85 c0                	test   %eax,%eax
+  802652:	78 77                	js     8026cb <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  802654:	a1 00 80 80 00       	mov    0x808000,%eax
+  802659:	89 03                	mov    %eax,(%ebx)
+  80265b:	a1 04 80 80 00       	mov    0x808004,%eax
+  802660:	89 43 04             	mov    %eax,0x4(%ebx)
+  802663:	a1 08 80 80 00       	mov    0x808008,%eax
+  802668:	89 43 08             	mov    %eax,0x8(%ebx)
+  80266b:	a1 0c 80 80 00       	mov    0x80800c,%eax
+  802670:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802673:	a1 10 80 80 00       	mov    0x808010,%eax
+  802678:	89 43 10             	mov    %eax,0x10(%ebx)
+  80267b:	a1 14 80 80 00       	mov    0x808014,%eax
+  802680:	89 43 14             	mov    %eax,0x14(%ebx)
+  802683:	a1 18 80 80 00       	mov    0x808018,%eax
+  802688:	89 43 18             	mov    %eax,0x18(%ebx)
+  80268b:	a1 1c 80 80 00       	mov    0x80801c,%eax
+  802690:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  802693:	a1 20 80 80 00       	mov    0x808020,%eax
+  802698:	89 43 20             	mov    %eax,0x20(%ebx)
+  80269b:	a1 24 80 80 00       	mov    0x808024,%eax
+  8026a0:	89 43 24             	mov    %eax,0x24(%ebx)
+  8026a3:	a1 28 80 80 00       	mov    0x808028,%eax
+  8026a8:	89 43 28             	mov    %eax,0x28(%ebx)
+  8026ab:	a1 2c 80 80 00       	mov    0x80802c,%eax
+  8026b0:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  8026b3:	a1 30 80 80 00       	mov    0x808030,%eax
+  8026b8:	89 43 30             	mov    %eax,0x30(%ebx)
+  8026bb:	a1 34 80 80 00       	mov    0x808034,%eax
+  8026c0:	89 43 34             	mov    %eax,0x34(%ebx)
+  8026c3:	a1 38 80 80 00       	mov    0x808038,%eax
+  8026c8:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  8026cb:	83 ec 0c             	sub    $0xc,%esp
+  8026ce:	68 04 70 80 00       	push   $0x807004
+  8026d3:	e8 9c 14 00 00       	call   803b74 <mutex_unlock>
+	return r;
+}
+  8026d8:	89 f0                	mov    %esi,%eax
+  8026da:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026dd:	5b                   	pop    %ebx
+  8026de:	5e                   	pop    %esi
+  8026df:	5d                   	pop    %ebp
+  8026e0:	c3                   	ret
+
+008026e1 <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  8026e1:	55                   	push   %ebp
+  8026e2:	89 e5                	mov    %esp,%ebp
+  8026e4:	56                   	push   %esi
+  8026e5:	53                   	push   %ebx
+  8026e6:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  8026e8:	0f b6 10             	movzbl (%eax),%edx
+  8026eb:	80 fa 72             	cmp    $0x72,%dl
+  8026ee:	74 44                	je     802734 <parse_mode+0x53>
+  8026f0:	80 fa 77             	cmp    $0x77,%dl
+  8026f3:	74 4b                	je     802740 <parse_mode+0x5f>
+  8026f5:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8026fa:	80 fa 61             	cmp    $0x61,%dl
+  8026fd:	74 09                	je     802708 <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  8026ff:	89 d8                	mov    %ebx,%eax
+  802701:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802704:	5b                   	pop    %ebx
+  802705:	5e                   	pop    %esi
+  802706:	5d                   	pop    %ebp
+  802707:	c3                   	ret
+	switch (mode[0]) {
+  802708:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  80270d:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  802712:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  802714:	83 ec 08             	sub    $0x8,%esp
+  802717:	6a 2b                	push   $0x2b
+  802719:	50                   	push   %eax
+  80271a:	e8 e6 e3 ff ff       	call   800b05 <strchr>
+  80271f:	83 c4 10             	add    $0x10,%esp
+  802722:	85 c0                	test   %eax,%eax
+  802724:	74 d9                	je     8026ff <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  802726:	83 e3 fc             	and    $0xfffffffc,%ebx
+  802729:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  80272c:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  802732:	eb cb                	jmp    8026ff <parse_mode+0x1e>
+	switch (mode[0]) {
+  802734:	ba 01 00 00 00       	mov    $0x1,%edx
+  802739:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80273e:	eb d2                	jmp    802712 <parse_mode+0x31>
+  802740:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  802745:	bb 01 03 00 00       	mov    $0x301,%ebx
+  80274a:	eb c6                	jmp    802712 <parse_mode+0x31>
+
+0080274c <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  80274c:	55                   	push   %ebp
+  80274d:	89 e5                	mov    %esp,%ebp
+  80274f:	57                   	push   %edi
+  802750:	56                   	push   %esi
+  802751:	53                   	push   %ebx
+  802752:	83 ec 1c             	sub    $0x1c,%esp
+  802755:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802758:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  80275b:	b8 24 60 80 00       	mov    $0x806024,%eax
+  802760:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  802765:	83 c0 24             	add    $0x24,%eax
+  802768:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  80276c:	74 17                	je     802785 <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  80276e:	83 c3 01             	add    $0x1,%ebx
+  802771:	83 fb 10             	cmp    $0x10,%ebx
+  802774:	75 ef                	jne    802765 <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  802776:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  80277b:	89 f0                	mov    %esi,%eax
+  80277d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802780:	5b                   	pop    %ebx
+  802781:	5e                   	pop    %esi
+  802782:	5f                   	pop    %edi
+  802783:	5d                   	pop    %ebp
+  802784:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  802785:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  80278c:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80278f:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  802792:	c1 e7 02             	shl    $0x2,%edi
+  802795:	8d b7 20 60 80 00    	lea    0x806020(%edi),%esi
+  80279b:	83 ec 04             	sub    $0x4,%esp
+  80279e:	6a 24                	push   $0x24
+  8027a0:	6a 00                	push   $0x0
+  8027a2:	56                   	push   %esi
+  8027a3:	e8 9c e3 ff ff       	call   800b44 <memset>
+			streams[i].f_fd = fd;
+  8027a8:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8027ab:	89 8f 20 60 80 00    	mov    %ecx,0x806020(%edi)
+			streams[i].f_flags = flags;
+  8027b1:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8027b4:	01 d8                	add    %ebx,%eax
+  8027b6:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8027b9:	89 0c 85 24 60 80 00 	mov    %ecx,0x806024(,%eax,4)
+			return &streams[i];
+  8027c0:	83 c4 10             	add    $0x10,%esp
+  8027c3:	eb b6                	jmp    80277b <stream_alloc+0x2f>
+
+008027c5 <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  8027c5:	55                   	push   %ebp
+  8027c6:	89 e5                	mov    %esp,%ebp
+  8027c8:	53                   	push   %ebx
+  8027c9:	83 ec 14             	sub    $0x14,%esp
+  8027cc:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  8027ce:	8b 40 18             	mov    0x18(%eax),%eax
+  8027d1:	39 43 14             	cmp    %eax,0x14(%ebx)
+  8027d4:	74 4a                	je     802820 <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  8027d6:	83 ec 08             	sub    $0x8,%esp
+  8027d9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8027dc:	50                   	push   %eax
+  8027dd:	ff 33                	push   (%ebx)
+  8027df:	e8 e2 f1 ff ff       	call   8019c6 <fd_lookup>
+  8027e4:	89 c2                	mov    %eax,%edx
+  8027e6:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8027e9:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  8027ee:	85 d2                	test   %edx,%edx
+  8027f0:	78 41                	js     802833 <stream_unread+0x6e>
+  8027f2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8027f5:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  8027fb:	39 0a                	cmp    %ecx,(%edx)
+  8027fd:	75 34                	jne    802833 <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  8027ff:	8b 43 14             	mov    0x14(%ebx),%eax
+  802802:	03 42 04             	add    0x4(%edx),%eax
+  802805:	2b 43 18             	sub    0x18(%ebx),%eax
+  802808:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  80280b:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  802812:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  802819:	b8 01 00 00 00       	mov    $0x1,%eax
+  80281e:	eb 13                	jmp    802833 <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  802820:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  802827:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  80282e:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802833:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802836:	c9                   	leave
+  802837:	c3                   	ret
+
+00802838 <stream_drain>:
+{
+  802838:	55                   	push   %ebp
+  802839:	89 e5                	mov    %esp,%ebp
+  80283b:	56                   	push   %esi
+  80283c:	53                   	push   %ebx
+  80283d:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  80283f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802844:	eb 02                	jmp    802848 <stream_drain+0x10>
+  802846:	01 c3                	add    %eax,%ebx
+  802848:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80284b:	39 c3                	cmp    %eax,%ebx
+  80284d:	73 43                	jae    802892 <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  80284f:	83 ec 04             	sub    $0x4,%esp
+  802852:	29 d8                	sub    %ebx,%eax
+  802854:	50                   	push   %eax
+  802855:	89 d8                	mov    %ebx,%eax
+  802857:	03 46 0c             	add    0xc(%esi),%eax
+  80285a:	50                   	push   %eax
+  80285b:	ff 36                	push   (%esi)
+  80285d:	e8 ec f4 ff ff       	call   801d4e <write>
+  802862:	83 c4 10             	add    $0x10,%esp
+  802865:	85 c0                	test   %eax,%eax
+  802867:	7f dd                	jg     802846 <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  802869:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  80286d:	8b 56 0c             	mov    0xc(%esi),%edx
+  802870:	83 ec 04             	sub    $0x4,%esp
+  802873:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802876:	29 d8                	sub    %ebx,%eax
+  802878:	50                   	push   %eax
+  802879:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  80287c:	50                   	push   %eax
+  80287d:	52                   	push   %edx
+  80287e:	e8 f6 e2 ff ff       	call   800b79 <memmove>
+			f->f_wend -= done;
+  802883:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802886:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  802888:	83 c4 10             	add    $0x10,%esp
+  80288b:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  802890:	eb 0a                	jmp    80289c <stream_drain+0x64>
+  802892:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  802897:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  80289c:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  80289f:	89 d0                	mov    %edx,%eax
+  8028a1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028a4:	5b                   	pop    %ebx
+  8028a5:	5e                   	pop    %esi
+  8028a6:	5d                   	pop    %ebp
+  8028a7:	c3                   	ret
+
+008028a8 <stream_setup>:
+	if (f->f_buf)
+  8028a8:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8028ac:	74 01                	je     8028af <stream_setup+0x7>
+  8028ae:	c3                   	ret
+{
+  8028af:	55                   	push   %ebp
+  8028b0:	89 e5                	mov    %esp,%ebp
+  8028b2:	53                   	push   %ebx
+  8028b3:	83 ec 04             	sub    $0x4,%esp
+  8028b6:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  8028b8:	8b 40 08             	mov    0x8(%eax),%eax
+  8028bb:	85 c0                	test   %eax,%eax
+  8028bd:	74 17                	je     8028d6 <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  8028bf:	83 f8 03             	cmp    $0x3,%eax
+  8028c2:	75 2d                	jne    8028f1 <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  8028c4:	8d 43 20             	lea    0x20(%ebx),%eax
+  8028c7:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  8028ca:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  8028d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028d4:	c9                   	leave
+  8028d5:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  8028d6:	83 ec 0c             	sub    $0xc,%esp
+  8028d9:	ff 33                	push   (%ebx)
+  8028db:	e8 29 1b 00 00       	call   804409 <iscons>
+  8028e0:	83 c4 10             	add    $0x10,%esp
+  8028e3:	85 c0                	test   %eax,%eax
+  8028e5:	0f 9f c0             	setg   %al
+  8028e8:	0f b6 c0             	movzbl %al,%eax
+  8028eb:	83 c0 01             	add    $0x1,%eax
+  8028ee:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  8028f1:	83 ec 0c             	sub    $0xc,%esp
+  8028f4:	68 00 10 00 00       	push   $0x1000
+  8028f9:	e8 6e 0b 00 00       	call   80346c <malloc>
+  8028fe:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802901:	83 c4 10             	add    $0x10,%esp
+  802904:	85 c0                	test   %eax,%eax
+  802906:	74 bc                	je     8028c4 <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  802908:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  80290f:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  802913:	eb bc                	jmp    8028d1 <stream_setup+0x29>
+
+00802915 <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  802915:	55                   	push   %ebp
+  802916:	89 e5                	mov    %esp,%ebp
+  802918:	53                   	push   %ebx
+  802919:	83 ec 04             	sub    $0x4,%esp
+  80291c:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  80291e:	e8 85 ff ff ff       	call   8028a8 <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  802923:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  802928:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  80292c:	74 3d                	je     80296b <stream_fill+0x56>
+  80292e:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  802932:	74 10                	je     802944 <stream_fill+0x2f>
+  802934:	89 d8                	mov    %ebx,%eax
+  802936:	e8 fd fe ff ff       	call   802838 <stream_drain>
+		return 0;
+  80293b:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  802940:	85 c0                	test   %eax,%eax
+  802942:	78 27                	js     80296b <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  802944:	83 ec 04             	sub    $0x4,%esp
+  802947:	ff 73 10             	push   0x10(%ebx)
+  80294a:	ff 73 0c             	push   0xc(%ebx)
+  80294d:	ff 33                	push   (%ebx)
+  80294f:	e8 02 f3 ff ff       	call   801c56 <read>
+  802954:	83 c4 10             	add    $0x10,%esp
+  802957:	85 c0                	test   %eax,%eax
+  802959:	7e 17                	jle    802972 <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  80295b:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  80295f:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  802966:	89 c2                	mov    %eax,%edx
+  802968:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  80296b:	89 d0                	mov    %edx,%eax
+  80296d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802970:	c9                   	leave
+  802971:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802972:	c1 f8 1f             	sar    $0x1f,%eax
+  802975:	83 e0 04             	and    $0x4,%eax
+  802978:	83 c0 04             	add    $0x4,%eax
+  80297b:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  80297e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802983:	eb e6                	jmp    80296b <stream_fill+0x56>
+
+00802985 <fopen>:
+{
+  802985:	55                   	push   %ebp
+  802986:	89 e5                	mov    %esp,%ebp
+  802988:	57                   	push   %edi
+  802989:	56                   	push   %esi
+  80298a:	53                   	push   %ebx
+  80298b:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  802991:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  802994:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  80299a:	89 f0                	mov    %esi,%eax
+  80299c:	e8 40 fd ff ff       	call   8026e1 <parse_mode>
+		return 0;
+  8029a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8029a6:	85 c0                	test   %eax,%eax
+  8029a8:	78 2d                	js     8029d7 <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  8029aa:	83 ec 08             	sub    $0x8,%esp
+  8029ad:	50                   	push   %eax
+  8029ae:	ff 75 08             	push   0x8(%ebp)
+  8029b1:	e8 e8 f8 ff ff       	call   80229e <open>
+  8029b6:	89 c7                	mov    %eax,%edi
+  8029b8:	83 c4 10             	add    $0x10,%esp
+  8029bb:	85 c0                	test   %eax,%eax
+  8029bd:	78 58                	js     802a17 <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  8029bf:	80 3e 61             	cmpb   $0x61,(%esi)
+  8029c2:	74 1d                	je     8029e1 <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  8029c4:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  8029ca:	89 f8                	mov    %edi,%eax
+  8029cc:	e8 7b fd ff ff       	call   80274c <stream_alloc>
+  8029d1:	89 c3                	mov    %eax,%ebx
+  8029d3:	85 c0                	test   %eax,%eax
+  8029d5:	74 32                	je     802a09 <fopen+0x84>
+}
+  8029d7:	89 d8                	mov    %ebx,%eax
+  8029d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029dc:	5b                   	pop    %ebx
+  8029dd:	5e                   	pop    %esi
+  8029de:	5f                   	pop    %edi
+  8029df:	5d                   	pop    %ebp
+  8029e0:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  8029e1:	83 ec 08             	sub    $0x8,%esp
+  8029e4:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  8029ea:	50                   	push   %eax
+  8029eb:	57                   	push   %edi
+  8029ec:	e8 db f4 ff ff       	call   801ecc <fstat>
+  8029f1:	83 c4 10             	add    $0x10,%esp
+  8029f4:	85 c0                	test   %eax,%eax
+  8029f6:	78 cc                	js     8029c4 <fopen+0x3f>
+		seek(fd, st.st_size);
+  8029f8:	83 ec 08             	sub    $0x8,%esp
+  8029fb:	ff 75 dc             	push   -0x24(%ebp)
+  8029fe:	57                   	push   %edi
+  8029ff:	e8 f6 f3 ff ff       	call   801dfa <seek>
+  802a04:	83 c4 10             	add    $0x10,%esp
+  802a07:	eb bb                	jmp    8029c4 <fopen+0x3f>
+		close(fd);
+  802a09:	83 ec 0c             	sub    $0xc,%esp
+  802a0c:	57                   	push   %edi
+  802a0d:	e8 08 f1 ff ff       	call   801b1a <close>
+  802a12:	83 c4 10             	add    $0x10,%esp
+  802a15:	eb c0                	jmp    8029d7 <fopen+0x52>
+		return 0;
+  802a17:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a1c:	eb b9                	jmp    8029d7 <fopen+0x52>
+
+00802a1e <fdopen>:
+{
+  802a1e:	55                   	push   %ebp
+  802a1f:	89 e5                	mov    %esp,%ebp
+  802a21:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  802a24:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802a27:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a2a:	e8 b2 fc ff ff       	call   8026e1 <parse_mode>
+  802a2f:	89 c2                	mov    %eax,%edx
+		return 0;
+  802a31:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  802a36:	85 d2                	test   %edx,%edx
+  802a38:	78 0b                	js     802a45 <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  802a3a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802a3d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a40:	e8 07 fd ff ff       	call   80274c <stream_alloc>
+}
+  802a45:	c9                   	leave
+  802a46:	c3                   	ret
+
+00802a47 <setvbuf>:
+{
+  802a47:	55                   	push   %ebp
+  802a48:	89 e5                	mov    %esp,%ebp
+  802a4a:	57                   	push   %edi
+  802a4b:	56                   	push   %esi
+  802a4c:	53                   	push   %ebx
+  802a4d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a50:	8b 55 10             	mov    0x10(%ebp),%edx
+  802a53:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  802a56:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802a5a:	75 3a                	jne    802a96 <setvbuf+0x4f>
+  802a5c:	8d 72 ff             	lea    -0x1(%edx),%esi
+  802a5f:	83 fe 02             	cmp    $0x2,%esi
+  802a62:	77 39                	ja     802a9d <setvbuf+0x56>
+	f->f_bufmode = mode;
+  802a64:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  802a67:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802a6b:	0f 95 c3             	setne  %bl
+  802a6e:	85 ff                	test   %edi,%edi
+  802a70:	0f 95 c1             	setne  %cl
+  802a73:	84 cb                	test   %cl,%bl
+  802a75:	74 05                	je     802a7c <setvbuf+0x35>
+  802a77:	83 fa 03             	cmp    $0x3,%edx
+  802a7a:	75 0a                	jne    802a86 <setvbuf+0x3f>
+	return 0;
+  802a7c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a81:	5b                   	pop    %ebx
+  802a82:	5e                   	pop    %esi
+  802a83:	5f                   	pop    %edi
+  802a84:	5d                   	pop    %ebp
+  802a85:	c3                   	ret
+		f->f_buf = buf;
+  802a86:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802a89:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  802a8c:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  802a8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a94:	eb eb                	jmp    802a81 <setvbuf+0x3a>
+		return EOF;
+  802a96:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802a9b:	eb e4                	jmp    802a81 <setvbuf+0x3a>
+  802a9d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802aa2:	eb dd                	jmp    802a81 <setvbuf+0x3a>
+
+00802aa4 <fflush>:
+{
+  802aa4:	55                   	push   %ebp
+  802aa5:	89 e5                	mov    %esp,%ebp
+  802aa7:	57                   	push   %edi
+  802aa8:	56                   	push   %esi
+  802aa9:	53                   	push   %ebx
+  802aaa:	83 ec 0c             	sub    $0xc,%esp
+  802aad:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  802ab0:	85 db                	test   %ebx,%ebx
+  802ab2:	74 1a                	je     802ace <fflush+0x2a>
+	stream_unread(f);
+  802ab4:	89 d8                	mov    %ebx,%eax
+  802ab6:	e8 0a fd ff ff       	call   8027c5 <stream_unread>
+	return stream_drain(f);
+  802abb:	89 d8                	mov    %ebx,%eax
+  802abd:	e8 76 fd ff ff       	call   802838 <stream_drain>
+  802ac2:	89 c7                	mov    %eax,%edi
+}
+  802ac4:	89 f8                	mov    %edi,%eax
+  802ac6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ac9:	5b                   	pop    %ebx
+  802aca:	5e                   	pop    %esi
+  802acb:	5f                   	pop    %edi
+  802acc:	5d                   	pop    %ebp
+  802acd:	c3                   	ret
+  802ace:	bb 20 60 80 00       	mov    $0x806020,%ebx
+  802ad3:	be 60 62 80 00       	mov    $0x806260,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  802ad8:	bf 00 00 00 00       	mov    $0x0,%edi
+  802add:	eb 03                	jmp    802ae2 <fflush+0x3e>
+  802adf:	83 c3 24             	add    $0x24,%ebx
+  802ae2:	39 f3                	cmp    %esi,%ebx
+  802ae4:	74 de                	je     802ac4 <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  802ae6:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  802aea:	74 f3                	je     802adf <fflush+0x3b>
+  802aec:	83 ec 0c             	sub    $0xc,%esp
+  802aef:	53                   	push   %ebx
+  802af0:	e8 af ff ff ff       	call   802aa4 <fflush>
+  802af5:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  802af8:	85 c0                	test   %eax,%eax
+  802afa:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802aff:	0f 48 f8             	cmovs  %eax,%edi
+  802b02:	eb db                	jmp    802adf <fflush+0x3b>
+
+00802b04 <fclose>:
+{
+  802b04:	55                   	push   %ebp
+  802b05:	89 e5                	mov    %esp,%ebp
+  802b07:	56                   	push   %esi
+  802b08:	53                   	push   %ebx
+  802b09:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  802b0c:	83 ec 0c             	sub    $0xc,%esp
+  802b0f:	56                   	push   %esi
+  802b10:	e8 8f ff ff ff       	call   802aa4 <fflush>
+  802b15:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  802b17:	83 c4 04             	add    $0x4,%esp
+  802b1a:	ff 36                	push   (%esi)
+  802b1c:	e8 f9 ef ff ff       	call   801b1a <close>
+  802b21:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  802b24:	85 c0                	test   %eax,%eax
+  802b26:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802b2b:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  802b2e:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  802b32:	75 10                	jne    802b44 <fclose+0x40>
+	f->f_flags = 0;
+  802b34:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  802b3b:	89 d8                	mov    %ebx,%eax
+  802b3d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b40:	5b                   	pop    %ebx
+  802b41:	5e                   	pop    %esi
+  802b42:	5d                   	pop    %ebp
+  802b43:	c3                   	ret
+		free(f->f_buf);
+  802b44:	83 ec 0c             	sub    $0xc,%esp
+  802b47:	ff 76 0c             	push   0xc(%esi)
+  802b4a:	e8 54 08 00 00       	call   8033a3 <free>
+  802b4f:	83 c4 10             	add    $0x10,%esp
+  802b52:	eb e0                	jmp    802b34 <fclose+0x30>
+
+00802b54 <fileno>:
+{
+  802b54:	55                   	push   %ebp
+  802b55:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  802b57:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b5a:	8b 00                	mov    (%eax),%eax
+}
+  802b5c:	5d                   	pop    %ebp
+  802b5d:	c3                   	ret
+
+00802b5e <feof>:
+{
+  802b5e:	55                   	push   %ebp
+  802b5f:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  802b61:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b64:	8b 40 04             	mov    0x4(%eax),%eax
+  802b67:	c1 e8 02             	shr    $0x2,%eax
+  802b6a:	83 e0 01             	and    $0x1,%eax
+}
+  802b6d:	5d                   	pop    %ebp
+  802b6e:	c3                   	ret
+
+00802b6f <ferror>:
+{
+  802b6f:	55                   	push   %ebp
+  802b70:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  802b72:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b75:	8b 40 04             	mov    0x4(%eax),%eax
+  802b78:	c1 e8 03             	shr    $0x3,%eax
+  802b7b:	83 e0 01             	and    $0x1,%eax
+}
+  802b7e:	5d                   	pop    %ebp
+  802b7f:	c3                   	ret
+
+00802b80 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  802b80:	55                   	push   %ebp
+  802b81:	89 e5                	mov    %esp,%ebp
+  802b83:	53                   	push   %ebx
+  802b84:	83 ec 04             	sub    $0x4,%esp
+  802b87:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802b8a:	8b 43 18             	mov    0x18(%ebx),%eax
+  802b8d:	39 43 14             	cmp    %eax,0x14(%ebx)
+  802b90:	74 15                	je     802ba7 <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  802b92:	8b 53 0c             	mov    0xc(%ebx),%edx
+  802b95:	8b 43 14             	mov    0x14(%ebx),%eax
+  802b98:	8d 48 01             	lea    0x1(%eax),%ecx
+  802b9b:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  802b9e:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  802ba2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ba5:	c9                   	leave
+  802ba6:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802ba7:	89 d8                	mov    %ebx,%eax
+  802ba9:	e8 67 fd ff ff       	call   802915 <stream_fill>
+  802bae:	85 c0                	test   %eax,%eax
+  802bb0:	75 e0                	jne    802b92 <fgetc+0x12>
+		return EOF;
+  802bb2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802bb7:	eb e9                	jmp    802ba2 <fgetc+0x22>
+
+00802bb9 <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  802bb9:	55                   	push   %ebp
+  802bba:	89 e5                	mov    %esp,%ebp
+  802bbc:	57                   	push   %edi
+  802bbd:	56                   	push   %esi
+  802bbe:	53                   	push   %ebx
+  802bbf:	83 ec 1c             	sub    $0x1c,%esp
+  802bc2:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  802bc5:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802bca:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802bcd:	83 e8 01             	sub    $0x1,%eax
+  802bd0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  802bd3:	eb 66                	jmp    802c3b <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802bd5:	8b 46 14             	mov    0x14(%esi),%eax
+  802bd8:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802bdb:	29 c3                	sub    %eax,%ebx
+  802bdd:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802be0:	29 fa                	sub    %edi,%edx
+  802be2:	39 d3                	cmp    %edx,%ebx
+  802be4:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802be7:	83 ec 04             	sub    $0x4,%esp
+  802bea:	53                   	push   %ebx
+  802beb:	6a 0a                	push   $0xa
+  802bed:	03 46 0c             	add    0xc(%esi),%eax
+  802bf0:	50                   	push   %eax
+  802bf1:	e8 34 e0 ff ff       	call   800c2a <memfind>
+  802bf6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  802bf9:	8b 46 0c             	mov    0xc(%esi),%eax
+  802bfc:	8b 4e 14             	mov    0x14(%esi),%ecx
+  802bff:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  802c02:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802c04:	83 c4 10             	add    $0x10,%esp
+  802c07:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802c0a:	74 0b                	je     802c17 <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  802c0c:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802c0f:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802c12:	29 d3                	sub    %edx,%ebx
+  802c14:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  802c17:	83 ec 04             	sub    $0x4,%esp
+  802c1a:	53                   	push   %ebx
+  802c1b:	01 c8                	add    %ecx,%eax
+  802c1d:	50                   	push   %eax
+  802c1e:	89 f8                	mov    %edi,%eax
+  802c20:	03 45 08             	add    0x8(%ebp),%eax
+  802c23:	50                   	push   %eax
+  802c24:	e8 50 df ff ff       	call   800b79 <memmove>
+		f->f_rpos += m;
+  802c29:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  802c2c:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  802c2e:	83 c4 10             	add    $0x10,%esp
+  802c31:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c34:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  802c39:	74 1f                	je     802c5a <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  802c3b:	8d 47 01             	lea    0x1(%edi),%eax
+  802c3e:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  802c41:	73 17                	jae    802c5a <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802c43:	8b 46 18             	mov    0x18(%esi),%eax
+  802c46:	39 46 14             	cmp    %eax,0x14(%esi)
+  802c49:	75 8a                	jne    802bd5 <fgets+0x1c>
+  802c4b:	89 f0                	mov    %esi,%eax
+  802c4d:	e8 c3 fc ff ff       	call   802915 <stream_fill>
+  802c52:	85 c0                	test   %eax,%eax
+  802c54:	0f 85 7b ff ff ff    	jne    802bd5 <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  802c5a:	85 ff                	test   %edi,%edi
+  802c5c:	74 0f                	je     802c6d <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  802c5e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c61:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  802c65:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c68:	5b                   	pop    %ebx
+  802c69:	5e                   	pop    %esi
+  802c6a:	5f                   	pop    %edi
+  802c6b:	5d                   	pop    %ebp
+  802c6c:	c3                   	ret
+		return 0;
+  802c6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c72:	eb f1                	jmp    802c65 <fgets+0xac>
+
+00802c74 <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  802c74:	55                   	push   %ebp
+  802c75:	89 e5                	mov    %esp,%ebp
+  802c77:	57                   	push   %edi
+  802c78:	56                   	push   %esi
+  802c79:	53                   	push   %ebx
+  802c7a:	83 ec 1c             	sub    $0x1c,%esp
+  802c7d:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  802c80:	89 f0                	mov    %esi,%eax
+  802c82:	e8 21 fc ff ff       	call   8028a8 <stream_setup>
+	want = size * n;
+  802c87:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c8a:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802c8e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  802c91:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c96:	eb 43                	jmp    802cdb <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  802c98:	29 d3                	sub    %edx,%ebx
+  802c9a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802c9d:	29 f8                	sub    %edi,%eax
+  802c9f:	39 c3                	cmp    %eax,%ebx
+  802ca1:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  802ca4:	83 ec 04             	sub    $0x4,%esp
+  802ca7:	53                   	push   %ebx
+  802ca8:	03 56 0c             	add    0xc(%esi),%edx
+  802cab:	52                   	push   %edx
+  802cac:	89 f8                	mov    %edi,%eax
+  802cae:	03 45 08             	add    0x8(%ebp),%eax
+  802cb1:	50                   	push   %eax
+  802cb2:	e8 c2 de ff ff       	call   800b79 <memmove>
+			f->f_rpos += m;
+  802cb7:	01 5e 14             	add    %ebx,0x14(%esi)
+  802cba:	83 c4 10             	add    $0x10,%esp
+  802cbd:	eb 1a                	jmp    802cd9 <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  802cbf:	83 ec 04             	sub    $0x4,%esp
+  802cc2:	53                   	push   %ebx
+  802cc3:	89 f8                	mov    %edi,%eax
+  802cc5:	03 45 08             	add    0x8(%ebp),%eax
+  802cc8:	50                   	push   %eax
+  802cc9:	ff 36                	push   (%esi)
+  802ccb:	e8 86 ef ff ff       	call   801c56 <read>
+  802cd0:	89 c3                	mov    %eax,%ebx
+  802cd2:	83 c4 10             	add    $0x10,%esp
+  802cd5:	85 c0                	test   %eax,%eax
+  802cd7:	7e 36                	jle    802d0f <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  802cd9:	01 df                	add    %ebx,%edi
+  802cdb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802cde:	39 c7                	cmp    %eax,%edi
+  802ce0:	73 39                	jae    802d1b <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  802ce2:	8b 56 14             	mov    0x14(%esi),%edx
+  802ce5:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802ce8:	39 da                	cmp    %ebx,%edx
+  802cea:	72 ac                	jb     802c98 <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  802cec:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802cef:	29 fb                	sub    %edi,%ebx
+  802cf1:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  802cf4:	72 3e                	jb     802d34 <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  802cf6:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  802cfa:	74 1f                	je     802d1b <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  802cfc:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  802d00:	74 bd                	je     802cbf <fread+0x4b>
+  802d02:	89 f0                	mov    %esi,%eax
+  802d04:	e8 2f fb ff ff       	call   802838 <stream_drain>
+  802d09:	85 c0                	test   %eax,%eax
+  802d0b:	79 b2                	jns    802cbf <fread+0x4b>
+  802d0d:	eb 0c                	jmp    802d1b <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802d0f:	c1 fb 1f             	sar    $0x1f,%ebx
+  802d12:	83 e3 04             	and    $0x4,%ebx
+  802d15:	83 c3 04             	add    $0x4,%ebx
+  802d18:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  802d1b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d1e:	85 c0                	test   %eax,%eax
+  802d20:	74 0a                	je     802d2c <fread+0xb8>
+  802d22:	89 f8                	mov    %edi,%eax
+  802d24:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d29:	f7 75 0c             	divl   0xc(%ebp)
+}
+  802d2c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d2f:	5b                   	pop    %ebx
+  802d30:	5e                   	pop    %esi
+  802d31:	5f                   	pop    %edi
+  802d32:	5d                   	pop    %ebp
+  802d33:	c3                   	ret
+		} else if (!stream_fill(f))
+  802d34:	89 f0                	mov    %esi,%eax
+  802d36:	e8 da fb ff ff       	call   802915 <stream_fill>
+  802d3b:	85 c0                	test   %eax,%eax
+  802d3d:	74 dc                	je     802d1b <fread+0xa7>
+			m = 0;
+  802d3f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d44:	eb 93                	jmp    802cd9 <fread+0x65>
+
+00802d46 <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  802d46:	55                   	push   %ebp
+  802d47:	89 e5                	mov    %esp,%ebp
+  802d49:	57                   	push   %edi
+  802d4a:	56                   	push   %esi
+  802d4b:	53                   	push   %ebx
+  802d4c:	83 ec 1c             	sub    $0x1c,%esp
+  802d4f:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  802d52:	8b 43 04             	mov    0x4(%ebx),%eax
+  802d55:	a8 02                	test   $0x2,%al
+  802d57:	75 13                	jne    802d6c <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  802d59:	83 c8 08             	or     $0x8,%eax
+  802d5c:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  802d5f:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  802d64:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d67:	5b                   	pop    %ebx
+  802d68:	5e                   	pop    %esi
+  802d69:	5f                   	pop    %edi
+  802d6a:	5d                   	pop    %ebp
+  802d6b:	c3                   	ret
+	stream_setup(f);
+  802d6c:	89 d8                	mov    %ebx,%eax
+  802d6e:	e8 35 fb ff ff       	call   8028a8 <stream_setup>
+	want = size * n;
+  802d73:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d76:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802d7a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  802d7d:	89 d8                	mov    %ebx,%eax
+  802d7f:	e8 41 fa ff ff       	call   8027c5 <stream_unread>
+	for (done = 0; done < want; ) {
+  802d84:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  802d89:	84 c0                	test   %al,%al
+  802d8b:	75 7b                	jne    802e08 <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  802d8d:	be 00 00 00 00       	mov    $0x0,%esi
+  802d92:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802d95:	39 fe                	cmp    %edi,%esi
+  802d97:	73 24                	jae    802dbd <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802d99:	83 ec 04             	sub    $0x4,%esp
+  802d9c:	89 f8                	mov    %edi,%eax
+  802d9e:	29 f0                	sub    %esi,%eax
+  802da0:	50                   	push   %eax
+  802da1:	89 f0                	mov    %esi,%eax
+  802da3:	03 45 08             	add    0x8(%ebp),%eax
+  802da6:	50                   	push   %eax
+  802da7:	ff 33                	push   (%ebx)
+  802da9:	e8 a0 ef ff ff       	call   801d4e <write>
+  802dae:	83 c4 10             	add    $0x10,%esp
+  802db1:	85 c0                	test   %eax,%eax
+  802db3:	7e 04                	jle    802db9 <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  802db5:	01 c6                	add    %eax,%esi
+  802db7:	eb dc                	jmp    802d95 <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  802db9:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  802dbd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802dc0:	85 c0                	test   %eax,%eax
+  802dc2:	74 a0                	je     802d64 <fwrite+0x1e>
+  802dc4:	89 f0                	mov    %esi,%eax
+  802dc6:	ba 00 00 00 00       	mov    $0x0,%edx
+  802dcb:	f7 75 0c             	divl   0xc(%ebp)
+  802dce:	eb 94                	jmp    802d64 <fwrite+0x1e>
+			done += r;
+  802dd0:	01 c7                	add    %eax,%edi
+			continue;
+  802dd2:	eb 34                	jmp    802e08 <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  802dd4:	8b 73 10             	mov    0x10(%ebx),%esi
+  802dd7:	29 c6                	sub    %eax,%esi
+  802dd9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802ddc:	29 fa                	sub    %edi,%edx
+  802dde:	39 d6                	cmp    %edx,%esi
+  802de0:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  802de3:	83 ec 04             	sub    $0x4,%esp
+  802de6:	56                   	push   %esi
+  802de7:	89 fa                	mov    %edi,%edx
+  802de9:	03 55 08             	add    0x8(%ebp),%edx
+  802dec:	52                   	push   %edx
+  802ded:	03 43 0c             	add    0xc(%ebx),%eax
+  802df0:	50                   	push   %eax
+  802df1:	e8 83 dd ff ff       	call   800b79 <memmove>
+		f->f_wend += m;
+  802df6:	89 f0                	mov    %esi,%eax
+  802df8:	03 43 1c             	add    0x1c(%ebx),%eax
+  802dfb:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  802dfe:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802e00:	83 c4 10             	add    $0x10,%esp
+  802e03:	3b 43 10             	cmp    0x10(%ebx),%eax
+  802e06:	74 5b                	je     802e63 <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  802e08:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802e0b:	39 c7                	cmp    %eax,%edi
+  802e0d:	73 2d                	jae    802e3c <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  802e0f:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802e12:	85 c0                	test   %eax,%eax
+  802e14:	75 be                	jne    802dd4 <fwrite+0x8e>
+  802e16:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802e19:	29 fa                	sub    %edi,%edx
+  802e1b:	3b 53 10             	cmp    0x10(%ebx),%edx
+  802e1e:	72 b4                	jb     802dd4 <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802e20:	83 ec 04             	sub    $0x4,%esp
+  802e23:	52                   	push   %edx
+  802e24:	89 f8                	mov    %edi,%eax
+  802e26:	03 45 08             	add    0x8(%ebp),%eax
+  802e29:	50                   	push   %eax
+  802e2a:	ff 33                	push   (%ebx)
+  802e2c:	e8 1d ef ff ff       	call   801d4e <write>
+  802e31:	83 c4 10             	add    $0x10,%esp
+  802e34:	85 c0                	test   %eax,%eax
+  802e36:	7f 98                	jg     802dd0 <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  802e38:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  802e3c:	8b 43 08             	mov    0x8(%ebx),%eax
+  802e3f:	83 f8 03             	cmp    $0x3,%eax
+  802e42:	74 48                	je     802e8c <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802e44:	83 f8 02             	cmp    $0x2,%eax
+  802e47:	74 27                	je     802e70 <fwrite+0x12a>
+	return size ? done / size : 0;
+  802e49:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e4c:	85 c0                	test   %eax,%eax
+  802e4e:	0f 84 10 ff ff ff    	je     802d64 <fwrite+0x1e>
+  802e54:	89 f8                	mov    %edi,%eax
+  802e56:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e5b:	f7 75 0c             	divl   0xc(%ebp)
+  802e5e:	e9 01 ff ff ff       	jmp    802d64 <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802e63:	89 d8                	mov    %ebx,%eax
+  802e65:	e8 ce f9 ff ff       	call   802838 <stream_drain>
+  802e6a:	85 c0                	test   %eax,%eax
+  802e6c:	79 9a                	jns    802e08 <fwrite+0xc2>
+  802e6e:	eb cc                	jmp    802e3c <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802e70:	83 ec 04             	sub    $0x4,%esp
+  802e73:	57                   	push   %edi
+  802e74:	6a 0a                	push   $0xa
+  802e76:	ff 75 08             	push   0x8(%ebp)
+  802e79:	e8 ac dd ff ff       	call   800c2a <memfind>
+  802e7e:	89 c2                	mov    %eax,%edx
+  802e80:	89 f8                	mov    %edi,%eax
+  802e82:	03 45 08             	add    0x8(%ebp),%eax
+  802e85:	83 c4 10             	add    $0x10,%esp
+  802e88:	39 c2                	cmp    %eax,%edx
+  802e8a:	74 bd                	je     802e49 <fwrite+0x103>
+		stream_drain(f);
+  802e8c:	89 d8                	mov    %ebx,%eax
+  802e8e:	e8 a5 f9 ff ff       	call   802838 <stream_drain>
+  802e93:	eb b4                	jmp    802e49 <fwrite+0x103>
+
+00802e95 <fputc>:
+{
+  802e95:	55                   	push   %ebp
+  802e96:	89 e5                	mov    %esp,%ebp
+  802e98:	53                   	push   %ebx
+  802e99:	83 ec 14             	sub    $0x14,%esp
+  802e9c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  802e9f:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  802ea2:	ff 75 0c             	push   0xc(%ebp)
+  802ea5:	6a 01                	push   $0x1
+  802ea7:	6a 01                	push   $0x1
+  802ea9:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802eac:	50                   	push   %eax
+  802ead:	e8 94 fe ff ff       	call   802d46 <fwrite>
+  802eb2:	83 c4 10             	add    $0x10,%esp
+  802eb5:	0f b6 db             	movzbl %bl,%ebx
+  802eb8:	83 f8 01             	cmp    $0x1,%eax
+  802ebb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802ec0:	0f 44 c3             	cmove  %ebx,%eax
+}
+  802ec3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ec6:	c9                   	leave
+  802ec7:	c3                   	ret
+
+00802ec8 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  802ec8:	55                   	push   %ebp
+  802ec9:	89 e5                	mov    %esp,%ebp
+  802ecb:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  802ece:	ff 75 0c             	push   0xc(%ebp)
+  802ed1:	ff 75 08             	push   0x8(%ebp)
+  802ed4:	e8 bc ff ff ff       	call   802e95 <fputc>
+}
+  802ed9:	83 c4 10             	add    $0x10,%esp
+  802edc:	c9                   	leave
+  802edd:	c3                   	ret
+
+00802ede <fputs>:
+{
+  802ede:	55                   	push   %ebp
+  802edf:	89 e5                	mov    %esp,%ebp
+  802ee1:	56                   	push   %esi
+  802ee2:	53                   	push   %ebx
+  802ee3:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  802ee6:	83 ec 0c             	sub    $0xc,%esp
+  802ee9:	56                   	push   %esi
+  802eea:	e8 c9 da ff ff       	call   8009b8 <strlen>
+  802eef:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  802ef1:	ff 75 0c             	push   0xc(%ebp)
+  802ef4:	50                   	push   %eax
+  802ef5:	6a 01                	push   $0x1
+  802ef7:	56                   	push   %esi
+  802ef8:	e8 49 fe ff ff       	call   802d46 <fwrite>
+  802efd:	83 c4 20             	add    $0x20,%esp
+  802f00:	39 d8                	cmp    %ebx,%eax
+  802f02:	0f 95 c0             	setne  %al
+  802f05:	0f b6 c0             	movzbl %al,%eax
+  802f08:	f7 d8                	neg    %eax
+}
+  802f0a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f0d:	5b                   	pop    %ebx
+  802f0e:	5e                   	pop    %esi
+  802f0f:	5d                   	pop    %ebp
+  802f10:	c3                   	ret
+
+00802f11 <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  802f11:	55                   	push   %ebp
+  802f12:	89 e5                	mov    %esp,%ebp
+  802f14:	53                   	push   %ebx
+  802f15:	83 ec 04             	sub    $0x4,%esp
+  802f18:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802f1b:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  802f1e:	50                   	push   %eax
+  802f1f:	ff 75 0c             	push   0xc(%ebp)
+  802f22:	53                   	push   %ebx
+  802f23:	68 c8 2e 80 00       	push   $0x802ec8
+  802f28:	e8 d9 d5 ff ff       	call   800506 <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  802f2d:	8b 43 04             	mov    0x4(%ebx),%eax
+  802f30:	c1 e0 1c             	shl    $0x1c,%eax
+  802f33:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  802f36:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f39:	c9                   	leave
+  802f3a:	c3                   	ret
+
+00802f3b <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802f3b:	55                   	push   %ebp
+  802f3c:	89 e5                	mov    %esp,%ebp
+  802f3e:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802f41:	68 48 50 80 00       	push   $0x805048
+  802f46:	ff 75 0c             	push   0xc(%ebp)
+  802f49:	e8 a5 da ff ff       	call   8009f3 <strcpy>
+	return 0;
+}
+  802f4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f53:	c9                   	leave
+  802f54:	c3                   	ret
+
+00802f55 <devsock_close>:
+{
+  802f55:	55                   	push   %ebp
+  802f56:	89 e5                	mov    %esp,%ebp
+  802f58:	53                   	push   %ebx
+  802f59:	83 ec 10             	sub    $0x10,%esp
+  802f5c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802f5f:	53                   	push   %ebx
+  802f60:	e8 11 17 00 00       	call   804676 <pageref>
+  802f65:	89 c2                	mov    %eax,%edx
+  802f67:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802f6a:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802f6f:	83 fa 01             	cmp    $0x1,%edx
+  802f72:	74 05                	je     802f79 <devsock_close+0x24>
+}
+  802f74:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f77:	c9                   	leave
+  802f78:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802f79:	83 ec 0c             	sub    $0xc,%esp
+  802f7c:	ff 73 0c             	push   0xc(%ebx)
+  802f7f:	e8 b7 02 00 00       	call   80323b <nsipc_close>
+  802f84:	83 c4 10             	add    $0x10,%esp
+  802f87:	eb eb                	jmp    802f74 <devsock_close+0x1f>
+
+00802f89 <devsock_write>:
+{
+  802f89:	55                   	push   %ebp
+  802f8a:	89 e5                	mov    %esp,%ebp
+  802f8c:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802f8f:	6a 00                	push   $0x0
+  802f91:	ff 75 10             	push   0x10(%ebp)
+  802f94:	ff 75 0c             	push   0xc(%ebp)
+  802f97:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f9a:	ff 70 0c             	push   0xc(%eax)
+  802f9d:	e8 79 03 00 00       	call   80331b <nsipc_send>
+}
+  802fa2:	c9                   	leave
+  802fa3:	c3                   	ret
+
+00802fa4 <devsock_read>:
+{
+  802fa4:	55                   	push   %ebp
+  802fa5:	89 e5                	mov    %esp,%ebp
+  802fa7:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802faa:	6a 00                	push   $0x0
+  802fac:	ff 75 10             	push   0x10(%ebp)
+  802faf:	ff 75 0c             	push   0xc(%ebp)
+  802fb2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fb5:	ff 70 0c             	push   0xc(%eax)
+  802fb8:	e8 ef 02 00 00       	call   8032ac <nsipc_recv>
+}
+  802fbd:	c9                   	leave
+  802fbe:	c3                   	ret
+
+00802fbf <fd2sockid>:
+{
+  802fbf:	55                   	push   %ebp
+  802fc0:	89 e5                	mov    %esp,%ebp
+  802fc2:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802fc5:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802fc8:	52                   	push   %edx
+  802fc9:	50                   	push   %eax
+  802fca:	e8 f7 e9 ff ff       	call   8019c6 <fd_lookup>
+  802fcf:	83 c4 10             	add    $0x10,%esp
+  802fd2:	85 c0                	test   %eax,%eax
+  802fd4:	78 10                	js     802fe6 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802fd6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802fd9:	8b 0d 60 62 80 00    	mov    0x806260,%ecx
+  802fdf:	39 08                	cmp    %ecx,(%eax)
+  802fe1:	75 05                	jne    802fe8 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802fe3:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802fe6:	c9                   	leave
+  802fe7:	c3                   	ret
+		return -E_NOT_SUPP;
+  802fe8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802fed:	eb f7                	jmp    802fe6 <fd2sockid+0x27>
+
+00802fef <alloc_sockfd>:
+{
+  802fef:	55                   	push   %ebp
+  802ff0:	89 e5                	mov    %esp,%ebp
+  802ff2:	56                   	push   %esi
+  802ff3:	53                   	push   %ebx
+  802ff4:	83 ec 1c             	sub    $0x1c,%esp
+  802ff7:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802ff9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ffc:	50                   	push   %eax
+  802ffd:	e8 6e e9 ff ff       	call   801970 <fd_alloc>
+  803002:	89 c3                	mov    %eax,%ebx
+  803004:	83 c4 10             	add    $0x10,%esp
+  803007:	85 c0                	test   %eax,%eax
+  803009:	78 43                	js     80304e <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80300b:	83 ec 04             	sub    $0x4,%esp
+  80300e:	68 07 04 00 00       	push   $0x407
+  803013:	ff 75 f4             	push   -0xc(%ebp)
+  803016:	6a 00                	push   $0x0
+  803018:	e8 14 de ff ff       	call   800e31 <sys_page_alloc>
+  80301d:	89 c3                	mov    %eax,%ebx
+  80301f:	83 c4 10             	add    $0x10,%esp
+  803022:	85 c0                	test   %eax,%eax
+  803024:	78 28                	js     80304e <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  803026:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803029:	8b 15 60 62 80 00    	mov    0x806260,%edx
+  80302f:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  803031:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803034:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80303b:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  80303e:	83 ec 0c             	sub    $0xc,%esp
+  803041:	50                   	push   %eax
+  803042:	e8 02 e9 ff ff       	call   801949 <fd2num>
+  803047:	89 c3                	mov    %eax,%ebx
+  803049:	83 c4 10             	add    $0x10,%esp
+  80304c:	eb 0c                	jmp    80305a <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  80304e:	83 ec 0c             	sub    $0xc,%esp
+  803051:	56                   	push   %esi
+  803052:	e8 e4 01 00 00       	call   80323b <nsipc_close>
+		return r;
+  803057:	83 c4 10             	add    $0x10,%esp
+}
+  80305a:	89 d8                	mov    %ebx,%eax
+  80305c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80305f:	5b                   	pop    %ebx
+  803060:	5e                   	pop    %esi
+  803061:	5d                   	pop    %ebp
+  803062:	c3                   	ret
+
+00803063 <accept>:
+{
+  803063:	55                   	push   %ebp
+  803064:	89 e5                	mov    %esp,%ebp
+  803066:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803069:	8b 45 08             	mov    0x8(%ebp),%eax
+  80306c:	e8 4e ff ff ff       	call   802fbf <fd2sockid>
+  803071:	85 c0                	test   %eax,%eax
+  803073:	78 1b                	js     803090 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  803075:	83 ec 04             	sub    $0x4,%esp
+  803078:	ff 75 10             	push   0x10(%ebp)
+  80307b:	ff 75 0c             	push   0xc(%ebp)
+  80307e:	50                   	push   %eax
+  80307f:	e8 0e 01 00 00       	call   803192 <nsipc_accept>
+  803084:	83 c4 10             	add    $0x10,%esp
+  803087:	85 c0                	test   %eax,%eax
+  803089:	78 05                	js     803090 <accept+0x2d>
+	return alloc_sockfd(r);
+  80308b:	e8 5f ff ff ff       	call   802fef <alloc_sockfd>
+}
+  803090:	c9                   	leave
+  803091:	c3                   	ret
+
+00803092 <bind>:
+{
+  803092:	55                   	push   %ebp
+  803093:	89 e5                	mov    %esp,%ebp
+  803095:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803098:	8b 45 08             	mov    0x8(%ebp),%eax
+  80309b:	e8 1f ff ff ff       	call   802fbf <fd2sockid>
+  8030a0:	85 c0                	test   %eax,%eax
+  8030a2:	78 12                	js     8030b6 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8030a4:	83 ec 04             	sub    $0x4,%esp
+  8030a7:	ff 75 10             	push   0x10(%ebp)
+  8030aa:	ff 75 0c             	push   0xc(%ebp)
+  8030ad:	50                   	push   %eax
+  8030ae:	e8 31 01 00 00       	call   8031e4 <nsipc_bind>
+  8030b3:	83 c4 10             	add    $0x10,%esp
+}
+  8030b6:	c9                   	leave
+  8030b7:	c3                   	ret
+
+008030b8 <shutdown>:
+{
+  8030b8:	55                   	push   %ebp
+  8030b9:	89 e5                	mov    %esp,%ebp
+  8030bb:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8030be:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030c1:	e8 f9 fe ff ff       	call   802fbf <fd2sockid>
+  8030c6:	85 c0                	test   %eax,%eax
+  8030c8:	78 0f                	js     8030d9 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8030ca:	83 ec 08             	sub    $0x8,%esp
+  8030cd:	ff 75 0c             	push   0xc(%ebp)
+  8030d0:	50                   	push   %eax
+  8030d1:	e8 43 01 00 00       	call   803219 <nsipc_shutdown>
+  8030d6:	83 c4 10             	add    $0x10,%esp
+}
+  8030d9:	c9                   	leave
+  8030da:	c3                   	ret
+
+008030db <connect>:
+{
+  8030db:	55                   	push   %ebp
+  8030dc:	89 e5                	mov    %esp,%ebp
+  8030de:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8030e1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030e4:	e8 d6 fe ff ff       	call   802fbf <fd2sockid>
+  8030e9:	85 c0                	test   %eax,%eax
+  8030eb:	78 12                	js     8030ff <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8030ed:	83 ec 04             	sub    $0x4,%esp
+  8030f0:	ff 75 10             	push   0x10(%ebp)
+  8030f3:	ff 75 0c             	push   0xc(%ebp)
+  8030f6:	50                   	push   %eax
+  8030f7:	e8 59 01 00 00       	call   803255 <nsipc_connect>
+  8030fc:	83 c4 10             	add    $0x10,%esp
+}
+  8030ff:	c9                   	leave
+  803100:	c3                   	ret
+
+00803101 <listen>:
+{
+  803101:	55                   	push   %ebp
+  803102:	89 e5                	mov    %esp,%ebp
+  803104:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803107:	8b 45 08             	mov    0x8(%ebp),%eax
+  80310a:	e8 b0 fe ff ff       	call   802fbf <fd2sockid>
+  80310f:	85 c0                	test   %eax,%eax
+  803111:	78 0f                	js     803122 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  803113:	83 ec 08             	sub    $0x8,%esp
+  803116:	ff 75 0c             	push   0xc(%ebp)
+  803119:	50                   	push   %eax
+  80311a:	e8 6b 01 00 00       	call   80328a <nsipc_listen>
+  80311f:	83 c4 10             	add    $0x10,%esp
+}
+  803122:	c9                   	leave
+  803123:	c3                   	ret
+
+00803124 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  803124:	55                   	push   %ebp
+  803125:	89 e5                	mov    %esp,%ebp
+  803127:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80312a:	ff 75 10             	push   0x10(%ebp)
+  80312d:	ff 75 0c             	push   0xc(%ebp)
+  803130:	ff 75 08             	push   0x8(%ebp)
+  803133:	e8 41 02 00 00       	call   803379 <nsipc_socket>
+  803138:	83 c4 10             	add    $0x10,%esp
+  80313b:	85 c0                	test   %eax,%eax
+  80313d:	78 05                	js     803144 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  80313f:	e8 ab fe ff ff       	call   802fef <alloc_sockfd>
+}
+  803144:	c9                   	leave
+  803145:	c3                   	ret
+
+00803146 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  803146:	55                   	push   %ebp
+  803147:	89 e5                	mov    %esp,%ebp
+  803149:	53                   	push   %ebx
+  80314a:	83 ec 04             	sub    $0x4,%esp
+  80314d:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  80314f:	83 3d 08 70 80 00 00 	cmpl   $0x0,0x807008
+  803156:	74 26                	je     80317e <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  803158:	6a 07                	push   $0x7
+  80315a:	68 00 90 80 00       	push   $0x809000
+  80315f:	53                   	push   %ebx
+  803160:	ff 35 08 70 80 00    	push   0x807008
+  803166:	e8 76 14 00 00       	call   8045e1 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  80316b:	83 c4 0c             	add    $0xc,%esp
+  80316e:	6a 00                	push   $0x0
+  803170:	6a 00                	push   $0x0
+  803172:	6a 00                	push   $0x0
+  803174:	e8 72 13 00 00       	call   8044eb <ipc_recv>
+}
+  803179:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80317c:	c9                   	leave
+  80317d:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80317e:	83 ec 0c             	sub    $0xc,%esp
+  803181:	6a 02                	push   $0x2
+  803183:	e8 af 14 00 00       	call   804637 <ipc_find_env>
+  803188:	a3 08 70 80 00       	mov    %eax,0x807008
+  80318d:	83 c4 10             	add    $0x10,%esp
+  803190:	eb c6                	jmp    803158 <nsipc+0x12>
+
+00803192 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  803192:	55                   	push   %ebp
+  803193:	89 e5                	mov    %esp,%ebp
+  803195:	56                   	push   %esi
+  803196:	53                   	push   %ebx
+  803197:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80319a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80319d:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  8031a2:	8b 06                	mov    (%esi),%eax
+  8031a4:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8031a9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8031ae:	e8 93 ff ff ff       	call   803146 <nsipc>
+  8031b3:	89 c3                	mov    %eax,%ebx
+  8031b5:	85 c0                	test   %eax,%eax
+  8031b7:	79 09                	jns    8031c2 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8031b9:	89 d8                	mov    %ebx,%eax
+  8031bb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8031be:	5b                   	pop    %ebx
+  8031bf:	5e                   	pop    %esi
+  8031c0:	5d                   	pop    %ebp
+  8031c1:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8031c2:	83 ec 04             	sub    $0x4,%esp
+  8031c5:	ff 35 10 90 80 00    	push   0x809010
+  8031cb:	68 00 90 80 00       	push   $0x809000
+  8031d0:	ff 75 0c             	push   0xc(%ebp)
+  8031d3:	e8 a1 d9 ff ff       	call   800b79 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8031d8:	a1 10 90 80 00       	mov    0x809010,%eax
+  8031dd:	89 06                	mov    %eax,(%esi)
+  8031df:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8031e2:	eb d5                	jmp    8031b9 <nsipc_accept+0x27>
+
+008031e4 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8031e4:	55                   	push   %ebp
+  8031e5:	89 e5                	mov    %esp,%ebp
+  8031e7:	53                   	push   %ebx
+  8031e8:	83 ec 08             	sub    $0x8,%esp
+  8031eb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8031ee:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031f1:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8031f6:	53                   	push   %ebx
+  8031f7:	ff 75 0c             	push   0xc(%ebp)
+  8031fa:	68 04 90 80 00       	push   $0x809004
+  8031ff:	e8 75 d9 ff ff       	call   800b79 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  803204:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  80320a:	b8 02 00 00 00       	mov    $0x2,%eax
+  80320f:	e8 32 ff ff ff       	call   803146 <nsipc>
+}
+  803214:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803217:	c9                   	leave
+  803218:	c3                   	ret
+
+00803219 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  803219:	55                   	push   %ebp
+  80321a:	89 e5                	mov    %esp,%ebp
+  80321c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  80321f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803222:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  803227:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80322a:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  80322f:	b8 03 00 00 00       	mov    $0x3,%eax
+  803234:	e8 0d ff ff ff       	call   803146 <nsipc>
+}
+  803239:	c9                   	leave
+  80323a:	c3                   	ret
+
+0080323b <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80323b:	55                   	push   %ebp
+  80323c:	89 e5                	mov    %esp,%ebp
+  80323e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  803241:	8b 45 08             	mov    0x8(%ebp),%eax
+  803244:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  803249:	b8 04 00 00 00       	mov    $0x4,%eax
+  80324e:	e8 f3 fe ff ff       	call   803146 <nsipc>
+}
+  803253:	c9                   	leave
+  803254:	c3                   	ret
+
+00803255 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  803255:	55                   	push   %ebp
+  803256:	89 e5                	mov    %esp,%ebp
+  803258:	53                   	push   %ebx
+  803259:	83 ec 08             	sub    $0x8,%esp
+  80325c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  80325f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803262:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  803267:	53                   	push   %ebx
+  803268:	ff 75 0c             	push   0xc(%ebp)
+  80326b:	68 04 90 80 00       	push   $0x809004
+  803270:	e8 04 d9 ff ff       	call   800b79 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  803275:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  80327b:	b8 05 00 00 00       	mov    $0x5,%eax
+  803280:	e8 c1 fe ff ff       	call   803146 <nsipc>
+}
+  803285:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803288:	c9                   	leave
+  803289:	c3                   	ret
+
+0080328a <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  80328a:	55                   	push   %ebp
+  80328b:	89 e5                	mov    %esp,%ebp
+  80328d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  803290:	8b 45 08             	mov    0x8(%ebp),%eax
+  803293:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  803298:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80329b:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  8032a0:	b8 06 00 00 00       	mov    $0x6,%eax
+  8032a5:	e8 9c fe ff ff       	call   803146 <nsipc>
+}
+  8032aa:	c9                   	leave
+  8032ab:	c3                   	ret
+
+008032ac <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8032ac:	55                   	push   %ebp
+  8032ad:	89 e5                	mov    %esp,%ebp
+  8032af:	56                   	push   %esi
+  8032b0:	53                   	push   %ebx
+  8032b1:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8032b4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032b7:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  8032bc:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  8032c2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8032c5:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8032ca:	b8 07 00 00 00       	mov    $0x7,%eax
+  8032cf:	e8 72 fe ff ff       	call   803146 <nsipc>
+  8032d4:	89 c3                	mov    %eax,%ebx
+  8032d6:	85 c0                	test   %eax,%eax
+  8032d8:	78 22                	js     8032fc <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8032da:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8032df:	39 c6                	cmp    %eax,%esi
+  8032e1:	0f 4e c6             	cmovle %esi,%eax
+  8032e4:	39 c3                	cmp    %eax,%ebx
+  8032e6:	7f 1d                	jg     803305 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8032e8:	83 ec 04             	sub    $0x4,%esp
+  8032eb:	53                   	push   %ebx
+  8032ec:	68 00 90 80 00       	push   $0x809000
+  8032f1:	ff 75 0c             	push   0xc(%ebp)
+  8032f4:	e8 80 d8 ff ff       	call   800b79 <memmove>
+  8032f9:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8032fc:	89 d8                	mov    %ebx,%eax
+  8032fe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803301:	5b                   	pop    %ebx
+  803302:	5e                   	pop    %esi
+  803303:	5d                   	pop    %ebp
+  803304:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  803305:	68 54 50 80 00       	push   $0x805054
+  80330a:	68 51 4f 80 00       	push   $0x804f51
+  80330f:	6a 62                	push   $0x62
+  803311:	68 69 50 80 00       	push   $0x805069
+  803316:	e8 19 d0 ff ff       	call   800334 <_panic>
+
+0080331b <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80331b:	55                   	push   %ebp
+  80331c:	89 e5                	mov    %esp,%ebp
+  80331e:	53                   	push   %ebx
+  80331f:	83 ec 04             	sub    $0x4,%esp
+  803322:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  803325:	8b 45 08             	mov    0x8(%ebp),%eax
+  803328:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  80332d:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  803333:	7f 2e                	jg     803363 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  803335:	83 ec 04             	sub    $0x4,%esp
+  803338:	53                   	push   %ebx
+  803339:	ff 75 0c             	push   0xc(%ebp)
+  80333c:	68 0c 90 80 00       	push   $0x80900c
+  803341:	e8 33 d8 ff ff       	call   800b79 <memmove>
+	nsipcbuf.send.req_size = size;
+  803346:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  80334c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80334f:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  803354:	b8 08 00 00 00       	mov    $0x8,%eax
+  803359:	e8 e8 fd ff ff       	call   803146 <nsipc>
+}
+  80335e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803361:	c9                   	leave
+  803362:	c3                   	ret
+	assert(size < 1600);
+  803363:	68 75 50 80 00       	push   $0x805075
+  803368:	68 51 4f 80 00       	push   $0x804f51
+  80336d:	6a 6d                	push   $0x6d
+  80336f:	68 69 50 80 00       	push   $0x805069
+  803374:	e8 bb cf ff ff       	call   800334 <_panic>
+
+00803379 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  803379:	55                   	push   %ebp
+  80337a:	89 e5                	mov    %esp,%ebp
+  80337c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  80337f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803382:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  803387:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80338a:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  80338f:	8b 45 10             	mov    0x10(%ebp),%eax
+  803392:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  803397:	b8 09 00 00 00       	mov    $0x9,%eax
+  80339c:	e8 a5 fd ff ff       	call   803146 <nsipc>
+}
+  8033a1:	c9                   	leave
+  8033a2:	c3                   	ret
+
+008033a3 <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  8033a3:	55                   	push   %ebp
+  8033a4:	89 e5                	mov    %esp,%ebp
+  8033a6:	53                   	push   %ebx
+  8033a7:	83 ec 10             	sub    $0x10,%esp
+  8033aa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  8033ad:	68 0c 70 80 00       	push   $0x80700c
+  8033b2:	e8 50 07 00 00       	call   803b07 <mutex_lock>
+	if (v == 0)
+  8033b7:	83 c4 10             	add    $0x10,%esp
+  8033ba:	85 db                	test   %ebx,%ebx
+  8033bc:	0f 84 85 00 00 00    	je     803447 <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  8033c2:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  8033c8:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  8033cd:	77 51                	ja     803420 <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  8033cf:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  8033d5:	89 d8                	mov    %ebx,%eax
+  8033d7:	c1 e8 0c             	shr    $0xc,%eax
+  8033da:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8033e1:	f6 c4 02             	test   $0x2,%ah
+  8033e4:	74 50                	je     803436 <free+0x93>
+		sys_page_unmap(0, c);
+  8033e6:	83 ec 08             	sub    $0x8,%esp
+  8033e9:	53                   	push   %ebx
+  8033ea:	6a 00                	push   $0x0
+  8033ec:	e8 d9 da ff ff       	call   800eca <sys_page_unmap>
+		c += PGSIZE;
+  8033f1:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  8033f7:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  8033fd:	83 c4 10             	add    $0x10,%esp
+  803400:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  803405:	76 ce                	jbe    8033d5 <free+0x32>
+  803407:	68 bf 50 80 00       	push   $0x8050bf
+  80340c:	68 51 4f 80 00       	push   $0x804f51
+  803411:	68 82 00 00 00       	push   $0x82
+  803416:	68 b2 50 80 00       	push   $0x8050b2
+  80341b:	e8 14 cf ff ff       	call   800334 <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  803420:	68 84 50 80 00       	push   $0x805084
+  803425:	68 51 4f 80 00       	push   $0x804f51
+  80342a:	6a 7b                	push   $0x7b
+  80342c:	68 b2 50 80 00       	push   $0x8050b2
+  803431:	e8 fe ce ff ff       	call   800334 <_panic>
+	if (--(*ref) == 0)
+  803436:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  80343c:	83 e8 01             	sub    $0x1,%eax
+  80343f:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  803445:	74 15                	je     80345c <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  803447:	83 ec 0c             	sub    $0xc,%esp
+  80344a:	68 0c 70 80 00       	push   $0x80700c
+  80344f:	e8 20 07 00 00       	call   803b74 <mutex_unlock>
+}
+  803454:	83 c4 10             	add    $0x10,%esp
+  803457:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80345a:	c9                   	leave
+  80345b:	c3                   	ret
+		sys_page_unmap(0, c);
+  80345c:	83 ec 08             	sub    $0x8,%esp
+  80345f:	53                   	push   %ebx
+  803460:	6a 00                	push   $0x0
+  803462:	e8 63 da ff ff       	call   800eca <sys_page_unmap>
+  803467:	83 c4 10             	add    $0x10,%esp
+  80346a:	eb db                	jmp    803447 <free+0xa4>
+
+0080346c <malloc>:
+{
+  80346c:	55                   	push   %ebp
+  80346d:	89 e5                	mov    %esp,%ebp
+  80346f:	57                   	push   %edi
+  803470:	56                   	push   %esi
+  803471:	53                   	push   %ebx
+  803472:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  803475:	68 0c 70 80 00       	push   $0x80700c
+  80347a:	e8 88 06 00 00       	call   803b07 <mutex_lock>
+	if (mptr == 0)
+  80347f:	8b 3d 10 70 80 00    	mov    0x807010,%edi
+  803485:	83 c4 10             	add    $0x10,%esp
+  803488:	85 ff                	test   %edi,%edi
+  80348a:	74 6c                	je     8034f8 <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  80348c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80348f:	83 c0 03             	add    $0x3,%eax
+  803492:	83 e0 fc             	and    $0xfffffffc,%eax
+  803495:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  803497:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  80349c:	0f 87 64 01 00 00    	ja     803606 <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  8034a2:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8034a8:	74 30                	je     8034da <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  8034aa:	89 f9                	mov    %edi,%ecx
+  8034ac:	c1 e9 0c             	shr    $0xc,%ecx
+  8034af:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  8034b3:	c1 e8 0c             	shr    $0xc,%eax
+  8034b6:	39 c1                	cmp    %eax,%ecx
+  8034b8:	74 5f                	je     803519 <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  8034ba:	83 ec 0c             	sub    $0xc,%esp
+  8034bd:	57                   	push   %edi
+  8034be:	e8 e0 fe ff ff       	call   8033a3 <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  8034c3:	a1 10 70 80 00       	mov    0x807010,%eax
+  8034c8:	05 00 10 00 00       	add    $0x1000,%eax
+  8034cd:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8034d2:	a3 10 70 80 00       	mov    %eax,0x807010
+  8034d7:	83 c4 10             	add    $0x10,%esp
+  8034da:	8b 0d 10 70 80 00    	mov    0x807010,%ecx
+{
+  8034e0:	ba 02 00 00 00       	mov    $0x2,%edx
+  8034e5:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  8034e9:	8d 7e 04             	lea    0x4(%esi),%edi
+  8034ec:	89 cb                	mov    %ecx,%ebx
+  8034ee:	01 f9                	add    %edi,%ecx
+  8034f0:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8034f3:	e9 8b 00 00 00       	jmp    803583 <malloc+0x117>
+		mptr = mbegin;
+  8034f8:	c7 05 10 70 80 00 00 	movl   $0x8000000,0x807010
+  8034ff:	00 00 08 
+	n = ROUNDUP(n, 4);
+  803502:	8b 45 08             	mov    0x8(%ebp),%eax
+  803505:	83 c0 03             	add    $0x3,%eax
+  803508:	83 e0 fc             	and    $0xfffffffc,%eax
+  80350b:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  80350d:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  803512:	76 c6                	jbe    8034da <malloc+0x6e>
+  803514:	e9 d6 00 00 00       	jmp    8035ef <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  803519:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  80351f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  803524:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  803528:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  80352b:	a3 10 70 80 00       	mov    %eax,0x807010
+			return v;
+  803530:	e9 ba 00 00 00       	jmp    8035ef <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  803535:	05 00 10 00 00       	add    $0x1000,%eax
+  80353a:	39 c8                	cmp    %ecx,%eax
+  80353c:	0f 83 cb 00 00 00    	jae    80360d <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  803542:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  803547:	77 22                	ja     80356b <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  803549:	89 c2                	mov    %eax,%edx
+  80354b:	c1 ea 16             	shr    $0x16,%edx
+  80354e:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  803555:	f6 c2 01             	test   $0x1,%dl
+  803558:	74 db                	je     803535 <malloc+0xc9>
+  80355a:	89 c2                	mov    %eax,%edx
+  80355c:	c1 ea 0c             	shr    $0xc,%edx
+  80355f:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  803566:	f6 c2 01             	test   $0x1,%dl
+  803569:	74 ca                	je     803535 <malloc+0xc9>
+		if (mptr == mend) {
+  80356b:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803571:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  803577:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  80357b:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  803581:	74 04                	je     803587 <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  803583:	89 d8                	mov    %ebx,%eax
+  803585:	eb b3                	jmp    80353a <malloc+0xce>
+  803587:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  80358a:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  80358f:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  803593:	83 ea 01             	sub    $0x1,%edx
+  803596:	0f 85 50 ff ff ff    	jne    8034ec <malloc+0x80>
+  80359c:	c7 05 10 70 80 00 00 	movl   $0x8000000,0x807010
+  8035a3:	00 00 08 
+				return 0;	/* out of address space */
+  8035a6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035ab:	eb 42                	jmp    8035ef <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  8035ad:	85 db                	test   %ebx,%ebx
+  8035af:	78 1e                	js     8035cf <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  8035b1:	83 ec 08             	sub    $0x8,%esp
+  8035b4:	89 d8                	mov    %ebx,%eax
+  8035b6:	03 05 10 70 80 00    	add    0x807010,%eax
+  8035bc:	50                   	push   %eax
+  8035bd:	6a 00                	push   $0x0
+  8035bf:	e8 06 d9 ff ff       	call   800eca <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  8035c4:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  8035ca:	83 c4 10             	add    $0x10,%esp
+  8035cd:	eb de                	jmp    8035ad <malloc+0x141>
+			return 0;	/* out of physical memory */
+  8035cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035d4:	eb 19                	jmp    8035ef <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  8035d6:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8035d9:	8b 3d 10 70 80 00    	mov    0x807010,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  8035df:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  8035e6:	00 
+	mptr += n;
+  8035e7:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  8035ea:	a3 10 70 80 00       	mov    %eax,0x807010
+	mutex_unlock(&malloc_mu);
+  8035ef:	83 ec 0c             	sub    $0xc,%esp
+  8035f2:	68 0c 70 80 00       	push   $0x80700c
+  8035f7:	e8 78 05 00 00       	call   803b74 <mutex_unlock>
+}
+  8035fc:	89 f8                	mov    %edi,%eax
+  8035fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803601:	5b                   	pop    %ebx
+  803602:	5e                   	pop    %esi
+  803603:	5f                   	pop    %edi
+  803604:	5d                   	pop    %ebp
+  803605:	c3                   	ret
+		return 0;
+  803606:	bf 00 00 00 00       	mov    $0x0,%edi
+  80360b:	eb e2                	jmp    8035ef <malloc+0x183>
+  80360d:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  803611:	74 06                	je     803619 <malloc+0x1ad>
+  803613:	89 1d 10 70 80 00    	mov    %ebx,0x807010
+	for (i = 0; i < n + 4; i += PGSIZE){
+  803619:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80361e:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803621:	39 fb                	cmp    %edi,%ebx
+  803623:	73 b1                	jae    8035d6 <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  803625:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  80362b:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  80362e:	39 fe                	cmp    %edi,%esi
+  803630:	0f 92 c0             	setb   %al
+  803633:	0f b6 c0             	movzbl %al,%eax
+  803636:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  803639:	83 c8 07             	or     $0x7,%eax
+  80363c:	50                   	push   %eax
+  80363d:	89 d8                	mov    %ebx,%eax
+  80363f:	03 05 10 70 80 00    	add    0x807010,%eax
+  803645:	50                   	push   %eax
+  803646:	6a 00                	push   $0x0
+  803648:	e8 e4 d7 ff ff       	call   800e31 <sys_page_alloc>
+  80364d:	83 c4 10             	add    $0x10,%esp
+  803650:	85 c0                	test   %eax,%eax
+  803652:	0f 88 55 ff ff ff    	js     8035ad <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  803658:	89 f3                	mov    %esi,%ebx
+  80365a:	eb c5                	jmp    803621 <malloc+0x1b5>
+
+0080365c <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80365c:	55                   	push   %ebp
+  80365d:	89 e5                	mov    %esp,%ebp
+  80365f:	56                   	push   %esi
+  803660:	53                   	push   %ebx
+  803661:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803664:	83 ec 0c             	sub    $0xc,%esp
+  803667:	ff 75 08             	push   0x8(%ebp)
+  80366a:	e8 ea e2 ff ff       	call   801959 <fd2data>
+  80366f:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  803671:	83 c4 08             	add    $0x8,%esp
+  803674:	68 d7 50 80 00       	push   $0x8050d7
+  803679:	53                   	push   %ebx
+  80367a:	e8 74 d3 ff ff       	call   8009f3 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  80367f:	8b 46 04             	mov    0x4(%esi),%eax
+  803682:	2b 06                	sub    (%esi),%eax
+  803684:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  80368a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803691:	00 00 00 
+	stat->st_dev = &devpipe;
+  803694:	c7 83 88 00 00 00 7c 	movl   $0x80627c,0x88(%ebx)
+  80369b:	62 80 00 
+	return 0;
+}
+  80369e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036a3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8036a6:	5b                   	pop    %ebx
+  8036a7:	5e                   	pop    %esi
+  8036a8:	5d                   	pop    %ebp
+  8036a9:	c3                   	ret
+
+008036aa <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  8036aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8036af:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  8036b3:	85 c9                	test   %ecx,%ecx
+  8036b5:	75 01                	jne    8036b8 <pipewake+0xe>
+  8036b7:	c3                   	ret
+{
+  8036b8:	55                   	push   %ebp
+  8036b9:	89 e5                	mov    %esp,%ebp
+  8036bb:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  8036be:	68 00 04 00 00       	push   $0x400
+  8036c3:	52                   	push   %edx
+  8036c4:	e8 ac da ff ff       	call   801175 <sys_futex_wake>
+  8036c9:	83 c4 10             	add    $0x10,%esp
+}
+  8036cc:	c9                   	leave
+  8036cd:	c3                   	ret
+
+008036ce <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8036ce:	55                   	push   %ebp
+  8036cf:	89 e5                	mov    %esp,%ebp
+  8036d1:	56                   	push   %esi
+  8036d2:	53                   	push   %ebx
+  8036d3:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8036d6:	83 ec 0c             	sub    $0xc,%esp
+  8036d9:	56                   	push   %esi
+  8036da:	e8 7a e2 ff ff       	call   801959 <fd2data>
+  8036df:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  8036e1:	83 c4 08             	add    $0x8,%esp
+  8036e4:	56                   	push   %esi
+  8036e5:	6a 00                	push   $0x0
+  8036e7:	e8 de d7 ff ff       	call   800eca <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  8036ec:	8d 53 04             	lea    0x4(%ebx),%edx
+  8036ef:	8d 43 08             	lea    0x8(%ebx),%eax
+  8036f2:	e8 b3 ff ff ff       	call   8036aa <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  8036f7:	8d 43 0c             	lea    0xc(%ebx),%eax
+  8036fa:	89 da                	mov    %ebx,%edx
+  8036fc:	e8 a9 ff ff ff       	call   8036aa <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  803701:	89 34 24             	mov    %esi,(%esp)
+  803704:	e8 50 e2 ff ff       	call   801959 <fd2data>
+  803709:	83 c4 08             	add    $0x8,%esp
+  80370c:	50                   	push   %eax
+  80370d:	6a 00                	push   $0x0
+  80370f:	e8 b6 d7 ff ff       	call   800eca <sys_page_unmap>
+}
+  803714:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803717:	5b                   	pop    %ebx
+  803718:	5e                   	pop    %esi
+  803719:	5d                   	pop    %ebp
+  80371a:	c3                   	ret
+
+0080371b <_pipeisclosed>:
+{
+  80371b:	55                   	push   %ebp
+  80371c:	89 e5                	mov    %esp,%ebp
+  80371e:	57                   	push   %edi
+  80371f:	56                   	push   %esi
+  803720:	53                   	push   %ebx
+  803721:	83 ec 1c             	sub    $0x1c,%esp
+  803724:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803727:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803729:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  80372e:	eb 5d                	jmp    80378d <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  803730:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		n = thisenv->env_runs;
+  803736:	8b 02                	mov    (%edx),%eax
+  803738:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  80373b:	83 ec 0c             	sub    $0xc,%esp
+  80373e:	ff 75 e0             	push   -0x20(%ebp)
+  803741:	e8 30 0f 00 00       	call   804676 <pageref>
+  803746:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803749:	89 3c 24             	mov    %edi,(%esp)
+  80374c:	e8 25 0f 00 00       	call   804676 <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  803751:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803753:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  803759:	83 c4 10             	add    $0x10,%esp
+  80375c:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803762:	77 15                	ja     803779 <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803764:	89 f2                	mov    %esi,%edx
+  803766:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  803768:	c1 ea 10             	shr    $0x10,%edx
+  80376b:	74 0c                	je     803779 <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80376d:	c1 e2 10             	shl    $0x10,%edx
+  803770:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  803775:	29 d1                	sub    %edx,%ecx
+  803777:	eb 06                	jmp    80377f <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  803779:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		nn = thisenv->env_runs;
+  80377f:	8b 11                	mov    (%ecx),%edx
+  803781:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  803784:	39 d3                	cmp    %edx,%ebx
+  803786:	74 6e                	je     8037f6 <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  803788:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80378b:	74 24                	je     8037b1 <_pipeisclosed+0x96>
+  80378d:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80378f:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803795:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80379a:	77 94                	ja     803730 <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80379c:	89 f0                	mov    %esi,%eax
+  80379e:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8037a0:	c1 e8 10             	shr    $0x10,%eax
+  8037a3:	74 8b                	je     803730 <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8037a5:	c1 e0 10             	shl    $0x10,%eax
+  8037a8:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8037ad:	29 c2                	sub    %eax,%edx
+  8037af:	eb 85                	jmp    803736 <_pipeisclosed+0x1b>
+  8037b1:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8037b3:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8037b9:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8037be:	77 18                	ja     8037d8 <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8037c0:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8037c5:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8037c7:	c1 e8 10             	shr    $0x10,%eax
+  8037ca:	74 0c                	je     8037d8 <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8037cc:	c1 e0 10             	shl    $0x10,%eax
+  8037cf:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8037d4:	29 c2                	sub    %eax,%edx
+  8037d6:	eb 06                	jmp    8037de <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  8037d8:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8037de:	8b 02                	mov    (%edx),%eax
+  8037e0:	8b 40 58             	mov    0x58(%eax),%eax
+  8037e3:	6a 01                	push   $0x1
+  8037e5:	50                   	push   %eax
+  8037e6:	53                   	push   %ebx
+  8037e7:	68 de 50 80 00       	push   $0x8050de
+  8037ec:	e8 1e cc ff ff       	call   80040f <cprintf>
+  8037f1:	83 c4 10             	add    $0x10,%esp
+  8037f4:	eb 97                	jmp    80378d <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  8037f6:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8037f9:	0f 94 c0             	sete   %al
+  8037fc:	0f b6 c0             	movzbl %al,%eax
+}
+  8037ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803802:	5b                   	pop    %ebx
+  803803:	5e                   	pop    %esi
+  803804:	5f                   	pop    %edi
+  803805:	5d                   	pop    %ebp
+  803806:	c3                   	ret
+
+00803807 <devpipe_write>:
+{
+  803807:	55                   	push   %ebp
+  803808:	89 e5                	mov    %esp,%ebp
+  80380a:	57                   	push   %edi
+  80380b:	56                   	push   %esi
+  80380c:	53                   	push   %ebx
+  80380d:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  803810:	ff 75 08             	push   0x8(%ebp)
+  803813:	e8 41 e1 ff ff       	call   801959 <fd2data>
+  803818:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80381a:	83 c4 10             	add    $0x10,%esp
+  80381d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  803824:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  803827:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80382a:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80382d:	0f 84 96 00 00 00    	je     8038c9 <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  803833:	8d 73 08             	lea    0x8(%ebx),%esi
+  803836:	eb 32                	jmp    80386a <devpipe_write+0x63>
+  803838:	89 fa                	mov    %edi,%edx
+  80383a:	89 f0                	mov    %esi,%eax
+  80383c:	e8 69 fe ff ff       	call   8036aa <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  803841:	8b 43 04             	mov    0x4(%ebx),%eax
+  803844:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  803847:	ba 01 00 00 00       	mov    $0x1,%edx
+  80384c:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  803851:	83 ec 04             	sub    $0x4,%esp
+  803854:	6a 0a                	push   $0xa
+  803856:	50                   	push   %eax
+  803857:	53                   	push   %ebx
+  803858:	e8 e9 d8 ff ff       	call   801146 <sys_futex_wait>
+  80385d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803862:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  803867:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80386a:	8b 43 04             	mov    0x4(%ebx),%eax
+  80386d:	8b 0b                	mov    (%ebx),%ecx
+  80386f:	8d 51 20             	lea    0x20(%ecx),%edx
+  803872:	39 d0                	cmp    %edx,%eax
+  803874:	72 1b                	jb     803891 <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  803876:	89 da                	mov    %ebx,%edx
+  803878:	8b 45 08             	mov    0x8(%ebp),%eax
+  80387b:	e8 9b fe ff ff       	call   80371b <_pipeisclosed>
+  803880:	85 c0                	test   %eax,%eax
+  803882:	74 b4                	je     803838 <devpipe_write+0x31>
+				return 0;
+  803884:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803889:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80388c:	5b                   	pop    %ebx
+  80388d:	5e                   	pop    %esi
+  80388e:	5f                   	pop    %edi
+  80388f:	5d                   	pop    %ebp
+  803890:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803891:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803894:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803897:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  80389b:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  80389e:	89 c2                	mov    %eax,%edx
+  8038a0:	c1 fa 1f             	sar    $0x1f,%edx
+  8038a3:	89 d1                	mov    %edx,%ecx
+  8038a5:	c1 e9 1b             	shr    $0x1b,%ecx
+  8038a8:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8038ab:	83 e2 1f             	and    $0x1f,%edx
+  8038ae:	29 ca                	sub    %ecx,%edx
+  8038b0:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  8038b4:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  8038b8:	83 c0 01             	add    $0x1,%eax
+  8038bb:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8038be:	83 c6 01             	add    $0x1,%esi
+  8038c1:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8038c4:	e9 5e ff ff ff       	jmp    803827 <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  8038c9:	8d 53 04             	lea    0x4(%ebx),%edx
+  8038cc:	8d 43 08             	lea    0x8(%ebx),%eax
+  8038cf:	e8 d6 fd ff ff       	call   8036aa <pipewake>
+	return i;
+  8038d4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8038d7:	eb b0                	jmp    803889 <devpipe_write+0x82>
+
+008038d9 <devpipe_read>:
+{
+  8038d9:	55                   	push   %ebp
+  8038da:	89 e5                	mov    %esp,%ebp
+  8038dc:	57                   	push   %edi
+  8038dd:	56                   	push   %esi
+  8038de:	53                   	push   %ebx
+  8038df:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  8038e2:	ff 75 08             	push   0x8(%ebp)
+  8038e5:	e8 6f e0 ff ff       	call   801959 <fd2data>
+  8038ea:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8038ec:	83 c4 10             	add    $0x10,%esp
+  8038ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8038f4:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8038f7:	74 6c                	je     803965 <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  8038f9:	8d 7b 04             	lea    0x4(%ebx),%edi
+  8038fc:	eb 25                	jmp    803923 <devpipe_read+0x4a>
+  8038fe:	8b 13                	mov    (%ebx),%edx
+  803900:	b8 01 00 00 00       	mov    $0x1,%eax
+  803905:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  80390a:	83 ec 04             	sub    $0x4,%esp
+  80390d:	6a 0a                	push   $0xa
+  80390f:	52                   	push   %edx
+  803910:	57                   	push   %edi
+  803911:	e8 30 d8 ff ff       	call   801146 <sys_futex_wait>
+  803916:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80391b:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  803920:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  803923:	8b 03                	mov    (%ebx),%eax
+  803925:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803928:	75 19                	jne    803943 <devpipe_read+0x6a>
+			if (i > 0)
+  80392a:	85 f6                	test   %esi,%esi
+  80392c:	75 3a                	jne    803968 <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  80392e:	89 da                	mov    %ebx,%edx
+  803930:	8b 45 08             	mov    0x8(%ebp),%eax
+  803933:	e8 e3 fd ff ff       	call   80371b <_pipeisclosed>
+  803938:	85 c0                	test   %eax,%eax
+  80393a:	74 c2                	je     8038fe <devpipe_read+0x25>
+				return 0;
+  80393c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803941:	eb 31                	jmp    803974 <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803943:	89 c1                	mov    %eax,%ecx
+  803945:	c1 f9 1f             	sar    $0x1f,%ecx
+  803948:	c1 e9 1b             	shr    $0x1b,%ecx
+  80394b:	01 c8                	add    %ecx,%eax
+  80394d:	83 e0 1f             	and    $0x1f,%eax
+  803950:	29 c8                	sub    %ecx,%eax
+  803952:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  803957:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80395a:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80395d:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  803960:	83 c6 01             	add    $0x1,%esi
+  803963:	eb 8f                	jmp    8038f4 <devpipe_read+0x1b>
+out:
+  803965:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  803968:	8d 43 0c             	lea    0xc(%ebx),%eax
+  80396b:	89 da                	mov    %ebx,%edx
+  80396d:	e8 38 fd ff ff       	call   8036aa <pipewake>
+	return i;
+  803972:	89 f0                	mov    %esi,%eax
+}
+  803974:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803977:	5b                   	pop    %ebx
+  803978:	5e                   	pop    %esi
+  803979:	5f                   	pop    %edi
+  80397a:	5d                   	pop    %ebp
+  80397b:	c3                   	ret
+
+0080397c <pipe>:
+{
+  80397c:	55                   	push   %ebp
+  80397d:	89 e5                	mov    %esp,%ebp
+  80397f:	56                   	push   %esi
+  803980:	53                   	push   %ebx
+  803981:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803984:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803987:	50                   	push   %eax
+  803988:	e8 e3 df ff ff       	call   801970 <fd_alloc>
+  80398d:	89 c3                	mov    %eax,%ebx
+  80398f:	83 c4 10             	add    $0x10,%esp
+  803992:	85 c0                	test   %eax,%eax
+  803994:	0f 88 23 01 00 00    	js     803abd <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80399a:	83 ec 04             	sub    $0x4,%esp
+  80399d:	68 07 04 00 00       	push   $0x407
+  8039a2:	ff 75 f4             	push   -0xc(%ebp)
+  8039a5:	6a 00                	push   $0x0
+  8039a7:	e8 85 d4 ff ff       	call   800e31 <sys_page_alloc>
+  8039ac:	89 c3                	mov    %eax,%ebx
+  8039ae:	83 c4 10             	add    $0x10,%esp
+  8039b1:	85 c0                	test   %eax,%eax
+  8039b3:	0f 88 04 01 00 00    	js     803abd <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8039b9:	83 ec 0c             	sub    $0xc,%esp
+  8039bc:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8039bf:	50                   	push   %eax
+  8039c0:	e8 ab df ff ff       	call   801970 <fd_alloc>
+  8039c5:	89 c3                	mov    %eax,%ebx
+  8039c7:	83 c4 10             	add    $0x10,%esp
+  8039ca:	85 c0                	test   %eax,%eax
+  8039cc:	0f 88 db 00 00 00    	js     803aad <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8039d2:	83 ec 04             	sub    $0x4,%esp
+  8039d5:	68 07 04 00 00       	push   $0x407
+  8039da:	ff 75 f0             	push   -0x10(%ebp)
+  8039dd:	6a 00                	push   $0x0
+  8039df:	e8 4d d4 ff ff       	call   800e31 <sys_page_alloc>
+  8039e4:	89 c3                	mov    %eax,%ebx
+  8039e6:	83 c4 10             	add    $0x10,%esp
+  8039e9:	85 c0                	test   %eax,%eax
+  8039eb:	0f 88 bc 00 00 00    	js     803aad <pipe+0x131>
+	va = fd2data(fd0);
+  8039f1:	83 ec 0c             	sub    $0xc,%esp
+  8039f4:	ff 75 f4             	push   -0xc(%ebp)
+  8039f7:	e8 5d df ff ff       	call   801959 <fd2data>
+  8039fc:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8039fe:	83 c4 0c             	add    $0xc,%esp
+  803a01:	68 07 04 00 00       	push   $0x407
+  803a06:	50                   	push   %eax
+  803a07:	6a 00                	push   $0x0
+  803a09:	e8 23 d4 ff ff       	call   800e31 <sys_page_alloc>
+  803a0e:	89 c3                	mov    %eax,%ebx
+  803a10:	83 c4 10             	add    $0x10,%esp
+  803a13:	85 c0                	test   %eax,%eax
+  803a15:	0f 88 82 00 00 00    	js     803a9d <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803a1b:	83 ec 0c             	sub    $0xc,%esp
+  803a1e:	ff 75 f0             	push   -0x10(%ebp)
+  803a21:	e8 33 df ff ff       	call   801959 <fd2data>
+  803a26:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803a2d:	50                   	push   %eax
+  803a2e:	6a 00                	push   $0x0
+  803a30:	56                   	push   %esi
+  803a31:	6a 00                	push   $0x0
+  803a33:	e8 46 d4 ff ff       	call   800e7e <sys_page_map>
+  803a38:	89 c3                	mov    %eax,%ebx
+  803a3a:	83 c4 20             	add    $0x20,%esp
+  803a3d:	85 c0                	test   %eax,%eax
+  803a3f:	78 4e                	js     803a8f <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803a41:	a1 7c 62 80 00       	mov    0x80627c,%eax
+  803a46:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803a49:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803a4b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803a4e:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803a55:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803a58:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803a5a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803a5d:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803a64:	83 ec 0c             	sub    $0xc,%esp
+  803a67:	ff 75 f4             	push   -0xc(%ebp)
+  803a6a:	e8 da de ff ff       	call   801949 <fd2num>
+  803a6f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803a72:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803a74:	83 c4 04             	add    $0x4,%esp
+  803a77:	ff 75 f0             	push   -0x10(%ebp)
+  803a7a:	e8 ca de ff ff       	call   801949 <fd2num>
+  803a7f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803a82:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803a85:	83 c4 10             	add    $0x10,%esp
+  803a88:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803a8d:	eb 2e                	jmp    803abd <pipe+0x141>
+	sys_page_unmap(0, va);
+  803a8f:	83 ec 08             	sub    $0x8,%esp
+  803a92:	56                   	push   %esi
+  803a93:	6a 00                	push   $0x0
+  803a95:	e8 30 d4 ff ff       	call   800eca <sys_page_unmap>
+  803a9a:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803a9d:	83 ec 08             	sub    $0x8,%esp
+  803aa0:	ff 75 f0             	push   -0x10(%ebp)
+  803aa3:	6a 00                	push   $0x0
+  803aa5:	e8 20 d4 ff ff       	call   800eca <sys_page_unmap>
+  803aaa:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803aad:	83 ec 08             	sub    $0x8,%esp
+  803ab0:	ff 75 f4             	push   -0xc(%ebp)
+  803ab3:	6a 00                	push   $0x0
+  803ab5:	e8 10 d4 ff ff       	call   800eca <sys_page_unmap>
+  803aba:	83 c4 10             	add    $0x10,%esp
+}
+  803abd:	89 d8                	mov    %ebx,%eax
+  803abf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803ac2:	5b                   	pop    %ebx
+  803ac3:	5e                   	pop    %esi
+  803ac4:	5d                   	pop    %ebp
+  803ac5:	c3                   	ret
+
+00803ac6 <pipeisclosed>:
+{
+  803ac6:	55                   	push   %ebp
+  803ac7:	89 e5                	mov    %esp,%ebp
+  803ac9:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803acc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803acf:	50                   	push   %eax
+  803ad0:	ff 75 08             	push   0x8(%ebp)
+  803ad3:	e8 ee de ff ff       	call   8019c6 <fd_lookup>
+  803ad8:	83 c4 10             	add    $0x10,%esp
+  803adb:	85 c0                	test   %eax,%eax
+  803add:	78 18                	js     803af7 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803adf:	83 ec 0c             	sub    $0xc,%esp
+  803ae2:	ff 75 f4             	push   -0xc(%ebp)
+  803ae5:	e8 6f de ff ff       	call   801959 <fd2data>
+  803aea:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803aec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803aef:	e8 27 fc ff ff       	call   80371b <_pipeisclosed>
+  803af4:	83 c4 10             	add    $0x10,%esp
+}
+  803af7:	c9                   	leave
+  803af8:	c3                   	ret
+
+00803af9 <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  803af9:	55                   	push   %ebp
+  803afa:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  803afc:	8b 45 08             	mov    0x8(%ebp),%eax
+  803aff:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803b05:	5d                   	pop    %ebp
+  803b06:	c3                   	ret
+
+00803b07 <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  803b07:	55                   	push   %ebp
+  803b08:	89 e5                	mov    %esp,%ebp
+  803b0a:	56                   	push   %esi
+  803b0b:	53                   	push   %ebx
+  803b0c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803b0f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803b14:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803b19:	89 d0                	mov    %edx,%eax
+  803b1b:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  803b1f:	85 c0                	test   %eax,%eax
+  803b21:	74 2d                	je     803b50 <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  803b23:	83 f8 02             	cmp    $0x2,%eax
+  803b26:	74 08                	je     803b30 <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  803b28:	b8 02 00 00 00       	mov    $0x2,%eax
+  803b2d:	f0 87 03             	lock xchg %eax,(%ebx)
+  803b30:	be 02 00 00 00       	mov    $0x2,%esi
+  803b35:	eb 15                	jmp    803b4c <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  803b37:	83 ec 04             	sub    $0x4,%esp
+  803b3a:	6a 00                	push   $0x0
+  803b3c:	6a 02                	push   $0x2
+  803b3e:	53                   	push   %ebx
+  803b3f:	e8 02 d6 ff ff       	call   801146 <sys_futex_wait>
+  803b44:	89 f0                	mov    %esi,%eax
+  803b46:	f0 87 03             	lock xchg %eax,(%ebx)
+  803b49:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  803b4c:	85 c0                	test   %eax,%eax
+  803b4e:	75 e7                	jne    803b37 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  803b50:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803b53:	5b                   	pop    %ebx
+  803b54:	5e                   	pop    %esi
+  803b55:	5d                   	pop    %ebp
+  803b56:	c3                   	ret
+
+00803b57 <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  803b57:	55                   	push   %ebp
+  803b58:	89 e5                	mov    %esp,%ebp
+  803b5a:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803b5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b62:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803b67:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  803b6b:	f7 d8                	neg    %eax
+  803b6d:	19 c0                	sbb    %eax,%eax
+  803b6f:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  803b72:	5d                   	pop    %ebp
+  803b73:	c3                   	ret
+
+00803b74 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  803b74:	55                   	push   %ebp
+  803b75:	89 e5                	mov    %esp,%ebp
+  803b77:	83 ec 08             	sub    $0x8,%esp
+  803b7a:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  803b7d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b82:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  803b85:	83 f8 02             	cmp    $0x2,%eax
+  803b88:	74 02                	je     803b8c <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  803b8a:	c9                   	leave
+  803b8b:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  803b8c:	83 ec 08             	sub    $0x8,%esp
+  803b8f:	6a 01                	push   $0x1
+  803b91:	52                   	push   %edx
+  803b92:	e8 de d5 ff ff       	call   801175 <sys_futex_wake>
+  803b97:	83 c4 10             	add    $0x10,%esp
+}
+  803b9a:	eb ee                	jmp    803b8a <mutex_unlock+0x16>
+
+00803b9c <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  803b9c:	55                   	push   %ebp
+  803b9d:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  803b9f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803ba2:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803ba8:	5d                   	pop    %ebp
+  803ba9:	c3                   	ret
+
+00803baa <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  803baa:	55                   	push   %ebp
+  803bab:	89 e5                	mov    %esp,%ebp
+  803bad:	57                   	push   %edi
+  803bae:	56                   	push   %esi
+  803baf:	53                   	push   %ebx
+  803bb0:	83 ec 18             	sub    $0x18,%esp
+  803bb3:	8b 75 08             	mov    0x8(%ebp),%esi
+  803bb6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  803bb9:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  803bbb:	53                   	push   %ebx
+  803bbc:	e8 b3 ff ff ff       	call   803b74 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  803bc1:	83 c4 0c             	add    $0xc,%esp
+  803bc4:	ff 75 10             	push   0x10(%ebp)
+  803bc7:	57                   	push   %edi
+  803bc8:	56                   	push   %esi
+  803bc9:	e8 78 d5 ff ff       	call   801146 <sys_futex_wait>
+  803bce:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  803bd0:	83 c4 10             	add    $0x10,%esp
+  803bd3:	be 02 00 00 00       	mov    $0x2,%esi
+  803bd8:	eb 10                	jmp    803bea <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  803bda:	83 ec 04             	sub    $0x4,%esp
+  803bdd:	6a 00                	push   $0x0
+  803bdf:	6a 02                	push   $0x2
+  803be1:	53                   	push   %ebx
+  803be2:	e8 5f d5 ff ff       	call   801146 <sys_futex_wait>
+  803be7:	83 c4 10             	add    $0x10,%esp
+  803bea:	89 f0                	mov    %esi,%eax
+  803bec:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  803bef:	85 c0                	test   %eax,%eax
+  803bf1:	75 e7                	jne    803bda <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  803bf3:	83 ff ec             	cmp    $0xffffffec,%edi
+  803bf6:	74 05                	je     803bfd <cond_timedwait+0x53>
+  803bf8:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803bfd:	89 f8                	mov    %edi,%eax
+  803bff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c02:	5b                   	pop    %ebx
+  803c03:	5e                   	pop    %esi
+  803c04:	5f                   	pop    %edi
+  803c05:	5d                   	pop    %ebp
+  803c06:	c3                   	ret
+
+00803c07 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  803c07:	55                   	push   %ebp
+  803c08:	89 e5                	mov    %esp,%ebp
+  803c0a:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  803c0d:	6a 00                	push   $0x0
+  803c0f:	ff 75 0c             	push   0xc(%ebp)
+  803c12:	ff 75 08             	push   0x8(%ebp)
+  803c15:	e8 90 ff ff ff       	call   803baa <cond_timedwait>
+}
+  803c1a:	83 c4 10             	add    $0x10,%esp
+  803c1d:	c9                   	leave
+  803c1e:	c3                   	ret
+
+00803c1f <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  803c1f:	55                   	push   %ebp
+  803c20:	89 e5                	mov    %esp,%ebp
+  803c22:	83 ec 10             	sub    $0x10,%esp
+  803c25:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  803c28:	ba 01 00 00 00       	mov    $0x1,%edx
+  803c2d:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  803c31:	6a 01                	push   $0x1
+  803c33:	50                   	push   %eax
+  803c34:	e8 3c d5 ff ff       	call   801175 <sys_futex_wake>
+}
+  803c39:	83 c4 10             	add    $0x10,%esp
+  803c3c:	c9                   	leave
+  803c3d:	c3                   	ret
+
+00803c3e <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  803c3e:	55                   	push   %ebp
+  803c3f:	89 e5                	mov    %esp,%ebp
+  803c41:	83 ec 10             	sub    $0x10,%esp
+  803c44:	8b 45 08             	mov    0x8(%ebp),%eax
+  803c47:	ba 01 00 00 00       	mov    $0x1,%edx
+  803c4c:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  803c50:	68 00 04 00 00       	push   $0x400
+  803c55:	50                   	push   %eax
+  803c56:	e8 1a d5 ff ff       	call   801175 <sys_futex_wake>
+}
+  803c5b:	83 c4 10             	add    $0x10,%esp
+  803c5e:	c9                   	leave
+  803c5f:	c3                   	ret
+
+00803c60 <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  803c60:	55                   	push   %ebp
+  803c61:	89 e5                	mov    %esp,%ebp
+  803c63:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  803c66:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803c69:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  803c6b:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  803c72:	5d                   	pop    %ebp
+  803c73:	c3                   	ret
+
+00803c74 <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  803c74:	55                   	push   %ebp
+  803c75:	89 e5                	mov    %esp,%ebp
+  803c77:	53                   	push   %ebx
+  803c78:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  803c7b:	8b 11                	mov    (%ecx),%edx
+  803c7d:	85 d2                	test   %edx,%edx
+  803c7f:	74 14                	je     803c95 <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  803c81:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803c84:	89 d0                	mov    %edx,%eax
+  803c86:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  803c8a:	39 c2                	cmp    %eax,%edx
+  803c8c:	75 ed                	jne    803c7b <sem_trywait+0x7>
+			return 0;
+  803c8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c93:	eb 05                	jmp    803c9a <sem_trywait+0x26>
+	return -E_AGAIN;
+  803c95:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  803c9a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803c9d:	c9                   	leave
+  803c9e:	c3                   	ret
+
+00803c9f <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  803c9f:	55                   	push   %ebp
+  803ca0:	89 e5                	mov    %esp,%ebp
+  803ca2:	57                   	push   %edi
+  803ca3:	56                   	push   %esi
+  803ca4:	53                   	push   %ebx
+  803ca5:	83 ec 1c             	sub    $0x1c,%esp
+  803ca8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803cab:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  803cae:	e8 0b d4 ff ff       	call   8010be <sys_time_msec>
+  803cb3:	01 f8                	add    %edi,%eax
+  803cb5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  803cb8:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  803cbd:	eb 28                	jmp    803ce7 <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  803cbf:	b8 01 00 00 00       	mov    $0x1,%eax
+  803cc4:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  803cc9:	83 ec 04             	sub    $0x4,%esp
+  803ccc:	56                   	push   %esi
+  803ccd:	6a 00                	push   $0x0
+  803ccf:	53                   	push   %ebx
+  803cd0:	e8 71 d4 ff ff       	call   801146 <sys_futex_wait>
+  803cd5:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  803cda:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  803cdf:	83 c4 10             	add    $0x10,%esp
+  803ce2:	83 f8 ec             	cmp    $0xffffffec,%eax
+  803ce5:	74 2e                	je     803d15 <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  803ce7:	83 ec 0c             	sub    $0xc,%esp
+  803cea:	53                   	push   %ebx
+  803ceb:	e8 84 ff ff ff       	call   803c74 <sem_trywait>
+  803cf0:	83 c4 10             	add    $0x10,%esp
+  803cf3:	85 c0                	test   %eax,%eax
+  803cf5:	79 19                	jns    803d10 <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  803cf7:	85 ff                	test   %edi,%edi
+  803cf9:	74 c4                	je     803cbf <sem_timedwait+0x20>
+  803cfb:	e8 be d3 ff ff       	call   8010be <sys_time_msec>
+  803d00:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803d03:	29 c6                	sub    %eax,%esi
+  803d05:	85 f6                	test   %esi,%esi
+  803d07:	7f b6                	jg     803cbf <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  803d09:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  803d0e:	eb 05                	jmp    803d15 <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  803d10:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d18:	5b                   	pop    %ebx
+  803d19:	5e                   	pop    %esi
+  803d1a:	5f                   	pop    %edi
+  803d1b:	5d                   	pop    %ebp
+  803d1c:	c3                   	ret
+
+00803d1d <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  803d1d:	55                   	push   %ebp
+  803d1e:	89 e5                	mov    %esp,%ebp
+  803d20:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  803d23:	6a 00                	push   $0x0
+  803d25:	ff 75 08             	push   0x8(%ebp)
+  803d28:	e8 72 ff ff ff       	call   803c9f <sem_timedwait>
+}
+  803d2d:	83 c4 10             	add    $0x10,%esp
+  803d30:	c9                   	leave
+  803d31:	c3                   	ret
+
+00803d32 <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  803d32:	55                   	push   %ebp
+  803d33:	89 e5                	mov    %esp,%ebp
+  803d35:	83 ec 08             	sub    $0x8,%esp
+  803d38:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d3b:	ba 01 00 00 00       	mov    $0x1,%edx
+  803d40:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  803d44:	8b 50 04             	mov    0x4(%eax),%edx
+  803d47:	85 d2                	test   %edx,%edx
+  803d49:	75 02                	jne    803d4d <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  803d4b:	c9                   	leave
+  803d4c:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  803d4d:	83 ec 08             	sub    $0x8,%esp
+  803d50:	6a 01                	push   $0x1
+  803d52:	50                   	push   %eax
+  803d53:	e8 1d d4 ff ff       	call   801175 <sys_futex_wake>
+  803d58:	83 c4 10             	add    $0x10,%esp
+}
+  803d5b:	eb ee                	jmp    803d4b <sem_post+0x19>
+
+00803d5d <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  803d5d:	55                   	push   %ebp
+  803d5e:	89 e5                	mov    %esp,%ebp
+  803d60:	57                   	push   %edi
+  803d61:	56                   	push   %esi
+  803d62:	53                   	push   %ebx
+  803d63:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  803d66:	68 20 70 80 00       	push   $0x807020
+  803d6b:	e8 97 fd ff ff       	call   803b07 <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  803d70:	a1 44 70 80 00       	mov    0x807044,%eax
+  803d75:	83 c4 10             	add    $0x10,%esp
+  803d78:	85 c0                	test   %eax,%eax
+  803d7a:	75 19                	jne    803d95 <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  803d7c:	a1 c0 72 80 00       	mov    0x8072c0,%eax
+  803d81:	8b 00                	mov    (%eax),%eax
+  803d83:	8b 40 48             	mov    0x48(%eax),%eax
+  803d86:	a3 40 70 80 00       	mov    %eax,0x807040
+		threads[0].th_state = PTH_RUNNING;
+  803d8b:	c7 05 44 70 80 00 01 	movl   $0x1,0x807044
+  803d92:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803d95:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  803d9a:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803d9d:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803da4:	8b 40 04             	mov    0x4(%eax),%eax
+  803da7:	85 c0                	test   %eax,%eax
+  803da9:	0f 84 e4 00 00 00    	je     803e93 <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803daf:	83 c3 01             	add    $0x1,%ebx
+  803db2:	83 fb 20             	cmp    $0x20,%ebx
+  803db5:	75 e3                	jne    803d9a <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  803db7:	83 ec 0c             	sub    $0xc,%esp
+  803dba:	68 20 70 80 00       	push   $0x807020
+  803dbf:	e8 b0 fd ff ff       	call   803b74 <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  803dc4:	83 c4 10             	add    $0x10,%esp
+  803dc7:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  803dcc:	e9 b8 00 00 00       	jmp    803e89 <pthread_create+0x12c>
+  803dd1:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  803dd4:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  803dd7:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  803dd9:	39 f3                	cmp    %esi,%ebx
+  803ddb:	73 16                	jae    803df3 <pthread_create+0x96>
+		va -= PGSIZE;
+  803ddd:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  803de3:	83 ec 08             	sub    $0x8,%esp
+  803de6:	56                   	push   %esi
+  803de7:	6a 00                	push   $0x0
+  803de9:	e8 dc d0 ff ff       	call   800eca <sys_page_unmap>
+  803dee:	83 c4 10             	add    $0x10,%esp
+  803df1:	eb e6                	jmp    803dd9 <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  803df3:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803df6:	83 ec 08             	sub    $0x8,%esp
+  803df9:	ff 75 e4             	push   -0x1c(%ebp)
+  803dfc:	6a 00                	push   $0x0
+  803dfe:	e8 c7 d0 ff ff       	call   800eca <sys_page_unmap>
+	return r;
+  803e03:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  803e06:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803e09:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803e10:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  803e17:	eb 70                	jmp    803e89 <pthread_create+0x12c>
+	th->th_fn = fn;
+  803e19:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803e1c:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803e23:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803e26:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  803e29:	8b 55 10             	mov    0x10(%ebp),%edx
+  803e2c:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  803e2f:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  803e36:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  803e3b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803e3e:	29 c8                	sub    %ecx,%eax
+  803e40:	85 db                	test   %ebx,%ebx
+  803e42:	0f 44 05 c0 72 80 00 	cmove  0x8072c0,%eax
+	*--esp = t;
+  803e49:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  803e4c:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803e53:	83 ec 04             	sub    $0x4,%esp
+  803e56:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803e5b:	29 ca                	sub    %ecx,%edx
+  803e5d:	52                   	push   %edx
+	*--esp = 0;
+  803e5e:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803e61:	50                   	push   %eax
+  803e62:	68 ba 40 80 00       	push   $0x8040ba
+  803e67:	e8 ae d3 ff ff       	call   80121a <sys_thread_create>
+  803e6c:	89 c7                	mov    %eax,%edi
+  803e6e:	83 c4 10             	add    $0x10,%esp
+  803e71:	85 c0                	test   %eax,%eax
+  803e73:	78 91                	js     803e06 <pthread_create+0xa9>
+	th->th_env = id;
+  803e75:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803e78:	89 3c 85 40 70 80 00 	mov    %edi,0x807040(,%eax,4)
+	*tp = t;
+  803e7f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e82:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  803e84:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803e89:	89 f8                	mov    %edi,%eax
+  803e8b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e8e:	5b                   	pop    %ebx
+  803e8f:	5e                   	pop    %esi
+  803e90:	5f                   	pop    %edi
+  803e91:	5d                   	pop    %ebp
+  803e92:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  803e93:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803e96:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803e9d:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  803ea4:	83 ec 0c             	sub    $0xc,%esp
+  803ea7:	68 20 70 80 00       	push   $0x807020
+  803eac:	e8 c3 fc ff ff       	call   803b74 <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  803eb1:	89 d9                	mov    %ebx,%ecx
+  803eb3:	c1 e1 10             	shl    $0x10,%ecx
+  803eb6:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  803eb9:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  803ebe:	29 c8                	sub    %ecx,%eax
+  803ec0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  803ec3:	c1 e8 16             	shr    $0x16,%eax
+  803ec6:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803ecd:	83 c4 10             	add    $0x10,%esp
+  803ed0:	a8 01                	test   $0x1,%al
+  803ed2:	74 15                	je     803ee9 <pthread_create+0x18c>
+  803ed4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803ed7:	c1 e8 0c             	shr    $0xc,%eax
+  803eda:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803ee1:	a8 01                	test   $0x1,%al
+  803ee3:	0f 85 30 ff ff ff    	jne    803e19 <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803ee9:	83 ec 04             	sub    $0x4,%esp
+  803eec:	6a 07                	push   $0x7
+  803eee:	ff 75 e4             	push   -0x1c(%ebp)
+  803ef1:	6a 00                	push   $0x0
+  803ef3:	e8 39 cf ff ff       	call   800e31 <sys_page_alloc>
+  803ef8:	89 c7                	mov    %eax,%edi
+  803efa:	83 c4 10             	add    $0x10,%esp
+  803efd:	85 c0                	test   %eax,%eax
+  803eff:	0f 88 01 ff ff ff    	js     803e06 <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  803f05:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  803f0a:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  803f0d:	29 d0                	sub    %edx,%eax
+  803f0f:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  803f12:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803f14:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  803f19:	29 d0                	sub    %edx,%eax
+  803f1b:	89 c7                	mov    %eax,%edi
+  803f1d:	39 fe                	cmp    %edi,%esi
+  803f1f:	0f 83 f4 fe ff ff    	jae    803e19 <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803f25:	83 ec 04             	sub    $0x4,%esp
+  803f28:	6a 07                	push   $0x7
+  803f2a:	56                   	push   %esi
+  803f2b:	6a 00                	push   $0x0
+  803f2d:	e8 ff ce ff ff       	call   800e31 <sys_page_alloc>
+  803f32:	83 c4 10             	add    $0x10,%esp
+  803f35:	85 c0                	test   %eax,%eax
+  803f37:	0f 88 94 fe ff ff    	js     803dd1 <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803f3d:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803f43:	eb d8                	jmp    803f1d <pthread_create+0x1c0>
+
+00803f45 <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  803f45:	55                   	push   %ebp
+  803f46:	89 e5                	mov    %esp,%ebp
+  803f48:	57                   	push   %edi
+  803f49:	56                   	push   %esi
+  803f4a:	53                   	push   %ebx
+  803f4b:	83 ec 0c             	sub    $0xc,%esp
+  803f4e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  803f51:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  803f54:	83 f8 1e             	cmp    $0x1e,%eax
+  803f57:	0f 87 c7 00 00 00    	ja     804024 <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  803f5d:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803f5f:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803f65:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803f6a:	77 12                	ja     803f7e <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803f6c:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803f71:	29 d0                	sub    %edx,%eax
+  803f73:	c1 e8 10             	shr    $0x10,%eax
+  803f76:	39 c3                	cmp    %eax,%ebx
+  803f78:	0f 84 ad 00 00 00    	je     80402b <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803f7e:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803f81:	8d 3c 85 44 70 80 00 	lea    0x807044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  803f88:	8d 34 85 40 70 80 00 	lea    0x807040(,%eax,4),%esi
+  803f8f:	eb 10                	jmp    803fa1 <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803f91:	83 ec 04             	sub    $0x4,%esp
+  803f94:	6a 00                	push   $0x0
+  803f96:	6a 01                	push   $0x1
+  803f98:	57                   	push   %edi
+  803f99:	e8 a8 d1 ff ff       	call   801146 <sys_futex_wait>
+  803f9e:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  803fa1:	8b 46 04             	mov    0x4(%esi),%eax
+  803fa4:	83 f8 01             	cmp    $0x1,%eax
+  803fa7:	74 e8                	je     803f91 <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  803fa9:	83 f8 02             	cmp    $0x2,%eax
+  803fac:	0f 85 80 00 00 00    	jne    804032 <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  803fb2:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  803fb5:	c1 e6 02             	shl    $0x2,%esi
+  803fb8:	eb 05                	jmp    803fbf <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  803fba:	e8 46 ce ff ff       	call   800e05 <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  803fbf:	8b 8e 40 70 80 00    	mov    0x807040(%esi),%ecx
+  803fc5:	89 ca                	mov    %ecx,%edx
+  803fc7:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  803fcd:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803fd0:	c1 e0 04             	shl    $0x4,%eax
+  803fd3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803fd8:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  803fdb:	39 c1                	cmp    %eax,%ecx
+  803fdd:	75 12                	jne    803ff1 <pthread_join+0xac>
+  803fdf:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803fe2:	c1 e0 04             	shl    $0x4,%eax
+  803fe5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803fea:	8b 40 54             	mov    0x54(%eax),%eax
+  803fed:	85 c0                	test   %eax,%eax
+  803fef:	75 c9                	jne    803fba <pthread_join+0x75>
+	if (ret_store)
+  803ff1:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803ff5:	74 0f                	je     804006 <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  803ff7:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803ffa:	8b 04 85 50 70 80 00 	mov    0x807050(,%eax,4),%eax
+  804001:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  804004:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  804006:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  804009:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  804010:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  804017:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80401c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80401f:	5b                   	pop    %ebx
+  804020:	5e                   	pop    %esi
+  804021:	5f                   	pop    %edi
+  804022:	5d                   	pop    %ebp
+  804023:	c3                   	ret
+		return -E_INVAL;
+  804024:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804029:	eb f1                	jmp    80401c <pthread_join+0xd7>
+  80402b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804030:	eb ea                	jmp    80401c <pthread_join+0xd7>
+		return -E_INVAL;
+  804032:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804037:	eb e3                	jmp    80401c <pthread_join+0xd7>
+
+00804039 <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  804039:	55                   	push   %ebp
+  80403a:	89 e5                	mov    %esp,%ebp
+  80403c:	53                   	push   %ebx
+  80403d:	83 ec 04             	sub    $0x4,%esp
+  804040:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804042:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804048:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80404d:	77 0c                	ja     80405b <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80404f:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804054:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  804056:	c1 e8 10             	shr    $0x10,%eax
+  804059:	75 0a                	jne    804065 <pthread_exit+0x2c>
+		exit();
+  80405b:	e8 ac c2 ff ff       	call   80030c <exit>
+  804060:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  804065:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  80406c:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  80406f:	8d 0c 8d 40 70 80 00 	lea    0x807040(,%ecx,4),%ecx
+  804076:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  804079:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  80407c:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  804083:	83 ec 08             	sub    $0x8,%esp
+  804086:	6a 20                	push   $0x20
+  804088:	01 c2                	add    %eax,%edx
+  80408a:	8d 04 95 44 70 80 00 	lea    0x807044(,%edx,4),%eax
+  804091:	50                   	push   %eax
+  804092:	e8 de d0 ff ff       	call   801175 <sys_futex_wake>
+	sys_env_destroy(0);
+  804097:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80409e:	e8 eb cc ff ff       	call   800d8e <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  8040a3:	83 c4 0c             	add    $0xc,%esp
+  8040a6:	68 f6 50 80 00       	push   $0x8050f6
+  8040ab:	68 a5 00 00 00       	push   $0xa5
+  8040b0:	68 10 51 80 00       	push   $0x805110
+  8040b5:	e8 7a c2 ff ff       	call   800334 <_panic>
+
+008040ba <pthread_start>:
+{
+  8040ba:	55                   	push   %ebp
+  8040bb:	89 e5                	mov    %esp,%ebp
+  8040bd:	53                   	push   %ebx
+  8040be:	83 ec 04             	sub    $0x4,%esp
+  8040c1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  8040c4:	e8 10 cd ff ff       	call   800dd9 <sys_getenvid>
+  8040c9:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  8040ce:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+	if (t == 0)
+  8040d4:	85 db                	test   %ebx,%ebx
+  8040d6:	74 0c                	je     8040e4 <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8040d8:	89 d9                	mov    %ebx,%ecx
+  8040da:	c1 e1 10             	shl    $0x10,%ecx
+  8040dd:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8040e2:	29 ca                	sub    %ecx,%edx
+  8040e4:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8040e7:	c1 e0 04             	shl    $0x4,%eax
+  8040ea:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8040ef:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  8040f1:	83 ec 0c             	sub    $0xc,%esp
+  8040f4:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  8040fb:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  8040fe:	ff 34 95 4c 70 80 00 	push   0x80704c(,%edx,4)
+  804105:	ff 14 95 48 70 80 00 	call   *0x807048(,%edx,4)
+  80410c:	89 04 24             	mov    %eax,(%esp)
+  80410f:	e8 25 ff ff ff       	call   804039 <pthread_exit>
+
+00804114 <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  804114:	55                   	push   %ebp
+  804115:	89 e5                	mov    %esp,%ebp
+  804117:	57                   	push   %edi
+  804118:	56                   	push   %esi
+  804119:	53                   	push   %ebx
+  80411a:	83 ec 1c             	sub    $0x1c,%esp
+  80411d:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80411f:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  804125:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80412c:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804131:	77 0d                	ja     804140 <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804133:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804138:	29 d0                	sub    %edx,%eax
+  80413a:	c1 e8 10             	shr    $0x10,%eax
+  80413d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  804140:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804145:	eb 2f                	jmp    804176 <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  804147:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  80414d:	8b 01                	mov    (%ecx),%eax
+  80414f:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  804152:	39 c2                	cmp    %eax,%edx
+  804154:	75 14                	jne    80416a <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  804156:	83 ec 0c             	sub    $0xc,%esp
+  804159:	57                   	push   %edi
+  80415a:	e8 2f cc ff ff       	call   800d8e <sys_env_destroy>
+  80415f:	83 c4 10             	add    $0x10,%esp
+  804162:	85 c0                	test   %eax,%eax
+  804164:	0f 88 97 00 00 00    	js     804201 <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  80416a:	83 c3 01             	add    $0x1,%ebx
+  80416d:	83 fb 20             	cmp    $0x20,%ebx
+  804170:	0f 84 d2 00 00 00    	je     804248 <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  804176:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  804179:	74 ef                	je     80416a <pthread_kill_others+0x56>
+  80417b:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80417e:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  804185:	8b 40 04             	mov    0x4(%eax),%eax
+  804188:	83 f8 01             	cmp    $0x1,%eax
+  80418b:	75 dd                	jne    80416a <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  80418d:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  804190:	8b 3c 85 40 70 80 00 	mov    0x807040(,%eax,4),%edi
+  804197:	89 fe                	mov    %edi,%esi
+  804199:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  80419f:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  8041a2:	c1 e0 04             	shl    $0x4,%eax
+  8041a5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8041aa:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  8041ad:	39 c7                	cmp    %eax,%edi
+  8041af:	75 b9                	jne    80416a <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  8041b1:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  8041b4:	c1 e0 04             	shl    $0x4,%eax
+  8041b7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8041bc:	8b 40 54             	mov    0x54(%eax),%eax
+  8041bf:	85 c0                	test   %eax,%eax
+  8041c1:	74 a7                	je     80416a <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  8041c3:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  8041c6:	c1 e0 04             	shl    $0x4,%eax
+  8041c9:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  8041cf:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8041d1:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  8041d7:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8041dc:	0f 87 65 ff ff ff    	ja     804147 <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8041e2:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8041e7:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  8041e9:	c1 e8 10             	shr    $0x10,%eax
+  8041ec:	0f 84 55 ff ff ff    	je     804147 <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8041f2:	c1 e0 10             	shl    $0x10,%eax
+  8041f5:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8041fa:	29 c1                	sub    %eax,%ecx
+  8041fc:	e9 4c ff ff ff       	jmp    80414d <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  804201:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  804204:	c1 e2 04             	shl    $0x4,%edx
+  804207:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80420d:	8b 52 48             	mov    0x48(%edx),%edx
+  804210:	39 fa                	cmp    %edi,%edx
+  804212:	0f 85 52 ff ff ff    	jne    80416a <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  804218:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  80421b:	c1 e2 04             	shl    $0x4,%edx
+  80421e:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  804224:	8b 52 54             	mov    0x54(%edx),%edx
+  804227:	85 d2                	test   %edx,%edx
+  804229:	0f 84 3b ff ff ff    	je     80416a <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  80422f:	83 ec 0c             	sub    $0xc,%esp
+  804232:	50                   	push   %eax
+  804233:	57                   	push   %edi
+  804234:	68 20 51 80 00       	push   $0x805120
+  804239:	68 bb 00 00 00       	push   $0xbb
+  80423e:	68 10 51 80 00       	push   $0x805110
+  804243:	e8 ec c0 ff ff       	call   800334 <_panic>
+	}
+}
+  804248:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80424b:	5b                   	pop    %ebx
+  80424c:	5e                   	pop    %esi
+  80424d:	5f                   	pop    %edi
+  80424e:	5d                   	pop    %ebp
+  80424f:	c3                   	ret
+
+00804250 <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  804250:	55                   	push   %ebp
+  804251:	89 e5                	mov    %esp,%ebp
+  804253:	53                   	push   %ebx
+  804254:	83 ec 04             	sub    $0x4,%esp
+  804257:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804259:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  80425f:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  804265:	0f 87 85 00 00 00    	ja     8042f0 <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80426b:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  804270:	29 c3                	sub    %eax,%ebx
+  804272:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  804275:	83 ec 04             	sub    $0x4,%esp
+  804278:	68 80 02 00 00       	push   $0x280
+  80427d:	6a 00                	push   $0x0
+  80427f:	68 40 70 80 00       	push   $0x807040
+  804284:	e8 bb c8 ff ff       	call   800b44 <memset>
+	threads_mu.m_state = 0;
+  804289:	c7 05 20 70 80 00 00 	movl   $0x0,0x807020
+  804290:	00 00 00 
+	if (self != 0) {
+  804293:	83 c4 10             	add    $0x10,%esp
+  804296:	85 db                	test   %ebx,%ebx
+  804298:	74 51                	je     8042eb <pthread_fork_child+0x9b>
+  80429a:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80429c:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8042a2:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8042a7:	77 18                	ja     8042c1 <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8042a9:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8042ae:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8042b0:	c1 e8 10             	shr    $0x10,%eax
+  8042b3:	74 0c                	je     8042c1 <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8042b5:	c1 e0 10             	shl    $0x10,%eax
+  8042b8:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8042bd:	29 c2                	sub    %eax,%edx
+  8042bf:	eb 06                	jmp    8042c7 <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  8042c1:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		threads[self].th_env = thisenv->env_id;
+  8042c7:	8b 02                	mov    (%edx),%eax
+  8042c9:	8b 48 48             	mov    0x48(%eax),%ecx
+  8042cc:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  8042d3:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  8042d6:	89 0c 95 40 70 80 00 	mov    %ecx,0x807040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  8042dd:	8d 04 95 40 70 80 00 	lea    0x807040(,%edx,4),%eax
+  8042e4:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  8042eb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8042ee:	c9                   	leave
+  8042ef:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  8042f0:	83 ec 04             	sub    $0x4,%esp
+  8042f3:	68 80 02 00 00       	push   $0x280
+  8042f8:	6a 00                	push   $0x0
+  8042fa:	68 40 70 80 00       	push   $0x807040
+  8042ff:	e8 40 c8 ff ff       	call   800b44 <memset>
+	threads_mu.m_state = 0;
+  804304:	c7 05 20 70 80 00 00 	movl   $0x0,0x807020
+  80430b:	00 00 00 
+  80430e:	83 c4 10             	add    $0x10,%esp
+  804311:	eb d8                	jmp    8042eb <pthread_fork_child+0x9b>
+
+00804313 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  804313:	b8 00 00 00 00       	mov    $0x0,%eax
+  804318:	c3                   	ret
+
+00804319 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  804319:	55                   	push   %ebp
+  80431a:	89 e5                	mov    %esp,%ebp
+  80431c:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80431f:	68 45 51 80 00       	push   $0x805145
+  804324:	ff 75 0c             	push   0xc(%ebp)
+  804327:	e8 c7 c6 ff ff       	call   8009f3 <strcpy>
+	return 0;
+}
+  80432c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804331:	c9                   	leave
+  804332:	c3                   	ret
+
+00804333 <devcons_write>:
+{
+  804333:	55                   	push   %ebp
+  804334:	89 e5                	mov    %esp,%ebp
+  804336:	57                   	push   %edi
+  804337:	56                   	push   %esi
+  804338:	53                   	push   %ebx
+  804339:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80433f:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  804344:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80434a:	eb 2e                	jmp    80437a <devcons_write+0x47>
+		m = n - tot;
+  80434c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80434f:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  804351:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804356:	39 c3                	cmp    %eax,%ebx
+  804358:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80435b:	83 ec 04             	sub    $0x4,%esp
+  80435e:	53                   	push   %ebx
+  80435f:	89 f0                	mov    %esi,%eax
+  804361:	03 45 0c             	add    0xc(%ebp),%eax
+  804364:	50                   	push   %eax
+  804365:	57                   	push   %edi
+  804366:	e8 0e c8 ff ff       	call   800b79 <memmove>
+		sys_cputs(buf, m);
+  80436b:	83 c4 08             	add    $0x8,%esp
+  80436e:	53                   	push   %ebx
+  80436f:	57                   	push   %edi
+  804370:	e8 c2 c9 ff ff       	call   800d37 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  804375:	01 de                	add    %ebx,%esi
+  804377:	83 c4 10             	add    $0x10,%esp
+  80437a:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80437d:	72 cd                	jb     80434c <devcons_write+0x19>
+}
+  80437f:	89 f0                	mov    %esi,%eax
+  804381:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804384:	5b                   	pop    %ebx
+  804385:	5e                   	pop    %esi
+  804386:	5f                   	pop    %edi
+  804387:	5d                   	pop    %ebp
+  804388:	c3                   	ret
+
+00804389 <devcons_read>:
+{
+  804389:	55                   	push   %ebp
+  80438a:	89 e5                	mov    %esp,%ebp
+  80438c:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80438f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804394:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804398:	75 07                	jne    8043a1 <devcons_read+0x18>
+  80439a:	eb 1f                	jmp    8043bb <devcons_read+0x32>
+		sys_yield();
+  80439c:	e8 64 ca ff ff       	call   800e05 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8043a1:	e8 bc c9 ff ff       	call   800d62 <sys_cgetc>
+  8043a6:	85 c0                	test   %eax,%eax
+  8043a8:	74 f2                	je     80439c <devcons_read+0x13>
+	if (c < 0)
+  8043aa:	78 0f                	js     8043bb <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8043ac:	83 f8 04             	cmp    $0x4,%eax
+  8043af:	74 0c                	je     8043bd <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8043b1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8043b4:	88 02                	mov    %al,(%edx)
+	return 1;
+  8043b6:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8043bb:	c9                   	leave
+  8043bc:	c3                   	ret
+		return 0;
+  8043bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043c2:	eb f7                	jmp    8043bb <devcons_read+0x32>
+
+008043c4 <cputchar>:
+{
+  8043c4:	55                   	push   %ebp
+  8043c5:	89 e5                	mov    %esp,%ebp
+  8043c7:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8043ca:	8b 45 08             	mov    0x8(%ebp),%eax
+  8043cd:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8043d0:	6a 01                	push   $0x1
+  8043d2:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8043d5:	50                   	push   %eax
+  8043d6:	e8 5c c9 ff ff       	call   800d37 <sys_cputs>
+}
+  8043db:	83 c4 10             	add    $0x10,%esp
+  8043de:	c9                   	leave
+  8043df:	c3                   	ret
+
+008043e0 <getchar>:
+{
+  8043e0:	55                   	push   %ebp
+  8043e1:	89 e5                	mov    %esp,%ebp
+  8043e3:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8043e6:	6a 01                	push   $0x1
+  8043e8:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8043eb:	50                   	push   %eax
+  8043ec:	6a 00                	push   $0x0
+  8043ee:	e8 63 d8 ff ff       	call   801c56 <read>
+	if (r < 0)
+  8043f3:	83 c4 10             	add    $0x10,%esp
+  8043f6:	85 c0                	test   %eax,%eax
+  8043f8:	78 06                	js     804400 <getchar+0x20>
+	if (r < 1)
+  8043fa:	74 06                	je     804402 <getchar+0x22>
+	return c;
+  8043fc:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  804400:	c9                   	leave
+  804401:	c3                   	ret
+		return -E_EOF;
+  804402:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804407:	eb f7                	jmp    804400 <getchar+0x20>
+
+00804409 <iscons>:
+{
+  804409:	55                   	push   %ebp
+  80440a:	89 e5                	mov    %esp,%ebp
+  80440c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80440f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804412:	50                   	push   %eax
+  804413:	ff 75 08             	push   0x8(%ebp)
+  804416:	e8 ab d5 ff ff       	call   8019c6 <fd_lookup>
+  80441b:	83 c4 10             	add    $0x10,%esp
+  80441e:	85 c0                	test   %eax,%eax
+  804420:	78 11                	js     804433 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  804422:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804425:	8b 15 98 62 80 00    	mov    0x806298,%edx
+  80442b:	39 10                	cmp    %edx,(%eax)
+  80442d:	0f 94 c0             	sete   %al
+  804430:	0f b6 c0             	movzbl %al,%eax
+}
+  804433:	c9                   	leave
+  804434:	c3                   	ret
+
+00804435 <opencons>:
+{
+  804435:	55                   	push   %ebp
+  804436:	89 e5                	mov    %esp,%ebp
+  804438:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80443b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80443e:	50                   	push   %eax
+  80443f:	e8 2c d5 ff ff       	call   801970 <fd_alloc>
+  804444:	83 c4 10             	add    $0x10,%esp
+  804447:	85 c0                	test   %eax,%eax
+  804449:	78 3a                	js     804485 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80444b:	83 ec 04             	sub    $0x4,%esp
+  80444e:	68 07 04 00 00       	push   $0x407
+  804453:	ff 75 f4             	push   -0xc(%ebp)
+  804456:	6a 00                	push   $0x0
+  804458:	e8 d4 c9 ff ff       	call   800e31 <sys_page_alloc>
+  80445d:	83 c4 10             	add    $0x10,%esp
+  804460:	85 c0                	test   %eax,%eax
+  804462:	78 21                	js     804485 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  804464:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804467:	8b 15 98 62 80 00    	mov    0x806298,%edx
+  80446d:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80446f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804472:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  804479:	83 ec 0c             	sub    $0xc,%esp
+  80447c:	50                   	push   %eax
+  80447d:	e8 c7 d4 ff ff       	call   801949 <fd2num>
+  804482:	83 c4 10             	add    $0x10,%esp
+}
+  804485:	c9                   	leave
+  804486:	c3                   	ret
+
+00804487 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804487:	55                   	push   %ebp
+  804488:	89 e5                	mov    %esp,%ebp
+  80448a:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  80448d:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  804494:	74 0a                	je     8044a0 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804496:	8b 45 08             	mov    0x8(%ebp),%eax
+  804499:	a3 00 a0 80 00       	mov    %eax,0x80a000
+}
+  80449e:	c9                   	leave
+  80449f:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  8044a0:	83 ec 04             	sub    $0x4,%esp
+  8044a3:	6a 07                	push   $0x7
+  8044a5:	68 00 f0 bf ee       	push   $0xeebff000
+  8044aa:	6a 00                	push   $0x0
+  8044ac:	e8 80 c9 ff ff       	call   800e31 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8044b1:	83 c4 08             	add    $0x8,%esp
+  8044b4:	68 c5 44 80 00       	push   $0x8044c5
+  8044b9:	6a 00                	push   $0x0
+  8044bb:	e8 ee ca ff ff       	call   800fae <sys_env_set_pgfault_upcall>
+  8044c0:	83 c4 10             	add    $0x10,%esp
+  8044c3:	eb d1                	jmp    804496 <set_pgfault_handler+0xf>
+
+008044c5 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8044c5:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8044c6:	a1 00 a0 80 00       	mov    0x80a000,%eax
+	call *%eax
+  8044cb:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8044cd:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  8044d0:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  8044d4:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  8044d8:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  8044db:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  8044df:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  8044e1:	83 c4 08             	add    $0x8,%esp
+	popal
+  8044e4:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  8044e5:	83 c4 04             	add    $0x4,%esp
+	popfl
+  8044e8:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  8044e9:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  8044ea:	c3                   	ret
+
+008044eb <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8044eb:	55                   	push   %ebp
+  8044ec:	89 e5                	mov    %esp,%ebp
+  8044ee:	57                   	push   %edi
+  8044ef:	56                   	push   %esi
+  8044f0:	53                   	push   %ebx
+  8044f1:	83 ec 18             	sub    $0x18,%esp
+  8044f4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8044f7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8044fa:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  8044fd:	85 c0                	test   %eax,%eax
+  8044ff:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804504:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  804507:	50                   	push   %eax
+  804508:	e8 1a cb ff ff       	call   801027 <sys_ipc_recv>
+	if (r < 0) {
+  80450d:	83 c4 10             	add    $0x10,%esp
+  804510:	85 c0                	test   %eax,%eax
+  804512:	78 2b                	js     80453f <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  804514:	85 ff                	test   %edi,%edi
+  804516:	74 55                	je     80456d <ipc_recv+0x82>
+  804518:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80451a:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804520:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804525:	77 39                	ja     804560 <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804527:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80452c:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80452e:	c1 e8 10             	shr    $0x10,%eax
+  804531:	74 2d                	je     804560 <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804533:	c1 e0 10             	shl    $0x10,%eax
+  804536:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80453b:	29 c2                	sub    %eax,%edx
+  80453d:	eb 27                	jmp    804566 <ipc_recv+0x7b>
+  80453f:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  804541:	83 ec 08             	sub    $0x8,%esp
+  804544:	50                   	push   %eax
+  804545:	68 51 51 80 00       	push   $0x805151
+  80454a:	e8 c0 be ff ff       	call   80040f <cprintf>
+		*from_env_store = 0;
+  80454f:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  804555:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  80455b:	83 c4 10             	add    $0x10,%esp
+  80455e:	eb 77                	jmp    8045d7 <ipc_recv+0xec>
+		return pthread_main_tls;
+  804560:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  804566:	8b 02                	mov    (%edx),%eax
+  804568:	8b 40 78             	mov    0x78(%eax),%eax
+  80456b:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  80456d:	85 f6                	test   %esi,%esi
+  80456f:	74 34                	je     8045a5 <ipc_recv+0xba>
+  804571:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804573:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804579:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80457e:	77 18                	ja     804598 <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804580:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804585:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804587:	c1 e8 10             	shr    $0x10,%eax
+  80458a:	74 0c                	je     804598 <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80458c:	c1 e0 10             	shl    $0x10,%eax
+  80458f:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804594:	29 c2                	sub    %eax,%edx
+  804596:	eb 06                	jmp    80459e <ipc_recv+0xb3>
+		return pthread_main_tls;
+  804598:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  80459e:	8b 02                	mov    (%edx),%eax
+  8045a0:	8b 40 7c             	mov    0x7c(%eax),%eax
+  8045a3:	89 06                	mov    %eax,(%esi)
+  8045a5:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8045a7:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8045ad:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8045b2:	77 18                	ja     8045cc <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8045b4:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8045b9:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8045bb:	c1 e8 10             	shr    $0x10,%eax
+  8045be:	74 0c                	je     8045cc <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8045c0:	c1 e0 10             	shl    $0x10,%eax
+  8045c3:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8045c8:	29 c2                	sub    %eax,%edx
+  8045ca:	eb 06                	jmp    8045d2 <ipc_recv+0xe7>
+		return pthread_main_tls;
+  8045cc:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+	}
+	return thisenv->env_ipc_value;
+  8045d2:	8b 02                	mov    (%edx),%eax
+  8045d4:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  8045d7:	89 d8                	mov    %ebx,%eax
+  8045d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8045dc:	5b                   	pop    %ebx
+  8045dd:	5e                   	pop    %esi
+  8045de:	5f                   	pop    %edi
+  8045df:	5d                   	pop    %ebp
+  8045e0:	c3                   	ret
+
+008045e1 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8045e1:	55                   	push   %ebp
+  8045e2:	89 e5                	mov    %esp,%ebp
+  8045e4:	57                   	push   %edi
+  8045e5:	56                   	push   %esi
+  8045e6:	53                   	push   %ebx
+  8045e7:	83 ec 0c             	sub    $0xc,%esp
+  8045ea:	8b 75 08             	mov    0x8(%ebp),%esi
+  8045ed:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8045f0:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  8045f3:	85 db                	test   %ebx,%ebx
+  8045f5:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8045fa:	0f 44 d8             	cmove  %eax,%ebx
+  8045fd:	eb 05                	jmp    804604 <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  8045ff:	e8 01 c8 ff ff       	call   800e05 <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  804604:	57                   	push   %edi
+  804605:	53                   	push   %ebx
+  804606:	ff 75 0c             	push   0xc(%ebp)
+  804609:	56                   	push   %esi
+  80460a:	e8 eb c9 ff ff       	call   800ffa <sys_ipc_try_send>
+		if (r == 0) {
+  80460f:	83 c4 10             	add    $0x10,%esp
+  804612:	85 c0                	test   %eax,%eax
+  804614:	74 19                	je     80462f <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  804616:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  804619:	74 e4                	je     8045ff <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  80461b:	83 ec 0c             	sub    $0xc,%esp
+  80461e:	50                   	push   %eax
+  80461f:	57                   	push   %edi
+  804620:	53                   	push   %ebx
+  804621:	56                   	push   %esi
+  804622:	68 6c 51 80 00       	push   $0x80516c
+  804627:	e8 e3 bd ff ff       	call   80040f <cprintf>
+			return;
+  80462c:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  80462f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804632:	5b                   	pop    %ebx
+  804633:	5e                   	pop    %esi
+  804634:	5f                   	pop    %edi
+  804635:	5d                   	pop    %ebp
+  804636:	c3                   	ret
+
+00804637 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804637:	55                   	push   %ebp
+  804638:	89 e5                	mov    %esp,%ebp
+  80463a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80463d:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  804642:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804645:	c1 e0 04             	shl    $0x4,%eax
+  804648:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80464d:	8b 40 50             	mov    0x50(%eax),%eax
+  804650:	39 c8                	cmp    %ecx,%eax
+  804652:	74 12                	je     804666 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804654:	83 c2 01             	add    $0x1,%edx
+  804657:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  80465d:	75 e3                	jne    804642 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  80465f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804664:	eb 0e                	jmp    804674 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  804666:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804669:	c1 e0 04             	shl    $0x4,%eax
+  80466c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804671:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  804674:	5d                   	pop    %ebp
+  804675:	c3                   	ret
+
+00804676 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804676:	55                   	push   %ebp
+  804677:	89 e5                	mov    %esp,%ebp
+  804679:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80467c:	89 c2                	mov    %eax,%edx
+  80467e:	c1 ea 16             	shr    $0x16,%edx
+  804681:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  804688:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80468d:	f6 c1 01             	test   $0x1,%cl
+  804690:	74 1c                	je     8046ae <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  804692:	c1 e8 0c             	shr    $0xc,%eax
+  804695:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80469c:	a8 01                	test   $0x1,%al
+  80469e:	74 0e                	je     8046ae <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8046a0:	c1 e8 0c             	shr    $0xc,%eax
+  8046a3:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  8046aa:	ef 
+  8046ab:	0f b7 d2             	movzwl %dx,%edx
+}
+  8046ae:	89 d0                	mov    %edx,%eax
+  8046b0:	5d                   	pop    %ebp
+  8046b1:	c3                   	ret
+
+008046b2 <udm>:
+  8046b2:	57                   	push   %edi
+  8046b3:	56                   	push   %esi
+  8046b4:	53                   	push   %ebx
+  8046b5:	83 ec 20             	sub    $0x20,%esp
+  8046b8:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8046bc:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8046c0:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8046c4:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8046c8:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8046cc:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8046d0:	89 d1                	mov    %edx,%ecx
+  8046d2:	09 c1                	or     %eax,%ecx
+  8046d4:	0f 84 91 00 00 00    	je     80476b <udm+0xb9>
+  8046da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8046e4:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8046e9:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8046f0:	00 
+  8046f1:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8046f8:	00 
+  8046f9:	eb 08                	jmp    804703 <udm+0x51>
+  8046fb:	83 e9 01             	sub    $0x1,%ecx
+  8046fe:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  804701:	74 7c                	je     80477f <udm+0xcd>
+  804703:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804707:	01 c0                	add    %eax,%eax
+  804709:	89 c6                	mov    %eax,%esi
+  80470b:	89 d7                	mov    %edx,%edi
+  80470d:	8b 44 24 10          	mov    0x10(%esp),%eax
+  804711:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804715:	0f ad d0             	shrd   %cl,%edx,%eax
+  804718:	d3 ea                	shr    %cl,%edx
+  80471a:	f6 c1 20             	test   $0x20,%cl
+  80471d:	74 04                	je     804723 <udm+0x71>
+  80471f:	89 d0                	mov    %edx,%eax
+  804721:	31 d2                	xor    %edx,%edx
+  804723:	83 e0 01             	and    $0x1,%eax
+  804726:	89 04 24             	mov    %eax,(%esp)
+  804729:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804730:	00 
+  804731:	8b 04 24             	mov    (%esp),%eax
+  804734:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804738:	09 f0                	or     %esi,%eax
+  80473a:	09 fa                	or     %edi,%edx
+  80473c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804740:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804744:	39 f0                	cmp    %esi,%eax
+  804746:	89 d3                	mov    %edx,%ebx
+  804748:	19 fb                	sbb    %edi,%ebx
+  80474a:	72 af                	jb     8046fb <udm+0x49>
+  80474c:	29 f0                	sub    %esi,%eax
+  80474e:	19 fa                	sbb    %edi,%edx
+  804750:	89 cf                	mov    %ecx,%edi
+  804752:	c1 ef 05             	shr    $0x5,%edi
+  804755:	83 e7 01             	and    $0x1,%edi
+  804758:	89 fe                	mov    %edi,%esi
+  80475a:	83 f6 01             	xor    $0x1,%esi
+  80475d:	d3 e6                	shl    %cl,%esi
+  80475f:	d3 e7                	shl    %cl,%edi
+  804761:	09 74 24 18          	or     %esi,0x18(%esp)
+  804765:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804769:	eb 90                	jmp    8046fb <udm+0x49>
+  80476b:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80476f:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804773:	89 f0                	mov    %esi,%eax
+  804775:	89 fa                	mov    %edi,%edx
+  804777:	89 74 24 18          	mov    %esi,0x18(%esp)
+  80477b:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  80477f:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  804783:	89 01                	mov    %eax,(%ecx)
+  804785:	89 51 04             	mov    %edx,0x4(%ecx)
+  804788:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80478c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804790:	83 c4 20             	add    $0x20,%esp
+  804793:	5b                   	pop    %ebx
+  804794:	5e                   	pop    %esi
+  804795:	5f                   	pop    %edi
+  804796:	c3                   	ret
+
+00804797 <__udivdi3>:
+  804797:	83 ec 18             	sub    $0x18,%esp
+  80479a:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80479e:	50                   	push   %eax
+  80479f:	ff 74 24 2c          	push   0x2c(%esp)
+  8047a3:	ff 74 24 2c          	push   0x2c(%esp)
+  8047a7:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8047ab:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8047af:	e8 fe fe ff ff       	call   8046b2 <udm>
+  8047b4:	83 c4 24             	add    $0x24,%esp
+  8047b7:	c3                   	ret
+
+008047b8 <__umoddi3>:
+  8047b8:	83 ec 18             	sub    $0x18,%esp
+  8047bb:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8047bf:	50                   	push   %eax
+  8047c0:	ff 74 24 2c          	push   0x2c(%esp)
+  8047c4:	ff 74 24 2c          	push   0x2c(%esp)
+  8047c8:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8047cc:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8047d0:	e8 dd fe ff ff       	call   8046b2 <udm>
+  8047d5:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8047d9:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8047dd:	83 c4 24             	add    $0x24,%esp
+  8047e0:	c3                   	ret
+
+008047e1 <__divdi3>:
+  8047e1:	56                   	push   %esi
+  8047e2:	53                   	push   %ebx
+  8047e3:	83 ec 14             	sub    $0x14,%esp
+  8047e6:	8b 44 24 20          	mov    0x20(%esp),%eax
+  8047ea:	8b 54 24 24          	mov    0x24(%esp),%edx
+  8047ee:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  8047f2:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  8047f6:	85 d2                	test   %edx,%edx
+  8047f8:	78 18                	js     804812 <__divdi3+0x31>
+  8047fa:	85 db                	test   %ebx,%ebx
+  8047fc:	78 3e                	js     80483c <__divdi3+0x5b>
+  8047fe:	83 ec 04             	sub    $0x4,%esp
+  804801:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804805:	56                   	push   %esi
+  804806:	53                   	push   %ebx
+  804807:	51                   	push   %ecx
+  804808:	e8 a5 fe ff ff       	call   8046b2 <udm>
+  80480d:	83 c4 10             	add    $0x10,%esp
+  804810:	eb 24                	jmp    804836 <__divdi3+0x55>
+  804812:	f7 d8                	neg    %eax
+  804814:	83 d2 00             	adc    $0x0,%edx
+  804817:	f7 da                	neg    %edx
+  804819:	85 db                	test   %ebx,%ebx
+  80481b:	78 3a                	js     804857 <__divdi3+0x76>
+  80481d:	83 ec 04             	sub    $0x4,%esp
+  804820:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804824:	56                   	push   %esi
+  804825:	53                   	push   %ebx
+  804826:	51                   	push   %ecx
+  804827:	e8 86 fe ff ff       	call   8046b2 <udm>
+  80482c:	83 c4 10             	add    $0x10,%esp
+  80482f:	f7 d8                	neg    %eax
+  804831:	83 d2 00             	adc    $0x0,%edx
+  804834:	f7 da                	neg    %edx
+  804836:	83 c4 14             	add    $0x14,%esp
+  804839:	5b                   	pop    %ebx
+  80483a:	5e                   	pop    %esi
+  80483b:	c3                   	ret
+  80483c:	83 ec 04             	sub    $0x4,%esp
+  80483f:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804843:	56                   	push   %esi
+  804844:	f7 d9                	neg    %ecx
+  804846:	83 d3 00             	adc    $0x0,%ebx
+  804849:	f7 db                	neg    %ebx
+  80484b:	53                   	push   %ebx
+  80484c:	51                   	push   %ecx
+  80484d:	e8 60 fe ff ff       	call   8046b2 <udm>
+  804852:	83 c4 10             	add    $0x10,%esp
+  804855:	eb d8                	jmp    80482f <__divdi3+0x4e>
+  804857:	83 ec 04             	sub    $0x4,%esp
+  80485a:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80485e:	56                   	push   %esi
+  80485f:	f7 d9                	neg    %ecx
+  804861:	83 d3 00             	adc    $0x0,%ebx
+  804864:	f7 db                	neg    %ebx
+  804866:	53                   	push   %ebx
+  804867:	51                   	push   %ecx
+  804868:	e8 45 fe ff ff       	call   8046b2 <udm>
+  80486d:	83 c4 10             	add    $0x10,%esp
+  804870:	eb c4                	jmp    804836 <__divdi3+0x55>
+
+00804872 <__moddi3>:
+  804872:	55                   	push   %ebp
+  804873:	57                   	push   %edi
+  804874:	56                   	push   %esi
+  804875:	53                   	push   %ebx
+  804876:	83 ec 24             	sub    $0x24,%esp
+  804879:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80487d:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804881:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  804885:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  804889:	85 d2                	test   %edx,%edx
+  80488b:	78 3b                	js     8048c8 <__moddi3+0x56>
+  80488d:	83 ec 04             	sub    $0x4,%esp
+  804890:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804894:	56                   	push   %esi
+  804895:	89 ce                	mov    %ecx,%esi
+  804897:	f7 de                	neg    %esi
+  804899:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80489d:	89 de                	mov    %ebx,%esi
+  80489f:	83 d6 00             	adc    $0x0,%esi
+  8048a2:	f7 de                	neg    %esi
+  8048a4:	89 74 24 14          	mov    %esi,0x14(%esp)
+  8048a8:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8048ac:	0f 48 f1             	cmovs  %ecx,%esi
+  8048af:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  8048b4:	53                   	push   %ebx
+  8048b5:	56                   	push   %esi
+  8048b6:	e8 f7 fd ff ff       	call   8046b2 <udm>
+  8048bb:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8048bf:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8048c3:	83 c4 10             	add    $0x10,%esp
+  8048c6:	eb 47                	jmp    80490f <__moddi3+0x9d>
+  8048c8:	f7 d8                	neg    %eax
+  8048ca:	83 d2 00             	adc    $0x0,%edx
+  8048cd:	f7 da                	neg    %edx
+  8048cf:	83 ec 04             	sub    $0x4,%esp
+  8048d2:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8048d6:	56                   	push   %esi
+  8048d7:	89 cf                	mov    %ecx,%edi
+  8048d9:	f7 df                	neg    %edi
+  8048db:	89 de                	mov    %ebx,%esi
+  8048dd:	83 d6 00             	adc    $0x0,%esi
+  8048e0:	f7 de                	neg    %esi
+  8048e2:	0f 49 cf             	cmovns %edi,%ecx
+  8048e5:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8048e9:	0f 49 de             	cmovns %esi,%ebx
+  8048ec:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  8048f0:	ff 74 24 0c          	push   0xc(%esp)
+  8048f4:	ff 74 24 0c          	push   0xc(%esp)
+  8048f8:	e8 b5 fd ff ff       	call   8046b2 <udm>
+  8048fd:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804901:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804905:	f7 d8                	neg    %eax
+  804907:	83 d2 00             	adc    $0x0,%edx
+  80490a:	f7 da                	neg    %edx
+  80490c:	83 c4 10             	add    $0x10,%esp
+  80490f:	83 c4 24             	add    $0x24,%esp
+  804912:	5b                   	pop    %ebx
+  804913:	5e                   	pop    %esi
+  804914:	5f                   	pop    %edi
+  804915:	5d                   	pop    %ebp
+  804916:	c3                   	ret
@@ -0,0 +1,10069 @@
+
+obj/user/testkbd.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 2a 02 00 00       	call   80025b <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 04             	sub    $0x4,%esp
+	int i, r;
+
+	// Spin for a bit to let the console quiet
+	for (i = 0; i < 10; ++i)
+  80003a:	bb 0b 00 00 00       	mov    $0xb,%ebx
+  80003f:	eb 05                	jmp    800046 <umain+0x13>
+		sys_yield();
+  800041:	e8 79 0e 00 00       	call   800ebf <sys_yield>
+	for (i = 0; i < 10; ++i)
+  800046:	83 eb 01             	sub    $0x1,%ebx
+  800049:	75 f6                	jne    800041 <umain+0xe>
+
+	close(0);
+  80004b:	83 ec 0c             	sub    $0xc,%esp
+  80004e:	6a 00                	push   $0x0
+  800050:	e8 09 15 00 00       	call   80155e <close>
+	if ((r = opencons()) < 0)
+  800055:	e8 af 01 00 00       	call   800209 <opencons>
+  80005a:	83 c4 10             	add    $0x10,%esp
+  80005d:	85 c0                	test   %eax,%eax
+  80005f:	78 14                	js     800075 <umain+0x42>
+		panic("opencons: %e", r);
+	if (r != 0)
+  800061:	74 24                	je     800087 <umain+0x54>
+		panic("first opencons used fd %d", r);
+  800063:	50                   	push   %eax
+  800064:	68 9c 49 80 00       	push   $0x80499c
+  800069:	6a 11                	push   $0x11
+  80006b:	68 8d 49 80 00       	push   $0x80498d
+  800070:	e8 89 02 00 00       	call   8002fe <_panic>
+		panic("opencons: %e", r);
+  800075:	50                   	push   %eax
+  800076:	68 80 49 80 00       	push   $0x804980
+  80007b:	6a 0f                	push   $0xf
+  80007d:	68 8d 49 80 00       	push   $0x80498d
+  800082:	e8 77 02 00 00       	call   8002fe <_panic>
+	if ((r = dup(0, 1)) < 0)
+  800087:	83 ec 08             	sub    $0x8,%esp
+  80008a:	6a 01                	push   $0x1
+  80008c:	6a 00                	push   $0x0
+  80008e:	e8 1d 15 00 00       	call   8015b0 <dup>
+  800093:	83 c4 10             	add    $0x10,%esp
+  800096:	85 c0                	test   %eax,%eax
+  800098:	79 25                	jns    8000bf <umain+0x8c>
+		panic("dup: %e", r);
+  80009a:	50                   	push   %eax
+  80009b:	68 b6 49 80 00       	push   $0x8049b6
+  8000a0:	6a 13                	push   $0x13
+  8000a2:	68 8d 49 80 00       	push   $0x80498d
+  8000a7:	e8 52 02 00 00       	call   8002fe <_panic>
+	for(;;){
+		char *buf;
+
+		buf = readline("Type a line: ");
+		if (buf != NULL)
+			fprintf(1, "%s\n", buf);
+  8000ac:	83 ec 04             	sub    $0x4,%esp
+  8000af:	50                   	push   %eax
+  8000b0:	68 cc 49 80 00       	push   $0x8049cc
+  8000b5:	6a 01                	push   $0x1
+  8000b7:	e8 50 21 00 00       	call   80220c <fprintf>
+  8000bc:	83 c4 10             	add    $0x10,%esp
+		buf = readline("Type a line: ");
+  8000bf:	83 ec 0c             	sub    $0xc,%esp
+  8000c2:	68 be 49 80 00       	push   $0x8049be
+  8000c7:	e8 b6 08 00 00       	call   800982 <readline>
+		if (buf != NULL)
+  8000cc:	83 c4 10             	add    $0x10,%esp
+  8000cf:	85 c0                	test   %eax,%eax
+  8000d1:	75 d9                	jne    8000ac <umain+0x79>
+		else
+			fprintf(1, "(end of file received)\n");
+  8000d3:	83 ec 08             	sub    $0x8,%esp
+  8000d6:	68 d0 49 80 00       	push   $0x8049d0
+  8000db:	6a 01                	push   $0x1
+  8000dd:	e8 2a 21 00 00       	call   80220c <fprintf>
+  8000e2:	83 c4 10             	add    $0x10,%esp
+  8000e5:	eb d8                	jmp    8000bf <umain+0x8c>
+
+008000e7 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8000e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ec:	c3                   	ret
+
+008000ed <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8000ed:	55                   	push   %ebp
+  8000ee:	89 e5                	mov    %esp,%ebp
+  8000f0:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8000f3:	68 e8 49 80 00       	push   $0x8049e8
+  8000f8:	ff 75 0c             	push   0xc(%ebp)
+  8000fb:	e8 ad 09 00 00       	call   800aad <strcpy>
+	return 0;
+}
+  800100:	b8 00 00 00 00       	mov    $0x0,%eax
+  800105:	c9                   	leave
+  800106:	c3                   	ret
+
+00800107 <devcons_write>:
+{
+  800107:	55                   	push   %ebp
+  800108:	89 e5                	mov    %esp,%ebp
+  80010a:	57                   	push   %edi
+  80010b:	56                   	push   %esi
+  80010c:	53                   	push   %ebx
+  80010d:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  800113:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  800118:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80011e:	eb 2e                	jmp    80014e <devcons_write+0x47>
+		m = n - tot;
+  800120:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800123:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  800125:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80012a:	39 c3                	cmp    %eax,%ebx
+  80012c:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80012f:	83 ec 04             	sub    $0x4,%esp
+  800132:	53                   	push   %ebx
+  800133:	89 f0                	mov    %esi,%eax
+  800135:	03 45 0c             	add    0xc(%ebp),%eax
+  800138:	50                   	push   %eax
+  800139:	57                   	push   %edi
+  80013a:	e8 f4 0a 00 00       	call   800c33 <memmove>
+		sys_cputs(buf, m);
+  80013f:	83 c4 08             	add    $0x8,%esp
+  800142:	53                   	push   %ebx
+  800143:	57                   	push   %edi
+  800144:	e8 a8 0c 00 00       	call   800df1 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  800149:	01 de                	add    %ebx,%esi
+  80014b:	83 c4 10             	add    $0x10,%esp
+  80014e:	3b 75 10             	cmp    0x10(%ebp),%esi
+  800151:	72 cd                	jb     800120 <devcons_write+0x19>
+}
+  800153:	89 f0                	mov    %esi,%eax
+  800155:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800158:	5b                   	pop    %ebx
+  800159:	5e                   	pop    %esi
+  80015a:	5f                   	pop    %edi
+  80015b:	5d                   	pop    %ebp
+  80015c:	c3                   	ret
+
+0080015d <devcons_read>:
+{
+  80015d:	55                   	push   %ebp
+  80015e:	89 e5                	mov    %esp,%ebp
+  800160:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  800163:	b8 00 00 00 00       	mov    $0x0,%eax
+  800168:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80016c:	75 07                	jne    800175 <devcons_read+0x18>
+  80016e:	eb 1f                	jmp    80018f <devcons_read+0x32>
+		sys_yield();
+  800170:	e8 4a 0d 00 00       	call   800ebf <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  800175:	e8 a2 0c 00 00       	call   800e1c <sys_cgetc>
+  80017a:	85 c0                	test   %eax,%eax
+  80017c:	74 f2                	je     800170 <devcons_read+0x13>
+	if (c < 0)
+  80017e:	78 0f                	js     80018f <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  800180:	83 f8 04             	cmp    $0x4,%eax
+  800183:	74 0c                	je     800191 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  800185:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800188:	88 02                	mov    %al,(%edx)
+	return 1;
+  80018a:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80018f:	c9                   	leave
+  800190:	c3                   	ret
+		return 0;
+  800191:	b8 00 00 00 00       	mov    $0x0,%eax
+  800196:	eb f7                	jmp    80018f <devcons_read+0x32>
+
+00800198 <cputchar>:
+{
+  800198:	55                   	push   %ebp
+  800199:	89 e5                	mov    %esp,%ebp
+  80019b:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80019e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001a1:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8001a4:	6a 01                	push   $0x1
+  8001a6:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8001a9:	50                   	push   %eax
+  8001aa:	e8 42 0c 00 00       	call   800df1 <sys_cputs>
+}
+  8001af:	83 c4 10             	add    $0x10,%esp
+  8001b2:	c9                   	leave
+  8001b3:	c3                   	ret
+
+008001b4 <getchar>:
+{
+  8001b4:	55                   	push   %ebp
+  8001b5:	89 e5                	mov    %esp,%ebp
+  8001b7:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8001ba:	6a 01                	push   $0x1
+  8001bc:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8001bf:	50                   	push   %eax
+  8001c0:	6a 00                	push   $0x0
+  8001c2:	e8 d3 14 00 00       	call   80169a <read>
+	if (r < 0)
+  8001c7:	83 c4 10             	add    $0x10,%esp
+  8001ca:	85 c0                	test   %eax,%eax
+  8001cc:	78 06                	js     8001d4 <getchar+0x20>
+	if (r < 1)
+  8001ce:	74 06                	je     8001d6 <getchar+0x22>
+	return c;
+  8001d0:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8001d4:	c9                   	leave
+  8001d5:	c3                   	ret
+		return -E_EOF;
+  8001d6:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8001db:	eb f7                	jmp    8001d4 <getchar+0x20>
+
+008001dd <iscons>:
+{
+  8001dd:	55                   	push   %ebp
+  8001de:	89 e5                	mov    %esp,%ebp
+  8001e0:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8001e3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8001e6:	50                   	push   %eax
+  8001e7:	ff 75 08             	push   0x8(%ebp)
+  8001ea:	e8 1b 12 00 00       	call   80140a <fd_lookup>
+  8001ef:	83 c4 10             	add    $0x10,%esp
+  8001f2:	85 c0                	test   %eax,%eax
+  8001f4:	78 11                	js     800207 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8001f6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8001f9:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  8001ff:	39 10                	cmp    %edx,(%eax)
+  800201:	0f 94 c0             	sete   %al
+  800204:	0f b6 c0             	movzbl %al,%eax
+}
+  800207:	c9                   	leave
+  800208:	c3                   	ret
+
+00800209 <opencons>:
+{
+  800209:	55                   	push   %ebp
+  80020a:	89 e5                	mov    %esp,%ebp
+  80020c:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80020f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800212:	50                   	push   %eax
+  800213:	e8 9c 11 00 00       	call   8013b4 <fd_alloc>
+  800218:	83 c4 10             	add    $0x10,%esp
+  80021b:	85 c0                	test   %eax,%eax
+  80021d:	78 3a                	js     800259 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80021f:	83 ec 04             	sub    $0x4,%esp
+  800222:	68 07 04 00 00       	push   $0x407
+  800227:	ff 75 f4             	push   -0xc(%ebp)
+  80022a:	6a 00                	push   $0x0
+  80022c:	e8 ba 0c 00 00       	call   800eeb <sys_page_alloc>
+  800231:	83 c4 10             	add    $0x10,%esp
+  800234:	85 c0                	test   %eax,%eax
+  800236:	78 21                	js     800259 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  800238:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80023b:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  800241:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  800243:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800246:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80024d:	83 ec 0c             	sub    $0xc,%esp
+  800250:	50                   	push   %eax
+  800251:	e8 37 11 00 00       	call   80138d <fd2num>
+  800256:	83 c4 10             	add    $0x10,%esp
+}
+  800259:	c9                   	leave
+  80025a:	c3                   	ret
+
+0080025b <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80025b:	55                   	push   %ebp
+  80025c:	89 e5                	mov    %esp,%ebp
+  80025e:	57                   	push   %edi
+  80025f:	56                   	push   %esi
+  800260:	53                   	push   %ebx
+  800261:	83 ec 1c             	sub    $0x1c,%esp
+  800264:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800267:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  80026a:	e8 24 0c 00 00       	call   800e93 <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  80026f:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  800272:	89 15 c0 76 80 00    	mov    %edx,0x8076c0
+	thisenv = &envs[ENVX(eid)];
+  800278:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80027d:	89 c1                	mov    %eax,%ecx
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  80027f:	89 e7                	mov    %esp,%edi
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800281:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  800287:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80028c:	77 16                	ja     8002a4 <libmain+0x49>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80028e:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800293:	29 f8                	sub    %edi,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  800295:	c1 e8 10             	shr    $0x10,%eax
+  800298:	74 0a                	je     8002a4 <libmain+0x49>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80029a:	c1 e0 10             	shl    $0x10,%eax
+  80029d:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8002a2:	29 c2                	sub    %eax,%edx
+  8002a4:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  8002a7:	c1 e0 04             	shl    $0x4,%eax
+  8002aa:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8002af:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8002b1:	85 db                	test   %ebx,%ebx
+  8002b3:	7e 07                	jle    8002bc <libmain+0x61>
+		binaryname = argv[0];
+  8002b5:	8b 06                	mov    (%esi),%eax
+  8002b7:	a3 1c 60 80 00       	mov    %eax,0x80601c
+
+	// call user main routine
+	umain(argc, argv);
+  8002bc:	83 ec 08             	sub    $0x8,%esp
+  8002bf:	56                   	push   %esi
+  8002c0:	53                   	push   %ebx
+  8002c1:	e8 6d fd ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8002c6:	e8 0b 00 00 00       	call   8002d6 <exit>
+}
+  8002cb:	83 c4 10             	add    $0x10,%esp
+  8002ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002d1:	5b                   	pop    %ebx
+  8002d2:	5e                   	pop    %esi
+  8002d3:	5f                   	pop    %edi
+  8002d4:	5d                   	pop    %ebp
+  8002d5:	c3                   	ret
+
+008002d6 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8002d6:	55                   	push   %ebp
+  8002d7:	89 e5                	mov    %esp,%ebp
+  8002d9:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  8002dc:	6a 00                	push   $0x0
+  8002de:	e8 19 23 00 00       	call   8025fc <fflush>
+	pthread_kill_others();
+  8002e3:	e8 84 39 00 00       	call   803c6c <pthread_kill_others>
+	close_all();
+  8002e8:	e8 9e 12 00 00       	call   80158b <close_all>
+	sys_env_destroy(0);
+  8002ed:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8002f4:	e8 4f 0b 00 00       	call   800e48 <sys_env_destroy>
+}
+  8002f9:	83 c4 10             	add    $0x10,%esp
+  8002fc:	c9                   	leave
+  8002fd:	c3                   	ret
+
+008002fe <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8002fe:	55                   	push   %ebp
+  8002ff:	89 e5                	mov    %esp,%ebp
+  800301:	56                   	push   %esi
+  800302:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800303:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800306:	8b 35 1c 60 80 00    	mov    0x80601c,%esi
+  80030c:	e8 82 0b 00 00       	call   800e93 <sys_getenvid>
+  800311:	83 ec 0c             	sub    $0xc,%esp
+  800314:	ff 75 0c             	push   0xc(%ebp)
+  800317:	ff 75 08             	push   0x8(%ebp)
+  80031a:	56                   	push   %esi
+  80031b:	50                   	push   %eax
+  80031c:	68 00 4a 80 00       	push   $0x804a00
+  800321:	e8 b3 00 00 00       	call   8003d9 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800326:	83 c4 18             	add    $0x18,%esp
+  800329:	53                   	push   %ebx
+  80032a:	ff 75 10             	push   0x10(%ebp)
+  80032d:	e8 56 00 00 00       	call   800388 <vcprintf>
+	cprintf("\n");
+  800332:	c7 04 24 e6 49 80 00 	movl   $0x8049e6,(%esp)
+  800339:	e8 9b 00 00 00       	call   8003d9 <cprintf>
+  80033e:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800341:	cc                   	int3
+	while (1)
+  800342:	eb fd                	jmp    800341 <_panic+0x43>
+
+00800344 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800344:	55                   	push   %ebp
+  800345:	89 e5                	mov    %esp,%ebp
+  800347:	53                   	push   %ebx
+  800348:	83 ec 04             	sub    $0x4,%esp
+  80034b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80034e:	8b 13                	mov    (%ebx),%edx
+  800350:	8d 42 01             	lea    0x1(%edx),%eax
+  800353:	89 03                	mov    %eax,(%ebx)
+  800355:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800358:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80035c:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800361:	74 09                	je     80036c <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800363:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800367:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80036a:	c9                   	leave
+  80036b:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80036c:	83 ec 08             	sub    $0x8,%esp
+  80036f:	68 ff 00 00 00       	push   $0xff
+  800374:	8d 43 08             	lea    0x8(%ebx),%eax
+  800377:	50                   	push   %eax
+  800378:	e8 74 0a 00 00       	call   800df1 <sys_cputs>
+		b->idx = 0;
+  80037d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800383:	83 c4 10             	add    $0x10,%esp
+  800386:	eb db                	jmp    800363 <putch+0x1f>
+
+00800388 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800388:	55                   	push   %ebp
+  800389:	89 e5                	mov    %esp,%ebp
+  80038b:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800391:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800398:	00 00 00 
+	b.cnt = 0;
+  80039b:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8003a2:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8003a5:	ff 75 0c             	push   0xc(%ebp)
+  8003a8:	ff 75 08             	push   0x8(%ebp)
+  8003ab:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8003b1:	50                   	push   %eax
+  8003b2:	68 44 03 80 00       	push   $0x800344
+  8003b7:	e8 14 01 00 00       	call   8004d0 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8003bc:	83 c4 08             	add    $0x8,%esp
+  8003bf:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8003c5:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8003cb:	50                   	push   %eax
+  8003cc:	e8 20 0a 00 00       	call   800df1 <sys_cputs>
+
+	return b.cnt;
+}
+  8003d1:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8003d7:	c9                   	leave
+  8003d8:	c3                   	ret
+
+008003d9 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8003d9:	55                   	push   %ebp
+  8003da:	89 e5                	mov    %esp,%ebp
+  8003dc:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8003df:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8003e2:	50                   	push   %eax
+  8003e3:	ff 75 08             	push   0x8(%ebp)
+  8003e6:	e8 9d ff ff ff       	call   800388 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8003eb:	c9                   	leave
+  8003ec:	c3                   	ret
+
+008003ed <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8003ed:	55                   	push   %ebp
+  8003ee:	89 e5                	mov    %esp,%ebp
+  8003f0:	57                   	push   %edi
+  8003f1:	56                   	push   %esi
+  8003f2:	53                   	push   %ebx
+  8003f3:	83 ec 1c             	sub    $0x1c,%esp
+  8003f6:	89 c7                	mov    %eax,%edi
+  8003f8:	89 d6                	mov    %edx,%esi
+  8003fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003fd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800400:	89 d1                	mov    %edx,%ecx
+  800402:	89 c2                	mov    %eax,%edx
+  800404:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800407:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80040a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80040d:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800410:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800413:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80041a:	39 c2                	cmp    %eax,%edx
+  80041c:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80041f:	72 3e                	jb     80045f <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800421:	83 ec 0c             	sub    $0xc,%esp
+  800424:	ff 75 18             	push   0x18(%ebp)
+  800427:	83 eb 01             	sub    $0x1,%ebx
+  80042a:	53                   	push   %ebx
+  80042b:	50                   	push   %eax
+  80042c:	83 ec 08             	sub    $0x8,%esp
+  80042f:	ff 75 e4             	push   -0x1c(%ebp)
+  800432:	ff 75 e0             	push   -0x20(%ebp)
+  800435:	ff 75 dc             	push   -0x24(%ebp)
+  800438:	ff 75 d8             	push   -0x28(%ebp)
+  80043b:	e8 b1 43 00 00       	call   8047f1 <__udivdi3>
+  800440:	83 c4 18             	add    $0x18,%esp
+  800443:	52                   	push   %edx
+  800444:	50                   	push   %eax
+  800445:	89 f2                	mov    %esi,%edx
+  800447:	89 f8                	mov    %edi,%eax
+  800449:	e8 9f ff ff ff       	call   8003ed <printnum>
+  80044e:	83 c4 20             	add    $0x20,%esp
+  800451:	eb 13                	jmp    800466 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800453:	83 ec 08             	sub    $0x8,%esp
+  800456:	56                   	push   %esi
+  800457:	ff 75 18             	push   0x18(%ebp)
+  80045a:	ff d7                	call   *%edi
+  80045c:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80045f:	83 eb 01             	sub    $0x1,%ebx
+  800462:	85 db                	test   %ebx,%ebx
+  800464:	7f ed                	jg     800453 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800466:	83 ec 08             	sub    $0x8,%esp
+  800469:	56                   	push   %esi
+  80046a:	83 ec 04             	sub    $0x4,%esp
+  80046d:	ff 75 e4             	push   -0x1c(%ebp)
+  800470:	ff 75 e0             	push   -0x20(%ebp)
+  800473:	ff 75 dc             	push   -0x24(%ebp)
+  800476:	ff 75 d8             	push   -0x28(%ebp)
+  800479:	e8 94 43 00 00       	call   804812 <__umoddi3>
+  80047e:	83 c4 14             	add    $0x14,%esp
+  800481:	0f be 80 23 4a 80 00 	movsbl 0x804a23(%eax),%eax
+  800488:	50                   	push   %eax
+  800489:	ff d7                	call   *%edi
+}
+  80048b:	83 c4 10             	add    $0x10,%esp
+  80048e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800491:	5b                   	pop    %ebx
+  800492:	5e                   	pop    %esi
+  800493:	5f                   	pop    %edi
+  800494:	5d                   	pop    %ebp
+  800495:	c3                   	ret
+
+00800496 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800496:	55                   	push   %ebp
+  800497:	89 e5                	mov    %esp,%ebp
+  800499:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80049c:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8004a0:	8b 10                	mov    (%eax),%edx
+  8004a2:	3b 50 04             	cmp    0x4(%eax),%edx
+  8004a5:	73 0a                	jae    8004b1 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8004a7:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8004aa:	89 08                	mov    %ecx,(%eax)
+  8004ac:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004af:	88 02                	mov    %al,(%edx)
+}
+  8004b1:	5d                   	pop    %ebp
+  8004b2:	c3                   	ret
+
+008004b3 <printfmt>:
+{
+  8004b3:	55                   	push   %ebp
+  8004b4:	89 e5                	mov    %esp,%ebp
+  8004b6:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8004b9:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8004bc:	50                   	push   %eax
+  8004bd:	ff 75 10             	push   0x10(%ebp)
+  8004c0:	ff 75 0c             	push   0xc(%ebp)
+  8004c3:	ff 75 08             	push   0x8(%ebp)
+  8004c6:	e8 05 00 00 00       	call   8004d0 <vprintfmt>
+}
+  8004cb:	83 c4 10             	add    $0x10,%esp
+  8004ce:	c9                   	leave
+  8004cf:	c3                   	ret
+
+008004d0 <vprintfmt>:
+{
+  8004d0:	55                   	push   %ebp
+  8004d1:	89 e5                	mov    %esp,%ebp
+  8004d3:	57                   	push   %edi
+  8004d4:	56                   	push   %esi
+  8004d5:	53                   	push   %ebx
+  8004d6:	83 ec 2c             	sub    $0x2c,%esp
+  8004d9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004dc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8004df:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8004e2:	eb 0a                	jmp    8004ee <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8004e4:	83 ec 08             	sub    $0x8,%esp
+  8004e7:	53                   	push   %ebx
+  8004e8:	50                   	push   %eax
+  8004e9:	ff d6                	call   *%esi
+  8004eb:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  8004ee:	83 c7 01             	add    $0x1,%edi
+  8004f1:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  8004f5:	83 f8 25             	cmp    $0x25,%eax
+  8004f8:	74 0c                	je     800506 <vprintfmt+0x36>
+			if (ch == '\0')
+  8004fa:	85 c0                	test   %eax,%eax
+  8004fc:	75 e6                	jne    8004e4 <vprintfmt+0x14>
+}
+  8004fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800501:	5b                   	pop    %ebx
+  800502:	5e                   	pop    %esi
+  800503:	5f                   	pop    %edi
+  800504:	5d                   	pop    %ebp
+  800505:	c3                   	ret
+		padc = ' ';
+  800506:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80050a:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800511:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800518:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80051f:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  800524:	8d 47 01             	lea    0x1(%edi),%eax
+  800527:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80052a:	0f b6 17             	movzbl (%edi),%edx
+  80052d:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800530:	3c 55                	cmp    $0x55,%al
+  800532:	0f 87 c5 03 00 00    	ja     8008fd <vprintfmt+0x42d>
+  800538:	0f b6 c0             	movzbl %al,%eax
+  80053b:	ff 24 85 a0 4b 80 00 	jmp    *0x804ba0(,%eax,4)
+  800542:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  800545:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800548:	eb da                	jmp    800524 <vprintfmt+0x54>
+  80054a:	0f be d2             	movsbl %dl,%edx
+  80054d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800550:	b8 00 00 00 00       	mov    $0x0,%eax
+  800555:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800558:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80055b:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80055f:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800562:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800565:	83 f9 09             	cmp    $0x9,%ecx
+  800568:	77 55                	ja     8005bf <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  80056a:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  80056d:	eb e9                	jmp    800558 <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  80056f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800572:	8b 00                	mov    (%eax),%eax
+  800574:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800577:	8b 45 14             	mov    0x14(%ebp),%eax
+  80057a:	8d 40 04             	lea    0x4(%eax),%eax
+  80057d:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  800580:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800583:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800587:	79 9b                	jns    800524 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800589:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80058c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80058f:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800596:	eb 8c                	jmp    800524 <vprintfmt+0x54>
+			if (width < 0)
+  800598:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80059b:	85 d2                	test   %edx,%edx
+  80059d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005a2:	0f 49 c2             	cmovns %edx,%eax
+  8005a5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  8005a8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8005ab:	e9 74 ff ff ff       	jmp    800524 <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  8005b0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8005b3:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8005ba:	e9 65 ff ff ff       	jmp    800524 <vprintfmt+0x54>
+  8005bf:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8005c2:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8005c5:	eb bc                	jmp    800583 <vprintfmt+0xb3>
+			lflag++;
+  8005c7:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  8005ca:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8005cd:	e9 52 ff ff ff       	jmp    800524 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8005d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d5:	8d 78 04             	lea    0x4(%eax),%edi
+  8005d8:	83 ec 08             	sub    $0x8,%esp
+  8005db:	53                   	push   %ebx
+  8005dc:	ff 30                	push   (%eax)
+  8005de:	ff d6                	call   *%esi
+			break;
+  8005e0:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8005e3:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8005e6:	e9 b1 02 00 00       	jmp    80089c <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  8005eb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ee:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8005f1:	8b 10                	mov    (%eax),%edx
+  8005f3:	89 d0                	mov    %edx,%eax
+  8005f5:	f7 d8                	neg    %eax
+  8005f7:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8005fa:	83 f8 14             	cmp    $0x14,%eax
+  8005fd:	7f 23                	jg     800622 <vprintfmt+0x152>
+  8005ff:	8b 14 85 00 4d 80 00 	mov    0x804d00(,%eax,4),%edx
+  800606:	85 d2                	test   %edx,%edx
+  800608:	74 18                	je     800622 <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  80060a:	52                   	push   %edx
+  80060b:	68 7f 4e 80 00       	push   $0x804e7f
+  800610:	53                   	push   %ebx
+  800611:	56                   	push   %esi
+  800612:	e8 9c fe ff ff       	call   8004b3 <printfmt>
+  800617:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80061a:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80061d:	e9 7a 02 00 00       	jmp    80089c <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  800622:	50                   	push   %eax
+  800623:	68 3b 4a 80 00       	push   $0x804a3b
+  800628:	53                   	push   %ebx
+  800629:	56                   	push   %esi
+  80062a:	e8 84 fe ff ff       	call   8004b3 <printfmt>
+  80062f:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800632:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800635:	e9 62 02 00 00       	jmp    80089c <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80063a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063d:	83 c0 04             	add    $0x4,%eax
+  800640:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800643:	8b 45 14             	mov    0x14(%ebp),%eax
+  800646:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800648:	85 c9                	test   %ecx,%ecx
+  80064a:	b8 34 4a 80 00       	mov    $0x804a34,%eax
+  80064f:	0f 45 c1             	cmovne %ecx,%eax
+  800652:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800655:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800659:	7e 06                	jle    800661 <vprintfmt+0x191>
+  80065b:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80065f:	75 0b                	jne    80066c <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800661:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800664:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800667:	89 75 08             	mov    %esi,0x8(%ebp)
+  80066a:	eb 5c                	jmp    8006c8 <vprintfmt+0x1f8>
+  80066c:	83 ec 08             	sub    $0x8,%esp
+  80066f:	ff 75 d0             	push   -0x30(%ebp)
+  800672:	ff 75 cc             	push   -0x34(%ebp)
+  800675:	e8 10 04 00 00       	call   800a8a <strnlen>
+  80067a:	89 c2                	mov    %eax,%edx
+  80067c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80067f:	29 d0                	sub    %edx,%eax
+  800681:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800684:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800688:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80068b:	89 75 08             	mov    %esi,0x8(%ebp)
+  80068e:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800690:	eb 0e                	jmp    8006a0 <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  800692:	83 ec 08             	sub    $0x8,%esp
+  800695:	53                   	push   %ebx
+  800696:	57                   	push   %edi
+  800697:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80069a:	83 ee 01             	sub    $0x1,%esi
+  80069d:	83 c4 10             	add    $0x10,%esp
+  8006a0:	85 f6                	test   %esi,%esi
+  8006a2:	7f ee                	jg     800692 <vprintfmt+0x1c2>
+  8006a4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006a7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006aa:	85 c0                	test   %eax,%eax
+  8006ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006b1:	0f 49 d0             	cmovns %eax,%edx
+  8006b4:	29 d0                	sub    %edx,%eax
+  8006b6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006b9:	eb a6                	jmp    800661 <vprintfmt+0x191>
+					putch(ch, putdat);
+  8006bb:	83 ec 08             	sub    $0x8,%esp
+  8006be:	53                   	push   %ebx
+  8006bf:	52                   	push   %edx
+  8006c0:	ff 55 08             	call   *0x8(%ebp)
+  8006c3:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8006c6:	89 f1                	mov    %esi,%ecx
+  8006c8:	8d 71 01             	lea    0x1(%ecx),%esi
+  8006cb:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8006cf:	0f be d0             	movsbl %al,%edx
+  8006d2:	85 d2                	test   %edx,%edx
+  8006d4:	74 28                	je     8006fe <vprintfmt+0x22e>
+  8006d6:	85 ff                	test   %edi,%edi
+  8006d8:	78 05                	js     8006df <vprintfmt+0x20f>
+  8006da:	83 ef 01             	sub    $0x1,%edi
+  8006dd:	78 30                	js     80070f <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8006df:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8006e3:	74 d6                	je     8006bb <vprintfmt+0x1eb>
+  8006e5:	0f be c0             	movsbl %al,%eax
+  8006e8:	83 e8 20             	sub    $0x20,%eax
+  8006eb:	83 f8 5e             	cmp    $0x5e,%eax
+  8006ee:	76 cb                	jbe    8006bb <vprintfmt+0x1eb>
+					putch('?', putdat);
+  8006f0:	83 ec 08             	sub    $0x8,%esp
+  8006f3:	53                   	push   %ebx
+  8006f4:	6a 3f                	push   $0x3f
+  8006f6:	ff 55 08             	call   *0x8(%ebp)
+  8006f9:	83 c4 10             	add    $0x10,%esp
+  8006fc:	eb c8                	jmp    8006c6 <vprintfmt+0x1f6>
+  8006fe:	8b 75 08             	mov    0x8(%ebp),%esi
+  800701:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800704:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800707:	01 d0                	add    %edx,%eax
+  800709:	29 c8                	sub    %ecx,%eax
+  80070b:	89 c7                	mov    %eax,%edi
+  80070d:	eb 13                	jmp    800722 <vprintfmt+0x252>
+  80070f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800712:	eb ed                	jmp    800701 <vprintfmt+0x231>
+				putch(' ', putdat);
+  800714:	83 ec 08             	sub    $0x8,%esp
+  800717:	53                   	push   %ebx
+  800718:	6a 20                	push   $0x20
+  80071a:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80071c:	83 ef 01             	sub    $0x1,%edi
+  80071f:	83 c4 10             	add    $0x10,%esp
+  800722:	85 ff                	test   %edi,%edi
+  800724:	7f ee                	jg     800714 <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800726:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800729:	89 45 14             	mov    %eax,0x14(%ebp)
+  80072c:	e9 6b 01 00 00       	jmp    80089c <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  800731:	83 f9 01             	cmp    $0x1,%ecx
+  800734:	7f 1f                	jg     800755 <vprintfmt+0x285>
+	else if (lflag)
+  800736:	85 c9                	test   %ecx,%ecx
+  800738:	74 67                	je     8007a1 <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  80073a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80073d:	8b 00                	mov    (%eax),%eax
+  80073f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800742:	89 c1                	mov    %eax,%ecx
+  800744:	c1 f9 1f             	sar    $0x1f,%ecx
+  800747:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80074a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80074d:	8d 40 04             	lea    0x4(%eax),%eax
+  800750:	89 45 14             	mov    %eax,0x14(%ebp)
+  800753:	eb 17                	jmp    80076c <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  800755:	8b 45 14             	mov    0x14(%ebp),%eax
+  800758:	8b 50 04             	mov    0x4(%eax),%edx
+  80075b:	8b 00                	mov    (%eax),%eax
+  80075d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800760:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800763:	8b 45 14             	mov    0x14(%ebp),%eax
+  800766:	8d 40 08             	lea    0x8(%eax),%eax
+  800769:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80076c:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80076f:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800772:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800777:	85 c9                	test   %ecx,%ecx
+  800779:	0f 89 03 01 00 00    	jns    800882 <vprintfmt+0x3b2>
+				putch('-', putdat);
+  80077f:	83 ec 08             	sub    $0x8,%esp
+  800782:	53                   	push   %ebx
+  800783:	6a 2d                	push   $0x2d
+  800785:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800787:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80078a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80078d:	f7 da                	neg    %edx
+  80078f:	83 d1 00             	adc    $0x0,%ecx
+  800792:	f7 d9                	neg    %ecx
+  800794:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800797:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80079c:	e9 e1 00 00 00       	jmp    800882 <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  8007a1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a4:	8b 00                	mov    (%eax),%eax
+  8007a6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007a9:	89 c1                	mov    %eax,%ecx
+  8007ab:	c1 f9 1f             	sar    $0x1f,%ecx
+  8007ae:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8007b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b4:	8d 40 04             	lea    0x4(%eax),%eax
+  8007b7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007ba:	eb b0                	jmp    80076c <vprintfmt+0x29c>
+	if (lflag >= 2)
+  8007bc:	83 f9 01             	cmp    $0x1,%ecx
+  8007bf:	7f 1e                	jg     8007df <vprintfmt+0x30f>
+	else if (lflag)
+  8007c1:	85 c9                	test   %ecx,%ecx
+  8007c3:	74 32                	je     8007f7 <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  8007c5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c8:	8b 10                	mov    (%eax),%edx
+  8007ca:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007cf:	8d 40 04             	lea    0x4(%eax),%eax
+  8007d2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007d5:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8007da:	e9 a3 00 00 00       	jmp    800882 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8007df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e2:	8b 10                	mov    (%eax),%edx
+  8007e4:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007e7:	8d 40 08             	lea    0x8(%eax),%eax
+  8007ea:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007ed:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8007f2:	e9 8b 00 00 00       	jmp    800882 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8007f7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007fa:	8b 10                	mov    (%eax),%edx
+  8007fc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800801:	8d 40 04             	lea    0x4(%eax),%eax
+  800804:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800807:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80080c:	eb 74                	jmp    800882 <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  80080e:	83 f9 01             	cmp    $0x1,%ecx
+  800811:	7f 1b                	jg     80082e <vprintfmt+0x35e>
+	else if (lflag)
+  800813:	85 c9                	test   %ecx,%ecx
+  800815:	74 2c                	je     800843 <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  800817:	8b 45 14             	mov    0x14(%ebp),%eax
+  80081a:	8b 10                	mov    (%eax),%edx
+  80081c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800821:	8d 40 04             	lea    0x4(%eax),%eax
+  800824:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800827:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  80082c:	eb 54                	jmp    800882 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  80082e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800831:	8b 10                	mov    (%eax),%edx
+  800833:	8b 48 04             	mov    0x4(%eax),%ecx
+  800836:	8d 40 08             	lea    0x8(%eax),%eax
+  800839:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80083c:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800841:	eb 3f                	jmp    800882 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800843:	8b 45 14             	mov    0x14(%ebp),%eax
+  800846:	8b 10                	mov    (%eax),%edx
+  800848:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80084d:	8d 40 04             	lea    0x4(%eax),%eax
+  800850:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800853:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800858:	eb 28                	jmp    800882 <vprintfmt+0x3b2>
+			putch('0', putdat);
+  80085a:	83 ec 08             	sub    $0x8,%esp
+  80085d:	53                   	push   %ebx
+  80085e:	6a 30                	push   $0x30
+  800860:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800862:	83 c4 08             	add    $0x8,%esp
+  800865:	53                   	push   %ebx
+  800866:	6a 78                	push   $0x78
+  800868:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80086a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80086d:	8b 10                	mov    (%eax),%edx
+  80086f:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800874:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800877:	8d 40 04             	lea    0x4(%eax),%eax
+  80087a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80087d:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800882:	83 ec 0c             	sub    $0xc,%esp
+  800885:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800889:	50                   	push   %eax
+  80088a:	ff 75 e0             	push   -0x20(%ebp)
+  80088d:	57                   	push   %edi
+  80088e:	51                   	push   %ecx
+  80088f:	52                   	push   %edx
+  800890:	89 da                	mov    %ebx,%edx
+  800892:	89 f0                	mov    %esi,%eax
+  800894:	e8 54 fb ff ff       	call   8003ed <printnum>
+			break;
+  800899:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80089c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  80089f:	e9 4a fc ff ff       	jmp    8004ee <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8008a4:	83 f9 01             	cmp    $0x1,%ecx
+  8008a7:	7f 1b                	jg     8008c4 <vprintfmt+0x3f4>
+	else if (lflag)
+  8008a9:	85 c9                	test   %ecx,%ecx
+  8008ab:	74 2c                	je     8008d9 <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  8008ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008b0:	8b 10                	mov    (%eax),%edx
+  8008b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008b7:	8d 40 04             	lea    0x4(%eax),%eax
+  8008ba:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008bd:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8008c2:	eb be                	jmp    800882 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8008c4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008c7:	8b 10                	mov    (%eax),%edx
+  8008c9:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008cc:	8d 40 08             	lea    0x8(%eax),%eax
+  8008cf:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008d2:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8008d7:	eb a9                	jmp    800882 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8008d9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008dc:	8b 10                	mov    (%eax),%edx
+  8008de:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008e3:	8d 40 04             	lea    0x4(%eax),%eax
+  8008e6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008e9:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8008ee:	eb 92                	jmp    800882 <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  8008f0:	83 ec 08             	sub    $0x8,%esp
+  8008f3:	53                   	push   %ebx
+  8008f4:	6a 25                	push   $0x25
+  8008f6:	ff d6                	call   *%esi
+			break;
+  8008f8:	83 c4 10             	add    $0x10,%esp
+  8008fb:	eb 9f                	jmp    80089c <vprintfmt+0x3cc>
+			putch('%', putdat);
+  8008fd:	83 ec 08             	sub    $0x8,%esp
+  800900:	53                   	push   %ebx
+  800901:	6a 25                	push   $0x25
+  800903:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800905:	83 c4 10             	add    $0x10,%esp
+  800908:	89 f8                	mov    %edi,%eax
+  80090a:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80090e:	74 05                	je     800915 <vprintfmt+0x445>
+  800910:	83 e8 01             	sub    $0x1,%eax
+  800913:	eb f5                	jmp    80090a <vprintfmt+0x43a>
+  800915:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800918:	eb 82                	jmp    80089c <vprintfmt+0x3cc>
+
+0080091a <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80091a:	55                   	push   %ebp
+  80091b:	89 e5                	mov    %esp,%ebp
+  80091d:	83 ec 18             	sub    $0x18,%esp
+  800920:	8b 45 08             	mov    0x8(%ebp),%eax
+  800923:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800926:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800929:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80092d:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800930:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800937:	85 c0                	test   %eax,%eax
+  800939:	74 26                	je     800961 <vsnprintf+0x47>
+  80093b:	85 d2                	test   %edx,%edx
+  80093d:	7e 22                	jle    800961 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80093f:	ff 75 14             	push   0x14(%ebp)
+  800942:	ff 75 10             	push   0x10(%ebp)
+  800945:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800948:	50                   	push   %eax
+  800949:	68 96 04 80 00       	push   $0x800496
+  80094e:	e8 7d fb ff ff       	call   8004d0 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800953:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800956:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800959:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80095c:	83 c4 10             	add    $0x10,%esp
+}
+  80095f:	c9                   	leave
+  800960:	c3                   	ret
+		return -E_INVAL;
+  800961:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800966:	eb f7                	jmp    80095f <vsnprintf+0x45>
+
+00800968 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800968:	55                   	push   %ebp
+  800969:	89 e5                	mov    %esp,%ebp
+  80096b:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80096e:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800971:	50                   	push   %eax
+  800972:	ff 75 10             	push   0x10(%ebp)
+  800975:	ff 75 0c             	push   0xc(%ebp)
+  800978:	ff 75 08             	push   0x8(%ebp)
+  80097b:	e8 9a ff ff ff       	call   80091a <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800980:	c9                   	leave
+  800981:	c3                   	ret
+
+00800982 <readline>:
+#define BUFLEN 1024
+static char buf[BUFLEN];
+
+char *
+readline(const char *prompt)
+{
+  800982:	55                   	push   %ebp
+  800983:	89 e5                	mov    %esp,%ebp
+  800985:	57                   	push   %edi
+  800986:	56                   	push   %esi
+  800987:	53                   	push   %ebx
+  800988:	83 ec 0c             	sub    $0xc,%esp
+  80098b:	8b 45 08             	mov    0x8(%ebp),%eax
+
+#if JOS_KERNEL
+	if (prompt != NULL)
+		cprintf("%s", prompt);
+#else
+	if (prompt != NULL)
+  80098e:	85 c0                	test   %eax,%eax
+  800990:	74 13                	je     8009a5 <readline+0x23>
+		fprintf(1, "%s", prompt);
+  800992:	83 ec 04             	sub    $0x4,%esp
+  800995:	50                   	push   %eax
+  800996:	68 7f 4e 80 00       	push   $0x804e7f
+  80099b:	6a 01                	push   $0x1
+  80099d:	e8 6a 18 00 00       	call   80220c <fprintf>
+  8009a2:	83 c4 10             	add    $0x10,%esp
+#endif
+
+	i = 0;
+	echoing = iscons(0);
+  8009a5:	83 ec 0c             	sub    $0xc,%esp
+  8009a8:	6a 00                	push   $0x0
+  8009aa:	e8 2e f8 ff ff       	call   8001dd <iscons>
+  8009af:	89 c7                	mov    %eax,%edi
+  8009b1:	83 c4 10             	add    $0x10,%esp
+	i = 0;
+  8009b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8009b9:	eb 4b                	jmp    800a06 <readline+0x84>
+	while (1) {
+		c = getchar();
+		if (c < 0) {
+			if (c != -E_EOF)
+				cprintf("read error: %e\n", c);
+			return NULL;
+  8009bb:	b8 00 00 00 00       	mov    $0x0,%eax
+			if (c != -E_EOF)
+  8009c0:	83 fb f8             	cmp    $0xfffffff8,%ebx
+  8009c3:	75 08                	jne    8009cd <readline+0x4b>
+				cputchar('\n');
+			buf[i] = 0;
+			return buf;
+		}
+	}
+}
+  8009c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009c8:	5b                   	pop    %ebx
+  8009c9:	5e                   	pop    %esi
+  8009ca:	5f                   	pop    %edi
+  8009cb:	5d                   	pop    %ebp
+  8009cc:	c3                   	ret
+				cprintf("read error: %e\n", c);
+  8009cd:	83 ec 08             	sub    $0x8,%esp
+  8009d0:	53                   	push   %ebx
+  8009d1:	68 95 4d 80 00       	push   $0x804d95
+  8009d6:	e8 fe f9 ff ff       	call   8003d9 <cprintf>
+  8009db:	83 c4 10             	add    $0x10,%esp
+			return NULL;
+  8009de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009e3:	eb e0                	jmp    8009c5 <readline+0x43>
+			if (echoing)
+  8009e5:	85 ff                	test   %edi,%edi
+  8009e7:	75 05                	jne    8009ee <readline+0x6c>
+			i--;
+  8009e9:	83 ee 01             	sub    $0x1,%esi
+  8009ec:	eb 18                	jmp    800a06 <readline+0x84>
+				cputchar('\b');
+  8009ee:	83 ec 0c             	sub    $0xc,%esp
+  8009f1:	6a 08                	push   $0x8
+  8009f3:	e8 a0 f7 ff ff       	call   800198 <cputchar>
+  8009f8:	83 c4 10             	add    $0x10,%esp
+  8009fb:	eb ec                	jmp    8009e9 <readline+0x67>
+			buf[i++] = c;
+  8009fd:	88 9e 00 70 80 00    	mov    %bl,0x807000(%esi)
+  800a03:	8d 76 01             	lea    0x1(%esi),%esi
+		c = getchar();
+  800a06:	e8 a9 f7 ff ff       	call   8001b4 <getchar>
+  800a0b:	89 c3                	mov    %eax,%ebx
+		if (c < 0) {
+  800a0d:	85 c0                	test   %eax,%eax
+  800a0f:	78 aa                	js     8009bb <readline+0x39>
+		} else if ((c == '\b' || c == '\x7f') && i > 0) {
+  800a11:	83 f8 08             	cmp    $0x8,%eax
+  800a14:	0f 94 c0             	sete   %al
+  800a17:	83 fb 7f             	cmp    $0x7f,%ebx
+  800a1a:	0f 94 c2             	sete   %dl
+  800a1d:	08 d0                	or     %dl,%al
+  800a1f:	74 04                	je     800a25 <readline+0xa3>
+  800a21:	85 f6                	test   %esi,%esi
+  800a23:	7f c0                	jg     8009e5 <readline+0x63>
+		} else if (c >= ' ' && i < BUFLEN-1) {
+  800a25:	83 fb 1f             	cmp    $0x1f,%ebx
+  800a28:	7e 1a                	jle    800a44 <readline+0xc2>
+  800a2a:	81 fe fe 03 00 00    	cmp    $0x3fe,%esi
+  800a30:	7f 12                	jg     800a44 <readline+0xc2>
+			if (echoing)
+  800a32:	85 ff                	test   %edi,%edi
+  800a34:	74 c7                	je     8009fd <readline+0x7b>
+				cputchar(c);
+  800a36:	83 ec 0c             	sub    $0xc,%esp
+  800a39:	53                   	push   %ebx
+  800a3a:	e8 59 f7 ff ff       	call   800198 <cputchar>
+  800a3f:	83 c4 10             	add    $0x10,%esp
+  800a42:	eb b9                	jmp    8009fd <readline+0x7b>
+		} else if (c == '\n' || c == '\r') {
+  800a44:	83 fb 0a             	cmp    $0xa,%ebx
+  800a47:	74 05                	je     800a4e <readline+0xcc>
+  800a49:	83 fb 0d             	cmp    $0xd,%ebx
+  800a4c:	75 b8                	jne    800a06 <readline+0x84>
+			if (echoing)
+  800a4e:	85 ff                	test   %edi,%edi
+  800a50:	75 11                	jne    800a63 <readline+0xe1>
+			buf[i] = 0;
+  800a52:	c6 86 00 70 80 00 00 	movb   $0x0,0x807000(%esi)
+			return buf;
+  800a59:	b8 00 70 80 00       	mov    $0x807000,%eax
+  800a5e:	e9 62 ff ff ff       	jmp    8009c5 <readline+0x43>
+				cputchar('\n');
+  800a63:	83 ec 0c             	sub    $0xc,%esp
+  800a66:	6a 0a                	push   $0xa
+  800a68:	e8 2b f7 ff ff       	call   800198 <cputchar>
+  800a6d:	83 c4 10             	add    $0x10,%esp
+  800a70:	eb e0                	jmp    800a52 <readline+0xd0>
+
+00800a72 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800a72:	55                   	push   %ebp
+  800a73:	89 e5                	mov    %esp,%ebp
+  800a75:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800a78:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a7d:	eb 03                	jmp    800a82 <strlen+0x10>
+		n++;
+  800a7f:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800a82:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800a86:	75 f7                	jne    800a7f <strlen+0xd>
+	return n;
+}
+  800a88:	5d                   	pop    %ebp
+  800a89:	c3                   	ret
+
+00800a8a <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800a8a:	55                   	push   %ebp
+  800a8b:	89 e5                	mov    %esp,%ebp
+  800a8d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a90:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a93:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a98:	eb 03                	jmp    800a9d <strnlen+0x13>
+		n++;
+  800a9a:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a9d:	39 d0                	cmp    %edx,%eax
+  800a9f:	74 08                	je     800aa9 <strnlen+0x1f>
+  800aa1:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800aa5:	75 f3                	jne    800a9a <strnlen+0x10>
+  800aa7:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800aa9:	89 d0                	mov    %edx,%eax
+  800aab:	5d                   	pop    %ebp
+  800aac:	c3                   	ret
+
+00800aad <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800aad:	55                   	push   %ebp
+  800aae:	89 e5                	mov    %esp,%ebp
+  800ab0:	53                   	push   %ebx
+  800ab1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ab4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800ab7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800abc:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800ac0:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800ac3:	83 c0 01             	add    $0x1,%eax
+  800ac6:	84 d2                	test   %dl,%dl
+  800ac8:	75 f2                	jne    800abc <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800aca:	89 c8                	mov    %ecx,%eax
+  800acc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800acf:	c9                   	leave
+  800ad0:	c3                   	ret
+
+00800ad1 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800ad1:	55                   	push   %ebp
+  800ad2:	89 e5                	mov    %esp,%ebp
+  800ad4:	53                   	push   %ebx
+  800ad5:	83 ec 10             	sub    $0x10,%esp
+  800ad8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800adb:	53                   	push   %ebx
+  800adc:	e8 91 ff ff ff       	call   800a72 <strlen>
+  800ae1:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800ae4:	ff 75 0c             	push   0xc(%ebp)
+  800ae7:	01 d8                	add    %ebx,%eax
+  800ae9:	50                   	push   %eax
+  800aea:	e8 be ff ff ff       	call   800aad <strcpy>
+	return dst;
+}
+  800aef:	89 d8                	mov    %ebx,%eax
+  800af1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800af4:	c9                   	leave
+  800af5:	c3                   	ret
+
+00800af6 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800af6:	55                   	push   %ebp
+  800af7:	89 e5                	mov    %esp,%ebp
+  800af9:	56                   	push   %esi
+  800afa:	53                   	push   %ebx
+  800afb:	8b 75 08             	mov    0x8(%ebp),%esi
+  800afe:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800b01:	89 f3                	mov    %esi,%ebx
+  800b03:	03 5d 10             	add    0x10(%ebp),%ebx
+  800b06:	89 f0                	mov    %esi,%eax
+  800b08:	eb 0f                	jmp    800b19 <strncpy+0x23>
+		*dst++ = *src;
+  800b0a:	83 c0 01             	add    $0x1,%eax
+  800b0d:	0f b6 0a             	movzbl (%edx),%ecx
+  800b10:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800b13:	80 f9 01             	cmp    $0x1,%cl
+  800b16:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800b19:	39 d8                	cmp    %ebx,%eax
+  800b1b:	75 ed                	jne    800b0a <strncpy+0x14>
+	}
+	return ret;
+}
+  800b1d:	89 f0                	mov    %esi,%eax
+  800b1f:	5b                   	pop    %ebx
+  800b20:	5e                   	pop    %esi
+  800b21:	5d                   	pop    %ebp
+  800b22:	c3                   	ret
+
+00800b23 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800b23:	55                   	push   %ebp
+  800b24:	89 e5                	mov    %esp,%ebp
+  800b26:	56                   	push   %esi
+  800b27:	53                   	push   %ebx
+  800b28:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b2b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b2e:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800b31:	89 f0                	mov    %esi,%eax
+  800b33:	85 d2                	test   %edx,%edx
+  800b35:	74 21                	je     800b58 <strlcpy+0x35>
+  800b37:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800b3b:	89 f2                	mov    %esi,%edx
+  800b3d:	eb 09                	jmp    800b48 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800b3f:	83 c1 01             	add    $0x1,%ecx
+  800b42:	83 c2 01             	add    $0x1,%edx
+  800b45:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800b48:	39 c2                	cmp    %eax,%edx
+  800b4a:	74 09                	je     800b55 <strlcpy+0x32>
+  800b4c:	0f b6 19             	movzbl (%ecx),%ebx
+  800b4f:	84 db                	test   %bl,%bl
+  800b51:	75 ec                	jne    800b3f <strlcpy+0x1c>
+  800b53:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800b55:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800b58:	29 f0                	sub    %esi,%eax
+}
+  800b5a:	5b                   	pop    %ebx
+  800b5b:	5e                   	pop    %esi
+  800b5c:	5d                   	pop    %ebp
+  800b5d:	c3                   	ret
+
+00800b5e <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800b5e:	55                   	push   %ebp
+  800b5f:	89 e5                	mov    %esp,%ebp
+  800b61:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b64:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800b67:	eb 06                	jmp    800b6f <strcmp+0x11>
+		p++, q++;
+  800b69:	83 c1 01             	add    $0x1,%ecx
+  800b6c:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800b6f:	0f b6 01             	movzbl (%ecx),%eax
+  800b72:	84 c0                	test   %al,%al
+  800b74:	74 04                	je     800b7a <strcmp+0x1c>
+  800b76:	3a 02                	cmp    (%edx),%al
+  800b78:	74 ef                	je     800b69 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b7a:	0f b6 c0             	movzbl %al,%eax
+  800b7d:	0f b6 12             	movzbl (%edx),%edx
+  800b80:	29 d0                	sub    %edx,%eax
+}
+  800b82:	5d                   	pop    %ebp
+  800b83:	c3                   	ret
+
+00800b84 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800b84:	55                   	push   %ebp
+  800b85:	89 e5                	mov    %esp,%ebp
+  800b87:	53                   	push   %ebx
+  800b88:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b8b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b8e:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800b91:	eb 09                	jmp    800b9c <strncmp+0x18>
+		n--, p++, q++;
+  800b93:	83 ea 01             	sub    $0x1,%edx
+  800b96:	83 c0 01             	add    $0x1,%eax
+  800b99:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800b9c:	85 d2                	test   %edx,%edx
+  800b9e:	74 18                	je     800bb8 <strncmp+0x34>
+  800ba0:	0f b6 18             	movzbl (%eax),%ebx
+  800ba3:	84 db                	test   %bl,%bl
+  800ba5:	74 04                	je     800bab <strncmp+0x27>
+  800ba7:	3a 19                	cmp    (%ecx),%bl
+  800ba9:	74 e8                	je     800b93 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800bab:	0f b6 00             	movzbl (%eax),%eax
+  800bae:	0f b6 11             	movzbl (%ecx),%edx
+  800bb1:	29 d0                	sub    %edx,%eax
+}
+  800bb3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bb6:	c9                   	leave
+  800bb7:	c3                   	ret
+		return 0;
+  800bb8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bbd:	eb f4                	jmp    800bb3 <strncmp+0x2f>
+
+00800bbf <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800bbf:	55                   	push   %ebp
+  800bc0:	89 e5                	mov    %esp,%ebp
+  800bc2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bc5:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800bc9:	eb 03                	jmp    800bce <strchr+0xf>
+  800bcb:	83 c0 01             	add    $0x1,%eax
+  800bce:	0f b6 10             	movzbl (%eax),%edx
+  800bd1:	84 d2                	test   %dl,%dl
+  800bd3:	74 06                	je     800bdb <strchr+0x1c>
+		if (*s == c)
+  800bd5:	38 ca                	cmp    %cl,%dl
+  800bd7:	75 f2                	jne    800bcb <strchr+0xc>
+  800bd9:	eb 05                	jmp    800be0 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800bdb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800be0:	5d                   	pop    %ebp
+  800be1:	c3                   	ret
+
+00800be2 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800be2:	55                   	push   %ebp
+  800be3:	89 e5                	mov    %esp,%ebp
+  800be5:	8b 45 08             	mov    0x8(%ebp),%eax
+  800be8:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800bec:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800bef:	38 ca                	cmp    %cl,%dl
+  800bf1:	74 09                	je     800bfc <strfind+0x1a>
+  800bf3:	84 d2                	test   %dl,%dl
+  800bf5:	74 05                	je     800bfc <strfind+0x1a>
+	for (; *s; s++)
+  800bf7:	83 c0 01             	add    $0x1,%eax
+  800bfa:	eb f0                	jmp    800bec <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800bfc:	5d                   	pop    %ebp
+  800bfd:	c3                   	ret
+
+00800bfe <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800bfe:	55                   	push   %ebp
+  800bff:	89 e5                	mov    %esp,%ebp
+  800c01:	57                   	push   %edi
+  800c02:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800c05:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800c08:	85 c9                	test   %ecx,%ecx
+  800c0a:	74 20                	je     800c2c <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800c0c:	89 f8                	mov    %edi,%eax
+  800c0e:	09 c8                	or     %ecx,%eax
+  800c10:	a8 03                	test   $0x3,%al
+  800c12:	75 12                	jne    800c26 <memset+0x28>
+		c &= 0xFF;
+  800c14:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800c18:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800c1e:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800c21:	fc                   	cld
+  800c22:	f3 ab                	rep stos %eax,%es:(%edi)
+  800c24:	eb 06                	jmp    800c2c <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800c26:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c29:	fc                   	cld
+  800c2a:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800c2c:	89 f8                	mov    %edi,%eax
+  800c2e:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800c31:	c9                   	leave
+  800c32:	c3                   	ret
+
+00800c33 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800c33:	55                   	push   %ebp
+  800c34:	89 e5                	mov    %esp,%ebp
+  800c36:	57                   	push   %edi
+  800c37:	56                   	push   %esi
+  800c38:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c3b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c3e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800c41:	39 c6                	cmp    %eax,%esi
+  800c43:	73 32                	jae    800c77 <memmove+0x44>
+  800c45:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800c48:	39 d0                	cmp    %edx,%eax
+  800c4a:	73 2b                	jae    800c77 <memmove+0x44>
+		s += n;
+		d += n;
+  800c4c:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c4f:	89 d6                	mov    %edx,%esi
+  800c51:	09 fe                	or     %edi,%esi
+  800c53:	09 ce                	or     %ecx,%esi
+  800c55:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800c5b:	75 0e                	jne    800c6b <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800c5d:	83 ef 04             	sub    $0x4,%edi
+  800c60:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800c63:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800c66:	fd                   	std
+  800c67:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c69:	eb 09                	jmp    800c74 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800c6b:	83 ef 01             	sub    $0x1,%edi
+  800c6e:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800c71:	fd                   	std
+  800c72:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800c74:	fc                   	cld
+  800c75:	eb 1a                	jmp    800c91 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c77:	89 f2                	mov    %esi,%edx
+  800c79:	09 c2                	or     %eax,%edx
+  800c7b:	09 ca                	or     %ecx,%edx
+  800c7d:	f6 c2 03             	test   $0x3,%dl
+  800c80:	75 0a                	jne    800c8c <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800c82:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800c85:	89 c7                	mov    %eax,%edi
+  800c87:	fc                   	cld
+  800c88:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c8a:	eb 05                	jmp    800c91 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800c8c:	89 c7                	mov    %eax,%edi
+  800c8e:	fc                   	cld
+  800c8f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800c91:	5e                   	pop    %esi
+  800c92:	5f                   	pop    %edi
+  800c93:	5d                   	pop    %ebp
+  800c94:	c3                   	ret
+
+00800c95 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800c95:	55                   	push   %ebp
+  800c96:	89 e5                	mov    %esp,%ebp
+  800c98:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800c9b:	ff 75 10             	push   0x10(%ebp)
+  800c9e:	ff 75 0c             	push   0xc(%ebp)
+  800ca1:	ff 75 08             	push   0x8(%ebp)
+  800ca4:	e8 8a ff ff ff       	call   800c33 <memmove>
+}
+  800ca9:	c9                   	leave
+  800caa:	c3                   	ret
+
+00800cab <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800cab:	55                   	push   %ebp
+  800cac:	89 e5                	mov    %esp,%ebp
+  800cae:	56                   	push   %esi
+  800caf:	53                   	push   %ebx
+  800cb0:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cb3:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800cb6:	89 c6                	mov    %eax,%esi
+  800cb8:	03 75 10             	add    0x10(%ebp),%esi
+  800cbb:	eb 06                	jmp    800cc3 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800cbd:	83 c0 01             	add    $0x1,%eax
+  800cc0:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800cc3:	39 f0                	cmp    %esi,%eax
+  800cc5:	74 14                	je     800cdb <memcmp+0x30>
+		if (*s1 != *s2)
+  800cc7:	0f b6 08             	movzbl (%eax),%ecx
+  800cca:	0f b6 1a             	movzbl (%edx),%ebx
+  800ccd:	38 d9                	cmp    %bl,%cl
+  800ccf:	74 ec                	je     800cbd <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800cd1:	0f b6 c1             	movzbl %cl,%eax
+  800cd4:	0f b6 db             	movzbl %bl,%ebx
+  800cd7:	29 d8                	sub    %ebx,%eax
+  800cd9:	eb 05                	jmp    800ce0 <memcmp+0x35>
+	}
+
+	return 0;
+  800cdb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ce0:	5b                   	pop    %ebx
+  800ce1:	5e                   	pop    %esi
+  800ce2:	5d                   	pop    %ebp
+  800ce3:	c3                   	ret
+
+00800ce4 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800ce4:	55                   	push   %ebp
+  800ce5:	89 e5                	mov    %esp,%ebp
+  800ce7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800ced:	89 c2                	mov    %eax,%edx
+  800cef:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800cf2:	eb 03                	jmp    800cf7 <memfind+0x13>
+  800cf4:	83 c0 01             	add    $0x1,%eax
+  800cf7:	39 d0                	cmp    %edx,%eax
+  800cf9:	73 04                	jae    800cff <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800cfb:	38 08                	cmp    %cl,(%eax)
+  800cfd:	75 f5                	jne    800cf4 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800cff:	5d                   	pop    %ebp
+  800d00:	c3                   	ret
+
+00800d01 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800d01:	55                   	push   %ebp
+  800d02:	89 e5                	mov    %esp,%ebp
+  800d04:	57                   	push   %edi
+  800d05:	56                   	push   %esi
+  800d06:	53                   	push   %ebx
+  800d07:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d0a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800d0d:	eb 03                	jmp    800d12 <strtol+0x11>
+		s++;
+  800d0f:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800d12:	0f b6 02             	movzbl (%edx),%eax
+  800d15:	3c 20                	cmp    $0x20,%al
+  800d17:	74 f6                	je     800d0f <strtol+0xe>
+  800d19:	3c 09                	cmp    $0x9,%al
+  800d1b:	74 f2                	je     800d0f <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800d1d:	3c 2b                	cmp    $0x2b,%al
+  800d1f:	74 2a                	je     800d4b <strtol+0x4a>
+	int neg = 0;
+  800d21:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800d26:	3c 2d                	cmp    $0x2d,%al
+  800d28:	74 2b                	je     800d55 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d2a:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800d30:	75 0f                	jne    800d41 <strtol+0x40>
+  800d32:	80 3a 30             	cmpb   $0x30,(%edx)
+  800d35:	74 28                	je     800d5f <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800d37:	85 db                	test   %ebx,%ebx
+  800d39:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d3e:	0f 44 d8             	cmove  %eax,%ebx
+  800d41:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d46:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800d49:	eb 46                	jmp    800d91 <strtol+0x90>
+		s++;
+  800d4b:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800d4e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d53:	eb d5                	jmp    800d2a <strtol+0x29>
+		s++, neg = 1;
+  800d55:	83 c2 01             	add    $0x1,%edx
+  800d58:	bf 01 00 00 00       	mov    $0x1,%edi
+  800d5d:	eb cb                	jmp    800d2a <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d5f:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800d63:	74 0e                	je     800d73 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800d65:	85 db                	test   %ebx,%ebx
+  800d67:	75 d8                	jne    800d41 <strtol+0x40>
+		s++, base = 8;
+  800d69:	83 c2 01             	add    $0x1,%edx
+  800d6c:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800d71:	eb ce                	jmp    800d41 <strtol+0x40>
+		s += 2, base = 16;
+  800d73:	83 c2 02             	add    $0x2,%edx
+  800d76:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800d7b:	eb c4                	jmp    800d41 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800d7d:	0f be c0             	movsbl %al,%eax
+  800d80:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800d83:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800d86:	7d 3a                	jge    800dc2 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800d88:	83 c2 01             	add    $0x1,%edx
+  800d8b:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800d8f:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800d91:	0f b6 02             	movzbl (%edx),%eax
+  800d94:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800d97:	89 f3                	mov    %esi,%ebx
+  800d99:	80 fb 09             	cmp    $0x9,%bl
+  800d9c:	76 df                	jbe    800d7d <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800d9e:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800da1:	89 f3                	mov    %esi,%ebx
+  800da3:	80 fb 19             	cmp    $0x19,%bl
+  800da6:	77 08                	ja     800db0 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800da8:	0f be c0             	movsbl %al,%eax
+  800dab:	83 e8 57             	sub    $0x57,%eax
+  800dae:	eb d3                	jmp    800d83 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800db0:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800db3:	89 f3                	mov    %esi,%ebx
+  800db5:	80 fb 19             	cmp    $0x19,%bl
+  800db8:	77 08                	ja     800dc2 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800dba:	0f be c0             	movsbl %al,%eax
+  800dbd:	83 e8 37             	sub    $0x37,%eax
+  800dc0:	eb c1                	jmp    800d83 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800dc2:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800dc6:	74 05                	je     800dcd <strtol+0xcc>
+		*endptr = (char *) s;
+  800dc8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800dcb:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800dcd:	89 c8                	mov    %ecx,%eax
+  800dcf:	f7 d8                	neg    %eax
+  800dd1:	85 ff                	test   %edi,%edi
+  800dd3:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800dd6:	89 c8                	mov    %ecx,%eax
+  800dd8:	5b                   	pop    %ebx
+  800dd9:	5e                   	pop    %esi
+  800dda:	5f                   	pop    %edi
+  800ddb:	5d                   	pop    %ebp
+  800ddc:	c3                   	ret
+
+00800ddd <atoi>:
+
+int
+atoi(const char* s)
+{
+  800ddd:	55                   	push   %ebp
+  800dde:	89 e5                	mov    %esp,%ebp
+  800de0:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  800de3:	6a 00                	push   $0x0
+  800de5:	6a 00                	push   $0x0
+  800de7:	ff 75 08             	push   0x8(%ebp)
+  800dea:	e8 12 ff ff ff       	call   800d01 <strtol>
+}
+  800def:	c9                   	leave
+  800df0:	c3                   	ret
+
+00800df1 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800df1:	55                   	push   %ebp
+  800df2:	89 e5                	mov    %esp,%ebp
+  800df4:	57                   	push   %edi
+  800df5:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800df6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dfb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dfe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e01:	89 c3                	mov    %eax,%ebx
+  800e03:	89 c7                	mov    %eax,%edi
+  800e05:	6a 00                	push   $0x0
+  800e07:	55                   	push   %ebp
+  800e08:	56                   	push   %esi
+  800e09:	89 e5                	mov    %esp,%ebp
+  800e0b:	8d 35 13 0e 80 00    	lea    0x800e13,%esi
+  800e11:	0f 34                	sysenter
+
+00800e13 <after_sysenter_label_47>:
+  800e13:	5e                   	pop    %esi
+  800e14:	5d                   	pop    %ebp
+  800e15:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800e18:	5b                   	pop    %ebx
+  800e19:	5f                   	pop    %edi
+  800e1a:	5d                   	pop    %ebp
+  800e1b:	c3                   	ret
+
+00800e1c <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800e1c:	55                   	push   %ebp
+  800e1d:	89 e5                	mov    %esp,%ebp
+  800e1f:	57                   	push   %edi
+  800e20:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e21:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e26:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e2b:	89 d1                	mov    %edx,%ecx
+  800e2d:	89 d3                	mov    %edx,%ebx
+  800e2f:	89 d7                	mov    %edx,%edi
+  800e31:	6a 00                	push   $0x0
+  800e33:	55                   	push   %ebp
+  800e34:	56                   	push   %esi
+  800e35:	89 e5                	mov    %esp,%ebp
+  800e37:	8d 35 3f 0e 80 00    	lea    0x800e3f,%esi
+  800e3d:	0f 34                	sysenter
+
+00800e3f <after_sysenter_label_128>:
+  800e3f:	5e                   	pop    %esi
+  800e40:	5d                   	pop    %ebp
+  800e41:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800e44:	5b                   	pop    %ebx
+  800e45:	5f                   	pop    %edi
+  800e46:	5d                   	pop    %ebp
+  800e47:	c3                   	ret
+
+00800e48 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800e48:	55                   	push   %ebp
+  800e49:	89 e5                	mov    %esp,%ebp
+  800e4b:	57                   	push   %edi
+  800e4c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e4d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e50:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e55:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e5a:	89 cb                	mov    %ecx,%ebx
+  800e5c:	89 cf                	mov    %ecx,%edi
+  800e5e:	6a 00                	push   $0x0
+  800e60:	55                   	push   %ebp
+  800e61:	56                   	push   %esi
+  800e62:	89 e5                	mov    %esp,%ebp
+  800e64:	8d 35 6c 0e 80 00    	lea    0x800e6c,%esi
+  800e6a:	0f 34                	sysenter
+
+00800e6c <after_sysenter_label_212>:
+  800e6c:	5e                   	pop    %esi
+  800e6d:	5d                   	pop    %ebp
+  800e6e:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e71:	85 c0                	test   %eax,%eax
+  800e73:	7f 07                	jg     800e7c <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800e75:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e78:	5b                   	pop    %ebx
+  800e79:	5f                   	pop    %edi
+  800e7a:	5d                   	pop    %ebp
+  800e7b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e7c:	83 ec 0c             	sub    $0xc,%esp
+  800e7f:	50                   	push   %eax
+  800e80:	6a 03                	push   $0x3
+  800e82:	68 a5 4d 80 00       	push   $0x804da5
+  800e87:	6a 54                	push   $0x54
+  800e89:	68 c2 4d 80 00       	push   $0x804dc2
+  800e8e:	e8 6b f4 ff ff       	call   8002fe <_panic>
+
+00800e93 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800e93:	55                   	push   %ebp
+  800e94:	89 e5                	mov    %esp,%ebp
+  800e96:	57                   	push   %edi
+  800e97:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e98:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e9d:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ea2:	89 d1                	mov    %edx,%ecx
+  800ea4:	89 d3                	mov    %edx,%ebx
+  800ea6:	89 d7                	mov    %edx,%edi
+  800ea8:	6a 00                	push   $0x0
+  800eaa:	55                   	push   %ebp
+  800eab:	56                   	push   %esi
+  800eac:	89 e5                	mov    %esp,%ebp
+  800eae:	8d 35 b6 0e 80 00    	lea    0x800eb6,%esi
+  800eb4:	0f 34                	sysenter
+
+00800eb6 <after_sysenter_label_309>:
+  800eb6:	5e                   	pop    %esi
+  800eb7:	5d                   	pop    %ebp
+  800eb8:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800ebb:	5b                   	pop    %ebx
+  800ebc:	5f                   	pop    %edi
+  800ebd:	5d                   	pop    %ebp
+  800ebe:	c3                   	ret
+
+00800ebf <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800ebf:	55                   	push   %ebp
+  800ec0:	89 e5                	mov    %esp,%ebp
+  800ec2:	57                   	push   %edi
+  800ec3:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ec4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ec9:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800ece:	89 d1                	mov    %edx,%ecx
+  800ed0:	89 d3                	mov    %edx,%ebx
+  800ed2:	89 d7                	mov    %edx,%edi
+  800ed4:	6a 00                	push   $0x0
+  800ed6:	55                   	push   %ebp
+  800ed7:	56                   	push   %esi
+  800ed8:	89 e5                	mov    %esp,%ebp
+  800eda:	8d 35 e2 0e 80 00    	lea    0x800ee2,%esi
+  800ee0:	0f 34                	sysenter
+
+00800ee2 <after_sysenter_label_391>:
+  800ee2:	5e                   	pop    %esi
+  800ee3:	5d                   	pop    %ebp
+  800ee4:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800ee7:	5b                   	pop    %ebx
+  800ee8:	5f                   	pop    %edi
+  800ee9:	5d                   	pop    %ebp
+  800eea:	c3                   	ret
+
+00800eeb <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800eeb:	55                   	push   %ebp
+  800eec:	89 e5                	mov    %esp,%ebp
+  800eee:	57                   	push   %edi
+  800eef:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ef0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef6:	b8 04 00 00 00       	mov    $0x4,%eax
+  800efb:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f00:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f03:	6a 00                	push   $0x0
+  800f05:	55                   	push   %ebp
+  800f06:	56                   	push   %esi
+  800f07:	89 e5                	mov    %esp,%ebp
+  800f09:	8d 35 11 0f 80 00    	lea    0x800f11,%esi
+  800f0f:	0f 34                	sysenter
+
+00800f11 <after_sysenter_label_479>:
+  800f11:	5e                   	pop    %esi
+  800f12:	5d                   	pop    %ebp
+  800f13:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800f16:	85 c0                	test   %eax,%eax
+  800f18:	7f 07                	jg     800f21 <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800f1a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f1d:	5b                   	pop    %ebx
+  800f1e:	5f                   	pop    %edi
+  800f1f:	5d                   	pop    %ebp
+  800f20:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f21:	83 ec 0c             	sub    $0xc,%esp
+  800f24:	50                   	push   %eax
+  800f25:	6a 04                	push   $0x4
+  800f27:	68 a5 4d 80 00       	push   $0x804da5
+  800f2c:	6a 54                	push   $0x54
+  800f2e:	68 c2 4d 80 00       	push   $0x804dc2
+  800f33:	e8 c6 f3 ff ff       	call   8002fe <_panic>
+
+00800f38 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800f38:	55                   	push   %ebp
+  800f39:	89 e5                	mov    %esp,%ebp
+  800f3b:	57                   	push   %edi
+  800f3c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f3d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f40:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f43:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f48:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f4b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f4e:	ff 75 18             	push   0x18(%ebp)
+  800f51:	55                   	push   %ebp
+  800f52:	56                   	push   %esi
+  800f53:	89 e5                	mov    %esp,%ebp
+  800f55:	8d 35 5d 0f 80 00    	lea    0x800f5d,%esi
+  800f5b:	0f 34                	sysenter
+
+00800f5d <after_sysenter_label_593>:
+  800f5d:	5e                   	pop    %esi
+  800f5e:	5d                   	pop    %ebp
+  800f5f:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800f62:	85 c0                	test   %eax,%eax
+  800f64:	7f 07                	jg     800f6d <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800f66:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f69:	5b                   	pop    %ebx
+  800f6a:	5f                   	pop    %edi
+  800f6b:	5d                   	pop    %ebp
+  800f6c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f6d:	83 ec 0c             	sub    $0xc,%esp
+  800f70:	50                   	push   %eax
+  800f71:	6a 05                	push   $0x5
+  800f73:	68 a5 4d 80 00       	push   $0x804da5
+  800f78:	6a 54                	push   $0x54
+  800f7a:	68 c2 4d 80 00       	push   $0x804dc2
+  800f7f:	e8 7a f3 ff ff       	call   8002fe <_panic>
+
+00800f84 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800f84:	55                   	push   %ebp
+  800f85:	89 e5                	mov    %esp,%ebp
+  800f87:	57                   	push   %edi
+  800f88:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f89:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f8e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f91:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f94:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f99:	89 df                	mov    %ebx,%edi
+  800f9b:	6a 00                	push   $0x0
+  800f9d:	55                   	push   %ebp
+  800f9e:	56                   	push   %esi
+  800f9f:	89 e5                	mov    %esp,%ebp
+  800fa1:	8d 35 a9 0f 80 00    	lea    0x800fa9,%esi
+  800fa7:	0f 34                	sysenter
+
+00800fa9 <after_sysenter_label_704>:
+  800fa9:	5e                   	pop    %esi
+  800faa:	5d                   	pop    %ebp
+  800fab:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800fae:	85 c0                	test   %eax,%eax
+  800fb0:	7f 07                	jg     800fb9 <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800fb2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fb5:	5b                   	pop    %ebx
+  800fb6:	5f                   	pop    %edi
+  800fb7:	5d                   	pop    %ebp
+  800fb8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fb9:	83 ec 0c             	sub    $0xc,%esp
+  800fbc:	50                   	push   %eax
+  800fbd:	6a 06                	push   $0x6
+  800fbf:	68 a5 4d 80 00       	push   $0x804da5
+  800fc4:	6a 54                	push   $0x54
+  800fc6:	68 c2 4d 80 00       	push   $0x804dc2
+  800fcb:	e8 2e f3 ff ff       	call   8002fe <_panic>
+
+00800fd0 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800fd0:	55                   	push   %ebp
+  800fd1:	89 e5                	mov    %esp,%ebp
+  800fd3:	57                   	push   %edi
+  800fd4:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fd5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fda:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fdd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe0:	b8 08 00 00 00       	mov    $0x8,%eax
+  800fe5:	89 df                	mov    %ebx,%edi
+  800fe7:	6a 00                	push   $0x0
+  800fe9:	55                   	push   %ebp
+  800fea:	56                   	push   %esi
+  800feb:	89 e5                	mov    %esp,%ebp
+  800fed:	8d 35 f5 0f 80 00    	lea    0x800ff5,%esi
+  800ff3:	0f 34                	sysenter
+
+00800ff5 <after_sysenter_label_808>:
+  800ff5:	5e                   	pop    %esi
+  800ff6:	5d                   	pop    %ebp
+  800ff7:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800ffa:	85 c0                	test   %eax,%eax
+  800ffc:	7f 07                	jg     801005 <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800ffe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801001:	5b                   	pop    %ebx
+  801002:	5f                   	pop    %edi
+  801003:	5d                   	pop    %ebp
+  801004:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801005:	83 ec 0c             	sub    $0xc,%esp
+  801008:	50                   	push   %eax
+  801009:	6a 08                	push   $0x8
+  80100b:	68 a5 4d 80 00       	push   $0x804da5
+  801010:	6a 54                	push   $0x54
+  801012:	68 c2 4d 80 00       	push   $0x804dc2
+  801017:	e8 e2 f2 ff ff       	call   8002fe <_panic>
+
+0080101c <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80101c:	55                   	push   %ebp
+  80101d:	89 e5                	mov    %esp,%ebp
+  80101f:	57                   	push   %edi
+  801020:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801021:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801026:	8b 55 08             	mov    0x8(%ebp),%edx
+  801029:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80102c:	b8 09 00 00 00       	mov    $0x9,%eax
+  801031:	89 df                	mov    %ebx,%edi
+  801033:	6a 00                	push   $0x0
+  801035:	55                   	push   %ebp
+  801036:	56                   	push   %esi
+  801037:	89 e5                	mov    %esp,%ebp
+  801039:	8d 35 41 10 80 00    	lea    0x801041,%esi
+  80103f:	0f 34                	sysenter
+
+00801041 <after_sysenter_label_912>:
+  801041:	5e                   	pop    %esi
+  801042:	5d                   	pop    %ebp
+  801043:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801046:	85 c0                	test   %eax,%eax
+  801048:	7f 07                	jg     801051 <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  80104a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80104d:	5b                   	pop    %ebx
+  80104e:	5f                   	pop    %edi
+  80104f:	5d                   	pop    %ebp
+  801050:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801051:	83 ec 0c             	sub    $0xc,%esp
+  801054:	50                   	push   %eax
+  801055:	6a 09                	push   $0x9
+  801057:	68 a5 4d 80 00       	push   $0x804da5
+  80105c:	6a 54                	push   $0x54
+  80105e:	68 c2 4d 80 00       	push   $0x804dc2
+  801063:	e8 96 f2 ff ff       	call   8002fe <_panic>
+
+00801068 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801068:	55                   	push   %ebp
+  801069:	89 e5                	mov    %esp,%ebp
+  80106b:	57                   	push   %edi
+  80106c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80106d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801072:	8b 55 08             	mov    0x8(%ebp),%edx
+  801075:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801078:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80107d:	89 df                	mov    %ebx,%edi
+  80107f:	6a 00                	push   $0x0
+  801081:	55                   	push   %ebp
+  801082:	56                   	push   %esi
+  801083:	89 e5                	mov    %esp,%ebp
+  801085:	8d 35 8d 10 80 00    	lea    0x80108d,%esi
+  80108b:	0f 34                	sysenter
+
+0080108d <after_sysenter_label_1016>:
+  80108d:	5e                   	pop    %esi
+  80108e:	5d                   	pop    %ebp
+  80108f:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801092:	85 c0                	test   %eax,%eax
+  801094:	7f 07                	jg     80109d <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801096:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801099:	5b                   	pop    %ebx
+  80109a:	5f                   	pop    %edi
+  80109b:	5d                   	pop    %ebp
+  80109c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80109d:	83 ec 0c             	sub    $0xc,%esp
+  8010a0:	50                   	push   %eax
+  8010a1:	6a 0a                	push   $0xa
+  8010a3:	68 a5 4d 80 00       	push   $0x804da5
+  8010a8:	6a 54                	push   $0x54
+  8010aa:	68 c2 4d 80 00       	push   $0x804dc2
+  8010af:	e8 4a f2 ff ff       	call   8002fe <_panic>
+
+008010b4 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8010b4:	55                   	push   %ebp
+  8010b5:	89 e5                	mov    %esp,%ebp
+  8010b7:	57                   	push   %edi
+  8010b8:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010b9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010bc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010bf:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010c4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010c7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010ca:	6a 00                	push   $0x0
+  8010cc:	55                   	push   %ebp
+  8010cd:	56                   	push   %esi
+  8010ce:	89 e5                	mov    %esp,%ebp
+  8010d0:	8d 35 d8 10 80 00    	lea    0x8010d8,%esi
+  8010d6:	0f 34                	sysenter
+
+008010d8 <after_sysenter_label_1126>:
+  8010d8:	5e                   	pop    %esi
+  8010d9:	5d                   	pop    %ebp
+  8010da:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8010dd:	5b                   	pop    %ebx
+  8010de:	5f                   	pop    %edi
+  8010df:	5d                   	pop    %ebp
+  8010e0:	c3                   	ret
+
+008010e1 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8010e1:	55                   	push   %ebp
+  8010e2:	89 e5                	mov    %esp,%ebp
+  8010e4:	57                   	push   %edi
+  8010e5:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010ee:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8010f3:	89 cb                	mov    %ecx,%ebx
+  8010f5:	89 cf                	mov    %ecx,%edi
+  8010f7:	6a 00                	push   $0x0
+  8010f9:	55                   	push   %ebp
+  8010fa:	56                   	push   %esi
+  8010fb:	89 e5                	mov    %esp,%ebp
+  8010fd:	8d 35 05 11 80 00    	lea    0x801105,%esi
+  801103:	0f 34                	sysenter
+
+00801105 <after_sysenter_label_1210>:
+  801105:	5e                   	pop    %esi
+  801106:	5d                   	pop    %ebp
+  801107:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80110a:	85 c0                	test   %eax,%eax
+  80110c:	7f 07                	jg     801115 <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  80110e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801111:	5b                   	pop    %ebx
+  801112:	5f                   	pop    %edi
+  801113:	5d                   	pop    %ebp
+  801114:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801115:	83 ec 0c             	sub    $0xc,%esp
+  801118:	50                   	push   %eax
+  801119:	6a 0d                	push   $0xd
+  80111b:	68 a5 4d 80 00       	push   $0x804da5
+  801120:	6a 54                	push   $0x54
+  801122:	68 c2 4d 80 00       	push   $0x804dc2
+  801127:	e8 d2 f1 ff ff       	call   8002fe <_panic>
+
+0080112c <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  80112c:	55                   	push   %ebp
+  80112d:	89 e5                	mov    %esp,%ebp
+  80112f:	57                   	push   %edi
+  801130:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801131:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801136:	8b 55 08             	mov    0x8(%ebp),%edx
+  801139:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80113c:	b8 42 00 00 00       	mov    $0x42,%eax
+  801141:	89 df                	mov    %ebx,%edi
+  801143:	6a 00                	push   $0x0
+  801145:	55                   	push   %ebp
+  801146:	56                   	push   %esi
+  801147:	89 e5                	mov    %esp,%ebp
+  801149:	8d 35 51 11 80 00    	lea    0x801151,%esi
+  80114f:	0f 34                	sysenter
+
+00801151 <after_sysenter_label_1311>:
+  801151:	5e                   	pop    %esi
+  801152:	5d                   	pop    %ebp
+  801153:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801156:	85 c0                	test   %eax,%eax
+  801158:	7f 07                	jg     801161 <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  80115a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80115d:	5b                   	pop    %ebx
+  80115e:	5f                   	pop    %edi
+  80115f:	5d                   	pop    %ebp
+  801160:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801161:	83 ec 0c             	sub    $0xc,%esp
+  801164:	50                   	push   %eax
+  801165:	6a 42                	push   $0x42
+  801167:	68 a5 4d 80 00       	push   $0x804da5
+  80116c:	6a 54                	push   $0x54
+  80116e:	68 c2 4d 80 00       	push   $0x804dc2
+  801173:	e8 86 f1 ff ff       	call   8002fe <_panic>
+
+00801178 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801178:	55                   	push   %ebp
+  801179:	89 e5                	mov    %esp,%ebp
+  80117b:	57                   	push   %edi
+  80117c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80117d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801182:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801187:	89 d1                	mov    %edx,%ecx
+  801189:	89 d3                	mov    %edx,%ebx
+  80118b:	89 d7                	mov    %edx,%edi
+  80118d:	6a 00                	push   $0x0
+  80118f:	55                   	push   %ebp
+  801190:	56                   	push   %esi
+  801191:	89 e5                	mov    %esp,%ebp
+  801193:	8d 35 9b 11 80 00    	lea    0x80119b,%esi
+  801199:	0f 34                	sysenter
+
+0080119b <after_sysenter_label_1411>:
+  80119b:	5e                   	pop    %esi
+  80119c:	5d                   	pop    %ebp
+  80119d:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8011a0:	5b                   	pop    %ebx
+  8011a1:	5f                   	pop    %edi
+  8011a2:	5d                   	pop    %ebp
+  8011a3:	c3                   	ret
+
+008011a4 <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  8011a4:	55                   	push   %ebp
+  8011a5:	89 e5                	mov    %esp,%ebp
+  8011a7:	57                   	push   %edi
+  8011a8:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8011a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011b4:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8011b9:	89 df                	mov    %ebx,%edi
+  8011bb:	6a 00                	push   $0x0
+  8011bd:	55                   	push   %ebp
+  8011be:	56                   	push   %esi
+  8011bf:	89 e5                	mov    %esp,%ebp
+  8011c1:	8d 35 c9 11 80 00    	lea    0x8011c9,%esi
+  8011c7:	0f 34                	sysenter
+
+008011c9 <after_sysenter_label_1497>:
+  8011c9:	5e                   	pop    %esi
+  8011ca:	5d                   	pop    %ebp
+  8011cb:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  8011ce:	5b                   	pop    %ebx
+  8011cf:	5f                   	pop    %edi
+  8011d0:	5d                   	pop    %ebp
+  8011d1:	c3                   	ret
+
+008011d2 <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  8011d2:	55                   	push   %ebp
+  8011d3:	89 e5                	mov    %esp,%ebp
+  8011d5:	57                   	push   %edi
+  8011d6:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8011d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011df:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011e2:	b8 10 00 00 00       	mov    $0x10,%eax
+  8011e7:	89 df                	mov    %ebx,%edi
+  8011e9:	6a 00                	push   $0x0
+  8011eb:	55                   	push   %ebp
+  8011ec:	56                   	push   %esi
+  8011ed:	89 e5                	mov    %esp,%ebp
+  8011ef:	8d 35 f7 11 80 00    	lea    0x8011f7,%esi
+  8011f5:	0f 34                	sysenter
+
+008011f7 <after_sysenter_label_1583>:
+  8011f7:	5e                   	pop    %esi
+  8011f8:	5d                   	pop    %ebp
+  8011f9:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  8011fc:	5b                   	pop    %ebx
+  8011fd:	5f                   	pop    %edi
+  8011fe:	5d                   	pop    %ebp
+  8011ff:	c3                   	ret
+
+00801200 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  801200:	55                   	push   %ebp
+  801201:	89 e5                	mov    %esp,%ebp
+  801203:	57                   	push   %edi
+  801204:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801205:	8b 55 08             	mov    0x8(%ebp),%edx
+  801208:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80120b:	b8 11 00 00 00       	mov    $0x11,%eax
+  801210:	bf 00 00 00 00       	mov    $0x0,%edi
+  801215:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801218:	6a 00                	push   $0x0
+  80121a:	55                   	push   %ebp
+  80121b:	56                   	push   %esi
+  80121c:	89 e5                	mov    %esp,%ebp
+  80121e:	8d 35 26 12 80 00    	lea    0x801226,%esi
+  801224:	0f 34                	sysenter
+
+00801226 <after_sysenter_label_1672>:
+  801226:	5e                   	pop    %esi
+  801227:	5d                   	pop    %ebp
+  801228:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  80122b:	5b                   	pop    %ebx
+  80122c:	5f                   	pop    %edi
+  80122d:	5d                   	pop    %ebp
+  80122e:	c3                   	ret
+
+0080122f <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  80122f:	55                   	push   %ebp
+  801230:	89 e5                	mov    %esp,%ebp
+  801232:	57                   	push   %edi
+  801233:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801234:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801239:	8b 55 08             	mov    0x8(%ebp),%edx
+  80123c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80123f:	b8 12 00 00 00       	mov    $0x12,%eax
+  801244:	89 df                	mov    %ebx,%edi
+  801246:	6a 00                	push   $0x0
+  801248:	55                   	push   %ebp
+  801249:	56                   	push   %esi
+  80124a:	89 e5                	mov    %esp,%ebp
+  80124c:	8d 35 54 12 80 00    	lea    0x801254,%esi
+  801252:	0f 34                	sysenter
+
+00801254 <after_sysenter_label_1758>:
+  801254:	5e                   	pop    %esi
+  801255:	5d                   	pop    %ebp
+  801256:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  801259:	5b                   	pop    %ebx
+  80125a:	5f                   	pop    %edi
+  80125b:	5d                   	pop    %ebp
+  80125c:	c3                   	ret
+
+0080125d <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  80125d:	55                   	push   %ebp
+  80125e:	89 e5                	mov    %esp,%ebp
+  801260:	57                   	push   %edi
+  801261:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801262:	8b 55 08             	mov    0x8(%ebp),%edx
+  801265:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80126a:	b8 13 00 00 00       	mov    $0x13,%eax
+  80126f:	89 cb                	mov    %ecx,%ebx
+  801271:	89 cf                	mov    %ecx,%edi
+  801273:	6a 00                	push   $0x0
+  801275:	55                   	push   %ebp
+  801276:	56                   	push   %esi
+  801277:	89 e5                	mov    %esp,%ebp
+  801279:	8d 35 81 12 80 00    	lea    0x801281,%esi
+  80127f:	0f 34                	sysenter
+
+00801281 <after_sysenter_label_1842>:
+  801281:	5e                   	pop    %esi
+  801282:	5d                   	pop    %ebp
+  801283:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801286:	85 c0                	test   %eax,%eax
+  801288:	7f 07                	jg     801291 <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  80128a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80128d:	5b                   	pop    %ebx
+  80128e:	5f                   	pop    %edi
+  80128f:	5d                   	pop    %ebp
+  801290:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801291:	83 ec 0c             	sub    $0xc,%esp
+  801294:	50                   	push   %eax
+  801295:	6a 13                	push   $0x13
+  801297:	68 a5 4d 80 00       	push   $0x804da5
+  80129c:	6a 54                	push   $0x54
+  80129e:	68 c2 4d 80 00       	push   $0x804dc2
+  8012a3:	e8 56 f0 ff ff       	call   8002fe <_panic>
+
+008012a8 <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  8012a8:	55                   	push   %ebp
+  8012a9:	89 e5                	mov    %esp,%ebp
+  8012ab:	57                   	push   %edi
+  8012ac:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8012ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012b2:	b8 14 00 00 00       	mov    $0x14,%eax
+  8012b7:	89 d1                	mov    %edx,%ecx
+  8012b9:	89 d3                	mov    %edx,%ebx
+  8012bb:	89 d7                	mov    %edx,%edi
+  8012bd:	6a 00                	push   $0x0
+  8012bf:	55                   	push   %ebp
+  8012c0:	56                   	push   %esi
+  8012c1:	89 e5                	mov    %esp,%ebp
+  8012c3:	8d 35 cb 12 80 00    	lea    0x8012cb,%esi
+  8012c9:	0f 34                	sysenter
+
+008012cb <after_sysenter_label_1939>:
+  8012cb:	5e                   	pop    %esi
+  8012cc:	5d                   	pop    %ebp
+  8012cd:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  8012d0:	5b                   	pop    %ebx
+  8012d1:	5f                   	pop    %edi
+  8012d2:	5d                   	pop    %ebp
+  8012d3:	c3                   	ret
+
+008012d4 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  8012d4:	55                   	push   %ebp
+  8012d5:	89 e5                	mov    %esp,%ebp
+  8012d7:	57                   	push   %edi
+  8012d8:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8012d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012dc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012df:	b8 15 00 00 00       	mov    $0x15,%eax
+  8012e4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012e9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012ec:	6a 00                	push   $0x0
+  8012ee:	55                   	push   %ebp
+  8012ef:	56                   	push   %esi
+  8012f0:	89 e5                	mov    %esp,%ebp
+  8012f2:	8d 35 fa 12 80 00    	lea    0x8012fa,%esi
+  8012f8:	0f 34                	sysenter
+
+008012fa <after_sysenter_label_2028>:
+  8012fa:	5e                   	pop    %esi
+  8012fb:	5d                   	pop    %ebp
+  8012fc:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  8012ff:	5b                   	pop    %ebx
+  801300:	5f                   	pop    %edi
+  801301:	5d                   	pop    %ebp
+  801302:	c3                   	ret
+
+00801303 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  801303:	55                   	push   %ebp
+  801304:	89 e5                	mov    %esp,%ebp
+  801306:	57                   	push   %edi
+  801307:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801308:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80130d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801310:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801313:	b8 16 00 00 00       	mov    $0x16,%eax
+  801318:	89 df                	mov    %ebx,%edi
+  80131a:	6a 00                	push   $0x0
+  80131c:	55                   	push   %ebp
+  80131d:	56                   	push   %esi
+  80131e:	89 e5                	mov    %esp,%ebp
+  801320:	8d 35 28 13 80 00    	lea    0x801328,%esi
+  801326:	0f 34                	sysenter
+
+00801328 <after_sysenter_label_2114>:
+  801328:	5e                   	pop    %esi
+  801329:	5d                   	pop    %ebp
+  80132a:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  80132d:	5b                   	pop    %ebx
+  80132e:	5f                   	pop    %edi
+  80132f:	5d                   	pop    %ebp
+  801330:	c3                   	ret
+
+00801331 <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  801331:	55                   	push   %ebp
+  801332:	89 e5                	mov    %esp,%ebp
+  801334:	57                   	push   %edi
+  801335:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801336:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80133b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80133e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801341:	b8 17 00 00 00       	mov    $0x17,%eax
+  801346:	89 df                	mov    %ebx,%edi
+  801348:	6a 00                	push   $0x0
+  80134a:	55                   	push   %ebp
+  80134b:	56                   	push   %esi
+  80134c:	89 e5                	mov    %esp,%ebp
+  80134e:	8d 35 56 13 80 00    	lea    0x801356,%esi
+  801354:	0f 34                	sysenter
+
+00801356 <after_sysenter_label_2200>:
+  801356:	5e                   	pop    %esi
+  801357:	5d                   	pop    %ebp
+  801358:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  80135b:	5b                   	pop    %ebx
+  80135c:	5f                   	pop    %edi
+  80135d:	5d                   	pop    %ebp
+  80135e:	c3                   	ret
+
+0080135f <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  80135f:	55                   	push   %ebp
+  801360:	89 e5                	mov    %esp,%ebp
+  801362:	57                   	push   %edi
+  801363:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801364:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801369:	8b 55 08             	mov    0x8(%ebp),%edx
+  80136c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80136f:	b8 18 00 00 00       	mov    $0x18,%eax
+  801374:	89 df                	mov    %ebx,%edi
+  801376:	6a 00                	push   $0x0
+  801378:	55                   	push   %ebp
+  801379:	56                   	push   %esi
+  80137a:	89 e5                	mov    %esp,%ebp
+  80137c:	8d 35 84 13 80 00    	lea    0x801384,%esi
+  801382:	0f 34                	sysenter
+
+00801384 <after_sysenter_label_2286>:
+  801384:	5e                   	pop    %esi
+  801385:	5d                   	pop    %ebp
+  801386:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  801389:	5b                   	pop    %ebx
+  80138a:	5f                   	pop    %edi
+  80138b:	5d                   	pop    %ebp
+  80138c:	c3                   	ret
+
+0080138d <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80138d:	55                   	push   %ebp
+  80138e:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801390:	8b 45 08             	mov    0x8(%ebp),%eax
+  801393:	05 00 00 00 30       	add    $0x30000000,%eax
+  801398:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80139b:	5d                   	pop    %ebp
+  80139c:	c3                   	ret
+
+0080139d <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80139d:	55                   	push   %ebp
+  80139e:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8013a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013a3:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8013a8:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8013ad:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8013b2:	5d                   	pop    %ebp
+  8013b3:	c3                   	ret
+
+008013b4 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8013b4:	55                   	push   %ebp
+  8013b5:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8013b7:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8013bc:	eb 02                	jmp    8013c0 <fd_alloc+0xc>
+  8013be:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8013c0:	89 c2                	mov    %eax,%edx
+  8013c2:	c1 ea 16             	shr    $0x16,%edx
+  8013c5:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8013cc:	f6 c2 01             	test   $0x1,%dl
+  8013cf:	74 2b                	je     8013fc <fd_alloc+0x48>
+  8013d1:	89 c2                	mov    %eax,%edx
+  8013d3:	c1 ea 0c             	shr    $0xc,%edx
+  8013d6:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8013dd:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8013e3:	f6 c1 01             	test   $0x1,%cl
+  8013e6:	74 14                	je     8013fc <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8013e8:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8013ee:	75 ce                	jne    8013be <fd_alloc+0xa>
+  8013f0:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8013f5:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8013fa:	eb 05                	jmp    801401 <fd_alloc+0x4d>
+			return 0;
+  8013fc:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801401:	8b 55 08             	mov    0x8(%ebp),%edx
+  801404:	89 02                	mov    %eax,(%edx)
+}
+  801406:	89 c8                	mov    %ecx,%eax
+  801408:	5d                   	pop    %ebp
+  801409:	c3                   	ret
+
+0080140a <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80140a:	55                   	push   %ebp
+  80140b:	89 e5                	mov    %esp,%ebp
+  80140d:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801410:	83 f8 1f             	cmp    $0x1f,%eax
+  801413:	77 30                	ja     801445 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801415:	c1 e0 0c             	shl    $0xc,%eax
+  801418:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80141d:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801423:	f6 c2 01             	test   $0x1,%dl
+  801426:	74 24                	je     80144c <fd_lookup+0x42>
+  801428:	89 c2                	mov    %eax,%edx
+  80142a:	c1 ea 0c             	shr    $0xc,%edx
+  80142d:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801434:	f6 c2 01             	test   $0x1,%dl
+  801437:	74 1a                	je     801453 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801439:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80143c:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80143e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801443:	5d                   	pop    %ebp
+  801444:	c3                   	ret
+		return -E_INVAL;
+  801445:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80144a:	eb f7                	jmp    801443 <fd_lookup+0x39>
+		return -E_INVAL;
+  80144c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801451:	eb f0                	jmp    801443 <fd_lookup+0x39>
+  801453:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801458:	eb e9                	jmp    801443 <fd_lookup+0x39>
+
+0080145a <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80145a:	55                   	push   %ebp
+  80145b:	89 e5                	mov    %esp,%ebp
+  80145d:	53                   	push   %ebx
+  80145e:	83 ec 04             	sub    $0x4,%esp
+  801461:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801464:	b8 00 00 00 00       	mov    $0x0,%eax
+  801469:	eb 03                	jmp    80146e <dev_lookup+0x14>
+  80146b:	83 c0 01             	add    $0x1,%eax
+  80146e:	8b 1c 85 4c 4e 80 00 	mov    0x804e4c(,%eax,4),%ebx
+  801475:	85 db                	test   %ebx,%ebx
+  801477:	74 0b                	je     801484 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801479:	39 13                	cmp    %edx,(%ebx)
+  80147b:	75 ee                	jne    80146b <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80147d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801482:	eb 49                	jmp    8014cd <dev_lookup+0x73>
+  801484:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801486:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  80148c:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801491:	77 18                	ja     8014ab <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801493:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801498:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  80149a:	c1 e8 10             	shr    $0x10,%eax
+  80149d:	74 0c                	je     8014ab <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80149f:	c1 e0 10             	shl    $0x10,%eax
+  8014a2:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8014a7:	29 c1                	sub    %eax,%ecx
+  8014a9:	eb 06                	jmp    8014b1 <dev_lookup+0x57>
+		return pthread_main_tls;
+  8014ab:	8b 0d c0 76 80 00    	mov    0x8076c0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8014b1:	8b 01                	mov    (%ecx),%eax
+  8014b3:	8b 40 48             	mov    0x48(%eax),%eax
+  8014b6:	83 ec 04             	sub    $0x4,%esp
+  8014b9:	52                   	push   %edx
+  8014ba:	50                   	push   %eax
+  8014bb:	68 d0 4d 80 00       	push   $0x804dd0
+  8014c0:	e8 14 ef ff ff       	call   8003d9 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8014c5:	83 c4 10             	add    $0x10,%esp
+  8014c8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8014cd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8014d0:	89 1a                	mov    %ebx,(%edx)
+}
+  8014d2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014d5:	c9                   	leave
+  8014d6:	c3                   	ret
+
+008014d7 <fd_close>:
+{
+  8014d7:	55                   	push   %ebp
+  8014d8:	89 e5                	mov    %esp,%ebp
+  8014da:	57                   	push   %edi
+  8014db:	56                   	push   %esi
+  8014dc:	53                   	push   %ebx
+  8014dd:	83 ec 24             	sub    $0x24,%esp
+  8014e0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8014e3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8014e6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8014e9:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8014ea:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8014f0:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8014f3:	50                   	push   %eax
+  8014f4:	e8 11 ff ff ff       	call   80140a <fd_lookup>
+  8014f9:	89 c3                	mov    %eax,%ebx
+  8014fb:	83 c4 10             	add    $0x10,%esp
+  8014fe:	85 c0                	test   %eax,%eax
+  801500:	78 05                	js     801507 <fd_close+0x30>
+	    || fd != fd2)
+  801502:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801505:	74 16                	je     80151d <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801507:	89 f8                	mov    %edi,%eax
+  801509:	84 c0                	test   %al,%al
+  80150b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801510:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801513:	89 d8                	mov    %ebx,%eax
+  801515:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801518:	5b                   	pop    %ebx
+  801519:	5e                   	pop    %esi
+  80151a:	5f                   	pop    %edi
+  80151b:	5d                   	pop    %ebp
+  80151c:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80151d:	83 ec 08             	sub    $0x8,%esp
+  801520:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801523:	50                   	push   %eax
+  801524:	ff 36                	push   (%esi)
+  801526:	e8 2f ff ff ff       	call   80145a <dev_lookup>
+  80152b:	89 c3                	mov    %eax,%ebx
+  80152d:	83 c4 10             	add    $0x10,%esp
+  801530:	85 c0                	test   %eax,%eax
+  801532:	78 1a                	js     80154e <fd_close+0x77>
+		if (dev->dev_close)
+  801534:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801537:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80153a:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80153f:	85 c0                	test   %eax,%eax
+  801541:	74 0b                	je     80154e <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801543:	83 ec 0c             	sub    $0xc,%esp
+  801546:	56                   	push   %esi
+  801547:	ff d0                	call   *%eax
+  801549:	89 c3                	mov    %eax,%ebx
+  80154b:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80154e:	83 ec 08             	sub    $0x8,%esp
+  801551:	56                   	push   %esi
+  801552:	6a 00                	push   $0x0
+  801554:	e8 2b fa ff ff       	call   800f84 <sys_page_unmap>
+	return r;
+  801559:	83 c4 10             	add    $0x10,%esp
+  80155c:	eb b5                	jmp    801513 <fd_close+0x3c>
+
+0080155e <close>:
+
+int
+close(int fdnum)
+{
+  80155e:	55                   	push   %ebp
+  80155f:	89 e5                	mov    %esp,%ebp
+  801561:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801564:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801567:	50                   	push   %eax
+  801568:	ff 75 08             	push   0x8(%ebp)
+  80156b:	e8 9a fe ff ff       	call   80140a <fd_lookup>
+  801570:	83 c4 10             	add    $0x10,%esp
+  801573:	85 c0                	test   %eax,%eax
+  801575:	79 02                	jns    801579 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801577:	c9                   	leave
+  801578:	c3                   	ret
+		return fd_close(fd, 1);
+  801579:	83 ec 08             	sub    $0x8,%esp
+  80157c:	6a 01                	push   $0x1
+  80157e:	ff 75 f4             	push   -0xc(%ebp)
+  801581:	e8 51 ff ff ff       	call   8014d7 <fd_close>
+  801586:	83 c4 10             	add    $0x10,%esp
+  801589:	eb ec                	jmp    801577 <close+0x19>
+
+0080158b <close_all>:
+
+void
+close_all(void)
+{
+  80158b:	55                   	push   %ebp
+  80158c:	89 e5                	mov    %esp,%ebp
+  80158e:	53                   	push   %ebx
+  80158f:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801592:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801597:	83 ec 0c             	sub    $0xc,%esp
+  80159a:	53                   	push   %ebx
+  80159b:	e8 be ff ff ff       	call   80155e <close>
+	for (i = 0; i < MAXFD; i++)
+  8015a0:	83 c3 01             	add    $0x1,%ebx
+  8015a3:	83 c4 10             	add    $0x10,%esp
+  8015a6:	83 fb 20             	cmp    $0x20,%ebx
+  8015a9:	75 ec                	jne    801597 <close_all+0xc>
+}
+  8015ab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015ae:	c9                   	leave
+  8015af:	c3                   	ret
+
+008015b0 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8015b0:	55                   	push   %ebp
+  8015b1:	89 e5                	mov    %esp,%ebp
+  8015b3:	57                   	push   %edi
+  8015b4:	56                   	push   %esi
+  8015b5:	53                   	push   %ebx
+  8015b6:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8015b9:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8015bc:	50                   	push   %eax
+  8015bd:	ff 75 08             	push   0x8(%ebp)
+  8015c0:	e8 45 fe ff ff       	call   80140a <fd_lookup>
+  8015c5:	89 c3                	mov    %eax,%ebx
+  8015c7:	83 c4 10             	add    $0x10,%esp
+  8015ca:	85 c0                	test   %eax,%eax
+  8015cc:	78 7f                	js     80164d <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8015ce:	83 ec 0c             	sub    $0xc,%esp
+  8015d1:	ff 75 0c             	push   0xc(%ebp)
+  8015d4:	e8 85 ff ff ff       	call   80155e <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8015d9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8015dc:	c1 e6 0c             	shl    $0xc,%esi
+  8015df:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8015e5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8015e8:	89 3c 24             	mov    %edi,(%esp)
+  8015eb:	e8 ad fd ff ff       	call   80139d <fd2data>
+  8015f0:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8015f2:	89 34 24             	mov    %esi,(%esp)
+  8015f5:	e8 a3 fd ff ff       	call   80139d <fd2data>
+  8015fa:	83 c4 10             	add    $0x10,%esp
+  8015fd:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801600:	89 d8                	mov    %ebx,%eax
+  801602:	c1 e8 16             	shr    $0x16,%eax
+  801605:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80160c:	a8 01                	test   $0x1,%al
+  80160e:	74 11                	je     801621 <dup+0x71>
+  801610:	89 d8                	mov    %ebx,%eax
+  801612:	c1 e8 0c             	shr    $0xc,%eax
+  801615:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80161c:	f6 c2 01             	test   $0x1,%dl
+  80161f:	75 36                	jne    801657 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801621:	89 f8                	mov    %edi,%eax
+  801623:	c1 e8 0c             	shr    $0xc,%eax
+  801626:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80162d:	83 ec 0c             	sub    $0xc,%esp
+  801630:	25 07 0e 00 00       	and    $0xe07,%eax
+  801635:	50                   	push   %eax
+  801636:	56                   	push   %esi
+  801637:	6a 00                	push   $0x0
+  801639:	57                   	push   %edi
+  80163a:	6a 00                	push   $0x0
+  80163c:	e8 f7 f8 ff ff       	call   800f38 <sys_page_map>
+  801641:	89 c3                	mov    %eax,%ebx
+  801643:	83 c4 20             	add    $0x20,%esp
+  801646:	85 c0                	test   %eax,%eax
+  801648:	78 33                	js     80167d <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80164a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80164d:	89 d8                	mov    %ebx,%eax
+  80164f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801652:	5b                   	pop    %ebx
+  801653:	5e                   	pop    %esi
+  801654:	5f                   	pop    %edi
+  801655:	5d                   	pop    %ebp
+  801656:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801657:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80165e:	83 ec 0c             	sub    $0xc,%esp
+  801661:	25 07 0e 00 00       	and    $0xe07,%eax
+  801666:	50                   	push   %eax
+  801667:	ff 75 d4             	push   -0x2c(%ebp)
+  80166a:	6a 00                	push   $0x0
+  80166c:	53                   	push   %ebx
+  80166d:	6a 00                	push   $0x0
+  80166f:	e8 c4 f8 ff ff       	call   800f38 <sys_page_map>
+  801674:	89 c3                	mov    %eax,%ebx
+  801676:	83 c4 20             	add    $0x20,%esp
+  801679:	85 c0                	test   %eax,%eax
+  80167b:	79 a4                	jns    801621 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80167d:	83 ec 08             	sub    $0x8,%esp
+  801680:	56                   	push   %esi
+  801681:	6a 00                	push   $0x0
+  801683:	e8 fc f8 ff ff       	call   800f84 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801688:	83 c4 08             	add    $0x8,%esp
+  80168b:	ff 75 d4             	push   -0x2c(%ebp)
+  80168e:	6a 00                	push   $0x0
+  801690:	e8 ef f8 ff ff       	call   800f84 <sys_page_unmap>
+	return r;
+  801695:	83 c4 10             	add    $0x10,%esp
+  801698:	eb b3                	jmp    80164d <dup+0x9d>
+
+0080169a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80169a:	55                   	push   %ebp
+  80169b:	89 e5                	mov    %esp,%ebp
+  80169d:	56                   	push   %esi
+  80169e:	53                   	push   %ebx
+  80169f:	83 ec 18             	sub    $0x18,%esp
+  8016a2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016a5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016a8:	50                   	push   %eax
+  8016a9:	53                   	push   %ebx
+  8016aa:	e8 5b fd ff ff       	call   80140a <fd_lookup>
+  8016af:	83 c4 10             	add    $0x10,%esp
+  8016b2:	85 c0                	test   %eax,%eax
+  8016b4:	78 3c                	js     8016f2 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016b6:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8016b9:	83 ec 08             	sub    $0x8,%esp
+  8016bc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016bf:	50                   	push   %eax
+  8016c0:	ff 36                	push   (%esi)
+  8016c2:	e8 93 fd ff ff       	call   80145a <dev_lookup>
+  8016c7:	83 c4 10             	add    $0x10,%esp
+  8016ca:	85 c0                	test   %eax,%eax
+  8016cc:	78 24                	js     8016f2 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8016ce:	8b 46 08             	mov    0x8(%esi),%eax
+  8016d1:	83 e0 03             	and    $0x3,%eax
+  8016d4:	83 f8 01             	cmp    $0x1,%eax
+  8016d7:	74 20                	je     8016f9 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8016d9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016dc:	8b 40 08             	mov    0x8(%eax),%eax
+  8016df:	85 c0                	test   %eax,%eax
+  8016e1:	74 61                	je     801744 <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8016e3:	83 ec 04             	sub    $0x4,%esp
+  8016e6:	ff 75 10             	push   0x10(%ebp)
+  8016e9:	ff 75 0c             	push   0xc(%ebp)
+  8016ec:	56                   	push   %esi
+  8016ed:	ff d0                	call   *%eax
+  8016ef:	83 c4 10             	add    $0x10,%esp
+}
+  8016f2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016f5:	5b                   	pop    %ebx
+  8016f6:	5e                   	pop    %esi
+  8016f7:	5d                   	pop    %ebp
+  8016f8:	c3                   	ret
+  8016f9:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8016fb:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801701:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801706:	77 18                	ja     801720 <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801708:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80170d:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80170f:	c1 e8 10             	shr    $0x10,%eax
+  801712:	74 0c                	je     801720 <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801714:	c1 e0 10             	shl    $0x10,%eax
+  801717:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80171c:	29 c2                	sub    %eax,%edx
+  80171e:	eb 06                	jmp    801726 <read+0x8c>
+		return pthread_main_tls;
+  801720:	8b 15 c0 76 80 00    	mov    0x8076c0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801726:	8b 02                	mov    (%edx),%eax
+  801728:	8b 40 48             	mov    0x48(%eax),%eax
+  80172b:	83 ec 04             	sub    $0x4,%esp
+  80172e:	53                   	push   %ebx
+  80172f:	50                   	push   %eax
+  801730:	68 11 4e 80 00       	push   $0x804e11
+  801735:	e8 9f ec ff ff       	call   8003d9 <cprintf>
+		return -E_INVAL;
+  80173a:	83 c4 10             	add    $0x10,%esp
+  80173d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801742:	eb ae                	jmp    8016f2 <read+0x58>
+		return -E_NOT_SUPP;
+  801744:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801749:	eb a7                	jmp    8016f2 <read+0x58>
+
+0080174b <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80174b:	55                   	push   %ebp
+  80174c:	89 e5                	mov    %esp,%ebp
+  80174e:	57                   	push   %edi
+  80174f:	56                   	push   %esi
+  801750:	53                   	push   %ebx
+  801751:	83 ec 0c             	sub    $0xc,%esp
+  801754:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801757:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80175a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80175f:	eb 02                	jmp    801763 <readn+0x18>
+  801761:	01 c3                	add    %eax,%ebx
+  801763:	39 f3                	cmp    %esi,%ebx
+  801765:	73 21                	jae    801788 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801767:	83 ec 04             	sub    $0x4,%esp
+  80176a:	89 f0                	mov    %esi,%eax
+  80176c:	29 d8                	sub    %ebx,%eax
+  80176e:	50                   	push   %eax
+  80176f:	89 d8                	mov    %ebx,%eax
+  801771:	03 45 0c             	add    0xc(%ebp),%eax
+  801774:	50                   	push   %eax
+  801775:	57                   	push   %edi
+  801776:	e8 1f ff ff ff       	call   80169a <read>
+		if (m < 0)
+  80177b:	83 c4 10             	add    $0x10,%esp
+  80177e:	85 c0                	test   %eax,%eax
+  801780:	78 04                	js     801786 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801782:	75 dd                	jne    801761 <readn+0x16>
+  801784:	eb 02                	jmp    801788 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801786:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801788:	89 d8                	mov    %ebx,%eax
+  80178a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80178d:	5b                   	pop    %ebx
+  80178e:	5e                   	pop    %esi
+  80178f:	5f                   	pop    %edi
+  801790:	5d                   	pop    %ebp
+  801791:	c3                   	ret
+
+00801792 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801792:	55                   	push   %ebp
+  801793:	89 e5                	mov    %esp,%ebp
+  801795:	56                   	push   %esi
+  801796:	53                   	push   %ebx
+  801797:	83 ec 18             	sub    $0x18,%esp
+  80179a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80179d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017a0:	50                   	push   %eax
+  8017a1:	53                   	push   %ebx
+  8017a2:	e8 63 fc ff ff       	call   80140a <fd_lookup>
+  8017a7:	83 c4 10             	add    $0x10,%esp
+  8017aa:	85 c0                	test   %eax,%eax
+  8017ac:	78 37                	js     8017e5 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017ae:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017b1:	83 ec 08             	sub    $0x8,%esp
+  8017b4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017b7:	50                   	push   %eax
+  8017b8:	ff 36                	push   (%esi)
+  8017ba:	e8 9b fc ff ff       	call   80145a <dev_lookup>
+  8017bf:	83 c4 10             	add    $0x10,%esp
+  8017c2:	85 c0                	test   %eax,%eax
+  8017c4:	78 1f                	js     8017e5 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8017c6:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8017ca:	74 20                	je     8017ec <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8017cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017cf:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017d2:	85 c0                	test   %eax,%eax
+  8017d4:	74 61                	je     801837 <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8017d6:	83 ec 04             	sub    $0x4,%esp
+  8017d9:	ff 75 10             	push   0x10(%ebp)
+  8017dc:	ff 75 0c             	push   0xc(%ebp)
+  8017df:	56                   	push   %esi
+  8017e0:	ff d0                	call   *%eax
+  8017e2:	83 c4 10             	add    $0x10,%esp
+}
+  8017e5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017e8:	5b                   	pop    %ebx
+  8017e9:	5e                   	pop    %esi
+  8017ea:	5d                   	pop    %ebp
+  8017eb:	c3                   	ret
+  8017ec:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8017ee:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8017f4:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8017f9:	77 18                	ja     801813 <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8017fb:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801800:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801802:	c1 e8 10             	shr    $0x10,%eax
+  801805:	74 0c                	je     801813 <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801807:	c1 e0 10             	shl    $0x10,%eax
+  80180a:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80180f:	29 c2                	sub    %eax,%edx
+  801811:	eb 06                	jmp    801819 <write+0x87>
+		return pthread_main_tls;
+  801813:	8b 15 c0 76 80 00    	mov    0x8076c0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801819:	8b 02                	mov    (%edx),%eax
+  80181b:	8b 40 48             	mov    0x48(%eax),%eax
+  80181e:	83 ec 04             	sub    $0x4,%esp
+  801821:	53                   	push   %ebx
+  801822:	50                   	push   %eax
+  801823:	68 2d 4e 80 00       	push   $0x804e2d
+  801828:	e8 ac eb ff ff       	call   8003d9 <cprintf>
+		return -E_INVAL;
+  80182d:	83 c4 10             	add    $0x10,%esp
+  801830:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801835:	eb ae                	jmp    8017e5 <write+0x53>
+		return -E_NOT_SUPP;
+  801837:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80183c:	eb a7                	jmp    8017e5 <write+0x53>
+
+0080183e <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80183e:	55                   	push   %ebp
+  80183f:	89 e5                	mov    %esp,%ebp
+  801841:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801844:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801847:	50                   	push   %eax
+  801848:	ff 75 08             	push   0x8(%ebp)
+  80184b:	e8 ba fb ff ff       	call   80140a <fd_lookup>
+  801850:	83 c4 10             	add    $0x10,%esp
+  801853:	85 c0                	test   %eax,%eax
+  801855:	78 0e                	js     801865 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801857:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80185a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80185d:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801860:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801865:	c9                   	leave
+  801866:	c3                   	ret
+
+00801867 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801867:	55                   	push   %ebp
+  801868:	89 e5                	mov    %esp,%ebp
+  80186a:	56                   	push   %esi
+  80186b:	53                   	push   %ebx
+  80186c:	83 ec 18             	sub    $0x18,%esp
+  80186f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801872:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801875:	50                   	push   %eax
+  801876:	53                   	push   %ebx
+  801877:	e8 8e fb ff ff       	call   80140a <fd_lookup>
+  80187c:	83 c4 10             	add    $0x10,%esp
+  80187f:	85 c0                	test   %eax,%eax
+  801881:	78 34                	js     8018b7 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801883:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801886:	83 ec 08             	sub    $0x8,%esp
+  801889:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80188c:	50                   	push   %eax
+  80188d:	ff 36                	push   (%esi)
+  80188f:	e8 c6 fb ff ff       	call   80145a <dev_lookup>
+  801894:	83 c4 10             	add    $0x10,%esp
+  801897:	85 c0                	test   %eax,%eax
+  801899:	78 1c                	js     8018b7 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80189b:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80189f:	74 1d                	je     8018be <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8018a1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018a4:	8b 40 18             	mov    0x18(%eax),%eax
+  8018a7:	85 c0                	test   %eax,%eax
+  8018a9:	74 5e                	je     801909 <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8018ab:	83 ec 08             	sub    $0x8,%esp
+  8018ae:	ff 75 0c             	push   0xc(%ebp)
+  8018b1:	56                   	push   %esi
+  8018b2:	ff d0                	call   *%eax
+  8018b4:	83 c4 10             	add    $0x10,%esp
+}
+  8018b7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018ba:	5b                   	pop    %ebx
+  8018bb:	5e                   	pop    %esi
+  8018bc:	5d                   	pop    %ebp
+  8018bd:	c3                   	ret
+  8018be:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8018c0:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8018c6:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8018cb:	77 18                	ja     8018e5 <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8018cd:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8018d2:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8018d4:	c1 e8 10             	shr    $0x10,%eax
+  8018d7:	74 0c                	je     8018e5 <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8018d9:	c1 e0 10             	shl    $0x10,%eax
+  8018dc:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8018e1:	29 c2                	sub    %eax,%edx
+  8018e3:	eb 06                	jmp    8018eb <ftruncate+0x84>
+		return pthread_main_tls;
+  8018e5:	8b 15 c0 76 80 00    	mov    0x8076c0,%edx
+			thisenv->env_id, fdnum);
+  8018eb:	8b 02                	mov    (%edx),%eax
+  8018ed:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8018f0:	83 ec 04             	sub    $0x4,%esp
+  8018f3:	53                   	push   %ebx
+  8018f4:	50                   	push   %eax
+  8018f5:	68 f0 4d 80 00       	push   $0x804df0
+  8018fa:	e8 da ea ff ff       	call   8003d9 <cprintf>
+		return -E_INVAL;
+  8018ff:	83 c4 10             	add    $0x10,%esp
+  801902:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801907:	eb ae                	jmp    8018b7 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801909:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80190e:	eb a7                	jmp    8018b7 <ftruncate+0x50>
+
+00801910 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801910:	55                   	push   %ebp
+  801911:	89 e5                	mov    %esp,%ebp
+  801913:	56                   	push   %esi
+  801914:	53                   	push   %ebx
+  801915:	83 ec 18             	sub    $0x18,%esp
+  801918:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80191b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80191e:	50                   	push   %eax
+  80191f:	ff 75 08             	push   0x8(%ebp)
+  801922:	e8 e3 fa ff ff       	call   80140a <fd_lookup>
+  801927:	83 c4 10             	add    $0x10,%esp
+  80192a:	85 c0                	test   %eax,%eax
+  80192c:	78 49                	js     801977 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80192e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801931:	83 ec 08             	sub    $0x8,%esp
+  801934:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801937:	50                   	push   %eax
+  801938:	ff 36                	push   (%esi)
+  80193a:	e8 1b fb ff ff       	call   80145a <dev_lookup>
+  80193f:	83 c4 10             	add    $0x10,%esp
+  801942:	85 c0                	test   %eax,%eax
+  801944:	78 31                	js     801977 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801946:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801949:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80194d:	74 2f                	je     80197e <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80194f:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801952:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801959:	00 00 00 
+	stat->st_isdir = 0;
+  80195c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801963:	00 00 00 
+	stat->st_dev = dev;
+  801966:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80196c:	83 ec 08             	sub    $0x8,%esp
+  80196f:	53                   	push   %ebx
+  801970:	56                   	push   %esi
+  801971:	ff 50 14             	call   *0x14(%eax)
+  801974:	83 c4 10             	add    $0x10,%esp
+}
+  801977:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80197a:	5b                   	pop    %ebx
+  80197b:	5e                   	pop    %esi
+  80197c:	5d                   	pop    %ebp
+  80197d:	c3                   	ret
+		return -E_NOT_SUPP;
+  80197e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801983:	eb f2                	jmp    801977 <fstat+0x67>
+
+00801985 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801985:	55                   	push   %ebp
+  801986:	89 e5                	mov    %esp,%ebp
+  801988:	56                   	push   %esi
+  801989:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80198a:	83 ec 08             	sub    $0x8,%esp
+  80198d:	6a 00                	push   $0x0
+  80198f:	ff 75 08             	push   0x8(%ebp)
+  801992:	e8 4b 03 00 00       	call   801ce2 <open>
+  801997:	89 c3                	mov    %eax,%ebx
+  801999:	83 c4 10             	add    $0x10,%esp
+  80199c:	85 c0                	test   %eax,%eax
+  80199e:	78 1b                	js     8019bb <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8019a0:	83 ec 08             	sub    $0x8,%esp
+  8019a3:	ff 75 0c             	push   0xc(%ebp)
+  8019a6:	50                   	push   %eax
+  8019a7:	e8 64 ff ff ff       	call   801910 <fstat>
+  8019ac:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8019ae:	89 1c 24             	mov    %ebx,(%esp)
+  8019b1:	e8 a8 fb ff ff       	call   80155e <close>
+	return r;
+  8019b6:	83 c4 10             	add    $0x10,%esp
+  8019b9:	89 f3                	mov    %esi,%ebx
+}
+  8019bb:	89 d8                	mov    %ebx,%eax
+  8019bd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019c0:	5b                   	pop    %ebx
+  8019c1:	5e                   	pop    %esi
+  8019c2:	5d                   	pop    %ebp
+  8019c3:	c3                   	ret
+
+008019c4 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8019c4:	55                   	push   %ebp
+  8019c5:	89 e5                	mov    %esp,%ebp
+  8019c7:	56                   	push   %esi
+  8019c8:	53                   	push   %ebx
+  8019c9:	89 c6                	mov    %eax,%esi
+  8019cb:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  8019cd:	83 3d 00 74 80 00 00 	cmpl   $0x0,0x807400
+  8019d4:	74 27                	je     8019fd <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8019d6:	6a 07                	push   $0x7
+  8019d8:	68 00 80 80 00       	push   $0x808000
+  8019dd:	56                   	push   %esi
+  8019de:	ff 35 00 74 80 00    	push   0x807400
+  8019e4:	e8 ee 2b 00 00       	call   8045d7 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8019e9:	83 c4 0c             	add    $0xc,%esp
+  8019ec:	6a 00                	push   $0x0
+  8019ee:	53                   	push   %ebx
+  8019ef:	6a 00                	push   $0x0
+  8019f1:	e8 eb 2a 00 00       	call   8044e1 <ipc_recv>
+}
+  8019f6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019f9:	5b                   	pop    %ebx
+  8019fa:	5e                   	pop    %esi
+  8019fb:	5d                   	pop    %ebp
+  8019fc:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8019fd:	83 ec 0c             	sub    $0xc,%esp
+  801a00:	6a 01                	push   $0x1
+  801a02:	e8 26 2c 00 00       	call   80462d <ipc_find_env>
+  801a07:	a3 00 74 80 00       	mov    %eax,0x807400
+  801a0c:	83 c4 10             	add    $0x10,%esp
+  801a0f:	eb c5                	jmp    8019d6 <fsipc+0x12>
+
+00801a11 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801a11:	55                   	push   %ebp
+  801a12:	89 e5                	mov    %esp,%ebp
+  801a14:	53                   	push   %ebx
+  801a15:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801a18:	68 04 74 80 00       	push   $0x807404
+  801a1d:	e8 3d 1c 00 00       	call   80365f <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801a22:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a25:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a28:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.set_size.req_size = newsize;
+  801a2d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a30:	a3 04 80 80 00       	mov    %eax,0x808004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  801a35:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a3a:	b8 02 00 00 00       	mov    $0x2,%eax
+  801a3f:	e8 80 ff ff ff       	call   8019c4 <fsipc>
+  801a44:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801a46:	c7 04 24 04 74 80 00 	movl   $0x807404,(%esp)
+  801a4d:	e8 7a 1c 00 00       	call   8036cc <mutex_unlock>
+	return r;
+}
+  801a52:	89 d8                	mov    %ebx,%eax
+  801a54:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a57:	c9                   	leave
+  801a58:	c3                   	ret
+
+00801a59 <devfile_flush>:
+{
+  801a59:	55                   	push   %ebp
+  801a5a:	89 e5                	mov    %esp,%ebp
+  801a5c:	53                   	push   %ebx
+  801a5d:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  801a60:	68 04 74 80 00       	push   $0x807404
+  801a65:	e8 f5 1b 00 00       	call   80365f <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801a6a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a6d:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a70:	a3 00 80 80 00       	mov    %eax,0x808000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  801a75:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a7a:	b8 06 00 00 00       	mov    $0x6,%eax
+  801a7f:	e8 40 ff ff ff       	call   8019c4 <fsipc>
+  801a84:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801a86:	c7 04 24 04 74 80 00 	movl   $0x807404,(%esp)
+  801a8d:	e8 3a 1c 00 00       	call   8036cc <mutex_unlock>
+}
+  801a92:	89 d8                	mov    %ebx,%eax
+  801a94:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a97:	c9                   	leave
+  801a98:	c3                   	ret
+
+00801a99 <devfile_stat>:
+{
+  801a99:	55                   	push   %ebp
+  801a9a:	89 e5                	mov    %esp,%ebp
+  801a9c:	56                   	push   %esi
+  801a9d:	53                   	push   %ebx
+  801a9e:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  801aa1:	83 ec 0c             	sub    $0xc,%esp
+  801aa4:	68 04 74 80 00       	push   $0x807404
+  801aa9:	e8 b1 1b 00 00       	call   80365f <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801aae:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ab1:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ab4:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  801ab9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801abe:	b8 05 00 00 00       	mov    $0x5,%eax
+  801ac3:	e8 fc fe ff ff       	call   8019c4 <fsipc>
+  801ac8:	89 c3                	mov    %eax,%ebx
+  801aca:	83 c4 10             	add    $0x10,%esp
+  801acd:	85 c0                	test   %eax,%eax
+  801acf:	79 16                	jns    801ae7 <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  801ad1:	83 ec 0c             	sub    $0xc,%esp
+  801ad4:	68 04 74 80 00       	push   $0x807404
+  801ad9:	e8 ee 1b 00 00       	call   8036cc <mutex_unlock>
+}
+  801ade:	89 d8                	mov    %ebx,%eax
+  801ae0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ae3:	5b                   	pop    %ebx
+  801ae4:	5e                   	pop    %esi
+  801ae5:	5d                   	pop    %ebp
+  801ae6:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801ae7:	83 ec 08             	sub    $0x8,%esp
+  801aea:	68 00 80 80 00       	push   $0x808000
+  801aef:	56                   	push   %esi
+  801af0:	e8 b8 ef ff ff       	call   800aad <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  801af5:	a1 80 80 80 00       	mov    0x808080,%eax
+  801afa:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801b00:	a1 84 80 80 00       	mov    0x808084,%eax
+  801b05:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  801b0b:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  801b0e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b13:	eb bc                	jmp    801ad1 <devfile_stat+0x38>
+
+00801b15 <devfile_write>:
+{
+  801b15:	55                   	push   %ebp
+  801b16:	89 e5                	mov    %esp,%ebp
+  801b18:	53                   	push   %ebx
+  801b19:	83 ec 10             	sub    $0x10,%esp
+  801b1c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  801b1f:	68 04 74 80 00       	push   $0x807404
+  801b24:	e8 36 1b 00 00       	call   80365f <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801b29:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b2c:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b2f:	a3 00 80 80 00       	mov    %eax,0x808000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801b34:	83 c4 10             	add    $0x10,%esp
+  801b37:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  801b3d:	76 3d                	jbe    801b7c <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  801b3f:	b8 00 00 10 00       	mov    $0x100000,%eax
+  801b44:	39 c3                	cmp    %eax,%ebx
+  801b46:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  801b49:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b4c:	a3 08 80 80 00       	mov    %eax,0x808008
+	fsipcbuf.write.req_n = n;
+  801b51:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	r = fsipc(FSREQ_WRITE, NULL);
+  801b57:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b5c:	b8 04 00 00 00       	mov    $0x4,%eax
+  801b61:	e8 5e fe ff ff       	call   8019c4 <fsipc>
+  801b66:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801b68:	83 ec 0c             	sub    $0xc,%esp
+  801b6b:	68 04 74 80 00       	push   $0x807404
+  801b70:	e8 57 1b 00 00       	call   8036cc <mutex_unlock>
+}
+  801b75:	89 d8                	mov    %ebx,%eax
+  801b77:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b7a:	c9                   	leave
+  801b7b:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  801b7c:	83 ec 04             	sub    $0x4,%esp
+  801b7f:	53                   	push   %ebx
+  801b80:	ff 75 0c             	push   0xc(%ebp)
+  801b83:	68 0c 80 80 00       	push   $0x80800c
+  801b88:	e8 a6 f0 ff ff       	call   800c33 <memmove>
+  801b8d:	83 c4 10             	add    $0x10,%esp
+  801b90:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b95:	eb b5                	jmp    801b4c <devfile_write+0x37>
+
+00801b97 <devfile_read>:
+{
+  801b97:	55                   	push   %ebp
+  801b98:	89 e5                	mov    %esp,%ebp
+  801b9a:	57                   	push   %edi
+  801b9b:	56                   	push   %esi
+  801b9c:	53                   	push   %ebx
+  801b9d:	83 ec 0c             	sub    $0xc,%esp
+  801ba0:	8b 75 08             	mov    0x8(%ebp),%esi
+  801ba3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801ba6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  801ba9:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801baf:	0f 86 8c 00 00 00    	jbe    801c41 <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  801bb5:	b8 00 00 10 00       	mov    $0x100000,%eax
+  801bba:	39 c3                	cmp    %eax,%ebx
+  801bbc:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  801bbf:	89 f8                	mov    %edi,%eax
+  801bc1:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801bc4:	eb 0f                	jmp    801bd5 <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  801bc6:	0f b6 08             	movzbl (%eax),%ecx
+  801bc9:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  801bcb:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801bd0:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  801bd5:	39 d0                	cmp    %edx,%eax
+  801bd7:	72 ed                	jb     801bc6 <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  801bd9:	83 ec 0c             	sub    $0xc,%esp
+  801bdc:	68 04 74 80 00       	push   $0x807404
+  801be1:	e8 79 1a 00 00       	call   80365f <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801be6:	8b 46 0c             	mov    0xc(%esi),%eax
+  801be9:	a3 00 80 80 00       	mov    %eax,0x808000
+		fsipcbuf.read.req_n = n;
+  801bee:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  801bf4:	89 3d 08 80 80 00    	mov    %edi,0x808008
+		r = fsipc(FSREQ_READ, NULL);
+  801bfa:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bff:	b8 03 00 00 00       	mov    $0x3,%eax
+  801c04:	e8 bb fd ff ff       	call   8019c4 <fsipc>
+  801c09:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  801c0b:	c7 04 24 04 74 80 00 	movl   $0x807404,(%esp)
+  801c12:	e8 b5 1a 00 00       	call   8036cc <mutex_unlock>
+		assert(r <= (int) n);
+  801c17:	83 c4 10             	add    $0x10,%esp
+  801c1a:	39 f3                	cmp    %esi,%ebx
+  801c1c:	7c 0a                	jl     801c28 <devfile_read+0x91>
+}
+  801c1e:	89 f0                	mov    %esi,%eax
+  801c20:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c23:	5b                   	pop    %ebx
+  801c24:	5e                   	pop    %esi
+  801c25:	5f                   	pop    %edi
+  801c26:	5d                   	pop    %ebp
+  801c27:	c3                   	ret
+		assert(r <= (int) n);
+  801c28:	68 60 4e 80 00       	push   $0x804e60
+  801c2d:	68 6d 4e 80 00       	push   $0x804e6d
+  801c32:	68 90 00 00 00       	push   $0x90
+  801c37:	68 82 4e 80 00       	push   $0x804e82
+  801c3c:	e8 bd e6 ff ff       	call   8002fe <_panic>
+	mutex_lock(&fsipc_mu);
+  801c41:	83 ec 0c             	sub    $0xc,%esp
+  801c44:	68 04 74 80 00       	push   $0x807404
+  801c49:	e8 11 1a 00 00       	call   80365f <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801c4e:	8b 46 0c             	mov    0xc(%esi),%eax
+  801c51:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.read.req_n = n;
+  801c56:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	fsipcbuf.read.req_va = 0;
+  801c5c:	c7 05 08 80 80 00 00 	movl   $0x0,0x808008
+  801c63:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  801c66:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c6b:	b8 03 00 00 00       	mov    $0x3,%eax
+  801c70:	e8 4f fd ff ff       	call   8019c4 <fsipc>
+  801c75:	89 c6                	mov    %eax,%esi
+  801c77:	83 c4 10             	add    $0x10,%esp
+  801c7a:	85 c0                	test   %eax,%eax
+  801c7c:	78 1d                	js     801c9b <devfile_read+0x104>
+		assert(r <= n);
+  801c7e:	39 c3                	cmp    %eax,%ebx
+  801c80:	72 2e                	jb     801cb0 <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  801c82:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801c87:	7f 40                	jg     801cc9 <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801c89:	83 ec 04             	sub    $0x4,%esp
+  801c8c:	50                   	push   %eax
+  801c8d:	68 00 80 80 00       	push   $0x808000
+  801c92:	57                   	push   %edi
+  801c93:	e8 9b ef ff ff       	call   800c33 <memmove>
+  801c98:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  801c9b:	83 ec 0c             	sub    $0xc,%esp
+  801c9e:	68 04 74 80 00       	push   $0x807404
+  801ca3:	e8 24 1a 00 00       	call   8036cc <mutex_unlock>
+	return r;
+  801ca8:	83 c4 10             	add    $0x10,%esp
+  801cab:	e9 6e ff ff ff       	jmp    801c1e <devfile_read+0x87>
+		assert(r <= n);
+  801cb0:	68 8d 4e 80 00       	push   $0x804e8d
+  801cb5:	68 6d 4e 80 00       	push   $0x804e6d
+  801cba:	68 99 00 00 00       	push   $0x99
+  801cbf:	68 82 4e 80 00       	push   $0x804e82
+  801cc4:	e8 35 e6 ff ff       	call   8002fe <_panic>
+		assert(r <= PGSIZE);
+  801cc9:	68 94 4e 80 00       	push   $0x804e94
+  801cce:	68 6d 4e 80 00       	push   $0x804e6d
+  801cd3:	68 9a 00 00 00       	push   $0x9a
+  801cd8:	68 82 4e 80 00       	push   $0x804e82
+  801cdd:	e8 1c e6 ff ff       	call   8002fe <_panic>
+
+00801ce2 <open>:
+{
+  801ce2:	55                   	push   %ebp
+  801ce3:	89 e5                	mov    %esp,%ebp
+  801ce5:	56                   	push   %esi
+  801ce6:	53                   	push   %ebx
+  801ce7:	83 ec 1c             	sub    $0x1c,%esp
+  801cea:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801ced:	56                   	push   %esi
+  801cee:	e8 7f ed ff ff       	call   800a72 <strlen>
+  801cf3:	83 c4 10             	add    $0x10,%esp
+  801cf6:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801cfb:	0f 8f 85 00 00 00    	jg     801d86 <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  801d01:	83 ec 0c             	sub    $0xc,%esp
+  801d04:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d07:	50                   	push   %eax
+  801d08:	e8 a7 f6 ff ff       	call   8013b4 <fd_alloc>
+  801d0d:	89 c3                	mov    %eax,%ebx
+  801d0f:	83 c4 10             	add    $0x10,%esp
+  801d12:	85 c0                	test   %eax,%eax
+  801d14:	78 55                	js     801d6b <open+0x89>
+	mutex_lock(&fsipc_mu);
+  801d16:	83 ec 0c             	sub    $0xc,%esp
+  801d19:	68 04 74 80 00       	push   $0x807404
+  801d1e:	e8 3c 19 00 00       	call   80365f <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  801d23:	83 c4 08             	add    $0x8,%esp
+  801d26:	56                   	push   %esi
+  801d27:	68 00 80 80 00       	push   $0x808000
+  801d2c:	e8 7c ed ff ff       	call   800aad <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801d31:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d34:	a3 00 84 80 00       	mov    %eax,0x808400
+	r = fsipc(FSREQ_OPEN, fd);
+  801d39:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801d3c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d41:	e8 7e fc ff ff       	call   8019c4 <fsipc>
+  801d46:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801d48:	c7 04 24 04 74 80 00 	movl   $0x807404,(%esp)
+  801d4f:	e8 78 19 00 00       	call   8036cc <mutex_unlock>
+	if (r < 0) {
+  801d54:	83 c4 10             	add    $0x10,%esp
+  801d57:	85 db                	test   %ebx,%ebx
+  801d59:	78 19                	js     801d74 <open+0x92>
+	return fd2num(fd);
+  801d5b:	83 ec 0c             	sub    $0xc,%esp
+  801d5e:	ff 75 f4             	push   -0xc(%ebp)
+  801d61:	e8 27 f6 ff ff       	call   80138d <fd2num>
+  801d66:	89 c3                	mov    %eax,%ebx
+  801d68:	83 c4 10             	add    $0x10,%esp
+}
+  801d6b:	89 d8                	mov    %ebx,%eax
+  801d6d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d70:	5b                   	pop    %ebx
+  801d71:	5e                   	pop    %esi
+  801d72:	5d                   	pop    %ebp
+  801d73:	c3                   	ret
+		fd_close(fd, 0);
+  801d74:	83 ec 08             	sub    $0x8,%esp
+  801d77:	6a 00                	push   $0x0
+  801d79:	ff 75 f4             	push   -0xc(%ebp)
+  801d7c:	e8 56 f7 ff ff       	call   8014d7 <fd_close>
+		return r;
+  801d81:	83 c4 10             	add    $0x10,%esp
+  801d84:	eb e5                	jmp    801d6b <open+0x89>
+		return -E_BAD_PATH;
+  801d86:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801d8b:	eb de                	jmp    801d6b <open+0x89>
+
+00801d8d <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  801d8d:	55                   	push   %ebp
+  801d8e:	89 e5                	mov    %esp,%ebp
+  801d90:	53                   	push   %ebx
+  801d91:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d94:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d97:	50                   	push   %eax
+  801d98:	ff 75 08             	push   0x8(%ebp)
+  801d9b:	e8 6a f6 ff ff       	call   80140a <fd_lookup>
+  801da0:	89 c3                	mov    %eax,%ebx
+  801da2:	83 c4 10             	add    $0x10,%esp
+  801da5:	85 c0                	test   %eax,%eax
+  801da7:	78 5b                	js     801e04 <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801da9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dac:	8b 0d 20 60 80 00    	mov    0x806020,%ecx
+  801db2:	39 08                	cmp    %ecx,(%eax)
+  801db4:	75 55                	jne    801e0b <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  801db6:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  801dba:	74 56                	je     801e12 <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  801dbc:	83 ec 0c             	sub    $0xc,%esp
+  801dbf:	68 04 74 80 00       	push   $0x807404
+  801dc4:	e8 96 18 00 00       	call   80365f <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  801dc9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dcc:	8b 40 0c             	mov    0xc(%eax),%eax
+  801dcf:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.allocate.req_offset = offset;
+  801dd4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801dd7:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.allocate.req_len = len;
+  801ddc:	8b 45 10             	mov    0x10(%ebp),%eax
+  801ddf:	a3 08 80 80 00       	mov    %eax,0x808008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  801de4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801de9:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801dee:	e8 d1 fb ff ff       	call   8019c4 <fsipc>
+  801df3:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801df5:	c7 04 24 04 74 80 00 	movl   $0x807404,(%esp)
+  801dfc:	e8 cb 18 00 00       	call   8036cc <mutex_unlock>
+	return r;
+  801e01:	83 c4 10             	add    $0x10,%esp
+}
+  801e04:	89 d8                	mov    %ebx,%eax
+  801e06:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e09:	c9                   	leave
+  801e0a:	c3                   	ret
+		return -E_NOT_SUPP;
+  801e0b:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801e10:	eb f2                	jmp    801e04 <fallocate+0x77>
+		return -E_INVAL;
+  801e12:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801e17:	eb eb                	jmp    801e04 <fallocate+0x77>
+
+00801e19 <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  801e19:	55                   	push   %ebp
+  801e1a:	89 e5                	mov    %esp,%ebp
+  801e1c:	56                   	push   %esi
+  801e1d:	53                   	push   %ebx
+  801e1e:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801e21:	89 f3                	mov    %esi,%ebx
+  801e23:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801e29:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801e2c:	eb 06                	jmp    801e34 <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801e2e:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801e34:	39 f3                	cmp    %esi,%ebx
+  801e36:	73 14                	jae    801e4c <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  801e38:	83 ec 08             	sub    $0x8,%esp
+  801e3b:	53                   	push   %ebx
+  801e3c:	6a 00                	push   $0x0
+  801e3e:	e8 41 f1 ff ff       	call   800f84 <sys_page_unmap>
+  801e43:	83 c4 10             	add    $0x10,%esp
+  801e46:	85 c0                	test   %eax,%eax
+  801e48:	79 e4                	jns    801e2e <munmap+0x15>
+  801e4a:	eb 05                	jmp    801e51 <munmap+0x38>
+			return r;
+	return 0;
+  801e4c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e51:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e54:	5b                   	pop    %ebx
+  801e55:	5e                   	pop    %esi
+  801e56:	5d                   	pop    %ebp
+  801e57:	c3                   	ret
+
+00801e58 <mmap>:
+{
+  801e58:	55                   	push   %ebp
+  801e59:	89 e5                	mov    %esp,%ebp
+  801e5b:	57                   	push   %edi
+  801e5c:	56                   	push   %esi
+  801e5d:	53                   	push   %ebx
+  801e5e:	83 ec 24             	sub    $0x24,%esp
+  801e61:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801e64:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801e67:	50                   	push   %eax
+  801e68:	ff 75 08             	push   0x8(%ebp)
+  801e6b:	e8 9a f5 ff ff       	call   80140a <fd_lookup>
+  801e70:	83 c4 10             	add    $0x10,%esp
+  801e73:	85 c0                	test   %eax,%eax
+  801e75:	0f 88 37 01 00 00    	js     801fb2 <mmap+0x15a>
+		return NULL;
+  801e7b:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801e80:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801e83:	8b 0d 20 60 80 00    	mov    0x806020,%ecx
+  801e89:	39 0a                	cmp    %ecx,(%edx)
+  801e8b:	0f 85 05 01 00 00    	jne    801f96 <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  801e91:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801e98:	0f 85 1b 01 00 00    	jne    801fb9 <mmap+0x161>
+  801e9e:	89 f0                	mov    %esi,%eax
+  801ea0:	83 e8 01             	sub    $0x1,%eax
+  801ea3:	0f 88 17 01 00 00    	js     801fc0 <mmap+0x168>
+	if (prot & PROT_WRITE)
+  801ea9:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  801ead:	75 28                	jne    801ed7 <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  801eaf:	83 ec 0c             	sub    $0xc,%esp
+  801eb2:	68 04 74 80 00       	push   $0x807404
+  801eb7:	e8 a3 17 00 00       	call   80365f <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801ebc:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  801ec2:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  801ec8:	83 c4 10             	add    $0x10,%esp
+  801ecb:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  801ed0:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  801ed5:	eb 2b                	jmp    801f02 <mmap+0xaa>
+		cow_enable();
+  801ed7:	e8 94 21 00 00       	call   804070 <cow_enable>
+  801edc:	eb d1                	jmp    801eaf <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  801ede:	89 c2                	mov    %eax,%edx
+  801ee0:	c1 ea 0c             	shr    $0xc,%edx
+  801ee3:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  801eea:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801ef0:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  801ef6:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  801ef9:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  801efb:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  801f00:	77 25                	ja     801f27 <mmap+0xcf>
+  801f02:	89 c2                	mov    %eax,%edx
+  801f04:	29 da                	sub    %ebx,%edx
+  801f06:	39 ca                	cmp    %ecx,%edx
+  801f08:	73 3a                	jae    801f44 <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  801f0a:	89 c2                	mov    %eax,%edx
+  801f0c:	c1 ea 16             	shr    $0x16,%edx
+  801f0f:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801f16:	f6 c2 01             	test   $0x1,%dl
+  801f19:	75 c3                	jne    801ede <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  801f1b:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  801f20:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  801f25:	eb d4                	jmp    801efb <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  801f27:	29 d8                	sub    %ebx,%eax
+  801f29:	39 c8                	cmp    %ecx,%eax
+  801f2b:	73 17                	jae    801f44 <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  801f2d:	83 ec 0c             	sub    $0xc,%esp
+  801f30:	68 04 74 80 00       	push   $0x807404
+  801f35:	e8 92 17 00 00       	call   8036cc <mutex_unlock>
+		return NULL;
+  801f3a:	83 c4 10             	add    $0x10,%esp
+  801f3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f42:	eb 52                	jmp    801f96 <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801f44:	85 db                	test   %ebx,%ebx
+  801f46:	74 e5                	je     801f2d <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801f48:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801f4b:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f4e:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.map.req_offset = offset;
+  801f53:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f56:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.map.req_len = len;
+  801f5b:	89 35 08 80 80 00    	mov    %esi,0x808008
+	fsipcbuf.map.req_va = va;
+  801f61:	89 1d 0c 80 80 00    	mov    %ebx,0x80800c
+	fsipcbuf.map.req_prot = prot;
+  801f67:	8b 45 14             	mov    0x14(%ebp),%eax
+  801f6a:	a3 10 80 80 00       	mov    %eax,0x808010
+	r = fsipc(FSREQ_MAP, NULL);
+  801f6f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f74:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801f79:	e8 46 fa ff ff       	call   8019c4 <fsipc>
+  801f7e:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  801f80:	83 ec 0c             	sub    $0xc,%esp
+  801f83:	68 04 74 80 00       	push   $0x807404
+  801f88:	e8 3f 17 00 00       	call   8036cc <mutex_unlock>
+	if (r < 0) {
+  801f8d:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  801f90:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  801f92:	85 ff                	test   %edi,%edi
+  801f94:	78 08                	js     801f9e <mmap+0x146>
+}
+  801f96:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f99:	5b                   	pop    %ebx
+  801f9a:	5e                   	pop    %esi
+  801f9b:	5f                   	pop    %edi
+  801f9c:	5d                   	pop    %ebp
+  801f9d:	c3                   	ret
+		munmap((void*) va, len);
+  801f9e:	83 ec 08             	sub    $0x8,%esp
+  801fa1:	56                   	push   %esi
+  801fa2:	53                   	push   %ebx
+  801fa3:	e8 71 fe ff ff       	call   801e19 <munmap>
+		return NULL;
+  801fa8:	83 c4 10             	add    $0x10,%esp
+  801fab:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fb0:	eb e4                	jmp    801f96 <mmap+0x13e>
+		return NULL;
+  801fb2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fb7:	eb dd                	jmp    801f96 <mmap+0x13e>
+		return NULL;
+  801fb9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fbe:	eb d6                	jmp    801f96 <mmap+0x13e>
+  801fc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fc5:	eb cf                	jmp    801f96 <mmap+0x13e>
+
+00801fc7 <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  801fc7:	55                   	push   %ebp
+  801fc8:	89 e5                	mov    %esp,%ebp
+  801fca:	53                   	push   %ebx
+  801fcb:	83 ec 10             	sub    $0x10,%esp
+  801fce:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  801fd1:	53                   	push   %ebx
+  801fd2:	e8 9b ea ff ff       	call   800a72 <strlen>
+  801fd7:	83 c4 10             	add    $0x10,%esp
+  801fda:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801fdf:	7f 42                	jg     802023 <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  801fe1:	83 ec 0c             	sub    $0xc,%esp
+  801fe4:	68 04 74 80 00       	push   $0x807404
+  801fe9:	e8 71 16 00 00       	call   80365f <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  801fee:	83 c4 08             	add    $0x8,%esp
+  801ff1:	53                   	push   %ebx
+  801ff2:	68 00 80 80 00       	push   $0x808000
+  801ff7:	e8 b1 ea ff ff       	call   800aad <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  801ffc:	ba 00 00 00 00       	mov    $0x0,%edx
+  802001:	b8 07 00 00 00       	mov    $0x7,%eax
+  802006:	e8 b9 f9 ff ff       	call   8019c4 <fsipc>
+  80200b:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80200d:	c7 04 24 04 74 80 00 	movl   $0x807404,(%esp)
+  802014:	e8 b3 16 00 00       	call   8036cc <mutex_unlock>
+	return r;
+  802019:	83 c4 10             	add    $0x10,%esp
+}
+  80201c:	89 d8                	mov    %ebx,%eax
+  80201e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802021:	c9                   	leave
+  802022:	c3                   	ret
+		return -E_BAD_PATH;
+  802023:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802028:	eb f2                	jmp    80201c <remove+0x55>
+
+0080202a <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80202a:	55                   	push   %ebp
+  80202b:	89 e5                	mov    %esp,%ebp
+  80202d:	53                   	push   %ebx
+  80202e:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  802031:	68 04 74 80 00       	push   $0x807404
+  802036:	e8 24 16 00 00       	call   80365f <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  80203b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802040:	b8 08 00 00 00       	mov    $0x8,%eax
+  802045:	e8 7a f9 ff ff       	call   8019c4 <fsipc>
+  80204a:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80204c:	c7 04 24 04 74 80 00 	movl   $0x807404,(%esp)
+  802053:	e8 74 16 00 00       	call   8036cc <mutex_unlock>
+	return r;
+}
+  802058:	89 d8                	mov    %ebx,%eax
+  80205a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80205d:	c9                   	leave
+  80205e:	c3                   	ret
+
+0080205f <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  80205f:	55                   	push   %ebp
+  802060:	89 e5                	mov    %esp,%ebp
+  802062:	56                   	push   %esi
+  802063:	53                   	push   %ebx
+  802064:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  802067:	83 ec 0c             	sub    $0xc,%esp
+  80206a:	68 04 74 80 00       	push   $0x807404
+  80206f:	e8 eb 15 00 00       	call   80365f <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  802074:	8b 45 08             	mov    0x8(%ebp),%eax
+  802077:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  80207c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802081:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802086:	e8 39 f9 ff ff       	call   8019c4 <fsipc>
+  80208b:	89 c6                	mov    %eax,%esi
+  80208d:	83 c4 10             	add    $0x10,%esp
+  802090:	85 db                	test   %ebx,%ebx
+  802092:	74 7b                	je     80210f <fs_bcstat+0xb0>
+  802094:	85 c0                	test   %eax,%eax
+  802096:	78 77                	js     80210f <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  802098:	a1 00 80 80 00       	mov    0x808000,%eax
+  80209d:	89 03                	mov    %eax,(%ebx)
+  80209f:	a1 04 80 80 00       	mov    0x808004,%eax
+  8020a4:	89 43 04             	mov    %eax,0x4(%ebx)
+  8020a7:	a1 08 80 80 00       	mov    0x808008,%eax
+  8020ac:	89 43 08             	mov    %eax,0x8(%ebx)
+  8020af:	a1 0c 80 80 00       	mov    0x80800c,%eax
+  8020b4:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8020b7:	a1 10 80 80 00       	mov    0x808010,%eax
+  8020bc:	89 43 10             	mov    %eax,0x10(%ebx)
+  8020bf:	a1 14 80 80 00       	mov    0x808014,%eax
+  8020c4:	89 43 14             	mov    %eax,0x14(%ebx)
+  8020c7:	a1 18 80 80 00       	mov    0x808018,%eax
+  8020cc:	89 43 18             	mov    %eax,0x18(%ebx)
+  8020cf:	a1 1c 80 80 00       	mov    0x80801c,%eax
+  8020d4:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  8020d7:	a1 20 80 80 00       	mov    0x808020,%eax
+  8020dc:	89 43 20             	mov    %eax,0x20(%ebx)
+  8020df:	a1 24 80 80 00       	mov    0x808024,%eax
+  8020e4:	89 43 24             	mov    %eax,0x24(%ebx)
+  8020e7:	a1 28 80 80 00       	mov    0x808028,%eax
+  8020ec:	89 43 28             	mov    %eax,0x28(%ebx)
+  8020ef:	a1 2c 80 80 00       	mov    0x80802c,%eax
+  8020f4:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  8020f7:	a1 30 80 80 00       	mov    0x808030,%eax
+  8020fc:	89 43 30             	mov    %eax,0x30(%ebx)
+  8020ff:	a1 34 80 80 00       	mov    0x808034,%eax
+  802104:	89 43 34             	mov    %eax,0x34(%ebx)
+  802107:	a1 38 80 80 00       	mov    0x808038,%eax
+  80210c:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  80210f:	83 ec 0c             	sub    $0xc,%esp
+  802112:	68 04 74 80 00       	push   $0x807404
+  802117:	e8 b0 15 00 00       	call   8036cc <mutex_unlock>
+	return r;
+}
+  80211c:	89 f0                	mov    %esi,%eax
+  80211e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802121:	5b                   	pop    %ebx
+  802122:	5e                   	pop    %esi
+  802123:	5d                   	pop    %ebp
+  802124:	c3                   	ret
+
+00802125 <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+	if (b->error > 0) {
+  802125:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802129:	7f 01                	jg     80212c <writebuf+0x7>
+  80212b:	c3                   	ret
+{
+  80212c:	55                   	push   %ebp
+  80212d:	89 e5                	mov    %esp,%ebp
+  80212f:	53                   	push   %ebx
+  802130:	83 ec 08             	sub    $0x8,%esp
+  802133:	89 c3                	mov    %eax,%ebx
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  802135:	ff 70 04             	push   0x4(%eax)
+  802138:	8d 40 10             	lea    0x10(%eax),%eax
+  80213b:	50                   	push   %eax
+  80213c:	ff 33                	push   (%ebx)
+  80213e:	e8 4f f6 ff ff       	call   801792 <write>
+		if (result > 0)
+  802143:	83 c4 10             	add    $0x10,%esp
+  802146:	85 c0                	test   %eax,%eax
+  802148:	7e 03                	jle    80214d <writebuf+0x28>
+			b->result += result;
+  80214a:	01 43 08             	add    %eax,0x8(%ebx)
+		if (result != b->idx) // error, or wrote less than supplied
+  80214d:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802150:	74 0d                	je     80215f <writebuf+0x3a>
+			b->error = (result < 0 ? result : 0);
+  802152:	85 c0                	test   %eax,%eax
+  802154:	ba 00 00 00 00       	mov    $0x0,%edx
+  802159:	0f 4f c2             	cmovg  %edx,%eax
+  80215c:	89 43 0c             	mov    %eax,0xc(%ebx)
+	}
+}
+  80215f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802162:	c9                   	leave
+  802163:	c3                   	ret
+
+00802164 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  802164:	55                   	push   %ebp
+  802165:	89 e5                	mov    %esp,%ebp
+  802167:	53                   	push   %ebx
+  802168:	83 ec 04             	sub    $0x4,%esp
+  80216b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct printbuf *b = (struct printbuf *) thunk;
+	b->buf[b->idx++] = ch;
+  80216e:	8b 53 04             	mov    0x4(%ebx),%edx
+  802171:	8d 42 01             	lea    0x1(%edx),%eax
+  802174:	89 43 04             	mov    %eax,0x4(%ebx)
+  802177:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80217a:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+	if (b->idx == 256) {
+  80217e:	3d 00 01 00 00       	cmp    $0x100,%eax
+  802183:	74 05                	je     80218a <putch+0x26>
+		writebuf(b);
+		b->idx = 0;
+	}
+}
+  802185:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802188:	c9                   	leave
+  802189:	c3                   	ret
+		writebuf(b);
+  80218a:	89 d8                	mov    %ebx,%eax
+  80218c:	e8 94 ff ff ff       	call   802125 <writebuf>
+		b->idx = 0;
+  802191:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  802198:	eb eb                	jmp    802185 <putch+0x21>
+
+0080219a <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  80219a:	55                   	push   %ebp
+  80219b:	89 e5                	mov    %esp,%ebp
+  80219d:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.fd = fd;
+  8021a3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021a6:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+	b.idx = 0;
+  8021ac:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  8021b3:	00 00 00 
+	b.result = 0;
+  8021b6:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8021bd:	00 00 00 
+	b.error = 1;
+  8021c0:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  8021c7:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  8021ca:	ff 75 10             	push   0x10(%ebp)
+  8021cd:	ff 75 0c             	push   0xc(%ebp)
+  8021d0:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8021d6:	50                   	push   %eax
+  8021d7:	68 64 21 80 00       	push   $0x802164
+  8021dc:	e8 ef e2 ff ff       	call   8004d0 <vprintfmt>
+	if (b.idx > 0)
+  8021e1:	83 c4 10             	add    $0x10,%esp
+  8021e4:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  8021eb:	7f 12                	jg     8021ff <vfprintf+0x65>
+		writebuf(&b);
+
+	return (b.result ? b.result : b.error);
+  8021ed:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  8021f3:	85 c0                	test   %eax,%eax
+  8021f5:	75 06                	jne    8021fd <vfprintf+0x63>
+  8021f7:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  8021fd:	c9                   	leave
+  8021fe:	c3                   	ret
+		writebuf(&b);
+  8021ff:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  802205:	e8 1b ff ff ff       	call   802125 <writebuf>
+  80220a:	eb e1                	jmp    8021ed <vfprintf+0x53>
+
+0080220c <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  80220c:	55                   	push   %ebp
+  80220d:	89 e5                	mov    %esp,%ebp
+  80220f:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  802212:	8d 45 10             	lea    0x10(%ebp),%eax
+	cnt = vfprintf(fd, fmt, ap);
+  802215:	50                   	push   %eax
+  802216:	ff 75 0c             	push   0xc(%ebp)
+  802219:	ff 75 08             	push   0x8(%ebp)
+  80221c:	e8 79 ff ff ff       	call   80219a <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  802221:	c9                   	leave
+  802222:	c3                   	ret
+
+00802223 <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  802223:	55                   	push   %ebp
+  802224:	89 e5                	mov    %esp,%ebp
+  802226:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  802229:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vfprintf(1, fmt, ap);
+  80222c:	50                   	push   %eax
+  80222d:	ff 75 08             	push   0x8(%ebp)
+  802230:	6a 01                	push   $0x1
+  802232:	e8 63 ff ff ff       	call   80219a <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  802237:	c9                   	leave
+  802238:	c3                   	ret
+
+00802239 <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  802239:	55                   	push   %ebp
+  80223a:	89 e5                	mov    %esp,%ebp
+  80223c:	56                   	push   %esi
+  80223d:	53                   	push   %ebx
+  80223e:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  802240:	0f b6 10             	movzbl (%eax),%edx
+  802243:	80 fa 72             	cmp    $0x72,%dl
+  802246:	74 44                	je     80228c <parse_mode+0x53>
+  802248:	80 fa 77             	cmp    $0x77,%dl
+  80224b:	74 4b                	je     802298 <parse_mode+0x5f>
+  80224d:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802252:	80 fa 61             	cmp    $0x61,%dl
+  802255:	74 09                	je     802260 <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  802257:	89 d8                	mov    %ebx,%eax
+  802259:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80225c:	5b                   	pop    %ebx
+  80225d:	5e                   	pop    %esi
+  80225e:	5d                   	pop    %ebp
+  80225f:	c3                   	ret
+	switch (mode[0]) {
+  802260:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  802265:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  80226a:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  80226c:	83 ec 08             	sub    $0x8,%esp
+  80226f:	6a 2b                	push   $0x2b
+  802271:	50                   	push   %eax
+  802272:	e8 48 e9 ff ff       	call   800bbf <strchr>
+  802277:	83 c4 10             	add    $0x10,%esp
+  80227a:	85 c0                	test   %eax,%eax
+  80227c:	74 d9                	je     802257 <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  80227e:	83 e3 fc             	and    $0xfffffffc,%ebx
+  802281:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  802284:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  80228a:	eb cb                	jmp    802257 <parse_mode+0x1e>
+	switch (mode[0]) {
+  80228c:	ba 01 00 00 00       	mov    $0x1,%edx
+  802291:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802296:	eb d2                	jmp    80226a <parse_mode+0x31>
+  802298:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  80229d:	bb 01 03 00 00       	mov    $0x301,%ebx
+  8022a2:	eb c6                	jmp    80226a <parse_mode+0x31>
+
+008022a4 <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  8022a4:	55                   	push   %ebp
+  8022a5:	89 e5                	mov    %esp,%ebp
+  8022a7:	57                   	push   %edi
+  8022a8:	56                   	push   %esi
+  8022a9:	53                   	push   %ebx
+  8022aa:	83 ec 1c             	sub    $0x1c,%esp
+  8022ad:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8022b0:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  8022b3:	b8 44 60 80 00       	mov    $0x806044,%eax
+  8022b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  8022bd:	83 c0 24             	add    $0x24,%eax
+  8022c0:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  8022c4:	74 17                	je     8022dd <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  8022c6:	83 c3 01             	add    $0x1,%ebx
+  8022c9:	83 fb 10             	cmp    $0x10,%ebx
+  8022cc:	75 ef                	jne    8022bd <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  8022ce:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  8022d3:	89 f0                	mov    %esi,%eax
+  8022d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022d8:	5b                   	pop    %ebx
+  8022d9:	5e                   	pop    %esi
+  8022da:	5f                   	pop    %edi
+  8022db:	5d                   	pop    %ebp
+  8022dc:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  8022dd:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  8022e4:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8022e7:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  8022ea:	c1 e7 02             	shl    $0x2,%edi
+  8022ed:	8d b7 40 60 80 00    	lea    0x806040(%edi),%esi
+  8022f3:	83 ec 04             	sub    $0x4,%esp
+  8022f6:	6a 24                	push   $0x24
+  8022f8:	6a 00                	push   $0x0
+  8022fa:	56                   	push   %esi
+  8022fb:	e8 fe e8 ff ff       	call   800bfe <memset>
+			streams[i].f_fd = fd;
+  802300:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802303:	89 8f 40 60 80 00    	mov    %ecx,0x806040(%edi)
+			streams[i].f_flags = flags;
+  802309:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80230c:	01 d8                	add    %ebx,%eax
+  80230e:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802311:	89 0c 85 44 60 80 00 	mov    %ecx,0x806044(,%eax,4)
+			return &streams[i];
+  802318:	83 c4 10             	add    $0x10,%esp
+  80231b:	eb b6                	jmp    8022d3 <stream_alloc+0x2f>
+
+0080231d <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  80231d:	55                   	push   %ebp
+  80231e:	89 e5                	mov    %esp,%ebp
+  802320:	53                   	push   %ebx
+  802321:	83 ec 14             	sub    $0x14,%esp
+  802324:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  802326:	8b 40 18             	mov    0x18(%eax),%eax
+  802329:	39 43 14             	cmp    %eax,0x14(%ebx)
+  80232c:	74 4a                	je     802378 <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  80232e:	83 ec 08             	sub    $0x8,%esp
+  802331:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802334:	50                   	push   %eax
+  802335:	ff 33                	push   (%ebx)
+  802337:	e8 ce f0 ff ff       	call   80140a <fd_lookup>
+  80233c:	89 c2                	mov    %eax,%edx
+  80233e:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802341:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802346:	85 d2                	test   %edx,%edx
+  802348:	78 41                	js     80238b <stream_unread+0x6e>
+  80234a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80234d:	8b 0d 20 60 80 00    	mov    0x806020,%ecx
+  802353:	39 0a                	cmp    %ecx,(%edx)
+  802355:	75 34                	jne    80238b <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  802357:	8b 43 14             	mov    0x14(%ebx),%eax
+  80235a:	03 42 04             	add    0x4(%edx),%eax
+  80235d:	2b 43 18             	sub    0x18(%ebx),%eax
+  802360:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  802363:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  80236a:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  802371:	b8 01 00 00 00       	mov    $0x1,%eax
+  802376:	eb 13                	jmp    80238b <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  802378:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  80237f:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  802386:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80238b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80238e:	c9                   	leave
+  80238f:	c3                   	ret
+
+00802390 <stream_drain>:
+{
+  802390:	55                   	push   %ebp
+  802391:	89 e5                	mov    %esp,%ebp
+  802393:	56                   	push   %esi
+  802394:	53                   	push   %ebx
+  802395:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  802397:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80239c:	eb 02                	jmp    8023a0 <stream_drain+0x10>
+  80239e:	01 c3                	add    %eax,%ebx
+  8023a0:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8023a3:	39 c3                	cmp    %eax,%ebx
+  8023a5:	73 43                	jae    8023ea <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  8023a7:	83 ec 04             	sub    $0x4,%esp
+  8023aa:	29 d8                	sub    %ebx,%eax
+  8023ac:	50                   	push   %eax
+  8023ad:	89 d8                	mov    %ebx,%eax
+  8023af:	03 46 0c             	add    0xc(%esi),%eax
+  8023b2:	50                   	push   %eax
+  8023b3:	ff 36                	push   (%esi)
+  8023b5:	e8 d8 f3 ff ff       	call   801792 <write>
+  8023ba:	83 c4 10             	add    $0x10,%esp
+  8023bd:	85 c0                	test   %eax,%eax
+  8023bf:	7f dd                	jg     80239e <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  8023c1:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  8023c5:	8b 56 0c             	mov    0xc(%esi),%edx
+  8023c8:	83 ec 04             	sub    $0x4,%esp
+  8023cb:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8023ce:	29 d8                	sub    %ebx,%eax
+  8023d0:	50                   	push   %eax
+  8023d1:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  8023d4:	50                   	push   %eax
+  8023d5:	52                   	push   %edx
+  8023d6:	e8 58 e8 ff ff       	call   800c33 <memmove>
+			f->f_wend -= done;
+  8023db:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8023de:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  8023e0:	83 c4 10             	add    $0x10,%esp
+  8023e3:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8023e8:	eb 0a                	jmp    8023f4 <stream_drain+0x64>
+  8023ea:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  8023ef:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  8023f4:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  8023f7:	89 d0                	mov    %edx,%eax
+  8023f9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023fc:	5b                   	pop    %ebx
+  8023fd:	5e                   	pop    %esi
+  8023fe:	5d                   	pop    %ebp
+  8023ff:	c3                   	ret
+
+00802400 <stream_setup>:
+	if (f->f_buf)
+  802400:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802404:	74 01                	je     802407 <stream_setup+0x7>
+  802406:	c3                   	ret
+{
+  802407:	55                   	push   %ebp
+  802408:	89 e5                	mov    %esp,%ebp
+  80240a:	53                   	push   %ebx
+  80240b:	83 ec 04             	sub    $0x4,%esp
+  80240e:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  802410:	8b 40 08             	mov    0x8(%eax),%eax
+  802413:	85 c0                	test   %eax,%eax
+  802415:	74 17                	je     80242e <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  802417:	83 f8 03             	cmp    $0x3,%eax
+  80241a:	75 2d                	jne    802449 <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  80241c:	8d 43 20             	lea    0x20(%ebx),%eax
+  80241f:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  802422:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  802429:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80242c:	c9                   	leave
+  80242d:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  80242e:	83 ec 0c             	sub    $0xc,%esp
+  802431:	ff 33                	push   (%ebx)
+  802433:	e8 a5 dd ff ff       	call   8001dd <iscons>
+  802438:	83 c4 10             	add    $0x10,%esp
+  80243b:	85 c0                	test   %eax,%eax
+  80243d:	0f 9f c0             	setg   %al
+  802440:	0f b6 c0             	movzbl %al,%eax
+  802443:	83 c0 01             	add    $0x1,%eax
+  802446:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  802449:	83 ec 0c             	sub    $0xc,%esp
+  80244c:	68 00 10 00 00       	push   $0x1000
+  802451:	e8 6e 0b 00 00       	call   802fc4 <malloc>
+  802456:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802459:	83 c4 10             	add    $0x10,%esp
+  80245c:	85 c0                	test   %eax,%eax
+  80245e:	74 bc                	je     80241c <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  802460:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  802467:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  80246b:	eb bc                	jmp    802429 <stream_setup+0x29>
+
+0080246d <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  80246d:	55                   	push   %ebp
+  80246e:	89 e5                	mov    %esp,%ebp
+  802470:	53                   	push   %ebx
+  802471:	83 ec 04             	sub    $0x4,%esp
+  802474:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  802476:	e8 85 ff ff ff       	call   802400 <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  80247b:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  802480:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  802484:	74 3d                	je     8024c3 <stream_fill+0x56>
+  802486:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  80248a:	74 10                	je     80249c <stream_fill+0x2f>
+  80248c:	89 d8                	mov    %ebx,%eax
+  80248e:	e8 fd fe ff ff       	call   802390 <stream_drain>
+		return 0;
+  802493:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  802498:	85 c0                	test   %eax,%eax
+  80249a:	78 27                	js     8024c3 <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  80249c:	83 ec 04             	sub    $0x4,%esp
+  80249f:	ff 73 10             	push   0x10(%ebx)
+  8024a2:	ff 73 0c             	push   0xc(%ebx)
+  8024a5:	ff 33                	push   (%ebx)
+  8024a7:	e8 ee f1 ff ff       	call   80169a <read>
+  8024ac:	83 c4 10             	add    $0x10,%esp
+  8024af:	85 c0                	test   %eax,%eax
+  8024b1:	7e 17                	jle    8024ca <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  8024b3:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  8024b7:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  8024be:	89 c2                	mov    %eax,%edx
+  8024c0:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  8024c3:	89 d0                	mov    %edx,%eax
+  8024c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024c8:	c9                   	leave
+  8024c9:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  8024ca:	c1 f8 1f             	sar    $0x1f,%eax
+  8024cd:	83 e0 04             	and    $0x4,%eax
+  8024d0:	83 c0 04             	add    $0x4,%eax
+  8024d3:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  8024d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024db:	eb e6                	jmp    8024c3 <stream_fill+0x56>
+
+008024dd <fopen>:
+{
+  8024dd:	55                   	push   %ebp
+  8024de:	89 e5                	mov    %esp,%ebp
+  8024e0:	57                   	push   %edi
+  8024e1:	56                   	push   %esi
+  8024e2:	53                   	push   %ebx
+  8024e3:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  8024e9:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8024ec:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  8024f2:	89 f0                	mov    %esi,%eax
+  8024f4:	e8 40 fd ff ff       	call   802239 <parse_mode>
+		return 0;
+  8024f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8024fe:	85 c0                	test   %eax,%eax
+  802500:	78 2d                	js     80252f <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  802502:	83 ec 08             	sub    $0x8,%esp
+  802505:	50                   	push   %eax
+  802506:	ff 75 08             	push   0x8(%ebp)
+  802509:	e8 d4 f7 ff ff       	call   801ce2 <open>
+  80250e:	89 c7                	mov    %eax,%edi
+  802510:	83 c4 10             	add    $0x10,%esp
+  802513:	85 c0                	test   %eax,%eax
+  802515:	78 58                	js     80256f <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  802517:	80 3e 61             	cmpb   $0x61,(%esi)
+  80251a:	74 1d                	je     802539 <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  80251c:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  802522:	89 f8                	mov    %edi,%eax
+  802524:	e8 7b fd ff ff       	call   8022a4 <stream_alloc>
+  802529:	89 c3                	mov    %eax,%ebx
+  80252b:	85 c0                	test   %eax,%eax
+  80252d:	74 32                	je     802561 <fopen+0x84>
+}
+  80252f:	89 d8                	mov    %ebx,%eax
+  802531:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802534:	5b                   	pop    %ebx
+  802535:	5e                   	pop    %esi
+  802536:	5f                   	pop    %edi
+  802537:	5d                   	pop    %ebp
+  802538:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  802539:	83 ec 08             	sub    $0x8,%esp
+  80253c:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  802542:	50                   	push   %eax
+  802543:	57                   	push   %edi
+  802544:	e8 c7 f3 ff ff       	call   801910 <fstat>
+  802549:	83 c4 10             	add    $0x10,%esp
+  80254c:	85 c0                	test   %eax,%eax
+  80254e:	78 cc                	js     80251c <fopen+0x3f>
+		seek(fd, st.st_size);
+  802550:	83 ec 08             	sub    $0x8,%esp
+  802553:	ff 75 dc             	push   -0x24(%ebp)
+  802556:	57                   	push   %edi
+  802557:	e8 e2 f2 ff ff       	call   80183e <seek>
+  80255c:	83 c4 10             	add    $0x10,%esp
+  80255f:	eb bb                	jmp    80251c <fopen+0x3f>
+		close(fd);
+  802561:	83 ec 0c             	sub    $0xc,%esp
+  802564:	57                   	push   %edi
+  802565:	e8 f4 ef ff ff       	call   80155e <close>
+  80256a:	83 c4 10             	add    $0x10,%esp
+  80256d:	eb c0                	jmp    80252f <fopen+0x52>
+		return 0;
+  80256f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802574:	eb b9                	jmp    80252f <fopen+0x52>
+
+00802576 <fdopen>:
+{
+  802576:	55                   	push   %ebp
+  802577:	89 e5                	mov    %esp,%ebp
+  802579:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  80257c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80257f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802582:	e8 b2 fc ff ff       	call   802239 <parse_mode>
+  802587:	89 c2                	mov    %eax,%edx
+		return 0;
+  802589:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  80258e:	85 d2                	test   %edx,%edx
+  802590:	78 0b                	js     80259d <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  802592:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802595:	8b 45 08             	mov    0x8(%ebp),%eax
+  802598:	e8 07 fd ff ff       	call   8022a4 <stream_alloc>
+}
+  80259d:	c9                   	leave
+  80259e:	c3                   	ret
+
+0080259f <setvbuf>:
+{
+  80259f:	55                   	push   %ebp
+  8025a0:	89 e5                	mov    %esp,%ebp
+  8025a2:	57                   	push   %edi
+  8025a3:	56                   	push   %esi
+  8025a4:	53                   	push   %ebx
+  8025a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025a8:	8b 55 10             	mov    0x10(%ebp),%edx
+  8025ab:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  8025ae:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8025b2:	75 3a                	jne    8025ee <setvbuf+0x4f>
+  8025b4:	8d 72 ff             	lea    -0x1(%edx),%esi
+  8025b7:	83 fe 02             	cmp    $0x2,%esi
+  8025ba:	77 39                	ja     8025f5 <setvbuf+0x56>
+	f->f_bufmode = mode;
+  8025bc:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  8025bf:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8025c3:	0f 95 c3             	setne  %bl
+  8025c6:	85 ff                	test   %edi,%edi
+  8025c8:	0f 95 c1             	setne  %cl
+  8025cb:	84 cb                	test   %cl,%bl
+  8025cd:	74 05                	je     8025d4 <setvbuf+0x35>
+  8025cf:	83 fa 03             	cmp    $0x3,%edx
+  8025d2:	75 0a                	jne    8025de <setvbuf+0x3f>
+	return 0;
+  8025d4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025d9:	5b                   	pop    %ebx
+  8025da:	5e                   	pop    %esi
+  8025db:	5f                   	pop    %edi
+  8025dc:	5d                   	pop    %ebp
+  8025dd:	c3                   	ret
+		f->f_buf = buf;
+  8025de:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8025e1:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  8025e4:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  8025e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025ec:	eb eb                	jmp    8025d9 <setvbuf+0x3a>
+		return EOF;
+  8025ee:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8025f3:	eb e4                	jmp    8025d9 <setvbuf+0x3a>
+  8025f5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8025fa:	eb dd                	jmp    8025d9 <setvbuf+0x3a>
+
+008025fc <fflush>:
+{
+  8025fc:	55                   	push   %ebp
+  8025fd:	89 e5                	mov    %esp,%ebp
+  8025ff:	57                   	push   %edi
+  802600:	56                   	push   %esi
+  802601:	53                   	push   %ebx
+  802602:	83 ec 0c             	sub    $0xc,%esp
+  802605:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  802608:	85 db                	test   %ebx,%ebx
+  80260a:	74 1a                	je     802626 <fflush+0x2a>
+	stream_unread(f);
+  80260c:	89 d8                	mov    %ebx,%eax
+  80260e:	e8 0a fd ff ff       	call   80231d <stream_unread>
+	return stream_drain(f);
+  802613:	89 d8                	mov    %ebx,%eax
+  802615:	e8 76 fd ff ff       	call   802390 <stream_drain>
+  80261a:	89 c7                	mov    %eax,%edi
+}
+  80261c:	89 f8                	mov    %edi,%eax
+  80261e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802621:	5b                   	pop    %ebx
+  802622:	5e                   	pop    %esi
+  802623:	5f                   	pop    %edi
+  802624:	5d                   	pop    %ebp
+  802625:	c3                   	ret
+  802626:	bb 40 60 80 00       	mov    $0x806040,%ebx
+  80262b:	be 80 62 80 00       	mov    $0x806280,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  802630:	bf 00 00 00 00       	mov    $0x0,%edi
+  802635:	eb 03                	jmp    80263a <fflush+0x3e>
+  802637:	83 c3 24             	add    $0x24,%ebx
+  80263a:	39 f3                	cmp    %esi,%ebx
+  80263c:	74 de                	je     80261c <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  80263e:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  802642:	74 f3                	je     802637 <fflush+0x3b>
+  802644:	83 ec 0c             	sub    $0xc,%esp
+  802647:	53                   	push   %ebx
+  802648:	e8 af ff ff ff       	call   8025fc <fflush>
+  80264d:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  802650:	85 c0                	test   %eax,%eax
+  802652:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802657:	0f 48 f8             	cmovs  %eax,%edi
+  80265a:	eb db                	jmp    802637 <fflush+0x3b>
+
+0080265c <fclose>:
+{
+  80265c:	55                   	push   %ebp
+  80265d:	89 e5                	mov    %esp,%ebp
+  80265f:	56                   	push   %esi
+  802660:	53                   	push   %ebx
+  802661:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  802664:	83 ec 0c             	sub    $0xc,%esp
+  802667:	56                   	push   %esi
+  802668:	e8 8f ff ff ff       	call   8025fc <fflush>
+  80266d:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  80266f:	83 c4 04             	add    $0x4,%esp
+  802672:	ff 36                	push   (%esi)
+  802674:	e8 e5 ee ff ff       	call   80155e <close>
+  802679:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  80267c:	85 c0                	test   %eax,%eax
+  80267e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802683:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  802686:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  80268a:	75 10                	jne    80269c <fclose+0x40>
+	f->f_flags = 0;
+  80268c:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  802693:	89 d8                	mov    %ebx,%eax
+  802695:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802698:	5b                   	pop    %ebx
+  802699:	5e                   	pop    %esi
+  80269a:	5d                   	pop    %ebp
+  80269b:	c3                   	ret
+		free(f->f_buf);
+  80269c:	83 ec 0c             	sub    $0xc,%esp
+  80269f:	ff 76 0c             	push   0xc(%esi)
+  8026a2:	e8 54 08 00 00       	call   802efb <free>
+  8026a7:	83 c4 10             	add    $0x10,%esp
+  8026aa:	eb e0                	jmp    80268c <fclose+0x30>
+
+008026ac <fileno>:
+{
+  8026ac:	55                   	push   %ebp
+  8026ad:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  8026af:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026b2:	8b 00                	mov    (%eax),%eax
+}
+  8026b4:	5d                   	pop    %ebp
+  8026b5:	c3                   	ret
+
+008026b6 <feof>:
+{
+  8026b6:	55                   	push   %ebp
+  8026b7:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  8026b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026bc:	8b 40 04             	mov    0x4(%eax),%eax
+  8026bf:	c1 e8 02             	shr    $0x2,%eax
+  8026c2:	83 e0 01             	and    $0x1,%eax
+}
+  8026c5:	5d                   	pop    %ebp
+  8026c6:	c3                   	ret
+
+008026c7 <ferror>:
+{
+  8026c7:	55                   	push   %ebp
+  8026c8:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  8026ca:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026cd:	8b 40 04             	mov    0x4(%eax),%eax
+  8026d0:	c1 e8 03             	shr    $0x3,%eax
+  8026d3:	83 e0 01             	and    $0x1,%eax
+}
+  8026d6:	5d                   	pop    %ebp
+  8026d7:	c3                   	ret
+
+008026d8 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  8026d8:	55                   	push   %ebp
+  8026d9:	89 e5                	mov    %esp,%ebp
+  8026db:	53                   	push   %ebx
+  8026dc:	83 ec 04             	sub    $0x4,%esp
+  8026df:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8026e2:	8b 43 18             	mov    0x18(%ebx),%eax
+  8026e5:	39 43 14             	cmp    %eax,0x14(%ebx)
+  8026e8:	74 15                	je     8026ff <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  8026ea:	8b 53 0c             	mov    0xc(%ebx),%edx
+  8026ed:	8b 43 14             	mov    0x14(%ebx),%eax
+  8026f0:	8d 48 01             	lea    0x1(%eax),%ecx
+  8026f3:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  8026f6:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  8026fa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026fd:	c9                   	leave
+  8026fe:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  8026ff:	89 d8                	mov    %ebx,%eax
+  802701:	e8 67 fd ff ff       	call   80246d <stream_fill>
+  802706:	85 c0                	test   %eax,%eax
+  802708:	75 e0                	jne    8026ea <fgetc+0x12>
+		return EOF;
+  80270a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80270f:	eb e9                	jmp    8026fa <fgetc+0x22>
+
+00802711 <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  802711:	55                   	push   %ebp
+  802712:	89 e5                	mov    %esp,%ebp
+  802714:	57                   	push   %edi
+  802715:	56                   	push   %esi
+  802716:	53                   	push   %ebx
+  802717:	83 ec 1c             	sub    $0x1c,%esp
+  80271a:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  80271d:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802722:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802725:	83 e8 01             	sub    $0x1,%eax
+  802728:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  80272b:	eb 66                	jmp    802793 <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  80272d:	8b 46 14             	mov    0x14(%esi),%eax
+  802730:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802733:	29 c3                	sub    %eax,%ebx
+  802735:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802738:	29 fa                	sub    %edi,%edx
+  80273a:	39 d3                	cmp    %edx,%ebx
+  80273c:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  80273f:	83 ec 04             	sub    $0x4,%esp
+  802742:	53                   	push   %ebx
+  802743:	6a 0a                	push   $0xa
+  802745:	03 46 0c             	add    0xc(%esi),%eax
+  802748:	50                   	push   %eax
+  802749:	e8 96 e5 ff ff       	call   800ce4 <memfind>
+  80274e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  802751:	8b 46 0c             	mov    0xc(%esi),%eax
+  802754:	8b 4e 14             	mov    0x14(%esi),%ecx
+  802757:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  80275a:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  80275c:	83 c4 10             	add    $0x10,%esp
+  80275f:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802762:	74 0b                	je     80276f <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  802764:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802767:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80276a:	29 d3                	sub    %edx,%ebx
+  80276c:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  80276f:	83 ec 04             	sub    $0x4,%esp
+  802772:	53                   	push   %ebx
+  802773:	01 c8                	add    %ecx,%eax
+  802775:	50                   	push   %eax
+  802776:	89 f8                	mov    %edi,%eax
+  802778:	03 45 08             	add    0x8(%ebp),%eax
+  80277b:	50                   	push   %eax
+  80277c:	e8 b2 e4 ff ff       	call   800c33 <memmove>
+		f->f_rpos += m;
+  802781:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  802784:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  802786:	83 c4 10             	add    $0x10,%esp
+  802789:	8b 45 08             	mov    0x8(%ebp),%eax
+  80278c:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  802791:	74 1f                	je     8027b2 <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  802793:	8d 47 01             	lea    0x1(%edi),%eax
+  802796:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  802799:	73 17                	jae    8027b2 <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  80279b:	8b 46 18             	mov    0x18(%esi),%eax
+  80279e:	39 46 14             	cmp    %eax,0x14(%esi)
+  8027a1:	75 8a                	jne    80272d <fgets+0x1c>
+  8027a3:	89 f0                	mov    %esi,%eax
+  8027a5:	e8 c3 fc ff ff       	call   80246d <stream_fill>
+  8027aa:	85 c0                	test   %eax,%eax
+  8027ac:	0f 85 7b ff ff ff    	jne    80272d <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  8027b2:	85 ff                	test   %edi,%edi
+  8027b4:	74 0f                	je     8027c5 <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  8027b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027b9:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  8027bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027c0:	5b                   	pop    %ebx
+  8027c1:	5e                   	pop    %esi
+  8027c2:	5f                   	pop    %edi
+  8027c3:	5d                   	pop    %ebp
+  8027c4:	c3                   	ret
+		return 0;
+  8027c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027ca:	eb f1                	jmp    8027bd <fgets+0xac>
+
+008027cc <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  8027cc:	55                   	push   %ebp
+  8027cd:	89 e5                	mov    %esp,%ebp
+  8027cf:	57                   	push   %edi
+  8027d0:	56                   	push   %esi
+  8027d1:	53                   	push   %ebx
+  8027d2:	83 ec 1c             	sub    $0x1c,%esp
+  8027d5:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  8027d8:	89 f0                	mov    %esi,%eax
+  8027da:	e8 21 fc ff ff       	call   802400 <stream_setup>
+	want = size * n;
+  8027df:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8027e2:	0f af 45 10          	imul   0x10(%ebp),%eax
+  8027e6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  8027e9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027ee:	eb 43                	jmp    802833 <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  8027f0:	29 d3                	sub    %edx,%ebx
+  8027f2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8027f5:	29 f8                	sub    %edi,%eax
+  8027f7:	39 c3                	cmp    %eax,%ebx
+  8027f9:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  8027fc:	83 ec 04             	sub    $0x4,%esp
+  8027ff:	53                   	push   %ebx
+  802800:	03 56 0c             	add    0xc(%esi),%edx
+  802803:	52                   	push   %edx
+  802804:	89 f8                	mov    %edi,%eax
+  802806:	03 45 08             	add    0x8(%ebp),%eax
+  802809:	50                   	push   %eax
+  80280a:	e8 24 e4 ff ff       	call   800c33 <memmove>
+			f->f_rpos += m;
+  80280f:	01 5e 14             	add    %ebx,0x14(%esi)
+  802812:	83 c4 10             	add    $0x10,%esp
+  802815:	eb 1a                	jmp    802831 <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  802817:	83 ec 04             	sub    $0x4,%esp
+  80281a:	53                   	push   %ebx
+  80281b:	89 f8                	mov    %edi,%eax
+  80281d:	03 45 08             	add    0x8(%ebp),%eax
+  802820:	50                   	push   %eax
+  802821:	ff 36                	push   (%esi)
+  802823:	e8 72 ee ff ff       	call   80169a <read>
+  802828:	89 c3                	mov    %eax,%ebx
+  80282a:	83 c4 10             	add    $0x10,%esp
+  80282d:	85 c0                	test   %eax,%eax
+  80282f:	7e 36                	jle    802867 <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  802831:	01 df                	add    %ebx,%edi
+  802833:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802836:	39 c7                	cmp    %eax,%edi
+  802838:	73 39                	jae    802873 <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  80283a:	8b 56 14             	mov    0x14(%esi),%edx
+  80283d:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802840:	39 da                	cmp    %ebx,%edx
+  802842:	72 ac                	jb     8027f0 <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  802844:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802847:	29 fb                	sub    %edi,%ebx
+  802849:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  80284c:	72 3e                	jb     80288c <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  80284e:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  802852:	74 1f                	je     802873 <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  802854:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  802858:	74 bd                	je     802817 <fread+0x4b>
+  80285a:	89 f0                	mov    %esi,%eax
+  80285c:	e8 2f fb ff ff       	call   802390 <stream_drain>
+  802861:	85 c0                	test   %eax,%eax
+  802863:	79 b2                	jns    802817 <fread+0x4b>
+  802865:	eb 0c                	jmp    802873 <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802867:	c1 fb 1f             	sar    $0x1f,%ebx
+  80286a:	83 e3 04             	and    $0x4,%ebx
+  80286d:	83 c3 04             	add    $0x4,%ebx
+  802870:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  802873:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802876:	85 c0                	test   %eax,%eax
+  802878:	74 0a                	je     802884 <fread+0xb8>
+  80287a:	89 f8                	mov    %edi,%eax
+  80287c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802881:	f7 75 0c             	divl   0xc(%ebp)
+}
+  802884:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802887:	5b                   	pop    %ebx
+  802888:	5e                   	pop    %esi
+  802889:	5f                   	pop    %edi
+  80288a:	5d                   	pop    %ebp
+  80288b:	c3                   	ret
+		} else if (!stream_fill(f))
+  80288c:	89 f0                	mov    %esi,%eax
+  80288e:	e8 da fb ff ff       	call   80246d <stream_fill>
+  802893:	85 c0                	test   %eax,%eax
+  802895:	74 dc                	je     802873 <fread+0xa7>
+			m = 0;
+  802897:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80289c:	eb 93                	jmp    802831 <fread+0x65>
+
+0080289e <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  80289e:	55                   	push   %ebp
+  80289f:	89 e5                	mov    %esp,%ebp
+  8028a1:	57                   	push   %edi
+  8028a2:	56                   	push   %esi
+  8028a3:	53                   	push   %ebx
+  8028a4:	83 ec 1c             	sub    $0x1c,%esp
+  8028a7:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  8028aa:	8b 43 04             	mov    0x4(%ebx),%eax
+  8028ad:	a8 02                	test   $0x2,%al
+  8028af:	75 13                	jne    8028c4 <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  8028b1:	83 c8 08             	or     $0x8,%eax
+  8028b4:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  8028b7:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  8028bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028bf:	5b                   	pop    %ebx
+  8028c0:	5e                   	pop    %esi
+  8028c1:	5f                   	pop    %edi
+  8028c2:	5d                   	pop    %ebp
+  8028c3:	c3                   	ret
+	stream_setup(f);
+  8028c4:	89 d8                	mov    %ebx,%eax
+  8028c6:	e8 35 fb ff ff       	call   802400 <stream_setup>
+	want = size * n;
+  8028cb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8028ce:	0f af 45 10          	imul   0x10(%ebp),%eax
+  8028d2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  8028d5:	89 d8                	mov    %ebx,%eax
+  8028d7:	e8 41 fa ff ff       	call   80231d <stream_unread>
+	for (done = 0; done < want; ) {
+  8028dc:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  8028e1:	84 c0                	test   %al,%al
+  8028e3:	75 7b                	jne    802960 <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  8028e5:	be 00 00 00 00       	mov    $0x0,%esi
+  8028ea:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8028ed:	39 fe                	cmp    %edi,%esi
+  8028ef:	73 24                	jae    802915 <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  8028f1:	83 ec 04             	sub    $0x4,%esp
+  8028f4:	89 f8                	mov    %edi,%eax
+  8028f6:	29 f0                	sub    %esi,%eax
+  8028f8:	50                   	push   %eax
+  8028f9:	89 f0                	mov    %esi,%eax
+  8028fb:	03 45 08             	add    0x8(%ebp),%eax
+  8028fe:	50                   	push   %eax
+  8028ff:	ff 33                	push   (%ebx)
+  802901:	e8 8c ee ff ff       	call   801792 <write>
+  802906:	83 c4 10             	add    $0x10,%esp
+  802909:	85 c0                	test   %eax,%eax
+  80290b:	7e 04                	jle    802911 <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  80290d:	01 c6                	add    %eax,%esi
+  80290f:	eb dc                	jmp    8028ed <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  802911:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  802915:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802918:	85 c0                	test   %eax,%eax
+  80291a:	74 a0                	je     8028bc <fwrite+0x1e>
+  80291c:	89 f0                	mov    %esi,%eax
+  80291e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802923:	f7 75 0c             	divl   0xc(%ebp)
+  802926:	eb 94                	jmp    8028bc <fwrite+0x1e>
+			done += r;
+  802928:	01 c7                	add    %eax,%edi
+			continue;
+  80292a:	eb 34                	jmp    802960 <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  80292c:	8b 73 10             	mov    0x10(%ebx),%esi
+  80292f:	29 c6                	sub    %eax,%esi
+  802931:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802934:	29 fa                	sub    %edi,%edx
+  802936:	39 d6                	cmp    %edx,%esi
+  802938:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  80293b:	83 ec 04             	sub    $0x4,%esp
+  80293e:	56                   	push   %esi
+  80293f:	89 fa                	mov    %edi,%edx
+  802941:	03 55 08             	add    0x8(%ebp),%edx
+  802944:	52                   	push   %edx
+  802945:	03 43 0c             	add    0xc(%ebx),%eax
+  802948:	50                   	push   %eax
+  802949:	e8 e5 e2 ff ff       	call   800c33 <memmove>
+		f->f_wend += m;
+  80294e:	89 f0                	mov    %esi,%eax
+  802950:	03 43 1c             	add    0x1c(%ebx),%eax
+  802953:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  802956:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802958:	83 c4 10             	add    $0x10,%esp
+  80295b:	3b 43 10             	cmp    0x10(%ebx),%eax
+  80295e:	74 5b                	je     8029bb <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  802960:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802963:	39 c7                	cmp    %eax,%edi
+  802965:	73 2d                	jae    802994 <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  802967:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  80296a:	85 c0                	test   %eax,%eax
+  80296c:	75 be                	jne    80292c <fwrite+0x8e>
+  80296e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802971:	29 fa                	sub    %edi,%edx
+  802973:	3b 53 10             	cmp    0x10(%ebx),%edx
+  802976:	72 b4                	jb     80292c <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802978:	83 ec 04             	sub    $0x4,%esp
+  80297b:	52                   	push   %edx
+  80297c:	89 f8                	mov    %edi,%eax
+  80297e:	03 45 08             	add    0x8(%ebp),%eax
+  802981:	50                   	push   %eax
+  802982:	ff 33                	push   (%ebx)
+  802984:	e8 09 ee ff ff       	call   801792 <write>
+  802989:	83 c4 10             	add    $0x10,%esp
+  80298c:	85 c0                	test   %eax,%eax
+  80298e:	7f 98                	jg     802928 <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  802990:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  802994:	8b 43 08             	mov    0x8(%ebx),%eax
+  802997:	83 f8 03             	cmp    $0x3,%eax
+  80299a:	74 48                	je     8029e4 <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  80299c:	83 f8 02             	cmp    $0x2,%eax
+  80299f:	74 27                	je     8029c8 <fwrite+0x12a>
+	return size ? done / size : 0;
+  8029a1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8029a4:	85 c0                	test   %eax,%eax
+  8029a6:	0f 84 10 ff ff ff    	je     8028bc <fwrite+0x1e>
+  8029ac:	89 f8                	mov    %edi,%eax
+  8029ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029b3:	f7 75 0c             	divl   0xc(%ebp)
+  8029b6:	e9 01 ff ff ff       	jmp    8028bc <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  8029bb:	89 d8                	mov    %ebx,%eax
+  8029bd:	e8 ce f9 ff ff       	call   802390 <stream_drain>
+  8029c2:	85 c0                	test   %eax,%eax
+  8029c4:	79 9a                	jns    802960 <fwrite+0xc2>
+  8029c6:	eb cc                	jmp    802994 <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  8029c8:	83 ec 04             	sub    $0x4,%esp
+  8029cb:	57                   	push   %edi
+  8029cc:	6a 0a                	push   $0xa
+  8029ce:	ff 75 08             	push   0x8(%ebp)
+  8029d1:	e8 0e e3 ff ff       	call   800ce4 <memfind>
+  8029d6:	89 c2                	mov    %eax,%edx
+  8029d8:	89 f8                	mov    %edi,%eax
+  8029da:	03 45 08             	add    0x8(%ebp),%eax
+  8029dd:	83 c4 10             	add    $0x10,%esp
+  8029e0:	39 c2                	cmp    %eax,%edx
+  8029e2:	74 bd                	je     8029a1 <fwrite+0x103>
+		stream_drain(f);
+  8029e4:	89 d8                	mov    %ebx,%eax
+  8029e6:	e8 a5 f9 ff ff       	call   802390 <stream_drain>
+  8029eb:	eb b4                	jmp    8029a1 <fwrite+0x103>
+
+008029ed <fputc>:
+{
+  8029ed:	55                   	push   %ebp
+  8029ee:	89 e5                	mov    %esp,%ebp
+  8029f0:	53                   	push   %ebx
+  8029f1:	83 ec 14             	sub    $0x14,%esp
+  8029f4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  8029f7:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  8029fa:	ff 75 0c             	push   0xc(%ebp)
+  8029fd:	6a 01                	push   $0x1
+  8029ff:	6a 01                	push   $0x1
+  802a01:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802a04:	50                   	push   %eax
+  802a05:	e8 94 fe ff ff       	call   80289e <fwrite>
+  802a0a:	83 c4 10             	add    $0x10,%esp
+  802a0d:	0f b6 db             	movzbl %bl,%ebx
+  802a10:	83 f8 01             	cmp    $0x1,%eax
+  802a13:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802a18:	0f 44 c3             	cmove  %ebx,%eax
+}
+  802a1b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a1e:	c9                   	leave
+  802a1f:	c3                   	ret
+
+00802a20 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  802a20:	55                   	push   %ebp
+  802a21:	89 e5                	mov    %esp,%ebp
+  802a23:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  802a26:	ff 75 0c             	push   0xc(%ebp)
+  802a29:	ff 75 08             	push   0x8(%ebp)
+  802a2c:	e8 bc ff ff ff       	call   8029ed <fputc>
+}
+  802a31:	83 c4 10             	add    $0x10,%esp
+  802a34:	c9                   	leave
+  802a35:	c3                   	ret
+
+00802a36 <fputs>:
+{
+  802a36:	55                   	push   %ebp
+  802a37:	89 e5                	mov    %esp,%ebp
+  802a39:	56                   	push   %esi
+  802a3a:	53                   	push   %ebx
+  802a3b:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  802a3e:	83 ec 0c             	sub    $0xc,%esp
+  802a41:	56                   	push   %esi
+  802a42:	e8 2b e0 ff ff       	call   800a72 <strlen>
+  802a47:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  802a49:	ff 75 0c             	push   0xc(%ebp)
+  802a4c:	50                   	push   %eax
+  802a4d:	6a 01                	push   $0x1
+  802a4f:	56                   	push   %esi
+  802a50:	e8 49 fe ff ff       	call   80289e <fwrite>
+  802a55:	83 c4 20             	add    $0x20,%esp
+  802a58:	39 d8                	cmp    %ebx,%eax
+  802a5a:	0f 95 c0             	setne  %al
+  802a5d:	0f b6 c0             	movzbl %al,%eax
+  802a60:	f7 d8                	neg    %eax
+}
+  802a62:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a65:	5b                   	pop    %ebx
+  802a66:	5e                   	pop    %esi
+  802a67:	5d                   	pop    %ebp
+  802a68:	c3                   	ret
+
+00802a69 <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  802a69:	55                   	push   %ebp
+  802a6a:	89 e5                	mov    %esp,%ebp
+  802a6c:	53                   	push   %ebx
+  802a6d:	83 ec 04             	sub    $0x4,%esp
+  802a70:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802a73:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  802a76:	50                   	push   %eax
+  802a77:	ff 75 0c             	push   0xc(%ebp)
+  802a7a:	53                   	push   %ebx
+  802a7b:	68 20 2a 80 00       	push   $0x802a20
+  802a80:	e8 4b da ff ff       	call   8004d0 <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  802a85:	8b 43 04             	mov    0x4(%ebx),%eax
+  802a88:	c1 e0 1c             	shl    $0x1c,%eax
+  802a8b:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  802a8e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a91:	c9                   	leave
+  802a92:	c3                   	ret
+
+00802a93 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802a93:	55                   	push   %ebp
+  802a94:	89 e5                	mov    %esp,%ebp
+  802a96:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802a99:	68 a8 4e 80 00       	push   $0x804ea8
+  802a9e:	ff 75 0c             	push   0xc(%ebp)
+  802aa1:	e8 07 e0 ff ff       	call   800aad <strcpy>
+	return 0;
+}
+  802aa6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aab:	c9                   	leave
+  802aac:	c3                   	ret
+
+00802aad <devsock_close>:
+{
+  802aad:	55                   	push   %ebp
+  802aae:	89 e5                	mov    %esp,%ebp
+  802ab0:	53                   	push   %ebx
+  802ab1:	83 ec 10             	sub    $0x10,%esp
+  802ab4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802ab7:	53                   	push   %ebx
+  802ab8:	e8 af 1b 00 00       	call   80466c <pageref>
+  802abd:	89 c2                	mov    %eax,%edx
+  802abf:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802ac2:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802ac7:	83 fa 01             	cmp    $0x1,%edx
+  802aca:	74 05                	je     802ad1 <devsock_close+0x24>
+}
+  802acc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802acf:	c9                   	leave
+  802ad0:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802ad1:	83 ec 0c             	sub    $0xc,%esp
+  802ad4:	ff 73 0c             	push   0xc(%ebx)
+  802ad7:	e8 b7 02 00 00       	call   802d93 <nsipc_close>
+  802adc:	83 c4 10             	add    $0x10,%esp
+  802adf:	eb eb                	jmp    802acc <devsock_close+0x1f>
+
+00802ae1 <devsock_write>:
+{
+  802ae1:	55                   	push   %ebp
+  802ae2:	89 e5                	mov    %esp,%ebp
+  802ae4:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802ae7:	6a 00                	push   $0x0
+  802ae9:	ff 75 10             	push   0x10(%ebp)
+  802aec:	ff 75 0c             	push   0xc(%ebp)
+  802aef:	8b 45 08             	mov    0x8(%ebp),%eax
+  802af2:	ff 70 0c             	push   0xc(%eax)
+  802af5:	e8 79 03 00 00       	call   802e73 <nsipc_send>
+}
+  802afa:	c9                   	leave
+  802afb:	c3                   	ret
+
+00802afc <devsock_read>:
+{
+  802afc:	55                   	push   %ebp
+  802afd:	89 e5                	mov    %esp,%ebp
+  802aff:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802b02:	6a 00                	push   $0x0
+  802b04:	ff 75 10             	push   0x10(%ebp)
+  802b07:	ff 75 0c             	push   0xc(%ebp)
+  802b0a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b0d:	ff 70 0c             	push   0xc(%eax)
+  802b10:	e8 ef 02 00 00       	call   802e04 <nsipc_recv>
+}
+  802b15:	c9                   	leave
+  802b16:	c3                   	ret
+
+00802b17 <fd2sockid>:
+{
+  802b17:	55                   	push   %ebp
+  802b18:	89 e5                	mov    %esp,%ebp
+  802b1a:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802b1d:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802b20:	52                   	push   %edx
+  802b21:	50                   	push   %eax
+  802b22:	e8 e3 e8 ff ff       	call   80140a <fd_lookup>
+  802b27:	83 c4 10             	add    $0x10,%esp
+  802b2a:	85 c0                	test   %eax,%eax
+  802b2c:	78 10                	js     802b3e <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802b2e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b31:	8b 0d 80 62 80 00    	mov    0x806280,%ecx
+  802b37:	39 08                	cmp    %ecx,(%eax)
+  802b39:	75 05                	jne    802b40 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802b3b:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802b3e:	c9                   	leave
+  802b3f:	c3                   	ret
+		return -E_NOT_SUPP;
+  802b40:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802b45:	eb f7                	jmp    802b3e <fd2sockid+0x27>
+
+00802b47 <alloc_sockfd>:
+{
+  802b47:	55                   	push   %ebp
+  802b48:	89 e5                	mov    %esp,%ebp
+  802b4a:	56                   	push   %esi
+  802b4b:	53                   	push   %ebx
+  802b4c:	83 ec 1c             	sub    $0x1c,%esp
+  802b4f:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802b51:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b54:	50                   	push   %eax
+  802b55:	e8 5a e8 ff ff       	call   8013b4 <fd_alloc>
+  802b5a:	89 c3                	mov    %eax,%ebx
+  802b5c:	83 c4 10             	add    $0x10,%esp
+  802b5f:	85 c0                	test   %eax,%eax
+  802b61:	78 43                	js     802ba6 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802b63:	83 ec 04             	sub    $0x4,%esp
+  802b66:	68 07 04 00 00       	push   $0x407
+  802b6b:	ff 75 f4             	push   -0xc(%ebp)
+  802b6e:	6a 00                	push   $0x0
+  802b70:	e8 76 e3 ff ff       	call   800eeb <sys_page_alloc>
+  802b75:	89 c3                	mov    %eax,%ebx
+  802b77:	83 c4 10             	add    $0x10,%esp
+  802b7a:	85 c0                	test   %eax,%eax
+  802b7c:	78 28                	js     802ba6 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802b7e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b81:	8b 15 80 62 80 00    	mov    0x806280,%edx
+  802b87:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802b89:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b8c:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802b93:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802b96:	83 ec 0c             	sub    $0xc,%esp
+  802b99:	50                   	push   %eax
+  802b9a:	e8 ee e7 ff ff       	call   80138d <fd2num>
+  802b9f:	89 c3                	mov    %eax,%ebx
+  802ba1:	83 c4 10             	add    $0x10,%esp
+  802ba4:	eb 0c                	jmp    802bb2 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802ba6:	83 ec 0c             	sub    $0xc,%esp
+  802ba9:	56                   	push   %esi
+  802baa:	e8 e4 01 00 00       	call   802d93 <nsipc_close>
+		return r;
+  802baf:	83 c4 10             	add    $0x10,%esp
+}
+  802bb2:	89 d8                	mov    %ebx,%eax
+  802bb4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802bb7:	5b                   	pop    %ebx
+  802bb8:	5e                   	pop    %esi
+  802bb9:	5d                   	pop    %ebp
+  802bba:	c3                   	ret
+
+00802bbb <accept>:
+{
+  802bbb:	55                   	push   %ebp
+  802bbc:	89 e5                	mov    %esp,%ebp
+  802bbe:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802bc1:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bc4:	e8 4e ff ff ff       	call   802b17 <fd2sockid>
+  802bc9:	85 c0                	test   %eax,%eax
+  802bcb:	78 1b                	js     802be8 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802bcd:	83 ec 04             	sub    $0x4,%esp
+  802bd0:	ff 75 10             	push   0x10(%ebp)
+  802bd3:	ff 75 0c             	push   0xc(%ebp)
+  802bd6:	50                   	push   %eax
+  802bd7:	e8 0e 01 00 00       	call   802cea <nsipc_accept>
+  802bdc:	83 c4 10             	add    $0x10,%esp
+  802bdf:	85 c0                	test   %eax,%eax
+  802be1:	78 05                	js     802be8 <accept+0x2d>
+	return alloc_sockfd(r);
+  802be3:	e8 5f ff ff ff       	call   802b47 <alloc_sockfd>
+}
+  802be8:	c9                   	leave
+  802be9:	c3                   	ret
+
+00802bea <bind>:
+{
+  802bea:	55                   	push   %ebp
+  802beb:	89 e5                	mov    %esp,%ebp
+  802bed:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802bf0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bf3:	e8 1f ff ff ff       	call   802b17 <fd2sockid>
+  802bf8:	85 c0                	test   %eax,%eax
+  802bfa:	78 12                	js     802c0e <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802bfc:	83 ec 04             	sub    $0x4,%esp
+  802bff:	ff 75 10             	push   0x10(%ebp)
+  802c02:	ff 75 0c             	push   0xc(%ebp)
+  802c05:	50                   	push   %eax
+  802c06:	e8 31 01 00 00       	call   802d3c <nsipc_bind>
+  802c0b:	83 c4 10             	add    $0x10,%esp
+}
+  802c0e:	c9                   	leave
+  802c0f:	c3                   	ret
+
+00802c10 <shutdown>:
+{
+  802c10:	55                   	push   %ebp
+  802c11:	89 e5                	mov    %esp,%ebp
+  802c13:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c16:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c19:	e8 f9 fe ff ff       	call   802b17 <fd2sockid>
+  802c1e:	85 c0                	test   %eax,%eax
+  802c20:	78 0f                	js     802c31 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802c22:	83 ec 08             	sub    $0x8,%esp
+  802c25:	ff 75 0c             	push   0xc(%ebp)
+  802c28:	50                   	push   %eax
+  802c29:	e8 43 01 00 00       	call   802d71 <nsipc_shutdown>
+  802c2e:	83 c4 10             	add    $0x10,%esp
+}
+  802c31:	c9                   	leave
+  802c32:	c3                   	ret
+
+00802c33 <connect>:
+{
+  802c33:	55                   	push   %ebp
+  802c34:	89 e5                	mov    %esp,%ebp
+  802c36:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c39:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c3c:	e8 d6 fe ff ff       	call   802b17 <fd2sockid>
+  802c41:	85 c0                	test   %eax,%eax
+  802c43:	78 12                	js     802c57 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802c45:	83 ec 04             	sub    $0x4,%esp
+  802c48:	ff 75 10             	push   0x10(%ebp)
+  802c4b:	ff 75 0c             	push   0xc(%ebp)
+  802c4e:	50                   	push   %eax
+  802c4f:	e8 59 01 00 00       	call   802dad <nsipc_connect>
+  802c54:	83 c4 10             	add    $0x10,%esp
+}
+  802c57:	c9                   	leave
+  802c58:	c3                   	ret
+
+00802c59 <listen>:
+{
+  802c59:	55                   	push   %ebp
+  802c5a:	89 e5                	mov    %esp,%ebp
+  802c5c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c5f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c62:	e8 b0 fe ff ff       	call   802b17 <fd2sockid>
+  802c67:	85 c0                	test   %eax,%eax
+  802c69:	78 0f                	js     802c7a <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802c6b:	83 ec 08             	sub    $0x8,%esp
+  802c6e:	ff 75 0c             	push   0xc(%ebp)
+  802c71:	50                   	push   %eax
+  802c72:	e8 6b 01 00 00       	call   802de2 <nsipc_listen>
+  802c77:	83 c4 10             	add    $0x10,%esp
+}
+  802c7a:	c9                   	leave
+  802c7b:	c3                   	ret
+
+00802c7c <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802c7c:	55                   	push   %ebp
+  802c7d:	89 e5                	mov    %esp,%ebp
+  802c7f:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802c82:	ff 75 10             	push   0x10(%ebp)
+  802c85:	ff 75 0c             	push   0xc(%ebp)
+  802c88:	ff 75 08             	push   0x8(%ebp)
+  802c8b:	e8 41 02 00 00       	call   802ed1 <nsipc_socket>
+  802c90:	83 c4 10             	add    $0x10,%esp
+  802c93:	85 c0                	test   %eax,%eax
+  802c95:	78 05                	js     802c9c <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802c97:	e8 ab fe ff ff       	call   802b47 <alloc_sockfd>
+}
+  802c9c:	c9                   	leave
+  802c9d:	c3                   	ret
+
+00802c9e <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802c9e:	55                   	push   %ebp
+  802c9f:	89 e5                	mov    %esp,%ebp
+  802ca1:	53                   	push   %ebx
+  802ca2:	83 ec 04             	sub    $0x4,%esp
+  802ca5:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802ca7:	83 3d 08 74 80 00 00 	cmpl   $0x0,0x807408
+  802cae:	74 26                	je     802cd6 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802cb0:	6a 07                	push   $0x7
+  802cb2:	68 00 90 80 00       	push   $0x809000
+  802cb7:	53                   	push   %ebx
+  802cb8:	ff 35 08 74 80 00    	push   0x807408
+  802cbe:	e8 14 19 00 00       	call   8045d7 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802cc3:	83 c4 0c             	add    $0xc,%esp
+  802cc6:	6a 00                	push   $0x0
+  802cc8:	6a 00                	push   $0x0
+  802cca:	6a 00                	push   $0x0
+  802ccc:	e8 10 18 00 00       	call   8044e1 <ipc_recv>
+}
+  802cd1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802cd4:	c9                   	leave
+  802cd5:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802cd6:	83 ec 0c             	sub    $0xc,%esp
+  802cd9:	6a 02                	push   $0x2
+  802cdb:	e8 4d 19 00 00       	call   80462d <ipc_find_env>
+  802ce0:	a3 08 74 80 00       	mov    %eax,0x807408
+  802ce5:	83 c4 10             	add    $0x10,%esp
+  802ce8:	eb c6                	jmp    802cb0 <nsipc+0x12>
+
+00802cea <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802cea:	55                   	push   %ebp
+  802ceb:	89 e5                	mov    %esp,%ebp
+  802ced:	56                   	push   %esi
+  802cee:	53                   	push   %ebx
+  802cef:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802cf2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cf5:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802cfa:	8b 06                	mov    (%esi),%eax
+  802cfc:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802d01:	b8 01 00 00 00       	mov    $0x1,%eax
+  802d06:	e8 93 ff ff ff       	call   802c9e <nsipc>
+  802d0b:	89 c3                	mov    %eax,%ebx
+  802d0d:	85 c0                	test   %eax,%eax
+  802d0f:	79 09                	jns    802d1a <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802d11:	89 d8                	mov    %ebx,%eax
+  802d13:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d16:	5b                   	pop    %ebx
+  802d17:	5e                   	pop    %esi
+  802d18:	5d                   	pop    %ebp
+  802d19:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802d1a:	83 ec 04             	sub    $0x4,%esp
+  802d1d:	ff 35 10 90 80 00    	push   0x809010
+  802d23:	68 00 90 80 00       	push   $0x809000
+  802d28:	ff 75 0c             	push   0xc(%ebp)
+  802d2b:	e8 03 df ff ff       	call   800c33 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802d30:	a1 10 90 80 00       	mov    0x809010,%eax
+  802d35:	89 06                	mov    %eax,(%esi)
+  802d37:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802d3a:	eb d5                	jmp    802d11 <nsipc_accept+0x27>
+
+00802d3c <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802d3c:	55                   	push   %ebp
+  802d3d:	89 e5                	mov    %esp,%ebp
+  802d3f:	53                   	push   %ebx
+  802d40:	83 ec 08             	sub    $0x8,%esp
+  802d43:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802d46:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d49:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802d4e:	53                   	push   %ebx
+  802d4f:	ff 75 0c             	push   0xc(%ebp)
+  802d52:	68 04 90 80 00       	push   $0x809004
+  802d57:	e8 d7 de ff ff       	call   800c33 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802d5c:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  802d62:	b8 02 00 00 00       	mov    $0x2,%eax
+  802d67:	e8 32 ff ff ff       	call   802c9e <nsipc>
+}
+  802d6c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d6f:	c9                   	leave
+  802d70:	c3                   	ret
+
+00802d71 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802d71:	55                   	push   %ebp
+  802d72:	89 e5                	mov    %esp,%ebp
+  802d74:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802d77:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d7a:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  802d7f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d82:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  802d87:	b8 03 00 00 00       	mov    $0x3,%eax
+  802d8c:	e8 0d ff ff ff       	call   802c9e <nsipc>
+}
+  802d91:	c9                   	leave
+  802d92:	c3                   	ret
+
+00802d93 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802d93:	55                   	push   %ebp
+  802d94:	89 e5                	mov    %esp,%ebp
+  802d96:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802d99:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d9c:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  802da1:	b8 04 00 00 00       	mov    $0x4,%eax
+  802da6:	e8 f3 fe ff ff       	call   802c9e <nsipc>
+}
+  802dab:	c9                   	leave
+  802dac:	c3                   	ret
+
+00802dad <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802dad:	55                   	push   %ebp
+  802dae:	89 e5                	mov    %esp,%ebp
+  802db0:	53                   	push   %ebx
+  802db1:	83 ec 08             	sub    $0x8,%esp
+  802db4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802db7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dba:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802dbf:	53                   	push   %ebx
+  802dc0:	ff 75 0c             	push   0xc(%ebp)
+  802dc3:	68 04 90 80 00       	push   $0x809004
+  802dc8:	e8 66 de ff ff       	call   800c33 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802dcd:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  802dd3:	b8 05 00 00 00       	mov    $0x5,%eax
+  802dd8:	e8 c1 fe ff ff       	call   802c9e <nsipc>
+}
+  802ddd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802de0:	c9                   	leave
+  802de1:	c3                   	ret
+
+00802de2 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802de2:	55                   	push   %ebp
+  802de3:	89 e5                	mov    %esp,%ebp
+  802de5:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802de8:	8b 45 08             	mov    0x8(%ebp),%eax
+  802deb:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  802df0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802df3:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  802df8:	b8 06 00 00 00       	mov    $0x6,%eax
+  802dfd:	e8 9c fe ff ff       	call   802c9e <nsipc>
+}
+  802e02:	c9                   	leave
+  802e03:	c3                   	ret
+
+00802e04 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802e04:	55                   	push   %ebp
+  802e05:	89 e5                	mov    %esp,%ebp
+  802e07:	56                   	push   %esi
+  802e08:	53                   	push   %ebx
+  802e09:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802e0c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e0f:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  802e14:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  802e1a:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e1d:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802e22:	b8 07 00 00 00       	mov    $0x7,%eax
+  802e27:	e8 72 fe ff ff       	call   802c9e <nsipc>
+  802e2c:	89 c3                	mov    %eax,%ebx
+  802e2e:	85 c0                	test   %eax,%eax
+  802e30:	78 22                	js     802e54 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802e32:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802e37:	39 c6                	cmp    %eax,%esi
+  802e39:	0f 4e c6             	cmovle %esi,%eax
+  802e3c:	39 c3                	cmp    %eax,%ebx
+  802e3e:	7f 1d                	jg     802e5d <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802e40:	83 ec 04             	sub    $0x4,%esp
+  802e43:	53                   	push   %ebx
+  802e44:	68 00 90 80 00       	push   $0x809000
+  802e49:	ff 75 0c             	push   0xc(%ebp)
+  802e4c:	e8 e2 dd ff ff       	call   800c33 <memmove>
+  802e51:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802e54:	89 d8                	mov    %ebx,%eax
+  802e56:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e59:	5b                   	pop    %ebx
+  802e5a:	5e                   	pop    %esi
+  802e5b:	5d                   	pop    %ebp
+  802e5c:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802e5d:	68 b4 4e 80 00       	push   $0x804eb4
+  802e62:	68 6d 4e 80 00       	push   $0x804e6d
+  802e67:	6a 62                	push   $0x62
+  802e69:	68 c9 4e 80 00       	push   $0x804ec9
+  802e6e:	e8 8b d4 ff ff       	call   8002fe <_panic>
+
+00802e73 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802e73:	55                   	push   %ebp
+  802e74:	89 e5                	mov    %esp,%ebp
+  802e76:	53                   	push   %ebx
+  802e77:	83 ec 04             	sub    $0x4,%esp
+  802e7a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802e7d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e80:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  802e85:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802e8b:	7f 2e                	jg     802ebb <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802e8d:	83 ec 04             	sub    $0x4,%esp
+  802e90:	53                   	push   %ebx
+  802e91:	ff 75 0c             	push   0xc(%ebp)
+  802e94:	68 0c 90 80 00       	push   $0x80900c
+  802e99:	e8 95 dd ff ff       	call   800c33 <memmove>
+	nsipcbuf.send.req_size = size;
+  802e9e:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  802ea4:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ea7:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  802eac:	b8 08 00 00 00       	mov    $0x8,%eax
+  802eb1:	e8 e8 fd ff ff       	call   802c9e <nsipc>
+}
+  802eb6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802eb9:	c9                   	leave
+  802eba:	c3                   	ret
+	assert(size < 1600);
+  802ebb:	68 d5 4e 80 00       	push   $0x804ed5
+  802ec0:	68 6d 4e 80 00       	push   $0x804e6d
+  802ec5:	6a 6d                	push   $0x6d
+  802ec7:	68 c9 4e 80 00       	push   $0x804ec9
+  802ecc:	e8 2d d4 ff ff       	call   8002fe <_panic>
+
+00802ed1 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802ed1:	55                   	push   %ebp
+  802ed2:	89 e5                	mov    %esp,%ebp
+  802ed4:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802ed7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802eda:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  802edf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ee2:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  802ee7:	8b 45 10             	mov    0x10(%ebp),%eax
+  802eea:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  802eef:	b8 09 00 00 00       	mov    $0x9,%eax
+  802ef4:	e8 a5 fd ff ff       	call   802c9e <nsipc>
+}
+  802ef9:	c9                   	leave
+  802efa:	c3                   	ret
+
+00802efb <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  802efb:	55                   	push   %ebp
+  802efc:	89 e5                	mov    %esp,%ebp
+  802efe:	53                   	push   %ebx
+  802eff:	83 ec 10             	sub    $0x10,%esp
+  802f02:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  802f05:	68 0c 74 80 00       	push   $0x80740c
+  802f0a:	e8 50 07 00 00       	call   80365f <mutex_lock>
+	if (v == 0)
+  802f0f:	83 c4 10             	add    $0x10,%esp
+  802f12:	85 db                	test   %ebx,%ebx
+  802f14:	0f 84 85 00 00 00    	je     802f9f <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802f1a:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802f20:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802f25:	77 51                	ja     802f78 <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  802f27:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  802f2d:	89 d8                	mov    %ebx,%eax
+  802f2f:	c1 e8 0c             	shr    $0xc,%eax
+  802f32:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802f39:	f6 c4 02             	test   $0x2,%ah
+  802f3c:	74 50                	je     802f8e <free+0x93>
+		sys_page_unmap(0, c);
+  802f3e:	83 ec 08             	sub    $0x8,%esp
+  802f41:	53                   	push   %ebx
+  802f42:	6a 00                	push   $0x0
+  802f44:	e8 3b e0 ff ff       	call   800f84 <sys_page_unmap>
+		c += PGSIZE;
+  802f49:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  802f4f:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802f55:	83 c4 10             	add    $0x10,%esp
+  802f58:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802f5d:	76 ce                	jbe    802f2d <free+0x32>
+  802f5f:	68 1f 4f 80 00       	push   $0x804f1f
+  802f64:	68 6d 4e 80 00       	push   $0x804e6d
+  802f69:	68 82 00 00 00       	push   $0x82
+  802f6e:	68 12 4f 80 00       	push   $0x804f12
+  802f73:	e8 86 d3 ff ff       	call   8002fe <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802f78:	68 e4 4e 80 00       	push   $0x804ee4
+  802f7d:	68 6d 4e 80 00       	push   $0x804e6d
+  802f82:	6a 7b                	push   $0x7b
+  802f84:	68 12 4f 80 00       	push   $0x804f12
+  802f89:	e8 70 d3 ff ff       	call   8002fe <_panic>
+	if (--(*ref) == 0)
+  802f8e:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  802f94:	83 e8 01             	sub    $0x1,%eax
+  802f97:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  802f9d:	74 15                	je     802fb4 <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  802f9f:	83 ec 0c             	sub    $0xc,%esp
+  802fa2:	68 0c 74 80 00       	push   $0x80740c
+  802fa7:	e8 20 07 00 00       	call   8036cc <mutex_unlock>
+}
+  802fac:	83 c4 10             	add    $0x10,%esp
+  802faf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802fb2:	c9                   	leave
+  802fb3:	c3                   	ret
+		sys_page_unmap(0, c);
+  802fb4:	83 ec 08             	sub    $0x8,%esp
+  802fb7:	53                   	push   %ebx
+  802fb8:	6a 00                	push   $0x0
+  802fba:	e8 c5 df ff ff       	call   800f84 <sys_page_unmap>
+  802fbf:	83 c4 10             	add    $0x10,%esp
+  802fc2:	eb db                	jmp    802f9f <free+0xa4>
+
+00802fc4 <malloc>:
+{
+  802fc4:	55                   	push   %ebp
+  802fc5:	89 e5                	mov    %esp,%ebp
+  802fc7:	57                   	push   %edi
+  802fc8:	56                   	push   %esi
+  802fc9:	53                   	push   %ebx
+  802fca:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  802fcd:	68 0c 74 80 00       	push   $0x80740c
+  802fd2:	e8 88 06 00 00       	call   80365f <mutex_lock>
+	if (mptr == 0)
+  802fd7:	8b 3d 10 74 80 00    	mov    0x807410,%edi
+  802fdd:	83 c4 10             	add    $0x10,%esp
+  802fe0:	85 ff                	test   %edi,%edi
+  802fe2:	74 6c                	je     803050 <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  802fe4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fe7:	83 c0 03             	add    $0x3,%eax
+  802fea:	83 e0 fc             	and    $0xfffffffc,%eax
+  802fed:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  802fef:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  802ff4:	0f 87 64 01 00 00    	ja     80315e <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  802ffa:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803000:	74 30                	je     803032 <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  803002:	89 f9                	mov    %edi,%ecx
+  803004:	c1 e9 0c             	shr    $0xc,%ecx
+  803007:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  80300b:	c1 e8 0c             	shr    $0xc,%eax
+  80300e:	39 c1                	cmp    %eax,%ecx
+  803010:	74 5f                	je     803071 <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  803012:	83 ec 0c             	sub    $0xc,%esp
+  803015:	57                   	push   %edi
+  803016:	e8 e0 fe ff ff       	call   802efb <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  80301b:	a1 10 74 80 00       	mov    0x807410,%eax
+  803020:	05 00 10 00 00       	add    $0x1000,%eax
+  803025:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80302a:	a3 10 74 80 00       	mov    %eax,0x807410
+  80302f:	83 c4 10             	add    $0x10,%esp
+  803032:	8b 0d 10 74 80 00    	mov    0x807410,%ecx
+{
+  803038:	ba 02 00 00 00       	mov    $0x2,%edx
+  80303d:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  803041:	8d 7e 04             	lea    0x4(%esi),%edi
+  803044:	89 cb                	mov    %ecx,%ebx
+  803046:	01 f9                	add    %edi,%ecx
+  803048:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  80304b:	e9 8b 00 00 00       	jmp    8030db <malloc+0x117>
+		mptr = mbegin;
+  803050:	c7 05 10 74 80 00 00 	movl   $0x8000000,0x807410
+  803057:	00 00 08 
+	n = ROUNDUP(n, 4);
+  80305a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80305d:	83 c0 03             	add    $0x3,%eax
+  803060:	83 e0 fc             	and    $0xfffffffc,%eax
+  803063:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  803065:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  80306a:	76 c6                	jbe    803032 <malloc+0x6e>
+  80306c:	e9 d6 00 00 00       	jmp    803147 <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  803071:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  803077:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  80307c:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  803080:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  803083:	a3 10 74 80 00       	mov    %eax,0x807410
+			return v;
+  803088:	e9 ba 00 00 00       	jmp    803147 <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  80308d:	05 00 10 00 00       	add    $0x1000,%eax
+  803092:	39 c8                	cmp    %ecx,%eax
+  803094:	0f 83 cb 00 00 00    	jae    803165 <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  80309a:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  80309f:	77 22                	ja     8030c3 <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  8030a1:	89 c2                	mov    %eax,%edx
+  8030a3:	c1 ea 16             	shr    $0x16,%edx
+  8030a6:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8030ad:	f6 c2 01             	test   $0x1,%dl
+  8030b0:	74 db                	je     80308d <malloc+0xc9>
+  8030b2:	89 c2                	mov    %eax,%edx
+  8030b4:	c1 ea 0c             	shr    $0xc,%edx
+  8030b7:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8030be:	f6 c2 01             	test   $0x1,%dl
+  8030c1:	74 ca                	je     80308d <malloc+0xc9>
+		if (mptr == mend) {
+  8030c3:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8030c9:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  8030cf:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  8030d3:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  8030d9:	74 04                	je     8030df <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  8030db:	89 d8                	mov    %ebx,%eax
+  8030dd:	eb b3                	jmp    803092 <malloc+0xce>
+  8030df:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  8030e2:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  8030e7:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  8030eb:	83 ea 01             	sub    $0x1,%edx
+  8030ee:	0f 85 50 ff ff ff    	jne    803044 <malloc+0x80>
+  8030f4:	c7 05 10 74 80 00 00 	movl   $0x8000000,0x807410
+  8030fb:	00 00 08 
+				return 0;	/* out of address space */
+  8030fe:	bf 00 00 00 00       	mov    $0x0,%edi
+  803103:	eb 42                	jmp    803147 <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  803105:	85 db                	test   %ebx,%ebx
+  803107:	78 1e                	js     803127 <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  803109:	83 ec 08             	sub    $0x8,%esp
+  80310c:	89 d8                	mov    %ebx,%eax
+  80310e:	03 05 10 74 80 00    	add    0x807410,%eax
+  803114:	50                   	push   %eax
+  803115:	6a 00                	push   $0x0
+  803117:	e8 68 de ff ff       	call   800f84 <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  80311c:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  803122:	83 c4 10             	add    $0x10,%esp
+  803125:	eb de                	jmp    803105 <malloc+0x141>
+			return 0;	/* out of physical memory */
+  803127:	bf 00 00 00 00       	mov    $0x0,%edi
+  80312c:	eb 19                	jmp    803147 <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  80312e:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803131:	8b 3d 10 74 80 00    	mov    0x807410,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  803137:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  80313e:	00 
+	mptr += n;
+  80313f:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  803142:	a3 10 74 80 00       	mov    %eax,0x807410
+	mutex_unlock(&malloc_mu);
+  803147:	83 ec 0c             	sub    $0xc,%esp
+  80314a:	68 0c 74 80 00       	push   $0x80740c
+  80314f:	e8 78 05 00 00       	call   8036cc <mutex_unlock>
+}
+  803154:	89 f8                	mov    %edi,%eax
+  803156:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803159:	5b                   	pop    %ebx
+  80315a:	5e                   	pop    %esi
+  80315b:	5f                   	pop    %edi
+  80315c:	5d                   	pop    %ebp
+  80315d:	c3                   	ret
+		return 0;
+  80315e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803163:	eb e2                	jmp    803147 <malloc+0x183>
+  803165:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  803169:	74 06                	je     803171 <malloc+0x1ad>
+  80316b:	89 1d 10 74 80 00    	mov    %ebx,0x807410
+	for (i = 0; i < n + 4; i += PGSIZE){
+  803171:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803176:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803179:	39 fb                	cmp    %edi,%ebx
+  80317b:	73 b1                	jae    80312e <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  80317d:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  803183:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  803186:	39 fe                	cmp    %edi,%esi
+  803188:	0f 92 c0             	setb   %al
+  80318b:	0f b6 c0             	movzbl %al,%eax
+  80318e:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  803191:	83 c8 07             	or     $0x7,%eax
+  803194:	50                   	push   %eax
+  803195:	89 d8                	mov    %ebx,%eax
+  803197:	03 05 10 74 80 00    	add    0x807410,%eax
+  80319d:	50                   	push   %eax
+  80319e:	6a 00                	push   $0x0
+  8031a0:	e8 46 dd ff ff       	call   800eeb <sys_page_alloc>
+  8031a5:	83 c4 10             	add    $0x10,%esp
+  8031a8:	85 c0                	test   %eax,%eax
+  8031aa:	0f 88 55 ff ff ff    	js     803105 <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  8031b0:	89 f3                	mov    %esi,%ebx
+  8031b2:	eb c5                	jmp    803179 <malloc+0x1b5>
+
+008031b4 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8031b4:	55                   	push   %ebp
+  8031b5:	89 e5                	mov    %esp,%ebp
+  8031b7:	56                   	push   %esi
+  8031b8:	53                   	push   %ebx
+  8031b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8031bc:	83 ec 0c             	sub    $0xc,%esp
+  8031bf:	ff 75 08             	push   0x8(%ebp)
+  8031c2:	e8 d6 e1 ff ff       	call   80139d <fd2data>
+  8031c7:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8031c9:	83 c4 08             	add    $0x8,%esp
+  8031cc:	68 37 4f 80 00       	push   $0x804f37
+  8031d1:	53                   	push   %ebx
+  8031d2:	e8 d6 d8 ff ff       	call   800aad <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8031d7:	8b 46 04             	mov    0x4(%esi),%eax
+  8031da:	2b 06                	sub    (%esi),%eax
+  8031dc:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8031e2:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8031e9:	00 00 00 
+	stat->st_dev = &devpipe;
+  8031ec:	c7 83 88 00 00 00 9c 	movl   $0x80629c,0x88(%ebx)
+  8031f3:	62 80 00 
+	return 0;
+}
+  8031f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031fb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8031fe:	5b                   	pop    %ebx
+  8031ff:	5e                   	pop    %esi
+  803200:	5d                   	pop    %ebp
+  803201:	c3                   	ret
+
+00803202 <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  803202:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803207:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  80320b:	85 c9                	test   %ecx,%ecx
+  80320d:	75 01                	jne    803210 <pipewake+0xe>
+  80320f:	c3                   	ret
+{
+  803210:	55                   	push   %ebp
+  803211:	89 e5                	mov    %esp,%ebp
+  803213:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  803216:	68 00 04 00 00       	push   $0x400
+  80321b:	52                   	push   %edx
+  80321c:	e8 0e e0 ff ff       	call   80122f <sys_futex_wake>
+  803221:	83 c4 10             	add    $0x10,%esp
+}
+  803224:	c9                   	leave
+  803225:	c3                   	ret
+
+00803226 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803226:	55                   	push   %ebp
+  803227:	89 e5                	mov    %esp,%ebp
+  803229:	56                   	push   %esi
+  80322a:	53                   	push   %ebx
+  80322b:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80322e:	83 ec 0c             	sub    $0xc,%esp
+  803231:	56                   	push   %esi
+  803232:	e8 66 e1 ff ff       	call   80139d <fd2data>
+  803237:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  803239:	83 c4 08             	add    $0x8,%esp
+  80323c:	56                   	push   %esi
+  80323d:	6a 00                	push   $0x0
+  80323f:	e8 40 dd ff ff       	call   800f84 <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  803244:	8d 53 04             	lea    0x4(%ebx),%edx
+  803247:	8d 43 08             	lea    0x8(%ebx),%eax
+  80324a:	e8 b3 ff ff ff       	call   803202 <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  80324f:	8d 43 0c             	lea    0xc(%ebx),%eax
+  803252:	89 da                	mov    %ebx,%edx
+  803254:	e8 a9 ff ff ff       	call   803202 <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  803259:	89 34 24             	mov    %esi,(%esp)
+  80325c:	e8 3c e1 ff ff       	call   80139d <fd2data>
+  803261:	83 c4 08             	add    $0x8,%esp
+  803264:	50                   	push   %eax
+  803265:	6a 00                	push   $0x0
+  803267:	e8 18 dd ff ff       	call   800f84 <sys_page_unmap>
+}
+  80326c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80326f:	5b                   	pop    %ebx
+  803270:	5e                   	pop    %esi
+  803271:	5d                   	pop    %ebp
+  803272:	c3                   	ret
+
+00803273 <_pipeisclosed>:
+{
+  803273:	55                   	push   %ebp
+  803274:	89 e5                	mov    %esp,%ebp
+  803276:	57                   	push   %edi
+  803277:	56                   	push   %esi
+  803278:	53                   	push   %ebx
+  803279:	83 ec 1c             	sub    $0x1c,%esp
+  80327c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80327f:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803281:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  803286:	eb 5d                	jmp    8032e5 <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  803288:	8b 15 c0 76 80 00    	mov    0x8076c0,%edx
+		n = thisenv->env_runs;
+  80328e:	8b 02                	mov    (%edx),%eax
+  803290:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  803293:	83 ec 0c             	sub    $0xc,%esp
+  803296:	ff 75 e0             	push   -0x20(%ebp)
+  803299:	e8 ce 13 00 00       	call   80466c <pageref>
+  80329e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8032a1:	89 3c 24             	mov    %edi,(%esp)
+  8032a4:	e8 c3 13 00 00       	call   80466c <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  8032a9:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8032ab:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  8032b1:	83 c4 10             	add    $0x10,%esp
+  8032b4:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8032ba:	77 15                	ja     8032d1 <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8032bc:	89 f2                	mov    %esi,%edx
+  8032be:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  8032c0:	c1 ea 10             	shr    $0x10,%edx
+  8032c3:	74 0c                	je     8032d1 <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8032c5:	c1 e2 10             	shl    $0x10,%edx
+  8032c8:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8032cd:	29 d1                	sub    %edx,%ecx
+  8032cf:	eb 06                	jmp    8032d7 <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  8032d1:	8b 0d c0 76 80 00    	mov    0x8076c0,%ecx
+		nn = thisenv->env_runs;
+  8032d7:	8b 11                	mov    (%ecx),%edx
+  8032d9:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  8032dc:	39 d3                	cmp    %edx,%ebx
+  8032de:	74 6e                	je     80334e <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  8032e0:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8032e3:	74 24                	je     803309 <_pipeisclosed+0x96>
+  8032e5:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8032e7:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8032ed:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8032f2:	77 94                	ja     803288 <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8032f4:	89 f0                	mov    %esi,%eax
+  8032f6:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8032f8:	c1 e8 10             	shr    $0x10,%eax
+  8032fb:	74 8b                	je     803288 <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8032fd:	c1 e0 10             	shl    $0x10,%eax
+  803300:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803305:	29 c2                	sub    %eax,%edx
+  803307:	eb 85                	jmp    80328e <_pipeisclosed+0x1b>
+  803309:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80330b:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803311:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803316:	77 18                	ja     803330 <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803318:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80331d:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80331f:	c1 e8 10             	shr    $0x10,%eax
+  803322:	74 0c                	je     803330 <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803324:	c1 e0 10             	shl    $0x10,%eax
+  803327:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80332c:	29 c2                	sub    %eax,%edx
+  80332e:	eb 06                	jmp    803336 <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  803330:	8b 15 c0 76 80 00    	mov    0x8076c0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803336:	8b 02                	mov    (%edx),%eax
+  803338:	8b 40 58             	mov    0x58(%eax),%eax
+  80333b:	6a 01                	push   $0x1
+  80333d:	50                   	push   %eax
+  80333e:	53                   	push   %ebx
+  80333f:	68 3e 4f 80 00       	push   $0x804f3e
+  803344:	e8 90 d0 ff ff       	call   8003d9 <cprintf>
+  803349:	83 c4 10             	add    $0x10,%esp
+  80334c:	eb 97                	jmp    8032e5 <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  80334e:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803351:	0f 94 c0             	sete   %al
+  803354:	0f b6 c0             	movzbl %al,%eax
+}
+  803357:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80335a:	5b                   	pop    %ebx
+  80335b:	5e                   	pop    %esi
+  80335c:	5f                   	pop    %edi
+  80335d:	5d                   	pop    %ebp
+  80335e:	c3                   	ret
+
+0080335f <devpipe_write>:
+{
+  80335f:	55                   	push   %ebp
+  803360:	89 e5                	mov    %esp,%ebp
+  803362:	57                   	push   %edi
+  803363:	56                   	push   %esi
+  803364:	53                   	push   %ebx
+  803365:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  803368:	ff 75 08             	push   0x8(%ebp)
+  80336b:	e8 2d e0 ff ff       	call   80139d <fd2data>
+  803370:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803372:	83 c4 10             	add    $0x10,%esp
+  803375:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  80337c:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  80337f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803382:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803385:	0f 84 96 00 00 00    	je     803421 <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  80338b:	8d 73 08             	lea    0x8(%ebx),%esi
+  80338e:	eb 32                	jmp    8033c2 <devpipe_write+0x63>
+  803390:	89 fa                	mov    %edi,%edx
+  803392:	89 f0                	mov    %esi,%eax
+  803394:	e8 69 fe ff ff       	call   803202 <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  803399:	8b 43 04             	mov    0x4(%ebx),%eax
+  80339c:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  80339f:	ba 01 00 00 00       	mov    $0x1,%edx
+  8033a4:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  8033a9:	83 ec 04             	sub    $0x4,%esp
+  8033ac:	6a 0a                	push   $0xa
+  8033ae:	50                   	push   %eax
+  8033af:	53                   	push   %ebx
+  8033b0:	e8 4b de ff ff       	call   801200 <sys_futex_wait>
+  8033b5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8033ba:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  8033bf:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8033c2:	8b 43 04             	mov    0x4(%ebx),%eax
+  8033c5:	8b 0b                	mov    (%ebx),%ecx
+  8033c7:	8d 51 20             	lea    0x20(%ecx),%edx
+  8033ca:	39 d0                	cmp    %edx,%eax
+  8033cc:	72 1b                	jb     8033e9 <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  8033ce:	89 da                	mov    %ebx,%edx
+  8033d0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033d3:	e8 9b fe ff ff       	call   803273 <_pipeisclosed>
+  8033d8:	85 c0                	test   %eax,%eax
+  8033da:	74 b4                	je     803390 <devpipe_write+0x31>
+				return 0;
+  8033dc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033e4:	5b                   	pop    %ebx
+  8033e5:	5e                   	pop    %esi
+  8033e6:	5f                   	pop    %edi
+  8033e7:	5d                   	pop    %ebp
+  8033e8:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8033e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8033ec:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8033ef:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  8033f3:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  8033f6:	89 c2                	mov    %eax,%edx
+  8033f8:	c1 fa 1f             	sar    $0x1f,%edx
+  8033fb:	89 d1                	mov    %edx,%ecx
+  8033fd:	c1 e9 1b             	shr    $0x1b,%ecx
+  803400:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  803403:	83 e2 1f             	and    $0x1f,%edx
+  803406:	29 ca                	sub    %ecx,%edx
+  803408:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  80340c:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  803410:	83 c0 01             	add    $0x1,%eax
+  803413:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  803416:	83 c6 01             	add    $0x1,%esi
+  803419:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  80341c:	e9 5e ff ff ff       	jmp    80337f <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  803421:	8d 53 04             	lea    0x4(%ebx),%edx
+  803424:	8d 43 08             	lea    0x8(%ebx),%eax
+  803427:	e8 d6 fd ff ff       	call   803202 <pipewake>
+	return i;
+  80342c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80342f:	eb b0                	jmp    8033e1 <devpipe_write+0x82>
+
+00803431 <devpipe_read>:
+{
+  803431:	55                   	push   %ebp
+  803432:	89 e5                	mov    %esp,%ebp
+  803434:	57                   	push   %edi
+  803435:	56                   	push   %esi
+  803436:	53                   	push   %ebx
+  803437:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  80343a:	ff 75 08             	push   0x8(%ebp)
+  80343d:	e8 5b df ff ff       	call   80139d <fd2data>
+  803442:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803444:	83 c4 10             	add    $0x10,%esp
+  803447:	be 00 00 00 00       	mov    $0x0,%esi
+  80344c:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80344f:	74 6c                	je     8034bd <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  803451:	8d 7b 04             	lea    0x4(%ebx),%edi
+  803454:	eb 25                	jmp    80347b <devpipe_read+0x4a>
+  803456:	8b 13                	mov    (%ebx),%edx
+  803458:	b8 01 00 00 00       	mov    $0x1,%eax
+  80345d:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  803462:	83 ec 04             	sub    $0x4,%esp
+  803465:	6a 0a                	push   $0xa
+  803467:	52                   	push   %edx
+  803468:	57                   	push   %edi
+  803469:	e8 92 dd ff ff       	call   801200 <sys_futex_wait>
+  80346e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803473:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  803478:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  80347b:	8b 03                	mov    (%ebx),%eax
+  80347d:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803480:	75 19                	jne    80349b <devpipe_read+0x6a>
+			if (i > 0)
+  803482:	85 f6                	test   %esi,%esi
+  803484:	75 3a                	jne    8034c0 <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  803486:	89 da                	mov    %ebx,%edx
+  803488:	8b 45 08             	mov    0x8(%ebp),%eax
+  80348b:	e8 e3 fd ff ff       	call   803273 <_pipeisclosed>
+  803490:	85 c0                	test   %eax,%eax
+  803492:	74 c2                	je     803456 <devpipe_read+0x25>
+				return 0;
+  803494:	b8 00 00 00 00       	mov    $0x0,%eax
+  803499:	eb 31                	jmp    8034cc <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80349b:	89 c1                	mov    %eax,%ecx
+  80349d:	c1 f9 1f             	sar    $0x1f,%ecx
+  8034a0:	c1 e9 1b             	shr    $0x1b,%ecx
+  8034a3:	01 c8                	add    %ecx,%eax
+  8034a5:	83 e0 1f             	and    $0x1f,%eax
+  8034a8:	29 c8                	sub    %ecx,%eax
+  8034aa:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  8034af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8034b2:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8034b5:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8034b8:	83 c6 01             	add    $0x1,%esi
+  8034bb:	eb 8f                	jmp    80344c <devpipe_read+0x1b>
+out:
+  8034bd:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  8034c0:	8d 43 0c             	lea    0xc(%ebx),%eax
+  8034c3:	89 da                	mov    %ebx,%edx
+  8034c5:	e8 38 fd ff ff       	call   803202 <pipewake>
+	return i;
+  8034ca:	89 f0                	mov    %esi,%eax
+}
+  8034cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034cf:	5b                   	pop    %ebx
+  8034d0:	5e                   	pop    %esi
+  8034d1:	5f                   	pop    %edi
+  8034d2:	5d                   	pop    %ebp
+  8034d3:	c3                   	ret
+
+008034d4 <pipe>:
+{
+  8034d4:	55                   	push   %ebp
+  8034d5:	89 e5                	mov    %esp,%ebp
+  8034d7:	56                   	push   %esi
+  8034d8:	53                   	push   %ebx
+  8034d9:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8034dc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8034df:	50                   	push   %eax
+  8034e0:	e8 cf de ff ff       	call   8013b4 <fd_alloc>
+  8034e5:	89 c3                	mov    %eax,%ebx
+  8034e7:	83 c4 10             	add    $0x10,%esp
+  8034ea:	85 c0                	test   %eax,%eax
+  8034ec:	0f 88 23 01 00 00    	js     803615 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8034f2:	83 ec 04             	sub    $0x4,%esp
+  8034f5:	68 07 04 00 00       	push   $0x407
+  8034fa:	ff 75 f4             	push   -0xc(%ebp)
+  8034fd:	6a 00                	push   $0x0
+  8034ff:	e8 e7 d9 ff ff       	call   800eeb <sys_page_alloc>
+  803504:	89 c3                	mov    %eax,%ebx
+  803506:	83 c4 10             	add    $0x10,%esp
+  803509:	85 c0                	test   %eax,%eax
+  80350b:	0f 88 04 01 00 00    	js     803615 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803511:	83 ec 0c             	sub    $0xc,%esp
+  803514:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803517:	50                   	push   %eax
+  803518:	e8 97 de ff ff       	call   8013b4 <fd_alloc>
+  80351d:	89 c3                	mov    %eax,%ebx
+  80351f:	83 c4 10             	add    $0x10,%esp
+  803522:	85 c0                	test   %eax,%eax
+  803524:	0f 88 db 00 00 00    	js     803605 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80352a:	83 ec 04             	sub    $0x4,%esp
+  80352d:	68 07 04 00 00       	push   $0x407
+  803532:	ff 75 f0             	push   -0x10(%ebp)
+  803535:	6a 00                	push   $0x0
+  803537:	e8 af d9 ff ff       	call   800eeb <sys_page_alloc>
+  80353c:	89 c3                	mov    %eax,%ebx
+  80353e:	83 c4 10             	add    $0x10,%esp
+  803541:	85 c0                	test   %eax,%eax
+  803543:	0f 88 bc 00 00 00    	js     803605 <pipe+0x131>
+	va = fd2data(fd0);
+  803549:	83 ec 0c             	sub    $0xc,%esp
+  80354c:	ff 75 f4             	push   -0xc(%ebp)
+  80354f:	e8 49 de ff ff       	call   80139d <fd2data>
+  803554:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803556:	83 c4 0c             	add    $0xc,%esp
+  803559:	68 07 04 00 00       	push   $0x407
+  80355e:	50                   	push   %eax
+  80355f:	6a 00                	push   $0x0
+  803561:	e8 85 d9 ff ff       	call   800eeb <sys_page_alloc>
+  803566:	89 c3                	mov    %eax,%ebx
+  803568:	83 c4 10             	add    $0x10,%esp
+  80356b:	85 c0                	test   %eax,%eax
+  80356d:	0f 88 82 00 00 00    	js     8035f5 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803573:	83 ec 0c             	sub    $0xc,%esp
+  803576:	ff 75 f0             	push   -0x10(%ebp)
+  803579:	e8 1f de ff ff       	call   80139d <fd2data>
+  80357e:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803585:	50                   	push   %eax
+  803586:	6a 00                	push   $0x0
+  803588:	56                   	push   %esi
+  803589:	6a 00                	push   $0x0
+  80358b:	e8 a8 d9 ff ff       	call   800f38 <sys_page_map>
+  803590:	89 c3                	mov    %eax,%ebx
+  803592:	83 c4 20             	add    $0x20,%esp
+  803595:	85 c0                	test   %eax,%eax
+  803597:	78 4e                	js     8035e7 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803599:	a1 9c 62 80 00       	mov    0x80629c,%eax
+  80359e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8035a1:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8035a3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8035a6:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8035ad:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8035b0:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8035b2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8035b5:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8035bc:	83 ec 0c             	sub    $0xc,%esp
+  8035bf:	ff 75 f4             	push   -0xc(%ebp)
+  8035c2:	e8 c6 dd ff ff       	call   80138d <fd2num>
+  8035c7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8035ca:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8035cc:	83 c4 04             	add    $0x4,%esp
+  8035cf:	ff 75 f0             	push   -0x10(%ebp)
+  8035d2:	e8 b6 dd ff ff       	call   80138d <fd2num>
+  8035d7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8035da:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8035dd:	83 c4 10             	add    $0x10,%esp
+  8035e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8035e5:	eb 2e                	jmp    803615 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8035e7:	83 ec 08             	sub    $0x8,%esp
+  8035ea:	56                   	push   %esi
+  8035eb:	6a 00                	push   $0x0
+  8035ed:	e8 92 d9 ff ff       	call   800f84 <sys_page_unmap>
+  8035f2:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8035f5:	83 ec 08             	sub    $0x8,%esp
+  8035f8:	ff 75 f0             	push   -0x10(%ebp)
+  8035fb:	6a 00                	push   $0x0
+  8035fd:	e8 82 d9 ff ff       	call   800f84 <sys_page_unmap>
+  803602:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803605:	83 ec 08             	sub    $0x8,%esp
+  803608:	ff 75 f4             	push   -0xc(%ebp)
+  80360b:	6a 00                	push   $0x0
+  80360d:	e8 72 d9 ff ff       	call   800f84 <sys_page_unmap>
+  803612:	83 c4 10             	add    $0x10,%esp
+}
+  803615:	89 d8                	mov    %ebx,%eax
+  803617:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80361a:	5b                   	pop    %ebx
+  80361b:	5e                   	pop    %esi
+  80361c:	5d                   	pop    %ebp
+  80361d:	c3                   	ret
+
+0080361e <pipeisclosed>:
+{
+  80361e:	55                   	push   %ebp
+  80361f:	89 e5                	mov    %esp,%ebp
+  803621:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803624:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803627:	50                   	push   %eax
+  803628:	ff 75 08             	push   0x8(%ebp)
+  80362b:	e8 da dd ff ff       	call   80140a <fd_lookup>
+  803630:	83 c4 10             	add    $0x10,%esp
+  803633:	85 c0                	test   %eax,%eax
+  803635:	78 18                	js     80364f <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803637:	83 ec 0c             	sub    $0xc,%esp
+  80363a:	ff 75 f4             	push   -0xc(%ebp)
+  80363d:	e8 5b dd ff ff       	call   80139d <fd2data>
+  803642:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803644:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803647:	e8 27 fc ff ff       	call   803273 <_pipeisclosed>
+  80364c:	83 c4 10             	add    $0x10,%esp
+}
+  80364f:	c9                   	leave
+  803650:	c3                   	ret
+
+00803651 <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  803651:	55                   	push   %ebp
+  803652:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  803654:	8b 45 08             	mov    0x8(%ebp),%eax
+  803657:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  80365d:	5d                   	pop    %ebp
+  80365e:	c3                   	ret
+
+0080365f <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  80365f:	55                   	push   %ebp
+  803660:	89 e5                	mov    %esp,%ebp
+  803662:	56                   	push   %esi
+  803663:	53                   	push   %ebx
+  803664:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803667:	ba 00 00 00 00       	mov    $0x0,%edx
+  80366c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803671:	89 d0                	mov    %edx,%eax
+  803673:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  803677:	85 c0                	test   %eax,%eax
+  803679:	74 2d                	je     8036a8 <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  80367b:	83 f8 02             	cmp    $0x2,%eax
+  80367e:	74 08                	je     803688 <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  803680:	b8 02 00 00 00       	mov    $0x2,%eax
+  803685:	f0 87 03             	lock xchg %eax,(%ebx)
+  803688:	be 02 00 00 00       	mov    $0x2,%esi
+  80368d:	eb 15                	jmp    8036a4 <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  80368f:	83 ec 04             	sub    $0x4,%esp
+  803692:	6a 00                	push   $0x0
+  803694:	6a 02                	push   $0x2
+  803696:	53                   	push   %ebx
+  803697:	e8 64 db ff ff       	call   801200 <sys_futex_wait>
+  80369c:	89 f0                	mov    %esi,%eax
+  80369e:	f0 87 03             	lock xchg %eax,(%ebx)
+  8036a1:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  8036a4:	85 c0                	test   %eax,%eax
+  8036a6:	75 e7                	jne    80368f <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  8036a8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8036ab:	5b                   	pop    %ebx
+  8036ac:	5e                   	pop    %esi
+  8036ad:	5d                   	pop    %ebp
+  8036ae:	c3                   	ret
+
+008036af <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  8036af:	55                   	push   %ebp
+  8036b0:	89 e5                	mov    %esp,%ebp
+  8036b2:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  8036b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036ba:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8036bf:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  8036c3:	f7 d8                	neg    %eax
+  8036c5:	19 c0                	sbb    %eax,%eax
+  8036c7:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  8036ca:	5d                   	pop    %ebp
+  8036cb:	c3                   	ret
+
+008036cc <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  8036cc:	55                   	push   %ebp
+  8036cd:	89 e5                	mov    %esp,%ebp
+  8036cf:	83 ec 08             	sub    $0x8,%esp
+  8036d2:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  8036d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036da:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  8036dd:	83 f8 02             	cmp    $0x2,%eax
+  8036e0:	74 02                	je     8036e4 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  8036e2:	c9                   	leave
+  8036e3:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  8036e4:	83 ec 08             	sub    $0x8,%esp
+  8036e7:	6a 01                	push   $0x1
+  8036e9:	52                   	push   %edx
+  8036ea:	e8 40 db ff ff       	call   80122f <sys_futex_wake>
+  8036ef:	83 c4 10             	add    $0x10,%esp
+}
+  8036f2:	eb ee                	jmp    8036e2 <mutex_unlock+0x16>
+
+008036f4 <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  8036f4:	55                   	push   %ebp
+  8036f5:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  8036f7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036fa:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803700:	5d                   	pop    %ebp
+  803701:	c3                   	ret
+
+00803702 <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  803702:	55                   	push   %ebp
+  803703:	89 e5                	mov    %esp,%ebp
+  803705:	57                   	push   %edi
+  803706:	56                   	push   %esi
+  803707:	53                   	push   %ebx
+  803708:	83 ec 18             	sub    $0x18,%esp
+  80370b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80370e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  803711:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  803713:	53                   	push   %ebx
+  803714:	e8 b3 ff ff ff       	call   8036cc <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  803719:	83 c4 0c             	add    $0xc,%esp
+  80371c:	ff 75 10             	push   0x10(%ebp)
+  80371f:	57                   	push   %edi
+  803720:	56                   	push   %esi
+  803721:	e8 da da ff ff       	call   801200 <sys_futex_wait>
+  803726:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  803728:	83 c4 10             	add    $0x10,%esp
+  80372b:	be 02 00 00 00       	mov    $0x2,%esi
+  803730:	eb 10                	jmp    803742 <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  803732:	83 ec 04             	sub    $0x4,%esp
+  803735:	6a 00                	push   $0x0
+  803737:	6a 02                	push   $0x2
+  803739:	53                   	push   %ebx
+  80373a:	e8 c1 da ff ff       	call   801200 <sys_futex_wait>
+  80373f:	83 c4 10             	add    $0x10,%esp
+  803742:	89 f0                	mov    %esi,%eax
+  803744:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  803747:	85 c0                	test   %eax,%eax
+  803749:	75 e7                	jne    803732 <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  80374b:	83 ff ec             	cmp    $0xffffffec,%edi
+  80374e:	74 05                	je     803755 <cond_timedwait+0x53>
+  803750:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803755:	89 f8                	mov    %edi,%eax
+  803757:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80375a:	5b                   	pop    %ebx
+  80375b:	5e                   	pop    %esi
+  80375c:	5f                   	pop    %edi
+  80375d:	5d                   	pop    %ebp
+  80375e:	c3                   	ret
+
+0080375f <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  80375f:	55                   	push   %ebp
+  803760:	89 e5                	mov    %esp,%ebp
+  803762:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  803765:	6a 00                	push   $0x0
+  803767:	ff 75 0c             	push   0xc(%ebp)
+  80376a:	ff 75 08             	push   0x8(%ebp)
+  80376d:	e8 90 ff ff ff       	call   803702 <cond_timedwait>
+}
+  803772:	83 c4 10             	add    $0x10,%esp
+  803775:	c9                   	leave
+  803776:	c3                   	ret
+
+00803777 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  803777:	55                   	push   %ebp
+  803778:	89 e5                	mov    %esp,%ebp
+  80377a:	83 ec 10             	sub    $0x10,%esp
+  80377d:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  803780:	ba 01 00 00 00       	mov    $0x1,%edx
+  803785:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  803789:	6a 01                	push   $0x1
+  80378b:	50                   	push   %eax
+  80378c:	e8 9e da ff ff       	call   80122f <sys_futex_wake>
+}
+  803791:	83 c4 10             	add    $0x10,%esp
+  803794:	c9                   	leave
+  803795:	c3                   	ret
+
+00803796 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  803796:	55                   	push   %ebp
+  803797:	89 e5                	mov    %esp,%ebp
+  803799:	83 ec 10             	sub    $0x10,%esp
+  80379c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80379f:	ba 01 00 00 00       	mov    $0x1,%edx
+  8037a4:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  8037a8:	68 00 04 00 00       	push   $0x400
+  8037ad:	50                   	push   %eax
+  8037ae:	e8 7c da ff ff       	call   80122f <sys_futex_wake>
+}
+  8037b3:	83 c4 10             	add    $0x10,%esp
+  8037b6:	c9                   	leave
+  8037b7:	c3                   	ret
+
+008037b8 <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  8037b8:	55                   	push   %ebp
+  8037b9:	89 e5                	mov    %esp,%ebp
+  8037bb:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  8037be:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8037c1:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  8037c3:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  8037ca:	5d                   	pop    %ebp
+  8037cb:	c3                   	ret
+
+008037cc <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  8037cc:	55                   	push   %ebp
+  8037cd:	89 e5                	mov    %esp,%ebp
+  8037cf:	53                   	push   %ebx
+  8037d0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  8037d3:	8b 11                	mov    (%ecx),%edx
+  8037d5:	85 d2                	test   %edx,%edx
+  8037d7:	74 14                	je     8037ed <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  8037d9:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  8037dc:	89 d0                	mov    %edx,%eax
+  8037de:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  8037e2:	39 c2                	cmp    %eax,%edx
+  8037e4:	75 ed                	jne    8037d3 <sem_trywait+0x7>
+			return 0;
+  8037e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037eb:	eb 05                	jmp    8037f2 <sem_trywait+0x26>
+	return -E_AGAIN;
+  8037ed:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  8037f2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8037f5:	c9                   	leave
+  8037f6:	c3                   	ret
+
+008037f7 <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  8037f7:	55                   	push   %ebp
+  8037f8:	89 e5                	mov    %esp,%ebp
+  8037fa:	57                   	push   %edi
+  8037fb:	56                   	push   %esi
+  8037fc:	53                   	push   %ebx
+  8037fd:	83 ec 1c             	sub    $0x1c,%esp
+  803800:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803803:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  803806:	e8 6d d9 ff ff       	call   801178 <sys_time_msec>
+  80380b:	01 f8                	add    %edi,%eax
+  80380d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  803810:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  803815:	eb 28                	jmp    80383f <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  803817:	b8 01 00 00 00       	mov    $0x1,%eax
+  80381c:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  803821:	83 ec 04             	sub    $0x4,%esp
+  803824:	56                   	push   %esi
+  803825:	6a 00                	push   $0x0
+  803827:	53                   	push   %ebx
+  803828:	e8 d3 d9 ff ff       	call   801200 <sys_futex_wait>
+  80382d:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  803832:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  803837:	83 c4 10             	add    $0x10,%esp
+  80383a:	83 f8 ec             	cmp    $0xffffffec,%eax
+  80383d:	74 2e                	je     80386d <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  80383f:	83 ec 0c             	sub    $0xc,%esp
+  803842:	53                   	push   %ebx
+  803843:	e8 84 ff ff ff       	call   8037cc <sem_trywait>
+  803848:	83 c4 10             	add    $0x10,%esp
+  80384b:	85 c0                	test   %eax,%eax
+  80384d:	79 19                	jns    803868 <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  80384f:	85 ff                	test   %edi,%edi
+  803851:	74 c4                	je     803817 <sem_timedwait+0x20>
+  803853:	e8 20 d9 ff ff       	call   801178 <sys_time_msec>
+  803858:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80385b:	29 c6                	sub    %eax,%esi
+  80385d:	85 f6                	test   %esi,%esi
+  80385f:	7f b6                	jg     803817 <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  803861:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  803866:	eb 05                	jmp    80386d <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  803868:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80386d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803870:	5b                   	pop    %ebx
+  803871:	5e                   	pop    %esi
+  803872:	5f                   	pop    %edi
+  803873:	5d                   	pop    %ebp
+  803874:	c3                   	ret
+
+00803875 <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  803875:	55                   	push   %ebp
+  803876:	89 e5                	mov    %esp,%ebp
+  803878:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  80387b:	6a 00                	push   $0x0
+  80387d:	ff 75 08             	push   0x8(%ebp)
+  803880:	e8 72 ff ff ff       	call   8037f7 <sem_timedwait>
+}
+  803885:	83 c4 10             	add    $0x10,%esp
+  803888:	c9                   	leave
+  803889:	c3                   	ret
+
+0080388a <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  80388a:	55                   	push   %ebp
+  80388b:	89 e5                	mov    %esp,%ebp
+  80388d:	83 ec 08             	sub    $0x8,%esp
+  803890:	8b 45 08             	mov    0x8(%ebp),%eax
+  803893:	ba 01 00 00 00       	mov    $0x1,%edx
+  803898:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  80389c:	8b 50 04             	mov    0x4(%eax),%edx
+  80389f:	85 d2                	test   %edx,%edx
+  8038a1:	75 02                	jne    8038a5 <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  8038a3:	c9                   	leave
+  8038a4:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  8038a5:	83 ec 08             	sub    $0x8,%esp
+  8038a8:	6a 01                	push   $0x1
+  8038aa:	50                   	push   %eax
+  8038ab:	e8 7f d9 ff ff       	call   80122f <sys_futex_wake>
+  8038b0:	83 c4 10             	add    $0x10,%esp
+}
+  8038b3:	eb ee                	jmp    8038a3 <sem_post+0x19>
+
+008038b5 <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  8038b5:	55                   	push   %ebp
+  8038b6:	89 e5                	mov    %esp,%ebp
+  8038b8:	57                   	push   %edi
+  8038b9:	56                   	push   %esi
+  8038ba:	53                   	push   %ebx
+  8038bb:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  8038be:	68 20 74 80 00       	push   $0x807420
+  8038c3:	e8 97 fd ff ff       	call   80365f <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  8038c8:	a1 44 74 80 00       	mov    0x807444,%eax
+  8038cd:	83 c4 10             	add    $0x10,%esp
+  8038d0:	85 c0                	test   %eax,%eax
+  8038d2:	75 19                	jne    8038ed <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  8038d4:	a1 c0 76 80 00       	mov    0x8076c0,%eax
+  8038d9:	8b 00                	mov    (%eax),%eax
+  8038db:	8b 40 48             	mov    0x48(%eax),%eax
+  8038de:	a3 40 74 80 00       	mov    %eax,0x807440
+		threads[0].th_state = PTH_RUNNING;
+  8038e3:	c7 05 44 74 80 00 01 	movl   $0x1,0x807444
+  8038ea:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  8038ed:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  8038f2:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8038f5:	8d 04 85 40 74 80 00 	lea    0x807440(,%eax,4),%eax
+  8038fc:	8b 40 04             	mov    0x4(%eax),%eax
+  8038ff:	85 c0                	test   %eax,%eax
+  803901:	0f 84 e4 00 00 00    	je     8039eb <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803907:	83 c3 01             	add    $0x1,%ebx
+  80390a:	83 fb 20             	cmp    $0x20,%ebx
+  80390d:	75 e3                	jne    8038f2 <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  80390f:	83 ec 0c             	sub    $0xc,%esp
+  803912:	68 20 74 80 00       	push   $0x807420
+  803917:	e8 b0 fd ff ff       	call   8036cc <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  80391c:	83 c4 10             	add    $0x10,%esp
+  80391f:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  803924:	e9 b8 00 00 00       	jmp    8039e1 <pthread_create+0x12c>
+  803929:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  80392c:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  80392f:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  803931:	39 f3                	cmp    %esi,%ebx
+  803933:	73 16                	jae    80394b <pthread_create+0x96>
+		va -= PGSIZE;
+  803935:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  80393b:	83 ec 08             	sub    $0x8,%esp
+  80393e:	56                   	push   %esi
+  80393f:	6a 00                	push   $0x0
+  803941:	e8 3e d6 ff ff       	call   800f84 <sys_page_unmap>
+  803946:	83 c4 10             	add    $0x10,%esp
+  803949:	eb e6                	jmp    803931 <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  80394b:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80394e:	83 ec 08             	sub    $0x8,%esp
+  803951:	ff 75 e4             	push   -0x1c(%ebp)
+  803954:	6a 00                	push   $0x0
+  803956:	e8 29 d6 ff ff       	call   800f84 <sys_page_unmap>
+	return r;
+  80395b:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  80395e:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803961:	8d 04 85 40 74 80 00 	lea    0x807440(,%eax,4),%eax
+  803968:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  80396f:	eb 70                	jmp    8039e1 <pthread_create+0x12c>
+	th->th_fn = fn;
+  803971:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803974:	8d 04 85 40 74 80 00 	lea    0x807440(,%eax,4),%eax
+  80397b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80397e:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  803981:	8b 55 10             	mov    0x10(%ebp),%edx
+  803984:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  803987:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  80398e:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  803993:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803996:	29 c8                	sub    %ecx,%eax
+  803998:	85 db                	test   %ebx,%ebx
+  80399a:	0f 44 05 c0 76 80 00 	cmove  0x8076c0,%eax
+	*--esp = t;
+  8039a1:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  8039a4:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  8039ab:	83 ec 04             	sub    $0x4,%esp
+  8039ae:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  8039b3:	29 ca                	sub    %ecx,%edx
+  8039b5:	52                   	push   %edx
+	*--esp = 0;
+  8039b6:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  8039b9:	50                   	push   %eax
+  8039ba:	68 12 3c 80 00       	push   $0x803c12
+  8039bf:	e8 10 d9 ff ff       	call   8012d4 <sys_thread_create>
+  8039c4:	89 c7                	mov    %eax,%edi
+  8039c6:	83 c4 10             	add    $0x10,%esp
+  8039c9:	85 c0                	test   %eax,%eax
+  8039cb:	78 91                	js     80395e <pthread_create+0xa9>
+	th->th_env = id;
+  8039cd:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8039d0:	89 3c 85 40 74 80 00 	mov    %edi,0x807440(,%eax,4)
+	*tp = t;
+  8039d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8039da:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  8039dc:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  8039e1:	89 f8                	mov    %edi,%eax
+  8039e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8039e6:	5b                   	pop    %ebx
+  8039e7:	5e                   	pop    %esi
+  8039e8:	5f                   	pop    %edi
+  8039e9:	5d                   	pop    %ebp
+  8039ea:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  8039eb:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8039ee:	8d 04 85 40 74 80 00 	lea    0x807440(,%eax,4),%eax
+  8039f5:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  8039fc:	83 ec 0c             	sub    $0xc,%esp
+  8039ff:	68 20 74 80 00       	push   $0x807420
+  803a04:	e8 c3 fc ff ff       	call   8036cc <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  803a09:	89 d9                	mov    %ebx,%ecx
+  803a0b:	c1 e1 10             	shl    $0x10,%ecx
+  803a0e:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  803a11:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  803a16:	29 c8                	sub    %ecx,%eax
+  803a18:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  803a1b:	c1 e8 16             	shr    $0x16,%eax
+  803a1e:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803a25:	83 c4 10             	add    $0x10,%esp
+  803a28:	a8 01                	test   $0x1,%al
+  803a2a:	74 15                	je     803a41 <pthread_create+0x18c>
+  803a2c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803a2f:	c1 e8 0c             	shr    $0xc,%eax
+  803a32:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803a39:	a8 01                	test   $0x1,%al
+  803a3b:	0f 85 30 ff ff ff    	jne    803971 <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803a41:	83 ec 04             	sub    $0x4,%esp
+  803a44:	6a 07                	push   $0x7
+  803a46:	ff 75 e4             	push   -0x1c(%ebp)
+  803a49:	6a 00                	push   $0x0
+  803a4b:	e8 9b d4 ff ff       	call   800eeb <sys_page_alloc>
+  803a50:	89 c7                	mov    %eax,%edi
+  803a52:	83 c4 10             	add    $0x10,%esp
+  803a55:	85 c0                	test   %eax,%eax
+  803a57:	0f 88 01 ff ff ff    	js     80395e <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  803a5d:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  803a62:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  803a65:	29 d0                	sub    %edx,%eax
+  803a67:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  803a6a:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803a6c:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  803a71:	29 d0                	sub    %edx,%eax
+  803a73:	89 c7                	mov    %eax,%edi
+  803a75:	39 fe                	cmp    %edi,%esi
+  803a77:	0f 83 f4 fe ff ff    	jae    803971 <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803a7d:	83 ec 04             	sub    $0x4,%esp
+  803a80:	6a 07                	push   $0x7
+  803a82:	56                   	push   %esi
+  803a83:	6a 00                	push   $0x0
+  803a85:	e8 61 d4 ff ff       	call   800eeb <sys_page_alloc>
+  803a8a:	83 c4 10             	add    $0x10,%esp
+  803a8d:	85 c0                	test   %eax,%eax
+  803a8f:	0f 88 94 fe ff ff    	js     803929 <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803a95:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803a9b:	eb d8                	jmp    803a75 <pthread_create+0x1c0>
+
+00803a9d <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  803a9d:	55                   	push   %ebp
+  803a9e:	89 e5                	mov    %esp,%ebp
+  803aa0:	57                   	push   %edi
+  803aa1:	56                   	push   %esi
+  803aa2:	53                   	push   %ebx
+  803aa3:	83 ec 0c             	sub    $0xc,%esp
+  803aa6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  803aa9:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  803aac:	83 f8 1e             	cmp    $0x1e,%eax
+  803aaf:	0f 87 c7 00 00 00    	ja     803b7c <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  803ab5:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803ab7:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803abd:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803ac2:	77 12                	ja     803ad6 <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803ac4:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803ac9:	29 d0                	sub    %edx,%eax
+  803acb:	c1 e8 10             	shr    $0x10,%eax
+  803ace:	39 c3                	cmp    %eax,%ebx
+  803ad0:	0f 84 ad 00 00 00    	je     803b83 <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803ad6:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803ad9:	8d 3c 85 44 74 80 00 	lea    0x807444(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  803ae0:	8d 34 85 40 74 80 00 	lea    0x807440(,%eax,4),%esi
+  803ae7:	eb 10                	jmp    803af9 <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803ae9:	83 ec 04             	sub    $0x4,%esp
+  803aec:	6a 00                	push   $0x0
+  803aee:	6a 01                	push   $0x1
+  803af0:	57                   	push   %edi
+  803af1:	e8 0a d7 ff ff       	call   801200 <sys_futex_wait>
+  803af6:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  803af9:	8b 46 04             	mov    0x4(%esi),%eax
+  803afc:	83 f8 01             	cmp    $0x1,%eax
+  803aff:	74 e8                	je     803ae9 <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  803b01:	83 f8 02             	cmp    $0x2,%eax
+  803b04:	0f 85 80 00 00 00    	jne    803b8a <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  803b0a:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  803b0d:	c1 e6 02             	shl    $0x2,%esi
+  803b10:	eb 05                	jmp    803b17 <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  803b12:	e8 a8 d3 ff ff       	call   800ebf <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  803b17:	8b 8e 40 74 80 00    	mov    0x807440(%esi),%ecx
+  803b1d:	89 ca                	mov    %ecx,%edx
+  803b1f:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  803b25:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803b28:	c1 e0 04             	shl    $0x4,%eax
+  803b2b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803b30:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  803b33:	39 c1                	cmp    %eax,%ecx
+  803b35:	75 12                	jne    803b49 <pthread_join+0xac>
+  803b37:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803b3a:	c1 e0 04             	shl    $0x4,%eax
+  803b3d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803b42:	8b 40 54             	mov    0x54(%eax),%eax
+  803b45:	85 c0                	test   %eax,%eax
+  803b47:	75 c9                	jne    803b12 <pthread_join+0x75>
+	if (ret_store)
+  803b49:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803b4d:	74 0f                	je     803b5e <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  803b4f:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803b52:	8b 04 85 50 74 80 00 	mov    0x807450(,%eax,4),%eax
+  803b59:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803b5c:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  803b5e:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803b61:	8d 04 85 40 74 80 00 	lea    0x807440(,%eax,4),%eax
+  803b68:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  803b6f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b74:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803b77:	5b                   	pop    %ebx
+  803b78:	5e                   	pop    %esi
+  803b79:	5f                   	pop    %edi
+  803b7a:	5d                   	pop    %ebp
+  803b7b:	c3                   	ret
+		return -E_INVAL;
+  803b7c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803b81:	eb f1                	jmp    803b74 <pthread_join+0xd7>
+  803b83:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803b88:	eb ea                	jmp    803b74 <pthread_join+0xd7>
+		return -E_INVAL;
+  803b8a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803b8f:	eb e3                	jmp    803b74 <pthread_join+0xd7>
+
+00803b91 <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  803b91:	55                   	push   %ebp
+  803b92:	89 e5                	mov    %esp,%ebp
+  803b94:	53                   	push   %ebx
+  803b95:	83 ec 04             	sub    $0x4,%esp
+  803b98:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803b9a:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803ba0:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803ba5:	77 0c                	ja     803bb3 <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803ba7:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803bac:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  803bae:	c1 e8 10             	shr    $0x10,%eax
+  803bb1:	75 0a                	jne    803bbd <pthread_exit+0x2c>
+		exit();
+  803bb3:	e8 1e c7 ff ff       	call   8002d6 <exit>
+  803bb8:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  803bbd:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  803bc4:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  803bc7:	8d 0c 8d 40 74 80 00 	lea    0x807440(,%ecx,4),%ecx
+  803bce:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803bd1:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  803bd4:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  803bdb:	83 ec 08             	sub    $0x8,%esp
+  803bde:	6a 20                	push   $0x20
+  803be0:	01 c2                	add    %eax,%edx
+  803be2:	8d 04 95 44 74 80 00 	lea    0x807444(,%edx,4),%eax
+  803be9:	50                   	push   %eax
+  803bea:	e8 40 d6 ff ff       	call   80122f <sys_futex_wake>
+	sys_env_destroy(0);
+  803bef:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  803bf6:	e8 4d d2 ff ff       	call   800e48 <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  803bfb:	83 c4 0c             	add    $0xc,%esp
+  803bfe:	68 56 4f 80 00       	push   $0x804f56
+  803c03:	68 a5 00 00 00       	push   $0xa5
+  803c08:	68 70 4f 80 00       	push   $0x804f70
+  803c0d:	e8 ec c6 ff ff       	call   8002fe <_panic>
+
+00803c12 <pthread_start>:
+{
+  803c12:	55                   	push   %ebp
+  803c13:	89 e5                	mov    %esp,%ebp
+  803c15:	53                   	push   %ebx
+  803c16:	83 ec 04             	sub    $0x4,%esp
+  803c19:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  803c1c:	e8 72 d2 ff ff       	call   800e93 <sys_getenvid>
+  803c21:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  803c26:	8b 15 c0 76 80 00    	mov    0x8076c0,%edx
+	if (t == 0)
+  803c2c:	85 db                	test   %ebx,%ebx
+  803c2e:	74 0c                	je     803c3c <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803c30:	89 d9                	mov    %ebx,%ecx
+  803c32:	c1 e1 10             	shl    $0x10,%ecx
+  803c35:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803c3a:	29 ca                	sub    %ecx,%edx
+  803c3c:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  803c3f:	c1 e0 04             	shl    $0x4,%eax
+  803c42:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803c47:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  803c49:	83 ec 0c             	sub    $0xc,%esp
+  803c4c:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803c53:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803c56:	ff 34 95 4c 74 80 00 	push   0x80744c(,%edx,4)
+  803c5d:	ff 14 95 48 74 80 00 	call   *0x807448(,%edx,4)
+  803c64:	89 04 24             	mov    %eax,(%esp)
+  803c67:	e8 25 ff ff ff       	call   803b91 <pthread_exit>
+
+00803c6c <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  803c6c:	55                   	push   %ebp
+  803c6d:	89 e5                	mov    %esp,%ebp
+  803c6f:	57                   	push   %edi
+  803c70:	56                   	push   %esi
+  803c71:	53                   	push   %ebx
+  803c72:	83 ec 1c             	sub    $0x1c,%esp
+  803c75:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803c77:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  803c7d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803c84:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803c89:	77 0d                	ja     803c98 <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803c8b:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803c90:	29 d0                	sub    %edx,%eax
+  803c92:	c1 e8 10             	shr    $0x10,%eax
+  803c95:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  803c98:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803c9d:	eb 2f                	jmp    803cce <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  803c9f:	8b 0d c0 76 80 00    	mov    0x8076c0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803ca5:	8b 01                	mov    (%ecx),%eax
+  803ca7:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  803caa:	39 c2                	cmp    %eax,%edx
+  803cac:	75 14                	jne    803cc2 <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  803cae:	83 ec 0c             	sub    $0xc,%esp
+  803cb1:	57                   	push   %edi
+  803cb2:	e8 91 d1 ff ff       	call   800e48 <sys_env_destroy>
+  803cb7:	83 c4 10             	add    $0x10,%esp
+  803cba:	85 c0                	test   %eax,%eax
+  803cbc:	0f 88 97 00 00 00    	js     803d59 <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  803cc2:	83 c3 01             	add    $0x1,%ebx
+  803cc5:	83 fb 20             	cmp    $0x20,%ebx
+  803cc8:	0f 84 d2 00 00 00    	je     803da0 <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  803cce:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  803cd1:	74 ef                	je     803cc2 <pthread_kill_others+0x56>
+  803cd3:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803cd6:	8d 04 85 40 74 80 00 	lea    0x807440(,%eax,4),%eax
+  803cdd:	8b 40 04             	mov    0x4(%eax),%eax
+  803ce0:	83 f8 01             	cmp    $0x1,%eax
+  803ce3:	75 dd                	jne    803cc2 <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  803ce5:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803ce8:	8b 3c 85 40 74 80 00 	mov    0x807440(,%eax,4),%edi
+  803cef:	89 fe                	mov    %edi,%esi
+  803cf1:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  803cf7:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803cfa:	c1 e0 04             	shl    $0x4,%eax
+  803cfd:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803d02:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803d05:	39 c7                	cmp    %eax,%edi
+  803d07:	75 b9                	jne    803cc2 <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  803d09:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803d0c:	c1 e0 04             	shl    $0x4,%eax
+  803d0f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803d14:	8b 40 54             	mov    0x54(%eax),%eax
+  803d17:	85 c0                	test   %eax,%eax
+  803d19:	74 a7                	je     803cc2 <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803d1b:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803d1e:	c1 e0 04             	shl    $0x4,%eax
+  803d21:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  803d27:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803d29:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  803d2f:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803d34:	0f 87 65 ff ff ff    	ja     803c9f <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803d3a:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803d3f:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  803d41:	c1 e8 10             	shr    $0x10,%eax
+  803d44:	0f 84 55 ff ff ff    	je     803c9f <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803d4a:	c1 e0 10             	shl    $0x10,%eax
+  803d4d:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  803d52:	29 c1                	sub    %eax,%ecx
+  803d54:	e9 4c ff ff ff       	jmp    803ca5 <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  803d59:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  803d5c:	c1 e2 04             	shl    $0x4,%edx
+  803d5f:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803d65:	8b 52 48             	mov    0x48(%edx),%edx
+  803d68:	39 fa                	cmp    %edi,%edx
+  803d6a:	0f 85 52 ff ff ff    	jne    803cc2 <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  803d70:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  803d73:	c1 e2 04             	shl    $0x4,%edx
+  803d76:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803d7c:	8b 52 54             	mov    0x54(%edx),%edx
+  803d7f:	85 d2                	test   %edx,%edx
+  803d81:	0f 84 3b ff ff ff    	je     803cc2 <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  803d87:	83 ec 0c             	sub    $0xc,%esp
+  803d8a:	50                   	push   %eax
+  803d8b:	57                   	push   %edi
+  803d8c:	68 80 4f 80 00       	push   $0x804f80
+  803d91:	68 bb 00 00 00       	push   $0xbb
+  803d96:	68 70 4f 80 00       	push   $0x804f70
+  803d9b:	e8 5e c5 ff ff       	call   8002fe <_panic>
+	}
+}
+  803da0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803da3:	5b                   	pop    %ebx
+  803da4:	5e                   	pop    %esi
+  803da5:	5f                   	pop    %edi
+  803da6:	5d                   	pop    %ebp
+  803da7:	c3                   	ret
+
+00803da8 <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  803da8:	55                   	push   %ebp
+  803da9:	89 e5                	mov    %esp,%ebp
+  803dab:	53                   	push   %ebx
+  803dac:	83 ec 04             	sub    $0x4,%esp
+  803daf:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803db1:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  803db7:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803dbd:	0f 87 85 00 00 00    	ja     803e48 <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803dc3:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  803dc8:	29 c3                	sub    %eax,%ebx
+  803dca:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  803dcd:	83 ec 04             	sub    $0x4,%esp
+  803dd0:	68 80 02 00 00       	push   $0x280
+  803dd5:	6a 00                	push   $0x0
+  803dd7:	68 40 74 80 00       	push   $0x807440
+  803ddc:	e8 1d ce ff ff       	call   800bfe <memset>
+	threads_mu.m_state = 0;
+  803de1:	c7 05 20 74 80 00 00 	movl   $0x0,0x807420
+  803de8:	00 00 00 
+	if (self != 0) {
+  803deb:	83 c4 10             	add    $0x10,%esp
+  803dee:	85 db                	test   %ebx,%ebx
+  803df0:	74 51                	je     803e43 <pthread_fork_child+0x9b>
+  803df2:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803df4:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803dfa:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803dff:	77 18                	ja     803e19 <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803e01:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803e06:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803e08:	c1 e8 10             	shr    $0x10,%eax
+  803e0b:	74 0c                	je     803e19 <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803e0d:	c1 e0 10             	shl    $0x10,%eax
+  803e10:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803e15:	29 c2                	sub    %eax,%edx
+  803e17:	eb 06                	jmp    803e1f <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  803e19:	8b 15 c0 76 80 00    	mov    0x8076c0,%edx
+		threads[self].th_env = thisenv->env_id;
+  803e1f:	8b 02                	mov    (%edx),%eax
+  803e21:	8b 48 48             	mov    0x48(%eax),%ecx
+  803e24:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803e2b:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803e2e:	89 0c 95 40 74 80 00 	mov    %ecx,0x807440(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  803e35:	8d 04 95 40 74 80 00 	lea    0x807440(,%edx,4),%eax
+  803e3c:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  803e43:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803e46:	c9                   	leave
+  803e47:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  803e48:	83 ec 04             	sub    $0x4,%esp
+  803e4b:	68 80 02 00 00       	push   $0x280
+  803e50:	6a 00                	push   $0x0
+  803e52:	68 40 74 80 00       	push   $0x807440
+  803e57:	e8 a2 cd ff ff       	call   800bfe <memset>
+	threads_mu.m_state = 0;
+  803e5c:	c7 05 20 74 80 00 00 	movl   $0x0,0x807420
+  803e63:	00 00 00 
+  803e66:	83 c4 10             	add    $0x10,%esp
+  803e69:	eb d8                	jmp    803e43 <pthread_fork_child+0x9b>
+
+00803e6b <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  803e6b:	55                   	push   %ebp
+  803e6c:	89 e5                	mov    %esp,%ebp
+  803e6e:	57                   	push   %edi
+  803e6f:	56                   	push   %esi
+  803e70:	53                   	push   %ebx
+  803e71:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  803e74:	89 d6                	mov    %edx,%esi
+  803e76:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  803e79:	89 cf                	mov    %ecx,%edi
+  803e7b:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  803e7e:	89 fa                	mov    %edi,%edx
+  803e80:	80 ce 08             	or     $0x8,%dh
+  803e83:	f6 c5 08             	test   $0x8,%ch
+  803e86:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  803e89:	57                   	push   %edi
+  803e8a:	56                   	push   %esi
+  803e8b:	50                   	push   %eax
+  803e8c:	56                   	push   %esi
+  803e8d:	6a 00                	push   $0x0
+  803e8f:	e8 a4 d0 ff ff       	call   800f38 <sys_page_map>
+	if (r < 0) {
+  803e94:	83 c4 20             	add    $0x20,%esp
+  803e97:	85 c0                	test   %eax,%eax
+  803e99:	78 27                	js     803ec2 <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  803e9b:	83 ec 0c             	sub    $0xc,%esp
+  803e9e:	57                   	push   %edi
+  803e9f:	56                   	push   %esi
+  803ea0:	6a 00                	push   $0x0
+  803ea2:	56                   	push   %esi
+  803ea3:	6a 00                	push   $0x0
+  803ea5:	e8 8e d0 ff ff       	call   800f38 <sys_page_map>
+  803eaa:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803eac:	83 c4 20             	add    $0x20,%esp
+  803eaf:	85 c0                	test   %eax,%eax
+  803eb1:	78 24                	js     803ed7 <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  803eb3:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803eb8:	89 d8                	mov    %ebx,%eax
+  803eba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ebd:	5b                   	pop    %ebx
+  803ebe:	5e                   	pop    %esi
+  803ebf:	5f                   	pop    %edi
+  803ec0:	5d                   	pop    %ebp
+  803ec1:	c3                   	ret
+  803ec2:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803ec4:	83 ec 08             	sub    $0x8,%esp
+  803ec7:	50                   	push   %eax
+  803ec8:	68 a8 4f 80 00       	push   $0x804fa8
+  803ecd:	e8 07 c5 ff ff       	call   8003d9 <cprintf>
+		return r;
+  803ed2:	83 c4 10             	add    $0x10,%esp
+  803ed5:	eb e1                	jmp    803eb8 <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  803ed7:	83 ec 08             	sub    $0x8,%esp
+  803eda:	50                   	push   %eax
+  803edb:	68 d8 4f 80 00       	push   $0x804fd8
+  803ee0:	e8 f4 c4 ff ff       	call   8003d9 <cprintf>
+		return r;
+  803ee5:	83 c4 10             	add    $0x10,%esp
+  803ee8:	eb ce                	jmp    803eb8 <duppage_cow+0x4d>
+
+00803eea <duppage>:
+{
+  803eea:	55                   	push   %ebp
+  803eeb:	89 e5                	mov    %esp,%ebp
+  803eed:	53                   	push   %ebx
+  803eee:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  803ef1:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  803ef4:	51                   	push   %ecx
+  803ef5:	52                   	push   %edx
+  803ef6:	50                   	push   %eax
+  803ef7:	52                   	push   %edx
+  803ef8:	6a 00                	push   $0x0
+  803efa:	e8 39 d0 ff ff       	call   800f38 <sys_page_map>
+	if (r < 0) {
+  803eff:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  803f02:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  803f07:	85 c0                	test   %eax,%eax
+  803f09:	78 07                	js     803f12 <duppage+0x28>
+}
+  803f0b:	89 d8                	mov    %ebx,%eax
+  803f0d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803f10:	c9                   	leave
+  803f11:	c3                   	ret
+  803f12:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803f14:	83 ec 08             	sub    $0x8,%esp
+  803f17:	50                   	push   %eax
+  803f18:	68 a8 4f 80 00       	push   $0x804fa8
+  803f1d:	e8 b7 c4 ff ff       	call   8003d9 <cprintf>
+		return r;
+  803f22:	83 c4 10             	add    $0x10,%esp
+  803f25:	eb e4                	jmp    803f0b <duppage+0x21>
+
+00803f27 <cow_copy>:
+{
+  803f27:	55                   	push   %ebp
+  803f28:	89 e5                	mov    %esp,%ebp
+  803f2a:	56                   	push   %esi
+  803f2b:	53                   	push   %ebx
+  803f2c:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  803f2e:	83 ec 04             	sub    $0x4,%esp
+  803f31:	6a 07                	push   $0x7
+  803f33:	68 00 f0 7f 00       	push   $0x7ff000
+  803f38:	6a 00                	push   $0x0
+  803f3a:	e8 ac cf ff ff       	call   800eeb <sys_page_alloc>
+	if (r < 0) {
+  803f3f:	83 c4 10             	add    $0x10,%esp
+  803f42:	85 c0                	test   %eax,%eax
+  803f44:	78 58                	js     803f9e <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  803f46:	83 ec 04             	sub    $0x4,%esp
+  803f49:	68 00 10 00 00       	push   $0x1000
+  803f4e:	56                   	push   %esi
+  803f4f:	68 00 f0 7f 00       	push   $0x7ff000
+  803f54:	e8 da cc ff ff       	call   800c33 <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  803f59:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  803f60:	56                   	push   %esi
+  803f61:	6a 00                	push   $0x0
+  803f63:	68 00 f0 7f 00       	push   $0x7ff000
+  803f68:	6a 00                	push   $0x0
+  803f6a:	e8 c9 cf ff ff       	call   800f38 <sys_page_map>
+  803f6f:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803f71:	83 c4 20             	add    $0x20,%esp
+  803f74:	85 c0                	test   %eax,%eax
+  803f76:	78 3b                	js     803fb3 <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  803f78:	83 ec 08             	sub    $0x8,%esp
+  803f7b:	68 00 f0 7f 00       	push   $0x7ff000
+  803f80:	6a 00                	push   $0x0
+  803f82:	e8 fd cf ff ff       	call   800f84 <sys_page_unmap>
+  803f87:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803f89:	83 c4 10             	add    $0x10,%esp
+  803f8c:	85 c0                	test   %eax,%eax
+  803f8e:	78 45                	js     803fd5 <cow_copy+0xae>
+	return 0;
+  803f90:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803f95:	89 d8                	mov    %ebx,%eax
+  803f97:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803f9a:	5b                   	pop    %ebx
+  803f9b:	5e                   	pop    %esi
+  803f9c:	5d                   	pop    %ebp
+  803f9d:	c3                   	ret
+  803f9e:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  803fa0:	83 ec 08             	sub    $0x8,%esp
+  803fa3:	50                   	push   %eax
+  803fa4:	68 c8 50 80 00       	push   $0x8050c8
+  803fa9:	e8 2b c4 ff ff       	call   8003d9 <cprintf>
+		return r;
+  803fae:	83 c4 10             	add    $0x10,%esp
+  803fb1:	eb e2                	jmp    803f95 <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  803fb3:	83 ec 08             	sub    $0x8,%esp
+  803fb6:	50                   	push   %eax
+  803fb7:	68 e4 50 80 00       	push   $0x8050e4
+  803fbc:	e8 18 c4 ff ff       	call   8003d9 <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  803fc1:	83 c4 08             	add    $0x8,%esp
+  803fc4:	68 00 f0 7f 00       	push   $0x7ff000
+  803fc9:	6a 00                	push   $0x0
+  803fcb:	e8 b4 cf ff ff       	call   800f84 <sys_page_unmap>
+		return r;
+  803fd0:	83 c4 10             	add    $0x10,%esp
+  803fd3:	eb c0                	jmp    803f95 <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  803fd5:	83 ec 08             	sub    $0x8,%esp
+  803fd8:	50                   	push   %eax
+  803fd9:	68 00 50 80 00       	push   $0x805000
+  803fde:	e8 f6 c3 ff ff       	call   8003d9 <cprintf>
+		return r;
+  803fe3:	83 c4 10             	add    $0x10,%esp
+  803fe6:	eb ad                	jmp    803f95 <cow_copy+0x6e>
+
+00803fe8 <pgfault>:
+{
+  803fe8:	55                   	push   %ebp
+  803fe9:	89 e5                	mov    %esp,%ebp
+  803feb:	56                   	push   %esi
+  803fec:	53                   	push   %ebx
+  803fed:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  803ff0:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  803ff2:	89 d8                	mov    %ebx,%eax
+  803ff4:	c1 e8 16             	shr    $0x16,%eax
+  803ff7:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  803ffe:	89 de                	mov    %ebx,%esi
+  804000:	c1 ee 0c             	shr    $0xc,%esi
+  804003:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  80400a:	a8 07                	test   $0x7,%al
+  80400c:	74 3b                	je     804049 <pgfault+0x61>
+  80400e:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  804014:	74 33                	je     804049 <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  804016:	83 ec 0c             	sub    $0xc,%esp
+  804019:	68 00 f0 bf ee       	push   $0xeebff000
+  80401e:	e8 3c f6 ff ff       	call   80365f <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  804023:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  80402a:	83 c4 10             	add    $0x10,%esp
+  80402d:	f6 c4 08             	test   $0x8,%ah
+  804030:	75 30                	jne    804062 <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  804032:	83 ec 0c             	sub    $0xc,%esp
+  804035:	68 00 f0 bf ee       	push   $0xeebff000
+  80403a:	e8 8d f6 ff ff       	call   8036cc <mutex_unlock>
+}
+  80403f:	83 c4 10             	add    $0x10,%esp
+  804042:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804045:	5b                   	pop    %ebx
+  804046:	5e                   	pop    %esi
+  804047:	5d                   	pop    %ebp
+  804048:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  804049:	83 ec 08             	sub    $0x8,%esp
+  80404c:	ff 72 28             	push   0x28(%edx)
+  80404f:	51                   	push   %ecx
+  804050:	50                   	push   %eax
+  804051:	68 24 50 80 00       	push   $0x805024
+  804056:	6a 3f                	push   $0x3f
+  804058:	68 fe 50 80 00       	push   $0x8050fe
+  80405d:	e8 9c c2 ff ff       	call   8002fe <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  804062:	89 d8                	mov    %ebx,%eax
+  804064:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  804069:	e8 b9 fe ff ff       	call   803f27 <cow_copy>
+  80406e:	eb c2                	jmp    804032 <pgfault+0x4a>
+
+00804070 <cow_enable>:
+{
+  804070:	55                   	push   %ebp
+  804071:	89 e5                	mov    %esp,%ebp
+  804073:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  804076:	68 e8 3f 80 00       	push   $0x803fe8
+  80407b:	e8 28 06 00 00       	call   8046a8 <set_pgfault_handler>
+}
+  804080:	83 c4 10             	add    $0x10,%esp
+  804083:	c9                   	leave
+  804084:	c3                   	ret
+
+00804085 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  804085:	55                   	push   %ebp
+  804086:	89 e5                	mov    %esp,%ebp
+  804088:	57                   	push   %edi
+  804089:	56                   	push   %esi
+  80408a:	53                   	push   %ebx
+  80408b:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  80408e:	68 e8 3f 80 00       	push   $0x803fe8
+  804093:	e8 10 06 00 00       	call   8046a8 <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  804098:	b8 07 00 00 00       	mov    $0x7,%eax
+  80409d:	cd 30                	int    $0x30
+  80409f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  8040a2:	83 c4 10             	add    $0x10,%esp
+  8040a5:	85 c0                	test   %eax,%eax
+  8040a7:	78 4b                	js     8040f4 <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  8040a9:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8040ae:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8040b3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  8040b6:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8040ba:	0f 85 16 01 00 00    	jne    8041d6 <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8040c0:	e8 ce cd ff ff       	call   800e93 <sys_getenvid>
+  8040c5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8040ca:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8040cc:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  8040d2:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8040d8:	77 32                	ja     80410c <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8040da:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  8040df:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  8040e1:	c1 ea 10             	shr    $0x10,%edx
+  8040e4:	74 26                	je     80410c <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8040e6:	c1 e2 10             	shl    $0x10,%edx
+  8040e9:	89 d1                	mov    %edx,%ecx
+  8040eb:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8040f0:	29 ca                	sub    %ecx,%edx
+  8040f2:	eb 1e                	jmp    804112 <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  8040f4:	83 ec 08             	sub    $0x8,%esp
+  8040f7:	89 c7                	mov    %eax,%edi
+  8040f9:	50                   	push   %eax
+  8040fa:	68 09 51 80 00       	push   $0x805109
+  8040ff:	e8 d5 c2 ff ff       	call   8003d9 <cprintf>
+		return eid;
+  804104:	83 c4 10             	add    $0x10,%esp
+  804107:	e9 6c 01 00 00       	jmp    804278 <fork+0x1f3>
+		return pthread_main_tls;
+  80410c:	8b 15 c0 76 80 00    	mov    0x8076c0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  804112:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  804115:	c1 e0 04             	shl    $0x4,%eax
+  804118:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80411d:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  80411f:	e8 84 fc ff ff       	call   803da8 <pthread_fork_child>
+		return eid;
+  804124:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804127:	e9 4c 01 00 00       	jmp    804278 <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  80412c:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  804132:	89 da                	mov    %ebx,%edx
+  804134:	89 f8                	mov    %edi,%eax
+  804136:	e8 af fd ff ff       	call   803eea <duppage>
+  80413b:	85 c0                	test   %eax,%eax
+  80413d:	79 28                	jns    804167 <fork+0xe2>
+  80413f:	89 c7                	mov    %eax,%edi
+  804141:	e9 32 01 00 00       	jmp    804278 <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  804146:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  80414c:	83 f9 05             	cmp    $0x5,%ecx
+  80414f:	75 58                	jne    8041a9 <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  804151:	b9 05 00 00 00       	mov    $0x5,%ecx
+  804156:	89 da                	mov    %ebx,%edx
+  804158:	89 f8                	mov    %edi,%eax
+  80415a:	e8 8b fd ff ff       	call   803eea <duppage>
+  80415f:	85 c0                	test   %eax,%eax
+  804161:	0f 88 0f 01 00 00    	js     804276 <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  804167:	83 c3 01             	add    $0x1,%ebx
+  80416a:	39 de                	cmp    %ebx,%esi
+  80416c:	74 54                	je     8041c2 <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  80416e:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  804175:	f6 c1 05             	test   $0x5,%cl
+  804178:	74 ed                	je     804167 <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  80417a:	f6 c5 04             	test   $0x4,%ch
+  80417d:	75 ad                	jne    80412c <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  80417f:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  804185:	74 bf                	je     804146 <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  804187:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  80418d:	74 d8                	je     804167 <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  80418f:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  804195:	89 da                	mov    %ebx,%edx
+  804197:	89 f8                	mov    %edi,%eax
+  804199:	e8 cd fc ff ff       	call   803e6b <duppage_cow>
+  80419e:	85 c0                	test   %eax,%eax
+  8041a0:	79 c5                	jns    804167 <fork+0xe2>
+  8041a2:	89 c7                	mov    %eax,%edi
+  8041a4:	e9 cf 00 00 00       	jmp    804278 <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  8041a9:	68 54 50 80 00       	push   $0x805054
+  8041ae:	68 6d 4e 80 00       	push   $0x804e6d
+  8041b3:	68 c6 00 00 00       	push   $0xc6
+  8041b8:	68 fe 50 80 00       	push   $0x8050fe
+  8041bd:	e8 3c c1 ff ff       	call   8002fe <_panic>
+  8041c2:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8041c5:	83 c1 01             	add    $0x1,%ecx
+  8041c8:	81 c6 00 04 00 00    	add    $0x400,%esi
+  8041ce:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  8041d4:	74 18                	je     8041ee <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  8041d6:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  8041dd:	a8 07                	test   $0x7,%al
+  8041df:	74 e4                	je     8041c5 <fork+0x140>
+  8041e1:	89 cb                	mov    %ecx,%ebx
+  8041e3:	c1 e3 0a             	shl    $0xa,%ebx
+  8041e6:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8041e9:	e9 7c ff ff ff       	jmp    80416a <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  8041ee:	83 ec 04             	sub    $0x4,%esp
+  8041f1:	6a 07                	push   $0x7
+  8041f3:	68 00 f0 bf ee       	push   $0xeebff000
+  8041f8:	ff 75 e4             	push   -0x1c(%ebp)
+  8041fb:	e8 eb cc ff ff       	call   800eeb <sys_page_alloc>
+  804200:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804202:	83 c4 10             	add    $0x10,%esp
+  804205:	85 c0                	test   %eax,%eax
+  804207:	78 34                	js     80423d <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  804209:	83 ec 08             	sub    $0x8,%esp
+  80420c:	68 e6 46 80 00       	push   $0x8046e6
+  804211:	ff 75 e4             	push   -0x1c(%ebp)
+  804214:	e8 4f ce ff ff       	call   801068 <sys_env_set_pgfault_upcall>
+  804219:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80421b:	83 c4 10             	add    $0x10,%esp
+  80421e:	85 c0                	test   %eax,%eax
+  804220:	78 2e                	js     804250 <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  804222:	83 ec 08             	sub    $0x8,%esp
+  804225:	6a 02                	push   $0x2
+  804227:	ff 75 e4             	push   -0x1c(%ebp)
+  80422a:	e8 a1 cd ff ff       	call   800fd0 <sys_env_set_status>
+  80422f:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804231:	83 c4 10             	add    $0x10,%esp
+  804234:	85 c0                	test   %eax,%eax
+  804236:	78 2b                	js     804263 <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  804238:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80423b:	eb 3b                	jmp    804278 <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  80423d:	83 ec 08             	sub    $0x8,%esp
+  804240:	50                   	push   %eax
+  804241:	68 7c 50 80 00       	push   $0x80507c
+  804246:	e8 8e c1 ff ff       	call   8003d9 <cprintf>
+		return r;
+  80424b:	83 c4 10             	add    $0x10,%esp
+  80424e:	eb 28                	jmp    804278 <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  804250:	83 ec 08             	sub    $0x8,%esp
+  804253:	50                   	push   %eax
+  804254:	68 a4 50 80 00       	push   $0x8050a4
+  804259:	e8 7b c1 ff ff       	call   8003d9 <cprintf>
+		return r;
+  80425e:	83 c4 10             	add    $0x10,%esp
+  804261:	eb 15                	jmp    804278 <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  804263:	83 ec 08             	sub    $0x8,%esp
+  804266:	50                   	push   %eax
+  804267:	68 19 51 80 00       	push   $0x805119
+  80426c:	e8 68 c1 ff ff       	call   8003d9 <cprintf>
+		return r;
+  804271:	83 c4 10             	add    $0x10,%esp
+  804274:	eb 02                	jmp    804278 <fork+0x1f3>
+  804276:	89 c7                	mov    %eax,%edi
+}
+  804278:	89 f8                	mov    %edi,%eax
+  80427a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80427d:	5b                   	pop    %ebx
+  80427e:	5e                   	pop    %esi
+  80427f:	5f                   	pop    %edi
+  804280:	5d                   	pop    %ebp
+  804281:	c3                   	ret
+
+00804282 <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  804282:	55                   	push   %ebp
+  804283:	89 e5                	mov    %esp,%ebp
+  804285:	57                   	push   %edi
+  804286:	56                   	push   %esi
+  804287:	53                   	push   %ebx
+  804288:	83 ec 2c             	sub    $0x2c,%esp
+  80428b:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80428d:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  804293:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804298:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  80429e:	77 0a                	ja     8042aa <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8042a0:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  8042a5:	29 c3                	sub    %eax,%ebx
+  8042a7:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  8042aa:	83 ec 0c             	sub    $0xc,%esp
+  8042ad:	68 e8 3f 80 00       	push   $0x803fe8
+  8042b2:	e8 f1 03 00 00       	call   8046a8 <set_pgfault_handler>
+  8042b7:	b8 07 00 00 00       	mov    $0x7,%eax
+  8042bc:	cd 30                	int    $0x30
+  8042be:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  8042c1:	83 c4 10             	add    $0x10,%esp
+  8042c4:	85 c0                	test   %eax,%eax
+  8042c6:	78 30                	js     8042f8 <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  8042c8:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8042cc:	74 42                	je     804310 <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  8042ce:	c1 e3 10             	shl    $0x10,%ebx
+  8042d1:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  8042d6:	29 d8                	sub    %ebx,%eax
+  8042d8:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8042db:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  8042e0:	29 d8                	sub    %ebx,%eax
+  8042e2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8042e5:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8042ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042ef:	89 f7                	mov    %esi,%edi
+  8042f1:	89 d6                	mov    %edx,%esi
+  8042f3:	e9 2c 01 00 00       	jmp    804424 <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  8042f8:	83 ec 08             	sub    $0x8,%esp
+  8042fb:	89 c7                	mov    %eax,%edi
+  8042fd:	50                   	push   %eax
+  8042fe:	68 09 51 80 00       	push   $0x805109
+  804303:	e8 d1 c0 ff ff       	call   8003d9 <cprintf>
+		return eid;
+  804308:	83 c4 10             	add    $0x10,%esp
+  80430b:	e9 d5 00 00 00       	jmp    8043e5 <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  804310:	e8 7e cb ff ff       	call   800e93 <sys_getenvid>
+  804315:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80431a:	89 c2                	mov    %eax,%edx
+  80431c:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80431e:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  804324:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804329:	77 18                	ja     804343 <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80432b:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804330:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  804332:	c1 e8 10             	shr    $0x10,%eax
+  804335:	74 0c                	je     804343 <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804337:	c1 e0 10             	shl    $0x10,%eax
+  80433a:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80433f:	29 c1                	sub    %eax,%ecx
+  804341:	eb 06                	jmp    804349 <sfork+0xc7>
+		return pthread_main_tls;
+  804343:	8b 0d c0 76 80 00    	mov    0x8076c0,%ecx
+  804349:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80434c:	c1 e0 04             	shl    $0x4,%eax
+  80434f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804354:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  804356:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  804359:	e9 87 00 00 00       	jmp    8043e5 <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  80435e:	f6 c5 04             	test   $0x4,%ch
+  804361:	74 6c                	je     8043cf <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  804363:	89 ca                	mov    %ecx,%edx
+  804365:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  80436b:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  804371:	74 7c                	je     8043ef <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  804373:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  804379:	89 da                	mov    %ebx,%edx
+  80437b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80437e:	e8 67 fb ff ff       	call   803eea <duppage>
+  804383:	85 c0                	test   %eax,%eax
+  804385:	0f 88 4f 01 00 00    	js     8044da <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  80438b:	83 c3 01             	add    $0x1,%ebx
+  80438e:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  804391:	74 7a                	je     80440d <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  804393:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  804395:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  80439c:	f6 c1 01             	test   $0x1,%cl
+  80439f:	74 ea                	je     80438b <sfork+0x109>
+  8043a1:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8043a7:	74 e2                	je     80438b <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  8043a9:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  8043af:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  8043b2:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  8043b7:	76 a5                	jbe    80435e <sfork+0xdc>
+  8043b9:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  8043bf:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8043c2:	39 fa                	cmp    %edi,%edx
+  8043c4:	73 9d                	jae    804363 <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  8043c6:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  8043c9:	39 fa                	cmp    %edi,%edx
+  8043cb:	72 96                	jb     804363 <sfork+0xe1>
+  8043cd:	eb 8f                	jmp    80435e <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8043cf:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8043d5:	89 da                	mov    %ebx,%edx
+  8043d7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8043da:	e8 8c fa ff ff       	call   803e6b <duppage_cow>
+  8043df:	85 c0                	test   %eax,%eax
+  8043e1:	79 a8                	jns    80438b <sfork+0x109>
+  8043e3:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  8043e5:	89 f8                	mov    %edi,%eax
+  8043e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8043ea:	5b                   	pop    %ebx
+  8043eb:	5e                   	pop    %esi
+  8043ec:	5f                   	pop    %edi
+  8043ed:	5d                   	pop    %ebp
+  8043ee:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  8043ef:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  8043f4:	e8 2e fb ff ff       	call   803f27 <cow_copy>
+  8043f9:	85 c0                	test   %eax,%eax
+  8043fb:	0f 88 d2 00 00 00    	js     8044d3 <sfork+0x251>
+				pte = uvpt[pn];
+  804401:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  804408:	e9 66 ff ff ff       	jmp    804373 <sfork+0xf1>
+  80440d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804410:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804413:	83 c6 01             	add    $0x1,%esi
+  804416:	81 c7 00 04 00 00    	add    $0x400,%edi
+  80441c:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  804422:	74 1b                	je     80443f <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  804424:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  80442b:	a8 01                	test   $0x1,%al
+  80442d:	74 e4                	je     804413 <sfork+0x191>
+  80442f:	89 f3                	mov    %esi,%ebx
+  804431:	c1 e3 0a             	shl    $0xa,%ebx
+  804434:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  804437:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  80443a:	e9 4f ff ff ff       	jmp    80438e <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  80443f:	83 ec 04             	sub    $0x4,%esp
+  804442:	6a 07                	push   $0x7
+  804444:	68 00 f0 bf ee       	push   $0xeebff000
+  804449:	ff 75 e0             	push   -0x20(%ebp)
+  80444c:	e8 9a ca ff ff       	call   800eeb <sys_page_alloc>
+  804451:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804453:	83 c4 10             	add    $0x10,%esp
+  804456:	85 c0                	test   %eax,%eax
+  804458:	78 37                	js     804491 <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  80445a:	83 ec 08             	sub    $0x8,%esp
+  80445d:	68 e6 46 80 00       	push   $0x8046e6
+  804462:	ff 75 e0             	push   -0x20(%ebp)
+  804465:	e8 fe cb ff ff       	call   801068 <sys_env_set_pgfault_upcall>
+  80446a:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80446c:	83 c4 10             	add    $0x10,%esp
+  80446f:	85 c0                	test   %eax,%eax
+  804471:	78 34                	js     8044a7 <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  804473:	83 ec 08             	sub    $0x8,%esp
+  804476:	6a 02                	push   $0x2
+  804478:	ff 75 e0             	push   -0x20(%ebp)
+  80447b:	e8 50 cb ff ff       	call   800fd0 <sys_env_set_status>
+  804480:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804482:	83 c4 10             	add    $0x10,%esp
+  804485:	85 c0                	test   %eax,%eax
+  804487:	78 34                	js     8044bd <sfork+0x23b>
+	return eid;
+  804489:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  80448c:	e9 54 ff ff ff       	jmp    8043e5 <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  804491:	83 ec 08             	sub    $0x8,%esp
+  804494:	50                   	push   %eax
+  804495:	68 7c 50 80 00       	push   $0x80507c
+  80449a:	e8 3a bf ff ff       	call   8003d9 <cprintf>
+		return r;
+  80449f:	83 c4 10             	add    $0x10,%esp
+  8044a2:	e9 3e ff ff ff       	jmp    8043e5 <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  8044a7:	83 ec 08             	sub    $0x8,%esp
+  8044aa:	50                   	push   %eax
+  8044ab:	68 a4 50 80 00       	push   $0x8050a4
+  8044b0:	e8 24 bf ff ff       	call   8003d9 <cprintf>
+		return r;
+  8044b5:	83 c4 10             	add    $0x10,%esp
+  8044b8:	e9 28 ff ff ff       	jmp    8043e5 <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  8044bd:	83 ec 08             	sub    $0x8,%esp
+  8044c0:	50                   	push   %eax
+  8044c1:	68 19 51 80 00       	push   $0x805119
+  8044c6:	e8 0e bf ff ff       	call   8003d9 <cprintf>
+		return r;
+  8044cb:	83 c4 10             	add    $0x10,%esp
+  8044ce:	e9 12 ff ff ff       	jmp    8043e5 <sfork+0x163>
+  8044d3:	89 c7                	mov    %eax,%edi
+  8044d5:	e9 0b ff ff ff       	jmp    8043e5 <sfork+0x163>
+  8044da:	89 c7                	mov    %eax,%edi
+  8044dc:	e9 04 ff ff ff       	jmp    8043e5 <sfork+0x163>
+
+008044e1 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8044e1:	55                   	push   %ebp
+  8044e2:	89 e5                	mov    %esp,%ebp
+  8044e4:	57                   	push   %edi
+  8044e5:	56                   	push   %esi
+  8044e6:	53                   	push   %ebx
+  8044e7:	83 ec 18             	sub    $0x18,%esp
+  8044ea:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8044ed:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8044f0:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  8044f3:	85 c0                	test   %eax,%eax
+  8044f5:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8044fa:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  8044fd:	50                   	push   %eax
+  8044fe:	e8 de cb ff ff       	call   8010e1 <sys_ipc_recv>
+	if (r < 0) {
+  804503:	83 c4 10             	add    $0x10,%esp
+  804506:	85 c0                	test   %eax,%eax
+  804508:	78 2b                	js     804535 <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  80450a:	85 ff                	test   %edi,%edi
+  80450c:	74 55                	je     804563 <ipc_recv+0x82>
+  80450e:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804510:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804516:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80451b:	77 39                	ja     804556 <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80451d:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804522:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804524:	c1 e8 10             	shr    $0x10,%eax
+  804527:	74 2d                	je     804556 <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804529:	c1 e0 10             	shl    $0x10,%eax
+  80452c:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804531:	29 c2                	sub    %eax,%edx
+  804533:	eb 27                	jmp    80455c <ipc_recv+0x7b>
+  804535:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  804537:	83 ec 08             	sub    $0x8,%esp
+  80453a:	50                   	push   %eax
+  80453b:	68 37 51 80 00       	push   $0x805137
+  804540:	e8 94 be ff ff       	call   8003d9 <cprintf>
+		*from_env_store = 0;
+  804545:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  80454b:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  804551:	83 c4 10             	add    $0x10,%esp
+  804554:	eb 77                	jmp    8045cd <ipc_recv+0xec>
+		return pthread_main_tls;
+  804556:	8b 15 c0 76 80 00    	mov    0x8076c0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  80455c:	8b 02                	mov    (%edx),%eax
+  80455e:	8b 40 78             	mov    0x78(%eax),%eax
+  804561:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804563:	85 f6                	test   %esi,%esi
+  804565:	74 34                	je     80459b <ipc_recv+0xba>
+  804567:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804569:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80456f:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804574:	77 18                	ja     80458e <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804576:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80457b:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80457d:	c1 e8 10             	shr    $0x10,%eax
+  804580:	74 0c                	je     80458e <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804582:	c1 e0 10             	shl    $0x10,%eax
+  804585:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80458a:	29 c2                	sub    %eax,%edx
+  80458c:	eb 06                	jmp    804594 <ipc_recv+0xb3>
+		return pthread_main_tls;
+  80458e:	8b 15 c0 76 80 00    	mov    0x8076c0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  804594:	8b 02                	mov    (%edx),%eax
+  804596:	8b 40 7c             	mov    0x7c(%eax),%eax
+  804599:	89 06                	mov    %eax,(%esi)
+  80459b:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80459d:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8045a3:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8045a8:	77 18                	ja     8045c2 <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8045aa:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8045af:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8045b1:	c1 e8 10             	shr    $0x10,%eax
+  8045b4:	74 0c                	je     8045c2 <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8045b6:	c1 e0 10             	shl    $0x10,%eax
+  8045b9:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8045be:	29 c2                	sub    %eax,%edx
+  8045c0:	eb 06                	jmp    8045c8 <ipc_recv+0xe7>
+		return pthread_main_tls;
+  8045c2:	8b 15 c0 76 80 00    	mov    0x8076c0,%edx
+	}
+	return thisenv->env_ipc_value;
+  8045c8:	8b 02                	mov    (%edx),%eax
+  8045ca:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  8045cd:	89 d8                	mov    %ebx,%eax
+  8045cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8045d2:	5b                   	pop    %ebx
+  8045d3:	5e                   	pop    %esi
+  8045d4:	5f                   	pop    %edi
+  8045d5:	5d                   	pop    %ebp
+  8045d6:	c3                   	ret
+
+008045d7 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8045d7:	55                   	push   %ebp
+  8045d8:	89 e5                	mov    %esp,%ebp
+  8045da:	57                   	push   %edi
+  8045db:	56                   	push   %esi
+  8045dc:	53                   	push   %ebx
+  8045dd:	83 ec 0c             	sub    $0xc,%esp
+  8045e0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8045e3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8045e6:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  8045e9:	85 db                	test   %ebx,%ebx
+  8045eb:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8045f0:	0f 44 d8             	cmove  %eax,%ebx
+  8045f3:	eb 05                	jmp    8045fa <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  8045f5:	e8 c5 c8 ff ff       	call   800ebf <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  8045fa:	57                   	push   %edi
+  8045fb:	53                   	push   %ebx
+  8045fc:	ff 75 0c             	push   0xc(%ebp)
+  8045ff:	56                   	push   %esi
+  804600:	e8 af ca ff ff       	call   8010b4 <sys_ipc_try_send>
+		if (r == 0) {
+  804605:	83 c4 10             	add    $0x10,%esp
+  804608:	85 c0                	test   %eax,%eax
+  80460a:	74 19                	je     804625 <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  80460c:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80460f:	74 e4                	je     8045f5 <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  804611:	83 ec 0c             	sub    $0xc,%esp
+  804614:	50                   	push   %eax
+  804615:	57                   	push   %edi
+  804616:	53                   	push   %ebx
+  804617:	56                   	push   %esi
+  804618:	68 50 51 80 00       	push   $0x805150
+  80461d:	e8 b7 bd ff ff       	call   8003d9 <cprintf>
+			return;
+  804622:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  804625:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804628:	5b                   	pop    %ebx
+  804629:	5e                   	pop    %esi
+  80462a:	5f                   	pop    %edi
+  80462b:	5d                   	pop    %ebp
+  80462c:	c3                   	ret
+
+0080462d <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80462d:	55                   	push   %ebp
+  80462e:	89 e5                	mov    %esp,%ebp
+  804630:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  804633:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  804638:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80463b:	c1 e0 04             	shl    $0x4,%eax
+  80463e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804643:	8b 40 50             	mov    0x50(%eax),%eax
+  804646:	39 c8                	cmp    %ecx,%eax
+  804648:	74 12                	je     80465c <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80464a:	83 c2 01             	add    $0x1,%edx
+  80464d:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  804653:	75 e3                	jne    804638 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  804655:	b8 00 00 00 00       	mov    $0x0,%eax
+  80465a:	eb 0e                	jmp    80466a <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80465c:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80465f:	c1 e0 04             	shl    $0x4,%eax
+  804662:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804667:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80466a:	5d                   	pop    %ebp
+  80466b:	c3                   	ret
+
+0080466c <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80466c:	55                   	push   %ebp
+  80466d:	89 e5                	mov    %esp,%ebp
+  80466f:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804672:	89 c2                	mov    %eax,%edx
+  804674:	c1 ea 16             	shr    $0x16,%edx
+  804677:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80467e:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804683:	f6 c1 01             	test   $0x1,%cl
+  804686:	74 1c                	je     8046a4 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  804688:	c1 e8 0c             	shr    $0xc,%eax
+  80468b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  804692:	a8 01                	test   $0x1,%al
+  804694:	74 0e                	je     8046a4 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  804696:	c1 e8 0c             	shr    $0xc,%eax
+  804699:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  8046a0:	ef 
+  8046a1:	0f b7 d2             	movzwl %dx,%edx
+}
+  8046a4:	89 d0                	mov    %edx,%eax
+  8046a6:	5d                   	pop    %ebp
+  8046a7:	c3                   	ret
+
+008046a8 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8046a8:	55                   	push   %ebp
+  8046a9:	89 e5                	mov    %esp,%ebp
+  8046ab:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  8046ae:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  8046b5:	74 0a                	je     8046c1 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8046b7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8046ba:	a3 00 a0 80 00       	mov    %eax,0x80a000
+}
+  8046bf:	c9                   	leave
+  8046c0:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  8046c1:	83 ec 04             	sub    $0x4,%esp
+  8046c4:	6a 07                	push   $0x7
+  8046c6:	68 00 f0 bf ee       	push   $0xeebff000
+  8046cb:	6a 00                	push   $0x0
+  8046cd:	e8 19 c8 ff ff       	call   800eeb <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8046d2:	83 c4 08             	add    $0x8,%esp
+  8046d5:	68 e6 46 80 00       	push   $0x8046e6
+  8046da:	6a 00                	push   $0x0
+  8046dc:	e8 87 c9 ff ff       	call   801068 <sys_env_set_pgfault_upcall>
+  8046e1:	83 c4 10             	add    $0x10,%esp
+  8046e4:	eb d1                	jmp    8046b7 <set_pgfault_handler+0xf>
+
+008046e6 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8046e6:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8046e7:	a1 00 a0 80 00       	mov    0x80a000,%eax
+	call *%eax
+  8046ec:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8046ee:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  8046f1:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  8046f5:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  8046f9:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  8046fc:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  804700:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  804702:	83 c4 08             	add    $0x8,%esp
+	popal
+  804705:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  804706:	83 c4 04             	add    $0x4,%esp
+	popfl
+  804709:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  80470a:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  80470b:	c3                   	ret
+
+0080470c <udm>:
+  80470c:	57                   	push   %edi
+  80470d:	56                   	push   %esi
+  80470e:	53                   	push   %ebx
+  80470f:	83 ec 20             	sub    $0x20,%esp
+  804712:	89 44 24 10          	mov    %eax,0x10(%esp)
+  804716:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80471a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80471e:	8b 54 24 34          	mov    0x34(%esp),%edx
+  804722:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804726:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80472a:	89 d1                	mov    %edx,%ecx
+  80472c:	09 c1                	or     %eax,%ecx
+  80472e:	0f 84 91 00 00 00    	je     8047c5 <udm+0xb9>
+  804734:	b8 00 00 00 00       	mov    $0x0,%eax
+  804739:	ba 00 00 00 00       	mov    $0x0,%edx
+  80473e:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804743:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80474a:	00 
+  80474b:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  804752:	00 
+  804753:	eb 08                	jmp    80475d <udm+0x51>
+  804755:	83 e9 01             	sub    $0x1,%ecx
+  804758:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80475b:	74 7c                	je     8047d9 <udm+0xcd>
+  80475d:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804761:	01 c0                	add    %eax,%eax
+  804763:	89 c6                	mov    %eax,%esi
+  804765:	89 d7                	mov    %edx,%edi
+  804767:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80476b:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80476f:	0f ad d0             	shrd   %cl,%edx,%eax
+  804772:	d3 ea                	shr    %cl,%edx
+  804774:	f6 c1 20             	test   $0x20,%cl
+  804777:	74 04                	je     80477d <udm+0x71>
+  804779:	89 d0                	mov    %edx,%eax
+  80477b:	31 d2                	xor    %edx,%edx
+  80477d:	83 e0 01             	and    $0x1,%eax
+  804780:	89 04 24             	mov    %eax,(%esp)
+  804783:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80478a:	00 
+  80478b:	8b 04 24             	mov    (%esp),%eax
+  80478e:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804792:	09 f0                	or     %esi,%eax
+  804794:	09 fa                	or     %edi,%edx
+  804796:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80479a:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  80479e:	39 f0                	cmp    %esi,%eax
+  8047a0:	89 d3                	mov    %edx,%ebx
+  8047a2:	19 fb                	sbb    %edi,%ebx
+  8047a4:	72 af                	jb     804755 <udm+0x49>
+  8047a6:	29 f0                	sub    %esi,%eax
+  8047a8:	19 fa                	sbb    %edi,%edx
+  8047aa:	89 cf                	mov    %ecx,%edi
+  8047ac:	c1 ef 05             	shr    $0x5,%edi
+  8047af:	83 e7 01             	and    $0x1,%edi
+  8047b2:	89 fe                	mov    %edi,%esi
+  8047b4:	83 f6 01             	xor    $0x1,%esi
+  8047b7:	d3 e6                	shl    %cl,%esi
+  8047b9:	d3 e7                	shl    %cl,%edi
+  8047bb:	09 74 24 18          	or     %esi,0x18(%esp)
+  8047bf:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8047c3:	eb 90                	jmp    804755 <udm+0x49>
+  8047c5:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8047c9:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8047cd:	89 f0                	mov    %esi,%eax
+  8047cf:	89 fa                	mov    %edi,%edx
+  8047d1:	89 74 24 18          	mov    %esi,0x18(%esp)
+  8047d5:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  8047d9:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  8047dd:	89 01                	mov    %eax,(%ecx)
+  8047df:	89 51 04             	mov    %edx,0x4(%ecx)
+  8047e2:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8047e6:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8047ea:	83 c4 20             	add    $0x20,%esp
+  8047ed:	5b                   	pop    %ebx
+  8047ee:	5e                   	pop    %esi
+  8047ef:	5f                   	pop    %edi
+  8047f0:	c3                   	ret
+
+008047f1 <__udivdi3>:
+  8047f1:	83 ec 18             	sub    $0x18,%esp
+  8047f4:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8047f8:	50                   	push   %eax
+  8047f9:	ff 74 24 2c          	push   0x2c(%esp)
+  8047fd:	ff 74 24 2c          	push   0x2c(%esp)
+  804801:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804805:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804809:	e8 fe fe ff ff       	call   80470c <udm>
+  80480e:	83 c4 24             	add    $0x24,%esp
+  804811:	c3                   	ret
+
+00804812 <__umoddi3>:
+  804812:	83 ec 18             	sub    $0x18,%esp
+  804815:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804819:	50                   	push   %eax
+  80481a:	ff 74 24 2c          	push   0x2c(%esp)
+  80481e:	ff 74 24 2c          	push   0x2c(%esp)
+  804822:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804826:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80482a:	e8 dd fe ff ff       	call   80470c <udm>
+  80482f:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804833:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804837:	83 c4 24             	add    $0x24,%esp
+  80483a:	c3                   	ret
+
+0080483b <__divdi3>:
+  80483b:	56                   	push   %esi
+  80483c:	53                   	push   %ebx
+  80483d:	83 ec 14             	sub    $0x14,%esp
+  804840:	8b 44 24 20          	mov    0x20(%esp),%eax
+  804844:	8b 54 24 24          	mov    0x24(%esp),%edx
+  804848:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  80484c:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  804850:	85 d2                	test   %edx,%edx
+  804852:	78 18                	js     80486c <__divdi3+0x31>
+  804854:	85 db                	test   %ebx,%ebx
+  804856:	78 3e                	js     804896 <__divdi3+0x5b>
+  804858:	83 ec 04             	sub    $0x4,%esp
+  80485b:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80485f:	56                   	push   %esi
+  804860:	53                   	push   %ebx
+  804861:	51                   	push   %ecx
+  804862:	e8 a5 fe ff ff       	call   80470c <udm>
+  804867:	83 c4 10             	add    $0x10,%esp
+  80486a:	eb 24                	jmp    804890 <__divdi3+0x55>
+  80486c:	f7 d8                	neg    %eax
+  80486e:	83 d2 00             	adc    $0x0,%edx
+  804871:	f7 da                	neg    %edx
+  804873:	85 db                	test   %ebx,%ebx
+  804875:	78 3a                	js     8048b1 <__divdi3+0x76>
+  804877:	83 ec 04             	sub    $0x4,%esp
+  80487a:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80487e:	56                   	push   %esi
+  80487f:	53                   	push   %ebx
+  804880:	51                   	push   %ecx
+  804881:	e8 86 fe ff ff       	call   80470c <udm>
+  804886:	83 c4 10             	add    $0x10,%esp
+  804889:	f7 d8                	neg    %eax
+  80488b:	83 d2 00             	adc    $0x0,%edx
+  80488e:	f7 da                	neg    %edx
+  804890:	83 c4 14             	add    $0x14,%esp
+  804893:	5b                   	pop    %ebx
+  804894:	5e                   	pop    %esi
+  804895:	c3                   	ret
+  804896:	83 ec 04             	sub    $0x4,%esp
+  804899:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80489d:	56                   	push   %esi
+  80489e:	f7 d9                	neg    %ecx
+  8048a0:	83 d3 00             	adc    $0x0,%ebx
+  8048a3:	f7 db                	neg    %ebx
+  8048a5:	53                   	push   %ebx
+  8048a6:	51                   	push   %ecx
+  8048a7:	e8 60 fe ff ff       	call   80470c <udm>
+  8048ac:	83 c4 10             	add    $0x10,%esp
+  8048af:	eb d8                	jmp    804889 <__divdi3+0x4e>
+  8048b1:	83 ec 04             	sub    $0x4,%esp
+  8048b4:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8048b8:	56                   	push   %esi
+  8048b9:	f7 d9                	neg    %ecx
+  8048bb:	83 d3 00             	adc    $0x0,%ebx
+  8048be:	f7 db                	neg    %ebx
+  8048c0:	53                   	push   %ebx
+  8048c1:	51                   	push   %ecx
+  8048c2:	e8 45 fe ff ff       	call   80470c <udm>
+  8048c7:	83 c4 10             	add    $0x10,%esp
+  8048ca:	eb c4                	jmp    804890 <__divdi3+0x55>
+
+008048cc <__moddi3>:
+  8048cc:	55                   	push   %ebp
+  8048cd:	57                   	push   %edi
+  8048ce:	56                   	push   %esi
+  8048cf:	53                   	push   %ebx
+  8048d0:	83 ec 24             	sub    $0x24,%esp
+  8048d3:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8048d7:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8048db:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8048df:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8048e3:	85 d2                	test   %edx,%edx
+  8048e5:	78 3b                	js     804922 <__moddi3+0x56>
+  8048e7:	83 ec 04             	sub    $0x4,%esp
+  8048ea:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8048ee:	56                   	push   %esi
+  8048ef:	89 ce                	mov    %ecx,%esi
+  8048f1:	f7 de                	neg    %esi
+  8048f3:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8048f7:	89 de                	mov    %ebx,%esi
+  8048f9:	83 d6 00             	adc    $0x0,%esi
+  8048fc:	f7 de                	neg    %esi
+  8048fe:	89 74 24 14          	mov    %esi,0x14(%esp)
+  804902:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804906:	0f 48 f1             	cmovs  %ecx,%esi
+  804909:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  80490e:	53                   	push   %ebx
+  80490f:	56                   	push   %esi
+  804910:	e8 f7 fd ff ff       	call   80470c <udm>
+  804915:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804919:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80491d:	83 c4 10             	add    $0x10,%esp
+  804920:	eb 47                	jmp    804969 <__moddi3+0x9d>
+  804922:	f7 d8                	neg    %eax
+  804924:	83 d2 00             	adc    $0x0,%edx
+  804927:	f7 da                	neg    %edx
+  804929:	83 ec 04             	sub    $0x4,%esp
+  80492c:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804930:	56                   	push   %esi
+  804931:	89 cf                	mov    %ecx,%edi
+  804933:	f7 df                	neg    %edi
+  804935:	89 de                	mov    %ebx,%esi
+  804937:	83 d6 00             	adc    $0x0,%esi
+  80493a:	f7 de                	neg    %esi
+  80493c:	0f 49 cf             	cmovns %edi,%ecx
+  80493f:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  804943:	0f 49 de             	cmovns %esi,%ebx
+  804946:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  80494a:	ff 74 24 0c          	push   0xc(%esp)
+  80494e:	ff 74 24 0c          	push   0xc(%esp)
+  804952:	e8 b5 fd ff ff       	call   80470c <udm>
+  804957:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80495b:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80495f:	f7 d8                	neg    %eax
+  804961:	83 d2 00             	adc    $0x0,%edx
+  804964:	f7 da                	neg    %edx
+  804966:	83 c4 10             	add    $0x10,%esp
+  804969:	83 c4 24             	add    $0x24,%esp
+  80496c:	5b                   	pop    %ebx
+  80496d:	5e                   	pop    %esi
+  80496e:	5f                   	pop    %edi
+  80496f:	5d                   	pop    %ebp
+  804970:	c3                   	ret
@@ -0,0 +1,10058 @@
+
+obj/user/testpipe.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 4b 03 00 00       	call   80037c <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+char *msg = "Now is the time for all good men to come to the aid of their party.";
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	83 ec 7c             	sub    $0x7c,%esp
+	char buf[100];
+	int i, pid, p[2];
+
+	binaryname = "pipereadeof";
+  80003b:	c7 05 04 60 80 00 60 	movl   $0x804a60,0x806004
+  800042:	4a 80 00 
+
+	if ((i = pipe(p)) < 0)
+  800045:	8d 45 8c             	lea    -0x74(%ebp),%eax
+  800048:	50                   	push   %eax
+  800049:	e8 19 3a 00 00       	call   803a67 <pipe>
+  80004e:	89 c6                	mov    %eax,%esi
+  800050:	83 c4 10             	add    $0x10,%esp
+  800053:	85 c0                	test   %eax,%eax
+  800055:	78 3b                	js     800092 <umain+0x5f>
+		panic("pipe: %e", i);
+
+	if ((pid = fork()) < 0)
+  800057:	e8 7c 15 00 00       	call   8015d8 <fork>
+  80005c:	89 c3                	mov    %eax,%ebx
+  80005e:	85 c0                	test   %eax,%eax
+  800060:	78 42                	js     8000a4 <umain+0x71>
+		panic("fork: %e", i);
+
+	if (pid == 0) {
+  800062:	0f 85 af 01 00 00    	jne    800217 <umain+0x1e4>
+		cprintf("[%08x] pipereadeof close %d\n", thisenv->env_id, p[1]);
+  800068:	8b 55 90             	mov    -0x70(%ebp),%edx
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  80006b:	89 e1                	mov    %esp,%ecx
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80006d:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  800073:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800078:	77 3c                	ja     8000b6 <umain+0x83>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80007a:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80007f:	29 c8                	sub    %ecx,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  800081:	c1 e8 10             	shr    $0x10,%eax
+  800084:	74 30                	je     8000b6 <umain+0x83>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800086:	c1 e0 10             	shl    $0x10,%eax
+  800089:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80008e:	29 c1                	sub    %eax,%ecx
+  800090:	eb 2a                	jmp    8000bc <umain+0x89>
+		panic("pipe: %e", i);
+  800092:	50                   	push   %eax
+  800093:	68 6c 4a 80 00       	push   $0x804a6c
+  800098:	6a 0e                	push   $0xe
+  80009a:	68 75 4a 80 00       	push   $0x804a75
+  80009f:	e8 7b 03 00 00       	call   80041f <_panic>
+		panic("fork: %e", i);
+  8000a4:	56                   	push   %esi
+  8000a5:	68 85 4a 80 00       	push   $0x804a85
+  8000aa:	6a 11                	push   $0x11
+  8000ac:	68 75 4a 80 00       	push   $0x804a75
+  8000b1:	e8 69 03 00 00       	call   80041f <_panic>
+		return pthread_main_tls;
+  8000b6:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		cprintf("[%08x] pipereadeof close %d\n", thisenv->env_id, p[1]);
+  8000bc:	8b 01                	mov    (%ecx),%eax
+  8000be:	8b 40 48             	mov    0x48(%eax),%eax
+  8000c1:	83 ec 04             	sub    $0x4,%esp
+  8000c4:	52                   	push   %edx
+  8000c5:	50                   	push   %eax
+  8000c6:	68 8e 4a 80 00       	push   $0x804a8e
+  8000cb:	e8 2a 04 00 00       	call   8004fa <cprintf>
+		close(p[1]);
+  8000d0:	83 c4 04             	add    $0x4,%esp
+  8000d3:	ff 75 90             	push   -0x70(%ebp)
+  8000d6:	e8 2a 1b 00 00       	call   801c05 <close>
+		cprintf("[%08x] pipereadeof readn %d\n", thisenv->env_id, p[0]);
+  8000db:	8b 55 8c             	mov    -0x74(%ebp),%edx
+  8000de:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8000e0:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  8000e6:	83 c4 10             	add    $0x10,%esp
+  8000e9:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8000ee:	77 18                	ja     800108 <umain+0xd5>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8000f0:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8000f5:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  8000f7:	c1 e8 10             	shr    $0x10,%eax
+  8000fa:	74 0c                	je     800108 <umain+0xd5>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8000fc:	c1 e0 10             	shl    $0x10,%eax
+  8000ff:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  800104:	29 c1                	sub    %eax,%ecx
+  800106:	eb 06                	jmp    80010e <umain+0xdb>
+		return pthread_main_tls;
+  800108:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+  80010e:	8b 01                	mov    (%ecx),%eax
+  800110:	8b 40 48             	mov    0x48(%eax),%eax
+  800113:	83 ec 04             	sub    $0x4,%esp
+  800116:	52                   	push   %edx
+  800117:	50                   	push   %eax
+  800118:	68 ab 4a 80 00       	push   $0x804aab
+  80011d:	e8 d8 03 00 00       	call   8004fa <cprintf>
+		i = readn(p[0], buf, sizeof buf-1);
+  800122:	83 c4 0c             	add    $0xc,%esp
+  800125:	6a 63                	push   $0x63
+  800127:	8d 45 94             	lea    -0x6c(%ebp),%eax
+  80012a:	50                   	push   %eax
+  80012b:	ff 75 8c             	push   -0x74(%ebp)
+  80012e:	e8 bf 1c 00 00       	call   801df2 <readn>
+  800133:	89 c6                	mov    %eax,%esi
+		if (i < 0)
+  800135:	83 c4 10             	add    $0x10,%esp
+  800138:	85 c0                	test   %eax,%eax
+  80013a:	0f 88 ab 00 00 00    	js     8001eb <umain+0x1b8>
+			panic("read: %e", i);
+		buf[i] = 0;
+  800140:	c6 44 05 94 00       	movb   $0x0,-0x6c(%ebp,%eax,1)
+		if (strcmp(buf, msg) == 0)
+  800145:	83 ec 08             	sub    $0x8,%esp
+  800148:	ff 35 00 60 80 00    	push   0x806000
+  80014e:	8d 45 94             	lea    -0x6c(%ebp),%eax
+  800151:	50                   	push   %eax
+  800152:	e8 38 0a 00 00       	call   800b8f <strcmp>
+  800157:	83 c4 10             	add    $0x10,%esp
+  80015a:	85 c0                	test   %eax,%eax
+  80015c:	0f 85 9b 00 00 00    	jne    8001fd <umain+0x1ca>
+			cprintf("\npipe read closed properly\n");
+  800162:	83 ec 0c             	sub    $0xc,%esp
+  800165:	68 d1 4a 80 00       	push   $0x804ad1
+  80016a:	e8 8b 03 00 00       	call   8004fa <cprintf>
+  80016f:	83 c4 10             	add    $0x10,%esp
+		else
+			cprintf("\ngot %d bytes: %s\n", i, buf);
+		exit();
+  800172:	e8 80 02 00 00       	call   8003f7 <exit>
+		cprintf("[%08x] pipereadeof write %d\n", thisenv->env_id, p[1]);
+		if ((i = write(p[1], msg, strlen(msg))) != strlen(msg))
+			panic("write: %e", i);
+		close(p[1]);
+	}
+	wait(pid);
+  800177:	83 ec 0c             	sub    $0xc,%esp
+  80017a:	53                   	push   %ebx
+  80017b:	e8 64 3a 00 00       	call   803be4 <wait>
+
+	binaryname = "pipewriteeof";
+  800180:	c7 05 04 60 80 00 27 	movl   $0x804b27,0x806004
+  800187:	4b 80 00 
+	if ((i = pipe(p)) < 0)
+  80018a:	8d 45 8c             	lea    -0x74(%ebp),%eax
+  80018d:	89 04 24             	mov    %eax,(%esp)
+  800190:	e8 d2 38 00 00       	call   803a67 <pipe>
+  800195:	89 c6                	mov    %eax,%esi
+  800197:	83 c4 10             	add    $0x10,%esp
+  80019a:	85 c0                	test   %eax,%eax
+  80019c:	0f 88 67 01 00 00    	js     800309 <umain+0x2d6>
+		panic("pipe: %e", i);
+
+	if ((pid = fork()) < 0)
+  8001a2:	e8 31 14 00 00       	call   8015d8 <fork>
+  8001a7:	89 c3                	mov    %eax,%ebx
+  8001a9:	85 c0                	test   %eax,%eax
+  8001ab:	0f 88 6a 01 00 00    	js     80031b <umain+0x2e8>
+		panic("fork: %e", i);
+
+	if (pid == 0) {
+  8001b1:	0f 84 76 01 00 00    	je     80032d <umain+0x2fa>
+				break;
+		}
+		cprintf("\npipe write closed properly\n");
+		exit();
+	}
+	close(p[0]);
+  8001b7:	83 ec 0c             	sub    $0xc,%esp
+  8001ba:	ff 75 8c             	push   -0x74(%ebp)
+  8001bd:	e8 43 1a 00 00       	call   801c05 <close>
+	close(p[1]);
+  8001c2:	83 c4 04             	add    $0x4,%esp
+  8001c5:	ff 75 90             	push   -0x70(%ebp)
+  8001c8:	e8 38 1a 00 00       	call   801c05 <close>
+	wait(pid);
+  8001cd:	89 1c 24             	mov    %ebx,(%esp)
+  8001d0:	e8 0f 3a 00 00       	call   803be4 <wait>
+
+	cprintf("pipe tests passed\n");
+  8001d5:	c7 04 24 55 4b 80 00 	movl   $0x804b55,(%esp)
+  8001dc:	e8 19 03 00 00       	call   8004fa <cprintf>
+}
+  8001e1:	83 c4 10             	add    $0x10,%esp
+  8001e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8001e7:	5b                   	pop    %ebx
+  8001e8:	5e                   	pop    %esi
+  8001e9:	5d                   	pop    %ebp
+  8001ea:	c3                   	ret
+			panic("read: %e", i);
+  8001eb:	50                   	push   %eax
+  8001ec:	68 c8 4a 80 00       	push   $0x804ac8
+  8001f1:	6a 19                	push   $0x19
+  8001f3:	68 75 4a 80 00       	push   $0x804a75
+  8001f8:	e8 22 02 00 00       	call   80041f <_panic>
+			cprintf("\ngot %d bytes: %s\n", i, buf);
+  8001fd:	83 ec 04             	sub    $0x4,%esp
+  800200:	8d 45 94             	lea    -0x6c(%ebp),%eax
+  800203:	50                   	push   %eax
+  800204:	56                   	push   %esi
+  800205:	68 ed 4a 80 00       	push   $0x804aed
+  80020a:	e8 eb 02 00 00       	call   8004fa <cprintf>
+  80020f:	83 c4 10             	add    $0x10,%esp
+  800212:	e9 5b ff ff ff       	jmp    800172 <umain+0x13f>
+		cprintf("[%08x] pipereadeof close %d\n", thisenv->env_id, p[0]);
+  800217:	8b 55 8c             	mov    -0x74(%ebp),%edx
+  80021a:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80021c:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  800222:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800227:	77 18                	ja     800241 <umain+0x20e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800229:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80022e:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  800230:	c1 e8 10             	shr    $0x10,%eax
+  800233:	74 0c                	je     800241 <umain+0x20e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800235:	c1 e0 10             	shl    $0x10,%eax
+  800238:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80023d:	29 c1                	sub    %eax,%ecx
+  80023f:	eb 06                	jmp    800247 <umain+0x214>
+		return pthread_main_tls;
+  800241:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+  800247:	8b 01                	mov    (%ecx),%eax
+  800249:	8b 40 48             	mov    0x48(%eax),%eax
+  80024c:	83 ec 04             	sub    $0x4,%esp
+  80024f:	52                   	push   %edx
+  800250:	50                   	push   %eax
+  800251:	68 8e 4a 80 00       	push   $0x804a8e
+  800256:	e8 9f 02 00 00       	call   8004fa <cprintf>
+		close(p[0]);
+  80025b:	83 c4 04             	add    $0x4,%esp
+  80025e:	ff 75 8c             	push   -0x74(%ebp)
+  800261:	e8 9f 19 00 00       	call   801c05 <close>
+		cprintf("[%08x] pipereadeof write %d\n", thisenv->env_id, p[1]);
+  800266:	8b 55 90             	mov    -0x70(%ebp),%edx
+  800269:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80026b:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  800271:	83 c4 10             	add    $0x10,%esp
+  800274:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800279:	77 18                	ja     800293 <umain+0x260>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80027b:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800280:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  800282:	c1 e8 10             	shr    $0x10,%eax
+  800285:	74 0c                	je     800293 <umain+0x260>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800287:	c1 e0 10             	shl    $0x10,%eax
+  80028a:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80028f:	29 c1                	sub    %eax,%ecx
+  800291:	eb 06                	jmp    800299 <umain+0x266>
+		return pthread_main_tls;
+  800293:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+  800299:	8b 01                	mov    (%ecx),%eax
+  80029b:	8b 40 48             	mov    0x48(%eax),%eax
+  80029e:	83 ec 04             	sub    $0x4,%esp
+  8002a1:	52                   	push   %edx
+  8002a2:	50                   	push   %eax
+  8002a3:	68 00 4b 80 00       	push   $0x804b00
+  8002a8:	e8 4d 02 00 00       	call   8004fa <cprintf>
+		if ((i = write(p[1], msg, strlen(msg))) != strlen(msg))
+  8002ad:	83 c4 04             	add    $0x4,%esp
+  8002b0:	ff 35 00 60 80 00    	push   0x806000
+  8002b6:	e8 e8 07 00 00       	call   800aa3 <strlen>
+  8002bb:	83 c4 0c             	add    $0xc,%esp
+  8002be:	50                   	push   %eax
+  8002bf:	ff 35 00 60 80 00    	push   0x806000
+  8002c5:	ff 75 90             	push   -0x70(%ebp)
+  8002c8:	e8 6c 1b 00 00       	call   801e39 <write>
+  8002cd:	89 c6                	mov    %eax,%esi
+  8002cf:	83 c4 04             	add    $0x4,%esp
+  8002d2:	ff 35 00 60 80 00    	push   0x806000
+  8002d8:	e8 c6 07 00 00       	call   800aa3 <strlen>
+  8002dd:	83 c4 10             	add    $0x10,%esp
+  8002e0:	39 f0                	cmp    %esi,%eax
+  8002e2:	75 13                	jne    8002f7 <umain+0x2c4>
+		close(p[1]);
+  8002e4:	83 ec 0c             	sub    $0xc,%esp
+  8002e7:	ff 75 90             	push   -0x70(%ebp)
+  8002ea:	e8 16 19 00 00       	call   801c05 <close>
+  8002ef:	83 c4 10             	add    $0x10,%esp
+  8002f2:	e9 80 fe ff ff       	jmp    800177 <umain+0x144>
+			panic("write: %e", i);
+  8002f7:	56                   	push   %esi
+  8002f8:	68 1d 4b 80 00       	push   $0x804b1d
+  8002fd:	6a 25                	push   $0x25
+  8002ff:	68 75 4a 80 00       	push   $0x804a75
+  800304:	e8 16 01 00 00       	call   80041f <_panic>
+		panic("pipe: %e", i);
+  800309:	50                   	push   %eax
+  80030a:	68 6c 4a 80 00       	push   $0x804a6c
+  80030f:	6a 2c                	push   $0x2c
+  800311:	68 75 4a 80 00       	push   $0x804a75
+  800316:	e8 04 01 00 00       	call   80041f <_panic>
+		panic("fork: %e", i);
+  80031b:	56                   	push   %esi
+  80031c:	68 85 4a 80 00       	push   $0x804a85
+  800321:	6a 2f                	push   $0x2f
+  800323:	68 75 4a 80 00       	push   $0x804a75
+  800328:	e8 f2 00 00 00       	call   80041f <_panic>
+		close(p[0]);
+  80032d:	83 ec 0c             	sub    $0xc,%esp
+  800330:	ff 75 8c             	push   -0x74(%ebp)
+  800333:	e8 cd 18 00 00       	call   801c05 <close>
+  800338:	83 c4 10             	add    $0x10,%esp
+			cprintf(".");
+  80033b:	83 ec 0c             	sub    $0xc,%esp
+  80033e:	68 34 4b 80 00       	push   $0x804b34
+  800343:	e8 b2 01 00 00       	call   8004fa <cprintf>
+			if (write(p[1], "x", 1) != 1)
+  800348:	83 c4 0c             	add    $0xc,%esp
+  80034b:	6a 01                	push   $0x1
+  80034d:	68 36 4b 80 00       	push   $0x804b36
+  800352:	ff 75 90             	push   -0x70(%ebp)
+  800355:	e8 df 1a 00 00       	call   801e39 <write>
+  80035a:	83 c4 10             	add    $0x10,%esp
+  80035d:	83 f8 01             	cmp    $0x1,%eax
+  800360:	74 d9                	je     80033b <umain+0x308>
+		cprintf("\npipe write closed properly\n");
+  800362:	83 ec 0c             	sub    $0xc,%esp
+  800365:	68 38 4b 80 00       	push   $0x804b38
+  80036a:	e8 8b 01 00 00       	call   8004fa <cprintf>
+		exit();
+  80036f:	e8 83 00 00 00       	call   8003f7 <exit>
+  800374:	83 c4 10             	add    $0x10,%esp
+  800377:	e9 3b fe ff ff       	jmp    8001b7 <umain+0x184>
+
+0080037c <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80037c:	55                   	push   %ebp
+  80037d:	89 e5                	mov    %esp,%ebp
+  80037f:	57                   	push   %edi
+  800380:	56                   	push   %esi
+  800381:	53                   	push   %ebx
+  800382:	83 ec 1c             	sub    $0x1c,%esp
+  800385:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800388:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  80038b:	e8 34 0b 00 00       	call   800ec4 <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  800390:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  800393:	89 15 c0 72 80 00    	mov    %edx,0x8072c0
+	thisenv = &envs[ENVX(eid)];
+  800399:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80039e:	89 c1                	mov    %eax,%ecx
+  8003a0:	89 e7                	mov    %esp,%edi
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8003a2:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  8003a8:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8003ad:	77 16                	ja     8003c5 <libmain+0x49>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8003af:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8003b4:	29 f8                	sub    %edi,%eax
+	if (t == 0)
+  8003b6:	c1 e8 10             	shr    $0x10,%eax
+  8003b9:	74 0a                	je     8003c5 <libmain+0x49>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8003bb:	c1 e0 10             	shl    $0x10,%eax
+  8003be:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8003c3:	29 c2                	sub    %eax,%edx
+  8003c5:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  8003c8:	c1 e0 04             	shl    $0x4,%eax
+  8003cb:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8003d0:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8003d2:	85 db                	test   %ebx,%ebx
+  8003d4:	7e 07                	jle    8003dd <libmain+0x61>
+		binaryname = argv[0];
+  8003d6:	8b 06                	mov    (%esi),%eax
+  8003d8:	a3 04 60 80 00       	mov    %eax,0x806004
+
+	// call user main routine
+	umain(argc, argv);
+  8003dd:	83 ec 08             	sub    $0x8,%esp
+  8003e0:	56                   	push   %esi
+  8003e1:	53                   	push   %ebx
+  8003e2:	e8 4c fc ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8003e7:	e8 0b 00 00 00       	call   8003f7 <exit>
+}
+  8003ec:	83 c4 10             	add    $0x10,%esp
+  8003ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003f2:	5b                   	pop    %ebx
+  8003f3:	5e                   	pop    %esi
+  8003f4:	5f                   	pop    %edi
+  8003f5:	5d                   	pop    %ebp
+  8003f6:	c3                   	ret
+
+008003f7 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8003f7:	55                   	push   %ebp
+  8003f8:	89 e5                	mov    %esp,%ebp
+  8003fa:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  8003fd:	6a 00                	push   $0x0
+  8003ff:	e8 8b 27 00 00       	call   802b8f <fflush>
+	pthread_kill_others();
+  800404:	e8 47 3e 00 00       	call   804250 <pthread_kill_others>
+	close_all();
+  800409:	e8 24 18 00 00       	call   801c32 <close_all>
+	sys_env_destroy(0);
+  80040e:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800415:	e8 5f 0a 00 00       	call   800e79 <sys_env_destroy>
+}
+  80041a:	83 c4 10             	add    $0x10,%esp
+  80041d:	c9                   	leave
+  80041e:	c3                   	ret
+
+0080041f <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80041f:	55                   	push   %ebp
+  800420:	89 e5                	mov    %esp,%ebp
+  800422:	56                   	push   %esi
+  800423:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800424:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800427:	8b 35 04 60 80 00    	mov    0x806004,%esi
+  80042d:	e8 92 0a 00 00       	call   800ec4 <sys_getenvid>
+  800432:	83 ec 0c             	sub    $0xc,%esp
+  800435:	ff 75 0c             	push   0xc(%ebp)
+  800438:	ff 75 08             	push   0x8(%ebp)
+  80043b:	56                   	push   %esi
+  80043c:	50                   	push   %eax
+  80043d:	68 b8 4b 80 00       	push   $0x804bb8
+  800442:	e8 b3 00 00 00       	call   8004fa <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800447:	83 c4 18             	add    $0x18,%esp
+  80044a:	53                   	push   %ebx
+  80044b:	ff 75 10             	push   0x10(%ebp)
+  80044e:	e8 56 00 00 00       	call   8004a9 <vcprintf>
+	cprintf("\n");
+  800453:	c7 04 24 ba 50 80 00 	movl   $0x8050ba,(%esp)
+  80045a:	e8 9b 00 00 00       	call   8004fa <cprintf>
+  80045f:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800462:	cc                   	int3
+	while (1)
+  800463:	eb fd                	jmp    800462 <_panic+0x43>
+
+00800465 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800465:	55                   	push   %ebp
+  800466:	89 e5                	mov    %esp,%ebp
+  800468:	53                   	push   %ebx
+  800469:	83 ec 04             	sub    $0x4,%esp
+  80046c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80046f:	8b 13                	mov    (%ebx),%edx
+  800471:	8d 42 01             	lea    0x1(%edx),%eax
+  800474:	89 03                	mov    %eax,(%ebx)
+  800476:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800479:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80047d:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800482:	74 09                	je     80048d <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800484:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800488:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80048b:	c9                   	leave
+  80048c:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80048d:	83 ec 08             	sub    $0x8,%esp
+  800490:	68 ff 00 00 00       	push   $0xff
+  800495:	8d 43 08             	lea    0x8(%ebx),%eax
+  800498:	50                   	push   %eax
+  800499:	e8 84 09 00 00       	call   800e22 <sys_cputs>
+		b->idx = 0;
+  80049e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8004a4:	83 c4 10             	add    $0x10,%esp
+  8004a7:	eb db                	jmp    800484 <putch+0x1f>
+
+008004a9 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8004a9:	55                   	push   %ebp
+  8004aa:	89 e5                	mov    %esp,%ebp
+  8004ac:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8004b2:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8004b9:	00 00 00 
+	b.cnt = 0;
+  8004bc:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8004c3:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8004c6:	ff 75 0c             	push   0xc(%ebp)
+  8004c9:	ff 75 08             	push   0x8(%ebp)
+  8004cc:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8004d2:	50                   	push   %eax
+  8004d3:	68 65 04 80 00       	push   $0x800465
+  8004d8:	e8 14 01 00 00       	call   8005f1 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8004dd:	83 c4 08             	add    $0x8,%esp
+  8004e0:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8004e6:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8004ec:	50                   	push   %eax
+  8004ed:	e8 30 09 00 00       	call   800e22 <sys_cputs>
+
+	return b.cnt;
+}
+  8004f2:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8004f8:	c9                   	leave
+  8004f9:	c3                   	ret
+
+008004fa <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8004fa:	55                   	push   %ebp
+  8004fb:	89 e5                	mov    %esp,%ebp
+  8004fd:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800500:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800503:	50                   	push   %eax
+  800504:	ff 75 08             	push   0x8(%ebp)
+  800507:	e8 9d ff ff ff       	call   8004a9 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80050c:	c9                   	leave
+  80050d:	c3                   	ret
+
+0080050e <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80050e:	55                   	push   %ebp
+  80050f:	89 e5                	mov    %esp,%ebp
+  800511:	57                   	push   %edi
+  800512:	56                   	push   %esi
+  800513:	53                   	push   %ebx
+  800514:	83 ec 1c             	sub    $0x1c,%esp
+  800517:	89 c7                	mov    %eax,%edi
+  800519:	89 d6                	mov    %edx,%esi
+  80051b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80051e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800521:	89 d1                	mov    %edx,%ecx
+  800523:	89 c2                	mov    %eax,%edx
+  800525:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800528:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80052b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80052e:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800531:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800534:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80053b:	39 c2                	cmp    %eax,%edx
+  80053d:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800540:	72 3e                	jb     800580 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800542:	83 ec 0c             	sub    $0xc,%esp
+  800545:	ff 75 18             	push   0x18(%ebp)
+  800548:	83 eb 01             	sub    $0x1,%ebx
+  80054b:	53                   	push   %ebx
+  80054c:	50                   	push   %eax
+  80054d:	83 ec 08             	sub    $0x8,%esp
+  800550:	ff 75 e4             	push   -0x1c(%ebp)
+  800553:	ff 75 e0             	push   -0x20(%ebp)
+  800556:	ff 75 dc             	push   -0x24(%ebp)
+  800559:	ff 75 d8             	push   -0x28(%ebp)
+  80055c:	e8 72 43 00 00       	call   8048d3 <__udivdi3>
+  800561:	83 c4 18             	add    $0x18,%esp
+  800564:	52                   	push   %edx
+  800565:	50                   	push   %eax
+  800566:	89 f2                	mov    %esi,%edx
+  800568:	89 f8                	mov    %edi,%eax
+  80056a:	e8 9f ff ff ff       	call   80050e <printnum>
+  80056f:	83 c4 20             	add    $0x20,%esp
+  800572:	eb 13                	jmp    800587 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800574:	83 ec 08             	sub    $0x8,%esp
+  800577:	56                   	push   %esi
+  800578:	ff 75 18             	push   0x18(%ebp)
+  80057b:	ff d7                	call   *%edi
+  80057d:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800580:	83 eb 01             	sub    $0x1,%ebx
+  800583:	85 db                	test   %ebx,%ebx
+  800585:	7f ed                	jg     800574 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800587:	83 ec 08             	sub    $0x8,%esp
+  80058a:	56                   	push   %esi
+  80058b:	83 ec 04             	sub    $0x4,%esp
+  80058e:	ff 75 e4             	push   -0x1c(%ebp)
+  800591:	ff 75 e0             	push   -0x20(%ebp)
+  800594:	ff 75 dc             	push   -0x24(%ebp)
+  800597:	ff 75 d8             	push   -0x28(%ebp)
+  80059a:	e8 55 43 00 00       	call   8048f4 <__umoddi3>
+  80059f:	83 c4 14             	add    $0x14,%esp
+  8005a2:	0f be 80 db 4b 80 00 	movsbl 0x804bdb(%eax),%eax
+  8005a9:	50                   	push   %eax
+  8005aa:	ff d7                	call   *%edi
+}
+  8005ac:	83 c4 10             	add    $0x10,%esp
+  8005af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005b2:	5b                   	pop    %ebx
+  8005b3:	5e                   	pop    %esi
+  8005b4:	5f                   	pop    %edi
+  8005b5:	5d                   	pop    %ebp
+  8005b6:	c3                   	ret
+
+008005b7 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8005b7:	55                   	push   %ebp
+  8005b8:	89 e5                	mov    %esp,%ebp
+  8005ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8005bd:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8005c1:	8b 10                	mov    (%eax),%edx
+  8005c3:	3b 50 04             	cmp    0x4(%eax),%edx
+  8005c6:	73 0a                	jae    8005d2 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8005c8:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8005cb:	89 08                	mov    %ecx,(%eax)
+  8005cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005d0:	88 02                	mov    %al,(%edx)
+}
+  8005d2:	5d                   	pop    %ebp
+  8005d3:	c3                   	ret
+
+008005d4 <printfmt>:
+{
+  8005d4:	55                   	push   %ebp
+  8005d5:	89 e5                	mov    %esp,%ebp
+  8005d7:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8005da:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8005dd:	50                   	push   %eax
+  8005de:	ff 75 10             	push   0x10(%ebp)
+  8005e1:	ff 75 0c             	push   0xc(%ebp)
+  8005e4:	ff 75 08             	push   0x8(%ebp)
+  8005e7:	e8 05 00 00 00       	call   8005f1 <vprintfmt>
+}
+  8005ec:	83 c4 10             	add    $0x10,%esp
+  8005ef:	c9                   	leave
+  8005f0:	c3                   	ret
+
+008005f1 <vprintfmt>:
+{
+  8005f1:	55                   	push   %ebp
+  8005f2:	89 e5                	mov    %esp,%ebp
+  8005f4:	57                   	push   %edi
+  8005f5:	56                   	push   %esi
+  8005f6:	53                   	push   %ebx
+  8005f7:	83 ec 2c             	sub    $0x2c,%esp
+  8005fa:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005fd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800600:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800603:	eb 0a                	jmp    80060f <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800605:	83 ec 08             	sub    $0x8,%esp
+  800608:	53                   	push   %ebx
+  800609:	50                   	push   %eax
+  80060a:	ff d6                	call   *%esi
+  80060c:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  80060f:	83 c7 01             	add    $0x1,%edi
+  800612:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  800616:	83 f8 25             	cmp    $0x25,%eax
+  800619:	74 0c                	je     800627 <vprintfmt+0x36>
+			if (ch == '\0')
+  80061b:	85 c0                	test   %eax,%eax
+  80061d:	75 e6                	jne    800605 <vprintfmt+0x14>
+}
+  80061f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800622:	5b                   	pop    %ebx
+  800623:	5e                   	pop    %esi
+  800624:	5f                   	pop    %edi
+  800625:	5d                   	pop    %ebp
+  800626:	c3                   	ret
+		padc = ' ';
+  800627:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80062b:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800632:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800639:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800640:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  800645:	8d 47 01             	lea    0x1(%edi),%eax
+  800648:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80064b:	0f b6 17             	movzbl (%edi),%edx
+  80064e:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800651:	3c 55                	cmp    $0x55,%al
+  800653:	0f 87 c5 03 00 00    	ja     800a1e <vprintfmt+0x42d>
+  800659:	0f b6 c0             	movzbl %al,%eax
+  80065c:	ff 24 85 60 4d 80 00 	jmp    *0x804d60(,%eax,4)
+  800663:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  800666:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800669:	eb da                	jmp    800645 <vprintfmt+0x54>
+  80066b:	0f be d2             	movsbl %dl,%edx
+  80066e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800671:	b8 00 00 00 00       	mov    $0x0,%eax
+  800676:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800679:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80067c:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800680:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800683:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800686:	83 f9 09             	cmp    $0x9,%ecx
+  800689:	77 55                	ja     8006e0 <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  80068b:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  80068e:	eb e9                	jmp    800679 <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  800690:	8b 45 14             	mov    0x14(%ebp),%eax
+  800693:	8b 00                	mov    (%eax),%eax
+  800695:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800698:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069b:	8d 40 04             	lea    0x4(%eax),%eax
+  80069e:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  8006a1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8006a4:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8006a8:	79 9b                	jns    800645 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8006aa:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8006ad:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006b0:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8006b7:	eb 8c                	jmp    800645 <vprintfmt+0x54>
+			if (width < 0)
+  8006b9:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8006bc:	85 d2                	test   %edx,%edx
+  8006be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006c3:	0f 49 c2             	cmovns %edx,%eax
+  8006c6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  8006c9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8006cc:	e9 74 ff ff ff       	jmp    800645 <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  8006d1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8006d4:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8006db:	e9 65 ff ff ff       	jmp    800645 <vprintfmt+0x54>
+  8006e0:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8006e3:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8006e6:	eb bc                	jmp    8006a4 <vprintfmt+0xb3>
+			lflag++;
+  8006e8:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  8006eb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8006ee:	e9 52 ff ff ff       	jmp    800645 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8006f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f6:	8d 78 04             	lea    0x4(%eax),%edi
+  8006f9:	83 ec 08             	sub    $0x8,%esp
+  8006fc:	53                   	push   %ebx
+  8006fd:	ff 30                	push   (%eax)
+  8006ff:	ff d6                	call   *%esi
+			break;
+  800701:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800704:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800707:	e9 b1 02 00 00       	jmp    8009bd <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  80070c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070f:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800712:	8b 10                	mov    (%eax),%edx
+  800714:	89 d0                	mov    %edx,%eax
+  800716:	f7 d8                	neg    %eax
+  800718:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80071b:	83 f8 14             	cmp    $0x14,%eax
+  80071e:	7f 23                	jg     800743 <vprintfmt+0x152>
+  800720:	8b 14 85 c0 4e 80 00 	mov    0x804ec0(,%eax,4),%edx
+  800727:	85 d2                	test   %edx,%edx
+  800729:	74 18                	je     800743 <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  80072b:	52                   	push   %edx
+  80072c:	68 03 51 80 00       	push   $0x805103
+  800731:	53                   	push   %ebx
+  800732:	56                   	push   %esi
+  800733:	e8 9c fe ff ff       	call   8005d4 <printfmt>
+  800738:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80073b:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80073e:	e9 7a 02 00 00       	jmp    8009bd <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  800743:	50                   	push   %eax
+  800744:	68 f3 4b 80 00       	push   $0x804bf3
+  800749:	53                   	push   %ebx
+  80074a:	56                   	push   %esi
+  80074b:	e8 84 fe ff ff       	call   8005d4 <printfmt>
+  800750:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800753:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800756:	e9 62 02 00 00       	jmp    8009bd <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80075b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80075e:	83 c0 04             	add    $0x4,%eax
+  800761:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800764:	8b 45 14             	mov    0x14(%ebp),%eax
+  800767:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800769:	85 c9                	test   %ecx,%ecx
+  80076b:	b8 ec 4b 80 00       	mov    $0x804bec,%eax
+  800770:	0f 45 c1             	cmovne %ecx,%eax
+  800773:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800776:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80077a:	7e 06                	jle    800782 <vprintfmt+0x191>
+  80077c:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800780:	75 0b                	jne    80078d <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800782:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800785:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800788:	89 75 08             	mov    %esi,0x8(%ebp)
+  80078b:	eb 5c                	jmp    8007e9 <vprintfmt+0x1f8>
+  80078d:	83 ec 08             	sub    $0x8,%esp
+  800790:	ff 75 d0             	push   -0x30(%ebp)
+  800793:	ff 75 cc             	push   -0x34(%ebp)
+  800796:	e8 20 03 00 00       	call   800abb <strnlen>
+  80079b:	89 c2                	mov    %eax,%edx
+  80079d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8007a0:	29 d0                	sub    %edx,%eax
+  8007a2:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8007a5:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8007a9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8007ac:	89 75 08             	mov    %esi,0x8(%ebp)
+  8007af:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8007b1:	eb 0e                	jmp    8007c1 <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  8007b3:	83 ec 08             	sub    $0x8,%esp
+  8007b6:	53                   	push   %ebx
+  8007b7:	57                   	push   %edi
+  8007b8:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8007bb:	83 ee 01             	sub    $0x1,%esi
+  8007be:	83 c4 10             	add    $0x10,%esp
+  8007c1:	85 f6                	test   %esi,%esi
+  8007c3:	7f ee                	jg     8007b3 <vprintfmt+0x1c2>
+  8007c5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8007c8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007cb:	85 c0                	test   %eax,%eax
+  8007cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8007d2:	0f 49 d0             	cmovns %eax,%edx
+  8007d5:	29 d0                	sub    %edx,%eax
+  8007d7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8007da:	eb a6                	jmp    800782 <vprintfmt+0x191>
+					putch(ch, putdat);
+  8007dc:	83 ec 08             	sub    $0x8,%esp
+  8007df:	53                   	push   %ebx
+  8007e0:	52                   	push   %edx
+  8007e1:	ff 55 08             	call   *0x8(%ebp)
+  8007e4:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8007e7:	89 f1                	mov    %esi,%ecx
+  8007e9:	8d 71 01             	lea    0x1(%ecx),%esi
+  8007ec:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8007f0:	0f be d0             	movsbl %al,%edx
+  8007f3:	85 d2                	test   %edx,%edx
+  8007f5:	74 28                	je     80081f <vprintfmt+0x22e>
+  8007f7:	85 ff                	test   %edi,%edi
+  8007f9:	78 05                	js     800800 <vprintfmt+0x20f>
+  8007fb:	83 ef 01             	sub    $0x1,%edi
+  8007fe:	78 30                	js     800830 <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800800:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800804:	74 d6                	je     8007dc <vprintfmt+0x1eb>
+  800806:	0f be c0             	movsbl %al,%eax
+  800809:	83 e8 20             	sub    $0x20,%eax
+  80080c:	83 f8 5e             	cmp    $0x5e,%eax
+  80080f:	76 cb                	jbe    8007dc <vprintfmt+0x1eb>
+					putch('?', putdat);
+  800811:	83 ec 08             	sub    $0x8,%esp
+  800814:	53                   	push   %ebx
+  800815:	6a 3f                	push   $0x3f
+  800817:	ff 55 08             	call   *0x8(%ebp)
+  80081a:	83 c4 10             	add    $0x10,%esp
+  80081d:	eb c8                	jmp    8007e7 <vprintfmt+0x1f6>
+  80081f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800822:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800825:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800828:	01 d0                	add    %edx,%eax
+  80082a:	29 c8                	sub    %ecx,%eax
+  80082c:	89 c7                	mov    %eax,%edi
+  80082e:	eb 13                	jmp    800843 <vprintfmt+0x252>
+  800830:	8b 75 08             	mov    0x8(%ebp),%esi
+  800833:	eb ed                	jmp    800822 <vprintfmt+0x231>
+				putch(' ', putdat);
+  800835:	83 ec 08             	sub    $0x8,%esp
+  800838:	53                   	push   %ebx
+  800839:	6a 20                	push   $0x20
+  80083b:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80083d:	83 ef 01             	sub    $0x1,%edi
+  800840:	83 c4 10             	add    $0x10,%esp
+  800843:	85 ff                	test   %edi,%edi
+  800845:	7f ee                	jg     800835 <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800847:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80084a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80084d:	e9 6b 01 00 00       	jmp    8009bd <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  800852:	83 f9 01             	cmp    $0x1,%ecx
+  800855:	7f 1f                	jg     800876 <vprintfmt+0x285>
+	else if (lflag)
+  800857:	85 c9                	test   %ecx,%ecx
+  800859:	74 67                	je     8008c2 <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  80085b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80085e:	8b 00                	mov    (%eax),%eax
+  800860:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800863:	89 c1                	mov    %eax,%ecx
+  800865:	c1 f9 1f             	sar    $0x1f,%ecx
+  800868:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80086b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80086e:	8d 40 04             	lea    0x4(%eax),%eax
+  800871:	89 45 14             	mov    %eax,0x14(%ebp)
+  800874:	eb 17                	jmp    80088d <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  800876:	8b 45 14             	mov    0x14(%ebp),%eax
+  800879:	8b 50 04             	mov    0x4(%eax),%edx
+  80087c:	8b 00                	mov    (%eax),%eax
+  80087e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800881:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800884:	8b 45 14             	mov    0x14(%ebp),%eax
+  800887:	8d 40 08             	lea    0x8(%eax),%eax
+  80088a:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80088d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800890:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800893:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800898:	85 c9                	test   %ecx,%ecx
+  80089a:	0f 89 03 01 00 00    	jns    8009a3 <vprintfmt+0x3b2>
+				putch('-', putdat);
+  8008a0:	83 ec 08             	sub    $0x8,%esp
+  8008a3:	53                   	push   %ebx
+  8008a4:	6a 2d                	push   $0x2d
+  8008a6:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8008a8:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8008ab:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8008ae:	f7 da                	neg    %edx
+  8008b0:	83 d1 00             	adc    $0x0,%ecx
+  8008b3:	f7 d9                	neg    %ecx
+  8008b5:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8008b8:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8008bd:	e9 e1 00 00 00       	jmp    8009a3 <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  8008c2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008c5:	8b 00                	mov    (%eax),%eax
+  8008c7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8008ca:	89 c1                	mov    %eax,%ecx
+  8008cc:	c1 f9 1f             	sar    $0x1f,%ecx
+  8008cf:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8008d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008d5:	8d 40 04             	lea    0x4(%eax),%eax
+  8008d8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008db:	eb b0                	jmp    80088d <vprintfmt+0x29c>
+	if (lflag >= 2)
+  8008dd:	83 f9 01             	cmp    $0x1,%ecx
+  8008e0:	7f 1e                	jg     800900 <vprintfmt+0x30f>
+	else if (lflag)
+  8008e2:	85 c9                	test   %ecx,%ecx
+  8008e4:	74 32                	je     800918 <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  8008e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008e9:	8b 10                	mov    (%eax),%edx
+  8008eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008f0:	8d 40 04             	lea    0x4(%eax),%eax
+  8008f3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008f6:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8008fb:	e9 a3 00 00 00       	jmp    8009a3 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800900:	8b 45 14             	mov    0x14(%ebp),%eax
+  800903:	8b 10                	mov    (%eax),%edx
+  800905:	8b 48 04             	mov    0x4(%eax),%ecx
+  800908:	8d 40 08             	lea    0x8(%eax),%eax
+  80090b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80090e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800913:	e9 8b 00 00 00       	jmp    8009a3 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800918:	8b 45 14             	mov    0x14(%ebp),%eax
+  80091b:	8b 10                	mov    (%eax),%edx
+  80091d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800922:	8d 40 04             	lea    0x4(%eax),%eax
+  800925:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800928:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80092d:	eb 74                	jmp    8009a3 <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  80092f:	83 f9 01             	cmp    $0x1,%ecx
+  800932:	7f 1b                	jg     80094f <vprintfmt+0x35e>
+	else if (lflag)
+  800934:	85 c9                	test   %ecx,%ecx
+  800936:	74 2c                	je     800964 <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  800938:	8b 45 14             	mov    0x14(%ebp),%eax
+  80093b:	8b 10                	mov    (%eax),%edx
+  80093d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800942:	8d 40 04             	lea    0x4(%eax),%eax
+  800945:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800948:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  80094d:	eb 54                	jmp    8009a3 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  80094f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800952:	8b 10                	mov    (%eax),%edx
+  800954:	8b 48 04             	mov    0x4(%eax),%ecx
+  800957:	8d 40 08             	lea    0x8(%eax),%eax
+  80095a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80095d:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800962:	eb 3f                	jmp    8009a3 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800964:	8b 45 14             	mov    0x14(%ebp),%eax
+  800967:	8b 10                	mov    (%eax),%edx
+  800969:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80096e:	8d 40 04             	lea    0x4(%eax),%eax
+  800971:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800974:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800979:	eb 28                	jmp    8009a3 <vprintfmt+0x3b2>
+			putch('0', putdat);
+  80097b:	83 ec 08             	sub    $0x8,%esp
+  80097e:	53                   	push   %ebx
+  80097f:	6a 30                	push   $0x30
+  800981:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800983:	83 c4 08             	add    $0x8,%esp
+  800986:	53                   	push   %ebx
+  800987:	6a 78                	push   $0x78
+  800989:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80098b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80098e:	8b 10                	mov    (%eax),%edx
+  800990:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800995:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800998:	8d 40 04             	lea    0x4(%eax),%eax
+  80099b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80099e:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8009a3:	83 ec 0c             	sub    $0xc,%esp
+  8009a6:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8009aa:	50                   	push   %eax
+  8009ab:	ff 75 e0             	push   -0x20(%ebp)
+  8009ae:	57                   	push   %edi
+  8009af:	51                   	push   %ecx
+  8009b0:	52                   	push   %edx
+  8009b1:	89 da                	mov    %ebx,%edx
+  8009b3:	89 f0                	mov    %esi,%eax
+  8009b5:	e8 54 fb ff ff       	call   80050e <printnum>
+			break;
+  8009ba:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8009bd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  8009c0:	e9 4a fc ff ff       	jmp    80060f <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8009c5:	83 f9 01             	cmp    $0x1,%ecx
+  8009c8:	7f 1b                	jg     8009e5 <vprintfmt+0x3f4>
+	else if (lflag)
+  8009ca:	85 c9                	test   %ecx,%ecx
+  8009cc:	74 2c                	je     8009fa <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  8009ce:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009d1:	8b 10                	mov    (%eax),%edx
+  8009d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009d8:	8d 40 04             	lea    0x4(%eax),%eax
+  8009db:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009de:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8009e3:	eb be                	jmp    8009a3 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8009e5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009e8:	8b 10                	mov    (%eax),%edx
+  8009ea:	8b 48 04             	mov    0x4(%eax),%ecx
+  8009ed:	8d 40 08             	lea    0x8(%eax),%eax
+  8009f0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009f3:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8009f8:	eb a9                	jmp    8009a3 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8009fa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009fd:	8b 10                	mov    (%eax),%edx
+  8009ff:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a04:	8d 40 04             	lea    0x4(%eax),%eax
+  800a07:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a0a:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800a0f:	eb 92                	jmp    8009a3 <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  800a11:	83 ec 08             	sub    $0x8,%esp
+  800a14:	53                   	push   %ebx
+  800a15:	6a 25                	push   $0x25
+  800a17:	ff d6                	call   *%esi
+			break;
+  800a19:	83 c4 10             	add    $0x10,%esp
+  800a1c:	eb 9f                	jmp    8009bd <vprintfmt+0x3cc>
+			putch('%', putdat);
+  800a1e:	83 ec 08             	sub    $0x8,%esp
+  800a21:	53                   	push   %ebx
+  800a22:	6a 25                	push   $0x25
+  800a24:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800a26:	83 c4 10             	add    $0x10,%esp
+  800a29:	89 f8                	mov    %edi,%eax
+  800a2b:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800a2f:	74 05                	je     800a36 <vprintfmt+0x445>
+  800a31:	83 e8 01             	sub    $0x1,%eax
+  800a34:	eb f5                	jmp    800a2b <vprintfmt+0x43a>
+  800a36:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800a39:	eb 82                	jmp    8009bd <vprintfmt+0x3cc>
+
+00800a3b <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800a3b:	55                   	push   %ebp
+  800a3c:	89 e5                	mov    %esp,%ebp
+  800a3e:	83 ec 18             	sub    $0x18,%esp
+  800a41:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a44:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800a47:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800a4a:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800a4e:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800a51:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800a58:	85 c0                	test   %eax,%eax
+  800a5a:	74 26                	je     800a82 <vsnprintf+0x47>
+  800a5c:	85 d2                	test   %edx,%edx
+  800a5e:	7e 22                	jle    800a82 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800a60:	ff 75 14             	push   0x14(%ebp)
+  800a63:	ff 75 10             	push   0x10(%ebp)
+  800a66:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800a69:	50                   	push   %eax
+  800a6a:	68 b7 05 80 00       	push   $0x8005b7
+  800a6f:	e8 7d fb ff ff       	call   8005f1 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800a74:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800a77:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800a7a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a7d:	83 c4 10             	add    $0x10,%esp
+}
+  800a80:	c9                   	leave
+  800a81:	c3                   	ret
+		return -E_INVAL;
+  800a82:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a87:	eb f7                	jmp    800a80 <vsnprintf+0x45>
+
+00800a89 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800a89:	55                   	push   %ebp
+  800a8a:	89 e5                	mov    %esp,%ebp
+  800a8c:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800a8f:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800a92:	50                   	push   %eax
+  800a93:	ff 75 10             	push   0x10(%ebp)
+  800a96:	ff 75 0c             	push   0xc(%ebp)
+  800a99:	ff 75 08             	push   0x8(%ebp)
+  800a9c:	e8 9a ff ff ff       	call   800a3b <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800aa1:	c9                   	leave
+  800aa2:	c3                   	ret
+
+00800aa3 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800aa3:	55                   	push   %ebp
+  800aa4:	89 e5                	mov    %esp,%ebp
+  800aa6:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800aa9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aae:	eb 03                	jmp    800ab3 <strlen+0x10>
+		n++;
+  800ab0:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800ab3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800ab7:	75 f7                	jne    800ab0 <strlen+0xd>
+	return n;
+}
+  800ab9:	5d                   	pop    %ebp
+  800aba:	c3                   	ret
+
+00800abb <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800abb:	55                   	push   %ebp
+  800abc:	89 e5                	mov    %esp,%ebp
+  800abe:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800ac1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ac4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ac9:	eb 03                	jmp    800ace <strnlen+0x13>
+		n++;
+  800acb:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800ace:	39 d0                	cmp    %edx,%eax
+  800ad0:	74 08                	je     800ada <strnlen+0x1f>
+  800ad2:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800ad6:	75 f3                	jne    800acb <strnlen+0x10>
+  800ad8:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800ada:	89 d0                	mov    %edx,%eax
+  800adc:	5d                   	pop    %ebp
+  800add:	c3                   	ret
+
+00800ade <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800ade:	55                   	push   %ebp
+  800adf:	89 e5                	mov    %esp,%ebp
+  800ae1:	53                   	push   %ebx
+  800ae2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ae5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800ae8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aed:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800af1:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800af4:	83 c0 01             	add    $0x1,%eax
+  800af7:	84 d2                	test   %dl,%dl
+  800af9:	75 f2                	jne    800aed <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800afb:	89 c8                	mov    %ecx,%eax
+  800afd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b00:	c9                   	leave
+  800b01:	c3                   	ret
+
+00800b02 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800b02:	55                   	push   %ebp
+  800b03:	89 e5                	mov    %esp,%ebp
+  800b05:	53                   	push   %ebx
+  800b06:	83 ec 10             	sub    $0x10,%esp
+  800b09:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800b0c:	53                   	push   %ebx
+  800b0d:	e8 91 ff ff ff       	call   800aa3 <strlen>
+  800b12:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800b15:	ff 75 0c             	push   0xc(%ebp)
+  800b18:	01 d8                	add    %ebx,%eax
+  800b1a:	50                   	push   %eax
+  800b1b:	e8 be ff ff ff       	call   800ade <strcpy>
+	return dst;
+}
+  800b20:	89 d8                	mov    %ebx,%eax
+  800b22:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b25:	c9                   	leave
+  800b26:	c3                   	ret
+
+00800b27 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b27:	55                   	push   %ebp
+  800b28:	89 e5                	mov    %esp,%ebp
+  800b2a:	56                   	push   %esi
+  800b2b:	53                   	push   %ebx
+  800b2c:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b2f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800b32:	89 f3                	mov    %esi,%ebx
+  800b34:	03 5d 10             	add    0x10(%ebp),%ebx
+  800b37:	89 f0                	mov    %esi,%eax
+  800b39:	eb 0f                	jmp    800b4a <strncpy+0x23>
+		*dst++ = *src;
+  800b3b:	83 c0 01             	add    $0x1,%eax
+  800b3e:	0f b6 0a             	movzbl (%edx),%ecx
+  800b41:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800b44:	80 f9 01             	cmp    $0x1,%cl
+  800b47:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800b4a:	39 d8                	cmp    %ebx,%eax
+  800b4c:	75 ed                	jne    800b3b <strncpy+0x14>
+	}
+	return ret;
+}
+  800b4e:	89 f0                	mov    %esi,%eax
+  800b50:	5b                   	pop    %ebx
+  800b51:	5e                   	pop    %esi
+  800b52:	5d                   	pop    %ebp
+  800b53:	c3                   	ret
+
+00800b54 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800b54:	55                   	push   %ebp
+  800b55:	89 e5                	mov    %esp,%ebp
+  800b57:	56                   	push   %esi
+  800b58:	53                   	push   %ebx
+  800b59:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b5c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b5f:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800b62:	89 f0                	mov    %esi,%eax
+  800b64:	85 d2                	test   %edx,%edx
+  800b66:	74 21                	je     800b89 <strlcpy+0x35>
+  800b68:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800b6c:	89 f2                	mov    %esi,%edx
+  800b6e:	eb 09                	jmp    800b79 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800b70:	83 c1 01             	add    $0x1,%ecx
+  800b73:	83 c2 01             	add    $0x1,%edx
+  800b76:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800b79:	39 c2                	cmp    %eax,%edx
+  800b7b:	74 09                	je     800b86 <strlcpy+0x32>
+  800b7d:	0f b6 19             	movzbl (%ecx),%ebx
+  800b80:	84 db                	test   %bl,%bl
+  800b82:	75 ec                	jne    800b70 <strlcpy+0x1c>
+  800b84:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800b86:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800b89:	29 f0                	sub    %esi,%eax
+}
+  800b8b:	5b                   	pop    %ebx
+  800b8c:	5e                   	pop    %esi
+  800b8d:	5d                   	pop    %ebp
+  800b8e:	c3                   	ret
+
+00800b8f <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800b8f:	55                   	push   %ebp
+  800b90:	89 e5                	mov    %esp,%ebp
+  800b92:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b95:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800b98:	eb 06                	jmp    800ba0 <strcmp+0x11>
+		p++, q++;
+  800b9a:	83 c1 01             	add    $0x1,%ecx
+  800b9d:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800ba0:	0f b6 01             	movzbl (%ecx),%eax
+  800ba3:	84 c0                	test   %al,%al
+  800ba5:	74 04                	je     800bab <strcmp+0x1c>
+  800ba7:	3a 02                	cmp    (%edx),%al
+  800ba9:	74 ef                	je     800b9a <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800bab:	0f b6 c0             	movzbl %al,%eax
+  800bae:	0f b6 12             	movzbl (%edx),%edx
+  800bb1:	29 d0                	sub    %edx,%eax
+}
+  800bb3:	5d                   	pop    %ebp
+  800bb4:	c3                   	ret
+
+00800bb5 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800bb5:	55                   	push   %ebp
+  800bb6:	89 e5                	mov    %esp,%ebp
+  800bb8:	53                   	push   %ebx
+  800bb9:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bbc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bbf:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800bc2:	eb 09                	jmp    800bcd <strncmp+0x18>
+		n--, p++, q++;
+  800bc4:	83 ea 01             	sub    $0x1,%edx
+  800bc7:	83 c0 01             	add    $0x1,%eax
+  800bca:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800bcd:	85 d2                	test   %edx,%edx
+  800bcf:	74 18                	je     800be9 <strncmp+0x34>
+  800bd1:	0f b6 18             	movzbl (%eax),%ebx
+  800bd4:	84 db                	test   %bl,%bl
+  800bd6:	74 04                	je     800bdc <strncmp+0x27>
+  800bd8:	3a 19                	cmp    (%ecx),%bl
+  800bda:	74 e8                	je     800bc4 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800bdc:	0f b6 00             	movzbl (%eax),%eax
+  800bdf:	0f b6 11             	movzbl (%ecx),%edx
+  800be2:	29 d0                	sub    %edx,%eax
+}
+  800be4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800be7:	c9                   	leave
+  800be8:	c3                   	ret
+		return 0;
+  800be9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bee:	eb f4                	jmp    800be4 <strncmp+0x2f>
+
+00800bf0 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800bf0:	55                   	push   %ebp
+  800bf1:	89 e5                	mov    %esp,%ebp
+  800bf3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bf6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800bfa:	eb 03                	jmp    800bff <strchr+0xf>
+  800bfc:	83 c0 01             	add    $0x1,%eax
+  800bff:	0f b6 10             	movzbl (%eax),%edx
+  800c02:	84 d2                	test   %dl,%dl
+  800c04:	74 06                	je     800c0c <strchr+0x1c>
+		if (*s == c)
+  800c06:	38 ca                	cmp    %cl,%dl
+  800c08:	75 f2                	jne    800bfc <strchr+0xc>
+  800c0a:	eb 05                	jmp    800c11 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800c0c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c11:	5d                   	pop    %ebp
+  800c12:	c3                   	ret
+
+00800c13 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800c13:	55                   	push   %ebp
+  800c14:	89 e5                	mov    %esp,%ebp
+  800c16:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c19:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800c1d:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800c20:	38 ca                	cmp    %cl,%dl
+  800c22:	74 09                	je     800c2d <strfind+0x1a>
+  800c24:	84 d2                	test   %dl,%dl
+  800c26:	74 05                	je     800c2d <strfind+0x1a>
+	for (; *s; s++)
+  800c28:	83 c0 01             	add    $0x1,%eax
+  800c2b:	eb f0                	jmp    800c1d <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800c2d:	5d                   	pop    %ebp
+  800c2e:	c3                   	ret
+
+00800c2f <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800c2f:	55                   	push   %ebp
+  800c30:	89 e5                	mov    %esp,%ebp
+  800c32:	57                   	push   %edi
+  800c33:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800c36:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800c39:	85 c9                	test   %ecx,%ecx
+  800c3b:	74 20                	je     800c5d <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800c3d:	89 f8                	mov    %edi,%eax
+  800c3f:	09 c8                	or     %ecx,%eax
+  800c41:	a8 03                	test   $0x3,%al
+  800c43:	75 12                	jne    800c57 <memset+0x28>
+		c &= 0xFF;
+  800c45:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800c49:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800c4f:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800c52:	fc                   	cld
+  800c53:	f3 ab                	rep stos %eax,%es:(%edi)
+  800c55:	eb 06                	jmp    800c5d <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800c57:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c5a:	fc                   	cld
+  800c5b:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800c5d:	89 f8                	mov    %edi,%eax
+  800c5f:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800c62:	c9                   	leave
+  800c63:	c3                   	ret
+
+00800c64 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800c64:	55                   	push   %ebp
+  800c65:	89 e5                	mov    %esp,%ebp
+  800c67:	57                   	push   %edi
+  800c68:	56                   	push   %esi
+  800c69:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c6c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c6f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800c72:	39 c6                	cmp    %eax,%esi
+  800c74:	73 32                	jae    800ca8 <memmove+0x44>
+  800c76:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800c79:	39 d0                	cmp    %edx,%eax
+  800c7b:	73 2b                	jae    800ca8 <memmove+0x44>
+		s += n;
+		d += n;
+  800c7d:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c80:	89 d6                	mov    %edx,%esi
+  800c82:	09 fe                	or     %edi,%esi
+  800c84:	09 ce                	or     %ecx,%esi
+  800c86:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800c8c:	75 0e                	jne    800c9c <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800c8e:	83 ef 04             	sub    $0x4,%edi
+  800c91:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800c94:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800c97:	fd                   	std
+  800c98:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c9a:	eb 09                	jmp    800ca5 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800c9c:	83 ef 01             	sub    $0x1,%edi
+  800c9f:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800ca2:	fd                   	std
+  800ca3:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800ca5:	fc                   	cld
+  800ca6:	eb 1a                	jmp    800cc2 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ca8:	89 f2                	mov    %esi,%edx
+  800caa:	09 c2                	or     %eax,%edx
+  800cac:	09 ca                	or     %ecx,%edx
+  800cae:	f6 c2 03             	test   $0x3,%dl
+  800cb1:	75 0a                	jne    800cbd <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800cb3:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800cb6:	89 c7                	mov    %eax,%edi
+  800cb8:	fc                   	cld
+  800cb9:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800cbb:	eb 05                	jmp    800cc2 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800cbd:	89 c7                	mov    %eax,%edi
+  800cbf:	fc                   	cld
+  800cc0:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800cc2:	5e                   	pop    %esi
+  800cc3:	5f                   	pop    %edi
+  800cc4:	5d                   	pop    %ebp
+  800cc5:	c3                   	ret
+
+00800cc6 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800cc6:	55                   	push   %ebp
+  800cc7:	89 e5                	mov    %esp,%ebp
+  800cc9:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800ccc:	ff 75 10             	push   0x10(%ebp)
+  800ccf:	ff 75 0c             	push   0xc(%ebp)
+  800cd2:	ff 75 08             	push   0x8(%ebp)
+  800cd5:	e8 8a ff ff ff       	call   800c64 <memmove>
+}
+  800cda:	c9                   	leave
+  800cdb:	c3                   	ret
+
+00800cdc <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800cdc:	55                   	push   %ebp
+  800cdd:	89 e5                	mov    %esp,%ebp
+  800cdf:	56                   	push   %esi
+  800ce0:	53                   	push   %ebx
+  800ce1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ce4:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800ce7:	89 c6                	mov    %eax,%esi
+  800ce9:	03 75 10             	add    0x10(%ebp),%esi
+  800cec:	eb 06                	jmp    800cf4 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800cee:	83 c0 01             	add    $0x1,%eax
+  800cf1:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800cf4:	39 f0                	cmp    %esi,%eax
+  800cf6:	74 14                	je     800d0c <memcmp+0x30>
+		if (*s1 != *s2)
+  800cf8:	0f b6 08             	movzbl (%eax),%ecx
+  800cfb:	0f b6 1a             	movzbl (%edx),%ebx
+  800cfe:	38 d9                	cmp    %bl,%cl
+  800d00:	74 ec                	je     800cee <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800d02:	0f b6 c1             	movzbl %cl,%eax
+  800d05:	0f b6 db             	movzbl %bl,%ebx
+  800d08:	29 d8                	sub    %ebx,%eax
+  800d0a:	eb 05                	jmp    800d11 <memcmp+0x35>
+	}
+
+	return 0;
+  800d0c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d11:	5b                   	pop    %ebx
+  800d12:	5e                   	pop    %esi
+  800d13:	5d                   	pop    %ebp
+  800d14:	c3                   	ret
+
+00800d15 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800d15:	55                   	push   %ebp
+  800d16:	89 e5                	mov    %esp,%ebp
+  800d18:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d1b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800d1e:	89 c2                	mov    %eax,%edx
+  800d20:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800d23:	eb 03                	jmp    800d28 <memfind+0x13>
+  800d25:	83 c0 01             	add    $0x1,%eax
+  800d28:	39 d0                	cmp    %edx,%eax
+  800d2a:	73 04                	jae    800d30 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800d2c:	38 08                	cmp    %cl,(%eax)
+  800d2e:	75 f5                	jne    800d25 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800d30:	5d                   	pop    %ebp
+  800d31:	c3                   	ret
+
+00800d32 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800d32:	55                   	push   %ebp
+  800d33:	89 e5                	mov    %esp,%ebp
+  800d35:	57                   	push   %edi
+  800d36:	56                   	push   %esi
+  800d37:	53                   	push   %ebx
+  800d38:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d3b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800d3e:	eb 03                	jmp    800d43 <strtol+0x11>
+		s++;
+  800d40:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800d43:	0f b6 02             	movzbl (%edx),%eax
+  800d46:	3c 20                	cmp    $0x20,%al
+  800d48:	74 f6                	je     800d40 <strtol+0xe>
+  800d4a:	3c 09                	cmp    $0x9,%al
+  800d4c:	74 f2                	je     800d40 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800d4e:	3c 2b                	cmp    $0x2b,%al
+  800d50:	74 2a                	je     800d7c <strtol+0x4a>
+	int neg = 0;
+  800d52:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800d57:	3c 2d                	cmp    $0x2d,%al
+  800d59:	74 2b                	je     800d86 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d5b:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800d61:	75 0f                	jne    800d72 <strtol+0x40>
+  800d63:	80 3a 30             	cmpb   $0x30,(%edx)
+  800d66:	74 28                	je     800d90 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800d68:	85 db                	test   %ebx,%ebx
+  800d6a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d6f:	0f 44 d8             	cmove  %eax,%ebx
+  800d72:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d77:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800d7a:	eb 46                	jmp    800dc2 <strtol+0x90>
+		s++;
+  800d7c:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800d7f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d84:	eb d5                	jmp    800d5b <strtol+0x29>
+		s++, neg = 1;
+  800d86:	83 c2 01             	add    $0x1,%edx
+  800d89:	bf 01 00 00 00       	mov    $0x1,%edi
+  800d8e:	eb cb                	jmp    800d5b <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d90:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800d94:	74 0e                	je     800da4 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800d96:	85 db                	test   %ebx,%ebx
+  800d98:	75 d8                	jne    800d72 <strtol+0x40>
+		s++, base = 8;
+  800d9a:	83 c2 01             	add    $0x1,%edx
+  800d9d:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800da2:	eb ce                	jmp    800d72 <strtol+0x40>
+		s += 2, base = 16;
+  800da4:	83 c2 02             	add    $0x2,%edx
+  800da7:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800dac:	eb c4                	jmp    800d72 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800dae:	0f be c0             	movsbl %al,%eax
+  800db1:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800db4:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800db7:	7d 3a                	jge    800df3 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800db9:	83 c2 01             	add    $0x1,%edx
+  800dbc:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800dc0:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800dc2:	0f b6 02             	movzbl (%edx),%eax
+  800dc5:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800dc8:	89 f3                	mov    %esi,%ebx
+  800dca:	80 fb 09             	cmp    $0x9,%bl
+  800dcd:	76 df                	jbe    800dae <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800dcf:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800dd2:	89 f3                	mov    %esi,%ebx
+  800dd4:	80 fb 19             	cmp    $0x19,%bl
+  800dd7:	77 08                	ja     800de1 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800dd9:	0f be c0             	movsbl %al,%eax
+  800ddc:	83 e8 57             	sub    $0x57,%eax
+  800ddf:	eb d3                	jmp    800db4 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800de1:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800de4:	89 f3                	mov    %esi,%ebx
+  800de6:	80 fb 19             	cmp    $0x19,%bl
+  800de9:	77 08                	ja     800df3 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800deb:	0f be c0             	movsbl %al,%eax
+  800dee:	83 e8 37             	sub    $0x37,%eax
+  800df1:	eb c1                	jmp    800db4 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800df3:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800df7:	74 05                	je     800dfe <strtol+0xcc>
+		*endptr = (char *) s;
+  800df9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800dfc:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800dfe:	89 c8                	mov    %ecx,%eax
+  800e00:	f7 d8                	neg    %eax
+  800e02:	85 ff                	test   %edi,%edi
+  800e04:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800e07:	89 c8                	mov    %ecx,%eax
+  800e09:	5b                   	pop    %ebx
+  800e0a:	5e                   	pop    %esi
+  800e0b:	5f                   	pop    %edi
+  800e0c:	5d                   	pop    %ebp
+  800e0d:	c3                   	ret
+
+00800e0e <atoi>:
+
+int
+atoi(const char* s)
+{
+  800e0e:	55                   	push   %ebp
+  800e0f:	89 e5                	mov    %esp,%ebp
+  800e11:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  800e14:	6a 00                	push   $0x0
+  800e16:	6a 00                	push   $0x0
+  800e18:	ff 75 08             	push   0x8(%ebp)
+  800e1b:	e8 12 ff ff ff       	call   800d32 <strtol>
+}
+  800e20:	c9                   	leave
+  800e21:	c3                   	ret
+
+00800e22 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800e22:	55                   	push   %ebp
+  800e23:	89 e5                	mov    %esp,%ebp
+  800e25:	57                   	push   %edi
+  800e26:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e27:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e2c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e2f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e32:	89 c3                	mov    %eax,%ebx
+  800e34:	89 c7                	mov    %eax,%edi
+  800e36:	6a 00                	push   $0x0
+  800e38:	55                   	push   %ebp
+  800e39:	56                   	push   %esi
+  800e3a:	89 e5                	mov    %esp,%ebp
+  800e3c:	8d 35 44 0e 80 00    	lea    0x800e44,%esi
+  800e42:	0f 34                	sysenter
+
+00800e44 <after_sysenter_label_47>:
+  800e44:	5e                   	pop    %esi
+  800e45:	5d                   	pop    %ebp
+  800e46:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800e49:	5b                   	pop    %ebx
+  800e4a:	5f                   	pop    %edi
+  800e4b:	5d                   	pop    %ebp
+  800e4c:	c3                   	ret
+
+00800e4d <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800e4d:	55                   	push   %ebp
+  800e4e:	89 e5                	mov    %esp,%ebp
+  800e50:	57                   	push   %edi
+  800e51:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e52:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e57:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e5c:	89 d1                	mov    %edx,%ecx
+  800e5e:	89 d3                	mov    %edx,%ebx
+  800e60:	89 d7                	mov    %edx,%edi
+  800e62:	6a 00                	push   $0x0
+  800e64:	55                   	push   %ebp
+  800e65:	56                   	push   %esi
+  800e66:	89 e5                	mov    %esp,%ebp
+  800e68:	8d 35 70 0e 80 00    	lea    0x800e70,%esi
+  800e6e:	0f 34                	sysenter
+
+00800e70 <after_sysenter_label_128>:
+  800e70:	5e                   	pop    %esi
+  800e71:	5d                   	pop    %ebp
+  800e72:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800e75:	5b                   	pop    %ebx
+  800e76:	5f                   	pop    %edi
+  800e77:	5d                   	pop    %ebp
+  800e78:	c3                   	ret
+
+00800e79 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800e79:	55                   	push   %ebp
+  800e7a:	89 e5                	mov    %esp,%ebp
+  800e7c:	57                   	push   %edi
+  800e7d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e7e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e81:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e86:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e8b:	89 cb                	mov    %ecx,%ebx
+  800e8d:	89 cf                	mov    %ecx,%edi
+  800e8f:	6a 00                	push   $0x0
+  800e91:	55                   	push   %ebp
+  800e92:	56                   	push   %esi
+  800e93:	89 e5                	mov    %esp,%ebp
+  800e95:	8d 35 9d 0e 80 00    	lea    0x800e9d,%esi
+  800e9b:	0f 34                	sysenter
+
+00800e9d <after_sysenter_label_212>:
+  800e9d:	5e                   	pop    %esi
+  800e9e:	5d                   	pop    %ebp
+  800e9f:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800ea2:	85 c0                	test   %eax,%eax
+  800ea4:	7f 07                	jg     800ead <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800ea6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ea9:	5b                   	pop    %ebx
+  800eaa:	5f                   	pop    %edi
+  800eab:	5d                   	pop    %ebp
+  800eac:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ead:	83 ec 0c             	sub    $0xc,%esp
+  800eb0:	50                   	push   %eax
+  800eb1:	6a 03                	push   $0x3
+  800eb3:	68 55 4f 80 00       	push   $0x804f55
+  800eb8:	6a 54                	push   $0x54
+  800eba:	68 72 4f 80 00       	push   $0x804f72
+  800ebf:	e8 5b f5 ff ff       	call   80041f <_panic>
+
+00800ec4 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800ec4:	55                   	push   %ebp
+  800ec5:	89 e5                	mov    %esp,%ebp
+  800ec7:	57                   	push   %edi
+  800ec8:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ec9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ece:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ed3:	89 d1                	mov    %edx,%ecx
+  800ed5:	89 d3                	mov    %edx,%ebx
+  800ed7:	89 d7                	mov    %edx,%edi
+  800ed9:	6a 00                	push   $0x0
+  800edb:	55                   	push   %ebp
+  800edc:	56                   	push   %esi
+  800edd:	89 e5                	mov    %esp,%ebp
+  800edf:	8d 35 e7 0e 80 00    	lea    0x800ee7,%esi
+  800ee5:	0f 34                	sysenter
+
+00800ee7 <after_sysenter_label_309>:
+  800ee7:	5e                   	pop    %esi
+  800ee8:	5d                   	pop    %ebp
+  800ee9:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800eec:	5b                   	pop    %ebx
+  800eed:	5f                   	pop    %edi
+  800eee:	5d                   	pop    %ebp
+  800eef:	c3                   	ret
+
+00800ef0 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800ef0:	55                   	push   %ebp
+  800ef1:	89 e5                	mov    %esp,%ebp
+  800ef3:	57                   	push   %edi
+  800ef4:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ef5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800efa:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800eff:	89 d1                	mov    %edx,%ecx
+  800f01:	89 d3                	mov    %edx,%ebx
+  800f03:	89 d7                	mov    %edx,%edi
+  800f05:	6a 00                	push   $0x0
+  800f07:	55                   	push   %ebp
+  800f08:	56                   	push   %esi
+  800f09:	89 e5                	mov    %esp,%ebp
+  800f0b:	8d 35 13 0f 80 00    	lea    0x800f13,%esi
+  800f11:	0f 34                	sysenter
+
+00800f13 <after_sysenter_label_391>:
+  800f13:	5e                   	pop    %esi
+  800f14:	5d                   	pop    %ebp
+  800f15:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800f18:	5b                   	pop    %ebx
+  800f19:	5f                   	pop    %edi
+  800f1a:	5d                   	pop    %ebp
+  800f1b:	c3                   	ret
+
+00800f1c <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800f1c:	55                   	push   %ebp
+  800f1d:	89 e5                	mov    %esp,%ebp
+  800f1f:	57                   	push   %edi
+  800f20:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f21:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f24:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f27:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f2c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f31:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f34:	6a 00                	push   $0x0
+  800f36:	55                   	push   %ebp
+  800f37:	56                   	push   %esi
+  800f38:	89 e5                	mov    %esp,%ebp
+  800f3a:	8d 35 42 0f 80 00    	lea    0x800f42,%esi
+  800f40:	0f 34                	sysenter
+
+00800f42 <after_sysenter_label_479>:
+  800f42:	5e                   	pop    %esi
+  800f43:	5d                   	pop    %ebp
+  800f44:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800f47:	85 c0                	test   %eax,%eax
+  800f49:	7f 07                	jg     800f52 <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800f4b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f4e:	5b                   	pop    %ebx
+  800f4f:	5f                   	pop    %edi
+  800f50:	5d                   	pop    %ebp
+  800f51:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f52:	83 ec 0c             	sub    $0xc,%esp
+  800f55:	50                   	push   %eax
+  800f56:	6a 04                	push   $0x4
+  800f58:	68 55 4f 80 00       	push   $0x804f55
+  800f5d:	6a 54                	push   $0x54
+  800f5f:	68 72 4f 80 00       	push   $0x804f72
+  800f64:	e8 b6 f4 ff ff       	call   80041f <_panic>
+
+00800f69 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800f69:	55                   	push   %ebp
+  800f6a:	89 e5                	mov    %esp,%ebp
+  800f6c:	57                   	push   %edi
+  800f6d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f6e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f71:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f74:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f79:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f7c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f7f:	ff 75 18             	push   0x18(%ebp)
+  800f82:	55                   	push   %ebp
+  800f83:	56                   	push   %esi
+  800f84:	89 e5                	mov    %esp,%ebp
+  800f86:	8d 35 8e 0f 80 00    	lea    0x800f8e,%esi
+  800f8c:	0f 34                	sysenter
+
+00800f8e <after_sysenter_label_593>:
+  800f8e:	5e                   	pop    %esi
+  800f8f:	5d                   	pop    %ebp
+  800f90:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800f93:	85 c0                	test   %eax,%eax
+  800f95:	7f 07                	jg     800f9e <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800f97:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f9a:	5b                   	pop    %ebx
+  800f9b:	5f                   	pop    %edi
+  800f9c:	5d                   	pop    %ebp
+  800f9d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f9e:	83 ec 0c             	sub    $0xc,%esp
+  800fa1:	50                   	push   %eax
+  800fa2:	6a 05                	push   $0x5
+  800fa4:	68 55 4f 80 00       	push   $0x804f55
+  800fa9:	6a 54                	push   $0x54
+  800fab:	68 72 4f 80 00       	push   $0x804f72
+  800fb0:	e8 6a f4 ff ff       	call   80041f <_panic>
+
+00800fb5 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800fb5:	55                   	push   %ebp
+  800fb6:	89 e5                	mov    %esp,%ebp
+  800fb8:	57                   	push   %edi
+  800fb9:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fbf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fc5:	b8 06 00 00 00       	mov    $0x6,%eax
+  800fca:	89 df                	mov    %ebx,%edi
+  800fcc:	6a 00                	push   $0x0
+  800fce:	55                   	push   %ebp
+  800fcf:	56                   	push   %esi
+  800fd0:	89 e5                	mov    %esp,%ebp
+  800fd2:	8d 35 da 0f 80 00    	lea    0x800fda,%esi
+  800fd8:	0f 34                	sysenter
+
+00800fda <after_sysenter_label_704>:
+  800fda:	5e                   	pop    %esi
+  800fdb:	5d                   	pop    %ebp
+  800fdc:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800fdf:	85 c0                	test   %eax,%eax
+  800fe1:	7f 07                	jg     800fea <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800fe3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fe6:	5b                   	pop    %ebx
+  800fe7:	5f                   	pop    %edi
+  800fe8:	5d                   	pop    %ebp
+  800fe9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fea:	83 ec 0c             	sub    $0xc,%esp
+  800fed:	50                   	push   %eax
+  800fee:	6a 06                	push   $0x6
+  800ff0:	68 55 4f 80 00       	push   $0x804f55
+  800ff5:	6a 54                	push   $0x54
+  800ff7:	68 72 4f 80 00       	push   $0x804f72
+  800ffc:	e8 1e f4 ff ff       	call   80041f <_panic>
+
+00801001 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801001:	55                   	push   %ebp
+  801002:	89 e5                	mov    %esp,%ebp
+  801004:	57                   	push   %edi
+  801005:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801006:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80100b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80100e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801011:	b8 08 00 00 00       	mov    $0x8,%eax
+  801016:	89 df                	mov    %ebx,%edi
+  801018:	6a 00                	push   $0x0
+  80101a:	55                   	push   %ebp
+  80101b:	56                   	push   %esi
+  80101c:	89 e5                	mov    %esp,%ebp
+  80101e:	8d 35 26 10 80 00    	lea    0x801026,%esi
+  801024:	0f 34                	sysenter
+
+00801026 <after_sysenter_label_808>:
+  801026:	5e                   	pop    %esi
+  801027:	5d                   	pop    %ebp
+  801028:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80102b:	85 c0                	test   %eax,%eax
+  80102d:	7f 07                	jg     801036 <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  80102f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801032:	5b                   	pop    %ebx
+  801033:	5f                   	pop    %edi
+  801034:	5d                   	pop    %ebp
+  801035:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801036:	83 ec 0c             	sub    $0xc,%esp
+  801039:	50                   	push   %eax
+  80103a:	6a 08                	push   $0x8
+  80103c:	68 55 4f 80 00       	push   $0x804f55
+  801041:	6a 54                	push   $0x54
+  801043:	68 72 4f 80 00       	push   $0x804f72
+  801048:	e8 d2 f3 ff ff       	call   80041f <_panic>
+
+0080104d <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80104d:	55                   	push   %ebp
+  80104e:	89 e5                	mov    %esp,%ebp
+  801050:	57                   	push   %edi
+  801051:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801052:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801057:	8b 55 08             	mov    0x8(%ebp),%edx
+  80105a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80105d:	b8 09 00 00 00       	mov    $0x9,%eax
+  801062:	89 df                	mov    %ebx,%edi
+  801064:	6a 00                	push   $0x0
+  801066:	55                   	push   %ebp
+  801067:	56                   	push   %esi
+  801068:	89 e5                	mov    %esp,%ebp
+  80106a:	8d 35 72 10 80 00    	lea    0x801072,%esi
+  801070:	0f 34                	sysenter
+
+00801072 <after_sysenter_label_912>:
+  801072:	5e                   	pop    %esi
+  801073:	5d                   	pop    %ebp
+  801074:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801077:	85 c0                	test   %eax,%eax
+  801079:	7f 07                	jg     801082 <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  80107b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80107e:	5b                   	pop    %ebx
+  80107f:	5f                   	pop    %edi
+  801080:	5d                   	pop    %ebp
+  801081:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801082:	83 ec 0c             	sub    $0xc,%esp
+  801085:	50                   	push   %eax
+  801086:	6a 09                	push   $0x9
+  801088:	68 55 4f 80 00       	push   $0x804f55
+  80108d:	6a 54                	push   $0x54
+  80108f:	68 72 4f 80 00       	push   $0x804f72
+  801094:	e8 86 f3 ff ff       	call   80041f <_panic>
+
+00801099 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801099:	55                   	push   %ebp
+  80109a:	89 e5                	mov    %esp,%ebp
+  80109c:	57                   	push   %edi
+  80109d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80109e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010ae:	89 df                	mov    %ebx,%edi
+  8010b0:	6a 00                	push   $0x0
+  8010b2:	55                   	push   %ebp
+  8010b3:	56                   	push   %esi
+  8010b4:	89 e5                	mov    %esp,%ebp
+  8010b6:	8d 35 be 10 80 00    	lea    0x8010be,%esi
+  8010bc:	0f 34                	sysenter
+
+008010be <after_sysenter_label_1016>:
+  8010be:	5e                   	pop    %esi
+  8010bf:	5d                   	pop    %ebp
+  8010c0:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8010c3:	85 c0                	test   %eax,%eax
+  8010c5:	7f 07                	jg     8010ce <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8010c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8010ca:	5b                   	pop    %ebx
+  8010cb:	5f                   	pop    %edi
+  8010cc:	5d                   	pop    %ebp
+  8010cd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010ce:	83 ec 0c             	sub    $0xc,%esp
+  8010d1:	50                   	push   %eax
+  8010d2:	6a 0a                	push   $0xa
+  8010d4:	68 55 4f 80 00       	push   $0x804f55
+  8010d9:	6a 54                	push   $0x54
+  8010db:	68 72 4f 80 00       	push   $0x804f72
+  8010e0:	e8 3a f3 ff ff       	call   80041f <_panic>
+
+008010e5 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8010e5:	55                   	push   %ebp
+  8010e6:	89 e5                	mov    %esp,%ebp
+  8010e8:	57                   	push   %edi
+  8010e9:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f0:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010f5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010f8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010fb:	6a 00                	push   $0x0
+  8010fd:	55                   	push   %ebp
+  8010fe:	56                   	push   %esi
+  8010ff:	89 e5                	mov    %esp,%ebp
+  801101:	8d 35 09 11 80 00    	lea    0x801109,%esi
+  801107:	0f 34                	sysenter
+
+00801109 <after_sysenter_label_1126>:
+  801109:	5e                   	pop    %esi
+  80110a:	5d                   	pop    %ebp
+  80110b:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80110e:	5b                   	pop    %ebx
+  80110f:	5f                   	pop    %edi
+  801110:	5d                   	pop    %ebp
+  801111:	c3                   	ret
+
+00801112 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801112:	55                   	push   %ebp
+  801113:	89 e5                	mov    %esp,%ebp
+  801115:	57                   	push   %edi
+  801116:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801117:	8b 55 08             	mov    0x8(%ebp),%edx
+  80111a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80111f:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801124:	89 cb                	mov    %ecx,%ebx
+  801126:	89 cf                	mov    %ecx,%edi
+  801128:	6a 00                	push   $0x0
+  80112a:	55                   	push   %ebp
+  80112b:	56                   	push   %esi
+  80112c:	89 e5                	mov    %esp,%ebp
+  80112e:	8d 35 36 11 80 00    	lea    0x801136,%esi
+  801134:	0f 34                	sysenter
+
+00801136 <after_sysenter_label_1210>:
+  801136:	5e                   	pop    %esi
+  801137:	5d                   	pop    %ebp
+  801138:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80113b:	85 c0                	test   %eax,%eax
+  80113d:	7f 07                	jg     801146 <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  80113f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801142:	5b                   	pop    %ebx
+  801143:	5f                   	pop    %edi
+  801144:	5d                   	pop    %ebp
+  801145:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801146:	83 ec 0c             	sub    $0xc,%esp
+  801149:	50                   	push   %eax
+  80114a:	6a 0d                	push   $0xd
+  80114c:	68 55 4f 80 00       	push   $0x804f55
+  801151:	6a 54                	push   $0x54
+  801153:	68 72 4f 80 00       	push   $0x804f72
+  801158:	e8 c2 f2 ff ff       	call   80041f <_panic>
+
+0080115d <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  80115d:	55                   	push   %ebp
+  80115e:	89 e5                	mov    %esp,%ebp
+  801160:	57                   	push   %edi
+  801161:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801162:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801167:	8b 55 08             	mov    0x8(%ebp),%edx
+  80116a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80116d:	b8 42 00 00 00       	mov    $0x42,%eax
+  801172:	89 df                	mov    %ebx,%edi
+  801174:	6a 00                	push   $0x0
+  801176:	55                   	push   %ebp
+  801177:	56                   	push   %esi
+  801178:	89 e5                	mov    %esp,%ebp
+  80117a:	8d 35 82 11 80 00    	lea    0x801182,%esi
+  801180:	0f 34                	sysenter
+
+00801182 <after_sysenter_label_1311>:
+  801182:	5e                   	pop    %esi
+  801183:	5d                   	pop    %ebp
+  801184:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801187:	85 c0                	test   %eax,%eax
+  801189:	7f 07                	jg     801192 <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  80118b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80118e:	5b                   	pop    %ebx
+  80118f:	5f                   	pop    %edi
+  801190:	5d                   	pop    %ebp
+  801191:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801192:	83 ec 0c             	sub    $0xc,%esp
+  801195:	50                   	push   %eax
+  801196:	6a 42                	push   $0x42
+  801198:	68 55 4f 80 00       	push   $0x804f55
+  80119d:	6a 54                	push   $0x54
+  80119f:	68 72 4f 80 00       	push   $0x804f72
+  8011a4:	e8 76 f2 ff ff       	call   80041f <_panic>
+
+008011a9 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8011a9:	55                   	push   %ebp
+  8011aa:	89 e5                	mov    %esp,%ebp
+  8011ac:	57                   	push   %edi
+  8011ad:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8011ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011b3:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011b8:	89 d1                	mov    %edx,%ecx
+  8011ba:	89 d3                	mov    %edx,%ebx
+  8011bc:	89 d7                	mov    %edx,%edi
+  8011be:	6a 00                	push   $0x0
+  8011c0:	55                   	push   %ebp
+  8011c1:	56                   	push   %esi
+  8011c2:	89 e5                	mov    %esp,%ebp
+  8011c4:	8d 35 cc 11 80 00    	lea    0x8011cc,%esi
+  8011ca:	0f 34                	sysenter
+
+008011cc <after_sysenter_label_1411>:
+  8011cc:	5e                   	pop    %esi
+  8011cd:	5d                   	pop    %ebp
+  8011ce:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8011d1:	5b                   	pop    %ebx
+  8011d2:	5f                   	pop    %edi
+  8011d3:	5d                   	pop    %ebp
+  8011d4:	c3                   	ret
+
+008011d5 <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  8011d5:	55                   	push   %ebp
+  8011d6:	89 e5                	mov    %esp,%ebp
+  8011d8:	57                   	push   %edi
+  8011d9:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8011da:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011df:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011e2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011e5:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8011ea:	89 df                	mov    %ebx,%edi
+  8011ec:	6a 00                	push   $0x0
+  8011ee:	55                   	push   %ebp
+  8011ef:	56                   	push   %esi
+  8011f0:	89 e5                	mov    %esp,%ebp
+  8011f2:	8d 35 fa 11 80 00    	lea    0x8011fa,%esi
+  8011f8:	0f 34                	sysenter
+
+008011fa <after_sysenter_label_1497>:
+  8011fa:	5e                   	pop    %esi
+  8011fb:	5d                   	pop    %ebp
+  8011fc:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  8011ff:	5b                   	pop    %ebx
+  801200:	5f                   	pop    %edi
+  801201:	5d                   	pop    %ebp
+  801202:	c3                   	ret
+
+00801203 <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  801203:	55                   	push   %ebp
+  801204:	89 e5                	mov    %esp,%ebp
+  801206:	57                   	push   %edi
+  801207:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801208:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80120d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801210:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801213:	b8 10 00 00 00       	mov    $0x10,%eax
+  801218:	89 df                	mov    %ebx,%edi
+  80121a:	6a 00                	push   $0x0
+  80121c:	55                   	push   %ebp
+  80121d:	56                   	push   %esi
+  80121e:	89 e5                	mov    %esp,%ebp
+  801220:	8d 35 28 12 80 00    	lea    0x801228,%esi
+  801226:	0f 34                	sysenter
+
+00801228 <after_sysenter_label_1583>:
+  801228:	5e                   	pop    %esi
+  801229:	5d                   	pop    %ebp
+  80122a:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  80122d:	5b                   	pop    %ebx
+  80122e:	5f                   	pop    %edi
+  80122f:	5d                   	pop    %ebp
+  801230:	c3                   	ret
+
+00801231 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  801231:	55                   	push   %ebp
+  801232:	89 e5                	mov    %esp,%ebp
+  801234:	57                   	push   %edi
+  801235:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801236:	8b 55 08             	mov    0x8(%ebp),%edx
+  801239:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80123c:	b8 11 00 00 00       	mov    $0x11,%eax
+  801241:	bf 00 00 00 00       	mov    $0x0,%edi
+  801246:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801249:	6a 00                	push   $0x0
+  80124b:	55                   	push   %ebp
+  80124c:	56                   	push   %esi
+  80124d:	89 e5                	mov    %esp,%ebp
+  80124f:	8d 35 57 12 80 00    	lea    0x801257,%esi
+  801255:	0f 34                	sysenter
+
+00801257 <after_sysenter_label_1672>:
+  801257:	5e                   	pop    %esi
+  801258:	5d                   	pop    %ebp
+  801259:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  80125c:	5b                   	pop    %ebx
+  80125d:	5f                   	pop    %edi
+  80125e:	5d                   	pop    %ebp
+  80125f:	c3                   	ret
+
+00801260 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  801260:	55                   	push   %ebp
+  801261:	89 e5                	mov    %esp,%ebp
+  801263:	57                   	push   %edi
+  801264:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801265:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80126a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80126d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801270:	b8 12 00 00 00       	mov    $0x12,%eax
+  801275:	89 df                	mov    %ebx,%edi
+  801277:	6a 00                	push   $0x0
+  801279:	55                   	push   %ebp
+  80127a:	56                   	push   %esi
+  80127b:	89 e5                	mov    %esp,%ebp
+  80127d:	8d 35 85 12 80 00    	lea    0x801285,%esi
+  801283:	0f 34                	sysenter
+
+00801285 <after_sysenter_label_1758>:
+  801285:	5e                   	pop    %esi
+  801286:	5d                   	pop    %ebp
+  801287:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  80128a:	5b                   	pop    %ebx
+  80128b:	5f                   	pop    %edi
+  80128c:	5d                   	pop    %ebp
+  80128d:	c3                   	ret
+
+0080128e <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  80128e:	55                   	push   %ebp
+  80128f:	89 e5                	mov    %esp,%ebp
+  801291:	57                   	push   %edi
+  801292:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801293:	8b 55 08             	mov    0x8(%ebp),%edx
+  801296:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80129b:	b8 13 00 00 00       	mov    $0x13,%eax
+  8012a0:	89 cb                	mov    %ecx,%ebx
+  8012a2:	89 cf                	mov    %ecx,%edi
+  8012a4:	6a 00                	push   $0x0
+  8012a6:	55                   	push   %ebp
+  8012a7:	56                   	push   %esi
+  8012a8:	89 e5                	mov    %esp,%ebp
+  8012aa:	8d 35 b2 12 80 00    	lea    0x8012b2,%esi
+  8012b0:	0f 34                	sysenter
+
+008012b2 <after_sysenter_label_1842>:
+  8012b2:	5e                   	pop    %esi
+  8012b3:	5d                   	pop    %ebp
+  8012b4:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8012b7:	85 c0                	test   %eax,%eax
+  8012b9:	7f 07                	jg     8012c2 <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  8012bb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8012be:	5b                   	pop    %ebx
+  8012bf:	5f                   	pop    %edi
+  8012c0:	5d                   	pop    %ebp
+  8012c1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012c2:	83 ec 0c             	sub    $0xc,%esp
+  8012c5:	50                   	push   %eax
+  8012c6:	6a 13                	push   $0x13
+  8012c8:	68 55 4f 80 00       	push   $0x804f55
+  8012cd:	6a 54                	push   $0x54
+  8012cf:	68 72 4f 80 00       	push   $0x804f72
+  8012d4:	e8 46 f1 ff ff       	call   80041f <_panic>
+
+008012d9 <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  8012d9:	55                   	push   %ebp
+  8012da:	89 e5                	mov    %esp,%ebp
+  8012dc:	57                   	push   %edi
+  8012dd:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8012de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012e3:	b8 14 00 00 00       	mov    $0x14,%eax
+  8012e8:	89 d1                	mov    %edx,%ecx
+  8012ea:	89 d3                	mov    %edx,%ebx
+  8012ec:	89 d7                	mov    %edx,%edi
+  8012ee:	6a 00                	push   $0x0
+  8012f0:	55                   	push   %ebp
+  8012f1:	56                   	push   %esi
+  8012f2:	89 e5                	mov    %esp,%ebp
+  8012f4:	8d 35 fc 12 80 00    	lea    0x8012fc,%esi
+  8012fa:	0f 34                	sysenter
+
+008012fc <after_sysenter_label_1939>:
+  8012fc:	5e                   	pop    %esi
+  8012fd:	5d                   	pop    %ebp
+  8012fe:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  801301:	5b                   	pop    %ebx
+  801302:	5f                   	pop    %edi
+  801303:	5d                   	pop    %ebp
+  801304:	c3                   	ret
+
+00801305 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  801305:	55                   	push   %ebp
+  801306:	89 e5                	mov    %esp,%ebp
+  801308:	57                   	push   %edi
+  801309:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80130a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80130d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801310:	b8 15 00 00 00       	mov    $0x15,%eax
+  801315:	bf 00 00 00 00       	mov    $0x0,%edi
+  80131a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80131d:	6a 00                	push   $0x0
+  80131f:	55                   	push   %ebp
+  801320:	56                   	push   %esi
+  801321:	89 e5                	mov    %esp,%ebp
+  801323:	8d 35 2b 13 80 00    	lea    0x80132b,%esi
+  801329:	0f 34                	sysenter
+
+0080132b <after_sysenter_label_2028>:
+  80132b:	5e                   	pop    %esi
+  80132c:	5d                   	pop    %ebp
+  80132d:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  801330:	5b                   	pop    %ebx
+  801331:	5f                   	pop    %edi
+  801332:	5d                   	pop    %ebp
+  801333:	c3                   	ret
+
+00801334 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  801334:	55                   	push   %ebp
+  801335:	89 e5                	mov    %esp,%ebp
+  801337:	57                   	push   %edi
+  801338:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801339:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80133e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801341:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801344:	b8 16 00 00 00       	mov    $0x16,%eax
+  801349:	89 df                	mov    %ebx,%edi
+  80134b:	6a 00                	push   $0x0
+  80134d:	55                   	push   %ebp
+  80134e:	56                   	push   %esi
+  80134f:	89 e5                	mov    %esp,%ebp
+  801351:	8d 35 59 13 80 00    	lea    0x801359,%esi
+  801357:	0f 34                	sysenter
+
+00801359 <after_sysenter_label_2114>:
+  801359:	5e                   	pop    %esi
+  80135a:	5d                   	pop    %ebp
+  80135b:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  80135e:	5b                   	pop    %ebx
+  80135f:	5f                   	pop    %edi
+  801360:	5d                   	pop    %ebp
+  801361:	c3                   	ret
+
+00801362 <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  801362:	55                   	push   %ebp
+  801363:	89 e5                	mov    %esp,%ebp
+  801365:	57                   	push   %edi
+  801366:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801367:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80136c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80136f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801372:	b8 17 00 00 00       	mov    $0x17,%eax
+  801377:	89 df                	mov    %ebx,%edi
+  801379:	6a 00                	push   $0x0
+  80137b:	55                   	push   %ebp
+  80137c:	56                   	push   %esi
+  80137d:	89 e5                	mov    %esp,%ebp
+  80137f:	8d 35 87 13 80 00    	lea    0x801387,%esi
+  801385:	0f 34                	sysenter
+
+00801387 <after_sysenter_label_2200>:
+  801387:	5e                   	pop    %esi
+  801388:	5d                   	pop    %ebp
+  801389:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  80138c:	5b                   	pop    %ebx
+  80138d:	5f                   	pop    %edi
+  80138e:	5d                   	pop    %ebp
+  80138f:	c3                   	ret
+
+00801390 <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  801390:	55                   	push   %ebp
+  801391:	89 e5                	mov    %esp,%ebp
+  801393:	57                   	push   %edi
+  801394:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801395:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80139a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80139d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013a0:	b8 18 00 00 00       	mov    $0x18,%eax
+  8013a5:	89 df                	mov    %ebx,%edi
+  8013a7:	6a 00                	push   $0x0
+  8013a9:	55                   	push   %ebp
+  8013aa:	56                   	push   %esi
+  8013ab:	89 e5                	mov    %esp,%ebp
+  8013ad:	8d 35 b5 13 80 00    	lea    0x8013b5,%esi
+  8013b3:	0f 34                	sysenter
+
+008013b5 <after_sysenter_label_2286>:
+  8013b5:	5e                   	pop    %esi
+  8013b6:	5d                   	pop    %ebp
+  8013b7:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  8013ba:	5b                   	pop    %ebx
+  8013bb:	5f                   	pop    %edi
+  8013bc:	5d                   	pop    %ebp
+  8013bd:	c3                   	ret
+
+008013be <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  8013be:	55                   	push   %ebp
+  8013bf:	89 e5                	mov    %esp,%ebp
+  8013c1:	57                   	push   %edi
+  8013c2:	56                   	push   %esi
+  8013c3:	53                   	push   %ebx
+  8013c4:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  8013c7:	89 d6                	mov    %edx,%esi
+  8013c9:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  8013cc:	89 cf                	mov    %ecx,%edi
+  8013ce:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  8013d1:	89 fa                	mov    %edi,%edx
+  8013d3:	80 ce 08             	or     $0x8,%dh
+  8013d6:	f6 c5 08             	test   $0x8,%ch
+  8013d9:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  8013dc:	57                   	push   %edi
+  8013dd:	56                   	push   %esi
+  8013de:	50                   	push   %eax
+  8013df:	56                   	push   %esi
+  8013e0:	6a 00                	push   $0x0
+  8013e2:	e8 82 fb ff ff       	call   800f69 <sys_page_map>
+	if (r < 0) {
+  8013e7:	83 c4 20             	add    $0x20,%esp
+  8013ea:	85 c0                	test   %eax,%eax
+  8013ec:	78 27                	js     801415 <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  8013ee:	83 ec 0c             	sub    $0xc,%esp
+  8013f1:	57                   	push   %edi
+  8013f2:	56                   	push   %esi
+  8013f3:	6a 00                	push   $0x0
+  8013f5:	56                   	push   %esi
+  8013f6:	6a 00                	push   $0x0
+  8013f8:	e8 6c fb ff ff       	call   800f69 <sys_page_map>
+  8013fd:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  8013ff:	83 c4 20             	add    $0x20,%esp
+  801402:	85 c0                	test   %eax,%eax
+  801404:	78 24                	js     80142a <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  801406:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  80140b:	89 d8                	mov    %ebx,%eax
+  80140d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801410:	5b                   	pop    %ebx
+  801411:	5e                   	pop    %esi
+  801412:	5f                   	pop    %edi
+  801413:	5d                   	pop    %ebp
+  801414:	c3                   	ret
+  801415:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  801417:	83 ec 08             	sub    $0x8,%esp
+  80141a:	50                   	push   %eax
+  80141b:	68 80 4f 80 00       	push   $0x804f80
+  801420:	e8 d5 f0 ff ff       	call   8004fa <cprintf>
+		return r;
+  801425:	83 c4 10             	add    $0x10,%esp
+  801428:	eb e1                	jmp    80140b <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  80142a:	83 ec 08             	sub    $0x8,%esp
+  80142d:	50                   	push   %eax
+  80142e:	68 b0 4f 80 00       	push   $0x804fb0
+  801433:	e8 c2 f0 ff ff       	call   8004fa <cprintf>
+		return r;
+  801438:	83 c4 10             	add    $0x10,%esp
+  80143b:	eb ce                	jmp    80140b <duppage_cow+0x4d>
+
+0080143d <duppage>:
+{
+  80143d:	55                   	push   %ebp
+  80143e:	89 e5                	mov    %esp,%ebp
+  801440:	53                   	push   %ebx
+  801441:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  801444:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  801447:	51                   	push   %ecx
+  801448:	52                   	push   %edx
+  801449:	50                   	push   %eax
+  80144a:	52                   	push   %edx
+  80144b:	6a 00                	push   $0x0
+  80144d:	e8 17 fb ff ff       	call   800f69 <sys_page_map>
+	if (r < 0) {
+  801452:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  801455:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  80145a:	85 c0                	test   %eax,%eax
+  80145c:	78 07                	js     801465 <duppage+0x28>
+}
+  80145e:	89 d8                	mov    %ebx,%eax
+  801460:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801463:	c9                   	leave
+  801464:	c3                   	ret
+  801465:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  801467:	83 ec 08             	sub    $0x8,%esp
+  80146a:	50                   	push   %eax
+  80146b:	68 80 4f 80 00       	push   $0x804f80
+  801470:	e8 85 f0 ff ff       	call   8004fa <cprintf>
+		return r;
+  801475:	83 c4 10             	add    $0x10,%esp
+  801478:	eb e4                	jmp    80145e <duppage+0x21>
+
+0080147a <cow_copy>:
+{
+  80147a:	55                   	push   %ebp
+  80147b:	89 e5                	mov    %esp,%ebp
+  80147d:	56                   	push   %esi
+  80147e:	53                   	push   %ebx
+  80147f:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  801481:	83 ec 04             	sub    $0x4,%esp
+  801484:	6a 07                	push   $0x7
+  801486:	68 00 f0 7f 00       	push   $0x7ff000
+  80148b:	6a 00                	push   $0x0
+  80148d:	e8 8a fa ff ff       	call   800f1c <sys_page_alloc>
+	if (r < 0) {
+  801492:	83 c4 10             	add    $0x10,%esp
+  801495:	85 c0                	test   %eax,%eax
+  801497:	78 58                	js     8014f1 <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  801499:	83 ec 04             	sub    $0x4,%esp
+  80149c:	68 00 10 00 00       	push   $0x1000
+  8014a1:	56                   	push   %esi
+  8014a2:	68 00 f0 7f 00       	push   $0x7ff000
+  8014a7:	e8 b8 f7 ff ff       	call   800c64 <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  8014ac:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8014b3:	56                   	push   %esi
+  8014b4:	6a 00                	push   $0x0
+  8014b6:	68 00 f0 7f 00       	push   $0x7ff000
+  8014bb:	6a 00                	push   $0x0
+  8014bd:	e8 a7 fa ff ff       	call   800f69 <sys_page_map>
+  8014c2:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  8014c4:	83 c4 20             	add    $0x20,%esp
+  8014c7:	85 c0                	test   %eax,%eax
+  8014c9:	78 3b                	js     801506 <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  8014cb:	83 ec 08             	sub    $0x8,%esp
+  8014ce:	68 00 f0 7f 00       	push   $0x7ff000
+  8014d3:	6a 00                	push   $0x0
+  8014d5:	e8 db fa ff ff       	call   800fb5 <sys_page_unmap>
+  8014da:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  8014dc:	83 c4 10             	add    $0x10,%esp
+  8014df:	85 c0                	test   %eax,%eax
+  8014e1:	78 45                	js     801528 <cow_copy+0xae>
+	return 0;
+  8014e3:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8014e8:	89 d8                	mov    %ebx,%eax
+  8014ea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014ed:	5b                   	pop    %ebx
+  8014ee:	5e                   	pop    %esi
+  8014ef:	5d                   	pop    %ebp
+  8014f0:	c3                   	ret
+  8014f1:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  8014f3:	83 ec 08             	sub    $0x8,%esp
+  8014f6:	50                   	push   %eax
+  8014f7:	68 a0 50 80 00       	push   $0x8050a0
+  8014fc:	e8 f9 ef ff ff       	call   8004fa <cprintf>
+		return r;
+  801501:	83 c4 10             	add    $0x10,%esp
+  801504:	eb e2                	jmp    8014e8 <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  801506:	83 ec 08             	sub    $0x8,%esp
+  801509:	50                   	push   %eax
+  80150a:	68 bc 50 80 00       	push   $0x8050bc
+  80150f:	e8 e6 ef ff ff       	call   8004fa <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  801514:	83 c4 08             	add    $0x8,%esp
+  801517:	68 00 f0 7f 00       	push   $0x7ff000
+  80151c:	6a 00                	push   $0x0
+  80151e:	e8 92 fa ff ff       	call   800fb5 <sys_page_unmap>
+		return r;
+  801523:	83 c4 10             	add    $0x10,%esp
+  801526:	eb c0                	jmp    8014e8 <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  801528:	83 ec 08             	sub    $0x8,%esp
+  80152b:	50                   	push   %eax
+  80152c:	68 d8 4f 80 00       	push   $0x804fd8
+  801531:	e8 c4 ef ff ff       	call   8004fa <cprintf>
+		return r;
+  801536:	83 c4 10             	add    $0x10,%esp
+  801539:	eb ad                	jmp    8014e8 <cow_copy+0x6e>
+
+0080153b <pgfault>:
+{
+  80153b:	55                   	push   %ebp
+  80153c:	89 e5                	mov    %esp,%ebp
+  80153e:	56                   	push   %esi
+  80153f:	53                   	push   %ebx
+  801540:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  801543:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  801545:	89 d8                	mov    %ebx,%eax
+  801547:	c1 e8 16             	shr    $0x16,%eax
+  80154a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  801551:	89 de                	mov    %ebx,%esi
+  801553:	c1 ee 0c             	shr    $0xc,%esi
+  801556:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  80155d:	a8 07                	test   $0x7,%al
+  80155f:	74 3b                	je     80159c <pgfault+0x61>
+  801561:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  801567:	74 33                	je     80159c <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  801569:	83 ec 0c             	sub    $0xc,%esp
+  80156c:	68 00 f0 bf ee       	push   $0xeebff000
+  801571:	e8 cd 26 00 00       	call   803c43 <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  801576:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  80157d:	83 c4 10             	add    $0x10,%esp
+  801580:	f6 c4 08             	test   $0x8,%ah
+  801583:	75 30                	jne    8015b5 <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  801585:	83 ec 0c             	sub    $0xc,%esp
+  801588:	68 00 f0 bf ee       	push   $0xeebff000
+  80158d:	e8 1e 27 00 00       	call   803cb0 <mutex_unlock>
+}
+  801592:	83 c4 10             	add    $0x10,%esp
+  801595:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801598:	5b                   	pop    %ebx
+  801599:	5e                   	pop    %esi
+  80159a:	5d                   	pop    %ebp
+  80159b:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  80159c:	83 ec 08             	sub    $0x8,%esp
+  80159f:	ff 72 28             	push   0x28(%edx)
+  8015a2:	51                   	push   %ecx
+  8015a3:	50                   	push   %eax
+  8015a4:	68 fc 4f 80 00       	push   $0x804ffc
+  8015a9:	6a 3f                	push   $0x3f
+  8015ab:	68 d6 50 80 00       	push   $0x8050d6
+  8015b0:	e8 6a ee ff ff       	call   80041f <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  8015b5:	89 d8                	mov    %ebx,%eax
+  8015b7:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  8015bc:	e8 b9 fe ff ff       	call   80147a <cow_copy>
+  8015c1:	eb c2                	jmp    801585 <pgfault+0x4a>
+
+008015c3 <cow_enable>:
+{
+  8015c3:	55                   	push   %ebp
+  8015c4:	89 e5                	mov    %esp,%ebp
+  8015c6:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  8015c9:	68 3b 15 80 00       	push   $0x80153b
+  8015ce:	e8 f0 2f 00 00       	call   8045c3 <set_pgfault_handler>
+}
+  8015d3:	83 c4 10             	add    $0x10,%esp
+  8015d6:	c9                   	leave
+  8015d7:	c3                   	ret
+
+008015d8 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  8015d8:	55                   	push   %ebp
+  8015d9:	89 e5                	mov    %esp,%ebp
+  8015db:	57                   	push   %edi
+  8015dc:	56                   	push   %esi
+  8015dd:	53                   	push   %ebx
+  8015de:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  8015e1:	68 3b 15 80 00       	push   $0x80153b
+  8015e6:	e8 d8 2f 00 00       	call   8045c3 <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  8015eb:	b8 07 00 00 00       	mov    $0x7,%eax
+  8015f0:	cd 30                	int    $0x30
+  8015f2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  8015f5:	83 c4 10             	add    $0x10,%esp
+  8015f8:	85 c0                	test   %eax,%eax
+  8015fa:	78 4b                	js     801647 <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  8015fc:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  801601:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801606:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  801609:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80160d:	0f 85 16 01 00 00    	jne    801729 <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801613:	e8 ac f8 ff ff       	call   800ec4 <sys_getenvid>
+  801618:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80161d:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80161f:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  801625:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  80162b:	77 32                	ja     80165f <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80162d:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  801632:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  801634:	c1 ea 10             	shr    $0x10,%edx
+  801637:	74 26                	je     80165f <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801639:	c1 e2 10             	shl    $0x10,%edx
+  80163c:	89 d1                	mov    %edx,%ecx
+  80163e:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801643:	29 ca                	sub    %ecx,%edx
+  801645:	eb 1e                	jmp    801665 <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  801647:	83 ec 08             	sub    $0x8,%esp
+  80164a:	89 c7                	mov    %eax,%edi
+  80164c:	50                   	push   %eax
+  80164d:	68 e1 50 80 00       	push   $0x8050e1
+  801652:	e8 a3 ee ff ff       	call   8004fa <cprintf>
+		return eid;
+  801657:	83 c4 10             	add    $0x10,%esp
+  80165a:	e9 6c 01 00 00       	jmp    8017cb <fork+0x1f3>
+		return pthread_main_tls;
+  80165f:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801665:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  801668:	c1 e0 04             	shl    $0x4,%eax
+  80166b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801670:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  801672:	e8 15 2d 00 00       	call   80438c <pthread_fork_child>
+		return eid;
+  801677:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80167a:	e9 4c 01 00 00       	jmp    8017cb <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  80167f:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  801685:	89 da                	mov    %ebx,%edx
+  801687:	89 f8                	mov    %edi,%eax
+  801689:	e8 af fd ff ff       	call   80143d <duppage>
+  80168e:	85 c0                	test   %eax,%eax
+  801690:	79 28                	jns    8016ba <fork+0xe2>
+  801692:	89 c7                	mov    %eax,%edi
+  801694:	e9 32 01 00 00       	jmp    8017cb <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  801699:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  80169f:	83 f9 05             	cmp    $0x5,%ecx
+  8016a2:	75 58                	jne    8016fc <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8016a4:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8016a9:	89 da                	mov    %ebx,%edx
+  8016ab:	89 f8                	mov    %edi,%eax
+  8016ad:	e8 8b fd ff ff       	call   80143d <duppage>
+  8016b2:	85 c0                	test   %eax,%eax
+  8016b4:	0f 88 0f 01 00 00    	js     8017c9 <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  8016ba:	83 c3 01             	add    $0x1,%ebx
+  8016bd:	39 de                	cmp    %ebx,%esi
+  8016bf:	74 54                	je     801715 <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  8016c1:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  8016c8:	f6 c1 05             	test   $0x5,%cl
+  8016cb:	74 ed                	je     8016ba <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  8016cd:	f6 c5 04             	test   $0x4,%ch
+  8016d0:	75 ad                	jne    80167f <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  8016d2:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  8016d8:	74 bf                	je     801699 <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  8016da:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8016e0:	74 d8                	je     8016ba <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  8016e2:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  8016e8:	89 da                	mov    %ebx,%edx
+  8016ea:	89 f8                	mov    %edi,%eax
+  8016ec:	e8 cd fc ff ff       	call   8013be <duppage_cow>
+  8016f1:	85 c0                	test   %eax,%eax
+  8016f3:	79 c5                	jns    8016ba <fork+0xe2>
+  8016f5:	89 c7                	mov    %eax,%edi
+  8016f7:	e9 cf 00 00 00       	jmp    8017cb <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  8016fc:	68 2c 50 80 00       	push   $0x80502c
+  801701:	68 f1 50 80 00       	push   $0x8050f1
+  801706:	68 c6 00 00 00       	push   $0xc6
+  80170b:	68 d6 50 80 00       	push   $0x8050d6
+  801710:	e8 0a ed ff ff       	call   80041f <_panic>
+  801715:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  801718:	83 c1 01             	add    $0x1,%ecx
+  80171b:	81 c6 00 04 00 00    	add    $0x400,%esi
+  801721:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  801727:	74 18                	je     801741 <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  801729:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  801730:	a8 07                	test   $0x7,%al
+  801732:	74 e4                	je     801718 <fork+0x140>
+  801734:	89 cb                	mov    %ecx,%ebx
+  801736:	c1 e3 0a             	shl    $0xa,%ebx
+  801739:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80173c:	e9 7c ff ff ff       	jmp    8016bd <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  801741:	83 ec 04             	sub    $0x4,%esp
+  801744:	6a 07                	push   $0x7
+  801746:	68 00 f0 bf ee       	push   $0xeebff000
+  80174b:	ff 75 e4             	push   -0x1c(%ebp)
+  80174e:	e8 c9 f7 ff ff       	call   800f1c <sys_page_alloc>
+  801753:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801755:	83 c4 10             	add    $0x10,%esp
+  801758:	85 c0                	test   %eax,%eax
+  80175a:	78 34                	js     801790 <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  80175c:	83 ec 08             	sub    $0x8,%esp
+  80175f:	68 01 46 80 00       	push   $0x804601
+  801764:	ff 75 e4             	push   -0x1c(%ebp)
+  801767:	e8 2d f9 ff ff       	call   801099 <sys_env_set_pgfault_upcall>
+  80176c:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80176e:	83 c4 10             	add    $0x10,%esp
+  801771:	85 c0                	test   %eax,%eax
+  801773:	78 2e                	js     8017a3 <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  801775:	83 ec 08             	sub    $0x8,%esp
+  801778:	6a 02                	push   $0x2
+  80177a:	ff 75 e4             	push   -0x1c(%ebp)
+  80177d:	e8 7f f8 ff ff       	call   801001 <sys_env_set_status>
+  801782:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801784:	83 c4 10             	add    $0x10,%esp
+  801787:	85 c0                	test   %eax,%eax
+  801789:	78 2b                	js     8017b6 <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  80178b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80178e:	eb 3b                	jmp    8017cb <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  801790:	83 ec 08             	sub    $0x8,%esp
+  801793:	50                   	push   %eax
+  801794:	68 54 50 80 00       	push   $0x805054
+  801799:	e8 5c ed ff ff       	call   8004fa <cprintf>
+		return r;
+  80179e:	83 c4 10             	add    $0x10,%esp
+  8017a1:	eb 28                	jmp    8017cb <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  8017a3:	83 ec 08             	sub    $0x8,%esp
+  8017a6:	50                   	push   %eax
+  8017a7:	68 7c 50 80 00       	push   $0x80507c
+  8017ac:	e8 49 ed ff ff       	call   8004fa <cprintf>
+		return r;
+  8017b1:	83 c4 10             	add    $0x10,%esp
+  8017b4:	eb 15                	jmp    8017cb <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  8017b6:	83 ec 08             	sub    $0x8,%esp
+  8017b9:	50                   	push   %eax
+  8017ba:	68 06 51 80 00       	push   $0x805106
+  8017bf:	e8 36 ed ff ff       	call   8004fa <cprintf>
+		return r;
+  8017c4:	83 c4 10             	add    $0x10,%esp
+  8017c7:	eb 02                	jmp    8017cb <fork+0x1f3>
+  8017c9:	89 c7                	mov    %eax,%edi
+}
+  8017cb:	89 f8                	mov    %edi,%eax
+  8017cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017d0:	5b                   	pop    %ebx
+  8017d1:	5e                   	pop    %esi
+  8017d2:	5f                   	pop    %edi
+  8017d3:	5d                   	pop    %ebp
+  8017d4:	c3                   	ret
+
+008017d5 <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  8017d5:	55                   	push   %ebp
+  8017d6:	89 e5                	mov    %esp,%ebp
+  8017d8:	57                   	push   %edi
+  8017d9:	56                   	push   %esi
+  8017da:	53                   	push   %ebx
+  8017db:	83 ec 2c             	sub    $0x2c,%esp
+  8017de:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8017e0:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  8017e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8017eb:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8017f1:	77 0a                	ja     8017fd <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8017f3:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  8017f8:	29 c3                	sub    %eax,%ebx
+  8017fa:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  8017fd:	83 ec 0c             	sub    $0xc,%esp
+  801800:	68 3b 15 80 00       	push   $0x80153b
+  801805:	e8 b9 2d 00 00       	call   8045c3 <set_pgfault_handler>
+  80180a:	b8 07 00 00 00       	mov    $0x7,%eax
+  80180f:	cd 30                	int    $0x30
+  801811:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  801814:	83 c4 10             	add    $0x10,%esp
+  801817:	85 c0                	test   %eax,%eax
+  801819:	78 30                	js     80184b <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  80181b:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80181f:	74 42                	je     801863 <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  801821:	c1 e3 10             	shl    $0x10,%ebx
+  801824:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  801829:	29 d8                	sub    %ebx,%eax
+  80182b:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80182e:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  801833:	29 d8                	sub    %ebx,%eax
+  801835:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801838:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80183d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801842:	89 f7                	mov    %esi,%edi
+  801844:	89 d6                	mov    %edx,%esi
+  801846:	e9 2c 01 00 00       	jmp    801977 <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  80184b:	83 ec 08             	sub    $0x8,%esp
+  80184e:	89 c7                	mov    %eax,%edi
+  801850:	50                   	push   %eax
+  801851:	68 e1 50 80 00       	push   $0x8050e1
+  801856:	e8 9f ec ff ff       	call   8004fa <cprintf>
+		return eid;
+  80185b:	83 c4 10             	add    $0x10,%esp
+  80185e:	e9 d5 00 00 00       	jmp    801938 <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801863:	e8 5c f6 ff ff       	call   800ec4 <sys_getenvid>
+  801868:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80186d:	89 c2                	mov    %eax,%edx
+  80186f:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801871:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  801877:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80187c:	77 18                	ja     801896 <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80187e:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801883:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  801885:	c1 e8 10             	shr    $0x10,%eax
+  801888:	74 0c                	je     801896 <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80188a:	c1 e0 10             	shl    $0x10,%eax
+  80188d:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  801892:	29 c1                	sub    %eax,%ecx
+  801894:	eb 06                	jmp    80189c <sfork+0xc7>
+		return pthread_main_tls;
+  801896:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+  80189c:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80189f:	c1 e0 04             	shl    $0x4,%eax
+  8018a2:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8018a7:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  8018a9:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8018ac:	e9 87 00 00 00       	jmp    801938 <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  8018b1:	f6 c5 04             	test   $0x4,%ch
+  8018b4:	74 6c                	je     801922 <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  8018b6:	89 ca                	mov    %ecx,%edx
+  8018b8:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  8018be:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  8018c4:	74 7c                	je     801942 <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8018c6:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8018cc:	89 da                	mov    %ebx,%edx
+  8018ce:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8018d1:	e8 67 fb ff ff       	call   80143d <duppage>
+  8018d6:	85 c0                	test   %eax,%eax
+  8018d8:	0f 88 4f 01 00 00    	js     801a2d <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  8018de:	83 c3 01             	add    $0x1,%ebx
+  8018e1:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  8018e4:	74 7a                	je     801960 <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  8018e6:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  8018e8:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  8018ef:	f6 c1 01             	test   $0x1,%cl
+  8018f2:	74 ea                	je     8018de <sfork+0x109>
+  8018f4:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8018fa:	74 e2                	je     8018de <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  8018fc:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  801902:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  801905:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  80190a:	76 a5                	jbe    8018b1 <sfork+0xdc>
+  80190c:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  801912:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  801915:	39 fa                	cmp    %edi,%edx
+  801917:	73 9d                	jae    8018b6 <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  801919:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  80191c:	39 fa                	cmp    %edi,%edx
+  80191e:	72 96                	jb     8018b6 <sfork+0xe1>
+  801920:	eb 8f                	jmp    8018b1 <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  801922:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  801928:	89 da                	mov    %ebx,%edx
+  80192a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80192d:	e8 8c fa ff ff       	call   8013be <duppage_cow>
+  801932:	85 c0                	test   %eax,%eax
+  801934:	79 a8                	jns    8018de <sfork+0x109>
+  801936:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  801938:	89 f8                	mov    %edi,%eax
+  80193a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80193d:	5b                   	pop    %ebx
+  80193e:	5e                   	pop    %esi
+  80193f:	5f                   	pop    %edi
+  801940:	5d                   	pop    %ebp
+  801941:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  801942:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  801947:	e8 2e fb ff ff       	call   80147a <cow_copy>
+  80194c:	85 c0                	test   %eax,%eax
+  80194e:	0f 88 d2 00 00 00    	js     801a26 <sfork+0x251>
+				pte = uvpt[pn];
+  801954:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  80195b:	e9 66 ff ff ff       	jmp    8018c6 <sfork+0xf1>
+  801960:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801963:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  801966:	83 c6 01             	add    $0x1,%esi
+  801969:	81 c7 00 04 00 00    	add    $0x400,%edi
+  80196f:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  801975:	74 1b                	je     801992 <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  801977:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  80197e:	a8 01                	test   $0x1,%al
+  801980:	74 e4                	je     801966 <sfork+0x191>
+  801982:	89 f3                	mov    %esi,%ebx
+  801984:	c1 e3 0a             	shl    $0xa,%ebx
+  801987:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  80198a:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  80198d:	e9 4f ff ff ff       	jmp    8018e1 <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  801992:	83 ec 04             	sub    $0x4,%esp
+  801995:	6a 07                	push   $0x7
+  801997:	68 00 f0 bf ee       	push   $0xeebff000
+  80199c:	ff 75 e0             	push   -0x20(%ebp)
+  80199f:	e8 78 f5 ff ff       	call   800f1c <sys_page_alloc>
+  8019a4:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8019a6:	83 c4 10             	add    $0x10,%esp
+  8019a9:	85 c0                	test   %eax,%eax
+  8019ab:	78 37                	js     8019e4 <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  8019ad:	83 ec 08             	sub    $0x8,%esp
+  8019b0:	68 01 46 80 00       	push   $0x804601
+  8019b5:	ff 75 e0             	push   -0x20(%ebp)
+  8019b8:	e8 dc f6 ff ff       	call   801099 <sys_env_set_pgfault_upcall>
+  8019bd:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8019bf:	83 c4 10             	add    $0x10,%esp
+  8019c2:	85 c0                	test   %eax,%eax
+  8019c4:	78 34                	js     8019fa <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  8019c6:	83 ec 08             	sub    $0x8,%esp
+  8019c9:	6a 02                	push   $0x2
+  8019cb:	ff 75 e0             	push   -0x20(%ebp)
+  8019ce:	e8 2e f6 ff ff       	call   801001 <sys_env_set_status>
+  8019d3:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8019d5:	83 c4 10             	add    $0x10,%esp
+  8019d8:	85 c0                	test   %eax,%eax
+  8019da:	78 34                	js     801a10 <sfork+0x23b>
+	return eid;
+  8019dc:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8019df:	e9 54 ff ff ff       	jmp    801938 <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  8019e4:	83 ec 08             	sub    $0x8,%esp
+  8019e7:	50                   	push   %eax
+  8019e8:	68 54 50 80 00       	push   $0x805054
+  8019ed:	e8 08 eb ff ff       	call   8004fa <cprintf>
+		return r;
+  8019f2:	83 c4 10             	add    $0x10,%esp
+  8019f5:	e9 3e ff ff ff       	jmp    801938 <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  8019fa:	83 ec 08             	sub    $0x8,%esp
+  8019fd:	50                   	push   %eax
+  8019fe:	68 7c 50 80 00       	push   $0x80507c
+  801a03:	e8 f2 ea ff ff       	call   8004fa <cprintf>
+		return r;
+  801a08:	83 c4 10             	add    $0x10,%esp
+  801a0b:	e9 28 ff ff ff       	jmp    801938 <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  801a10:	83 ec 08             	sub    $0x8,%esp
+  801a13:	50                   	push   %eax
+  801a14:	68 06 51 80 00       	push   $0x805106
+  801a19:	e8 dc ea ff ff       	call   8004fa <cprintf>
+		return r;
+  801a1e:	83 c4 10             	add    $0x10,%esp
+  801a21:	e9 12 ff ff ff       	jmp    801938 <sfork+0x163>
+  801a26:	89 c7                	mov    %eax,%edi
+  801a28:	e9 0b ff ff ff       	jmp    801938 <sfork+0x163>
+  801a2d:	89 c7                	mov    %eax,%edi
+  801a2f:	e9 04 ff ff ff       	jmp    801938 <sfork+0x163>
+
+00801a34 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801a34:	55                   	push   %ebp
+  801a35:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801a37:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a3a:	05 00 00 00 30       	add    $0x30000000,%eax
+  801a3f:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801a42:	5d                   	pop    %ebp
+  801a43:	c3                   	ret
+
+00801a44 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801a44:	55                   	push   %ebp
+  801a45:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801a47:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a4a:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801a4f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801a54:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801a59:	5d                   	pop    %ebp
+  801a5a:	c3                   	ret
+
+00801a5b <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801a5b:	55                   	push   %ebp
+  801a5c:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801a5e:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801a63:	eb 02                	jmp    801a67 <fd_alloc+0xc>
+  801a65:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801a67:	89 c2                	mov    %eax,%edx
+  801a69:	c1 ea 16             	shr    $0x16,%edx
+  801a6c:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801a73:	f6 c2 01             	test   $0x1,%dl
+  801a76:	74 2b                	je     801aa3 <fd_alloc+0x48>
+  801a78:	89 c2                	mov    %eax,%edx
+  801a7a:	c1 ea 0c             	shr    $0xc,%edx
+  801a7d:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801a84:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801a8a:	f6 c1 01             	test   $0x1,%cl
+  801a8d:	74 14                	je     801aa3 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801a8f:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801a95:	75 ce                	jne    801a65 <fd_alloc+0xa>
+  801a97:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801a9c:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801aa1:	eb 05                	jmp    801aa8 <fd_alloc+0x4d>
+			return 0;
+  801aa3:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801aa8:	8b 55 08             	mov    0x8(%ebp),%edx
+  801aab:	89 02                	mov    %eax,(%edx)
+}
+  801aad:	89 c8                	mov    %ecx,%eax
+  801aaf:	5d                   	pop    %ebp
+  801ab0:	c3                   	ret
+
+00801ab1 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801ab1:	55                   	push   %ebp
+  801ab2:	89 e5                	mov    %esp,%ebp
+  801ab4:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801ab7:	83 f8 1f             	cmp    $0x1f,%eax
+  801aba:	77 30                	ja     801aec <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801abc:	c1 e0 0c             	shl    $0xc,%eax
+  801abf:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801ac4:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801aca:	f6 c2 01             	test   $0x1,%dl
+  801acd:	74 24                	je     801af3 <fd_lookup+0x42>
+  801acf:	89 c2                	mov    %eax,%edx
+  801ad1:	c1 ea 0c             	shr    $0xc,%edx
+  801ad4:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801adb:	f6 c2 01             	test   $0x1,%dl
+  801ade:	74 1a                	je     801afa <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801ae0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ae3:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801ae5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801aea:	5d                   	pop    %ebp
+  801aeb:	c3                   	ret
+		return -E_INVAL;
+  801aec:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801af1:	eb f7                	jmp    801aea <fd_lookup+0x39>
+		return -E_INVAL;
+  801af3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801af8:	eb f0                	jmp    801aea <fd_lookup+0x39>
+  801afa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801aff:	eb e9                	jmp    801aea <fd_lookup+0x39>
+
+00801b01 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801b01:	55                   	push   %ebp
+  801b02:	89 e5                	mov    %esp,%ebp
+  801b04:	53                   	push   %ebx
+  801b05:	83 ec 04             	sub    $0x4,%esp
+  801b08:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801b0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b10:	eb 03                	jmp    801b15 <dev_lookup+0x14>
+  801b12:	83 c0 01             	add    $0x1,%eax
+  801b15:	8b 1c 85 a0 51 80 00 	mov    0x8051a0(,%eax,4),%ebx
+  801b1c:	85 db                	test   %ebx,%ebx
+  801b1e:	74 0b                	je     801b2b <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801b20:	39 13                	cmp    %edx,(%ebx)
+  801b22:	75 ee                	jne    801b12 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801b24:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b29:	eb 49                	jmp    801b74 <dev_lookup+0x73>
+  801b2b:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801b2d:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  801b33:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801b38:	77 18                	ja     801b52 <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801b3a:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801b3f:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  801b41:	c1 e8 10             	shr    $0x10,%eax
+  801b44:	74 0c                	je     801b52 <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801b46:	c1 e0 10             	shl    $0x10,%eax
+  801b49:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  801b4e:	29 c1                	sub    %eax,%ecx
+  801b50:	eb 06                	jmp    801b58 <dev_lookup+0x57>
+		return pthread_main_tls;
+  801b52:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801b58:	8b 01                	mov    (%ecx),%eax
+  801b5a:	8b 40 48             	mov    0x48(%eax),%eax
+  801b5d:	83 ec 04             	sub    $0x4,%esp
+  801b60:	52                   	push   %edx
+  801b61:	50                   	push   %eax
+  801b62:	68 24 51 80 00       	push   $0x805124
+  801b67:	e8 8e e9 ff ff       	call   8004fa <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801b6c:	83 c4 10             	add    $0x10,%esp
+  801b6f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801b74:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b77:	89 1a                	mov    %ebx,(%edx)
+}
+  801b79:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b7c:	c9                   	leave
+  801b7d:	c3                   	ret
+
+00801b7e <fd_close>:
+{
+  801b7e:	55                   	push   %ebp
+  801b7f:	89 e5                	mov    %esp,%ebp
+  801b81:	57                   	push   %edi
+  801b82:	56                   	push   %esi
+  801b83:	53                   	push   %ebx
+  801b84:	83 ec 24             	sub    $0x24,%esp
+  801b87:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b8a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801b8d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801b90:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801b91:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801b97:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801b9a:	50                   	push   %eax
+  801b9b:	e8 11 ff ff ff       	call   801ab1 <fd_lookup>
+  801ba0:	89 c3                	mov    %eax,%ebx
+  801ba2:	83 c4 10             	add    $0x10,%esp
+  801ba5:	85 c0                	test   %eax,%eax
+  801ba7:	78 05                	js     801bae <fd_close+0x30>
+	    || fd != fd2)
+  801ba9:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801bac:	74 16                	je     801bc4 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801bae:	89 f8                	mov    %edi,%eax
+  801bb0:	84 c0                	test   %al,%al
+  801bb2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bb7:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801bba:	89 d8                	mov    %ebx,%eax
+  801bbc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bbf:	5b                   	pop    %ebx
+  801bc0:	5e                   	pop    %esi
+  801bc1:	5f                   	pop    %edi
+  801bc2:	5d                   	pop    %ebp
+  801bc3:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801bc4:	83 ec 08             	sub    $0x8,%esp
+  801bc7:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801bca:	50                   	push   %eax
+  801bcb:	ff 36                	push   (%esi)
+  801bcd:	e8 2f ff ff ff       	call   801b01 <dev_lookup>
+  801bd2:	89 c3                	mov    %eax,%ebx
+  801bd4:	83 c4 10             	add    $0x10,%esp
+  801bd7:	85 c0                	test   %eax,%eax
+  801bd9:	78 1a                	js     801bf5 <fd_close+0x77>
+		if (dev->dev_close)
+  801bdb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801bde:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801be1:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801be6:	85 c0                	test   %eax,%eax
+  801be8:	74 0b                	je     801bf5 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801bea:	83 ec 0c             	sub    $0xc,%esp
+  801bed:	56                   	push   %esi
+  801bee:	ff d0                	call   *%eax
+  801bf0:	89 c3                	mov    %eax,%ebx
+  801bf2:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801bf5:	83 ec 08             	sub    $0x8,%esp
+  801bf8:	56                   	push   %esi
+  801bf9:	6a 00                	push   $0x0
+  801bfb:	e8 b5 f3 ff ff       	call   800fb5 <sys_page_unmap>
+	return r;
+  801c00:	83 c4 10             	add    $0x10,%esp
+  801c03:	eb b5                	jmp    801bba <fd_close+0x3c>
+
+00801c05 <close>:
+
+int
+close(int fdnum)
+{
+  801c05:	55                   	push   %ebp
+  801c06:	89 e5                	mov    %esp,%ebp
+  801c08:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801c0b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c0e:	50                   	push   %eax
+  801c0f:	ff 75 08             	push   0x8(%ebp)
+  801c12:	e8 9a fe ff ff       	call   801ab1 <fd_lookup>
+  801c17:	83 c4 10             	add    $0x10,%esp
+  801c1a:	85 c0                	test   %eax,%eax
+  801c1c:	79 02                	jns    801c20 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801c1e:	c9                   	leave
+  801c1f:	c3                   	ret
+		return fd_close(fd, 1);
+  801c20:	83 ec 08             	sub    $0x8,%esp
+  801c23:	6a 01                	push   $0x1
+  801c25:	ff 75 f4             	push   -0xc(%ebp)
+  801c28:	e8 51 ff ff ff       	call   801b7e <fd_close>
+  801c2d:	83 c4 10             	add    $0x10,%esp
+  801c30:	eb ec                	jmp    801c1e <close+0x19>
+
+00801c32 <close_all>:
+
+void
+close_all(void)
+{
+  801c32:	55                   	push   %ebp
+  801c33:	89 e5                	mov    %esp,%ebp
+  801c35:	53                   	push   %ebx
+  801c36:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801c39:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801c3e:	83 ec 0c             	sub    $0xc,%esp
+  801c41:	53                   	push   %ebx
+  801c42:	e8 be ff ff ff       	call   801c05 <close>
+	for (i = 0; i < MAXFD; i++)
+  801c47:	83 c3 01             	add    $0x1,%ebx
+  801c4a:	83 c4 10             	add    $0x10,%esp
+  801c4d:	83 fb 20             	cmp    $0x20,%ebx
+  801c50:	75 ec                	jne    801c3e <close_all+0xc>
+}
+  801c52:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c55:	c9                   	leave
+  801c56:	c3                   	ret
+
+00801c57 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801c57:	55                   	push   %ebp
+  801c58:	89 e5                	mov    %esp,%ebp
+  801c5a:	57                   	push   %edi
+  801c5b:	56                   	push   %esi
+  801c5c:	53                   	push   %ebx
+  801c5d:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801c60:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801c63:	50                   	push   %eax
+  801c64:	ff 75 08             	push   0x8(%ebp)
+  801c67:	e8 45 fe ff ff       	call   801ab1 <fd_lookup>
+  801c6c:	89 c3                	mov    %eax,%ebx
+  801c6e:	83 c4 10             	add    $0x10,%esp
+  801c71:	85 c0                	test   %eax,%eax
+  801c73:	78 7f                	js     801cf4 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801c75:	83 ec 0c             	sub    $0xc,%esp
+  801c78:	ff 75 0c             	push   0xc(%ebp)
+  801c7b:	e8 85 ff ff ff       	call   801c05 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801c80:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801c83:	c1 e6 0c             	shl    $0xc,%esi
+  801c86:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801c8c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801c8f:	89 3c 24             	mov    %edi,(%esp)
+  801c92:	e8 ad fd ff ff       	call   801a44 <fd2data>
+  801c97:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801c99:	89 34 24             	mov    %esi,(%esp)
+  801c9c:	e8 a3 fd ff ff       	call   801a44 <fd2data>
+  801ca1:	83 c4 10             	add    $0x10,%esp
+  801ca4:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801ca7:	89 d8                	mov    %ebx,%eax
+  801ca9:	c1 e8 16             	shr    $0x16,%eax
+  801cac:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801cb3:	a8 01                	test   $0x1,%al
+  801cb5:	74 11                	je     801cc8 <dup+0x71>
+  801cb7:	89 d8                	mov    %ebx,%eax
+  801cb9:	c1 e8 0c             	shr    $0xc,%eax
+  801cbc:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801cc3:	f6 c2 01             	test   $0x1,%dl
+  801cc6:	75 36                	jne    801cfe <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801cc8:	89 f8                	mov    %edi,%eax
+  801cca:	c1 e8 0c             	shr    $0xc,%eax
+  801ccd:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801cd4:	83 ec 0c             	sub    $0xc,%esp
+  801cd7:	25 07 0e 00 00       	and    $0xe07,%eax
+  801cdc:	50                   	push   %eax
+  801cdd:	56                   	push   %esi
+  801cde:	6a 00                	push   $0x0
+  801ce0:	57                   	push   %edi
+  801ce1:	6a 00                	push   $0x0
+  801ce3:	e8 81 f2 ff ff       	call   800f69 <sys_page_map>
+  801ce8:	89 c3                	mov    %eax,%ebx
+  801cea:	83 c4 20             	add    $0x20,%esp
+  801ced:	85 c0                	test   %eax,%eax
+  801cef:	78 33                	js     801d24 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801cf1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801cf4:	89 d8                	mov    %ebx,%eax
+  801cf6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cf9:	5b                   	pop    %ebx
+  801cfa:	5e                   	pop    %esi
+  801cfb:	5f                   	pop    %edi
+  801cfc:	5d                   	pop    %ebp
+  801cfd:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801cfe:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801d05:	83 ec 0c             	sub    $0xc,%esp
+  801d08:	25 07 0e 00 00       	and    $0xe07,%eax
+  801d0d:	50                   	push   %eax
+  801d0e:	ff 75 d4             	push   -0x2c(%ebp)
+  801d11:	6a 00                	push   $0x0
+  801d13:	53                   	push   %ebx
+  801d14:	6a 00                	push   $0x0
+  801d16:	e8 4e f2 ff ff       	call   800f69 <sys_page_map>
+  801d1b:	89 c3                	mov    %eax,%ebx
+  801d1d:	83 c4 20             	add    $0x20,%esp
+  801d20:	85 c0                	test   %eax,%eax
+  801d22:	79 a4                	jns    801cc8 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801d24:	83 ec 08             	sub    $0x8,%esp
+  801d27:	56                   	push   %esi
+  801d28:	6a 00                	push   $0x0
+  801d2a:	e8 86 f2 ff ff       	call   800fb5 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801d2f:	83 c4 08             	add    $0x8,%esp
+  801d32:	ff 75 d4             	push   -0x2c(%ebp)
+  801d35:	6a 00                	push   $0x0
+  801d37:	e8 79 f2 ff ff       	call   800fb5 <sys_page_unmap>
+	return r;
+  801d3c:	83 c4 10             	add    $0x10,%esp
+  801d3f:	eb b3                	jmp    801cf4 <dup+0x9d>
+
+00801d41 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801d41:	55                   	push   %ebp
+  801d42:	89 e5                	mov    %esp,%ebp
+  801d44:	56                   	push   %esi
+  801d45:	53                   	push   %ebx
+  801d46:	83 ec 18             	sub    $0x18,%esp
+  801d49:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d4c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d4f:	50                   	push   %eax
+  801d50:	53                   	push   %ebx
+  801d51:	e8 5b fd ff ff       	call   801ab1 <fd_lookup>
+  801d56:	83 c4 10             	add    $0x10,%esp
+  801d59:	85 c0                	test   %eax,%eax
+  801d5b:	78 3c                	js     801d99 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d5d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d60:	83 ec 08             	sub    $0x8,%esp
+  801d63:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d66:	50                   	push   %eax
+  801d67:	ff 36                	push   (%esi)
+  801d69:	e8 93 fd ff ff       	call   801b01 <dev_lookup>
+  801d6e:	83 c4 10             	add    $0x10,%esp
+  801d71:	85 c0                	test   %eax,%eax
+  801d73:	78 24                	js     801d99 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801d75:	8b 46 08             	mov    0x8(%esi),%eax
+  801d78:	83 e0 03             	and    $0x3,%eax
+  801d7b:	83 f8 01             	cmp    $0x1,%eax
+  801d7e:	74 20                	je     801da0 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801d80:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d83:	8b 40 08             	mov    0x8(%eax),%eax
+  801d86:	85 c0                	test   %eax,%eax
+  801d88:	74 61                	je     801deb <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801d8a:	83 ec 04             	sub    $0x4,%esp
+  801d8d:	ff 75 10             	push   0x10(%ebp)
+  801d90:	ff 75 0c             	push   0xc(%ebp)
+  801d93:	56                   	push   %esi
+  801d94:	ff d0                	call   *%eax
+  801d96:	83 c4 10             	add    $0x10,%esp
+}
+  801d99:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d9c:	5b                   	pop    %ebx
+  801d9d:	5e                   	pop    %esi
+  801d9e:	5d                   	pop    %ebp
+  801d9f:	c3                   	ret
+  801da0:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801da2:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801da8:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801dad:	77 18                	ja     801dc7 <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801daf:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801db4:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801db6:	c1 e8 10             	shr    $0x10,%eax
+  801db9:	74 0c                	je     801dc7 <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801dbb:	c1 e0 10             	shl    $0x10,%eax
+  801dbe:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801dc3:	29 c2                	sub    %eax,%edx
+  801dc5:	eb 06                	jmp    801dcd <read+0x8c>
+		return pthread_main_tls;
+  801dc7:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801dcd:	8b 02                	mov    (%edx),%eax
+  801dcf:	8b 40 48             	mov    0x48(%eax),%eax
+  801dd2:	83 ec 04             	sub    $0x4,%esp
+  801dd5:	53                   	push   %ebx
+  801dd6:	50                   	push   %eax
+  801dd7:	68 65 51 80 00       	push   $0x805165
+  801ddc:	e8 19 e7 ff ff       	call   8004fa <cprintf>
+		return -E_INVAL;
+  801de1:	83 c4 10             	add    $0x10,%esp
+  801de4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801de9:	eb ae                	jmp    801d99 <read+0x58>
+		return -E_NOT_SUPP;
+  801deb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801df0:	eb a7                	jmp    801d99 <read+0x58>
+
+00801df2 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801df2:	55                   	push   %ebp
+  801df3:	89 e5                	mov    %esp,%ebp
+  801df5:	57                   	push   %edi
+  801df6:	56                   	push   %esi
+  801df7:	53                   	push   %ebx
+  801df8:	83 ec 0c             	sub    $0xc,%esp
+  801dfb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801dfe:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801e01:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e06:	eb 02                	jmp    801e0a <readn+0x18>
+  801e08:	01 c3                	add    %eax,%ebx
+  801e0a:	39 f3                	cmp    %esi,%ebx
+  801e0c:	73 21                	jae    801e2f <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801e0e:	83 ec 04             	sub    $0x4,%esp
+  801e11:	89 f0                	mov    %esi,%eax
+  801e13:	29 d8                	sub    %ebx,%eax
+  801e15:	50                   	push   %eax
+  801e16:	89 d8                	mov    %ebx,%eax
+  801e18:	03 45 0c             	add    0xc(%ebp),%eax
+  801e1b:	50                   	push   %eax
+  801e1c:	57                   	push   %edi
+  801e1d:	e8 1f ff ff ff       	call   801d41 <read>
+		if (m < 0)
+  801e22:	83 c4 10             	add    $0x10,%esp
+  801e25:	85 c0                	test   %eax,%eax
+  801e27:	78 04                	js     801e2d <readn+0x3b>
+			return m;
+		if (m == 0)
+  801e29:	75 dd                	jne    801e08 <readn+0x16>
+  801e2b:	eb 02                	jmp    801e2f <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801e2d:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801e2f:	89 d8                	mov    %ebx,%eax
+  801e31:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e34:	5b                   	pop    %ebx
+  801e35:	5e                   	pop    %esi
+  801e36:	5f                   	pop    %edi
+  801e37:	5d                   	pop    %ebp
+  801e38:	c3                   	ret
+
+00801e39 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801e39:	55                   	push   %ebp
+  801e3a:	89 e5                	mov    %esp,%ebp
+  801e3c:	56                   	push   %esi
+  801e3d:	53                   	push   %ebx
+  801e3e:	83 ec 18             	sub    $0x18,%esp
+  801e41:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801e44:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e47:	50                   	push   %eax
+  801e48:	53                   	push   %ebx
+  801e49:	e8 63 fc ff ff       	call   801ab1 <fd_lookup>
+  801e4e:	83 c4 10             	add    $0x10,%esp
+  801e51:	85 c0                	test   %eax,%eax
+  801e53:	78 37                	js     801e8c <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801e55:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e58:	83 ec 08             	sub    $0x8,%esp
+  801e5b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e5e:	50                   	push   %eax
+  801e5f:	ff 36                	push   (%esi)
+  801e61:	e8 9b fc ff ff       	call   801b01 <dev_lookup>
+  801e66:	83 c4 10             	add    $0x10,%esp
+  801e69:	85 c0                	test   %eax,%eax
+  801e6b:	78 1f                	js     801e8c <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e6d:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801e71:	74 20                	je     801e93 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801e73:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e76:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e79:	85 c0                	test   %eax,%eax
+  801e7b:	74 61                	je     801ede <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801e7d:	83 ec 04             	sub    $0x4,%esp
+  801e80:	ff 75 10             	push   0x10(%ebp)
+  801e83:	ff 75 0c             	push   0xc(%ebp)
+  801e86:	56                   	push   %esi
+  801e87:	ff d0                	call   *%eax
+  801e89:	83 c4 10             	add    $0x10,%esp
+}
+  801e8c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e8f:	5b                   	pop    %ebx
+  801e90:	5e                   	pop    %esi
+  801e91:	5d                   	pop    %ebp
+  801e92:	c3                   	ret
+  801e93:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801e95:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801e9b:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801ea0:	77 18                	ja     801eba <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801ea2:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801ea7:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801ea9:	c1 e8 10             	shr    $0x10,%eax
+  801eac:	74 0c                	je     801eba <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801eae:	c1 e0 10             	shl    $0x10,%eax
+  801eb1:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801eb6:	29 c2                	sub    %eax,%edx
+  801eb8:	eb 06                	jmp    801ec0 <write+0x87>
+		return pthread_main_tls;
+  801eba:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801ec0:	8b 02                	mov    (%edx),%eax
+  801ec2:	8b 40 48             	mov    0x48(%eax),%eax
+  801ec5:	83 ec 04             	sub    $0x4,%esp
+  801ec8:	53                   	push   %ebx
+  801ec9:	50                   	push   %eax
+  801eca:	68 81 51 80 00       	push   $0x805181
+  801ecf:	e8 26 e6 ff ff       	call   8004fa <cprintf>
+		return -E_INVAL;
+  801ed4:	83 c4 10             	add    $0x10,%esp
+  801ed7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801edc:	eb ae                	jmp    801e8c <write+0x53>
+		return -E_NOT_SUPP;
+  801ede:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ee3:	eb a7                	jmp    801e8c <write+0x53>
+
+00801ee5 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801ee5:	55                   	push   %ebp
+  801ee6:	89 e5                	mov    %esp,%ebp
+  801ee8:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801eeb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801eee:	50                   	push   %eax
+  801eef:	ff 75 08             	push   0x8(%ebp)
+  801ef2:	e8 ba fb ff ff       	call   801ab1 <fd_lookup>
+  801ef7:	83 c4 10             	add    $0x10,%esp
+  801efa:	85 c0                	test   %eax,%eax
+  801efc:	78 0e                	js     801f0c <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801efe:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801f01:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f04:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801f07:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f0c:	c9                   	leave
+  801f0d:	c3                   	ret
+
+00801f0e <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801f0e:	55                   	push   %ebp
+  801f0f:	89 e5                	mov    %esp,%ebp
+  801f11:	56                   	push   %esi
+  801f12:	53                   	push   %ebx
+  801f13:	83 ec 18             	sub    $0x18,%esp
+  801f16:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801f19:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f1c:	50                   	push   %eax
+  801f1d:	53                   	push   %ebx
+  801f1e:	e8 8e fb ff ff       	call   801ab1 <fd_lookup>
+  801f23:	83 c4 10             	add    $0x10,%esp
+  801f26:	85 c0                	test   %eax,%eax
+  801f28:	78 34                	js     801f5e <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801f2a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801f2d:	83 ec 08             	sub    $0x8,%esp
+  801f30:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f33:	50                   	push   %eax
+  801f34:	ff 36                	push   (%esi)
+  801f36:	e8 c6 fb ff ff       	call   801b01 <dev_lookup>
+  801f3b:	83 c4 10             	add    $0x10,%esp
+  801f3e:	85 c0                	test   %eax,%eax
+  801f40:	78 1c                	js     801f5e <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f42:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801f46:	74 1d                	je     801f65 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801f48:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f4b:	8b 40 18             	mov    0x18(%eax),%eax
+  801f4e:	85 c0                	test   %eax,%eax
+  801f50:	74 5e                	je     801fb0 <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801f52:	83 ec 08             	sub    $0x8,%esp
+  801f55:	ff 75 0c             	push   0xc(%ebp)
+  801f58:	56                   	push   %esi
+  801f59:	ff d0                	call   *%eax
+  801f5b:	83 c4 10             	add    $0x10,%esp
+}
+  801f5e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f61:	5b                   	pop    %ebx
+  801f62:	5e                   	pop    %esi
+  801f63:	5d                   	pop    %ebp
+  801f64:	c3                   	ret
+  801f65:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801f67:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801f6d:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801f72:	77 18                	ja     801f8c <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801f74:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801f79:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801f7b:	c1 e8 10             	shr    $0x10,%eax
+  801f7e:	74 0c                	je     801f8c <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801f80:	c1 e0 10             	shl    $0x10,%eax
+  801f83:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801f88:	29 c2                	sub    %eax,%edx
+  801f8a:	eb 06                	jmp    801f92 <ftruncate+0x84>
+		return pthread_main_tls;
+  801f8c:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+			thisenv->env_id, fdnum);
+  801f92:	8b 02                	mov    (%edx),%eax
+  801f94:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801f97:	83 ec 04             	sub    $0x4,%esp
+  801f9a:	53                   	push   %ebx
+  801f9b:	50                   	push   %eax
+  801f9c:	68 44 51 80 00       	push   $0x805144
+  801fa1:	e8 54 e5 ff ff       	call   8004fa <cprintf>
+		return -E_INVAL;
+  801fa6:	83 c4 10             	add    $0x10,%esp
+  801fa9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fae:	eb ae                	jmp    801f5e <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801fb0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801fb5:	eb a7                	jmp    801f5e <ftruncate+0x50>
+
+00801fb7 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801fb7:	55                   	push   %ebp
+  801fb8:	89 e5                	mov    %esp,%ebp
+  801fba:	56                   	push   %esi
+  801fbb:	53                   	push   %ebx
+  801fbc:	83 ec 18             	sub    $0x18,%esp
+  801fbf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801fc2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801fc5:	50                   	push   %eax
+  801fc6:	ff 75 08             	push   0x8(%ebp)
+  801fc9:	e8 e3 fa ff ff       	call   801ab1 <fd_lookup>
+  801fce:	83 c4 10             	add    $0x10,%esp
+  801fd1:	85 c0                	test   %eax,%eax
+  801fd3:	78 49                	js     80201e <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801fd5:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801fd8:	83 ec 08             	sub    $0x8,%esp
+  801fdb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fde:	50                   	push   %eax
+  801fdf:	ff 36                	push   (%esi)
+  801fe1:	e8 1b fb ff ff       	call   801b01 <dev_lookup>
+  801fe6:	83 c4 10             	add    $0x10,%esp
+  801fe9:	85 c0                	test   %eax,%eax
+  801feb:	78 31                	js     80201e <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801fed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ff0:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801ff4:	74 2f                	je     802025 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801ff6:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801ff9:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  802000:	00 00 00 
+	stat->st_isdir = 0;
+  802003:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80200a:	00 00 00 
+	stat->st_dev = dev;
+  80200d:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  802013:	83 ec 08             	sub    $0x8,%esp
+  802016:	53                   	push   %ebx
+  802017:	56                   	push   %esi
+  802018:	ff 50 14             	call   *0x14(%eax)
+  80201b:	83 c4 10             	add    $0x10,%esp
+}
+  80201e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802021:	5b                   	pop    %ebx
+  802022:	5e                   	pop    %esi
+  802023:	5d                   	pop    %ebp
+  802024:	c3                   	ret
+		return -E_NOT_SUPP;
+  802025:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80202a:	eb f2                	jmp    80201e <fstat+0x67>
+
+0080202c <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80202c:	55                   	push   %ebp
+  80202d:	89 e5                	mov    %esp,%ebp
+  80202f:	56                   	push   %esi
+  802030:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  802031:	83 ec 08             	sub    $0x8,%esp
+  802034:	6a 00                	push   $0x0
+  802036:	ff 75 08             	push   0x8(%ebp)
+  802039:	e8 4b 03 00 00       	call   802389 <open>
+  80203e:	89 c3                	mov    %eax,%ebx
+  802040:	83 c4 10             	add    $0x10,%esp
+  802043:	85 c0                	test   %eax,%eax
+  802045:	78 1b                	js     802062 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  802047:	83 ec 08             	sub    $0x8,%esp
+  80204a:	ff 75 0c             	push   0xc(%ebp)
+  80204d:	50                   	push   %eax
+  80204e:	e8 64 ff ff ff       	call   801fb7 <fstat>
+  802053:	89 c6                	mov    %eax,%esi
+	close(fd);
+  802055:	89 1c 24             	mov    %ebx,(%esp)
+  802058:	e8 a8 fb ff ff       	call   801c05 <close>
+	return r;
+  80205d:	83 c4 10             	add    $0x10,%esp
+  802060:	89 f3                	mov    %esi,%ebx
+}
+  802062:	89 d8                	mov    %ebx,%eax
+  802064:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802067:	5b                   	pop    %ebx
+  802068:	5e                   	pop    %esi
+  802069:	5d                   	pop    %ebp
+  80206a:	c3                   	ret
+
+0080206b <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  80206b:	55                   	push   %ebp
+  80206c:	89 e5                	mov    %esp,%ebp
+  80206e:	56                   	push   %esi
+  80206f:	53                   	push   %ebx
+  802070:	89 c6                	mov    %eax,%esi
+  802072:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  802074:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  80207b:	74 27                	je     8020a4 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80207d:	6a 07                	push   $0x7
+  80207f:	68 00 80 80 00       	push   $0x808000
+  802084:	56                   	push   %esi
+  802085:	ff 35 00 70 80 00    	push   0x807000
+  80208b:	e8 8d 26 00 00       	call   80471d <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  802090:	83 c4 0c             	add    $0xc,%esp
+  802093:	6a 00                	push   $0x0
+  802095:	53                   	push   %ebx
+  802096:	6a 00                	push   $0x0
+  802098:	e8 8a 25 00 00       	call   804627 <ipc_recv>
+}
+  80209d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020a0:	5b                   	pop    %ebx
+  8020a1:	5e                   	pop    %esi
+  8020a2:	5d                   	pop    %ebp
+  8020a3:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8020a4:	83 ec 0c             	sub    $0xc,%esp
+  8020a7:	6a 01                	push   $0x1
+  8020a9:	e8 c5 26 00 00       	call   804773 <ipc_find_env>
+  8020ae:	a3 00 70 80 00       	mov    %eax,0x807000
+  8020b3:	83 c4 10             	add    $0x10,%esp
+  8020b6:	eb c5                	jmp    80207d <fsipc+0x12>
+
+008020b8 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8020b8:	55                   	push   %ebp
+  8020b9:	89 e5                	mov    %esp,%ebp
+  8020bb:	53                   	push   %ebx
+  8020bc:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  8020bf:	68 04 70 80 00       	push   $0x807004
+  8020c4:	e8 7a 1b 00 00       	call   803c43 <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8020c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020cc:	8b 40 0c             	mov    0xc(%eax),%eax
+  8020cf:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.set_size.req_size = newsize;
+  8020d4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020d7:	a3 04 80 80 00       	mov    %eax,0x808004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  8020dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020e1:	b8 02 00 00 00       	mov    $0x2,%eax
+  8020e6:	e8 80 ff ff ff       	call   80206b <fsipc>
+  8020eb:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8020ed:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  8020f4:	e8 b7 1b 00 00       	call   803cb0 <mutex_unlock>
+	return r;
+}
+  8020f9:	89 d8                	mov    %ebx,%eax
+  8020fb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020fe:	c9                   	leave
+  8020ff:	c3                   	ret
+
+00802100 <devfile_flush>:
+{
+  802100:	55                   	push   %ebp
+  802101:	89 e5                	mov    %esp,%ebp
+  802103:	53                   	push   %ebx
+  802104:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  802107:	68 04 70 80 00       	push   $0x807004
+  80210c:	e8 32 1b 00 00       	call   803c43 <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802111:	8b 45 08             	mov    0x8(%ebp),%eax
+  802114:	8b 40 0c             	mov    0xc(%eax),%eax
+  802117:	a3 00 80 80 00       	mov    %eax,0x808000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  80211c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802121:	b8 06 00 00 00       	mov    $0x6,%eax
+  802126:	e8 40 ff ff ff       	call   80206b <fsipc>
+  80212b:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80212d:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  802134:	e8 77 1b 00 00       	call   803cb0 <mutex_unlock>
+}
+  802139:	89 d8                	mov    %ebx,%eax
+  80213b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80213e:	c9                   	leave
+  80213f:	c3                   	ret
+
+00802140 <devfile_stat>:
+{
+  802140:	55                   	push   %ebp
+  802141:	89 e5                	mov    %esp,%ebp
+  802143:	56                   	push   %esi
+  802144:	53                   	push   %ebx
+  802145:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  802148:	83 ec 0c             	sub    $0xc,%esp
+  80214b:	68 04 70 80 00       	push   $0x807004
+  802150:	e8 ee 1a 00 00       	call   803c43 <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802155:	8b 45 08             	mov    0x8(%ebp),%eax
+  802158:	8b 40 0c             	mov    0xc(%eax),%eax
+  80215b:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  802160:	ba 00 00 00 00       	mov    $0x0,%edx
+  802165:	b8 05 00 00 00       	mov    $0x5,%eax
+  80216a:	e8 fc fe ff ff       	call   80206b <fsipc>
+  80216f:	89 c3                	mov    %eax,%ebx
+  802171:	83 c4 10             	add    $0x10,%esp
+  802174:	85 c0                	test   %eax,%eax
+  802176:	79 16                	jns    80218e <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  802178:	83 ec 0c             	sub    $0xc,%esp
+  80217b:	68 04 70 80 00       	push   $0x807004
+  802180:	e8 2b 1b 00 00       	call   803cb0 <mutex_unlock>
+}
+  802185:	89 d8                	mov    %ebx,%eax
+  802187:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80218a:	5b                   	pop    %ebx
+  80218b:	5e                   	pop    %esi
+  80218c:	5d                   	pop    %ebp
+  80218d:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80218e:	83 ec 08             	sub    $0x8,%esp
+  802191:	68 00 80 80 00       	push   $0x808000
+  802196:	56                   	push   %esi
+  802197:	e8 42 e9 ff ff       	call   800ade <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  80219c:	a1 80 80 80 00       	mov    0x808080,%eax
+  8021a1:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8021a7:	a1 84 80 80 00       	mov    0x808084,%eax
+  8021ac:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  8021b2:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  8021b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8021ba:	eb bc                	jmp    802178 <devfile_stat+0x38>
+
+008021bc <devfile_write>:
+{
+  8021bc:	55                   	push   %ebp
+  8021bd:	89 e5                	mov    %esp,%ebp
+  8021bf:	53                   	push   %ebx
+  8021c0:	83 ec 10             	sub    $0x10,%esp
+  8021c3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  8021c6:	68 04 70 80 00       	push   $0x807004
+  8021cb:	e8 73 1a 00 00       	call   803c43 <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8021d0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021d3:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021d6:	a3 00 80 80 00       	mov    %eax,0x808000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  8021db:	83 c4 10             	add    $0x10,%esp
+  8021de:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  8021e4:	76 3d                	jbe    802223 <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  8021e6:	b8 00 00 10 00       	mov    $0x100000,%eax
+  8021eb:	39 c3                	cmp    %eax,%ebx
+  8021ed:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  8021f0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021f3:	a3 08 80 80 00       	mov    %eax,0x808008
+	fsipcbuf.write.req_n = n;
+  8021f8:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	r = fsipc(FSREQ_WRITE, NULL);
+  8021fe:	ba 00 00 00 00       	mov    $0x0,%edx
+  802203:	b8 04 00 00 00       	mov    $0x4,%eax
+  802208:	e8 5e fe ff ff       	call   80206b <fsipc>
+  80220d:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80220f:	83 ec 0c             	sub    $0xc,%esp
+  802212:	68 04 70 80 00       	push   $0x807004
+  802217:	e8 94 1a 00 00       	call   803cb0 <mutex_unlock>
+}
+  80221c:	89 d8                	mov    %ebx,%eax
+  80221e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802221:	c9                   	leave
+  802222:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  802223:	83 ec 04             	sub    $0x4,%esp
+  802226:	53                   	push   %ebx
+  802227:	ff 75 0c             	push   0xc(%ebp)
+  80222a:	68 0c 80 80 00       	push   $0x80800c
+  80222f:	e8 30 ea ff ff       	call   800c64 <memmove>
+  802234:	83 c4 10             	add    $0x10,%esp
+  802237:	b8 00 00 00 00       	mov    $0x0,%eax
+  80223c:	eb b5                	jmp    8021f3 <devfile_write+0x37>
+
+0080223e <devfile_read>:
+{
+  80223e:	55                   	push   %ebp
+  80223f:	89 e5                	mov    %esp,%ebp
+  802241:	57                   	push   %edi
+  802242:	56                   	push   %esi
+  802243:	53                   	push   %ebx
+  802244:	83 ec 0c             	sub    $0xc,%esp
+  802247:	8b 75 08             	mov    0x8(%ebp),%esi
+  80224a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80224d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  802250:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  802256:	0f 86 8c 00 00 00    	jbe    8022e8 <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  80225c:	b8 00 00 10 00       	mov    $0x100000,%eax
+  802261:	39 c3                	cmp    %eax,%ebx
+  802263:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  802266:	89 f8                	mov    %edi,%eax
+  802268:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  80226b:	eb 0f                	jmp    80227c <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  80226d:	0f b6 08             	movzbl (%eax),%ecx
+  802270:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  802272:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802277:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  80227c:	39 d0                	cmp    %edx,%eax
+  80227e:	72 ed                	jb     80226d <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  802280:	83 ec 0c             	sub    $0xc,%esp
+  802283:	68 04 70 80 00       	push   $0x807004
+  802288:	e8 b6 19 00 00       	call   803c43 <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80228d:	8b 46 0c             	mov    0xc(%esi),%eax
+  802290:	a3 00 80 80 00       	mov    %eax,0x808000
+		fsipcbuf.read.req_n = n;
+  802295:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  80229b:	89 3d 08 80 80 00    	mov    %edi,0x808008
+		r = fsipc(FSREQ_READ, NULL);
+  8022a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022a6:	b8 03 00 00 00       	mov    $0x3,%eax
+  8022ab:	e8 bb fd ff ff       	call   80206b <fsipc>
+  8022b0:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  8022b2:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  8022b9:	e8 f2 19 00 00       	call   803cb0 <mutex_unlock>
+		assert(r <= (int) n);
+  8022be:	83 c4 10             	add    $0x10,%esp
+  8022c1:	39 f3                	cmp    %esi,%ebx
+  8022c3:	7c 0a                	jl     8022cf <devfile_read+0x91>
+}
+  8022c5:	89 f0                	mov    %esi,%eax
+  8022c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022ca:	5b                   	pop    %ebx
+  8022cb:	5e                   	pop    %esi
+  8022cc:	5f                   	pop    %edi
+  8022cd:	5d                   	pop    %ebp
+  8022ce:	c3                   	ret
+		assert(r <= (int) n);
+  8022cf:	68 b4 51 80 00       	push   $0x8051b4
+  8022d4:	68 f1 50 80 00       	push   $0x8050f1
+  8022d9:	68 90 00 00 00       	push   $0x90
+  8022de:	68 c1 51 80 00       	push   $0x8051c1
+  8022e3:	e8 37 e1 ff ff       	call   80041f <_panic>
+	mutex_lock(&fsipc_mu);
+  8022e8:	83 ec 0c             	sub    $0xc,%esp
+  8022eb:	68 04 70 80 00       	push   $0x807004
+  8022f0:	e8 4e 19 00 00       	call   803c43 <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8022f5:	8b 46 0c             	mov    0xc(%esi),%eax
+  8022f8:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.read.req_n = n;
+  8022fd:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	fsipcbuf.read.req_va = 0;
+  802303:	c7 05 08 80 80 00 00 	movl   $0x0,0x808008
+  80230a:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  80230d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802312:	b8 03 00 00 00       	mov    $0x3,%eax
+  802317:	e8 4f fd ff ff       	call   80206b <fsipc>
+  80231c:	89 c6                	mov    %eax,%esi
+  80231e:	83 c4 10             	add    $0x10,%esp
+  802321:	85 c0                	test   %eax,%eax
+  802323:	78 1d                	js     802342 <devfile_read+0x104>
+		assert(r <= n);
+  802325:	39 c3                	cmp    %eax,%ebx
+  802327:	72 2e                	jb     802357 <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  802329:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80232e:	7f 40                	jg     802370 <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  802330:	83 ec 04             	sub    $0x4,%esp
+  802333:	50                   	push   %eax
+  802334:	68 00 80 80 00       	push   $0x808000
+  802339:	57                   	push   %edi
+  80233a:	e8 25 e9 ff ff       	call   800c64 <memmove>
+  80233f:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  802342:	83 ec 0c             	sub    $0xc,%esp
+  802345:	68 04 70 80 00       	push   $0x807004
+  80234a:	e8 61 19 00 00       	call   803cb0 <mutex_unlock>
+	return r;
+  80234f:	83 c4 10             	add    $0x10,%esp
+  802352:	e9 6e ff ff ff       	jmp    8022c5 <devfile_read+0x87>
+		assert(r <= n);
+  802357:	68 cc 51 80 00       	push   $0x8051cc
+  80235c:	68 f1 50 80 00       	push   $0x8050f1
+  802361:	68 99 00 00 00       	push   $0x99
+  802366:	68 c1 51 80 00       	push   $0x8051c1
+  80236b:	e8 af e0 ff ff       	call   80041f <_panic>
+		assert(r <= PGSIZE);
+  802370:	68 d3 51 80 00       	push   $0x8051d3
+  802375:	68 f1 50 80 00       	push   $0x8050f1
+  80237a:	68 9a 00 00 00       	push   $0x9a
+  80237f:	68 c1 51 80 00       	push   $0x8051c1
+  802384:	e8 96 e0 ff ff       	call   80041f <_panic>
+
+00802389 <open>:
+{
+  802389:	55                   	push   %ebp
+  80238a:	89 e5                	mov    %esp,%ebp
+  80238c:	56                   	push   %esi
+  80238d:	53                   	push   %ebx
+  80238e:	83 ec 1c             	sub    $0x1c,%esp
+  802391:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802394:	56                   	push   %esi
+  802395:	e8 09 e7 ff ff       	call   800aa3 <strlen>
+  80239a:	83 c4 10             	add    $0x10,%esp
+  80239d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8023a2:	0f 8f 85 00 00 00    	jg     80242d <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  8023a8:	83 ec 0c             	sub    $0xc,%esp
+  8023ab:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023ae:	50                   	push   %eax
+  8023af:	e8 a7 f6 ff ff       	call   801a5b <fd_alloc>
+  8023b4:	89 c3                	mov    %eax,%ebx
+  8023b6:	83 c4 10             	add    $0x10,%esp
+  8023b9:	85 c0                	test   %eax,%eax
+  8023bb:	78 55                	js     802412 <open+0x89>
+	mutex_lock(&fsipc_mu);
+  8023bd:	83 ec 0c             	sub    $0xc,%esp
+  8023c0:	68 04 70 80 00       	push   $0x807004
+  8023c5:	e8 79 18 00 00       	call   803c43 <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  8023ca:	83 c4 08             	add    $0x8,%esp
+  8023cd:	56                   	push   %esi
+  8023ce:	68 00 80 80 00       	push   $0x808000
+  8023d3:	e8 06 e7 ff ff       	call   800ade <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8023d8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023db:	a3 00 84 80 00       	mov    %eax,0x808400
+	r = fsipc(FSREQ_OPEN, fd);
+  8023e0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8023e3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8023e8:	e8 7e fc ff ff       	call   80206b <fsipc>
+  8023ed:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8023ef:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  8023f6:	e8 b5 18 00 00       	call   803cb0 <mutex_unlock>
+	if (r < 0) {
+  8023fb:	83 c4 10             	add    $0x10,%esp
+  8023fe:	85 db                	test   %ebx,%ebx
+  802400:	78 19                	js     80241b <open+0x92>
+	return fd2num(fd);
+  802402:	83 ec 0c             	sub    $0xc,%esp
+  802405:	ff 75 f4             	push   -0xc(%ebp)
+  802408:	e8 27 f6 ff ff       	call   801a34 <fd2num>
+  80240d:	89 c3                	mov    %eax,%ebx
+  80240f:	83 c4 10             	add    $0x10,%esp
+}
+  802412:	89 d8                	mov    %ebx,%eax
+  802414:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802417:	5b                   	pop    %ebx
+  802418:	5e                   	pop    %esi
+  802419:	5d                   	pop    %ebp
+  80241a:	c3                   	ret
+		fd_close(fd, 0);
+  80241b:	83 ec 08             	sub    $0x8,%esp
+  80241e:	6a 00                	push   $0x0
+  802420:	ff 75 f4             	push   -0xc(%ebp)
+  802423:	e8 56 f7 ff ff       	call   801b7e <fd_close>
+		return r;
+  802428:	83 c4 10             	add    $0x10,%esp
+  80242b:	eb e5                	jmp    802412 <open+0x89>
+		return -E_BAD_PATH;
+  80242d:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802432:	eb de                	jmp    802412 <open+0x89>
+
+00802434 <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  802434:	55                   	push   %ebp
+  802435:	89 e5                	mov    %esp,%ebp
+  802437:	53                   	push   %ebx
+  802438:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80243b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80243e:	50                   	push   %eax
+  80243f:	ff 75 08             	push   0x8(%ebp)
+  802442:	e8 6a f6 ff ff       	call   801ab1 <fd_lookup>
+  802447:	89 c3                	mov    %eax,%ebx
+  802449:	83 c4 10             	add    $0x10,%esp
+  80244c:	85 c0                	test   %eax,%eax
+  80244e:	78 5b                	js     8024ab <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  802450:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802453:	8b 0d 08 60 80 00    	mov    0x806008,%ecx
+  802459:	39 08                	cmp    %ecx,(%eax)
+  80245b:	75 55                	jne    8024b2 <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  80245d:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802461:	74 56                	je     8024b9 <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  802463:	83 ec 0c             	sub    $0xc,%esp
+  802466:	68 04 70 80 00       	push   $0x807004
+  80246b:	e8 d3 17 00 00       	call   803c43 <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  802470:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802473:	8b 40 0c             	mov    0xc(%eax),%eax
+  802476:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.allocate.req_offset = offset;
+  80247b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80247e:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.allocate.req_len = len;
+  802483:	8b 45 10             	mov    0x10(%ebp),%eax
+  802486:	a3 08 80 80 00       	mov    %eax,0x808008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  80248b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802490:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802495:	e8 d1 fb ff ff       	call   80206b <fsipc>
+  80249a:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80249c:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  8024a3:	e8 08 18 00 00       	call   803cb0 <mutex_unlock>
+	return r;
+  8024a8:	83 c4 10             	add    $0x10,%esp
+}
+  8024ab:	89 d8                	mov    %ebx,%eax
+  8024ad:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024b0:	c9                   	leave
+  8024b1:	c3                   	ret
+		return -E_NOT_SUPP;
+  8024b2:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8024b7:	eb f2                	jmp    8024ab <fallocate+0x77>
+		return -E_INVAL;
+  8024b9:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8024be:	eb eb                	jmp    8024ab <fallocate+0x77>
+
+008024c0 <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  8024c0:	55                   	push   %ebp
+  8024c1:	89 e5                	mov    %esp,%ebp
+  8024c3:	56                   	push   %esi
+  8024c4:	53                   	push   %ebx
+  8024c5:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  8024c8:	89 f3                	mov    %esi,%ebx
+  8024ca:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  8024d0:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  8024d3:	eb 06                	jmp    8024db <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  8024d5:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8024db:	39 f3                	cmp    %esi,%ebx
+  8024dd:	73 14                	jae    8024f3 <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  8024df:	83 ec 08             	sub    $0x8,%esp
+  8024e2:	53                   	push   %ebx
+  8024e3:	6a 00                	push   $0x0
+  8024e5:	e8 cb ea ff ff       	call   800fb5 <sys_page_unmap>
+  8024ea:	83 c4 10             	add    $0x10,%esp
+  8024ed:	85 c0                	test   %eax,%eax
+  8024ef:	79 e4                	jns    8024d5 <munmap+0x15>
+  8024f1:	eb 05                	jmp    8024f8 <munmap+0x38>
+			return r;
+	return 0;
+  8024f3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024f8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024fb:	5b                   	pop    %ebx
+  8024fc:	5e                   	pop    %esi
+  8024fd:	5d                   	pop    %ebp
+  8024fe:	c3                   	ret
+
+008024ff <mmap>:
+{
+  8024ff:	55                   	push   %ebp
+  802500:	89 e5                	mov    %esp,%ebp
+  802502:	57                   	push   %edi
+  802503:	56                   	push   %esi
+  802504:	53                   	push   %ebx
+  802505:	83 ec 24             	sub    $0x24,%esp
+  802508:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  80250b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80250e:	50                   	push   %eax
+  80250f:	ff 75 08             	push   0x8(%ebp)
+  802512:	e8 9a f5 ff ff       	call   801ab1 <fd_lookup>
+  802517:	83 c4 10             	add    $0x10,%esp
+  80251a:	85 c0                	test   %eax,%eax
+  80251c:	0f 88 37 01 00 00    	js     802659 <mmap+0x15a>
+		return NULL;
+  802522:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802527:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80252a:	8b 0d 08 60 80 00    	mov    0x806008,%ecx
+  802530:	39 0a                	cmp    %ecx,(%edx)
+  802532:	0f 85 05 01 00 00    	jne    80263d <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  802538:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  80253f:	0f 85 1b 01 00 00    	jne    802660 <mmap+0x161>
+  802545:	89 f0                	mov    %esi,%eax
+  802547:	83 e8 01             	sub    $0x1,%eax
+  80254a:	0f 88 17 01 00 00    	js     802667 <mmap+0x168>
+	if (prot & PROT_WRITE)
+  802550:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  802554:	75 28                	jne    80257e <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  802556:	83 ec 0c             	sub    $0xc,%esp
+  802559:	68 04 70 80 00       	push   $0x807004
+  80255e:	e8 e0 16 00 00       	call   803c43 <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  802563:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  802569:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  80256f:	83 c4 10             	add    $0x10,%esp
+  802572:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  802577:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  80257c:	eb 2b                	jmp    8025a9 <mmap+0xaa>
+		cow_enable();
+  80257e:	e8 40 f0 ff ff       	call   8015c3 <cow_enable>
+  802583:	eb d1                	jmp    802556 <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  802585:	89 c2                	mov    %eax,%edx
+  802587:	c1 ea 0c             	shr    $0xc,%edx
+  80258a:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  802591:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  802597:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  80259d:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  8025a0:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  8025a2:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  8025a7:	77 25                	ja     8025ce <mmap+0xcf>
+  8025a9:	89 c2                	mov    %eax,%edx
+  8025ab:	29 da                	sub    %ebx,%edx
+  8025ad:	39 ca                	cmp    %ecx,%edx
+  8025af:	73 3a                	jae    8025eb <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  8025b1:	89 c2                	mov    %eax,%edx
+  8025b3:	c1 ea 16             	shr    $0x16,%edx
+  8025b6:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8025bd:	f6 c2 01             	test   $0x1,%dl
+  8025c0:	75 c3                	jne    802585 <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  8025c2:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  8025c7:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  8025cc:	eb d4                	jmp    8025a2 <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  8025ce:	29 d8                	sub    %ebx,%eax
+  8025d0:	39 c8                	cmp    %ecx,%eax
+  8025d2:	73 17                	jae    8025eb <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  8025d4:	83 ec 0c             	sub    $0xc,%esp
+  8025d7:	68 04 70 80 00       	push   $0x807004
+  8025dc:	e8 cf 16 00 00       	call   803cb0 <mutex_unlock>
+		return NULL;
+  8025e1:	83 c4 10             	add    $0x10,%esp
+  8025e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025e9:	eb 52                	jmp    80263d <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  8025eb:	85 db                	test   %ebx,%ebx
+  8025ed:	74 e5                	je     8025d4 <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8025ef:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8025f2:	8b 40 0c             	mov    0xc(%eax),%eax
+  8025f5:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.map.req_offset = offset;
+  8025fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025fd:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.map.req_len = len;
+  802602:	89 35 08 80 80 00    	mov    %esi,0x808008
+	fsipcbuf.map.req_va = va;
+  802608:	89 1d 0c 80 80 00    	mov    %ebx,0x80800c
+	fsipcbuf.map.req_prot = prot;
+  80260e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802611:	a3 10 80 80 00       	mov    %eax,0x808010
+	r = fsipc(FSREQ_MAP, NULL);
+  802616:	ba 00 00 00 00       	mov    $0x0,%edx
+  80261b:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802620:	e8 46 fa ff ff       	call   80206b <fsipc>
+  802625:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  802627:	83 ec 0c             	sub    $0xc,%esp
+  80262a:	68 04 70 80 00       	push   $0x807004
+  80262f:	e8 7c 16 00 00       	call   803cb0 <mutex_unlock>
+	if (r < 0) {
+  802634:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  802637:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  802639:	85 ff                	test   %edi,%edi
+  80263b:	78 08                	js     802645 <mmap+0x146>
+}
+  80263d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802640:	5b                   	pop    %ebx
+  802641:	5e                   	pop    %esi
+  802642:	5f                   	pop    %edi
+  802643:	5d                   	pop    %ebp
+  802644:	c3                   	ret
+		munmap((void*) va, len);
+  802645:	83 ec 08             	sub    $0x8,%esp
+  802648:	56                   	push   %esi
+  802649:	53                   	push   %ebx
+  80264a:	e8 71 fe ff ff       	call   8024c0 <munmap>
+		return NULL;
+  80264f:	83 c4 10             	add    $0x10,%esp
+  802652:	b8 00 00 00 00       	mov    $0x0,%eax
+  802657:	eb e4                	jmp    80263d <mmap+0x13e>
+		return NULL;
+  802659:	b8 00 00 00 00       	mov    $0x0,%eax
+  80265e:	eb dd                	jmp    80263d <mmap+0x13e>
+		return NULL;
+  802660:	b8 00 00 00 00       	mov    $0x0,%eax
+  802665:	eb d6                	jmp    80263d <mmap+0x13e>
+  802667:	b8 00 00 00 00       	mov    $0x0,%eax
+  80266c:	eb cf                	jmp    80263d <mmap+0x13e>
+
+0080266e <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  80266e:	55                   	push   %ebp
+  80266f:	89 e5                	mov    %esp,%ebp
+  802671:	53                   	push   %ebx
+  802672:	83 ec 10             	sub    $0x10,%esp
+  802675:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802678:	53                   	push   %ebx
+  802679:	e8 25 e4 ff ff       	call   800aa3 <strlen>
+  80267e:	83 c4 10             	add    $0x10,%esp
+  802681:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802686:	7f 42                	jg     8026ca <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  802688:	83 ec 0c             	sub    $0xc,%esp
+  80268b:	68 04 70 80 00       	push   $0x807004
+  802690:	e8 ae 15 00 00       	call   803c43 <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  802695:	83 c4 08             	add    $0x8,%esp
+  802698:	53                   	push   %ebx
+  802699:	68 00 80 80 00       	push   $0x808000
+  80269e:	e8 3b e4 ff ff       	call   800ade <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  8026a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026a8:	b8 07 00 00 00       	mov    $0x7,%eax
+  8026ad:	e8 b9 f9 ff ff       	call   80206b <fsipc>
+  8026b2:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8026b4:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  8026bb:	e8 f0 15 00 00       	call   803cb0 <mutex_unlock>
+	return r;
+  8026c0:	83 c4 10             	add    $0x10,%esp
+}
+  8026c3:	89 d8                	mov    %ebx,%eax
+  8026c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026c8:	c9                   	leave
+  8026c9:	c3                   	ret
+		return -E_BAD_PATH;
+  8026ca:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8026cf:	eb f2                	jmp    8026c3 <remove+0x55>
+
+008026d1 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8026d1:	55                   	push   %ebp
+  8026d2:	89 e5                	mov    %esp,%ebp
+  8026d4:	53                   	push   %ebx
+  8026d5:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  8026d8:	68 04 70 80 00       	push   $0x807004
+  8026dd:	e8 61 15 00 00       	call   803c43 <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  8026e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026e7:	b8 08 00 00 00       	mov    $0x8,%eax
+  8026ec:	e8 7a f9 ff ff       	call   80206b <fsipc>
+  8026f1:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8026f3:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  8026fa:	e8 b1 15 00 00       	call   803cb0 <mutex_unlock>
+	return r;
+}
+  8026ff:	89 d8                	mov    %ebx,%eax
+  802701:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802704:	c9                   	leave
+  802705:	c3                   	ret
+
+00802706 <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  802706:	55                   	push   %ebp
+  802707:	89 e5                	mov    %esp,%ebp
+  802709:	56                   	push   %esi
+  80270a:	53                   	push   %ebx
+  80270b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  80270e:	83 ec 0c             	sub    $0xc,%esp
+  802711:	68 04 70 80 00       	push   $0x807004
+  802716:	e8 28 15 00 00       	call   803c43 <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  80271b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80271e:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  802723:	ba 00 00 00 00       	mov    $0x0,%edx
+  802728:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80272d:	e8 39 f9 ff ff       	call   80206b <fsipc>
+  802732:	89 c6                	mov    %eax,%esi
+  802734:	83 c4 10             	add    $0x10,%esp
+  802737:	85 db                	test   %ebx,%ebx
+  802739:	74 7b                	je     8027b6 <fs_bcstat+0xb0>
+  80273b:	85 c0                	test   %eax,%eax
+  80273d:	78 77                	js     8027b6 <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  80273f:	a1 00 80 80 00       	mov    0x808000,%eax
+  802744:	89 03                	mov    %eax,(%ebx)
+  802746:	a1 04 80 80 00       	mov    0x808004,%eax
+  80274b:	89 43 04             	mov    %eax,0x4(%ebx)
+  80274e:	a1 08 80 80 00       	mov    0x808008,%eax
+  802753:	89 43 08             	mov    %eax,0x8(%ebx)
+  802756:	a1 0c 80 80 00       	mov    0x80800c,%eax
+  80275b:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80275e:	a1 10 80 80 00       	mov    0x808010,%eax
+  802763:	89 43 10             	mov    %eax,0x10(%ebx)
+  802766:	a1 14 80 80 00       	mov    0x808014,%eax
+  80276b:	89 43 14             	mov    %eax,0x14(%ebx)
+  80276e:	a1 18 80 80 00       	mov    0x808018,%eax
+  802773:	89 43 18             	mov    %eax,0x18(%ebx)
+  802776:	a1 1c 80 80 00       	mov    0x80801c,%eax
+  80277b:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  80277e:	a1 20 80 80 00       	mov    0x808020,%eax
+  802783:	89 43 20             	mov    %eax,0x20(%ebx)
+  802786:	a1 24 80 80 00       	mov    0x808024,%eax
+  80278b:	89 43 24             	mov    %eax,0x24(%ebx)
+  80278e:	a1 28 80 80 00       	mov    0x808028,%eax
+  802793:	89 43 28             	mov    %eax,0x28(%ebx)
+  802796:	a1 2c 80 80 00       	mov    0x80802c,%eax
+  80279b:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  80279e:	a1 30 80 80 00       	mov    0x808030,%eax
+  8027a3:	89 43 30             	mov    %eax,0x30(%ebx)
+  8027a6:	a1 34 80 80 00       	mov    0x808034,%eax
+  8027ab:	89 43 34             	mov    %eax,0x34(%ebx)
+  8027ae:	a1 38 80 80 00       	mov    0x808038,%eax
+  8027b3:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  8027b6:	83 ec 0c             	sub    $0xc,%esp
+  8027b9:	68 04 70 80 00       	push   $0x807004
+  8027be:	e8 ed 14 00 00       	call   803cb0 <mutex_unlock>
+	return r;
+}
+  8027c3:	89 f0                	mov    %esi,%eax
+  8027c5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027c8:	5b                   	pop    %ebx
+  8027c9:	5e                   	pop    %esi
+  8027ca:	5d                   	pop    %ebp
+  8027cb:	c3                   	ret
+
+008027cc <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  8027cc:	55                   	push   %ebp
+  8027cd:	89 e5                	mov    %esp,%ebp
+  8027cf:	56                   	push   %esi
+  8027d0:	53                   	push   %ebx
+  8027d1:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  8027d3:	0f b6 10             	movzbl (%eax),%edx
+  8027d6:	80 fa 72             	cmp    $0x72,%dl
+  8027d9:	74 44                	je     80281f <parse_mode+0x53>
+  8027db:	80 fa 77             	cmp    $0x77,%dl
+  8027de:	74 4b                	je     80282b <parse_mode+0x5f>
+  8027e0:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8027e5:	80 fa 61             	cmp    $0x61,%dl
+  8027e8:	74 09                	je     8027f3 <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  8027ea:	89 d8                	mov    %ebx,%eax
+  8027ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027ef:	5b                   	pop    %ebx
+  8027f0:	5e                   	pop    %esi
+  8027f1:	5d                   	pop    %ebp
+  8027f2:	c3                   	ret
+	switch (mode[0]) {
+  8027f3:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  8027f8:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  8027fd:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  8027ff:	83 ec 08             	sub    $0x8,%esp
+  802802:	6a 2b                	push   $0x2b
+  802804:	50                   	push   %eax
+  802805:	e8 e6 e3 ff ff       	call   800bf0 <strchr>
+  80280a:	83 c4 10             	add    $0x10,%esp
+  80280d:	85 c0                	test   %eax,%eax
+  80280f:	74 d9                	je     8027ea <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  802811:	83 e3 fc             	and    $0xfffffffc,%ebx
+  802814:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  802817:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  80281d:	eb cb                	jmp    8027ea <parse_mode+0x1e>
+	switch (mode[0]) {
+  80281f:	ba 01 00 00 00       	mov    $0x1,%edx
+  802824:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802829:	eb d2                	jmp    8027fd <parse_mode+0x31>
+  80282b:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  802830:	bb 01 03 00 00       	mov    $0x301,%ebx
+  802835:	eb c6                	jmp    8027fd <parse_mode+0x31>
+
+00802837 <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  802837:	55                   	push   %ebp
+  802838:	89 e5                	mov    %esp,%ebp
+  80283a:	57                   	push   %edi
+  80283b:	56                   	push   %esi
+  80283c:	53                   	push   %ebx
+  80283d:	83 ec 1c             	sub    $0x1c,%esp
+  802840:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802843:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  802846:	b8 44 60 80 00       	mov    $0x806044,%eax
+  80284b:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  802850:	83 c0 24             	add    $0x24,%eax
+  802853:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  802857:	74 17                	je     802870 <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  802859:	83 c3 01             	add    $0x1,%ebx
+  80285c:	83 fb 10             	cmp    $0x10,%ebx
+  80285f:	75 ef                	jne    802850 <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  802861:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  802866:	89 f0                	mov    %esi,%eax
+  802868:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80286b:	5b                   	pop    %ebx
+  80286c:	5e                   	pop    %esi
+  80286d:	5f                   	pop    %edi
+  80286e:	5d                   	pop    %ebp
+  80286f:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  802870:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  802877:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80287a:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  80287d:	c1 e7 02             	shl    $0x2,%edi
+  802880:	8d b7 40 60 80 00    	lea    0x806040(%edi),%esi
+  802886:	83 ec 04             	sub    $0x4,%esp
+  802889:	6a 24                	push   $0x24
+  80288b:	6a 00                	push   $0x0
+  80288d:	56                   	push   %esi
+  80288e:	e8 9c e3 ff ff       	call   800c2f <memset>
+			streams[i].f_fd = fd;
+  802893:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802896:	89 8f 40 60 80 00    	mov    %ecx,0x806040(%edi)
+			streams[i].f_flags = flags;
+  80289c:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80289f:	01 d8                	add    %ebx,%eax
+  8028a1:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8028a4:	89 0c 85 44 60 80 00 	mov    %ecx,0x806044(,%eax,4)
+			return &streams[i];
+  8028ab:	83 c4 10             	add    $0x10,%esp
+  8028ae:	eb b6                	jmp    802866 <stream_alloc+0x2f>
+
+008028b0 <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  8028b0:	55                   	push   %ebp
+  8028b1:	89 e5                	mov    %esp,%ebp
+  8028b3:	53                   	push   %ebx
+  8028b4:	83 ec 14             	sub    $0x14,%esp
+  8028b7:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  8028b9:	8b 40 18             	mov    0x18(%eax),%eax
+  8028bc:	39 43 14             	cmp    %eax,0x14(%ebx)
+  8028bf:	74 4a                	je     80290b <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  8028c1:	83 ec 08             	sub    $0x8,%esp
+  8028c4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8028c7:	50                   	push   %eax
+  8028c8:	ff 33                	push   (%ebx)
+  8028ca:	e8 e2 f1 ff ff       	call   801ab1 <fd_lookup>
+  8028cf:	89 c2                	mov    %eax,%edx
+  8028d1:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8028d4:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  8028d9:	85 d2                	test   %edx,%edx
+  8028db:	78 41                	js     80291e <stream_unread+0x6e>
+  8028dd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8028e0:	8b 0d 08 60 80 00    	mov    0x806008,%ecx
+  8028e6:	39 0a                	cmp    %ecx,(%edx)
+  8028e8:	75 34                	jne    80291e <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  8028ea:	8b 43 14             	mov    0x14(%ebx),%eax
+  8028ed:	03 42 04             	add    0x4(%edx),%eax
+  8028f0:	2b 43 18             	sub    0x18(%ebx),%eax
+  8028f3:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  8028f6:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  8028fd:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  802904:	b8 01 00 00 00       	mov    $0x1,%eax
+  802909:	eb 13                	jmp    80291e <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  80290b:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  802912:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  802919:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80291e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802921:	c9                   	leave
+  802922:	c3                   	ret
+
+00802923 <stream_drain>:
+{
+  802923:	55                   	push   %ebp
+  802924:	89 e5                	mov    %esp,%ebp
+  802926:	56                   	push   %esi
+  802927:	53                   	push   %ebx
+  802928:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  80292a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80292f:	eb 02                	jmp    802933 <stream_drain+0x10>
+  802931:	01 c3                	add    %eax,%ebx
+  802933:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802936:	39 c3                	cmp    %eax,%ebx
+  802938:	73 43                	jae    80297d <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  80293a:	83 ec 04             	sub    $0x4,%esp
+  80293d:	29 d8                	sub    %ebx,%eax
+  80293f:	50                   	push   %eax
+  802940:	89 d8                	mov    %ebx,%eax
+  802942:	03 46 0c             	add    0xc(%esi),%eax
+  802945:	50                   	push   %eax
+  802946:	ff 36                	push   (%esi)
+  802948:	e8 ec f4 ff ff       	call   801e39 <write>
+  80294d:	83 c4 10             	add    $0x10,%esp
+  802950:	85 c0                	test   %eax,%eax
+  802952:	7f dd                	jg     802931 <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  802954:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  802958:	8b 56 0c             	mov    0xc(%esi),%edx
+  80295b:	83 ec 04             	sub    $0x4,%esp
+  80295e:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802961:	29 d8                	sub    %ebx,%eax
+  802963:	50                   	push   %eax
+  802964:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  802967:	50                   	push   %eax
+  802968:	52                   	push   %edx
+  802969:	e8 f6 e2 ff ff       	call   800c64 <memmove>
+			f->f_wend -= done;
+  80296e:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802971:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  802973:	83 c4 10             	add    $0x10,%esp
+  802976:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  80297b:	eb 0a                	jmp    802987 <stream_drain+0x64>
+  80297d:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  802982:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  802987:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  80298a:	89 d0                	mov    %edx,%eax
+  80298c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80298f:	5b                   	pop    %ebx
+  802990:	5e                   	pop    %esi
+  802991:	5d                   	pop    %ebp
+  802992:	c3                   	ret
+
+00802993 <stream_setup>:
+	if (f->f_buf)
+  802993:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802997:	74 01                	je     80299a <stream_setup+0x7>
+  802999:	c3                   	ret
+{
+  80299a:	55                   	push   %ebp
+  80299b:	89 e5                	mov    %esp,%ebp
+  80299d:	53                   	push   %ebx
+  80299e:	83 ec 04             	sub    $0x4,%esp
+  8029a1:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  8029a3:	8b 40 08             	mov    0x8(%eax),%eax
+  8029a6:	85 c0                	test   %eax,%eax
+  8029a8:	74 17                	je     8029c1 <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  8029aa:	83 f8 03             	cmp    $0x3,%eax
+  8029ad:	75 2d                	jne    8029dc <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  8029af:	8d 43 20             	lea    0x20(%ebx),%eax
+  8029b2:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  8029b5:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  8029bc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029bf:	c9                   	leave
+  8029c0:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  8029c1:	83 ec 0c             	sub    $0xc,%esp
+  8029c4:	ff 33                	push   (%ebx)
+  8029c6:	e8 7a 1b 00 00       	call   804545 <iscons>
+  8029cb:	83 c4 10             	add    $0x10,%esp
+  8029ce:	85 c0                	test   %eax,%eax
+  8029d0:	0f 9f c0             	setg   %al
+  8029d3:	0f b6 c0             	movzbl %al,%eax
+  8029d6:	83 c0 01             	add    $0x1,%eax
+  8029d9:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  8029dc:	83 ec 0c             	sub    $0xc,%esp
+  8029df:	68 00 10 00 00       	push   $0x1000
+  8029e4:	e8 6e 0b 00 00       	call   803557 <malloc>
+  8029e9:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8029ec:	83 c4 10             	add    $0x10,%esp
+  8029ef:	85 c0                	test   %eax,%eax
+  8029f1:	74 bc                	je     8029af <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  8029f3:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  8029fa:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  8029fe:	eb bc                	jmp    8029bc <stream_setup+0x29>
+
+00802a00 <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  802a00:	55                   	push   %ebp
+  802a01:	89 e5                	mov    %esp,%ebp
+  802a03:	53                   	push   %ebx
+  802a04:	83 ec 04             	sub    $0x4,%esp
+  802a07:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  802a09:	e8 85 ff ff ff       	call   802993 <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  802a0e:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  802a13:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  802a17:	74 3d                	je     802a56 <stream_fill+0x56>
+  802a19:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  802a1d:	74 10                	je     802a2f <stream_fill+0x2f>
+  802a1f:	89 d8                	mov    %ebx,%eax
+  802a21:	e8 fd fe ff ff       	call   802923 <stream_drain>
+		return 0;
+  802a26:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  802a2b:	85 c0                	test   %eax,%eax
+  802a2d:	78 27                	js     802a56 <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  802a2f:	83 ec 04             	sub    $0x4,%esp
+  802a32:	ff 73 10             	push   0x10(%ebx)
+  802a35:	ff 73 0c             	push   0xc(%ebx)
+  802a38:	ff 33                	push   (%ebx)
+  802a3a:	e8 02 f3 ff ff       	call   801d41 <read>
+  802a3f:	83 c4 10             	add    $0x10,%esp
+  802a42:	85 c0                	test   %eax,%eax
+  802a44:	7e 17                	jle    802a5d <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  802a46:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  802a4a:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  802a51:	89 c2                	mov    %eax,%edx
+  802a53:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  802a56:	89 d0                	mov    %edx,%eax
+  802a58:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a5b:	c9                   	leave
+  802a5c:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802a5d:	c1 f8 1f             	sar    $0x1f,%eax
+  802a60:	83 e0 04             	and    $0x4,%eax
+  802a63:	83 c0 04             	add    $0x4,%eax
+  802a66:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  802a69:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a6e:	eb e6                	jmp    802a56 <stream_fill+0x56>
+
+00802a70 <fopen>:
+{
+  802a70:	55                   	push   %ebp
+  802a71:	89 e5                	mov    %esp,%ebp
+  802a73:	57                   	push   %edi
+  802a74:	56                   	push   %esi
+  802a75:	53                   	push   %ebx
+  802a76:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  802a7c:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  802a7f:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  802a85:	89 f0                	mov    %esi,%eax
+  802a87:	e8 40 fd ff ff       	call   8027cc <parse_mode>
+		return 0;
+  802a8c:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  802a91:	85 c0                	test   %eax,%eax
+  802a93:	78 2d                	js     802ac2 <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  802a95:	83 ec 08             	sub    $0x8,%esp
+  802a98:	50                   	push   %eax
+  802a99:	ff 75 08             	push   0x8(%ebp)
+  802a9c:	e8 e8 f8 ff ff       	call   802389 <open>
+  802aa1:	89 c7                	mov    %eax,%edi
+  802aa3:	83 c4 10             	add    $0x10,%esp
+  802aa6:	85 c0                	test   %eax,%eax
+  802aa8:	78 58                	js     802b02 <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  802aaa:	80 3e 61             	cmpb   $0x61,(%esi)
+  802aad:	74 1d                	je     802acc <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  802aaf:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  802ab5:	89 f8                	mov    %edi,%eax
+  802ab7:	e8 7b fd ff ff       	call   802837 <stream_alloc>
+  802abc:	89 c3                	mov    %eax,%ebx
+  802abe:	85 c0                	test   %eax,%eax
+  802ac0:	74 32                	je     802af4 <fopen+0x84>
+}
+  802ac2:	89 d8                	mov    %ebx,%eax
+  802ac4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ac7:	5b                   	pop    %ebx
+  802ac8:	5e                   	pop    %esi
+  802ac9:	5f                   	pop    %edi
+  802aca:	5d                   	pop    %ebp
+  802acb:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  802acc:	83 ec 08             	sub    $0x8,%esp
+  802acf:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  802ad5:	50                   	push   %eax
+  802ad6:	57                   	push   %edi
+  802ad7:	e8 db f4 ff ff       	call   801fb7 <fstat>
+  802adc:	83 c4 10             	add    $0x10,%esp
+  802adf:	85 c0                	test   %eax,%eax
+  802ae1:	78 cc                	js     802aaf <fopen+0x3f>
+		seek(fd, st.st_size);
+  802ae3:	83 ec 08             	sub    $0x8,%esp
+  802ae6:	ff 75 dc             	push   -0x24(%ebp)
+  802ae9:	57                   	push   %edi
+  802aea:	e8 f6 f3 ff ff       	call   801ee5 <seek>
+  802aef:	83 c4 10             	add    $0x10,%esp
+  802af2:	eb bb                	jmp    802aaf <fopen+0x3f>
+		close(fd);
+  802af4:	83 ec 0c             	sub    $0xc,%esp
+  802af7:	57                   	push   %edi
+  802af8:	e8 08 f1 ff ff       	call   801c05 <close>
+  802afd:	83 c4 10             	add    $0x10,%esp
+  802b00:	eb c0                	jmp    802ac2 <fopen+0x52>
+		return 0;
+  802b02:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b07:	eb b9                	jmp    802ac2 <fopen+0x52>
+
+00802b09 <fdopen>:
+{
+  802b09:	55                   	push   %ebp
+  802b0a:	89 e5                	mov    %esp,%ebp
+  802b0c:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  802b0f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802b12:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b15:	e8 b2 fc ff ff       	call   8027cc <parse_mode>
+  802b1a:	89 c2                	mov    %eax,%edx
+		return 0;
+  802b1c:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  802b21:	85 d2                	test   %edx,%edx
+  802b23:	78 0b                	js     802b30 <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  802b25:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802b28:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b2b:	e8 07 fd ff ff       	call   802837 <stream_alloc>
+}
+  802b30:	c9                   	leave
+  802b31:	c3                   	ret
+
+00802b32 <setvbuf>:
+{
+  802b32:	55                   	push   %ebp
+  802b33:	89 e5                	mov    %esp,%ebp
+  802b35:	57                   	push   %edi
+  802b36:	56                   	push   %esi
+  802b37:	53                   	push   %ebx
+  802b38:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b3b:	8b 55 10             	mov    0x10(%ebp),%edx
+  802b3e:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  802b41:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802b45:	75 3a                	jne    802b81 <setvbuf+0x4f>
+  802b47:	8d 72 ff             	lea    -0x1(%edx),%esi
+  802b4a:	83 fe 02             	cmp    $0x2,%esi
+  802b4d:	77 39                	ja     802b88 <setvbuf+0x56>
+	f->f_bufmode = mode;
+  802b4f:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  802b52:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802b56:	0f 95 c3             	setne  %bl
+  802b59:	85 ff                	test   %edi,%edi
+  802b5b:	0f 95 c1             	setne  %cl
+  802b5e:	84 cb                	test   %cl,%bl
+  802b60:	74 05                	je     802b67 <setvbuf+0x35>
+  802b62:	83 fa 03             	cmp    $0x3,%edx
+  802b65:	75 0a                	jne    802b71 <setvbuf+0x3f>
+	return 0;
+  802b67:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b6c:	5b                   	pop    %ebx
+  802b6d:	5e                   	pop    %esi
+  802b6e:	5f                   	pop    %edi
+  802b6f:	5d                   	pop    %ebp
+  802b70:	c3                   	ret
+		f->f_buf = buf;
+  802b71:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802b74:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  802b77:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  802b7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b7f:	eb eb                	jmp    802b6c <setvbuf+0x3a>
+		return EOF;
+  802b81:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802b86:	eb e4                	jmp    802b6c <setvbuf+0x3a>
+  802b88:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802b8d:	eb dd                	jmp    802b6c <setvbuf+0x3a>
+
+00802b8f <fflush>:
+{
+  802b8f:	55                   	push   %ebp
+  802b90:	89 e5                	mov    %esp,%ebp
+  802b92:	57                   	push   %edi
+  802b93:	56                   	push   %esi
+  802b94:	53                   	push   %ebx
+  802b95:	83 ec 0c             	sub    $0xc,%esp
+  802b98:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  802b9b:	85 db                	test   %ebx,%ebx
+  802b9d:	74 1a                	je     802bb9 <fflush+0x2a>
+	stream_unread(f);
+  802b9f:	89 d8                	mov    %ebx,%eax
+  802ba1:	e8 0a fd ff ff       	call   8028b0 <stream_unread>
+	return stream_drain(f);
+  802ba6:	89 d8                	mov    %ebx,%eax
+  802ba8:	e8 76 fd ff ff       	call   802923 <stream_drain>
+  802bad:	89 c7                	mov    %eax,%edi
+}
+  802baf:	89 f8                	mov    %edi,%eax
+  802bb1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bb4:	5b                   	pop    %ebx
+  802bb5:	5e                   	pop    %esi
+  802bb6:	5f                   	pop    %edi
+  802bb7:	5d                   	pop    %ebp
+  802bb8:	c3                   	ret
+  802bb9:	bb 40 60 80 00       	mov    $0x806040,%ebx
+  802bbe:	be 80 62 80 00       	mov    $0x806280,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  802bc3:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bc8:	eb 03                	jmp    802bcd <fflush+0x3e>
+  802bca:	83 c3 24             	add    $0x24,%ebx
+  802bcd:	39 f3                	cmp    %esi,%ebx
+  802bcf:	74 de                	je     802baf <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  802bd1:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  802bd5:	74 f3                	je     802bca <fflush+0x3b>
+  802bd7:	83 ec 0c             	sub    $0xc,%esp
+  802bda:	53                   	push   %ebx
+  802bdb:	e8 af ff ff ff       	call   802b8f <fflush>
+  802be0:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  802be3:	85 c0                	test   %eax,%eax
+  802be5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802bea:	0f 48 f8             	cmovs  %eax,%edi
+  802bed:	eb db                	jmp    802bca <fflush+0x3b>
+
+00802bef <fclose>:
+{
+  802bef:	55                   	push   %ebp
+  802bf0:	89 e5                	mov    %esp,%ebp
+  802bf2:	56                   	push   %esi
+  802bf3:	53                   	push   %ebx
+  802bf4:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  802bf7:	83 ec 0c             	sub    $0xc,%esp
+  802bfa:	56                   	push   %esi
+  802bfb:	e8 8f ff ff ff       	call   802b8f <fflush>
+  802c00:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  802c02:	83 c4 04             	add    $0x4,%esp
+  802c05:	ff 36                	push   (%esi)
+  802c07:	e8 f9 ef ff ff       	call   801c05 <close>
+  802c0c:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  802c0f:	85 c0                	test   %eax,%eax
+  802c11:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802c16:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  802c19:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  802c1d:	75 10                	jne    802c2f <fclose+0x40>
+	f->f_flags = 0;
+  802c1f:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  802c26:	89 d8                	mov    %ebx,%eax
+  802c28:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c2b:	5b                   	pop    %ebx
+  802c2c:	5e                   	pop    %esi
+  802c2d:	5d                   	pop    %ebp
+  802c2e:	c3                   	ret
+		free(f->f_buf);
+  802c2f:	83 ec 0c             	sub    $0xc,%esp
+  802c32:	ff 76 0c             	push   0xc(%esi)
+  802c35:	e8 54 08 00 00       	call   80348e <free>
+  802c3a:	83 c4 10             	add    $0x10,%esp
+  802c3d:	eb e0                	jmp    802c1f <fclose+0x30>
+
+00802c3f <fileno>:
+{
+  802c3f:	55                   	push   %ebp
+  802c40:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  802c42:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c45:	8b 00                	mov    (%eax),%eax
+}
+  802c47:	5d                   	pop    %ebp
+  802c48:	c3                   	ret
+
+00802c49 <feof>:
+{
+  802c49:	55                   	push   %ebp
+  802c4a:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  802c4c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c4f:	8b 40 04             	mov    0x4(%eax),%eax
+  802c52:	c1 e8 02             	shr    $0x2,%eax
+  802c55:	83 e0 01             	and    $0x1,%eax
+}
+  802c58:	5d                   	pop    %ebp
+  802c59:	c3                   	ret
+
+00802c5a <ferror>:
+{
+  802c5a:	55                   	push   %ebp
+  802c5b:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  802c5d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c60:	8b 40 04             	mov    0x4(%eax),%eax
+  802c63:	c1 e8 03             	shr    $0x3,%eax
+  802c66:	83 e0 01             	and    $0x1,%eax
+}
+  802c69:	5d                   	pop    %ebp
+  802c6a:	c3                   	ret
+
+00802c6b <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  802c6b:	55                   	push   %ebp
+  802c6c:	89 e5                	mov    %esp,%ebp
+  802c6e:	53                   	push   %ebx
+  802c6f:	83 ec 04             	sub    $0x4,%esp
+  802c72:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802c75:	8b 43 18             	mov    0x18(%ebx),%eax
+  802c78:	39 43 14             	cmp    %eax,0x14(%ebx)
+  802c7b:	74 15                	je     802c92 <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  802c7d:	8b 53 0c             	mov    0xc(%ebx),%edx
+  802c80:	8b 43 14             	mov    0x14(%ebx),%eax
+  802c83:	8d 48 01             	lea    0x1(%eax),%ecx
+  802c86:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  802c89:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  802c8d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c90:	c9                   	leave
+  802c91:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802c92:	89 d8                	mov    %ebx,%eax
+  802c94:	e8 67 fd ff ff       	call   802a00 <stream_fill>
+  802c99:	85 c0                	test   %eax,%eax
+  802c9b:	75 e0                	jne    802c7d <fgetc+0x12>
+		return EOF;
+  802c9d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802ca2:	eb e9                	jmp    802c8d <fgetc+0x22>
+
+00802ca4 <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  802ca4:	55                   	push   %ebp
+  802ca5:	89 e5                	mov    %esp,%ebp
+  802ca7:	57                   	push   %edi
+  802ca8:	56                   	push   %esi
+  802ca9:	53                   	push   %ebx
+  802caa:	83 ec 1c             	sub    $0x1c,%esp
+  802cad:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  802cb0:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802cb5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802cb8:	83 e8 01             	sub    $0x1,%eax
+  802cbb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  802cbe:	eb 66                	jmp    802d26 <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802cc0:	8b 46 14             	mov    0x14(%esi),%eax
+  802cc3:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802cc6:	29 c3                	sub    %eax,%ebx
+  802cc8:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802ccb:	29 fa                	sub    %edi,%edx
+  802ccd:	39 d3                	cmp    %edx,%ebx
+  802ccf:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802cd2:	83 ec 04             	sub    $0x4,%esp
+  802cd5:	53                   	push   %ebx
+  802cd6:	6a 0a                	push   $0xa
+  802cd8:	03 46 0c             	add    0xc(%esi),%eax
+  802cdb:	50                   	push   %eax
+  802cdc:	e8 34 e0 ff ff       	call   800d15 <memfind>
+  802ce1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  802ce4:	8b 46 0c             	mov    0xc(%esi),%eax
+  802ce7:	8b 4e 14             	mov    0x14(%esi),%ecx
+  802cea:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  802ced:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802cef:	83 c4 10             	add    $0x10,%esp
+  802cf2:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802cf5:	74 0b                	je     802d02 <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  802cf7:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802cfa:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802cfd:	29 d3                	sub    %edx,%ebx
+  802cff:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  802d02:	83 ec 04             	sub    $0x4,%esp
+  802d05:	53                   	push   %ebx
+  802d06:	01 c8                	add    %ecx,%eax
+  802d08:	50                   	push   %eax
+  802d09:	89 f8                	mov    %edi,%eax
+  802d0b:	03 45 08             	add    0x8(%ebp),%eax
+  802d0e:	50                   	push   %eax
+  802d0f:	e8 50 df ff ff       	call   800c64 <memmove>
+		f->f_rpos += m;
+  802d14:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  802d17:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  802d19:	83 c4 10             	add    $0x10,%esp
+  802d1c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d1f:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  802d24:	74 1f                	je     802d45 <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  802d26:	8d 47 01             	lea    0x1(%edi),%eax
+  802d29:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  802d2c:	73 17                	jae    802d45 <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802d2e:	8b 46 18             	mov    0x18(%esi),%eax
+  802d31:	39 46 14             	cmp    %eax,0x14(%esi)
+  802d34:	75 8a                	jne    802cc0 <fgets+0x1c>
+  802d36:	89 f0                	mov    %esi,%eax
+  802d38:	e8 c3 fc ff ff       	call   802a00 <stream_fill>
+  802d3d:	85 c0                	test   %eax,%eax
+  802d3f:	0f 85 7b ff ff ff    	jne    802cc0 <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  802d45:	85 ff                	test   %edi,%edi
+  802d47:	74 0f                	je     802d58 <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  802d49:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d4c:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  802d50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d53:	5b                   	pop    %ebx
+  802d54:	5e                   	pop    %esi
+  802d55:	5f                   	pop    %edi
+  802d56:	5d                   	pop    %ebp
+  802d57:	c3                   	ret
+		return 0;
+  802d58:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d5d:	eb f1                	jmp    802d50 <fgets+0xac>
+
+00802d5f <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  802d5f:	55                   	push   %ebp
+  802d60:	89 e5                	mov    %esp,%ebp
+  802d62:	57                   	push   %edi
+  802d63:	56                   	push   %esi
+  802d64:	53                   	push   %ebx
+  802d65:	83 ec 1c             	sub    $0x1c,%esp
+  802d68:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  802d6b:	89 f0                	mov    %esi,%eax
+  802d6d:	e8 21 fc ff ff       	call   802993 <stream_setup>
+	want = size * n;
+  802d72:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d75:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802d79:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  802d7c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d81:	eb 43                	jmp    802dc6 <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  802d83:	29 d3                	sub    %edx,%ebx
+  802d85:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802d88:	29 f8                	sub    %edi,%eax
+  802d8a:	39 c3                	cmp    %eax,%ebx
+  802d8c:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  802d8f:	83 ec 04             	sub    $0x4,%esp
+  802d92:	53                   	push   %ebx
+  802d93:	03 56 0c             	add    0xc(%esi),%edx
+  802d96:	52                   	push   %edx
+  802d97:	89 f8                	mov    %edi,%eax
+  802d99:	03 45 08             	add    0x8(%ebp),%eax
+  802d9c:	50                   	push   %eax
+  802d9d:	e8 c2 de ff ff       	call   800c64 <memmove>
+			f->f_rpos += m;
+  802da2:	01 5e 14             	add    %ebx,0x14(%esi)
+  802da5:	83 c4 10             	add    $0x10,%esp
+  802da8:	eb 1a                	jmp    802dc4 <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  802daa:	83 ec 04             	sub    $0x4,%esp
+  802dad:	53                   	push   %ebx
+  802dae:	89 f8                	mov    %edi,%eax
+  802db0:	03 45 08             	add    0x8(%ebp),%eax
+  802db3:	50                   	push   %eax
+  802db4:	ff 36                	push   (%esi)
+  802db6:	e8 86 ef ff ff       	call   801d41 <read>
+  802dbb:	89 c3                	mov    %eax,%ebx
+  802dbd:	83 c4 10             	add    $0x10,%esp
+  802dc0:	85 c0                	test   %eax,%eax
+  802dc2:	7e 36                	jle    802dfa <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  802dc4:	01 df                	add    %ebx,%edi
+  802dc6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802dc9:	39 c7                	cmp    %eax,%edi
+  802dcb:	73 39                	jae    802e06 <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  802dcd:	8b 56 14             	mov    0x14(%esi),%edx
+  802dd0:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802dd3:	39 da                	cmp    %ebx,%edx
+  802dd5:	72 ac                	jb     802d83 <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  802dd7:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802dda:	29 fb                	sub    %edi,%ebx
+  802ddc:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  802ddf:	72 3e                	jb     802e1f <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  802de1:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  802de5:	74 1f                	je     802e06 <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  802de7:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  802deb:	74 bd                	je     802daa <fread+0x4b>
+  802ded:	89 f0                	mov    %esi,%eax
+  802def:	e8 2f fb ff ff       	call   802923 <stream_drain>
+  802df4:	85 c0                	test   %eax,%eax
+  802df6:	79 b2                	jns    802daa <fread+0x4b>
+  802df8:	eb 0c                	jmp    802e06 <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802dfa:	c1 fb 1f             	sar    $0x1f,%ebx
+  802dfd:	83 e3 04             	and    $0x4,%ebx
+  802e00:	83 c3 04             	add    $0x4,%ebx
+  802e03:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  802e06:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e09:	85 c0                	test   %eax,%eax
+  802e0b:	74 0a                	je     802e17 <fread+0xb8>
+  802e0d:	89 f8                	mov    %edi,%eax
+  802e0f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e14:	f7 75 0c             	divl   0xc(%ebp)
+}
+  802e17:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e1a:	5b                   	pop    %ebx
+  802e1b:	5e                   	pop    %esi
+  802e1c:	5f                   	pop    %edi
+  802e1d:	5d                   	pop    %ebp
+  802e1e:	c3                   	ret
+		} else if (!stream_fill(f))
+  802e1f:	89 f0                	mov    %esi,%eax
+  802e21:	e8 da fb ff ff       	call   802a00 <stream_fill>
+  802e26:	85 c0                	test   %eax,%eax
+  802e28:	74 dc                	je     802e06 <fread+0xa7>
+			m = 0;
+  802e2a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e2f:	eb 93                	jmp    802dc4 <fread+0x65>
+
+00802e31 <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  802e31:	55                   	push   %ebp
+  802e32:	89 e5                	mov    %esp,%ebp
+  802e34:	57                   	push   %edi
+  802e35:	56                   	push   %esi
+  802e36:	53                   	push   %ebx
+  802e37:	83 ec 1c             	sub    $0x1c,%esp
+  802e3a:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  802e3d:	8b 43 04             	mov    0x4(%ebx),%eax
+  802e40:	a8 02                	test   $0x2,%al
+  802e42:	75 13                	jne    802e57 <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  802e44:	83 c8 08             	or     $0x8,%eax
+  802e47:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  802e4a:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  802e4f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e52:	5b                   	pop    %ebx
+  802e53:	5e                   	pop    %esi
+  802e54:	5f                   	pop    %edi
+  802e55:	5d                   	pop    %ebp
+  802e56:	c3                   	ret
+	stream_setup(f);
+  802e57:	89 d8                	mov    %ebx,%eax
+  802e59:	e8 35 fb ff ff       	call   802993 <stream_setup>
+	want = size * n;
+  802e5e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e61:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802e65:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  802e68:	89 d8                	mov    %ebx,%eax
+  802e6a:	e8 41 fa ff ff       	call   8028b0 <stream_unread>
+	for (done = 0; done < want; ) {
+  802e6f:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  802e74:	84 c0                	test   %al,%al
+  802e76:	75 7b                	jne    802ef3 <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  802e78:	be 00 00 00 00       	mov    $0x0,%esi
+  802e7d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802e80:	39 fe                	cmp    %edi,%esi
+  802e82:	73 24                	jae    802ea8 <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802e84:	83 ec 04             	sub    $0x4,%esp
+  802e87:	89 f8                	mov    %edi,%eax
+  802e89:	29 f0                	sub    %esi,%eax
+  802e8b:	50                   	push   %eax
+  802e8c:	89 f0                	mov    %esi,%eax
+  802e8e:	03 45 08             	add    0x8(%ebp),%eax
+  802e91:	50                   	push   %eax
+  802e92:	ff 33                	push   (%ebx)
+  802e94:	e8 a0 ef ff ff       	call   801e39 <write>
+  802e99:	83 c4 10             	add    $0x10,%esp
+  802e9c:	85 c0                	test   %eax,%eax
+  802e9e:	7e 04                	jle    802ea4 <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  802ea0:	01 c6                	add    %eax,%esi
+  802ea2:	eb dc                	jmp    802e80 <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  802ea4:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  802ea8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802eab:	85 c0                	test   %eax,%eax
+  802ead:	74 a0                	je     802e4f <fwrite+0x1e>
+  802eaf:	89 f0                	mov    %esi,%eax
+  802eb1:	ba 00 00 00 00       	mov    $0x0,%edx
+  802eb6:	f7 75 0c             	divl   0xc(%ebp)
+  802eb9:	eb 94                	jmp    802e4f <fwrite+0x1e>
+			done += r;
+  802ebb:	01 c7                	add    %eax,%edi
+			continue;
+  802ebd:	eb 34                	jmp    802ef3 <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  802ebf:	8b 73 10             	mov    0x10(%ebx),%esi
+  802ec2:	29 c6                	sub    %eax,%esi
+  802ec4:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802ec7:	29 fa                	sub    %edi,%edx
+  802ec9:	39 d6                	cmp    %edx,%esi
+  802ecb:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  802ece:	83 ec 04             	sub    $0x4,%esp
+  802ed1:	56                   	push   %esi
+  802ed2:	89 fa                	mov    %edi,%edx
+  802ed4:	03 55 08             	add    0x8(%ebp),%edx
+  802ed7:	52                   	push   %edx
+  802ed8:	03 43 0c             	add    0xc(%ebx),%eax
+  802edb:	50                   	push   %eax
+  802edc:	e8 83 dd ff ff       	call   800c64 <memmove>
+		f->f_wend += m;
+  802ee1:	89 f0                	mov    %esi,%eax
+  802ee3:	03 43 1c             	add    0x1c(%ebx),%eax
+  802ee6:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  802ee9:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802eeb:	83 c4 10             	add    $0x10,%esp
+  802eee:	3b 43 10             	cmp    0x10(%ebx),%eax
+  802ef1:	74 5b                	je     802f4e <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  802ef3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802ef6:	39 c7                	cmp    %eax,%edi
+  802ef8:	73 2d                	jae    802f27 <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  802efa:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802efd:	85 c0                	test   %eax,%eax
+  802eff:	75 be                	jne    802ebf <fwrite+0x8e>
+  802f01:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802f04:	29 fa                	sub    %edi,%edx
+  802f06:	3b 53 10             	cmp    0x10(%ebx),%edx
+  802f09:	72 b4                	jb     802ebf <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802f0b:	83 ec 04             	sub    $0x4,%esp
+  802f0e:	52                   	push   %edx
+  802f0f:	89 f8                	mov    %edi,%eax
+  802f11:	03 45 08             	add    0x8(%ebp),%eax
+  802f14:	50                   	push   %eax
+  802f15:	ff 33                	push   (%ebx)
+  802f17:	e8 1d ef ff ff       	call   801e39 <write>
+  802f1c:	83 c4 10             	add    $0x10,%esp
+  802f1f:	85 c0                	test   %eax,%eax
+  802f21:	7f 98                	jg     802ebb <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  802f23:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  802f27:	8b 43 08             	mov    0x8(%ebx),%eax
+  802f2a:	83 f8 03             	cmp    $0x3,%eax
+  802f2d:	74 48                	je     802f77 <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802f2f:	83 f8 02             	cmp    $0x2,%eax
+  802f32:	74 27                	je     802f5b <fwrite+0x12a>
+	return size ? done / size : 0;
+  802f34:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f37:	85 c0                	test   %eax,%eax
+  802f39:	0f 84 10 ff ff ff    	je     802e4f <fwrite+0x1e>
+  802f3f:	89 f8                	mov    %edi,%eax
+  802f41:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f46:	f7 75 0c             	divl   0xc(%ebp)
+  802f49:	e9 01 ff ff ff       	jmp    802e4f <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802f4e:	89 d8                	mov    %ebx,%eax
+  802f50:	e8 ce f9 ff ff       	call   802923 <stream_drain>
+  802f55:	85 c0                	test   %eax,%eax
+  802f57:	79 9a                	jns    802ef3 <fwrite+0xc2>
+  802f59:	eb cc                	jmp    802f27 <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802f5b:	83 ec 04             	sub    $0x4,%esp
+  802f5e:	57                   	push   %edi
+  802f5f:	6a 0a                	push   $0xa
+  802f61:	ff 75 08             	push   0x8(%ebp)
+  802f64:	e8 ac dd ff ff       	call   800d15 <memfind>
+  802f69:	89 c2                	mov    %eax,%edx
+  802f6b:	89 f8                	mov    %edi,%eax
+  802f6d:	03 45 08             	add    0x8(%ebp),%eax
+  802f70:	83 c4 10             	add    $0x10,%esp
+  802f73:	39 c2                	cmp    %eax,%edx
+  802f75:	74 bd                	je     802f34 <fwrite+0x103>
+		stream_drain(f);
+  802f77:	89 d8                	mov    %ebx,%eax
+  802f79:	e8 a5 f9 ff ff       	call   802923 <stream_drain>
+  802f7e:	eb b4                	jmp    802f34 <fwrite+0x103>
+
+00802f80 <fputc>:
+{
+  802f80:	55                   	push   %ebp
+  802f81:	89 e5                	mov    %esp,%ebp
+  802f83:	53                   	push   %ebx
+  802f84:	83 ec 14             	sub    $0x14,%esp
+  802f87:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  802f8a:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  802f8d:	ff 75 0c             	push   0xc(%ebp)
+  802f90:	6a 01                	push   $0x1
+  802f92:	6a 01                	push   $0x1
+  802f94:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802f97:	50                   	push   %eax
+  802f98:	e8 94 fe ff ff       	call   802e31 <fwrite>
+  802f9d:	83 c4 10             	add    $0x10,%esp
+  802fa0:	0f b6 db             	movzbl %bl,%ebx
+  802fa3:	83 f8 01             	cmp    $0x1,%eax
+  802fa6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802fab:	0f 44 c3             	cmove  %ebx,%eax
+}
+  802fae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802fb1:	c9                   	leave
+  802fb2:	c3                   	ret
+
+00802fb3 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  802fb3:	55                   	push   %ebp
+  802fb4:	89 e5                	mov    %esp,%ebp
+  802fb6:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  802fb9:	ff 75 0c             	push   0xc(%ebp)
+  802fbc:	ff 75 08             	push   0x8(%ebp)
+  802fbf:	e8 bc ff ff ff       	call   802f80 <fputc>
+}
+  802fc4:	83 c4 10             	add    $0x10,%esp
+  802fc7:	c9                   	leave
+  802fc8:	c3                   	ret
+
+00802fc9 <fputs>:
+{
+  802fc9:	55                   	push   %ebp
+  802fca:	89 e5                	mov    %esp,%ebp
+  802fcc:	56                   	push   %esi
+  802fcd:	53                   	push   %ebx
+  802fce:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  802fd1:	83 ec 0c             	sub    $0xc,%esp
+  802fd4:	56                   	push   %esi
+  802fd5:	e8 c9 da ff ff       	call   800aa3 <strlen>
+  802fda:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  802fdc:	ff 75 0c             	push   0xc(%ebp)
+  802fdf:	50                   	push   %eax
+  802fe0:	6a 01                	push   $0x1
+  802fe2:	56                   	push   %esi
+  802fe3:	e8 49 fe ff ff       	call   802e31 <fwrite>
+  802fe8:	83 c4 20             	add    $0x20,%esp
+  802feb:	39 d8                	cmp    %ebx,%eax
+  802fed:	0f 95 c0             	setne  %al
+  802ff0:	0f b6 c0             	movzbl %al,%eax
+  802ff3:	f7 d8                	neg    %eax
+}
+  802ff5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ff8:	5b                   	pop    %ebx
+  802ff9:	5e                   	pop    %esi
+  802ffa:	5d                   	pop    %ebp
+  802ffb:	c3                   	ret
+
+00802ffc <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  802ffc:	55                   	push   %ebp
+  802ffd:	89 e5                	mov    %esp,%ebp
+  802fff:	53                   	push   %ebx
+  803000:	83 ec 04             	sub    $0x4,%esp
+  803003:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  803006:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  803009:	50                   	push   %eax
+  80300a:	ff 75 0c             	push   0xc(%ebp)
+  80300d:	53                   	push   %ebx
+  80300e:	68 b3 2f 80 00       	push   $0x802fb3
+  803013:	e8 d9 d5 ff ff       	call   8005f1 <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  803018:	8b 43 04             	mov    0x4(%ebx),%eax
+  80301b:	c1 e0 1c             	shl    $0x1c,%eax
+  80301e:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  803021:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803024:	c9                   	leave
+  803025:	c3                   	ret
+
+00803026 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  803026:	55                   	push   %ebp
+  803027:	89 e5                	mov    %esp,%ebp
+  803029:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  80302c:	68 e8 51 80 00       	push   $0x8051e8
+  803031:	ff 75 0c             	push   0xc(%ebp)
+  803034:	e8 a5 da ff ff       	call   800ade <strcpy>
+	return 0;
+}
+  803039:	b8 00 00 00 00       	mov    $0x0,%eax
+  80303e:	c9                   	leave
+  80303f:	c3                   	ret
+
+00803040 <devsock_close>:
+{
+  803040:	55                   	push   %ebp
+  803041:	89 e5                	mov    %esp,%ebp
+  803043:	53                   	push   %ebx
+  803044:	83 ec 10             	sub    $0x10,%esp
+  803047:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  80304a:	53                   	push   %ebx
+  80304b:	e8 62 17 00 00       	call   8047b2 <pageref>
+  803050:	89 c2                	mov    %eax,%edx
+  803052:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  803055:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  80305a:	83 fa 01             	cmp    $0x1,%edx
+  80305d:	74 05                	je     803064 <devsock_close+0x24>
+}
+  80305f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803062:	c9                   	leave
+  803063:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  803064:	83 ec 0c             	sub    $0xc,%esp
+  803067:	ff 73 0c             	push   0xc(%ebx)
+  80306a:	e8 b7 02 00 00       	call   803326 <nsipc_close>
+  80306f:	83 c4 10             	add    $0x10,%esp
+  803072:	eb eb                	jmp    80305f <devsock_close+0x1f>
+
+00803074 <devsock_write>:
+{
+  803074:	55                   	push   %ebp
+  803075:	89 e5                	mov    %esp,%ebp
+  803077:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  80307a:	6a 00                	push   $0x0
+  80307c:	ff 75 10             	push   0x10(%ebp)
+  80307f:	ff 75 0c             	push   0xc(%ebp)
+  803082:	8b 45 08             	mov    0x8(%ebp),%eax
+  803085:	ff 70 0c             	push   0xc(%eax)
+  803088:	e8 79 03 00 00       	call   803406 <nsipc_send>
+}
+  80308d:	c9                   	leave
+  80308e:	c3                   	ret
+
+0080308f <devsock_read>:
+{
+  80308f:	55                   	push   %ebp
+  803090:	89 e5                	mov    %esp,%ebp
+  803092:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  803095:	6a 00                	push   $0x0
+  803097:	ff 75 10             	push   0x10(%ebp)
+  80309a:	ff 75 0c             	push   0xc(%ebp)
+  80309d:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030a0:	ff 70 0c             	push   0xc(%eax)
+  8030a3:	e8 ef 02 00 00       	call   803397 <nsipc_recv>
+}
+  8030a8:	c9                   	leave
+  8030a9:	c3                   	ret
+
+008030aa <fd2sockid>:
+{
+  8030aa:	55                   	push   %ebp
+  8030ab:	89 e5                	mov    %esp,%ebp
+  8030ad:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8030b0:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8030b3:	52                   	push   %edx
+  8030b4:	50                   	push   %eax
+  8030b5:	e8 f7 e9 ff ff       	call   801ab1 <fd_lookup>
+  8030ba:	83 c4 10             	add    $0x10,%esp
+  8030bd:	85 c0                	test   %eax,%eax
+  8030bf:	78 10                	js     8030d1 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8030c1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8030c4:	8b 0d 80 62 80 00    	mov    0x806280,%ecx
+  8030ca:	39 08                	cmp    %ecx,(%eax)
+  8030cc:	75 05                	jne    8030d3 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8030ce:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8030d1:	c9                   	leave
+  8030d2:	c3                   	ret
+		return -E_NOT_SUPP;
+  8030d3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8030d8:	eb f7                	jmp    8030d1 <fd2sockid+0x27>
+
+008030da <alloc_sockfd>:
+{
+  8030da:	55                   	push   %ebp
+  8030db:	89 e5                	mov    %esp,%ebp
+  8030dd:	56                   	push   %esi
+  8030de:	53                   	push   %ebx
+  8030df:	83 ec 1c             	sub    $0x1c,%esp
+  8030e2:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8030e4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8030e7:	50                   	push   %eax
+  8030e8:	e8 6e e9 ff ff       	call   801a5b <fd_alloc>
+  8030ed:	89 c3                	mov    %eax,%ebx
+  8030ef:	83 c4 10             	add    $0x10,%esp
+  8030f2:	85 c0                	test   %eax,%eax
+  8030f4:	78 43                	js     803139 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8030f6:	83 ec 04             	sub    $0x4,%esp
+  8030f9:	68 07 04 00 00       	push   $0x407
+  8030fe:	ff 75 f4             	push   -0xc(%ebp)
+  803101:	6a 00                	push   $0x0
+  803103:	e8 14 de ff ff       	call   800f1c <sys_page_alloc>
+  803108:	89 c3                	mov    %eax,%ebx
+  80310a:	83 c4 10             	add    $0x10,%esp
+  80310d:	85 c0                	test   %eax,%eax
+  80310f:	78 28                	js     803139 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  803111:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803114:	8b 15 80 62 80 00    	mov    0x806280,%edx
+  80311a:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  80311c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80311f:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  803126:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  803129:	83 ec 0c             	sub    $0xc,%esp
+  80312c:	50                   	push   %eax
+  80312d:	e8 02 e9 ff ff       	call   801a34 <fd2num>
+  803132:	89 c3                	mov    %eax,%ebx
+  803134:	83 c4 10             	add    $0x10,%esp
+  803137:	eb 0c                	jmp    803145 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  803139:	83 ec 0c             	sub    $0xc,%esp
+  80313c:	56                   	push   %esi
+  80313d:	e8 e4 01 00 00       	call   803326 <nsipc_close>
+		return r;
+  803142:	83 c4 10             	add    $0x10,%esp
+}
+  803145:	89 d8                	mov    %ebx,%eax
+  803147:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80314a:	5b                   	pop    %ebx
+  80314b:	5e                   	pop    %esi
+  80314c:	5d                   	pop    %ebp
+  80314d:	c3                   	ret
+
+0080314e <accept>:
+{
+  80314e:	55                   	push   %ebp
+  80314f:	89 e5                	mov    %esp,%ebp
+  803151:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803154:	8b 45 08             	mov    0x8(%ebp),%eax
+  803157:	e8 4e ff ff ff       	call   8030aa <fd2sockid>
+  80315c:	85 c0                	test   %eax,%eax
+  80315e:	78 1b                	js     80317b <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  803160:	83 ec 04             	sub    $0x4,%esp
+  803163:	ff 75 10             	push   0x10(%ebp)
+  803166:	ff 75 0c             	push   0xc(%ebp)
+  803169:	50                   	push   %eax
+  80316a:	e8 0e 01 00 00       	call   80327d <nsipc_accept>
+  80316f:	83 c4 10             	add    $0x10,%esp
+  803172:	85 c0                	test   %eax,%eax
+  803174:	78 05                	js     80317b <accept+0x2d>
+	return alloc_sockfd(r);
+  803176:	e8 5f ff ff ff       	call   8030da <alloc_sockfd>
+}
+  80317b:	c9                   	leave
+  80317c:	c3                   	ret
+
+0080317d <bind>:
+{
+  80317d:	55                   	push   %ebp
+  80317e:	89 e5                	mov    %esp,%ebp
+  803180:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803183:	8b 45 08             	mov    0x8(%ebp),%eax
+  803186:	e8 1f ff ff ff       	call   8030aa <fd2sockid>
+  80318b:	85 c0                	test   %eax,%eax
+  80318d:	78 12                	js     8031a1 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80318f:	83 ec 04             	sub    $0x4,%esp
+  803192:	ff 75 10             	push   0x10(%ebp)
+  803195:	ff 75 0c             	push   0xc(%ebp)
+  803198:	50                   	push   %eax
+  803199:	e8 31 01 00 00       	call   8032cf <nsipc_bind>
+  80319e:	83 c4 10             	add    $0x10,%esp
+}
+  8031a1:	c9                   	leave
+  8031a2:	c3                   	ret
+
+008031a3 <shutdown>:
+{
+  8031a3:	55                   	push   %ebp
+  8031a4:	89 e5                	mov    %esp,%ebp
+  8031a6:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8031a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031ac:	e8 f9 fe ff ff       	call   8030aa <fd2sockid>
+  8031b1:	85 c0                	test   %eax,%eax
+  8031b3:	78 0f                	js     8031c4 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8031b5:	83 ec 08             	sub    $0x8,%esp
+  8031b8:	ff 75 0c             	push   0xc(%ebp)
+  8031bb:	50                   	push   %eax
+  8031bc:	e8 43 01 00 00       	call   803304 <nsipc_shutdown>
+  8031c1:	83 c4 10             	add    $0x10,%esp
+}
+  8031c4:	c9                   	leave
+  8031c5:	c3                   	ret
+
+008031c6 <connect>:
+{
+  8031c6:	55                   	push   %ebp
+  8031c7:	89 e5                	mov    %esp,%ebp
+  8031c9:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8031cc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031cf:	e8 d6 fe ff ff       	call   8030aa <fd2sockid>
+  8031d4:	85 c0                	test   %eax,%eax
+  8031d6:	78 12                	js     8031ea <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8031d8:	83 ec 04             	sub    $0x4,%esp
+  8031db:	ff 75 10             	push   0x10(%ebp)
+  8031de:	ff 75 0c             	push   0xc(%ebp)
+  8031e1:	50                   	push   %eax
+  8031e2:	e8 59 01 00 00       	call   803340 <nsipc_connect>
+  8031e7:	83 c4 10             	add    $0x10,%esp
+}
+  8031ea:	c9                   	leave
+  8031eb:	c3                   	ret
+
+008031ec <listen>:
+{
+  8031ec:	55                   	push   %ebp
+  8031ed:	89 e5                	mov    %esp,%ebp
+  8031ef:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8031f2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031f5:	e8 b0 fe ff ff       	call   8030aa <fd2sockid>
+  8031fa:	85 c0                	test   %eax,%eax
+  8031fc:	78 0f                	js     80320d <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8031fe:	83 ec 08             	sub    $0x8,%esp
+  803201:	ff 75 0c             	push   0xc(%ebp)
+  803204:	50                   	push   %eax
+  803205:	e8 6b 01 00 00       	call   803375 <nsipc_listen>
+  80320a:	83 c4 10             	add    $0x10,%esp
+}
+  80320d:	c9                   	leave
+  80320e:	c3                   	ret
+
+0080320f <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80320f:	55                   	push   %ebp
+  803210:	89 e5                	mov    %esp,%ebp
+  803212:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  803215:	ff 75 10             	push   0x10(%ebp)
+  803218:	ff 75 0c             	push   0xc(%ebp)
+  80321b:	ff 75 08             	push   0x8(%ebp)
+  80321e:	e8 41 02 00 00       	call   803464 <nsipc_socket>
+  803223:	83 c4 10             	add    $0x10,%esp
+  803226:	85 c0                	test   %eax,%eax
+  803228:	78 05                	js     80322f <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  80322a:	e8 ab fe ff ff       	call   8030da <alloc_sockfd>
+}
+  80322f:	c9                   	leave
+  803230:	c3                   	ret
+
+00803231 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  803231:	55                   	push   %ebp
+  803232:	89 e5                	mov    %esp,%ebp
+  803234:	53                   	push   %ebx
+  803235:	83 ec 04             	sub    $0x4,%esp
+  803238:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  80323a:	83 3d 08 70 80 00 00 	cmpl   $0x0,0x807008
+  803241:	74 26                	je     803269 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  803243:	6a 07                	push   $0x7
+  803245:	68 00 90 80 00       	push   $0x809000
+  80324a:	53                   	push   %ebx
+  80324b:	ff 35 08 70 80 00    	push   0x807008
+  803251:	e8 c7 14 00 00       	call   80471d <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  803256:	83 c4 0c             	add    $0xc,%esp
+  803259:	6a 00                	push   $0x0
+  80325b:	6a 00                	push   $0x0
+  80325d:	6a 00                	push   $0x0
+  80325f:	e8 c3 13 00 00       	call   804627 <ipc_recv>
+}
+  803264:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803267:	c9                   	leave
+  803268:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  803269:	83 ec 0c             	sub    $0xc,%esp
+  80326c:	6a 02                	push   $0x2
+  80326e:	e8 00 15 00 00       	call   804773 <ipc_find_env>
+  803273:	a3 08 70 80 00       	mov    %eax,0x807008
+  803278:	83 c4 10             	add    $0x10,%esp
+  80327b:	eb c6                	jmp    803243 <nsipc+0x12>
+
+0080327d <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  80327d:	55                   	push   %ebp
+  80327e:	89 e5                	mov    %esp,%ebp
+  803280:	56                   	push   %esi
+  803281:	53                   	push   %ebx
+  803282:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  803285:	8b 45 08             	mov    0x8(%ebp),%eax
+  803288:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  80328d:	8b 06                	mov    (%esi),%eax
+  80328f:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  803294:	b8 01 00 00 00       	mov    $0x1,%eax
+  803299:	e8 93 ff ff ff       	call   803231 <nsipc>
+  80329e:	89 c3                	mov    %eax,%ebx
+  8032a0:	85 c0                	test   %eax,%eax
+  8032a2:	79 09                	jns    8032ad <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8032a4:	89 d8                	mov    %ebx,%eax
+  8032a6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032a9:	5b                   	pop    %ebx
+  8032aa:	5e                   	pop    %esi
+  8032ab:	5d                   	pop    %ebp
+  8032ac:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8032ad:	83 ec 04             	sub    $0x4,%esp
+  8032b0:	ff 35 10 90 80 00    	push   0x809010
+  8032b6:	68 00 90 80 00       	push   $0x809000
+  8032bb:	ff 75 0c             	push   0xc(%ebp)
+  8032be:	e8 a1 d9 ff ff       	call   800c64 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8032c3:	a1 10 90 80 00       	mov    0x809010,%eax
+  8032c8:	89 06                	mov    %eax,(%esi)
+  8032ca:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8032cd:	eb d5                	jmp    8032a4 <nsipc_accept+0x27>
+
+008032cf <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8032cf:	55                   	push   %ebp
+  8032d0:	89 e5                	mov    %esp,%ebp
+  8032d2:	53                   	push   %ebx
+  8032d3:	83 ec 08             	sub    $0x8,%esp
+  8032d6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8032d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032dc:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8032e1:	53                   	push   %ebx
+  8032e2:	ff 75 0c             	push   0xc(%ebp)
+  8032e5:	68 04 90 80 00       	push   $0x809004
+  8032ea:	e8 75 d9 ff ff       	call   800c64 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8032ef:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  8032f5:	b8 02 00 00 00       	mov    $0x2,%eax
+  8032fa:	e8 32 ff ff ff       	call   803231 <nsipc>
+}
+  8032ff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803302:	c9                   	leave
+  803303:	c3                   	ret
+
+00803304 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  803304:	55                   	push   %ebp
+  803305:	89 e5                	mov    %esp,%ebp
+  803307:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  80330a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80330d:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  803312:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803315:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  80331a:	b8 03 00 00 00       	mov    $0x3,%eax
+  80331f:	e8 0d ff ff ff       	call   803231 <nsipc>
+}
+  803324:	c9                   	leave
+  803325:	c3                   	ret
+
+00803326 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  803326:	55                   	push   %ebp
+  803327:	89 e5                	mov    %esp,%ebp
+  803329:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  80332c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80332f:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  803334:	b8 04 00 00 00       	mov    $0x4,%eax
+  803339:	e8 f3 fe ff ff       	call   803231 <nsipc>
+}
+  80333e:	c9                   	leave
+  80333f:	c3                   	ret
+
+00803340 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  803340:	55                   	push   %ebp
+  803341:	89 e5                	mov    %esp,%ebp
+  803343:	53                   	push   %ebx
+  803344:	83 ec 08             	sub    $0x8,%esp
+  803347:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  80334a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80334d:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  803352:	53                   	push   %ebx
+  803353:	ff 75 0c             	push   0xc(%ebp)
+  803356:	68 04 90 80 00       	push   $0x809004
+  80335b:	e8 04 d9 ff ff       	call   800c64 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  803360:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  803366:	b8 05 00 00 00       	mov    $0x5,%eax
+  80336b:	e8 c1 fe ff ff       	call   803231 <nsipc>
+}
+  803370:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803373:	c9                   	leave
+  803374:	c3                   	ret
+
+00803375 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  803375:	55                   	push   %ebp
+  803376:	89 e5                	mov    %esp,%ebp
+  803378:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  80337b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80337e:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  803383:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803386:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  80338b:	b8 06 00 00 00       	mov    $0x6,%eax
+  803390:	e8 9c fe ff ff       	call   803231 <nsipc>
+}
+  803395:	c9                   	leave
+  803396:	c3                   	ret
+
+00803397 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  803397:	55                   	push   %ebp
+  803398:	89 e5                	mov    %esp,%ebp
+  80339a:	56                   	push   %esi
+  80339b:	53                   	push   %ebx
+  80339c:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80339f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033a2:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  8033a7:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  8033ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8033b0:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8033b5:	b8 07 00 00 00       	mov    $0x7,%eax
+  8033ba:	e8 72 fe ff ff       	call   803231 <nsipc>
+  8033bf:	89 c3                	mov    %eax,%ebx
+  8033c1:	85 c0                	test   %eax,%eax
+  8033c3:	78 22                	js     8033e7 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8033c5:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8033ca:	39 c6                	cmp    %eax,%esi
+  8033cc:	0f 4e c6             	cmovle %esi,%eax
+  8033cf:	39 c3                	cmp    %eax,%ebx
+  8033d1:	7f 1d                	jg     8033f0 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8033d3:	83 ec 04             	sub    $0x4,%esp
+  8033d6:	53                   	push   %ebx
+  8033d7:	68 00 90 80 00       	push   $0x809000
+  8033dc:	ff 75 0c             	push   0xc(%ebp)
+  8033df:	e8 80 d8 ff ff       	call   800c64 <memmove>
+  8033e4:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8033e7:	89 d8                	mov    %ebx,%eax
+  8033e9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8033ec:	5b                   	pop    %ebx
+  8033ed:	5e                   	pop    %esi
+  8033ee:	5d                   	pop    %ebp
+  8033ef:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8033f0:	68 f4 51 80 00       	push   $0x8051f4
+  8033f5:	68 f1 50 80 00       	push   $0x8050f1
+  8033fa:	6a 62                	push   $0x62
+  8033fc:	68 09 52 80 00       	push   $0x805209
+  803401:	e8 19 d0 ff ff       	call   80041f <_panic>
+
+00803406 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  803406:	55                   	push   %ebp
+  803407:	89 e5                	mov    %esp,%ebp
+  803409:	53                   	push   %ebx
+  80340a:	83 ec 04             	sub    $0x4,%esp
+  80340d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  803410:	8b 45 08             	mov    0x8(%ebp),%eax
+  803413:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  803418:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80341e:	7f 2e                	jg     80344e <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  803420:	83 ec 04             	sub    $0x4,%esp
+  803423:	53                   	push   %ebx
+  803424:	ff 75 0c             	push   0xc(%ebp)
+  803427:	68 0c 90 80 00       	push   $0x80900c
+  80342c:	e8 33 d8 ff ff       	call   800c64 <memmove>
+	nsipcbuf.send.req_size = size;
+  803431:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  803437:	8b 45 14             	mov    0x14(%ebp),%eax
+  80343a:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  80343f:	b8 08 00 00 00       	mov    $0x8,%eax
+  803444:	e8 e8 fd ff ff       	call   803231 <nsipc>
+}
+  803449:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80344c:	c9                   	leave
+  80344d:	c3                   	ret
+	assert(size < 1600);
+  80344e:	68 15 52 80 00       	push   $0x805215
+  803453:	68 f1 50 80 00       	push   $0x8050f1
+  803458:	6a 6d                	push   $0x6d
+  80345a:	68 09 52 80 00       	push   $0x805209
+  80345f:	e8 bb cf ff ff       	call   80041f <_panic>
+
+00803464 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  803464:	55                   	push   %ebp
+  803465:	89 e5                	mov    %esp,%ebp
+  803467:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  80346a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80346d:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  803472:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803475:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  80347a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80347d:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  803482:	b8 09 00 00 00       	mov    $0x9,%eax
+  803487:	e8 a5 fd ff ff       	call   803231 <nsipc>
+}
+  80348c:	c9                   	leave
+  80348d:	c3                   	ret
+
+0080348e <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  80348e:	55                   	push   %ebp
+  80348f:	89 e5                	mov    %esp,%ebp
+  803491:	53                   	push   %ebx
+  803492:	83 ec 10             	sub    $0x10,%esp
+  803495:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  803498:	68 0c 70 80 00       	push   $0x80700c
+  80349d:	e8 a1 07 00 00       	call   803c43 <mutex_lock>
+	if (v == 0)
+  8034a2:	83 c4 10             	add    $0x10,%esp
+  8034a5:	85 db                	test   %ebx,%ebx
+  8034a7:	0f 84 85 00 00 00    	je     803532 <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  8034ad:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  8034b3:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  8034b8:	77 51                	ja     80350b <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  8034ba:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  8034c0:	89 d8                	mov    %ebx,%eax
+  8034c2:	c1 e8 0c             	shr    $0xc,%eax
+  8034c5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8034cc:	f6 c4 02             	test   $0x2,%ah
+  8034cf:	74 50                	je     803521 <free+0x93>
+		sys_page_unmap(0, c);
+  8034d1:	83 ec 08             	sub    $0x8,%esp
+  8034d4:	53                   	push   %ebx
+  8034d5:	6a 00                	push   $0x0
+  8034d7:	e8 d9 da ff ff       	call   800fb5 <sys_page_unmap>
+		c += PGSIZE;
+  8034dc:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  8034e2:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  8034e8:	83 c4 10             	add    $0x10,%esp
+  8034eb:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  8034f0:	76 ce                	jbe    8034c0 <free+0x32>
+  8034f2:	68 5f 52 80 00       	push   $0x80525f
+  8034f7:	68 f1 50 80 00       	push   $0x8050f1
+  8034fc:	68 82 00 00 00       	push   $0x82
+  803501:	68 52 52 80 00       	push   $0x805252
+  803506:	e8 14 cf ff ff       	call   80041f <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  80350b:	68 24 52 80 00       	push   $0x805224
+  803510:	68 f1 50 80 00       	push   $0x8050f1
+  803515:	6a 7b                	push   $0x7b
+  803517:	68 52 52 80 00       	push   $0x805252
+  80351c:	e8 fe ce ff ff       	call   80041f <_panic>
+	if (--(*ref) == 0)
+  803521:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  803527:	83 e8 01             	sub    $0x1,%eax
+  80352a:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  803530:	74 15                	je     803547 <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  803532:	83 ec 0c             	sub    $0xc,%esp
+  803535:	68 0c 70 80 00       	push   $0x80700c
+  80353a:	e8 71 07 00 00       	call   803cb0 <mutex_unlock>
+}
+  80353f:	83 c4 10             	add    $0x10,%esp
+  803542:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803545:	c9                   	leave
+  803546:	c3                   	ret
+		sys_page_unmap(0, c);
+  803547:	83 ec 08             	sub    $0x8,%esp
+  80354a:	53                   	push   %ebx
+  80354b:	6a 00                	push   $0x0
+  80354d:	e8 63 da ff ff       	call   800fb5 <sys_page_unmap>
+  803552:	83 c4 10             	add    $0x10,%esp
+  803555:	eb db                	jmp    803532 <free+0xa4>
+
+00803557 <malloc>:
+{
+  803557:	55                   	push   %ebp
+  803558:	89 e5                	mov    %esp,%ebp
+  80355a:	57                   	push   %edi
+  80355b:	56                   	push   %esi
+  80355c:	53                   	push   %ebx
+  80355d:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  803560:	68 0c 70 80 00       	push   $0x80700c
+  803565:	e8 d9 06 00 00       	call   803c43 <mutex_lock>
+	if (mptr == 0)
+  80356a:	8b 3d 10 70 80 00    	mov    0x807010,%edi
+  803570:	83 c4 10             	add    $0x10,%esp
+  803573:	85 ff                	test   %edi,%edi
+  803575:	74 6c                	je     8035e3 <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  803577:	8b 45 08             	mov    0x8(%ebp),%eax
+  80357a:	83 c0 03             	add    $0x3,%eax
+  80357d:	83 e0 fc             	and    $0xfffffffc,%eax
+  803580:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  803582:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  803587:	0f 87 64 01 00 00    	ja     8036f1 <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  80358d:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803593:	74 30                	je     8035c5 <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  803595:	89 f9                	mov    %edi,%ecx
+  803597:	c1 e9 0c             	shr    $0xc,%ecx
+  80359a:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  80359e:	c1 e8 0c             	shr    $0xc,%eax
+  8035a1:	39 c1                	cmp    %eax,%ecx
+  8035a3:	74 5f                	je     803604 <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  8035a5:	83 ec 0c             	sub    $0xc,%esp
+  8035a8:	57                   	push   %edi
+  8035a9:	e8 e0 fe ff ff       	call   80348e <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  8035ae:	a1 10 70 80 00       	mov    0x807010,%eax
+  8035b3:	05 00 10 00 00       	add    $0x1000,%eax
+  8035b8:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8035bd:	a3 10 70 80 00       	mov    %eax,0x807010
+  8035c2:	83 c4 10             	add    $0x10,%esp
+  8035c5:	8b 0d 10 70 80 00    	mov    0x807010,%ecx
+{
+  8035cb:	ba 02 00 00 00       	mov    $0x2,%edx
+  8035d0:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  8035d4:	8d 7e 04             	lea    0x4(%esi),%edi
+  8035d7:	89 cb                	mov    %ecx,%ebx
+  8035d9:	01 f9                	add    %edi,%ecx
+  8035db:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8035de:	e9 8b 00 00 00       	jmp    80366e <malloc+0x117>
+		mptr = mbegin;
+  8035e3:	c7 05 10 70 80 00 00 	movl   $0x8000000,0x807010
+  8035ea:	00 00 08 
+	n = ROUNDUP(n, 4);
+  8035ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035f0:	83 c0 03             	add    $0x3,%eax
+  8035f3:	83 e0 fc             	and    $0xfffffffc,%eax
+  8035f6:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  8035f8:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  8035fd:	76 c6                	jbe    8035c5 <malloc+0x6e>
+  8035ff:	e9 d6 00 00 00       	jmp    8036da <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  803604:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  80360a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  80360f:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  803613:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  803616:	a3 10 70 80 00       	mov    %eax,0x807010
+			return v;
+  80361b:	e9 ba 00 00 00       	jmp    8036da <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  803620:	05 00 10 00 00       	add    $0x1000,%eax
+  803625:	39 c8                	cmp    %ecx,%eax
+  803627:	0f 83 cb 00 00 00    	jae    8036f8 <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  80362d:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  803632:	77 22                	ja     803656 <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  803634:	89 c2                	mov    %eax,%edx
+  803636:	c1 ea 16             	shr    $0x16,%edx
+  803639:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  803640:	f6 c2 01             	test   $0x1,%dl
+  803643:	74 db                	je     803620 <malloc+0xc9>
+  803645:	89 c2                	mov    %eax,%edx
+  803647:	c1 ea 0c             	shr    $0xc,%edx
+  80364a:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  803651:	f6 c2 01             	test   $0x1,%dl
+  803654:	74 ca                	je     803620 <malloc+0xc9>
+		if (mptr == mend) {
+  803656:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80365c:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  803662:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  803666:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  80366c:	74 04                	je     803672 <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  80366e:	89 d8                	mov    %ebx,%eax
+  803670:	eb b3                	jmp    803625 <malloc+0xce>
+  803672:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  803675:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  80367a:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  80367e:	83 ea 01             	sub    $0x1,%edx
+  803681:	0f 85 50 ff ff ff    	jne    8035d7 <malloc+0x80>
+  803687:	c7 05 10 70 80 00 00 	movl   $0x8000000,0x807010
+  80368e:	00 00 08 
+				return 0;	/* out of address space */
+  803691:	bf 00 00 00 00       	mov    $0x0,%edi
+  803696:	eb 42                	jmp    8036da <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  803698:	85 db                	test   %ebx,%ebx
+  80369a:	78 1e                	js     8036ba <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  80369c:	83 ec 08             	sub    $0x8,%esp
+  80369f:	89 d8                	mov    %ebx,%eax
+  8036a1:	03 05 10 70 80 00    	add    0x807010,%eax
+  8036a7:	50                   	push   %eax
+  8036a8:	6a 00                	push   $0x0
+  8036aa:	e8 06 d9 ff ff       	call   800fb5 <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  8036af:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  8036b5:	83 c4 10             	add    $0x10,%esp
+  8036b8:	eb de                	jmp    803698 <malloc+0x141>
+			return 0;	/* out of physical memory */
+  8036ba:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036bf:	eb 19                	jmp    8036da <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  8036c1:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8036c4:	8b 3d 10 70 80 00    	mov    0x807010,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  8036ca:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  8036d1:	00 
+	mptr += n;
+  8036d2:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  8036d5:	a3 10 70 80 00       	mov    %eax,0x807010
+	mutex_unlock(&malloc_mu);
+  8036da:	83 ec 0c             	sub    $0xc,%esp
+  8036dd:	68 0c 70 80 00       	push   $0x80700c
+  8036e2:	e8 c9 05 00 00       	call   803cb0 <mutex_unlock>
+}
+  8036e7:	89 f8                	mov    %edi,%eax
+  8036e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036ec:	5b                   	pop    %ebx
+  8036ed:	5e                   	pop    %esi
+  8036ee:	5f                   	pop    %edi
+  8036ef:	5d                   	pop    %ebp
+  8036f0:	c3                   	ret
+		return 0;
+  8036f1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036f6:	eb e2                	jmp    8036da <malloc+0x183>
+  8036f8:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  8036fc:	74 06                	je     803704 <malloc+0x1ad>
+  8036fe:	89 1d 10 70 80 00    	mov    %ebx,0x807010
+	for (i = 0; i < n + 4; i += PGSIZE){
+  803704:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803709:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  80370c:	39 fb                	cmp    %edi,%ebx
+  80370e:	73 b1                	jae    8036c1 <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  803710:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  803716:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  803719:	39 fe                	cmp    %edi,%esi
+  80371b:	0f 92 c0             	setb   %al
+  80371e:	0f b6 c0             	movzbl %al,%eax
+  803721:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  803724:	83 c8 07             	or     $0x7,%eax
+  803727:	50                   	push   %eax
+  803728:	89 d8                	mov    %ebx,%eax
+  80372a:	03 05 10 70 80 00    	add    0x807010,%eax
+  803730:	50                   	push   %eax
+  803731:	6a 00                	push   $0x0
+  803733:	e8 e4 d7 ff ff       	call   800f1c <sys_page_alloc>
+  803738:	83 c4 10             	add    $0x10,%esp
+  80373b:	85 c0                	test   %eax,%eax
+  80373d:	0f 88 55 ff ff ff    	js     803698 <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  803743:	89 f3                	mov    %esi,%ebx
+  803745:	eb c5                	jmp    80370c <malloc+0x1b5>
+
+00803747 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  803747:	55                   	push   %ebp
+  803748:	89 e5                	mov    %esp,%ebp
+  80374a:	56                   	push   %esi
+  80374b:	53                   	push   %ebx
+  80374c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80374f:	83 ec 0c             	sub    $0xc,%esp
+  803752:	ff 75 08             	push   0x8(%ebp)
+  803755:	e8 ea e2 ff ff       	call   801a44 <fd2data>
+  80375a:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80375c:	83 c4 08             	add    $0x8,%esp
+  80375f:	68 77 52 80 00       	push   $0x805277
+  803764:	53                   	push   %ebx
+  803765:	e8 74 d3 ff ff       	call   800ade <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  80376a:	8b 46 04             	mov    0x4(%esi),%eax
+  80376d:	2b 06                	sub    (%esi),%eax
+  80376f:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  803775:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80377c:	00 00 00 
+	stat->st_dev = &devpipe;
+  80377f:	c7 83 88 00 00 00 9c 	movl   $0x80629c,0x88(%ebx)
+  803786:	62 80 00 
+	return 0;
+}
+  803789:	b8 00 00 00 00       	mov    $0x0,%eax
+  80378e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803791:	5b                   	pop    %ebx
+  803792:	5e                   	pop    %esi
+  803793:	5d                   	pop    %ebp
+  803794:	c3                   	ret
+
+00803795 <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  803795:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80379a:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  80379e:	85 c9                	test   %ecx,%ecx
+  8037a0:	75 01                	jne    8037a3 <pipewake+0xe>
+  8037a2:	c3                   	ret
+{
+  8037a3:	55                   	push   %ebp
+  8037a4:	89 e5                	mov    %esp,%ebp
+  8037a6:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  8037a9:	68 00 04 00 00       	push   $0x400
+  8037ae:	52                   	push   %edx
+  8037af:	e8 ac da ff ff       	call   801260 <sys_futex_wake>
+  8037b4:	83 c4 10             	add    $0x10,%esp
+}
+  8037b7:	c9                   	leave
+  8037b8:	c3                   	ret
+
+008037b9 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8037b9:	55                   	push   %ebp
+  8037ba:	89 e5                	mov    %esp,%ebp
+  8037bc:	56                   	push   %esi
+  8037bd:	53                   	push   %ebx
+  8037be:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8037c1:	83 ec 0c             	sub    $0xc,%esp
+  8037c4:	56                   	push   %esi
+  8037c5:	e8 7a e2 ff ff       	call   801a44 <fd2data>
+  8037ca:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  8037cc:	83 c4 08             	add    $0x8,%esp
+  8037cf:	56                   	push   %esi
+  8037d0:	6a 00                	push   $0x0
+  8037d2:	e8 de d7 ff ff       	call   800fb5 <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  8037d7:	8d 53 04             	lea    0x4(%ebx),%edx
+  8037da:	8d 43 08             	lea    0x8(%ebx),%eax
+  8037dd:	e8 b3 ff ff ff       	call   803795 <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  8037e2:	8d 43 0c             	lea    0xc(%ebx),%eax
+  8037e5:	89 da                	mov    %ebx,%edx
+  8037e7:	e8 a9 ff ff ff       	call   803795 <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  8037ec:	89 34 24             	mov    %esi,(%esp)
+  8037ef:	e8 50 e2 ff ff       	call   801a44 <fd2data>
+  8037f4:	83 c4 08             	add    $0x8,%esp
+  8037f7:	50                   	push   %eax
+  8037f8:	6a 00                	push   $0x0
+  8037fa:	e8 b6 d7 ff ff       	call   800fb5 <sys_page_unmap>
+}
+  8037ff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803802:	5b                   	pop    %ebx
+  803803:	5e                   	pop    %esi
+  803804:	5d                   	pop    %ebp
+  803805:	c3                   	ret
+
+00803806 <_pipeisclosed>:
+{
+  803806:	55                   	push   %ebp
+  803807:	89 e5                	mov    %esp,%ebp
+  803809:	57                   	push   %edi
+  80380a:	56                   	push   %esi
+  80380b:	53                   	push   %ebx
+  80380c:	83 ec 1c             	sub    $0x1c,%esp
+  80380f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803812:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803814:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  803819:	eb 5d                	jmp    803878 <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  80381b:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		n = thisenv->env_runs;
+  803821:	8b 02                	mov    (%edx),%eax
+  803823:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  803826:	83 ec 0c             	sub    $0xc,%esp
+  803829:	ff 75 e0             	push   -0x20(%ebp)
+  80382c:	e8 81 0f 00 00       	call   8047b2 <pageref>
+  803831:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803834:	89 3c 24             	mov    %edi,(%esp)
+  803837:	e8 76 0f 00 00       	call   8047b2 <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  80383c:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80383e:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  803844:	83 c4 10             	add    $0x10,%esp
+  803847:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  80384d:	77 15                	ja     803864 <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80384f:	89 f2                	mov    %esi,%edx
+  803851:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  803853:	c1 ea 10             	shr    $0x10,%edx
+  803856:	74 0c                	je     803864 <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803858:	c1 e2 10             	shl    $0x10,%edx
+  80385b:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  803860:	29 d1                	sub    %edx,%ecx
+  803862:	eb 06                	jmp    80386a <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  803864:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		nn = thisenv->env_runs;
+  80386a:	8b 11                	mov    (%ecx),%edx
+  80386c:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  80386f:	39 d3                	cmp    %edx,%ebx
+  803871:	74 6e                	je     8038e1 <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  803873:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803876:	74 24                	je     80389c <_pipeisclosed+0x96>
+  803878:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80387a:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803880:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803885:	77 94                	ja     80381b <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803887:	89 f0                	mov    %esi,%eax
+  803889:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80388b:	c1 e8 10             	shr    $0x10,%eax
+  80388e:	74 8b                	je     80381b <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803890:	c1 e0 10             	shl    $0x10,%eax
+  803893:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803898:	29 c2                	sub    %eax,%edx
+  80389a:	eb 85                	jmp    803821 <_pipeisclosed+0x1b>
+  80389c:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80389e:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8038a4:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8038a9:	77 18                	ja     8038c3 <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8038ab:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8038b0:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8038b2:	c1 e8 10             	shr    $0x10,%eax
+  8038b5:	74 0c                	je     8038c3 <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8038b7:	c1 e0 10             	shl    $0x10,%eax
+  8038ba:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8038bf:	29 c2                	sub    %eax,%edx
+  8038c1:	eb 06                	jmp    8038c9 <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  8038c3:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8038c9:	8b 02                	mov    (%edx),%eax
+  8038cb:	8b 40 58             	mov    0x58(%eax),%eax
+  8038ce:	6a 01                	push   $0x1
+  8038d0:	50                   	push   %eax
+  8038d1:	53                   	push   %ebx
+  8038d2:	68 7e 52 80 00       	push   $0x80527e
+  8038d7:	e8 1e cc ff ff       	call   8004fa <cprintf>
+  8038dc:	83 c4 10             	add    $0x10,%esp
+  8038df:	eb 97                	jmp    803878 <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  8038e1:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8038e4:	0f 94 c0             	sete   %al
+  8038e7:	0f b6 c0             	movzbl %al,%eax
+}
+  8038ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8038ed:	5b                   	pop    %ebx
+  8038ee:	5e                   	pop    %esi
+  8038ef:	5f                   	pop    %edi
+  8038f0:	5d                   	pop    %ebp
+  8038f1:	c3                   	ret
+
+008038f2 <devpipe_write>:
+{
+  8038f2:	55                   	push   %ebp
+  8038f3:	89 e5                	mov    %esp,%ebp
+  8038f5:	57                   	push   %edi
+  8038f6:	56                   	push   %esi
+  8038f7:	53                   	push   %ebx
+  8038f8:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  8038fb:	ff 75 08             	push   0x8(%ebp)
+  8038fe:	e8 41 e1 ff ff       	call   801a44 <fd2data>
+  803903:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803905:	83 c4 10             	add    $0x10,%esp
+  803908:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  80390f:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  803912:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803915:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803918:	0f 84 96 00 00 00    	je     8039b4 <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  80391e:	8d 73 08             	lea    0x8(%ebx),%esi
+  803921:	eb 32                	jmp    803955 <devpipe_write+0x63>
+  803923:	89 fa                	mov    %edi,%edx
+  803925:	89 f0                	mov    %esi,%eax
+  803927:	e8 69 fe ff ff       	call   803795 <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  80392c:	8b 43 04             	mov    0x4(%ebx),%eax
+  80392f:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  803932:	ba 01 00 00 00       	mov    $0x1,%edx
+  803937:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  80393c:	83 ec 04             	sub    $0x4,%esp
+  80393f:	6a 0a                	push   $0xa
+  803941:	50                   	push   %eax
+  803942:	53                   	push   %ebx
+  803943:	e8 e9 d8 ff ff       	call   801231 <sys_futex_wait>
+  803948:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80394d:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  803952:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  803955:	8b 43 04             	mov    0x4(%ebx),%eax
+  803958:	8b 0b                	mov    (%ebx),%ecx
+  80395a:	8d 51 20             	lea    0x20(%ecx),%edx
+  80395d:	39 d0                	cmp    %edx,%eax
+  80395f:	72 1b                	jb     80397c <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  803961:	89 da                	mov    %ebx,%edx
+  803963:	8b 45 08             	mov    0x8(%ebp),%eax
+  803966:	e8 9b fe ff ff       	call   803806 <_pipeisclosed>
+  80396b:	85 c0                	test   %eax,%eax
+  80396d:	74 b4                	je     803923 <devpipe_write+0x31>
+				return 0;
+  80396f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803974:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803977:	5b                   	pop    %ebx
+  803978:	5e                   	pop    %esi
+  803979:	5f                   	pop    %edi
+  80397a:	5d                   	pop    %ebp
+  80397b:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80397c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80397f:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803982:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  803986:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  803989:	89 c2                	mov    %eax,%edx
+  80398b:	c1 fa 1f             	sar    $0x1f,%edx
+  80398e:	89 d1                	mov    %edx,%ecx
+  803990:	c1 e9 1b             	shr    $0x1b,%ecx
+  803993:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  803996:	83 e2 1f             	and    $0x1f,%edx
+  803999:	29 ca                	sub    %ecx,%edx
+  80399b:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  80399f:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  8039a3:	83 c0 01             	add    $0x1,%eax
+  8039a6:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8039a9:	83 c6 01             	add    $0x1,%esi
+  8039ac:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8039af:	e9 5e ff ff ff       	jmp    803912 <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  8039b4:	8d 53 04             	lea    0x4(%ebx),%edx
+  8039b7:	8d 43 08             	lea    0x8(%ebx),%eax
+  8039ba:	e8 d6 fd ff ff       	call   803795 <pipewake>
+	return i;
+  8039bf:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8039c2:	eb b0                	jmp    803974 <devpipe_write+0x82>
+
+008039c4 <devpipe_read>:
+{
+  8039c4:	55                   	push   %ebp
+  8039c5:	89 e5                	mov    %esp,%ebp
+  8039c7:	57                   	push   %edi
+  8039c8:	56                   	push   %esi
+  8039c9:	53                   	push   %ebx
+  8039ca:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  8039cd:	ff 75 08             	push   0x8(%ebp)
+  8039d0:	e8 6f e0 ff ff       	call   801a44 <fd2data>
+  8039d5:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8039d7:	83 c4 10             	add    $0x10,%esp
+  8039da:	be 00 00 00 00       	mov    $0x0,%esi
+  8039df:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8039e2:	74 6c                	je     803a50 <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  8039e4:	8d 7b 04             	lea    0x4(%ebx),%edi
+  8039e7:	eb 25                	jmp    803a0e <devpipe_read+0x4a>
+  8039e9:	8b 13                	mov    (%ebx),%edx
+  8039eb:	b8 01 00 00 00       	mov    $0x1,%eax
+  8039f0:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  8039f5:	83 ec 04             	sub    $0x4,%esp
+  8039f8:	6a 0a                	push   $0xa
+  8039fa:	52                   	push   %edx
+  8039fb:	57                   	push   %edi
+  8039fc:	e8 30 d8 ff ff       	call   801231 <sys_futex_wait>
+  803a01:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803a06:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  803a0b:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  803a0e:	8b 03                	mov    (%ebx),%eax
+  803a10:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803a13:	75 19                	jne    803a2e <devpipe_read+0x6a>
+			if (i > 0)
+  803a15:	85 f6                	test   %esi,%esi
+  803a17:	75 3a                	jne    803a53 <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  803a19:	89 da                	mov    %ebx,%edx
+  803a1b:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a1e:	e8 e3 fd ff ff       	call   803806 <_pipeisclosed>
+  803a23:	85 c0                	test   %eax,%eax
+  803a25:	74 c2                	je     8039e9 <devpipe_read+0x25>
+				return 0;
+  803a27:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a2c:	eb 31                	jmp    803a5f <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803a2e:	89 c1                	mov    %eax,%ecx
+  803a30:	c1 f9 1f             	sar    $0x1f,%ecx
+  803a33:	c1 e9 1b             	shr    $0x1b,%ecx
+  803a36:	01 c8                	add    %ecx,%eax
+  803a38:	83 e0 1f             	and    $0x1f,%eax
+  803a3b:	29 c8                	sub    %ecx,%eax
+  803a3d:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  803a42:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803a45:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  803a48:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  803a4b:	83 c6 01             	add    $0x1,%esi
+  803a4e:	eb 8f                	jmp    8039df <devpipe_read+0x1b>
+out:
+  803a50:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  803a53:	8d 43 0c             	lea    0xc(%ebx),%eax
+  803a56:	89 da                	mov    %ebx,%edx
+  803a58:	e8 38 fd ff ff       	call   803795 <pipewake>
+	return i;
+  803a5d:	89 f0                	mov    %esi,%eax
+}
+  803a5f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a62:	5b                   	pop    %ebx
+  803a63:	5e                   	pop    %esi
+  803a64:	5f                   	pop    %edi
+  803a65:	5d                   	pop    %ebp
+  803a66:	c3                   	ret
+
+00803a67 <pipe>:
+{
+  803a67:	55                   	push   %ebp
+  803a68:	89 e5                	mov    %esp,%ebp
+  803a6a:	56                   	push   %esi
+  803a6b:	53                   	push   %ebx
+  803a6c:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803a6f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803a72:	50                   	push   %eax
+  803a73:	e8 e3 df ff ff       	call   801a5b <fd_alloc>
+  803a78:	89 c3                	mov    %eax,%ebx
+  803a7a:	83 c4 10             	add    $0x10,%esp
+  803a7d:	85 c0                	test   %eax,%eax
+  803a7f:	0f 88 23 01 00 00    	js     803ba8 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803a85:	83 ec 04             	sub    $0x4,%esp
+  803a88:	68 07 04 00 00       	push   $0x407
+  803a8d:	ff 75 f4             	push   -0xc(%ebp)
+  803a90:	6a 00                	push   $0x0
+  803a92:	e8 85 d4 ff ff       	call   800f1c <sys_page_alloc>
+  803a97:	89 c3                	mov    %eax,%ebx
+  803a99:	83 c4 10             	add    $0x10,%esp
+  803a9c:	85 c0                	test   %eax,%eax
+  803a9e:	0f 88 04 01 00 00    	js     803ba8 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803aa4:	83 ec 0c             	sub    $0xc,%esp
+  803aa7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803aaa:	50                   	push   %eax
+  803aab:	e8 ab df ff ff       	call   801a5b <fd_alloc>
+  803ab0:	89 c3                	mov    %eax,%ebx
+  803ab2:	83 c4 10             	add    $0x10,%esp
+  803ab5:	85 c0                	test   %eax,%eax
+  803ab7:	0f 88 db 00 00 00    	js     803b98 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803abd:	83 ec 04             	sub    $0x4,%esp
+  803ac0:	68 07 04 00 00       	push   $0x407
+  803ac5:	ff 75 f0             	push   -0x10(%ebp)
+  803ac8:	6a 00                	push   $0x0
+  803aca:	e8 4d d4 ff ff       	call   800f1c <sys_page_alloc>
+  803acf:	89 c3                	mov    %eax,%ebx
+  803ad1:	83 c4 10             	add    $0x10,%esp
+  803ad4:	85 c0                	test   %eax,%eax
+  803ad6:	0f 88 bc 00 00 00    	js     803b98 <pipe+0x131>
+	va = fd2data(fd0);
+  803adc:	83 ec 0c             	sub    $0xc,%esp
+  803adf:	ff 75 f4             	push   -0xc(%ebp)
+  803ae2:	e8 5d df ff ff       	call   801a44 <fd2data>
+  803ae7:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803ae9:	83 c4 0c             	add    $0xc,%esp
+  803aec:	68 07 04 00 00       	push   $0x407
+  803af1:	50                   	push   %eax
+  803af2:	6a 00                	push   $0x0
+  803af4:	e8 23 d4 ff ff       	call   800f1c <sys_page_alloc>
+  803af9:	89 c3                	mov    %eax,%ebx
+  803afb:	83 c4 10             	add    $0x10,%esp
+  803afe:	85 c0                	test   %eax,%eax
+  803b00:	0f 88 82 00 00 00    	js     803b88 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803b06:	83 ec 0c             	sub    $0xc,%esp
+  803b09:	ff 75 f0             	push   -0x10(%ebp)
+  803b0c:	e8 33 df ff ff       	call   801a44 <fd2data>
+  803b11:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803b18:	50                   	push   %eax
+  803b19:	6a 00                	push   $0x0
+  803b1b:	56                   	push   %esi
+  803b1c:	6a 00                	push   $0x0
+  803b1e:	e8 46 d4 ff ff       	call   800f69 <sys_page_map>
+  803b23:	89 c3                	mov    %eax,%ebx
+  803b25:	83 c4 20             	add    $0x20,%esp
+  803b28:	85 c0                	test   %eax,%eax
+  803b2a:	78 4e                	js     803b7a <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803b2c:	a1 9c 62 80 00       	mov    0x80629c,%eax
+  803b31:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803b34:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803b36:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803b39:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803b40:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803b43:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803b45:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803b48:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803b4f:	83 ec 0c             	sub    $0xc,%esp
+  803b52:	ff 75 f4             	push   -0xc(%ebp)
+  803b55:	e8 da de ff ff       	call   801a34 <fd2num>
+  803b5a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803b5d:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803b5f:	83 c4 04             	add    $0x4,%esp
+  803b62:	ff 75 f0             	push   -0x10(%ebp)
+  803b65:	e8 ca de ff ff       	call   801a34 <fd2num>
+  803b6a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803b6d:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803b70:	83 c4 10             	add    $0x10,%esp
+  803b73:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803b78:	eb 2e                	jmp    803ba8 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803b7a:	83 ec 08             	sub    $0x8,%esp
+  803b7d:	56                   	push   %esi
+  803b7e:	6a 00                	push   $0x0
+  803b80:	e8 30 d4 ff ff       	call   800fb5 <sys_page_unmap>
+  803b85:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803b88:	83 ec 08             	sub    $0x8,%esp
+  803b8b:	ff 75 f0             	push   -0x10(%ebp)
+  803b8e:	6a 00                	push   $0x0
+  803b90:	e8 20 d4 ff ff       	call   800fb5 <sys_page_unmap>
+  803b95:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803b98:	83 ec 08             	sub    $0x8,%esp
+  803b9b:	ff 75 f4             	push   -0xc(%ebp)
+  803b9e:	6a 00                	push   $0x0
+  803ba0:	e8 10 d4 ff ff       	call   800fb5 <sys_page_unmap>
+  803ba5:	83 c4 10             	add    $0x10,%esp
+}
+  803ba8:	89 d8                	mov    %ebx,%eax
+  803baa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803bad:	5b                   	pop    %ebx
+  803bae:	5e                   	pop    %esi
+  803baf:	5d                   	pop    %ebp
+  803bb0:	c3                   	ret
+
+00803bb1 <pipeisclosed>:
+{
+  803bb1:	55                   	push   %ebp
+  803bb2:	89 e5                	mov    %esp,%ebp
+  803bb4:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803bb7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803bba:	50                   	push   %eax
+  803bbb:	ff 75 08             	push   0x8(%ebp)
+  803bbe:	e8 ee de ff ff       	call   801ab1 <fd_lookup>
+  803bc3:	83 c4 10             	add    $0x10,%esp
+  803bc6:	85 c0                	test   %eax,%eax
+  803bc8:	78 18                	js     803be2 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803bca:	83 ec 0c             	sub    $0xc,%esp
+  803bcd:	ff 75 f4             	push   -0xc(%ebp)
+  803bd0:	e8 6f de ff ff       	call   801a44 <fd2data>
+  803bd5:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803bd7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803bda:	e8 27 fc ff ff       	call   803806 <_pipeisclosed>
+  803bdf:	83 c4 10             	add    $0x10,%esp
+}
+  803be2:	c9                   	leave
+  803be3:	c3                   	ret
+
+00803be4 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  803be4:	55                   	push   %ebp
+  803be5:	89 e5                	mov    %esp,%ebp
+  803be7:	56                   	push   %esi
+  803be8:	53                   	push   %ebx
+  803be9:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  803bec:	85 f6                	test   %esi,%esi
+  803bee:	74 15                	je     803c05 <wait+0x21>
+	e = &envs[ENVX(envid)];
+  803bf0:	89 f0                	mov    %esi,%eax
+  803bf2:	25 ff 03 00 00       	and    $0x3ff,%eax
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  803bf7:	8d 1c c0             	lea    (%eax,%eax,8),%ebx
+  803bfa:	c1 e3 04             	shl    $0x4,%ebx
+  803bfd:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  803c03:	eb 1b                	jmp    803c20 <wait+0x3c>
+	assert(envid != 0);
+  803c05:	68 96 52 80 00       	push   $0x805296
+  803c0a:	68 f1 50 80 00       	push   $0x8050f1
+  803c0f:	6a 09                	push   $0x9
+  803c11:	68 a1 52 80 00       	push   $0x8052a1
+  803c16:	e8 04 c8 ff ff       	call   80041f <_panic>
+		sys_yield();
+  803c1b:	e8 d0 d2 ff ff       	call   800ef0 <sys_yield>
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  803c20:	8b 43 48             	mov    0x48(%ebx),%eax
+  803c23:	39 f0                	cmp    %esi,%eax
+  803c25:	75 07                	jne    803c2e <wait+0x4a>
+  803c27:	8b 43 54             	mov    0x54(%ebx),%eax
+  803c2a:	85 c0                	test   %eax,%eax
+  803c2c:	75 ed                	jne    803c1b <wait+0x37>
+}
+  803c2e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803c31:	5b                   	pop    %ebx
+  803c32:	5e                   	pop    %esi
+  803c33:	5d                   	pop    %ebp
+  803c34:	c3                   	ret
+
+00803c35 <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  803c35:	55                   	push   %ebp
+  803c36:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  803c38:	8b 45 08             	mov    0x8(%ebp),%eax
+  803c3b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803c41:	5d                   	pop    %ebp
+  803c42:	c3                   	ret
+
+00803c43 <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  803c43:	55                   	push   %ebp
+  803c44:	89 e5                	mov    %esp,%ebp
+  803c46:	56                   	push   %esi
+  803c47:	53                   	push   %ebx
+  803c48:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803c4b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c50:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803c55:	89 d0                	mov    %edx,%eax
+  803c57:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  803c5b:	85 c0                	test   %eax,%eax
+  803c5d:	74 2d                	je     803c8c <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  803c5f:	83 f8 02             	cmp    $0x2,%eax
+  803c62:	74 08                	je     803c6c <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  803c64:	b8 02 00 00 00       	mov    $0x2,%eax
+  803c69:	f0 87 03             	lock xchg %eax,(%ebx)
+  803c6c:	be 02 00 00 00       	mov    $0x2,%esi
+  803c71:	eb 15                	jmp    803c88 <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  803c73:	83 ec 04             	sub    $0x4,%esp
+  803c76:	6a 00                	push   $0x0
+  803c78:	6a 02                	push   $0x2
+  803c7a:	53                   	push   %ebx
+  803c7b:	e8 b1 d5 ff ff       	call   801231 <sys_futex_wait>
+  803c80:	89 f0                	mov    %esi,%eax
+  803c82:	f0 87 03             	lock xchg %eax,(%ebx)
+  803c85:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  803c88:	85 c0                	test   %eax,%eax
+  803c8a:	75 e7                	jne    803c73 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  803c8c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803c8f:	5b                   	pop    %ebx
+  803c90:	5e                   	pop    %esi
+  803c91:	5d                   	pop    %ebp
+  803c92:	c3                   	ret
+
+00803c93 <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  803c93:	55                   	push   %ebp
+  803c94:	89 e5                	mov    %esp,%ebp
+  803c96:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803c99:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c9e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803ca3:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  803ca7:	f7 d8                	neg    %eax
+  803ca9:	19 c0                	sbb    %eax,%eax
+  803cab:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  803cae:	5d                   	pop    %ebp
+  803caf:	c3                   	ret
+
+00803cb0 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  803cb0:	55                   	push   %ebp
+  803cb1:	89 e5                	mov    %esp,%ebp
+  803cb3:	83 ec 08             	sub    $0x8,%esp
+  803cb6:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  803cb9:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cbe:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  803cc1:	83 f8 02             	cmp    $0x2,%eax
+  803cc4:	74 02                	je     803cc8 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  803cc6:	c9                   	leave
+  803cc7:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  803cc8:	83 ec 08             	sub    $0x8,%esp
+  803ccb:	6a 01                	push   $0x1
+  803ccd:	52                   	push   %edx
+  803cce:	e8 8d d5 ff ff       	call   801260 <sys_futex_wake>
+  803cd3:	83 c4 10             	add    $0x10,%esp
+}
+  803cd6:	eb ee                	jmp    803cc6 <mutex_unlock+0x16>
+
+00803cd8 <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  803cd8:	55                   	push   %ebp
+  803cd9:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  803cdb:	8b 45 08             	mov    0x8(%ebp),%eax
+  803cde:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803ce4:	5d                   	pop    %ebp
+  803ce5:	c3                   	ret
+
+00803ce6 <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  803ce6:	55                   	push   %ebp
+  803ce7:	89 e5                	mov    %esp,%ebp
+  803ce9:	57                   	push   %edi
+  803cea:	56                   	push   %esi
+  803ceb:	53                   	push   %ebx
+  803cec:	83 ec 18             	sub    $0x18,%esp
+  803cef:	8b 75 08             	mov    0x8(%ebp),%esi
+  803cf2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  803cf5:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  803cf7:	53                   	push   %ebx
+  803cf8:	e8 b3 ff ff ff       	call   803cb0 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  803cfd:	83 c4 0c             	add    $0xc,%esp
+  803d00:	ff 75 10             	push   0x10(%ebp)
+  803d03:	57                   	push   %edi
+  803d04:	56                   	push   %esi
+  803d05:	e8 27 d5 ff ff       	call   801231 <sys_futex_wait>
+  803d0a:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  803d0c:	83 c4 10             	add    $0x10,%esp
+  803d0f:	be 02 00 00 00       	mov    $0x2,%esi
+  803d14:	eb 10                	jmp    803d26 <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  803d16:	83 ec 04             	sub    $0x4,%esp
+  803d19:	6a 00                	push   $0x0
+  803d1b:	6a 02                	push   $0x2
+  803d1d:	53                   	push   %ebx
+  803d1e:	e8 0e d5 ff ff       	call   801231 <sys_futex_wait>
+  803d23:	83 c4 10             	add    $0x10,%esp
+  803d26:	89 f0                	mov    %esi,%eax
+  803d28:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  803d2b:	85 c0                	test   %eax,%eax
+  803d2d:	75 e7                	jne    803d16 <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  803d2f:	83 ff ec             	cmp    $0xffffffec,%edi
+  803d32:	74 05                	je     803d39 <cond_timedwait+0x53>
+  803d34:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803d39:	89 f8                	mov    %edi,%eax
+  803d3b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d3e:	5b                   	pop    %ebx
+  803d3f:	5e                   	pop    %esi
+  803d40:	5f                   	pop    %edi
+  803d41:	5d                   	pop    %ebp
+  803d42:	c3                   	ret
+
+00803d43 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  803d43:	55                   	push   %ebp
+  803d44:	89 e5                	mov    %esp,%ebp
+  803d46:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  803d49:	6a 00                	push   $0x0
+  803d4b:	ff 75 0c             	push   0xc(%ebp)
+  803d4e:	ff 75 08             	push   0x8(%ebp)
+  803d51:	e8 90 ff ff ff       	call   803ce6 <cond_timedwait>
+}
+  803d56:	83 c4 10             	add    $0x10,%esp
+  803d59:	c9                   	leave
+  803d5a:	c3                   	ret
+
+00803d5b <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  803d5b:	55                   	push   %ebp
+  803d5c:	89 e5                	mov    %esp,%ebp
+  803d5e:	83 ec 10             	sub    $0x10,%esp
+  803d61:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  803d64:	ba 01 00 00 00       	mov    $0x1,%edx
+  803d69:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  803d6d:	6a 01                	push   $0x1
+  803d6f:	50                   	push   %eax
+  803d70:	e8 eb d4 ff ff       	call   801260 <sys_futex_wake>
+}
+  803d75:	83 c4 10             	add    $0x10,%esp
+  803d78:	c9                   	leave
+  803d79:	c3                   	ret
+
+00803d7a <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  803d7a:	55                   	push   %ebp
+  803d7b:	89 e5                	mov    %esp,%ebp
+  803d7d:	83 ec 10             	sub    $0x10,%esp
+  803d80:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d83:	ba 01 00 00 00       	mov    $0x1,%edx
+  803d88:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  803d8c:	68 00 04 00 00       	push   $0x400
+  803d91:	50                   	push   %eax
+  803d92:	e8 c9 d4 ff ff       	call   801260 <sys_futex_wake>
+}
+  803d97:	83 c4 10             	add    $0x10,%esp
+  803d9a:	c9                   	leave
+  803d9b:	c3                   	ret
+
+00803d9c <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  803d9c:	55                   	push   %ebp
+  803d9d:	89 e5                	mov    %esp,%ebp
+  803d9f:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  803da2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803da5:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  803da7:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  803dae:	5d                   	pop    %ebp
+  803daf:	c3                   	ret
+
+00803db0 <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  803db0:	55                   	push   %ebp
+  803db1:	89 e5                	mov    %esp,%ebp
+  803db3:	53                   	push   %ebx
+  803db4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  803db7:	8b 11                	mov    (%ecx),%edx
+  803db9:	85 d2                	test   %edx,%edx
+  803dbb:	74 14                	je     803dd1 <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  803dbd:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803dc0:	89 d0                	mov    %edx,%eax
+  803dc2:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  803dc6:	39 c2                	cmp    %eax,%edx
+  803dc8:	75 ed                	jne    803db7 <sem_trywait+0x7>
+			return 0;
+  803dca:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dcf:	eb 05                	jmp    803dd6 <sem_trywait+0x26>
+	return -E_AGAIN;
+  803dd1:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  803dd6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803dd9:	c9                   	leave
+  803dda:	c3                   	ret
+
+00803ddb <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  803ddb:	55                   	push   %ebp
+  803ddc:	89 e5                	mov    %esp,%ebp
+  803dde:	57                   	push   %edi
+  803ddf:	56                   	push   %esi
+  803de0:	53                   	push   %ebx
+  803de1:	83 ec 1c             	sub    $0x1c,%esp
+  803de4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803de7:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  803dea:	e8 ba d3 ff ff       	call   8011a9 <sys_time_msec>
+  803def:	01 f8                	add    %edi,%eax
+  803df1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  803df4:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  803df9:	eb 28                	jmp    803e23 <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  803dfb:	b8 01 00 00 00       	mov    $0x1,%eax
+  803e00:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  803e05:	83 ec 04             	sub    $0x4,%esp
+  803e08:	56                   	push   %esi
+  803e09:	6a 00                	push   $0x0
+  803e0b:	53                   	push   %ebx
+  803e0c:	e8 20 d4 ff ff       	call   801231 <sys_futex_wait>
+  803e11:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  803e16:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  803e1b:	83 c4 10             	add    $0x10,%esp
+  803e1e:	83 f8 ec             	cmp    $0xffffffec,%eax
+  803e21:	74 2e                	je     803e51 <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  803e23:	83 ec 0c             	sub    $0xc,%esp
+  803e26:	53                   	push   %ebx
+  803e27:	e8 84 ff ff ff       	call   803db0 <sem_trywait>
+  803e2c:	83 c4 10             	add    $0x10,%esp
+  803e2f:	85 c0                	test   %eax,%eax
+  803e31:	79 19                	jns    803e4c <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  803e33:	85 ff                	test   %edi,%edi
+  803e35:	74 c4                	je     803dfb <sem_timedwait+0x20>
+  803e37:	e8 6d d3 ff ff       	call   8011a9 <sys_time_msec>
+  803e3c:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803e3f:	29 c6                	sub    %eax,%esi
+  803e41:	85 f6                	test   %esi,%esi
+  803e43:	7f b6                	jg     803dfb <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  803e45:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  803e4a:	eb 05                	jmp    803e51 <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  803e4c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e51:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e54:	5b                   	pop    %ebx
+  803e55:	5e                   	pop    %esi
+  803e56:	5f                   	pop    %edi
+  803e57:	5d                   	pop    %ebp
+  803e58:	c3                   	ret
+
+00803e59 <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  803e59:	55                   	push   %ebp
+  803e5a:	89 e5                	mov    %esp,%ebp
+  803e5c:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  803e5f:	6a 00                	push   $0x0
+  803e61:	ff 75 08             	push   0x8(%ebp)
+  803e64:	e8 72 ff ff ff       	call   803ddb <sem_timedwait>
+}
+  803e69:	83 c4 10             	add    $0x10,%esp
+  803e6c:	c9                   	leave
+  803e6d:	c3                   	ret
+
+00803e6e <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  803e6e:	55                   	push   %ebp
+  803e6f:	89 e5                	mov    %esp,%ebp
+  803e71:	83 ec 08             	sub    $0x8,%esp
+  803e74:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e77:	ba 01 00 00 00       	mov    $0x1,%edx
+  803e7c:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  803e80:	8b 50 04             	mov    0x4(%eax),%edx
+  803e83:	85 d2                	test   %edx,%edx
+  803e85:	75 02                	jne    803e89 <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  803e87:	c9                   	leave
+  803e88:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  803e89:	83 ec 08             	sub    $0x8,%esp
+  803e8c:	6a 01                	push   $0x1
+  803e8e:	50                   	push   %eax
+  803e8f:	e8 cc d3 ff ff       	call   801260 <sys_futex_wake>
+  803e94:	83 c4 10             	add    $0x10,%esp
+}
+  803e97:	eb ee                	jmp    803e87 <sem_post+0x19>
+
+00803e99 <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  803e99:	55                   	push   %ebp
+  803e9a:	89 e5                	mov    %esp,%ebp
+  803e9c:	57                   	push   %edi
+  803e9d:	56                   	push   %esi
+  803e9e:	53                   	push   %ebx
+  803e9f:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  803ea2:	68 20 70 80 00       	push   $0x807020
+  803ea7:	e8 97 fd ff ff       	call   803c43 <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  803eac:	a1 44 70 80 00       	mov    0x807044,%eax
+  803eb1:	83 c4 10             	add    $0x10,%esp
+  803eb4:	85 c0                	test   %eax,%eax
+  803eb6:	75 19                	jne    803ed1 <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  803eb8:	a1 c0 72 80 00       	mov    0x8072c0,%eax
+  803ebd:	8b 00                	mov    (%eax),%eax
+  803ebf:	8b 40 48             	mov    0x48(%eax),%eax
+  803ec2:	a3 40 70 80 00       	mov    %eax,0x807040
+		threads[0].th_state = PTH_RUNNING;
+  803ec7:	c7 05 44 70 80 00 01 	movl   $0x1,0x807044
+  803ece:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803ed1:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  803ed6:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803ed9:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803ee0:	8b 40 04             	mov    0x4(%eax),%eax
+  803ee3:	85 c0                	test   %eax,%eax
+  803ee5:	0f 84 e4 00 00 00    	je     803fcf <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803eeb:	83 c3 01             	add    $0x1,%ebx
+  803eee:	83 fb 20             	cmp    $0x20,%ebx
+  803ef1:	75 e3                	jne    803ed6 <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  803ef3:	83 ec 0c             	sub    $0xc,%esp
+  803ef6:	68 20 70 80 00       	push   $0x807020
+  803efb:	e8 b0 fd ff ff       	call   803cb0 <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  803f00:	83 c4 10             	add    $0x10,%esp
+  803f03:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  803f08:	e9 b8 00 00 00       	jmp    803fc5 <pthread_create+0x12c>
+  803f0d:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  803f10:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  803f13:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  803f15:	39 f3                	cmp    %esi,%ebx
+  803f17:	73 16                	jae    803f2f <pthread_create+0x96>
+		va -= PGSIZE;
+  803f19:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  803f1f:	83 ec 08             	sub    $0x8,%esp
+  803f22:	56                   	push   %esi
+  803f23:	6a 00                	push   $0x0
+  803f25:	e8 8b d0 ff ff       	call   800fb5 <sys_page_unmap>
+  803f2a:	83 c4 10             	add    $0x10,%esp
+  803f2d:	eb e6                	jmp    803f15 <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  803f2f:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803f32:	83 ec 08             	sub    $0x8,%esp
+  803f35:	ff 75 e4             	push   -0x1c(%ebp)
+  803f38:	6a 00                	push   $0x0
+  803f3a:	e8 76 d0 ff ff       	call   800fb5 <sys_page_unmap>
+	return r;
+  803f3f:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  803f42:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803f45:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803f4c:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  803f53:	eb 70                	jmp    803fc5 <pthread_create+0x12c>
+	th->th_fn = fn;
+  803f55:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803f58:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803f5f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803f62:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  803f65:	8b 55 10             	mov    0x10(%ebp),%edx
+  803f68:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  803f6b:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  803f72:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  803f77:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803f7a:	29 c8                	sub    %ecx,%eax
+  803f7c:	85 db                	test   %ebx,%ebx
+  803f7e:	0f 44 05 c0 72 80 00 	cmove  0x8072c0,%eax
+	*--esp = t;
+  803f85:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  803f88:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803f8f:	83 ec 04             	sub    $0x4,%esp
+  803f92:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803f97:	29 ca                	sub    %ecx,%edx
+  803f99:	52                   	push   %edx
+	*--esp = 0;
+  803f9a:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803f9d:	50                   	push   %eax
+  803f9e:	68 f6 41 80 00       	push   $0x8041f6
+  803fa3:	e8 5d d3 ff ff       	call   801305 <sys_thread_create>
+  803fa8:	89 c7                	mov    %eax,%edi
+  803faa:	83 c4 10             	add    $0x10,%esp
+  803fad:	85 c0                	test   %eax,%eax
+  803faf:	78 91                	js     803f42 <pthread_create+0xa9>
+	th->th_env = id;
+  803fb1:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803fb4:	89 3c 85 40 70 80 00 	mov    %edi,0x807040(,%eax,4)
+	*tp = t;
+  803fbb:	8b 45 08             	mov    0x8(%ebp),%eax
+  803fbe:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  803fc0:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803fc5:	89 f8                	mov    %edi,%eax
+  803fc7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803fca:	5b                   	pop    %ebx
+  803fcb:	5e                   	pop    %esi
+  803fcc:	5f                   	pop    %edi
+  803fcd:	5d                   	pop    %ebp
+  803fce:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  803fcf:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803fd2:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803fd9:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  803fe0:	83 ec 0c             	sub    $0xc,%esp
+  803fe3:	68 20 70 80 00       	push   $0x807020
+  803fe8:	e8 c3 fc ff ff       	call   803cb0 <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  803fed:	89 d9                	mov    %ebx,%ecx
+  803fef:	c1 e1 10             	shl    $0x10,%ecx
+  803ff2:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  803ff5:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  803ffa:	29 c8                	sub    %ecx,%eax
+  803ffc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  803fff:	c1 e8 16             	shr    $0x16,%eax
+  804002:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  804009:	83 c4 10             	add    $0x10,%esp
+  80400c:	a8 01                	test   $0x1,%al
+  80400e:	74 15                	je     804025 <pthread_create+0x18c>
+  804010:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804013:	c1 e8 0c             	shr    $0xc,%eax
+  804016:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80401d:	a8 01                	test   $0x1,%al
+  80401f:	0f 85 30 ff ff ff    	jne    803f55 <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  804025:	83 ec 04             	sub    $0x4,%esp
+  804028:	6a 07                	push   $0x7
+  80402a:	ff 75 e4             	push   -0x1c(%ebp)
+  80402d:	6a 00                	push   $0x0
+  80402f:	e8 e8 ce ff ff       	call   800f1c <sys_page_alloc>
+  804034:	89 c7                	mov    %eax,%edi
+  804036:	83 c4 10             	add    $0x10,%esp
+  804039:	85 c0                	test   %eax,%eax
+  80403b:	0f 88 01 ff ff ff    	js     803f42 <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  804041:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  804046:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  804049:	29 d0                	sub    %edx,%eax
+  80404b:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80404e:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  804050:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  804055:	29 d0                	sub    %edx,%eax
+  804057:	89 c7                	mov    %eax,%edi
+  804059:	39 fe                	cmp    %edi,%esi
+  80405b:	0f 83 f4 fe ff ff    	jae    803f55 <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  804061:	83 ec 04             	sub    $0x4,%esp
+  804064:	6a 07                	push   $0x7
+  804066:	56                   	push   %esi
+  804067:	6a 00                	push   $0x0
+  804069:	e8 ae ce ff ff       	call   800f1c <sys_page_alloc>
+  80406e:	83 c4 10             	add    $0x10,%esp
+  804071:	85 c0                	test   %eax,%eax
+  804073:	0f 88 94 fe ff ff    	js     803f0d <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  804079:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80407f:	eb d8                	jmp    804059 <pthread_create+0x1c0>
+
+00804081 <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  804081:	55                   	push   %ebp
+  804082:	89 e5                	mov    %esp,%ebp
+  804084:	57                   	push   %edi
+  804085:	56                   	push   %esi
+  804086:	53                   	push   %ebx
+  804087:	83 ec 0c             	sub    $0xc,%esp
+  80408a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  80408d:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  804090:	83 f8 1e             	cmp    $0x1e,%eax
+  804093:	0f 87 c7 00 00 00    	ja     804160 <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  804099:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80409b:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8040a1:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8040a6:	77 12                	ja     8040ba <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8040a8:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8040ad:	29 d0                	sub    %edx,%eax
+  8040af:	c1 e8 10             	shr    $0x10,%eax
+  8040b2:	39 c3                	cmp    %eax,%ebx
+  8040b4:	0f 84 ad 00 00 00    	je     804167 <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  8040ba:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8040bd:	8d 3c 85 44 70 80 00 	lea    0x807044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  8040c4:	8d 34 85 40 70 80 00 	lea    0x807040(,%eax,4),%esi
+  8040cb:	eb 10                	jmp    8040dd <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  8040cd:	83 ec 04             	sub    $0x4,%esp
+  8040d0:	6a 00                	push   $0x0
+  8040d2:	6a 01                	push   $0x1
+  8040d4:	57                   	push   %edi
+  8040d5:	e8 57 d1 ff ff       	call   801231 <sys_futex_wait>
+  8040da:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  8040dd:	8b 46 04             	mov    0x4(%esi),%eax
+  8040e0:	83 f8 01             	cmp    $0x1,%eax
+  8040e3:	74 e8                	je     8040cd <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  8040e5:	83 f8 02             	cmp    $0x2,%eax
+  8040e8:	0f 85 80 00 00 00    	jne    80416e <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  8040ee:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  8040f1:	c1 e6 02             	shl    $0x2,%esi
+  8040f4:	eb 05                	jmp    8040fb <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  8040f6:	e8 f5 cd ff ff       	call   800ef0 <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  8040fb:	8b 8e 40 70 80 00    	mov    0x807040(%esi),%ecx
+  804101:	89 ca                	mov    %ecx,%edx
+  804103:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  804109:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80410c:	c1 e0 04             	shl    $0x4,%eax
+  80410f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804114:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  804117:	39 c1                	cmp    %eax,%ecx
+  804119:	75 12                	jne    80412d <pthread_join+0xac>
+  80411b:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80411e:	c1 e0 04             	shl    $0x4,%eax
+  804121:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804126:	8b 40 54             	mov    0x54(%eax),%eax
+  804129:	85 c0                	test   %eax,%eax
+  80412b:	75 c9                	jne    8040f6 <pthread_join+0x75>
+	if (ret_store)
+  80412d:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  804131:	74 0f                	je     804142 <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  804133:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  804136:	8b 04 85 50 70 80 00 	mov    0x807050(,%eax,4),%eax
+  80413d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  804140:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  804142:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  804145:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  80414c:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  804153:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804158:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80415b:	5b                   	pop    %ebx
+  80415c:	5e                   	pop    %esi
+  80415d:	5f                   	pop    %edi
+  80415e:	5d                   	pop    %ebp
+  80415f:	c3                   	ret
+		return -E_INVAL;
+  804160:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804165:	eb f1                	jmp    804158 <pthread_join+0xd7>
+  804167:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80416c:	eb ea                	jmp    804158 <pthread_join+0xd7>
+		return -E_INVAL;
+  80416e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804173:	eb e3                	jmp    804158 <pthread_join+0xd7>
+
+00804175 <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  804175:	55                   	push   %ebp
+  804176:	89 e5                	mov    %esp,%ebp
+  804178:	53                   	push   %ebx
+  804179:	83 ec 04             	sub    $0x4,%esp
+  80417c:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80417e:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804184:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804189:	77 0c                	ja     804197 <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80418b:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804190:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  804192:	c1 e8 10             	shr    $0x10,%eax
+  804195:	75 0a                	jne    8041a1 <pthread_exit+0x2c>
+		exit();
+  804197:	e8 5b c2 ff ff       	call   8003f7 <exit>
+  80419c:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  8041a1:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  8041a8:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  8041ab:	8d 0c 8d 40 70 80 00 	lea    0x807040(,%ecx,4),%ecx
+  8041b2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8041b5:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  8041b8:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  8041bf:	83 ec 08             	sub    $0x8,%esp
+  8041c2:	6a 20                	push   $0x20
+  8041c4:	01 c2                	add    %eax,%edx
+  8041c6:	8d 04 95 44 70 80 00 	lea    0x807044(,%edx,4),%eax
+  8041cd:	50                   	push   %eax
+  8041ce:	e8 8d d0 ff ff       	call   801260 <sys_futex_wake>
+	sys_env_destroy(0);
+  8041d3:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8041da:	e8 9a cc ff ff       	call   800e79 <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  8041df:	83 c4 0c             	add    $0xc,%esp
+  8041e2:	68 ac 52 80 00       	push   $0x8052ac
+  8041e7:	68 a5 00 00 00       	push   $0xa5
+  8041ec:	68 c6 52 80 00       	push   $0x8052c6
+  8041f1:	e8 29 c2 ff ff       	call   80041f <_panic>
+
+008041f6 <pthread_start>:
+{
+  8041f6:	55                   	push   %ebp
+  8041f7:	89 e5                	mov    %esp,%ebp
+  8041f9:	53                   	push   %ebx
+  8041fa:	83 ec 04             	sub    $0x4,%esp
+  8041fd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  804200:	e8 bf cc ff ff       	call   800ec4 <sys_getenvid>
+  804205:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  80420a:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+	if (t == 0)
+  804210:	85 db                	test   %ebx,%ebx
+  804212:	74 0c                	je     804220 <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804214:	89 d9                	mov    %ebx,%ecx
+  804216:	c1 e1 10             	shl    $0x10,%ecx
+  804219:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80421e:	29 ca                	sub    %ecx,%edx
+  804220:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  804223:	c1 e0 04             	shl    $0x4,%eax
+  804226:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80422b:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  80422d:	83 ec 0c             	sub    $0xc,%esp
+  804230:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  804237:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  80423a:	ff 34 95 4c 70 80 00 	push   0x80704c(,%edx,4)
+  804241:	ff 14 95 48 70 80 00 	call   *0x807048(,%edx,4)
+  804248:	89 04 24             	mov    %eax,(%esp)
+  80424b:	e8 25 ff ff ff       	call   804175 <pthread_exit>
+
+00804250 <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  804250:	55                   	push   %ebp
+  804251:	89 e5                	mov    %esp,%ebp
+  804253:	57                   	push   %edi
+  804254:	56                   	push   %esi
+  804255:	53                   	push   %ebx
+  804256:	83 ec 1c             	sub    $0x1c,%esp
+  804259:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80425b:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  804261:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804268:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80426d:	77 0d                	ja     80427c <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80426f:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804274:	29 d0                	sub    %edx,%eax
+  804276:	c1 e8 10             	shr    $0x10,%eax
+  804279:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  80427c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804281:	eb 2f                	jmp    8042b2 <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  804283:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  804289:	8b 01                	mov    (%ecx),%eax
+  80428b:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  80428e:	39 c2                	cmp    %eax,%edx
+  804290:	75 14                	jne    8042a6 <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  804292:	83 ec 0c             	sub    $0xc,%esp
+  804295:	57                   	push   %edi
+  804296:	e8 de cb ff ff       	call   800e79 <sys_env_destroy>
+  80429b:	83 c4 10             	add    $0x10,%esp
+  80429e:	85 c0                	test   %eax,%eax
+  8042a0:	0f 88 97 00 00 00    	js     80433d <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  8042a6:	83 c3 01             	add    $0x1,%ebx
+  8042a9:	83 fb 20             	cmp    $0x20,%ebx
+  8042ac:	0f 84 d2 00 00 00    	je     804384 <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  8042b2:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  8042b5:	74 ef                	je     8042a6 <pthread_kill_others+0x56>
+  8042b7:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8042ba:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  8042c1:	8b 40 04             	mov    0x4(%eax),%eax
+  8042c4:	83 f8 01             	cmp    $0x1,%eax
+  8042c7:	75 dd                	jne    8042a6 <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  8042c9:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8042cc:	8b 3c 85 40 70 80 00 	mov    0x807040(,%eax,4),%edi
+  8042d3:	89 fe                	mov    %edi,%esi
+  8042d5:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  8042db:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  8042de:	c1 e0 04             	shl    $0x4,%eax
+  8042e1:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8042e6:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  8042e9:	39 c7                	cmp    %eax,%edi
+  8042eb:	75 b9                	jne    8042a6 <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  8042ed:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  8042f0:	c1 e0 04             	shl    $0x4,%eax
+  8042f3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8042f8:	8b 40 54             	mov    0x54(%eax),%eax
+  8042fb:	85 c0                	test   %eax,%eax
+  8042fd:	74 a7                	je     8042a6 <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  8042ff:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  804302:	c1 e0 04             	shl    $0x4,%eax
+  804305:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  80430b:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80430d:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  804313:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804318:	0f 87 65 ff ff ff    	ja     804283 <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80431e:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804323:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  804325:	c1 e8 10             	shr    $0x10,%eax
+  804328:	0f 84 55 ff ff ff    	je     804283 <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80432e:	c1 e0 10             	shl    $0x10,%eax
+  804331:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  804336:	29 c1                	sub    %eax,%ecx
+  804338:	e9 4c ff ff ff       	jmp    804289 <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  80433d:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  804340:	c1 e2 04             	shl    $0x4,%edx
+  804343:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  804349:	8b 52 48             	mov    0x48(%edx),%edx
+  80434c:	39 fa                	cmp    %edi,%edx
+  80434e:	0f 85 52 ff ff ff    	jne    8042a6 <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  804354:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  804357:	c1 e2 04             	shl    $0x4,%edx
+  80435a:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  804360:	8b 52 54             	mov    0x54(%edx),%edx
+  804363:	85 d2                	test   %edx,%edx
+  804365:	0f 84 3b ff ff ff    	je     8042a6 <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  80436b:	83 ec 0c             	sub    $0xc,%esp
+  80436e:	50                   	push   %eax
+  80436f:	57                   	push   %edi
+  804370:	68 d4 52 80 00       	push   $0x8052d4
+  804375:	68 bb 00 00 00       	push   $0xbb
+  80437a:	68 c6 52 80 00       	push   $0x8052c6
+  80437f:	e8 9b c0 ff ff       	call   80041f <_panic>
+	}
+}
+  804384:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804387:	5b                   	pop    %ebx
+  804388:	5e                   	pop    %esi
+  804389:	5f                   	pop    %edi
+  80438a:	5d                   	pop    %ebp
+  80438b:	c3                   	ret
+
+0080438c <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  80438c:	55                   	push   %ebp
+  80438d:	89 e5                	mov    %esp,%ebp
+  80438f:	53                   	push   %ebx
+  804390:	83 ec 04             	sub    $0x4,%esp
+  804393:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804395:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  80439b:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8043a1:	0f 87 85 00 00 00    	ja     80442c <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8043a7:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  8043ac:	29 c3                	sub    %eax,%ebx
+  8043ae:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  8043b1:	83 ec 04             	sub    $0x4,%esp
+  8043b4:	68 80 02 00 00       	push   $0x280
+  8043b9:	6a 00                	push   $0x0
+  8043bb:	68 40 70 80 00       	push   $0x807040
+  8043c0:	e8 6a c8 ff ff       	call   800c2f <memset>
+	threads_mu.m_state = 0;
+  8043c5:	c7 05 20 70 80 00 00 	movl   $0x0,0x807020
+  8043cc:	00 00 00 
+	if (self != 0) {
+  8043cf:	83 c4 10             	add    $0x10,%esp
+  8043d2:	85 db                	test   %ebx,%ebx
+  8043d4:	74 51                	je     804427 <pthread_fork_child+0x9b>
+  8043d6:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8043d8:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8043de:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8043e3:	77 18                	ja     8043fd <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8043e5:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8043ea:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8043ec:	c1 e8 10             	shr    $0x10,%eax
+  8043ef:	74 0c                	je     8043fd <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8043f1:	c1 e0 10             	shl    $0x10,%eax
+  8043f4:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8043f9:	29 c2                	sub    %eax,%edx
+  8043fb:	eb 06                	jmp    804403 <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  8043fd:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		threads[self].th_env = thisenv->env_id;
+  804403:	8b 02                	mov    (%edx),%eax
+  804405:	8b 48 48             	mov    0x48(%eax),%ecx
+  804408:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  80440f:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  804412:	89 0c 95 40 70 80 00 	mov    %ecx,0x807040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  804419:	8d 04 95 40 70 80 00 	lea    0x807040(,%edx,4),%eax
+  804420:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  804427:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80442a:	c9                   	leave
+  80442b:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  80442c:	83 ec 04             	sub    $0x4,%esp
+  80442f:	68 80 02 00 00       	push   $0x280
+  804434:	6a 00                	push   $0x0
+  804436:	68 40 70 80 00       	push   $0x807040
+  80443b:	e8 ef c7 ff ff       	call   800c2f <memset>
+	threads_mu.m_state = 0;
+  804440:	c7 05 20 70 80 00 00 	movl   $0x0,0x807020
+  804447:	00 00 00 
+  80444a:	83 c4 10             	add    $0x10,%esp
+  80444d:	eb d8                	jmp    804427 <pthread_fork_child+0x9b>
+
+0080444f <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80444f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804454:	c3                   	ret
+
+00804455 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  804455:	55                   	push   %ebp
+  804456:	89 e5                	mov    %esp,%ebp
+  804458:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80445b:	68 f9 52 80 00       	push   $0x8052f9
+  804460:	ff 75 0c             	push   0xc(%ebp)
+  804463:	e8 76 c6 ff ff       	call   800ade <strcpy>
+	return 0;
+}
+  804468:	b8 00 00 00 00       	mov    $0x0,%eax
+  80446d:	c9                   	leave
+  80446e:	c3                   	ret
+
+0080446f <devcons_write>:
+{
+  80446f:	55                   	push   %ebp
+  804470:	89 e5                	mov    %esp,%ebp
+  804472:	57                   	push   %edi
+  804473:	56                   	push   %esi
+  804474:	53                   	push   %ebx
+  804475:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80447b:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  804480:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  804486:	eb 2e                	jmp    8044b6 <devcons_write+0x47>
+		m = n - tot;
+  804488:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80448b:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80448d:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804492:	39 c3                	cmp    %eax,%ebx
+  804494:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  804497:	83 ec 04             	sub    $0x4,%esp
+  80449a:	53                   	push   %ebx
+  80449b:	89 f0                	mov    %esi,%eax
+  80449d:	03 45 0c             	add    0xc(%ebp),%eax
+  8044a0:	50                   	push   %eax
+  8044a1:	57                   	push   %edi
+  8044a2:	e8 bd c7 ff ff       	call   800c64 <memmove>
+		sys_cputs(buf, m);
+  8044a7:	83 c4 08             	add    $0x8,%esp
+  8044aa:	53                   	push   %ebx
+  8044ab:	57                   	push   %edi
+  8044ac:	e8 71 c9 ff ff       	call   800e22 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8044b1:	01 de                	add    %ebx,%esi
+  8044b3:	83 c4 10             	add    $0x10,%esp
+  8044b6:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8044b9:	72 cd                	jb     804488 <devcons_write+0x19>
+}
+  8044bb:	89 f0                	mov    %esi,%eax
+  8044bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8044c0:	5b                   	pop    %ebx
+  8044c1:	5e                   	pop    %esi
+  8044c2:	5f                   	pop    %edi
+  8044c3:	5d                   	pop    %ebp
+  8044c4:	c3                   	ret
+
+008044c5 <devcons_read>:
+{
+  8044c5:	55                   	push   %ebp
+  8044c6:	89 e5                	mov    %esp,%ebp
+  8044c8:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8044cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044d0:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8044d4:	75 07                	jne    8044dd <devcons_read+0x18>
+  8044d6:	eb 1f                	jmp    8044f7 <devcons_read+0x32>
+		sys_yield();
+  8044d8:	e8 13 ca ff ff       	call   800ef0 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8044dd:	e8 6b c9 ff ff       	call   800e4d <sys_cgetc>
+  8044e2:	85 c0                	test   %eax,%eax
+  8044e4:	74 f2                	je     8044d8 <devcons_read+0x13>
+	if (c < 0)
+  8044e6:	78 0f                	js     8044f7 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8044e8:	83 f8 04             	cmp    $0x4,%eax
+  8044eb:	74 0c                	je     8044f9 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8044ed:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8044f0:	88 02                	mov    %al,(%edx)
+	return 1;
+  8044f2:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8044f7:	c9                   	leave
+  8044f8:	c3                   	ret
+		return 0;
+  8044f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044fe:	eb f7                	jmp    8044f7 <devcons_read+0x32>
+
+00804500 <cputchar>:
+{
+  804500:	55                   	push   %ebp
+  804501:	89 e5                	mov    %esp,%ebp
+  804503:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  804506:	8b 45 08             	mov    0x8(%ebp),%eax
+  804509:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80450c:	6a 01                	push   $0x1
+  80450e:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804511:	50                   	push   %eax
+  804512:	e8 0b c9 ff ff       	call   800e22 <sys_cputs>
+}
+  804517:	83 c4 10             	add    $0x10,%esp
+  80451a:	c9                   	leave
+  80451b:	c3                   	ret
+
+0080451c <getchar>:
+{
+  80451c:	55                   	push   %ebp
+  80451d:	89 e5                	mov    %esp,%ebp
+  80451f:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  804522:	6a 01                	push   $0x1
+  804524:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804527:	50                   	push   %eax
+  804528:	6a 00                	push   $0x0
+  80452a:	e8 12 d8 ff ff       	call   801d41 <read>
+	if (r < 0)
+  80452f:	83 c4 10             	add    $0x10,%esp
+  804532:	85 c0                	test   %eax,%eax
+  804534:	78 06                	js     80453c <getchar+0x20>
+	if (r < 1)
+  804536:	74 06                	je     80453e <getchar+0x22>
+	return c;
+  804538:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80453c:	c9                   	leave
+  80453d:	c3                   	ret
+		return -E_EOF;
+  80453e:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804543:	eb f7                	jmp    80453c <getchar+0x20>
+
+00804545 <iscons>:
+{
+  804545:	55                   	push   %ebp
+  804546:	89 e5                	mov    %esp,%ebp
+  804548:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80454b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80454e:	50                   	push   %eax
+  80454f:	ff 75 08             	push   0x8(%ebp)
+  804552:	e8 5a d5 ff ff       	call   801ab1 <fd_lookup>
+  804557:	83 c4 10             	add    $0x10,%esp
+  80455a:	85 c0                	test   %eax,%eax
+  80455c:	78 11                	js     80456f <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80455e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804561:	8b 15 b8 62 80 00    	mov    0x8062b8,%edx
+  804567:	39 10                	cmp    %edx,(%eax)
+  804569:	0f 94 c0             	sete   %al
+  80456c:	0f b6 c0             	movzbl %al,%eax
+}
+  80456f:	c9                   	leave
+  804570:	c3                   	ret
+
+00804571 <opencons>:
+{
+  804571:	55                   	push   %ebp
+  804572:	89 e5                	mov    %esp,%ebp
+  804574:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  804577:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80457a:	50                   	push   %eax
+  80457b:	e8 db d4 ff ff       	call   801a5b <fd_alloc>
+  804580:	83 c4 10             	add    $0x10,%esp
+  804583:	85 c0                	test   %eax,%eax
+  804585:	78 3a                	js     8045c1 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  804587:	83 ec 04             	sub    $0x4,%esp
+  80458a:	68 07 04 00 00       	push   $0x407
+  80458f:	ff 75 f4             	push   -0xc(%ebp)
+  804592:	6a 00                	push   $0x0
+  804594:	e8 83 c9 ff ff       	call   800f1c <sys_page_alloc>
+  804599:	83 c4 10             	add    $0x10,%esp
+  80459c:	85 c0                	test   %eax,%eax
+  80459e:	78 21                	js     8045c1 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8045a0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8045a3:	8b 15 b8 62 80 00    	mov    0x8062b8,%edx
+  8045a9:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8045ab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8045ae:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8045b5:	83 ec 0c             	sub    $0xc,%esp
+  8045b8:	50                   	push   %eax
+  8045b9:	e8 76 d4 ff ff       	call   801a34 <fd2num>
+  8045be:	83 c4 10             	add    $0x10,%esp
+}
+  8045c1:	c9                   	leave
+  8045c2:	c3                   	ret
+
+008045c3 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8045c3:	55                   	push   %ebp
+  8045c4:	89 e5                	mov    %esp,%ebp
+  8045c6:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  8045c9:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  8045d0:	74 0a                	je     8045dc <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8045d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8045d5:	a3 00 a0 80 00       	mov    %eax,0x80a000
+}
+  8045da:	c9                   	leave
+  8045db:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  8045dc:	83 ec 04             	sub    $0x4,%esp
+  8045df:	6a 07                	push   $0x7
+  8045e1:	68 00 f0 bf ee       	push   $0xeebff000
+  8045e6:	6a 00                	push   $0x0
+  8045e8:	e8 2f c9 ff ff       	call   800f1c <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8045ed:	83 c4 08             	add    $0x8,%esp
+  8045f0:	68 01 46 80 00       	push   $0x804601
+  8045f5:	6a 00                	push   $0x0
+  8045f7:	e8 9d ca ff ff       	call   801099 <sys_env_set_pgfault_upcall>
+  8045fc:	83 c4 10             	add    $0x10,%esp
+  8045ff:	eb d1                	jmp    8045d2 <set_pgfault_handler+0xf>
+
+00804601 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804601:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804602:	a1 00 a0 80 00       	mov    0x80a000,%eax
+	call *%eax
+  804607:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804609:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  80460c:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  804610:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  804614:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  804617:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  80461b:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  80461d:	83 c4 08             	add    $0x8,%esp
+	popal
+  804620:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  804621:	83 c4 04             	add    $0x4,%esp
+	popfl
+  804624:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  804625:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  804626:	c3                   	ret
+
+00804627 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  804627:	55                   	push   %ebp
+  804628:	89 e5                	mov    %esp,%ebp
+  80462a:	57                   	push   %edi
+  80462b:	56                   	push   %esi
+  80462c:	53                   	push   %ebx
+  80462d:	83 ec 18             	sub    $0x18,%esp
+  804630:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804633:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804636:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  804639:	85 c0                	test   %eax,%eax
+  80463b:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804640:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  804643:	50                   	push   %eax
+  804644:	e8 c9 ca ff ff       	call   801112 <sys_ipc_recv>
+	if (r < 0) {
+  804649:	83 c4 10             	add    $0x10,%esp
+  80464c:	85 c0                	test   %eax,%eax
+  80464e:	78 2b                	js     80467b <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  804650:	85 ff                	test   %edi,%edi
+  804652:	74 55                	je     8046a9 <ipc_recv+0x82>
+  804654:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804656:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80465c:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804661:	77 39                	ja     80469c <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804663:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804668:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80466a:	c1 e8 10             	shr    $0x10,%eax
+  80466d:	74 2d                	je     80469c <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80466f:	c1 e0 10             	shl    $0x10,%eax
+  804672:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804677:	29 c2                	sub    %eax,%edx
+  804679:	eb 27                	jmp    8046a2 <ipc_recv+0x7b>
+  80467b:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  80467d:	83 ec 08             	sub    $0x8,%esp
+  804680:	50                   	push   %eax
+  804681:	68 05 53 80 00       	push   $0x805305
+  804686:	e8 6f be ff ff       	call   8004fa <cprintf>
+		*from_env_store = 0;
+  80468b:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  804691:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  804697:	83 c4 10             	add    $0x10,%esp
+  80469a:	eb 77                	jmp    804713 <ipc_recv+0xec>
+		return pthread_main_tls;
+  80469c:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  8046a2:	8b 02                	mov    (%edx),%eax
+  8046a4:	8b 40 78             	mov    0x78(%eax),%eax
+  8046a7:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8046a9:	85 f6                	test   %esi,%esi
+  8046ab:	74 34                	je     8046e1 <ipc_recv+0xba>
+  8046ad:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8046af:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8046b5:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8046ba:	77 18                	ja     8046d4 <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8046bc:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8046c1:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8046c3:	c1 e8 10             	shr    $0x10,%eax
+  8046c6:	74 0c                	je     8046d4 <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8046c8:	c1 e0 10             	shl    $0x10,%eax
+  8046cb:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8046d0:	29 c2                	sub    %eax,%edx
+  8046d2:	eb 06                	jmp    8046da <ipc_recv+0xb3>
+		return pthread_main_tls;
+  8046d4:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  8046da:	8b 02                	mov    (%edx),%eax
+  8046dc:	8b 40 7c             	mov    0x7c(%eax),%eax
+  8046df:	89 06                	mov    %eax,(%esi)
+  8046e1:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8046e3:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8046e9:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8046ee:	77 18                	ja     804708 <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8046f0:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8046f5:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8046f7:	c1 e8 10             	shr    $0x10,%eax
+  8046fa:	74 0c                	je     804708 <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8046fc:	c1 e0 10             	shl    $0x10,%eax
+  8046ff:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804704:	29 c2                	sub    %eax,%edx
+  804706:	eb 06                	jmp    80470e <ipc_recv+0xe7>
+		return pthread_main_tls;
+  804708:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+	}
+	return thisenv->env_ipc_value;
+  80470e:	8b 02                	mov    (%edx),%eax
+  804710:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  804713:	89 d8                	mov    %ebx,%eax
+  804715:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804718:	5b                   	pop    %ebx
+  804719:	5e                   	pop    %esi
+  80471a:	5f                   	pop    %edi
+  80471b:	5d                   	pop    %ebp
+  80471c:	c3                   	ret
+
+0080471d <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  80471d:	55                   	push   %ebp
+  80471e:	89 e5                	mov    %esp,%ebp
+  804720:	57                   	push   %edi
+  804721:	56                   	push   %esi
+  804722:	53                   	push   %ebx
+  804723:	83 ec 0c             	sub    $0xc,%esp
+  804726:	8b 75 08             	mov    0x8(%ebp),%esi
+  804729:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80472c:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  80472f:	85 db                	test   %ebx,%ebx
+  804731:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  804736:	0f 44 d8             	cmove  %eax,%ebx
+  804739:	eb 05                	jmp    804740 <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  80473b:	e8 b0 c7 ff ff       	call   800ef0 <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  804740:	57                   	push   %edi
+  804741:	53                   	push   %ebx
+  804742:	ff 75 0c             	push   0xc(%ebp)
+  804745:	56                   	push   %esi
+  804746:	e8 9a c9 ff ff       	call   8010e5 <sys_ipc_try_send>
+		if (r == 0) {
+  80474b:	83 c4 10             	add    $0x10,%esp
+  80474e:	85 c0                	test   %eax,%eax
+  804750:	74 19                	je     80476b <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  804752:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  804755:	74 e4                	je     80473b <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  804757:	83 ec 0c             	sub    $0xc,%esp
+  80475a:	50                   	push   %eax
+  80475b:	57                   	push   %edi
+  80475c:	53                   	push   %ebx
+  80475d:	56                   	push   %esi
+  80475e:	68 20 53 80 00       	push   $0x805320
+  804763:	e8 92 bd ff ff       	call   8004fa <cprintf>
+			return;
+  804768:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  80476b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80476e:	5b                   	pop    %ebx
+  80476f:	5e                   	pop    %esi
+  804770:	5f                   	pop    %edi
+  804771:	5d                   	pop    %ebp
+  804772:	c3                   	ret
+
+00804773 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804773:	55                   	push   %ebp
+  804774:	89 e5                	mov    %esp,%ebp
+  804776:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  804779:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  80477e:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804781:	c1 e0 04             	shl    $0x4,%eax
+  804784:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804789:	8b 40 50             	mov    0x50(%eax),%eax
+  80478c:	39 c8                	cmp    %ecx,%eax
+  80478e:	74 12                	je     8047a2 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804790:	83 c2 01             	add    $0x1,%edx
+  804793:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  804799:	75 e3                	jne    80477e <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  80479b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047a0:	eb 0e                	jmp    8047b0 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8047a2:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8047a5:	c1 e0 04             	shl    $0x4,%eax
+  8047a8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8047ad:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8047b0:	5d                   	pop    %ebp
+  8047b1:	c3                   	ret
+
+008047b2 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8047b2:	55                   	push   %ebp
+  8047b3:	89 e5                	mov    %esp,%ebp
+  8047b5:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8047b8:	89 c2                	mov    %eax,%edx
+  8047ba:	c1 ea 16             	shr    $0x16,%edx
+  8047bd:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8047c4:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8047c9:	f6 c1 01             	test   $0x1,%cl
+  8047cc:	74 1c                	je     8047ea <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  8047ce:	c1 e8 0c             	shr    $0xc,%eax
+  8047d1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8047d8:	a8 01                	test   $0x1,%al
+  8047da:	74 0e                	je     8047ea <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8047dc:	c1 e8 0c             	shr    $0xc,%eax
+  8047df:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  8047e6:	ef 
+  8047e7:	0f b7 d2             	movzwl %dx,%edx
+}
+  8047ea:	89 d0                	mov    %edx,%eax
+  8047ec:	5d                   	pop    %ebp
+  8047ed:	c3                   	ret
+
+008047ee <udm>:
+  8047ee:	57                   	push   %edi
+  8047ef:	56                   	push   %esi
+  8047f0:	53                   	push   %ebx
+  8047f1:	83 ec 20             	sub    $0x20,%esp
+  8047f4:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8047f8:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8047fc:	8b 44 24 30          	mov    0x30(%esp),%eax
+  804800:	8b 54 24 34          	mov    0x34(%esp),%edx
+  804804:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804808:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80480c:	89 d1                	mov    %edx,%ecx
+  80480e:	09 c1                	or     %eax,%ecx
+  804810:	0f 84 91 00 00 00    	je     8048a7 <udm+0xb9>
+  804816:	b8 00 00 00 00       	mov    $0x0,%eax
+  80481b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804820:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804825:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80482c:	00 
+  80482d:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  804834:	00 
+  804835:	eb 08                	jmp    80483f <udm+0x51>
+  804837:	83 e9 01             	sub    $0x1,%ecx
+  80483a:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80483d:	74 7c                	je     8048bb <udm+0xcd>
+  80483f:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804843:	01 c0                	add    %eax,%eax
+  804845:	89 c6                	mov    %eax,%esi
+  804847:	89 d7                	mov    %edx,%edi
+  804849:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80484d:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804851:	0f ad d0             	shrd   %cl,%edx,%eax
+  804854:	d3 ea                	shr    %cl,%edx
+  804856:	f6 c1 20             	test   $0x20,%cl
+  804859:	74 04                	je     80485f <udm+0x71>
+  80485b:	89 d0                	mov    %edx,%eax
+  80485d:	31 d2                	xor    %edx,%edx
+  80485f:	83 e0 01             	and    $0x1,%eax
+  804862:	89 04 24             	mov    %eax,(%esp)
+  804865:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80486c:	00 
+  80486d:	8b 04 24             	mov    (%esp),%eax
+  804870:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804874:	09 f0                	or     %esi,%eax
+  804876:	09 fa                	or     %edi,%edx
+  804878:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80487c:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804880:	39 f0                	cmp    %esi,%eax
+  804882:	89 d3                	mov    %edx,%ebx
+  804884:	19 fb                	sbb    %edi,%ebx
+  804886:	72 af                	jb     804837 <udm+0x49>
+  804888:	29 f0                	sub    %esi,%eax
+  80488a:	19 fa                	sbb    %edi,%edx
+  80488c:	89 cf                	mov    %ecx,%edi
+  80488e:	c1 ef 05             	shr    $0x5,%edi
+  804891:	83 e7 01             	and    $0x1,%edi
+  804894:	89 fe                	mov    %edi,%esi
+  804896:	83 f6 01             	xor    $0x1,%esi
+  804899:	d3 e6                	shl    %cl,%esi
+  80489b:	d3 e7                	shl    %cl,%edi
+  80489d:	09 74 24 18          	or     %esi,0x18(%esp)
+  8048a1:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8048a5:	eb 90                	jmp    804837 <udm+0x49>
+  8048a7:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8048ab:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8048af:	89 f0                	mov    %esi,%eax
+  8048b1:	89 fa                	mov    %edi,%edx
+  8048b3:	89 74 24 18          	mov    %esi,0x18(%esp)
+  8048b7:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  8048bb:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  8048bf:	89 01                	mov    %eax,(%ecx)
+  8048c1:	89 51 04             	mov    %edx,0x4(%ecx)
+  8048c4:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8048c8:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8048cc:	83 c4 20             	add    $0x20,%esp
+  8048cf:	5b                   	pop    %ebx
+  8048d0:	5e                   	pop    %esi
+  8048d1:	5f                   	pop    %edi
+  8048d2:	c3                   	ret
+
+008048d3 <__udivdi3>:
+  8048d3:	83 ec 18             	sub    $0x18,%esp
+  8048d6:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8048da:	50                   	push   %eax
+  8048db:	ff 74 24 2c          	push   0x2c(%esp)
+  8048df:	ff 74 24 2c          	push   0x2c(%esp)
+  8048e3:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8048e7:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8048eb:	e8 fe fe ff ff       	call   8047ee <udm>
+  8048f0:	83 c4 24             	add    $0x24,%esp
+  8048f3:	c3                   	ret
+
+008048f4 <__umoddi3>:
+  8048f4:	83 ec 18             	sub    $0x18,%esp
+  8048f7:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8048fb:	50                   	push   %eax
+  8048fc:	ff 74 24 2c          	push   0x2c(%esp)
+  804900:	ff 74 24 2c          	push   0x2c(%esp)
+  804904:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804908:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80490c:	e8 dd fe ff ff       	call   8047ee <udm>
+  804911:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804915:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804919:	83 c4 24             	add    $0x24,%esp
+  80491c:	c3                   	ret
+
+0080491d <__divdi3>:
+  80491d:	56                   	push   %esi
+  80491e:	53                   	push   %ebx
+  80491f:	83 ec 14             	sub    $0x14,%esp
+  804922:	8b 44 24 20          	mov    0x20(%esp),%eax
+  804926:	8b 54 24 24          	mov    0x24(%esp),%edx
+  80492a:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  80492e:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  804932:	85 d2                	test   %edx,%edx
+  804934:	78 18                	js     80494e <__divdi3+0x31>
+  804936:	85 db                	test   %ebx,%ebx
+  804938:	78 3e                	js     804978 <__divdi3+0x5b>
+  80493a:	83 ec 04             	sub    $0x4,%esp
+  80493d:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804941:	56                   	push   %esi
+  804942:	53                   	push   %ebx
+  804943:	51                   	push   %ecx
+  804944:	e8 a5 fe ff ff       	call   8047ee <udm>
+  804949:	83 c4 10             	add    $0x10,%esp
+  80494c:	eb 24                	jmp    804972 <__divdi3+0x55>
+  80494e:	f7 d8                	neg    %eax
+  804950:	83 d2 00             	adc    $0x0,%edx
+  804953:	f7 da                	neg    %edx
+  804955:	85 db                	test   %ebx,%ebx
+  804957:	78 3a                	js     804993 <__divdi3+0x76>
+  804959:	83 ec 04             	sub    $0x4,%esp
+  80495c:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804960:	56                   	push   %esi
+  804961:	53                   	push   %ebx
+  804962:	51                   	push   %ecx
+  804963:	e8 86 fe ff ff       	call   8047ee <udm>
+  804968:	83 c4 10             	add    $0x10,%esp
+  80496b:	f7 d8                	neg    %eax
+  80496d:	83 d2 00             	adc    $0x0,%edx
+  804970:	f7 da                	neg    %edx
+  804972:	83 c4 14             	add    $0x14,%esp
+  804975:	5b                   	pop    %ebx
+  804976:	5e                   	pop    %esi
+  804977:	c3                   	ret
+  804978:	83 ec 04             	sub    $0x4,%esp
+  80497b:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80497f:	56                   	push   %esi
+  804980:	f7 d9                	neg    %ecx
+  804982:	83 d3 00             	adc    $0x0,%ebx
+  804985:	f7 db                	neg    %ebx
+  804987:	53                   	push   %ebx
+  804988:	51                   	push   %ecx
+  804989:	e8 60 fe ff ff       	call   8047ee <udm>
+  80498e:	83 c4 10             	add    $0x10,%esp
+  804991:	eb d8                	jmp    80496b <__divdi3+0x4e>
+  804993:	83 ec 04             	sub    $0x4,%esp
+  804996:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80499a:	56                   	push   %esi
+  80499b:	f7 d9                	neg    %ecx
+  80499d:	83 d3 00             	adc    $0x0,%ebx
+  8049a0:	f7 db                	neg    %ebx
+  8049a2:	53                   	push   %ebx
+  8049a3:	51                   	push   %ecx
+  8049a4:	e8 45 fe ff ff       	call   8047ee <udm>
+  8049a9:	83 c4 10             	add    $0x10,%esp
+  8049ac:	eb c4                	jmp    804972 <__divdi3+0x55>
+
+008049ae <__moddi3>:
+  8049ae:	55                   	push   %ebp
+  8049af:	57                   	push   %edi
+  8049b0:	56                   	push   %esi
+  8049b1:	53                   	push   %ebx
+  8049b2:	83 ec 24             	sub    $0x24,%esp
+  8049b5:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8049b9:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8049bd:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8049c1:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8049c5:	85 d2                	test   %edx,%edx
+  8049c7:	78 3b                	js     804a04 <__moddi3+0x56>
+  8049c9:	83 ec 04             	sub    $0x4,%esp
+  8049cc:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8049d0:	56                   	push   %esi
+  8049d1:	89 ce                	mov    %ecx,%esi
+  8049d3:	f7 de                	neg    %esi
+  8049d5:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8049d9:	89 de                	mov    %ebx,%esi
+  8049db:	83 d6 00             	adc    $0x0,%esi
+  8049de:	f7 de                	neg    %esi
+  8049e0:	89 74 24 14          	mov    %esi,0x14(%esp)
+  8049e4:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8049e8:	0f 48 f1             	cmovs  %ecx,%esi
+  8049eb:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  8049f0:	53                   	push   %ebx
+  8049f1:	56                   	push   %esi
+  8049f2:	e8 f7 fd ff ff       	call   8047ee <udm>
+  8049f7:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8049fb:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8049ff:	83 c4 10             	add    $0x10,%esp
+  804a02:	eb 47                	jmp    804a4b <__moddi3+0x9d>
+  804a04:	f7 d8                	neg    %eax
+  804a06:	83 d2 00             	adc    $0x0,%edx
+  804a09:	f7 da                	neg    %edx
+  804a0b:	83 ec 04             	sub    $0x4,%esp
+  804a0e:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804a12:	56                   	push   %esi
+  804a13:	89 cf                	mov    %ecx,%edi
+  804a15:	f7 df                	neg    %edi
+  804a17:	89 de                	mov    %ebx,%esi
+  804a19:	83 d6 00             	adc    $0x0,%esi
+  804a1c:	f7 de                	neg    %esi
+  804a1e:	0f 49 cf             	cmovns %edi,%ecx
+  804a21:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  804a25:	0f 49 de             	cmovns %esi,%ebx
+  804a28:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  804a2c:	ff 74 24 0c          	push   0xc(%esp)
+  804a30:	ff 74 24 0c          	push   0xc(%esp)
+  804a34:	e8 b5 fd ff ff       	call   8047ee <udm>
+  804a39:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804a3d:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804a41:	f7 d8                	neg    %eax
+  804a43:	83 d2 00             	adc    $0x0,%edx
+  804a46:	f7 da                	neg    %edx
+  804a48:	83 c4 10             	add    $0x10,%esp
+  804a4b:	83 c4 24             	add    $0x24,%esp
+  804a4e:	5b                   	pop    %ebx
+  804a4f:	5e                   	pop    %esi
+  804a50:	5f                   	pop    %edi
+  804a51:	5d                   	pop    %ebp
+  804a52:	c3                   	ret
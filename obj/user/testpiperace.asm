@@ -0,0 +1,9860 @@
+
+obj/user/testpiperace.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 bd 01 00 00       	call   8001ee <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	83 ec 1c             	sub    $0x1c,%esp
+	int p[2], r, pid, i, max;
+	void *va;
+	struct Fd *fd;
+	const volatile struct Env *kid;
+
+	cprintf("testing for dup race...\n");
+  80003b:	68 80 48 80 00       	push   $0x804880
+  800040:	e8 27 03 00 00       	call   80036c <cprintf>
+	if ((r = pipe(p)) < 0)
+  800045:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800048:	89 04 24             	mov    %eax,(%esp)
+  80004b:	e8 50 3a 00 00       	call   803aa0 <pipe>
+  800050:	83 c4 10             	add    $0x10,%esp
+  800053:	85 c0                	test   %eax,%eax
+  800055:	78 59                	js     8000b0 <umain+0x7d>
+		panic("pipe: %e", r);
+	max = 200;
+	if ((r = fork()) < 0)
+  800057:	e8 ee 13 00 00       	call   80144a <fork>
+  80005c:	89 c6                	mov    %eax,%esi
+  80005e:	85 c0                	test   %eax,%eax
+  800060:	78 60                	js     8000c2 <umain+0x8f>
+		panic("fork: %e", r);
+	if (r == 0) {
+  800062:	74 70                	je     8000d4 <umain+0xa1>
+		}
+		// do something to be not runnable besides exiting
+		ipc_recv(0,0,0);
+	}
+	pid = r;
+	cprintf("pid is %d\n", pid);
+  800064:	83 ec 08             	sub    $0x8,%esp
+  800067:	56                   	push   %esi
+  800068:	68 da 48 80 00       	push   $0x8048da
+  80006d:	e8 fa 02 00 00       	call   80036c <cprintf>
+	va = 0;
+	kid = &envs[ENVX(pid)];
+  800072:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	cprintf("kid is %d\n", kid-envs);
+  800078:	83 c4 08             	add    $0x8,%esp
+  80007b:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  80007e:	69 c0 39 8e e3 38    	imul   $0x38e38e39,%eax,%eax
+  800084:	50                   	push   %eax
+  800085:	68 e5 48 80 00       	push   $0x8048e5
+  80008a:	e8 dd 02 00 00       	call   80036c <cprintf>
+	dup(p[0], 10);
+  80008f:	83 c4 08             	add    $0x8,%esp
+  800092:	6a 0a                	push   $0xa
+  800094:	ff 75 f0             	push   -0x10(%ebp)
+  800097:	e8 b8 1b 00 00       	call   801c54 <dup>
+	while (kid->env_status == ENV_RUNNABLE)
+  80009c:	83 c4 10             	add    $0x10,%esp
+  80009f:	8d 1c f6             	lea    (%esi,%esi,8),%ebx
+  8000a2:	c1 e3 04             	shl    $0x4,%ebx
+  8000a5:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  8000ab:	e9 92 00 00 00       	jmp    800142 <umain+0x10f>
+		panic("pipe: %e", r);
+  8000b0:	50                   	push   %eax
+  8000b1:	68 99 48 80 00       	push   $0x804899
+  8000b6:	6a 0d                	push   $0xd
+  8000b8:	68 a2 48 80 00       	push   $0x8048a2
+  8000bd:	e8 cf 01 00 00       	call   800291 <_panic>
+		panic("fork: %e", r);
+  8000c2:	50                   	push   %eax
+  8000c3:	68 b6 48 80 00       	push   $0x8048b6
+  8000c8:	6a 10                	push   $0x10
+  8000ca:	68 a2 48 80 00       	push   $0x8048a2
+  8000cf:	e8 bd 01 00 00       	call   800291 <_panic>
+		close(p[1]);
+  8000d4:	83 ec 0c             	sub    $0xc,%esp
+  8000d7:	ff 75 f4             	push   -0xc(%ebp)
+  8000da:	e8 23 1b 00 00       	call   801c02 <close>
+		for (i=0; i<max; i++) {
+  8000df:	83 c4 10             	add    $0x10,%esp
+  8000e2:	bb c9 00 00 00       	mov    $0xc9,%ebx
+  8000e7:	eb 05                	jmp    8000ee <umain+0xbb>
+			sys_yield();
+  8000e9:	e8 74 0c 00 00       	call   800d62 <sys_yield>
+		for (i=0; i<max; i++) {
+  8000ee:	83 eb 01             	sub    $0x1,%ebx
+  8000f1:	74 29                	je     80011c <umain+0xe9>
+			if(pipeisclosed(p[0])){
+  8000f3:	83 ec 0c             	sub    $0xc,%esp
+  8000f6:	ff 75 f0             	push   -0x10(%ebp)
+  8000f9:	e8 ec 3a 00 00       	call   803bea <pipeisclosed>
+  8000fe:	83 c4 10             	add    $0x10,%esp
+  800101:	85 c0                	test   %eax,%eax
+  800103:	74 e4                	je     8000e9 <umain+0xb6>
+				cprintf("RACE: pipe appears closed\n");
+  800105:	83 ec 0c             	sub    $0xc,%esp
+  800108:	68 bf 48 80 00       	push   $0x8048bf
+  80010d:	e8 5a 02 00 00       	call   80036c <cprintf>
+				exit();
+  800112:	e8 52 01 00 00       	call   800269 <exit>
+  800117:	83 c4 10             	add    $0x10,%esp
+  80011a:	eb cd                	jmp    8000e9 <umain+0xb6>
+		ipc_recv(0,0,0);
+  80011c:	83 ec 04             	sub    $0x4,%esp
+  80011f:	6a 00                	push   $0x0
+  800121:	6a 00                	push   $0x0
+  800123:	6a 00                	push   $0x0
+  800125:	e8 7c 17 00 00       	call   8018a6 <ipc_recv>
+  80012a:	83 c4 10             	add    $0x10,%esp
+  80012d:	e9 32 ff ff ff       	jmp    800064 <umain+0x31>
+		dup(p[0], 10);
+  800132:	83 ec 08             	sub    $0x8,%esp
+  800135:	6a 0a                	push   $0xa
+  800137:	ff 75 f0             	push   -0x10(%ebp)
+  80013a:	e8 15 1b 00 00       	call   801c54 <dup>
+  80013f:	83 c4 10             	add    $0x10,%esp
+	while (kid->env_status == ENV_RUNNABLE)
+  800142:	8b 43 54             	mov    0x54(%ebx),%eax
+  800145:	83 f8 02             	cmp    $0x2,%eax
+  800148:	74 e8                	je     800132 <umain+0xff>
+
+	cprintf("child done with loop\n");
+  80014a:	83 ec 0c             	sub    $0xc,%esp
+  80014d:	68 f0 48 80 00       	push   $0x8048f0
+  800152:	e8 15 02 00 00       	call   80036c <cprintf>
+	if (pipeisclosed(p[0]))
+  800157:	83 c4 04             	add    $0x4,%esp
+  80015a:	ff 75 f0             	push   -0x10(%ebp)
+  80015d:	e8 88 3a 00 00       	call   803bea <pipeisclosed>
+  800162:	83 c4 10             	add    $0x10,%esp
+  800165:	85 c0                	test   %eax,%eax
+  800167:	75 48                	jne    8001b1 <umain+0x17e>
+		panic("somehow the other end of p[0] got closed!");
+	if ((r = fd_lookup(p[0], &fd)) < 0)
+  800169:	83 ec 08             	sub    $0x8,%esp
+  80016c:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80016f:	50                   	push   %eax
+  800170:	ff 75 f0             	push   -0x10(%ebp)
+  800173:	e8 36 19 00 00       	call   801aae <fd_lookup>
+  800178:	83 c4 10             	add    $0x10,%esp
+  80017b:	85 c0                	test   %eax,%eax
+  80017d:	78 46                	js     8001c5 <umain+0x192>
+		panic("cannot look up p[0]: %e", r);
+	va = fd2data(fd);
+  80017f:	83 ec 0c             	sub    $0xc,%esp
+  800182:	ff 75 ec             	push   -0x14(%ebp)
+  800185:	e8 b7 18 00 00       	call   801a41 <fd2data>
+	if (pageref(va) != 3+1)
+  80018a:	89 04 24             	mov    %eax,(%esp)
+  80018d:	e8 91 2e 00 00       	call   803023 <pageref>
+  800192:	83 c4 10             	add    $0x10,%esp
+  800195:	83 f8 04             	cmp    $0x4,%eax
+  800198:	74 3d                	je     8001d7 <umain+0x1a4>
+		cprintf("\nchild detected race\n");
+  80019a:	83 ec 0c             	sub    $0xc,%esp
+  80019d:	68 1e 49 80 00       	push   $0x80491e
+  8001a2:	e8 c5 01 00 00       	call   80036c <cprintf>
+  8001a7:	83 c4 10             	add    $0x10,%esp
+	else
+		cprintf("\nrace didn't happen\n", max);
+}
+  8001aa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8001ad:	5b                   	pop    %ebx
+  8001ae:	5e                   	pop    %esi
+  8001af:	5d                   	pop    %ebp
+  8001b0:	c3                   	ret
+		panic("somehow the other end of p[0] got closed!");
+  8001b1:	83 ec 04             	sub    $0x4,%esp
+  8001b4:	68 4c 49 80 00       	push   $0x80494c
+  8001b9:	6a 3a                	push   $0x3a
+  8001bb:	68 a2 48 80 00       	push   $0x8048a2
+  8001c0:	e8 cc 00 00 00       	call   800291 <_panic>
+		panic("cannot look up p[0]: %e", r);
+  8001c5:	50                   	push   %eax
+  8001c6:	68 06 49 80 00       	push   $0x804906
+  8001cb:	6a 3c                	push   $0x3c
+  8001cd:	68 a2 48 80 00       	push   $0x8048a2
+  8001d2:	e8 ba 00 00 00       	call   800291 <_panic>
+		cprintf("\nrace didn't happen\n", max);
+  8001d7:	83 ec 08             	sub    $0x8,%esp
+  8001da:	68 c8 00 00 00       	push   $0xc8
+  8001df:	68 34 49 80 00       	push   $0x804934
+  8001e4:	e8 83 01 00 00       	call   80036c <cprintf>
+  8001e9:	83 c4 10             	add    $0x10,%esp
+}
+  8001ec:	eb bc                	jmp    8001aa <umain+0x177>
+
+008001ee <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001ee:	55                   	push   %ebp
+  8001ef:	89 e5                	mov    %esp,%ebp
+  8001f1:	57                   	push   %edi
+  8001f2:	56                   	push   %esi
+  8001f3:	53                   	push   %ebx
+  8001f4:	83 ec 1c             	sub    $0x1c,%esp
+  8001f7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001fa:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  8001fd:	e8 34 0b 00 00       	call   800d36 <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  800202:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  800205:	89 15 c0 72 80 00    	mov    %edx,0x8072c0
+	thisenv = &envs[ENVX(eid)];
+  80020b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800210:	89 c1                	mov    %eax,%ecx
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  800212:	89 e7                	mov    %esp,%edi
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800214:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  80021a:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80021f:	77 16                	ja     800237 <libmain+0x49>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800221:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800226:	29 f8                	sub    %edi,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  800228:	c1 e8 10             	shr    $0x10,%eax
+  80022b:	74 0a                	je     800237 <libmain+0x49>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80022d:	c1 e0 10             	shl    $0x10,%eax
+  800230:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800235:	29 c2                	sub    %eax,%edx
+  800237:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  80023a:	c1 e0 04             	shl    $0x4,%eax
+  80023d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800242:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800244:	85 db                	test   %ebx,%ebx
+  800246:	7e 07                	jle    80024f <libmain+0x61>
+		binaryname = argv[0];
+  800248:	8b 06                	mov    (%esi),%eax
+  80024a:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// call user main routine
+	umain(argc, argv);
+  80024f:	83 ec 08             	sub    $0x8,%esp
+  800252:	56                   	push   %esi
+  800253:	53                   	push   %ebx
+  800254:	e8 da fd ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800259:	e8 0b 00 00 00       	call   800269 <exit>
+}
+  80025e:	83 c4 10             	add    $0x10,%esp
+  800261:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800264:	5b                   	pop    %ebx
+  800265:	5e                   	pop    %esi
+  800266:	5f                   	pop    %edi
+  800267:	5d                   	pop    %ebp
+  800268:	c3                   	ret
+
+00800269 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800269:	55                   	push   %ebp
+  80026a:	89 e5                	mov    %esp,%ebp
+  80026c:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  80026f:	6a 00                	push   $0x0
+  800271:	e8 16 29 00 00       	call   802b8c <fflush>
+	pthread_kill_others();
+  800276:	e8 bd 3f 00 00       	call   804238 <pthread_kill_others>
+	close_all();
+  80027b:	e8 af 19 00 00       	call   801c2f <close_all>
+	sys_env_destroy(0);
+  800280:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800287:	e8 5f 0a 00 00       	call   800ceb <sys_env_destroy>
+}
+  80028c:	83 c4 10             	add    $0x10,%esp
+  80028f:	c9                   	leave
+  800290:	c3                   	ret
+
+00800291 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800291:	55                   	push   %ebp
+  800292:	89 e5                	mov    %esp,%ebp
+  800294:	56                   	push   %esi
+  800295:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800296:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800299:	8b 35 00 60 80 00    	mov    0x806000,%esi
+  80029f:	e8 92 0a 00 00       	call   800d36 <sys_getenvid>
+  8002a4:	83 ec 0c             	sub    $0xc,%esp
+  8002a7:	ff 75 0c             	push   0xc(%ebp)
+  8002aa:	ff 75 08             	push   0x8(%ebp)
+  8002ad:	56                   	push   %esi
+  8002ae:	50                   	push   %eax
+  8002af:	68 80 49 80 00       	push   $0x804980
+  8002b4:	e8 b3 00 00 00       	call   80036c <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8002b9:	83 c4 18             	add    $0x18,%esp
+  8002bc:	53                   	push   %ebx
+  8002bd:	ff 75 10             	push   0x10(%ebp)
+  8002c0:	e8 56 00 00 00       	call   80031b <vcprintf>
+	cprintf("\n");
+  8002c5:	c7 04 24 97 48 80 00 	movl   $0x804897,(%esp)
+  8002cc:	e8 9b 00 00 00       	call   80036c <cprintf>
+  8002d1:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8002d4:	cc                   	int3
+	while (1)
+  8002d5:	eb fd                	jmp    8002d4 <_panic+0x43>
+
+008002d7 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8002d7:	55                   	push   %ebp
+  8002d8:	89 e5                	mov    %esp,%ebp
+  8002da:	53                   	push   %ebx
+  8002db:	83 ec 04             	sub    $0x4,%esp
+  8002de:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8002e1:	8b 13                	mov    (%ebx),%edx
+  8002e3:	8d 42 01             	lea    0x1(%edx),%eax
+  8002e6:	89 03                	mov    %eax,(%ebx)
+  8002e8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8002eb:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8002ef:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8002f4:	74 09                	je     8002ff <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8002f6:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8002fa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8002fd:	c9                   	leave
+  8002fe:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8002ff:	83 ec 08             	sub    $0x8,%esp
+  800302:	68 ff 00 00 00       	push   $0xff
+  800307:	8d 43 08             	lea    0x8(%ebx),%eax
+  80030a:	50                   	push   %eax
+  80030b:	e8 84 09 00 00       	call   800c94 <sys_cputs>
+		b->idx = 0;
+  800310:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800316:	83 c4 10             	add    $0x10,%esp
+  800319:	eb db                	jmp    8002f6 <putch+0x1f>
+
+0080031b <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80031b:	55                   	push   %ebp
+  80031c:	89 e5                	mov    %esp,%ebp
+  80031e:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800324:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80032b:	00 00 00 
+	b.cnt = 0;
+  80032e:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800335:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800338:	ff 75 0c             	push   0xc(%ebp)
+  80033b:	ff 75 08             	push   0x8(%ebp)
+  80033e:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800344:	50                   	push   %eax
+  800345:	68 d7 02 80 00       	push   $0x8002d7
+  80034a:	e8 14 01 00 00       	call   800463 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80034f:	83 c4 08             	add    $0x8,%esp
+  800352:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800358:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80035e:	50                   	push   %eax
+  80035f:	e8 30 09 00 00       	call   800c94 <sys_cputs>
+
+	return b.cnt;
+}
+  800364:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80036a:	c9                   	leave
+  80036b:	c3                   	ret
+
+0080036c <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80036c:	55                   	push   %ebp
+  80036d:	89 e5                	mov    %esp,%ebp
+  80036f:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800372:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800375:	50                   	push   %eax
+  800376:	ff 75 08             	push   0x8(%ebp)
+  800379:	e8 9d ff ff ff       	call   80031b <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80037e:	c9                   	leave
+  80037f:	c3                   	ret
+
+00800380 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800380:	55                   	push   %ebp
+  800381:	89 e5                	mov    %esp,%ebp
+  800383:	57                   	push   %edi
+  800384:	56                   	push   %esi
+  800385:	53                   	push   %ebx
+  800386:	83 ec 1c             	sub    $0x1c,%esp
+  800389:	89 c7                	mov    %eax,%edi
+  80038b:	89 d6                	mov    %edx,%esi
+  80038d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800390:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800393:	89 d1                	mov    %edx,%ecx
+  800395:	89 c2                	mov    %eax,%edx
+  800397:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80039a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80039d:	8b 45 10             	mov    0x10(%ebp),%eax
+  8003a0:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8003a3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003a6:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8003ad:	39 c2                	cmp    %eax,%edx
+  8003af:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8003b2:	72 3e                	jb     8003f2 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8003b4:	83 ec 0c             	sub    $0xc,%esp
+  8003b7:	ff 75 18             	push   0x18(%ebp)
+  8003ba:	83 eb 01             	sub    $0x1,%ebx
+  8003bd:	53                   	push   %ebx
+  8003be:	50                   	push   %eax
+  8003bf:	83 ec 08             	sub    $0x8,%esp
+  8003c2:	ff 75 e4             	push   -0x1c(%ebp)
+  8003c5:	ff 75 e0             	push   -0x20(%ebp)
+  8003c8:	ff 75 dc             	push   -0x24(%ebp)
+  8003cb:	ff 75 d8             	push   -0x28(%ebp)
+  8003ce:	e8 21 43 00 00       	call   8046f4 <__udivdi3>
+  8003d3:	83 c4 18             	add    $0x18,%esp
+  8003d6:	52                   	push   %edx
+  8003d7:	50                   	push   %eax
+  8003d8:	89 f2                	mov    %esi,%edx
+  8003da:	89 f8                	mov    %edi,%eax
+  8003dc:	e8 9f ff ff ff       	call   800380 <printnum>
+  8003e1:	83 c4 20             	add    $0x20,%esp
+  8003e4:	eb 13                	jmp    8003f9 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8003e6:	83 ec 08             	sub    $0x8,%esp
+  8003e9:	56                   	push   %esi
+  8003ea:	ff 75 18             	push   0x18(%ebp)
+  8003ed:	ff d7                	call   *%edi
+  8003ef:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8003f2:	83 eb 01             	sub    $0x1,%ebx
+  8003f5:	85 db                	test   %ebx,%ebx
+  8003f7:	7f ed                	jg     8003e6 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8003f9:	83 ec 08             	sub    $0x8,%esp
+  8003fc:	56                   	push   %esi
+  8003fd:	83 ec 04             	sub    $0x4,%esp
+  800400:	ff 75 e4             	push   -0x1c(%ebp)
+  800403:	ff 75 e0             	push   -0x20(%ebp)
+  800406:	ff 75 dc             	push   -0x24(%ebp)
+  800409:	ff 75 d8             	push   -0x28(%ebp)
+  80040c:	e8 04 43 00 00       	call   804715 <__umoddi3>
+  800411:	83 c4 14             	add    $0x14,%esp
+  800414:	0f be 80 a3 49 80 00 	movsbl 0x8049a3(%eax),%eax
+  80041b:	50                   	push   %eax
+  80041c:	ff d7                	call   *%edi
+}
+  80041e:	83 c4 10             	add    $0x10,%esp
+  800421:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800424:	5b                   	pop    %ebx
+  800425:	5e                   	pop    %esi
+  800426:	5f                   	pop    %edi
+  800427:	5d                   	pop    %ebp
+  800428:	c3                   	ret
+
+00800429 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800429:	55                   	push   %ebp
+  80042a:	89 e5                	mov    %esp,%ebp
+  80042c:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80042f:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800433:	8b 10                	mov    (%eax),%edx
+  800435:	3b 50 04             	cmp    0x4(%eax),%edx
+  800438:	73 0a                	jae    800444 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80043a:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80043d:	89 08                	mov    %ecx,(%eax)
+  80043f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800442:	88 02                	mov    %al,(%edx)
+}
+  800444:	5d                   	pop    %ebp
+  800445:	c3                   	ret
+
+00800446 <printfmt>:
+{
+  800446:	55                   	push   %ebp
+  800447:	89 e5                	mov    %esp,%ebp
+  800449:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80044c:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80044f:	50                   	push   %eax
+  800450:	ff 75 10             	push   0x10(%ebp)
+  800453:	ff 75 0c             	push   0xc(%ebp)
+  800456:	ff 75 08             	push   0x8(%ebp)
+  800459:	e8 05 00 00 00       	call   800463 <vprintfmt>
+}
+  80045e:	83 c4 10             	add    $0x10,%esp
+  800461:	c9                   	leave
+  800462:	c3                   	ret
+
+00800463 <vprintfmt>:
+{
+  800463:	55                   	push   %ebp
+  800464:	89 e5                	mov    %esp,%ebp
+  800466:	57                   	push   %edi
+  800467:	56                   	push   %esi
+  800468:	53                   	push   %ebx
+  800469:	83 ec 2c             	sub    $0x2c,%esp
+  80046c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80046f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800472:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800475:	eb 0a                	jmp    800481 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800477:	83 ec 08             	sub    $0x8,%esp
+  80047a:	53                   	push   %ebx
+  80047b:	50                   	push   %eax
+  80047c:	ff d6                	call   *%esi
+  80047e:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  800481:	83 c7 01             	add    $0x1,%edi
+  800484:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  800488:	83 f8 25             	cmp    $0x25,%eax
+  80048b:	74 0c                	je     800499 <vprintfmt+0x36>
+			if (ch == '\0')
+  80048d:	85 c0                	test   %eax,%eax
+  80048f:	75 e6                	jne    800477 <vprintfmt+0x14>
+}
+  800491:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800494:	5b                   	pop    %ebx
+  800495:	5e                   	pop    %esi
+  800496:	5f                   	pop    %edi
+  800497:	5d                   	pop    %ebp
+  800498:	c3                   	ret
+		padc = ' ';
+  800499:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80049d:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8004a4:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8004ab:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8004b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  8004b7:	8d 47 01             	lea    0x1(%edi),%eax
+  8004ba:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8004bd:	0f b6 17             	movzbl (%edi),%edx
+  8004c0:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8004c3:	3c 55                	cmp    $0x55,%al
+  8004c5:	0f 87 c5 03 00 00    	ja     800890 <vprintfmt+0x42d>
+  8004cb:	0f b6 c0             	movzbl %al,%eax
+  8004ce:	ff 24 85 20 4b 80 00 	jmp    *0x804b20(,%eax,4)
+  8004d5:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  8004d8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8004db:	eb da                	jmp    8004b7 <vprintfmt+0x54>
+  8004dd:	0f be d2             	movsbl %dl,%edx
+  8004e0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8004e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e8:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8004eb:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8004ee:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8004f2:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8004f5:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8004f8:	83 f9 09             	cmp    $0x9,%ecx
+  8004fb:	77 55                	ja     800552 <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  8004fd:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800500:	eb e9                	jmp    8004eb <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  800502:	8b 45 14             	mov    0x14(%ebp),%eax
+  800505:	8b 00                	mov    (%eax),%eax
+  800507:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80050a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80050d:	8d 40 04             	lea    0x4(%eax),%eax
+  800510:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  800513:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800516:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80051a:	79 9b                	jns    8004b7 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80051c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80051f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800522:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800529:	eb 8c                	jmp    8004b7 <vprintfmt+0x54>
+			if (width < 0)
+  80052b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80052e:	85 d2                	test   %edx,%edx
+  800530:	b8 00 00 00 00       	mov    $0x0,%eax
+  800535:	0f 49 c2             	cmovns %edx,%eax
+  800538:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  80053b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80053e:	e9 74 ff ff ff       	jmp    8004b7 <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  800543:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800546:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80054d:	e9 65 ff ff ff       	jmp    8004b7 <vprintfmt+0x54>
+  800552:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800555:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800558:	eb bc                	jmp    800516 <vprintfmt+0xb3>
+			lflag++;
+  80055a:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  80055d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800560:	e9 52 ff ff ff       	jmp    8004b7 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800565:	8b 45 14             	mov    0x14(%ebp),%eax
+  800568:	8d 78 04             	lea    0x4(%eax),%edi
+  80056b:	83 ec 08             	sub    $0x8,%esp
+  80056e:	53                   	push   %ebx
+  80056f:	ff 30                	push   (%eax)
+  800571:	ff d6                	call   *%esi
+			break;
+  800573:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800576:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800579:	e9 b1 02 00 00       	jmp    80082f <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  80057e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800581:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800584:	8b 10                	mov    (%eax),%edx
+  800586:	89 d0                	mov    %edx,%eax
+  800588:	f7 d8                	neg    %eax
+  80058a:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80058d:	83 f8 14             	cmp    $0x14,%eax
+  800590:	7f 23                	jg     8005b5 <vprintfmt+0x152>
+  800592:	8b 14 85 80 4c 80 00 	mov    0x804c80(,%eax,4),%edx
+  800599:	85 d2                	test   %edx,%edx
+  80059b:	74 18                	je     8005b5 <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  80059d:	52                   	push   %edx
+  80059e:	68 c3 4e 80 00       	push   $0x804ec3
+  8005a3:	53                   	push   %ebx
+  8005a4:	56                   	push   %esi
+  8005a5:	e8 9c fe ff ff       	call   800446 <printfmt>
+  8005aa:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005ad:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8005b0:	e9 7a 02 00 00       	jmp    80082f <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  8005b5:	50                   	push   %eax
+  8005b6:	68 bb 49 80 00       	push   $0x8049bb
+  8005bb:	53                   	push   %ebx
+  8005bc:	56                   	push   %esi
+  8005bd:	e8 84 fe ff ff       	call   800446 <printfmt>
+  8005c2:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005c5:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8005c8:	e9 62 02 00 00       	jmp    80082f <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d0:	83 c0 04             	add    $0x4,%eax
+  8005d3:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8005d6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d9:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8005db:	85 c9                	test   %ecx,%ecx
+  8005dd:	b8 b4 49 80 00       	mov    $0x8049b4,%eax
+  8005e2:	0f 45 c1             	cmovne %ecx,%eax
+  8005e5:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8005e8:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005ec:	7e 06                	jle    8005f4 <vprintfmt+0x191>
+  8005ee:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8005f2:	75 0b                	jne    8005ff <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005f4:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8005f7:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8005fa:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005fd:	eb 5c                	jmp    80065b <vprintfmt+0x1f8>
+  8005ff:	83 ec 08             	sub    $0x8,%esp
+  800602:	ff 75 d0             	push   -0x30(%ebp)
+  800605:	ff 75 cc             	push   -0x34(%ebp)
+  800608:	e8 20 03 00 00       	call   80092d <strnlen>
+  80060d:	89 c2                	mov    %eax,%edx
+  80060f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800612:	29 d0                	sub    %edx,%eax
+  800614:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800617:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80061b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80061e:	89 75 08             	mov    %esi,0x8(%ebp)
+  800621:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800623:	eb 0e                	jmp    800633 <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  800625:	83 ec 08             	sub    $0x8,%esp
+  800628:	53                   	push   %ebx
+  800629:	57                   	push   %edi
+  80062a:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80062d:	83 ee 01             	sub    $0x1,%esi
+  800630:	83 c4 10             	add    $0x10,%esp
+  800633:	85 f6                	test   %esi,%esi
+  800635:	7f ee                	jg     800625 <vprintfmt+0x1c2>
+  800637:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80063a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80063d:	85 c0                	test   %eax,%eax
+  80063f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800644:	0f 49 d0             	cmovns %eax,%edx
+  800647:	29 d0                	sub    %edx,%eax
+  800649:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80064c:	eb a6                	jmp    8005f4 <vprintfmt+0x191>
+					putch(ch, putdat);
+  80064e:	83 ec 08             	sub    $0x8,%esp
+  800651:	53                   	push   %ebx
+  800652:	52                   	push   %edx
+  800653:	ff 55 08             	call   *0x8(%ebp)
+  800656:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800659:	89 f1                	mov    %esi,%ecx
+  80065b:	8d 71 01             	lea    0x1(%ecx),%esi
+  80065e:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800662:	0f be d0             	movsbl %al,%edx
+  800665:	85 d2                	test   %edx,%edx
+  800667:	74 28                	je     800691 <vprintfmt+0x22e>
+  800669:	85 ff                	test   %edi,%edi
+  80066b:	78 05                	js     800672 <vprintfmt+0x20f>
+  80066d:	83 ef 01             	sub    $0x1,%edi
+  800670:	78 30                	js     8006a2 <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800672:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800676:	74 d6                	je     80064e <vprintfmt+0x1eb>
+  800678:	0f be c0             	movsbl %al,%eax
+  80067b:	83 e8 20             	sub    $0x20,%eax
+  80067e:	83 f8 5e             	cmp    $0x5e,%eax
+  800681:	76 cb                	jbe    80064e <vprintfmt+0x1eb>
+					putch('?', putdat);
+  800683:	83 ec 08             	sub    $0x8,%esp
+  800686:	53                   	push   %ebx
+  800687:	6a 3f                	push   $0x3f
+  800689:	ff 55 08             	call   *0x8(%ebp)
+  80068c:	83 c4 10             	add    $0x10,%esp
+  80068f:	eb c8                	jmp    800659 <vprintfmt+0x1f6>
+  800691:	8b 75 08             	mov    0x8(%ebp),%esi
+  800694:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800697:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80069a:	01 d0                	add    %edx,%eax
+  80069c:	29 c8                	sub    %ecx,%eax
+  80069e:	89 c7                	mov    %eax,%edi
+  8006a0:	eb 13                	jmp    8006b5 <vprintfmt+0x252>
+  8006a2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006a5:	eb ed                	jmp    800694 <vprintfmt+0x231>
+				putch(' ', putdat);
+  8006a7:	83 ec 08             	sub    $0x8,%esp
+  8006aa:	53                   	push   %ebx
+  8006ab:	6a 20                	push   $0x20
+  8006ad:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8006af:	83 ef 01             	sub    $0x1,%edi
+  8006b2:	83 c4 10             	add    $0x10,%esp
+  8006b5:	85 ff                	test   %edi,%edi
+  8006b7:	7f ee                	jg     8006a7 <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8006b9:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8006bc:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006bf:	e9 6b 01 00 00       	jmp    80082f <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  8006c4:	83 f9 01             	cmp    $0x1,%ecx
+  8006c7:	7f 1f                	jg     8006e8 <vprintfmt+0x285>
+	else if (lflag)
+  8006c9:	85 c9                	test   %ecx,%ecx
+  8006cb:	74 67                	je     800734 <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  8006cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d0:	8b 00                	mov    (%eax),%eax
+  8006d2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006d5:	89 c1                	mov    %eax,%ecx
+  8006d7:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006da:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006dd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e0:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006e6:	eb 17                	jmp    8006ff <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  8006e8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006eb:	8b 50 04             	mov    0x4(%eax),%edx
+  8006ee:	8b 00                	mov    (%eax),%eax
+  8006f0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006f3:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f9:	8d 40 08             	lea    0x8(%eax),%eax
+  8006fc:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8006ff:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800702:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800705:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80070a:	85 c9                	test   %ecx,%ecx
+  80070c:	0f 89 03 01 00 00    	jns    800815 <vprintfmt+0x3b2>
+				putch('-', putdat);
+  800712:	83 ec 08             	sub    $0x8,%esp
+  800715:	53                   	push   %ebx
+  800716:	6a 2d                	push   $0x2d
+  800718:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80071a:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80071d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800720:	f7 da                	neg    %edx
+  800722:	83 d1 00             	adc    $0x0,%ecx
+  800725:	f7 d9                	neg    %ecx
+  800727:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80072a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80072f:	e9 e1 00 00 00       	jmp    800815 <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  800734:	8b 45 14             	mov    0x14(%ebp),%eax
+  800737:	8b 00                	mov    (%eax),%eax
+  800739:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80073c:	89 c1                	mov    %eax,%ecx
+  80073e:	c1 f9 1f             	sar    $0x1f,%ecx
+  800741:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800744:	8b 45 14             	mov    0x14(%ebp),%eax
+  800747:	8d 40 04             	lea    0x4(%eax),%eax
+  80074a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80074d:	eb b0                	jmp    8006ff <vprintfmt+0x29c>
+	if (lflag >= 2)
+  80074f:	83 f9 01             	cmp    $0x1,%ecx
+  800752:	7f 1e                	jg     800772 <vprintfmt+0x30f>
+	else if (lflag)
+  800754:	85 c9                	test   %ecx,%ecx
+  800756:	74 32                	je     80078a <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  800758:	8b 45 14             	mov    0x14(%ebp),%eax
+  80075b:	8b 10                	mov    (%eax),%edx
+  80075d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800762:	8d 40 04             	lea    0x4(%eax),%eax
+  800765:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800768:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80076d:	e9 a3 00 00 00       	jmp    800815 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800772:	8b 45 14             	mov    0x14(%ebp),%eax
+  800775:	8b 10                	mov    (%eax),%edx
+  800777:	8b 48 04             	mov    0x4(%eax),%ecx
+  80077a:	8d 40 08             	lea    0x8(%eax),%eax
+  80077d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800780:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800785:	e9 8b 00 00 00       	jmp    800815 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  80078a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80078d:	8b 10                	mov    (%eax),%edx
+  80078f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800794:	8d 40 04             	lea    0x4(%eax),%eax
+  800797:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80079a:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80079f:	eb 74                	jmp    800815 <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  8007a1:	83 f9 01             	cmp    $0x1,%ecx
+  8007a4:	7f 1b                	jg     8007c1 <vprintfmt+0x35e>
+	else if (lflag)
+  8007a6:	85 c9                	test   %ecx,%ecx
+  8007a8:	74 2c                	je     8007d6 <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  8007aa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ad:	8b 10                	mov    (%eax),%edx
+  8007af:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007b4:	8d 40 04             	lea    0x4(%eax),%eax
+  8007b7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007ba:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8007bf:	eb 54                	jmp    800815 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8007c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c4:	8b 10                	mov    (%eax),%edx
+  8007c6:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007c9:	8d 40 08             	lea    0x8(%eax),%eax
+  8007cc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007cf:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8007d4:	eb 3f                	jmp    800815 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8007d6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d9:	8b 10                	mov    (%eax),%edx
+  8007db:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007e0:	8d 40 04             	lea    0x4(%eax),%eax
+  8007e3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007e6:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8007eb:	eb 28                	jmp    800815 <vprintfmt+0x3b2>
+			putch('0', putdat);
+  8007ed:	83 ec 08             	sub    $0x8,%esp
+  8007f0:	53                   	push   %ebx
+  8007f1:	6a 30                	push   $0x30
+  8007f3:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8007f5:	83 c4 08             	add    $0x8,%esp
+  8007f8:	53                   	push   %ebx
+  8007f9:	6a 78                	push   $0x78
+  8007fb:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8007fd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800800:	8b 10                	mov    (%eax),%edx
+  800802:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800807:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80080a:	8d 40 04             	lea    0x4(%eax),%eax
+  80080d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800810:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800815:	83 ec 0c             	sub    $0xc,%esp
+  800818:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80081c:	50                   	push   %eax
+  80081d:	ff 75 e0             	push   -0x20(%ebp)
+  800820:	57                   	push   %edi
+  800821:	51                   	push   %ecx
+  800822:	52                   	push   %edx
+  800823:	89 da                	mov    %ebx,%edx
+  800825:	89 f0                	mov    %esi,%eax
+  800827:	e8 54 fb ff ff       	call   800380 <printnum>
+			break;
+  80082c:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80082f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  800832:	e9 4a fc ff ff       	jmp    800481 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800837:	83 f9 01             	cmp    $0x1,%ecx
+  80083a:	7f 1b                	jg     800857 <vprintfmt+0x3f4>
+	else if (lflag)
+  80083c:	85 c9                	test   %ecx,%ecx
+  80083e:	74 2c                	je     80086c <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  800840:	8b 45 14             	mov    0x14(%ebp),%eax
+  800843:	8b 10                	mov    (%eax),%edx
+  800845:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80084a:	8d 40 04             	lea    0x4(%eax),%eax
+  80084d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800850:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800855:	eb be                	jmp    800815 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800857:	8b 45 14             	mov    0x14(%ebp),%eax
+  80085a:	8b 10                	mov    (%eax),%edx
+  80085c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80085f:	8d 40 08             	lea    0x8(%eax),%eax
+  800862:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800865:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80086a:	eb a9                	jmp    800815 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  80086c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80086f:	8b 10                	mov    (%eax),%edx
+  800871:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800876:	8d 40 04             	lea    0x4(%eax),%eax
+  800879:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80087c:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800881:	eb 92                	jmp    800815 <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  800883:	83 ec 08             	sub    $0x8,%esp
+  800886:	53                   	push   %ebx
+  800887:	6a 25                	push   $0x25
+  800889:	ff d6                	call   *%esi
+			break;
+  80088b:	83 c4 10             	add    $0x10,%esp
+  80088e:	eb 9f                	jmp    80082f <vprintfmt+0x3cc>
+			putch('%', putdat);
+  800890:	83 ec 08             	sub    $0x8,%esp
+  800893:	53                   	push   %ebx
+  800894:	6a 25                	push   $0x25
+  800896:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800898:	83 c4 10             	add    $0x10,%esp
+  80089b:	89 f8                	mov    %edi,%eax
+  80089d:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8008a1:	74 05                	je     8008a8 <vprintfmt+0x445>
+  8008a3:	83 e8 01             	sub    $0x1,%eax
+  8008a6:	eb f5                	jmp    80089d <vprintfmt+0x43a>
+  8008a8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8008ab:	eb 82                	jmp    80082f <vprintfmt+0x3cc>
+
+008008ad <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8008ad:	55                   	push   %ebp
+  8008ae:	89 e5                	mov    %esp,%ebp
+  8008b0:	83 ec 18             	sub    $0x18,%esp
+  8008b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008b6:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8008b9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8008bc:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8008c0:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8008c3:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8008ca:	85 c0                	test   %eax,%eax
+  8008cc:	74 26                	je     8008f4 <vsnprintf+0x47>
+  8008ce:	85 d2                	test   %edx,%edx
+  8008d0:	7e 22                	jle    8008f4 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8008d2:	ff 75 14             	push   0x14(%ebp)
+  8008d5:	ff 75 10             	push   0x10(%ebp)
+  8008d8:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8008db:	50                   	push   %eax
+  8008dc:	68 29 04 80 00       	push   $0x800429
+  8008e1:	e8 7d fb ff ff       	call   800463 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8008e6:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8008e9:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8008ec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008ef:	83 c4 10             	add    $0x10,%esp
+}
+  8008f2:	c9                   	leave
+  8008f3:	c3                   	ret
+		return -E_INVAL;
+  8008f4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008f9:	eb f7                	jmp    8008f2 <vsnprintf+0x45>
+
+008008fb <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8008fb:	55                   	push   %ebp
+  8008fc:	89 e5                	mov    %esp,%ebp
+  8008fe:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800901:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800904:	50                   	push   %eax
+  800905:	ff 75 10             	push   0x10(%ebp)
+  800908:	ff 75 0c             	push   0xc(%ebp)
+  80090b:	ff 75 08             	push   0x8(%ebp)
+  80090e:	e8 9a ff ff ff       	call   8008ad <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800913:	c9                   	leave
+  800914:	c3                   	ret
+
+00800915 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800915:	55                   	push   %ebp
+  800916:	89 e5                	mov    %esp,%ebp
+  800918:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80091b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800920:	eb 03                	jmp    800925 <strlen+0x10>
+		n++;
+  800922:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800925:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800929:	75 f7                	jne    800922 <strlen+0xd>
+	return n;
+}
+  80092b:	5d                   	pop    %ebp
+  80092c:	c3                   	ret
+
+0080092d <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80092d:	55                   	push   %ebp
+  80092e:	89 e5                	mov    %esp,%ebp
+  800930:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800933:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800936:	b8 00 00 00 00       	mov    $0x0,%eax
+  80093b:	eb 03                	jmp    800940 <strnlen+0x13>
+		n++;
+  80093d:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800940:	39 d0                	cmp    %edx,%eax
+  800942:	74 08                	je     80094c <strnlen+0x1f>
+  800944:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800948:	75 f3                	jne    80093d <strnlen+0x10>
+  80094a:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80094c:	89 d0                	mov    %edx,%eax
+  80094e:	5d                   	pop    %ebp
+  80094f:	c3                   	ret
+
+00800950 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800950:	55                   	push   %ebp
+  800951:	89 e5                	mov    %esp,%ebp
+  800953:	53                   	push   %ebx
+  800954:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800957:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80095a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80095f:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800963:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800966:	83 c0 01             	add    $0x1,%eax
+  800969:	84 d2                	test   %dl,%dl
+  80096b:	75 f2                	jne    80095f <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80096d:	89 c8                	mov    %ecx,%eax
+  80096f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800972:	c9                   	leave
+  800973:	c3                   	ret
+
+00800974 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800974:	55                   	push   %ebp
+  800975:	89 e5                	mov    %esp,%ebp
+  800977:	53                   	push   %ebx
+  800978:	83 ec 10             	sub    $0x10,%esp
+  80097b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80097e:	53                   	push   %ebx
+  80097f:	e8 91 ff ff ff       	call   800915 <strlen>
+  800984:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800987:	ff 75 0c             	push   0xc(%ebp)
+  80098a:	01 d8                	add    %ebx,%eax
+  80098c:	50                   	push   %eax
+  80098d:	e8 be ff ff ff       	call   800950 <strcpy>
+	return dst;
+}
+  800992:	89 d8                	mov    %ebx,%eax
+  800994:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800997:	c9                   	leave
+  800998:	c3                   	ret
+
+00800999 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800999:	55                   	push   %ebp
+  80099a:	89 e5                	mov    %esp,%ebp
+  80099c:	56                   	push   %esi
+  80099d:	53                   	push   %ebx
+  80099e:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009a1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8009a4:	89 f3                	mov    %esi,%ebx
+  8009a6:	03 5d 10             	add    0x10(%ebp),%ebx
+  8009a9:	89 f0                	mov    %esi,%eax
+  8009ab:	eb 0f                	jmp    8009bc <strncpy+0x23>
+		*dst++ = *src;
+  8009ad:	83 c0 01             	add    $0x1,%eax
+  8009b0:	0f b6 0a             	movzbl (%edx),%ecx
+  8009b3:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8009b6:	80 f9 01             	cmp    $0x1,%cl
+  8009b9:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8009bc:	39 d8                	cmp    %ebx,%eax
+  8009be:	75 ed                	jne    8009ad <strncpy+0x14>
+	}
+	return ret;
+}
+  8009c0:	89 f0                	mov    %esi,%eax
+  8009c2:	5b                   	pop    %ebx
+  8009c3:	5e                   	pop    %esi
+  8009c4:	5d                   	pop    %ebp
+  8009c5:	c3                   	ret
+
+008009c6 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8009c6:	55                   	push   %ebp
+  8009c7:	89 e5                	mov    %esp,%ebp
+  8009c9:	56                   	push   %esi
+  8009ca:	53                   	push   %ebx
+  8009cb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009ce:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009d1:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8009d4:	89 f0                	mov    %esi,%eax
+  8009d6:	85 d2                	test   %edx,%edx
+  8009d8:	74 21                	je     8009fb <strlcpy+0x35>
+  8009da:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8009de:	89 f2                	mov    %esi,%edx
+  8009e0:	eb 09                	jmp    8009eb <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8009e2:	83 c1 01             	add    $0x1,%ecx
+  8009e5:	83 c2 01             	add    $0x1,%edx
+  8009e8:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8009eb:	39 c2                	cmp    %eax,%edx
+  8009ed:	74 09                	je     8009f8 <strlcpy+0x32>
+  8009ef:	0f b6 19             	movzbl (%ecx),%ebx
+  8009f2:	84 db                	test   %bl,%bl
+  8009f4:	75 ec                	jne    8009e2 <strlcpy+0x1c>
+  8009f6:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8009f8:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8009fb:	29 f0                	sub    %esi,%eax
+}
+  8009fd:	5b                   	pop    %ebx
+  8009fe:	5e                   	pop    %esi
+  8009ff:	5d                   	pop    %ebp
+  800a00:	c3                   	ret
+
+00800a01 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800a01:	55                   	push   %ebp
+  800a02:	89 e5                	mov    %esp,%ebp
+  800a04:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a07:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800a0a:	eb 06                	jmp    800a12 <strcmp+0x11>
+		p++, q++;
+  800a0c:	83 c1 01             	add    $0x1,%ecx
+  800a0f:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800a12:	0f b6 01             	movzbl (%ecx),%eax
+  800a15:	84 c0                	test   %al,%al
+  800a17:	74 04                	je     800a1d <strcmp+0x1c>
+  800a19:	3a 02                	cmp    (%edx),%al
+  800a1b:	74 ef                	je     800a0c <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a1d:	0f b6 c0             	movzbl %al,%eax
+  800a20:	0f b6 12             	movzbl (%edx),%edx
+  800a23:	29 d0                	sub    %edx,%eax
+}
+  800a25:	5d                   	pop    %ebp
+  800a26:	c3                   	ret
+
+00800a27 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800a27:	55                   	push   %ebp
+  800a28:	89 e5                	mov    %esp,%ebp
+  800a2a:	53                   	push   %ebx
+  800a2b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a2e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a31:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800a34:	eb 09                	jmp    800a3f <strncmp+0x18>
+		n--, p++, q++;
+  800a36:	83 ea 01             	sub    $0x1,%edx
+  800a39:	83 c0 01             	add    $0x1,%eax
+  800a3c:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800a3f:	85 d2                	test   %edx,%edx
+  800a41:	74 18                	je     800a5b <strncmp+0x34>
+  800a43:	0f b6 18             	movzbl (%eax),%ebx
+  800a46:	84 db                	test   %bl,%bl
+  800a48:	74 04                	je     800a4e <strncmp+0x27>
+  800a4a:	3a 19                	cmp    (%ecx),%bl
+  800a4c:	74 e8                	je     800a36 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a4e:	0f b6 00             	movzbl (%eax),%eax
+  800a51:	0f b6 11             	movzbl (%ecx),%edx
+  800a54:	29 d0                	sub    %edx,%eax
+}
+  800a56:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a59:	c9                   	leave
+  800a5a:	c3                   	ret
+		return 0;
+  800a5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a60:	eb f4                	jmp    800a56 <strncmp+0x2f>
+
+00800a62 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a62:	55                   	push   %ebp
+  800a63:	89 e5                	mov    %esp,%ebp
+  800a65:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a68:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a6c:	eb 03                	jmp    800a71 <strchr+0xf>
+  800a6e:	83 c0 01             	add    $0x1,%eax
+  800a71:	0f b6 10             	movzbl (%eax),%edx
+  800a74:	84 d2                	test   %dl,%dl
+  800a76:	74 06                	je     800a7e <strchr+0x1c>
+		if (*s == c)
+  800a78:	38 ca                	cmp    %cl,%dl
+  800a7a:	75 f2                	jne    800a6e <strchr+0xc>
+  800a7c:	eb 05                	jmp    800a83 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800a7e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a83:	5d                   	pop    %ebp
+  800a84:	c3                   	ret
+
+00800a85 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a85:	55                   	push   %ebp
+  800a86:	89 e5                	mov    %esp,%ebp
+  800a88:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a8b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a8f:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a92:	38 ca                	cmp    %cl,%dl
+  800a94:	74 09                	je     800a9f <strfind+0x1a>
+  800a96:	84 d2                	test   %dl,%dl
+  800a98:	74 05                	je     800a9f <strfind+0x1a>
+	for (; *s; s++)
+  800a9a:	83 c0 01             	add    $0x1,%eax
+  800a9d:	eb f0                	jmp    800a8f <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a9f:	5d                   	pop    %ebp
+  800aa0:	c3                   	ret
+
+00800aa1 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800aa1:	55                   	push   %ebp
+  800aa2:	89 e5                	mov    %esp,%ebp
+  800aa4:	57                   	push   %edi
+  800aa5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800aa8:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800aab:	85 c9                	test   %ecx,%ecx
+  800aad:	74 20                	je     800acf <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800aaf:	89 f8                	mov    %edi,%eax
+  800ab1:	09 c8                	or     %ecx,%eax
+  800ab3:	a8 03                	test   $0x3,%al
+  800ab5:	75 12                	jne    800ac9 <memset+0x28>
+		c &= 0xFF;
+  800ab7:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800abb:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800ac1:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800ac4:	fc                   	cld
+  800ac5:	f3 ab                	rep stos %eax,%es:(%edi)
+  800ac7:	eb 06                	jmp    800acf <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800ac9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800acc:	fc                   	cld
+  800acd:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800acf:	89 f8                	mov    %edi,%eax
+  800ad1:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800ad4:	c9                   	leave
+  800ad5:	c3                   	ret
+
+00800ad6 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800ad6:	55                   	push   %ebp
+  800ad7:	89 e5                	mov    %esp,%ebp
+  800ad9:	57                   	push   %edi
+  800ada:	56                   	push   %esi
+  800adb:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ade:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800ae1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800ae4:	39 c6                	cmp    %eax,%esi
+  800ae6:	73 32                	jae    800b1a <memmove+0x44>
+  800ae8:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800aeb:	39 d0                	cmp    %edx,%eax
+  800aed:	73 2b                	jae    800b1a <memmove+0x44>
+		s += n;
+		d += n;
+  800aef:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800af2:	89 d6                	mov    %edx,%esi
+  800af4:	09 fe                	or     %edi,%esi
+  800af6:	09 ce                	or     %ecx,%esi
+  800af8:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800afe:	75 0e                	jne    800b0e <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800b00:	83 ef 04             	sub    $0x4,%edi
+  800b03:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800b06:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800b09:	fd                   	std
+  800b0a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b0c:	eb 09                	jmp    800b17 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800b0e:	83 ef 01             	sub    $0x1,%edi
+  800b11:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800b14:	fd                   	std
+  800b15:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800b17:	fc                   	cld
+  800b18:	eb 1a                	jmp    800b34 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b1a:	89 f2                	mov    %esi,%edx
+  800b1c:	09 c2                	or     %eax,%edx
+  800b1e:	09 ca                	or     %ecx,%edx
+  800b20:	f6 c2 03             	test   $0x3,%dl
+  800b23:	75 0a                	jne    800b2f <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800b25:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800b28:	89 c7                	mov    %eax,%edi
+  800b2a:	fc                   	cld
+  800b2b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b2d:	eb 05                	jmp    800b34 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800b2f:	89 c7                	mov    %eax,%edi
+  800b31:	fc                   	cld
+  800b32:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800b34:	5e                   	pop    %esi
+  800b35:	5f                   	pop    %edi
+  800b36:	5d                   	pop    %ebp
+  800b37:	c3                   	ret
+
+00800b38 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800b38:	55                   	push   %ebp
+  800b39:	89 e5                	mov    %esp,%ebp
+  800b3b:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800b3e:	ff 75 10             	push   0x10(%ebp)
+  800b41:	ff 75 0c             	push   0xc(%ebp)
+  800b44:	ff 75 08             	push   0x8(%ebp)
+  800b47:	e8 8a ff ff ff       	call   800ad6 <memmove>
+}
+  800b4c:	c9                   	leave
+  800b4d:	c3                   	ret
+
+00800b4e <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800b4e:	55                   	push   %ebp
+  800b4f:	89 e5                	mov    %esp,%ebp
+  800b51:	56                   	push   %esi
+  800b52:	53                   	push   %ebx
+  800b53:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b56:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800b59:	89 c6                	mov    %eax,%esi
+  800b5b:	03 75 10             	add    0x10(%ebp),%esi
+  800b5e:	eb 06                	jmp    800b66 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b60:	83 c0 01             	add    $0x1,%eax
+  800b63:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b66:	39 f0                	cmp    %esi,%eax
+  800b68:	74 14                	je     800b7e <memcmp+0x30>
+		if (*s1 != *s2)
+  800b6a:	0f b6 08             	movzbl (%eax),%ecx
+  800b6d:	0f b6 1a             	movzbl (%edx),%ebx
+  800b70:	38 d9                	cmp    %bl,%cl
+  800b72:	74 ec                	je     800b60 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800b74:	0f b6 c1             	movzbl %cl,%eax
+  800b77:	0f b6 db             	movzbl %bl,%ebx
+  800b7a:	29 d8                	sub    %ebx,%eax
+  800b7c:	eb 05                	jmp    800b83 <memcmp+0x35>
+	}
+
+	return 0;
+  800b7e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b83:	5b                   	pop    %ebx
+  800b84:	5e                   	pop    %esi
+  800b85:	5d                   	pop    %ebp
+  800b86:	c3                   	ret
+
+00800b87 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b87:	55                   	push   %ebp
+  800b88:	89 e5                	mov    %esp,%ebp
+  800b8a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b8d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b90:	89 c2                	mov    %eax,%edx
+  800b92:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b95:	eb 03                	jmp    800b9a <memfind+0x13>
+  800b97:	83 c0 01             	add    $0x1,%eax
+  800b9a:	39 d0                	cmp    %edx,%eax
+  800b9c:	73 04                	jae    800ba2 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b9e:	38 08                	cmp    %cl,(%eax)
+  800ba0:	75 f5                	jne    800b97 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800ba2:	5d                   	pop    %ebp
+  800ba3:	c3                   	ret
+
+00800ba4 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800ba4:	55                   	push   %ebp
+  800ba5:	89 e5                	mov    %esp,%ebp
+  800ba7:	57                   	push   %edi
+  800ba8:	56                   	push   %esi
+  800ba9:	53                   	push   %ebx
+  800baa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bad:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800bb0:	eb 03                	jmp    800bb5 <strtol+0x11>
+		s++;
+  800bb2:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800bb5:	0f b6 02             	movzbl (%edx),%eax
+  800bb8:	3c 20                	cmp    $0x20,%al
+  800bba:	74 f6                	je     800bb2 <strtol+0xe>
+  800bbc:	3c 09                	cmp    $0x9,%al
+  800bbe:	74 f2                	je     800bb2 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800bc0:	3c 2b                	cmp    $0x2b,%al
+  800bc2:	74 2a                	je     800bee <strtol+0x4a>
+	int neg = 0;
+  800bc4:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800bc9:	3c 2d                	cmp    $0x2d,%al
+  800bcb:	74 2b                	je     800bf8 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bcd:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800bd3:	75 0f                	jne    800be4 <strtol+0x40>
+  800bd5:	80 3a 30             	cmpb   $0x30,(%edx)
+  800bd8:	74 28                	je     800c02 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800bda:	85 db                	test   %ebx,%ebx
+  800bdc:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800be1:	0f 44 d8             	cmove  %eax,%ebx
+  800be4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800be9:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800bec:	eb 46                	jmp    800c34 <strtol+0x90>
+		s++;
+  800bee:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800bf1:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bf6:	eb d5                	jmp    800bcd <strtol+0x29>
+		s++, neg = 1;
+  800bf8:	83 c2 01             	add    $0x1,%edx
+  800bfb:	bf 01 00 00 00       	mov    $0x1,%edi
+  800c00:	eb cb                	jmp    800bcd <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c02:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800c06:	74 0e                	je     800c16 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800c08:	85 db                	test   %ebx,%ebx
+  800c0a:	75 d8                	jne    800be4 <strtol+0x40>
+		s++, base = 8;
+  800c0c:	83 c2 01             	add    $0x1,%edx
+  800c0f:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800c14:	eb ce                	jmp    800be4 <strtol+0x40>
+		s += 2, base = 16;
+  800c16:	83 c2 02             	add    $0x2,%edx
+  800c19:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800c1e:	eb c4                	jmp    800be4 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800c20:	0f be c0             	movsbl %al,%eax
+  800c23:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800c26:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800c29:	7d 3a                	jge    800c65 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800c2b:	83 c2 01             	add    $0x1,%edx
+  800c2e:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800c32:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800c34:	0f b6 02             	movzbl (%edx),%eax
+  800c37:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800c3a:	89 f3                	mov    %esi,%ebx
+  800c3c:	80 fb 09             	cmp    $0x9,%bl
+  800c3f:	76 df                	jbe    800c20 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800c41:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c44:	89 f3                	mov    %esi,%ebx
+  800c46:	80 fb 19             	cmp    $0x19,%bl
+  800c49:	77 08                	ja     800c53 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800c4b:	0f be c0             	movsbl %al,%eax
+  800c4e:	83 e8 57             	sub    $0x57,%eax
+  800c51:	eb d3                	jmp    800c26 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c53:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c56:	89 f3                	mov    %esi,%ebx
+  800c58:	80 fb 19             	cmp    $0x19,%bl
+  800c5b:	77 08                	ja     800c65 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800c5d:	0f be c0             	movsbl %al,%eax
+  800c60:	83 e8 37             	sub    $0x37,%eax
+  800c63:	eb c1                	jmp    800c26 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c65:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c69:	74 05                	je     800c70 <strtol+0xcc>
+		*endptr = (char *) s;
+  800c6b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c6e:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800c70:	89 c8                	mov    %ecx,%eax
+  800c72:	f7 d8                	neg    %eax
+  800c74:	85 ff                	test   %edi,%edi
+  800c76:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800c79:	89 c8                	mov    %ecx,%eax
+  800c7b:	5b                   	pop    %ebx
+  800c7c:	5e                   	pop    %esi
+  800c7d:	5f                   	pop    %edi
+  800c7e:	5d                   	pop    %ebp
+  800c7f:	c3                   	ret
+
+00800c80 <atoi>:
+
+int
+atoi(const char* s)
+{
+  800c80:	55                   	push   %ebp
+  800c81:	89 e5                	mov    %esp,%ebp
+  800c83:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  800c86:	6a 00                	push   $0x0
+  800c88:	6a 00                	push   $0x0
+  800c8a:	ff 75 08             	push   0x8(%ebp)
+  800c8d:	e8 12 ff ff ff       	call   800ba4 <strtol>
+}
+  800c92:	c9                   	leave
+  800c93:	c3                   	ret
+
+00800c94 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c94:	55                   	push   %ebp
+  800c95:	89 e5                	mov    %esp,%ebp
+  800c97:	57                   	push   %edi
+  800c98:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c99:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c9e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ca1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ca4:	89 c3                	mov    %eax,%ebx
+  800ca6:	89 c7                	mov    %eax,%edi
+  800ca8:	6a 00                	push   $0x0
+  800caa:	55                   	push   %ebp
+  800cab:	56                   	push   %esi
+  800cac:	89 e5                	mov    %esp,%ebp
+  800cae:	8d 35 b6 0c 80 00    	lea    0x800cb6,%esi
+  800cb4:	0f 34                	sysenter
+
+00800cb6 <after_sysenter_label_47>:
+  800cb6:	5e                   	pop    %esi
+  800cb7:	5d                   	pop    %ebp
+  800cb8:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800cbb:	5b                   	pop    %ebx
+  800cbc:	5f                   	pop    %edi
+  800cbd:	5d                   	pop    %ebp
+  800cbe:	c3                   	ret
+
+00800cbf <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800cbf:	55                   	push   %ebp
+  800cc0:	89 e5                	mov    %esp,%ebp
+  800cc2:	57                   	push   %edi
+  800cc3:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800cc4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cc9:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cce:	89 d1                	mov    %edx,%ecx
+  800cd0:	89 d3                	mov    %edx,%ebx
+  800cd2:	89 d7                	mov    %edx,%edi
+  800cd4:	6a 00                	push   $0x0
+  800cd6:	55                   	push   %ebp
+  800cd7:	56                   	push   %esi
+  800cd8:	89 e5                	mov    %esp,%ebp
+  800cda:	8d 35 e2 0c 80 00    	lea    0x800ce2,%esi
+  800ce0:	0f 34                	sysenter
+
+00800ce2 <after_sysenter_label_128>:
+  800ce2:	5e                   	pop    %esi
+  800ce3:	5d                   	pop    %ebp
+  800ce4:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800ce7:	5b                   	pop    %ebx
+  800ce8:	5f                   	pop    %edi
+  800ce9:	5d                   	pop    %ebp
+  800cea:	c3                   	ret
+
+00800ceb <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800ceb:	55                   	push   %ebp
+  800cec:	89 e5                	mov    %esp,%ebp
+  800cee:	57                   	push   %edi
+  800cef:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800cf0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cf3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cf8:	b8 03 00 00 00       	mov    $0x3,%eax
+  800cfd:	89 cb                	mov    %ecx,%ebx
+  800cff:	89 cf                	mov    %ecx,%edi
+  800d01:	6a 00                	push   $0x0
+  800d03:	55                   	push   %ebp
+  800d04:	56                   	push   %esi
+  800d05:	89 e5                	mov    %esp,%ebp
+  800d07:	8d 35 0f 0d 80 00    	lea    0x800d0f,%esi
+  800d0d:	0f 34                	sysenter
+
+00800d0f <after_sysenter_label_212>:
+  800d0f:	5e                   	pop    %esi
+  800d10:	5d                   	pop    %ebp
+  800d11:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d14:	85 c0                	test   %eax,%eax
+  800d16:	7f 07                	jg     800d1f <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800d18:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d1b:	5b                   	pop    %ebx
+  800d1c:	5f                   	pop    %edi
+  800d1d:	5d                   	pop    %ebp
+  800d1e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d1f:	83 ec 0c             	sub    $0xc,%esp
+  800d22:	50                   	push   %eax
+  800d23:	6a 03                	push   $0x3
+  800d25:	68 15 4d 80 00       	push   $0x804d15
+  800d2a:	6a 54                	push   $0x54
+  800d2c:	68 32 4d 80 00       	push   $0x804d32
+  800d31:	e8 5b f5 ff ff       	call   800291 <_panic>
+
+00800d36 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800d36:	55                   	push   %ebp
+  800d37:	89 e5                	mov    %esp,%ebp
+  800d39:	57                   	push   %edi
+  800d3a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d3b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d40:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d45:	89 d1                	mov    %edx,%ecx
+  800d47:	89 d3                	mov    %edx,%ebx
+  800d49:	89 d7                	mov    %edx,%edi
+  800d4b:	6a 00                	push   $0x0
+  800d4d:	55                   	push   %ebp
+  800d4e:	56                   	push   %esi
+  800d4f:	89 e5                	mov    %esp,%ebp
+  800d51:	8d 35 59 0d 80 00    	lea    0x800d59,%esi
+  800d57:	0f 34                	sysenter
+
+00800d59 <after_sysenter_label_309>:
+  800d59:	5e                   	pop    %esi
+  800d5a:	5d                   	pop    %ebp
+  800d5b:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800d5e:	5b                   	pop    %ebx
+  800d5f:	5f                   	pop    %edi
+  800d60:	5d                   	pop    %ebp
+  800d61:	c3                   	ret
+
+00800d62 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800d62:	55                   	push   %ebp
+  800d63:	89 e5                	mov    %esp,%ebp
+  800d65:	57                   	push   %edi
+  800d66:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d67:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d6c:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d71:	89 d1                	mov    %edx,%ecx
+  800d73:	89 d3                	mov    %edx,%ebx
+  800d75:	89 d7                	mov    %edx,%edi
+  800d77:	6a 00                	push   $0x0
+  800d79:	55                   	push   %ebp
+  800d7a:	56                   	push   %esi
+  800d7b:	89 e5                	mov    %esp,%ebp
+  800d7d:	8d 35 85 0d 80 00    	lea    0x800d85,%esi
+  800d83:	0f 34                	sysenter
+
+00800d85 <after_sysenter_label_391>:
+  800d85:	5e                   	pop    %esi
+  800d86:	5d                   	pop    %ebp
+  800d87:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d8a:	5b                   	pop    %ebx
+  800d8b:	5f                   	pop    %edi
+  800d8c:	5d                   	pop    %ebp
+  800d8d:	c3                   	ret
+
+00800d8e <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d8e:	55                   	push   %ebp
+  800d8f:	89 e5                	mov    %esp,%ebp
+  800d91:	57                   	push   %edi
+  800d92:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d93:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d96:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d99:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d9e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800da3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800da6:	6a 00                	push   $0x0
+  800da8:	55                   	push   %ebp
+  800da9:	56                   	push   %esi
+  800daa:	89 e5                	mov    %esp,%ebp
+  800dac:	8d 35 b4 0d 80 00    	lea    0x800db4,%esi
+  800db2:	0f 34                	sysenter
+
+00800db4 <after_sysenter_label_479>:
+  800db4:	5e                   	pop    %esi
+  800db5:	5d                   	pop    %ebp
+  800db6:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800db9:	85 c0                	test   %eax,%eax
+  800dbb:	7f 07                	jg     800dc4 <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800dbd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800dc0:	5b                   	pop    %ebx
+  800dc1:	5f                   	pop    %edi
+  800dc2:	5d                   	pop    %ebp
+  800dc3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dc4:	83 ec 0c             	sub    $0xc,%esp
+  800dc7:	50                   	push   %eax
+  800dc8:	6a 04                	push   $0x4
+  800dca:	68 15 4d 80 00       	push   $0x804d15
+  800dcf:	6a 54                	push   $0x54
+  800dd1:	68 32 4d 80 00       	push   $0x804d32
+  800dd6:	e8 b6 f4 ff ff       	call   800291 <_panic>
+
+00800ddb <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800ddb:	55                   	push   %ebp
+  800ddc:	89 e5                	mov    %esp,%ebp
+  800dde:	57                   	push   %edi
+  800ddf:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800de0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800de3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800de6:	b8 05 00 00 00       	mov    $0x5,%eax
+  800deb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dee:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800df1:	ff 75 18             	push   0x18(%ebp)
+  800df4:	55                   	push   %ebp
+  800df5:	56                   	push   %esi
+  800df6:	89 e5                	mov    %esp,%ebp
+  800df8:	8d 35 00 0e 80 00    	lea    0x800e00,%esi
+  800dfe:	0f 34                	sysenter
+
+00800e00 <after_sysenter_label_593>:
+  800e00:	5e                   	pop    %esi
+  800e01:	5d                   	pop    %ebp
+  800e02:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e05:	85 c0                	test   %eax,%eax
+  800e07:	7f 07                	jg     800e10 <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800e09:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e0c:	5b                   	pop    %ebx
+  800e0d:	5f                   	pop    %edi
+  800e0e:	5d                   	pop    %ebp
+  800e0f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e10:	83 ec 0c             	sub    $0xc,%esp
+  800e13:	50                   	push   %eax
+  800e14:	6a 05                	push   $0x5
+  800e16:	68 15 4d 80 00       	push   $0x804d15
+  800e1b:	6a 54                	push   $0x54
+  800e1d:	68 32 4d 80 00       	push   $0x804d32
+  800e22:	e8 6a f4 ff ff       	call   800291 <_panic>
+
+00800e27 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e27:	55                   	push   %ebp
+  800e28:	89 e5                	mov    %esp,%ebp
+  800e2a:	57                   	push   %edi
+  800e2b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e2c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e31:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e34:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e37:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e3c:	89 df                	mov    %ebx,%edi
+  800e3e:	6a 00                	push   $0x0
+  800e40:	55                   	push   %ebp
+  800e41:	56                   	push   %esi
+  800e42:	89 e5                	mov    %esp,%ebp
+  800e44:	8d 35 4c 0e 80 00    	lea    0x800e4c,%esi
+  800e4a:	0f 34                	sysenter
+
+00800e4c <after_sysenter_label_704>:
+  800e4c:	5e                   	pop    %esi
+  800e4d:	5d                   	pop    %ebp
+  800e4e:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e51:	85 c0                	test   %eax,%eax
+  800e53:	7f 07                	jg     800e5c <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e55:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e58:	5b                   	pop    %ebx
+  800e59:	5f                   	pop    %edi
+  800e5a:	5d                   	pop    %ebp
+  800e5b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e5c:	83 ec 0c             	sub    $0xc,%esp
+  800e5f:	50                   	push   %eax
+  800e60:	6a 06                	push   $0x6
+  800e62:	68 15 4d 80 00       	push   $0x804d15
+  800e67:	6a 54                	push   $0x54
+  800e69:	68 32 4d 80 00       	push   $0x804d32
+  800e6e:	e8 1e f4 ff ff       	call   800291 <_panic>
+
+00800e73 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e73:	55                   	push   %ebp
+  800e74:	89 e5                	mov    %esp,%ebp
+  800e76:	57                   	push   %edi
+  800e77:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e78:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e7d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e80:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e83:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e88:	89 df                	mov    %ebx,%edi
+  800e8a:	6a 00                	push   $0x0
+  800e8c:	55                   	push   %ebp
+  800e8d:	56                   	push   %esi
+  800e8e:	89 e5                	mov    %esp,%ebp
+  800e90:	8d 35 98 0e 80 00    	lea    0x800e98,%esi
+  800e96:	0f 34                	sysenter
+
+00800e98 <after_sysenter_label_808>:
+  800e98:	5e                   	pop    %esi
+  800e99:	5d                   	pop    %ebp
+  800e9a:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e9d:	85 c0                	test   %eax,%eax
+  800e9f:	7f 07                	jg     800ea8 <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800ea1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ea4:	5b                   	pop    %ebx
+  800ea5:	5f                   	pop    %edi
+  800ea6:	5d                   	pop    %ebp
+  800ea7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ea8:	83 ec 0c             	sub    $0xc,%esp
+  800eab:	50                   	push   %eax
+  800eac:	6a 08                	push   $0x8
+  800eae:	68 15 4d 80 00       	push   $0x804d15
+  800eb3:	6a 54                	push   $0x54
+  800eb5:	68 32 4d 80 00       	push   $0x804d32
+  800eba:	e8 d2 f3 ff ff       	call   800291 <_panic>
+
+00800ebf <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800ebf:	55                   	push   %ebp
+  800ec0:	89 e5                	mov    %esp,%ebp
+  800ec2:	57                   	push   %edi
+  800ec3:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ec4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ec9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ecc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ecf:	b8 09 00 00 00       	mov    $0x9,%eax
+  800ed4:	89 df                	mov    %ebx,%edi
+  800ed6:	6a 00                	push   $0x0
+  800ed8:	55                   	push   %ebp
+  800ed9:	56                   	push   %esi
+  800eda:	89 e5                	mov    %esp,%ebp
+  800edc:	8d 35 e4 0e 80 00    	lea    0x800ee4,%esi
+  800ee2:	0f 34                	sysenter
+
+00800ee4 <after_sysenter_label_912>:
+  800ee4:	5e                   	pop    %esi
+  800ee5:	5d                   	pop    %ebp
+  800ee6:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800ee9:	85 c0                	test   %eax,%eax
+  800eeb:	7f 07                	jg     800ef4 <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800eed:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ef0:	5b                   	pop    %ebx
+  800ef1:	5f                   	pop    %edi
+  800ef2:	5d                   	pop    %ebp
+  800ef3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ef4:	83 ec 0c             	sub    $0xc,%esp
+  800ef7:	50                   	push   %eax
+  800ef8:	6a 09                	push   $0x9
+  800efa:	68 15 4d 80 00       	push   $0x804d15
+  800eff:	6a 54                	push   $0x54
+  800f01:	68 32 4d 80 00       	push   $0x804d32
+  800f06:	e8 86 f3 ff ff       	call   800291 <_panic>
+
+00800f0b <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800f0b:	55                   	push   %ebp
+  800f0c:	89 e5                	mov    %esp,%ebp
+  800f0e:	57                   	push   %edi
+  800f0f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f10:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f15:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f18:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f1b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f20:	89 df                	mov    %ebx,%edi
+  800f22:	6a 00                	push   $0x0
+  800f24:	55                   	push   %ebp
+  800f25:	56                   	push   %esi
+  800f26:	89 e5                	mov    %esp,%ebp
+  800f28:	8d 35 30 0f 80 00    	lea    0x800f30,%esi
+  800f2e:	0f 34                	sysenter
+
+00800f30 <after_sysenter_label_1016>:
+  800f30:	5e                   	pop    %esi
+  800f31:	5d                   	pop    %ebp
+  800f32:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800f35:	85 c0                	test   %eax,%eax
+  800f37:	7f 07                	jg     800f40 <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800f39:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f3c:	5b                   	pop    %ebx
+  800f3d:	5f                   	pop    %edi
+  800f3e:	5d                   	pop    %ebp
+  800f3f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f40:	83 ec 0c             	sub    $0xc,%esp
+  800f43:	50                   	push   %eax
+  800f44:	6a 0a                	push   $0xa
+  800f46:	68 15 4d 80 00       	push   $0x804d15
+  800f4b:	6a 54                	push   $0x54
+  800f4d:	68 32 4d 80 00       	push   $0x804d32
+  800f52:	e8 3a f3 ff ff       	call   800291 <_panic>
+
+00800f57 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800f57:	55                   	push   %ebp
+  800f58:	89 e5                	mov    %esp,%ebp
+  800f5a:	57                   	push   %edi
+  800f5b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f5c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f5f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f62:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f67:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f6a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f6d:	6a 00                	push   $0x0
+  800f6f:	55                   	push   %ebp
+  800f70:	56                   	push   %esi
+  800f71:	89 e5                	mov    %esp,%ebp
+  800f73:	8d 35 7b 0f 80 00    	lea    0x800f7b,%esi
+  800f79:	0f 34                	sysenter
+
+00800f7b <after_sysenter_label_1126>:
+  800f7b:	5e                   	pop    %esi
+  800f7c:	5d                   	pop    %ebp
+  800f7d:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800f80:	5b                   	pop    %ebx
+  800f81:	5f                   	pop    %edi
+  800f82:	5d                   	pop    %ebp
+  800f83:	c3                   	ret
+
+00800f84 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800f84:	55                   	push   %ebp
+  800f85:	89 e5                	mov    %esp,%ebp
+  800f87:	57                   	push   %edi
+  800f88:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f89:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f8c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f91:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f96:	89 cb                	mov    %ecx,%ebx
+  800f98:	89 cf                	mov    %ecx,%edi
+  800f9a:	6a 00                	push   $0x0
+  800f9c:	55                   	push   %ebp
+  800f9d:	56                   	push   %esi
+  800f9e:	89 e5                	mov    %esp,%ebp
+  800fa0:	8d 35 a8 0f 80 00    	lea    0x800fa8,%esi
+  800fa6:	0f 34                	sysenter
+
+00800fa8 <after_sysenter_label_1210>:
+  800fa8:	5e                   	pop    %esi
+  800fa9:	5d                   	pop    %ebp
+  800faa:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800fad:	85 c0                	test   %eax,%eax
+  800faf:	7f 07                	jg     800fb8 <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800fb1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fb4:	5b                   	pop    %ebx
+  800fb5:	5f                   	pop    %edi
+  800fb6:	5d                   	pop    %ebp
+  800fb7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fb8:	83 ec 0c             	sub    $0xc,%esp
+  800fbb:	50                   	push   %eax
+  800fbc:	6a 0d                	push   $0xd
+  800fbe:	68 15 4d 80 00       	push   $0x804d15
+  800fc3:	6a 54                	push   $0x54
+  800fc5:	68 32 4d 80 00       	push   $0x804d32
+  800fca:	e8 c2 f2 ff ff       	call   800291 <_panic>
+
+00800fcf <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  800fcf:	55                   	push   %ebp
+  800fd0:	89 e5                	mov    %esp,%ebp
+  800fd2:	57                   	push   %edi
+  800fd3:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fd4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fd9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fdc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fdf:	b8 42 00 00 00       	mov    $0x42,%eax
+  800fe4:	89 df                	mov    %ebx,%edi
+  800fe6:	6a 00                	push   $0x0
+  800fe8:	55                   	push   %ebp
+  800fe9:	56                   	push   %esi
+  800fea:	89 e5                	mov    %esp,%ebp
+  800fec:	8d 35 f4 0f 80 00    	lea    0x800ff4,%esi
+  800ff2:	0f 34                	sysenter
+
+00800ff4 <after_sysenter_label_1311>:
+  800ff4:	5e                   	pop    %esi
+  800ff5:	5d                   	pop    %ebp
+  800ff6:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800ff9:	85 c0                	test   %eax,%eax
+  800ffb:	7f 07                	jg     801004 <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  800ffd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801000:	5b                   	pop    %ebx
+  801001:	5f                   	pop    %edi
+  801002:	5d                   	pop    %ebp
+  801003:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801004:	83 ec 0c             	sub    $0xc,%esp
+  801007:	50                   	push   %eax
+  801008:	6a 42                	push   $0x42
+  80100a:	68 15 4d 80 00       	push   $0x804d15
+  80100f:	6a 54                	push   $0x54
+  801011:	68 32 4d 80 00       	push   $0x804d32
+  801016:	e8 76 f2 ff ff       	call   800291 <_panic>
+
+0080101b <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80101b:	55                   	push   %ebp
+  80101c:	89 e5                	mov    %esp,%ebp
+  80101e:	57                   	push   %edi
+  80101f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801020:	ba 00 00 00 00       	mov    $0x0,%edx
+  801025:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80102a:	89 d1                	mov    %edx,%ecx
+  80102c:	89 d3                	mov    %edx,%ebx
+  80102e:	89 d7                	mov    %edx,%edi
+  801030:	6a 00                	push   $0x0
+  801032:	55                   	push   %ebp
+  801033:	56                   	push   %esi
+  801034:	89 e5                	mov    %esp,%ebp
+  801036:	8d 35 3e 10 80 00    	lea    0x80103e,%esi
+  80103c:	0f 34                	sysenter
+
+0080103e <after_sysenter_label_1411>:
+  80103e:	5e                   	pop    %esi
+  80103f:	5d                   	pop    %ebp
+  801040:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801043:	5b                   	pop    %ebx
+  801044:	5f                   	pop    %edi
+  801045:	5d                   	pop    %ebp
+  801046:	c3                   	ret
+
+00801047 <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  801047:	55                   	push   %ebp
+  801048:	89 e5                	mov    %esp,%ebp
+  80104a:	57                   	push   %edi
+  80104b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80104c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801051:	8b 55 08             	mov    0x8(%ebp),%edx
+  801054:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801057:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80105c:	89 df                	mov    %ebx,%edi
+  80105e:	6a 00                	push   $0x0
+  801060:	55                   	push   %ebp
+  801061:	56                   	push   %esi
+  801062:	89 e5                	mov    %esp,%ebp
+  801064:	8d 35 6c 10 80 00    	lea    0x80106c,%esi
+  80106a:	0f 34                	sysenter
+
+0080106c <after_sysenter_label_1497>:
+  80106c:	5e                   	pop    %esi
+  80106d:	5d                   	pop    %ebp
+  80106e:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  801071:	5b                   	pop    %ebx
+  801072:	5f                   	pop    %edi
+  801073:	5d                   	pop    %ebp
+  801074:	c3                   	ret
+
+00801075 <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  801075:	55                   	push   %ebp
+  801076:	89 e5                	mov    %esp,%ebp
+  801078:	57                   	push   %edi
+  801079:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80107a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80107f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801082:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801085:	b8 10 00 00 00       	mov    $0x10,%eax
+  80108a:	89 df                	mov    %ebx,%edi
+  80108c:	6a 00                	push   $0x0
+  80108e:	55                   	push   %ebp
+  80108f:	56                   	push   %esi
+  801090:	89 e5                	mov    %esp,%ebp
+  801092:	8d 35 9a 10 80 00    	lea    0x80109a,%esi
+  801098:	0f 34                	sysenter
+
+0080109a <after_sysenter_label_1583>:
+  80109a:	5e                   	pop    %esi
+  80109b:	5d                   	pop    %ebp
+  80109c:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  80109f:	5b                   	pop    %ebx
+  8010a0:	5f                   	pop    %edi
+  8010a1:	5d                   	pop    %ebp
+  8010a2:	c3                   	ret
+
+008010a3 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  8010a3:	55                   	push   %ebp
+  8010a4:	89 e5                	mov    %esp,%ebp
+  8010a6:	57                   	push   %edi
+  8010a7:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ae:	b8 11 00 00 00       	mov    $0x11,%eax
+  8010b3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010b8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010bb:	6a 00                	push   $0x0
+  8010bd:	55                   	push   %ebp
+  8010be:	56                   	push   %esi
+  8010bf:	89 e5                	mov    %esp,%ebp
+  8010c1:	8d 35 c9 10 80 00    	lea    0x8010c9,%esi
+  8010c7:	0f 34                	sysenter
+
+008010c9 <after_sysenter_label_1672>:
+  8010c9:	5e                   	pop    %esi
+  8010ca:	5d                   	pop    %ebp
+  8010cb:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  8010ce:	5b                   	pop    %ebx
+  8010cf:	5f                   	pop    %edi
+  8010d0:	5d                   	pop    %ebp
+  8010d1:	c3                   	ret
+
+008010d2 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  8010d2:	55                   	push   %ebp
+  8010d3:	89 e5                	mov    %esp,%ebp
+  8010d5:	57                   	push   %edi
+  8010d6:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010df:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010e2:	b8 12 00 00 00       	mov    $0x12,%eax
+  8010e7:	89 df                	mov    %ebx,%edi
+  8010e9:	6a 00                	push   $0x0
+  8010eb:	55                   	push   %ebp
+  8010ec:	56                   	push   %esi
+  8010ed:	89 e5                	mov    %esp,%ebp
+  8010ef:	8d 35 f7 10 80 00    	lea    0x8010f7,%esi
+  8010f5:	0f 34                	sysenter
+
+008010f7 <after_sysenter_label_1758>:
+  8010f7:	5e                   	pop    %esi
+  8010f8:	5d                   	pop    %ebp
+  8010f9:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  8010fc:	5b                   	pop    %ebx
+  8010fd:	5f                   	pop    %edi
+  8010fe:	5d                   	pop    %ebp
+  8010ff:	c3                   	ret
+
+00801100 <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  801100:	55                   	push   %ebp
+  801101:	89 e5                	mov    %esp,%ebp
+  801103:	57                   	push   %edi
+  801104:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801105:	8b 55 08             	mov    0x8(%ebp),%edx
+  801108:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80110d:	b8 13 00 00 00       	mov    $0x13,%eax
+  801112:	89 cb                	mov    %ecx,%ebx
+  801114:	89 cf                	mov    %ecx,%edi
+  801116:	6a 00                	push   $0x0
+  801118:	55                   	push   %ebp
+  801119:	56                   	push   %esi
+  80111a:	89 e5                	mov    %esp,%ebp
+  80111c:	8d 35 24 11 80 00    	lea    0x801124,%esi
+  801122:	0f 34                	sysenter
+
+00801124 <after_sysenter_label_1842>:
+  801124:	5e                   	pop    %esi
+  801125:	5d                   	pop    %ebp
+  801126:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801129:	85 c0                	test   %eax,%eax
+  80112b:	7f 07                	jg     801134 <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  80112d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801130:	5b                   	pop    %ebx
+  801131:	5f                   	pop    %edi
+  801132:	5d                   	pop    %ebp
+  801133:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801134:	83 ec 0c             	sub    $0xc,%esp
+  801137:	50                   	push   %eax
+  801138:	6a 13                	push   $0x13
+  80113a:	68 15 4d 80 00       	push   $0x804d15
+  80113f:	6a 54                	push   $0x54
+  801141:	68 32 4d 80 00       	push   $0x804d32
+  801146:	e8 46 f1 ff ff       	call   800291 <_panic>
+
+0080114b <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  80114b:	55                   	push   %ebp
+  80114c:	89 e5                	mov    %esp,%ebp
+  80114e:	57                   	push   %edi
+  80114f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801150:	ba 00 00 00 00       	mov    $0x0,%edx
+  801155:	b8 14 00 00 00       	mov    $0x14,%eax
+  80115a:	89 d1                	mov    %edx,%ecx
+  80115c:	89 d3                	mov    %edx,%ebx
+  80115e:	89 d7                	mov    %edx,%edi
+  801160:	6a 00                	push   $0x0
+  801162:	55                   	push   %ebp
+  801163:	56                   	push   %esi
+  801164:	89 e5                	mov    %esp,%ebp
+  801166:	8d 35 6e 11 80 00    	lea    0x80116e,%esi
+  80116c:	0f 34                	sysenter
+
+0080116e <after_sysenter_label_1939>:
+  80116e:	5e                   	pop    %esi
+  80116f:	5d                   	pop    %ebp
+  801170:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  801173:	5b                   	pop    %ebx
+  801174:	5f                   	pop    %edi
+  801175:	5d                   	pop    %ebp
+  801176:	c3                   	ret
+
+00801177 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  801177:	55                   	push   %ebp
+  801178:	89 e5                	mov    %esp,%ebp
+  80117a:	57                   	push   %edi
+  80117b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80117c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80117f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801182:	b8 15 00 00 00       	mov    $0x15,%eax
+  801187:	bf 00 00 00 00       	mov    $0x0,%edi
+  80118c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80118f:	6a 00                	push   $0x0
+  801191:	55                   	push   %ebp
+  801192:	56                   	push   %esi
+  801193:	89 e5                	mov    %esp,%ebp
+  801195:	8d 35 9d 11 80 00    	lea    0x80119d,%esi
+  80119b:	0f 34                	sysenter
+
+0080119d <after_sysenter_label_2028>:
+  80119d:	5e                   	pop    %esi
+  80119e:	5d                   	pop    %ebp
+  80119f:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  8011a2:	5b                   	pop    %ebx
+  8011a3:	5f                   	pop    %edi
+  8011a4:	5d                   	pop    %ebp
+  8011a5:	c3                   	ret
+
+008011a6 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  8011a6:	55                   	push   %ebp
+  8011a7:	89 e5                	mov    %esp,%ebp
+  8011a9:	57                   	push   %edi
+  8011aa:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8011ab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011b3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011b6:	b8 16 00 00 00       	mov    $0x16,%eax
+  8011bb:	89 df                	mov    %ebx,%edi
+  8011bd:	6a 00                	push   $0x0
+  8011bf:	55                   	push   %ebp
+  8011c0:	56                   	push   %esi
+  8011c1:	89 e5                	mov    %esp,%ebp
+  8011c3:	8d 35 cb 11 80 00    	lea    0x8011cb,%esi
+  8011c9:	0f 34                	sysenter
+
+008011cb <after_sysenter_label_2114>:
+  8011cb:	5e                   	pop    %esi
+  8011cc:	5d                   	pop    %ebp
+  8011cd:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  8011d0:	5b                   	pop    %ebx
+  8011d1:	5f                   	pop    %edi
+  8011d2:	5d                   	pop    %ebp
+  8011d3:	c3                   	ret
+
+008011d4 <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  8011d4:	55                   	push   %ebp
+  8011d5:	89 e5                	mov    %esp,%ebp
+  8011d7:	57                   	push   %edi
+  8011d8:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8011d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011de:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011e1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011e4:	b8 17 00 00 00       	mov    $0x17,%eax
+  8011e9:	89 df                	mov    %ebx,%edi
+  8011eb:	6a 00                	push   $0x0
+  8011ed:	55                   	push   %ebp
+  8011ee:	56                   	push   %esi
+  8011ef:	89 e5                	mov    %esp,%ebp
+  8011f1:	8d 35 f9 11 80 00    	lea    0x8011f9,%esi
+  8011f7:	0f 34                	sysenter
+
+008011f9 <after_sysenter_label_2200>:
+  8011f9:	5e                   	pop    %esi
+  8011fa:	5d                   	pop    %ebp
+  8011fb:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  8011fe:	5b                   	pop    %ebx
+  8011ff:	5f                   	pop    %edi
+  801200:	5d                   	pop    %ebp
+  801201:	c3                   	ret
+
+00801202 <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  801202:	55                   	push   %ebp
+  801203:	89 e5                	mov    %esp,%ebp
+  801205:	57                   	push   %edi
+  801206:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801207:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80120c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80120f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801212:	b8 18 00 00 00       	mov    $0x18,%eax
+  801217:	89 df                	mov    %ebx,%edi
+  801219:	6a 00                	push   $0x0
+  80121b:	55                   	push   %ebp
+  80121c:	56                   	push   %esi
+  80121d:	89 e5                	mov    %esp,%ebp
+  80121f:	8d 35 27 12 80 00    	lea    0x801227,%esi
+  801225:	0f 34                	sysenter
+
+00801227 <after_sysenter_label_2286>:
+  801227:	5e                   	pop    %esi
+  801228:	5d                   	pop    %ebp
+  801229:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  80122c:	5b                   	pop    %ebx
+  80122d:	5f                   	pop    %edi
+  80122e:	5d                   	pop    %ebp
+  80122f:	c3                   	ret
+
+00801230 <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  801230:	55                   	push   %ebp
+  801231:	89 e5                	mov    %esp,%ebp
+  801233:	57                   	push   %edi
+  801234:	56                   	push   %esi
+  801235:	53                   	push   %ebx
+  801236:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  801239:	89 d6                	mov    %edx,%esi
+  80123b:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  80123e:	89 cf                	mov    %ecx,%edi
+  801240:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  801243:	89 fa                	mov    %edi,%edx
+  801245:	80 ce 08             	or     $0x8,%dh
+  801248:	f6 c5 08             	test   $0x8,%ch
+  80124b:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  80124e:	57                   	push   %edi
+  80124f:	56                   	push   %esi
+  801250:	50                   	push   %eax
+  801251:	56                   	push   %esi
+  801252:	6a 00                	push   $0x0
+  801254:	e8 82 fb ff ff       	call   800ddb <sys_page_map>
+	if (r < 0) {
+  801259:	83 c4 20             	add    $0x20,%esp
+  80125c:	85 c0                	test   %eax,%eax
+  80125e:	78 27                	js     801287 <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  801260:	83 ec 0c             	sub    $0xc,%esp
+  801263:	57                   	push   %edi
+  801264:	56                   	push   %esi
+  801265:	6a 00                	push   $0x0
+  801267:	56                   	push   %esi
+  801268:	6a 00                	push   $0x0
+  80126a:	e8 6c fb ff ff       	call   800ddb <sys_page_map>
+  80126f:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  801271:	83 c4 20             	add    $0x20,%esp
+  801274:	85 c0                	test   %eax,%eax
+  801276:	78 24                	js     80129c <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  801278:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  80127d:	89 d8                	mov    %ebx,%eax
+  80127f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801282:	5b                   	pop    %ebx
+  801283:	5e                   	pop    %esi
+  801284:	5f                   	pop    %edi
+  801285:	5d                   	pop    %ebp
+  801286:	c3                   	ret
+  801287:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  801289:	83 ec 08             	sub    $0x8,%esp
+  80128c:	50                   	push   %eax
+  80128d:	68 40 4d 80 00       	push   $0x804d40
+  801292:	e8 d5 f0 ff ff       	call   80036c <cprintf>
+		return r;
+  801297:	83 c4 10             	add    $0x10,%esp
+  80129a:	eb e1                	jmp    80127d <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  80129c:	83 ec 08             	sub    $0x8,%esp
+  80129f:	50                   	push   %eax
+  8012a0:	68 70 4d 80 00       	push   $0x804d70
+  8012a5:	e8 c2 f0 ff ff       	call   80036c <cprintf>
+		return r;
+  8012aa:	83 c4 10             	add    $0x10,%esp
+  8012ad:	eb ce                	jmp    80127d <duppage_cow+0x4d>
+
+008012af <duppage>:
+{
+  8012af:	55                   	push   %ebp
+  8012b0:	89 e5                	mov    %esp,%ebp
+  8012b2:	53                   	push   %ebx
+  8012b3:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  8012b6:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  8012b9:	51                   	push   %ecx
+  8012ba:	52                   	push   %edx
+  8012bb:	50                   	push   %eax
+  8012bc:	52                   	push   %edx
+  8012bd:	6a 00                	push   $0x0
+  8012bf:	e8 17 fb ff ff       	call   800ddb <sys_page_map>
+	if (r < 0) {
+  8012c4:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  8012c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  8012cc:	85 c0                	test   %eax,%eax
+  8012ce:	78 07                	js     8012d7 <duppage+0x28>
+}
+  8012d0:	89 d8                	mov    %ebx,%eax
+  8012d2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012d5:	c9                   	leave
+  8012d6:	c3                   	ret
+  8012d7:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  8012d9:	83 ec 08             	sub    $0x8,%esp
+  8012dc:	50                   	push   %eax
+  8012dd:	68 40 4d 80 00       	push   $0x804d40
+  8012e2:	e8 85 f0 ff ff       	call   80036c <cprintf>
+		return r;
+  8012e7:	83 c4 10             	add    $0x10,%esp
+  8012ea:	eb e4                	jmp    8012d0 <duppage+0x21>
+
+008012ec <cow_copy>:
+{
+  8012ec:	55                   	push   %ebp
+  8012ed:	89 e5                	mov    %esp,%ebp
+  8012ef:	56                   	push   %esi
+  8012f0:	53                   	push   %ebx
+  8012f1:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  8012f3:	83 ec 04             	sub    $0x4,%esp
+  8012f6:	6a 07                	push   $0x7
+  8012f8:	68 00 f0 7f 00       	push   $0x7ff000
+  8012fd:	6a 00                	push   $0x0
+  8012ff:	e8 8a fa ff ff       	call   800d8e <sys_page_alloc>
+	if (r < 0) {
+  801304:	83 c4 10             	add    $0x10,%esp
+  801307:	85 c0                	test   %eax,%eax
+  801309:	78 58                	js     801363 <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  80130b:	83 ec 04             	sub    $0x4,%esp
+  80130e:	68 00 10 00 00       	push   $0x1000
+  801313:	56                   	push   %esi
+  801314:	68 00 f0 7f 00       	push   $0x7ff000
+  801319:	e8 b8 f7 ff ff       	call   800ad6 <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  80131e:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801325:	56                   	push   %esi
+  801326:	6a 00                	push   $0x0
+  801328:	68 00 f0 7f 00       	push   $0x7ff000
+  80132d:	6a 00                	push   $0x0
+  80132f:	e8 a7 fa ff ff       	call   800ddb <sys_page_map>
+  801334:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  801336:	83 c4 20             	add    $0x20,%esp
+  801339:	85 c0                	test   %eax,%eax
+  80133b:	78 3b                	js     801378 <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  80133d:	83 ec 08             	sub    $0x8,%esp
+  801340:	68 00 f0 7f 00       	push   $0x7ff000
+  801345:	6a 00                	push   $0x0
+  801347:	e8 db fa ff ff       	call   800e27 <sys_page_unmap>
+  80134c:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  80134e:	83 c4 10             	add    $0x10,%esp
+  801351:	85 c0                	test   %eax,%eax
+  801353:	78 45                	js     80139a <cow_copy+0xae>
+	return 0;
+  801355:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  80135a:	89 d8                	mov    %ebx,%eax
+  80135c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80135f:	5b                   	pop    %ebx
+  801360:	5e                   	pop    %esi
+  801361:	5d                   	pop    %ebp
+  801362:	c3                   	ret
+  801363:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  801365:	83 ec 08             	sub    $0x8,%esp
+  801368:	50                   	push   %eax
+  801369:	68 60 4e 80 00       	push   $0x804e60
+  80136e:	e8 f9 ef ff ff       	call   80036c <cprintf>
+		return r;
+  801373:	83 c4 10             	add    $0x10,%esp
+  801376:	eb e2                	jmp    80135a <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  801378:	83 ec 08             	sub    $0x8,%esp
+  80137b:	50                   	push   %eax
+  80137c:	68 7c 4e 80 00       	push   $0x804e7c
+  801381:	e8 e6 ef ff ff       	call   80036c <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  801386:	83 c4 08             	add    $0x8,%esp
+  801389:	68 00 f0 7f 00       	push   $0x7ff000
+  80138e:	6a 00                	push   $0x0
+  801390:	e8 92 fa ff ff       	call   800e27 <sys_page_unmap>
+		return r;
+  801395:	83 c4 10             	add    $0x10,%esp
+  801398:	eb c0                	jmp    80135a <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  80139a:	83 ec 08             	sub    $0x8,%esp
+  80139d:	50                   	push   %eax
+  80139e:	68 98 4d 80 00       	push   $0x804d98
+  8013a3:	e8 c4 ef ff ff       	call   80036c <cprintf>
+		return r;
+  8013a8:	83 c4 10             	add    $0x10,%esp
+  8013ab:	eb ad                	jmp    80135a <cow_copy+0x6e>
+
+008013ad <pgfault>:
+{
+  8013ad:	55                   	push   %ebp
+  8013ae:	89 e5                	mov    %esp,%ebp
+  8013b0:	56                   	push   %esi
+  8013b1:	53                   	push   %ebx
+  8013b2:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  8013b5:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  8013b7:	89 d8                	mov    %ebx,%eax
+  8013b9:	c1 e8 16             	shr    $0x16,%eax
+  8013bc:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  8013c3:	89 de                	mov    %ebx,%esi
+  8013c5:	c1 ee 0c             	shr    $0xc,%esi
+  8013c8:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  8013cf:	a8 07                	test   $0x7,%al
+  8013d1:	74 3b                	je     80140e <pgfault+0x61>
+  8013d3:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  8013d9:	74 33                	je     80140e <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  8013db:	83 ec 0c             	sub    $0xc,%esp
+  8013de:	68 00 f0 bf ee       	push   $0xeebff000
+  8013e3:	e8 43 28 00 00       	call   803c2b <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  8013e8:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  8013ef:	83 c4 10             	add    $0x10,%esp
+  8013f2:	f6 c4 08             	test   $0x8,%ah
+  8013f5:	75 30                	jne    801427 <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  8013f7:	83 ec 0c             	sub    $0xc,%esp
+  8013fa:	68 00 f0 bf ee       	push   $0xeebff000
+  8013ff:	e8 94 28 00 00       	call   803c98 <mutex_unlock>
+}
+  801404:	83 c4 10             	add    $0x10,%esp
+  801407:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80140a:	5b                   	pop    %ebx
+  80140b:	5e                   	pop    %esi
+  80140c:	5d                   	pop    %ebp
+  80140d:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  80140e:	83 ec 08             	sub    $0x8,%esp
+  801411:	ff 72 28             	push   0x28(%edx)
+  801414:	51                   	push   %ecx
+  801415:	50                   	push   %eax
+  801416:	68 bc 4d 80 00       	push   $0x804dbc
+  80141b:	6a 3f                	push   $0x3f
+  80141d:	68 96 4e 80 00       	push   $0x804e96
+  801422:	e8 6a ee ff ff       	call   800291 <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  801427:	89 d8                	mov    %ebx,%eax
+  801429:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  80142e:	e8 b9 fe ff ff       	call   8012ec <cow_copy>
+  801433:	eb c2                	jmp    8013f7 <pgfault+0x4a>
+
+00801435 <cow_enable>:
+{
+  801435:	55                   	push   %ebp
+  801436:	89 e5                	mov    %esp,%ebp
+  801438:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  80143b:	68 ad 13 80 00       	push   $0x8013ad
+  801440:	e8 66 31 00 00       	call   8045ab <set_pgfault_handler>
+}
+  801445:	83 c4 10             	add    $0x10,%esp
+  801448:	c9                   	leave
+  801449:	c3                   	ret
+
+0080144a <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  80144a:	55                   	push   %ebp
+  80144b:	89 e5                	mov    %esp,%ebp
+  80144d:	57                   	push   %edi
+  80144e:	56                   	push   %esi
+  80144f:	53                   	push   %ebx
+  801450:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  801453:	68 ad 13 80 00       	push   $0x8013ad
+  801458:	e8 4e 31 00 00       	call   8045ab <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  80145d:	b8 07 00 00 00       	mov    $0x7,%eax
+  801462:	cd 30                	int    $0x30
+  801464:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  801467:	83 c4 10             	add    $0x10,%esp
+  80146a:	85 c0                	test   %eax,%eax
+  80146c:	78 4b                	js     8014b9 <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  80146e:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  801473:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801478:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  80147b:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80147f:	0f 85 16 01 00 00    	jne    80159b <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801485:	e8 ac f8 ff ff       	call   800d36 <sys_getenvid>
+  80148a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80148f:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801491:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  801497:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  80149d:	77 32                	ja     8014d1 <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80149f:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  8014a4:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  8014a6:	c1 ea 10             	shr    $0x10,%edx
+  8014a9:	74 26                	je     8014d1 <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8014ab:	c1 e2 10             	shl    $0x10,%edx
+  8014ae:	89 d1                	mov    %edx,%ecx
+  8014b0:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8014b5:	29 ca                	sub    %ecx,%edx
+  8014b7:	eb 1e                	jmp    8014d7 <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  8014b9:	83 ec 08             	sub    $0x8,%esp
+  8014bc:	89 c7                	mov    %eax,%edi
+  8014be:	50                   	push   %eax
+  8014bf:	68 a1 4e 80 00       	push   $0x804ea1
+  8014c4:	e8 a3 ee ff ff       	call   80036c <cprintf>
+		return eid;
+  8014c9:	83 c4 10             	add    $0x10,%esp
+  8014cc:	e9 6c 01 00 00       	jmp    80163d <fork+0x1f3>
+		return pthread_main_tls;
+  8014d1:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8014d7:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8014da:	c1 e0 04             	shl    $0x4,%eax
+  8014dd:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8014e2:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  8014e4:	e8 8b 2e 00 00       	call   804374 <pthread_fork_child>
+		return eid;
+  8014e9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8014ec:	e9 4c 01 00 00       	jmp    80163d <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8014f1:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8014f7:	89 da                	mov    %ebx,%edx
+  8014f9:	89 f8                	mov    %edi,%eax
+  8014fb:	e8 af fd ff ff       	call   8012af <duppage>
+  801500:	85 c0                	test   %eax,%eax
+  801502:	79 28                	jns    80152c <fork+0xe2>
+  801504:	89 c7                	mov    %eax,%edi
+  801506:	e9 32 01 00 00       	jmp    80163d <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  80150b:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  801511:	83 f9 05             	cmp    $0x5,%ecx
+  801514:	75 58                	jne    80156e <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  801516:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80151b:	89 da                	mov    %ebx,%edx
+  80151d:	89 f8                	mov    %edi,%eax
+  80151f:	e8 8b fd ff ff       	call   8012af <duppage>
+  801524:	85 c0                	test   %eax,%eax
+  801526:	0f 88 0f 01 00 00    	js     80163b <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  80152c:	83 c3 01             	add    $0x1,%ebx
+  80152f:	39 de                	cmp    %ebx,%esi
+  801531:	74 54                	je     801587 <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  801533:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  80153a:	f6 c1 05             	test   $0x5,%cl
+  80153d:	74 ed                	je     80152c <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  80153f:	f6 c5 04             	test   $0x4,%ch
+  801542:	75 ad                	jne    8014f1 <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  801544:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  80154a:	74 bf                	je     80150b <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  80154c:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  801552:	74 d8                	je     80152c <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  801554:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  80155a:	89 da                	mov    %ebx,%edx
+  80155c:	89 f8                	mov    %edi,%eax
+  80155e:	e8 cd fc ff ff       	call   801230 <duppage_cow>
+  801563:	85 c0                	test   %eax,%eax
+  801565:	79 c5                	jns    80152c <fork+0xe2>
+  801567:	89 c7                	mov    %eax,%edi
+  801569:	e9 cf 00 00 00       	jmp    80163d <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  80156e:	68 ec 4d 80 00       	push   $0x804dec
+  801573:	68 b1 4e 80 00       	push   $0x804eb1
+  801578:	68 c6 00 00 00       	push   $0xc6
+  80157d:	68 96 4e 80 00       	push   $0x804e96
+  801582:	e8 0a ed ff ff       	call   800291 <_panic>
+  801587:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80158a:	83 c1 01             	add    $0x1,%ecx
+  80158d:	81 c6 00 04 00 00    	add    $0x400,%esi
+  801593:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  801599:	74 18                	je     8015b3 <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  80159b:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  8015a2:	a8 07                	test   $0x7,%al
+  8015a4:	74 e4                	je     80158a <fork+0x140>
+  8015a6:	89 cb                	mov    %ecx,%ebx
+  8015a8:	c1 e3 0a             	shl    $0xa,%ebx
+  8015ab:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8015ae:	e9 7c ff ff ff       	jmp    80152f <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  8015b3:	83 ec 04             	sub    $0x4,%esp
+  8015b6:	6a 07                	push   $0x7
+  8015b8:	68 00 f0 bf ee       	push   $0xeebff000
+  8015bd:	ff 75 e4             	push   -0x1c(%ebp)
+  8015c0:	e8 c9 f7 ff ff       	call   800d8e <sys_page_alloc>
+  8015c5:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8015c7:	83 c4 10             	add    $0x10,%esp
+  8015ca:	85 c0                	test   %eax,%eax
+  8015cc:	78 34                	js     801602 <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  8015ce:	83 ec 08             	sub    $0x8,%esp
+  8015d1:	68 e9 45 80 00       	push   $0x8045e9
+  8015d6:	ff 75 e4             	push   -0x1c(%ebp)
+  8015d9:	e8 2d f9 ff ff       	call   800f0b <sys_env_set_pgfault_upcall>
+  8015de:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8015e0:	83 c4 10             	add    $0x10,%esp
+  8015e3:	85 c0                	test   %eax,%eax
+  8015e5:	78 2e                	js     801615 <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  8015e7:	83 ec 08             	sub    $0x8,%esp
+  8015ea:	6a 02                	push   $0x2
+  8015ec:	ff 75 e4             	push   -0x1c(%ebp)
+  8015ef:	e8 7f f8 ff ff       	call   800e73 <sys_env_set_status>
+  8015f4:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8015f6:	83 c4 10             	add    $0x10,%esp
+  8015f9:	85 c0                	test   %eax,%eax
+  8015fb:	78 2b                	js     801628 <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  8015fd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801600:	eb 3b                	jmp    80163d <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  801602:	83 ec 08             	sub    $0x8,%esp
+  801605:	50                   	push   %eax
+  801606:	68 14 4e 80 00       	push   $0x804e14
+  80160b:	e8 5c ed ff ff       	call   80036c <cprintf>
+		return r;
+  801610:	83 c4 10             	add    $0x10,%esp
+  801613:	eb 28                	jmp    80163d <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  801615:	83 ec 08             	sub    $0x8,%esp
+  801618:	50                   	push   %eax
+  801619:	68 3c 4e 80 00       	push   $0x804e3c
+  80161e:	e8 49 ed ff ff       	call   80036c <cprintf>
+		return r;
+  801623:	83 c4 10             	add    $0x10,%esp
+  801626:	eb 15                	jmp    80163d <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  801628:	83 ec 08             	sub    $0x8,%esp
+  80162b:	50                   	push   %eax
+  80162c:	68 c6 4e 80 00       	push   $0x804ec6
+  801631:	e8 36 ed ff ff       	call   80036c <cprintf>
+		return r;
+  801636:	83 c4 10             	add    $0x10,%esp
+  801639:	eb 02                	jmp    80163d <fork+0x1f3>
+  80163b:	89 c7                	mov    %eax,%edi
+}
+  80163d:	89 f8                	mov    %edi,%eax
+  80163f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801642:	5b                   	pop    %ebx
+  801643:	5e                   	pop    %esi
+  801644:	5f                   	pop    %edi
+  801645:	5d                   	pop    %ebp
+  801646:	c3                   	ret
+
+00801647 <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  801647:	55                   	push   %ebp
+  801648:	89 e5                	mov    %esp,%ebp
+  80164a:	57                   	push   %edi
+  80164b:	56                   	push   %esi
+  80164c:	53                   	push   %ebx
+  80164d:	83 ec 2c             	sub    $0x2c,%esp
+  801650:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801652:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  801658:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80165d:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  801663:	77 0a                	ja     80166f <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801665:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  80166a:	29 c3                	sub    %eax,%ebx
+  80166c:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  80166f:	83 ec 0c             	sub    $0xc,%esp
+  801672:	68 ad 13 80 00       	push   $0x8013ad
+  801677:	e8 2f 2f 00 00       	call   8045ab <set_pgfault_handler>
+  80167c:	b8 07 00 00 00       	mov    $0x7,%eax
+  801681:	cd 30                	int    $0x30
+  801683:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  801686:	83 c4 10             	add    $0x10,%esp
+  801689:	85 c0                	test   %eax,%eax
+  80168b:	78 30                	js     8016bd <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  80168d:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801691:	74 42                	je     8016d5 <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  801693:	c1 e3 10             	shl    $0x10,%ebx
+  801696:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  80169b:	29 d8                	sub    %ebx,%eax
+  80169d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8016a0:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  8016a5:	29 d8                	sub    %ebx,%eax
+  8016a7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8016aa:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8016af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016b4:	89 f7                	mov    %esi,%edi
+  8016b6:	89 d6                	mov    %edx,%esi
+  8016b8:	e9 2c 01 00 00       	jmp    8017e9 <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  8016bd:	83 ec 08             	sub    $0x8,%esp
+  8016c0:	89 c7                	mov    %eax,%edi
+  8016c2:	50                   	push   %eax
+  8016c3:	68 a1 4e 80 00       	push   $0x804ea1
+  8016c8:	e8 9f ec ff ff       	call   80036c <cprintf>
+		return eid;
+  8016cd:	83 c4 10             	add    $0x10,%esp
+  8016d0:	e9 d5 00 00 00       	jmp    8017aa <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8016d5:	e8 5c f6 ff ff       	call   800d36 <sys_getenvid>
+  8016da:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8016df:	89 c2                	mov    %eax,%edx
+  8016e1:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8016e3:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  8016e9:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8016ee:	77 18                	ja     801708 <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8016f0:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8016f5:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  8016f7:	c1 e8 10             	shr    $0x10,%eax
+  8016fa:	74 0c                	je     801708 <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8016fc:	c1 e0 10             	shl    $0x10,%eax
+  8016ff:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  801704:	29 c1                	sub    %eax,%ecx
+  801706:	eb 06                	jmp    80170e <sfork+0xc7>
+		return pthread_main_tls;
+  801708:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+  80170e:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  801711:	c1 e0 04             	shl    $0x4,%eax
+  801714:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801719:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  80171b:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  80171e:	e9 87 00 00 00       	jmp    8017aa <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  801723:	f6 c5 04             	test   $0x4,%ch
+  801726:	74 6c                	je     801794 <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  801728:	89 ca                	mov    %ecx,%edx
+  80172a:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  801730:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  801736:	74 7c                	je     8017b4 <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  801738:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  80173e:	89 da                	mov    %ebx,%edx
+  801740:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801743:	e8 67 fb ff ff       	call   8012af <duppage>
+  801748:	85 c0                	test   %eax,%eax
+  80174a:	0f 88 4f 01 00 00    	js     80189f <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  801750:	83 c3 01             	add    $0x1,%ebx
+  801753:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  801756:	74 7a                	je     8017d2 <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  801758:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  80175a:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  801761:	f6 c1 01             	test   $0x1,%cl
+  801764:	74 ea                	je     801750 <sfork+0x109>
+  801766:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  80176c:	74 e2                	je     801750 <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  80176e:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  801774:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  801777:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  80177c:	76 a5                	jbe    801723 <sfork+0xdc>
+  80177e:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  801784:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  801787:	39 fa                	cmp    %edi,%edx
+  801789:	73 9d                	jae    801728 <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  80178b:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  80178e:	39 fa                	cmp    %edi,%edx
+  801790:	72 96                	jb     801728 <sfork+0xe1>
+  801792:	eb 8f                	jmp    801723 <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  801794:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  80179a:	89 da                	mov    %ebx,%edx
+  80179c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80179f:	e8 8c fa ff ff       	call   801230 <duppage_cow>
+  8017a4:	85 c0                	test   %eax,%eax
+  8017a6:	79 a8                	jns    801750 <sfork+0x109>
+  8017a8:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  8017aa:	89 f8                	mov    %edi,%eax
+  8017ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017af:	5b                   	pop    %ebx
+  8017b0:	5e                   	pop    %esi
+  8017b1:	5f                   	pop    %edi
+  8017b2:	5d                   	pop    %ebp
+  8017b3:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  8017b4:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  8017b9:	e8 2e fb ff ff       	call   8012ec <cow_copy>
+  8017be:	85 c0                	test   %eax,%eax
+  8017c0:	0f 88 d2 00 00 00    	js     801898 <sfork+0x251>
+				pte = uvpt[pn];
+  8017c6:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  8017cd:	e9 66 ff ff ff       	jmp    801738 <sfork+0xf1>
+  8017d2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8017d5:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8017d8:	83 c6 01             	add    $0x1,%esi
+  8017db:	81 c7 00 04 00 00    	add    $0x400,%edi
+  8017e1:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  8017e7:	74 1b                	je     801804 <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  8017e9:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  8017f0:	a8 01                	test   $0x1,%al
+  8017f2:	74 e4                	je     8017d8 <sfork+0x191>
+  8017f4:	89 f3                	mov    %esi,%ebx
+  8017f6:	c1 e3 0a             	shl    $0xa,%ebx
+  8017f9:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  8017fc:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  8017ff:	e9 4f ff ff ff       	jmp    801753 <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  801804:	83 ec 04             	sub    $0x4,%esp
+  801807:	6a 07                	push   $0x7
+  801809:	68 00 f0 bf ee       	push   $0xeebff000
+  80180e:	ff 75 e0             	push   -0x20(%ebp)
+  801811:	e8 78 f5 ff ff       	call   800d8e <sys_page_alloc>
+  801816:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801818:	83 c4 10             	add    $0x10,%esp
+  80181b:	85 c0                	test   %eax,%eax
+  80181d:	78 37                	js     801856 <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  80181f:	83 ec 08             	sub    $0x8,%esp
+  801822:	68 e9 45 80 00       	push   $0x8045e9
+  801827:	ff 75 e0             	push   -0x20(%ebp)
+  80182a:	e8 dc f6 ff ff       	call   800f0b <sys_env_set_pgfault_upcall>
+  80182f:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801831:	83 c4 10             	add    $0x10,%esp
+  801834:	85 c0                	test   %eax,%eax
+  801836:	78 34                	js     80186c <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  801838:	83 ec 08             	sub    $0x8,%esp
+  80183b:	6a 02                	push   $0x2
+  80183d:	ff 75 e0             	push   -0x20(%ebp)
+  801840:	e8 2e f6 ff ff       	call   800e73 <sys_env_set_status>
+  801845:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801847:	83 c4 10             	add    $0x10,%esp
+  80184a:	85 c0                	test   %eax,%eax
+  80184c:	78 34                	js     801882 <sfork+0x23b>
+	return eid;
+  80184e:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801851:	e9 54 ff ff ff       	jmp    8017aa <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  801856:	83 ec 08             	sub    $0x8,%esp
+  801859:	50                   	push   %eax
+  80185a:	68 14 4e 80 00       	push   $0x804e14
+  80185f:	e8 08 eb ff ff       	call   80036c <cprintf>
+		return r;
+  801864:	83 c4 10             	add    $0x10,%esp
+  801867:	e9 3e ff ff ff       	jmp    8017aa <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  80186c:	83 ec 08             	sub    $0x8,%esp
+  80186f:	50                   	push   %eax
+  801870:	68 3c 4e 80 00       	push   $0x804e3c
+  801875:	e8 f2 ea ff ff       	call   80036c <cprintf>
+		return r;
+  80187a:	83 c4 10             	add    $0x10,%esp
+  80187d:	e9 28 ff ff ff       	jmp    8017aa <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  801882:	83 ec 08             	sub    $0x8,%esp
+  801885:	50                   	push   %eax
+  801886:	68 c6 4e 80 00       	push   $0x804ec6
+  80188b:	e8 dc ea ff ff       	call   80036c <cprintf>
+		return r;
+  801890:	83 c4 10             	add    $0x10,%esp
+  801893:	e9 12 ff ff ff       	jmp    8017aa <sfork+0x163>
+  801898:	89 c7                	mov    %eax,%edi
+  80189a:	e9 0b ff ff ff       	jmp    8017aa <sfork+0x163>
+  80189f:	89 c7                	mov    %eax,%edi
+  8018a1:	e9 04 ff ff ff       	jmp    8017aa <sfork+0x163>
+
+008018a6 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8018a6:	55                   	push   %ebp
+  8018a7:	89 e5                	mov    %esp,%ebp
+  8018a9:	57                   	push   %edi
+  8018aa:	56                   	push   %esi
+  8018ab:	53                   	push   %ebx
+  8018ac:	83 ec 18             	sub    $0x18,%esp
+  8018af:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8018b2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8018b5:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  8018b8:	85 c0                	test   %eax,%eax
+  8018ba:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8018bf:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  8018c2:	50                   	push   %eax
+  8018c3:	e8 bc f6 ff ff       	call   800f84 <sys_ipc_recv>
+	if (r < 0) {
+  8018c8:	83 c4 10             	add    $0x10,%esp
+  8018cb:	85 c0                	test   %eax,%eax
+  8018cd:	78 2b                	js     8018fa <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  8018cf:	85 ff                	test   %edi,%edi
+  8018d1:	74 55                	je     801928 <ipc_recv+0x82>
+  8018d3:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8018d5:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8018db:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8018e0:	77 39                	ja     80191b <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8018e2:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8018e7:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8018e9:	c1 e8 10             	shr    $0x10,%eax
+  8018ec:	74 2d                	je     80191b <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8018ee:	c1 e0 10             	shl    $0x10,%eax
+  8018f1:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8018f6:	29 c2                	sub    %eax,%edx
+  8018f8:	eb 27                	jmp    801921 <ipc_recv+0x7b>
+  8018fa:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  8018fc:	83 ec 08             	sub    $0x8,%esp
+  8018ff:	50                   	push   %eax
+  801900:	68 e4 4e 80 00       	push   $0x804ee4
+  801905:	e8 62 ea ff ff       	call   80036c <cprintf>
+		*from_env_store = 0;
+  80190a:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  801910:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  801916:	83 c4 10             	add    $0x10,%esp
+  801919:	eb 77                	jmp    801992 <ipc_recv+0xec>
+		return pthread_main_tls;
+  80191b:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  801921:	8b 02                	mov    (%edx),%eax
+  801923:	8b 40 78             	mov    0x78(%eax),%eax
+  801926:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  801928:	85 f6                	test   %esi,%esi
+  80192a:	74 34                	je     801960 <ipc_recv+0xba>
+  80192c:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80192e:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801934:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801939:	77 18                	ja     801953 <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80193b:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801940:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801942:	c1 e8 10             	shr    $0x10,%eax
+  801945:	74 0c                	je     801953 <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801947:	c1 e0 10             	shl    $0x10,%eax
+  80194a:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80194f:	29 c2                	sub    %eax,%edx
+  801951:	eb 06                	jmp    801959 <ipc_recv+0xb3>
+		return pthread_main_tls;
+  801953:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  801959:	8b 02                	mov    (%edx),%eax
+  80195b:	8b 40 7c             	mov    0x7c(%eax),%eax
+  80195e:	89 06                	mov    %eax,(%esi)
+  801960:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801962:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801968:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80196d:	77 18                	ja     801987 <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80196f:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801974:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801976:	c1 e8 10             	shr    $0x10,%eax
+  801979:	74 0c                	je     801987 <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80197b:	c1 e0 10             	shl    $0x10,%eax
+  80197e:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801983:	29 c2                	sub    %eax,%edx
+  801985:	eb 06                	jmp    80198d <ipc_recv+0xe7>
+		return pthread_main_tls;
+  801987:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+	}
+	return thisenv->env_ipc_value;
+  80198d:	8b 02                	mov    (%edx),%eax
+  80198f:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  801992:	89 d8                	mov    %ebx,%eax
+  801994:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801997:	5b                   	pop    %ebx
+  801998:	5e                   	pop    %esi
+  801999:	5f                   	pop    %edi
+  80199a:	5d                   	pop    %ebp
+  80199b:	c3                   	ret
+
+0080199c <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  80199c:	55                   	push   %ebp
+  80199d:	89 e5                	mov    %esp,%ebp
+  80199f:	57                   	push   %edi
+  8019a0:	56                   	push   %esi
+  8019a1:	53                   	push   %ebx
+  8019a2:	83 ec 0c             	sub    $0xc,%esp
+  8019a5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8019a8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8019ab:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  8019ae:	85 db                	test   %ebx,%ebx
+  8019b0:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8019b5:	0f 44 d8             	cmove  %eax,%ebx
+  8019b8:	eb 05                	jmp    8019bf <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  8019ba:	e8 a3 f3 ff ff       	call   800d62 <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  8019bf:	57                   	push   %edi
+  8019c0:	53                   	push   %ebx
+  8019c1:	ff 75 0c             	push   0xc(%ebp)
+  8019c4:	56                   	push   %esi
+  8019c5:	e8 8d f5 ff ff       	call   800f57 <sys_ipc_try_send>
+		if (r == 0) {
+  8019ca:	83 c4 10             	add    $0x10,%esp
+  8019cd:	85 c0                	test   %eax,%eax
+  8019cf:	74 19                	je     8019ea <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  8019d1:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8019d4:	74 e4                	je     8019ba <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  8019d6:	83 ec 0c             	sub    $0xc,%esp
+  8019d9:	50                   	push   %eax
+  8019da:	57                   	push   %edi
+  8019db:	53                   	push   %ebx
+  8019dc:	56                   	push   %esi
+  8019dd:	68 00 4f 80 00       	push   $0x804f00
+  8019e2:	e8 85 e9 ff ff       	call   80036c <cprintf>
+			return;
+  8019e7:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  8019ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019ed:	5b                   	pop    %ebx
+  8019ee:	5e                   	pop    %esi
+  8019ef:	5f                   	pop    %edi
+  8019f0:	5d                   	pop    %ebp
+  8019f1:	c3                   	ret
+
+008019f2 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8019f2:	55                   	push   %ebp
+  8019f3:	89 e5                	mov    %esp,%ebp
+  8019f5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8019f8:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  8019fd:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  801a00:	c1 e0 04             	shl    $0x4,%eax
+  801a03:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801a08:	8b 40 50             	mov    0x50(%eax),%eax
+  801a0b:	39 c8                	cmp    %ecx,%eax
+  801a0d:	74 12                	je     801a21 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  801a0f:	83 c2 01             	add    $0x1,%edx
+  801a12:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  801a18:	75 e3                	jne    8019fd <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  801a1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a1f:	eb 0e                	jmp    801a2f <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  801a21:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  801a24:	c1 e0 04             	shl    $0x4,%eax
+  801a27:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801a2c:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  801a2f:	5d                   	pop    %ebp
+  801a30:	c3                   	ret
+
+00801a31 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801a31:	55                   	push   %ebp
+  801a32:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801a34:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a37:	05 00 00 00 30       	add    $0x30000000,%eax
+  801a3c:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801a3f:	5d                   	pop    %ebp
+  801a40:	c3                   	ret
+
+00801a41 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801a41:	55                   	push   %ebp
+  801a42:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801a44:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a47:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801a4c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801a51:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801a56:	5d                   	pop    %ebp
+  801a57:	c3                   	ret
+
+00801a58 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801a58:	55                   	push   %ebp
+  801a59:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801a5b:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801a60:	eb 02                	jmp    801a64 <fd_alloc+0xc>
+  801a62:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801a64:	89 c2                	mov    %eax,%edx
+  801a66:	c1 ea 16             	shr    $0x16,%edx
+  801a69:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801a70:	f6 c2 01             	test   $0x1,%dl
+  801a73:	74 2b                	je     801aa0 <fd_alloc+0x48>
+  801a75:	89 c2                	mov    %eax,%edx
+  801a77:	c1 ea 0c             	shr    $0xc,%edx
+  801a7a:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801a81:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801a87:	f6 c1 01             	test   $0x1,%cl
+  801a8a:	74 14                	je     801aa0 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801a8c:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801a92:	75 ce                	jne    801a62 <fd_alloc+0xa>
+  801a94:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801a99:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801a9e:	eb 05                	jmp    801aa5 <fd_alloc+0x4d>
+			return 0;
+  801aa0:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801aa5:	8b 55 08             	mov    0x8(%ebp),%edx
+  801aa8:	89 02                	mov    %eax,(%edx)
+}
+  801aaa:	89 c8                	mov    %ecx,%eax
+  801aac:	5d                   	pop    %ebp
+  801aad:	c3                   	ret
+
+00801aae <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801aae:	55                   	push   %ebp
+  801aaf:	89 e5                	mov    %esp,%ebp
+  801ab1:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801ab4:	83 f8 1f             	cmp    $0x1f,%eax
+  801ab7:	77 30                	ja     801ae9 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801ab9:	c1 e0 0c             	shl    $0xc,%eax
+  801abc:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801ac1:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801ac7:	f6 c2 01             	test   $0x1,%dl
+  801aca:	74 24                	je     801af0 <fd_lookup+0x42>
+  801acc:	89 c2                	mov    %eax,%edx
+  801ace:	c1 ea 0c             	shr    $0xc,%edx
+  801ad1:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801ad8:	f6 c2 01             	test   $0x1,%dl
+  801adb:	74 1a                	je     801af7 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801add:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ae0:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801ae2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ae7:	5d                   	pop    %ebp
+  801ae8:	c3                   	ret
+		return -E_INVAL;
+  801ae9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801aee:	eb f7                	jmp    801ae7 <fd_lookup+0x39>
+		return -E_INVAL;
+  801af0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801af5:	eb f0                	jmp    801ae7 <fd_lookup+0x39>
+  801af7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801afc:	eb e9                	jmp    801ae7 <fd_lookup+0x39>
+
+00801afe <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801afe:	55                   	push   %ebp
+  801aff:	89 e5                	mov    %esp,%ebp
+  801b01:	53                   	push   %ebx
+  801b02:	83 ec 04             	sub    $0x4,%esp
+  801b05:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801b08:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b0d:	eb 03                	jmp    801b12 <dev_lookup+0x14>
+  801b0f:	83 c0 01             	add    $0x1,%eax
+  801b12:	8b 1c 85 b4 4f 80 00 	mov    0x804fb4(,%eax,4),%ebx
+  801b19:	85 db                	test   %ebx,%ebx
+  801b1b:	74 0b                	je     801b28 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801b1d:	39 13                	cmp    %edx,(%ebx)
+  801b1f:	75 ee                	jne    801b0f <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801b21:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b26:	eb 49                	jmp    801b71 <dev_lookup+0x73>
+  801b28:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801b2a:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  801b30:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801b35:	77 18                	ja     801b4f <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801b37:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801b3c:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  801b3e:	c1 e8 10             	shr    $0x10,%eax
+  801b41:	74 0c                	je     801b4f <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801b43:	c1 e0 10             	shl    $0x10,%eax
+  801b46:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  801b4b:	29 c1                	sub    %eax,%ecx
+  801b4d:	eb 06                	jmp    801b55 <dev_lookup+0x57>
+		return pthread_main_tls;
+  801b4f:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801b55:	8b 01                	mov    (%ecx),%eax
+  801b57:	8b 40 48             	mov    0x48(%eax),%eax
+  801b5a:	83 ec 04             	sub    $0x4,%esp
+  801b5d:	52                   	push   %edx
+  801b5e:	50                   	push   %eax
+  801b5f:	68 38 4f 80 00       	push   $0x804f38
+  801b64:	e8 03 e8 ff ff       	call   80036c <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801b69:	83 c4 10             	add    $0x10,%esp
+  801b6c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801b71:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b74:	89 1a                	mov    %ebx,(%edx)
+}
+  801b76:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b79:	c9                   	leave
+  801b7a:	c3                   	ret
+
+00801b7b <fd_close>:
+{
+  801b7b:	55                   	push   %ebp
+  801b7c:	89 e5                	mov    %esp,%ebp
+  801b7e:	57                   	push   %edi
+  801b7f:	56                   	push   %esi
+  801b80:	53                   	push   %ebx
+  801b81:	83 ec 24             	sub    $0x24,%esp
+  801b84:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b87:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801b8a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801b8d:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801b8e:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801b94:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801b97:	50                   	push   %eax
+  801b98:	e8 11 ff ff ff       	call   801aae <fd_lookup>
+  801b9d:	89 c3                	mov    %eax,%ebx
+  801b9f:	83 c4 10             	add    $0x10,%esp
+  801ba2:	85 c0                	test   %eax,%eax
+  801ba4:	78 05                	js     801bab <fd_close+0x30>
+	    || fd != fd2)
+  801ba6:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801ba9:	74 16                	je     801bc1 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801bab:	89 f8                	mov    %edi,%eax
+  801bad:	84 c0                	test   %al,%al
+  801baf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bb4:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801bb7:	89 d8                	mov    %ebx,%eax
+  801bb9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bbc:	5b                   	pop    %ebx
+  801bbd:	5e                   	pop    %esi
+  801bbe:	5f                   	pop    %edi
+  801bbf:	5d                   	pop    %ebp
+  801bc0:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801bc1:	83 ec 08             	sub    $0x8,%esp
+  801bc4:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801bc7:	50                   	push   %eax
+  801bc8:	ff 36                	push   (%esi)
+  801bca:	e8 2f ff ff ff       	call   801afe <dev_lookup>
+  801bcf:	89 c3                	mov    %eax,%ebx
+  801bd1:	83 c4 10             	add    $0x10,%esp
+  801bd4:	85 c0                	test   %eax,%eax
+  801bd6:	78 1a                	js     801bf2 <fd_close+0x77>
+		if (dev->dev_close)
+  801bd8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801bdb:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801bde:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801be3:	85 c0                	test   %eax,%eax
+  801be5:	74 0b                	je     801bf2 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801be7:	83 ec 0c             	sub    $0xc,%esp
+  801bea:	56                   	push   %esi
+  801beb:	ff d0                	call   *%eax
+  801bed:	89 c3                	mov    %eax,%ebx
+  801bef:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801bf2:	83 ec 08             	sub    $0x8,%esp
+  801bf5:	56                   	push   %esi
+  801bf6:	6a 00                	push   $0x0
+  801bf8:	e8 2a f2 ff ff       	call   800e27 <sys_page_unmap>
+	return r;
+  801bfd:	83 c4 10             	add    $0x10,%esp
+  801c00:	eb b5                	jmp    801bb7 <fd_close+0x3c>
+
+00801c02 <close>:
+
+int
+close(int fdnum)
+{
+  801c02:	55                   	push   %ebp
+  801c03:	89 e5                	mov    %esp,%ebp
+  801c05:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801c08:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c0b:	50                   	push   %eax
+  801c0c:	ff 75 08             	push   0x8(%ebp)
+  801c0f:	e8 9a fe ff ff       	call   801aae <fd_lookup>
+  801c14:	83 c4 10             	add    $0x10,%esp
+  801c17:	85 c0                	test   %eax,%eax
+  801c19:	79 02                	jns    801c1d <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801c1b:	c9                   	leave
+  801c1c:	c3                   	ret
+		return fd_close(fd, 1);
+  801c1d:	83 ec 08             	sub    $0x8,%esp
+  801c20:	6a 01                	push   $0x1
+  801c22:	ff 75 f4             	push   -0xc(%ebp)
+  801c25:	e8 51 ff ff ff       	call   801b7b <fd_close>
+  801c2a:	83 c4 10             	add    $0x10,%esp
+  801c2d:	eb ec                	jmp    801c1b <close+0x19>
+
+00801c2f <close_all>:
+
+void
+close_all(void)
+{
+  801c2f:	55                   	push   %ebp
+  801c30:	89 e5                	mov    %esp,%ebp
+  801c32:	53                   	push   %ebx
+  801c33:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801c36:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801c3b:	83 ec 0c             	sub    $0xc,%esp
+  801c3e:	53                   	push   %ebx
+  801c3f:	e8 be ff ff ff       	call   801c02 <close>
+	for (i = 0; i < MAXFD; i++)
+  801c44:	83 c3 01             	add    $0x1,%ebx
+  801c47:	83 c4 10             	add    $0x10,%esp
+  801c4a:	83 fb 20             	cmp    $0x20,%ebx
+  801c4d:	75 ec                	jne    801c3b <close_all+0xc>
+}
+  801c4f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c52:	c9                   	leave
+  801c53:	c3                   	ret
+
+00801c54 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801c54:	55                   	push   %ebp
+  801c55:	89 e5                	mov    %esp,%ebp
+  801c57:	57                   	push   %edi
+  801c58:	56                   	push   %esi
+  801c59:	53                   	push   %ebx
+  801c5a:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801c5d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801c60:	50                   	push   %eax
+  801c61:	ff 75 08             	push   0x8(%ebp)
+  801c64:	e8 45 fe ff ff       	call   801aae <fd_lookup>
+  801c69:	89 c3                	mov    %eax,%ebx
+  801c6b:	83 c4 10             	add    $0x10,%esp
+  801c6e:	85 c0                	test   %eax,%eax
+  801c70:	78 7f                	js     801cf1 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801c72:	83 ec 0c             	sub    $0xc,%esp
+  801c75:	ff 75 0c             	push   0xc(%ebp)
+  801c78:	e8 85 ff ff ff       	call   801c02 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801c7d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801c80:	c1 e6 0c             	shl    $0xc,%esi
+  801c83:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801c89:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801c8c:	89 3c 24             	mov    %edi,(%esp)
+  801c8f:	e8 ad fd ff ff       	call   801a41 <fd2data>
+  801c94:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801c96:	89 34 24             	mov    %esi,(%esp)
+  801c99:	e8 a3 fd ff ff       	call   801a41 <fd2data>
+  801c9e:	83 c4 10             	add    $0x10,%esp
+  801ca1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801ca4:	89 d8                	mov    %ebx,%eax
+  801ca6:	c1 e8 16             	shr    $0x16,%eax
+  801ca9:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801cb0:	a8 01                	test   $0x1,%al
+  801cb2:	74 11                	je     801cc5 <dup+0x71>
+  801cb4:	89 d8                	mov    %ebx,%eax
+  801cb6:	c1 e8 0c             	shr    $0xc,%eax
+  801cb9:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801cc0:	f6 c2 01             	test   $0x1,%dl
+  801cc3:	75 36                	jne    801cfb <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801cc5:	89 f8                	mov    %edi,%eax
+  801cc7:	c1 e8 0c             	shr    $0xc,%eax
+  801cca:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801cd1:	83 ec 0c             	sub    $0xc,%esp
+  801cd4:	25 07 0e 00 00       	and    $0xe07,%eax
+  801cd9:	50                   	push   %eax
+  801cda:	56                   	push   %esi
+  801cdb:	6a 00                	push   $0x0
+  801cdd:	57                   	push   %edi
+  801cde:	6a 00                	push   $0x0
+  801ce0:	e8 f6 f0 ff ff       	call   800ddb <sys_page_map>
+  801ce5:	89 c3                	mov    %eax,%ebx
+  801ce7:	83 c4 20             	add    $0x20,%esp
+  801cea:	85 c0                	test   %eax,%eax
+  801cec:	78 33                	js     801d21 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801cee:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801cf1:	89 d8                	mov    %ebx,%eax
+  801cf3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cf6:	5b                   	pop    %ebx
+  801cf7:	5e                   	pop    %esi
+  801cf8:	5f                   	pop    %edi
+  801cf9:	5d                   	pop    %ebp
+  801cfa:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801cfb:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801d02:	83 ec 0c             	sub    $0xc,%esp
+  801d05:	25 07 0e 00 00       	and    $0xe07,%eax
+  801d0a:	50                   	push   %eax
+  801d0b:	ff 75 d4             	push   -0x2c(%ebp)
+  801d0e:	6a 00                	push   $0x0
+  801d10:	53                   	push   %ebx
+  801d11:	6a 00                	push   $0x0
+  801d13:	e8 c3 f0 ff ff       	call   800ddb <sys_page_map>
+  801d18:	89 c3                	mov    %eax,%ebx
+  801d1a:	83 c4 20             	add    $0x20,%esp
+  801d1d:	85 c0                	test   %eax,%eax
+  801d1f:	79 a4                	jns    801cc5 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801d21:	83 ec 08             	sub    $0x8,%esp
+  801d24:	56                   	push   %esi
+  801d25:	6a 00                	push   $0x0
+  801d27:	e8 fb f0 ff ff       	call   800e27 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801d2c:	83 c4 08             	add    $0x8,%esp
+  801d2f:	ff 75 d4             	push   -0x2c(%ebp)
+  801d32:	6a 00                	push   $0x0
+  801d34:	e8 ee f0 ff ff       	call   800e27 <sys_page_unmap>
+	return r;
+  801d39:	83 c4 10             	add    $0x10,%esp
+  801d3c:	eb b3                	jmp    801cf1 <dup+0x9d>
+
+00801d3e <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801d3e:	55                   	push   %ebp
+  801d3f:	89 e5                	mov    %esp,%ebp
+  801d41:	56                   	push   %esi
+  801d42:	53                   	push   %ebx
+  801d43:	83 ec 18             	sub    $0x18,%esp
+  801d46:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d49:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d4c:	50                   	push   %eax
+  801d4d:	53                   	push   %ebx
+  801d4e:	e8 5b fd ff ff       	call   801aae <fd_lookup>
+  801d53:	83 c4 10             	add    $0x10,%esp
+  801d56:	85 c0                	test   %eax,%eax
+  801d58:	78 3c                	js     801d96 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d5a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d5d:	83 ec 08             	sub    $0x8,%esp
+  801d60:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d63:	50                   	push   %eax
+  801d64:	ff 36                	push   (%esi)
+  801d66:	e8 93 fd ff ff       	call   801afe <dev_lookup>
+  801d6b:	83 c4 10             	add    $0x10,%esp
+  801d6e:	85 c0                	test   %eax,%eax
+  801d70:	78 24                	js     801d96 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801d72:	8b 46 08             	mov    0x8(%esi),%eax
+  801d75:	83 e0 03             	and    $0x3,%eax
+  801d78:	83 f8 01             	cmp    $0x1,%eax
+  801d7b:	74 20                	je     801d9d <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801d7d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d80:	8b 40 08             	mov    0x8(%eax),%eax
+  801d83:	85 c0                	test   %eax,%eax
+  801d85:	74 61                	je     801de8 <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801d87:	83 ec 04             	sub    $0x4,%esp
+  801d8a:	ff 75 10             	push   0x10(%ebp)
+  801d8d:	ff 75 0c             	push   0xc(%ebp)
+  801d90:	56                   	push   %esi
+  801d91:	ff d0                	call   *%eax
+  801d93:	83 c4 10             	add    $0x10,%esp
+}
+  801d96:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d99:	5b                   	pop    %ebx
+  801d9a:	5e                   	pop    %esi
+  801d9b:	5d                   	pop    %ebp
+  801d9c:	c3                   	ret
+  801d9d:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801d9f:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801da5:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801daa:	77 18                	ja     801dc4 <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801dac:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801db1:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801db3:	c1 e8 10             	shr    $0x10,%eax
+  801db6:	74 0c                	je     801dc4 <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801db8:	c1 e0 10             	shl    $0x10,%eax
+  801dbb:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801dc0:	29 c2                	sub    %eax,%edx
+  801dc2:	eb 06                	jmp    801dca <read+0x8c>
+		return pthread_main_tls;
+  801dc4:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801dca:	8b 02                	mov    (%edx),%eax
+  801dcc:	8b 40 48             	mov    0x48(%eax),%eax
+  801dcf:	83 ec 04             	sub    $0x4,%esp
+  801dd2:	53                   	push   %ebx
+  801dd3:	50                   	push   %eax
+  801dd4:	68 79 4f 80 00       	push   $0x804f79
+  801dd9:	e8 8e e5 ff ff       	call   80036c <cprintf>
+		return -E_INVAL;
+  801dde:	83 c4 10             	add    $0x10,%esp
+  801de1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801de6:	eb ae                	jmp    801d96 <read+0x58>
+		return -E_NOT_SUPP;
+  801de8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ded:	eb a7                	jmp    801d96 <read+0x58>
+
+00801def <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801def:	55                   	push   %ebp
+  801df0:	89 e5                	mov    %esp,%ebp
+  801df2:	57                   	push   %edi
+  801df3:	56                   	push   %esi
+  801df4:	53                   	push   %ebx
+  801df5:	83 ec 0c             	sub    $0xc,%esp
+  801df8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801dfb:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801dfe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e03:	eb 02                	jmp    801e07 <readn+0x18>
+  801e05:	01 c3                	add    %eax,%ebx
+  801e07:	39 f3                	cmp    %esi,%ebx
+  801e09:	73 21                	jae    801e2c <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801e0b:	83 ec 04             	sub    $0x4,%esp
+  801e0e:	89 f0                	mov    %esi,%eax
+  801e10:	29 d8                	sub    %ebx,%eax
+  801e12:	50                   	push   %eax
+  801e13:	89 d8                	mov    %ebx,%eax
+  801e15:	03 45 0c             	add    0xc(%ebp),%eax
+  801e18:	50                   	push   %eax
+  801e19:	57                   	push   %edi
+  801e1a:	e8 1f ff ff ff       	call   801d3e <read>
+		if (m < 0)
+  801e1f:	83 c4 10             	add    $0x10,%esp
+  801e22:	85 c0                	test   %eax,%eax
+  801e24:	78 04                	js     801e2a <readn+0x3b>
+			return m;
+		if (m == 0)
+  801e26:	75 dd                	jne    801e05 <readn+0x16>
+  801e28:	eb 02                	jmp    801e2c <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801e2a:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801e2c:	89 d8                	mov    %ebx,%eax
+  801e2e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e31:	5b                   	pop    %ebx
+  801e32:	5e                   	pop    %esi
+  801e33:	5f                   	pop    %edi
+  801e34:	5d                   	pop    %ebp
+  801e35:	c3                   	ret
+
+00801e36 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801e36:	55                   	push   %ebp
+  801e37:	89 e5                	mov    %esp,%ebp
+  801e39:	56                   	push   %esi
+  801e3a:	53                   	push   %ebx
+  801e3b:	83 ec 18             	sub    $0x18,%esp
+  801e3e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801e41:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e44:	50                   	push   %eax
+  801e45:	53                   	push   %ebx
+  801e46:	e8 63 fc ff ff       	call   801aae <fd_lookup>
+  801e4b:	83 c4 10             	add    $0x10,%esp
+  801e4e:	85 c0                	test   %eax,%eax
+  801e50:	78 37                	js     801e89 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801e52:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e55:	83 ec 08             	sub    $0x8,%esp
+  801e58:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e5b:	50                   	push   %eax
+  801e5c:	ff 36                	push   (%esi)
+  801e5e:	e8 9b fc ff ff       	call   801afe <dev_lookup>
+  801e63:	83 c4 10             	add    $0x10,%esp
+  801e66:	85 c0                	test   %eax,%eax
+  801e68:	78 1f                	js     801e89 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e6a:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801e6e:	74 20                	je     801e90 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801e70:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e73:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e76:	85 c0                	test   %eax,%eax
+  801e78:	74 61                	je     801edb <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801e7a:	83 ec 04             	sub    $0x4,%esp
+  801e7d:	ff 75 10             	push   0x10(%ebp)
+  801e80:	ff 75 0c             	push   0xc(%ebp)
+  801e83:	56                   	push   %esi
+  801e84:	ff d0                	call   *%eax
+  801e86:	83 c4 10             	add    $0x10,%esp
+}
+  801e89:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e8c:	5b                   	pop    %ebx
+  801e8d:	5e                   	pop    %esi
+  801e8e:	5d                   	pop    %ebp
+  801e8f:	c3                   	ret
+  801e90:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801e92:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801e98:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801e9d:	77 18                	ja     801eb7 <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801e9f:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801ea4:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801ea6:	c1 e8 10             	shr    $0x10,%eax
+  801ea9:	74 0c                	je     801eb7 <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801eab:	c1 e0 10             	shl    $0x10,%eax
+  801eae:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801eb3:	29 c2                	sub    %eax,%edx
+  801eb5:	eb 06                	jmp    801ebd <write+0x87>
+		return pthread_main_tls;
+  801eb7:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801ebd:	8b 02                	mov    (%edx),%eax
+  801ebf:	8b 40 48             	mov    0x48(%eax),%eax
+  801ec2:	83 ec 04             	sub    $0x4,%esp
+  801ec5:	53                   	push   %ebx
+  801ec6:	50                   	push   %eax
+  801ec7:	68 95 4f 80 00       	push   $0x804f95
+  801ecc:	e8 9b e4 ff ff       	call   80036c <cprintf>
+		return -E_INVAL;
+  801ed1:	83 c4 10             	add    $0x10,%esp
+  801ed4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ed9:	eb ae                	jmp    801e89 <write+0x53>
+		return -E_NOT_SUPP;
+  801edb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ee0:	eb a7                	jmp    801e89 <write+0x53>
+
+00801ee2 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801ee2:	55                   	push   %ebp
+  801ee3:	89 e5                	mov    %esp,%ebp
+  801ee5:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801ee8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801eeb:	50                   	push   %eax
+  801eec:	ff 75 08             	push   0x8(%ebp)
+  801eef:	e8 ba fb ff ff       	call   801aae <fd_lookup>
+  801ef4:	83 c4 10             	add    $0x10,%esp
+  801ef7:	85 c0                	test   %eax,%eax
+  801ef9:	78 0e                	js     801f09 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801efb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801efe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f01:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801f04:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f09:	c9                   	leave
+  801f0a:	c3                   	ret
+
+00801f0b <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801f0b:	55                   	push   %ebp
+  801f0c:	89 e5                	mov    %esp,%ebp
+  801f0e:	56                   	push   %esi
+  801f0f:	53                   	push   %ebx
+  801f10:	83 ec 18             	sub    $0x18,%esp
+  801f13:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801f16:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f19:	50                   	push   %eax
+  801f1a:	53                   	push   %ebx
+  801f1b:	e8 8e fb ff ff       	call   801aae <fd_lookup>
+  801f20:	83 c4 10             	add    $0x10,%esp
+  801f23:	85 c0                	test   %eax,%eax
+  801f25:	78 34                	js     801f5b <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801f27:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801f2a:	83 ec 08             	sub    $0x8,%esp
+  801f2d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f30:	50                   	push   %eax
+  801f31:	ff 36                	push   (%esi)
+  801f33:	e8 c6 fb ff ff       	call   801afe <dev_lookup>
+  801f38:	83 c4 10             	add    $0x10,%esp
+  801f3b:	85 c0                	test   %eax,%eax
+  801f3d:	78 1c                	js     801f5b <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f3f:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801f43:	74 1d                	je     801f62 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801f45:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f48:	8b 40 18             	mov    0x18(%eax),%eax
+  801f4b:	85 c0                	test   %eax,%eax
+  801f4d:	74 5e                	je     801fad <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801f4f:	83 ec 08             	sub    $0x8,%esp
+  801f52:	ff 75 0c             	push   0xc(%ebp)
+  801f55:	56                   	push   %esi
+  801f56:	ff d0                	call   *%eax
+  801f58:	83 c4 10             	add    $0x10,%esp
+}
+  801f5b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f5e:	5b                   	pop    %ebx
+  801f5f:	5e                   	pop    %esi
+  801f60:	5d                   	pop    %ebp
+  801f61:	c3                   	ret
+  801f62:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801f64:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801f6a:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801f6f:	77 18                	ja     801f89 <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801f71:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801f76:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801f78:	c1 e8 10             	shr    $0x10,%eax
+  801f7b:	74 0c                	je     801f89 <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801f7d:	c1 e0 10             	shl    $0x10,%eax
+  801f80:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801f85:	29 c2                	sub    %eax,%edx
+  801f87:	eb 06                	jmp    801f8f <ftruncate+0x84>
+		return pthread_main_tls;
+  801f89:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+			thisenv->env_id, fdnum);
+  801f8f:	8b 02                	mov    (%edx),%eax
+  801f91:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801f94:	83 ec 04             	sub    $0x4,%esp
+  801f97:	53                   	push   %ebx
+  801f98:	50                   	push   %eax
+  801f99:	68 58 4f 80 00       	push   $0x804f58
+  801f9e:	e8 c9 e3 ff ff       	call   80036c <cprintf>
+		return -E_INVAL;
+  801fa3:	83 c4 10             	add    $0x10,%esp
+  801fa6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fab:	eb ae                	jmp    801f5b <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801fad:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801fb2:	eb a7                	jmp    801f5b <ftruncate+0x50>
+
+00801fb4 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801fb4:	55                   	push   %ebp
+  801fb5:	89 e5                	mov    %esp,%ebp
+  801fb7:	56                   	push   %esi
+  801fb8:	53                   	push   %ebx
+  801fb9:	83 ec 18             	sub    $0x18,%esp
+  801fbc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801fbf:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801fc2:	50                   	push   %eax
+  801fc3:	ff 75 08             	push   0x8(%ebp)
+  801fc6:	e8 e3 fa ff ff       	call   801aae <fd_lookup>
+  801fcb:	83 c4 10             	add    $0x10,%esp
+  801fce:	85 c0                	test   %eax,%eax
+  801fd0:	78 49                	js     80201b <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801fd2:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801fd5:	83 ec 08             	sub    $0x8,%esp
+  801fd8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fdb:	50                   	push   %eax
+  801fdc:	ff 36                	push   (%esi)
+  801fde:	e8 1b fb ff ff       	call   801afe <dev_lookup>
+  801fe3:	83 c4 10             	add    $0x10,%esp
+  801fe6:	85 c0                	test   %eax,%eax
+  801fe8:	78 31                	js     80201b <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801fea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801fed:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801ff1:	74 2f                	je     802022 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801ff3:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801ff6:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801ffd:	00 00 00 
+	stat->st_isdir = 0;
+  802000:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802007:	00 00 00 
+	stat->st_dev = dev;
+  80200a:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  802010:	83 ec 08             	sub    $0x8,%esp
+  802013:	53                   	push   %ebx
+  802014:	56                   	push   %esi
+  802015:	ff 50 14             	call   *0x14(%eax)
+  802018:	83 c4 10             	add    $0x10,%esp
+}
+  80201b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80201e:	5b                   	pop    %ebx
+  80201f:	5e                   	pop    %esi
+  802020:	5d                   	pop    %ebp
+  802021:	c3                   	ret
+		return -E_NOT_SUPP;
+  802022:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802027:	eb f2                	jmp    80201b <fstat+0x67>
+
+00802029 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  802029:	55                   	push   %ebp
+  80202a:	89 e5                	mov    %esp,%ebp
+  80202c:	56                   	push   %esi
+  80202d:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80202e:	83 ec 08             	sub    $0x8,%esp
+  802031:	6a 00                	push   $0x0
+  802033:	ff 75 08             	push   0x8(%ebp)
+  802036:	e8 4b 03 00 00       	call   802386 <open>
+  80203b:	89 c3                	mov    %eax,%ebx
+  80203d:	83 c4 10             	add    $0x10,%esp
+  802040:	85 c0                	test   %eax,%eax
+  802042:	78 1b                	js     80205f <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  802044:	83 ec 08             	sub    $0x8,%esp
+  802047:	ff 75 0c             	push   0xc(%ebp)
+  80204a:	50                   	push   %eax
+  80204b:	e8 64 ff ff ff       	call   801fb4 <fstat>
+  802050:	89 c6                	mov    %eax,%esi
+	close(fd);
+  802052:	89 1c 24             	mov    %ebx,(%esp)
+  802055:	e8 a8 fb ff ff       	call   801c02 <close>
+	return r;
+  80205a:	83 c4 10             	add    $0x10,%esp
+  80205d:	89 f3                	mov    %esi,%ebx
+}
+  80205f:	89 d8                	mov    %ebx,%eax
+  802061:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802064:	5b                   	pop    %ebx
+  802065:	5e                   	pop    %esi
+  802066:	5d                   	pop    %ebp
+  802067:	c3                   	ret
+
+00802068 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  802068:	55                   	push   %ebp
+  802069:	89 e5                	mov    %esp,%ebp
+  80206b:	56                   	push   %esi
+  80206c:	53                   	push   %ebx
+  80206d:	89 c6                	mov    %eax,%esi
+  80206f:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  802071:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  802078:	74 27                	je     8020a1 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80207a:	6a 07                	push   $0x7
+  80207c:	68 00 80 80 00       	push   $0x808000
+  802081:	56                   	push   %esi
+  802082:	ff 35 00 70 80 00    	push   0x807000
+  802088:	e8 0f f9 ff ff       	call   80199c <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  80208d:	83 c4 0c             	add    $0xc,%esp
+  802090:	6a 00                	push   $0x0
+  802092:	53                   	push   %ebx
+  802093:	6a 00                	push   $0x0
+  802095:	e8 0c f8 ff ff       	call   8018a6 <ipc_recv>
+}
+  80209a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80209d:	5b                   	pop    %ebx
+  80209e:	5e                   	pop    %esi
+  80209f:	5d                   	pop    %ebp
+  8020a0:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8020a1:	83 ec 0c             	sub    $0xc,%esp
+  8020a4:	6a 01                	push   $0x1
+  8020a6:	e8 47 f9 ff ff       	call   8019f2 <ipc_find_env>
+  8020ab:	a3 00 70 80 00       	mov    %eax,0x807000
+  8020b0:	83 c4 10             	add    $0x10,%esp
+  8020b3:	eb c5                	jmp    80207a <fsipc+0x12>
+
+008020b5 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8020b5:	55                   	push   %ebp
+  8020b6:	89 e5                	mov    %esp,%ebp
+  8020b8:	53                   	push   %ebx
+  8020b9:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  8020bc:	68 04 70 80 00       	push   $0x807004
+  8020c1:	e8 65 1b 00 00       	call   803c2b <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8020c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020c9:	8b 40 0c             	mov    0xc(%eax),%eax
+  8020cc:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.set_size.req_size = newsize;
+  8020d1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020d4:	a3 04 80 80 00       	mov    %eax,0x808004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  8020d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020de:	b8 02 00 00 00       	mov    $0x2,%eax
+  8020e3:	e8 80 ff ff ff       	call   802068 <fsipc>
+  8020e8:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8020ea:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  8020f1:	e8 a2 1b 00 00       	call   803c98 <mutex_unlock>
+	return r;
+}
+  8020f6:	89 d8                	mov    %ebx,%eax
+  8020f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020fb:	c9                   	leave
+  8020fc:	c3                   	ret
+
+008020fd <devfile_flush>:
+{
+  8020fd:	55                   	push   %ebp
+  8020fe:	89 e5                	mov    %esp,%ebp
+  802100:	53                   	push   %ebx
+  802101:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  802104:	68 04 70 80 00       	push   $0x807004
+  802109:	e8 1d 1b 00 00       	call   803c2b <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80210e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802111:	8b 40 0c             	mov    0xc(%eax),%eax
+  802114:	a3 00 80 80 00       	mov    %eax,0x808000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  802119:	ba 00 00 00 00       	mov    $0x0,%edx
+  80211e:	b8 06 00 00 00       	mov    $0x6,%eax
+  802123:	e8 40 ff ff ff       	call   802068 <fsipc>
+  802128:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80212a:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  802131:	e8 62 1b 00 00       	call   803c98 <mutex_unlock>
+}
+  802136:	89 d8                	mov    %ebx,%eax
+  802138:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80213b:	c9                   	leave
+  80213c:	c3                   	ret
+
+0080213d <devfile_stat>:
+{
+  80213d:	55                   	push   %ebp
+  80213e:	89 e5                	mov    %esp,%ebp
+  802140:	56                   	push   %esi
+  802141:	53                   	push   %ebx
+  802142:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  802145:	83 ec 0c             	sub    $0xc,%esp
+  802148:	68 04 70 80 00       	push   $0x807004
+  80214d:	e8 d9 1a 00 00       	call   803c2b <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802152:	8b 45 08             	mov    0x8(%ebp),%eax
+  802155:	8b 40 0c             	mov    0xc(%eax),%eax
+  802158:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  80215d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802162:	b8 05 00 00 00       	mov    $0x5,%eax
+  802167:	e8 fc fe ff ff       	call   802068 <fsipc>
+  80216c:	89 c3                	mov    %eax,%ebx
+  80216e:	83 c4 10             	add    $0x10,%esp
+  802171:	85 c0                	test   %eax,%eax
+  802173:	79 16                	jns    80218b <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  802175:	83 ec 0c             	sub    $0xc,%esp
+  802178:	68 04 70 80 00       	push   $0x807004
+  80217d:	e8 16 1b 00 00       	call   803c98 <mutex_unlock>
+}
+  802182:	89 d8                	mov    %ebx,%eax
+  802184:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802187:	5b                   	pop    %ebx
+  802188:	5e                   	pop    %esi
+  802189:	5d                   	pop    %ebp
+  80218a:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80218b:	83 ec 08             	sub    $0x8,%esp
+  80218e:	68 00 80 80 00       	push   $0x808000
+  802193:	56                   	push   %esi
+  802194:	e8 b7 e7 ff ff       	call   800950 <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  802199:	a1 80 80 80 00       	mov    0x808080,%eax
+  80219e:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8021a4:	a1 84 80 80 00       	mov    0x808084,%eax
+  8021a9:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  8021af:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  8021b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8021b7:	eb bc                	jmp    802175 <devfile_stat+0x38>
+
+008021b9 <devfile_write>:
+{
+  8021b9:	55                   	push   %ebp
+  8021ba:	89 e5                	mov    %esp,%ebp
+  8021bc:	53                   	push   %ebx
+  8021bd:	83 ec 10             	sub    $0x10,%esp
+  8021c0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  8021c3:	68 04 70 80 00       	push   $0x807004
+  8021c8:	e8 5e 1a 00 00       	call   803c2b <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8021cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021d0:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021d3:	a3 00 80 80 00       	mov    %eax,0x808000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  8021d8:	83 c4 10             	add    $0x10,%esp
+  8021db:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  8021e1:	76 3d                	jbe    802220 <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  8021e3:	b8 00 00 10 00       	mov    $0x100000,%eax
+  8021e8:	39 c3                	cmp    %eax,%ebx
+  8021ea:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  8021ed:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021f0:	a3 08 80 80 00       	mov    %eax,0x808008
+	fsipcbuf.write.req_n = n;
+  8021f5:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	r = fsipc(FSREQ_WRITE, NULL);
+  8021fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  802200:	b8 04 00 00 00       	mov    $0x4,%eax
+  802205:	e8 5e fe ff ff       	call   802068 <fsipc>
+  80220a:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80220c:	83 ec 0c             	sub    $0xc,%esp
+  80220f:	68 04 70 80 00       	push   $0x807004
+  802214:	e8 7f 1a 00 00       	call   803c98 <mutex_unlock>
+}
+  802219:	89 d8                	mov    %ebx,%eax
+  80221b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80221e:	c9                   	leave
+  80221f:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  802220:	83 ec 04             	sub    $0x4,%esp
+  802223:	53                   	push   %ebx
+  802224:	ff 75 0c             	push   0xc(%ebp)
+  802227:	68 0c 80 80 00       	push   $0x80800c
+  80222c:	e8 a5 e8 ff ff       	call   800ad6 <memmove>
+  802231:	83 c4 10             	add    $0x10,%esp
+  802234:	b8 00 00 00 00       	mov    $0x0,%eax
+  802239:	eb b5                	jmp    8021f0 <devfile_write+0x37>
+
+0080223b <devfile_read>:
+{
+  80223b:	55                   	push   %ebp
+  80223c:	89 e5                	mov    %esp,%ebp
+  80223e:	57                   	push   %edi
+  80223f:	56                   	push   %esi
+  802240:	53                   	push   %ebx
+  802241:	83 ec 0c             	sub    $0xc,%esp
+  802244:	8b 75 08             	mov    0x8(%ebp),%esi
+  802247:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80224a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  80224d:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  802253:	0f 86 8c 00 00 00    	jbe    8022e5 <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  802259:	b8 00 00 10 00       	mov    $0x100000,%eax
+  80225e:	39 c3                	cmp    %eax,%ebx
+  802260:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  802263:	89 f8                	mov    %edi,%eax
+  802265:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  802268:	eb 0f                	jmp    802279 <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  80226a:	0f b6 08             	movzbl (%eax),%ecx
+  80226d:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  80226f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802274:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  802279:	39 d0                	cmp    %edx,%eax
+  80227b:	72 ed                	jb     80226a <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  80227d:	83 ec 0c             	sub    $0xc,%esp
+  802280:	68 04 70 80 00       	push   $0x807004
+  802285:	e8 a1 19 00 00       	call   803c2b <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80228a:	8b 46 0c             	mov    0xc(%esi),%eax
+  80228d:	a3 00 80 80 00       	mov    %eax,0x808000
+		fsipcbuf.read.req_n = n;
+  802292:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  802298:	89 3d 08 80 80 00    	mov    %edi,0x808008
+		r = fsipc(FSREQ_READ, NULL);
+  80229e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022a3:	b8 03 00 00 00       	mov    $0x3,%eax
+  8022a8:	e8 bb fd ff ff       	call   802068 <fsipc>
+  8022ad:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  8022af:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  8022b6:	e8 dd 19 00 00       	call   803c98 <mutex_unlock>
+		assert(r <= (int) n);
+  8022bb:	83 c4 10             	add    $0x10,%esp
+  8022be:	39 f3                	cmp    %esi,%ebx
+  8022c0:	7c 0a                	jl     8022cc <devfile_read+0x91>
+}
+  8022c2:	89 f0                	mov    %esi,%eax
+  8022c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022c7:	5b                   	pop    %ebx
+  8022c8:	5e                   	pop    %esi
+  8022c9:	5f                   	pop    %edi
+  8022ca:	5d                   	pop    %ebp
+  8022cb:	c3                   	ret
+		assert(r <= (int) n);
+  8022cc:	68 c8 4f 80 00       	push   $0x804fc8
+  8022d1:	68 b1 4e 80 00       	push   $0x804eb1
+  8022d6:	68 90 00 00 00       	push   $0x90
+  8022db:	68 d5 4f 80 00       	push   $0x804fd5
+  8022e0:	e8 ac df ff ff       	call   800291 <_panic>
+	mutex_lock(&fsipc_mu);
+  8022e5:	83 ec 0c             	sub    $0xc,%esp
+  8022e8:	68 04 70 80 00       	push   $0x807004
+  8022ed:	e8 39 19 00 00       	call   803c2b <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8022f2:	8b 46 0c             	mov    0xc(%esi),%eax
+  8022f5:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.read.req_n = n;
+  8022fa:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	fsipcbuf.read.req_va = 0;
+  802300:	c7 05 08 80 80 00 00 	movl   $0x0,0x808008
+  802307:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  80230a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80230f:	b8 03 00 00 00       	mov    $0x3,%eax
+  802314:	e8 4f fd ff ff       	call   802068 <fsipc>
+  802319:	89 c6                	mov    %eax,%esi
+  80231b:	83 c4 10             	add    $0x10,%esp
+  80231e:	85 c0                	test   %eax,%eax
+  802320:	78 1d                	js     80233f <devfile_read+0x104>
+		assert(r <= n);
+  802322:	39 c3                	cmp    %eax,%ebx
+  802324:	72 2e                	jb     802354 <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  802326:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80232b:	7f 40                	jg     80236d <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80232d:	83 ec 04             	sub    $0x4,%esp
+  802330:	50                   	push   %eax
+  802331:	68 00 80 80 00       	push   $0x808000
+  802336:	57                   	push   %edi
+  802337:	e8 9a e7 ff ff       	call   800ad6 <memmove>
+  80233c:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  80233f:	83 ec 0c             	sub    $0xc,%esp
+  802342:	68 04 70 80 00       	push   $0x807004
+  802347:	e8 4c 19 00 00       	call   803c98 <mutex_unlock>
+	return r;
+  80234c:	83 c4 10             	add    $0x10,%esp
+  80234f:	e9 6e ff ff ff       	jmp    8022c2 <devfile_read+0x87>
+		assert(r <= n);
+  802354:	68 e0 4f 80 00       	push   $0x804fe0
+  802359:	68 b1 4e 80 00       	push   $0x804eb1
+  80235e:	68 99 00 00 00       	push   $0x99
+  802363:	68 d5 4f 80 00       	push   $0x804fd5
+  802368:	e8 24 df ff ff       	call   800291 <_panic>
+		assert(r <= PGSIZE);
+  80236d:	68 e7 4f 80 00       	push   $0x804fe7
+  802372:	68 b1 4e 80 00       	push   $0x804eb1
+  802377:	68 9a 00 00 00       	push   $0x9a
+  80237c:	68 d5 4f 80 00       	push   $0x804fd5
+  802381:	e8 0b df ff ff       	call   800291 <_panic>
+
+00802386 <open>:
+{
+  802386:	55                   	push   %ebp
+  802387:	89 e5                	mov    %esp,%ebp
+  802389:	56                   	push   %esi
+  80238a:	53                   	push   %ebx
+  80238b:	83 ec 1c             	sub    $0x1c,%esp
+  80238e:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802391:	56                   	push   %esi
+  802392:	e8 7e e5 ff ff       	call   800915 <strlen>
+  802397:	83 c4 10             	add    $0x10,%esp
+  80239a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80239f:	0f 8f 85 00 00 00    	jg     80242a <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  8023a5:	83 ec 0c             	sub    $0xc,%esp
+  8023a8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023ab:	50                   	push   %eax
+  8023ac:	e8 a7 f6 ff ff       	call   801a58 <fd_alloc>
+  8023b1:	89 c3                	mov    %eax,%ebx
+  8023b3:	83 c4 10             	add    $0x10,%esp
+  8023b6:	85 c0                	test   %eax,%eax
+  8023b8:	78 55                	js     80240f <open+0x89>
+	mutex_lock(&fsipc_mu);
+  8023ba:	83 ec 0c             	sub    $0xc,%esp
+  8023bd:	68 04 70 80 00       	push   $0x807004
+  8023c2:	e8 64 18 00 00       	call   803c2b <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  8023c7:	83 c4 08             	add    $0x8,%esp
+  8023ca:	56                   	push   %esi
+  8023cb:	68 00 80 80 00       	push   $0x808000
+  8023d0:	e8 7b e5 ff ff       	call   800950 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8023d5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023d8:	a3 00 84 80 00       	mov    %eax,0x808400
+	r = fsipc(FSREQ_OPEN, fd);
+  8023dd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8023e0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8023e5:	e8 7e fc ff ff       	call   802068 <fsipc>
+  8023ea:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8023ec:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  8023f3:	e8 a0 18 00 00       	call   803c98 <mutex_unlock>
+	if (r < 0) {
+  8023f8:	83 c4 10             	add    $0x10,%esp
+  8023fb:	85 db                	test   %ebx,%ebx
+  8023fd:	78 19                	js     802418 <open+0x92>
+	return fd2num(fd);
+  8023ff:	83 ec 0c             	sub    $0xc,%esp
+  802402:	ff 75 f4             	push   -0xc(%ebp)
+  802405:	e8 27 f6 ff ff       	call   801a31 <fd2num>
+  80240a:	89 c3                	mov    %eax,%ebx
+  80240c:	83 c4 10             	add    $0x10,%esp
+}
+  80240f:	89 d8                	mov    %ebx,%eax
+  802411:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802414:	5b                   	pop    %ebx
+  802415:	5e                   	pop    %esi
+  802416:	5d                   	pop    %ebp
+  802417:	c3                   	ret
+		fd_close(fd, 0);
+  802418:	83 ec 08             	sub    $0x8,%esp
+  80241b:	6a 00                	push   $0x0
+  80241d:	ff 75 f4             	push   -0xc(%ebp)
+  802420:	e8 56 f7 ff ff       	call   801b7b <fd_close>
+		return r;
+  802425:	83 c4 10             	add    $0x10,%esp
+  802428:	eb e5                	jmp    80240f <open+0x89>
+		return -E_BAD_PATH;
+  80242a:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80242f:	eb de                	jmp    80240f <open+0x89>
+
+00802431 <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  802431:	55                   	push   %ebp
+  802432:	89 e5                	mov    %esp,%ebp
+  802434:	53                   	push   %ebx
+  802435:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802438:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80243b:	50                   	push   %eax
+  80243c:	ff 75 08             	push   0x8(%ebp)
+  80243f:	e8 6a f6 ff ff       	call   801aae <fd_lookup>
+  802444:	89 c3                	mov    %eax,%ebx
+  802446:	83 c4 10             	add    $0x10,%esp
+  802449:	85 c0                	test   %eax,%eax
+  80244b:	78 5b                	js     8024a8 <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  80244d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802450:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  802456:	39 08                	cmp    %ecx,(%eax)
+  802458:	75 55                	jne    8024af <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  80245a:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  80245e:	74 56                	je     8024b6 <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  802460:	83 ec 0c             	sub    $0xc,%esp
+  802463:	68 04 70 80 00       	push   $0x807004
+  802468:	e8 be 17 00 00       	call   803c2b <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  80246d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802470:	8b 40 0c             	mov    0xc(%eax),%eax
+  802473:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.allocate.req_offset = offset;
+  802478:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80247b:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.allocate.req_len = len;
+  802480:	8b 45 10             	mov    0x10(%ebp),%eax
+  802483:	a3 08 80 80 00       	mov    %eax,0x808008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  802488:	ba 00 00 00 00       	mov    $0x0,%edx
+  80248d:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802492:	e8 d1 fb ff ff       	call   802068 <fsipc>
+  802497:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802499:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  8024a0:	e8 f3 17 00 00       	call   803c98 <mutex_unlock>
+	return r;
+  8024a5:	83 c4 10             	add    $0x10,%esp
+}
+  8024a8:	89 d8                	mov    %ebx,%eax
+  8024aa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024ad:	c9                   	leave
+  8024ae:	c3                   	ret
+		return -E_NOT_SUPP;
+  8024af:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8024b4:	eb f2                	jmp    8024a8 <fallocate+0x77>
+		return -E_INVAL;
+  8024b6:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8024bb:	eb eb                	jmp    8024a8 <fallocate+0x77>
+
+008024bd <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  8024bd:	55                   	push   %ebp
+  8024be:	89 e5                	mov    %esp,%ebp
+  8024c0:	56                   	push   %esi
+  8024c1:	53                   	push   %ebx
+  8024c2:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  8024c5:	89 f3                	mov    %esi,%ebx
+  8024c7:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  8024cd:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  8024d0:	eb 06                	jmp    8024d8 <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  8024d2:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8024d8:	39 f3                	cmp    %esi,%ebx
+  8024da:	73 14                	jae    8024f0 <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  8024dc:	83 ec 08             	sub    $0x8,%esp
+  8024df:	53                   	push   %ebx
+  8024e0:	6a 00                	push   $0x0
+  8024e2:	e8 40 e9 ff ff       	call   800e27 <sys_page_unmap>
+  8024e7:	83 c4 10             	add    $0x10,%esp
+  8024ea:	85 c0                	test   %eax,%eax
+  8024ec:	79 e4                	jns    8024d2 <munmap+0x15>
+  8024ee:	eb 05                	jmp    8024f5 <munmap+0x38>
+			return r;
+	return 0;
+  8024f0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024f5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024f8:	5b                   	pop    %ebx
+  8024f9:	5e                   	pop    %esi
+  8024fa:	5d                   	pop    %ebp
+  8024fb:	c3                   	ret
+
+008024fc <mmap>:
+{
+  8024fc:	55                   	push   %ebp
+  8024fd:	89 e5                	mov    %esp,%ebp
+  8024ff:	57                   	push   %edi
+  802500:	56                   	push   %esi
+  802501:	53                   	push   %ebx
+  802502:	83 ec 24             	sub    $0x24,%esp
+  802505:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802508:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80250b:	50                   	push   %eax
+  80250c:	ff 75 08             	push   0x8(%ebp)
+  80250f:	e8 9a f5 ff ff       	call   801aae <fd_lookup>
+  802514:	83 c4 10             	add    $0x10,%esp
+  802517:	85 c0                	test   %eax,%eax
+  802519:	0f 88 37 01 00 00    	js     802656 <mmap+0x15a>
+		return NULL;
+  80251f:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802524:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802527:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  80252d:	39 0a                	cmp    %ecx,(%edx)
+  80252f:	0f 85 05 01 00 00    	jne    80263a <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  802535:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  80253c:	0f 85 1b 01 00 00    	jne    80265d <mmap+0x161>
+  802542:	89 f0                	mov    %esi,%eax
+  802544:	83 e8 01             	sub    $0x1,%eax
+  802547:	0f 88 17 01 00 00    	js     802664 <mmap+0x168>
+	if (prot & PROT_WRITE)
+  80254d:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  802551:	75 28                	jne    80257b <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  802553:	83 ec 0c             	sub    $0xc,%esp
+  802556:	68 04 70 80 00       	push   $0x807004
+  80255b:	e8 cb 16 00 00       	call   803c2b <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  802560:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  802566:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  80256c:	83 c4 10             	add    $0x10,%esp
+  80256f:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  802574:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  802579:	eb 2b                	jmp    8025a6 <mmap+0xaa>
+		cow_enable();
+  80257b:	e8 b5 ee ff ff       	call   801435 <cow_enable>
+  802580:	eb d1                	jmp    802553 <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  802582:	89 c2                	mov    %eax,%edx
+  802584:	c1 ea 0c             	shr    $0xc,%edx
+  802587:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  80258e:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  802594:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  80259a:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  80259d:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  80259f:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  8025a4:	77 25                	ja     8025cb <mmap+0xcf>
+  8025a6:	89 c2                	mov    %eax,%edx
+  8025a8:	29 da                	sub    %ebx,%edx
+  8025aa:	39 ca                	cmp    %ecx,%edx
+  8025ac:	73 3a                	jae    8025e8 <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  8025ae:	89 c2                	mov    %eax,%edx
+  8025b0:	c1 ea 16             	shr    $0x16,%edx
+  8025b3:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8025ba:	f6 c2 01             	test   $0x1,%dl
+  8025bd:	75 c3                	jne    802582 <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  8025bf:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  8025c4:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  8025c9:	eb d4                	jmp    80259f <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  8025cb:	29 d8                	sub    %ebx,%eax
+  8025cd:	39 c8                	cmp    %ecx,%eax
+  8025cf:	73 17                	jae    8025e8 <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  8025d1:	83 ec 0c             	sub    $0xc,%esp
+  8025d4:	68 04 70 80 00       	push   $0x807004
+  8025d9:	e8 ba 16 00 00       	call   803c98 <mutex_unlock>
+		return NULL;
+  8025de:	83 c4 10             	add    $0x10,%esp
+  8025e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025e6:	eb 52                	jmp    80263a <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  8025e8:	85 db                	test   %ebx,%ebx
+  8025ea:	74 e5                	je     8025d1 <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8025ec:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8025ef:	8b 40 0c             	mov    0xc(%eax),%eax
+  8025f2:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.map.req_offset = offset;
+  8025f7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025fa:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.map.req_len = len;
+  8025ff:	89 35 08 80 80 00    	mov    %esi,0x808008
+	fsipcbuf.map.req_va = va;
+  802605:	89 1d 0c 80 80 00    	mov    %ebx,0x80800c
+	fsipcbuf.map.req_prot = prot;
+  80260b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80260e:	a3 10 80 80 00       	mov    %eax,0x808010
+	r = fsipc(FSREQ_MAP, NULL);
+  802613:	ba 00 00 00 00       	mov    $0x0,%edx
+  802618:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80261d:	e8 46 fa ff ff       	call   802068 <fsipc>
+  802622:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  802624:	83 ec 0c             	sub    $0xc,%esp
+  802627:	68 04 70 80 00       	push   $0x807004
+  80262c:	e8 67 16 00 00       	call   803c98 <mutex_unlock>
+	if (r < 0) {
+  802631:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  802634:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  802636:	85 ff                	test   %edi,%edi
+  802638:	78 08                	js     802642 <mmap+0x146>
+}
+  80263a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80263d:	5b                   	pop    %ebx
+  80263e:	5e                   	pop    %esi
+  80263f:	5f                   	pop    %edi
+  802640:	5d                   	pop    %ebp
+  802641:	c3                   	ret
+		munmap((void*) va, len);
+  802642:	83 ec 08             	sub    $0x8,%esp
+  802645:	56                   	push   %esi
+  802646:	53                   	push   %ebx
+  802647:	e8 71 fe ff ff       	call   8024bd <munmap>
+		return NULL;
+  80264c:	83 c4 10             	add    $0x10,%esp
+  80264f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802654:	eb e4                	jmp    80263a <mmap+0x13e>
+		return NULL;
+  802656:	b8 00 00 00 00       	mov    $0x0,%eax
+  80265b:	eb dd                	jmp    80263a <mmap+0x13e>
+		return NULL;
+  80265d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802662:	eb d6                	jmp    80263a <mmap+0x13e>
+  802664:	b8 00 00 00 00       	mov    $0x0,%eax
+  802669:	eb cf                	jmp    80263a <mmap+0x13e>
+
+0080266b <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  80266b:	55                   	push   %ebp
+  80266c:	89 e5                	mov    %esp,%ebp
+  80266e:	53                   	push   %ebx
+  80266f:	83 ec 10             	sub    $0x10,%esp
+  802672:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802675:	53                   	push   %ebx
+  802676:	e8 9a e2 ff ff       	call   800915 <strlen>
+  80267b:	83 c4 10             	add    $0x10,%esp
+  80267e:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802683:	7f 42                	jg     8026c7 <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  802685:	83 ec 0c             	sub    $0xc,%esp
+  802688:	68 04 70 80 00       	push   $0x807004
+  80268d:	e8 99 15 00 00       	call   803c2b <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  802692:	83 c4 08             	add    $0x8,%esp
+  802695:	53                   	push   %ebx
+  802696:	68 00 80 80 00       	push   $0x808000
+  80269b:	e8 b0 e2 ff ff       	call   800950 <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  8026a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026a5:	b8 07 00 00 00       	mov    $0x7,%eax
+  8026aa:	e8 b9 f9 ff ff       	call   802068 <fsipc>
+  8026af:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8026b1:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  8026b8:	e8 db 15 00 00       	call   803c98 <mutex_unlock>
+	return r;
+  8026bd:	83 c4 10             	add    $0x10,%esp
+}
+  8026c0:	89 d8                	mov    %ebx,%eax
+  8026c2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026c5:	c9                   	leave
+  8026c6:	c3                   	ret
+		return -E_BAD_PATH;
+  8026c7:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8026cc:	eb f2                	jmp    8026c0 <remove+0x55>
+
+008026ce <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8026ce:	55                   	push   %ebp
+  8026cf:	89 e5                	mov    %esp,%ebp
+  8026d1:	53                   	push   %ebx
+  8026d2:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  8026d5:	68 04 70 80 00       	push   $0x807004
+  8026da:	e8 4c 15 00 00       	call   803c2b <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  8026df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026e4:	b8 08 00 00 00       	mov    $0x8,%eax
+  8026e9:	e8 7a f9 ff ff       	call   802068 <fsipc>
+  8026ee:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8026f0:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  8026f7:	e8 9c 15 00 00       	call   803c98 <mutex_unlock>
+	return r;
+}
+  8026fc:	89 d8                	mov    %ebx,%eax
+  8026fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802701:	c9                   	leave
+  802702:	c3                   	ret
+
+00802703 <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  802703:	55                   	push   %ebp
+  802704:	89 e5                	mov    %esp,%ebp
+  802706:	56                   	push   %esi
+  802707:	53                   	push   %ebx
+  802708:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  80270b:	83 ec 0c             	sub    $0xc,%esp
+  80270e:	68 04 70 80 00       	push   $0x807004
+  802713:	e8 13 15 00 00       	call   803c2b <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  802718:	8b 45 08             	mov    0x8(%ebp),%eax
+  80271b:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  802720:	ba 00 00 00 00       	mov    $0x0,%edx
+  802725:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80272a:	e8 39 f9 ff ff       	call   802068 <fsipc>
+  80272f:	89 c6                	mov    %eax,%esi
+  802731:	83 c4 10             	add    $0x10,%esp
+  802734:	85 db                	test   %ebx,%ebx
+  802736:	74 7b                	je     8027b3 <fs_bcstat+0xb0>
+  802738:	85 c0                	test   %eax,%eax
+  80273a:	78 77                	js     8027b3 <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  80273c:	a1 00 80 80 00       	mov    0x808000,%eax
+  802741:	89 03                	mov    %eax,(%ebx)
+  802743:	a1 04 80 80 00       	mov    0x808004,%eax
+  802748:	89 43 04             	mov    %eax,0x4(%ebx)
+  80274b:	a1 08 80 80 00       	mov    0x808008,%eax
+  802750:	89 43 08             	mov    %eax,0x8(%ebx)
+  802753:	a1 0c 80 80 00       	mov    0x80800c,%eax
+  802758:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80275b:	a1 10 80 80 00       	mov    0x808010,%eax
+  802760:	89 43 10             	mov    %eax,0x10(%ebx)
+  802763:	a1 14 80 80 00       	mov    0x808014,%eax
+  802768:	89 43 14             	mov    %eax,0x14(%ebx)
+  80276b:	a1 18 80 80 00       	mov    0x808018,%eax
+  802770:	89 43 18             	mov    %eax,0x18(%ebx)
+  802773:	a1 1c 80 80 00       	mov    0x80801c,%eax
+  802778:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  80277b:	a1 20 80 80 00       	mov    0x808020,%eax
+  802780:	89 43 20             	mov    %eax,0x20(%ebx)
+  802783:	a1 24 80 80 00       	mov    0x808024,%eax
+  802788:	89 43 24             	mov    %eax,0x24(%ebx)
+  80278b:	a1 28 80 80 00       	mov    0x808028,%eax
+  802790:	89 43 28             	mov    %eax,0x28(%ebx)
+  802793:	a1 2c 80 80 00       	mov    0x80802c,%eax
+  802798:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  80279b:	a1 30 80 80 00       	mov    0x808030,%eax
+  8027a0:	89 43 30             	mov    %eax,0x30(%ebx)
+  8027a3:	a1 34 80 80 00       	mov    0x808034,%eax
+  8027a8:	89 43 34             	mov    %eax,0x34(%ebx)
+  8027ab:	a1 38 80 80 00       	mov    0x808038,%eax
+  8027b0:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  8027b3:	83 ec 0c             	sub    $0xc,%esp
+  8027b6:	68 04 70 80 00       	push   $0x807004
+  8027bb:	e8 d8 14 00 00       	call   803c98 <mutex_unlock>
+	return r;
+}
+  8027c0:	89 f0                	mov    %esi,%eax
+  8027c2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027c5:	5b                   	pop    %ebx
+  8027c6:	5e                   	pop    %esi
+  8027c7:	5d                   	pop    %ebp
+  8027c8:	c3                   	ret
+
+008027c9 <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  8027c9:	55                   	push   %ebp
+  8027ca:	89 e5                	mov    %esp,%ebp
+  8027cc:	56                   	push   %esi
+  8027cd:	53                   	push   %ebx
+  8027ce:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  8027d0:	0f b6 10             	movzbl (%eax),%edx
+  8027d3:	80 fa 72             	cmp    $0x72,%dl
+  8027d6:	74 44                	je     80281c <parse_mode+0x53>
+  8027d8:	80 fa 77             	cmp    $0x77,%dl
+  8027db:	74 4b                	je     802828 <parse_mode+0x5f>
+  8027dd:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8027e2:	80 fa 61             	cmp    $0x61,%dl
+  8027e5:	74 09                	je     8027f0 <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  8027e7:	89 d8                	mov    %ebx,%eax
+  8027e9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027ec:	5b                   	pop    %ebx
+  8027ed:	5e                   	pop    %esi
+  8027ee:	5d                   	pop    %ebp
+  8027ef:	c3                   	ret
+	switch (mode[0]) {
+  8027f0:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  8027f5:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  8027fa:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  8027fc:	83 ec 08             	sub    $0x8,%esp
+  8027ff:	6a 2b                	push   $0x2b
+  802801:	50                   	push   %eax
+  802802:	e8 5b e2 ff ff       	call   800a62 <strchr>
+  802807:	83 c4 10             	add    $0x10,%esp
+  80280a:	85 c0                	test   %eax,%eax
+  80280c:	74 d9                	je     8027e7 <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  80280e:	83 e3 fc             	and    $0xfffffffc,%ebx
+  802811:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  802814:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  80281a:	eb cb                	jmp    8027e7 <parse_mode+0x1e>
+	switch (mode[0]) {
+  80281c:	ba 01 00 00 00       	mov    $0x1,%edx
+  802821:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802826:	eb d2                	jmp    8027fa <parse_mode+0x31>
+  802828:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  80282d:	bb 01 03 00 00       	mov    $0x301,%ebx
+  802832:	eb c6                	jmp    8027fa <parse_mode+0x31>
+
+00802834 <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  802834:	55                   	push   %ebp
+  802835:	89 e5                	mov    %esp,%ebp
+  802837:	57                   	push   %edi
+  802838:	56                   	push   %esi
+  802839:	53                   	push   %ebx
+  80283a:	83 ec 1c             	sub    $0x1c,%esp
+  80283d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802840:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  802843:	b8 24 60 80 00       	mov    $0x806024,%eax
+  802848:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  80284d:	83 c0 24             	add    $0x24,%eax
+  802850:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  802854:	74 17                	je     80286d <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  802856:	83 c3 01             	add    $0x1,%ebx
+  802859:	83 fb 10             	cmp    $0x10,%ebx
+  80285c:	75 ef                	jne    80284d <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  80285e:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  802863:	89 f0                	mov    %esi,%eax
+  802865:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802868:	5b                   	pop    %ebx
+  802869:	5e                   	pop    %esi
+  80286a:	5f                   	pop    %edi
+  80286b:	5d                   	pop    %ebp
+  80286c:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  80286d:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  802874:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802877:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  80287a:	c1 e7 02             	shl    $0x2,%edi
+  80287d:	8d b7 20 60 80 00    	lea    0x806020(%edi),%esi
+  802883:	83 ec 04             	sub    $0x4,%esp
+  802886:	6a 24                	push   $0x24
+  802888:	6a 00                	push   $0x0
+  80288a:	56                   	push   %esi
+  80288b:	e8 11 e2 ff ff       	call   800aa1 <memset>
+			streams[i].f_fd = fd;
+  802890:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802893:	89 8f 20 60 80 00    	mov    %ecx,0x806020(%edi)
+			streams[i].f_flags = flags;
+  802899:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80289c:	01 d8                	add    %ebx,%eax
+  80289e:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8028a1:	89 0c 85 24 60 80 00 	mov    %ecx,0x806024(,%eax,4)
+			return &streams[i];
+  8028a8:	83 c4 10             	add    $0x10,%esp
+  8028ab:	eb b6                	jmp    802863 <stream_alloc+0x2f>
+
+008028ad <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  8028ad:	55                   	push   %ebp
+  8028ae:	89 e5                	mov    %esp,%ebp
+  8028b0:	53                   	push   %ebx
+  8028b1:	83 ec 14             	sub    $0x14,%esp
+  8028b4:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  8028b6:	8b 40 18             	mov    0x18(%eax),%eax
+  8028b9:	39 43 14             	cmp    %eax,0x14(%ebx)
+  8028bc:	74 4a                	je     802908 <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  8028be:	83 ec 08             	sub    $0x8,%esp
+  8028c1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8028c4:	50                   	push   %eax
+  8028c5:	ff 33                	push   (%ebx)
+  8028c7:	e8 e2 f1 ff ff       	call   801aae <fd_lookup>
+  8028cc:	89 c2                	mov    %eax,%edx
+  8028ce:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8028d1:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  8028d6:	85 d2                	test   %edx,%edx
+  8028d8:	78 41                	js     80291b <stream_unread+0x6e>
+  8028da:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8028dd:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  8028e3:	39 0a                	cmp    %ecx,(%edx)
+  8028e5:	75 34                	jne    80291b <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  8028e7:	8b 43 14             	mov    0x14(%ebx),%eax
+  8028ea:	03 42 04             	add    0x4(%edx),%eax
+  8028ed:	2b 43 18             	sub    0x18(%ebx),%eax
+  8028f0:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  8028f3:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  8028fa:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  802901:	b8 01 00 00 00       	mov    $0x1,%eax
+  802906:	eb 13                	jmp    80291b <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  802908:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  80290f:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  802916:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80291b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80291e:	c9                   	leave
+  80291f:	c3                   	ret
+
+00802920 <stream_drain>:
+{
+  802920:	55                   	push   %ebp
+  802921:	89 e5                	mov    %esp,%ebp
+  802923:	56                   	push   %esi
+  802924:	53                   	push   %ebx
+  802925:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  802927:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80292c:	eb 02                	jmp    802930 <stream_drain+0x10>
+  80292e:	01 c3                	add    %eax,%ebx
+  802930:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802933:	39 c3                	cmp    %eax,%ebx
+  802935:	73 43                	jae    80297a <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  802937:	83 ec 04             	sub    $0x4,%esp
+  80293a:	29 d8                	sub    %ebx,%eax
+  80293c:	50                   	push   %eax
+  80293d:	89 d8                	mov    %ebx,%eax
+  80293f:	03 46 0c             	add    0xc(%esi),%eax
+  802942:	50                   	push   %eax
+  802943:	ff 36                	push   (%esi)
+  802945:	e8 ec f4 ff ff       	call   801e36 <write>
+  80294a:	83 c4 10             	add    $0x10,%esp
+  80294d:	85 c0                	test   %eax,%eax
+  80294f:	7f dd                	jg     80292e <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  802951:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  802955:	8b 56 0c             	mov    0xc(%esi),%edx
+  802958:	83 ec 04             	sub    $0x4,%esp
+  80295b:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80295e:	29 d8                	sub    %ebx,%eax
+  802960:	50                   	push   %eax
+  802961:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  802964:	50                   	push   %eax
+  802965:	52                   	push   %edx
+  802966:	e8 6b e1 ff ff       	call   800ad6 <memmove>
+			f->f_wend -= done;
+  80296b:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80296e:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  802970:	83 c4 10             	add    $0x10,%esp
+  802973:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  802978:	eb 0a                	jmp    802984 <stream_drain+0x64>
+  80297a:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  80297f:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  802984:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  802987:	89 d0                	mov    %edx,%eax
+  802989:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80298c:	5b                   	pop    %ebx
+  80298d:	5e                   	pop    %esi
+  80298e:	5d                   	pop    %ebp
+  80298f:	c3                   	ret
+
+00802990 <stream_setup>:
+	if (f->f_buf)
+  802990:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802994:	74 01                	je     802997 <stream_setup+0x7>
+  802996:	c3                   	ret
+{
+  802997:	55                   	push   %ebp
+  802998:	89 e5                	mov    %esp,%ebp
+  80299a:	53                   	push   %ebx
+  80299b:	83 ec 04             	sub    $0x4,%esp
+  80299e:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  8029a0:	8b 40 08             	mov    0x8(%eax),%eax
+  8029a3:	85 c0                	test   %eax,%eax
+  8029a5:	74 17                	je     8029be <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  8029a7:	83 f8 03             	cmp    $0x3,%eax
+  8029aa:	75 2d                	jne    8029d9 <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  8029ac:	8d 43 20             	lea    0x20(%ebx),%eax
+  8029af:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  8029b2:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  8029b9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029bc:	c9                   	leave
+  8029bd:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  8029be:	83 ec 0c             	sub    $0xc,%esp
+  8029c1:	ff 33                	push   (%ebx)
+  8029c3:	e8 65 1b 00 00       	call   80452d <iscons>
+  8029c8:	83 c4 10             	add    $0x10,%esp
+  8029cb:	85 c0                	test   %eax,%eax
+  8029cd:	0f 9f c0             	setg   %al
+  8029d0:	0f b6 c0             	movzbl %al,%eax
+  8029d3:	83 c0 01             	add    $0x1,%eax
+  8029d6:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  8029d9:	83 ec 0c             	sub    $0xc,%esp
+  8029dc:	68 00 10 00 00       	push   $0x1000
+  8029e1:	e8 aa 0b 00 00       	call   803590 <malloc>
+  8029e6:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8029e9:	83 c4 10             	add    $0x10,%esp
+  8029ec:	85 c0                	test   %eax,%eax
+  8029ee:	74 bc                	je     8029ac <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  8029f0:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  8029f7:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  8029fb:	eb bc                	jmp    8029b9 <stream_setup+0x29>
+
+008029fd <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  8029fd:	55                   	push   %ebp
+  8029fe:	89 e5                	mov    %esp,%ebp
+  802a00:	53                   	push   %ebx
+  802a01:	83 ec 04             	sub    $0x4,%esp
+  802a04:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  802a06:	e8 85 ff ff ff       	call   802990 <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  802a0b:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  802a10:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  802a14:	74 3d                	je     802a53 <stream_fill+0x56>
+  802a16:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  802a1a:	74 10                	je     802a2c <stream_fill+0x2f>
+  802a1c:	89 d8                	mov    %ebx,%eax
+  802a1e:	e8 fd fe ff ff       	call   802920 <stream_drain>
+		return 0;
+  802a23:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  802a28:	85 c0                	test   %eax,%eax
+  802a2a:	78 27                	js     802a53 <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  802a2c:	83 ec 04             	sub    $0x4,%esp
+  802a2f:	ff 73 10             	push   0x10(%ebx)
+  802a32:	ff 73 0c             	push   0xc(%ebx)
+  802a35:	ff 33                	push   (%ebx)
+  802a37:	e8 02 f3 ff ff       	call   801d3e <read>
+  802a3c:	83 c4 10             	add    $0x10,%esp
+  802a3f:	85 c0                	test   %eax,%eax
+  802a41:	7e 17                	jle    802a5a <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  802a43:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  802a47:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  802a4e:	89 c2                	mov    %eax,%edx
+  802a50:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  802a53:	89 d0                	mov    %edx,%eax
+  802a55:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a58:	c9                   	leave
+  802a59:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802a5a:	c1 f8 1f             	sar    $0x1f,%eax
+  802a5d:	83 e0 04             	and    $0x4,%eax
+  802a60:	83 c0 04             	add    $0x4,%eax
+  802a63:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  802a66:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a6b:	eb e6                	jmp    802a53 <stream_fill+0x56>
+
+00802a6d <fopen>:
+{
+  802a6d:	55                   	push   %ebp
+  802a6e:	89 e5                	mov    %esp,%ebp
+  802a70:	57                   	push   %edi
+  802a71:	56                   	push   %esi
+  802a72:	53                   	push   %ebx
+  802a73:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  802a79:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  802a7c:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  802a82:	89 f0                	mov    %esi,%eax
+  802a84:	e8 40 fd ff ff       	call   8027c9 <parse_mode>
+		return 0;
+  802a89:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  802a8e:	85 c0                	test   %eax,%eax
+  802a90:	78 2d                	js     802abf <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  802a92:	83 ec 08             	sub    $0x8,%esp
+  802a95:	50                   	push   %eax
+  802a96:	ff 75 08             	push   0x8(%ebp)
+  802a99:	e8 e8 f8 ff ff       	call   802386 <open>
+  802a9e:	89 c7                	mov    %eax,%edi
+  802aa0:	83 c4 10             	add    $0x10,%esp
+  802aa3:	85 c0                	test   %eax,%eax
+  802aa5:	78 58                	js     802aff <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  802aa7:	80 3e 61             	cmpb   $0x61,(%esi)
+  802aaa:	74 1d                	je     802ac9 <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  802aac:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  802ab2:	89 f8                	mov    %edi,%eax
+  802ab4:	e8 7b fd ff ff       	call   802834 <stream_alloc>
+  802ab9:	89 c3                	mov    %eax,%ebx
+  802abb:	85 c0                	test   %eax,%eax
+  802abd:	74 32                	je     802af1 <fopen+0x84>
+}
+  802abf:	89 d8                	mov    %ebx,%eax
+  802ac1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ac4:	5b                   	pop    %ebx
+  802ac5:	5e                   	pop    %esi
+  802ac6:	5f                   	pop    %edi
+  802ac7:	5d                   	pop    %ebp
+  802ac8:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  802ac9:	83 ec 08             	sub    $0x8,%esp
+  802acc:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  802ad2:	50                   	push   %eax
+  802ad3:	57                   	push   %edi
+  802ad4:	e8 db f4 ff ff       	call   801fb4 <fstat>
+  802ad9:	83 c4 10             	add    $0x10,%esp
+  802adc:	85 c0                	test   %eax,%eax
+  802ade:	78 cc                	js     802aac <fopen+0x3f>
+		seek(fd, st.st_size);
+  802ae0:	83 ec 08             	sub    $0x8,%esp
+  802ae3:	ff 75 dc             	push   -0x24(%ebp)
+  802ae6:	57                   	push   %edi
+  802ae7:	e8 f6 f3 ff ff       	call   801ee2 <seek>
+  802aec:	83 c4 10             	add    $0x10,%esp
+  802aef:	eb bb                	jmp    802aac <fopen+0x3f>
+		close(fd);
+  802af1:	83 ec 0c             	sub    $0xc,%esp
+  802af4:	57                   	push   %edi
+  802af5:	e8 08 f1 ff ff       	call   801c02 <close>
+  802afa:	83 c4 10             	add    $0x10,%esp
+  802afd:	eb c0                	jmp    802abf <fopen+0x52>
+		return 0;
+  802aff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b04:	eb b9                	jmp    802abf <fopen+0x52>
+
+00802b06 <fdopen>:
+{
+  802b06:	55                   	push   %ebp
+  802b07:	89 e5                	mov    %esp,%ebp
+  802b09:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  802b0c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802b0f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b12:	e8 b2 fc ff ff       	call   8027c9 <parse_mode>
+  802b17:	89 c2                	mov    %eax,%edx
+		return 0;
+  802b19:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  802b1e:	85 d2                	test   %edx,%edx
+  802b20:	78 0b                	js     802b2d <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  802b22:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802b25:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b28:	e8 07 fd ff ff       	call   802834 <stream_alloc>
+}
+  802b2d:	c9                   	leave
+  802b2e:	c3                   	ret
+
+00802b2f <setvbuf>:
+{
+  802b2f:	55                   	push   %ebp
+  802b30:	89 e5                	mov    %esp,%ebp
+  802b32:	57                   	push   %edi
+  802b33:	56                   	push   %esi
+  802b34:	53                   	push   %ebx
+  802b35:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b38:	8b 55 10             	mov    0x10(%ebp),%edx
+  802b3b:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  802b3e:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802b42:	75 3a                	jne    802b7e <setvbuf+0x4f>
+  802b44:	8d 72 ff             	lea    -0x1(%edx),%esi
+  802b47:	83 fe 02             	cmp    $0x2,%esi
+  802b4a:	77 39                	ja     802b85 <setvbuf+0x56>
+	f->f_bufmode = mode;
+  802b4c:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  802b4f:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802b53:	0f 95 c3             	setne  %bl
+  802b56:	85 ff                	test   %edi,%edi
+  802b58:	0f 95 c1             	setne  %cl
+  802b5b:	84 cb                	test   %cl,%bl
+  802b5d:	74 05                	je     802b64 <setvbuf+0x35>
+  802b5f:	83 fa 03             	cmp    $0x3,%edx
+  802b62:	75 0a                	jne    802b6e <setvbuf+0x3f>
+	return 0;
+  802b64:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b69:	5b                   	pop    %ebx
+  802b6a:	5e                   	pop    %esi
+  802b6b:	5f                   	pop    %edi
+  802b6c:	5d                   	pop    %ebp
+  802b6d:	c3                   	ret
+		f->f_buf = buf;
+  802b6e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802b71:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  802b74:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  802b77:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b7c:	eb eb                	jmp    802b69 <setvbuf+0x3a>
+		return EOF;
+  802b7e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802b83:	eb e4                	jmp    802b69 <setvbuf+0x3a>
+  802b85:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802b8a:	eb dd                	jmp    802b69 <setvbuf+0x3a>
+
+00802b8c <fflush>:
+{
+  802b8c:	55                   	push   %ebp
+  802b8d:	89 e5                	mov    %esp,%ebp
+  802b8f:	57                   	push   %edi
+  802b90:	56                   	push   %esi
+  802b91:	53                   	push   %ebx
+  802b92:	83 ec 0c             	sub    $0xc,%esp
+  802b95:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  802b98:	85 db                	test   %ebx,%ebx
+  802b9a:	74 1a                	je     802bb6 <fflush+0x2a>
+	stream_unread(f);
+  802b9c:	89 d8                	mov    %ebx,%eax
+  802b9e:	e8 0a fd ff ff       	call   8028ad <stream_unread>
+	return stream_drain(f);
+  802ba3:	89 d8                	mov    %ebx,%eax
+  802ba5:	e8 76 fd ff ff       	call   802920 <stream_drain>
+  802baa:	89 c7                	mov    %eax,%edi
+}
+  802bac:	89 f8                	mov    %edi,%eax
+  802bae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bb1:	5b                   	pop    %ebx
+  802bb2:	5e                   	pop    %esi
+  802bb3:	5f                   	pop    %edi
+  802bb4:	5d                   	pop    %ebp
+  802bb5:	c3                   	ret
+  802bb6:	bb 20 60 80 00       	mov    $0x806020,%ebx
+  802bbb:	be 60 62 80 00       	mov    $0x806260,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  802bc0:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bc5:	eb 03                	jmp    802bca <fflush+0x3e>
+  802bc7:	83 c3 24             	add    $0x24,%ebx
+  802bca:	39 f3                	cmp    %esi,%ebx
+  802bcc:	74 de                	je     802bac <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  802bce:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  802bd2:	74 f3                	je     802bc7 <fflush+0x3b>
+  802bd4:	83 ec 0c             	sub    $0xc,%esp
+  802bd7:	53                   	push   %ebx
+  802bd8:	e8 af ff ff ff       	call   802b8c <fflush>
+  802bdd:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  802be0:	85 c0                	test   %eax,%eax
+  802be2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802be7:	0f 48 f8             	cmovs  %eax,%edi
+  802bea:	eb db                	jmp    802bc7 <fflush+0x3b>
+
+00802bec <fclose>:
+{
+  802bec:	55                   	push   %ebp
+  802bed:	89 e5                	mov    %esp,%ebp
+  802bef:	56                   	push   %esi
+  802bf0:	53                   	push   %ebx
+  802bf1:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  802bf4:	83 ec 0c             	sub    $0xc,%esp
+  802bf7:	56                   	push   %esi
+  802bf8:	e8 8f ff ff ff       	call   802b8c <fflush>
+  802bfd:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  802bff:	83 c4 04             	add    $0x4,%esp
+  802c02:	ff 36                	push   (%esi)
+  802c04:	e8 f9 ef ff ff       	call   801c02 <close>
+  802c09:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  802c0c:	85 c0                	test   %eax,%eax
+  802c0e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802c13:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  802c16:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  802c1a:	75 10                	jne    802c2c <fclose+0x40>
+	f->f_flags = 0;
+  802c1c:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  802c23:	89 d8                	mov    %ebx,%eax
+  802c25:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c28:	5b                   	pop    %ebx
+  802c29:	5e                   	pop    %esi
+  802c2a:	5d                   	pop    %ebp
+  802c2b:	c3                   	ret
+		free(f->f_buf);
+  802c2c:	83 ec 0c             	sub    $0xc,%esp
+  802c2f:	ff 76 0c             	push   0xc(%esi)
+  802c32:	e8 90 08 00 00       	call   8034c7 <free>
+  802c37:	83 c4 10             	add    $0x10,%esp
+  802c3a:	eb e0                	jmp    802c1c <fclose+0x30>
+
+00802c3c <fileno>:
+{
+  802c3c:	55                   	push   %ebp
+  802c3d:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  802c3f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c42:	8b 00                	mov    (%eax),%eax
+}
+  802c44:	5d                   	pop    %ebp
+  802c45:	c3                   	ret
+
+00802c46 <feof>:
+{
+  802c46:	55                   	push   %ebp
+  802c47:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  802c49:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c4c:	8b 40 04             	mov    0x4(%eax),%eax
+  802c4f:	c1 e8 02             	shr    $0x2,%eax
+  802c52:	83 e0 01             	and    $0x1,%eax
+}
+  802c55:	5d                   	pop    %ebp
+  802c56:	c3                   	ret
+
+00802c57 <ferror>:
+{
+  802c57:	55                   	push   %ebp
+  802c58:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  802c5a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c5d:	8b 40 04             	mov    0x4(%eax),%eax
+  802c60:	c1 e8 03             	shr    $0x3,%eax
+  802c63:	83 e0 01             	and    $0x1,%eax
+}
+  802c66:	5d                   	pop    %ebp
+  802c67:	c3                   	ret
+
+00802c68 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  802c68:	55                   	push   %ebp
+  802c69:	89 e5                	mov    %esp,%ebp
+  802c6b:	53                   	push   %ebx
+  802c6c:	83 ec 04             	sub    $0x4,%esp
+  802c6f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802c72:	8b 43 18             	mov    0x18(%ebx),%eax
+  802c75:	39 43 14             	cmp    %eax,0x14(%ebx)
+  802c78:	74 15                	je     802c8f <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  802c7a:	8b 53 0c             	mov    0xc(%ebx),%edx
+  802c7d:	8b 43 14             	mov    0x14(%ebx),%eax
+  802c80:	8d 48 01             	lea    0x1(%eax),%ecx
+  802c83:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  802c86:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  802c8a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c8d:	c9                   	leave
+  802c8e:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802c8f:	89 d8                	mov    %ebx,%eax
+  802c91:	e8 67 fd ff ff       	call   8029fd <stream_fill>
+  802c96:	85 c0                	test   %eax,%eax
+  802c98:	75 e0                	jne    802c7a <fgetc+0x12>
+		return EOF;
+  802c9a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802c9f:	eb e9                	jmp    802c8a <fgetc+0x22>
+
+00802ca1 <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  802ca1:	55                   	push   %ebp
+  802ca2:	89 e5                	mov    %esp,%ebp
+  802ca4:	57                   	push   %edi
+  802ca5:	56                   	push   %esi
+  802ca6:	53                   	push   %ebx
+  802ca7:	83 ec 1c             	sub    $0x1c,%esp
+  802caa:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  802cad:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802cb2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802cb5:	83 e8 01             	sub    $0x1,%eax
+  802cb8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  802cbb:	eb 66                	jmp    802d23 <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802cbd:	8b 46 14             	mov    0x14(%esi),%eax
+  802cc0:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802cc3:	29 c3                	sub    %eax,%ebx
+  802cc5:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802cc8:	29 fa                	sub    %edi,%edx
+  802cca:	39 d3                	cmp    %edx,%ebx
+  802ccc:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802ccf:	83 ec 04             	sub    $0x4,%esp
+  802cd2:	53                   	push   %ebx
+  802cd3:	6a 0a                	push   $0xa
+  802cd5:	03 46 0c             	add    0xc(%esi),%eax
+  802cd8:	50                   	push   %eax
+  802cd9:	e8 a9 de ff ff       	call   800b87 <memfind>
+  802cde:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  802ce1:	8b 46 0c             	mov    0xc(%esi),%eax
+  802ce4:	8b 4e 14             	mov    0x14(%esi),%ecx
+  802ce7:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  802cea:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802cec:	83 c4 10             	add    $0x10,%esp
+  802cef:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802cf2:	74 0b                	je     802cff <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  802cf4:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802cf7:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802cfa:	29 d3                	sub    %edx,%ebx
+  802cfc:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  802cff:	83 ec 04             	sub    $0x4,%esp
+  802d02:	53                   	push   %ebx
+  802d03:	01 c8                	add    %ecx,%eax
+  802d05:	50                   	push   %eax
+  802d06:	89 f8                	mov    %edi,%eax
+  802d08:	03 45 08             	add    0x8(%ebp),%eax
+  802d0b:	50                   	push   %eax
+  802d0c:	e8 c5 dd ff ff       	call   800ad6 <memmove>
+		f->f_rpos += m;
+  802d11:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  802d14:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  802d16:	83 c4 10             	add    $0x10,%esp
+  802d19:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d1c:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  802d21:	74 1f                	je     802d42 <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  802d23:	8d 47 01             	lea    0x1(%edi),%eax
+  802d26:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  802d29:	73 17                	jae    802d42 <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802d2b:	8b 46 18             	mov    0x18(%esi),%eax
+  802d2e:	39 46 14             	cmp    %eax,0x14(%esi)
+  802d31:	75 8a                	jne    802cbd <fgets+0x1c>
+  802d33:	89 f0                	mov    %esi,%eax
+  802d35:	e8 c3 fc ff ff       	call   8029fd <stream_fill>
+  802d3a:	85 c0                	test   %eax,%eax
+  802d3c:	0f 85 7b ff ff ff    	jne    802cbd <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  802d42:	85 ff                	test   %edi,%edi
+  802d44:	74 0f                	je     802d55 <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  802d46:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d49:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  802d4d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d50:	5b                   	pop    %ebx
+  802d51:	5e                   	pop    %esi
+  802d52:	5f                   	pop    %edi
+  802d53:	5d                   	pop    %ebp
+  802d54:	c3                   	ret
+		return 0;
+  802d55:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d5a:	eb f1                	jmp    802d4d <fgets+0xac>
+
+00802d5c <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  802d5c:	55                   	push   %ebp
+  802d5d:	89 e5                	mov    %esp,%ebp
+  802d5f:	57                   	push   %edi
+  802d60:	56                   	push   %esi
+  802d61:	53                   	push   %ebx
+  802d62:	83 ec 1c             	sub    $0x1c,%esp
+  802d65:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  802d68:	89 f0                	mov    %esi,%eax
+  802d6a:	e8 21 fc ff ff       	call   802990 <stream_setup>
+	want = size * n;
+  802d6f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d72:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802d76:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  802d79:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d7e:	eb 43                	jmp    802dc3 <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  802d80:	29 d3                	sub    %edx,%ebx
+  802d82:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802d85:	29 f8                	sub    %edi,%eax
+  802d87:	39 c3                	cmp    %eax,%ebx
+  802d89:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  802d8c:	83 ec 04             	sub    $0x4,%esp
+  802d8f:	53                   	push   %ebx
+  802d90:	03 56 0c             	add    0xc(%esi),%edx
+  802d93:	52                   	push   %edx
+  802d94:	89 f8                	mov    %edi,%eax
+  802d96:	03 45 08             	add    0x8(%ebp),%eax
+  802d99:	50                   	push   %eax
+  802d9a:	e8 37 dd ff ff       	call   800ad6 <memmove>
+			f->f_rpos += m;
+  802d9f:	01 5e 14             	add    %ebx,0x14(%esi)
+  802da2:	83 c4 10             	add    $0x10,%esp
+  802da5:	eb 1a                	jmp    802dc1 <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  802da7:	83 ec 04             	sub    $0x4,%esp
+  802daa:	53                   	push   %ebx
+  802dab:	89 f8                	mov    %edi,%eax
+  802dad:	03 45 08             	add    0x8(%ebp),%eax
+  802db0:	50                   	push   %eax
+  802db1:	ff 36                	push   (%esi)
+  802db3:	e8 86 ef ff ff       	call   801d3e <read>
+  802db8:	89 c3                	mov    %eax,%ebx
+  802dba:	83 c4 10             	add    $0x10,%esp
+  802dbd:	85 c0                	test   %eax,%eax
+  802dbf:	7e 36                	jle    802df7 <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  802dc1:	01 df                	add    %ebx,%edi
+  802dc3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802dc6:	39 c7                	cmp    %eax,%edi
+  802dc8:	73 39                	jae    802e03 <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  802dca:	8b 56 14             	mov    0x14(%esi),%edx
+  802dcd:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802dd0:	39 da                	cmp    %ebx,%edx
+  802dd2:	72 ac                	jb     802d80 <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  802dd4:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802dd7:	29 fb                	sub    %edi,%ebx
+  802dd9:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  802ddc:	72 3e                	jb     802e1c <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  802dde:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  802de2:	74 1f                	je     802e03 <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  802de4:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  802de8:	74 bd                	je     802da7 <fread+0x4b>
+  802dea:	89 f0                	mov    %esi,%eax
+  802dec:	e8 2f fb ff ff       	call   802920 <stream_drain>
+  802df1:	85 c0                	test   %eax,%eax
+  802df3:	79 b2                	jns    802da7 <fread+0x4b>
+  802df5:	eb 0c                	jmp    802e03 <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802df7:	c1 fb 1f             	sar    $0x1f,%ebx
+  802dfa:	83 e3 04             	and    $0x4,%ebx
+  802dfd:	83 c3 04             	add    $0x4,%ebx
+  802e00:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  802e03:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e06:	85 c0                	test   %eax,%eax
+  802e08:	74 0a                	je     802e14 <fread+0xb8>
+  802e0a:	89 f8                	mov    %edi,%eax
+  802e0c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e11:	f7 75 0c             	divl   0xc(%ebp)
+}
+  802e14:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e17:	5b                   	pop    %ebx
+  802e18:	5e                   	pop    %esi
+  802e19:	5f                   	pop    %edi
+  802e1a:	5d                   	pop    %ebp
+  802e1b:	c3                   	ret
+		} else if (!stream_fill(f))
+  802e1c:	89 f0                	mov    %esi,%eax
+  802e1e:	e8 da fb ff ff       	call   8029fd <stream_fill>
+  802e23:	85 c0                	test   %eax,%eax
+  802e25:	74 dc                	je     802e03 <fread+0xa7>
+			m = 0;
+  802e27:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e2c:	eb 93                	jmp    802dc1 <fread+0x65>
+
+00802e2e <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  802e2e:	55                   	push   %ebp
+  802e2f:	89 e5                	mov    %esp,%ebp
+  802e31:	57                   	push   %edi
+  802e32:	56                   	push   %esi
+  802e33:	53                   	push   %ebx
+  802e34:	83 ec 1c             	sub    $0x1c,%esp
+  802e37:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  802e3a:	8b 43 04             	mov    0x4(%ebx),%eax
+  802e3d:	a8 02                	test   $0x2,%al
+  802e3f:	75 13                	jne    802e54 <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  802e41:	83 c8 08             	or     $0x8,%eax
+  802e44:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  802e47:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  802e4c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e4f:	5b                   	pop    %ebx
+  802e50:	5e                   	pop    %esi
+  802e51:	5f                   	pop    %edi
+  802e52:	5d                   	pop    %ebp
+  802e53:	c3                   	ret
+	stream_setup(f);
+  802e54:	89 d8                	mov    %ebx,%eax
+  802e56:	e8 35 fb ff ff       	call   802990 <stream_setup>
+	want = size * n;
+  802e5b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e5e:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802e62:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  802e65:	89 d8                	mov    %ebx,%eax
+  802e67:	e8 41 fa ff ff       	call   8028ad <stream_unread>
+	for (done = 0; done < want; ) {
+  802e6c:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  802e71:	84 c0                	test   %al,%al
+  802e73:	75 7b                	jne    802ef0 <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  802e75:	be 00 00 00 00       	mov    $0x0,%esi
+  802e7a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802e7d:	39 fe                	cmp    %edi,%esi
+  802e7f:	73 24                	jae    802ea5 <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802e81:	83 ec 04             	sub    $0x4,%esp
+  802e84:	89 f8                	mov    %edi,%eax
+  802e86:	29 f0                	sub    %esi,%eax
+  802e88:	50                   	push   %eax
+  802e89:	89 f0                	mov    %esi,%eax
+  802e8b:	03 45 08             	add    0x8(%ebp),%eax
+  802e8e:	50                   	push   %eax
+  802e8f:	ff 33                	push   (%ebx)
+  802e91:	e8 a0 ef ff ff       	call   801e36 <write>
+  802e96:	83 c4 10             	add    $0x10,%esp
+  802e99:	85 c0                	test   %eax,%eax
+  802e9b:	7e 04                	jle    802ea1 <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  802e9d:	01 c6                	add    %eax,%esi
+  802e9f:	eb dc                	jmp    802e7d <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  802ea1:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  802ea5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ea8:	85 c0                	test   %eax,%eax
+  802eaa:	74 a0                	je     802e4c <fwrite+0x1e>
+  802eac:	89 f0                	mov    %esi,%eax
+  802eae:	ba 00 00 00 00       	mov    $0x0,%edx
+  802eb3:	f7 75 0c             	divl   0xc(%ebp)
+  802eb6:	eb 94                	jmp    802e4c <fwrite+0x1e>
+			done += r;
+  802eb8:	01 c7                	add    %eax,%edi
+			continue;
+  802eba:	eb 34                	jmp    802ef0 <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  802ebc:	8b 73 10             	mov    0x10(%ebx),%esi
+  802ebf:	29 c6                	sub    %eax,%esi
+  802ec1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802ec4:	29 fa                	sub    %edi,%edx
+  802ec6:	39 d6                	cmp    %edx,%esi
+  802ec8:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  802ecb:	83 ec 04             	sub    $0x4,%esp
+  802ece:	56                   	push   %esi
+  802ecf:	89 fa                	mov    %edi,%edx
+  802ed1:	03 55 08             	add    0x8(%ebp),%edx
+  802ed4:	52                   	push   %edx
+  802ed5:	03 43 0c             	add    0xc(%ebx),%eax
+  802ed8:	50                   	push   %eax
+  802ed9:	e8 f8 db ff ff       	call   800ad6 <memmove>
+		f->f_wend += m;
+  802ede:	89 f0                	mov    %esi,%eax
+  802ee0:	03 43 1c             	add    0x1c(%ebx),%eax
+  802ee3:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  802ee6:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802ee8:	83 c4 10             	add    $0x10,%esp
+  802eeb:	3b 43 10             	cmp    0x10(%ebx),%eax
+  802eee:	74 5b                	je     802f4b <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  802ef0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802ef3:	39 c7                	cmp    %eax,%edi
+  802ef5:	73 2d                	jae    802f24 <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  802ef7:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802efa:	85 c0                	test   %eax,%eax
+  802efc:	75 be                	jne    802ebc <fwrite+0x8e>
+  802efe:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802f01:	29 fa                	sub    %edi,%edx
+  802f03:	3b 53 10             	cmp    0x10(%ebx),%edx
+  802f06:	72 b4                	jb     802ebc <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802f08:	83 ec 04             	sub    $0x4,%esp
+  802f0b:	52                   	push   %edx
+  802f0c:	89 f8                	mov    %edi,%eax
+  802f0e:	03 45 08             	add    0x8(%ebp),%eax
+  802f11:	50                   	push   %eax
+  802f12:	ff 33                	push   (%ebx)
+  802f14:	e8 1d ef ff ff       	call   801e36 <write>
+  802f19:	83 c4 10             	add    $0x10,%esp
+  802f1c:	85 c0                	test   %eax,%eax
+  802f1e:	7f 98                	jg     802eb8 <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  802f20:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  802f24:	8b 43 08             	mov    0x8(%ebx),%eax
+  802f27:	83 f8 03             	cmp    $0x3,%eax
+  802f2a:	74 48                	je     802f74 <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802f2c:	83 f8 02             	cmp    $0x2,%eax
+  802f2f:	74 27                	je     802f58 <fwrite+0x12a>
+	return size ? done / size : 0;
+  802f31:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f34:	85 c0                	test   %eax,%eax
+  802f36:	0f 84 10 ff ff ff    	je     802e4c <fwrite+0x1e>
+  802f3c:	89 f8                	mov    %edi,%eax
+  802f3e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f43:	f7 75 0c             	divl   0xc(%ebp)
+  802f46:	e9 01 ff ff ff       	jmp    802e4c <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802f4b:	89 d8                	mov    %ebx,%eax
+  802f4d:	e8 ce f9 ff ff       	call   802920 <stream_drain>
+  802f52:	85 c0                	test   %eax,%eax
+  802f54:	79 9a                	jns    802ef0 <fwrite+0xc2>
+  802f56:	eb cc                	jmp    802f24 <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802f58:	83 ec 04             	sub    $0x4,%esp
+  802f5b:	57                   	push   %edi
+  802f5c:	6a 0a                	push   $0xa
+  802f5e:	ff 75 08             	push   0x8(%ebp)
+  802f61:	e8 21 dc ff ff       	call   800b87 <memfind>
+  802f66:	89 c2                	mov    %eax,%edx
+  802f68:	89 f8                	mov    %edi,%eax
+  802f6a:	03 45 08             	add    0x8(%ebp),%eax
+  802f6d:	83 c4 10             	add    $0x10,%esp
+  802f70:	39 c2                	cmp    %eax,%edx
+  802f72:	74 bd                	je     802f31 <fwrite+0x103>
+		stream_drain(f);
+  802f74:	89 d8                	mov    %ebx,%eax
+  802f76:	e8 a5 f9 ff ff       	call   802920 <stream_drain>
+  802f7b:	eb b4                	jmp    802f31 <fwrite+0x103>
+
+00802f7d <fputc>:
+{
+  802f7d:	55                   	push   %ebp
+  802f7e:	89 e5                	mov    %esp,%ebp
+  802f80:	53                   	push   %ebx
+  802f81:	83 ec 14             	sub    $0x14,%esp
+  802f84:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  802f87:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  802f8a:	ff 75 0c             	push   0xc(%ebp)
+  802f8d:	6a 01                	push   $0x1
+  802f8f:	6a 01                	push   $0x1
+  802f91:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802f94:	50                   	push   %eax
+  802f95:	e8 94 fe ff ff       	call   802e2e <fwrite>
+  802f9a:	83 c4 10             	add    $0x10,%esp
+  802f9d:	0f b6 db             	movzbl %bl,%ebx
+  802fa0:	83 f8 01             	cmp    $0x1,%eax
+  802fa3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802fa8:	0f 44 c3             	cmove  %ebx,%eax
+}
+  802fab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802fae:	c9                   	leave
+  802faf:	c3                   	ret
+
+00802fb0 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  802fb0:	55                   	push   %ebp
+  802fb1:	89 e5                	mov    %esp,%ebp
+  802fb3:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  802fb6:	ff 75 0c             	push   0xc(%ebp)
+  802fb9:	ff 75 08             	push   0x8(%ebp)
+  802fbc:	e8 bc ff ff ff       	call   802f7d <fputc>
+}
+  802fc1:	83 c4 10             	add    $0x10,%esp
+  802fc4:	c9                   	leave
+  802fc5:	c3                   	ret
+
+00802fc6 <fputs>:
+{
+  802fc6:	55                   	push   %ebp
+  802fc7:	89 e5                	mov    %esp,%ebp
+  802fc9:	56                   	push   %esi
+  802fca:	53                   	push   %ebx
+  802fcb:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  802fce:	83 ec 0c             	sub    $0xc,%esp
+  802fd1:	56                   	push   %esi
+  802fd2:	e8 3e d9 ff ff       	call   800915 <strlen>
+  802fd7:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  802fd9:	ff 75 0c             	push   0xc(%ebp)
+  802fdc:	50                   	push   %eax
+  802fdd:	6a 01                	push   $0x1
+  802fdf:	56                   	push   %esi
+  802fe0:	e8 49 fe ff ff       	call   802e2e <fwrite>
+  802fe5:	83 c4 20             	add    $0x20,%esp
+  802fe8:	39 d8                	cmp    %ebx,%eax
+  802fea:	0f 95 c0             	setne  %al
+  802fed:	0f b6 c0             	movzbl %al,%eax
+  802ff0:	f7 d8                	neg    %eax
+}
+  802ff2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ff5:	5b                   	pop    %ebx
+  802ff6:	5e                   	pop    %esi
+  802ff7:	5d                   	pop    %ebp
+  802ff8:	c3                   	ret
+
+00802ff9 <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  802ff9:	55                   	push   %ebp
+  802ffa:	89 e5                	mov    %esp,%ebp
+  802ffc:	53                   	push   %ebx
+  802ffd:	83 ec 04             	sub    $0x4,%esp
+  803000:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  803003:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  803006:	50                   	push   %eax
+  803007:	ff 75 0c             	push   0xc(%ebp)
+  80300a:	53                   	push   %ebx
+  80300b:	68 b0 2f 80 00       	push   $0x802fb0
+  803010:	e8 4e d4 ff ff       	call   800463 <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  803015:	8b 43 04             	mov    0x4(%ebx),%eax
+  803018:	c1 e0 1c             	shl    $0x1c,%eax
+  80301b:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  80301e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803021:	c9                   	leave
+  803022:	c3                   	ret
+
+00803023 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803023:	55                   	push   %ebp
+  803024:	89 e5                	mov    %esp,%ebp
+  803026:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803029:	89 c2                	mov    %eax,%edx
+  80302b:	c1 ea 16             	shr    $0x16,%edx
+  80302e:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803035:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80303a:	f6 c1 01             	test   $0x1,%cl
+  80303d:	74 1c                	je     80305b <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  80303f:	c1 e8 0c             	shr    $0xc,%eax
+  803042:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803049:	a8 01                	test   $0x1,%al
+  80304b:	74 0e                	je     80305b <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80304d:	c1 e8 0c             	shr    $0xc,%eax
+  803050:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  803057:	ef 
+  803058:	0f b7 d2             	movzwl %dx,%edx
+}
+  80305b:	89 d0                	mov    %edx,%eax
+  80305d:	5d                   	pop    %ebp
+  80305e:	c3                   	ret
+
+0080305f <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80305f:	55                   	push   %ebp
+  803060:	89 e5                	mov    %esp,%ebp
+  803062:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  803065:	68 fc 4f 80 00       	push   $0x804ffc
+  80306a:	ff 75 0c             	push   0xc(%ebp)
+  80306d:	e8 de d8 ff ff       	call   800950 <strcpy>
+	return 0;
+}
+  803072:	b8 00 00 00 00       	mov    $0x0,%eax
+  803077:	c9                   	leave
+  803078:	c3                   	ret
+
+00803079 <devsock_close>:
+{
+  803079:	55                   	push   %ebp
+  80307a:	89 e5                	mov    %esp,%ebp
+  80307c:	53                   	push   %ebx
+  80307d:	83 ec 10             	sub    $0x10,%esp
+  803080:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  803083:	53                   	push   %ebx
+  803084:	e8 9a ff ff ff       	call   803023 <pageref>
+  803089:	89 c2                	mov    %eax,%edx
+  80308b:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80308e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  803093:	83 fa 01             	cmp    $0x1,%edx
+  803096:	74 05                	je     80309d <devsock_close+0x24>
+}
+  803098:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80309b:	c9                   	leave
+  80309c:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80309d:	83 ec 0c             	sub    $0xc,%esp
+  8030a0:	ff 73 0c             	push   0xc(%ebx)
+  8030a3:	e8 b7 02 00 00       	call   80335f <nsipc_close>
+  8030a8:	83 c4 10             	add    $0x10,%esp
+  8030ab:	eb eb                	jmp    803098 <devsock_close+0x1f>
+
+008030ad <devsock_write>:
+{
+  8030ad:	55                   	push   %ebp
+  8030ae:	89 e5                	mov    %esp,%ebp
+  8030b0:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8030b3:	6a 00                	push   $0x0
+  8030b5:	ff 75 10             	push   0x10(%ebp)
+  8030b8:	ff 75 0c             	push   0xc(%ebp)
+  8030bb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030be:	ff 70 0c             	push   0xc(%eax)
+  8030c1:	e8 79 03 00 00       	call   80343f <nsipc_send>
+}
+  8030c6:	c9                   	leave
+  8030c7:	c3                   	ret
+
+008030c8 <devsock_read>:
+{
+  8030c8:	55                   	push   %ebp
+  8030c9:	89 e5                	mov    %esp,%ebp
+  8030cb:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8030ce:	6a 00                	push   $0x0
+  8030d0:	ff 75 10             	push   0x10(%ebp)
+  8030d3:	ff 75 0c             	push   0xc(%ebp)
+  8030d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030d9:	ff 70 0c             	push   0xc(%eax)
+  8030dc:	e8 ef 02 00 00       	call   8033d0 <nsipc_recv>
+}
+  8030e1:	c9                   	leave
+  8030e2:	c3                   	ret
+
+008030e3 <fd2sockid>:
+{
+  8030e3:	55                   	push   %ebp
+  8030e4:	89 e5                	mov    %esp,%ebp
+  8030e6:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8030e9:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8030ec:	52                   	push   %edx
+  8030ed:	50                   	push   %eax
+  8030ee:	e8 bb e9 ff ff       	call   801aae <fd_lookup>
+  8030f3:	83 c4 10             	add    $0x10,%esp
+  8030f6:	85 c0                	test   %eax,%eax
+  8030f8:	78 10                	js     80310a <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8030fa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8030fd:	8b 0d 60 62 80 00    	mov    0x806260,%ecx
+  803103:	39 08                	cmp    %ecx,(%eax)
+  803105:	75 05                	jne    80310c <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  803107:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  80310a:	c9                   	leave
+  80310b:	c3                   	ret
+		return -E_NOT_SUPP;
+  80310c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803111:	eb f7                	jmp    80310a <fd2sockid+0x27>
+
+00803113 <alloc_sockfd>:
+{
+  803113:	55                   	push   %ebp
+  803114:	89 e5                	mov    %esp,%ebp
+  803116:	56                   	push   %esi
+  803117:	53                   	push   %ebx
+  803118:	83 ec 1c             	sub    $0x1c,%esp
+  80311b:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  80311d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803120:	50                   	push   %eax
+  803121:	e8 32 e9 ff ff       	call   801a58 <fd_alloc>
+  803126:	89 c3                	mov    %eax,%ebx
+  803128:	83 c4 10             	add    $0x10,%esp
+  80312b:	85 c0                	test   %eax,%eax
+  80312d:	78 43                	js     803172 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80312f:	83 ec 04             	sub    $0x4,%esp
+  803132:	68 07 04 00 00       	push   $0x407
+  803137:	ff 75 f4             	push   -0xc(%ebp)
+  80313a:	6a 00                	push   $0x0
+  80313c:	e8 4d dc ff ff       	call   800d8e <sys_page_alloc>
+  803141:	89 c3                	mov    %eax,%ebx
+  803143:	83 c4 10             	add    $0x10,%esp
+  803146:	85 c0                	test   %eax,%eax
+  803148:	78 28                	js     803172 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  80314a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80314d:	8b 15 60 62 80 00    	mov    0x806260,%edx
+  803153:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  803155:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803158:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80315f:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  803162:	83 ec 0c             	sub    $0xc,%esp
+  803165:	50                   	push   %eax
+  803166:	e8 c6 e8 ff ff       	call   801a31 <fd2num>
+  80316b:	89 c3                	mov    %eax,%ebx
+  80316d:	83 c4 10             	add    $0x10,%esp
+  803170:	eb 0c                	jmp    80317e <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  803172:	83 ec 0c             	sub    $0xc,%esp
+  803175:	56                   	push   %esi
+  803176:	e8 e4 01 00 00       	call   80335f <nsipc_close>
+		return r;
+  80317b:	83 c4 10             	add    $0x10,%esp
+}
+  80317e:	89 d8                	mov    %ebx,%eax
+  803180:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803183:	5b                   	pop    %ebx
+  803184:	5e                   	pop    %esi
+  803185:	5d                   	pop    %ebp
+  803186:	c3                   	ret
+
+00803187 <accept>:
+{
+  803187:	55                   	push   %ebp
+  803188:	89 e5                	mov    %esp,%ebp
+  80318a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80318d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803190:	e8 4e ff ff ff       	call   8030e3 <fd2sockid>
+  803195:	85 c0                	test   %eax,%eax
+  803197:	78 1b                	js     8031b4 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  803199:	83 ec 04             	sub    $0x4,%esp
+  80319c:	ff 75 10             	push   0x10(%ebp)
+  80319f:	ff 75 0c             	push   0xc(%ebp)
+  8031a2:	50                   	push   %eax
+  8031a3:	e8 0e 01 00 00       	call   8032b6 <nsipc_accept>
+  8031a8:	83 c4 10             	add    $0x10,%esp
+  8031ab:	85 c0                	test   %eax,%eax
+  8031ad:	78 05                	js     8031b4 <accept+0x2d>
+	return alloc_sockfd(r);
+  8031af:	e8 5f ff ff ff       	call   803113 <alloc_sockfd>
+}
+  8031b4:	c9                   	leave
+  8031b5:	c3                   	ret
+
+008031b6 <bind>:
+{
+  8031b6:	55                   	push   %ebp
+  8031b7:	89 e5                	mov    %esp,%ebp
+  8031b9:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8031bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031bf:	e8 1f ff ff ff       	call   8030e3 <fd2sockid>
+  8031c4:	85 c0                	test   %eax,%eax
+  8031c6:	78 12                	js     8031da <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8031c8:	83 ec 04             	sub    $0x4,%esp
+  8031cb:	ff 75 10             	push   0x10(%ebp)
+  8031ce:	ff 75 0c             	push   0xc(%ebp)
+  8031d1:	50                   	push   %eax
+  8031d2:	e8 31 01 00 00       	call   803308 <nsipc_bind>
+  8031d7:	83 c4 10             	add    $0x10,%esp
+}
+  8031da:	c9                   	leave
+  8031db:	c3                   	ret
+
+008031dc <shutdown>:
+{
+  8031dc:	55                   	push   %ebp
+  8031dd:	89 e5                	mov    %esp,%ebp
+  8031df:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8031e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031e5:	e8 f9 fe ff ff       	call   8030e3 <fd2sockid>
+  8031ea:	85 c0                	test   %eax,%eax
+  8031ec:	78 0f                	js     8031fd <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8031ee:	83 ec 08             	sub    $0x8,%esp
+  8031f1:	ff 75 0c             	push   0xc(%ebp)
+  8031f4:	50                   	push   %eax
+  8031f5:	e8 43 01 00 00       	call   80333d <nsipc_shutdown>
+  8031fa:	83 c4 10             	add    $0x10,%esp
+}
+  8031fd:	c9                   	leave
+  8031fe:	c3                   	ret
+
+008031ff <connect>:
+{
+  8031ff:	55                   	push   %ebp
+  803200:	89 e5                	mov    %esp,%ebp
+  803202:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803205:	8b 45 08             	mov    0x8(%ebp),%eax
+  803208:	e8 d6 fe ff ff       	call   8030e3 <fd2sockid>
+  80320d:	85 c0                	test   %eax,%eax
+  80320f:	78 12                	js     803223 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  803211:	83 ec 04             	sub    $0x4,%esp
+  803214:	ff 75 10             	push   0x10(%ebp)
+  803217:	ff 75 0c             	push   0xc(%ebp)
+  80321a:	50                   	push   %eax
+  80321b:	e8 59 01 00 00       	call   803379 <nsipc_connect>
+  803220:	83 c4 10             	add    $0x10,%esp
+}
+  803223:	c9                   	leave
+  803224:	c3                   	ret
+
+00803225 <listen>:
+{
+  803225:	55                   	push   %ebp
+  803226:	89 e5                	mov    %esp,%ebp
+  803228:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80322b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80322e:	e8 b0 fe ff ff       	call   8030e3 <fd2sockid>
+  803233:	85 c0                	test   %eax,%eax
+  803235:	78 0f                	js     803246 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  803237:	83 ec 08             	sub    $0x8,%esp
+  80323a:	ff 75 0c             	push   0xc(%ebp)
+  80323d:	50                   	push   %eax
+  80323e:	e8 6b 01 00 00       	call   8033ae <nsipc_listen>
+  803243:	83 c4 10             	add    $0x10,%esp
+}
+  803246:	c9                   	leave
+  803247:	c3                   	ret
+
+00803248 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  803248:	55                   	push   %ebp
+  803249:	89 e5                	mov    %esp,%ebp
+  80324b:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80324e:	ff 75 10             	push   0x10(%ebp)
+  803251:	ff 75 0c             	push   0xc(%ebp)
+  803254:	ff 75 08             	push   0x8(%ebp)
+  803257:	e8 41 02 00 00       	call   80349d <nsipc_socket>
+  80325c:	83 c4 10             	add    $0x10,%esp
+  80325f:	85 c0                	test   %eax,%eax
+  803261:	78 05                	js     803268 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  803263:	e8 ab fe ff ff       	call   803113 <alloc_sockfd>
+}
+  803268:	c9                   	leave
+  803269:	c3                   	ret
+
+0080326a <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80326a:	55                   	push   %ebp
+  80326b:	89 e5                	mov    %esp,%ebp
+  80326d:	53                   	push   %ebx
+  80326e:	83 ec 04             	sub    $0x4,%esp
+  803271:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  803273:	83 3d 08 70 80 00 00 	cmpl   $0x0,0x807008
+  80327a:	74 26                	je     8032a2 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  80327c:	6a 07                	push   $0x7
+  80327e:	68 00 90 80 00       	push   $0x809000
+  803283:	53                   	push   %ebx
+  803284:	ff 35 08 70 80 00    	push   0x807008
+  80328a:	e8 0d e7 ff ff       	call   80199c <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  80328f:	83 c4 0c             	add    $0xc,%esp
+  803292:	6a 00                	push   $0x0
+  803294:	6a 00                	push   $0x0
+  803296:	6a 00                	push   $0x0
+  803298:	e8 09 e6 ff ff       	call   8018a6 <ipc_recv>
+}
+  80329d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8032a0:	c9                   	leave
+  8032a1:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8032a2:	83 ec 0c             	sub    $0xc,%esp
+  8032a5:	6a 02                	push   $0x2
+  8032a7:	e8 46 e7 ff ff       	call   8019f2 <ipc_find_env>
+  8032ac:	a3 08 70 80 00       	mov    %eax,0x807008
+  8032b1:	83 c4 10             	add    $0x10,%esp
+  8032b4:	eb c6                	jmp    80327c <nsipc+0x12>
+
+008032b6 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8032b6:	55                   	push   %ebp
+  8032b7:	89 e5                	mov    %esp,%ebp
+  8032b9:	56                   	push   %esi
+  8032ba:	53                   	push   %ebx
+  8032bb:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8032be:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032c1:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  8032c6:	8b 06                	mov    (%esi),%eax
+  8032c8:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8032cd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8032d2:	e8 93 ff ff ff       	call   80326a <nsipc>
+  8032d7:	89 c3                	mov    %eax,%ebx
+  8032d9:	85 c0                	test   %eax,%eax
+  8032db:	79 09                	jns    8032e6 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8032dd:	89 d8                	mov    %ebx,%eax
+  8032df:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032e2:	5b                   	pop    %ebx
+  8032e3:	5e                   	pop    %esi
+  8032e4:	5d                   	pop    %ebp
+  8032e5:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8032e6:	83 ec 04             	sub    $0x4,%esp
+  8032e9:	ff 35 10 90 80 00    	push   0x809010
+  8032ef:	68 00 90 80 00       	push   $0x809000
+  8032f4:	ff 75 0c             	push   0xc(%ebp)
+  8032f7:	e8 da d7 ff ff       	call   800ad6 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8032fc:	a1 10 90 80 00       	mov    0x809010,%eax
+  803301:	89 06                	mov    %eax,(%esi)
+  803303:	83 c4 10             	add    $0x10,%esp
+	return r;
+  803306:	eb d5                	jmp    8032dd <nsipc_accept+0x27>
+
+00803308 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  803308:	55                   	push   %ebp
+  803309:	89 e5                	mov    %esp,%ebp
+  80330b:	53                   	push   %ebx
+  80330c:	83 ec 08             	sub    $0x8,%esp
+  80330f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  803312:	8b 45 08             	mov    0x8(%ebp),%eax
+  803315:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  80331a:	53                   	push   %ebx
+  80331b:	ff 75 0c             	push   0xc(%ebp)
+  80331e:	68 04 90 80 00       	push   $0x809004
+  803323:	e8 ae d7 ff ff       	call   800ad6 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  803328:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  80332e:	b8 02 00 00 00       	mov    $0x2,%eax
+  803333:	e8 32 ff ff ff       	call   80326a <nsipc>
+}
+  803338:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80333b:	c9                   	leave
+  80333c:	c3                   	ret
+
+0080333d <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80333d:	55                   	push   %ebp
+  80333e:	89 e5                	mov    %esp,%ebp
+  803340:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  803343:	8b 45 08             	mov    0x8(%ebp),%eax
+  803346:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  80334b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80334e:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  803353:	b8 03 00 00 00       	mov    $0x3,%eax
+  803358:	e8 0d ff ff ff       	call   80326a <nsipc>
+}
+  80335d:	c9                   	leave
+  80335e:	c3                   	ret
+
+0080335f <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80335f:	55                   	push   %ebp
+  803360:	89 e5                	mov    %esp,%ebp
+  803362:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  803365:	8b 45 08             	mov    0x8(%ebp),%eax
+  803368:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  80336d:	b8 04 00 00 00       	mov    $0x4,%eax
+  803372:	e8 f3 fe ff ff       	call   80326a <nsipc>
+}
+  803377:	c9                   	leave
+  803378:	c3                   	ret
+
+00803379 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  803379:	55                   	push   %ebp
+  80337a:	89 e5                	mov    %esp,%ebp
+  80337c:	53                   	push   %ebx
+  80337d:	83 ec 08             	sub    $0x8,%esp
+  803380:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  803383:	8b 45 08             	mov    0x8(%ebp),%eax
+  803386:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  80338b:	53                   	push   %ebx
+  80338c:	ff 75 0c             	push   0xc(%ebp)
+  80338f:	68 04 90 80 00       	push   $0x809004
+  803394:	e8 3d d7 ff ff       	call   800ad6 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  803399:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  80339f:	b8 05 00 00 00       	mov    $0x5,%eax
+  8033a4:	e8 c1 fe ff ff       	call   80326a <nsipc>
+}
+  8033a9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8033ac:	c9                   	leave
+  8033ad:	c3                   	ret
+
+008033ae <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8033ae:	55                   	push   %ebp
+  8033af:	89 e5                	mov    %esp,%ebp
+  8033b1:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8033b4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033b7:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  8033bc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8033bf:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  8033c4:	b8 06 00 00 00       	mov    $0x6,%eax
+  8033c9:	e8 9c fe ff ff       	call   80326a <nsipc>
+}
+  8033ce:	c9                   	leave
+  8033cf:	c3                   	ret
+
+008033d0 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8033d0:	55                   	push   %ebp
+  8033d1:	89 e5                	mov    %esp,%ebp
+  8033d3:	56                   	push   %esi
+  8033d4:	53                   	push   %ebx
+  8033d5:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8033d8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033db:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  8033e0:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  8033e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8033e9:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8033ee:	b8 07 00 00 00       	mov    $0x7,%eax
+  8033f3:	e8 72 fe ff ff       	call   80326a <nsipc>
+  8033f8:	89 c3                	mov    %eax,%ebx
+  8033fa:	85 c0                	test   %eax,%eax
+  8033fc:	78 22                	js     803420 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8033fe:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  803403:	39 c6                	cmp    %eax,%esi
+  803405:	0f 4e c6             	cmovle %esi,%eax
+  803408:	39 c3                	cmp    %eax,%ebx
+  80340a:	7f 1d                	jg     803429 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  80340c:	83 ec 04             	sub    $0x4,%esp
+  80340f:	53                   	push   %ebx
+  803410:	68 00 90 80 00       	push   $0x809000
+  803415:	ff 75 0c             	push   0xc(%ebp)
+  803418:	e8 b9 d6 ff ff       	call   800ad6 <memmove>
+  80341d:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  803420:	89 d8                	mov    %ebx,%eax
+  803422:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803425:	5b                   	pop    %ebx
+  803426:	5e                   	pop    %esi
+  803427:	5d                   	pop    %ebp
+  803428:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  803429:	68 08 50 80 00       	push   $0x805008
+  80342e:	68 b1 4e 80 00       	push   $0x804eb1
+  803433:	6a 62                	push   $0x62
+  803435:	68 1d 50 80 00       	push   $0x80501d
+  80343a:	e8 52 ce ff ff       	call   800291 <_panic>
+
+0080343f <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80343f:	55                   	push   %ebp
+  803440:	89 e5                	mov    %esp,%ebp
+  803442:	53                   	push   %ebx
+  803443:	83 ec 04             	sub    $0x4,%esp
+  803446:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  803449:	8b 45 08             	mov    0x8(%ebp),%eax
+  80344c:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  803451:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  803457:	7f 2e                	jg     803487 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  803459:	83 ec 04             	sub    $0x4,%esp
+  80345c:	53                   	push   %ebx
+  80345d:	ff 75 0c             	push   0xc(%ebp)
+  803460:	68 0c 90 80 00       	push   $0x80900c
+  803465:	e8 6c d6 ff ff       	call   800ad6 <memmove>
+	nsipcbuf.send.req_size = size;
+  80346a:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  803470:	8b 45 14             	mov    0x14(%ebp),%eax
+  803473:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  803478:	b8 08 00 00 00       	mov    $0x8,%eax
+  80347d:	e8 e8 fd ff ff       	call   80326a <nsipc>
+}
+  803482:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803485:	c9                   	leave
+  803486:	c3                   	ret
+	assert(size < 1600);
+  803487:	68 29 50 80 00       	push   $0x805029
+  80348c:	68 b1 4e 80 00       	push   $0x804eb1
+  803491:	6a 6d                	push   $0x6d
+  803493:	68 1d 50 80 00       	push   $0x80501d
+  803498:	e8 f4 cd ff ff       	call   800291 <_panic>
+
+0080349d <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80349d:	55                   	push   %ebp
+  80349e:	89 e5                	mov    %esp,%ebp
+  8034a0:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8034a3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034a6:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  8034ab:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8034ae:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  8034b3:	8b 45 10             	mov    0x10(%ebp),%eax
+  8034b6:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  8034bb:	b8 09 00 00 00       	mov    $0x9,%eax
+  8034c0:	e8 a5 fd ff ff       	call   80326a <nsipc>
+}
+  8034c5:	c9                   	leave
+  8034c6:	c3                   	ret
+
+008034c7 <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  8034c7:	55                   	push   %ebp
+  8034c8:	89 e5                	mov    %esp,%ebp
+  8034ca:	53                   	push   %ebx
+  8034cb:	83 ec 10             	sub    $0x10,%esp
+  8034ce:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  8034d1:	68 0c 70 80 00       	push   $0x80700c
+  8034d6:	e8 50 07 00 00       	call   803c2b <mutex_lock>
+	if (v == 0)
+  8034db:	83 c4 10             	add    $0x10,%esp
+  8034de:	85 db                	test   %ebx,%ebx
+  8034e0:	0f 84 85 00 00 00    	je     80356b <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  8034e6:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  8034ec:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  8034f1:	77 51                	ja     803544 <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  8034f3:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  8034f9:	89 d8                	mov    %ebx,%eax
+  8034fb:	c1 e8 0c             	shr    $0xc,%eax
+  8034fe:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803505:	f6 c4 02             	test   $0x2,%ah
+  803508:	74 50                	je     80355a <free+0x93>
+		sys_page_unmap(0, c);
+  80350a:	83 ec 08             	sub    $0x8,%esp
+  80350d:	53                   	push   %ebx
+  80350e:	6a 00                	push   $0x0
+  803510:	e8 12 d9 ff ff       	call   800e27 <sys_page_unmap>
+		c += PGSIZE;
+  803515:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  80351b:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  803521:	83 c4 10             	add    $0x10,%esp
+  803524:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  803529:	76 ce                	jbe    8034f9 <free+0x32>
+  80352b:	68 73 50 80 00       	push   $0x805073
+  803530:	68 b1 4e 80 00       	push   $0x804eb1
+  803535:	68 82 00 00 00       	push   $0x82
+  80353a:	68 66 50 80 00       	push   $0x805066
+  80353f:	e8 4d cd ff ff       	call   800291 <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  803544:	68 38 50 80 00       	push   $0x805038
+  803549:	68 b1 4e 80 00       	push   $0x804eb1
+  80354e:	6a 7b                	push   $0x7b
+  803550:	68 66 50 80 00       	push   $0x805066
+  803555:	e8 37 cd ff ff       	call   800291 <_panic>
+	if (--(*ref) == 0)
+  80355a:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  803560:	83 e8 01             	sub    $0x1,%eax
+  803563:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  803569:	74 15                	je     803580 <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  80356b:	83 ec 0c             	sub    $0xc,%esp
+  80356e:	68 0c 70 80 00       	push   $0x80700c
+  803573:	e8 20 07 00 00       	call   803c98 <mutex_unlock>
+}
+  803578:	83 c4 10             	add    $0x10,%esp
+  80357b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80357e:	c9                   	leave
+  80357f:	c3                   	ret
+		sys_page_unmap(0, c);
+  803580:	83 ec 08             	sub    $0x8,%esp
+  803583:	53                   	push   %ebx
+  803584:	6a 00                	push   $0x0
+  803586:	e8 9c d8 ff ff       	call   800e27 <sys_page_unmap>
+  80358b:	83 c4 10             	add    $0x10,%esp
+  80358e:	eb db                	jmp    80356b <free+0xa4>
+
+00803590 <malloc>:
+{
+  803590:	55                   	push   %ebp
+  803591:	89 e5                	mov    %esp,%ebp
+  803593:	57                   	push   %edi
+  803594:	56                   	push   %esi
+  803595:	53                   	push   %ebx
+  803596:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  803599:	68 0c 70 80 00       	push   $0x80700c
+  80359e:	e8 88 06 00 00       	call   803c2b <mutex_lock>
+	if (mptr == 0)
+  8035a3:	8b 3d 10 70 80 00    	mov    0x807010,%edi
+  8035a9:	83 c4 10             	add    $0x10,%esp
+  8035ac:	85 ff                	test   %edi,%edi
+  8035ae:	74 6c                	je     80361c <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  8035b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035b3:	83 c0 03             	add    $0x3,%eax
+  8035b6:	83 e0 fc             	and    $0xfffffffc,%eax
+  8035b9:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  8035bb:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  8035c0:	0f 87 64 01 00 00    	ja     80372a <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  8035c6:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8035cc:	74 30                	je     8035fe <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  8035ce:	89 f9                	mov    %edi,%ecx
+  8035d0:	c1 e9 0c             	shr    $0xc,%ecx
+  8035d3:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  8035d7:	c1 e8 0c             	shr    $0xc,%eax
+  8035da:	39 c1                	cmp    %eax,%ecx
+  8035dc:	74 5f                	je     80363d <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  8035de:	83 ec 0c             	sub    $0xc,%esp
+  8035e1:	57                   	push   %edi
+  8035e2:	e8 e0 fe ff ff       	call   8034c7 <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  8035e7:	a1 10 70 80 00       	mov    0x807010,%eax
+  8035ec:	05 00 10 00 00       	add    $0x1000,%eax
+  8035f1:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8035f6:	a3 10 70 80 00       	mov    %eax,0x807010
+  8035fb:	83 c4 10             	add    $0x10,%esp
+  8035fe:	8b 0d 10 70 80 00    	mov    0x807010,%ecx
+{
+  803604:	ba 02 00 00 00       	mov    $0x2,%edx
+  803609:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  80360d:	8d 7e 04             	lea    0x4(%esi),%edi
+  803610:	89 cb                	mov    %ecx,%ebx
+  803612:	01 f9                	add    %edi,%ecx
+  803614:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  803617:	e9 8b 00 00 00       	jmp    8036a7 <malloc+0x117>
+		mptr = mbegin;
+  80361c:	c7 05 10 70 80 00 00 	movl   $0x8000000,0x807010
+  803623:	00 00 08 
+	n = ROUNDUP(n, 4);
+  803626:	8b 45 08             	mov    0x8(%ebp),%eax
+  803629:	83 c0 03             	add    $0x3,%eax
+  80362c:	83 e0 fc             	and    $0xfffffffc,%eax
+  80362f:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  803631:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  803636:	76 c6                	jbe    8035fe <malloc+0x6e>
+  803638:	e9 d6 00 00 00       	jmp    803713 <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  80363d:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  803643:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  803648:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  80364c:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  80364f:	a3 10 70 80 00       	mov    %eax,0x807010
+			return v;
+  803654:	e9 ba 00 00 00       	jmp    803713 <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  803659:	05 00 10 00 00       	add    $0x1000,%eax
+  80365e:	39 c8                	cmp    %ecx,%eax
+  803660:	0f 83 cb 00 00 00    	jae    803731 <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  803666:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  80366b:	77 22                	ja     80368f <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  80366d:	89 c2                	mov    %eax,%edx
+  80366f:	c1 ea 16             	shr    $0x16,%edx
+  803672:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  803679:	f6 c2 01             	test   $0x1,%dl
+  80367c:	74 db                	je     803659 <malloc+0xc9>
+  80367e:	89 c2                	mov    %eax,%edx
+  803680:	c1 ea 0c             	shr    $0xc,%edx
+  803683:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80368a:	f6 c2 01             	test   $0x1,%dl
+  80368d:	74 ca                	je     803659 <malloc+0xc9>
+		if (mptr == mend) {
+  80368f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803695:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  80369b:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  80369f:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  8036a5:	74 04                	je     8036ab <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  8036a7:	89 d8                	mov    %ebx,%eax
+  8036a9:	eb b3                	jmp    80365e <malloc+0xce>
+  8036ab:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  8036ae:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  8036b3:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  8036b7:	83 ea 01             	sub    $0x1,%edx
+  8036ba:	0f 85 50 ff ff ff    	jne    803610 <malloc+0x80>
+  8036c0:	c7 05 10 70 80 00 00 	movl   $0x8000000,0x807010
+  8036c7:	00 00 08 
+				return 0;	/* out of address space */
+  8036ca:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036cf:	eb 42                	jmp    803713 <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  8036d1:	85 db                	test   %ebx,%ebx
+  8036d3:	78 1e                	js     8036f3 <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  8036d5:	83 ec 08             	sub    $0x8,%esp
+  8036d8:	89 d8                	mov    %ebx,%eax
+  8036da:	03 05 10 70 80 00    	add    0x807010,%eax
+  8036e0:	50                   	push   %eax
+  8036e1:	6a 00                	push   $0x0
+  8036e3:	e8 3f d7 ff ff       	call   800e27 <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  8036e8:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  8036ee:	83 c4 10             	add    $0x10,%esp
+  8036f1:	eb de                	jmp    8036d1 <malloc+0x141>
+			return 0;	/* out of physical memory */
+  8036f3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036f8:	eb 19                	jmp    803713 <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  8036fa:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8036fd:	8b 3d 10 70 80 00    	mov    0x807010,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  803703:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  80370a:	00 
+	mptr += n;
+  80370b:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  80370e:	a3 10 70 80 00       	mov    %eax,0x807010
+	mutex_unlock(&malloc_mu);
+  803713:	83 ec 0c             	sub    $0xc,%esp
+  803716:	68 0c 70 80 00       	push   $0x80700c
+  80371b:	e8 78 05 00 00       	call   803c98 <mutex_unlock>
+}
+  803720:	89 f8                	mov    %edi,%eax
+  803722:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803725:	5b                   	pop    %ebx
+  803726:	5e                   	pop    %esi
+  803727:	5f                   	pop    %edi
+  803728:	5d                   	pop    %ebp
+  803729:	c3                   	ret
+		return 0;
+  80372a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80372f:	eb e2                	jmp    803713 <malloc+0x183>
+  803731:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  803735:	74 06                	je     80373d <malloc+0x1ad>
+  803737:	89 1d 10 70 80 00    	mov    %ebx,0x807010
+	for (i = 0; i < n + 4; i += PGSIZE){
+  80373d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803742:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803745:	39 fb                	cmp    %edi,%ebx
+  803747:	73 b1                	jae    8036fa <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  803749:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  80374f:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  803752:	39 fe                	cmp    %edi,%esi
+  803754:	0f 92 c0             	setb   %al
+  803757:	0f b6 c0             	movzbl %al,%eax
+  80375a:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  80375d:	83 c8 07             	or     $0x7,%eax
+  803760:	50                   	push   %eax
+  803761:	89 d8                	mov    %ebx,%eax
+  803763:	03 05 10 70 80 00    	add    0x807010,%eax
+  803769:	50                   	push   %eax
+  80376a:	6a 00                	push   $0x0
+  80376c:	e8 1d d6 ff ff       	call   800d8e <sys_page_alloc>
+  803771:	83 c4 10             	add    $0x10,%esp
+  803774:	85 c0                	test   %eax,%eax
+  803776:	0f 88 55 ff ff ff    	js     8036d1 <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  80377c:	89 f3                	mov    %esi,%ebx
+  80377e:	eb c5                	jmp    803745 <malloc+0x1b5>
+
+00803780 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  803780:	55                   	push   %ebp
+  803781:	89 e5                	mov    %esp,%ebp
+  803783:	56                   	push   %esi
+  803784:	53                   	push   %ebx
+  803785:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803788:	83 ec 0c             	sub    $0xc,%esp
+  80378b:	ff 75 08             	push   0x8(%ebp)
+  80378e:	e8 ae e2 ff ff       	call   801a41 <fd2data>
+  803793:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  803795:	83 c4 08             	add    $0x8,%esp
+  803798:	68 8b 50 80 00       	push   $0x80508b
+  80379d:	53                   	push   %ebx
+  80379e:	e8 ad d1 ff ff       	call   800950 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8037a3:	8b 46 04             	mov    0x4(%esi),%eax
+  8037a6:	2b 06                	sub    (%esi),%eax
+  8037a8:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8037ae:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8037b5:	00 00 00 
+	stat->st_dev = &devpipe;
+  8037b8:	c7 83 88 00 00 00 7c 	movl   $0x80627c,0x88(%ebx)
+  8037bf:	62 80 00 
+	return 0;
+}
+  8037c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8037ca:	5b                   	pop    %ebx
+  8037cb:	5e                   	pop    %esi
+  8037cc:	5d                   	pop    %ebp
+  8037cd:	c3                   	ret
+
+008037ce <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  8037ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8037d3:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  8037d7:	85 c9                	test   %ecx,%ecx
+  8037d9:	75 01                	jne    8037dc <pipewake+0xe>
+  8037db:	c3                   	ret
+{
+  8037dc:	55                   	push   %ebp
+  8037dd:	89 e5                	mov    %esp,%ebp
+  8037df:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  8037e2:	68 00 04 00 00       	push   $0x400
+  8037e7:	52                   	push   %edx
+  8037e8:	e8 e5 d8 ff ff       	call   8010d2 <sys_futex_wake>
+  8037ed:	83 c4 10             	add    $0x10,%esp
+}
+  8037f0:	c9                   	leave
+  8037f1:	c3                   	ret
+
+008037f2 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8037f2:	55                   	push   %ebp
+  8037f3:	89 e5                	mov    %esp,%ebp
+  8037f5:	56                   	push   %esi
+  8037f6:	53                   	push   %ebx
+  8037f7:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8037fa:	83 ec 0c             	sub    $0xc,%esp
+  8037fd:	56                   	push   %esi
+  8037fe:	e8 3e e2 ff ff       	call   801a41 <fd2data>
+  803803:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  803805:	83 c4 08             	add    $0x8,%esp
+  803808:	56                   	push   %esi
+  803809:	6a 00                	push   $0x0
+  80380b:	e8 17 d6 ff ff       	call   800e27 <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  803810:	8d 53 04             	lea    0x4(%ebx),%edx
+  803813:	8d 43 08             	lea    0x8(%ebx),%eax
+  803816:	e8 b3 ff ff ff       	call   8037ce <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  80381b:	8d 43 0c             	lea    0xc(%ebx),%eax
+  80381e:	89 da                	mov    %ebx,%edx
+  803820:	e8 a9 ff ff ff       	call   8037ce <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  803825:	89 34 24             	mov    %esi,(%esp)
+  803828:	e8 14 e2 ff ff       	call   801a41 <fd2data>
+  80382d:	83 c4 08             	add    $0x8,%esp
+  803830:	50                   	push   %eax
+  803831:	6a 00                	push   $0x0
+  803833:	e8 ef d5 ff ff       	call   800e27 <sys_page_unmap>
+}
+  803838:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80383b:	5b                   	pop    %ebx
+  80383c:	5e                   	pop    %esi
+  80383d:	5d                   	pop    %ebp
+  80383e:	c3                   	ret
+
+0080383f <_pipeisclosed>:
+{
+  80383f:	55                   	push   %ebp
+  803840:	89 e5                	mov    %esp,%ebp
+  803842:	57                   	push   %edi
+  803843:	56                   	push   %esi
+  803844:	53                   	push   %ebx
+  803845:	83 ec 1c             	sub    $0x1c,%esp
+  803848:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80384b:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80384d:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  803852:	eb 5d                	jmp    8038b1 <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  803854:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		n = thisenv->env_runs;
+  80385a:	8b 02                	mov    (%edx),%eax
+  80385c:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  80385f:	83 ec 0c             	sub    $0xc,%esp
+  803862:	ff 75 e0             	push   -0x20(%ebp)
+  803865:	e8 b9 f7 ff ff       	call   803023 <pageref>
+  80386a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80386d:	89 3c 24             	mov    %edi,(%esp)
+  803870:	e8 ae f7 ff ff       	call   803023 <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  803875:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803877:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  80387d:	83 c4 10             	add    $0x10,%esp
+  803880:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803886:	77 15                	ja     80389d <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803888:	89 f2                	mov    %esi,%edx
+  80388a:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  80388c:	c1 ea 10             	shr    $0x10,%edx
+  80388f:	74 0c                	je     80389d <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803891:	c1 e2 10             	shl    $0x10,%edx
+  803894:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  803899:	29 d1                	sub    %edx,%ecx
+  80389b:	eb 06                	jmp    8038a3 <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  80389d:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		nn = thisenv->env_runs;
+  8038a3:	8b 11                	mov    (%ecx),%edx
+  8038a5:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  8038a8:	39 d3                	cmp    %edx,%ebx
+  8038aa:	74 6e                	je     80391a <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  8038ac:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8038af:	74 24                	je     8038d5 <_pipeisclosed+0x96>
+  8038b1:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8038b3:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8038b9:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8038be:	77 94                	ja     803854 <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8038c0:	89 f0                	mov    %esi,%eax
+  8038c2:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8038c4:	c1 e8 10             	shr    $0x10,%eax
+  8038c7:	74 8b                	je     803854 <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8038c9:	c1 e0 10             	shl    $0x10,%eax
+  8038cc:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8038d1:	29 c2                	sub    %eax,%edx
+  8038d3:	eb 85                	jmp    80385a <_pipeisclosed+0x1b>
+  8038d5:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8038d7:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8038dd:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8038e2:	77 18                	ja     8038fc <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8038e4:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8038e9:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8038eb:	c1 e8 10             	shr    $0x10,%eax
+  8038ee:	74 0c                	je     8038fc <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8038f0:	c1 e0 10             	shl    $0x10,%eax
+  8038f3:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8038f8:	29 c2                	sub    %eax,%edx
+  8038fa:	eb 06                	jmp    803902 <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  8038fc:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803902:	8b 02                	mov    (%edx),%eax
+  803904:	8b 40 58             	mov    0x58(%eax),%eax
+  803907:	6a 01                	push   $0x1
+  803909:	50                   	push   %eax
+  80390a:	53                   	push   %ebx
+  80390b:	68 92 50 80 00       	push   $0x805092
+  803910:	e8 57 ca ff ff       	call   80036c <cprintf>
+  803915:	83 c4 10             	add    $0x10,%esp
+  803918:	eb 97                	jmp    8038b1 <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  80391a:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80391d:	0f 94 c0             	sete   %al
+  803920:	0f b6 c0             	movzbl %al,%eax
+}
+  803923:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803926:	5b                   	pop    %ebx
+  803927:	5e                   	pop    %esi
+  803928:	5f                   	pop    %edi
+  803929:	5d                   	pop    %ebp
+  80392a:	c3                   	ret
+
+0080392b <devpipe_write>:
+{
+  80392b:	55                   	push   %ebp
+  80392c:	89 e5                	mov    %esp,%ebp
+  80392e:	57                   	push   %edi
+  80392f:	56                   	push   %esi
+  803930:	53                   	push   %ebx
+  803931:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  803934:	ff 75 08             	push   0x8(%ebp)
+  803937:	e8 05 e1 ff ff       	call   801a41 <fd2data>
+  80393c:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80393e:	83 c4 10             	add    $0x10,%esp
+  803941:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  803948:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  80394b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80394e:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803951:	0f 84 96 00 00 00    	je     8039ed <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  803957:	8d 73 08             	lea    0x8(%ebx),%esi
+  80395a:	eb 32                	jmp    80398e <devpipe_write+0x63>
+  80395c:	89 fa                	mov    %edi,%edx
+  80395e:	89 f0                	mov    %esi,%eax
+  803960:	e8 69 fe ff ff       	call   8037ce <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  803965:	8b 43 04             	mov    0x4(%ebx),%eax
+  803968:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  80396b:	ba 01 00 00 00       	mov    $0x1,%edx
+  803970:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  803975:	83 ec 04             	sub    $0x4,%esp
+  803978:	6a 0a                	push   $0xa
+  80397a:	50                   	push   %eax
+  80397b:	53                   	push   %ebx
+  80397c:	e8 22 d7 ff ff       	call   8010a3 <sys_futex_wait>
+  803981:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803986:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  80398b:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80398e:	8b 43 04             	mov    0x4(%ebx),%eax
+  803991:	8b 0b                	mov    (%ebx),%ecx
+  803993:	8d 51 20             	lea    0x20(%ecx),%edx
+  803996:	39 d0                	cmp    %edx,%eax
+  803998:	72 1b                	jb     8039b5 <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  80399a:	89 da                	mov    %ebx,%edx
+  80399c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80399f:	e8 9b fe ff ff       	call   80383f <_pipeisclosed>
+  8039a4:	85 c0                	test   %eax,%eax
+  8039a6:	74 b4                	je     80395c <devpipe_write+0x31>
+				return 0;
+  8039a8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8039ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8039b0:	5b                   	pop    %ebx
+  8039b1:	5e                   	pop    %esi
+  8039b2:	5f                   	pop    %edi
+  8039b3:	5d                   	pop    %ebp
+  8039b4:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8039b5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8039b8:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8039bb:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  8039bf:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  8039c2:	89 c2                	mov    %eax,%edx
+  8039c4:	c1 fa 1f             	sar    $0x1f,%edx
+  8039c7:	89 d1                	mov    %edx,%ecx
+  8039c9:	c1 e9 1b             	shr    $0x1b,%ecx
+  8039cc:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8039cf:	83 e2 1f             	and    $0x1f,%edx
+  8039d2:	29 ca                	sub    %ecx,%edx
+  8039d4:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  8039d8:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  8039dc:	83 c0 01             	add    $0x1,%eax
+  8039df:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8039e2:	83 c6 01             	add    $0x1,%esi
+  8039e5:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8039e8:	e9 5e ff ff ff       	jmp    80394b <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  8039ed:	8d 53 04             	lea    0x4(%ebx),%edx
+  8039f0:	8d 43 08             	lea    0x8(%ebx),%eax
+  8039f3:	e8 d6 fd ff ff       	call   8037ce <pipewake>
+	return i;
+  8039f8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8039fb:	eb b0                	jmp    8039ad <devpipe_write+0x82>
+
+008039fd <devpipe_read>:
+{
+  8039fd:	55                   	push   %ebp
+  8039fe:	89 e5                	mov    %esp,%ebp
+  803a00:	57                   	push   %edi
+  803a01:	56                   	push   %esi
+  803a02:	53                   	push   %ebx
+  803a03:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  803a06:	ff 75 08             	push   0x8(%ebp)
+  803a09:	e8 33 e0 ff ff       	call   801a41 <fd2data>
+  803a0e:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803a10:	83 c4 10             	add    $0x10,%esp
+  803a13:	be 00 00 00 00       	mov    $0x0,%esi
+  803a18:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803a1b:	74 6c                	je     803a89 <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  803a1d:	8d 7b 04             	lea    0x4(%ebx),%edi
+  803a20:	eb 25                	jmp    803a47 <devpipe_read+0x4a>
+  803a22:	8b 13                	mov    (%ebx),%edx
+  803a24:	b8 01 00 00 00       	mov    $0x1,%eax
+  803a29:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  803a2e:	83 ec 04             	sub    $0x4,%esp
+  803a31:	6a 0a                	push   $0xa
+  803a33:	52                   	push   %edx
+  803a34:	57                   	push   %edi
+  803a35:	e8 69 d6 ff ff       	call   8010a3 <sys_futex_wait>
+  803a3a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803a3f:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  803a44:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  803a47:	8b 03                	mov    (%ebx),%eax
+  803a49:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803a4c:	75 19                	jne    803a67 <devpipe_read+0x6a>
+			if (i > 0)
+  803a4e:	85 f6                	test   %esi,%esi
+  803a50:	75 3a                	jne    803a8c <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  803a52:	89 da                	mov    %ebx,%edx
+  803a54:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a57:	e8 e3 fd ff ff       	call   80383f <_pipeisclosed>
+  803a5c:	85 c0                	test   %eax,%eax
+  803a5e:	74 c2                	je     803a22 <devpipe_read+0x25>
+				return 0;
+  803a60:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a65:	eb 31                	jmp    803a98 <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803a67:	89 c1                	mov    %eax,%ecx
+  803a69:	c1 f9 1f             	sar    $0x1f,%ecx
+  803a6c:	c1 e9 1b             	shr    $0x1b,%ecx
+  803a6f:	01 c8                	add    %ecx,%eax
+  803a71:	83 e0 1f             	and    $0x1f,%eax
+  803a74:	29 c8                	sub    %ecx,%eax
+  803a76:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  803a7b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803a7e:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  803a81:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  803a84:	83 c6 01             	add    $0x1,%esi
+  803a87:	eb 8f                	jmp    803a18 <devpipe_read+0x1b>
+out:
+  803a89:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  803a8c:	8d 43 0c             	lea    0xc(%ebx),%eax
+  803a8f:	89 da                	mov    %ebx,%edx
+  803a91:	e8 38 fd ff ff       	call   8037ce <pipewake>
+	return i;
+  803a96:	89 f0                	mov    %esi,%eax
+}
+  803a98:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a9b:	5b                   	pop    %ebx
+  803a9c:	5e                   	pop    %esi
+  803a9d:	5f                   	pop    %edi
+  803a9e:	5d                   	pop    %ebp
+  803a9f:	c3                   	ret
+
+00803aa0 <pipe>:
+{
+  803aa0:	55                   	push   %ebp
+  803aa1:	89 e5                	mov    %esp,%ebp
+  803aa3:	56                   	push   %esi
+  803aa4:	53                   	push   %ebx
+  803aa5:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803aa8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803aab:	50                   	push   %eax
+  803aac:	e8 a7 df ff ff       	call   801a58 <fd_alloc>
+  803ab1:	89 c3                	mov    %eax,%ebx
+  803ab3:	83 c4 10             	add    $0x10,%esp
+  803ab6:	85 c0                	test   %eax,%eax
+  803ab8:	0f 88 23 01 00 00    	js     803be1 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803abe:	83 ec 04             	sub    $0x4,%esp
+  803ac1:	68 07 04 00 00       	push   $0x407
+  803ac6:	ff 75 f4             	push   -0xc(%ebp)
+  803ac9:	6a 00                	push   $0x0
+  803acb:	e8 be d2 ff ff       	call   800d8e <sys_page_alloc>
+  803ad0:	89 c3                	mov    %eax,%ebx
+  803ad2:	83 c4 10             	add    $0x10,%esp
+  803ad5:	85 c0                	test   %eax,%eax
+  803ad7:	0f 88 04 01 00 00    	js     803be1 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803add:	83 ec 0c             	sub    $0xc,%esp
+  803ae0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803ae3:	50                   	push   %eax
+  803ae4:	e8 6f df ff ff       	call   801a58 <fd_alloc>
+  803ae9:	89 c3                	mov    %eax,%ebx
+  803aeb:	83 c4 10             	add    $0x10,%esp
+  803aee:	85 c0                	test   %eax,%eax
+  803af0:	0f 88 db 00 00 00    	js     803bd1 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803af6:	83 ec 04             	sub    $0x4,%esp
+  803af9:	68 07 04 00 00       	push   $0x407
+  803afe:	ff 75 f0             	push   -0x10(%ebp)
+  803b01:	6a 00                	push   $0x0
+  803b03:	e8 86 d2 ff ff       	call   800d8e <sys_page_alloc>
+  803b08:	89 c3                	mov    %eax,%ebx
+  803b0a:	83 c4 10             	add    $0x10,%esp
+  803b0d:	85 c0                	test   %eax,%eax
+  803b0f:	0f 88 bc 00 00 00    	js     803bd1 <pipe+0x131>
+	va = fd2data(fd0);
+  803b15:	83 ec 0c             	sub    $0xc,%esp
+  803b18:	ff 75 f4             	push   -0xc(%ebp)
+  803b1b:	e8 21 df ff ff       	call   801a41 <fd2data>
+  803b20:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803b22:	83 c4 0c             	add    $0xc,%esp
+  803b25:	68 07 04 00 00       	push   $0x407
+  803b2a:	50                   	push   %eax
+  803b2b:	6a 00                	push   $0x0
+  803b2d:	e8 5c d2 ff ff       	call   800d8e <sys_page_alloc>
+  803b32:	89 c3                	mov    %eax,%ebx
+  803b34:	83 c4 10             	add    $0x10,%esp
+  803b37:	85 c0                	test   %eax,%eax
+  803b39:	0f 88 82 00 00 00    	js     803bc1 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803b3f:	83 ec 0c             	sub    $0xc,%esp
+  803b42:	ff 75 f0             	push   -0x10(%ebp)
+  803b45:	e8 f7 de ff ff       	call   801a41 <fd2data>
+  803b4a:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803b51:	50                   	push   %eax
+  803b52:	6a 00                	push   $0x0
+  803b54:	56                   	push   %esi
+  803b55:	6a 00                	push   $0x0
+  803b57:	e8 7f d2 ff ff       	call   800ddb <sys_page_map>
+  803b5c:	89 c3                	mov    %eax,%ebx
+  803b5e:	83 c4 20             	add    $0x20,%esp
+  803b61:	85 c0                	test   %eax,%eax
+  803b63:	78 4e                	js     803bb3 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803b65:	a1 7c 62 80 00       	mov    0x80627c,%eax
+  803b6a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803b6d:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803b6f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803b72:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803b79:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803b7c:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803b7e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803b81:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803b88:	83 ec 0c             	sub    $0xc,%esp
+  803b8b:	ff 75 f4             	push   -0xc(%ebp)
+  803b8e:	e8 9e de ff ff       	call   801a31 <fd2num>
+  803b93:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803b96:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803b98:	83 c4 04             	add    $0x4,%esp
+  803b9b:	ff 75 f0             	push   -0x10(%ebp)
+  803b9e:	e8 8e de ff ff       	call   801a31 <fd2num>
+  803ba3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803ba6:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803ba9:	83 c4 10             	add    $0x10,%esp
+  803bac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803bb1:	eb 2e                	jmp    803be1 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803bb3:	83 ec 08             	sub    $0x8,%esp
+  803bb6:	56                   	push   %esi
+  803bb7:	6a 00                	push   $0x0
+  803bb9:	e8 69 d2 ff ff       	call   800e27 <sys_page_unmap>
+  803bbe:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803bc1:	83 ec 08             	sub    $0x8,%esp
+  803bc4:	ff 75 f0             	push   -0x10(%ebp)
+  803bc7:	6a 00                	push   $0x0
+  803bc9:	e8 59 d2 ff ff       	call   800e27 <sys_page_unmap>
+  803bce:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803bd1:	83 ec 08             	sub    $0x8,%esp
+  803bd4:	ff 75 f4             	push   -0xc(%ebp)
+  803bd7:	6a 00                	push   $0x0
+  803bd9:	e8 49 d2 ff ff       	call   800e27 <sys_page_unmap>
+  803bde:	83 c4 10             	add    $0x10,%esp
+}
+  803be1:	89 d8                	mov    %ebx,%eax
+  803be3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803be6:	5b                   	pop    %ebx
+  803be7:	5e                   	pop    %esi
+  803be8:	5d                   	pop    %ebp
+  803be9:	c3                   	ret
+
+00803bea <pipeisclosed>:
+{
+  803bea:	55                   	push   %ebp
+  803beb:	89 e5                	mov    %esp,%ebp
+  803bed:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803bf0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803bf3:	50                   	push   %eax
+  803bf4:	ff 75 08             	push   0x8(%ebp)
+  803bf7:	e8 b2 de ff ff       	call   801aae <fd_lookup>
+  803bfc:	83 c4 10             	add    $0x10,%esp
+  803bff:	85 c0                	test   %eax,%eax
+  803c01:	78 18                	js     803c1b <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803c03:	83 ec 0c             	sub    $0xc,%esp
+  803c06:	ff 75 f4             	push   -0xc(%ebp)
+  803c09:	e8 33 de ff ff       	call   801a41 <fd2data>
+  803c0e:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803c10:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803c13:	e8 27 fc ff ff       	call   80383f <_pipeisclosed>
+  803c18:	83 c4 10             	add    $0x10,%esp
+}
+  803c1b:	c9                   	leave
+  803c1c:	c3                   	ret
+
+00803c1d <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  803c1d:	55                   	push   %ebp
+  803c1e:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  803c20:	8b 45 08             	mov    0x8(%ebp),%eax
+  803c23:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803c29:	5d                   	pop    %ebp
+  803c2a:	c3                   	ret
+
+00803c2b <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  803c2b:	55                   	push   %ebp
+  803c2c:	89 e5                	mov    %esp,%ebp
+  803c2e:	56                   	push   %esi
+  803c2f:	53                   	push   %ebx
+  803c30:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803c33:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c38:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803c3d:	89 d0                	mov    %edx,%eax
+  803c3f:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  803c43:	85 c0                	test   %eax,%eax
+  803c45:	74 2d                	je     803c74 <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  803c47:	83 f8 02             	cmp    $0x2,%eax
+  803c4a:	74 08                	je     803c54 <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  803c4c:	b8 02 00 00 00       	mov    $0x2,%eax
+  803c51:	f0 87 03             	lock xchg %eax,(%ebx)
+  803c54:	be 02 00 00 00       	mov    $0x2,%esi
+  803c59:	eb 15                	jmp    803c70 <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  803c5b:	83 ec 04             	sub    $0x4,%esp
+  803c5e:	6a 00                	push   $0x0
+  803c60:	6a 02                	push   $0x2
+  803c62:	53                   	push   %ebx
+  803c63:	e8 3b d4 ff ff       	call   8010a3 <sys_futex_wait>
+  803c68:	89 f0                	mov    %esi,%eax
+  803c6a:	f0 87 03             	lock xchg %eax,(%ebx)
+  803c6d:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  803c70:	85 c0                	test   %eax,%eax
+  803c72:	75 e7                	jne    803c5b <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  803c74:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803c77:	5b                   	pop    %ebx
+  803c78:	5e                   	pop    %esi
+  803c79:	5d                   	pop    %ebp
+  803c7a:	c3                   	ret
+
+00803c7b <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  803c7b:	55                   	push   %ebp
+  803c7c:	89 e5                	mov    %esp,%ebp
+  803c7e:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803c81:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c86:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803c8b:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  803c8f:	f7 d8                	neg    %eax
+  803c91:	19 c0                	sbb    %eax,%eax
+  803c93:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  803c96:	5d                   	pop    %ebp
+  803c97:	c3                   	ret
+
+00803c98 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  803c98:	55                   	push   %ebp
+  803c99:	89 e5                	mov    %esp,%ebp
+  803c9b:	83 ec 08             	sub    $0x8,%esp
+  803c9e:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  803ca1:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ca6:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  803ca9:	83 f8 02             	cmp    $0x2,%eax
+  803cac:	74 02                	je     803cb0 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  803cae:	c9                   	leave
+  803caf:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  803cb0:	83 ec 08             	sub    $0x8,%esp
+  803cb3:	6a 01                	push   $0x1
+  803cb5:	52                   	push   %edx
+  803cb6:	e8 17 d4 ff ff       	call   8010d2 <sys_futex_wake>
+  803cbb:	83 c4 10             	add    $0x10,%esp
+}
+  803cbe:	eb ee                	jmp    803cae <mutex_unlock+0x16>
+
+00803cc0 <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  803cc0:	55                   	push   %ebp
+  803cc1:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  803cc3:	8b 45 08             	mov    0x8(%ebp),%eax
+  803cc6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803ccc:	5d                   	pop    %ebp
+  803ccd:	c3                   	ret
+
+00803cce <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  803cce:	55                   	push   %ebp
+  803ccf:	89 e5                	mov    %esp,%ebp
+  803cd1:	57                   	push   %edi
+  803cd2:	56                   	push   %esi
+  803cd3:	53                   	push   %ebx
+  803cd4:	83 ec 18             	sub    $0x18,%esp
+  803cd7:	8b 75 08             	mov    0x8(%ebp),%esi
+  803cda:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  803cdd:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  803cdf:	53                   	push   %ebx
+  803ce0:	e8 b3 ff ff ff       	call   803c98 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  803ce5:	83 c4 0c             	add    $0xc,%esp
+  803ce8:	ff 75 10             	push   0x10(%ebp)
+  803ceb:	57                   	push   %edi
+  803cec:	56                   	push   %esi
+  803ced:	e8 b1 d3 ff ff       	call   8010a3 <sys_futex_wait>
+  803cf2:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  803cf4:	83 c4 10             	add    $0x10,%esp
+  803cf7:	be 02 00 00 00       	mov    $0x2,%esi
+  803cfc:	eb 10                	jmp    803d0e <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  803cfe:	83 ec 04             	sub    $0x4,%esp
+  803d01:	6a 00                	push   $0x0
+  803d03:	6a 02                	push   $0x2
+  803d05:	53                   	push   %ebx
+  803d06:	e8 98 d3 ff ff       	call   8010a3 <sys_futex_wait>
+  803d0b:	83 c4 10             	add    $0x10,%esp
+  803d0e:	89 f0                	mov    %esi,%eax
+  803d10:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  803d13:	85 c0                	test   %eax,%eax
+  803d15:	75 e7                	jne    803cfe <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  803d17:	83 ff ec             	cmp    $0xffffffec,%edi
+  803d1a:	74 05                	je     803d21 <cond_timedwait+0x53>
+  803d1c:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803d21:	89 f8                	mov    %edi,%eax
+  803d23:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d26:	5b                   	pop    %ebx
+  803d27:	5e                   	pop    %esi
+  803d28:	5f                   	pop    %edi
+  803d29:	5d                   	pop    %ebp
+  803d2a:	c3                   	ret
+
+00803d2b <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  803d2b:	55                   	push   %ebp
+  803d2c:	89 e5                	mov    %esp,%ebp
+  803d2e:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  803d31:	6a 00                	push   $0x0
+  803d33:	ff 75 0c             	push   0xc(%ebp)
+  803d36:	ff 75 08             	push   0x8(%ebp)
+  803d39:	e8 90 ff ff ff       	call   803cce <cond_timedwait>
+}
+  803d3e:	83 c4 10             	add    $0x10,%esp
+  803d41:	c9                   	leave
+  803d42:	c3                   	ret
+
+00803d43 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  803d43:	55                   	push   %ebp
+  803d44:	89 e5                	mov    %esp,%ebp
+  803d46:	83 ec 10             	sub    $0x10,%esp
+  803d49:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  803d4c:	ba 01 00 00 00       	mov    $0x1,%edx
+  803d51:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  803d55:	6a 01                	push   $0x1
+  803d57:	50                   	push   %eax
+  803d58:	e8 75 d3 ff ff       	call   8010d2 <sys_futex_wake>
+}
+  803d5d:	83 c4 10             	add    $0x10,%esp
+  803d60:	c9                   	leave
+  803d61:	c3                   	ret
+
+00803d62 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  803d62:	55                   	push   %ebp
+  803d63:	89 e5                	mov    %esp,%ebp
+  803d65:	83 ec 10             	sub    $0x10,%esp
+  803d68:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d6b:	ba 01 00 00 00       	mov    $0x1,%edx
+  803d70:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  803d74:	68 00 04 00 00       	push   $0x400
+  803d79:	50                   	push   %eax
+  803d7a:	e8 53 d3 ff ff       	call   8010d2 <sys_futex_wake>
+}
+  803d7f:	83 c4 10             	add    $0x10,%esp
+  803d82:	c9                   	leave
+  803d83:	c3                   	ret
+
+00803d84 <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  803d84:	55                   	push   %ebp
+  803d85:	89 e5                	mov    %esp,%ebp
+  803d87:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  803d8a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803d8d:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  803d8f:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  803d96:	5d                   	pop    %ebp
+  803d97:	c3                   	ret
+
+00803d98 <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  803d98:	55                   	push   %ebp
+  803d99:	89 e5                	mov    %esp,%ebp
+  803d9b:	53                   	push   %ebx
+  803d9c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  803d9f:	8b 11                	mov    (%ecx),%edx
+  803da1:	85 d2                	test   %edx,%edx
+  803da3:	74 14                	je     803db9 <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  803da5:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803da8:	89 d0                	mov    %edx,%eax
+  803daa:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  803dae:	39 c2                	cmp    %eax,%edx
+  803db0:	75 ed                	jne    803d9f <sem_trywait+0x7>
+			return 0;
+  803db2:	b8 00 00 00 00       	mov    $0x0,%eax
+  803db7:	eb 05                	jmp    803dbe <sem_trywait+0x26>
+	return -E_AGAIN;
+  803db9:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  803dbe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803dc1:	c9                   	leave
+  803dc2:	c3                   	ret
+
+00803dc3 <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  803dc3:	55                   	push   %ebp
+  803dc4:	89 e5                	mov    %esp,%ebp
+  803dc6:	57                   	push   %edi
+  803dc7:	56                   	push   %esi
+  803dc8:	53                   	push   %ebx
+  803dc9:	83 ec 1c             	sub    $0x1c,%esp
+  803dcc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803dcf:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  803dd2:	e8 44 d2 ff ff       	call   80101b <sys_time_msec>
+  803dd7:	01 f8                	add    %edi,%eax
+  803dd9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  803ddc:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  803de1:	eb 28                	jmp    803e0b <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  803de3:	b8 01 00 00 00       	mov    $0x1,%eax
+  803de8:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  803ded:	83 ec 04             	sub    $0x4,%esp
+  803df0:	56                   	push   %esi
+  803df1:	6a 00                	push   $0x0
+  803df3:	53                   	push   %ebx
+  803df4:	e8 aa d2 ff ff       	call   8010a3 <sys_futex_wait>
+  803df9:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  803dfe:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  803e03:	83 c4 10             	add    $0x10,%esp
+  803e06:	83 f8 ec             	cmp    $0xffffffec,%eax
+  803e09:	74 2e                	je     803e39 <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  803e0b:	83 ec 0c             	sub    $0xc,%esp
+  803e0e:	53                   	push   %ebx
+  803e0f:	e8 84 ff ff ff       	call   803d98 <sem_trywait>
+  803e14:	83 c4 10             	add    $0x10,%esp
+  803e17:	85 c0                	test   %eax,%eax
+  803e19:	79 19                	jns    803e34 <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  803e1b:	85 ff                	test   %edi,%edi
+  803e1d:	74 c4                	je     803de3 <sem_timedwait+0x20>
+  803e1f:	e8 f7 d1 ff ff       	call   80101b <sys_time_msec>
+  803e24:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803e27:	29 c6                	sub    %eax,%esi
+  803e29:	85 f6                	test   %esi,%esi
+  803e2b:	7f b6                	jg     803de3 <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  803e2d:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  803e32:	eb 05                	jmp    803e39 <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  803e34:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e39:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e3c:	5b                   	pop    %ebx
+  803e3d:	5e                   	pop    %esi
+  803e3e:	5f                   	pop    %edi
+  803e3f:	5d                   	pop    %ebp
+  803e40:	c3                   	ret
+
+00803e41 <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  803e41:	55                   	push   %ebp
+  803e42:	89 e5                	mov    %esp,%ebp
+  803e44:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  803e47:	6a 00                	push   $0x0
+  803e49:	ff 75 08             	push   0x8(%ebp)
+  803e4c:	e8 72 ff ff ff       	call   803dc3 <sem_timedwait>
+}
+  803e51:	83 c4 10             	add    $0x10,%esp
+  803e54:	c9                   	leave
+  803e55:	c3                   	ret
+
+00803e56 <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  803e56:	55                   	push   %ebp
+  803e57:	89 e5                	mov    %esp,%ebp
+  803e59:	83 ec 08             	sub    $0x8,%esp
+  803e5c:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e5f:	ba 01 00 00 00       	mov    $0x1,%edx
+  803e64:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  803e68:	8b 50 04             	mov    0x4(%eax),%edx
+  803e6b:	85 d2                	test   %edx,%edx
+  803e6d:	75 02                	jne    803e71 <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  803e6f:	c9                   	leave
+  803e70:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  803e71:	83 ec 08             	sub    $0x8,%esp
+  803e74:	6a 01                	push   $0x1
+  803e76:	50                   	push   %eax
+  803e77:	e8 56 d2 ff ff       	call   8010d2 <sys_futex_wake>
+  803e7c:	83 c4 10             	add    $0x10,%esp
+}
+  803e7f:	eb ee                	jmp    803e6f <sem_post+0x19>
+
+00803e81 <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  803e81:	55                   	push   %ebp
+  803e82:	89 e5                	mov    %esp,%ebp
+  803e84:	57                   	push   %edi
+  803e85:	56                   	push   %esi
+  803e86:	53                   	push   %ebx
+  803e87:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  803e8a:	68 20 70 80 00       	push   $0x807020
+  803e8f:	e8 97 fd ff ff       	call   803c2b <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  803e94:	a1 44 70 80 00       	mov    0x807044,%eax
+  803e99:	83 c4 10             	add    $0x10,%esp
+  803e9c:	85 c0                	test   %eax,%eax
+  803e9e:	75 19                	jne    803eb9 <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  803ea0:	a1 c0 72 80 00       	mov    0x8072c0,%eax
+  803ea5:	8b 00                	mov    (%eax),%eax
+  803ea7:	8b 40 48             	mov    0x48(%eax),%eax
+  803eaa:	a3 40 70 80 00       	mov    %eax,0x807040
+		threads[0].th_state = PTH_RUNNING;
+  803eaf:	c7 05 44 70 80 00 01 	movl   $0x1,0x807044
+  803eb6:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803eb9:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  803ebe:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803ec1:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803ec8:	8b 40 04             	mov    0x4(%eax),%eax
+  803ecb:	85 c0                	test   %eax,%eax
+  803ecd:	0f 84 e4 00 00 00    	je     803fb7 <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803ed3:	83 c3 01             	add    $0x1,%ebx
+  803ed6:	83 fb 20             	cmp    $0x20,%ebx
+  803ed9:	75 e3                	jne    803ebe <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  803edb:	83 ec 0c             	sub    $0xc,%esp
+  803ede:	68 20 70 80 00       	push   $0x807020
+  803ee3:	e8 b0 fd ff ff       	call   803c98 <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  803ee8:	83 c4 10             	add    $0x10,%esp
+  803eeb:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  803ef0:	e9 b8 00 00 00       	jmp    803fad <pthread_create+0x12c>
+  803ef5:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  803ef8:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  803efb:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  803efd:	39 f3                	cmp    %esi,%ebx
+  803eff:	73 16                	jae    803f17 <pthread_create+0x96>
+		va -= PGSIZE;
+  803f01:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  803f07:	83 ec 08             	sub    $0x8,%esp
+  803f0a:	56                   	push   %esi
+  803f0b:	6a 00                	push   $0x0
+  803f0d:	e8 15 cf ff ff       	call   800e27 <sys_page_unmap>
+  803f12:	83 c4 10             	add    $0x10,%esp
+  803f15:	eb e6                	jmp    803efd <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  803f17:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803f1a:	83 ec 08             	sub    $0x8,%esp
+  803f1d:	ff 75 e4             	push   -0x1c(%ebp)
+  803f20:	6a 00                	push   $0x0
+  803f22:	e8 00 cf ff ff       	call   800e27 <sys_page_unmap>
+	return r;
+  803f27:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  803f2a:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803f2d:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803f34:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  803f3b:	eb 70                	jmp    803fad <pthread_create+0x12c>
+	th->th_fn = fn;
+  803f3d:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803f40:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803f47:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803f4a:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  803f4d:	8b 55 10             	mov    0x10(%ebp),%edx
+  803f50:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  803f53:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  803f5a:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  803f5f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803f62:	29 c8                	sub    %ecx,%eax
+  803f64:	85 db                	test   %ebx,%ebx
+  803f66:	0f 44 05 c0 72 80 00 	cmove  0x8072c0,%eax
+	*--esp = t;
+  803f6d:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  803f70:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803f77:	83 ec 04             	sub    $0x4,%esp
+  803f7a:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803f7f:	29 ca                	sub    %ecx,%edx
+  803f81:	52                   	push   %edx
+	*--esp = 0;
+  803f82:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803f85:	50                   	push   %eax
+  803f86:	68 de 41 80 00       	push   $0x8041de
+  803f8b:	e8 e7 d1 ff ff       	call   801177 <sys_thread_create>
+  803f90:	89 c7                	mov    %eax,%edi
+  803f92:	83 c4 10             	add    $0x10,%esp
+  803f95:	85 c0                	test   %eax,%eax
+  803f97:	78 91                	js     803f2a <pthread_create+0xa9>
+	th->th_env = id;
+  803f99:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803f9c:	89 3c 85 40 70 80 00 	mov    %edi,0x807040(,%eax,4)
+	*tp = t;
+  803fa3:	8b 45 08             	mov    0x8(%ebp),%eax
+  803fa6:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  803fa8:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803fad:	89 f8                	mov    %edi,%eax
+  803faf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803fb2:	5b                   	pop    %ebx
+  803fb3:	5e                   	pop    %esi
+  803fb4:	5f                   	pop    %edi
+  803fb5:	5d                   	pop    %ebp
+  803fb6:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  803fb7:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803fba:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803fc1:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  803fc8:	83 ec 0c             	sub    $0xc,%esp
+  803fcb:	68 20 70 80 00       	push   $0x807020
+  803fd0:	e8 c3 fc ff ff       	call   803c98 <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  803fd5:	89 d9                	mov    %ebx,%ecx
+  803fd7:	c1 e1 10             	shl    $0x10,%ecx
+  803fda:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  803fdd:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  803fe2:	29 c8                	sub    %ecx,%eax
+  803fe4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  803fe7:	c1 e8 16             	shr    $0x16,%eax
+  803fea:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803ff1:	83 c4 10             	add    $0x10,%esp
+  803ff4:	a8 01                	test   $0x1,%al
+  803ff6:	74 15                	je     80400d <pthread_create+0x18c>
+  803ff8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803ffb:	c1 e8 0c             	shr    $0xc,%eax
+  803ffe:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  804005:	a8 01                	test   $0x1,%al
+  804007:	0f 85 30 ff ff ff    	jne    803f3d <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  80400d:	83 ec 04             	sub    $0x4,%esp
+  804010:	6a 07                	push   $0x7
+  804012:	ff 75 e4             	push   -0x1c(%ebp)
+  804015:	6a 00                	push   $0x0
+  804017:	e8 72 cd ff ff       	call   800d8e <sys_page_alloc>
+  80401c:	89 c7                	mov    %eax,%edi
+  80401e:	83 c4 10             	add    $0x10,%esp
+  804021:	85 c0                	test   %eax,%eax
+  804023:	0f 88 01 ff ff ff    	js     803f2a <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  804029:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  80402e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  804031:	29 d0                	sub    %edx,%eax
+  804033:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  804036:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  804038:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  80403d:	29 d0                	sub    %edx,%eax
+  80403f:	89 c7                	mov    %eax,%edi
+  804041:	39 fe                	cmp    %edi,%esi
+  804043:	0f 83 f4 fe ff ff    	jae    803f3d <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  804049:	83 ec 04             	sub    $0x4,%esp
+  80404c:	6a 07                	push   $0x7
+  80404e:	56                   	push   %esi
+  80404f:	6a 00                	push   $0x0
+  804051:	e8 38 cd ff ff       	call   800d8e <sys_page_alloc>
+  804056:	83 c4 10             	add    $0x10,%esp
+  804059:	85 c0                	test   %eax,%eax
+  80405b:	0f 88 94 fe ff ff    	js     803ef5 <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  804061:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  804067:	eb d8                	jmp    804041 <pthread_create+0x1c0>
+
+00804069 <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  804069:	55                   	push   %ebp
+  80406a:	89 e5                	mov    %esp,%ebp
+  80406c:	57                   	push   %edi
+  80406d:	56                   	push   %esi
+  80406e:	53                   	push   %ebx
+  80406f:	83 ec 0c             	sub    $0xc,%esp
+  804072:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  804075:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  804078:	83 f8 1e             	cmp    $0x1e,%eax
+  80407b:	0f 87 c7 00 00 00    	ja     804148 <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  804081:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804083:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804089:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80408e:	77 12                	ja     8040a2 <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804090:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804095:	29 d0                	sub    %edx,%eax
+  804097:	c1 e8 10             	shr    $0x10,%eax
+  80409a:	39 c3                	cmp    %eax,%ebx
+  80409c:	0f 84 ad 00 00 00    	je     80414f <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  8040a2:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8040a5:	8d 3c 85 44 70 80 00 	lea    0x807044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  8040ac:	8d 34 85 40 70 80 00 	lea    0x807040(,%eax,4),%esi
+  8040b3:	eb 10                	jmp    8040c5 <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  8040b5:	83 ec 04             	sub    $0x4,%esp
+  8040b8:	6a 00                	push   $0x0
+  8040ba:	6a 01                	push   $0x1
+  8040bc:	57                   	push   %edi
+  8040bd:	e8 e1 cf ff ff       	call   8010a3 <sys_futex_wait>
+  8040c2:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  8040c5:	8b 46 04             	mov    0x4(%esi),%eax
+  8040c8:	83 f8 01             	cmp    $0x1,%eax
+  8040cb:	74 e8                	je     8040b5 <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  8040cd:	83 f8 02             	cmp    $0x2,%eax
+  8040d0:	0f 85 80 00 00 00    	jne    804156 <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  8040d6:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  8040d9:	c1 e6 02             	shl    $0x2,%esi
+  8040dc:	eb 05                	jmp    8040e3 <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  8040de:	e8 7f cc ff ff       	call   800d62 <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  8040e3:	8b 8e 40 70 80 00    	mov    0x807040(%esi),%ecx
+  8040e9:	89 ca                	mov    %ecx,%edx
+  8040eb:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8040f1:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8040f4:	c1 e0 04             	shl    $0x4,%eax
+  8040f7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8040fc:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  8040ff:	39 c1                	cmp    %eax,%ecx
+  804101:	75 12                	jne    804115 <pthread_join+0xac>
+  804103:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804106:	c1 e0 04             	shl    $0x4,%eax
+  804109:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80410e:	8b 40 54             	mov    0x54(%eax),%eax
+  804111:	85 c0                	test   %eax,%eax
+  804113:	75 c9                	jne    8040de <pthread_join+0x75>
+	if (ret_store)
+  804115:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  804119:	74 0f                	je     80412a <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  80411b:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80411e:	8b 04 85 50 70 80 00 	mov    0x807050(,%eax,4),%eax
+  804125:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  804128:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  80412a:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80412d:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  804134:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  80413b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804140:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804143:	5b                   	pop    %ebx
+  804144:	5e                   	pop    %esi
+  804145:	5f                   	pop    %edi
+  804146:	5d                   	pop    %ebp
+  804147:	c3                   	ret
+		return -E_INVAL;
+  804148:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80414d:	eb f1                	jmp    804140 <pthread_join+0xd7>
+  80414f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804154:	eb ea                	jmp    804140 <pthread_join+0xd7>
+		return -E_INVAL;
+  804156:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80415b:	eb e3                	jmp    804140 <pthread_join+0xd7>
+
+0080415d <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  80415d:	55                   	push   %ebp
+  80415e:	89 e5                	mov    %esp,%ebp
+  804160:	53                   	push   %ebx
+  804161:	83 ec 04             	sub    $0x4,%esp
+  804164:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804166:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80416c:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804171:	77 0c                	ja     80417f <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804173:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804178:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  80417a:	c1 e8 10             	shr    $0x10,%eax
+  80417d:	75 0a                	jne    804189 <pthread_exit+0x2c>
+		exit();
+  80417f:	e8 e5 c0 ff ff       	call   800269 <exit>
+  804184:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  804189:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  804190:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  804193:	8d 0c 8d 40 70 80 00 	lea    0x807040(,%ecx,4),%ecx
+  80419a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80419d:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  8041a0:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  8041a7:	83 ec 08             	sub    $0x8,%esp
+  8041aa:	6a 20                	push   $0x20
+  8041ac:	01 c2                	add    %eax,%edx
+  8041ae:	8d 04 95 44 70 80 00 	lea    0x807044(,%edx,4),%eax
+  8041b5:	50                   	push   %eax
+  8041b6:	e8 17 cf ff ff       	call   8010d2 <sys_futex_wake>
+	sys_env_destroy(0);
+  8041bb:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8041c2:	e8 24 cb ff ff       	call   800ceb <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  8041c7:	83 c4 0c             	add    $0xc,%esp
+  8041ca:	68 aa 50 80 00       	push   $0x8050aa
+  8041cf:	68 a5 00 00 00       	push   $0xa5
+  8041d4:	68 c4 50 80 00       	push   $0x8050c4
+  8041d9:	e8 b3 c0 ff ff       	call   800291 <_panic>
+
+008041de <pthread_start>:
+{
+  8041de:	55                   	push   %ebp
+  8041df:	89 e5                	mov    %esp,%ebp
+  8041e1:	53                   	push   %ebx
+  8041e2:	83 ec 04             	sub    $0x4,%esp
+  8041e5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  8041e8:	e8 49 cb ff ff       	call   800d36 <sys_getenvid>
+  8041ed:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  8041f2:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+	if (t == 0)
+  8041f8:	85 db                	test   %ebx,%ebx
+  8041fa:	74 0c                	je     804208 <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8041fc:	89 d9                	mov    %ebx,%ecx
+  8041fe:	c1 e1 10             	shl    $0x10,%ecx
+  804201:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804206:	29 ca                	sub    %ecx,%edx
+  804208:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80420b:	c1 e0 04             	shl    $0x4,%eax
+  80420e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804213:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  804215:	83 ec 0c             	sub    $0xc,%esp
+  804218:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  80421f:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  804222:	ff 34 95 4c 70 80 00 	push   0x80704c(,%edx,4)
+  804229:	ff 14 95 48 70 80 00 	call   *0x807048(,%edx,4)
+  804230:	89 04 24             	mov    %eax,(%esp)
+  804233:	e8 25 ff ff ff       	call   80415d <pthread_exit>
+
+00804238 <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  804238:	55                   	push   %ebp
+  804239:	89 e5                	mov    %esp,%ebp
+  80423b:	57                   	push   %edi
+  80423c:	56                   	push   %esi
+  80423d:	53                   	push   %ebx
+  80423e:	83 ec 1c             	sub    $0x1c,%esp
+  804241:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804243:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  804249:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804250:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804255:	77 0d                	ja     804264 <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804257:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80425c:	29 d0                	sub    %edx,%eax
+  80425e:	c1 e8 10             	shr    $0x10,%eax
+  804261:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  804264:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804269:	eb 2f                	jmp    80429a <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  80426b:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  804271:	8b 01                	mov    (%ecx),%eax
+  804273:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  804276:	39 c2                	cmp    %eax,%edx
+  804278:	75 14                	jne    80428e <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  80427a:	83 ec 0c             	sub    $0xc,%esp
+  80427d:	57                   	push   %edi
+  80427e:	e8 68 ca ff ff       	call   800ceb <sys_env_destroy>
+  804283:	83 c4 10             	add    $0x10,%esp
+  804286:	85 c0                	test   %eax,%eax
+  804288:	0f 88 97 00 00 00    	js     804325 <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  80428e:	83 c3 01             	add    $0x1,%ebx
+  804291:	83 fb 20             	cmp    $0x20,%ebx
+  804294:	0f 84 d2 00 00 00    	je     80436c <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  80429a:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  80429d:	74 ef                	je     80428e <pthread_kill_others+0x56>
+  80429f:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8042a2:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  8042a9:	8b 40 04             	mov    0x4(%eax),%eax
+  8042ac:	83 f8 01             	cmp    $0x1,%eax
+  8042af:	75 dd                	jne    80428e <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  8042b1:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8042b4:	8b 3c 85 40 70 80 00 	mov    0x807040(,%eax,4),%edi
+  8042bb:	89 fe                	mov    %edi,%esi
+  8042bd:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  8042c3:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  8042c6:	c1 e0 04             	shl    $0x4,%eax
+  8042c9:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8042ce:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  8042d1:	39 c7                	cmp    %eax,%edi
+  8042d3:	75 b9                	jne    80428e <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  8042d5:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  8042d8:	c1 e0 04             	shl    $0x4,%eax
+  8042db:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8042e0:	8b 40 54             	mov    0x54(%eax),%eax
+  8042e3:	85 c0                	test   %eax,%eax
+  8042e5:	74 a7                	je     80428e <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  8042e7:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  8042ea:	c1 e0 04             	shl    $0x4,%eax
+  8042ed:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  8042f3:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8042f5:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  8042fb:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804300:	0f 87 65 ff ff ff    	ja     80426b <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804306:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80430b:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  80430d:	c1 e8 10             	shr    $0x10,%eax
+  804310:	0f 84 55 ff ff ff    	je     80426b <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804316:	c1 e0 10             	shl    $0x10,%eax
+  804319:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80431e:	29 c1                	sub    %eax,%ecx
+  804320:	e9 4c ff ff ff       	jmp    804271 <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  804325:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  804328:	c1 e2 04             	shl    $0x4,%edx
+  80432b:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  804331:	8b 52 48             	mov    0x48(%edx),%edx
+  804334:	39 fa                	cmp    %edi,%edx
+  804336:	0f 85 52 ff ff ff    	jne    80428e <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  80433c:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  80433f:	c1 e2 04             	shl    $0x4,%edx
+  804342:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  804348:	8b 52 54             	mov    0x54(%edx),%edx
+  80434b:	85 d2                	test   %edx,%edx
+  80434d:	0f 84 3b ff ff ff    	je     80428e <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  804353:	83 ec 0c             	sub    $0xc,%esp
+  804356:	50                   	push   %eax
+  804357:	57                   	push   %edi
+  804358:	68 d4 50 80 00       	push   $0x8050d4
+  80435d:	68 bb 00 00 00       	push   $0xbb
+  804362:	68 c4 50 80 00       	push   $0x8050c4
+  804367:	e8 25 bf ff ff       	call   800291 <_panic>
+	}
+}
+  80436c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80436f:	5b                   	pop    %ebx
+  804370:	5e                   	pop    %esi
+  804371:	5f                   	pop    %edi
+  804372:	5d                   	pop    %ebp
+  804373:	c3                   	ret
+
+00804374 <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  804374:	55                   	push   %ebp
+  804375:	89 e5                	mov    %esp,%ebp
+  804377:	53                   	push   %ebx
+  804378:	83 ec 04             	sub    $0x4,%esp
+  80437b:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80437d:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  804383:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  804389:	0f 87 85 00 00 00    	ja     804414 <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80438f:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  804394:	29 c3                	sub    %eax,%ebx
+  804396:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  804399:	83 ec 04             	sub    $0x4,%esp
+  80439c:	68 80 02 00 00       	push   $0x280
+  8043a1:	6a 00                	push   $0x0
+  8043a3:	68 40 70 80 00       	push   $0x807040
+  8043a8:	e8 f4 c6 ff ff       	call   800aa1 <memset>
+	threads_mu.m_state = 0;
+  8043ad:	c7 05 20 70 80 00 00 	movl   $0x0,0x807020
+  8043b4:	00 00 00 
+	if (self != 0) {
+  8043b7:	83 c4 10             	add    $0x10,%esp
+  8043ba:	85 db                	test   %ebx,%ebx
+  8043bc:	74 51                	je     80440f <pthread_fork_child+0x9b>
+  8043be:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8043c0:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8043c6:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8043cb:	77 18                	ja     8043e5 <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8043cd:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8043d2:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8043d4:	c1 e8 10             	shr    $0x10,%eax
+  8043d7:	74 0c                	je     8043e5 <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8043d9:	c1 e0 10             	shl    $0x10,%eax
+  8043dc:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8043e1:	29 c2                	sub    %eax,%edx
+  8043e3:	eb 06                	jmp    8043eb <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  8043e5:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		threads[self].th_env = thisenv->env_id;
+  8043eb:	8b 02                	mov    (%edx),%eax
+  8043ed:	8b 48 48             	mov    0x48(%eax),%ecx
+  8043f0:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  8043f7:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  8043fa:	89 0c 95 40 70 80 00 	mov    %ecx,0x807040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  804401:	8d 04 95 40 70 80 00 	lea    0x807040(,%edx,4),%eax
+  804408:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  80440f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804412:	c9                   	leave
+  804413:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  804414:	83 ec 04             	sub    $0x4,%esp
+  804417:	68 80 02 00 00       	push   $0x280
+  80441c:	6a 00                	push   $0x0
+  80441e:	68 40 70 80 00       	push   $0x807040
+  804423:	e8 79 c6 ff ff       	call   800aa1 <memset>
+	threads_mu.m_state = 0;
+  804428:	c7 05 20 70 80 00 00 	movl   $0x0,0x807020
+  80442f:	00 00 00 
+  804432:	83 c4 10             	add    $0x10,%esp
+  804435:	eb d8                	jmp    80440f <pthread_fork_child+0x9b>
+
+00804437 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  804437:	b8 00 00 00 00       	mov    $0x0,%eax
+  80443c:	c3                   	ret
+
+0080443d <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80443d:	55                   	push   %ebp
+  80443e:	89 e5                	mov    %esp,%ebp
+  804440:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  804443:	68 f9 50 80 00       	push   $0x8050f9
+  804448:	ff 75 0c             	push   0xc(%ebp)
+  80444b:	e8 00 c5 ff ff       	call   800950 <strcpy>
+	return 0;
+}
+  804450:	b8 00 00 00 00       	mov    $0x0,%eax
+  804455:	c9                   	leave
+  804456:	c3                   	ret
+
+00804457 <devcons_write>:
+{
+  804457:	55                   	push   %ebp
+  804458:	89 e5                	mov    %esp,%ebp
+  80445a:	57                   	push   %edi
+  80445b:	56                   	push   %esi
+  80445c:	53                   	push   %ebx
+  80445d:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  804463:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  804468:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80446e:	eb 2e                	jmp    80449e <devcons_write+0x47>
+		m = n - tot;
+  804470:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804473:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  804475:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80447a:	39 c3                	cmp    %eax,%ebx
+  80447c:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80447f:	83 ec 04             	sub    $0x4,%esp
+  804482:	53                   	push   %ebx
+  804483:	89 f0                	mov    %esi,%eax
+  804485:	03 45 0c             	add    0xc(%ebp),%eax
+  804488:	50                   	push   %eax
+  804489:	57                   	push   %edi
+  80448a:	e8 47 c6 ff ff       	call   800ad6 <memmove>
+		sys_cputs(buf, m);
+  80448f:	83 c4 08             	add    $0x8,%esp
+  804492:	53                   	push   %ebx
+  804493:	57                   	push   %edi
+  804494:	e8 fb c7 ff ff       	call   800c94 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  804499:	01 de                	add    %ebx,%esi
+  80449b:	83 c4 10             	add    $0x10,%esp
+  80449e:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8044a1:	72 cd                	jb     804470 <devcons_write+0x19>
+}
+  8044a3:	89 f0                	mov    %esi,%eax
+  8044a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8044a8:	5b                   	pop    %ebx
+  8044a9:	5e                   	pop    %esi
+  8044aa:	5f                   	pop    %edi
+  8044ab:	5d                   	pop    %ebp
+  8044ac:	c3                   	ret
+
+008044ad <devcons_read>:
+{
+  8044ad:	55                   	push   %ebp
+  8044ae:	89 e5                	mov    %esp,%ebp
+  8044b0:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8044b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044b8:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8044bc:	75 07                	jne    8044c5 <devcons_read+0x18>
+  8044be:	eb 1f                	jmp    8044df <devcons_read+0x32>
+		sys_yield();
+  8044c0:	e8 9d c8 ff ff       	call   800d62 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8044c5:	e8 f5 c7 ff ff       	call   800cbf <sys_cgetc>
+  8044ca:	85 c0                	test   %eax,%eax
+  8044cc:	74 f2                	je     8044c0 <devcons_read+0x13>
+	if (c < 0)
+  8044ce:	78 0f                	js     8044df <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8044d0:	83 f8 04             	cmp    $0x4,%eax
+  8044d3:	74 0c                	je     8044e1 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8044d5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8044d8:	88 02                	mov    %al,(%edx)
+	return 1;
+  8044da:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8044df:	c9                   	leave
+  8044e0:	c3                   	ret
+		return 0;
+  8044e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044e6:	eb f7                	jmp    8044df <devcons_read+0x32>
+
+008044e8 <cputchar>:
+{
+  8044e8:	55                   	push   %ebp
+  8044e9:	89 e5                	mov    %esp,%ebp
+  8044eb:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8044ee:	8b 45 08             	mov    0x8(%ebp),%eax
+  8044f1:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8044f4:	6a 01                	push   $0x1
+  8044f6:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8044f9:	50                   	push   %eax
+  8044fa:	e8 95 c7 ff ff       	call   800c94 <sys_cputs>
+}
+  8044ff:	83 c4 10             	add    $0x10,%esp
+  804502:	c9                   	leave
+  804503:	c3                   	ret
+
+00804504 <getchar>:
+{
+  804504:	55                   	push   %ebp
+  804505:	89 e5                	mov    %esp,%ebp
+  804507:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80450a:	6a 01                	push   $0x1
+  80450c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80450f:	50                   	push   %eax
+  804510:	6a 00                	push   $0x0
+  804512:	e8 27 d8 ff ff       	call   801d3e <read>
+	if (r < 0)
+  804517:	83 c4 10             	add    $0x10,%esp
+  80451a:	85 c0                	test   %eax,%eax
+  80451c:	78 06                	js     804524 <getchar+0x20>
+	if (r < 1)
+  80451e:	74 06                	je     804526 <getchar+0x22>
+	return c;
+  804520:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  804524:	c9                   	leave
+  804525:	c3                   	ret
+		return -E_EOF;
+  804526:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80452b:	eb f7                	jmp    804524 <getchar+0x20>
+
+0080452d <iscons>:
+{
+  80452d:	55                   	push   %ebp
+  80452e:	89 e5                	mov    %esp,%ebp
+  804530:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804533:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804536:	50                   	push   %eax
+  804537:	ff 75 08             	push   0x8(%ebp)
+  80453a:	e8 6f d5 ff ff       	call   801aae <fd_lookup>
+  80453f:	83 c4 10             	add    $0x10,%esp
+  804542:	85 c0                	test   %eax,%eax
+  804544:	78 11                	js     804557 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  804546:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804549:	8b 15 98 62 80 00    	mov    0x806298,%edx
+  80454f:	39 10                	cmp    %edx,(%eax)
+  804551:	0f 94 c0             	sete   %al
+  804554:	0f b6 c0             	movzbl %al,%eax
+}
+  804557:	c9                   	leave
+  804558:	c3                   	ret
+
+00804559 <opencons>:
+{
+  804559:	55                   	push   %ebp
+  80455a:	89 e5                	mov    %esp,%ebp
+  80455c:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80455f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804562:	50                   	push   %eax
+  804563:	e8 f0 d4 ff ff       	call   801a58 <fd_alloc>
+  804568:	83 c4 10             	add    $0x10,%esp
+  80456b:	85 c0                	test   %eax,%eax
+  80456d:	78 3a                	js     8045a9 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80456f:	83 ec 04             	sub    $0x4,%esp
+  804572:	68 07 04 00 00       	push   $0x407
+  804577:	ff 75 f4             	push   -0xc(%ebp)
+  80457a:	6a 00                	push   $0x0
+  80457c:	e8 0d c8 ff ff       	call   800d8e <sys_page_alloc>
+  804581:	83 c4 10             	add    $0x10,%esp
+  804584:	85 c0                	test   %eax,%eax
+  804586:	78 21                	js     8045a9 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  804588:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80458b:	8b 15 98 62 80 00    	mov    0x806298,%edx
+  804591:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  804593:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804596:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80459d:	83 ec 0c             	sub    $0xc,%esp
+  8045a0:	50                   	push   %eax
+  8045a1:	e8 8b d4 ff ff       	call   801a31 <fd2num>
+  8045a6:	83 c4 10             	add    $0x10,%esp
+}
+  8045a9:	c9                   	leave
+  8045aa:	c3                   	ret
+
+008045ab <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8045ab:	55                   	push   %ebp
+  8045ac:	89 e5                	mov    %esp,%ebp
+  8045ae:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  8045b1:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  8045b8:	74 0a                	je     8045c4 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8045ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8045bd:	a3 00 a0 80 00       	mov    %eax,0x80a000
+}
+  8045c2:	c9                   	leave
+  8045c3:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  8045c4:	83 ec 04             	sub    $0x4,%esp
+  8045c7:	6a 07                	push   $0x7
+  8045c9:	68 00 f0 bf ee       	push   $0xeebff000
+  8045ce:	6a 00                	push   $0x0
+  8045d0:	e8 b9 c7 ff ff       	call   800d8e <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8045d5:	83 c4 08             	add    $0x8,%esp
+  8045d8:	68 e9 45 80 00       	push   $0x8045e9
+  8045dd:	6a 00                	push   $0x0
+  8045df:	e8 27 c9 ff ff       	call   800f0b <sys_env_set_pgfault_upcall>
+  8045e4:	83 c4 10             	add    $0x10,%esp
+  8045e7:	eb d1                	jmp    8045ba <set_pgfault_handler+0xf>
+
+008045e9 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8045e9:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8045ea:	a1 00 a0 80 00       	mov    0x80a000,%eax
+	call *%eax
+  8045ef:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8045f1:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  8045f4:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  8045f8:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  8045fc:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  8045ff:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  804603:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  804605:	83 c4 08             	add    $0x8,%esp
+	popal
+  804608:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  804609:	83 c4 04             	add    $0x4,%esp
+	popfl
+  80460c:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  80460d:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  80460e:	c3                   	ret
+
+0080460f <udm>:
+  80460f:	57                   	push   %edi
+  804610:	56                   	push   %esi
+  804611:	53                   	push   %ebx
+  804612:	83 ec 20             	sub    $0x20,%esp
+  804615:	89 44 24 10          	mov    %eax,0x10(%esp)
+  804619:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80461d:	8b 44 24 30          	mov    0x30(%esp),%eax
+  804621:	8b 54 24 34          	mov    0x34(%esp),%edx
+  804625:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804629:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80462d:	89 d1                	mov    %edx,%ecx
+  80462f:	09 c1                	or     %eax,%ecx
+  804631:	0f 84 91 00 00 00    	je     8046c8 <udm+0xb9>
+  804637:	b8 00 00 00 00       	mov    $0x0,%eax
+  80463c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804641:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804646:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80464d:	00 
+  80464e:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  804655:	00 
+  804656:	eb 08                	jmp    804660 <udm+0x51>
+  804658:	83 e9 01             	sub    $0x1,%ecx
+  80465b:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80465e:	74 7c                	je     8046dc <udm+0xcd>
+  804660:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804664:	01 c0                	add    %eax,%eax
+  804666:	89 c6                	mov    %eax,%esi
+  804668:	89 d7                	mov    %edx,%edi
+  80466a:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80466e:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804672:	0f ad d0             	shrd   %cl,%edx,%eax
+  804675:	d3 ea                	shr    %cl,%edx
+  804677:	f6 c1 20             	test   $0x20,%cl
+  80467a:	74 04                	je     804680 <udm+0x71>
+  80467c:	89 d0                	mov    %edx,%eax
+  80467e:	31 d2                	xor    %edx,%edx
+  804680:	83 e0 01             	and    $0x1,%eax
+  804683:	89 04 24             	mov    %eax,(%esp)
+  804686:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80468d:	00 
+  80468e:	8b 04 24             	mov    (%esp),%eax
+  804691:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804695:	09 f0                	or     %esi,%eax
+  804697:	09 fa                	or     %edi,%edx
+  804699:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80469d:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8046a1:	39 f0                	cmp    %esi,%eax
+  8046a3:	89 d3                	mov    %edx,%ebx
+  8046a5:	19 fb                	sbb    %edi,%ebx
+  8046a7:	72 af                	jb     804658 <udm+0x49>
+  8046a9:	29 f0                	sub    %esi,%eax
+  8046ab:	19 fa                	sbb    %edi,%edx
+  8046ad:	89 cf                	mov    %ecx,%edi
+  8046af:	c1 ef 05             	shr    $0x5,%edi
+  8046b2:	83 e7 01             	and    $0x1,%edi
+  8046b5:	89 fe                	mov    %edi,%esi
+  8046b7:	83 f6 01             	xor    $0x1,%esi
+  8046ba:	d3 e6                	shl    %cl,%esi
+  8046bc:	d3 e7                	shl    %cl,%edi
+  8046be:	09 74 24 18          	or     %esi,0x18(%esp)
+  8046c2:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8046c6:	eb 90                	jmp    804658 <udm+0x49>
+  8046c8:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8046cc:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8046d0:	89 f0                	mov    %esi,%eax
+  8046d2:	89 fa                	mov    %edi,%edx
+  8046d4:	89 74 24 18          	mov    %esi,0x18(%esp)
+  8046d8:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  8046dc:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  8046e0:	89 01                	mov    %eax,(%ecx)
+  8046e2:	89 51 04             	mov    %edx,0x4(%ecx)
+  8046e5:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8046e9:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8046ed:	83 c4 20             	add    $0x20,%esp
+  8046f0:	5b                   	pop    %ebx
+  8046f1:	5e                   	pop    %esi
+  8046f2:	5f                   	pop    %edi
+  8046f3:	c3                   	ret
+
+008046f4 <__udivdi3>:
+  8046f4:	83 ec 18             	sub    $0x18,%esp
+  8046f7:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8046fb:	50                   	push   %eax
+  8046fc:	ff 74 24 2c          	push   0x2c(%esp)
+  804700:	ff 74 24 2c          	push   0x2c(%esp)
+  804704:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804708:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80470c:	e8 fe fe ff ff       	call   80460f <udm>
+  804711:	83 c4 24             	add    $0x24,%esp
+  804714:	c3                   	ret
+
+00804715 <__umoddi3>:
+  804715:	83 ec 18             	sub    $0x18,%esp
+  804718:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80471c:	50                   	push   %eax
+  80471d:	ff 74 24 2c          	push   0x2c(%esp)
+  804721:	ff 74 24 2c          	push   0x2c(%esp)
+  804725:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804729:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80472d:	e8 dd fe ff ff       	call   80460f <udm>
+  804732:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804736:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80473a:	83 c4 24             	add    $0x24,%esp
+  80473d:	c3                   	ret
+
+0080473e <__divdi3>:
+  80473e:	56                   	push   %esi
+  80473f:	53                   	push   %ebx
+  804740:	83 ec 14             	sub    $0x14,%esp
+  804743:	8b 44 24 20          	mov    0x20(%esp),%eax
+  804747:	8b 54 24 24          	mov    0x24(%esp),%edx
+  80474b:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  80474f:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  804753:	85 d2                	test   %edx,%edx
+  804755:	78 18                	js     80476f <__divdi3+0x31>
+  804757:	85 db                	test   %ebx,%ebx
+  804759:	78 3e                	js     804799 <__divdi3+0x5b>
+  80475b:	83 ec 04             	sub    $0x4,%esp
+  80475e:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804762:	56                   	push   %esi
+  804763:	53                   	push   %ebx
+  804764:	51                   	push   %ecx
+  804765:	e8 a5 fe ff ff       	call   80460f <udm>
+  80476a:	83 c4 10             	add    $0x10,%esp
+  80476d:	eb 24                	jmp    804793 <__divdi3+0x55>
+  80476f:	f7 d8                	neg    %eax
+  804771:	83 d2 00             	adc    $0x0,%edx
+  804774:	f7 da                	neg    %edx
+  804776:	85 db                	test   %ebx,%ebx
+  804778:	78 3a                	js     8047b4 <__divdi3+0x76>
+  80477a:	83 ec 04             	sub    $0x4,%esp
+  80477d:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804781:	56                   	push   %esi
+  804782:	53                   	push   %ebx
+  804783:	51                   	push   %ecx
+  804784:	e8 86 fe ff ff       	call   80460f <udm>
+  804789:	83 c4 10             	add    $0x10,%esp
+  80478c:	f7 d8                	neg    %eax
+  80478e:	83 d2 00             	adc    $0x0,%edx
+  804791:	f7 da                	neg    %edx
+  804793:	83 c4 14             	add    $0x14,%esp
+  804796:	5b                   	pop    %ebx
+  804797:	5e                   	pop    %esi
+  804798:	c3                   	ret
+  804799:	83 ec 04             	sub    $0x4,%esp
+  80479c:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8047a0:	56                   	push   %esi
+  8047a1:	f7 d9                	neg    %ecx
+  8047a3:	83 d3 00             	adc    $0x0,%ebx
+  8047a6:	f7 db                	neg    %ebx
+  8047a8:	53                   	push   %ebx
+  8047a9:	51                   	push   %ecx
+  8047aa:	e8 60 fe ff ff       	call   80460f <udm>
+  8047af:	83 c4 10             	add    $0x10,%esp
+  8047b2:	eb d8                	jmp    80478c <__divdi3+0x4e>
+  8047b4:	83 ec 04             	sub    $0x4,%esp
+  8047b7:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8047bb:	56                   	push   %esi
+  8047bc:	f7 d9                	neg    %ecx
+  8047be:	83 d3 00             	adc    $0x0,%ebx
+  8047c1:	f7 db                	neg    %ebx
+  8047c3:	53                   	push   %ebx
+  8047c4:	51                   	push   %ecx
+  8047c5:	e8 45 fe ff ff       	call   80460f <udm>
+  8047ca:	83 c4 10             	add    $0x10,%esp
+  8047cd:	eb c4                	jmp    804793 <__divdi3+0x55>
+
+008047cf <__moddi3>:
+  8047cf:	55                   	push   %ebp
+  8047d0:	57                   	push   %edi
+  8047d1:	56                   	push   %esi
+  8047d2:	53                   	push   %ebx
+  8047d3:	83 ec 24             	sub    $0x24,%esp
+  8047d6:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8047da:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8047de:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8047e2:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8047e6:	85 d2                	test   %edx,%edx
+  8047e8:	78 3b                	js     804825 <__moddi3+0x56>
+  8047ea:	83 ec 04             	sub    $0x4,%esp
+  8047ed:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8047f1:	56                   	push   %esi
+  8047f2:	89 ce                	mov    %ecx,%esi
+  8047f4:	f7 de                	neg    %esi
+  8047f6:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8047fa:	89 de                	mov    %ebx,%esi
+  8047fc:	83 d6 00             	adc    $0x0,%esi
+  8047ff:	f7 de                	neg    %esi
+  804801:	89 74 24 14          	mov    %esi,0x14(%esp)
+  804805:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804809:	0f 48 f1             	cmovs  %ecx,%esi
+  80480c:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  804811:	53                   	push   %ebx
+  804812:	56                   	push   %esi
+  804813:	e8 f7 fd ff ff       	call   80460f <udm>
+  804818:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80481c:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804820:	83 c4 10             	add    $0x10,%esp
+  804823:	eb 47                	jmp    80486c <__moddi3+0x9d>
+  804825:	f7 d8                	neg    %eax
+  804827:	83 d2 00             	adc    $0x0,%edx
+  80482a:	f7 da                	neg    %edx
+  80482c:	83 ec 04             	sub    $0x4,%esp
+  80482f:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804833:	56                   	push   %esi
+  804834:	89 cf                	mov    %ecx,%edi
+  804836:	f7 df                	neg    %edi
+  804838:	89 de                	mov    %ebx,%esi
+  80483a:	83 d6 00             	adc    $0x0,%esi
+  80483d:	f7 de                	neg    %esi
+  80483f:	0f 49 cf             	cmovns %edi,%ecx
+  804842:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  804846:	0f 49 de             	cmovns %esi,%ebx
+  804849:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  80484d:	ff 74 24 0c          	push   0xc(%esp)
+  804851:	ff 74 24 0c          	push   0xc(%esp)
+  804855:	e8 b5 fd ff ff       	call   80460f <udm>
+  80485a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80485e:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804862:	f7 d8                	neg    %eax
+  804864:	83 d2 00             	adc    $0x0,%edx
+  804867:	f7 da                	neg    %edx
+  804869:	83 c4 10             	add    $0x10,%esp
+  80486c:	83 c4 24             	add    $0x24,%esp
+  80486f:	5b                   	pop    %ebx
+  804870:	5e                   	pop    %esi
+  804871:	5f                   	pop    %edi
+  804872:	5d                   	pop    %ebp
+  804873:	c3                   	ret
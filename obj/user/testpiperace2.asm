@@ -0,0 +1,9848 @@
+
+obj/user/testpiperace2.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 a1 01 00 00       	call   8001d2 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 28             	sub    $0x28,%esp
+	int p[2], r, i;
+	struct Fd *fd;
+	const volatile struct Env *kid;
+
+	cprintf("testing for pipeisclosed race...\n");
+  80003c:	68 60 48 80 00       	push   $0x804860
+  800041:	e8 0a 03 00 00       	call   800350 <cprintf>
+	if ((r = pipe(p)) < 0)
+  800046:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800049:	89 04 24             	mov    %eax,(%esp)
+  80004c:	e8 6c 38 00 00       	call   8038bd <pipe>
+  800051:	83 c4 10             	add    $0x10,%esp
+  800054:	85 c0                	test   %eax,%eax
+  800056:	78 5d                	js     8000b5 <umain+0x82>
+		panic("pipe: %e", r);
+	if ((r = fork()) < 0)
+  800058:	e8 d1 13 00 00       	call   80142e <fork>
+  80005d:	89 c7                	mov    %eax,%edi
+  80005f:	85 c0                	test   %eax,%eax
+  800061:	78 64                	js     8000c7 <umain+0x94>
+		panic("fork: %e", r);
+	if (r == 0) {
+  800063:	74 74                	je     8000d9 <umain+0xa6>
+	// pageref(p[0]) and gets 3, then it will return true when
+	// it shouldn't.
+	//
+	// So either way, pipeisclosed is going give a wrong answer.
+	//
+	kid = &envs[ENVX(r)];
+  800065:	89 f8                	mov    %edi,%eax
+  800067:	25 ff 03 00 00       	and    $0x3ff,%eax
+	while (kid->env_status == ENV_RUNNABLE)
+  80006c:	8d 1c c0             	lea    (%eax,%eax,8),%ebx
+  80006f:	c1 e3 04             	shl    $0x4,%ebx
+  800072:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  800078:	8b 43 54             	mov    0x54(%ebx),%eax
+  80007b:	83 f8 02             	cmp    $0x2,%eax
+  80007e:	0f 85 d1 00 00 00    	jne    800155 <umain+0x122>
+		if (pipeisclosed(p[0]) != 0) {
+  800084:	83 ec 0c             	sub    $0xc,%esp
+  800087:	ff 75 e0             	push   -0x20(%ebp)
+  80008a:	e8 78 39 00 00       	call   803a07 <pipeisclosed>
+  80008f:	83 c4 10             	add    $0x10,%esp
+  800092:	85 c0                	test   %eax,%eax
+  800094:	74 e2                	je     800078 <umain+0x45>
+			cprintf("\nRACE: pipe appears closed\n");
+  800096:	83 ec 0c             	sub    $0xc,%esp
+  800099:	68 d9 48 80 00       	push   $0x8048d9
+  80009e:	e8 ad 02 00 00       	call   800350 <cprintf>
+			sys_env_destroy(r);
+  8000a3:	89 3c 24             	mov    %edi,(%esp)
+  8000a6:	e8 24 0c 00 00       	call   800ccf <sys_env_destroy>
+			exit();
+  8000ab:	e8 9d 01 00 00       	call   80024d <exit>
+  8000b0:	83 c4 10             	add    $0x10,%esp
+  8000b3:	eb c3                	jmp    800078 <umain+0x45>
+		panic("pipe: %e", r);
+  8000b5:	50                   	push   %eax
+  8000b6:	68 ae 48 80 00       	push   $0x8048ae
+  8000bb:	6a 0d                	push   $0xd
+  8000bd:	68 b7 48 80 00       	push   $0x8048b7
+  8000c2:	e8 ae 01 00 00       	call   800275 <_panic>
+		panic("fork: %e", r);
+  8000c7:	50                   	push   %eax
+  8000c8:	68 cc 48 80 00       	push   $0x8048cc
+  8000cd:	6a 0f                	push   $0xf
+  8000cf:	68 b7 48 80 00       	push   $0x8048b7
+  8000d4:	e8 9c 01 00 00       	call   800275 <_panic>
+		close(p[1]);
+  8000d9:	83 ec 0c             	sub    $0xc,%esp
+  8000dc:	ff 75 e4             	push   -0x1c(%ebp)
+  8000df:	e8 77 19 00 00       	call   801a5b <close>
+  8000e4:	83 c4 10             	add    $0x10,%esp
+		for (i = 0; i < 200; i++) {
+  8000e7:	89 fb                	mov    %edi,%ebx
+			if (i % 10 == 0)
+  8000e9:	be 67 66 66 66       	mov    $0x66666667,%esi
+  8000ee:	eb 31                	jmp    800121 <umain+0xee>
+			dup(p[0], 10);
+  8000f0:	83 ec 08             	sub    $0x8,%esp
+  8000f3:	6a 0a                	push   $0xa
+  8000f5:	ff 75 e0             	push   -0x20(%ebp)
+  8000f8:	e8 b0 19 00 00       	call   801aad <dup>
+			sys_yield();
+  8000fd:	e8 44 0c 00 00       	call   800d46 <sys_yield>
+			close(10);
+  800102:	c7 04 24 0a 00 00 00 	movl   $0xa,(%esp)
+  800109:	e8 4d 19 00 00       	call   801a5b <close>
+			sys_yield();
+  80010e:	e8 33 0c 00 00       	call   800d46 <sys_yield>
+		for (i = 0; i < 200; i++) {
+  800113:	83 c3 01             	add    $0x1,%ebx
+  800116:	83 c4 10             	add    $0x10,%esp
+  800119:	81 fb c8 00 00 00    	cmp    $0xc8,%ebx
+  80011f:	74 2a                	je     80014b <umain+0x118>
+			if (i % 10 == 0)
+  800121:	89 d8                	mov    %ebx,%eax
+  800123:	f7 ee                	imul   %esi
+  800125:	c1 fa 02             	sar    $0x2,%edx
+  800128:	89 d8                	mov    %ebx,%eax
+  80012a:	c1 f8 1f             	sar    $0x1f,%eax
+  80012d:	29 c2                	sub    %eax,%edx
+  80012f:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  800132:	01 c0                	add    %eax,%eax
+  800134:	39 c3                	cmp    %eax,%ebx
+  800136:	75 b8                	jne    8000f0 <umain+0xbd>
+				cprintf("%d.", i);
+  800138:	83 ec 08             	sub    $0x8,%esp
+  80013b:	53                   	push   %ebx
+  80013c:	68 d5 48 80 00       	push   $0x8048d5
+  800141:	e8 0a 02 00 00       	call   800350 <cprintf>
+  800146:	83 c4 10             	add    $0x10,%esp
+  800149:	eb a5                	jmp    8000f0 <umain+0xbd>
+		exit();
+  80014b:	e8 fd 00 00 00       	call   80024d <exit>
+  800150:	e9 10 ff ff ff       	jmp    800065 <umain+0x32>
+		}
+	cprintf("child done with loop\n");
+  800155:	83 ec 0c             	sub    $0xc,%esp
+  800158:	68 f5 48 80 00       	push   $0x8048f5
+  80015d:	e8 ee 01 00 00       	call   800350 <cprintf>
+	if (pipeisclosed(p[0]))
+  800162:	83 c4 04             	add    $0x4,%esp
+  800165:	ff 75 e0             	push   -0x20(%ebp)
+  800168:	e8 9a 38 00 00       	call   803a07 <pipeisclosed>
+  80016d:	83 c4 10             	add    $0x10,%esp
+  800170:	85 c0                	test   %eax,%eax
+  800172:	75 38                	jne    8001ac <umain+0x179>
+		panic("somehow the other end of p[0] got closed!");
+	if ((r = fd_lookup(p[0], &fd)) < 0)
+  800174:	83 ec 08             	sub    $0x8,%esp
+  800177:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  80017a:	50                   	push   %eax
+  80017b:	ff 75 e0             	push   -0x20(%ebp)
+  80017e:	e8 84 17 00 00       	call   801907 <fd_lookup>
+  800183:	83 c4 10             	add    $0x10,%esp
+  800186:	85 c0                	test   %eax,%eax
+  800188:	78 36                	js     8001c0 <umain+0x18d>
+		panic("cannot look up p[0]: %e", r);
+	(void) fd2data(fd);
+  80018a:	83 ec 0c             	sub    $0xc,%esp
+  80018d:	ff 75 dc             	push   -0x24(%ebp)
+  800190:	e8 05 17 00 00       	call   80189a <fd2data>
+	cprintf("race didn't happen\n");
+  800195:	c7 04 24 23 49 80 00 	movl   $0x804923,(%esp)
+  80019c:	e8 af 01 00 00       	call   800350 <cprintf>
+}
+  8001a1:	83 c4 10             	add    $0x10,%esp
+  8001a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001a7:	5b                   	pop    %ebx
+  8001a8:	5e                   	pop    %esi
+  8001a9:	5f                   	pop    %edi
+  8001aa:	5d                   	pop    %ebp
+  8001ab:	c3                   	ret
+		panic("somehow the other end of p[0] got closed!");
+  8001ac:	83 ec 04             	sub    $0x4,%esp
+  8001af:	68 84 48 80 00       	push   $0x804884
+  8001b4:	6a 40                	push   $0x40
+  8001b6:	68 b7 48 80 00       	push   $0x8048b7
+  8001bb:	e8 b5 00 00 00       	call   800275 <_panic>
+		panic("cannot look up p[0]: %e", r);
+  8001c0:	50                   	push   %eax
+  8001c1:	68 0b 49 80 00       	push   $0x80490b
+  8001c6:	6a 42                	push   $0x42
+  8001c8:	68 b7 48 80 00       	push   $0x8048b7
+  8001cd:	e8 a3 00 00 00       	call   800275 <_panic>
+
+008001d2 <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001d2:	55                   	push   %ebp
+  8001d3:	89 e5                	mov    %esp,%ebp
+  8001d5:	57                   	push   %edi
+  8001d6:	56                   	push   %esi
+  8001d7:	53                   	push   %ebx
+  8001d8:	83 ec 1c             	sub    $0x1c,%esp
+  8001db:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001de:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  8001e1:	e8 34 0b 00 00       	call   800d1a <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  8001e6:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  8001e9:	89 15 c0 72 80 00    	mov    %edx,0x8072c0
+	thisenv = &envs[ENVX(eid)];
+  8001ef:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001f4:	89 c1                	mov    %eax,%ecx
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  8001f6:	89 e7                	mov    %esp,%edi
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8001f8:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  8001fe:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800203:	77 16                	ja     80021b <libmain+0x49>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800205:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80020a:	29 f8                	sub    %edi,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  80020c:	c1 e8 10             	shr    $0x10,%eax
+  80020f:	74 0a                	je     80021b <libmain+0x49>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800211:	c1 e0 10             	shl    $0x10,%eax
+  800214:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800219:	29 c2                	sub    %eax,%edx
+  80021b:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  80021e:	c1 e0 04             	shl    $0x4,%eax
+  800221:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800226:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800228:	85 db                	test   %ebx,%ebx
+  80022a:	7e 07                	jle    800233 <libmain+0x61>
+		binaryname = argv[0];
+  80022c:	8b 06                	mov    (%esi),%eax
+  80022e:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// call user main routine
+	umain(argc, argv);
+  800233:	83 ec 08             	sub    $0x8,%esp
+  800236:	56                   	push   %esi
+  800237:	53                   	push   %ebx
+  800238:	e8 f6 fd ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80023d:	e8 0b 00 00 00       	call   80024d <exit>
+}
+  800242:	83 c4 10             	add    $0x10,%esp
+  800245:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800248:	5b                   	pop    %ebx
+  800249:	5e                   	pop    %esi
+  80024a:	5f                   	pop    %edi
+  80024b:	5d                   	pop    %ebp
+  80024c:	c3                   	ret
+
+0080024d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80024d:	55                   	push   %ebp
+  80024e:	89 e5                	mov    %esp,%ebp
+  800250:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  800253:	6a 00                	push   $0x0
+  800255:	e8 8b 27 00 00       	call   8029e5 <fflush>
+	pthread_kill_others();
+  80025a:	e8 f6 3d 00 00       	call   804055 <pthread_kill_others>
+	close_all();
+  80025f:	e8 24 18 00 00       	call   801a88 <close_all>
+	sys_env_destroy(0);
+  800264:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80026b:	e8 5f 0a 00 00       	call   800ccf <sys_env_destroy>
+}
+  800270:	83 c4 10             	add    $0x10,%esp
+  800273:	c9                   	leave
+  800274:	c3                   	ret
+
+00800275 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800275:	55                   	push   %ebp
+  800276:	89 e5                	mov    %esp,%ebp
+  800278:	56                   	push   %esi
+  800279:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80027a:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80027d:	8b 35 00 60 80 00    	mov    0x806000,%esi
+  800283:	e8 92 0a 00 00       	call   800d1a <sys_getenvid>
+  800288:	83 ec 0c             	sub    $0xc,%esp
+  80028b:	ff 75 0c             	push   0xc(%ebp)
+  80028e:	ff 75 08             	push   0x8(%ebp)
+  800291:	56                   	push   %esi
+  800292:	50                   	push   %eax
+  800293:	68 44 49 80 00       	push   $0x804944
+  800298:	e8 b3 00 00 00       	call   800350 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80029d:	83 c4 18             	add    $0x18,%esp
+  8002a0:	53                   	push   %ebx
+  8002a1:	ff 75 10             	push   0x10(%ebp)
+  8002a4:	e8 56 00 00 00       	call   8002ff <vcprintf>
+	cprintf("\n");
+  8002a9:	c7 04 24 3a 4e 80 00 	movl   $0x804e3a,(%esp)
+  8002b0:	e8 9b 00 00 00       	call   800350 <cprintf>
+  8002b5:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8002b8:	cc                   	int3
+	while (1)
+  8002b9:	eb fd                	jmp    8002b8 <_panic+0x43>
+
+008002bb <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8002bb:	55                   	push   %ebp
+  8002bc:	89 e5                	mov    %esp,%ebp
+  8002be:	53                   	push   %ebx
+  8002bf:	83 ec 04             	sub    $0x4,%esp
+  8002c2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8002c5:	8b 13                	mov    (%ebx),%edx
+  8002c7:	8d 42 01             	lea    0x1(%edx),%eax
+  8002ca:	89 03                	mov    %eax,(%ebx)
+  8002cc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8002cf:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8002d3:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8002d8:	74 09                	je     8002e3 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8002da:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8002de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8002e1:	c9                   	leave
+  8002e2:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8002e3:	83 ec 08             	sub    $0x8,%esp
+  8002e6:	68 ff 00 00 00       	push   $0xff
+  8002eb:	8d 43 08             	lea    0x8(%ebx),%eax
+  8002ee:	50                   	push   %eax
+  8002ef:	e8 84 09 00 00       	call   800c78 <sys_cputs>
+		b->idx = 0;
+  8002f4:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8002fa:	83 c4 10             	add    $0x10,%esp
+  8002fd:	eb db                	jmp    8002da <putch+0x1f>
+
+008002ff <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8002ff:	55                   	push   %ebp
+  800300:	89 e5                	mov    %esp,%ebp
+  800302:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800308:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80030f:	00 00 00 
+	b.cnt = 0;
+  800312:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800319:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80031c:	ff 75 0c             	push   0xc(%ebp)
+  80031f:	ff 75 08             	push   0x8(%ebp)
+  800322:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800328:	50                   	push   %eax
+  800329:	68 bb 02 80 00       	push   $0x8002bb
+  80032e:	e8 14 01 00 00       	call   800447 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800333:	83 c4 08             	add    $0x8,%esp
+  800336:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80033c:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800342:	50                   	push   %eax
+  800343:	e8 30 09 00 00       	call   800c78 <sys_cputs>
+
+	return b.cnt;
+}
+  800348:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80034e:	c9                   	leave
+  80034f:	c3                   	ret
+
+00800350 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800350:	55                   	push   %ebp
+  800351:	89 e5                	mov    %esp,%ebp
+  800353:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800356:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800359:	50                   	push   %eax
+  80035a:	ff 75 08             	push   0x8(%ebp)
+  80035d:	e8 9d ff ff ff       	call   8002ff <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800362:	c9                   	leave
+  800363:	c3                   	ret
+
+00800364 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800364:	55                   	push   %ebp
+  800365:	89 e5                	mov    %esp,%ebp
+  800367:	57                   	push   %edi
+  800368:	56                   	push   %esi
+  800369:	53                   	push   %ebx
+  80036a:	83 ec 1c             	sub    $0x1c,%esp
+  80036d:	89 c7                	mov    %eax,%edi
+  80036f:	89 d6                	mov    %edx,%esi
+  800371:	8b 45 08             	mov    0x8(%ebp),%eax
+  800374:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800377:	89 d1                	mov    %edx,%ecx
+  800379:	89 c2                	mov    %eax,%edx
+  80037b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80037e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800381:	8b 45 10             	mov    0x10(%ebp),%eax
+  800384:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800387:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80038a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800391:	39 c2                	cmp    %eax,%edx
+  800393:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800396:	72 3e                	jb     8003d6 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800398:	83 ec 0c             	sub    $0xc,%esp
+  80039b:	ff 75 18             	push   0x18(%ebp)
+  80039e:	83 eb 01             	sub    $0x1,%ebx
+  8003a1:	53                   	push   %ebx
+  8003a2:	50                   	push   %eax
+  8003a3:	83 ec 08             	sub    $0x8,%esp
+  8003a6:	ff 75 e4             	push   -0x1c(%ebp)
+  8003a9:	ff 75 e0             	push   -0x20(%ebp)
+  8003ac:	ff 75 dc             	push   -0x24(%ebp)
+  8003af:	ff 75 d8             	push   -0x28(%ebp)
+  8003b2:	e8 21 43 00 00       	call   8046d8 <__udivdi3>
+  8003b7:	83 c4 18             	add    $0x18,%esp
+  8003ba:	52                   	push   %edx
+  8003bb:	50                   	push   %eax
+  8003bc:	89 f2                	mov    %esi,%edx
+  8003be:	89 f8                	mov    %edi,%eax
+  8003c0:	e8 9f ff ff ff       	call   800364 <printnum>
+  8003c5:	83 c4 20             	add    $0x20,%esp
+  8003c8:	eb 13                	jmp    8003dd <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8003ca:	83 ec 08             	sub    $0x8,%esp
+  8003cd:	56                   	push   %esi
+  8003ce:	ff 75 18             	push   0x18(%ebp)
+  8003d1:	ff d7                	call   *%edi
+  8003d3:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8003d6:	83 eb 01             	sub    $0x1,%ebx
+  8003d9:	85 db                	test   %ebx,%ebx
+  8003db:	7f ed                	jg     8003ca <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8003dd:	83 ec 08             	sub    $0x8,%esp
+  8003e0:	56                   	push   %esi
+  8003e1:	83 ec 04             	sub    $0x4,%esp
+  8003e4:	ff 75 e4             	push   -0x1c(%ebp)
+  8003e7:	ff 75 e0             	push   -0x20(%ebp)
+  8003ea:	ff 75 dc             	push   -0x24(%ebp)
+  8003ed:	ff 75 d8             	push   -0x28(%ebp)
+  8003f0:	e8 04 43 00 00       	call   8046f9 <__umoddi3>
+  8003f5:	83 c4 14             	add    $0x14,%esp
+  8003f8:	0f be 80 67 49 80 00 	movsbl 0x804967(%eax),%eax
+  8003ff:	50                   	push   %eax
+  800400:	ff d7                	call   *%edi
+}
+  800402:	83 c4 10             	add    $0x10,%esp
+  800405:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800408:	5b                   	pop    %ebx
+  800409:	5e                   	pop    %esi
+  80040a:	5f                   	pop    %edi
+  80040b:	5d                   	pop    %ebp
+  80040c:	c3                   	ret
+
+0080040d <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80040d:	55                   	push   %ebp
+  80040e:	89 e5                	mov    %esp,%ebp
+  800410:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800413:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800417:	8b 10                	mov    (%eax),%edx
+  800419:	3b 50 04             	cmp    0x4(%eax),%edx
+  80041c:	73 0a                	jae    800428 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80041e:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800421:	89 08                	mov    %ecx,(%eax)
+  800423:	8b 45 08             	mov    0x8(%ebp),%eax
+  800426:	88 02                	mov    %al,(%edx)
+}
+  800428:	5d                   	pop    %ebp
+  800429:	c3                   	ret
+
+0080042a <printfmt>:
+{
+  80042a:	55                   	push   %ebp
+  80042b:	89 e5                	mov    %esp,%ebp
+  80042d:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800430:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800433:	50                   	push   %eax
+  800434:	ff 75 10             	push   0x10(%ebp)
+  800437:	ff 75 0c             	push   0xc(%ebp)
+  80043a:	ff 75 08             	push   0x8(%ebp)
+  80043d:	e8 05 00 00 00       	call   800447 <vprintfmt>
+}
+  800442:	83 c4 10             	add    $0x10,%esp
+  800445:	c9                   	leave
+  800446:	c3                   	ret
+
+00800447 <vprintfmt>:
+{
+  800447:	55                   	push   %ebp
+  800448:	89 e5                	mov    %esp,%ebp
+  80044a:	57                   	push   %edi
+  80044b:	56                   	push   %esi
+  80044c:	53                   	push   %ebx
+  80044d:	83 ec 2c             	sub    $0x2c,%esp
+  800450:	8b 75 08             	mov    0x8(%ebp),%esi
+  800453:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800456:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800459:	eb 0a                	jmp    800465 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80045b:	83 ec 08             	sub    $0x8,%esp
+  80045e:	53                   	push   %ebx
+  80045f:	50                   	push   %eax
+  800460:	ff d6                	call   *%esi
+  800462:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  800465:	83 c7 01             	add    $0x1,%edi
+  800468:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  80046c:	83 f8 25             	cmp    $0x25,%eax
+  80046f:	74 0c                	je     80047d <vprintfmt+0x36>
+			if (ch == '\0')
+  800471:	85 c0                	test   %eax,%eax
+  800473:	75 e6                	jne    80045b <vprintfmt+0x14>
+}
+  800475:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800478:	5b                   	pop    %ebx
+  800479:	5e                   	pop    %esi
+  80047a:	5f                   	pop    %edi
+  80047b:	5d                   	pop    %ebp
+  80047c:	c3                   	ret
+		padc = ' ';
+  80047d:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800481:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800488:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80048f:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800496:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  80049b:	8d 47 01             	lea    0x1(%edi),%eax
+  80049e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8004a1:	0f b6 17             	movzbl (%edi),%edx
+  8004a4:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8004a7:	3c 55                	cmp    $0x55,%al
+  8004a9:	0f 87 c5 03 00 00    	ja     800874 <vprintfmt+0x42d>
+  8004af:	0f b6 c0             	movzbl %al,%eax
+  8004b2:	ff 24 85 e0 4a 80 00 	jmp    *0x804ae0(,%eax,4)
+  8004b9:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  8004bc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8004bf:	eb da                	jmp    80049b <vprintfmt+0x54>
+  8004c1:	0f be d2             	movsbl %dl,%edx
+  8004c4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8004c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004cc:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8004cf:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8004d2:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8004d6:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8004d9:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8004dc:	83 f9 09             	cmp    $0x9,%ecx
+  8004df:	77 55                	ja     800536 <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  8004e1:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8004e4:	eb e9                	jmp    8004cf <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  8004e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e9:	8b 00                	mov    (%eax),%eax
+  8004eb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004f1:	8d 40 04             	lea    0x4(%eax),%eax
+  8004f4:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  8004f7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8004fa:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004fe:	79 9b                	jns    80049b <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800500:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800503:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800506:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80050d:	eb 8c                	jmp    80049b <vprintfmt+0x54>
+			if (width < 0)
+  80050f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800512:	85 d2                	test   %edx,%edx
+  800514:	b8 00 00 00 00       	mov    $0x0,%eax
+  800519:	0f 49 c2             	cmovns %edx,%eax
+  80051c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  80051f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800522:	e9 74 ff ff ff       	jmp    80049b <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  800527:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80052a:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800531:	e9 65 ff ff ff       	jmp    80049b <vprintfmt+0x54>
+  800536:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800539:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80053c:	eb bc                	jmp    8004fa <vprintfmt+0xb3>
+			lflag++;
+  80053e:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  800541:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800544:	e9 52 ff ff ff       	jmp    80049b <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800549:	8b 45 14             	mov    0x14(%ebp),%eax
+  80054c:	8d 78 04             	lea    0x4(%eax),%edi
+  80054f:	83 ec 08             	sub    $0x8,%esp
+  800552:	53                   	push   %ebx
+  800553:	ff 30                	push   (%eax)
+  800555:	ff d6                	call   *%esi
+			break;
+  800557:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80055a:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80055d:	e9 b1 02 00 00       	jmp    800813 <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  800562:	8b 45 14             	mov    0x14(%ebp),%eax
+  800565:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800568:	8b 10                	mov    (%eax),%edx
+  80056a:	89 d0                	mov    %edx,%eax
+  80056c:	f7 d8                	neg    %eax
+  80056e:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800571:	83 f8 14             	cmp    $0x14,%eax
+  800574:	7f 23                	jg     800599 <vprintfmt+0x152>
+  800576:	8b 14 85 40 4c 80 00 	mov    0x804c40(,%eax,4),%edx
+  80057d:	85 d2                	test   %edx,%edx
+  80057f:	74 18                	je     800599 <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  800581:	52                   	push   %edx
+  800582:	68 83 4e 80 00       	push   $0x804e83
+  800587:	53                   	push   %ebx
+  800588:	56                   	push   %esi
+  800589:	e8 9c fe ff ff       	call   80042a <printfmt>
+  80058e:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800591:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800594:	e9 7a 02 00 00       	jmp    800813 <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  800599:	50                   	push   %eax
+  80059a:	68 7f 49 80 00       	push   $0x80497f
+  80059f:	53                   	push   %ebx
+  8005a0:	56                   	push   %esi
+  8005a1:	e8 84 fe ff ff       	call   80042a <printfmt>
+  8005a6:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005a9:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8005ac:	e9 62 02 00 00       	jmp    800813 <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b4:	83 c0 04             	add    $0x4,%eax
+  8005b7:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8005ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005bd:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8005bf:	85 c9                	test   %ecx,%ecx
+  8005c1:	b8 78 49 80 00       	mov    $0x804978,%eax
+  8005c6:	0f 45 c1             	cmovne %ecx,%eax
+  8005c9:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8005cc:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005d0:	7e 06                	jle    8005d8 <vprintfmt+0x191>
+  8005d2:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8005d6:	75 0b                	jne    8005e3 <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005d8:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8005db:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8005de:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005e1:	eb 5c                	jmp    80063f <vprintfmt+0x1f8>
+  8005e3:	83 ec 08             	sub    $0x8,%esp
+  8005e6:	ff 75 d0             	push   -0x30(%ebp)
+  8005e9:	ff 75 cc             	push   -0x34(%ebp)
+  8005ec:	e8 20 03 00 00       	call   800911 <strnlen>
+  8005f1:	89 c2                	mov    %eax,%edx
+  8005f3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005f6:	29 d0                	sub    %edx,%eax
+  8005f8:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8005fb:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8005ff:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800602:	89 75 08             	mov    %esi,0x8(%ebp)
+  800605:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800607:	eb 0e                	jmp    800617 <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  800609:	83 ec 08             	sub    $0x8,%esp
+  80060c:	53                   	push   %ebx
+  80060d:	57                   	push   %edi
+  80060e:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800611:	83 ee 01             	sub    $0x1,%esi
+  800614:	83 c4 10             	add    $0x10,%esp
+  800617:	85 f6                	test   %esi,%esi
+  800619:	7f ee                	jg     800609 <vprintfmt+0x1c2>
+  80061b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80061e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800621:	85 c0                	test   %eax,%eax
+  800623:	ba 00 00 00 00       	mov    $0x0,%edx
+  800628:	0f 49 d0             	cmovns %eax,%edx
+  80062b:	29 d0                	sub    %edx,%eax
+  80062d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800630:	eb a6                	jmp    8005d8 <vprintfmt+0x191>
+					putch(ch, putdat);
+  800632:	83 ec 08             	sub    $0x8,%esp
+  800635:	53                   	push   %ebx
+  800636:	52                   	push   %edx
+  800637:	ff 55 08             	call   *0x8(%ebp)
+  80063a:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80063d:	89 f1                	mov    %esi,%ecx
+  80063f:	8d 71 01             	lea    0x1(%ecx),%esi
+  800642:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800646:	0f be d0             	movsbl %al,%edx
+  800649:	85 d2                	test   %edx,%edx
+  80064b:	74 28                	je     800675 <vprintfmt+0x22e>
+  80064d:	85 ff                	test   %edi,%edi
+  80064f:	78 05                	js     800656 <vprintfmt+0x20f>
+  800651:	83 ef 01             	sub    $0x1,%edi
+  800654:	78 30                	js     800686 <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800656:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80065a:	74 d6                	je     800632 <vprintfmt+0x1eb>
+  80065c:	0f be c0             	movsbl %al,%eax
+  80065f:	83 e8 20             	sub    $0x20,%eax
+  800662:	83 f8 5e             	cmp    $0x5e,%eax
+  800665:	76 cb                	jbe    800632 <vprintfmt+0x1eb>
+					putch('?', putdat);
+  800667:	83 ec 08             	sub    $0x8,%esp
+  80066a:	53                   	push   %ebx
+  80066b:	6a 3f                	push   $0x3f
+  80066d:	ff 55 08             	call   *0x8(%ebp)
+  800670:	83 c4 10             	add    $0x10,%esp
+  800673:	eb c8                	jmp    80063d <vprintfmt+0x1f6>
+  800675:	8b 75 08             	mov    0x8(%ebp),%esi
+  800678:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80067b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80067e:	01 d0                	add    %edx,%eax
+  800680:	29 c8                	sub    %ecx,%eax
+  800682:	89 c7                	mov    %eax,%edi
+  800684:	eb 13                	jmp    800699 <vprintfmt+0x252>
+  800686:	8b 75 08             	mov    0x8(%ebp),%esi
+  800689:	eb ed                	jmp    800678 <vprintfmt+0x231>
+				putch(' ', putdat);
+  80068b:	83 ec 08             	sub    $0x8,%esp
+  80068e:	53                   	push   %ebx
+  80068f:	6a 20                	push   $0x20
+  800691:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800693:	83 ef 01             	sub    $0x1,%edi
+  800696:	83 c4 10             	add    $0x10,%esp
+  800699:	85 ff                	test   %edi,%edi
+  80069b:	7f ee                	jg     80068b <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80069d:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8006a0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006a3:	e9 6b 01 00 00       	jmp    800813 <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  8006a8:	83 f9 01             	cmp    $0x1,%ecx
+  8006ab:	7f 1f                	jg     8006cc <vprintfmt+0x285>
+	else if (lflag)
+  8006ad:	85 c9                	test   %ecx,%ecx
+  8006af:	74 67                	je     800718 <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  8006b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b4:	8b 00                	mov    (%eax),%eax
+  8006b6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006b9:	89 c1                	mov    %eax,%ecx
+  8006bb:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006be:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c4:	8d 40 04             	lea    0x4(%eax),%eax
+  8006c7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006ca:	eb 17                	jmp    8006e3 <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  8006cc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006cf:	8b 50 04             	mov    0x4(%eax),%edx
+  8006d2:	8b 00                	mov    (%eax),%eax
+  8006d4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006d7:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006dd:	8d 40 08             	lea    0x8(%eax),%eax
+  8006e0:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8006e3:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006e6:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8006e9:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8006ee:	85 c9                	test   %ecx,%ecx
+  8006f0:	0f 89 03 01 00 00    	jns    8007f9 <vprintfmt+0x3b2>
+				putch('-', putdat);
+  8006f6:	83 ec 08             	sub    $0x8,%esp
+  8006f9:	53                   	push   %ebx
+  8006fa:	6a 2d                	push   $0x2d
+  8006fc:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8006fe:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800701:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800704:	f7 da                	neg    %edx
+  800706:	83 d1 00             	adc    $0x0,%ecx
+  800709:	f7 d9                	neg    %ecx
+  80070b:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80070e:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800713:	e9 e1 00 00 00       	jmp    8007f9 <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  800718:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071b:	8b 00                	mov    (%eax),%eax
+  80071d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800720:	89 c1                	mov    %eax,%ecx
+  800722:	c1 f9 1f             	sar    $0x1f,%ecx
+  800725:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800728:	8b 45 14             	mov    0x14(%ebp),%eax
+  80072b:	8d 40 04             	lea    0x4(%eax),%eax
+  80072e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800731:	eb b0                	jmp    8006e3 <vprintfmt+0x29c>
+	if (lflag >= 2)
+  800733:	83 f9 01             	cmp    $0x1,%ecx
+  800736:	7f 1e                	jg     800756 <vprintfmt+0x30f>
+	else if (lflag)
+  800738:	85 c9                	test   %ecx,%ecx
+  80073a:	74 32                	je     80076e <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  80073c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80073f:	8b 10                	mov    (%eax),%edx
+  800741:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800746:	8d 40 04             	lea    0x4(%eax),%eax
+  800749:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80074c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800751:	e9 a3 00 00 00       	jmp    8007f9 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800756:	8b 45 14             	mov    0x14(%ebp),%eax
+  800759:	8b 10                	mov    (%eax),%edx
+  80075b:	8b 48 04             	mov    0x4(%eax),%ecx
+  80075e:	8d 40 08             	lea    0x8(%eax),%eax
+  800761:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800764:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800769:	e9 8b 00 00 00       	jmp    8007f9 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  80076e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800771:	8b 10                	mov    (%eax),%edx
+  800773:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800778:	8d 40 04             	lea    0x4(%eax),%eax
+  80077b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80077e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800783:	eb 74                	jmp    8007f9 <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  800785:	83 f9 01             	cmp    $0x1,%ecx
+  800788:	7f 1b                	jg     8007a5 <vprintfmt+0x35e>
+	else if (lflag)
+  80078a:	85 c9                	test   %ecx,%ecx
+  80078c:	74 2c                	je     8007ba <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  80078e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800791:	8b 10                	mov    (%eax),%edx
+  800793:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800798:	8d 40 04             	lea    0x4(%eax),%eax
+  80079b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80079e:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8007a3:	eb 54                	jmp    8007f9 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8007a5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a8:	8b 10                	mov    (%eax),%edx
+  8007aa:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007ad:	8d 40 08             	lea    0x8(%eax),%eax
+  8007b0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007b3:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8007b8:	eb 3f                	jmp    8007f9 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8007ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007bd:	8b 10                	mov    (%eax),%edx
+  8007bf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007c4:	8d 40 04             	lea    0x4(%eax),%eax
+  8007c7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007ca:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8007cf:	eb 28                	jmp    8007f9 <vprintfmt+0x3b2>
+			putch('0', putdat);
+  8007d1:	83 ec 08             	sub    $0x8,%esp
+  8007d4:	53                   	push   %ebx
+  8007d5:	6a 30                	push   $0x30
+  8007d7:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8007d9:	83 c4 08             	add    $0x8,%esp
+  8007dc:	53                   	push   %ebx
+  8007dd:	6a 78                	push   $0x78
+  8007df:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8007e1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e4:	8b 10                	mov    (%eax),%edx
+  8007e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8007eb:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8007ee:	8d 40 04             	lea    0x4(%eax),%eax
+  8007f1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007f4:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8007f9:	83 ec 0c             	sub    $0xc,%esp
+  8007fc:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800800:	50                   	push   %eax
+  800801:	ff 75 e0             	push   -0x20(%ebp)
+  800804:	57                   	push   %edi
+  800805:	51                   	push   %ecx
+  800806:	52                   	push   %edx
+  800807:	89 da                	mov    %ebx,%edx
+  800809:	89 f0                	mov    %esi,%eax
+  80080b:	e8 54 fb ff ff       	call   800364 <printnum>
+			break;
+  800810:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800813:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  800816:	e9 4a fc ff ff       	jmp    800465 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  80081b:	83 f9 01             	cmp    $0x1,%ecx
+  80081e:	7f 1b                	jg     80083b <vprintfmt+0x3f4>
+	else if (lflag)
+  800820:	85 c9                	test   %ecx,%ecx
+  800822:	74 2c                	je     800850 <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  800824:	8b 45 14             	mov    0x14(%ebp),%eax
+  800827:	8b 10                	mov    (%eax),%edx
+  800829:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80082e:	8d 40 04             	lea    0x4(%eax),%eax
+  800831:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800834:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800839:	eb be                	jmp    8007f9 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  80083b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80083e:	8b 10                	mov    (%eax),%edx
+  800840:	8b 48 04             	mov    0x4(%eax),%ecx
+  800843:	8d 40 08             	lea    0x8(%eax),%eax
+  800846:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800849:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80084e:	eb a9                	jmp    8007f9 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800850:	8b 45 14             	mov    0x14(%ebp),%eax
+  800853:	8b 10                	mov    (%eax),%edx
+  800855:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80085a:	8d 40 04             	lea    0x4(%eax),%eax
+  80085d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800860:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800865:	eb 92                	jmp    8007f9 <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  800867:	83 ec 08             	sub    $0x8,%esp
+  80086a:	53                   	push   %ebx
+  80086b:	6a 25                	push   $0x25
+  80086d:	ff d6                	call   *%esi
+			break;
+  80086f:	83 c4 10             	add    $0x10,%esp
+  800872:	eb 9f                	jmp    800813 <vprintfmt+0x3cc>
+			putch('%', putdat);
+  800874:	83 ec 08             	sub    $0x8,%esp
+  800877:	53                   	push   %ebx
+  800878:	6a 25                	push   $0x25
+  80087a:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80087c:	83 c4 10             	add    $0x10,%esp
+  80087f:	89 f8                	mov    %edi,%eax
+  800881:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800885:	74 05                	je     80088c <vprintfmt+0x445>
+  800887:	83 e8 01             	sub    $0x1,%eax
+  80088a:	eb f5                	jmp    800881 <vprintfmt+0x43a>
+  80088c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80088f:	eb 82                	jmp    800813 <vprintfmt+0x3cc>
+
+00800891 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800891:	55                   	push   %ebp
+  800892:	89 e5                	mov    %esp,%ebp
+  800894:	83 ec 18             	sub    $0x18,%esp
+  800897:	8b 45 08             	mov    0x8(%ebp),%eax
+  80089a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80089d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8008a0:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8008a4:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8008a7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8008ae:	85 c0                	test   %eax,%eax
+  8008b0:	74 26                	je     8008d8 <vsnprintf+0x47>
+  8008b2:	85 d2                	test   %edx,%edx
+  8008b4:	7e 22                	jle    8008d8 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8008b6:	ff 75 14             	push   0x14(%ebp)
+  8008b9:	ff 75 10             	push   0x10(%ebp)
+  8008bc:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8008bf:	50                   	push   %eax
+  8008c0:	68 0d 04 80 00       	push   $0x80040d
+  8008c5:	e8 7d fb ff ff       	call   800447 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8008ca:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8008cd:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8008d0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008d3:	83 c4 10             	add    $0x10,%esp
+}
+  8008d6:	c9                   	leave
+  8008d7:	c3                   	ret
+		return -E_INVAL;
+  8008d8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008dd:	eb f7                	jmp    8008d6 <vsnprintf+0x45>
+
+008008df <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8008df:	55                   	push   %ebp
+  8008e0:	89 e5                	mov    %esp,%ebp
+  8008e2:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8008e5:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8008e8:	50                   	push   %eax
+  8008e9:	ff 75 10             	push   0x10(%ebp)
+  8008ec:	ff 75 0c             	push   0xc(%ebp)
+  8008ef:	ff 75 08             	push   0x8(%ebp)
+  8008f2:	e8 9a ff ff ff       	call   800891 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8008f7:	c9                   	leave
+  8008f8:	c3                   	ret
+
+008008f9 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8008f9:	55                   	push   %ebp
+  8008fa:	89 e5                	mov    %esp,%ebp
+  8008fc:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8008ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800904:	eb 03                	jmp    800909 <strlen+0x10>
+		n++;
+  800906:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800909:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80090d:	75 f7                	jne    800906 <strlen+0xd>
+	return n;
+}
+  80090f:	5d                   	pop    %ebp
+  800910:	c3                   	ret
+
+00800911 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800911:	55                   	push   %ebp
+  800912:	89 e5                	mov    %esp,%ebp
+  800914:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800917:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80091a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80091f:	eb 03                	jmp    800924 <strnlen+0x13>
+		n++;
+  800921:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800924:	39 d0                	cmp    %edx,%eax
+  800926:	74 08                	je     800930 <strnlen+0x1f>
+  800928:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80092c:	75 f3                	jne    800921 <strnlen+0x10>
+  80092e:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800930:	89 d0                	mov    %edx,%eax
+  800932:	5d                   	pop    %ebp
+  800933:	c3                   	ret
+
+00800934 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800934:	55                   	push   %ebp
+  800935:	89 e5                	mov    %esp,%ebp
+  800937:	53                   	push   %ebx
+  800938:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80093b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80093e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800943:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800947:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80094a:	83 c0 01             	add    $0x1,%eax
+  80094d:	84 d2                	test   %dl,%dl
+  80094f:	75 f2                	jne    800943 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800951:	89 c8                	mov    %ecx,%eax
+  800953:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800956:	c9                   	leave
+  800957:	c3                   	ret
+
+00800958 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800958:	55                   	push   %ebp
+  800959:	89 e5                	mov    %esp,%ebp
+  80095b:	53                   	push   %ebx
+  80095c:	83 ec 10             	sub    $0x10,%esp
+  80095f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800962:	53                   	push   %ebx
+  800963:	e8 91 ff ff ff       	call   8008f9 <strlen>
+  800968:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80096b:	ff 75 0c             	push   0xc(%ebp)
+  80096e:	01 d8                	add    %ebx,%eax
+  800970:	50                   	push   %eax
+  800971:	e8 be ff ff ff       	call   800934 <strcpy>
+	return dst;
+}
+  800976:	89 d8                	mov    %ebx,%eax
+  800978:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80097b:	c9                   	leave
+  80097c:	c3                   	ret
+
+0080097d <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80097d:	55                   	push   %ebp
+  80097e:	89 e5                	mov    %esp,%ebp
+  800980:	56                   	push   %esi
+  800981:	53                   	push   %ebx
+  800982:	8b 75 08             	mov    0x8(%ebp),%esi
+  800985:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800988:	89 f3                	mov    %esi,%ebx
+  80098a:	03 5d 10             	add    0x10(%ebp),%ebx
+  80098d:	89 f0                	mov    %esi,%eax
+  80098f:	eb 0f                	jmp    8009a0 <strncpy+0x23>
+		*dst++ = *src;
+  800991:	83 c0 01             	add    $0x1,%eax
+  800994:	0f b6 0a             	movzbl (%edx),%ecx
+  800997:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80099a:	80 f9 01             	cmp    $0x1,%cl
+  80099d:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8009a0:	39 d8                	cmp    %ebx,%eax
+  8009a2:	75 ed                	jne    800991 <strncpy+0x14>
+	}
+	return ret;
+}
+  8009a4:	89 f0                	mov    %esi,%eax
+  8009a6:	5b                   	pop    %ebx
+  8009a7:	5e                   	pop    %esi
+  8009a8:	5d                   	pop    %ebp
+  8009a9:	c3                   	ret
+
+008009aa <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8009aa:	55                   	push   %ebp
+  8009ab:	89 e5                	mov    %esp,%ebp
+  8009ad:	56                   	push   %esi
+  8009ae:	53                   	push   %ebx
+  8009af:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009b2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009b5:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8009b8:	89 f0                	mov    %esi,%eax
+  8009ba:	85 d2                	test   %edx,%edx
+  8009bc:	74 21                	je     8009df <strlcpy+0x35>
+  8009be:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8009c2:	89 f2                	mov    %esi,%edx
+  8009c4:	eb 09                	jmp    8009cf <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8009c6:	83 c1 01             	add    $0x1,%ecx
+  8009c9:	83 c2 01             	add    $0x1,%edx
+  8009cc:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8009cf:	39 c2                	cmp    %eax,%edx
+  8009d1:	74 09                	je     8009dc <strlcpy+0x32>
+  8009d3:	0f b6 19             	movzbl (%ecx),%ebx
+  8009d6:	84 db                	test   %bl,%bl
+  8009d8:	75 ec                	jne    8009c6 <strlcpy+0x1c>
+  8009da:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8009dc:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8009df:	29 f0                	sub    %esi,%eax
+}
+  8009e1:	5b                   	pop    %ebx
+  8009e2:	5e                   	pop    %esi
+  8009e3:	5d                   	pop    %ebp
+  8009e4:	c3                   	ret
+
+008009e5 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8009e5:	55                   	push   %ebp
+  8009e6:	89 e5                	mov    %esp,%ebp
+  8009e8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009eb:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8009ee:	eb 06                	jmp    8009f6 <strcmp+0x11>
+		p++, q++;
+  8009f0:	83 c1 01             	add    $0x1,%ecx
+  8009f3:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8009f6:	0f b6 01             	movzbl (%ecx),%eax
+  8009f9:	84 c0                	test   %al,%al
+  8009fb:	74 04                	je     800a01 <strcmp+0x1c>
+  8009fd:	3a 02                	cmp    (%edx),%al
+  8009ff:	74 ef                	je     8009f0 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a01:	0f b6 c0             	movzbl %al,%eax
+  800a04:	0f b6 12             	movzbl (%edx),%edx
+  800a07:	29 d0                	sub    %edx,%eax
+}
+  800a09:	5d                   	pop    %ebp
+  800a0a:	c3                   	ret
+
+00800a0b <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800a0b:	55                   	push   %ebp
+  800a0c:	89 e5                	mov    %esp,%ebp
+  800a0e:	53                   	push   %ebx
+  800a0f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a12:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a15:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800a18:	eb 09                	jmp    800a23 <strncmp+0x18>
+		n--, p++, q++;
+  800a1a:	83 ea 01             	sub    $0x1,%edx
+  800a1d:	83 c0 01             	add    $0x1,%eax
+  800a20:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800a23:	85 d2                	test   %edx,%edx
+  800a25:	74 18                	je     800a3f <strncmp+0x34>
+  800a27:	0f b6 18             	movzbl (%eax),%ebx
+  800a2a:	84 db                	test   %bl,%bl
+  800a2c:	74 04                	je     800a32 <strncmp+0x27>
+  800a2e:	3a 19                	cmp    (%ecx),%bl
+  800a30:	74 e8                	je     800a1a <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a32:	0f b6 00             	movzbl (%eax),%eax
+  800a35:	0f b6 11             	movzbl (%ecx),%edx
+  800a38:	29 d0                	sub    %edx,%eax
+}
+  800a3a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a3d:	c9                   	leave
+  800a3e:	c3                   	ret
+		return 0;
+  800a3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a44:	eb f4                	jmp    800a3a <strncmp+0x2f>
+
+00800a46 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a46:	55                   	push   %ebp
+  800a47:	89 e5                	mov    %esp,%ebp
+  800a49:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a4c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a50:	eb 03                	jmp    800a55 <strchr+0xf>
+  800a52:	83 c0 01             	add    $0x1,%eax
+  800a55:	0f b6 10             	movzbl (%eax),%edx
+  800a58:	84 d2                	test   %dl,%dl
+  800a5a:	74 06                	je     800a62 <strchr+0x1c>
+		if (*s == c)
+  800a5c:	38 ca                	cmp    %cl,%dl
+  800a5e:	75 f2                	jne    800a52 <strchr+0xc>
+  800a60:	eb 05                	jmp    800a67 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800a62:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a67:	5d                   	pop    %ebp
+  800a68:	c3                   	ret
+
+00800a69 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a69:	55                   	push   %ebp
+  800a6a:	89 e5                	mov    %esp,%ebp
+  800a6c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a6f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a73:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a76:	38 ca                	cmp    %cl,%dl
+  800a78:	74 09                	je     800a83 <strfind+0x1a>
+  800a7a:	84 d2                	test   %dl,%dl
+  800a7c:	74 05                	je     800a83 <strfind+0x1a>
+	for (; *s; s++)
+  800a7e:	83 c0 01             	add    $0x1,%eax
+  800a81:	eb f0                	jmp    800a73 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a83:	5d                   	pop    %ebp
+  800a84:	c3                   	ret
+
+00800a85 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a85:	55                   	push   %ebp
+  800a86:	89 e5                	mov    %esp,%ebp
+  800a88:	57                   	push   %edi
+  800a89:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a8c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a8f:	85 c9                	test   %ecx,%ecx
+  800a91:	74 20                	je     800ab3 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a93:	89 f8                	mov    %edi,%eax
+  800a95:	09 c8                	or     %ecx,%eax
+  800a97:	a8 03                	test   $0x3,%al
+  800a99:	75 12                	jne    800aad <memset+0x28>
+		c &= 0xFF;
+  800a9b:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a9f:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800aa5:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800aa8:	fc                   	cld
+  800aa9:	f3 ab                	rep stos %eax,%es:(%edi)
+  800aab:	eb 06                	jmp    800ab3 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800aad:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ab0:	fc                   	cld
+  800ab1:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800ab3:	89 f8                	mov    %edi,%eax
+  800ab5:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800ab8:	c9                   	leave
+  800ab9:	c3                   	ret
+
+00800aba <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800aba:	55                   	push   %ebp
+  800abb:	89 e5                	mov    %esp,%ebp
+  800abd:	57                   	push   %edi
+  800abe:	56                   	push   %esi
+  800abf:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ac2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800ac5:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800ac8:	39 c6                	cmp    %eax,%esi
+  800aca:	73 32                	jae    800afe <memmove+0x44>
+  800acc:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800acf:	39 d0                	cmp    %edx,%eax
+  800ad1:	73 2b                	jae    800afe <memmove+0x44>
+		s += n;
+		d += n;
+  800ad3:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ad6:	89 d6                	mov    %edx,%esi
+  800ad8:	09 fe                	or     %edi,%esi
+  800ada:	09 ce                	or     %ecx,%esi
+  800adc:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800ae2:	75 0e                	jne    800af2 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800ae4:	83 ef 04             	sub    $0x4,%edi
+  800ae7:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800aea:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800aed:	fd                   	std
+  800aee:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800af0:	eb 09                	jmp    800afb <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800af2:	83 ef 01             	sub    $0x1,%edi
+  800af5:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800af8:	fd                   	std
+  800af9:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800afb:	fc                   	cld
+  800afc:	eb 1a                	jmp    800b18 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800afe:	89 f2                	mov    %esi,%edx
+  800b00:	09 c2                	or     %eax,%edx
+  800b02:	09 ca                	or     %ecx,%edx
+  800b04:	f6 c2 03             	test   $0x3,%dl
+  800b07:	75 0a                	jne    800b13 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800b09:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800b0c:	89 c7                	mov    %eax,%edi
+  800b0e:	fc                   	cld
+  800b0f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b11:	eb 05                	jmp    800b18 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800b13:	89 c7                	mov    %eax,%edi
+  800b15:	fc                   	cld
+  800b16:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800b18:	5e                   	pop    %esi
+  800b19:	5f                   	pop    %edi
+  800b1a:	5d                   	pop    %ebp
+  800b1b:	c3                   	ret
+
+00800b1c <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800b1c:	55                   	push   %ebp
+  800b1d:	89 e5                	mov    %esp,%ebp
+  800b1f:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800b22:	ff 75 10             	push   0x10(%ebp)
+  800b25:	ff 75 0c             	push   0xc(%ebp)
+  800b28:	ff 75 08             	push   0x8(%ebp)
+  800b2b:	e8 8a ff ff ff       	call   800aba <memmove>
+}
+  800b30:	c9                   	leave
+  800b31:	c3                   	ret
+
+00800b32 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800b32:	55                   	push   %ebp
+  800b33:	89 e5                	mov    %esp,%ebp
+  800b35:	56                   	push   %esi
+  800b36:	53                   	push   %ebx
+  800b37:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b3a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800b3d:	89 c6                	mov    %eax,%esi
+  800b3f:	03 75 10             	add    0x10(%ebp),%esi
+  800b42:	eb 06                	jmp    800b4a <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b44:	83 c0 01             	add    $0x1,%eax
+  800b47:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b4a:	39 f0                	cmp    %esi,%eax
+  800b4c:	74 14                	je     800b62 <memcmp+0x30>
+		if (*s1 != *s2)
+  800b4e:	0f b6 08             	movzbl (%eax),%ecx
+  800b51:	0f b6 1a             	movzbl (%edx),%ebx
+  800b54:	38 d9                	cmp    %bl,%cl
+  800b56:	74 ec                	je     800b44 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800b58:	0f b6 c1             	movzbl %cl,%eax
+  800b5b:	0f b6 db             	movzbl %bl,%ebx
+  800b5e:	29 d8                	sub    %ebx,%eax
+  800b60:	eb 05                	jmp    800b67 <memcmp+0x35>
+	}
+
+	return 0;
+  800b62:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b67:	5b                   	pop    %ebx
+  800b68:	5e                   	pop    %esi
+  800b69:	5d                   	pop    %ebp
+  800b6a:	c3                   	ret
+
+00800b6b <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b6b:	55                   	push   %ebp
+  800b6c:	89 e5                	mov    %esp,%ebp
+  800b6e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b71:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b74:	89 c2                	mov    %eax,%edx
+  800b76:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b79:	eb 03                	jmp    800b7e <memfind+0x13>
+  800b7b:	83 c0 01             	add    $0x1,%eax
+  800b7e:	39 d0                	cmp    %edx,%eax
+  800b80:	73 04                	jae    800b86 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b82:	38 08                	cmp    %cl,(%eax)
+  800b84:	75 f5                	jne    800b7b <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b86:	5d                   	pop    %ebp
+  800b87:	c3                   	ret
+
+00800b88 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b88:	55                   	push   %ebp
+  800b89:	89 e5                	mov    %esp,%ebp
+  800b8b:	57                   	push   %edi
+  800b8c:	56                   	push   %esi
+  800b8d:	53                   	push   %ebx
+  800b8e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b91:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b94:	eb 03                	jmp    800b99 <strtol+0x11>
+		s++;
+  800b96:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800b99:	0f b6 02             	movzbl (%edx),%eax
+  800b9c:	3c 20                	cmp    $0x20,%al
+  800b9e:	74 f6                	je     800b96 <strtol+0xe>
+  800ba0:	3c 09                	cmp    $0x9,%al
+  800ba2:	74 f2                	je     800b96 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800ba4:	3c 2b                	cmp    $0x2b,%al
+  800ba6:	74 2a                	je     800bd2 <strtol+0x4a>
+	int neg = 0;
+  800ba8:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800bad:	3c 2d                	cmp    $0x2d,%al
+  800baf:	74 2b                	je     800bdc <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bb1:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800bb7:	75 0f                	jne    800bc8 <strtol+0x40>
+  800bb9:	80 3a 30             	cmpb   $0x30,(%edx)
+  800bbc:	74 28                	je     800be6 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800bbe:	85 db                	test   %ebx,%ebx
+  800bc0:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800bc5:	0f 44 d8             	cmove  %eax,%ebx
+  800bc8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bcd:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800bd0:	eb 46                	jmp    800c18 <strtol+0x90>
+		s++;
+  800bd2:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800bd5:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bda:	eb d5                	jmp    800bb1 <strtol+0x29>
+		s++, neg = 1;
+  800bdc:	83 c2 01             	add    $0x1,%edx
+  800bdf:	bf 01 00 00 00       	mov    $0x1,%edi
+  800be4:	eb cb                	jmp    800bb1 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800be6:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800bea:	74 0e                	je     800bfa <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800bec:	85 db                	test   %ebx,%ebx
+  800bee:	75 d8                	jne    800bc8 <strtol+0x40>
+		s++, base = 8;
+  800bf0:	83 c2 01             	add    $0x1,%edx
+  800bf3:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800bf8:	eb ce                	jmp    800bc8 <strtol+0x40>
+		s += 2, base = 16;
+  800bfa:	83 c2 02             	add    $0x2,%edx
+  800bfd:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800c02:	eb c4                	jmp    800bc8 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800c04:	0f be c0             	movsbl %al,%eax
+  800c07:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800c0a:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800c0d:	7d 3a                	jge    800c49 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800c0f:	83 c2 01             	add    $0x1,%edx
+  800c12:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800c16:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800c18:	0f b6 02             	movzbl (%edx),%eax
+  800c1b:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800c1e:	89 f3                	mov    %esi,%ebx
+  800c20:	80 fb 09             	cmp    $0x9,%bl
+  800c23:	76 df                	jbe    800c04 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800c25:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c28:	89 f3                	mov    %esi,%ebx
+  800c2a:	80 fb 19             	cmp    $0x19,%bl
+  800c2d:	77 08                	ja     800c37 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800c2f:	0f be c0             	movsbl %al,%eax
+  800c32:	83 e8 57             	sub    $0x57,%eax
+  800c35:	eb d3                	jmp    800c0a <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c37:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c3a:	89 f3                	mov    %esi,%ebx
+  800c3c:	80 fb 19             	cmp    $0x19,%bl
+  800c3f:	77 08                	ja     800c49 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800c41:	0f be c0             	movsbl %al,%eax
+  800c44:	83 e8 37             	sub    $0x37,%eax
+  800c47:	eb c1                	jmp    800c0a <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c49:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c4d:	74 05                	je     800c54 <strtol+0xcc>
+		*endptr = (char *) s;
+  800c4f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c52:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800c54:	89 c8                	mov    %ecx,%eax
+  800c56:	f7 d8                	neg    %eax
+  800c58:	85 ff                	test   %edi,%edi
+  800c5a:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800c5d:	89 c8                	mov    %ecx,%eax
+  800c5f:	5b                   	pop    %ebx
+  800c60:	5e                   	pop    %esi
+  800c61:	5f                   	pop    %edi
+  800c62:	5d                   	pop    %ebp
+  800c63:	c3                   	ret
+
+00800c64 <atoi>:
+
+int
+atoi(const char* s)
+{
+  800c64:	55                   	push   %ebp
+  800c65:	89 e5                	mov    %esp,%ebp
+  800c67:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  800c6a:	6a 00                	push   $0x0
+  800c6c:	6a 00                	push   $0x0
+  800c6e:	ff 75 08             	push   0x8(%ebp)
+  800c71:	e8 12 ff ff ff       	call   800b88 <strtol>
+}
+  800c76:	c9                   	leave
+  800c77:	c3                   	ret
+
+00800c78 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c78:	55                   	push   %ebp
+  800c79:	89 e5                	mov    %esp,%ebp
+  800c7b:	57                   	push   %edi
+  800c7c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c7d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c82:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c85:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c88:	89 c3                	mov    %eax,%ebx
+  800c8a:	89 c7                	mov    %eax,%edi
+  800c8c:	6a 00                	push   $0x0
+  800c8e:	55                   	push   %ebp
+  800c8f:	56                   	push   %esi
+  800c90:	89 e5                	mov    %esp,%ebp
+  800c92:	8d 35 9a 0c 80 00    	lea    0x800c9a,%esi
+  800c98:	0f 34                	sysenter
+
+00800c9a <after_sysenter_label_47>:
+  800c9a:	5e                   	pop    %esi
+  800c9b:	5d                   	pop    %ebp
+  800c9c:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c9f:	5b                   	pop    %ebx
+  800ca0:	5f                   	pop    %edi
+  800ca1:	5d                   	pop    %ebp
+  800ca2:	c3                   	ret
+
+00800ca3 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800ca3:	55                   	push   %ebp
+  800ca4:	89 e5                	mov    %esp,%ebp
+  800ca6:	57                   	push   %edi
+  800ca7:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ca8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cad:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cb2:	89 d1                	mov    %edx,%ecx
+  800cb4:	89 d3                	mov    %edx,%ebx
+  800cb6:	89 d7                	mov    %edx,%edi
+  800cb8:	6a 00                	push   $0x0
+  800cba:	55                   	push   %ebp
+  800cbb:	56                   	push   %esi
+  800cbc:	89 e5                	mov    %esp,%ebp
+  800cbe:	8d 35 c6 0c 80 00    	lea    0x800cc6,%esi
+  800cc4:	0f 34                	sysenter
+
+00800cc6 <after_sysenter_label_128>:
+  800cc6:	5e                   	pop    %esi
+  800cc7:	5d                   	pop    %ebp
+  800cc8:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800ccb:	5b                   	pop    %ebx
+  800ccc:	5f                   	pop    %edi
+  800ccd:	5d                   	pop    %ebp
+  800cce:	c3                   	ret
+
+00800ccf <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800ccf:	55                   	push   %ebp
+  800cd0:	89 e5                	mov    %esp,%ebp
+  800cd2:	57                   	push   %edi
+  800cd3:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800cd4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cd7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cdc:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ce1:	89 cb                	mov    %ecx,%ebx
+  800ce3:	89 cf                	mov    %ecx,%edi
+  800ce5:	6a 00                	push   $0x0
+  800ce7:	55                   	push   %ebp
+  800ce8:	56                   	push   %esi
+  800ce9:	89 e5                	mov    %esp,%ebp
+  800ceb:	8d 35 f3 0c 80 00    	lea    0x800cf3,%esi
+  800cf1:	0f 34                	sysenter
+
+00800cf3 <after_sysenter_label_212>:
+  800cf3:	5e                   	pop    %esi
+  800cf4:	5d                   	pop    %ebp
+  800cf5:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800cf8:	85 c0                	test   %eax,%eax
+  800cfa:	7f 07                	jg     800d03 <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800cfc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800cff:	5b                   	pop    %ebx
+  800d00:	5f                   	pop    %edi
+  800d01:	5d                   	pop    %ebp
+  800d02:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d03:	83 ec 0c             	sub    $0xc,%esp
+  800d06:	50                   	push   %eax
+  800d07:	6a 03                	push   $0x3
+  800d09:	68 d5 4c 80 00       	push   $0x804cd5
+  800d0e:	6a 54                	push   $0x54
+  800d10:	68 f2 4c 80 00       	push   $0x804cf2
+  800d15:	e8 5b f5 ff ff       	call   800275 <_panic>
+
+00800d1a <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800d1a:	55                   	push   %ebp
+  800d1b:	89 e5                	mov    %esp,%ebp
+  800d1d:	57                   	push   %edi
+  800d1e:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d1f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d24:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d29:	89 d1                	mov    %edx,%ecx
+  800d2b:	89 d3                	mov    %edx,%ebx
+  800d2d:	89 d7                	mov    %edx,%edi
+  800d2f:	6a 00                	push   $0x0
+  800d31:	55                   	push   %ebp
+  800d32:	56                   	push   %esi
+  800d33:	89 e5                	mov    %esp,%ebp
+  800d35:	8d 35 3d 0d 80 00    	lea    0x800d3d,%esi
+  800d3b:	0f 34                	sysenter
+
+00800d3d <after_sysenter_label_309>:
+  800d3d:	5e                   	pop    %esi
+  800d3e:	5d                   	pop    %ebp
+  800d3f:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800d42:	5b                   	pop    %ebx
+  800d43:	5f                   	pop    %edi
+  800d44:	5d                   	pop    %ebp
+  800d45:	c3                   	ret
+
+00800d46 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800d46:	55                   	push   %ebp
+  800d47:	89 e5                	mov    %esp,%ebp
+  800d49:	57                   	push   %edi
+  800d4a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d4b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d50:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d55:	89 d1                	mov    %edx,%ecx
+  800d57:	89 d3                	mov    %edx,%ebx
+  800d59:	89 d7                	mov    %edx,%edi
+  800d5b:	6a 00                	push   $0x0
+  800d5d:	55                   	push   %ebp
+  800d5e:	56                   	push   %esi
+  800d5f:	89 e5                	mov    %esp,%ebp
+  800d61:	8d 35 69 0d 80 00    	lea    0x800d69,%esi
+  800d67:	0f 34                	sysenter
+
+00800d69 <after_sysenter_label_391>:
+  800d69:	5e                   	pop    %esi
+  800d6a:	5d                   	pop    %ebp
+  800d6b:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d6e:	5b                   	pop    %ebx
+  800d6f:	5f                   	pop    %edi
+  800d70:	5d                   	pop    %ebp
+  800d71:	c3                   	ret
+
+00800d72 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d72:	55                   	push   %ebp
+  800d73:	89 e5                	mov    %esp,%ebp
+  800d75:	57                   	push   %edi
+  800d76:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d77:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d7a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d7d:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d82:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d87:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d8a:	6a 00                	push   $0x0
+  800d8c:	55                   	push   %ebp
+  800d8d:	56                   	push   %esi
+  800d8e:	89 e5                	mov    %esp,%ebp
+  800d90:	8d 35 98 0d 80 00    	lea    0x800d98,%esi
+  800d96:	0f 34                	sysenter
+
+00800d98 <after_sysenter_label_479>:
+  800d98:	5e                   	pop    %esi
+  800d99:	5d                   	pop    %ebp
+  800d9a:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d9d:	85 c0                	test   %eax,%eax
+  800d9f:	7f 07                	jg     800da8 <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800da1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800da4:	5b                   	pop    %ebx
+  800da5:	5f                   	pop    %edi
+  800da6:	5d                   	pop    %ebp
+  800da7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800da8:	83 ec 0c             	sub    $0xc,%esp
+  800dab:	50                   	push   %eax
+  800dac:	6a 04                	push   $0x4
+  800dae:	68 d5 4c 80 00       	push   $0x804cd5
+  800db3:	6a 54                	push   $0x54
+  800db5:	68 f2 4c 80 00       	push   $0x804cf2
+  800dba:	e8 b6 f4 ff ff       	call   800275 <_panic>
+
+00800dbf <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800dbf:	55                   	push   %ebp
+  800dc0:	89 e5                	mov    %esp,%ebp
+  800dc2:	57                   	push   %edi
+  800dc3:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800dc4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dca:	b8 05 00 00 00       	mov    $0x5,%eax
+  800dcf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dd2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dd5:	ff 75 18             	push   0x18(%ebp)
+  800dd8:	55                   	push   %ebp
+  800dd9:	56                   	push   %esi
+  800dda:	89 e5                	mov    %esp,%ebp
+  800ddc:	8d 35 e4 0d 80 00    	lea    0x800de4,%esi
+  800de2:	0f 34                	sysenter
+
+00800de4 <after_sysenter_label_593>:
+  800de4:	5e                   	pop    %esi
+  800de5:	5d                   	pop    %ebp
+  800de6:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800de9:	85 c0                	test   %eax,%eax
+  800deb:	7f 07                	jg     800df4 <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800ded:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800df0:	5b                   	pop    %ebx
+  800df1:	5f                   	pop    %edi
+  800df2:	5d                   	pop    %ebp
+  800df3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800df4:	83 ec 0c             	sub    $0xc,%esp
+  800df7:	50                   	push   %eax
+  800df8:	6a 05                	push   $0x5
+  800dfa:	68 d5 4c 80 00       	push   $0x804cd5
+  800dff:	6a 54                	push   $0x54
+  800e01:	68 f2 4c 80 00       	push   $0x804cf2
+  800e06:	e8 6a f4 ff ff       	call   800275 <_panic>
+
+00800e0b <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e0b:	55                   	push   %ebp
+  800e0c:	89 e5                	mov    %esp,%ebp
+  800e0e:	57                   	push   %edi
+  800e0f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e10:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e15:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e18:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e1b:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e20:	89 df                	mov    %ebx,%edi
+  800e22:	6a 00                	push   $0x0
+  800e24:	55                   	push   %ebp
+  800e25:	56                   	push   %esi
+  800e26:	89 e5                	mov    %esp,%ebp
+  800e28:	8d 35 30 0e 80 00    	lea    0x800e30,%esi
+  800e2e:	0f 34                	sysenter
+
+00800e30 <after_sysenter_label_704>:
+  800e30:	5e                   	pop    %esi
+  800e31:	5d                   	pop    %ebp
+  800e32:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e35:	85 c0                	test   %eax,%eax
+  800e37:	7f 07                	jg     800e40 <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e39:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e3c:	5b                   	pop    %ebx
+  800e3d:	5f                   	pop    %edi
+  800e3e:	5d                   	pop    %ebp
+  800e3f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e40:	83 ec 0c             	sub    $0xc,%esp
+  800e43:	50                   	push   %eax
+  800e44:	6a 06                	push   $0x6
+  800e46:	68 d5 4c 80 00       	push   $0x804cd5
+  800e4b:	6a 54                	push   $0x54
+  800e4d:	68 f2 4c 80 00       	push   $0x804cf2
+  800e52:	e8 1e f4 ff ff       	call   800275 <_panic>
+
+00800e57 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e57:	55                   	push   %ebp
+  800e58:	89 e5                	mov    %esp,%ebp
+  800e5a:	57                   	push   %edi
+  800e5b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e5c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e61:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e64:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e67:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e6c:	89 df                	mov    %ebx,%edi
+  800e6e:	6a 00                	push   $0x0
+  800e70:	55                   	push   %ebp
+  800e71:	56                   	push   %esi
+  800e72:	89 e5                	mov    %esp,%ebp
+  800e74:	8d 35 7c 0e 80 00    	lea    0x800e7c,%esi
+  800e7a:	0f 34                	sysenter
+
+00800e7c <after_sysenter_label_808>:
+  800e7c:	5e                   	pop    %esi
+  800e7d:	5d                   	pop    %ebp
+  800e7e:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e81:	85 c0                	test   %eax,%eax
+  800e83:	7f 07                	jg     800e8c <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800e85:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e88:	5b                   	pop    %ebx
+  800e89:	5f                   	pop    %edi
+  800e8a:	5d                   	pop    %ebp
+  800e8b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e8c:	83 ec 0c             	sub    $0xc,%esp
+  800e8f:	50                   	push   %eax
+  800e90:	6a 08                	push   $0x8
+  800e92:	68 d5 4c 80 00       	push   $0x804cd5
+  800e97:	6a 54                	push   $0x54
+  800e99:	68 f2 4c 80 00       	push   $0x804cf2
+  800e9e:	e8 d2 f3 ff ff       	call   800275 <_panic>
+
+00800ea3 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800ea3:	55                   	push   %ebp
+  800ea4:	89 e5                	mov    %esp,%ebp
+  800ea6:	57                   	push   %edi
+  800ea7:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ea8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ead:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb3:	b8 09 00 00 00       	mov    $0x9,%eax
+  800eb8:	89 df                	mov    %ebx,%edi
+  800eba:	6a 00                	push   $0x0
+  800ebc:	55                   	push   %ebp
+  800ebd:	56                   	push   %esi
+  800ebe:	89 e5                	mov    %esp,%ebp
+  800ec0:	8d 35 c8 0e 80 00    	lea    0x800ec8,%esi
+  800ec6:	0f 34                	sysenter
+
+00800ec8 <after_sysenter_label_912>:
+  800ec8:	5e                   	pop    %esi
+  800ec9:	5d                   	pop    %ebp
+  800eca:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800ecd:	85 c0                	test   %eax,%eax
+  800ecf:	7f 07                	jg     800ed8 <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800ed1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ed4:	5b                   	pop    %ebx
+  800ed5:	5f                   	pop    %edi
+  800ed6:	5d                   	pop    %ebp
+  800ed7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ed8:	83 ec 0c             	sub    $0xc,%esp
+  800edb:	50                   	push   %eax
+  800edc:	6a 09                	push   $0x9
+  800ede:	68 d5 4c 80 00       	push   $0x804cd5
+  800ee3:	6a 54                	push   $0x54
+  800ee5:	68 f2 4c 80 00       	push   $0x804cf2
+  800eea:	e8 86 f3 ff ff       	call   800275 <_panic>
+
+00800eef <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800eef:	55                   	push   %ebp
+  800ef0:	89 e5                	mov    %esp,%ebp
+  800ef2:	57                   	push   %edi
+  800ef3:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ef4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ef9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800efc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eff:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f04:	89 df                	mov    %ebx,%edi
+  800f06:	6a 00                	push   $0x0
+  800f08:	55                   	push   %ebp
+  800f09:	56                   	push   %esi
+  800f0a:	89 e5                	mov    %esp,%ebp
+  800f0c:	8d 35 14 0f 80 00    	lea    0x800f14,%esi
+  800f12:	0f 34                	sysenter
+
+00800f14 <after_sysenter_label_1016>:
+  800f14:	5e                   	pop    %esi
+  800f15:	5d                   	pop    %ebp
+  800f16:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800f19:	85 c0                	test   %eax,%eax
+  800f1b:	7f 07                	jg     800f24 <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800f1d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f20:	5b                   	pop    %ebx
+  800f21:	5f                   	pop    %edi
+  800f22:	5d                   	pop    %ebp
+  800f23:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f24:	83 ec 0c             	sub    $0xc,%esp
+  800f27:	50                   	push   %eax
+  800f28:	6a 0a                	push   $0xa
+  800f2a:	68 d5 4c 80 00       	push   $0x804cd5
+  800f2f:	6a 54                	push   $0x54
+  800f31:	68 f2 4c 80 00       	push   $0x804cf2
+  800f36:	e8 3a f3 ff ff       	call   800275 <_panic>
+
+00800f3b <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800f3b:	55                   	push   %ebp
+  800f3c:	89 e5                	mov    %esp,%ebp
+  800f3e:	57                   	push   %edi
+  800f3f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f40:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f43:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f46:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f4b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f4e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f51:	6a 00                	push   $0x0
+  800f53:	55                   	push   %ebp
+  800f54:	56                   	push   %esi
+  800f55:	89 e5                	mov    %esp,%ebp
+  800f57:	8d 35 5f 0f 80 00    	lea    0x800f5f,%esi
+  800f5d:	0f 34                	sysenter
+
+00800f5f <after_sysenter_label_1126>:
+  800f5f:	5e                   	pop    %esi
+  800f60:	5d                   	pop    %ebp
+  800f61:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800f64:	5b                   	pop    %ebx
+  800f65:	5f                   	pop    %edi
+  800f66:	5d                   	pop    %ebp
+  800f67:	c3                   	ret
+
+00800f68 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800f68:	55                   	push   %ebp
+  800f69:	89 e5                	mov    %esp,%ebp
+  800f6b:	57                   	push   %edi
+  800f6c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f6d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f70:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f75:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f7a:	89 cb                	mov    %ecx,%ebx
+  800f7c:	89 cf                	mov    %ecx,%edi
+  800f7e:	6a 00                	push   $0x0
+  800f80:	55                   	push   %ebp
+  800f81:	56                   	push   %esi
+  800f82:	89 e5                	mov    %esp,%ebp
+  800f84:	8d 35 8c 0f 80 00    	lea    0x800f8c,%esi
+  800f8a:	0f 34                	sysenter
+
+00800f8c <after_sysenter_label_1210>:
+  800f8c:	5e                   	pop    %esi
+  800f8d:	5d                   	pop    %ebp
+  800f8e:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800f91:	85 c0                	test   %eax,%eax
+  800f93:	7f 07                	jg     800f9c <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800f95:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f98:	5b                   	pop    %ebx
+  800f99:	5f                   	pop    %edi
+  800f9a:	5d                   	pop    %ebp
+  800f9b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f9c:	83 ec 0c             	sub    $0xc,%esp
+  800f9f:	50                   	push   %eax
+  800fa0:	6a 0d                	push   $0xd
+  800fa2:	68 d5 4c 80 00       	push   $0x804cd5
+  800fa7:	6a 54                	push   $0x54
+  800fa9:	68 f2 4c 80 00       	push   $0x804cf2
+  800fae:	e8 c2 f2 ff ff       	call   800275 <_panic>
+
+00800fb3 <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  800fb3:	55                   	push   %ebp
+  800fb4:	89 e5                	mov    %esp,%ebp
+  800fb6:	57                   	push   %edi
+  800fb7:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fb8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fbd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fc3:	b8 42 00 00 00       	mov    $0x42,%eax
+  800fc8:	89 df                	mov    %ebx,%edi
+  800fca:	6a 00                	push   $0x0
+  800fcc:	55                   	push   %ebp
+  800fcd:	56                   	push   %esi
+  800fce:	89 e5                	mov    %esp,%ebp
+  800fd0:	8d 35 d8 0f 80 00    	lea    0x800fd8,%esi
+  800fd6:	0f 34                	sysenter
+
+00800fd8 <after_sysenter_label_1311>:
+  800fd8:	5e                   	pop    %esi
+  800fd9:	5d                   	pop    %ebp
+  800fda:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800fdd:	85 c0                	test   %eax,%eax
+  800fdf:	7f 07                	jg     800fe8 <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  800fe1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fe4:	5b                   	pop    %ebx
+  800fe5:	5f                   	pop    %edi
+  800fe6:	5d                   	pop    %ebp
+  800fe7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fe8:	83 ec 0c             	sub    $0xc,%esp
+  800feb:	50                   	push   %eax
+  800fec:	6a 42                	push   $0x42
+  800fee:	68 d5 4c 80 00       	push   $0x804cd5
+  800ff3:	6a 54                	push   $0x54
+  800ff5:	68 f2 4c 80 00       	push   $0x804cf2
+  800ffa:	e8 76 f2 ff ff       	call   800275 <_panic>
+
+00800fff <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800fff:	55                   	push   %ebp
+  801000:	89 e5                	mov    %esp,%ebp
+  801002:	57                   	push   %edi
+  801003:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801004:	ba 00 00 00 00       	mov    $0x0,%edx
+  801009:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80100e:	89 d1                	mov    %edx,%ecx
+  801010:	89 d3                	mov    %edx,%ebx
+  801012:	89 d7                	mov    %edx,%edi
+  801014:	6a 00                	push   $0x0
+  801016:	55                   	push   %ebp
+  801017:	56                   	push   %esi
+  801018:	89 e5                	mov    %esp,%ebp
+  80101a:	8d 35 22 10 80 00    	lea    0x801022,%esi
+  801020:	0f 34                	sysenter
+
+00801022 <after_sysenter_label_1411>:
+  801022:	5e                   	pop    %esi
+  801023:	5d                   	pop    %ebp
+  801024:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801027:	5b                   	pop    %ebx
+  801028:	5f                   	pop    %edi
+  801029:	5d                   	pop    %ebp
+  80102a:	c3                   	ret
+
+0080102b <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  80102b:	55                   	push   %ebp
+  80102c:	89 e5                	mov    %esp,%ebp
+  80102e:	57                   	push   %edi
+  80102f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801030:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801035:	8b 55 08             	mov    0x8(%ebp),%edx
+  801038:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80103b:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801040:	89 df                	mov    %ebx,%edi
+  801042:	6a 00                	push   $0x0
+  801044:	55                   	push   %ebp
+  801045:	56                   	push   %esi
+  801046:	89 e5                	mov    %esp,%ebp
+  801048:	8d 35 50 10 80 00    	lea    0x801050,%esi
+  80104e:	0f 34                	sysenter
+
+00801050 <after_sysenter_label_1497>:
+  801050:	5e                   	pop    %esi
+  801051:	5d                   	pop    %ebp
+  801052:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  801055:	5b                   	pop    %ebx
+  801056:	5f                   	pop    %edi
+  801057:	5d                   	pop    %ebp
+  801058:	c3                   	ret
+
+00801059 <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  801059:	55                   	push   %ebp
+  80105a:	89 e5                	mov    %esp,%ebp
+  80105c:	57                   	push   %edi
+  80105d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80105e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801063:	8b 55 08             	mov    0x8(%ebp),%edx
+  801066:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801069:	b8 10 00 00 00       	mov    $0x10,%eax
+  80106e:	89 df                	mov    %ebx,%edi
+  801070:	6a 00                	push   $0x0
+  801072:	55                   	push   %ebp
+  801073:	56                   	push   %esi
+  801074:	89 e5                	mov    %esp,%ebp
+  801076:	8d 35 7e 10 80 00    	lea    0x80107e,%esi
+  80107c:	0f 34                	sysenter
+
+0080107e <after_sysenter_label_1583>:
+  80107e:	5e                   	pop    %esi
+  80107f:	5d                   	pop    %ebp
+  801080:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  801083:	5b                   	pop    %ebx
+  801084:	5f                   	pop    %edi
+  801085:	5d                   	pop    %ebp
+  801086:	c3                   	ret
+
+00801087 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  801087:	55                   	push   %ebp
+  801088:	89 e5                	mov    %esp,%ebp
+  80108a:	57                   	push   %edi
+  80108b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80108c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80108f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801092:	b8 11 00 00 00       	mov    $0x11,%eax
+  801097:	bf 00 00 00 00       	mov    $0x0,%edi
+  80109c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80109f:	6a 00                	push   $0x0
+  8010a1:	55                   	push   %ebp
+  8010a2:	56                   	push   %esi
+  8010a3:	89 e5                	mov    %esp,%ebp
+  8010a5:	8d 35 ad 10 80 00    	lea    0x8010ad,%esi
+  8010ab:	0f 34                	sysenter
+
+008010ad <after_sysenter_label_1672>:
+  8010ad:	5e                   	pop    %esi
+  8010ae:	5d                   	pop    %ebp
+  8010af:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  8010b2:	5b                   	pop    %ebx
+  8010b3:	5f                   	pop    %edi
+  8010b4:	5d                   	pop    %ebp
+  8010b5:	c3                   	ret
+
+008010b6 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  8010b6:	55                   	push   %ebp
+  8010b7:	89 e5                	mov    %esp,%ebp
+  8010b9:	57                   	push   %edi
+  8010ba:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010bb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c6:	b8 12 00 00 00       	mov    $0x12,%eax
+  8010cb:	89 df                	mov    %ebx,%edi
+  8010cd:	6a 00                	push   $0x0
+  8010cf:	55                   	push   %ebp
+  8010d0:	56                   	push   %esi
+  8010d1:	89 e5                	mov    %esp,%ebp
+  8010d3:	8d 35 db 10 80 00    	lea    0x8010db,%esi
+  8010d9:	0f 34                	sysenter
+
+008010db <after_sysenter_label_1758>:
+  8010db:	5e                   	pop    %esi
+  8010dc:	5d                   	pop    %ebp
+  8010dd:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  8010e0:	5b                   	pop    %ebx
+  8010e1:	5f                   	pop    %edi
+  8010e2:	5d                   	pop    %ebp
+  8010e3:	c3                   	ret
+
+008010e4 <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  8010e4:	55                   	push   %ebp
+  8010e5:	89 e5                	mov    %esp,%ebp
+  8010e7:	57                   	push   %edi
+  8010e8:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010f1:	b8 13 00 00 00       	mov    $0x13,%eax
+  8010f6:	89 cb                	mov    %ecx,%ebx
+  8010f8:	89 cf                	mov    %ecx,%edi
+  8010fa:	6a 00                	push   $0x0
+  8010fc:	55                   	push   %ebp
+  8010fd:	56                   	push   %esi
+  8010fe:	89 e5                	mov    %esp,%ebp
+  801100:	8d 35 08 11 80 00    	lea    0x801108,%esi
+  801106:	0f 34                	sysenter
+
+00801108 <after_sysenter_label_1842>:
+  801108:	5e                   	pop    %esi
+  801109:	5d                   	pop    %ebp
+  80110a:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80110d:	85 c0                	test   %eax,%eax
+  80110f:	7f 07                	jg     801118 <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  801111:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801114:	5b                   	pop    %ebx
+  801115:	5f                   	pop    %edi
+  801116:	5d                   	pop    %ebp
+  801117:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801118:	83 ec 0c             	sub    $0xc,%esp
+  80111b:	50                   	push   %eax
+  80111c:	6a 13                	push   $0x13
+  80111e:	68 d5 4c 80 00       	push   $0x804cd5
+  801123:	6a 54                	push   $0x54
+  801125:	68 f2 4c 80 00       	push   $0x804cf2
+  80112a:	e8 46 f1 ff ff       	call   800275 <_panic>
+
+0080112f <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  80112f:	55                   	push   %ebp
+  801130:	89 e5                	mov    %esp,%ebp
+  801132:	57                   	push   %edi
+  801133:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801134:	ba 00 00 00 00       	mov    $0x0,%edx
+  801139:	b8 14 00 00 00       	mov    $0x14,%eax
+  80113e:	89 d1                	mov    %edx,%ecx
+  801140:	89 d3                	mov    %edx,%ebx
+  801142:	89 d7                	mov    %edx,%edi
+  801144:	6a 00                	push   $0x0
+  801146:	55                   	push   %ebp
+  801147:	56                   	push   %esi
+  801148:	89 e5                	mov    %esp,%ebp
+  80114a:	8d 35 52 11 80 00    	lea    0x801152,%esi
+  801150:	0f 34                	sysenter
+
+00801152 <after_sysenter_label_1939>:
+  801152:	5e                   	pop    %esi
+  801153:	5d                   	pop    %ebp
+  801154:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  801157:	5b                   	pop    %ebx
+  801158:	5f                   	pop    %edi
+  801159:	5d                   	pop    %ebp
+  80115a:	c3                   	ret
+
+0080115b <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  80115b:	55                   	push   %ebp
+  80115c:	89 e5                	mov    %esp,%ebp
+  80115e:	57                   	push   %edi
+  80115f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801160:	8b 55 08             	mov    0x8(%ebp),%edx
+  801163:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801166:	b8 15 00 00 00       	mov    $0x15,%eax
+  80116b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801170:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801173:	6a 00                	push   $0x0
+  801175:	55                   	push   %ebp
+  801176:	56                   	push   %esi
+  801177:	89 e5                	mov    %esp,%ebp
+  801179:	8d 35 81 11 80 00    	lea    0x801181,%esi
+  80117f:	0f 34                	sysenter
+
+00801181 <after_sysenter_label_2028>:
+  801181:	5e                   	pop    %esi
+  801182:	5d                   	pop    %ebp
+  801183:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  801186:	5b                   	pop    %ebx
+  801187:	5f                   	pop    %edi
+  801188:	5d                   	pop    %ebp
+  801189:	c3                   	ret
+
+0080118a <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  80118a:	55                   	push   %ebp
+  80118b:	89 e5                	mov    %esp,%ebp
+  80118d:	57                   	push   %edi
+  80118e:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80118f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801194:	8b 55 08             	mov    0x8(%ebp),%edx
+  801197:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80119a:	b8 16 00 00 00       	mov    $0x16,%eax
+  80119f:	89 df                	mov    %ebx,%edi
+  8011a1:	6a 00                	push   $0x0
+  8011a3:	55                   	push   %ebp
+  8011a4:	56                   	push   %esi
+  8011a5:	89 e5                	mov    %esp,%ebp
+  8011a7:	8d 35 af 11 80 00    	lea    0x8011af,%esi
+  8011ad:	0f 34                	sysenter
+
+008011af <after_sysenter_label_2114>:
+  8011af:	5e                   	pop    %esi
+  8011b0:	5d                   	pop    %ebp
+  8011b1:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  8011b4:	5b                   	pop    %ebx
+  8011b5:	5f                   	pop    %edi
+  8011b6:	5d                   	pop    %ebp
+  8011b7:	c3                   	ret
+
+008011b8 <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  8011b8:	55                   	push   %ebp
+  8011b9:	89 e5                	mov    %esp,%ebp
+  8011bb:	57                   	push   %edi
+  8011bc:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8011bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011c8:	b8 17 00 00 00       	mov    $0x17,%eax
+  8011cd:	89 df                	mov    %ebx,%edi
+  8011cf:	6a 00                	push   $0x0
+  8011d1:	55                   	push   %ebp
+  8011d2:	56                   	push   %esi
+  8011d3:	89 e5                	mov    %esp,%ebp
+  8011d5:	8d 35 dd 11 80 00    	lea    0x8011dd,%esi
+  8011db:	0f 34                	sysenter
+
+008011dd <after_sysenter_label_2200>:
+  8011dd:	5e                   	pop    %esi
+  8011de:	5d                   	pop    %ebp
+  8011df:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  8011e2:	5b                   	pop    %ebx
+  8011e3:	5f                   	pop    %edi
+  8011e4:	5d                   	pop    %ebp
+  8011e5:	c3                   	ret
+
+008011e6 <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  8011e6:	55                   	push   %ebp
+  8011e7:	89 e5                	mov    %esp,%ebp
+  8011e9:	57                   	push   %edi
+  8011ea:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8011eb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011f3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011f6:	b8 18 00 00 00       	mov    $0x18,%eax
+  8011fb:	89 df                	mov    %ebx,%edi
+  8011fd:	6a 00                	push   $0x0
+  8011ff:	55                   	push   %ebp
+  801200:	56                   	push   %esi
+  801201:	89 e5                	mov    %esp,%ebp
+  801203:	8d 35 0b 12 80 00    	lea    0x80120b,%esi
+  801209:	0f 34                	sysenter
+
+0080120b <after_sysenter_label_2286>:
+  80120b:	5e                   	pop    %esi
+  80120c:	5d                   	pop    %ebp
+  80120d:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  801210:	5b                   	pop    %ebx
+  801211:	5f                   	pop    %edi
+  801212:	5d                   	pop    %ebp
+  801213:	c3                   	ret
+
+00801214 <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  801214:	55                   	push   %ebp
+  801215:	89 e5                	mov    %esp,%ebp
+  801217:	57                   	push   %edi
+  801218:	56                   	push   %esi
+  801219:	53                   	push   %ebx
+  80121a:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  80121d:	89 d6                	mov    %edx,%esi
+  80121f:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  801222:	89 cf                	mov    %ecx,%edi
+  801224:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  801227:	89 fa                	mov    %edi,%edx
+  801229:	80 ce 08             	or     $0x8,%dh
+  80122c:	f6 c5 08             	test   $0x8,%ch
+  80122f:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  801232:	57                   	push   %edi
+  801233:	56                   	push   %esi
+  801234:	50                   	push   %eax
+  801235:	56                   	push   %esi
+  801236:	6a 00                	push   $0x0
+  801238:	e8 82 fb ff ff       	call   800dbf <sys_page_map>
+	if (r < 0) {
+  80123d:	83 c4 20             	add    $0x20,%esp
+  801240:	85 c0                	test   %eax,%eax
+  801242:	78 27                	js     80126b <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  801244:	83 ec 0c             	sub    $0xc,%esp
+  801247:	57                   	push   %edi
+  801248:	56                   	push   %esi
+  801249:	6a 00                	push   $0x0
+  80124b:	56                   	push   %esi
+  80124c:	6a 00                	push   $0x0
+  80124e:	e8 6c fb ff ff       	call   800dbf <sys_page_map>
+  801253:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  801255:	83 c4 20             	add    $0x20,%esp
+  801258:	85 c0                	test   %eax,%eax
+  80125a:	78 24                	js     801280 <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  80125c:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  801261:	89 d8                	mov    %ebx,%eax
+  801263:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801266:	5b                   	pop    %ebx
+  801267:	5e                   	pop    %esi
+  801268:	5f                   	pop    %edi
+  801269:	5d                   	pop    %ebp
+  80126a:	c3                   	ret
+  80126b:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  80126d:	83 ec 08             	sub    $0x8,%esp
+  801270:	50                   	push   %eax
+  801271:	68 00 4d 80 00       	push   $0x804d00
+  801276:	e8 d5 f0 ff ff       	call   800350 <cprintf>
+		return r;
+  80127b:	83 c4 10             	add    $0x10,%esp
+  80127e:	eb e1                	jmp    801261 <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  801280:	83 ec 08             	sub    $0x8,%esp
+  801283:	50                   	push   %eax
+  801284:	68 30 4d 80 00       	push   $0x804d30
+  801289:	e8 c2 f0 ff ff       	call   800350 <cprintf>
+		return r;
+  80128e:	83 c4 10             	add    $0x10,%esp
+  801291:	eb ce                	jmp    801261 <duppage_cow+0x4d>
+
+00801293 <duppage>:
+{
+  801293:	55                   	push   %ebp
+  801294:	89 e5                	mov    %esp,%ebp
+  801296:	53                   	push   %ebx
+  801297:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  80129a:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  80129d:	51                   	push   %ecx
+  80129e:	52                   	push   %edx
+  80129f:	50                   	push   %eax
+  8012a0:	52                   	push   %edx
+  8012a1:	6a 00                	push   $0x0
+  8012a3:	e8 17 fb ff ff       	call   800dbf <sys_page_map>
+	if (r < 0) {
+  8012a8:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  8012ab:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  8012b0:	85 c0                	test   %eax,%eax
+  8012b2:	78 07                	js     8012bb <duppage+0x28>
+}
+  8012b4:	89 d8                	mov    %ebx,%eax
+  8012b6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012b9:	c9                   	leave
+  8012ba:	c3                   	ret
+  8012bb:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  8012bd:	83 ec 08             	sub    $0x8,%esp
+  8012c0:	50                   	push   %eax
+  8012c1:	68 00 4d 80 00       	push   $0x804d00
+  8012c6:	e8 85 f0 ff ff       	call   800350 <cprintf>
+		return r;
+  8012cb:	83 c4 10             	add    $0x10,%esp
+  8012ce:	eb e4                	jmp    8012b4 <duppage+0x21>
+
+008012d0 <cow_copy>:
+{
+  8012d0:	55                   	push   %ebp
+  8012d1:	89 e5                	mov    %esp,%ebp
+  8012d3:	56                   	push   %esi
+  8012d4:	53                   	push   %ebx
+  8012d5:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  8012d7:	83 ec 04             	sub    $0x4,%esp
+  8012da:	6a 07                	push   $0x7
+  8012dc:	68 00 f0 7f 00       	push   $0x7ff000
+  8012e1:	6a 00                	push   $0x0
+  8012e3:	e8 8a fa ff ff       	call   800d72 <sys_page_alloc>
+	if (r < 0) {
+  8012e8:	83 c4 10             	add    $0x10,%esp
+  8012eb:	85 c0                	test   %eax,%eax
+  8012ed:	78 58                	js     801347 <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  8012ef:	83 ec 04             	sub    $0x4,%esp
+  8012f2:	68 00 10 00 00       	push   $0x1000
+  8012f7:	56                   	push   %esi
+  8012f8:	68 00 f0 7f 00       	push   $0x7ff000
+  8012fd:	e8 b8 f7 ff ff       	call   800aba <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  801302:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801309:	56                   	push   %esi
+  80130a:	6a 00                	push   $0x0
+  80130c:	68 00 f0 7f 00       	push   $0x7ff000
+  801311:	6a 00                	push   $0x0
+  801313:	e8 a7 fa ff ff       	call   800dbf <sys_page_map>
+  801318:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  80131a:	83 c4 20             	add    $0x20,%esp
+  80131d:	85 c0                	test   %eax,%eax
+  80131f:	78 3b                	js     80135c <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  801321:	83 ec 08             	sub    $0x8,%esp
+  801324:	68 00 f0 7f 00       	push   $0x7ff000
+  801329:	6a 00                	push   $0x0
+  80132b:	e8 db fa ff ff       	call   800e0b <sys_page_unmap>
+  801330:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  801332:	83 c4 10             	add    $0x10,%esp
+  801335:	85 c0                	test   %eax,%eax
+  801337:	78 45                	js     80137e <cow_copy+0xae>
+	return 0;
+  801339:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  80133e:	89 d8                	mov    %ebx,%eax
+  801340:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801343:	5b                   	pop    %ebx
+  801344:	5e                   	pop    %esi
+  801345:	5d                   	pop    %ebp
+  801346:	c3                   	ret
+  801347:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  801349:	83 ec 08             	sub    $0x8,%esp
+  80134c:	50                   	push   %eax
+  80134d:	68 20 4e 80 00       	push   $0x804e20
+  801352:	e8 f9 ef ff ff       	call   800350 <cprintf>
+		return r;
+  801357:	83 c4 10             	add    $0x10,%esp
+  80135a:	eb e2                	jmp    80133e <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  80135c:	83 ec 08             	sub    $0x8,%esp
+  80135f:	50                   	push   %eax
+  801360:	68 3c 4e 80 00       	push   $0x804e3c
+  801365:	e8 e6 ef ff ff       	call   800350 <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  80136a:	83 c4 08             	add    $0x8,%esp
+  80136d:	68 00 f0 7f 00       	push   $0x7ff000
+  801372:	6a 00                	push   $0x0
+  801374:	e8 92 fa ff ff       	call   800e0b <sys_page_unmap>
+		return r;
+  801379:	83 c4 10             	add    $0x10,%esp
+  80137c:	eb c0                	jmp    80133e <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  80137e:	83 ec 08             	sub    $0x8,%esp
+  801381:	50                   	push   %eax
+  801382:	68 58 4d 80 00       	push   $0x804d58
+  801387:	e8 c4 ef ff ff       	call   800350 <cprintf>
+		return r;
+  80138c:	83 c4 10             	add    $0x10,%esp
+  80138f:	eb ad                	jmp    80133e <cow_copy+0x6e>
+
+00801391 <pgfault>:
+{
+  801391:	55                   	push   %ebp
+  801392:	89 e5                	mov    %esp,%ebp
+  801394:	56                   	push   %esi
+  801395:	53                   	push   %ebx
+  801396:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  801399:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  80139b:	89 d8                	mov    %ebx,%eax
+  80139d:	c1 e8 16             	shr    $0x16,%eax
+  8013a0:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  8013a7:	89 de                	mov    %ebx,%esi
+  8013a9:	c1 ee 0c             	shr    $0xc,%esi
+  8013ac:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  8013b3:	a8 07                	test   $0x7,%al
+  8013b5:	74 3b                	je     8013f2 <pgfault+0x61>
+  8013b7:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  8013bd:	74 33                	je     8013f2 <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  8013bf:	83 ec 0c             	sub    $0xc,%esp
+  8013c2:	68 00 f0 bf ee       	push   $0xeebff000
+  8013c7:	e8 7c 26 00 00       	call   803a48 <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  8013cc:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  8013d3:	83 c4 10             	add    $0x10,%esp
+  8013d6:	f6 c4 08             	test   $0x8,%ah
+  8013d9:	75 30                	jne    80140b <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  8013db:	83 ec 0c             	sub    $0xc,%esp
+  8013de:	68 00 f0 bf ee       	push   $0xeebff000
+  8013e3:	e8 cd 26 00 00       	call   803ab5 <mutex_unlock>
+}
+  8013e8:	83 c4 10             	add    $0x10,%esp
+  8013eb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013ee:	5b                   	pop    %ebx
+  8013ef:	5e                   	pop    %esi
+  8013f0:	5d                   	pop    %ebp
+  8013f1:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  8013f2:	83 ec 08             	sub    $0x8,%esp
+  8013f5:	ff 72 28             	push   0x28(%edx)
+  8013f8:	51                   	push   %ecx
+  8013f9:	50                   	push   %eax
+  8013fa:	68 7c 4d 80 00       	push   $0x804d7c
+  8013ff:	6a 3f                	push   $0x3f
+  801401:	68 56 4e 80 00       	push   $0x804e56
+  801406:	e8 6a ee ff ff       	call   800275 <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  80140b:	89 d8                	mov    %ebx,%eax
+  80140d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  801412:	e8 b9 fe ff ff       	call   8012d0 <cow_copy>
+  801417:	eb c2                	jmp    8013db <pgfault+0x4a>
+
+00801419 <cow_enable>:
+{
+  801419:	55                   	push   %ebp
+  80141a:	89 e5                	mov    %esp,%ebp
+  80141c:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  80141f:	68 91 13 80 00       	push   $0x801391
+  801424:	e8 9f 2f 00 00       	call   8043c8 <set_pgfault_handler>
+}
+  801429:	83 c4 10             	add    $0x10,%esp
+  80142c:	c9                   	leave
+  80142d:	c3                   	ret
+
+0080142e <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  80142e:	55                   	push   %ebp
+  80142f:	89 e5                	mov    %esp,%ebp
+  801431:	57                   	push   %edi
+  801432:	56                   	push   %esi
+  801433:	53                   	push   %ebx
+  801434:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  801437:	68 91 13 80 00       	push   $0x801391
+  80143c:	e8 87 2f 00 00       	call   8043c8 <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  801441:	b8 07 00 00 00       	mov    $0x7,%eax
+  801446:	cd 30                	int    $0x30
+  801448:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  80144b:	83 c4 10             	add    $0x10,%esp
+  80144e:	85 c0                	test   %eax,%eax
+  801450:	78 4b                	js     80149d <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  801452:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  801457:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80145c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  80145f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  801463:	0f 85 16 01 00 00    	jne    80157f <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801469:	e8 ac f8 ff ff       	call   800d1a <sys_getenvid>
+  80146e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801473:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801475:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  80147b:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  801481:	77 32                	ja     8014b5 <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801483:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  801488:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  80148a:	c1 ea 10             	shr    $0x10,%edx
+  80148d:	74 26                	je     8014b5 <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80148f:	c1 e2 10             	shl    $0x10,%edx
+  801492:	89 d1                	mov    %edx,%ecx
+  801494:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801499:	29 ca                	sub    %ecx,%edx
+  80149b:	eb 1e                	jmp    8014bb <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  80149d:	83 ec 08             	sub    $0x8,%esp
+  8014a0:	89 c7                	mov    %eax,%edi
+  8014a2:	50                   	push   %eax
+  8014a3:	68 61 4e 80 00       	push   $0x804e61
+  8014a8:	e8 a3 ee ff ff       	call   800350 <cprintf>
+		return eid;
+  8014ad:	83 c4 10             	add    $0x10,%esp
+  8014b0:	e9 6c 01 00 00       	jmp    801621 <fork+0x1f3>
+		return pthread_main_tls;
+  8014b5:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8014bb:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8014be:	c1 e0 04             	shl    $0x4,%eax
+  8014c1:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8014c6:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  8014c8:	e8 c4 2c 00 00       	call   804191 <pthread_fork_child>
+		return eid;
+  8014cd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8014d0:	e9 4c 01 00 00       	jmp    801621 <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8014d5:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8014db:	89 da                	mov    %ebx,%edx
+  8014dd:	89 f8                	mov    %edi,%eax
+  8014df:	e8 af fd ff ff       	call   801293 <duppage>
+  8014e4:	85 c0                	test   %eax,%eax
+  8014e6:	79 28                	jns    801510 <fork+0xe2>
+  8014e8:	89 c7                	mov    %eax,%edi
+  8014ea:	e9 32 01 00 00       	jmp    801621 <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  8014ef:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8014f5:	83 f9 05             	cmp    $0x5,%ecx
+  8014f8:	75 58                	jne    801552 <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8014fa:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8014ff:	89 da                	mov    %ebx,%edx
+  801501:	89 f8                	mov    %edi,%eax
+  801503:	e8 8b fd ff ff       	call   801293 <duppage>
+  801508:	85 c0                	test   %eax,%eax
+  80150a:	0f 88 0f 01 00 00    	js     80161f <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  801510:	83 c3 01             	add    $0x1,%ebx
+  801513:	39 de                	cmp    %ebx,%esi
+  801515:	74 54                	je     80156b <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  801517:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  80151e:	f6 c1 05             	test   $0x5,%cl
+  801521:	74 ed                	je     801510 <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  801523:	f6 c5 04             	test   $0x4,%ch
+  801526:	75 ad                	jne    8014d5 <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  801528:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  80152e:	74 bf                	je     8014ef <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  801530:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  801536:	74 d8                	je     801510 <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  801538:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  80153e:	89 da                	mov    %ebx,%edx
+  801540:	89 f8                	mov    %edi,%eax
+  801542:	e8 cd fc ff ff       	call   801214 <duppage_cow>
+  801547:	85 c0                	test   %eax,%eax
+  801549:	79 c5                	jns    801510 <fork+0xe2>
+  80154b:	89 c7                	mov    %eax,%edi
+  80154d:	e9 cf 00 00 00       	jmp    801621 <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  801552:	68 ac 4d 80 00       	push   $0x804dac
+  801557:	68 71 4e 80 00       	push   $0x804e71
+  80155c:	68 c6 00 00 00       	push   $0xc6
+  801561:	68 56 4e 80 00       	push   $0x804e56
+  801566:	e8 0a ed ff ff       	call   800275 <_panic>
+  80156b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80156e:	83 c1 01             	add    $0x1,%ecx
+  801571:	81 c6 00 04 00 00    	add    $0x400,%esi
+  801577:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  80157d:	74 18                	je     801597 <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  80157f:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  801586:	a8 07                	test   $0x7,%al
+  801588:	74 e4                	je     80156e <fork+0x140>
+  80158a:	89 cb                	mov    %ecx,%ebx
+  80158c:	c1 e3 0a             	shl    $0xa,%ebx
+  80158f:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801592:	e9 7c ff ff ff       	jmp    801513 <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  801597:	83 ec 04             	sub    $0x4,%esp
+  80159a:	6a 07                	push   $0x7
+  80159c:	68 00 f0 bf ee       	push   $0xeebff000
+  8015a1:	ff 75 e4             	push   -0x1c(%ebp)
+  8015a4:	e8 c9 f7 ff ff       	call   800d72 <sys_page_alloc>
+  8015a9:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8015ab:	83 c4 10             	add    $0x10,%esp
+  8015ae:	85 c0                	test   %eax,%eax
+  8015b0:	78 34                	js     8015e6 <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  8015b2:	83 ec 08             	sub    $0x8,%esp
+  8015b5:	68 06 44 80 00       	push   $0x804406
+  8015ba:	ff 75 e4             	push   -0x1c(%ebp)
+  8015bd:	e8 2d f9 ff ff       	call   800eef <sys_env_set_pgfault_upcall>
+  8015c2:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8015c4:	83 c4 10             	add    $0x10,%esp
+  8015c7:	85 c0                	test   %eax,%eax
+  8015c9:	78 2e                	js     8015f9 <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  8015cb:	83 ec 08             	sub    $0x8,%esp
+  8015ce:	6a 02                	push   $0x2
+  8015d0:	ff 75 e4             	push   -0x1c(%ebp)
+  8015d3:	e8 7f f8 ff ff       	call   800e57 <sys_env_set_status>
+  8015d8:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8015da:	83 c4 10             	add    $0x10,%esp
+  8015dd:	85 c0                	test   %eax,%eax
+  8015df:	78 2b                	js     80160c <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  8015e1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8015e4:	eb 3b                	jmp    801621 <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  8015e6:	83 ec 08             	sub    $0x8,%esp
+  8015e9:	50                   	push   %eax
+  8015ea:	68 d4 4d 80 00       	push   $0x804dd4
+  8015ef:	e8 5c ed ff ff       	call   800350 <cprintf>
+		return r;
+  8015f4:	83 c4 10             	add    $0x10,%esp
+  8015f7:	eb 28                	jmp    801621 <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  8015f9:	83 ec 08             	sub    $0x8,%esp
+  8015fc:	50                   	push   %eax
+  8015fd:	68 fc 4d 80 00       	push   $0x804dfc
+  801602:	e8 49 ed ff ff       	call   800350 <cprintf>
+		return r;
+  801607:	83 c4 10             	add    $0x10,%esp
+  80160a:	eb 15                	jmp    801621 <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  80160c:	83 ec 08             	sub    $0x8,%esp
+  80160f:	50                   	push   %eax
+  801610:	68 86 4e 80 00       	push   $0x804e86
+  801615:	e8 36 ed ff ff       	call   800350 <cprintf>
+		return r;
+  80161a:	83 c4 10             	add    $0x10,%esp
+  80161d:	eb 02                	jmp    801621 <fork+0x1f3>
+  80161f:	89 c7                	mov    %eax,%edi
+}
+  801621:	89 f8                	mov    %edi,%eax
+  801623:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801626:	5b                   	pop    %ebx
+  801627:	5e                   	pop    %esi
+  801628:	5f                   	pop    %edi
+  801629:	5d                   	pop    %ebp
+  80162a:	c3                   	ret
+
+0080162b <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  80162b:	55                   	push   %ebp
+  80162c:	89 e5                	mov    %esp,%ebp
+  80162e:	57                   	push   %edi
+  80162f:	56                   	push   %esi
+  801630:	53                   	push   %ebx
+  801631:	83 ec 2c             	sub    $0x2c,%esp
+  801634:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801636:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  80163c:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801641:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  801647:	77 0a                	ja     801653 <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801649:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  80164e:	29 c3                	sub    %eax,%ebx
+  801650:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  801653:	83 ec 0c             	sub    $0xc,%esp
+  801656:	68 91 13 80 00       	push   $0x801391
+  80165b:	e8 68 2d 00 00       	call   8043c8 <set_pgfault_handler>
+  801660:	b8 07 00 00 00       	mov    $0x7,%eax
+  801665:	cd 30                	int    $0x30
+  801667:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  80166a:	83 c4 10             	add    $0x10,%esp
+  80166d:	85 c0                	test   %eax,%eax
+  80166f:	78 30                	js     8016a1 <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  801671:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801675:	74 42                	je     8016b9 <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  801677:	c1 e3 10             	shl    $0x10,%ebx
+  80167a:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  80167f:	29 d8                	sub    %ebx,%eax
+  801681:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801684:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  801689:	29 d8                	sub    %ebx,%eax
+  80168b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80168e:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  801693:	ba 00 00 00 00       	mov    $0x0,%edx
+  801698:	89 f7                	mov    %esi,%edi
+  80169a:	89 d6                	mov    %edx,%esi
+  80169c:	e9 2c 01 00 00       	jmp    8017cd <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  8016a1:	83 ec 08             	sub    $0x8,%esp
+  8016a4:	89 c7                	mov    %eax,%edi
+  8016a6:	50                   	push   %eax
+  8016a7:	68 61 4e 80 00       	push   $0x804e61
+  8016ac:	e8 9f ec ff ff       	call   800350 <cprintf>
+		return eid;
+  8016b1:	83 c4 10             	add    $0x10,%esp
+  8016b4:	e9 d5 00 00 00       	jmp    80178e <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8016b9:	e8 5c f6 ff ff       	call   800d1a <sys_getenvid>
+  8016be:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8016c3:	89 c2                	mov    %eax,%edx
+  8016c5:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8016c7:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  8016cd:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8016d2:	77 18                	ja     8016ec <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8016d4:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8016d9:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  8016db:	c1 e8 10             	shr    $0x10,%eax
+  8016de:	74 0c                	je     8016ec <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8016e0:	c1 e0 10             	shl    $0x10,%eax
+  8016e3:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8016e8:	29 c1                	sub    %eax,%ecx
+  8016ea:	eb 06                	jmp    8016f2 <sfork+0xc7>
+		return pthread_main_tls;
+  8016ec:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+  8016f2:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8016f5:	c1 e0 04             	shl    $0x4,%eax
+  8016f8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8016fd:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  8016ff:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801702:	e9 87 00 00 00       	jmp    80178e <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  801707:	f6 c5 04             	test   $0x4,%ch
+  80170a:	74 6c                	je     801778 <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  80170c:	89 ca                	mov    %ecx,%edx
+  80170e:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  801714:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  80171a:	74 7c                	je     801798 <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  80171c:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  801722:	89 da                	mov    %ebx,%edx
+  801724:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801727:	e8 67 fb ff ff       	call   801293 <duppage>
+  80172c:	85 c0                	test   %eax,%eax
+  80172e:	0f 88 4f 01 00 00    	js     801883 <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  801734:	83 c3 01             	add    $0x1,%ebx
+  801737:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  80173a:	74 7a                	je     8017b6 <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  80173c:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  80173e:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  801745:	f6 c1 01             	test   $0x1,%cl
+  801748:	74 ea                	je     801734 <sfork+0x109>
+  80174a:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  801750:	74 e2                	je     801734 <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  801752:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  801758:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  80175b:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  801760:	76 a5                	jbe    801707 <sfork+0xdc>
+  801762:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  801768:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  80176b:	39 fa                	cmp    %edi,%edx
+  80176d:	73 9d                	jae    80170c <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  80176f:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  801772:	39 fa                	cmp    %edi,%edx
+  801774:	72 96                	jb     80170c <sfork+0xe1>
+  801776:	eb 8f                	jmp    801707 <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  801778:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  80177e:	89 da                	mov    %ebx,%edx
+  801780:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801783:	e8 8c fa ff ff       	call   801214 <duppage_cow>
+  801788:	85 c0                	test   %eax,%eax
+  80178a:	79 a8                	jns    801734 <sfork+0x109>
+  80178c:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  80178e:	89 f8                	mov    %edi,%eax
+  801790:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801793:	5b                   	pop    %ebx
+  801794:	5e                   	pop    %esi
+  801795:	5f                   	pop    %edi
+  801796:	5d                   	pop    %ebp
+  801797:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  801798:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  80179d:	e8 2e fb ff ff       	call   8012d0 <cow_copy>
+  8017a2:	85 c0                	test   %eax,%eax
+  8017a4:	0f 88 d2 00 00 00    	js     80187c <sfork+0x251>
+				pte = uvpt[pn];
+  8017aa:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  8017b1:	e9 66 ff ff ff       	jmp    80171c <sfork+0xf1>
+  8017b6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8017b9:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8017bc:	83 c6 01             	add    $0x1,%esi
+  8017bf:	81 c7 00 04 00 00    	add    $0x400,%edi
+  8017c5:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  8017cb:	74 1b                	je     8017e8 <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  8017cd:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  8017d4:	a8 01                	test   $0x1,%al
+  8017d6:	74 e4                	je     8017bc <sfork+0x191>
+  8017d8:	89 f3                	mov    %esi,%ebx
+  8017da:	c1 e3 0a             	shl    $0xa,%ebx
+  8017dd:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  8017e0:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  8017e3:	e9 4f ff ff ff       	jmp    801737 <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  8017e8:	83 ec 04             	sub    $0x4,%esp
+  8017eb:	6a 07                	push   $0x7
+  8017ed:	68 00 f0 bf ee       	push   $0xeebff000
+  8017f2:	ff 75 e0             	push   -0x20(%ebp)
+  8017f5:	e8 78 f5 ff ff       	call   800d72 <sys_page_alloc>
+  8017fa:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8017fc:	83 c4 10             	add    $0x10,%esp
+  8017ff:	85 c0                	test   %eax,%eax
+  801801:	78 37                	js     80183a <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  801803:	83 ec 08             	sub    $0x8,%esp
+  801806:	68 06 44 80 00       	push   $0x804406
+  80180b:	ff 75 e0             	push   -0x20(%ebp)
+  80180e:	e8 dc f6 ff ff       	call   800eef <sys_env_set_pgfault_upcall>
+  801813:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801815:	83 c4 10             	add    $0x10,%esp
+  801818:	85 c0                	test   %eax,%eax
+  80181a:	78 34                	js     801850 <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  80181c:	83 ec 08             	sub    $0x8,%esp
+  80181f:	6a 02                	push   $0x2
+  801821:	ff 75 e0             	push   -0x20(%ebp)
+  801824:	e8 2e f6 ff ff       	call   800e57 <sys_env_set_status>
+  801829:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80182b:	83 c4 10             	add    $0x10,%esp
+  80182e:	85 c0                	test   %eax,%eax
+  801830:	78 34                	js     801866 <sfork+0x23b>
+	return eid;
+  801832:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801835:	e9 54 ff ff ff       	jmp    80178e <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  80183a:	83 ec 08             	sub    $0x8,%esp
+  80183d:	50                   	push   %eax
+  80183e:	68 d4 4d 80 00       	push   $0x804dd4
+  801843:	e8 08 eb ff ff       	call   800350 <cprintf>
+		return r;
+  801848:	83 c4 10             	add    $0x10,%esp
+  80184b:	e9 3e ff ff ff       	jmp    80178e <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  801850:	83 ec 08             	sub    $0x8,%esp
+  801853:	50                   	push   %eax
+  801854:	68 fc 4d 80 00       	push   $0x804dfc
+  801859:	e8 f2 ea ff ff       	call   800350 <cprintf>
+		return r;
+  80185e:	83 c4 10             	add    $0x10,%esp
+  801861:	e9 28 ff ff ff       	jmp    80178e <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  801866:	83 ec 08             	sub    $0x8,%esp
+  801869:	50                   	push   %eax
+  80186a:	68 86 4e 80 00       	push   $0x804e86
+  80186f:	e8 dc ea ff ff       	call   800350 <cprintf>
+		return r;
+  801874:	83 c4 10             	add    $0x10,%esp
+  801877:	e9 12 ff ff ff       	jmp    80178e <sfork+0x163>
+  80187c:	89 c7                	mov    %eax,%edi
+  80187e:	e9 0b ff ff ff       	jmp    80178e <sfork+0x163>
+  801883:	89 c7                	mov    %eax,%edi
+  801885:	e9 04 ff ff ff       	jmp    80178e <sfork+0x163>
+
+0080188a <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80188a:	55                   	push   %ebp
+  80188b:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80188d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801890:	05 00 00 00 30       	add    $0x30000000,%eax
+  801895:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801898:	5d                   	pop    %ebp
+  801899:	c3                   	ret
+
+0080189a <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80189a:	55                   	push   %ebp
+  80189b:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80189d:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018a0:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8018a5:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8018aa:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8018af:	5d                   	pop    %ebp
+  8018b0:	c3                   	ret
+
+008018b1 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8018b1:	55                   	push   %ebp
+  8018b2:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8018b4:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8018b9:	eb 02                	jmp    8018bd <fd_alloc+0xc>
+  8018bb:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8018bd:	89 c2                	mov    %eax,%edx
+  8018bf:	c1 ea 16             	shr    $0x16,%edx
+  8018c2:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8018c9:	f6 c2 01             	test   $0x1,%dl
+  8018cc:	74 2b                	je     8018f9 <fd_alloc+0x48>
+  8018ce:	89 c2                	mov    %eax,%edx
+  8018d0:	c1 ea 0c             	shr    $0xc,%edx
+  8018d3:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8018da:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8018e0:	f6 c1 01             	test   $0x1,%cl
+  8018e3:	74 14                	je     8018f9 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8018e5:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8018eb:	75 ce                	jne    8018bb <fd_alloc+0xa>
+  8018ed:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8018f2:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8018f7:	eb 05                	jmp    8018fe <fd_alloc+0x4d>
+			return 0;
+  8018f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8018fe:	8b 55 08             	mov    0x8(%ebp),%edx
+  801901:	89 02                	mov    %eax,(%edx)
+}
+  801903:	89 c8                	mov    %ecx,%eax
+  801905:	5d                   	pop    %ebp
+  801906:	c3                   	ret
+
+00801907 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801907:	55                   	push   %ebp
+  801908:	89 e5                	mov    %esp,%ebp
+  80190a:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80190d:	83 f8 1f             	cmp    $0x1f,%eax
+  801910:	77 30                	ja     801942 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801912:	c1 e0 0c             	shl    $0xc,%eax
+  801915:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80191a:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801920:	f6 c2 01             	test   $0x1,%dl
+  801923:	74 24                	je     801949 <fd_lookup+0x42>
+  801925:	89 c2                	mov    %eax,%edx
+  801927:	c1 ea 0c             	shr    $0xc,%edx
+  80192a:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801931:	f6 c2 01             	test   $0x1,%dl
+  801934:	74 1a                	je     801950 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801936:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801939:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80193b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801940:	5d                   	pop    %ebp
+  801941:	c3                   	ret
+		return -E_INVAL;
+  801942:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801947:	eb f7                	jmp    801940 <fd_lookup+0x39>
+		return -E_INVAL;
+  801949:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80194e:	eb f0                	jmp    801940 <fd_lookup+0x39>
+  801950:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801955:	eb e9                	jmp    801940 <fd_lookup+0x39>
+
+00801957 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801957:	55                   	push   %ebp
+  801958:	89 e5                	mov    %esp,%ebp
+  80195a:	53                   	push   %ebx
+  80195b:	83 ec 04             	sub    $0x4,%esp
+  80195e:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801961:	b8 00 00 00 00       	mov    $0x0,%eax
+  801966:	eb 03                	jmp    80196b <dev_lookup+0x14>
+  801968:	83 c0 01             	add    $0x1,%eax
+  80196b:	8b 1c 85 20 4f 80 00 	mov    0x804f20(,%eax,4),%ebx
+  801972:	85 db                	test   %ebx,%ebx
+  801974:	74 0b                	je     801981 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801976:	39 13                	cmp    %edx,(%ebx)
+  801978:	75 ee                	jne    801968 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80197a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80197f:	eb 49                	jmp    8019ca <dev_lookup+0x73>
+  801981:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801983:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  801989:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80198e:	77 18                	ja     8019a8 <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801990:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801995:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  801997:	c1 e8 10             	shr    $0x10,%eax
+  80199a:	74 0c                	je     8019a8 <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80199c:	c1 e0 10             	shl    $0x10,%eax
+  80199f:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8019a4:	29 c1                	sub    %eax,%ecx
+  8019a6:	eb 06                	jmp    8019ae <dev_lookup+0x57>
+		return pthread_main_tls;
+  8019a8:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8019ae:	8b 01                	mov    (%ecx),%eax
+  8019b0:	8b 40 48             	mov    0x48(%eax),%eax
+  8019b3:	83 ec 04             	sub    $0x4,%esp
+  8019b6:	52                   	push   %edx
+  8019b7:	50                   	push   %eax
+  8019b8:	68 a4 4e 80 00       	push   $0x804ea4
+  8019bd:	e8 8e e9 ff ff       	call   800350 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8019c2:	83 c4 10             	add    $0x10,%esp
+  8019c5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8019ca:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019cd:	89 1a                	mov    %ebx,(%edx)
+}
+  8019cf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019d2:	c9                   	leave
+  8019d3:	c3                   	ret
+
+008019d4 <fd_close>:
+{
+  8019d4:	55                   	push   %ebp
+  8019d5:	89 e5                	mov    %esp,%ebp
+  8019d7:	57                   	push   %edi
+  8019d8:	56                   	push   %esi
+  8019d9:	53                   	push   %ebx
+  8019da:	83 ec 24             	sub    $0x24,%esp
+  8019dd:	8b 75 08             	mov    0x8(%ebp),%esi
+  8019e0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8019e3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8019e6:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8019e7:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8019ed:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8019f0:	50                   	push   %eax
+  8019f1:	e8 11 ff ff ff       	call   801907 <fd_lookup>
+  8019f6:	89 c3                	mov    %eax,%ebx
+  8019f8:	83 c4 10             	add    $0x10,%esp
+  8019fb:	85 c0                	test   %eax,%eax
+  8019fd:	78 05                	js     801a04 <fd_close+0x30>
+	    || fd != fd2)
+  8019ff:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801a02:	74 16                	je     801a1a <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801a04:	89 f8                	mov    %edi,%eax
+  801a06:	84 c0                	test   %al,%al
+  801a08:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a0d:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801a10:	89 d8                	mov    %ebx,%eax
+  801a12:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a15:	5b                   	pop    %ebx
+  801a16:	5e                   	pop    %esi
+  801a17:	5f                   	pop    %edi
+  801a18:	5d                   	pop    %ebp
+  801a19:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801a1a:	83 ec 08             	sub    $0x8,%esp
+  801a1d:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801a20:	50                   	push   %eax
+  801a21:	ff 36                	push   (%esi)
+  801a23:	e8 2f ff ff ff       	call   801957 <dev_lookup>
+  801a28:	89 c3                	mov    %eax,%ebx
+  801a2a:	83 c4 10             	add    $0x10,%esp
+  801a2d:	85 c0                	test   %eax,%eax
+  801a2f:	78 1a                	js     801a4b <fd_close+0x77>
+		if (dev->dev_close)
+  801a31:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801a34:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801a37:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801a3c:	85 c0                	test   %eax,%eax
+  801a3e:	74 0b                	je     801a4b <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801a40:	83 ec 0c             	sub    $0xc,%esp
+  801a43:	56                   	push   %esi
+  801a44:	ff d0                	call   *%eax
+  801a46:	89 c3                	mov    %eax,%ebx
+  801a48:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801a4b:	83 ec 08             	sub    $0x8,%esp
+  801a4e:	56                   	push   %esi
+  801a4f:	6a 00                	push   $0x0
+  801a51:	e8 b5 f3 ff ff       	call   800e0b <sys_page_unmap>
+	return r;
+  801a56:	83 c4 10             	add    $0x10,%esp
+  801a59:	eb b5                	jmp    801a10 <fd_close+0x3c>
+
+00801a5b <close>:
+
+int
+close(int fdnum)
+{
+  801a5b:	55                   	push   %ebp
+  801a5c:	89 e5                	mov    %esp,%ebp
+  801a5e:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801a61:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a64:	50                   	push   %eax
+  801a65:	ff 75 08             	push   0x8(%ebp)
+  801a68:	e8 9a fe ff ff       	call   801907 <fd_lookup>
+  801a6d:	83 c4 10             	add    $0x10,%esp
+  801a70:	85 c0                	test   %eax,%eax
+  801a72:	79 02                	jns    801a76 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801a74:	c9                   	leave
+  801a75:	c3                   	ret
+		return fd_close(fd, 1);
+  801a76:	83 ec 08             	sub    $0x8,%esp
+  801a79:	6a 01                	push   $0x1
+  801a7b:	ff 75 f4             	push   -0xc(%ebp)
+  801a7e:	e8 51 ff ff ff       	call   8019d4 <fd_close>
+  801a83:	83 c4 10             	add    $0x10,%esp
+  801a86:	eb ec                	jmp    801a74 <close+0x19>
+
+00801a88 <close_all>:
+
+void
+close_all(void)
+{
+  801a88:	55                   	push   %ebp
+  801a89:	89 e5                	mov    %esp,%ebp
+  801a8b:	53                   	push   %ebx
+  801a8c:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801a8f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801a94:	83 ec 0c             	sub    $0xc,%esp
+  801a97:	53                   	push   %ebx
+  801a98:	e8 be ff ff ff       	call   801a5b <close>
+	for (i = 0; i < MAXFD; i++)
+  801a9d:	83 c3 01             	add    $0x1,%ebx
+  801aa0:	83 c4 10             	add    $0x10,%esp
+  801aa3:	83 fb 20             	cmp    $0x20,%ebx
+  801aa6:	75 ec                	jne    801a94 <close_all+0xc>
+}
+  801aa8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801aab:	c9                   	leave
+  801aac:	c3                   	ret
+
+00801aad <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801aad:	55                   	push   %ebp
+  801aae:	89 e5                	mov    %esp,%ebp
+  801ab0:	57                   	push   %edi
+  801ab1:	56                   	push   %esi
+  801ab2:	53                   	push   %ebx
+  801ab3:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801ab6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ab9:	50                   	push   %eax
+  801aba:	ff 75 08             	push   0x8(%ebp)
+  801abd:	e8 45 fe ff ff       	call   801907 <fd_lookup>
+  801ac2:	89 c3                	mov    %eax,%ebx
+  801ac4:	83 c4 10             	add    $0x10,%esp
+  801ac7:	85 c0                	test   %eax,%eax
+  801ac9:	78 7f                	js     801b4a <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801acb:	83 ec 0c             	sub    $0xc,%esp
+  801ace:	ff 75 0c             	push   0xc(%ebp)
+  801ad1:	e8 85 ff ff ff       	call   801a5b <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801ad6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801ad9:	c1 e6 0c             	shl    $0xc,%esi
+  801adc:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801ae2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801ae5:	89 3c 24             	mov    %edi,(%esp)
+  801ae8:	e8 ad fd ff ff       	call   80189a <fd2data>
+  801aed:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801aef:	89 34 24             	mov    %esi,(%esp)
+  801af2:	e8 a3 fd ff ff       	call   80189a <fd2data>
+  801af7:	83 c4 10             	add    $0x10,%esp
+  801afa:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801afd:	89 d8                	mov    %ebx,%eax
+  801aff:	c1 e8 16             	shr    $0x16,%eax
+  801b02:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801b09:	a8 01                	test   $0x1,%al
+  801b0b:	74 11                	je     801b1e <dup+0x71>
+  801b0d:	89 d8                	mov    %ebx,%eax
+  801b0f:	c1 e8 0c             	shr    $0xc,%eax
+  801b12:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801b19:	f6 c2 01             	test   $0x1,%dl
+  801b1c:	75 36                	jne    801b54 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801b1e:	89 f8                	mov    %edi,%eax
+  801b20:	c1 e8 0c             	shr    $0xc,%eax
+  801b23:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801b2a:	83 ec 0c             	sub    $0xc,%esp
+  801b2d:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b32:	50                   	push   %eax
+  801b33:	56                   	push   %esi
+  801b34:	6a 00                	push   $0x0
+  801b36:	57                   	push   %edi
+  801b37:	6a 00                	push   $0x0
+  801b39:	e8 81 f2 ff ff       	call   800dbf <sys_page_map>
+  801b3e:	89 c3                	mov    %eax,%ebx
+  801b40:	83 c4 20             	add    $0x20,%esp
+  801b43:	85 c0                	test   %eax,%eax
+  801b45:	78 33                	js     801b7a <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801b47:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801b4a:	89 d8                	mov    %ebx,%eax
+  801b4c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b4f:	5b                   	pop    %ebx
+  801b50:	5e                   	pop    %esi
+  801b51:	5f                   	pop    %edi
+  801b52:	5d                   	pop    %ebp
+  801b53:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801b54:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801b5b:	83 ec 0c             	sub    $0xc,%esp
+  801b5e:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b63:	50                   	push   %eax
+  801b64:	ff 75 d4             	push   -0x2c(%ebp)
+  801b67:	6a 00                	push   $0x0
+  801b69:	53                   	push   %ebx
+  801b6a:	6a 00                	push   $0x0
+  801b6c:	e8 4e f2 ff ff       	call   800dbf <sys_page_map>
+  801b71:	89 c3                	mov    %eax,%ebx
+  801b73:	83 c4 20             	add    $0x20,%esp
+  801b76:	85 c0                	test   %eax,%eax
+  801b78:	79 a4                	jns    801b1e <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801b7a:	83 ec 08             	sub    $0x8,%esp
+  801b7d:	56                   	push   %esi
+  801b7e:	6a 00                	push   $0x0
+  801b80:	e8 86 f2 ff ff       	call   800e0b <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801b85:	83 c4 08             	add    $0x8,%esp
+  801b88:	ff 75 d4             	push   -0x2c(%ebp)
+  801b8b:	6a 00                	push   $0x0
+  801b8d:	e8 79 f2 ff ff       	call   800e0b <sys_page_unmap>
+	return r;
+  801b92:	83 c4 10             	add    $0x10,%esp
+  801b95:	eb b3                	jmp    801b4a <dup+0x9d>
+
+00801b97 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801b97:	55                   	push   %ebp
+  801b98:	89 e5                	mov    %esp,%ebp
+  801b9a:	56                   	push   %esi
+  801b9b:	53                   	push   %ebx
+  801b9c:	83 ec 18             	sub    $0x18,%esp
+  801b9f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ba2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ba5:	50                   	push   %eax
+  801ba6:	53                   	push   %ebx
+  801ba7:	e8 5b fd ff ff       	call   801907 <fd_lookup>
+  801bac:	83 c4 10             	add    $0x10,%esp
+  801baf:	85 c0                	test   %eax,%eax
+  801bb1:	78 3c                	js     801bef <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801bb3:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801bb6:	83 ec 08             	sub    $0x8,%esp
+  801bb9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bbc:	50                   	push   %eax
+  801bbd:	ff 36                	push   (%esi)
+  801bbf:	e8 93 fd ff ff       	call   801957 <dev_lookup>
+  801bc4:	83 c4 10             	add    $0x10,%esp
+  801bc7:	85 c0                	test   %eax,%eax
+  801bc9:	78 24                	js     801bef <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801bcb:	8b 46 08             	mov    0x8(%esi),%eax
+  801bce:	83 e0 03             	and    $0x3,%eax
+  801bd1:	83 f8 01             	cmp    $0x1,%eax
+  801bd4:	74 20                	je     801bf6 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801bd6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bd9:	8b 40 08             	mov    0x8(%eax),%eax
+  801bdc:	85 c0                	test   %eax,%eax
+  801bde:	74 61                	je     801c41 <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801be0:	83 ec 04             	sub    $0x4,%esp
+  801be3:	ff 75 10             	push   0x10(%ebp)
+  801be6:	ff 75 0c             	push   0xc(%ebp)
+  801be9:	56                   	push   %esi
+  801bea:	ff d0                	call   *%eax
+  801bec:	83 c4 10             	add    $0x10,%esp
+}
+  801bef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bf2:	5b                   	pop    %ebx
+  801bf3:	5e                   	pop    %esi
+  801bf4:	5d                   	pop    %ebp
+  801bf5:	c3                   	ret
+  801bf6:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801bf8:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801bfe:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801c03:	77 18                	ja     801c1d <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801c05:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801c0a:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801c0c:	c1 e8 10             	shr    $0x10,%eax
+  801c0f:	74 0c                	je     801c1d <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801c11:	c1 e0 10             	shl    $0x10,%eax
+  801c14:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801c19:	29 c2                	sub    %eax,%edx
+  801c1b:	eb 06                	jmp    801c23 <read+0x8c>
+		return pthread_main_tls;
+  801c1d:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c23:	8b 02                	mov    (%edx),%eax
+  801c25:	8b 40 48             	mov    0x48(%eax),%eax
+  801c28:	83 ec 04             	sub    $0x4,%esp
+  801c2b:	53                   	push   %ebx
+  801c2c:	50                   	push   %eax
+  801c2d:	68 e5 4e 80 00       	push   $0x804ee5
+  801c32:	e8 19 e7 ff ff       	call   800350 <cprintf>
+		return -E_INVAL;
+  801c37:	83 c4 10             	add    $0x10,%esp
+  801c3a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c3f:	eb ae                	jmp    801bef <read+0x58>
+		return -E_NOT_SUPP;
+  801c41:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c46:	eb a7                	jmp    801bef <read+0x58>
+
+00801c48 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801c48:	55                   	push   %ebp
+  801c49:	89 e5                	mov    %esp,%ebp
+  801c4b:	57                   	push   %edi
+  801c4c:	56                   	push   %esi
+  801c4d:	53                   	push   %ebx
+  801c4e:	83 ec 0c             	sub    $0xc,%esp
+  801c51:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801c54:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801c57:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c5c:	eb 02                	jmp    801c60 <readn+0x18>
+  801c5e:	01 c3                	add    %eax,%ebx
+  801c60:	39 f3                	cmp    %esi,%ebx
+  801c62:	73 21                	jae    801c85 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801c64:	83 ec 04             	sub    $0x4,%esp
+  801c67:	89 f0                	mov    %esi,%eax
+  801c69:	29 d8                	sub    %ebx,%eax
+  801c6b:	50                   	push   %eax
+  801c6c:	89 d8                	mov    %ebx,%eax
+  801c6e:	03 45 0c             	add    0xc(%ebp),%eax
+  801c71:	50                   	push   %eax
+  801c72:	57                   	push   %edi
+  801c73:	e8 1f ff ff ff       	call   801b97 <read>
+		if (m < 0)
+  801c78:	83 c4 10             	add    $0x10,%esp
+  801c7b:	85 c0                	test   %eax,%eax
+  801c7d:	78 04                	js     801c83 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801c7f:	75 dd                	jne    801c5e <readn+0x16>
+  801c81:	eb 02                	jmp    801c85 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801c83:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801c85:	89 d8                	mov    %ebx,%eax
+  801c87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c8a:	5b                   	pop    %ebx
+  801c8b:	5e                   	pop    %esi
+  801c8c:	5f                   	pop    %edi
+  801c8d:	5d                   	pop    %ebp
+  801c8e:	c3                   	ret
+
+00801c8f <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801c8f:	55                   	push   %ebp
+  801c90:	89 e5                	mov    %esp,%ebp
+  801c92:	56                   	push   %esi
+  801c93:	53                   	push   %ebx
+  801c94:	83 ec 18             	sub    $0x18,%esp
+  801c97:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c9a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c9d:	50                   	push   %eax
+  801c9e:	53                   	push   %ebx
+  801c9f:	e8 63 fc ff ff       	call   801907 <fd_lookup>
+  801ca4:	83 c4 10             	add    $0x10,%esp
+  801ca7:	85 c0                	test   %eax,%eax
+  801ca9:	78 37                	js     801ce2 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801cab:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801cae:	83 ec 08             	sub    $0x8,%esp
+  801cb1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cb4:	50                   	push   %eax
+  801cb5:	ff 36                	push   (%esi)
+  801cb7:	e8 9b fc ff ff       	call   801957 <dev_lookup>
+  801cbc:	83 c4 10             	add    $0x10,%esp
+  801cbf:	85 c0                	test   %eax,%eax
+  801cc1:	78 1f                	js     801ce2 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801cc3:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801cc7:	74 20                	je     801ce9 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801cc9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ccc:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ccf:	85 c0                	test   %eax,%eax
+  801cd1:	74 61                	je     801d34 <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801cd3:	83 ec 04             	sub    $0x4,%esp
+  801cd6:	ff 75 10             	push   0x10(%ebp)
+  801cd9:	ff 75 0c             	push   0xc(%ebp)
+  801cdc:	56                   	push   %esi
+  801cdd:	ff d0                	call   *%eax
+  801cdf:	83 c4 10             	add    $0x10,%esp
+}
+  801ce2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ce5:	5b                   	pop    %ebx
+  801ce6:	5e                   	pop    %esi
+  801ce7:	5d                   	pop    %ebp
+  801ce8:	c3                   	ret
+  801ce9:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801ceb:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801cf1:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801cf6:	77 18                	ja     801d10 <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801cf8:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801cfd:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801cff:	c1 e8 10             	shr    $0x10,%eax
+  801d02:	74 0c                	je     801d10 <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801d04:	c1 e0 10             	shl    $0x10,%eax
+  801d07:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801d0c:	29 c2                	sub    %eax,%edx
+  801d0e:	eb 06                	jmp    801d16 <write+0x87>
+		return pthread_main_tls;
+  801d10:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d16:	8b 02                	mov    (%edx),%eax
+  801d18:	8b 40 48             	mov    0x48(%eax),%eax
+  801d1b:	83 ec 04             	sub    $0x4,%esp
+  801d1e:	53                   	push   %ebx
+  801d1f:	50                   	push   %eax
+  801d20:	68 01 4f 80 00       	push   $0x804f01
+  801d25:	e8 26 e6 ff ff       	call   800350 <cprintf>
+		return -E_INVAL;
+  801d2a:	83 c4 10             	add    $0x10,%esp
+  801d2d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d32:	eb ae                	jmp    801ce2 <write+0x53>
+		return -E_NOT_SUPP;
+  801d34:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d39:	eb a7                	jmp    801ce2 <write+0x53>
+
+00801d3b <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801d3b:	55                   	push   %ebp
+  801d3c:	89 e5                	mov    %esp,%ebp
+  801d3e:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d41:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d44:	50                   	push   %eax
+  801d45:	ff 75 08             	push   0x8(%ebp)
+  801d48:	e8 ba fb ff ff       	call   801907 <fd_lookup>
+  801d4d:	83 c4 10             	add    $0x10,%esp
+  801d50:	85 c0                	test   %eax,%eax
+  801d52:	78 0e                	js     801d62 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801d54:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d57:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d5a:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801d5d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d62:	c9                   	leave
+  801d63:	c3                   	ret
+
+00801d64 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801d64:	55                   	push   %ebp
+  801d65:	89 e5                	mov    %esp,%ebp
+  801d67:	56                   	push   %esi
+  801d68:	53                   	push   %ebx
+  801d69:	83 ec 18             	sub    $0x18,%esp
+  801d6c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d6f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d72:	50                   	push   %eax
+  801d73:	53                   	push   %ebx
+  801d74:	e8 8e fb ff ff       	call   801907 <fd_lookup>
+  801d79:	83 c4 10             	add    $0x10,%esp
+  801d7c:	85 c0                	test   %eax,%eax
+  801d7e:	78 34                	js     801db4 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d80:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d83:	83 ec 08             	sub    $0x8,%esp
+  801d86:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d89:	50                   	push   %eax
+  801d8a:	ff 36                	push   (%esi)
+  801d8c:	e8 c6 fb ff ff       	call   801957 <dev_lookup>
+  801d91:	83 c4 10             	add    $0x10,%esp
+  801d94:	85 c0                	test   %eax,%eax
+  801d96:	78 1c                	js     801db4 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d98:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801d9c:	74 1d                	je     801dbb <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801d9e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801da1:	8b 40 18             	mov    0x18(%eax),%eax
+  801da4:	85 c0                	test   %eax,%eax
+  801da6:	74 5e                	je     801e06 <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801da8:	83 ec 08             	sub    $0x8,%esp
+  801dab:	ff 75 0c             	push   0xc(%ebp)
+  801dae:	56                   	push   %esi
+  801daf:	ff d0                	call   *%eax
+  801db1:	83 c4 10             	add    $0x10,%esp
+}
+  801db4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801db7:	5b                   	pop    %ebx
+  801db8:	5e                   	pop    %esi
+  801db9:	5d                   	pop    %ebp
+  801dba:	c3                   	ret
+  801dbb:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801dbd:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801dc3:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801dc8:	77 18                	ja     801de2 <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801dca:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801dcf:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801dd1:	c1 e8 10             	shr    $0x10,%eax
+  801dd4:	74 0c                	je     801de2 <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801dd6:	c1 e0 10             	shl    $0x10,%eax
+  801dd9:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801dde:	29 c2                	sub    %eax,%edx
+  801de0:	eb 06                	jmp    801de8 <ftruncate+0x84>
+		return pthread_main_tls;
+  801de2:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+			thisenv->env_id, fdnum);
+  801de8:	8b 02                	mov    (%edx),%eax
+  801dea:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801ded:	83 ec 04             	sub    $0x4,%esp
+  801df0:	53                   	push   %ebx
+  801df1:	50                   	push   %eax
+  801df2:	68 c4 4e 80 00       	push   $0x804ec4
+  801df7:	e8 54 e5 ff ff       	call   800350 <cprintf>
+		return -E_INVAL;
+  801dfc:	83 c4 10             	add    $0x10,%esp
+  801dff:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e04:	eb ae                	jmp    801db4 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801e06:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e0b:	eb a7                	jmp    801db4 <ftruncate+0x50>
+
+00801e0d <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801e0d:	55                   	push   %ebp
+  801e0e:	89 e5                	mov    %esp,%ebp
+  801e10:	56                   	push   %esi
+  801e11:	53                   	push   %ebx
+  801e12:	83 ec 18             	sub    $0x18,%esp
+  801e15:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801e18:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e1b:	50                   	push   %eax
+  801e1c:	ff 75 08             	push   0x8(%ebp)
+  801e1f:	e8 e3 fa ff ff       	call   801907 <fd_lookup>
+  801e24:	83 c4 10             	add    $0x10,%esp
+  801e27:	85 c0                	test   %eax,%eax
+  801e29:	78 49                	js     801e74 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801e2b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e2e:	83 ec 08             	sub    $0x8,%esp
+  801e31:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e34:	50                   	push   %eax
+  801e35:	ff 36                	push   (%esi)
+  801e37:	e8 1b fb ff ff       	call   801957 <dev_lookup>
+  801e3c:	83 c4 10             	add    $0x10,%esp
+  801e3f:	85 c0                	test   %eax,%eax
+  801e41:	78 31                	js     801e74 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801e43:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e46:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801e4a:	74 2f                	je     801e7b <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801e4c:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801e4f:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801e56:	00 00 00 
+	stat->st_isdir = 0;
+  801e59:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801e60:	00 00 00 
+	stat->st_dev = dev;
+  801e63:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801e69:	83 ec 08             	sub    $0x8,%esp
+  801e6c:	53                   	push   %ebx
+  801e6d:	56                   	push   %esi
+  801e6e:	ff 50 14             	call   *0x14(%eax)
+  801e71:	83 c4 10             	add    $0x10,%esp
+}
+  801e74:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e77:	5b                   	pop    %ebx
+  801e78:	5e                   	pop    %esi
+  801e79:	5d                   	pop    %ebp
+  801e7a:	c3                   	ret
+		return -E_NOT_SUPP;
+  801e7b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e80:	eb f2                	jmp    801e74 <fstat+0x67>
+
+00801e82 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801e82:	55                   	push   %ebp
+  801e83:	89 e5                	mov    %esp,%ebp
+  801e85:	56                   	push   %esi
+  801e86:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801e87:	83 ec 08             	sub    $0x8,%esp
+  801e8a:	6a 00                	push   $0x0
+  801e8c:	ff 75 08             	push   0x8(%ebp)
+  801e8f:	e8 4b 03 00 00       	call   8021df <open>
+  801e94:	89 c3                	mov    %eax,%ebx
+  801e96:	83 c4 10             	add    $0x10,%esp
+  801e99:	85 c0                	test   %eax,%eax
+  801e9b:	78 1b                	js     801eb8 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801e9d:	83 ec 08             	sub    $0x8,%esp
+  801ea0:	ff 75 0c             	push   0xc(%ebp)
+  801ea3:	50                   	push   %eax
+  801ea4:	e8 64 ff ff ff       	call   801e0d <fstat>
+  801ea9:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801eab:	89 1c 24             	mov    %ebx,(%esp)
+  801eae:	e8 a8 fb ff ff       	call   801a5b <close>
+	return r;
+  801eb3:	83 c4 10             	add    $0x10,%esp
+  801eb6:	89 f3                	mov    %esi,%ebx
+}
+  801eb8:	89 d8                	mov    %ebx,%eax
+  801eba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ebd:	5b                   	pop    %ebx
+  801ebe:	5e                   	pop    %esi
+  801ebf:	5d                   	pop    %ebp
+  801ec0:	c3                   	ret
+
+00801ec1 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801ec1:	55                   	push   %ebp
+  801ec2:	89 e5                	mov    %esp,%ebp
+  801ec4:	56                   	push   %esi
+  801ec5:	53                   	push   %ebx
+  801ec6:	89 c6                	mov    %eax,%esi
+  801ec8:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801eca:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  801ed1:	74 27                	je     801efa <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801ed3:	6a 07                	push   $0x7
+  801ed5:	68 00 80 80 00       	push   $0x808000
+  801eda:	56                   	push   %esi
+  801edb:	ff 35 00 70 80 00    	push   0x807000
+  801ee1:	e8 3c 26 00 00       	call   804522 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801ee6:	83 c4 0c             	add    $0xc,%esp
+  801ee9:	6a 00                	push   $0x0
+  801eeb:	53                   	push   %ebx
+  801eec:	6a 00                	push   $0x0
+  801eee:	e8 39 25 00 00       	call   80442c <ipc_recv>
+}
+  801ef3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ef6:	5b                   	pop    %ebx
+  801ef7:	5e                   	pop    %esi
+  801ef8:	5d                   	pop    %ebp
+  801ef9:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801efa:	83 ec 0c             	sub    $0xc,%esp
+  801efd:	6a 01                	push   $0x1
+  801eff:	e8 74 26 00 00       	call   804578 <ipc_find_env>
+  801f04:	a3 00 70 80 00       	mov    %eax,0x807000
+  801f09:	83 c4 10             	add    $0x10,%esp
+  801f0c:	eb c5                	jmp    801ed3 <fsipc+0x12>
+
+00801f0e <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801f0e:	55                   	push   %ebp
+  801f0f:	89 e5                	mov    %esp,%ebp
+  801f11:	53                   	push   %ebx
+  801f12:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801f15:	68 04 70 80 00       	push   $0x807004
+  801f1a:	e8 29 1b 00 00       	call   803a48 <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801f1f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f22:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f25:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.set_size.req_size = newsize;
+  801f2a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f2d:	a3 04 80 80 00       	mov    %eax,0x808004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  801f32:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f37:	b8 02 00 00 00       	mov    $0x2,%eax
+  801f3c:	e8 80 ff ff ff       	call   801ec1 <fsipc>
+  801f41:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801f43:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801f4a:	e8 66 1b 00 00       	call   803ab5 <mutex_unlock>
+	return r;
+}
+  801f4f:	89 d8                	mov    %ebx,%eax
+  801f51:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f54:	c9                   	leave
+  801f55:	c3                   	ret
+
+00801f56 <devfile_flush>:
+{
+  801f56:	55                   	push   %ebp
+  801f57:	89 e5                	mov    %esp,%ebp
+  801f59:	53                   	push   %ebx
+  801f5a:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  801f5d:	68 04 70 80 00       	push   $0x807004
+  801f62:	e8 e1 1a 00 00       	call   803a48 <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801f67:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f6a:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f6d:	a3 00 80 80 00       	mov    %eax,0x808000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  801f72:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f77:	b8 06 00 00 00       	mov    $0x6,%eax
+  801f7c:	e8 40 ff ff ff       	call   801ec1 <fsipc>
+  801f81:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801f83:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801f8a:	e8 26 1b 00 00       	call   803ab5 <mutex_unlock>
+}
+  801f8f:	89 d8                	mov    %ebx,%eax
+  801f91:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f94:	c9                   	leave
+  801f95:	c3                   	ret
+
+00801f96 <devfile_stat>:
+{
+  801f96:	55                   	push   %ebp
+  801f97:	89 e5                	mov    %esp,%ebp
+  801f99:	56                   	push   %esi
+  801f9a:	53                   	push   %ebx
+  801f9b:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  801f9e:	83 ec 0c             	sub    $0xc,%esp
+  801fa1:	68 04 70 80 00       	push   $0x807004
+  801fa6:	e8 9d 1a 00 00       	call   803a48 <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801fab:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fae:	8b 40 0c             	mov    0xc(%eax),%eax
+  801fb1:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  801fb6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fbb:	b8 05 00 00 00       	mov    $0x5,%eax
+  801fc0:	e8 fc fe ff ff       	call   801ec1 <fsipc>
+  801fc5:	89 c3                	mov    %eax,%ebx
+  801fc7:	83 c4 10             	add    $0x10,%esp
+  801fca:	85 c0                	test   %eax,%eax
+  801fcc:	79 16                	jns    801fe4 <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  801fce:	83 ec 0c             	sub    $0xc,%esp
+  801fd1:	68 04 70 80 00       	push   $0x807004
+  801fd6:	e8 da 1a 00 00       	call   803ab5 <mutex_unlock>
+}
+  801fdb:	89 d8                	mov    %ebx,%eax
+  801fdd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fe0:	5b                   	pop    %ebx
+  801fe1:	5e                   	pop    %esi
+  801fe2:	5d                   	pop    %ebp
+  801fe3:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801fe4:	83 ec 08             	sub    $0x8,%esp
+  801fe7:	68 00 80 80 00       	push   $0x808000
+  801fec:	56                   	push   %esi
+  801fed:	e8 42 e9 ff ff       	call   800934 <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  801ff2:	a1 80 80 80 00       	mov    0x808080,%eax
+  801ff7:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801ffd:	a1 84 80 80 00       	mov    0x808084,%eax
+  802002:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  802008:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  80200b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802010:	eb bc                	jmp    801fce <devfile_stat+0x38>
+
+00802012 <devfile_write>:
+{
+  802012:	55                   	push   %ebp
+  802013:	89 e5                	mov    %esp,%ebp
+  802015:	53                   	push   %ebx
+  802016:	83 ec 10             	sub    $0x10,%esp
+  802019:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  80201c:	68 04 70 80 00       	push   $0x807004
+  802021:	e8 22 1a 00 00       	call   803a48 <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802026:	8b 45 08             	mov    0x8(%ebp),%eax
+  802029:	8b 40 0c             	mov    0xc(%eax),%eax
+  80202c:	a3 00 80 80 00       	mov    %eax,0x808000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  802031:	83 c4 10             	add    $0x10,%esp
+  802034:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  80203a:	76 3d                	jbe    802079 <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  80203c:	b8 00 00 10 00       	mov    $0x100000,%eax
+  802041:	39 c3                	cmp    %eax,%ebx
+  802043:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  802046:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802049:	a3 08 80 80 00       	mov    %eax,0x808008
+	fsipcbuf.write.req_n = n;
+  80204e:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	r = fsipc(FSREQ_WRITE, NULL);
+  802054:	ba 00 00 00 00       	mov    $0x0,%edx
+  802059:	b8 04 00 00 00       	mov    $0x4,%eax
+  80205e:	e8 5e fe ff ff       	call   801ec1 <fsipc>
+  802063:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802065:	83 ec 0c             	sub    $0xc,%esp
+  802068:	68 04 70 80 00       	push   $0x807004
+  80206d:	e8 43 1a 00 00       	call   803ab5 <mutex_unlock>
+}
+  802072:	89 d8                	mov    %ebx,%eax
+  802074:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802077:	c9                   	leave
+  802078:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  802079:	83 ec 04             	sub    $0x4,%esp
+  80207c:	53                   	push   %ebx
+  80207d:	ff 75 0c             	push   0xc(%ebp)
+  802080:	68 0c 80 80 00       	push   $0x80800c
+  802085:	e8 30 ea ff ff       	call   800aba <memmove>
+  80208a:	83 c4 10             	add    $0x10,%esp
+  80208d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802092:	eb b5                	jmp    802049 <devfile_write+0x37>
+
+00802094 <devfile_read>:
+{
+  802094:	55                   	push   %ebp
+  802095:	89 e5                	mov    %esp,%ebp
+  802097:	57                   	push   %edi
+  802098:	56                   	push   %esi
+  802099:	53                   	push   %ebx
+  80209a:	83 ec 0c             	sub    $0xc,%esp
+  80209d:	8b 75 08             	mov    0x8(%ebp),%esi
+  8020a0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8020a3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  8020a6:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  8020ac:	0f 86 8c 00 00 00    	jbe    80213e <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  8020b2:	b8 00 00 10 00       	mov    $0x100000,%eax
+  8020b7:	39 c3                	cmp    %eax,%ebx
+  8020b9:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  8020bc:	89 f8                	mov    %edi,%eax
+  8020be:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  8020c1:	eb 0f                	jmp    8020d2 <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  8020c3:	0f b6 08             	movzbl (%eax),%ecx
+  8020c6:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  8020c8:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8020cd:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  8020d2:	39 d0                	cmp    %edx,%eax
+  8020d4:	72 ed                	jb     8020c3 <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  8020d6:	83 ec 0c             	sub    $0xc,%esp
+  8020d9:	68 04 70 80 00       	push   $0x807004
+  8020de:	e8 65 19 00 00       	call   803a48 <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8020e3:	8b 46 0c             	mov    0xc(%esi),%eax
+  8020e6:	a3 00 80 80 00       	mov    %eax,0x808000
+		fsipcbuf.read.req_n = n;
+  8020eb:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  8020f1:	89 3d 08 80 80 00    	mov    %edi,0x808008
+		r = fsipc(FSREQ_READ, NULL);
+  8020f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020fc:	b8 03 00 00 00       	mov    $0x3,%eax
+  802101:	e8 bb fd ff ff       	call   801ec1 <fsipc>
+  802106:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  802108:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  80210f:	e8 a1 19 00 00       	call   803ab5 <mutex_unlock>
+		assert(r <= (int) n);
+  802114:	83 c4 10             	add    $0x10,%esp
+  802117:	39 f3                	cmp    %esi,%ebx
+  802119:	7c 0a                	jl     802125 <devfile_read+0x91>
+}
+  80211b:	89 f0                	mov    %esi,%eax
+  80211d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802120:	5b                   	pop    %ebx
+  802121:	5e                   	pop    %esi
+  802122:	5f                   	pop    %edi
+  802123:	5d                   	pop    %ebp
+  802124:	c3                   	ret
+		assert(r <= (int) n);
+  802125:	68 34 4f 80 00       	push   $0x804f34
+  80212a:	68 71 4e 80 00       	push   $0x804e71
+  80212f:	68 90 00 00 00       	push   $0x90
+  802134:	68 41 4f 80 00       	push   $0x804f41
+  802139:	e8 37 e1 ff ff       	call   800275 <_panic>
+	mutex_lock(&fsipc_mu);
+  80213e:	83 ec 0c             	sub    $0xc,%esp
+  802141:	68 04 70 80 00       	push   $0x807004
+  802146:	e8 fd 18 00 00       	call   803a48 <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80214b:	8b 46 0c             	mov    0xc(%esi),%eax
+  80214e:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.read.req_n = n;
+  802153:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	fsipcbuf.read.req_va = 0;
+  802159:	c7 05 08 80 80 00 00 	movl   $0x0,0x808008
+  802160:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  802163:	ba 00 00 00 00       	mov    $0x0,%edx
+  802168:	b8 03 00 00 00       	mov    $0x3,%eax
+  80216d:	e8 4f fd ff ff       	call   801ec1 <fsipc>
+  802172:	89 c6                	mov    %eax,%esi
+  802174:	83 c4 10             	add    $0x10,%esp
+  802177:	85 c0                	test   %eax,%eax
+  802179:	78 1d                	js     802198 <devfile_read+0x104>
+		assert(r <= n);
+  80217b:	39 c3                	cmp    %eax,%ebx
+  80217d:	72 2e                	jb     8021ad <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  80217f:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802184:	7f 40                	jg     8021c6 <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  802186:	83 ec 04             	sub    $0x4,%esp
+  802189:	50                   	push   %eax
+  80218a:	68 00 80 80 00       	push   $0x808000
+  80218f:	57                   	push   %edi
+  802190:	e8 25 e9 ff ff       	call   800aba <memmove>
+  802195:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  802198:	83 ec 0c             	sub    $0xc,%esp
+  80219b:	68 04 70 80 00       	push   $0x807004
+  8021a0:	e8 10 19 00 00       	call   803ab5 <mutex_unlock>
+	return r;
+  8021a5:	83 c4 10             	add    $0x10,%esp
+  8021a8:	e9 6e ff ff ff       	jmp    80211b <devfile_read+0x87>
+		assert(r <= n);
+  8021ad:	68 4c 4f 80 00       	push   $0x804f4c
+  8021b2:	68 71 4e 80 00       	push   $0x804e71
+  8021b7:	68 99 00 00 00       	push   $0x99
+  8021bc:	68 41 4f 80 00       	push   $0x804f41
+  8021c1:	e8 af e0 ff ff       	call   800275 <_panic>
+		assert(r <= PGSIZE);
+  8021c6:	68 53 4f 80 00       	push   $0x804f53
+  8021cb:	68 71 4e 80 00       	push   $0x804e71
+  8021d0:	68 9a 00 00 00       	push   $0x9a
+  8021d5:	68 41 4f 80 00       	push   $0x804f41
+  8021da:	e8 96 e0 ff ff       	call   800275 <_panic>
+
+008021df <open>:
+{
+  8021df:	55                   	push   %ebp
+  8021e0:	89 e5                	mov    %esp,%ebp
+  8021e2:	56                   	push   %esi
+  8021e3:	53                   	push   %ebx
+  8021e4:	83 ec 1c             	sub    $0x1c,%esp
+  8021e7:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  8021ea:	56                   	push   %esi
+  8021eb:	e8 09 e7 ff ff       	call   8008f9 <strlen>
+  8021f0:	83 c4 10             	add    $0x10,%esp
+  8021f3:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8021f8:	0f 8f 85 00 00 00    	jg     802283 <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  8021fe:	83 ec 0c             	sub    $0xc,%esp
+  802201:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802204:	50                   	push   %eax
+  802205:	e8 a7 f6 ff ff       	call   8018b1 <fd_alloc>
+  80220a:	89 c3                	mov    %eax,%ebx
+  80220c:	83 c4 10             	add    $0x10,%esp
+  80220f:	85 c0                	test   %eax,%eax
+  802211:	78 55                	js     802268 <open+0x89>
+	mutex_lock(&fsipc_mu);
+  802213:	83 ec 0c             	sub    $0xc,%esp
+  802216:	68 04 70 80 00       	push   $0x807004
+  80221b:	e8 28 18 00 00       	call   803a48 <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  802220:	83 c4 08             	add    $0x8,%esp
+  802223:	56                   	push   %esi
+  802224:	68 00 80 80 00       	push   $0x808000
+  802229:	e8 06 e7 ff ff       	call   800934 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  80222e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802231:	a3 00 84 80 00       	mov    %eax,0x808400
+	r = fsipc(FSREQ_OPEN, fd);
+  802236:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802239:	b8 01 00 00 00       	mov    $0x1,%eax
+  80223e:	e8 7e fc ff ff       	call   801ec1 <fsipc>
+  802243:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802245:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  80224c:	e8 64 18 00 00       	call   803ab5 <mutex_unlock>
+	if (r < 0) {
+  802251:	83 c4 10             	add    $0x10,%esp
+  802254:	85 db                	test   %ebx,%ebx
+  802256:	78 19                	js     802271 <open+0x92>
+	return fd2num(fd);
+  802258:	83 ec 0c             	sub    $0xc,%esp
+  80225b:	ff 75 f4             	push   -0xc(%ebp)
+  80225e:	e8 27 f6 ff ff       	call   80188a <fd2num>
+  802263:	89 c3                	mov    %eax,%ebx
+  802265:	83 c4 10             	add    $0x10,%esp
+}
+  802268:	89 d8                	mov    %ebx,%eax
+  80226a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80226d:	5b                   	pop    %ebx
+  80226e:	5e                   	pop    %esi
+  80226f:	5d                   	pop    %ebp
+  802270:	c3                   	ret
+		fd_close(fd, 0);
+  802271:	83 ec 08             	sub    $0x8,%esp
+  802274:	6a 00                	push   $0x0
+  802276:	ff 75 f4             	push   -0xc(%ebp)
+  802279:	e8 56 f7 ff ff       	call   8019d4 <fd_close>
+		return r;
+  80227e:	83 c4 10             	add    $0x10,%esp
+  802281:	eb e5                	jmp    802268 <open+0x89>
+		return -E_BAD_PATH;
+  802283:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802288:	eb de                	jmp    802268 <open+0x89>
+
+0080228a <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  80228a:	55                   	push   %ebp
+  80228b:	89 e5                	mov    %esp,%ebp
+  80228d:	53                   	push   %ebx
+  80228e:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802291:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802294:	50                   	push   %eax
+  802295:	ff 75 08             	push   0x8(%ebp)
+  802298:	e8 6a f6 ff ff       	call   801907 <fd_lookup>
+  80229d:	89 c3                	mov    %eax,%ebx
+  80229f:	83 c4 10             	add    $0x10,%esp
+  8022a2:	85 c0                	test   %eax,%eax
+  8022a4:	78 5b                	js     802301 <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  8022a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022a9:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  8022af:	39 08                	cmp    %ecx,(%eax)
+  8022b1:	75 55                	jne    802308 <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  8022b3:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  8022b7:	74 56                	je     80230f <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  8022b9:	83 ec 0c             	sub    $0xc,%esp
+  8022bc:	68 04 70 80 00       	push   $0x807004
+  8022c1:	e8 82 17 00 00       	call   803a48 <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  8022c6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022c9:	8b 40 0c             	mov    0xc(%eax),%eax
+  8022cc:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.allocate.req_offset = offset;
+  8022d1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022d4:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.allocate.req_len = len;
+  8022d9:	8b 45 10             	mov    0x10(%ebp),%eax
+  8022dc:	a3 08 80 80 00       	mov    %eax,0x808008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  8022e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022e6:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8022eb:	e8 d1 fb ff ff       	call   801ec1 <fsipc>
+  8022f0:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8022f2:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  8022f9:	e8 b7 17 00 00       	call   803ab5 <mutex_unlock>
+	return r;
+  8022fe:	83 c4 10             	add    $0x10,%esp
+}
+  802301:	89 d8                	mov    %ebx,%eax
+  802303:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802306:	c9                   	leave
+  802307:	c3                   	ret
+		return -E_NOT_SUPP;
+  802308:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  80230d:	eb f2                	jmp    802301 <fallocate+0x77>
+		return -E_INVAL;
+  80230f:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802314:	eb eb                	jmp    802301 <fallocate+0x77>
+
+00802316 <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  802316:	55                   	push   %ebp
+  802317:	89 e5                	mov    %esp,%ebp
+  802319:	56                   	push   %esi
+  80231a:	53                   	push   %ebx
+  80231b:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  80231e:	89 f3                	mov    %esi,%ebx
+  802320:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  802326:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  802329:	eb 06                	jmp    802331 <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  80232b:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802331:	39 f3                	cmp    %esi,%ebx
+  802333:	73 14                	jae    802349 <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  802335:	83 ec 08             	sub    $0x8,%esp
+  802338:	53                   	push   %ebx
+  802339:	6a 00                	push   $0x0
+  80233b:	e8 cb ea ff ff       	call   800e0b <sys_page_unmap>
+  802340:	83 c4 10             	add    $0x10,%esp
+  802343:	85 c0                	test   %eax,%eax
+  802345:	79 e4                	jns    80232b <munmap+0x15>
+  802347:	eb 05                	jmp    80234e <munmap+0x38>
+			return r;
+	return 0;
+  802349:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80234e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802351:	5b                   	pop    %ebx
+  802352:	5e                   	pop    %esi
+  802353:	5d                   	pop    %ebp
+  802354:	c3                   	ret
+
+00802355 <mmap>:
+{
+  802355:	55                   	push   %ebp
+  802356:	89 e5                	mov    %esp,%ebp
+  802358:	57                   	push   %edi
+  802359:	56                   	push   %esi
+  80235a:	53                   	push   %ebx
+  80235b:	83 ec 24             	sub    $0x24,%esp
+  80235e:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802361:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802364:	50                   	push   %eax
+  802365:	ff 75 08             	push   0x8(%ebp)
+  802368:	e8 9a f5 ff ff       	call   801907 <fd_lookup>
+  80236d:	83 c4 10             	add    $0x10,%esp
+  802370:	85 c0                	test   %eax,%eax
+  802372:	0f 88 37 01 00 00    	js     8024af <mmap+0x15a>
+		return NULL;
+  802378:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  80237d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802380:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  802386:	39 0a                	cmp    %ecx,(%edx)
+  802388:	0f 85 05 01 00 00    	jne    802493 <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  80238e:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  802395:	0f 85 1b 01 00 00    	jne    8024b6 <mmap+0x161>
+  80239b:	89 f0                	mov    %esi,%eax
+  80239d:	83 e8 01             	sub    $0x1,%eax
+  8023a0:	0f 88 17 01 00 00    	js     8024bd <mmap+0x168>
+	if (prot & PROT_WRITE)
+  8023a6:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  8023aa:	75 28                	jne    8023d4 <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  8023ac:	83 ec 0c             	sub    $0xc,%esp
+  8023af:	68 04 70 80 00       	push   $0x807004
+  8023b4:	e8 8f 16 00 00       	call   803a48 <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  8023b9:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  8023bf:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  8023c5:	83 c4 10             	add    $0x10,%esp
+  8023c8:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  8023cd:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  8023d2:	eb 2b                	jmp    8023ff <mmap+0xaa>
+		cow_enable();
+  8023d4:	e8 40 f0 ff ff       	call   801419 <cow_enable>
+  8023d9:	eb d1                	jmp    8023ac <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  8023db:	89 c2                	mov    %eax,%edx
+  8023dd:	c1 ea 0c             	shr    $0xc,%edx
+  8023e0:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  8023e7:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8023ed:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  8023f3:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  8023f6:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  8023f8:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  8023fd:	77 25                	ja     802424 <mmap+0xcf>
+  8023ff:	89 c2                	mov    %eax,%edx
+  802401:	29 da                	sub    %ebx,%edx
+  802403:	39 ca                	cmp    %ecx,%edx
+  802405:	73 3a                	jae    802441 <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  802407:	89 c2                	mov    %eax,%edx
+  802409:	c1 ea 16             	shr    $0x16,%edx
+  80240c:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802413:	f6 c2 01             	test   $0x1,%dl
+  802416:	75 c3                	jne    8023db <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  802418:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  80241d:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  802422:	eb d4                	jmp    8023f8 <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  802424:	29 d8                	sub    %ebx,%eax
+  802426:	39 c8                	cmp    %ecx,%eax
+  802428:	73 17                	jae    802441 <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  80242a:	83 ec 0c             	sub    $0xc,%esp
+  80242d:	68 04 70 80 00       	push   $0x807004
+  802432:	e8 7e 16 00 00       	call   803ab5 <mutex_unlock>
+		return NULL;
+  802437:	83 c4 10             	add    $0x10,%esp
+  80243a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80243f:	eb 52                	jmp    802493 <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  802441:	85 db                	test   %ebx,%ebx
+  802443:	74 e5                	je     80242a <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802445:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802448:	8b 40 0c             	mov    0xc(%eax),%eax
+  80244b:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.map.req_offset = offset;
+  802450:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802453:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.map.req_len = len;
+  802458:	89 35 08 80 80 00    	mov    %esi,0x808008
+	fsipcbuf.map.req_va = va;
+  80245e:	89 1d 0c 80 80 00    	mov    %ebx,0x80800c
+	fsipcbuf.map.req_prot = prot;
+  802464:	8b 45 14             	mov    0x14(%ebp),%eax
+  802467:	a3 10 80 80 00       	mov    %eax,0x808010
+	r = fsipc(FSREQ_MAP, NULL);
+  80246c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802471:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802476:	e8 46 fa ff ff       	call   801ec1 <fsipc>
+  80247b:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  80247d:	83 ec 0c             	sub    $0xc,%esp
+  802480:	68 04 70 80 00       	push   $0x807004
+  802485:	e8 2b 16 00 00       	call   803ab5 <mutex_unlock>
+	if (r < 0) {
+  80248a:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  80248d:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  80248f:	85 ff                	test   %edi,%edi
+  802491:	78 08                	js     80249b <mmap+0x146>
+}
+  802493:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802496:	5b                   	pop    %ebx
+  802497:	5e                   	pop    %esi
+  802498:	5f                   	pop    %edi
+  802499:	5d                   	pop    %ebp
+  80249a:	c3                   	ret
+		munmap((void*) va, len);
+  80249b:	83 ec 08             	sub    $0x8,%esp
+  80249e:	56                   	push   %esi
+  80249f:	53                   	push   %ebx
+  8024a0:	e8 71 fe ff ff       	call   802316 <munmap>
+		return NULL;
+  8024a5:	83 c4 10             	add    $0x10,%esp
+  8024a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024ad:	eb e4                	jmp    802493 <mmap+0x13e>
+		return NULL;
+  8024af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024b4:	eb dd                	jmp    802493 <mmap+0x13e>
+		return NULL;
+  8024b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024bb:	eb d6                	jmp    802493 <mmap+0x13e>
+  8024bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024c2:	eb cf                	jmp    802493 <mmap+0x13e>
+
+008024c4 <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  8024c4:	55                   	push   %ebp
+  8024c5:	89 e5                	mov    %esp,%ebp
+  8024c7:	53                   	push   %ebx
+  8024c8:	83 ec 10             	sub    $0x10,%esp
+  8024cb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8024ce:	53                   	push   %ebx
+  8024cf:	e8 25 e4 ff ff       	call   8008f9 <strlen>
+  8024d4:	83 c4 10             	add    $0x10,%esp
+  8024d7:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8024dc:	7f 42                	jg     802520 <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  8024de:	83 ec 0c             	sub    $0xc,%esp
+  8024e1:	68 04 70 80 00       	push   $0x807004
+  8024e6:	e8 5d 15 00 00       	call   803a48 <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  8024eb:	83 c4 08             	add    $0x8,%esp
+  8024ee:	53                   	push   %ebx
+  8024ef:	68 00 80 80 00       	push   $0x808000
+  8024f4:	e8 3b e4 ff ff       	call   800934 <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  8024f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024fe:	b8 07 00 00 00       	mov    $0x7,%eax
+  802503:	e8 b9 f9 ff ff       	call   801ec1 <fsipc>
+  802508:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80250a:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  802511:	e8 9f 15 00 00       	call   803ab5 <mutex_unlock>
+	return r;
+  802516:	83 c4 10             	add    $0x10,%esp
+}
+  802519:	89 d8                	mov    %ebx,%eax
+  80251b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80251e:	c9                   	leave
+  80251f:	c3                   	ret
+		return -E_BAD_PATH;
+  802520:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802525:	eb f2                	jmp    802519 <remove+0x55>
+
+00802527 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802527:	55                   	push   %ebp
+  802528:	89 e5                	mov    %esp,%ebp
+  80252a:	53                   	push   %ebx
+  80252b:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  80252e:	68 04 70 80 00       	push   $0x807004
+  802533:	e8 10 15 00 00       	call   803a48 <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  802538:	ba 00 00 00 00       	mov    $0x0,%edx
+  80253d:	b8 08 00 00 00       	mov    $0x8,%eax
+  802542:	e8 7a f9 ff ff       	call   801ec1 <fsipc>
+  802547:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802549:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  802550:	e8 60 15 00 00       	call   803ab5 <mutex_unlock>
+	return r;
+}
+  802555:	89 d8                	mov    %ebx,%eax
+  802557:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80255a:	c9                   	leave
+  80255b:	c3                   	ret
+
+0080255c <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  80255c:	55                   	push   %ebp
+  80255d:	89 e5                	mov    %esp,%ebp
+  80255f:	56                   	push   %esi
+  802560:	53                   	push   %ebx
+  802561:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  802564:	83 ec 0c             	sub    $0xc,%esp
+  802567:	68 04 70 80 00       	push   $0x807004
+  80256c:	e8 d7 14 00 00       	call   803a48 <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  802571:	8b 45 08             	mov    0x8(%ebp),%eax
+  802574:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  802579:	ba 00 00 00 00       	mov    $0x0,%edx
+  80257e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802583:	e8 39 f9 ff ff       	call   801ec1 <fsipc>
+  802588:	89 c6                	mov    %eax,%esi
+  80258a:	83 c4 10             	add    $0x10,%esp
+  80258d:	85 db                	test   %ebx,%ebx
+  80258f:	74 7b                	je     80260c <fs_bcstat+0xb0>
+  802591:	85 c0                	test   %eax,%eax
+  802593:	78 77                	js     80260c <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  802595:	a1 00 80 80 00       	mov    0x808000,%eax
+  80259a:	89 03                	mov    %eax,(%ebx)
+  80259c:	a1 04 80 80 00       	mov    0x808004,%eax
+  8025a1:	89 43 04             	mov    %eax,0x4(%ebx)
+  8025a4:	a1 08 80 80 00       	mov    0x808008,%eax
+  8025a9:	89 43 08             	mov    %eax,0x8(%ebx)
+  8025ac:	a1 0c 80 80 00       	mov    0x80800c,%eax
+  8025b1:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8025b4:	a1 10 80 80 00       	mov    0x808010,%eax
+  8025b9:	89 43 10             	mov    %eax,0x10(%ebx)
+  8025bc:	a1 14 80 80 00       	mov    0x808014,%eax
+  8025c1:	89 43 14             	mov    %eax,0x14(%ebx)
+  8025c4:	a1 18 80 80 00       	mov    0x808018,%eax
+  8025c9:	89 43 18             	mov    %eax,0x18(%ebx)
+  8025cc:	a1 1c 80 80 00       	mov    0x80801c,%eax
+  8025d1:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  8025d4:	a1 20 80 80 00       	mov    0x808020,%eax
+  8025d9:	89 43 20             	mov    %eax,0x20(%ebx)
+  8025dc:	a1 24 80 80 00       	mov    0x808024,%eax
+  8025e1:	89 43 24             	mov    %eax,0x24(%ebx)
+  8025e4:	a1 28 80 80 00       	mov    0x808028,%eax
+  8025e9:	89 43 28             	mov    %eax,0x28(%ebx)
+  8025ec:	a1 2c 80 80 00       	mov    0x80802c,%eax
+  8025f1:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  8025f4:	a1 30 80 80 00       	mov    0x808030,%eax
+  8025f9:	89 43 30             	mov    %eax,0x30(%ebx)
+  8025fc:	a1 34 80 80 00       	mov    0x808034,%eax
+  802601:	89 43 34             	mov    %eax,0x34(%ebx)
+  802604:	a1 38 80 80 00       	mov    0x808038,%eax
+  802609:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  80260c:	83 ec 0c             	sub    $0xc,%esp
+  80260f:	68 04 70 80 00       	push   $0x807004
+  802614:	e8 9c 14 00 00       	call   803ab5 <mutex_unlock>
+	return r;
+}
+  802619:	89 f0                	mov    %esi,%eax
+  80261b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80261e:	5b                   	pop    %ebx
+  80261f:	5e                   	pop    %esi
+  802620:	5d                   	pop    %ebp
+  802621:	c3                   	ret
+
+00802622 <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  802622:	55                   	push   %ebp
+  802623:	89 e5                	mov    %esp,%ebp
+  802625:	56                   	push   %esi
+  802626:	53                   	push   %ebx
+  802627:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  802629:	0f b6 10             	movzbl (%eax),%edx
+  80262c:	80 fa 72             	cmp    $0x72,%dl
+  80262f:	74 44                	je     802675 <parse_mode+0x53>
+  802631:	80 fa 77             	cmp    $0x77,%dl
+  802634:	74 4b                	je     802681 <parse_mode+0x5f>
+  802636:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80263b:	80 fa 61             	cmp    $0x61,%dl
+  80263e:	74 09                	je     802649 <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  802640:	89 d8                	mov    %ebx,%eax
+  802642:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802645:	5b                   	pop    %ebx
+  802646:	5e                   	pop    %esi
+  802647:	5d                   	pop    %ebp
+  802648:	c3                   	ret
+	switch (mode[0]) {
+  802649:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  80264e:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  802653:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  802655:	83 ec 08             	sub    $0x8,%esp
+  802658:	6a 2b                	push   $0x2b
+  80265a:	50                   	push   %eax
+  80265b:	e8 e6 e3 ff ff       	call   800a46 <strchr>
+  802660:	83 c4 10             	add    $0x10,%esp
+  802663:	85 c0                	test   %eax,%eax
+  802665:	74 d9                	je     802640 <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  802667:	83 e3 fc             	and    $0xfffffffc,%ebx
+  80266a:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  80266d:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  802673:	eb cb                	jmp    802640 <parse_mode+0x1e>
+	switch (mode[0]) {
+  802675:	ba 01 00 00 00       	mov    $0x1,%edx
+  80267a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80267f:	eb d2                	jmp    802653 <parse_mode+0x31>
+  802681:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  802686:	bb 01 03 00 00       	mov    $0x301,%ebx
+  80268b:	eb c6                	jmp    802653 <parse_mode+0x31>
+
+0080268d <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  80268d:	55                   	push   %ebp
+  80268e:	89 e5                	mov    %esp,%ebp
+  802690:	57                   	push   %edi
+  802691:	56                   	push   %esi
+  802692:	53                   	push   %ebx
+  802693:	83 ec 1c             	sub    $0x1c,%esp
+  802696:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802699:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  80269c:	b8 24 60 80 00       	mov    $0x806024,%eax
+  8026a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  8026a6:	83 c0 24             	add    $0x24,%eax
+  8026a9:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  8026ad:	74 17                	je     8026c6 <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  8026af:	83 c3 01             	add    $0x1,%ebx
+  8026b2:	83 fb 10             	cmp    $0x10,%ebx
+  8026b5:	75 ef                	jne    8026a6 <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  8026b7:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  8026bc:	89 f0                	mov    %esi,%eax
+  8026be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026c1:	5b                   	pop    %ebx
+  8026c2:	5e                   	pop    %esi
+  8026c3:	5f                   	pop    %edi
+  8026c4:	5d                   	pop    %ebp
+  8026c5:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  8026c6:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  8026cd:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8026d0:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  8026d3:	c1 e7 02             	shl    $0x2,%edi
+  8026d6:	8d b7 20 60 80 00    	lea    0x806020(%edi),%esi
+  8026dc:	83 ec 04             	sub    $0x4,%esp
+  8026df:	6a 24                	push   $0x24
+  8026e1:	6a 00                	push   $0x0
+  8026e3:	56                   	push   %esi
+  8026e4:	e8 9c e3 ff ff       	call   800a85 <memset>
+			streams[i].f_fd = fd;
+  8026e9:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8026ec:	89 8f 20 60 80 00    	mov    %ecx,0x806020(%edi)
+			streams[i].f_flags = flags;
+  8026f2:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8026f5:	01 d8                	add    %ebx,%eax
+  8026f7:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8026fa:	89 0c 85 24 60 80 00 	mov    %ecx,0x806024(,%eax,4)
+			return &streams[i];
+  802701:	83 c4 10             	add    $0x10,%esp
+  802704:	eb b6                	jmp    8026bc <stream_alloc+0x2f>
+
+00802706 <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  802706:	55                   	push   %ebp
+  802707:	89 e5                	mov    %esp,%ebp
+  802709:	53                   	push   %ebx
+  80270a:	83 ec 14             	sub    $0x14,%esp
+  80270d:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  80270f:	8b 40 18             	mov    0x18(%eax),%eax
+  802712:	39 43 14             	cmp    %eax,0x14(%ebx)
+  802715:	74 4a                	je     802761 <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802717:	83 ec 08             	sub    $0x8,%esp
+  80271a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80271d:	50                   	push   %eax
+  80271e:	ff 33                	push   (%ebx)
+  802720:	e8 e2 f1 ff ff       	call   801907 <fd_lookup>
+  802725:	89 c2                	mov    %eax,%edx
+  802727:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80272a:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  80272f:	85 d2                	test   %edx,%edx
+  802731:	78 41                	js     802774 <stream_unread+0x6e>
+  802733:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802736:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  80273c:	39 0a                	cmp    %ecx,(%edx)
+  80273e:	75 34                	jne    802774 <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  802740:	8b 43 14             	mov    0x14(%ebx),%eax
+  802743:	03 42 04             	add    0x4(%edx),%eax
+  802746:	2b 43 18             	sub    0x18(%ebx),%eax
+  802749:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  80274c:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  802753:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  80275a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80275f:	eb 13                	jmp    802774 <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  802761:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  802768:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  80276f:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802774:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802777:	c9                   	leave
+  802778:	c3                   	ret
+
+00802779 <stream_drain>:
+{
+  802779:	55                   	push   %ebp
+  80277a:	89 e5                	mov    %esp,%ebp
+  80277c:	56                   	push   %esi
+  80277d:	53                   	push   %ebx
+  80277e:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  802780:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802785:	eb 02                	jmp    802789 <stream_drain+0x10>
+  802787:	01 c3                	add    %eax,%ebx
+  802789:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80278c:	39 c3                	cmp    %eax,%ebx
+  80278e:	73 43                	jae    8027d3 <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  802790:	83 ec 04             	sub    $0x4,%esp
+  802793:	29 d8                	sub    %ebx,%eax
+  802795:	50                   	push   %eax
+  802796:	89 d8                	mov    %ebx,%eax
+  802798:	03 46 0c             	add    0xc(%esi),%eax
+  80279b:	50                   	push   %eax
+  80279c:	ff 36                	push   (%esi)
+  80279e:	e8 ec f4 ff ff       	call   801c8f <write>
+  8027a3:	83 c4 10             	add    $0x10,%esp
+  8027a6:	85 c0                	test   %eax,%eax
+  8027a8:	7f dd                	jg     802787 <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  8027aa:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  8027ae:	8b 56 0c             	mov    0xc(%esi),%edx
+  8027b1:	83 ec 04             	sub    $0x4,%esp
+  8027b4:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8027b7:	29 d8                	sub    %ebx,%eax
+  8027b9:	50                   	push   %eax
+  8027ba:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  8027bd:	50                   	push   %eax
+  8027be:	52                   	push   %edx
+  8027bf:	e8 f6 e2 ff ff       	call   800aba <memmove>
+			f->f_wend -= done;
+  8027c4:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8027c7:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  8027c9:	83 c4 10             	add    $0x10,%esp
+  8027cc:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8027d1:	eb 0a                	jmp    8027dd <stream_drain+0x64>
+  8027d3:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  8027d8:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  8027dd:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  8027e0:	89 d0                	mov    %edx,%eax
+  8027e2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027e5:	5b                   	pop    %ebx
+  8027e6:	5e                   	pop    %esi
+  8027e7:	5d                   	pop    %ebp
+  8027e8:	c3                   	ret
+
+008027e9 <stream_setup>:
+	if (f->f_buf)
+  8027e9:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8027ed:	74 01                	je     8027f0 <stream_setup+0x7>
+  8027ef:	c3                   	ret
+{
+  8027f0:	55                   	push   %ebp
+  8027f1:	89 e5                	mov    %esp,%ebp
+  8027f3:	53                   	push   %ebx
+  8027f4:	83 ec 04             	sub    $0x4,%esp
+  8027f7:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  8027f9:	8b 40 08             	mov    0x8(%eax),%eax
+  8027fc:	85 c0                	test   %eax,%eax
+  8027fe:	74 17                	je     802817 <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  802800:	83 f8 03             	cmp    $0x3,%eax
+  802803:	75 2d                	jne    802832 <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  802805:	8d 43 20             	lea    0x20(%ebx),%eax
+  802808:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  80280b:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  802812:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802815:	c9                   	leave
+  802816:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  802817:	83 ec 0c             	sub    $0xc,%esp
+  80281a:	ff 33                	push   (%ebx)
+  80281c:	e8 29 1b 00 00       	call   80434a <iscons>
+  802821:	83 c4 10             	add    $0x10,%esp
+  802824:	85 c0                	test   %eax,%eax
+  802826:	0f 9f c0             	setg   %al
+  802829:	0f b6 c0             	movzbl %al,%eax
+  80282c:	83 c0 01             	add    $0x1,%eax
+  80282f:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  802832:	83 ec 0c             	sub    $0xc,%esp
+  802835:	68 00 10 00 00       	push   $0x1000
+  80283a:	e8 6e 0b 00 00       	call   8033ad <malloc>
+  80283f:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802842:	83 c4 10             	add    $0x10,%esp
+  802845:	85 c0                	test   %eax,%eax
+  802847:	74 bc                	je     802805 <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  802849:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  802850:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  802854:	eb bc                	jmp    802812 <stream_setup+0x29>
+
+00802856 <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  802856:	55                   	push   %ebp
+  802857:	89 e5                	mov    %esp,%ebp
+  802859:	53                   	push   %ebx
+  80285a:	83 ec 04             	sub    $0x4,%esp
+  80285d:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  80285f:	e8 85 ff ff ff       	call   8027e9 <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  802864:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  802869:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  80286d:	74 3d                	je     8028ac <stream_fill+0x56>
+  80286f:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  802873:	74 10                	je     802885 <stream_fill+0x2f>
+  802875:	89 d8                	mov    %ebx,%eax
+  802877:	e8 fd fe ff ff       	call   802779 <stream_drain>
+		return 0;
+  80287c:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  802881:	85 c0                	test   %eax,%eax
+  802883:	78 27                	js     8028ac <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  802885:	83 ec 04             	sub    $0x4,%esp
+  802888:	ff 73 10             	push   0x10(%ebx)
+  80288b:	ff 73 0c             	push   0xc(%ebx)
+  80288e:	ff 33                	push   (%ebx)
+  802890:	e8 02 f3 ff ff       	call   801b97 <read>
+  802895:	83 c4 10             	add    $0x10,%esp
+  802898:	85 c0                	test   %eax,%eax
+  80289a:	7e 17                	jle    8028b3 <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  80289c:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  8028a0:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  8028a7:	89 c2                	mov    %eax,%edx
+  8028a9:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  8028ac:	89 d0                	mov    %edx,%eax
+  8028ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028b1:	c9                   	leave
+  8028b2:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  8028b3:	c1 f8 1f             	sar    $0x1f,%eax
+  8028b6:	83 e0 04             	and    $0x4,%eax
+  8028b9:	83 c0 04             	add    $0x4,%eax
+  8028bc:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  8028bf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028c4:	eb e6                	jmp    8028ac <stream_fill+0x56>
+
+008028c6 <fopen>:
+{
+  8028c6:	55                   	push   %ebp
+  8028c7:	89 e5                	mov    %esp,%ebp
+  8028c9:	57                   	push   %edi
+  8028ca:	56                   	push   %esi
+  8028cb:	53                   	push   %ebx
+  8028cc:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  8028d2:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8028d5:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  8028db:	89 f0                	mov    %esi,%eax
+  8028dd:	e8 40 fd ff ff       	call   802622 <parse_mode>
+		return 0;
+  8028e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8028e7:	85 c0                	test   %eax,%eax
+  8028e9:	78 2d                	js     802918 <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  8028eb:	83 ec 08             	sub    $0x8,%esp
+  8028ee:	50                   	push   %eax
+  8028ef:	ff 75 08             	push   0x8(%ebp)
+  8028f2:	e8 e8 f8 ff ff       	call   8021df <open>
+  8028f7:	89 c7                	mov    %eax,%edi
+  8028f9:	83 c4 10             	add    $0x10,%esp
+  8028fc:	85 c0                	test   %eax,%eax
+  8028fe:	78 58                	js     802958 <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  802900:	80 3e 61             	cmpb   $0x61,(%esi)
+  802903:	74 1d                	je     802922 <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  802905:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  80290b:	89 f8                	mov    %edi,%eax
+  80290d:	e8 7b fd ff ff       	call   80268d <stream_alloc>
+  802912:	89 c3                	mov    %eax,%ebx
+  802914:	85 c0                	test   %eax,%eax
+  802916:	74 32                	je     80294a <fopen+0x84>
+}
+  802918:	89 d8                	mov    %ebx,%eax
+  80291a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80291d:	5b                   	pop    %ebx
+  80291e:	5e                   	pop    %esi
+  80291f:	5f                   	pop    %edi
+  802920:	5d                   	pop    %ebp
+  802921:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  802922:	83 ec 08             	sub    $0x8,%esp
+  802925:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  80292b:	50                   	push   %eax
+  80292c:	57                   	push   %edi
+  80292d:	e8 db f4 ff ff       	call   801e0d <fstat>
+  802932:	83 c4 10             	add    $0x10,%esp
+  802935:	85 c0                	test   %eax,%eax
+  802937:	78 cc                	js     802905 <fopen+0x3f>
+		seek(fd, st.st_size);
+  802939:	83 ec 08             	sub    $0x8,%esp
+  80293c:	ff 75 dc             	push   -0x24(%ebp)
+  80293f:	57                   	push   %edi
+  802940:	e8 f6 f3 ff ff       	call   801d3b <seek>
+  802945:	83 c4 10             	add    $0x10,%esp
+  802948:	eb bb                	jmp    802905 <fopen+0x3f>
+		close(fd);
+  80294a:	83 ec 0c             	sub    $0xc,%esp
+  80294d:	57                   	push   %edi
+  80294e:	e8 08 f1 ff ff       	call   801a5b <close>
+  802953:	83 c4 10             	add    $0x10,%esp
+  802956:	eb c0                	jmp    802918 <fopen+0x52>
+		return 0;
+  802958:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80295d:	eb b9                	jmp    802918 <fopen+0x52>
+
+0080295f <fdopen>:
+{
+  80295f:	55                   	push   %ebp
+  802960:	89 e5                	mov    %esp,%ebp
+  802962:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  802965:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802968:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80296b:	e8 b2 fc ff ff       	call   802622 <parse_mode>
+  802970:	89 c2                	mov    %eax,%edx
+		return 0;
+  802972:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  802977:	85 d2                	test   %edx,%edx
+  802979:	78 0b                	js     802986 <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  80297b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80297e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802981:	e8 07 fd ff ff       	call   80268d <stream_alloc>
+}
+  802986:	c9                   	leave
+  802987:	c3                   	ret
+
+00802988 <setvbuf>:
+{
+  802988:	55                   	push   %ebp
+  802989:	89 e5                	mov    %esp,%ebp
+  80298b:	57                   	push   %edi
+  80298c:	56                   	push   %esi
+  80298d:	53                   	push   %ebx
+  80298e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802991:	8b 55 10             	mov    0x10(%ebp),%edx
+  802994:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  802997:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  80299b:	75 3a                	jne    8029d7 <setvbuf+0x4f>
+  80299d:	8d 72 ff             	lea    -0x1(%edx),%esi
+  8029a0:	83 fe 02             	cmp    $0x2,%esi
+  8029a3:	77 39                	ja     8029de <setvbuf+0x56>
+	f->f_bufmode = mode;
+  8029a5:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  8029a8:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8029ac:	0f 95 c3             	setne  %bl
+  8029af:	85 ff                	test   %edi,%edi
+  8029b1:	0f 95 c1             	setne  %cl
+  8029b4:	84 cb                	test   %cl,%bl
+  8029b6:	74 05                	je     8029bd <setvbuf+0x35>
+  8029b8:	83 fa 03             	cmp    $0x3,%edx
+  8029bb:	75 0a                	jne    8029c7 <setvbuf+0x3f>
+	return 0;
+  8029bd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8029c2:	5b                   	pop    %ebx
+  8029c3:	5e                   	pop    %esi
+  8029c4:	5f                   	pop    %edi
+  8029c5:	5d                   	pop    %ebp
+  8029c6:	c3                   	ret
+		f->f_buf = buf;
+  8029c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8029ca:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  8029cd:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  8029d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029d5:	eb eb                	jmp    8029c2 <setvbuf+0x3a>
+		return EOF;
+  8029d7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8029dc:	eb e4                	jmp    8029c2 <setvbuf+0x3a>
+  8029de:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8029e3:	eb dd                	jmp    8029c2 <setvbuf+0x3a>
+
+008029e5 <fflush>:
+{
+  8029e5:	55                   	push   %ebp
+  8029e6:	89 e5                	mov    %esp,%ebp
+  8029e8:	57                   	push   %edi
+  8029e9:	56                   	push   %esi
+  8029ea:	53                   	push   %ebx
+  8029eb:	83 ec 0c             	sub    $0xc,%esp
+  8029ee:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  8029f1:	85 db                	test   %ebx,%ebx
+  8029f3:	74 1a                	je     802a0f <fflush+0x2a>
+	stream_unread(f);
+  8029f5:	89 d8                	mov    %ebx,%eax
+  8029f7:	e8 0a fd ff ff       	call   802706 <stream_unread>
+	return stream_drain(f);
+  8029fc:	89 d8                	mov    %ebx,%eax
+  8029fe:	e8 76 fd ff ff       	call   802779 <stream_drain>
+  802a03:	89 c7                	mov    %eax,%edi
+}
+  802a05:	89 f8                	mov    %edi,%eax
+  802a07:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a0a:	5b                   	pop    %ebx
+  802a0b:	5e                   	pop    %esi
+  802a0c:	5f                   	pop    %edi
+  802a0d:	5d                   	pop    %ebp
+  802a0e:	c3                   	ret
+  802a0f:	bb 20 60 80 00       	mov    $0x806020,%ebx
+  802a14:	be 60 62 80 00       	mov    $0x806260,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  802a19:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a1e:	eb 03                	jmp    802a23 <fflush+0x3e>
+  802a20:	83 c3 24             	add    $0x24,%ebx
+  802a23:	39 f3                	cmp    %esi,%ebx
+  802a25:	74 de                	je     802a05 <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  802a27:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  802a2b:	74 f3                	je     802a20 <fflush+0x3b>
+  802a2d:	83 ec 0c             	sub    $0xc,%esp
+  802a30:	53                   	push   %ebx
+  802a31:	e8 af ff ff ff       	call   8029e5 <fflush>
+  802a36:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  802a39:	85 c0                	test   %eax,%eax
+  802a3b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802a40:	0f 48 f8             	cmovs  %eax,%edi
+  802a43:	eb db                	jmp    802a20 <fflush+0x3b>
+
+00802a45 <fclose>:
+{
+  802a45:	55                   	push   %ebp
+  802a46:	89 e5                	mov    %esp,%ebp
+  802a48:	56                   	push   %esi
+  802a49:	53                   	push   %ebx
+  802a4a:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  802a4d:	83 ec 0c             	sub    $0xc,%esp
+  802a50:	56                   	push   %esi
+  802a51:	e8 8f ff ff ff       	call   8029e5 <fflush>
+  802a56:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  802a58:	83 c4 04             	add    $0x4,%esp
+  802a5b:	ff 36                	push   (%esi)
+  802a5d:	e8 f9 ef ff ff       	call   801a5b <close>
+  802a62:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  802a65:	85 c0                	test   %eax,%eax
+  802a67:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802a6c:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  802a6f:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  802a73:	75 10                	jne    802a85 <fclose+0x40>
+	f->f_flags = 0;
+  802a75:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  802a7c:	89 d8                	mov    %ebx,%eax
+  802a7e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a81:	5b                   	pop    %ebx
+  802a82:	5e                   	pop    %esi
+  802a83:	5d                   	pop    %ebp
+  802a84:	c3                   	ret
+		free(f->f_buf);
+  802a85:	83 ec 0c             	sub    $0xc,%esp
+  802a88:	ff 76 0c             	push   0xc(%esi)
+  802a8b:	e8 54 08 00 00       	call   8032e4 <free>
+  802a90:	83 c4 10             	add    $0x10,%esp
+  802a93:	eb e0                	jmp    802a75 <fclose+0x30>
+
+00802a95 <fileno>:
+{
+  802a95:	55                   	push   %ebp
+  802a96:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  802a98:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a9b:	8b 00                	mov    (%eax),%eax
+}
+  802a9d:	5d                   	pop    %ebp
+  802a9e:	c3                   	ret
+
+00802a9f <feof>:
+{
+  802a9f:	55                   	push   %ebp
+  802aa0:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  802aa2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802aa5:	8b 40 04             	mov    0x4(%eax),%eax
+  802aa8:	c1 e8 02             	shr    $0x2,%eax
+  802aab:	83 e0 01             	and    $0x1,%eax
+}
+  802aae:	5d                   	pop    %ebp
+  802aaf:	c3                   	ret
+
+00802ab0 <ferror>:
+{
+  802ab0:	55                   	push   %ebp
+  802ab1:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  802ab3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ab6:	8b 40 04             	mov    0x4(%eax),%eax
+  802ab9:	c1 e8 03             	shr    $0x3,%eax
+  802abc:	83 e0 01             	and    $0x1,%eax
+}
+  802abf:	5d                   	pop    %ebp
+  802ac0:	c3                   	ret
+
+00802ac1 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  802ac1:	55                   	push   %ebp
+  802ac2:	89 e5                	mov    %esp,%ebp
+  802ac4:	53                   	push   %ebx
+  802ac5:	83 ec 04             	sub    $0x4,%esp
+  802ac8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802acb:	8b 43 18             	mov    0x18(%ebx),%eax
+  802ace:	39 43 14             	cmp    %eax,0x14(%ebx)
+  802ad1:	74 15                	je     802ae8 <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  802ad3:	8b 53 0c             	mov    0xc(%ebx),%edx
+  802ad6:	8b 43 14             	mov    0x14(%ebx),%eax
+  802ad9:	8d 48 01             	lea    0x1(%eax),%ecx
+  802adc:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  802adf:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  802ae3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ae6:	c9                   	leave
+  802ae7:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802ae8:	89 d8                	mov    %ebx,%eax
+  802aea:	e8 67 fd ff ff       	call   802856 <stream_fill>
+  802aef:	85 c0                	test   %eax,%eax
+  802af1:	75 e0                	jne    802ad3 <fgetc+0x12>
+		return EOF;
+  802af3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802af8:	eb e9                	jmp    802ae3 <fgetc+0x22>
+
+00802afa <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  802afa:	55                   	push   %ebp
+  802afb:	89 e5                	mov    %esp,%ebp
+  802afd:	57                   	push   %edi
+  802afe:	56                   	push   %esi
+  802aff:	53                   	push   %ebx
+  802b00:	83 ec 1c             	sub    $0x1c,%esp
+  802b03:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  802b06:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802b0b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b0e:	83 e8 01             	sub    $0x1,%eax
+  802b11:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  802b14:	eb 66                	jmp    802b7c <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802b16:	8b 46 14             	mov    0x14(%esi),%eax
+  802b19:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802b1c:	29 c3                	sub    %eax,%ebx
+  802b1e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802b21:	29 fa                	sub    %edi,%edx
+  802b23:	39 d3                	cmp    %edx,%ebx
+  802b25:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802b28:	83 ec 04             	sub    $0x4,%esp
+  802b2b:	53                   	push   %ebx
+  802b2c:	6a 0a                	push   $0xa
+  802b2e:	03 46 0c             	add    0xc(%esi),%eax
+  802b31:	50                   	push   %eax
+  802b32:	e8 34 e0 ff ff       	call   800b6b <memfind>
+  802b37:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  802b3a:	8b 46 0c             	mov    0xc(%esi),%eax
+  802b3d:	8b 4e 14             	mov    0x14(%esi),%ecx
+  802b40:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  802b43:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802b45:	83 c4 10             	add    $0x10,%esp
+  802b48:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802b4b:	74 0b                	je     802b58 <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  802b4d:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802b50:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802b53:	29 d3                	sub    %edx,%ebx
+  802b55:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  802b58:	83 ec 04             	sub    $0x4,%esp
+  802b5b:	53                   	push   %ebx
+  802b5c:	01 c8                	add    %ecx,%eax
+  802b5e:	50                   	push   %eax
+  802b5f:	89 f8                	mov    %edi,%eax
+  802b61:	03 45 08             	add    0x8(%ebp),%eax
+  802b64:	50                   	push   %eax
+  802b65:	e8 50 df ff ff       	call   800aba <memmove>
+		f->f_rpos += m;
+  802b6a:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  802b6d:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  802b6f:	83 c4 10             	add    $0x10,%esp
+  802b72:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b75:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  802b7a:	74 1f                	je     802b9b <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  802b7c:	8d 47 01             	lea    0x1(%edi),%eax
+  802b7f:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  802b82:	73 17                	jae    802b9b <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802b84:	8b 46 18             	mov    0x18(%esi),%eax
+  802b87:	39 46 14             	cmp    %eax,0x14(%esi)
+  802b8a:	75 8a                	jne    802b16 <fgets+0x1c>
+  802b8c:	89 f0                	mov    %esi,%eax
+  802b8e:	e8 c3 fc ff ff       	call   802856 <stream_fill>
+  802b93:	85 c0                	test   %eax,%eax
+  802b95:	0f 85 7b ff ff ff    	jne    802b16 <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  802b9b:	85 ff                	test   %edi,%edi
+  802b9d:	74 0f                	je     802bae <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  802b9f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ba2:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  802ba6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ba9:	5b                   	pop    %ebx
+  802baa:	5e                   	pop    %esi
+  802bab:	5f                   	pop    %edi
+  802bac:	5d                   	pop    %ebp
+  802bad:	c3                   	ret
+		return 0;
+  802bae:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bb3:	eb f1                	jmp    802ba6 <fgets+0xac>
+
+00802bb5 <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  802bb5:	55                   	push   %ebp
+  802bb6:	89 e5                	mov    %esp,%ebp
+  802bb8:	57                   	push   %edi
+  802bb9:	56                   	push   %esi
+  802bba:	53                   	push   %ebx
+  802bbb:	83 ec 1c             	sub    $0x1c,%esp
+  802bbe:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  802bc1:	89 f0                	mov    %esi,%eax
+  802bc3:	e8 21 fc ff ff       	call   8027e9 <stream_setup>
+	want = size * n;
+  802bc8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802bcb:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802bcf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  802bd2:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bd7:	eb 43                	jmp    802c1c <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  802bd9:	29 d3                	sub    %edx,%ebx
+  802bdb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802bde:	29 f8                	sub    %edi,%eax
+  802be0:	39 c3                	cmp    %eax,%ebx
+  802be2:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  802be5:	83 ec 04             	sub    $0x4,%esp
+  802be8:	53                   	push   %ebx
+  802be9:	03 56 0c             	add    0xc(%esi),%edx
+  802bec:	52                   	push   %edx
+  802bed:	89 f8                	mov    %edi,%eax
+  802bef:	03 45 08             	add    0x8(%ebp),%eax
+  802bf2:	50                   	push   %eax
+  802bf3:	e8 c2 de ff ff       	call   800aba <memmove>
+			f->f_rpos += m;
+  802bf8:	01 5e 14             	add    %ebx,0x14(%esi)
+  802bfb:	83 c4 10             	add    $0x10,%esp
+  802bfe:	eb 1a                	jmp    802c1a <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  802c00:	83 ec 04             	sub    $0x4,%esp
+  802c03:	53                   	push   %ebx
+  802c04:	89 f8                	mov    %edi,%eax
+  802c06:	03 45 08             	add    0x8(%ebp),%eax
+  802c09:	50                   	push   %eax
+  802c0a:	ff 36                	push   (%esi)
+  802c0c:	e8 86 ef ff ff       	call   801b97 <read>
+  802c11:	89 c3                	mov    %eax,%ebx
+  802c13:	83 c4 10             	add    $0x10,%esp
+  802c16:	85 c0                	test   %eax,%eax
+  802c18:	7e 36                	jle    802c50 <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  802c1a:	01 df                	add    %ebx,%edi
+  802c1c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802c1f:	39 c7                	cmp    %eax,%edi
+  802c21:	73 39                	jae    802c5c <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  802c23:	8b 56 14             	mov    0x14(%esi),%edx
+  802c26:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802c29:	39 da                	cmp    %ebx,%edx
+  802c2b:	72 ac                	jb     802bd9 <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  802c2d:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802c30:	29 fb                	sub    %edi,%ebx
+  802c32:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  802c35:	72 3e                	jb     802c75 <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  802c37:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  802c3b:	74 1f                	je     802c5c <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  802c3d:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  802c41:	74 bd                	je     802c00 <fread+0x4b>
+  802c43:	89 f0                	mov    %esi,%eax
+  802c45:	e8 2f fb ff ff       	call   802779 <stream_drain>
+  802c4a:	85 c0                	test   %eax,%eax
+  802c4c:	79 b2                	jns    802c00 <fread+0x4b>
+  802c4e:	eb 0c                	jmp    802c5c <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802c50:	c1 fb 1f             	sar    $0x1f,%ebx
+  802c53:	83 e3 04             	and    $0x4,%ebx
+  802c56:	83 c3 04             	add    $0x4,%ebx
+  802c59:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  802c5c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c5f:	85 c0                	test   %eax,%eax
+  802c61:	74 0a                	je     802c6d <fread+0xb8>
+  802c63:	89 f8                	mov    %edi,%eax
+  802c65:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c6a:	f7 75 0c             	divl   0xc(%ebp)
+}
+  802c6d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c70:	5b                   	pop    %ebx
+  802c71:	5e                   	pop    %esi
+  802c72:	5f                   	pop    %edi
+  802c73:	5d                   	pop    %ebp
+  802c74:	c3                   	ret
+		} else if (!stream_fill(f))
+  802c75:	89 f0                	mov    %esi,%eax
+  802c77:	e8 da fb ff ff       	call   802856 <stream_fill>
+  802c7c:	85 c0                	test   %eax,%eax
+  802c7e:	74 dc                	je     802c5c <fread+0xa7>
+			m = 0;
+  802c80:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c85:	eb 93                	jmp    802c1a <fread+0x65>
+
+00802c87 <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  802c87:	55                   	push   %ebp
+  802c88:	89 e5                	mov    %esp,%ebp
+  802c8a:	57                   	push   %edi
+  802c8b:	56                   	push   %esi
+  802c8c:	53                   	push   %ebx
+  802c8d:	83 ec 1c             	sub    $0x1c,%esp
+  802c90:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  802c93:	8b 43 04             	mov    0x4(%ebx),%eax
+  802c96:	a8 02                	test   $0x2,%al
+  802c98:	75 13                	jne    802cad <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  802c9a:	83 c8 08             	or     $0x8,%eax
+  802c9d:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  802ca0:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  802ca5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ca8:	5b                   	pop    %ebx
+  802ca9:	5e                   	pop    %esi
+  802caa:	5f                   	pop    %edi
+  802cab:	5d                   	pop    %ebp
+  802cac:	c3                   	ret
+	stream_setup(f);
+  802cad:	89 d8                	mov    %ebx,%eax
+  802caf:	e8 35 fb ff ff       	call   8027e9 <stream_setup>
+	want = size * n;
+  802cb4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802cb7:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802cbb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  802cbe:	89 d8                	mov    %ebx,%eax
+  802cc0:	e8 41 fa ff ff       	call   802706 <stream_unread>
+	for (done = 0; done < want; ) {
+  802cc5:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  802cca:	84 c0                	test   %al,%al
+  802ccc:	75 7b                	jne    802d49 <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  802cce:	be 00 00 00 00       	mov    $0x0,%esi
+  802cd3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802cd6:	39 fe                	cmp    %edi,%esi
+  802cd8:	73 24                	jae    802cfe <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802cda:	83 ec 04             	sub    $0x4,%esp
+  802cdd:	89 f8                	mov    %edi,%eax
+  802cdf:	29 f0                	sub    %esi,%eax
+  802ce1:	50                   	push   %eax
+  802ce2:	89 f0                	mov    %esi,%eax
+  802ce4:	03 45 08             	add    0x8(%ebp),%eax
+  802ce7:	50                   	push   %eax
+  802ce8:	ff 33                	push   (%ebx)
+  802cea:	e8 a0 ef ff ff       	call   801c8f <write>
+  802cef:	83 c4 10             	add    $0x10,%esp
+  802cf2:	85 c0                	test   %eax,%eax
+  802cf4:	7e 04                	jle    802cfa <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  802cf6:	01 c6                	add    %eax,%esi
+  802cf8:	eb dc                	jmp    802cd6 <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  802cfa:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  802cfe:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d01:	85 c0                	test   %eax,%eax
+  802d03:	74 a0                	je     802ca5 <fwrite+0x1e>
+  802d05:	89 f0                	mov    %esi,%eax
+  802d07:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d0c:	f7 75 0c             	divl   0xc(%ebp)
+  802d0f:	eb 94                	jmp    802ca5 <fwrite+0x1e>
+			done += r;
+  802d11:	01 c7                	add    %eax,%edi
+			continue;
+  802d13:	eb 34                	jmp    802d49 <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  802d15:	8b 73 10             	mov    0x10(%ebx),%esi
+  802d18:	29 c6                	sub    %eax,%esi
+  802d1a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802d1d:	29 fa                	sub    %edi,%edx
+  802d1f:	39 d6                	cmp    %edx,%esi
+  802d21:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  802d24:	83 ec 04             	sub    $0x4,%esp
+  802d27:	56                   	push   %esi
+  802d28:	89 fa                	mov    %edi,%edx
+  802d2a:	03 55 08             	add    0x8(%ebp),%edx
+  802d2d:	52                   	push   %edx
+  802d2e:	03 43 0c             	add    0xc(%ebx),%eax
+  802d31:	50                   	push   %eax
+  802d32:	e8 83 dd ff ff       	call   800aba <memmove>
+		f->f_wend += m;
+  802d37:	89 f0                	mov    %esi,%eax
+  802d39:	03 43 1c             	add    0x1c(%ebx),%eax
+  802d3c:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  802d3f:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802d41:	83 c4 10             	add    $0x10,%esp
+  802d44:	3b 43 10             	cmp    0x10(%ebx),%eax
+  802d47:	74 5b                	je     802da4 <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  802d49:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802d4c:	39 c7                	cmp    %eax,%edi
+  802d4e:	73 2d                	jae    802d7d <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  802d50:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802d53:	85 c0                	test   %eax,%eax
+  802d55:	75 be                	jne    802d15 <fwrite+0x8e>
+  802d57:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802d5a:	29 fa                	sub    %edi,%edx
+  802d5c:	3b 53 10             	cmp    0x10(%ebx),%edx
+  802d5f:	72 b4                	jb     802d15 <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802d61:	83 ec 04             	sub    $0x4,%esp
+  802d64:	52                   	push   %edx
+  802d65:	89 f8                	mov    %edi,%eax
+  802d67:	03 45 08             	add    0x8(%ebp),%eax
+  802d6a:	50                   	push   %eax
+  802d6b:	ff 33                	push   (%ebx)
+  802d6d:	e8 1d ef ff ff       	call   801c8f <write>
+  802d72:	83 c4 10             	add    $0x10,%esp
+  802d75:	85 c0                	test   %eax,%eax
+  802d77:	7f 98                	jg     802d11 <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  802d79:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  802d7d:	8b 43 08             	mov    0x8(%ebx),%eax
+  802d80:	83 f8 03             	cmp    $0x3,%eax
+  802d83:	74 48                	je     802dcd <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802d85:	83 f8 02             	cmp    $0x2,%eax
+  802d88:	74 27                	je     802db1 <fwrite+0x12a>
+	return size ? done / size : 0;
+  802d8a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d8d:	85 c0                	test   %eax,%eax
+  802d8f:	0f 84 10 ff ff ff    	je     802ca5 <fwrite+0x1e>
+  802d95:	89 f8                	mov    %edi,%eax
+  802d97:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d9c:	f7 75 0c             	divl   0xc(%ebp)
+  802d9f:	e9 01 ff ff ff       	jmp    802ca5 <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802da4:	89 d8                	mov    %ebx,%eax
+  802da6:	e8 ce f9 ff ff       	call   802779 <stream_drain>
+  802dab:	85 c0                	test   %eax,%eax
+  802dad:	79 9a                	jns    802d49 <fwrite+0xc2>
+  802daf:	eb cc                	jmp    802d7d <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802db1:	83 ec 04             	sub    $0x4,%esp
+  802db4:	57                   	push   %edi
+  802db5:	6a 0a                	push   $0xa
+  802db7:	ff 75 08             	push   0x8(%ebp)
+  802dba:	e8 ac dd ff ff       	call   800b6b <memfind>
+  802dbf:	89 c2                	mov    %eax,%edx
+  802dc1:	89 f8                	mov    %edi,%eax
+  802dc3:	03 45 08             	add    0x8(%ebp),%eax
+  802dc6:	83 c4 10             	add    $0x10,%esp
+  802dc9:	39 c2                	cmp    %eax,%edx
+  802dcb:	74 bd                	je     802d8a <fwrite+0x103>
+		stream_drain(f);
+  802dcd:	89 d8                	mov    %ebx,%eax
+  802dcf:	e8 a5 f9 ff ff       	call   802779 <stream_drain>
+  802dd4:	eb b4                	jmp    802d8a <fwrite+0x103>
+
+00802dd6 <fputc>:
+{
+  802dd6:	55                   	push   %ebp
+  802dd7:	89 e5                	mov    %esp,%ebp
+  802dd9:	53                   	push   %ebx
+  802dda:	83 ec 14             	sub    $0x14,%esp
+  802ddd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  802de0:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  802de3:	ff 75 0c             	push   0xc(%ebp)
+  802de6:	6a 01                	push   $0x1
+  802de8:	6a 01                	push   $0x1
+  802dea:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802ded:	50                   	push   %eax
+  802dee:	e8 94 fe ff ff       	call   802c87 <fwrite>
+  802df3:	83 c4 10             	add    $0x10,%esp
+  802df6:	0f b6 db             	movzbl %bl,%ebx
+  802df9:	83 f8 01             	cmp    $0x1,%eax
+  802dfc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802e01:	0f 44 c3             	cmove  %ebx,%eax
+}
+  802e04:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e07:	c9                   	leave
+  802e08:	c3                   	ret
+
+00802e09 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  802e09:	55                   	push   %ebp
+  802e0a:	89 e5                	mov    %esp,%ebp
+  802e0c:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  802e0f:	ff 75 0c             	push   0xc(%ebp)
+  802e12:	ff 75 08             	push   0x8(%ebp)
+  802e15:	e8 bc ff ff ff       	call   802dd6 <fputc>
+}
+  802e1a:	83 c4 10             	add    $0x10,%esp
+  802e1d:	c9                   	leave
+  802e1e:	c3                   	ret
+
+00802e1f <fputs>:
+{
+  802e1f:	55                   	push   %ebp
+  802e20:	89 e5                	mov    %esp,%ebp
+  802e22:	56                   	push   %esi
+  802e23:	53                   	push   %ebx
+  802e24:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  802e27:	83 ec 0c             	sub    $0xc,%esp
+  802e2a:	56                   	push   %esi
+  802e2b:	e8 c9 da ff ff       	call   8008f9 <strlen>
+  802e30:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  802e32:	ff 75 0c             	push   0xc(%ebp)
+  802e35:	50                   	push   %eax
+  802e36:	6a 01                	push   $0x1
+  802e38:	56                   	push   %esi
+  802e39:	e8 49 fe ff ff       	call   802c87 <fwrite>
+  802e3e:	83 c4 20             	add    $0x20,%esp
+  802e41:	39 d8                	cmp    %ebx,%eax
+  802e43:	0f 95 c0             	setne  %al
+  802e46:	0f b6 c0             	movzbl %al,%eax
+  802e49:	f7 d8                	neg    %eax
+}
+  802e4b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e4e:	5b                   	pop    %ebx
+  802e4f:	5e                   	pop    %esi
+  802e50:	5d                   	pop    %ebp
+  802e51:	c3                   	ret
+
+00802e52 <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  802e52:	55                   	push   %ebp
+  802e53:	89 e5                	mov    %esp,%ebp
+  802e55:	53                   	push   %ebx
+  802e56:	83 ec 04             	sub    $0x4,%esp
+  802e59:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802e5c:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  802e5f:	50                   	push   %eax
+  802e60:	ff 75 0c             	push   0xc(%ebp)
+  802e63:	53                   	push   %ebx
+  802e64:	68 09 2e 80 00       	push   $0x802e09
+  802e69:	e8 d9 d5 ff ff       	call   800447 <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  802e6e:	8b 43 04             	mov    0x4(%ebx),%eax
+  802e71:	c1 e0 1c             	shl    $0x1c,%eax
+  802e74:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  802e77:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e7a:	c9                   	leave
+  802e7b:	c3                   	ret
+
+00802e7c <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802e7c:	55                   	push   %ebp
+  802e7d:	89 e5                	mov    %esp,%ebp
+  802e7f:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802e82:	68 68 4f 80 00       	push   $0x804f68
+  802e87:	ff 75 0c             	push   0xc(%ebp)
+  802e8a:	e8 a5 da ff ff       	call   800934 <strcpy>
+	return 0;
+}
+  802e8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e94:	c9                   	leave
+  802e95:	c3                   	ret
+
+00802e96 <devsock_close>:
+{
+  802e96:	55                   	push   %ebp
+  802e97:	89 e5                	mov    %esp,%ebp
+  802e99:	53                   	push   %ebx
+  802e9a:	83 ec 10             	sub    $0x10,%esp
+  802e9d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802ea0:	53                   	push   %ebx
+  802ea1:	e8 11 17 00 00       	call   8045b7 <pageref>
+  802ea6:	89 c2                	mov    %eax,%edx
+  802ea8:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802eab:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802eb0:	83 fa 01             	cmp    $0x1,%edx
+  802eb3:	74 05                	je     802eba <devsock_close+0x24>
+}
+  802eb5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802eb8:	c9                   	leave
+  802eb9:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802eba:	83 ec 0c             	sub    $0xc,%esp
+  802ebd:	ff 73 0c             	push   0xc(%ebx)
+  802ec0:	e8 b7 02 00 00       	call   80317c <nsipc_close>
+  802ec5:	83 c4 10             	add    $0x10,%esp
+  802ec8:	eb eb                	jmp    802eb5 <devsock_close+0x1f>
+
+00802eca <devsock_write>:
+{
+  802eca:	55                   	push   %ebp
+  802ecb:	89 e5                	mov    %esp,%ebp
+  802ecd:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802ed0:	6a 00                	push   $0x0
+  802ed2:	ff 75 10             	push   0x10(%ebp)
+  802ed5:	ff 75 0c             	push   0xc(%ebp)
+  802ed8:	8b 45 08             	mov    0x8(%ebp),%eax
+  802edb:	ff 70 0c             	push   0xc(%eax)
+  802ede:	e8 79 03 00 00       	call   80325c <nsipc_send>
+}
+  802ee3:	c9                   	leave
+  802ee4:	c3                   	ret
+
+00802ee5 <devsock_read>:
+{
+  802ee5:	55                   	push   %ebp
+  802ee6:	89 e5                	mov    %esp,%ebp
+  802ee8:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802eeb:	6a 00                	push   $0x0
+  802eed:	ff 75 10             	push   0x10(%ebp)
+  802ef0:	ff 75 0c             	push   0xc(%ebp)
+  802ef3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ef6:	ff 70 0c             	push   0xc(%eax)
+  802ef9:	e8 ef 02 00 00       	call   8031ed <nsipc_recv>
+}
+  802efe:	c9                   	leave
+  802eff:	c3                   	ret
+
+00802f00 <fd2sockid>:
+{
+  802f00:	55                   	push   %ebp
+  802f01:	89 e5                	mov    %esp,%ebp
+  802f03:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802f06:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802f09:	52                   	push   %edx
+  802f0a:	50                   	push   %eax
+  802f0b:	e8 f7 e9 ff ff       	call   801907 <fd_lookup>
+  802f10:	83 c4 10             	add    $0x10,%esp
+  802f13:	85 c0                	test   %eax,%eax
+  802f15:	78 10                	js     802f27 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802f17:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f1a:	8b 0d 60 62 80 00    	mov    0x806260,%ecx
+  802f20:	39 08                	cmp    %ecx,(%eax)
+  802f22:	75 05                	jne    802f29 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802f24:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802f27:	c9                   	leave
+  802f28:	c3                   	ret
+		return -E_NOT_SUPP;
+  802f29:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802f2e:	eb f7                	jmp    802f27 <fd2sockid+0x27>
+
+00802f30 <alloc_sockfd>:
+{
+  802f30:	55                   	push   %ebp
+  802f31:	89 e5                	mov    %esp,%ebp
+  802f33:	56                   	push   %esi
+  802f34:	53                   	push   %ebx
+  802f35:	83 ec 1c             	sub    $0x1c,%esp
+  802f38:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802f3a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802f3d:	50                   	push   %eax
+  802f3e:	e8 6e e9 ff ff       	call   8018b1 <fd_alloc>
+  802f43:	89 c3                	mov    %eax,%ebx
+  802f45:	83 c4 10             	add    $0x10,%esp
+  802f48:	85 c0                	test   %eax,%eax
+  802f4a:	78 43                	js     802f8f <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802f4c:	83 ec 04             	sub    $0x4,%esp
+  802f4f:	68 07 04 00 00       	push   $0x407
+  802f54:	ff 75 f4             	push   -0xc(%ebp)
+  802f57:	6a 00                	push   $0x0
+  802f59:	e8 14 de ff ff       	call   800d72 <sys_page_alloc>
+  802f5e:	89 c3                	mov    %eax,%ebx
+  802f60:	83 c4 10             	add    $0x10,%esp
+  802f63:	85 c0                	test   %eax,%eax
+  802f65:	78 28                	js     802f8f <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802f67:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f6a:	8b 15 60 62 80 00    	mov    0x806260,%edx
+  802f70:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802f72:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f75:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802f7c:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802f7f:	83 ec 0c             	sub    $0xc,%esp
+  802f82:	50                   	push   %eax
+  802f83:	e8 02 e9 ff ff       	call   80188a <fd2num>
+  802f88:	89 c3                	mov    %eax,%ebx
+  802f8a:	83 c4 10             	add    $0x10,%esp
+  802f8d:	eb 0c                	jmp    802f9b <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802f8f:	83 ec 0c             	sub    $0xc,%esp
+  802f92:	56                   	push   %esi
+  802f93:	e8 e4 01 00 00       	call   80317c <nsipc_close>
+		return r;
+  802f98:	83 c4 10             	add    $0x10,%esp
+}
+  802f9b:	89 d8                	mov    %ebx,%eax
+  802f9d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802fa0:	5b                   	pop    %ebx
+  802fa1:	5e                   	pop    %esi
+  802fa2:	5d                   	pop    %ebp
+  802fa3:	c3                   	ret
+
+00802fa4 <accept>:
+{
+  802fa4:	55                   	push   %ebp
+  802fa5:	89 e5                	mov    %esp,%ebp
+  802fa7:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802faa:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fad:	e8 4e ff ff ff       	call   802f00 <fd2sockid>
+  802fb2:	85 c0                	test   %eax,%eax
+  802fb4:	78 1b                	js     802fd1 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802fb6:	83 ec 04             	sub    $0x4,%esp
+  802fb9:	ff 75 10             	push   0x10(%ebp)
+  802fbc:	ff 75 0c             	push   0xc(%ebp)
+  802fbf:	50                   	push   %eax
+  802fc0:	e8 0e 01 00 00       	call   8030d3 <nsipc_accept>
+  802fc5:	83 c4 10             	add    $0x10,%esp
+  802fc8:	85 c0                	test   %eax,%eax
+  802fca:	78 05                	js     802fd1 <accept+0x2d>
+	return alloc_sockfd(r);
+  802fcc:	e8 5f ff ff ff       	call   802f30 <alloc_sockfd>
+}
+  802fd1:	c9                   	leave
+  802fd2:	c3                   	ret
+
+00802fd3 <bind>:
+{
+  802fd3:	55                   	push   %ebp
+  802fd4:	89 e5                	mov    %esp,%ebp
+  802fd6:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802fd9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fdc:	e8 1f ff ff ff       	call   802f00 <fd2sockid>
+  802fe1:	85 c0                	test   %eax,%eax
+  802fe3:	78 12                	js     802ff7 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802fe5:	83 ec 04             	sub    $0x4,%esp
+  802fe8:	ff 75 10             	push   0x10(%ebp)
+  802feb:	ff 75 0c             	push   0xc(%ebp)
+  802fee:	50                   	push   %eax
+  802fef:	e8 31 01 00 00       	call   803125 <nsipc_bind>
+  802ff4:	83 c4 10             	add    $0x10,%esp
+}
+  802ff7:	c9                   	leave
+  802ff8:	c3                   	ret
+
+00802ff9 <shutdown>:
+{
+  802ff9:	55                   	push   %ebp
+  802ffa:	89 e5                	mov    %esp,%ebp
+  802ffc:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802fff:	8b 45 08             	mov    0x8(%ebp),%eax
+  803002:	e8 f9 fe ff ff       	call   802f00 <fd2sockid>
+  803007:	85 c0                	test   %eax,%eax
+  803009:	78 0f                	js     80301a <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  80300b:	83 ec 08             	sub    $0x8,%esp
+  80300e:	ff 75 0c             	push   0xc(%ebp)
+  803011:	50                   	push   %eax
+  803012:	e8 43 01 00 00       	call   80315a <nsipc_shutdown>
+  803017:	83 c4 10             	add    $0x10,%esp
+}
+  80301a:	c9                   	leave
+  80301b:	c3                   	ret
+
+0080301c <connect>:
+{
+  80301c:	55                   	push   %ebp
+  80301d:	89 e5                	mov    %esp,%ebp
+  80301f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803022:	8b 45 08             	mov    0x8(%ebp),%eax
+  803025:	e8 d6 fe ff ff       	call   802f00 <fd2sockid>
+  80302a:	85 c0                	test   %eax,%eax
+  80302c:	78 12                	js     803040 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  80302e:	83 ec 04             	sub    $0x4,%esp
+  803031:	ff 75 10             	push   0x10(%ebp)
+  803034:	ff 75 0c             	push   0xc(%ebp)
+  803037:	50                   	push   %eax
+  803038:	e8 59 01 00 00       	call   803196 <nsipc_connect>
+  80303d:	83 c4 10             	add    $0x10,%esp
+}
+  803040:	c9                   	leave
+  803041:	c3                   	ret
+
+00803042 <listen>:
+{
+  803042:	55                   	push   %ebp
+  803043:	89 e5                	mov    %esp,%ebp
+  803045:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803048:	8b 45 08             	mov    0x8(%ebp),%eax
+  80304b:	e8 b0 fe ff ff       	call   802f00 <fd2sockid>
+  803050:	85 c0                	test   %eax,%eax
+  803052:	78 0f                	js     803063 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  803054:	83 ec 08             	sub    $0x8,%esp
+  803057:	ff 75 0c             	push   0xc(%ebp)
+  80305a:	50                   	push   %eax
+  80305b:	e8 6b 01 00 00       	call   8031cb <nsipc_listen>
+  803060:	83 c4 10             	add    $0x10,%esp
+}
+  803063:	c9                   	leave
+  803064:	c3                   	ret
+
+00803065 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  803065:	55                   	push   %ebp
+  803066:	89 e5                	mov    %esp,%ebp
+  803068:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80306b:	ff 75 10             	push   0x10(%ebp)
+  80306e:	ff 75 0c             	push   0xc(%ebp)
+  803071:	ff 75 08             	push   0x8(%ebp)
+  803074:	e8 41 02 00 00       	call   8032ba <nsipc_socket>
+  803079:	83 c4 10             	add    $0x10,%esp
+  80307c:	85 c0                	test   %eax,%eax
+  80307e:	78 05                	js     803085 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  803080:	e8 ab fe ff ff       	call   802f30 <alloc_sockfd>
+}
+  803085:	c9                   	leave
+  803086:	c3                   	ret
+
+00803087 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  803087:	55                   	push   %ebp
+  803088:	89 e5                	mov    %esp,%ebp
+  80308a:	53                   	push   %ebx
+  80308b:	83 ec 04             	sub    $0x4,%esp
+  80308e:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  803090:	83 3d 08 70 80 00 00 	cmpl   $0x0,0x807008
+  803097:	74 26                	je     8030bf <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  803099:	6a 07                	push   $0x7
+  80309b:	68 00 90 80 00       	push   $0x809000
+  8030a0:	53                   	push   %ebx
+  8030a1:	ff 35 08 70 80 00    	push   0x807008
+  8030a7:	e8 76 14 00 00       	call   804522 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8030ac:	83 c4 0c             	add    $0xc,%esp
+  8030af:	6a 00                	push   $0x0
+  8030b1:	6a 00                	push   $0x0
+  8030b3:	6a 00                	push   $0x0
+  8030b5:	e8 72 13 00 00       	call   80442c <ipc_recv>
+}
+  8030ba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8030bd:	c9                   	leave
+  8030be:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8030bf:	83 ec 0c             	sub    $0xc,%esp
+  8030c2:	6a 02                	push   $0x2
+  8030c4:	e8 af 14 00 00       	call   804578 <ipc_find_env>
+  8030c9:	a3 08 70 80 00       	mov    %eax,0x807008
+  8030ce:	83 c4 10             	add    $0x10,%esp
+  8030d1:	eb c6                	jmp    803099 <nsipc+0x12>
+
+008030d3 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8030d3:	55                   	push   %ebp
+  8030d4:	89 e5                	mov    %esp,%ebp
+  8030d6:	56                   	push   %esi
+  8030d7:	53                   	push   %ebx
+  8030d8:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8030db:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030de:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  8030e3:	8b 06                	mov    (%esi),%eax
+  8030e5:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8030ea:	b8 01 00 00 00       	mov    $0x1,%eax
+  8030ef:	e8 93 ff ff ff       	call   803087 <nsipc>
+  8030f4:	89 c3                	mov    %eax,%ebx
+  8030f6:	85 c0                	test   %eax,%eax
+  8030f8:	79 09                	jns    803103 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8030fa:	89 d8                	mov    %ebx,%eax
+  8030fc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8030ff:	5b                   	pop    %ebx
+  803100:	5e                   	pop    %esi
+  803101:	5d                   	pop    %ebp
+  803102:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  803103:	83 ec 04             	sub    $0x4,%esp
+  803106:	ff 35 10 90 80 00    	push   0x809010
+  80310c:	68 00 90 80 00       	push   $0x809000
+  803111:	ff 75 0c             	push   0xc(%ebp)
+  803114:	e8 a1 d9 ff ff       	call   800aba <memmove>
+		*addrlen = ret->ret_addrlen;
+  803119:	a1 10 90 80 00       	mov    0x809010,%eax
+  80311e:	89 06                	mov    %eax,(%esi)
+  803120:	83 c4 10             	add    $0x10,%esp
+	return r;
+  803123:	eb d5                	jmp    8030fa <nsipc_accept+0x27>
+
+00803125 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  803125:	55                   	push   %ebp
+  803126:	89 e5                	mov    %esp,%ebp
+  803128:	53                   	push   %ebx
+  803129:	83 ec 08             	sub    $0x8,%esp
+  80312c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  80312f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803132:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  803137:	53                   	push   %ebx
+  803138:	ff 75 0c             	push   0xc(%ebp)
+  80313b:	68 04 90 80 00       	push   $0x809004
+  803140:	e8 75 d9 ff ff       	call   800aba <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  803145:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  80314b:	b8 02 00 00 00       	mov    $0x2,%eax
+  803150:	e8 32 ff ff ff       	call   803087 <nsipc>
+}
+  803155:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803158:	c9                   	leave
+  803159:	c3                   	ret
+
+0080315a <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80315a:	55                   	push   %ebp
+  80315b:	89 e5                	mov    %esp,%ebp
+  80315d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  803160:	8b 45 08             	mov    0x8(%ebp),%eax
+  803163:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  803168:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80316b:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  803170:	b8 03 00 00 00       	mov    $0x3,%eax
+  803175:	e8 0d ff ff ff       	call   803087 <nsipc>
+}
+  80317a:	c9                   	leave
+  80317b:	c3                   	ret
+
+0080317c <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80317c:	55                   	push   %ebp
+  80317d:	89 e5                	mov    %esp,%ebp
+  80317f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  803182:	8b 45 08             	mov    0x8(%ebp),%eax
+  803185:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  80318a:	b8 04 00 00 00       	mov    $0x4,%eax
+  80318f:	e8 f3 fe ff ff       	call   803087 <nsipc>
+}
+  803194:	c9                   	leave
+  803195:	c3                   	ret
+
+00803196 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  803196:	55                   	push   %ebp
+  803197:	89 e5                	mov    %esp,%ebp
+  803199:	53                   	push   %ebx
+  80319a:	83 ec 08             	sub    $0x8,%esp
+  80319d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8031a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031a3:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8031a8:	53                   	push   %ebx
+  8031a9:	ff 75 0c             	push   0xc(%ebp)
+  8031ac:	68 04 90 80 00       	push   $0x809004
+  8031b1:	e8 04 d9 ff ff       	call   800aba <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8031b6:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  8031bc:	b8 05 00 00 00       	mov    $0x5,%eax
+  8031c1:	e8 c1 fe ff ff       	call   803087 <nsipc>
+}
+  8031c6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8031c9:	c9                   	leave
+  8031ca:	c3                   	ret
+
+008031cb <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8031cb:	55                   	push   %ebp
+  8031cc:	89 e5                	mov    %esp,%ebp
+  8031ce:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8031d1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031d4:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  8031d9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8031dc:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  8031e1:	b8 06 00 00 00       	mov    $0x6,%eax
+  8031e6:	e8 9c fe ff ff       	call   803087 <nsipc>
+}
+  8031eb:	c9                   	leave
+  8031ec:	c3                   	ret
+
+008031ed <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8031ed:	55                   	push   %ebp
+  8031ee:	89 e5                	mov    %esp,%ebp
+  8031f0:	56                   	push   %esi
+  8031f1:	53                   	push   %ebx
+  8031f2:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8031f5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031f8:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  8031fd:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  803203:	8b 45 14             	mov    0x14(%ebp),%eax
+  803206:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  80320b:	b8 07 00 00 00       	mov    $0x7,%eax
+  803210:	e8 72 fe ff ff       	call   803087 <nsipc>
+  803215:	89 c3                	mov    %eax,%ebx
+  803217:	85 c0                	test   %eax,%eax
+  803219:	78 22                	js     80323d <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  80321b:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  803220:	39 c6                	cmp    %eax,%esi
+  803222:	0f 4e c6             	cmovle %esi,%eax
+  803225:	39 c3                	cmp    %eax,%ebx
+  803227:	7f 1d                	jg     803246 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  803229:	83 ec 04             	sub    $0x4,%esp
+  80322c:	53                   	push   %ebx
+  80322d:	68 00 90 80 00       	push   $0x809000
+  803232:	ff 75 0c             	push   0xc(%ebp)
+  803235:	e8 80 d8 ff ff       	call   800aba <memmove>
+  80323a:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  80323d:	89 d8                	mov    %ebx,%eax
+  80323f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803242:	5b                   	pop    %ebx
+  803243:	5e                   	pop    %esi
+  803244:	5d                   	pop    %ebp
+  803245:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  803246:	68 74 4f 80 00       	push   $0x804f74
+  80324b:	68 71 4e 80 00       	push   $0x804e71
+  803250:	6a 62                	push   $0x62
+  803252:	68 89 4f 80 00       	push   $0x804f89
+  803257:	e8 19 d0 ff ff       	call   800275 <_panic>
+
+0080325c <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80325c:	55                   	push   %ebp
+  80325d:	89 e5                	mov    %esp,%ebp
+  80325f:	53                   	push   %ebx
+  803260:	83 ec 04             	sub    $0x4,%esp
+  803263:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  803266:	8b 45 08             	mov    0x8(%ebp),%eax
+  803269:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  80326e:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  803274:	7f 2e                	jg     8032a4 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  803276:	83 ec 04             	sub    $0x4,%esp
+  803279:	53                   	push   %ebx
+  80327a:	ff 75 0c             	push   0xc(%ebp)
+  80327d:	68 0c 90 80 00       	push   $0x80900c
+  803282:	e8 33 d8 ff ff       	call   800aba <memmove>
+	nsipcbuf.send.req_size = size;
+  803287:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  80328d:	8b 45 14             	mov    0x14(%ebp),%eax
+  803290:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  803295:	b8 08 00 00 00       	mov    $0x8,%eax
+  80329a:	e8 e8 fd ff ff       	call   803087 <nsipc>
+}
+  80329f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8032a2:	c9                   	leave
+  8032a3:	c3                   	ret
+	assert(size < 1600);
+  8032a4:	68 95 4f 80 00       	push   $0x804f95
+  8032a9:	68 71 4e 80 00       	push   $0x804e71
+  8032ae:	6a 6d                	push   $0x6d
+  8032b0:	68 89 4f 80 00       	push   $0x804f89
+  8032b5:	e8 bb cf ff ff       	call   800275 <_panic>
+
+008032ba <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8032ba:	55                   	push   %ebp
+  8032bb:	89 e5                	mov    %esp,%ebp
+  8032bd:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8032c0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032c3:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  8032c8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8032cb:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  8032d0:	8b 45 10             	mov    0x10(%ebp),%eax
+  8032d3:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  8032d8:	b8 09 00 00 00       	mov    $0x9,%eax
+  8032dd:	e8 a5 fd ff ff       	call   803087 <nsipc>
+}
+  8032e2:	c9                   	leave
+  8032e3:	c3                   	ret
+
+008032e4 <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  8032e4:	55                   	push   %ebp
+  8032e5:	89 e5                	mov    %esp,%ebp
+  8032e7:	53                   	push   %ebx
+  8032e8:	83 ec 10             	sub    $0x10,%esp
+  8032eb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  8032ee:	68 0c 70 80 00       	push   $0x80700c
+  8032f3:	e8 50 07 00 00       	call   803a48 <mutex_lock>
+	if (v == 0)
+  8032f8:	83 c4 10             	add    $0x10,%esp
+  8032fb:	85 db                	test   %ebx,%ebx
+  8032fd:	0f 84 85 00 00 00    	je     803388 <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  803303:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  803309:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  80330e:	77 51                	ja     803361 <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  803310:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  803316:	89 d8                	mov    %ebx,%eax
+  803318:	c1 e8 0c             	shr    $0xc,%eax
+  80331b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803322:	f6 c4 02             	test   $0x2,%ah
+  803325:	74 50                	je     803377 <free+0x93>
+		sys_page_unmap(0, c);
+  803327:	83 ec 08             	sub    $0x8,%esp
+  80332a:	53                   	push   %ebx
+  80332b:	6a 00                	push   $0x0
+  80332d:	e8 d9 da ff ff       	call   800e0b <sys_page_unmap>
+		c += PGSIZE;
+  803332:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  803338:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  80333e:	83 c4 10             	add    $0x10,%esp
+  803341:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  803346:	76 ce                	jbe    803316 <free+0x32>
+  803348:	68 df 4f 80 00       	push   $0x804fdf
+  80334d:	68 71 4e 80 00       	push   $0x804e71
+  803352:	68 82 00 00 00       	push   $0x82
+  803357:	68 d2 4f 80 00       	push   $0x804fd2
+  80335c:	e8 14 cf ff ff       	call   800275 <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  803361:	68 a4 4f 80 00       	push   $0x804fa4
+  803366:	68 71 4e 80 00       	push   $0x804e71
+  80336b:	6a 7b                	push   $0x7b
+  80336d:	68 d2 4f 80 00       	push   $0x804fd2
+  803372:	e8 fe ce ff ff       	call   800275 <_panic>
+	if (--(*ref) == 0)
+  803377:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  80337d:	83 e8 01             	sub    $0x1,%eax
+  803380:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  803386:	74 15                	je     80339d <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  803388:	83 ec 0c             	sub    $0xc,%esp
+  80338b:	68 0c 70 80 00       	push   $0x80700c
+  803390:	e8 20 07 00 00       	call   803ab5 <mutex_unlock>
+}
+  803395:	83 c4 10             	add    $0x10,%esp
+  803398:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80339b:	c9                   	leave
+  80339c:	c3                   	ret
+		sys_page_unmap(0, c);
+  80339d:	83 ec 08             	sub    $0x8,%esp
+  8033a0:	53                   	push   %ebx
+  8033a1:	6a 00                	push   $0x0
+  8033a3:	e8 63 da ff ff       	call   800e0b <sys_page_unmap>
+  8033a8:	83 c4 10             	add    $0x10,%esp
+  8033ab:	eb db                	jmp    803388 <free+0xa4>
+
+008033ad <malloc>:
+{
+  8033ad:	55                   	push   %ebp
+  8033ae:	89 e5                	mov    %esp,%ebp
+  8033b0:	57                   	push   %edi
+  8033b1:	56                   	push   %esi
+  8033b2:	53                   	push   %ebx
+  8033b3:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  8033b6:	68 0c 70 80 00       	push   $0x80700c
+  8033bb:	e8 88 06 00 00       	call   803a48 <mutex_lock>
+	if (mptr == 0)
+  8033c0:	8b 3d 10 70 80 00    	mov    0x807010,%edi
+  8033c6:	83 c4 10             	add    $0x10,%esp
+  8033c9:	85 ff                	test   %edi,%edi
+  8033cb:	74 6c                	je     803439 <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  8033cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033d0:	83 c0 03             	add    $0x3,%eax
+  8033d3:	83 e0 fc             	and    $0xfffffffc,%eax
+  8033d6:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  8033d8:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  8033dd:	0f 87 64 01 00 00    	ja     803547 <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  8033e3:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8033e9:	74 30                	je     80341b <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  8033eb:	89 f9                	mov    %edi,%ecx
+  8033ed:	c1 e9 0c             	shr    $0xc,%ecx
+  8033f0:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  8033f4:	c1 e8 0c             	shr    $0xc,%eax
+  8033f7:	39 c1                	cmp    %eax,%ecx
+  8033f9:	74 5f                	je     80345a <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  8033fb:	83 ec 0c             	sub    $0xc,%esp
+  8033fe:	57                   	push   %edi
+  8033ff:	e8 e0 fe ff ff       	call   8032e4 <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  803404:	a1 10 70 80 00       	mov    0x807010,%eax
+  803409:	05 00 10 00 00       	add    $0x1000,%eax
+  80340e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803413:	a3 10 70 80 00       	mov    %eax,0x807010
+  803418:	83 c4 10             	add    $0x10,%esp
+  80341b:	8b 0d 10 70 80 00    	mov    0x807010,%ecx
+{
+  803421:	ba 02 00 00 00       	mov    $0x2,%edx
+  803426:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  80342a:	8d 7e 04             	lea    0x4(%esi),%edi
+  80342d:	89 cb                	mov    %ecx,%ebx
+  80342f:	01 f9                	add    %edi,%ecx
+  803431:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  803434:	e9 8b 00 00 00       	jmp    8034c4 <malloc+0x117>
+		mptr = mbegin;
+  803439:	c7 05 10 70 80 00 00 	movl   $0x8000000,0x807010
+  803440:	00 00 08 
+	n = ROUNDUP(n, 4);
+  803443:	8b 45 08             	mov    0x8(%ebp),%eax
+  803446:	83 c0 03             	add    $0x3,%eax
+  803449:	83 e0 fc             	and    $0xfffffffc,%eax
+  80344c:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  80344e:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  803453:	76 c6                	jbe    80341b <malloc+0x6e>
+  803455:	e9 d6 00 00 00       	jmp    803530 <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  80345a:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  803460:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  803465:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  803469:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  80346c:	a3 10 70 80 00       	mov    %eax,0x807010
+			return v;
+  803471:	e9 ba 00 00 00       	jmp    803530 <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  803476:	05 00 10 00 00       	add    $0x1000,%eax
+  80347b:	39 c8                	cmp    %ecx,%eax
+  80347d:	0f 83 cb 00 00 00    	jae    80354e <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  803483:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  803488:	77 22                	ja     8034ac <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  80348a:	89 c2                	mov    %eax,%edx
+  80348c:	c1 ea 16             	shr    $0x16,%edx
+  80348f:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  803496:	f6 c2 01             	test   $0x1,%dl
+  803499:	74 db                	je     803476 <malloc+0xc9>
+  80349b:	89 c2                	mov    %eax,%edx
+  80349d:	c1 ea 0c             	shr    $0xc,%edx
+  8034a0:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8034a7:	f6 c2 01             	test   $0x1,%dl
+  8034aa:	74 ca                	je     803476 <malloc+0xc9>
+		if (mptr == mend) {
+  8034ac:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8034b2:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  8034b8:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  8034bc:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  8034c2:	74 04                	je     8034c8 <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  8034c4:	89 d8                	mov    %ebx,%eax
+  8034c6:	eb b3                	jmp    80347b <malloc+0xce>
+  8034c8:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  8034cb:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  8034d0:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  8034d4:	83 ea 01             	sub    $0x1,%edx
+  8034d7:	0f 85 50 ff ff ff    	jne    80342d <malloc+0x80>
+  8034dd:	c7 05 10 70 80 00 00 	movl   $0x8000000,0x807010
+  8034e4:	00 00 08 
+				return 0;	/* out of address space */
+  8034e7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034ec:	eb 42                	jmp    803530 <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  8034ee:	85 db                	test   %ebx,%ebx
+  8034f0:	78 1e                	js     803510 <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  8034f2:	83 ec 08             	sub    $0x8,%esp
+  8034f5:	89 d8                	mov    %ebx,%eax
+  8034f7:	03 05 10 70 80 00    	add    0x807010,%eax
+  8034fd:	50                   	push   %eax
+  8034fe:	6a 00                	push   $0x0
+  803500:	e8 06 d9 ff ff       	call   800e0b <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  803505:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  80350b:	83 c4 10             	add    $0x10,%esp
+  80350e:	eb de                	jmp    8034ee <malloc+0x141>
+			return 0;	/* out of physical memory */
+  803510:	bf 00 00 00 00       	mov    $0x0,%edi
+  803515:	eb 19                	jmp    803530 <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  803517:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80351a:	8b 3d 10 70 80 00    	mov    0x807010,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  803520:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  803527:	00 
+	mptr += n;
+  803528:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  80352b:	a3 10 70 80 00       	mov    %eax,0x807010
+	mutex_unlock(&malloc_mu);
+  803530:	83 ec 0c             	sub    $0xc,%esp
+  803533:	68 0c 70 80 00       	push   $0x80700c
+  803538:	e8 78 05 00 00       	call   803ab5 <mutex_unlock>
+}
+  80353d:	89 f8                	mov    %edi,%eax
+  80353f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803542:	5b                   	pop    %ebx
+  803543:	5e                   	pop    %esi
+  803544:	5f                   	pop    %edi
+  803545:	5d                   	pop    %ebp
+  803546:	c3                   	ret
+		return 0;
+  803547:	bf 00 00 00 00       	mov    $0x0,%edi
+  80354c:	eb e2                	jmp    803530 <malloc+0x183>
+  80354e:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  803552:	74 06                	je     80355a <malloc+0x1ad>
+  803554:	89 1d 10 70 80 00    	mov    %ebx,0x807010
+	for (i = 0; i < n + 4; i += PGSIZE){
+  80355a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80355f:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803562:	39 fb                	cmp    %edi,%ebx
+  803564:	73 b1                	jae    803517 <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  803566:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  80356c:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  80356f:	39 fe                	cmp    %edi,%esi
+  803571:	0f 92 c0             	setb   %al
+  803574:	0f b6 c0             	movzbl %al,%eax
+  803577:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  80357a:	83 c8 07             	or     $0x7,%eax
+  80357d:	50                   	push   %eax
+  80357e:	89 d8                	mov    %ebx,%eax
+  803580:	03 05 10 70 80 00    	add    0x807010,%eax
+  803586:	50                   	push   %eax
+  803587:	6a 00                	push   $0x0
+  803589:	e8 e4 d7 ff ff       	call   800d72 <sys_page_alloc>
+  80358e:	83 c4 10             	add    $0x10,%esp
+  803591:	85 c0                	test   %eax,%eax
+  803593:	0f 88 55 ff ff ff    	js     8034ee <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  803599:	89 f3                	mov    %esi,%ebx
+  80359b:	eb c5                	jmp    803562 <malloc+0x1b5>
+
+0080359d <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80359d:	55                   	push   %ebp
+  80359e:	89 e5                	mov    %esp,%ebp
+  8035a0:	56                   	push   %esi
+  8035a1:	53                   	push   %ebx
+  8035a2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8035a5:	83 ec 0c             	sub    $0xc,%esp
+  8035a8:	ff 75 08             	push   0x8(%ebp)
+  8035ab:	e8 ea e2 ff ff       	call   80189a <fd2data>
+  8035b0:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8035b2:	83 c4 08             	add    $0x8,%esp
+  8035b5:	68 f7 4f 80 00       	push   $0x804ff7
+  8035ba:	53                   	push   %ebx
+  8035bb:	e8 74 d3 ff ff       	call   800934 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8035c0:	8b 46 04             	mov    0x4(%esi),%eax
+  8035c3:	2b 06                	sub    (%esi),%eax
+  8035c5:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8035cb:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8035d2:	00 00 00 
+	stat->st_dev = &devpipe;
+  8035d5:	c7 83 88 00 00 00 7c 	movl   $0x80627c,0x88(%ebx)
+  8035dc:	62 80 00 
+	return 0;
+}
+  8035df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8035e7:	5b                   	pop    %ebx
+  8035e8:	5e                   	pop    %esi
+  8035e9:	5d                   	pop    %ebp
+  8035ea:	c3                   	ret
+
+008035eb <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  8035eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8035f0:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  8035f4:	85 c9                	test   %ecx,%ecx
+  8035f6:	75 01                	jne    8035f9 <pipewake+0xe>
+  8035f8:	c3                   	ret
+{
+  8035f9:	55                   	push   %ebp
+  8035fa:	89 e5                	mov    %esp,%ebp
+  8035fc:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  8035ff:	68 00 04 00 00       	push   $0x400
+  803604:	52                   	push   %edx
+  803605:	e8 ac da ff ff       	call   8010b6 <sys_futex_wake>
+  80360a:	83 c4 10             	add    $0x10,%esp
+}
+  80360d:	c9                   	leave
+  80360e:	c3                   	ret
+
+0080360f <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80360f:	55                   	push   %ebp
+  803610:	89 e5                	mov    %esp,%ebp
+  803612:	56                   	push   %esi
+  803613:	53                   	push   %ebx
+  803614:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803617:	83 ec 0c             	sub    $0xc,%esp
+  80361a:	56                   	push   %esi
+  80361b:	e8 7a e2 ff ff       	call   80189a <fd2data>
+  803620:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  803622:	83 c4 08             	add    $0x8,%esp
+  803625:	56                   	push   %esi
+  803626:	6a 00                	push   $0x0
+  803628:	e8 de d7 ff ff       	call   800e0b <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  80362d:	8d 53 04             	lea    0x4(%ebx),%edx
+  803630:	8d 43 08             	lea    0x8(%ebx),%eax
+  803633:	e8 b3 ff ff ff       	call   8035eb <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  803638:	8d 43 0c             	lea    0xc(%ebx),%eax
+  80363b:	89 da                	mov    %ebx,%edx
+  80363d:	e8 a9 ff ff ff       	call   8035eb <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  803642:	89 34 24             	mov    %esi,(%esp)
+  803645:	e8 50 e2 ff ff       	call   80189a <fd2data>
+  80364a:	83 c4 08             	add    $0x8,%esp
+  80364d:	50                   	push   %eax
+  80364e:	6a 00                	push   $0x0
+  803650:	e8 b6 d7 ff ff       	call   800e0b <sys_page_unmap>
+}
+  803655:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803658:	5b                   	pop    %ebx
+  803659:	5e                   	pop    %esi
+  80365a:	5d                   	pop    %ebp
+  80365b:	c3                   	ret
+
+0080365c <_pipeisclosed>:
+{
+  80365c:	55                   	push   %ebp
+  80365d:	89 e5                	mov    %esp,%ebp
+  80365f:	57                   	push   %edi
+  803660:	56                   	push   %esi
+  803661:	53                   	push   %ebx
+  803662:	83 ec 1c             	sub    $0x1c,%esp
+  803665:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803668:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80366a:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  80366f:	eb 5d                	jmp    8036ce <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  803671:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		n = thisenv->env_runs;
+  803677:	8b 02                	mov    (%edx),%eax
+  803679:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  80367c:	83 ec 0c             	sub    $0xc,%esp
+  80367f:	ff 75 e0             	push   -0x20(%ebp)
+  803682:	e8 30 0f 00 00       	call   8045b7 <pageref>
+  803687:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80368a:	89 3c 24             	mov    %edi,(%esp)
+  80368d:	e8 25 0f 00 00       	call   8045b7 <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  803692:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803694:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  80369a:	83 c4 10             	add    $0x10,%esp
+  80369d:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8036a3:	77 15                	ja     8036ba <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8036a5:	89 f2                	mov    %esi,%edx
+  8036a7:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  8036a9:	c1 ea 10             	shr    $0x10,%edx
+  8036ac:	74 0c                	je     8036ba <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8036ae:	c1 e2 10             	shl    $0x10,%edx
+  8036b1:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8036b6:	29 d1                	sub    %edx,%ecx
+  8036b8:	eb 06                	jmp    8036c0 <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  8036ba:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		nn = thisenv->env_runs;
+  8036c0:	8b 11                	mov    (%ecx),%edx
+  8036c2:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  8036c5:	39 d3                	cmp    %edx,%ebx
+  8036c7:	74 6e                	je     803737 <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  8036c9:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8036cc:	74 24                	je     8036f2 <_pipeisclosed+0x96>
+  8036ce:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8036d0:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8036d6:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8036db:	77 94                	ja     803671 <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8036dd:	89 f0                	mov    %esi,%eax
+  8036df:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8036e1:	c1 e8 10             	shr    $0x10,%eax
+  8036e4:	74 8b                	je     803671 <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8036e6:	c1 e0 10             	shl    $0x10,%eax
+  8036e9:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8036ee:	29 c2                	sub    %eax,%edx
+  8036f0:	eb 85                	jmp    803677 <_pipeisclosed+0x1b>
+  8036f2:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8036f4:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8036fa:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8036ff:	77 18                	ja     803719 <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803701:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803706:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803708:	c1 e8 10             	shr    $0x10,%eax
+  80370b:	74 0c                	je     803719 <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80370d:	c1 e0 10             	shl    $0x10,%eax
+  803710:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803715:	29 c2                	sub    %eax,%edx
+  803717:	eb 06                	jmp    80371f <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  803719:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80371f:	8b 02                	mov    (%edx),%eax
+  803721:	8b 40 58             	mov    0x58(%eax),%eax
+  803724:	6a 01                	push   $0x1
+  803726:	50                   	push   %eax
+  803727:	53                   	push   %ebx
+  803728:	68 fe 4f 80 00       	push   $0x804ffe
+  80372d:	e8 1e cc ff ff       	call   800350 <cprintf>
+  803732:	83 c4 10             	add    $0x10,%esp
+  803735:	eb 97                	jmp    8036ce <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  803737:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80373a:	0f 94 c0             	sete   %al
+  80373d:	0f b6 c0             	movzbl %al,%eax
+}
+  803740:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803743:	5b                   	pop    %ebx
+  803744:	5e                   	pop    %esi
+  803745:	5f                   	pop    %edi
+  803746:	5d                   	pop    %ebp
+  803747:	c3                   	ret
+
+00803748 <devpipe_write>:
+{
+  803748:	55                   	push   %ebp
+  803749:	89 e5                	mov    %esp,%ebp
+  80374b:	57                   	push   %edi
+  80374c:	56                   	push   %esi
+  80374d:	53                   	push   %ebx
+  80374e:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  803751:	ff 75 08             	push   0x8(%ebp)
+  803754:	e8 41 e1 ff ff       	call   80189a <fd2data>
+  803759:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80375b:	83 c4 10             	add    $0x10,%esp
+  80375e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  803765:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  803768:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80376b:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80376e:	0f 84 96 00 00 00    	je     80380a <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  803774:	8d 73 08             	lea    0x8(%ebx),%esi
+  803777:	eb 32                	jmp    8037ab <devpipe_write+0x63>
+  803779:	89 fa                	mov    %edi,%edx
+  80377b:	89 f0                	mov    %esi,%eax
+  80377d:	e8 69 fe ff ff       	call   8035eb <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  803782:	8b 43 04             	mov    0x4(%ebx),%eax
+  803785:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  803788:	ba 01 00 00 00       	mov    $0x1,%edx
+  80378d:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  803792:	83 ec 04             	sub    $0x4,%esp
+  803795:	6a 0a                	push   $0xa
+  803797:	50                   	push   %eax
+  803798:	53                   	push   %ebx
+  803799:	e8 e9 d8 ff ff       	call   801087 <sys_futex_wait>
+  80379e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8037a3:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  8037a8:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8037ab:	8b 43 04             	mov    0x4(%ebx),%eax
+  8037ae:	8b 0b                	mov    (%ebx),%ecx
+  8037b0:	8d 51 20             	lea    0x20(%ecx),%edx
+  8037b3:	39 d0                	cmp    %edx,%eax
+  8037b5:	72 1b                	jb     8037d2 <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  8037b7:	89 da                	mov    %ebx,%edx
+  8037b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037bc:	e8 9b fe ff ff       	call   80365c <_pipeisclosed>
+  8037c1:	85 c0                	test   %eax,%eax
+  8037c3:	74 b4                	je     803779 <devpipe_write+0x31>
+				return 0;
+  8037c5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8037ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8037cd:	5b                   	pop    %ebx
+  8037ce:	5e                   	pop    %esi
+  8037cf:	5f                   	pop    %edi
+  8037d0:	5d                   	pop    %ebp
+  8037d1:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8037d2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8037d5:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8037d8:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  8037dc:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  8037df:	89 c2                	mov    %eax,%edx
+  8037e1:	c1 fa 1f             	sar    $0x1f,%edx
+  8037e4:	89 d1                	mov    %edx,%ecx
+  8037e6:	c1 e9 1b             	shr    $0x1b,%ecx
+  8037e9:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8037ec:	83 e2 1f             	and    $0x1f,%edx
+  8037ef:	29 ca                	sub    %ecx,%edx
+  8037f1:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  8037f5:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  8037f9:	83 c0 01             	add    $0x1,%eax
+  8037fc:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8037ff:	83 c6 01             	add    $0x1,%esi
+  803802:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803805:	e9 5e ff ff ff       	jmp    803768 <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  80380a:	8d 53 04             	lea    0x4(%ebx),%edx
+  80380d:	8d 43 08             	lea    0x8(%ebx),%eax
+  803810:	e8 d6 fd ff ff       	call   8035eb <pipewake>
+	return i;
+  803815:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803818:	eb b0                	jmp    8037ca <devpipe_write+0x82>
+
+0080381a <devpipe_read>:
+{
+  80381a:	55                   	push   %ebp
+  80381b:	89 e5                	mov    %esp,%ebp
+  80381d:	57                   	push   %edi
+  80381e:	56                   	push   %esi
+  80381f:	53                   	push   %ebx
+  803820:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  803823:	ff 75 08             	push   0x8(%ebp)
+  803826:	e8 6f e0 ff ff       	call   80189a <fd2data>
+  80382b:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80382d:	83 c4 10             	add    $0x10,%esp
+  803830:	be 00 00 00 00       	mov    $0x0,%esi
+  803835:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803838:	74 6c                	je     8038a6 <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  80383a:	8d 7b 04             	lea    0x4(%ebx),%edi
+  80383d:	eb 25                	jmp    803864 <devpipe_read+0x4a>
+  80383f:	8b 13                	mov    (%ebx),%edx
+  803841:	b8 01 00 00 00       	mov    $0x1,%eax
+  803846:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  80384b:	83 ec 04             	sub    $0x4,%esp
+  80384e:	6a 0a                	push   $0xa
+  803850:	52                   	push   %edx
+  803851:	57                   	push   %edi
+  803852:	e8 30 d8 ff ff       	call   801087 <sys_futex_wait>
+  803857:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80385c:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  803861:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  803864:	8b 03                	mov    (%ebx),%eax
+  803866:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803869:	75 19                	jne    803884 <devpipe_read+0x6a>
+			if (i > 0)
+  80386b:	85 f6                	test   %esi,%esi
+  80386d:	75 3a                	jne    8038a9 <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  80386f:	89 da                	mov    %ebx,%edx
+  803871:	8b 45 08             	mov    0x8(%ebp),%eax
+  803874:	e8 e3 fd ff ff       	call   80365c <_pipeisclosed>
+  803879:	85 c0                	test   %eax,%eax
+  80387b:	74 c2                	je     80383f <devpipe_read+0x25>
+				return 0;
+  80387d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803882:	eb 31                	jmp    8038b5 <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803884:	89 c1                	mov    %eax,%ecx
+  803886:	c1 f9 1f             	sar    $0x1f,%ecx
+  803889:	c1 e9 1b             	shr    $0x1b,%ecx
+  80388c:	01 c8                	add    %ecx,%eax
+  80388e:	83 e0 1f             	and    $0x1f,%eax
+  803891:	29 c8                	sub    %ecx,%eax
+  803893:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  803898:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80389b:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80389e:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8038a1:	83 c6 01             	add    $0x1,%esi
+  8038a4:	eb 8f                	jmp    803835 <devpipe_read+0x1b>
+out:
+  8038a6:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  8038a9:	8d 43 0c             	lea    0xc(%ebx),%eax
+  8038ac:	89 da                	mov    %ebx,%edx
+  8038ae:	e8 38 fd ff ff       	call   8035eb <pipewake>
+	return i;
+  8038b3:	89 f0                	mov    %esi,%eax
+}
+  8038b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8038b8:	5b                   	pop    %ebx
+  8038b9:	5e                   	pop    %esi
+  8038ba:	5f                   	pop    %edi
+  8038bb:	5d                   	pop    %ebp
+  8038bc:	c3                   	ret
+
+008038bd <pipe>:
+{
+  8038bd:	55                   	push   %ebp
+  8038be:	89 e5                	mov    %esp,%ebp
+  8038c0:	56                   	push   %esi
+  8038c1:	53                   	push   %ebx
+  8038c2:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8038c5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8038c8:	50                   	push   %eax
+  8038c9:	e8 e3 df ff ff       	call   8018b1 <fd_alloc>
+  8038ce:	89 c3                	mov    %eax,%ebx
+  8038d0:	83 c4 10             	add    $0x10,%esp
+  8038d3:	85 c0                	test   %eax,%eax
+  8038d5:	0f 88 23 01 00 00    	js     8039fe <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8038db:	83 ec 04             	sub    $0x4,%esp
+  8038de:	68 07 04 00 00       	push   $0x407
+  8038e3:	ff 75 f4             	push   -0xc(%ebp)
+  8038e6:	6a 00                	push   $0x0
+  8038e8:	e8 85 d4 ff ff       	call   800d72 <sys_page_alloc>
+  8038ed:	89 c3                	mov    %eax,%ebx
+  8038ef:	83 c4 10             	add    $0x10,%esp
+  8038f2:	85 c0                	test   %eax,%eax
+  8038f4:	0f 88 04 01 00 00    	js     8039fe <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8038fa:	83 ec 0c             	sub    $0xc,%esp
+  8038fd:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803900:	50                   	push   %eax
+  803901:	e8 ab df ff ff       	call   8018b1 <fd_alloc>
+  803906:	89 c3                	mov    %eax,%ebx
+  803908:	83 c4 10             	add    $0x10,%esp
+  80390b:	85 c0                	test   %eax,%eax
+  80390d:	0f 88 db 00 00 00    	js     8039ee <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803913:	83 ec 04             	sub    $0x4,%esp
+  803916:	68 07 04 00 00       	push   $0x407
+  80391b:	ff 75 f0             	push   -0x10(%ebp)
+  80391e:	6a 00                	push   $0x0
+  803920:	e8 4d d4 ff ff       	call   800d72 <sys_page_alloc>
+  803925:	89 c3                	mov    %eax,%ebx
+  803927:	83 c4 10             	add    $0x10,%esp
+  80392a:	85 c0                	test   %eax,%eax
+  80392c:	0f 88 bc 00 00 00    	js     8039ee <pipe+0x131>
+	va = fd2data(fd0);
+  803932:	83 ec 0c             	sub    $0xc,%esp
+  803935:	ff 75 f4             	push   -0xc(%ebp)
+  803938:	e8 5d df ff ff       	call   80189a <fd2data>
+  80393d:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80393f:	83 c4 0c             	add    $0xc,%esp
+  803942:	68 07 04 00 00       	push   $0x407
+  803947:	50                   	push   %eax
+  803948:	6a 00                	push   $0x0
+  80394a:	e8 23 d4 ff ff       	call   800d72 <sys_page_alloc>
+  80394f:	89 c3                	mov    %eax,%ebx
+  803951:	83 c4 10             	add    $0x10,%esp
+  803954:	85 c0                	test   %eax,%eax
+  803956:	0f 88 82 00 00 00    	js     8039de <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80395c:	83 ec 0c             	sub    $0xc,%esp
+  80395f:	ff 75 f0             	push   -0x10(%ebp)
+  803962:	e8 33 df ff ff       	call   80189a <fd2data>
+  803967:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80396e:	50                   	push   %eax
+  80396f:	6a 00                	push   $0x0
+  803971:	56                   	push   %esi
+  803972:	6a 00                	push   $0x0
+  803974:	e8 46 d4 ff ff       	call   800dbf <sys_page_map>
+  803979:	89 c3                	mov    %eax,%ebx
+  80397b:	83 c4 20             	add    $0x20,%esp
+  80397e:	85 c0                	test   %eax,%eax
+  803980:	78 4e                	js     8039d0 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803982:	a1 7c 62 80 00       	mov    0x80627c,%eax
+  803987:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80398a:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80398c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80398f:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803996:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803999:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80399b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80399e:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8039a5:	83 ec 0c             	sub    $0xc,%esp
+  8039a8:	ff 75 f4             	push   -0xc(%ebp)
+  8039ab:	e8 da de ff ff       	call   80188a <fd2num>
+  8039b0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8039b3:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8039b5:	83 c4 04             	add    $0x4,%esp
+  8039b8:	ff 75 f0             	push   -0x10(%ebp)
+  8039bb:	e8 ca de ff ff       	call   80188a <fd2num>
+  8039c0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8039c3:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8039c6:	83 c4 10             	add    $0x10,%esp
+  8039c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8039ce:	eb 2e                	jmp    8039fe <pipe+0x141>
+	sys_page_unmap(0, va);
+  8039d0:	83 ec 08             	sub    $0x8,%esp
+  8039d3:	56                   	push   %esi
+  8039d4:	6a 00                	push   $0x0
+  8039d6:	e8 30 d4 ff ff       	call   800e0b <sys_page_unmap>
+  8039db:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8039de:	83 ec 08             	sub    $0x8,%esp
+  8039e1:	ff 75 f0             	push   -0x10(%ebp)
+  8039e4:	6a 00                	push   $0x0
+  8039e6:	e8 20 d4 ff ff       	call   800e0b <sys_page_unmap>
+  8039eb:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8039ee:	83 ec 08             	sub    $0x8,%esp
+  8039f1:	ff 75 f4             	push   -0xc(%ebp)
+  8039f4:	6a 00                	push   $0x0
+  8039f6:	e8 10 d4 ff ff       	call   800e0b <sys_page_unmap>
+  8039fb:	83 c4 10             	add    $0x10,%esp
+}
+  8039fe:	89 d8                	mov    %ebx,%eax
+  803a00:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803a03:	5b                   	pop    %ebx
+  803a04:	5e                   	pop    %esi
+  803a05:	5d                   	pop    %ebp
+  803a06:	c3                   	ret
+
+00803a07 <pipeisclosed>:
+{
+  803a07:	55                   	push   %ebp
+  803a08:	89 e5                	mov    %esp,%ebp
+  803a0a:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803a0d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803a10:	50                   	push   %eax
+  803a11:	ff 75 08             	push   0x8(%ebp)
+  803a14:	e8 ee de ff ff       	call   801907 <fd_lookup>
+  803a19:	83 c4 10             	add    $0x10,%esp
+  803a1c:	85 c0                	test   %eax,%eax
+  803a1e:	78 18                	js     803a38 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803a20:	83 ec 0c             	sub    $0xc,%esp
+  803a23:	ff 75 f4             	push   -0xc(%ebp)
+  803a26:	e8 6f de ff ff       	call   80189a <fd2data>
+  803a2b:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803a2d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803a30:	e8 27 fc ff ff       	call   80365c <_pipeisclosed>
+  803a35:	83 c4 10             	add    $0x10,%esp
+}
+  803a38:	c9                   	leave
+  803a39:	c3                   	ret
+
+00803a3a <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  803a3a:	55                   	push   %ebp
+  803a3b:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  803a3d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a40:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803a46:	5d                   	pop    %ebp
+  803a47:	c3                   	ret
+
+00803a48 <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  803a48:	55                   	push   %ebp
+  803a49:	89 e5                	mov    %esp,%ebp
+  803a4b:	56                   	push   %esi
+  803a4c:	53                   	push   %ebx
+  803a4d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803a50:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a55:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803a5a:	89 d0                	mov    %edx,%eax
+  803a5c:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  803a60:	85 c0                	test   %eax,%eax
+  803a62:	74 2d                	je     803a91 <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  803a64:	83 f8 02             	cmp    $0x2,%eax
+  803a67:	74 08                	je     803a71 <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  803a69:	b8 02 00 00 00       	mov    $0x2,%eax
+  803a6e:	f0 87 03             	lock xchg %eax,(%ebx)
+  803a71:	be 02 00 00 00       	mov    $0x2,%esi
+  803a76:	eb 15                	jmp    803a8d <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  803a78:	83 ec 04             	sub    $0x4,%esp
+  803a7b:	6a 00                	push   $0x0
+  803a7d:	6a 02                	push   $0x2
+  803a7f:	53                   	push   %ebx
+  803a80:	e8 02 d6 ff ff       	call   801087 <sys_futex_wait>
+  803a85:	89 f0                	mov    %esi,%eax
+  803a87:	f0 87 03             	lock xchg %eax,(%ebx)
+  803a8a:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  803a8d:	85 c0                	test   %eax,%eax
+  803a8f:	75 e7                	jne    803a78 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  803a91:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803a94:	5b                   	pop    %ebx
+  803a95:	5e                   	pop    %esi
+  803a96:	5d                   	pop    %ebp
+  803a97:	c3                   	ret
+
+00803a98 <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  803a98:	55                   	push   %ebp
+  803a99:	89 e5                	mov    %esp,%ebp
+  803a9b:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803a9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803aa3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803aa8:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  803aac:	f7 d8                	neg    %eax
+  803aae:	19 c0                	sbb    %eax,%eax
+  803ab0:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  803ab3:	5d                   	pop    %ebp
+  803ab4:	c3                   	ret
+
+00803ab5 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  803ab5:	55                   	push   %ebp
+  803ab6:	89 e5                	mov    %esp,%ebp
+  803ab8:	83 ec 08             	sub    $0x8,%esp
+  803abb:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  803abe:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ac3:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  803ac6:	83 f8 02             	cmp    $0x2,%eax
+  803ac9:	74 02                	je     803acd <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  803acb:	c9                   	leave
+  803acc:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  803acd:	83 ec 08             	sub    $0x8,%esp
+  803ad0:	6a 01                	push   $0x1
+  803ad2:	52                   	push   %edx
+  803ad3:	e8 de d5 ff ff       	call   8010b6 <sys_futex_wake>
+  803ad8:	83 c4 10             	add    $0x10,%esp
+}
+  803adb:	eb ee                	jmp    803acb <mutex_unlock+0x16>
+
+00803add <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  803add:	55                   	push   %ebp
+  803ade:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  803ae0:	8b 45 08             	mov    0x8(%ebp),%eax
+  803ae3:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803ae9:	5d                   	pop    %ebp
+  803aea:	c3                   	ret
+
+00803aeb <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  803aeb:	55                   	push   %ebp
+  803aec:	89 e5                	mov    %esp,%ebp
+  803aee:	57                   	push   %edi
+  803aef:	56                   	push   %esi
+  803af0:	53                   	push   %ebx
+  803af1:	83 ec 18             	sub    $0x18,%esp
+  803af4:	8b 75 08             	mov    0x8(%ebp),%esi
+  803af7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  803afa:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  803afc:	53                   	push   %ebx
+  803afd:	e8 b3 ff ff ff       	call   803ab5 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  803b02:	83 c4 0c             	add    $0xc,%esp
+  803b05:	ff 75 10             	push   0x10(%ebp)
+  803b08:	57                   	push   %edi
+  803b09:	56                   	push   %esi
+  803b0a:	e8 78 d5 ff ff       	call   801087 <sys_futex_wait>
+  803b0f:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  803b11:	83 c4 10             	add    $0x10,%esp
+  803b14:	be 02 00 00 00       	mov    $0x2,%esi
+  803b19:	eb 10                	jmp    803b2b <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  803b1b:	83 ec 04             	sub    $0x4,%esp
+  803b1e:	6a 00                	push   $0x0
+  803b20:	6a 02                	push   $0x2
+  803b22:	53                   	push   %ebx
+  803b23:	e8 5f d5 ff ff       	call   801087 <sys_futex_wait>
+  803b28:	83 c4 10             	add    $0x10,%esp
+  803b2b:	89 f0                	mov    %esi,%eax
+  803b2d:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  803b30:	85 c0                	test   %eax,%eax
+  803b32:	75 e7                	jne    803b1b <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  803b34:	83 ff ec             	cmp    $0xffffffec,%edi
+  803b37:	74 05                	je     803b3e <cond_timedwait+0x53>
+  803b39:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803b3e:	89 f8                	mov    %edi,%eax
+  803b40:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803b43:	5b                   	pop    %ebx
+  803b44:	5e                   	pop    %esi
+  803b45:	5f                   	pop    %edi
+  803b46:	5d                   	pop    %ebp
+  803b47:	c3                   	ret
+
+00803b48 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  803b48:	55                   	push   %ebp
+  803b49:	89 e5                	mov    %esp,%ebp
+  803b4b:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  803b4e:	6a 00                	push   $0x0
+  803b50:	ff 75 0c             	push   0xc(%ebp)
+  803b53:	ff 75 08             	push   0x8(%ebp)
+  803b56:	e8 90 ff ff ff       	call   803aeb <cond_timedwait>
+}
+  803b5b:	83 c4 10             	add    $0x10,%esp
+  803b5e:	c9                   	leave
+  803b5f:	c3                   	ret
+
+00803b60 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  803b60:	55                   	push   %ebp
+  803b61:	89 e5                	mov    %esp,%ebp
+  803b63:	83 ec 10             	sub    $0x10,%esp
+  803b66:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  803b69:	ba 01 00 00 00       	mov    $0x1,%edx
+  803b6e:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  803b72:	6a 01                	push   $0x1
+  803b74:	50                   	push   %eax
+  803b75:	e8 3c d5 ff ff       	call   8010b6 <sys_futex_wake>
+}
+  803b7a:	83 c4 10             	add    $0x10,%esp
+  803b7d:	c9                   	leave
+  803b7e:	c3                   	ret
+
+00803b7f <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  803b7f:	55                   	push   %ebp
+  803b80:	89 e5                	mov    %esp,%ebp
+  803b82:	83 ec 10             	sub    $0x10,%esp
+  803b85:	8b 45 08             	mov    0x8(%ebp),%eax
+  803b88:	ba 01 00 00 00       	mov    $0x1,%edx
+  803b8d:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  803b91:	68 00 04 00 00       	push   $0x400
+  803b96:	50                   	push   %eax
+  803b97:	e8 1a d5 ff ff       	call   8010b6 <sys_futex_wake>
+}
+  803b9c:	83 c4 10             	add    $0x10,%esp
+  803b9f:	c9                   	leave
+  803ba0:	c3                   	ret
+
+00803ba1 <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  803ba1:	55                   	push   %ebp
+  803ba2:	89 e5                	mov    %esp,%ebp
+  803ba4:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  803ba7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803baa:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  803bac:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  803bb3:	5d                   	pop    %ebp
+  803bb4:	c3                   	ret
+
+00803bb5 <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  803bb5:	55                   	push   %ebp
+  803bb6:	89 e5                	mov    %esp,%ebp
+  803bb8:	53                   	push   %ebx
+  803bb9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  803bbc:	8b 11                	mov    (%ecx),%edx
+  803bbe:	85 d2                	test   %edx,%edx
+  803bc0:	74 14                	je     803bd6 <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  803bc2:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803bc5:	89 d0                	mov    %edx,%eax
+  803bc7:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  803bcb:	39 c2                	cmp    %eax,%edx
+  803bcd:	75 ed                	jne    803bbc <sem_trywait+0x7>
+			return 0;
+  803bcf:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bd4:	eb 05                	jmp    803bdb <sem_trywait+0x26>
+	return -E_AGAIN;
+  803bd6:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  803bdb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803bde:	c9                   	leave
+  803bdf:	c3                   	ret
+
+00803be0 <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  803be0:	55                   	push   %ebp
+  803be1:	89 e5                	mov    %esp,%ebp
+  803be3:	57                   	push   %edi
+  803be4:	56                   	push   %esi
+  803be5:	53                   	push   %ebx
+  803be6:	83 ec 1c             	sub    $0x1c,%esp
+  803be9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803bec:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  803bef:	e8 0b d4 ff ff       	call   800fff <sys_time_msec>
+  803bf4:	01 f8                	add    %edi,%eax
+  803bf6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  803bf9:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  803bfe:	eb 28                	jmp    803c28 <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  803c00:	b8 01 00 00 00       	mov    $0x1,%eax
+  803c05:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  803c0a:	83 ec 04             	sub    $0x4,%esp
+  803c0d:	56                   	push   %esi
+  803c0e:	6a 00                	push   $0x0
+  803c10:	53                   	push   %ebx
+  803c11:	e8 71 d4 ff ff       	call   801087 <sys_futex_wait>
+  803c16:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  803c1b:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  803c20:	83 c4 10             	add    $0x10,%esp
+  803c23:	83 f8 ec             	cmp    $0xffffffec,%eax
+  803c26:	74 2e                	je     803c56 <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  803c28:	83 ec 0c             	sub    $0xc,%esp
+  803c2b:	53                   	push   %ebx
+  803c2c:	e8 84 ff ff ff       	call   803bb5 <sem_trywait>
+  803c31:	83 c4 10             	add    $0x10,%esp
+  803c34:	85 c0                	test   %eax,%eax
+  803c36:	79 19                	jns    803c51 <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  803c38:	85 ff                	test   %edi,%edi
+  803c3a:	74 c4                	je     803c00 <sem_timedwait+0x20>
+  803c3c:	e8 be d3 ff ff       	call   800fff <sys_time_msec>
+  803c41:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803c44:	29 c6                	sub    %eax,%esi
+  803c46:	85 f6                	test   %esi,%esi
+  803c48:	7f b6                	jg     803c00 <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  803c4a:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  803c4f:	eb 05                	jmp    803c56 <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  803c51:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c56:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c59:	5b                   	pop    %ebx
+  803c5a:	5e                   	pop    %esi
+  803c5b:	5f                   	pop    %edi
+  803c5c:	5d                   	pop    %ebp
+  803c5d:	c3                   	ret
+
+00803c5e <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  803c5e:	55                   	push   %ebp
+  803c5f:	89 e5                	mov    %esp,%ebp
+  803c61:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  803c64:	6a 00                	push   $0x0
+  803c66:	ff 75 08             	push   0x8(%ebp)
+  803c69:	e8 72 ff ff ff       	call   803be0 <sem_timedwait>
+}
+  803c6e:	83 c4 10             	add    $0x10,%esp
+  803c71:	c9                   	leave
+  803c72:	c3                   	ret
+
+00803c73 <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  803c73:	55                   	push   %ebp
+  803c74:	89 e5                	mov    %esp,%ebp
+  803c76:	83 ec 08             	sub    $0x8,%esp
+  803c79:	8b 45 08             	mov    0x8(%ebp),%eax
+  803c7c:	ba 01 00 00 00       	mov    $0x1,%edx
+  803c81:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  803c85:	8b 50 04             	mov    0x4(%eax),%edx
+  803c88:	85 d2                	test   %edx,%edx
+  803c8a:	75 02                	jne    803c8e <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  803c8c:	c9                   	leave
+  803c8d:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  803c8e:	83 ec 08             	sub    $0x8,%esp
+  803c91:	6a 01                	push   $0x1
+  803c93:	50                   	push   %eax
+  803c94:	e8 1d d4 ff ff       	call   8010b6 <sys_futex_wake>
+  803c99:	83 c4 10             	add    $0x10,%esp
+}
+  803c9c:	eb ee                	jmp    803c8c <sem_post+0x19>
+
+00803c9e <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  803c9e:	55                   	push   %ebp
+  803c9f:	89 e5                	mov    %esp,%ebp
+  803ca1:	57                   	push   %edi
+  803ca2:	56                   	push   %esi
+  803ca3:	53                   	push   %ebx
+  803ca4:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  803ca7:	68 20 70 80 00       	push   $0x807020
+  803cac:	e8 97 fd ff ff       	call   803a48 <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  803cb1:	a1 44 70 80 00       	mov    0x807044,%eax
+  803cb6:	83 c4 10             	add    $0x10,%esp
+  803cb9:	85 c0                	test   %eax,%eax
+  803cbb:	75 19                	jne    803cd6 <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  803cbd:	a1 c0 72 80 00       	mov    0x8072c0,%eax
+  803cc2:	8b 00                	mov    (%eax),%eax
+  803cc4:	8b 40 48             	mov    0x48(%eax),%eax
+  803cc7:	a3 40 70 80 00       	mov    %eax,0x807040
+		threads[0].th_state = PTH_RUNNING;
+  803ccc:	c7 05 44 70 80 00 01 	movl   $0x1,0x807044
+  803cd3:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803cd6:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  803cdb:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803cde:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803ce5:	8b 40 04             	mov    0x4(%eax),%eax
+  803ce8:	85 c0                	test   %eax,%eax
+  803cea:	0f 84 e4 00 00 00    	je     803dd4 <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803cf0:	83 c3 01             	add    $0x1,%ebx
+  803cf3:	83 fb 20             	cmp    $0x20,%ebx
+  803cf6:	75 e3                	jne    803cdb <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  803cf8:	83 ec 0c             	sub    $0xc,%esp
+  803cfb:	68 20 70 80 00       	push   $0x807020
+  803d00:	e8 b0 fd ff ff       	call   803ab5 <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  803d05:	83 c4 10             	add    $0x10,%esp
+  803d08:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  803d0d:	e9 b8 00 00 00       	jmp    803dca <pthread_create+0x12c>
+  803d12:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  803d15:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  803d18:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  803d1a:	39 f3                	cmp    %esi,%ebx
+  803d1c:	73 16                	jae    803d34 <pthread_create+0x96>
+		va -= PGSIZE;
+  803d1e:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  803d24:	83 ec 08             	sub    $0x8,%esp
+  803d27:	56                   	push   %esi
+  803d28:	6a 00                	push   $0x0
+  803d2a:	e8 dc d0 ff ff       	call   800e0b <sys_page_unmap>
+  803d2f:	83 c4 10             	add    $0x10,%esp
+  803d32:	eb e6                	jmp    803d1a <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  803d34:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803d37:	83 ec 08             	sub    $0x8,%esp
+  803d3a:	ff 75 e4             	push   -0x1c(%ebp)
+  803d3d:	6a 00                	push   $0x0
+  803d3f:	e8 c7 d0 ff ff       	call   800e0b <sys_page_unmap>
+	return r;
+  803d44:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  803d47:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803d4a:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803d51:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  803d58:	eb 70                	jmp    803dca <pthread_create+0x12c>
+	th->th_fn = fn;
+  803d5a:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803d5d:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803d64:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803d67:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  803d6a:	8b 55 10             	mov    0x10(%ebp),%edx
+  803d6d:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  803d70:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  803d77:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  803d7c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803d7f:	29 c8                	sub    %ecx,%eax
+  803d81:	85 db                	test   %ebx,%ebx
+  803d83:	0f 44 05 c0 72 80 00 	cmove  0x8072c0,%eax
+	*--esp = t;
+  803d8a:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  803d8d:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803d94:	83 ec 04             	sub    $0x4,%esp
+  803d97:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803d9c:	29 ca                	sub    %ecx,%edx
+  803d9e:	52                   	push   %edx
+	*--esp = 0;
+  803d9f:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803da2:	50                   	push   %eax
+  803da3:	68 fb 3f 80 00       	push   $0x803ffb
+  803da8:	e8 ae d3 ff ff       	call   80115b <sys_thread_create>
+  803dad:	89 c7                	mov    %eax,%edi
+  803daf:	83 c4 10             	add    $0x10,%esp
+  803db2:	85 c0                	test   %eax,%eax
+  803db4:	78 91                	js     803d47 <pthread_create+0xa9>
+	th->th_env = id;
+  803db6:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803db9:	89 3c 85 40 70 80 00 	mov    %edi,0x807040(,%eax,4)
+	*tp = t;
+  803dc0:	8b 45 08             	mov    0x8(%ebp),%eax
+  803dc3:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  803dc5:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803dca:	89 f8                	mov    %edi,%eax
+  803dcc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803dcf:	5b                   	pop    %ebx
+  803dd0:	5e                   	pop    %esi
+  803dd1:	5f                   	pop    %edi
+  803dd2:	5d                   	pop    %ebp
+  803dd3:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  803dd4:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803dd7:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803dde:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  803de5:	83 ec 0c             	sub    $0xc,%esp
+  803de8:	68 20 70 80 00       	push   $0x807020
+  803ded:	e8 c3 fc ff ff       	call   803ab5 <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  803df2:	89 d9                	mov    %ebx,%ecx
+  803df4:	c1 e1 10             	shl    $0x10,%ecx
+  803df7:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  803dfa:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  803dff:	29 c8                	sub    %ecx,%eax
+  803e01:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  803e04:	c1 e8 16             	shr    $0x16,%eax
+  803e07:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803e0e:	83 c4 10             	add    $0x10,%esp
+  803e11:	a8 01                	test   $0x1,%al
+  803e13:	74 15                	je     803e2a <pthread_create+0x18c>
+  803e15:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803e18:	c1 e8 0c             	shr    $0xc,%eax
+  803e1b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803e22:	a8 01                	test   $0x1,%al
+  803e24:	0f 85 30 ff ff ff    	jne    803d5a <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803e2a:	83 ec 04             	sub    $0x4,%esp
+  803e2d:	6a 07                	push   $0x7
+  803e2f:	ff 75 e4             	push   -0x1c(%ebp)
+  803e32:	6a 00                	push   $0x0
+  803e34:	e8 39 cf ff ff       	call   800d72 <sys_page_alloc>
+  803e39:	89 c7                	mov    %eax,%edi
+  803e3b:	83 c4 10             	add    $0x10,%esp
+  803e3e:	85 c0                	test   %eax,%eax
+  803e40:	0f 88 01 ff ff ff    	js     803d47 <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  803e46:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  803e4b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  803e4e:	29 d0                	sub    %edx,%eax
+  803e50:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  803e53:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803e55:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  803e5a:	29 d0                	sub    %edx,%eax
+  803e5c:	89 c7                	mov    %eax,%edi
+  803e5e:	39 fe                	cmp    %edi,%esi
+  803e60:	0f 83 f4 fe ff ff    	jae    803d5a <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803e66:	83 ec 04             	sub    $0x4,%esp
+  803e69:	6a 07                	push   $0x7
+  803e6b:	56                   	push   %esi
+  803e6c:	6a 00                	push   $0x0
+  803e6e:	e8 ff ce ff ff       	call   800d72 <sys_page_alloc>
+  803e73:	83 c4 10             	add    $0x10,%esp
+  803e76:	85 c0                	test   %eax,%eax
+  803e78:	0f 88 94 fe ff ff    	js     803d12 <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803e7e:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803e84:	eb d8                	jmp    803e5e <pthread_create+0x1c0>
+
+00803e86 <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  803e86:	55                   	push   %ebp
+  803e87:	89 e5                	mov    %esp,%ebp
+  803e89:	57                   	push   %edi
+  803e8a:	56                   	push   %esi
+  803e8b:	53                   	push   %ebx
+  803e8c:	83 ec 0c             	sub    $0xc,%esp
+  803e8f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  803e92:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  803e95:	83 f8 1e             	cmp    $0x1e,%eax
+  803e98:	0f 87 c7 00 00 00    	ja     803f65 <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  803e9e:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803ea0:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803ea6:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803eab:	77 12                	ja     803ebf <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803ead:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803eb2:	29 d0                	sub    %edx,%eax
+  803eb4:	c1 e8 10             	shr    $0x10,%eax
+  803eb7:	39 c3                	cmp    %eax,%ebx
+  803eb9:	0f 84 ad 00 00 00    	je     803f6c <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803ebf:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803ec2:	8d 3c 85 44 70 80 00 	lea    0x807044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  803ec9:	8d 34 85 40 70 80 00 	lea    0x807040(,%eax,4),%esi
+  803ed0:	eb 10                	jmp    803ee2 <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803ed2:	83 ec 04             	sub    $0x4,%esp
+  803ed5:	6a 00                	push   $0x0
+  803ed7:	6a 01                	push   $0x1
+  803ed9:	57                   	push   %edi
+  803eda:	e8 a8 d1 ff ff       	call   801087 <sys_futex_wait>
+  803edf:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  803ee2:	8b 46 04             	mov    0x4(%esi),%eax
+  803ee5:	83 f8 01             	cmp    $0x1,%eax
+  803ee8:	74 e8                	je     803ed2 <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  803eea:	83 f8 02             	cmp    $0x2,%eax
+  803eed:	0f 85 80 00 00 00    	jne    803f73 <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  803ef3:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  803ef6:	c1 e6 02             	shl    $0x2,%esi
+  803ef9:	eb 05                	jmp    803f00 <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  803efb:	e8 46 ce ff ff       	call   800d46 <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  803f00:	8b 8e 40 70 80 00    	mov    0x807040(%esi),%ecx
+  803f06:	89 ca                	mov    %ecx,%edx
+  803f08:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  803f0e:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803f11:	c1 e0 04             	shl    $0x4,%eax
+  803f14:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803f19:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  803f1c:	39 c1                	cmp    %eax,%ecx
+  803f1e:	75 12                	jne    803f32 <pthread_join+0xac>
+  803f20:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803f23:	c1 e0 04             	shl    $0x4,%eax
+  803f26:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803f2b:	8b 40 54             	mov    0x54(%eax),%eax
+  803f2e:	85 c0                	test   %eax,%eax
+  803f30:	75 c9                	jne    803efb <pthread_join+0x75>
+	if (ret_store)
+  803f32:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803f36:	74 0f                	je     803f47 <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  803f38:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803f3b:	8b 04 85 50 70 80 00 	mov    0x807050(,%eax,4),%eax
+  803f42:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803f45:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  803f47:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803f4a:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803f51:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  803f58:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f5d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803f60:	5b                   	pop    %ebx
+  803f61:	5e                   	pop    %esi
+  803f62:	5f                   	pop    %edi
+  803f63:	5d                   	pop    %ebp
+  803f64:	c3                   	ret
+		return -E_INVAL;
+  803f65:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803f6a:	eb f1                	jmp    803f5d <pthread_join+0xd7>
+  803f6c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803f71:	eb ea                	jmp    803f5d <pthread_join+0xd7>
+		return -E_INVAL;
+  803f73:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803f78:	eb e3                	jmp    803f5d <pthread_join+0xd7>
+
+00803f7a <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  803f7a:	55                   	push   %ebp
+  803f7b:	89 e5                	mov    %esp,%ebp
+  803f7d:	53                   	push   %ebx
+  803f7e:	83 ec 04             	sub    $0x4,%esp
+  803f81:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803f83:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803f89:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803f8e:	77 0c                	ja     803f9c <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803f90:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803f95:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  803f97:	c1 e8 10             	shr    $0x10,%eax
+  803f9a:	75 0a                	jne    803fa6 <pthread_exit+0x2c>
+		exit();
+  803f9c:	e8 ac c2 ff ff       	call   80024d <exit>
+  803fa1:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  803fa6:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  803fad:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  803fb0:	8d 0c 8d 40 70 80 00 	lea    0x807040(,%ecx,4),%ecx
+  803fb7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803fba:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  803fbd:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  803fc4:	83 ec 08             	sub    $0x8,%esp
+  803fc7:	6a 20                	push   $0x20
+  803fc9:	01 c2                	add    %eax,%edx
+  803fcb:	8d 04 95 44 70 80 00 	lea    0x807044(,%edx,4),%eax
+  803fd2:	50                   	push   %eax
+  803fd3:	e8 de d0 ff ff       	call   8010b6 <sys_futex_wake>
+	sys_env_destroy(0);
+  803fd8:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  803fdf:	e8 eb cc ff ff       	call   800ccf <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  803fe4:	83 c4 0c             	add    $0xc,%esp
+  803fe7:	68 16 50 80 00       	push   $0x805016
+  803fec:	68 a5 00 00 00       	push   $0xa5
+  803ff1:	68 30 50 80 00       	push   $0x805030
+  803ff6:	e8 7a c2 ff ff       	call   800275 <_panic>
+
+00803ffb <pthread_start>:
+{
+  803ffb:	55                   	push   %ebp
+  803ffc:	89 e5                	mov    %esp,%ebp
+  803ffe:	53                   	push   %ebx
+  803fff:	83 ec 04             	sub    $0x4,%esp
+  804002:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  804005:	e8 10 cd ff ff       	call   800d1a <sys_getenvid>
+  80400a:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  80400f:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+	if (t == 0)
+  804015:	85 db                	test   %ebx,%ebx
+  804017:	74 0c                	je     804025 <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804019:	89 d9                	mov    %ebx,%ecx
+  80401b:	c1 e1 10             	shl    $0x10,%ecx
+  80401e:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804023:	29 ca                	sub    %ecx,%edx
+  804025:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  804028:	c1 e0 04             	shl    $0x4,%eax
+  80402b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804030:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  804032:	83 ec 0c             	sub    $0xc,%esp
+  804035:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  80403c:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  80403f:	ff 34 95 4c 70 80 00 	push   0x80704c(,%edx,4)
+  804046:	ff 14 95 48 70 80 00 	call   *0x807048(,%edx,4)
+  80404d:	89 04 24             	mov    %eax,(%esp)
+  804050:	e8 25 ff ff ff       	call   803f7a <pthread_exit>
+
+00804055 <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  804055:	55                   	push   %ebp
+  804056:	89 e5                	mov    %esp,%ebp
+  804058:	57                   	push   %edi
+  804059:	56                   	push   %esi
+  80405a:	53                   	push   %ebx
+  80405b:	83 ec 1c             	sub    $0x1c,%esp
+  80405e:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804060:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  804066:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80406d:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804072:	77 0d                	ja     804081 <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804074:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804079:	29 d0                	sub    %edx,%eax
+  80407b:	c1 e8 10             	shr    $0x10,%eax
+  80407e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  804081:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804086:	eb 2f                	jmp    8040b7 <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  804088:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  80408e:	8b 01                	mov    (%ecx),%eax
+  804090:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  804093:	39 c2                	cmp    %eax,%edx
+  804095:	75 14                	jne    8040ab <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  804097:	83 ec 0c             	sub    $0xc,%esp
+  80409a:	57                   	push   %edi
+  80409b:	e8 2f cc ff ff       	call   800ccf <sys_env_destroy>
+  8040a0:	83 c4 10             	add    $0x10,%esp
+  8040a3:	85 c0                	test   %eax,%eax
+  8040a5:	0f 88 97 00 00 00    	js     804142 <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  8040ab:	83 c3 01             	add    $0x1,%ebx
+  8040ae:	83 fb 20             	cmp    $0x20,%ebx
+  8040b1:	0f 84 d2 00 00 00    	je     804189 <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  8040b7:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  8040ba:	74 ef                	je     8040ab <pthread_kill_others+0x56>
+  8040bc:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8040bf:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  8040c6:	8b 40 04             	mov    0x4(%eax),%eax
+  8040c9:	83 f8 01             	cmp    $0x1,%eax
+  8040cc:	75 dd                	jne    8040ab <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  8040ce:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8040d1:	8b 3c 85 40 70 80 00 	mov    0x807040(,%eax,4),%edi
+  8040d8:	89 fe                	mov    %edi,%esi
+  8040da:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  8040e0:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  8040e3:	c1 e0 04             	shl    $0x4,%eax
+  8040e6:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8040eb:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  8040ee:	39 c7                	cmp    %eax,%edi
+  8040f0:	75 b9                	jne    8040ab <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  8040f2:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  8040f5:	c1 e0 04             	shl    $0x4,%eax
+  8040f8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8040fd:	8b 40 54             	mov    0x54(%eax),%eax
+  804100:	85 c0                	test   %eax,%eax
+  804102:	74 a7                	je     8040ab <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  804104:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  804107:	c1 e0 04             	shl    $0x4,%eax
+  80410a:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  804110:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804112:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  804118:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80411d:	0f 87 65 ff ff ff    	ja     804088 <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804123:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804128:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  80412a:	c1 e8 10             	shr    $0x10,%eax
+  80412d:	0f 84 55 ff ff ff    	je     804088 <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804133:	c1 e0 10             	shl    $0x10,%eax
+  804136:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80413b:	29 c1                	sub    %eax,%ecx
+  80413d:	e9 4c ff ff ff       	jmp    80408e <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  804142:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  804145:	c1 e2 04             	shl    $0x4,%edx
+  804148:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80414e:	8b 52 48             	mov    0x48(%edx),%edx
+  804151:	39 fa                	cmp    %edi,%edx
+  804153:	0f 85 52 ff ff ff    	jne    8040ab <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  804159:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  80415c:	c1 e2 04             	shl    $0x4,%edx
+  80415f:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  804165:	8b 52 54             	mov    0x54(%edx),%edx
+  804168:	85 d2                	test   %edx,%edx
+  80416a:	0f 84 3b ff ff ff    	je     8040ab <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  804170:	83 ec 0c             	sub    $0xc,%esp
+  804173:	50                   	push   %eax
+  804174:	57                   	push   %edi
+  804175:	68 40 50 80 00       	push   $0x805040
+  80417a:	68 bb 00 00 00       	push   $0xbb
+  80417f:	68 30 50 80 00       	push   $0x805030
+  804184:	e8 ec c0 ff ff       	call   800275 <_panic>
+	}
+}
+  804189:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80418c:	5b                   	pop    %ebx
+  80418d:	5e                   	pop    %esi
+  80418e:	5f                   	pop    %edi
+  80418f:	5d                   	pop    %ebp
+  804190:	c3                   	ret
+
+00804191 <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  804191:	55                   	push   %ebp
+  804192:	89 e5                	mov    %esp,%ebp
+  804194:	53                   	push   %ebx
+  804195:	83 ec 04             	sub    $0x4,%esp
+  804198:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80419a:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  8041a0:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8041a6:	0f 87 85 00 00 00    	ja     804231 <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8041ac:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  8041b1:	29 c3                	sub    %eax,%ebx
+  8041b3:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  8041b6:	83 ec 04             	sub    $0x4,%esp
+  8041b9:	68 80 02 00 00       	push   $0x280
+  8041be:	6a 00                	push   $0x0
+  8041c0:	68 40 70 80 00       	push   $0x807040
+  8041c5:	e8 bb c8 ff ff       	call   800a85 <memset>
+	threads_mu.m_state = 0;
+  8041ca:	c7 05 20 70 80 00 00 	movl   $0x0,0x807020
+  8041d1:	00 00 00 
+	if (self != 0) {
+  8041d4:	83 c4 10             	add    $0x10,%esp
+  8041d7:	85 db                	test   %ebx,%ebx
+  8041d9:	74 51                	je     80422c <pthread_fork_child+0x9b>
+  8041db:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8041dd:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8041e3:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8041e8:	77 18                	ja     804202 <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8041ea:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8041ef:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8041f1:	c1 e8 10             	shr    $0x10,%eax
+  8041f4:	74 0c                	je     804202 <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8041f6:	c1 e0 10             	shl    $0x10,%eax
+  8041f9:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8041fe:	29 c2                	sub    %eax,%edx
+  804200:	eb 06                	jmp    804208 <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  804202:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		threads[self].th_env = thisenv->env_id;
+  804208:	8b 02                	mov    (%edx),%eax
+  80420a:	8b 48 48             	mov    0x48(%eax),%ecx
+  80420d:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  804214:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  804217:	89 0c 95 40 70 80 00 	mov    %ecx,0x807040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  80421e:	8d 04 95 40 70 80 00 	lea    0x807040(,%edx,4),%eax
+  804225:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  80422c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80422f:	c9                   	leave
+  804230:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  804231:	83 ec 04             	sub    $0x4,%esp
+  804234:	68 80 02 00 00       	push   $0x280
+  804239:	6a 00                	push   $0x0
+  80423b:	68 40 70 80 00       	push   $0x807040
+  804240:	e8 40 c8 ff ff       	call   800a85 <memset>
+	threads_mu.m_state = 0;
+  804245:	c7 05 20 70 80 00 00 	movl   $0x0,0x807020
+  80424c:	00 00 00 
+  80424f:	83 c4 10             	add    $0x10,%esp
+  804252:	eb d8                	jmp    80422c <pthread_fork_child+0x9b>
+
+00804254 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  804254:	b8 00 00 00 00       	mov    $0x0,%eax
+  804259:	c3                   	ret
+
+0080425a <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80425a:	55                   	push   %ebp
+  80425b:	89 e5                	mov    %esp,%ebp
+  80425d:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  804260:	68 65 50 80 00       	push   $0x805065
+  804265:	ff 75 0c             	push   0xc(%ebp)
+  804268:	e8 c7 c6 ff ff       	call   800934 <strcpy>
+	return 0;
+}
+  80426d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804272:	c9                   	leave
+  804273:	c3                   	ret
+
+00804274 <devcons_write>:
+{
+  804274:	55                   	push   %ebp
+  804275:	89 e5                	mov    %esp,%ebp
+  804277:	57                   	push   %edi
+  804278:	56                   	push   %esi
+  804279:	53                   	push   %ebx
+  80427a:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  804280:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  804285:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80428b:	eb 2e                	jmp    8042bb <devcons_write+0x47>
+		m = n - tot;
+  80428d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804290:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  804292:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804297:	39 c3                	cmp    %eax,%ebx
+  804299:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80429c:	83 ec 04             	sub    $0x4,%esp
+  80429f:	53                   	push   %ebx
+  8042a0:	89 f0                	mov    %esi,%eax
+  8042a2:	03 45 0c             	add    0xc(%ebp),%eax
+  8042a5:	50                   	push   %eax
+  8042a6:	57                   	push   %edi
+  8042a7:	e8 0e c8 ff ff       	call   800aba <memmove>
+		sys_cputs(buf, m);
+  8042ac:	83 c4 08             	add    $0x8,%esp
+  8042af:	53                   	push   %ebx
+  8042b0:	57                   	push   %edi
+  8042b1:	e8 c2 c9 ff ff       	call   800c78 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8042b6:	01 de                	add    %ebx,%esi
+  8042b8:	83 c4 10             	add    $0x10,%esp
+  8042bb:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8042be:	72 cd                	jb     80428d <devcons_write+0x19>
+}
+  8042c0:	89 f0                	mov    %esi,%eax
+  8042c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8042c5:	5b                   	pop    %ebx
+  8042c6:	5e                   	pop    %esi
+  8042c7:	5f                   	pop    %edi
+  8042c8:	5d                   	pop    %ebp
+  8042c9:	c3                   	ret
+
+008042ca <devcons_read>:
+{
+  8042ca:	55                   	push   %ebp
+  8042cb:	89 e5                	mov    %esp,%ebp
+  8042cd:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8042d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042d5:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8042d9:	75 07                	jne    8042e2 <devcons_read+0x18>
+  8042db:	eb 1f                	jmp    8042fc <devcons_read+0x32>
+		sys_yield();
+  8042dd:	e8 64 ca ff ff       	call   800d46 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8042e2:	e8 bc c9 ff ff       	call   800ca3 <sys_cgetc>
+  8042e7:	85 c0                	test   %eax,%eax
+  8042e9:	74 f2                	je     8042dd <devcons_read+0x13>
+	if (c < 0)
+  8042eb:	78 0f                	js     8042fc <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8042ed:	83 f8 04             	cmp    $0x4,%eax
+  8042f0:	74 0c                	je     8042fe <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8042f2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8042f5:	88 02                	mov    %al,(%edx)
+	return 1;
+  8042f7:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8042fc:	c9                   	leave
+  8042fd:	c3                   	ret
+		return 0;
+  8042fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  804303:	eb f7                	jmp    8042fc <devcons_read+0x32>
+
+00804305 <cputchar>:
+{
+  804305:	55                   	push   %ebp
+  804306:	89 e5                	mov    %esp,%ebp
+  804308:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80430b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80430e:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  804311:	6a 01                	push   $0x1
+  804313:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804316:	50                   	push   %eax
+  804317:	e8 5c c9 ff ff       	call   800c78 <sys_cputs>
+}
+  80431c:	83 c4 10             	add    $0x10,%esp
+  80431f:	c9                   	leave
+  804320:	c3                   	ret
+
+00804321 <getchar>:
+{
+  804321:	55                   	push   %ebp
+  804322:	89 e5                	mov    %esp,%ebp
+  804324:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  804327:	6a 01                	push   $0x1
+  804329:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80432c:	50                   	push   %eax
+  80432d:	6a 00                	push   $0x0
+  80432f:	e8 63 d8 ff ff       	call   801b97 <read>
+	if (r < 0)
+  804334:	83 c4 10             	add    $0x10,%esp
+  804337:	85 c0                	test   %eax,%eax
+  804339:	78 06                	js     804341 <getchar+0x20>
+	if (r < 1)
+  80433b:	74 06                	je     804343 <getchar+0x22>
+	return c;
+  80433d:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  804341:	c9                   	leave
+  804342:	c3                   	ret
+		return -E_EOF;
+  804343:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804348:	eb f7                	jmp    804341 <getchar+0x20>
+
+0080434a <iscons>:
+{
+  80434a:	55                   	push   %ebp
+  80434b:	89 e5                	mov    %esp,%ebp
+  80434d:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804350:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804353:	50                   	push   %eax
+  804354:	ff 75 08             	push   0x8(%ebp)
+  804357:	e8 ab d5 ff ff       	call   801907 <fd_lookup>
+  80435c:	83 c4 10             	add    $0x10,%esp
+  80435f:	85 c0                	test   %eax,%eax
+  804361:	78 11                	js     804374 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  804363:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804366:	8b 15 98 62 80 00    	mov    0x806298,%edx
+  80436c:	39 10                	cmp    %edx,(%eax)
+  80436e:	0f 94 c0             	sete   %al
+  804371:	0f b6 c0             	movzbl %al,%eax
+}
+  804374:	c9                   	leave
+  804375:	c3                   	ret
+
+00804376 <opencons>:
+{
+  804376:	55                   	push   %ebp
+  804377:	89 e5                	mov    %esp,%ebp
+  804379:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80437c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80437f:	50                   	push   %eax
+  804380:	e8 2c d5 ff ff       	call   8018b1 <fd_alloc>
+  804385:	83 c4 10             	add    $0x10,%esp
+  804388:	85 c0                	test   %eax,%eax
+  80438a:	78 3a                	js     8043c6 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80438c:	83 ec 04             	sub    $0x4,%esp
+  80438f:	68 07 04 00 00       	push   $0x407
+  804394:	ff 75 f4             	push   -0xc(%ebp)
+  804397:	6a 00                	push   $0x0
+  804399:	e8 d4 c9 ff ff       	call   800d72 <sys_page_alloc>
+  80439e:	83 c4 10             	add    $0x10,%esp
+  8043a1:	85 c0                	test   %eax,%eax
+  8043a3:	78 21                	js     8043c6 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8043a5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8043a8:	8b 15 98 62 80 00    	mov    0x806298,%edx
+  8043ae:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8043b0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8043b3:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8043ba:	83 ec 0c             	sub    $0xc,%esp
+  8043bd:	50                   	push   %eax
+  8043be:	e8 c7 d4 ff ff       	call   80188a <fd2num>
+  8043c3:	83 c4 10             	add    $0x10,%esp
+}
+  8043c6:	c9                   	leave
+  8043c7:	c3                   	ret
+
+008043c8 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8043c8:	55                   	push   %ebp
+  8043c9:	89 e5                	mov    %esp,%ebp
+  8043cb:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  8043ce:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  8043d5:	74 0a                	je     8043e1 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8043d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8043da:	a3 00 a0 80 00       	mov    %eax,0x80a000
+}
+  8043df:	c9                   	leave
+  8043e0:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  8043e1:	83 ec 04             	sub    $0x4,%esp
+  8043e4:	6a 07                	push   $0x7
+  8043e6:	68 00 f0 bf ee       	push   $0xeebff000
+  8043eb:	6a 00                	push   $0x0
+  8043ed:	e8 80 c9 ff ff       	call   800d72 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8043f2:	83 c4 08             	add    $0x8,%esp
+  8043f5:	68 06 44 80 00       	push   $0x804406
+  8043fa:	6a 00                	push   $0x0
+  8043fc:	e8 ee ca ff ff       	call   800eef <sys_env_set_pgfault_upcall>
+  804401:	83 c4 10             	add    $0x10,%esp
+  804404:	eb d1                	jmp    8043d7 <set_pgfault_handler+0xf>
+
+00804406 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804406:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804407:	a1 00 a0 80 00       	mov    0x80a000,%eax
+	call *%eax
+  80440c:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80440e:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  804411:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  804415:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  804419:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  80441c:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  804420:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  804422:	83 c4 08             	add    $0x8,%esp
+	popal
+  804425:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  804426:	83 c4 04             	add    $0x4,%esp
+	popfl
+  804429:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  80442a:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  80442b:	c3                   	ret
+
+0080442c <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80442c:	55                   	push   %ebp
+  80442d:	89 e5                	mov    %esp,%ebp
+  80442f:	57                   	push   %edi
+  804430:	56                   	push   %esi
+  804431:	53                   	push   %ebx
+  804432:	83 ec 18             	sub    $0x18,%esp
+  804435:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804438:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80443b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  80443e:	85 c0                	test   %eax,%eax
+  804440:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804445:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  804448:	50                   	push   %eax
+  804449:	e8 1a cb ff ff       	call   800f68 <sys_ipc_recv>
+	if (r < 0) {
+  80444e:	83 c4 10             	add    $0x10,%esp
+  804451:	85 c0                	test   %eax,%eax
+  804453:	78 2b                	js     804480 <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  804455:	85 ff                	test   %edi,%edi
+  804457:	74 55                	je     8044ae <ipc_recv+0x82>
+  804459:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80445b:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804461:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804466:	77 39                	ja     8044a1 <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804468:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80446d:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80446f:	c1 e8 10             	shr    $0x10,%eax
+  804472:	74 2d                	je     8044a1 <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804474:	c1 e0 10             	shl    $0x10,%eax
+  804477:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80447c:	29 c2                	sub    %eax,%edx
+  80447e:	eb 27                	jmp    8044a7 <ipc_recv+0x7b>
+  804480:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  804482:	83 ec 08             	sub    $0x8,%esp
+  804485:	50                   	push   %eax
+  804486:	68 71 50 80 00       	push   $0x805071
+  80448b:	e8 c0 be ff ff       	call   800350 <cprintf>
+		*from_env_store = 0;
+  804490:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  804496:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  80449c:	83 c4 10             	add    $0x10,%esp
+  80449f:	eb 77                	jmp    804518 <ipc_recv+0xec>
+		return pthread_main_tls;
+  8044a1:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  8044a7:	8b 02                	mov    (%edx),%eax
+  8044a9:	8b 40 78             	mov    0x78(%eax),%eax
+  8044ac:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8044ae:	85 f6                	test   %esi,%esi
+  8044b0:	74 34                	je     8044e6 <ipc_recv+0xba>
+  8044b2:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8044b4:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8044ba:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8044bf:	77 18                	ja     8044d9 <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8044c1:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8044c6:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8044c8:	c1 e8 10             	shr    $0x10,%eax
+  8044cb:	74 0c                	je     8044d9 <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8044cd:	c1 e0 10             	shl    $0x10,%eax
+  8044d0:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8044d5:	29 c2                	sub    %eax,%edx
+  8044d7:	eb 06                	jmp    8044df <ipc_recv+0xb3>
+		return pthread_main_tls;
+  8044d9:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  8044df:	8b 02                	mov    (%edx),%eax
+  8044e1:	8b 40 7c             	mov    0x7c(%eax),%eax
+  8044e4:	89 06                	mov    %eax,(%esi)
+  8044e6:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8044e8:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8044ee:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8044f3:	77 18                	ja     80450d <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8044f5:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8044fa:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8044fc:	c1 e8 10             	shr    $0x10,%eax
+  8044ff:	74 0c                	je     80450d <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804501:	c1 e0 10             	shl    $0x10,%eax
+  804504:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804509:	29 c2                	sub    %eax,%edx
+  80450b:	eb 06                	jmp    804513 <ipc_recv+0xe7>
+		return pthread_main_tls;
+  80450d:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+	}
+	return thisenv->env_ipc_value;
+  804513:	8b 02                	mov    (%edx),%eax
+  804515:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  804518:	89 d8                	mov    %ebx,%eax
+  80451a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80451d:	5b                   	pop    %ebx
+  80451e:	5e                   	pop    %esi
+  80451f:	5f                   	pop    %edi
+  804520:	5d                   	pop    %ebp
+  804521:	c3                   	ret
+
+00804522 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  804522:	55                   	push   %ebp
+  804523:	89 e5                	mov    %esp,%ebp
+  804525:	57                   	push   %edi
+  804526:	56                   	push   %esi
+  804527:	53                   	push   %ebx
+  804528:	83 ec 0c             	sub    $0xc,%esp
+  80452b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80452e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804531:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  804534:	85 db                	test   %ebx,%ebx
+  804536:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80453b:	0f 44 d8             	cmove  %eax,%ebx
+  80453e:	eb 05                	jmp    804545 <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  804540:	e8 01 c8 ff ff       	call   800d46 <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  804545:	57                   	push   %edi
+  804546:	53                   	push   %ebx
+  804547:	ff 75 0c             	push   0xc(%ebp)
+  80454a:	56                   	push   %esi
+  80454b:	e8 eb c9 ff ff       	call   800f3b <sys_ipc_try_send>
+		if (r == 0) {
+  804550:	83 c4 10             	add    $0x10,%esp
+  804553:	85 c0                	test   %eax,%eax
+  804555:	74 19                	je     804570 <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  804557:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80455a:	74 e4                	je     804540 <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  80455c:	83 ec 0c             	sub    $0xc,%esp
+  80455f:	50                   	push   %eax
+  804560:	57                   	push   %edi
+  804561:	53                   	push   %ebx
+  804562:	56                   	push   %esi
+  804563:	68 8c 50 80 00       	push   $0x80508c
+  804568:	e8 e3 bd ff ff       	call   800350 <cprintf>
+			return;
+  80456d:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  804570:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804573:	5b                   	pop    %ebx
+  804574:	5e                   	pop    %esi
+  804575:	5f                   	pop    %edi
+  804576:	5d                   	pop    %ebp
+  804577:	c3                   	ret
+
+00804578 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804578:	55                   	push   %ebp
+  804579:	89 e5                	mov    %esp,%ebp
+  80457b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80457e:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  804583:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804586:	c1 e0 04             	shl    $0x4,%eax
+  804589:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80458e:	8b 40 50             	mov    0x50(%eax),%eax
+  804591:	39 c8                	cmp    %ecx,%eax
+  804593:	74 12                	je     8045a7 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804595:	83 c2 01             	add    $0x1,%edx
+  804598:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  80459e:	75 e3                	jne    804583 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8045a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045a5:	eb 0e                	jmp    8045b5 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8045a7:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8045aa:	c1 e0 04             	shl    $0x4,%eax
+  8045ad:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8045b2:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8045b5:	5d                   	pop    %ebp
+  8045b6:	c3                   	ret
+
+008045b7 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8045b7:	55                   	push   %ebp
+  8045b8:	89 e5                	mov    %esp,%ebp
+  8045ba:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8045bd:	89 c2                	mov    %eax,%edx
+  8045bf:	c1 ea 16             	shr    $0x16,%edx
+  8045c2:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8045c9:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8045ce:	f6 c1 01             	test   $0x1,%cl
+  8045d1:	74 1c                	je     8045ef <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  8045d3:	c1 e8 0c             	shr    $0xc,%eax
+  8045d6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8045dd:	a8 01                	test   $0x1,%al
+  8045df:	74 0e                	je     8045ef <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8045e1:	c1 e8 0c             	shr    $0xc,%eax
+  8045e4:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  8045eb:	ef 
+  8045ec:	0f b7 d2             	movzwl %dx,%edx
+}
+  8045ef:	89 d0                	mov    %edx,%eax
+  8045f1:	5d                   	pop    %ebp
+  8045f2:	c3                   	ret
+
+008045f3 <udm>:
+  8045f3:	57                   	push   %edi
+  8045f4:	56                   	push   %esi
+  8045f5:	53                   	push   %ebx
+  8045f6:	83 ec 20             	sub    $0x20,%esp
+  8045f9:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8045fd:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804601:	8b 44 24 30          	mov    0x30(%esp),%eax
+  804605:	8b 54 24 34          	mov    0x34(%esp),%edx
+  804609:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80460d:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804611:	89 d1                	mov    %edx,%ecx
+  804613:	09 c1                	or     %eax,%ecx
+  804615:	0f 84 91 00 00 00    	je     8046ac <udm+0xb9>
+  80461b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804620:	ba 00 00 00 00       	mov    $0x0,%edx
+  804625:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80462a:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804631:	00 
+  804632:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  804639:	00 
+  80463a:	eb 08                	jmp    804644 <udm+0x51>
+  80463c:	83 e9 01             	sub    $0x1,%ecx
+  80463f:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  804642:	74 7c                	je     8046c0 <udm+0xcd>
+  804644:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804648:	01 c0                	add    %eax,%eax
+  80464a:	89 c6                	mov    %eax,%esi
+  80464c:	89 d7                	mov    %edx,%edi
+  80464e:	8b 44 24 10          	mov    0x10(%esp),%eax
+  804652:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804656:	0f ad d0             	shrd   %cl,%edx,%eax
+  804659:	d3 ea                	shr    %cl,%edx
+  80465b:	f6 c1 20             	test   $0x20,%cl
+  80465e:	74 04                	je     804664 <udm+0x71>
+  804660:	89 d0                	mov    %edx,%eax
+  804662:	31 d2                	xor    %edx,%edx
+  804664:	83 e0 01             	and    $0x1,%eax
+  804667:	89 04 24             	mov    %eax,(%esp)
+  80466a:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804671:	00 
+  804672:	8b 04 24             	mov    (%esp),%eax
+  804675:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804679:	09 f0                	or     %esi,%eax
+  80467b:	09 fa                	or     %edi,%edx
+  80467d:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804681:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804685:	39 f0                	cmp    %esi,%eax
+  804687:	89 d3                	mov    %edx,%ebx
+  804689:	19 fb                	sbb    %edi,%ebx
+  80468b:	72 af                	jb     80463c <udm+0x49>
+  80468d:	29 f0                	sub    %esi,%eax
+  80468f:	19 fa                	sbb    %edi,%edx
+  804691:	89 cf                	mov    %ecx,%edi
+  804693:	c1 ef 05             	shr    $0x5,%edi
+  804696:	83 e7 01             	and    $0x1,%edi
+  804699:	89 fe                	mov    %edi,%esi
+  80469b:	83 f6 01             	xor    $0x1,%esi
+  80469e:	d3 e6                	shl    %cl,%esi
+  8046a0:	d3 e7                	shl    %cl,%edi
+  8046a2:	09 74 24 18          	or     %esi,0x18(%esp)
+  8046a6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8046aa:	eb 90                	jmp    80463c <udm+0x49>
+  8046ac:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8046b0:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8046b4:	89 f0                	mov    %esi,%eax
+  8046b6:	89 fa                	mov    %edi,%edx
+  8046b8:	89 74 24 18          	mov    %esi,0x18(%esp)
+  8046bc:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  8046c0:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  8046c4:	89 01                	mov    %eax,(%ecx)
+  8046c6:	89 51 04             	mov    %edx,0x4(%ecx)
+  8046c9:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8046cd:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8046d1:	83 c4 20             	add    $0x20,%esp
+  8046d4:	5b                   	pop    %ebx
+  8046d5:	5e                   	pop    %esi
+  8046d6:	5f                   	pop    %edi
+  8046d7:	c3                   	ret
+
+008046d8 <__udivdi3>:
+  8046d8:	83 ec 18             	sub    $0x18,%esp
+  8046db:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8046df:	50                   	push   %eax
+  8046e0:	ff 74 24 2c          	push   0x2c(%esp)
+  8046e4:	ff 74 24 2c          	push   0x2c(%esp)
+  8046e8:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8046ec:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8046f0:	e8 fe fe ff ff       	call   8045f3 <udm>
+  8046f5:	83 c4 24             	add    $0x24,%esp
+  8046f8:	c3                   	ret
+
+008046f9 <__umoddi3>:
+  8046f9:	83 ec 18             	sub    $0x18,%esp
+  8046fc:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804700:	50                   	push   %eax
+  804701:	ff 74 24 2c          	push   0x2c(%esp)
+  804705:	ff 74 24 2c          	push   0x2c(%esp)
+  804709:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80470d:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804711:	e8 dd fe ff ff       	call   8045f3 <udm>
+  804716:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80471a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80471e:	83 c4 24             	add    $0x24,%esp
+  804721:	c3                   	ret
+
+00804722 <__divdi3>:
+  804722:	56                   	push   %esi
+  804723:	53                   	push   %ebx
+  804724:	83 ec 14             	sub    $0x14,%esp
+  804727:	8b 44 24 20          	mov    0x20(%esp),%eax
+  80472b:	8b 54 24 24          	mov    0x24(%esp),%edx
+  80472f:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  804733:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  804737:	85 d2                	test   %edx,%edx
+  804739:	78 18                	js     804753 <__divdi3+0x31>
+  80473b:	85 db                	test   %ebx,%ebx
+  80473d:	78 3e                	js     80477d <__divdi3+0x5b>
+  80473f:	83 ec 04             	sub    $0x4,%esp
+  804742:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804746:	56                   	push   %esi
+  804747:	53                   	push   %ebx
+  804748:	51                   	push   %ecx
+  804749:	e8 a5 fe ff ff       	call   8045f3 <udm>
+  80474e:	83 c4 10             	add    $0x10,%esp
+  804751:	eb 24                	jmp    804777 <__divdi3+0x55>
+  804753:	f7 d8                	neg    %eax
+  804755:	83 d2 00             	adc    $0x0,%edx
+  804758:	f7 da                	neg    %edx
+  80475a:	85 db                	test   %ebx,%ebx
+  80475c:	78 3a                	js     804798 <__divdi3+0x76>
+  80475e:	83 ec 04             	sub    $0x4,%esp
+  804761:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804765:	56                   	push   %esi
+  804766:	53                   	push   %ebx
+  804767:	51                   	push   %ecx
+  804768:	e8 86 fe ff ff       	call   8045f3 <udm>
+  80476d:	83 c4 10             	add    $0x10,%esp
+  804770:	f7 d8                	neg    %eax
+  804772:	83 d2 00             	adc    $0x0,%edx
+  804775:	f7 da                	neg    %edx
+  804777:	83 c4 14             	add    $0x14,%esp
+  80477a:	5b                   	pop    %ebx
+  80477b:	5e                   	pop    %esi
+  80477c:	c3                   	ret
+  80477d:	83 ec 04             	sub    $0x4,%esp
+  804780:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804784:	56                   	push   %esi
+  804785:	f7 d9                	neg    %ecx
+  804787:	83 d3 00             	adc    $0x0,%ebx
+  80478a:	f7 db                	neg    %ebx
+  80478c:	53                   	push   %ebx
+  80478d:	51                   	push   %ecx
+  80478e:	e8 60 fe ff ff       	call   8045f3 <udm>
+  804793:	83 c4 10             	add    $0x10,%esp
+  804796:	eb d8                	jmp    804770 <__divdi3+0x4e>
+  804798:	83 ec 04             	sub    $0x4,%esp
+  80479b:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80479f:	56                   	push   %esi
+  8047a0:	f7 d9                	neg    %ecx
+  8047a2:	83 d3 00             	adc    $0x0,%ebx
+  8047a5:	f7 db                	neg    %ebx
+  8047a7:	53                   	push   %ebx
+  8047a8:	51                   	push   %ecx
+  8047a9:	e8 45 fe ff ff       	call   8045f3 <udm>
+  8047ae:	83 c4 10             	add    $0x10,%esp
+  8047b1:	eb c4                	jmp    804777 <__divdi3+0x55>
+
+008047b3 <__moddi3>:
+  8047b3:	55                   	push   %ebp
+  8047b4:	57                   	push   %edi
+  8047b5:	56                   	push   %esi
+  8047b6:	53                   	push   %ebx
+  8047b7:	83 ec 24             	sub    $0x24,%esp
+  8047ba:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8047be:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8047c2:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8047c6:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8047ca:	85 d2                	test   %edx,%edx
+  8047cc:	78 3b                	js     804809 <__moddi3+0x56>
+  8047ce:	83 ec 04             	sub    $0x4,%esp
+  8047d1:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8047d5:	56                   	push   %esi
+  8047d6:	89 ce                	mov    %ecx,%esi
+  8047d8:	f7 de                	neg    %esi
+  8047da:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8047de:	89 de                	mov    %ebx,%esi
+  8047e0:	83 d6 00             	adc    $0x0,%esi
+  8047e3:	f7 de                	neg    %esi
+  8047e5:	89 74 24 14          	mov    %esi,0x14(%esp)
+  8047e9:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8047ed:	0f 48 f1             	cmovs  %ecx,%esi
+  8047f0:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  8047f5:	53                   	push   %ebx
+  8047f6:	56                   	push   %esi
+  8047f7:	e8 f7 fd ff ff       	call   8045f3 <udm>
+  8047fc:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804800:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804804:	83 c4 10             	add    $0x10,%esp
+  804807:	eb 47                	jmp    804850 <__moddi3+0x9d>
+  804809:	f7 d8                	neg    %eax
+  80480b:	83 d2 00             	adc    $0x0,%edx
+  80480e:	f7 da                	neg    %edx
+  804810:	83 ec 04             	sub    $0x4,%esp
+  804813:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804817:	56                   	push   %esi
+  804818:	89 cf                	mov    %ecx,%edi
+  80481a:	f7 df                	neg    %edi
+  80481c:	89 de                	mov    %ebx,%esi
+  80481e:	83 d6 00             	adc    $0x0,%esi
+  804821:	f7 de                	neg    %esi
+  804823:	0f 49 cf             	cmovns %edi,%ecx
+  804826:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  80482a:	0f 49 de             	cmovns %esi,%ebx
+  80482d:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  804831:	ff 74 24 0c          	push   0xc(%esp)
+  804835:	ff 74 24 0c          	push   0xc(%esp)
+  804839:	e8 b5 fd ff ff       	call   8045f3 <udm>
+  80483e:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804842:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804846:	f7 d8                	neg    %eax
+  804848:	83 d2 00             	adc    $0x0,%edx
+  80484b:	f7 da                	neg    %edx
+  80484d:	83 c4 10             	add    $0x10,%esp
+  804850:	83 c4 24             	add    $0x24,%esp
+  804853:	5b                   	pop    %ebx
+  804854:	5e                   	pop    %esi
+  804855:	5f                   	pop    %edi
+  804856:	5d                   	pop    %ebp
+  804857:	c3                   	ret
@@ -0,0 +1,10426 @@
+
+obj/user/testpteshare.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 63 01 00 00       	call   800194 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <childofspawn>:
+	breakpoint();
+}
+
+void
+childofspawn(void)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	strcpy(VA, msg2);
+  800039:	ff 35 00 60 80 00    	push   0x806000
+  80003f:	68 00 00 00 a0       	push   $0xa0000000
+  800044:	e8 ad 08 00 00       	call   8008f6 <strcpy>
+	exit();
+  800049:	e8 c1 01 00 00       	call   80020f <exit>
+}
+  80004e:	83 c4 10             	add    $0x10,%esp
+  800051:	c9                   	leave
+  800052:	c3                   	ret
+
+00800053 <umain>:
+{
+  800053:	55                   	push   %ebp
+  800054:	89 e5                	mov    %esp,%ebp
+  800056:	53                   	push   %ebx
+  800057:	83 ec 04             	sub    $0x4,%esp
+	if (argc != 0)
+  80005a:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  80005e:	0f 85 d0 00 00 00    	jne    800134 <umain+0xe1>
+	if ((r = sys_page_alloc(0, VA, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  800064:	83 ec 04             	sub    $0x4,%esp
+  800067:	68 07 04 00 00       	push   $0x407
+  80006c:	68 00 00 00 a0       	push   $0xa0000000
+  800071:	6a 00                	push   $0x0
+  800073:	e8 bc 0c 00 00       	call   800d34 <sys_page_alloc>
+  800078:	83 c4 10             	add    $0x10,%esp
+  80007b:	85 c0                	test   %eax,%eax
+  80007d:	0f 88 bb 00 00 00    	js     80013e <umain+0xeb>
+	if ((r = fork()) < 0)
+  800083:	e8 68 13 00 00       	call   8013f0 <fork>
+  800088:	89 c3                	mov    %eax,%ebx
+  80008a:	85 c0                	test   %eax,%eax
+  80008c:	0f 88 be 00 00 00    	js     800150 <umain+0xfd>
+	if (r == 0) {
+  800092:	0f 84 ca 00 00 00    	je     800162 <umain+0x10f>
+	wait(r);
+  800098:	83 ec 0c             	sub    $0xc,%esp
+  80009b:	53                   	push   %ebx
+  80009c:	e8 78 3f 00 00       	call   804019 <wait>
+	cprintf("fork handles PTE_SHARE %s\n", strcmp(VA, msg) == 0 ? "right" : "wrong");
+  8000a1:	83 c4 08             	add    $0x8,%esp
+  8000a4:	ff 35 04 60 80 00    	push   0x806004
+  8000aa:	68 00 00 00 a0       	push   $0xa0000000
+  8000af:	e8 f3 08 00 00       	call   8009a7 <strcmp>
+  8000b4:	83 c4 08             	add    $0x8,%esp
+  8000b7:	85 c0                	test   %eax,%eax
+  8000b9:	b8 a6 4e 80 00       	mov    $0x804ea6,%eax
+  8000be:	ba a0 4e 80 00       	mov    $0x804ea0,%edx
+  8000c3:	0f 44 c2             	cmove  %edx,%eax
+  8000c6:	50                   	push   %eax
+  8000c7:	68 dc 4e 80 00       	push   $0x804edc
+  8000cc:	e8 41 02 00 00       	call   800312 <cprintf>
+	if ((r = spawnl("/testpteshare", "testpteshare", "arg", 0)) < 0)
+  8000d1:	6a 00                	push   $0x0
+  8000d3:	68 f7 4e 80 00       	push   $0x804ef7
+  8000d8:	68 fc 4e 80 00       	push   $0x804efc
+  8000dd:	68 fb 4e 80 00       	push   $0x804efb
+  8000e2:	e8 00 33 00 00       	call   8033e7 <spawnl>
+  8000e7:	83 c4 20             	add    $0x20,%esp
+  8000ea:	85 c0                	test   %eax,%eax
+  8000ec:	0f 88 90 00 00 00    	js     800182 <umain+0x12f>
+	wait(r);
+  8000f2:	83 ec 0c             	sub    $0xc,%esp
+  8000f5:	50                   	push   %eax
+  8000f6:	e8 1e 3f 00 00       	call   804019 <wait>
+	cprintf("spawn handles PTE_SHARE %s\n", strcmp(VA, msg2) == 0 ? "right" : "wrong");
+  8000fb:	83 c4 08             	add    $0x8,%esp
+  8000fe:	ff 35 00 60 80 00    	push   0x806000
+  800104:	68 00 00 00 a0       	push   $0xa0000000
+  800109:	e8 99 08 00 00       	call   8009a7 <strcmp>
+  80010e:	83 c4 08             	add    $0x8,%esp
+  800111:	85 c0                	test   %eax,%eax
+  800113:	b8 a6 4e 80 00       	mov    $0x804ea6,%eax
+  800118:	ba a0 4e 80 00       	mov    $0x804ea0,%edx
+  80011d:	0f 44 c2             	cmove  %edx,%eax
+  800120:	50                   	push   %eax
+  800121:	68 13 4f 80 00       	push   $0x804f13
+  800126:	e8 e7 01 00 00       	call   800312 <cprintf>
+#include <inc/types.h>
+
+static inline void
+breakpoint(void)
+{
+	asm volatile("int3");
+  80012b:	cc                   	int3
+}
+  80012c:	83 c4 10             	add    $0x10,%esp
+  80012f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800132:	c9                   	leave
+  800133:	c3                   	ret
+		childofspawn();
+  800134:	e8 fa fe ff ff       	call   800033 <childofspawn>
+  800139:	e9 26 ff ff ff       	jmp    800064 <umain+0x11>
+		panic("sys_page_alloc: %e", r);
+  80013e:	50                   	push   %eax
+  80013f:	68 ac 4e 80 00       	push   $0x804eac
+  800144:	6a 13                	push   $0x13
+  800146:	68 bf 4e 80 00       	push   $0x804ebf
+  80014b:	e8 e7 00 00 00       	call   800237 <_panic>
+		panic("fork: %e", r);
+  800150:	50                   	push   %eax
+  800151:	68 d3 4e 80 00       	push   $0x804ed3
+  800156:	6a 17                	push   $0x17
+  800158:	68 bf 4e 80 00       	push   $0x804ebf
+  80015d:	e8 d5 00 00 00       	call   800237 <_panic>
+		strcpy(VA, msg);
+  800162:	83 ec 08             	sub    $0x8,%esp
+  800165:	ff 35 04 60 80 00    	push   0x806004
+  80016b:	68 00 00 00 a0       	push   $0xa0000000
+  800170:	e8 81 07 00 00       	call   8008f6 <strcpy>
+		exit();
+  800175:	e8 95 00 00 00       	call   80020f <exit>
+  80017a:	83 c4 10             	add    $0x10,%esp
+  80017d:	e9 16 ff ff ff       	jmp    800098 <umain+0x45>
+		panic("spawn: %e", r);
+  800182:	50                   	push   %eax
+  800183:	68 09 4f 80 00       	push   $0x804f09
+  800188:	6a 21                	push   $0x21
+  80018a:	68 bf 4e 80 00       	push   $0x804ebf
+  80018f:	e8 a3 00 00 00       	call   800237 <_panic>
+
+00800194 <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800194:	55                   	push   %ebp
+  800195:	89 e5                	mov    %esp,%ebp
+  800197:	57                   	push   %edi
+  800198:	56                   	push   %esi
+  800199:	53                   	push   %ebx
+  80019a:	83 ec 1c             	sub    $0x1c,%esp
+  80019d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001a0:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  8001a3:	e8 34 0b 00 00       	call   800cdc <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  8001a8:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  8001ab:	89 15 c0 72 80 00    	mov    %edx,0x8072c0
+	thisenv = &envs[ENVX(eid)];
+  8001b1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001b6:	89 c1                	mov    %eax,%ecx
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  8001b8:	89 e7                	mov    %esp,%edi
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8001ba:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  8001c0:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8001c5:	77 16                	ja     8001dd <libmain+0x49>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8001c7:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8001cc:	29 f8                	sub    %edi,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  8001ce:	c1 e8 10             	shr    $0x10,%eax
+  8001d1:	74 0a                	je     8001dd <libmain+0x49>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8001d3:	c1 e0 10             	shl    $0x10,%eax
+  8001d6:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8001db:	29 c2                	sub    %eax,%edx
+  8001dd:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  8001e0:	c1 e0 04             	shl    $0x4,%eax
+  8001e3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001e8:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8001ea:	85 db                	test   %ebx,%ebx
+  8001ec:	7e 07                	jle    8001f5 <libmain+0x61>
+		binaryname = argv[0];
+  8001ee:	8b 06                	mov    (%esi),%eax
+  8001f0:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	// call user main routine
+	umain(argc, argv);
+  8001f5:	83 ec 08             	sub    $0x8,%esp
+  8001f8:	56                   	push   %esi
+  8001f9:	53                   	push   %ebx
+  8001fa:	e8 54 fe ff ff       	call   800053 <umain>
+
+	// exit gracefully
+	exit();
+  8001ff:	e8 0b 00 00 00       	call   80020f <exit>
+}
+  800204:	83 c4 10             	add    $0x10,%esp
+  800207:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80020a:	5b                   	pop    %ebx
+  80020b:	5e                   	pop    %esi
+  80020c:	5f                   	pop    %edi
+  80020d:	5d                   	pop    %ebp
+  80020e:	c3                   	ret
+
+0080020f <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80020f:	55                   	push   %ebp
+  800210:	89 e5                	mov    %esp,%ebp
+  800212:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  800215:	6a 00                	push   $0x0
+  800217:	e8 8b 27 00 00       	call   8029a7 <fflush>
+	pthread_kill_others();
+  80021c:	e8 64 44 00 00       	call   804685 <pthread_kill_others>
+	close_all();
+  800221:	e8 24 18 00 00       	call   801a4a <close_all>
+	sys_env_destroy(0);
+  800226:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80022d:	e8 5f 0a 00 00       	call   800c91 <sys_env_destroy>
+}
+  800232:	83 c4 10             	add    $0x10,%esp
+  800235:	c9                   	leave
+  800236:	c3                   	ret
+
+00800237 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800237:	55                   	push   %ebp
+  800238:	89 e5                	mov    %esp,%ebp
+  80023a:	56                   	push   %esi
+  80023b:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80023c:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80023f:	8b 35 08 60 80 00    	mov    0x806008,%esi
+  800245:	e8 92 0a 00 00       	call   800cdc <sys_getenvid>
+  80024a:	83 ec 0c             	sub    $0xc,%esp
+  80024d:	ff 75 0c             	push   0xc(%ebp)
+  800250:	ff 75 08             	push   0x8(%ebp)
+  800253:	56                   	push   %esi
+  800254:	50                   	push   %eax
+  800255:	68 58 4f 80 00       	push   $0x804f58
+  80025a:	e8 b3 00 00 00       	call   800312 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80025f:	83 c4 18             	add    $0x18,%esp
+  800262:	53                   	push   %ebx
+  800263:	ff 75 10             	push   0x10(%ebp)
+  800266:	e8 56 00 00 00       	call   8002c1 <vcprintf>
+	cprintf("\n");
+  80026b:	c7 04 24 5a 54 80 00 	movl   $0x80545a,(%esp)
+  800272:	e8 9b 00 00 00       	call   800312 <cprintf>
+  800277:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80027a:	cc                   	int3
+	while (1)
+  80027b:	eb fd                	jmp    80027a <_panic+0x43>
+
+0080027d <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80027d:	55                   	push   %ebp
+  80027e:	89 e5                	mov    %esp,%ebp
+  800280:	53                   	push   %ebx
+  800281:	83 ec 04             	sub    $0x4,%esp
+  800284:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800287:	8b 13                	mov    (%ebx),%edx
+  800289:	8d 42 01             	lea    0x1(%edx),%eax
+  80028c:	89 03                	mov    %eax,(%ebx)
+  80028e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800291:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800295:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80029a:	74 09                	je     8002a5 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80029c:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8002a0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8002a3:	c9                   	leave
+  8002a4:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8002a5:	83 ec 08             	sub    $0x8,%esp
+  8002a8:	68 ff 00 00 00       	push   $0xff
+  8002ad:	8d 43 08             	lea    0x8(%ebx),%eax
+  8002b0:	50                   	push   %eax
+  8002b1:	e8 84 09 00 00       	call   800c3a <sys_cputs>
+		b->idx = 0;
+  8002b6:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8002bc:	83 c4 10             	add    $0x10,%esp
+  8002bf:	eb db                	jmp    80029c <putch+0x1f>
+
+008002c1 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8002c1:	55                   	push   %ebp
+  8002c2:	89 e5                	mov    %esp,%ebp
+  8002c4:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8002ca:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002d1:	00 00 00 
+	b.cnt = 0;
+  8002d4:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8002db:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8002de:	ff 75 0c             	push   0xc(%ebp)
+  8002e1:	ff 75 08             	push   0x8(%ebp)
+  8002e4:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002ea:	50                   	push   %eax
+  8002eb:	68 7d 02 80 00       	push   $0x80027d
+  8002f0:	e8 14 01 00 00       	call   800409 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8002f5:	83 c4 08             	add    $0x8,%esp
+  8002f8:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002fe:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800304:	50                   	push   %eax
+  800305:	e8 30 09 00 00       	call   800c3a <sys_cputs>
+
+	return b.cnt;
+}
+  80030a:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800310:	c9                   	leave
+  800311:	c3                   	ret
+
+00800312 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800312:	55                   	push   %ebp
+  800313:	89 e5                	mov    %esp,%ebp
+  800315:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800318:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80031b:	50                   	push   %eax
+  80031c:	ff 75 08             	push   0x8(%ebp)
+  80031f:	e8 9d ff ff ff       	call   8002c1 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800324:	c9                   	leave
+  800325:	c3                   	ret
+
+00800326 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800326:	55                   	push   %ebp
+  800327:	89 e5                	mov    %esp,%ebp
+  800329:	57                   	push   %edi
+  80032a:	56                   	push   %esi
+  80032b:	53                   	push   %ebx
+  80032c:	83 ec 1c             	sub    $0x1c,%esp
+  80032f:	89 c7                	mov    %eax,%edi
+  800331:	89 d6                	mov    %edx,%esi
+  800333:	8b 45 08             	mov    0x8(%ebp),%eax
+  800336:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800339:	89 d1                	mov    %edx,%ecx
+  80033b:	89 c2                	mov    %eax,%edx
+  80033d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800340:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800343:	8b 45 10             	mov    0x10(%ebp),%eax
+  800346:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800349:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80034c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800353:	39 c2                	cmp    %eax,%edx
+  800355:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800358:	72 3e                	jb     800398 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80035a:	83 ec 0c             	sub    $0xc,%esp
+  80035d:	ff 75 18             	push   0x18(%ebp)
+  800360:	83 eb 01             	sub    $0x1,%ebx
+  800363:	53                   	push   %ebx
+  800364:	50                   	push   %eax
+  800365:	83 ec 08             	sub    $0x8,%esp
+  800368:	ff 75 e4             	push   -0x1c(%ebp)
+  80036b:	ff 75 e0             	push   -0x20(%ebp)
+  80036e:	ff 75 dc             	push   -0x24(%ebp)
+  800371:	ff 75 d8             	push   -0x28(%ebp)
+  800374:	e8 8f 49 00 00       	call   804d08 <__udivdi3>
+  800379:	83 c4 18             	add    $0x18,%esp
+  80037c:	52                   	push   %edx
+  80037d:	50                   	push   %eax
+  80037e:	89 f2                	mov    %esi,%edx
+  800380:	89 f8                	mov    %edi,%eax
+  800382:	e8 9f ff ff ff       	call   800326 <printnum>
+  800387:	83 c4 20             	add    $0x20,%esp
+  80038a:	eb 13                	jmp    80039f <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80038c:	83 ec 08             	sub    $0x8,%esp
+  80038f:	56                   	push   %esi
+  800390:	ff 75 18             	push   0x18(%ebp)
+  800393:	ff d7                	call   *%edi
+  800395:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800398:	83 eb 01             	sub    $0x1,%ebx
+  80039b:	85 db                	test   %ebx,%ebx
+  80039d:	7f ed                	jg     80038c <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80039f:	83 ec 08             	sub    $0x8,%esp
+  8003a2:	56                   	push   %esi
+  8003a3:	83 ec 04             	sub    $0x4,%esp
+  8003a6:	ff 75 e4             	push   -0x1c(%ebp)
+  8003a9:	ff 75 e0             	push   -0x20(%ebp)
+  8003ac:	ff 75 dc             	push   -0x24(%ebp)
+  8003af:	ff 75 d8             	push   -0x28(%ebp)
+  8003b2:	e8 72 49 00 00       	call   804d29 <__umoddi3>
+  8003b7:	83 c4 14             	add    $0x14,%esp
+  8003ba:	0f be 80 7b 4f 80 00 	movsbl 0x804f7b(%eax),%eax
+  8003c1:	50                   	push   %eax
+  8003c2:	ff d7                	call   *%edi
+}
+  8003c4:	83 c4 10             	add    $0x10,%esp
+  8003c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003ca:	5b                   	pop    %ebx
+  8003cb:	5e                   	pop    %esi
+  8003cc:	5f                   	pop    %edi
+  8003cd:	5d                   	pop    %ebp
+  8003ce:	c3                   	ret
+
+008003cf <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8003cf:	55                   	push   %ebp
+  8003d0:	89 e5                	mov    %esp,%ebp
+  8003d2:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8003d5:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8003d9:	8b 10                	mov    (%eax),%edx
+  8003db:	3b 50 04             	cmp    0x4(%eax),%edx
+  8003de:	73 0a                	jae    8003ea <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8003e0:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003e3:	89 08                	mov    %ecx,(%eax)
+  8003e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003e8:	88 02                	mov    %al,(%edx)
+}
+  8003ea:	5d                   	pop    %ebp
+  8003eb:	c3                   	ret
+
+008003ec <printfmt>:
+{
+  8003ec:	55                   	push   %ebp
+  8003ed:	89 e5                	mov    %esp,%ebp
+  8003ef:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8003f2:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8003f5:	50                   	push   %eax
+  8003f6:	ff 75 10             	push   0x10(%ebp)
+  8003f9:	ff 75 0c             	push   0xc(%ebp)
+  8003fc:	ff 75 08             	push   0x8(%ebp)
+  8003ff:	e8 05 00 00 00       	call   800409 <vprintfmt>
+}
+  800404:	83 c4 10             	add    $0x10,%esp
+  800407:	c9                   	leave
+  800408:	c3                   	ret
+
+00800409 <vprintfmt>:
+{
+  800409:	55                   	push   %ebp
+  80040a:	89 e5                	mov    %esp,%ebp
+  80040c:	57                   	push   %edi
+  80040d:	56                   	push   %esi
+  80040e:	53                   	push   %ebx
+  80040f:	83 ec 2c             	sub    $0x2c,%esp
+  800412:	8b 75 08             	mov    0x8(%ebp),%esi
+  800415:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800418:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80041b:	eb 0a                	jmp    800427 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80041d:	83 ec 08             	sub    $0x8,%esp
+  800420:	53                   	push   %ebx
+  800421:	50                   	push   %eax
+  800422:	ff d6                	call   *%esi
+  800424:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  800427:	83 c7 01             	add    $0x1,%edi
+  80042a:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  80042e:	83 f8 25             	cmp    $0x25,%eax
+  800431:	74 0c                	je     80043f <vprintfmt+0x36>
+			if (ch == '\0')
+  800433:	85 c0                	test   %eax,%eax
+  800435:	75 e6                	jne    80041d <vprintfmt+0x14>
+}
+  800437:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80043a:	5b                   	pop    %ebx
+  80043b:	5e                   	pop    %esi
+  80043c:	5f                   	pop    %edi
+  80043d:	5d                   	pop    %ebp
+  80043e:	c3                   	ret
+		padc = ' ';
+  80043f:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800443:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80044a:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800451:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800458:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  80045d:	8d 47 01             	lea    0x1(%edi),%eax
+  800460:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800463:	0f b6 17             	movzbl (%edi),%edx
+  800466:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800469:	3c 55                	cmp    $0x55,%al
+  80046b:	0f 87 c5 03 00 00    	ja     800836 <vprintfmt+0x42d>
+  800471:	0f b6 c0             	movzbl %al,%eax
+  800474:	ff 24 85 00 51 80 00 	jmp    *0x805100(,%eax,4)
+  80047b:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  80047e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800481:	eb da                	jmp    80045d <vprintfmt+0x54>
+  800483:	0f be d2             	movsbl %dl,%edx
+  800486:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800489:	b8 00 00 00 00       	mov    $0x0,%eax
+  80048e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800491:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800494:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800498:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80049b:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80049e:	83 f9 09             	cmp    $0x9,%ecx
+  8004a1:	77 55                	ja     8004f8 <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  8004a3:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8004a6:	eb e9                	jmp    800491 <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  8004a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ab:	8b 00                	mov    (%eax),%eax
+  8004ad:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004b3:	8d 40 04             	lea    0x4(%eax),%eax
+  8004b6:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  8004b9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8004bc:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004c0:	79 9b                	jns    80045d <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8004c2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004c5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004c8:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8004cf:	eb 8c                	jmp    80045d <vprintfmt+0x54>
+			if (width < 0)
+  8004d1:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004d4:	85 d2                	test   %edx,%edx
+  8004d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004db:	0f 49 c2             	cmovns %edx,%eax
+  8004de:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  8004e1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8004e4:	e9 74 ff ff ff       	jmp    80045d <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  8004e9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8004ec:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8004f3:	e9 65 ff ff ff       	jmp    80045d <vprintfmt+0x54>
+  8004f8:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004fb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004fe:	eb bc                	jmp    8004bc <vprintfmt+0xb3>
+			lflag++;
+  800500:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  800503:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800506:	e9 52 ff ff ff       	jmp    80045d <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80050b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80050e:	8d 78 04             	lea    0x4(%eax),%edi
+  800511:	83 ec 08             	sub    $0x8,%esp
+  800514:	53                   	push   %ebx
+  800515:	ff 30                	push   (%eax)
+  800517:	ff d6                	call   *%esi
+			break;
+  800519:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80051c:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80051f:	e9 b1 02 00 00       	jmp    8007d5 <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  800524:	8b 45 14             	mov    0x14(%ebp),%eax
+  800527:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80052a:	8b 10                	mov    (%eax),%edx
+  80052c:	89 d0                	mov    %edx,%eax
+  80052e:	f7 d8                	neg    %eax
+  800530:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800533:	83 f8 14             	cmp    $0x14,%eax
+  800536:	7f 23                	jg     80055b <vprintfmt+0x152>
+  800538:	8b 14 85 60 52 80 00 	mov    0x805260(,%eax,4),%edx
+  80053f:	85 d2                	test   %edx,%edx
+  800541:	74 18                	je     80055b <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  800543:	52                   	push   %edx
+  800544:	68 a3 54 80 00       	push   $0x8054a3
+  800549:	53                   	push   %ebx
+  80054a:	56                   	push   %esi
+  80054b:	e8 9c fe ff ff       	call   8003ec <printfmt>
+  800550:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800553:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800556:	e9 7a 02 00 00       	jmp    8007d5 <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  80055b:	50                   	push   %eax
+  80055c:	68 93 4f 80 00       	push   $0x804f93
+  800561:	53                   	push   %ebx
+  800562:	56                   	push   %esi
+  800563:	e8 84 fe ff ff       	call   8003ec <printfmt>
+  800568:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80056b:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80056e:	e9 62 02 00 00       	jmp    8007d5 <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800573:	8b 45 14             	mov    0x14(%ebp),%eax
+  800576:	83 c0 04             	add    $0x4,%eax
+  800579:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80057c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80057f:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800581:	85 c9                	test   %ecx,%ecx
+  800583:	b8 8c 4f 80 00       	mov    $0x804f8c,%eax
+  800588:	0f 45 c1             	cmovne %ecx,%eax
+  80058b:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80058e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800592:	7e 06                	jle    80059a <vprintfmt+0x191>
+  800594:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800598:	75 0b                	jne    8005a5 <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80059a:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80059d:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8005a0:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005a3:	eb 5c                	jmp    800601 <vprintfmt+0x1f8>
+  8005a5:	83 ec 08             	sub    $0x8,%esp
+  8005a8:	ff 75 d0             	push   -0x30(%ebp)
+  8005ab:	ff 75 cc             	push   -0x34(%ebp)
+  8005ae:	e8 20 03 00 00       	call   8008d3 <strnlen>
+  8005b3:	89 c2                	mov    %eax,%edx
+  8005b5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005b8:	29 d0                	sub    %edx,%eax
+  8005ba:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8005bd:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8005c1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005c4:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005c7:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005c9:	eb 0e                	jmp    8005d9 <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  8005cb:	83 ec 08             	sub    $0x8,%esp
+  8005ce:	53                   	push   %ebx
+  8005cf:	57                   	push   %edi
+  8005d0:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005d3:	83 ee 01             	sub    $0x1,%esi
+  8005d6:	83 c4 10             	add    $0x10,%esp
+  8005d9:	85 f6                	test   %esi,%esi
+  8005db:	7f ee                	jg     8005cb <vprintfmt+0x1c2>
+  8005dd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005e0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005e3:	85 c0                	test   %eax,%eax
+  8005e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005ea:	0f 49 d0             	cmovns %eax,%edx
+  8005ed:	29 d0                	sub    %edx,%eax
+  8005ef:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005f2:	eb a6                	jmp    80059a <vprintfmt+0x191>
+					putch(ch, putdat);
+  8005f4:	83 ec 08             	sub    $0x8,%esp
+  8005f7:	53                   	push   %ebx
+  8005f8:	52                   	push   %edx
+  8005f9:	ff 55 08             	call   *0x8(%ebp)
+  8005fc:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005ff:	89 f1                	mov    %esi,%ecx
+  800601:	8d 71 01             	lea    0x1(%ecx),%esi
+  800604:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800608:	0f be d0             	movsbl %al,%edx
+  80060b:	85 d2                	test   %edx,%edx
+  80060d:	74 28                	je     800637 <vprintfmt+0x22e>
+  80060f:	85 ff                	test   %edi,%edi
+  800611:	78 05                	js     800618 <vprintfmt+0x20f>
+  800613:	83 ef 01             	sub    $0x1,%edi
+  800616:	78 30                	js     800648 <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800618:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80061c:	74 d6                	je     8005f4 <vprintfmt+0x1eb>
+  80061e:	0f be c0             	movsbl %al,%eax
+  800621:	83 e8 20             	sub    $0x20,%eax
+  800624:	83 f8 5e             	cmp    $0x5e,%eax
+  800627:	76 cb                	jbe    8005f4 <vprintfmt+0x1eb>
+					putch('?', putdat);
+  800629:	83 ec 08             	sub    $0x8,%esp
+  80062c:	53                   	push   %ebx
+  80062d:	6a 3f                	push   $0x3f
+  80062f:	ff 55 08             	call   *0x8(%ebp)
+  800632:	83 c4 10             	add    $0x10,%esp
+  800635:	eb c8                	jmp    8005ff <vprintfmt+0x1f6>
+  800637:	8b 75 08             	mov    0x8(%ebp),%esi
+  80063a:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80063d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800640:	01 d0                	add    %edx,%eax
+  800642:	29 c8                	sub    %ecx,%eax
+  800644:	89 c7                	mov    %eax,%edi
+  800646:	eb 13                	jmp    80065b <vprintfmt+0x252>
+  800648:	8b 75 08             	mov    0x8(%ebp),%esi
+  80064b:	eb ed                	jmp    80063a <vprintfmt+0x231>
+				putch(' ', putdat);
+  80064d:	83 ec 08             	sub    $0x8,%esp
+  800650:	53                   	push   %ebx
+  800651:	6a 20                	push   $0x20
+  800653:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800655:	83 ef 01             	sub    $0x1,%edi
+  800658:	83 c4 10             	add    $0x10,%esp
+  80065b:	85 ff                	test   %edi,%edi
+  80065d:	7f ee                	jg     80064d <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80065f:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800662:	89 45 14             	mov    %eax,0x14(%ebp)
+  800665:	e9 6b 01 00 00       	jmp    8007d5 <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  80066a:	83 f9 01             	cmp    $0x1,%ecx
+  80066d:	7f 1f                	jg     80068e <vprintfmt+0x285>
+	else if (lflag)
+  80066f:	85 c9                	test   %ecx,%ecx
+  800671:	74 67                	je     8006da <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  800673:	8b 45 14             	mov    0x14(%ebp),%eax
+  800676:	8b 00                	mov    (%eax),%eax
+  800678:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80067b:	89 c1                	mov    %eax,%ecx
+  80067d:	c1 f9 1f             	sar    $0x1f,%ecx
+  800680:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800683:	8b 45 14             	mov    0x14(%ebp),%eax
+  800686:	8d 40 04             	lea    0x4(%eax),%eax
+  800689:	89 45 14             	mov    %eax,0x14(%ebp)
+  80068c:	eb 17                	jmp    8006a5 <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  80068e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800691:	8b 50 04             	mov    0x4(%eax),%edx
+  800694:	8b 00                	mov    (%eax),%eax
+  800696:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800699:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80069c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069f:	8d 40 08             	lea    0x8(%eax),%eax
+  8006a2:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8006a5:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006a8:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8006ab:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8006b0:	85 c9                	test   %ecx,%ecx
+  8006b2:	0f 89 03 01 00 00    	jns    8007bb <vprintfmt+0x3b2>
+				putch('-', putdat);
+  8006b8:	83 ec 08             	sub    $0x8,%esp
+  8006bb:	53                   	push   %ebx
+  8006bc:	6a 2d                	push   $0x2d
+  8006be:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8006c0:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006c3:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8006c6:	f7 da                	neg    %edx
+  8006c8:	83 d1 00             	adc    $0x0,%ecx
+  8006cb:	f7 d9                	neg    %ecx
+  8006cd:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8006d0:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8006d5:	e9 e1 00 00 00       	jmp    8007bb <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  8006da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006dd:	8b 00                	mov    (%eax),%eax
+  8006df:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006e2:	89 c1                	mov    %eax,%ecx
+  8006e4:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006e7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006ea:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ed:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006f3:	eb b0                	jmp    8006a5 <vprintfmt+0x29c>
+	if (lflag >= 2)
+  8006f5:	83 f9 01             	cmp    $0x1,%ecx
+  8006f8:	7f 1e                	jg     800718 <vprintfmt+0x30f>
+	else if (lflag)
+  8006fa:	85 c9                	test   %ecx,%ecx
+  8006fc:	74 32                	je     800730 <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  8006fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800701:	8b 10                	mov    (%eax),%edx
+  800703:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800708:	8d 40 04             	lea    0x4(%eax),%eax
+  80070b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80070e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800713:	e9 a3 00 00 00       	jmp    8007bb <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800718:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071b:	8b 10                	mov    (%eax),%edx
+  80071d:	8b 48 04             	mov    0x4(%eax),%ecx
+  800720:	8d 40 08             	lea    0x8(%eax),%eax
+  800723:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800726:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80072b:	e9 8b 00 00 00       	jmp    8007bb <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800730:	8b 45 14             	mov    0x14(%ebp),%eax
+  800733:	8b 10                	mov    (%eax),%edx
+  800735:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80073a:	8d 40 04             	lea    0x4(%eax),%eax
+  80073d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800740:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800745:	eb 74                	jmp    8007bb <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  800747:	83 f9 01             	cmp    $0x1,%ecx
+  80074a:	7f 1b                	jg     800767 <vprintfmt+0x35e>
+	else if (lflag)
+  80074c:	85 c9                	test   %ecx,%ecx
+  80074e:	74 2c                	je     80077c <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  800750:	8b 45 14             	mov    0x14(%ebp),%eax
+  800753:	8b 10                	mov    (%eax),%edx
+  800755:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80075a:	8d 40 04             	lea    0x4(%eax),%eax
+  80075d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800760:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800765:	eb 54                	jmp    8007bb <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800767:	8b 45 14             	mov    0x14(%ebp),%eax
+  80076a:	8b 10                	mov    (%eax),%edx
+  80076c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80076f:	8d 40 08             	lea    0x8(%eax),%eax
+  800772:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800775:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  80077a:	eb 3f                	jmp    8007bb <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  80077c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077f:	8b 10                	mov    (%eax),%edx
+  800781:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800786:	8d 40 04             	lea    0x4(%eax),%eax
+  800789:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80078c:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800791:	eb 28                	jmp    8007bb <vprintfmt+0x3b2>
+			putch('0', putdat);
+  800793:	83 ec 08             	sub    $0x8,%esp
+  800796:	53                   	push   %ebx
+  800797:	6a 30                	push   $0x30
+  800799:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80079b:	83 c4 08             	add    $0x8,%esp
+  80079e:	53                   	push   %ebx
+  80079f:	6a 78                	push   $0x78
+  8007a1:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8007a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a6:	8b 10                	mov    (%eax),%edx
+  8007a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8007ad:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8007b0:	8d 40 04             	lea    0x4(%eax),%eax
+  8007b3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007b6:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8007bb:	83 ec 0c             	sub    $0xc,%esp
+  8007be:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8007c2:	50                   	push   %eax
+  8007c3:	ff 75 e0             	push   -0x20(%ebp)
+  8007c6:	57                   	push   %edi
+  8007c7:	51                   	push   %ecx
+  8007c8:	52                   	push   %edx
+  8007c9:	89 da                	mov    %ebx,%edx
+  8007cb:	89 f0                	mov    %esi,%eax
+  8007cd:	e8 54 fb ff ff       	call   800326 <printnum>
+			break;
+  8007d2:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8007d5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  8007d8:	e9 4a fc ff ff       	jmp    800427 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8007dd:	83 f9 01             	cmp    $0x1,%ecx
+  8007e0:	7f 1b                	jg     8007fd <vprintfmt+0x3f4>
+	else if (lflag)
+  8007e2:	85 c9                	test   %ecx,%ecx
+  8007e4:	74 2c                	je     800812 <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  8007e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e9:	8b 10                	mov    (%eax),%edx
+  8007eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007f0:	8d 40 04             	lea    0x4(%eax),%eax
+  8007f3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007f6:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8007fb:	eb be                	jmp    8007bb <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8007fd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800800:	8b 10                	mov    (%eax),%edx
+  800802:	8b 48 04             	mov    0x4(%eax),%ecx
+  800805:	8d 40 08             	lea    0x8(%eax),%eax
+  800808:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80080b:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800810:	eb a9                	jmp    8007bb <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800812:	8b 45 14             	mov    0x14(%ebp),%eax
+  800815:	8b 10                	mov    (%eax),%edx
+  800817:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80081c:	8d 40 04             	lea    0x4(%eax),%eax
+  80081f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800822:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800827:	eb 92                	jmp    8007bb <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  800829:	83 ec 08             	sub    $0x8,%esp
+  80082c:	53                   	push   %ebx
+  80082d:	6a 25                	push   $0x25
+  80082f:	ff d6                	call   *%esi
+			break;
+  800831:	83 c4 10             	add    $0x10,%esp
+  800834:	eb 9f                	jmp    8007d5 <vprintfmt+0x3cc>
+			putch('%', putdat);
+  800836:	83 ec 08             	sub    $0x8,%esp
+  800839:	53                   	push   %ebx
+  80083a:	6a 25                	push   $0x25
+  80083c:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80083e:	83 c4 10             	add    $0x10,%esp
+  800841:	89 f8                	mov    %edi,%eax
+  800843:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800847:	74 05                	je     80084e <vprintfmt+0x445>
+  800849:	83 e8 01             	sub    $0x1,%eax
+  80084c:	eb f5                	jmp    800843 <vprintfmt+0x43a>
+  80084e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800851:	eb 82                	jmp    8007d5 <vprintfmt+0x3cc>
+
+00800853 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800853:	55                   	push   %ebp
+  800854:	89 e5                	mov    %esp,%ebp
+  800856:	83 ec 18             	sub    $0x18,%esp
+  800859:	8b 45 08             	mov    0x8(%ebp),%eax
+  80085c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80085f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800862:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800866:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800869:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800870:	85 c0                	test   %eax,%eax
+  800872:	74 26                	je     80089a <vsnprintf+0x47>
+  800874:	85 d2                	test   %edx,%edx
+  800876:	7e 22                	jle    80089a <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800878:	ff 75 14             	push   0x14(%ebp)
+  80087b:	ff 75 10             	push   0x10(%ebp)
+  80087e:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800881:	50                   	push   %eax
+  800882:	68 cf 03 80 00       	push   $0x8003cf
+  800887:	e8 7d fb ff ff       	call   800409 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80088c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80088f:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800892:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800895:	83 c4 10             	add    $0x10,%esp
+}
+  800898:	c9                   	leave
+  800899:	c3                   	ret
+		return -E_INVAL;
+  80089a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80089f:	eb f7                	jmp    800898 <vsnprintf+0x45>
+
+008008a1 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8008a1:	55                   	push   %ebp
+  8008a2:	89 e5                	mov    %esp,%ebp
+  8008a4:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8008a7:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8008aa:	50                   	push   %eax
+  8008ab:	ff 75 10             	push   0x10(%ebp)
+  8008ae:	ff 75 0c             	push   0xc(%ebp)
+  8008b1:	ff 75 08             	push   0x8(%ebp)
+  8008b4:	e8 9a ff ff ff       	call   800853 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8008b9:	c9                   	leave
+  8008ba:	c3                   	ret
+
+008008bb <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8008bb:	55                   	push   %ebp
+  8008bc:	89 e5                	mov    %esp,%ebp
+  8008be:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8008c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008c6:	eb 03                	jmp    8008cb <strlen+0x10>
+		n++;
+  8008c8:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8008cb:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008cf:	75 f7                	jne    8008c8 <strlen+0xd>
+	return n;
+}
+  8008d1:	5d                   	pop    %ebp
+  8008d2:	c3                   	ret
+
+008008d3 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8008d3:	55                   	push   %ebp
+  8008d4:	89 e5                	mov    %esp,%ebp
+  8008d6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008d9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008e1:	eb 03                	jmp    8008e6 <strnlen+0x13>
+		n++;
+  8008e3:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008e6:	39 d0                	cmp    %edx,%eax
+  8008e8:	74 08                	je     8008f2 <strnlen+0x1f>
+  8008ea:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008ee:	75 f3                	jne    8008e3 <strnlen+0x10>
+  8008f0:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8008f2:	89 d0                	mov    %edx,%eax
+  8008f4:	5d                   	pop    %ebp
+  8008f5:	c3                   	ret
+
+008008f6 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8008f6:	55                   	push   %ebp
+  8008f7:	89 e5                	mov    %esp,%ebp
+  8008f9:	53                   	push   %ebx
+  8008fa:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008fd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800900:	b8 00 00 00 00       	mov    $0x0,%eax
+  800905:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800909:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80090c:	83 c0 01             	add    $0x1,%eax
+  80090f:	84 d2                	test   %dl,%dl
+  800911:	75 f2                	jne    800905 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800913:	89 c8                	mov    %ecx,%eax
+  800915:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800918:	c9                   	leave
+  800919:	c3                   	ret
+
+0080091a <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80091a:	55                   	push   %ebp
+  80091b:	89 e5                	mov    %esp,%ebp
+  80091d:	53                   	push   %ebx
+  80091e:	83 ec 10             	sub    $0x10,%esp
+  800921:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800924:	53                   	push   %ebx
+  800925:	e8 91 ff ff ff       	call   8008bb <strlen>
+  80092a:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80092d:	ff 75 0c             	push   0xc(%ebp)
+  800930:	01 d8                	add    %ebx,%eax
+  800932:	50                   	push   %eax
+  800933:	e8 be ff ff ff       	call   8008f6 <strcpy>
+	return dst;
+}
+  800938:	89 d8                	mov    %ebx,%eax
+  80093a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80093d:	c9                   	leave
+  80093e:	c3                   	ret
+
+0080093f <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80093f:	55                   	push   %ebp
+  800940:	89 e5                	mov    %esp,%ebp
+  800942:	56                   	push   %esi
+  800943:	53                   	push   %ebx
+  800944:	8b 75 08             	mov    0x8(%ebp),%esi
+  800947:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80094a:	89 f3                	mov    %esi,%ebx
+  80094c:	03 5d 10             	add    0x10(%ebp),%ebx
+  80094f:	89 f0                	mov    %esi,%eax
+  800951:	eb 0f                	jmp    800962 <strncpy+0x23>
+		*dst++ = *src;
+  800953:	83 c0 01             	add    $0x1,%eax
+  800956:	0f b6 0a             	movzbl (%edx),%ecx
+  800959:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80095c:	80 f9 01             	cmp    $0x1,%cl
+  80095f:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800962:	39 d8                	cmp    %ebx,%eax
+  800964:	75 ed                	jne    800953 <strncpy+0x14>
+	}
+	return ret;
+}
+  800966:	89 f0                	mov    %esi,%eax
+  800968:	5b                   	pop    %ebx
+  800969:	5e                   	pop    %esi
+  80096a:	5d                   	pop    %ebp
+  80096b:	c3                   	ret
+
+0080096c <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80096c:	55                   	push   %ebp
+  80096d:	89 e5                	mov    %esp,%ebp
+  80096f:	56                   	push   %esi
+  800970:	53                   	push   %ebx
+  800971:	8b 75 08             	mov    0x8(%ebp),%esi
+  800974:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800977:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80097a:	89 f0                	mov    %esi,%eax
+  80097c:	85 d2                	test   %edx,%edx
+  80097e:	74 21                	je     8009a1 <strlcpy+0x35>
+  800980:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800984:	89 f2                	mov    %esi,%edx
+  800986:	eb 09                	jmp    800991 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800988:	83 c1 01             	add    $0x1,%ecx
+  80098b:	83 c2 01             	add    $0x1,%edx
+  80098e:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800991:	39 c2                	cmp    %eax,%edx
+  800993:	74 09                	je     80099e <strlcpy+0x32>
+  800995:	0f b6 19             	movzbl (%ecx),%ebx
+  800998:	84 db                	test   %bl,%bl
+  80099a:	75 ec                	jne    800988 <strlcpy+0x1c>
+  80099c:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80099e:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8009a1:	29 f0                	sub    %esi,%eax
+}
+  8009a3:	5b                   	pop    %ebx
+  8009a4:	5e                   	pop    %esi
+  8009a5:	5d                   	pop    %ebp
+  8009a6:	c3                   	ret
+
+008009a7 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8009a7:	55                   	push   %ebp
+  8009a8:	89 e5                	mov    %esp,%ebp
+  8009aa:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009ad:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8009b0:	eb 06                	jmp    8009b8 <strcmp+0x11>
+		p++, q++;
+  8009b2:	83 c1 01             	add    $0x1,%ecx
+  8009b5:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8009b8:	0f b6 01             	movzbl (%ecx),%eax
+  8009bb:	84 c0                	test   %al,%al
+  8009bd:	74 04                	je     8009c3 <strcmp+0x1c>
+  8009bf:	3a 02                	cmp    (%edx),%al
+  8009c1:	74 ef                	je     8009b2 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009c3:	0f b6 c0             	movzbl %al,%eax
+  8009c6:	0f b6 12             	movzbl (%edx),%edx
+  8009c9:	29 d0                	sub    %edx,%eax
+}
+  8009cb:	5d                   	pop    %ebp
+  8009cc:	c3                   	ret
+
+008009cd <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8009cd:	55                   	push   %ebp
+  8009ce:	89 e5                	mov    %esp,%ebp
+  8009d0:	53                   	push   %ebx
+  8009d1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009d4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009d7:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8009da:	eb 09                	jmp    8009e5 <strncmp+0x18>
+		n--, p++, q++;
+  8009dc:	83 ea 01             	sub    $0x1,%edx
+  8009df:	83 c0 01             	add    $0x1,%eax
+  8009e2:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8009e5:	85 d2                	test   %edx,%edx
+  8009e7:	74 18                	je     800a01 <strncmp+0x34>
+  8009e9:	0f b6 18             	movzbl (%eax),%ebx
+  8009ec:	84 db                	test   %bl,%bl
+  8009ee:	74 04                	je     8009f4 <strncmp+0x27>
+  8009f0:	3a 19                	cmp    (%ecx),%bl
+  8009f2:	74 e8                	je     8009dc <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009f4:	0f b6 00             	movzbl (%eax),%eax
+  8009f7:	0f b6 11             	movzbl (%ecx),%edx
+  8009fa:	29 d0                	sub    %edx,%eax
+}
+  8009fc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009ff:	c9                   	leave
+  800a00:	c3                   	ret
+		return 0;
+  800a01:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a06:	eb f4                	jmp    8009fc <strncmp+0x2f>
+
+00800a08 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a08:	55                   	push   %ebp
+  800a09:	89 e5                	mov    %esp,%ebp
+  800a0b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a0e:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a12:	eb 03                	jmp    800a17 <strchr+0xf>
+  800a14:	83 c0 01             	add    $0x1,%eax
+  800a17:	0f b6 10             	movzbl (%eax),%edx
+  800a1a:	84 d2                	test   %dl,%dl
+  800a1c:	74 06                	je     800a24 <strchr+0x1c>
+		if (*s == c)
+  800a1e:	38 ca                	cmp    %cl,%dl
+  800a20:	75 f2                	jne    800a14 <strchr+0xc>
+  800a22:	eb 05                	jmp    800a29 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800a24:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a29:	5d                   	pop    %ebp
+  800a2a:	c3                   	ret
+
+00800a2b <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a2b:	55                   	push   %ebp
+  800a2c:	89 e5                	mov    %esp,%ebp
+  800a2e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a31:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a35:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a38:	38 ca                	cmp    %cl,%dl
+  800a3a:	74 09                	je     800a45 <strfind+0x1a>
+  800a3c:	84 d2                	test   %dl,%dl
+  800a3e:	74 05                	je     800a45 <strfind+0x1a>
+	for (; *s; s++)
+  800a40:	83 c0 01             	add    $0x1,%eax
+  800a43:	eb f0                	jmp    800a35 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a45:	5d                   	pop    %ebp
+  800a46:	c3                   	ret
+
+00800a47 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a47:	55                   	push   %ebp
+  800a48:	89 e5                	mov    %esp,%ebp
+  800a4a:	57                   	push   %edi
+  800a4b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a4e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a51:	85 c9                	test   %ecx,%ecx
+  800a53:	74 20                	je     800a75 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a55:	89 f8                	mov    %edi,%eax
+  800a57:	09 c8                	or     %ecx,%eax
+  800a59:	a8 03                	test   $0x3,%al
+  800a5b:	75 12                	jne    800a6f <memset+0x28>
+		c &= 0xFF;
+  800a5d:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a61:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a67:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a6a:	fc                   	cld
+  800a6b:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a6d:	eb 06                	jmp    800a75 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a6f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a72:	fc                   	cld
+  800a73:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a75:	89 f8                	mov    %edi,%eax
+  800a77:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a7a:	c9                   	leave
+  800a7b:	c3                   	ret
+
+00800a7c <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a7c:	55                   	push   %ebp
+  800a7d:	89 e5                	mov    %esp,%ebp
+  800a7f:	57                   	push   %edi
+  800a80:	56                   	push   %esi
+  800a81:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a84:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a87:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a8a:	39 c6                	cmp    %eax,%esi
+  800a8c:	73 32                	jae    800ac0 <memmove+0x44>
+  800a8e:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a91:	39 d0                	cmp    %edx,%eax
+  800a93:	73 2b                	jae    800ac0 <memmove+0x44>
+		s += n;
+		d += n;
+  800a95:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a98:	89 d6                	mov    %edx,%esi
+  800a9a:	09 fe                	or     %edi,%esi
+  800a9c:	09 ce                	or     %ecx,%esi
+  800a9e:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800aa4:	75 0e                	jne    800ab4 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800aa6:	83 ef 04             	sub    $0x4,%edi
+  800aa9:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800aac:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800aaf:	fd                   	std
+  800ab0:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ab2:	eb 09                	jmp    800abd <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800ab4:	83 ef 01             	sub    $0x1,%edi
+  800ab7:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800aba:	fd                   	std
+  800abb:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800abd:	fc                   	cld
+  800abe:	eb 1a                	jmp    800ada <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ac0:	89 f2                	mov    %esi,%edx
+  800ac2:	09 c2                	or     %eax,%edx
+  800ac4:	09 ca                	or     %ecx,%edx
+  800ac6:	f6 c2 03             	test   $0x3,%dl
+  800ac9:	75 0a                	jne    800ad5 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800acb:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800ace:	89 c7                	mov    %eax,%edi
+  800ad0:	fc                   	cld
+  800ad1:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ad3:	eb 05                	jmp    800ada <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800ad5:	89 c7                	mov    %eax,%edi
+  800ad7:	fc                   	cld
+  800ad8:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800ada:	5e                   	pop    %esi
+  800adb:	5f                   	pop    %edi
+  800adc:	5d                   	pop    %ebp
+  800add:	c3                   	ret
+
+00800ade <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800ade:	55                   	push   %ebp
+  800adf:	89 e5                	mov    %esp,%ebp
+  800ae1:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800ae4:	ff 75 10             	push   0x10(%ebp)
+  800ae7:	ff 75 0c             	push   0xc(%ebp)
+  800aea:	ff 75 08             	push   0x8(%ebp)
+  800aed:	e8 8a ff ff ff       	call   800a7c <memmove>
+}
+  800af2:	c9                   	leave
+  800af3:	c3                   	ret
+
+00800af4 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800af4:	55                   	push   %ebp
+  800af5:	89 e5                	mov    %esp,%ebp
+  800af7:	56                   	push   %esi
+  800af8:	53                   	push   %ebx
+  800af9:	8b 45 08             	mov    0x8(%ebp),%eax
+  800afc:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800aff:	89 c6                	mov    %eax,%esi
+  800b01:	03 75 10             	add    0x10(%ebp),%esi
+  800b04:	eb 06                	jmp    800b0c <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b06:	83 c0 01             	add    $0x1,%eax
+  800b09:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b0c:	39 f0                	cmp    %esi,%eax
+  800b0e:	74 14                	je     800b24 <memcmp+0x30>
+		if (*s1 != *s2)
+  800b10:	0f b6 08             	movzbl (%eax),%ecx
+  800b13:	0f b6 1a             	movzbl (%edx),%ebx
+  800b16:	38 d9                	cmp    %bl,%cl
+  800b18:	74 ec                	je     800b06 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800b1a:	0f b6 c1             	movzbl %cl,%eax
+  800b1d:	0f b6 db             	movzbl %bl,%ebx
+  800b20:	29 d8                	sub    %ebx,%eax
+  800b22:	eb 05                	jmp    800b29 <memcmp+0x35>
+	}
+
+	return 0;
+  800b24:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b29:	5b                   	pop    %ebx
+  800b2a:	5e                   	pop    %esi
+  800b2b:	5d                   	pop    %ebp
+  800b2c:	c3                   	ret
+
+00800b2d <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b2d:	55                   	push   %ebp
+  800b2e:	89 e5                	mov    %esp,%ebp
+  800b30:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b33:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b36:	89 c2                	mov    %eax,%edx
+  800b38:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b3b:	eb 03                	jmp    800b40 <memfind+0x13>
+  800b3d:	83 c0 01             	add    $0x1,%eax
+  800b40:	39 d0                	cmp    %edx,%eax
+  800b42:	73 04                	jae    800b48 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b44:	38 08                	cmp    %cl,(%eax)
+  800b46:	75 f5                	jne    800b3d <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b48:	5d                   	pop    %ebp
+  800b49:	c3                   	ret
+
+00800b4a <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b4a:	55                   	push   %ebp
+  800b4b:	89 e5                	mov    %esp,%ebp
+  800b4d:	57                   	push   %edi
+  800b4e:	56                   	push   %esi
+  800b4f:	53                   	push   %ebx
+  800b50:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b53:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b56:	eb 03                	jmp    800b5b <strtol+0x11>
+		s++;
+  800b58:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800b5b:	0f b6 02             	movzbl (%edx),%eax
+  800b5e:	3c 20                	cmp    $0x20,%al
+  800b60:	74 f6                	je     800b58 <strtol+0xe>
+  800b62:	3c 09                	cmp    $0x9,%al
+  800b64:	74 f2                	je     800b58 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b66:	3c 2b                	cmp    $0x2b,%al
+  800b68:	74 2a                	je     800b94 <strtol+0x4a>
+	int neg = 0;
+  800b6a:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800b6f:	3c 2d                	cmp    $0x2d,%al
+  800b71:	74 2b                	je     800b9e <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b73:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b79:	75 0f                	jne    800b8a <strtol+0x40>
+  800b7b:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b7e:	74 28                	je     800ba8 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b80:	85 db                	test   %ebx,%ebx
+  800b82:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b87:	0f 44 d8             	cmove  %eax,%ebx
+  800b8a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b8f:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b92:	eb 46                	jmp    800bda <strtol+0x90>
+		s++;
+  800b94:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800b97:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b9c:	eb d5                	jmp    800b73 <strtol+0x29>
+		s++, neg = 1;
+  800b9e:	83 c2 01             	add    $0x1,%edx
+  800ba1:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ba6:	eb cb                	jmp    800b73 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ba8:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800bac:	74 0e                	je     800bbc <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800bae:	85 db                	test   %ebx,%ebx
+  800bb0:	75 d8                	jne    800b8a <strtol+0x40>
+		s++, base = 8;
+  800bb2:	83 c2 01             	add    $0x1,%edx
+  800bb5:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800bba:	eb ce                	jmp    800b8a <strtol+0x40>
+		s += 2, base = 16;
+  800bbc:	83 c2 02             	add    $0x2,%edx
+  800bbf:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800bc4:	eb c4                	jmp    800b8a <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800bc6:	0f be c0             	movsbl %al,%eax
+  800bc9:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800bcc:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800bcf:	7d 3a                	jge    800c0b <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800bd1:	83 c2 01             	add    $0x1,%edx
+  800bd4:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800bd8:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800bda:	0f b6 02             	movzbl (%edx),%eax
+  800bdd:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800be0:	89 f3                	mov    %esi,%ebx
+  800be2:	80 fb 09             	cmp    $0x9,%bl
+  800be5:	76 df                	jbe    800bc6 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800be7:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800bea:	89 f3                	mov    %esi,%ebx
+  800bec:	80 fb 19             	cmp    $0x19,%bl
+  800bef:	77 08                	ja     800bf9 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800bf1:	0f be c0             	movsbl %al,%eax
+  800bf4:	83 e8 57             	sub    $0x57,%eax
+  800bf7:	eb d3                	jmp    800bcc <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800bf9:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800bfc:	89 f3                	mov    %esi,%ebx
+  800bfe:	80 fb 19             	cmp    $0x19,%bl
+  800c01:	77 08                	ja     800c0b <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800c03:	0f be c0             	movsbl %al,%eax
+  800c06:	83 e8 37             	sub    $0x37,%eax
+  800c09:	eb c1                	jmp    800bcc <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c0b:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c0f:	74 05                	je     800c16 <strtol+0xcc>
+		*endptr = (char *) s;
+  800c11:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c14:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800c16:	89 c8                	mov    %ecx,%eax
+  800c18:	f7 d8                	neg    %eax
+  800c1a:	85 ff                	test   %edi,%edi
+  800c1c:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800c1f:	89 c8                	mov    %ecx,%eax
+  800c21:	5b                   	pop    %ebx
+  800c22:	5e                   	pop    %esi
+  800c23:	5f                   	pop    %edi
+  800c24:	5d                   	pop    %ebp
+  800c25:	c3                   	ret
+
+00800c26 <atoi>:
+
+int
+atoi(const char* s)
+{
+  800c26:	55                   	push   %ebp
+  800c27:	89 e5                	mov    %esp,%ebp
+  800c29:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  800c2c:	6a 00                	push   $0x0
+  800c2e:	6a 00                	push   $0x0
+  800c30:	ff 75 08             	push   0x8(%ebp)
+  800c33:	e8 12 ff ff ff       	call   800b4a <strtol>
+}
+  800c38:	c9                   	leave
+  800c39:	c3                   	ret
+
+00800c3a <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c3a:	55                   	push   %ebp
+  800c3b:	89 e5                	mov    %esp,%ebp
+  800c3d:	57                   	push   %edi
+  800c3e:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c44:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c47:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c4a:	89 c3                	mov    %eax,%ebx
+  800c4c:	89 c7                	mov    %eax,%edi
+  800c4e:	6a 00                	push   $0x0
+  800c50:	55                   	push   %ebp
+  800c51:	56                   	push   %esi
+  800c52:	89 e5                	mov    %esp,%ebp
+  800c54:	8d 35 5c 0c 80 00    	lea    0x800c5c,%esi
+  800c5a:	0f 34                	sysenter
+
+00800c5c <after_sysenter_label_47>:
+  800c5c:	5e                   	pop    %esi
+  800c5d:	5d                   	pop    %ebp
+  800c5e:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c61:	5b                   	pop    %ebx
+  800c62:	5f                   	pop    %edi
+  800c63:	5d                   	pop    %ebp
+  800c64:	c3                   	ret
+
+00800c65 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c65:	55                   	push   %ebp
+  800c66:	89 e5                	mov    %esp,%ebp
+  800c68:	57                   	push   %edi
+  800c69:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c6a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c6f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c74:	89 d1                	mov    %edx,%ecx
+  800c76:	89 d3                	mov    %edx,%ebx
+  800c78:	89 d7                	mov    %edx,%edi
+  800c7a:	6a 00                	push   $0x0
+  800c7c:	55                   	push   %ebp
+  800c7d:	56                   	push   %esi
+  800c7e:	89 e5                	mov    %esp,%ebp
+  800c80:	8d 35 88 0c 80 00    	lea    0x800c88,%esi
+  800c86:	0f 34                	sysenter
+
+00800c88 <after_sysenter_label_128>:
+  800c88:	5e                   	pop    %esi
+  800c89:	5d                   	pop    %ebp
+  800c8a:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c8d:	5b                   	pop    %ebx
+  800c8e:	5f                   	pop    %edi
+  800c8f:	5d                   	pop    %ebp
+  800c90:	c3                   	ret
+
+00800c91 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c91:	55                   	push   %ebp
+  800c92:	89 e5                	mov    %esp,%ebp
+  800c94:	57                   	push   %edi
+  800c95:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c96:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c99:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c9e:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ca3:	89 cb                	mov    %ecx,%ebx
+  800ca5:	89 cf                	mov    %ecx,%edi
+  800ca7:	6a 00                	push   $0x0
+  800ca9:	55                   	push   %ebp
+  800caa:	56                   	push   %esi
+  800cab:	89 e5                	mov    %esp,%ebp
+  800cad:	8d 35 b5 0c 80 00    	lea    0x800cb5,%esi
+  800cb3:	0f 34                	sysenter
+
+00800cb5 <after_sysenter_label_212>:
+  800cb5:	5e                   	pop    %esi
+  800cb6:	5d                   	pop    %ebp
+  800cb7:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800cba:	85 c0                	test   %eax,%eax
+  800cbc:	7f 07                	jg     800cc5 <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800cbe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800cc1:	5b                   	pop    %ebx
+  800cc2:	5f                   	pop    %edi
+  800cc3:	5d                   	pop    %ebp
+  800cc4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cc5:	83 ec 0c             	sub    $0xc,%esp
+  800cc8:	50                   	push   %eax
+  800cc9:	6a 03                	push   $0x3
+  800ccb:	68 f5 52 80 00       	push   $0x8052f5
+  800cd0:	6a 54                	push   $0x54
+  800cd2:	68 12 53 80 00       	push   $0x805312
+  800cd7:	e8 5b f5 ff ff       	call   800237 <_panic>
+
+00800cdc <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800cdc:	55                   	push   %ebp
+  800cdd:	89 e5                	mov    %esp,%ebp
+  800cdf:	57                   	push   %edi
+  800ce0:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ce1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ce6:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ceb:	89 d1                	mov    %edx,%ecx
+  800ced:	89 d3                	mov    %edx,%ebx
+  800cef:	89 d7                	mov    %edx,%edi
+  800cf1:	6a 00                	push   $0x0
+  800cf3:	55                   	push   %ebp
+  800cf4:	56                   	push   %esi
+  800cf5:	89 e5                	mov    %esp,%ebp
+  800cf7:	8d 35 ff 0c 80 00    	lea    0x800cff,%esi
+  800cfd:	0f 34                	sysenter
+
+00800cff <after_sysenter_label_309>:
+  800cff:	5e                   	pop    %esi
+  800d00:	5d                   	pop    %ebp
+  800d01:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800d04:	5b                   	pop    %ebx
+  800d05:	5f                   	pop    %edi
+  800d06:	5d                   	pop    %ebp
+  800d07:	c3                   	ret
+
+00800d08 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800d08:	55                   	push   %ebp
+  800d09:	89 e5                	mov    %esp,%ebp
+  800d0b:	57                   	push   %edi
+  800d0c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d0d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d12:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d17:	89 d1                	mov    %edx,%ecx
+  800d19:	89 d3                	mov    %edx,%ebx
+  800d1b:	89 d7                	mov    %edx,%edi
+  800d1d:	6a 00                	push   $0x0
+  800d1f:	55                   	push   %ebp
+  800d20:	56                   	push   %esi
+  800d21:	89 e5                	mov    %esp,%ebp
+  800d23:	8d 35 2b 0d 80 00    	lea    0x800d2b,%esi
+  800d29:	0f 34                	sysenter
+
+00800d2b <after_sysenter_label_391>:
+  800d2b:	5e                   	pop    %esi
+  800d2c:	5d                   	pop    %ebp
+  800d2d:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d30:	5b                   	pop    %ebx
+  800d31:	5f                   	pop    %edi
+  800d32:	5d                   	pop    %ebp
+  800d33:	c3                   	ret
+
+00800d34 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d34:	55                   	push   %ebp
+  800d35:	89 e5                	mov    %esp,%ebp
+  800d37:	57                   	push   %edi
+  800d38:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d39:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d3c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d3f:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d44:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d49:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d4c:	6a 00                	push   $0x0
+  800d4e:	55                   	push   %ebp
+  800d4f:	56                   	push   %esi
+  800d50:	89 e5                	mov    %esp,%ebp
+  800d52:	8d 35 5a 0d 80 00    	lea    0x800d5a,%esi
+  800d58:	0f 34                	sysenter
+
+00800d5a <after_sysenter_label_479>:
+  800d5a:	5e                   	pop    %esi
+  800d5b:	5d                   	pop    %ebp
+  800d5c:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d5f:	85 c0                	test   %eax,%eax
+  800d61:	7f 07                	jg     800d6a <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d63:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d66:	5b                   	pop    %ebx
+  800d67:	5f                   	pop    %edi
+  800d68:	5d                   	pop    %ebp
+  800d69:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d6a:	83 ec 0c             	sub    $0xc,%esp
+  800d6d:	50                   	push   %eax
+  800d6e:	6a 04                	push   $0x4
+  800d70:	68 f5 52 80 00       	push   $0x8052f5
+  800d75:	6a 54                	push   $0x54
+  800d77:	68 12 53 80 00       	push   $0x805312
+  800d7c:	e8 b6 f4 ff ff       	call   800237 <_panic>
+
+00800d81 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d81:	55                   	push   %ebp
+  800d82:	89 e5                	mov    %esp,%ebp
+  800d84:	57                   	push   %edi
+  800d85:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d86:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d89:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d8c:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d91:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d94:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d97:	ff 75 18             	push   0x18(%ebp)
+  800d9a:	55                   	push   %ebp
+  800d9b:	56                   	push   %esi
+  800d9c:	89 e5                	mov    %esp,%ebp
+  800d9e:	8d 35 a6 0d 80 00    	lea    0x800da6,%esi
+  800da4:	0f 34                	sysenter
+
+00800da6 <after_sysenter_label_593>:
+  800da6:	5e                   	pop    %esi
+  800da7:	5d                   	pop    %ebp
+  800da8:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800dab:	85 c0                	test   %eax,%eax
+  800dad:	7f 07                	jg     800db6 <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800daf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800db2:	5b                   	pop    %ebx
+  800db3:	5f                   	pop    %edi
+  800db4:	5d                   	pop    %ebp
+  800db5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800db6:	83 ec 0c             	sub    $0xc,%esp
+  800db9:	50                   	push   %eax
+  800dba:	6a 05                	push   $0x5
+  800dbc:	68 f5 52 80 00       	push   $0x8052f5
+  800dc1:	6a 54                	push   $0x54
+  800dc3:	68 12 53 80 00       	push   $0x805312
+  800dc8:	e8 6a f4 ff ff       	call   800237 <_panic>
+
+00800dcd <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800dcd:	55                   	push   %ebp
+  800dce:	89 e5                	mov    %esp,%ebp
+  800dd0:	57                   	push   %edi
+  800dd1:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800dd2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dd7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dda:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ddd:	b8 06 00 00 00       	mov    $0x6,%eax
+  800de2:	89 df                	mov    %ebx,%edi
+  800de4:	6a 00                	push   $0x0
+  800de6:	55                   	push   %ebp
+  800de7:	56                   	push   %esi
+  800de8:	89 e5                	mov    %esp,%ebp
+  800dea:	8d 35 f2 0d 80 00    	lea    0x800df2,%esi
+  800df0:	0f 34                	sysenter
+
+00800df2 <after_sysenter_label_704>:
+  800df2:	5e                   	pop    %esi
+  800df3:	5d                   	pop    %ebp
+  800df4:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800df7:	85 c0                	test   %eax,%eax
+  800df9:	7f 07                	jg     800e02 <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800dfb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800dfe:	5b                   	pop    %ebx
+  800dff:	5f                   	pop    %edi
+  800e00:	5d                   	pop    %ebp
+  800e01:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e02:	83 ec 0c             	sub    $0xc,%esp
+  800e05:	50                   	push   %eax
+  800e06:	6a 06                	push   $0x6
+  800e08:	68 f5 52 80 00       	push   $0x8052f5
+  800e0d:	6a 54                	push   $0x54
+  800e0f:	68 12 53 80 00       	push   $0x805312
+  800e14:	e8 1e f4 ff ff       	call   800237 <_panic>
+
+00800e19 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e19:	55                   	push   %ebp
+  800e1a:	89 e5                	mov    %esp,%ebp
+  800e1c:	57                   	push   %edi
+  800e1d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e1e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e23:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e26:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e29:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e2e:	89 df                	mov    %ebx,%edi
+  800e30:	6a 00                	push   $0x0
+  800e32:	55                   	push   %ebp
+  800e33:	56                   	push   %esi
+  800e34:	89 e5                	mov    %esp,%ebp
+  800e36:	8d 35 3e 0e 80 00    	lea    0x800e3e,%esi
+  800e3c:	0f 34                	sysenter
+
+00800e3e <after_sysenter_label_808>:
+  800e3e:	5e                   	pop    %esi
+  800e3f:	5d                   	pop    %ebp
+  800e40:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e43:	85 c0                	test   %eax,%eax
+  800e45:	7f 07                	jg     800e4e <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800e47:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e4a:	5b                   	pop    %ebx
+  800e4b:	5f                   	pop    %edi
+  800e4c:	5d                   	pop    %ebp
+  800e4d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e4e:	83 ec 0c             	sub    $0xc,%esp
+  800e51:	50                   	push   %eax
+  800e52:	6a 08                	push   $0x8
+  800e54:	68 f5 52 80 00       	push   $0x8052f5
+  800e59:	6a 54                	push   $0x54
+  800e5b:	68 12 53 80 00       	push   $0x805312
+  800e60:	e8 d2 f3 ff ff       	call   800237 <_panic>
+
+00800e65 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800e65:	55                   	push   %ebp
+  800e66:	89 e5                	mov    %esp,%ebp
+  800e68:	57                   	push   %edi
+  800e69:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e6a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e6f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e72:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e75:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e7a:	89 df                	mov    %ebx,%edi
+  800e7c:	6a 00                	push   $0x0
+  800e7e:	55                   	push   %ebp
+  800e7f:	56                   	push   %esi
+  800e80:	89 e5                	mov    %esp,%ebp
+  800e82:	8d 35 8a 0e 80 00    	lea    0x800e8a,%esi
+  800e88:	0f 34                	sysenter
+
+00800e8a <after_sysenter_label_912>:
+  800e8a:	5e                   	pop    %esi
+  800e8b:	5d                   	pop    %ebp
+  800e8c:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e8f:	85 c0                	test   %eax,%eax
+  800e91:	7f 07                	jg     800e9a <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800e93:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e96:	5b                   	pop    %ebx
+  800e97:	5f                   	pop    %edi
+  800e98:	5d                   	pop    %ebp
+  800e99:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e9a:	83 ec 0c             	sub    $0xc,%esp
+  800e9d:	50                   	push   %eax
+  800e9e:	6a 09                	push   $0x9
+  800ea0:	68 f5 52 80 00       	push   $0x8052f5
+  800ea5:	6a 54                	push   $0x54
+  800ea7:	68 12 53 80 00       	push   $0x805312
+  800eac:	e8 86 f3 ff ff       	call   800237 <_panic>
+
+00800eb1 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800eb1:	55                   	push   %ebp
+  800eb2:	89 e5                	mov    %esp,%ebp
+  800eb4:	57                   	push   %edi
+  800eb5:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800eb6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ebb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ebe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec1:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ec6:	89 df                	mov    %ebx,%edi
+  800ec8:	6a 00                	push   $0x0
+  800eca:	55                   	push   %ebp
+  800ecb:	56                   	push   %esi
+  800ecc:	89 e5                	mov    %esp,%ebp
+  800ece:	8d 35 d6 0e 80 00    	lea    0x800ed6,%esi
+  800ed4:	0f 34                	sysenter
+
+00800ed6 <after_sysenter_label_1016>:
+  800ed6:	5e                   	pop    %esi
+  800ed7:	5d                   	pop    %ebp
+  800ed8:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800edb:	85 c0                	test   %eax,%eax
+  800edd:	7f 07                	jg     800ee6 <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800edf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ee2:	5b                   	pop    %ebx
+  800ee3:	5f                   	pop    %edi
+  800ee4:	5d                   	pop    %ebp
+  800ee5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ee6:	83 ec 0c             	sub    $0xc,%esp
+  800ee9:	50                   	push   %eax
+  800eea:	6a 0a                	push   $0xa
+  800eec:	68 f5 52 80 00       	push   $0x8052f5
+  800ef1:	6a 54                	push   $0x54
+  800ef3:	68 12 53 80 00       	push   $0x805312
+  800ef8:	e8 3a f3 ff ff       	call   800237 <_panic>
+
+00800efd <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800efd:	55                   	push   %ebp
+  800efe:	89 e5                	mov    %esp,%ebp
+  800f00:	57                   	push   %edi
+  800f01:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f02:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f05:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f08:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f0d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f10:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f13:	6a 00                	push   $0x0
+  800f15:	55                   	push   %ebp
+  800f16:	56                   	push   %esi
+  800f17:	89 e5                	mov    %esp,%ebp
+  800f19:	8d 35 21 0f 80 00    	lea    0x800f21,%esi
+  800f1f:	0f 34                	sysenter
+
+00800f21 <after_sysenter_label_1126>:
+  800f21:	5e                   	pop    %esi
+  800f22:	5d                   	pop    %ebp
+  800f23:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800f26:	5b                   	pop    %ebx
+  800f27:	5f                   	pop    %edi
+  800f28:	5d                   	pop    %ebp
+  800f29:	c3                   	ret
+
+00800f2a <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800f2a:	55                   	push   %ebp
+  800f2b:	89 e5                	mov    %esp,%ebp
+  800f2d:	57                   	push   %edi
+  800f2e:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f2f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f32:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f37:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f3c:	89 cb                	mov    %ecx,%ebx
+  800f3e:	89 cf                	mov    %ecx,%edi
+  800f40:	6a 00                	push   $0x0
+  800f42:	55                   	push   %ebp
+  800f43:	56                   	push   %esi
+  800f44:	89 e5                	mov    %esp,%ebp
+  800f46:	8d 35 4e 0f 80 00    	lea    0x800f4e,%esi
+  800f4c:	0f 34                	sysenter
+
+00800f4e <after_sysenter_label_1210>:
+  800f4e:	5e                   	pop    %esi
+  800f4f:	5d                   	pop    %ebp
+  800f50:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800f53:	85 c0                	test   %eax,%eax
+  800f55:	7f 07                	jg     800f5e <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800f57:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f5a:	5b                   	pop    %ebx
+  800f5b:	5f                   	pop    %edi
+  800f5c:	5d                   	pop    %ebp
+  800f5d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f5e:	83 ec 0c             	sub    $0xc,%esp
+  800f61:	50                   	push   %eax
+  800f62:	6a 0d                	push   $0xd
+  800f64:	68 f5 52 80 00       	push   $0x8052f5
+  800f69:	6a 54                	push   $0x54
+  800f6b:	68 12 53 80 00       	push   $0x805312
+  800f70:	e8 c2 f2 ff ff       	call   800237 <_panic>
+
+00800f75 <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  800f75:	55                   	push   %ebp
+  800f76:	89 e5                	mov    %esp,%ebp
+  800f78:	57                   	push   %edi
+  800f79:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f7a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f7f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f82:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f85:	b8 42 00 00 00       	mov    $0x42,%eax
+  800f8a:	89 df                	mov    %ebx,%edi
+  800f8c:	6a 00                	push   $0x0
+  800f8e:	55                   	push   %ebp
+  800f8f:	56                   	push   %esi
+  800f90:	89 e5                	mov    %esp,%ebp
+  800f92:	8d 35 9a 0f 80 00    	lea    0x800f9a,%esi
+  800f98:	0f 34                	sysenter
+
+00800f9a <after_sysenter_label_1311>:
+  800f9a:	5e                   	pop    %esi
+  800f9b:	5d                   	pop    %ebp
+  800f9c:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800f9f:	85 c0                	test   %eax,%eax
+  800fa1:	7f 07                	jg     800faa <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  800fa3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fa6:	5b                   	pop    %ebx
+  800fa7:	5f                   	pop    %edi
+  800fa8:	5d                   	pop    %ebp
+  800fa9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800faa:	83 ec 0c             	sub    $0xc,%esp
+  800fad:	50                   	push   %eax
+  800fae:	6a 42                	push   $0x42
+  800fb0:	68 f5 52 80 00       	push   $0x8052f5
+  800fb5:	6a 54                	push   $0x54
+  800fb7:	68 12 53 80 00       	push   $0x805312
+  800fbc:	e8 76 f2 ff ff       	call   800237 <_panic>
+
+00800fc1 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800fc1:	55                   	push   %ebp
+  800fc2:	89 e5                	mov    %esp,%ebp
+  800fc4:	57                   	push   %edi
+  800fc5:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fc6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fcb:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800fd0:	89 d1                	mov    %edx,%ecx
+  800fd2:	89 d3                	mov    %edx,%ebx
+  800fd4:	89 d7                	mov    %edx,%edi
+  800fd6:	6a 00                	push   $0x0
+  800fd8:	55                   	push   %ebp
+  800fd9:	56                   	push   %esi
+  800fda:	89 e5                	mov    %esp,%ebp
+  800fdc:	8d 35 e4 0f 80 00    	lea    0x800fe4,%esi
+  800fe2:	0f 34                	sysenter
+
+00800fe4 <after_sysenter_label_1411>:
+  800fe4:	5e                   	pop    %esi
+  800fe5:	5d                   	pop    %ebp
+  800fe6:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800fe9:	5b                   	pop    %ebx
+  800fea:	5f                   	pop    %edi
+  800feb:	5d                   	pop    %ebp
+  800fec:	c3                   	ret
+
+00800fed <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  800fed:	55                   	push   %ebp
+  800fee:	89 e5                	mov    %esp,%ebp
+  800ff0:	57                   	push   %edi
+  800ff1:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ff2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ff7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ffa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ffd:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801002:	89 df                	mov    %ebx,%edi
+  801004:	6a 00                	push   $0x0
+  801006:	55                   	push   %ebp
+  801007:	56                   	push   %esi
+  801008:	89 e5                	mov    %esp,%ebp
+  80100a:	8d 35 12 10 80 00    	lea    0x801012,%esi
+  801010:	0f 34                	sysenter
+
+00801012 <after_sysenter_label_1497>:
+  801012:	5e                   	pop    %esi
+  801013:	5d                   	pop    %ebp
+  801014:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  801017:	5b                   	pop    %ebx
+  801018:	5f                   	pop    %edi
+  801019:	5d                   	pop    %ebp
+  80101a:	c3                   	ret
+
+0080101b <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  80101b:	55                   	push   %ebp
+  80101c:	89 e5                	mov    %esp,%ebp
+  80101e:	57                   	push   %edi
+  80101f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801020:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801025:	8b 55 08             	mov    0x8(%ebp),%edx
+  801028:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80102b:	b8 10 00 00 00       	mov    $0x10,%eax
+  801030:	89 df                	mov    %ebx,%edi
+  801032:	6a 00                	push   $0x0
+  801034:	55                   	push   %ebp
+  801035:	56                   	push   %esi
+  801036:	89 e5                	mov    %esp,%ebp
+  801038:	8d 35 40 10 80 00    	lea    0x801040,%esi
+  80103e:	0f 34                	sysenter
+
+00801040 <after_sysenter_label_1583>:
+  801040:	5e                   	pop    %esi
+  801041:	5d                   	pop    %ebp
+  801042:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  801045:	5b                   	pop    %ebx
+  801046:	5f                   	pop    %edi
+  801047:	5d                   	pop    %ebp
+  801048:	c3                   	ret
+
+00801049 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  801049:	55                   	push   %ebp
+  80104a:	89 e5                	mov    %esp,%ebp
+  80104c:	57                   	push   %edi
+  80104d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80104e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801051:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801054:	b8 11 00 00 00       	mov    $0x11,%eax
+  801059:	bf 00 00 00 00       	mov    $0x0,%edi
+  80105e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801061:	6a 00                	push   $0x0
+  801063:	55                   	push   %ebp
+  801064:	56                   	push   %esi
+  801065:	89 e5                	mov    %esp,%ebp
+  801067:	8d 35 6f 10 80 00    	lea    0x80106f,%esi
+  80106d:	0f 34                	sysenter
+
+0080106f <after_sysenter_label_1672>:
+  80106f:	5e                   	pop    %esi
+  801070:	5d                   	pop    %ebp
+  801071:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  801074:	5b                   	pop    %ebx
+  801075:	5f                   	pop    %edi
+  801076:	5d                   	pop    %ebp
+  801077:	c3                   	ret
+
+00801078 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  801078:	55                   	push   %ebp
+  801079:	89 e5                	mov    %esp,%ebp
+  80107b:	57                   	push   %edi
+  80107c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80107d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801082:	8b 55 08             	mov    0x8(%ebp),%edx
+  801085:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801088:	b8 12 00 00 00       	mov    $0x12,%eax
+  80108d:	89 df                	mov    %ebx,%edi
+  80108f:	6a 00                	push   $0x0
+  801091:	55                   	push   %ebp
+  801092:	56                   	push   %esi
+  801093:	89 e5                	mov    %esp,%ebp
+  801095:	8d 35 9d 10 80 00    	lea    0x80109d,%esi
+  80109b:	0f 34                	sysenter
+
+0080109d <after_sysenter_label_1758>:
+  80109d:	5e                   	pop    %esi
+  80109e:	5d                   	pop    %ebp
+  80109f:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  8010a2:	5b                   	pop    %ebx
+  8010a3:	5f                   	pop    %edi
+  8010a4:	5d                   	pop    %ebp
+  8010a5:	c3                   	ret
+
+008010a6 <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  8010a6:	55                   	push   %ebp
+  8010a7:	89 e5                	mov    %esp,%ebp
+  8010a9:	57                   	push   %edi
+  8010aa:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010ab:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ae:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010b3:	b8 13 00 00 00       	mov    $0x13,%eax
+  8010b8:	89 cb                	mov    %ecx,%ebx
+  8010ba:	89 cf                	mov    %ecx,%edi
+  8010bc:	6a 00                	push   $0x0
+  8010be:	55                   	push   %ebp
+  8010bf:	56                   	push   %esi
+  8010c0:	89 e5                	mov    %esp,%ebp
+  8010c2:	8d 35 ca 10 80 00    	lea    0x8010ca,%esi
+  8010c8:	0f 34                	sysenter
+
+008010ca <after_sysenter_label_1842>:
+  8010ca:	5e                   	pop    %esi
+  8010cb:	5d                   	pop    %ebp
+  8010cc:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8010cf:	85 c0                	test   %eax,%eax
+  8010d1:	7f 07                	jg     8010da <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  8010d3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8010d6:	5b                   	pop    %ebx
+  8010d7:	5f                   	pop    %edi
+  8010d8:	5d                   	pop    %ebp
+  8010d9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010da:	83 ec 0c             	sub    $0xc,%esp
+  8010dd:	50                   	push   %eax
+  8010de:	6a 13                	push   $0x13
+  8010e0:	68 f5 52 80 00       	push   $0x8052f5
+  8010e5:	6a 54                	push   $0x54
+  8010e7:	68 12 53 80 00       	push   $0x805312
+  8010ec:	e8 46 f1 ff ff       	call   800237 <_panic>
+
+008010f1 <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  8010f1:	55                   	push   %ebp
+  8010f2:	89 e5                	mov    %esp,%ebp
+  8010f4:	57                   	push   %edi
+  8010f5:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010fb:	b8 14 00 00 00       	mov    $0x14,%eax
+  801100:	89 d1                	mov    %edx,%ecx
+  801102:	89 d3                	mov    %edx,%ebx
+  801104:	89 d7                	mov    %edx,%edi
+  801106:	6a 00                	push   $0x0
+  801108:	55                   	push   %ebp
+  801109:	56                   	push   %esi
+  80110a:	89 e5                	mov    %esp,%ebp
+  80110c:	8d 35 14 11 80 00    	lea    0x801114,%esi
+  801112:	0f 34                	sysenter
+
+00801114 <after_sysenter_label_1939>:
+  801114:	5e                   	pop    %esi
+  801115:	5d                   	pop    %ebp
+  801116:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  801119:	5b                   	pop    %ebx
+  80111a:	5f                   	pop    %edi
+  80111b:	5d                   	pop    %ebp
+  80111c:	c3                   	ret
+
+0080111d <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  80111d:	55                   	push   %ebp
+  80111e:	89 e5                	mov    %esp,%ebp
+  801120:	57                   	push   %edi
+  801121:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801122:	8b 55 08             	mov    0x8(%ebp),%edx
+  801125:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801128:	b8 15 00 00 00       	mov    $0x15,%eax
+  80112d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801132:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801135:	6a 00                	push   $0x0
+  801137:	55                   	push   %ebp
+  801138:	56                   	push   %esi
+  801139:	89 e5                	mov    %esp,%ebp
+  80113b:	8d 35 43 11 80 00    	lea    0x801143,%esi
+  801141:	0f 34                	sysenter
+
+00801143 <after_sysenter_label_2028>:
+  801143:	5e                   	pop    %esi
+  801144:	5d                   	pop    %ebp
+  801145:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  801148:	5b                   	pop    %ebx
+  801149:	5f                   	pop    %edi
+  80114a:	5d                   	pop    %ebp
+  80114b:	c3                   	ret
+
+0080114c <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  80114c:	55                   	push   %ebp
+  80114d:	89 e5                	mov    %esp,%ebp
+  80114f:	57                   	push   %edi
+  801150:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801151:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801156:	8b 55 08             	mov    0x8(%ebp),%edx
+  801159:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80115c:	b8 16 00 00 00       	mov    $0x16,%eax
+  801161:	89 df                	mov    %ebx,%edi
+  801163:	6a 00                	push   $0x0
+  801165:	55                   	push   %ebp
+  801166:	56                   	push   %esi
+  801167:	89 e5                	mov    %esp,%ebp
+  801169:	8d 35 71 11 80 00    	lea    0x801171,%esi
+  80116f:	0f 34                	sysenter
+
+00801171 <after_sysenter_label_2114>:
+  801171:	5e                   	pop    %esi
+  801172:	5d                   	pop    %ebp
+  801173:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  801176:	5b                   	pop    %ebx
+  801177:	5f                   	pop    %edi
+  801178:	5d                   	pop    %ebp
+  801179:	c3                   	ret
+
+0080117a <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  80117a:	55                   	push   %ebp
+  80117b:	89 e5                	mov    %esp,%ebp
+  80117d:	57                   	push   %edi
+  80117e:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80117f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801184:	8b 55 08             	mov    0x8(%ebp),%edx
+  801187:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80118a:	b8 17 00 00 00       	mov    $0x17,%eax
+  80118f:	89 df                	mov    %ebx,%edi
+  801191:	6a 00                	push   $0x0
+  801193:	55                   	push   %ebp
+  801194:	56                   	push   %esi
+  801195:	89 e5                	mov    %esp,%ebp
+  801197:	8d 35 9f 11 80 00    	lea    0x80119f,%esi
+  80119d:	0f 34                	sysenter
+
+0080119f <after_sysenter_label_2200>:
+  80119f:	5e                   	pop    %esi
+  8011a0:	5d                   	pop    %ebp
+  8011a1:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  8011a4:	5b                   	pop    %ebx
+  8011a5:	5f                   	pop    %edi
+  8011a6:	5d                   	pop    %ebp
+  8011a7:	c3                   	ret
+
+008011a8 <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  8011a8:	55                   	push   %ebp
+  8011a9:	89 e5                	mov    %esp,%ebp
+  8011ab:	57                   	push   %edi
+  8011ac:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8011ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011b5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011b8:	b8 18 00 00 00       	mov    $0x18,%eax
+  8011bd:	89 df                	mov    %ebx,%edi
+  8011bf:	6a 00                	push   $0x0
+  8011c1:	55                   	push   %ebp
+  8011c2:	56                   	push   %esi
+  8011c3:	89 e5                	mov    %esp,%ebp
+  8011c5:	8d 35 cd 11 80 00    	lea    0x8011cd,%esi
+  8011cb:	0f 34                	sysenter
+
+008011cd <after_sysenter_label_2286>:
+  8011cd:	5e                   	pop    %esi
+  8011ce:	5d                   	pop    %ebp
+  8011cf:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  8011d2:	5b                   	pop    %ebx
+  8011d3:	5f                   	pop    %edi
+  8011d4:	5d                   	pop    %ebp
+  8011d5:	c3                   	ret
+
+008011d6 <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  8011d6:	55                   	push   %ebp
+  8011d7:	89 e5                	mov    %esp,%ebp
+  8011d9:	57                   	push   %edi
+  8011da:	56                   	push   %esi
+  8011db:	53                   	push   %ebx
+  8011dc:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  8011df:	89 d6                	mov    %edx,%esi
+  8011e1:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  8011e4:	89 cf                	mov    %ecx,%edi
+  8011e6:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  8011e9:	89 fa                	mov    %edi,%edx
+  8011eb:	80 ce 08             	or     $0x8,%dh
+  8011ee:	f6 c5 08             	test   $0x8,%ch
+  8011f1:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  8011f4:	57                   	push   %edi
+  8011f5:	56                   	push   %esi
+  8011f6:	50                   	push   %eax
+  8011f7:	56                   	push   %esi
+  8011f8:	6a 00                	push   $0x0
+  8011fa:	e8 82 fb ff ff       	call   800d81 <sys_page_map>
+	if (r < 0) {
+  8011ff:	83 c4 20             	add    $0x20,%esp
+  801202:	85 c0                	test   %eax,%eax
+  801204:	78 27                	js     80122d <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  801206:	83 ec 0c             	sub    $0xc,%esp
+  801209:	57                   	push   %edi
+  80120a:	56                   	push   %esi
+  80120b:	6a 00                	push   $0x0
+  80120d:	56                   	push   %esi
+  80120e:	6a 00                	push   $0x0
+  801210:	e8 6c fb ff ff       	call   800d81 <sys_page_map>
+  801215:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  801217:	83 c4 20             	add    $0x20,%esp
+  80121a:	85 c0                	test   %eax,%eax
+  80121c:	78 24                	js     801242 <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  80121e:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  801223:	89 d8                	mov    %ebx,%eax
+  801225:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801228:	5b                   	pop    %ebx
+  801229:	5e                   	pop    %esi
+  80122a:	5f                   	pop    %edi
+  80122b:	5d                   	pop    %ebp
+  80122c:	c3                   	ret
+  80122d:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  80122f:	83 ec 08             	sub    $0x8,%esp
+  801232:	50                   	push   %eax
+  801233:	68 20 53 80 00       	push   $0x805320
+  801238:	e8 d5 f0 ff ff       	call   800312 <cprintf>
+		return r;
+  80123d:	83 c4 10             	add    $0x10,%esp
+  801240:	eb e1                	jmp    801223 <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  801242:	83 ec 08             	sub    $0x8,%esp
+  801245:	50                   	push   %eax
+  801246:	68 50 53 80 00       	push   $0x805350
+  80124b:	e8 c2 f0 ff ff       	call   800312 <cprintf>
+		return r;
+  801250:	83 c4 10             	add    $0x10,%esp
+  801253:	eb ce                	jmp    801223 <duppage_cow+0x4d>
+
+00801255 <duppage>:
+{
+  801255:	55                   	push   %ebp
+  801256:	89 e5                	mov    %esp,%ebp
+  801258:	53                   	push   %ebx
+  801259:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  80125c:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  80125f:	51                   	push   %ecx
+  801260:	52                   	push   %edx
+  801261:	50                   	push   %eax
+  801262:	52                   	push   %edx
+  801263:	6a 00                	push   $0x0
+  801265:	e8 17 fb ff ff       	call   800d81 <sys_page_map>
+	if (r < 0) {
+  80126a:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  80126d:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  801272:	85 c0                	test   %eax,%eax
+  801274:	78 07                	js     80127d <duppage+0x28>
+}
+  801276:	89 d8                	mov    %ebx,%eax
+  801278:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80127b:	c9                   	leave
+  80127c:	c3                   	ret
+  80127d:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  80127f:	83 ec 08             	sub    $0x8,%esp
+  801282:	50                   	push   %eax
+  801283:	68 20 53 80 00       	push   $0x805320
+  801288:	e8 85 f0 ff ff       	call   800312 <cprintf>
+		return r;
+  80128d:	83 c4 10             	add    $0x10,%esp
+  801290:	eb e4                	jmp    801276 <duppage+0x21>
+
+00801292 <cow_copy>:
+{
+  801292:	55                   	push   %ebp
+  801293:	89 e5                	mov    %esp,%ebp
+  801295:	56                   	push   %esi
+  801296:	53                   	push   %ebx
+  801297:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  801299:	83 ec 04             	sub    $0x4,%esp
+  80129c:	6a 07                	push   $0x7
+  80129e:	68 00 f0 7f 00       	push   $0x7ff000
+  8012a3:	6a 00                	push   $0x0
+  8012a5:	e8 8a fa ff ff       	call   800d34 <sys_page_alloc>
+	if (r < 0) {
+  8012aa:	83 c4 10             	add    $0x10,%esp
+  8012ad:	85 c0                	test   %eax,%eax
+  8012af:	78 58                	js     801309 <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  8012b1:	83 ec 04             	sub    $0x4,%esp
+  8012b4:	68 00 10 00 00       	push   $0x1000
+  8012b9:	56                   	push   %esi
+  8012ba:	68 00 f0 7f 00       	push   $0x7ff000
+  8012bf:	e8 b8 f7 ff ff       	call   800a7c <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  8012c4:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8012cb:	56                   	push   %esi
+  8012cc:	6a 00                	push   $0x0
+  8012ce:	68 00 f0 7f 00       	push   $0x7ff000
+  8012d3:	6a 00                	push   $0x0
+  8012d5:	e8 a7 fa ff ff       	call   800d81 <sys_page_map>
+  8012da:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  8012dc:	83 c4 20             	add    $0x20,%esp
+  8012df:	85 c0                	test   %eax,%eax
+  8012e1:	78 3b                	js     80131e <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  8012e3:	83 ec 08             	sub    $0x8,%esp
+  8012e6:	68 00 f0 7f 00       	push   $0x7ff000
+  8012eb:	6a 00                	push   $0x0
+  8012ed:	e8 db fa ff ff       	call   800dcd <sys_page_unmap>
+  8012f2:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  8012f4:	83 c4 10             	add    $0x10,%esp
+  8012f7:	85 c0                	test   %eax,%eax
+  8012f9:	78 45                	js     801340 <cow_copy+0xae>
+	return 0;
+  8012fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  801300:	89 d8                	mov    %ebx,%eax
+  801302:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801305:	5b                   	pop    %ebx
+  801306:	5e                   	pop    %esi
+  801307:	5d                   	pop    %ebp
+  801308:	c3                   	ret
+  801309:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  80130b:	83 ec 08             	sub    $0x8,%esp
+  80130e:	50                   	push   %eax
+  80130f:	68 40 54 80 00       	push   $0x805440
+  801314:	e8 f9 ef ff ff       	call   800312 <cprintf>
+		return r;
+  801319:	83 c4 10             	add    $0x10,%esp
+  80131c:	eb e2                	jmp    801300 <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  80131e:	83 ec 08             	sub    $0x8,%esp
+  801321:	50                   	push   %eax
+  801322:	68 5c 54 80 00       	push   $0x80545c
+  801327:	e8 e6 ef ff ff       	call   800312 <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  80132c:	83 c4 08             	add    $0x8,%esp
+  80132f:	68 00 f0 7f 00       	push   $0x7ff000
+  801334:	6a 00                	push   $0x0
+  801336:	e8 92 fa ff ff       	call   800dcd <sys_page_unmap>
+		return r;
+  80133b:	83 c4 10             	add    $0x10,%esp
+  80133e:	eb c0                	jmp    801300 <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  801340:	83 ec 08             	sub    $0x8,%esp
+  801343:	50                   	push   %eax
+  801344:	68 78 53 80 00       	push   $0x805378
+  801349:	e8 c4 ef ff ff       	call   800312 <cprintf>
+		return r;
+  80134e:	83 c4 10             	add    $0x10,%esp
+  801351:	eb ad                	jmp    801300 <cow_copy+0x6e>
+
+00801353 <pgfault>:
+{
+  801353:	55                   	push   %ebp
+  801354:	89 e5                	mov    %esp,%ebp
+  801356:	56                   	push   %esi
+  801357:	53                   	push   %ebx
+  801358:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  80135b:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  80135d:	89 d8                	mov    %ebx,%eax
+  80135f:	c1 e8 16             	shr    $0x16,%eax
+  801362:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  801369:	89 de                	mov    %ebx,%esi
+  80136b:	c1 ee 0c             	shr    $0xc,%esi
+  80136e:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  801375:	a8 07                	test   $0x7,%al
+  801377:	74 3b                	je     8013b4 <pgfault+0x61>
+  801379:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  80137f:	74 33                	je     8013b4 <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  801381:	83 ec 0c             	sub    $0xc,%esp
+  801384:	68 00 f0 bf ee       	push   $0xeebff000
+  801389:	e8 ea 2c 00 00       	call   804078 <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  80138e:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  801395:	83 c4 10             	add    $0x10,%esp
+  801398:	f6 c4 08             	test   $0x8,%ah
+  80139b:	75 30                	jne    8013cd <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  80139d:	83 ec 0c             	sub    $0xc,%esp
+  8013a0:	68 00 f0 bf ee       	push   $0xeebff000
+  8013a5:	e8 3b 2d 00 00       	call   8040e5 <mutex_unlock>
+}
+  8013aa:	83 c4 10             	add    $0x10,%esp
+  8013ad:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013b0:	5b                   	pop    %ebx
+  8013b1:	5e                   	pop    %esi
+  8013b2:	5d                   	pop    %ebp
+  8013b3:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  8013b4:	83 ec 08             	sub    $0x8,%esp
+  8013b7:	ff 72 28             	push   0x28(%edx)
+  8013ba:	51                   	push   %ecx
+  8013bb:	50                   	push   %eax
+  8013bc:	68 9c 53 80 00       	push   $0x80539c
+  8013c1:	6a 3f                	push   $0x3f
+  8013c3:	68 76 54 80 00       	push   $0x805476
+  8013c8:	e8 6a ee ff ff       	call   800237 <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  8013cd:	89 d8                	mov    %ebx,%eax
+  8013cf:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  8013d4:	e8 b9 fe ff ff       	call   801292 <cow_copy>
+  8013d9:	eb c2                	jmp    80139d <pgfault+0x4a>
+
+008013db <cow_enable>:
+{
+  8013db:	55                   	push   %ebp
+  8013dc:	89 e5                	mov    %esp,%ebp
+  8013de:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  8013e1:	68 53 13 80 00       	push   $0x801353
+  8013e6:	e8 0d 36 00 00       	call   8049f8 <set_pgfault_handler>
+}
+  8013eb:	83 c4 10             	add    $0x10,%esp
+  8013ee:	c9                   	leave
+  8013ef:	c3                   	ret
+
+008013f0 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  8013f0:	55                   	push   %ebp
+  8013f1:	89 e5                	mov    %esp,%ebp
+  8013f3:	57                   	push   %edi
+  8013f4:	56                   	push   %esi
+  8013f5:	53                   	push   %ebx
+  8013f6:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  8013f9:	68 53 13 80 00       	push   $0x801353
+  8013fe:	e8 f5 35 00 00       	call   8049f8 <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  801403:	b8 07 00 00 00       	mov    $0x7,%eax
+  801408:	cd 30                	int    $0x30
+  80140a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  80140d:	83 c4 10             	add    $0x10,%esp
+  801410:	85 c0                	test   %eax,%eax
+  801412:	78 4b                	js     80145f <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  801414:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  801419:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80141e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  801421:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  801425:	0f 85 16 01 00 00    	jne    801541 <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80142b:	e8 ac f8 ff ff       	call   800cdc <sys_getenvid>
+  801430:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801435:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801437:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  80143d:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  801443:	77 32                	ja     801477 <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801445:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  80144a:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  80144c:	c1 ea 10             	shr    $0x10,%edx
+  80144f:	74 26                	je     801477 <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801451:	c1 e2 10             	shl    $0x10,%edx
+  801454:	89 d1                	mov    %edx,%ecx
+  801456:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80145b:	29 ca                	sub    %ecx,%edx
+  80145d:	eb 1e                	jmp    80147d <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  80145f:	83 ec 08             	sub    $0x8,%esp
+  801462:	89 c7                	mov    %eax,%edi
+  801464:	50                   	push   %eax
+  801465:	68 81 54 80 00       	push   $0x805481
+  80146a:	e8 a3 ee ff ff       	call   800312 <cprintf>
+		return eid;
+  80146f:	83 c4 10             	add    $0x10,%esp
+  801472:	e9 6c 01 00 00       	jmp    8015e3 <fork+0x1f3>
+		return pthread_main_tls;
+  801477:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80147d:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  801480:	c1 e0 04             	shl    $0x4,%eax
+  801483:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801488:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  80148a:	e8 32 33 00 00       	call   8047c1 <pthread_fork_child>
+		return eid;
+  80148f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801492:	e9 4c 01 00 00       	jmp    8015e3 <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  801497:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  80149d:	89 da                	mov    %ebx,%edx
+  80149f:	89 f8                	mov    %edi,%eax
+  8014a1:	e8 af fd ff ff       	call   801255 <duppage>
+  8014a6:	85 c0                	test   %eax,%eax
+  8014a8:	79 28                	jns    8014d2 <fork+0xe2>
+  8014aa:	89 c7                	mov    %eax,%edi
+  8014ac:	e9 32 01 00 00       	jmp    8015e3 <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  8014b1:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8014b7:	83 f9 05             	cmp    $0x5,%ecx
+  8014ba:	75 58                	jne    801514 <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8014bc:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8014c1:	89 da                	mov    %ebx,%edx
+  8014c3:	89 f8                	mov    %edi,%eax
+  8014c5:	e8 8b fd ff ff       	call   801255 <duppage>
+  8014ca:	85 c0                	test   %eax,%eax
+  8014cc:	0f 88 0f 01 00 00    	js     8015e1 <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  8014d2:	83 c3 01             	add    $0x1,%ebx
+  8014d5:	39 de                	cmp    %ebx,%esi
+  8014d7:	74 54                	je     80152d <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  8014d9:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  8014e0:	f6 c1 05             	test   $0x5,%cl
+  8014e3:	74 ed                	je     8014d2 <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  8014e5:	f6 c5 04             	test   $0x4,%ch
+  8014e8:	75 ad                	jne    801497 <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  8014ea:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  8014f0:	74 bf                	je     8014b1 <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  8014f2:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8014f8:	74 d8                	je     8014d2 <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  8014fa:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  801500:	89 da                	mov    %ebx,%edx
+  801502:	89 f8                	mov    %edi,%eax
+  801504:	e8 cd fc ff ff       	call   8011d6 <duppage_cow>
+  801509:	85 c0                	test   %eax,%eax
+  80150b:	79 c5                	jns    8014d2 <fork+0xe2>
+  80150d:	89 c7                	mov    %eax,%edi
+  80150f:	e9 cf 00 00 00       	jmp    8015e3 <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  801514:	68 cc 53 80 00       	push   $0x8053cc
+  801519:	68 91 54 80 00       	push   $0x805491
+  80151e:	68 c6 00 00 00       	push   $0xc6
+  801523:	68 76 54 80 00       	push   $0x805476
+  801528:	e8 0a ed ff ff       	call   800237 <_panic>
+  80152d:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  801530:	83 c1 01             	add    $0x1,%ecx
+  801533:	81 c6 00 04 00 00    	add    $0x400,%esi
+  801539:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  80153f:	74 18                	je     801559 <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  801541:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  801548:	a8 07                	test   $0x7,%al
+  80154a:	74 e4                	je     801530 <fork+0x140>
+  80154c:	89 cb                	mov    %ecx,%ebx
+  80154e:	c1 e3 0a             	shl    $0xa,%ebx
+  801551:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801554:	e9 7c ff ff ff       	jmp    8014d5 <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  801559:	83 ec 04             	sub    $0x4,%esp
+  80155c:	6a 07                	push   $0x7
+  80155e:	68 00 f0 bf ee       	push   $0xeebff000
+  801563:	ff 75 e4             	push   -0x1c(%ebp)
+  801566:	e8 c9 f7 ff ff       	call   800d34 <sys_page_alloc>
+  80156b:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80156d:	83 c4 10             	add    $0x10,%esp
+  801570:	85 c0                	test   %eax,%eax
+  801572:	78 34                	js     8015a8 <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  801574:	83 ec 08             	sub    $0x8,%esp
+  801577:	68 36 4a 80 00       	push   $0x804a36
+  80157c:	ff 75 e4             	push   -0x1c(%ebp)
+  80157f:	e8 2d f9 ff ff       	call   800eb1 <sys_env_set_pgfault_upcall>
+  801584:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801586:	83 c4 10             	add    $0x10,%esp
+  801589:	85 c0                	test   %eax,%eax
+  80158b:	78 2e                	js     8015bb <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  80158d:	83 ec 08             	sub    $0x8,%esp
+  801590:	6a 02                	push   $0x2
+  801592:	ff 75 e4             	push   -0x1c(%ebp)
+  801595:	e8 7f f8 ff ff       	call   800e19 <sys_env_set_status>
+  80159a:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80159c:	83 c4 10             	add    $0x10,%esp
+  80159f:	85 c0                	test   %eax,%eax
+  8015a1:	78 2b                	js     8015ce <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  8015a3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8015a6:	eb 3b                	jmp    8015e3 <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  8015a8:	83 ec 08             	sub    $0x8,%esp
+  8015ab:	50                   	push   %eax
+  8015ac:	68 f4 53 80 00       	push   $0x8053f4
+  8015b1:	e8 5c ed ff ff       	call   800312 <cprintf>
+		return r;
+  8015b6:	83 c4 10             	add    $0x10,%esp
+  8015b9:	eb 28                	jmp    8015e3 <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  8015bb:	83 ec 08             	sub    $0x8,%esp
+  8015be:	50                   	push   %eax
+  8015bf:	68 1c 54 80 00       	push   $0x80541c
+  8015c4:	e8 49 ed ff ff       	call   800312 <cprintf>
+		return r;
+  8015c9:	83 c4 10             	add    $0x10,%esp
+  8015cc:	eb 15                	jmp    8015e3 <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  8015ce:	83 ec 08             	sub    $0x8,%esp
+  8015d1:	50                   	push   %eax
+  8015d2:	68 a6 54 80 00       	push   $0x8054a6
+  8015d7:	e8 36 ed ff ff       	call   800312 <cprintf>
+		return r;
+  8015dc:	83 c4 10             	add    $0x10,%esp
+  8015df:	eb 02                	jmp    8015e3 <fork+0x1f3>
+  8015e1:	89 c7                	mov    %eax,%edi
+}
+  8015e3:	89 f8                	mov    %edi,%eax
+  8015e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015e8:	5b                   	pop    %ebx
+  8015e9:	5e                   	pop    %esi
+  8015ea:	5f                   	pop    %edi
+  8015eb:	5d                   	pop    %ebp
+  8015ec:	c3                   	ret
+
+008015ed <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  8015ed:	55                   	push   %ebp
+  8015ee:	89 e5                	mov    %esp,%ebp
+  8015f0:	57                   	push   %edi
+  8015f1:	56                   	push   %esi
+  8015f2:	53                   	push   %ebx
+  8015f3:	83 ec 2c             	sub    $0x2c,%esp
+  8015f6:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8015f8:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  8015fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801603:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  801609:	77 0a                	ja     801615 <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80160b:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  801610:	29 c3                	sub    %eax,%ebx
+  801612:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  801615:	83 ec 0c             	sub    $0xc,%esp
+  801618:	68 53 13 80 00       	push   $0x801353
+  80161d:	e8 d6 33 00 00       	call   8049f8 <set_pgfault_handler>
+  801622:	b8 07 00 00 00       	mov    $0x7,%eax
+  801627:	cd 30                	int    $0x30
+  801629:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  80162c:	83 c4 10             	add    $0x10,%esp
+  80162f:	85 c0                	test   %eax,%eax
+  801631:	78 30                	js     801663 <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  801633:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801637:	74 42                	je     80167b <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  801639:	c1 e3 10             	shl    $0x10,%ebx
+  80163c:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  801641:	29 d8                	sub    %ebx,%eax
+  801643:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801646:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  80164b:	29 d8                	sub    %ebx,%eax
+  80164d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801650:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  801655:	ba 00 00 00 00       	mov    $0x0,%edx
+  80165a:	89 f7                	mov    %esi,%edi
+  80165c:	89 d6                	mov    %edx,%esi
+  80165e:	e9 2c 01 00 00       	jmp    80178f <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  801663:	83 ec 08             	sub    $0x8,%esp
+  801666:	89 c7                	mov    %eax,%edi
+  801668:	50                   	push   %eax
+  801669:	68 81 54 80 00       	push   $0x805481
+  80166e:	e8 9f ec ff ff       	call   800312 <cprintf>
+		return eid;
+  801673:	83 c4 10             	add    $0x10,%esp
+  801676:	e9 d5 00 00 00       	jmp    801750 <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80167b:	e8 5c f6 ff ff       	call   800cdc <sys_getenvid>
+  801680:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801685:	89 c2                	mov    %eax,%edx
+  801687:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801689:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  80168f:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801694:	77 18                	ja     8016ae <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801696:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80169b:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  80169d:	c1 e8 10             	shr    $0x10,%eax
+  8016a0:	74 0c                	je     8016ae <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8016a2:	c1 e0 10             	shl    $0x10,%eax
+  8016a5:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8016aa:	29 c1                	sub    %eax,%ecx
+  8016ac:	eb 06                	jmp    8016b4 <sfork+0xc7>
+		return pthread_main_tls;
+  8016ae:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+  8016b4:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8016b7:	c1 e0 04             	shl    $0x4,%eax
+  8016ba:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8016bf:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  8016c1:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8016c4:	e9 87 00 00 00       	jmp    801750 <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  8016c9:	f6 c5 04             	test   $0x4,%ch
+  8016cc:	74 6c                	je     80173a <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  8016ce:	89 ca                	mov    %ecx,%edx
+  8016d0:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  8016d6:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  8016dc:	74 7c                	je     80175a <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8016de:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8016e4:	89 da                	mov    %ebx,%edx
+  8016e6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8016e9:	e8 67 fb ff ff       	call   801255 <duppage>
+  8016ee:	85 c0                	test   %eax,%eax
+  8016f0:	0f 88 4f 01 00 00    	js     801845 <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  8016f6:	83 c3 01             	add    $0x1,%ebx
+  8016f9:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  8016fc:	74 7a                	je     801778 <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  8016fe:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  801700:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  801707:	f6 c1 01             	test   $0x1,%cl
+  80170a:	74 ea                	je     8016f6 <sfork+0x109>
+  80170c:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  801712:	74 e2                	je     8016f6 <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  801714:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  80171a:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  80171d:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  801722:	76 a5                	jbe    8016c9 <sfork+0xdc>
+  801724:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  80172a:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  80172d:	39 fa                	cmp    %edi,%edx
+  80172f:	73 9d                	jae    8016ce <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  801731:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  801734:	39 fa                	cmp    %edi,%edx
+  801736:	72 96                	jb     8016ce <sfork+0xe1>
+  801738:	eb 8f                	jmp    8016c9 <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  80173a:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  801740:	89 da                	mov    %ebx,%edx
+  801742:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801745:	e8 8c fa ff ff       	call   8011d6 <duppage_cow>
+  80174a:	85 c0                	test   %eax,%eax
+  80174c:	79 a8                	jns    8016f6 <sfork+0x109>
+  80174e:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  801750:	89 f8                	mov    %edi,%eax
+  801752:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801755:	5b                   	pop    %ebx
+  801756:	5e                   	pop    %esi
+  801757:	5f                   	pop    %edi
+  801758:	5d                   	pop    %ebp
+  801759:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  80175a:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  80175f:	e8 2e fb ff ff       	call   801292 <cow_copy>
+  801764:	85 c0                	test   %eax,%eax
+  801766:	0f 88 d2 00 00 00    	js     80183e <sfork+0x251>
+				pte = uvpt[pn];
+  80176c:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  801773:	e9 66 ff ff ff       	jmp    8016de <sfork+0xf1>
+  801778:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80177b:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80177e:	83 c6 01             	add    $0x1,%esi
+  801781:	81 c7 00 04 00 00    	add    $0x400,%edi
+  801787:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  80178d:	74 1b                	je     8017aa <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  80178f:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  801796:	a8 01                	test   $0x1,%al
+  801798:	74 e4                	je     80177e <sfork+0x191>
+  80179a:	89 f3                	mov    %esi,%ebx
+  80179c:	c1 e3 0a             	shl    $0xa,%ebx
+  80179f:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  8017a2:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  8017a5:	e9 4f ff ff ff       	jmp    8016f9 <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  8017aa:	83 ec 04             	sub    $0x4,%esp
+  8017ad:	6a 07                	push   $0x7
+  8017af:	68 00 f0 bf ee       	push   $0xeebff000
+  8017b4:	ff 75 e0             	push   -0x20(%ebp)
+  8017b7:	e8 78 f5 ff ff       	call   800d34 <sys_page_alloc>
+  8017bc:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8017be:	83 c4 10             	add    $0x10,%esp
+  8017c1:	85 c0                	test   %eax,%eax
+  8017c3:	78 37                	js     8017fc <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  8017c5:	83 ec 08             	sub    $0x8,%esp
+  8017c8:	68 36 4a 80 00       	push   $0x804a36
+  8017cd:	ff 75 e0             	push   -0x20(%ebp)
+  8017d0:	e8 dc f6 ff ff       	call   800eb1 <sys_env_set_pgfault_upcall>
+  8017d5:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8017d7:	83 c4 10             	add    $0x10,%esp
+  8017da:	85 c0                	test   %eax,%eax
+  8017dc:	78 34                	js     801812 <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  8017de:	83 ec 08             	sub    $0x8,%esp
+  8017e1:	6a 02                	push   $0x2
+  8017e3:	ff 75 e0             	push   -0x20(%ebp)
+  8017e6:	e8 2e f6 ff ff       	call   800e19 <sys_env_set_status>
+  8017eb:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8017ed:	83 c4 10             	add    $0x10,%esp
+  8017f0:	85 c0                	test   %eax,%eax
+  8017f2:	78 34                	js     801828 <sfork+0x23b>
+	return eid;
+  8017f4:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8017f7:	e9 54 ff ff ff       	jmp    801750 <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  8017fc:	83 ec 08             	sub    $0x8,%esp
+  8017ff:	50                   	push   %eax
+  801800:	68 f4 53 80 00       	push   $0x8053f4
+  801805:	e8 08 eb ff ff       	call   800312 <cprintf>
+		return r;
+  80180a:	83 c4 10             	add    $0x10,%esp
+  80180d:	e9 3e ff ff ff       	jmp    801750 <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  801812:	83 ec 08             	sub    $0x8,%esp
+  801815:	50                   	push   %eax
+  801816:	68 1c 54 80 00       	push   $0x80541c
+  80181b:	e8 f2 ea ff ff       	call   800312 <cprintf>
+		return r;
+  801820:	83 c4 10             	add    $0x10,%esp
+  801823:	e9 28 ff ff ff       	jmp    801750 <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  801828:	83 ec 08             	sub    $0x8,%esp
+  80182b:	50                   	push   %eax
+  80182c:	68 a6 54 80 00       	push   $0x8054a6
+  801831:	e8 dc ea ff ff       	call   800312 <cprintf>
+		return r;
+  801836:	83 c4 10             	add    $0x10,%esp
+  801839:	e9 12 ff ff ff       	jmp    801750 <sfork+0x163>
+  80183e:	89 c7                	mov    %eax,%edi
+  801840:	e9 0b ff ff ff       	jmp    801750 <sfork+0x163>
+  801845:	89 c7                	mov    %eax,%edi
+  801847:	e9 04 ff ff ff       	jmp    801750 <sfork+0x163>
+
+0080184c <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80184c:	55                   	push   %ebp
+  80184d:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80184f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801852:	05 00 00 00 30       	add    $0x30000000,%eax
+  801857:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80185a:	5d                   	pop    %ebp
+  80185b:	c3                   	ret
+
+0080185c <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80185c:	55                   	push   %ebp
+  80185d:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80185f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801862:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801867:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80186c:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801871:	5d                   	pop    %ebp
+  801872:	c3                   	ret
+
+00801873 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801873:	55                   	push   %ebp
+  801874:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801876:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80187b:	eb 02                	jmp    80187f <fd_alloc+0xc>
+  80187d:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80187f:	89 c2                	mov    %eax,%edx
+  801881:	c1 ea 16             	shr    $0x16,%edx
+  801884:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80188b:	f6 c2 01             	test   $0x1,%dl
+  80188e:	74 2b                	je     8018bb <fd_alloc+0x48>
+  801890:	89 c2                	mov    %eax,%edx
+  801892:	c1 ea 0c             	shr    $0xc,%edx
+  801895:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80189c:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8018a2:	f6 c1 01             	test   $0x1,%cl
+  8018a5:	74 14                	je     8018bb <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8018a7:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8018ad:	75 ce                	jne    80187d <fd_alloc+0xa>
+  8018af:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8018b4:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8018b9:	eb 05                	jmp    8018c0 <fd_alloc+0x4d>
+			return 0;
+  8018bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8018c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018c3:	89 02                	mov    %eax,(%edx)
+}
+  8018c5:	89 c8                	mov    %ecx,%eax
+  8018c7:	5d                   	pop    %ebp
+  8018c8:	c3                   	ret
+
+008018c9 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8018c9:	55                   	push   %ebp
+  8018ca:	89 e5                	mov    %esp,%ebp
+  8018cc:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8018cf:	83 f8 1f             	cmp    $0x1f,%eax
+  8018d2:	77 30                	ja     801904 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8018d4:	c1 e0 0c             	shl    $0xc,%eax
+  8018d7:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8018dc:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8018e2:	f6 c2 01             	test   $0x1,%dl
+  8018e5:	74 24                	je     80190b <fd_lookup+0x42>
+  8018e7:	89 c2                	mov    %eax,%edx
+  8018e9:	c1 ea 0c             	shr    $0xc,%edx
+  8018ec:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8018f3:	f6 c2 01             	test   $0x1,%dl
+  8018f6:	74 1a                	je     801912 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8018f8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8018fb:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8018fd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801902:	5d                   	pop    %ebp
+  801903:	c3                   	ret
+		return -E_INVAL;
+  801904:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801909:	eb f7                	jmp    801902 <fd_lookup+0x39>
+		return -E_INVAL;
+  80190b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801910:	eb f0                	jmp    801902 <fd_lookup+0x39>
+  801912:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801917:	eb e9                	jmp    801902 <fd_lookup+0x39>
+
+00801919 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801919:	55                   	push   %ebp
+  80191a:	89 e5                	mov    %esp,%ebp
+  80191c:	53                   	push   %ebx
+  80191d:	83 ec 04             	sub    $0x4,%esp
+  801920:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801923:	b8 00 00 00 00       	mov    $0x0,%eax
+  801928:	eb 03                	jmp    80192d <dev_lookup+0x14>
+  80192a:	83 c0 01             	add    $0x1,%eax
+  80192d:	8b 1c 85 40 55 80 00 	mov    0x805540(,%eax,4),%ebx
+  801934:	85 db                	test   %ebx,%ebx
+  801936:	74 0b                	je     801943 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801938:	39 13                	cmp    %edx,(%ebx)
+  80193a:	75 ee                	jne    80192a <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80193c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801941:	eb 49                	jmp    80198c <dev_lookup+0x73>
+  801943:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801945:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  80194b:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801950:	77 18                	ja     80196a <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801952:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801957:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  801959:	c1 e8 10             	shr    $0x10,%eax
+  80195c:	74 0c                	je     80196a <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80195e:	c1 e0 10             	shl    $0x10,%eax
+  801961:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  801966:	29 c1                	sub    %eax,%ecx
+  801968:	eb 06                	jmp    801970 <dev_lookup+0x57>
+		return pthread_main_tls;
+  80196a:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801970:	8b 01                	mov    (%ecx),%eax
+  801972:	8b 40 48             	mov    0x48(%eax),%eax
+  801975:	83 ec 04             	sub    $0x4,%esp
+  801978:	52                   	push   %edx
+  801979:	50                   	push   %eax
+  80197a:	68 c4 54 80 00       	push   $0x8054c4
+  80197f:	e8 8e e9 ff ff       	call   800312 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801984:	83 c4 10             	add    $0x10,%esp
+  801987:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80198c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80198f:	89 1a                	mov    %ebx,(%edx)
+}
+  801991:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801994:	c9                   	leave
+  801995:	c3                   	ret
+
+00801996 <fd_close>:
+{
+  801996:	55                   	push   %ebp
+  801997:	89 e5                	mov    %esp,%ebp
+  801999:	57                   	push   %edi
+  80199a:	56                   	push   %esi
+  80199b:	53                   	push   %ebx
+  80199c:	83 ec 24             	sub    $0x24,%esp
+  80199f:	8b 75 08             	mov    0x8(%ebp),%esi
+  8019a2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8019a5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8019a8:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8019a9:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8019af:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8019b2:	50                   	push   %eax
+  8019b3:	e8 11 ff ff ff       	call   8018c9 <fd_lookup>
+  8019b8:	89 c3                	mov    %eax,%ebx
+  8019ba:	83 c4 10             	add    $0x10,%esp
+  8019bd:	85 c0                	test   %eax,%eax
+  8019bf:	78 05                	js     8019c6 <fd_close+0x30>
+	    || fd != fd2)
+  8019c1:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8019c4:	74 16                	je     8019dc <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8019c6:	89 f8                	mov    %edi,%eax
+  8019c8:	84 c0                	test   %al,%al
+  8019ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019cf:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8019d2:	89 d8                	mov    %ebx,%eax
+  8019d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019d7:	5b                   	pop    %ebx
+  8019d8:	5e                   	pop    %esi
+  8019d9:	5f                   	pop    %edi
+  8019da:	5d                   	pop    %ebp
+  8019db:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8019dc:	83 ec 08             	sub    $0x8,%esp
+  8019df:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8019e2:	50                   	push   %eax
+  8019e3:	ff 36                	push   (%esi)
+  8019e5:	e8 2f ff ff ff       	call   801919 <dev_lookup>
+  8019ea:	89 c3                	mov    %eax,%ebx
+  8019ec:	83 c4 10             	add    $0x10,%esp
+  8019ef:	85 c0                	test   %eax,%eax
+  8019f1:	78 1a                	js     801a0d <fd_close+0x77>
+		if (dev->dev_close)
+  8019f3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8019f6:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8019f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8019fe:	85 c0                	test   %eax,%eax
+  801a00:	74 0b                	je     801a0d <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801a02:	83 ec 0c             	sub    $0xc,%esp
+  801a05:	56                   	push   %esi
+  801a06:	ff d0                	call   *%eax
+  801a08:	89 c3                	mov    %eax,%ebx
+  801a0a:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801a0d:	83 ec 08             	sub    $0x8,%esp
+  801a10:	56                   	push   %esi
+  801a11:	6a 00                	push   $0x0
+  801a13:	e8 b5 f3 ff ff       	call   800dcd <sys_page_unmap>
+	return r;
+  801a18:	83 c4 10             	add    $0x10,%esp
+  801a1b:	eb b5                	jmp    8019d2 <fd_close+0x3c>
+
+00801a1d <close>:
+
+int
+close(int fdnum)
+{
+  801a1d:	55                   	push   %ebp
+  801a1e:	89 e5                	mov    %esp,%ebp
+  801a20:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801a23:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a26:	50                   	push   %eax
+  801a27:	ff 75 08             	push   0x8(%ebp)
+  801a2a:	e8 9a fe ff ff       	call   8018c9 <fd_lookup>
+  801a2f:	83 c4 10             	add    $0x10,%esp
+  801a32:	85 c0                	test   %eax,%eax
+  801a34:	79 02                	jns    801a38 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801a36:	c9                   	leave
+  801a37:	c3                   	ret
+		return fd_close(fd, 1);
+  801a38:	83 ec 08             	sub    $0x8,%esp
+  801a3b:	6a 01                	push   $0x1
+  801a3d:	ff 75 f4             	push   -0xc(%ebp)
+  801a40:	e8 51 ff ff ff       	call   801996 <fd_close>
+  801a45:	83 c4 10             	add    $0x10,%esp
+  801a48:	eb ec                	jmp    801a36 <close+0x19>
+
+00801a4a <close_all>:
+
+void
+close_all(void)
+{
+  801a4a:	55                   	push   %ebp
+  801a4b:	89 e5                	mov    %esp,%ebp
+  801a4d:	53                   	push   %ebx
+  801a4e:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801a51:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801a56:	83 ec 0c             	sub    $0xc,%esp
+  801a59:	53                   	push   %ebx
+  801a5a:	e8 be ff ff ff       	call   801a1d <close>
+	for (i = 0; i < MAXFD; i++)
+  801a5f:	83 c3 01             	add    $0x1,%ebx
+  801a62:	83 c4 10             	add    $0x10,%esp
+  801a65:	83 fb 20             	cmp    $0x20,%ebx
+  801a68:	75 ec                	jne    801a56 <close_all+0xc>
+}
+  801a6a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a6d:	c9                   	leave
+  801a6e:	c3                   	ret
+
+00801a6f <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801a6f:	55                   	push   %ebp
+  801a70:	89 e5                	mov    %esp,%ebp
+  801a72:	57                   	push   %edi
+  801a73:	56                   	push   %esi
+  801a74:	53                   	push   %ebx
+  801a75:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801a78:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801a7b:	50                   	push   %eax
+  801a7c:	ff 75 08             	push   0x8(%ebp)
+  801a7f:	e8 45 fe ff ff       	call   8018c9 <fd_lookup>
+  801a84:	89 c3                	mov    %eax,%ebx
+  801a86:	83 c4 10             	add    $0x10,%esp
+  801a89:	85 c0                	test   %eax,%eax
+  801a8b:	78 7f                	js     801b0c <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801a8d:	83 ec 0c             	sub    $0xc,%esp
+  801a90:	ff 75 0c             	push   0xc(%ebp)
+  801a93:	e8 85 ff ff ff       	call   801a1d <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801a98:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801a9b:	c1 e6 0c             	shl    $0xc,%esi
+  801a9e:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801aa4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801aa7:	89 3c 24             	mov    %edi,(%esp)
+  801aaa:	e8 ad fd ff ff       	call   80185c <fd2data>
+  801aaf:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801ab1:	89 34 24             	mov    %esi,(%esp)
+  801ab4:	e8 a3 fd ff ff       	call   80185c <fd2data>
+  801ab9:	83 c4 10             	add    $0x10,%esp
+  801abc:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801abf:	89 d8                	mov    %ebx,%eax
+  801ac1:	c1 e8 16             	shr    $0x16,%eax
+  801ac4:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801acb:	a8 01                	test   $0x1,%al
+  801acd:	74 11                	je     801ae0 <dup+0x71>
+  801acf:	89 d8                	mov    %ebx,%eax
+  801ad1:	c1 e8 0c             	shr    $0xc,%eax
+  801ad4:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801adb:	f6 c2 01             	test   $0x1,%dl
+  801ade:	75 36                	jne    801b16 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801ae0:	89 f8                	mov    %edi,%eax
+  801ae2:	c1 e8 0c             	shr    $0xc,%eax
+  801ae5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801aec:	83 ec 0c             	sub    $0xc,%esp
+  801aef:	25 07 0e 00 00       	and    $0xe07,%eax
+  801af4:	50                   	push   %eax
+  801af5:	56                   	push   %esi
+  801af6:	6a 00                	push   $0x0
+  801af8:	57                   	push   %edi
+  801af9:	6a 00                	push   $0x0
+  801afb:	e8 81 f2 ff ff       	call   800d81 <sys_page_map>
+  801b00:	89 c3                	mov    %eax,%ebx
+  801b02:	83 c4 20             	add    $0x20,%esp
+  801b05:	85 c0                	test   %eax,%eax
+  801b07:	78 33                	js     801b3c <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801b09:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801b0c:	89 d8                	mov    %ebx,%eax
+  801b0e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b11:	5b                   	pop    %ebx
+  801b12:	5e                   	pop    %esi
+  801b13:	5f                   	pop    %edi
+  801b14:	5d                   	pop    %ebp
+  801b15:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801b16:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801b1d:	83 ec 0c             	sub    $0xc,%esp
+  801b20:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b25:	50                   	push   %eax
+  801b26:	ff 75 d4             	push   -0x2c(%ebp)
+  801b29:	6a 00                	push   $0x0
+  801b2b:	53                   	push   %ebx
+  801b2c:	6a 00                	push   $0x0
+  801b2e:	e8 4e f2 ff ff       	call   800d81 <sys_page_map>
+  801b33:	89 c3                	mov    %eax,%ebx
+  801b35:	83 c4 20             	add    $0x20,%esp
+  801b38:	85 c0                	test   %eax,%eax
+  801b3a:	79 a4                	jns    801ae0 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801b3c:	83 ec 08             	sub    $0x8,%esp
+  801b3f:	56                   	push   %esi
+  801b40:	6a 00                	push   $0x0
+  801b42:	e8 86 f2 ff ff       	call   800dcd <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801b47:	83 c4 08             	add    $0x8,%esp
+  801b4a:	ff 75 d4             	push   -0x2c(%ebp)
+  801b4d:	6a 00                	push   $0x0
+  801b4f:	e8 79 f2 ff ff       	call   800dcd <sys_page_unmap>
+	return r;
+  801b54:	83 c4 10             	add    $0x10,%esp
+  801b57:	eb b3                	jmp    801b0c <dup+0x9d>
+
+00801b59 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801b59:	55                   	push   %ebp
+  801b5a:	89 e5                	mov    %esp,%ebp
+  801b5c:	56                   	push   %esi
+  801b5d:	53                   	push   %ebx
+  801b5e:	83 ec 18             	sub    $0x18,%esp
+  801b61:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b64:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b67:	50                   	push   %eax
+  801b68:	53                   	push   %ebx
+  801b69:	e8 5b fd ff ff       	call   8018c9 <fd_lookup>
+  801b6e:	83 c4 10             	add    $0x10,%esp
+  801b71:	85 c0                	test   %eax,%eax
+  801b73:	78 3c                	js     801bb1 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801b75:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b78:	83 ec 08             	sub    $0x8,%esp
+  801b7b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b7e:	50                   	push   %eax
+  801b7f:	ff 36                	push   (%esi)
+  801b81:	e8 93 fd ff ff       	call   801919 <dev_lookup>
+  801b86:	83 c4 10             	add    $0x10,%esp
+  801b89:	85 c0                	test   %eax,%eax
+  801b8b:	78 24                	js     801bb1 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801b8d:	8b 46 08             	mov    0x8(%esi),%eax
+  801b90:	83 e0 03             	and    $0x3,%eax
+  801b93:	83 f8 01             	cmp    $0x1,%eax
+  801b96:	74 20                	je     801bb8 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801b98:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b9b:	8b 40 08             	mov    0x8(%eax),%eax
+  801b9e:	85 c0                	test   %eax,%eax
+  801ba0:	74 61                	je     801c03 <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801ba2:	83 ec 04             	sub    $0x4,%esp
+  801ba5:	ff 75 10             	push   0x10(%ebp)
+  801ba8:	ff 75 0c             	push   0xc(%ebp)
+  801bab:	56                   	push   %esi
+  801bac:	ff d0                	call   *%eax
+  801bae:	83 c4 10             	add    $0x10,%esp
+}
+  801bb1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bb4:	5b                   	pop    %ebx
+  801bb5:	5e                   	pop    %esi
+  801bb6:	5d                   	pop    %ebp
+  801bb7:	c3                   	ret
+  801bb8:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801bba:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801bc0:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801bc5:	77 18                	ja     801bdf <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801bc7:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801bcc:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801bce:	c1 e8 10             	shr    $0x10,%eax
+  801bd1:	74 0c                	je     801bdf <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801bd3:	c1 e0 10             	shl    $0x10,%eax
+  801bd6:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801bdb:	29 c2                	sub    %eax,%edx
+  801bdd:	eb 06                	jmp    801be5 <read+0x8c>
+		return pthread_main_tls;
+  801bdf:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801be5:	8b 02                	mov    (%edx),%eax
+  801be7:	8b 40 48             	mov    0x48(%eax),%eax
+  801bea:	83 ec 04             	sub    $0x4,%esp
+  801bed:	53                   	push   %ebx
+  801bee:	50                   	push   %eax
+  801bef:	68 05 55 80 00       	push   $0x805505
+  801bf4:	e8 19 e7 ff ff       	call   800312 <cprintf>
+		return -E_INVAL;
+  801bf9:	83 c4 10             	add    $0x10,%esp
+  801bfc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c01:	eb ae                	jmp    801bb1 <read+0x58>
+		return -E_NOT_SUPP;
+  801c03:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c08:	eb a7                	jmp    801bb1 <read+0x58>
+
+00801c0a <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801c0a:	55                   	push   %ebp
+  801c0b:	89 e5                	mov    %esp,%ebp
+  801c0d:	57                   	push   %edi
+  801c0e:	56                   	push   %esi
+  801c0f:	53                   	push   %ebx
+  801c10:	83 ec 0c             	sub    $0xc,%esp
+  801c13:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801c16:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801c19:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c1e:	eb 02                	jmp    801c22 <readn+0x18>
+  801c20:	01 c3                	add    %eax,%ebx
+  801c22:	39 f3                	cmp    %esi,%ebx
+  801c24:	73 21                	jae    801c47 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801c26:	83 ec 04             	sub    $0x4,%esp
+  801c29:	89 f0                	mov    %esi,%eax
+  801c2b:	29 d8                	sub    %ebx,%eax
+  801c2d:	50                   	push   %eax
+  801c2e:	89 d8                	mov    %ebx,%eax
+  801c30:	03 45 0c             	add    0xc(%ebp),%eax
+  801c33:	50                   	push   %eax
+  801c34:	57                   	push   %edi
+  801c35:	e8 1f ff ff ff       	call   801b59 <read>
+		if (m < 0)
+  801c3a:	83 c4 10             	add    $0x10,%esp
+  801c3d:	85 c0                	test   %eax,%eax
+  801c3f:	78 04                	js     801c45 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801c41:	75 dd                	jne    801c20 <readn+0x16>
+  801c43:	eb 02                	jmp    801c47 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801c45:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801c47:	89 d8                	mov    %ebx,%eax
+  801c49:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c4c:	5b                   	pop    %ebx
+  801c4d:	5e                   	pop    %esi
+  801c4e:	5f                   	pop    %edi
+  801c4f:	5d                   	pop    %ebp
+  801c50:	c3                   	ret
+
+00801c51 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801c51:	55                   	push   %ebp
+  801c52:	89 e5                	mov    %esp,%ebp
+  801c54:	56                   	push   %esi
+  801c55:	53                   	push   %ebx
+  801c56:	83 ec 18             	sub    $0x18,%esp
+  801c59:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c5c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c5f:	50                   	push   %eax
+  801c60:	53                   	push   %ebx
+  801c61:	e8 63 fc ff ff       	call   8018c9 <fd_lookup>
+  801c66:	83 c4 10             	add    $0x10,%esp
+  801c69:	85 c0                	test   %eax,%eax
+  801c6b:	78 37                	js     801ca4 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c6d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c70:	83 ec 08             	sub    $0x8,%esp
+  801c73:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c76:	50                   	push   %eax
+  801c77:	ff 36                	push   (%esi)
+  801c79:	e8 9b fc ff ff       	call   801919 <dev_lookup>
+  801c7e:	83 c4 10             	add    $0x10,%esp
+  801c81:	85 c0                	test   %eax,%eax
+  801c83:	78 1f                	js     801ca4 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c85:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801c89:	74 20                	je     801cab <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801c8b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c8e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c91:	85 c0                	test   %eax,%eax
+  801c93:	74 61                	je     801cf6 <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801c95:	83 ec 04             	sub    $0x4,%esp
+  801c98:	ff 75 10             	push   0x10(%ebp)
+  801c9b:	ff 75 0c             	push   0xc(%ebp)
+  801c9e:	56                   	push   %esi
+  801c9f:	ff d0                	call   *%eax
+  801ca1:	83 c4 10             	add    $0x10,%esp
+}
+  801ca4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ca7:	5b                   	pop    %ebx
+  801ca8:	5e                   	pop    %esi
+  801ca9:	5d                   	pop    %ebp
+  801caa:	c3                   	ret
+  801cab:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801cad:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801cb3:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801cb8:	77 18                	ja     801cd2 <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801cba:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801cbf:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801cc1:	c1 e8 10             	shr    $0x10,%eax
+  801cc4:	74 0c                	je     801cd2 <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801cc6:	c1 e0 10             	shl    $0x10,%eax
+  801cc9:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801cce:	29 c2                	sub    %eax,%edx
+  801cd0:	eb 06                	jmp    801cd8 <write+0x87>
+		return pthread_main_tls;
+  801cd2:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801cd8:	8b 02                	mov    (%edx),%eax
+  801cda:	8b 40 48             	mov    0x48(%eax),%eax
+  801cdd:	83 ec 04             	sub    $0x4,%esp
+  801ce0:	53                   	push   %ebx
+  801ce1:	50                   	push   %eax
+  801ce2:	68 21 55 80 00       	push   $0x805521
+  801ce7:	e8 26 e6 ff ff       	call   800312 <cprintf>
+		return -E_INVAL;
+  801cec:	83 c4 10             	add    $0x10,%esp
+  801cef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801cf4:	eb ae                	jmp    801ca4 <write+0x53>
+		return -E_NOT_SUPP;
+  801cf6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801cfb:	eb a7                	jmp    801ca4 <write+0x53>
+
+00801cfd <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801cfd:	55                   	push   %ebp
+  801cfe:	89 e5                	mov    %esp,%ebp
+  801d00:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d03:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d06:	50                   	push   %eax
+  801d07:	ff 75 08             	push   0x8(%ebp)
+  801d0a:	e8 ba fb ff ff       	call   8018c9 <fd_lookup>
+  801d0f:	83 c4 10             	add    $0x10,%esp
+  801d12:	85 c0                	test   %eax,%eax
+  801d14:	78 0e                	js     801d24 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801d16:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d19:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d1c:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801d1f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d24:	c9                   	leave
+  801d25:	c3                   	ret
+
+00801d26 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801d26:	55                   	push   %ebp
+  801d27:	89 e5                	mov    %esp,%ebp
+  801d29:	56                   	push   %esi
+  801d2a:	53                   	push   %ebx
+  801d2b:	83 ec 18             	sub    $0x18,%esp
+  801d2e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d31:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d34:	50                   	push   %eax
+  801d35:	53                   	push   %ebx
+  801d36:	e8 8e fb ff ff       	call   8018c9 <fd_lookup>
+  801d3b:	83 c4 10             	add    $0x10,%esp
+  801d3e:	85 c0                	test   %eax,%eax
+  801d40:	78 34                	js     801d76 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d42:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d45:	83 ec 08             	sub    $0x8,%esp
+  801d48:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d4b:	50                   	push   %eax
+  801d4c:	ff 36                	push   (%esi)
+  801d4e:	e8 c6 fb ff ff       	call   801919 <dev_lookup>
+  801d53:	83 c4 10             	add    $0x10,%esp
+  801d56:	85 c0                	test   %eax,%eax
+  801d58:	78 1c                	js     801d76 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d5a:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801d5e:	74 1d                	je     801d7d <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801d60:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d63:	8b 40 18             	mov    0x18(%eax),%eax
+  801d66:	85 c0                	test   %eax,%eax
+  801d68:	74 5e                	je     801dc8 <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801d6a:	83 ec 08             	sub    $0x8,%esp
+  801d6d:	ff 75 0c             	push   0xc(%ebp)
+  801d70:	56                   	push   %esi
+  801d71:	ff d0                	call   *%eax
+  801d73:	83 c4 10             	add    $0x10,%esp
+}
+  801d76:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d79:	5b                   	pop    %ebx
+  801d7a:	5e                   	pop    %esi
+  801d7b:	5d                   	pop    %ebp
+  801d7c:	c3                   	ret
+  801d7d:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801d7f:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801d85:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801d8a:	77 18                	ja     801da4 <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801d8c:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801d91:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801d93:	c1 e8 10             	shr    $0x10,%eax
+  801d96:	74 0c                	je     801da4 <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801d98:	c1 e0 10             	shl    $0x10,%eax
+  801d9b:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801da0:	29 c2                	sub    %eax,%edx
+  801da2:	eb 06                	jmp    801daa <ftruncate+0x84>
+		return pthread_main_tls;
+  801da4:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+			thisenv->env_id, fdnum);
+  801daa:	8b 02                	mov    (%edx),%eax
+  801dac:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801daf:	83 ec 04             	sub    $0x4,%esp
+  801db2:	53                   	push   %ebx
+  801db3:	50                   	push   %eax
+  801db4:	68 e4 54 80 00       	push   $0x8054e4
+  801db9:	e8 54 e5 ff ff       	call   800312 <cprintf>
+		return -E_INVAL;
+  801dbe:	83 c4 10             	add    $0x10,%esp
+  801dc1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801dc6:	eb ae                	jmp    801d76 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801dc8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801dcd:	eb a7                	jmp    801d76 <ftruncate+0x50>
+
+00801dcf <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801dcf:	55                   	push   %ebp
+  801dd0:	89 e5                	mov    %esp,%ebp
+  801dd2:	56                   	push   %esi
+  801dd3:	53                   	push   %ebx
+  801dd4:	83 ec 18             	sub    $0x18,%esp
+  801dd7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801dda:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ddd:	50                   	push   %eax
+  801dde:	ff 75 08             	push   0x8(%ebp)
+  801de1:	e8 e3 fa ff ff       	call   8018c9 <fd_lookup>
+  801de6:	83 c4 10             	add    $0x10,%esp
+  801de9:	85 c0                	test   %eax,%eax
+  801deb:	78 49                	js     801e36 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ded:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801df0:	83 ec 08             	sub    $0x8,%esp
+  801df3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801df6:	50                   	push   %eax
+  801df7:	ff 36                	push   (%esi)
+  801df9:	e8 1b fb ff ff       	call   801919 <dev_lookup>
+  801dfe:	83 c4 10             	add    $0x10,%esp
+  801e01:	85 c0                	test   %eax,%eax
+  801e03:	78 31                	js     801e36 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801e05:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e08:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801e0c:	74 2f                	je     801e3d <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801e0e:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801e11:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801e18:	00 00 00 
+	stat->st_isdir = 0;
+  801e1b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801e22:	00 00 00 
+	stat->st_dev = dev;
+  801e25:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801e2b:	83 ec 08             	sub    $0x8,%esp
+  801e2e:	53                   	push   %ebx
+  801e2f:	56                   	push   %esi
+  801e30:	ff 50 14             	call   *0x14(%eax)
+  801e33:	83 c4 10             	add    $0x10,%esp
+}
+  801e36:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e39:	5b                   	pop    %ebx
+  801e3a:	5e                   	pop    %esi
+  801e3b:	5d                   	pop    %ebp
+  801e3c:	c3                   	ret
+		return -E_NOT_SUPP;
+  801e3d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e42:	eb f2                	jmp    801e36 <fstat+0x67>
+
+00801e44 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801e44:	55                   	push   %ebp
+  801e45:	89 e5                	mov    %esp,%ebp
+  801e47:	56                   	push   %esi
+  801e48:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801e49:	83 ec 08             	sub    $0x8,%esp
+  801e4c:	6a 00                	push   $0x0
+  801e4e:	ff 75 08             	push   0x8(%ebp)
+  801e51:	e8 4b 03 00 00       	call   8021a1 <open>
+  801e56:	89 c3                	mov    %eax,%ebx
+  801e58:	83 c4 10             	add    $0x10,%esp
+  801e5b:	85 c0                	test   %eax,%eax
+  801e5d:	78 1b                	js     801e7a <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801e5f:	83 ec 08             	sub    $0x8,%esp
+  801e62:	ff 75 0c             	push   0xc(%ebp)
+  801e65:	50                   	push   %eax
+  801e66:	e8 64 ff ff ff       	call   801dcf <fstat>
+  801e6b:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801e6d:	89 1c 24             	mov    %ebx,(%esp)
+  801e70:	e8 a8 fb ff ff       	call   801a1d <close>
+	return r;
+  801e75:	83 c4 10             	add    $0x10,%esp
+  801e78:	89 f3                	mov    %esi,%ebx
+}
+  801e7a:	89 d8                	mov    %ebx,%eax
+  801e7c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e7f:	5b                   	pop    %ebx
+  801e80:	5e                   	pop    %esi
+  801e81:	5d                   	pop    %ebp
+  801e82:	c3                   	ret
+
+00801e83 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801e83:	55                   	push   %ebp
+  801e84:	89 e5                	mov    %esp,%ebp
+  801e86:	56                   	push   %esi
+  801e87:	53                   	push   %ebx
+  801e88:	89 c6                	mov    %eax,%esi
+  801e8a:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801e8c:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  801e93:	74 27                	je     801ebc <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801e95:	6a 07                	push   $0x7
+  801e97:	68 00 80 80 00       	push   $0x808000
+  801e9c:	56                   	push   %esi
+  801e9d:	ff 35 00 70 80 00    	push   0x807000
+  801ea3:	e8 aa 2c 00 00       	call   804b52 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801ea8:	83 c4 0c             	add    $0xc,%esp
+  801eab:	6a 00                	push   $0x0
+  801ead:	53                   	push   %ebx
+  801eae:	6a 00                	push   $0x0
+  801eb0:	e8 a7 2b 00 00       	call   804a5c <ipc_recv>
+}
+  801eb5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801eb8:	5b                   	pop    %ebx
+  801eb9:	5e                   	pop    %esi
+  801eba:	5d                   	pop    %ebp
+  801ebb:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801ebc:	83 ec 0c             	sub    $0xc,%esp
+  801ebf:	6a 01                	push   $0x1
+  801ec1:	e8 e2 2c 00 00       	call   804ba8 <ipc_find_env>
+  801ec6:	a3 00 70 80 00       	mov    %eax,0x807000
+  801ecb:	83 c4 10             	add    $0x10,%esp
+  801ece:	eb c5                	jmp    801e95 <fsipc+0x12>
+
+00801ed0 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801ed0:	55                   	push   %ebp
+  801ed1:	89 e5                	mov    %esp,%ebp
+  801ed3:	53                   	push   %ebx
+  801ed4:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801ed7:	68 04 70 80 00       	push   $0x807004
+  801edc:	e8 97 21 00 00       	call   804078 <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801ee1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ee4:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ee7:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.set_size.req_size = newsize;
+  801eec:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801eef:	a3 04 80 80 00       	mov    %eax,0x808004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  801ef4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ef9:	b8 02 00 00 00       	mov    $0x2,%eax
+  801efe:	e8 80 ff ff ff       	call   801e83 <fsipc>
+  801f03:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801f05:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801f0c:	e8 d4 21 00 00       	call   8040e5 <mutex_unlock>
+	return r;
+}
+  801f11:	89 d8                	mov    %ebx,%eax
+  801f13:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f16:	c9                   	leave
+  801f17:	c3                   	ret
+
+00801f18 <devfile_flush>:
+{
+  801f18:	55                   	push   %ebp
+  801f19:	89 e5                	mov    %esp,%ebp
+  801f1b:	53                   	push   %ebx
+  801f1c:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  801f1f:	68 04 70 80 00       	push   $0x807004
+  801f24:	e8 4f 21 00 00       	call   804078 <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801f29:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f2c:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f2f:	a3 00 80 80 00       	mov    %eax,0x808000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  801f34:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f39:	b8 06 00 00 00       	mov    $0x6,%eax
+  801f3e:	e8 40 ff ff ff       	call   801e83 <fsipc>
+  801f43:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801f45:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801f4c:	e8 94 21 00 00       	call   8040e5 <mutex_unlock>
+}
+  801f51:	89 d8                	mov    %ebx,%eax
+  801f53:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f56:	c9                   	leave
+  801f57:	c3                   	ret
+
+00801f58 <devfile_stat>:
+{
+  801f58:	55                   	push   %ebp
+  801f59:	89 e5                	mov    %esp,%ebp
+  801f5b:	56                   	push   %esi
+  801f5c:	53                   	push   %ebx
+  801f5d:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  801f60:	83 ec 0c             	sub    $0xc,%esp
+  801f63:	68 04 70 80 00       	push   $0x807004
+  801f68:	e8 0b 21 00 00       	call   804078 <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801f6d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f70:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f73:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  801f78:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f7d:	b8 05 00 00 00       	mov    $0x5,%eax
+  801f82:	e8 fc fe ff ff       	call   801e83 <fsipc>
+  801f87:	89 c3                	mov    %eax,%ebx
+  801f89:	83 c4 10             	add    $0x10,%esp
+  801f8c:	85 c0                	test   %eax,%eax
+  801f8e:	79 16                	jns    801fa6 <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  801f90:	83 ec 0c             	sub    $0xc,%esp
+  801f93:	68 04 70 80 00       	push   $0x807004
+  801f98:	e8 48 21 00 00       	call   8040e5 <mutex_unlock>
+}
+  801f9d:	89 d8                	mov    %ebx,%eax
+  801f9f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fa2:	5b                   	pop    %ebx
+  801fa3:	5e                   	pop    %esi
+  801fa4:	5d                   	pop    %ebp
+  801fa5:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801fa6:	83 ec 08             	sub    $0x8,%esp
+  801fa9:	68 00 80 80 00       	push   $0x808000
+  801fae:	56                   	push   %esi
+  801faf:	e8 42 e9 ff ff       	call   8008f6 <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  801fb4:	a1 80 80 80 00       	mov    0x808080,%eax
+  801fb9:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801fbf:	a1 84 80 80 00       	mov    0x808084,%eax
+  801fc4:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  801fca:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  801fcd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801fd2:	eb bc                	jmp    801f90 <devfile_stat+0x38>
+
+00801fd4 <devfile_write>:
+{
+  801fd4:	55                   	push   %ebp
+  801fd5:	89 e5                	mov    %esp,%ebp
+  801fd7:	53                   	push   %ebx
+  801fd8:	83 ec 10             	sub    $0x10,%esp
+  801fdb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  801fde:	68 04 70 80 00       	push   $0x807004
+  801fe3:	e8 90 20 00 00       	call   804078 <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801fe8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801feb:	8b 40 0c             	mov    0xc(%eax),%eax
+  801fee:	a3 00 80 80 00       	mov    %eax,0x808000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801ff3:	83 c4 10             	add    $0x10,%esp
+  801ff6:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  801ffc:	76 3d                	jbe    80203b <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  801ffe:	b8 00 00 10 00       	mov    $0x100000,%eax
+  802003:	39 c3                	cmp    %eax,%ebx
+  802005:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  802008:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80200b:	a3 08 80 80 00       	mov    %eax,0x808008
+	fsipcbuf.write.req_n = n;
+  802010:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	r = fsipc(FSREQ_WRITE, NULL);
+  802016:	ba 00 00 00 00       	mov    $0x0,%edx
+  80201b:	b8 04 00 00 00       	mov    $0x4,%eax
+  802020:	e8 5e fe ff ff       	call   801e83 <fsipc>
+  802025:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802027:	83 ec 0c             	sub    $0xc,%esp
+  80202a:	68 04 70 80 00       	push   $0x807004
+  80202f:	e8 b1 20 00 00       	call   8040e5 <mutex_unlock>
+}
+  802034:	89 d8                	mov    %ebx,%eax
+  802036:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802039:	c9                   	leave
+  80203a:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  80203b:	83 ec 04             	sub    $0x4,%esp
+  80203e:	53                   	push   %ebx
+  80203f:	ff 75 0c             	push   0xc(%ebp)
+  802042:	68 0c 80 80 00       	push   $0x80800c
+  802047:	e8 30 ea ff ff       	call   800a7c <memmove>
+  80204c:	83 c4 10             	add    $0x10,%esp
+  80204f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802054:	eb b5                	jmp    80200b <devfile_write+0x37>
+
+00802056 <devfile_read>:
+{
+  802056:	55                   	push   %ebp
+  802057:	89 e5                	mov    %esp,%ebp
+  802059:	57                   	push   %edi
+  80205a:	56                   	push   %esi
+  80205b:	53                   	push   %ebx
+  80205c:	83 ec 0c             	sub    $0xc,%esp
+  80205f:	8b 75 08             	mov    0x8(%ebp),%esi
+  802062:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802065:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  802068:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  80206e:	0f 86 8c 00 00 00    	jbe    802100 <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  802074:	b8 00 00 10 00       	mov    $0x100000,%eax
+  802079:	39 c3                	cmp    %eax,%ebx
+  80207b:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  80207e:	89 f8                	mov    %edi,%eax
+  802080:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  802083:	eb 0f                	jmp    802094 <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  802085:	0f b6 08             	movzbl (%eax),%ecx
+  802088:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  80208a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80208f:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  802094:	39 d0                	cmp    %edx,%eax
+  802096:	72 ed                	jb     802085 <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  802098:	83 ec 0c             	sub    $0xc,%esp
+  80209b:	68 04 70 80 00       	push   $0x807004
+  8020a0:	e8 d3 1f 00 00       	call   804078 <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8020a5:	8b 46 0c             	mov    0xc(%esi),%eax
+  8020a8:	a3 00 80 80 00       	mov    %eax,0x808000
+		fsipcbuf.read.req_n = n;
+  8020ad:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  8020b3:	89 3d 08 80 80 00    	mov    %edi,0x808008
+		r = fsipc(FSREQ_READ, NULL);
+  8020b9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020be:	b8 03 00 00 00       	mov    $0x3,%eax
+  8020c3:	e8 bb fd ff ff       	call   801e83 <fsipc>
+  8020c8:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  8020ca:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  8020d1:	e8 0f 20 00 00       	call   8040e5 <mutex_unlock>
+		assert(r <= (int) n);
+  8020d6:	83 c4 10             	add    $0x10,%esp
+  8020d9:	39 f3                	cmp    %esi,%ebx
+  8020db:	7c 0a                	jl     8020e7 <devfile_read+0x91>
+}
+  8020dd:	89 f0                	mov    %esi,%eax
+  8020df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020e2:	5b                   	pop    %ebx
+  8020e3:	5e                   	pop    %esi
+  8020e4:	5f                   	pop    %edi
+  8020e5:	5d                   	pop    %ebp
+  8020e6:	c3                   	ret
+		assert(r <= (int) n);
+  8020e7:	68 54 55 80 00       	push   $0x805554
+  8020ec:	68 91 54 80 00       	push   $0x805491
+  8020f1:	68 90 00 00 00       	push   $0x90
+  8020f6:	68 61 55 80 00       	push   $0x805561
+  8020fb:	e8 37 e1 ff ff       	call   800237 <_panic>
+	mutex_lock(&fsipc_mu);
+  802100:	83 ec 0c             	sub    $0xc,%esp
+  802103:	68 04 70 80 00       	push   $0x807004
+  802108:	e8 6b 1f 00 00       	call   804078 <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80210d:	8b 46 0c             	mov    0xc(%esi),%eax
+  802110:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.read.req_n = n;
+  802115:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	fsipcbuf.read.req_va = 0;
+  80211b:	c7 05 08 80 80 00 00 	movl   $0x0,0x808008
+  802122:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  802125:	ba 00 00 00 00       	mov    $0x0,%edx
+  80212a:	b8 03 00 00 00       	mov    $0x3,%eax
+  80212f:	e8 4f fd ff ff       	call   801e83 <fsipc>
+  802134:	89 c6                	mov    %eax,%esi
+  802136:	83 c4 10             	add    $0x10,%esp
+  802139:	85 c0                	test   %eax,%eax
+  80213b:	78 1d                	js     80215a <devfile_read+0x104>
+		assert(r <= n);
+  80213d:	39 c3                	cmp    %eax,%ebx
+  80213f:	72 2e                	jb     80216f <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  802141:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802146:	7f 40                	jg     802188 <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  802148:	83 ec 04             	sub    $0x4,%esp
+  80214b:	50                   	push   %eax
+  80214c:	68 00 80 80 00       	push   $0x808000
+  802151:	57                   	push   %edi
+  802152:	e8 25 e9 ff ff       	call   800a7c <memmove>
+  802157:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  80215a:	83 ec 0c             	sub    $0xc,%esp
+  80215d:	68 04 70 80 00       	push   $0x807004
+  802162:	e8 7e 1f 00 00       	call   8040e5 <mutex_unlock>
+	return r;
+  802167:	83 c4 10             	add    $0x10,%esp
+  80216a:	e9 6e ff ff ff       	jmp    8020dd <devfile_read+0x87>
+		assert(r <= n);
+  80216f:	68 6c 55 80 00       	push   $0x80556c
+  802174:	68 91 54 80 00       	push   $0x805491
+  802179:	68 99 00 00 00       	push   $0x99
+  80217e:	68 61 55 80 00       	push   $0x805561
+  802183:	e8 af e0 ff ff       	call   800237 <_panic>
+		assert(r <= PGSIZE);
+  802188:	68 73 55 80 00       	push   $0x805573
+  80218d:	68 91 54 80 00       	push   $0x805491
+  802192:	68 9a 00 00 00       	push   $0x9a
+  802197:	68 61 55 80 00       	push   $0x805561
+  80219c:	e8 96 e0 ff ff       	call   800237 <_panic>
+
+008021a1 <open>:
+{
+  8021a1:	55                   	push   %ebp
+  8021a2:	89 e5                	mov    %esp,%ebp
+  8021a4:	56                   	push   %esi
+  8021a5:	53                   	push   %ebx
+  8021a6:	83 ec 1c             	sub    $0x1c,%esp
+  8021a9:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  8021ac:	56                   	push   %esi
+  8021ad:	e8 09 e7 ff ff       	call   8008bb <strlen>
+  8021b2:	83 c4 10             	add    $0x10,%esp
+  8021b5:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8021ba:	0f 8f 85 00 00 00    	jg     802245 <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  8021c0:	83 ec 0c             	sub    $0xc,%esp
+  8021c3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021c6:	50                   	push   %eax
+  8021c7:	e8 a7 f6 ff ff       	call   801873 <fd_alloc>
+  8021cc:	89 c3                	mov    %eax,%ebx
+  8021ce:	83 c4 10             	add    $0x10,%esp
+  8021d1:	85 c0                	test   %eax,%eax
+  8021d3:	78 55                	js     80222a <open+0x89>
+	mutex_lock(&fsipc_mu);
+  8021d5:	83 ec 0c             	sub    $0xc,%esp
+  8021d8:	68 04 70 80 00       	push   $0x807004
+  8021dd:	e8 96 1e 00 00       	call   804078 <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  8021e2:	83 c4 08             	add    $0x8,%esp
+  8021e5:	56                   	push   %esi
+  8021e6:	68 00 80 80 00       	push   $0x808000
+  8021eb:	e8 06 e7 ff ff       	call   8008f6 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8021f0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021f3:	a3 00 84 80 00       	mov    %eax,0x808400
+	r = fsipc(FSREQ_OPEN, fd);
+  8021f8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8021fb:	b8 01 00 00 00       	mov    $0x1,%eax
+  802200:	e8 7e fc ff ff       	call   801e83 <fsipc>
+  802205:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802207:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  80220e:	e8 d2 1e 00 00       	call   8040e5 <mutex_unlock>
+	if (r < 0) {
+  802213:	83 c4 10             	add    $0x10,%esp
+  802216:	85 db                	test   %ebx,%ebx
+  802218:	78 19                	js     802233 <open+0x92>
+	return fd2num(fd);
+  80221a:	83 ec 0c             	sub    $0xc,%esp
+  80221d:	ff 75 f4             	push   -0xc(%ebp)
+  802220:	e8 27 f6 ff ff       	call   80184c <fd2num>
+  802225:	89 c3                	mov    %eax,%ebx
+  802227:	83 c4 10             	add    $0x10,%esp
+}
+  80222a:	89 d8                	mov    %ebx,%eax
+  80222c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80222f:	5b                   	pop    %ebx
+  802230:	5e                   	pop    %esi
+  802231:	5d                   	pop    %ebp
+  802232:	c3                   	ret
+		fd_close(fd, 0);
+  802233:	83 ec 08             	sub    $0x8,%esp
+  802236:	6a 00                	push   $0x0
+  802238:	ff 75 f4             	push   -0xc(%ebp)
+  80223b:	e8 56 f7 ff ff       	call   801996 <fd_close>
+		return r;
+  802240:	83 c4 10             	add    $0x10,%esp
+  802243:	eb e5                	jmp    80222a <open+0x89>
+		return -E_BAD_PATH;
+  802245:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80224a:	eb de                	jmp    80222a <open+0x89>
+
+0080224c <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  80224c:	55                   	push   %ebp
+  80224d:	89 e5                	mov    %esp,%ebp
+  80224f:	53                   	push   %ebx
+  802250:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802253:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802256:	50                   	push   %eax
+  802257:	ff 75 08             	push   0x8(%ebp)
+  80225a:	e8 6a f6 ff ff       	call   8018c9 <fd_lookup>
+  80225f:	89 c3                	mov    %eax,%ebx
+  802261:	83 c4 10             	add    $0x10,%esp
+  802264:	85 c0                	test   %eax,%eax
+  802266:	78 5b                	js     8022c3 <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  802268:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80226b:	8b 0d 0c 60 80 00    	mov    0x80600c,%ecx
+  802271:	39 08                	cmp    %ecx,(%eax)
+  802273:	75 55                	jne    8022ca <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  802275:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802279:	74 56                	je     8022d1 <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  80227b:	83 ec 0c             	sub    $0xc,%esp
+  80227e:	68 04 70 80 00       	push   $0x807004
+  802283:	e8 f0 1d 00 00       	call   804078 <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  802288:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80228b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80228e:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.allocate.req_offset = offset;
+  802293:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802296:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.allocate.req_len = len;
+  80229b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80229e:	a3 08 80 80 00       	mov    %eax,0x808008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  8022a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022a8:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8022ad:	e8 d1 fb ff ff       	call   801e83 <fsipc>
+  8022b2:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8022b4:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  8022bb:	e8 25 1e 00 00       	call   8040e5 <mutex_unlock>
+	return r;
+  8022c0:	83 c4 10             	add    $0x10,%esp
+}
+  8022c3:	89 d8                	mov    %ebx,%eax
+  8022c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022c8:	c9                   	leave
+  8022c9:	c3                   	ret
+		return -E_NOT_SUPP;
+  8022ca:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8022cf:	eb f2                	jmp    8022c3 <fallocate+0x77>
+		return -E_INVAL;
+  8022d1:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8022d6:	eb eb                	jmp    8022c3 <fallocate+0x77>
+
+008022d8 <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  8022d8:	55                   	push   %ebp
+  8022d9:	89 e5                	mov    %esp,%ebp
+  8022db:	56                   	push   %esi
+  8022dc:	53                   	push   %ebx
+  8022dd:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  8022e0:	89 f3                	mov    %esi,%ebx
+  8022e2:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  8022e8:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  8022eb:	eb 06                	jmp    8022f3 <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  8022ed:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8022f3:	39 f3                	cmp    %esi,%ebx
+  8022f5:	73 14                	jae    80230b <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  8022f7:	83 ec 08             	sub    $0x8,%esp
+  8022fa:	53                   	push   %ebx
+  8022fb:	6a 00                	push   $0x0
+  8022fd:	e8 cb ea ff ff       	call   800dcd <sys_page_unmap>
+  802302:	83 c4 10             	add    $0x10,%esp
+  802305:	85 c0                	test   %eax,%eax
+  802307:	79 e4                	jns    8022ed <munmap+0x15>
+  802309:	eb 05                	jmp    802310 <munmap+0x38>
+			return r;
+	return 0;
+  80230b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802310:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802313:	5b                   	pop    %ebx
+  802314:	5e                   	pop    %esi
+  802315:	5d                   	pop    %ebp
+  802316:	c3                   	ret
+
+00802317 <mmap>:
+{
+  802317:	55                   	push   %ebp
+  802318:	89 e5                	mov    %esp,%ebp
+  80231a:	57                   	push   %edi
+  80231b:	56                   	push   %esi
+  80231c:	53                   	push   %ebx
+  80231d:	83 ec 24             	sub    $0x24,%esp
+  802320:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802323:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802326:	50                   	push   %eax
+  802327:	ff 75 08             	push   0x8(%ebp)
+  80232a:	e8 9a f5 ff ff       	call   8018c9 <fd_lookup>
+  80232f:	83 c4 10             	add    $0x10,%esp
+  802332:	85 c0                	test   %eax,%eax
+  802334:	0f 88 37 01 00 00    	js     802471 <mmap+0x15a>
+		return NULL;
+  80233a:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  80233f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802342:	8b 0d 0c 60 80 00    	mov    0x80600c,%ecx
+  802348:	39 0a                	cmp    %ecx,(%edx)
+  80234a:	0f 85 05 01 00 00    	jne    802455 <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  802350:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  802357:	0f 85 1b 01 00 00    	jne    802478 <mmap+0x161>
+  80235d:	89 f0                	mov    %esi,%eax
+  80235f:	83 e8 01             	sub    $0x1,%eax
+  802362:	0f 88 17 01 00 00    	js     80247f <mmap+0x168>
+	if (prot & PROT_WRITE)
+  802368:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  80236c:	75 28                	jne    802396 <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  80236e:	83 ec 0c             	sub    $0xc,%esp
+  802371:	68 04 70 80 00       	push   $0x807004
+  802376:	e8 fd 1c 00 00       	call   804078 <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  80237b:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  802381:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  802387:	83 c4 10             	add    $0x10,%esp
+  80238a:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  80238f:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  802394:	eb 2b                	jmp    8023c1 <mmap+0xaa>
+		cow_enable();
+  802396:	e8 40 f0 ff ff       	call   8013db <cow_enable>
+  80239b:	eb d1                	jmp    80236e <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  80239d:	89 c2                	mov    %eax,%edx
+  80239f:	c1 ea 0c             	shr    $0xc,%edx
+  8023a2:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  8023a9:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8023af:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  8023b5:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  8023b8:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  8023ba:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  8023bf:	77 25                	ja     8023e6 <mmap+0xcf>
+  8023c1:	89 c2                	mov    %eax,%edx
+  8023c3:	29 da                	sub    %ebx,%edx
+  8023c5:	39 ca                	cmp    %ecx,%edx
+  8023c7:	73 3a                	jae    802403 <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  8023c9:	89 c2                	mov    %eax,%edx
+  8023cb:	c1 ea 16             	shr    $0x16,%edx
+  8023ce:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8023d5:	f6 c2 01             	test   $0x1,%dl
+  8023d8:	75 c3                	jne    80239d <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  8023da:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  8023df:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  8023e4:	eb d4                	jmp    8023ba <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  8023e6:	29 d8                	sub    %ebx,%eax
+  8023e8:	39 c8                	cmp    %ecx,%eax
+  8023ea:	73 17                	jae    802403 <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  8023ec:	83 ec 0c             	sub    $0xc,%esp
+  8023ef:	68 04 70 80 00       	push   $0x807004
+  8023f4:	e8 ec 1c 00 00       	call   8040e5 <mutex_unlock>
+		return NULL;
+  8023f9:	83 c4 10             	add    $0x10,%esp
+  8023fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802401:	eb 52                	jmp    802455 <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  802403:	85 db                	test   %ebx,%ebx
+  802405:	74 e5                	je     8023ec <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802407:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80240a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80240d:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.map.req_offset = offset;
+  802412:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802415:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.map.req_len = len;
+  80241a:	89 35 08 80 80 00    	mov    %esi,0x808008
+	fsipcbuf.map.req_va = va;
+  802420:	89 1d 0c 80 80 00    	mov    %ebx,0x80800c
+	fsipcbuf.map.req_prot = prot;
+  802426:	8b 45 14             	mov    0x14(%ebp),%eax
+  802429:	a3 10 80 80 00       	mov    %eax,0x808010
+	r = fsipc(FSREQ_MAP, NULL);
+  80242e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802433:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802438:	e8 46 fa ff ff       	call   801e83 <fsipc>
+  80243d:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  80243f:	83 ec 0c             	sub    $0xc,%esp
+  802442:	68 04 70 80 00       	push   $0x807004
+  802447:	e8 99 1c 00 00       	call   8040e5 <mutex_unlock>
+	if (r < 0) {
+  80244c:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  80244f:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  802451:	85 ff                	test   %edi,%edi
+  802453:	78 08                	js     80245d <mmap+0x146>
+}
+  802455:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802458:	5b                   	pop    %ebx
+  802459:	5e                   	pop    %esi
+  80245a:	5f                   	pop    %edi
+  80245b:	5d                   	pop    %ebp
+  80245c:	c3                   	ret
+		munmap((void*) va, len);
+  80245d:	83 ec 08             	sub    $0x8,%esp
+  802460:	56                   	push   %esi
+  802461:	53                   	push   %ebx
+  802462:	e8 71 fe ff ff       	call   8022d8 <munmap>
+		return NULL;
+  802467:	83 c4 10             	add    $0x10,%esp
+  80246a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80246f:	eb e4                	jmp    802455 <mmap+0x13e>
+		return NULL;
+  802471:	b8 00 00 00 00       	mov    $0x0,%eax
+  802476:	eb dd                	jmp    802455 <mmap+0x13e>
+		return NULL;
+  802478:	b8 00 00 00 00       	mov    $0x0,%eax
+  80247d:	eb d6                	jmp    802455 <mmap+0x13e>
+  80247f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802484:	eb cf                	jmp    802455 <mmap+0x13e>
+
+00802486 <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  802486:	55                   	push   %ebp
+  802487:	89 e5                	mov    %esp,%ebp
+  802489:	53                   	push   %ebx
+  80248a:	83 ec 10             	sub    $0x10,%esp
+  80248d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802490:	53                   	push   %ebx
+  802491:	e8 25 e4 ff ff       	call   8008bb <strlen>
+  802496:	83 c4 10             	add    $0x10,%esp
+  802499:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80249e:	7f 42                	jg     8024e2 <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  8024a0:	83 ec 0c             	sub    $0xc,%esp
+  8024a3:	68 04 70 80 00       	push   $0x807004
+  8024a8:	e8 cb 1b 00 00       	call   804078 <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  8024ad:	83 c4 08             	add    $0x8,%esp
+  8024b0:	53                   	push   %ebx
+  8024b1:	68 00 80 80 00       	push   $0x808000
+  8024b6:	e8 3b e4 ff ff       	call   8008f6 <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  8024bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024c0:	b8 07 00 00 00       	mov    $0x7,%eax
+  8024c5:	e8 b9 f9 ff ff       	call   801e83 <fsipc>
+  8024ca:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8024cc:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  8024d3:	e8 0d 1c 00 00       	call   8040e5 <mutex_unlock>
+	return r;
+  8024d8:	83 c4 10             	add    $0x10,%esp
+}
+  8024db:	89 d8                	mov    %ebx,%eax
+  8024dd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024e0:	c9                   	leave
+  8024e1:	c3                   	ret
+		return -E_BAD_PATH;
+  8024e2:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8024e7:	eb f2                	jmp    8024db <remove+0x55>
+
+008024e9 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8024e9:	55                   	push   %ebp
+  8024ea:	89 e5                	mov    %esp,%ebp
+  8024ec:	53                   	push   %ebx
+  8024ed:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  8024f0:	68 04 70 80 00       	push   $0x807004
+  8024f5:	e8 7e 1b 00 00       	call   804078 <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  8024fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024ff:	b8 08 00 00 00       	mov    $0x8,%eax
+  802504:	e8 7a f9 ff ff       	call   801e83 <fsipc>
+  802509:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80250b:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  802512:	e8 ce 1b 00 00       	call   8040e5 <mutex_unlock>
+	return r;
+}
+  802517:	89 d8                	mov    %ebx,%eax
+  802519:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80251c:	c9                   	leave
+  80251d:	c3                   	ret
+
+0080251e <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  80251e:	55                   	push   %ebp
+  80251f:	89 e5                	mov    %esp,%ebp
+  802521:	56                   	push   %esi
+  802522:	53                   	push   %ebx
+  802523:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  802526:	83 ec 0c             	sub    $0xc,%esp
+  802529:	68 04 70 80 00       	push   $0x807004
+  80252e:	e8 45 1b 00 00       	call   804078 <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  802533:	8b 45 08             	mov    0x8(%ebp),%eax
+  802536:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  80253b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802540:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802545:	e8 39 f9 ff ff       	call   801e83 <fsipc>
+  80254a:	89 c6                	mov    %eax,%esi
+  80254c:	83 c4 10             	add    $0x10,%esp
+  80254f:	85 db                	test   %ebx,%ebx
+  802551:	74 7b                	je     8025ce <fs_bcstat+0xb0>
+  802553:	85 c0                	test   %eax,%eax
+  802555:	78 77                	js     8025ce <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  802557:	a1 00 80 80 00       	mov    0x808000,%eax
+  80255c:	89 03                	mov    %eax,(%ebx)
+  80255e:	a1 04 80 80 00       	mov    0x808004,%eax
+  802563:	89 43 04             	mov    %eax,0x4(%ebx)
+  802566:	a1 08 80 80 00       	mov    0x808008,%eax
+  80256b:	89 43 08             	mov    %eax,0x8(%ebx)
+  80256e:	a1 0c 80 80 00       	mov    0x80800c,%eax
+  802573:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802576:	a1 10 80 80 00       	mov    0x808010,%eax
+  80257b:	89 43 10             	mov    %eax,0x10(%ebx)
+  80257e:	a1 14 80 80 00       	mov    0x808014,%eax
+  802583:	89 43 14             	mov    %eax,0x14(%ebx)
+  802586:	a1 18 80 80 00       	mov    0x808018,%eax
+  80258b:	89 43 18             	mov    %eax,0x18(%ebx)
+  80258e:	a1 1c 80 80 00       	mov    0x80801c,%eax
+  802593:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  802596:	a1 20 80 80 00       	mov    0x808020,%eax
+  80259b:	89 43 20             	mov    %eax,0x20(%ebx)
+  80259e:	a1 24 80 80 00       	mov    0x808024,%eax
+  8025a3:	89 43 24             	mov    %eax,0x24(%ebx)
+  8025a6:	a1 28 80 80 00       	mov    0x808028,%eax
+  8025ab:	89 43 28             	mov    %eax,0x28(%ebx)
+  8025ae:	a1 2c 80 80 00       	mov    0x80802c,%eax
+  8025b3:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  8025b6:	a1 30 80 80 00       	mov    0x808030,%eax
+  8025bb:	89 43 30             	mov    %eax,0x30(%ebx)
+  8025be:	a1 34 80 80 00       	mov    0x808034,%eax
+  8025c3:	89 43 34             	mov    %eax,0x34(%ebx)
+  8025c6:	a1 38 80 80 00       	mov    0x808038,%eax
+  8025cb:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  8025ce:	83 ec 0c             	sub    $0xc,%esp
+  8025d1:	68 04 70 80 00       	push   $0x807004
+  8025d6:	e8 0a 1b 00 00       	call   8040e5 <mutex_unlock>
+	return r;
+}
+  8025db:	89 f0                	mov    %esi,%eax
+  8025dd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025e0:	5b                   	pop    %ebx
+  8025e1:	5e                   	pop    %esi
+  8025e2:	5d                   	pop    %ebp
+  8025e3:	c3                   	ret
+
+008025e4 <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  8025e4:	55                   	push   %ebp
+  8025e5:	89 e5                	mov    %esp,%ebp
+  8025e7:	56                   	push   %esi
+  8025e8:	53                   	push   %ebx
+  8025e9:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  8025eb:	0f b6 10             	movzbl (%eax),%edx
+  8025ee:	80 fa 72             	cmp    $0x72,%dl
+  8025f1:	74 44                	je     802637 <parse_mode+0x53>
+  8025f3:	80 fa 77             	cmp    $0x77,%dl
+  8025f6:	74 4b                	je     802643 <parse_mode+0x5f>
+  8025f8:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8025fd:	80 fa 61             	cmp    $0x61,%dl
+  802600:	74 09                	je     80260b <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  802602:	89 d8                	mov    %ebx,%eax
+  802604:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802607:	5b                   	pop    %ebx
+  802608:	5e                   	pop    %esi
+  802609:	5d                   	pop    %ebp
+  80260a:	c3                   	ret
+	switch (mode[0]) {
+  80260b:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  802610:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  802615:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  802617:	83 ec 08             	sub    $0x8,%esp
+  80261a:	6a 2b                	push   $0x2b
+  80261c:	50                   	push   %eax
+  80261d:	e8 e6 e3 ff ff       	call   800a08 <strchr>
+  802622:	83 c4 10             	add    $0x10,%esp
+  802625:	85 c0                	test   %eax,%eax
+  802627:	74 d9                	je     802602 <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  802629:	83 e3 fc             	and    $0xfffffffc,%ebx
+  80262c:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  80262f:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  802635:	eb cb                	jmp    802602 <parse_mode+0x1e>
+	switch (mode[0]) {
+  802637:	ba 01 00 00 00       	mov    $0x1,%edx
+  80263c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802641:	eb d2                	jmp    802615 <parse_mode+0x31>
+  802643:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  802648:	bb 01 03 00 00       	mov    $0x301,%ebx
+  80264d:	eb c6                	jmp    802615 <parse_mode+0x31>
+
+0080264f <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  80264f:	55                   	push   %ebp
+  802650:	89 e5                	mov    %esp,%ebp
+  802652:	57                   	push   %edi
+  802653:	56                   	push   %esi
+  802654:	53                   	push   %ebx
+  802655:	83 ec 1c             	sub    $0x1c,%esp
+  802658:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80265b:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  80265e:	b8 44 60 80 00       	mov    $0x806044,%eax
+  802663:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  802668:	83 c0 24             	add    $0x24,%eax
+  80266b:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  80266f:	74 17                	je     802688 <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  802671:	83 c3 01             	add    $0x1,%ebx
+  802674:	83 fb 10             	cmp    $0x10,%ebx
+  802677:	75 ef                	jne    802668 <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  802679:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  80267e:	89 f0                	mov    %esi,%eax
+  802680:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802683:	5b                   	pop    %ebx
+  802684:	5e                   	pop    %esi
+  802685:	5f                   	pop    %edi
+  802686:	5d                   	pop    %ebp
+  802687:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  802688:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  80268f:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802692:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  802695:	c1 e7 02             	shl    $0x2,%edi
+  802698:	8d b7 40 60 80 00    	lea    0x806040(%edi),%esi
+  80269e:	83 ec 04             	sub    $0x4,%esp
+  8026a1:	6a 24                	push   $0x24
+  8026a3:	6a 00                	push   $0x0
+  8026a5:	56                   	push   %esi
+  8026a6:	e8 9c e3 ff ff       	call   800a47 <memset>
+			streams[i].f_fd = fd;
+  8026ab:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8026ae:	89 8f 40 60 80 00    	mov    %ecx,0x806040(%edi)
+			streams[i].f_flags = flags;
+  8026b4:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8026b7:	01 d8                	add    %ebx,%eax
+  8026b9:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8026bc:	89 0c 85 44 60 80 00 	mov    %ecx,0x806044(,%eax,4)
+			return &streams[i];
+  8026c3:	83 c4 10             	add    $0x10,%esp
+  8026c6:	eb b6                	jmp    80267e <stream_alloc+0x2f>
+
+008026c8 <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  8026c8:	55                   	push   %ebp
+  8026c9:	89 e5                	mov    %esp,%ebp
+  8026cb:	53                   	push   %ebx
+  8026cc:	83 ec 14             	sub    $0x14,%esp
+  8026cf:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  8026d1:	8b 40 18             	mov    0x18(%eax),%eax
+  8026d4:	39 43 14             	cmp    %eax,0x14(%ebx)
+  8026d7:	74 4a                	je     802723 <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  8026d9:	83 ec 08             	sub    $0x8,%esp
+  8026dc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026df:	50                   	push   %eax
+  8026e0:	ff 33                	push   (%ebx)
+  8026e2:	e8 e2 f1 ff ff       	call   8018c9 <fd_lookup>
+  8026e7:	89 c2                	mov    %eax,%edx
+  8026e9:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8026ec:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  8026f1:	85 d2                	test   %edx,%edx
+  8026f3:	78 41                	js     802736 <stream_unread+0x6e>
+  8026f5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8026f8:	8b 0d 0c 60 80 00    	mov    0x80600c,%ecx
+  8026fe:	39 0a                	cmp    %ecx,(%edx)
+  802700:	75 34                	jne    802736 <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  802702:	8b 43 14             	mov    0x14(%ebx),%eax
+  802705:	03 42 04             	add    0x4(%edx),%eax
+  802708:	2b 43 18             	sub    0x18(%ebx),%eax
+  80270b:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  80270e:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  802715:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  80271c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802721:	eb 13                	jmp    802736 <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  802723:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  80272a:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  802731:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802736:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802739:	c9                   	leave
+  80273a:	c3                   	ret
+
+0080273b <stream_drain>:
+{
+  80273b:	55                   	push   %ebp
+  80273c:	89 e5                	mov    %esp,%ebp
+  80273e:	56                   	push   %esi
+  80273f:	53                   	push   %ebx
+  802740:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  802742:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802747:	eb 02                	jmp    80274b <stream_drain+0x10>
+  802749:	01 c3                	add    %eax,%ebx
+  80274b:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80274e:	39 c3                	cmp    %eax,%ebx
+  802750:	73 43                	jae    802795 <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  802752:	83 ec 04             	sub    $0x4,%esp
+  802755:	29 d8                	sub    %ebx,%eax
+  802757:	50                   	push   %eax
+  802758:	89 d8                	mov    %ebx,%eax
+  80275a:	03 46 0c             	add    0xc(%esi),%eax
+  80275d:	50                   	push   %eax
+  80275e:	ff 36                	push   (%esi)
+  802760:	e8 ec f4 ff ff       	call   801c51 <write>
+  802765:	83 c4 10             	add    $0x10,%esp
+  802768:	85 c0                	test   %eax,%eax
+  80276a:	7f dd                	jg     802749 <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  80276c:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  802770:	8b 56 0c             	mov    0xc(%esi),%edx
+  802773:	83 ec 04             	sub    $0x4,%esp
+  802776:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802779:	29 d8                	sub    %ebx,%eax
+  80277b:	50                   	push   %eax
+  80277c:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  80277f:	50                   	push   %eax
+  802780:	52                   	push   %edx
+  802781:	e8 f6 e2 ff ff       	call   800a7c <memmove>
+			f->f_wend -= done;
+  802786:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802789:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  80278b:	83 c4 10             	add    $0x10,%esp
+  80278e:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  802793:	eb 0a                	jmp    80279f <stream_drain+0x64>
+  802795:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  80279a:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  80279f:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  8027a2:	89 d0                	mov    %edx,%eax
+  8027a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027a7:	5b                   	pop    %ebx
+  8027a8:	5e                   	pop    %esi
+  8027a9:	5d                   	pop    %ebp
+  8027aa:	c3                   	ret
+
+008027ab <stream_setup>:
+	if (f->f_buf)
+  8027ab:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8027af:	74 01                	je     8027b2 <stream_setup+0x7>
+  8027b1:	c3                   	ret
+{
+  8027b2:	55                   	push   %ebp
+  8027b3:	89 e5                	mov    %esp,%ebp
+  8027b5:	53                   	push   %ebx
+  8027b6:	83 ec 04             	sub    $0x4,%esp
+  8027b9:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  8027bb:	8b 40 08             	mov    0x8(%eax),%eax
+  8027be:	85 c0                	test   %eax,%eax
+  8027c0:	74 17                	je     8027d9 <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  8027c2:	83 f8 03             	cmp    $0x3,%eax
+  8027c5:	75 2d                	jne    8027f4 <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  8027c7:	8d 43 20             	lea    0x20(%ebx),%eax
+  8027ca:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  8027cd:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  8027d4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027d7:	c9                   	leave
+  8027d8:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  8027d9:	83 ec 0c             	sub    $0xc,%esp
+  8027dc:	ff 33                	push   (%ebx)
+  8027de:	e8 97 21 00 00       	call   80497a <iscons>
+  8027e3:	83 c4 10             	add    $0x10,%esp
+  8027e6:	85 c0                	test   %eax,%eax
+  8027e8:	0f 9f c0             	setg   %al
+  8027eb:	0f b6 c0             	movzbl %al,%eax
+  8027ee:	83 c0 01             	add    $0x1,%eax
+  8027f1:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  8027f4:	83 ec 0c             	sub    $0xc,%esp
+  8027f7:	68 00 10 00 00       	push   $0x1000
+  8027fc:	e8 8b 11 00 00       	call   80398c <malloc>
+  802801:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802804:	83 c4 10             	add    $0x10,%esp
+  802807:	85 c0                	test   %eax,%eax
+  802809:	74 bc                	je     8027c7 <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  80280b:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  802812:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  802816:	eb bc                	jmp    8027d4 <stream_setup+0x29>
+
+00802818 <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  802818:	55                   	push   %ebp
+  802819:	89 e5                	mov    %esp,%ebp
+  80281b:	53                   	push   %ebx
+  80281c:	83 ec 04             	sub    $0x4,%esp
+  80281f:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  802821:	e8 85 ff ff ff       	call   8027ab <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  802826:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  80282b:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  80282f:	74 3d                	je     80286e <stream_fill+0x56>
+  802831:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  802835:	74 10                	je     802847 <stream_fill+0x2f>
+  802837:	89 d8                	mov    %ebx,%eax
+  802839:	e8 fd fe ff ff       	call   80273b <stream_drain>
+		return 0;
+  80283e:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  802843:	85 c0                	test   %eax,%eax
+  802845:	78 27                	js     80286e <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  802847:	83 ec 04             	sub    $0x4,%esp
+  80284a:	ff 73 10             	push   0x10(%ebx)
+  80284d:	ff 73 0c             	push   0xc(%ebx)
+  802850:	ff 33                	push   (%ebx)
+  802852:	e8 02 f3 ff ff       	call   801b59 <read>
+  802857:	83 c4 10             	add    $0x10,%esp
+  80285a:	85 c0                	test   %eax,%eax
+  80285c:	7e 17                	jle    802875 <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  80285e:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  802862:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  802869:	89 c2                	mov    %eax,%edx
+  80286b:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  80286e:	89 d0                	mov    %edx,%eax
+  802870:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802873:	c9                   	leave
+  802874:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802875:	c1 f8 1f             	sar    $0x1f,%eax
+  802878:	83 e0 04             	and    $0x4,%eax
+  80287b:	83 c0 04             	add    $0x4,%eax
+  80287e:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  802881:	ba 00 00 00 00       	mov    $0x0,%edx
+  802886:	eb e6                	jmp    80286e <stream_fill+0x56>
+
+00802888 <fopen>:
+{
+  802888:	55                   	push   %ebp
+  802889:	89 e5                	mov    %esp,%ebp
+  80288b:	57                   	push   %edi
+  80288c:	56                   	push   %esi
+  80288d:	53                   	push   %ebx
+  80288e:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  802894:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  802897:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  80289d:	89 f0                	mov    %esi,%eax
+  80289f:	e8 40 fd ff ff       	call   8025e4 <parse_mode>
+		return 0;
+  8028a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  8028a9:	85 c0                	test   %eax,%eax
+  8028ab:	78 2d                	js     8028da <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  8028ad:	83 ec 08             	sub    $0x8,%esp
+  8028b0:	50                   	push   %eax
+  8028b1:	ff 75 08             	push   0x8(%ebp)
+  8028b4:	e8 e8 f8 ff ff       	call   8021a1 <open>
+  8028b9:	89 c7                	mov    %eax,%edi
+  8028bb:	83 c4 10             	add    $0x10,%esp
+  8028be:	85 c0                	test   %eax,%eax
+  8028c0:	78 58                	js     80291a <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  8028c2:	80 3e 61             	cmpb   $0x61,(%esi)
+  8028c5:	74 1d                	je     8028e4 <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  8028c7:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  8028cd:	89 f8                	mov    %edi,%eax
+  8028cf:	e8 7b fd ff ff       	call   80264f <stream_alloc>
+  8028d4:	89 c3                	mov    %eax,%ebx
+  8028d6:	85 c0                	test   %eax,%eax
+  8028d8:	74 32                	je     80290c <fopen+0x84>
+}
+  8028da:	89 d8                	mov    %ebx,%eax
+  8028dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028df:	5b                   	pop    %ebx
+  8028e0:	5e                   	pop    %esi
+  8028e1:	5f                   	pop    %edi
+  8028e2:	5d                   	pop    %ebp
+  8028e3:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  8028e4:	83 ec 08             	sub    $0x8,%esp
+  8028e7:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  8028ed:	50                   	push   %eax
+  8028ee:	57                   	push   %edi
+  8028ef:	e8 db f4 ff ff       	call   801dcf <fstat>
+  8028f4:	83 c4 10             	add    $0x10,%esp
+  8028f7:	85 c0                	test   %eax,%eax
+  8028f9:	78 cc                	js     8028c7 <fopen+0x3f>
+		seek(fd, st.st_size);
+  8028fb:	83 ec 08             	sub    $0x8,%esp
+  8028fe:	ff 75 dc             	push   -0x24(%ebp)
+  802901:	57                   	push   %edi
+  802902:	e8 f6 f3 ff ff       	call   801cfd <seek>
+  802907:	83 c4 10             	add    $0x10,%esp
+  80290a:	eb bb                	jmp    8028c7 <fopen+0x3f>
+		close(fd);
+  80290c:	83 ec 0c             	sub    $0xc,%esp
+  80290f:	57                   	push   %edi
+  802910:	e8 08 f1 ff ff       	call   801a1d <close>
+  802915:	83 c4 10             	add    $0x10,%esp
+  802918:	eb c0                	jmp    8028da <fopen+0x52>
+		return 0;
+  80291a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80291f:	eb b9                	jmp    8028da <fopen+0x52>
+
+00802921 <fdopen>:
+{
+  802921:	55                   	push   %ebp
+  802922:	89 e5                	mov    %esp,%ebp
+  802924:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  802927:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80292a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80292d:	e8 b2 fc ff ff       	call   8025e4 <parse_mode>
+  802932:	89 c2                	mov    %eax,%edx
+		return 0;
+  802934:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  802939:	85 d2                	test   %edx,%edx
+  80293b:	78 0b                	js     802948 <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  80293d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802940:	8b 45 08             	mov    0x8(%ebp),%eax
+  802943:	e8 07 fd ff ff       	call   80264f <stream_alloc>
+}
+  802948:	c9                   	leave
+  802949:	c3                   	ret
+
+0080294a <setvbuf>:
+{
+  80294a:	55                   	push   %ebp
+  80294b:	89 e5                	mov    %esp,%ebp
+  80294d:	57                   	push   %edi
+  80294e:	56                   	push   %esi
+  80294f:	53                   	push   %ebx
+  802950:	8b 45 08             	mov    0x8(%ebp),%eax
+  802953:	8b 55 10             	mov    0x10(%ebp),%edx
+  802956:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  802959:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  80295d:	75 3a                	jne    802999 <setvbuf+0x4f>
+  80295f:	8d 72 ff             	lea    -0x1(%edx),%esi
+  802962:	83 fe 02             	cmp    $0x2,%esi
+  802965:	77 39                	ja     8029a0 <setvbuf+0x56>
+	f->f_bufmode = mode;
+  802967:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  80296a:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80296e:	0f 95 c3             	setne  %bl
+  802971:	85 ff                	test   %edi,%edi
+  802973:	0f 95 c1             	setne  %cl
+  802976:	84 cb                	test   %cl,%bl
+  802978:	74 05                	je     80297f <setvbuf+0x35>
+  80297a:	83 fa 03             	cmp    $0x3,%edx
+  80297d:	75 0a                	jne    802989 <setvbuf+0x3f>
+	return 0;
+  80297f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802984:	5b                   	pop    %ebx
+  802985:	5e                   	pop    %esi
+  802986:	5f                   	pop    %edi
+  802987:	5d                   	pop    %ebp
+  802988:	c3                   	ret
+		f->f_buf = buf;
+  802989:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80298c:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  80298f:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  802992:	b8 00 00 00 00       	mov    $0x0,%eax
+  802997:	eb eb                	jmp    802984 <setvbuf+0x3a>
+		return EOF;
+  802999:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80299e:	eb e4                	jmp    802984 <setvbuf+0x3a>
+  8029a0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8029a5:	eb dd                	jmp    802984 <setvbuf+0x3a>
+
+008029a7 <fflush>:
+{
+  8029a7:	55                   	push   %ebp
+  8029a8:	89 e5                	mov    %esp,%ebp
+  8029aa:	57                   	push   %edi
+  8029ab:	56                   	push   %esi
+  8029ac:	53                   	push   %ebx
+  8029ad:	83 ec 0c             	sub    $0xc,%esp
+  8029b0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  8029b3:	85 db                	test   %ebx,%ebx
+  8029b5:	74 1a                	je     8029d1 <fflush+0x2a>
+	stream_unread(f);
+  8029b7:	89 d8                	mov    %ebx,%eax
+  8029b9:	e8 0a fd ff ff       	call   8026c8 <stream_unread>
+	return stream_drain(f);
+  8029be:	89 d8                	mov    %ebx,%eax
+  8029c0:	e8 76 fd ff ff       	call   80273b <stream_drain>
+  8029c5:	89 c7                	mov    %eax,%edi
+}
+  8029c7:	89 f8                	mov    %edi,%eax
+  8029c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029cc:	5b                   	pop    %ebx
+  8029cd:	5e                   	pop    %esi
+  8029ce:	5f                   	pop    %edi
+  8029cf:	5d                   	pop    %ebp
+  8029d0:	c3                   	ret
+  8029d1:	bb 40 60 80 00       	mov    $0x806040,%ebx
+  8029d6:	be 80 62 80 00       	mov    $0x806280,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  8029db:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029e0:	eb 03                	jmp    8029e5 <fflush+0x3e>
+  8029e2:	83 c3 24             	add    $0x24,%ebx
+  8029e5:	39 f3                	cmp    %esi,%ebx
+  8029e7:	74 de                	je     8029c7 <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  8029e9:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  8029ed:	74 f3                	je     8029e2 <fflush+0x3b>
+  8029ef:	83 ec 0c             	sub    $0xc,%esp
+  8029f2:	53                   	push   %ebx
+  8029f3:	e8 af ff ff ff       	call   8029a7 <fflush>
+  8029f8:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  8029fb:	85 c0                	test   %eax,%eax
+  8029fd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802a02:	0f 48 f8             	cmovs  %eax,%edi
+  802a05:	eb db                	jmp    8029e2 <fflush+0x3b>
+
+00802a07 <fclose>:
+{
+  802a07:	55                   	push   %ebp
+  802a08:	89 e5                	mov    %esp,%ebp
+  802a0a:	56                   	push   %esi
+  802a0b:	53                   	push   %ebx
+  802a0c:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  802a0f:	83 ec 0c             	sub    $0xc,%esp
+  802a12:	56                   	push   %esi
+  802a13:	e8 8f ff ff ff       	call   8029a7 <fflush>
+  802a18:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  802a1a:	83 c4 04             	add    $0x4,%esp
+  802a1d:	ff 36                	push   (%esi)
+  802a1f:	e8 f9 ef ff ff       	call   801a1d <close>
+  802a24:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  802a27:	85 c0                	test   %eax,%eax
+  802a29:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802a2e:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  802a31:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  802a35:	75 10                	jne    802a47 <fclose+0x40>
+	f->f_flags = 0;
+  802a37:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  802a3e:	89 d8                	mov    %ebx,%eax
+  802a40:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a43:	5b                   	pop    %ebx
+  802a44:	5e                   	pop    %esi
+  802a45:	5d                   	pop    %ebp
+  802a46:	c3                   	ret
+		free(f->f_buf);
+  802a47:	83 ec 0c             	sub    $0xc,%esp
+  802a4a:	ff 76 0c             	push   0xc(%esi)
+  802a4d:	e8 71 0e 00 00       	call   8038c3 <free>
+  802a52:	83 c4 10             	add    $0x10,%esp
+  802a55:	eb e0                	jmp    802a37 <fclose+0x30>
+
+00802a57 <fileno>:
+{
+  802a57:	55                   	push   %ebp
+  802a58:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  802a5a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a5d:	8b 00                	mov    (%eax),%eax
+}
+  802a5f:	5d                   	pop    %ebp
+  802a60:	c3                   	ret
+
+00802a61 <feof>:
+{
+  802a61:	55                   	push   %ebp
+  802a62:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  802a64:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a67:	8b 40 04             	mov    0x4(%eax),%eax
+  802a6a:	c1 e8 02             	shr    $0x2,%eax
+  802a6d:	83 e0 01             	and    $0x1,%eax
+}
+  802a70:	5d                   	pop    %ebp
+  802a71:	c3                   	ret
+
+00802a72 <ferror>:
+{
+  802a72:	55                   	push   %ebp
+  802a73:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  802a75:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a78:	8b 40 04             	mov    0x4(%eax),%eax
+  802a7b:	c1 e8 03             	shr    $0x3,%eax
+  802a7e:	83 e0 01             	and    $0x1,%eax
+}
+  802a81:	5d                   	pop    %ebp
+  802a82:	c3                   	ret
+
+00802a83 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  802a83:	55                   	push   %ebp
+  802a84:	89 e5                	mov    %esp,%ebp
+  802a86:	53                   	push   %ebx
+  802a87:	83 ec 04             	sub    $0x4,%esp
+  802a8a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802a8d:	8b 43 18             	mov    0x18(%ebx),%eax
+  802a90:	39 43 14             	cmp    %eax,0x14(%ebx)
+  802a93:	74 15                	je     802aaa <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  802a95:	8b 53 0c             	mov    0xc(%ebx),%edx
+  802a98:	8b 43 14             	mov    0x14(%ebx),%eax
+  802a9b:	8d 48 01             	lea    0x1(%eax),%ecx
+  802a9e:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  802aa1:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  802aa5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802aa8:	c9                   	leave
+  802aa9:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802aaa:	89 d8                	mov    %ebx,%eax
+  802aac:	e8 67 fd ff ff       	call   802818 <stream_fill>
+  802ab1:	85 c0                	test   %eax,%eax
+  802ab3:	75 e0                	jne    802a95 <fgetc+0x12>
+		return EOF;
+  802ab5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802aba:	eb e9                	jmp    802aa5 <fgetc+0x22>
+
+00802abc <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  802abc:	55                   	push   %ebp
+  802abd:	89 e5                	mov    %esp,%ebp
+  802abf:	57                   	push   %edi
+  802ac0:	56                   	push   %esi
+  802ac1:	53                   	push   %ebx
+  802ac2:	83 ec 1c             	sub    $0x1c,%esp
+  802ac5:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  802ac8:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802acd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ad0:	83 e8 01             	sub    $0x1,%eax
+  802ad3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  802ad6:	eb 66                	jmp    802b3e <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802ad8:	8b 46 14             	mov    0x14(%esi),%eax
+  802adb:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802ade:	29 c3                	sub    %eax,%ebx
+  802ae0:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802ae3:	29 fa                	sub    %edi,%edx
+  802ae5:	39 d3                	cmp    %edx,%ebx
+  802ae7:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802aea:	83 ec 04             	sub    $0x4,%esp
+  802aed:	53                   	push   %ebx
+  802aee:	6a 0a                	push   $0xa
+  802af0:	03 46 0c             	add    0xc(%esi),%eax
+  802af3:	50                   	push   %eax
+  802af4:	e8 34 e0 ff ff       	call   800b2d <memfind>
+  802af9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  802afc:	8b 46 0c             	mov    0xc(%esi),%eax
+  802aff:	8b 4e 14             	mov    0x14(%esi),%ecx
+  802b02:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  802b05:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802b07:	83 c4 10             	add    $0x10,%esp
+  802b0a:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802b0d:	74 0b                	je     802b1a <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  802b0f:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802b12:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802b15:	29 d3                	sub    %edx,%ebx
+  802b17:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  802b1a:	83 ec 04             	sub    $0x4,%esp
+  802b1d:	53                   	push   %ebx
+  802b1e:	01 c8                	add    %ecx,%eax
+  802b20:	50                   	push   %eax
+  802b21:	89 f8                	mov    %edi,%eax
+  802b23:	03 45 08             	add    0x8(%ebp),%eax
+  802b26:	50                   	push   %eax
+  802b27:	e8 50 df ff ff       	call   800a7c <memmove>
+		f->f_rpos += m;
+  802b2c:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  802b2f:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  802b31:	83 c4 10             	add    $0x10,%esp
+  802b34:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b37:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  802b3c:	74 1f                	je     802b5d <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  802b3e:	8d 47 01             	lea    0x1(%edi),%eax
+  802b41:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  802b44:	73 17                	jae    802b5d <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802b46:	8b 46 18             	mov    0x18(%esi),%eax
+  802b49:	39 46 14             	cmp    %eax,0x14(%esi)
+  802b4c:	75 8a                	jne    802ad8 <fgets+0x1c>
+  802b4e:	89 f0                	mov    %esi,%eax
+  802b50:	e8 c3 fc ff ff       	call   802818 <stream_fill>
+  802b55:	85 c0                	test   %eax,%eax
+  802b57:	0f 85 7b ff ff ff    	jne    802ad8 <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  802b5d:	85 ff                	test   %edi,%edi
+  802b5f:	74 0f                	je     802b70 <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  802b61:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b64:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  802b68:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b6b:	5b                   	pop    %ebx
+  802b6c:	5e                   	pop    %esi
+  802b6d:	5f                   	pop    %edi
+  802b6e:	5d                   	pop    %ebp
+  802b6f:	c3                   	ret
+		return 0;
+  802b70:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b75:	eb f1                	jmp    802b68 <fgets+0xac>
+
+00802b77 <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  802b77:	55                   	push   %ebp
+  802b78:	89 e5                	mov    %esp,%ebp
+  802b7a:	57                   	push   %edi
+  802b7b:	56                   	push   %esi
+  802b7c:	53                   	push   %ebx
+  802b7d:	83 ec 1c             	sub    $0x1c,%esp
+  802b80:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  802b83:	89 f0                	mov    %esi,%eax
+  802b85:	e8 21 fc ff ff       	call   8027ab <stream_setup>
+	want = size * n;
+  802b8a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b8d:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802b91:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  802b94:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b99:	eb 43                	jmp    802bde <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  802b9b:	29 d3                	sub    %edx,%ebx
+  802b9d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802ba0:	29 f8                	sub    %edi,%eax
+  802ba2:	39 c3                	cmp    %eax,%ebx
+  802ba4:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  802ba7:	83 ec 04             	sub    $0x4,%esp
+  802baa:	53                   	push   %ebx
+  802bab:	03 56 0c             	add    0xc(%esi),%edx
+  802bae:	52                   	push   %edx
+  802baf:	89 f8                	mov    %edi,%eax
+  802bb1:	03 45 08             	add    0x8(%ebp),%eax
+  802bb4:	50                   	push   %eax
+  802bb5:	e8 c2 de ff ff       	call   800a7c <memmove>
+			f->f_rpos += m;
+  802bba:	01 5e 14             	add    %ebx,0x14(%esi)
+  802bbd:	83 c4 10             	add    $0x10,%esp
+  802bc0:	eb 1a                	jmp    802bdc <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  802bc2:	83 ec 04             	sub    $0x4,%esp
+  802bc5:	53                   	push   %ebx
+  802bc6:	89 f8                	mov    %edi,%eax
+  802bc8:	03 45 08             	add    0x8(%ebp),%eax
+  802bcb:	50                   	push   %eax
+  802bcc:	ff 36                	push   (%esi)
+  802bce:	e8 86 ef ff ff       	call   801b59 <read>
+  802bd3:	89 c3                	mov    %eax,%ebx
+  802bd5:	83 c4 10             	add    $0x10,%esp
+  802bd8:	85 c0                	test   %eax,%eax
+  802bda:	7e 36                	jle    802c12 <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  802bdc:	01 df                	add    %ebx,%edi
+  802bde:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802be1:	39 c7                	cmp    %eax,%edi
+  802be3:	73 39                	jae    802c1e <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  802be5:	8b 56 14             	mov    0x14(%esi),%edx
+  802be8:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802beb:	39 da                	cmp    %ebx,%edx
+  802bed:	72 ac                	jb     802b9b <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  802bef:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802bf2:	29 fb                	sub    %edi,%ebx
+  802bf4:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  802bf7:	72 3e                	jb     802c37 <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  802bf9:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  802bfd:	74 1f                	je     802c1e <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  802bff:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  802c03:	74 bd                	je     802bc2 <fread+0x4b>
+  802c05:	89 f0                	mov    %esi,%eax
+  802c07:	e8 2f fb ff ff       	call   80273b <stream_drain>
+  802c0c:	85 c0                	test   %eax,%eax
+  802c0e:	79 b2                	jns    802bc2 <fread+0x4b>
+  802c10:	eb 0c                	jmp    802c1e <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802c12:	c1 fb 1f             	sar    $0x1f,%ebx
+  802c15:	83 e3 04             	and    $0x4,%ebx
+  802c18:	83 c3 04             	add    $0x4,%ebx
+  802c1b:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  802c1e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c21:	85 c0                	test   %eax,%eax
+  802c23:	74 0a                	je     802c2f <fread+0xb8>
+  802c25:	89 f8                	mov    %edi,%eax
+  802c27:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c2c:	f7 75 0c             	divl   0xc(%ebp)
+}
+  802c2f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c32:	5b                   	pop    %ebx
+  802c33:	5e                   	pop    %esi
+  802c34:	5f                   	pop    %edi
+  802c35:	5d                   	pop    %ebp
+  802c36:	c3                   	ret
+		} else if (!stream_fill(f))
+  802c37:	89 f0                	mov    %esi,%eax
+  802c39:	e8 da fb ff ff       	call   802818 <stream_fill>
+  802c3e:	85 c0                	test   %eax,%eax
+  802c40:	74 dc                	je     802c1e <fread+0xa7>
+			m = 0;
+  802c42:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c47:	eb 93                	jmp    802bdc <fread+0x65>
+
+00802c49 <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  802c49:	55                   	push   %ebp
+  802c4a:	89 e5                	mov    %esp,%ebp
+  802c4c:	57                   	push   %edi
+  802c4d:	56                   	push   %esi
+  802c4e:	53                   	push   %ebx
+  802c4f:	83 ec 1c             	sub    $0x1c,%esp
+  802c52:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  802c55:	8b 43 04             	mov    0x4(%ebx),%eax
+  802c58:	a8 02                	test   $0x2,%al
+  802c5a:	75 13                	jne    802c6f <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  802c5c:	83 c8 08             	or     $0x8,%eax
+  802c5f:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  802c62:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  802c67:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c6a:	5b                   	pop    %ebx
+  802c6b:	5e                   	pop    %esi
+  802c6c:	5f                   	pop    %edi
+  802c6d:	5d                   	pop    %ebp
+  802c6e:	c3                   	ret
+	stream_setup(f);
+  802c6f:	89 d8                	mov    %ebx,%eax
+  802c71:	e8 35 fb ff ff       	call   8027ab <stream_setup>
+	want = size * n;
+  802c76:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c79:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802c7d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  802c80:	89 d8                	mov    %ebx,%eax
+  802c82:	e8 41 fa ff ff       	call   8026c8 <stream_unread>
+	for (done = 0; done < want; ) {
+  802c87:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  802c8c:	84 c0                	test   %al,%al
+  802c8e:	75 7b                	jne    802d0b <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  802c90:	be 00 00 00 00       	mov    $0x0,%esi
+  802c95:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802c98:	39 fe                	cmp    %edi,%esi
+  802c9a:	73 24                	jae    802cc0 <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802c9c:	83 ec 04             	sub    $0x4,%esp
+  802c9f:	89 f8                	mov    %edi,%eax
+  802ca1:	29 f0                	sub    %esi,%eax
+  802ca3:	50                   	push   %eax
+  802ca4:	89 f0                	mov    %esi,%eax
+  802ca6:	03 45 08             	add    0x8(%ebp),%eax
+  802ca9:	50                   	push   %eax
+  802caa:	ff 33                	push   (%ebx)
+  802cac:	e8 a0 ef ff ff       	call   801c51 <write>
+  802cb1:	83 c4 10             	add    $0x10,%esp
+  802cb4:	85 c0                	test   %eax,%eax
+  802cb6:	7e 04                	jle    802cbc <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  802cb8:	01 c6                	add    %eax,%esi
+  802cba:	eb dc                	jmp    802c98 <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  802cbc:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  802cc0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802cc3:	85 c0                	test   %eax,%eax
+  802cc5:	74 a0                	je     802c67 <fwrite+0x1e>
+  802cc7:	89 f0                	mov    %esi,%eax
+  802cc9:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cce:	f7 75 0c             	divl   0xc(%ebp)
+  802cd1:	eb 94                	jmp    802c67 <fwrite+0x1e>
+			done += r;
+  802cd3:	01 c7                	add    %eax,%edi
+			continue;
+  802cd5:	eb 34                	jmp    802d0b <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  802cd7:	8b 73 10             	mov    0x10(%ebx),%esi
+  802cda:	29 c6                	sub    %eax,%esi
+  802cdc:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802cdf:	29 fa                	sub    %edi,%edx
+  802ce1:	39 d6                	cmp    %edx,%esi
+  802ce3:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  802ce6:	83 ec 04             	sub    $0x4,%esp
+  802ce9:	56                   	push   %esi
+  802cea:	89 fa                	mov    %edi,%edx
+  802cec:	03 55 08             	add    0x8(%ebp),%edx
+  802cef:	52                   	push   %edx
+  802cf0:	03 43 0c             	add    0xc(%ebx),%eax
+  802cf3:	50                   	push   %eax
+  802cf4:	e8 83 dd ff ff       	call   800a7c <memmove>
+		f->f_wend += m;
+  802cf9:	89 f0                	mov    %esi,%eax
+  802cfb:	03 43 1c             	add    0x1c(%ebx),%eax
+  802cfe:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  802d01:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802d03:	83 c4 10             	add    $0x10,%esp
+  802d06:	3b 43 10             	cmp    0x10(%ebx),%eax
+  802d09:	74 5b                	je     802d66 <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  802d0b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802d0e:	39 c7                	cmp    %eax,%edi
+  802d10:	73 2d                	jae    802d3f <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  802d12:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802d15:	85 c0                	test   %eax,%eax
+  802d17:	75 be                	jne    802cd7 <fwrite+0x8e>
+  802d19:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802d1c:	29 fa                	sub    %edi,%edx
+  802d1e:	3b 53 10             	cmp    0x10(%ebx),%edx
+  802d21:	72 b4                	jb     802cd7 <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802d23:	83 ec 04             	sub    $0x4,%esp
+  802d26:	52                   	push   %edx
+  802d27:	89 f8                	mov    %edi,%eax
+  802d29:	03 45 08             	add    0x8(%ebp),%eax
+  802d2c:	50                   	push   %eax
+  802d2d:	ff 33                	push   (%ebx)
+  802d2f:	e8 1d ef ff ff       	call   801c51 <write>
+  802d34:	83 c4 10             	add    $0x10,%esp
+  802d37:	85 c0                	test   %eax,%eax
+  802d39:	7f 98                	jg     802cd3 <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  802d3b:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  802d3f:	8b 43 08             	mov    0x8(%ebx),%eax
+  802d42:	83 f8 03             	cmp    $0x3,%eax
+  802d45:	74 48                	je     802d8f <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802d47:	83 f8 02             	cmp    $0x2,%eax
+  802d4a:	74 27                	je     802d73 <fwrite+0x12a>
+	return size ? done / size : 0;
+  802d4c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d4f:	85 c0                	test   %eax,%eax
+  802d51:	0f 84 10 ff ff ff    	je     802c67 <fwrite+0x1e>
+  802d57:	89 f8                	mov    %edi,%eax
+  802d59:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d5e:	f7 75 0c             	divl   0xc(%ebp)
+  802d61:	e9 01 ff ff ff       	jmp    802c67 <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802d66:	89 d8                	mov    %ebx,%eax
+  802d68:	e8 ce f9 ff ff       	call   80273b <stream_drain>
+  802d6d:	85 c0                	test   %eax,%eax
+  802d6f:	79 9a                	jns    802d0b <fwrite+0xc2>
+  802d71:	eb cc                	jmp    802d3f <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802d73:	83 ec 04             	sub    $0x4,%esp
+  802d76:	57                   	push   %edi
+  802d77:	6a 0a                	push   $0xa
+  802d79:	ff 75 08             	push   0x8(%ebp)
+  802d7c:	e8 ac dd ff ff       	call   800b2d <memfind>
+  802d81:	89 c2                	mov    %eax,%edx
+  802d83:	89 f8                	mov    %edi,%eax
+  802d85:	03 45 08             	add    0x8(%ebp),%eax
+  802d88:	83 c4 10             	add    $0x10,%esp
+  802d8b:	39 c2                	cmp    %eax,%edx
+  802d8d:	74 bd                	je     802d4c <fwrite+0x103>
+		stream_drain(f);
+  802d8f:	89 d8                	mov    %ebx,%eax
+  802d91:	e8 a5 f9 ff ff       	call   80273b <stream_drain>
+  802d96:	eb b4                	jmp    802d4c <fwrite+0x103>
+
+00802d98 <fputc>:
+{
+  802d98:	55                   	push   %ebp
+  802d99:	89 e5                	mov    %esp,%ebp
+  802d9b:	53                   	push   %ebx
+  802d9c:	83 ec 14             	sub    $0x14,%esp
+  802d9f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  802da2:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  802da5:	ff 75 0c             	push   0xc(%ebp)
+  802da8:	6a 01                	push   $0x1
+  802daa:	6a 01                	push   $0x1
+  802dac:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802daf:	50                   	push   %eax
+  802db0:	e8 94 fe ff ff       	call   802c49 <fwrite>
+  802db5:	83 c4 10             	add    $0x10,%esp
+  802db8:	0f b6 db             	movzbl %bl,%ebx
+  802dbb:	83 f8 01             	cmp    $0x1,%eax
+  802dbe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802dc3:	0f 44 c3             	cmove  %ebx,%eax
+}
+  802dc6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802dc9:	c9                   	leave
+  802dca:	c3                   	ret
+
+00802dcb <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  802dcb:	55                   	push   %ebp
+  802dcc:	89 e5                	mov    %esp,%ebp
+  802dce:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  802dd1:	ff 75 0c             	push   0xc(%ebp)
+  802dd4:	ff 75 08             	push   0x8(%ebp)
+  802dd7:	e8 bc ff ff ff       	call   802d98 <fputc>
+}
+  802ddc:	83 c4 10             	add    $0x10,%esp
+  802ddf:	c9                   	leave
+  802de0:	c3                   	ret
+
+00802de1 <fputs>:
+{
+  802de1:	55                   	push   %ebp
+  802de2:	89 e5                	mov    %esp,%ebp
+  802de4:	56                   	push   %esi
+  802de5:	53                   	push   %ebx
+  802de6:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  802de9:	83 ec 0c             	sub    $0xc,%esp
+  802dec:	56                   	push   %esi
+  802ded:	e8 c9 da ff ff       	call   8008bb <strlen>
+  802df2:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  802df4:	ff 75 0c             	push   0xc(%ebp)
+  802df7:	50                   	push   %eax
+  802df8:	6a 01                	push   $0x1
+  802dfa:	56                   	push   %esi
+  802dfb:	e8 49 fe ff ff       	call   802c49 <fwrite>
+  802e00:	83 c4 20             	add    $0x20,%esp
+  802e03:	39 d8                	cmp    %ebx,%eax
+  802e05:	0f 95 c0             	setne  %al
+  802e08:	0f b6 c0             	movzbl %al,%eax
+  802e0b:	f7 d8                	neg    %eax
+}
+  802e0d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e10:	5b                   	pop    %ebx
+  802e11:	5e                   	pop    %esi
+  802e12:	5d                   	pop    %ebp
+  802e13:	c3                   	ret
+
+00802e14 <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  802e14:	55                   	push   %ebp
+  802e15:	89 e5                	mov    %esp,%ebp
+  802e17:	53                   	push   %ebx
+  802e18:	83 ec 04             	sub    $0x4,%esp
+  802e1b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802e1e:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  802e21:	50                   	push   %eax
+  802e22:	ff 75 0c             	push   0xc(%ebp)
+  802e25:	53                   	push   %ebx
+  802e26:	68 cb 2d 80 00       	push   $0x802dcb
+  802e2b:	e8 d9 d5 ff ff       	call   800409 <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  802e30:	8b 43 04             	mov    0x4(%ebx),%eax
+  802e33:	c1 e0 1c             	shl    $0x1c,%eax
+  802e36:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  802e39:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e3c:	c9                   	leave
+  802e3d:	c3                   	ret
+
+00802e3e <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  802e3e:	55                   	push   %ebp
+  802e3f:	89 e5                	mov    %esp,%ebp
+  802e41:	57                   	push   %edi
+  802e42:	56                   	push   %esi
+  802e43:	53                   	push   %ebx
+  802e44:	81 ec 84 02 00 00    	sub    $0x284,%esp
+	//   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+	//     correct initial eip and esp values in the child.
+	//
+	//   - Start the child process running with sys_env_set_status().
+
+	if ((r = open(prog, O_RDONLY)) < 0)
+  802e4a:	6a 00                	push   $0x0
+  802e4c:	ff 75 08             	push   0x8(%ebp)
+  802e4f:	e8 4d f3 ff ff       	call   8021a1 <open>
+  802e54:	89 85 88 fd ff ff    	mov    %eax,-0x278(%ebp)
+  802e5a:	83 c4 10             	add    $0x10,%esp
+  802e5d:	85 c0                	test   %eax,%eax
+  802e5f:	0f 88 df 04 00 00    	js     803344 <spawn+0x506>
+  802e65:	89 c1                	mov    %eax,%ecx
+		return r;
+	fd = r;
+
+	// Read elf header
+	elf = (struct Elf*) elf_buf;
+	if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf)
+  802e67:	83 ec 04             	sub    $0x4,%esp
+  802e6a:	68 00 02 00 00       	push   $0x200
+  802e6f:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  802e75:	50                   	push   %eax
+  802e76:	51                   	push   %ecx
+  802e77:	e8 8e ed ff ff       	call   801c0a <readn>
+  802e7c:	83 c4 10             	add    $0x10,%esp
+  802e7f:	3d 00 02 00 00       	cmp    $0x200,%eax
+  802e84:	75 5a                	jne    802ee0 <spawn+0xa2>
+	    || elf->e_magic != ELF_MAGIC) {
+  802e86:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  802e8d:	45 4c 46 
+  802e90:	75 4e                	jne    802ee0 <spawn+0xa2>
+  802e92:	b8 07 00 00 00       	mov    $0x7,%eax
+  802e97:	cd 30                	int    $0x30
+  802e99:	89 85 90 fd ff ff    	mov    %eax,-0x270(%ebp)
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+		return -E_NOT_EXEC;
+	}
+
+	// Create new child environment
+	if ((r = sys_exofork()) < 0)
+  802e9f:	85 c0                	test   %eax,%eax
+  802ea1:	0f 88 91 04 00 00    	js     803338 <spawn+0x4fa>
+		return r;
+	child = r;
+
+	// Set up trap frame, including initial stack.
+	child_tf = envs[ENVX(child)].env_tf;
+  802ea7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802eac:	8d 34 c0             	lea    (%eax,%eax,8),%esi
+  802eaf:	c1 e6 04             	shl    $0x4,%esi
+  802eb2:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  802eb8:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  802ebe:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802ec3:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	child_tf.tf_eip = elf->e_entry;
+  802ec5:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  802ecb:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+	uintptr_t *argv_store;
+
+	// Count the number of arguments (argc)
+	// and the total amount of space needed for strings (string_size).
+	string_size = 0;
+	for (argc = 0; argv[argc] != 0; argc++)
+  802ed1:	bb 00 00 00 00       	mov    $0x0,%ebx
+	string_size = 0;
+  802ed6:	be 00 00 00 00       	mov    $0x0,%esi
+  802edb:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	for (argc = 0; argv[argc] != 0; argc++)
+  802ede:	eb 4b                	jmp    802f2b <spawn+0xed>
+		close(fd);
+  802ee0:	83 ec 0c             	sub    $0xc,%esp
+  802ee3:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  802ee9:	e8 2f eb ff ff       	call   801a1d <close>
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  802eee:	83 c4 0c             	add    $0xc,%esp
+  802ef1:	68 7f 45 4c 46       	push   $0x464c457f
+  802ef6:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  802efc:	68 88 55 80 00       	push   $0x805588
+  802f01:	e8 0c d4 ff ff       	call   800312 <cprintf>
+		return -E_NOT_EXEC;
+  802f06:	83 c4 10             	add    $0x10,%esp
+  802f09:	c7 85 88 fd ff ff f2 	movl   $0xfffffff2,-0x278(%ebp)
+  802f10:	ff ff ff 
+  802f13:	e9 2c 04 00 00       	jmp    803344 <spawn+0x506>
+		string_size += strlen(argv[argc]) + 1;
+  802f18:	83 ec 0c             	sub    $0xc,%esp
+  802f1b:	50                   	push   %eax
+  802f1c:	e8 9a d9 ff ff       	call   8008bb <strlen>
+  802f21:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+	for (argc = 0; argv[argc] != 0; argc++)
+  802f25:	83 c3 01             	add    $0x1,%ebx
+  802f28:	83 c4 10             	add    $0x10,%esp
+  802f2b:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  802f2e:	85 c0                	test   %eax,%eax
+  802f30:	75 e6                	jne    802f18 <spawn+0xda>
+	// Determine where to place the strings and the argv array.
+	// Set up pointers into the temporary page 'UTEMP'; we'll map a page
+	// there later, then remap that page into the child environment
+	// at (USTACKTOP - PGSIZE).
+	// strings is the topmost thing on the stack.
+	string_store = (char*) UTEMP + PGSIZE - string_size;
+  802f32:	89 9d 84 fd ff ff    	mov    %ebx,-0x27c(%ebp)
+  802f38:	bf 00 10 40 00       	mov    $0x401000,%edi
+  802f3d:	29 f7                	sub    %esi,%edi
+	// argv is below that.  There's one argument pointer per argument, plus
+	// a null pointer.
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  802f3f:	89 fa                	mov    %edi,%edx
+  802f41:	83 e2 fc             	and    $0xfffffffc,%edx
+  802f44:	8d 04 9d 04 00 00 00 	lea    0x4(,%ebx,4),%eax
+  802f4b:	29 c2                	sub    %eax,%edx
+  802f4d:	89 95 94 fd ff ff    	mov    %edx,-0x26c(%ebp)
+
+	// Make sure that argv, strings, and the 2 words that hold 'argc'
+	// and 'argv' themselves will all fit in a single stack page.
+	if ((void*) (argv_store - 2) < (void*) UTEMP)
+  802f53:	8d 42 f8             	lea    -0x8(%edx),%eax
+  802f56:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  802f5b:	0f 86 06 04 00 00    	jbe    803367 <spawn+0x529>
+		return -E_NO_MEM;
+
+	// Allocate the single stack page at UTEMP.
+	if ((r = sys_page_alloc(0, (void*) UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  802f61:	83 ec 04             	sub    $0x4,%esp
+  802f64:	6a 07                	push   $0x7
+  802f66:	68 00 00 40 00       	push   $0x400000
+  802f6b:	6a 00                	push   $0x0
+  802f6d:	e8 c2 dd ff ff       	call   800d34 <sys_page_alloc>
+  802f72:	83 c4 10             	add    $0x10,%esp
+  802f75:	85 c0                	test   %eax,%eax
+  802f77:	0f 88 ef 03 00 00    	js     80336c <spawn+0x52e>
+	//	  (Again, argv should use an address valid in the child's
+	//	  environment.)
+	//
+	//	* Set *init_esp to the initial stack pointer for the child,
+	//	  (Again, use an address valid in the child's environment.)
+	for (i = 0; i < argc; i++) {
+  802f7d:	be 00 00 00 00       	mov    $0x0,%esi
+  802f82:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+  802f88:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802f8b:	39 b5 8c fd ff ff    	cmp    %esi,-0x274(%ebp)
+  802f91:	7e 32                	jle    802fc5 <spawn+0x187>
+		argv_store[i] = UTEMP2USTACK(string_store);
+  802f93:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  802f99:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  802f9f:	89 04 b1             	mov    %eax,(%ecx,%esi,4)
+		strcpy(string_store, argv[i]);
+  802fa2:	83 ec 08             	sub    $0x8,%esp
+  802fa5:	ff 34 b3             	push   (%ebx,%esi,4)
+  802fa8:	57                   	push   %edi
+  802fa9:	e8 48 d9 ff ff       	call   8008f6 <strcpy>
+		string_store += strlen(argv[i]) + 1;
+  802fae:	83 c4 04             	add    $0x4,%esp
+  802fb1:	ff 34 b3             	push   (%ebx,%esi,4)
+  802fb4:	e8 02 d9 ff ff       	call   8008bb <strlen>
+  802fb9:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+	for (i = 0; i < argc; i++) {
+  802fbd:	83 c6 01             	add    $0x1,%esi
+  802fc0:	83 c4 10             	add    $0x10,%esp
+  802fc3:	eb c6                	jmp    802f8b <spawn+0x14d>
+	}
+	argv_store[argc] = 0;
+  802fc5:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  802fcb:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  802fd1:	c7 04 88 00 00 00 00 	movl   $0x0,(%eax,%ecx,4)
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  802fd8:	81 ff 00 10 40 00    	cmp    $0x401000,%edi
+  802fde:	0f 85 87 00 00 00    	jne    80306b <spawn+0x22d>
+
+	argv_store[-1] = UTEMP2USTACK(argv_store);
+  802fe4:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  802fea:	8d 81 00 d0 7f ee    	lea    -0x11803000(%ecx),%eax
+  802ff0:	89 41 fc             	mov    %eax,-0x4(%ecx)
+	argv_store[-2] = argc;
+  802ff3:	89 c8                	mov    %ecx,%eax
+  802ff5:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  802ffb:	89 48 f8             	mov    %ecx,-0x8(%eax)
+
+	*init_esp = UTEMP2USTACK(&argv_store[-2]);
+  802ffe:	2d 08 30 80 11       	sub    $0x11803008,%eax
+  803003:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+	// After completing the stack, map it into the child's address space
+	// and unmap it from ours!
+	if ((r = sys_page_map(0, UTEMP, child, (void*) (USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  803009:	83 ec 0c             	sub    $0xc,%esp
+  80300c:	6a 07                	push   $0x7
+  80300e:	68 00 d0 bf ee       	push   $0xeebfd000
+  803013:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  803019:	68 00 00 40 00       	push   $0x400000
+  80301e:	6a 00                	push   $0x0
+  803020:	e8 5c dd ff ff       	call   800d81 <sys_page_map>
+  803025:	89 c3                	mov    %eax,%ebx
+  803027:	83 c4 20             	add    $0x20,%esp
+  80302a:	85 c0                	test   %eax,%eax
+  80302c:	0f 88 98 03 00 00    	js     8033ca <spawn+0x58c>
+		goto error;
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  803032:	83 ec 08             	sub    $0x8,%esp
+  803035:	68 00 00 40 00       	push   $0x400000
+  80303a:	6a 00                	push   $0x0
+  80303c:	e8 8c dd ff ff       	call   800dcd <sys_page_unmap>
+  803041:	89 c3                	mov    %eax,%ebx
+  803043:	83 c4 10             	add    $0x10,%esp
+  803046:	85 c0                	test   %eax,%eax
+  803048:	0f 88 7c 03 00 00    	js     8033ca <spawn+0x58c>
+	ph = (struct Proghdr*) (elf_buf + elf->e_phoff);
+  80304e:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  803054:	8d 8c 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%ecx
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  80305b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803060:	89 c8                	mov    %ecx,%eax
+  803062:	89 d1                	mov    %edx,%ecx
+  803064:	89 c2                	mov    %eax,%edx
+  803066:	e9 5a 01 00 00       	jmp    8031c5 <spawn+0x387>
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  80306b:	68 14 56 80 00       	push   $0x805614
+  803070:	68 91 54 80 00       	push   $0x805491
+  803075:	68 06 01 00 00       	push   $0x106
+  80307a:	68 a2 55 80 00       	push   $0x8055a2
+  80307f:	e8 b3 d1 ff ff       	call   800237 <_panic>
+			// allocate a blank page
+			if ((r = sys_page_alloc(child, (void*) (va + i), perm)) < 0)
+				return r;
+		} else {
+			// from file
+			if ((r = sys_page_alloc(0, UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  803084:	83 ec 04             	sub    $0x4,%esp
+  803087:	6a 07                	push   $0x7
+  803089:	68 00 00 40 00       	push   $0x400000
+  80308e:	6a 00                	push   $0x0
+  803090:	e8 9f dc ff ff       	call   800d34 <sys_page_alloc>
+  803095:	83 c4 10             	add    $0x10,%esp
+  803098:	85 c0                	test   %eax,%eax
+  80309a:	0f 88 b2 02 00 00    	js     803352 <spawn+0x514>
+				return r;
+			if ((r = seek(fd, fileoffset + i)) < 0)
+  8030a0:	83 ec 08             	sub    $0x8,%esp
+  8030a3:	8b 95 80 fd ff ff    	mov    -0x280(%ebp),%edx
+  8030a9:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  8030af:	01 d0                	add    %edx,%eax
+  8030b1:	50                   	push   %eax
+  8030b2:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  8030b8:	e8 40 ec ff ff       	call   801cfd <seek>
+  8030bd:	83 c4 10             	add    $0x10,%esp
+  8030c0:	85 c0                	test   %eax,%eax
+  8030c2:	0f 88 91 02 00 00    	js     803359 <spawn+0x51b>
+				return r;
+			if ((r = readn(fd, UTEMP, MIN(PGSIZE, filesz-i))) < 0)
+  8030c8:	83 ec 04             	sub    $0x4,%esp
+  8030cb:	89 fa                	mov    %edi,%edx
+  8030cd:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  8030d3:	29 ca                	sub    %ecx,%edx
+  8030d5:	89 d0                	mov    %edx,%eax
+  8030d7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030dc:	39 d0                	cmp    %edx,%eax
+  8030de:	0f 47 c2             	cmova  %edx,%eax
+  8030e1:	50                   	push   %eax
+  8030e2:	68 00 00 40 00       	push   $0x400000
+  8030e7:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  8030ed:	e8 18 eb ff ff       	call   801c0a <readn>
+  8030f2:	83 c4 10             	add    $0x10,%esp
+  8030f5:	85 c0                	test   %eax,%eax
+  8030f7:	0f 88 63 02 00 00    	js     803360 <spawn+0x522>
+				return r;
+			if ((r = sys_page_map(0, UTEMP, child, (void*) (va + i), perm)) < 0)
+  8030fd:	83 ec 0c             	sub    $0xc,%esp
+  803100:	ff b5 84 fd ff ff    	push   -0x27c(%ebp)
+  803106:	56                   	push   %esi
+  803107:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  80310d:	68 00 00 40 00       	push   $0x400000
+  803112:	6a 00                	push   $0x0
+  803114:	e8 68 dc ff ff       	call   800d81 <sys_page_map>
+  803119:	83 c4 20             	add    $0x20,%esp
+  80311c:	85 c0                	test   %eax,%eax
+  80311e:	78 7e                	js     80319e <spawn+0x360>
+				panic("spawn: sys_page_map data: %e", r);
+			sys_page_unmap(0, UTEMP);
+  803120:	83 ec 08             	sub    $0x8,%esp
+  803123:	68 00 00 40 00       	push   $0x400000
+  803128:	6a 00                	push   $0x0
+  80312a:	e8 9e dc ff ff       	call   800dcd <sys_page_unmap>
+  80312f:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < memsz; i += PGSIZE) {
+  803132:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803138:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80313e:	89 9d 94 fd ff ff    	mov    %ebx,-0x26c(%ebp)
+  803144:	8b 85 8c fd ff ff    	mov    -0x274(%ebp),%eax
+  80314a:	39 c3                	cmp    %eax,%ebx
+  80314c:	73 65                	jae    8031b3 <spawn+0x375>
+		if (i >= filesz) {
+  80314e:	39 fb                	cmp    %edi,%ebx
+  803150:	0f 82 2e ff ff ff    	jb     803084 <spawn+0x246>
+			if ((r = sys_page_alloc(child, (void*) (va + i), perm)) < 0)
+  803156:	83 ec 04             	sub    $0x4,%esp
+  803159:	ff b5 84 fd ff ff    	push   -0x27c(%ebp)
+  80315f:	56                   	push   %esi
+  803160:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  803166:	e8 c9 db ff ff       	call   800d34 <sys_page_alloc>
+  80316b:	83 c4 10             	add    $0x10,%esp
+  80316e:	85 c0                	test   %eax,%eax
+  803170:	79 c0                	jns    803132 <spawn+0x2f4>
+  803172:	89 c7                	mov    %eax,%edi
+	sys_env_destroy(child);
+  803174:	83 ec 0c             	sub    $0xc,%esp
+  803177:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  80317d:	e8 0f db ff ff       	call   800c91 <sys_env_destroy>
+	close(fd);
+  803182:	83 c4 04             	add    $0x4,%esp
+  803185:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  80318b:	e8 8d e8 ff ff       	call   801a1d <close>
+	return r;
+  803190:	83 c4 10             	add    $0x10,%esp
+  803193:	89 bd 88 fd ff ff    	mov    %edi,-0x278(%ebp)
+  803199:	e9 a6 01 00 00       	jmp    803344 <spawn+0x506>
+				panic("spawn: sys_page_map data: %e", r);
+  80319e:	50                   	push   %eax
+  80319f:	68 ae 55 80 00       	push   $0x8055ae
+  8031a4:	68 39 01 00 00       	push   $0x139
+  8031a9:	68 a2 55 80 00       	push   $0x8055a2
+  8031ae:	e8 84 d0 ff ff       	call   800237 <_panic>
+  8031b3:	8b 8d 7c fd ff ff    	mov    -0x284(%ebp),%ecx
+  8031b9:	8b 95 78 fd ff ff    	mov    -0x288(%ebp),%edx
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  8031bf:	83 c1 01             	add    $0x1,%ecx
+  8031c2:	83 c2 20             	add    $0x20,%edx
+  8031c5:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  8031cc:	39 c8                	cmp    %ecx,%eax
+  8031ce:	0f 8e 88 00 00 00    	jle    80325c <spawn+0x41e>
+		if (ph->p_type != ELF_PROG_LOAD)
+  8031d4:	83 3a 01             	cmpl   $0x1,(%edx)
+  8031d7:	75 e6                	jne    8031bf <spawn+0x381>
+		if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  8031d9:	8b 42 18             	mov    0x18(%edx),%eax
+  8031dc:	83 e0 02             	and    $0x2,%eax
+		perm = PTE_P | PTE_U;
+  8031df:	83 f8 01             	cmp    $0x1,%eax
+  8031e2:	19 c0                	sbb    %eax,%eax
+  8031e4:	83 e0 fe             	and    $0xfffffffe,%eax
+  8031e7:	83 c0 07             	add    $0x7,%eax
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  8031ea:	8b 72 04             	mov    0x4(%edx),%esi
+  8031ed:	89 b5 80 fd ff ff    	mov    %esi,-0x280(%ebp)
+  8031f3:	8b 7a 10             	mov    0x10(%edx),%edi
+  8031f6:	89 bd 94 fd ff ff    	mov    %edi,-0x26c(%ebp)
+  8031fc:	8b 5a 14             	mov    0x14(%edx),%ebx
+  8031ff:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+  803205:	8b 7a 08             	mov    0x8(%edx),%edi
+  803208:	89 bd 84 fd ff ff    	mov    %edi,-0x27c(%ebp)
+	if ((i = PGOFF(va))) {
+  80320e:	89 fb                	mov    %edi,%ebx
+  803210:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  803216:	74 1c                	je     803234 <spawn+0x3f6>
+		va -= i;
+  803218:	29 df                	sub    %ebx,%edi
+  80321a:	89 bd 84 fd ff ff    	mov    %edi,-0x27c(%ebp)
+		memsz += i;
+  803220:	01 9d 8c fd ff ff    	add    %ebx,-0x274(%ebp)
+		filesz += i;
+  803226:	01 9d 94 fd ff ff    	add    %ebx,-0x26c(%ebp)
+		fileoffset -= i;
+  80322c:	29 de                	sub    %ebx,%esi
+  80322e:	89 b5 80 fd ff ff    	mov    %esi,-0x280(%ebp)
+	for (i = 0; i < memsz; i += PGSIZE) {
+  803234:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803239:	8b bd 94 fd ff ff    	mov    -0x26c(%ebp),%edi
+  80323f:	8b b5 84 fd ff ff    	mov    -0x27c(%ebp),%esi
+  803245:	89 8d 7c fd ff ff    	mov    %ecx,-0x284(%ebp)
+  80324b:	89 95 78 fd ff ff    	mov    %edx,-0x288(%ebp)
+  803251:	89 85 84 fd ff ff    	mov    %eax,-0x27c(%ebp)
+  803257:	e9 e2 fe ff ff       	jmp    80313e <spawn+0x300>
+	close(fd);
+  80325c:	83 ec 0c             	sub    $0xc,%esp
+  80325f:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  803265:	e8 b3 e7 ff ff       	call   801a1d <close>
+  80326a:	83 c4 10             	add    $0x10,%esp
+	// LAB 5: Your code here.
+	int r;
+	extern volatile pte_t uvpt[];     // VA of "virtual page table"
+	extern volatile pde_t uvpd[];     // VA of current page directory
+
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80326d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803272:	eb 75                	jmp    8032e9 <spawn+0x4ab>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+			int entry_num = NPTENTRIES;
+			if (pdeno == PDX(UTOP-1)) {
+				entry_num = PTX(UTOP-1)+1;
+			}
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  803274:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80327a:	83 c6 01             	add    $0x1,%esi
+  80327d:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+  803283:	74 4f                	je     8032d4 <spawn+0x496>
+				pte_t pte = uvpt[pdeno * NPDENTRIES + pteno];
+  803285:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+				if ((pte & PTE_P) && (pte & PTE_U) && (pte & PTE_SHARE)) {
+  80328c:	89 c2                	mov    %eax,%edx
+  80328e:	81 e2 05 04 00 00    	and    $0x405,%edx
+  803294:	81 fa 05 04 00 00    	cmp    $0x405,%edx
+  80329a:	75 d8                	jne    803274 <spawn+0x436>
+					void* va = (void*)PGADDR(pdeno, pteno, 0);
+  80329c:	89 da                	mov    %ebx,%edx
+  80329e:	09 fa                	or     %edi,%edx
+					if ((r = sys_page_map(0, va, child, va, pte & PTE_SYSCALL)) < 0) {
+  8032a0:	83 ec 0c             	sub    $0xc,%esp
+  8032a3:	25 07 0e 00 00       	and    $0xe07,%eax
+  8032a8:	50                   	push   %eax
+  8032a9:	52                   	push   %edx
+  8032aa:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  8032b0:	52                   	push   %edx
+  8032b1:	6a 00                	push   $0x0
+  8032b3:	e8 c9 da ff ff       	call   800d81 <sys_page_map>
+  8032b8:	83 c4 20             	add    $0x20,%esp
+  8032bb:	85 c0                	test   %eax,%eax
+  8032bd:	79 b5                	jns    803274 <spawn+0x436>
+		panic("copy_shared_pages: %e", r);
+  8032bf:	50                   	push   %eax
+  8032c0:	68 fc 55 80 00       	push   $0x8055fc
+  8032c5:	68 94 00 00 00       	push   $0x94
+  8032ca:	68 a2 55 80 00       	push   $0x8055a2
+  8032cf:	e8 63 cf ff ff       	call   800237 <_panic>
+  8032d4:	8b 95 94 fd ff ff    	mov    -0x26c(%ebp),%edx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8032da:	83 c2 01             	add    $0x1,%edx
+  8032dd:	81 fa bb 03 00 00    	cmp    $0x3bb,%edx
+  8032e3:	0f 84 8b 00 00 00    	je     803374 <spawn+0x536>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  8032e9:	8b 04 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%eax
+  8032f0:	a8 07                	test   $0x7,%al
+  8032f2:	74 e6                	je     8032da <spawn+0x49c>
+  8032f4:	89 d6                	mov    %edx,%esi
+  8032f6:	c1 e6 0a             	shl    $0xa,%esi
+  8032f9:	89 d7                	mov    %edx,%edi
+  8032fb:	c1 e7 16             	shl    $0x16,%edi
+  8032fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803303:	89 95 94 fd ff ff    	mov    %edx,-0x26c(%ebp)
+  803309:	e9 77 ff ff ff       	jmp    803285 <spawn+0x447>
+		panic("sys_env_set_trapframe: %e", r);
+  80330e:	50                   	push   %eax
+  80330f:	68 cb 55 80 00       	push   $0x8055cb
+  803314:	68 98 00 00 00       	push   $0x98
+  803319:	68 a2 55 80 00       	push   $0x8055a2
+  80331e:	e8 14 cf ff ff       	call   800237 <_panic>
+		panic("sys_env_set_status: %e", r);
+  803323:	50                   	push   %eax
+  803324:	68 e5 55 80 00       	push   $0x8055e5
+  803329:	68 9b 00 00 00       	push   $0x9b
+  80332e:	68 a2 55 80 00       	push   $0x8055a2
+  803333:	e8 ff ce ff ff       	call   800237 <_panic>
+		return r;
+  803338:	8b 85 90 fd ff ff    	mov    -0x270(%ebp),%eax
+  80333e:	89 85 88 fd ff ff    	mov    %eax,-0x278(%ebp)
+}
+  803344:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  80334a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80334d:	5b                   	pop    %ebx
+  80334e:	5e                   	pop    %esi
+  80334f:	5f                   	pop    %edi
+  803350:	5d                   	pop    %ebp
+  803351:	c3                   	ret
+  803352:	89 c7                	mov    %eax,%edi
+  803354:	e9 1b fe ff ff       	jmp    803174 <spawn+0x336>
+  803359:	89 c7                	mov    %eax,%edi
+  80335b:	e9 14 fe ff ff       	jmp    803174 <spawn+0x336>
+  803360:	89 c7                	mov    %eax,%edi
+  803362:	e9 0d fe ff ff       	jmp    803174 <spawn+0x336>
+		return -E_NO_MEM;
+  803367:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+	return r;
+  80336c:	89 85 88 fd ff ff    	mov    %eax,-0x278(%ebp)
+  803372:	eb d0                	jmp    803344 <spawn+0x506>
+	child_tf.tf_eflags |= FL_IOPL_3;   // devious: see user/faultio.c
+  803374:	81 8d dc fd ff ff 00 	orl    $0x3000,-0x224(%ebp)
+  80337b:	30 00 00 
+	if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  80337e:	83 ec 08             	sub    $0x8,%esp
+  803381:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  803387:	50                   	push   %eax
+  803388:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  80338e:	e8 d2 da ff ff       	call   800e65 <sys_env_set_trapframe>
+  803393:	83 c4 10             	add    $0x10,%esp
+  803396:	85 c0                	test   %eax,%eax
+  803398:	0f 88 70 ff ff ff    	js     80330e <spawn+0x4d0>
+	if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  80339e:	83 ec 08             	sub    $0x8,%esp
+  8033a1:	6a 02                	push   $0x2
+  8033a3:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  8033a9:	e8 6b da ff ff       	call   800e19 <sys_env_set_status>
+  8033ae:	83 c4 10             	add    $0x10,%esp
+  8033b1:	85 c0                	test   %eax,%eax
+  8033b3:	0f 88 6a ff ff ff    	js     803323 <spawn+0x4e5>
+	return child;
+  8033b9:	8b 85 90 fd ff ff    	mov    -0x270(%ebp),%eax
+  8033bf:	89 85 88 fd ff ff    	mov    %eax,-0x278(%ebp)
+  8033c5:	e9 7a ff ff ff       	jmp    803344 <spawn+0x506>
+	sys_page_unmap(0, UTEMP);
+  8033ca:	83 ec 08             	sub    $0x8,%esp
+  8033cd:	68 00 00 40 00       	push   $0x400000
+  8033d2:	6a 00                	push   $0x0
+  8033d4:	e8 f4 d9 ff ff       	call   800dcd <sys_page_unmap>
+  8033d9:	83 c4 10             	add    $0x10,%esp
+  8033dc:	89 9d 88 fd ff ff    	mov    %ebx,-0x278(%ebp)
+  8033e2:	e9 5d ff ff ff       	jmp    803344 <spawn+0x506>
+
+008033e7 <spawnl>:
+{
+  8033e7:	55                   	push   %ebp
+  8033e8:	89 e5                	mov    %esp,%ebp
+  8033ea:	56                   	push   %esi
+  8033eb:	53                   	push   %ebx
+	va_start(vl, arg0);
+  8033ec:	8d 55 10             	lea    0x10(%ebp),%edx
+	int argc=0;
+  8033ef:	b8 00 00 00 00       	mov    $0x0,%eax
+	while(va_arg(vl, void *) != NULL)
+  8033f4:	eb 05                	jmp    8033fb <spawnl+0x14>
+		argc++;
+  8033f6:	83 c0 01             	add    $0x1,%eax
+	while(va_arg(vl, void *) != NULL)
+  8033f9:	89 ca                	mov    %ecx,%edx
+  8033fb:	8d 4a 04             	lea    0x4(%edx),%ecx
+  8033fe:	83 3a 00             	cmpl   $0x0,(%edx)
+  803401:	75 f3                	jne    8033f6 <spawnl+0xf>
+	const char *argv[argc+2];
+  803403:	8d 14 85 17 00 00 00 	lea    0x17(,%eax,4),%edx
+  80340a:	83 e2 f0             	and    $0xfffffff0,%edx
+  80340d:	29 d4                	sub    %edx,%esp
+  80340f:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  803413:	89 da                	mov    %ebx,%edx
+  803415:	c1 ea 02             	shr    $0x2,%edx
+  803418:	83 e3 fc             	and    $0xfffffffc,%ebx
+	argv[0] = arg0;
+  80341b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80341e:	89 0c 95 00 00 00 00 	mov    %ecx,0x0(,%edx,4)
+	argv[argc+1] = NULL;
+  803425:	c7 44 83 04 00 00 00 	movl   $0x0,0x4(%ebx,%eax,4)
+  80342c:	00 
+	va_start(vl, arg0);
+  80342d:	8d 4d 10             	lea    0x10(%ebp),%ecx
+	for(i=0;i<argc;i++)
+  803430:	89 c2                	mov    %eax,%edx
+  803432:	b8 00 00 00 00       	mov    $0x0,%eax
+  803437:	eb 0b                	jmp    803444 <spawnl+0x5d>
+		argv[i+1] = va_arg(vl, const char *);
+  803439:	83 c0 01             	add    $0x1,%eax
+  80343c:	8b 31                	mov    (%ecx),%esi
+  80343e:	89 34 83             	mov    %esi,(%ebx,%eax,4)
+  803441:	8d 49 04             	lea    0x4(%ecx),%ecx
+	for(i=0;i<argc;i++)
+  803444:	39 d0                	cmp    %edx,%eax
+  803446:	75 f1                	jne    803439 <spawnl+0x52>
+	return spawn(prog, argv);
+  803448:	83 ec 08             	sub    $0x8,%esp
+  80344b:	53                   	push   %ebx
+  80344c:	ff 75 08             	push   0x8(%ebp)
+  80344f:	e8 ea f9 ff ff       	call   802e3e <spawn>
+}
+  803454:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803457:	5b                   	pop    %ebx
+  803458:	5e                   	pop    %esi
+  803459:	5d                   	pop    %ebp
+  80345a:	c3                   	ret
+
+0080345b <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80345b:	55                   	push   %ebp
+  80345c:	89 e5                	mov    %esp,%ebp
+  80345e:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  803461:	68 3a 56 80 00       	push   $0x80563a
+  803466:	ff 75 0c             	push   0xc(%ebp)
+  803469:	e8 88 d4 ff ff       	call   8008f6 <strcpy>
+	return 0;
+}
+  80346e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803473:	c9                   	leave
+  803474:	c3                   	ret
+
+00803475 <devsock_close>:
+{
+  803475:	55                   	push   %ebp
+  803476:	89 e5                	mov    %esp,%ebp
+  803478:	53                   	push   %ebx
+  803479:	83 ec 10             	sub    $0x10,%esp
+  80347c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  80347f:	53                   	push   %ebx
+  803480:	e8 62 17 00 00       	call   804be7 <pageref>
+  803485:	89 c2                	mov    %eax,%edx
+  803487:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80348a:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  80348f:	83 fa 01             	cmp    $0x1,%edx
+  803492:	74 05                	je     803499 <devsock_close+0x24>
+}
+  803494:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803497:	c9                   	leave
+  803498:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  803499:	83 ec 0c             	sub    $0xc,%esp
+  80349c:	ff 73 0c             	push   0xc(%ebx)
+  80349f:	e8 b7 02 00 00       	call   80375b <nsipc_close>
+  8034a4:	83 c4 10             	add    $0x10,%esp
+  8034a7:	eb eb                	jmp    803494 <devsock_close+0x1f>
+
+008034a9 <devsock_write>:
+{
+  8034a9:	55                   	push   %ebp
+  8034aa:	89 e5                	mov    %esp,%ebp
+  8034ac:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8034af:	6a 00                	push   $0x0
+  8034b1:	ff 75 10             	push   0x10(%ebp)
+  8034b4:	ff 75 0c             	push   0xc(%ebp)
+  8034b7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034ba:	ff 70 0c             	push   0xc(%eax)
+  8034bd:	e8 79 03 00 00       	call   80383b <nsipc_send>
+}
+  8034c2:	c9                   	leave
+  8034c3:	c3                   	ret
+
+008034c4 <devsock_read>:
+{
+  8034c4:	55                   	push   %ebp
+  8034c5:	89 e5                	mov    %esp,%ebp
+  8034c7:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8034ca:	6a 00                	push   $0x0
+  8034cc:	ff 75 10             	push   0x10(%ebp)
+  8034cf:	ff 75 0c             	push   0xc(%ebp)
+  8034d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034d5:	ff 70 0c             	push   0xc(%eax)
+  8034d8:	e8 ef 02 00 00       	call   8037cc <nsipc_recv>
+}
+  8034dd:	c9                   	leave
+  8034de:	c3                   	ret
+
+008034df <fd2sockid>:
+{
+  8034df:	55                   	push   %ebp
+  8034e0:	89 e5                	mov    %esp,%ebp
+  8034e2:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8034e5:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8034e8:	52                   	push   %edx
+  8034e9:	50                   	push   %eax
+  8034ea:	e8 da e3 ff ff       	call   8018c9 <fd_lookup>
+  8034ef:	83 c4 10             	add    $0x10,%esp
+  8034f2:	85 c0                	test   %eax,%eax
+  8034f4:	78 10                	js     803506 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8034f6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8034f9:	8b 0d 80 62 80 00    	mov    0x806280,%ecx
+  8034ff:	39 08                	cmp    %ecx,(%eax)
+  803501:	75 05                	jne    803508 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  803503:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  803506:	c9                   	leave
+  803507:	c3                   	ret
+		return -E_NOT_SUPP;
+  803508:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80350d:	eb f7                	jmp    803506 <fd2sockid+0x27>
+
+0080350f <alloc_sockfd>:
+{
+  80350f:	55                   	push   %ebp
+  803510:	89 e5                	mov    %esp,%ebp
+  803512:	56                   	push   %esi
+  803513:	53                   	push   %ebx
+  803514:	83 ec 1c             	sub    $0x1c,%esp
+  803517:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  803519:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80351c:	50                   	push   %eax
+  80351d:	e8 51 e3 ff ff       	call   801873 <fd_alloc>
+  803522:	89 c3                	mov    %eax,%ebx
+  803524:	83 c4 10             	add    $0x10,%esp
+  803527:	85 c0                	test   %eax,%eax
+  803529:	78 43                	js     80356e <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80352b:	83 ec 04             	sub    $0x4,%esp
+  80352e:	68 07 04 00 00       	push   $0x407
+  803533:	ff 75 f4             	push   -0xc(%ebp)
+  803536:	6a 00                	push   $0x0
+  803538:	e8 f7 d7 ff ff       	call   800d34 <sys_page_alloc>
+  80353d:	89 c3                	mov    %eax,%ebx
+  80353f:	83 c4 10             	add    $0x10,%esp
+  803542:	85 c0                	test   %eax,%eax
+  803544:	78 28                	js     80356e <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  803546:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803549:	8b 15 80 62 80 00    	mov    0x806280,%edx
+  80354f:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  803551:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803554:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80355b:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  80355e:	83 ec 0c             	sub    $0xc,%esp
+  803561:	50                   	push   %eax
+  803562:	e8 e5 e2 ff ff       	call   80184c <fd2num>
+  803567:	89 c3                	mov    %eax,%ebx
+  803569:	83 c4 10             	add    $0x10,%esp
+  80356c:	eb 0c                	jmp    80357a <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  80356e:	83 ec 0c             	sub    $0xc,%esp
+  803571:	56                   	push   %esi
+  803572:	e8 e4 01 00 00       	call   80375b <nsipc_close>
+		return r;
+  803577:	83 c4 10             	add    $0x10,%esp
+}
+  80357a:	89 d8                	mov    %ebx,%eax
+  80357c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80357f:	5b                   	pop    %ebx
+  803580:	5e                   	pop    %esi
+  803581:	5d                   	pop    %ebp
+  803582:	c3                   	ret
+
+00803583 <accept>:
+{
+  803583:	55                   	push   %ebp
+  803584:	89 e5                	mov    %esp,%ebp
+  803586:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803589:	8b 45 08             	mov    0x8(%ebp),%eax
+  80358c:	e8 4e ff ff ff       	call   8034df <fd2sockid>
+  803591:	85 c0                	test   %eax,%eax
+  803593:	78 1b                	js     8035b0 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  803595:	83 ec 04             	sub    $0x4,%esp
+  803598:	ff 75 10             	push   0x10(%ebp)
+  80359b:	ff 75 0c             	push   0xc(%ebp)
+  80359e:	50                   	push   %eax
+  80359f:	e8 0e 01 00 00       	call   8036b2 <nsipc_accept>
+  8035a4:	83 c4 10             	add    $0x10,%esp
+  8035a7:	85 c0                	test   %eax,%eax
+  8035a9:	78 05                	js     8035b0 <accept+0x2d>
+	return alloc_sockfd(r);
+  8035ab:	e8 5f ff ff ff       	call   80350f <alloc_sockfd>
+}
+  8035b0:	c9                   	leave
+  8035b1:	c3                   	ret
+
+008035b2 <bind>:
+{
+  8035b2:	55                   	push   %ebp
+  8035b3:	89 e5                	mov    %esp,%ebp
+  8035b5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8035b8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035bb:	e8 1f ff ff ff       	call   8034df <fd2sockid>
+  8035c0:	85 c0                	test   %eax,%eax
+  8035c2:	78 12                	js     8035d6 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8035c4:	83 ec 04             	sub    $0x4,%esp
+  8035c7:	ff 75 10             	push   0x10(%ebp)
+  8035ca:	ff 75 0c             	push   0xc(%ebp)
+  8035cd:	50                   	push   %eax
+  8035ce:	e8 31 01 00 00       	call   803704 <nsipc_bind>
+  8035d3:	83 c4 10             	add    $0x10,%esp
+}
+  8035d6:	c9                   	leave
+  8035d7:	c3                   	ret
+
+008035d8 <shutdown>:
+{
+  8035d8:	55                   	push   %ebp
+  8035d9:	89 e5                	mov    %esp,%ebp
+  8035db:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8035de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035e1:	e8 f9 fe ff ff       	call   8034df <fd2sockid>
+  8035e6:	85 c0                	test   %eax,%eax
+  8035e8:	78 0f                	js     8035f9 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8035ea:	83 ec 08             	sub    $0x8,%esp
+  8035ed:	ff 75 0c             	push   0xc(%ebp)
+  8035f0:	50                   	push   %eax
+  8035f1:	e8 43 01 00 00       	call   803739 <nsipc_shutdown>
+  8035f6:	83 c4 10             	add    $0x10,%esp
+}
+  8035f9:	c9                   	leave
+  8035fa:	c3                   	ret
+
+008035fb <connect>:
+{
+  8035fb:	55                   	push   %ebp
+  8035fc:	89 e5                	mov    %esp,%ebp
+  8035fe:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803601:	8b 45 08             	mov    0x8(%ebp),%eax
+  803604:	e8 d6 fe ff ff       	call   8034df <fd2sockid>
+  803609:	85 c0                	test   %eax,%eax
+  80360b:	78 12                	js     80361f <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  80360d:	83 ec 04             	sub    $0x4,%esp
+  803610:	ff 75 10             	push   0x10(%ebp)
+  803613:	ff 75 0c             	push   0xc(%ebp)
+  803616:	50                   	push   %eax
+  803617:	e8 59 01 00 00       	call   803775 <nsipc_connect>
+  80361c:	83 c4 10             	add    $0x10,%esp
+}
+  80361f:	c9                   	leave
+  803620:	c3                   	ret
+
+00803621 <listen>:
+{
+  803621:	55                   	push   %ebp
+  803622:	89 e5                	mov    %esp,%ebp
+  803624:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803627:	8b 45 08             	mov    0x8(%ebp),%eax
+  80362a:	e8 b0 fe ff ff       	call   8034df <fd2sockid>
+  80362f:	85 c0                	test   %eax,%eax
+  803631:	78 0f                	js     803642 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  803633:	83 ec 08             	sub    $0x8,%esp
+  803636:	ff 75 0c             	push   0xc(%ebp)
+  803639:	50                   	push   %eax
+  80363a:	e8 6b 01 00 00       	call   8037aa <nsipc_listen>
+  80363f:	83 c4 10             	add    $0x10,%esp
+}
+  803642:	c9                   	leave
+  803643:	c3                   	ret
+
+00803644 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  803644:	55                   	push   %ebp
+  803645:	89 e5                	mov    %esp,%ebp
+  803647:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80364a:	ff 75 10             	push   0x10(%ebp)
+  80364d:	ff 75 0c             	push   0xc(%ebp)
+  803650:	ff 75 08             	push   0x8(%ebp)
+  803653:	e8 41 02 00 00       	call   803899 <nsipc_socket>
+  803658:	83 c4 10             	add    $0x10,%esp
+  80365b:	85 c0                	test   %eax,%eax
+  80365d:	78 05                	js     803664 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  80365f:	e8 ab fe ff ff       	call   80350f <alloc_sockfd>
+}
+  803664:	c9                   	leave
+  803665:	c3                   	ret
+
+00803666 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  803666:	55                   	push   %ebp
+  803667:	89 e5                	mov    %esp,%ebp
+  803669:	53                   	push   %ebx
+  80366a:	83 ec 04             	sub    $0x4,%esp
+  80366d:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  80366f:	83 3d 08 70 80 00 00 	cmpl   $0x0,0x807008
+  803676:	74 26                	je     80369e <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  803678:	6a 07                	push   $0x7
+  80367a:	68 00 90 80 00       	push   $0x809000
+  80367f:	53                   	push   %ebx
+  803680:	ff 35 08 70 80 00    	push   0x807008
+  803686:	e8 c7 14 00 00       	call   804b52 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  80368b:	83 c4 0c             	add    $0xc,%esp
+  80368e:	6a 00                	push   $0x0
+  803690:	6a 00                	push   $0x0
+  803692:	6a 00                	push   $0x0
+  803694:	e8 c3 13 00 00       	call   804a5c <ipc_recv>
+}
+  803699:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80369c:	c9                   	leave
+  80369d:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80369e:	83 ec 0c             	sub    $0xc,%esp
+  8036a1:	6a 02                	push   $0x2
+  8036a3:	e8 00 15 00 00       	call   804ba8 <ipc_find_env>
+  8036a8:	a3 08 70 80 00       	mov    %eax,0x807008
+  8036ad:	83 c4 10             	add    $0x10,%esp
+  8036b0:	eb c6                	jmp    803678 <nsipc+0x12>
+
+008036b2 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8036b2:	55                   	push   %ebp
+  8036b3:	89 e5                	mov    %esp,%ebp
+  8036b5:	56                   	push   %esi
+  8036b6:	53                   	push   %ebx
+  8036b7:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8036ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036bd:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  8036c2:	8b 06                	mov    (%esi),%eax
+  8036c4:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8036c9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8036ce:	e8 93 ff ff ff       	call   803666 <nsipc>
+  8036d3:	89 c3                	mov    %eax,%ebx
+  8036d5:	85 c0                	test   %eax,%eax
+  8036d7:	79 09                	jns    8036e2 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8036d9:	89 d8                	mov    %ebx,%eax
+  8036db:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8036de:	5b                   	pop    %ebx
+  8036df:	5e                   	pop    %esi
+  8036e0:	5d                   	pop    %ebp
+  8036e1:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8036e2:	83 ec 04             	sub    $0x4,%esp
+  8036e5:	ff 35 10 90 80 00    	push   0x809010
+  8036eb:	68 00 90 80 00       	push   $0x809000
+  8036f0:	ff 75 0c             	push   0xc(%ebp)
+  8036f3:	e8 84 d3 ff ff       	call   800a7c <memmove>
+		*addrlen = ret->ret_addrlen;
+  8036f8:	a1 10 90 80 00       	mov    0x809010,%eax
+  8036fd:	89 06                	mov    %eax,(%esi)
+  8036ff:	83 c4 10             	add    $0x10,%esp
+	return r;
+  803702:	eb d5                	jmp    8036d9 <nsipc_accept+0x27>
+
+00803704 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  803704:	55                   	push   %ebp
+  803705:	89 e5                	mov    %esp,%ebp
+  803707:	53                   	push   %ebx
+  803708:	83 ec 08             	sub    $0x8,%esp
+  80370b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  80370e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803711:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  803716:	53                   	push   %ebx
+  803717:	ff 75 0c             	push   0xc(%ebp)
+  80371a:	68 04 90 80 00       	push   $0x809004
+  80371f:	e8 58 d3 ff ff       	call   800a7c <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  803724:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  80372a:	b8 02 00 00 00       	mov    $0x2,%eax
+  80372f:	e8 32 ff ff ff       	call   803666 <nsipc>
+}
+  803734:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803737:	c9                   	leave
+  803738:	c3                   	ret
+
+00803739 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  803739:	55                   	push   %ebp
+  80373a:	89 e5                	mov    %esp,%ebp
+  80373c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  80373f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803742:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  803747:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80374a:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  80374f:	b8 03 00 00 00       	mov    $0x3,%eax
+  803754:	e8 0d ff ff ff       	call   803666 <nsipc>
+}
+  803759:	c9                   	leave
+  80375a:	c3                   	ret
+
+0080375b <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80375b:	55                   	push   %ebp
+  80375c:	89 e5                	mov    %esp,%ebp
+  80375e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  803761:	8b 45 08             	mov    0x8(%ebp),%eax
+  803764:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  803769:	b8 04 00 00 00       	mov    $0x4,%eax
+  80376e:	e8 f3 fe ff ff       	call   803666 <nsipc>
+}
+  803773:	c9                   	leave
+  803774:	c3                   	ret
+
+00803775 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  803775:	55                   	push   %ebp
+  803776:	89 e5                	mov    %esp,%ebp
+  803778:	53                   	push   %ebx
+  803779:	83 ec 08             	sub    $0x8,%esp
+  80377c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  80377f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803782:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  803787:	53                   	push   %ebx
+  803788:	ff 75 0c             	push   0xc(%ebp)
+  80378b:	68 04 90 80 00       	push   $0x809004
+  803790:	e8 e7 d2 ff ff       	call   800a7c <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  803795:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  80379b:	b8 05 00 00 00       	mov    $0x5,%eax
+  8037a0:	e8 c1 fe ff ff       	call   803666 <nsipc>
+}
+  8037a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8037a8:	c9                   	leave
+  8037a9:	c3                   	ret
+
+008037aa <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8037aa:	55                   	push   %ebp
+  8037ab:	89 e5                	mov    %esp,%ebp
+  8037ad:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8037b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037b3:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  8037b8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8037bb:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  8037c0:	b8 06 00 00 00       	mov    $0x6,%eax
+  8037c5:	e8 9c fe ff ff       	call   803666 <nsipc>
+}
+  8037ca:	c9                   	leave
+  8037cb:	c3                   	ret
+
+008037cc <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8037cc:	55                   	push   %ebp
+  8037cd:	89 e5                	mov    %esp,%ebp
+  8037cf:	56                   	push   %esi
+  8037d0:	53                   	push   %ebx
+  8037d1:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8037d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037d7:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  8037dc:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  8037e2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8037e5:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8037ea:	b8 07 00 00 00       	mov    $0x7,%eax
+  8037ef:	e8 72 fe ff ff       	call   803666 <nsipc>
+  8037f4:	89 c3                	mov    %eax,%ebx
+  8037f6:	85 c0                	test   %eax,%eax
+  8037f8:	78 22                	js     80381c <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8037fa:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8037ff:	39 c6                	cmp    %eax,%esi
+  803801:	0f 4e c6             	cmovle %esi,%eax
+  803804:	39 c3                	cmp    %eax,%ebx
+  803806:	7f 1d                	jg     803825 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  803808:	83 ec 04             	sub    $0x4,%esp
+  80380b:	53                   	push   %ebx
+  80380c:	68 00 90 80 00       	push   $0x809000
+  803811:	ff 75 0c             	push   0xc(%ebp)
+  803814:	e8 63 d2 ff ff       	call   800a7c <memmove>
+  803819:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  80381c:	89 d8                	mov    %ebx,%eax
+  80381e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803821:	5b                   	pop    %ebx
+  803822:	5e                   	pop    %esi
+  803823:	5d                   	pop    %ebp
+  803824:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  803825:	68 46 56 80 00       	push   $0x805646
+  80382a:	68 91 54 80 00       	push   $0x805491
+  80382f:	6a 62                	push   $0x62
+  803831:	68 5b 56 80 00       	push   $0x80565b
+  803836:	e8 fc c9 ff ff       	call   800237 <_panic>
+
+0080383b <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80383b:	55                   	push   %ebp
+  80383c:	89 e5                	mov    %esp,%ebp
+  80383e:	53                   	push   %ebx
+  80383f:	83 ec 04             	sub    $0x4,%esp
+  803842:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  803845:	8b 45 08             	mov    0x8(%ebp),%eax
+  803848:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  80384d:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  803853:	7f 2e                	jg     803883 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  803855:	83 ec 04             	sub    $0x4,%esp
+  803858:	53                   	push   %ebx
+  803859:	ff 75 0c             	push   0xc(%ebp)
+  80385c:	68 0c 90 80 00       	push   $0x80900c
+  803861:	e8 16 d2 ff ff       	call   800a7c <memmove>
+	nsipcbuf.send.req_size = size;
+  803866:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  80386c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80386f:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  803874:	b8 08 00 00 00       	mov    $0x8,%eax
+  803879:	e8 e8 fd ff ff       	call   803666 <nsipc>
+}
+  80387e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803881:	c9                   	leave
+  803882:	c3                   	ret
+	assert(size < 1600);
+  803883:	68 67 56 80 00       	push   $0x805667
+  803888:	68 91 54 80 00       	push   $0x805491
+  80388d:	6a 6d                	push   $0x6d
+  80388f:	68 5b 56 80 00       	push   $0x80565b
+  803894:	e8 9e c9 ff ff       	call   800237 <_panic>
+
+00803899 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  803899:	55                   	push   %ebp
+  80389a:	89 e5                	mov    %esp,%ebp
+  80389c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  80389f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8038a2:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  8038a7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8038aa:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  8038af:	8b 45 10             	mov    0x10(%ebp),%eax
+  8038b2:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  8038b7:	b8 09 00 00 00       	mov    $0x9,%eax
+  8038bc:	e8 a5 fd ff ff       	call   803666 <nsipc>
+}
+  8038c1:	c9                   	leave
+  8038c2:	c3                   	ret
+
+008038c3 <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  8038c3:	55                   	push   %ebp
+  8038c4:	89 e5                	mov    %esp,%ebp
+  8038c6:	53                   	push   %ebx
+  8038c7:	83 ec 10             	sub    $0x10,%esp
+  8038ca:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  8038cd:	68 0c 70 80 00       	push   $0x80700c
+  8038d2:	e8 a1 07 00 00       	call   804078 <mutex_lock>
+	if (v == 0)
+  8038d7:	83 c4 10             	add    $0x10,%esp
+  8038da:	85 db                	test   %ebx,%ebx
+  8038dc:	0f 84 85 00 00 00    	je     803967 <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  8038e2:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  8038e8:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  8038ed:	77 51                	ja     803940 <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  8038ef:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  8038f5:	89 d8                	mov    %ebx,%eax
+  8038f7:	c1 e8 0c             	shr    $0xc,%eax
+  8038fa:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803901:	f6 c4 02             	test   $0x2,%ah
+  803904:	74 50                	je     803956 <free+0x93>
+		sys_page_unmap(0, c);
+  803906:	83 ec 08             	sub    $0x8,%esp
+  803909:	53                   	push   %ebx
+  80390a:	6a 00                	push   $0x0
+  80390c:	e8 bc d4 ff ff       	call   800dcd <sys_page_unmap>
+		c += PGSIZE;
+  803911:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  803917:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  80391d:	83 c4 10             	add    $0x10,%esp
+  803920:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  803925:	76 ce                	jbe    8038f5 <free+0x32>
+  803927:	68 af 56 80 00       	push   $0x8056af
+  80392c:	68 91 54 80 00       	push   $0x805491
+  803931:	68 82 00 00 00       	push   $0x82
+  803936:	68 a2 56 80 00       	push   $0x8056a2
+  80393b:	e8 f7 c8 ff ff       	call   800237 <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  803940:	68 74 56 80 00       	push   $0x805674
+  803945:	68 91 54 80 00       	push   $0x805491
+  80394a:	6a 7b                	push   $0x7b
+  80394c:	68 a2 56 80 00       	push   $0x8056a2
+  803951:	e8 e1 c8 ff ff       	call   800237 <_panic>
+	if (--(*ref) == 0)
+  803956:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  80395c:	83 e8 01             	sub    $0x1,%eax
+  80395f:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  803965:	74 15                	je     80397c <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  803967:	83 ec 0c             	sub    $0xc,%esp
+  80396a:	68 0c 70 80 00       	push   $0x80700c
+  80396f:	e8 71 07 00 00       	call   8040e5 <mutex_unlock>
+}
+  803974:	83 c4 10             	add    $0x10,%esp
+  803977:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80397a:	c9                   	leave
+  80397b:	c3                   	ret
+		sys_page_unmap(0, c);
+  80397c:	83 ec 08             	sub    $0x8,%esp
+  80397f:	53                   	push   %ebx
+  803980:	6a 00                	push   $0x0
+  803982:	e8 46 d4 ff ff       	call   800dcd <sys_page_unmap>
+  803987:	83 c4 10             	add    $0x10,%esp
+  80398a:	eb db                	jmp    803967 <free+0xa4>
+
+0080398c <malloc>:
+{
+  80398c:	55                   	push   %ebp
+  80398d:	89 e5                	mov    %esp,%ebp
+  80398f:	57                   	push   %edi
+  803990:	56                   	push   %esi
+  803991:	53                   	push   %ebx
+  803992:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  803995:	68 0c 70 80 00       	push   $0x80700c
+  80399a:	e8 d9 06 00 00       	call   804078 <mutex_lock>
+	if (mptr == 0)
+  80399f:	8b 3d 10 70 80 00    	mov    0x807010,%edi
+  8039a5:	83 c4 10             	add    $0x10,%esp
+  8039a8:	85 ff                	test   %edi,%edi
+  8039aa:	74 6c                	je     803a18 <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  8039ac:	8b 45 08             	mov    0x8(%ebp),%eax
+  8039af:	83 c0 03             	add    $0x3,%eax
+  8039b2:	83 e0 fc             	and    $0xfffffffc,%eax
+  8039b5:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  8039b7:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  8039bc:	0f 87 64 01 00 00    	ja     803b26 <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  8039c2:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8039c8:	74 30                	je     8039fa <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  8039ca:	89 f9                	mov    %edi,%ecx
+  8039cc:	c1 e9 0c             	shr    $0xc,%ecx
+  8039cf:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  8039d3:	c1 e8 0c             	shr    $0xc,%eax
+  8039d6:	39 c1                	cmp    %eax,%ecx
+  8039d8:	74 5f                	je     803a39 <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  8039da:	83 ec 0c             	sub    $0xc,%esp
+  8039dd:	57                   	push   %edi
+  8039de:	e8 e0 fe ff ff       	call   8038c3 <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  8039e3:	a1 10 70 80 00       	mov    0x807010,%eax
+  8039e8:	05 00 10 00 00       	add    $0x1000,%eax
+  8039ed:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8039f2:	a3 10 70 80 00       	mov    %eax,0x807010
+  8039f7:	83 c4 10             	add    $0x10,%esp
+  8039fa:	8b 0d 10 70 80 00    	mov    0x807010,%ecx
+{
+  803a00:	ba 02 00 00 00       	mov    $0x2,%edx
+  803a05:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  803a09:	8d 7e 04             	lea    0x4(%esi),%edi
+  803a0c:	89 cb                	mov    %ecx,%ebx
+  803a0e:	01 f9                	add    %edi,%ecx
+  803a10:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  803a13:	e9 8b 00 00 00       	jmp    803aa3 <malloc+0x117>
+		mptr = mbegin;
+  803a18:	c7 05 10 70 80 00 00 	movl   $0x8000000,0x807010
+  803a1f:	00 00 08 
+	n = ROUNDUP(n, 4);
+  803a22:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a25:	83 c0 03             	add    $0x3,%eax
+  803a28:	83 e0 fc             	and    $0xfffffffc,%eax
+  803a2b:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  803a2d:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  803a32:	76 c6                	jbe    8039fa <malloc+0x6e>
+  803a34:	e9 d6 00 00 00       	jmp    803b0f <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  803a39:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  803a3f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  803a44:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  803a48:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  803a4b:	a3 10 70 80 00       	mov    %eax,0x807010
+			return v;
+  803a50:	e9 ba 00 00 00       	jmp    803b0f <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  803a55:	05 00 10 00 00       	add    $0x1000,%eax
+  803a5a:	39 c8                	cmp    %ecx,%eax
+  803a5c:	0f 83 cb 00 00 00    	jae    803b2d <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  803a62:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  803a67:	77 22                	ja     803a8b <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  803a69:	89 c2                	mov    %eax,%edx
+  803a6b:	c1 ea 16             	shr    $0x16,%edx
+  803a6e:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  803a75:	f6 c2 01             	test   $0x1,%dl
+  803a78:	74 db                	je     803a55 <malloc+0xc9>
+  803a7a:	89 c2                	mov    %eax,%edx
+  803a7c:	c1 ea 0c             	shr    $0xc,%edx
+  803a7f:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  803a86:	f6 c2 01             	test   $0x1,%dl
+  803a89:	74 ca                	je     803a55 <malloc+0xc9>
+		if (mptr == mend) {
+  803a8b:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803a91:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  803a97:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  803a9b:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  803aa1:	74 04                	je     803aa7 <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  803aa3:	89 d8                	mov    %ebx,%eax
+  803aa5:	eb b3                	jmp    803a5a <malloc+0xce>
+  803aa7:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  803aaa:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  803aaf:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  803ab3:	83 ea 01             	sub    $0x1,%edx
+  803ab6:	0f 85 50 ff ff ff    	jne    803a0c <malloc+0x80>
+  803abc:	c7 05 10 70 80 00 00 	movl   $0x8000000,0x807010
+  803ac3:	00 00 08 
+				return 0;	/* out of address space */
+  803ac6:	bf 00 00 00 00       	mov    $0x0,%edi
+  803acb:	eb 42                	jmp    803b0f <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  803acd:	85 db                	test   %ebx,%ebx
+  803acf:	78 1e                	js     803aef <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  803ad1:	83 ec 08             	sub    $0x8,%esp
+  803ad4:	89 d8                	mov    %ebx,%eax
+  803ad6:	03 05 10 70 80 00    	add    0x807010,%eax
+  803adc:	50                   	push   %eax
+  803add:	6a 00                	push   $0x0
+  803adf:	e8 e9 d2 ff ff       	call   800dcd <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  803ae4:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  803aea:	83 c4 10             	add    $0x10,%esp
+  803aed:	eb de                	jmp    803acd <malloc+0x141>
+			return 0;	/* out of physical memory */
+  803aef:	bf 00 00 00 00       	mov    $0x0,%edi
+  803af4:	eb 19                	jmp    803b0f <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  803af6:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803af9:	8b 3d 10 70 80 00    	mov    0x807010,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  803aff:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  803b06:	00 
+	mptr += n;
+  803b07:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  803b0a:	a3 10 70 80 00       	mov    %eax,0x807010
+	mutex_unlock(&malloc_mu);
+  803b0f:	83 ec 0c             	sub    $0xc,%esp
+  803b12:	68 0c 70 80 00       	push   $0x80700c
+  803b17:	e8 c9 05 00 00       	call   8040e5 <mutex_unlock>
+}
+  803b1c:	89 f8                	mov    %edi,%eax
+  803b1e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803b21:	5b                   	pop    %ebx
+  803b22:	5e                   	pop    %esi
+  803b23:	5f                   	pop    %edi
+  803b24:	5d                   	pop    %ebp
+  803b25:	c3                   	ret
+		return 0;
+  803b26:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b2b:	eb e2                	jmp    803b0f <malloc+0x183>
+  803b2d:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  803b31:	74 06                	je     803b39 <malloc+0x1ad>
+  803b33:	89 1d 10 70 80 00    	mov    %ebx,0x807010
+	for (i = 0; i < n + 4; i += PGSIZE){
+  803b39:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803b3e:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803b41:	39 fb                	cmp    %edi,%ebx
+  803b43:	73 b1                	jae    803af6 <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  803b45:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  803b4b:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  803b4e:	39 fe                	cmp    %edi,%esi
+  803b50:	0f 92 c0             	setb   %al
+  803b53:	0f b6 c0             	movzbl %al,%eax
+  803b56:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  803b59:	83 c8 07             	or     $0x7,%eax
+  803b5c:	50                   	push   %eax
+  803b5d:	89 d8                	mov    %ebx,%eax
+  803b5f:	03 05 10 70 80 00    	add    0x807010,%eax
+  803b65:	50                   	push   %eax
+  803b66:	6a 00                	push   $0x0
+  803b68:	e8 c7 d1 ff ff       	call   800d34 <sys_page_alloc>
+  803b6d:	83 c4 10             	add    $0x10,%esp
+  803b70:	85 c0                	test   %eax,%eax
+  803b72:	0f 88 55 ff ff ff    	js     803acd <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  803b78:	89 f3                	mov    %esi,%ebx
+  803b7a:	eb c5                	jmp    803b41 <malloc+0x1b5>
+
+00803b7c <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  803b7c:	55                   	push   %ebp
+  803b7d:	89 e5                	mov    %esp,%ebp
+  803b7f:	56                   	push   %esi
+  803b80:	53                   	push   %ebx
+  803b81:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803b84:	83 ec 0c             	sub    $0xc,%esp
+  803b87:	ff 75 08             	push   0x8(%ebp)
+  803b8a:	e8 cd dc ff ff       	call   80185c <fd2data>
+  803b8f:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  803b91:	83 c4 08             	add    $0x8,%esp
+  803b94:	68 c7 56 80 00       	push   $0x8056c7
+  803b99:	53                   	push   %ebx
+  803b9a:	e8 57 cd ff ff       	call   8008f6 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  803b9f:	8b 46 04             	mov    0x4(%esi),%eax
+  803ba2:	2b 06                	sub    (%esi),%eax
+  803ba4:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  803baa:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803bb1:	00 00 00 
+	stat->st_dev = &devpipe;
+  803bb4:	c7 83 88 00 00 00 9c 	movl   $0x80629c,0x88(%ebx)
+  803bbb:	62 80 00 
+	return 0;
+}
+  803bbe:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bc3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803bc6:	5b                   	pop    %ebx
+  803bc7:	5e                   	pop    %esi
+  803bc8:	5d                   	pop    %ebp
+  803bc9:	c3                   	ret
+
+00803bca <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  803bca:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803bcf:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  803bd3:	85 c9                	test   %ecx,%ecx
+  803bd5:	75 01                	jne    803bd8 <pipewake+0xe>
+  803bd7:	c3                   	ret
+{
+  803bd8:	55                   	push   %ebp
+  803bd9:	89 e5                	mov    %esp,%ebp
+  803bdb:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  803bde:	68 00 04 00 00       	push   $0x400
+  803be3:	52                   	push   %edx
+  803be4:	e8 8f d4 ff ff       	call   801078 <sys_futex_wake>
+  803be9:	83 c4 10             	add    $0x10,%esp
+}
+  803bec:	c9                   	leave
+  803bed:	c3                   	ret
+
+00803bee <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803bee:	55                   	push   %ebp
+  803bef:	89 e5                	mov    %esp,%ebp
+  803bf1:	56                   	push   %esi
+  803bf2:	53                   	push   %ebx
+  803bf3:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803bf6:	83 ec 0c             	sub    $0xc,%esp
+  803bf9:	56                   	push   %esi
+  803bfa:	e8 5d dc ff ff       	call   80185c <fd2data>
+  803bff:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  803c01:	83 c4 08             	add    $0x8,%esp
+  803c04:	56                   	push   %esi
+  803c05:	6a 00                	push   $0x0
+  803c07:	e8 c1 d1 ff ff       	call   800dcd <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  803c0c:	8d 53 04             	lea    0x4(%ebx),%edx
+  803c0f:	8d 43 08             	lea    0x8(%ebx),%eax
+  803c12:	e8 b3 ff ff ff       	call   803bca <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  803c17:	8d 43 0c             	lea    0xc(%ebx),%eax
+  803c1a:	89 da                	mov    %ebx,%edx
+  803c1c:	e8 a9 ff ff ff       	call   803bca <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  803c21:	89 34 24             	mov    %esi,(%esp)
+  803c24:	e8 33 dc ff ff       	call   80185c <fd2data>
+  803c29:	83 c4 08             	add    $0x8,%esp
+  803c2c:	50                   	push   %eax
+  803c2d:	6a 00                	push   $0x0
+  803c2f:	e8 99 d1 ff ff       	call   800dcd <sys_page_unmap>
+}
+  803c34:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803c37:	5b                   	pop    %ebx
+  803c38:	5e                   	pop    %esi
+  803c39:	5d                   	pop    %ebp
+  803c3a:	c3                   	ret
+
+00803c3b <_pipeisclosed>:
+{
+  803c3b:	55                   	push   %ebp
+  803c3c:	89 e5                	mov    %esp,%ebp
+  803c3e:	57                   	push   %edi
+  803c3f:	56                   	push   %esi
+  803c40:	53                   	push   %ebx
+  803c41:	83 ec 1c             	sub    $0x1c,%esp
+  803c44:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803c47:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803c49:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  803c4e:	eb 5d                	jmp    803cad <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  803c50:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		n = thisenv->env_runs;
+  803c56:	8b 02                	mov    (%edx),%eax
+  803c58:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  803c5b:	83 ec 0c             	sub    $0xc,%esp
+  803c5e:	ff 75 e0             	push   -0x20(%ebp)
+  803c61:	e8 81 0f 00 00       	call   804be7 <pageref>
+  803c66:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803c69:	89 3c 24             	mov    %edi,(%esp)
+  803c6c:	e8 76 0f 00 00       	call   804be7 <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  803c71:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803c73:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  803c79:	83 c4 10             	add    $0x10,%esp
+  803c7c:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803c82:	77 15                	ja     803c99 <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803c84:	89 f2                	mov    %esi,%edx
+  803c86:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  803c88:	c1 ea 10             	shr    $0x10,%edx
+  803c8b:	74 0c                	je     803c99 <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803c8d:	c1 e2 10             	shl    $0x10,%edx
+  803c90:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  803c95:	29 d1                	sub    %edx,%ecx
+  803c97:	eb 06                	jmp    803c9f <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  803c99:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		nn = thisenv->env_runs;
+  803c9f:	8b 11                	mov    (%ecx),%edx
+  803ca1:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  803ca4:	39 d3                	cmp    %edx,%ebx
+  803ca6:	74 6e                	je     803d16 <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  803ca8:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803cab:	74 24                	je     803cd1 <_pipeisclosed+0x96>
+  803cad:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803caf:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803cb5:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803cba:	77 94                	ja     803c50 <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803cbc:	89 f0                	mov    %esi,%eax
+  803cbe:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803cc0:	c1 e8 10             	shr    $0x10,%eax
+  803cc3:	74 8b                	je     803c50 <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803cc5:	c1 e0 10             	shl    $0x10,%eax
+  803cc8:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803ccd:	29 c2                	sub    %eax,%edx
+  803ccf:	eb 85                	jmp    803c56 <_pipeisclosed+0x1b>
+  803cd1:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803cd3:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803cd9:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803cde:	77 18                	ja     803cf8 <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803ce0:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803ce5:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803ce7:	c1 e8 10             	shr    $0x10,%eax
+  803cea:	74 0c                	je     803cf8 <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803cec:	c1 e0 10             	shl    $0x10,%eax
+  803cef:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803cf4:	29 c2                	sub    %eax,%edx
+  803cf6:	eb 06                	jmp    803cfe <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  803cf8:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803cfe:	8b 02                	mov    (%edx),%eax
+  803d00:	8b 40 58             	mov    0x58(%eax),%eax
+  803d03:	6a 01                	push   $0x1
+  803d05:	50                   	push   %eax
+  803d06:	53                   	push   %ebx
+  803d07:	68 ce 56 80 00       	push   $0x8056ce
+  803d0c:	e8 01 c6 ff ff       	call   800312 <cprintf>
+  803d11:	83 c4 10             	add    $0x10,%esp
+  803d14:	eb 97                	jmp    803cad <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  803d16:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803d19:	0f 94 c0             	sete   %al
+  803d1c:	0f b6 c0             	movzbl %al,%eax
+}
+  803d1f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d22:	5b                   	pop    %ebx
+  803d23:	5e                   	pop    %esi
+  803d24:	5f                   	pop    %edi
+  803d25:	5d                   	pop    %ebp
+  803d26:	c3                   	ret
+
+00803d27 <devpipe_write>:
+{
+  803d27:	55                   	push   %ebp
+  803d28:	89 e5                	mov    %esp,%ebp
+  803d2a:	57                   	push   %edi
+  803d2b:	56                   	push   %esi
+  803d2c:	53                   	push   %ebx
+  803d2d:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  803d30:	ff 75 08             	push   0x8(%ebp)
+  803d33:	e8 24 db ff ff       	call   80185c <fd2data>
+  803d38:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803d3a:	83 c4 10             	add    $0x10,%esp
+  803d3d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  803d44:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  803d47:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803d4a:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803d4d:	0f 84 96 00 00 00    	je     803de9 <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  803d53:	8d 73 08             	lea    0x8(%ebx),%esi
+  803d56:	eb 32                	jmp    803d8a <devpipe_write+0x63>
+  803d58:	89 fa                	mov    %edi,%edx
+  803d5a:	89 f0                	mov    %esi,%eax
+  803d5c:	e8 69 fe ff ff       	call   803bca <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  803d61:	8b 43 04             	mov    0x4(%ebx),%eax
+  803d64:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  803d67:	ba 01 00 00 00       	mov    $0x1,%edx
+  803d6c:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  803d71:	83 ec 04             	sub    $0x4,%esp
+  803d74:	6a 0a                	push   $0xa
+  803d76:	50                   	push   %eax
+  803d77:	53                   	push   %ebx
+  803d78:	e8 cc d2 ff ff       	call   801049 <sys_futex_wait>
+  803d7d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803d82:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  803d87:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  803d8a:	8b 43 04             	mov    0x4(%ebx),%eax
+  803d8d:	8b 0b                	mov    (%ebx),%ecx
+  803d8f:	8d 51 20             	lea    0x20(%ecx),%edx
+  803d92:	39 d0                	cmp    %edx,%eax
+  803d94:	72 1b                	jb     803db1 <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  803d96:	89 da                	mov    %ebx,%edx
+  803d98:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d9b:	e8 9b fe ff ff       	call   803c3b <_pipeisclosed>
+  803da0:	85 c0                	test   %eax,%eax
+  803da2:	74 b4                	je     803d58 <devpipe_write+0x31>
+				return 0;
+  803da4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803da9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803dac:	5b                   	pop    %ebx
+  803dad:	5e                   	pop    %esi
+  803dae:	5f                   	pop    %edi
+  803daf:	5d                   	pop    %ebp
+  803db0:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803db1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803db4:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803db7:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  803dbb:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  803dbe:	89 c2                	mov    %eax,%edx
+  803dc0:	c1 fa 1f             	sar    $0x1f,%edx
+  803dc3:	89 d1                	mov    %edx,%ecx
+  803dc5:	c1 e9 1b             	shr    $0x1b,%ecx
+  803dc8:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  803dcb:	83 e2 1f             	and    $0x1f,%edx
+  803dce:	29 ca                	sub    %ecx,%edx
+  803dd0:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  803dd4:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  803dd8:	83 c0 01             	add    $0x1,%eax
+  803ddb:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  803dde:	83 c6 01             	add    $0x1,%esi
+  803de1:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803de4:	e9 5e ff ff ff       	jmp    803d47 <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  803de9:	8d 53 04             	lea    0x4(%ebx),%edx
+  803dec:	8d 43 08             	lea    0x8(%ebx),%eax
+  803def:	e8 d6 fd ff ff       	call   803bca <pipewake>
+	return i;
+  803df4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803df7:	eb b0                	jmp    803da9 <devpipe_write+0x82>
+
+00803df9 <devpipe_read>:
+{
+  803df9:	55                   	push   %ebp
+  803dfa:	89 e5                	mov    %esp,%ebp
+  803dfc:	57                   	push   %edi
+  803dfd:	56                   	push   %esi
+  803dfe:	53                   	push   %ebx
+  803dff:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  803e02:	ff 75 08             	push   0x8(%ebp)
+  803e05:	e8 52 da ff ff       	call   80185c <fd2data>
+  803e0a:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803e0c:	83 c4 10             	add    $0x10,%esp
+  803e0f:	be 00 00 00 00       	mov    $0x0,%esi
+  803e14:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803e17:	74 6c                	je     803e85 <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  803e19:	8d 7b 04             	lea    0x4(%ebx),%edi
+  803e1c:	eb 25                	jmp    803e43 <devpipe_read+0x4a>
+  803e1e:	8b 13                	mov    (%ebx),%edx
+  803e20:	b8 01 00 00 00       	mov    $0x1,%eax
+  803e25:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  803e2a:	83 ec 04             	sub    $0x4,%esp
+  803e2d:	6a 0a                	push   $0xa
+  803e2f:	52                   	push   %edx
+  803e30:	57                   	push   %edi
+  803e31:	e8 13 d2 ff ff       	call   801049 <sys_futex_wait>
+  803e36:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803e3b:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  803e40:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  803e43:	8b 03                	mov    (%ebx),%eax
+  803e45:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803e48:	75 19                	jne    803e63 <devpipe_read+0x6a>
+			if (i > 0)
+  803e4a:	85 f6                	test   %esi,%esi
+  803e4c:	75 3a                	jne    803e88 <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  803e4e:	89 da                	mov    %ebx,%edx
+  803e50:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e53:	e8 e3 fd ff ff       	call   803c3b <_pipeisclosed>
+  803e58:	85 c0                	test   %eax,%eax
+  803e5a:	74 c2                	je     803e1e <devpipe_read+0x25>
+				return 0;
+  803e5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e61:	eb 31                	jmp    803e94 <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803e63:	89 c1                	mov    %eax,%ecx
+  803e65:	c1 f9 1f             	sar    $0x1f,%ecx
+  803e68:	c1 e9 1b             	shr    $0x1b,%ecx
+  803e6b:	01 c8                	add    %ecx,%eax
+  803e6d:	83 e0 1f             	and    $0x1f,%eax
+  803e70:	29 c8                	sub    %ecx,%eax
+  803e72:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  803e77:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803e7a:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  803e7d:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  803e80:	83 c6 01             	add    $0x1,%esi
+  803e83:	eb 8f                	jmp    803e14 <devpipe_read+0x1b>
+out:
+  803e85:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  803e88:	8d 43 0c             	lea    0xc(%ebx),%eax
+  803e8b:	89 da                	mov    %ebx,%edx
+  803e8d:	e8 38 fd ff ff       	call   803bca <pipewake>
+	return i;
+  803e92:	89 f0                	mov    %esi,%eax
+}
+  803e94:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e97:	5b                   	pop    %ebx
+  803e98:	5e                   	pop    %esi
+  803e99:	5f                   	pop    %edi
+  803e9a:	5d                   	pop    %ebp
+  803e9b:	c3                   	ret
+
+00803e9c <pipe>:
+{
+  803e9c:	55                   	push   %ebp
+  803e9d:	89 e5                	mov    %esp,%ebp
+  803e9f:	56                   	push   %esi
+  803ea0:	53                   	push   %ebx
+  803ea1:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803ea4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803ea7:	50                   	push   %eax
+  803ea8:	e8 c6 d9 ff ff       	call   801873 <fd_alloc>
+  803ead:	89 c3                	mov    %eax,%ebx
+  803eaf:	83 c4 10             	add    $0x10,%esp
+  803eb2:	85 c0                	test   %eax,%eax
+  803eb4:	0f 88 23 01 00 00    	js     803fdd <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803eba:	83 ec 04             	sub    $0x4,%esp
+  803ebd:	68 07 04 00 00       	push   $0x407
+  803ec2:	ff 75 f4             	push   -0xc(%ebp)
+  803ec5:	6a 00                	push   $0x0
+  803ec7:	e8 68 ce ff ff       	call   800d34 <sys_page_alloc>
+  803ecc:	89 c3                	mov    %eax,%ebx
+  803ece:	83 c4 10             	add    $0x10,%esp
+  803ed1:	85 c0                	test   %eax,%eax
+  803ed3:	0f 88 04 01 00 00    	js     803fdd <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803ed9:	83 ec 0c             	sub    $0xc,%esp
+  803edc:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803edf:	50                   	push   %eax
+  803ee0:	e8 8e d9 ff ff       	call   801873 <fd_alloc>
+  803ee5:	89 c3                	mov    %eax,%ebx
+  803ee7:	83 c4 10             	add    $0x10,%esp
+  803eea:	85 c0                	test   %eax,%eax
+  803eec:	0f 88 db 00 00 00    	js     803fcd <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803ef2:	83 ec 04             	sub    $0x4,%esp
+  803ef5:	68 07 04 00 00       	push   $0x407
+  803efa:	ff 75 f0             	push   -0x10(%ebp)
+  803efd:	6a 00                	push   $0x0
+  803eff:	e8 30 ce ff ff       	call   800d34 <sys_page_alloc>
+  803f04:	89 c3                	mov    %eax,%ebx
+  803f06:	83 c4 10             	add    $0x10,%esp
+  803f09:	85 c0                	test   %eax,%eax
+  803f0b:	0f 88 bc 00 00 00    	js     803fcd <pipe+0x131>
+	va = fd2data(fd0);
+  803f11:	83 ec 0c             	sub    $0xc,%esp
+  803f14:	ff 75 f4             	push   -0xc(%ebp)
+  803f17:	e8 40 d9 ff ff       	call   80185c <fd2data>
+  803f1c:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803f1e:	83 c4 0c             	add    $0xc,%esp
+  803f21:	68 07 04 00 00       	push   $0x407
+  803f26:	50                   	push   %eax
+  803f27:	6a 00                	push   $0x0
+  803f29:	e8 06 ce ff ff       	call   800d34 <sys_page_alloc>
+  803f2e:	89 c3                	mov    %eax,%ebx
+  803f30:	83 c4 10             	add    $0x10,%esp
+  803f33:	85 c0                	test   %eax,%eax
+  803f35:	0f 88 82 00 00 00    	js     803fbd <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803f3b:	83 ec 0c             	sub    $0xc,%esp
+  803f3e:	ff 75 f0             	push   -0x10(%ebp)
+  803f41:	e8 16 d9 ff ff       	call   80185c <fd2data>
+  803f46:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803f4d:	50                   	push   %eax
+  803f4e:	6a 00                	push   $0x0
+  803f50:	56                   	push   %esi
+  803f51:	6a 00                	push   $0x0
+  803f53:	e8 29 ce ff ff       	call   800d81 <sys_page_map>
+  803f58:	89 c3                	mov    %eax,%ebx
+  803f5a:	83 c4 20             	add    $0x20,%esp
+  803f5d:	85 c0                	test   %eax,%eax
+  803f5f:	78 4e                	js     803faf <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803f61:	a1 9c 62 80 00       	mov    0x80629c,%eax
+  803f66:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803f69:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803f6b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803f6e:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803f75:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803f78:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803f7a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803f7d:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803f84:	83 ec 0c             	sub    $0xc,%esp
+  803f87:	ff 75 f4             	push   -0xc(%ebp)
+  803f8a:	e8 bd d8 ff ff       	call   80184c <fd2num>
+  803f8f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803f92:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803f94:	83 c4 04             	add    $0x4,%esp
+  803f97:	ff 75 f0             	push   -0x10(%ebp)
+  803f9a:	e8 ad d8 ff ff       	call   80184c <fd2num>
+  803f9f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803fa2:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803fa5:	83 c4 10             	add    $0x10,%esp
+  803fa8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803fad:	eb 2e                	jmp    803fdd <pipe+0x141>
+	sys_page_unmap(0, va);
+  803faf:	83 ec 08             	sub    $0x8,%esp
+  803fb2:	56                   	push   %esi
+  803fb3:	6a 00                	push   $0x0
+  803fb5:	e8 13 ce ff ff       	call   800dcd <sys_page_unmap>
+  803fba:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803fbd:	83 ec 08             	sub    $0x8,%esp
+  803fc0:	ff 75 f0             	push   -0x10(%ebp)
+  803fc3:	6a 00                	push   $0x0
+  803fc5:	e8 03 ce ff ff       	call   800dcd <sys_page_unmap>
+  803fca:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803fcd:	83 ec 08             	sub    $0x8,%esp
+  803fd0:	ff 75 f4             	push   -0xc(%ebp)
+  803fd3:	6a 00                	push   $0x0
+  803fd5:	e8 f3 cd ff ff       	call   800dcd <sys_page_unmap>
+  803fda:	83 c4 10             	add    $0x10,%esp
+}
+  803fdd:	89 d8                	mov    %ebx,%eax
+  803fdf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803fe2:	5b                   	pop    %ebx
+  803fe3:	5e                   	pop    %esi
+  803fe4:	5d                   	pop    %ebp
+  803fe5:	c3                   	ret
+
+00803fe6 <pipeisclosed>:
+{
+  803fe6:	55                   	push   %ebp
+  803fe7:	89 e5                	mov    %esp,%ebp
+  803fe9:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803fec:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803fef:	50                   	push   %eax
+  803ff0:	ff 75 08             	push   0x8(%ebp)
+  803ff3:	e8 d1 d8 ff ff       	call   8018c9 <fd_lookup>
+  803ff8:	83 c4 10             	add    $0x10,%esp
+  803ffb:	85 c0                	test   %eax,%eax
+  803ffd:	78 18                	js     804017 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803fff:	83 ec 0c             	sub    $0xc,%esp
+  804002:	ff 75 f4             	push   -0xc(%ebp)
+  804005:	e8 52 d8 ff ff       	call   80185c <fd2data>
+  80400a:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80400c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80400f:	e8 27 fc ff ff       	call   803c3b <_pipeisclosed>
+  804014:	83 c4 10             	add    $0x10,%esp
+}
+  804017:	c9                   	leave
+  804018:	c3                   	ret
+
+00804019 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  804019:	55                   	push   %ebp
+  80401a:	89 e5                	mov    %esp,%ebp
+  80401c:	56                   	push   %esi
+  80401d:	53                   	push   %ebx
+  80401e:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  804021:	85 f6                	test   %esi,%esi
+  804023:	74 15                	je     80403a <wait+0x21>
+	e = &envs[ENVX(envid)];
+  804025:	89 f0                	mov    %esi,%eax
+  804027:	25 ff 03 00 00       	and    $0x3ff,%eax
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  80402c:	8d 1c c0             	lea    (%eax,%eax,8),%ebx
+  80402f:	c1 e3 04             	shl    $0x4,%ebx
+  804032:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  804038:	eb 1b                	jmp    804055 <wait+0x3c>
+	assert(envid != 0);
+  80403a:	68 e6 56 80 00       	push   $0x8056e6
+  80403f:	68 91 54 80 00       	push   $0x805491
+  804044:	6a 09                	push   $0x9
+  804046:	68 f1 56 80 00       	push   $0x8056f1
+  80404b:	e8 e7 c1 ff ff       	call   800237 <_panic>
+		sys_yield();
+  804050:	e8 b3 cc ff ff       	call   800d08 <sys_yield>
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  804055:	8b 43 48             	mov    0x48(%ebx),%eax
+  804058:	39 f0                	cmp    %esi,%eax
+  80405a:	75 07                	jne    804063 <wait+0x4a>
+  80405c:	8b 43 54             	mov    0x54(%ebx),%eax
+  80405f:	85 c0                	test   %eax,%eax
+  804061:	75 ed                	jne    804050 <wait+0x37>
+}
+  804063:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804066:	5b                   	pop    %ebx
+  804067:	5e                   	pop    %esi
+  804068:	5d                   	pop    %ebp
+  804069:	c3                   	ret
+
+0080406a <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  80406a:	55                   	push   %ebp
+  80406b:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  80406d:	8b 45 08             	mov    0x8(%ebp),%eax
+  804070:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  804076:	5d                   	pop    %ebp
+  804077:	c3                   	ret
+
+00804078 <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  804078:	55                   	push   %ebp
+  804079:	89 e5                	mov    %esp,%ebp
+  80407b:	56                   	push   %esi
+  80407c:	53                   	push   %ebx
+  80407d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  804080:	ba 00 00 00 00       	mov    $0x0,%edx
+  804085:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80408a:	89 d0                	mov    %edx,%eax
+  80408c:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  804090:	85 c0                	test   %eax,%eax
+  804092:	74 2d                	je     8040c1 <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  804094:	83 f8 02             	cmp    $0x2,%eax
+  804097:	74 08                	je     8040a1 <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  804099:	b8 02 00 00 00       	mov    $0x2,%eax
+  80409e:	f0 87 03             	lock xchg %eax,(%ebx)
+  8040a1:	be 02 00 00 00       	mov    $0x2,%esi
+  8040a6:	eb 15                	jmp    8040bd <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  8040a8:	83 ec 04             	sub    $0x4,%esp
+  8040ab:	6a 00                	push   $0x0
+  8040ad:	6a 02                	push   $0x2
+  8040af:	53                   	push   %ebx
+  8040b0:	e8 94 cf ff ff       	call   801049 <sys_futex_wait>
+  8040b5:	89 f0                	mov    %esi,%eax
+  8040b7:	f0 87 03             	lock xchg %eax,(%ebx)
+  8040ba:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  8040bd:	85 c0                	test   %eax,%eax
+  8040bf:	75 e7                	jne    8040a8 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  8040c1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8040c4:	5b                   	pop    %ebx
+  8040c5:	5e                   	pop    %esi
+  8040c6:	5d                   	pop    %ebp
+  8040c7:	c3                   	ret
+
+008040c8 <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  8040c8:	55                   	push   %ebp
+  8040c9:	89 e5                	mov    %esp,%ebp
+  8040cb:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  8040ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040d3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8040d8:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  8040dc:	f7 d8                	neg    %eax
+  8040de:	19 c0                	sbb    %eax,%eax
+  8040e0:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  8040e3:	5d                   	pop    %ebp
+  8040e4:	c3                   	ret
+
+008040e5 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  8040e5:	55                   	push   %ebp
+  8040e6:	89 e5                	mov    %esp,%ebp
+  8040e8:	83 ec 08             	sub    $0x8,%esp
+  8040eb:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  8040ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040f3:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  8040f6:	83 f8 02             	cmp    $0x2,%eax
+  8040f9:	74 02                	je     8040fd <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  8040fb:	c9                   	leave
+  8040fc:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  8040fd:	83 ec 08             	sub    $0x8,%esp
+  804100:	6a 01                	push   $0x1
+  804102:	52                   	push   %edx
+  804103:	e8 70 cf ff ff       	call   801078 <sys_futex_wake>
+  804108:	83 c4 10             	add    $0x10,%esp
+}
+  80410b:	eb ee                	jmp    8040fb <mutex_unlock+0x16>
+
+0080410d <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  80410d:	55                   	push   %ebp
+  80410e:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  804110:	8b 45 08             	mov    0x8(%ebp),%eax
+  804113:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  804119:	5d                   	pop    %ebp
+  80411a:	c3                   	ret
+
+0080411b <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  80411b:	55                   	push   %ebp
+  80411c:	89 e5                	mov    %esp,%ebp
+  80411e:	57                   	push   %edi
+  80411f:	56                   	push   %esi
+  804120:	53                   	push   %ebx
+  804121:	83 ec 18             	sub    $0x18,%esp
+  804124:	8b 75 08             	mov    0x8(%ebp),%esi
+  804127:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  80412a:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  80412c:	53                   	push   %ebx
+  80412d:	e8 b3 ff ff ff       	call   8040e5 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  804132:	83 c4 0c             	add    $0xc,%esp
+  804135:	ff 75 10             	push   0x10(%ebp)
+  804138:	57                   	push   %edi
+  804139:	56                   	push   %esi
+  80413a:	e8 0a cf ff ff       	call   801049 <sys_futex_wait>
+  80413f:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  804141:	83 c4 10             	add    $0x10,%esp
+  804144:	be 02 00 00 00       	mov    $0x2,%esi
+  804149:	eb 10                	jmp    80415b <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  80414b:	83 ec 04             	sub    $0x4,%esp
+  80414e:	6a 00                	push   $0x0
+  804150:	6a 02                	push   $0x2
+  804152:	53                   	push   %ebx
+  804153:	e8 f1 ce ff ff       	call   801049 <sys_futex_wait>
+  804158:	83 c4 10             	add    $0x10,%esp
+  80415b:	89 f0                	mov    %esi,%eax
+  80415d:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  804160:	85 c0                	test   %eax,%eax
+  804162:	75 e7                	jne    80414b <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  804164:	83 ff ec             	cmp    $0xffffffec,%edi
+  804167:	74 05                	je     80416e <cond_timedwait+0x53>
+  804169:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  80416e:	89 f8                	mov    %edi,%eax
+  804170:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804173:	5b                   	pop    %ebx
+  804174:	5e                   	pop    %esi
+  804175:	5f                   	pop    %edi
+  804176:	5d                   	pop    %ebp
+  804177:	c3                   	ret
+
+00804178 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  804178:	55                   	push   %ebp
+  804179:	89 e5                	mov    %esp,%ebp
+  80417b:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  80417e:	6a 00                	push   $0x0
+  804180:	ff 75 0c             	push   0xc(%ebp)
+  804183:	ff 75 08             	push   0x8(%ebp)
+  804186:	e8 90 ff ff ff       	call   80411b <cond_timedwait>
+}
+  80418b:	83 c4 10             	add    $0x10,%esp
+  80418e:	c9                   	leave
+  80418f:	c3                   	ret
+
+00804190 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  804190:	55                   	push   %ebp
+  804191:	89 e5                	mov    %esp,%ebp
+  804193:	83 ec 10             	sub    $0x10,%esp
+  804196:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  804199:	ba 01 00 00 00       	mov    $0x1,%edx
+  80419e:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  8041a2:	6a 01                	push   $0x1
+  8041a4:	50                   	push   %eax
+  8041a5:	e8 ce ce ff ff       	call   801078 <sys_futex_wake>
+}
+  8041aa:	83 c4 10             	add    $0x10,%esp
+  8041ad:	c9                   	leave
+  8041ae:	c3                   	ret
+
+008041af <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  8041af:	55                   	push   %ebp
+  8041b0:	89 e5                	mov    %esp,%ebp
+  8041b2:	83 ec 10             	sub    $0x10,%esp
+  8041b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8041b8:	ba 01 00 00 00       	mov    $0x1,%edx
+  8041bd:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  8041c1:	68 00 04 00 00       	push   $0x400
+  8041c6:	50                   	push   %eax
+  8041c7:	e8 ac ce ff ff       	call   801078 <sys_futex_wake>
+}
+  8041cc:	83 c4 10             	add    $0x10,%esp
+  8041cf:	c9                   	leave
+  8041d0:	c3                   	ret
+
+008041d1 <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  8041d1:	55                   	push   %ebp
+  8041d2:	89 e5                	mov    %esp,%ebp
+  8041d4:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  8041d7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8041da:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  8041dc:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  8041e3:	5d                   	pop    %ebp
+  8041e4:	c3                   	ret
+
+008041e5 <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  8041e5:	55                   	push   %ebp
+  8041e6:	89 e5                	mov    %esp,%ebp
+  8041e8:	53                   	push   %ebx
+  8041e9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  8041ec:	8b 11                	mov    (%ecx),%edx
+  8041ee:	85 d2                	test   %edx,%edx
+  8041f0:	74 14                	je     804206 <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  8041f2:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  8041f5:	89 d0                	mov    %edx,%eax
+  8041f7:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  8041fb:	39 c2                	cmp    %eax,%edx
+  8041fd:	75 ed                	jne    8041ec <sem_trywait+0x7>
+			return 0;
+  8041ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  804204:	eb 05                	jmp    80420b <sem_trywait+0x26>
+	return -E_AGAIN;
+  804206:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  80420b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80420e:	c9                   	leave
+  80420f:	c3                   	ret
+
+00804210 <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  804210:	55                   	push   %ebp
+  804211:	89 e5                	mov    %esp,%ebp
+  804213:	57                   	push   %edi
+  804214:	56                   	push   %esi
+  804215:	53                   	push   %ebx
+  804216:	83 ec 1c             	sub    $0x1c,%esp
+  804219:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80421c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  80421f:	e8 9d cd ff ff       	call   800fc1 <sys_time_msec>
+  804224:	01 f8                	add    %edi,%eax
+  804226:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  804229:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  80422e:	eb 28                	jmp    804258 <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  804230:	b8 01 00 00 00       	mov    $0x1,%eax
+  804235:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  80423a:	83 ec 04             	sub    $0x4,%esp
+  80423d:	56                   	push   %esi
+  80423e:	6a 00                	push   $0x0
+  804240:	53                   	push   %ebx
+  804241:	e8 03 ce ff ff       	call   801049 <sys_futex_wait>
+  804246:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  80424b:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  804250:	83 c4 10             	add    $0x10,%esp
+  804253:	83 f8 ec             	cmp    $0xffffffec,%eax
+  804256:	74 2e                	je     804286 <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  804258:	83 ec 0c             	sub    $0xc,%esp
+  80425b:	53                   	push   %ebx
+  80425c:	e8 84 ff ff ff       	call   8041e5 <sem_trywait>
+  804261:	83 c4 10             	add    $0x10,%esp
+  804264:	85 c0                	test   %eax,%eax
+  804266:	79 19                	jns    804281 <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  804268:	85 ff                	test   %edi,%edi
+  80426a:	74 c4                	je     804230 <sem_timedwait+0x20>
+  80426c:	e8 50 cd ff ff       	call   800fc1 <sys_time_msec>
+  804271:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  804274:	29 c6                	sub    %eax,%esi
+  804276:	85 f6                	test   %esi,%esi
+  804278:	7f b6                	jg     804230 <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  80427a:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  80427f:	eb 05                	jmp    804286 <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  804281:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804286:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804289:	5b                   	pop    %ebx
+  80428a:	5e                   	pop    %esi
+  80428b:	5f                   	pop    %edi
+  80428c:	5d                   	pop    %ebp
+  80428d:	c3                   	ret
+
+0080428e <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  80428e:	55                   	push   %ebp
+  80428f:	89 e5                	mov    %esp,%ebp
+  804291:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  804294:	6a 00                	push   $0x0
+  804296:	ff 75 08             	push   0x8(%ebp)
+  804299:	e8 72 ff ff ff       	call   804210 <sem_timedwait>
+}
+  80429e:	83 c4 10             	add    $0x10,%esp
+  8042a1:	c9                   	leave
+  8042a2:	c3                   	ret
+
+008042a3 <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  8042a3:	55                   	push   %ebp
+  8042a4:	89 e5                	mov    %esp,%ebp
+  8042a6:	83 ec 08             	sub    $0x8,%esp
+  8042a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8042ac:	ba 01 00 00 00       	mov    $0x1,%edx
+  8042b1:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  8042b5:	8b 50 04             	mov    0x4(%eax),%edx
+  8042b8:	85 d2                	test   %edx,%edx
+  8042ba:	75 02                	jne    8042be <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  8042bc:	c9                   	leave
+  8042bd:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  8042be:	83 ec 08             	sub    $0x8,%esp
+  8042c1:	6a 01                	push   $0x1
+  8042c3:	50                   	push   %eax
+  8042c4:	e8 af cd ff ff       	call   801078 <sys_futex_wake>
+  8042c9:	83 c4 10             	add    $0x10,%esp
+}
+  8042cc:	eb ee                	jmp    8042bc <sem_post+0x19>
+
+008042ce <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  8042ce:	55                   	push   %ebp
+  8042cf:	89 e5                	mov    %esp,%ebp
+  8042d1:	57                   	push   %edi
+  8042d2:	56                   	push   %esi
+  8042d3:	53                   	push   %ebx
+  8042d4:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  8042d7:	68 20 70 80 00       	push   $0x807020
+  8042dc:	e8 97 fd ff ff       	call   804078 <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  8042e1:	a1 44 70 80 00       	mov    0x807044,%eax
+  8042e6:	83 c4 10             	add    $0x10,%esp
+  8042e9:	85 c0                	test   %eax,%eax
+  8042eb:	75 19                	jne    804306 <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  8042ed:	a1 c0 72 80 00       	mov    0x8072c0,%eax
+  8042f2:	8b 00                	mov    (%eax),%eax
+  8042f4:	8b 40 48             	mov    0x48(%eax),%eax
+  8042f7:	a3 40 70 80 00       	mov    %eax,0x807040
+		threads[0].th_state = PTH_RUNNING;
+  8042fc:	c7 05 44 70 80 00 01 	movl   $0x1,0x807044
+  804303:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  804306:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  80430b:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80430e:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  804315:	8b 40 04             	mov    0x4(%eax),%eax
+  804318:	85 c0                	test   %eax,%eax
+  80431a:	0f 84 e4 00 00 00    	je     804404 <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  804320:	83 c3 01             	add    $0x1,%ebx
+  804323:	83 fb 20             	cmp    $0x20,%ebx
+  804326:	75 e3                	jne    80430b <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  804328:	83 ec 0c             	sub    $0xc,%esp
+  80432b:	68 20 70 80 00       	push   $0x807020
+  804330:	e8 b0 fd ff ff       	call   8040e5 <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  804335:	83 c4 10             	add    $0x10,%esp
+  804338:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  80433d:	e9 b8 00 00 00       	jmp    8043fa <pthread_create+0x12c>
+  804342:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  804345:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  804348:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  80434a:	39 f3                	cmp    %esi,%ebx
+  80434c:	73 16                	jae    804364 <pthread_create+0x96>
+		va -= PGSIZE;
+  80434e:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  804354:	83 ec 08             	sub    $0x8,%esp
+  804357:	56                   	push   %esi
+  804358:	6a 00                	push   $0x0
+  80435a:	e8 6e ca ff ff       	call   800dcd <sys_page_unmap>
+  80435f:	83 c4 10             	add    $0x10,%esp
+  804362:	eb e6                	jmp    80434a <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  804364:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  804367:	83 ec 08             	sub    $0x8,%esp
+  80436a:	ff 75 e4             	push   -0x1c(%ebp)
+  80436d:	6a 00                	push   $0x0
+  80436f:	e8 59 ca ff ff       	call   800dcd <sys_page_unmap>
+	return r;
+  804374:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  804377:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80437a:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  804381:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  804388:	eb 70                	jmp    8043fa <pthread_create+0x12c>
+	th->th_fn = fn;
+  80438a:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80438d:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  804394:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804397:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  80439a:	8b 55 10             	mov    0x10(%ebp),%edx
+  80439d:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  8043a0:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  8043a7:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  8043ac:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8043af:	29 c8                	sub    %ecx,%eax
+  8043b1:	85 db                	test   %ebx,%ebx
+  8043b3:	0f 44 05 c0 72 80 00 	cmove  0x8072c0,%eax
+	*--esp = t;
+  8043ba:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  8043bd:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  8043c4:	83 ec 04             	sub    $0x4,%esp
+  8043c7:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  8043cc:	29 ca                	sub    %ecx,%edx
+  8043ce:	52                   	push   %edx
+	*--esp = 0;
+  8043cf:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  8043d2:	50                   	push   %eax
+  8043d3:	68 2b 46 80 00       	push   $0x80462b
+  8043d8:	e8 40 cd ff ff       	call   80111d <sys_thread_create>
+  8043dd:	89 c7                	mov    %eax,%edi
+  8043df:	83 c4 10             	add    $0x10,%esp
+  8043e2:	85 c0                	test   %eax,%eax
+  8043e4:	78 91                	js     804377 <pthread_create+0xa9>
+	th->th_env = id;
+  8043e6:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8043e9:	89 3c 85 40 70 80 00 	mov    %edi,0x807040(,%eax,4)
+	*tp = t;
+  8043f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8043f3:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  8043f5:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  8043fa:	89 f8                	mov    %edi,%eax
+  8043fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8043ff:	5b                   	pop    %ebx
+  804400:	5e                   	pop    %esi
+  804401:	5f                   	pop    %edi
+  804402:	5d                   	pop    %ebp
+  804403:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  804404:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  804407:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  80440e:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  804415:	83 ec 0c             	sub    $0xc,%esp
+  804418:	68 20 70 80 00       	push   $0x807020
+  80441d:	e8 c3 fc ff ff       	call   8040e5 <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  804422:	89 d9                	mov    %ebx,%ecx
+  804424:	c1 e1 10             	shl    $0x10,%ecx
+  804427:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  80442a:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  80442f:	29 c8                	sub    %ecx,%eax
+  804431:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  804434:	c1 e8 16             	shr    $0x16,%eax
+  804437:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80443e:	83 c4 10             	add    $0x10,%esp
+  804441:	a8 01                	test   $0x1,%al
+  804443:	74 15                	je     80445a <pthread_create+0x18c>
+  804445:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804448:	c1 e8 0c             	shr    $0xc,%eax
+  80444b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  804452:	a8 01                	test   $0x1,%al
+  804454:	0f 85 30 ff ff ff    	jne    80438a <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  80445a:	83 ec 04             	sub    $0x4,%esp
+  80445d:	6a 07                	push   $0x7
+  80445f:	ff 75 e4             	push   -0x1c(%ebp)
+  804462:	6a 00                	push   $0x0
+  804464:	e8 cb c8 ff ff       	call   800d34 <sys_page_alloc>
+  804469:	89 c7                	mov    %eax,%edi
+  80446b:	83 c4 10             	add    $0x10,%esp
+  80446e:	85 c0                	test   %eax,%eax
+  804470:	0f 88 01 ff ff ff    	js     804377 <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  804476:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  80447b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80447e:	29 d0                	sub    %edx,%eax
+  804480:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  804483:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  804485:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  80448a:	29 d0                	sub    %edx,%eax
+  80448c:	89 c7                	mov    %eax,%edi
+  80448e:	39 fe                	cmp    %edi,%esi
+  804490:	0f 83 f4 fe ff ff    	jae    80438a <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  804496:	83 ec 04             	sub    $0x4,%esp
+  804499:	6a 07                	push   $0x7
+  80449b:	56                   	push   %esi
+  80449c:	6a 00                	push   $0x0
+  80449e:	e8 91 c8 ff ff       	call   800d34 <sys_page_alloc>
+  8044a3:	83 c4 10             	add    $0x10,%esp
+  8044a6:	85 c0                	test   %eax,%eax
+  8044a8:	0f 88 94 fe ff ff    	js     804342 <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  8044ae:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8044b4:	eb d8                	jmp    80448e <pthread_create+0x1c0>
+
+008044b6 <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  8044b6:	55                   	push   %ebp
+  8044b7:	89 e5                	mov    %esp,%ebp
+  8044b9:	57                   	push   %edi
+  8044ba:	56                   	push   %esi
+  8044bb:	53                   	push   %ebx
+  8044bc:	83 ec 0c             	sub    $0xc,%esp
+  8044bf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  8044c2:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  8044c5:	83 f8 1e             	cmp    $0x1e,%eax
+  8044c8:	0f 87 c7 00 00 00    	ja     804595 <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  8044ce:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8044d0:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8044d6:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8044db:	77 12                	ja     8044ef <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8044dd:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8044e2:	29 d0                	sub    %edx,%eax
+  8044e4:	c1 e8 10             	shr    $0x10,%eax
+  8044e7:	39 c3                	cmp    %eax,%ebx
+  8044e9:	0f 84 ad 00 00 00    	je     80459c <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  8044ef:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8044f2:	8d 3c 85 44 70 80 00 	lea    0x807044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  8044f9:	8d 34 85 40 70 80 00 	lea    0x807040(,%eax,4),%esi
+  804500:	eb 10                	jmp    804512 <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  804502:	83 ec 04             	sub    $0x4,%esp
+  804505:	6a 00                	push   $0x0
+  804507:	6a 01                	push   $0x1
+  804509:	57                   	push   %edi
+  80450a:	e8 3a cb ff ff       	call   801049 <sys_futex_wait>
+  80450f:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  804512:	8b 46 04             	mov    0x4(%esi),%eax
+  804515:	83 f8 01             	cmp    $0x1,%eax
+  804518:	74 e8                	je     804502 <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  80451a:	83 f8 02             	cmp    $0x2,%eax
+  80451d:	0f 85 80 00 00 00    	jne    8045a3 <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  804523:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  804526:	c1 e6 02             	shl    $0x2,%esi
+  804529:	eb 05                	jmp    804530 <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  80452b:	e8 d8 c7 ff ff       	call   800d08 <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  804530:	8b 8e 40 70 80 00    	mov    0x807040(%esi),%ecx
+  804536:	89 ca                	mov    %ecx,%edx
+  804538:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  80453e:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804541:	c1 e0 04             	shl    $0x4,%eax
+  804544:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804549:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  80454c:	39 c1                	cmp    %eax,%ecx
+  80454e:	75 12                	jne    804562 <pthread_join+0xac>
+  804550:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804553:	c1 e0 04             	shl    $0x4,%eax
+  804556:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80455b:	8b 40 54             	mov    0x54(%eax),%eax
+  80455e:	85 c0                	test   %eax,%eax
+  804560:	75 c9                	jne    80452b <pthread_join+0x75>
+	if (ret_store)
+  804562:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  804566:	74 0f                	je     804577 <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  804568:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80456b:	8b 04 85 50 70 80 00 	mov    0x807050(,%eax,4),%eax
+  804572:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  804575:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  804577:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80457a:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  804581:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  804588:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80458d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804590:	5b                   	pop    %ebx
+  804591:	5e                   	pop    %esi
+  804592:	5f                   	pop    %edi
+  804593:	5d                   	pop    %ebp
+  804594:	c3                   	ret
+		return -E_INVAL;
+  804595:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80459a:	eb f1                	jmp    80458d <pthread_join+0xd7>
+  80459c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8045a1:	eb ea                	jmp    80458d <pthread_join+0xd7>
+		return -E_INVAL;
+  8045a3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8045a8:	eb e3                	jmp    80458d <pthread_join+0xd7>
+
+008045aa <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  8045aa:	55                   	push   %ebp
+  8045ab:	89 e5                	mov    %esp,%ebp
+  8045ad:	53                   	push   %ebx
+  8045ae:	83 ec 04             	sub    $0x4,%esp
+  8045b1:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8045b3:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8045b9:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8045be:	77 0c                	ja     8045cc <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8045c0:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8045c5:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  8045c7:	c1 e8 10             	shr    $0x10,%eax
+  8045ca:	75 0a                	jne    8045d6 <pthread_exit+0x2c>
+		exit();
+  8045cc:	e8 3e bc ff ff       	call   80020f <exit>
+  8045d1:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  8045d6:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  8045dd:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  8045e0:	8d 0c 8d 40 70 80 00 	lea    0x807040(,%ecx,4),%ecx
+  8045e7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8045ea:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  8045ed:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  8045f4:	83 ec 08             	sub    $0x8,%esp
+  8045f7:	6a 20                	push   $0x20
+  8045f9:	01 c2                	add    %eax,%edx
+  8045fb:	8d 04 95 44 70 80 00 	lea    0x807044(,%edx,4),%eax
+  804602:	50                   	push   %eax
+  804603:	e8 70 ca ff ff       	call   801078 <sys_futex_wake>
+	sys_env_destroy(0);
+  804608:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80460f:	e8 7d c6 ff ff       	call   800c91 <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  804614:	83 c4 0c             	add    $0xc,%esp
+  804617:	68 fc 56 80 00       	push   $0x8056fc
+  80461c:	68 a5 00 00 00       	push   $0xa5
+  804621:	68 16 57 80 00       	push   $0x805716
+  804626:	e8 0c bc ff ff       	call   800237 <_panic>
+
+0080462b <pthread_start>:
+{
+  80462b:	55                   	push   %ebp
+  80462c:	89 e5                	mov    %esp,%ebp
+  80462e:	53                   	push   %ebx
+  80462f:	83 ec 04             	sub    $0x4,%esp
+  804632:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  804635:	e8 a2 c6 ff ff       	call   800cdc <sys_getenvid>
+  80463a:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  80463f:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+	if (t == 0)
+  804645:	85 db                	test   %ebx,%ebx
+  804647:	74 0c                	je     804655 <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804649:	89 d9                	mov    %ebx,%ecx
+  80464b:	c1 e1 10             	shl    $0x10,%ecx
+  80464e:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804653:	29 ca                	sub    %ecx,%edx
+  804655:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  804658:	c1 e0 04             	shl    $0x4,%eax
+  80465b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804660:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  804662:	83 ec 0c             	sub    $0xc,%esp
+  804665:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  80466c:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  80466f:	ff 34 95 4c 70 80 00 	push   0x80704c(,%edx,4)
+  804676:	ff 14 95 48 70 80 00 	call   *0x807048(,%edx,4)
+  80467d:	89 04 24             	mov    %eax,(%esp)
+  804680:	e8 25 ff ff ff       	call   8045aa <pthread_exit>
+
+00804685 <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  804685:	55                   	push   %ebp
+  804686:	89 e5                	mov    %esp,%ebp
+  804688:	57                   	push   %edi
+  804689:	56                   	push   %esi
+  80468a:	53                   	push   %ebx
+  80468b:	83 ec 1c             	sub    $0x1c,%esp
+  80468e:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804690:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  804696:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80469d:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8046a2:	77 0d                	ja     8046b1 <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8046a4:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8046a9:	29 d0                	sub    %edx,%eax
+  8046ab:	c1 e8 10             	shr    $0x10,%eax
+  8046ae:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  8046b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8046b6:	eb 2f                	jmp    8046e7 <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  8046b8:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  8046be:	8b 01                	mov    (%ecx),%eax
+  8046c0:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  8046c3:	39 c2                	cmp    %eax,%edx
+  8046c5:	75 14                	jne    8046db <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  8046c7:	83 ec 0c             	sub    $0xc,%esp
+  8046ca:	57                   	push   %edi
+  8046cb:	e8 c1 c5 ff ff       	call   800c91 <sys_env_destroy>
+  8046d0:	83 c4 10             	add    $0x10,%esp
+  8046d3:	85 c0                	test   %eax,%eax
+  8046d5:	0f 88 97 00 00 00    	js     804772 <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  8046db:	83 c3 01             	add    $0x1,%ebx
+  8046de:	83 fb 20             	cmp    $0x20,%ebx
+  8046e1:	0f 84 d2 00 00 00    	je     8047b9 <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  8046e7:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  8046ea:	74 ef                	je     8046db <pthread_kill_others+0x56>
+  8046ec:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8046ef:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  8046f6:	8b 40 04             	mov    0x4(%eax),%eax
+  8046f9:	83 f8 01             	cmp    $0x1,%eax
+  8046fc:	75 dd                	jne    8046db <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  8046fe:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  804701:	8b 3c 85 40 70 80 00 	mov    0x807040(,%eax,4),%edi
+  804708:	89 fe                	mov    %edi,%esi
+  80470a:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  804710:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  804713:	c1 e0 04             	shl    $0x4,%eax
+  804716:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80471b:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  80471e:	39 c7                	cmp    %eax,%edi
+  804720:	75 b9                	jne    8046db <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  804722:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  804725:	c1 e0 04             	shl    $0x4,%eax
+  804728:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80472d:	8b 40 54             	mov    0x54(%eax),%eax
+  804730:	85 c0                	test   %eax,%eax
+  804732:	74 a7                	je     8046db <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  804734:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  804737:	c1 e0 04             	shl    $0x4,%eax
+  80473a:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  804740:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804742:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  804748:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80474d:	0f 87 65 ff ff ff    	ja     8046b8 <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804753:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804758:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  80475a:	c1 e8 10             	shr    $0x10,%eax
+  80475d:	0f 84 55 ff ff ff    	je     8046b8 <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804763:	c1 e0 10             	shl    $0x10,%eax
+  804766:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80476b:	29 c1                	sub    %eax,%ecx
+  80476d:	e9 4c ff ff ff       	jmp    8046be <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  804772:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  804775:	c1 e2 04             	shl    $0x4,%edx
+  804778:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80477e:	8b 52 48             	mov    0x48(%edx),%edx
+  804781:	39 fa                	cmp    %edi,%edx
+  804783:	0f 85 52 ff ff ff    	jne    8046db <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  804789:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  80478c:	c1 e2 04             	shl    $0x4,%edx
+  80478f:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  804795:	8b 52 54             	mov    0x54(%edx),%edx
+  804798:	85 d2                	test   %edx,%edx
+  80479a:	0f 84 3b ff ff ff    	je     8046db <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  8047a0:	83 ec 0c             	sub    $0xc,%esp
+  8047a3:	50                   	push   %eax
+  8047a4:	57                   	push   %edi
+  8047a5:	68 24 57 80 00       	push   $0x805724
+  8047aa:	68 bb 00 00 00       	push   $0xbb
+  8047af:	68 16 57 80 00       	push   $0x805716
+  8047b4:	e8 7e ba ff ff       	call   800237 <_panic>
+	}
+}
+  8047b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8047bc:	5b                   	pop    %ebx
+  8047bd:	5e                   	pop    %esi
+  8047be:	5f                   	pop    %edi
+  8047bf:	5d                   	pop    %ebp
+  8047c0:	c3                   	ret
+
+008047c1 <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  8047c1:	55                   	push   %ebp
+  8047c2:	89 e5                	mov    %esp,%ebp
+  8047c4:	53                   	push   %ebx
+  8047c5:	83 ec 04             	sub    $0x4,%esp
+  8047c8:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8047ca:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  8047d0:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8047d6:	0f 87 85 00 00 00    	ja     804861 <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8047dc:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  8047e1:	29 c3                	sub    %eax,%ebx
+  8047e3:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  8047e6:	83 ec 04             	sub    $0x4,%esp
+  8047e9:	68 80 02 00 00       	push   $0x280
+  8047ee:	6a 00                	push   $0x0
+  8047f0:	68 40 70 80 00       	push   $0x807040
+  8047f5:	e8 4d c2 ff ff       	call   800a47 <memset>
+	threads_mu.m_state = 0;
+  8047fa:	c7 05 20 70 80 00 00 	movl   $0x0,0x807020
+  804801:	00 00 00 
+	if (self != 0) {
+  804804:	83 c4 10             	add    $0x10,%esp
+  804807:	85 db                	test   %ebx,%ebx
+  804809:	74 51                	je     80485c <pthread_fork_child+0x9b>
+  80480b:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80480d:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804813:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804818:	77 18                	ja     804832 <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80481a:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80481f:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804821:	c1 e8 10             	shr    $0x10,%eax
+  804824:	74 0c                	je     804832 <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804826:	c1 e0 10             	shl    $0x10,%eax
+  804829:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80482e:	29 c2                	sub    %eax,%edx
+  804830:	eb 06                	jmp    804838 <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  804832:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		threads[self].th_env = thisenv->env_id;
+  804838:	8b 02                	mov    (%edx),%eax
+  80483a:	8b 48 48             	mov    0x48(%eax),%ecx
+  80483d:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  804844:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  804847:	89 0c 95 40 70 80 00 	mov    %ecx,0x807040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  80484e:	8d 04 95 40 70 80 00 	lea    0x807040(,%edx,4),%eax
+  804855:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  80485c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80485f:	c9                   	leave
+  804860:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  804861:	83 ec 04             	sub    $0x4,%esp
+  804864:	68 80 02 00 00       	push   $0x280
+  804869:	6a 00                	push   $0x0
+  80486b:	68 40 70 80 00       	push   $0x807040
+  804870:	e8 d2 c1 ff ff       	call   800a47 <memset>
+	threads_mu.m_state = 0;
+  804875:	c7 05 20 70 80 00 00 	movl   $0x0,0x807020
+  80487c:	00 00 00 
+  80487f:	83 c4 10             	add    $0x10,%esp
+  804882:	eb d8                	jmp    80485c <pthread_fork_child+0x9b>
+
+00804884 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  804884:	b8 00 00 00 00       	mov    $0x0,%eax
+  804889:	c3                   	ret
+
+0080488a <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80488a:	55                   	push   %ebp
+  80488b:	89 e5                	mov    %esp,%ebp
+  80488d:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  804890:	68 49 57 80 00       	push   $0x805749
+  804895:	ff 75 0c             	push   0xc(%ebp)
+  804898:	e8 59 c0 ff ff       	call   8008f6 <strcpy>
+	return 0;
+}
+  80489d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8048a2:	c9                   	leave
+  8048a3:	c3                   	ret
+
+008048a4 <devcons_write>:
+{
+  8048a4:	55                   	push   %ebp
+  8048a5:	89 e5                	mov    %esp,%ebp
+  8048a7:	57                   	push   %edi
+  8048a8:	56                   	push   %esi
+  8048a9:	53                   	push   %ebx
+  8048aa:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8048b0:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8048b5:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8048bb:	eb 2e                	jmp    8048eb <devcons_write+0x47>
+		m = n - tot;
+  8048bd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8048c0:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8048c2:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8048c7:	39 c3                	cmp    %eax,%ebx
+  8048c9:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8048cc:	83 ec 04             	sub    $0x4,%esp
+  8048cf:	53                   	push   %ebx
+  8048d0:	89 f0                	mov    %esi,%eax
+  8048d2:	03 45 0c             	add    0xc(%ebp),%eax
+  8048d5:	50                   	push   %eax
+  8048d6:	57                   	push   %edi
+  8048d7:	e8 a0 c1 ff ff       	call   800a7c <memmove>
+		sys_cputs(buf, m);
+  8048dc:	83 c4 08             	add    $0x8,%esp
+  8048df:	53                   	push   %ebx
+  8048e0:	57                   	push   %edi
+  8048e1:	e8 54 c3 ff ff       	call   800c3a <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8048e6:	01 de                	add    %ebx,%esi
+  8048e8:	83 c4 10             	add    $0x10,%esp
+  8048eb:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8048ee:	72 cd                	jb     8048bd <devcons_write+0x19>
+}
+  8048f0:	89 f0                	mov    %esi,%eax
+  8048f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8048f5:	5b                   	pop    %ebx
+  8048f6:	5e                   	pop    %esi
+  8048f7:	5f                   	pop    %edi
+  8048f8:	5d                   	pop    %ebp
+  8048f9:	c3                   	ret
+
+008048fa <devcons_read>:
+{
+  8048fa:	55                   	push   %ebp
+  8048fb:	89 e5                	mov    %esp,%ebp
+  8048fd:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  804900:	b8 00 00 00 00       	mov    $0x0,%eax
+  804905:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804909:	75 07                	jne    804912 <devcons_read+0x18>
+  80490b:	eb 1f                	jmp    80492c <devcons_read+0x32>
+		sys_yield();
+  80490d:	e8 f6 c3 ff ff       	call   800d08 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  804912:	e8 4e c3 ff ff       	call   800c65 <sys_cgetc>
+  804917:	85 c0                	test   %eax,%eax
+  804919:	74 f2                	je     80490d <devcons_read+0x13>
+	if (c < 0)
+  80491b:	78 0f                	js     80492c <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80491d:	83 f8 04             	cmp    $0x4,%eax
+  804920:	74 0c                	je     80492e <devcons_read+0x34>
+	*(char*)vbuf = c;
+  804922:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804925:	88 02                	mov    %al,(%edx)
+	return 1;
+  804927:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80492c:	c9                   	leave
+  80492d:	c3                   	ret
+		return 0;
+  80492e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804933:	eb f7                	jmp    80492c <devcons_read+0x32>
+
+00804935 <cputchar>:
+{
+  804935:	55                   	push   %ebp
+  804936:	89 e5                	mov    %esp,%ebp
+  804938:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80493b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80493e:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  804941:	6a 01                	push   $0x1
+  804943:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804946:	50                   	push   %eax
+  804947:	e8 ee c2 ff ff       	call   800c3a <sys_cputs>
+}
+  80494c:	83 c4 10             	add    $0x10,%esp
+  80494f:	c9                   	leave
+  804950:	c3                   	ret
+
+00804951 <getchar>:
+{
+  804951:	55                   	push   %ebp
+  804952:	89 e5                	mov    %esp,%ebp
+  804954:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  804957:	6a 01                	push   $0x1
+  804959:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80495c:	50                   	push   %eax
+  80495d:	6a 00                	push   $0x0
+  80495f:	e8 f5 d1 ff ff       	call   801b59 <read>
+	if (r < 0)
+  804964:	83 c4 10             	add    $0x10,%esp
+  804967:	85 c0                	test   %eax,%eax
+  804969:	78 06                	js     804971 <getchar+0x20>
+	if (r < 1)
+  80496b:	74 06                	je     804973 <getchar+0x22>
+	return c;
+  80496d:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  804971:	c9                   	leave
+  804972:	c3                   	ret
+		return -E_EOF;
+  804973:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804978:	eb f7                	jmp    804971 <getchar+0x20>
+
+0080497a <iscons>:
+{
+  80497a:	55                   	push   %ebp
+  80497b:	89 e5                	mov    %esp,%ebp
+  80497d:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804980:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804983:	50                   	push   %eax
+  804984:	ff 75 08             	push   0x8(%ebp)
+  804987:	e8 3d cf ff ff       	call   8018c9 <fd_lookup>
+  80498c:	83 c4 10             	add    $0x10,%esp
+  80498f:	85 c0                	test   %eax,%eax
+  804991:	78 11                	js     8049a4 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  804993:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804996:	8b 15 b8 62 80 00    	mov    0x8062b8,%edx
+  80499c:	39 10                	cmp    %edx,(%eax)
+  80499e:	0f 94 c0             	sete   %al
+  8049a1:	0f b6 c0             	movzbl %al,%eax
+}
+  8049a4:	c9                   	leave
+  8049a5:	c3                   	ret
+
+008049a6 <opencons>:
+{
+  8049a6:	55                   	push   %ebp
+  8049a7:	89 e5                	mov    %esp,%ebp
+  8049a9:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8049ac:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8049af:	50                   	push   %eax
+  8049b0:	e8 be ce ff ff       	call   801873 <fd_alloc>
+  8049b5:	83 c4 10             	add    $0x10,%esp
+  8049b8:	85 c0                	test   %eax,%eax
+  8049ba:	78 3a                	js     8049f6 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8049bc:	83 ec 04             	sub    $0x4,%esp
+  8049bf:	68 07 04 00 00       	push   $0x407
+  8049c4:	ff 75 f4             	push   -0xc(%ebp)
+  8049c7:	6a 00                	push   $0x0
+  8049c9:	e8 66 c3 ff ff       	call   800d34 <sys_page_alloc>
+  8049ce:	83 c4 10             	add    $0x10,%esp
+  8049d1:	85 c0                	test   %eax,%eax
+  8049d3:	78 21                	js     8049f6 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8049d5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8049d8:	8b 15 b8 62 80 00    	mov    0x8062b8,%edx
+  8049de:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8049e0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8049e3:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8049ea:	83 ec 0c             	sub    $0xc,%esp
+  8049ed:	50                   	push   %eax
+  8049ee:	e8 59 ce ff ff       	call   80184c <fd2num>
+  8049f3:	83 c4 10             	add    $0x10,%esp
+}
+  8049f6:	c9                   	leave
+  8049f7:	c3                   	ret
+
+008049f8 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8049f8:	55                   	push   %ebp
+  8049f9:	89 e5                	mov    %esp,%ebp
+  8049fb:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  8049fe:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  804a05:	74 0a                	je     804a11 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804a07:	8b 45 08             	mov    0x8(%ebp),%eax
+  804a0a:	a3 00 a0 80 00       	mov    %eax,0x80a000
+}
+  804a0f:	c9                   	leave
+  804a10:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  804a11:	83 ec 04             	sub    $0x4,%esp
+  804a14:	6a 07                	push   $0x7
+  804a16:	68 00 f0 bf ee       	push   $0xeebff000
+  804a1b:	6a 00                	push   $0x0
+  804a1d:	e8 12 c3 ff ff       	call   800d34 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804a22:	83 c4 08             	add    $0x8,%esp
+  804a25:	68 36 4a 80 00       	push   $0x804a36
+  804a2a:	6a 00                	push   $0x0
+  804a2c:	e8 80 c4 ff ff       	call   800eb1 <sys_env_set_pgfault_upcall>
+  804a31:	83 c4 10             	add    $0x10,%esp
+  804a34:	eb d1                	jmp    804a07 <set_pgfault_handler+0xf>
+
+00804a36 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804a36:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804a37:	a1 00 a0 80 00       	mov    0x80a000,%eax
+	call *%eax
+  804a3c:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804a3e:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  804a41:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  804a45:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  804a49:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  804a4c:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  804a50:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  804a52:	83 c4 08             	add    $0x8,%esp
+	popal
+  804a55:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  804a56:	83 c4 04             	add    $0x4,%esp
+	popfl
+  804a59:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  804a5a:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  804a5b:	c3                   	ret
+
+00804a5c <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  804a5c:	55                   	push   %ebp
+  804a5d:	89 e5                	mov    %esp,%ebp
+  804a5f:	57                   	push   %edi
+  804a60:	56                   	push   %esi
+  804a61:	53                   	push   %ebx
+  804a62:	83 ec 18             	sub    $0x18,%esp
+  804a65:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804a68:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804a6b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  804a6e:	85 c0                	test   %eax,%eax
+  804a70:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804a75:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  804a78:	50                   	push   %eax
+  804a79:	e8 ac c4 ff ff       	call   800f2a <sys_ipc_recv>
+	if (r < 0) {
+  804a7e:	83 c4 10             	add    $0x10,%esp
+  804a81:	85 c0                	test   %eax,%eax
+  804a83:	78 2b                	js     804ab0 <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  804a85:	85 ff                	test   %edi,%edi
+  804a87:	74 55                	je     804ade <ipc_recv+0x82>
+  804a89:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804a8b:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804a91:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804a96:	77 39                	ja     804ad1 <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804a98:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804a9d:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804a9f:	c1 e8 10             	shr    $0x10,%eax
+  804aa2:	74 2d                	je     804ad1 <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804aa4:	c1 e0 10             	shl    $0x10,%eax
+  804aa7:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804aac:	29 c2                	sub    %eax,%edx
+  804aae:	eb 27                	jmp    804ad7 <ipc_recv+0x7b>
+  804ab0:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  804ab2:	83 ec 08             	sub    $0x8,%esp
+  804ab5:	50                   	push   %eax
+  804ab6:	68 55 57 80 00       	push   $0x805755
+  804abb:	e8 52 b8 ff ff       	call   800312 <cprintf>
+		*from_env_store = 0;
+  804ac0:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  804ac6:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  804acc:	83 c4 10             	add    $0x10,%esp
+  804acf:	eb 77                	jmp    804b48 <ipc_recv+0xec>
+		return pthread_main_tls;
+  804ad1:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  804ad7:	8b 02                	mov    (%edx),%eax
+  804ad9:	8b 40 78             	mov    0x78(%eax),%eax
+  804adc:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804ade:	85 f6                	test   %esi,%esi
+  804ae0:	74 34                	je     804b16 <ipc_recv+0xba>
+  804ae2:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804ae4:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804aea:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804aef:	77 18                	ja     804b09 <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804af1:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804af6:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804af8:	c1 e8 10             	shr    $0x10,%eax
+  804afb:	74 0c                	je     804b09 <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804afd:	c1 e0 10             	shl    $0x10,%eax
+  804b00:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804b05:	29 c2                	sub    %eax,%edx
+  804b07:	eb 06                	jmp    804b0f <ipc_recv+0xb3>
+		return pthread_main_tls;
+  804b09:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  804b0f:	8b 02                	mov    (%edx),%eax
+  804b11:	8b 40 7c             	mov    0x7c(%eax),%eax
+  804b14:	89 06                	mov    %eax,(%esi)
+  804b16:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804b18:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804b1e:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804b23:	77 18                	ja     804b3d <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804b25:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804b2a:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804b2c:	c1 e8 10             	shr    $0x10,%eax
+  804b2f:	74 0c                	je     804b3d <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804b31:	c1 e0 10             	shl    $0x10,%eax
+  804b34:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804b39:	29 c2                	sub    %eax,%edx
+  804b3b:	eb 06                	jmp    804b43 <ipc_recv+0xe7>
+		return pthread_main_tls;
+  804b3d:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+	}
+	return thisenv->env_ipc_value;
+  804b43:	8b 02                	mov    (%edx),%eax
+  804b45:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  804b48:	89 d8                	mov    %ebx,%eax
+  804b4a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804b4d:	5b                   	pop    %ebx
+  804b4e:	5e                   	pop    %esi
+  804b4f:	5f                   	pop    %edi
+  804b50:	5d                   	pop    %ebp
+  804b51:	c3                   	ret
+
+00804b52 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  804b52:	55                   	push   %ebp
+  804b53:	89 e5                	mov    %esp,%ebp
+  804b55:	57                   	push   %edi
+  804b56:	56                   	push   %esi
+  804b57:	53                   	push   %ebx
+  804b58:	83 ec 0c             	sub    $0xc,%esp
+  804b5b:	8b 75 08             	mov    0x8(%ebp),%esi
+  804b5e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804b61:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  804b64:	85 db                	test   %ebx,%ebx
+  804b66:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  804b6b:	0f 44 d8             	cmove  %eax,%ebx
+  804b6e:	eb 05                	jmp    804b75 <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  804b70:	e8 93 c1 ff ff       	call   800d08 <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  804b75:	57                   	push   %edi
+  804b76:	53                   	push   %ebx
+  804b77:	ff 75 0c             	push   0xc(%ebp)
+  804b7a:	56                   	push   %esi
+  804b7b:	e8 7d c3 ff ff       	call   800efd <sys_ipc_try_send>
+		if (r == 0) {
+  804b80:	83 c4 10             	add    $0x10,%esp
+  804b83:	85 c0                	test   %eax,%eax
+  804b85:	74 19                	je     804ba0 <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  804b87:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  804b8a:	74 e4                	je     804b70 <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  804b8c:	83 ec 0c             	sub    $0xc,%esp
+  804b8f:	50                   	push   %eax
+  804b90:	57                   	push   %edi
+  804b91:	53                   	push   %ebx
+  804b92:	56                   	push   %esi
+  804b93:	68 70 57 80 00       	push   $0x805770
+  804b98:	e8 75 b7 ff ff       	call   800312 <cprintf>
+			return;
+  804b9d:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  804ba0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804ba3:	5b                   	pop    %ebx
+  804ba4:	5e                   	pop    %esi
+  804ba5:	5f                   	pop    %edi
+  804ba6:	5d                   	pop    %ebp
+  804ba7:	c3                   	ret
+
+00804ba8 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804ba8:	55                   	push   %ebp
+  804ba9:	89 e5                	mov    %esp,%ebp
+  804bab:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  804bae:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  804bb3:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804bb6:	c1 e0 04             	shl    $0x4,%eax
+  804bb9:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804bbe:	8b 40 50             	mov    0x50(%eax),%eax
+  804bc1:	39 c8                	cmp    %ecx,%eax
+  804bc3:	74 12                	je     804bd7 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804bc5:	83 c2 01             	add    $0x1,%edx
+  804bc8:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  804bce:	75 e3                	jne    804bb3 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  804bd0:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bd5:	eb 0e                	jmp    804be5 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  804bd7:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804bda:	c1 e0 04             	shl    $0x4,%eax
+  804bdd:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804be2:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  804be5:	5d                   	pop    %ebp
+  804be6:	c3                   	ret
+
+00804be7 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804be7:	55                   	push   %ebp
+  804be8:	89 e5                	mov    %esp,%ebp
+  804bea:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804bed:	89 c2                	mov    %eax,%edx
+  804bef:	c1 ea 16             	shr    $0x16,%edx
+  804bf2:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  804bf9:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804bfe:	f6 c1 01             	test   $0x1,%cl
+  804c01:	74 1c                	je     804c1f <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  804c03:	c1 e8 0c             	shr    $0xc,%eax
+  804c06:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  804c0d:	a8 01                	test   $0x1,%al
+  804c0f:	74 0e                	je     804c1f <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  804c11:	c1 e8 0c             	shr    $0xc,%eax
+  804c14:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  804c1b:	ef 
+  804c1c:	0f b7 d2             	movzwl %dx,%edx
+}
+  804c1f:	89 d0                	mov    %edx,%eax
+  804c21:	5d                   	pop    %ebp
+  804c22:	c3                   	ret
+
+00804c23 <udm>:
+  804c23:	57                   	push   %edi
+  804c24:	56                   	push   %esi
+  804c25:	53                   	push   %ebx
+  804c26:	83 ec 20             	sub    $0x20,%esp
+  804c29:	89 44 24 10          	mov    %eax,0x10(%esp)
+  804c2d:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804c31:	8b 44 24 30          	mov    0x30(%esp),%eax
+  804c35:	8b 54 24 34          	mov    0x34(%esp),%edx
+  804c39:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804c3d:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804c41:	89 d1                	mov    %edx,%ecx
+  804c43:	09 c1                	or     %eax,%ecx
+  804c45:	0f 84 91 00 00 00    	je     804cdc <udm+0xb9>
+  804c4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c50:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c55:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804c5a:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804c61:	00 
+  804c62:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  804c69:	00 
+  804c6a:	eb 08                	jmp    804c74 <udm+0x51>
+  804c6c:	83 e9 01             	sub    $0x1,%ecx
+  804c6f:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  804c72:	74 7c                	je     804cf0 <udm+0xcd>
+  804c74:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804c78:	01 c0                	add    %eax,%eax
+  804c7a:	89 c6                	mov    %eax,%esi
+  804c7c:	89 d7                	mov    %edx,%edi
+  804c7e:	8b 44 24 10          	mov    0x10(%esp),%eax
+  804c82:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804c86:	0f ad d0             	shrd   %cl,%edx,%eax
+  804c89:	d3 ea                	shr    %cl,%edx
+  804c8b:	f6 c1 20             	test   $0x20,%cl
+  804c8e:	74 04                	je     804c94 <udm+0x71>
+  804c90:	89 d0                	mov    %edx,%eax
+  804c92:	31 d2                	xor    %edx,%edx
+  804c94:	83 e0 01             	and    $0x1,%eax
+  804c97:	89 04 24             	mov    %eax,(%esp)
+  804c9a:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804ca1:	00 
+  804ca2:	8b 04 24             	mov    (%esp),%eax
+  804ca5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804ca9:	09 f0                	or     %esi,%eax
+  804cab:	09 fa                	or     %edi,%edx
+  804cad:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804cb1:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804cb5:	39 f0                	cmp    %esi,%eax
+  804cb7:	89 d3                	mov    %edx,%ebx
+  804cb9:	19 fb                	sbb    %edi,%ebx
+  804cbb:	72 af                	jb     804c6c <udm+0x49>
+  804cbd:	29 f0                	sub    %esi,%eax
+  804cbf:	19 fa                	sbb    %edi,%edx
+  804cc1:	89 cf                	mov    %ecx,%edi
+  804cc3:	c1 ef 05             	shr    $0x5,%edi
+  804cc6:	83 e7 01             	and    $0x1,%edi
+  804cc9:	89 fe                	mov    %edi,%esi
+  804ccb:	83 f6 01             	xor    $0x1,%esi
+  804cce:	d3 e6                	shl    %cl,%esi
+  804cd0:	d3 e7                	shl    %cl,%edi
+  804cd2:	09 74 24 18          	or     %esi,0x18(%esp)
+  804cd6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804cda:	eb 90                	jmp    804c6c <udm+0x49>
+  804cdc:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804ce0:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804ce4:	89 f0                	mov    %esi,%eax
+  804ce6:	89 fa                	mov    %edi,%edx
+  804ce8:	89 74 24 18          	mov    %esi,0x18(%esp)
+  804cec:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  804cf0:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  804cf4:	89 01                	mov    %eax,(%ecx)
+  804cf6:	89 51 04             	mov    %edx,0x4(%ecx)
+  804cf9:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804cfd:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804d01:	83 c4 20             	add    $0x20,%esp
+  804d04:	5b                   	pop    %ebx
+  804d05:	5e                   	pop    %esi
+  804d06:	5f                   	pop    %edi
+  804d07:	c3                   	ret
+
+00804d08 <__udivdi3>:
+  804d08:	83 ec 18             	sub    $0x18,%esp
+  804d0b:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804d0f:	50                   	push   %eax
+  804d10:	ff 74 24 2c          	push   0x2c(%esp)
+  804d14:	ff 74 24 2c          	push   0x2c(%esp)
+  804d18:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804d1c:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804d20:	e8 fe fe ff ff       	call   804c23 <udm>
+  804d25:	83 c4 24             	add    $0x24,%esp
+  804d28:	c3                   	ret
+
+00804d29 <__umoddi3>:
+  804d29:	83 ec 18             	sub    $0x18,%esp
+  804d2c:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804d30:	50                   	push   %eax
+  804d31:	ff 74 24 2c          	push   0x2c(%esp)
+  804d35:	ff 74 24 2c          	push   0x2c(%esp)
+  804d39:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804d3d:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804d41:	e8 dd fe ff ff       	call   804c23 <udm>
+  804d46:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804d4a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804d4e:	83 c4 24             	add    $0x24,%esp
+  804d51:	c3                   	ret
+
+00804d52 <__divdi3>:
+  804d52:	56                   	push   %esi
+  804d53:	53                   	push   %ebx
+  804d54:	83 ec 14             	sub    $0x14,%esp
+  804d57:	8b 44 24 20          	mov    0x20(%esp),%eax
+  804d5b:	8b 54 24 24          	mov    0x24(%esp),%edx
+  804d5f:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  804d63:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  804d67:	85 d2                	test   %edx,%edx
+  804d69:	78 18                	js     804d83 <__divdi3+0x31>
+  804d6b:	85 db                	test   %ebx,%ebx
+  804d6d:	78 3e                	js     804dad <__divdi3+0x5b>
+  804d6f:	83 ec 04             	sub    $0x4,%esp
+  804d72:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804d76:	56                   	push   %esi
+  804d77:	53                   	push   %ebx
+  804d78:	51                   	push   %ecx
+  804d79:	e8 a5 fe ff ff       	call   804c23 <udm>
+  804d7e:	83 c4 10             	add    $0x10,%esp
+  804d81:	eb 24                	jmp    804da7 <__divdi3+0x55>
+  804d83:	f7 d8                	neg    %eax
+  804d85:	83 d2 00             	adc    $0x0,%edx
+  804d88:	f7 da                	neg    %edx
+  804d8a:	85 db                	test   %ebx,%ebx
+  804d8c:	78 3a                	js     804dc8 <__divdi3+0x76>
+  804d8e:	83 ec 04             	sub    $0x4,%esp
+  804d91:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804d95:	56                   	push   %esi
+  804d96:	53                   	push   %ebx
+  804d97:	51                   	push   %ecx
+  804d98:	e8 86 fe ff ff       	call   804c23 <udm>
+  804d9d:	83 c4 10             	add    $0x10,%esp
+  804da0:	f7 d8                	neg    %eax
+  804da2:	83 d2 00             	adc    $0x0,%edx
+  804da5:	f7 da                	neg    %edx
+  804da7:	83 c4 14             	add    $0x14,%esp
+  804daa:	5b                   	pop    %ebx
+  804dab:	5e                   	pop    %esi
+  804dac:	c3                   	ret
+  804dad:	83 ec 04             	sub    $0x4,%esp
+  804db0:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804db4:	56                   	push   %esi
+  804db5:	f7 d9                	neg    %ecx
+  804db7:	83 d3 00             	adc    $0x0,%ebx
+  804dba:	f7 db                	neg    %ebx
+  804dbc:	53                   	push   %ebx
+  804dbd:	51                   	push   %ecx
+  804dbe:	e8 60 fe ff ff       	call   804c23 <udm>
+  804dc3:	83 c4 10             	add    $0x10,%esp
+  804dc6:	eb d8                	jmp    804da0 <__divdi3+0x4e>
+  804dc8:	83 ec 04             	sub    $0x4,%esp
+  804dcb:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804dcf:	56                   	push   %esi
+  804dd0:	f7 d9                	neg    %ecx
+  804dd2:	83 d3 00             	adc    $0x0,%ebx
+  804dd5:	f7 db                	neg    %ebx
+  804dd7:	53                   	push   %ebx
+  804dd8:	51                   	push   %ecx
+  804dd9:	e8 45 fe ff ff       	call   804c23 <udm>
+  804dde:	83 c4 10             	add    $0x10,%esp
+  804de1:	eb c4                	jmp    804da7 <__divdi3+0x55>
+
+00804de3 <__moddi3>:
+  804de3:	55                   	push   %ebp
+  804de4:	57                   	push   %edi
+  804de5:	56                   	push   %esi
+  804de6:	53                   	push   %ebx
+  804de7:	83 ec 24             	sub    $0x24,%esp
+  804dea:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804dee:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804df2:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  804df6:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  804dfa:	85 d2                	test   %edx,%edx
+  804dfc:	78 3b                	js     804e39 <__moddi3+0x56>
+  804dfe:	83 ec 04             	sub    $0x4,%esp
+  804e01:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804e05:	56                   	push   %esi
+  804e06:	89 ce                	mov    %ecx,%esi
+  804e08:	f7 de                	neg    %esi
+  804e0a:	89 74 24 08          	mov    %esi,0x8(%esp)
+  804e0e:	89 de                	mov    %ebx,%esi
+  804e10:	83 d6 00             	adc    $0x0,%esi
+  804e13:	f7 de                	neg    %esi
+  804e15:	89 74 24 14          	mov    %esi,0x14(%esp)
+  804e19:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804e1d:	0f 48 f1             	cmovs  %ecx,%esi
+  804e20:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  804e25:	53                   	push   %ebx
+  804e26:	56                   	push   %esi
+  804e27:	e8 f7 fd ff ff       	call   804c23 <udm>
+  804e2c:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804e30:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804e34:	83 c4 10             	add    $0x10,%esp
+  804e37:	eb 47                	jmp    804e80 <__moddi3+0x9d>
+  804e39:	f7 d8                	neg    %eax
+  804e3b:	83 d2 00             	adc    $0x0,%edx
+  804e3e:	f7 da                	neg    %edx
+  804e40:	83 ec 04             	sub    $0x4,%esp
+  804e43:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804e47:	56                   	push   %esi
+  804e48:	89 cf                	mov    %ecx,%edi
+  804e4a:	f7 df                	neg    %edi
+  804e4c:	89 de                	mov    %ebx,%esi
+  804e4e:	83 d6 00             	adc    $0x0,%esi
+  804e51:	f7 de                	neg    %esi
+  804e53:	0f 49 cf             	cmovns %edi,%ecx
+  804e56:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  804e5a:	0f 49 de             	cmovns %esi,%ebx
+  804e5d:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  804e61:	ff 74 24 0c          	push   0xc(%esp)
+  804e65:	ff 74 24 0c          	push   0xc(%esp)
+  804e69:	e8 b5 fd ff ff       	call   804c23 <udm>
+  804e6e:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804e72:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804e76:	f7 d8                	neg    %eax
+  804e78:	83 d2 00             	adc    $0x0,%edx
+  804e7b:	f7 da                	neg    %edx
+  804e7d:	83 c4 10             	add    $0x10,%esp
+  804e80:	83 c4 24             	add    $0x24,%esp
+  804e83:	5b                   	pop    %ebx
+  804e84:	5e                   	pop    %esi
+  804e85:	5f                   	pop    %edi
+  804e86:	5d                   	pop    %ebp
+  804e87:	c3                   	ret
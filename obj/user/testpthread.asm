@@ -0,0 +1,10056 @@
+
+obj/user/testpthread.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 19 03 00 00       	call   80034a <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <worker>:
+static volatile int counter;
+static volatile int shared;
+
+static void *
+worker(void *arg)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	8b 75 08             	mov    0x8(%ebp),%esi
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  80003b:	89 e2                	mov    %esp,%edx
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80003d:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  800043:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800048:	77 18                	ja     800062 <worker+0x2f>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80004a:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80004f:	29 d0                	sub    %edx,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  800051:	c1 e8 10             	shr    $0x10,%eax
+  800054:	74 0c                	je     800062 <worker+0x2f>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800056:	c1 e0 10             	shl    $0x10,%eax
+  800059:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80005e:	29 c2                	sub    %eax,%edx
+  800060:	eb 06                	jmp    800068 <worker+0x35>
+		return pthread_main_tls;
+  800062:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+	int i, id = (int) arg;
+
+	if (thisenv->env_id != sys_getenvid())
+  800068:	8b 02                	mov    (%edx),%eax
+  80006a:	8b 58 48             	mov    0x48(%eax),%ebx
+  80006d:	e8 20 0e 00 00       	call   800e92 <sys_getenvid>
+  800072:	39 c3                	cmp    %eax,%ebx
+  800074:	75 07                	jne    80007d <worker+0x4a>
+  800076:	bb e9 03 00 00       	mov    $0x3e9,%ebx
+  80007b:	eb 3b                	jmp    8000b8 <worker+0x85>
+		panic("thread %d: thisenv is not private", id);
+  80007d:	56                   	push   %esi
+  80007e:	68 40 4a 80 00       	push   $0x804a40
+  800083:	6a 10                	push   $0x10
+  800085:	68 a8 4a 80 00       	push   $0x804aa8
+  80008a:	e8 5e 03 00 00       	call   8003ed <_panic>
+	for (i = 0; i < NITER; i++) {
+		mutex_lock(&mu);
+  80008f:	83 ec 0c             	sub    $0xc,%esp
+  800092:	68 08 70 80 00       	push   $0x807008
+  800097:	e8 75 3b 00 00       	call   803c11 <mutex_lock>
+		counter++;
+  80009c:	a1 04 70 80 00       	mov    0x807004,%eax
+  8000a1:	83 c0 01             	add    $0x1,%eax
+  8000a4:	a3 04 70 80 00       	mov    %eax,0x807004
+		mutex_unlock(&mu);
+  8000a9:	c7 04 24 08 70 80 00 	movl   $0x807008,(%esp)
+  8000b0:	e8 c9 3b 00 00       	call   803c7e <mutex_unlock>
+  8000b5:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NITER; i++) {
+  8000b8:	83 eb 01             	sub    $0x1,%ebx
+  8000bb:	75 d2                	jne    80008f <worker+0x5c>
+	}
+	// pages mapped by one thread are visible to all
+	if (id == 0)
+  8000bd:	85 f6                	test   %esi,%esi
+  8000bf:	74 0a                	je     8000cb <worker+0x98>
+		sys_page_alloc(0, (void *) 0xA0000000, PTE_P|PTE_U|PTE_W);
+	return (void *) (id + 100);
+  8000c1:	8d 46 64             	lea    0x64(%esi),%eax
+}
+  8000c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000c7:	5b                   	pop    %ebx
+  8000c8:	5e                   	pop    %esi
+  8000c9:	5d                   	pop    %ebp
+  8000ca:	c3                   	ret
+		sys_page_alloc(0, (void *) 0xA0000000, PTE_P|PTE_U|PTE_W);
+  8000cb:	83 ec 04             	sub    $0x4,%esp
+  8000ce:	6a 07                	push   $0x7
+  8000d0:	68 00 00 00 a0       	push   $0xa0000000
+  8000d5:	6a 00                	push   $0x0
+  8000d7:	e8 0e 0e 00 00       	call   800eea <sys_page_alloc>
+  8000dc:	83 c4 10             	add    $0x10,%esp
+  8000df:	eb e0                	jmp    8000c1 <worker+0x8e>
+
+008000e1 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8000e1:	55                   	push   %ebp
+  8000e2:	89 e5                	mov    %esp,%ebp
+  8000e4:	56                   	push   %esi
+  8000e5:	53                   	push   %ebx
+  8000e6:	83 ec 20             	sub    $0x20,%esp
+	pthread_t t[NTHREAD];
+	void *ret;
+	int i, r, local = 0;
+	envid_t child;
+
+	for (i = 0; i < NTHREAD; i++)
+  8000e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if ((r = pthread_create(&t[i], worker, (void *) i)) < 0)
+  8000ee:	83 ec 04             	sub    $0x4,%esp
+  8000f1:	53                   	push   %ebx
+  8000f2:	68 33 00 80 00       	push   $0x800033
+  8000f7:	8d 44 9d e8          	lea    -0x18(%ebp,%ebx,4),%eax
+  8000fb:	50                   	push   %eax
+  8000fc:	e8 66 3d 00 00       	call   803e67 <pthread_create>
+  800101:	83 c4 10             	add    $0x10,%esp
+  800104:	85 c0                	test   %eax,%eax
+  800106:	78 7a                	js     800182 <umain+0xa1>
+	for (i = 0; i < NTHREAD; i++)
+  800108:	83 c3 01             	add    $0x1,%ebx
+  80010b:	83 fb 04             	cmp    $0x4,%ebx
+  80010e:	75 de                	jne    8000ee <umain+0xd>
+			panic("pthread_create: %e", r);
+	for (i = 0; i < NTHREAD; i++) {
+  800110:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if ((r = pthread_join(t[i], &ret)) < 0)
+  800115:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  800118:	83 ec 08             	sub    $0x8,%esp
+  80011b:	56                   	push   %esi
+  80011c:	ff 74 9d e8          	push   -0x18(%ebp,%ebx,4)
+  800120:	e8 2a 3f 00 00       	call   80404f <pthread_join>
+  800125:	83 c4 10             	add    $0x10,%esp
+  800128:	85 c0                	test   %eax,%eax
+  80012a:	78 68                	js     800194 <umain+0xb3>
+			panic("pthread_join: %e", r);
+		if ((int) ret != i + 100)
+  80012c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80012f:	8d 53 64             	lea    0x64(%ebx),%edx
+  800132:	39 d0                	cmp    %edx,%eax
+  800134:	75 70                	jne    8001a6 <umain+0xc5>
+	for (i = 0; i < NTHREAD; i++) {
+  800136:	83 c3 01             	add    $0x1,%ebx
+  800139:	83 fb 04             	cmp    $0x4,%ebx
+  80013c:	75 da                	jne    800118 <umain+0x37>
+			panic("thread %d returned %d", i, (int) ret);
+	}
+	if (counter != NTHREAD * NITER)
+  80013e:	a1 04 70 80 00       	mov    0x807004,%eax
+  800143:	3d a0 0f 00 00       	cmp    $0xfa0,%eax
+  800148:	75 72                	jne    8001bc <umain+0xdb>
+		panic("counter is %d, want %d", counter, NTHREAD * NITER);
+	if (!(uvpt[PGNUM(0xA0000000)] & PTE_P))
+  80014a:	a1 00 00 68 ef       	mov    0xef680000,%eax
+  80014f:	a8 01                	test   $0x1,%al
+  800151:	0f 84 84 00 00 00    	je     8001db <umain+0xfa>
+  800157:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800159:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80015f:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800164:	0f 87 85 00 00 00    	ja     8001ef <umain+0x10e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80016a:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80016f:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  800171:	c1 e8 10             	shr    $0x10,%eax
+  800174:	74 79                	je     8001ef <umain+0x10e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800176:	c1 e0 10             	shl    $0x10,%eax
+  800179:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80017e:	29 c2                	sub    %eax,%edx
+  800180:	eb 73                	jmp    8001f5 <umain+0x114>
+			panic("pthread_create: %e", r);
+  800182:	50                   	push   %eax
+  800183:	68 bb 4a 80 00       	push   $0x804abb
+  800188:	6a 26                	push   $0x26
+  80018a:	68 a8 4a 80 00       	push   $0x804aa8
+  80018f:	e8 59 02 00 00       	call   8003ed <_panic>
+			panic("pthread_join: %e", r);
+  800194:	50                   	push   %eax
+  800195:	68 ce 4a 80 00       	push   $0x804ace
+  80019a:	6a 29                	push   $0x29
+  80019c:	68 a8 4a 80 00       	push   $0x804aa8
+  8001a1:	e8 47 02 00 00       	call   8003ed <_panic>
+			panic("thread %d returned %d", i, (int) ret);
+  8001a6:	83 ec 0c             	sub    $0xc,%esp
+  8001a9:	50                   	push   %eax
+  8001aa:	53                   	push   %ebx
+  8001ab:	68 df 4a 80 00       	push   $0x804adf
+  8001b0:	6a 2b                	push   $0x2b
+  8001b2:	68 a8 4a 80 00       	push   $0x804aa8
+  8001b7:	e8 31 02 00 00       	call   8003ed <_panic>
+		panic("counter is %d, want %d", counter, NTHREAD * NITER);
+  8001bc:	a1 04 70 80 00       	mov    0x807004,%eax
+  8001c1:	83 ec 0c             	sub    $0xc,%esp
+  8001c4:	68 a0 0f 00 00       	push   $0xfa0
+  8001c9:	50                   	push   %eax
+  8001ca:	68 f5 4a 80 00       	push   $0x804af5
+  8001cf:	6a 2e                	push   $0x2e
+  8001d1:	68 a8 4a 80 00       	push   $0x804aa8
+  8001d6:	e8 12 02 00 00       	call   8003ed <_panic>
+		panic("thread's mapping is not shared");
+  8001db:	83 ec 04             	sub    $0x4,%esp
+  8001de:	68 64 4a 80 00       	push   $0x804a64
+  8001e3:	6a 30                	push   $0x30
+  8001e5:	68 a8 4a 80 00       	push   $0x804aa8
+  8001ea:	e8 fe 01 00 00       	call   8003ed <_panic>
+		return pthread_main_tls;
+  8001ef:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+	if (thisenv->env_id != sys_getenvid())
+  8001f5:	8b 02                	mov    (%edx),%eax
+  8001f7:	8b 58 48             	mov    0x48(%eax),%ebx
+  8001fa:	e8 93 0c 00 00       	call   800e92 <sys_getenvid>
+  8001ff:	39 c3                	cmp    %eax,%ebx
+  800201:	75 71                	jne    800274 <umain+0x193>
+		panic("main thread's thisenv changed");
+	cprintf("pthread is good\n");
+  800203:	83 ec 0c             	sub    $0xc,%esp
+  800206:	68 2a 4b 80 00       	push   $0x804b2a
+  80020b:	e8 b8 02 00 00       	call   8004c8 <cprintf>
+
+	// slots are reused after join
+	if ((r = pthread_create(&t[0], worker, (void *) 1)) < 0
+  800210:	83 c4 0c             	add    $0xc,%esp
+  800213:	6a 01                	push   $0x1
+  800215:	68 33 00 80 00       	push   $0x800033
+  80021a:	8d 45 e8             	lea    -0x18(%ebp),%eax
+  80021d:	50                   	push   %eax
+  80021e:	e8 44 3c 00 00       	call   803e67 <pthread_create>
+  800223:	83 c4 10             	add    $0x10,%esp
+  800226:	85 c0                	test   %eax,%eax
+  800228:	78 5e                	js     800288 <umain+0x1a7>
+	    || (r = pthread_join(t[0], NULL)) < 0)
+  80022a:	83 ec 08             	sub    $0x8,%esp
+  80022d:	6a 00                	push   $0x0
+  80022f:	ff 75 e8             	push   -0x18(%ebp)
+  800232:	e8 18 3e 00 00       	call   80404f <pthread_join>
+  800237:	83 c4 10             	add    $0x10,%esp
+  80023a:	85 c0                	test   %eax,%eax
+  80023c:	78 4a                	js     800288 <umain+0x1a7>
+		panic("reusing a thread slot: %e", r);
+
+	// sfork shares globals but not the stack
+	if ((child = sfork()) < 0)
+  80023e:	e8 60 15 00 00       	call   8017a3 <sfork>
+  800243:	85 c0                	test   %eax,%eax
+  800245:	78 53                	js     80029a <umain+0x1b9>
+		panic("sfork: %e", child);
+	if (child == 0) {
+  800247:	0f 85 c9 00 00 00    	jne    800316 <umain+0x235>
+  80024d:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80024f:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  800255:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80025a:	77 50                	ja     8002ac <umain+0x1cb>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80025c:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800261:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  800263:	c1 e8 10             	shr    $0x10,%eax
+  800266:	74 44                	je     8002ac <umain+0x1cb>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800268:	c1 e0 10             	shl    $0x10,%eax
+  80026b:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800270:	29 c2                	sub    %eax,%edx
+  800272:	eb 3e                	jmp    8002b2 <umain+0x1d1>
+		panic("main thread's thisenv changed");
+  800274:	83 ec 04             	sub    $0x4,%esp
+  800277:	68 0c 4b 80 00       	push   $0x804b0c
+  80027c:	6a 32                	push   $0x32
+  80027e:	68 a8 4a 80 00       	push   $0x804aa8
+  800283:	e8 65 01 00 00       	call   8003ed <_panic>
+		panic("reusing a thread slot: %e", r);
+  800288:	50                   	push   %eax
+  800289:	68 3b 4b 80 00       	push   $0x804b3b
+  80028e:	6a 38                	push   $0x38
+  800290:	68 a8 4a 80 00       	push   $0x804aa8
+  800295:	e8 53 01 00 00       	call   8003ed <_panic>
+		panic("sfork: %e", child);
+  80029a:	50                   	push   %eax
+  80029b:	68 55 4b 80 00       	push   $0x804b55
+  8002a0:	6a 3c                	push   $0x3c
+  8002a2:	68 a8 4a 80 00       	push   $0x804aa8
+  8002a7:	e8 41 01 00 00       	call   8003ed <_panic>
+		return pthread_main_tls;
+  8002ac:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		if (thisenv->env_id != sys_getenvid())
+  8002b2:	8b 02                	mov    (%edx),%eax
+  8002b4:	8b 58 48             	mov    0x48(%eax),%ebx
+  8002b7:	e8 d6 0b 00 00       	call   800e92 <sys_getenvid>
+  8002bc:	39 c3                	cmp    %eax,%ebx
+  8002be:	75 42                	jne    800302 <umain+0x221>
+			panic("sfork child: thisenv is not private");
+		local = 1;
+		shared = 1;
+  8002c0:	c7 05 00 70 80 00 01 	movl   $0x1,0x807000
+  8002c7:	00 00 00 
+		exit();
+  8002ca:	e8 f6 00 00 00       	call   8003c5 <exit>
+	}
+	wait(child);
+  8002cf:	83 ec 0c             	sub    $0xc,%esp
+  8002d2:	6a 00                	push   $0x0
+  8002d4:	e8 d9 38 00 00       	call   803bb2 <wait>
+	if (shared != 1 || local != 0)
+  8002d9:	a1 00 70 80 00       	mov    0x807000,%eax
+  8002de:	83 c4 10             	add    $0x10,%esp
+		local = 1;
+  8002e1:	b8 01 00 00 00       	mov    $0x1,%eax
+		panic("sfork: shared %d local %d", shared, local);
+  8002e6:	8b 15 00 70 80 00    	mov    0x807000,%edx
+  8002ec:	83 ec 0c             	sub    $0xc,%esp
+  8002ef:	50                   	push   %eax
+  8002f0:	52                   	push   %edx
+  8002f1:	68 5f 4b 80 00       	push   $0x804b5f
+  8002f6:	6a 46                	push   $0x46
+  8002f8:	68 a8 4a 80 00       	push   $0x804aa8
+  8002fd:	e8 eb 00 00 00       	call   8003ed <_panic>
+			panic("sfork child: thisenv is not private");
+  800302:	83 ec 04             	sub    $0x4,%esp
+  800305:	68 84 4a 80 00       	push   $0x804a84
+  80030a:	6a 3f                	push   $0x3f
+  80030c:	68 a8 4a 80 00       	push   $0x804aa8
+  800311:	e8 d7 00 00 00       	call   8003ed <_panic>
+	wait(child);
+  800316:	83 ec 0c             	sub    $0xc,%esp
+  800319:	50                   	push   %eax
+  80031a:	e8 93 38 00 00       	call   803bb2 <wait>
+	if (shared != 1 || local != 0)
+  80031f:	a1 00 70 80 00       	mov    0x807000,%eax
+  800324:	83 c4 10             	add    $0x10,%esp
+  800327:	83 f8 01             	cmp    $0x1,%eax
+  80032a:	75 17                	jne    800343 <umain+0x262>
+	cprintf("sfork is good\n");
+  80032c:	83 ec 0c             	sub    $0xc,%esp
+  80032f:	68 79 4b 80 00       	push   $0x804b79
+  800334:	e8 8f 01 00 00       	call   8004c8 <cprintf>
+}
+  800339:	83 c4 10             	add    $0x10,%esp
+  80033c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80033f:	5b                   	pop    %ebx
+  800340:	5e                   	pop    %esi
+  800341:	5d                   	pop    %ebp
+  800342:	c3                   	ret
+	int i, r, local = 0;
+  800343:	b8 00 00 00 00       	mov    $0x0,%eax
+  800348:	eb 9c                	jmp    8002e6 <umain+0x205>
+
+0080034a <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80034a:	55                   	push   %ebp
+  80034b:	89 e5                	mov    %esp,%ebp
+  80034d:	57                   	push   %edi
+  80034e:	56                   	push   %esi
+  80034f:	53                   	push   %ebx
+  800350:	83 ec 1c             	sub    $0x1c,%esp
+  800353:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800356:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  800359:	e8 34 0b 00 00       	call   800e92 <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  80035e:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  800361:	89 15 c0 72 80 00    	mov    %edx,0x8072c0
+	thisenv = &envs[ENVX(eid)];
+  800367:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80036c:	89 c1                	mov    %eax,%ecx
+  80036e:	89 e7                	mov    %esp,%edi
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  800370:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  800376:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80037b:	77 16                	ja     800393 <libmain+0x49>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80037d:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800382:	29 f8                	sub    %edi,%eax
+	if (t == 0)
+  800384:	c1 e8 10             	shr    $0x10,%eax
+  800387:	74 0a                	je     800393 <libmain+0x49>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800389:	c1 e0 10             	shl    $0x10,%eax
+  80038c:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800391:	29 c2                	sub    %eax,%edx
+  800393:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  800396:	c1 e0 04             	shl    $0x4,%eax
+  800399:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80039e:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8003a0:	85 db                	test   %ebx,%ebx
+  8003a2:	7e 07                	jle    8003ab <libmain+0x61>
+		binaryname = argv[0];
+  8003a4:	8b 06                	mov    (%esi),%eax
+  8003a6:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// call user main routine
+	umain(argc, argv);
+  8003ab:	83 ec 08             	sub    $0x8,%esp
+  8003ae:	56                   	push   %esi
+  8003af:	53                   	push   %ebx
+  8003b0:	e8 2c fd ff ff       	call   8000e1 <umain>
+
+	// exit gracefully
+	exit();
+  8003b5:	e8 0b 00 00 00       	call   8003c5 <exit>
+}
+  8003ba:	83 c4 10             	add    $0x10,%esp
+  8003bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003c0:	5b                   	pop    %ebx
+  8003c1:	5e                   	pop    %esi
+  8003c2:	5f                   	pop    %edi
+  8003c3:	5d                   	pop    %ebp
+  8003c4:	c3                   	ret
+
+008003c5 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8003c5:	55                   	push   %ebp
+  8003c6:	89 e5                	mov    %esp,%ebp
+  8003c8:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  8003cb:	6a 00                	push   $0x0
+  8003cd:	e8 8b 27 00 00       	call   802b5d <fflush>
+	pthread_kill_others();
+  8003d2:	e8 47 3e 00 00       	call   80421e <pthread_kill_others>
+	close_all();
+  8003d7:	e8 24 18 00 00       	call   801c00 <close_all>
+	sys_env_destroy(0);
+  8003dc:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8003e3:	e8 5f 0a 00 00       	call   800e47 <sys_env_destroy>
+}
+  8003e8:	83 c4 10             	add    $0x10,%esp
+  8003eb:	c9                   	leave
+  8003ec:	c3                   	ret
+
+008003ed <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8003ed:	55                   	push   %ebp
+  8003ee:	89 e5                	mov    %esp,%ebp
+  8003f0:	56                   	push   %esi
+  8003f1:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8003f2:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8003f5:	8b 35 00 60 80 00    	mov    0x806000,%esi
+  8003fb:	e8 92 0a 00 00       	call   800e92 <sys_getenvid>
+  800400:	83 ec 0c             	sub    $0xc,%esp
+  800403:	ff 75 0c             	push   0xc(%ebp)
+  800406:	ff 75 08             	push   0x8(%ebp)
+  800409:	56                   	push   %esi
+  80040a:	50                   	push   %eax
+  80040b:	68 94 4b 80 00       	push   $0x804b94
+  800410:	e8 b3 00 00 00       	call   8004c8 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800415:	83 c4 18             	add    $0x18,%esp
+  800418:	53                   	push   %ebx
+  800419:	ff 75 10             	push   0x10(%ebp)
+  80041c:	e8 56 00 00 00       	call   800477 <vcprintf>
+	cprintf("\n");
+  800421:	c7 04 24 9a 50 80 00 	movl   $0x80509a,(%esp)
+  800428:	e8 9b 00 00 00       	call   8004c8 <cprintf>
+  80042d:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800430:	cc                   	int3
+	while (1)
+  800431:	eb fd                	jmp    800430 <_panic+0x43>
+
+00800433 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800433:	55                   	push   %ebp
+  800434:	89 e5                	mov    %esp,%ebp
+  800436:	53                   	push   %ebx
+  800437:	83 ec 04             	sub    $0x4,%esp
+  80043a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80043d:	8b 13                	mov    (%ebx),%edx
+  80043f:	8d 42 01             	lea    0x1(%edx),%eax
+  800442:	89 03                	mov    %eax,(%ebx)
+  800444:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800447:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80044b:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800450:	74 09                	je     80045b <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800452:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800456:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800459:	c9                   	leave
+  80045a:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80045b:	83 ec 08             	sub    $0x8,%esp
+  80045e:	68 ff 00 00 00       	push   $0xff
+  800463:	8d 43 08             	lea    0x8(%ebx),%eax
+  800466:	50                   	push   %eax
+  800467:	e8 84 09 00 00       	call   800df0 <sys_cputs>
+		b->idx = 0;
+  80046c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800472:	83 c4 10             	add    $0x10,%esp
+  800475:	eb db                	jmp    800452 <putch+0x1f>
+
+00800477 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800477:	55                   	push   %ebp
+  800478:	89 e5                	mov    %esp,%ebp
+  80047a:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800480:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800487:	00 00 00 
+	b.cnt = 0;
+  80048a:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800491:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800494:	ff 75 0c             	push   0xc(%ebp)
+  800497:	ff 75 08             	push   0x8(%ebp)
+  80049a:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8004a0:	50                   	push   %eax
+  8004a1:	68 33 04 80 00       	push   $0x800433
+  8004a6:	e8 14 01 00 00       	call   8005bf <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8004ab:	83 c4 08             	add    $0x8,%esp
+  8004ae:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8004b4:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8004ba:	50                   	push   %eax
+  8004bb:	e8 30 09 00 00       	call   800df0 <sys_cputs>
+
+	return b.cnt;
+}
+  8004c0:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8004c6:	c9                   	leave
+  8004c7:	c3                   	ret
+
+008004c8 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8004c8:	55                   	push   %ebp
+  8004c9:	89 e5                	mov    %esp,%ebp
+  8004cb:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8004ce:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8004d1:	50                   	push   %eax
+  8004d2:	ff 75 08             	push   0x8(%ebp)
+  8004d5:	e8 9d ff ff ff       	call   800477 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8004da:	c9                   	leave
+  8004db:	c3                   	ret
+
+008004dc <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8004dc:	55                   	push   %ebp
+  8004dd:	89 e5                	mov    %esp,%ebp
+  8004df:	57                   	push   %edi
+  8004e0:	56                   	push   %esi
+  8004e1:	53                   	push   %ebx
+  8004e2:	83 ec 1c             	sub    $0x1c,%esp
+  8004e5:	89 c7                	mov    %eax,%edi
+  8004e7:	89 d6                	mov    %edx,%esi
+  8004e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004ec:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8004ef:	89 d1                	mov    %edx,%ecx
+  8004f1:	89 c2                	mov    %eax,%edx
+  8004f3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004f6:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8004f9:	8b 45 10             	mov    0x10(%ebp),%eax
+  8004fc:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8004ff:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800502:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800509:	39 c2                	cmp    %eax,%edx
+  80050b:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80050e:	72 3e                	jb     80054e <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800510:	83 ec 0c             	sub    $0xc,%esp
+  800513:	ff 75 18             	push   0x18(%ebp)
+  800516:	83 eb 01             	sub    $0x1,%ebx
+  800519:	53                   	push   %ebx
+  80051a:	50                   	push   %eax
+  80051b:	83 ec 08             	sub    $0x8,%esp
+  80051e:	ff 75 e4             	push   -0x1c(%ebp)
+  800521:	ff 75 e0             	push   -0x20(%ebp)
+  800524:	ff 75 dc             	push   -0x24(%ebp)
+  800527:	ff 75 d8             	push   -0x28(%ebp)
+  80052a:	e8 72 43 00 00       	call   8048a1 <__udivdi3>
+  80052f:	83 c4 18             	add    $0x18,%esp
+  800532:	52                   	push   %edx
+  800533:	50                   	push   %eax
+  800534:	89 f2                	mov    %esi,%edx
+  800536:	89 f8                	mov    %edi,%eax
+  800538:	e8 9f ff ff ff       	call   8004dc <printnum>
+  80053d:	83 c4 20             	add    $0x20,%esp
+  800540:	eb 13                	jmp    800555 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800542:	83 ec 08             	sub    $0x8,%esp
+  800545:	56                   	push   %esi
+  800546:	ff 75 18             	push   0x18(%ebp)
+  800549:	ff d7                	call   *%edi
+  80054b:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80054e:	83 eb 01             	sub    $0x1,%ebx
+  800551:	85 db                	test   %ebx,%ebx
+  800553:	7f ed                	jg     800542 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800555:	83 ec 08             	sub    $0x8,%esp
+  800558:	56                   	push   %esi
+  800559:	83 ec 04             	sub    $0x4,%esp
+  80055c:	ff 75 e4             	push   -0x1c(%ebp)
+  80055f:	ff 75 e0             	push   -0x20(%ebp)
+  800562:	ff 75 dc             	push   -0x24(%ebp)
+  800565:	ff 75 d8             	push   -0x28(%ebp)
+  800568:	e8 55 43 00 00       	call   8048c2 <__umoddi3>
+  80056d:	83 c4 14             	add    $0x14,%esp
+  800570:	0f be 80 b7 4b 80 00 	movsbl 0x804bb7(%eax),%eax
+  800577:	50                   	push   %eax
+  800578:	ff d7                	call   *%edi
+}
+  80057a:	83 c4 10             	add    $0x10,%esp
+  80057d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800580:	5b                   	pop    %ebx
+  800581:	5e                   	pop    %esi
+  800582:	5f                   	pop    %edi
+  800583:	5d                   	pop    %ebp
+  800584:	c3                   	ret
+
+00800585 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800585:	55                   	push   %ebp
+  800586:	89 e5                	mov    %esp,%ebp
+  800588:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80058b:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80058f:	8b 10                	mov    (%eax),%edx
+  800591:	3b 50 04             	cmp    0x4(%eax),%edx
+  800594:	73 0a                	jae    8005a0 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800596:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800599:	89 08                	mov    %ecx,(%eax)
+  80059b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80059e:	88 02                	mov    %al,(%edx)
+}
+  8005a0:	5d                   	pop    %ebp
+  8005a1:	c3                   	ret
+
+008005a2 <printfmt>:
+{
+  8005a2:	55                   	push   %ebp
+  8005a3:	89 e5                	mov    %esp,%ebp
+  8005a5:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8005a8:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8005ab:	50                   	push   %eax
+  8005ac:	ff 75 10             	push   0x10(%ebp)
+  8005af:	ff 75 0c             	push   0xc(%ebp)
+  8005b2:	ff 75 08             	push   0x8(%ebp)
+  8005b5:	e8 05 00 00 00       	call   8005bf <vprintfmt>
+}
+  8005ba:	83 c4 10             	add    $0x10,%esp
+  8005bd:	c9                   	leave
+  8005be:	c3                   	ret
+
+008005bf <vprintfmt>:
+{
+  8005bf:	55                   	push   %ebp
+  8005c0:	89 e5                	mov    %esp,%ebp
+  8005c2:	57                   	push   %edi
+  8005c3:	56                   	push   %esi
+  8005c4:	53                   	push   %ebx
+  8005c5:	83 ec 2c             	sub    $0x2c,%esp
+  8005c8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005cb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8005ce:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8005d1:	eb 0a                	jmp    8005dd <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8005d3:	83 ec 08             	sub    $0x8,%esp
+  8005d6:	53                   	push   %ebx
+  8005d7:	50                   	push   %eax
+  8005d8:	ff d6                	call   *%esi
+  8005da:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  8005dd:	83 c7 01             	add    $0x1,%edi
+  8005e0:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  8005e4:	83 f8 25             	cmp    $0x25,%eax
+  8005e7:	74 0c                	je     8005f5 <vprintfmt+0x36>
+			if (ch == '\0')
+  8005e9:	85 c0                	test   %eax,%eax
+  8005eb:	75 e6                	jne    8005d3 <vprintfmt+0x14>
+}
+  8005ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005f0:	5b                   	pop    %ebx
+  8005f1:	5e                   	pop    %esi
+  8005f2:	5f                   	pop    %edi
+  8005f3:	5d                   	pop    %ebp
+  8005f4:	c3                   	ret
+		padc = ' ';
+  8005f5:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8005f9:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800600:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800607:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80060e:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  800613:	8d 47 01             	lea    0x1(%edi),%eax
+  800616:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800619:	0f b6 17             	movzbl (%edi),%edx
+  80061c:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80061f:	3c 55                	cmp    $0x55,%al
+  800621:	0f 87 c5 03 00 00    	ja     8009ec <vprintfmt+0x42d>
+  800627:	0f b6 c0             	movzbl %al,%eax
+  80062a:	ff 24 85 40 4d 80 00 	jmp    *0x804d40(,%eax,4)
+  800631:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  800634:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800637:	eb da                	jmp    800613 <vprintfmt+0x54>
+  800639:	0f be d2             	movsbl %dl,%edx
+  80063c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80063f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800644:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800647:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80064a:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80064e:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800651:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800654:	83 f9 09             	cmp    $0x9,%ecx
+  800657:	77 55                	ja     8006ae <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  800659:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  80065c:	eb e9                	jmp    800647 <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  80065e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800661:	8b 00                	mov    (%eax),%eax
+  800663:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800666:	8b 45 14             	mov    0x14(%ebp),%eax
+  800669:	8d 40 04             	lea    0x4(%eax),%eax
+  80066c:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  80066f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800672:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800676:	79 9b                	jns    800613 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800678:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80067b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80067e:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800685:	eb 8c                	jmp    800613 <vprintfmt+0x54>
+			if (width < 0)
+  800687:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80068a:	85 d2                	test   %edx,%edx
+  80068c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800691:	0f 49 c2             	cmovns %edx,%eax
+  800694:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  800697:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80069a:	e9 74 ff ff ff       	jmp    800613 <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  80069f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8006a2:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8006a9:	e9 65 ff ff ff       	jmp    800613 <vprintfmt+0x54>
+  8006ae:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8006b1:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8006b4:	eb bc                	jmp    800672 <vprintfmt+0xb3>
+			lflag++;
+  8006b6:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  8006b9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8006bc:	e9 52 ff ff ff       	jmp    800613 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8006c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c4:	8d 78 04             	lea    0x4(%eax),%edi
+  8006c7:	83 ec 08             	sub    $0x8,%esp
+  8006ca:	53                   	push   %ebx
+  8006cb:	ff 30                	push   (%eax)
+  8006cd:	ff d6                	call   *%esi
+			break;
+  8006cf:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8006d2:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8006d5:	e9 b1 02 00 00       	jmp    80098b <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  8006da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006dd:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8006e0:	8b 10                	mov    (%eax),%edx
+  8006e2:	89 d0                	mov    %edx,%eax
+  8006e4:	f7 d8                	neg    %eax
+  8006e6:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8006e9:	83 f8 14             	cmp    $0x14,%eax
+  8006ec:	7f 23                	jg     800711 <vprintfmt+0x152>
+  8006ee:	8b 14 85 a0 4e 80 00 	mov    0x804ea0(,%eax,4),%edx
+  8006f5:	85 d2                	test   %edx,%edx
+  8006f7:	74 18                	je     800711 <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  8006f9:	52                   	push   %edx
+  8006fa:	68 e3 50 80 00       	push   $0x8050e3
+  8006ff:	53                   	push   %ebx
+  800700:	56                   	push   %esi
+  800701:	e8 9c fe ff ff       	call   8005a2 <printfmt>
+  800706:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800709:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80070c:	e9 7a 02 00 00       	jmp    80098b <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  800711:	50                   	push   %eax
+  800712:	68 cf 4b 80 00       	push   $0x804bcf
+  800717:	53                   	push   %ebx
+  800718:	56                   	push   %esi
+  800719:	e8 84 fe ff ff       	call   8005a2 <printfmt>
+  80071e:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800721:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800724:	e9 62 02 00 00       	jmp    80098b <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800729:	8b 45 14             	mov    0x14(%ebp),%eax
+  80072c:	83 c0 04             	add    $0x4,%eax
+  80072f:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800732:	8b 45 14             	mov    0x14(%ebp),%eax
+  800735:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800737:	85 c9                	test   %ecx,%ecx
+  800739:	b8 c8 4b 80 00       	mov    $0x804bc8,%eax
+  80073e:	0f 45 c1             	cmovne %ecx,%eax
+  800741:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800744:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800748:	7e 06                	jle    800750 <vprintfmt+0x191>
+  80074a:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80074e:	75 0b                	jne    80075b <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800750:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800753:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800756:	89 75 08             	mov    %esi,0x8(%ebp)
+  800759:	eb 5c                	jmp    8007b7 <vprintfmt+0x1f8>
+  80075b:	83 ec 08             	sub    $0x8,%esp
+  80075e:	ff 75 d0             	push   -0x30(%ebp)
+  800761:	ff 75 cc             	push   -0x34(%ebp)
+  800764:	e8 20 03 00 00       	call   800a89 <strnlen>
+  800769:	89 c2                	mov    %eax,%edx
+  80076b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80076e:	29 d0                	sub    %edx,%eax
+  800770:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800773:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800777:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80077a:	89 75 08             	mov    %esi,0x8(%ebp)
+  80077d:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80077f:	eb 0e                	jmp    80078f <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  800781:	83 ec 08             	sub    $0x8,%esp
+  800784:	53                   	push   %ebx
+  800785:	57                   	push   %edi
+  800786:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800789:	83 ee 01             	sub    $0x1,%esi
+  80078c:	83 c4 10             	add    $0x10,%esp
+  80078f:	85 f6                	test   %esi,%esi
+  800791:	7f ee                	jg     800781 <vprintfmt+0x1c2>
+  800793:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800796:	8b 75 08             	mov    0x8(%ebp),%esi
+  800799:	85 c0                	test   %eax,%eax
+  80079b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8007a0:	0f 49 d0             	cmovns %eax,%edx
+  8007a3:	29 d0                	sub    %edx,%eax
+  8007a5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8007a8:	eb a6                	jmp    800750 <vprintfmt+0x191>
+					putch(ch, putdat);
+  8007aa:	83 ec 08             	sub    $0x8,%esp
+  8007ad:	53                   	push   %ebx
+  8007ae:	52                   	push   %edx
+  8007af:	ff 55 08             	call   *0x8(%ebp)
+  8007b2:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8007b5:	89 f1                	mov    %esi,%ecx
+  8007b7:	8d 71 01             	lea    0x1(%ecx),%esi
+  8007ba:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8007be:	0f be d0             	movsbl %al,%edx
+  8007c1:	85 d2                	test   %edx,%edx
+  8007c3:	74 28                	je     8007ed <vprintfmt+0x22e>
+  8007c5:	85 ff                	test   %edi,%edi
+  8007c7:	78 05                	js     8007ce <vprintfmt+0x20f>
+  8007c9:	83 ef 01             	sub    $0x1,%edi
+  8007cc:	78 30                	js     8007fe <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8007ce:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8007d2:	74 d6                	je     8007aa <vprintfmt+0x1eb>
+  8007d4:	0f be c0             	movsbl %al,%eax
+  8007d7:	83 e8 20             	sub    $0x20,%eax
+  8007da:	83 f8 5e             	cmp    $0x5e,%eax
+  8007dd:	76 cb                	jbe    8007aa <vprintfmt+0x1eb>
+					putch('?', putdat);
+  8007df:	83 ec 08             	sub    $0x8,%esp
+  8007e2:	53                   	push   %ebx
+  8007e3:	6a 3f                	push   $0x3f
+  8007e5:	ff 55 08             	call   *0x8(%ebp)
+  8007e8:	83 c4 10             	add    $0x10,%esp
+  8007eb:	eb c8                	jmp    8007b5 <vprintfmt+0x1f6>
+  8007ed:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007f0:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8007f3:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8007f6:	01 d0                	add    %edx,%eax
+  8007f8:	29 c8                	sub    %ecx,%eax
+  8007fa:	89 c7                	mov    %eax,%edi
+  8007fc:	eb 13                	jmp    800811 <vprintfmt+0x252>
+  8007fe:	8b 75 08             	mov    0x8(%ebp),%esi
+  800801:	eb ed                	jmp    8007f0 <vprintfmt+0x231>
+				putch(' ', putdat);
+  800803:	83 ec 08             	sub    $0x8,%esp
+  800806:	53                   	push   %ebx
+  800807:	6a 20                	push   $0x20
+  800809:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80080b:	83 ef 01             	sub    $0x1,%edi
+  80080e:	83 c4 10             	add    $0x10,%esp
+  800811:	85 ff                	test   %edi,%edi
+  800813:	7f ee                	jg     800803 <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800815:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800818:	89 45 14             	mov    %eax,0x14(%ebp)
+  80081b:	e9 6b 01 00 00       	jmp    80098b <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  800820:	83 f9 01             	cmp    $0x1,%ecx
+  800823:	7f 1f                	jg     800844 <vprintfmt+0x285>
+	else if (lflag)
+  800825:	85 c9                	test   %ecx,%ecx
+  800827:	74 67                	je     800890 <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  800829:	8b 45 14             	mov    0x14(%ebp),%eax
+  80082c:	8b 00                	mov    (%eax),%eax
+  80082e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800831:	89 c1                	mov    %eax,%ecx
+  800833:	c1 f9 1f             	sar    $0x1f,%ecx
+  800836:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800839:	8b 45 14             	mov    0x14(%ebp),%eax
+  80083c:	8d 40 04             	lea    0x4(%eax),%eax
+  80083f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800842:	eb 17                	jmp    80085b <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  800844:	8b 45 14             	mov    0x14(%ebp),%eax
+  800847:	8b 50 04             	mov    0x4(%eax),%edx
+  80084a:	8b 00                	mov    (%eax),%eax
+  80084c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80084f:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800852:	8b 45 14             	mov    0x14(%ebp),%eax
+  800855:	8d 40 08             	lea    0x8(%eax),%eax
+  800858:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80085b:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80085e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800861:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800866:	85 c9                	test   %ecx,%ecx
+  800868:	0f 89 03 01 00 00    	jns    800971 <vprintfmt+0x3b2>
+				putch('-', putdat);
+  80086e:	83 ec 08             	sub    $0x8,%esp
+  800871:	53                   	push   %ebx
+  800872:	6a 2d                	push   $0x2d
+  800874:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800876:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800879:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80087c:	f7 da                	neg    %edx
+  80087e:	83 d1 00             	adc    $0x0,%ecx
+  800881:	f7 d9                	neg    %ecx
+  800883:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800886:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80088b:	e9 e1 00 00 00       	jmp    800971 <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  800890:	8b 45 14             	mov    0x14(%ebp),%eax
+  800893:	8b 00                	mov    (%eax),%eax
+  800895:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800898:	89 c1                	mov    %eax,%ecx
+  80089a:	c1 f9 1f             	sar    $0x1f,%ecx
+  80089d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8008a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008a3:	8d 40 04             	lea    0x4(%eax),%eax
+  8008a6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008a9:	eb b0                	jmp    80085b <vprintfmt+0x29c>
+	if (lflag >= 2)
+  8008ab:	83 f9 01             	cmp    $0x1,%ecx
+  8008ae:	7f 1e                	jg     8008ce <vprintfmt+0x30f>
+	else if (lflag)
+  8008b0:	85 c9                	test   %ecx,%ecx
+  8008b2:	74 32                	je     8008e6 <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  8008b4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008b7:	8b 10                	mov    (%eax),%edx
+  8008b9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008be:	8d 40 04             	lea    0x4(%eax),%eax
+  8008c1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008c4:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8008c9:	e9 a3 00 00 00       	jmp    800971 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8008ce:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008d1:	8b 10                	mov    (%eax),%edx
+  8008d3:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008d6:	8d 40 08             	lea    0x8(%eax),%eax
+  8008d9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008dc:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8008e1:	e9 8b 00 00 00       	jmp    800971 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8008e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008e9:	8b 10                	mov    (%eax),%edx
+  8008eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008f0:	8d 40 04             	lea    0x4(%eax),%eax
+  8008f3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008f6:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8008fb:	eb 74                	jmp    800971 <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  8008fd:	83 f9 01             	cmp    $0x1,%ecx
+  800900:	7f 1b                	jg     80091d <vprintfmt+0x35e>
+	else if (lflag)
+  800902:	85 c9                	test   %ecx,%ecx
+  800904:	74 2c                	je     800932 <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  800906:	8b 45 14             	mov    0x14(%ebp),%eax
+  800909:	8b 10                	mov    (%eax),%edx
+  80090b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800910:	8d 40 04             	lea    0x4(%eax),%eax
+  800913:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800916:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  80091b:	eb 54                	jmp    800971 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  80091d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800920:	8b 10                	mov    (%eax),%edx
+  800922:	8b 48 04             	mov    0x4(%eax),%ecx
+  800925:	8d 40 08             	lea    0x8(%eax),%eax
+  800928:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80092b:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800930:	eb 3f                	jmp    800971 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800932:	8b 45 14             	mov    0x14(%ebp),%eax
+  800935:	8b 10                	mov    (%eax),%edx
+  800937:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80093c:	8d 40 04             	lea    0x4(%eax),%eax
+  80093f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800942:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800947:	eb 28                	jmp    800971 <vprintfmt+0x3b2>
+			putch('0', putdat);
+  800949:	83 ec 08             	sub    $0x8,%esp
+  80094c:	53                   	push   %ebx
+  80094d:	6a 30                	push   $0x30
+  80094f:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800951:	83 c4 08             	add    $0x8,%esp
+  800954:	53                   	push   %ebx
+  800955:	6a 78                	push   $0x78
+  800957:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800959:	8b 45 14             	mov    0x14(%ebp),%eax
+  80095c:	8b 10                	mov    (%eax),%edx
+  80095e:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800963:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800966:	8d 40 04             	lea    0x4(%eax),%eax
+  800969:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80096c:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800971:	83 ec 0c             	sub    $0xc,%esp
+  800974:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800978:	50                   	push   %eax
+  800979:	ff 75 e0             	push   -0x20(%ebp)
+  80097c:	57                   	push   %edi
+  80097d:	51                   	push   %ecx
+  80097e:	52                   	push   %edx
+  80097f:	89 da                	mov    %ebx,%edx
+  800981:	89 f0                	mov    %esi,%eax
+  800983:	e8 54 fb ff ff       	call   8004dc <printnum>
+			break;
+  800988:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80098b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  80098e:	e9 4a fc ff ff       	jmp    8005dd <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800993:	83 f9 01             	cmp    $0x1,%ecx
+  800996:	7f 1b                	jg     8009b3 <vprintfmt+0x3f4>
+	else if (lflag)
+  800998:	85 c9                	test   %ecx,%ecx
+  80099a:	74 2c                	je     8009c8 <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  80099c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80099f:	8b 10                	mov    (%eax),%edx
+  8009a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009a6:	8d 40 04             	lea    0x4(%eax),%eax
+  8009a9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009ac:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8009b1:	eb be                	jmp    800971 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8009b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009b6:	8b 10                	mov    (%eax),%edx
+  8009b8:	8b 48 04             	mov    0x4(%eax),%ecx
+  8009bb:	8d 40 08             	lea    0x8(%eax),%eax
+  8009be:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009c1:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8009c6:	eb a9                	jmp    800971 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8009c8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009cb:	8b 10                	mov    (%eax),%edx
+  8009cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009d2:	8d 40 04             	lea    0x4(%eax),%eax
+  8009d5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009d8:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8009dd:	eb 92                	jmp    800971 <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  8009df:	83 ec 08             	sub    $0x8,%esp
+  8009e2:	53                   	push   %ebx
+  8009e3:	6a 25                	push   $0x25
+  8009e5:	ff d6                	call   *%esi
+			break;
+  8009e7:	83 c4 10             	add    $0x10,%esp
+  8009ea:	eb 9f                	jmp    80098b <vprintfmt+0x3cc>
+			putch('%', putdat);
+  8009ec:	83 ec 08             	sub    $0x8,%esp
+  8009ef:	53                   	push   %ebx
+  8009f0:	6a 25                	push   $0x25
+  8009f2:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8009f4:	83 c4 10             	add    $0x10,%esp
+  8009f7:	89 f8                	mov    %edi,%eax
+  8009f9:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8009fd:	74 05                	je     800a04 <vprintfmt+0x445>
+  8009ff:	83 e8 01             	sub    $0x1,%eax
+  800a02:	eb f5                	jmp    8009f9 <vprintfmt+0x43a>
+  800a04:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800a07:	eb 82                	jmp    80098b <vprintfmt+0x3cc>
+
+00800a09 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800a09:	55                   	push   %ebp
+  800a0a:	89 e5                	mov    %esp,%ebp
+  800a0c:	83 ec 18             	sub    $0x18,%esp
+  800a0f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a12:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800a15:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800a18:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800a1c:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800a1f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800a26:	85 c0                	test   %eax,%eax
+  800a28:	74 26                	je     800a50 <vsnprintf+0x47>
+  800a2a:	85 d2                	test   %edx,%edx
+  800a2c:	7e 22                	jle    800a50 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800a2e:	ff 75 14             	push   0x14(%ebp)
+  800a31:	ff 75 10             	push   0x10(%ebp)
+  800a34:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800a37:	50                   	push   %eax
+  800a38:	68 85 05 80 00       	push   $0x800585
+  800a3d:	e8 7d fb ff ff       	call   8005bf <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800a42:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800a45:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800a48:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a4b:	83 c4 10             	add    $0x10,%esp
+}
+  800a4e:	c9                   	leave
+  800a4f:	c3                   	ret
+		return -E_INVAL;
+  800a50:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a55:	eb f7                	jmp    800a4e <vsnprintf+0x45>
+
+00800a57 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800a57:	55                   	push   %ebp
+  800a58:	89 e5                	mov    %esp,%ebp
+  800a5a:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800a5d:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800a60:	50                   	push   %eax
+  800a61:	ff 75 10             	push   0x10(%ebp)
+  800a64:	ff 75 0c             	push   0xc(%ebp)
+  800a67:	ff 75 08             	push   0x8(%ebp)
+  800a6a:	e8 9a ff ff ff       	call   800a09 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800a6f:	c9                   	leave
+  800a70:	c3                   	ret
+
+00800a71 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800a71:	55                   	push   %ebp
+  800a72:	89 e5                	mov    %esp,%ebp
+  800a74:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800a77:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a7c:	eb 03                	jmp    800a81 <strlen+0x10>
+		n++;
+  800a7e:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800a81:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800a85:	75 f7                	jne    800a7e <strlen+0xd>
+	return n;
+}
+  800a87:	5d                   	pop    %ebp
+  800a88:	c3                   	ret
+
+00800a89 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800a89:	55                   	push   %ebp
+  800a8a:	89 e5                	mov    %esp,%ebp
+  800a8c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a8f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a92:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a97:	eb 03                	jmp    800a9c <strnlen+0x13>
+		n++;
+  800a99:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a9c:	39 d0                	cmp    %edx,%eax
+  800a9e:	74 08                	je     800aa8 <strnlen+0x1f>
+  800aa0:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800aa4:	75 f3                	jne    800a99 <strnlen+0x10>
+  800aa6:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800aa8:	89 d0                	mov    %edx,%eax
+  800aaa:	5d                   	pop    %ebp
+  800aab:	c3                   	ret
+
+00800aac <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800aac:	55                   	push   %ebp
+  800aad:	89 e5                	mov    %esp,%ebp
+  800aaf:	53                   	push   %ebx
+  800ab0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ab3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800ab6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800abb:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800abf:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800ac2:	83 c0 01             	add    $0x1,%eax
+  800ac5:	84 d2                	test   %dl,%dl
+  800ac7:	75 f2                	jne    800abb <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800ac9:	89 c8                	mov    %ecx,%eax
+  800acb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ace:	c9                   	leave
+  800acf:	c3                   	ret
+
+00800ad0 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800ad0:	55                   	push   %ebp
+  800ad1:	89 e5                	mov    %esp,%ebp
+  800ad3:	53                   	push   %ebx
+  800ad4:	83 ec 10             	sub    $0x10,%esp
+  800ad7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800ada:	53                   	push   %ebx
+  800adb:	e8 91 ff ff ff       	call   800a71 <strlen>
+  800ae0:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800ae3:	ff 75 0c             	push   0xc(%ebp)
+  800ae6:	01 d8                	add    %ebx,%eax
+  800ae8:	50                   	push   %eax
+  800ae9:	e8 be ff ff ff       	call   800aac <strcpy>
+	return dst;
+}
+  800aee:	89 d8                	mov    %ebx,%eax
+  800af0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800af3:	c9                   	leave
+  800af4:	c3                   	ret
+
+00800af5 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800af5:	55                   	push   %ebp
+  800af6:	89 e5                	mov    %esp,%ebp
+  800af8:	56                   	push   %esi
+  800af9:	53                   	push   %ebx
+  800afa:	8b 75 08             	mov    0x8(%ebp),%esi
+  800afd:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800b00:	89 f3                	mov    %esi,%ebx
+  800b02:	03 5d 10             	add    0x10(%ebp),%ebx
+  800b05:	89 f0                	mov    %esi,%eax
+  800b07:	eb 0f                	jmp    800b18 <strncpy+0x23>
+		*dst++ = *src;
+  800b09:	83 c0 01             	add    $0x1,%eax
+  800b0c:	0f b6 0a             	movzbl (%edx),%ecx
+  800b0f:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800b12:	80 f9 01             	cmp    $0x1,%cl
+  800b15:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800b18:	39 d8                	cmp    %ebx,%eax
+  800b1a:	75 ed                	jne    800b09 <strncpy+0x14>
+	}
+	return ret;
+}
+  800b1c:	89 f0                	mov    %esi,%eax
+  800b1e:	5b                   	pop    %ebx
+  800b1f:	5e                   	pop    %esi
+  800b20:	5d                   	pop    %ebp
+  800b21:	c3                   	ret
+
+00800b22 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800b22:	55                   	push   %ebp
+  800b23:	89 e5                	mov    %esp,%ebp
+  800b25:	56                   	push   %esi
+  800b26:	53                   	push   %ebx
+  800b27:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b2a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b2d:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800b30:	89 f0                	mov    %esi,%eax
+  800b32:	85 d2                	test   %edx,%edx
+  800b34:	74 21                	je     800b57 <strlcpy+0x35>
+  800b36:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800b3a:	89 f2                	mov    %esi,%edx
+  800b3c:	eb 09                	jmp    800b47 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800b3e:	83 c1 01             	add    $0x1,%ecx
+  800b41:	83 c2 01             	add    $0x1,%edx
+  800b44:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800b47:	39 c2                	cmp    %eax,%edx
+  800b49:	74 09                	je     800b54 <strlcpy+0x32>
+  800b4b:	0f b6 19             	movzbl (%ecx),%ebx
+  800b4e:	84 db                	test   %bl,%bl
+  800b50:	75 ec                	jne    800b3e <strlcpy+0x1c>
+  800b52:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800b54:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800b57:	29 f0                	sub    %esi,%eax
+}
+  800b59:	5b                   	pop    %ebx
+  800b5a:	5e                   	pop    %esi
+  800b5b:	5d                   	pop    %ebp
+  800b5c:	c3                   	ret
+
+00800b5d <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800b5d:	55                   	push   %ebp
+  800b5e:	89 e5                	mov    %esp,%ebp
+  800b60:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b63:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800b66:	eb 06                	jmp    800b6e <strcmp+0x11>
+		p++, q++;
+  800b68:	83 c1 01             	add    $0x1,%ecx
+  800b6b:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800b6e:	0f b6 01             	movzbl (%ecx),%eax
+  800b71:	84 c0                	test   %al,%al
+  800b73:	74 04                	je     800b79 <strcmp+0x1c>
+  800b75:	3a 02                	cmp    (%edx),%al
+  800b77:	74 ef                	je     800b68 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b79:	0f b6 c0             	movzbl %al,%eax
+  800b7c:	0f b6 12             	movzbl (%edx),%edx
+  800b7f:	29 d0                	sub    %edx,%eax
+}
+  800b81:	5d                   	pop    %ebp
+  800b82:	c3                   	ret
+
+00800b83 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800b83:	55                   	push   %ebp
+  800b84:	89 e5                	mov    %esp,%ebp
+  800b86:	53                   	push   %ebx
+  800b87:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b8a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b8d:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800b90:	eb 09                	jmp    800b9b <strncmp+0x18>
+		n--, p++, q++;
+  800b92:	83 ea 01             	sub    $0x1,%edx
+  800b95:	83 c0 01             	add    $0x1,%eax
+  800b98:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800b9b:	85 d2                	test   %edx,%edx
+  800b9d:	74 18                	je     800bb7 <strncmp+0x34>
+  800b9f:	0f b6 18             	movzbl (%eax),%ebx
+  800ba2:	84 db                	test   %bl,%bl
+  800ba4:	74 04                	je     800baa <strncmp+0x27>
+  800ba6:	3a 19                	cmp    (%ecx),%bl
+  800ba8:	74 e8                	je     800b92 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800baa:	0f b6 00             	movzbl (%eax),%eax
+  800bad:	0f b6 11             	movzbl (%ecx),%edx
+  800bb0:	29 d0                	sub    %edx,%eax
+}
+  800bb2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bb5:	c9                   	leave
+  800bb6:	c3                   	ret
+		return 0;
+  800bb7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bbc:	eb f4                	jmp    800bb2 <strncmp+0x2f>
+
+00800bbe <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800bbe:	55                   	push   %ebp
+  800bbf:	89 e5                	mov    %esp,%ebp
+  800bc1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bc4:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800bc8:	eb 03                	jmp    800bcd <strchr+0xf>
+  800bca:	83 c0 01             	add    $0x1,%eax
+  800bcd:	0f b6 10             	movzbl (%eax),%edx
+  800bd0:	84 d2                	test   %dl,%dl
+  800bd2:	74 06                	je     800bda <strchr+0x1c>
+		if (*s == c)
+  800bd4:	38 ca                	cmp    %cl,%dl
+  800bd6:	75 f2                	jne    800bca <strchr+0xc>
+  800bd8:	eb 05                	jmp    800bdf <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800bda:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800bdf:	5d                   	pop    %ebp
+  800be0:	c3                   	ret
+
+00800be1 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800be1:	55                   	push   %ebp
+  800be2:	89 e5                	mov    %esp,%ebp
+  800be4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800be7:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800beb:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800bee:	38 ca                	cmp    %cl,%dl
+  800bf0:	74 09                	je     800bfb <strfind+0x1a>
+  800bf2:	84 d2                	test   %dl,%dl
+  800bf4:	74 05                	je     800bfb <strfind+0x1a>
+	for (; *s; s++)
+  800bf6:	83 c0 01             	add    $0x1,%eax
+  800bf9:	eb f0                	jmp    800beb <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800bfb:	5d                   	pop    %ebp
+  800bfc:	c3                   	ret
+
+00800bfd <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800bfd:	55                   	push   %ebp
+  800bfe:	89 e5                	mov    %esp,%ebp
+  800c00:	57                   	push   %edi
+  800c01:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800c04:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800c07:	85 c9                	test   %ecx,%ecx
+  800c09:	74 20                	je     800c2b <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800c0b:	89 f8                	mov    %edi,%eax
+  800c0d:	09 c8                	or     %ecx,%eax
+  800c0f:	a8 03                	test   $0x3,%al
+  800c11:	75 12                	jne    800c25 <memset+0x28>
+		c &= 0xFF;
+  800c13:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800c17:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800c1d:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800c20:	fc                   	cld
+  800c21:	f3 ab                	rep stos %eax,%es:(%edi)
+  800c23:	eb 06                	jmp    800c2b <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800c25:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c28:	fc                   	cld
+  800c29:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800c2b:	89 f8                	mov    %edi,%eax
+  800c2d:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800c30:	c9                   	leave
+  800c31:	c3                   	ret
+
+00800c32 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800c32:	55                   	push   %ebp
+  800c33:	89 e5                	mov    %esp,%ebp
+  800c35:	57                   	push   %edi
+  800c36:	56                   	push   %esi
+  800c37:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c3a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c3d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800c40:	39 c6                	cmp    %eax,%esi
+  800c42:	73 32                	jae    800c76 <memmove+0x44>
+  800c44:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800c47:	39 d0                	cmp    %edx,%eax
+  800c49:	73 2b                	jae    800c76 <memmove+0x44>
+		s += n;
+		d += n;
+  800c4b:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c4e:	89 d6                	mov    %edx,%esi
+  800c50:	09 fe                	or     %edi,%esi
+  800c52:	09 ce                	or     %ecx,%esi
+  800c54:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800c5a:	75 0e                	jne    800c6a <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800c5c:	83 ef 04             	sub    $0x4,%edi
+  800c5f:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800c62:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800c65:	fd                   	std
+  800c66:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c68:	eb 09                	jmp    800c73 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800c6a:	83 ef 01             	sub    $0x1,%edi
+  800c6d:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800c70:	fd                   	std
+  800c71:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800c73:	fc                   	cld
+  800c74:	eb 1a                	jmp    800c90 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c76:	89 f2                	mov    %esi,%edx
+  800c78:	09 c2                	or     %eax,%edx
+  800c7a:	09 ca                	or     %ecx,%edx
+  800c7c:	f6 c2 03             	test   $0x3,%dl
+  800c7f:	75 0a                	jne    800c8b <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800c81:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800c84:	89 c7                	mov    %eax,%edi
+  800c86:	fc                   	cld
+  800c87:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c89:	eb 05                	jmp    800c90 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800c8b:	89 c7                	mov    %eax,%edi
+  800c8d:	fc                   	cld
+  800c8e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800c90:	5e                   	pop    %esi
+  800c91:	5f                   	pop    %edi
+  800c92:	5d                   	pop    %ebp
+  800c93:	c3                   	ret
+
+00800c94 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800c94:	55                   	push   %ebp
+  800c95:	89 e5                	mov    %esp,%ebp
+  800c97:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800c9a:	ff 75 10             	push   0x10(%ebp)
+  800c9d:	ff 75 0c             	push   0xc(%ebp)
+  800ca0:	ff 75 08             	push   0x8(%ebp)
+  800ca3:	e8 8a ff ff ff       	call   800c32 <memmove>
+}
+  800ca8:	c9                   	leave
+  800ca9:	c3                   	ret
+
+00800caa <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800caa:	55                   	push   %ebp
+  800cab:	89 e5                	mov    %esp,%ebp
+  800cad:	56                   	push   %esi
+  800cae:	53                   	push   %ebx
+  800caf:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cb2:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800cb5:	89 c6                	mov    %eax,%esi
+  800cb7:	03 75 10             	add    0x10(%ebp),%esi
+  800cba:	eb 06                	jmp    800cc2 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800cbc:	83 c0 01             	add    $0x1,%eax
+  800cbf:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800cc2:	39 f0                	cmp    %esi,%eax
+  800cc4:	74 14                	je     800cda <memcmp+0x30>
+		if (*s1 != *s2)
+  800cc6:	0f b6 08             	movzbl (%eax),%ecx
+  800cc9:	0f b6 1a             	movzbl (%edx),%ebx
+  800ccc:	38 d9                	cmp    %bl,%cl
+  800cce:	74 ec                	je     800cbc <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800cd0:	0f b6 c1             	movzbl %cl,%eax
+  800cd3:	0f b6 db             	movzbl %bl,%ebx
+  800cd6:	29 d8                	sub    %ebx,%eax
+  800cd8:	eb 05                	jmp    800cdf <memcmp+0x35>
+	}
+
+	return 0;
+  800cda:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800cdf:	5b                   	pop    %ebx
+  800ce0:	5e                   	pop    %esi
+  800ce1:	5d                   	pop    %ebp
+  800ce2:	c3                   	ret
+
+00800ce3 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800ce3:	55                   	push   %ebp
+  800ce4:	89 e5                	mov    %esp,%ebp
+  800ce6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ce9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800cec:	89 c2                	mov    %eax,%edx
+  800cee:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800cf1:	eb 03                	jmp    800cf6 <memfind+0x13>
+  800cf3:	83 c0 01             	add    $0x1,%eax
+  800cf6:	39 d0                	cmp    %edx,%eax
+  800cf8:	73 04                	jae    800cfe <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800cfa:	38 08                	cmp    %cl,(%eax)
+  800cfc:	75 f5                	jne    800cf3 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800cfe:	5d                   	pop    %ebp
+  800cff:	c3                   	ret
+
+00800d00 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800d00:	55                   	push   %ebp
+  800d01:	89 e5                	mov    %esp,%ebp
+  800d03:	57                   	push   %edi
+  800d04:	56                   	push   %esi
+  800d05:	53                   	push   %ebx
+  800d06:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d09:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800d0c:	eb 03                	jmp    800d11 <strtol+0x11>
+		s++;
+  800d0e:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800d11:	0f b6 02             	movzbl (%edx),%eax
+  800d14:	3c 20                	cmp    $0x20,%al
+  800d16:	74 f6                	je     800d0e <strtol+0xe>
+  800d18:	3c 09                	cmp    $0x9,%al
+  800d1a:	74 f2                	je     800d0e <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800d1c:	3c 2b                	cmp    $0x2b,%al
+  800d1e:	74 2a                	je     800d4a <strtol+0x4a>
+	int neg = 0;
+  800d20:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800d25:	3c 2d                	cmp    $0x2d,%al
+  800d27:	74 2b                	je     800d54 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d29:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800d2f:	75 0f                	jne    800d40 <strtol+0x40>
+  800d31:	80 3a 30             	cmpb   $0x30,(%edx)
+  800d34:	74 28                	je     800d5e <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800d36:	85 db                	test   %ebx,%ebx
+  800d38:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d3d:	0f 44 d8             	cmove  %eax,%ebx
+  800d40:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d45:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800d48:	eb 46                	jmp    800d90 <strtol+0x90>
+		s++;
+  800d4a:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800d4d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d52:	eb d5                	jmp    800d29 <strtol+0x29>
+		s++, neg = 1;
+  800d54:	83 c2 01             	add    $0x1,%edx
+  800d57:	bf 01 00 00 00       	mov    $0x1,%edi
+  800d5c:	eb cb                	jmp    800d29 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d5e:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800d62:	74 0e                	je     800d72 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800d64:	85 db                	test   %ebx,%ebx
+  800d66:	75 d8                	jne    800d40 <strtol+0x40>
+		s++, base = 8;
+  800d68:	83 c2 01             	add    $0x1,%edx
+  800d6b:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800d70:	eb ce                	jmp    800d40 <strtol+0x40>
+		s += 2, base = 16;
+  800d72:	83 c2 02             	add    $0x2,%edx
+  800d75:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800d7a:	eb c4                	jmp    800d40 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800d7c:	0f be c0             	movsbl %al,%eax
+  800d7f:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800d82:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800d85:	7d 3a                	jge    800dc1 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800d87:	83 c2 01             	add    $0x1,%edx
+  800d8a:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800d8e:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800d90:	0f b6 02             	movzbl (%edx),%eax
+  800d93:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800d96:	89 f3                	mov    %esi,%ebx
+  800d98:	80 fb 09             	cmp    $0x9,%bl
+  800d9b:	76 df                	jbe    800d7c <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800d9d:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800da0:	89 f3                	mov    %esi,%ebx
+  800da2:	80 fb 19             	cmp    $0x19,%bl
+  800da5:	77 08                	ja     800daf <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800da7:	0f be c0             	movsbl %al,%eax
+  800daa:	83 e8 57             	sub    $0x57,%eax
+  800dad:	eb d3                	jmp    800d82 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800daf:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800db2:	89 f3                	mov    %esi,%ebx
+  800db4:	80 fb 19             	cmp    $0x19,%bl
+  800db7:	77 08                	ja     800dc1 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800db9:	0f be c0             	movsbl %al,%eax
+  800dbc:	83 e8 37             	sub    $0x37,%eax
+  800dbf:	eb c1                	jmp    800d82 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800dc1:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800dc5:	74 05                	je     800dcc <strtol+0xcc>
+		*endptr = (char *) s;
+  800dc7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800dca:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800dcc:	89 c8                	mov    %ecx,%eax
+  800dce:	f7 d8                	neg    %eax
+  800dd0:	85 ff                	test   %edi,%edi
+  800dd2:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800dd5:	89 c8                	mov    %ecx,%eax
+  800dd7:	5b                   	pop    %ebx
+  800dd8:	5e                   	pop    %esi
+  800dd9:	5f                   	pop    %edi
+  800dda:	5d                   	pop    %ebp
+  800ddb:	c3                   	ret
+
+00800ddc <atoi>:
+
+int
+atoi(const char* s)
+{
+  800ddc:	55                   	push   %ebp
+  800ddd:	89 e5                	mov    %esp,%ebp
+  800ddf:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  800de2:	6a 00                	push   $0x0
+  800de4:	6a 00                	push   $0x0
+  800de6:	ff 75 08             	push   0x8(%ebp)
+  800de9:	e8 12 ff ff ff       	call   800d00 <strtol>
+}
+  800dee:	c9                   	leave
+  800def:	c3                   	ret
+
+00800df0 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800df0:	55                   	push   %ebp
+  800df1:	89 e5                	mov    %esp,%ebp
+  800df3:	57                   	push   %edi
+  800df4:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800df5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dfa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dfd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e00:	89 c3                	mov    %eax,%ebx
+  800e02:	89 c7                	mov    %eax,%edi
+  800e04:	6a 00                	push   $0x0
+  800e06:	55                   	push   %ebp
+  800e07:	56                   	push   %esi
+  800e08:	89 e5                	mov    %esp,%ebp
+  800e0a:	8d 35 12 0e 80 00    	lea    0x800e12,%esi
+  800e10:	0f 34                	sysenter
+
+00800e12 <after_sysenter_label_47>:
+  800e12:	5e                   	pop    %esi
+  800e13:	5d                   	pop    %ebp
+  800e14:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800e17:	5b                   	pop    %ebx
+  800e18:	5f                   	pop    %edi
+  800e19:	5d                   	pop    %ebp
+  800e1a:	c3                   	ret
+
+00800e1b <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800e1b:	55                   	push   %ebp
+  800e1c:	89 e5                	mov    %esp,%ebp
+  800e1e:	57                   	push   %edi
+  800e1f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e20:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e25:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e2a:	89 d1                	mov    %edx,%ecx
+  800e2c:	89 d3                	mov    %edx,%ebx
+  800e2e:	89 d7                	mov    %edx,%edi
+  800e30:	6a 00                	push   $0x0
+  800e32:	55                   	push   %ebp
+  800e33:	56                   	push   %esi
+  800e34:	89 e5                	mov    %esp,%ebp
+  800e36:	8d 35 3e 0e 80 00    	lea    0x800e3e,%esi
+  800e3c:	0f 34                	sysenter
+
+00800e3e <after_sysenter_label_128>:
+  800e3e:	5e                   	pop    %esi
+  800e3f:	5d                   	pop    %ebp
+  800e40:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800e43:	5b                   	pop    %ebx
+  800e44:	5f                   	pop    %edi
+  800e45:	5d                   	pop    %ebp
+  800e46:	c3                   	ret
+
+00800e47 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800e47:	55                   	push   %ebp
+  800e48:	89 e5                	mov    %esp,%ebp
+  800e4a:	57                   	push   %edi
+  800e4b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e4c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e4f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e54:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e59:	89 cb                	mov    %ecx,%ebx
+  800e5b:	89 cf                	mov    %ecx,%edi
+  800e5d:	6a 00                	push   $0x0
+  800e5f:	55                   	push   %ebp
+  800e60:	56                   	push   %esi
+  800e61:	89 e5                	mov    %esp,%ebp
+  800e63:	8d 35 6b 0e 80 00    	lea    0x800e6b,%esi
+  800e69:	0f 34                	sysenter
+
+00800e6b <after_sysenter_label_212>:
+  800e6b:	5e                   	pop    %esi
+  800e6c:	5d                   	pop    %ebp
+  800e6d:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e70:	85 c0                	test   %eax,%eax
+  800e72:	7f 07                	jg     800e7b <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800e74:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e77:	5b                   	pop    %ebx
+  800e78:	5f                   	pop    %edi
+  800e79:	5d                   	pop    %ebp
+  800e7a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e7b:	83 ec 0c             	sub    $0xc,%esp
+  800e7e:	50                   	push   %eax
+  800e7f:	6a 03                	push   $0x3
+  800e81:	68 35 4f 80 00       	push   $0x804f35
+  800e86:	6a 54                	push   $0x54
+  800e88:	68 52 4f 80 00       	push   $0x804f52
+  800e8d:	e8 5b f5 ff ff       	call   8003ed <_panic>
+
+00800e92 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800e92:	55                   	push   %ebp
+  800e93:	89 e5                	mov    %esp,%ebp
+  800e95:	57                   	push   %edi
+  800e96:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e97:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e9c:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ea1:	89 d1                	mov    %edx,%ecx
+  800ea3:	89 d3                	mov    %edx,%ebx
+  800ea5:	89 d7                	mov    %edx,%edi
+  800ea7:	6a 00                	push   $0x0
+  800ea9:	55                   	push   %ebp
+  800eaa:	56                   	push   %esi
+  800eab:	89 e5                	mov    %esp,%ebp
+  800ead:	8d 35 b5 0e 80 00    	lea    0x800eb5,%esi
+  800eb3:	0f 34                	sysenter
+
+00800eb5 <after_sysenter_label_309>:
+  800eb5:	5e                   	pop    %esi
+  800eb6:	5d                   	pop    %ebp
+  800eb7:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800eba:	5b                   	pop    %ebx
+  800ebb:	5f                   	pop    %edi
+  800ebc:	5d                   	pop    %ebp
+  800ebd:	c3                   	ret
+
+00800ebe <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800ebe:	55                   	push   %ebp
+  800ebf:	89 e5                	mov    %esp,%ebp
+  800ec1:	57                   	push   %edi
+  800ec2:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ec3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ec8:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800ecd:	89 d1                	mov    %edx,%ecx
+  800ecf:	89 d3                	mov    %edx,%ebx
+  800ed1:	89 d7                	mov    %edx,%edi
+  800ed3:	6a 00                	push   $0x0
+  800ed5:	55                   	push   %ebp
+  800ed6:	56                   	push   %esi
+  800ed7:	89 e5                	mov    %esp,%ebp
+  800ed9:	8d 35 e1 0e 80 00    	lea    0x800ee1,%esi
+  800edf:	0f 34                	sysenter
+
+00800ee1 <after_sysenter_label_391>:
+  800ee1:	5e                   	pop    %esi
+  800ee2:	5d                   	pop    %ebp
+  800ee3:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800ee6:	5b                   	pop    %ebx
+  800ee7:	5f                   	pop    %edi
+  800ee8:	5d                   	pop    %ebp
+  800ee9:	c3                   	ret
+
+00800eea <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800eea:	55                   	push   %ebp
+  800eeb:	89 e5                	mov    %esp,%ebp
+  800eed:	57                   	push   %edi
+  800eee:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800eef:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef5:	b8 04 00 00 00       	mov    $0x4,%eax
+  800efa:	bf 00 00 00 00       	mov    $0x0,%edi
+  800eff:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f02:	6a 00                	push   $0x0
+  800f04:	55                   	push   %ebp
+  800f05:	56                   	push   %esi
+  800f06:	89 e5                	mov    %esp,%ebp
+  800f08:	8d 35 10 0f 80 00    	lea    0x800f10,%esi
+  800f0e:	0f 34                	sysenter
+
+00800f10 <after_sysenter_label_479>:
+  800f10:	5e                   	pop    %esi
+  800f11:	5d                   	pop    %ebp
+  800f12:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800f15:	85 c0                	test   %eax,%eax
+  800f17:	7f 07                	jg     800f20 <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800f19:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f1c:	5b                   	pop    %ebx
+  800f1d:	5f                   	pop    %edi
+  800f1e:	5d                   	pop    %ebp
+  800f1f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f20:	83 ec 0c             	sub    $0xc,%esp
+  800f23:	50                   	push   %eax
+  800f24:	6a 04                	push   $0x4
+  800f26:	68 35 4f 80 00       	push   $0x804f35
+  800f2b:	6a 54                	push   $0x54
+  800f2d:	68 52 4f 80 00       	push   $0x804f52
+  800f32:	e8 b6 f4 ff ff       	call   8003ed <_panic>
+
+00800f37 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800f37:	55                   	push   %ebp
+  800f38:	89 e5                	mov    %esp,%ebp
+  800f3a:	57                   	push   %edi
+  800f3b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f3c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f3f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f42:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f47:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f4a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f4d:	ff 75 18             	push   0x18(%ebp)
+  800f50:	55                   	push   %ebp
+  800f51:	56                   	push   %esi
+  800f52:	89 e5                	mov    %esp,%ebp
+  800f54:	8d 35 5c 0f 80 00    	lea    0x800f5c,%esi
+  800f5a:	0f 34                	sysenter
+
+00800f5c <after_sysenter_label_593>:
+  800f5c:	5e                   	pop    %esi
+  800f5d:	5d                   	pop    %ebp
+  800f5e:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800f61:	85 c0                	test   %eax,%eax
+  800f63:	7f 07                	jg     800f6c <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800f65:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f68:	5b                   	pop    %ebx
+  800f69:	5f                   	pop    %edi
+  800f6a:	5d                   	pop    %ebp
+  800f6b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f6c:	83 ec 0c             	sub    $0xc,%esp
+  800f6f:	50                   	push   %eax
+  800f70:	6a 05                	push   $0x5
+  800f72:	68 35 4f 80 00       	push   $0x804f35
+  800f77:	6a 54                	push   $0x54
+  800f79:	68 52 4f 80 00       	push   $0x804f52
+  800f7e:	e8 6a f4 ff ff       	call   8003ed <_panic>
+
+00800f83 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800f83:	55                   	push   %ebp
+  800f84:	89 e5                	mov    %esp,%ebp
+  800f86:	57                   	push   %edi
+  800f87:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f88:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f8d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f90:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f93:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f98:	89 df                	mov    %ebx,%edi
+  800f9a:	6a 00                	push   $0x0
+  800f9c:	55                   	push   %ebp
+  800f9d:	56                   	push   %esi
+  800f9e:	89 e5                	mov    %esp,%ebp
+  800fa0:	8d 35 a8 0f 80 00    	lea    0x800fa8,%esi
+  800fa6:	0f 34                	sysenter
+
+00800fa8 <after_sysenter_label_704>:
+  800fa8:	5e                   	pop    %esi
+  800fa9:	5d                   	pop    %ebp
+  800faa:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800fad:	85 c0                	test   %eax,%eax
+  800faf:	7f 07                	jg     800fb8 <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800fb1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fb4:	5b                   	pop    %ebx
+  800fb5:	5f                   	pop    %edi
+  800fb6:	5d                   	pop    %ebp
+  800fb7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fb8:	83 ec 0c             	sub    $0xc,%esp
+  800fbb:	50                   	push   %eax
+  800fbc:	6a 06                	push   $0x6
+  800fbe:	68 35 4f 80 00       	push   $0x804f35
+  800fc3:	6a 54                	push   $0x54
+  800fc5:	68 52 4f 80 00       	push   $0x804f52
+  800fca:	e8 1e f4 ff ff       	call   8003ed <_panic>
+
+00800fcf <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800fcf:	55                   	push   %ebp
+  800fd0:	89 e5                	mov    %esp,%ebp
+  800fd2:	57                   	push   %edi
+  800fd3:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fd4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fd9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fdc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fdf:	b8 08 00 00 00       	mov    $0x8,%eax
+  800fe4:	89 df                	mov    %ebx,%edi
+  800fe6:	6a 00                	push   $0x0
+  800fe8:	55                   	push   %ebp
+  800fe9:	56                   	push   %esi
+  800fea:	89 e5                	mov    %esp,%ebp
+  800fec:	8d 35 f4 0f 80 00    	lea    0x800ff4,%esi
+  800ff2:	0f 34                	sysenter
+
+00800ff4 <after_sysenter_label_808>:
+  800ff4:	5e                   	pop    %esi
+  800ff5:	5d                   	pop    %ebp
+  800ff6:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800ff9:	85 c0                	test   %eax,%eax
+  800ffb:	7f 07                	jg     801004 <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800ffd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801000:	5b                   	pop    %ebx
+  801001:	5f                   	pop    %edi
+  801002:	5d                   	pop    %ebp
+  801003:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801004:	83 ec 0c             	sub    $0xc,%esp
+  801007:	50                   	push   %eax
+  801008:	6a 08                	push   $0x8
+  80100a:	68 35 4f 80 00       	push   $0x804f35
+  80100f:	6a 54                	push   $0x54
+  801011:	68 52 4f 80 00       	push   $0x804f52
+  801016:	e8 d2 f3 ff ff       	call   8003ed <_panic>
+
+0080101b <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80101b:	55                   	push   %ebp
+  80101c:	89 e5                	mov    %esp,%ebp
+  80101e:	57                   	push   %edi
+  80101f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801020:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801025:	8b 55 08             	mov    0x8(%ebp),%edx
+  801028:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80102b:	b8 09 00 00 00       	mov    $0x9,%eax
+  801030:	89 df                	mov    %ebx,%edi
+  801032:	6a 00                	push   $0x0
+  801034:	55                   	push   %ebp
+  801035:	56                   	push   %esi
+  801036:	89 e5                	mov    %esp,%ebp
+  801038:	8d 35 40 10 80 00    	lea    0x801040,%esi
+  80103e:	0f 34                	sysenter
+
+00801040 <after_sysenter_label_912>:
+  801040:	5e                   	pop    %esi
+  801041:	5d                   	pop    %ebp
+  801042:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801045:	85 c0                	test   %eax,%eax
+  801047:	7f 07                	jg     801050 <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801049:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80104c:	5b                   	pop    %ebx
+  80104d:	5f                   	pop    %edi
+  80104e:	5d                   	pop    %ebp
+  80104f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801050:	83 ec 0c             	sub    $0xc,%esp
+  801053:	50                   	push   %eax
+  801054:	6a 09                	push   $0x9
+  801056:	68 35 4f 80 00       	push   $0x804f35
+  80105b:	6a 54                	push   $0x54
+  80105d:	68 52 4f 80 00       	push   $0x804f52
+  801062:	e8 86 f3 ff ff       	call   8003ed <_panic>
+
+00801067 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801067:	55                   	push   %ebp
+  801068:	89 e5                	mov    %esp,%ebp
+  80106a:	57                   	push   %edi
+  80106b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80106c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801071:	8b 55 08             	mov    0x8(%ebp),%edx
+  801074:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801077:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80107c:	89 df                	mov    %ebx,%edi
+  80107e:	6a 00                	push   $0x0
+  801080:	55                   	push   %ebp
+  801081:	56                   	push   %esi
+  801082:	89 e5                	mov    %esp,%ebp
+  801084:	8d 35 8c 10 80 00    	lea    0x80108c,%esi
+  80108a:	0f 34                	sysenter
+
+0080108c <after_sysenter_label_1016>:
+  80108c:	5e                   	pop    %esi
+  80108d:	5d                   	pop    %ebp
+  80108e:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801091:	85 c0                	test   %eax,%eax
+  801093:	7f 07                	jg     80109c <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801095:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801098:	5b                   	pop    %ebx
+  801099:	5f                   	pop    %edi
+  80109a:	5d                   	pop    %ebp
+  80109b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80109c:	83 ec 0c             	sub    $0xc,%esp
+  80109f:	50                   	push   %eax
+  8010a0:	6a 0a                	push   $0xa
+  8010a2:	68 35 4f 80 00       	push   $0x804f35
+  8010a7:	6a 54                	push   $0x54
+  8010a9:	68 52 4f 80 00       	push   $0x804f52
+  8010ae:	e8 3a f3 ff ff       	call   8003ed <_panic>
+
+008010b3 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8010b3:	55                   	push   %ebp
+  8010b4:	89 e5                	mov    %esp,%ebp
+  8010b6:	57                   	push   %edi
+  8010b7:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010bb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010be:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010c3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010c6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010c9:	6a 00                	push   $0x0
+  8010cb:	55                   	push   %ebp
+  8010cc:	56                   	push   %esi
+  8010cd:	89 e5                	mov    %esp,%ebp
+  8010cf:	8d 35 d7 10 80 00    	lea    0x8010d7,%esi
+  8010d5:	0f 34                	sysenter
+
+008010d7 <after_sysenter_label_1126>:
+  8010d7:	5e                   	pop    %esi
+  8010d8:	5d                   	pop    %ebp
+  8010d9:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8010dc:	5b                   	pop    %ebx
+  8010dd:	5f                   	pop    %edi
+  8010de:	5d                   	pop    %ebp
+  8010df:	c3                   	ret
+
+008010e0 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8010e0:	55                   	push   %ebp
+  8010e1:	89 e5                	mov    %esp,%ebp
+  8010e3:	57                   	push   %edi
+  8010e4:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010e5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010ed:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8010f2:	89 cb                	mov    %ecx,%ebx
+  8010f4:	89 cf                	mov    %ecx,%edi
+  8010f6:	6a 00                	push   $0x0
+  8010f8:	55                   	push   %ebp
+  8010f9:	56                   	push   %esi
+  8010fa:	89 e5                	mov    %esp,%ebp
+  8010fc:	8d 35 04 11 80 00    	lea    0x801104,%esi
+  801102:	0f 34                	sysenter
+
+00801104 <after_sysenter_label_1210>:
+  801104:	5e                   	pop    %esi
+  801105:	5d                   	pop    %ebp
+  801106:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801109:	85 c0                	test   %eax,%eax
+  80110b:	7f 07                	jg     801114 <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  80110d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801110:	5b                   	pop    %ebx
+  801111:	5f                   	pop    %edi
+  801112:	5d                   	pop    %ebp
+  801113:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801114:	83 ec 0c             	sub    $0xc,%esp
+  801117:	50                   	push   %eax
+  801118:	6a 0d                	push   $0xd
+  80111a:	68 35 4f 80 00       	push   $0x804f35
+  80111f:	6a 54                	push   $0x54
+  801121:	68 52 4f 80 00       	push   $0x804f52
+  801126:	e8 c2 f2 ff ff       	call   8003ed <_panic>
+
+0080112b <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  80112b:	55                   	push   %ebp
+  80112c:	89 e5                	mov    %esp,%ebp
+  80112e:	57                   	push   %edi
+  80112f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801130:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801135:	8b 55 08             	mov    0x8(%ebp),%edx
+  801138:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80113b:	b8 42 00 00 00       	mov    $0x42,%eax
+  801140:	89 df                	mov    %ebx,%edi
+  801142:	6a 00                	push   $0x0
+  801144:	55                   	push   %ebp
+  801145:	56                   	push   %esi
+  801146:	89 e5                	mov    %esp,%ebp
+  801148:	8d 35 50 11 80 00    	lea    0x801150,%esi
+  80114e:	0f 34                	sysenter
+
+00801150 <after_sysenter_label_1311>:
+  801150:	5e                   	pop    %esi
+  801151:	5d                   	pop    %ebp
+  801152:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801155:	85 c0                	test   %eax,%eax
+  801157:	7f 07                	jg     801160 <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  801159:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80115c:	5b                   	pop    %ebx
+  80115d:	5f                   	pop    %edi
+  80115e:	5d                   	pop    %ebp
+  80115f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801160:	83 ec 0c             	sub    $0xc,%esp
+  801163:	50                   	push   %eax
+  801164:	6a 42                	push   $0x42
+  801166:	68 35 4f 80 00       	push   $0x804f35
+  80116b:	6a 54                	push   $0x54
+  80116d:	68 52 4f 80 00       	push   $0x804f52
+  801172:	e8 76 f2 ff ff       	call   8003ed <_panic>
+
+00801177 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801177:	55                   	push   %ebp
+  801178:	89 e5                	mov    %esp,%ebp
+  80117a:	57                   	push   %edi
+  80117b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80117c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801181:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801186:	89 d1                	mov    %edx,%ecx
+  801188:	89 d3                	mov    %edx,%ebx
+  80118a:	89 d7                	mov    %edx,%edi
+  80118c:	6a 00                	push   $0x0
+  80118e:	55                   	push   %ebp
+  80118f:	56                   	push   %esi
+  801190:	89 e5                	mov    %esp,%ebp
+  801192:	8d 35 9a 11 80 00    	lea    0x80119a,%esi
+  801198:	0f 34                	sysenter
+
+0080119a <after_sysenter_label_1411>:
+  80119a:	5e                   	pop    %esi
+  80119b:	5d                   	pop    %ebp
+  80119c:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80119f:	5b                   	pop    %ebx
+  8011a0:	5f                   	pop    %edi
+  8011a1:	5d                   	pop    %ebp
+  8011a2:	c3                   	ret
+
+008011a3 <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  8011a3:	55                   	push   %ebp
+  8011a4:	89 e5                	mov    %esp,%ebp
+  8011a6:	57                   	push   %edi
+  8011a7:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8011a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011b0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011b3:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8011b8:	89 df                	mov    %ebx,%edi
+  8011ba:	6a 00                	push   $0x0
+  8011bc:	55                   	push   %ebp
+  8011bd:	56                   	push   %esi
+  8011be:	89 e5                	mov    %esp,%ebp
+  8011c0:	8d 35 c8 11 80 00    	lea    0x8011c8,%esi
+  8011c6:	0f 34                	sysenter
+
+008011c8 <after_sysenter_label_1497>:
+  8011c8:	5e                   	pop    %esi
+  8011c9:	5d                   	pop    %ebp
+  8011ca:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  8011cd:	5b                   	pop    %ebx
+  8011ce:	5f                   	pop    %edi
+  8011cf:	5d                   	pop    %ebp
+  8011d0:	c3                   	ret
+
+008011d1 <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  8011d1:	55                   	push   %ebp
+  8011d2:	89 e5                	mov    %esp,%ebp
+  8011d4:	57                   	push   %edi
+  8011d5:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8011d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011db:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011de:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011e1:	b8 10 00 00 00       	mov    $0x10,%eax
+  8011e6:	89 df                	mov    %ebx,%edi
+  8011e8:	6a 00                	push   $0x0
+  8011ea:	55                   	push   %ebp
+  8011eb:	56                   	push   %esi
+  8011ec:	89 e5                	mov    %esp,%ebp
+  8011ee:	8d 35 f6 11 80 00    	lea    0x8011f6,%esi
+  8011f4:	0f 34                	sysenter
+
+008011f6 <after_sysenter_label_1583>:
+  8011f6:	5e                   	pop    %esi
+  8011f7:	5d                   	pop    %ebp
+  8011f8:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  8011fb:	5b                   	pop    %ebx
+  8011fc:	5f                   	pop    %edi
+  8011fd:	5d                   	pop    %ebp
+  8011fe:	c3                   	ret
+
+008011ff <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  8011ff:	55                   	push   %ebp
+  801200:	89 e5                	mov    %esp,%ebp
+  801202:	57                   	push   %edi
+  801203:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801204:	8b 55 08             	mov    0x8(%ebp),%edx
+  801207:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80120a:	b8 11 00 00 00       	mov    $0x11,%eax
+  80120f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801214:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801217:	6a 00                	push   $0x0
+  801219:	55                   	push   %ebp
+  80121a:	56                   	push   %esi
+  80121b:	89 e5                	mov    %esp,%ebp
+  80121d:	8d 35 25 12 80 00    	lea    0x801225,%esi
+  801223:	0f 34                	sysenter
+
+00801225 <after_sysenter_label_1672>:
+  801225:	5e                   	pop    %esi
+  801226:	5d                   	pop    %ebp
+  801227:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  80122a:	5b                   	pop    %ebx
+  80122b:	5f                   	pop    %edi
+  80122c:	5d                   	pop    %ebp
+  80122d:	c3                   	ret
+
+0080122e <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  80122e:	55                   	push   %ebp
+  80122f:	89 e5                	mov    %esp,%ebp
+  801231:	57                   	push   %edi
+  801232:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801233:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801238:	8b 55 08             	mov    0x8(%ebp),%edx
+  80123b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80123e:	b8 12 00 00 00       	mov    $0x12,%eax
+  801243:	89 df                	mov    %ebx,%edi
+  801245:	6a 00                	push   $0x0
+  801247:	55                   	push   %ebp
+  801248:	56                   	push   %esi
+  801249:	89 e5                	mov    %esp,%ebp
+  80124b:	8d 35 53 12 80 00    	lea    0x801253,%esi
+  801251:	0f 34                	sysenter
+
+00801253 <after_sysenter_label_1758>:
+  801253:	5e                   	pop    %esi
+  801254:	5d                   	pop    %ebp
+  801255:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  801258:	5b                   	pop    %ebx
+  801259:	5f                   	pop    %edi
+  80125a:	5d                   	pop    %ebp
+  80125b:	c3                   	ret
+
+0080125c <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  80125c:	55                   	push   %ebp
+  80125d:	89 e5                	mov    %esp,%ebp
+  80125f:	57                   	push   %edi
+  801260:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801261:	8b 55 08             	mov    0x8(%ebp),%edx
+  801264:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801269:	b8 13 00 00 00       	mov    $0x13,%eax
+  80126e:	89 cb                	mov    %ecx,%ebx
+  801270:	89 cf                	mov    %ecx,%edi
+  801272:	6a 00                	push   $0x0
+  801274:	55                   	push   %ebp
+  801275:	56                   	push   %esi
+  801276:	89 e5                	mov    %esp,%ebp
+  801278:	8d 35 80 12 80 00    	lea    0x801280,%esi
+  80127e:	0f 34                	sysenter
+
+00801280 <after_sysenter_label_1842>:
+  801280:	5e                   	pop    %esi
+  801281:	5d                   	pop    %ebp
+  801282:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801285:	85 c0                	test   %eax,%eax
+  801287:	7f 07                	jg     801290 <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  801289:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80128c:	5b                   	pop    %ebx
+  80128d:	5f                   	pop    %edi
+  80128e:	5d                   	pop    %ebp
+  80128f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801290:	83 ec 0c             	sub    $0xc,%esp
+  801293:	50                   	push   %eax
+  801294:	6a 13                	push   $0x13
+  801296:	68 35 4f 80 00       	push   $0x804f35
+  80129b:	6a 54                	push   $0x54
+  80129d:	68 52 4f 80 00       	push   $0x804f52
+  8012a2:	e8 46 f1 ff ff       	call   8003ed <_panic>
+
+008012a7 <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  8012a7:	55                   	push   %ebp
+  8012a8:	89 e5                	mov    %esp,%ebp
+  8012aa:	57                   	push   %edi
+  8012ab:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8012ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012b1:	b8 14 00 00 00       	mov    $0x14,%eax
+  8012b6:	89 d1                	mov    %edx,%ecx
+  8012b8:	89 d3                	mov    %edx,%ebx
+  8012ba:	89 d7                	mov    %edx,%edi
+  8012bc:	6a 00                	push   $0x0
+  8012be:	55                   	push   %ebp
+  8012bf:	56                   	push   %esi
+  8012c0:	89 e5                	mov    %esp,%ebp
+  8012c2:	8d 35 ca 12 80 00    	lea    0x8012ca,%esi
+  8012c8:	0f 34                	sysenter
+
+008012ca <after_sysenter_label_1939>:
+  8012ca:	5e                   	pop    %esi
+  8012cb:	5d                   	pop    %ebp
+  8012cc:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  8012cf:	5b                   	pop    %ebx
+  8012d0:	5f                   	pop    %edi
+  8012d1:	5d                   	pop    %ebp
+  8012d2:	c3                   	ret
+
+008012d3 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  8012d3:	55                   	push   %ebp
+  8012d4:	89 e5                	mov    %esp,%ebp
+  8012d6:	57                   	push   %edi
+  8012d7:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8012d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012de:	b8 15 00 00 00       	mov    $0x15,%eax
+  8012e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012e8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012eb:	6a 00                	push   $0x0
+  8012ed:	55                   	push   %ebp
+  8012ee:	56                   	push   %esi
+  8012ef:	89 e5                	mov    %esp,%ebp
+  8012f1:	8d 35 f9 12 80 00    	lea    0x8012f9,%esi
+  8012f7:	0f 34                	sysenter
+
+008012f9 <after_sysenter_label_2028>:
+  8012f9:	5e                   	pop    %esi
+  8012fa:	5d                   	pop    %ebp
+  8012fb:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  8012fe:	5b                   	pop    %ebx
+  8012ff:	5f                   	pop    %edi
+  801300:	5d                   	pop    %ebp
+  801301:	c3                   	ret
+
+00801302 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  801302:	55                   	push   %ebp
+  801303:	89 e5                	mov    %esp,%ebp
+  801305:	57                   	push   %edi
+  801306:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801307:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80130c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80130f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801312:	b8 16 00 00 00       	mov    $0x16,%eax
+  801317:	89 df                	mov    %ebx,%edi
+  801319:	6a 00                	push   $0x0
+  80131b:	55                   	push   %ebp
+  80131c:	56                   	push   %esi
+  80131d:	89 e5                	mov    %esp,%ebp
+  80131f:	8d 35 27 13 80 00    	lea    0x801327,%esi
+  801325:	0f 34                	sysenter
+
+00801327 <after_sysenter_label_2114>:
+  801327:	5e                   	pop    %esi
+  801328:	5d                   	pop    %ebp
+  801329:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  80132c:	5b                   	pop    %ebx
+  80132d:	5f                   	pop    %edi
+  80132e:	5d                   	pop    %ebp
+  80132f:	c3                   	ret
+
+00801330 <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  801330:	55                   	push   %ebp
+  801331:	89 e5                	mov    %esp,%ebp
+  801333:	57                   	push   %edi
+  801334:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801335:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80133a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80133d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801340:	b8 17 00 00 00       	mov    $0x17,%eax
+  801345:	89 df                	mov    %ebx,%edi
+  801347:	6a 00                	push   $0x0
+  801349:	55                   	push   %ebp
+  80134a:	56                   	push   %esi
+  80134b:	89 e5                	mov    %esp,%ebp
+  80134d:	8d 35 55 13 80 00    	lea    0x801355,%esi
+  801353:	0f 34                	sysenter
+
+00801355 <after_sysenter_label_2200>:
+  801355:	5e                   	pop    %esi
+  801356:	5d                   	pop    %ebp
+  801357:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  80135a:	5b                   	pop    %ebx
+  80135b:	5f                   	pop    %edi
+  80135c:	5d                   	pop    %ebp
+  80135d:	c3                   	ret
+
+0080135e <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  80135e:	55                   	push   %ebp
+  80135f:	89 e5                	mov    %esp,%ebp
+  801361:	57                   	push   %edi
+  801362:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801363:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801368:	8b 55 08             	mov    0x8(%ebp),%edx
+  80136b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80136e:	b8 18 00 00 00       	mov    $0x18,%eax
+  801373:	89 df                	mov    %ebx,%edi
+  801375:	6a 00                	push   $0x0
+  801377:	55                   	push   %ebp
+  801378:	56                   	push   %esi
+  801379:	89 e5                	mov    %esp,%ebp
+  80137b:	8d 35 83 13 80 00    	lea    0x801383,%esi
+  801381:	0f 34                	sysenter
+
+00801383 <after_sysenter_label_2286>:
+  801383:	5e                   	pop    %esi
+  801384:	5d                   	pop    %ebp
+  801385:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  801388:	5b                   	pop    %ebx
+  801389:	5f                   	pop    %edi
+  80138a:	5d                   	pop    %ebp
+  80138b:	c3                   	ret
+
+0080138c <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  80138c:	55                   	push   %ebp
+  80138d:	89 e5                	mov    %esp,%ebp
+  80138f:	57                   	push   %edi
+  801390:	56                   	push   %esi
+  801391:	53                   	push   %ebx
+  801392:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  801395:	89 d6                	mov    %edx,%esi
+  801397:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  80139a:	89 cf                	mov    %ecx,%edi
+  80139c:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  80139f:	89 fa                	mov    %edi,%edx
+  8013a1:	80 ce 08             	or     $0x8,%dh
+  8013a4:	f6 c5 08             	test   $0x8,%ch
+  8013a7:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  8013aa:	57                   	push   %edi
+  8013ab:	56                   	push   %esi
+  8013ac:	50                   	push   %eax
+  8013ad:	56                   	push   %esi
+  8013ae:	6a 00                	push   $0x0
+  8013b0:	e8 82 fb ff ff       	call   800f37 <sys_page_map>
+	if (r < 0) {
+  8013b5:	83 c4 20             	add    $0x20,%esp
+  8013b8:	85 c0                	test   %eax,%eax
+  8013ba:	78 27                	js     8013e3 <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  8013bc:	83 ec 0c             	sub    $0xc,%esp
+  8013bf:	57                   	push   %edi
+  8013c0:	56                   	push   %esi
+  8013c1:	6a 00                	push   $0x0
+  8013c3:	56                   	push   %esi
+  8013c4:	6a 00                	push   $0x0
+  8013c6:	e8 6c fb ff ff       	call   800f37 <sys_page_map>
+  8013cb:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  8013cd:	83 c4 20             	add    $0x20,%esp
+  8013d0:	85 c0                	test   %eax,%eax
+  8013d2:	78 24                	js     8013f8 <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  8013d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8013d9:	89 d8                	mov    %ebx,%eax
+  8013db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013de:	5b                   	pop    %ebx
+  8013df:	5e                   	pop    %esi
+  8013e0:	5f                   	pop    %edi
+  8013e1:	5d                   	pop    %ebp
+  8013e2:	c3                   	ret
+  8013e3:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  8013e5:	83 ec 08             	sub    $0x8,%esp
+  8013e8:	50                   	push   %eax
+  8013e9:	68 60 4f 80 00       	push   $0x804f60
+  8013ee:	e8 d5 f0 ff ff       	call   8004c8 <cprintf>
+		return r;
+  8013f3:	83 c4 10             	add    $0x10,%esp
+  8013f6:	eb e1                	jmp    8013d9 <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  8013f8:	83 ec 08             	sub    $0x8,%esp
+  8013fb:	50                   	push   %eax
+  8013fc:	68 90 4f 80 00       	push   $0x804f90
+  801401:	e8 c2 f0 ff ff       	call   8004c8 <cprintf>
+		return r;
+  801406:	83 c4 10             	add    $0x10,%esp
+  801409:	eb ce                	jmp    8013d9 <duppage_cow+0x4d>
+
+0080140b <duppage>:
+{
+  80140b:	55                   	push   %ebp
+  80140c:	89 e5                	mov    %esp,%ebp
+  80140e:	53                   	push   %ebx
+  80140f:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  801412:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  801415:	51                   	push   %ecx
+  801416:	52                   	push   %edx
+  801417:	50                   	push   %eax
+  801418:	52                   	push   %edx
+  801419:	6a 00                	push   $0x0
+  80141b:	e8 17 fb ff ff       	call   800f37 <sys_page_map>
+	if (r < 0) {
+  801420:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  801423:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  801428:	85 c0                	test   %eax,%eax
+  80142a:	78 07                	js     801433 <duppage+0x28>
+}
+  80142c:	89 d8                	mov    %ebx,%eax
+  80142e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801431:	c9                   	leave
+  801432:	c3                   	ret
+  801433:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  801435:	83 ec 08             	sub    $0x8,%esp
+  801438:	50                   	push   %eax
+  801439:	68 60 4f 80 00       	push   $0x804f60
+  80143e:	e8 85 f0 ff ff       	call   8004c8 <cprintf>
+		return r;
+  801443:	83 c4 10             	add    $0x10,%esp
+  801446:	eb e4                	jmp    80142c <duppage+0x21>
+
+00801448 <cow_copy>:
+{
+  801448:	55                   	push   %ebp
+  801449:	89 e5                	mov    %esp,%ebp
+  80144b:	56                   	push   %esi
+  80144c:	53                   	push   %ebx
+  80144d:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  80144f:	83 ec 04             	sub    $0x4,%esp
+  801452:	6a 07                	push   $0x7
+  801454:	68 00 f0 7f 00       	push   $0x7ff000
+  801459:	6a 00                	push   $0x0
+  80145b:	e8 8a fa ff ff       	call   800eea <sys_page_alloc>
+	if (r < 0) {
+  801460:	83 c4 10             	add    $0x10,%esp
+  801463:	85 c0                	test   %eax,%eax
+  801465:	78 58                	js     8014bf <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  801467:	83 ec 04             	sub    $0x4,%esp
+  80146a:	68 00 10 00 00       	push   $0x1000
+  80146f:	56                   	push   %esi
+  801470:	68 00 f0 7f 00       	push   $0x7ff000
+  801475:	e8 b8 f7 ff ff       	call   800c32 <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  80147a:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801481:	56                   	push   %esi
+  801482:	6a 00                	push   $0x0
+  801484:	68 00 f0 7f 00       	push   $0x7ff000
+  801489:	6a 00                	push   $0x0
+  80148b:	e8 a7 fa ff ff       	call   800f37 <sys_page_map>
+  801490:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  801492:	83 c4 20             	add    $0x20,%esp
+  801495:	85 c0                	test   %eax,%eax
+  801497:	78 3b                	js     8014d4 <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  801499:	83 ec 08             	sub    $0x8,%esp
+  80149c:	68 00 f0 7f 00       	push   $0x7ff000
+  8014a1:	6a 00                	push   $0x0
+  8014a3:	e8 db fa ff ff       	call   800f83 <sys_page_unmap>
+  8014a8:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  8014aa:	83 c4 10             	add    $0x10,%esp
+  8014ad:	85 c0                	test   %eax,%eax
+  8014af:	78 45                	js     8014f6 <cow_copy+0xae>
+	return 0;
+  8014b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8014b6:	89 d8                	mov    %ebx,%eax
+  8014b8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014bb:	5b                   	pop    %ebx
+  8014bc:	5e                   	pop    %esi
+  8014bd:	5d                   	pop    %ebp
+  8014be:	c3                   	ret
+  8014bf:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  8014c1:	83 ec 08             	sub    $0x8,%esp
+  8014c4:	50                   	push   %eax
+  8014c5:	68 80 50 80 00       	push   $0x805080
+  8014ca:	e8 f9 ef ff ff       	call   8004c8 <cprintf>
+		return r;
+  8014cf:	83 c4 10             	add    $0x10,%esp
+  8014d2:	eb e2                	jmp    8014b6 <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  8014d4:	83 ec 08             	sub    $0x8,%esp
+  8014d7:	50                   	push   %eax
+  8014d8:	68 9c 50 80 00       	push   $0x80509c
+  8014dd:	e8 e6 ef ff ff       	call   8004c8 <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  8014e2:	83 c4 08             	add    $0x8,%esp
+  8014e5:	68 00 f0 7f 00       	push   $0x7ff000
+  8014ea:	6a 00                	push   $0x0
+  8014ec:	e8 92 fa ff ff       	call   800f83 <sys_page_unmap>
+		return r;
+  8014f1:	83 c4 10             	add    $0x10,%esp
+  8014f4:	eb c0                	jmp    8014b6 <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  8014f6:	83 ec 08             	sub    $0x8,%esp
+  8014f9:	50                   	push   %eax
+  8014fa:	68 b8 4f 80 00       	push   $0x804fb8
+  8014ff:	e8 c4 ef ff ff       	call   8004c8 <cprintf>
+		return r;
+  801504:	83 c4 10             	add    $0x10,%esp
+  801507:	eb ad                	jmp    8014b6 <cow_copy+0x6e>
+
+00801509 <pgfault>:
+{
+  801509:	55                   	push   %ebp
+  80150a:	89 e5                	mov    %esp,%ebp
+  80150c:	56                   	push   %esi
+  80150d:	53                   	push   %ebx
+  80150e:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  801511:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  801513:	89 d8                	mov    %ebx,%eax
+  801515:	c1 e8 16             	shr    $0x16,%eax
+  801518:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  80151f:	89 de                	mov    %ebx,%esi
+  801521:	c1 ee 0c             	shr    $0xc,%esi
+  801524:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  80152b:	a8 07                	test   $0x7,%al
+  80152d:	74 3b                	je     80156a <pgfault+0x61>
+  80152f:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  801535:	74 33                	je     80156a <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  801537:	83 ec 0c             	sub    $0xc,%esp
+  80153a:	68 00 f0 bf ee       	push   $0xeebff000
+  80153f:	e8 cd 26 00 00       	call   803c11 <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  801544:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  80154b:	83 c4 10             	add    $0x10,%esp
+  80154e:	f6 c4 08             	test   $0x8,%ah
+  801551:	75 30                	jne    801583 <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  801553:	83 ec 0c             	sub    $0xc,%esp
+  801556:	68 00 f0 bf ee       	push   $0xeebff000
+  80155b:	e8 1e 27 00 00       	call   803c7e <mutex_unlock>
+}
+  801560:	83 c4 10             	add    $0x10,%esp
+  801563:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801566:	5b                   	pop    %ebx
+  801567:	5e                   	pop    %esi
+  801568:	5d                   	pop    %ebp
+  801569:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  80156a:	83 ec 08             	sub    $0x8,%esp
+  80156d:	ff 72 28             	push   0x28(%edx)
+  801570:	51                   	push   %ecx
+  801571:	50                   	push   %eax
+  801572:	68 dc 4f 80 00       	push   $0x804fdc
+  801577:	6a 3f                	push   $0x3f
+  801579:	68 b6 50 80 00       	push   $0x8050b6
+  80157e:	e8 6a ee ff ff       	call   8003ed <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  801583:	89 d8                	mov    %ebx,%eax
+  801585:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  80158a:	e8 b9 fe ff ff       	call   801448 <cow_copy>
+  80158f:	eb c2                	jmp    801553 <pgfault+0x4a>
+
+00801591 <cow_enable>:
+{
+  801591:	55                   	push   %ebp
+  801592:	89 e5                	mov    %esp,%ebp
+  801594:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  801597:	68 09 15 80 00       	push   $0x801509
+  80159c:	e8 f0 2f 00 00       	call   804591 <set_pgfault_handler>
+}
+  8015a1:	83 c4 10             	add    $0x10,%esp
+  8015a4:	c9                   	leave
+  8015a5:	c3                   	ret
+
+008015a6 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  8015a6:	55                   	push   %ebp
+  8015a7:	89 e5                	mov    %esp,%ebp
+  8015a9:	57                   	push   %edi
+  8015aa:	56                   	push   %esi
+  8015ab:	53                   	push   %ebx
+  8015ac:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  8015af:	68 09 15 80 00       	push   $0x801509
+  8015b4:	e8 d8 2f 00 00       	call   804591 <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  8015b9:	b8 07 00 00 00       	mov    $0x7,%eax
+  8015be:	cd 30                	int    $0x30
+  8015c0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  8015c3:	83 c4 10             	add    $0x10,%esp
+  8015c6:	85 c0                	test   %eax,%eax
+  8015c8:	78 4b                	js     801615 <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  8015ca:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8015cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015d4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  8015d7:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8015db:	0f 85 16 01 00 00    	jne    8016f7 <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8015e1:	e8 ac f8 ff ff       	call   800e92 <sys_getenvid>
+  8015e6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8015eb:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8015ed:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  8015f3:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8015f9:	77 32                	ja     80162d <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8015fb:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  801600:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  801602:	c1 ea 10             	shr    $0x10,%edx
+  801605:	74 26                	je     80162d <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801607:	c1 e2 10             	shl    $0x10,%edx
+  80160a:	89 d1                	mov    %edx,%ecx
+  80160c:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801611:	29 ca                	sub    %ecx,%edx
+  801613:	eb 1e                	jmp    801633 <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  801615:	83 ec 08             	sub    $0x8,%esp
+  801618:	89 c7                	mov    %eax,%edi
+  80161a:	50                   	push   %eax
+  80161b:	68 c1 50 80 00       	push   $0x8050c1
+  801620:	e8 a3 ee ff ff       	call   8004c8 <cprintf>
+		return eid;
+  801625:	83 c4 10             	add    $0x10,%esp
+  801628:	e9 6c 01 00 00       	jmp    801799 <fork+0x1f3>
+		return pthread_main_tls;
+  80162d:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801633:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  801636:	c1 e0 04             	shl    $0x4,%eax
+  801639:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80163e:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  801640:	e8 15 2d 00 00       	call   80435a <pthread_fork_child>
+		return eid;
+  801645:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801648:	e9 4c 01 00 00       	jmp    801799 <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  80164d:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  801653:	89 da                	mov    %ebx,%edx
+  801655:	89 f8                	mov    %edi,%eax
+  801657:	e8 af fd ff ff       	call   80140b <duppage>
+  80165c:	85 c0                	test   %eax,%eax
+  80165e:	79 28                	jns    801688 <fork+0xe2>
+  801660:	89 c7                	mov    %eax,%edi
+  801662:	e9 32 01 00 00       	jmp    801799 <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  801667:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  80166d:	83 f9 05             	cmp    $0x5,%ecx
+  801670:	75 58                	jne    8016ca <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  801672:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801677:	89 da                	mov    %ebx,%edx
+  801679:	89 f8                	mov    %edi,%eax
+  80167b:	e8 8b fd ff ff       	call   80140b <duppage>
+  801680:	85 c0                	test   %eax,%eax
+  801682:	0f 88 0f 01 00 00    	js     801797 <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  801688:	83 c3 01             	add    $0x1,%ebx
+  80168b:	39 de                	cmp    %ebx,%esi
+  80168d:	74 54                	je     8016e3 <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  80168f:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  801696:	f6 c1 05             	test   $0x5,%cl
+  801699:	74 ed                	je     801688 <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  80169b:	f6 c5 04             	test   $0x4,%ch
+  80169e:	75 ad                	jne    80164d <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  8016a0:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  8016a6:	74 bf                	je     801667 <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  8016a8:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8016ae:	74 d8                	je     801688 <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  8016b0:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  8016b6:	89 da                	mov    %ebx,%edx
+  8016b8:	89 f8                	mov    %edi,%eax
+  8016ba:	e8 cd fc ff ff       	call   80138c <duppage_cow>
+  8016bf:	85 c0                	test   %eax,%eax
+  8016c1:	79 c5                	jns    801688 <fork+0xe2>
+  8016c3:	89 c7                	mov    %eax,%edi
+  8016c5:	e9 cf 00 00 00       	jmp    801799 <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  8016ca:	68 0c 50 80 00       	push   $0x80500c
+  8016cf:	68 d1 50 80 00       	push   $0x8050d1
+  8016d4:	68 c6 00 00 00       	push   $0xc6
+  8016d9:	68 b6 50 80 00       	push   $0x8050b6
+  8016de:	e8 0a ed ff ff       	call   8003ed <_panic>
+  8016e3:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8016e6:	83 c1 01             	add    $0x1,%ecx
+  8016e9:	81 c6 00 04 00 00    	add    $0x400,%esi
+  8016ef:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  8016f5:	74 18                	je     80170f <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  8016f7:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  8016fe:	a8 07                	test   $0x7,%al
+  801700:	74 e4                	je     8016e6 <fork+0x140>
+  801702:	89 cb                	mov    %ecx,%ebx
+  801704:	c1 e3 0a             	shl    $0xa,%ebx
+  801707:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80170a:	e9 7c ff ff ff       	jmp    80168b <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  80170f:	83 ec 04             	sub    $0x4,%esp
+  801712:	6a 07                	push   $0x7
+  801714:	68 00 f0 bf ee       	push   $0xeebff000
+  801719:	ff 75 e4             	push   -0x1c(%ebp)
+  80171c:	e8 c9 f7 ff ff       	call   800eea <sys_page_alloc>
+  801721:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801723:	83 c4 10             	add    $0x10,%esp
+  801726:	85 c0                	test   %eax,%eax
+  801728:	78 34                	js     80175e <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  80172a:	83 ec 08             	sub    $0x8,%esp
+  80172d:	68 cf 45 80 00       	push   $0x8045cf
+  801732:	ff 75 e4             	push   -0x1c(%ebp)
+  801735:	e8 2d f9 ff ff       	call   801067 <sys_env_set_pgfault_upcall>
+  80173a:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80173c:	83 c4 10             	add    $0x10,%esp
+  80173f:	85 c0                	test   %eax,%eax
+  801741:	78 2e                	js     801771 <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  801743:	83 ec 08             	sub    $0x8,%esp
+  801746:	6a 02                	push   $0x2
+  801748:	ff 75 e4             	push   -0x1c(%ebp)
+  80174b:	e8 7f f8 ff ff       	call   800fcf <sys_env_set_status>
+  801750:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801752:	83 c4 10             	add    $0x10,%esp
+  801755:	85 c0                	test   %eax,%eax
+  801757:	78 2b                	js     801784 <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  801759:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80175c:	eb 3b                	jmp    801799 <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  80175e:	83 ec 08             	sub    $0x8,%esp
+  801761:	50                   	push   %eax
+  801762:	68 34 50 80 00       	push   $0x805034
+  801767:	e8 5c ed ff ff       	call   8004c8 <cprintf>
+		return r;
+  80176c:	83 c4 10             	add    $0x10,%esp
+  80176f:	eb 28                	jmp    801799 <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  801771:	83 ec 08             	sub    $0x8,%esp
+  801774:	50                   	push   %eax
+  801775:	68 5c 50 80 00       	push   $0x80505c
+  80177a:	e8 49 ed ff ff       	call   8004c8 <cprintf>
+		return r;
+  80177f:	83 c4 10             	add    $0x10,%esp
+  801782:	eb 15                	jmp    801799 <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  801784:	83 ec 08             	sub    $0x8,%esp
+  801787:	50                   	push   %eax
+  801788:	68 e6 50 80 00       	push   $0x8050e6
+  80178d:	e8 36 ed ff ff       	call   8004c8 <cprintf>
+		return r;
+  801792:	83 c4 10             	add    $0x10,%esp
+  801795:	eb 02                	jmp    801799 <fork+0x1f3>
+  801797:	89 c7                	mov    %eax,%edi
+}
+  801799:	89 f8                	mov    %edi,%eax
+  80179b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80179e:	5b                   	pop    %ebx
+  80179f:	5e                   	pop    %esi
+  8017a0:	5f                   	pop    %edi
+  8017a1:	5d                   	pop    %ebp
+  8017a2:	c3                   	ret
+
+008017a3 <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  8017a3:	55                   	push   %ebp
+  8017a4:	89 e5                	mov    %esp,%ebp
+  8017a6:	57                   	push   %edi
+  8017a7:	56                   	push   %esi
+  8017a8:	53                   	push   %ebx
+  8017a9:	83 ec 2c             	sub    $0x2c,%esp
+  8017ac:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8017ae:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  8017b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8017b9:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8017bf:	77 0a                	ja     8017cb <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8017c1:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  8017c6:	29 c3                	sub    %eax,%ebx
+  8017c8:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  8017cb:	83 ec 0c             	sub    $0xc,%esp
+  8017ce:	68 09 15 80 00       	push   $0x801509
+  8017d3:	e8 b9 2d 00 00       	call   804591 <set_pgfault_handler>
+  8017d8:	b8 07 00 00 00       	mov    $0x7,%eax
+  8017dd:	cd 30                	int    $0x30
+  8017df:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  8017e2:	83 c4 10             	add    $0x10,%esp
+  8017e5:	85 c0                	test   %eax,%eax
+  8017e7:	78 30                	js     801819 <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  8017e9:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8017ed:	74 42                	je     801831 <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  8017ef:	c1 e3 10             	shl    $0x10,%ebx
+  8017f2:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  8017f7:	29 d8                	sub    %ebx,%eax
+  8017f9:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8017fc:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  801801:	29 d8                	sub    %ebx,%eax
+  801803:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801806:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80180b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801810:	89 f7                	mov    %esi,%edi
+  801812:	89 d6                	mov    %edx,%esi
+  801814:	e9 2c 01 00 00       	jmp    801945 <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  801819:	83 ec 08             	sub    $0x8,%esp
+  80181c:	89 c7                	mov    %eax,%edi
+  80181e:	50                   	push   %eax
+  80181f:	68 c1 50 80 00       	push   $0x8050c1
+  801824:	e8 9f ec ff ff       	call   8004c8 <cprintf>
+		return eid;
+  801829:	83 c4 10             	add    $0x10,%esp
+  80182c:	e9 d5 00 00 00       	jmp    801906 <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801831:	e8 5c f6 ff ff       	call   800e92 <sys_getenvid>
+  801836:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80183b:	89 c2                	mov    %eax,%edx
+  80183d:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80183f:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  801845:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80184a:	77 18                	ja     801864 <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80184c:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801851:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  801853:	c1 e8 10             	shr    $0x10,%eax
+  801856:	74 0c                	je     801864 <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801858:	c1 e0 10             	shl    $0x10,%eax
+  80185b:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  801860:	29 c1                	sub    %eax,%ecx
+  801862:	eb 06                	jmp    80186a <sfork+0xc7>
+		return pthread_main_tls;
+  801864:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+  80186a:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80186d:	c1 e0 04             	shl    $0x4,%eax
+  801870:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801875:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  801877:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  80187a:	e9 87 00 00 00       	jmp    801906 <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  80187f:	f6 c5 04             	test   $0x4,%ch
+  801882:	74 6c                	je     8018f0 <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  801884:	89 ca                	mov    %ecx,%edx
+  801886:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  80188c:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  801892:	74 7c                	je     801910 <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  801894:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  80189a:	89 da                	mov    %ebx,%edx
+  80189c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80189f:	e8 67 fb ff ff       	call   80140b <duppage>
+  8018a4:	85 c0                	test   %eax,%eax
+  8018a6:	0f 88 4f 01 00 00    	js     8019fb <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  8018ac:	83 c3 01             	add    $0x1,%ebx
+  8018af:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  8018b2:	74 7a                	je     80192e <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  8018b4:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  8018b6:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  8018bd:	f6 c1 01             	test   $0x1,%cl
+  8018c0:	74 ea                	je     8018ac <sfork+0x109>
+  8018c2:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8018c8:	74 e2                	je     8018ac <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  8018ca:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  8018d0:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  8018d3:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  8018d8:	76 a5                	jbe    80187f <sfork+0xdc>
+  8018da:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  8018e0:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8018e3:	39 fa                	cmp    %edi,%edx
+  8018e5:	73 9d                	jae    801884 <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  8018e7:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  8018ea:	39 fa                	cmp    %edi,%edx
+  8018ec:	72 96                	jb     801884 <sfork+0xe1>
+  8018ee:	eb 8f                	jmp    80187f <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8018f0:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8018f6:	89 da                	mov    %ebx,%edx
+  8018f8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8018fb:	e8 8c fa ff ff       	call   80138c <duppage_cow>
+  801900:	85 c0                	test   %eax,%eax
+  801902:	79 a8                	jns    8018ac <sfork+0x109>
+  801904:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  801906:	89 f8                	mov    %edi,%eax
+  801908:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80190b:	5b                   	pop    %ebx
+  80190c:	5e                   	pop    %esi
+  80190d:	5f                   	pop    %edi
+  80190e:	5d                   	pop    %ebp
+  80190f:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  801910:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  801915:	e8 2e fb ff ff       	call   801448 <cow_copy>
+  80191a:	85 c0                	test   %eax,%eax
+  80191c:	0f 88 d2 00 00 00    	js     8019f4 <sfork+0x251>
+				pte = uvpt[pn];
+  801922:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  801929:	e9 66 ff ff ff       	jmp    801894 <sfork+0xf1>
+  80192e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801931:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  801934:	83 c6 01             	add    $0x1,%esi
+  801937:	81 c7 00 04 00 00    	add    $0x400,%edi
+  80193d:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  801943:	74 1b                	je     801960 <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  801945:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  80194c:	a8 01                	test   $0x1,%al
+  80194e:	74 e4                	je     801934 <sfork+0x191>
+  801950:	89 f3                	mov    %esi,%ebx
+  801952:	c1 e3 0a             	shl    $0xa,%ebx
+  801955:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  801958:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  80195b:	e9 4f ff ff ff       	jmp    8018af <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  801960:	83 ec 04             	sub    $0x4,%esp
+  801963:	6a 07                	push   $0x7
+  801965:	68 00 f0 bf ee       	push   $0xeebff000
+  80196a:	ff 75 e0             	push   -0x20(%ebp)
+  80196d:	e8 78 f5 ff ff       	call   800eea <sys_page_alloc>
+  801972:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801974:	83 c4 10             	add    $0x10,%esp
+  801977:	85 c0                	test   %eax,%eax
+  801979:	78 37                	js     8019b2 <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  80197b:	83 ec 08             	sub    $0x8,%esp
+  80197e:	68 cf 45 80 00       	push   $0x8045cf
+  801983:	ff 75 e0             	push   -0x20(%ebp)
+  801986:	e8 dc f6 ff ff       	call   801067 <sys_env_set_pgfault_upcall>
+  80198b:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80198d:	83 c4 10             	add    $0x10,%esp
+  801990:	85 c0                	test   %eax,%eax
+  801992:	78 34                	js     8019c8 <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  801994:	83 ec 08             	sub    $0x8,%esp
+  801997:	6a 02                	push   $0x2
+  801999:	ff 75 e0             	push   -0x20(%ebp)
+  80199c:	e8 2e f6 ff ff       	call   800fcf <sys_env_set_status>
+  8019a1:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8019a3:	83 c4 10             	add    $0x10,%esp
+  8019a6:	85 c0                	test   %eax,%eax
+  8019a8:	78 34                	js     8019de <sfork+0x23b>
+	return eid;
+  8019aa:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8019ad:	e9 54 ff ff ff       	jmp    801906 <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  8019b2:	83 ec 08             	sub    $0x8,%esp
+  8019b5:	50                   	push   %eax
+  8019b6:	68 34 50 80 00       	push   $0x805034
+  8019bb:	e8 08 eb ff ff       	call   8004c8 <cprintf>
+		return r;
+  8019c0:	83 c4 10             	add    $0x10,%esp
+  8019c3:	e9 3e ff ff ff       	jmp    801906 <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  8019c8:	83 ec 08             	sub    $0x8,%esp
+  8019cb:	50                   	push   %eax
+  8019cc:	68 5c 50 80 00       	push   $0x80505c
+  8019d1:	e8 f2 ea ff ff       	call   8004c8 <cprintf>
+		return r;
+  8019d6:	83 c4 10             	add    $0x10,%esp
+  8019d9:	e9 28 ff ff ff       	jmp    801906 <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  8019de:	83 ec 08             	sub    $0x8,%esp
+  8019e1:	50                   	push   %eax
+  8019e2:	68 e6 50 80 00       	push   $0x8050e6
+  8019e7:	e8 dc ea ff ff       	call   8004c8 <cprintf>
+		return r;
+  8019ec:	83 c4 10             	add    $0x10,%esp
+  8019ef:	e9 12 ff ff ff       	jmp    801906 <sfork+0x163>
+  8019f4:	89 c7                	mov    %eax,%edi
+  8019f6:	e9 0b ff ff ff       	jmp    801906 <sfork+0x163>
+  8019fb:	89 c7                	mov    %eax,%edi
+  8019fd:	e9 04 ff ff ff       	jmp    801906 <sfork+0x163>
+
+00801a02 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801a02:	55                   	push   %ebp
+  801a03:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801a05:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a08:	05 00 00 00 30       	add    $0x30000000,%eax
+  801a0d:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801a10:	5d                   	pop    %ebp
+  801a11:	c3                   	ret
+
+00801a12 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801a12:	55                   	push   %ebp
+  801a13:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801a15:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a18:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801a1d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801a22:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801a27:	5d                   	pop    %ebp
+  801a28:	c3                   	ret
+
+00801a29 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801a29:	55                   	push   %ebp
+  801a2a:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801a2c:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801a31:	eb 02                	jmp    801a35 <fd_alloc+0xc>
+  801a33:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801a35:	89 c2                	mov    %eax,%edx
+  801a37:	c1 ea 16             	shr    $0x16,%edx
+  801a3a:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801a41:	f6 c2 01             	test   $0x1,%dl
+  801a44:	74 2b                	je     801a71 <fd_alloc+0x48>
+  801a46:	89 c2                	mov    %eax,%edx
+  801a48:	c1 ea 0c             	shr    $0xc,%edx
+  801a4b:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801a52:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801a58:	f6 c1 01             	test   $0x1,%cl
+  801a5b:	74 14                	je     801a71 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801a5d:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801a63:	75 ce                	jne    801a33 <fd_alloc+0xa>
+  801a65:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801a6a:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801a6f:	eb 05                	jmp    801a76 <fd_alloc+0x4d>
+			return 0;
+  801a71:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801a76:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a79:	89 02                	mov    %eax,(%edx)
+}
+  801a7b:	89 c8                	mov    %ecx,%eax
+  801a7d:	5d                   	pop    %ebp
+  801a7e:	c3                   	ret
+
+00801a7f <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801a7f:	55                   	push   %ebp
+  801a80:	89 e5                	mov    %esp,%ebp
+  801a82:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801a85:	83 f8 1f             	cmp    $0x1f,%eax
+  801a88:	77 30                	ja     801aba <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801a8a:	c1 e0 0c             	shl    $0xc,%eax
+  801a8d:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801a92:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801a98:	f6 c2 01             	test   $0x1,%dl
+  801a9b:	74 24                	je     801ac1 <fd_lookup+0x42>
+  801a9d:	89 c2                	mov    %eax,%edx
+  801a9f:	c1 ea 0c             	shr    $0xc,%edx
+  801aa2:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801aa9:	f6 c2 01             	test   $0x1,%dl
+  801aac:	74 1a                	je     801ac8 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801aae:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ab1:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801ab3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ab8:	5d                   	pop    %ebp
+  801ab9:	c3                   	ret
+		return -E_INVAL;
+  801aba:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801abf:	eb f7                	jmp    801ab8 <fd_lookup+0x39>
+		return -E_INVAL;
+  801ac1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ac6:	eb f0                	jmp    801ab8 <fd_lookup+0x39>
+  801ac8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801acd:	eb e9                	jmp    801ab8 <fd_lookup+0x39>
+
+00801acf <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801acf:	55                   	push   %ebp
+  801ad0:	89 e5                	mov    %esp,%ebp
+  801ad2:	53                   	push   %ebx
+  801ad3:	83 ec 04             	sub    $0x4,%esp
+  801ad6:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801ad9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ade:	eb 03                	jmp    801ae3 <dev_lookup+0x14>
+  801ae0:	83 c0 01             	add    $0x1,%eax
+  801ae3:	8b 1c 85 80 51 80 00 	mov    0x805180(,%eax,4),%ebx
+  801aea:	85 db                	test   %ebx,%ebx
+  801aec:	74 0b                	je     801af9 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801aee:	39 13                	cmp    %edx,(%ebx)
+  801af0:	75 ee                	jne    801ae0 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801af2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801af7:	eb 49                	jmp    801b42 <dev_lookup+0x73>
+  801af9:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801afb:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  801b01:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801b06:	77 18                	ja     801b20 <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801b08:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801b0d:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  801b0f:	c1 e8 10             	shr    $0x10,%eax
+  801b12:	74 0c                	je     801b20 <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801b14:	c1 e0 10             	shl    $0x10,%eax
+  801b17:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  801b1c:	29 c1                	sub    %eax,%ecx
+  801b1e:	eb 06                	jmp    801b26 <dev_lookup+0x57>
+		return pthread_main_tls;
+  801b20:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801b26:	8b 01                	mov    (%ecx),%eax
+  801b28:	8b 40 48             	mov    0x48(%eax),%eax
+  801b2b:	83 ec 04             	sub    $0x4,%esp
+  801b2e:	52                   	push   %edx
+  801b2f:	50                   	push   %eax
+  801b30:	68 04 51 80 00       	push   $0x805104
+  801b35:	e8 8e e9 ff ff       	call   8004c8 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801b3a:	83 c4 10             	add    $0x10,%esp
+  801b3d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801b42:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b45:	89 1a                	mov    %ebx,(%edx)
+}
+  801b47:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b4a:	c9                   	leave
+  801b4b:	c3                   	ret
+
+00801b4c <fd_close>:
+{
+  801b4c:	55                   	push   %ebp
+  801b4d:	89 e5                	mov    %esp,%ebp
+  801b4f:	57                   	push   %edi
+  801b50:	56                   	push   %esi
+  801b51:	53                   	push   %ebx
+  801b52:	83 ec 24             	sub    $0x24,%esp
+  801b55:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b58:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801b5b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801b5e:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801b5f:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801b65:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801b68:	50                   	push   %eax
+  801b69:	e8 11 ff ff ff       	call   801a7f <fd_lookup>
+  801b6e:	89 c3                	mov    %eax,%ebx
+  801b70:	83 c4 10             	add    $0x10,%esp
+  801b73:	85 c0                	test   %eax,%eax
+  801b75:	78 05                	js     801b7c <fd_close+0x30>
+	    || fd != fd2)
+  801b77:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801b7a:	74 16                	je     801b92 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801b7c:	89 f8                	mov    %edi,%eax
+  801b7e:	84 c0                	test   %al,%al
+  801b80:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b85:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801b88:	89 d8                	mov    %ebx,%eax
+  801b8a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b8d:	5b                   	pop    %ebx
+  801b8e:	5e                   	pop    %esi
+  801b8f:	5f                   	pop    %edi
+  801b90:	5d                   	pop    %ebp
+  801b91:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801b92:	83 ec 08             	sub    $0x8,%esp
+  801b95:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801b98:	50                   	push   %eax
+  801b99:	ff 36                	push   (%esi)
+  801b9b:	e8 2f ff ff ff       	call   801acf <dev_lookup>
+  801ba0:	89 c3                	mov    %eax,%ebx
+  801ba2:	83 c4 10             	add    $0x10,%esp
+  801ba5:	85 c0                	test   %eax,%eax
+  801ba7:	78 1a                	js     801bc3 <fd_close+0x77>
+		if (dev->dev_close)
+  801ba9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801bac:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801baf:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801bb4:	85 c0                	test   %eax,%eax
+  801bb6:	74 0b                	je     801bc3 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801bb8:	83 ec 0c             	sub    $0xc,%esp
+  801bbb:	56                   	push   %esi
+  801bbc:	ff d0                	call   *%eax
+  801bbe:	89 c3                	mov    %eax,%ebx
+  801bc0:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801bc3:	83 ec 08             	sub    $0x8,%esp
+  801bc6:	56                   	push   %esi
+  801bc7:	6a 00                	push   $0x0
+  801bc9:	e8 b5 f3 ff ff       	call   800f83 <sys_page_unmap>
+	return r;
+  801bce:	83 c4 10             	add    $0x10,%esp
+  801bd1:	eb b5                	jmp    801b88 <fd_close+0x3c>
+
+00801bd3 <close>:
+
+int
+close(int fdnum)
+{
+  801bd3:	55                   	push   %ebp
+  801bd4:	89 e5                	mov    %esp,%ebp
+  801bd6:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801bd9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bdc:	50                   	push   %eax
+  801bdd:	ff 75 08             	push   0x8(%ebp)
+  801be0:	e8 9a fe ff ff       	call   801a7f <fd_lookup>
+  801be5:	83 c4 10             	add    $0x10,%esp
+  801be8:	85 c0                	test   %eax,%eax
+  801bea:	79 02                	jns    801bee <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801bec:	c9                   	leave
+  801bed:	c3                   	ret
+		return fd_close(fd, 1);
+  801bee:	83 ec 08             	sub    $0x8,%esp
+  801bf1:	6a 01                	push   $0x1
+  801bf3:	ff 75 f4             	push   -0xc(%ebp)
+  801bf6:	e8 51 ff ff ff       	call   801b4c <fd_close>
+  801bfb:	83 c4 10             	add    $0x10,%esp
+  801bfe:	eb ec                	jmp    801bec <close+0x19>
+
+00801c00 <close_all>:
+
+void
+close_all(void)
+{
+  801c00:	55                   	push   %ebp
+  801c01:	89 e5                	mov    %esp,%ebp
+  801c03:	53                   	push   %ebx
+  801c04:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801c07:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801c0c:	83 ec 0c             	sub    $0xc,%esp
+  801c0f:	53                   	push   %ebx
+  801c10:	e8 be ff ff ff       	call   801bd3 <close>
+	for (i = 0; i < MAXFD; i++)
+  801c15:	83 c3 01             	add    $0x1,%ebx
+  801c18:	83 c4 10             	add    $0x10,%esp
+  801c1b:	83 fb 20             	cmp    $0x20,%ebx
+  801c1e:	75 ec                	jne    801c0c <close_all+0xc>
+}
+  801c20:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c23:	c9                   	leave
+  801c24:	c3                   	ret
+
+00801c25 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801c25:	55                   	push   %ebp
+  801c26:	89 e5                	mov    %esp,%ebp
+  801c28:	57                   	push   %edi
+  801c29:	56                   	push   %esi
+  801c2a:	53                   	push   %ebx
+  801c2b:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801c2e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801c31:	50                   	push   %eax
+  801c32:	ff 75 08             	push   0x8(%ebp)
+  801c35:	e8 45 fe ff ff       	call   801a7f <fd_lookup>
+  801c3a:	89 c3                	mov    %eax,%ebx
+  801c3c:	83 c4 10             	add    $0x10,%esp
+  801c3f:	85 c0                	test   %eax,%eax
+  801c41:	78 7f                	js     801cc2 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801c43:	83 ec 0c             	sub    $0xc,%esp
+  801c46:	ff 75 0c             	push   0xc(%ebp)
+  801c49:	e8 85 ff ff ff       	call   801bd3 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801c4e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801c51:	c1 e6 0c             	shl    $0xc,%esi
+  801c54:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801c5a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801c5d:	89 3c 24             	mov    %edi,(%esp)
+  801c60:	e8 ad fd ff ff       	call   801a12 <fd2data>
+  801c65:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801c67:	89 34 24             	mov    %esi,(%esp)
+  801c6a:	e8 a3 fd ff ff       	call   801a12 <fd2data>
+  801c6f:	83 c4 10             	add    $0x10,%esp
+  801c72:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801c75:	89 d8                	mov    %ebx,%eax
+  801c77:	c1 e8 16             	shr    $0x16,%eax
+  801c7a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801c81:	a8 01                	test   $0x1,%al
+  801c83:	74 11                	je     801c96 <dup+0x71>
+  801c85:	89 d8                	mov    %ebx,%eax
+  801c87:	c1 e8 0c             	shr    $0xc,%eax
+  801c8a:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801c91:	f6 c2 01             	test   $0x1,%dl
+  801c94:	75 36                	jne    801ccc <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801c96:	89 f8                	mov    %edi,%eax
+  801c98:	c1 e8 0c             	shr    $0xc,%eax
+  801c9b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801ca2:	83 ec 0c             	sub    $0xc,%esp
+  801ca5:	25 07 0e 00 00       	and    $0xe07,%eax
+  801caa:	50                   	push   %eax
+  801cab:	56                   	push   %esi
+  801cac:	6a 00                	push   $0x0
+  801cae:	57                   	push   %edi
+  801caf:	6a 00                	push   $0x0
+  801cb1:	e8 81 f2 ff ff       	call   800f37 <sys_page_map>
+  801cb6:	89 c3                	mov    %eax,%ebx
+  801cb8:	83 c4 20             	add    $0x20,%esp
+  801cbb:	85 c0                	test   %eax,%eax
+  801cbd:	78 33                	js     801cf2 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801cbf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801cc2:	89 d8                	mov    %ebx,%eax
+  801cc4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cc7:	5b                   	pop    %ebx
+  801cc8:	5e                   	pop    %esi
+  801cc9:	5f                   	pop    %edi
+  801cca:	5d                   	pop    %ebp
+  801ccb:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801ccc:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801cd3:	83 ec 0c             	sub    $0xc,%esp
+  801cd6:	25 07 0e 00 00       	and    $0xe07,%eax
+  801cdb:	50                   	push   %eax
+  801cdc:	ff 75 d4             	push   -0x2c(%ebp)
+  801cdf:	6a 00                	push   $0x0
+  801ce1:	53                   	push   %ebx
+  801ce2:	6a 00                	push   $0x0
+  801ce4:	e8 4e f2 ff ff       	call   800f37 <sys_page_map>
+  801ce9:	89 c3                	mov    %eax,%ebx
+  801ceb:	83 c4 20             	add    $0x20,%esp
+  801cee:	85 c0                	test   %eax,%eax
+  801cf0:	79 a4                	jns    801c96 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801cf2:	83 ec 08             	sub    $0x8,%esp
+  801cf5:	56                   	push   %esi
+  801cf6:	6a 00                	push   $0x0
+  801cf8:	e8 86 f2 ff ff       	call   800f83 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801cfd:	83 c4 08             	add    $0x8,%esp
+  801d00:	ff 75 d4             	push   -0x2c(%ebp)
+  801d03:	6a 00                	push   $0x0
+  801d05:	e8 79 f2 ff ff       	call   800f83 <sys_page_unmap>
+	return r;
+  801d0a:	83 c4 10             	add    $0x10,%esp
+  801d0d:	eb b3                	jmp    801cc2 <dup+0x9d>
+
+00801d0f <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801d0f:	55                   	push   %ebp
+  801d10:	89 e5                	mov    %esp,%ebp
+  801d12:	56                   	push   %esi
+  801d13:	53                   	push   %ebx
+  801d14:	83 ec 18             	sub    $0x18,%esp
+  801d17:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d1a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d1d:	50                   	push   %eax
+  801d1e:	53                   	push   %ebx
+  801d1f:	e8 5b fd ff ff       	call   801a7f <fd_lookup>
+  801d24:	83 c4 10             	add    $0x10,%esp
+  801d27:	85 c0                	test   %eax,%eax
+  801d29:	78 3c                	js     801d67 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d2b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d2e:	83 ec 08             	sub    $0x8,%esp
+  801d31:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d34:	50                   	push   %eax
+  801d35:	ff 36                	push   (%esi)
+  801d37:	e8 93 fd ff ff       	call   801acf <dev_lookup>
+  801d3c:	83 c4 10             	add    $0x10,%esp
+  801d3f:	85 c0                	test   %eax,%eax
+  801d41:	78 24                	js     801d67 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801d43:	8b 46 08             	mov    0x8(%esi),%eax
+  801d46:	83 e0 03             	and    $0x3,%eax
+  801d49:	83 f8 01             	cmp    $0x1,%eax
+  801d4c:	74 20                	je     801d6e <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801d4e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d51:	8b 40 08             	mov    0x8(%eax),%eax
+  801d54:	85 c0                	test   %eax,%eax
+  801d56:	74 61                	je     801db9 <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801d58:	83 ec 04             	sub    $0x4,%esp
+  801d5b:	ff 75 10             	push   0x10(%ebp)
+  801d5e:	ff 75 0c             	push   0xc(%ebp)
+  801d61:	56                   	push   %esi
+  801d62:	ff d0                	call   *%eax
+  801d64:	83 c4 10             	add    $0x10,%esp
+}
+  801d67:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d6a:	5b                   	pop    %ebx
+  801d6b:	5e                   	pop    %esi
+  801d6c:	5d                   	pop    %ebp
+  801d6d:	c3                   	ret
+  801d6e:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801d70:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801d76:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801d7b:	77 18                	ja     801d95 <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801d7d:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801d82:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801d84:	c1 e8 10             	shr    $0x10,%eax
+  801d87:	74 0c                	je     801d95 <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801d89:	c1 e0 10             	shl    $0x10,%eax
+  801d8c:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801d91:	29 c2                	sub    %eax,%edx
+  801d93:	eb 06                	jmp    801d9b <read+0x8c>
+		return pthread_main_tls;
+  801d95:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d9b:	8b 02                	mov    (%edx),%eax
+  801d9d:	8b 40 48             	mov    0x48(%eax),%eax
+  801da0:	83 ec 04             	sub    $0x4,%esp
+  801da3:	53                   	push   %ebx
+  801da4:	50                   	push   %eax
+  801da5:	68 45 51 80 00       	push   $0x805145
+  801daa:	e8 19 e7 ff ff       	call   8004c8 <cprintf>
+		return -E_INVAL;
+  801daf:	83 c4 10             	add    $0x10,%esp
+  801db2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801db7:	eb ae                	jmp    801d67 <read+0x58>
+		return -E_NOT_SUPP;
+  801db9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801dbe:	eb a7                	jmp    801d67 <read+0x58>
+
+00801dc0 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801dc0:	55                   	push   %ebp
+  801dc1:	89 e5                	mov    %esp,%ebp
+  801dc3:	57                   	push   %edi
+  801dc4:	56                   	push   %esi
+  801dc5:	53                   	push   %ebx
+  801dc6:	83 ec 0c             	sub    $0xc,%esp
+  801dc9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801dcc:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801dcf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801dd4:	eb 02                	jmp    801dd8 <readn+0x18>
+  801dd6:	01 c3                	add    %eax,%ebx
+  801dd8:	39 f3                	cmp    %esi,%ebx
+  801dda:	73 21                	jae    801dfd <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801ddc:	83 ec 04             	sub    $0x4,%esp
+  801ddf:	89 f0                	mov    %esi,%eax
+  801de1:	29 d8                	sub    %ebx,%eax
+  801de3:	50                   	push   %eax
+  801de4:	89 d8                	mov    %ebx,%eax
+  801de6:	03 45 0c             	add    0xc(%ebp),%eax
+  801de9:	50                   	push   %eax
+  801dea:	57                   	push   %edi
+  801deb:	e8 1f ff ff ff       	call   801d0f <read>
+		if (m < 0)
+  801df0:	83 c4 10             	add    $0x10,%esp
+  801df3:	85 c0                	test   %eax,%eax
+  801df5:	78 04                	js     801dfb <readn+0x3b>
+			return m;
+		if (m == 0)
+  801df7:	75 dd                	jne    801dd6 <readn+0x16>
+  801df9:	eb 02                	jmp    801dfd <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801dfb:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801dfd:	89 d8                	mov    %ebx,%eax
+  801dff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e02:	5b                   	pop    %ebx
+  801e03:	5e                   	pop    %esi
+  801e04:	5f                   	pop    %edi
+  801e05:	5d                   	pop    %ebp
+  801e06:	c3                   	ret
+
+00801e07 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801e07:	55                   	push   %ebp
+  801e08:	89 e5                	mov    %esp,%ebp
+  801e0a:	56                   	push   %esi
+  801e0b:	53                   	push   %ebx
+  801e0c:	83 ec 18             	sub    $0x18,%esp
+  801e0f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801e12:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e15:	50                   	push   %eax
+  801e16:	53                   	push   %ebx
+  801e17:	e8 63 fc ff ff       	call   801a7f <fd_lookup>
+  801e1c:	83 c4 10             	add    $0x10,%esp
+  801e1f:	85 c0                	test   %eax,%eax
+  801e21:	78 37                	js     801e5a <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801e23:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e26:	83 ec 08             	sub    $0x8,%esp
+  801e29:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e2c:	50                   	push   %eax
+  801e2d:	ff 36                	push   (%esi)
+  801e2f:	e8 9b fc ff ff       	call   801acf <dev_lookup>
+  801e34:	83 c4 10             	add    $0x10,%esp
+  801e37:	85 c0                	test   %eax,%eax
+  801e39:	78 1f                	js     801e5a <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e3b:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801e3f:	74 20                	je     801e61 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801e41:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e44:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e47:	85 c0                	test   %eax,%eax
+  801e49:	74 61                	je     801eac <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801e4b:	83 ec 04             	sub    $0x4,%esp
+  801e4e:	ff 75 10             	push   0x10(%ebp)
+  801e51:	ff 75 0c             	push   0xc(%ebp)
+  801e54:	56                   	push   %esi
+  801e55:	ff d0                	call   *%eax
+  801e57:	83 c4 10             	add    $0x10,%esp
+}
+  801e5a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e5d:	5b                   	pop    %ebx
+  801e5e:	5e                   	pop    %esi
+  801e5f:	5d                   	pop    %ebp
+  801e60:	c3                   	ret
+  801e61:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801e63:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801e69:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801e6e:	77 18                	ja     801e88 <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801e70:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801e75:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801e77:	c1 e8 10             	shr    $0x10,%eax
+  801e7a:	74 0c                	je     801e88 <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801e7c:	c1 e0 10             	shl    $0x10,%eax
+  801e7f:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801e84:	29 c2                	sub    %eax,%edx
+  801e86:	eb 06                	jmp    801e8e <write+0x87>
+		return pthread_main_tls;
+  801e88:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e8e:	8b 02                	mov    (%edx),%eax
+  801e90:	8b 40 48             	mov    0x48(%eax),%eax
+  801e93:	83 ec 04             	sub    $0x4,%esp
+  801e96:	53                   	push   %ebx
+  801e97:	50                   	push   %eax
+  801e98:	68 61 51 80 00       	push   $0x805161
+  801e9d:	e8 26 e6 ff ff       	call   8004c8 <cprintf>
+		return -E_INVAL;
+  801ea2:	83 c4 10             	add    $0x10,%esp
+  801ea5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801eaa:	eb ae                	jmp    801e5a <write+0x53>
+		return -E_NOT_SUPP;
+  801eac:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801eb1:	eb a7                	jmp    801e5a <write+0x53>
+
+00801eb3 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801eb3:	55                   	push   %ebp
+  801eb4:	89 e5                	mov    %esp,%ebp
+  801eb6:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801eb9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ebc:	50                   	push   %eax
+  801ebd:	ff 75 08             	push   0x8(%ebp)
+  801ec0:	e8 ba fb ff ff       	call   801a7f <fd_lookup>
+  801ec5:	83 c4 10             	add    $0x10,%esp
+  801ec8:	85 c0                	test   %eax,%eax
+  801eca:	78 0e                	js     801eda <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801ecc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ecf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ed2:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801ed5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801eda:	c9                   	leave
+  801edb:	c3                   	ret
+
+00801edc <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801edc:	55                   	push   %ebp
+  801edd:	89 e5                	mov    %esp,%ebp
+  801edf:	56                   	push   %esi
+  801ee0:	53                   	push   %ebx
+  801ee1:	83 ec 18             	sub    $0x18,%esp
+  801ee4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ee7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801eea:	50                   	push   %eax
+  801eeb:	53                   	push   %ebx
+  801eec:	e8 8e fb ff ff       	call   801a7f <fd_lookup>
+  801ef1:	83 c4 10             	add    $0x10,%esp
+  801ef4:	85 c0                	test   %eax,%eax
+  801ef6:	78 34                	js     801f2c <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ef8:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801efb:	83 ec 08             	sub    $0x8,%esp
+  801efe:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f01:	50                   	push   %eax
+  801f02:	ff 36                	push   (%esi)
+  801f04:	e8 c6 fb ff ff       	call   801acf <dev_lookup>
+  801f09:	83 c4 10             	add    $0x10,%esp
+  801f0c:	85 c0                	test   %eax,%eax
+  801f0e:	78 1c                	js     801f2c <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f10:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801f14:	74 1d                	je     801f33 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801f16:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f19:	8b 40 18             	mov    0x18(%eax),%eax
+  801f1c:	85 c0                	test   %eax,%eax
+  801f1e:	74 5e                	je     801f7e <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801f20:	83 ec 08             	sub    $0x8,%esp
+  801f23:	ff 75 0c             	push   0xc(%ebp)
+  801f26:	56                   	push   %esi
+  801f27:	ff d0                	call   *%eax
+  801f29:	83 c4 10             	add    $0x10,%esp
+}
+  801f2c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f2f:	5b                   	pop    %ebx
+  801f30:	5e                   	pop    %esi
+  801f31:	5d                   	pop    %ebp
+  801f32:	c3                   	ret
+  801f33:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801f35:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801f3b:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801f40:	77 18                	ja     801f5a <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801f42:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801f47:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801f49:	c1 e8 10             	shr    $0x10,%eax
+  801f4c:	74 0c                	je     801f5a <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801f4e:	c1 e0 10             	shl    $0x10,%eax
+  801f51:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801f56:	29 c2                	sub    %eax,%edx
+  801f58:	eb 06                	jmp    801f60 <ftruncate+0x84>
+		return pthread_main_tls;
+  801f5a:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+			thisenv->env_id, fdnum);
+  801f60:	8b 02                	mov    (%edx),%eax
+  801f62:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801f65:	83 ec 04             	sub    $0x4,%esp
+  801f68:	53                   	push   %ebx
+  801f69:	50                   	push   %eax
+  801f6a:	68 24 51 80 00       	push   $0x805124
+  801f6f:	e8 54 e5 ff ff       	call   8004c8 <cprintf>
+		return -E_INVAL;
+  801f74:	83 c4 10             	add    $0x10,%esp
+  801f77:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f7c:	eb ae                	jmp    801f2c <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801f7e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f83:	eb a7                	jmp    801f2c <ftruncate+0x50>
+
+00801f85 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801f85:	55                   	push   %ebp
+  801f86:	89 e5                	mov    %esp,%ebp
+  801f88:	56                   	push   %esi
+  801f89:	53                   	push   %ebx
+  801f8a:	83 ec 18             	sub    $0x18,%esp
+  801f8d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801f90:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f93:	50                   	push   %eax
+  801f94:	ff 75 08             	push   0x8(%ebp)
+  801f97:	e8 e3 fa ff ff       	call   801a7f <fd_lookup>
+  801f9c:	83 c4 10             	add    $0x10,%esp
+  801f9f:	85 c0                	test   %eax,%eax
+  801fa1:	78 49                	js     801fec <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801fa3:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801fa6:	83 ec 08             	sub    $0x8,%esp
+  801fa9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fac:	50                   	push   %eax
+  801fad:	ff 36                	push   (%esi)
+  801faf:	e8 1b fb ff ff       	call   801acf <dev_lookup>
+  801fb4:	83 c4 10             	add    $0x10,%esp
+  801fb7:	85 c0                	test   %eax,%eax
+  801fb9:	78 31                	js     801fec <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801fbb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801fbe:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801fc2:	74 2f                	je     801ff3 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801fc4:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801fc7:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801fce:	00 00 00 
+	stat->st_isdir = 0;
+  801fd1:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801fd8:	00 00 00 
+	stat->st_dev = dev;
+  801fdb:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801fe1:	83 ec 08             	sub    $0x8,%esp
+  801fe4:	53                   	push   %ebx
+  801fe5:	56                   	push   %esi
+  801fe6:	ff 50 14             	call   *0x14(%eax)
+  801fe9:	83 c4 10             	add    $0x10,%esp
+}
+  801fec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fef:	5b                   	pop    %ebx
+  801ff0:	5e                   	pop    %esi
+  801ff1:	5d                   	pop    %ebp
+  801ff2:	c3                   	ret
+		return -E_NOT_SUPP;
+  801ff3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ff8:	eb f2                	jmp    801fec <fstat+0x67>
+
+00801ffa <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801ffa:	55                   	push   %ebp
+  801ffb:	89 e5                	mov    %esp,%ebp
+  801ffd:	56                   	push   %esi
+  801ffe:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801fff:	83 ec 08             	sub    $0x8,%esp
+  802002:	6a 00                	push   $0x0
+  802004:	ff 75 08             	push   0x8(%ebp)
+  802007:	e8 4b 03 00 00       	call   802357 <open>
+  80200c:	89 c3                	mov    %eax,%ebx
+  80200e:	83 c4 10             	add    $0x10,%esp
+  802011:	85 c0                	test   %eax,%eax
+  802013:	78 1b                	js     802030 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  802015:	83 ec 08             	sub    $0x8,%esp
+  802018:	ff 75 0c             	push   0xc(%ebp)
+  80201b:	50                   	push   %eax
+  80201c:	e8 64 ff ff ff       	call   801f85 <fstat>
+  802021:	89 c6                	mov    %eax,%esi
+	close(fd);
+  802023:	89 1c 24             	mov    %ebx,(%esp)
+  802026:	e8 a8 fb ff ff       	call   801bd3 <close>
+	return r;
+  80202b:	83 c4 10             	add    $0x10,%esp
+  80202e:	89 f3                	mov    %esi,%ebx
+}
+  802030:	89 d8                	mov    %ebx,%eax
+  802032:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802035:	5b                   	pop    %ebx
+  802036:	5e                   	pop    %esi
+  802037:	5d                   	pop    %ebp
+  802038:	c3                   	ret
+
+00802039 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  802039:	55                   	push   %ebp
+  80203a:	89 e5                	mov    %esp,%ebp
+  80203c:	56                   	push   %esi
+  80203d:	53                   	push   %ebx
+  80203e:	89 c6                	mov    %eax,%esi
+  802040:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  802042:	83 3d 0c 70 80 00 00 	cmpl   $0x0,0x80700c
+  802049:	74 27                	je     802072 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80204b:	6a 07                	push   $0x7
+  80204d:	68 00 80 80 00       	push   $0x808000
+  802052:	56                   	push   %esi
+  802053:	ff 35 0c 70 80 00    	push   0x80700c
+  802059:	e8 8d 26 00 00       	call   8046eb <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  80205e:	83 c4 0c             	add    $0xc,%esp
+  802061:	6a 00                	push   $0x0
+  802063:	53                   	push   %ebx
+  802064:	6a 00                	push   $0x0
+  802066:	e8 8a 25 00 00       	call   8045f5 <ipc_recv>
+}
+  80206b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80206e:	5b                   	pop    %ebx
+  80206f:	5e                   	pop    %esi
+  802070:	5d                   	pop    %ebp
+  802071:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802072:	83 ec 0c             	sub    $0xc,%esp
+  802075:	6a 01                	push   $0x1
+  802077:	e8 c5 26 00 00       	call   804741 <ipc_find_env>
+  80207c:	a3 0c 70 80 00       	mov    %eax,0x80700c
+  802081:	83 c4 10             	add    $0x10,%esp
+  802084:	eb c5                	jmp    80204b <fsipc+0x12>
+
+00802086 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  802086:	55                   	push   %ebp
+  802087:	89 e5                	mov    %esp,%ebp
+  802089:	53                   	push   %ebx
+  80208a:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  80208d:	68 10 70 80 00       	push   $0x807010
+  802092:	e8 7a 1b 00 00       	call   803c11 <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802097:	8b 45 08             	mov    0x8(%ebp),%eax
+  80209a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80209d:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.set_size.req_size = newsize;
+  8020a2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020a5:	a3 04 80 80 00       	mov    %eax,0x808004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  8020aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020af:	b8 02 00 00 00       	mov    $0x2,%eax
+  8020b4:	e8 80 ff ff ff       	call   802039 <fsipc>
+  8020b9:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8020bb:	c7 04 24 10 70 80 00 	movl   $0x807010,(%esp)
+  8020c2:	e8 b7 1b 00 00       	call   803c7e <mutex_unlock>
+	return r;
+}
+  8020c7:	89 d8                	mov    %ebx,%eax
+  8020c9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020cc:	c9                   	leave
+  8020cd:	c3                   	ret
+
+008020ce <devfile_flush>:
+{
+  8020ce:	55                   	push   %ebp
+  8020cf:	89 e5                	mov    %esp,%ebp
+  8020d1:	53                   	push   %ebx
+  8020d2:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  8020d5:	68 10 70 80 00       	push   $0x807010
+  8020da:	e8 32 1b 00 00       	call   803c11 <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8020df:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020e2:	8b 40 0c             	mov    0xc(%eax),%eax
+  8020e5:	a3 00 80 80 00       	mov    %eax,0x808000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  8020ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020ef:	b8 06 00 00 00       	mov    $0x6,%eax
+  8020f4:	e8 40 ff ff ff       	call   802039 <fsipc>
+  8020f9:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8020fb:	c7 04 24 10 70 80 00 	movl   $0x807010,(%esp)
+  802102:	e8 77 1b 00 00       	call   803c7e <mutex_unlock>
+}
+  802107:	89 d8                	mov    %ebx,%eax
+  802109:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80210c:	c9                   	leave
+  80210d:	c3                   	ret
+
+0080210e <devfile_stat>:
+{
+  80210e:	55                   	push   %ebp
+  80210f:	89 e5                	mov    %esp,%ebp
+  802111:	56                   	push   %esi
+  802112:	53                   	push   %ebx
+  802113:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  802116:	83 ec 0c             	sub    $0xc,%esp
+  802119:	68 10 70 80 00       	push   $0x807010
+  80211e:	e8 ee 1a 00 00       	call   803c11 <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802123:	8b 45 08             	mov    0x8(%ebp),%eax
+  802126:	8b 40 0c             	mov    0xc(%eax),%eax
+  802129:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  80212e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802133:	b8 05 00 00 00       	mov    $0x5,%eax
+  802138:	e8 fc fe ff ff       	call   802039 <fsipc>
+  80213d:	89 c3                	mov    %eax,%ebx
+  80213f:	83 c4 10             	add    $0x10,%esp
+  802142:	85 c0                	test   %eax,%eax
+  802144:	79 16                	jns    80215c <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  802146:	83 ec 0c             	sub    $0xc,%esp
+  802149:	68 10 70 80 00       	push   $0x807010
+  80214e:	e8 2b 1b 00 00       	call   803c7e <mutex_unlock>
+}
+  802153:	89 d8                	mov    %ebx,%eax
+  802155:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802158:	5b                   	pop    %ebx
+  802159:	5e                   	pop    %esi
+  80215a:	5d                   	pop    %ebp
+  80215b:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80215c:	83 ec 08             	sub    $0x8,%esp
+  80215f:	68 00 80 80 00       	push   $0x808000
+  802164:	56                   	push   %esi
+  802165:	e8 42 e9 ff ff       	call   800aac <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  80216a:	a1 80 80 80 00       	mov    0x808080,%eax
+  80216f:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802175:	a1 84 80 80 00       	mov    0x808084,%eax
+  80217a:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  802180:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  802183:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802188:	eb bc                	jmp    802146 <devfile_stat+0x38>
+
+0080218a <devfile_write>:
+{
+  80218a:	55                   	push   %ebp
+  80218b:	89 e5                	mov    %esp,%ebp
+  80218d:	53                   	push   %ebx
+  80218e:	83 ec 10             	sub    $0x10,%esp
+  802191:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  802194:	68 10 70 80 00       	push   $0x807010
+  802199:	e8 73 1a 00 00       	call   803c11 <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80219e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021a1:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021a4:	a3 00 80 80 00       	mov    %eax,0x808000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  8021a9:	83 c4 10             	add    $0x10,%esp
+  8021ac:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  8021b2:	76 3d                	jbe    8021f1 <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  8021b4:	b8 00 00 10 00       	mov    $0x100000,%eax
+  8021b9:	39 c3                	cmp    %eax,%ebx
+  8021bb:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  8021be:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021c1:	a3 08 80 80 00       	mov    %eax,0x808008
+	fsipcbuf.write.req_n = n;
+  8021c6:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	r = fsipc(FSREQ_WRITE, NULL);
+  8021cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021d1:	b8 04 00 00 00       	mov    $0x4,%eax
+  8021d6:	e8 5e fe ff ff       	call   802039 <fsipc>
+  8021db:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8021dd:	83 ec 0c             	sub    $0xc,%esp
+  8021e0:	68 10 70 80 00       	push   $0x807010
+  8021e5:	e8 94 1a 00 00       	call   803c7e <mutex_unlock>
+}
+  8021ea:	89 d8                	mov    %ebx,%eax
+  8021ec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021ef:	c9                   	leave
+  8021f0:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  8021f1:	83 ec 04             	sub    $0x4,%esp
+  8021f4:	53                   	push   %ebx
+  8021f5:	ff 75 0c             	push   0xc(%ebp)
+  8021f8:	68 0c 80 80 00       	push   $0x80800c
+  8021fd:	e8 30 ea ff ff       	call   800c32 <memmove>
+  802202:	83 c4 10             	add    $0x10,%esp
+  802205:	b8 00 00 00 00       	mov    $0x0,%eax
+  80220a:	eb b5                	jmp    8021c1 <devfile_write+0x37>
+
+0080220c <devfile_read>:
+{
+  80220c:	55                   	push   %ebp
+  80220d:	89 e5                	mov    %esp,%ebp
+  80220f:	57                   	push   %edi
+  802210:	56                   	push   %esi
+  802211:	53                   	push   %ebx
+  802212:	83 ec 0c             	sub    $0xc,%esp
+  802215:	8b 75 08             	mov    0x8(%ebp),%esi
+  802218:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80221b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  80221e:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  802224:	0f 86 8c 00 00 00    	jbe    8022b6 <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  80222a:	b8 00 00 10 00       	mov    $0x100000,%eax
+  80222f:	39 c3                	cmp    %eax,%ebx
+  802231:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  802234:	89 f8                	mov    %edi,%eax
+  802236:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  802239:	eb 0f                	jmp    80224a <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  80223b:	0f b6 08             	movzbl (%eax),%ecx
+  80223e:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  802240:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802245:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  80224a:	39 d0                	cmp    %edx,%eax
+  80224c:	72 ed                	jb     80223b <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  80224e:	83 ec 0c             	sub    $0xc,%esp
+  802251:	68 10 70 80 00       	push   $0x807010
+  802256:	e8 b6 19 00 00       	call   803c11 <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80225b:	8b 46 0c             	mov    0xc(%esi),%eax
+  80225e:	a3 00 80 80 00       	mov    %eax,0x808000
+		fsipcbuf.read.req_n = n;
+  802263:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  802269:	89 3d 08 80 80 00    	mov    %edi,0x808008
+		r = fsipc(FSREQ_READ, NULL);
+  80226f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802274:	b8 03 00 00 00       	mov    $0x3,%eax
+  802279:	e8 bb fd ff ff       	call   802039 <fsipc>
+  80227e:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  802280:	c7 04 24 10 70 80 00 	movl   $0x807010,(%esp)
+  802287:	e8 f2 19 00 00       	call   803c7e <mutex_unlock>
+		assert(r <= (int) n);
+  80228c:	83 c4 10             	add    $0x10,%esp
+  80228f:	39 f3                	cmp    %esi,%ebx
+  802291:	7c 0a                	jl     80229d <devfile_read+0x91>
+}
+  802293:	89 f0                	mov    %esi,%eax
+  802295:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802298:	5b                   	pop    %ebx
+  802299:	5e                   	pop    %esi
+  80229a:	5f                   	pop    %edi
+  80229b:	5d                   	pop    %ebp
+  80229c:	c3                   	ret
+		assert(r <= (int) n);
+  80229d:	68 94 51 80 00       	push   $0x805194
+  8022a2:	68 d1 50 80 00       	push   $0x8050d1
+  8022a7:	68 90 00 00 00       	push   $0x90
+  8022ac:	68 a1 51 80 00       	push   $0x8051a1
+  8022b1:	e8 37 e1 ff ff       	call   8003ed <_panic>
+	mutex_lock(&fsipc_mu);
+  8022b6:	83 ec 0c             	sub    $0xc,%esp
+  8022b9:	68 10 70 80 00       	push   $0x807010
+  8022be:	e8 4e 19 00 00       	call   803c11 <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8022c3:	8b 46 0c             	mov    0xc(%esi),%eax
+  8022c6:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.read.req_n = n;
+  8022cb:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	fsipcbuf.read.req_va = 0;
+  8022d1:	c7 05 08 80 80 00 00 	movl   $0x0,0x808008
+  8022d8:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  8022db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022e0:	b8 03 00 00 00       	mov    $0x3,%eax
+  8022e5:	e8 4f fd ff ff       	call   802039 <fsipc>
+  8022ea:	89 c6                	mov    %eax,%esi
+  8022ec:	83 c4 10             	add    $0x10,%esp
+  8022ef:	85 c0                	test   %eax,%eax
+  8022f1:	78 1d                	js     802310 <devfile_read+0x104>
+		assert(r <= n);
+  8022f3:	39 c3                	cmp    %eax,%ebx
+  8022f5:	72 2e                	jb     802325 <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  8022f7:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8022fc:	7f 40                	jg     80233e <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8022fe:	83 ec 04             	sub    $0x4,%esp
+  802301:	50                   	push   %eax
+  802302:	68 00 80 80 00       	push   $0x808000
+  802307:	57                   	push   %edi
+  802308:	e8 25 e9 ff ff       	call   800c32 <memmove>
+  80230d:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  802310:	83 ec 0c             	sub    $0xc,%esp
+  802313:	68 10 70 80 00       	push   $0x807010
+  802318:	e8 61 19 00 00       	call   803c7e <mutex_unlock>
+	return r;
+  80231d:	83 c4 10             	add    $0x10,%esp
+  802320:	e9 6e ff ff ff       	jmp    802293 <devfile_read+0x87>
+		assert(r <= n);
+  802325:	68 ac 51 80 00       	push   $0x8051ac
+  80232a:	68 d1 50 80 00       	push   $0x8050d1
+  80232f:	68 99 00 00 00       	push   $0x99
+  802334:	68 a1 51 80 00       	push   $0x8051a1
+  802339:	e8 af e0 ff ff       	call   8003ed <_panic>
+		assert(r <= PGSIZE);
+  80233e:	68 b3 51 80 00       	push   $0x8051b3
+  802343:	68 d1 50 80 00       	push   $0x8050d1
+  802348:	68 9a 00 00 00       	push   $0x9a
+  80234d:	68 a1 51 80 00       	push   $0x8051a1
+  802352:	e8 96 e0 ff ff       	call   8003ed <_panic>
+
+00802357 <open>:
+{
+  802357:	55                   	push   %ebp
+  802358:	89 e5                	mov    %esp,%ebp
+  80235a:	56                   	push   %esi
+  80235b:	53                   	push   %ebx
+  80235c:	83 ec 1c             	sub    $0x1c,%esp
+  80235f:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802362:	56                   	push   %esi
+  802363:	e8 09 e7 ff ff       	call   800a71 <strlen>
+  802368:	83 c4 10             	add    $0x10,%esp
+  80236b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802370:	0f 8f 85 00 00 00    	jg     8023fb <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  802376:	83 ec 0c             	sub    $0xc,%esp
+  802379:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80237c:	50                   	push   %eax
+  80237d:	e8 a7 f6 ff ff       	call   801a29 <fd_alloc>
+  802382:	89 c3                	mov    %eax,%ebx
+  802384:	83 c4 10             	add    $0x10,%esp
+  802387:	85 c0                	test   %eax,%eax
+  802389:	78 55                	js     8023e0 <open+0x89>
+	mutex_lock(&fsipc_mu);
+  80238b:	83 ec 0c             	sub    $0xc,%esp
+  80238e:	68 10 70 80 00       	push   $0x807010
+  802393:	e8 79 18 00 00       	call   803c11 <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  802398:	83 c4 08             	add    $0x8,%esp
+  80239b:	56                   	push   %esi
+  80239c:	68 00 80 80 00       	push   $0x808000
+  8023a1:	e8 06 e7 ff ff       	call   800aac <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8023a6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023a9:	a3 00 84 80 00       	mov    %eax,0x808400
+	r = fsipc(FSREQ_OPEN, fd);
+  8023ae:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8023b1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8023b6:	e8 7e fc ff ff       	call   802039 <fsipc>
+  8023bb:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8023bd:	c7 04 24 10 70 80 00 	movl   $0x807010,(%esp)
+  8023c4:	e8 b5 18 00 00       	call   803c7e <mutex_unlock>
+	if (r < 0) {
+  8023c9:	83 c4 10             	add    $0x10,%esp
+  8023cc:	85 db                	test   %ebx,%ebx
+  8023ce:	78 19                	js     8023e9 <open+0x92>
+	return fd2num(fd);
+  8023d0:	83 ec 0c             	sub    $0xc,%esp
+  8023d3:	ff 75 f4             	push   -0xc(%ebp)
+  8023d6:	e8 27 f6 ff ff       	call   801a02 <fd2num>
+  8023db:	89 c3                	mov    %eax,%ebx
+  8023dd:	83 c4 10             	add    $0x10,%esp
+}
+  8023e0:	89 d8                	mov    %ebx,%eax
+  8023e2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023e5:	5b                   	pop    %ebx
+  8023e6:	5e                   	pop    %esi
+  8023e7:	5d                   	pop    %ebp
+  8023e8:	c3                   	ret
+		fd_close(fd, 0);
+  8023e9:	83 ec 08             	sub    $0x8,%esp
+  8023ec:	6a 00                	push   $0x0
+  8023ee:	ff 75 f4             	push   -0xc(%ebp)
+  8023f1:	e8 56 f7 ff ff       	call   801b4c <fd_close>
+		return r;
+  8023f6:	83 c4 10             	add    $0x10,%esp
+  8023f9:	eb e5                	jmp    8023e0 <open+0x89>
+		return -E_BAD_PATH;
+  8023fb:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802400:	eb de                	jmp    8023e0 <open+0x89>
+
+00802402 <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  802402:	55                   	push   %ebp
+  802403:	89 e5                	mov    %esp,%ebp
+  802405:	53                   	push   %ebx
+  802406:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802409:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80240c:	50                   	push   %eax
+  80240d:	ff 75 08             	push   0x8(%ebp)
+  802410:	e8 6a f6 ff ff       	call   801a7f <fd_lookup>
+  802415:	89 c3                	mov    %eax,%ebx
+  802417:	83 c4 10             	add    $0x10,%esp
+  80241a:	85 c0                	test   %eax,%eax
+  80241c:	78 5b                	js     802479 <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  80241e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802421:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  802427:	39 08                	cmp    %ecx,(%eax)
+  802429:	75 55                	jne    802480 <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  80242b:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  80242f:	74 56                	je     802487 <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  802431:	83 ec 0c             	sub    $0xc,%esp
+  802434:	68 10 70 80 00       	push   $0x807010
+  802439:	e8 d3 17 00 00       	call   803c11 <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  80243e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802441:	8b 40 0c             	mov    0xc(%eax),%eax
+  802444:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.allocate.req_offset = offset;
+  802449:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80244c:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.allocate.req_len = len;
+  802451:	8b 45 10             	mov    0x10(%ebp),%eax
+  802454:	a3 08 80 80 00       	mov    %eax,0x808008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  802459:	ba 00 00 00 00       	mov    $0x0,%edx
+  80245e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802463:	e8 d1 fb ff ff       	call   802039 <fsipc>
+  802468:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80246a:	c7 04 24 10 70 80 00 	movl   $0x807010,(%esp)
+  802471:	e8 08 18 00 00       	call   803c7e <mutex_unlock>
+	return r;
+  802476:	83 c4 10             	add    $0x10,%esp
+}
+  802479:	89 d8                	mov    %ebx,%eax
+  80247b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80247e:	c9                   	leave
+  80247f:	c3                   	ret
+		return -E_NOT_SUPP;
+  802480:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802485:	eb f2                	jmp    802479 <fallocate+0x77>
+		return -E_INVAL;
+  802487:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80248c:	eb eb                	jmp    802479 <fallocate+0x77>
+
+0080248e <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  80248e:	55                   	push   %ebp
+  80248f:	89 e5                	mov    %esp,%ebp
+  802491:	56                   	push   %esi
+  802492:	53                   	push   %ebx
+  802493:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  802496:	89 f3                	mov    %esi,%ebx
+  802498:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  80249e:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  8024a1:	eb 06                	jmp    8024a9 <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  8024a3:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8024a9:	39 f3                	cmp    %esi,%ebx
+  8024ab:	73 14                	jae    8024c1 <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  8024ad:	83 ec 08             	sub    $0x8,%esp
+  8024b0:	53                   	push   %ebx
+  8024b1:	6a 00                	push   $0x0
+  8024b3:	e8 cb ea ff ff       	call   800f83 <sys_page_unmap>
+  8024b8:	83 c4 10             	add    $0x10,%esp
+  8024bb:	85 c0                	test   %eax,%eax
+  8024bd:	79 e4                	jns    8024a3 <munmap+0x15>
+  8024bf:	eb 05                	jmp    8024c6 <munmap+0x38>
+			return r;
+	return 0;
+  8024c1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024c6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024c9:	5b                   	pop    %ebx
+  8024ca:	5e                   	pop    %esi
+  8024cb:	5d                   	pop    %ebp
+  8024cc:	c3                   	ret
+
+008024cd <mmap>:
+{
+  8024cd:	55                   	push   %ebp
+  8024ce:	89 e5                	mov    %esp,%ebp
+  8024d0:	57                   	push   %edi
+  8024d1:	56                   	push   %esi
+  8024d2:	53                   	push   %ebx
+  8024d3:	83 ec 24             	sub    $0x24,%esp
+  8024d6:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  8024d9:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8024dc:	50                   	push   %eax
+  8024dd:	ff 75 08             	push   0x8(%ebp)
+  8024e0:	e8 9a f5 ff ff       	call   801a7f <fd_lookup>
+  8024e5:	83 c4 10             	add    $0x10,%esp
+  8024e8:	85 c0                	test   %eax,%eax
+  8024ea:	0f 88 37 01 00 00    	js     802627 <mmap+0x15a>
+		return NULL;
+  8024f0:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  8024f5:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8024f8:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  8024fe:	39 0a                	cmp    %ecx,(%edx)
+  802500:	0f 85 05 01 00 00    	jne    80260b <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  802506:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  80250d:	0f 85 1b 01 00 00    	jne    80262e <mmap+0x161>
+  802513:	89 f0                	mov    %esi,%eax
+  802515:	83 e8 01             	sub    $0x1,%eax
+  802518:	0f 88 17 01 00 00    	js     802635 <mmap+0x168>
+	if (prot & PROT_WRITE)
+  80251e:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  802522:	75 28                	jne    80254c <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  802524:	83 ec 0c             	sub    $0xc,%esp
+  802527:	68 10 70 80 00       	push   $0x807010
+  80252c:	e8 e0 16 00 00       	call   803c11 <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  802531:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  802537:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  80253d:	83 c4 10             	add    $0x10,%esp
+  802540:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  802545:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  80254a:	eb 2b                	jmp    802577 <mmap+0xaa>
+		cow_enable();
+  80254c:	e8 40 f0 ff ff       	call   801591 <cow_enable>
+  802551:	eb d1                	jmp    802524 <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  802553:	89 c2                	mov    %eax,%edx
+  802555:	c1 ea 0c             	shr    $0xc,%edx
+  802558:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  80255f:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  802565:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  80256b:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  80256e:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  802570:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  802575:	77 25                	ja     80259c <mmap+0xcf>
+  802577:	89 c2                	mov    %eax,%edx
+  802579:	29 da                	sub    %ebx,%edx
+  80257b:	39 ca                	cmp    %ecx,%edx
+  80257d:	73 3a                	jae    8025b9 <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  80257f:	89 c2                	mov    %eax,%edx
+  802581:	c1 ea 16             	shr    $0x16,%edx
+  802584:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80258b:	f6 c2 01             	test   $0x1,%dl
+  80258e:	75 c3                	jne    802553 <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  802590:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  802595:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  80259a:	eb d4                	jmp    802570 <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  80259c:	29 d8                	sub    %ebx,%eax
+  80259e:	39 c8                	cmp    %ecx,%eax
+  8025a0:	73 17                	jae    8025b9 <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  8025a2:	83 ec 0c             	sub    $0xc,%esp
+  8025a5:	68 10 70 80 00       	push   $0x807010
+  8025aa:	e8 cf 16 00 00       	call   803c7e <mutex_unlock>
+		return NULL;
+  8025af:	83 c4 10             	add    $0x10,%esp
+  8025b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025b7:	eb 52                	jmp    80260b <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  8025b9:	85 db                	test   %ebx,%ebx
+  8025bb:	74 e5                	je     8025a2 <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8025bd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8025c0:	8b 40 0c             	mov    0xc(%eax),%eax
+  8025c3:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.map.req_offset = offset;
+  8025c8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025cb:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.map.req_len = len;
+  8025d0:	89 35 08 80 80 00    	mov    %esi,0x808008
+	fsipcbuf.map.req_va = va;
+  8025d6:	89 1d 0c 80 80 00    	mov    %ebx,0x80800c
+	fsipcbuf.map.req_prot = prot;
+  8025dc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8025df:	a3 10 80 80 00       	mov    %eax,0x808010
+	r = fsipc(FSREQ_MAP, NULL);
+  8025e4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025e9:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8025ee:	e8 46 fa ff ff       	call   802039 <fsipc>
+  8025f3:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  8025f5:	83 ec 0c             	sub    $0xc,%esp
+  8025f8:	68 10 70 80 00       	push   $0x807010
+  8025fd:	e8 7c 16 00 00       	call   803c7e <mutex_unlock>
+	if (r < 0) {
+  802602:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  802605:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  802607:	85 ff                	test   %edi,%edi
+  802609:	78 08                	js     802613 <mmap+0x146>
+}
+  80260b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80260e:	5b                   	pop    %ebx
+  80260f:	5e                   	pop    %esi
+  802610:	5f                   	pop    %edi
+  802611:	5d                   	pop    %ebp
+  802612:	c3                   	ret
+		munmap((void*) va, len);
+  802613:	83 ec 08             	sub    $0x8,%esp
+  802616:	56                   	push   %esi
+  802617:	53                   	push   %ebx
+  802618:	e8 71 fe ff ff       	call   80248e <munmap>
+		return NULL;
+  80261d:	83 c4 10             	add    $0x10,%esp
+  802620:	b8 00 00 00 00       	mov    $0x0,%eax
+  802625:	eb e4                	jmp    80260b <mmap+0x13e>
+		return NULL;
+  802627:	b8 00 00 00 00       	mov    $0x0,%eax
+  80262c:	eb dd                	jmp    80260b <mmap+0x13e>
+		return NULL;
+  80262e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802633:	eb d6                	jmp    80260b <mmap+0x13e>
+  802635:	b8 00 00 00 00       	mov    $0x0,%eax
+  80263a:	eb cf                	jmp    80260b <mmap+0x13e>
+
+0080263c <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  80263c:	55                   	push   %ebp
+  80263d:	89 e5                	mov    %esp,%ebp
+  80263f:	53                   	push   %ebx
+  802640:	83 ec 10             	sub    $0x10,%esp
+  802643:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802646:	53                   	push   %ebx
+  802647:	e8 25 e4 ff ff       	call   800a71 <strlen>
+  80264c:	83 c4 10             	add    $0x10,%esp
+  80264f:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802654:	7f 42                	jg     802698 <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  802656:	83 ec 0c             	sub    $0xc,%esp
+  802659:	68 10 70 80 00       	push   $0x807010
+  80265e:	e8 ae 15 00 00       	call   803c11 <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  802663:	83 c4 08             	add    $0x8,%esp
+  802666:	53                   	push   %ebx
+  802667:	68 00 80 80 00       	push   $0x808000
+  80266c:	e8 3b e4 ff ff       	call   800aac <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  802671:	ba 00 00 00 00       	mov    $0x0,%edx
+  802676:	b8 07 00 00 00       	mov    $0x7,%eax
+  80267b:	e8 b9 f9 ff ff       	call   802039 <fsipc>
+  802680:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802682:	c7 04 24 10 70 80 00 	movl   $0x807010,(%esp)
+  802689:	e8 f0 15 00 00       	call   803c7e <mutex_unlock>
+	return r;
+  80268e:	83 c4 10             	add    $0x10,%esp
+}
+  802691:	89 d8                	mov    %ebx,%eax
+  802693:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802696:	c9                   	leave
+  802697:	c3                   	ret
+		return -E_BAD_PATH;
+  802698:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80269d:	eb f2                	jmp    802691 <remove+0x55>
+
+0080269f <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80269f:	55                   	push   %ebp
+  8026a0:	89 e5                	mov    %esp,%ebp
+  8026a2:	53                   	push   %ebx
+  8026a3:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  8026a6:	68 10 70 80 00       	push   $0x807010
+  8026ab:	e8 61 15 00 00       	call   803c11 <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  8026b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026b5:	b8 08 00 00 00       	mov    $0x8,%eax
+  8026ba:	e8 7a f9 ff ff       	call   802039 <fsipc>
+  8026bf:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8026c1:	c7 04 24 10 70 80 00 	movl   $0x807010,(%esp)
+  8026c8:	e8 b1 15 00 00       	call   803c7e <mutex_unlock>
+	return r;
+}
+  8026cd:	89 d8                	mov    %ebx,%eax
+  8026cf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026d2:	c9                   	leave
+  8026d3:	c3                   	ret
+
+008026d4 <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  8026d4:	55                   	push   %ebp
+  8026d5:	89 e5                	mov    %esp,%ebp
+  8026d7:	56                   	push   %esi
+  8026d8:	53                   	push   %ebx
+  8026d9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  8026dc:	83 ec 0c             	sub    $0xc,%esp
+  8026df:	68 10 70 80 00       	push   $0x807010
+  8026e4:	e8 28 15 00 00       	call   803c11 <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  8026e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026ec:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  8026f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026f6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8026fb:	e8 39 f9 ff ff       	call   802039 <fsipc>
+  802700:	89 c6                	mov    %eax,%esi
+  802702:	83 c4 10             	add    $0x10,%esp
+  802705:	85 db                	test   %ebx,%ebx
+  802707:	74 7b                	je     802784 <fs_bcstat+0xb0>
+  802709:	85 c0                	test   %eax,%eax
+  80270b:	78 77                	js     802784 <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  80270d:	a1 00 80 80 00       	mov    0x808000,%eax
+  802712:	89 03                	mov    %eax,(%ebx)
+  802714:	a1 04 80 80 00       	mov    0x808004,%eax
+  802719:	89 43 04             	mov    %eax,0x4(%ebx)
+  80271c:	a1 08 80 80 00       	mov    0x808008,%eax
+  802721:	89 43 08             	mov    %eax,0x8(%ebx)
+  802724:	a1 0c 80 80 00       	mov    0x80800c,%eax
+  802729:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80272c:	a1 10 80 80 00       	mov    0x808010,%eax
+  802731:	89 43 10             	mov    %eax,0x10(%ebx)
+  802734:	a1 14 80 80 00       	mov    0x808014,%eax
+  802739:	89 43 14             	mov    %eax,0x14(%ebx)
+  80273c:	a1 18 80 80 00       	mov    0x808018,%eax
+  802741:	89 43 18             	mov    %eax,0x18(%ebx)
+  802744:	a1 1c 80 80 00       	mov    0x80801c,%eax
+  802749:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  80274c:	a1 20 80 80 00       	mov    0x808020,%eax
+  802751:	89 43 20             	mov    %eax,0x20(%ebx)
+  802754:	a1 24 80 80 00       	mov    0x808024,%eax
+  802759:	89 43 24             	mov    %eax,0x24(%ebx)
+  80275c:	a1 28 80 80 00       	mov    0x808028,%eax
+  802761:	89 43 28             	mov    %eax,0x28(%ebx)
+  802764:	a1 2c 80 80 00       	mov    0x80802c,%eax
+  802769:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  80276c:	a1 30 80 80 00       	mov    0x808030,%eax
+  802771:	89 43 30             	mov    %eax,0x30(%ebx)
+  802774:	a1 34 80 80 00       	mov    0x808034,%eax
+  802779:	89 43 34             	mov    %eax,0x34(%ebx)
+  80277c:	a1 38 80 80 00       	mov    0x808038,%eax
+  802781:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  802784:	83 ec 0c             	sub    $0xc,%esp
+  802787:	68 10 70 80 00       	push   $0x807010
+  80278c:	e8 ed 14 00 00       	call   803c7e <mutex_unlock>
+	return r;
+}
+  802791:	89 f0                	mov    %esi,%eax
+  802793:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802796:	5b                   	pop    %ebx
+  802797:	5e                   	pop    %esi
+  802798:	5d                   	pop    %ebp
+  802799:	c3                   	ret
+
+0080279a <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  80279a:	55                   	push   %ebp
+  80279b:	89 e5                	mov    %esp,%ebp
+  80279d:	56                   	push   %esi
+  80279e:	53                   	push   %ebx
+  80279f:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  8027a1:	0f b6 10             	movzbl (%eax),%edx
+  8027a4:	80 fa 72             	cmp    $0x72,%dl
+  8027a7:	74 44                	je     8027ed <parse_mode+0x53>
+  8027a9:	80 fa 77             	cmp    $0x77,%dl
+  8027ac:	74 4b                	je     8027f9 <parse_mode+0x5f>
+  8027ae:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8027b3:	80 fa 61             	cmp    $0x61,%dl
+  8027b6:	74 09                	je     8027c1 <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  8027b8:	89 d8                	mov    %ebx,%eax
+  8027ba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027bd:	5b                   	pop    %ebx
+  8027be:	5e                   	pop    %esi
+  8027bf:	5d                   	pop    %ebp
+  8027c0:	c3                   	ret
+	switch (mode[0]) {
+  8027c1:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  8027c6:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  8027cb:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  8027cd:	83 ec 08             	sub    $0x8,%esp
+  8027d0:	6a 2b                	push   $0x2b
+  8027d2:	50                   	push   %eax
+  8027d3:	e8 e6 e3 ff ff       	call   800bbe <strchr>
+  8027d8:	83 c4 10             	add    $0x10,%esp
+  8027db:	85 c0                	test   %eax,%eax
+  8027dd:	74 d9                	je     8027b8 <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  8027df:	83 e3 fc             	and    $0xfffffffc,%ebx
+  8027e2:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  8027e5:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  8027eb:	eb cb                	jmp    8027b8 <parse_mode+0x1e>
+	switch (mode[0]) {
+  8027ed:	ba 01 00 00 00       	mov    $0x1,%edx
+  8027f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027f7:	eb d2                	jmp    8027cb <parse_mode+0x31>
+  8027f9:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  8027fe:	bb 01 03 00 00       	mov    $0x301,%ebx
+  802803:	eb c6                	jmp    8027cb <parse_mode+0x31>
+
+00802805 <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  802805:	55                   	push   %ebp
+  802806:	89 e5                	mov    %esp,%ebp
+  802808:	57                   	push   %edi
+  802809:	56                   	push   %esi
+  80280a:	53                   	push   %ebx
+  80280b:	83 ec 1c             	sub    $0x1c,%esp
+  80280e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802811:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  802814:	b8 24 60 80 00       	mov    $0x806024,%eax
+  802819:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  80281e:	83 c0 24             	add    $0x24,%eax
+  802821:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  802825:	74 17                	je     80283e <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  802827:	83 c3 01             	add    $0x1,%ebx
+  80282a:	83 fb 10             	cmp    $0x10,%ebx
+  80282d:	75 ef                	jne    80281e <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  80282f:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  802834:	89 f0                	mov    %esi,%eax
+  802836:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802839:	5b                   	pop    %ebx
+  80283a:	5e                   	pop    %esi
+  80283b:	5f                   	pop    %edi
+  80283c:	5d                   	pop    %ebp
+  80283d:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  80283e:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  802845:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802848:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  80284b:	c1 e7 02             	shl    $0x2,%edi
+  80284e:	8d b7 20 60 80 00    	lea    0x806020(%edi),%esi
+  802854:	83 ec 04             	sub    $0x4,%esp
+  802857:	6a 24                	push   $0x24
+  802859:	6a 00                	push   $0x0
+  80285b:	56                   	push   %esi
+  80285c:	e8 9c e3 ff ff       	call   800bfd <memset>
+			streams[i].f_fd = fd;
+  802861:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802864:	89 8f 20 60 80 00    	mov    %ecx,0x806020(%edi)
+			streams[i].f_flags = flags;
+  80286a:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80286d:	01 d8                	add    %ebx,%eax
+  80286f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802872:	89 0c 85 24 60 80 00 	mov    %ecx,0x806024(,%eax,4)
+			return &streams[i];
+  802879:	83 c4 10             	add    $0x10,%esp
+  80287c:	eb b6                	jmp    802834 <stream_alloc+0x2f>
+
+0080287e <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  80287e:	55                   	push   %ebp
+  80287f:	89 e5                	mov    %esp,%ebp
+  802881:	53                   	push   %ebx
+  802882:	83 ec 14             	sub    $0x14,%esp
+  802885:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  802887:	8b 40 18             	mov    0x18(%eax),%eax
+  80288a:	39 43 14             	cmp    %eax,0x14(%ebx)
+  80288d:	74 4a                	je     8028d9 <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  80288f:	83 ec 08             	sub    $0x8,%esp
+  802892:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802895:	50                   	push   %eax
+  802896:	ff 33                	push   (%ebx)
+  802898:	e8 e2 f1 ff ff       	call   801a7f <fd_lookup>
+  80289d:	89 c2                	mov    %eax,%edx
+  80289f:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8028a2:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  8028a7:	85 d2                	test   %edx,%edx
+  8028a9:	78 41                	js     8028ec <stream_unread+0x6e>
+  8028ab:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8028ae:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  8028b4:	39 0a                	cmp    %ecx,(%edx)
+  8028b6:	75 34                	jne    8028ec <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  8028b8:	8b 43 14             	mov    0x14(%ebx),%eax
+  8028bb:	03 42 04             	add    0x4(%edx),%eax
+  8028be:	2b 43 18             	sub    0x18(%ebx),%eax
+  8028c1:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  8028c4:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  8028cb:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  8028d2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8028d7:	eb 13                	jmp    8028ec <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  8028d9:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  8028e0:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  8028e7:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8028ec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028ef:	c9                   	leave
+  8028f0:	c3                   	ret
+
+008028f1 <stream_drain>:
+{
+  8028f1:	55                   	push   %ebp
+  8028f2:	89 e5                	mov    %esp,%ebp
+  8028f4:	56                   	push   %esi
+  8028f5:	53                   	push   %ebx
+  8028f6:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  8028f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028fd:	eb 02                	jmp    802901 <stream_drain+0x10>
+  8028ff:	01 c3                	add    %eax,%ebx
+  802901:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802904:	39 c3                	cmp    %eax,%ebx
+  802906:	73 43                	jae    80294b <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  802908:	83 ec 04             	sub    $0x4,%esp
+  80290b:	29 d8                	sub    %ebx,%eax
+  80290d:	50                   	push   %eax
+  80290e:	89 d8                	mov    %ebx,%eax
+  802910:	03 46 0c             	add    0xc(%esi),%eax
+  802913:	50                   	push   %eax
+  802914:	ff 36                	push   (%esi)
+  802916:	e8 ec f4 ff ff       	call   801e07 <write>
+  80291b:	83 c4 10             	add    $0x10,%esp
+  80291e:	85 c0                	test   %eax,%eax
+  802920:	7f dd                	jg     8028ff <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  802922:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  802926:	8b 56 0c             	mov    0xc(%esi),%edx
+  802929:	83 ec 04             	sub    $0x4,%esp
+  80292c:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80292f:	29 d8                	sub    %ebx,%eax
+  802931:	50                   	push   %eax
+  802932:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  802935:	50                   	push   %eax
+  802936:	52                   	push   %edx
+  802937:	e8 f6 e2 ff ff       	call   800c32 <memmove>
+			f->f_wend -= done;
+  80293c:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80293f:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  802941:	83 c4 10             	add    $0x10,%esp
+  802944:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  802949:	eb 0a                	jmp    802955 <stream_drain+0x64>
+  80294b:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  802950:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  802955:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  802958:	89 d0                	mov    %edx,%eax
+  80295a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80295d:	5b                   	pop    %ebx
+  80295e:	5e                   	pop    %esi
+  80295f:	5d                   	pop    %ebp
+  802960:	c3                   	ret
+
+00802961 <stream_setup>:
+	if (f->f_buf)
+  802961:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802965:	74 01                	je     802968 <stream_setup+0x7>
+  802967:	c3                   	ret
+{
+  802968:	55                   	push   %ebp
+  802969:	89 e5                	mov    %esp,%ebp
+  80296b:	53                   	push   %ebx
+  80296c:	83 ec 04             	sub    $0x4,%esp
+  80296f:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  802971:	8b 40 08             	mov    0x8(%eax),%eax
+  802974:	85 c0                	test   %eax,%eax
+  802976:	74 17                	je     80298f <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  802978:	83 f8 03             	cmp    $0x3,%eax
+  80297b:	75 2d                	jne    8029aa <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  80297d:	8d 43 20             	lea    0x20(%ebx),%eax
+  802980:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  802983:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  80298a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80298d:	c9                   	leave
+  80298e:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  80298f:	83 ec 0c             	sub    $0xc,%esp
+  802992:	ff 33                	push   (%ebx)
+  802994:	e8 7a 1b 00 00       	call   804513 <iscons>
+  802999:	83 c4 10             	add    $0x10,%esp
+  80299c:	85 c0                	test   %eax,%eax
+  80299e:	0f 9f c0             	setg   %al
+  8029a1:	0f b6 c0             	movzbl %al,%eax
+  8029a4:	83 c0 01             	add    $0x1,%eax
+  8029a7:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  8029aa:	83 ec 0c             	sub    $0xc,%esp
+  8029ad:	68 00 10 00 00       	push   $0x1000
+  8029b2:	e8 6e 0b 00 00       	call   803525 <malloc>
+  8029b7:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8029ba:	83 c4 10             	add    $0x10,%esp
+  8029bd:	85 c0                	test   %eax,%eax
+  8029bf:	74 bc                	je     80297d <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  8029c1:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  8029c8:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  8029cc:	eb bc                	jmp    80298a <stream_setup+0x29>
+
+008029ce <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  8029ce:	55                   	push   %ebp
+  8029cf:	89 e5                	mov    %esp,%ebp
+  8029d1:	53                   	push   %ebx
+  8029d2:	83 ec 04             	sub    $0x4,%esp
+  8029d5:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  8029d7:	e8 85 ff ff ff       	call   802961 <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  8029dc:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  8029e1:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  8029e5:	74 3d                	je     802a24 <stream_fill+0x56>
+  8029e7:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  8029eb:	74 10                	je     8029fd <stream_fill+0x2f>
+  8029ed:	89 d8                	mov    %ebx,%eax
+  8029ef:	e8 fd fe ff ff       	call   8028f1 <stream_drain>
+		return 0;
+  8029f4:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  8029f9:	85 c0                	test   %eax,%eax
+  8029fb:	78 27                	js     802a24 <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  8029fd:	83 ec 04             	sub    $0x4,%esp
+  802a00:	ff 73 10             	push   0x10(%ebx)
+  802a03:	ff 73 0c             	push   0xc(%ebx)
+  802a06:	ff 33                	push   (%ebx)
+  802a08:	e8 02 f3 ff ff       	call   801d0f <read>
+  802a0d:	83 c4 10             	add    $0x10,%esp
+  802a10:	85 c0                	test   %eax,%eax
+  802a12:	7e 17                	jle    802a2b <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  802a14:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  802a18:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  802a1f:	89 c2                	mov    %eax,%edx
+  802a21:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  802a24:	89 d0                	mov    %edx,%eax
+  802a26:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a29:	c9                   	leave
+  802a2a:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802a2b:	c1 f8 1f             	sar    $0x1f,%eax
+  802a2e:	83 e0 04             	and    $0x4,%eax
+  802a31:	83 c0 04             	add    $0x4,%eax
+  802a34:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  802a37:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a3c:	eb e6                	jmp    802a24 <stream_fill+0x56>
+
+00802a3e <fopen>:
+{
+  802a3e:	55                   	push   %ebp
+  802a3f:	89 e5                	mov    %esp,%ebp
+  802a41:	57                   	push   %edi
+  802a42:	56                   	push   %esi
+  802a43:	53                   	push   %ebx
+  802a44:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  802a4a:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  802a4d:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  802a53:	89 f0                	mov    %esi,%eax
+  802a55:	e8 40 fd ff ff       	call   80279a <parse_mode>
+		return 0;
+  802a5a:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  802a5f:	85 c0                	test   %eax,%eax
+  802a61:	78 2d                	js     802a90 <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  802a63:	83 ec 08             	sub    $0x8,%esp
+  802a66:	50                   	push   %eax
+  802a67:	ff 75 08             	push   0x8(%ebp)
+  802a6a:	e8 e8 f8 ff ff       	call   802357 <open>
+  802a6f:	89 c7                	mov    %eax,%edi
+  802a71:	83 c4 10             	add    $0x10,%esp
+  802a74:	85 c0                	test   %eax,%eax
+  802a76:	78 58                	js     802ad0 <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  802a78:	80 3e 61             	cmpb   $0x61,(%esi)
+  802a7b:	74 1d                	je     802a9a <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  802a7d:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  802a83:	89 f8                	mov    %edi,%eax
+  802a85:	e8 7b fd ff ff       	call   802805 <stream_alloc>
+  802a8a:	89 c3                	mov    %eax,%ebx
+  802a8c:	85 c0                	test   %eax,%eax
+  802a8e:	74 32                	je     802ac2 <fopen+0x84>
+}
+  802a90:	89 d8                	mov    %ebx,%eax
+  802a92:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a95:	5b                   	pop    %ebx
+  802a96:	5e                   	pop    %esi
+  802a97:	5f                   	pop    %edi
+  802a98:	5d                   	pop    %ebp
+  802a99:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  802a9a:	83 ec 08             	sub    $0x8,%esp
+  802a9d:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  802aa3:	50                   	push   %eax
+  802aa4:	57                   	push   %edi
+  802aa5:	e8 db f4 ff ff       	call   801f85 <fstat>
+  802aaa:	83 c4 10             	add    $0x10,%esp
+  802aad:	85 c0                	test   %eax,%eax
+  802aaf:	78 cc                	js     802a7d <fopen+0x3f>
+		seek(fd, st.st_size);
+  802ab1:	83 ec 08             	sub    $0x8,%esp
+  802ab4:	ff 75 dc             	push   -0x24(%ebp)
+  802ab7:	57                   	push   %edi
+  802ab8:	e8 f6 f3 ff ff       	call   801eb3 <seek>
+  802abd:	83 c4 10             	add    $0x10,%esp
+  802ac0:	eb bb                	jmp    802a7d <fopen+0x3f>
+		close(fd);
+  802ac2:	83 ec 0c             	sub    $0xc,%esp
+  802ac5:	57                   	push   %edi
+  802ac6:	e8 08 f1 ff ff       	call   801bd3 <close>
+  802acb:	83 c4 10             	add    $0x10,%esp
+  802ace:	eb c0                	jmp    802a90 <fopen+0x52>
+		return 0;
+  802ad0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ad5:	eb b9                	jmp    802a90 <fopen+0x52>
+
+00802ad7 <fdopen>:
+{
+  802ad7:	55                   	push   %ebp
+  802ad8:	89 e5                	mov    %esp,%ebp
+  802ada:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  802add:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802ae0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ae3:	e8 b2 fc ff ff       	call   80279a <parse_mode>
+  802ae8:	89 c2                	mov    %eax,%edx
+		return 0;
+  802aea:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  802aef:	85 d2                	test   %edx,%edx
+  802af1:	78 0b                	js     802afe <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  802af3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802af6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802af9:	e8 07 fd ff ff       	call   802805 <stream_alloc>
+}
+  802afe:	c9                   	leave
+  802aff:	c3                   	ret
+
+00802b00 <setvbuf>:
+{
+  802b00:	55                   	push   %ebp
+  802b01:	89 e5                	mov    %esp,%ebp
+  802b03:	57                   	push   %edi
+  802b04:	56                   	push   %esi
+  802b05:	53                   	push   %ebx
+  802b06:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b09:	8b 55 10             	mov    0x10(%ebp),%edx
+  802b0c:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  802b0f:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802b13:	75 3a                	jne    802b4f <setvbuf+0x4f>
+  802b15:	8d 72 ff             	lea    -0x1(%edx),%esi
+  802b18:	83 fe 02             	cmp    $0x2,%esi
+  802b1b:	77 39                	ja     802b56 <setvbuf+0x56>
+	f->f_bufmode = mode;
+  802b1d:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  802b20:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802b24:	0f 95 c3             	setne  %bl
+  802b27:	85 ff                	test   %edi,%edi
+  802b29:	0f 95 c1             	setne  %cl
+  802b2c:	84 cb                	test   %cl,%bl
+  802b2e:	74 05                	je     802b35 <setvbuf+0x35>
+  802b30:	83 fa 03             	cmp    $0x3,%edx
+  802b33:	75 0a                	jne    802b3f <setvbuf+0x3f>
+	return 0;
+  802b35:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b3a:	5b                   	pop    %ebx
+  802b3b:	5e                   	pop    %esi
+  802b3c:	5f                   	pop    %edi
+  802b3d:	5d                   	pop    %ebp
+  802b3e:	c3                   	ret
+		f->f_buf = buf;
+  802b3f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802b42:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  802b45:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  802b48:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b4d:	eb eb                	jmp    802b3a <setvbuf+0x3a>
+		return EOF;
+  802b4f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802b54:	eb e4                	jmp    802b3a <setvbuf+0x3a>
+  802b56:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802b5b:	eb dd                	jmp    802b3a <setvbuf+0x3a>
+
+00802b5d <fflush>:
+{
+  802b5d:	55                   	push   %ebp
+  802b5e:	89 e5                	mov    %esp,%ebp
+  802b60:	57                   	push   %edi
+  802b61:	56                   	push   %esi
+  802b62:	53                   	push   %ebx
+  802b63:	83 ec 0c             	sub    $0xc,%esp
+  802b66:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  802b69:	85 db                	test   %ebx,%ebx
+  802b6b:	74 1a                	je     802b87 <fflush+0x2a>
+	stream_unread(f);
+  802b6d:	89 d8                	mov    %ebx,%eax
+  802b6f:	e8 0a fd ff ff       	call   80287e <stream_unread>
+	return stream_drain(f);
+  802b74:	89 d8                	mov    %ebx,%eax
+  802b76:	e8 76 fd ff ff       	call   8028f1 <stream_drain>
+  802b7b:	89 c7                	mov    %eax,%edi
+}
+  802b7d:	89 f8                	mov    %edi,%eax
+  802b7f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b82:	5b                   	pop    %ebx
+  802b83:	5e                   	pop    %esi
+  802b84:	5f                   	pop    %edi
+  802b85:	5d                   	pop    %ebp
+  802b86:	c3                   	ret
+  802b87:	bb 20 60 80 00       	mov    $0x806020,%ebx
+  802b8c:	be 60 62 80 00       	mov    $0x806260,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  802b91:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b96:	eb 03                	jmp    802b9b <fflush+0x3e>
+  802b98:	83 c3 24             	add    $0x24,%ebx
+  802b9b:	39 f3                	cmp    %esi,%ebx
+  802b9d:	74 de                	je     802b7d <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  802b9f:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  802ba3:	74 f3                	je     802b98 <fflush+0x3b>
+  802ba5:	83 ec 0c             	sub    $0xc,%esp
+  802ba8:	53                   	push   %ebx
+  802ba9:	e8 af ff ff ff       	call   802b5d <fflush>
+  802bae:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  802bb1:	85 c0                	test   %eax,%eax
+  802bb3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802bb8:	0f 48 f8             	cmovs  %eax,%edi
+  802bbb:	eb db                	jmp    802b98 <fflush+0x3b>
+
+00802bbd <fclose>:
+{
+  802bbd:	55                   	push   %ebp
+  802bbe:	89 e5                	mov    %esp,%ebp
+  802bc0:	56                   	push   %esi
+  802bc1:	53                   	push   %ebx
+  802bc2:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  802bc5:	83 ec 0c             	sub    $0xc,%esp
+  802bc8:	56                   	push   %esi
+  802bc9:	e8 8f ff ff ff       	call   802b5d <fflush>
+  802bce:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  802bd0:	83 c4 04             	add    $0x4,%esp
+  802bd3:	ff 36                	push   (%esi)
+  802bd5:	e8 f9 ef ff ff       	call   801bd3 <close>
+  802bda:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  802bdd:	85 c0                	test   %eax,%eax
+  802bdf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802be4:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  802be7:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  802beb:	75 10                	jne    802bfd <fclose+0x40>
+	f->f_flags = 0;
+  802bed:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  802bf4:	89 d8                	mov    %ebx,%eax
+  802bf6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802bf9:	5b                   	pop    %ebx
+  802bfa:	5e                   	pop    %esi
+  802bfb:	5d                   	pop    %ebp
+  802bfc:	c3                   	ret
+		free(f->f_buf);
+  802bfd:	83 ec 0c             	sub    $0xc,%esp
+  802c00:	ff 76 0c             	push   0xc(%esi)
+  802c03:	e8 54 08 00 00       	call   80345c <free>
+  802c08:	83 c4 10             	add    $0x10,%esp
+  802c0b:	eb e0                	jmp    802bed <fclose+0x30>
+
+00802c0d <fileno>:
+{
+  802c0d:	55                   	push   %ebp
+  802c0e:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  802c10:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c13:	8b 00                	mov    (%eax),%eax
+}
+  802c15:	5d                   	pop    %ebp
+  802c16:	c3                   	ret
+
+00802c17 <feof>:
+{
+  802c17:	55                   	push   %ebp
+  802c18:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  802c1a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c1d:	8b 40 04             	mov    0x4(%eax),%eax
+  802c20:	c1 e8 02             	shr    $0x2,%eax
+  802c23:	83 e0 01             	and    $0x1,%eax
+}
+  802c26:	5d                   	pop    %ebp
+  802c27:	c3                   	ret
+
+00802c28 <ferror>:
+{
+  802c28:	55                   	push   %ebp
+  802c29:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  802c2b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c2e:	8b 40 04             	mov    0x4(%eax),%eax
+  802c31:	c1 e8 03             	shr    $0x3,%eax
+  802c34:	83 e0 01             	and    $0x1,%eax
+}
+  802c37:	5d                   	pop    %ebp
+  802c38:	c3                   	ret
+
+00802c39 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  802c39:	55                   	push   %ebp
+  802c3a:	89 e5                	mov    %esp,%ebp
+  802c3c:	53                   	push   %ebx
+  802c3d:	83 ec 04             	sub    $0x4,%esp
+  802c40:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802c43:	8b 43 18             	mov    0x18(%ebx),%eax
+  802c46:	39 43 14             	cmp    %eax,0x14(%ebx)
+  802c49:	74 15                	je     802c60 <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  802c4b:	8b 53 0c             	mov    0xc(%ebx),%edx
+  802c4e:	8b 43 14             	mov    0x14(%ebx),%eax
+  802c51:	8d 48 01             	lea    0x1(%eax),%ecx
+  802c54:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  802c57:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  802c5b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c5e:	c9                   	leave
+  802c5f:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802c60:	89 d8                	mov    %ebx,%eax
+  802c62:	e8 67 fd ff ff       	call   8029ce <stream_fill>
+  802c67:	85 c0                	test   %eax,%eax
+  802c69:	75 e0                	jne    802c4b <fgetc+0x12>
+		return EOF;
+  802c6b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802c70:	eb e9                	jmp    802c5b <fgetc+0x22>
+
+00802c72 <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  802c72:	55                   	push   %ebp
+  802c73:	89 e5                	mov    %esp,%ebp
+  802c75:	57                   	push   %edi
+  802c76:	56                   	push   %esi
+  802c77:	53                   	push   %ebx
+  802c78:	83 ec 1c             	sub    $0x1c,%esp
+  802c7b:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  802c7e:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802c83:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c86:	83 e8 01             	sub    $0x1,%eax
+  802c89:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  802c8c:	eb 66                	jmp    802cf4 <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802c8e:	8b 46 14             	mov    0x14(%esi),%eax
+  802c91:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802c94:	29 c3                	sub    %eax,%ebx
+  802c96:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802c99:	29 fa                	sub    %edi,%edx
+  802c9b:	39 d3                	cmp    %edx,%ebx
+  802c9d:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802ca0:	83 ec 04             	sub    $0x4,%esp
+  802ca3:	53                   	push   %ebx
+  802ca4:	6a 0a                	push   $0xa
+  802ca6:	03 46 0c             	add    0xc(%esi),%eax
+  802ca9:	50                   	push   %eax
+  802caa:	e8 34 e0 ff ff       	call   800ce3 <memfind>
+  802caf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  802cb2:	8b 46 0c             	mov    0xc(%esi),%eax
+  802cb5:	8b 4e 14             	mov    0x14(%esi),%ecx
+  802cb8:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  802cbb:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802cbd:	83 c4 10             	add    $0x10,%esp
+  802cc0:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802cc3:	74 0b                	je     802cd0 <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  802cc5:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802cc8:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802ccb:	29 d3                	sub    %edx,%ebx
+  802ccd:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  802cd0:	83 ec 04             	sub    $0x4,%esp
+  802cd3:	53                   	push   %ebx
+  802cd4:	01 c8                	add    %ecx,%eax
+  802cd6:	50                   	push   %eax
+  802cd7:	89 f8                	mov    %edi,%eax
+  802cd9:	03 45 08             	add    0x8(%ebp),%eax
+  802cdc:	50                   	push   %eax
+  802cdd:	e8 50 df ff ff       	call   800c32 <memmove>
+		f->f_rpos += m;
+  802ce2:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  802ce5:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  802ce7:	83 c4 10             	add    $0x10,%esp
+  802cea:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ced:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  802cf2:	74 1f                	je     802d13 <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  802cf4:	8d 47 01             	lea    0x1(%edi),%eax
+  802cf7:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  802cfa:	73 17                	jae    802d13 <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802cfc:	8b 46 18             	mov    0x18(%esi),%eax
+  802cff:	39 46 14             	cmp    %eax,0x14(%esi)
+  802d02:	75 8a                	jne    802c8e <fgets+0x1c>
+  802d04:	89 f0                	mov    %esi,%eax
+  802d06:	e8 c3 fc ff ff       	call   8029ce <stream_fill>
+  802d0b:	85 c0                	test   %eax,%eax
+  802d0d:	0f 85 7b ff ff ff    	jne    802c8e <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  802d13:	85 ff                	test   %edi,%edi
+  802d15:	74 0f                	je     802d26 <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  802d17:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d1a:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  802d1e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d21:	5b                   	pop    %ebx
+  802d22:	5e                   	pop    %esi
+  802d23:	5f                   	pop    %edi
+  802d24:	5d                   	pop    %ebp
+  802d25:	c3                   	ret
+		return 0;
+  802d26:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d2b:	eb f1                	jmp    802d1e <fgets+0xac>
+
+00802d2d <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  802d2d:	55                   	push   %ebp
+  802d2e:	89 e5                	mov    %esp,%ebp
+  802d30:	57                   	push   %edi
+  802d31:	56                   	push   %esi
+  802d32:	53                   	push   %ebx
+  802d33:	83 ec 1c             	sub    $0x1c,%esp
+  802d36:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  802d39:	89 f0                	mov    %esi,%eax
+  802d3b:	e8 21 fc ff ff       	call   802961 <stream_setup>
+	want = size * n;
+  802d40:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d43:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802d47:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  802d4a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d4f:	eb 43                	jmp    802d94 <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  802d51:	29 d3                	sub    %edx,%ebx
+  802d53:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802d56:	29 f8                	sub    %edi,%eax
+  802d58:	39 c3                	cmp    %eax,%ebx
+  802d5a:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  802d5d:	83 ec 04             	sub    $0x4,%esp
+  802d60:	53                   	push   %ebx
+  802d61:	03 56 0c             	add    0xc(%esi),%edx
+  802d64:	52                   	push   %edx
+  802d65:	89 f8                	mov    %edi,%eax
+  802d67:	03 45 08             	add    0x8(%ebp),%eax
+  802d6a:	50                   	push   %eax
+  802d6b:	e8 c2 de ff ff       	call   800c32 <memmove>
+			f->f_rpos += m;
+  802d70:	01 5e 14             	add    %ebx,0x14(%esi)
+  802d73:	83 c4 10             	add    $0x10,%esp
+  802d76:	eb 1a                	jmp    802d92 <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  802d78:	83 ec 04             	sub    $0x4,%esp
+  802d7b:	53                   	push   %ebx
+  802d7c:	89 f8                	mov    %edi,%eax
+  802d7e:	03 45 08             	add    0x8(%ebp),%eax
+  802d81:	50                   	push   %eax
+  802d82:	ff 36                	push   (%esi)
+  802d84:	e8 86 ef ff ff       	call   801d0f <read>
+  802d89:	89 c3                	mov    %eax,%ebx
+  802d8b:	83 c4 10             	add    $0x10,%esp
+  802d8e:	85 c0                	test   %eax,%eax
+  802d90:	7e 36                	jle    802dc8 <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  802d92:	01 df                	add    %ebx,%edi
+  802d94:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802d97:	39 c7                	cmp    %eax,%edi
+  802d99:	73 39                	jae    802dd4 <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  802d9b:	8b 56 14             	mov    0x14(%esi),%edx
+  802d9e:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802da1:	39 da                	cmp    %ebx,%edx
+  802da3:	72 ac                	jb     802d51 <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  802da5:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802da8:	29 fb                	sub    %edi,%ebx
+  802daa:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  802dad:	72 3e                	jb     802ded <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  802daf:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  802db3:	74 1f                	je     802dd4 <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  802db5:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  802db9:	74 bd                	je     802d78 <fread+0x4b>
+  802dbb:	89 f0                	mov    %esi,%eax
+  802dbd:	e8 2f fb ff ff       	call   8028f1 <stream_drain>
+  802dc2:	85 c0                	test   %eax,%eax
+  802dc4:	79 b2                	jns    802d78 <fread+0x4b>
+  802dc6:	eb 0c                	jmp    802dd4 <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802dc8:	c1 fb 1f             	sar    $0x1f,%ebx
+  802dcb:	83 e3 04             	and    $0x4,%ebx
+  802dce:	83 c3 04             	add    $0x4,%ebx
+  802dd1:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  802dd4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802dd7:	85 c0                	test   %eax,%eax
+  802dd9:	74 0a                	je     802de5 <fread+0xb8>
+  802ddb:	89 f8                	mov    %edi,%eax
+  802ddd:	ba 00 00 00 00       	mov    $0x0,%edx
+  802de2:	f7 75 0c             	divl   0xc(%ebp)
+}
+  802de5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802de8:	5b                   	pop    %ebx
+  802de9:	5e                   	pop    %esi
+  802dea:	5f                   	pop    %edi
+  802deb:	5d                   	pop    %ebp
+  802dec:	c3                   	ret
+		} else if (!stream_fill(f))
+  802ded:	89 f0                	mov    %esi,%eax
+  802def:	e8 da fb ff ff       	call   8029ce <stream_fill>
+  802df4:	85 c0                	test   %eax,%eax
+  802df6:	74 dc                	je     802dd4 <fread+0xa7>
+			m = 0;
+  802df8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802dfd:	eb 93                	jmp    802d92 <fread+0x65>
+
+00802dff <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  802dff:	55                   	push   %ebp
+  802e00:	89 e5                	mov    %esp,%ebp
+  802e02:	57                   	push   %edi
+  802e03:	56                   	push   %esi
+  802e04:	53                   	push   %ebx
+  802e05:	83 ec 1c             	sub    $0x1c,%esp
+  802e08:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  802e0b:	8b 43 04             	mov    0x4(%ebx),%eax
+  802e0e:	a8 02                	test   $0x2,%al
+  802e10:	75 13                	jne    802e25 <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  802e12:	83 c8 08             	or     $0x8,%eax
+  802e15:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  802e18:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  802e1d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e20:	5b                   	pop    %ebx
+  802e21:	5e                   	pop    %esi
+  802e22:	5f                   	pop    %edi
+  802e23:	5d                   	pop    %ebp
+  802e24:	c3                   	ret
+	stream_setup(f);
+  802e25:	89 d8                	mov    %ebx,%eax
+  802e27:	e8 35 fb ff ff       	call   802961 <stream_setup>
+	want = size * n;
+  802e2c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e2f:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802e33:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  802e36:	89 d8                	mov    %ebx,%eax
+  802e38:	e8 41 fa ff ff       	call   80287e <stream_unread>
+	for (done = 0; done < want; ) {
+  802e3d:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  802e42:	84 c0                	test   %al,%al
+  802e44:	75 7b                	jne    802ec1 <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  802e46:	be 00 00 00 00       	mov    $0x0,%esi
+  802e4b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802e4e:	39 fe                	cmp    %edi,%esi
+  802e50:	73 24                	jae    802e76 <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802e52:	83 ec 04             	sub    $0x4,%esp
+  802e55:	89 f8                	mov    %edi,%eax
+  802e57:	29 f0                	sub    %esi,%eax
+  802e59:	50                   	push   %eax
+  802e5a:	89 f0                	mov    %esi,%eax
+  802e5c:	03 45 08             	add    0x8(%ebp),%eax
+  802e5f:	50                   	push   %eax
+  802e60:	ff 33                	push   (%ebx)
+  802e62:	e8 a0 ef ff ff       	call   801e07 <write>
+  802e67:	83 c4 10             	add    $0x10,%esp
+  802e6a:	85 c0                	test   %eax,%eax
+  802e6c:	7e 04                	jle    802e72 <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  802e6e:	01 c6                	add    %eax,%esi
+  802e70:	eb dc                	jmp    802e4e <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  802e72:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  802e76:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e79:	85 c0                	test   %eax,%eax
+  802e7b:	74 a0                	je     802e1d <fwrite+0x1e>
+  802e7d:	89 f0                	mov    %esi,%eax
+  802e7f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e84:	f7 75 0c             	divl   0xc(%ebp)
+  802e87:	eb 94                	jmp    802e1d <fwrite+0x1e>
+			done += r;
+  802e89:	01 c7                	add    %eax,%edi
+			continue;
+  802e8b:	eb 34                	jmp    802ec1 <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  802e8d:	8b 73 10             	mov    0x10(%ebx),%esi
+  802e90:	29 c6                	sub    %eax,%esi
+  802e92:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802e95:	29 fa                	sub    %edi,%edx
+  802e97:	39 d6                	cmp    %edx,%esi
+  802e99:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  802e9c:	83 ec 04             	sub    $0x4,%esp
+  802e9f:	56                   	push   %esi
+  802ea0:	89 fa                	mov    %edi,%edx
+  802ea2:	03 55 08             	add    0x8(%ebp),%edx
+  802ea5:	52                   	push   %edx
+  802ea6:	03 43 0c             	add    0xc(%ebx),%eax
+  802ea9:	50                   	push   %eax
+  802eaa:	e8 83 dd ff ff       	call   800c32 <memmove>
+		f->f_wend += m;
+  802eaf:	89 f0                	mov    %esi,%eax
+  802eb1:	03 43 1c             	add    0x1c(%ebx),%eax
+  802eb4:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  802eb7:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802eb9:	83 c4 10             	add    $0x10,%esp
+  802ebc:	3b 43 10             	cmp    0x10(%ebx),%eax
+  802ebf:	74 5b                	je     802f1c <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  802ec1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802ec4:	39 c7                	cmp    %eax,%edi
+  802ec6:	73 2d                	jae    802ef5 <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  802ec8:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802ecb:	85 c0                	test   %eax,%eax
+  802ecd:	75 be                	jne    802e8d <fwrite+0x8e>
+  802ecf:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802ed2:	29 fa                	sub    %edi,%edx
+  802ed4:	3b 53 10             	cmp    0x10(%ebx),%edx
+  802ed7:	72 b4                	jb     802e8d <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802ed9:	83 ec 04             	sub    $0x4,%esp
+  802edc:	52                   	push   %edx
+  802edd:	89 f8                	mov    %edi,%eax
+  802edf:	03 45 08             	add    0x8(%ebp),%eax
+  802ee2:	50                   	push   %eax
+  802ee3:	ff 33                	push   (%ebx)
+  802ee5:	e8 1d ef ff ff       	call   801e07 <write>
+  802eea:	83 c4 10             	add    $0x10,%esp
+  802eed:	85 c0                	test   %eax,%eax
+  802eef:	7f 98                	jg     802e89 <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  802ef1:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  802ef5:	8b 43 08             	mov    0x8(%ebx),%eax
+  802ef8:	83 f8 03             	cmp    $0x3,%eax
+  802efb:	74 48                	je     802f45 <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802efd:	83 f8 02             	cmp    $0x2,%eax
+  802f00:	74 27                	je     802f29 <fwrite+0x12a>
+	return size ? done / size : 0;
+  802f02:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f05:	85 c0                	test   %eax,%eax
+  802f07:	0f 84 10 ff ff ff    	je     802e1d <fwrite+0x1e>
+  802f0d:	89 f8                	mov    %edi,%eax
+  802f0f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f14:	f7 75 0c             	divl   0xc(%ebp)
+  802f17:	e9 01 ff ff ff       	jmp    802e1d <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802f1c:	89 d8                	mov    %ebx,%eax
+  802f1e:	e8 ce f9 ff ff       	call   8028f1 <stream_drain>
+  802f23:	85 c0                	test   %eax,%eax
+  802f25:	79 9a                	jns    802ec1 <fwrite+0xc2>
+  802f27:	eb cc                	jmp    802ef5 <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802f29:	83 ec 04             	sub    $0x4,%esp
+  802f2c:	57                   	push   %edi
+  802f2d:	6a 0a                	push   $0xa
+  802f2f:	ff 75 08             	push   0x8(%ebp)
+  802f32:	e8 ac dd ff ff       	call   800ce3 <memfind>
+  802f37:	89 c2                	mov    %eax,%edx
+  802f39:	89 f8                	mov    %edi,%eax
+  802f3b:	03 45 08             	add    0x8(%ebp),%eax
+  802f3e:	83 c4 10             	add    $0x10,%esp
+  802f41:	39 c2                	cmp    %eax,%edx
+  802f43:	74 bd                	je     802f02 <fwrite+0x103>
+		stream_drain(f);
+  802f45:	89 d8                	mov    %ebx,%eax
+  802f47:	e8 a5 f9 ff ff       	call   8028f1 <stream_drain>
+  802f4c:	eb b4                	jmp    802f02 <fwrite+0x103>
+
+00802f4e <fputc>:
+{
+  802f4e:	55                   	push   %ebp
+  802f4f:	89 e5                	mov    %esp,%ebp
+  802f51:	53                   	push   %ebx
+  802f52:	83 ec 14             	sub    $0x14,%esp
+  802f55:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  802f58:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  802f5b:	ff 75 0c             	push   0xc(%ebp)
+  802f5e:	6a 01                	push   $0x1
+  802f60:	6a 01                	push   $0x1
+  802f62:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802f65:	50                   	push   %eax
+  802f66:	e8 94 fe ff ff       	call   802dff <fwrite>
+  802f6b:	83 c4 10             	add    $0x10,%esp
+  802f6e:	0f b6 db             	movzbl %bl,%ebx
+  802f71:	83 f8 01             	cmp    $0x1,%eax
+  802f74:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802f79:	0f 44 c3             	cmove  %ebx,%eax
+}
+  802f7c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f7f:	c9                   	leave
+  802f80:	c3                   	ret
+
+00802f81 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  802f81:	55                   	push   %ebp
+  802f82:	89 e5                	mov    %esp,%ebp
+  802f84:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  802f87:	ff 75 0c             	push   0xc(%ebp)
+  802f8a:	ff 75 08             	push   0x8(%ebp)
+  802f8d:	e8 bc ff ff ff       	call   802f4e <fputc>
+}
+  802f92:	83 c4 10             	add    $0x10,%esp
+  802f95:	c9                   	leave
+  802f96:	c3                   	ret
+
+00802f97 <fputs>:
+{
+  802f97:	55                   	push   %ebp
+  802f98:	89 e5                	mov    %esp,%ebp
+  802f9a:	56                   	push   %esi
+  802f9b:	53                   	push   %ebx
+  802f9c:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  802f9f:	83 ec 0c             	sub    $0xc,%esp
+  802fa2:	56                   	push   %esi
+  802fa3:	e8 c9 da ff ff       	call   800a71 <strlen>
+  802fa8:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  802faa:	ff 75 0c             	push   0xc(%ebp)
+  802fad:	50                   	push   %eax
+  802fae:	6a 01                	push   $0x1
+  802fb0:	56                   	push   %esi
+  802fb1:	e8 49 fe ff ff       	call   802dff <fwrite>
+  802fb6:	83 c4 20             	add    $0x20,%esp
+  802fb9:	39 d8                	cmp    %ebx,%eax
+  802fbb:	0f 95 c0             	setne  %al
+  802fbe:	0f b6 c0             	movzbl %al,%eax
+  802fc1:	f7 d8                	neg    %eax
+}
+  802fc3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802fc6:	5b                   	pop    %ebx
+  802fc7:	5e                   	pop    %esi
+  802fc8:	5d                   	pop    %ebp
+  802fc9:	c3                   	ret
+
+00802fca <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  802fca:	55                   	push   %ebp
+  802fcb:	89 e5                	mov    %esp,%ebp
+  802fcd:	53                   	push   %ebx
+  802fce:	83 ec 04             	sub    $0x4,%esp
+  802fd1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802fd4:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  802fd7:	50                   	push   %eax
+  802fd8:	ff 75 0c             	push   0xc(%ebp)
+  802fdb:	53                   	push   %ebx
+  802fdc:	68 81 2f 80 00       	push   $0x802f81
+  802fe1:	e8 d9 d5 ff ff       	call   8005bf <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  802fe6:	8b 43 04             	mov    0x4(%ebx),%eax
+  802fe9:	c1 e0 1c             	shl    $0x1c,%eax
+  802fec:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  802fef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ff2:	c9                   	leave
+  802ff3:	c3                   	ret
+
+00802ff4 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802ff4:	55                   	push   %ebp
+  802ff5:	89 e5                	mov    %esp,%ebp
+  802ff7:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802ffa:	68 c8 51 80 00       	push   $0x8051c8
+  802fff:	ff 75 0c             	push   0xc(%ebp)
+  803002:	e8 a5 da ff ff       	call   800aac <strcpy>
+	return 0;
+}
+  803007:	b8 00 00 00 00       	mov    $0x0,%eax
+  80300c:	c9                   	leave
+  80300d:	c3                   	ret
+
+0080300e <devsock_close>:
+{
+  80300e:	55                   	push   %ebp
+  80300f:	89 e5                	mov    %esp,%ebp
+  803011:	53                   	push   %ebx
+  803012:	83 ec 10             	sub    $0x10,%esp
+  803015:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  803018:	53                   	push   %ebx
+  803019:	e8 62 17 00 00       	call   804780 <pageref>
+  80301e:	89 c2                	mov    %eax,%edx
+  803020:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  803023:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  803028:	83 fa 01             	cmp    $0x1,%edx
+  80302b:	74 05                	je     803032 <devsock_close+0x24>
+}
+  80302d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803030:	c9                   	leave
+  803031:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  803032:	83 ec 0c             	sub    $0xc,%esp
+  803035:	ff 73 0c             	push   0xc(%ebx)
+  803038:	e8 b7 02 00 00       	call   8032f4 <nsipc_close>
+  80303d:	83 c4 10             	add    $0x10,%esp
+  803040:	eb eb                	jmp    80302d <devsock_close+0x1f>
+
+00803042 <devsock_write>:
+{
+  803042:	55                   	push   %ebp
+  803043:	89 e5                	mov    %esp,%ebp
+  803045:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  803048:	6a 00                	push   $0x0
+  80304a:	ff 75 10             	push   0x10(%ebp)
+  80304d:	ff 75 0c             	push   0xc(%ebp)
+  803050:	8b 45 08             	mov    0x8(%ebp),%eax
+  803053:	ff 70 0c             	push   0xc(%eax)
+  803056:	e8 79 03 00 00       	call   8033d4 <nsipc_send>
+}
+  80305b:	c9                   	leave
+  80305c:	c3                   	ret
+
+0080305d <devsock_read>:
+{
+  80305d:	55                   	push   %ebp
+  80305e:	89 e5                	mov    %esp,%ebp
+  803060:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  803063:	6a 00                	push   $0x0
+  803065:	ff 75 10             	push   0x10(%ebp)
+  803068:	ff 75 0c             	push   0xc(%ebp)
+  80306b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80306e:	ff 70 0c             	push   0xc(%eax)
+  803071:	e8 ef 02 00 00       	call   803365 <nsipc_recv>
+}
+  803076:	c9                   	leave
+  803077:	c3                   	ret
+
+00803078 <fd2sockid>:
+{
+  803078:	55                   	push   %ebp
+  803079:	89 e5                	mov    %esp,%ebp
+  80307b:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  80307e:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803081:	52                   	push   %edx
+  803082:	50                   	push   %eax
+  803083:	e8 f7 e9 ff ff       	call   801a7f <fd_lookup>
+  803088:	83 c4 10             	add    $0x10,%esp
+  80308b:	85 c0                	test   %eax,%eax
+  80308d:	78 10                	js     80309f <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  80308f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803092:	8b 0d 60 62 80 00    	mov    0x806260,%ecx
+  803098:	39 08                	cmp    %ecx,(%eax)
+  80309a:	75 05                	jne    8030a1 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  80309c:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  80309f:	c9                   	leave
+  8030a0:	c3                   	ret
+		return -E_NOT_SUPP;
+  8030a1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8030a6:	eb f7                	jmp    80309f <fd2sockid+0x27>
+
+008030a8 <alloc_sockfd>:
+{
+  8030a8:	55                   	push   %ebp
+  8030a9:	89 e5                	mov    %esp,%ebp
+  8030ab:	56                   	push   %esi
+  8030ac:	53                   	push   %ebx
+  8030ad:	83 ec 1c             	sub    $0x1c,%esp
+  8030b0:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8030b2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8030b5:	50                   	push   %eax
+  8030b6:	e8 6e e9 ff ff       	call   801a29 <fd_alloc>
+  8030bb:	89 c3                	mov    %eax,%ebx
+  8030bd:	83 c4 10             	add    $0x10,%esp
+  8030c0:	85 c0                	test   %eax,%eax
+  8030c2:	78 43                	js     803107 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8030c4:	83 ec 04             	sub    $0x4,%esp
+  8030c7:	68 07 04 00 00       	push   $0x407
+  8030cc:	ff 75 f4             	push   -0xc(%ebp)
+  8030cf:	6a 00                	push   $0x0
+  8030d1:	e8 14 de ff ff       	call   800eea <sys_page_alloc>
+  8030d6:	89 c3                	mov    %eax,%ebx
+  8030d8:	83 c4 10             	add    $0x10,%esp
+  8030db:	85 c0                	test   %eax,%eax
+  8030dd:	78 28                	js     803107 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8030df:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8030e2:	8b 15 60 62 80 00    	mov    0x806260,%edx
+  8030e8:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8030ea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8030ed:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8030f4:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8030f7:	83 ec 0c             	sub    $0xc,%esp
+  8030fa:	50                   	push   %eax
+  8030fb:	e8 02 e9 ff ff       	call   801a02 <fd2num>
+  803100:	89 c3                	mov    %eax,%ebx
+  803102:	83 c4 10             	add    $0x10,%esp
+  803105:	eb 0c                	jmp    803113 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  803107:	83 ec 0c             	sub    $0xc,%esp
+  80310a:	56                   	push   %esi
+  80310b:	e8 e4 01 00 00       	call   8032f4 <nsipc_close>
+		return r;
+  803110:	83 c4 10             	add    $0x10,%esp
+}
+  803113:	89 d8                	mov    %ebx,%eax
+  803115:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803118:	5b                   	pop    %ebx
+  803119:	5e                   	pop    %esi
+  80311a:	5d                   	pop    %ebp
+  80311b:	c3                   	ret
+
+0080311c <accept>:
+{
+  80311c:	55                   	push   %ebp
+  80311d:	89 e5                	mov    %esp,%ebp
+  80311f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803122:	8b 45 08             	mov    0x8(%ebp),%eax
+  803125:	e8 4e ff ff ff       	call   803078 <fd2sockid>
+  80312a:	85 c0                	test   %eax,%eax
+  80312c:	78 1b                	js     803149 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  80312e:	83 ec 04             	sub    $0x4,%esp
+  803131:	ff 75 10             	push   0x10(%ebp)
+  803134:	ff 75 0c             	push   0xc(%ebp)
+  803137:	50                   	push   %eax
+  803138:	e8 0e 01 00 00       	call   80324b <nsipc_accept>
+  80313d:	83 c4 10             	add    $0x10,%esp
+  803140:	85 c0                	test   %eax,%eax
+  803142:	78 05                	js     803149 <accept+0x2d>
+	return alloc_sockfd(r);
+  803144:	e8 5f ff ff ff       	call   8030a8 <alloc_sockfd>
+}
+  803149:	c9                   	leave
+  80314a:	c3                   	ret
+
+0080314b <bind>:
+{
+  80314b:	55                   	push   %ebp
+  80314c:	89 e5                	mov    %esp,%ebp
+  80314e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803151:	8b 45 08             	mov    0x8(%ebp),%eax
+  803154:	e8 1f ff ff ff       	call   803078 <fd2sockid>
+  803159:	85 c0                	test   %eax,%eax
+  80315b:	78 12                	js     80316f <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80315d:	83 ec 04             	sub    $0x4,%esp
+  803160:	ff 75 10             	push   0x10(%ebp)
+  803163:	ff 75 0c             	push   0xc(%ebp)
+  803166:	50                   	push   %eax
+  803167:	e8 31 01 00 00       	call   80329d <nsipc_bind>
+  80316c:	83 c4 10             	add    $0x10,%esp
+}
+  80316f:	c9                   	leave
+  803170:	c3                   	ret
+
+00803171 <shutdown>:
+{
+  803171:	55                   	push   %ebp
+  803172:	89 e5                	mov    %esp,%ebp
+  803174:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803177:	8b 45 08             	mov    0x8(%ebp),%eax
+  80317a:	e8 f9 fe ff ff       	call   803078 <fd2sockid>
+  80317f:	85 c0                	test   %eax,%eax
+  803181:	78 0f                	js     803192 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  803183:	83 ec 08             	sub    $0x8,%esp
+  803186:	ff 75 0c             	push   0xc(%ebp)
+  803189:	50                   	push   %eax
+  80318a:	e8 43 01 00 00       	call   8032d2 <nsipc_shutdown>
+  80318f:	83 c4 10             	add    $0x10,%esp
+}
+  803192:	c9                   	leave
+  803193:	c3                   	ret
+
+00803194 <connect>:
+{
+  803194:	55                   	push   %ebp
+  803195:	89 e5                	mov    %esp,%ebp
+  803197:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80319a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80319d:	e8 d6 fe ff ff       	call   803078 <fd2sockid>
+  8031a2:	85 c0                	test   %eax,%eax
+  8031a4:	78 12                	js     8031b8 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8031a6:	83 ec 04             	sub    $0x4,%esp
+  8031a9:	ff 75 10             	push   0x10(%ebp)
+  8031ac:	ff 75 0c             	push   0xc(%ebp)
+  8031af:	50                   	push   %eax
+  8031b0:	e8 59 01 00 00       	call   80330e <nsipc_connect>
+  8031b5:	83 c4 10             	add    $0x10,%esp
+}
+  8031b8:	c9                   	leave
+  8031b9:	c3                   	ret
+
+008031ba <listen>:
+{
+  8031ba:	55                   	push   %ebp
+  8031bb:	89 e5                	mov    %esp,%ebp
+  8031bd:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8031c0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031c3:	e8 b0 fe ff ff       	call   803078 <fd2sockid>
+  8031c8:	85 c0                	test   %eax,%eax
+  8031ca:	78 0f                	js     8031db <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8031cc:	83 ec 08             	sub    $0x8,%esp
+  8031cf:	ff 75 0c             	push   0xc(%ebp)
+  8031d2:	50                   	push   %eax
+  8031d3:	e8 6b 01 00 00       	call   803343 <nsipc_listen>
+  8031d8:	83 c4 10             	add    $0x10,%esp
+}
+  8031db:	c9                   	leave
+  8031dc:	c3                   	ret
+
+008031dd <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8031dd:	55                   	push   %ebp
+  8031de:	89 e5                	mov    %esp,%ebp
+  8031e0:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8031e3:	ff 75 10             	push   0x10(%ebp)
+  8031e6:	ff 75 0c             	push   0xc(%ebp)
+  8031e9:	ff 75 08             	push   0x8(%ebp)
+  8031ec:	e8 41 02 00 00       	call   803432 <nsipc_socket>
+  8031f1:	83 c4 10             	add    $0x10,%esp
+  8031f4:	85 c0                	test   %eax,%eax
+  8031f6:	78 05                	js     8031fd <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8031f8:	e8 ab fe ff ff       	call   8030a8 <alloc_sockfd>
+}
+  8031fd:	c9                   	leave
+  8031fe:	c3                   	ret
+
+008031ff <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8031ff:	55                   	push   %ebp
+  803200:	89 e5                	mov    %esp,%ebp
+  803202:	53                   	push   %ebx
+  803203:	83 ec 04             	sub    $0x4,%esp
+  803206:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  803208:	83 3d 14 70 80 00 00 	cmpl   $0x0,0x807014
+  80320f:	74 26                	je     803237 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  803211:	6a 07                	push   $0x7
+  803213:	68 00 90 80 00       	push   $0x809000
+  803218:	53                   	push   %ebx
+  803219:	ff 35 14 70 80 00    	push   0x807014
+  80321f:	e8 c7 14 00 00       	call   8046eb <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  803224:	83 c4 0c             	add    $0xc,%esp
+  803227:	6a 00                	push   $0x0
+  803229:	6a 00                	push   $0x0
+  80322b:	6a 00                	push   $0x0
+  80322d:	e8 c3 13 00 00       	call   8045f5 <ipc_recv>
+}
+  803232:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803235:	c9                   	leave
+  803236:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  803237:	83 ec 0c             	sub    $0xc,%esp
+  80323a:	6a 02                	push   $0x2
+  80323c:	e8 00 15 00 00       	call   804741 <ipc_find_env>
+  803241:	a3 14 70 80 00       	mov    %eax,0x807014
+  803246:	83 c4 10             	add    $0x10,%esp
+  803249:	eb c6                	jmp    803211 <nsipc+0x12>
+
+0080324b <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  80324b:	55                   	push   %ebp
+  80324c:	89 e5                	mov    %esp,%ebp
+  80324e:	56                   	push   %esi
+  80324f:	53                   	push   %ebx
+  803250:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  803253:	8b 45 08             	mov    0x8(%ebp),%eax
+  803256:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  80325b:	8b 06                	mov    (%esi),%eax
+  80325d:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  803262:	b8 01 00 00 00       	mov    $0x1,%eax
+  803267:	e8 93 ff ff ff       	call   8031ff <nsipc>
+  80326c:	89 c3                	mov    %eax,%ebx
+  80326e:	85 c0                	test   %eax,%eax
+  803270:	79 09                	jns    80327b <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  803272:	89 d8                	mov    %ebx,%eax
+  803274:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803277:	5b                   	pop    %ebx
+  803278:	5e                   	pop    %esi
+  803279:	5d                   	pop    %ebp
+  80327a:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80327b:	83 ec 04             	sub    $0x4,%esp
+  80327e:	ff 35 10 90 80 00    	push   0x809010
+  803284:	68 00 90 80 00       	push   $0x809000
+  803289:	ff 75 0c             	push   0xc(%ebp)
+  80328c:	e8 a1 d9 ff ff       	call   800c32 <memmove>
+		*addrlen = ret->ret_addrlen;
+  803291:	a1 10 90 80 00       	mov    0x809010,%eax
+  803296:	89 06                	mov    %eax,(%esi)
+  803298:	83 c4 10             	add    $0x10,%esp
+	return r;
+  80329b:	eb d5                	jmp    803272 <nsipc_accept+0x27>
+
+0080329d <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80329d:	55                   	push   %ebp
+  80329e:	89 e5                	mov    %esp,%ebp
+  8032a0:	53                   	push   %ebx
+  8032a1:	83 ec 08             	sub    $0x8,%esp
+  8032a4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8032a7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032aa:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8032af:	53                   	push   %ebx
+  8032b0:	ff 75 0c             	push   0xc(%ebp)
+  8032b3:	68 04 90 80 00       	push   $0x809004
+  8032b8:	e8 75 d9 ff ff       	call   800c32 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8032bd:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  8032c3:	b8 02 00 00 00       	mov    $0x2,%eax
+  8032c8:	e8 32 ff ff ff       	call   8031ff <nsipc>
+}
+  8032cd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8032d0:	c9                   	leave
+  8032d1:	c3                   	ret
+
+008032d2 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8032d2:	55                   	push   %ebp
+  8032d3:	89 e5                	mov    %esp,%ebp
+  8032d5:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8032d8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032db:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  8032e0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8032e3:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  8032e8:	b8 03 00 00 00       	mov    $0x3,%eax
+  8032ed:	e8 0d ff ff ff       	call   8031ff <nsipc>
+}
+  8032f2:	c9                   	leave
+  8032f3:	c3                   	ret
+
+008032f4 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8032f4:	55                   	push   %ebp
+  8032f5:	89 e5                	mov    %esp,%ebp
+  8032f7:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8032fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032fd:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  803302:	b8 04 00 00 00       	mov    $0x4,%eax
+  803307:	e8 f3 fe ff ff       	call   8031ff <nsipc>
+}
+  80330c:	c9                   	leave
+  80330d:	c3                   	ret
+
+0080330e <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80330e:	55                   	push   %ebp
+  80330f:	89 e5                	mov    %esp,%ebp
+  803311:	53                   	push   %ebx
+  803312:	83 ec 08             	sub    $0x8,%esp
+  803315:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  803318:	8b 45 08             	mov    0x8(%ebp),%eax
+  80331b:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  803320:	53                   	push   %ebx
+  803321:	ff 75 0c             	push   0xc(%ebp)
+  803324:	68 04 90 80 00       	push   $0x809004
+  803329:	e8 04 d9 ff ff       	call   800c32 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  80332e:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  803334:	b8 05 00 00 00       	mov    $0x5,%eax
+  803339:	e8 c1 fe ff ff       	call   8031ff <nsipc>
+}
+  80333e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803341:	c9                   	leave
+  803342:	c3                   	ret
+
+00803343 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  803343:	55                   	push   %ebp
+  803344:	89 e5                	mov    %esp,%ebp
+  803346:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  803349:	8b 45 08             	mov    0x8(%ebp),%eax
+  80334c:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  803351:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803354:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  803359:	b8 06 00 00 00       	mov    $0x6,%eax
+  80335e:	e8 9c fe ff ff       	call   8031ff <nsipc>
+}
+  803363:	c9                   	leave
+  803364:	c3                   	ret
+
+00803365 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  803365:	55                   	push   %ebp
+  803366:	89 e5                	mov    %esp,%ebp
+  803368:	56                   	push   %esi
+  803369:	53                   	push   %ebx
+  80336a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80336d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803370:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  803375:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  80337b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80337e:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  803383:	b8 07 00 00 00       	mov    $0x7,%eax
+  803388:	e8 72 fe ff ff       	call   8031ff <nsipc>
+  80338d:	89 c3                	mov    %eax,%ebx
+  80338f:	85 c0                	test   %eax,%eax
+  803391:	78 22                	js     8033b5 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  803393:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  803398:	39 c6                	cmp    %eax,%esi
+  80339a:	0f 4e c6             	cmovle %esi,%eax
+  80339d:	39 c3                	cmp    %eax,%ebx
+  80339f:	7f 1d                	jg     8033be <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8033a1:	83 ec 04             	sub    $0x4,%esp
+  8033a4:	53                   	push   %ebx
+  8033a5:	68 00 90 80 00       	push   $0x809000
+  8033aa:	ff 75 0c             	push   0xc(%ebp)
+  8033ad:	e8 80 d8 ff ff       	call   800c32 <memmove>
+  8033b2:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8033b5:	89 d8                	mov    %ebx,%eax
+  8033b7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8033ba:	5b                   	pop    %ebx
+  8033bb:	5e                   	pop    %esi
+  8033bc:	5d                   	pop    %ebp
+  8033bd:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8033be:	68 d4 51 80 00       	push   $0x8051d4
+  8033c3:	68 d1 50 80 00       	push   $0x8050d1
+  8033c8:	6a 62                	push   $0x62
+  8033ca:	68 e9 51 80 00       	push   $0x8051e9
+  8033cf:	e8 19 d0 ff ff       	call   8003ed <_panic>
+
+008033d4 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8033d4:	55                   	push   %ebp
+  8033d5:	89 e5                	mov    %esp,%ebp
+  8033d7:	53                   	push   %ebx
+  8033d8:	83 ec 04             	sub    $0x4,%esp
+  8033db:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8033de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033e1:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  8033e6:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8033ec:	7f 2e                	jg     80341c <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8033ee:	83 ec 04             	sub    $0x4,%esp
+  8033f1:	53                   	push   %ebx
+  8033f2:	ff 75 0c             	push   0xc(%ebp)
+  8033f5:	68 0c 90 80 00       	push   $0x80900c
+  8033fa:	e8 33 d8 ff ff       	call   800c32 <memmove>
+	nsipcbuf.send.req_size = size;
+  8033ff:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  803405:	8b 45 14             	mov    0x14(%ebp),%eax
+  803408:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  80340d:	b8 08 00 00 00       	mov    $0x8,%eax
+  803412:	e8 e8 fd ff ff       	call   8031ff <nsipc>
+}
+  803417:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80341a:	c9                   	leave
+  80341b:	c3                   	ret
+	assert(size < 1600);
+  80341c:	68 f5 51 80 00       	push   $0x8051f5
+  803421:	68 d1 50 80 00       	push   $0x8050d1
+  803426:	6a 6d                	push   $0x6d
+  803428:	68 e9 51 80 00       	push   $0x8051e9
+  80342d:	e8 bb cf ff ff       	call   8003ed <_panic>
+
+00803432 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  803432:	55                   	push   %ebp
+  803433:	89 e5                	mov    %esp,%ebp
+  803435:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  803438:	8b 45 08             	mov    0x8(%ebp),%eax
+  80343b:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  803440:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803443:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  803448:	8b 45 10             	mov    0x10(%ebp),%eax
+  80344b:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  803450:	b8 09 00 00 00       	mov    $0x9,%eax
+  803455:	e8 a5 fd ff ff       	call   8031ff <nsipc>
+}
+  80345a:	c9                   	leave
+  80345b:	c3                   	ret
+
+0080345c <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  80345c:	55                   	push   %ebp
+  80345d:	89 e5                	mov    %esp,%ebp
+  80345f:	53                   	push   %ebx
+  803460:	83 ec 10             	sub    $0x10,%esp
+  803463:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  803466:	68 18 70 80 00       	push   $0x807018
+  80346b:	e8 a1 07 00 00       	call   803c11 <mutex_lock>
+	if (v == 0)
+  803470:	83 c4 10             	add    $0x10,%esp
+  803473:	85 db                	test   %ebx,%ebx
+  803475:	0f 84 85 00 00 00    	je     803500 <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  80347b:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  803481:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  803486:	77 51                	ja     8034d9 <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  803488:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  80348e:	89 d8                	mov    %ebx,%eax
+  803490:	c1 e8 0c             	shr    $0xc,%eax
+  803493:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80349a:	f6 c4 02             	test   $0x2,%ah
+  80349d:	74 50                	je     8034ef <free+0x93>
+		sys_page_unmap(0, c);
+  80349f:	83 ec 08             	sub    $0x8,%esp
+  8034a2:	53                   	push   %ebx
+  8034a3:	6a 00                	push   $0x0
+  8034a5:	e8 d9 da ff ff       	call   800f83 <sys_page_unmap>
+		c += PGSIZE;
+  8034aa:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  8034b0:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  8034b6:	83 c4 10             	add    $0x10,%esp
+  8034b9:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  8034be:	76 ce                	jbe    80348e <free+0x32>
+  8034c0:	68 3f 52 80 00       	push   $0x80523f
+  8034c5:	68 d1 50 80 00       	push   $0x8050d1
+  8034ca:	68 82 00 00 00       	push   $0x82
+  8034cf:	68 32 52 80 00       	push   $0x805232
+  8034d4:	e8 14 cf ff ff       	call   8003ed <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  8034d9:	68 04 52 80 00       	push   $0x805204
+  8034de:	68 d1 50 80 00       	push   $0x8050d1
+  8034e3:	6a 7b                	push   $0x7b
+  8034e5:	68 32 52 80 00       	push   $0x805232
+  8034ea:	e8 fe ce ff ff       	call   8003ed <_panic>
+	if (--(*ref) == 0)
+  8034ef:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  8034f5:	83 e8 01             	sub    $0x1,%eax
+  8034f8:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  8034fe:	74 15                	je     803515 <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  803500:	83 ec 0c             	sub    $0xc,%esp
+  803503:	68 18 70 80 00       	push   $0x807018
+  803508:	e8 71 07 00 00       	call   803c7e <mutex_unlock>
+}
+  80350d:	83 c4 10             	add    $0x10,%esp
+  803510:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803513:	c9                   	leave
+  803514:	c3                   	ret
+		sys_page_unmap(0, c);
+  803515:	83 ec 08             	sub    $0x8,%esp
+  803518:	53                   	push   %ebx
+  803519:	6a 00                	push   $0x0
+  80351b:	e8 63 da ff ff       	call   800f83 <sys_page_unmap>
+  803520:	83 c4 10             	add    $0x10,%esp
+  803523:	eb db                	jmp    803500 <free+0xa4>
+
+00803525 <malloc>:
+{
+  803525:	55                   	push   %ebp
+  803526:	89 e5                	mov    %esp,%ebp
+  803528:	57                   	push   %edi
+  803529:	56                   	push   %esi
+  80352a:	53                   	push   %ebx
+  80352b:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  80352e:	68 18 70 80 00       	push   $0x807018
+  803533:	e8 d9 06 00 00       	call   803c11 <mutex_lock>
+	if (mptr == 0)
+  803538:	8b 3d 1c 70 80 00    	mov    0x80701c,%edi
+  80353e:	83 c4 10             	add    $0x10,%esp
+  803541:	85 ff                	test   %edi,%edi
+  803543:	74 6c                	je     8035b1 <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  803545:	8b 45 08             	mov    0x8(%ebp),%eax
+  803548:	83 c0 03             	add    $0x3,%eax
+  80354b:	83 e0 fc             	and    $0xfffffffc,%eax
+  80354e:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  803550:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  803555:	0f 87 64 01 00 00    	ja     8036bf <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  80355b:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803561:	74 30                	je     803593 <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  803563:	89 f9                	mov    %edi,%ecx
+  803565:	c1 e9 0c             	shr    $0xc,%ecx
+  803568:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  80356c:	c1 e8 0c             	shr    $0xc,%eax
+  80356f:	39 c1                	cmp    %eax,%ecx
+  803571:	74 5f                	je     8035d2 <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  803573:	83 ec 0c             	sub    $0xc,%esp
+  803576:	57                   	push   %edi
+  803577:	e8 e0 fe ff ff       	call   80345c <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  80357c:	a1 1c 70 80 00       	mov    0x80701c,%eax
+  803581:	05 00 10 00 00       	add    $0x1000,%eax
+  803586:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80358b:	a3 1c 70 80 00       	mov    %eax,0x80701c
+  803590:	83 c4 10             	add    $0x10,%esp
+  803593:	8b 0d 1c 70 80 00    	mov    0x80701c,%ecx
+{
+  803599:	ba 02 00 00 00       	mov    $0x2,%edx
+  80359e:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  8035a2:	8d 7e 04             	lea    0x4(%esi),%edi
+  8035a5:	89 cb                	mov    %ecx,%ebx
+  8035a7:	01 f9                	add    %edi,%ecx
+  8035a9:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8035ac:	e9 8b 00 00 00       	jmp    80363c <malloc+0x117>
+		mptr = mbegin;
+  8035b1:	c7 05 1c 70 80 00 00 	movl   $0x8000000,0x80701c
+  8035b8:	00 00 08 
+	n = ROUNDUP(n, 4);
+  8035bb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035be:	83 c0 03             	add    $0x3,%eax
+  8035c1:	83 e0 fc             	and    $0xfffffffc,%eax
+  8035c4:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  8035c6:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  8035cb:	76 c6                	jbe    803593 <malloc+0x6e>
+  8035cd:	e9 d6 00 00 00       	jmp    8036a8 <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  8035d2:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  8035d8:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  8035dd:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  8035e1:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  8035e4:	a3 1c 70 80 00       	mov    %eax,0x80701c
+			return v;
+  8035e9:	e9 ba 00 00 00       	jmp    8036a8 <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  8035ee:	05 00 10 00 00       	add    $0x1000,%eax
+  8035f3:	39 c8                	cmp    %ecx,%eax
+  8035f5:	0f 83 cb 00 00 00    	jae    8036c6 <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  8035fb:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  803600:	77 22                	ja     803624 <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  803602:	89 c2                	mov    %eax,%edx
+  803604:	c1 ea 16             	shr    $0x16,%edx
+  803607:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80360e:	f6 c2 01             	test   $0x1,%dl
+  803611:	74 db                	je     8035ee <malloc+0xc9>
+  803613:	89 c2                	mov    %eax,%edx
+  803615:	c1 ea 0c             	shr    $0xc,%edx
+  803618:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80361f:	f6 c2 01             	test   $0x1,%dl
+  803622:	74 ca                	je     8035ee <malloc+0xc9>
+		if (mptr == mend) {
+  803624:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80362a:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  803630:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  803634:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  80363a:	74 04                	je     803640 <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  80363c:	89 d8                	mov    %ebx,%eax
+  80363e:	eb b3                	jmp    8035f3 <malloc+0xce>
+  803640:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  803643:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  803648:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  80364c:	83 ea 01             	sub    $0x1,%edx
+  80364f:	0f 85 50 ff ff ff    	jne    8035a5 <malloc+0x80>
+  803655:	c7 05 1c 70 80 00 00 	movl   $0x8000000,0x80701c
+  80365c:	00 00 08 
+				return 0;	/* out of address space */
+  80365f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803664:	eb 42                	jmp    8036a8 <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  803666:	85 db                	test   %ebx,%ebx
+  803668:	78 1e                	js     803688 <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  80366a:	83 ec 08             	sub    $0x8,%esp
+  80366d:	89 d8                	mov    %ebx,%eax
+  80366f:	03 05 1c 70 80 00    	add    0x80701c,%eax
+  803675:	50                   	push   %eax
+  803676:	6a 00                	push   $0x0
+  803678:	e8 06 d9 ff ff       	call   800f83 <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  80367d:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  803683:	83 c4 10             	add    $0x10,%esp
+  803686:	eb de                	jmp    803666 <malloc+0x141>
+			return 0;	/* out of physical memory */
+  803688:	bf 00 00 00 00       	mov    $0x0,%edi
+  80368d:	eb 19                	jmp    8036a8 <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  80368f:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803692:	8b 3d 1c 70 80 00    	mov    0x80701c,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  803698:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  80369f:	00 
+	mptr += n;
+  8036a0:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  8036a3:	a3 1c 70 80 00       	mov    %eax,0x80701c
+	mutex_unlock(&malloc_mu);
+  8036a8:	83 ec 0c             	sub    $0xc,%esp
+  8036ab:	68 18 70 80 00       	push   $0x807018
+  8036b0:	e8 c9 05 00 00       	call   803c7e <mutex_unlock>
+}
+  8036b5:	89 f8                	mov    %edi,%eax
+  8036b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036ba:	5b                   	pop    %ebx
+  8036bb:	5e                   	pop    %esi
+  8036bc:	5f                   	pop    %edi
+  8036bd:	5d                   	pop    %ebp
+  8036be:	c3                   	ret
+		return 0;
+  8036bf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036c4:	eb e2                	jmp    8036a8 <malloc+0x183>
+  8036c6:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  8036ca:	74 06                	je     8036d2 <malloc+0x1ad>
+  8036cc:	89 1d 1c 70 80 00    	mov    %ebx,0x80701c
+	for (i = 0; i < n + 4; i += PGSIZE){
+  8036d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8036d7:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8036da:	39 fb                	cmp    %edi,%ebx
+  8036dc:	73 b1                	jae    80368f <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  8036de:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  8036e4:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  8036e7:	39 fe                	cmp    %edi,%esi
+  8036e9:	0f 92 c0             	setb   %al
+  8036ec:	0f b6 c0             	movzbl %al,%eax
+  8036ef:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  8036f2:	83 c8 07             	or     $0x7,%eax
+  8036f5:	50                   	push   %eax
+  8036f6:	89 d8                	mov    %ebx,%eax
+  8036f8:	03 05 1c 70 80 00    	add    0x80701c,%eax
+  8036fe:	50                   	push   %eax
+  8036ff:	6a 00                	push   $0x0
+  803701:	e8 e4 d7 ff ff       	call   800eea <sys_page_alloc>
+  803706:	83 c4 10             	add    $0x10,%esp
+  803709:	85 c0                	test   %eax,%eax
+  80370b:	0f 88 55 ff ff ff    	js     803666 <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  803711:	89 f3                	mov    %esi,%ebx
+  803713:	eb c5                	jmp    8036da <malloc+0x1b5>
+
+00803715 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  803715:	55                   	push   %ebp
+  803716:	89 e5                	mov    %esp,%ebp
+  803718:	56                   	push   %esi
+  803719:	53                   	push   %ebx
+  80371a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80371d:	83 ec 0c             	sub    $0xc,%esp
+  803720:	ff 75 08             	push   0x8(%ebp)
+  803723:	e8 ea e2 ff ff       	call   801a12 <fd2data>
+  803728:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80372a:	83 c4 08             	add    $0x8,%esp
+  80372d:	68 57 52 80 00       	push   $0x805257
+  803732:	53                   	push   %ebx
+  803733:	e8 74 d3 ff ff       	call   800aac <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  803738:	8b 46 04             	mov    0x4(%esi),%eax
+  80373b:	2b 06                	sub    (%esi),%eax
+  80373d:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  803743:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80374a:	00 00 00 
+	stat->st_dev = &devpipe;
+  80374d:	c7 83 88 00 00 00 7c 	movl   $0x80627c,0x88(%ebx)
+  803754:	62 80 00 
+	return 0;
+}
+  803757:	b8 00 00 00 00       	mov    $0x0,%eax
+  80375c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80375f:	5b                   	pop    %ebx
+  803760:	5e                   	pop    %esi
+  803761:	5d                   	pop    %ebp
+  803762:	c3                   	ret
+
+00803763 <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  803763:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803768:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  80376c:	85 c9                	test   %ecx,%ecx
+  80376e:	75 01                	jne    803771 <pipewake+0xe>
+  803770:	c3                   	ret
+{
+  803771:	55                   	push   %ebp
+  803772:	89 e5                	mov    %esp,%ebp
+  803774:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  803777:	68 00 04 00 00       	push   $0x400
+  80377c:	52                   	push   %edx
+  80377d:	e8 ac da ff ff       	call   80122e <sys_futex_wake>
+  803782:	83 c4 10             	add    $0x10,%esp
+}
+  803785:	c9                   	leave
+  803786:	c3                   	ret
+
+00803787 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803787:	55                   	push   %ebp
+  803788:	89 e5                	mov    %esp,%ebp
+  80378a:	56                   	push   %esi
+  80378b:	53                   	push   %ebx
+  80378c:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80378f:	83 ec 0c             	sub    $0xc,%esp
+  803792:	56                   	push   %esi
+  803793:	e8 7a e2 ff ff       	call   801a12 <fd2data>
+  803798:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  80379a:	83 c4 08             	add    $0x8,%esp
+  80379d:	56                   	push   %esi
+  80379e:	6a 00                	push   $0x0
+  8037a0:	e8 de d7 ff ff       	call   800f83 <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  8037a5:	8d 53 04             	lea    0x4(%ebx),%edx
+  8037a8:	8d 43 08             	lea    0x8(%ebx),%eax
+  8037ab:	e8 b3 ff ff ff       	call   803763 <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  8037b0:	8d 43 0c             	lea    0xc(%ebx),%eax
+  8037b3:	89 da                	mov    %ebx,%edx
+  8037b5:	e8 a9 ff ff ff       	call   803763 <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  8037ba:	89 34 24             	mov    %esi,(%esp)
+  8037bd:	e8 50 e2 ff ff       	call   801a12 <fd2data>
+  8037c2:	83 c4 08             	add    $0x8,%esp
+  8037c5:	50                   	push   %eax
+  8037c6:	6a 00                	push   $0x0
+  8037c8:	e8 b6 d7 ff ff       	call   800f83 <sys_page_unmap>
+}
+  8037cd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8037d0:	5b                   	pop    %ebx
+  8037d1:	5e                   	pop    %esi
+  8037d2:	5d                   	pop    %ebp
+  8037d3:	c3                   	ret
+
+008037d4 <_pipeisclosed>:
+{
+  8037d4:	55                   	push   %ebp
+  8037d5:	89 e5                	mov    %esp,%ebp
+  8037d7:	57                   	push   %edi
+  8037d8:	56                   	push   %esi
+  8037d9:	53                   	push   %ebx
+  8037da:	83 ec 1c             	sub    $0x1c,%esp
+  8037dd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8037e0:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8037e2:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  8037e7:	eb 5d                	jmp    803846 <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  8037e9:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		n = thisenv->env_runs;
+  8037ef:	8b 02                	mov    (%edx),%eax
+  8037f1:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8037f4:	83 ec 0c             	sub    $0xc,%esp
+  8037f7:	ff 75 e0             	push   -0x20(%ebp)
+  8037fa:	e8 81 0f 00 00       	call   804780 <pageref>
+  8037ff:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803802:	89 3c 24             	mov    %edi,(%esp)
+  803805:	e8 76 0f 00 00       	call   804780 <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  80380a:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80380c:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  803812:	83 c4 10             	add    $0x10,%esp
+  803815:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  80381b:	77 15                	ja     803832 <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80381d:	89 f2                	mov    %esi,%edx
+  80381f:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  803821:	c1 ea 10             	shr    $0x10,%edx
+  803824:	74 0c                	je     803832 <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803826:	c1 e2 10             	shl    $0x10,%edx
+  803829:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80382e:	29 d1                	sub    %edx,%ecx
+  803830:	eb 06                	jmp    803838 <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  803832:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		nn = thisenv->env_runs;
+  803838:	8b 11                	mov    (%ecx),%edx
+  80383a:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  80383d:	39 d3                	cmp    %edx,%ebx
+  80383f:	74 6e                	je     8038af <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  803841:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803844:	74 24                	je     80386a <_pipeisclosed+0x96>
+  803846:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803848:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80384e:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803853:	77 94                	ja     8037e9 <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803855:	89 f0                	mov    %esi,%eax
+  803857:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803859:	c1 e8 10             	shr    $0x10,%eax
+  80385c:	74 8b                	je     8037e9 <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80385e:	c1 e0 10             	shl    $0x10,%eax
+  803861:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803866:	29 c2                	sub    %eax,%edx
+  803868:	eb 85                	jmp    8037ef <_pipeisclosed+0x1b>
+  80386a:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80386c:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803872:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803877:	77 18                	ja     803891 <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803879:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80387e:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803880:	c1 e8 10             	shr    $0x10,%eax
+  803883:	74 0c                	je     803891 <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803885:	c1 e0 10             	shl    $0x10,%eax
+  803888:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80388d:	29 c2                	sub    %eax,%edx
+  80388f:	eb 06                	jmp    803897 <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  803891:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803897:	8b 02                	mov    (%edx),%eax
+  803899:	8b 40 58             	mov    0x58(%eax),%eax
+  80389c:	6a 01                	push   $0x1
+  80389e:	50                   	push   %eax
+  80389f:	53                   	push   %ebx
+  8038a0:	68 5e 52 80 00       	push   $0x80525e
+  8038a5:	e8 1e cc ff ff       	call   8004c8 <cprintf>
+  8038aa:	83 c4 10             	add    $0x10,%esp
+  8038ad:	eb 97                	jmp    803846 <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  8038af:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8038b2:	0f 94 c0             	sete   %al
+  8038b5:	0f b6 c0             	movzbl %al,%eax
+}
+  8038b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8038bb:	5b                   	pop    %ebx
+  8038bc:	5e                   	pop    %esi
+  8038bd:	5f                   	pop    %edi
+  8038be:	5d                   	pop    %ebp
+  8038bf:	c3                   	ret
+
+008038c0 <devpipe_write>:
+{
+  8038c0:	55                   	push   %ebp
+  8038c1:	89 e5                	mov    %esp,%ebp
+  8038c3:	57                   	push   %edi
+  8038c4:	56                   	push   %esi
+  8038c5:	53                   	push   %ebx
+  8038c6:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  8038c9:	ff 75 08             	push   0x8(%ebp)
+  8038cc:	e8 41 e1 ff ff       	call   801a12 <fd2data>
+  8038d1:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8038d3:	83 c4 10             	add    $0x10,%esp
+  8038d6:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  8038dd:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  8038e0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8038e3:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8038e6:	0f 84 96 00 00 00    	je     803982 <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  8038ec:	8d 73 08             	lea    0x8(%ebx),%esi
+  8038ef:	eb 32                	jmp    803923 <devpipe_write+0x63>
+  8038f1:	89 fa                	mov    %edi,%edx
+  8038f3:	89 f0                	mov    %esi,%eax
+  8038f5:	e8 69 fe ff ff       	call   803763 <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  8038fa:	8b 43 04             	mov    0x4(%ebx),%eax
+  8038fd:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  803900:	ba 01 00 00 00       	mov    $0x1,%edx
+  803905:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  80390a:	83 ec 04             	sub    $0x4,%esp
+  80390d:	6a 0a                	push   $0xa
+  80390f:	50                   	push   %eax
+  803910:	53                   	push   %ebx
+  803911:	e8 e9 d8 ff ff       	call   8011ff <sys_futex_wait>
+  803916:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80391b:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  803920:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  803923:	8b 43 04             	mov    0x4(%ebx),%eax
+  803926:	8b 0b                	mov    (%ebx),%ecx
+  803928:	8d 51 20             	lea    0x20(%ecx),%edx
+  80392b:	39 d0                	cmp    %edx,%eax
+  80392d:	72 1b                	jb     80394a <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  80392f:	89 da                	mov    %ebx,%edx
+  803931:	8b 45 08             	mov    0x8(%ebp),%eax
+  803934:	e8 9b fe ff ff       	call   8037d4 <_pipeisclosed>
+  803939:	85 c0                	test   %eax,%eax
+  80393b:	74 b4                	je     8038f1 <devpipe_write+0x31>
+				return 0;
+  80393d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803942:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803945:	5b                   	pop    %ebx
+  803946:	5e                   	pop    %esi
+  803947:	5f                   	pop    %edi
+  803948:	5d                   	pop    %ebp
+  803949:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80394a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80394d:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803950:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  803954:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  803957:	89 c2                	mov    %eax,%edx
+  803959:	c1 fa 1f             	sar    $0x1f,%edx
+  80395c:	89 d1                	mov    %edx,%ecx
+  80395e:	c1 e9 1b             	shr    $0x1b,%ecx
+  803961:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  803964:	83 e2 1f             	and    $0x1f,%edx
+  803967:	29 ca                	sub    %ecx,%edx
+  803969:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  80396d:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  803971:	83 c0 01             	add    $0x1,%eax
+  803974:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  803977:	83 c6 01             	add    $0x1,%esi
+  80397a:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  80397d:	e9 5e ff ff ff       	jmp    8038e0 <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  803982:	8d 53 04             	lea    0x4(%ebx),%edx
+  803985:	8d 43 08             	lea    0x8(%ebx),%eax
+  803988:	e8 d6 fd ff ff       	call   803763 <pipewake>
+	return i;
+  80398d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803990:	eb b0                	jmp    803942 <devpipe_write+0x82>
+
+00803992 <devpipe_read>:
+{
+  803992:	55                   	push   %ebp
+  803993:	89 e5                	mov    %esp,%ebp
+  803995:	57                   	push   %edi
+  803996:	56                   	push   %esi
+  803997:	53                   	push   %ebx
+  803998:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  80399b:	ff 75 08             	push   0x8(%ebp)
+  80399e:	e8 6f e0 ff ff       	call   801a12 <fd2data>
+  8039a3:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8039a5:	83 c4 10             	add    $0x10,%esp
+  8039a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8039ad:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8039b0:	74 6c                	je     803a1e <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  8039b2:	8d 7b 04             	lea    0x4(%ebx),%edi
+  8039b5:	eb 25                	jmp    8039dc <devpipe_read+0x4a>
+  8039b7:	8b 13                	mov    (%ebx),%edx
+  8039b9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8039be:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  8039c3:	83 ec 04             	sub    $0x4,%esp
+  8039c6:	6a 0a                	push   $0xa
+  8039c8:	52                   	push   %edx
+  8039c9:	57                   	push   %edi
+  8039ca:	e8 30 d8 ff ff       	call   8011ff <sys_futex_wait>
+  8039cf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8039d4:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  8039d9:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  8039dc:	8b 03                	mov    (%ebx),%eax
+  8039de:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8039e1:	75 19                	jne    8039fc <devpipe_read+0x6a>
+			if (i > 0)
+  8039e3:	85 f6                	test   %esi,%esi
+  8039e5:	75 3a                	jne    803a21 <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  8039e7:	89 da                	mov    %ebx,%edx
+  8039e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8039ec:	e8 e3 fd ff ff       	call   8037d4 <_pipeisclosed>
+  8039f1:	85 c0                	test   %eax,%eax
+  8039f3:	74 c2                	je     8039b7 <devpipe_read+0x25>
+				return 0;
+  8039f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039fa:	eb 31                	jmp    803a2d <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8039fc:	89 c1                	mov    %eax,%ecx
+  8039fe:	c1 f9 1f             	sar    $0x1f,%ecx
+  803a01:	c1 e9 1b             	shr    $0x1b,%ecx
+  803a04:	01 c8                	add    %ecx,%eax
+  803a06:	83 e0 1f             	and    $0x1f,%eax
+  803a09:	29 c8                	sub    %ecx,%eax
+  803a0b:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  803a10:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803a13:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  803a16:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  803a19:	83 c6 01             	add    $0x1,%esi
+  803a1c:	eb 8f                	jmp    8039ad <devpipe_read+0x1b>
+out:
+  803a1e:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  803a21:	8d 43 0c             	lea    0xc(%ebx),%eax
+  803a24:	89 da                	mov    %ebx,%edx
+  803a26:	e8 38 fd ff ff       	call   803763 <pipewake>
+	return i;
+  803a2b:	89 f0                	mov    %esi,%eax
+}
+  803a2d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a30:	5b                   	pop    %ebx
+  803a31:	5e                   	pop    %esi
+  803a32:	5f                   	pop    %edi
+  803a33:	5d                   	pop    %ebp
+  803a34:	c3                   	ret
+
+00803a35 <pipe>:
+{
+  803a35:	55                   	push   %ebp
+  803a36:	89 e5                	mov    %esp,%ebp
+  803a38:	56                   	push   %esi
+  803a39:	53                   	push   %ebx
+  803a3a:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803a3d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803a40:	50                   	push   %eax
+  803a41:	e8 e3 df ff ff       	call   801a29 <fd_alloc>
+  803a46:	89 c3                	mov    %eax,%ebx
+  803a48:	83 c4 10             	add    $0x10,%esp
+  803a4b:	85 c0                	test   %eax,%eax
+  803a4d:	0f 88 23 01 00 00    	js     803b76 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803a53:	83 ec 04             	sub    $0x4,%esp
+  803a56:	68 07 04 00 00       	push   $0x407
+  803a5b:	ff 75 f4             	push   -0xc(%ebp)
+  803a5e:	6a 00                	push   $0x0
+  803a60:	e8 85 d4 ff ff       	call   800eea <sys_page_alloc>
+  803a65:	89 c3                	mov    %eax,%ebx
+  803a67:	83 c4 10             	add    $0x10,%esp
+  803a6a:	85 c0                	test   %eax,%eax
+  803a6c:	0f 88 04 01 00 00    	js     803b76 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803a72:	83 ec 0c             	sub    $0xc,%esp
+  803a75:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803a78:	50                   	push   %eax
+  803a79:	e8 ab df ff ff       	call   801a29 <fd_alloc>
+  803a7e:	89 c3                	mov    %eax,%ebx
+  803a80:	83 c4 10             	add    $0x10,%esp
+  803a83:	85 c0                	test   %eax,%eax
+  803a85:	0f 88 db 00 00 00    	js     803b66 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803a8b:	83 ec 04             	sub    $0x4,%esp
+  803a8e:	68 07 04 00 00       	push   $0x407
+  803a93:	ff 75 f0             	push   -0x10(%ebp)
+  803a96:	6a 00                	push   $0x0
+  803a98:	e8 4d d4 ff ff       	call   800eea <sys_page_alloc>
+  803a9d:	89 c3                	mov    %eax,%ebx
+  803a9f:	83 c4 10             	add    $0x10,%esp
+  803aa2:	85 c0                	test   %eax,%eax
+  803aa4:	0f 88 bc 00 00 00    	js     803b66 <pipe+0x131>
+	va = fd2data(fd0);
+  803aaa:	83 ec 0c             	sub    $0xc,%esp
+  803aad:	ff 75 f4             	push   -0xc(%ebp)
+  803ab0:	e8 5d df ff ff       	call   801a12 <fd2data>
+  803ab5:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803ab7:	83 c4 0c             	add    $0xc,%esp
+  803aba:	68 07 04 00 00       	push   $0x407
+  803abf:	50                   	push   %eax
+  803ac0:	6a 00                	push   $0x0
+  803ac2:	e8 23 d4 ff ff       	call   800eea <sys_page_alloc>
+  803ac7:	89 c3                	mov    %eax,%ebx
+  803ac9:	83 c4 10             	add    $0x10,%esp
+  803acc:	85 c0                	test   %eax,%eax
+  803ace:	0f 88 82 00 00 00    	js     803b56 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803ad4:	83 ec 0c             	sub    $0xc,%esp
+  803ad7:	ff 75 f0             	push   -0x10(%ebp)
+  803ada:	e8 33 df ff ff       	call   801a12 <fd2data>
+  803adf:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803ae6:	50                   	push   %eax
+  803ae7:	6a 00                	push   $0x0
+  803ae9:	56                   	push   %esi
+  803aea:	6a 00                	push   $0x0
+  803aec:	e8 46 d4 ff ff       	call   800f37 <sys_page_map>
+  803af1:	89 c3                	mov    %eax,%ebx
+  803af3:	83 c4 20             	add    $0x20,%esp
+  803af6:	85 c0                	test   %eax,%eax
+  803af8:	78 4e                	js     803b48 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803afa:	a1 7c 62 80 00       	mov    0x80627c,%eax
+  803aff:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803b02:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803b04:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803b07:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803b0e:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803b11:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803b13:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803b16:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803b1d:	83 ec 0c             	sub    $0xc,%esp
+  803b20:	ff 75 f4             	push   -0xc(%ebp)
+  803b23:	e8 da de ff ff       	call   801a02 <fd2num>
+  803b28:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803b2b:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803b2d:	83 c4 04             	add    $0x4,%esp
+  803b30:	ff 75 f0             	push   -0x10(%ebp)
+  803b33:	e8 ca de ff ff       	call   801a02 <fd2num>
+  803b38:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803b3b:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803b3e:	83 c4 10             	add    $0x10,%esp
+  803b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803b46:	eb 2e                	jmp    803b76 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803b48:	83 ec 08             	sub    $0x8,%esp
+  803b4b:	56                   	push   %esi
+  803b4c:	6a 00                	push   $0x0
+  803b4e:	e8 30 d4 ff ff       	call   800f83 <sys_page_unmap>
+  803b53:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803b56:	83 ec 08             	sub    $0x8,%esp
+  803b59:	ff 75 f0             	push   -0x10(%ebp)
+  803b5c:	6a 00                	push   $0x0
+  803b5e:	e8 20 d4 ff ff       	call   800f83 <sys_page_unmap>
+  803b63:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803b66:	83 ec 08             	sub    $0x8,%esp
+  803b69:	ff 75 f4             	push   -0xc(%ebp)
+  803b6c:	6a 00                	push   $0x0
+  803b6e:	e8 10 d4 ff ff       	call   800f83 <sys_page_unmap>
+  803b73:	83 c4 10             	add    $0x10,%esp
+}
+  803b76:	89 d8                	mov    %ebx,%eax
+  803b78:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803b7b:	5b                   	pop    %ebx
+  803b7c:	5e                   	pop    %esi
+  803b7d:	5d                   	pop    %ebp
+  803b7e:	c3                   	ret
+
+00803b7f <pipeisclosed>:
+{
+  803b7f:	55                   	push   %ebp
+  803b80:	89 e5                	mov    %esp,%ebp
+  803b82:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803b85:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803b88:	50                   	push   %eax
+  803b89:	ff 75 08             	push   0x8(%ebp)
+  803b8c:	e8 ee de ff ff       	call   801a7f <fd_lookup>
+  803b91:	83 c4 10             	add    $0x10,%esp
+  803b94:	85 c0                	test   %eax,%eax
+  803b96:	78 18                	js     803bb0 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803b98:	83 ec 0c             	sub    $0xc,%esp
+  803b9b:	ff 75 f4             	push   -0xc(%ebp)
+  803b9e:	e8 6f de ff ff       	call   801a12 <fd2data>
+  803ba3:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803ba5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803ba8:	e8 27 fc ff ff       	call   8037d4 <_pipeisclosed>
+  803bad:	83 c4 10             	add    $0x10,%esp
+}
+  803bb0:	c9                   	leave
+  803bb1:	c3                   	ret
+
+00803bb2 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  803bb2:	55                   	push   %ebp
+  803bb3:	89 e5                	mov    %esp,%ebp
+  803bb5:	56                   	push   %esi
+  803bb6:	53                   	push   %ebx
+  803bb7:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  803bba:	85 f6                	test   %esi,%esi
+  803bbc:	74 15                	je     803bd3 <wait+0x21>
+	e = &envs[ENVX(envid)];
+  803bbe:	89 f0                	mov    %esi,%eax
+  803bc0:	25 ff 03 00 00       	and    $0x3ff,%eax
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  803bc5:	8d 1c c0             	lea    (%eax,%eax,8),%ebx
+  803bc8:	c1 e3 04             	shl    $0x4,%ebx
+  803bcb:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  803bd1:	eb 1b                	jmp    803bee <wait+0x3c>
+	assert(envid != 0);
+  803bd3:	68 76 52 80 00       	push   $0x805276
+  803bd8:	68 d1 50 80 00       	push   $0x8050d1
+  803bdd:	6a 09                	push   $0x9
+  803bdf:	68 81 52 80 00       	push   $0x805281
+  803be4:	e8 04 c8 ff ff       	call   8003ed <_panic>
+		sys_yield();
+  803be9:	e8 d0 d2 ff ff       	call   800ebe <sys_yield>
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  803bee:	8b 43 48             	mov    0x48(%ebx),%eax
+  803bf1:	39 f0                	cmp    %esi,%eax
+  803bf3:	75 07                	jne    803bfc <wait+0x4a>
+  803bf5:	8b 43 54             	mov    0x54(%ebx),%eax
+  803bf8:	85 c0                	test   %eax,%eax
+  803bfa:	75 ed                	jne    803be9 <wait+0x37>
+}
+  803bfc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803bff:	5b                   	pop    %ebx
+  803c00:	5e                   	pop    %esi
+  803c01:	5d                   	pop    %ebp
+  803c02:	c3                   	ret
+
+00803c03 <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  803c03:	55                   	push   %ebp
+  803c04:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  803c06:	8b 45 08             	mov    0x8(%ebp),%eax
+  803c09:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803c0f:	5d                   	pop    %ebp
+  803c10:	c3                   	ret
+
+00803c11 <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  803c11:	55                   	push   %ebp
+  803c12:	89 e5                	mov    %esp,%ebp
+  803c14:	56                   	push   %esi
+  803c15:	53                   	push   %ebx
+  803c16:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803c19:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c1e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803c23:	89 d0                	mov    %edx,%eax
+  803c25:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  803c29:	85 c0                	test   %eax,%eax
+  803c2b:	74 2d                	je     803c5a <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  803c2d:	83 f8 02             	cmp    $0x2,%eax
+  803c30:	74 08                	je     803c3a <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  803c32:	b8 02 00 00 00       	mov    $0x2,%eax
+  803c37:	f0 87 03             	lock xchg %eax,(%ebx)
+  803c3a:	be 02 00 00 00       	mov    $0x2,%esi
+  803c3f:	eb 15                	jmp    803c56 <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  803c41:	83 ec 04             	sub    $0x4,%esp
+  803c44:	6a 00                	push   $0x0
+  803c46:	6a 02                	push   $0x2
+  803c48:	53                   	push   %ebx
+  803c49:	e8 b1 d5 ff ff       	call   8011ff <sys_futex_wait>
+  803c4e:	89 f0                	mov    %esi,%eax
+  803c50:	f0 87 03             	lock xchg %eax,(%ebx)
+  803c53:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  803c56:	85 c0                	test   %eax,%eax
+  803c58:	75 e7                	jne    803c41 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  803c5a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803c5d:	5b                   	pop    %ebx
+  803c5e:	5e                   	pop    %esi
+  803c5f:	5d                   	pop    %ebp
+  803c60:	c3                   	ret
+
+00803c61 <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  803c61:	55                   	push   %ebp
+  803c62:	89 e5                	mov    %esp,%ebp
+  803c64:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803c67:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c6c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803c71:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  803c75:	f7 d8                	neg    %eax
+  803c77:	19 c0                	sbb    %eax,%eax
+  803c79:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  803c7c:	5d                   	pop    %ebp
+  803c7d:	c3                   	ret
+
+00803c7e <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  803c7e:	55                   	push   %ebp
+  803c7f:	89 e5                	mov    %esp,%ebp
+  803c81:	83 ec 08             	sub    $0x8,%esp
+  803c84:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  803c87:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c8c:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  803c8f:	83 f8 02             	cmp    $0x2,%eax
+  803c92:	74 02                	je     803c96 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  803c94:	c9                   	leave
+  803c95:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  803c96:	83 ec 08             	sub    $0x8,%esp
+  803c99:	6a 01                	push   $0x1
+  803c9b:	52                   	push   %edx
+  803c9c:	e8 8d d5 ff ff       	call   80122e <sys_futex_wake>
+  803ca1:	83 c4 10             	add    $0x10,%esp
+}
+  803ca4:	eb ee                	jmp    803c94 <mutex_unlock+0x16>
+
+00803ca6 <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  803ca6:	55                   	push   %ebp
+  803ca7:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  803ca9:	8b 45 08             	mov    0x8(%ebp),%eax
+  803cac:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803cb2:	5d                   	pop    %ebp
+  803cb3:	c3                   	ret
+
+00803cb4 <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  803cb4:	55                   	push   %ebp
+  803cb5:	89 e5                	mov    %esp,%ebp
+  803cb7:	57                   	push   %edi
+  803cb8:	56                   	push   %esi
+  803cb9:	53                   	push   %ebx
+  803cba:	83 ec 18             	sub    $0x18,%esp
+  803cbd:	8b 75 08             	mov    0x8(%ebp),%esi
+  803cc0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  803cc3:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  803cc5:	53                   	push   %ebx
+  803cc6:	e8 b3 ff ff ff       	call   803c7e <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  803ccb:	83 c4 0c             	add    $0xc,%esp
+  803cce:	ff 75 10             	push   0x10(%ebp)
+  803cd1:	57                   	push   %edi
+  803cd2:	56                   	push   %esi
+  803cd3:	e8 27 d5 ff ff       	call   8011ff <sys_futex_wait>
+  803cd8:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  803cda:	83 c4 10             	add    $0x10,%esp
+  803cdd:	be 02 00 00 00       	mov    $0x2,%esi
+  803ce2:	eb 10                	jmp    803cf4 <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  803ce4:	83 ec 04             	sub    $0x4,%esp
+  803ce7:	6a 00                	push   $0x0
+  803ce9:	6a 02                	push   $0x2
+  803ceb:	53                   	push   %ebx
+  803cec:	e8 0e d5 ff ff       	call   8011ff <sys_futex_wait>
+  803cf1:	83 c4 10             	add    $0x10,%esp
+  803cf4:	89 f0                	mov    %esi,%eax
+  803cf6:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  803cf9:	85 c0                	test   %eax,%eax
+  803cfb:	75 e7                	jne    803ce4 <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  803cfd:	83 ff ec             	cmp    $0xffffffec,%edi
+  803d00:	74 05                	je     803d07 <cond_timedwait+0x53>
+  803d02:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803d07:	89 f8                	mov    %edi,%eax
+  803d09:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d0c:	5b                   	pop    %ebx
+  803d0d:	5e                   	pop    %esi
+  803d0e:	5f                   	pop    %edi
+  803d0f:	5d                   	pop    %ebp
+  803d10:	c3                   	ret
+
+00803d11 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  803d11:	55                   	push   %ebp
+  803d12:	89 e5                	mov    %esp,%ebp
+  803d14:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  803d17:	6a 00                	push   $0x0
+  803d19:	ff 75 0c             	push   0xc(%ebp)
+  803d1c:	ff 75 08             	push   0x8(%ebp)
+  803d1f:	e8 90 ff ff ff       	call   803cb4 <cond_timedwait>
+}
+  803d24:	83 c4 10             	add    $0x10,%esp
+  803d27:	c9                   	leave
+  803d28:	c3                   	ret
+
+00803d29 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  803d29:	55                   	push   %ebp
+  803d2a:	89 e5                	mov    %esp,%ebp
+  803d2c:	83 ec 10             	sub    $0x10,%esp
+  803d2f:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  803d32:	ba 01 00 00 00       	mov    $0x1,%edx
+  803d37:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  803d3b:	6a 01                	push   $0x1
+  803d3d:	50                   	push   %eax
+  803d3e:	e8 eb d4 ff ff       	call   80122e <sys_futex_wake>
+}
+  803d43:	83 c4 10             	add    $0x10,%esp
+  803d46:	c9                   	leave
+  803d47:	c3                   	ret
+
+00803d48 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  803d48:	55                   	push   %ebp
+  803d49:	89 e5                	mov    %esp,%ebp
+  803d4b:	83 ec 10             	sub    $0x10,%esp
+  803d4e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d51:	ba 01 00 00 00       	mov    $0x1,%edx
+  803d56:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  803d5a:	68 00 04 00 00       	push   $0x400
+  803d5f:	50                   	push   %eax
+  803d60:	e8 c9 d4 ff ff       	call   80122e <sys_futex_wake>
+}
+  803d65:	83 c4 10             	add    $0x10,%esp
+  803d68:	c9                   	leave
+  803d69:	c3                   	ret
+
+00803d6a <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  803d6a:	55                   	push   %ebp
+  803d6b:	89 e5                	mov    %esp,%ebp
+  803d6d:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  803d70:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803d73:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  803d75:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  803d7c:	5d                   	pop    %ebp
+  803d7d:	c3                   	ret
+
+00803d7e <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  803d7e:	55                   	push   %ebp
+  803d7f:	89 e5                	mov    %esp,%ebp
+  803d81:	53                   	push   %ebx
+  803d82:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  803d85:	8b 11                	mov    (%ecx),%edx
+  803d87:	85 d2                	test   %edx,%edx
+  803d89:	74 14                	je     803d9f <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  803d8b:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803d8e:	89 d0                	mov    %edx,%eax
+  803d90:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  803d94:	39 c2                	cmp    %eax,%edx
+  803d96:	75 ed                	jne    803d85 <sem_trywait+0x7>
+			return 0;
+  803d98:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d9d:	eb 05                	jmp    803da4 <sem_trywait+0x26>
+	return -E_AGAIN;
+  803d9f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  803da4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803da7:	c9                   	leave
+  803da8:	c3                   	ret
+
+00803da9 <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  803da9:	55                   	push   %ebp
+  803daa:	89 e5                	mov    %esp,%ebp
+  803dac:	57                   	push   %edi
+  803dad:	56                   	push   %esi
+  803dae:	53                   	push   %ebx
+  803daf:	83 ec 1c             	sub    $0x1c,%esp
+  803db2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803db5:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  803db8:	e8 ba d3 ff ff       	call   801177 <sys_time_msec>
+  803dbd:	01 f8                	add    %edi,%eax
+  803dbf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  803dc2:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  803dc7:	eb 28                	jmp    803df1 <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  803dc9:	b8 01 00 00 00       	mov    $0x1,%eax
+  803dce:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  803dd3:	83 ec 04             	sub    $0x4,%esp
+  803dd6:	56                   	push   %esi
+  803dd7:	6a 00                	push   $0x0
+  803dd9:	53                   	push   %ebx
+  803dda:	e8 20 d4 ff ff       	call   8011ff <sys_futex_wait>
+  803ddf:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  803de4:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  803de9:	83 c4 10             	add    $0x10,%esp
+  803dec:	83 f8 ec             	cmp    $0xffffffec,%eax
+  803def:	74 2e                	je     803e1f <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  803df1:	83 ec 0c             	sub    $0xc,%esp
+  803df4:	53                   	push   %ebx
+  803df5:	e8 84 ff ff ff       	call   803d7e <sem_trywait>
+  803dfa:	83 c4 10             	add    $0x10,%esp
+  803dfd:	85 c0                	test   %eax,%eax
+  803dff:	79 19                	jns    803e1a <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  803e01:	85 ff                	test   %edi,%edi
+  803e03:	74 c4                	je     803dc9 <sem_timedwait+0x20>
+  803e05:	e8 6d d3 ff ff       	call   801177 <sys_time_msec>
+  803e0a:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803e0d:	29 c6                	sub    %eax,%esi
+  803e0f:	85 f6                	test   %esi,%esi
+  803e11:	7f b6                	jg     803dc9 <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  803e13:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  803e18:	eb 05                	jmp    803e1f <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  803e1a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e1f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e22:	5b                   	pop    %ebx
+  803e23:	5e                   	pop    %esi
+  803e24:	5f                   	pop    %edi
+  803e25:	5d                   	pop    %ebp
+  803e26:	c3                   	ret
+
+00803e27 <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  803e27:	55                   	push   %ebp
+  803e28:	89 e5                	mov    %esp,%ebp
+  803e2a:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  803e2d:	6a 00                	push   $0x0
+  803e2f:	ff 75 08             	push   0x8(%ebp)
+  803e32:	e8 72 ff ff ff       	call   803da9 <sem_timedwait>
+}
+  803e37:	83 c4 10             	add    $0x10,%esp
+  803e3a:	c9                   	leave
+  803e3b:	c3                   	ret
+
+00803e3c <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  803e3c:	55                   	push   %ebp
+  803e3d:	89 e5                	mov    %esp,%ebp
+  803e3f:	83 ec 08             	sub    $0x8,%esp
+  803e42:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e45:	ba 01 00 00 00       	mov    $0x1,%edx
+  803e4a:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  803e4e:	8b 50 04             	mov    0x4(%eax),%edx
+  803e51:	85 d2                	test   %edx,%edx
+  803e53:	75 02                	jne    803e57 <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  803e55:	c9                   	leave
+  803e56:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  803e57:	83 ec 08             	sub    $0x8,%esp
+  803e5a:	6a 01                	push   $0x1
+  803e5c:	50                   	push   %eax
+  803e5d:	e8 cc d3 ff ff       	call   80122e <sys_futex_wake>
+  803e62:	83 c4 10             	add    $0x10,%esp
+}
+  803e65:	eb ee                	jmp    803e55 <sem_post+0x19>
+
+00803e67 <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  803e67:	55                   	push   %ebp
+  803e68:	89 e5                	mov    %esp,%ebp
+  803e6a:	57                   	push   %edi
+  803e6b:	56                   	push   %esi
+  803e6c:	53                   	push   %ebx
+  803e6d:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  803e70:	68 20 70 80 00       	push   $0x807020
+  803e75:	e8 97 fd ff ff       	call   803c11 <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  803e7a:	a1 44 70 80 00       	mov    0x807044,%eax
+  803e7f:	83 c4 10             	add    $0x10,%esp
+  803e82:	85 c0                	test   %eax,%eax
+  803e84:	75 19                	jne    803e9f <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  803e86:	a1 c0 72 80 00       	mov    0x8072c0,%eax
+  803e8b:	8b 00                	mov    (%eax),%eax
+  803e8d:	8b 40 48             	mov    0x48(%eax),%eax
+  803e90:	a3 40 70 80 00       	mov    %eax,0x807040
+		threads[0].th_state = PTH_RUNNING;
+  803e95:	c7 05 44 70 80 00 01 	movl   $0x1,0x807044
+  803e9c:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803e9f:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  803ea4:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803ea7:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803eae:	8b 40 04             	mov    0x4(%eax),%eax
+  803eb1:	85 c0                	test   %eax,%eax
+  803eb3:	0f 84 e4 00 00 00    	je     803f9d <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803eb9:	83 c3 01             	add    $0x1,%ebx
+  803ebc:	83 fb 20             	cmp    $0x20,%ebx
+  803ebf:	75 e3                	jne    803ea4 <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  803ec1:	83 ec 0c             	sub    $0xc,%esp
+  803ec4:	68 20 70 80 00       	push   $0x807020
+  803ec9:	e8 b0 fd ff ff       	call   803c7e <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  803ece:	83 c4 10             	add    $0x10,%esp
+  803ed1:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  803ed6:	e9 b8 00 00 00       	jmp    803f93 <pthread_create+0x12c>
+  803edb:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  803ede:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  803ee1:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  803ee3:	39 f3                	cmp    %esi,%ebx
+  803ee5:	73 16                	jae    803efd <pthread_create+0x96>
+		va -= PGSIZE;
+  803ee7:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  803eed:	83 ec 08             	sub    $0x8,%esp
+  803ef0:	56                   	push   %esi
+  803ef1:	6a 00                	push   $0x0
+  803ef3:	e8 8b d0 ff ff       	call   800f83 <sys_page_unmap>
+  803ef8:	83 c4 10             	add    $0x10,%esp
+  803efb:	eb e6                	jmp    803ee3 <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  803efd:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803f00:	83 ec 08             	sub    $0x8,%esp
+  803f03:	ff 75 e4             	push   -0x1c(%ebp)
+  803f06:	6a 00                	push   $0x0
+  803f08:	e8 76 d0 ff ff       	call   800f83 <sys_page_unmap>
+	return r;
+  803f0d:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  803f10:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803f13:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803f1a:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  803f21:	eb 70                	jmp    803f93 <pthread_create+0x12c>
+	th->th_fn = fn;
+  803f23:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803f26:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803f2d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803f30:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  803f33:	8b 55 10             	mov    0x10(%ebp),%edx
+  803f36:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  803f39:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  803f40:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  803f45:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803f48:	29 c8                	sub    %ecx,%eax
+  803f4a:	85 db                	test   %ebx,%ebx
+  803f4c:	0f 44 05 c0 72 80 00 	cmove  0x8072c0,%eax
+	*--esp = t;
+  803f53:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  803f56:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803f5d:	83 ec 04             	sub    $0x4,%esp
+  803f60:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803f65:	29 ca                	sub    %ecx,%edx
+  803f67:	52                   	push   %edx
+	*--esp = 0;
+  803f68:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803f6b:	50                   	push   %eax
+  803f6c:	68 c4 41 80 00       	push   $0x8041c4
+  803f71:	e8 5d d3 ff ff       	call   8012d3 <sys_thread_create>
+  803f76:	89 c7                	mov    %eax,%edi
+  803f78:	83 c4 10             	add    $0x10,%esp
+  803f7b:	85 c0                	test   %eax,%eax
+  803f7d:	78 91                	js     803f10 <pthread_create+0xa9>
+	th->th_env = id;
+  803f7f:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803f82:	89 3c 85 40 70 80 00 	mov    %edi,0x807040(,%eax,4)
+	*tp = t;
+  803f89:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f8c:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  803f8e:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803f93:	89 f8                	mov    %edi,%eax
+  803f95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803f98:	5b                   	pop    %ebx
+  803f99:	5e                   	pop    %esi
+  803f9a:	5f                   	pop    %edi
+  803f9b:	5d                   	pop    %ebp
+  803f9c:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  803f9d:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803fa0:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803fa7:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  803fae:	83 ec 0c             	sub    $0xc,%esp
+  803fb1:	68 20 70 80 00       	push   $0x807020
+  803fb6:	e8 c3 fc ff ff       	call   803c7e <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  803fbb:	89 d9                	mov    %ebx,%ecx
+  803fbd:	c1 e1 10             	shl    $0x10,%ecx
+  803fc0:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  803fc3:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  803fc8:	29 c8                	sub    %ecx,%eax
+  803fca:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  803fcd:	c1 e8 16             	shr    $0x16,%eax
+  803fd0:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803fd7:	83 c4 10             	add    $0x10,%esp
+  803fda:	a8 01                	test   $0x1,%al
+  803fdc:	74 15                	je     803ff3 <pthread_create+0x18c>
+  803fde:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803fe1:	c1 e8 0c             	shr    $0xc,%eax
+  803fe4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803feb:	a8 01                	test   $0x1,%al
+  803fed:	0f 85 30 ff ff ff    	jne    803f23 <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803ff3:	83 ec 04             	sub    $0x4,%esp
+  803ff6:	6a 07                	push   $0x7
+  803ff8:	ff 75 e4             	push   -0x1c(%ebp)
+  803ffb:	6a 00                	push   $0x0
+  803ffd:	e8 e8 ce ff ff       	call   800eea <sys_page_alloc>
+  804002:	89 c7                	mov    %eax,%edi
+  804004:	83 c4 10             	add    $0x10,%esp
+  804007:	85 c0                	test   %eax,%eax
+  804009:	0f 88 01 ff ff ff    	js     803f10 <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  80400f:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  804014:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  804017:	29 d0                	sub    %edx,%eax
+  804019:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80401c:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  80401e:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  804023:	29 d0                	sub    %edx,%eax
+  804025:	89 c7                	mov    %eax,%edi
+  804027:	39 fe                	cmp    %edi,%esi
+  804029:	0f 83 f4 fe ff ff    	jae    803f23 <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  80402f:	83 ec 04             	sub    $0x4,%esp
+  804032:	6a 07                	push   $0x7
+  804034:	56                   	push   %esi
+  804035:	6a 00                	push   $0x0
+  804037:	e8 ae ce ff ff       	call   800eea <sys_page_alloc>
+  80403c:	83 c4 10             	add    $0x10,%esp
+  80403f:	85 c0                	test   %eax,%eax
+  804041:	0f 88 94 fe ff ff    	js     803edb <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  804047:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80404d:	eb d8                	jmp    804027 <pthread_create+0x1c0>
+
+0080404f <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  80404f:	55                   	push   %ebp
+  804050:	89 e5                	mov    %esp,%ebp
+  804052:	57                   	push   %edi
+  804053:	56                   	push   %esi
+  804054:	53                   	push   %ebx
+  804055:	83 ec 0c             	sub    $0xc,%esp
+  804058:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  80405b:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  80405e:	83 f8 1e             	cmp    $0x1e,%eax
+  804061:	0f 87 c7 00 00 00    	ja     80412e <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  804067:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804069:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80406f:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804074:	77 12                	ja     804088 <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804076:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80407b:	29 d0                	sub    %edx,%eax
+  80407d:	c1 e8 10             	shr    $0x10,%eax
+  804080:	39 c3                	cmp    %eax,%ebx
+  804082:	0f 84 ad 00 00 00    	je     804135 <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  804088:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80408b:	8d 3c 85 44 70 80 00 	lea    0x807044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  804092:	8d 34 85 40 70 80 00 	lea    0x807040(,%eax,4),%esi
+  804099:	eb 10                	jmp    8040ab <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  80409b:	83 ec 04             	sub    $0x4,%esp
+  80409e:	6a 00                	push   $0x0
+  8040a0:	6a 01                	push   $0x1
+  8040a2:	57                   	push   %edi
+  8040a3:	e8 57 d1 ff ff       	call   8011ff <sys_futex_wait>
+  8040a8:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  8040ab:	8b 46 04             	mov    0x4(%esi),%eax
+  8040ae:	83 f8 01             	cmp    $0x1,%eax
+  8040b1:	74 e8                	je     80409b <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  8040b3:	83 f8 02             	cmp    $0x2,%eax
+  8040b6:	0f 85 80 00 00 00    	jne    80413c <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  8040bc:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  8040bf:	c1 e6 02             	shl    $0x2,%esi
+  8040c2:	eb 05                	jmp    8040c9 <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  8040c4:	e8 f5 cd ff ff       	call   800ebe <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  8040c9:	8b 8e 40 70 80 00    	mov    0x807040(%esi),%ecx
+  8040cf:	89 ca                	mov    %ecx,%edx
+  8040d1:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8040d7:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8040da:	c1 e0 04             	shl    $0x4,%eax
+  8040dd:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8040e2:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  8040e5:	39 c1                	cmp    %eax,%ecx
+  8040e7:	75 12                	jne    8040fb <pthread_join+0xac>
+  8040e9:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8040ec:	c1 e0 04             	shl    $0x4,%eax
+  8040ef:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8040f4:	8b 40 54             	mov    0x54(%eax),%eax
+  8040f7:	85 c0                	test   %eax,%eax
+  8040f9:	75 c9                	jne    8040c4 <pthread_join+0x75>
+	if (ret_store)
+  8040fb:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8040ff:	74 0f                	je     804110 <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  804101:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  804104:	8b 04 85 50 70 80 00 	mov    0x807050(,%eax,4),%eax
+  80410b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80410e:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  804110:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  804113:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  80411a:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  804121:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804126:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804129:	5b                   	pop    %ebx
+  80412a:	5e                   	pop    %esi
+  80412b:	5f                   	pop    %edi
+  80412c:	5d                   	pop    %ebp
+  80412d:	c3                   	ret
+		return -E_INVAL;
+  80412e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804133:	eb f1                	jmp    804126 <pthread_join+0xd7>
+  804135:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80413a:	eb ea                	jmp    804126 <pthread_join+0xd7>
+		return -E_INVAL;
+  80413c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804141:	eb e3                	jmp    804126 <pthread_join+0xd7>
+
+00804143 <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  804143:	55                   	push   %ebp
+  804144:	89 e5                	mov    %esp,%ebp
+  804146:	53                   	push   %ebx
+  804147:	83 ec 04             	sub    $0x4,%esp
+  80414a:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80414c:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804152:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804157:	77 0c                	ja     804165 <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804159:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80415e:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  804160:	c1 e8 10             	shr    $0x10,%eax
+  804163:	75 0a                	jne    80416f <pthread_exit+0x2c>
+		exit();
+  804165:	e8 5b c2 ff ff       	call   8003c5 <exit>
+  80416a:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  80416f:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  804176:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  804179:	8d 0c 8d 40 70 80 00 	lea    0x807040(,%ecx,4),%ecx
+  804180:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  804183:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  804186:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  80418d:	83 ec 08             	sub    $0x8,%esp
+  804190:	6a 20                	push   $0x20
+  804192:	01 c2                	add    %eax,%edx
+  804194:	8d 04 95 44 70 80 00 	lea    0x807044(,%edx,4),%eax
+  80419b:	50                   	push   %eax
+  80419c:	e8 8d d0 ff ff       	call   80122e <sys_futex_wake>
+	sys_env_destroy(0);
+  8041a1:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8041a8:	e8 9a cc ff ff       	call   800e47 <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  8041ad:	83 c4 0c             	add    $0xc,%esp
+  8041b0:	68 8c 52 80 00       	push   $0x80528c
+  8041b5:	68 a5 00 00 00       	push   $0xa5
+  8041ba:	68 a6 52 80 00       	push   $0x8052a6
+  8041bf:	e8 29 c2 ff ff       	call   8003ed <_panic>
+
+008041c4 <pthread_start>:
+{
+  8041c4:	55                   	push   %ebp
+  8041c5:	89 e5                	mov    %esp,%ebp
+  8041c7:	53                   	push   %ebx
+  8041c8:	83 ec 04             	sub    $0x4,%esp
+  8041cb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  8041ce:	e8 bf cc ff ff       	call   800e92 <sys_getenvid>
+  8041d3:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  8041d8:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+	if (t == 0)
+  8041de:	85 db                	test   %ebx,%ebx
+  8041e0:	74 0c                	je     8041ee <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8041e2:	89 d9                	mov    %ebx,%ecx
+  8041e4:	c1 e1 10             	shl    $0x10,%ecx
+  8041e7:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8041ec:	29 ca                	sub    %ecx,%edx
+  8041ee:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8041f1:	c1 e0 04             	shl    $0x4,%eax
+  8041f4:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8041f9:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  8041fb:	83 ec 0c             	sub    $0xc,%esp
+  8041fe:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  804205:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  804208:	ff 34 95 4c 70 80 00 	push   0x80704c(,%edx,4)
+  80420f:	ff 14 95 48 70 80 00 	call   *0x807048(,%edx,4)
+  804216:	89 04 24             	mov    %eax,(%esp)
+  804219:	e8 25 ff ff ff       	call   804143 <pthread_exit>
+
+0080421e <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  80421e:	55                   	push   %ebp
+  80421f:	89 e5                	mov    %esp,%ebp
+  804221:	57                   	push   %edi
+  804222:	56                   	push   %esi
+  804223:	53                   	push   %ebx
+  804224:	83 ec 1c             	sub    $0x1c,%esp
+  804227:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804229:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  80422f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804236:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80423b:	77 0d                	ja     80424a <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80423d:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804242:	29 d0                	sub    %edx,%eax
+  804244:	c1 e8 10             	shr    $0x10,%eax
+  804247:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  80424a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80424f:	eb 2f                	jmp    804280 <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  804251:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  804257:	8b 01                	mov    (%ecx),%eax
+  804259:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  80425c:	39 c2                	cmp    %eax,%edx
+  80425e:	75 14                	jne    804274 <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  804260:	83 ec 0c             	sub    $0xc,%esp
+  804263:	57                   	push   %edi
+  804264:	e8 de cb ff ff       	call   800e47 <sys_env_destroy>
+  804269:	83 c4 10             	add    $0x10,%esp
+  80426c:	85 c0                	test   %eax,%eax
+  80426e:	0f 88 97 00 00 00    	js     80430b <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  804274:	83 c3 01             	add    $0x1,%ebx
+  804277:	83 fb 20             	cmp    $0x20,%ebx
+  80427a:	0f 84 d2 00 00 00    	je     804352 <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  804280:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  804283:	74 ef                	je     804274 <pthread_kill_others+0x56>
+  804285:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  804288:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  80428f:	8b 40 04             	mov    0x4(%eax),%eax
+  804292:	83 f8 01             	cmp    $0x1,%eax
+  804295:	75 dd                	jne    804274 <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  804297:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80429a:	8b 3c 85 40 70 80 00 	mov    0x807040(,%eax,4),%edi
+  8042a1:	89 fe                	mov    %edi,%esi
+  8042a3:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  8042a9:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  8042ac:	c1 e0 04             	shl    $0x4,%eax
+  8042af:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8042b4:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  8042b7:	39 c7                	cmp    %eax,%edi
+  8042b9:	75 b9                	jne    804274 <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  8042bb:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  8042be:	c1 e0 04             	shl    $0x4,%eax
+  8042c1:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8042c6:	8b 40 54             	mov    0x54(%eax),%eax
+  8042c9:	85 c0                	test   %eax,%eax
+  8042cb:	74 a7                	je     804274 <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  8042cd:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  8042d0:	c1 e0 04             	shl    $0x4,%eax
+  8042d3:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  8042d9:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8042db:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  8042e1:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8042e6:	0f 87 65 ff ff ff    	ja     804251 <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8042ec:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8042f1:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  8042f3:	c1 e8 10             	shr    $0x10,%eax
+  8042f6:	0f 84 55 ff ff ff    	je     804251 <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8042fc:	c1 e0 10             	shl    $0x10,%eax
+  8042ff:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  804304:	29 c1                	sub    %eax,%ecx
+  804306:	e9 4c ff ff ff       	jmp    804257 <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  80430b:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  80430e:	c1 e2 04             	shl    $0x4,%edx
+  804311:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  804317:	8b 52 48             	mov    0x48(%edx),%edx
+  80431a:	39 fa                	cmp    %edi,%edx
+  80431c:	0f 85 52 ff ff ff    	jne    804274 <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  804322:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  804325:	c1 e2 04             	shl    $0x4,%edx
+  804328:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80432e:	8b 52 54             	mov    0x54(%edx),%edx
+  804331:	85 d2                	test   %edx,%edx
+  804333:	0f 84 3b ff ff ff    	je     804274 <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  804339:	83 ec 0c             	sub    $0xc,%esp
+  80433c:	50                   	push   %eax
+  80433d:	57                   	push   %edi
+  80433e:	68 b4 52 80 00       	push   $0x8052b4
+  804343:	68 bb 00 00 00       	push   $0xbb
+  804348:	68 a6 52 80 00       	push   $0x8052a6
+  80434d:	e8 9b c0 ff ff       	call   8003ed <_panic>
+	}
+}
+  804352:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804355:	5b                   	pop    %ebx
+  804356:	5e                   	pop    %esi
+  804357:	5f                   	pop    %edi
+  804358:	5d                   	pop    %ebp
+  804359:	c3                   	ret
+
+0080435a <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  80435a:	55                   	push   %ebp
+  80435b:	89 e5                	mov    %esp,%ebp
+  80435d:	53                   	push   %ebx
+  80435e:	83 ec 04             	sub    $0x4,%esp
+  804361:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804363:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  804369:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  80436f:	0f 87 85 00 00 00    	ja     8043fa <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804375:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  80437a:	29 c3                	sub    %eax,%ebx
+  80437c:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  80437f:	83 ec 04             	sub    $0x4,%esp
+  804382:	68 80 02 00 00       	push   $0x280
+  804387:	6a 00                	push   $0x0
+  804389:	68 40 70 80 00       	push   $0x807040
+  80438e:	e8 6a c8 ff ff       	call   800bfd <memset>
+	threads_mu.m_state = 0;
+  804393:	c7 05 20 70 80 00 00 	movl   $0x0,0x807020
+  80439a:	00 00 00 
+	if (self != 0) {
+  80439d:	83 c4 10             	add    $0x10,%esp
+  8043a0:	85 db                	test   %ebx,%ebx
+  8043a2:	74 51                	je     8043f5 <pthread_fork_child+0x9b>
+  8043a4:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8043a6:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8043ac:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8043b1:	77 18                	ja     8043cb <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8043b3:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8043b8:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8043ba:	c1 e8 10             	shr    $0x10,%eax
+  8043bd:	74 0c                	je     8043cb <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8043bf:	c1 e0 10             	shl    $0x10,%eax
+  8043c2:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8043c7:	29 c2                	sub    %eax,%edx
+  8043c9:	eb 06                	jmp    8043d1 <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  8043cb:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		threads[self].th_env = thisenv->env_id;
+  8043d1:	8b 02                	mov    (%edx),%eax
+  8043d3:	8b 48 48             	mov    0x48(%eax),%ecx
+  8043d6:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  8043dd:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  8043e0:	89 0c 95 40 70 80 00 	mov    %ecx,0x807040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  8043e7:	8d 04 95 40 70 80 00 	lea    0x807040(,%edx,4),%eax
+  8043ee:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  8043f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8043f8:	c9                   	leave
+  8043f9:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  8043fa:	83 ec 04             	sub    $0x4,%esp
+  8043fd:	68 80 02 00 00       	push   $0x280
+  804402:	6a 00                	push   $0x0
+  804404:	68 40 70 80 00       	push   $0x807040
+  804409:	e8 ef c7 ff ff       	call   800bfd <memset>
+	threads_mu.m_state = 0;
+  80440e:	c7 05 20 70 80 00 00 	movl   $0x0,0x807020
+  804415:	00 00 00 
+  804418:	83 c4 10             	add    $0x10,%esp
+  80441b:	eb d8                	jmp    8043f5 <pthread_fork_child+0x9b>
+
+0080441d <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80441d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804422:	c3                   	ret
+
+00804423 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  804423:	55                   	push   %ebp
+  804424:	89 e5                	mov    %esp,%ebp
+  804426:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  804429:	68 d9 52 80 00       	push   $0x8052d9
+  80442e:	ff 75 0c             	push   0xc(%ebp)
+  804431:	e8 76 c6 ff ff       	call   800aac <strcpy>
+	return 0;
+}
+  804436:	b8 00 00 00 00       	mov    $0x0,%eax
+  80443b:	c9                   	leave
+  80443c:	c3                   	ret
+
+0080443d <devcons_write>:
+{
+  80443d:	55                   	push   %ebp
+  80443e:	89 e5                	mov    %esp,%ebp
+  804440:	57                   	push   %edi
+  804441:	56                   	push   %esi
+  804442:	53                   	push   %ebx
+  804443:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  804449:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80444e:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  804454:	eb 2e                	jmp    804484 <devcons_write+0x47>
+		m = n - tot;
+  804456:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804459:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80445b:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804460:	39 c3                	cmp    %eax,%ebx
+  804462:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  804465:	83 ec 04             	sub    $0x4,%esp
+  804468:	53                   	push   %ebx
+  804469:	89 f0                	mov    %esi,%eax
+  80446b:	03 45 0c             	add    0xc(%ebp),%eax
+  80446e:	50                   	push   %eax
+  80446f:	57                   	push   %edi
+  804470:	e8 bd c7 ff ff       	call   800c32 <memmove>
+		sys_cputs(buf, m);
+  804475:	83 c4 08             	add    $0x8,%esp
+  804478:	53                   	push   %ebx
+  804479:	57                   	push   %edi
+  80447a:	e8 71 c9 ff ff       	call   800df0 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80447f:	01 de                	add    %ebx,%esi
+  804481:	83 c4 10             	add    $0x10,%esp
+  804484:	3b 75 10             	cmp    0x10(%ebp),%esi
+  804487:	72 cd                	jb     804456 <devcons_write+0x19>
+}
+  804489:	89 f0                	mov    %esi,%eax
+  80448b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80448e:	5b                   	pop    %ebx
+  80448f:	5e                   	pop    %esi
+  804490:	5f                   	pop    %edi
+  804491:	5d                   	pop    %ebp
+  804492:	c3                   	ret
+
+00804493 <devcons_read>:
+{
+  804493:	55                   	push   %ebp
+  804494:	89 e5                	mov    %esp,%ebp
+  804496:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  804499:	b8 00 00 00 00       	mov    $0x0,%eax
+  80449e:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8044a2:	75 07                	jne    8044ab <devcons_read+0x18>
+  8044a4:	eb 1f                	jmp    8044c5 <devcons_read+0x32>
+		sys_yield();
+  8044a6:	e8 13 ca ff ff       	call   800ebe <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8044ab:	e8 6b c9 ff ff       	call   800e1b <sys_cgetc>
+  8044b0:	85 c0                	test   %eax,%eax
+  8044b2:	74 f2                	je     8044a6 <devcons_read+0x13>
+	if (c < 0)
+  8044b4:	78 0f                	js     8044c5 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8044b6:	83 f8 04             	cmp    $0x4,%eax
+  8044b9:	74 0c                	je     8044c7 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8044bb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8044be:	88 02                	mov    %al,(%edx)
+	return 1;
+  8044c0:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8044c5:	c9                   	leave
+  8044c6:	c3                   	ret
+		return 0;
+  8044c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044cc:	eb f7                	jmp    8044c5 <devcons_read+0x32>
+
+008044ce <cputchar>:
+{
+  8044ce:	55                   	push   %ebp
+  8044cf:	89 e5                	mov    %esp,%ebp
+  8044d1:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8044d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8044d7:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8044da:	6a 01                	push   $0x1
+  8044dc:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8044df:	50                   	push   %eax
+  8044e0:	e8 0b c9 ff ff       	call   800df0 <sys_cputs>
+}
+  8044e5:	83 c4 10             	add    $0x10,%esp
+  8044e8:	c9                   	leave
+  8044e9:	c3                   	ret
+
+008044ea <getchar>:
+{
+  8044ea:	55                   	push   %ebp
+  8044eb:	89 e5                	mov    %esp,%ebp
+  8044ed:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8044f0:	6a 01                	push   $0x1
+  8044f2:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8044f5:	50                   	push   %eax
+  8044f6:	6a 00                	push   $0x0
+  8044f8:	e8 12 d8 ff ff       	call   801d0f <read>
+	if (r < 0)
+  8044fd:	83 c4 10             	add    $0x10,%esp
+  804500:	85 c0                	test   %eax,%eax
+  804502:	78 06                	js     80450a <getchar+0x20>
+	if (r < 1)
+  804504:	74 06                	je     80450c <getchar+0x22>
+	return c;
+  804506:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80450a:	c9                   	leave
+  80450b:	c3                   	ret
+		return -E_EOF;
+  80450c:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804511:	eb f7                	jmp    80450a <getchar+0x20>
+
+00804513 <iscons>:
+{
+  804513:	55                   	push   %ebp
+  804514:	89 e5                	mov    %esp,%ebp
+  804516:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804519:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80451c:	50                   	push   %eax
+  80451d:	ff 75 08             	push   0x8(%ebp)
+  804520:	e8 5a d5 ff ff       	call   801a7f <fd_lookup>
+  804525:	83 c4 10             	add    $0x10,%esp
+  804528:	85 c0                	test   %eax,%eax
+  80452a:	78 11                	js     80453d <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80452c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80452f:	8b 15 98 62 80 00    	mov    0x806298,%edx
+  804535:	39 10                	cmp    %edx,(%eax)
+  804537:	0f 94 c0             	sete   %al
+  80453a:	0f b6 c0             	movzbl %al,%eax
+}
+  80453d:	c9                   	leave
+  80453e:	c3                   	ret
+
+0080453f <opencons>:
+{
+  80453f:	55                   	push   %ebp
+  804540:	89 e5                	mov    %esp,%ebp
+  804542:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  804545:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804548:	50                   	push   %eax
+  804549:	e8 db d4 ff ff       	call   801a29 <fd_alloc>
+  80454e:	83 c4 10             	add    $0x10,%esp
+  804551:	85 c0                	test   %eax,%eax
+  804553:	78 3a                	js     80458f <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  804555:	83 ec 04             	sub    $0x4,%esp
+  804558:	68 07 04 00 00       	push   $0x407
+  80455d:	ff 75 f4             	push   -0xc(%ebp)
+  804560:	6a 00                	push   $0x0
+  804562:	e8 83 c9 ff ff       	call   800eea <sys_page_alloc>
+  804567:	83 c4 10             	add    $0x10,%esp
+  80456a:	85 c0                	test   %eax,%eax
+  80456c:	78 21                	js     80458f <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80456e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804571:	8b 15 98 62 80 00    	mov    0x806298,%edx
+  804577:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  804579:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80457c:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  804583:	83 ec 0c             	sub    $0xc,%esp
+  804586:	50                   	push   %eax
+  804587:	e8 76 d4 ff ff       	call   801a02 <fd2num>
+  80458c:	83 c4 10             	add    $0x10,%esp
+}
+  80458f:	c9                   	leave
+  804590:	c3                   	ret
+
+00804591 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804591:	55                   	push   %ebp
+  804592:	89 e5                	mov    %esp,%ebp
+  804594:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  804597:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  80459e:	74 0a                	je     8045aa <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8045a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8045a3:	a3 00 a0 80 00       	mov    %eax,0x80a000
+}
+  8045a8:	c9                   	leave
+  8045a9:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  8045aa:	83 ec 04             	sub    $0x4,%esp
+  8045ad:	6a 07                	push   $0x7
+  8045af:	68 00 f0 bf ee       	push   $0xeebff000
+  8045b4:	6a 00                	push   $0x0
+  8045b6:	e8 2f c9 ff ff       	call   800eea <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8045bb:	83 c4 08             	add    $0x8,%esp
+  8045be:	68 cf 45 80 00       	push   $0x8045cf
+  8045c3:	6a 00                	push   $0x0
+  8045c5:	e8 9d ca ff ff       	call   801067 <sys_env_set_pgfault_upcall>
+  8045ca:	83 c4 10             	add    $0x10,%esp
+  8045cd:	eb d1                	jmp    8045a0 <set_pgfault_handler+0xf>
+
+008045cf <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8045cf:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8045d0:	a1 00 a0 80 00       	mov    0x80a000,%eax
+	call *%eax
+  8045d5:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8045d7:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  8045da:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  8045de:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  8045e2:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  8045e5:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  8045e9:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  8045eb:	83 c4 08             	add    $0x8,%esp
+	popal
+  8045ee:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  8045ef:	83 c4 04             	add    $0x4,%esp
+	popfl
+  8045f2:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  8045f3:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  8045f4:	c3                   	ret
+
+008045f5 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8045f5:	55                   	push   %ebp
+  8045f6:	89 e5                	mov    %esp,%ebp
+  8045f8:	57                   	push   %edi
+  8045f9:	56                   	push   %esi
+  8045fa:	53                   	push   %ebx
+  8045fb:	83 ec 18             	sub    $0x18,%esp
+  8045fe:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804601:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804604:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  804607:	85 c0                	test   %eax,%eax
+  804609:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80460e:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  804611:	50                   	push   %eax
+  804612:	e8 c9 ca ff ff       	call   8010e0 <sys_ipc_recv>
+	if (r < 0) {
+  804617:	83 c4 10             	add    $0x10,%esp
+  80461a:	85 c0                	test   %eax,%eax
+  80461c:	78 2b                	js     804649 <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  80461e:	85 ff                	test   %edi,%edi
+  804620:	74 55                	je     804677 <ipc_recv+0x82>
+  804622:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804624:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80462a:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80462f:	77 39                	ja     80466a <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804631:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804636:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804638:	c1 e8 10             	shr    $0x10,%eax
+  80463b:	74 2d                	je     80466a <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80463d:	c1 e0 10             	shl    $0x10,%eax
+  804640:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804645:	29 c2                	sub    %eax,%edx
+  804647:	eb 27                	jmp    804670 <ipc_recv+0x7b>
+  804649:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  80464b:	83 ec 08             	sub    $0x8,%esp
+  80464e:	50                   	push   %eax
+  80464f:	68 e5 52 80 00       	push   $0x8052e5
+  804654:	e8 6f be ff ff       	call   8004c8 <cprintf>
+		*from_env_store = 0;
+  804659:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  80465f:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  804665:	83 c4 10             	add    $0x10,%esp
+  804668:	eb 77                	jmp    8046e1 <ipc_recv+0xec>
+		return pthread_main_tls;
+  80466a:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  804670:	8b 02                	mov    (%edx),%eax
+  804672:	8b 40 78             	mov    0x78(%eax),%eax
+  804675:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804677:	85 f6                	test   %esi,%esi
+  804679:	74 34                	je     8046af <ipc_recv+0xba>
+  80467b:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80467d:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804683:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804688:	77 18                	ja     8046a2 <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80468a:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80468f:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804691:	c1 e8 10             	shr    $0x10,%eax
+  804694:	74 0c                	je     8046a2 <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804696:	c1 e0 10             	shl    $0x10,%eax
+  804699:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80469e:	29 c2                	sub    %eax,%edx
+  8046a0:	eb 06                	jmp    8046a8 <ipc_recv+0xb3>
+		return pthread_main_tls;
+  8046a2:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  8046a8:	8b 02                	mov    (%edx),%eax
+  8046aa:	8b 40 7c             	mov    0x7c(%eax),%eax
+  8046ad:	89 06                	mov    %eax,(%esi)
+  8046af:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8046b1:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8046b7:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8046bc:	77 18                	ja     8046d6 <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8046be:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8046c3:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8046c5:	c1 e8 10             	shr    $0x10,%eax
+  8046c8:	74 0c                	je     8046d6 <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8046ca:	c1 e0 10             	shl    $0x10,%eax
+  8046cd:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8046d2:	29 c2                	sub    %eax,%edx
+  8046d4:	eb 06                	jmp    8046dc <ipc_recv+0xe7>
+		return pthread_main_tls;
+  8046d6:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+	}
+	return thisenv->env_ipc_value;
+  8046dc:	8b 02                	mov    (%edx),%eax
+  8046de:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  8046e1:	89 d8                	mov    %ebx,%eax
+  8046e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8046e6:	5b                   	pop    %ebx
+  8046e7:	5e                   	pop    %esi
+  8046e8:	5f                   	pop    %edi
+  8046e9:	5d                   	pop    %ebp
+  8046ea:	c3                   	ret
+
+008046eb <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8046eb:	55                   	push   %ebp
+  8046ec:	89 e5                	mov    %esp,%ebp
+  8046ee:	57                   	push   %edi
+  8046ef:	56                   	push   %esi
+  8046f0:	53                   	push   %ebx
+  8046f1:	83 ec 0c             	sub    $0xc,%esp
+  8046f4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8046f7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8046fa:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  8046fd:	85 db                	test   %ebx,%ebx
+  8046ff:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  804704:	0f 44 d8             	cmove  %eax,%ebx
+  804707:	eb 05                	jmp    80470e <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  804709:	e8 b0 c7 ff ff       	call   800ebe <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  80470e:	57                   	push   %edi
+  80470f:	53                   	push   %ebx
+  804710:	ff 75 0c             	push   0xc(%ebp)
+  804713:	56                   	push   %esi
+  804714:	e8 9a c9 ff ff       	call   8010b3 <sys_ipc_try_send>
+		if (r == 0) {
+  804719:	83 c4 10             	add    $0x10,%esp
+  80471c:	85 c0                	test   %eax,%eax
+  80471e:	74 19                	je     804739 <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  804720:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  804723:	74 e4                	je     804709 <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  804725:	83 ec 0c             	sub    $0xc,%esp
+  804728:	50                   	push   %eax
+  804729:	57                   	push   %edi
+  80472a:	53                   	push   %ebx
+  80472b:	56                   	push   %esi
+  80472c:	68 00 53 80 00       	push   $0x805300
+  804731:	e8 92 bd ff ff       	call   8004c8 <cprintf>
+			return;
+  804736:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  804739:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80473c:	5b                   	pop    %ebx
+  80473d:	5e                   	pop    %esi
+  80473e:	5f                   	pop    %edi
+  80473f:	5d                   	pop    %ebp
+  804740:	c3                   	ret
+
+00804741 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804741:	55                   	push   %ebp
+  804742:	89 e5                	mov    %esp,%ebp
+  804744:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  804747:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  80474c:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80474f:	c1 e0 04             	shl    $0x4,%eax
+  804752:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804757:	8b 40 50             	mov    0x50(%eax),%eax
+  80475a:	39 c8                	cmp    %ecx,%eax
+  80475c:	74 12                	je     804770 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80475e:	83 c2 01             	add    $0x1,%edx
+  804761:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  804767:	75 e3                	jne    80474c <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  804769:	b8 00 00 00 00       	mov    $0x0,%eax
+  80476e:	eb 0e                	jmp    80477e <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  804770:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804773:	c1 e0 04             	shl    $0x4,%eax
+  804776:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80477b:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80477e:	5d                   	pop    %ebp
+  80477f:	c3                   	ret
+
+00804780 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804780:	55                   	push   %ebp
+  804781:	89 e5                	mov    %esp,%ebp
+  804783:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804786:	89 c2                	mov    %eax,%edx
+  804788:	c1 ea 16             	shr    $0x16,%edx
+  80478b:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  804792:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804797:	f6 c1 01             	test   $0x1,%cl
+  80479a:	74 1c                	je     8047b8 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  80479c:	c1 e8 0c             	shr    $0xc,%eax
+  80479f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8047a6:	a8 01                	test   $0x1,%al
+  8047a8:	74 0e                	je     8047b8 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8047aa:	c1 e8 0c             	shr    $0xc,%eax
+  8047ad:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  8047b4:	ef 
+  8047b5:	0f b7 d2             	movzwl %dx,%edx
+}
+  8047b8:	89 d0                	mov    %edx,%eax
+  8047ba:	5d                   	pop    %ebp
+  8047bb:	c3                   	ret
+
+008047bc <udm>:
+  8047bc:	57                   	push   %edi
+  8047bd:	56                   	push   %esi
+  8047be:	53                   	push   %ebx
+  8047bf:	83 ec 20             	sub    $0x20,%esp
+  8047c2:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8047c6:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8047ca:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8047ce:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8047d2:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8047d6:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8047da:	89 d1                	mov    %edx,%ecx
+  8047dc:	09 c1                	or     %eax,%ecx
+  8047de:	0f 84 91 00 00 00    	je     804875 <udm+0xb9>
+  8047e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8047ee:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8047f3:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8047fa:	00 
+  8047fb:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  804802:	00 
+  804803:	eb 08                	jmp    80480d <udm+0x51>
+  804805:	83 e9 01             	sub    $0x1,%ecx
+  804808:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80480b:	74 7c                	je     804889 <udm+0xcd>
+  80480d:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804811:	01 c0                	add    %eax,%eax
+  804813:	89 c6                	mov    %eax,%esi
+  804815:	89 d7                	mov    %edx,%edi
+  804817:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80481b:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80481f:	0f ad d0             	shrd   %cl,%edx,%eax
+  804822:	d3 ea                	shr    %cl,%edx
+  804824:	f6 c1 20             	test   $0x20,%cl
+  804827:	74 04                	je     80482d <udm+0x71>
+  804829:	89 d0                	mov    %edx,%eax
+  80482b:	31 d2                	xor    %edx,%edx
+  80482d:	83 e0 01             	and    $0x1,%eax
+  804830:	89 04 24             	mov    %eax,(%esp)
+  804833:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80483a:	00 
+  80483b:	8b 04 24             	mov    (%esp),%eax
+  80483e:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804842:	09 f0                	or     %esi,%eax
+  804844:	09 fa                	or     %edi,%edx
+  804846:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80484a:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  80484e:	39 f0                	cmp    %esi,%eax
+  804850:	89 d3                	mov    %edx,%ebx
+  804852:	19 fb                	sbb    %edi,%ebx
+  804854:	72 af                	jb     804805 <udm+0x49>
+  804856:	29 f0                	sub    %esi,%eax
+  804858:	19 fa                	sbb    %edi,%edx
+  80485a:	89 cf                	mov    %ecx,%edi
+  80485c:	c1 ef 05             	shr    $0x5,%edi
+  80485f:	83 e7 01             	and    $0x1,%edi
+  804862:	89 fe                	mov    %edi,%esi
+  804864:	83 f6 01             	xor    $0x1,%esi
+  804867:	d3 e6                	shl    %cl,%esi
+  804869:	d3 e7                	shl    %cl,%edi
+  80486b:	09 74 24 18          	or     %esi,0x18(%esp)
+  80486f:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804873:	eb 90                	jmp    804805 <udm+0x49>
+  804875:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804879:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  80487d:	89 f0                	mov    %esi,%eax
+  80487f:	89 fa                	mov    %edi,%edx
+  804881:	89 74 24 18          	mov    %esi,0x18(%esp)
+  804885:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  804889:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  80488d:	89 01                	mov    %eax,(%ecx)
+  80488f:	89 51 04             	mov    %edx,0x4(%ecx)
+  804892:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804896:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80489a:	83 c4 20             	add    $0x20,%esp
+  80489d:	5b                   	pop    %ebx
+  80489e:	5e                   	pop    %esi
+  80489f:	5f                   	pop    %edi
+  8048a0:	c3                   	ret
+
+008048a1 <__udivdi3>:
+  8048a1:	83 ec 18             	sub    $0x18,%esp
+  8048a4:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8048a8:	50                   	push   %eax
+  8048a9:	ff 74 24 2c          	push   0x2c(%esp)
+  8048ad:	ff 74 24 2c          	push   0x2c(%esp)
+  8048b1:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8048b5:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8048b9:	e8 fe fe ff ff       	call   8047bc <udm>
+  8048be:	83 c4 24             	add    $0x24,%esp
+  8048c1:	c3                   	ret
+
+008048c2 <__umoddi3>:
+  8048c2:	83 ec 18             	sub    $0x18,%esp
+  8048c5:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8048c9:	50                   	push   %eax
+  8048ca:	ff 74 24 2c          	push   0x2c(%esp)
+  8048ce:	ff 74 24 2c          	push   0x2c(%esp)
+  8048d2:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8048d6:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8048da:	e8 dd fe ff ff       	call   8047bc <udm>
+  8048df:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8048e3:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8048e7:	83 c4 24             	add    $0x24,%esp
+  8048ea:	c3                   	ret
+
+008048eb <__divdi3>:
+  8048eb:	56                   	push   %esi
+  8048ec:	53                   	push   %ebx
+  8048ed:	83 ec 14             	sub    $0x14,%esp
+  8048f0:	8b 44 24 20          	mov    0x20(%esp),%eax
+  8048f4:	8b 54 24 24          	mov    0x24(%esp),%edx
+  8048f8:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  8048fc:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  804900:	85 d2                	test   %edx,%edx
+  804902:	78 18                	js     80491c <__divdi3+0x31>
+  804904:	85 db                	test   %ebx,%ebx
+  804906:	78 3e                	js     804946 <__divdi3+0x5b>
+  804908:	83 ec 04             	sub    $0x4,%esp
+  80490b:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80490f:	56                   	push   %esi
+  804910:	53                   	push   %ebx
+  804911:	51                   	push   %ecx
+  804912:	e8 a5 fe ff ff       	call   8047bc <udm>
+  804917:	83 c4 10             	add    $0x10,%esp
+  80491a:	eb 24                	jmp    804940 <__divdi3+0x55>
+  80491c:	f7 d8                	neg    %eax
+  80491e:	83 d2 00             	adc    $0x0,%edx
+  804921:	f7 da                	neg    %edx
+  804923:	85 db                	test   %ebx,%ebx
+  804925:	78 3a                	js     804961 <__divdi3+0x76>
+  804927:	83 ec 04             	sub    $0x4,%esp
+  80492a:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80492e:	56                   	push   %esi
+  80492f:	53                   	push   %ebx
+  804930:	51                   	push   %ecx
+  804931:	e8 86 fe ff ff       	call   8047bc <udm>
+  804936:	83 c4 10             	add    $0x10,%esp
+  804939:	f7 d8                	neg    %eax
+  80493b:	83 d2 00             	adc    $0x0,%edx
+  80493e:	f7 da                	neg    %edx
+  804940:	83 c4 14             	add    $0x14,%esp
+  804943:	5b                   	pop    %ebx
+  804944:	5e                   	pop    %esi
+  804945:	c3                   	ret
+  804946:	83 ec 04             	sub    $0x4,%esp
+  804949:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80494d:	56                   	push   %esi
+  80494e:	f7 d9                	neg    %ecx
+  804950:	83 d3 00             	adc    $0x0,%ebx
+  804953:	f7 db                	neg    %ebx
+  804955:	53                   	push   %ebx
+  804956:	51                   	push   %ecx
+  804957:	e8 60 fe ff ff       	call   8047bc <udm>
+  80495c:	83 c4 10             	add    $0x10,%esp
+  80495f:	eb d8                	jmp    804939 <__divdi3+0x4e>
+  804961:	83 ec 04             	sub    $0x4,%esp
+  804964:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804968:	56                   	push   %esi
+  804969:	f7 d9                	neg    %ecx
+  80496b:	83 d3 00             	adc    $0x0,%ebx
+  80496e:	f7 db                	neg    %ebx
+  804970:	53                   	push   %ebx
+  804971:	51                   	push   %ecx
+  804972:	e8 45 fe ff ff       	call   8047bc <udm>
+  804977:	83 c4 10             	add    $0x10,%esp
+  80497a:	eb c4                	jmp    804940 <__divdi3+0x55>
+
+0080497c <__moddi3>:
+  80497c:	55                   	push   %ebp
+  80497d:	57                   	push   %edi
+  80497e:	56                   	push   %esi
+  80497f:	53                   	push   %ebx
+  804980:	83 ec 24             	sub    $0x24,%esp
+  804983:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804987:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80498b:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  80498f:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  804993:	85 d2                	test   %edx,%edx
+  804995:	78 3b                	js     8049d2 <__moddi3+0x56>
+  804997:	83 ec 04             	sub    $0x4,%esp
+  80499a:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80499e:	56                   	push   %esi
+  80499f:	89 ce                	mov    %ecx,%esi
+  8049a1:	f7 de                	neg    %esi
+  8049a3:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8049a7:	89 de                	mov    %ebx,%esi
+  8049a9:	83 d6 00             	adc    $0x0,%esi
+  8049ac:	f7 de                	neg    %esi
+  8049ae:	89 74 24 14          	mov    %esi,0x14(%esp)
+  8049b2:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8049b6:	0f 48 f1             	cmovs  %ecx,%esi
+  8049b9:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  8049be:	53                   	push   %ebx
+  8049bf:	56                   	push   %esi
+  8049c0:	e8 f7 fd ff ff       	call   8047bc <udm>
+  8049c5:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8049c9:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8049cd:	83 c4 10             	add    $0x10,%esp
+  8049d0:	eb 47                	jmp    804a19 <__moddi3+0x9d>
+  8049d2:	f7 d8                	neg    %eax
+  8049d4:	83 d2 00             	adc    $0x0,%edx
+  8049d7:	f7 da                	neg    %edx
+  8049d9:	83 ec 04             	sub    $0x4,%esp
+  8049dc:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8049e0:	56                   	push   %esi
+  8049e1:	89 cf                	mov    %ecx,%edi
+  8049e3:	f7 df                	neg    %edi
+  8049e5:	89 de                	mov    %ebx,%esi
+  8049e7:	83 d6 00             	adc    $0x0,%esi
+  8049ea:	f7 de                	neg    %esi
+  8049ec:	0f 49 cf             	cmovns %edi,%ecx
+  8049ef:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8049f3:	0f 49 de             	cmovns %esi,%ebx
+  8049f6:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  8049fa:	ff 74 24 0c          	push   0xc(%esp)
+  8049fe:	ff 74 24 0c          	push   0xc(%esp)
+  804a02:	e8 b5 fd ff ff       	call   8047bc <udm>
+  804a07:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804a0b:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804a0f:	f7 d8                	neg    %eax
+  804a11:	83 d2 00             	adc    $0x0,%edx
+  804a14:	f7 da                	neg    %edx
+  804a16:	83 c4 10             	add    $0x10,%esp
+  804a19:	83 c4 24             	add    $0x24,%esp
+  804a1c:	5b                   	pop    %ebx
+  804a1d:	5e                   	pop    %esi
+  804a1e:	5f                   	pop    %edi
+  804a1f:	5d                   	pop    %ebp
+  804a20:	c3                   	ret
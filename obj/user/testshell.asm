@@ -0,0 +1,10606 @@
+
+obj/user/testshell.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 54 04 00 00       	call   800485 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <wrong>:
+	breakpoint();
+}
+
+void
+wrong(int rfd, int kfd, int off)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	81 ec 84 00 00 00    	sub    $0x84,%esp
+  80003f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800042:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800045:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char buf[100];
+	int n;
+
+	seek(rfd, off);
+  800048:	53                   	push   %ebx
+  800049:	56                   	push   %esi
+  80004a:	e8 9f 1f 00 00       	call   801fee <seek>
+	seek(kfd, off);
+  80004f:	83 c4 08             	add    $0x8,%esp
+  800052:	53                   	push   %ebx
+  800053:	57                   	push   %edi
+  800054:	e8 95 1f 00 00       	call   801fee <seek>
+
+	cprintf("shell produced incorrect output.\n");
+  800059:	c7 04 24 20 50 80 00 	movl   $0x805020,(%esp)
+  800060:	e8 9e 05 00 00       	call   800603 <cprintf>
+	cprintf("expected:\n===\n");
+  800065:	c7 04 24 8b 50 80 00 	movl   $0x80508b,(%esp)
+  80006c:	e8 92 05 00 00       	call   800603 <cprintf>
+	while ((n = read(kfd, buf, sizeof buf-1)) > 0)
+  800071:	83 c4 10             	add    $0x10,%esp
+  800074:	8d 5d 84             	lea    -0x7c(%ebp),%ebx
+  800077:	eb 0d                	jmp    800086 <wrong+0x53>
+		sys_cputs(buf, n);
+  800079:	83 ec 08             	sub    $0x8,%esp
+  80007c:	50                   	push   %eax
+  80007d:	53                   	push   %ebx
+  80007e:	e8 a8 0e 00 00       	call   800f2b <sys_cputs>
+  800083:	83 c4 10             	add    $0x10,%esp
+	while ((n = read(kfd, buf, sizeof buf-1)) > 0)
+  800086:	83 ec 04             	sub    $0x4,%esp
+  800089:	6a 63                	push   $0x63
+  80008b:	53                   	push   %ebx
+  80008c:	57                   	push   %edi
+  80008d:	e8 b8 1d 00 00       	call   801e4a <read>
+  800092:	83 c4 10             	add    $0x10,%esp
+  800095:	85 c0                	test   %eax,%eax
+  800097:	7f e0                	jg     800079 <wrong+0x46>
+	cprintf("===\ngot:\n===\n");
+  800099:	83 ec 0c             	sub    $0xc,%esp
+  80009c:	68 9a 50 80 00       	push   $0x80509a
+  8000a1:	e8 5d 05 00 00       	call   800603 <cprintf>
+	while ((n = read(rfd, buf, sizeof buf-1)) > 0)
+  8000a6:	83 c4 10             	add    $0x10,%esp
+  8000a9:	8d 5d 84             	lea    -0x7c(%ebp),%ebx
+  8000ac:	eb 0d                	jmp    8000bb <wrong+0x88>
+		sys_cputs(buf, n);
+  8000ae:	83 ec 08             	sub    $0x8,%esp
+  8000b1:	50                   	push   %eax
+  8000b2:	53                   	push   %ebx
+  8000b3:	e8 73 0e 00 00       	call   800f2b <sys_cputs>
+  8000b8:	83 c4 10             	add    $0x10,%esp
+	while ((n = read(rfd, buf, sizeof buf-1)) > 0)
+  8000bb:	83 ec 04             	sub    $0x4,%esp
+  8000be:	6a 63                	push   $0x63
+  8000c0:	53                   	push   %ebx
+  8000c1:	56                   	push   %esi
+  8000c2:	e8 83 1d 00 00       	call   801e4a <read>
+  8000c7:	83 c4 10             	add    $0x10,%esp
+  8000ca:	85 c0                	test   %eax,%eax
+  8000cc:	7f e0                	jg     8000ae <wrong+0x7b>
+	cprintf("===\n");
+  8000ce:	83 ec 0c             	sub    $0xc,%esp
+  8000d1:	68 95 50 80 00       	push   $0x805095
+  8000d6:	e8 28 05 00 00       	call   800603 <cprintf>
+	exit();
+  8000db:	e8 20 04 00 00       	call   800500 <exit>
+}
+  8000e0:	83 c4 10             	add    $0x10,%esp
+  8000e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000e6:	5b                   	pop    %ebx
+  8000e7:	5e                   	pop    %esi
+  8000e8:	5f                   	pop    %edi
+  8000e9:	5d                   	pop    %ebp
+  8000ea:	c3                   	ret
+
+008000eb <umain>:
+{
+  8000eb:	55                   	push   %ebp
+  8000ec:	89 e5                	mov    %esp,%ebp
+  8000ee:	57                   	push   %edi
+  8000ef:	56                   	push   %esi
+  8000f0:	53                   	push   %ebx
+  8000f1:	83 ec 38             	sub    $0x38,%esp
+	close(0);
+  8000f4:	6a 00                	push   $0x0
+  8000f6:	e8 13 1c 00 00       	call   801d0e <close>
+	close(1);
+  8000fb:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  800102:	e8 07 1c 00 00       	call   801d0e <close>
+	opencons();
+  800107:	e8 27 03 00 00       	call   800433 <opencons>
+	opencons();
+  80010c:	e8 22 03 00 00       	call   800433 <opencons>
+	if ((rfd = open("testshell.sh", O_RDONLY)) < 0)
+  800111:	83 c4 08             	add    $0x8,%esp
+  800114:	6a 00                	push   $0x0
+  800116:	68 a8 50 80 00       	push   $0x8050a8
+  80011b:	e8 72 23 00 00       	call   802492 <open>
+  800120:	89 c3                	mov    %eax,%ebx
+  800122:	83 c4 10             	add    $0x10,%esp
+  800125:	85 c0                	test   %eax,%eax
+  800127:	0f 88 e7 00 00 00    	js     800214 <umain+0x129>
+	if ((wfd = pipe(pfds)) < 0)
+  80012d:	83 ec 0c             	sub    $0xc,%esp
+  800130:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  800133:	50                   	push   %eax
+  800134:	e8 54 40 00 00       	call   80418d <pipe>
+  800139:	83 c4 10             	add    $0x10,%esp
+  80013c:	85 c0                	test   %eax,%eax
+  80013e:	0f 88 e2 00 00 00    	js     800226 <umain+0x13b>
+	wfd = pfds[1];
+  800144:	8b 75 e0             	mov    -0x20(%ebp),%esi
+	cprintf("running sh -x < testshell.sh | cat\n");
+  800147:	83 ec 0c             	sub    $0xc,%esp
+  80014a:	68 44 50 80 00       	push   $0x805044
+  80014f:	e8 af 04 00 00       	call   800603 <cprintf>
+	if ((r = fork()) < 0)
+  800154:	e8 88 15 00 00       	call   8016e1 <fork>
+  800159:	83 c4 10             	add    $0x10,%esp
+  80015c:	85 c0                	test   %eax,%eax
+  80015e:	0f 88 d4 00 00 00    	js     800238 <umain+0x14d>
+	if (r == 0) {
+  800164:	75 6f                	jne    8001d5 <umain+0xea>
+		dup(rfd, 0);
+  800166:	83 ec 08             	sub    $0x8,%esp
+  800169:	6a 00                	push   $0x0
+  80016b:	53                   	push   %ebx
+  80016c:	e8 ef 1b 00 00       	call   801d60 <dup>
+		dup(wfd, 1);
+  800171:	83 c4 08             	add    $0x8,%esp
+  800174:	6a 01                	push   $0x1
+  800176:	56                   	push   %esi
+  800177:	e8 e4 1b 00 00       	call   801d60 <dup>
+		close(rfd);
+  80017c:	89 1c 24             	mov    %ebx,(%esp)
+  80017f:	e8 8a 1b 00 00       	call   801d0e <close>
+		close(wfd);
+  800184:	89 34 24             	mov    %esi,(%esp)
+  800187:	e8 82 1b 00 00       	call   801d0e <close>
+		if ((r = spawnl("/sh", "sh", "-x", 0)) < 0)
+  80018c:	6a 00                	push   $0x0
+  80018e:	68 ee 50 80 00       	push   $0x8050ee
+  800193:	68 b2 50 80 00       	push   $0x8050b2
+  800198:	68 f1 50 80 00       	push   $0x8050f1
+  80019d:	e8 36 35 00 00       	call   8036d8 <spawnl>
+  8001a2:	89 c7                	mov    %eax,%edi
+  8001a4:	83 c4 20             	add    $0x20,%esp
+  8001a7:	85 c0                	test   %eax,%eax
+  8001a9:	0f 88 9b 00 00 00    	js     80024a <umain+0x15f>
+		close(0);
+  8001af:	83 ec 0c             	sub    $0xc,%esp
+  8001b2:	6a 00                	push   $0x0
+  8001b4:	e8 55 1b 00 00       	call   801d0e <close>
+		close(1);
+  8001b9:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  8001c0:	e8 49 1b 00 00       	call   801d0e <close>
+		wait(r);
+  8001c5:	89 3c 24             	mov    %edi,(%esp)
+  8001c8:	e8 3d 41 00 00       	call   80430a <wait>
+		exit();
+  8001cd:	e8 2e 03 00 00       	call   800500 <exit>
+  8001d2:	83 c4 10             	add    $0x10,%esp
+	close(rfd);
+  8001d5:	83 ec 0c             	sub    $0xc,%esp
+  8001d8:	53                   	push   %ebx
+  8001d9:	e8 30 1b 00 00       	call   801d0e <close>
+	close(wfd);
+  8001de:	89 34 24             	mov    %esi,(%esp)
+  8001e1:	e8 28 1b 00 00       	call   801d0e <close>
+	rfd = pfds[0];
+  8001e6:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8001e9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+	if ((kfd = open("testshell.key", O_RDONLY)) < 0)
+  8001ec:	83 c4 08             	add    $0x8,%esp
+  8001ef:	6a 00                	push   $0x0
+  8001f1:	68 ff 50 80 00       	push   $0x8050ff
+  8001f6:	e8 97 22 00 00       	call   802492 <open>
+  8001fb:	83 c4 10             	add    $0x10,%esp
+  8001fe:	85 c0                	test   %eax,%eax
+  800200:	78 5a                	js     80025c <umain+0x171>
+  800202:	be 01 00 00 00       	mov    $0x1,%esi
+	nloff = 0;
+  800207:	bf 00 00 00 00       	mov    $0x0,%edi
+		n2 = read(kfd, &c2, 1);
+  80020c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80020f:	e9 9a 00 00 00       	jmp    8002ae <umain+0x1c3>
+		panic("open testshell.sh: %e", rfd);
+  800214:	50                   	push   %eax
+  800215:	68 b5 50 80 00       	push   $0x8050b5
+  80021a:	6a 13                	push   $0x13
+  80021c:	68 cb 50 80 00       	push   $0x8050cb
+  800221:	e8 02 03 00 00       	call   800528 <_panic>
+		panic("pipe: %e", wfd);
+  800226:	50                   	push   %eax
+  800227:	68 dc 50 80 00       	push   $0x8050dc
+  80022c:	6a 15                	push   $0x15
+  80022e:	68 cb 50 80 00       	push   $0x8050cb
+  800233:	e8 f0 02 00 00       	call   800528 <_panic>
+		panic("fork: %e", r);
+  800238:	50                   	push   %eax
+  800239:	68 e5 50 80 00       	push   $0x8050e5
+  80023e:	6a 1a                	push   $0x1a
+  800240:	68 cb 50 80 00       	push   $0x8050cb
+  800245:	e8 de 02 00 00       	call   800528 <_panic>
+			panic("spawn: %e", r);
+  80024a:	50                   	push   %eax
+  80024b:	68 f5 50 80 00       	push   $0x8050f5
+  800250:	6a 21                	push   $0x21
+  800252:	68 cb 50 80 00       	push   $0x8050cb
+  800257:	e8 cc 02 00 00       	call   800528 <_panic>
+		panic("open testshell.key for reading: %e", kfd);
+  80025c:	50                   	push   %eax
+  80025d:	68 68 50 80 00       	push   $0x805068
+  800262:	6a 2c                	push   $0x2c
+  800264:	68 cb 50 80 00       	push   $0x8050cb
+  800269:	e8 ba 02 00 00       	call   800528 <_panic>
+			panic("reading testshell.out: %e", n1);
+  80026e:	53                   	push   %ebx
+  80026f:	68 0d 51 80 00       	push   $0x80510d
+  800274:	6a 33                	push   $0x33
+  800276:	68 cb 50 80 00       	push   $0x8050cb
+  80027b:	e8 a8 02 00 00       	call   800528 <_panic>
+			panic("reading testshell.key: %e", n2);
+  800280:	50                   	push   %eax
+  800281:	68 27 51 80 00       	push   $0x805127
+  800286:	6a 35                	push   $0x35
+  800288:	68 cb 50 80 00       	push   $0x8050cb
+  80028d:	e8 96 02 00 00       	call   800528 <_panic>
+			wrong(rfd, kfd, nloff);
+  800292:	83 ec 04             	sub    $0x4,%esp
+  800295:	57                   	push   %edi
+  800296:	ff 75 d0             	push   -0x30(%ebp)
+  800299:	ff 75 d4             	push   -0x2c(%ebp)
+  80029c:	e8 92 fd ff ff       	call   800033 <wrong>
+  8002a1:	83 c4 10             	add    $0x10,%esp
+			nloff = off+1;
+  8002a4:	80 7d e7 0a          	cmpb   $0xa,-0x19(%ebp)
+  8002a8:	0f 44 fe             	cmove  %esi,%edi
+	for (off=0;; off++) {
+  8002ab:	83 c6 01             	add    $0x1,%esi
+		n1 = read(rfd, &c1, 1);
+  8002ae:	83 ec 04             	sub    $0x4,%esp
+  8002b1:	6a 01                	push   $0x1
+  8002b3:	8d 45 e7             	lea    -0x19(%ebp),%eax
+  8002b6:	50                   	push   %eax
+  8002b7:	ff 75 d4             	push   -0x2c(%ebp)
+  8002ba:	e8 8b 1b 00 00       	call   801e4a <read>
+  8002bf:	89 c3                	mov    %eax,%ebx
+		n2 = read(kfd, &c2, 1);
+  8002c1:	83 c4 0c             	add    $0xc,%esp
+  8002c4:	6a 01                	push   $0x1
+  8002c6:	8d 45 e6             	lea    -0x1a(%ebp),%eax
+  8002c9:	50                   	push   %eax
+  8002ca:	ff 75 d0             	push   -0x30(%ebp)
+  8002cd:	e8 78 1b 00 00       	call   801e4a <read>
+		if (n1 < 0)
+  8002d2:	83 c4 10             	add    $0x10,%esp
+  8002d5:	85 db                	test   %ebx,%ebx
+  8002d7:	78 95                	js     80026e <umain+0x183>
+		if (n2 < 0)
+  8002d9:	85 c0                	test   %eax,%eax
+  8002db:	78 a3                	js     800280 <umain+0x195>
+		if (n1 == 0 && n2 == 0)
+  8002dd:	89 d9                	mov    %ebx,%ecx
+  8002df:	09 c1                	or     %eax,%ecx
+  8002e1:	74 15                	je     8002f8 <umain+0x20d>
+		if (n1 != 1 || n2 != 1 || c1 != c2)
+  8002e3:	83 fb 01             	cmp    $0x1,%ebx
+  8002e6:	75 aa                	jne    800292 <umain+0x1a7>
+  8002e8:	83 f8 01             	cmp    $0x1,%eax
+  8002eb:	75 a5                	jne    800292 <umain+0x1a7>
+  8002ed:	0f b6 45 e6          	movzbl -0x1a(%ebp),%eax
+  8002f1:	38 45 e7             	cmp    %al,-0x19(%ebp)
+  8002f4:	75 9c                	jne    800292 <umain+0x1a7>
+  8002f6:	eb ac                	jmp    8002a4 <umain+0x1b9>
+	cprintf("shell ran correctly\n");
+  8002f8:	83 ec 0c             	sub    $0xc,%esp
+  8002fb:	68 41 51 80 00       	push   $0x805141
+  800300:	e8 fe 02 00 00       	call   800603 <cprintf>
+#include <inc/types.h>
+
+static inline void
+breakpoint(void)
+{
+	asm volatile("int3");
+  800305:	cc                   	int3
+}
+  800306:	83 c4 10             	add    $0x10,%esp
+  800309:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80030c:	5b                   	pop    %ebx
+  80030d:	5e                   	pop    %esi
+  80030e:	5f                   	pop    %edi
+  80030f:	5d                   	pop    %ebp
+  800310:	c3                   	ret
+
+00800311 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  800311:	b8 00 00 00 00       	mov    $0x0,%eax
+  800316:	c3                   	ret
+
+00800317 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  800317:	55                   	push   %ebp
+  800318:	89 e5                	mov    %esp,%ebp
+  80031a:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80031d:	68 56 51 80 00       	push   $0x805156
+  800322:	ff 75 0c             	push   0xc(%ebp)
+  800325:	e8 bd 08 00 00       	call   800be7 <strcpy>
+	return 0;
+}
+  80032a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80032f:	c9                   	leave
+  800330:	c3                   	ret
+
+00800331 <devcons_write>:
+{
+  800331:	55                   	push   %ebp
+  800332:	89 e5                	mov    %esp,%ebp
+  800334:	57                   	push   %edi
+  800335:	56                   	push   %esi
+  800336:	53                   	push   %ebx
+  800337:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80033d:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  800342:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  800348:	eb 2e                	jmp    800378 <devcons_write+0x47>
+		m = n - tot;
+  80034a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80034d:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80034f:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  800354:	39 c3                	cmp    %eax,%ebx
+  800356:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  800359:	83 ec 04             	sub    $0x4,%esp
+  80035c:	53                   	push   %ebx
+  80035d:	89 f0                	mov    %esi,%eax
+  80035f:	03 45 0c             	add    0xc(%ebp),%eax
+  800362:	50                   	push   %eax
+  800363:	57                   	push   %edi
+  800364:	e8 04 0a 00 00       	call   800d6d <memmove>
+		sys_cputs(buf, m);
+  800369:	83 c4 08             	add    $0x8,%esp
+  80036c:	53                   	push   %ebx
+  80036d:	57                   	push   %edi
+  80036e:	e8 b8 0b 00 00       	call   800f2b <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  800373:	01 de                	add    %ebx,%esi
+  800375:	83 c4 10             	add    $0x10,%esp
+  800378:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80037b:	72 cd                	jb     80034a <devcons_write+0x19>
+}
+  80037d:	89 f0                	mov    %esi,%eax
+  80037f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800382:	5b                   	pop    %ebx
+  800383:	5e                   	pop    %esi
+  800384:	5f                   	pop    %edi
+  800385:	5d                   	pop    %ebp
+  800386:	c3                   	ret
+
+00800387 <devcons_read>:
+{
+  800387:	55                   	push   %ebp
+  800388:	89 e5                	mov    %esp,%ebp
+  80038a:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80038d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800392:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  800396:	75 07                	jne    80039f <devcons_read+0x18>
+  800398:	eb 1f                	jmp    8003b9 <devcons_read+0x32>
+		sys_yield();
+  80039a:	e8 5a 0c 00 00       	call   800ff9 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80039f:	e8 b2 0b 00 00       	call   800f56 <sys_cgetc>
+  8003a4:	85 c0                	test   %eax,%eax
+  8003a6:	74 f2                	je     80039a <devcons_read+0x13>
+	if (c < 0)
+  8003a8:	78 0f                	js     8003b9 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8003aa:	83 f8 04             	cmp    $0x4,%eax
+  8003ad:	74 0c                	je     8003bb <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8003af:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8003b2:	88 02                	mov    %al,(%edx)
+	return 1;
+  8003b4:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8003b9:	c9                   	leave
+  8003ba:	c3                   	ret
+		return 0;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003c0:	eb f7                	jmp    8003b9 <devcons_read+0x32>
+
+008003c2 <cputchar>:
+{
+  8003c2:	55                   	push   %ebp
+  8003c3:	89 e5                	mov    %esp,%ebp
+  8003c5:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8003c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003cb:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8003ce:	6a 01                	push   $0x1
+  8003d0:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8003d3:	50                   	push   %eax
+  8003d4:	e8 52 0b 00 00       	call   800f2b <sys_cputs>
+}
+  8003d9:	83 c4 10             	add    $0x10,%esp
+  8003dc:	c9                   	leave
+  8003dd:	c3                   	ret
+
+008003de <getchar>:
+{
+  8003de:	55                   	push   %ebp
+  8003df:	89 e5                	mov    %esp,%ebp
+  8003e1:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8003e4:	6a 01                	push   $0x1
+  8003e6:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8003e9:	50                   	push   %eax
+  8003ea:	6a 00                	push   $0x0
+  8003ec:	e8 59 1a 00 00       	call   801e4a <read>
+	if (r < 0)
+  8003f1:	83 c4 10             	add    $0x10,%esp
+  8003f4:	85 c0                	test   %eax,%eax
+  8003f6:	78 06                	js     8003fe <getchar+0x20>
+	if (r < 1)
+  8003f8:	74 06                	je     800400 <getchar+0x22>
+	return c;
+  8003fa:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8003fe:	c9                   	leave
+  8003ff:	c3                   	ret
+		return -E_EOF;
+  800400:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  800405:	eb f7                	jmp    8003fe <getchar+0x20>
+
+00800407 <iscons>:
+{
+  800407:	55                   	push   %ebp
+  800408:	89 e5                	mov    %esp,%ebp
+  80040a:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80040d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800410:	50                   	push   %eax
+  800411:	ff 75 08             	push   0x8(%ebp)
+  800414:	e8 a1 17 00 00       	call   801bba <fd_lookup>
+  800419:	83 c4 10             	add    $0x10,%esp
+  80041c:	85 c0                	test   %eax,%eax
+  80041e:	78 11                	js     800431 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  800420:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800423:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  800429:	39 10                	cmp    %edx,(%eax)
+  80042b:	0f 94 c0             	sete   %al
+  80042e:	0f b6 c0             	movzbl %al,%eax
+}
+  800431:	c9                   	leave
+  800432:	c3                   	ret
+
+00800433 <opencons>:
+{
+  800433:	55                   	push   %ebp
+  800434:	89 e5                	mov    %esp,%ebp
+  800436:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  800439:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80043c:	50                   	push   %eax
+  80043d:	e8 22 17 00 00       	call   801b64 <fd_alloc>
+  800442:	83 c4 10             	add    $0x10,%esp
+  800445:	85 c0                	test   %eax,%eax
+  800447:	78 3a                	js     800483 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  800449:	83 ec 04             	sub    $0x4,%esp
+  80044c:	68 07 04 00 00       	push   $0x407
+  800451:	ff 75 f4             	push   -0xc(%ebp)
+  800454:	6a 00                	push   $0x0
+  800456:	e8 ca 0b 00 00       	call   801025 <sys_page_alloc>
+  80045b:	83 c4 10             	add    $0x10,%esp
+  80045e:	85 c0                	test   %eax,%eax
+  800460:	78 21                	js     800483 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  800462:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800465:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  80046b:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80046d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800470:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  800477:	83 ec 0c             	sub    $0xc,%esp
+  80047a:	50                   	push   %eax
+  80047b:	e8 bd 16 00 00       	call   801b3d <fd2num>
+  800480:	83 c4 10             	add    $0x10,%esp
+}
+  800483:	c9                   	leave
+  800484:	c3                   	ret
+
+00800485 <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800485:	55                   	push   %ebp
+  800486:	89 e5                	mov    %esp,%ebp
+  800488:	57                   	push   %edi
+  800489:	56                   	push   %esi
+  80048a:	53                   	push   %ebx
+  80048b:	83 ec 1c             	sub    $0x1c,%esp
+  80048e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800491:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  800494:	e8 34 0b 00 00       	call   800fcd <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  800499:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  80049c:	89 15 c0 72 80 00    	mov    %edx,0x8072c0
+	thisenv = &envs[ENVX(eid)];
+  8004a2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8004a7:	89 c1                	mov    %eax,%ecx
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  8004a9:	89 e7                	mov    %esp,%edi
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8004ab:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  8004b1:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8004b6:	77 16                	ja     8004ce <libmain+0x49>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8004b8:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8004bd:	29 f8                	sub    %edi,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  8004bf:	c1 e8 10             	shr    $0x10,%eax
+  8004c2:	74 0a                	je     8004ce <libmain+0x49>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8004c4:	c1 e0 10             	shl    $0x10,%eax
+  8004c7:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8004cc:	29 c2                	sub    %eax,%edx
+  8004ce:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  8004d1:	c1 e0 04             	shl    $0x4,%eax
+  8004d4:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8004d9:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8004db:	85 db                	test   %ebx,%ebx
+  8004dd:	7e 07                	jle    8004e6 <libmain+0x61>
+		binaryname = argv[0];
+  8004df:	8b 06                	mov    (%esi),%eax
+  8004e1:	a3 1c 60 80 00       	mov    %eax,0x80601c
+
+	// call user main routine
+	umain(argc, argv);
+  8004e6:	83 ec 08             	sub    $0x8,%esp
+  8004e9:	56                   	push   %esi
+  8004ea:	53                   	push   %ebx
+  8004eb:	e8 fb fb ff ff       	call   8000eb <umain>
+
+	// exit gracefully
+	exit();
+  8004f0:	e8 0b 00 00 00       	call   800500 <exit>
+}
+  8004f5:	83 c4 10             	add    $0x10,%esp
+  8004f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004fb:	5b                   	pop    %ebx
+  8004fc:	5e                   	pop    %esi
+  8004fd:	5f                   	pop    %edi
+  8004fe:	5d                   	pop    %ebp
+  8004ff:	c3                   	ret
+
+00800500 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800500:	55                   	push   %ebp
+  800501:	89 e5                	mov    %esp,%ebp
+  800503:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  800506:	6a 00                	push   $0x0
+  800508:	e8 8b 27 00 00       	call   802c98 <fflush>
+	pthread_kill_others();
+  80050d:	e8 64 44 00 00       	call   804976 <pthread_kill_others>
+	close_all();
+  800512:	e8 24 18 00 00       	call   801d3b <close_all>
+	sys_env_destroy(0);
+  800517:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80051e:	e8 5f 0a 00 00       	call   800f82 <sys_env_destroy>
+}
+  800523:	83 c4 10             	add    $0x10,%esp
+  800526:	c9                   	leave
+  800527:	c3                   	ret
+
+00800528 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800528:	55                   	push   %ebp
+  800529:	89 e5                	mov    %esp,%ebp
+  80052b:	56                   	push   %esi
+  80052c:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80052d:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800530:	8b 35 1c 60 80 00    	mov    0x80601c,%esi
+  800536:	e8 92 0a 00 00       	call   800fcd <sys_getenvid>
+  80053b:	83 ec 0c             	sub    $0xc,%esp
+  80053e:	ff 75 0c             	push   0xc(%ebp)
+  800541:	ff 75 08             	push   0x8(%ebp)
+  800544:	56                   	push   %esi
+  800545:	50                   	push   %eax
+  800546:	68 6c 51 80 00       	push   $0x80516c
+  80054b:	e8 b3 00 00 00       	call   800603 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800550:	83 c4 18             	add    $0x18,%esp
+  800553:	53                   	push   %ebx
+  800554:	ff 75 10             	push   0x10(%ebp)
+  800557:	e8 56 00 00 00       	call   8005b2 <vcprintf>
+	cprintf("\n");
+  80055c:	c7 04 24 7a 56 80 00 	movl   $0x80567a,(%esp)
+  800563:	e8 9b 00 00 00       	call   800603 <cprintf>
+  800568:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80056b:	cc                   	int3
+	while (1)
+  80056c:	eb fd                	jmp    80056b <_panic+0x43>
+
+0080056e <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80056e:	55                   	push   %ebp
+  80056f:	89 e5                	mov    %esp,%ebp
+  800571:	53                   	push   %ebx
+  800572:	83 ec 04             	sub    $0x4,%esp
+  800575:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800578:	8b 13                	mov    (%ebx),%edx
+  80057a:	8d 42 01             	lea    0x1(%edx),%eax
+  80057d:	89 03                	mov    %eax,(%ebx)
+  80057f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800582:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800586:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80058b:	74 09                	je     800596 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80058d:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800591:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800594:	c9                   	leave
+  800595:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800596:	83 ec 08             	sub    $0x8,%esp
+  800599:	68 ff 00 00 00       	push   $0xff
+  80059e:	8d 43 08             	lea    0x8(%ebx),%eax
+  8005a1:	50                   	push   %eax
+  8005a2:	e8 84 09 00 00       	call   800f2b <sys_cputs>
+		b->idx = 0;
+  8005a7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8005ad:	83 c4 10             	add    $0x10,%esp
+  8005b0:	eb db                	jmp    80058d <putch+0x1f>
+
+008005b2 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8005b2:	55                   	push   %ebp
+  8005b3:	89 e5                	mov    %esp,%ebp
+  8005b5:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8005bb:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8005c2:	00 00 00 
+	b.cnt = 0;
+  8005c5:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8005cc:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8005cf:	ff 75 0c             	push   0xc(%ebp)
+  8005d2:	ff 75 08             	push   0x8(%ebp)
+  8005d5:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8005db:	50                   	push   %eax
+  8005dc:	68 6e 05 80 00       	push   $0x80056e
+  8005e1:	e8 14 01 00 00       	call   8006fa <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8005e6:	83 c4 08             	add    $0x8,%esp
+  8005e9:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8005ef:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8005f5:	50                   	push   %eax
+  8005f6:	e8 30 09 00 00       	call   800f2b <sys_cputs>
+
+	return b.cnt;
+}
+  8005fb:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800601:	c9                   	leave
+  800602:	c3                   	ret
+
+00800603 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800603:	55                   	push   %ebp
+  800604:	89 e5                	mov    %esp,%ebp
+  800606:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800609:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80060c:	50                   	push   %eax
+  80060d:	ff 75 08             	push   0x8(%ebp)
+  800610:	e8 9d ff ff ff       	call   8005b2 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800615:	c9                   	leave
+  800616:	c3                   	ret
+
+00800617 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800617:	55                   	push   %ebp
+  800618:	89 e5                	mov    %esp,%ebp
+  80061a:	57                   	push   %edi
+  80061b:	56                   	push   %esi
+  80061c:	53                   	push   %ebx
+  80061d:	83 ec 1c             	sub    $0x1c,%esp
+  800620:	89 c7                	mov    %eax,%edi
+  800622:	89 d6                	mov    %edx,%esi
+  800624:	8b 45 08             	mov    0x8(%ebp),%eax
+  800627:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80062a:	89 d1                	mov    %edx,%ecx
+  80062c:	89 c2                	mov    %eax,%edx
+  80062e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800631:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800634:	8b 45 10             	mov    0x10(%ebp),%eax
+  800637:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80063a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80063d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800644:	39 c2                	cmp    %eax,%edx
+  800646:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800649:	72 3e                	jb     800689 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80064b:	83 ec 0c             	sub    $0xc,%esp
+  80064e:	ff 75 18             	push   0x18(%ebp)
+  800651:	83 eb 01             	sub    $0x1,%ebx
+  800654:	53                   	push   %ebx
+  800655:	50                   	push   %eax
+  800656:	83 ec 08             	sub    $0x8,%esp
+  800659:	ff 75 e4             	push   -0x1c(%ebp)
+  80065c:	ff 75 e0             	push   -0x20(%ebp)
+  80065f:	ff 75 dc             	push   -0x24(%ebp)
+  800662:	ff 75 d8             	push   -0x28(%ebp)
+  800665:	e8 1b 48 00 00       	call   804e85 <__udivdi3>
+  80066a:	83 c4 18             	add    $0x18,%esp
+  80066d:	52                   	push   %edx
+  80066e:	50                   	push   %eax
+  80066f:	89 f2                	mov    %esi,%edx
+  800671:	89 f8                	mov    %edi,%eax
+  800673:	e8 9f ff ff ff       	call   800617 <printnum>
+  800678:	83 c4 20             	add    $0x20,%esp
+  80067b:	eb 13                	jmp    800690 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80067d:	83 ec 08             	sub    $0x8,%esp
+  800680:	56                   	push   %esi
+  800681:	ff 75 18             	push   0x18(%ebp)
+  800684:	ff d7                	call   *%edi
+  800686:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800689:	83 eb 01             	sub    $0x1,%ebx
+  80068c:	85 db                	test   %ebx,%ebx
+  80068e:	7f ed                	jg     80067d <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800690:	83 ec 08             	sub    $0x8,%esp
+  800693:	56                   	push   %esi
+  800694:	83 ec 04             	sub    $0x4,%esp
+  800697:	ff 75 e4             	push   -0x1c(%ebp)
+  80069a:	ff 75 e0             	push   -0x20(%ebp)
+  80069d:	ff 75 dc             	push   -0x24(%ebp)
+  8006a0:	ff 75 d8             	push   -0x28(%ebp)
+  8006a3:	e8 fe 47 00 00       	call   804ea6 <__umoddi3>
+  8006a8:	83 c4 14             	add    $0x14,%esp
+  8006ab:	0f be 80 8f 51 80 00 	movsbl 0x80518f(%eax),%eax
+  8006b2:	50                   	push   %eax
+  8006b3:	ff d7                	call   *%edi
+}
+  8006b5:	83 c4 10             	add    $0x10,%esp
+  8006b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006bb:	5b                   	pop    %ebx
+  8006bc:	5e                   	pop    %esi
+  8006bd:	5f                   	pop    %edi
+  8006be:	5d                   	pop    %ebp
+  8006bf:	c3                   	ret
+
+008006c0 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8006c0:	55                   	push   %ebp
+  8006c1:	89 e5                	mov    %esp,%ebp
+  8006c3:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8006c6:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8006ca:	8b 10                	mov    (%eax),%edx
+  8006cc:	3b 50 04             	cmp    0x4(%eax),%edx
+  8006cf:	73 0a                	jae    8006db <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8006d1:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8006d4:	89 08                	mov    %ecx,(%eax)
+  8006d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006d9:	88 02                	mov    %al,(%edx)
+}
+  8006db:	5d                   	pop    %ebp
+  8006dc:	c3                   	ret
+
+008006dd <printfmt>:
+{
+  8006dd:	55                   	push   %ebp
+  8006de:	89 e5                	mov    %esp,%ebp
+  8006e0:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8006e3:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8006e6:	50                   	push   %eax
+  8006e7:	ff 75 10             	push   0x10(%ebp)
+  8006ea:	ff 75 0c             	push   0xc(%ebp)
+  8006ed:	ff 75 08             	push   0x8(%ebp)
+  8006f0:	e8 05 00 00 00       	call   8006fa <vprintfmt>
+}
+  8006f5:	83 c4 10             	add    $0x10,%esp
+  8006f8:	c9                   	leave
+  8006f9:	c3                   	ret
+
+008006fa <vprintfmt>:
+{
+  8006fa:	55                   	push   %ebp
+  8006fb:	89 e5                	mov    %esp,%ebp
+  8006fd:	57                   	push   %edi
+  8006fe:	56                   	push   %esi
+  8006ff:	53                   	push   %ebx
+  800700:	83 ec 2c             	sub    $0x2c,%esp
+  800703:	8b 75 08             	mov    0x8(%ebp),%esi
+  800706:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800709:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80070c:	eb 0a                	jmp    800718 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80070e:	83 ec 08             	sub    $0x8,%esp
+  800711:	53                   	push   %ebx
+  800712:	50                   	push   %eax
+  800713:	ff d6                	call   *%esi
+  800715:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  800718:	83 c7 01             	add    $0x1,%edi
+  80071b:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  80071f:	83 f8 25             	cmp    $0x25,%eax
+  800722:	74 0c                	je     800730 <vprintfmt+0x36>
+			if (ch == '\0')
+  800724:	85 c0                	test   %eax,%eax
+  800726:	75 e6                	jne    80070e <vprintfmt+0x14>
+}
+  800728:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80072b:	5b                   	pop    %ebx
+  80072c:	5e                   	pop    %esi
+  80072d:	5f                   	pop    %edi
+  80072e:	5d                   	pop    %ebp
+  80072f:	c3                   	ret
+		padc = ' ';
+  800730:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800734:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80073b:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800742:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800749:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  80074e:	8d 47 01             	lea    0x1(%edi),%eax
+  800751:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800754:	0f b6 17             	movzbl (%edi),%edx
+  800757:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80075a:	3c 55                	cmp    $0x55,%al
+  80075c:	0f 87 c5 03 00 00    	ja     800b27 <vprintfmt+0x42d>
+  800762:	0f b6 c0             	movzbl %al,%eax
+  800765:	ff 24 85 20 53 80 00 	jmp    *0x805320(,%eax,4)
+  80076c:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  80076f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800772:	eb da                	jmp    80074e <vprintfmt+0x54>
+  800774:	0f be d2             	movsbl %dl,%edx
+  800777:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80077a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80077f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800782:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800785:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800789:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80078c:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80078f:	83 f9 09             	cmp    $0x9,%ecx
+  800792:	77 55                	ja     8007e9 <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  800794:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800797:	eb e9                	jmp    800782 <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  800799:	8b 45 14             	mov    0x14(%ebp),%eax
+  80079c:	8b 00                	mov    (%eax),%eax
+  80079e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8007a1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a4:	8d 40 04             	lea    0x4(%eax),%eax
+  8007a7:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  8007aa:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8007ad:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8007b1:	79 9b                	jns    80074e <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8007b3:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8007b6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8007b9:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8007c0:	eb 8c                	jmp    80074e <vprintfmt+0x54>
+			if (width < 0)
+  8007c2:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8007c5:	85 d2                	test   %edx,%edx
+  8007c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007cc:	0f 49 c2             	cmovns %edx,%eax
+  8007cf:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  8007d2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8007d5:	e9 74 ff ff ff       	jmp    80074e <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  8007da:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8007dd:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8007e4:	e9 65 ff ff ff       	jmp    80074e <vprintfmt+0x54>
+  8007e9:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8007ec:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8007ef:	eb bc                	jmp    8007ad <vprintfmt+0xb3>
+			lflag++;
+  8007f1:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  8007f4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8007f7:	e9 52 ff ff ff       	jmp    80074e <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8007fc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ff:	8d 78 04             	lea    0x4(%eax),%edi
+  800802:	83 ec 08             	sub    $0x8,%esp
+  800805:	53                   	push   %ebx
+  800806:	ff 30                	push   (%eax)
+  800808:	ff d6                	call   *%esi
+			break;
+  80080a:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80080d:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800810:	e9 b1 02 00 00       	jmp    800ac6 <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  800815:	8b 45 14             	mov    0x14(%ebp),%eax
+  800818:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80081b:	8b 10                	mov    (%eax),%edx
+  80081d:	89 d0                	mov    %edx,%eax
+  80081f:	f7 d8                	neg    %eax
+  800821:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800824:	83 f8 14             	cmp    $0x14,%eax
+  800827:	7f 23                	jg     80084c <vprintfmt+0x152>
+  800829:	8b 14 85 80 54 80 00 	mov    0x805480(,%eax,4),%edx
+  800830:	85 d2                	test   %edx,%edx
+  800832:	74 18                	je     80084c <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  800834:	52                   	push   %edx
+  800835:	68 c3 56 80 00       	push   $0x8056c3
+  80083a:	53                   	push   %ebx
+  80083b:	56                   	push   %esi
+  80083c:	e8 9c fe ff ff       	call   8006dd <printfmt>
+  800841:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800844:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800847:	e9 7a 02 00 00       	jmp    800ac6 <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  80084c:	50                   	push   %eax
+  80084d:	68 a7 51 80 00       	push   $0x8051a7
+  800852:	53                   	push   %ebx
+  800853:	56                   	push   %esi
+  800854:	e8 84 fe ff ff       	call   8006dd <printfmt>
+  800859:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80085c:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80085f:	e9 62 02 00 00       	jmp    800ac6 <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800864:	8b 45 14             	mov    0x14(%ebp),%eax
+  800867:	83 c0 04             	add    $0x4,%eax
+  80086a:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80086d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800870:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800872:	85 c9                	test   %ecx,%ecx
+  800874:	b8 a0 51 80 00       	mov    $0x8051a0,%eax
+  800879:	0f 45 c1             	cmovne %ecx,%eax
+  80087c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80087f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800883:	7e 06                	jle    80088b <vprintfmt+0x191>
+  800885:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800889:	75 0b                	jne    800896 <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80088b:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80088e:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800891:	89 75 08             	mov    %esi,0x8(%ebp)
+  800894:	eb 5c                	jmp    8008f2 <vprintfmt+0x1f8>
+  800896:	83 ec 08             	sub    $0x8,%esp
+  800899:	ff 75 d0             	push   -0x30(%ebp)
+  80089c:	ff 75 cc             	push   -0x34(%ebp)
+  80089f:	e8 20 03 00 00       	call   800bc4 <strnlen>
+  8008a4:	89 c2                	mov    %eax,%edx
+  8008a6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8008a9:	29 d0                	sub    %edx,%eax
+  8008ab:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8008ae:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8008b2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8008b5:	89 75 08             	mov    %esi,0x8(%ebp)
+  8008b8:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8008ba:	eb 0e                	jmp    8008ca <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  8008bc:	83 ec 08             	sub    $0x8,%esp
+  8008bf:	53                   	push   %ebx
+  8008c0:	57                   	push   %edi
+  8008c1:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8008c4:	83 ee 01             	sub    $0x1,%esi
+  8008c7:	83 c4 10             	add    $0x10,%esp
+  8008ca:	85 f6                	test   %esi,%esi
+  8008cc:	7f ee                	jg     8008bc <vprintfmt+0x1c2>
+  8008ce:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8008d1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008d4:	85 c0                	test   %eax,%eax
+  8008d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008db:	0f 49 d0             	cmovns %eax,%edx
+  8008de:	29 d0                	sub    %edx,%eax
+  8008e0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8008e3:	eb a6                	jmp    80088b <vprintfmt+0x191>
+					putch(ch, putdat);
+  8008e5:	83 ec 08             	sub    $0x8,%esp
+  8008e8:	53                   	push   %ebx
+  8008e9:	52                   	push   %edx
+  8008ea:	ff 55 08             	call   *0x8(%ebp)
+  8008ed:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8008f0:	89 f1                	mov    %esi,%ecx
+  8008f2:	8d 71 01             	lea    0x1(%ecx),%esi
+  8008f5:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8008f9:	0f be d0             	movsbl %al,%edx
+  8008fc:	85 d2                	test   %edx,%edx
+  8008fe:	74 28                	je     800928 <vprintfmt+0x22e>
+  800900:	85 ff                	test   %edi,%edi
+  800902:	78 05                	js     800909 <vprintfmt+0x20f>
+  800904:	83 ef 01             	sub    $0x1,%edi
+  800907:	78 30                	js     800939 <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800909:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80090d:	74 d6                	je     8008e5 <vprintfmt+0x1eb>
+  80090f:	0f be c0             	movsbl %al,%eax
+  800912:	83 e8 20             	sub    $0x20,%eax
+  800915:	83 f8 5e             	cmp    $0x5e,%eax
+  800918:	76 cb                	jbe    8008e5 <vprintfmt+0x1eb>
+					putch('?', putdat);
+  80091a:	83 ec 08             	sub    $0x8,%esp
+  80091d:	53                   	push   %ebx
+  80091e:	6a 3f                	push   $0x3f
+  800920:	ff 55 08             	call   *0x8(%ebp)
+  800923:	83 c4 10             	add    $0x10,%esp
+  800926:	eb c8                	jmp    8008f0 <vprintfmt+0x1f6>
+  800928:	8b 75 08             	mov    0x8(%ebp),%esi
+  80092b:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80092e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800931:	01 d0                	add    %edx,%eax
+  800933:	29 c8                	sub    %ecx,%eax
+  800935:	89 c7                	mov    %eax,%edi
+  800937:	eb 13                	jmp    80094c <vprintfmt+0x252>
+  800939:	8b 75 08             	mov    0x8(%ebp),%esi
+  80093c:	eb ed                	jmp    80092b <vprintfmt+0x231>
+				putch(' ', putdat);
+  80093e:	83 ec 08             	sub    $0x8,%esp
+  800941:	53                   	push   %ebx
+  800942:	6a 20                	push   $0x20
+  800944:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800946:	83 ef 01             	sub    $0x1,%edi
+  800949:	83 c4 10             	add    $0x10,%esp
+  80094c:	85 ff                	test   %edi,%edi
+  80094e:	7f ee                	jg     80093e <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800950:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800953:	89 45 14             	mov    %eax,0x14(%ebp)
+  800956:	e9 6b 01 00 00       	jmp    800ac6 <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  80095b:	83 f9 01             	cmp    $0x1,%ecx
+  80095e:	7f 1f                	jg     80097f <vprintfmt+0x285>
+	else if (lflag)
+  800960:	85 c9                	test   %ecx,%ecx
+  800962:	74 67                	je     8009cb <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  800964:	8b 45 14             	mov    0x14(%ebp),%eax
+  800967:	8b 00                	mov    (%eax),%eax
+  800969:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80096c:	89 c1                	mov    %eax,%ecx
+  80096e:	c1 f9 1f             	sar    $0x1f,%ecx
+  800971:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800974:	8b 45 14             	mov    0x14(%ebp),%eax
+  800977:	8d 40 04             	lea    0x4(%eax),%eax
+  80097a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80097d:	eb 17                	jmp    800996 <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  80097f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800982:	8b 50 04             	mov    0x4(%eax),%edx
+  800985:	8b 00                	mov    (%eax),%eax
+  800987:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80098a:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80098d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800990:	8d 40 08             	lea    0x8(%eax),%eax
+  800993:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800996:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800999:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80099c:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8009a1:	85 c9                	test   %ecx,%ecx
+  8009a3:	0f 89 03 01 00 00    	jns    800aac <vprintfmt+0x3b2>
+				putch('-', putdat);
+  8009a9:	83 ec 08             	sub    $0x8,%esp
+  8009ac:	53                   	push   %ebx
+  8009ad:	6a 2d                	push   $0x2d
+  8009af:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8009b1:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8009b4:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8009b7:	f7 da                	neg    %edx
+  8009b9:	83 d1 00             	adc    $0x0,%ecx
+  8009bc:	f7 d9                	neg    %ecx
+  8009be:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8009c1:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8009c6:	e9 e1 00 00 00       	jmp    800aac <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  8009cb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009ce:	8b 00                	mov    (%eax),%eax
+  8009d0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8009d3:	89 c1                	mov    %eax,%ecx
+  8009d5:	c1 f9 1f             	sar    $0x1f,%ecx
+  8009d8:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8009db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009de:	8d 40 04             	lea    0x4(%eax),%eax
+  8009e1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009e4:	eb b0                	jmp    800996 <vprintfmt+0x29c>
+	if (lflag >= 2)
+  8009e6:	83 f9 01             	cmp    $0x1,%ecx
+  8009e9:	7f 1e                	jg     800a09 <vprintfmt+0x30f>
+	else if (lflag)
+  8009eb:	85 c9                	test   %ecx,%ecx
+  8009ed:	74 32                	je     800a21 <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  8009ef:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009f2:	8b 10                	mov    (%eax),%edx
+  8009f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009f9:	8d 40 04             	lea    0x4(%eax),%eax
+  8009fc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8009ff:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800a04:	e9 a3 00 00 00       	jmp    800aac <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800a09:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a0c:	8b 10                	mov    (%eax),%edx
+  800a0e:	8b 48 04             	mov    0x4(%eax),%ecx
+  800a11:	8d 40 08             	lea    0x8(%eax),%eax
+  800a14:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800a17:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800a1c:	e9 8b 00 00 00       	jmp    800aac <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800a21:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a24:	8b 10                	mov    (%eax),%edx
+  800a26:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a2b:	8d 40 04             	lea    0x4(%eax),%eax
+  800a2e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800a31:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800a36:	eb 74                	jmp    800aac <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  800a38:	83 f9 01             	cmp    $0x1,%ecx
+  800a3b:	7f 1b                	jg     800a58 <vprintfmt+0x35e>
+	else if (lflag)
+  800a3d:	85 c9                	test   %ecx,%ecx
+  800a3f:	74 2c                	je     800a6d <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  800a41:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a44:	8b 10                	mov    (%eax),%edx
+  800a46:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a4b:	8d 40 04             	lea    0x4(%eax),%eax
+  800a4e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800a51:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800a56:	eb 54                	jmp    800aac <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800a58:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a5b:	8b 10                	mov    (%eax),%edx
+  800a5d:	8b 48 04             	mov    0x4(%eax),%ecx
+  800a60:	8d 40 08             	lea    0x8(%eax),%eax
+  800a63:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800a66:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800a6b:	eb 3f                	jmp    800aac <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800a6d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a70:	8b 10                	mov    (%eax),%edx
+  800a72:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a77:	8d 40 04             	lea    0x4(%eax),%eax
+  800a7a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800a7d:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800a82:	eb 28                	jmp    800aac <vprintfmt+0x3b2>
+			putch('0', putdat);
+  800a84:	83 ec 08             	sub    $0x8,%esp
+  800a87:	53                   	push   %ebx
+  800a88:	6a 30                	push   $0x30
+  800a8a:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800a8c:	83 c4 08             	add    $0x8,%esp
+  800a8f:	53                   	push   %ebx
+  800a90:	6a 78                	push   $0x78
+  800a92:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800a94:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a97:	8b 10                	mov    (%eax),%edx
+  800a99:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800a9e:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800aa1:	8d 40 04             	lea    0x4(%eax),%eax
+  800aa4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800aa7:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800aac:	83 ec 0c             	sub    $0xc,%esp
+  800aaf:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800ab3:	50                   	push   %eax
+  800ab4:	ff 75 e0             	push   -0x20(%ebp)
+  800ab7:	57                   	push   %edi
+  800ab8:	51                   	push   %ecx
+  800ab9:	52                   	push   %edx
+  800aba:	89 da                	mov    %ebx,%edx
+  800abc:	89 f0                	mov    %esi,%eax
+  800abe:	e8 54 fb ff ff       	call   800617 <printnum>
+			break;
+  800ac3:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800ac6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  800ac9:	e9 4a fc ff ff       	jmp    800718 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800ace:	83 f9 01             	cmp    $0x1,%ecx
+  800ad1:	7f 1b                	jg     800aee <vprintfmt+0x3f4>
+	else if (lflag)
+  800ad3:	85 c9                	test   %ecx,%ecx
+  800ad5:	74 2c                	je     800b03 <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  800ad7:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ada:	8b 10                	mov    (%eax),%edx
+  800adc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ae1:	8d 40 04             	lea    0x4(%eax),%eax
+  800ae4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800ae7:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800aec:	eb be                	jmp    800aac <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800aee:	8b 45 14             	mov    0x14(%ebp),%eax
+  800af1:	8b 10                	mov    (%eax),%edx
+  800af3:	8b 48 04             	mov    0x4(%eax),%ecx
+  800af6:	8d 40 08             	lea    0x8(%eax),%eax
+  800af9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800afc:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800b01:	eb a9                	jmp    800aac <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800b03:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b06:	8b 10                	mov    (%eax),%edx
+  800b08:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b0d:	8d 40 04             	lea    0x4(%eax),%eax
+  800b10:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800b13:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800b18:	eb 92                	jmp    800aac <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  800b1a:	83 ec 08             	sub    $0x8,%esp
+  800b1d:	53                   	push   %ebx
+  800b1e:	6a 25                	push   $0x25
+  800b20:	ff d6                	call   *%esi
+			break;
+  800b22:	83 c4 10             	add    $0x10,%esp
+  800b25:	eb 9f                	jmp    800ac6 <vprintfmt+0x3cc>
+			putch('%', putdat);
+  800b27:	83 ec 08             	sub    $0x8,%esp
+  800b2a:	53                   	push   %ebx
+  800b2b:	6a 25                	push   $0x25
+  800b2d:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800b2f:	83 c4 10             	add    $0x10,%esp
+  800b32:	89 f8                	mov    %edi,%eax
+  800b34:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800b38:	74 05                	je     800b3f <vprintfmt+0x445>
+  800b3a:	83 e8 01             	sub    $0x1,%eax
+  800b3d:	eb f5                	jmp    800b34 <vprintfmt+0x43a>
+  800b3f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800b42:	eb 82                	jmp    800ac6 <vprintfmt+0x3cc>
+
+00800b44 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800b44:	55                   	push   %ebp
+  800b45:	89 e5                	mov    %esp,%ebp
+  800b47:	83 ec 18             	sub    $0x18,%esp
+  800b4a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b4d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800b50:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800b53:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800b57:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800b5a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800b61:	85 c0                	test   %eax,%eax
+  800b63:	74 26                	je     800b8b <vsnprintf+0x47>
+  800b65:	85 d2                	test   %edx,%edx
+  800b67:	7e 22                	jle    800b8b <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800b69:	ff 75 14             	push   0x14(%ebp)
+  800b6c:	ff 75 10             	push   0x10(%ebp)
+  800b6f:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800b72:	50                   	push   %eax
+  800b73:	68 c0 06 80 00       	push   $0x8006c0
+  800b78:	e8 7d fb ff ff       	call   8006fa <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800b7d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800b80:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800b83:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b86:	83 c4 10             	add    $0x10,%esp
+}
+  800b89:	c9                   	leave
+  800b8a:	c3                   	ret
+		return -E_INVAL;
+  800b8b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b90:	eb f7                	jmp    800b89 <vsnprintf+0x45>
+
+00800b92 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800b92:	55                   	push   %ebp
+  800b93:	89 e5                	mov    %esp,%ebp
+  800b95:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800b98:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800b9b:	50                   	push   %eax
+  800b9c:	ff 75 10             	push   0x10(%ebp)
+  800b9f:	ff 75 0c             	push   0xc(%ebp)
+  800ba2:	ff 75 08             	push   0x8(%ebp)
+  800ba5:	e8 9a ff ff ff       	call   800b44 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800baa:	c9                   	leave
+  800bab:	c3                   	ret
+
+00800bac <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800bac:	55                   	push   %ebp
+  800bad:	89 e5                	mov    %esp,%ebp
+  800baf:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800bb2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bb7:	eb 03                	jmp    800bbc <strlen+0x10>
+		n++;
+  800bb9:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800bbc:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800bc0:	75 f7                	jne    800bb9 <strlen+0xd>
+	return n;
+}
+  800bc2:	5d                   	pop    %ebp
+  800bc3:	c3                   	ret
+
+00800bc4 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800bc4:	55                   	push   %ebp
+  800bc5:	89 e5                	mov    %esp,%ebp
+  800bc7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800bca:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800bcd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bd2:	eb 03                	jmp    800bd7 <strnlen+0x13>
+		n++;
+  800bd4:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800bd7:	39 d0                	cmp    %edx,%eax
+  800bd9:	74 08                	je     800be3 <strnlen+0x1f>
+  800bdb:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800bdf:	75 f3                	jne    800bd4 <strnlen+0x10>
+  800be1:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800be3:	89 d0                	mov    %edx,%eax
+  800be5:	5d                   	pop    %ebp
+  800be6:	c3                   	ret
+
+00800be7 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800be7:	55                   	push   %ebp
+  800be8:	89 e5                	mov    %esp,%ebp
+  800bea:	53                   	push   %ebx
+  800beb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800bee:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800bf1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bf6:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800bfa:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800bfd:	83 c0 01             	add    $0x1,%eax
+  800c00:	84 d2                	test   %dl,%dl
+  800c02:	75 f2                	jne    800bf6 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800c04:	89 c8                	mov    %ecx,%eax
+  800c06:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c09:	c9                   	leave
+  800c0a:	c3                   	ret
+
+00800c0b <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800c0b:	55                   	push   %ebp
+  800c0c:	89 e5                	mov    %esp,%ebp
+  800c0e:	53                   	push   %ebx
+  800c0f:	83 ec 10             	sub    $0x10,%esp
+  800c12:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800c15:	53                   	push   %ebx
+  800c16:	e8 91 ff ff ff       	call   800bac <strlen>
+  800c1b:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800c1e:	ff 75 0c             	push   0xc(%ebp)
+  800c21:	01 d8                	add    %ebx,%eax
+  800c23:	50                   	push   %eax
+  800c24:	e8 be ff ff ff       	call   800be7 <strcpy>
+	return dst;
+}
+  800c29:	89 d8                	mov    %ebx,%eax
+  800c2b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c2e:	c9                   	leave
+  800c2f:	c3                   	ret
+
+00800c30 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c30:	55                   	push   %ebp
+  800c31:	89 e5                	mov    %esp,%ebp
+  800c33:	56                   	push   %esi
+  800c34:	53                   	push   %ebx
+  800c35:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c38:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800c3b:	89 f3                	mov    %esi,%ebx
+  800c3d:	03 5d 10             	add    0x10(%ebp),%ebx
+  800c40:	89 f0                	mov    %esi,%eax
+  800c42:	eb 0f                	jmp    800c53 <strncpy+0x23>
+		*dst++ = *src;
+  800c44:	83 c0 01             	add    $0x1,%eax
+  800c47:	0f b6 0a             	movzbl (%edx),%ecx
+  800c4a:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800c4d:	80 f9 01             	cmp    $0x1,%cl
+  800c50:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800c53:	39 d8                	cmp    %ebx,%eax
+  800c55:	75 ed                	jne    800c44 <strncpy+0x14>
+	}
+	return ret;
+}
+  800c57:	89 f0                	mov    %esi,%eax
+  800c59:	5b                   	pop    %ebx
+  800c5a:	5e                   	pop    %esi
+  800c5b:	5d                   	pop    %ebp
+  800c5c:	c3                   	ret
+
+00800c5d <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800c5d:	55                   	push   %ebp
+  800c5e:	89 e5                	mov    %esp,%ebp
+  800c60:	56                   	push   %esi
+  800c61:	53                   	push   %ebx
+  800c62:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c65:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c68:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800c6b:	89 f0                	mov    %esi,%eax
+  800c6d:	85 d2                	test   %edx,%edx
+  800c6f:	74 21                	je     800c92 <strlcpy+0x35>
+  800c71:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800c75:	89 f2                	mov    %esi,%edx
+  800c77:	eb 09                	jmp    800c82 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800c79:	83 c1 01             	add    $0x1,%ecx
+  800c7c:	83 c2 01             	add    $0x1,%edx
+  800c7f:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800c82:	39 c2                	cmp    %eax,%edx
+  800c84:	74 09                	je     800c8f <strlcpy+0x32>
+  800c86:	0f b6 19             	movzbl (%ecx),%ebx
+  800c89:	84 db                	test   %bl,%bl
+  800c8b:	75 ec                	jne    800c79 <strlcpy+0x1c>
+  800c8d:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800c8f:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800c92:	29 f0                	sub    %esi,%eax
+}
+  800c94:	5b                   	pop    %ebx
+  800c95:	5e                   	pop    %esi
+  800c96:	5d                   	pop    %ebp
+  800c97:	c3                   	ret
+
+00800c98 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800c98:	55                   	push   %ebp
+  800c99:	89 e5                	mov    %esp,%ebp
+  800c9b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c9e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800ca1:	eb 06                	jmp    800ca9 <strcmp+0x11>
+		p++, q++;
+  800ca3:	83 c1 01             	add    $0x1,%ecx
+  800ca6:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800ca9:	0f b6 01             	movzbl (%ecx),%eax
+  800cac:	84 c0                	test   %al,%al
+  800cae:	74 04                	je     800cb4 <strcmp+0x1c>
+  800cb0:	3a 02                	cmp    (%edx),%al
+  800cb2:	74 ef                	je     800ca3 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800cb4:	0f b6 c0             	movzbl %al,%eax
+  800cb7:	0f b6 12             	movzbl (%edx),%edx
+  800cba:	29 d0                	sub    %edx,%eax
+}
+  800cbc:	5d                   	pop    %ebp
+  800cbd:	c3                   	ret
+
+00800cbe <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800cbe:	55                   	push   %ebp
+  800cbf:	89 e5                	mov    %esp,%ebp
+  800cc1:	53                   	push   %ebx
+  800cc2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cc5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cc8:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800ccb:	eb 09                	jmp    800cd6 <strncmp+0x18>
+		n--, p++, q++;
+  800ccd:	83 ea 01             	sub    $0x1,%edx
+  800cd0:	83 c0 01             	add    $0x1,%eax
+  800cd3:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800cd6:	85 d2                	test   %edx,%edx
+  800cd8:	74 18                	je     800cf2 <strncmp+0x34>
+  800cda:	0f b6 18             	movzbl (%eax),%ebx
+  800cdd:	84 db                	test   %bl,%bl
+  800cdf:	74 04                	je     800ce5 <strncmp+0x27>
+  800ce1:	3a 19                	cmp    (%ecx),%bl
+  800ce3:	74 e8                	je     800ccd <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800ce5:	0f b6 00             	movzbl (%eax),%eax
+  800ce8:	0f b6 11             	movzbl (%ecx),%edx
+  800ceb:	29 d0                	sub    %edx,%eax
+}
+  800ced:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800cf0:	c9                   	leave
+  800cf1:	c3                   	ret
+		return 0;
+  800cf2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cf7:	eb f4                	jmp    800ced <strncmp+0x2f>
+
+00800cf9 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800cf9:	55                   	push   %ebp
+  800cfa:	89 e5                	mov    %esp,%ebp
+  800cfc:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cff:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800d03:	eb 03                	jmp    800d08 <strchr+0xf>
+  800d05:	83 c0 01             	add    $0x1,%eax
+  800d08:	0f b6 10             	movzbl (%eax),%edx
+  800d0b:	84 d2                	test   %dl,%dl
+  800d0d:	74 06                	je     800d15 <strchr+0x1c>
+		if (*s == c)
+  800d0f:	38 ca                	cmp    %cl,%dl
+  800d11:	75 f2                	jne    800d05 <strchr+0xc>
+  800d13:	eb 05                	jmp    800d1a <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800d15:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d1a:	5d                   	pop    %ebp
+  800d1b:	c3                   	ret
+
+00800d1c <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800d1c:	55                   	push   %ebp
+  800d1d:	89 e5                	mov    %esp,%ebp
+  800d1f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d22:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800d26:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800d29:	38 ca                	cmp    %cl,%dl
+  800d2b:	74 09                	je     800d36 <strfind+0x1a>
+  800d2d:	84 d2                	test   %dl,%dl
+  800d2f:	74 05                	je     800d36 <strfind+0x1a>
+	for (; *s; s++)
+  800d31:	83 c0 01             	add    $0x1,%eax
+  800d34:	eb f0                	jmp    800d26 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800d36:	5d                   	pop    %ebp
+  800d37:	c3                   	ret
+
+00800d38 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800d38:	55                   	push   %ebp
+  800d39:	89 e5                	mov    %esp,%ebp
+  800d3b:	57                   	push   %edi
+  800d3c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800d3f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800d42:	85 c9                	test   %ecx,%ecx
+  800d44:	74 20                	je     800d66 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800d46:	89 f8                	mov    %edi,%eax
+  800d48:	09 c8                	or     %ecx,%eax
+  800d4a:	a8 03                	test   $0x3,%al
+  800d4c:	75 12                	jne    800d60 <memset+0x28>
+		c &= 0xFF;
+  800d4e:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800d52:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800d58:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800d5b:	fc                   	cld
+  800d5c:	f3 ab                	rep stos %eax,%es:(%edi)
+  800d5e:	eb 06                	jmp    800d66 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800d60:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d63:	fc                   	cld
+  800d64:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800d66:	89 f8                	mov    %edi,%eax
+  800d68:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800d6b:	c9                   	leave
+  800d6c:	c3                   	ret
+
+00800d6d <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800d6d:	55                   	push   %ebp
+  800d6e:	89 e5                	mov    %esp,%ebp
+  800d70:	57                   	push   %edi
+  800d71:	56                   	push   %esi
+  800d72:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d75:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800d78:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800d7b:	39 c6                	cmp    %eax,%esi
+  800d7d:	73 32                	jae    800db1 <memmove+0x44>
+  800d7f:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800d82:	39 d0                	cmp    %edx,%eax
+  800d84:	73 2b                	jae    800db1 <memmove+0x44>
+		s += n;
+		d += n;
+  800d86:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d89:	89 d6                	mov    %edx,%esi
+  800d8b:	09 fe                	or     %edi,%esi
+  800d8d:	09 ce                	or     %ecx,%esi
+  800d8f:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800d95:	75 0e                	jne    800da5 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800d97:	83 ef 04             	sub    $0x4,%edi
+  800d9a:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800d9d:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800da0:	fd                   	std
+  800da1:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800da3:	eb 09                	jmp    800dae <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800da5:	83 ef 01             	sub    $0x1,%edi
+  800da8:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800dab:	fd                   	std
+  800dac:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800dae:	fc                   	cld
+  800daf:	eb 1a                	jmp    800dcb <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800db1:	89 f2                	mov    %esi,%edx
+  800db3:	09 c2                	or     %eax,%edx
+  800db5:	09 ca                	or     %ecx,%edx
+  800db7:	f6 c2 03             	test   $0x3,%dl
+  800dba:	75 0a                	jne    800dc6 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800dbc:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800dbf:	89 c7                	mov    %eax,%edi
+  800dc1:	fc                   	cld
+  800dc2:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800dc4:	eb 05                	jmp    800dcb <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800dc6:	89 c7                	mov    %eax,%edi
+  800dc8:	fc                   	cld
+  800dc9:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800dcb:	5e                   	pop    %esi
+  800dcc:	5f                   	pop    %edi
+  800dcd:	5d                   	pop    %ebp
+  800dce:	c3                   	ret
+
+00800dcf <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800dcf:	55                   	push   %ebp
+  800dd0:	89 e5                	mov    %esp,%ebp
+  800dd2:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800dd5:	ff 75 10             	push   0x10(%ebp)
+  800dd8:	ff 75 0c             	push   0xc(%ebp)
+  800ddb:	ff 75 08             	push   0x8(%ebp)
+  800dde:	e8 8a ff ff ff       	call   800d6d <memmove>
+}
+  800de3:	c9                   	leave
+  800de4:	c3                   	ret
+
+00800de5 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800de5:	55                   	push   %ebp
+  800de6:	89 e5                	mov    %esp,%ebp
+  800de8:	56                   	push   %esi
+  800de9:	53                   	push   %ebx
+  800dea:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ded:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800df0:	89 c6                	mov    %eax,%esi
+  800df2:	03 75 10             	add    0x10(%ebp),%esi
+  800df5:	eb 06                	jmp    800dfd <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800df7:	83 c0 01             	add    $0x1,%eax
+  800dfa:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800dfd:	39 f0                	cmp    %esi,%eax
+  800dff:	74 14                	je     800e15 <memcmp+0x30>
+		if (*s1 != *s2)
+  800e01:	0f b6 08             	movzbl (%eax),%ecx
+  800e04:	0f b6 1a             	movzbl (%edx),%ebx
+  800e07:	38 d9                	cmp    %bl,%cl
+  800e09:	74 ec                	je     800df7 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800e0b:	0f b6 c1             	movzbl %cl,%eax
+  800e0e:	0f b6 db             	movzbl %bl,%ebx
+  800e11:	29 d8                	sub    %ebx,%eax
+  800e13:	eb 05                	jmp    800e1a <memcmp+0x35>
+	}
+
+	return 0;
+  800e15:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e1a:	5b                   	pop    %ebx
+  800e1b:	5e                   	pop    %esi
+  800e1c:	5d                   	pop    %ebp
+  800e1d:	c3                   	ret
+
+00800e1e <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800e1e:	55                   	push   %ebp
+  800e1f:	89 e5                	mov    %esp,%ebp
+  800e21:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e24:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800e27:	89 c2                	mov    %eax,%edx
+  800e29:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800e2c:	eb 03                	jmp    800e31 <memfind+0x13>
+  800e2e:	83 c0 01             	add    $0x1,%eax
+  800e31:	39 d0                	cmp    %edx,%eax
+  800e33:	73 04                	jae    800e39 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800e35:	38 08                	cmp    %cl,(%eax)
+  800e37:	75 f5                	jne    800e2e <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800e39:	5d                   	pop    %ebp
+  800e3a:	c3                   	ret
+
+00800e3b <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800e3b:	55                   	push   %ebp
+  800e3c:	89 e5                	mov    %esp,%ebp
+  800e3e:	57                   	push   %edi
+  800e3f:	56                   	push   %esi
+  800e40:	53                   	push   %ebx
+  800e41:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e44:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800e47:	eb 03                	jmp    800e4c <strtol+0x11>
+		s++;
+  800e49:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800e4c:	0f b6 02             	movzbl (%edx),%eax
+  800e4f:	3c 20                	cmp    $0x20,%al
+  800e51:	74 f6                	je     800e49 <strtol+0xe>
+  800e53:	3c 09                	cmp    $0x9,%al
+  800e55:	74 f2                	je     800e49 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800e57:	3c 2b                	cmp    $0x2b,%al
+  800e59:	74 2a                	je     800e85 <strtol+0x4a>
+	int neg = 0;
+  800e5b:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800e60:	3c 2d                	cmp    $0x2d,%al
+  800e62:	74 2b                	je     800e8f <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e64:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800e6a:	75 0f                	jne    800e7b <strtol+0x40>
+  800e6c:	80 3a 30             	cmpb   $0x30,(%edx)
+  800e6f:	74 28                	je     800e99 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800e71:	85 db                	test   %ebx,%ebx
+  800e73:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e78:	0f 44 d8             	cmove  %eax,%ebx
+  800e7b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e80:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800e83:	eb 46                	jmp    800ecb <strtol+0x90>
+		s++;
+  800e85:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800e88:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e8d:	eb d5                	jmp    800e64 <strtol+0x29>
+		s++, neg = 1;
+  800e8f:	83 c2 01             	add    $0x1,%edx
+  800e92:	bf 01 00 00 00       	mov    $0x1,%edi
+  800e97:	eb cb                	jmp    800e64 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e99:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800e9d:	74 0e                	je     800ead <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800e9f:	85 db                	test   %ebx,%ebx
+  800ea1:	75 d8                	jne    800e7b <strtol+0x40>
+		s++, base = 8;
+  800ea3:	83 c2 01             	add    $0x1,%edx
+  800ea6:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800eab:	eb ce                	jmp    800e7b <strtol+0x40>
+		s += 2, base = 16;
+  800ead:	83 c2 02             	add    $0x2,%edx
+  800eb0:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800eb5:	eb c4                	jmp    800e7b <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800eb7:	0f be c0             	movsbl %al,%eax
+  800eba:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800ebd:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800ec0:	7d 3a                	jge    800efc <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800ec2:	83 c2 01             	add    $0x1,%edx
+  800ec5:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800ec9:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800ecb:	0f b6 02             	movzbl (%edx),%eax
+  800ece:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800ed1:	89 f3                	mov    %esi,%ebx
+  800ed3:	80 fb 09             	cmp    $0x9,%bl
+  800ed6:	76 df                	jbe    800eb7 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800ed8:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800edb:	89 f3                	mov    %esi,%ebx
+  800edd:	80 fb 19             	cmp    $0x19,%bl
+  800ee0:	77 08                	ja     800eea <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800ee2:	0f be c0             	movsbl %al,%eax
+  800ee5:	83 e8 57             	sub    $0x57,%eax
+  800ee8:	eb d3                	jmp    800ebd <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800eea:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800eed:	89 f3                	mov    %esi,%ebx
+  800eef:	80 fb 19             	cmp    $0x19,%bl
+  800ef2:	77 08                	ja     800efc <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800ef4:	0f be c0             	movsbl %al,%eax
+  800ef7:	83 e8 37             	sub    $0x37,%eax
+  800efa:	eb c1                	jmp    800ebd <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800efc:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800f00:	74 05                	je     800f07 <strtol+0xcc>
+		*endptr = (char *) s;
+  800f02:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f05:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800f07:	89 c8                	mov    %ecx,%eax
+  800f09:	f7 d8                	neg    %eax
+  800f0b:	85 ff                	test   %edi,%edi
+  800f0d:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800f10:	89 c8                	mov    %ecx,%eax
+  800f12:	5b                   	pop    %ebx
+  800f13:	5e                   	pop    %esi
+  800f14:	5f                   	pop    %edi
+  800f15:	5d                   	pop    %ebp
+  800f16:	c3                   	ret
+
+00800f17 <atoi>:
+
+int
+atoi(const char* s)
+{
+  800f17:	55                   	push   %ebp
+  800f18:	89 e5                	mov    %esp,%ebp
+  800f1a:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  800f1d:	6a 00                	push   $0x0
+  800f1f:	6a 00                	push   $0x0
+  800f21:	ff 75 08             	push   0x8(%ebp)
+  800f24:	e8 12 ff ff ff       	call   800e3b <strtol>
+}
+  800f29:	c9                   	leave
+  800f2a:	c3                   	ret
+
+00800f2b <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800f2b:	55                   	push   %ebp
+  800f2c:	89 e5                	mov    %esp,%ebp
+  800f2e:	57                   	push   %edi
+  800f2f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f30:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f35:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f38:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f3b:	89 c3                	mov    %eax,%ebx
+  800f3d:	89 c7                	mov    %eax,%edi
+  800f3f:	6a 00                	push   $0x0
+  800f41:	55                   	push   %ebp
+  800f42:	56                   	push   %esi
+  800f43:	89 e5                	mov    %esp,%ebp
+  800f45:	8d 35 4d 0f 80 00    	lea    0x800f4d,%esi
+  800f4b:	0f 34                	sysenter
+
+00800f4d <after_sysenter_label_47>:
+  800f4d:	5e                   	pop    %esi
+  800f4e:	5d                   	pop    %ebp
+  800f4f:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800f52:	5b                   	pop    %ebx
+  800f53:	5f                   	pop    %edi
+  800f54:	5d                   	pop    %ebp
+  800f55:	c3                   	ret
+
+00800f56 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800f56:	55                   	push   %ebp
+  800f57:	89 e5                	mov    %esp,%ebp
+  800f59:	57                   	push   %edi
+  800f5a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f5b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f60:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f65:	89 d1                	mov    %edx,%ecx
+  800f67:	89 d3                	mov    %edx,%ebx
+  800f69:	89 d7                	mov    %edx,%edi
+  800f6b:	6a 00                	push   $0x0
+  800f6d:	55                   	push   %ebp
+  800f6e:	56                   	push   %esi
+  800f6f:	89 e5                	mov    %esp,%ebp
+  800f71:	8d 35 79 0f 80 00    	lea    0x800f79,%esi
+  800f77:	0f 34                	sysenter
+
+00800f79 <after_sysenter_label_128>:
+  800f79:	5e                   	pop    %esi
+  800f7a:	5d                   	pop    %ebp
+  800f7b:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800f7e:	5b                   	pop    %ebx
+  800f7f:	5f                   	pop    %edi
+  800f80:	5d                   	pop    %ebp
+  800f81:	c3                   	ret
+
+00800f82 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800f82:	55                   	push   %ebp
+  800f83:	89 e5                	mov    %esp,%ebp
+  800f85:	57                   	push   %edi
+  800f86:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f87:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f8a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f8f:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f94:	89 cb                	mov    %ecx,%ebx
+  800f96:	89 cf                	mov    %ecx,%edi
+  800f98:	6a 00                	push   $0x0
+  800f9a:	55                   	push   %ebp
+  800f9b:	56                   	push   %esi
+  800f9c:	89 e5                	mov    %esp,%ebp
+  800f9e:	8d 35 a6 0f 80 00    	lea    0x800fa6,%esi
+  800fa4:	0f 34                	sysenter
+
+00800fa6 <after_sysenter_label_212>:
+  800fa6:	5e                   	pop    %esi
+  800fa7:	5d                   	pop    %ebp
+  800fa8:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800fab:	85 c0                	test   %eax,%eax
+  800fad:	7f 07                	jg     800fb6 <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800faf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fb2:	5b                   	pop    %ebx
+  800fb3:	5f                   	pop    %edi
+  800fb4:	5d                   	pop    %ebp
+  800fb5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fb6:	83 ec 0c             	sub    $0xc,%esp
+  800fb9:	50                   	push   %eax
+  800fba:	6a 03                	push   $0x3
+  800fbc:	68 15 55 80 00       	push   $0x805515
+  800fc1:	6a 54                	push   $0x54
+  800fc3:	68 32 55 80 00       	push   $0x805532
+  800fc8:	e8 5b f5 ff ff       	call   800528 <_panic>
+
+00800fcd <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800fcd:	55                   	push   %ebp
+  800fce:	89 e5                	mov    %esp,%ebp
+  800fd0:	57                   	push   %edi
+  800fd1:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fd2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fd7:	b8 02 00 00 00       	mov    $0x2,%eax
+  800fdc:	89 d1                	mov    %edx,%ecx
+  800fde:	89 d3                	mov    %edx,%ebx
+  800fe0:	89 d7                	mov    %edx,%edi
+  800fe2:	6a 00                	push   $0x0
+  800fe4:	55                   	push   %ebp
+  800fe5:	56                   	push   %esi
+  800fe6:	89 e5                	mov    %esp,%ebp
+  800fe8:	8d 35 f0 0f 80 00    	lea    0x800ff0,%esi
+  800fee:	0f 34                	sysenter
+
+00800ff0 <after_sysenter_label_309>:
+  800ff0:	5e                   	pop    %esi
+  800ff1:	5d                   	pop    %ebp
+  800ff2:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800ff5:	5b                   	pop    %ebx
+  800ff6:	5f                   	pop    %edi
+  800ff7:	5d                   	pop    %ebp
+  800ff8:	c3                   	ret
+
+00800ff9 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800ff9:	55                   	push   %ebp
+  800ffa:	89 e5                	mov    %esp,%ebp
+  800ffc:	57                   	push   %edi
+  800ffd:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ffe:	ba 00 00 00 00       	mov    $0x0,%edx
+  801003:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801008:	89 d1                	mov    %edx,%ecx
+  80100a:	89 d3                	mov    %edx,%ebx
+  80100c:	89 d7                	mov    %edx,%edi
+  80100e:	6a 00                	push   $0x0
+  801010:	55                   	push   %ebp
+  801011:	56                   	push   %esi
+  801012:	89 e5                	mov    %esp,%ebp
+  801014:	8d 35 1c 10 80 00    	lea    0x80101c,%esi
+  80101a:	0f 34                	sysenter
+
+0080101c <after_sysenter_label_391>:
+  80101c:	5e                   	pop    %esi
+  80101d:	5d                   	pop    %ebp
+  80101e:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  801021:	5b                   	pop    %ebx
+  801022:	5f                   	pop    %edi
+  801023:	5d                   	pop    %ebp
+  801024:	c3                   	ret
+
+00801025 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801025:	55                   	push   %ebp
+  801026:	89 e5                	mov    %esp,%ebp
+  801028:	57                   	push   %edi
+  801029:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80102a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801030:	b8 04 00 00 00       	mov    $0x4,%eax
+  801035:	bf 00 00 00 00       	mov    $0x0,%edi
+  80103a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80103d:	6a 00                	push   $0x0
+  80103f:	55                   	push   %ebp
+  801040:	56                   	push   %esi
+  801041:	89 e5                	mov    %esp,%ebp
+  801043:	8d 35 4b 10 80 00    	lea    0x80104b,%esi
+  801049:	0f 34                	sysenter
+
+0080104b <after_sysenter_label_479>:
+  80104b:	5e                   	pop    %esi
+  80104c:	5d                   	pop    %ebp
+  80104d:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801050:	85 c0                	test   %eax,%eax
+  801052:	7f 07                	jg     80105b <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  801054:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801057:	5b                   	pop    %ebx
+  801058:	5f                   	pop    %edi
+  801059:	5d                   	pop    %ebp
+  80105a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80105b:	83 ec 0c             	sub    $0xc,%esp
+  80105e:	50                   	push   %eax
+  80105f:	6a 04                	push   $0x4
+  801061:	68 15 55 80 00       	push   $0x805515
+  801066:	6a 54                	push   $0x54
+  801068:	68 32 55 80 00       	push   $0x805532
+  80106d:	e8 b6 f4 ff ff       	call   800528 <_panic>
+
+00801072 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801072:	55                   	push   %ebp
+  801073:	89 e5                	mov    %esp,%ebp
+  801075:	57                   	push   %edi
+  801076:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801077:	8b 55 08             	mov    0x8(%ebp),%edx
+  80107a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80107d:	b8 05 00 00 00       	mov    $0x5,%eax
+  801082:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801085:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801088:	ff 75 18             	push   0x18(%ebp)
+  80108b:	55                   	push   %ebp
+  80108c:	56                   	push   %esi
+  80108d:	89 e5                	mov    %esp,%ebp
+  80108f:	8d 35 97 10 80 00    	lea    0x801097,%esi
+  801095:	0f 34                	sysenter
+
+00801097 <after_sysenter_label_593>:
+  801097:	5e                   	pop    %esi
+  801098:	5d                   	pop    %ebp
+  801099:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80109c:	85 c0                	test   %eax,%eax
+  80109e:	7f 07                	jg     8010a7 <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8010a0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8010a3:	5b                   	pop    %ebx
+  8010a4:	5f                   	pop    %edi
+  8010a5:	5d                   	pop    %ebp
+  8010a6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010a7:	83 ec 0c             	sub    $0xc,%esp
+  8010aa:	50                   	push   %eax
+  8010ab:	6a 05                	push   $0x5
+  8010ad:	68 15 55 80 00       	push   $0x805515
+  8010b2:	6a 54                	push   $0x54
+  8010b4:	68 32 55 80 00       	push   $0x805532
+  8010b9:	e8 6a f4 ff ff       	call   800528 <_panic>
+
+008010be <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8010be:	55                   	push   %ebp
+  8010bf:	89 e5                	mov    %esp,%ebp
+  8010c1:	57                   	push   %edi
+  8010c2:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010cb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ce:	b8 06 00 00 00       	mov    $0x6,%eax
+  8010d3:	89 df                	mov    %ebx,%edi
+  8010d5:	6a 00                	push   $0x0
+  8010d7:	55                   	push   %ebp
+  8010d8:	56                   	push   %esi
+  8010d9:	89 e5                	mov    %esp,%ebp
+  8010db:	8d 35 e3 10 80 00    	lea    0x8010e3,%esi
+  8010e1:	0f 34                	sysenter
+
+008010e3 <after_sysenter_label_704>:
+  8010e3:	5e                   	pop    %esi
+  8010e4:	5d                   	pop    %ebp
+  8010e5:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8010e8:	85 c0                	test   %eax,%eax
+  8010ea:	7f 07                	jg     8010f3 <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  8010ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8010ef:	5b                   	pop    %ebx
+  8010f0:	5f                   	pop    %edi
+  8010f1:	5d                   	pop    %ebp
+  8010f2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010f3:	83 ec 0c             	sub    $0xc,%esp
+  8010f6:	50                   	push   %eax
+  8010f7:	6a 06                	push   $0x6
+  8010f9:	68 15 55 80 00       	push   $0x805515
+  8010fe:	6a 54                	push   $0x54
+  801100:	68 32 55 80 00       	push   $0x805532
+  801105:	e8 1e f4 ff ff       	call   800528 <_panic>
+
+0080110a <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  80110a:	55                   	push   %ebp
+  80110b:	89 e5                	mov    %esp,%ebp
+  80110d:	57                   	push   %edi
+  80110e:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80110f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801114:	8b 55 08             	mov    0x8(%ebp),%edx
+  801117:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80111a:	b8 08 00 00 00       	mov    $0x8,%eax
+  80111f:	89 df                	mov    %ebx,%edi
+  801121:	6a 00                	push   $0x0
+  801123:	55                   	push   %ebp
+  801124:	56                   	push   %esi
+  801125:	89 e5                	mov    %esp,%ebp
+  801127:	8d 35 2f 11 80 00    	lea    0x80112f,%esi
+  80112d:	0f 34                	sysenter
+
+0080112f <after_sysenter_label_808>:
+  80112f:	5e                   	pop    %esi
+  801130:	5d                   	pop    %ebp
+  801131:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801134:	85 c0                	test   %eax,%eax
+  801136:	7f 07                	jg     80113f <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801138:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80113b:	5b                   	pop    %ebx
+  80113c:	5f                   	pop    %edi
+  80113d:	5d                   	pop    %ebp
+  80113e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80113f:	83 ec 0c             	sub    $0xc,%esp
+  801142:	50                   	push   %eax
+  801143:	6a 08                	push   $0x8
+  801145:	68 15 55 80 00       	push   $0x805515
+  80114a:	6a 54                	push   $0x54
+  80114c:	68 32 55 80 00       	push   $0x805532
+  801151:	e8 d2 f3 ff ff       	call   800528 <_panic>
+
+00801156 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801156:	55                   	push   %ebp
+  801157:	89 e5                	mov    %esp,%ebp
+  801159:	57                   	push   %edi
+  80115a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80115b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801160:	8b 55 08             	mov    0x8(%ebp),%edx
+  801163:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801166:	b8 09 00 00 00       	mov    $0x9,%eax
+  80116b:	89 df                	mov    %ebx,%edi
+  80116d:	6a 00                	push   $0x0
+  80116f:	55                   	push   %ebp
+  801170:	56                   	push   %esi
+  801171:	89 e5                	mov    %esp,%ebp
+  801173:	8d 35 7b 11 80 00    	lea    0x80117b,%esi
+  801179:	0f 34                	sysenter
+
+0080117b <after_sysenter_label_912>:
+  80117b:	5e                   	pop    %esi
+  80117c:	5d                   	pop    %ebp
+  80117d:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801180:	85 c0                	test   %eax,%eax
+  801182:	7f 07                	jg     80118b <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801184:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801187:	5b                   	pop    %ebx
+  801188:	5f                   	pop    %edi
+  801189:	5d                   	pop    %ebp
+  80118a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80118b:	83 ec 0c             	sub    $0xc,%esp
+  80118e:	50                   	push   %eax
+  80118f:	6a 09                	push   $0x9
+  801191:	68 15 55 80 00       	push   $0x805515
+  801196:	6a 54                	push   $0x54
+  801198:	68 32 55 80 00       	push   $0x805532
+  80119d:	e8 86 f3 ff ff       	call   800528 <_panic>
+
+008011a2 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8011a2:	55                   	push   %ebp
+  8011a3:	89 e5                	mov    %esp,%ebp
+  8011a5:	57                   	push   %edi
+  8011a6:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8011a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011b2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8011b7:	89 df                	mov    %ebx,%edi
+  8011b9:	6a 00                	push   $0x0
+  8011bb:	55                   	push   %ebp
+  8011bc:	56                   	push   %esi
+  8011bd:	89 e5                	mov    %esp,%ebp
+  8011bf:	8d 35 c7 11 80 00    	lea    0x8011c7,%esi
+  8011c5:	0f 34                	sysenter
+
+008011c7 <after_sysenter_label_1016>:
+  8011c7:	5e                   	pop    %esi
+  8011c8:	5d                   	pop    %ebp
+  8011c9:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8011cc:	85 c0                	test   %eax,%eax
+  8011ce:	7f 07                	jg     8011d7 <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8011d0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8011d3:	5b                   	pop    %ebx
+  8011d4:	5f                   	pop    %edi
+  8011d5:	5d                   	pop    %ebp
+  8011d6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011d7:	83 ec 0c             	sub    $0xc,%esp
+  8011da:	50                   	push   %eax
+  8011db:	6a 0a                	push   $0xa
+  8011dd:	68 15 55 80 00       	push   $0x805515
+  8011e2:	6a 54                	push   $0x54
+  8011e4:	68 32 55 80 00       	push   $0x805532
+  8011e9:	e8 3a f3 ff ff       	call   800528 <_panic>
+
+008011ee <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8011ee:	55                   	push   %ebp
+  8011ef:	89 e5                	mov    %esp,%ebp
+  8011f1:	57                   	push   %edi
+  8011f2:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8011f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011f6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011f9:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011fe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801201:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801204:	6a 00                	push   $0x0
+  801206:	55                   	push   %ebp
+  801207:	56                   	push   %esi
+  801208:	89 e5                	mov    %esp,%ebp
+  80120a:	8d 35 12 12 80 00    	lea    0x801212,%esi
+  801210:	0f 34                	sysenter
+
+00801212 <after_sysenter_label_1126>:
+  801212:	5e                   	pop    %esi
+  801213:	5d                   	pop    %ebp
+  801214:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801217:	5b                   	pop    %ebx
+  801218:	5f                   	pop    %edi
+  801219:	5d                   	pop    %ebp
+  80121a:	c3                   	ret
+
+0080121b <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80121b:	55                   	push   %ebp
+  80121c:	89 e5                	mov    %esp,%ebp
+  80121e:	57                   	push   %edi
+  80121f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801220:	8b 55 08             	mov    0x8(%ebp),%edx
+  801223:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801228:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80122d:	89 cb                	mov    %ecx,%ebx
+  80122f:	89 cf                	mov    %ecx,%edi
+  801231:	6a 00                	push   $0x0
+  801233:	55                   	push   %ebp
+  801234:	56                   	push   %esi
+  801235:	89 e5                	mov    %esp,%ebp
+  801237:	8d 35 3f 12 80 00    	lea    0x80123f,%esi
+  80123d:	0f 34                	sysenter
+
+0080123f <after_sysenter_label_1210>:
+  80123f:	5e                   	pop    %esi
+  801240:	5d                   	pop    %ebp
+  801241:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801244:	85 c0                	test   %eax,%eax
+  801246:	7f 07                	jg     80124f <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801248:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80124b:	5b                   	pop    %ebx
+  80124c:	5f                   	pop    %edi
+  80124d:	5d                   	pop    %ebp
+  80124e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80124f:	83 ec 0c             	sub    $0xc,%esp
+  801252:	50                   	push   %eax
+  801253:	6a 0d                	push   $0xd
+  801255:	68 15 55 80 00       	push   $0x805515
+  80125a:	6a 54                	push   $0x54
+  80125c:	68 32 55 80 00       	push   $0x805532
+  801261:	e8 c2 f2 ff ff       	call   800528 <_panic>
+
+00801266 <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  801266:	55                   	push   %ebp
+  801267:	89 e5                	mov    %esp,%ebp
+  801269:	57                   	push   %edi
+  80126a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80126b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801270:	8b 55 08             	mov    0x8(%ebp),%edx
+  801273:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801276:	b8 42 00 00 00       	mov    $0x42,%eax
+  80127b:	89 df                	mov    %ebx,%edi
+  80127d:	6a 00                	push   $0x0
+  80127f:	55                   	push   %ebp
+  801280:	56                   	push   %esi
+  801281:	89 e5                	mov    %esp,%ebp
+  801283:	8d 35 8b 12 80 00    	lea    0x80128b,%esi
+  801289:	0f 34                	sysenter
+
+0080128b <after_sysenter_label_1311>:
+  80128b:	5e                   	pop    %esi
+  80128c:	5d                   	pop    %ebp
+  80128d:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801290:	85 c0                	test   %eax,%eax
+  801292:	7f 07                	jg     80129b <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  801294:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801297:	5b                   	pop    %ebx
+  801298:	5f                   	pop    %edi
+  801299:	5d                   	pop    %ebp
+  80129a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80129b:	83 ec 0c             	sub    $0xc,%esp
+  80129e:	50                   	push   %eax
+  80129f:	6a 42                	push   $0x42
+  8012a1:	68 15 55 80 00       	push   $0x805515
+  8012a6:	6a 54                	push   $0x54
+  8012a8:	68 32 55 80 00       	push   $0x805532
+  8012ad:	e8 76 f2 ff ff       	call   800528 <_panic>
+
+008012b2 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8012b2:	55                   	push   %ebp
+  8012b3:	89 e5                	mov    %esp,%ebp
+  8012b5:	57                   	push   %edi
+  8012b6:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8012b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012bc:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8012c1:	89 d1                	mov    %edx,%ecx
+  8012c3:	89 d3                	mov    %edx,%ebx
+  8012c5:	89 d7                	mov    %edx,%edi
+  8012c7:	6a 00                	push   $0x0
+  8012c9:	55                   	push   %ebp
+  8012ca:	56                   	push   %esi
+  8012cb:	89 e5                	mov    %esp,%ebp
+  8012cd:	8d 35 d5 12 80 00    	lea    0x8012d5,%esi
+  8012d3:	0f 34                	sysenter
+
+008012d5 <after_sysenter_label_1411>:
+  8012d5:	5e                   	pop    %esi
+  8012d6:	5d                   	pop    %ebp
+  8012d7:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8012da:	5b                   	pop    %ebx
+  8012db:	5f                   	pop    %edi
+  8012dc:	5d                   	pop    %ebp
+  8012dd:	c3                   	ret
+
+008012de <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  8012de:	55                   	push   %ebp
+  8012df:	89 e5                	mov    %esp,%ebp
+  8012e1:	57                   	push   %edi
+  8012e2:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8012e3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012e8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012eb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012ee:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8012f3:	89 df                	mov    %ebx,%edi
+  8012f5:	6a 00                	push   $0x0
+  8012f7:	55                   	push   %ebp
+  8012f8:	56                   	push   %esi
+  8012f9:	89 e5                	mov    %esp,%ebp
+  8012fb:	8d 35 03 13 80 00    	lea    0x801303,%esi
+  801301:	0f 34                	sysenter
+
+00801303 <after_sysenter_label_1497>:
+  801303:	5e                   	pop    %esi
+  801304:	5d                   	pop    %ebp
+  801305:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  801308:	5b                   	pop    %ebx
+  801309:	5f                   	pop    %edi
+  80130a:	5d                   	pop    %ebp
+  80130b:	c3                   	ret
+
+0080130c <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  80130c:	55                   	push   %ebp
+  80130d:	89 e5                	mov    %esp,%ebp
+  80130f:	57                   	push   %edi
+  801310:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801311:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801316:	8b 55 08             	mov    0x8(%ebp),%edx
+  801319:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80131c:	b8 10 00 00 00       	mov    $0x10,%eax
+  801321:	89 df                	mov    %ebx,%edi
+  801323:	6a 00                	push   $0x0
+  801325:	55                   	push   %ebp
+  801326:	56                   	push   %esi
+  801327:	89 e5                	mov    %esp,%ebp
+  801329:	8d 35 31 13 80 00    	lea    0x801331,%esi
+  80132f:	0f 34                	sysenter
+
+00801331 <after_sysenter_label_1583>:
+  801331:	5e                   	pop    %esi
+  801332:	5d                   	pop    %ebp
+  801333:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  801336:	5b                   	pop    %ebx
+  801337:	5f                   	pop    %edi
+  801338:	5d                   	pop    %ebp
+  801339:	c3                   	ret
+
+0080133a <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  80133a:	55                   	push   %ebp
+  80133b:	89 e5                	mov    %esp,%ebp
+  80133d:	57                   	push   %edi
+  80133e:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80133f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801342:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801345:	b8 11 00 00 00       	mov    $0x11,%eax
+  80134a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80134f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801352:	6a 00                	push   $0x0
+  801354:	55                   	push   %ebp
+  801355:	56                   	push   %esi
+  801356:	89 e5                	mov    %esp,%ebp
+  801358:	8d 35 60 13 80 00    	lea    0x801360,%esi
+  80135e:	0f 34                	sysenter
+
+00801360 <after_sysenter_label_1672>:
+  801360:	5e                   	pop    %esi
+  801361:	5d                   	pop    %ebp
+  801362:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  801365:	5b                   	pop    %ebx
+  801366:	5f                   	pop    %edi
+  801367:	5d                   	pop    %ebp
+  801368:	c3                   	ret
+
+00801369 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  801369:	55                   	push   %ebp
+  80136a:	89 e5                	mov    %esp,%ebp
+  80136c:	57                   	push   %edi
+  80136d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80136e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801373:	8b 55 08             	mov    0x8(%ebp),%edx
+  801376:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801379:	b8 12 00 00 00       	mov    $0x12,%eax
+  80137e:	89 df                	mov    %ebx,%edi
+  801380:	6a 00                	push   $0x0
+  801382:	55                   	push   %ebp
+  801383:	56                   	push   %esi
+  801384:	89 e5                	mov    %esp,%ebp
+  801386:	8d 35 8e 13 80 00    	lea    0x80138e,%esi
+  80138c:	0f 34                	sysenter
+
+0080138e <after_sysenter_label_1758>:
+  80138e:	5e                   	pop    %esi
+  80138f:	5d                   	pop    %ebp
+  801390:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  801393:	5b                   	pop    %ebx
+  801394:	5f                   	pop    %edi
+  801395:	5d                   	pop    %ebp
+  801396:	c3                   	ret
+
+00801397 <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  801397:	55                   	push   %ebp
+  801398:	89 e5                	mov    %esp,%ebp
+  80139a:	57                   	push   %edi
+  80139b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80139c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80139f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013a4:	b8 13 00 00 00       	mov    $0x13,%eax
+  8013a9:	89 cb                	mov    %ecx,%ebx
+  8013ab:	89 cf                	mov    %ecx,%edi
+  8013ad:	6a 00                	push   $0x0
+  8013af:	55                   	push   %ebp
+  8013b0:	56                   	push   %esi
+  8013b1:	89 e5                	mov    %esp,%ebp
+  8013b3:	8d 35 bb 13 80 00    	lea    0x8013bb,%esi
+  8013b9:	0f 34                	sysenter
+
+008013bb <after_sysenter_label_1842>:
+  8013bb:	5e                   	pop    %esi
+  8013bc:	5d                   	pop    %ebp
+  8013bd:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8013c0:	85 c0                	test   %eax,%eax
+  8013c2:	7f 07                	jg     8013cb <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  8013c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013c7:	5b                   	pop    %ebx
+  8013c8:	5f                   	pop    %edi
+  8013c9:	5d                   	pop    %ebp
+  8013ca:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013cb:	83 ec 0c             	sub    $0xc,%esp
+  8013ce:	50                   	push   %eax
+  8013cf:	6a 13                	push   $0x13
+  8013d1:	68 15 55 80 00       	push   $0x805515
+  8013d6:	6a 54                	push   $0x54
+  8013d8:	68 32 55 80 00       	push   $0x805532
+  8013dd:	e8 46 f1 ff ff       	call   800528 <_panic>
+
+008013e2 <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  8013e2:	55                   	push   %ebp
+  8013e3:	89 e5                	mov    %esp,%ebp
+  8013e5:	57                   	push   %edi
+  8013e6:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8013e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013ec:	b8 14 00 00 00       	mov    $0x14,%eax
+  8013f1:	89 d1                	mov    %edx,%ecx
+  8013f3:	89 d3                	mov    %edx,%ebx
+  8013f5:	89 d7                	mov    %edx,%edi
+  8013f7:	6a 00                	push   $0x0
+  8013f9:	55                   	push   %ebp
+  8013fa:	56                   	push   %esi
+  8013fb:	89 e5                	mov    %esp,%ebp
+  8013fd:	8d 35 05 14 80 00    	lea    0x801405,%esi
+  801403:	0f 34                	sysenter
+
+00801405 <after_sysenter_label_1939>:
+  801405:	5e                   	pop    %esi
+  801406:	5d                   	pop    %ebp
+  801407:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  80140a:	5b                   	pop    %ebx
+  80140b:	5f                   	pop    %edi
+  80140c:	5d                   	pop    %ebp
+  80140d:	c3                   	ret
+
+0080140e <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  80140e:	55                   	push   %ebp
+  80140f:	89 e5                	mov    %esp,%ebp
+  801411:	57                   	push   %edi
+  801412:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801413:	8b 55 08             	mov    0x8(%ebp),%edx
+  801416:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801419:	b8 15 00 00 00       	mov    $0x15,%eax
+  80141e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801423:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801426:	6a 00                	push   $0x0
+  801428:	55                   	push   %ebp
+  801429:	56                   	push   %esi
+  80142a:	89 e5                	mov    %esp,%ebp
+  80142c:	8d 35 34 14 80 00    	lea    0x801434,%esi
+  801432:	0f 34                	sysenter
+
+00801434 <after_sysenter_label_2028>:
+  801434:	5e                   	pop    %esi
+  801435:	5d                   	pop    %ebp
+  801436:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  801439:	5b                   	pop    %ebx
+  80143a:	5f                   	pop    %edi
+  80143b:	5d                   	pop    %ebp
+  80143c:	c3                   	ret
+
+0080143d <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  80143d:	55                   	push   %ebp
+  80143e:	89 e5                	mov    %esp,%ebp
+  801440:	57                   	push   %edi
+  801441:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801442:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801447:	8b 55 08             	mov    0x8(%ebp),%edx
+  80144a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80144d:	b8 16 00 00 00       	mov    $0x16,%eax
+  801452:	89 df                	mov    %ebx,%edi
+  801454:	6a 00                	push   $0x0
+  801456:	55                   	push   %ebp
+  801457:	56                   	push   %esi
+  801458:	89 e5                	mov    %esp,%ebp
+  80145a:	8d 35 62 14 80 00    	lea    0x801462,%esi
+  801460:	0f 34                	sysenter
+
+00801462 <after_sysenter_label_2114>:
+  801462:	5e                   	pop    %esi
+  801463:	5d                   	pop    %ebp
+  801464:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  801467:	5b                   	pop    %ebx
+  801468:	5f                   	pop    %edi
+  801469:	5d                   	pop    %ebp
+  80146a:	c3                   	ret
+
+0080146b <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  80146b:	55                   	push   %ebp
+  80146c:	89 e5                	mov    %esp,%ebp
+  80146e:	57                   	push   %edi
+  80146f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801470:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801475:	8b 55 08             	mov    0x8(%ebp),%edx
+  801478:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80147b:	b8 17 00 00 00       	mov    $0x17,%eax
+  801480:	89 df                	mov    %ebx,%edi
+  801482:	6a 00                	push   $0x0
+  801484:	55                   	push   %ebp
+  801485:	56                   	push   %esi
+  801486:	89 e5                	mov    %esp,%ebp
+  801488:	8d 35 90 14 80 00    	lea    0x801490,%esi
+  80148e:	0f 34                	sysenter
+
+00801490 <after_sysenter_label_2200>:
+  801490:	5e                   	pop    %esi
+  801491:	5d                   	pop    %ebp
+  801492:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  801495:	5b                   	pop    %ebx
+  801496:	5f                   	pop    %edi
+  801497:	5d                   	pop    %ebp
+  801498:	c3                   	ret
+
+00801499 <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  801499:	55                   	push   %ebp
+  80149a:	89 e5                	mov    %esp,%ebp
+  80149c:	57                   	push   %edi
+  80149d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80149e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014a6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014a9:	b8 18 00 00 00       	mov    $0x18,%eax
+  8014ae:	89 df                	mov    %ebx,%edi
+  8014b0:	6a 00                	push   $0x0
+  8014b2:	55                   	push   %ebp
+  8014b3:	56                   	push   %esi
+  8014b4:	89 e5                	mov    %esp,%ebp
+  8014b6:	8d 35 be 14 80 00    	lea    0x8014be,%esi
+  8014bc:	0f 34                	sysenter
+
+008014be <after_sysenter_label_2286>:
+  8014be:	5e                   	pop    %esi
+  8014bf:	5d                   	pop    %ebp
+  8014c0:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  8014c3:	5b                   	pop    %ebx
+  8014c4:	5f                   	pop    %edi
+  8014c5:	5d                   	pop    %ebp
+  8014c6:	c3                   	ret
+
+008014c7 <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  8014c7:	55                   	push   %ebp
+  8014c8:	89 e5                	mov    %esp,%ebp
+  8014ca:	57                   	push   %edi
+  8014cb:	56                   	push   %esi
+  8014cc:	53                   	push   %ebx
+  8014cd:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  8014d0:	89 d6                	mov    %edx,%esi
+  8014d2:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  8014d5:	89 cf                	mov    %ecx,%edi
+  8014d7:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  8014da:	89 fa                	mov    %edi,%edx
+  8014dc:	80 ce 08             	or     $0x8,%dh
+  8014df:	f6 c5 08             	test   $0x8,%ch
+  8014e2:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  8014e5:	57                   	push   %edi
+  8014e6:	56                   	push   %esi
+  8014e7:	50                   	push   %eax
+  8014e8:	56                   	push   %esi
+  8014e9:	6a 00                	push   $0x0
+  8014eb:	e8 82 fb ff ff       	call   801072 <sys_page_map>
+	if (r < 0) {
+  8014f0:	83 c4 20             	add    $0x20,%esp
+  8014f3:	85 c0                	test   %eax,%eax
+  8014f5:	78 27                	js     80151e <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  8014f7:	83 ec 0c             	sub    $0xc,%esp
+  8014fa:	57                   	push   %edi
+  8014fb:	56                   	push   %esi
+  8014fc:	6a 00                	push   $0x0
+  8014fe:	56                   	push   %esi
+  8014ff:	6a 00                	push   $0x0
+  801501:	e8 6c fb ff ff       	call   801072 <sys_page_map>
+  801506:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  801508:	83 c4 20             	add    $0x20,%esp
+  80150b:	85 c0                	test   %eax,%eax
+  80150d:	78 24                	js     801533 <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  80150f:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  801514:	89 d8                	mov    %ebx,%eax
+  801516:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801519:	5b                   	pop    %ebx
+  80151a:	5e                   	pop    %esi
+  80151b:	5f                   	pop    %edi
+  80151c:	5d                   	pop    %ebp
+  80151d:	c3                   	ret
+  80151e:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  801520:	83 ec 08             	sub    $0x8,%esp
+  801523:	50                   	push   %eax
+  801524:	68 40 55 80 00       	push   $0x805540
+  801529:	e8 d5 f0 ff ff       	call   800603 <cprintf>
+		return r;
+  80152e:	83 c4 10             	add    $0x10,%esp
+  801531:	eb e1                	jmp    801514 <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  801533:	83 ec 08             	sub    $0x8,%esp
+  801536:	50                   	push   %eax
+  801537:	68 70 55 80 00       	push   $0x805570
+  80153c:	e8 c2 f0 ff ff       	call   800603 <cprintf>
+		return r;
+  801541:	83 c4 10             	add    $0x10,%esp
+  801544:	eb ce                	jmp    801514 <duppage_cow+0x4d>
+
+00801546 <duppage>:
+{
+  801546:	55                   	push   %ebp
+  801547:	89 e5                	mov    %esp,%ebp
+  801549:	53                   	push   %ebx
+  80154a:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  80154d:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  801550:	51                   	push   %ecx
+  801551:	52                   	push   %edx
+  801552:	50                   	push   %eax
+  801553:	52                   	push   %edx
+  801554:	6a 00                	push   $0x0
+  801556:	e8 17 fb ff ff       	call   801072 <sys_page_map>
+	if (r < 0) {
+  80155b:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  80155e:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  801563:	85 c0                	test   %eax,%eax
+  801565:	78 07                	js     80156e <duppage+0x28>
+}
+  801567:	89 d8                	mov    %ebx,%eax
+  801569:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80156c:	c9                   	leave
+  80156d:	c3                   	ret
+  80156e:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  801570:	83 ec 08             	sub    $0x8,%esp
+  801573:	50                   	push   %eax
+  801574:	68 40 55 80 00       	push   $0x805540
+  801579:	e8 85 f0 ff ff       	call   800603 <cprintf>
+		return r;
+  80157e:	83 c4 10             	add    $0x10,%esp
+  801581:	eb e4                	jmp    801567 <duppage+0x21>
+
+00801583 <cow_copy>:
+{
+  801583:	55                   	push   %ebp
+  801584:	89 e5                	mov    %esp,%ebp
+  801586:	56                   	push   %esi
+  801587:	53                   	push   %ebx
+  801588:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  80158a:	83 ec 04             	sub    $0x4,%esp
+  80158d:	6a 07                	push   $0x7
+  80158f:	68 00 f0 7f 00       	push   $0x7ff000
+  801594:	6a 00                	push   $0x0
+  801596:	e8 8a fa ff ff       	call   801025 <sys_page_alloc>
+	if (r < 0) {
+  80159b:	83 c4 10             	add    $0x10,%esp
+  80159e:	85 c0                	test   %eax,%eax
+  8015a0:	78 58                	js     8015fa <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  8015a2:	83 ec 04             	sub    $0x4,%esp
+  8015a5:	68 00 10 00 00       	push   $0x1000
+  8015aa:	56                   	push   %esi
+  8015ab:	68 00 f0 7f 00       	push   $0x7ff000
+  8015b0:	e8 b8 f7 ff ff       	call   800d6d <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  8015b5:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8015bc:	56                   	push   %esi
+  8015bd:	6a 00                	push   $0x0
+  8015bf:	68 00 f0 7f 00       	push   $0x7ff000
+  8015c4:	6a 00                	push   $0x0
+  8015c6:	e8 a7 fa ff ff       	call   801072 <sys_page_map>
+  8015cb:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  8015cd:	83 c4 20             	add    $0x20,%esp
+  8015d0:	85 c0                	test   %eax,%eax
+  8015d2:	78 3b                	js     80160f <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  8015d4:	83 ec 08             	sub    $0x8,%esp
+  8015d7:	68 00 f0 7f 00       	push   $0x7ff000
+  8015dc:	6a 00                	push   $0x0
+  8015de:	e8 db fa ff ff       	call   8010be <sys_page_unmap>
+  8015e3:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  8015e5:	83 c4 10             	add    $0x10,%esp
+  8015e8:	85 c0                	test   %eax,%eax
+  8015ea:	78 45                	js     801631 <cow_copy+0xae>
+	return 0;
+  8015ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8015f1:	89 d8                	mov    %ebx,%eax
+  8015f3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015f6:	5b                   	pop    %ebx
+  8015f7:	5e                   	pop    %esi
+  8015f8:	5d                   	pop    %ebp
+  8015f9:	c3                   	ret
+  8015fa:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  8015fc:	83 ec 08             	sub    $0x8,%esp
+  8015ff:	50                   	push   %eax
+  801600:	68 60 56 80 00       	push   $0x805660
+  801605:	e8 f9 ef ff ff       	call   800603 <cprintf>
+		return r;
+  80160a:	83 c4 10             	add    $0x10,%esp
+  80160d:	eb e2                	jmp    8015f1 <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  80160f:	83 ec 08             	sub    $0x8,%esp
+  801612:	50                   	push   %eax
+  801613:	68 7c 56 80 00       	push   $0x80567c
+  801618:	e8 e6 ef ff ff       	call   800603 <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  80161d:	83 c4 08             	add    $0x8,%esp
+  801620:	68 00 f0 7f 00       	push   $0x7ff000
+  801625:	6a 00                	push   $0x0
+  801627:	e8 92 fa ff ff       	call   8010be <sys_page_unmap>
+		return r;
+  80162c:	83 c4 10             	add    $0x10,%esp
+  80162f:	eb c0                	jmp    8015f1 <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  801631:	83 ec 08             	sub    $0x8,%esp
+  801634:	50                   	push   %eax
+  801635:	68 98 55 80 00       	push   $0x805598
+  80163a:	e8 c4 ef ff ff       	call   800603 <cprintf>
+		return r;
+  80163f:	83 c4 10             	add    $0x10,%esp
+  801642:	eb ad                	jmp    8015f1 <cow_copy+0x6e>
+
+00801644 <pgfault>:
+{
+  801644:	55                   	push   %ebp
+  801645:	89 e5                	mov    %esp,%ebp
+  801647:	56                   	push   %esi
+  801648:	53                   	push   %ebx
+  801649:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  80164c:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  80164e:	89 d8                	mov    %ebx,%eax
+  801650:	c1 e8 16             	shr    $0x16,%eax
+  801653:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  80165a:	89 de                	mov    %ebx,%esi
+  80165c:	c1 ee 0c             	shr    $0xc,%esi
+  80165f:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  801666:	a8 07                	test   $0x7,%al
+  801668:	74 3b                	je     8016a5 <pgfault+0x61>
+  80166a:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  801670:	74 33                	je     8016a5 <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  801672:	83 ec 0c             	sub    $0xc,%esp
+  801675:	68 00 f0 bf ee       	push   $0xeebff000
+  80167a:	e8 ea 2c 00 00       	call   804369 <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  80167f:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  801686:	83 c4 10             	add    $0x10,%esp
+  801689:	f6 c4 08             	test   $0x8,%ah
+  80168c:	75 30                	jne    8016be <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  80168e:	83 ec 0c             	sub    $0xc,%esp
+  801691:	68 00 f0 bf ee       	push   $0xeebff000
+  801696:	e8 3b 2d 00 00       	call   8043d6 <mutex_unlock>
+}
+  80169b:	83 c4 10             	add    $0x10,%esp
+  80169e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016a1:	5b                   	pop    %ebx
+  8016a2:	5e                   	pop    %esi
+  8016a3:	5d                   	pop    %ebp
+  8016a4:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  8016a5:	83 ec 08             	sub    $0x8,%esp
+  8016a8:	ff 72 28             	push   0x28(%edx)
+  8016ab:	51                   	push   %ecx
+  8016ac:	50                   	push   %eax
+  8016ad:	68 bc 55 80 00       	push   $0x8055bc
+  8016b2:	6a 3f                	push   $0x3f
+  8016b4:	68 96 56 80 00       	push   $0x805696
+  8016b9:	e8 6a ee ff ff       	call   800528 <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  8016be:	89 d8                	mov    %ebx,%eax
+  8016c0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  8016c5:	e8 b9 fe ff ff       	call   801583 <cow_copy>
+  8016ca:	eb c2                	jmp    80168e <pgfault+0x4a>
+
+008016cc <cow_enable>:
+{
+  8016cc:	55                   	push   %ebp
+  8016cd:	89 e5                	mov    %esp,%ebp
+  8016cf:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  8016d2:	68 44 16 80 00       	push   $0x801644
+  8016d7:	e8 99 34 00 00       	call   804b75 <set_pgfault_handler>
+}
+  8016dc:	83 c4 10             	add    $0x10,%esp
+  8016df:	c9                   	leave
+  8016e0:	c3                   	ret
+
+008016e1 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  8016e1:	55                   	push   %ebp
+  8016e2:	89 e5                	mov    %esp,%ebp
+  8016e4:	57                   	push   %edi
+  8016e5:	56                   	push   %esi
+  8016e6:	53                   	push   %ebx
+  8016e7:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  8016ea:	68 44 16 80 00       	push   $0x801644
+  8016ef:	e8 81 34 00 00       	call   804b75 <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  8016f4:	b8 07 00 00 00       	mov    $0x7,%eax
+  8016f9:	cd 30                	int    $0x30
+  8016fb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  8016fe:	83 c4 10             	add    $0x10,%esp
+  801701:	85 c0                	test   %eax,%eax
+  801703:	78 4b                	js     801750 <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  801705:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80170a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80170f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  801712:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  801716:	0f 85 16 01 00 00    	jne    801832 <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80171c:	e8 ac f8 ff ff       	call   800fcd <sys_getenvid>
+  801721:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801726:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801728:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  80172e:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  801734:	77 32                	ja     801768 <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801736:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  80173b:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  80173d:	c1 ea 10             	shr    $0x10,%edx
+  801740:	74 26                	je     801768 <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801742:	c1 e2 10             	shl    $0x10,%edx
+  801745:	89 d1                	mov    %edx,%ecx
+  801747:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80174c:	29 ca                	sub    %ecx,%edx
+  80174e:	eb 1e                	jmp    80176e <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  801750:	83 ec 08             	sub    $0x8,%esp
+  801753:	89 c7                	mov    %eax,%edi
+  801755:	50                   	push   %eax
+  801756:	68 a1 56 80 00       	push   $0x8056a1
+  80175b:	e8 a3 ee ff ff       	call   800603 <cprintf>
+		return eid;
+  801760:	83 c4 10             	add    $0x10,%esp
+  801763:	e9 6c 01 00 00       	jmp    8018d4 <fork+0x1f3>
+		return pthread_main_tls;
+  801768:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80176e:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  801771:	c1 e0 04             	shl    $0x4,%eax
+  801774:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801779:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  80177b:	e8 32 33 00 00       	call   804ab2 <pthread_fork_child>
+		return eid;
+  801780:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801783:	e9 4c 01 00 00       	jmp    8018d4 <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  801788:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  80178e:	89 da                	mov    %ebx,%edx
+  801790:	89 f8                	mov    %edi,%eax
+  801792:	e8 af fd ff ff       	call   801546 <duppage>
+  801797:	85 c0                	test   %eax,%eax
+  801799:	79 28                	jns    8017c3 <fork+0xe2>
+  80179b:	89 c7                	mov    %eax,%edi
+  80179d:	e9 32 01 00 00       	jmp    8018d4 <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  8017a2:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8017a8:	83 f9 05             	cmp    $0x5,%ecx
+  8017ab:	75 58                	jne    801805 <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8017ad:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8017b2:	89 da                	mov    %ebx,%edx
+  8017b4:	89 f8                	mov    %edi,%eax
+  8017b6:	e8 8b fd ff ff       	call   801546 <duppage>
+  8017bb:	85 c0                	test   %eax,%eax
+  8017bd:	0f 88 0f 01 00 00    	js     8018d2 <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  8017c3:	83 c3 01             	add    $0x1,%ebx
+  8017c6:	39 de                	cmp    %ebx,%esi
+  8017c8:	74 54                	je     80181e <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  8017ca:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  8017d1:	f6 c1 05             	test   $0x5,%cl
+  8017d4:	74 ed                	je     8017c3 <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  8017d6:	f6 c5 04             	test   $0x4,%ch
+  8017d9:	75 ad                	jne    801788 <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  8017db:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  8017e1:	74 bf                	je     8017a2 <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  8017e3:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8017e9:	74 d8                	je     8017c3 <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  8017eb:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  8017f1:	89 da                	mov    %ebx,%edx
+  8017f3:	89 f8                	mov    %edi,%eax
+  8017f5:	e8 cd fc ff ff       	call   8014c7 <duppage_cow>
+  8017fa:	85 c0                	test   %eax,%eax
+  8017fc:	79 c5                	jns    8017c3 <fork+0xe2>
+  8017fe:	89 c7                	mov    %eax,%edi
+  801800:	e9 cf 00 00 00       	jmp    8018d4 <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  801805:	68 ec 55 80 00       	push   $0x8055ec
+  80180a:	68 b1 56 80 00       	push   $0x8056b1
+  80180f:	68 c6 00 00 00       	push   $0xc6
+  801814:	68 96 56 80 00       	push   $0x805696
+  801819:	e8 0a ed ff ff       	call   800528 <_panic>
+  80181e:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  801821:	83 c1 01             	add    $0x1,%ecx
+  801824:	81 c6 00 04 00 00    	add    $0x400,%esi
+  80182a:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  801830:	74 18                	je     80184a <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  801832:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  801839:	a8 07                	test   $0x7,%al
+  80183b:	74 e4                	je     801821 <fork+0x140>
+  80183d:	89 cb                	mov    %ecx,%ebx
+  80183f:	c1 e3 0a             	shl    $0xa,%ebx
+  801842:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801845:	e9 7c ff ff ff       	jmp    8017c6 <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  80184a:	83 ec 04             	sub    $0x4,%esp
+  80184d:	6a 07                	push   $0x7
+  80184f:	68 00 f0 bf ee       	push   $0xeebff000
+  801854:	ff 75 e4             	push   -0x1c(%ebp)
+  801857:	e8 c9 f7 ff ff       	call   801025 <sys_page_alloc>
+  80185c:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80185e:	83 c4 10             	add    $0x10,%esp
+  801861:	85 c0                	test   %eax,%eax
+  801863:	78 34                	js     801899 <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  801865:	83 ec 08             	sub    $0x8,%esp
+  801868:	68 b3 4b 80 00       	push   $0x804bb3
+  80186d:	ff 75 e4             	push   -0x1c(%ebp)
+  801870:	e8 2d f9 ff ff       	call   8011a2 <sys_env_set_pgfault_upcall>
+  801875:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801877:	83 c4 10             	add    $0x10,%esp
+  80187a:	85 c0                	test   %eax,%eax
+  80187c:	78 2e                	js     8018ac <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  80187e:	83 ec 08             	sub    $0x8,%esp
+  801881:	6a 02                	push   $0x2
+  801883:	ff 75 e4             	push   -0x1c(%ebp)
+  801886:	e8 7f f8 ff ff       	call   80110a <sys_env_set_status>
+  80188b:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80188d:	83 c4 10             	add    $0x10,%esp
+  801890:	85 c0                	test   %eax,%eax
+  801892:	78 2b                	js     8018bf <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  801894:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801897:	eb 3b                	jmp    8018d4 <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  801899:	83 ec 08             	sub    $0x8,%esp
+  80189c:	50                   	push   %eax
+  80189d:	68 14 56 80 00       	push   $0x805614
+  8018a2:	e8 5c ed ff ff       	call   800603 <cprintf>
+		return r;
+  8018a7:	83 c4 10             	add    $0x10,%esp
+  8018aa:	eb 28                	jmp    8018d4 <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  8018ac:	83 ec 08             	sub    $0x8,%esp
+  8018af:	50                   	push   %eax
+  8018b0:	68 3c 56 80 00       	push   $0x80563c
+  8018b5:	e8 49 ed ff ff       	call   800603 <cprintf>
+		return r;
+  8018ba:	83 c4 10             	add    $0x10,%esp
+  8018bd:	eb 15                	jmp    8018d4 <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  8018bf:	83 ec 08             	sub    $0x8,%esp
+  8018c2:	50                   	push   %eax
+  8018c3:	68 c6 56 80 00       	push   $0x8056c6
+  8018c8:	e8 36 ed ff ff       	call   800603 <cprintf>
+		return r;
+  8018cd:	83 c4 10             	add    $0x10,%esp
+  8018d0:	eb 02                	jmp    8018d4 <fork+0x1f3>
+  8018d2:	89 c7                	mov    %eax,%edi
+}
+  8018d4:	89 f8                	mov    %edi,%eax
+  8018d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018d9:	5b                   	pop    %ebx
+  8018da:	5e                   	pop    %esi
+  8018db:	5f                   	pop    %edi
+  8018dc:	5d                   	pop    %ebp
+  8018dd:	c3                   	ret
+
+008018de <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  8018de:	55                   	push   %ebp
+  8018df:	89 e5                	mov    %esp,%ebp
+  8018e1:	57                   	push   %edi
+  8018e2:	56                   	push   %esi
+  8018e3:	53                   	push   %ebx
+  8018e4:	83 ec 2c             	sub    $0x2c,%esp
+  8018e7:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8018e9:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  8018ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8018f4:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8018fa:	77 0a                	ja     801906 <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8018fc:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  801901:	29 c3                	sub    %eax,%ebx
+  801903:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  801906:	83 ec 0c             	sub    $0xc,%esp
+  801909:	68 44 16 80 00       	push   $0x801644
+  80190e:	e8 62 32 00 00       	call   804b75 <set_pgfault_handler>
+  801913:	b8 07 00 00 00       	mov    $0x7,%eax
+  801918:	cd 30                	int    $0x30
+  80191a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  80191d:	83 c4 10             	add    $0x10,%esp
+  801920:	85 c0                	test   %eax,%eax
+  801922:	78 30                	js     801954 <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  801924:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801928:	74 42                	je     80196c <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  80192a:	c1 e3 10             	shl    $0x10,%ebx
+  80192d:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  801932:	29 d8                	sub    %ebx,%eax
+  801934:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801937:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  80193c:	29 d8                	sub    %ebx,%eax
+  80193e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801941:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  801946:	ba 00 00 00 00       	mov    $0x0,%edx
+  80194b:	89 f7                	mov    %esi,%edi
+  80194d:	89 d6                	mov    %edx,%esi
+  80194f:	e9 2c 01 00 00       	jmp    801a80 <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  801954:	83 ec 08             	sub    $0x8,%esp
+  801957:	89 c7                	mov    %eax,%edi
+  801959:	50                   	push   %eax
+  80195a:	68 a1 56 80 00       	push   $0x8056a1
+  80195f:	e8 9f ec ff ff       	call   800603 <cprintf>
+		return eid;
+  801964:	83 c4 10             	add    $0x10,%esp
+  801967:	e9 d5 00 00 00       	jmp    801a41 <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80196c:	e8 5c f6 ff ff       	call   800fcd <sys_getenvid>
+  801971:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801976:	89 c2                	mov    %eax,%edx
+  801978:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80197a:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  801980:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801985:	77 18                	ja     80199f <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801987:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80198c:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  80198e:	c1 e8 10             	shr    $0x10,%eax
+  801991:	74 0c                	je     80199f <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801993:	c1 e0 10             	shl    $0x10,%eax
+  801996:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80199b:	29 c1                	sub    %eax,%ecx
+  80199d:	eb 06                	jmp    8019a5 <sfork+0xc7>
+		return pthread_main_tls;
+  80199f:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+  8019a5:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8019a8:	c1 e0 04             	shl    $0x4,%eax
+  8019ab:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8019b0:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  8019b2:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8019b5:	e9 87 00 00 00       	jmp    801a41 <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  8019ba:	f6 c5 04             	test   $0x4,%ch
+  8019bd:	74 6c                	je     801a2b <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  8019bf:	89 ca                	mov    %ecx,%edx
+  8019c1:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  8019c7:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  8019cd:	74 7c                	je     801a4b <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8019cf:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8019d5:	89 da                	mov    %ebx,%edx
+  8019d7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8019da:	e8 67 fb ff ff       	call   801546 <duppage>
+  8019df:	85 c0                	test   %eax,%eax
+  8019e1:	0f 88 4f 01 00 00    	js     801b36 <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  8019e7:	83 c3 01             	add    $0x1,%ebx
+  8019ea:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  8019ed:	74 7a                	je     801a69 <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  8019ef:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  8019f1:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  8019f8:	f6 c1 01             	test   $0x1,%cl
+  8019fb:	74 ea                	je     8019e7 <sfork+0x109>
+  8019fd:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  801a03:	74 e2                	je     8019e7 <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  801a05:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  801a0b:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  801a0e:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  801a13:	76 a5                	jbe    8019ba <sfork+0xdc>
+  801a15:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  801a1b:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  801a1e:	39 fa                	cmp    %edi,%edx
+  801a20:	73 9d                	jae    8019bf <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  801a22:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  801a25:	39 fa                	cmp    %edi,%edx
+  801a27:	72 96                	jb     8019bf <sfork+0xe1>
+  801a29:	eb 8f                	jmp    8019ba <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  801a2b:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  801a31:	89 da                	mov    %ebx,%edx
+  801a33:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801a36:	e8 8c fa ff ff       	call   8014c7 <duppage_cow>
+  801a3b:	85 c0                	test   %eax,%eax
+  801a3d:	79 a8                	jns    8019e7 <sfork+0x109>
+  801a3f:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  801a41:	89 f8                	mov    %edi,%eax
+  801a43:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a46:	5b                   	pop    %ebx
+  801a47:	5e                   	pop    %esi
+  801a48:	5f                   	pop    %edi
+  801a49:	5d                   	pop    %ebp
+  801a4a:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  801a4b:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  801a50:	e8 2e fb ff ff       	call   801583 <cow_copy>
+  801a55:	85 c0                	test   %eax,%eax
+  801a57:	0f 88 d2 00 00 00    	js     801b2f <sfork+0x251>
+				pte = uvpt[pn];
+  801a5d:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  801a64:	e9 66 ff ff ff       	jmp    8019cf <sfork+0xf1>
+  801a69:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801a6c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  801a6f:	83 c6 01             	add    $0x1,%esi
+  801a72:	81 c7 00 04 00 00    	add    $0x400,%edi
+  801a78:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  801a7e:	74 1b                	je     801a9b <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  801a80:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  801a87:	a8 01                	test   $0x1,%al
+  801a89:	74 e4                	je     801a6f <sfork+0x191>
+  801a8b:	89 f3                	mov    %esi,%ebx
+  801a8d:	c1 e3 0a             	shl    $0xa,%ebx
+  801a90:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  801a93:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  801a96:	e9 4f ff ff ff       	jmp    8019ea <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  801a9b:	83 ec 04             	sub    $0x4,%esp
+  801a9e:	6a 07                	push   $0x7
+  801aa0:	68 00 f0 bf ee       	push   $0xeebff000
+  801aa5:	ff 75 e0             	push   -0x20(%ebp)
+  801aa8:	e8 78 f5 ff ff       	call   801025 <sys_page_alloc>
+  801aad:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801aaf:	83 c4 10             	add    $0x10,%esp
+  801ab2:	85 c0                	test   %eax,%eax
+  801ab4:	78 37                	js     801aed <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  801ab6:	83 ec 08             	sub    $0x8,%esp
+  801ab9:	68 b3 4b 80 00       	push   $0x804bb3
+  801abe:	ff 75 e0             	push   -0x20(%ebp)
+  801ac1:	e8 dc f6 ff ff       	call   8011a2 <sys_env_set_pgfault_upcall>
+  801ac6:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801ac8:	83 c4 10             	add    $0x10,%esp
+  801acb:	85 c0                	test   %eax,%eax
+  801acd:	78 34                	js     801b03 <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  801acf:	83 ec 08             	sub    $0x8,%esp
+  801ad2:	6a 02                	push   $0x2
+  801ad4:	ff 75 e0             	push   -0x20(%ebp)
+  801ad7:	e8 2e f6 ff ff       	call   80110a <sys_env_set_status>
+  801adc:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  801ade:	83 c4 10             	add    $0x10,%esp
+  801ae1:	85 c0                	test   %eax,%eax
+  801ae3:	78 34                	js     801b19 <sfork+0x23b>
+	return eid;
+  801ae5:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801ae8:	e9 54 ff ff ff       	jmp    801a41 <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  801aed:	83 ec 08             	sub    $0x8,%esp
+  801af0:	50                   	push   %eax
+  801af1:	68 14 56 80 00       	push   $0x805614
+  801af6:	e8 08 eb ff ff       	call   800603 <cprintf>
+		return r;
+  801afb:	83 c4 10             	add    $0x10,%esp
+  801afe:	e9 3e ff ff ff       	jmp    801a41 <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  801b03:	83 ec 08             	sub    $0x8,%esp
+  801b06:	50                   	push   %eax
+  801b07:	68 3c 56 80 00       	push   $0x80563c
+  801b0c:	e8 f2 ea ff ff       	call   800603 <cprintf>
+		return r;
+  801b11:	83 c4 10             	add    $0x10,%esp
+  801b14:	e9 28 ff ff ff       	jmp    801a41 <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  801b19:	83 ec 08             	sub    $0x8,%esp
+  801b1c:	50                   	push   %eax
+  801b1d:	68 c6 56 80 00       	push   $0x8056c6
+  801b22:	e8 dc ea ff ff       	call   800603 <cprintf>
+		return r;
+  801b27:	83 c4 10             	add    $0x10,%esp
+  801b2a:	e9 12 ff ff ff       	jmp    801a41 <sfork+0x163>
+  801b2f:	89 c7                	mov    %eax,%edi
+  801b31:	e9 0b ff ff ff       	jmp    801a41 <sfork+0x163>
+  801b36:	89 c7                	mov    %eax,%edi
+  801b38:	e9 04 ff ff ff       	jmp    801a41 <sfork+0x163>
+
+00801b3d <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801b3d:	55                   	push   %ebp
+  801b3e:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801b40:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b43:	05 00 00 00 30       	add    $0x30000000,%eax
+  801b48:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801b4b:	5d                   	pop    %ebp
+  801b4c:	c3                   	ret
+
+00801b4d <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801b4d:	55                   	push   %ebp
+  801b4e:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801b50:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b53:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801b58:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801b5d:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801b62:	5d                   	pop    %ebp
+  801b63:	c3                   	ret
+
+00801b64 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801b64:	55                   	push   %ebp
+  801b65:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801b67:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801b6c:	eb 02                	jmp    801b70 <fd_alloc+0xc>
+  801b6e:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801b70:	89 c2                	mov    %eax,%edx
+  801b72:	c1 ea 16             	shr    $0x16,%edx
+  801b75:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801b7c:	f6 c2 01             	test   $0x1,%dl
+  801b7f:	74 2b                	je     801bac <fd_alloc+0x48>
+  801b81:	89 c2                	mov    %eax,%edx
+  801b83:	c1 ea 0c             	shr    $0xc,%edx
+  801b86:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801b8d:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801b93:	f6 c1 01             	test   $0x1,%cl
+  801b96:	74 14                	je     801bac <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801b98:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801b9e:	75 ce                	jne    801b6e <fd_alloc+0xa>
+  801ba0:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801ba5:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801baa:	eb 05                	jmp    801bb1 <fd_alloc+0x4d>
+			return 0;
+  801bac:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801bb1:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bb4:	89 02                	mov    %eax,(%edx)
+}
+  801bb6:	89 c8                	mov    %ecx,%eax
+  801bb8:	5d                   	pop    %ebp
+  801bb9:	c3                   	ret
+
+00801bba <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801bba:	55                   	push   %ebp
+  801bbb:	89 e5                	mov    %esp,%ebp
+  801bbd:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801bc0:	83 f8 1f             	cmp    $0x1f,%eax
+  801bc3:	77 30                	ja     801bf5 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801bc5:	c1 e0 0c             	shl    $0xc,%eax
+  801bc8:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801bcd:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801bd3:	f6 c2 01             	test   $0x1,%dl
+  801bd6:	74 24                	je     801bfc <fd_lookup+0x42>
+  801bd8:	89 c2                	mov    %eax,%edx
+  801bda:	c1 ea 0c             	shr    $0xc,%edx
+  801bdd:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801be4:	f6 c2 01             	test   $0x1,%dl
+  801be7:	74 1a                	je     801c03 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801be9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801bec:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801bee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801bf3:	5d                   	pop    %ebp
+  801bf4:	c3                   	ret
+		return -E_INVAL;
+  801bf5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801bfa:	eb f7                	jmp    801bf3 <fd_lookup+0x39>
+		return -E_INVAL;
+  801bfc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c01:	eb f0                	jmp    801bf3 <fd_lookup+0x39>
+  801c03:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c08:	eb e9                	jmp    801bf3 <fd_lookup+0x39>
+
+00801c0a <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801c0a:	55                   	push   %ebp
+  801c0b:	89 e5                	mov    %esp,%ebp
+  801c0d:	53                   	push   %ebx
+  801c0e:	83 ec 04             	sub    $0x4,%esp
+  801c11:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801c14:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c19:	eb 03                	jmp    801c1e <dev_lookup+0x14>
+  801c1b:	83 c0 01             	add    $0x1,%eax
+  801c1e:	8b 1c 85 60 57 80 00 	mov    0x805760(,%eax,4),%ebx
+  801c25:	85 db                	test   %ebx,%ebx
+  801c27:	74 0b                	je     801c34 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801c29:	39 13                	cmp    %edx,(%ebx)
+  801c2b:	75 ee                	jne    801c1b <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801c2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c32:	eb 49                	jmp    801c7d <dev_lookup+0x73>
+  801c34:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801c36:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  801c3c:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801c41:	77 18                	ja     801c5b <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801c43:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801c48:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  801c4a:	c1 e8 10             	shr    $0x10,%eax
+  801c4d:	74 0c                	je     801c5b <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801c4f:	c1 e0 10             	shl    $0x10,%eax
+  801c52:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  801c57:	29 c1                	sub    %eax,%ecx
+  801c59:	eb 06                	jmp    801c61 <dev_lookup+0x57>
+		return pthread_main_tls;
+  801c5b:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801c61:	8b 01                	mov    (%ecx),%eax
+  801c63:	8b 40 48             	mov    0x48(%eax),%eax
+  801c66:	83 ec 04             	sub    $0x4,%esp
+  801c69:	52                   	push   %edx
+  801c6a:	50                   	push   %eax
+  801c6b:	68 e4 56 80 00       	push   $0x8056e4
+  801c70:	e8 8e e9 ff ff       	call   800603 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801c75:	83 c4 10             	add    $0x10,%esp
+  801c78:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801c7d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c80:	89 1a                	mov    %ebx,(%edx)
+}
+  801c82:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c85:	c9                   	leave
+  801c86:	c3                   	ret
+
+00801c87 <fd_close>:
+{
+  801c87:	55                   	push   %ebp
+  801c88:	89 e5                	mov    %esp,%ebp
+  801c8a:	57                   	push   %edi
+  801c8b:	56                   	push   %esi
+  801c8c:	53                   	push   %ebx
+  801c8d:	83 ec 24             	sub    $0x24,%esp
+  801c90:	8b 75 08             	mov    0x8(%ebp),%esi
+  801c93:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801c96:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801c99:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801c9a:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801ca0:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801ca3:	50                   	push   %eax
+  801ca4:	e8 11 ff ff ff       	call   801bba <fd_lookup>
+  801ca9:	89 c3                	mov    %eax,%ebx
+  801cab:	83 c4 10             	add    $0x10,%esp
+  801cae:	85 c0                	test   %eax,%eax
+  801cb0:	78 05                	js     801cb7 <fd_close+0x30>
+	    || fd != fd2)
+  801cb2:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801cb5:	74 16                	je     801ccd <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801cb7:	89 f8                	mov    %edi,%eax
+  801cb9:	84 c0                	test   %al,%al
+  801cbb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cc0:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801cc3:	89 d8                	mov    %ebx,%eax
+  801cc5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cc8:	5b                   	pop    %ebx
+  801cc9:	5e                   	pop    %esi
+  801cca:	5f                   	pop    %edi
+  801ccb:	5d                   	pop    %ebp
+  801ccc:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801ccd:	83 ec 08             	sub    $0x8,%esp
+  801cd0:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801cd3:	50                   	push   %eax
+  801cd4:	ff 36                	push   (%esi)
+  801cd6:	e8 2f ff ff ff       	call   801c0a <dev_lookup>
+  801cdb:	89 c3                	mov    %eax,%ebx
+  801cdd:	83 c4 10             	add    $0x10,%esp
+  801ce0:	85 c0                	test   %eax,%eax
+  801ce2:	78 1a                	js     801cfe <fd_close+0x77>
+		if (dev->dev_close)
+  801ce4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801ce7:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801cea:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801cef:	85 c0                	test   %eax,%eax
+  801cf1:	74 0b                	je     801cfe <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801cf3:	83 ec 0c             	sub    $0xc,%esp
+  801cf6:	56                   	push   %esi
+  801cf7:	ff d0                	call   *%eax
+  801cf9:	89 c3                	mov    %eax,%ebx
+  801cfb:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801cfe:	83 ec 08             	sub    $0x8,%esp
+  801d01:	56                   	push   %esi
+  801d02:	6a 00                	push   $0x0
+  801d04:	e8 b5 f3 ff ff       	call   8010be <sys_page_unmap>
+	return r;
+  801d09:	83 c4 10             	add    $0x10,%esp
+  801d0c:	eb b5                	jmp    801cc3 <fd_close+0x3c>
+
+00801d0e <close>:
+
+int
+close(int fdnum)
+{
+  801d0e:	55                   	push   %ebp
+  801d0f:	89 e5                	mov    %esp,%ebp
+  801d11:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d14:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d17:	50                   	push   %eax
+  801d18:	ff 75 08             	push   0x8(%ebp)
+  801d1b:	e8 9a fe ff ff       	call   801bba <fd_lookup>
+  801d20:	83 c4 10             	add    $0x10,%esp
+  801d23:	85 c0                	test   %eax,%eax
+  801d25:	79 02                	jns    801d29 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801d27:	c9                   	leave
+  801d28:	c3                   	ret
+		return fd_close(fd, 1);
+  801d29:	83 ec 08             	sub    $0x8,%esp
+  801d2c:	6a 01                	push   $0x1
+  801d2e:	ff 75 f4             	push   -0xc(%ebp)
+  801d31:	e8 51 ff ff ff       	call   801c87 <fd_close>
+  801d36:	83 c4 10             	add    $0x10,%esp
+  801d39:	eb ec                	jmp    801d27 <close+0x19>
+
+00801d3b <close_all>:
+
+void
+close_all(void)
+{
+  801d3b:	55                   	push   %ebp
+  801d3c:	89 e5                	mov    %esp,%ebp
+  801d3e:	53                   	push   %ebx
+  801d3f:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801d42:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801d47:	83 ec 0c             	sub    $0xc,%esp
+  801d4a:	53                   	push   %ebx
+  801d4b:	e8 be ff ff ff       	call   801d0e <close>
+	for (i = 0; i < MAXFD; i++)
+  801d50:	83 c3 01             	add    $0x1,%ebx
+  801d53:	83 c4 10             	add    $0x10,%esp
+  801d56:	83 fb 20             	cmp    $0x20,%ebx
+  801d59:	75 ec                	jne    801d47 <close_all+0xc>
+}
+  801d5b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d5e:	c9                   	leave
+  801d5f:	c3                   	ret
+
+00801d60 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801d60:	55                   	push   %ebp
+  801d61:	89 e5                	mov    %esp,%ebp
+  801d63:	57                   	push   %edi
+  801d64:	56                   	push   %esi
+  801d65:	53                   	push   %ebx
+  801d66:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801d69:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801d6c:	50                   	push   %eax
+  801d6d:	ff 75 08             	push   0x8(%ebp)
+  801d70:	e8 45 fe ff ff       	call   801bba <fd_lookup>
+  801d75:	89 c3                	mov    %eax,%ebx
+  801d77:	83 c4 10             	add    $0x10,%esp
+  801d7a:	85 c0                	test   %eax,%eax
+  801d7c:	78 7f                	js     801dfd <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801d7e:	83 ec 0c             	sub    $0xc,%esp
+  801d81:	ff 75 0c             	push   0xc(%ebp)
+  801d84:	e8 85 ff ff ff       	call   801d0e <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801d89:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801d8c:	c1 e6 0c             	shl    $0xc,%esi
+  801d8f:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801d95:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801d98:	89 3c 24             	mov    %edi,(%esp)
+  801d9b:	e8 ad fd ff ff       	call   801b4d <fd2data>
+  801da0:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801da2:	89 34 24             	mov    %esi,(%esp)
+  801da5:	e8 a3 fd ff ff       	call   801b4d <fd2data>
+  801daa:	83 c4 10             	add    $0x10,%esp
+  801dad:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801db0:	89 d8                	mov    %ebx,%eax
+  801db2:	c1 e8 16             	shr    $0x16,%eax
+  801db5:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801dbc:	a8 01                	test   $0x1,%al
+  801dbe:	74 11                	je     801dd1 <dup+0x71>
+  801dc0:	89 d8                	mov    %ebx,%eax
+  801dc2:	c1 e8 0c             	shr    $0xc,%eax
+  801dc5:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801dcc:	f6 c2 01             	test   $0x1,%dl
+  801dcf:	75 36                	jne    801e07 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801dd1:	89 f8                	mov    %edi,%eax
+  801dd3:	c1 e8 0c             	shr    $0xc,%eax
+  801dd6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801ddd:	83 ec 0c             	sub    $0xc,%esp
+  801de0:	25 07 0e 00 00       	and    $0xe07,%eax
+  801de5:	50                   	push   %eax
+  801de6:	56                   	push   %esi
+  801de7:	6a 00                	push   $0x0
+  801de9:	57                   	push   %edi
+  801dea:	6a 00                	push   $0x0
+  801dec:	e8 81 f2 ff ff       	call   801072 <sys_page_map>
+  801df1:	89 c3                	mov    %eax,%ebx
+  801df3:	83 c4 20             	add    $0x20,%esp
+  801df6:	85 c0                	test   %eax,%eax
+  801df8:	78 33                	js     801e2d <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801dfa:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801dfd:	89 d8                	mov    %ebx,%eax
+  801dff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e02:	5b                   	pop    %ebx
+  801e03:	5e                   	pop    %esi
+  801e04:	5f                   	pop    %edi
+  801e05:	5d                   	pop    %ebp
+  801e06:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801e07:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801e0e:	83 ec 0c             	sub    $0xc,%esp
+  801e11:	25 07 0e 00 00       	and    $0xe07,%eax
+  801e16:	50                   	push   %eax
+  801e17:	ff 75 d4             	push   -0x2c(%ebp)
+  801e1a:	6a 00                	push   $0x0
+  801e1c:	53                   	push   %ebx
+  801e1d:	6a 00                	push   $0x0
+  801e1f:	e8 4e f2 ff ff       	call   801072 <sys_page_map>
+  801e24:	89 c3                	mov    %eax,%ebx
+  801e26:	83 c4 20             	add    $0x20,%esp
+  801e29:	85 c0                	test   %eax,%eax
+  801e2b:	79 a4                	jns    801dd1 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801e2d:	83 ec 08             	sub    $0x8,%esp
+  801e30:	56                   	push   %esi
+  801e31:	6a 00                	push   $0x0
+  801e33:	e8 86 f2 ff ff       	call   8010be <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801e38:	83 c4 08             	add    $0x8,%esp
+  801e3b:	ff 75 d4             	push   -0x2c(%ebp)
+  801e3e:	6a 00                	push   $0x0
+  801e40:	e8 79 f2 ff ff       	call   8010be <sys_page_unmap>
+	return r;
+  801e45:	83 c4 10             	add    $0x10,%esp
+  801e48:	eb b3                	jmp    801dfd <dup+0x9d>
+
+00801e4a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801e4a:	55                   	push   %ebp
+  801e4b:	89 e5                	mov    %esp,%ebp
+  801e4d:	56                   	push   %esi
+  801e4e:	53                   	push   %ebx
+  801e4f:	83 ec 18             	sub    $0x18,%esp
+  801e52:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801e55:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e58:	50                   	push   %eax
+  801e59:	53                   	push   %ebx
+  801e5a:	e8 5b fd ff ff       	call   801bba <fd_lookup>
+  801e5f:	83 c4 10             	add    $0x10,%esp
+  801e62:	85 c0                	test   %eax,%eax
+  801e64:	78 3c                	js     801ea2 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801e66:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e69:	83 ec 08             	sub    $0x8,%esp
+  801e6c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e6f:	50                   	push   %eax
+  801e70:	ff 36                	push   (%esi)
+  801e72:	e8 93 fd ff ff       	call   801c0a <dev_lookup>
+  801e77:	83 c4 10             	add    $0x10,%esp
+  801e7a:	85 c0                	test   %eax,%eax
+  801e7c:	78 24                	js     801ea2 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801e7e:	8b 46 08             	mov    0x8(%esi),%eax
+  801e81:	83 e0 03             	and    $0x3,%eax
+  801e84:	83 f8 01             	cmp    $0x1,%eax
+  801e87:	74 20                	je     801ea9 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801e89:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e8c:	8b 40 08             	mov    0x8(%eax),%eax
+  801e8f:	85 c0                	test   %eax,%eax
+  801e91:	74 61                	je     801ef4 <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801e93:	83 ec 04             	sub    $0x4,%esp
+  801e96:	ff 75 10             	push   0x10(%ebp)
+  801e99:	ff 75 0c             	push   0xc(%ebp)
+  801e9c:	56                   	push   %esi
+  801e9d:	ff d0                	call   *%eax
+  801e9f:	83 c4 10             	add    $0x10,%esp
+}
+  801ea2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ea5:	5b                   	pop    %ebx
+  801ea6:	5e                   	pop    %esi
+  801ea7:	5d                   	pop    %ebp
+  801ea8:	c3                   	ret
+  801ea9:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801eab:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801eb1:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801eb6:	77 18                	ja     801ed0 <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801eb8:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801ebd:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801ebf:	c1 e8 10             	shr    $0x10,%eax
+  801ec2:	74 0c                	je     801ed0 <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801ec4:	c1 e0 10             	shl    $0x10,%eax
+  801ec7:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801ecc:	29 c2                	sub    %eax,%edx
+  801ece:	eb 06                	jmp    801ed6 <read+0x8c>
+		return pthread_main_tls;
+  801ed0:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801ed6:	8b 02                	mov    (%edx),%eax
+  801ed8:	8b 40 48             	mov    0x48(%eax),%eax
+  801edb:	83 ec 04             	sub    $0x4,%esp
+  801ede:	53                   	push   %ebx
+  801edf:	50                   	push   %eax
+  801ee0:	68 25 57 80 00       	push   $0x805725
+  801ee5:	e8 19 e7 ff ff       	call   800603 <cprintf>
+		return -E_INVAL;
+  801eea:	83 c4 10             	add    $0x10,%esp
+  801eed:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ef2:	eb ae                	jmp    801ea2 <read+0x58>
+		return -E_NOT_SUPP;
+  801ef4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ef9:	eb a7                	jmp    801ea2 <read+0x58>
+
+00801efb <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801efb:	55                   	push   %ebp
+  801efc:	89 e5                	mov    %esp,%ebp
+  801efe:	57                   	push   %edi
+  801eff:	56                   	push   %esi
+  801f00:	53                   	push   %ebx
+  801f01:	83 ec 0c             	sub    $0xc,%esp
+  801f04:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801f07:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801f0a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f0f:	eb 02                	jmp    801f13 <readn+0x18>
+  801f11:	01 c3                	add    %eax,%ebx
+  801f13:	39 f3                	cmp    %esi,%ebx
+  801f15:	73 21                	jae    801f38 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801f17:	83 ec 04             	sub    $0x4,%esp
+  801f1a:	89 f0                	mov    %esi,%eax
+  801f1c:	29 d8                	sub    %ebx,%eax
+  801f1e:	50                   	push   %eax
+  801f1f:	89 d8                	mov    %ebx,%eax
+  801f21:	03 45 0c             	add    0xc(%ebp),%eax
+  801f24:	50                   	push   %eax
+  801f25:	57                   	push   %edi
+  801f26:	e8 1f ff ff ff       	call   801e4a <read>
+		if (m < 0)
+  801f2b:	83 c4 10             	add    $0x10,%esp
+  801f2e:	85 c0                	test   %eax,%eax
+  801f30:	78 04                	js     801f36 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801f32:	75 dd                	jne    801f11 <readn+0x16>
+  801f34:	eb 02                	jmp    801f38 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801f36:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801f38:	89 d8                	mov    %ebx,%eax
+  801f3a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f3d:	5b                   	pop    %ebx
+  801f3e:	5e                   	pop    %esi
+  801f3f:	5f                   	pop    %edi
+  801f40:	5d                   	pop    %ebp
+  801f41:	c3                   	ret
+
+00801f42 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801f42:	55                   	push   %ebp
+  801f43:	89 e5                	mov    %esp,%ebp
+  801f45:	56                   	push   %esi
+  801f46:	53                   	push   %ebx
+  801f47:	83 ec 18             	sub    $0x18,%esp
+  801f4a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801f4d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f50:	50                   	push   %eax
+  801f51:	53                   	push   %ebx
+  801f52:	e8 63 fc ff ff       	call   801bba <fd_lookup>
+  801f57:	83 c4 10             	add    $0x10,%esp
+  801f5a:	85 c0                	test   %eax,%eax
+  801f5c:	78 37                	js     801f95 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801f5e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801f61:	83 ec 08             	sub    $0x8,%esp
+  801f64:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f67:	50                   	push   %eax
+  801f68:	ff 36                	push   (%esi)
+  801f6a:	e8 9b fc ff ff       	call   801c0a <dev_lookup>
+  801f6f:	83 c4 10             	add    $0x10,%esp
+  801f72:	85 c0                	test   %eax,%eax
+  801f74:	78 1f                	js     801f95 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f76:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801f7a:	74 20                	je     801f9c <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801f7c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f7f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f82:	85 c0                	test   %eax,%eax
+  801f84:	74 61                	je     801fe7 <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801f86:	83 ec 04             	sub    $0x4,%esp
+  801f89:	ff 75 10             	push   0x10(%ebp)
+  801f8c:	ff 75 0c             	push   0xc(%ebp)
+  801f8f:	56                   	push   %esi
+  801f90:	ff d0                	call   *%eax
+  801f92:	83 c4 10             	add    $0x10,%esp
+}
+  801f95:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f98:	5b                   	pop    %ebx
+  801f99:	5e                   	pop    %esi
+  801f9a:	5d                   	pop    %ebp
+  801f9b:	c3                   	ret
+  801f9c:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801f9e:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801fa4:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801fa9:	77 18                	ja     801fc3 <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801fab:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801fb0:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801fb2:	c1 e8 10             	shr    $0x10,%eax
+  801fb5:	74 0c                	je     801fc3 <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801fb7:	c1 e0 10             	shl    $0x10,%eax
+  801fba:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801fbf:	29 c2                	sub    %eax,%edx
+  801fc1:	eb 06                	jmp    801fc9 <write+0x87>
+		return pthread_main_tls;
+  801fc3:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801fc9:	8b 02                	mov    (%edx),%eax
+  801fcb:	8b 40 48             	mov    0x48(%eax),%eax
+  801fce:	83 ec 04             	sub    $0x4,%esp
+  801fd1:	53                   	push   %ebx
+  801fd2:	50                   	push   %eax
+  801fd3:	68 41 57 80 00       	push   $0x805741
+  801fd8:	e8 26 e6 ff ff       	call   800603 <cprintf>
+		return -E_INVAL;
+  801fdd:	83 c4 10             	add    $0x10,%esp
+  801fe0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fe5:	eb ae                	jmp    801f95 <write+0x53>
+		return -E_NOT_SUPP;
+  801fe7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801fec:	eb a7                	jmp    801f95 <write+0x53>
+
+00801fee <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801fee:	55                   	push   %ebp
+  801fef:	89 e5                	mov    %esp,%ebp
+  801ff1:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801ff4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ff7:	50                   	push   %eax
+  801ff8:	ff 75 08             	push   0x8(%ebp)
+  801ffb:	e8 ba fb ff ff       	call   801bba <fd_lookup>
+  802000:	83 c4 10             	add    $0x10,%esp
+  802003:	85 c0                	test   %eax,%eax
+  802005:	78 0e                	js     802015 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  802007:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80200a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80200d:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  802010:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802015:	c9                   	leave
+  802016:	c3                   	ret
+
+00802017 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  802017:	55                   	push   %ebp
+  802018:	89 e5                	mov    %esp,%ebp
+  80201a:	56                   	push   %esi
+  80201b:	53                   	push   %ebx
+  80201c:	83 ec 18             	sub    $0x18,%esp
+  80201f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802022:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802025:	50                   	push   %eax
+  802026:	53                   	push   %ebx
+  802027:	e8 8e fb ff ff       	call   801bba <fd_lookup>
+  80202c:	83 c4 10             	add    $0x10,%esp
+  80202f:	85 c0                	test   %eax,%eax
+  802031:	78 34                	js     802067 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802033:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802036:	83 ec 08             	sub    $0x8,%esp
+  802039:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80203c:	50                   	push   %eax
+  80203d:	ff 36                	push   (%esi)
+  80203f:	e8 c6 fb ff ff       	call   801c0a <dev_lookup>
+  802044:	83 c4 10             	add    $0x10,%esp
+  802047:	85 c0                	test   %eax,%eax
+  802049:	78 1c                	js     802067 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80204b:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80204f:	74 1d                	je     80206e <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  802051:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802054:	8b 40 18             	mov    0x18(%eax),%eax
+  802057:	85 c0                	test   %eax,%eax
+  802059:	74 5e                	je     8020b9 <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80205b:	83 ec 08             	sub    $0x8,%esp
+  80205e:	ff 75 0c             	push   0xc(%ebp)
+  802061:	56                   	push   %esi
+  802062:	ff d0                	call   *%eax
+  802064:	83 c4 10             	add    $0x10,%esp
+}
+  802067:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80206a:	5b                   	pop    %ebx
+  80206b:	5e                   	pop    %esi
+  80206c:	5d                   	pop    %ebp
+  80206d:	c3                   	ret
+  80206e:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802070:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802076:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80207b:	77 18                	ja     802095 <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80207d:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802082:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  802084:	c1 e8 10             	shr    $0x10,%eax
+  802087:	74 0c                	je     802095 <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802089:	c1 e0 10             	shl    $0x10,%eax
+  80208c:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802091:	29 c2                	sub    %eax,%edx
+  802093:	eb 06                	jmp    80209b <ftruncate+0x84>
+		return pthread_main_tls;
+  802095:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+			thisenv->env_id, fdnum);
+  80209b:	8b 02                	mov    (%edx),%eax
+  80209d:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8020a0:	83 ec 04             	sub    $0x4,%esp
+  8020a3:	53                   	push   %ebx
+  8020a4:	50                   	push   %eax
+  8020a5:	68 04 57 80 00       	push   $0x805704
+  8020aa:	e8 54 e5 ff ff       	call   800603 <cprintf>
+		return -E_INVAL;
+  8020af:	83 c4 10             	add    $0x10,%esp
+  8020b2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020b7:	eb ae                	jmp    802067 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8020b9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8020be:	eb a7                	jmp    802067 <ftruncate+0x50>
+
+008020c0 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8020c0:	55                   	push   %ebp
+  8020c1:	89 e5                	mov    %esp,%ebp
+  8020c3:	56                   	push   %esi
+  8020c4:	53                   	push   %ebx
+  8020c5:	83 ec 18             	sub    $0x18,%esp
+  8020c8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8020cb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8020ce:	50                   	push   %eax
+  8020cf:	ff 75 08             	push   0x8(%ebp)
+  8020d2:	e8 e3 fa ff ff       	call   801bba <fd_lookup>
+  8020d7:	83 c4 10             	add    $0x10,%esp
+  8020da:	85 c0                	test   %eax,%eax
+  8020dc:	78 49                	js     802127 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8020de:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8020e1:	83 ec 08             	sub    $0x8,%esp
+  8020e4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020e7:	50                   	push   %eax
+  8020e8:	ff 36                	push   (%esi)
+  8020ea:	e8 1b fb ff ff       	call   801c0a <dev_lookup>
+  8020ef:	83 c4 10             	add    $0x10,%esp
+  8020f2:	85 c0                	test   %eax,%eax
+  8020f4:	78 31                	js     802127 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8020f6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020f9:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8020fd:	74 2f                	je     80212e <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8020ff:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  802102:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  802109:	00 00 00 
+	stat->st_isdir = 0;
+  80210c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802113:	00 00 00 
+	stat->st_dev = dev;
+  802116:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80211c:	83 ec 08             	sub    $0x8,%esp
+  80211f:	53                   	push   %ebx
+  802120:	56                   	push   %esi
+  802121:	ff 50 14             	call   *0x14(%eax)
+  802124:	83 c4 10             	add    $0x10,%esp
+}
+  802127:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80212a:	5b                   	pop    %ebx
+  80212b:	5e                   	pop    %esi
+  80212c:	5d                   	pop    %ebp
+  80212d:	c3                   	ret
+		return -E_NOT_SUPP;
+  80212e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802133:	eb f2                	jmp    802127 <fstat+0x67>
+
+00802135 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  802135:	55                   	push   %ebp
+  802136:	89 e5                	mov    %esp,%ebp
+  802138:	56                   	push   %esi
+  802139:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80213a:	83 ec 08             	sub    $0x8,%esp
+  80213d:	6a 00                	push   $0x0
+  80213f:	ff 75 08             	push   0x8(%ebp)
+  802142:	e8 4b 03 00 00       	call   802492 <open>
+  802147:	89 c3                	mov    %eax,%ebx
+  802149:	83 c4 10             	add    $0x10,%esp
+  80214c:	85 c0                	test   %eax,%eax
+  80214e:	78 1b                	js     80216b <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  802150:	83 ec 08             	sub    $0x8,%esp
+  802153:	ff 75 0c             	push   0xc(%ebp)
+  802156:	50                   	push   %eax
+  802157:	e8 64 ff ff ff       	call   8020c0 <fstat>
+  80215c:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80215e:	89 1c 24             	mov    %ebx,(%esp)
+  802161:	e8 a8 fb ff ff       	call   801d0e <close>
+	return r;
+  802166:	83 c4 10             	add    $0x10,%esp
+  802169:	89 f3                	mov    %esi,%ebx
+}
+  80216b:	89 d8                	mov    %ebx,%eax
+  80216d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802170:	5b                   	pop    %ebx
+  802171:	5e                   	pop    %esi
+  802172:	5d                   	pop    %ebp
+  802173:	c3                   	ret
+
+00802174 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  802174:	55                   	push   %ebp
+  802175:	89 e5                	mov    %esp,%ebp
+  802177:	56                   	push   %esi
+  802178:	53                   	push   %ebx
+  802179:	89 c6                	mov    %eax,%esi
+  80217b:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  80217d:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  802184:	74 27                	je     8021ad <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802186:	6a 07                	push   $0x7
+  802188:	68 00 80 80 00       	push   $0x808000
+  80218d:	56                   	push   %esi
+  80218e:	ff 35 00 70 80 00    	push   0x807000
+  802194:	e8 36 2b 00 00       	call   804ccf <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  802199:	83 c4 0c             	add    $0xc,%esp
+  80219c:	6a 00                	push   $0x0
+  80219e:	53                   	push   %ebx
+  80219f:	6a 00                	push   $0x0
+  8021a1:	e8 33 2a 00 00       	call   804bd9 <ipc_recv>
+}
+  8021a6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021a9:	5b                   	pop    %ebx
+  8021aa:	5e                   	pop    %esi
+  8021ab:	5d                   	pop    %ebp
+  8021ac:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8021ad:	83 ec 0c             	sub    $0xc,%esp
+  8021b0:	6a 01                	push   $0x1
+  8021b2:	e8 6e 2b 00 00       	call   804d25 <ipc_find_env>
+  8021b7:	a3 00 70 80 00       	mov    %eax,0x807000
+  8021bc:	83 c4 10             	add    $0x10,%esp
+  8021bf:	eb c5                	jmp    802186 <fsipc+0x12>
+
+008021c1 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8021c1:	55                   	push   %ebp
+  8021c2:	89 e5                	mov    %esp,%ebp
+  8021c4:	53                   	push   %ebx
+  8021c5:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  8021c8:	68 04 70 80 00       	push   $0x807004
+  8021cd:	e8 97 21 00 00       	call   804369 <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8021d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021d5:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021d8:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.set_size.req_size = newsize;
+  8021dd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021e0:	a3 04 80 80 00       	mov    %eax,0x808004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  8021e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021ea:	b8 02 00 00 00       	mov    $0x2,%eax
+  8021ef:	e8 80 ff ff ff       	call   802174 <fsipc>
+  8021f4:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8021f6:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  8021fd:	e8 d4 21 00 00       	call   8043d6 <mutex_unlock>
+	return r;
+}
+  802202:	89 d8                	mov    %ebx,%eax
+  802204:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802207:	c9                   	leave
+  802208:	c3                   	ret
+
+00802209 <devfile_flush>:
+{
+  802209:	55                   	push   %ebp
+  80220a:	89 e5                	mov    %esp,%ebp
+  80220c:	53                   	push   %ebx
+  80220d:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  802210:	68 04 70 80 00       	push   $0x807004
+  802215:	e8 4f 21 00 00       	call   804369 <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80221a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80221d:	8b 40 0c             	mov    0xc(%eax),%eax
+  802220:	a3 00 80 80 00       	mov    %eax,0x808000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  802225:	ba 00 00 00 00       	mov    $0x0,%edx
+  80222a:	b8 06 00 00 00       	mov    $0x6,%eax
+  80222f:	e8 40 ff ff ff       	call   802174 <fsipc>
+  802234:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802236:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  80223d:	e8 94 21 00 00       	call   8043d6 <mutex_unlock>
+}
+  802242:	89 d8                	mov    %ebx,%eax
+  802244:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802247:	c9                   	leave
+  802248:	c3                   	ret
+
+00802249 <devfile_stat>:
+{
+  802249:	55                   	push   %ebp
+  80224a:	89 e5                	mov    %esp,%ebp
+  80224c:	56                   	push   %esi
+  80224d:	53                   	push   %ebx
+  80224e:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  802251:	83 ec 0c             	sub    $0xc,%esp
+  802254:	68 04 70 80 00       	push   $0x807004
+  802259:	e8 0b 21 00 00       	call   804369 <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80225e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802261:	8b 40 0c             	mov    0xc(%eax),%eax
+  802264:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  802269:	ba 00 00 00 00       	mov    $0x0,%edx
+  80226e:	b8 05 00 00 00       	mov    $0x5,%eax
+  802273:	e8 fc fe ff ff       	call   802174 <fsipc>
+  802278:	89 c3                	mov    %eax,%ebx
+  80227a:	83 c4 10             	add    $0x10,%esp
+  80227d:	85 c0                	test   %eax,%eax
+  80227f:	79 16                	jns    802297 <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  802281:	83 ec 0c             	sub    $0xc,%esp
+  802284:	68 04 70 80 00       	push   $0x807004
+  802289:	e8 48 21 00 00       	call   8043d6 <mutex_unlock>
+}
+  80228e:	89 d8                	mov    %ebx,%eax
+  802290:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802293:	5b                   	pop    %ebx
+  802294:	5e                   	pop    %esi
+  802295:	5d                   	pop    %ebp
+  802296:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802297:	83 ec 08             	sub    $0x8,%esp
+  80229a:	68 00 80 80 00       	push   $0x808000
+  80229f:	56                   	push   %esi
+  8022a0:	e8 42 e9 ff ff       	call   800be7 <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  8022a5:	a1 80 80 80 00       	mov    0x808080,%eax
+  8022aa:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8022b0:	a1 84 80 80 00       	mov    0x808084,%eax
+  8022b5:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  8022bb:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  8022be:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8022c3:	eb bc                	jmp    802281 <devfile_stat+0x38>
+
+008022c5 <devfile_write>:
+{
+  8022c5:	55                   	push   %ebp
+  8022c6:	89 e5                	mov    %esp,%ebp
+  8022c8:	53                   	push   %ebx
+  8022c9:	83 ec 10             	sub    $0x10,%esp
+  8022cc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  8022cf:	68 04 70 80 00       	push   $0x807004
+  8022d4:	e8 90 20 00 00       	call   804369 <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8022d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022dc:	8b 40 0c             	mov    0xc(%eax),%eax
+  8022df:	a3 00 80 80 00       	mov    %eax,0x808000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  8022e4:	83 c4 10             	add    $0x10,%esp
+  8022e7:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  8022ed:	76 3d                	jbe    80232c <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  8022ef:	b8 00 00 10 00       	mov    $0x100000,%eax
+  8022f4:	39 c3                	cmp    %eax,%ebx
+  8022f6:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  8022f9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022fc:	a3 08 80 80 00       	mov    %eax,0x808008
+	fsipcbuf.write.req_n = n;
+  802301:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	r = fsipc(FSREQ_WRITE, NULL);
+  802307:	ba 00 00 00 00       	mov    $0x0,%edx
+  80230c:	b8 04 00 00 00       	mov    $0x4,%eax
+  802311:	e8 5e fe ff ff       	call   802174 <fsipc>
+  802316:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  802318:	83 ec 0c             	sub    $0xc,%esp
+  80231b:	68 04 70 80 00       	push   $0x807004
+  802320:	e8 b1 20 00 00       	call   8043d6 <mutex_unlock>
+}
+  802325:	89 d8                	mov    %ebx,%eax
+  802327:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80232a:	c9                   	leave
+  80232b:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  80232c:	83 ec 04             	sub    $0x4,%esp
+  80232f:	53                   	push   %ebx
+  802330:	ff 75 0c             	push   0xc(%ebp)
+  802333:	68 0c 80 80 00       	push   $0x80800c
+  802338:	e8 30 ea ff ff       	call   800d6d <memmove>
+  80233d:	83 c4 10             	add    $0x10,%esp
+  802340:	b8 00 00 00 00       	mov    $0x0,%eax
+  802345:	eb b5                	jmp    8022fc <devfile_write+0x37>
+
+00802347 <devfile_read>:
+{
+  802347:	55                   	push   %ebp
+  802348:	89 e5                	mov    %esp,%ebp
+  80234a:	57                   	push   %edi
+  80234b:	56                   	push   %esi
+  80234c:	53                   	push   %ebx
+  80234d:	83 ec 0c             	sub    $0xc,%esp
+  802350:	8b 75 08             	mov    0x8(%ebp),%esi
+  802353:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802356:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  802359:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  80235f:	0f 86 8c 00 00 00    	jbe    8023f1 <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  802365:	b8 00 00 10 00       	mov    $0x100000,%eax
+  80236a:	39 c3                	cmp    %eax,%ebx
+  80236c:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  80236f:	89 f8                	mov    %edi,%eax
+  802371:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  802374:	eb 0f                	jmp    802385 <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  802376:	0f b6 08             	movzbl (%eax),%ecx
+  802379:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  80237b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802380:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  802385:	39 d0                	cmp    %edx,%eax
+  802387:	72 ed                	jb     802376 <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  802389:	83 ec 0c             	sub    $0xc,%esp
+  80238c:	68 04 70 80 00       	push   $0x807004
+  802391:	e8 d3 1f 00 00       	call   804369 <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802396:	8b 46 0c             	mov    0xc(%esi),%eax
+  802399:	a3 00 80 80 00       	mov    %eax,0x808000
+		fsipcbuf.read.req_n = n;
+  80239e:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  8023a4:	89 3d 08 80 80 00    	mov    %edi,0x808008
+		r = fsipc(FSREQ_READ, NULL);
+  8023aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023af:	b8 03 00 00 00       	mov    $0x3,%eax
+  8023b4:	e8 bb fd ff ff       	call   802174 <fsipc>
+  8023b9:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  8023bb:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  8023c2:	e8 0f 20 00 00       	call   8043d6 <mutex_unlock>
+		assert(r <= (int) n);
+  8023c7:	83 c4 10             	add    $0x10,%esp
+  8023ca:	39 f3                	cmp    %esi,%ebx
+  8023cc:	7c 0a                	jl     8023d8 <devfile_read+0x91>
+}
+  8023ce:	89 f0                	mov    %esi,%eax
+  8023d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023d3:	5b                   	pop    %ebx
+  8023d4:	5e                   	pop    %esi
+  8023d5:	5f                   	pop    %edi
+  8023d6:	5d                   	pop    %ebp
+  8023d7:	c3                   	ret
+		assert(r <= (int) n);
+  8023d8:	68 74 57 80 00       	push   $0x805774
+  8023dd:	68 b1 56 80 00       	push   $0x8056b1
+  8023e2:	68 90 00 00 00       	push   $0x90
+  8023e7:	68 81 57 80 00       	push   $0x805781
+  8023ec:	e8 37 e1 ff ff       	call   800528 <_panic>
+	mutex_lock(&fsipc_mu);
+  8023f1:	83 ec 0c             	sub    $0xc,%esp
+  8023f4:	68 04 70 80 00       	push   $0x807004
+  8023f9:	e8 6b 1f 00 00       	call   804369 <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8023fe:	8b 46 0c             	mov    0xc(%esi),%eax
+  802401:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.read.req_n = n;
+  802406:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	fsipcbuf.read.req_va = 0;
+  80240c:	c7 05 08 80 80 00 00 	movl   $0x0,0x808008
+  802413:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  802416:	ba 00 00 00 00       	mov    $0x0,%edx
+  80241b:	b8 03 00 00 00       	mov    $0x3,%eax
+  802420:	e8 4f fd ff ff       	call   802174 <fsipc>
+  802425:	89 c6                	mov    %eax,%esi
+  802427:	83 c4 10             	add    $0x10,%esp
+  80242a:	85 c0                	test   %eax,%eax
+  80242c:	78 1d                	js     80244b <devfile_read+0x104>
+		assert(r <= n);
+  80242e:	39 c3                	cmp    %eax,%ebx
+  802430:	72 2e                	jb     802460 <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  802432:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802437:	7f 40                	jg     802479 <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  802439:	83 ec 04             	sub    $0x4,%esp
+  80243c:	50                   	push   %eax
+  80243d:	68 00 80 80 00       	push   $0x808000
+  802442:	57                   	push   %edi
+  802443:	e8 25 e9 ff ff       	call   800d6d <memmove>
+  802448:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  80244b:	83 ec 0c             	sub    $0xc,%esp
+  80244e:	68 04 70 80 00       	push   $0x807004
+  802453:	e8 7e 1f 00 00       	call   8043d6 <mutex_unlock>
+	return r;
+  802458:	83 c4 10             	add    $0x10,%esp
+  80245b:	e9 6e ff ff ff       	jmp    8023ce <devfile_read+0x87>
+		assert(r <= n);
+  802460:	68 8c 57 80 00       	push   $0x80578c
+  802465:	68 b1 56 80 00       	push   $0x8056b1
+  80246a:	68 99 00 00 00       	push   $0x99
+  80246f:	68 81 57 80 00       	push   $0x805781
+  802474:	e8 af e0 ff ff       	call   800528 <_panic>
+		assert(r <= PGSIZE);
+  802479:	68 93 57 80 00       	push   $0x805793
+  80247e:	68 b1 56 80 00       	push   $0x8056b1
+  802483:	68 9a 00 00 00       	push   $0x9a
+  802488:	68 81 57 80 00       	push   $0x805781
+  80248d:	e8 96 e0 ff ff       	call   800528 <_panic>
+
+00802492 <open>:
+{
+  802492:	55                   	push   %ebp
+  802493:	89 e5                	mov    %esp,%ebp
+  802495:	56                   	push   %esi
+  802496:	53                   	push   %ebx
+  802497:	83 ec 1c             	sub    $0x1c,%esp
+  80249a:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  80249d:	56                   	push   %esi
+  80249e:	e8 09 e7 ff ff       	call   800bac <strlen>
+  8024a3:	83 c4 10             	add    $0x10,%esp
+  8024a6:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8024ab:	0f 8f 85 00 00 00    	jg     802536 <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  8024b1:	83 ec 0c             	sub    $0xc,%esp
+  8024b4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024b7:	50                   	push   %eax
+  8024b8:	e8 a7 f6 ff ff       	call   801b64 <fd_alloc>
+  8024bd:	89 c3                	mov    %eax,%ebx
+  8024bf:	83 c4 10             	add    $0x10,%esp
+  8024c2:	85 c0                	test   %eax,%eax
+  8024c4:	78 55                	js     80251b <open+0x89>
+	mutex_lock(&fsipc_mu);
+  8024c6:	83 ec 0c             	sub    $0xc,%esp
+  8024c9:	68 04 70 80 00       	push   $0x807004
+  8024ce:	e8 96 1e 00 00       	call   804369 <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  8024d3:	83 c4 08             	add    $0x8,%esp
+  8024d6:	56                   	push   %esi
+  8024d7:	68 00 80 80 00       	push   $0x808000
+  8024dc:	e8 06 e7 ff ff       	call   800be7 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8024e1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024e4:	a3 00 84 80 00       	mov    %eax,0x808400
+	r = fsipc(FSREQ_OPEN, fd);
+  8024e9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8024ec:	b8 01 00 00 00       	mov    $0x1,%eax
+  8024f1:	e8 7e fc ff ff       	call   802174 <fsipc>
+  8024f6:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8024f8:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  8024ff:	e8 d2 1e 00 00       	call   8043d6 <mutex_unlock>
+	if (r < 0) {
+  802504:	83 c4 10             	add    $0x10,%esp
+  802507:	85 db                	test   %ebx,%ebx
+  802509:	78 19                	js     802524 <open+0x92>
+	return fd2num(fd);
+  80250b:	83 ec 0c             	sub    $0xc,%esp
+  80250e:	ff 75 f4             	push   -0xc(%ebp)
+  802511:	e8 27 f6 ff ff       	call   801b3d <fd2num>
+  802516:	89 c3                	mov    %eax,%ebx
+  802518:	83 c4 10             	add    $0x10,%esp
+}
+  80251b:	89 d8                	mov    %ebx,%eax
+  80251d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802520:	5b                   	pop    %ebx
+  802521:	5e                   	pop    %esi
+  802522:	5d                   	pop    %ebp
+  802523:	c3                   	ret
+		fd_close(fd, 0);
+  802524:	83 ec 08             	sub    $0x8,%esp
+  802527:	6a 00                	push   $0x0
+  802529:	ff 75 f4             	push   -0xc(%ebp)
+  80252c:	e8 56 f7 ff ff       	call   801c87 <fd_close>
+		return r;
+  802531:	83 c4 10             	add    $0x10,%esp
+  802534:	eb e5                	jmp    80251b <open+0x89>
+		return -E_BAD_PATH;
+  802536:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80253b:	eb de                	jmp    80251b <open+0x89>
+
+0080253d <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  80253d:	55                   	push   %ebp
+  80253e:	89 e5                	mov    %esp,%ebp
+  802540:	53                   	push   %ebx
+  802541:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802544:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802547:	50                   	push   %eax
+  802548:	ff 75 08             	push   0x8(%ebp)
+  80254b:	e8 6a f6 ff ff       	call   801bba <fd_lookup>
+  802550:	89 c3                	mov    %eax,%ebx
+  802552:	83 c4 10             	add    $0x10,%esp
+  802555:	85 c0                	test   %eax,%eax
+  802557:	78 5b                	js     8025b4 <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  802559:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80255c:	8b 0d 20 60 80 00    	mov    0x806020,%ecx
+  802562:	39 08                	cmp    %ecx,(%eax)
+  802564:	75 55                	jne    8025bb <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  802566:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  80256a:	74 56                	je     8025c2 <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  80256c:	83 ec 0c             	sub    $0xc,%esp
+  80256f:	68 04 70 80 00       	push   $0x807004
+  802574:	e8 f0 1d 00 00       	call   804369 <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  802579:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80257c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80257f:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.allocate.req_offset = offset;
+  802584:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802587:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.allocate.req_len = len;
+  80258c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80258f:	a3 08 80 80 00       	mov    %eax,0x808008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  802594:	ba 00 00 00 00       	mov    $0x0,%edx
+  802599:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80259e:	e8 d1 fb ff ff       	call   802174 <fsipc>
+  8025a3:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8025a5:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  8025ac:	e8 25 1e 00 00       	call   8043d6 <mutex_unlock>
+	return r;
+  8025b1:	83 c4 10             	add    $0x10,%esp
+}
+  8025b4:	89 d8                	mov    %ebx,%eax
+  8025b6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025b9:	c9                   	leave
+  8025ba:	c3                   	ret
+		return -E_NOT_SUPP;
+  8025bb:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8025c0:	eb f2                	jmp    8025b4 <fallocate+0x77>
+		return -E_INVAL;
+  8025c2:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8025c7:	eb eb                	jmp    8025b4 <fallocate+0x77>
+
+008025c9 <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  8025c9:	55                   	push   %ebp
+  8025ca:	89 e5                	mov    %esp,%ebp
+  8025cc:	56                   	push   %esi
+  8025cd:	53                   	push   %ebx
+  8025ce:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  8025d1:	89 f3                	mov    %esi,%ebx
+  8025d3:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  8025d9:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  8025dc:	eb 06                	jmp    8025e4 <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  8025de:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8025e4:	39 f3                	cmp    %esi,%ebx
+  8025e6:	73 14                	jae    8025fc <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  8025e8:	83 ec 08             	sub    $0x8,%esp
+  8025eb:	53                   	push   %ebx
+  8025ec:	6a 00                	push   $0x0
+  8025ee:	e8 cb ea ff ff       	call   8010be <sys_page_unmap>
+  8025f3:	83 c4 10             	add    $0x10,%esp
+  8025f6:	85 c0                	test   %eax,%eax
+  8025f8:	79 e4                	jns    8025de <munmap+0x15>
+  8025fa:	eb 05                	jmp    802601 <munmap+0x38>
+			return r;
+	return 0;
+  8025fc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802601:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802604:	5b                   	pop    %ebx
+  802605:	5e                   	pop    %esi
+  802606:	5d                   	pop    %ebp
+  802607:	c3                   	ret
+
+00802608 <mmap>:
+{
+  802608:	55                   	push   %ebp
+  802609:	89 e5                	mov    %esp,%ebp
+  80260b:	57                   	push   %edi
+  80260c:	56                   	push   %esi
+  80260d:	53                   	push   %ebx
+  80260e:	83 ec 24             	sub    $0x24,%esp
+  802611:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802614:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802617:	50                   	push   %eax
+  802618:	ff 75 08             	push   0x8(%ebp)
+  80261b:	e8 9a f5 ff ff       	call   801bba <fd_lookup>
+  802620:	83 c4 10             	add    $0x10,%esp
+  802623:	85 c0                	test   %eax,%eax
+  802625:	0f 88 37 01 00 00    	js     802762 <mmap+0x15a>
+		return NULL;
+  80262b:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  802630:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802633:	8b 0d 20 60 80 00    	mov    0x806020,%ecx
+  802639:	39 0a                	cmp    %ecx,(%edx)
+  80263b:	0f 85 05 01 00 00    	jne    802746 <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  802641:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  802648:	0f 85 1b 01 00 00    	jne    802769 <mmap+0x161>
+  80264e:	89 f0                	mov    %esi,%eax
+  802650:	83 e8 01             	sub    $0x1,%eax
+  802653:	0f 88 17 01 00 00    	js     802770 <mmap+0x168>
+	if (prot & PROT_WRITE)
+  802659:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  80265d:	75 28                	jne    802687 <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  80265f:	83 ec 0c             	sub    $0xc,%esp
+  802662:	68 04 70 80 00       	push   $0x807004
+  802667:	e8 fd 1c 00 00       	call   804369 <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  80266c:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  802672:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  802678:	83 c4 10             	add    $0x10,%esp
+  80267b:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  802680:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  802685:	eb 2b                	jmp    8026b2 <mmap+0xaa>
+		cow_enable();
+  802687:	e8 40 f0 ff ff       	call   8016cc <cow_enable>
+  80268c:	eb d1                	jmp    80265f <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  80268e:	89 c2                	mov    %eax,%edx
+  802690:	c1 ea 0c             	shr    $0xc,%edx
+  802693:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  80269a:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8026a0:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  8026a6:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  8026a9:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  8026ab:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  8026b0:	77 25                	ja     8026d7 <mmap+0xcf>
+  8026b2:	89 c2                	mov    %eax,%edx
+  8026b4:	29 da                	sub    %ebx,%edx
+  8026b6:	39 ca                	cmp    %ecx,%edx
+  8026b8:	73 3a                	jae    8026f4 <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  8026ba:	89 c2                	mov    %eax,%edx
+  8026bc:	c1 ea 16             	shr    $0x16,%edx
+  8026bf:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8026c6:	f6 c2 01             	test   $0x1,%dl
+  8026c9:	75 c3                	jne    80268e <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  8026cb:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  8026d0:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  8026d5:	eb d4                	jmp    8026ab <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  8026d7:	29 d8                	sub    %ebx,%eax
+  8026d9:	39 c8                	cmp    %ecx,%eax
+  8026db:	73 17                	jae    8026f4 <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  8026dd:	83 ec 0c             	sub    $0xc,%esp
+  8026e0:	68 04 70 80 00       	push   $0x807004
+  8026e5:	e8 ec 1c 00 00       	call   8043d6 <mutex_unlock>
+		return NULL;
+  8026ea:	83 c4 10             	add    $0x10,%esp
+  8026ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026f2:	eb 52                	jmp    802746 <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  8026f4:	85 db                	test   %ebx,%ebx
+  8026f6:	74 e5                	je     8026dd <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8026f8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8026fb:	8b 40 0c             	mov    0xc(%eax),%eax
+  8026fe:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.map.req_offset = offset;
+  802703:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802706:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.map.req_len = len;
+  80270b:	89 35 08 80 80 00    	mov    %esi,0x808008
+	fsipcbuf.map.req_va = va;
+  802711:	89 1d 0c 80 80 00    	mov    %ebx,0x80800c
+	fsipcbuf.map.req_prot = prot;
+  802717:	8b 45 14             	mov    0x14(%ebp),%eax
+  80271a:	a3 10 80 80 00       	mov    %eax,0x808010
+	r = fsipc(FSREQ_MAP, NULL);
+  80271f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802724:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802729:	e8 46 fa ff ff       	call   802174 <fsipc>
+  80272e:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  802730:	83 ec 0c             	sub    $0xc,%esp
+  802733:	68 04 70 80 00       	push   $0x807004
+  802738:	e8 99 1c 00 00       	call   8043d6 <mutex_unlock>
+	if (r < 0) {
+  80273d:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  802740:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  802742:	85 ff                	test   %edi,%edi
+  802744:	78 08                	js     80274e <mmap+0x146>
+}
+  802746:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802749:	5b                   	pop    %ebx
+  80274a:	5e                   	pop    %esi
+  80274b:	5f                   	pop    %edi
+  80274c:	5d                   	pop    %ebp
+  80274d:	c3                   	ret
+		munmap((void*) va, len);
+  80274e:	83 ec 08             	sub    $0x8,%esp
+  802751:	56                   	push   %esi
+  802752:	53                   	push   %ebx
+  802753:	e8 71 fe ff ff       	call   8025c9 <munmap>
+		return NULL;
+  802758:	83 c4 10             	add    $0x10,%esp
+  80275b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802760:	eb e4                	jmp    802746 <mmap+0x13e>
+		return NULL;
+  802762:	b8 00 00 00 00       	mov    $0x0,%eax
+  802767:	eb dd                	jmp    802746 <mmap+0x13e>
+		return NULL;
+  802769:	b8 00 00 00 00       	mov    $0x0,%eax
+  80276e:	eb d6                	jmp    802746 <mmap+0x13e>
+  802770:	b8 00 00 00 00       	mov    $0x0,%eax
+  802775:	eb cf                	jmp    802746 <mmap+0x13e>
+
+00802777 <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  802777:	55                   	push   %ebp
+  802778:	89 e5                	mov    %esp,%ebp
+  80277a:	53                   	push   %ebx
+  80277b:	83 ec 10             	sub    $0x10,%esp
+  80277e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802781:	53                   	push   %ebx
+  802782:	e8 25 e4 ff ff       	call   800bac <strlen>
+  802787:	83 c4 10             	add    $0x10,%esp
+  80278a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80278f:	7f 42                	jg     8027d3 <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  802791:	83 ec 0c             	sub    $0xc,%esp
+  802794:	68 04 70 80 00       	push   $0x807004
+  802799:	e8 cb 1b 00 00       	call   804369 <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  80279e:	83 c4 08             	add    $0x8,%esp
+  8027a1:	53                   	push   %ebx
+  8027a2:	68 00 80 80 00       	push   $0x808000
+  8027a7:	e8 3b e4 ff ff       	call   800be7 <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  8027ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027b1:	b8 07 00 00 00       	mov    $0x7,%eax
+  8027b6:	e8 b9 f9 ff ff       	call   802174 <fsipc>
+  8027bb:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8027bd:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  8027c4:	e8 0d 1c 00 00       	call   8043d6 <mutex_unlock>
+	return r;
+  8027c9:	83 c4 10             	add    $0x10,%esp
+}
+  8027cc:	89 d8                	mov    %ebx,%eax
+  8027ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027d1:	c9                   	leave
+  8027d2:	c3                   	ret
+		return -E_BAD_PATH;
+  8027d3:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8027d8:	eb f2                	jmp    8027cc <remove+0x55>
+
+008027da <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8027da:	55                   	push   %ebp
+  8027db:	89 e5                	mov    %esp,%ebp
+  8027dd:	53                   	push   %ebx
+  8027de:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  8027e1:	68 04 70 80 00       	push   $0x807004
+  8027e6:	e8 7e 1b 00 00       	call   804369 <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  8027eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027f0:	b8 08 00 00 00       	mov    $0x8,%eax
+  8027f5:	e8 7a f9 ff ff       	call   802174 <fsipc>
+  8027fa:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8027fc:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  802803:	e8 ce 1b 00 00       	call   8043d6 <mutex_unlock>
+	return r;
+}
+  802808:	89 d8                	mov    %ebx,%eax
+  80280a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80280d:	c9                   	leave
+  80280e:	c3                   	ret
+
+0080280f <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  80280f:	55                   	push   %ebp
+  802810:	89 e5                	mov    %esp,%ebp
+  802812:	56                   	push   %esi
+  802813:	53                   	push   %ebx
+  802814:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  802817:	83 ec 0c             	sub    $0xc,%esp
+  80281a:	68 04 70 80 00       	push   $0x807004
+  80281f:	e8 45 1b 00 00       	call   804369 <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  802824:	8b 45 08             	mov    0x8(%ebp),%eax
+  802827:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  80282c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802831:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802836:	e8 39 f9 ff ff       	call   802174 <fsipc>
+  80283b:	89 c6                	mov    %eax,%esi
+  80283d:	83 c4 10             	add    $0x10,%esp
+  802840:	85 db                	test   %ebx,%ebx
+  802842:	74 7b                	je     8028bf <fs_bcstat+0xb0>
+  802844:	85 c0                	test   %eax,%eax
+  802846:	78 77                	js     8028bf <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  802848:	a1 00 80 80 00       	mov    0x808000,%eax
+  80284d:	89 03                	mov    %eax,(%ebx)
+  80284f:	a1 04 80 80 00       	mov    0x808004,%eax
+  802854:	89 43 04             	mov    %eax,0x4(%ebx)
+  802857:	a1 08 80 80 00       	mov    0x808008,%eax
+  80285c:	89 43 08             	mov    %eax,0x8(%ebx)
+  80285f:	a1 0c 80 80 00       	mov    0x80800c,%eax
+  802864:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802867:	a1 10 80 80 00       	mov    0x808010,%eax
+  80286c:	89 43 10             	mov    %eax,0x10(%ebx)
+  80286f:	a1 14 80 80 00       	mov    0x808014,%eax
+  802874:	89 43 14             	mov    %eax,0x14(%ebx)
+  802877:	a1 18 80 80 00       	mov    0x808018,%eax
+  80287c:	89 43 18             	mov    %eax,0x18(%ebx)
+  80287f:	a1 1c 80 80 00       	mov    0x80801c,%eax
+  802884:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  802887:	a1 20 80 80 00       	mov    0x808020,%eax
+  80288c:	89 43 20             	mov    %eax,0x20(%ebx)
+  80288f:	a1 24 80 80 00       	mov    0x808024,%eax
+  802894:	89 43 24             	mov    %eax,0x24(%ebx)
+  802897:	a1 28 80 80 00       	mov    0x808028,%eax
+  80289c:	89 43 28             	mov    %eax,0x28(%ebx)
+  80289f:	a1 2c 80 80 00       	mov    0x80802c,%eax
+  8028a4:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  8028a7:	a1 30 80 80 00       	mov    0x808030,%eax
+  8028ac:	89 43 30             	mov    %eax,0x30(%ebx)
+  8028af:	a1 34 80 80 00       	mov    0x808034,%eax
+  8028b4:	89 43 34             	mov    %eax,0x34(%ebx)
+  8028b7:	a1 38 80 80 00       	mov    0x808038,%eax
+  8028bc:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  8028bf:	83 ec 0c             	sub    $0xc,%esp
+  8028c2:	68 04 70 80 00       	push   $0x807004
+  8028c7:	e8 0a 1b 00 00       	call   8043d6 <mutex_unlock>
+	return r;
+}
+  8028cc:	89 f0                	mov    %esi,%eax
+  8028ce:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028d1:	5b                   	pop    %ebx
+  8028d2:	5e                   	pop    %esi
+  8028d3:	5d                   	pop    %ebp
+  8028d4:	c3                   	ret
+
+008028d5 <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  8028d5:	55                   	push   %ebp
+  8028d6:	89 e5                	mov    %esp,%ebp
+  8028d8:	56                   	push   %esi
+  8028d9:	53                   	push   %ebx
+  8028da:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  8028dc:	0f b6 10             	movzbl (%eax),%edx
+  8028df:	80 fa 72             	cmp    $0x72,%dl
+  8028e2:	74 44                	je     802928 <parse_mode+0x53>
+  8028e4:	80 fa 77             	cmp    $0x77,%dl
+  8028e7:	74 4b                	je     802934 <parse_mode+0x5f>
+  8028e9:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8028ee:	80 fa 61             	cmp    $0x61,%dl
+  8028f1:	74 09                	je     8028fc <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  8028f3:	89 d8                	mov    %ebx,%eax
+  8028f5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028f8:	5b                   	pop    %ebx
+  8028f9:	5e                   	pop    %esi
+  8028fa:	5d                   	pop    %ebp
+  8028fb:	c3                   	ret
+	switch (mode[0]) {
+  8028fc:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  802901:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  802906:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  802908:	83 ec 08             	sub    $0x8,%esp
+  80290b:	6a 2b                	push   $0x2b
+  80290d:	50                   	push   %eax
+  80290e:	e8 e6 e3 ff ff       	call   800cf9 <strchr>
+  802913:	83 c4 10             	add    $0x10,%esp
+  802916:	85 c0                	test   %eax,%eax
+  802918:	74 d9                	je     8028f3 <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  80291a:	83 e3 fc             	and    $0xfffffffc,%ebx
+  80291d:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  802920:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  802926:	eb cb                	jmp    8028f3 <parse_mode+0x1e>
+	switch (mode[0]) {
+  802928:	ba 01 00 00 00       	mov    $0x1,%edx
+  80292d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802932:	eb d2                	jmp    802906 <parse_mode+0x31>
+  802934:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  802939:	bb 01 03 00 00       	mov    $0x301,%ebx
+  80293e:	eb c6                	jmp    802906 <parse_mode+0x31>
+
+00802940 <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  802940:	55                   	push   %ebp
+  802941:	89 e5                	mov    %esp,%ebp
+  802943:	57                   	push   %edi
+  802944:	56                   	push   %esi
+  802945:	53                   	push   %ebx
+  802946:	83 ec 1c             	sub    $0x1c,%esp
+  802949:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80294c:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  80294f:	b8 44 60 80 00       	mov    $0x806044,%eax
+  802954:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  802959:	83 c0 24             	add    $0x24,%eax
+  80295c:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  802960:	74 17                	je     802979 <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  802962:	83 c3 01             	add    $0x1,%ebx
+  802965:	83 fb 10             	cmp    $0x10,%ebx
+  802968:	75 ef                	jne    802959 <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  80296a:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  80296f:	89 f0                	mov    %esi,%eax
+  802971:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802974:	5b                   	pop    %ebx
+  802975:	5e                   	pop    %esi
+  802976:	5f                   	pop    %edi
+  802977:	5d                   	pop    %ebp
+  802978:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  802979:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  802980:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802983:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  802986:	c1 e7 02             	shl    $0x2,%edi
+  802989:	8d b7 40 60 80 00    	lea    0x806040(%edi),%esi
+  80298f:	83 ec 04             	sub    $0x4,%esp
+  802992:	6a 24                	push   $0x24
+  802994:	6a 00                	push   $0x0
+  802996:	56                   	push   %esi
+  802997:	e8 9c e3 ff ff       	call   800d38 <memset>
+			streams[i].f_fd = fd;
+  80299c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80299f:	89 8f 40 60 80 00    	mov    %ecx,0x806040(%edi)
+			streams[i].f_flags = flags;
+  8029a5:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8029a8:	01 d8                	add    %ebx,%eax
+  8029aa:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8029ad:	89 0c 85 44 60 80 00 	mov    %ecx,0x806044(,%eax,4)
+			return &streams[i];
+  8029b4:	83 c4 10             	add    $0x10,%esp
+  8029b7:	eb b6                	jmp    80296f <stream_alloc+0x2f>
+
+008029b9 <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  8029b9:	55                   	push   %ebp
+  8029ba:	89 e5                	mov    %esp,%ebp
+  8029bc:	53                   	push   %ebx
+  8029bd:	83 ec 14             	sub    $0x14,%esp
+  8029c0:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  8029c2:	8b 40 18             	mov    0x18(%eax),%eax
+  8029c5:	39 43 14             	cmp    %eax,0x14(%ebx)
+  8029c8:	74 4a                	je     802a14 <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  8029ca:	83 ec 08             	sub    $0x8,%esp
+  8029cd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029d0:	50                   	push   %eax
+  8029d1:	ff 33                	push   (%ebx)
+  8029d3:	e8 e2 f1 ff ff       	call   801bba <fd_lookup>
+  8029d8:	89 c2                	mov    %eax,%edx
+  8029da:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8029dd:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  8029e2:	85 d2                	test   %edx,%edx
+  8029e4:	78 41                	js     802a27 <stream_unread+0x6e>
+  8029e6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8029e9:	8b 0d 20 60 80 00    	mov    0x806020,%ecx
+  8029ef:	39 0a                	cmp    %ecx,(%edx)
+  8029f1:	75 34                	jne    802a27 <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  8029f3:	8b 43 14             	mov    0x14(%ebx),%eax
+  8029f6:	03 42 04             	add    0x4(%edx),%eax
+  8029f9:	2b 43 18             	sub    0x18(%ebx),%eax
+  8029fc:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  8029ff:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  802a06:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  802a0d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802a12:	eb 13                	jmp    802a27 <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  802a14:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  802a1b:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  802a22:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802a27:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a2a:	c9                   	leave
+  802a2b:	c3                   	ret
+
+00802a2c <stream_drain>:
+{
+  802a2c:	55                   	push   %ebp
+  802a2d:	89 e5                	mov    %esp,%ebp
+  802a2f:	56                   	push   %esi
+  802a30:	53                   	push   %ebx
+  802a31:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  802a33:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a38:	eb 02                	jmp    802a3c <stream_drain+0x10>
+  802a3a:	01 c3                	add    %eax,%ebx
+  802a3c:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802a3f:	39 c3                	cmp    %eax,%ebx
+  802a41:	73 43                	jae    802a86 <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  802a43:	83 ec 04             	sub    $0x4,%esp
+  802a46:	29 d8                	sub    %ebx,%eax
+  802a48:	50                   	push   %eax
+  802a49:	89 d8                	mov    %ebx,%eax
+  802a4b:	03 46 0c             	add    0xc(%esi),%eax
+  802a4e:	50                   	push   %eax
+  802a4f:	ff 36                	push   (%esi)
+  802a51:	e8 ec f4 ff ff       	call   801f42 <write>
+  802a56:	83 c4 10             	add    $0x10,%esp
+  802a59:	85 c0                	test   %eax,%eax
+  802a5b:	7f dd                	jg     802a3a <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  802a5d:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  802a61:	8b 56 0c             	mov    0xc(%esi),%edx
+  802a64:	83 ec 04             	sub    $0x4,%esp
+  802a67:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802a6a:	29 d8                	sub    %ebx,%eax
+  802a6c:	50                   	push   %eax
+  802a6d:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  802a70:	50                   	push   %eax
+  802a71:	52                   	push   %edx
+  802a72:	e8 f6 e2 ff ff       	call   800d6d <memmove>
+			f->f_wend -= done;
+  802a77:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802a7a:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  802a7c:	83 c4 10             	add    $0x10,%esp
+  802a7f:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  802a84:	eb 0a                	jmp    802a90 <stream_drain+0x64>
+  802a86:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  802a8b:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  802a90:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  802a93:	89 d0                	mov    %edx,%eax
+  802a95:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a98:	5b                   	pop    %ebx
+  802a99:	5e                   	pop    %esi
+  802a9a:	5d                   	pop    %ebp
+  802a9b:	c3                   	ret
+
+00802a9c <stream_setup>:
+	if (f->f_buf)
+  802a9c:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802aa0:	74 01                	je     802aa3 <stream_setup+0x7>
+  802aa2:	c3                   	ret
+{
+  802aa3:	55                   	push   %ebp
+  802aa4:	89 e5                	mov    %esp,%ebp
+  802aa6:	53                   	push   %ebx
+  802aa7:	83 ec 04             	sub    $0x4,%esp
+  802aaa:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  802aac:	8b 40 08             	mov    0x8(%eax),%eax
+  802aaf:	85 c0                	test   %eax,%eax
+  802ab1:	74 17                	je     802aca <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  802ab3:	83 f8 03             	cmp    $0x3,%eax
+  802ab6:	75 2d                	jne    802ae5 <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  802ab8:	8d 43 20             	lea    0x20(%ebx),%eax
+  802abb:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  802abe:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  802ac5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ac8:	c9                   	leave
+  802ac9:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  802aca:	83 ec 0c             	sub    $0xc,%esp
+  802acd:	ff 33                	push   (%ebx)
+  802acf:	e8 33 d9 ff ff       	call   800407 <iscons>
+  802ad4:	83 c4 10             	add    $0x10,%esp
+  802ad7:	85 c0                	test   %eax,%eax
+  802ad9:	0f 9f c0             	setg   %al
+  802adc:	0f b6 c0             	movzbl %al,%eax
+  802adf:	83 c0 01             	add    $0x1,%eax
+  802ae2:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  802ae5:	83 ec 0c             	sub    $0xc,%esp
+  802ae8:	68 00 10 00 00       	push   $0x1000
+  802aed:	e8 8b 11 00 00       	call   803c7d <malloc>
+  802af2:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802af5:	83 c4 10             	add    $0x10,%esp
+  802af8:	85 c0                	test   %eax,%eax
+  802afa:	74 bc                	je     802ab8 <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  802afc:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  802b03:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  802b07:	eb bc                	jmp    802ac5 <stream_setup+0x29>
+
+00802b09 <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  802b09:	55                   	push   %ebp
+  802b0a:	89 e5                	mov    %esp,%ebp
+  802b0c:	53                   	push   %ebx
+  802b0d:	83 ec 04             	sub    $0x4,%esp
+  802b10:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  802b12:	e8 85 ff ff ff       	call   802a9c <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  802b17:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  802b1c:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  802b20:	74 3d                	je     802b5f <stream_fill+0x56>
+  802b22:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  802b26:	74 10                	je     802b38 <stream_fill+0x2f>
+  802b28:	89 d8                	mov    %ebx,%eax
+  802b2a:	e8 fd fe ff ff       	call   802a2c <stream_drain>
+		return 0;
+  802b2f:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  802b34:	85 c0                	test   %eax,%eax
+  802b36:	78 27                	js     802b5f <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  802b38:	83 ec 04             	sub    $0x4,%esp
+  802b3b:	ff 73 10             	push   0x10(%ebx)
+  802b3e:	ff 73 0c             	push   0xc(%ebx)
+  802b41:	ff 33                	push   (%ebx)
+  802b43:	e8 02 f3 ff ff       	call   801e4a <read>
+  802b48:	83 c4 10             	add    $0x10,%esp
+  802b4b:	85 c0                	test   %eax,%eax
+  802b4d:	7e 17                	jle    802b66 <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  802b4f:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  802b53:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  802b5a:	89 c2                	mov    %eax,%edx
+  802b5c:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  802b5f:	89 d0                	mov    %edx,%eax
+  802b61:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b64:	c9                   	leave
+  802b65:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802b66:	c1 f8 1f             	sar    $0x1f,%eax
+  802b69:	83 e0 04             	and    $0x4,%eax
+  802b6c:	83 c0 04             	add    $0x4,%eax
+  802b6f:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  802b72:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b77:	eb e6                	jmp    802b5f <stream_fill+0x56>
+
+00802b79 <fopen>:
+{
+  802b79:	55                   	push   %ebp
+  802b7a:	89 e5                	mov    %esp,%ebp
+  802b7c:	57                   	push   %edi
+  802b7d:	56                   	push   %esi
+  802b7e:	53                   	push   %ebx
+  802b7f:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  802b85:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  802b88:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  802b8e:	89 f0                	mov    %esi,%eax
+  802b90:	e8 40 fd ff ff       	call   8028d5 <parse_mode>
+		return 0;
+  802b95:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  802b9a:	85 c0                	test   %eax,%eax
+  802b9c:	78 2d                	js     802bcb <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  802b9e:	83 ec 08             	sub    $0x8,%esp
+  802ba1:	50                   	push   %eax
+  802ba2:	ff 75 08             	push   0x8(%ebp)
+  802ba5:	e8 e8 f8 ff ff       	call   802492 <open>
+  802baa:	89 c7                	mov    %eax,%edi
+  802bac:	83 c4 10             	add    $0x10,%esp
+  802baf:	85 c0                	test   %eax,%eax
+  802bb1:	78 58                	js     802c0b <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  802bb3:	80 3e 61             	cmpb   $0x61,(%esi)
+  802bb6:	74 1d                	je     802bd5 <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  802bb8:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  802bbe:	89 f8                	mov    %edi,%eax
+  802bc0:	e8 7b fd ff ff       	call   802940 <stream_alloc>
+  802bc5:	89 c3                	mov    %eax,%ebx
+  802bc7:	85 c0                	test   %eax,%eax
+  802bc9:	74 32                	je     802bfd <fopen+0x84>
+}
+  802bcb:	89 d8                	mov    %ebx,%eax
+  802bcd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bd0:	5b                   	pop    %ebx
+  802bd1:	5e                   	pop    %esi
+  802bd2:	5f                   	pop    %edi
+  802bd3:	5d                   	pop    %ebp
+  802bd4:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  802bd5:	83 ec 08             	sub    $0x8,%esp
+  802bd8:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  802bde:	50                   	push   %eax
+  802bdf:	57                   	push   %edi
+  802be0:	e8 db f4 ff ff       	call   8020c0 <fstat>
+  802be5:	83 c4 10             	add    $0x10,%esp
+  802be8:	85 c0                	test   %eax,%eax
+  802bea:	78 cc                	js     802bb8 <fopen+0x3f>
+		seek(fd, st.st_size);
+  802bec:	83 ec 08             	sub    $0x8,%esp
+  802bef:	ff 75 dc             	push   -0x24(%ebp)
+  802bf2:	57                   	push   %edi
+  802bf3:	e8 f6 f3 ff ff       	call   801fee <seek>
+  802bf8:	83 c4 10             	add    $0x10,%esp
+  802bfb:	eb bb                	jmp    802bb8 <fopen+0x3f>
+		close(fd);
+  802bfd:	83 ec 0c             	sub    $0xc,%esp
+  802c00:	57                   	push   %edi
+  802c01:	e8 08 f1 ff ff       	call   801d0e <close>
+  802c06:	83 c4 10             	add    $0x10,%esp
+  802c09:	eb c0                	jmp    802bcb <fopen+0x52>
+		return 0;
+  802c0b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c10:	eb b9                	jmp    802bcb <fopen+0x52>
+
+00802c12 <fdopen>:
+{
+  802c12:	55                   	push   %ebp
+  802c13:	89 e5                	mov    %esp,%ebp
+  802c15:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  802c18:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802c1b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c1e:	e8 b2 fc ff ff       	call   8028d5 <parse_mode>
+  802c23:	89 c2                	mov    %eax,%edx
+		return 0;
+  802c25:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  802c2a:	85 d2                	test   %edx,%edx
+  802c2c:	78 0b                	js     802c39 <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  802c2e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802c31:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c34:	e8 07 fd ff ff       	call   802940 <stream_alloc>
+}
+  802c39:	c9                   	leave
+  802c3a:	c3                   	ret
+
+00802c3b <setvbuf>:
+{
+  802c3b:	55                   	push   %ebp
+  802c3c:	89 e5                	mov    %esp,%ebp
+  802c3e:	57                   	push   %edi
+  802c3f:	56                   	push   %esi
+  802c40:	53                   	push   %ebx
+  802c41:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c44:	8b 55 10             	mov    0x10(%ebp),%edx
+  802c47:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  802c4a:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802c4e:	75 3a                	jne    802c8a <setvbuf+0x4f>
+  802c50:	8d 72 ff             	lea    -0x1(%edx),%esi
+  802c53:	83 fe 02             	cmp    $0x2,%esi
+  802c56:	77 39                	ja     802c91 <setvbuf+0x56>
+	f->f_bufmode = mode;
+  802c58:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  802c5b:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802c5f:	0f 95 c3             	setne  %bl
+  802c62:	85 ff                	test   %edi,%edi
+  802c64:	0f 95 c1             	setne  %cl
+  802c67:	84 cb                	test   %cl,%bl
+  802c69:	74 05                	je     802c70 <setvbuf+0x35>
+  802c6b:	83 fa 03             	cmp    $0x3,%edx
+  802c6e:	75 0a                	jne    802c7a <setvbuf+0x3f>
+	return 0;
+  802c70:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c75:	5b                   	pop    %ebx
+  802c76:	5e                   	pop    %esi
+  802c77:	5f                   	pop    %edi
+  802c78:	5d                   	pop    %ebp
+  802c79:	c3                   	ret
+		f->f_buf = buf;
+  802c7a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802c7d:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  802c80:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  802c83:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c88:	eb eb                	jmp    802c75 <setvbuf+0x3a>
+		return EOF;
+  802c8a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802c8f:	eb e4                	jmp    802c75 <setvbuf+0x3a>
+  802c91:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802c96:	eb dd                	jmp    802c75 <setvbuf+0x3a>
+
+00802c98 <fflush>:
+{
+  802c98:	55                   	push   %ebp
+  802c99:	89 e5                	mov    %esp,%ebp
+  802c9b:	57                   	push   %edi
+  802c9c:	56                   	push   %esi
+  802c9d:	53                   	push   %ebx
+  802c9e:	83 ec 0c             	sub    $0xc,%esp
+  802ca1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  802ca4:	85 db                	test   %ebx,%ebx
+  802ca6:	74 1a                	je     802cc2 <fflush+0x2a>
+	stream_unread(f);
+  802ca8:	89 d8                	mov    %ebx,%eax
+  802caa:	e8 0a fd ff ff       	call   8029b9 <stream_unread>
+	return stream_drain(f);
+  802caf:	89 d8                	mov    %ebx,%eax
+  802cb1:	e8 76 fd ff ff       	call   802a2c <stream_drain>
+  802cb6:	89 c7                	mov    %eax,%edi
+}
+  802cb8:	89 f8                	mov    %edi,%eax
+  802cba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cbd:	5b                   	pop    %ebx
+  802cbe:	5e                   	pop    %esi
+  802cbf:	5f                   	pop    %edi
+  802cc0:	5d                   	pop    %ebp
+  802cc1:	c3                   	ret
+  802cc2:	bb 40 60 80 00       	mov    $0x806040,%ebx
+  802cc7:	be 80 62 80 00       	mov    $0x806280,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  802ccc:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cd1:	eb 03                	jmp    802cd6 <fflush+0x3e>
+  802cd3:	83 c3 24             	add    $0x24,%ebx
+  802cd6:	39 f3                	cmp    %esi,%ebx
+  802cd8:	74 de                	je     802cb8 <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  802cda:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  802cde:	74 f3                	je     802cd3 <fflush+0x3b>
+  802ce0:	83 ec 0c             	sub    $0xc,%esp
+  802ce3:	53                   	push   %ebx
+  802ce4:	e8 af ff ff ff       	call   802c98 <fflush>
+  802ce9:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  802cec:	85 c0                	test   %eax,%eax
+  802cee:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802cf3:	0f 48 f8             	cmovs  %eax,%edi
+  802cf6:	eb db                	jmp    802cd3 <fflush+0x3b>
+
+00802cf8 <fclose>:
+{
+  802cf8:	55                   	push   %ebp
+  802cf9:	89 e5                	mov    %esp,%ebp
+  802cfb:	56                   	push   %esi
+  802cfc:	53                   	push   %ebx
+  802cfd:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  802d00:	83 ec 0c             	sub    $0xc,%esp
+  802d03:	56                   	push   %esi
+  802d04:	e8 8f ff ff ff       	call   802c98 <fflush>
+  802d09:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  802d0b:	83 c4 04             	add    $0x4,%esp
+  802d0e:	ff 36                	push   (%esi)
+  802d10:	e8 f9 ef ff ff       	call   801d0e <close>
+  802d15:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  802d18:	85 c0                	test   %eax,%eax
+  802d1a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802d1f:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  802d22:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  802d26:	75 10                	jne    802d38 <fclose+0x40>
+	f->f_flags = 0;
+  802d28:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  802d2f:	89 d8                	mov    %ebx,%eax
+  802d31:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d34:	5b                   	pop    %ebx
+  802d35:	5e                   	pop    %esi
+  802d36:	5d                   	pop    %ebp
+  802d37:	c3                   	ret
+		free(f->f_buf);
+  802d38:	83 ec 0c             	sub    $0xc,%esp
+  802d3b:	ff 76 0c             	push   0xc(%esi)
+  802d3e:	e8 71 0e 00 00       	call   803bb4 <free>
+  802d43:	83 c4 10             	add    $0x10,%esp
+  802d46:	eb e0                	jmp    802d28 <fclose+0x30>
+
+00802d48 <fileno>:
+{
+  802d48:	55                   	push   %ebp
+  802d49:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  802d4b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d4e:	8b 00                	mov    (%eax),%eax
+}
+  802d50:	5d                   	pop    %ebp
+  802d51:	c3                   	ret
+
+00802d52 <feof>:
+{
+  802d52:	55                   	push   %ebp
+  802d53:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  802d55:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d58:	8b 40 04             	mov    0x4(%eax),%eax
+  802d5b:	c1 e8 02             	shr    $0x2,%eax
+  802d5e:	83 e0 01             	and    $0x1,%eax
+}
+  802d61:	5d                   	pop    %ebp
+  802d62:	c3                   	ret
+
+00802d63 <ferror>:
+{
+  802d63:	55                   	push   %ebp
+  802d64:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  802d66:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d69:	8b 40 04             	mov    0x4(%eax),%eax
+  802d6c:	c1 e8 03             	shr    $0x3,%eax
+  802d6f:	83 e0 01             	and    $0x1,%eax
+}
+  802d72:	5d                   	pop    %ebp
+  802d73:	c3                   	ret
+
+00802d74 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  802d74:	55                   	push   %ebp
+  802d75:	89 e5                	mov    %esp,%ebp
+  802d77:	53                   	push   %ebx
+  802d78:	83 ec 04             	sub    $0x4,%esp
+  802d7b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802d7e:	8b 43 18             	mov    0x18(%ebx),%eax
+  802d81:	39 43 14             	cmp    %eax,0x14(%ebx)
+  802d84:	74 15                	je     802d9b <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  802d86:	8b 53 0c             	mov    0xc(%ebx),%edx
+  802d89:	8b 43 14             	mov    0x14(%ebx),%eax
+  802d8c:	8d 48 01             	lea    0x1(%eax),%ecx
+  802d8f:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  802d92:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  802d96:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d99:	c9                   	leave
+  802d9a:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802d9b:	89 d8                	mov    %ebx,%eax
+  802d9d:	e8 67 fd ff ff       	call   802b09 <stream_fill>
+  802da2:	85 c0                	test   %eax,%eax
+  802da4:	75 e0                	jne    802d86 <fgetc+0x12>
+		return EOF;
+  802da6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802dab:	eb e9                	jmp    802d96 <fgetc+0x22>
+
+00802dad <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  802dad:	55                   	push   %ebp
+  802dae:	89 e5                	mov    %esp,%ebp
+  802db0:	57                   	push   %edi
+  802db1:	56                   	push   %esi
+  802db2:	53                   	push   %ebx
+  802db3:	83 ec 1c             	sub    $0x1c,%esp
+  802db6:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  802db9:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802dbe:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802dc1:	83 e8 01             	sub    $0x1,%eax
+  802dc4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  802dc7:	eb 66                	jmp    802e2f <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  802dc9:	8b 46 14             	mov    0x14(%esi),%eax
+  802dcc:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802dcf:	29 c3                	sub    %eax,%ebx
+  802dd1:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802dd4:	29 fa                	sub    %edi,%edx
+  802dd6:	39 d3                	cmp    %edx,%ebx
+  802dd8:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802ddb:	83 ec 04             	sub    $0x4,%esp
+  802dde:	53                   	push   %ebx
+  802ddf:	6a 0a                	push   $0xa
+  802de1:	03 46 0c             	add    0xc(%esi),%eax
+  802de4:	50                   	push   %eax
+  802de5:	e8 34 e0 ff ff       	call   800e1e <memfind>
+  802dea:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  802ded:	8b 46 0c             	mov    0xc(%esi),%eax
+  802df0:	8b 4e 14             	mov    0x14(%esi),%ecx
+  802df3:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  802df6:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  802df8:	83 c4 10             	add    $0x10,%esp
+  802dfb:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802dfe:	74 0b                	je     802e0b <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  802e00:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802e03:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802e06:	29 d3                	sub    %edx,%ebx
+  802e08:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  802e0b:	83 ec 04             	sub    $0x4,%esp
+  802e0e:	53                   	push   %ebx
+  802e0f:	01 c8                	add    %ecx,%eax
+  802e11:	50                   	push   %eax
+  802e12:	89 f8                	mov    %edi,%eax
+  802e14:	03 45 08             	add    0x8(%ebp),%eax
+  802e17:	50                   	push   %eax
+  802e18:	e8 50 df ff ff       	call   800d6d <memmove>
+		f->f_rpos += m;
+  802e1d:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  802e20:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  802e22:	83 c4 10             	add    $0x10,%esp
+  802e25:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e28:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  802e2d:	74 1f                	je     802e4e <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  802e2f:	8d 47 01             	lea    0x1(%edi),%eax
+  802e32:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  802e35:	73 17                	jae    802e4e <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802e37:	8b 46 18             	mov    0x18(%esi),%eax
+  802e3a:	39 46 14             	cmp    %eax,0x14(%esi)
+  802e3d:	75 8a                	jne    802dc9 <fgets+0x1c>
+  802e3f:	89 f0                	mov    %esi,%eax
+  802e41:	e8 c3 fc ff ff       	call   802b09 <stream_fill>
+  802e46:	85 c0                	test   %eax,%eax
+  802e48:	0f 85 7b ff ff ff    	jne    802dc9 <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  802e4e:	85 ff                	test   %edi,%edi
+  802e50:	74 0f                	je     802e61 <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  802e52:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e55:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  802e59:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e5c:	5b                   	pop    %ebx
+  802e5d:	5e                   	pop    %esi
+  802e5e:	5f                   	pop    %edi
+  802e5f:	5d                   	pop    %ebp
+  802e60:	c3                   	ret
+		return 0;
+  802e61:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e66:	eb f1                	jmp    802e59 <fgets+0xac>
+
+00802e68 <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  802e68:	55                   	push   %ebp
+  802e69:	89 e5                	mov    %esp,%ebp
+  802e6b:	57                   	push   %edi
+  802e6c:	56                   	push   %esi
+  802e6d:	53                   	push   %ebx
+  802e6e:	83 ec 1c             	sub    $0x1c,%esp
+  802e71:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  802e74:	89 f0                	mov    %esi,%eax
+  802e76:	e8 21 fc ff ff       	call   802a9c <stream_setup>
+	want = size * n;
+  802e7b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e7e:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802e82:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  802e85:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e8a:	eb 43                	jmp    802ecf <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  802e8c:	29 d3                	sub    %edx,%ebx
+  802e8e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802e91:	29 f8                	sub    %edi,%eax
+  802e93:	39 c3                	cmp    %eax,%ebx
+  802e95:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  802e98:	83 ec 04             	sub    $0x4,%esp
+  802e9b:	53                   	push   %ebx
+  802e9c:	03 56 0c             	add    0xc(%esi),%edx
+  802e9f:	52                   	push   %edx
+  802ea0:	89 f8                	mov    %edi,%eax
+  802ea2:	03 45 08             	add    0x8(%ebp),%eax
+  802ea5:	50                   	push   %eax
+  802ea6:	e8 c2 de ff ff       	call   800d6d <memmove>
+			f->f_rpos += m;
+  802eab:	01 5e 14             	add    %ebx,0x14(%esi)
+  802eae:	83 c4 10             	add    $0x10,%esp
+  802eb1:	eb 1a                	jmp    802ecd <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  802eb3:	83 ec 04             	sub    $0x4,%esp
+  802eb6:	53                   	push   %ebx
+  802eb7:	89 f8                	mov    %edi,%eax
+  802eb9:	03 45 08             	add    0x8(%ebp),%eax
+  802ebc:	50                   	push   %eax
+  802ebd:	ff 36                	push   (%esi)
+  802ebf:	e8 86 ef ff ff       	call   801e4a <read>
+  802ec4:	89 c3                	mov    %eax,%ebx
+  802ec6:	83 c4 10             	add    $0x10,%esp
+  802ec9:	85 c0                	test   %eax,%eax
+  802ecb:	7e 36                	jle    802f03 <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  802ecd:	01 df                	add    %ebx,%edi
+  802ecf:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802ed2:	39 c7                	cmp    %eax,%edi
+  802ed4:	73 39                	jae    802f0f <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  802ed6:	8b 56 14             	mov    0x14(%esi),%edx
+  802ed9:	8b 5e 18             	mov    0x18(%esi),%ebx
+  802edc:	39 da                	cmp    %ebx,%edx
+  802ede:	72 ac                	jb     802e8c <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  802ee0:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802ee3:	29 fb                	sub    %edi,%ebx
+  802ee5:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  802ee8:	72 3e                	jb     802f28 <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  802eea:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  802eee:	74 1f                	je     802f0f <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  802ef0:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  802ef4:	74 bd                	je     802eb3 <fread+0x4b>
+  802ef6:	89 f0                	mov    %esi,%eax
+  802ef8:	e8 2f fb ff ff       	call   802a2c <stream_drain>
+  802efd:	85 c0                	test   %eax,%eax
+  802eff:	79 b2                	jns    802eb3 <fread+0x4b>
+  802f01:	eb 0c                	jmp    802f0f <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802f03:	c1 fb 1f             	sar    $0x1f,%ebx
+  802f06:	83 e3 04             	and    $0x4,%ebx
+  802f09:	83 c3 04             	add    $0x4,%ebx
+  802f0c:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  802f0f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f12:	85 c0                	test   %eax,%eax
+  802f14:	74 0a                	je     802f20 <fread+0xb8>
+  802f16:	89 f8                	mov    %edi,%eax
+  802f18:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f1d:	f7 75 0c             	divl   0xc(%ebp)
+}
+  802f20:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f23:	5b                   	pop    %ebx
+  802f24:	5e                   	pop    %esi
+  802f25:	5f                   	pop    %edi
+  802f26:	5d                   	pop    %ebp
+  802f27:	c3                   	ret
+		} else if (!stream_fill(f))
+  802f28:	89 f0                	mov    %esi,%eax
+  802f2a:	e8 da fb ff ff       	call   802b09 <stream_fill>
+  802f2f:	85 c0                	test   %eax,%eax
+  802f31:	74 dc                	je     802f0f <fread+0xa7>
+			m = 0;
+  802f33:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f38:	eb 93                	jmp    802ecd <fread+0x65>
+
+00802f3a <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  802f3a:	55                   	push   %ebp
+  802f3b:	89 e5                	mov    %esp,%ebp
+  802f3d:	57                   	push   %edi
+  802f3e:	56                   	push   %esi
+  802f3f:	53                   	push   %ebx
+  802f40:	83 ec 1c             	sub    $0x1c,%esp
+  802f43:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  802f46:	8b 43 04             	mov    0x4(%ebx),%eax
+  802f49:	a8 02                	test   $0x2,%al
+  802f4b:	75 13                	jne    802f60 <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  802f4d:	83 c8 08             	or     $0x8,%eax
+  802f50:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  802f53:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  802f58:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f5b:	5b                   	pop    %ebx
+  802f5c:	5e                   	pop    %esi
+  802f5d:	5f                   	pop    %edi
+  802f5e:	5d                   	pop    %ebp
+  802f5f:	c3                   	ret
+	stream_setup(f);
+  802f60:	89 d8                	mov    %ebx,%eax
+  802f62:	e8 35 fb ff ff       	call   802a9c <stream_setup>
+	want = size * n;
+  802f67:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f6a:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802f6e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  802f71:	89 d8                	mov    %ebx,%eax
+  802f73:	e8 41 fa ff ff       	call   8029b9 <stream_unread>
+	for (done = 0; done < want; ) {
+  802f78:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  802f7d:	84 c0                	test   %al,%al
+  802f7f:	75 7b                	jne    802ffc <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  802f81:	be 00 00 00 00       	mov    $0x0,%esi
+  802f86:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802f89:	39 fe                	cmp    %edi,%esi
+  802f8b:	73 24                	jae    802fb1 <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802f8d:	83 ec 04             	sub    $0x4,%esp
+  802f90:	89 f8                	mov    %edi,%eax
+  802f92:	29 f0                	sub    %esi,%eax
+  802f94:	50                   	push   %eax
+  802f95:	89 f0                	mov    %esi,%eax
+  802f97:	03 45 08             	add    0x8(%ebp),%eax
+  802f9a:	50                   	push   %eax
+  802f9b:	ff 33                	push   (%ebx)
+  802f9d:	e8 a0 ef ff ff       	call   801f42 <write>
+  802fa2:	83 c4 10             	add    $0x10,%esp
+  802fa5:	85 c0                	test   %eax,%eax
+  802fa7:	7e 04                	jle    802fad <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  802fa9:	01 c6                	add    %eax,%esi
+  802fab:	eb dc                	jmp    802f89 <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  802fad:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  802fb1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802fb4:	85 c0                	test   %eax,%eax
+  802fb6:	74 a0                	je     802f58 <fwrite+0x1e>
+  802fb8:	89 f0                	mov    %esi,%eax
+  802fba:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fbf:	f7 75 0c             	divl   0xc(%ebp)
+  802fc2:	eb 94                	jmp    802f58 <fwrite+0x1e>
+			done += r;
+  802fc4:	01 c7                	add    %eax,%edi
+			continue;
+  802fc6:	eb 34                	jmp    802ffc <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  802fc8:	8b 73 10             	mov    0x10(%ebx),%esi
+  802fcb:	29 c6                	sub    %eax,%esi
+  802fcd:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802fd0:	29 fa                	sub    %edi,%edx
+  802fd2:	39 d6                	cmp    %edx,%esi
+  802fd4:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  802fd7:	83 ec 04             	sub    $0x4,%esp
+  802fda:	56                   	push   %esi
+  802fdb:	89 fa                	mov    %edi,%edx
+  802fdd:	03 55 08             	add    0x8(%ebp),%edx
+  802fe0:	52                   	push   %edx
+  802fe1:	03 43 0c             	add    0xc(%ebx),%eax
+  802fe4:	50                   	push   %eax
+  802fe5:	e8 83 dd ff ff       	call   800d6d <memmove>
+		f->f_wend += m;
+  802fea:	89 f0                	mov    %esi,%eax
+  802fec:	03 43 1c             	add    0x1c(%ebx),%eax
+  802fef:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  802ff2:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802ff4:	83 c4 10             	add    $0x10,%esp
+  802ff7:	3b 43 10             	cmp    0x10(%ebx),%eax
+  802ffa:	74 5b                	je     803057 <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  802ffc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802fff:	39 c7                	cmp    %eax,%edi
+  803001:	73 2d                	jae    803030 <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  803003:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  803006:	85 c0                	test   %eax,%eax
+  803008:	75 be                	jne    802fc8 <fwrite+0x8e>
+  80300a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80300d:	29 fa                	sub    %edi,%edx
+  80300f:	3b 53 10             	cmp    0x10(%ebx),%edx
+  803012:	72 b4                	jb     802fc8 <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  803014:	83 ec 04             	sub    $0x4,%esp
+  803017:	52                   	push   %edx
+  803018:	89 f8                	mov    %edi,%eax
+  80301a:	03 45 08             	add    0x8(%ebp),%eax
+  80301d:	50                   	push   %eax
+  80301e:	ff 33                	push   (%ebx)
+  803020:	e8 1d ef ff ff       	call   801f42 <write>
+  803025:	83 c4 10             	add    $0x10,%esp
+  803028:	85 c0                	test   %eax,%eax
+  80302a:	7f 98                	jg     802fc4 <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  80302c:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  803030:	8b 43 08             	mov    0x8(%ebx),%eax
+  803033:	83 f8 03             	cmp    $0x3,%eax
+  803036:	74 48                	je     803080 <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  803038:	83 f8 02             	cmp    $0x2,%eax
+  80303b:	74 27                	je     803064 <fwrite+0x12a>
+	return size ? done / size : 0;
+  80303d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803040:	85 c0                	test   %eax,%eax
+  803042:	0f 84 10 ff ff ff    	je     802f58 <fwrite+0x1e>
+  803048:	89 f8                	mov    %edi,%eax
+  80304a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80304f:	f7 75 0c             	divl   0xc(%ebp)
+  803052:	e9 01 ff ff ff       	jmp    802f58 <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  803057:	89 d8                	mov    %ebx,%eax
+  803059:	e8 ce f9 ff ff       	call   802a2c <stream_drain>
+  80305e:	85 c0                	test   %eax,%eax
+  803060:	79 9a                	jns    802ffc <fwrite+0xc2>
+  803062:	eb cc                	jmp    803030 <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  803064:	83 ec 04             	sub    $0x4,%esp
+  803067:	57                   	push   %edi
+  803068:	6a 0a                	push   $0xa
+  80306a:	ff 75 08             	push   0x8(%ebp)
+  80306d:	e8 ac dd ff ff       	call   800e1e <memfind>
+  803072:	89 c2                	mov    %eax,%edx
+  803074:	89 f8                	mov    %edi,%eax
+  803076:	03 45 08             	add    0x8(%ebp),%eax
+  803079:	83 c4 10             	add    $0x10,%esp
+  80307c:	39 c2                	cmp    %eax,%edx
+  80307e:	74 bd                	je     80303d <fwrite+0x103>
+		stream_drain(f);
+  803080:	89 d8                	mov    %ebx,%eax
+  803082:	e8 a5 f9 ff ff       	call   802a2c <stream_drain>
+  803087:	eb b4                	jmp    80303d <fwrite+0x103>
+
+00803089 <fputc>:
+{
+  803089:	55                   	push   %ebp
+  80308a:	89 e5                	mov    %esp,%ebp
+  80308c:	53                   	push   %ebx
+  80308d:	83 ec 14             	sub    $0x14,%esp
+  803090:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  803093:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  803096:	ff 75 0c             	push   0xc(%ebp)
+  803099:	6a 01                	push   $0x1
+  80309b:	6a 01                	push   $0x1
+  80309d:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8030a0:	50                   	push   %eax
+  8030a1:	e8 94 fe ff ff       	call   802f3a <fwrite>
+  8030a6:	83 c4 10             	add    $0x10,%esp
+  8030a9:	0f b6 db             	movzbl %bl,%ebx
+  8030ac:	83 f8 01             	cmp    $0x1,%eax
+  8030af:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8030b4:	0f 44 c3             	cmove  %ebx,%eax
+}
+  8030b7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8030ba:	c9                   	leave
+  8030bb:	c3                   	ret
+
+008030bc <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  8030bc:	55                   	push   %ebp
+  8030bd:	89 e5                	mov    %esp,%ebp
+  8030bf:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  8030c2:	ff 75 0c             	push   0xc(%ebp)
+  8030c5:	ff 75 08             	push   0x8(%ebp)
+  8030c8:	e8 bc ff ff ff       	call   803089 <fputc>
+}
+  8030cd:	83 c4 10             	add    $0x10,%esp
+  8030d0:	c9                   	leave
+  8030d1:	c3                   	ret
+
+008030d2 <fputs>:
+{
+  8030d2:	55                   	push   %ebp
+  8030d3:	89 e5                	mov    %esp,%ebp
+  8030d5:	56                   	push   %esi
+  8030d6:	53                   	push   %ebx
+  8030d7:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  8030da:	83 ec 0c             	sub    $0xc,%esp
+  8030dd:	56                   	push   %esi
+  8030de:	e8 c9 da ff ff       	call   800bac <strlen>
+  8030e3:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  8030e5:	ff 75 0c             	push   0xc(%ebp)
+  8030e8:	50                   	push   %eax
+  8030e9:	6a 01                	push   $0x1
+  8030eb:	56                   	push   %esi
+  8030ec:	e8 49 fe ff ff       	call   802f3a <fwrite>
+  8030f1:	83 c4 20             	add    $0x20,%esp
+  8030f4:	39 d8                	cmp    %ebx,%eax
+  8030f6:	0f 95 c0             	setne  %al
+  8030f9:	0f b6 c0             	movzbl %al,%eax
+  8030fc:	f7 d8                	neg    %eax
+}
+  8030fe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803101:	5b                   	pop    %ebx
+  803102:	5e                   	pop    %esi
+  803103:	5d                   	pop    %ebp
+  803104:	c3                   	ret
+
+00803105 <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  803105:	55                   	push   %ebp
+  803106:	89 e5                	mov    %esp,%ebp
+  803108:	53                   	push   %ebx
+  803109:	83 ec 04             	sub    $0x4,%esp
+  80310c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80310f:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  803112:	50                   	push   %eax
+  803113:	ff 75 0c             	push   0xc(%ebp)
+  803116:	53                   	push   %ebx
+  803117:	68 bc 30 80 00       	push   $0x8030bc
+  80311c:	e8 d9 d5 ff ff       	call   8006fa <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  803121:	8b 43 04             	mov    0x4(%ebx),%eax
+  803124:	c1 e0 1c             	shl    $0x1c,%eax
+  803127:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  80312a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80312d:	c9                   	leave
+  80312e:	c3                   	ret
+
+0080312f <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  80312f:	55                   	push   %ebp
+  803130:	89 e5                	mov    %esp,%ebp
+  803132:	57                   	push   %edi
+  803133:	56                   	push   %esi
+  803134:	53                   	push   %ebx
+  803135:	81 ec 84 02 00 00    	sub    $0x284,%esp
+	//   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+	//     correct initial eip and esp values in the child.
+	//
+	//   - Start the child process running with sys_env_set_status().
+
+	if ((r = open(prog, O_RDONLY)) < 0)
+  80313b:	6a 00                	push   $0x0
+  80313d:	ff 75 08             	push   0x8(%ebp)
+  803140:	e8 4d f3 ff ff       	call   802492 <open>
+  803145:	89 85 88 fd ff ff    	mov    %eax,-0x278(%ebp)
+  80314b:	83 c4 10             	add    $0x10,%esp
+  80314e:	85 c0                	test   %eax,%eax
+  803150:	0f 88 df 04 00 00    	js     803635 <spawn+0x506>
+  803156:	89 c1                	mov    %eax,%ecx
+		return r;
+	fd = r;
+
+	// Read elf header
+	elf = (struct Elf*) elf_buf;
+	if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf)
+  803158:	83 ec 04             	sub    $0x4,%esp
+  80315b:	68 00 02 00 00       	push   $0x200
+  803160:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  803166:	50                   	push   %eax
+  803167:	51                   	push   %ecx
+  803168:	e8 8e ed ff ff       	call   801efb <readn>
+  80316d:	83 c4 10             	add    $0x10,%esp
+  803170:	3d 00 02 00 00       	cmp    $0x200,%eax
+  803175:	75 5a                	jne    8031d1 <spawn+0xa2>
+	    || elf->e_magic != ELF_MAGIC) {
+  803177:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  80317e:	45 4c 46 
+  803181:	75 4e                	jne    8031d1 <spawn+0xa2>
+  803183:	b8 07 00 00 00       	mov    $0x7,%eax
+  803188:	cd 30                	int    $0x30
+  80318a:	89 85 90 fd ff ff    	mov    %eax,-0x270(%ebp)
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+		return -E_NOT_EXEC;
+	}
+
+	// Create new child environment
+	if ((r = sys_exofork()) < 0)
+  803190:	85 c0                	test   %eax,%eax
+  803192:	0f 88 91 04 00 00    	js     803629 <spawn+0x4fa>
+		return r;
+	child = r;
+
+	// Set up trap frame, including initial stack.
+	child_tf = envs[ENVX(child)].env_tf;
+  803198:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80319d:	8d 34 c0             	lea    (%eax,%eax,8),%esi
+  8031a0:	c1 e6 04             	shl    $0x4,%esi
+  8031a3:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  8031a9:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  8031af:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8031b4:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	child_tf.tf_eip = elf->e_entry;
+  8031b6:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  8031bc:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+	uintptr_t *argv_store;
+
+	// Count the number of arguments (argc)
+	// and the total amount of space needed for strings (string_size).
+	string_size = 0;
+	for (argc = 0; argv[argc] != 0; argc++)
+  8031c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+	string_size = 0;
+  8031c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8031cc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	for (argc = 0; argv[argc] != 0; argc++)
+  8031cf:	eb 4b                	jmp    80321c <spawn+0xed>
+		close(fd);
+  8031d1:	83 ec 0c             	sub    $0xc,%esp
+  8031d4:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  8031da:	e8 2f eb ff ff       	call   801d0e <close>
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  8031df:	83 c4 0c             	add    $0xc,%esp
+  8031e2:	68 7f 45 4c 46       	push   $0x464c457f
+  8031e7:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  8031ed:	68 a8 57 80 00       	push   $0x8057a8
+  8031f2:	e8 0c d4 ff ff       	call   800603 <cprintf>
+		return -E_NOT_EXEC;
+  8031f7:	83 c4 10             	add    $0x10,%esp
+  8031fa:	c7 85 88 fd ff ff f2 	movl   $0xfffffff2,-0x278(%ebp)
+  803201:	ff ff ff 
+  803204:	e9 2c 04 00 00       	jmp    803635 <spawn+0x506>
+		string_size += strlen(argv[argc]) + 1;
+  803209:	83 ec 0c             	sub    $0xc,%esp
+  80320c:	50                   	push   %eax
+  80320d:	e8 9a d9 ff ff       	call   800bac <strlen>
+  803212:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+	for (argc = 0; argv[argc] != 0; argc++)
+  803216:	83 c3 01             	add    $0x1,%ebx
+  803219:	83 c4 10             	add    $0x10,%esp
+  80321c:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  80321f:	85 c0                	test   %eax,%eax
+  803221:	75 e6                	jne    803209 <spawn+0xda>
+	// Determine where to place the strings and the argv array.
+	// Set up pointers into the temporary page 'UTEMP'; we'll map a page
+	// there later, then remap that page into the child environment
+	// at (USTACKTOP - PGSIZE).
+	// strings is the topmost thing on the stack.
+	string_store = (char*) UTEMP + PGSIZE - string_size;
+  803223:	89 9d 84 fd ff ff    	mov    %ebx,-0x27c(%ebp)
+  803229:	bf 00 10 40 00       	mov    $0x401000,%edi
+  80322e:	29 f7                	sub    %esi,%edi
+	// argv is below that.  There's one argument pointer per argument, plus
+	// a null pointer.
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  803230:	89 fa                	mov    %edi,%edx
+  803232:	83 e2 fc             	and    $0xfffffffc,%edx
+  803235:	8d 04 9d 04 00 00 00 	lea    0x4(,%ebx,4),%eax
+  80323c:	29 c2                	sub    %eax,%edx
+  80323e:	89 95 94 fd ff ff    	mov    %edx,-0x26c(%ebp)
+
+	// Make sure that argv, strings, and the 2 words that hold 'argc'
+	// and 'argv' themselves will all fit in a single stack page.
+	if ((void*) (argv_store - 2) < (void*) UTEMP)
+  803244:	8d 42 f8             	lea    -0x8(%edx),%eax
+  803247:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  80324c:	0f 86 06 04 00 00    	jbe    803658 <spawn+0x529>
+		return -E_NO_MEM;
+
+	// Allocate the single stack page at UTEMP.
+	if ((r = sys_page_alloc(0, (void*) UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  803252:	83 ec 04             	sub    $0x4,%esp
+  803255:	6a 07                	push   $0x7
+  803257:	68 00 00 40 00       	push   $0x400000
+  80325c:	6a 00                	push   $0x0
+  80325e:	e8 c2 dd ff ff       	call   801025 <sys_page_alloc>
+  803263:	83 c4 10             	add    $0x10,%esp
+  803266:	85 c0                	test   %eax,%eax
+  803268:	0f 88 ef 03 00 00    	js     80365d <spawn+0x52e>
+	//	  (Again, argv should use an address valid in the child's
+	//	  environment.)
+	//
+	//	* Set *init_esp to the initial stack pointer for the child,
+	//	  (Again, use an address valid in the child's environment.)
+	for (i = 0; i < argc; i++) {
+  80326e:	be 00 00 00 00       	mov    $0x0,%esi
+  803273:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+  803279:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80327c:	39 b5 8c fd ff ff    	cmp    %esi,-0x274(%ebp)
+  803282:	7e 32                	jle    8032b6 <spawn+0x187>
+		argv_store[i] = UTEMP2USTACK(string_store);
+  803284:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  80328a:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  803290:	89 04 b1             	mov    %eax,(%ecx,%esi,4)
+		strcpy(string_store, argv[i]);
+  803293:	83 ec 08             	sub    $0x8,%esp
+  803296:	ff 34 b3             	push   (%ebx,%esi,4)
+  803299:	57                   	push   %edi
+  80329a:	e8 48 d9 ff ff       	call   800be7 <strcpy>
+		string_store += strlen(argv[i]) + 1;
+  80329f:	83 c4 04             	add    $0x4,%esp
+  8032a2:	ff 34 b3             	push   (%ebx,%esi,4)
+  8032a5:	e8 02 d9 ff ff       	call   800bac <strlen>
+  8032aa:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+	for (i = 0; i < argc; i++) {
+  8032ae:	83 c6 01             	add    $0x1,%esi
+  8032b1:	83 c4 10             	add    $0x10,%esp
+  8032b4:	eb c6                	jmp    80327c <spawn+0x14d>
+	}
+	argv_store[argc] = 0;
+  8032b6:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  8032bc:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  8032c2:	c7 04 88 00 00 00 00 	movl   $0x0,(%eax,%ecx,4)
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  8032c9:	81 ff 00 10 40 00    	cmp    $0x401000,%edi
+  8032cf:	0f 85 87 00 00 00    	jne    80335c <spawn+0x22d>
+
+	argv_store[-1] = UTEMP2USTACK(argv_store);
+  8032d5:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  8032db:	8d 81 00 d0 7f ee    	lea    -0x11803000(%ecx),%eax
+  8032e1:	89 41 fc             	mov    %eax,-0x4(%ecx)
+	argv_store[-2] = argc;
+  8032e4:	89 c8                	mov    %ecx,%eax
+  8032e6:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  8032ec:	89 48 f8             	mov    %ecx,-0x8(%eax)
+
+	*init_esp = UTEMP2USTACK(&argv_store[-2]);
+  8032ef:	2d 08 30 80 11       	sub    $0x11803008,%eax
+  8032f4:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+	// After completing the stack, map it into the child's address space
+	// and unmap it from ours!
+	if ((r = sys_page_map(0, UTEMP, child, (void*) (USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  8032fa:	83 ec 0c             	sub    $0xc,%esp
+  8032fd:	6a 07                	push   $0x7
+  8032ff:	68 00 d0 bf ee       	push   $0xeebfd000
+  803304:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  80330a:	68 00 00 40 00       	push   $0x400000
+  80330f:	6a 00                	push   $0x0
+  803311:	e8 5c dd ff ff       	call   801072 <sys_page_map>
+  803316:	89 c3                	mov    %eax,%ebx
+  803318:	83 c4 20             	add    $0x20,%esp
+  80331b:	85 c0                	test   %eax,%eax
+  80331d:	0f 88 98 03 00 00    	js     8036bb <spawn+0x58c>
+		goto error;
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  803323:	83 ec 08             	sub    $0x8,%esp
+  803326:	68 00 00 40 00       	push   $0x400000
+  80332b:	6a 00                	push   $0x0
+  80332d:	e8 8c dd ff ff       	call   8010be <sys_page_unmap>
+  803332:	89 c3                	mov    %eax,%ebx
+  803334:	83 c4 10             	add    $0x10,%esp
+  803337:	85 c0                	test   %eax,%eax
+  803339:	0f 88 7c 03 00 00    	js     8036bb <spawn+0x58c>
+	ph = (struct Proghdr*) (elf_buf + elf->e_phoff);
+  80333f:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  803345:	8d 8c 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%ecx
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  80334c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803351:	89 c8                	mov    %ecx,%eax
+  803353:	89 d1                	mov    %edx,%ecx
+  803355:	89 c2                	mov    %eax,%edx
+  803357:	e9 5a 01 00 00       	jmp    8034b6 <spawn+0x387>
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  80335c:	68 34 58 80 00       	push   $0x805834
+  803361:	68 b1 56 80 00       	push   $0x8056b1
+  803366:	68 06 01 00 00       	push   $0x106
+  80336b:	68 c2 57 80 00       	push   $0x8057c2
+  803370:	e8 b3 d1 ff ff       	call   800528 <_panic>
+			// allocate a blank page
+			if ((r = sys_page_alloc(child, (void*) (va + i), perm)) < 0)
+				return r;
+		} else {
+			// from file
+			if ((r = sys_page_alloc(0, UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  803375:	83 ec 04             	sub    $0x4,%esp
+  803378:	6a 07                	push   $0x7
+  80337a:	68 00 00 40 00       	push   $0x400000
+  80337f:	6a 00                	push   $0x0
+  803381:	e8 9f dc ff ff       	call   801025 <sys_page_alloc>
+  803386:	83 c4 10             	add    $0x10,%esp
+  803389:	85 c0                	test   %eax,%eax
+  80338b:	0f 88 b2 02 00 00    	js     803643 <spawn+0x514>
+				return r;
+			if ((r = seek(fd, fileoffset + i)) < 0)
+  803391:	83 ec 08             	sub    $0x8,%esp
+  803394:	8b 95 80 fd ff ff    	mov    -0x280(%ebp),%edx
+  80339a:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  8033a0:	01 d0                	add    %edx,%eax
+  8033a2:	50                   	push   %eax
+  8033a3:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  8033a9:	e8 40 ec ff ff       	call   801fee <seek>
+  8033ae:	83 c4 10             	add    $0x10,%esp
+  8033b1:	85 c0                	test   %eax,%eax
+  8033b3:	0f 88 91 02 00 00    	js     80364a <spawn+0x51b>
+				return r;
+			if ((r = readn(fd, UTEMP, MIN(PGSIZE, filesz-i))) < 0)
+  8033b9:	83 ec 04             	sub    $0x4,%esp
+  8033bc:	89 fa                	mov    %edi,%edx
+  8033be:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  8033c4:	29 ca                	sub    %ecx,%edx
+  8033c6:	89 d0                	mov    %edx,%eax
+  8033c8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8033cd:	39 d0                	cmp    %edx,%eax
+  8033cf:	0f 47 c2             	cmova  %edx,%eax
+  8033d2:	50                   	push   %eax
+  8033d3:	68 00 00 40 00       	push   $0x400000
+  8033d8:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  8033de:	e8 18 eb ff ff       	call   801efb <readn>
+  8033e3:	83 c4 10             	add    $0x10,%esp
+  8033e6:	85 c0                	test   %eax,%eax
+  8033e8:	0f 88 63 02 00 00    	js     803651 <spawn+0x522>
+				return r;
+			if ((r = sys_page_map(0, UTEMP, child, (void*) (va + i), perm)) < 0)
+  8033ee:	83 ec 0c             	sub    $0xc,%esp
+  8033f1:	ff b5 84 fd ff ff    	push   -0x27c(%ebp)
+  8033f7:	56                   	push   %esi
+  8033f8:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  8033fe:	68 00 00 40 00       	push   $0x400000
+  803403:	6a 00                	push   $0x0
+  803405:	e8 68 dc ff ff       	call   801072 <sys_page_map>
+  80340a:	83 c4 20             	add    $0x20,%esp
+  80340d:	85 c0                	test   %eax,%eax
+  80340f:	78 7e                	js     80348f <spawn+0x360>
+				panic("spawn: sys_page_map data: %e", r);
+			sys_page_unmap(0, UTEMP);
+  803411:	83 ec 08             	sub    $0x8,%esp
+  803414:	68 00 00 40 00       	push   $0x400000
+  803419:	6a 00                	push   $0x0
+  80341b:	e8 9e dc ff ff       	call   8010be <sys_page_unmap>
+  803420:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < memsz; i += PGSIZE) {
+  803423:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803429:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80342f:	89 9d 94 fd ff ff    	mov    %ebx,-0x26c(%ebp)
+  803435:	8b 85 8c fd ff ff    	mov    -0x274(%ebp),%eax
+  80343b:	39 c3                	cmp    %eax,%ebx
+  80343d:	73 65                	jae    8034a4 <spawn+0x375>
+		if (i >= filesz) {
+  80343f:	39 fb                	cmp    %edi,%ebx
+  803441:	0f 82 2e ff ff ff    	jb     803375 <spawn+0x246>
+			if ((r = sys_page_alloc(child, (void*) (va + i), perm)) < 0)
+  803447:	83 ec 04             	sub    $0x4,%esp
+  80344a:	ff b5 84 fd ff ff    	push   -0x27c(%ebp)
+  803450:	56                   	push   %esi
+  803451:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  803457:	e8 c9 db ff ff       	call   801025 <sys_page_alloc>
+  80345c:	83 c4 10             	add    $0x10,%esp
+  80345f:	85 c0                	test   %eax,%eax
+  803461:	79 c0                	jns    803423 <spawn+0x2f4>
+  803463:	89 c7                	mov    %eax,%edi
+	sys_env_destroy(child);
+  803465:	83 ec 0c             	sub    $0xc,%esp
+  803468:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  80346e:	e8 0f db ff ff       	call   800f82 <sys_env_destroy>
+	close(fd);
+  803473:	83 c4 04             	add    $0x4,%esp
+  803476:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  80347c:	e8 8d e8 ff ff       	call   801d0e <close>
+	return r;
+  803481:	83 c4 10             	add    $0x10,%esp
+  803484:	89 bd 88 fd ff ff    	mov    %edi,-0x278(%ebp)
+  80348a:	e9 a6 01 00 00       	jmp    803635 <spawn+0x506>
+				panic("spawn: sys_page_map data: %e", r);
+  80348f:	50                   	push   %eax
+  803490:	68 ce 57 80 00       	push   $0x8057ce
+  803495:	68 39 01 00 00       	push   $0x139
+  80349a:	68 c2 57 80 00       	push   $0x8057c2
+  80349f:	e8 84 d0 ff ff       	call   800528 <_panic>
+  8034a4:	8b 8d 7c fd ff ff    	mov    -0x284(%ebp),%ecx
+  8034aa:	8b 95 78 fd ff ff    	mov    -0x288(%ebp),%edx
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  8034b0:	83 c1 01             	add    $0x1,%ecx
+  8034b3:	83 c2 20             	add    $0x20,%edx
+  8034b6:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  8034bd:	39 c8                	cmp    %ecx,%eax
+  8034bf:	0f 8e 88 00 00 00    	jle    80354d <spawn+0x41e>
+		if (ph->p_type != ELF_PROG_LOAD)
+  8034c5:	83 3a 01             	cmpl   $0x1,(%edx)
+  8034c8:	75 e6                	jne    8034b0 <spawn+0x381>
+		if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  8034ca:	8b 42 18             	mov    0x18(%edx),%eax
+  8034cd:	83 e0 02             	and    $0x2,%eax
+		perm = PTE_P | PTE_U;
+  8034d0:	83 f8 01             	cmp    $0x1,%eax
+  8034d3:	19 c0                	sbb    %eax,%eax
+  8034d5:	83 e0 fe             	and    $0xfffffffe,%eax
+  8034d8:	83 c0 07             	add    $0x7,%eax
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  8034db:	8b 72 04             	mov    0x4(%edx),%esi
+  8034de:	89 b5 80 fd ff ff    	mov    %esi,-0x280(%ebp)
+  8034e4:	8b 7a 10             	mov    0x10(%edx),%edi
+  8034e7:	89 bd 94 fd ff ff    	mov    %edi,-0x26c(%ebp)
+  8034ed:	8b 5a 14             	mov    0x14(%edx),%ebx
+  8034f0:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+  8034f6:	8b 7a 08             	mov    0x8(%edx),%edi
+  8034f9:	89 bd 84 fd ff ff    	mov    %edi,-0x27c(%ebp)
+	if ((i = PGOFF(va))) {
+  8034ff:	89 fb                	mov    %edi,%ebx
+  803501:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  803507:	74 1c                	je     803525 <spawn+0x3f6>
+		va -= i;
+  803509:	29 df                	sub    %ebx,%edi
+  80350b:	89 bd 84 fd ff ff    	mov    %edi,-0x27c(%ebp)
+		memsz += i;
+  803511:	01 9d 8c fd ff ff    	add    %ebx,-0x274(%ebp)
+		filesz += i;
+  803517:	01 9d 94 fd ff ff    	add    %ebx,-0x26c(%ebp)
+		fileoffset -= i;
+  80351d:	29 de                	sub    %ebx,%esi
+  80351f:	89 b5 80 fd ff ff    	mov    %esi,-0x280(%ebp)
+	for (i = 0; i < memsz; i += PGSIZE) {
+  803525:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80352a:	8b bd 94 fd ff ff    	mov    -0x26c(%ebp),%edi
+  803530:	8b b5 84 fd ff ff    	mov    -0x27c(%ebp),%esi
+  803536:	89 8d 7c fd ff ff    	mov    %ecx,-0x284(%ebp)
+  80353c:	89 95 78 fd ff ff    	mov    %edx,-0x288(%ebp)
+  803542:	89 85 84 fd ff ff    	mov    %eax,-0x27c(%ebp)
+  803548:	e9 e2 fe ff ff       	jmp    80342f <spawn+0x300>
+	close(fd);
+  80354d:	83 ec 0c             	sub    $0xc,%esp
+  803550:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  803556:	e8 b3 e7 ff ff       	call   801d0e <close>
+  80355b:	83 c4 10             	add    $0x10,%esp
+	// LAB 5: Your code here.
+	int r;
+	extern volatile pte_t uvpt[];     // VA of "virtual page table"
+	extern volatile pde_t uvpd[];     // VA of current page directory
+
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80355e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803563:	eb 75                	jmp    8035da <spawn+0x4ab>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+			int entry_num = NPTENTRIES;
+			if (pdeno == PDX(UTOP-1)) {
+				entry_num = PTX(UTOP-1)+1;
+			}
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  803565:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80356b:	83 c6 01             	add    $0x1,%esi
+  80356e:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+  803574:	74 4f                	je     8035c5 <spawn+0x496>
+				pte_t pte = uvpt[pdeno * NPDENTRIES + pteno];
+  803576:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+				if ((pte & PTE_P) && (pte & PTE_U) && (pte & PTE_SHARE)) {
+  80357d:	89 c2                	mov    %eax,%edx
+  80357f:	81 e2 05 04 00 00    	and    $0x405,%edx
+  803585:	81 fa 05 04 00 00    	cmp    $0x405,%edx
+  80358b:	75 d8                	jne    803565 <spawn+0x436>
+					void* va = (void*)PGADDR(pdeno, pteno, 0);
+  80358d:	89 da                	mov    %ebx,%edx
+  80358f:	09 fa                	or     %edi,%edx
+					if ((r = sys_page_map(0, va, child, va, pte & PTE_SYSCALL)) < 0) {
+  803591:	83 ec 0c             	sub    $0xc,%esp
+  803594:	25 07 0e 00 00       	and    $0xe07,%eax
+  803599:	50                   	push   %eax
+  80359a:	52                   	push   %edx
+  80359b:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  8035a1:	52                   	push   %edx
+  8035a2:	6a 00                	push   $0x0
+  8035a4:	e8 c9 da ff ff       	call   801072 <sys_page_map>
+  8035a9:	83 c4 20             	add    $0x20,%esp
+  8035ac:	85 c0                	test   %eax,%eax
+  8035ae:	79 b5                	jns    803565 <spawn+0x436>
+		panic("copy_shared_pages: %e", r);
+  8035b0:	50                   	push   %eax
+  8035b1:	68 1c 58 80 00       	push   $0x80581c
+  8035b6:	68 94 00 00 00       	push   $0x94
+  8035bb:	68 c2 57 80 00       	push   $0x8057c2
+  8035c0:	e8 63 cf ff ff       	call   800528 <_panic>
+  8035c5:	8b 95 94 fd ff ff    	mov    -0x26c(%ebp),%edx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8035cb:	83 c2 01             	add    $0x1,%edx
+  8035ce:	81 fa bb 03 00 00    	cmp    $0x3bb,%edx
+  8035d4:	0f 84 8b 00 00 00    	je     803665 <spawn+0x536>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  8035da:	8b 04 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%eax
+  8035e1:	a8 07                	test   $0x7,%al
+  8035e3:	74 e6                	je     8035cb <spawn+0x49c>
+  8035e5:	89 d6                	mov    %edx,%esi
+  8035e7:	c1 e6 0a             	shl    $0xa,%esi
+  8035ea:	89 d7                	mov    %edx,%edi
+  8035ec:	c1 e7 16             	shl    $0x16,%edi
+  8035ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8035f4:	89 95 94 fd ff ff    	mov    %edx,-0x26c(%ebp)
+  8035fa:	e9 77 ff ff ff       	jmp    803576 <spawn+0x447>
+		panic("sys_env_set_trapframe: %e", r);
+  8035ff:	50                   	push   %eax
+  803600:	68 eb 57 80 00       	push   $0x8057eb
+  803605:	68 98 00 00 00       	push   $0x98
+  80360a:	68 c2 57 80 00       	push   $0x8057c2
+  80360f:	e8 14 cf ff ff       	call   800528 <_panic>
+		panic("sys_env_set_status: %e", r);
+  803614:	50                   	push   %eax
+  803615:	68 05 58 80 00       	push   $0x805805
+  80361a:	68 9b 00 00 00       	push   $0x9b
+  80361f:	68 c2 57 80 00       	push   $0x8057c2
+  803624:	e8 ff ce ff ff       	call   800528 <_panic>
+		return r;
+  803629:	8b 85 90 fd ff ff    	mov    -0x270(%ebp),%eax
+  80362f:	89 85 88 fd ff ff    	mov    %eax,-0x278(%ebp)
+}
+  803635:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  80363b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80363e:	5b                   	pop    %ebx
+  80363f:	5e                   	pop    %esi
+  803640:	5f                   	pop    %edi
+  803641:	5d                   	pop    %ebp
+  803642:	c3                   	ret
+  803643:	89 c7                	mov    %eax,%edi
+  803645:	e9 1b fe ff ff       	jmp    803465 <spawn+0x336>
+  80364a:	89 c7                	mov    %eax,%edi
+  80364c:	e9 14 fe ff ff       	jmp    803465 <spawn+0x336>
+  803651:	89 c7                	mov    %eax,%edi
+  803653:	e9 0d fe ff ff       	jmp    803465 <spawn+0x336>
+		return -E_NO_MEM;
+  803658:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+	return r;
+  80365d:	89 85 88 fd ff ff    	mov    %eax,-0x278(%ebp)
+  803663:	eb d0                	jmp    803635 <spawn+0x506>
+	child_tf.tf_eflags |= FL_IOPL_3;   // devious: see user/faultio.c
+  803665:	81 8d dc fd ff ff 00 	orl    $0x3000,-0x224(%ebp)
+  80366c:	30 00 00 
+	if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  80366f:	83 ec 08             	sub    $0x8,%esp
+  803672:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  803678:	50                   	push   %eax
+  803679:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  80367f:	e8 d2 da ff ff       	call   801156 <sys_env_set_trapframe>
+  803684:	83 c4 10             	add    $0x10,%esp
+  803687:	85 c0                	test   %eax,%eax
+  803689:	0f 88 70 ff ff ff    	js     8035ff <spawn+0x4d0>
+	if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  80368f:	83 ec 08             	sub    $0x8,%esp
+  803692:	6a 02                	push   $0x2
+  803694:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  80369a:	e8 6b da ff ff       	call   80110a <sys_env_set_status>
+  80369f:	83 c4 10             	add    $0x10,%esp
+  8036a2:	85 c0                	test   %eax,%eax
+  8036a4:	0f 88 6a ff ff ff    	js     803614 <spawn+0x4e5>
+	return child;
+  8036aa:	8b 85 90 fd ff ff    	mov    -0x270(%ebp),%eax
+  8036b0:	89 85 88 fd ff ff    	mov    %eax,-0x278(%ebp)
+  8036b6:	e9 7a ff ff ff       	jmp    803635 <spawn+0x506>
+	sys_page_unmap(0, UTEMP);
+  8036bb:	83 ec 08             	sub    $0x8,%esp
+  8036be:	68 00 00 40 00       	push   $0x400000
+  8036c3:	6a 00                	push   $0x0
+  8036c5:	e8 f4 d9 ff ff       	call   8010be <sys_page_unmap>
+  8036ca:	83 c4 10             	add    $0x10,%esp
+  8036cd:	89 9d 88 fd ff ff    	mov    %ebx,-0x278(%ebp)
+  8036d3:	e9 5d ff ff ff       	jmp    803635 <spawn+0x506>
+
+008036d8 <spawnl>:
+{
+  8036d8:	55                   	push   %ebp
+  8036d9:	89 e5                	mov    %esp,%ebp
+  8036db:	56                   	push   %esi
+  8036dc:	53                   	push   %ebx
+	va_start(vl, arg0);
+  8036dd:	8d 55 10             	lea    0x10(%ebp),%edx
+	int argc=0;
+  8036e0:	b8 00 00 00 00       	mov    $0x0,%eax
+	while(va_arg(vl, void *) != NULL)
+  8036e5:	eb 05                	jmp    8036ec <spawnl+0x14>
+		argc++;
+  8036e7:	83 c0 01             	add    $0x1,%eax
+	while(va_arg(vl, void *) != NULL)
+  8036ea:	89 ca                	mov    %ecx,%edx
+  8036ec:	8d 4a 04             	lea    0x4(%edx),%ecx
+  8036ef:	83 3a 00             	cmpl   $0x0,(%edx)
+  8036f2:	75 f3                	jne    8036e7 <spawnl+0xf>
+	const char *argv[argc+2];
+  8036f4:	8d 14 85 17 00 00 00 	lea    0x17(,%eax,4),%edx
+  8036fb:	83 e2 f0             	and    $0xfffffff0,%edx
+  8036fe:	29 d4                	sub    %edx,%esp
+  803700:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  803704:	89 da                	mov    %ebx,%edx
+  803706:	c1 ea 02             	shr    $0x2,%edx
+  803709:	83 e3 fc             	and    $0xfffffffc,%ebx
+	argv[0] = arg0;
+  80370c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80370f:	89 0c 95 00 00 00 00 	mov    %ecx,0x0(,%edx,4)
+	argv[argc+1] = NULL;
+  803716:	c7 44 83 04 00 00 00 	movl   $0x0,0x4(%ebx,%eax,4)
+  80371d:	00 
+	va_start(vl, arg0);
+  80371e:	8d 4d 10             	lea    0x10(%ebp),%ecx
+	for(i=0;i<argc;i++)
+  803721:	89 c2                	mov    %eax,%edx
+  803723:	b8 00 00 00 00       	mov    $0x0,%eax
+  803728:	eb 0b                	jmp    803735 <spawnl+0x5d>
+		argv[i+1] = va_arg(vl, const char *);
+  80372a:	83 c0 01             	add    $0x1,%eax
+  80372d:	8b 31                	mov    (%ecx),%esi
+  80372f:	89 34 83             	mov    %esi,(%ebx,%eax,4)
+  803732:	8d 49 04             	lea    0x4(%ecx),%ecx
+	for(i=0;i<argc;i++)
+  803735:	39 d0                	cmp    %edx,%eax
+  803737:	75 f1                	jne    80372a <spawnl+0x52>
+	return spawn(prog, argv);
+  803739:	83 ec 08             	sub    $0x8,%esp
+  80373c:	53                   	push   %ebx
+  80373d:	ff 75 08             	push   0x8(%ebp)
+  803740:	e8 ea f9 ff ff       	call   80312f <spawn>
+}
+  803745:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803748:	5b                   	pop    %ebx
+  803749:	5e                   	pop    %esi
+  80374a:	5d                   	pop    %ebp
+  80374b:	c3                   	ret
+
+0080374c <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80374c:	55                   	push   %ebp
+  80374d:	89 e5                	mov    %esp,%ebp
+  80374f:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  803752:	68 5a 58 80 00       	push   $0x80585a
+  803757:	ff 75 0c             	push   0xc(%ebp)
+  80375a:	e8 88 d4 ff ff       	call   800be7 <strcpy>
+	return 0;
+}
+  80375f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803764:	c9                   	leave
+  803765:	c3                   	ret
+
+00803766 <devsock_close>:
+{
+  803766:	55                   	push   %ebp
+  803767:	89 e5                	mov    %esp,%ebp
+  803769:	53                   	push   %ebx
+  80376a:	83 ec 10             	sub    $0x10,%esp
+  80376d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  803770:	53                   	push   %ebx
+  803771:	e8 ee 15 00 00       	call   804d64 <pageref>
+  803776:	89 c2                	mov    %eax,%edx
+  803778:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80377b:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  803780:	83 fa 01             	cmp    $0x1,%edx
+  803783:	74 05                	je     80378a <devsock_close+0x24>
+}
+  803785:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803788:	c9                   	leave
+  803789:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80378a:	83 ec 0c             	sub    $0xc,%esp
+  80378d:	ff 73 0c             	push   0xc(%ebx)
+  803790:	e8 b7 02 00 00       	call   803a4c <nsipc_close>
+  803795:	83 c4 10             	add    $0x10,%esp
+  803798:	eb eb                	jmp    803785 <devsock_close+0x1f>
+
+0080379a <devsock_write>:
+{
+  80379a:	55                   	push   %ebp
+  80379b:	89 e5                	mov    %esp,%ebp
+  80379d:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8037a0:	6a 00                	push   $0x0
+  8037a2:	ff 75 10             	push   0x10(%ebp)
+  8037a5:	ff 75 0c             	push   0xc(%ebp)
+  8037a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037ab:	ff 70 0c             	push   0xc(%eax)
+  8037ae:	e8 79 03 00 00       	call   803b2c <nsipc_send>
+}
+  8037b3:	c9                   	leave
+  8037b4:	c3                   	ret
+
+008037b5 <devsock_read>:
+{
+  8037b5:	55                   	push   %ebp
+  8037b6:	89 e5                	mov    %esp,%ebp
+  8037b8:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8037bb:	6a 00                	push   $0x0
+  8037bd:	ff 75 10             	push   0x10(%ebp)
+  8037c0:	ff 75 0c             	push   0xc(%ebp)
+  8037c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037c6:	ff 70 0c             	push   0xc(%eax)
+  8037c9:	e8 ef 02 00 00       	call   803abd <nsipc_recv>
+}
+  8037ce:	c9                   	leave
+  8037cf:	c3                   	ret
+
+008037d0 <fd2sockid>:
+{
+  8037d0:	55                   	push   %ebp
+  8037d1:	89 e5                	mov    %esp,%ebp
+  8037d3:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8037d6:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8037d9:	52                   	push   %edx
+  8037da:	50                   	push   %eax
+  8037db:	e8 da e3 ff ff       	call   801bba <fd_lookup>
+  8037e0:	83 c4 10             	add    $0x10,%esp
+  8037e3:	85 c0                	test   %eax,%eax
+  8037e5:	78 10                	js     8037f7 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8037e7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8037ea:	8b 0d 80 62 80 00    	mov    0x806280,%ecx
+  8037f0:	39 08                	cmp    %ecx,(%eax)
+  8037f2:	75 05                	jne    8037f9 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8037f4:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8037f7:	c9                   	leave
+  8037f8:	c3                   	ret
+		return -E_NOT_SUPP;
+  8037f9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8037fe:	eb f7                	jmp    8037f7 <fd2sockid+0x27>
+
+00803800 <alloc_sockfd>:
+{
+  803800:	55                   	push   %ebp
+  803801:	89 e5                	mov    %esp,%ebp
+  803803:	56                   	push   %esi
+  803804:	53                   	push   %ebx
+  803805:	83 ec 1c             	sub    $0x1c,%esp
+  803808:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  80380a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80380d:	50                   	push   %eax
+  80380e:	e8 51 e3 ff ff       	call   801b64 <fd_alloc>
+  803813:	89 c3                	mov    %eax,%ebx
+  803815:	83 c4 10             	add    $0x10,%esp
+  803818:	85 c0                	test   %eax,%eax
+  80381a:	78 43                	js     80385f <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80381c:	83 ec 04             	sub    $0x4,%esp
+  80381f:	68 07 04 00 00       	push   $0x407
+  803824:	ff 75 f4             	push   -0xc(%ebp)
+  803827:	6a 00                	push   $0x0
+  803829:	e8 f7 d7 ff ff       	call   801025 <sys_page_alloc>
+  80382e:	89 c3                	mov    %eax,%ebx
+  803830:	83 c4 10             	add    $0x10,%esp
+  803833:	85 c0                	test   %eax,%eax
+  803835:	78 28                	js     80385f <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  803837:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80383a:	8b 15 80 62 80 00    	mov    0x806280,%edx
+  803840:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  803842:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803845:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80384c:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  80384f:	83 ec 0c             	sub    $0xc,%esp
+  803852:	50                   	push   %eax
+  803853:	e8 e5 e2 ff ff       	call   801b3d <fd2num>
+  803858:	89 c3                	mov    %eax,%ebx
+  80385a:	83 c4 10             	add    $0x10,%esp
+  80385d:	eb 0c                	jmp    80386b <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  80385f:	83 ec 0c             	sub    $0xc,%esp
+  803862:	56                   	push   %esi
+  803863:	e8 e4 01 00 00       	call   803a4c <nsipc_close>
+		return r;
+  803868:	83 c4 10             	add    $0x10,%esp
+}
+  80386b:	89 d8                	mov    %ebx,%eax
+  80386d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803870:	5b                   	pop    %ebx
+  803871:	5e                   	pop    %esi
+  803872:	5d                   	pop    %ebp
+  803873:	c3                   	ret
+
+00803874 <accept>:
+{
+  803874:	55                   	push   %ebp
+  803875:	89 e5                	mov    %esp,%ebp
+  803877:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80387a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80387d:	e8 4e ff ff ff       	call   8037d0 <fd2sockid>
+  803882:	85 c0                	test   %eax,%eax
+  803884:	78 1b                	js     8038a1 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  803886:	83 ec 04             	sub    $0x4,%esp
+  803889:	ff 75 10             	push   0x10(%ebp)
+  80388c:	ff 75 0c             	push   0xc(%ebp)
+  80388f:	50                   	push   %eax
+  803890:	e8 0e 01 00 00       	call   8039a3 <nsipc_accept>
+  803895:	83 c4 10             	add    $0x10,%esp
+  803898:	85 c0                	test   %eax,%eax
+  80389a:	78 05                	js     8038a1 <accept+0x2d>
+	return alloc_sockfd(r);
+  80389c:	e8 5f ff ff ff       	call   803800 <alloc_sockfd>
+}
+  8038a1:	c9                   	leave
+  8038a2:	c3                   	ret
+
+008038a3 <bind>:
+{
+  8038a3:	55                   	push   %ebp
+  8038a4:	89 e5                	mov    %esp,%ebp
+  8038a6:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8038a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8038ac:	e8 1f ff ff ff       	call   8037d0 <fd2sockid>
+  8038b1:	85 c0                	test   %eax,%eax
+  8038b3:	78 12                	js     8038c7 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8038b5:	83 ec 04             	sub    $0x4,%esp
+  8038b8:	ff 75 10             	push   0x10(%ebp)
+  8038bb:	ff 75 0c             	push   0xc(%ebp)
+  8038be:	50                   	push   %eax
+  8038bf:	e8 31 01 00 00       	call   8039f5 <nsipc_bind>
+  8038c4:	83 c4 10             	add    $0x10,%esp
+}
+  8038c7:	c9                   	leave
+  8038c8:	c3                   	ret
+
+008038c9 <shutdown>:
+{
+  8038c9:	55                   	push   %ebp
+  8038ca:	89 e5                	mov    %esp,%ebp
+  8038cc:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8038cf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8038d2:	e8 f9 fe ff ff       	call   8037d0 <fd2sockid>
+  8038d7:	85 c0                	test   %eax,%eax
+  8038d9:	78 0f                	js     8038ea <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8038db:	83 ec 08             	sub    $0x8,%esp
+  8038de:	ff 75 0c             	push   0xc(%ebp)
+  8038e1:	50                   	push   %eax
+  8038e2:	e8 43 01 00 00       	call   803a2a <nsipc_shutdown>
+  8038e7:	83 c4 10             	add    $0x10,%esp
+}
+  8038ea:	c9                   	leave
+  8038eb:	c3                   	ret
+
+008038ec <connect>:
+{
+  8038ec:	55                   	push   %ebp
+  8038ed:	89 e5                	mov    %esp,%ebp
+  8038ef:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8038f2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8038f5:	e8 d6 fe ff ff       	call   8037d0 <fd2sockid>
+  8038fa:	85 c0                	test   %eax,%eax
+  8038fc:	78 12                	js     803910 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8038fe:	83 ec 04             	sub    $0x4,%esp
+  803901:	ff 75 10             	push   0x10(%ebp)
+  803904:	ff 75 0c             	push   0xc(%ebp)
+  803907:	50                   	push   %eax
+  803908:	e8 59 01 00 00       	call   803a66 <nsipc_connect>
+  80390d:	83 c4 10             	add    $0x10,%esp
+}
+  803910:	c9                   	leave
+  803911:	c3                   	ret
+
+00803912 <listen>:
+{
+  803912:	55                   	push   %ebp
+  803913:	89 e5                	mov    %esp,%ebp
+  803915:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803918:	8b 45 08             	mov    0x8(%ebp),%eax
+  80391b:	e8 b0 fe ff ff       	call   8037d0 <fd2sockid>
+  803920:	85 c0                	test   %eax,%eax
+  803922:	78 0f                	js     803933 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  803924:	83 ec 08             	sub    $0x8,%esp
+  803927:	ff 75 0c             	push   0xc(%ebp)
+  80392a:	50                   	push   %eax
+  80392b:	e8 6b 01 00 00       	call   803a9b <nsipc_listen>
+  803930:	83 c4 10             	add    $0x10,%esp
+}
+  803933:	c9                   	leave
+  803934:	c3                   	ret
+
+00803935 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  803935:	55                   	push   %ebp
+  803936:	89 e5                	mov    %esp,%ebp
+  803938:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80393b:	ff 75 10             	push   0x10(%ebp)
+  80393e:	ff 75 0c             	push   0xc(%ebp)
+  803941:	ff 75 08             	push   0x8(%ebp)
+  803944:	e8 41 02 00 00       	call   803b8a <nsipc_socket>
+  803949:	83 c4 10             	add    $0x10,%esp
+  80394c:	85 c0                	test   %eax,%eax
+  80394e:	78 05                	js     803955 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  803950:	e8 ab fe ff ff       	call   803800 <alloc_sockfd>
+}
+  803955:	c9                   	leave
+  803956:	c3                   	ret
+
+00803957 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  803957:	55                   	push   %ebp
+  803958:	89 e5                	mov    %esp,%ebp
+  80395a:	53                   	push   %ebx
+  80395b:	83 ec 04             	sub    $0x4,%esp
+  80395e:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  803960:	83 3d 08 70 80 00 00 	cmpl   $0x0,0x807008
+  803967:	74 26                	je     80398f <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  803969:	6a 07                	push   $0x7
+  80396b:	68 00 90 80 00       	push   $0x809000
+  803970:	53                   	push   %ebx
+  803971:	ff 35 08 70 80 00    	push   0x807008
+  803977:	e8 53 13 00 00       	call   804ccf <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  80397c:	83 c4 0c             	add    $0xc,%esp
+  80397f:	6a 00                	push   $0x0
+  803981:	6a 00                	push   $0x0
+  803983:	6a 00                	push   $0x0
+  803985:	e8 4f 12 00 00       	call   804bd9 <ipc_recv>
+}
+  80398a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80398d:	c9                   	leave
+  80398e:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80398f:	83 ec 0c             	sub    $0xc,%esp
+  803992:	6a 02                	push   $0x2
+  803994:	e8 8c 13 00 00       	call   804d25 <ipc_find_env>
+  803999:	a3 08 70 80 00       	mov    %eax,0x807008
+  80399e:	83 c4 10             	add    $0x10,%esp
+  8039a1:	eb c6                	jmp    803969 <nsipc+0x12>
+
+008039a3 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8039a3:	55                   	push   %ebp
+  8039a4:	89 e5                	mov    %esp,%ebp
+  8039a6:	56                   	push   %esi
+  8039a7:	53                   	push   %ebx
+  8039a8:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8039ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  8039ae:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  8039b3:	8b 06                	mov    (%esi),%eax
+  8039b5:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8039ba:	b8 01 00 00 00       	mov    $0x1,%eax
+  8039bf:	e8 93 ff ff ff       	call   803957 <nsipc>
+  8039c4:	89 c3                	mov    %eax,%ebx
+  8039c6:	85 c0                	test   %eax,%eax
+  8039c8:	79 09                	jns    8039d3 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8039ca:	89 d8                	mov    %ebx,%eax
+  8039cc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8039cf:	5b                   	pop    %ebx
+  8039d0:	5e                   	pop    %esi
+  8039d1:	5d                   	pop    %ebp
+  8039d2:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8039d3:	83 ec 04             	sub    $0x4,%esp
+  8039d6:	ff 35 10 90 80 00    	push   0x809010
+  8039dc:	68 00 90 80 00       	push   $0x809000
+  8039e1:	ff 75 0c             	push   0xc(%ebp)
+  8039e4:	e8 84 d3 ff ff       	call   800d6d <memmove>
+		*addrlen = ret->ret_addrlen;
+  8039e9:	a1 10 90 80 00       	mov    0x809010,%eax
+  8039ee:	89 06                	mov    %eax,(%esi)
+  8039f0:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8039f3:	eb d5                	jmp    8039ca <nsipc_accept+0x27>
+
+008039f5 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8039f5:	55                   	push   %ebp
+  8039f6:	89 e5                	mov    %esp,%ebp
+  8039f8:	53                   	push   %ebx
+  8039f9:	83 ec 08             	sub    $0x8,%esp
+  8039fc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8039ff:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a02:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  803a07:	53                   	push   %ebx
+  803a08:	ff 75 0c             	push   0xc(%ebp)
+  803a0b:	68 04 90 80 00       	push   $0x809004
+  803a10:	e8 58 d3 ff ff       	call   800d6d <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  803a15:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  803a1b:	b8 02 00 00 00       	mov    $0x2,%eax
+  803a20:	e8 32 ff ff ff       	call   803957 <nsipc>
+}
+  803a25:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803a28:	c9                   	leave
+  803a29:	c3                   	ret
+
+00803a2a <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  803a2a:	55                   	push   %ebp
+  803a2b:	89 e5                	mov    %esp,%ebp
+  803a2d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  803a30:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a33:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  803a38:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803a3b:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  803a40:	b8 03 00 00 00       	mov    $0x3,%eax
+  803a45:	e8 0d ff ff ff       	call   803957 <nsipc>
+}
+  803a4a:	c9                   	leave
+  803a4b:	c3                   	ret
+
+00803a4c <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  803a4c:	55                   	push   %ebp
+  803a4d:	89 e5                	mov    %esp,%ebp
+  803a4f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  803a52:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a55:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  803a5a:	b8 04 00 00 00       	mov    $0x4,%eax
+  803a5f:	e8 f3 fe ff ff       	call   803957 <nsipc>
+}
+  803a64:	c9                   	leave
+  803a65:	c3                   	ret
+
+00803a66 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  803a66:	55                   	push   %ebp
+  803a67:	89 e5                	mov    %esp,%ebp
+  803a69:	53                   	push   %ebx
+  803a6a:	83 ec 08             	sub    $0x8,%esp
+  803a6d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  803a70:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a73:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  803a78:	53                   	push   %ebx
+  803a79:	ff 75 0c             	push   0xc(%ebp)
+  803a7c:	68 04 90 80 00       	push   $0x809004
+  803a81:	e8 e7 d2 ff ff       	call   800d6d <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  803a86:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  803a8c:	b8 05 00 00 00       	mov    $0x5,%eax
+  803a91:	e8 c1 fe ff ff       	call   803957 <nsipc>
+}
+  803a96:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803a99:	c9                   	leave
+  803a9a:	c3                   	ret
+
+00803a9b <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  803a9b:	55                   	push   %ebp
+  803a9c:	89 e5                	mov    %esp,%ebp
+  803a9e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  803aa1:	8b 45 08             	mov    0x8(%ebp),%eax
+  803aa4:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  803aa9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803aac:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  803ab1:	b8 06 00 00 00       	mov    $0x6,%eax
+  803ab6:	e8 9c fe ff ff       	call   803957 <nsipc>
+}
+  803abb:	c9                   	leave
+  803abc:	c3                   	ret
+
+00803abd <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  803abd:	55                   	push   %ebp
+  803abe:	89 e5                	mov    %esp,%ebp
+  803ac0:	56                   	push   %esi
+  803ac1:	53                   	push   %ebx
+  803ac2:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  803ac5:	8b 45 08             	mov    0x8(%ebp),%eax
+  803ac8:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  803acd:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  803ad3:	8b 45 14             	mov    0x14(%ebp),%eax
+  803ad6:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  803adb:	b8 07 00 00 00       	mov    $0x7,%eax
+  803ae0:	e8 72 fe ff ff       	call   803957 <nsipc>
+  803ae5:	89 c3                	mov    %eax,%ebx
+  803ae7:	85 c0                	test   %eax,%eax
+  803ae9:	78 22                	js     803b0d <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  803aeb:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  803af0:	39 c6                	cmp    %eax,%esi
+  803af2:	0f 4e c6             	cmovle %esi,%eax
+  803af5:	39 c3                	cmp    %eax,%ebx
+  803af7:	7f 1d                	jg     803b16 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  803af9:	83 ec 04             	sub    $0x4,%esp
+  803afc:	53                   	push   %ebx
+  803afd:	68 00 90 80 00       	push   $0x809000
+  803b02:	ff 75 0c             	push   0xc(%ebp)
+  803b05:	e8 63 d2 ff ff       	call   800d6d <memmove>
+  803b0a:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  803b0d:	89 d8                	mov    %ebx,%eax
+  803b0f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803b12:	5b                   	pop    %ebx
+  803b13:	5e                   	pop    %esi
+  803b14:	5d                   	pop    %ebp
+  803b15:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  803b16:	68 66 58 80 00       	push   $0x805866
+  803b1b:	68 b1 56 80 00       	push   $0x8056b1
+  803b20:	6a 62                	push   $0x62
+  803b22:	68 7b 58 80 00       	push   $0x80587b
+  803b27:	e8 fc c9 ff ff       	call   800528 <_panic>
+
+00803b2c <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  803b2c:	55                   	push   %ebp
+  803b2d:	89 e5                	mov    %esp,%ebp
+  803b2f:	53                   	push   %ebx
+  803b30:	83 ec 04             	sub    $0x4,%esp
+  803b33:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  803b36:	8b 45 08             	mov    0x8(%ebp),%eax
+  803b39:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  803b3e:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  803b44:	7f 2e                	jg     803b74 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  803b46:	83 ec 04             	sub    $0x4,%esp
+  803b49:	53                   	push   %ebx
+  803b4a:	ff 75 0c             	push   0xc(%ebp)
+  803b4d:	68 0c 90 80 00       	push   $0x80900c
+  803b52:	e8 16 d2 ff ff       	call   800d6d <memmove>
+	nsipcbuf.send.req_size = size;
+  803b57:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  803b5d:	8b 45 14             	mov    0x14(%ebp),%eax
+  803b60:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  803b65:	b8 08 00 00 00       	mov    $0x8,%eax
+  803b6a:	e8 e8 fd ff ff       	call   803957 <nsipc>
+}
+  803b6f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803b72:	c9                   	leave
+  803b73:	c3                   	ret
+	assert(size < 1600);
+  803b74:	68 87 58 80 00       	push   $0x805887
+  803b79:	68 b1 56 80 00       	push   $0x8056b1
+  803b7e:	6a 6d                	push   $0x6d
+  803b80:	68 7b 58 80 00       	push   $0x80587b
+  803b85:	e8 9e c9 ff ff       	call   800528 <_panic>
+
+00803b8a <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  803b8a:	55                   	push   %ebp
+  803b8b:	89 e5                	mov    %esp,%ebp
+  803b8d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  803b90:	8b 45 08             	mov    0x8(%ebp),%eax
+  803b93:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  803b98:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803b9b:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  803ba0:	8b 45 10             	mov    0x10(%ebp),%eax
+  803ba3:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  803ba8:	b8 09 00 00 00       	mov    $0x9,%eax
+  803bad:	e8 a5 fd ff ff       	call   803957 <nsipc>
+}
+  803bb2:	c9                   	leave
+  803bb3:	c3                   	ret
+
+00803bb4 <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  803bb4:	55                   	push   %ebp
+  803bb5:	89 e5                	mov    %esp,%ebp
+  803bb7:	53                   	push   %ebx
+  803bb8:	83 ec 10             	sub    $0x10,%esp
+  803bbb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  803bbe:	68 0c 70 80 00       	push   $0x80700c
+  803bc3:	e8 a1 07 00 00       	call   804369 <mutex_lock>
+	if (v == 0)
+  803bc8:	83 c4 10             	add    $0x10,%esp
+  803bcb:	85 db                	test   %ebx,%ebx
+  803bcd:	0f 84 85 00 00 00    	je     803c58 <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  803bd3:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  803bd9:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  803bde:	77 51                	ja     803c31 <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  803be0:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  803be6:	89 d8                	mov    %ebx,%eax
+  803be8:	c1 e8 0c             	shr    $0xc,%eax
+  803beb:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803bf2:	f6 c4 02             	test   $0x2,%ah
+  803bf5:	74 50                	je     803c47 <free+0x93>
+		sys_page_unmap(0, c);
+  803bf7:	83 ec 08             	sub    $0x8,%esp
+  803bfa:	53                   	push   %ebx
+  803bfb:	6a 00                	push   $0x0
+  803bfd:	e8 bc d4 ff ff       	call   8010be <sys_page_unmap>
+		c += PGSIZE;
+  803c02:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  803c08:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  803c0e:	83 c4 10             	add    $0x10,%esp
+  803c11:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  803c16:	76 ce                	jbe    803be6 <free+0x32>
+  803c18:	68 cf 58 80 00       	push   $0x8058cf
+  803c1d:	68 b1 56 80 00       	push   $0x8056b1
+  803c22:	68 82 00 00 00       	push   $0x82
+  803c27:	68 c2 58 80 00       	push   $0x8058c2
+  803c2c:	e8 f7 c8 ff ff       	call   800528 <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  803c31:	68 94 58 80 00       	push   $0x805894
+  803c36:	68 b1 56 80 00       	push   $0x8056b1
+  803c3b:	6a 7b                	push   $0x7b
+  803c3d:	68 c2 58 80 00       	push   $0x8058c2
+  803c42:	e8 e1 c8 ff ff       	call   800528 <_panic>
+	if (--(*ref) == 0)
+  803c47:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  803c4d:	83 e8 01             	sub    $0x1,%eax
+  803c50:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  803c56:	74 15                	je     803c6d <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  803c58:	83 ec 0c             	sub    $0xc,%esp
+  803c5b:	68 0c 70 80 00       	push   $0x80700c
+  803c60:	e8 71 07 00 00       	call   8043d6 <mutex_unlock>
+}
+  803c65:	83 c4 10             	add    $0x10,%esp
+  803c68:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803c6b:	c9                   	leave
+  803c6c:	c3                   	ret
+		sys_page_unmap(0, c);
+  803c6d:	83 ec 08             	sub    $0x8,%esp
+  803c70:	53                   	push   %ebx
+  803c71:	6a 00                	push   $0x0
+  803c73:	e8 46 d4 ff ff       	call   8010be <sys_page_unmap>
+  803c78:	83 c4 10             	add    $0x10,%esp
+  803c7b:	eb db                	jmp    803c58 <free+0xa4>
+
+00803c7d <malloc>:
+{
+  803c7d:	55                   	push   %ebp
+  803c7e:	89 e5                	mov    %esp,%ebp
+  803c80:	57                   	push   %edi
+  803c81:	56                   	push   %esi
+  803c82:	53                   	push   %ebx
+  803c83:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  803c86:	68 0c 70 80 00       	push   $0x80700c
+  803c8b:	e8 d9 06 00 00       	call   804369 <mutex_lock>
+	if (mptr == 0)
+  803c90:	8b 3d 10 70 80 00    	mov    0x807010,%edi
+  803c96:	83 c4 10             	add    $0x10,%esp
+  803c99:	85 ff                	test   %edi,%edi
+  803c9b:	74 6c                	je     803d09 <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  803c9d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803ca0:	83 c0 03             	add    $0x3,%eax
+  803ca3:	83 e0 fc             	and    $0xfffffffc,%eax
+  803ca6:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  803ca8:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  803cad:	0f 87 64 01 00 00    	ja     803e17 <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  803cb3:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803cb9:	74 30                	je     803ceb <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  803cbb:	89 f9                	mov    %edi,%ecx
+  803cbd:	c1 e9 0c             	shr    $0xc,%ecx
+  803cc0:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  803cc4:	c1 e8 0c             	shr    $0xc,%eax
+  803cc7:	39 c1                	cmp    %eax,%ecx
+  803cc9:	74 5f                	je     803d2a <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  803ccb:	83 ec 0c             	sub    $0xc,%esp
+  803cce:	57                   	push   %edi
+  803ccf:	e8 e0 fe ff ff       	call   803bb4 <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  803cd4:	a1 10 70 80 00       	mov    0x807010,%eax
+  803cd9:	05 00 10 00 00       	add    $0x1000,%eax
+  803cde:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803ce3:	a3 10 70 80 00       	mov    %eax,0x807010
+  803ce8:	83 c4 10             	add    $0x10,%esp
+  803ceb:	8b 0d 10 70 80 00    	mov    0x807010,%ecx
+{
+  803cf1:	ba 02 00 00 00       	mov    $0x2,%edx
+  803cf6:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  803cfa:	8d 7e 04             	lea    0x4(%esi),%edi
+  803cfd:	89 cb                	mov    %ecx,%ebx
+  803cff:	01 f9                	add    %edi,%ecx
+  803d01:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  803d04:	e9 8b 00 00 00       	jmp    803d94 <malloc+0x117>
+		mptr = mbegin;
+  803d09:	c7 05 10 70 80 00 00 	movl   $0x8000000,0x807010
+  803d10:	00 00 08 
+	n = ROUNDUP(n, 4);
+  803d13:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d16:	83 c0 03             	add    $0x3,%eax
+  803d19:	83 e0 fc             	and    $0xfffffffc,%eax
+  803d1c:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  803d1e:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  803d23:	76 c6                	jbe    803ceb <malloc+0x6e>
+  803d25:	e9 d6 00 00 00       	jmp    803e00 <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  803d2a:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  803d30:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  803d35:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  803d39:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  803d3c:	a3 10 70 80 00       	mov    %eax,0x807010
+			return v;
+  803d41:	e9 ba 00 00 00       	jmp    803e00 <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  803d46:	05 00 10 00 00       	add    $0x1000,%eax
+  803d4b:	39 c8                	cmp    %ecx,%eax
+  803d4d:	0f 83 cb 00 00 00    	jae    803e1e <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  803d53:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  803d58:	77 22                	ja     803d7c <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  803d5a:	89 c2                	mov    %eax,%edx
+  803d5c:	c1 ea 16             	shr    $0x16,%edx
+  803d5f:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  803d66:	f6 c2 01             	test   $0x1,%dl
+  803d69:	74 db                	je     803d46 <malloc+0xc9>
+  803d6b:	89 c2                	mov    %eax,%edx
+  803d6d:	c1 ea 0c             	shr    $0xc,%edx
+  803d70:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  803d77:	f6 c2 01             	test   $0x1,%dl
+  803d7a:	74 ca                	je     803d46 <malloc+0xc9>
+		if (mptr == mend) {
+  803d7c:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803d82:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  803d88:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  803d8c:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  803d92:	74 04                	je     803d98 <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  803d94:	89 d8                	mov    %ebx,%eax
+  803d96:	eb b3                	jmp    803d4b <malloc+0xce>
+  803d98:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  803d9b:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  803da0:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  803da4:	83 ea 01             	sub    $0x1,%edx
+  803da7:	0f 85 50 ff ff ff    	jne    803cfd <malloc+0x80>
+  803dad:	c7 05 10 70 80 00 00 	movl   $0x8000000,0x807010
+  803db4:	00 00 08 
+				return 0;	/* out of address space */
+  803db7:	bf 00 00 00 00       	mov    $0x0,%edi
+  803dbc:	eb 42                	jmp    803e00 <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  803dbe:	85 db                	test   %ebx,%ebx
+  803dc0:	78 1e                	js     803de0 <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  803dc2:	83 ec 08             	sub    $0x8,%esp
+  803dc5:	89 d8                	mov    %ebx,%eax
+  803dc7:	03 05 10 70 80 00    	add    0x807010,%eax
+  803dcd:	50                   	push   %eax
+  803dce:	6a 00                	push   $0x0
+  803dd0:	e8 e9 d2 ff ff       	call   8010be <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  803dd5:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  803ddb:	83 c4 10             	add    $0x10,%esp
+  803dde:	eb de                	jmp    803dbe <malloc+0x141>
+			return 0;	/* out of physical memory */
+  803de0:	bf 00 00 00 00       	mov    $0x0,%edi
+  803de5:	eb 19                	jmp    803e00 <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  803de7:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803dea:	8b 3d 10 70 80 00    	mov    0x807010,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  803df0:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  803df7:	00 
+	mptr += n;
+  803df8:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  803dfb:	a3 10 70 80 00       	mov    %eax,0x807010
+	mutex_unlock(&malloc_mu);
+  803e00:	83 ec 0c             	sub    $0xc,%esp
+  803e03:	68 0c 70 80 00       	push   $0x80700c
+  803e08:	e8 c9 05 00 00       	call   8043d6 <mutex_unlock>
+}
+  803e0d:	89 f8                	mov    %edi,%eax
+  803e0f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e12:	5b                   	pop    %ebx
+  803e13:	5e                   	pop    %esi
+  803e14:	5f                   	pop    %edi
+  803e15:	5d                   	pop    %ebp
+  803e16:	c3                   	ret
+		return 0;
+  803e17:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e1c:	eb e2                	jmp    803e00 <malloc+0x183>
+  803e1e:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  803e22:	74 06                	je     803e2a <malloc+0x1ad>
+  803e24:	89 1d 10 70 80 00    	mov    %ebx,0x807010
+	for (i = 0; i < n + 4; i += PGSIZE){
+  803e2a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803e2f:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803e32:	39 fb                	cmp    %edi,%ebx
+  803e34:	73 b1                	jae    803de7 <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  803e36:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  803e3c:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  803e3f:	39 fe                	cmp    %edi,%esi
+  803e41:	0f 92 c0             	setb   %al
+  803e44:	0f b6 c0             	movzbl %al,%eax
+  803e47:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  803e4a:	83 c8 07             	or     $0x7,%eax
+  803e4d:	50                   	push   %eax
+  803e4e:	89 d8                	mov    %ebx,%eax
+  803e50:	03 05 10 70 80 00    	add    0x807010,%eax
+  803e56:	50                   	push   %eax
+  803e57:	6a 00                	push   $0x0
+  803e59:	e8 c7 d1 ff ff       	call   801025 <sys_page_alloc>
+  803e5e:	83 c4 10             	add    $0x10,%esp
+  803e61:	85 c0                	test   %eax,%eax
+  803e63:	0f 88 55 ff ff ff    	js     803dbe <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  803e69:	89 f3                	mov    %esi,%ebx
+  803e6b:	eb c5                	jmp    803e32 <malloc+0x1b5>
+
+00803e6d <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  803e6d:	55                   	push   %ebp
+  803e6e:	89 e5                	mov    %esp,%ebp
+  803e70:	56                   	push   %esi
+  803e71:	53                   	push   %ebx
+  803e72:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803e75:	83 ec 0c             	sub    $0xc,%esp
+  803e78:	ff 75 08             	push   0x8(%ebp)
+  803e7b:	e8 cd dc ff ff       	call   801b4d <fd2data>
+  803e80:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  803e82:	83 c4 08             	add    $0x8,%esp
+  803e85:	68 e7 58 80 00       	push   $0x8058e7
+  803e8a:	53                   	push   %ebx
+  803e8b:	e8 57 cd ff ff       	call   800be7 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  803e90:	8b 46 04             	mov    0x4(%esi),%eax
+  803e93:	2b 06                	sub    (%esi),%eax
+  803e95:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  803e9b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803ea2:	00 00 00 
+	stat->st_dev = &devpipe;
+  803ea5:	c7 83 88 00 00 00 9c 	movl   $0x80629c,0x88(%ebx)
+  803eac:	62 80 00 
+	return 0;
+}
+  803eaf:	b8 00 00 00 00       	mov    $0x0,%eax
+  803eb4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803eb7:	5b                   	pop    %ebx
+  803eb8:	5e                   	pop    %esi
+  803eb9:	5d                   	pop    %ebp
+  803eba:	c3                   	ret
+
+00803ebb <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  803ebb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803ec0:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  803ec4:	85 c9                	test   %ecx,%ecx
+  803ec6:	75 01                	jne    803ec9 <pipewake+0xe>
+  803ec8:	c3                   	ret
+{
+  803ec9:	55                   	push   %ebp
+  803eca:	89 e5                	mov    %esp,%ebp
+  803ecc:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  803ecf:	68 00 04 00 00       	push   $0x400
+  803ed4:	52                   	push   %edx
+  803ed5:	e8 8f d4 ff ff       	call   801369 <sys_futex_wake>
+  803eda:	83 c4 10             	add    $0x10,%esp
+}
+  803edd:	c9                   	leave
+  803ede:	c3                   	ret
+
+00803edf <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803edf:	55                   	push   %ebp
+  803ee0:	89 e5                	mov    %esp,%ebp
+  803ee2:	56                   	push   %esi
+  803ee3:	53                   	push   %ebx
+  803ee4:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803ee7:	83 ec 0c             	sub    $0xc,%esp
+  803eea:	56                   	push   %esi
+  803eeb:	e8 5d dc ff ff       	call   801b4d <fd2data>
+  803ef0:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  803ef2:	83 c4 08             	add    $0x8,%esp
+  803ef5:	56                   	push   %esi
+  803ef6:	6a 00                	push   $0x0
+  803ef8:	e8 c1 d1 ff ff       	call   8010be <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  803efd:	8d 53 04             	lea    0x4(%ebx),%edx
+  803f00:	8d 43 08             	lea    0x8(%ebx),%eax
+  803f03:	e8 b3 ff ff ff       	call   803ebb <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  803f08:	8d 43 0c             	lea    0xc(%ebx),%eax
+  803f0b:	89 da                	mov    %ebx,%edx
+  803f0d:	e8 a9 ff ff ff       	call   803ebb <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  803f12:	89 34 24             	mov    %esi,(%esp)
+  803f15:	e8 33 dc ff ff       	call   801b4d <fd2data>
+  803f1a:	83 c4 08             	add    $0x8,%esp
+  803f1d:	50                   	push   %eax
+  803f1e:	6a 00                	push   $0x0
+  803f20:	e8 99 d1 ff ff       	call   8010be <sys_page_unmap>
+}
+  803f25:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803f28:	5b                   	pop    %ebx
+  803f29:	5e                   	pop    %esi
+  803f2a:	5d                   	pop    %ebp
+  803f2b:	c3                   	ret
+
+00803f2c <_pipeisclosed>:
+{
+  803f2c:	55                   	push   %ebp
+  803f2d:	89 e5                	mov    %esp,%ebp
+  803f2f:	57                   	push   %edi
+  803f30:	56                   	push   %esi
+  803f31:	53                   	push   %ebx
+  803f32:	83 ec 1c             	sub    $0x1c,%esp
+  803f35:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803f38:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803f3a:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  803f3f:	eb 5d                	jmp    803f9e <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  803f41:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		n = thisenv->env_runs;
+  803f47:	8b 02                	mov    (%edx),%eax
+  803f49:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  803f4c:	83 ec 0c             	sub    $0xc,%esp
+  803f4f:	ff 75 e0             	push   -0x20(%ebp)
+  803f52:	e8 0d 0e 00 00       	call   804d64 <pageref>
+  803f57:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803f5a:	89 3c 24             	mov    %edi,(%esp)
+  803f5d:	e8 02 0e 00 00       	call   804d64 <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  803f62:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803f64:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  803f6a:	83 c4 10             	add    $0x10,%esp
+  803f6d:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803f73:	77 15                	ja     803f8a <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803f75:	89 f2                	mov    %esi,%edx
+  803f77:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  803f79:	c1 ea 10             	shr    $0x10,%edx
+  803f7c:	74 0c                	je     803f8a <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803f7e:	c1 e2 10             	shl    $0x10,%edx
+  803f81:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  803f86:	29 d1                	sub    %edx,%ecx
+  803f88:	eb 06                	jmp    803f90 <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  803f8a:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		nn = thisenv->env_runs;
+  803f90:	8b 11                	mov    (%ecx),%edx
+  803f92:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  803f95:	39 d3                	cmp    %edx,%ebx
+  803f97:	74 6e                	je     804007 <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  803f99:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803f9c:	74 24                	je     803fc2 <_pipeisclosed+0x96>
+  803f9e:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803fa0:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803fa6:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803fab:	77 94                	ja     803f41 <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803fad:	89 f0                	mov    %esi,%eax
+  803faf:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803fb1:	c1 e8 10             	shr    $0x10,%eax
+  803fb4:	74 8b                	je     803f41 <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803fb6:	c1 e0 10             	shl    $0x10,%eax
+  803fb9:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803fbe:	29 c2                	sub    %eax,%edx
+  803fc0:	eb 85                	jmp    803f47 <_pipeisclosed+0x1b>
+  803fc2:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803fc4:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803fca:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803fcf:	77 18                	ja     803fe9 <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803fd1:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803fd6:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803fd8:	c1 e8 10             	shr    $0x10,%eax
+  803fdb:	74 0c                	je     803fe9 <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803fdd:	c1 e0 10             	shl    $0x10,%eax
+  803fe0:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803fe5:	29 c2                	sub    %eax,%edx
+  803fe7:	eb 06                	jmp    803fef <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  803fe9:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803fef:	8b 02                	mov    (%edx),%eax
+  803ff1:	8b 40 58             	mov    0x58(%eax),%eax
+  803ff4:	6a 01                	push   $0x1
+  803ff6:	50                   	push   %eax
+  803ff7:	53                   	push   %ebx
+  803ff8:	68 ee 58 80 00       	push   $0x8058ee
+  803ffd:	e8 01 c6 ff ff       	call   800603 <cprintf>
+  804002:	83 c4 10             	add    $0x10,%esp
+  804005:	eb 97                	jmp    803f9e <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  804007:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80400a:	0f 94 c0             	sete   %al
+  80400d:	0f b6 c0             	movzbl %al,%eax
+}
+  804010:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804013:	5b                   	pop    %ebx
+  804014:	5e                   	pop    %esi
+  804015:	5f                   	pop    %edi
+  804016:	5d                   	pop    %ebp
+  804017:	c3                   	ret
+
+00804018 <devpipe_write>:
+{
+  804018:	55                   	push   %ebp
+  804019:	89 e5                	mov    %esp,%ebp
+  80401b:	57                   	push   %edi
+  80401c:	56                   	push   %esi
+  80401d:	53                   	push   %ebx
+  80401e:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  804021:	ff 75 08             	push   0x8(%ebp)
+  804024:	e8 24 db ff ff       	call   801b4d <fd2data>
+  804029:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80402b:	83 c4 10             	add    $0x10,%esp
+  80402e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  804035:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  804038:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80403b:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80403e:	0f 84 96 00 00 00    	je     8040da <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  804044:	8d 73 08             	lea    0x8(%ebx),%esi
+  804047:	eb 32                	jmp    80407b <devpipe_write+0x63>
+  804049:	89 fa                	mov    %edi,%edx
+  80404b:	89 f0                	mov    %esi,%eax
+  80404d:	e8 69 fe ff ff       	call   803ebb <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  804052:	8b 43 04             	mov    0x4(%ebx),%eax
+  804055:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  804058:	ba 01 00 00 00       	mov    $0x1,%edx
+  80405d:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  804062:	83 ec 04             	sub    $0x4,%esp
+  804065:	6a 0a                	push   $0xa
+  804067:	50                   	push   %eax
+  804068:	53                   	push   %ebx
+  804069:	e8 cc d2 ff ff       	call   80133a <sys_futex_wait>
+  80406e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  804073:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  804078:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80407b:	8b 43 04             	mov    0x4(%ebx),%eax
+  80407e:	8b 0b                	mov    (%ebx),%ecx
+  804080:	8d 51 20             	lea    0x20(%ecx),%edx
+  804083:	39 d0                	cmp    %edx,%eax
+  804085:	72 1b                	jb     8040a2 <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  804087:	89 da                	mov    %ebx,%edx
+  804089:	8b 45 08             	mov    0x8(%ebp),%eax
+  80408c:	e8 9b fe ff ff       	call   803f2c <_pipeisclosed>
+  804091:	85 c0                	test   %eax,%eax
+  804093:	74 b4                	je     804049 <devpipe_write+0x31>
+				return 0;
+  804095:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80409a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80409d:	5b                   	pop    %ebx
+  80409e:	5e                   	pop    %esi
+  80409f:	5f                   	pop    %edi
+  8040a0:	5d                   	pop    %ebp
+  8040a1:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8040a2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8040a5:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8040a8:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  8040ac:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  8040af:	89 c2                	mov    %eax,%edx
+  8040b1:	c1 fa 1f             	sar    $0x1f,%edx
+  8040b4:	89 d1                	mov    %edx,%ecx
+  8040b6:	c1 e9 1b             	shr    $0x1b,%ecx
+  8040b9:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8040bc:	83 e2 1f             	and    $0x1f,%edx
+  8040bf:	29 ca                	sub    %ecx,%edx
+  8040c1:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  8040c5:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  8040c9:	83 c0 01             	add    $0x1,%eax
+  8040cc:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8040cf:	83 c6 01             	add    $0x1,%esi
+  8040d2:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8040d5:	e9 5e ff ff ff       	jmp    804038 <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  8040da:	8d 53 04             	lea    0x4(%ebx),%edx
+  8040dd:	8d 43 08             	lea    0x8(%ebx),%eax
+  8040e0:	e8 d6 fd ff ff       	call   803ebb <pipewake>
+	return i;
+  8040e5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8040e8:	eb b0                	jmp    80409a <devpipe_write+0x82>
+
+008040ea <devpipe_read>:
+{
+  8040ea:	55                   	push   %ebp
+  8040eb:	89 e5                	mov    %esp,%ebp
+  8040ed:	57                   	push   %edi
+  8040ee:	56                   	push   %esi
+  8040ef:	53                   	push   %ebx
+  8040f0:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  8040f3:	ff 75 08             	push   0x8(%ebp)
+  8040f6:	e8 52 da ff ff       	call   801b4d <fd2data>
+  8040fb:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8040fd:	83 c4 10             	add    $0x10,%esp
+  804100:	be 00 00 00 00       	mov    $0x0,%esi
+  804105:	3b 75 10             	cmp    0x10(%ebp),%esi
+  804108:	74 6c                	je     804176 <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  80410a:	8d 7b 04             	lea    0x4(%ebx),%edi
+  80410d:	eb 25                	jmp    804134 <devpipe_read+0x4a>
+  80410f:	8b 13                	mov    (%ebx),%edx
+  804111:	b8 01 00 00 00       	mov    $0x1,%eax
+  804116:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  80411b:	83 ec 04             	sub    $0x4,%esp
+  80411e:	6a 0a                	push   $0xa
+  804120:	52                   	push   %edx
+  804121:	57                   	push   %edi
+  804122:	e8 13 d2 ff ff       	call   80133a <sys_futex_wait>
+  804127:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80412c:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  804131:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  804134:	8b 03                	mov    (%ebx),%eax
+  804136:	3b 43 04             	cmp    0x4(%ebx),%eax
+  804139:	75 19                	jne    804154 <devpipe_read+0x6a>
+			if (i > 0)
+  80413b:	85 f6                	test   %esi,%esi
+  80413d:	75 3a                	jne    804179 <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  80413f:	89 da                	mov    %ebx,%edx
+  804141:	8b 45 08             	mov    0x8(%ebp),%eax
+  804144:	e8 e3 fd ff ff       	call   803f2c <_pipeisclosed>
+  804149:	85 c0                	test   %eax,%eax
+  80414b:	74 c2                	je     80410f <devpipe_read+0x25>
+				return 0;
+  80414d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804152:	eb 31                	jmp    804185 <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  804154:	89 c1                	mov    %eax,%ecx
+  804156:	c1 f9 1f             	sar    $0x1f,%ecx
+  804159:	c1 e9 1b             	shr    $0x1b,%ecx
+  80415c:	01 c8                	add    %ecx,%eax
+  80415e:	83 e0 1f             	and    $0x1f,%eax
+  804161:	29 c8                	sub    %ecx,%eax
+  804163:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  804168:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80416b:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80416e:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  804171:	83 c6 01             	add    $0x1,%esi
+  804174:	eb 8f                	jmp    804105 <devpipe_read+0x1b>
+out:
+  804176:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  804179:	8d 43 0c             	lea    0xc(%ebx),%eax
+  80417c:	89 da                	mov    %ebx,%edx
+  80417e:	e8 38 fd ff ff       	call   803ebb <pipewake>
+	return i;
+  804183:	89 f0                	mov    %esi,%eax
+}
+  804185:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804188:	5b                   	pop    %ebx
+  804189:	5e                   	pop    %esi
+  80418a:	5f                   	pop    %edi
+  80418b:	5d                   	pop    %ebp
+  80418c:	c3                   	ret
+
+0080418d <pipe>:
+{
+  80418d:	55                   	push   %ebp
+  80418e:	89 e5                	mov    %esp,%ebp
+  804190:	56                   	push   %esi
+  804191:	53                   	push   %ebx
+  804192:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  804195:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804198:	50                   	push   %eax
+  804199:	e8 c6 d9 ff ff       	call   801b64 <fd_alloc>
+  80419e:	89 c3                	mov    %eax,%ebx
+  8041a0:	83 c4 10             	add    $0x10,%esp
+  8041a3:	85 c0                	test   %eax,%eax
+  8041a5:	0f 88 23 01 00 00    	js     8042ce <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8041ab:	83 ec 04             	sub    $0x4,%esp
+  8041ae:	68 07 04 00 00       	push   $0x407
+  8041b3:	ff 75 f4             	push   -0xc(%ebp)
+  8041b6:	6a 00                	push   $0x0
+  8041b8:	e8 68 ce ff ff       	call   801025 <sys_page_alloc>
+  8041bd:	89 c3                	mov    %eax,%ebx
+  8041bf:	83 c4 10             	add    $0x10,%esp
+  8041c2:	85 c0                	test   %eax,%eax
+  8041c4:	0f 88 04 01 00 00    	js     8042ce <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8041ca:	83 ec 0c             	sub    $0xc,%esp
+  8041cd:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8041d0:	50                   	push   %eax
+  8041d1:	e8 8e d9 ff ff       	call   801b64 <fd_alloc>
+  8041d6:	89 c3                	mov    %eax,%ebx
+  8041d8:	83 c4 10             	add    $0x10,%esp
+  8041db:	85 c0                	test   %eax,%eax
+  8041dd:	0f 88 db 00 00 00    	js     8042be <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8041e3:	83 ec 04             	sub    $0x4,%esp
+  8041e6:	68 07 04 00 00       	push   $0x407
+  8041eb:	ff 75 f0             	push   -0x10(%ebp)
+  8041ee:	6a 00                	push   $0x0
+  8041f0:	e8 30 ce ff ff       	call   801025 <sys_page_alloc>
+  8041f5:	89 c3                	mov    %eax,%ebx
+  8041f7:	83 c4 10             	add    $0x10,%esp
+  8041fa:	85 c0                	test   %eax,%eax
+  8041fc:	0f 88 bc 00 00 00    	js     8042be <pipe+0x131>
+	va = fd2data(fd0);
+  804202:	83 ec 0c             	sub    $0xc,%esp
+  804205:	ff 75 f4             	push   -0xc(%ebp)
+  804208:	e8 40 d9 ff ff       	call   801b4d <fd2data>
+  80420d:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80420f:	83 c4 0c             	add    $0xc,%esp
+  804212:	68 07 04 00 00       	push   $0x407
+  804217:	50                   	push   %eax
+  804218:	6a 00                	push   $0x0
+  80421a:	e8 06 ce ff ff       	call   801025 <sys_page_alloc>
+  80421f:	89 c3                	mov    %eax,%ebx
+  804221:	83 c4 10             	add    $0x10,%esp
+  804224:	85 c0                	test   %eax,%eax
+  804226:	0f 88 82 00 00 00    	js     8042ae <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80422c:	83 ec 0c             	sub    $0xc,%esp
+  80422f:	ff 75 f0             	push   -0x10(%ebp)
+  804232:	e8 16 d9 ff ff       	call   801b4d <fd2data>
+  804237:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80423e:	50                   	push   %eax
+  80423f:	6a 00                	push   $0x0
+  804241:	56                   	push   %esi
+  804242:	6a 00                	push   $0x0
+  804244:	e8 29 ce ff ff       	call   801072 <sys_page_map>
+  804249:	89 c3                	mov    %eax,%ebx
+  80424b:	83 c4 20             	add    $0x20,%esp
+  80424e:	85 c0                	test   %eax,%eax
+  804250:	78 4e                	js     8042a0 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  804252:	a1 9c 62 80 00       	mov    0x80629c,%eax
+  804257:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80425a:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80425c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80425f:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  804266:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  804269:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80426b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80426e:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  804275:	83 ec 0c             	sub    $0xc,%esp
+  804278:	ff 75 f4             	push   -0xc(%ebp)
+  80427b:	e8 bd d8 ff ff       	call   801b3d <fd2num>
+  804280:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  804283:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  804285:	83 c4 04             	add    $0x4,%esp
+  804288:	ff 75 f0             	push   -0x10(%ebp)
+  80428b:	e8 ad d8 ff ff       	call   801b3d <fd2num>
+  804290:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  804293:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  804296:	83 c4 10             	add    $0x10,%esp
+  804299:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80429e:	eb 2e                	jmp    8042ce <pipe+0x141>
+	sys_page_unmap(0, va);
+  8042a0:	83 ec 08             	sub    $0x8,%esp
+  8042a3:	56                   	push   %esi
+  8042a4:	6a 00                	push   $0x0
+  8042a6:	e8 13 ce ff ff       	call   8010be <sys_page_unmap>
+  8042ab:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8042ae:	83 ec 08             	sub    $0x8,%esp
+  8042b1:	ff 75 f0             	push   -0x10(%ebp)
+  8042b4:	6a 00                	push   $0x0
+  8042b6:	e8 03 ce ff ff       	call   8010be <sys_page_unmap>
+  8042bb:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8042be:	83 ec 08             	sub    $0x8,%esp
+  8042c1:	ff 75 f4             	push   -0xc(%ebp)
+  8042c4:	6a 00                	push   $0x0
+  8042c6:	e8 f3 cd ff ff       	call   8010be <sys_page_unmap>
+  8042cb:	83 c4 10             	add    $0x10,%esp
+}
+  8042ce:	89 d8                	mov    %ebx,%eax
+  8042d0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8042d3:	5b                   	pop    %ebx
+  8042d4:	5e                   	pop    %esi
+  8042d5:	5d                   	pop    %ebp
+  8042d6:	c3                   	ret
+
+008042d7 <pipeisclosed>:
+{
+  8042d7:	55                   	push   %ebp
+  8042d8:	89 e5                	mov    %esp,%ebp
+  8042da:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8042dd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8042e0:	50                   	push   %eax
+  8042e1:	ff 75 08             	push   0x8(%ebp)
+  8042e4:	e8 d1 d8 ff ff       	call   801bba <fd_lookup>
+  8042e9:	83 c4 10             	add    $0x10,%esp
+  8042ec:	85 c0                	test   %eax,%eax
+  8042ee:	78 18                	js     804308 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8042f0:	83 ec 0c             	sub    $0xc,%esp
+  8042f3:	ff 75 f4             	push   -0xc(%ebp)
+  8042f6:	e8 52 d8 ff ff       	call   801b4d <fd2data>
+  8042fb:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8042fd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804300:	e8 27 fc ff ff       	call   803f2c <_pipeisclosed>
+  804305:	83 c4 10             	add    $0x10,%esp
+}
+  804308:	c9                   	leave
+  804309:	c3                   	ret
+
+0080430a <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  80430a:	55                   	push   %ebp
+  80430b:	89 e5                	mov    %esp,%ebp
+  80430d:	56                   	push   %esi
+  80430e:	53                   	push   %ebx
+  80430f:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  804312:	85 f6                	test   %esi,%esi
+  804314:	74 15                	je     80432b <wait+0x21>
+	e = &envs[ENVX(envid)];
+  804316:	89 f0                	mov    %esi,%eax
+  804318:	25 ff 03 00 00       	and    $0x3ff,%eax
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  80431d:	8d 1c c0             	lea    (%eax,%eax,8),%ebx
+  804320:	c1 e3 04             	shl    $0x4,%ebx
+  804323:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  804329:	eb 1b                	jmp    804346 <wait+0x3c>
+	assert(envid != 0);
+  80432b:	68 06 59 80 00       	push   $0x805906
+  804330:	68 b1 56 80 00       	push   $0x8056b1
+  804335:	6a 09                	push   $0x9
+  804337:	68 11 59 80 00       	push   $0x805911
+  80433c:	e8 e7 c1 ff ff       	call   800528 <_panic>
+		sys_yield();
+  804341:	e8 b3 cc ff ff       	call   800ff9 <sys_yield>
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  804346:	8b 43 48             	mov    0x48(%ebx),%eax
+  804349:	39 f0                	cmp    %esi,%eax
+  80434b:	75 07                	jne    804354 <wait+0x4a>
+  80434d:	8b 43 54             	mov    0x54(%ebx),%eax
+  804350:	85 c0                	test   %eax,%eax
+  804352:	75 ed                	jne    804341 <wait+0x37>
+}
+  804354:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804357:	5b                   	pop    %ebx
+  804358:	5e                   	pop    %esi
+  804359:	5d                   	pop    %ebp
+  80435a:	c3                   	ret
+
+0080435b <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  80435b:	55                   	push   %ebp
+  80435c:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  80435e:	8b 45 08             	mov    0x8(%ebp),%eax
+  804361:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  804367:	5d                   	pop    %ebp
+  804368:	c3                   	ret
+
+00804369 <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  804369:	55                   	push   %ebp
+  80436a:	89 e5                	mov    %esp,%ebp
+  80436c:	56                   	push   %esi
+  80436d:	53                   	push   %ebx
+  80436e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  804371:	ba 00 00 00 00       	mov    $0x0,%edx
+  804376:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80437b:	89 d0                	mov    %edx,%eax
+  80437d:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  804381:	85 c0                	test   %eax,%eax
+  804383:	74 2d                	je     8043b2 <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  804385:	83 f8 02             	cmp    $0x2,%eax
+  804388:	74 08                	je     804392 <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  80438a:	b8 02 00 00 00       	mov    $0x2,%eax
+  80438f:	f0 87 03             	lock xchg %eax,(%ebx)
+  804392:	be 02 00 00 00       	mov    $0x2,%esi
+  804397:	eb 15                	jmp    8043ae <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  804399:	83 ec 04             	sub    $0x4,%esp
+  80439c:	6a 00                	push   $0x0
+  80439e:	6a 02                	push   $0x2
+  8043a0:	53                   	push   %ebx
+  8043a1:	e8 94 cf ff ff       	call   80133a <sys_futex_wait>
+  8043a6:	89 f0                	mov    %esi,%eax
+  8043a8:	f0 87 03             	lock xchg %eax,(%ebx)
+  8043ab:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  8043ae:	85 c0                	test   %eax,%eax
+  8043b0:	75 e7                	jne    804399 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  8043b2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8043b5:	5b                   	pop    %ebx
+  8043b6:	5e                   	pop    %esi
+  8043b7:	5d                   	pop    %ebp
+  8043b8:	c3                   	ret
+
+008043b9 <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  8043b9:	55                   	push   %ebp
+  8043ba:	89 e5                	mov    %esp,%ebp
+  8043bc:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  8043bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043c4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8043c9:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  8043cd:	f7 d8                	neg    %eax
+  8043cf:	19 c0                	sbb    %eax,%eax
+  8043d1:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  8043d4:	5d                   	pop    %ebp
+  8043d5:	c3                   	ret
+
+008043d6 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  8043d6:	55                   	push   %ebp
+  8043d7:	89 e5                	mov    %esp,%ebp
+  8043d9:	83 ec 08             	sub    $0x8,%esp
+  8043dc:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  8043df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043e4:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  8043e7:	83 f8 02             	cmp    $0x2,%eax
+  8043ea:	74 02                	je     8043ee <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  8043ec:	c9                   	leave
+  8043ed:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  8043ee:	83 ec 08             	sub    $0x8,%esp
+  8043f1:	6a 01                	push   $0x1
+  8043f3:	52                   	push   %edx
+  8043f4:	e8 70 cf ff ff       	call   801369 <sys_futex_wake>
+  8043f9:	83 c4 10             	add    $0x10,%esp
+}
+  8043fc:	eb ee                	jmp    8043ec <mutex_unlock+0x16>
+
+008043fe <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  8043fe:	55                   	push   %ebp
+  8043ff:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  804401:	8b 45 08             	mov    0x8(%ebp),%eax
+  804404:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  80440a:	5d                   	pop    %ebp
+  80440b:	c3                   	ret
+
+0080440c <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  80440c:	55                   	push   %ebp
+  80440d:	89 e5                	mov    %esp,%ebp
+  80440f:	57                   	push   %edi
+  804410:	56                   	push   %esi
+  804411:	53                   	push   %ebx
+  804412:	83 ec 18             	sub    $0x18,%esp
+  804415:	8b 75 08             	mov    0x8(%ebp),%esi
+  804418:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  80441b:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  80441d:	53                   	push   %ebx
+  80441e:	e8 b3 ff ff ff       	call   8043d6 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  804423:	83 c4 0c             	add    $0xc,%esp
+  804426:	ff 75 10             	push   0x10(%ebp)
+  804429:	57                   	push   %edi
+  80442a:	56                   	push   %esi
+  80442b:	e8 0a cf ff ff       	call   80133a <sys_futex_wait>
+  804430:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  804432:	83 c4 10             	add    $0x10,%esp
+  804435:	be 02 00 00 00       	mov    $0x2,%esi
+  80443a:	eb 10                	jmp    80444c <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  80443c:	83 ec 04             	sub    $0x4,%esp
+  80443f:	6a 00                	push   $0x0
+  804441:	6a 02                	push   $0x2
+  804443:	53                   	push   %ebx
+  804444:	e8 f1 ce ff ff       	call   80133a <sys_futex_wait>
+  804449:	83 c4 10             	add    $0x10,%esp
+  80444c:	89 f0                	mov    %esi,%eax
+  80444e:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  804451:	85 c0                	test   %eax,%eax
+  804453:	75 e7                	jne    80443c <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  804455:	83 ff ec             	cmp    $0xffffffec,%edi
+  804458:	74 05                	je     80445f <cond_timedwait+0x53>
+  80445a:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  80445f:	89 f8                	mov    %edi,%eax
+  804461:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804464:	5b                   	pop    %ebx
+  804465:	5e                   	pop    %esi
+  804466:	5f                   	pop    %edi
+  804467:	5d                   	pop    %ebp
+  804468:	c3                   	ret
+
+00804469 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  804469:	55                   	push   %ebp
+  80446a:	89 e5                	mov    %esp,%ebp
+  80446c:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  80446f:	6a 00                	push   $0x0
+  804471:	ff 75 0c             	push   0xc(%ebp)
+  804474:	ff 75 08             	push   0x8(%ebp)
+  804477:	e8 90 ff ff ff       	call   80440c <cond_timedwait>
+}
+  80447c:	83 c4 10             	add    $0x10,%esp
+  80447f:	c9                   	leave
+  804480:	c3                   	ret
+
+00804481 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  804481:	55                   	push   %ebp
+  804482:	89 e5                	mov    %esp,%ebp
+  804484:	83 ec 10             	sub    $0x10,%esp
+  804487:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  80448a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80448f:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  804493:	6a 01                	push   $0x1
+  804495:	50                   	push   %eax
+  804496:	e8 ce ce ff ff       	call   801369 <sys_futex_wake>
+}
+  80449b:	83 c4 10             	add    $0x10,%esp
+  80449e:	c9                   	leave
+  80449f:	c3                   	ret
+
+008044a0 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  8044a0:	55                   	push   %ebp
+  8044a1:	89 e5                	mov    %esp,%ebp
+  8044a3:	83 ec 10             	sub    $0x10,%esp
+  8044a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8044a9:	ba 01 00 00 00       	mov    $0x1,%edx
+  8044ae:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  8044b2:	68 00 04 00 00       	push   $0x400
+  8044b7:	50                   	push   %eax
+  8044b8:	e8 ac ce ff ff       	call   801369 <sys_futex_wake>
+}
+  8044bd:	83 c4 10             	add    $0x10,%esp
+  8044c0:	c9                   	leave
+  8044c1:	c3                   	ret
+
+008044c2 <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  8044c2:	55                   	push   %ebp
+  8044c3:	89 e5                	mov    %esp,%ebp
+  8044c5:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  8044c8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8044cb:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  8044cd:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  8044d4:	5d                   	pop    %ebp
+  8044d5:	c3                   	ret
+
+008044d6 <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  8044d6:	55                   	push   %ebp
+  8044d7:	89 e5                	mov    %esp,%ebp
+  8044d9:	53                   	push   %ebx
+  8044da:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  8044dd:	8b 11                	mov    (%ecx),%edx
+  8044df:	85 d2                	test   %edx,%edx
+  8044e1:	74 14                	je     8044f7 <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  8044e3:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  8044e6:	89 d0                	mov    %edx,%eax
+  8044e8:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  8044ec:	39 c2                	cmp    %eax,%edx
+  8044ee:	75 ed                	jne    8044dd <sem_trywait+0x7>
+			return 0;
+  8044f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044f5:	eb 05                	jmp    8044fc <sem_trywait+0x26>
+	return -E_AGAIN;
+  8044f7:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  8044fc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8044ff:	c9                   	leave
+  804500:	c3                   	ret
+
+00804501 <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  804501:	55                   	push   %ebp
+  804502:	89 e5                	mov    %esp,%ebp
+  804504:	57                   	push   %edi
+  804505:	56                   	push   %esi
+  804506:	53                   	push   %ebx
+  804507:	83 ec 1c             	sub    $0x1c,%esp
+  80450a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80450d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  804510:	e8 9d cd ff ff       	call   8012b2 <sys_time_msec>
+  804515:	01 f8                	add    %edi,%eax
+  804517:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  80451a:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  80451f:	eb 28                	jmp    804549 <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  804521:	b8 01 00 00 00       	mov    $0x1,%eax
+  804526:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  80452b:	83 ec 04             	sub    $0x4,%esp
+  80452e:	56                   	push   %esi
+  80452f:	6a 00                	push   $0x0
+  804531:	53                   	push   %ebx
+  804532:	e8 03 ce ff ff       	call   80133a <sys_futex_wait>
+  804537:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  80453c:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  804541:	83 c4 10             	add    $0x10,%esp
+  804544:	83 f8 ec             	cmp    $0xffffffec,%eax
+  804547:	74 2e                	je     804577 <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  804549:	83 ec 0c             	sub    $0xc,%esp
+  80454c:	53                   	push   %ebx
+  80454d:	e8 84 ff ff ff       	call   8044d6 <sem_trywait>
+  804552:	83 c4 10             	add    $0x10,%esp
+  804555:	85 c0                	test   %eax,%eax
+  804557:	79 19                	jns    804572 <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  804559:	85 ff                	test   %edi,%edi
+  80455b:	74 c4                	je     804521 <sem_timedwait+0x20>
+  80455d:	e8 50 cd ff ff       	call   8012b2 <sys_time_msec>
+  804562:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  804565:	29 c6                	sub    %eax,%esi
+  804567:	85 f6                	test   %esi,%esi
+  804569:	7f b6                	jg     804521 <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  80456b:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  804570:	eb 05                	jmp    804577 <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  804572:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804577:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80457a:	5b                   	pop    %ebx
+  80457b:	5e                   	pop    %esi
+  80457c:	5f                   	pop    %edi
+  80457d:	5d                   	pop    %ebp
+  80457e:	c3                   	ret
+
+0080457f <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  80457f:	55                   	push   %ebp
+  804580:	89 e5                	mov    %esp,%ebp
+  804582:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  804585:	6a 00                	push   $0x0
+  804587:	ff 75 08             	push   0x8(%ebp)
+  80458a:	e8 72 ff ff ff       	call   804501 <sem_timedwait>
+}
+  80458f:	83 c4 10             	add    $0x10,%esp
+  804592:	c9                   	leave
+  804593:	c3                   	ret
+
+00804594 <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  804594:	55                   	push   %ebp
+  804595:	89 e5                	mov    %esp,%ebp
+  804597:	83 ec 08             	sub    $0x8,%esp
+  80459a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80459d:	ba 01 00 00 00       	mov    $0x1,%edx
+  8045a2:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  8045a6:	8b 50 04             	mov    0x4(%eax),%edx
+  8045a9:	85 d2                	test   %edx,%edx
+  8045ab:	75 02                	jne    8045af <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  8045ad:	c9                   	leave
+  8045ae:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  8045af:	83 ec 08             	sub    $0x8,%esp
+  8045b2:	6a 01                	push   $0x1
+  8045b4:	50                   	push   %eax
+  8045b5:	e8 af cd ff ff       	call   801369 <sys_futex_wake>
+  8045ba:	83 c4 10             	add    $0x10,%esp
+}
+  8045bd:	eb ee                	jmp    8045ad <sem_post+0x19>
+
+008045bf <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  8045bf:	55                   	push   %ebp
+  8045c0:	89 e5                	mov    %esp,%ebp
+  8045c2:	57                   	push   %edi
+  8045c3:	56                   	push   %esi
+  8045c4:	53                   	push   %ebx
+  8045c5:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  8045c8:	68 20 70 80 00       	push   $0x807020
+  8045cd:	e8 97 fd ff ff       	call   804369 <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  8045d2:	a1 44 70 80 00       	mov    0x807044,%eax
+  8045d7:	83 c4 10             	add    $0x10,%esp
+  8045da:	85 c0                	test   %eax,%eax
+  8045dc:	75 19                	jne    8045f7 <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  8045de:	a1 c0 72 80 00       	mov    0x8072c0,%eax
+  8045e3:	8b 00                	mov    (%eax),%eax
+  8045e5:	8b 40 48             	mov    0x48(%eax),%eax
+  8045e8:	a3 40 70 80 00       	mov    %eax,0x807040
+		threads[0].th_state = PTH_RUNNING;
+  8045ed:	c7 05 44 70 80 00 01 	movl   $0x1,0x807044
+  8045f4:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  8045f7:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  8045fc:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8045ff:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  804606:	8b 40 04             	mov    0x4(%eax),%eax
+  804609:	85 c0                	test   %eax,%eax
+  80460b:	0f 84 e4 00 00 00    	je     8046f5 <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  804611:	83 c3 01             	add    $0x1,%ebx
+  804614:	83 fb 20             	cmp    $0x20,%ebx
+  804617:	75 e3                	jne    8045fc <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  804619:	83 ec 0c             	sub    $0xc,%esp
+  80461c:	68 20 70 80 00       	push   $0x807020
+  804621:	e8 b0 fd ff ff       	call   8043d6 <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  804626:	83 c4 10             	add    $0x10,%esp
+  804629:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  80462e:	e9 b8 00 00 00       	jmp    8046eb <pthread_create+0x12c>
+  804633:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  804636:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  804639:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  80463b:	39 f3                	cmp    %esi,%ebx
+  80463d:	73 16                	jae    804655 <pthread_create+0x96>
+		va -= PGSIZE;
+  80463f:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  804645:	83 ec 08             	sub    $0x8,%esp
+  804648:	56                   	push   %esi
+  804649:	6a 00                	push   $0x0
+  80464b:	e8 6e ca ff ff       	call   8010be <sys_page_unmap>
+  804650:	83 c4 10             	add    $0x10,%esp
+  804653:	eb e6                	jmp    80463b <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  804655:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  804658:	83 ec 08             	sub    $0x8,%esp
+  80465b:	ff 75 e4             	push   -0x1c(%ebp)
+  80465e:	6a 00                	push   $0x0
+  804660:	e8 59 ca ff ff       	call   8010be <sys_page_unmap>
+	return r;
+  804665:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  804668:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80466b:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  804672:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  804679:	eb 70                	jmp    8046eb <pthread_create+0x12c>
+	th->th_fn = fn;
+  80467b:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80467e:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  804685:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804688:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  80468b:	8b 55 10             	mov    0x10(%ebp),%edx
+  80468e:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  804691:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  804698:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  80469d:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8046a0:	29 c8                	sub    %ecx,%eax
+  8046a2:	85 db                	test   %ebx,%ebx
+  8046a4:	0f 44 05 c0 72 80 00 	cmove  0x8072c0,%eax
+	*--esp = t;
+  8046ab:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  8046ae:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  8046b5:	83 ec 04             	sub    $0x4,%esp
+  8046b8:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  8046bd:	29 ca                	sub    %ecx,%edx
+  8046bf:	52                   	push   %edx
+	*--esp = 0;
+  8046c0:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  8046c3:	50                   	push   %eax
+  8046c4:	68 1c 49 80 00       	push   $0x80491c
+  8046c9:	e8 40 cd ff ff       	call   80140e <sys_thread_create>
+  8046ce:	89 c7                	mov    %eax,%edi
+  8046d0:	83 c4 10             	add    $0x10,%esp
+  8046d3:	85 c0                	test   %eax,%eax
+  8046d5:	78 91                	js     804668 <pthread_create+0xa9>
+	th->th_env = id;
+  8046d7:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8046da:	89 3c 85 40 70 80 00 	mov    %edi,0x807040(,%eax,4)
+	*tp = t;
+  8046e1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8046e4:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  8046e6:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  8046eb:	89 f8                	mov    %edi,%eax
+  8046ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8046f0:	5b                   	pop    %ebx
+  8046f1:	5e                   	pop    %esi
+  8046f2:	5f                   	pop    %edi
+  8046f3:	5d                   	pop    %ebp
+  8046f4:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  8046f5:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8046f8:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  8046ff:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  804706:	83 ec 0c             	sub    $0xc,%esp
+  804709:	68 20 70 80 00       	push   $0x807020
+  80470e:	e8 c3 fc ff ff       	call   8043d6 <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  804713:	89 d9                	mov    %ebx,%ecx
+  804715:	c1 e1 10             	shl    $0x10,%ecx
+  804718:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  80471b:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  804720:	29 c8                	sub    %ecx,%eax
+  804722:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  804725:	c1 e8 16             	shr    $0x16,%eax
+  804728:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80472f:	83 c4 10             	add    $0x10,%esp
+  804732:	a8 01                	test   $0x1,%al
+  804734:	74 15                	je     80474b <pthread_create+0x18c>
+  804736:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804739:	c1 e8 0c             	shr    $0xc,%eax
+  80473c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  804743:	a8 01                	test   $0x1,%al
+  804745:	0f 85 30 ff ff ff    	jne    80467b <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  80474b:	83 ec 04             	sub    $0x4,%esp
+  80474e:	6a 07                	push   $0x7
+  804750:	ff 75 e4             	push   -0x1c(%ebp)
+  804753:	6a 00                	push   $0x0
+  804755:	e8 cb c8 ff ff       	call   801025 <sys_page_alloc>
+  80475a:	89 c7                	mov    %eax,%edi
+  80475c:	83 c4 10             	add    $0x10,%esp
+  80475f:	85 c0                	test   %eax,%eax
+  804761:	0f 88 01 ff ff ff    	js     804668 <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  804767:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  80476c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80476f:	29 d0                	sub    %edx,%eax
+  804771:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  804774:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  804776:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  80477b:	29 d0                	sub    %edx,%eax
+  80477d:	89 c7                	mov    %eax,%edi
+  80477f:	39 fe                	cmp    %edi,%esi
+  804781:	0f 83 f4 fe ff ff    	jae    80467b <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  804787:	83 ec 04             	sub    $0x4,%esp
+  80478a:	6a 07                	push   $0x7
+  80478c:	56                   	push   %esi
+  80478d:	6a 00                	push   $0x0
+  80478f:	e8 91 c8 ff ff       	call   801025 <sys_page_alloc>
+  804794:	83 c4 10             	add    $0x10,%esp
+  804797:	85 c0                	test   %eax,%eax
+  804799:	0f 88 94 fe ff ff    	js     804633 <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  80479f:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8047a5:	eb d8                	jmp    80477f <pthread_create+0x1c0>
+
+008047a7 <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  8047a7:	55                   	push   %ebp
+  8047a8:	89 e5                	mov    %esp,%ebp
+  8047aa:	57                   	push   %edi
+  8047ab:	56                   	push   %esi
+  8047ac:	53                   	push   %ebx
+  8047ad:	83 ec 0c             	sub    $0xc,%esp
+  8047b0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  8047b3:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  8047b6:	83 f8 1e             	cmp    $0x1e,%eax
+  8047b9:	0f 87 c7 00 00 00    	ja     804886 <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  8047bf:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8047c1:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8047c7:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8047cc:	77 12                	ja     8047e0 <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8047ce:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8047d3:	29 d0                	sub    %edx,%eax
+  8047d5:	c1 e8 10             	shr    $0x10,%eax
+  8047d8:	39 c3                	cmp    %eax,%ebx
+  8047da:	0f 84 ad 00 00 00    	je     80488d <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  8047e0:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8047e3:	8d 3c 85 44 70 80 00 	lea    0x807044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  8047ea:	8d 34 85 40 70 80 00 	lea    0x807040(,%eax,4),%esi
+  8047f1:	eb 10                	jmp    804803 <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  8047f3:	83 ec 04             	sub    $0x4,%esp
+  8047f6:	6a 00                	push   $0x0
+  8047f8:	6a 01                	push   $0x1
+  8047fa:	57                   	push   %edi
+  8047fb:	e8 3a cb ff ff       	call   80133a <sys_futex_wait>
+  804800:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  804803:	8b 46 04             	mov    0x4(%esi),%eax
+  804806:	83 f8 01             	cmp    $0x1,%eax
+  804809:	74 e8                	je     8047f3 <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  80480b:	83 f8 02             	cmp    $0x2,%eax
+  80480e:	0f 85 80 00 00 00    	jne    804894 <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  804814:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  804817:	c1 e6 02             	shl    $0x2,%esi
+  80481a:	eb 05                	jmp    804821 <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  80481c:	e8 d8 c7 ff ff       	call   800ff9 <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  804821:	8b 8e 40 70 80 00    	mov    0x807040(%esi),%ecx
+  804827:	89 ca                	mov    %ecx,%edx
+  804829:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  80482f:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804832:	c1 e0 04             	shl    $0x4,%eax
+  804835:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80483a:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  80483d:	39 c1                	cmp    %eax,%ecx
+  80483f:	75 12                	jne    804853 <pthread_join+0xac>
+  804841:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804844:	c1 e0 04             	shl    $0x4,%eax
+  804847:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80484c:	8b 40 54             	mov    0x54(%eax),%eax
+  80484f:	85 c0                	test   %eax,%eax
+  804851:	75 c9                	jne    80481c <pthread_join+0x75>
+	if (ret_store)
+  804853:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  804857:	74 0f                	je     804868 <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  804859:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80485c:	8b 04 85 50 70 80 00 	mov    0x807050(,%eax,4),%eax
+  804863:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  804866:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  804868:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80486b:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  804872:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  804879:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80487e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804881:	5b                   	pop    %ebx
+  804882:	5e                   	pop    %esi
+  804883:	5f                   	pop    %edi
+  804884:	5d                   	pop    %ebp
+  804885:	c3                   	ret
+		return -E_INVAL;
+  804886:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80488b:	eb f1                	jmp    80487e <pthread_join+0xd7>
+  80488d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804892:	eb ea                	jmp    80487e <pthread_join+0xd7>
+		return -E_INVAL;
+  804894:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804899:	eb e3                	jmp    80487e <pthread_join+0xd7>
+
+0080489b <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  80489b:	55                   	push   %ebp
+  80489c:	89 e5                	mov    %esp,%ebp
+  80489e:	53                   	push   %ebx
+  80489f:	83 ec 04             	sub    $0x4,%esp
+  8048a2:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8048a4:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8048aa:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8048af:	77 0c                	ja     8048bd <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8048b1:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8048b6:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  8048b8:	c1 e8 10             	shr    $0x10,%eax
+  8048bb:	75 0a                	jne    8048c7 <pthread_exit+0x2c>
+		exit();
+  8048bd:	e8 3e bc ff ff       	call   800500 <exit>
+  8048c2:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  8048c7:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  8048ce:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  8048d1:	8d 0c 8d 40 70 80 00 	lea    0x807040(,%ecx,4),%ecx
+  8048d8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8048db:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  8048de:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  8048e5:	83 ec 08             	sub    $0x8,%esp
+  8048e8:	6a 20                	push   $0x20
+  8048ea:	01 c2                	add    %eax,%edx
+  8048ec:	8d 04 95 44 70 80 00 	lea    0x807044(,%edx,4),%eax
+  8048f3:	50                   	push   %eax
+  8048f4:	e8 70 ca ff ff       	call   801369 <sys_futex_wake>
+	sys_env_destroy(0);
+  8048f9:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  804900:	e8 7d c6 ff ff       	call   800f82 <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  804905:	83 c4 0c             	add    $0xc,%esp
+  804908:	68 1c 59 80 00       	push   $0x80591c
+  80490d:	68 a5 00 00 00       	push   $0xa5
+  804912:	68 36 59 80 00       	push   $0x805936
+  804917:	e8 0c bc ff ff       	call   800528 <_panic>
+
+0080491c <pthread_start>:
+{
+  80491c:	55                   	push   %ebp
+  80491d:	89 e5                	mov    %esp,%ebp
+  80491f:	53                   	push   %ebx
+  804920:	83 ec 04             	sub    $0x4,%esp
+  804923:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  804926:	e8 a2 c6 ff ff       	call   800fcd <sys_getenvid>
+  80492b:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  804930:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+	if (t == 0)
+  804936:	85 db                	test   %ebx,%ebx
+  804938:	74 0c                	je     804946 <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80493a:	89 d9                	mov    %ebx,%ecx
+  80493c:	c1 e1 10             	shl    $0x10,%ecx
+  80493f:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804944:	29 ca                	sub    %ecx,%edx
+  804946:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  804949:	c1 e0 04             	shl    $0x4,%eax
+  80494c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804951:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  804953:	83 ec 0c             	sub    $0xc,%esp
+  804956:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  80495d:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  804960:	ff 34 95 4c 70 80 00 	push   0x80704c(,%edx,4)
+  804967:	ff 14 95 48 70 80 00 	call   *0x807048(,%edx,4)
+  80496e:	89 04 24             	mov    %eax,(%esp)
+  804971:	e8 25 ff ff ff       	call   80489b <pthread_exit>
+
+00804976 <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  804976:	55                   	push   %ebp
+  804977:	89 e5                	mov    %esp,%ebp
+  804979:	57                   	push   %edi
+  80497a:	56                   	push   %esi
+  80497b:	53                   	push   %ebx
+  80497c:	83 ec 1c             	sub    $0x1c,%esp
+  80497f:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804981:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  804987:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80498e:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804993:	77 0d                	ja     8049a2 <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804995:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80499a:	29 d0                	sub    %edx,%eax
+  80499c:	c1 e8 10             	shr    $0x10,%eax
+  80499f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  8049a2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8049a7:	eb 2f                	jmp    8049d8 <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  8049a9:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  8049af:	8b 01                	mov    (%ecx),%eax
+  8049b1:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  8049b4:	39 c2                	cmp    %eax,%edx
+  8049b6:	75 14                	jne    8049cc <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  8049b8:	83 ec 0c             	sub    $0xc,%esp
+  8049bb:	57                   	push   %edi
+  8049bc:	e8 c1 c5 ff ff       	call   800f82 <sys_env_destroy>
+  8049c1:	83 c4 10             	add    $0x10,%esp
+  8049c4:	85 c0                	test   %eax,%eax
+  8049c6:	0f 88 97 00 00 00    	js     804a63 <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  8049cc:	83 c3 01             	add    $0x1,%ebx
+  8049cf:	83 fb 20             	cmp    $0x20,%ebx
+  8049d2:	0f 84 d2 00 00 00    	je     804aaa <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  8049d8:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  8049db:	74 ef                	je     8049cc <pthread_kill_others+0x56>
+  8049dd:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8049e0:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  8049e7:	8b 40 04             	mov    0x4(%eax),%eax
+  8049ea:	83 f8 01             	cmp    $0x1,%eax
+  8049ed:	75 dd                	jne    8049cc <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  8049ef:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8049f2:	8b 3c 85 40 70 80 00 	mov    0x807040(,%eax,4),%edi
+  8049f9:	89 fe                	mov    %edi,%esi
+  8049fb:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  804a01:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  804a04:	c1 e0 04             	shl    $0x4,%eax
+  804a07:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804a0c:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  804a0f:	39 c7                	cmp    %eax,%edi
+  804a11:	75 b9                	jne    8049cc <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  804a13:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  804a16:	c1 e0 04             	shl    $0x4,%eax
+  804a19:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804a1e:	8b 40 54             	mov    0x54(%eax),%eax
+  804a21:	85 c0                	test   %eax,%eax
+  804a23:	74 a7                	je     8049cc <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  804a25:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  804a28:	c1 e0 04             	shl    $0x4,%eax
+  804a2b:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  804a31:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804a33:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  804a39:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804a3e:	0f 87 65 ff ff ff    	ja     8049a9 <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804a44:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804a49:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  804a4b:	c1 e8 10             	shr    $0x10,%eax
+  804a4e:	0f 84 55 ff ff ff    	je     8049a9 <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804a54:	c1 e0 10             	shl    $0x10,%eax
+  804a57:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  804a5c:	29 c1                	sub    %eax,%ecx
+  804a5e:	e9 4c ff ff ff       	jmp    8049af <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  804a63:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  804a66:	c1 e2 04             	shl    $0x4,%edx
+  804a69:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  804a6f:	8b 52 48             	mov    0x48(%edx),%edx
+  804a72:	39 fa                	cmp    %edi,%edx
+  804a74:	0f 85 52 ff ff ff    	jne    8049cc <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  804a7a:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  804a7d:	c1 e2 04             	shl    $0x4,%edx
+  804a80:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  804a86:	8b 52 54             	mov    0x54(%edx),%edx
+  804a89:	85 d2                	test   %edx,%edx
+  804a8b:	0f 84 3b ff ff ff    	je     8049cc <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  804a91:	83 ec 0c             	sub    $0xc,%esp
+  804a94:	50                   	push   %eax
+  804a95:	57                   	push   %edi
+  804a96:	68 44 59 80 00       	push   $0x805944
+  804a9b:	68 bb 00 00 00       	push   $0xbb
+  804aa0:	68 36 59 80 00       	push   $0x805936
+  804aa5:	e8 7e ba ff ff       	call   800528 <_panic>
+	}
+}
+  804aaa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804aad:	5b                   	pop    %ebx
+  804aae:	5e                   	pop    %esi
+  804aaf:	5f                   	pop    %edi
+  804ab0:	5d                   	pop    %ebp
+  804ab1:	c3                   	ret
+
+00804ab2 <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  804ab2:	55                   	push   %ebp
+  804ab3:	89 e5                	mov    %esp,%ebp
+  804ab5:	53                   	push   %ebx
+  804ab6:	83 ec 04             	sub    $0x4,%esp
+  804ab9:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804abb:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  804ac1:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  804ac7:	0f 87 85 00 00 00    	ja     804b52 <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804acd:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  804ad2:	29 c3                	sub    %eax,%ebx
+  804ad4:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  804ad7:	83 ec 04             	sub    $0x4,%esp
+  804ada:	68 80 02 00 00       	push   $0x280
+  804adf:	6a 00                	push   $0x0
+  804ae1:	68 40 70 80 00       	push   $0x807040
+  804ae6:	e8 4d c2 ff ff       	call   800d38 <memset>
+	threads_mu.m_state = 0;
+  804aeb:	c7 05 20 70 80 00 00 	movl   $0x0,0x807020
+  804af2:	00 00 00 
+	if (self != 0) {
+  804af5:	83 c4 10             	add    $0x10,%esp
+  804af8:	85 db                	test   %ebx,%ebx
+  804afa:	74 51                	je     804b4d <pthread_fork_child+0x9b>
+  804afc:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804afe:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804b04:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804b09:	77 18                	ja     804b23 <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804b0b:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804b10:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804b12:	c1 e8 10             	shr    $0x10,%eax
+  804b15:	74 0c                	je     804b23 <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804b17:	c1 e0 10             	shl    $0x10,%eax
+  804b1a:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804b1f:	29 c2                	sub    %eax,%edx
+  804b21:	eb 06                	jmp    804b29 <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  804b23:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		threads[self].th_env = thisenv->env_id;
+  804b29:	8b 02                	mov    (%edx),%eax
+  804b2b:	8b 48 48             	mov    0x48(%eax),%ecx
+  804b2e:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  804b35:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  804b38:	89 0c 95 40 70 80 00 	mov    %ecx,0x807040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  804b3f:	8d 04 95 40 70 80 00 	lea    0x807040(,%edx,4),%eax
+  804b46:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  804b4d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804b50:	c9                   	leave
+  804b51:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  804b52:	83 ec 04             	sub    $0x4,%esp
+  804b55:	68 80 02 00 00       	push   $0x280
+  804b5a:	6a 00                	push   $0x0
+  804b5c:	68 40 70 80 00       	push   $0x807040
+  804b61:	e8 d2 c1 ff ff       	call   800d38 <memset>
+	threads_mu.m_state = 0;
+  804b66:	c7 05 20 70 80 00 00 	movl   $0x0,0x807020
+  804b6d:	00 00 00 
+  804b70:	83 c4 10             	add    $0x10,%esp
+  804b73:	eb d8                	jmp    804b4d <pthread_fork_child+0x9b>
+
+00804b75 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804b75:	55                   	push   %ebp
+  804b76:	89 e5                	mov    %esp,%ebp
+  804b78:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  804b7b:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  804b82:	74 0a                	je     804b8e <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804b84:	8b 45 08             	mov    0x8(%ebp),%eax
+  804b87:	a3 00 a0 80 00       	mov    %eax,0x80a000
+}
+  804b8c:	c9                   	leave
+  804b8d:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  804b8e:	83 ec 04             	sub    $0x4,%esp
+  804b91:	6a 07                	push   $0x7
+  804b93:	68 00 f0 bf ee       	push   $0xeebff000
+  804b98:	6a 00                	push   $0x0
+  804b9a:	e8 86 c4 ff ff       	call   801025 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804b9f:	83 c4 08             	add    $0x8,%esp
+  804ba2:	68 b3 4b 80 00       	push   $0x804bb3
+  804ba7:	6a 00                	push   $0x0
+  804ba9:	e8 f4 c5 ff ff       	call   8011a2 <sys_env_set_pgfault_upcall>
+  804bae:	83 c4 10             	add    $0x10,%esp
+  804bb1:	eb d1                	jmp    804b84 <set_pgfault_handler+0xf>
+
+00804bb3 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804bb3:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804bb4:	a1 00 a0 80 00       	mov    0x80a000,%eax
+	call *%eax
+  804bb9:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804bbb:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  804bbe:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  804bc2:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  804bc6:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  804bc9:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  804bcd:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  804bcf:	83 c4 08             	add    $0x8,%esp
+	popal
+  804bd2:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  804bd3:	83 c4 04             	add    $0x4,%esp
+	popfl
+  804bd6:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  804bd7:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  804bd8:	c3                   	ret
+
+00804bd9 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  804bd9:	55                   	push   %ebp
+  804bda:	89 e5                	mov    %esp,%ebp
+  804bdc:	57                   	push   %edi
+  804bdd:	56                   	push   %esi
+  804bde:	53                   	push   %ebx
+  804bdf:	83 ec 18             	sub    $0x18,%esp
+  804be2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804be5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804be8:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  804beb:	85 c0                	test   %eax,%eax
+  804bed:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804bf2:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  804bf5:	50                   	push   %eax
+  804bf6:	e8 20 c6 ff ff       	call   80121b <sys_ipc_recv>
+	if (r < 0) {
+  804bfb:	83 c4 10             	add    $0x10,%esp
+  804bfe:	85 c0                	test   %eax,%eax
+  804c00:	78 2b                	js     804c2d <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  804c02:	85 ff                	test   %edi,%edi
+  804c04:	74 55                	je     804c5b <ipc_recv+0x82>
+  804c06:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804c08:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804c0e:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804c13:	77 39                	ja     804c4e <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804c15:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804c1a:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804c1c:	c1 e8 10             	shr    $0x10,%eax
+  804c1f:	74 2d                	je     804c4e <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804c21:	c1 e0 10             	shl    $0x10,%eax
+  804c24:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804c29:	29 c2                	sub    %eax,%edx
+  804c2b:	eb 27                	jmp    804c54 <ipc_recv+0x7b>
+  804c2d:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  804c2f:	83 ec 08             	sub    $0x8,%esp
+  804c32:	50                   	push   %eax
+  804c33:	68 69 59 80 00       	push   $0x805969
+  804c38:	e8 c6 b9 ff ff       	call   800603 <cprintf>
+		*from_env_store = 0;
+  804c3d:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  804c43:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  804c49:	83 c4 10             	add    $0x10,%esp
+  804c4c:	eb 77                	jmp    804cc5 <ipc_recv+0xec>
+		return pthread_main_tls;
+  804c4e:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  804c54:	8b 02                	mov    (%edx),%eax
+  804c56:	8b 40 78             	mov    0x78(%eax),%eax
+  804c59:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804c5b:	85 f6                	test   %esi,%esi
+  804c5d:	74 34                	je     804c93 <ipc_recv+0xba>
+  804c5f:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804c61:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804c67:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804c6c:	77 18                	ja     804c86 <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804c6e:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804c73:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804c75:	c1 e8 10             	shr    $0x10,%eax
+  804c78:	74 0c                	je     804c86 <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804c7a:	c1 e0 10             	shl    $0x10,%eax
+  804c7d:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804c82:	29 c2                	sub    %eax,%edx
+  804c84:	eb 06                	jmp    804c8c <ipc_recv+0xb3>
+		return pthread_main_tls;
+  804c86:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  804c8c:	8b 02                	mov    (%edx),%eax
+  804c8e:	8b 40 7c             	mov    0x7c(%eax),%eax
+  804c91:	89 06                	mov    %eax,(%esi)
+  804c93:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804c95:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804c9b:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804ca0:	77 18                	ja     804cba <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804ca2:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804ca7:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804ca9:	c1 e8 10             	shr    $0x10,%eax
+  804cac:	74 0c                	je     804cba <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804cae:	c1 e0 10             	shl    $0x10,%eax
+  804cb1:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804cb6:	29 c2                	sub    %eax,%edx
+  804cb8:	eb 06                	jmp    804cc0 <ipc_recv+0xe7>
+		return pthread_main_tls;
+  804cba:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+	}
+	return thisenv->env_ipc_value;
+  804cc0:	8b 02                	mov    (%edx),%eax
+  804cc2:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  804cc5:	89 d8                	mov    %ebx,%eax
+  804cc7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804cca:	5b                   	pop    %ebx
+  804ccb:	5e                   	pop    %esi
+  804ccc:	5f                   	pop    %edi
+  804ccd:	5d                   	pop    %ebp
+  804cce:	c3                   	ret
+
+00804ccf <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  804ccf:	55                   	push   %ebp
+  804cd0:	89 e5                	mov    %esp,%ebp
+  804cd2:	57                   	push   %edi
+  804cd3:	56                   	push   %esi
+  804cd4:	53                   	push   %ebx
+  804cd5:	83 ec 0c             	sub    $0xc,%esp
+  804cd8:	8b 75 08             	mov    0x8(%ebp),%esi
+  804cdb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804cde:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  804ce1:	85 db                	test   %ebx,%ebx
+  804ce3:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  804ce8:	0f 44 d8             	cmove  %eax,%ebx
+  804ceb:	eb 05                	jmp    804cf2 <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  804ced:	e8 07 c3 ff ff       	call   800ff9 <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  804cf2:	57                   	push   %edi
+  804cf3:	53                   	push   %ebx
+  804cf4:	ff 75 0c             	push   0xc(%ebp)
+  804cf7:	56                   	push   %esi
+  804cf8:	e8 f1 c4 ff ff       	call   8011ee <sys_ipc_try_send>
+		if (r == 0) {
+  804cfd:	83 c4 10             	add    $0x10,%esp
+  804d00:	85 c0                	test   %eax,%eax
+  804d02:	74 19                	je     804d1d <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  804d04:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  804d07:	74 e4                	je     804ced <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  804d09:	83 ec 0c             	sub    $0xc,%esp
+  804d0c:	50                   	push   %eax
+  804d0d:	57                   	push   %edi
+  804d0e:	53                   	push   %ebx
+  804d0f:	56                   	push   %esi
+  804d10:	68 84 59 80 00       	push   $0x805984
+  804d15:	e8 e9 b8 ff ff       	call   800603 <cprintf>
+			return;
+  804d1a:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  804d1d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804d20:	5b                   	pop    %ebx
+  804d21:	5e                   	pop    %esi
+  804d22:	5f                   	pop    %edi
+  804d23:	5d                   	pop    %ebp
+  804d24:	c3                   	ret
+
+00804d25 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804d25:	55                   	push   %ebp
+  804d26:	89 e5                	mov    %esp,%ebp
+  804d28:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  804d2b:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  804d30:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804d33:	c1 e0 04             	shl    $0x4,%eax
+  804d36:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804d3b:	8b 40 50             	mov    0x50(%eax),%eax
+  804d3e:	39 c8                	cmp    %ecx,%eax
+  804d40:	74 12                	je     804d54 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804d42:	83 c2 01             	add    $0x1,%edx
+  804d45:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  804d4b:	75 e3                	jne    804d30 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  804d4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d52:	eb 0e                	jmp    804d62 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  804d54:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804d57:	c1 e0 04             	shl    $0x4,%eax
+  804d5a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804d5f:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  804d62:	5d                   	pop    %ebp
+  804d63:	c3                   	ret
+
+00804d64 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804d64:	55                   	push   %ebp
+  804d65:	89 e5                	mov    %esp,%ebp
+  804d67:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804d6a:	89 c2                	mov    %eax,%edx
+  804d6c:	c1 ea 16             	shr    $0x16,%edx
+  804d6f:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  804d76:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804d7b:	f6 c1 01             	test   $0x1,%cl
+  804d7e:	74 1c                	je     804d9c <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  804d80:	c1 e8 0c             	shr    $0xc,%eax
+  804d83:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  804d8a:	a8 01                	test   $0x1,%al
+  804d8c:	74 0e                	je     804d9c <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  804d8e:	c1 e8 0c             	shr    $0xc,%eax
+  804d91:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  804d98:	ef 
+  804d99:	0f b7 d2             	movzwl %dx,%edx
+}
+  804d9c:	89 d0                	mov    %edx,%eax
+  804d9e:	5d                   	pop    %ebp
+  804d9f:	c3                   	ret
+
+00804da0 <udm>:
+  804da0:	57                   	push   %edi
+  804da1:	56                   	push   %esi
+  804da2:	53                   	push   %ebx
+  804da3:	83 ec 20             	sub    $0x20,%esp
+  804da6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  804daa:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804dae:	8b 44 24 30          	mov    0x30(%esp),%eax
+  804db2:	8b 54 24 34          	mov    0x34(%esp),%edx
+  804db6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804dba:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804dbe:	89 d1                	mov    %edx,%ecx
+  804dc0:	09 c1                	or     %eax,%ecx
+  804dc2:	0f 84 91 00 00 00    	je     804e59 <udm+0xb9>
+  804dc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dcd:	ba 00 00 00 00       	mov    $0x0,%edx
+  804dd2:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804dd7:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804dde:	00 
+  804ddf:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  804de6:	00 
+  804de7:	eb 08                	jmp    804df1 <udm+0x51>
+  804de9:	83 e9 01             	sub    $0x1,%ecx
+  804dec:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  804def:	74 7c                	je     804e6d <udm+0xcd>
+  804df1:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804df5:	01 c0                	add    %eax,%eax
+  804df7:	89 c6                	mov    %eax,%esi
+  804df9:	89 d7                	mov    %edx,%edi
+  804dfb:	8b 44 24 10          	mov    0x10(%esp),%eax
+  804dff:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804e03:	0f ad d0             	shrd   %cl,%edx,%eax
+  804e06:	d3 ea                	shr    %cl,%edx
+  804e08:	f6 c1 20             	test   $0x20,%cl
+  804e0b:	74 04                	je     804e11 <udm+0x71>
+  804e0d:	89 d0                	mov    %edx,%eax
+  804e0f:	31 d2                	xor    %edx,%edx
+  804e11:	83 e0 01             	and    $0x1,%eax
+  804e14:	89 04 24             	mov    %eax,(%esp)
+  804e17:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804e1e:	00 
+  804e1f:	8b 04 24             	mov    (%esp),%eax
+  804e22:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804e26:	09 f0                	or     %esi,%eax
+  804e28:	09 fa                	or     %edi,%edx
+  804e2a:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804e2e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804e32:	39 f0                	cmp    %esi,%eax
+  804e34:	89 d3                	mov    %edx,%ebx
+  804e36:	19 fb                	sbb    %edi,%ebx
+  804e38:	72 af                	jb     804de9 <udm+0x49>
+  804e3a:	29 f0                	sub    %esi,%eax
+  804e3c:	19 fa                	sbb    %edi,%edx
+  804e3e:	89 cf                	mov    %ecx,%edi
+  804e40:	c1 ef 05             	shr    $0x5,%edi
+  804e43:	83 e7 01             	and    $0x1,%edi
+  804e46:	89 fe                	mov    %edi,%esi
+  804e48:	83 f6 01             	xor    $0x1,%esi
+  804e4b:	d3 e6                	shl    %cl,%esi
+  804e4d:	d3 e7                	shl    %cl,%edi
+  804e4f:	09 74 24 18          	or     %esi,0x18(%esp)
+  804e53:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804e57:	eb 90                	jmp    804de9 <udm+0x49>
+  804e59:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804e5d:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804e61:	89 f0                	mov    %esi,%eax
+  804e63:	89 fa                	mov    %edi,%edx
+  804e65:	89 74 24 18          	mov    %esi,0x18(%esp)
+  804e69:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  804e6d:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  804e71:	89 01                	mov    %eax,(%ecx)
+  804e73:	89 51 04             	mov    %edx,0x4(%ecx)
+  804e76:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804e7a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804e7e:	83 c4 20             	add    $0x20,%esp
+  804e81:	5b                   	pop    %ebx
+  804e82:	5e                   	pop    %esi
+  804e83:	5f                   	pop    %edi
+  804e84:	c3                   	ret
+
+00804e85 <__udivdi3>:
+  804e85:	83 ec 18             	sub    $0x18,%esp
+  804e88:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804e8c:	50                   	push   %eax
+  804e8d:	ff 74 24 2c          	push   0x2c(%esp)
+  804e91:	ff 74 24 2c          	push   0x2c(%esp)
+  804e95:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804e99:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804e9d:	e8 fe fe ff ff       	call   804da0 <udm>
+  804ea2:	83 c4 24             	add    $0x24,%esp
+  804ea5:	c3                   	ret
+
+00804ea6 <__umoddi3>:
+  804ea6:	83 ec 18             	sub    $0x18,%esp
+  804ea9:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804ead:	50                   	push   %eax
+  804eae:	ff 74 24 2c          	push   0x2c(%esp)
+  804eb2:	ff 74 24 2c          	push   0x2c(%esp)
+  804eb6:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804eba:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804ebe:	e8 dd fe ff ff       	call   804da0 <udm>
+  804ec3:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804ec7:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804ecb:	83 c4 24             	add    $0x24,%esp
+  804ece:	c3                   	ret
+
+00804ecf <__divdi3>:
+  804ecf:	56                   	push   %esi
+  804ed0:	53                   	push   %ebx
+  804ed1:	83 ec 14             	sub    $0x14,%esp
+  804ed4:	8b 44 24 20          	mov    0x20(%esp),%eax
+  804ed8:	8b 54 24 24          	mov    0x24(%esp),%edx
+  804edc:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  804ee0:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  804ee4:	85 d2                	test   %edx,%edx
+  804ee6:	78 18                	js     804f00 <__divdi3+0x31>
+  804ee8:	85 db                	test   %ebx,%ebx
+  804eea:	78 3e                	js     804f2a <__divdi3+0x5b>
+  804eec:	83 ec 04             	sub    $0x4,%esp
+  804eef:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804ef3:	56                   	push   %esi
+  804ef4:	53                   	push   %ebx
+  804ef5:	51                   	push   %ecx
+  804ef6:	e8 a5 fe ff ff       	call   804da0 <udm>
+  804efb:	83 c4 10             	add    $0x10,%esp
+  804efe:	eb 24                	jmp    804f24 <__divdi3+0x55>
+  804f00:	f7 d8                	neg    %eax
+  804f02:	83 d2 00             	adc    $0x0,%edx
+  804f05:	f7 da                	neg    %edx
+  804f07:	85 db                	test   %ebx,%ebx
+  804f09:	78 3a                	js     804f45 <__divdi3+0x76>
+  804f0b:	83 ec 04             	sub    $0x4,%esp
+  804f0e:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804f12:	56                   	push   %esi
+  804f13:	53                   	push   %ebx
+  804f14:	51                   	push   %ecx
+  804f15:	e8 86 fe ff ff       	call   804da0 <udm>
+  804f1a:	83 c4 10             	add    $0x10,%esp
+  804f1d:	f7 d8                	neg    %eax
+  804f1f:	83 d2 00             	adc    $0x0,%edx
+  804f22:	f7 da                	neg    %edx
+  804f24:	83 c4 14             	add    $0x14,%esp
+  804f27:	5b                   	pop    %ebx
+  804f28:	5e                   	pop    %esi
+  804f29:	c3                   	ret
+  804f2a:	83 ec 04             	sub    $0x4,%esp
+  804f2d:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804f31:	56                   	push   %esi
+  804f32:	f7 d9                	neg    %ecx
+  804f34:	83 d3 00             	adc    $0x0,%ebx
+  804f37:	f7 db                	neg    %ebx
+  804f39:	53                   	push   %ebx
+  804f3a:	51                   	push   %ecx
+  804f3b:	e8 60 fe ff ff       	call   804da0 <udm>
+  804f40:	83 c4 10             	add    $0x10,%esp
+  804f43:	eb d8                	jmp    804f1d <__divdi3+0x4e>
+  804f45:	83 ec 04             	sub    $0x4,%esp
+  804f48:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804f4c:	56                   	push   %esi
+  804f4d:	f7 d9                	neg    %ecx
+  804f4f:	83 d3 00             	adc    $0x0,%ebx
+  804f52:	f7 db                	neg    %ebx
+  804f54:	53                   	push   %ebx
+  804f55:	51                   	push   %ecx
+  804f56:	e8 45 fe ff ff       	call   804da0 <udm>
+  804f5b:	83 c4 10             	add    $0x10,%esp
+  804f5e:	eb c4                	jmp    804f24 <__divdi3+0x55>
+
+00804f60 <__moddi3>:
+  804f60:	55                   	push   %ebp
+  804f61:	57                   	push   %edi
+  804f62:	56                   	push   %esi
+  804f63:	53                   	push   %ebx
+  804f64:	83 ec 24             	sub    $0x24,%esp
+  804f67:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804f6b:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804f6f:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  804f73:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  804f77:	85 d2                	test   %edx,%edx
+  804f79:	78 3b                	js     804fb6 <__moddi3+0x56>
+  804f7b:	83 ec 04             	sub    $0x4,%esp
+  804f7e:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804f82:	56                   	push   %esi
+  804f83:	89 ce                	mov    %ecx,%esi
+  804f85:	f7 de                	neg    %esi
+  804f87:	89 74 24 08          	mov    %esi,0x8(%esp)
+  804f8b:	89 de                	mov    %ebx,%esi
+  804f8d:	83 d6 00             	adc    $0x0,%esi
+  804f90:	f7 de                	neg    %esi
+  804f92:	89 74 24 14          	mov    %esi,0x14(%esp)
+  804f96:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804f9a:	0f 48 f1             	cmovs  %ecx,%esi
+  804f9d:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  804fa2:	53                   	push   %ebx
+  804fa3:	56                   	push   %esi
+  804fa4:	e8 f7 fd ff ff       	call   804da0 <udm>
+  804fa9:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804fad:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804fb1:	83 c4 10             	add    $0x10,%esp
+  804fb4:	eb 47                	jmp    804ffd <__moddi3+0x9d>
+  804fb6:	f7 d8                	neg    %eax
+  804fb8:	83 d2 00             	adc    $0x0,%edx
+  804fbb:	f7 da                	neg    %edx
+  804fbd:	83 ec 04             	sub    $0x4,%esp
+  804fc0:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804fc4:	56                   	push   %esi
+  804fc5:	89 cf                	mov    %ecx,%edi
+  804fc7:	f7 df                	neg    %edi
+  804fc9:	89 de                	mov    %ebx,%esi
+  804fcb:	83 d6 00             	adc    $0x0,%esi
+  804fce:	f7 de                	neg    %esi
+  804fd0:	0f 49 cf             	cmovns %edi,%ecx
+  804fd3:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  804fd7:	0f 49 de             	cmovns %esi,%ebx
+  804fda:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  804fde:	ff 74 24 0c          	push   0xc(%esp)
+  804fe2:	ff 74 24 0c          	push   0xc(%esp)
+  804fe6:	e8 b5 fd ff ff       	call   804da0 <udm>
+  804feb:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804fef:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804ff3:	f7 d8                	neg    %eax
+  804ff5:	83 d2 00             	adc    $0x0,%edx
+  804ff8:	f7 da                	neg    %edx
+  804ffa:	83 c4 10             	add    $0x10,%esp
+  804ffd:	83 c4 24             	add    $0x24,%esp
+  805000:	5b                   	pop    %ebx
+  805001:	5e                   	pop    %esi
+  805002:	5f                   	pop    %edi
+  805003:	5d                   	pop    %ebp
+  805004:	c3                   	ret
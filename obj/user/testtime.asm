@@ -0,0 +1,9779 @@
+
+obj/user/testtime.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 c5 00 00 00       	call   8000f6 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <sleep>:
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+void
+sleep(int sec)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 04             	sub    $0x4,%esp
+	unsigned now = sys_time_msec();
+  80003a:	e8 e4 0e 00 00       	call   800f23 <sys_time_msec>
+	unsigned end = now + sec * 1000;
+  80003f:	69 5d 08 e8 03 00 00 	imul   $0x3e8,0x8(%ebp),%ebx
+  800046:	01 c3                	add    %eax,%ebx
+
+	if ((int)now < 0 && (int)now > -MAXERROR)
+  800048:	85 c0                	test   %eax,%eax
+  80004a:	79 05                	jns    800051 <sleep+0x1e>
+  80004c:	83 f8 ec             	cmp    $0xffffffec,%eax
+  80004f:	7d 18                	jge    800069 <sleep+0x36>
+		panic("sys_time_msec: %e", (int)now);
+	if (end < now)
+  800051:	39 c3                	cmp    %eax,%ebx
+  800053:	73 2b                	jae    800080 <sleep+0x4d>
+		panic("sleep: wrap");
+  800055:	83 ec 04             	sub    $0x4,%esp
+  800058:	68 a2 47 80 00       	push   $0x8047a2
+  80005d:	6a 0d                	push   $0xd
+  80005f:	68 92 47 80 00       	push   $0x804792
+  800064:	e8 30 01 00 00       	call   800199 <_panic>
+		panic("sys_time_msec: %e", (int)now);
+  800069:	50                   	push   %eax
+  80006a:	68 80 47 80 00       	push   $0x804780
+  80006f:	6a 0b                	push   $0xb
+  800071:	68 92 47 80 00       	push   $0x804792
+  800076:	e8 1e 01 00 00       	call   800199 <_panic>
+
+	while (sys_time_msec() < end)
+		sys_yield();
+  80007b:	e8 ea 0b 00 00       	call   800c6a <sys_yield>
+	while (sys_time_msec() < end)
+  800080:	e8 9e 0e 00 00       	call   800f23 <sys_time_msec>
+  800085:	39 d8                	cmp    %ebx,%eax
+  800087:	72 f2                	jb     80007b <sleep+0x48>
+}
+  800089:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80008c:	c9                   	leave
+  80008d:	c3                   	ret
+
+0080008e <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  80008e:	55                   	push   %ebp
+  80008f:	89 e5                	mov    %esp,%ebp
+  800091:	53                   	push   %ebx
+  800092:	83 ec 04             	sub    $0x4,%esp
+	int i;
+
+	// Wait for the console to calm down
+	for (i = 0; i < 50; i++)
+  800095:	bb 33 00 00 00       	mov    $0x33,%ebx
+  80009a:	eb 05                	jmp    8000a1 <umain+0x13>
+		sys_yield();
+  80009c:	e8 c9 0b 00 00       	call   800c6a <sys_yield>
+	for (i = 0; i < 50; i++)
+  8000a1:	83 eb 01             	sub    $0x1,%ebx
+  8000a4:	75 f6                	jne    80009c <umain+0xe>
+
+	cprintf("starting count down: ");
+  8000a6:	83 ec 0c             	sub    $0xc,%esp
+  8000a9:	68 ae 47 80 00       	push   $0x8047ae
+  8000ae:	e8 c1 01 00 00       	call   800274 <cprintf>
+  8000b3:	83 c4 10             	add    $0x10,%esp
+	for (i = 5; i >= 0; i--) {
+  8000b6:	bb 05 00 00 00       	mov    $0x5,%ebx
+		cprintf("%d ", i);
+  8000bb:	83 ec 08             	sub    $0x8,%esp
+  8000be:	53                   	push   %ebx
+  8000bf:	68 c4 47 80 00       	push   $0x8047c4
+  8000c4:	e8 ab 01 00 00       	call   800274 <cprintf>
+		sleep(1);
+  8000c9:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  8000d0:	e8 5e ff ff ff       	call   800033 <sleep>
+	for (i = 5; i >= 0; i--) {
+  8000d5:	83 eb 01             	sub    $0x1,%ebx
+  8000d8:	83 c4 10             	add    $0x10,%esp
+  8000db:	83 fb ff             	cmp    $0xffffffff,%ebx
+  8000de:	75 db                	jne    8000bb <umain+0x2d>
+	}
+	cprintf("\n");
+  8000e0:	83 ec 0c             	sub    $0xc,%esp
+  8000e3:	68 be 4e 80 00       	push   $0x804ebe
+  8000e8:	e8 87 01 00 00       	call   800274 <cprintf>
+#include <inc/types.h>
+
+static inline void
+breakpoint(void)
+{
+	asm volatile("int3");
+  8000ed:	cc                   	int3
+	breakpoint();
+}
+  8000ee:	83 c4 10             	add    $0x10,%esp
+  8000f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000f4:	c9                   	leave
+  8000f5:	c3                   	ret
+
+008000f6 <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000f6:	55                   	push   %ebp
+  8000f7:	89 e5                	mov    %esp,%ebp
+  8000f9:	57                   	push   %edi
+  8000fa:	56                   	push   %esi
+  8000fb:	53                   	push   %ebx
+  8000fc:	83 ec 1c             	sub    $0x1c,%esp
+  8000ff:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800102:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  800105:	e8 34 0b 00 00       	call   800c3e <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  80010a:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  80010d:	89 15 c0 62 80 00    	mov    %edx,0x8062c0
+	thisenv = &envs[ENVX(eid)];
+  800113:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800118:	89 c1                	mov    %eax,%ecx
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  80011a:	89 e7                	mov    %esp,%edi
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80011c:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  800122:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800127:	77 16                	ja     80013f <libmain+0x49>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800129:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80012e:	29 f8                	sub    %edi,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  800130:	c1 e8 10             	shr    $0x10,%eax
+  800133:	74 0a                	je     80013f <libmain+0x49>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800135:	c1 e0 10             	shl    $0x10,%eax
+  800138:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80013d:	29 c2                	sub    %eax,%edx
+  80013f:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  800142:	c1 e0 04             	shl    $0x4,%eax
+  800145:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80014a:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80014c:	85 db                	test   %ebx,%ebx
+  80014e:	7e 07                	jle    800157 <libmain+0x61>
+		binaryname = argv[0];
+  800150:	8b 06                	mov    (%esi),%eax
+  800152:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  800157:	83 ec 08             	sub    $0x8,%esp
+  80015a:	56                   	push   %esi
+  80015b:	53                   	push   %ebx
+  80015c:	e8 2d ff ff ff       	call   80008e <umain>
+
+	// exit gracefully
+	exit();
+  800161:	e8 0b 00 00 00       	call   800171 <exit>
+}
+  800166:	83 c4 10             	add    $0x10,%esp
+  800169:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80016c:	5b                   	pop    %ebx
+  80016d:	5e                   	pop    %esi
+  80016e:	5f                   	pop    %edi
+  80016f:	5d                   	pop    %ebp
+  800170:	c3                   	ret
+
+00800171 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800171:	55                   	push   %ebp
+  800172:	89 e5                	mov    %esp,%ebp
+  800174:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  800177:	6a 00                	push   $0x0
+  800179:	e8 15 21 00 00       	call   802293 <fflush>
+	pthread_kill_others();
+  80017e:	e8 80 37 00 00       	call   803903 <pthread_kill_others>
+	close_all();
+  800183:	e8 ae 11 00 00       	call   801336 <close_all>
+	sys_env_destroy(0);
+  800188:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80018f:	e8 5f 0a 00 00       	call   800bf3 <sys_env_destroy>
+}
+  800194:	83 c4 10             	add    $0x10,%esp
+  800197:	c9                   	leave
+  800198:	c3                   	ret
+
+00800199 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800199:	55                   	push   %ebp
+  80019a:	89 e5                	mov    %esp,%ebp
+  80019c:	56                   	push   %esi
+  80019d:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80019e:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8001a1:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  8001a7:	e8 92 0a 00 00       	call   800c3e <sys_getenvid>
+  8001ac:	83 ec 0c             	sub    $0xc,%esp
+  8001af:	ff 75 0c             	push   0xc(%ebp)
+  8001b2:	ff 75 08             	push   0x8(%ebp)
+  8001b5:	56                   	push   %esi
+  8001b6:	50                   	push   %eax
+  8001b7:	68 d4 47 80 00       	push   $0x8047d4
+  8001bc:	e8 b3 00 00 00       	call   800274 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8001c1:	83 c4 18             	add    $0x18,%esp
+  8001c4:	53                   	push   %ebx
+  8001c5:	ff 75 10             	push   0x10(%ebp)
+  8001c8:	e8 56 00 00 00       	call   800223 <vcprintf>
+	cprintf("\n");
+  8001cd:	c7 04 24 be 4e 80 00 	movl   $0x804ebe,(%esp)
+  8001d4:	e8 9b 00 00 00       	call   800274 <cprintf>
+  8001d9:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8001dc:	cc                   	int3
+	while (1)
+  8001dd:	eb fd                	jmp    8001dc <_panic+0x43>
+
+008001df <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8001df:	55                   	push   %ebp
+  8001e0:	89 e5                	mov    %esp,%ebp
+  8001e2:	53                   	push   %ebx
+  8001e3:	83 ec 04             	sub    $0x4,%esp
+  8001e6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8001e9:	8b 13                	mov    (%ebx),%edx
+  8001eb:	8d 42 01             	lea    0x1(%edx),%eax
+  8001ee:	89 03                	mov    %eax,(%ebx)
+  8001f0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001f3:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001f7:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001fc:	74 09                	je     800207 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001fe:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800202:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800205:	c9                   	leave
+  800206:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800207:	83 ec 08             	sub    $0x8,%esp
+  80020a:	68 ff 00 00 00       	push   $0xff
+  80020f:	8d 43 08             	lea    0x8(%ebx),%eax
+  800212:	50                   	push   %eax
+  800213:	e8 84 09 00 00       	call   800b9c <sys_cputs>
+		b->idx = 0;
+  800218:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80021e:	83 c4 10             	add    $0x10,%esp
+  800221:	eb db                	jmp    8001fe <putch+0x1f>
+
+00800223 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800223:	55                   	push   %ebp
+  800224:	89 e5                	mov    %esp,%ebp
+  800226:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80022c:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800233:	00 00 00 
+	b.cnt = 0;
+  800236:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80023d:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800240:	ff 75 0c             	push   0xc(%ebp)
+  800243:	ff 75 08             	push   0x8(%ebp)
+  800246:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80024c:	50                   	push   %eax
+  80024d:	68 df 01 80 00       	push   $0x8001df
+  800252:	e8 14 01 00 00       	call   80036b <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800257:	83 c4 08             	add    $0x8,%esp
+  80025a:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800260:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800266:	50                   	push   %eax
+  800267:	e8 30 09 00 00       	call   800b9c <sys_cputs>
+
+	return b.cnt;
+}
+  80026c:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800272:	c9                   	leave
+  800273:	c3                   	ret
+
+00800274 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800274:	55                   	push   %ebp
+  800275:	89 e5                	mov    %esp,%ebp
+  800277:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80027a:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80027d:	50                   	push   %eax
+  80027e:	ff 75 08             	push   0x8(%ebp)
+  800281:	e8 9d ff ff ff       	call   800223 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800286:	c9                   	leave
+  800287:	c3                   	ret
+
+00800288 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800288:	55                   	push   %ebp
+  800289:	89 e5                	mov    %esp,%ebp
+  80028b:	57                   	push   %edi
+  80028c:	56                   	push   %esi
+  80028d:	53                   	push   %ebx
+  80028e:	83 ec 1c             	sub    $0x1c,%esp
+  800291:	89 c7                	mov    %eax,%edi
+  800293:	89 d6                	mov    %edx,%esi
+  800295:	8b 45 08             	mov    0x8(%ebp),%eax
+  800298:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80029b:	89 d1                	mov    %edx,%ecx
+  80029d:	89 c2                	mov    %eax,%edx
+  80029f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8002a2:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8002a5:	8b 45 10             	mov    0x10(%ebp),%eax
+  8002a8:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8002ab:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8002ae:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8002b5:	39 c2                	cmp    %eax,%edx
+  8002b7:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8002ba:	72 3e                	jb     8002fa <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8002bc:	83 ec 0c             	sub    $0xc,%esp
+  8002bf:	ff 75 18             	push   0x18(%ebp)
+  8002c2:	83 eb 01             	sub    $0x1,%ebx
+  8002c5:	53                   	push   %ebx
+  8002c6:	50                   	push   %eax
+  8002c7:	83 ec 08             	sub    $0x8,%esp
+  8002ca:	ff 75 e4             	push   -0x1c(%ebp)
+  8002cd:	ff 75 e0             	push   -0x20(%ebp)
+  8002d0:	ff 75 dc             	push   -0x24(%ebp)
+  8002d3:	ff 75 d8             	push   -0x28(%ebp)
+  8002d6:	e8 21 43 00 00       	call   8045fc <__udivdi3>
+  8002db:	83 c4 18             	add    $0x18,%esp
+  8002de:	52                   	push   %edx
+  8002df:	50                   	push   %eax
+  8002e0:	89 f2                	mov    %esi,%edx
+  8002e2:	89 f8                	mov    %edi,%eax
+  8002e4:	e8 9f ff ff ff       	call   800288 <printnum>
+  8002e9:	83 c4 20             	add    $0x20,%esp
+  8002ec:	eb 13                	jmp    800301 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8002ee:	83 ec 08             	sub    $0x8,%esp
+  8002f1:	56                   	push   %esi
+  8002f2:	ff 75 18             	push   0x18(%ebp)
+  8002f5:	ff d7                	call   *%edi
+  8002f7:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8002fa:	83 eb 01             	sub    $0x1,%ebx
+  8002fd:	85 db                	test   %ebx,%ebx
+  8002ff:	7f ed                	jg     8002ee <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800301:	83 ec 08             	sub    $0x8,%esp
+  800304:	56                   	push   %esi
+  800305:	83 ec 04             	sub    $0x4,%esp
+  800308:	ff 75 e4             	push   -0x1c(%ebp)
+  80030b:	ff 75 e0             	push   -0x20(%ebp)
+  80030e:	ff 75 dc             	push   -0x24(%ebp)
+  800311:	ff 75 d8             	push   -0x28(%ebp)
+  800314:	e8 04 43 00 00       	call   80461d <__umoddi3>
+  800319:	83 c4 14             	add    $0x14,%esp
+  80031c:	0f be 80 f7 47 80 00 	movsbl 0x8047f7(%eax),%eax
+  800323:	50                   	push   %eax
+  800324:	ff d7                	call   *%edi
+}
+  800326:	83 c4 10             	add    $0x10,%esp
+  800329:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80032c:	5b                   	pop    %ebx
+  80032d:	5e                   	pop    %esi
+  80032e:	5f                   	pop    %edi
+  80032f:	5d                   	pop    %ebp
+  800330:	c3                   	ret
+
+00800331 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800331:	55                   	push   %ebp
+  800332:	89 e5                	mov    %esp,%ebp
+  800334:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800337:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80033b:	8b 10                	mov    (%eax),%edx
+  80033d:	3b 50 04             	cmp    0x4(%eax),%edx
+  800340:	73 0a                	jae    80034c <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800342:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800345:	89 08                	mov    %ecx,(%eax)
+  800347:	8b 45 08             	mov    0x8(%ebp),%eax
+  80034a:	88 02                	mov    %al,(%edx)
+}
+  80034c:	5d                   	pop    %ebp
+  80034d:	c3                   	ret
+
+0080034e <printfmt>:
+{
+  80034e:	55                   	push   %ebp
+  80034f:	89 e5                	mov    %esp,%ebp
+  800351:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800354:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800357:	50                   	push   %eax
+  800358:	ff 75 10             	push   0x10(%ebp)
+  80035b:	ff 75 0c             	push   0xc(%ebp)
+  80035e:	ff 75 08             	push   0x8(%ebp)
+  800361:	e8 05 00 00 00       	call   80036b <vprintfmt>
+}
+  800366:	83 c4 10             	add    $0x10,%esp
+  800369:	c9                   	leave
+  80036a:	c3                   	ret
+
+0080036b <vprintfmt>:
+{
+  80036b:	55                   	push   %ebp
+  80036c:	89 e5                	mov    %esp,%ebp
+  80036e:	57                   	push   %edi
+  80036f:	56                   	push   %esi
+  800370:	53                   	push   %ebx
+  800371:	83 ec 2c             	sub    $0x2c,%esp
+  800374:	8b 75 08             	mov    0x8(%ebp),%esi
+  800377:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80037a:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80037d:	eb 0a                	jmp    800389 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80037f:	83 ec 08             	sub    $0x8,%esp
+  800382:	53                   	push   %ebx
+  800383:	50                   	push   %eax
+  800384:	ff d6                	call   *%esi
+  800386:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  800389:	83 c7 01             	add    $0x1,%edi
+  80038c:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  800390:	83 f8 25             	cmp    $0x25,%eax
+  800393:	74 0c                	je     8003a1 <vprintfmt+0x36>
+			if (ch == '\0')
+  800395:	85 c0                	test   %eax,%eax
+  800397:	75 e6                	jne    80037f <vprintfmt+0x14>
+}
+  800399:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80039c:	5b                   	pop    %ebx
+  80039d:	5e                   	pop    %esi
+  80039e:	5f                   	pop    %edi
+  80039f:	5d                   	pop    %ebp
+  8003a0:	c3                   	ret
+		padc = ' ';
+  8003a1:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8003a5:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8003ac:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8003b3:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8003ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  8003bf:	8d 47 01             	lea    0x1(%edi),%eax
+  8003c2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003c5:	0f b6 17             	movzbl (%edi),%edx
+  8003c8:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8003cb:	3c 55                	cmp    $0x55,%al
+  8003cd:	0f 87 c5 03 00 00    	ja     800798 <vprintfmt+0x42d>
+  8003d3:	0f b6 c0             	movzbl %al,%eax
+  8003d6:	ff 24 85 80 49 80 00 	jmp    *0x804980(,%eax,4)
+  8003dd:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  8003e0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003e3:	eb da                	jmp    8003bf <vprintfmt+0x54>
+  8003e5:	0f be d2             	movsbl %dl,%edx
+  8003e8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8003eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003f0:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8003f3:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003f6:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8003fa:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8003fd:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800400:	83 f9 09             	cmp    $0x9,%ecx
+  800403:	77 55                	ja     80045a <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  800405:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800408:	eb e9                	jmp    8003f3 <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  80040a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80040d:	8b 00                	mov    (%eax),%eax
+  80040f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800412:	8b 45 14             	mov    0x14(%ebp),%eax
+  800415:	8d 40 04             	lea    0x4(%eax),%eax
+  800418:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  80041b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80041e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800422:	79 9b                	jns    8003bf <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800424:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800427:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80042a:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800431:	eb 8c                	jmp    8003bf <vprintfmt+0x54>
+			if (width < 0)
+  800433:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800436:	85 d2                	test   %edx,%edx
+  800438:	b8 00 00 00 00       	mov    $0x0,%eax
+  80043d:	0f 49 c2             	cmovns %edx,%eax
+  800440:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  800443:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800446:	e9 74 ff ff ff       	jmp    8003bf <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  80044b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80044e:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800455:	e9 65 ff ff ff       	jmp    8003bf <vprintfmt+0x54>
+  80045a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80045d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800460:	eb bc                	jmp    80041e <vprintfmt+0xb3>
+			lflag++;
+  800462:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  800465:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800468:	e9 52 ff ff ff       	jmp    8003bf <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80046d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800470:	8d 78 04             	lea    0x4(%eax),%edi
+  800473:	83 ec 08             	sub    $0x8,%esp
+  800476:	53                   	push   %ebx
+  800477:	ff 30                	push   (%eax)
+  800479:	ff d6                	call   *%esi
+			break;
+  80047b:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80047e:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800481:	e9 b1 02 00 00       	jmp    800737 <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  800486:	8b 45 14             	mov    0x14(%ebp),%eax
+  800489:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80048c:	8b 10                	mov    (%eax),%edx
+  80048e:	89 d0                	mov    %edx,%eax
+  800490:	f7 d8                	neg    %eax
+  800492:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800495:	83 f8 14             	cmp    $0x14,%eax
+  800498:	7f 23                	jg     8004bd <vprintfmt+0x152>
+  80049a:	8b 14 85 e0 4a 80 00 	mov    0x804ae0(,%eax,4),%edx
+  8004a1:	85 d2                	test   %edx,%edx
+  8004a3:	74 18                	je     8004bd <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  8004a5:	52                   	push   %edx
+  8004a6:	68 4f 4c 80 00       	push   $0x804c4f
+  8004ab:	53                   	push   %ebx
+  8004ac:	56                   	push   %esi
+  8004ad:	e8 9c fe ff ff       	call   80034e <printfmt>
+  8004b2:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004b5:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8004b8:	e9 7a 02 00 00       	jmp    800737 <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  8004bd:	50                   	push   %eax
+  8004be:	68 0f 48 80 00       	push   $0x80480f
+  8004c3:	53                   	push   %ebx
+  8004c4:	56                   	push   %esi
+  8004c5:	e8 84 fe ff ff       	call   80034e <printfmt>
+  8004ca:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004cd:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8004d0:	e9 62 02 00 00       	jmp    800737 <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004d5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004d8:	83 c0 04             	add    $0x4,%eax
+  8004db:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8004de:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e1:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8004e3:	85 c9                	test   %ecx,%ecx
+  8004e5:	b8 08 48 80 00       	mov    $0x804808,%eax
+  8004ea:	0f 45 c1             	cmovne %ecx,%eax
+  8004ed:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8004f0:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004f4:	7e 06                	jle    8004fc <vprintfmt+0x191>
+  8004f6:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8004fa:	75 0b                	jne    800507 <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004fc:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8004ff:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800502:	89 75 08             	mov    %esi,0x8(%ebp)
+  800505:	eb 5c                	jmp    800563 <vprintfmt+0x1f8>
+  800507:	83 ec 08             	sub    $0x8,%esp
+  80050a:	ff 75 d0             	push   -0x30(%ebp)
+  80050d:	ff 75 cc             	push   -0x34(%ebp)
+  800510:	e8 20 03 00 00       	call   800835 <strnlen>
+  800515:	89 c2                	mov    %eax,%edx
+  800517:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80051a:	29 d0                	sub    %edx,%eax
+  80051c:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80051f:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800523:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800526:	89 75 08             	mov    %esi,0x8(%ebp)
+  800529:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80052b:	eb 0e                	jmp    80053b <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  80052d:	83 ec 08             	sub    $0x8,%esp
+  800530:	53                   	push   %ebx
+  800531:	57                   	push   %edi
+  800532:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800535:	83 ee 01             	sub    $0x1,%esi
+  800538:	83 c4 10             	add    $0x10,%esp
+  80053b:	85 f6                	test   %esi,%esi
+  80053d:	7f ee                	jg     80052d <vprintfmt+0x1c2>
+  80053f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800542:	8b 75 08             	mov    0x8(%ebp),%esi
+  800545:	85 c0                	test   %eax,%eax
+  800547:	ba 00 00 00 00       	mov    $0x0,%edx
+  80054c:	0f 49 d0             	cmovns %eax,%edx
+  80054f:	29 d0                	sub    %edx,%eax
+  800551:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800554:	eb a6                	jmp    8004fc <vprintfmt+0x191>
+					putch(ch, putdat);
+  800556:	83 ec 08             	sub    $0x8,%esp
+  800559:	53                   	push   %ebx
+  80055a:	52                   	push   %edx
+  80055b:	ff 55 08             	call   *0x8(%ebp)
+  80055e:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800561:	89 f1                	mov    %esi,%ecx
+  800563:	8d 71 01             	lea    0x1(%ecx),%esi
+  800566:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80056a:	0f be d0             	movsbl %al,%edx
+  80056d:	85 d2                	test   %edx,%edx
+  80056f:	74 28                	je     800599 <vprintfmt+0x22e>
+  800571:	85 ff                	test   %edi,%edi
+  800573:	78 05                	js     80057a <vprintfmt+0x20f>
+  800575:	83 ef 01             	sub    $0x1,%edi
+  800578:	78 30                	js     8005aa <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80057a:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80057e:	74 d6                	je     800556 <vprintfmt+0x1eb>
+  800580:	0f be c0             	movsbl %al,%eax
+  800583:	83 e8 20             	sub    $0x20,%eax
+  800586:	83 f8 5e             	cmp    $0x5e,%eax
+  800589:	76 cb                	jbe    800556 <vprintfmt+0x1eb>
+					putch('?', putdat);
+  80058b:	83 ec 08             	sub    $0x8,%esp
+  80058e:	53                   	push   %ebx
+  80058f:	6a 3f                	push   $0x3f
+  800591:	ff 55 08             	call   *0x8(%ebp)
+  800594:	83 c4 10             	add    $0x10,%esp
+  800597:	eb c8                	jmp    800561 <vprintfmt+0x1f6>
+  800599:	8b 75 08             	mov    0x8(%ebp),%esi
+  80059c:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80059f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005a2:	01 d0                	add    %edx,%eax
+  8005a4:	29 c8                	sub    %ecx,%eax
+  8005a6:	89 c7                	mov    %eax,%edi
+  8005a8:	eb 13                	jmp    8005bd <vprintfmt+0x252>
+  8005aa:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005ad:	eb ed                	jmp    80059c <vprintfmt+0x231>
+				putch(' ', putdat);
+  8005af:	83 ec 08             	sub    $0x8,%esp
+  8005b2:	53                   	push   %ebx
+  8005b3:	6a 20                	push   $0x20
+  8005b5:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8005b7:	83 ef 01             	sub    $0x1,%edi
+  8005ba:	83 c4 10             	add    $0x10,%esp
+  8005bd:	85 ff                	test   %edi,%edi
+  8005bf:	7f ee                	jg     8005af <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005c1:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8005c4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005c7:	e9 6b 01 00 00       	jmp    800737 <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  8005cc:	83 f9 01             	cmp    $0x1,%ecx
+  8005cf:	7f 1f                	jg     8005f0 <vprintfmt+0x285>
+	else if (lflag)
+  8005d1:	85 c9                	test   %ecx,%ecx
+  8005d3:	74 67                	je     80063c <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  8005d5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d8:	8b 00                	mov    (%eax),%eax
+  8005da:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005dd:	89 c1                	mov    %eax,%ecx
+  8005df:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005e2:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005e5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e8:	8d 40 04             	lea    0x4(%eax),%eax
+  8005eb:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005ee:	eb 17                	jmp    800607 <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  8005f0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f3:	8b 50 04             	mov    0x4(%eax),%edx
+  8005f6:	8b 00                	mov    (%eax),%eax
+  8005f8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005fb:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800601:	8d 40 08             	lea    0x8(%eax),%eax
+  800604:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800607:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80060a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80060d:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800612:	85 c9                	test   %ecx,%ecx
+  800614:	0f 89 03 01 00 00    	jns    80071d <vprintfmt+0x3b2>
+				putch('-', putdat);
+  80061a:	83 ec 08             	sub    $0x8,%esp
+  80061d:	53                   	push   %ebx
+  80061e:	6a 2d                	push   $0x2d
+  800620:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800622:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800625:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800628:	f7 da                	neg    %edx
+  80062a:	83 d1 00             	adc    $0x0,%ecx
+  80062d:	f7 d9                	neg    %ecx
+  80062f:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800632:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800637:	e9 e1 00 00 00       	jmp    80071d <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  80063c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063f:	8b 00                	mov    (%eax),%eax
+  800641:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800644:	89 c1                	mov    %eax,%ecx
+  800646:	c1 f9 1f             	sar    $0x1f,%ecx
+  800649:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80064c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064f:	8d 40 04             	lea    0x4(%eax),%eax
+  800652:	89 45 14             	mov    %eax,0x14(%ebp)
+  800655:	eb b0                	jmp    800607 <vprintfmt+0x29c>
+	if (lflag >= 2)
+  800657:	83 f9 01             	cmp    $0x1,%ecx
+  80065a:	7f 1e                	jg     80067a <vprintfmt+0x30f>
+	else if (lflag)
+  80065c:	85 c9                	test   %ecx,%ecx
+  80065e:	74 32                	je     800692 <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  800660:	8b 45 14             	mov    0x14(%ebp),%eax
+  800663:	8b 10                	mov    (%eax),%edx
+  800665:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80066a:	8d 40 04             	lea    0x4(%eax),%eax
+  80066d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800670:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800675:	e9 a3 00 00 00       	jmp    80071d <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  80067a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067d:	8b 10                	mov    (%eax),%edx
+  80067f:	8b 48 04             	mov    0x4(%eax),%ecx
+  800682:	8d 40 08             	lea    0x8(%eax),%eax
+  800685:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800688:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80068d:	e9 8b 00 00 00       	jmp    80071d <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800692:	8b 45 14             	mov    0x14(%ebp),%eax
+  800695:	8b 10                	mov    (%eax),%edx
+  800697:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80069c:	8d 40 04             	lea    0x4(%eax),%eax
+  80069f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006a2:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8006a7:	eb 74                	jmp    80071d <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  8006a9:	83 f9 01             	cmp    $0x1,%ecx
+  8006ac:	7f 1b                	jg     8006c9 <vprintfmt+0x35e>
+	else if (lflag)
+  8006ae:	85 c9                	test   %ecx,%ecx
+  8006b0:	74 2c                	je     8006de <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  8006b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b5:	8b 10                	mov    (%eax),%edx
+  8006b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006bc:	8d 40 04             	lea    0x4(%eax),%eax
+  8006bf:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006c2:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8006c7:	eb 54                	jmp    80071d <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8006c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006cc:	8b 10                	mov    (%eax),%edx
+  8006ce:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006d1:	8d 40 08             	lea    0x8(%eax),%eax
+  8006d4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006d7:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8006dc:	eb 3f                	jmp    80071d <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8006de:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e1:	8b 10                	mov    (%eax),%edx
+  8006e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006e8:	8d 40 04             	lea    0x4(%eax),%eax
+  8006eb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006ee:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8006f3:	eb 28                	jmp    80071d <vprintfmt+0x3b2>
+			putch('0', putdat);
+  8006f5:	83 ec 08             	sub    $0x8,%esp
+  8006f8:	53                   	push   %ebx
+  8006f9:	6a 30                	push   $0x30
+  8006fb:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8006fd:	83 c4 08             	add    $0x8,%esp
+  800700:	53                   	push   %ebx
+  800701:	6a 78                	push   $0x78
+  800703:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800705:	8b 45 14             	mov    0x14(%ebp),%eax
+  800708:	8b 10                	mov    (%eax),%edx
+  80070a:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80070f:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800712:	8d 40 04             	lea    0x4(%eax),%eax
+  800715:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800718:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80071d:	83 ec 0c             	sub    $0xc,%esp
+  800720:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800724:	50                   	push   %eax
+  800725:	ff 75 e0             	push   -0x20(%ebp)
+  800728:	57                   	push   %edi
+  800729:	51                   	push   %ecx
+  80072a:	52                   	push   %edx
+  80072b:	89 da                	mov    %ebx,%edx
+  80072d:	89 f0                	mov    %esi,%eax
+  80072f:	e8 54 fb ff ff       	call   800288 <printnum>
+			break;
+  800734:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800737:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  80073a:	e9 4a fc ff ff       	jmp    800389 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  80073f:	83 f9 01             	cmp    $0x1,%ecx
+  800742:	7f 1b                	jg     80075f <vprintfmt+0x3f4>
+	else if (lflag)
+  800744:	85 c9                	test   %ecx,%ecx
+  800746:	74 2c                	je     800774 <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  800748:	8b 45 14             	mov    0x14(%ebp),%eax
+  80074b:	8b 10                	mov    (%eax),%edx
+  80074d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800752:	8d 40 04             	lea    0x4(%eax),%eax
+  800755:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800758:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80075d:	eb be                	jmp    80071d <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  80075f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800762:	8b 10                	mov    (%eax),%edx
+  800764:	8b 48 04             	mov    0x4(%eax),%ecx
+  800767:	8d 40 08             	lea    0x8(%eax),%eax
+  80076a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80076d:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800772:	eb a9                	jmp    80071d <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800774:	8b 45 14             	mov    0x14(%ebp),%eax
+  800777:	8b 10                	mov    (%eax),%edx
+  800779:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80077e:	8d 40 04             	lea    0x4(%eax),%eax
+  800781:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800784:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800789:	eb 92                	jmp    80071d <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  80078b:	83 ec 08             	sub    $0x8,%esp
+  80078e:	53                   	push   %ebx
+  80078f:	6a 25                	push   $0x25
+  800791:	ff d6                	call   *%esi
+			break;
+  800793:	83 c4 10             	add    $0x10,%esp
+  800796:	eb 9f                	jmp    800737 <vprintfmt+0x3cc>
+			putch('%', putdat);
+  800798:	83 ec 08             	sub    $0x8,%esp
+  80079b:	53                   	push   %ebx
+  80079c:	6a 25                	push   $0x25
+  80079e:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8007a0:	83 c4 10             	add    $0x10,%esp
+  8007a3:	89 f8                	mov    %edi,%eax
+  8007a5:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8007a9:	74 05                	je     8007b0 <vprintfmt+0x445>
+  8007ab:	83 e8 01             	sub    $0x1,%eax
+  8007ae:	eb f5                	jmp    8007a5 <vprintfmt+0x43a>
+  8007b0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8007b3:	eb 82                	jmp    800737 <vprintfmt+0x3cc>
+
+008007b5 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8007b5:	55                   	push   %ebp
+  8007b6:	89 e5                	mov    %esp,%ebp
+  8007b8:	83 ec 18             	sub    $0x18,%esp
+  8007bb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007be:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8007c1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8007c4:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8007c8:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8007cb:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8007d2:	85 c0                	test   %eax,%eax
+  8007d4:	74 26                	je     8007fc <vsnprintf+0x47>
+  8007d6:	85 d2                	test   %edx,%edx
+  8007d8:	7e 22                	jle    8007fc <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8007da:	ff 75 14             	push   0x14(%ebp)
+  8007dd:	ff 75 10             	push   0x10(%ebp)
+  8007e0:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007e3:	50                   	push   %eax
+  8007e4:	68 31 03 80 00       	push   $0x800331
+  8007e9:	e8 7d fb ff ff       	call   80036b <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8007ee:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007f1:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8007f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007f7:	83 c4 10             	add    $0x10,%esp
+}
+  8007fa:	c9                   	leave
+  8007fb:	c3                   	ret
+		return -E_INVAL;
+  8007fc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800801:	eb f7                	jmp    8007fa <vsnprintf+0x45>
+
+00800803 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800803:	55                   	push   %ebp
+  800804:	89 e5                	mov    %esp,%ebp
+  800806:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800809:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80080c:	50                   	push   %eax
+  80080d:	ff 75 10             	push   0x10(%ebp)
+  800810:	ff 75 0c             	push   0xc(%ebp)
+  800813:	ff 75 08             	push   0x8(%ebp)
+  800816:	e8 9a ff ff ff       	call   8007b5 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80081b:	c9                   	leave
+  80081c:	c3                   	ret
+
+0080081d <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80081d:	55                   	push   %ebp
+  80081e:	89 e5                	mov    %esp,%ebp
+  800820:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800823:	b8 00 00 00 00       	mov    $0x0,%eax
+  800828:	eb 03                	jmp    80082d <strlen+0x10>
+		n++;
+  80082a:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80082d:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800831:	75 f7                	jne    80082a <strlen+0xd>
+	return n;
+}
+  800833:	5d                   	pop    %ebp
+  800834:	c3                   	ret
+
+00800835 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800835:	55                   	push   %ebp
+  800836:	89 e5                	mov    %esp,%ebp
+  800838:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80083b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80083e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800843:	eb 03                	jmp    800848 <strnlen+0x13>
+		n++;
+  800845:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800848:	39 d0                	cmp    %edx,%eax
+  80084a:	74 08                	je     800854 <strnlen+0x1f>
+  80084c:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800850:	75 f3                	jne    800845 <strnlen+0x10>
+  800852:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800854:	89 d0                	mov    %edx,%eax
+  800856:	5d                   	pop    %ebp
+  800857:	c3                   	ret
+
+00800858 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800858:	55                   	push   %ebp
+  800859:	89 e5                	mov    %esp,%ebp
+  80085b:	53                   	push   %ebx
+  80085c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80085f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800862:	b8 00 00 00 00       	mov    $0x0,%eax
+  800867:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80086b:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80086e:	83 c0 01             	add    $0x1,%eax
+  800871:	84 d2                	test   %dl,%dl
+  800873:	75 f2                	jne    800867 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800875:	89 c8                	mov    %ecx,%eax
+  800877:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80087a:	c9                   	leave
+  80087b:	c3                   	ret
+
+0080087c <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80087c:	55                   	push   %ebp
+  80087d:	89 e5                	mov    %esp,%ebp
+  80087f:	53                   	push   %ebx
+  800880:	83 ec 10             	sub    $0x10,%esp
+  800883:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800886:	53                   	push   %ebx
+  800887:	e8 91 ff ff ff       	call   80081d <strlen>
+  80088c:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80088f:	ff 75 0c             	push   0xc(%ebp)
+  800892:	01 d8                	add    %ebx,%eax
+  800894:	50                   	push   %eax
+  800895:	e8 be ff ff ff       	call   800858 <strcpy>
+	return dst;
+}
+  80089a:	89 d8                	mov    %ebx,%eax
+  80089c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80089f:	c9                   	leave
+  8008a0:	c3                   	ret
+
+008008a1 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8008a1:	55                   	push   %ebp
+  8008a2:	89 e5                	mov    %esp,%ebp
+  8008a4:	56                   	push   %esi
+  8008a5:	53                   	push   %ebx
+  8008a6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008a9:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8008ac:	89 f3                	mov    %esi,%ebx
+  8008ae:	03 5d 10             	add    0x10(%ebp),%ebx
+  8008b1:	89 f0                	mov    %esi,%eax
+  8008b3:	eb 0f                	jmp    8008c4 <strncpy+0x23>
+		*dst++ = *src;
+  8008b5:	83 c0 01             	add    $0x1,%eax
+  8008b8:	0f b6 0a             	movzbl (%edx),%ecx
+  8008bb:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8008be:	80 f9 01             	cmp    $0x1,%cl
+  8008c1:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8008c4:	39 d8                	cmp    %ebx,%eax
+  8008c6:	75 ed                	jne    8008b5 <strncpy+0x14>
+	}
+	return ret;
+}
+  8008c8:	89 f0                	mov    %esi,%eax
+  8008ca:	5b                   	pop    %ebx
+  8008cb:	5e                   	pop    %esi
+  8008cc:	5d                   	pop    %ebp
+  8008cd:	c3                   	ret
+
+008008ce <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8008ce:	55                   	push   %ebp
+  8008cf:	89 e5                	mov    %esp,%ebp
+  8008d1:	56                   	push   %esi
+  8008d2:	53                   	push   %ebx
+  8008d3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008d6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008d9:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8008dc:	89 f0                	mov    %esi,%eax
+  8008de:	85 d2                	test   %edx,%edx
+  8008e0:	74 21                	je     800903 <strlcpy+0x35>
+  8008e2:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8008e6:	89 f2                	mov    %esi,%edx
+  8008e8:	eb 09                	jmp    8008f3 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8008ea:	83 c1 01             	add    $0x1,%ecx
+  8008ed:	83 c2 01             	add    $0x1,%edx
+  8008f0:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8008f3:	39 c2                	cmp    %eax,%edx
+  8008f5:	74 09                	je     800900 <strlcpy+0x32>
+  8008f7:	0f b6 19             	movzbl (%ecx),%ebx
+  8008fa:	84 db                	test   %bl,%bl
+  8008fc:	75 ec                	jne    8008ea <strlcpy+0x1c>
+  8008fe:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800900:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800903:	29 f0                	sub    %esi,%eax
+}
+  800905:	5b                   	pop    %ebx
+  800906:	5e                   	pop    %esi
+  800907:	5d                   	pop    %ebp
+  800908:	c3                   	ret
+
+00800909 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800909:	55                   	push   %ebp
+  80090a:	89 e5                	mov    %esp,%ebp
+  80090c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80090f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800912:	eb 06                	jmp    80091a <strcmp+0x11>
+		p++, q++;
+  800914:	83 c1 01             	add    $0x1,%ecx
+  800917:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80091a:	0f b6 01             	movzbl (%ecx),%eax
+  80091d:	84 c0                	test   %al,%al
+  80091f:	74 04                	je     800925 <strcmp+0x1c>
+  800921:	3a 02                	cmp    (%edx),%al
+  800923:	74 ef                	je     800914 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800925:	0f b6 c0             	movzbl %al,%eax
+  800928:	0f b6 12             	movzbl (%edx),%edx
+  80092b:	29 d0                	sub    %edx,%eax
+}
+  80092d:	5d                   	pop    %ebp
+  80092e:	c3                   	ret
+
+0080092f <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80092f:	55                   	push   %ebp
+  800930:	89 e5                	mov    %esp,%ebp
+  800932:	53                   	push   %ebx
+  800933:	8b 45 08             	mov    0x8(%ebp),%eax
+  800936:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800939:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80093c:	eb 09                	jmp    800947 <strncmp+0x18>
+		n--, p++, q++;
+  80093e:	83 ea 01             	sub    $0x1,%edx
+  800941:	83 c0 01             	add    $0x1,%eax
+  800944:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800947:	85 d2                	test   %edx,%edx
+  800949:	74 18                	je     800963 <strncmp+0x34>
+  80094b:	0f b6 18             	movzbl (%eax),%ebx
+  80094e:	84 db                	test   %bl,%bl
+  800950:	74 04                	je     800956 <strncmp+0x27>
+  800952:	3a 19                	cmp    (%ecx),%bl
+  800954:	74 e8                	je     80093e <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800956:	0f b6 00             	movzbl (%eax),%eax
+  800959:	0f b6 11             	movzbl (%ecx),%edx
+  80095c:	29 d0                	sub    %edx,%eax
+}
+  80095e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800961:	c9                   	leave
+  800962:	c3                   	ret
+		return 0;
+  800963:	b8 00 00 00 00       	mov    $0x0,%eax
+  800968:	eb f4                	jmp    80095e <strncmp+0x2f>
+
+0080096a <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80096a:	55                   	push   %ebp
+  80096b:	89 e5                	mov    %esp,%ebp
+  80096d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800970:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800974:	eb 03                	jmp    800979 <strchr+0xf>
+  800976:	83 c0 01             	add    $0x1,%eax
+  800979:	0f b6 10             	movzbl (%eax),%edx
+  80097c:	84 d2                	test   %dl,%dl
+  80097e:	74 06                	je     800986 <strchr+0x1c>
+		if (*s == c)
+  800980:	38 ca                	cmp    %cl,%dl
+  800982:	75 f2                	jne    800976 <strchr+0xc>
+  800984:	eb 05                	jmp    80098b <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800986:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80098b:	5d                   	pop    %ebp
+  80098c:	c3                   	ret
+
+0080098d <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80098d:	55                   	push   %ebp
+  80098e:	89 e5                	mov    %esp,%ebp
+  800990:	8b 45 08             	mov    0x8(%ebp),%eax
+  800993:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800997:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  80099a:	38 ca                	cmp    %cl,%dl
+  80099c:	74 09                	je     8009a7 <strfind+0x1a>
+  80099e:	84 d2                	test   %dl,%dl
+  8009a0:	74 05                	je     8009a7 <strfind+0x1a>
+	for (; *s; s++)
+  8009a2:	83 c0 01             	add    $0x1,%eax
+  8009a5:	eb f0                	jmp    800997 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8009a7:	5d                   	pop    %ebp
+  8009a8:	c3                   	ret
+
+008009a9 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8009a9:	55                   	push   %ebp
+  8009aa:	89 e5                	mov    %esp,%ebp
+  8009ac:	57                   	push   %edi
+  8009ad:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8009b0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8009b3:	85 c9                	test   %ecx,%ecx
+  8009b5:	74 20                	je     8009d7 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8009b7:	89 f8                	mov    %edi,%eax
+  8009b9:	09 c8                	or     %ecx,%eax
+  8009bb:	a8 03                	test   $0x3,%al
+  8009bd:	75 12                	jne    8009d1 <memset+0x28>
+		c &= 0xFF;
+  8009bf:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8009c3:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8009c9:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8009cc:	fc                   	cld
+  8009cd:	f3 ab                	rep stos %eax,%es:(%edi)
+  8009cf:	eb 06                	jmp    8009d7 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8009d1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8009d4:	fc                   	cld
+  8009d5:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8009d7:	89 f8                	mov    %edi,%eax
+  8009d9:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8009dc:	c9                   	leave
+  8009dd:	c3                   	ret
+
+008009de <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8009de:	55                   	push   %ebp
+  8009df:	89 e5                	mov    %esp,%ebp
+  8009e1:	57                   	push   %edi
+  8009e2:	56                   	push   %esi
+  8009e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009e6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8009e9:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8009ec:	39 c6                	cmp    %eax,%esi
+  8009ee:	73 32                	jae    800a22 <memmove+0x44>
+  8009f0:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8009f3:	39 d0                	cmp    %edx,%eax
+  8009f5:	73 2b                	jae    800a22 <memmove+0x44>
+		s += n;
+		d += n;
+  8009f7:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009fa:	89 d6                	mov    %edx,%esi
+  8009fc:	09 fe                	or     %edi,%esi
+  8009fe:	09 ce                	or     %ecx,%esi
+  800a00:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a06:	75 0e                	jne    800a16 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a08:	83 ef 04             	sub    $0x4,%edi
+  800a0b:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a0e:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a11:	fd                   	std
+  800a12:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a14:	eb 09                	jmp    800a1f <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a16:	83 ef 01             	sub    $0x1,%edi
+  800a19:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a1c:	fd                   	std
+  800a1d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a1f:	fc                   	cld
+  800a20:	eb 1a                	jmp    800a3c <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a22:	89 f2                	mov    %esi,%edx
+  800a24:	09 c2                	or     %eax,%edx
+  800a26:	09 ca                	or     %ecx,%edx
+  800a28:	f6 c2 03             	test   $0x3,%dl
+  800a2b:	75 0a                	jne    800a37 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a2d:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a30:	89 c7                	mov    %eax,%edi
+  800a32:	fc                   	cld
+  800a33:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a35:	eb 05                	jmp    800a3c <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a37:	89 c7                	mov    %eax,%edi
+  800a39:	fc                   	cld
+  800a3a:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a3c:	5e                   	pop    %esi
+  800a3d:	5f                   	pop    %edi
+  800a3e:	5d                   	pop    %ebp
+  800a3f:	c3                   	ret
+
+00800a40 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a40:	55                   	push   %ebp
+  800a41:	89 e5                	mov    %esp,%ebp
+  800a43:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a46:	ff 75 10             	push   0x10(%ebp)
+  800a49:	ff 75 0c             	push   0xc(%ebp)
+  800a4c:	ff 75 08             	push   0x8(%ebp)
+  800a4f:	e8 8a ff ff ff       	call   8009de <memmove>
+}
+  800a54:	c9                   	leave
+  800a55:	c3                   	ret
+
+00800a56 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a56:	55                   	push   %ebp
+  800a57:	89 e5                	mov    %esp,%ebp
+  800a59:	56                   	push   %esi
+  800a5a:	53                   	push   %ebx
+  800a5b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a5e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a61:	89 c6                	mov    %eax,%esi
+  800a63:	03 75 10             	add    0x10(%ebp),%esi
+  800a66:	eb 06                	jmp    800a6e <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a68:	83 c0 01             	add    $0x1,%eax
+  800a6b:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a6e:	39 f0                	cmp    %esi,%eax
+  800a70:	74 14                	je     800a86 <memcmp+0x30>
+		if (*s1 != *s2)
+  800a72:	0f b6 08             	movzbl (%eax),%ecx
+  800a75:	0f b6 1a             	movzbl (%edx),%ebx
+  800a78:	38 d9                	cmp    %bl,%cl
+  800a7a:	74 ec                	je     800a68 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a7c:	0f b6 c1             	movzbl %cl,%eax
+  800a7f:	0f b6 db             	movzbl %bl,%ebx
+  800a82:	29 d8                	sub    %ebx,%eax
+  800a84:	eb 05                	jmp    800a8b <memcmp+0x35>
+	}
+
+	return 0;
+  800a86:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a8b:	5b                   	pop    %ebx
+  800a8c:	5e                   	pop    %esi
+  800a8d:	5d                   	pop    %ebp
+  800a8e:	c3                   	ret
+
+00800a8f <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a8f:	55                   	push   %ebp
+  800a90:	89 e5                	mov    %esp,%ebp
+  800a92:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a95:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a98:	89 c2                	mov    %eax,%edx
+  800a9a:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a9d:	eb 03                	jmp    800aa2 <memfind+0x13>
+  800a9f:	83 c0 01             	add    $0x1,%eax
+  800aa2:	39 d0                	cmp    %edx,%eax
+  800aa4:	73 04                	jae    800aaa <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800aa6:	38 08                	cmp    %cl,(%eax)
+  800aa8:	75 f5                	jne    800a9f <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800aaa:	5d                   	pop    %ebp
+  800aab:	c3                   	ret
+
+00800aac <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800aac:	55                   	push   %ebp
+  800aad:	89 e5                	mov    %esp,%ebp
+  800aaf:	57                   	push   %edi
+  800ab0:	56                   	push   %esi
+  800ab1:	53                   	push   %ebx
+  800ab2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ab5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800ab8:	eb 03                	jmp    800abd <strtol+0x11>
+		s++;
+  800aba:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800abd:	0f b6 02             	movzbl (%edx),%eax
+  800ac0:	3c 20                	cmp    $0x20,%al
+  800ac2:	74 f6                	je     800aba <strtol+0xe>
+  800ac4:	3c 09                	cmp    $0x9,%al
+  800ac6:	74 f2                	je     800aba <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800ac8:	3c 2b                	cmp    $0x2b,%al
+  800aca:	74 2a                	je     800af6 <strtol+0x4a>
+	int neg = 0;
+  800acc:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800ad1:	3c 2d                	cmp    $0x2d,%al
+  800ad3:	74 2b                	je     800b00 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ad5:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800adb:	75 0f                	jne    800aec <strtol+0x40>
+  800add:	80 3a 30             	cmpb   $0x30,(%edx)
+  800ae0:	74 28                	je     800b0a <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800ae2:	85 db                	test   %ebx,%ebx
+  800ae4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ae9:	0f 44 d8             	cmove  %eax,%ebx
+  800aec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800af1:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800af4:	eb 46                	jmp    800b3c <strtol+0x90>
+		s++;
+  800af6:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800af9:	bf 00 00 00 00       	mov    $0x0,%edi
+  800afe:	eb d5                	jmp    800ad5 <strtol+0x29>
+		s++, neg = 1;
+  800b00:	83 c2 01             	add    $0x1,%edx
+  800b03:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b08:	eb cb                	jmp    800ad5 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b0a:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b0e:	74 0e                	je     800b1e <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800b10:	85 db                	test   %ebx,%ebx
+  800b12:	75 d8                	jne    800aec <strtol+0x40>
+		s++, base = 8;
+  800b14:	83 c2 01             	add    $0x1,%edx
+  800b17:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b1c:	eb ce                	jmp    800aec <strtol+0x40>
+		s += 2, base = 16;
+  800b1e:	83 c2 02             	add    $0x2,%edx
+  800b21:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b26:	eb c4                	jmp    800aec <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800b28:	0f be c0             	movsbl %al,%eax
+  800b2b:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800b2e:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b31:	7d 3a                	jge    800b6d <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800b33:	83 c2 01             	add    $0x1,%edx
+  800b36:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b3a:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800b3c:	0f b6 02             	movzbl (%edx),%eax
+  800b3f:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b42:	89 f3                	mov    %esi,%ebx
+  800b44:	80 fb 09             	cmp    $0x9,%bl
+  800b47:	76 df                	jbe    800b28 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800b49:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b4c:	89 f3                	mov    %esi,%ebx
+  800b4e:	80 fb 19             	cmp    $0x19,%bl
+  800b51:	77 08                	ja     800b5b <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800b53:	0f be c0             	movsbl %al,%eax
+  800b56:	83 e8 57             	sub    $0x57,%eax
+  800b59:	eb d3                	jmp    800b2e <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b5b:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b5e:	89 f3                	mov    %esi,%ebx
+  800b60:	80 fb 19             	cmp    $0x19,%bl
+  800b63:	77 08                	ja     800b6d <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800b65:	0f be c0             	movsbl %al,%eax
+  800b68:	83 e8 37             	sub    $0x37,%eax
+  800b6b:	eb c1                	jmp    800b2e <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b6d:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b71:	74 05                	je     800b78 <strtol+0xcc>
+		*endptr = (char *) s;
+  800b73:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b76:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b78:	89 c8                	mov    %ecx,%eax
+  800b7a:	f7 d8                	neg    %eax
+  800b7c:	85 ff                	test   %edi,%edi
+  800b7e:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b81:	89 c8                	mov    %ecx,%eax
+  800b83:	5b                   	pop    %ebx
+  800b84:	5e                   	pop    %esi
+  800b85:	5f                   	pop    %edi
+  800b86:	5d                   	pop    %ebp
+  800b87:	c3                   	ret
+
+00800b88 <atoi>:
+
+int
+atoi(const char* s)
+{
+  800b88:	55                   	push   %ebp
+  800b89:	89 e5                	mov    %esp,%ebp
+  800b8b:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  800b8e:	6a 00                	push   $0x0
+  800b90:	6a 00                	push   $0x0
+  800b92:	ff 75 08             	push   0x8(%ebp)
+  800b95:	e8 12 ff ff ff       	call   800aac <strtol>
+}
+  800b9a:	c9                   	leave
+  800b9b:	c3                   	ret
+
+00800b9c <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800b9c:	55                   	push   %ebp
+  800b9d:	89 e5                	mov    %esp,%ebp
+  800b9f:	57                   	push   %edi
+  800ba0:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ba1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ba6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ba9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bac:	89 c3                	mov    %eax,%ebx
+  800bae:	89 c7                	mov    %eax,%edi
+  800bb0:	6a 00                	push   $0x0
+  800bb2:	55                   	push   %ebp
+  800bb3:	56                   	push   %esi
+  800bb4:	89 e5                	mov    %esp,%ebp
+  800bb6:	8d 35 be 0b 80 00    	lea    0x800bbe,%esi
+  800bbc:	0f 34                	sysenter
+
+00800bbe <after_sysenter_label_47>:
+  800bbe:	5e                   	pop    %esi
+  800bbf:	5d                   	pop    %ebp
+  800bc0:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800bc3:	5b                   	pop    %ebx
+  800bc4:	5f                   	pop    %edi
+  800bc5:	5d                   	pop    %ebp
+  800bc6:	c3                   	ret
+
+00800bc7 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800bc7:	55                   	push   %ebp
+  800bc8:	89 e5                	mov    %esp,%ebp
+  800bca:	57                   	push   %edi
+  800bcb:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800bcc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bd1:	b8 01 00 00 00       	mov    $0x1,%eax
+  800bd6:	89 d1                	mov    %edx,%ecx
+  800bd8:	89 d3                	mov    %edx,%ebx
+  800bda:	89 d7                	mov    %edx,%edi
+  800bdc:	6a 00                	push   $0x0
+  800bde:	55                   	push   %ebp
+  800bdf:	56                   	push   %esi
+  800be0:	89 e5                	mov    %esp,%ebp
+  800be2:	8d 35 ea 0b 80 00    	lea    0x800bea,%esi
+  800be8:	0f 34                	sysenter
+
+00800bea <after_sysenter_label_128>:
+  800bea:	5e                   	pop    %esi
+  800beb:	5d                   	pop    %ebp
+  800bec:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800bef:	5b                   	pop    %ebx
+  800bf0:	5f                   	pop    %edi
+  800bf1:	5d                   	pop    %ebp
+  800bf2:	c3                   	ret
+
+00800bf3 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800bf3:	55                   	push   %ebp
+  800bf4:	89 e5                	mov    %esp,%ebp
+  800bf6:	57                   	push   %edi
+  800bf7:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800bf8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bfb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c00:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c05:	89 cb                	mov    %ecx,%ebx
+  800c07:	89 cf                	mov    %ecx,%edi
+  800c09:	6a 00                	push   $0x0
+  800c0b:	55                   	push   %ebp
+  800c0c:	56                   	push   %esi
+  800c0d:	89 e5                	mov    %esp,%ebp
+  800c0f:	8d 35 17 0c 80 00    	lea    0x800c17,%esi
+  800c15:	0f 34                	sysenter
+
+00800c17 <after_sysenter_label_212>:
+  800c17:	5e                   	pop    %esi
+  800c18:	5d                   	pop    %ebp
+  800c19:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800c1c:	85 c0                	test   %eax,%eax
+  800c1e:	7f 07                	jg     800c27 <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c20:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c23:	5b                   	pop    %ebx
+  800c24:	5f                   	pop    %edi
+  800c25:	5d                   	pop    %ebp
+  800c26:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c27:	83 ec 0c             	sub    $0xc,%esp
+  800c2a:	50                   	push   %eax
+  800c2b:	6a 03                	push   $0x3
+  800c2d:	68 75 4b 80 00       	push   $0x804b75
+  800c32:	6a 54                	push   $0x54
+  800c34:	68 92 4b 80 00       	push   $0x804b92
+  800c39:	e8 5b f5 ff ff       	call   800199 <_panic>
+
+00800c3e <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800c3e:	55                   	push   %ebp
+  800c3f:	89 e5                	mov    %esp,%ebp
+  800c41:	57                   	push   %edi
+  800c42:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c43:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c48:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c4d:	89 d1                	mov    %edx,%ecx
+  800c4f:	89 d3                	mov    %edx,%ebx
+  800c51:	89 d7                	mov    %edx,%edi
+  800c53:	6a 00                	push   $0x0
+  800c55:	55                   	push   %ebp
+  800c56:	56                   	push   %esi
+  800c57:	89 e5                	mov    %esp,%ebp
+  800c59:	8d 35 61 0c 80 00    	lea    0x800c61,%esi
+  800c5f:	0f 34                	sysenter
+
+00800c61 <after_sysenter_label_309>:
+  800c61:	5e                   	pop    %esi
+  800c62:	5d                   	pop    %ebp
+  800c63:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800c66:	5b                   	pop    %ebx
+  800c67:	5f                   	pop    %edi
+  800c68:	5d                   	pop    %ebp
+  800c69:	c3                   	ret
+
+00800c6a <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800c6a:	55                   	push   %ebp
+  800c6b:	89 e5                	mov    %esp,%ebp
+  800c6d:	57                   	push   %edi
+  800c6e:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c6f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c74:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800c79:	89 d1                	mov    %edx,%ecx
+  800c7b:	89 d3                	mov    %edx,%ebx
+  800c7d:	89 d7                	mov    %edx,%edi
+  800c7f:	6a 00                	push   $0x0
+  800c81:	55                   	push   %ebp
+  800c82:	56                   	push   %esi
+  800c83:	89 e5                	mov    %esp,%ebp
+  800c85:	8d 35 8d 0c 80 00    	lea    0x800c8d,%esi
+  800c8b:	0f 34                	sysenter
+
+00800c8d <after_sysenter_label_391>:
+  800c8d:	5e                   	pop    %esi
+  800c8e:	5d                   	pop    %ebp
+  800c8f:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800c92:	5b                   	pop    %ebx
+  800c93:	5f                   	pop    %edi
+  800c94:	5d                   	pop    %ebp
+  800c95:	c3                   	ret
+
+00800c96 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c96:	55                   	push   %ebp
+  800c97:	89 e5                	mov    %esp,%ebp
+  800c99:	57                   	push   %edi
+  800c9a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c9b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c9e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ca1:	b8 04 00 00 00       	mov    $0x4,%eax
+  800ca6:	bf 00 00 00 00       	mov    $0x0,%edi
+  800cab:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cae:	6a 00                	push   $0x0
+  800cb0:	55                   	push   %ebp
+  800cb1:	56                   	push   %esi
+  800cb2:	89 e5                	mov    %esp,%ebp
+  800cb4:	8d 35 bc 0c 80 00    	lea    0x800cbc,%esi
+  800cba:	0f 34                	sysenter
+
+00800cbc <after_sysenter_label_479>:
+  800cbc:	5e                   	pop    %esi
+  800cbd:	5d                   	pop    %ebp
+  800cbe:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800cc1:	85 c0                	test   %eax,%eax
+  800cc3:	7f 07                	jg     800ccc <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800cc5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800cc8:	5b                   	pop    %ebx
+  800cc9:	5f                   	pop    %edi
+  800cca:	5d                   	pop    %ebp
+  800ccb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ccc:	83 ec 0c             	sub    $0xc,%esp
+  800ccf:	50                   	push   %eax
+  800cd0:	6a 04                	push   $0x4
+  800cd2:	68 75 4b 80 00       	push   $0x804b75
+  800cd7:	6a 54                	push   $0x54
+  800cd9:	68 92 4b 80 00       	push   $0x804b92
+  800cde:	e8 b6 f4 ff ff       	call   800199 <_panic>
+
+00800ce3 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800ce3:	55                   	push   %ebp
+  800ce4:	89 e5                	mov    %esp,%ebp
+  800ce6:	57                   	push   %edi
+  800ce7:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ce8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ceb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cee:	b8 05 00 00 00       	mov    $0x5,%eax
+  800cf3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cf6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800cf9:	ff 75 18             	push   0x18(%ebp)
+  800cfc:	55                   	push   %ebp
+  800cfd:	56                   	push   %esi
+  800cfe:	89 e5                	mov    %esp,%ebp
+  800d00:	8d 35 08 0d 80 00    	lea    0x800d08,%esi
+  800d06:	0f 34                	sysenter
+
+00800d08 <after_sysenter_label_593>:
+  800d08:	5e                   	pop    %esi
+  800d09:	5d                   	pop    %ebp
+  800d0a:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d0d:	85 c0                	test   %eax,%eax
+  800d0f:	7f 07                	jg     800d18 <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800d11:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d14:	5b                   	pop    %ebx
+  800d15:	5f                   	pop    %edi
+  800d16:	5d                   	pop    %ebp
+  800d17:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d18:	83 ec 0c             	sub    $0xc,%esp
+  800d1b:	50                   	push   %eax
+  800d1c:	6a 05                	push   $0x5
+  800d1e:	68 75 4b 80 00       	push   $0x804b75
+  800d23:	6a 54                	push   $0x54
+  800d25:	68 92 4b 80 00       	push   $0x804b92
+  800d2a:	e8 6a f4 ff ff       	call   800199 <_panic>
+
+00800d2f <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800d2f:	55                   	push   %ebp
+  800d30:	89 e5                	mov    %esp,%ebp
+  800d32:	57                   	push   %edi
+  800d33:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d34:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d39:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d3c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d3f:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d44:	89 df                	mov    %ebx,%edi
+  800d46:	6a 00                	push   $0x0
+  800d48:	55                   	push   %ebp
+  800d49:	56                   	push   %esi
+  800d4a:	89 e5                	mov    %esp,%ebp
+  800d4c:	8d 35 54 0d 80 00    	lea    0x800d54,%esi
+  800d52:	0f 34                	sysenter
+
+00800d54 <after_sysenter_label_704>:
+  800d54:	5e                   	pop    %esi
+  800d55:	5d                   	pop    %ebp
+  800d56:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d59:	85 c0                	test   %eax,%eax
+  800d5b:	7f 07                	jg     800d64 <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d5d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d60:	5b                   	pop    %ebx
+  800d61:	5f                   	pop    %edi
+  800d62:	5d                   	pop    %ebp
+  800d63:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d64:	83 ec 0c             	sub    $0xc,%esp
+  800d67:	50                   	push   %eax
+  800d68:	6a 06                	push   $0x6
+  800d6a:	68 75 4b 80 00       	push   $0x804b75
+  800d6f:	6a 54                	push   $0x54
+  800d71:	68 92 4b 80 00       	push   $0x804b92
+  800d76:	e8 1e f4 ff ff       	call   800199 <_panic>
+
+00800d7b <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800d7b:	55                   	push   %ebp
+  800d7c:	89 e5                	mov    %esp,%ebp
+  800d7e:	57                   	push   %edi
+  800d7f:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d80:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d85:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d88:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d8b:	b8 08 00 00 00       	mov    $0x8,%eax
+  800d90:	89 df                	mov    %ebx,%edi
+  800d92:	6a 00                	push   $0x0
+  800d94:	55                   	push   %ebp
+  800d95:	56                   	push   %esi
+  800d96:	89 e5                	mov    %esp,%ebp
+  800d98:	8d 35 a0 0d 80 00    	lea    0x800da0,%esi
+  800d9e:	0f 34                	sysenter
+
+00800da0 <after_sysenter_label_808>:
+  800da0:	5e                   	pop    %esi
+  800da1:	5d                   	pop    %ebp
+  800da2:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800da5:	85 c0                	test   %eax,%eax
+  800da7:	7f 07                	jg     800db0 <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800da9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800dac:	5b                   	pop    %ebx
+  800dad:	5f                   	pop    %edi
+  800dae:	5d                   	pop    %ebp
+  800daf:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800db0:	83 ec 0c             	sub    $0xc,%esp
+  800db3:	50                   	push   %eax
+  800db4:	6a 08                	push   $0x8
+  800db6:	68 75 4b 80 00       	push   $0x804b75
+  800dbb:	6a 54                	push   $0x54
+  800dbd:	68 92 4b 80 00       	push   $0x804b92
+  800dc2:	e8 d2 f3 ff ff       	call   800199 <_panic>
+
+00800dc7 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800dc7:	55                   	push   %ebp
+  800dc8:	89 e5                	mov    %esp,%ebp
+  800dca:	57                   	push   %edi
+  800dcb:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800dcc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dd1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dd7:	b8 09 00 00 00       	mov    $0x9,%eax
+  800ddc:	89 df                	mov    %ebx,%edi
+  800dde:	6a 00                	push   $0x0
+  800de0:	55                   	push   %ebp
+  800de1:	56                   	push   %esi
+  800de2:	89 e5                	mov    %esp,%ebp
+  800de4:	8d 35 ec 0d 80 00    	lea    0x800dec,%esi
+  800dea:	0f 34                	sysenter
+
+00800dec <after_sysenter_label_912>:
+  800dec:	5e                   	pop    %esi
+  800ded:	5d                   	pop    %ebp
+  800dee:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800df1:	85 c0                	test   %eax,%eax
+  800df3:	7f 07                	jg     800dfc <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800df5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800df8:	5b                   	pop    %ebx
+  800df9:	5f                   	pop    %edi
+  800dfa:	5d                   	pop    %ebp
+  800dfb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dfc:	83 ec 0c             	sub    $0xc,%esp
+  800dff:	50                   	push   %eax
+  800e00:	6a 09                	push   $0x9
+  800e02:	68 75 4b 80 00       	push   $0x804b75
+  800e07:	6a 54                	push   $0x54
+  800e09:	68 92 4b 80 00       	push   $0x804b92
+  800e0e:	e8 86 f3 ff ff       	call   800199 <_panic>
+
+00800e13 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800e13:	55                   	push   %ebp
+  800e14:	89 e5                	mov    %esp,%ebp
+  800e16:	57                   	push   %edi
+  800e17:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e18:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e1d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e20:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e23:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e28:	89 df                	mov    %ebx,%edi
+  800e2a:	6a 00                	push   $0x0
+  800e2c:	55                   	push   %ebp
+  800e2d:	56                   	push   %esi
+  800e2e:	89 e5                	mov    %esp,%ebp
+  800e30:	8d 35 38 0e 80 00    	lea    0x800e38,%esi
+  800e36:	0f 34                	sysenter
+
+00800e38 <after_sysenter_label_1016>:
+  800e38:	5e                   	pop    %esi
+  800e39:	5d                   	pop    %ebp
+  800e3a:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e3d:	85 c0                	test   %eax,%eax
+  800e3f:	7f 07                	jg     800e48 <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800e41:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e44:	5b                   	pop    %ebx
+  800e45:	5f                   	pop    %edi
+  800e46:	5d                   	pop    %ebp
+  800e47:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e48:	83 ec 0c             	sub    $0xc,%esp
+  800e4b:	50                   	push   %eax
+  800e4c:	6a 0a                	push   $0xa
+  800e4e:	68 75 4b 80 00       	push   $0x804b75
+  800e53:	6a 54                	push   $0x54
+  800e55:	68 92 4b 80 00       	push   $0x804b92
+  800e5a:	e8 3a f3 ff ff       	call   800199 <_panic>
+
+00800e5f <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800e5f:	55                   	push   %ebp
+  800e60:	89 e5                	mov    %esp,%ebp
+  800e62:	57                   	push   %edi
+  800e63:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e64:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e67:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e6a:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800e6f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e72:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e75:	6a 00                	push   $0x0
+  800e77:	55                   	push   %ebp
+  800e78:	56                   	push   %esi
+  800e79:	89 e5                	mov    %esp,%ebp
+  800e7b:	8d 35 83 0e 80 00    	lea    0x800e83,%esi
+  800e81:	0f 34                	sysenter
+
+00800e83 <after_sysenter_label_1126>:
+  800e83:	5e                   	pop    %esi
+  800e84:	5d                   	pop    %ebp
+  800e85:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800e88:	5b                   	pop    %ebx
+  800e89:	5f                   	pop    %edi
+  800e8a:	5d                   	pop    %ebp
+  800e8b:	c3                   	ret
+
+00800e8c <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800e8c:	55                   	push   %ebp
+  800e8d:	89 e5                	mov    %esp,%ebp
+  800e8f:	57                   	push   %edi
+  800e90:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e91:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e94:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e99:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e9e:	89 cb                	mov    %ecx,%ebx
+  800ea0:	89 cf                	mov    %ecx,%edi
+  800ea2:	6a 00                	push   $0x0
+  800ea4:	55                   	push   %ebp
+  800ea5:	56                   	push   %esi
+  800ea6:	89 e5                	mov    %esp,%ebp
+  800ea8:	8d 35 b0 0e 80 00    	lea    0x800eb0,%esi
+  800eae:	0f 34                	sysenter
+
+00800eb0 <after_sysenter_label_1210>:
+  800eb0:	5e                   	pop    %esi
+  800eb1:	5d                   	pop    %ebp
+  800eb2:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800eb5:	85 c0                	test   %eax,%eax
+  800eb7:	7f 07                	jg     800ec0 <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800eb9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ebc:	5b                   	pop    %ebx
+  800ebd:	5f                   	pop    %edi
+  800ebe:	5d                   	pop    %ebp
+  800ebf:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ec0:	83 ec 0c             	sub    $0xc,%esp
+  800ec3:	50                   	push   %eax
+  800ec4:	6a 0d                	push   $0xd
+  800ec6:	68 75 4b 80 00       	push   $0x804b75
+  800ecb:	6a 54                	push   $0x54
+  800ecd:	68 92 4b 80 00       	push   $0x804b92
+  800ed2:	e8 c2 f2 ff ff       	call   800199 <_panic>
+
+00800ed7 <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  800ed7:	55                   	push   %ebp
+  800ed8:	89 e5                	mov    %esp,%ebp
+  800eda:	57                   	push   %edi
+  800edb:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800edc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ee1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee7:	b8 42 00 00 00       	mov    $0x42,%eax
+  800eec:	89 df                	mov    %ebx,%edi
+  800eee:	6a 00                	push   $0x0
+  800ef0:	55                   	push   %ebp
+  800ef1:	56                   	push   %esi
+  800ef2:	89 e5                	mov    %esp,%ebp
+  800ef4:	8d 35 fc 0e 80 00    	lea    0x800efc,%esi
+  800efa:	0f 34                	sysenter
+
+00800efc <after_sysenter_label_1311>:
+  800efc:	5e                   	pop    %esi
+  800efd:	5d                   	pop    %ebp
+  800efe:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800f01:	85 c0                	test   %eax,%eax
+  800f03:	7f 07                	jg     800f0c <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  800f05:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f08:	5b                   	pop    %ebx
+  800f09:	5f                   	pop    %edi
+  800f0a:	5d                   	pop    %ebp
+  800f0b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f0c:	83 ec 0c             	sub    $0xc,%esp
+  800f0f:	50                   	push   %eax
+  800f10:	6a 42                	push   $0x42
+  800f12:	68 75 4b 80 00       	push   $0x804b75
+  800f17:	6a 54                	push   $0x54
+  800f19:	68 92 4b 80 00       	push   $0x804b92
+  800f1e:	e8 76 f2 ff ff       	call   800199 <_panic>
+
+00800f23 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800f23:	55                   	push   %ebp
+  800f24:	89 e5                	mov    %esp,%ebp
+  800f26:	57                   	push   %edi
+  800f27:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f28:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f2d:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800f32:	89 d1                	mov    %edx,%ecx
+  800f34:	89 d3                	mov    %edx,%ebx
+  800f36:	89 d7                	mov    %edx,%edi
+  800f38:	6a 00                	push   $0x0
+  800f3a:	55                   	push   %ebp
+  800f3b:	56                   	push   %esi
+  800f3c:	89 e5                	mov    %esp,%ebp
+  800f3e:	8d 35 46 0f 80 00    	lea    0x800f46,%esi
+  800f44:	0f 34                	sysenter
+
+00800f46 <after_sysenter_label_1411>:
+  800f46:	5e                   	pop    %esi
+  800f47:	5d                   	pop    %ebp
+  800f48:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800f4b:	5b                   	pop    %ebx
+  800f4c:	5f                   	pop    %edi
+  800f4d:	5d                   	pop    %ebp
+  800f4e:	c3                   	ret
+
+00800f4f <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  800f4f:	55                   	push   %ebp
+  800f50:	89 e5                	mov    %esp,%ebp
+  800f52:	57                   	push   %edi
+  800f53:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f54:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f59:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f5c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f5f:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f64:	89 df                	mov    %ebx,%edi
+  800f66:	6a 00                	push   $0x0
+  800f68:	55                   	push   %ebp
+  800f69:	56                   	push   %esi
+  800f6a:	89 e5                	mov    %esp,%ebp
+  800f6c:	8d 35 74 0f 80 00    	lea    0x800f74,%esi
+  800f72:	0f 34                	sysenter
+
+00800f74 <after_sysenter_label_1497>:
+  800f74:	5e                   	pop    %esi
+  800f75:	5d                   	pop    %ebp
+  800f76:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  800f79:	5b                   	pop    %ebx
+  800f7a:	5f                   	pop    %edi
+  800f7b:	5d                   	pop    %ebp
+  800f7c:	c3                   	ret
+
+00800f7d <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  800f7d:	55                   	push   %ebp
+  800f7e:	89 e5                	mov    %esp,%ebp
+  800f80:	57                   	push   %edi
+  800f81:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f82:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f87:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f8a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f8d:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f92:	89 df                	mov    %ebx,%edi
+  800f94:	6a 00                	push   $0x0
+  800f96:	55                   	push   %ebp
+  800f97:	56                   	push   %esi
+  800f98:	89 e5                	mov    %esp,%ebp
+  800f9a:	8d 35 a2 0f 80 00    	lea    0x800fa2,%esi
+  800fa0:	0f 34                	sysenter
+
+00800fa2 <after_sysenter_label_1583>:
+  800fa2:	5e                   	pop    %esi
+  800fa3:	5d                   	pop    %ebp
+  800fa4:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  800fa7:	5b                   	pop    %ebx
+  800fa8:	5f                   	pop    %edi
+  800fa9:	5d                   	pop    %ebp
+  800faa:	c3                   	ret
+
+00800fab <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  800fab:	55                   	push   %ebp
+  800fac:	89 e5                	mov    %esp,%ebp
+  800fae:	57                   	push   %edi
+  800faf:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fb0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fb6:	b8 11 00 00 00       	mov    $0x11,%eax
+  800fbb:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fc0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fc3:	6a 00                	push   $0x0
+  800fc5:	55                   	push   %ebp
+  800fc6:	56                   	push   %esi
+  800fc7:	89 e5                	mov    %esp,%ebp
+  800fc9:	8d 35 d1 0f 80 00    	lea    0x800fd1,%esi
+  800fcf:	0f 34                	sysenter
+
+00800fd1 <after_sysenter_label_1672>:
+  800fd1:	5e                   	pop    %esi
+  800fd2:	5d                   	pop    %ebp
+  800fd3:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  800fd6:	5b                   	pop    %ebx
+  800fd7:	5f                   	pop    %edi
+  800fd8:	5d                   	pop    %ebp
+  800fd9:	c3                   	ret
+
+00800fda <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  800fda:	55                   	push   %ebp
+  800fdb:	89 e5                	mov    %esp,%ebp
+  800fdd:	57                   	push   %edi
+  800fde:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fdf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fe4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fea:	b8 12 00 00 00       	mov    $0x12,%eax
+  800fef:	89 df                	mov    %ebx,%edi
+  800ff1:	6a 00                	push   $0x0
+  800ff3:	55                   	push   %ebp
+  800ff4:	56                   	push   %esi
+  800ff5:	89 e5                	mov    %esp,%ebp
+  800ff7:	8d 35 ff 0f 80 00    	lea    0x800fff,%esi
+  800ffd:	0f 34                	sysenter
+
+00800fff <after_sysenter_label_1758>:
+  800fff:	5e                   	pop    %esi
+  801000:	5d                   	pop    %ebp
+  801001:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  801004:	5b                   	pop    %ebx
+  801005:	5f                   	pop    %edi
+  801006:	5d                   	pop    %ebp
+  801007:	c3                   	ret
+
+00801008 <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  801008:	55                   	push   %ebp
+  801009:	89 e5                	mov    %esp,%ebp
+  80100b:	57                   	push   %edi
+  80100c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80100d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801010:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801015:	b8 13 00 00 00       	mov    $0x13,%eax
+  80101a:	89 cb                	mov    %ecx,%ebx
+  80101c:	89 cf                	mov    %ecx,%edi
+  80101e:	6a 00                	push   $0x0
+  801020:	55                   	push   %ebp
+  801021:	56                   	push   %esi
+  801022:	89 e5                	mov    %esp,%ebp
+  801024:	8d 35 2c 10 80 00    	lea    0x80102c,%esi
+  80102a:	0f 34                	sysenter
+
+0080102c <after_sysenter_label_1842>:
+  80102c:	5e                   	pop    %esi
+  80102d:	5d                   	pop    %ebp
+  80102e:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801031:	85 c0                	test   %eax,%eax
+  801033:	7f 07                	jg     80103c <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  801035:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801038:	5b                   	pop    %ebx
+  801039:	5f                   	pop    %edi
+  80103a:	5d                   	pop    %ebp
+  80103b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80103c:	83 ec 0c             	sub    $0xc,%esp
+  80103f:	50                   	push   %eax
+  801040:	6a 13                	push   $0x13
+  801042:	68 75 4b 80 00       	push   $0x804b75
+  801047:	6a 54                	push   $0x54
+  801049:	68 92 4b 80 00       	push   $0x804b92
+  80104e:	e8 46 f1 ff ff       	call   800199 <_panic>
+
+00801053 <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  801053:	55                   	push   %ebp
+  801054:	89 e5                	mov    %esp,%ebp
+  801056:	57                   	push   %edi
+  801057:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801058:	ba 00 00 00 00       	mov    $0x0,%edx
+  80105d:	b8 14 00 00 00       	mov    $0x14,%eax
+  801062:	89 d1                	mov    %edx,%ecx
+  801064:	89 d3                	mov    %edx,%ebx
+  801066:	89 d7                	mov    %edx,%edi
+  801068:	6a 00                	push   $0x0
+  80106a:	55                   	push   %ebp
+  80106b:	56                   	push   %esi
+  80106c:	89 e5                	mov    %esp,%ebp
+  80106e:	8d 35 76 10 80 00    	lea    0x801076,%esi
+  801074:	0f 34                	sysenter
+
+00801076 <after_sysenter_label_1939>:
+  801076:	5e                   	pop    %esi
+  801077:	5d                   	pop    %ebp
+  801078:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  80107b:	5b                   	pop    %ebx
+  80107c:	5f                   	pop    %edi
+  80107d:	5d                   	pop    %ebp
+  80107e:	c3                   	ret
+
+0080107f <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  80107f:	55                   	push   %ebp
+  801080:	89 e5                	mov    %esp,%ebp
+  801082:	57                   	push   %edi
+  801083:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801084:	8b 55 08             	mov    0x8(%ebp),%edx
+  801087:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80108a:	b8 15 00 00 00       	mov    $0x15,%eax
+  80108f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801094:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801097:	6a 00                	push   $0x0
+  801099:	55                   	push   %ebp
+  80109a:	56                   	push   %esi
+  80109b:	89 e5                	mov    %esp,%ebp
+  80109d:	8d 35 a5 10 80 00    	lea    0x8010a5,%esi
+  8010a3:	0f 34                	sysenter
+
+008010a5 <after_sysenter_label_2028>:
+  8010a5:	5e                   	pop    %esi
+  8010a6:	5d                   	pop    %ebp
+  8010a7:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  8010aa:	5b                   	pop    %ebx
+  8010ab:	5f                   	pop    %edi
+  8010ac:	5d                   	pop    %ebp
+  8010ad:	c3                   	ret
+
+008010ae <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  8010ae:	55                   	push   %ebp
+  8010af:	89 e5                	mov    %esp,%ebp
+  8010b1:	57                   	push   %edi
+  8010b2:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010bb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010be:	b8 16 00 00 00       	mov    $0x16,%eax
+  8010c3:	89 df                	mov    %ebx,%edi
+  8010c5:	6a 00                	push   $0x0
+  8010c7:	55                   	push   %ebp
+  8010c8:	56                   	push   %esi
+  8010c9:	89 e5                	mov    %esp,%ebp
+  8010cb:	8d 35 d3 10 80 00    	lea    0x8010d3,%esi
+  8010d1:	0f 34                	sysenter
+
+008010d3 <after_sysenter_label_2114>:
+  8010d3:	5e                   	pop    %esi
+  8010d4:	5d                   	pop    %ebp
+  8010d5:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  8010d8:	5b                   	pop    %ebx
+  8010d9:	5f                   	pop    %edi
+  8010da:	5d                   	pop    %ebp
+  8010db:	c3                   	ret
+
+008010dc <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  8010dc:	55                   	push   %ebp
+  8010dd:	89 e5                	mov    %esp,%ebp
+  8010df:	57                   	push   %edi
+  8010e0:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ec:	b8 17 00 00 00       	mov    $0x17,%eax
+  8010f1:	89 df                	mov    %ebx,%edi
+  8010f3:	6a 00                	push   $0x0
+  8010f5:	55                   	push   %ebp
+  8010f6:	56                   	push   %esi
+  8010f7:	89 e5                	mov    %esp,%ebp
+  8010f9:	8d 35 01 11 80 00    	lea    0x801101,%esi
+  8010ff:	0f 34                	sysenter
+
+00801101 <after_sysenter_label_2200>:
+  801101:	5e                   	pop    %esi
+  801102:	5d                   	pop    %ebp
+  801103:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  801106:	5b                   	pop    %ebx
+  801107:	5f                   	pop    %edi
+  801108:	5d                   	pop    %ebp
+  801109:	c3                   	ret
+
+0080110a <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  80110a:	55                   	push   %ebp
+  80110b:	89 e5                	mov    %esp,%ebp
+  80110d:	57                   	push   %edi
+  80110e:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80110f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801114:	8b 55 08             	mov    0x8(%ebp),%edx
+  801117:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80111a:	b8 18 00 00 00       	mov    $0x18,%eax
+  80111f:	89 df                	mov    %ebx,%edi
+  801121:	6a 00                	push   $0x0
+  801123:	55                   	push   %ebp
+  801124:	56                   	push   %esi
+  801125:	89 e5                	mov    %esp,%ebp
+  801127:	8d 35 2f 11 80 00    	lea    0x80112f,%esi
+  80112d:	0f 34                	sysenter
+
+0080112f <after_sysenter_label_2286>:
+  80112f:	5e                   	pop    %esi
+  801130:	5d                   	pop    %ebp
+  801131:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  801134:	5b                   	pop    %ebx
+  801135:	5f                   	pop    %edi
+  801136:	5d                   	pop    %ebp
+  801137:	c3                   	ret
+
+00801138 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801138:	55                   	push   %ebp
+  801139:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80113b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80113e:	05 00 00 00 30       	add    $0x30000000,%eax
+  801143:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801146:	5d                   	pop    %ebp
+  801147:	c3                   	ret
+
+00801148 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801148:	55                   	push   %ebp
+  801149:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80114b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80114e:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801153:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801158:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80115d:	5d                   	pop    %ebp
+  80115e:	c3                   	ret
+
+0080115f <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80115f:	55                   	push   %ebp
+  801160:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801162:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801167:	eb 02                	jmp    80116b <fd_alloc+0xc>
+  801169:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80116b:	89 c2                	mov    %eax,%edx
+  80116d:	c1 ea 16             	shr    $0x16,%edx
+  801170:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801177:	f6 c2 01             	test   $0x1,%dl
+  80117a:	74 2b                	je     8011a7 <fd_alloc+0x48>
+  80117c:	89 c2                	mov    %eax,%edx
+  80117e:	c1 ea 0c             	shr    $0xc,%edx
+  801181:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801188:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80118e:	f6 c1 01             	test   $0x1,%cl
+  801191:	74 14                	je     8011a7 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801193:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801199:	75 ce                	jne    801169 <fd_alloc+0xa>
+  80119b:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8011a0:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8011a5:	eb 05                	jmp    8011ac <fd_alloc+0x4d>
+			return 0;
+  8011a7:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8011ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011af:	89 02                	mov    %eax,(%edx)
+}
+  8011b1:	89 c8                	mov    %ecx,%eax
+  8011b3:	5d                   	pop    %ebp
+  8011b4:	c3                   	ret
+
+008011b5 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8011b5:	55                   	push   %ebp
+  8011b6:	89 e5                	mov    %esp,%ebp
+  8011b8:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8011bb:	83 f8 1f             	cmp    $0x1f,%eax
+  8011be:	77 30                	ja     8011f0 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8011c0:	c1 e0 0c             	shl    $0xc,%eax
+  8011c3:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8011c8:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8011ce:	f6 c2 01             	test   $0x1,%dl
+  8011d1:	74 24                	je     8011f7 <fd_lookup+0x42>
+  8011d3:	89 c2                	mov    %eax,%edx
+  8011d5:	c1 ea 0c             	shr    $0xc,%edx
+  8011d8:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8011df:	f6 c2 01             	test   $0x1,%dl
+  8011e2:	74 1a                	je     8011fe <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8011e4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8011e7:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8011e9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011ee:	5d                   	pop    %ebp
+  8011ef:	c3                   	ret
+		return -E_INVAL;
+  8011f0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011f5:	eb f7                	jmp    8011ee <fd_lookup+0x39>
+		return -E_INVAL;
+  8011f7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011fc:	eb f0                	jmp    8011ee <fd_lookup+0x39>
+  8011fe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801203:	eb e9                	jmp    8011ee <fd_lookup+0x39>
+
+00801205 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801205:	55                   	push   %ebp
+  801206:	89 e5                	mov    %esp,%ebp
+  801208:	53                   	push   %ebx
+  801209:	83 ec 04             	sub    $0x4,%esp
+  80120c:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80120f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801214:	eb 03                	jmp    801219 <dev_lookup+0x14>
+  801216:	83 c0 01             	add    $0x1,%eax
+  801219:	8b 1c 85 1c 4c 80 00 	mov    0x804c1c(,%eax,4),%ebx
+  801220:	85 db                	test   %ebx,%ebx
+  801222:	74 0b                	je     80122f <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801224:	39 13                	cmp    %edx,(%ebx)
+  801226:	75 ee                	jne    801216 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801228:	b8 00 00 00 00       	mov    $0x0,%eax
+  80122d:	eb 49                	jmp    801278 <dev_lookup+0x73>
+  80122f:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801231:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  801237:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80123c:	77 18                	ja     801256 <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80123e:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801243:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  801245:	c1 e8 10             	shr    $0x10,%eax
+  801248:	74 0c                	je     801256 <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80124a:	c1 e0 10             	shl    $0x10,%eax
+  80124d:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  801252:	29 c1                	sub    %eax,%ecx
+  801254:	eb 06                	jmp    80125c <dev_lookup+0x57>
+		return pthread_main_tls;
+  801256:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80125c:	8b 01                	mov    (%ecx),%eax
+  80125e:	8b 40 48             	mov    0x48(%eax),%eax
+  801261:	83 ec 04             	sub    $0x4,%esp
+  801264:	52                   	push   %edx
+  801265:	50                   	push   %eax
+  801266:	68 a0 4b 80 00       	push   $0x804ba0
+  80126b:	e8 04 f0 ff ff       	call   800274 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801270:	83 c4 10             	add    $0x10,%esp
+  801273:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801278:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80127b:	89 1a                	mov    %ebx,(%edx)
+}
+  80127d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801280:	c9                   	leave
+  801281:	c3                   	ret
+
+00801282 <fd_close>:
+{
+  801282:	55                   	push   %ebp
+  801283:	89 e5                	mov    %esp,%ebp
+  801285:	57                   	push   %edi
+  801286:	56                   	push   %esi
+  801287:	53                   	push   %ebx
+  801288:	83 ec 24             	sub    $0x24,%esp
+  80128b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80128e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801291:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801294:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801295:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80129b:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80129e:	50                   	push   %eax
+  80129f:	e8 11 ff ff ff       	call   8011b5 <fd_lookup>
+  8012a4:	89 c3                	mov    %eax,%ebx
+  8012a6:	83 c4 10             	add    $0x10,%esp
+  8012a9:	85 c0                	test   %eax,%eax
+  8012ab:	78 05                	js     8012b2 <fd_close+0x30>
+	    || fd != fd2)
+  8012ad:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8012b0:	74 16                	je     8012c8 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8012b2:	89 f8                	mov    %edi,%eax
+  8012b4:	84 c0                	test   %al,%al
+  8012b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012bb:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8012be:	89 d8                	mov    %ebx,%eax
+  8012c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012c3:	5b                   	pop    %ebx
+  8012c4:	5e                   	pop    %esi
+  8012c5:	5f                   	pop    %edi
+  8012c6:	5d                   	pop    %ebp
+  8012c7:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8012c8:	83 ec 08             	sub    $0x8,%esp
+  8012cb:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8012ce:	50                   	push   %eax
+  8012cf:	ff 36                	push   (%esi)
+  8012d1:	e8 2f ff ff ff       	call   801205 <dev_lookup>
+  8012d6:	89 c3                	mov    %eax,%ebx
+  8012d8:	83 c4 10             	add    $0x10,%esp
+  8012db:	85 c0                	test   %eax,%eax
+  8012dd:	78 1a                	js     8012f9 <fd_close+0x77>
+		if (dev->dev_close)
+  8012df:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8012e2:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8012e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8012ea:	85 c0                	test   %eax,%eax
+  8012ec:	74 0b                	je     8012f9 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8012ee:	83 ec 0c             	sub    $0xc,%esp
+  8012f1:	56                   	push   %esi
+  8012f2:	ff d0                	call   *%eax
+  8012f4:	89 c3                	mov    %eax,%ebx
+  8012f6:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8012f9:	83 ec 08             	sub    $0x8,%esp
+  8012fc:	56                   	push   %esi
+  8012fd:	6a 00                	push   $0x0
+  8012ff:	e8 2b fa ff ff       	call   800d2f <sys_page_unmap>
+	return r;
+  801304:	83 c4 10             	add    $0x10,%esp
+  801307:	eb b5                	jmp    8012be <fd_close+0x3c>
+
+00801309 <close>:
+
+int
+close(int fdnum)
+{
+  801309:	55                   	push   %ebp
+  80130a:	89 e5                	mov    %esp,%ebp
+  80130c:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80130f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801312:	50                   	push   %eax
+  801313:	ff 75 08             	push   0x8(%ebp)
+  801316:	e8 9a fe ff ff       	call   8011b5 <fd_lookup>
+  80131b:	83 c4 10             	add    $0x10,%esp
+  80131e:	85 c0                	test   %eax,%eax
+  801320:	79 02                	jns    801324 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801322:	c9                   	leave
+  801323:	c3                   	ret
+		return fd_close(fd, 1);
+  801324:	83 ec 08             	sub    $0x8,%esp
+  801327:	6a 01                	push   $0x1
+  801329:	ff 75 f4             	push   -0xc(%ebp)
+  80132c:	e8 51 ff ff ff       	call   801282 <fd_close>
+  801331:	83 c4 10             	add    $0x10,%esp
+  801334:	eb ec                	jmp    801322 <close+0x19>
+
+00801336 <close_all>:
+
+void
+close_all(void)
+{
+  801336:	55                   	push   %ebp
+  801337:	89 e5                	mov    %esp,%ebp
+  801339:	53                   	push   %ebx
+  80133a:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80133d:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801342:	83 ec 0c             	sub    $0xc,%esp
+  801345:	53                   	push   %ebx
+  801346:	e8 be ff ff ff       	call   801309 <close>
+	for (i = 0; i < MAXFD; i++)
+  80134b:	83 c3 01             	add    $0x1,%ebx
+  80134e:	83 c4 10             	add    $0x10,%esp
+  801351:	83 fb 20             	cmp    $0x20,%ebx
+  801354:	75 ec                	jne    801342 <close_all+0xc>
+}
+  801356:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801359:	c9                   	leave
+  80135a:	c3                   	ret
+
+0080135b <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80135b:	55                   	push   %ebp
+  80135c:	89 e5                	mov    %esp,%ebp
+  80135e:	57                   	push   %edi
+  80135f:	56                   	push   %esi
+  801360:	53                   	push   %ebx
+  801361:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801364:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801367:	50                   	push   %eax
+  801368:	ff 75 08             	push   0x8(%ebp)
+  80136b:	e8 45 fe ff ff       	call   8011b5 <fd_lookup>
+  801370:	89 c3                	mov    %eax,%ebx
+  801372:	83 c4 10             	add    $0x10,%esp
+  801375:	85 c0                	test   %eax,%eax
+  801377:	78 7f                	js     8013f8 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801379:	83 ec 0c             	sub    $0xc,%esp
+  80137c:	ff 75 0c             	push   0xc(%ebp)
+  80137f:	e8 85 ff ff ff       	call   801309 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801384:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801387:	c1 e6 0c             	shl    $0xc,%esi
+  80138a:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801390:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801393:	89 3c 24             	mov    %edi,(%esp)
+  801396:	e8 ad fd ff ff       	call   801148 <fd2data>
+  80139b:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80139d:	89 34 24             	mov    %esi,(%esp)
+  8013a0:	e8 a3 fd ff ff       	call   801148 <fd2data>
+  8013a5:	83 c4 10             	add    $0x10,%esp
+  8013a8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8013ab:	89 d8                	mov    %ebx,%eax
+  8013ad:	c1 e8 16             	shr    $0x16,%eax
+  8013b0:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8013b7:	a8 01                	test   $0x1,%al
+  8013b9:	74 11                	je     8013cc <dup+0x71>
+  8013bb:	89 d8                	mov    %ebx,%eax
+  8013bd:	c1 e8 0c             	shr    $0xc,%eax
+  8013c0:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8013c7:	f6 c2 01             	test   $0x1,%dl
+  8013ca:	75 36                	jne    801402 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8013cc:	89 f8                	mov    %edi,%eax
+  8013ce:	c1 e8 0c             	shr    $0xc,%eax
+  8013d1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8013d8:	83 ec 0c             	sub    $0xc,%esp
+  8013db:	25 07 0e 00 00       	and    $0xe07,%eax
+  8013e0:	50                   	push   %eax
+  8013e1:	56                   	push   %esi
+  8013e2:	6a 00                	push   $0x0
+  8013e4:	57                   	push   %edi
+  8013e5:	6a 00                	push   $0x0
+  8013e7:	e8 f7 f8 ff ff       	call   800ce3 <sys_page_map>
+  8013ec:	89 c3                	mov    %eax,%ebx
+  8013ee:	83 c4 20             	add    $0x20,%esp
+  8013f1:	85 c0                	test   %eax,%eax
+  8013f3:	78 33                	js     801428 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8013f5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8013f8:	89 d8                	mov    %ebx,%eax
+  8013fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013fd:	5b                   	pop    %ebx
+  8013fe:	5e                   	pop    %esi
+  8013ff:	5f                   	pop    %edi
+  801400:	5d                   	pop    %ebp
+  801401:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801402:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801409:	83 ec 0c             	sub    $0xc,%esp
+  80140c:	25 07 0e 00 00       	and    $0xe07,%eax
+  801411:	50                   	push   %eax
+  801412:	ff 75 d4             	push   -0x2c(%ebp)
+  801415:	6a 00                	push   $0x0
+  801417:	53                   	push   %ebx
+  801418:	6a 00                	push   $0x0
+  80141a:	e8 c4 f8 ff ff       	call   800ce3 <sys_page_map>
+  80141f:	89 c3                	mov    %eax,%ebx
+  801421:	83 c4 20             	add    $0x20,%esp
+  801424:	85 c0                	test   %eax,%eax
+  801426:	79 a4                	jns    8013cc <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801428:	83 ec 08             	sub    $0x8,%esp
+  80142b:	56                   	push   %esi
+  80142c:	6a 00                	push   $0x0
+  80142e:	e8 fc f8 ff ff       	call   800d2f <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801433:	83 c4 08             	add    $0x8,%esp
+  801436:	ff 75 d4             	push   -0x2c(%ebp)
+  801439:	6a 00                	push   $0x0
+  80143b:	e8 ef f8 ff ff       	call   800d2f <sys_page_unmap>
+	return r;
+  801440:	83 c4 10             	add    $0x10,%esp
+  801443:	eb b3                	jmp    8013f8 <dup+0x9d>
+
+00801445 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801445:	55                   	push   %ebp
+  801446:	89 e5                	mov    %esp,%ebp
+  801448:	56                   	push   %esi
+  801449:	53                   	push   %ebx
+  80144a:	83 ec 18             	sub    $0x18,%esp
+  80144d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801450:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801453:	50                   	push   %eax
+  801454:	53                   	push   %ebx
+  801455:	e8 5b fd ff ff       	call   8011b5 <fd_lookup>
+  80145a:	83 c4 10             	add    $0x10,%esp
+  80145d:	85 c0                	test   %eax,%eax
+  80145f:	78 3c                	js     80149d <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801461:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801464:	83 ec 08             	sub    $0x8,%esp
+  801467:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80146a:	50                   	push   %eax
+  80146b:	ff 36                	push   (%esi)
+  80146d:	e8 93 fd ff ff       	call   801205 <dev_lookup>
+  801472:	83 c4 10             	add    $0x10,%esp
+  801475:	85 c0                	test   %eax,%eax
+  801477:	78 24                	js     80149d <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801479:	8b 46 08             	mov    0x8(%esi),%eax
+  80147c:	83 e0 03             	and    $0x3,%eax
+  80147f:	83 f8 01             	cmp    $0x1,%eax
+  801482:	74 20                	je     8014a4 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801484:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801487:	8b 40 08             	mov    0x8(%eax),%eax
+  80148a:	85 c0                	test   %eax,%eax
+  80148c:	74 61                	je     8014ef <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80148e:	83 ec 04             	sub    $0x4,%esp
+  801491:	ff 75 10             	push   0x10(%ebp)
+  801494:	ff 75 0c             	push   0xc(%ebp)
+  801497:	56                   	push   %esi
+  801498:	ff d0                	call   *%eax
+  80149a:	83 c4 10             	add    $0x10,%esp
+}
+  80149d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014a0:	5b                   	pop    %ebx
+  8014a1:	5e                   	pop    %esi
+  8014a2:	5d                   	pop    %ebp
+  8014a3:	c3                   	ret
+  8014a4:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8014a6:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8014ac:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8014b1:	77 18                	ja     8014cb <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8014b3:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8014b8:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8014ba:	c1 e8 10             	shr    $0x10,%eax
+  8014bd:	74 0c                	je     8014cb <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8014bf:	c1 e0 10             	shl    $0x10,%eax
+  8014c2:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8014c7:	29 c2                	sub    %eax,%edx
+  8014c9:	eb 06                	jmp    8014d1 <read+0x8c>
+		return pthread_main_tls;
+  8014cb:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8014d1:	8b 02                	mov    (%edx),%eax
+  8014d3:	8b 40 48             	mov    0x48(%eax),%eax
+  8014d6:	83 ec 04             	sub    $0x4,%esp
+  8014d9:	53                   	push   %ebx
+  8014da:	50                   	push   %eax
+  8014db:	68 e1 4b 80 00       	push   $0x804be1
+  8014e0:	e8 8f ed ff ff       	call   800274 <cprintf>
+		return -E_INVAL;
+  8014e5:	83 c4 10             	add    $0x10,%esp
+  8014e8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014ed:	eb ae                	jmp    80149d <read+0x58>
+		return -E_NOT_SUPP;
+  8014ef:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8014f4:	eb a7                	jmp    80149d <read+0x58>
+
+008014f6 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8014f6:	55                   	push   %ebp
+  8014f7:	89 e5                	mov    %esp,%ebp
+  8014f9:	57                   	push   %edi
+  8014fa:	56                   	push   %esi
+  8014fb:	53                   	push   %ebx
+  8014fc:	83 ec 0c             	sub    $0xc,%esp
+  8014ff:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801502:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801505:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80150a:	eb 02                	jmp    80150e <readn+0x18>
+  80150c:	01 c3                	add    %eax,%ebx
+  80150e:	39 f3                	cmp    %esi,%ebx
+  801510:	73 21                	jae    801533 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801512:	83 ec 04             	sub    $0x4,%esp
+  801515:	89 f0                	mov    %esi,%eax
+  801517:	29 d8                	sub    %ebx,%eax
+  801519:	50                   	push   %eax
+  80151a:	89 d8                	mov    %ebx,%eax
+  80151c:	03 45 0c             	add    0xc(%ebp),%eax
+  80151f:	50                   	push   %eax
+  801520:	57                   	push   %edi
+  801521:	e8 1f ff ff ff       	call   801445 <read>
+		if (m < 0)
+  801526:	83 c4 10             	add    $0x10,%esp
+  801529:	85 c0                	test   %eax,%eax
+  80152b:	78 04                	js     801531 <readn+0x3b>
+			return m;
+		if (m == 0)
+  80152d:	75 dd                	jne    80150c <readn+0x16>
+  80152f:	eb 02                	jmp    801533 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801531:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801533:	89 d8                	mov    %ebx,%eax
+  801535:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801538:	5b                   	pop    %ebx
+  801539:	5e                   	pop    %esi
+  80153a:	5f                   	pop    %edi
+  80153b:	5d                   	pop    %ebp
+  80153c:	c3                   	ret
+
+0080153d <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80153d:	55                   	push   %ebp
+  80153e:	89 e5                	mov    %esp,%ebp
+  801540:	56                   	push   %esi
+  801541:	53                   	push   %ebx
+  801542:	83 ec 18             	sub    $0x18,%esp
+  801545:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801548:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80154b:	50                   	push   %eax
+  80154c:	53                   	push   %ebx
+  80154d:	e8 63 fc ff ff       	call   8011b5 <fd_lookup>
+  801552:	83 c4 10             	add    $0x10,%esp
+  801555:	85 c0                	test   %eax,%eax
+  801557:	78 37                	js     801590 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801559:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80155c:	83 ec 08             	sub    $0x8,%esp
+  80155f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801562:	50                   	push   %eax
+  801563:	ff 36                	push   (%esi)
+  801565:	e8 9b fc ff ff       	call   801205 <dev_lookup>
+  80156a:	83 c4 10             	add    $0x10,%esp
+  80156d:	85 c0                	test   %eax,%eax
+  80156f:	78 1f                	js     801590 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801571:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801575:	74 20                	je     801597 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801577:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80157a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80157d:	85 c0                	test   %eax,%eax
+  80157f:	74 61                	je     8015e2 <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801581:	83 ec 04             	sub    $0x4,%esp
+  801584:	ff 75 10             	push   0x10(%ebp)
+  801587:	ff 75 0c             	push   0xc(%ebp)
+  80158a:	56                   	push   %esi
+  80158b:	ff d0                	call   *%eax
+  80158d:	83 c4 10             	add    $0x10,%esp
+}
+  801590:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801593:	5b                   	pop    %ebx
+  801594:	5e                   	pop    %esi
+  801595:	5d                   	pop    %ebp
+  801596:	c3                   	ret
+  801597:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801599:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80159f:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8015a4:	77 18                	ja     8015be <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8015a6:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8015ab:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8015ad:	c1 e8 10             	shr    $0x10,%eax
+  8015b0:	74 0c                	je     8015be <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8015b2:	c1 e0 10             	shl    $0x10,%eax
+  8015b5:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8015ba:	29 c2                	sub    %eax,%edx
+  8015bc:	eb 06                	jmp    8015c4 <write+0x87>
+		return pthread_main_tls;
+  8015be:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8015c4:	8b 02                	mov    (%edx),%eax
+  8015c6:	8b 40 48             	mov    0x48(%eax),%eax
+  8015c9:	83 ec 04             	sub    $0x4,%esp
+  8015cc:	53                   	push   %ebx
+  8015cd:	50                   	push   %eax
+  8015ce:	68 fd 4b 80 00       	push   $0x804bfd
+  8015d3:	e8 9c ec ff ff       	call   800274 <cprintf>
+		return -E_INVAL;
+  8015d8:	83 c4 10             	add    $0x10,%esp
+  8015db:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015e0:	eb ae                	jmp    801590 <write+0x53>
+		return -E_NOT_SUPP;
+  8015e2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015e7:	eb a7                	jmp    801590 <write+0x53>
+
+008015e9 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8015e9:	55                   	push   %ebp
+  8015ea:	89 e5                	mov    %esp,%ebp
+  8015ec:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8015ef:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015f2:	50                   	push   %eax
+  8015f3:	ff 75 08             	push   0x8(%ebp)
+  8015f6:	e8 ba fb ff ff       	call   8011b5 <fd_lookup>
+  8015fb:	83 c4 10             	add    $0x10,%esp
+  8015fe:	85 c0                	test   %eax,%eax
+  801600:	78 0e                	js     801610 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801602:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801605:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801608:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80160b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801610:	c9                   	leave
+  801611:	c3                   	ret
+
+00801612 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801612:	55                   	push   %ebp
+  801613:	89 e5                	mov    %esp,%ebp
+  801615:	56                   	push   %esi
+  801616:	53                   	push   %ebx
+  801617:	83 ec 18             	sub    $0x18,%esp
+  80161a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80161d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801620:	50                   	push   %eax
+  801621:	53                   	push   %ebx
+  801622:	e8 8e fb ff ff       	call   8011b5 <fd_lookup>
+  801627:	83 c4 10             	add    $0x10,%esp
+  80162a:	85 c0                	test   %eax,%eax
+  80162c:	78 34                	js     801662 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80162e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801631:	83 ec 08             	sub    $0x8,%esp
+  801634:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801637:	50                   	push   %eax
+  801638:	ff 36                	push   (%esi)
+  80163a:	e8 c6 fb ff ff       	call   801205 <dev_lookup>
+  80163f:	83 c4 10             	add    $0x10,%esp
+  801642:	85 c0                	test   %eax,%eax
+  801644:	78 1c                	js     801662 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801646:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80164a:	74 1d                	je     801669 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80164c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80164f:	8b 40 18             	mov    0x18(%eax),%eax
+  801652:	85 c0                	test   %eax,%eax
+  801654:	74 5e                	je     8016b4 <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801656:	83 ec 08             	sub    $0x8,%esp
+  801659:	ff 75 0c             	push   0xc(%ebp)
+  80165c:	56                   	push   %esi
+  80165d:	ff d0                	call   *%eax
+  80165f:	83 c4 10             	add    $0x10,%esp
+}
+  801662:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801665:	5b                   	pop    %ebx
+  801666:	5e                   	pop    %esi
+  801667:	5d                   	pop    %ebp
+  801668:	c3                   	ret
+  801669:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80166b:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801671:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801676:	77 18                	ja     801690 <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801678:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80167d:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80167f:	c1 e8 10             	shr    $0x10,%eax
+  801682:	74 0c                	je     801690 <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801684:	c1 e0 10             	shl    $0x10,%eax
+  801687:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80168c:	29 c2                	sub    %eax,%edx
+  80168e:	eb 06                	jmp    801696 <ftruncate+0x84>
+		return pthread_main_tls;
+  801690:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+			thisenv->env_id, fdnum);
+  801696:	8b 02                	mov    (%edx),%eax
+  801698:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80169b:	83 ec 04             	sub    $0x4,%esp
+  80169e:	53                   	push   %ebx
+  80169f:	50                   	push   %eax
+  8016a0:	68 c0 4b 80 00       	push   $0x804bc0
+  8016a5:	e8 ca eb ff ff       	call   800274 <cprintf>
+		return -E_INVAL;
+  8016aa:	83 c4 10             	add    $0x10,%esp
+  8016ad:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016b2:	eb ae                	jmp    801662 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8016b4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016b9:	eb a7                	jmp    801662 <ftruncate+0x50>
+
+008016bb <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8016bb:	55                   	push   %ebp
+  8016bc:	89 e5                	mov    %esp,%ebp
+  8016be:	56                   	push   %esi
+  8016bf:	53                   	push   %ebx
+  8016c0:	83 ec 18             	sub    $0x18,%esp
+  8016c3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016c6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016c9:	50                   	push   %eax
+  8016ca:	ff 75 08             	push   0x8(%ebp)
+  8016cd:	e8 e3 fa ff ff       	call   8011b5 <fd_lookup>
+  8016d2:	83 c4 10             	add    $0x10,%esp
+  8016d5:	85 c0                	test   %eax,%eax
+  8016d7:	78 49                	js     801722 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016d9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8016dc:	83 ec 08             	sub    $0x8,%esp
+  8016df:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016e2:	50                   	push   %eax
+  8016e3:	ff 36                	push   (%esi)
+  8016e5:	e8 1b fb ff ff       	call   801205 <dev_lookup>
+  8016ea:	83 c4 10             	add    $0x10,%esp
+  8016ed:	85 c0                	test   %eax,%eax
+  8016ef:	78 31                	js     801722 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8016f1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016f4:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8016f8:	74 2f                	je     801729 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8016fa:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8016fd:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801704:	00 00 00 
+	stat->st_isdir = 0;
+  801707:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80170e:	00 00 00 
+	stat->st_dev = dev;
+  801711:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801717:	83 ec 08             	sub    $0x8,%esp
+  80171a:	53                   	push   %ebx
+  80171b:	56                   	push   %esi
+  80171c:	ff 50 14             	call   *0x14(%eax)
+  80171f:	83 c4 10             	add    $0x10,%esp
+}
+  801722:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801725:	5b                   	pop    %ebx
+  801726:	5e                   	pop    %esi
+  801727:	5d                   	pop    %ebp
+  801728:	c3                   	ret
+		return -E_NOT_SUPP;
+  801729:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80172e:	eb f2                	jmp    801722 <fstat+0x67>
+
+00801730 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801730:	55                   	push   %ebp
+  801731:	89 e5                	mov    %esp,%ebp
+  801733:	56                   	push   %esi
+  801734:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801735:	83 ec 08             	sub    $0x8,%esp
+  801738:	6a 00                	push   $0x0
+  80173a:	ff 75 08             	push   0x8(%ebp)
+  80173d:	e8 4b 03 00 00       	call   801a8d <open>
+  801742:	89 c3                	mov    %eax,%ebx
+  801744:	83 c4 10             	add    $0x10,%esp
+  801747:	85 c0                	test   %eax,%eax
+  801749:	78 1b                	js     801766 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80174b:	83 ec 08             	sub    $0x8,%esp
+  80174e:	ff 75 0c             	push   0xc(%ebp)
+  801751:	50                   	push   %eax
+  801752:	e8 64 ff ff ff       	call   8016bb <fstat>
+  801757:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801759:	89 1c 24             	mov    %ebx,(%esp)
+  80175c:	e8 a8 fb ff ff       	call   801309 <close>
+	return r;
+  801761:	83 c4 10             	add    $0x10,%esp
+  801764:	89 f3                	mov    %esi,%ebx
+}
+  801766:	89 d8                	mov    %ebx,%eax
+  801768:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80176b:	5b                   	pop    %ebx
+  80176c:	5e                   	pop    %esi
+  80176d:	5d                   	pop    %ebp
+  80176e:	c3                   	ret
+
+0080176f <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  80176f:	55                   	push   %ebp
+  801770:	89 e5                	mov    %esp,%ebp
+  801772:	56                   	push   %esi
+  801773:	53                   	push   %ebx
+  801774:	89 c6                	mov    %eax,%esi
+  801776:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801778:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  80177f:	74 27                	je     8017a8 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801781:	6a 07                	push   $0x7
+  801783:	68 00 70 80 00       	push   $0x807000
+  801788:	56                   	push   %esi
+  801789:	ff 35 00 60 80 00    	push   0x806000
+  80178f:	e8 4e 2c 00 00       	call   8043e2 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801794:	83 c4 0c             	add    $0xc,%esp
+  801797:	6a 00                	push   $0x0
+  801799:	53                   	push   %ebx
+  80179a:	6a 00                	push   $0x0
+  80179c:	e8 4b 2b 00 00       	call   8042ec <ipc_recv>
+}
+  8017a1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017a4:	5b                   	pop    %ebx
+  8017a5:	5e                   	pop    %esi
+  8017a6:	5d                   	pop    %ebp
+  8017a7:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8017a8:	83 ec 0c             	sub    $0xc,%esp
+  8017ab:	6a 01                	push   $0x1
+  8017ad:	e8 86 2c 00 00       	call   804438 <ipc_find_env>
+  8017b2:	a3 00 60 80 00       	mov    %eax,0x806000
+  8017b7:	83 c4 10             	add    $0x10,%esp
+  8017ba:	eb c5                	jmp    801781 <fsipc+0x12>
+
+008017bc <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8017bc:	55                   	push   %ebp
+  8017bd:	89 e5                	mov    %esp,%ebp
+  8017bf:	53                   	push   %ebx
+  8017c0:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  8017c3:	68 04 60 80 00       	push   $0x806004
+  8017c8:	e8 29 1b 00 00       	call   8032f6 <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8017cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017d0:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017d3:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  8017d8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8017db:	a3 04 70 80 00       	mov    %eax,0x807004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  8017e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017e5:	b8 02 00 00 00       	mov    $0x2,%eax
+  8017ea:	e8 80 ff ff ff       	call   80176f <fsipc>
+  8017ef:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8017f1:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  8017f8:	e8 66 1b 00 00       	call   803363 <mutex_unlock>
+	return r;
+}
+  8017fd:	89 d8                	mov    %ebx,%eax
+  8017ff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801802:	c9                   	leave
+  801803:	c3                   	ret
+
+00801804 <devfile_flush>:
+{
+  801804:	55                   	push   %ebp
+  801805:	89 e5                	mov    %esp,%ebp
+  801807:	53                   	push   %ebx
+  801808:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  80180b:	68 04 60 80 00       	push   $0x806004
+  801810:	e8 e1 1a 00 00       	call   8032f6 <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801815:	8b 45 08             	mov    0x8(%ebp),%eax
+  801818:	8b 40 0c             	mov    0xc(%eax),%eax
+  80181b:	a3 00 70 80 00       	mov    %eax,0x807000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  801820:	ba 00 00 00 00       	mov    $0x0,%edx
+  801825:	b8 06 00 00 00       	mov    $0x6,%eax
+  80182a:	e8 40 ff ff ff       	call   80176f <fsipc>
+  80182f:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801831:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801838:	e8 26 1b 00 00       	call   803363 <mutex_unlock>
+}
+  80183d:	89 d8                	mov    %ebx,%eax
+  80183f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801842:	c9                   	leave
+  801843:	c3                   	ret
+
+00801844 <devfile_stat>:
+{
+  801844:	55                   	push   %ebp
+  801845:	89 e5                	mov    %esp,%ebp
+  801847:	56                   	push   %esi
+  801848:	53                   	push   %ebx
+  801849:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  80184c:	83 ec 0c             	sub    $0xc,%esp
+  80184f:	68 04 60 80 00       	push   $0x806004
+  801854:	e8 9d 1a 00 00       	call   8032f6 <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801859:	8b 45 08             	mov    0x8(%ebp),%eax
+  80185c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80185f:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  801864:	ba 00 00 00 00       	mov    $0x0,%edx
+  801869:	b8 05 00 00 00       	mov    $0x5,%eax
+  80186e:	e8 fc fe ff ff       	call   80176f <fsipc>
+  801873:	89 c3                	mov    %eax,%ebx
+  801875:	83 c4 10             	add    $0x10,%esp
+  801878:	85 c0                	test   %eax,%eax
+  80187a:	79 16                	jns    801892 <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  80187c:	83 ec 0c             	sub    $0xc,%esp
+  80187f:	68 04 60 80 00       	push   $0x806004
+  801884:	e8 da 1a 00 00       	call   803363 <mutex_unlock>
+}
+  801889:	89 d8                	mov    %ebx,%eax
+  80188b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80188e:	5b                   	pop    %ebx
+  80188f:	5e                   	pop    %esi
+  801890:	5d                   	pop    %ebp
+  801891:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801892:	83 ec 08             	sub    $0x8,%esp
+  801895:	68 00 70 80 00       	push   $0x807000
+  80189a:	56                   	push   %esi
+  80189b:	e8 b8 ef ff ff       	call   800858 <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  8018a0:	a1 80 70 80 00       	mov    0x807080,%eax
+  8018a5:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8018ab:	a1 84 70 80 00       	mov    0x807084,%eax
+  8018b0:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  8018b6:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  8018b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018be:	eb bc                	jmp    80187c <devfile_stat+0x38>
+
+008018c0 <devfile_write>:
+{
+  8018c0:	55                   	push   %ebp
+  8018c1:	89 e5                	mov    %esp,%ebp
+  8018c3:	53                   	push   %ebx
+  8018c4:	83 ec 10             	sub    $0x10,%esp
+  8018c7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  8018ca:	68 04 60 80 00       	push   $0x806004
+  8018cf:	e8 22 1a 00 00       	call   8032f6 <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8018d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018d7:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018da:	a3 00 70 80 00       	mov    %eax,0x807000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  8018df:	83 c4 10             	add    $0x10,%esp
+  8018e2:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  8018e8:	76 3d                	jbe    801927 <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  8018ea:	b8 00 00 10 00       	mov    $0x100000,%eax
+  8018ef:	39 c3                	cmp    %eax,%ebx
+  8018f1:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  8018f4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8018f7:	a3 08 70 80 00       	mov    %eax,0x807008
+	fsipcbuf.write.req_n = n;
+  8018fc:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	r = fsipc(FSREQ_WRITE, NULL);
+  801902:	ba 00 00 00 00       	mov    $0x0,%edx
+  801907:	b8 04 00 00 00       	mov    $0x4,%eax
+  80190c:	e8 5e fe ff ff       	call   80176f <fsipc>
+  801911:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801913:	83 ec 0c             	sub    $0xc,%esp
+  801916:	68 04 60 80 00       	push   $0x806004
+  80191b:	e8 43 1a 00 00       	call   803363 <mutex_unlock>
+}
+  801920:	89 d8                	mov    %ebx,%eax
+  801922:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801925:	c9                   	leave
+  801926:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  801927:	83 ec 04             	sub    $0x4,%esp
+  80192a:	53                   	push   %ebx
+  80192b:	ff 75 0c             	push   0xc(%ebp)
+  80192e:	68 0c 70 80 00       	push   $0x80700c
+  801933:	e8 a6 f0 ff ff       	call   8009de <memmove>
+  801938:	83 c4 10             	add    $0x10,%esp
+  80193b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801940:	eb b5                	jmp    8018f7 <devfile_write+0x37>
+
+00801942 <devfile_read>:
+{
+  801942:	55                   	push   %ebp
+  801943:	89 e5                	mov    %esp,%ebp
+  801945:	57                   	push   %edi
+  801946:	56                   	push   %esi
+  801947:	53                   	push   %ebx
+  801948:	83 ec 0c             	sub    $0xc,%esp
+  80194b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80194e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801951:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  801954:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  80195a:	0f 86 8c 00 00 00    	jbe    8019ec <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  801960:	b8 00 00 10 00       	mov    $0x100000,%eax
+  801965:	39 c3                	cmp    %eax,%ebx
+  801967:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  80196a:	89 f8                	mov    %edi,%eax
+  80196c:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  80196f:	eb 0f                	jmp    801980 <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  801971:	0f b6 08             	movzbl (%eax),%ecx
+  801974:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  801976:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80197b:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  801980:	39 d0                	cmp    %edx,%eax
+  801982:	72 ed                	jb     801971 <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  801984:	83 ec 0c             	sub    $0xc,%esp
+  801987:	68 04 60 80 00       	push   $0x806004
+  80198c:	e8 65 19 00 00       	call   8032f6 <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801991:	8b 46 0c             	mov    0xc(%esi),%eax
+  801994:	a3 00 70 80 00       	mov    %eax,0x807000
+		fsipcbuf.read.req_n = n;
+  801999:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  80199f:	89 3d 08 70 80 00    	mov    %edi,0x807008
+		r = fsipc(FSREQ_READ, NULL);
+  8019a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019aa:	b8 03 00 00 00       	mov    $0x3,%eax
+  8019af:	e8 bb fd ff ff       	call   80176f <fsipc>
+  8019b4:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  8019b6:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  8019bd:	e8 a1 19 00 00       	call   803363 <mutex_unlock>
+		assert(r <= (int) n);
+  8019c2:	83 c4 10             	add    $0x10,%esp
+  8019c5:	39 f3                	cmp    %esi,%ebx
+  8019c7:	7c 0a                	jl     8019d3 <devfile_read+0x91>
+}
+  8019c9:	89 f0                	mov    %esi,%eax
+  8019cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019ce:	5b                   	pop    %ebx
+  8019cf:	5e                   	pop    %esi
+  8019d0:	5f                   	pop    %edi
+  8019d1:	5d                   	pop    %ebp
+  8019d2:	c3                   	ret
+		assert(r <= (int) n);
+  8019d3:	68 30 4c 80 00       	push   $0x804c30
+  8019d8:	68 3d 4c 80 00       	push   $0x804c3d
+  8019dd:	68 90 00 00 00       	push   $0x90
+  8019e2:	68 52 4c 80 00       	push   $0x804c52
+  8019e7:	e8 ad e7 ff ff       	call   800199 <_panic>
+	mutex_lock(&fsipc_mu);
+  8019ec:	83 ec 0c             	sub    $0xc,%esp
+  8019ef:	68 04 60 80 00       	push   $0x806004
+  8019f4:	e8 fd 18 00 00       	call   8032f6 <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8019f9:	8b 46 0c             	mov    0xc(%esi),%eax
+  8019fc:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  801a01:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	fsipcbuf.read.req_va = 0;
+  801a07:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  801a0e:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  801a11:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a16:	b8 03 00 00 00       	mov    $0x3,%eax
+  801a1b:	e8 4f fd ff ff       	call   80176f <fsipc>
+  801a20:	89 c6                	mov    %eax,%esi
+  801a22:	83 c4 10             	add    $0x10,%esp
+  801a25:	85 c0                	test   %eax,%eax
+  801a27:	78 1d                	js     801a46 <devfile_read+0x104>
+		assert(r <= n);
+  801a29:	39 c3                	cmp    %eax,%ebx
+  801a2b:	72 2e                	jb     801a5b <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  801a2d:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801a32:	7f 40                	jg     801a74 <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801a34:	83 ec 04             	sub    $0x4,%esp
+  801a37:	50                   	push   %eax
+  801a38:	68 00 70 80 00       	push   $0x807000
+  801a3d:	57                   	push   %edi
+  801a3e:	e8 9b ef ff ff       	call   8009de <memmove>
+  801a43:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  801a46:	83 ec 0c             	sub    $0xc,%esp
+  801a49:	68 04 60 80 00       	push   $0x806004
+  801a4e:	e8 10 19 00 00       	call   803363 <mutex_unlock>
+	return r;
+  801a53:	83 c4 10             	add    $0x10,%esp
+  801a56:	e9 6e ff ff ff       	jmp    8019c9 <devfile_read+0x87>
+		assert(r <= n);
+  801a5b:	68 5d 4c 80 00       	push   $0x804c5d
+  801a60:	68 3d 4c 80 00       	push   $0x804c3d
+  801a65:	68 99 00 00 00       	push   $0x99
+  801a6a:	68 52 4c 80 00       	push   $0x804c52
+  801a6f:	e8 25 e7 ff ff       	call   800199 <_panic>
+		assert(r <= PGSIZE);
+  801a74:	68 64 4c 80 00       	push   $0x804c64
+  801a79:	68 3d 4c 80 00       	push   $0x804c3d
+  801a7e:	68 9a 00 00 00       	push   $0x9a
+  801a83:	68 52 4c 80 00       	push   $0x804c52
+  801a88:	e8 0c e7 ff ff       	call   800199 <_panic>
+
+00801a8d <open>:
+{
+  801a8d:	55                   	push   %ebp
+  801a8e:	89 e5                	mov    %esp,%ebp
+  801a90:	56                   	push   %esi
+  801a91:	53                   	push   %ebx
+  801a92:	83 ec 1c             	sub    $0x1c,%esp
+  801a95:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801a98:	56                   	push   %esi
+  801a99:	e8 7f ed ff ff       	call   80081d <strlen>
+  801a9e:	83 c4 10             	add    $0x10,%esp
+  801aa1:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801aa6:	0f 8f 85 00 00 00    	jg     801b31 <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  801aac:	83 ec 0c             	sub    $0xc,%esp
+  801aaf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ab2:	50                   	push   %eax
+  801ab3:	e8 a7 f6 ff ff       	call   80115f <fd_alloc>
+  801ab8:	89 c3                	mov    %eax,%ebx
+  801aba:	83 c4 10             	add    $0x10,%esp
+  801abd:	85 c0                	test   %eax,%eax
+  801abf:	78 55                	js     801b16 <open+0x89>
+	mutex_lock(&fsipc_mu);
+  801ac1:	83 ec 0c             	sub    $0xc,%esp
+  801ac4:	68 04 60 80 00       	push   $0x806004
+  801ac9:	e8 28 18 00 00       	call   8032f6 <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  801ace:	83 c4 08             	add    $0x8,%esp
+  801ad1:	56                   	push   %esi
+  801ad2:	68 00 70 80 00       	push   $0x807000
+  801ad7:	e8 7c ed ff ff       	call   800858 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801adc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801adf:	a3 00 74 80 00       	mov    %eax,0x807400
+	r = fsipc(FSREQ_OPEN, fd);
+  801ae4:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801ae7:	b8 01 00 00 00       	mov    $0x1,%eax
+  801aec:	e8 7e fc ff ff       	call   80176f <fsipc>
+  801af1:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801af3:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801afa:	e8 64 18 00 00       	call   803363 <mutex_unlock>
+	if (r < 0) {
+  801aff:	83 c4 10             	add    $0x10,%esp
+  801b02:	85 db                	test   %ebx,%ebx
+  801b04:	78 19                	js     801b1f <open+0x92>
+	return fd2num(fd);
+  801b06:	83 ec 0c             	sub    $0xc,%esp
+  801b09:	ff 75 f4             	push   -0xc(%ebp)
+  801b0c:	e8 27 f6 ff ff       	call   801138 <fd2num>
+  801b11:	89 c3                	mov    %eax,%ebx
+  801b13:	83 c4 10             	add    $0x10,%esp
+}
+  801b16:	89 d8                	mov    %ebx,%eax
+  801b18:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b1b:	5b                   	pop    %ebx
+  801b1c:	5e                   	pop    %esi
+  801b1d:	5d                   	pop    %ebp
+  801b1e:	c3                   	ret
+		fd_close(fd, 0);
+  801b1f:	83 ec 08             	sub    $0x8,%esp
+  801b22:	6a 00                	push   $0x0
+  801b24:	ff 75 f4             	push   -0xc(%ebp)
+  801b27:	e8 56 f7 ff ff       	call   801282 <fd_close>
+		return r;
+  801b2c:	83 c4 10             	add    $0x10,%esp
+  801b2f:	eb e5                	jmp    801b16 <open+0x89>
+		return -E_BAD_PATH;
+  801b31:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801b36:	eb de                	jmp    801b16 <open+0x89>
+
+00801b38 <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  801b38:	55                   	push   %ebp
+  801b39:	89 e5                	mov    %esp,%ebp
+  801b3b:	53                   	push   %ebx
+  801b3c:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801b3f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b42:	50                   	push   %eax
+  801b43:	ff 75 08             	push   0x8(%ebp)
+  801b46:	e8 6a f6 ff ff       	call   8011b5 <fd_lookup>
+  801b4b:	89 c3                	mov    %eax,%ebx
+  801b4d:	83 c4 10             	add    $0x10,%esp
+  801b50:	85 c0                	test   %eax,%eax
+  801b52:	78 5b                	js     801baf <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801b54:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b57:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  801b5d:	39 08                	cmp    %ecx,(%eax)
+  801b5f:	75 55                	jne    801bb6 <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  801b61:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  801b65:	74 56                	je     801bbd <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  801b67:	83 ec 0c             	sub    $0xc,%esp
+  801b6a:	68 04 60 80 00       	push   $0x806004
+  801b6f:	e8 82 17 00 00       	call   8032f6 <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  801b74:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b77:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b7a:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.allocate.req_offset = offset;
+  801b7f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b82:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.allocate.req_len = len;
+  801b87:	8b 45 10             	mov    0x10(%ebp),%eax
+  801b8a:	a3 08 70 80 00       	mov    %eax,0x807008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  801b8f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b94:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801b99:	e8 d1 fb ff ff       	call   80176f <fsipc>
+  801b9e:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801ba0:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801ba7:	e8 b7 17 00 00       	call   803363 <mutex_unlock>
+	return r;
+  801bac:	83 c4 10             	add    $0x10,%esp
+}
+  801baf:	89 d8                	mov    %ebx,%eax
+  801bb1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bb4:	c9                   	leave
+  801bb5:	c3                   	ret
+		return -E_NOT_SUPP;
+  801bb6:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801bbb:	eb f2                	jmp    801baf <fallocate+0x77>
+		return -E_INVAL;
+  801bbd:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801bc2:	eb eb                	jmp    801baf <fallocate+0x77>
+
+00801bc4 <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  801bc4:	55                   	push   %ebp
+  801bc5:	89 e5                	mov    %esp,%ebp
+  801bc7:	56                   	push   %esi
+  801bc8:	53                   	push   %ebx
+  801bc9:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801bcc:	89 f3                	mov    %esi,%ebx
+  801bce:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801bd4:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801bd7:	eb 06                	jmp    801bdf <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801bd9:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801bdf:	39 f3                	cmp    %esi,%ebx
+  801be1:	73 14                	jae    801bf7 <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  801be3:	83 ec 08             	sub    $0x8,%esp
+  801be6:	53                   	push   %ebx
+  801be7:	6a 00                	push   $0x0
+  801be9:	e8 41 f1 ff ff       	call   800d2f <sys_page_unmap>
+  801bee:	83 c4 10             	add    $0x10,%esp
+  801bf1:	85 c0                	test   %eax,%eax
+  801bf3:	79 e4                	jns    801bd9 <munmap+0x15>
+  801bf5:	eb 05                	jmp    801bfc <munmap+0x38>
+			return r;
+	return 0;
+  801bf7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801bfc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bff:	5b                   	pop    %ebx
+  801c00:	5e                   	pop    %esi
+  801c01:	5d                   	pop    %ebp
+  801c02:	c3                   	ret
+
+00801c03 <mmap>:
+{
+  801c03:	55                   	push   %ebp
+  801c04:	89 e5                	mov    %esp,%ebp
+  801c06:	57                   	push   %edi
+  801c07:	56                   	push   %esi
+  801c08:	53                   	push   %ebx
+  801c09:	83 ec 24             	sub    $0x24,%esp
+  801c0c:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801c0f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801c12:	50                   	push   %eax
+  801c13:	ff 75 08             	push   0x8(%ebp)
+  801c16:	e8 9a f5 ff ff       	call   8011b5 <fd_lookup>
+  801c1b:	83 c4 10             	add    $0x10,%esp
+  801c1e:	85 c0                	test   %eax,%eax
+  801c20:	0f 88 37 01 00 00    	js     801d5d <mmap+0x15a>
+		return NULL;
+  801c26:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801c2b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801c2e:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  801c34:	39 0a                	cmp    %ecx,(%edx)
+  801c36:	0f 85 05 01 00 00    	jne    801d41 <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  801c3c:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801c43:	0f 85 1b 01 00 00    	jne    801d64 <mmap+0x161>
+  801c49:	89 f0                	mov    %esi,%eax
+  801c4b:	83 e8 01             	sub    $0x1,%eax
+  801c4e:	0f 88 17 01 00 00    	js     801d6b <mmap+0x168>
+	if (prot & PROT_WRITE)
+  801c54:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  801c58:	75 28                	jne    801c82 <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  801c5a:	83 ec 0c             	sub    $0xc,%esp
+  801c5d:	68 04 60 80 00       	push   $0x806004
+  801c62:	e8 8f 16 00 00       	call   8032f6 <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801c67:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  801c6d:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  801c73:	83 c4 10             	add    $0x10,%esp
+  801c76:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  801c7b:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  801c80:	eb 2b                	jmp    801cad <mmap+0xaa>
+		cow_enable();
+  801c82:	e8 f4 21 00 00       	call   803e7b <cow_enable>
+  801c87:	eb d1                	jmp    801c5a <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  801c89:	89 c2                	mov    %eax,%edx
+  801c8b:	c1 ea 0c             	shr    $0xc,%edx
+  801c8e:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  801c95:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801c9b:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  801ca1:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  801ca4:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  801ca6:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  801cab:	77 25                	ja     801cd2 <mmap+0xcf>
+  801cad:	89 c2                	mov    %eax,%edx
+  801caf:	29 da                	sub    %ebx,%edx
+  801cb1:	39 ca                	cmp    %ecx,%edx
+  801cb3:	73 3a                	jae    801cef <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  801cb5:	89 c2                	mov    %eax,%edx
+  801cb7:	c1 ea 16             	shr    $0x16,%edx
+  801cba:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801cc1:	f6 c2 01             	test   $0x1,%dl
+  801cc4:	75 c3                	jne    801c89 <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  801cc6:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  801ccb:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  801cd0:	eb d4                	jmp    801ca6 <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  801cd2:	29 d8                	sub    %ebx,%eax
+  801cd4:	39 c8                	cmp    %ecx,%eax
+  801cd6:	73 17                	jae    801cef <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  801cd8:	83 ec 0c             	sub    $0xc,%esp
+  801cdb:	68 04 60 80 00       	push   $0x806004
+  801ce0:	e8 7e 16 00 00       	call   803363 <mutex_unlock>
+		return NULL;
+  801ce5:	83 c4 10             	add    $0x10,%esp
+  801ce8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ced:	eb 52                	jmp    801d41 <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801cef:	85 db                	test   %ebx,%ebx
+  801cf1:	74 e5                	je     801cd8 <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801cf3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801cf6:	8b 40 0c             	mov    0xc(%eax),%eax
+  801cf9:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  801cfe:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d01:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_len = len;
+  801d06:	89 35 08 70 80 00    	mov    %esi,0x807008
+	fsipcbuf.map.req_va = va;
+  801d0c:	89 1d 0c 70 80 00    	mov    %ebx,0x80700c
+	fsipcbuf.map.req_prot = prot;
+  801d12:	8b 45 14             	mov    0x14(%ebp),%eax
+  801d15:	a3 10 70 80 00       	mov    %eax,0x807010
+	r = fsipc(FSREQ_MAP, NULL);
+  801d1a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d1f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801d24:	e8 46 fa ff ff       	call   80176f <fsipc>
+  801d29:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  801d2b:	83 ec 0c             	sub    $0xc,%esp
+  801d2e:	68 04 60 80 00       	push   $0x806004
+  801d33:	e8 2b 16 00 00       	call   803363 <mutex_unlock>
+	if (r < 0) {
+  801d38:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  801d3b:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  801d3d:	85 ff                	test   %edi,%edi
+  801d3f:	78 08                	js     801d49 <mmap+0x146>
+}
+  801d41:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d44:	5b                   	pop    %ebx
+  801d45:	5e                   	pop    %esi
+  801d46:	5f                   	pop    %edi
+  801d47:	5d                   	pop    %ebp
+  801d48:	c3                   	ret
+		munmap((void*) va, len);
+  801d49:	83 ec 08             	sub    $0x8,%esp
+  801d4c:	56                   	push   %esi
+  801d4d:	53                   	push   %ebx
+  801d4e:	e8 71 fe ff ff       	call   801bc4 <munmap>
+		return NULL;
+  801d53:	83 c4 10             	add    $0x10,%esp
+  801d56:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d5b:	eb e4                	jmp    801d41 <mmap+0x13e>
+		return NULL;
+  801d5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d62:	eb dd                	jmp    801d41 <mmap+0x13e>
+		return NULL;
+  801d64:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d69:	eb d6                	jmp    801d41 <mmap+0x13e>
+  801d6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d70:	eb cf                	jmp    801d41 <mmap+0x13e>
+
+00801d72 <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  801d72:	55                   	push   %ebp
+  801d73:	89 e5                	mov    %esp,%ebp
+  801d75:	53                   	push   %ebx
+  801d76:	83 ec 10             	sub    $0x10,%esp
+  801d79:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  801d7c:	53                   	push   %ebx
+  801d7d:	e8 9b ea ff ff       	call   80081d <strlen>
+  801d82:	83 c4 10             	add    $0x10,%esp
+  801d85:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801d8a:	7f 42                	jg     801dce <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  801d8c:	83 ec 0c             	sub    $0xc,%esp
+  801d8f:	68 04 60 80 00       	push   $0x806004
+  801d94:	e8 5d 15 00 00       	call   8032f6 <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  801d99:	83 c4 08             	add    $0x8,%esp
+  801d9c:	53                   	push   %ebx
+  801d9d:	68 00 70 80 00       	push   $0x807000
+  801da2:	e8 b1 ea ff ff       	call   800858 <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  801da7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dac:	b8 07 00 00 00       	mov    $0x7,%eax
+  801db1:	e8 b9 f9 ff ff       	call   80176f <fsipc>
+  801db6:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801db8:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801dbf:	e8 9f 15 00 00       	call   803363 <mutex_unlock>
+	return r;
+  801dc4:	83 c4 10             	add    $0x10,%esp
+}
+  801dc7:	89 d8                	mov    %ebx,%eax
+  801dc9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801dcc:	c9                   	leave
+  801dcd:	c3                   	ret
+		return -E_BAD_PATH;
+  801dce:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801dd3:	eb f2                	jmp    801dc7 <remove+0x55>
+
+00801dd5 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801dd5:	55                   	push   %ebp
+  801dd6:	89 e5                	mov    %esp,%ebp
+  801dd8:	53                   	push   %ebx
+  801dd9:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801ddc:	68 04 60 80 00       	push   $0x806004
+  801de1:	e8 10 15 00 00       	call   8032f6 <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  801de6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801deb:	b8 08 00 00 00       	mov    $0x8,%eax
+  801df0:	e8 7a f9 ff ff       	call   80176f <fsipc>
+  801df5:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801df7:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801dfe:	e8 60 15 00 00       	call   803363 <mutex_unlock>
+	return r;
+}
+  801e03:	89 d8                	mov    %ebx,%eax
+  801e05:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e08:	c9                   	leave
+  801e09:	c3                   	ret
+
+00801e0a <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  801e0a:	55                   	push   %ebp
+  801e0b:	89 e5                	mov    %esp,%ebp
+  801e0d:	56                   	push   %esi
+  801e0e:	53                   	push   %ebx
+  801e0f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801e12:	83 ec 0c             	sub    $0xc,%esp
+  801e15:	68 04 60 80 00       	push   $0x806004
+  801e1a:	e8 d7 14 00 00       	call   8032f6 <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  801e1f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e22:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  801e27:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e2c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801e31:	e8 39 f9 ff ff       	call   80176f <fsipc>
+  801e36:	89 c6                	mov    %eax,%esi
+  801e38:	83 c4 10             	add    $0x10,%esp
+  801e3b:	85 db                	test   %ebx,%ebx
+  801e3d:	74 7b                	je     801eba <fs_bcstat+0xb0>
+  801e3f:	85 c0                	test   %eax,%eax
+  801e41:	78 77                	js     801eba <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  801e43:	a1 00 70 80 00       	mov    0x807000,%eax
+  801e48:	89 03                	mov    %eax,(%ebx)
+  801e4a:	a1 04 70 80 00       	mov    0x807004,%eax
+  801e4f:	89 43 04             	mov    %eax,0x4(%ebx)
+  801e52:	a1 08 70 80 00       	mov    0x807008,%eax
+  801e57:	89 43 08             	mov    %eax,0x8(%ebx)
+  801e5a:	a1 0c 70 80 00       	mov    0x80700c,%eax
+  801e5f:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801e62:	a1 10 70 80 00       	mov    0x807010,%eax
+  801e67:	89 43 10             	mov    %eax,0x10(%ebx)
+  801e6a:	a1 14 70 80 00       	mov    0x807014,%eax
+  801e6f:	89 43 14             	mov    %eax,0x14(%ebx)
+  801e72:	a1 18 70 80 00       	mov    0x807018,%eax
+  801e77:	89 43 18             	mov    %eax,0x18(%ebx)
+  801e7a:	a1 1c 70 80 00       	mov    0x80701c,%eax
+  801e7f:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  801e82:	a1 20 70 80 00       	mov    0x807020,%eax
+  801e87:	89 43 20             	mov    %eax,0x20(%ebx)
+  801e8a:	a1 24 70 80 00       	mov    0x807024,%eax
+  801e8f:	89 43 24             	mov    %eax,0x24(%ebx)
+  801e92:	a1 28 70 80 00       	mov    0x807028,%eax
+  801e97:	89 43 28             	mov    %eax,0x28(%ebx)
+  801e9a:	a1 2c 70 80 00       	mov    0x80702c,%eax
+  801e9f:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  801ea2:	a1 30 70 80 00       	mov    0x807030,%eax
+  801ea7:	89 43 30             	mov    %eax,0x30(%ebx)
+  801eaa:	a1 34 70 80 00       	mov    0x807034,%eax
+  801eaf:	89 43 34             	mov    %eax,0x34(%ebx)
+  801eb2:	a1 38 70 80 00       	mov    0x807038,%eax
+  801eb7:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  801eba:	83 ec 0c             	sub    $0xc,%esp
+  801ebd:	68 04 60 80 00       	push   $0x806004
+  801ec2:	e8 9c 14 00 00       	call   803363 <mutex_unlock>
+	return r;
+}
+  801ec7:	89 f0                	mov    %esi,%eax
+  801ec9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ecc:	5b                   	pop    %ebx
+  801ecd:	5e                   	pop    %esi
+  801ece:	5d                   	pop    %ebp
+  801ecf:	c3                   	ret
+
+00801ed0 <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  801ed0:	55                   	push   %ebp
+  801ed1:	89 e5                	mov    %esp,%ebp
+  801ed3:	56                   	push   %esi
+  801ed4:	53                   	push   %ebx
+  801ed5:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  801ed7:	0f b6 10             	movzbl (%eax),%edx
+  801eda:	80 fa 72             	cmp    $0x72,%dl
+  801edd:	74 44                	je     801f23 <parse_mode+0x53>
+  801edf:	80 fa 77             	cmp    $0x77,%dl
+  801ee2:	74 4b                	je     801f2f <parse_mode+0x5f>
+  801ee4:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801ee9:	80 fa 61             	cmp    $0x61,%dl
+  801eec:	74 09                	je     801ef7 <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  801eee:	89 d8                	mov    %ebx,%eax
+  801ef0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ef3:	5b                   	pop    %ebx
+  801ef4:	5e                   	pop    %esi
+  801ef5:	5d                   	pop    %ebp
+  801ef6:	c3                   	ret
+	switch (mode[0]) {
+  801ef7:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  801efc:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  801f01:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  801f03:	83 ec 08             	sub    $0x8,%esp
+  801f06:	6a 2b                	push   $0x2b
+  801f08:	50                   	push   %eax
+  801f09:	e8 5c ea ff ff       	call   80096a <strchr>
+  801f0e:	83 c4 10             	add    $0x10,%esp
+  801f11:	85 c0                	test   %eax,%eax
+  801f13:	74 d9                	je     801eee <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  801f15:	83 e3 fc             	and    $0xfffffffc,%ebx
+  801f18:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  801f1b:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  801f21:	eb cb                	jmp    801eee <parse_mode+0x1e>
+	switch (mode[0]) {
+  801f23:	ba 01 00 00 00       	mov    $0x1,%edx
+  801f28:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f2d:	eb d2                	jmp    801f01 <parse_mode+0x31>
+  801f2f:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  801f34:	bb 01 03 00 00       	mov    $0x301,%ebx
+  801f39:	eb c6                	jmp    801f01 <parse_mode+0x31>
+
+00801f3b <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  801f3b:	55                   	push   %ebp
+  801f3c:	89 e5                	mov    %esp,%ebp
+  801f3e:	57                   	push   %edi
+  801f3f:	56                   	push   %esi
+  801f40:	53                   	push   %ebx
+  801f41:	83 ec 1c             	sub    $0x1c,%esp
+  801f44:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801f47:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  801f4a:	b8 24 50 80 00       	mov    $0x805024,%eax
+  801f4f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  801f54:	83 c0 24             	add    $0x24,%eax
+  801f57:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  801f5b:	74 17                	je     801f74 <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  801f5d:	83 c3 01             	add    $0x1,%ebx
+  801f60:	83 fb 10             	cmp    $0x10,%ebx
+  801f63:	75 ef                	jne    801f54 <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  801f65:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  801f6a:	89 f0                	mov    %esi,%eax
+  801f6c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f6f:	5b                   	pop    %ebx
+  801f70:	5e                   	pop    %esi
+  801f71:	5f                   	pop    %edi
+  801f72:	5d                   	pop    %ebp
+  801f73:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  801f74:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  801f7b:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801f7e:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  801f81:	c1 e7 02             	shl    $0x2,%edi
+  801f84:	8d b7 20 50 80 00    	lea    0x805020(%edi),%esi
+  801f8a:	83 ec 04             	sub    $0x4,%esp
+  801f8d:	6a 24                	push   $0x24
+  801f8f:	6a 00                	push   $0x0
+  801f91:	56                   	push   %esi
+  801f92:	e8 12 ea ff ff       	call   8009a9 <memset>
+			streams[i].f_fd = fd;
+  801f97:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801f9a:	89 8f 20 50 80 00    	mov    %ecx,0x805020(%edi)
+			streams[i].f_flags = flags;
+  801fa0:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  801fa3:	01 d8                	add    %ebx,%eax
+  801fa5:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801fa8:	89 0c 85 24 50 80 00 	mov    %ecx,0x805024(,%eax,4)
+			return &streams[i];
+  801faf:	83 c4 10             	add    $0x10,%esp
+  801fb2:	eb b6                	jmp    801f6a <stream_alloc+0x2f>
+
+00801fb4 <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  801fb4:	55                   	push   %ebp
+  801fb5:	89 e5                	mov    %esp,%ebp
+  801fb7:	53                   	push   %ebx
+  801fb8:	83 ec 14             	sub    $0x14,%esp
+  801fbb:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  801fbd:	8b 40 18             	mov    0x18(%eax),%eax
+  801fc0:	39 43 14             	cmp    %eax,0x14(%ebx)
+  801fc3:	74 4a                	je     80200f <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801fc5:	83 ec 08             	sub    $0x8,%esp
+  801fc8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fcb:	50                   	push   %eax
+  801fcc:	ff 33                	push   (%ebx)
+  801fce:	e8 e2 f1 ff ff       	call   8011b5 <fd_lookup>
+  801fd3:	89 c2                	mov    %eax,%edx
+  801fd5:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801fd8:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801fdd:	85 d2                	test   %edx,%edx
+  801fdf:	78 41                	js     802022 <stream_unread+0x6e>
+  801fe1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801fe4:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  801fea:	39 0a                	cmp    %ecx,(%edx)
+  801fec:	75 34                	jne    802022 <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  801fee:	8b 43 14             	mov    0x14(%ebx),%eax
+  801ff1:	03 42 04             	add    0x4(%edx),%eax
+  801ff4:	2b 43 18             	sub    0x18(%ebx),%eax
+  801ff7:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  801ffa:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  802001:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  802008:	b8 01 00 00 00       	mov    $0x1,%eax
+  80200d:	eb 13                	jmp    802022 <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  80200f:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  802016:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  80201d:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802022:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802025:	c9                   	leave
+  802026:	c3                   	ret
+
+00802027 <stream_drain>:
+{
+  802027:	55                   	push   %ebp
+  802028:	89 e5                	mov    %esp,%ebp
+  80202a:	56                   	push   %esi
+  80202b:	53                   	push   %ebx
+  80202c:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  80202e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802033:	eb 02                	jmp    802037 <stream_drain+0x10>
+  802035:	01 c3                	add    %eax,%ebx
+  802037:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80203a:	39 c3                	cmp    %eax,%ebx
+  80203c:	73 43                	jae    802081 <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  80203e:	83 ec 04             	sub    $0x4,%esp
+  802041:	29 d8                	sub    %ebx,%eax
+  802043:	50                   	push   %eax
+  802044:	89 d8                	mov    %ebx,%eax
+  802046:	03 46 0c             	add    0xc(%esi),%eax
+  802049:	50                   	push   %eax
+  80204a:	ff 36                	push   (%esi)
+  80204c:	e8 ec f4 ff ff       	call   80153d <write>
+  802051:	83 c4 10             	add    $0x10,%esp
+  802054:	85 c0                	test   %eax,%eax
+  802056:	7f dd                	jg     802035 <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  802058:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  80205c:	8b 56 0c             	mov    0xc(%esi),%edx
+  80205f:	83 ec 04             	sub    $0x4,%esp
+  802062:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802065:	29 d8                	sub    %ebx,%eax
+  802067:	50                   	push   %eax
+  802068:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  80206b:	50                   	push   %eax
+  80206c:	52                   	push   %edx
+  80206d:	e8 6c e9 ff ff       	call   8009de <memmove>
+			f->f_wend -= done;
+  802072:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802075:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  802077:	83 c4 10             	add    $0x10,%esp
+  80207a:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  80207f:	eb 0a                	jmp    80208b <stream_drain+0x64>
+  802081:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  802086:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  80208b:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  80208e:	89 d0                	mov    %edx,%eax
+  802090:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802093:	5b                   	pop    %ebx
+  802094:	5e                   	pop    %esi
+  802095:	5d                   	pop    %ebp
+  802096:	c3                   	ret
+
+00802097 <stream_setup>:
+	if (f->f_buf)
+  802097:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  80209b:	74 01                	je     80209e <stream_setup+0x7>
+  80209d:	c3                   	ret
+{
+  80209e:	55                   	push   %ebp
+  80209f:	89 e5                	mov    %esp,%ebp
+  8020a1:	53                   	push   %ebx
+  8020a2:	83 ec 04             	sub    $0x4,%esp
+  8020a5:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  8020a7:	8b 40 08             	mov    0x8(%eax),%eax
+  8020aa:	85 c0                	test   %eax,%eax
+  8020ac:	74 17                	je     8020c5 <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  8020ae:	83 f8 03             	cmp    $0x3,%eax
+  8020b1:	75 2d                	jne    8020e0 <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  8020b3:	8d 43 20             	lea    0x20(%ebx),%eax
+  8020b6:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  8020b9:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  8020c0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020c3:	c9                   	leave
+  8020c4:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  8020c5:	83 ec 0c             	sub    $0xc,%esp
+  8020c8:	ff 33                	push   (%ebx)
+  8020ca:	e8 29 1b 00 00       	call   803bf8 <iscons>
+  8020cf:	83 c4 10             	add    $0x10,%esp
+  8020d2:	85 c0                	test   %eax,%eax
+  8020d4:	0f 9f c0             	setg   %al
+  8020d7:	0f b6 c0             	movzbl %al,%eax
+  8020da:	83 c0 01             	add    $0x1,%eax
+  8020dd:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  8020e0:	83 ec 0c             	sub    $0xc,%esp
+  8020e3:	68 00 10 00 00       	push   $0x1000
+  8020e8:	e8 6e 0b 00 00       	call   802c5b <malloc>
+  8020ed:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8020f0:	83 c4 10             	add    $0x10,%esp
+  8020f3:	85 c0                	test   %eax,%eax
+  8020f5:	74 bc                	je     8020b3 <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  8020f7:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  8020fe:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  802102:	eb bc                	jmp    8020c0 <stream_setup+0x29>
+
+00802104 <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  802104:	55                   	push   %ebp
+  802105:	89 e5                	mov    %esp,%ebp
+  802107:	53                   	push   %ebx
+  802108:	83 ec 04             	sub    $0x4,%esp
+  80210b:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  80210d:	e8 85 ff ff ff       	call   802097 <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  802112:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  802117:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  80211b:	74 3d                	je     80215a <stream_fill+0x56>
+  80211d:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  802121:	74 10                	je     802133 <stream_fill+0x2f>
+  802123:	89 d8                	mov    %ebx,%eax
+  802125:	e8 fd fe ff ff       	call   802027 <stream_drain>
+		return 0;
+  80212a:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  80212f:	85 c0                	test   %eax,%eax
+  802131:	78 27                	js     80215a <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  802133:	83 ec 04             	sub    $0x4,%esp
+  802136:	ff 73 10             	push   0x10(%ebx)
+  802139:	ff 73 0c             	push   0xc(%ebx)
+  80213c:	ff 33                	push   (%ebx)
+  80213e:	e8 02 f3 ff ff       	call   801445 <read>
+  802143:	83 c4 10             	add    $0x10,%esp
+  802146:	85 c0                	test   %eax,%eax
+  802148:	7e 17                	jle    802161 <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  80214a:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  80214e:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  802155:	89 c2                	mov    %eax,%edx
+  802157:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  80215a:	89 d0                	mov    %edx,%eax
+  80215c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80215f:	c9                   	leave
+  802160:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802161:	c1 f8 1f             	sar    $0x1f,%eax
+  802164:	83 e0 04             	and    $0x4,%eax
+  802167:	83 c0 04             	add    $0x4,%eax
+  80216a:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  80216d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802172:	eb e6                	jmp    80215a <stream_fill+0x56>
+
+00802174 <fopen>:
+{
+  802174:	55                   	push   %ebp
+  802175:	89 e5                	mov    %esp,%ebp
+  802177:	57                   	push   %edi
+  802178:	56                   	push   %esi
+  802179:	53                   	push   %ebx
+  80217a:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  802180:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  802183:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  802189:	89 f0                	mov    %esi,%eax
+  80218b:	e8 40 fd ff ff       	call   801ed0 <parse_mode>
+		return 0;
+  802190:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  802195:	85 c0                	test   %eax,%eax
+  802197:	78 2d                	js     8021c6 <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  802199:	83 ec 08             	sub    $0x8,%esp
+  80219c:	50                   	push   %eax
+  80219d:	ff 75 08             	push   0x8(%ebp)
+  8021a0:	e8 e8 f8 ff ff       	call   801a8d <open>
+  8021a5:	89 c7                	mov    %eax,%edi
+  8021a7:	83 c4 10             	add    $0x10,%esp
+  8021aa:	85 c0                	test   %eax,%eax
+  8021ac:	78 58                	js     802206 <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  8021ae:	80 3e 61             	cmpb   $0x61,(%esi)
+  8021b1:	74 1d                	je     8021d0 <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  8021b3:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  8021b9:	89 f8                	mov    %edi,%eax
+  8021bb:	e8 7b fd ff ff       	call   801f3b <stream_alloc>
+  8021c0:	89 c3                	mov    %eax,%ebx
+  8021c2:	85 c0                	test   %eax,%eax
+  8021c4:	74 32                	je     8021f8 <fopen+0x84>
+}
+  8021c6:	89 d8                	mov    %ebx,%eax
+  8021c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021cb:	5b                   	pop    %ebx
+  8021cc:	5e                   	pop    %esi
+  8021cd:	5f                   	pop    %edi
+  8021ce:	5d                   	pop    %ebp
+  8021cf:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  8021d0:	83 ec 08             	sub    $0x8,%esp
+  8021d3:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  8021d9:	50                   	push   %eax
+  8021da:	57                   	push   %edi
+  8021db:	e8 db f4 ff ff       	call   8016bb <fstat>
+  8021e0:	83 c4 10             	add    $0x10,%esp
+  8021e3:	85 c0                	test   %eax,%eax
+  8021e5:	78 cc                	js     8021b3 <fopen+0x3f>
+		seek(fd, st.st_size);
+  8021e7:	83 ec 08             	sub    $0x8,%esp
+  8021ea:	ff 75 dc             	push   -0x24(%ebp)
+  8021ed:	57                   	push   %edi
+  8021ee:	e8 f6 f3 ff ff       	call   8015e9 <seek>
+  8021f3:	83 c4 10             	add    $0x10,%esp
+  8021f6:	eb bb                	jmp    8021b3 <fopen+0x3f>
+		close(fd);
+  8021f8:	83 ec 0c             	sub    $0xc,%esp
+  8021fb:	57                   	push   %edi
+  8021fc:	e8 08 f1 ff ff       	call   801309 <close>
+  802201:	83 c4 10             	add    $0x10,%esp
+  802204:	eb c0                	jmp    8021c6 <fopen+0x52>
+		return 0;
+  802206:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80220b:	eb b9                	jmp    8021c6 <fopen+0x52>
+
+0080220d <fdopen>:
+{
+  80220d:	55                   	push   %ebp
+  80220e:	89 e5                	mov    %esp,%ebp
+  802210:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  802213:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802216:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802219:	e8 b2 fc ff ff       	call   801ed0 <parse_mode>
+  80221e:	89 c2                	mov    %eax,%edx
+		return 0;
+  802220:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  802225:	85 d2                	test   %edx,%edx
+  802227:	78 0b                	js     802234 <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  802229:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80222c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80222f:	e8 07 fd ff ff       	call   801f3b <stream_alloc>
+}
+  802234:	c9                   	leave
+  802235:	c3                   	ret
+
+00802236 <setvbuf>:
+{
+  802236:	55                   	push   %ebp
+  802237:	89 e5                	mov    %esp,%ebp
+  802239:	57                   	push   %edi
+  80223a:	56                   	push   %esi
+  80223b:	53                   	push   %ebx
+  80223c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80223f:	8b 55 10             	mov    0x10(%ebp),%edx
+  802242:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  802245:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802249:	75 3a                	jne    802285 <setvbuf+0x4f>
+  80224b:	8d 72 ff             	lea    -0x1(%edx),%esi
+  80224e:	83 fe 02             	cmp    $0x2,%esi
+  802251:	77 39                	ja     80228c <setvbuf+0x56>
+	f->f_bufmode = mode;
+  802253:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  802256:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80225a:	0f 95 c3             	setne  %bl
+  80225d:	85 ff                	test   %edi,%edi
+  80225f:	0f 95 c1             	setne  %cl
+  802262:	84 cb                	test   %cl,%bl
+  802264:	74 05                	je     80226b <setvbuf+0x35>
+  802266:	83 fa 03             	cmp    $0x3,%edx
+  802269:	75 0a                	jne    802275 <setvbuf+0x3f>
+	return 0;
+  80226b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802270:	5b                   	pop    %ebx
+  802271:	5e                   	pop    %esi
+  802272:	5f                   	pop    %edi
+  802273:	5d                   	pop    %ebp
+  802274:	c3                   	ret
+		f->f_buf = buf;
+  802275:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802278:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  80227b:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  80227e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802283:	eb eb                	jmp    802270 <setvbuf+0x3a>
+		return EOF;
+  802285:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80228a:	eb e4                	jmp    802270 <setvbuf+0x3a>
+  80228c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802291:	eb dd                	jmp    802270 <setvbuf+0x3a>
+
+00802293 <fflush>:
+{
+  802293:	55                   	push   %ebp
+  802294:	89 e5                	mov    %esp,%ebp
+  802296:	57                   	push   %edi
+  802297:	56                   	push   %esi
+  802298:	53                   	push   %ebx
+  802299:	83 ec 0c             	sub    $0xc,%esp
+  80229c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  80229f:	85 db                	test   %ebx,%ebx
+  8022a1:	74 1a                	je     8022bd <fflush+0x2a>
+	stream_unread(f);
+  8022a3:	89 d8                	mov    %ebx,%eax
+  8022a5:	e8 0a fd ff ff       	call   801fb4 <stream_unread>
+	return stream_drain(f);
+  8022aa:	89 d8                	mov    %ebx,%eax
+  8022ac:	e8 76 fd ff ff       	call   802027 <stream_drain>
+  8022b1:	89 c7                	mov    %eax,%edi
+}
+  8022b3:	89 f8                	mov    %edi,%eax
+  8022b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022b8:	5b                   	pop    %ebx
+  8022b9:	5e                   	pop    %esi
+  8022ba:	5f                   	pop    %edi
+  8022bb:	5d                   	pop    %ebp
+  8022bc:	c3                   	ret
+  8022bd:	bb 20 50 80 00       	mov    $0x805020,%ebx
+  8022c2:	be 60 52 80 00       	mov    $0x805260,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  8022c7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022cc:	eb 03                	jmp    8022d1 <fflush+0x3e>
+  8022ce:	83 c3 24             	add    $0x24,%ebx
+  8022d1:	39 f3                	cmp    %esi,%ebx
+  8022d3:	74 de                	je     8022b3 <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  8022d5:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  8022d9:	74 f3                	je     8022ce <fflush+0x3b>
+  8022db:	83 ec 0c             	sub    $0xc,%esp
+  8022de:	53                   	push   %ebx
+  8022df:	e8 af ff ff ff       	call   802293 <fflush>
+  8022e4:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  8022e7:	85 c0                	test   %eax,%eax
+  8022e9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8022ee:	0f 48 f8             	cmovs  %eax,%edi
+  8022f1:	eb db                	jmp    8022ce <fflush+0x3b>
+
+008022f3 <fclose>:
+{
+  8022f3:	55                   	push   %ebp
+  8022f4:	89 e5                	mov    %esp,%ebp
+  8022f6:	56                   	push   %esi
+  8022f7:	53                   	push   %ebx
+  8022f8:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  8022fb:	83 ec 0c             	sub    $0xc,%esp
+  8022fe:	56                   	push   %esi
+  8022ff:	e8 8f ff ff ff       	call   802293 <fflush>
+  802304:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  802306:	83 c4 04             	add    $0x4,%esp
+  802309:	ff 36                	push   (%esi)
+  80230b:	e8 f9 ef ff ff       	call   801309 <close>
+  802310:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  802313:	85 c0                	test   %eax,%eax
+  802315:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80231a:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  80231d:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  802321:	75 10                	jne    802333 <fclose+0x40>
+	f->f_flags = 0;
+  802323:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  80232a:	89 d8                	mov    %ebx,%eax
+  80232c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80232f:	5b                   	pop    %ebx
+  802330:	5e                   	pop    %esi
+  802331:	5d                   	pop    %ebp
+  802332:	c3                   	ret
+		free(f->f_buf);
+  802333:	83 ec 0c             	sub    $0xc,%esp
+  802336:	ff 76 0c             	push   0xc(%esi)
+  802339:	e8 54 08 00 00       	call   802b92 <free>
+  80233e:	83 c4 10             	add    $0x10,%esp
+  802341:	eb e0                	jmp    802323 <fclose+0x30>
+
+00802343 <fileno>:
+{
+  802343:	55                   	push   %ebp
+  802344:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  802346:	8b 45 08             	mov    0x8(%ebp),%eax
+  802349:	8b 00                	mov    (%eax),%eax
+}
+  80234b:	5d                   	pop    %ebp
+  80234c:	c3                   	ret
+
+0080234d <feof>:
+{
+  80234d:	55                   	push   %ebp
+  80234e:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  802350:	8b 45 08             	mov    0x8(%ebp),%eax
+  802353:	8b 40 04             	mov    0x4(%eax),%eax
+  802356:	c1 e8 02             	shr    $0x2,%eax
+  802359:	83 e0 01             	and    $0x1,%eax
+}
+  80235c:	5d                   	pop    %ebp
+  80235d:	c3                   	ret
+
+0080235e <ferror>:
+{
+  80235e:	55                   	push   %ebp
+  80235f:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  802361:	8b 45 08             	mov    0x8(%ebp),%eax
+  802364:	8b 40 04             	mov    0x4(%eax),%eax
+  802367:	c1 e8 03             	shr    $0x3,%eax
+  80236a:	83 e0 01             	and    $0x1,%eax
+}
+  80236d:	5d                   	pop    %ebp
+  80236e:	c3                   	ret
+
+0080236f <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  80236f:	55                   	push   %ebp
+  802370:	89 e5                	mov    %esp,%ebp
+  802372:	53                   	push   %ebx
+  802373:	83 ec 04             	sub    $0x4,%esp
+  802376:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802379:	8b 43 18             	mov    0x18(%ebx),%eax
+  80237c:	39 43 14             	cmp    %eax,0x14(%ebx)
+  80237f:	74 15                	je     802396 <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  802381:	8b 53 0c             	mov    0xc(%ebx),%edx
+  802384:	8b 43 14             	mov    0x14(%ebx),%eax
+  802387:	8d 48 01             	lea    0x1(%eax),%ecx
+  80238a:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  80238d:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  802391:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802394:	c9                   	leave
+  802395:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802396:	89 d8                	mov    %ebx,%eax
+  802398:	e8 67 fd ff ff       	call   802104 <stream_fill>
+  80239d:	85 c0                	test   %eax,%eax
+  80239f:	75 e0                	jne    802381 <fgetc+0x12>
+		return EOF;
+  8023a1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8023a6:	eb e9                	jmp    802391 <fgetc+0x22>
+
+008023a8 <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  8023a8:	55                   	push   %ebp
+  8023a9:	89 e5                	mov    %esp,%ebp
+  8023ab:	57                   	push   %edi
+  8023ac:	56                   	push   %esi
+  8023ad:	53                   	push   %ebx
+  8023ae:	83 ec 1c             	sub    $0x1c,%esp
+  8023b1:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  8023b4:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  8023b9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023bc:	83 e8 01             	sub    $0x1,%eax
+  8023bf:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  8023c2:	eb 66                	jmp    80242a <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  8023c4:	8b 46 14             	mov    0x14(%esi),%eax
+  8023c7:	8b 5e 18             	mov    0x18(%esi),%ebx
+  8023ca:	29 c3                	sub    %eax,%ebx
+  8023cc:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8023cf:	29 fa                	sub    %edi,%edx
+  8023d1:	39 d3                	cmp    %edx,%ebx
+  8023d3:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  8023d6:	83 ec 04             	sub    $0x4,%esp
+  8023d9:	53                   	push   %ebx
+  8023da:	6a 0a                	push   $0xa
+  8023dc:	03 46 0c             	add    0xc(%esi),%eax
+  8023df:	50                   	push   %eax
+  8023e0:	e8 aa e6 ff ff       	call   800a8f <memfind>
+  8023e5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  8023e8:	8b 46 0c             	mov    0xc(%esi),%eax
+  8023eb:	8b 4e 14             	mov    0x14(%esi),%ecx
+  8023ee:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  8023f1:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  8023f3:	83 c4 10             	add    $0x10,%esp
+  8023f6:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  8023f9:	74 0b                	je     802406 <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  8023fb:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8023fe:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802401:	29 d3                	sub    %edx,%ebx
+  802403:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  802406:	83 ec 04             	sub    $0x4,%esp
+  802409:	53                   	push   %ebx
+  80240a:	01 c8                	add    %ecx,%eax
+  80240c:	50                   	push   %eax
+  80240d:	89 f8                	mov    %edi,%eax
+  80240f:	03 45 08             	add    0x8(%ebp),%eax
+  802412:	50                   	push   %eax
+  802413:	e8 c6 e5 ff ff       	call   8009de <memmove>
+		f->f_rpos += m;
+  802418:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  80241b:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  80241d:	83 c4 10             	add    $0x10,%esp
+  802420:	8b 45 08             	mov    0x8(%ebp),%eax
+  802423:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  802428:	74 1f                	je     802449 <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  80242a:	8d 47 01             	lea    0x1(%edi),%eax
+  80242d:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  802430:	73 17                	jae    802449 <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802432:	8b 46 18             	mov    0x18(%esi),%eax
+  802435:	39 46 14             	cmp    %eax,0x14(%esi)
+  802438:	75 8a                	jne    8023c4 <fgets+0x1c>
+  80243a:	89 f0                	mov    %esi,%eax
+  80243c:	e8 c3 fc ff ff       	call   802104 <stream_fill>
+  802441:	85 c0                	test   %eax,%eax
+  802443:	0f 85 7b ff ff ff    	jne    8023c4 <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  802449:	85 ff                	test   %edi,%edi
+  80244b:	74 0f                	je     80245c <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  80244d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802450:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  802454:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802457:	5b                   	pop    %ebx
+  802458:	5e                   	pop    %esi
+  802459:	5f                   	pop    %edi
+  80245a:	5d                   	pop    %ebp
+  80245b:	c3                   	ret
+		return 0;
+  80245c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802461:	eb f1                	jmp    802454 <fgets+0xac>
+
+00802463 <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  802463:	55                   	push   %ebp
+  802464:	89 e5                	mov    %esp,%ebp
+  802466:	57                   	push   %edi
+  802467:	56                   	push   %esi
+  802468:	53                   	push   %ebx
+  802469:	83 ec 1c             	sub    $0x1c,%esp
+  80246c:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  80246f:	89 f0                	mov    %esi,%eax
+  802471:	e8 21 fc ff ff       	call   802097 <stream_setup>
+	want = size * n;
+  802476:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802479:	0f af 45 10          	imul   0x10(%ebp),%eax
+  80247d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  802480:	bf 00 00 00 00       	mov    $0x0,%edi
+  802485:	eb 43                	jmp    8024ca <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  802487:	29 d3                	sub    %edx,%ebx
+  802489:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80248c:	29 f8                	sub    %edi,%eax
+  80248e:	39 c3                	cmp    %eax,%ebx
+  802490:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  802493:	83 ec 04             	sub    $0x4,%esp
+  802496:	53                   	push   %ebx
+  802497:	03 56 0c             	add    0xc(%esi),%edx
+  80249a:	52                   	push   %edx
+  80249b:	89 f8                	mov    %edi,%eax
+  80249d:	03 45 08             	add    0x8(%ebp),%eax
+  8024a0:	50                   	push   %eax
+  8024a1:	e8 38 e5 ff ff       	call   8009de <memmove>
+			f->f_rpos += m;
+  8024a6:	01 5e 14             	add    %ebx,0x14(%esi)
+  8024a9:	83 c4 10             	add    $0x10,%esp
+  8024ac:	eb 1a                	jmp    8024c8 <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  8024ae:	83 ec 04             	sub    $0x4,%esp
+  8024b1:	53                   	push   %ebx
+  8024b2:	89 f8                	mov    %edi,%eax
+  8024b4:	03 45 08             	add    0x8(%ebp),%eax
+  8024b7:	50                   	push   %eax
+  8024b8:	ff 36                	push   (%esi)
+  8024ba:	e8 86 ef ff ff       	call   801445 <read>
+  8024bf:	89 c3                	mov    %eax,%ebx
+  8024c1:	83 c4 10             	add    $0x10,%esp
+  8024c4:	85 c0                	test   %eax,%eax
+  8024c6:	7e 36                	jle    8024fe <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  8024c8:	01 df                	add    %ebx,%edi
+  8024ca:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8024cd:	39 c7                	cmp    %eax,%edi
+  8024cf:	73 39                	jae    80250a <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  8024d1:	8b 56 14             	mov    0x14(%esi),%edx
+  8024d4:	8b 5e 18             	mov    0x18(%esi),%ebx
+  8024d7:	39 da                	cmp    %ebx,%edx
+  8024d9:	72 ac                	jb     802487 <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  8024db:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8024de:	29 fb                	sub    %edi,%ebx
+  8024e0:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  8024e3:	72 3e                	jb     802523 <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  8024e5:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  8024e9:	74 1f                	je     80250a <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  8024eb:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  8024ef:	74 bd                	je     8024ae <fread+0x4b>
+  8024f1:	89 f0                	mov    %esi,%eax
+  8024f3:	e8 2f fb ff ff       	call   802027 <stream_drain>
+  8024f8:	85 c0                	test   %eax,%eax
+  8024fa:	79 b2                	jns    8024ae <fread+0x4b>
+  8024fc:	eb 0c                	jmp    80250a <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  8024fe:	c1 fb 1f             	sar    $0x1f,%ebx
+  802501:	83 e3 04             	and    $0x4,%ebx
+  802504:	83 c3 04             	add    $0x4,%ebx
+  802507:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  80250a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80250d:	85 c0                	test   %eax,%eax
+  80250f:	74 0a                	je     80251b <fread+0xb8>
+  802511:	89 f8                	mov    %edi,%eax
+  802513:	ba 00 00 00 00       	mov    $0x0,%edx
+  802518:	f7 75 0c             	divl   0xc(%ebp)
+}
+  80251b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80251e:	5b                   	pop    %ebx
+  80251f:	5e                   	pop    %esi
+  802520:	5f                   	pop    %edi
+  802521:	5d                   	pop    %ebp
+  802522:	c3                   	ret
+		} else if (!stream_fill(f))
+  802523:	89 f0                	mov    %esi,%eax
+  802525:	e8 da fb ff ff       	call   802104 <stream_fill>
+  80252a:	85 c0                	test   %eax,%eax
+  80252c:	74 dc                	je     80250a <fread+0xa7>
+			m = 0;
+  80252e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802533:	eb 93                	jmp    8024c8 <fread+0x65>
+
+00802535 <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  802535:	55                   	push   %ebp
+  802536:	89 e5                	mov    %esp,%ebp
+  802538:	57                   	push   %edi
+  802539:	56                   	push   %esi
+  80253a:	53                   	push   %ebx
+  80253b:	83 ec 1c             	sub    $0x1c,%esp
+  80253e:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  802541:	8b 43 04             	mov    0x4(%ebx),%eax
+  802544:	a8 02                	test   $0x2,%al
+  802546:	75 13                	jne    80255b <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  802548:	83 c8 08             	or     $0x8,%eax
+  80254b:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  80254e:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  802553:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802556:	5b                   	pop    %ebx
+  802557:	5e                   	pop    %esi
+  802558:	5f                   	pop    %edi
+  802559:	5d                   	pop    %ebp
+  80255a:	c3                   	ret
+	stream_setup(f);
+  80255b:	89 d8                	mov    %ebx,%eax
+  80255d:	e8 35 fb ff ff       	call   802097 <stream_setup>
+	want = size * n;
+  802562:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802565:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802569:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  80256c:	89 d8                	mov    %ebx,%eax
+  80256e:	e8 41 fa ff ff       	call   801fb4 <stream_unread>
+	for (done = 0; done < want; ) {
+  802573:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  802578:	84 c0                	test   %al,%al
+  80257a:	75 7b                	jne    8025f7 <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  80257c:	be 00 00 00 00       	mov    $0x0,%esi
+  802581:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802584:	39 fe                	cmp    %edi,%esi
+  802586:	73 24                	jae    8025ac <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802588:	83 ec 04             	sub    $0x4,%esp
+  80258b:	89 f8                	mov    %edi,%eax
+  80258d:	29 f0                	sub    %esi,%eax
+  80258f:	50                   	push   %eax
+  802590:	89 f0                	mov    %esi,%eax
+  802592:	03 45 08             	add    0x8(%ebp),%eax
+  802595:	50                   	push   %eax
+  802596:	ff 33                	push   (%ebx)
+  802598:	e8 a0 ef ff ff       	call   80153d <write>
+  80259d:	83 c4 10             	add    $0x10,%esp
+  8025a0:	85 c0                	test   %eax,%eax
+  8025a2:	7e 04                	jle    8025a8 <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  8025a4:	01 c6                	add    %eax,%esi
+  8025a6:	eb dc                	jmp    802584 <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  8025a8:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  8025ac:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025af:	85 c0                	test   %eax,%eax
+  8025b1:	74 a0                	je     802553 <fwrite+0x1e>
+  8025b3:	89 f0                	mov    %esi,%eax
+  8025b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025ba:	f7 75 0c             	divl   0xc(%ebp)
+  8025bd:	eb 94                	jmp    802553 <fwrite+0x1e>
+			done += r;
+  8025bf:	01 c7                	add    %eax,%edi
+			continue;
+  8025c1:	eb 34                	jmp    8025f7 <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  8025c3:	8b 73 10             	mov    0x10(%ebx),%esi
+  8025c6:	29 c6                	sub    %eax,%esi
+  8025c8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8025cb:	29 fa                	sub    %edi,%edx
+  8025cd:	39 d6                	cmp    %edx,%esi
+  8025cf:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  8025d2:	83 ec 04             	sub    $0x4,%esp
+  8025d5:	56                   	push   %esi
+  8025d6:	89 fa                	mov    %edi,%edx
+  8025d8:	03 55 08             	add    0x8(%ebp),%edx
+  8025db:	52                   	push   %edx
+  8025dc:	03 43 0c             	add    0xc(%ebx),%eax
+  8025df:	50                   	push   %eax
+  8025e0:	e8 f9 e3 ff ff       	call   8009de <memmove>
+		f->f_wend += m;
+  8025e5:	89 f0                	mov    %esi,%eax
+  8025e7:	03 43 1c             	add    0x1c(%ebx),%eax
+  8025ea:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  8025ed:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  8025ef:	83 c4 10             	add    $0x10,%esp
+  8025f2:	3b 43 10             	cmp    0x10(%ebx),%eax
+  8025f5:	74 5b                	je     802652 <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  8025f7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8025fa:	39 c7                	cmp    %eax,%edi
+  8025fc:	73 2d                	jae    80262b <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  8025fe:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802601:	85 c0                	test   %eax,%eax
+  802603:	75 be                	jne    8025c3 <fwrite+0x8e>
+  802605:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802608:	29 fa                	sub    %edi,%edx
+  80260a:	3b 53 10             	cmp    0x10(%ebx),%edx
+  80260d:	72 b4                	jb     8025c3 <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  80260f:	83 ec 04             	sub    $0x4,%esp
+  802612:	52                   	push   %edx
+  802613:	89 f8                	mov    %edi,%eax
+  802615:	03 45 08             	add    0x8(%ebp),%eax
+  802618:	50                   	push   %eax
+  802619:	ff 33                	push   (%ebx)
+  80261b:	e8 1d ef ff ff       	call   80153d <write>
+  802620:	83 c4 10             	add    $0x10,%esp
+  802623:	85 c0                	test   %eax,%eax
+  802625:	7f 98                	jg     8025bf <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  802627:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  80262b:	8b 43 08             	mov    0x8(%ebx),%eax
+  80262e:	83 f8 03             	cmp    $0x3,%eax
+  802631:	74 48                	je     80267b <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802633:	83 f8 02             	cmp    $0x2,%eax
+  802636:	74 27                	je     80265f <fwrite+0x12a>
+	return size ? done / size : 0;
+  802638:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80263b:	85 c0                	test   %eax,%eax
+  80263d:	0f 84 10 ff ff ff    	je     802553 <fwrite+0x1e>
+  802643:	89 f8                	mov    %edi,%eax
+  802645:	ba 00 00 00 00       	mov    $0x0,%edx
+  80264a:	f7 75 0c             	divl   0xc(%ebp)
+  80264d:	e9 01 ff ff ff       	jmp    802553 <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802652:	89 d8                	mov    %ebx,%eax
+  802654:	e8 ce f9 ff ff       	call   802027 <stream_drain>
+  802659:	85 c0                	test   %eax,%eax
+  80265b:	79 9a                	jns    8025f7 <fwrite+0xc2>
+  80265d:	eb cc                	jmp    80262b <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  80265f:	83 ec 04             	sub    $0x4,%esp
+  802662:	57                   	push   %edi
+  802663:	6a 0a                	push   $0xa
+  802665:	ff 75 08             	push   0x8(%ebp)
+  802668:	e8 22 e4 ff ff       	call   800a8f <memfind>
+  80266d:	89 c2                	mov    %eax,%edx
+  80266f:	89 f8                	mov    %edi,%eax
+  802671:	03 45 08             	add    0x8(%ebp),%eax
+  802674:	83 c4 10             	add    $0x10,%esp
+  802677:	39 c2                	cmp    %eax,%edx
+  802679:	74 bd                	je     802638 <fwrite+0x103>
+		stream_drain(f);
+  80267b:	89 d8                	mov    %ebx,%eax
+  80267d:	e8 a5 f9 ff ff       	call   802027 <stream_drain>
+  802682:	eb b4                	jmp    802638 <fwrite+0x103>
+
+00802684 <fputc>:
+{
+  802684:	55                   	push   %ebp
+  802685:	89 e5                	mov    %esp,%ebp
+  802687:	53                   	push   %ebx
+  802688:	83 ec 14             	sub    $0x14,%esp
+  80268b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  80268e:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  802691:	ff 75 0c             	push   0xc(%ebp)
+  802694:	6a 01                	push   $0x1
+  802696:	6a 01                	push   $0x1
+  802698:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80269b:	50                   	push   %eax
+  80269c:	e8 94 fe ff ff       	call   802535 <fwrite>
+  8026a1:	83 c4 10             	add    $0x10,%esp
+  8026a4:	0f b6 db             	movzbl %bl,%ebx
+  8026a7:	83 f8 01             	cmp    $0x1,%eax
+  8026aa:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8026af:	0f 44 c3             	cmove  %ebx,%eax
+}
+  8026b2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026b5:	c9                   	leave
+  8026b6:	c3                   	ret
+
+008026b7 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  8026b7:	55                   	push   %ebp
+  8026b8:	89 e5                	mov    %esp,%ebp
+  8026ba:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  8026bd:	ff 75 0c             	push   0xc(%ebp)
+  8026c0:	ff 75 08             	push   0x8(%ebp)
+  8026c3:	e8 bc ff ff ff       	call   802684 <fputc>
+}
+  8026c8:	83 c4 10             	add    $0x10,%esp
+  8026cb:	c9                   	leave
+  8026cc:	c3                   	ret
+
+008026cd <fputs>:
+{
+  8026cd:	55                   	push   %ebp
+  8026ce:	89 e5                	mov    %esp,%ebp
+  8026d0:	56                   	push   %esi
+  8026d1:	53                   	push   %ebx
+  8026d2:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  8026d5:	83 ec 0c             	sub    $0xc,%esp
+  8026d8:	56                   	push   %esi
+  8026d9:	e8 3f e1 ff ff       	call   80081d <strlen>
+  8026de:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  8026e0:	ff 75 0c             	push   0xc(%ebp)
+  8026e3:	50                   	push   %eax
+  8026e4:	6a 01                	push   $0x1
+  8026e6:	56                   	push   %esi
+  8026e7:	e8 49 fe ff ff       	call   802535 <fwrite>
+  8026ec:	83 c4 20             	add    $0x20,%esp
+  8026ef:	39 d8                	cmp    %ebx,%eax
+  8026f1:	0f 95 c0             	setne  %al
+  8026f4:	0f b6 c0             	movzbl %al,%eax
+  8026f7:	f7 d8                	neg    %eax
+}
+  8026f9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026fc:	5b                   	pop    %ebx
+  8026fd:	5e                   	pop    %esi
+  8026fe:	5d                   	pop    %ebp
+  8026ff:	c3                   	ret
+
+00802700 <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  802700:	55                   	push   %ebp
+  802701:	89 e5                	mov    %esp,%ebp
+  802703:	53                   	push   %ebx
+  802704:	83 ec 04             	sub    $0x4,%esp
+  802707:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80270a:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  80270d:	50                   	push   %eax
+  80270e:	ff 75 0c             	push   0xc(%ebp)
+  802711:	53                   	push   %ebx
+  802712:	68 b7 26 80 00       	push   $0x8026b7
+  802717:	e8 4f dc ff ff       	call   80036b <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  80271c:	8b 43 04             	mov    0x4(%ebx),%eax
+  80271f:	c1 e0 1c             	shl    $0x1c,%eax
+  802722:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  802725:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802728:	c9                   	leave
+  802729:	c3                   	ret
+
+0080272a <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80272a:	55                   	push   %ebp
+  80272b:	89 e5                	mov    %esp,%ebp
+  80272d:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802730:	68 78 4c 80 00       	push   $0x804c78
+  802735:	ff 75 0c             	push   0xc(%ebp)
+  802738:	e8 1b e1 ff ff       	call   800858 <strcpy>
+	return 0;
+}
+  80273d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802742:	c9                   	leave
+  802743:	c3                   	ret
+
+00802744 <devsock_close>:
+{
+  802744:	55                   	push   %ebp
+  802745:	89 e5                	mov    %esp,%ebp
+  802747:	53                   	push   %ebx
+  802748:	83 ec 10             	sub    $0x10,%esp
+  80274b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  80274e:	53                   	push   %ebx
+  80274f:	e8 23 1d 00 00       	call   804477 <pageref>
+  802754:	89 c2                	mov    %eax,%edx
+  802756:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802759:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  80275e:	83 fa 01             	cmp    $0x1,%edx
+  802761:	74 05                	je     802768 <devsock_close+0x24>
+}
+  802763:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802766:	c9                   	leave
+  802767:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802768:	83 ec 0c             	sub    $0xc,%esp
+  80276b:	ff 73 0c             	push   0xc(%ebx)
+  80276e:	e8 b7 02 00 00       	call   802a2a <nsipc_close>
+  802773:	83 c4 10             	add    $0x10,%esp
+  802776:	eb eb                	jmp    802763 <devsock_close+0x1f>
+
+00802778 <devsock_write>:
+{
+  802778:	55                   	push   %ebp
+  802779:	89 e5                	mov    %esp,%ebp
+  80277b:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  80277e:	6a 00                	push   $0x0
+  802780:	ff 75 10             	push   0x10(%ebp)
+  802783:	ff 75 0c             	push   0xc(%ebp)
+  802786:	8b 45 08             	mov    0x8(%ebp),%eax
+  802789:	ff 70 0c             	push   0xc(%eax)
+  80278c:	e8 79 03 00 00       	call   802b0a <nsipc_send>
+}
+  802791:	c9                   	leave
+  802792:	c3                   	ret
+
+00802793 <devsock_read>:
+{
+  802793:	55                   	push   %ebp
+  802794:	89 e5                	mov    %esp,%ebp
+  802796:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802799:	6a 00                	push   $0x0
+  80279b:	ff 75 10             	push   0x10(%ebp)
+  80279e:	ff 75 0c             	push   0xc(%ebp)
+  8027a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027a4:	ff 70 0c             	push   0xc(%eax)
+  8027a7:	e8 ef 02 00 00       	call   802a9b <nsipc_recv>
+}
+  8027ac:	c9                   	leave
+  8027ad:	c3                   	ret
+
+008027ae <fd2sockid>:
+{
+  8027ae:	55                   	push   %ebp
+  8027af:	89 e5                	mov    %esp,%ebp
+  8027b1:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8027b4:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8027b7:	52                   	push   %edx
+  8027b8:	50                   	push   %eax
+  8027b9:	e8 f7 e9 ff ff       	call   8011b5 <fd_lookup>
+  8027be:	83 c4 10             	add    $0x10,%esp
+  8027c1:	85 c0                	test   %eax,%eax
+  8027c3:	78 10                	js     8027d5 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8027c5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027c8:	8b 0d 60 52 80 00    	mov    0x805260,%ecx
+  8027ce:	39 08                	cmp    %ecx,(%eax)
+  8027d0:	75 05                	jne    8027d7 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8027d2:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8027d5:	c9                   	leave
+  8027d6:	c3                   	ret
+		return -E_NOT_SUPP;
+  8027d7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8027dc:	eb f7                	jmp    8027d5 <fd2sockid+0x27>
+
+008027de <alloc_sockfd>:
+{
+  8027de:	55                   	push   %ebp
+  8027df:	89 e5                	mov    %esp,%ebp
+  8027e1:	56                   	push   %esi
+  8027e2:	53                   	push   %ebx
+  8027e3:	83 ec 1c             	sub    $0x1c,%esp
+  8027e6:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8027e8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8027eb:	50                   	push   %eax
+  8027ec:	e8 6e e9 ff ff       	call   80115f <fd_alloc>
+  8027f1:	89 c3                	mov    %eax,%ebx
+  8027f3:	83 c4 10             	add    $0x10,%esp
+  8027f6:	85 c0                	test   %eax,%eax
+  8027f8:	78 43                	js     80283d <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8027fa:	83 ec 04             	sub    $0x4,%esp
+  8027fd:	68 07 04 00 00       	push   $0x407
+  802802:	ff 75 f4             	push   -0xc(%ebp)
+  802805:	6a 00                	push   $0x0
+  802807:	e8 8a e4 ff ff       	call   800c96 <sys_page_alloc>
+  80280c:	89 c3                	mov    %eax,%ebx
+  80280e:	83 c4 10             	add    $0x10,%esp
+  802811:	85 c0                	test   %eax,%eax
+  802813:	78 28                	js     80283d <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802815:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802818:	8b 15 60 52 80 00    	mov    0x805260,%edx
+  80281e:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802820:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802823:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80282a:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  80282d:	83 ec 0c             	sub    $0xc,%esp
+  802830:	50                   	push   %eax
+  802831:	e8 02 e9 ff ff       	call   801138 <fd2num>
+  802836:	89 c3                	mov    %eax,%ebx
+  802838:	83 c4 10             	add    $0x10,%esp
+  80283b:	eb 0c                	jmp    802849 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  80283d:	83 ec 0c             	sub    $0xc,%esp
+  802840:	56                   	push   %esi
+  802841:	e8 e4 01 00 00       	call   802a2a <nsipc_close>
+		return r;
+  802846:	83 c4 10             	add    $0x10,%esp
+}
+  802849:	89 d8                	mov    %ebx,%eax
+  80284b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80284e:	5b                   	pop    %ebx
+  80284f:	5e                   	pop    %esi
+  802850:	5d                   	pop    %ebp
+  802851:	c3                   	ret
+
+00802852 <accept>:
+{
+  802852:	55                   	push   %ebp
+  802853:	89 e5                	mov    %esp,%ebp
+  802855:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802858:	8b 45 08             	mov    0x8(%ebp),%eax
+  80285b:	e8 4e ff ff ff       	call   8027ae <fd2sockid>
+  802860:	85 c0                	test   %eax,%eax
+  802862:	78 1b                	js     80287f <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802864:	83 ec 04             	sub    $0x4,%esp
+  802867:	ff 75 10             	push   0x10(%ebp)
+  80286a:	ff 75 0c             	push   0xc(%ebp)
+  80286d:	50                   	push   %eax
+  80286e:	e8 0e 01 00 00       	call   802981 <nsipc_accept>
+  802873:	83 c4 10             	add    $0x10,%esp
+  802876:	85 c0                	test   %eax,%eax
+  802878:	78 05                	js     80287f <accept+0x2d>
+	return alloc_sockfd(r);
+  80287a:	e8 5f ff ff ff       	call   8027de <alloc_sockfd>
+}
+  80287f:	c9                   	leave
+  802880:	c3                   	ret
+
+00802881 <bind>:
+{
+  802881:	55                   	push   %ebp
+  802882:	89 e5                	mov    %esp,%ebp
+  802884:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802887:	8b 45 08             	mov    0x8(%ebp),%eax
+  80288a:	e8 1f ff ff ff       	call   8027ae <fd2sockid>
+  80288f:	85 c0                	test   %eax,%eax
+  802891:	78 12                	js     8028a5 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802893:	83 ec 04             	sub    $0x4,%esp
+  802896:	ff 75 10             	push   0x10(%ebp)
+  802899:	ff 75 0c             	push   0xc(%ebp)
+  80289c:	50                   	push   %eax
+  80289d:	e8 31 01 00 00       	call   8029d3 <nsipc_bind>
+  8028a2:	83 c4 10             	add    $0x10,%esp
+}
+  8028a5:	c9                   	leave
+  8028a6:	c3                   	ret
+
+008028a7 <shutdown>:
+{
+  8028a7:	55                   	push   %ebp
+  8028a8:	89 e5                	mov    %esp,%ebp
+  8028aa:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8028ad:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028b0:	e8 f9 fe ff ff       	call   8027ae <fd2sockid>
+  8028b5:	85 c0                	test   %eax,%eax
+  8028b7:	78 0f                	js     8028c8 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8028b9:	83 ec 08             	sub    $0x8,%esp
+  8028bc:	ff 75 0c             	push   0xc(%ebp)
+  8028bf:	50                   	push   %eax
+  8028c0:	e8 43 01 00 00       	call   802a08 <nsipc_shutdown>
+  8028c5:	83 c4 10             	add    $0x10,%esp
+}
+  8028c8:	c9                   	leave
+  8028c9:	c3                   	ret
+
+008028ca <connect>:
+{
+  8028ca:	55                   	push   %ebp
+  8028cb:	89 e5                	mov    %esp,%ebp
+  8028cd:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8028d0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028d3:	e8 d6 fe ff ff       	call   8027ae <fd2sockid>
+  8028d8:	85 c0                	test   %eax,%eax
+  8028da:	78 12                	js     8028ee <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8028dc:	83 ec 04             	sub    $0x4,%esp
+  8028df:	ff 75 10             	push   0x10(%ebp)
+  8028e2:	ff 75 0c             	push   0xc(%ebp)
+  8028e5:	50                   	push   %eax
+  8028e6:	e8 59 01 00 00       	call   802a44 <nsipc_connect>
+  8028eb:	83 c4 10             	add    $0x10,%esp
+}
+  8028ee:	c9                   	leave
+  8028ef:	c3                   	ret
+
+008028f0 <listen>:
+{
+  8028f0:	55                   	push   %ebp
+  8028f1:	89 e5                	mov    %esp,%ebp
+  8028f3:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8028f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028f9:	e8 b0 fe ff ff       	call   8027ae <fd2sockid>
+  8028fe:	85 c0                	test   %eax,%eax
+  802900:	78 0f                	js     802911 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802902:	83 ec 08             	sub    $0x8,%esp
+  802905:	ff 75 0c             	push   0xc(%ebp)
+  802908:	50                   	push   %eax
+  802909:	e8 6b 01 00 00       	call   802a79 <nsipc_listen>
+  80290e:	83 c4 10             	add    $0x10,%esp
+}
+  802911:	c9                   	leave
+  802912:	c3                   	ret
+
+00802913 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802913:	55                   	push   %ebp
+  802914:	89 e5                	mov    %esp,%ebp
+  802916:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802919:	ff 75 10             	push   0x10(%ebp)
+  80291c:	ff 75 0c             	push   0xc(%ebp)
+  80291f:	ff 75 08             	push   0x8(%ebp)
+  802922:	e8 41 02 00 00       	call   802b68 <nsipc_socket>
+  802927:	83 c4 10             	add    $0x10,%esp
+  80292a:	85 c0                	test   %eax,%eax
+  80292c:	78 05                	js     802933 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  80292e:	e8 ab fe ff ff       	call   8027de <alloc_sockfd>
+}
+  802933:	c9                   	leave
+  802934:	c3                   	ret
+
+00802935 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802935:	55                   	push   %ebp
+  802936:	89 e5                	mov    %esp,%ebp
+  802938:	53                   	push   %ebx
+  802939:	83 ec 04             	sub    $0x4,%esp
+  80293c:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  80293e:	83 3d 08 60 80 00 00 	cmpl   $0x0,0x806008
+  802945:	74 26                	je     80296d <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802947:	6a 07                	push   $0x7
+  802949:	68 00 80 80 00       	push   $0x808000
+  80294e:	53                   	push   %ebx
+  80294f:	ff 35 08 60 80 00    	push   0x806008
+  802955:	e8 88 1a 00 00       	call   8043e2 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  80295a:	83 c4 0c             	add    $0xc,%esp
+  80295d:	6a 00                	push   $0x0
+  80295f:	6a 00                	push   $0x0
+  802961:	6a 00                	push   $0x0
+  802963:	e8 84 19 00 00       	call   8042ec <ipc_recv>
+}
+  802968:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80296b:	c9                   	leave
+  80296c:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80296d:	83 ec 0c             	sub    $0xc,%esp
+  802970:	6a 02                	push   $0x2
+  802972:	e8 c1 1a 00 00       	call   804438 <ipc_find_env>
+  802977:	a3 08 60 80 00       	mov    %eax,0x806008
+  80297c:	83 c4 10             	add    $0x10,%esp
+  80297f:	eb c6                	jmp    802947 <nsipc+0x12>
+
+00802981 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802981:	55                   	push   %ebp
+  802982:	89 e5                	mov    %esp,%ebp
+  802984:	56                   	push   %esi
+  802985:	53                   	push   %ebx
+  802986:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802989:	8b 45 08             	mov    0x8(%ebp),%eax
+  80298c:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802991:	8b 06                	mov    (%esi),%eax
+  802993:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802998:	b8 01 00 00 00       	mov    $0x1,%eax
+  80299d:	e8 93 ff ff ff       	call   802935 <nsipc>
+  8029a2:	89 c3                	mov    %eax,%ebx
+  8029a4:	85 c0                	test   %eax,%eax
+  8029a6:	79 09                	jns    8029b1 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8029a8:	89 d8                	mov    %ebx,%eax
+  8029aa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8029ad:	5b                   	pop    %ebx
+  8029ae:	5e                   	pop    %esi
+  8029af:	5d                   	pop    %ebp
+  8029b0:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8029b1:	83 ec 04             	sub    $0x4,%esp
+  8029b4:	ff 35 10 80 80 00    	push   0x808010
+  8029ba:	68 00 80 80 00       	push   $0x808000
+  8029bf:	ff 75 0c             	push   0xc(%ebp)
+  8029c2:	e8 17 e0 ff ff       	call   8009de <memmove>
+		*addrlen = ret->ret_addrlen;
+  8029c7:	a1 10 80 80 00       	mov    0x808010,%eax
+  8029cc:	89 06                	mov    %eax,(%esi)
+  8029ce:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8029d1:	eb d5                	jmp    8029a8 <nsipc_accept+0x27>
+
+008029d3 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8029d3:	55                   	push   %ebp
+  8029d4:	89 e5                	mov    %esp,%ebp
+  8029d6:	53                   	push   %ebx
+  8029d7:	83 ec 08             	sub    $0x8,%esp
+  8029da:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8029dd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029e0:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8029e5:	53                   	push   %ebx
+  8029e6:	ff 75 0c             	push   0xc(%ebp)
+  8029e9:	68 04 80 80 00       	push   $0x808004
+  8029ee:	e8 eb df ff ff       	call   8009de <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8029f3:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  8029f9:	b8 02 00 00 00       	mov    $0x2,%eax
+  8029fe:	e8 32 ff ff ff       	call   802935 <nsipc>
+}
+  802a03:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a06:	c9                   	leave
+  802a07:	c3                   	ret
+
+00802a08 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802a08:	55                   	push   %ebp
+  802a09:	89 e5                	mov    %esp,%ebp
+  802a0b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802a0e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a11:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  802a16:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a19:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802a1e:	b8 03 00 00 00       	mov    $0x3,%eax
+  802a23:	e8 0d ff ff ff       	call   802935 <nsipc>
+}
+  802a28:	c9                   	leave
+  802a29:	c3                   	ret
+
+00802a2a <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802a2a:	55                   	push   %ebp
+  802a2b:	89 e5                	mov    %esp,%ebp
+  802a2d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802a30:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a33:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  802a38:	b8 04 00 00 00       	mov    $0x4,%eax
+  802a3d:	e8 f3 fe ff ff       	call   802935 <nsipc>
+}
+  802a42:	c9                   	leave
+  802a43:	c3                   	ret
+
+00802a44 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802a44:	55                   	push   %ebp
+  802a45:	89 e5                	mov    %esp,%ebp
+  802a47:	53                   	push   %ebx
+  802a48:	83 ec 08             	sub    $0x8,%esp
+  802a4b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802a4e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a51:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802a56:	53                   	push   %ebx
+  802a57:	ff 75 0c             	push   0xc(%ebp)
+  802a5a:	68 04 80 80 00       	push   $0x808004
+  802a5f:	e8 7a df ff ff       	call   8009de <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802a64:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  802a6a:	b8 05 00 00 00       	mov    $0x5,%eax
+  802a6f:	e8 c1 fe ff ff       	call   802935 <nsipc>
+}
+  802a74:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a77:	c9                   	leave
+  802a78:	c3                   	ret
+
+00802a79 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802a79:	55                   	push   %ebp
+  802a7a:	89 e5                	mov    %esp,%ebp
+  802a7c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802a7f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a82:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802a87:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a8a:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802a8f:	b8 06 00 00 00       	mov    $0x6,%eax
+  802a94:	e8 9c fe ff ff       	call   802935 <nsipc>
+}
+  802a99:	c9                   	leave
+  802a9a:	c3                   	ret
+
+00802a9b <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802a9b:	55                   	push   %ebp
+  802a9c:	89 e5                	mov    %esp,%ebp
+  802a9e:	56                   	push   %esi
+  802a9f:	53                   	push   %ebx
+  802aa0:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802aa3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802aa6:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  802aab:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  802ab1:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ab4:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802ab9:	b8 07 00 00 00       	mov    $0x7,%eax
+  802abe:	e8 72 fe ff ff       	call   802935 <nsipc>
+  802ac3:	89 c3                	mov    %eax,%ebx
+  802ac5:	85 c0                	test   %eax,%eax
+  802ac7:	78 22                	js     802aeb <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802ac9:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802ace:	39 c6                	cmp    %eax,%esi
+  802ad0:	0f 4e c6             	cmovle %esi,%eax
+  802ad3:	39 c3                	cmp    %eax,%ebx
+  802ad5:	7f 1d                	jg     802af4 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802ad7:	83 ec 04             	sub    $0x4,%esp
+  802ada:	53                   	push   %ebx
+  802adb:	68 00 80 80 00       	push   $0x808000
+  802ae0:	ff 75 0c             	push   0xc(%ebp)
+  802ae3:	e8 f6 de ff ff       	call   8009de <memmove>
+  802ae8:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802aeb:	89 d8                	mov    %ebx,%eax
+  802aed:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802af0:	5b                   	pop    %ebx
+  802af1:	5e                   	pop    %esi
+  802af2:	5d                   	pop    %ebp
+  802af3:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802af4:	68 84 4c 80 00       	push   $0x804c84
+  802af9:	68 3d 4c 80 00       	push   $0x804c3d
+  802afe:	6a 62                	push   $0x62
+  802b00:	68 99 4c 80 00       	push   $0x804c99
+  802b05:	e8 8f d6 ff ff       	call   800199 <_panic>
+
+00802b0a <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802b0a:	55                   	push   %ebp
+  802b0b:	89 e5                	mov    %esp,%ebp
+  802b0d:	53                   	push   %ebx
+  802b0e:	83 ec 04             	sub    $0x4,%esp
+  802b11:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802b14:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b17:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802b1c:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802b22:	7f 2e                	jg     802b52 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802b24:	83 ec 04             	sub    $0x4,%esp
+  802b27:	53                   	push   %ebx
+  802b28:	ff 75 0c             	push   0xc(%ebp)
+  802b2b:	68 0c 80 80 00       	push   $0x80800c
+  802b30:	e8 a9 de ff ff       	call   8009de <memmove>
+	nsipcbuf.send.req_size = size;
+  802b35:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802b3b:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b3e:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802b43:	b8 08 00 00 00       	mov    $0x8,%eax
+  802b48:	e8 e8 fd ff ff       	call   802935 <nsipc>
+}
+  802b4d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b50:	c9                   	leave
+  802b51:	c3                   	ret
+	assert(size < 1600);
+  802b52:	68 a5 4c 80 00       	push   $0x804ca5
+  802b57:	68 3d 4c 80 00       	push   $0x804c3d
+  802b5c:	6a 6d                	push   $0x6d
+  802b5e:	68 99 4c 80 00       	push   $0x804c99
+  802b63:	e8 31 d6 ff ff       	call   800199 <_panic>
+
+00802b68 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802b68:	55                   	push   %ebp
+  802b69:	89 e5                	mov    %esp,%ebp
+  802b6b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802b6e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b71:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  802b76:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b79:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802b7e:	8b 45 10             	mov    0x10(%ebp),%eax
+  802b81:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802b86:	b8 09 00 00 00       	mov    $0x9,%eax
+  802b8b:	e8 a5 fd ff ff       	call   802935 <nsipc>
+}
+  802b90:	c9                   	leave
+  802b91:	c3                   	ret
+
+00802b92 <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  802b92:	55                   	push   %ebp
+  802b93:	89 e5                	mov    %esp,%ebp
+  802b95:	53                   	push   %ebx
+  802b96:	83 ec 10             	sub    $0x10,%esp
+  802b99:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  802b9c:	68 0c 60 80 00       	push   $0x80600c
+  802ba1:	e8 50 07 00 00       	call   8032f6 <mutex_lock>
+	if (v == 0)
+  802ba6:	83 c4 10             	add    $0x10,%esp
+  802ba9:	85 db                	test   %ebx,%ebx
+  802bab:	0f 84 85 00 00 00    	je     802c36 <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802bb1:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802bb7:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802bbc:	77 51                	ja     802c0f <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  802bbe:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  802bc4:	89 d8                	mov    %ebx,%eax
+  802bc6:	c1 e8 0c             	shr    $0xc,%eax
+  802bc9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802bd0:	f6 c4 02             	test   $0x2,%ah
+  802bd3:	74 50                	je     802c25 <free+0x93>
+		sys_page_unmap(0, c);
+  802bd5:	83 ec 08             	sub    $0x8,%esp
+  802bd8:	53                   	push   %ebx
+  802bd9:	6a 00                	push   $0x0
+  802bdb:	e8 4f e1 ff ff       	call   800d2f <sys_page_unmap>
+		c += PGSIZE;
+  802be0:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  802be6:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802bec:	83 c4 10             	add    $0x10,%esp
+  802bef:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802bf4:	76 ce                	jbe    802bc4 <free+0x32>
+  802bf6:	68 ef 4c 80 00       	push   $0x804cef
+  802bfb:	68 3d 4c 80 00       	push   $0x804c3d
+  802c00:	68 82 00 00 00       	push   $0x82
+  802c05:	68 e2 4c 80 00       	push   $0x804ce2
+  802c0a:	e8 8a d5 ff ff       	call   800199 <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802c0f:	68 b4 4c 80 00       	push   $0x804cb4
+  802c14:	68 3d 4c 80 00       	push   $0x804c3d
+  802c19:	6a 7b                	push   $0x7b
+  802c1b:	68 e2 4c 80 00       	push   $0x804ce2
+  802c20:	e8 74 d5 ff ff       	call   800199 <_panic>
+	if (--(*ref) == 0)
+  802c25:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  802c2b:	83 e8 01             	sub    $0x1,%eax
+  802c2e:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  802c34:	74 15                	je     802c4b <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  802c36:	83 ec 0c             	sub    $0xc,%esp
+  802c39:	68 0c 60 80 00       	push   $0x80600c
+  802c3e:	e8 20 07 00 00       	call   803363 <mutex_unlock>
+}
+  802c43:	83 c4 10             	add    $0x10,%esp
+  802c46:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c49:	c9                   	leave
+  802c4a:	c3                   	ret
+		sys_page_unmap(0, c);
+  802c4b:	83 ec 08             	sub    $0x8,%esp
+  802c4e:	53                   	push   %ebx
+  802c4f:	6a 00                	push   $0x0
+  802c51:	e8 d9 e0 ff ff       	call   800d2f <sys_page_unmap>
+  802c56:	83 c4 10             	add    $0x10,%esp
+  802c59:	eb db                	jmp    802c36 <free+0xa4>
+
+00802c5b <malloc>:
+{
+  802c5b:	55                   	push   %ebp
+  802c5c:	89 e5                	mov    %esp,%ebp
+  802c5e:	57                   	push   %edi
+  802c5f:	56                   	push   %esi
+  802c60:	53                   	push   %ebx
+  802c61:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  802c64:	68 0c 60 80 00       	push   $0x80600c
+  802c69:	e8 88 06 00 00       	call   8032f6 <mutex_lock>
+	if (mptr == 0)
+  802c6e:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+  802c74:	83 c4 10             	add    $0x10,%esp
+  802c77:	85 ff                	test   %edi,%edi
+  802c79:	74 6c                	je     802ce7 <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  802c7b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c7e:	83 c0 03             	add    $0x3,%eax
+  802c81:	83 e0 fc             	and    $0xfffffffc,%eax
+  802c84:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  802c86:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  802c8b:	0f 87 64 01 00 00    	ja     802df5 <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  802c91:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  802c97:	74 30                	je     802cc9 <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  802c99:	89 f9                	mov    %edi,%ecx
+  802c9b:	c1 e9 0c             	shr    $0xc,%ecx
+  802c9e:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  802ca2:	c1 e8 0c             	shr    $0xc,%eax
+  802ca5:	39 c1                	cmp    %eax,%ecx
+  802ca7:	74 5f                	je     802d08 <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  802ca9:	83 ec 0c             	sub    $0xc,%esp
+  802cac:	57                   	push   %edi
+  802cad:	e8 e0 fe ff ff       	call   802b92 <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  802cb2:	a1 10 60 80 00       	mov    0x806010,%eax
+  802cb7:	05 00 10 00 00       	add    $0x1000,%eax
+  802cbc:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802cc1:	a3 10 60 80 00       	mov    %eax,0x806010
+  802cc6:	83 c4 10             	add    $0x10,%esp
+  802cc9:	8b 0d 10 60 80 00    	mov    0x806010,%ecx
+{
+  802ccf:	ba 02 00 00 00       	mov    $0x2,%edx
+  802cd4:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  802cd8:	8d 7e 04             	lea    0x4(%esi),%edi
+  802cdb:	89 cb                	mov    %ecx,%ebx
+  802cdd:	01 f9                	add    %edi,%ecx
+  802cdf:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802ce2:	e9 8b 00 00 00       	jmp    802d72 <malloc+0x117>
+		mptr = mbegin;
+  802ce7:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  802cee:	00 00 08 
+	n = ROUNDUP(n, 4);
+  802cf1:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cf4:	83 c0 03             	add    $0x3,%eax
+  802cf7:	83 e0 fc             	and    $0xfffffffc,%eax
+  802cfa:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  802cfc:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  802d01:	76 c6                	jbe    802cc9 <malloc+0x6e>
+  802d03:	e9 d6 00 00 00       	jmp    802dde <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  802d08:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802d0e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  802d13:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  802d17:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  802d1a:	a3 10 60 80 00       	mov    %eax,0x806010
+			return v;
+  802d1f:	e9 ba 00 00 00       	jmp    802dde <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  802d24:	05 00 10 00 00       	add    $0x1000,%eax
+  802d29:	39 c8                	cmp    %ecx,%eax
+  802d2b:	0f 83 cb 00 00 00    	jae    802dfc <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  802d31:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  802d36:	77 22                	ja     802d5a <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  802d38:	89 c2                	mov    %eax,%edx
+  802d3a:	c1 ea 16             	shr    $0x16,%edx
+  802d3d:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802d44:	f6 c2 01             	test   $0x1,%dl
+  802d47:	74 db                	je     802d24 <malloc+0xc9>
+  802d49:	89 c2                	mov    %eax,%edx
+  802d4b:	c1 ea 0c             	shr    $0xc,%edx
+  802d4e:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802d55:	f6 c2 01             	test   $0x1,%dl
+  802d58:	74 ca                	je     802d24 <malloc+0xc9>
+		if (mptr == mend) {
+  802d5a:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802d60:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  802d66:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  802d6a:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  802d70:	74 04                	je     802d76 <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  802d72:	89 d8                	mov    %ebx,%eax
+  802d74:	eb b3                	jmp    802d29 <malloc+0xce>
+  802d76:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  802d79:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  802d7e:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  802d82:	83 ea 01             	sub    $0x1,%edx
+  802d85:	0f 85 50 ff ff ff    	jne    802cdb <malloc+0x80>
+  802d8b:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  802d92:	00 00 08 
+				return 0;	/* out of address space */
+  802d95:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d9a:	eb 42                	jmp    802dde <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  802d9c:	85 db                	test   %ebx,%ebx
+  802d9e:	78 1e                	js     802dbe <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  802da0:	83 ec 08             	sub    $0x8,%esp
+  802da3:	89 d8                	mov    %ebx,%eax
+  802da5:	03 05 10 60 80 00    	add    0x806010,%eax
+  802dab:	50                   	push   %eax
+  802dac:	6a 00                	push   $0x0
+  802dae:	e8 7c df ff ff       	call   800d2f <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  802db3:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  802db9:	83 c4 10             	add    $0x10,%esp
+  802dbc:	eb de                	jmp    802d9c <malloc+0x141>
+			return 0;	/* out of physical memory */
+  802dbe:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dc3:	eb 19                	jmp    802dde <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  802dc5:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802dc8:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  802dce:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  802dd5:	00 
+	mptr += n;
+  802dd6:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  802dd9:	a3 10 60 80 00       	mov    %eax,0x806010
+	mutex_unlock(&malloc_mu);
+  802dde:	83 ec 0c             	sub    $0xc,%esp
+  802de1:	68 0c 60 80 00       	push   $0x80600c
+  802de6:	e8 78 05 00 00       	call   803363 <mutex_unlock>
+}
+  802deb:	89 f8                	mov    %edi,%eax
+  802ded:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802df0:	5b                   	pop    %ebx
+  802df1:	5e                   	pop    %esi
+  802df2:	5f                   	pop    %edi
+  802df3:	5d                   	pop    %ebp
+  802df4:	c3                   	ret
+		return 0;
+  802df5:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dfa:	eb e2                	jmp    802dde <malloc+0x183>
+  802dfc:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  802e00:	74 06                	je     802e08 <malloc+0x1ad>
+  802e02:	89 1d 10 60 80 00    	mov    %ebx,0x806010
+	for (i = 0; i < n + 4; i += PGSIZE){
+  802e08:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e0d:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  802e10:	39 fb                	cmp    %edi,%ebx
+  802e12:	73 b1                	jae    802dc5 <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  802e14:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  802e1a:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  802e1d:	39 fe                	cmp    %edi,%esi
+  802e1f:	0f 92 c0             	setb   %al
+  802e22:	0f b6 c0             	movzbl %al,%eax
+  802e25:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  802e28:	83 c8 07             	or     $0x7,%eax
+  802e2b:	50                   	push   %eax
+  802e2c:	89 d8                	mov    %ebx,%eax
+  802e2e:	03 05 10 60 80 00    	add    0x806010,%eax
+  802e34:	50                   	push   %eax
+  802e35:	6a 00                	push   $0x0
+  802e37:	e8 5a de ff ff       	call   800c96 <sys_page_alloc>
+  802e3c:	83 c4 10             	add    $0x10,%esp
+  802e3f:	85 c0                	test   %eax,%eax
+  802e41:	0f 88 55 ff ff ff    	js     802d9c <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  802e47:	89 f3                	mov    %esi,%ebx
+  802e49:	eb c5                	jmp    802e10 <malloc+0x1b5>
+
+00802e4b <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802e4b:	55                   	push   %ebp
+  802e4c:	89 e5                	mov    %esp,%ebp
+  802e4e:	56                   	push   %esi
+  802e4f:	53                   	push   %ebx
+  802e50:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802e53:	83 ec 0c             	sub    $0xc,%esp
+  802e56:	ff 75 08             	push   0x8(%ebp)
+  802e59:	e8 ea e2 ff ff       	call   801148 <fd2data>
+  802e5e:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802e60:	83 c4 08             	add    $0x8,%esp
+  802e63:	68 07 4d 80 00       	push   $0x804d07
+  802e68:	53                   	push   %ebx
+  802e69:	e8 ea d9 ff ff       	call   800858 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802e6e:	8b 46 04             	mov    0x4(%esi),%eax
+  802e71:	2b 06                	sub    (%esi),%eax
+  802e73:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802e79:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802e80:	00 00 00 
+	stat->st_dev = &devpipe;
+  802e83:	c7 83 88 00 00 00 7c 	movl   $0x80527c,0x88(%ebx)
+  802e8a:	52 80 00 
+	return 0;
+}
+  802e8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e92:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e95:	5b                   	pop    %ebx
+  802e96:	5e                   	pop    %esi
+  802e97:	5d                   	pop    %ebp
+  802e98:	c3                   	ret
+
+00802e99 <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  802e99:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802e9e:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  802ea2:	85 c9                	test   %ecx,%ecx
+  802ea4:	75 01                	jne    802ea7 <pipewake+0xe>
+  802ea6:	c3                   	ret
+{
+  802ea7:	55                   	push   %ebp
+  802ea8:	89 e5                	mov    %esp,%ebp
+  802eaa:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  802ead:	68 00 04 00 00       	push   $0x400
+  802eb2:	52                   	push   %edx
+  802eb3:	e8 22 e1 ff ff       	call   800fda <sys_futex_wake>
+  802eb8:	83 c4 10             	add    $0x10,%esp
+}
+  802ebb:	c9                   	leave
+  802ebc:	c3                   	ret
+
+00802ebd <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802ebd:	55                   	push   %ebp
+  802ebe:	89 e5                	mov    %esp,%ebp
+  802ec0:	56                   	push   %esi
+  802ec1:	53                   	push   %ebx
+  802ec2:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802ec5:	83 ec 0c             	sub    $0xc,%esp
+  802ec8:	56                   	push   %esi
+  802ec9:	e8 7a e2 ff ff       	call   801148 <fd2data>
+  802ece:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  802ed0:	83 c4 08             	add    $0x8,%esp
+  802ed3:	56                   	push   %esi
+  802ed4:	6a 00                	push   $0x0
+  802ed6:	e8 54 de ff ff       	call   800d2f <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  802edb:	8d 53 04             	lea    0x4(%ebx),%edx
+  802ede:	8d 43 08             	lea    0x8(%ebx),%eax
+  802ee1:	e8 b3 ff ff ff       	call   802e99 <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  802ee6:	8d 43 0c             	lea    0xc(%ebx),%eax
+  802ee9:	89 da                	mov    %ebx,%edx
+  802eeb:	e8 a9 ff ff ff       	call   802e99 <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  802ef0:	89 34 24             	mov    %esi,(%esp)
+  802ef3:	e8 50 e2 ff ff       	call   801148 <fd2data>
+  802ef8:	83 c4 08             	add    $0x8,%esp
+  802efb:	50                   	push   %eax
+  802efc:	6a 00                	push   $0x0
+  802efe:	e8 2c de ff ff       	call   800d2f <sys_page_unmap>
+}
+  802f03:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f06:	5b                   	pop    %ebx
+  802f07:	5e                   	pop    %esi
+  802f08:	5d                   	pop    %ebp
+  802f09:	c3                   	ret
+
+00802f0a <_pipeisclosed>:
+{
+  802f0a:	55                   	push   %ebp
+  802f0b:	89 e5                	mov    %esp,%ebp
+  802f0d:	57                   	push   %edi
+  802f0e:	56                   	push   %esi
+  802f0f:	53                   	push   %ebx
+  802f10:	83 ec 1c             	sub    $0x1c,%esp
+  802f13:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802f16:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802f18:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  802f1d:	eb 5d                	jmp    802f7c <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  802f1f:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		n = thisenv->env_runs;
+  802f25:	8b 02                	mov    (%edx),%eax
+  802f27:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802f2a:	83 ec 0c             	sub    $0xc,%esp
+  802f2d:	ff 75 e0             	push   -0x20(%ebp)
+  802f30:	e8 42 15 00 00       	call   804477 <pageref>
+  802f35:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802f38:	89 3c 24             	mov    %edi,(%esp)
+  802f3b:	e8 37 15 00 00       	call   804477 <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  802f40:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802f42:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  802f48:	83 c4 10             	add    $0x10,%esp
+  802f4b:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  802f51:	77 15                	ja     802f68 <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802f53:	89 f2                	mov    %esi,%edx
+  802f55:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  802f57:	c1 ea 10             	shr    $0x10,%edx
+  802f5a:	74 0c                	je     802f68 <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802f5c:	c1 e2 10             	shl    $0x10,%edx
+  802f5f:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  802f64:	29 d1                	sub    %edx,%ecx
+  802f66:	eb 06                	jmp    802f6e <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  802f68:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		nn = thisenv->env_runs;
+  802f6e:	8b 11                	mov    (%ecx),%edx
+  802f70:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  802f73:	39 d3                	cmp    %edx,%ebx
+  802f75:	74 6e                	je     802fe5 <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  802f77:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802f7a:	74 24                	je     802fa0 <_pipeisclosed+0x96>
+  802f7c:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802f7e:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802f84:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802f89:	77 94                	ja     802f1f <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802f8b:	89 f0                	mov    %esi,%eax
+  802f8d:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  802f8f:	c1 e8 10             	shr    $0x10,%eax
+  802f92:	74 8b                	je     802f1f <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802f94:	c1 e0 10             	shl    $0x10,%eax
+  802f97:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802f9c:	29 c2                	sub    %eax,%edx
+  802f9e:	eb 85                	jmp    802f25 <_pipeisclosed+0x1b>
+  802fa0:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802fa2:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802fa8:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802fad:	77 18                	ja     802fc7 <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802faf:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802fb4:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  802fb6:	c1 e8 10             	shr    $0x10,%eax
+  802fb9:	74 0c                	je     802fc7 <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802fbb:	c1 e0 10             	shl    $0x10,%eax
+  802fbe:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802fc3:	29 c2                	sub    %eax,%edx
+  802fc5:	eb 06                	jmp    802fcd <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  802fc7:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802fcd:	8b 02                	mov    (%edx),%eax
+  802fcf:	8b 40 58             	mov    0x58(%eax),%eax
+  802fd2:	6a 01                	push   $0x1
+  802fd4:	50                   	push   %eax
+  802fd5:	53                   	push   %ebx
+  802fd6:	68 0e 4d 80 00       	push   $0x804d0e
+  802fdb:	e8 94 d2 ff ff       	call   800274 <cprintf>
+  802fe0:	83 c4 10             	add    $0x10,%esp
+  802fe3:	eb 97                	jmp    802f7c <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  802fe5:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802fe8:	0f 94 c0             	sete   %al
+  802feb:	0f b6 c0             	movzbl %al,%eax
+}
+  802fee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ff1:	5b                   	pop    %ebx
+  802ff2:	5e                   	pop    %esi
+  802ff3:	5f                   	pop    %edi
+  802ff4:	5d                   	pop    %ebp
+  802ff5:	c3                   	ret
+
+00802ff6 <devpipe_write>:
+{
+  802ff6:	55                   	push   %ebp
+  802ff7:	89 e5                	mov    %esp,%ebp
+  802ff9:	57                   	push   %edi
+  802ffa:	56                   	push   %esi
+  802ffb:	53                   	push   %ebx
+  802ffc:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802fff:	ff 75 08             	push   0x8(%ebp)
+  803002:	e8 41 e1 ff ff       	call   801148 <fd2data>
+  803007:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803009:	83 c4 10             	add    $0x10,%esp
+  80300c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  803013:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  803016:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803019:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80301c:	0f 84 96 00 00 00    	je     8030b8 <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  803022:	8d 73 08             	lea    0x8(%ebx),%esi
+  803025:	eb 32                	jmp    803059 <devpipe_write+0x63>
+  803027:	89 fa                	mov    %edi,%edx
+  803029:	89 f0                	mov    %esi,%eax
+  80302b:	e8 69 fe ff ff       	call   802e99 <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  803030:	8b 43 04             	mov    0x4(%ebx),%eax
+  803033:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  803036:	ba 01 00 00 00       	mov    $0x1,%edx
+  80303b:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  803040:	83 ec 04             	sub    $0x4,%esp
+  803043:	6a 0a                	push   $0xa
+  803045:	50                   	push   %eax
+  803046:	53                   	push   %ebx
+  803047:	e8 5f df ff ff       	call   800fab <sys_futex_wait>
+  80304c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803051:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  803056:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  803059:	8b 43 04             	mov    0x4(%ebx),%eax
+  80305c:	8b 0b                	mov    (%ebx),%ecx
+  80305e:	8d 51 20             	lea    0x20(%ecx),%edx
+  803061:	39 d0                	cmp    %edx,%eax
+  803063:	72 1b                	jb     803080 <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  803065:	89 da                	mov    %ebx,%edx
+  803067:	8b 45 08             	mov    0x8(%ebp),%eax
+  80306a:	e8 9b fe ff ff       	call   802f0a <_pipeisclosed>
+  80306f:	85 c0                	test   %eax,%eax
+  803071:	74 b4                	je     803027 <devpipe_write+0x31>
+				return 0;
+  803073:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803078:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80307b:	5b                   	pop    %ebx
+  80307c:	5e                   	pop    %esi
+  80307d:	5f                   	pop    %edi
+  80307e:	5d                   	pop    %ebp
+  80307f:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803080:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803083:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803086:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  80308a:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  80308d:	89 c2                	mov    %eax,%edx
+  80308f:	c1 fa 1f             	sar    $0x1f,%edx
+  803092:	89 d1                	mov    %edx,%ecx
+  803094:	c1 e9 1b             	shr    $0x1b,%ecx
+  803097:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80309a:	83 e2 1f             	and    $0x1f,%edx
+  80309d:	29 ca                	sub    %ecx,%edx
+  80309f:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  8030a3:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  8030a7:	83 c0 01             	add    $0x1,%eax
+  8030aa:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8030ad:	83 c6 01             	add    $0x1,%esi
+  8030b0:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8030b3:	e9 5e ff ff ff       	jmp    803016 <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  8030b8:	8d 53 04             	lea    0x4(%ebx),%edx
+  8030bb:	8d 43 08             	lea    0x8(%ebx),%eax
+  8030be:	e8 d6 fd ff ff       	call   802e99 <pipewake>
+	return i;
+  8030c3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8030c6:	eb b0                	jmp    803078 <devpipe_write+0x82>
+
+008030c8 <devpipe_read>:
+{
+  8030c8:	55                   	push   %ebp
+  8030c9:	89 e5                	mov    %esp,%ebp
+  8030cb:	57                   	push   %edi
+  8030cc:	56                   	push   %esi
+  8030cd:	53                   	push   %ebx
+  8030ce:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  8030d1:	ff 75 08             	push   0x8(%ebp)
+  8030d4:	e8 6f e0 ff ff       	call   801148 <fd2data>
+  8030d9:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8030db:	83 c4 10             	add    $0x10,%esp
+  8030de:	be 00 00 00 00       	mov    $0x0,%esi
+  8030e3:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8030e6:	74 6c                	je     803154 <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  8030e8:	8d 7b 04             	lea    0x4(%ebx),%edi
+  8030eb:	eb 25                	jmp    803112 <devpipe_read+0x4a>
+  8030ed:	8b 13                	mov    (%ebx),%edx
+  8030ef:	b8 01 00 00 00       	mov    $0x1,%eax
+  8030f4:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  8030f9:	83 ec 04             	sub    $0x4,%esp
+  8030fc:	6a 0a                	push   $0xa
+  8030fe:	52                   	push   %edx
+  8030ff:	57                   	push   %edi
+  803100:	e8 a6 de ff ff       	call   800fab <sys_futex_wait>
+  803105:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80310a:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  80310f:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  803112:	8b 03                	mov    (%ebx),%eax
+  803114:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803117:	75 19                	jne    803132 <devpipe_read+0x6a>
+			if (i > 0)
+  803119:	85 f6                	test   %esi,%esi
+  80311b:	75 3a                	jne    803157 <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  80311d:	89 da                	mov    %ebx,%edx
+  80311f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803122:	e8 e3 fd ff ff       	call   802f0a <_pipeisclosed>
+  803127:	85 c0                	test   %eax,%eax
+  803129:	74 c2                	je     8030ed <devpipe_read+0x25>
+				return 0;
+  80312b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803130:	eb 31                	jmp    803163 <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803132:	89 c1                	mov    %eax,%ecx
+  803134:	c1 f9 1f             	sar    $0x1f,%ecx
+  803137:	c1 e9 1b             	shr    $0x1b,%ecx
+  80313a:	01 c8                	add    %ecx,%eax
+  80313c:	83 e0 1f             	and    $0x1f,%eax
+  80313f:	29 c8                	sub    %ecx,%eax
+  803141:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  803146:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803149:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80314c:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80314f:	83 c6 01             	add    $0x1,%esi
+  803152:	eb 8f                	jmp    8030e3 <devpipe_read+0x1b>
+out:
+  803154:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  803157:	8d 43 0c             	lea    0xc(%ebx),%eax
+  80315a:	89 da                	mov    %ebx,%edx
+  80315c:	e8 38 fd ff ff       	call   802e99 <pipewake>
+	return i;
+  803161:	89 f0                	mov    %esi,%eax
+}
+  803163:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803166:	5b                   	pop    %ebx
+  803167:	5e                   	pop    %esi
+  803168:	5f                   	pop    %edi
+  803169:	5d                   	pop    %ebp
+  80316a:	c3                   	ret
+
+0080316b <pipe>:
+{
+  80316b:	55                   	push   %ebp
+  80316c:	89 e5                	mov    %esp,%ebp
+  80316e:	56                   	push   %esi
+  80316f:	53                   	push   %ebx
+  803170:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803173:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803176:	50                   	push   %eax
+  803177:	e8 e3 df ff ff       	call   80115f <fd_alloc>
+  80317c:	89 c3                	mov    %eax,%ebx
+  80317e:	83 c4 10             	add    $0x10,%esp
+  803181:	85 c0                	test   %eax,%eax
+  803183:	0f 88 23 01 00 00    	js     8032ac <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803189:	83 ec 04             	sub    $0x4,%esp
+  80318c:	68 07 04 00 00       	push   $0x407
+  803191:	ff 75 f4             	push   -0xc(%ebp)
+  803194:	6a 00                	push   $0x0
+  803196:	e8 fb da ff ff       	call   800c96 <sys_page_alloc>
+  80319b:	89 c3                	mov    %eax,%ebx
+  80319d:	83 c4 10             	add    $0x10,%esp
+  8031a0:	85 c0                	test   %eax,%eax
+  8031a2:	0f 88 04 01 00 00    	js     8032ac <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8031a8:	83 ec 0c             	sub    $0xc,%esp
+  8031ab:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8031ae:	50                   	push   %eax
+  8031af:	e8 ab df ff ff       	call   80115f <fd_alloc>
+  8031b4:	89 c3                	mov    %eax,%ebx
+  8031b6:	83 c4 10             	add    $0x10,%esp
+  8031b9:	85 c0                	test   %eax,%eax
+  8031bb:	0f 88 db 00 00 00    	js     80329c <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8031c1:	83 ec 04             	sub    $0x4,%esp
+  8031c4:	68 07 04 00 00       	push   $0x407
+  8031c9:	ff 75 f0             	push   -0x10(%ebp)
+  8031cc:	6a 00                	push   $0x0
+  8031ce:	e8 c3 da ff ff       	call   800c96 <sys_page_alloc>
+  8031d3:	89 c3                	mov    %eax,%ebx
+  8031d5:	83 c4 10             	add    $0x10,%esp
+  8031d8:	85 c0                	test   %eax,%eax
+  8031da:	0f 88 bc 00 00 00    	js     80329c <pipe+0x131>
+	va = fd2data(fd0);
+  8031e0:	83 ec 0c             	sub    $0xc,%esp
+  8031e3:	ff 75 f4             	push   -0xc(%ebp)
+  8031e6:	e8 5d df ff ff       	call   801148 <fd2data>
+  8031eb:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8031ed:	83 c4 0c             	add    $0xc,%esp
+  8031f0:	68 07 04 00 00       	push   $0x407
+  8031f5:	50                   	push   %eax
+  8031f6:	6a 00                	push   $0x0
+  8031f8:	e8 99 da ff ff       	call   800c96 <sys_page_alloc>
+  8031fd:	89 c3                	mov    %eax,%ebx
+  8031ff:	83 c4 10             	add    $0x10,%esp
+  803202:	85 c0                	test   %eax,%eax
+  803204:	0f 88 82 00 00 00    	js     80328c <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80320a:	83 ec 0c             	sub    $0xc,%esp
+  80320d:	ff 75 f0             	push   -0x10(%ebp)
+  803210:	e8 33 df ff ff       	call   801148 <fd2data>
+  803215:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80321c:	50                   	push   %eax
+  80321d:	6a 00                	push   $0x0
+  80321f:	56                   	push   %esi
+  803220:	6a 00                	push   $0x0
+  803222:	e8 bc da ff ff       	call   800ce3 <sys_page_map>
+  803227:	89 c3                	mov    %eax,%ebx
+  803229:	83 c4 20             	add    $0x20,%esp
+  80322c:	85 c0                	test   %eax,%eax
+  80322e:	78 4e                	js     80327e <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803230:	a1 7c 52 80 00       	mov    0x80527c,%eax
+  803235:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803238:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80323a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80323d:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803244:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803247:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803249:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80324c:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803253:	83 ec 0c             	sub    $0xc,%esp
+  803256:	ff 75 f4             	push   -0xc(%ebp)
+  803259:	e8 da de ff ff       	call   801138 <fd2num>
+  80325e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803261:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803263:	83 c4 04             	add    $0x4,%esp
+  803266:	ff 75 f0             	push   -0x10(%ebp)
+  803269:	e8 ca de ff ff       	call   801138 <fd2num>
+  80326e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803271:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803274:	83 c4 10             	add    $0x10,%esp
+  803277:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80327c:	eb 2e                	jmp    8032ac <pipe+0x141>
+	sys_page_unmap(0, va);
+  80327e:	83 ec 08             	sub    $0x8,%esp
+  803281:	56                   	push   %esi
+  803282:	6a 00                	push   $0x0
+  803284:	e8 a6 da ff ff       	call   800d2f <sys_page_unmap>
+  803289:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80328c:	83 ec 08             	sub    $0x8,%esp
+  80328f:	ff 75 f0             	push   -0x10(%ebp)
+  803292:	6a 00                	push   $0x0
+  803294:	e8 96 da ff ff       	call   800d2f <sys_page_unmap>
+  803299:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80329c:	83 ec 08             	sub    $0x8,%esp
+  80329f:	ff 75 f4             	push   -0xc(%ebp)
+  8032a2:	6a 00                	push   $0x0
+  8032a4:	e8 86 da ff ff       	call   800d2f <sys_page_unmap>
+  8032a9:	83 c4 10             	add    $0x10,%esp
+}
+  8032ac:	89 d8                	mov    %ebx,%eax
+  8032ae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032b1:	5b                   	pop    %ebx
+  8032b2:	5e                   	pop    %esi
+  8032b3:	5d                   	pop    %ebp
+  8032b4:	c3                   	ret
+
+008032b5 <pipeisclosed>:
+{
+  8032b5:	55                   	push   %ebp
+  8032b6:	89 e5                	mov    %esp,%ebp
+  8032b8:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8032bb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8032be:	50                   	push   %eax
+  8032bf:	ff 75 08             	push   0x8(%ebp)
+  8032c2:	e8 ee de ff ff       	call   8011b5 <fd_lookup>
+  8032c7:	83 c4 10             	add    $0x10,%esp
+  8032ca:	85 c0                	test   %eax,%eax
+  8032cc:	78 18                	js     8032e6 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8032ce:	83 ec 0c             	sub    $0xc,%esp
+  8032d1:	ff 75 f4             	push   -0xc(%ebp)
+  8032d4:	e8 6f de ff ff       	call   801148 <fd2data>
+  8032d9:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8032db:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8032de:	e8 27 fc ff ff       	call   802f0a <_pipeisclosed>
+  8032e3:	83 c4 10             	add    $0x10,%esp
+}
+  8032e6:	c9                   	leave
+  8032e7:	c3                   	ret
+
+008032e8 <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  8032e8:	55                   	push   %ebp
+  8032e9:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  8032eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032ee:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8032f4:	5d                   	pop    %ebp
+  8032f5:	c3                   	ret
+
+008032f6 <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  8032f6:	55                   	push   %ebp
+  8032f7:	89 e5                	mov    %esp,%ebp
+  8032f9:	56                   	push   %esi
+  8032fa:	53                   	push   %ebx
+  8032fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  8032fe:	ba 00 00 00 00       	mov    $0x0,%edx
+  803303:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803308:	89 d0                	mov    %edx,%eax
+  80330a:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  80330e:	85 c0                	test   %eax,%eax
+  803310:	74 2d                	je     80333f <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  803312:	83 f8 02             	cmp    $0x2,%eax
+  803315:	74 08                	je     80331f <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  803317:	b8 02 00 00 00       	mov    $0x2,%eax
+  80331c:	f0 87 03             	lock xchg %eax,(%ebx)
+  80331f:	be 02 00 00 00       	mov    $0x2,%esi
+  803324:	eb 15                	jmp    80333b <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  803326:	83 ec 04             	sub    $0x4,%esp
+  803329:	6a 00                	push   $0x0
+  80332b:	6a 02                	push   $0x2
+  80332d:	53                   	push   %ebx
+  80332e:	e8 78 dc ff ff       	call   800fab <sys_futex_wait>
+  803333:	89 f0                	mov    %esi,%eax
+  803335:	f0 87 03             	lock xchg %eax,(%ebx)
+  803338:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  80333b:	85 c0                	test   %eax,%eax
+  80333d:	75 e7                	jne    803326 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  80333f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803342:	5b                   	pop    %ebx
+  803343:	5e                   	pop    %esi
+  803344:	5d                   	pop    %ebp
+  803345:	c3                   	ret
+
+00803346 <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  803346:	55                   	push   %ebp
+  803347:	89 e5                	mov    %esp,%ebp
+  803349:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  80334c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803351:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803356:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  80335a:	f7 d8                	neg    %eax
+  80335c:	19 c0                	sbb    %eax,%eax
+  80335e:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  803361:	5d                   	pop    %ebp
+  803362:	c3                   	ret
+
+00803363 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  803363:	55                   	push   %ebp
+  803364:	89 e5                	mov    %esp,%ebp
+  803366:	83 ec 08             	sub    $0x8,%esp
+  803369:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  80336c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803371:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  803374:	83 f8 02             	cmp    $0x2,%eax
+  803377:	74 02                	je     80337b <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  803379:	c9                   	leave
+  80337a:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  80337b:	83 ec 08             	sub    $0x8,%esp
+  80337e:	6a 01                	push   $0x1
+  803380:	52                   	push   %edx
+  803381:	e8 54 dc ff ff       	call   800fda <sys_futex_wake>
+  803386:	83 c4 10             	add    $0x10,%esp
+}
+  803389:	eb ee                	jmp    803379 <mutex_unlock+0x16>
+
+0080338b <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  80338b:	55                   	push   %ebp
+  80338c:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  80338e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803391:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803397:	5d                   	pop    %ebp
+  803398:	c3                   	ret
+
+00803399 <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  803399:	55                   	push   %ebp
+  80339a:	89 e5                	mov    %esp,%ebp
+  80339c:	57                   	push   %edi
+  80339d:	56                   	push   %esi
+  80339e:	53                   	push   %ebx
+  80339f:	83 ec 18             	sub    $0x18,%esp
+  8033a2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8033a5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  8033a8:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  8033aa:	53                   	push   %ebx
+  8033ab:	e8 b3 ff ff ff       	call   803363 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  8033b0:	83 c4 0c             	add    $0xc,%esp
+  8033b3:	ff 75 10             	push   0x10(%ebp)
+  8033b6:	57                   	push   %edi
+  8033b7:	56                   	push   %esi
+  8033b8:	e8 ee db ff ff       	call   800fab <sys_futex_wait>
+  8033bd:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  8033bf:	83 c4 10             	add    $0x10,%esp
+  8033c2:	be 02 00 00 00       	mov    $0x2,%esi
+  8033c7:	eb 10                	jmp    8033d9 <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  8033c9:	83 ec 04             	sub    $0x4,%esp
+  8033cc:	6a 00                	push   $0x0
+  8033ce:	6a 02                	push   $0x2
+  8033d0:	53                   	push   %ebx
+  8033d1:	e8 d5 db ff ff       	call   800fab <sys_futex_wait>
+  8033d6:	83 c4 10             	add    $0x10,%esp
+  8033d9:	89 f0                	mov    %esi,%eax
+  8033db:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  8033de:	85 c0                	test   %eax,%eax
+  8033e0:	75 e7                	jne    8033c9 <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  8033e2:	83 ff ec             	cmp    $0xffffffec,%edi
+  8033e5:	74 05                	je     8033ec <cond_timedwait+0x53>
+  8033e7:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  8033ec:	89 f8                	mov    %edi,%eax
+  8033ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033f1:	5b                   	pop    %ebx
+  8033f2:	5e                   	pop    %esi
+  8033f3:	5f                   	pop    %edi
+  8033f4:	5d                   	pop    %ebp
+  8033f5:	c3                   	ret
+
+008033f6 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  8033f6:	55                   	push   %ebp
+  8033f7:	89 e5                	mov    %esp,%ebp
+  8033f9:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  8033fc:	6a 00                	push   $0x0
+  8033fe:	ff 75 0c             	push   0xc(%ebp)
+  803401:	ff 75 08             	push   0x8(%ebp)
+  803404:	e8 90 ff ff ff       	call   803399 <cond_timedwait>
+}
+  803409:	83 c4 10             	add    $0x10,%esp
+  80340c:	c9                   	leave
+  80340d:	c3                   	ret
+
+0080340e <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  80340e:	55                   	push   %ebp
+  80340f:	89 e5                	mov    %esp,%ebp
+  803411:	83 ec 10             	sub    $0x10,%esp
+  803414:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  803417:	ba 01 00 00 00       	mov    $0x1,%edx
+  80341c:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  803420:	6a 01                	push   $0x1
+  803422:	50                   	push   %eax
+  803423:	e8 b2 db ff ff       	call   800fda <sys_futex_wake>
+}
+  803428:	83 c4 10             	add    $0x10,%esp
+  80342b:	c9                   	leave
+  80342c:	c3                   	ret
+
+0080342d <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  80342d:	55                   	push   %ebp
+  80342e:	89 e5                	mov    %esp,%ebp
+  803430:	83 ec 10             	sub    $0x10,%esp
+  803433:	8b 45 08             	mov    0x8(%ebp),%eax
+  803436:	ba 01 00 00 00       	mov    $0x1,%edx
+  80343b:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  80343f:	68 00 04 00 00       	push   $0x400
+  803444:	50                   	push   %eax
+  803445:	e8 90 db ff ff       	call   800fda <sys_futex_wake>
+}
+  80344a:	83 c4 10             	add    $0x10,%esp
+  80344d:	c9                   	leave
+  80344e:	c3                   	ret
+
+0080344f <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  80344f:	55                   	push   %ebp
+  803450:	89 e5                	mov    %esp,%ebp
+  803452:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  803455:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803458:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  80345a:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  803461:	5d                   	pop    %ebp
+  803462:	c3                   	ret
+
+00803463 <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  803463:	55                   	push   %ebp
+  803464:	89 e5                	mov    %esp,%ebp
+  803466:	53                   	push   %ebx
+  803467:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  80346a:	8b 11                	mov    (%ecx),%edx
+  80346c:	85 d2                	test   %edx,%edx
+  80346e:	74 14                	je     803484 <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  803470:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803473:	89 d0                	mov    %edx,%eax
+  803475:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  803479:	39 c2                	cmp    %eax,%edx
+  80347b:	75 ed                	jne    80346a <sem_trywait+0x7>
+			return 0;
+  80347d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803482:	eb 05                	jmp    803489 <sem_trywait+0x26>
+	return -E_AGAIN;
+  803484:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  803489:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80348c:	c9                   	leave
+  80348d:	c3                   	ret
+
+0080348e <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  80348e:	55                   	push   %ebp
+  80348f:	89 e5                	mov    %esp,%ebp
+  803491:	57                   	push   %edi
+  803492:	56                   	push   %esi
+  803493:	53                   	push   %ebx
+  803494:	83 ec 1c             	sub    $0x1c,%esp
+  803497:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80349a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  80349d:	e8 81 da ff ff       	call   800f23 <sys_time_msec>
+  8034a2:	01 f8                	add    %edi,%eax
+  8034a4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  8034a7:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  8034ac:	eb 28                	jmp    8034d6 <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  8034ae:	b8 01 00 00 00       	mov    $0x1,%eax
+  8034b3:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  8034b8:	83 ec 04             	sub    $0x4,%esp
+  8034bb:	56                   	push   %esi
+  8034bc:	6a 00                	push   $0x0
+  8034be:	53                   	push   %ebx
+  8034bf:	e8 e7 da ff ff       	call   800fab <sys_futex_wait>
+  8034c4:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8034c9:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  8034ce:	83 c4 10             	add    $0x10,%esp
+  8034d1:	83 f8 ec             	cmp    $0xffffffec,%eax
+  8034d4:	74 2e                	je     803504 <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  8034d6:	83 ec 0c             	sub    $0xc,%esp
+  8034d9:	53                   	push   %ebx
+  8034da:	e8 84 ff ff ff       	call   803463 <sem_trywait>
+  8034df:	83 c4 10             	add    $0x10,%esp
+  8034e2:	85 c0                	test   %eax,%eax
+  8034e4:	79 19                	jns    8034ff <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  8034e6:	85 ff                	test   %edi,%edi
+  8034e8:	74 c4                	je     8034ae <sem_timedwait+0x20>
+  8034ea:	e8 34 da ff ff       	call   800f23 <sys_time_msec>
+  8034ef:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8034f2:	29 c6                	sub    %eax,%esi
+  8034f4:	85 f6                	test   %esi,%esi
+  8034f6:	7f b6                	jg     8034ae <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  8034f8:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  8034fd:	eb 05                	jmp    803504 <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  8034ff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803504:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803507:	5b                   	pop    %ebx
+  803508:	5e                   	pop    %esi
+  803509:	5f                   	pop    %edi
+  80350a:	5d                   	pop    %ebp
+  80350b:	c3                   	ret
+
+0080350c <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  80350c:	55                   	push   %ebp
+  80350d:	89 e5                	mov    %esp,%ebp
+  80350f:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  803512:	6a 00                	push   $0x0
+  803514:	ff 75 08             	push   0x8(%ebp)
+  803517:	e8 72 ff ff ff       	call   80348e <sem_timedwait>
+}
+  80351c:	83 c4 10             	add    $0x10,%esp
+  80351f:	c9                   	leave
+  803520:	c3                   	ret
+
+00803521 <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  803521:	55                   	push   %ebp
+  803522:	89 e5                	mov    %esp,%ebp
+  803524:	83 ec 08             	sub    $0x8,%esp
+  803527:	8b 45 08             	mov    0x8(%ebp),%eax
+  80352a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80352f:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  803533:	8b 50 04             	mov    0x4(%eax),%edx
+  803536:	85 d2                	test   %edx,%edx
+  803538:	75 02                	jne    80353c <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  80353a:	c9                   	leave
+  80353b:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  80353c:	83 ec 08             	sub    $0x8,%esp
+  80353f:	6a 01                	push   $0x1
+  803541:	50                   	push   %eax
+  803542:	e8 93 da ff ff       	call   800fda <sys_futex_wake>
+  803547:	83 c4 10             	add    $0x10,%esp
+}
+  80354a:	eb ee                	jmp    80353a <sem_post+0x19>
+
+0080354c <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  80354c:	55                   	push   %ebp
+  80354d:	89 e5                	mov    %esp,%ebp
+  80354f:	57                   	push   %edi
+  803550:	56                   	push   %esi
+  803551:	53                   	push   %ebx
+  803552:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  803555:	68 20 60 80 00       	push   $0x806020
+  80355a:	e8 97 fd ff ff       	call   8032f6 <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  80355f:	a1 44 60 80 00       	mov    0x806044,%eax
+  803564:	83 c4 10             	add    $0x10,%esp
+  803567:	85 c0                	test   %eax,%eax
+  803569:	75 19                	jne    803584 <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  80356b:	a1 c0 62 80 00       	mov    0x8062c0,%eax
+  803570:	8b 00                	mov    (%eax),%eax
+  803572:	8b 40 48             	mov    0x48(%eax),%eax
+  803575:	a3 40 60 80 00       	mov    %eax,0x806040
+		threads[0].th_state = PTH_RUNNING;
+  80357a:	c7 05 44 60 80 00 01 	movl   $0x1,0x806044
+  803581:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803584:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  803589:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80358c:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803593:	8b 40 04             	mov    0x4(%eax),%eax
+  803596:	85 c0                	test   %eax,%eax
+  803598:	0f 84 e4 00 00 00    	je     803682 <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  80359e:	83 c3 01             	add    $0x1,%ebx
+  8035a1:	83 fb 20             	cmp    $0x20,%ebx
+  8035a4:	75 e3                	jne    803589 <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  8035a6:	83 ec 0c             	sub    $0xc,%esp
+  8035a9:	68 20 60 80 00       	push   $0x806020
+  8035ae:	e8 b0 fd ff ff       	call   803363 <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  8035b3:	83 c4 10             	add    $0x10,%esp
+  8035b6:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  8035bb:	e9 b8 00 00 00       	jmp    803678 <pthread_create+0x12c>
+  8035c0:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  8035c3:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  8035c6:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  8035c8:	39 f3                	cmp    %esi,%ebx
+  8035ca:	73 16                	jae    8035e2 <pthread_create+0x96>
+		va -= PGSIZE;
+  8035cc:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  8035d2:	83 ec 08             	sub    $0x8,%esp
+  8035d5:	56                   	push   %esi
+  8035d6:	6a 00                	push   $0x0
+  8035d8:	e8 52 d7 ff ff       	call   800d2f <sys_page_unmap>
+  8035dd:	83 c4 10             	add    $0x10,%esp
+  8035e0:	eb e6                	jmp    8035c8 <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  8035e2:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8035e5:	83 ec 08             	sub    $0x8,%esp
+  8035e8:	ff 75 e4             	push   -0x1c(%ebp)
+  8035eb:	6a 00                	push   $0x0
+  8035ed:	e8 3d d7 ff ff       	call   800d2f <sys_page_unmap>
+	return r;
+  8035f2:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  8035f5:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8035f8:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  8035ff:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  803606:	eb 70                	jmp    803678 <pthread_create+0x12c>
+	th->th_fn = fn;
+  803608:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80360b:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803612:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803615:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  803618:	8b 55 10             	mov    0x10(%ebp),%edx
+  80361b:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  80361e:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  803625:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  80362a:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80362d:	29 c8                	sub    %ecx,%eax
+  80362f:	85 db                	test   %ebx,%ebx
+  803631:	0f 44 05 c0 62 80 00 	cmove  0x8062c0,%eax
+	*--esp = t;
+  803638:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  80363b:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803642:	83 ec 04             	sub    $0x4,%esp
+  803645:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  80364a:	29 ca                	sub    %ecx,%edx
+  80364c:	52                   	push   %edx
+	*--esp = 0;
+  80364d:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803650:	50                   	push   %eax
+  803651:	68 a9 38 80 00       	push   $0x8038a9
+  803656:	e8 24 da ff ff       	call   80107f <sys_thread_create>
+  80365b:	89 c7                	mov    %eax,%edi
+  80365d:	83 c4 10             	add    $0x10,%esp
+  803660:	85 c0                	test   %eax,%eax
+  803662:	78 91                	js     8035f5 <pthread_create+0xa9>
+	th->th_env = id;
+  803664:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803667:	89 3c 85 40 60 80 00 	mov    %edi,0x806040(,%eax,4)
+	*tp = t;
+  80366e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803671:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  803673:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803678:	89 f8                	mov    %edi,%eax
+  80367a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80367d:	5b                   	pop    %ebx
+  80367e:	5e                   	pop    %esi
+  80367f:	5f                   	pop    %edi
+  803680:	5d                   	pop    %ebp
+  803681:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  803682:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803685:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  80368c:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  803693:	83 ec 0c             	sub    $0xc,%esp
+  803696:	68 20 60 80 00       	push   $0x806020
+  80369b:	e8 c3 fc ff ff       	call   803363 <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  8036a0:	89 d9                	mov    %ebx,%ecx
+  8036a2:	c1 e1 10             	shl    $0x10,%ecx
+  8036a5:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  8036a8:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  8036ad:	29 c8                	sub    %ecx,%eax
+  8036af:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  8036b2:	c1 e8 16             	shr    $0x16,%eax
+  8036b5:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8036bc:	83 c4 10             	add    $0x10,%esp
+  8036bf:	a8 01                	test   $0x1,%al
+  8036c1:	74 15                	je     8036d8 <pthread_create+0x18c>
+  8036c3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8036c6:	c1 e8 0c             	shr    $0xc,%eax
+  8036c9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8036d0:	a8 01                	test   $0x1,%al
+  8036d2:	0f 85 30 ff ff ff    	jne    803608 <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  8036d8:	83 ec 04             	sub    $0x4,%esp
+  8036db:	6a 07                	push   $0x7
+  8036dd:	ff 75 e4             	push   -0x1c(%ebp)
+  8036e0:	6a 00                	push   $0x0
+  8036e2:	e8 af d5 ff ff       	call   800c96 <sys_page_alloc>
+  8036e7:	89 c7                	mov    %eax,%edi
+  8036e9:	83 c4 10             	add    $0x10,%esp
+  8036ec:	85 c0                	test   %eax,%eax
+  8036ee:	0f 88 01 ff ff ff    	js     8035f5 <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  8036f4:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  8036f9:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8036fc:	29 d0                	sub    %edx,%eax
+  8036fe:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  803701:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803703:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  803708:	29 d0                	sub    %edx,%eax
+  80370a:	89 c7                	mov    %eax,%edi
+  80370c:	39 fe                	cmp    %edi,%esi
+  80370e:	0f 83 f4 fe ff ff    	jae    803608 <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803714:	83 ec 04             	sub    $0x4,%esp
+  803717:	6a 07                	push   $0x7
+  803719:	56                   	push   %esi
+  80371a:	6a 00                	push   $0x0
+  80371c:	e8 75 d5 ff ff       	call   800c96 <sys_page_alloc>
+  803721:	83 c4 10             	add    $0x10,%esp
+  803724:	85 c0                	test   %eax,%eax
+  803726:	0f 88 94 fe ff ff    	js     8035c0 <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  80372c:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803732:	eb d8                	jmp    80370c <pthread_create+0x1c0>
+
+00803734 <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  803734:	55                   	push   %ebp
+  803735:	89 e5                	mov    %esp,%ebp
+  803737:	57                   	push   %edi
+  803738:	56                   	push   %esi
+  803739:	53                   	push   %ebx
+  80373a:	83 ec 0c             	sub    $0xc,%esp
+  80373d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  803740:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  803743:	83 f8 1e             	cmp    $0x1e,%eax
+  803746:	0f 87 c7 00 00 00    	ja     803813 <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  80374c:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80374e:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803754:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803759:	77 12                	ja     80376d <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80375b:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803760:	29 d0                	sub    %edx,%eax
+  803762:	c1 e8 10             	shr    $0x10,%eax
+  803765:	39 c3                	cmp    %eax,%ebx
+  803767:	0f 84 ad 00 00 00    	je     80381a <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  80376d:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803770:	8d 3c 85 44 60 80 00 	lea    0x806044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  803777:	8d 34 85 40 60 80 00 	lea    0x806040(,%eax,4),%esi
+  80377e:	eb 10                	jmp    803790 <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803780:	83 ec 04             	sub    $0x4,%esp
+  803783:	6a 00                	push   $0x0
+  803785:	6a 01                	push   $0x1
+  803787:	57                   	push   %edi
+  803788:	e8 1e d8 ff ff       	call   800fab <sys_futex_wait>
+  80378d:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  803790:	8b 46 04             	mov    0x4(%esi),%eax
+  803793:	83 f8 01             	cmp    $0x1,%eax
+  803796:	74 e8                	je     803780 <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  803798:	83 f8 02             	cmp    $0x2,%eax
+  80379b:	0f 85 80 00 00 00    	jne    803821 <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  8037a1:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  8037a4:	c1 e6 02             	shl    $0x2,%esi
+  8037a7:	eb 05                	jmp    8037ae <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  8037a9:	e8 bc d4 ff ff       	call   800c6a <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  8037ae:	8b 8e 40 60 80 00    	mov    0x806040(%esi),%ecx
+  8037b4:	89 ca                	mov    %ecx,%edx
+  8037b6:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8037bc:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8037bf:	c1 e0 04             	shl    $0x4,%eax
+  8037c2:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8037c7:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  8037ca:	39 c1                	cmp    %eax,%ecx
+  8037cc:	75 12                	jne    8037e0 <pthread_join+0xac>
+  8037ce:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8037d1:	c1 e0 04             	shl    $0x4,%eax
+  8037d4:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8037d9:	8b 40 54             	mov    0x54(%eax),%eax
+  8037dc:	85 c0                	test   %eax,%eax
+  8037de:	75 c9                	jne    8037a9 <pthread_join+0x75>
+	if (ret_store)
+  8037e0:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8037e4:	74 0f                	je     8037f5 <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  8037e6:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8037e9:	8b 04 85 50 60 80 00 	mov    0x806050(,%eax,4),%eax
+  8037f0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8037f3:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  8037f5:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8037f8:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  8037ff:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  803806:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80380b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80380e:	5b                   	pop    %ebx
+  80380f:	5e                   	pop    %esi
+  803810:	5f                   	pop    %edi
+  803811:	5d                   	pop    %ebp
+  803812:	c3                   	ret
+		return -E_INVAL;
+  803813:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803818:	eb f1                	jmp    80380b <pthread_join+0xd7>
+  80381a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80381f:	eb ea                	jmp    80380b <pthread_join+0xd7>
+		return -E_INVAL;
+  803821:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803826:	eb e3                	jmp    80380b <pthread_join+0xd7>
+
+00803828 <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  803828:	55                   	push   %ebp
+  803829:	89 e5                	mov    %esp,%ebp
+  80382b:	53                   	push   %ebx
+  80382c:	83 ec 04             	sub    $0x4,%esp
+  80382f:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803831:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803837:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80383c:	77 0c                	ja     80384a <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80383e:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803843:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  803845:	c1 e8 10             	shr    $0x10,%eax
+  803848:	75 0a                	jne    803854 <pthread_exit+0x2c>
+		exit();
+  80384a:	e8 22 c9 ff ff       	call   800171 <exit>
+  80384f:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  803854:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  80385b:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  80385e:	8d 0c 8d 40 60 80 00 	lea    0x806040(,%ecx,4),%ecx
+  803865:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803868:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  80386b:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  803872:	83 ec 08             	sub    $0x8,%esp
+  803875:	6a 20                	push   $0x20
+  803877:	01 c2                	add    %eax,%edx
+  803879:	8d 04 95 44 60 80 00 	lea    0x806044(,%edx,4),%eax
+  803880:	50                   	push   %eax
+  803881:	e8 54 d7 ff ff       	call   800fda <sys_futex_wake>
+	sys_env_destroy(0);
+  803886:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80388d:	e8 61 d3 ff ff       	call   800bf3 <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  803892:	83 c4 0c             	add    $0xc,%esp
+  803895:	68 26 4d 80 00       	push   $0x804d26
+  80389a:	68 a5 00 00 00       	push   $0xa5
+  80389f:	68 40 4d 80 00       	push   $0x804d40
+  8038a4:	e8 f0 c8 ff ff       	call   800199 <_panic>
+
+008038a9 <pthread_start>:
+{
+  8038a9:	55                   	push   %ebp
+  8038aa:	89 e5                	mov    %esp,%ebp
+  8038ac:	53                   	push   %ebx
+  8038ad:	83 ec 04             	sub    $0x4,%esp
+  8038b0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  8038b3:	e8 86 d3 ff ff       	call   800c3e <sys_getenvid>
+  8038b8:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  8038bd:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	if (t == 0)
+  8038c3:	85 db                	test   %ebx,%ebx
+  8038c5:	74 0c                	je     8038d3 <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8038c7:	89 d9                	mov    %ebx,%ecx
+  8038c9:	c1 e1 10             	shl    $0x10,%ecx
+  8038cc:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8038d1:	29 ca                	sub    %ecx,%edx
+  8038d3:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8038d6:	c1 e0 04             	shl    $0x4,%eax
+  8038d9:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8038de:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  8038e0:	83 ec 0c             	sub    $0xc,%esp
+  8038e3:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  8038ea:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  8038ed:	ff 34 95 4c 60 80 00 	push   0x80604c(,%edx,4)
+  8038f4:	ff 14 95 48 60 80 00 	call   *0x806048(,%edx,4)
+  8038fb:	89 04 24             	mov    %eax,(%esp)
+  8038fe:	e8 25 ff ff ff       	call   803828 <pthread_exit>
+
+00803903 <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  803903:	55                   	push   %ebp
+  803904:	89 e5                	mov    %esp,%ebp
+  803906:	57                   	push   %edi
+  803907:	56                   	push   %esi
+  803908:	53                   	push   %ebx
+  803909:	83 ec 1c             	sub    $0x1c,%esp
+  80390c:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80390e:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  803914:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80391b:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803920:	77 0d                	ja     80392f <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803922:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803927:	29 d0                	sub    %edx,%eax
+  803929:	c1 e8 10             	shr    $0x10,%eax
+  80392c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  80392f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803934:	eb 2f                	jmp    803965 <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  803936:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  80393c:	8b 01                	mov    (%ecx),%eax
+  80393e:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  803941:	39 c2                	cmp    %eax,%edx
+  803943:	75 14                	jne    803959 <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  803945:	83 ec 0c             	sub    $0xc,%esp
+  803948:	57                   	push   %edi
+  803949:	e8 a5 d2 ff ff       	call   800bf3 <sys_env_destroy>
+  80394e:	83 c4 10             	add    $0x10,%esp
+  803951:	85 c0                	test   %eax,%eax
+  803953:	0f 88 97 00 00 00    	js     8039f0 <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  803959:	83 c3 01             	add    $0x1,%ebx
+  80395c:	83 fb 20             	cmp    $0x20,%ebx
+  80395f:	0f 84 d2 00 00 00    	je     803a37 <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  803965:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  803968:	74 ef                	je     803959 <pthread_kill_others+0x56>
+  80396a:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80396d:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803974:	8b 40 04             	mov    0x4(%eax),%eax
+  803977:	83 f8 01             	cmp    $0x1,%eax
+  80397a:	75 dd                	jne    803959 <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  80397c:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80397f:	8b 3c 85 40 60 80 00 	mov    0x806040(,%eax,4),%edi
+  803986:	89 fe                	mov    %edi,%esi
+  803988:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  80398e:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803991:	c1 e0 04             	shl    $0x4,%eax
+  803994:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803999:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  80399c:	39 c7                	cmp    %eax,%edi
+  80399e:	75 b9                	jne    803959 <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  8039a0:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  8039a3:	c1 e0 04             	shl    $0x4,%eax
+  8039a6:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8039ab:	8b 40 54             	mov    0x54(%eax),%eax
+  8039ae:	85 c0                	test   %eax,%eax
+  8039b0:	74 a7                	je     803959 <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  8039b2:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  8039b5:	c1 e0 04             	shl    $0x4,%eax
+  8039b8:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  8039be:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8039c0:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  8039c6:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8039cb:	0f 87 65 ff ff ff    	ja     803936 <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8039d1:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8039d6:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  8039d8:	c1 e8 10             	shr    $0x10,%eax
+  8039db:	0f 84 55 ff ff ff    	je     803936 <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8039e1:	c1 e0 10             	shl    $0x10,%eax
+  8039e4:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8039e9:	29 c1                	sub    %eax,%ecx
+  8039eb:	e9 4c ff ff ff       	jmp    80393c <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  8039f0:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  8039f3:	c1 e2 04             	shl    $0x4,%edx
+  8039f6:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8039fc:	8b 52 48             	mov    0x48(%edx),%edx
+  8039ff:	39 fa                	cmp    %edi,%edx
+  803a01:	0f 85 52 ff ff ff    	jne    803959 <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  803a07:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  803a0a:	c1 e2 04             	shl    $0x4,%edx
+  803a0d:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803a13:	8b 52 54             	mov    0x54(%edx),%edx
+  803a16:	85 d2                	test   %edx,%edx
+  803a18:	0f 84 3b ff ff ff    	je     803959 <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  803a1e:	83 ec 0c             	sub    $0xc,%esp
+  803a21:	50                   	push   %eax
+  803a22:	57                   	push   %edi
+  803a23:	68 50 4d 80 00       	push   $0x804d50
+  803a28:	68 bb 00 00 00       	push   $0xbb
+  803a2d:	68 40 4d 80 00       	push   $0x804d40
+  803a32:	e8 62 c7 ff ff       	call   800199 <_panic>
+	}
+}
+  803a37:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a3a:	5b                   	pop    %ebx
+  803a3b:	5e                   	pop    %esi
+  803a3c:	5f                   	pop    %edi
+  803a3d:	5d                   	pop    %ebp
+  803a3e:	c3                   	ret
+
+00803a3f <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  803a3f:	55                   	push   %ebp
+  803a40:	89 e5                	mov    %esp,%ebp
+  803a42:	53                   	push   %ebx
+  803a43:	83 ec 04             	sub    $0x4,%esp
+  803a46:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803a48:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  803a4e:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803a54:	0f 87 85 00 00 00    	ja     803adf <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803a5a:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  803a5f:	29 c3                	sub    %eax,%ebx
+  803a61:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  803a64:	83 ec 04             	sub    $0x4,%esp
+  803a67:	68 80 02 00 00       	push   $0x280
+  803a6c:	6a 00                	push   $0x0
+  803a6e:	68 40 60 80 00       	push   $0x806040
+  803a73:	e8 31 cf ff ff       	call   8009a9 <memset>
+	threads_mu.m_state = 0;
+  803a78:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  803a7f:	00 00 00 
+	if (self != 0) {
+  803a82:	83 c4 10             	add    $0x10,%esp
+  803a85:	85 db                	test   %ebx,%ebx
+  803a87:	74 51                	je     803ada <pthread_fork_child+0x9b>
+  803a89:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803a8b:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803a91:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803a96:	77 18                	ja     803ab0 <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803a98:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803a9d:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803a9f:	c1 e8 10             	shr    $0x10,%eax
+  803aa2:	74 0c                	je     803ab0 <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803aa4:	c1 e0 10             	shl    $0x10,%eax
+  803aa7:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803aac:	29 c2                	sub    %eax,%edx
+  803aae:	eb 06                	jmp    803ab6 <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  803ab0:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		threads[self].th_env = thisenv->env_id;
+  803ab6:	8b 02                	mov    (%edx),%eax
+  803ab8:	8b 48 48             	mov    0x48(%eax),%ecx
+  803abb:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803ac2:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803ac5:	89 0c 95 40 60 80 00 	mov    %ecx,0x806040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  803acc:	8d 04 95 40 60 80 00 	lea    0x806040(,%edx,4),%eax
+  803ad3:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  803ada:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803add:	c9                   	leave
+  803ade:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  803adf:	83 ec 04             	sub    $0x4,%esp
+  803ae2:	68 80 02 00 00       	push   $0x280
+  803ae7:	6a 00                	push   $0x0
+  803ae9:	68 40 60 80 00       	push   $0x806040
+  803aee:	e8 b6 ce ff ff       	call   8009a9 <memset>
+	threads_mu.m_state = 0;
+  803af3:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  803afa:	00 00 00 
+  803afd:	83 c4 10             	add    $0x10,%esp
+  803b00:	eb d8                	jmp    803ada <pthread_fork_child+0x9b>
+
+00803b02 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803b02:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b07:	c3                   	ret
+
+00803b08 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803b08:	55                   	push   %ebp
+  803b09:	89 e5                	mov    %esp,%ebp
+  803b0b:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803b0e:	68 75 4d 80 00       	push   $0x804d75
+  803b13:	ff 75 0c             	push   0xc(%ebp)
+  803b16:	e8 3d cd ff ff       	call   800858 <strcpy>
+	return 0;
+}
+  803b1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b20:	c9                   	leave
+  803b21:	c3                   	ret
+
+00803b22 <devcons_write>:
+{
+  803b22:	55                   	push   %ebp
+  803b23:	89 e5                	mov    %esp,%ebp
+  803b25:	57                   	push   %edi
+  803b26:	56                   	push   %esi
+  803b27:	53                   	push   %ebx
+  803b28:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803b2e:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803b33:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803b39:	eb 2e                	jmp    803b69 <devcons_write+0x47>
+		m = n - tot;
+  803b3b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803b3e:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803b40:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803b45:	39 c3                	cmp    %eax,%ebx
+  803b47:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803b4a:	83 ec 04             	sub    $0x4,%esp
+  803b4d:	53                   	push   %ebx
+  803b4e:	89 f0                	mov    %esi,%eax
+  803b50:	03 45 0c             	add    0xc(%ebp),%eax
+  803b53:	50                   	push   %eax
+  803b54:	57                   	push   %edi
+  803b55:	e8 84 ce ff ff       	call   8009de <memmove>
+		sys_cputs(buf, m);
+  803b5a:	83 c4 08             	add    $0x8,%esp
+  803b5d:	53                   	push   %ebx
+  803b5e:	57                   	push   %edi
+  803b5f:	e8 38 d0 ff ff       	call   800b9c <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803b64:	01 de                	add    %ebx,%esi
+  803b66:	83 c4 10             	add    $0x10,%esp
+  803b69:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803b6c:	72 cd                	jb     803b3b <devcons_write+0x19>
+}
+  803b6e:	89 f0                	mov    %esi,%eax
+  803b70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803b73:	5b                   	pop    %ebx
+  803b74:	5e                   	pop    %esi
+  803b75:	5f                   	pop    %edi
+  803b76:	5d                   	pop    %ebp
+  803b77:	c3                   	ret
+
+00803b78 <devcons_read>:
+{
+  803b78:	55                   	push   %ebp
+  803b79:	89 e5                	mov    %esp,%ebp
+  803b7b:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  803b7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b83:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803b87:	75 07                	jne    803b90 <devcons_read+0x18>
+  803b89:	eb 1f                	jmp    803baa <devcons_read+0x32>
+		sys_yield();
+  803b8b:	e8 da d0 ff ff       	call   800c6a <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  803b90:	e8 32 d0 ff ff       	call   800bc7 <sys_cgetc>
+  803b95:	85 c0                	test   %eax,%eax
+  803b97:	74 f2                	je     803b8b <devcons_read+0x13>
+	if (c < 0)
+  803b99:	78 0f                	js     803baa <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  803b9b:	83 f8 04             	cmp    $0x4,%eax
+  803b9e:	74 0c                	je     803bac <devcons_read+0x34>
+	*(char*)vbuf = c;
+  803ba0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803ba3:	88 02                	mov    %al,(%edx)
+	return 1;
+  803ba5:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803baa:	c9                   	leave
+  803bab:	c3                   	ret
+		return 0;
+  803bac:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bb1:	eb f7                	jmp    803baa <devcons_read+0x32>
+
+00803bb3 <cputchar>:
+{
+  803bb3:	55                   	push   %ebp
+  803bb4:	89 e5                	mov    %esp,%ebp
+  803bb6:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803bb9:	8b 45 08             	mov    0x8(%ebp),%eax
+  803bbc:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803bbf:	6a 01                	push   $0x1
+  803bc1:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803bc4:	50                   	push   %eax
+  803bc5:	e8 d2 cf ff ff       	call   800b9c <sys_cputs>
+}
+  803bca:	83 c4 10             	add    $0x10,%esp
+  803bcd:	c9                   	leave
+  803bce:	c3                   	ret
+
+00803bcf <getchar>:
+{
+  803bcf:	55                   	push   %ebp
+  803bd0:	89 e5                	mov    %esp,%ebp
+  803bd2:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803bd5:	6a 01                	push   $0x1
+  803bd7:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803bda:	50                   	push   %eax
+  803bdb:	6a 00                	push   $0x0
+  803bdd:	e8 63 d8 ff ff       	call   801445 <read>
+	if (r < 0)
+  803be2:	83 c4 10             	add    $0x10,%esp
+  803be5:	85 c0                	test   %eax,%eax
+  803be7:	78 06                	js     803bef <getchar+0x20>
+	if (r < 1)
+  803be9:	74 06                	je     803bf1 <getchar+0x22>
+	return c;
+  803beb:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803bef:	c9                   	leave
+  803bf0:	c3                   	ret
+		return -E_EOF;
+  803bf1:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803bf6:	eb f7                	jmp    803bef <getchar+0x20>
+
+00803bf8 <iscons>:
+{
+  803bf8:	55                   	push   %ebp
+  803bf9:	89 e5                	mov    %esp,%ebp
+  803bfb:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803bfe:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803c01:	50                   	push   %eax
+  803c02:	ff 75 08             	push   0x8(%ebp)
+  803c05:	e8 ab d5 ff ff       	call   8011b5 <fd_lookup>
+  803c0a:	83 c4 10             	add    $0x10,%esp
+  803c0d:	85 c0                	test   %eax,%eax
+  803c0f:	78 11                	js     803c22 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803c11:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803c14:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  803c1a:	39 10                	cmp    %edx,(%eax)
+  803c1c:	0f 94 c0             	sete   %al
+  803c1f:	0f b6 c0             	movzbl %al,%eax
+}
+  803c22:	c9                   	leave
+  803c23:	c3                   	ret
+
+00803c24 <opencons>:
+{
+  803c24:	55                   	push   %ebp
+  803c25:	89 e5                	mov    %esp,%ebp
+  803c27:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803c2a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803c2d:	50                   	push   %eax
+  803c2e:	e8 2c d5 ff ff       	call   80115f <fd_alloc>
+  803c33:	83 c4 10             	add    $0x10,%esp
+  803c36:	85 c0                	test   %eax,%eax
+  803c38:	78 3a                	js     803c74 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803c3a:	83 ec 04             	sub    $0x4,%esp
+  803c3d:	68 07 04 00 00       	push   $0x407
+  803c42:	ff 75 f4             	push   -0xc(%ebp)
+  803c45:	6a 00                	push   $0x0
+  803c47:	e8 4a d0 ff ff       	call   800c96 <sys_page_alloc>
+  803c4c:	83 c4 10             	add    $0x10,%esp
+  803c4f:	85 c0                	test   %eax,%eax
+  803c51:	78 21                	js     803c74 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803c53:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803c56:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  803c5c:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803c5e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803c61:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803c68:	83 ec 0c             	sub    $0xc,%esp
+  803c6b:	50                   	push   %eax
+  803c6c:	e8 c7 d4 ff ff       	call   801138 <fd2num>
+  803c71:	83 c4 10             	add    $0x10,%esp
+}
+  803c74:	c9                   	leave
+  803c75:	c3                   	ret
+
+00803c76 <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  803c76:	55                   	push   %ebp
+  803c77:	89 e5                	mov    %esp,%ebp
+  803c79:	57                   	push   %edi
+  803c7a:	56                   	push   %esi
+  803c7b:	53                   	push   %ebx
+  803c7c:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  803c7f:	89 d6                	mov    %edx,%esi
+  803c81:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  803c84:	89 cf                	mov    %ecx,%edi
+  803c86:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  803c89:	89 fa                	mov    %edi,%edx
+  803c8b:	80 ce 08             	or     $0x8,%dh
+  803c8e:	f6 c5 08             	test   $0x8,%ch
+  803c91:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  803c94:	57                   	push   %edi
+  803c95:	56                   	push   %esi
+  803c96:	50                   	push   %eax
+  803c97:	56                   	push   %esi
+  803c98:	6a 00                	push   $0x0
+  803c9a:	e8 44 d0 ff ff       	call   800ce3 <sys_page_map>
+	if (r < 0) {
+  803c9f:	83 c4 20             	add    $0x20,%esp
+  803ca2:	85 c0                	test   %eax,%eax
+  803ca4:	78 27                	js     803ccd <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  803ca6:	83 ec 0c             	sub    $0xc,%esp
+  803ca9:	57                   	push   %edi
+  803caa:	56                   	push   %esi
+  803cab:	6a 00                	push   $0x0
+  803cad:	56                   	push   %esi
+  803cae:	6a 00                	push   $0x0
+  803cb0:	e8 2e d0 ff ff       	call   800ce3 <sys_page_map>
+  803cb5:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803cb7:	83 c4 20             	add    $0x20,%esp
+  803cba:	85 c0                	test   %eax,%eax
+  803cbc:	78 24                	js     803ce2 <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  803cbe:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803cc3:	89 d8                	mov    %ebx,%eax
+  803cc5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803cc8:	5b                   	pop    %ebx
+  803cc9:	5e                   	pop    %esi
+  803cca:	5f                   	pop    %edi
+  803ccb:	5d                   	pop    %ebp
+  803ccc:	c3                   	ret
+  803ccd:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803ccf:	83 ec 08             	sub    $0x8,%esp
+  803cd2:	50                   	push   %eax
+  803cd3:	68 84 4d 80 00       	push   $0x804d84
+  803cd8:	e8 97 c5 ff ff       	call   800274 <cprintf>
+		return r;
+  803cdd:	83 c4 10             	add    $0x10,%esp
+  803ce0:	eb e1                	jmp    803cc3 <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  803ce2:	83 ec 08             	sub    $0x8,%esp
+  803ce5:	50                   	push   %eax
+  803ce6:	68 b4 4d 80 00       	push   $0x804db4
+  803ceb:	e8 84 c5 ff ff       	call   800274 <cprintf>
+		return r;
+  803cf0:	83 c4 10             	add    $0x10,%esp
+  803cf3:	eb ce                	jmp    803cc3 <duppage_cow+0x4d>
+
+00803cf5 <duppage>:
+{
+  803cf5:	55                   	push   %ebp
+  803cf6:	89 e5                	mov    %esp,%ebp
+  803cf8:	53                   	push   %ebx
+  803cf9:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  803cfc:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  803cff:	51                   	push   %ecx
+  803d00:	52                   	push   %edx
+  803d01:	50                   	push   %eax
+  803d02:	52                   	push   %edx
+  803d03:	6a 00                	push   $0x0
+  803d05:	e8 d9 cf ff ff       	call   800ce3 <sys_page_map>
+	if (r < 0) {
+  803d0a:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  803d0d:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  803d12:	85 c0                	test   %eax,%eax
+  803d14:	78 07                	js     803d1d <duppage+0x28>
+}
+  803d16:	89 d8                	mov    %ebx,%eax
+  803d18:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803d1b:	c9                   	leave
+  803d1c:	c3                   	ret
+  803d1d:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803d1f:	83 ec 08             	sub    $0x8,%esp
+  803d22:	50                   	push   %eax
+  803d23:	68 84 4d 80 00       	push   $0x804d84
+  803d28:	e8 47 c5 ff ff       	call   800274 <cprintf>
+		return r;
+  803d2d:	83 c4 10             	add    $0x10,%esp
+  803d30:	eb e4                	jmp    803d16 <duppage+0x21>
+
+00803d32 <cow_copy>:
+{
+  803d32:	55                   	push   %ebp
+  803d33:	89 e5                	mov    %esp,%ebp
+  803d35:	56                   	push   %esi
+  803d36:	53                   	push   %ebx
+  803d37:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  803d39:	83 ec 04             	sub    $0x4,%esp
+  803d3c:	6a 07                	push   $0x7
+  803d3e:	68 00 f0 7f 00       	push   $0x7ff000
+  803d43:	6a 00                	push   $0x0
+  803d45:	e8 4c cf ff ff       	call   800c96 <sys_page_alloc>
+	if (r < 0) {
+  803d4a:	83 c4 10             	add    $0x10,%esp
+  803d4d:	85 c0                	test   %eax,%eax
+  803d4f:	78 58                	js     803da9 <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  803d51:	83 ec 04             	sub    $0x4,%esp
+  803d54:	68 00 10 00 00       	push   $0x1000
+  803d59:	56                   	push   %esi
+  803d5a:	68 00 f0 7f 00       	push   $0x7ff000
+  803d5f:	e8 7a cc ff ff       	call   8009de <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  803d64:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  803d6b:	56                   	push   %esi
+  803d6c:	6a 00                	push   $0x0
+  803d6e:	68 00 f0 7f 00       	push   $0x7ff000
+  803d73:	6a 00                	push   $0x0
+  803d75:	e8 69 cf ff ff       	call   800ce3 <sys_page_map>
+  803d7a:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803d7c:	83 c4 20             	add    $0x20,%esp
+  803d7f:	85 c0                	test   %eax,%eax
+  803d81:	78 3b                	js     803dbe <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  803d83:	83 ec 08             	sub    $0x8,%esp
+  803d86:	68 00 f0 7f 00       	push   $0x7ff000
+  803d8b:	6a 00                	push   $0x0
+  803d8d:	e8 9d cf ff ff       	call   800d2f <sys_page_unmap>
+  803d92:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803d94:	83 c4 10             	add    $0x10,%esp
+  803d97:	85 c0                	test   %eax,%eax
+  803d99:	78 45                	js     803de0 <cow_copy+0xae>
+	return 0;
+  803d9b:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803da0:	89 d8                	mov    %ebx,%eax
+  803da2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803da5:	5b                   	pop    %ebx
+  803da6:	5e                   	pop    %esi
+  803da7:	5d                   	pop    %ebp
+  803da8:	c3                   	ret
+  803da9:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  803dab:	83 ec 08             	sub    $0x8,%esp
+  803dae:	50                   	push   %eax
+  803daf:	68 a4 4e 80 00       	push   $0x804ea4
+  803db4:	e8 bb c4 ff ff       	call   800274 <cprintf>
+		return r;
+  803db9:	83 c4 10             	add    $0x10,%esp
+  803dbc:	eb e2                	jmp    803da0 <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  803dbe:	83 ec 08             	sub    $0x8,%esp
+  803dc1:	50                   	push   %eax
+  803dc2:	68 c0 4e 80 00       	push   $0x804ec0
+  803dc7:	e8 a8 c4 ff ff       	call   800274 <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  803dcc:	83 c4 08             	add    $0x8,%esp
+  803dcf:	68 00 f0 7f 00       	push   $0x7ff000
+  803dd4:	6a 00                	push   $0x0
+  803dd6:	e8 54 cf ff ff       	call   800d2f <sys_page_unmap>
+		return r;
+  803ddb:	83 c4 10             	add    $0x10,%esp
+  803dde:	eb c0                	jmp    803da0 <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  803de0:	83 ec 08             	sub    $0x8,%esp
+  803de3:	50                   	push   %eax
+  803de4:	68 dc 4d 80 00       	push   $0x804ddc
+  803de9:	e8 86 c4 ff ff       	call   800274 <cprintf>
+		return r;
+  803dee:	83 c4 10             	add    $0x10,%esp
+  803df1:	eb ad                	jmp    803da0 <cow_copy+0x6e>
+
+00803df3 <pgfault>:
+{
+  803df3:	55                   	push   %ebp
+  803df4:	89 e5                	mov    %esp,%ebp
+  803df6:	56                   	push   %esi
+  803df7:	53                   	push   %ebx
+  803df8:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  803dfb:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  803dfd:	89 d8                	mov    %ebx,%eax
+  803dff:	c1 e8 16             	shr    $0x16,%eax
+  803e02:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  803e09:	89 de                	mov    %ebx,%esi
+  803e0b:	c1 ee 0c             	shr    $0xc,%esi
+  803e0e:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  803e15:	a8 07                	test   $0x7,%al
+  803e17:	74 3b                	je     803e54 <pgfault+0x61>
+  803e19:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  803e1f:	74 33                	je     803e54 <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  803e21:	83 ec 0c             	sub    $0xc,%esp
+  803e24:	68 00 f0 bf ee       	push   $0xeebff000
+  803e29:	e8 c8 f4 ff ff       	call   8032f6 <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  803e2e:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  803e35:	83 c4 10             	add    $0x10,%esp
+  803e38:	f6 c4 08             	test   $0x8,%ah
+  803e3b:	75 30                	jne    803e6d <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  803e3d:	83 ec 0c             	sub    $0xc,%esp
+  803e40:	68 00 f0 bf ee       	push   $0xeebff000
+  803e45:	e8 19 f5 ff ff       	call   803363 <mutex_unlock>
+}
+  803e4a:	83 c4 10             	add    $0x10,%esp
+  803e4d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803e50:	5b                   	pop    %ebx
+  803e51:	5e                   	pop    %esi
+  803e52:	5d                   	pop    %ebp
+  803e53:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  803e54:	83 ec 08             	sub    $0x8,%esp
+  803e57:	ff 72 28             	push   0x28(%edx)
+  803e5a:	51                   	push   %ecx
+  803e5b:	50                   	push   %eax
+  803e5c:	68 00 4e 80 00       	push   $0x804e00
+  803e61:	6a 3f                	push   $0x3f
+  803e63:	68 da 4e 80 00       	push   $0x804eda
+  803e68:	e8 2c c3 ff ff       	call   800199 <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  803e6d:	89 d8                	mov    %ebx,%eax
+  803e6f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  803e74:	e8 b9 fe ff ff       	call   803d32 <cow_copy>
+  803e79:	eb c2                	jmp    803e3d <pgfault+0x4a>
+
+00803e7b <cow_enable>:
+{
+  803e7b:	55                   	push   %ebp
+  803e7c:	89 e5                	mov    %esp,%ebp
+  803e7e:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  803e81:	68 f3 3d 80 00       	push   $0x803df3
+  803e86:	e8 28 06 00 00       	call   8044b3 <set_pgfault_handler>
+}
+  803e8b:	83 c4 10             	add    $0x10,%esp
+  803e8e:	c9                   	leave
+  803e8f:	c3                   	ret
+
+00803e90 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  803e90:	55                   	push   %ebp
+  803e91:	89 e5                	mov    %esp,%ebp
+  803e93:	57                   	push   %edi
+  803e94:	56                   	push   %esi
+  803e95:	53                   	push   %ebx
+  803e96:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  803e99:	68 f3 3d 80 00       	push   $0x803df3
+  803e9e:	e8 10 06 00 00       	call   8044b3 <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  803ea3:	b8 07 00 00 00       	mov    $0x7,%eax
+  803ea8:	cd 30                	int    $0x30
+  803eaa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  803ead:	83 c4 10             	add    $0x10,%esp
+  803eb0:	85 c0                	test   %eax,%eax
+  803eb2:	78 4b                	js     803eff <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  803eb4:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  803eb9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803ebe:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  803ec1:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  803ec5:	0f 85 16 01 00 00    	jne    803fe1 <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803ecb:	e8 6e cd ff ff       	call   800c3e <sys_getenvid>
+  803ed0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803ed5:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803ed7:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  803edd:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803ee3:	77 32                	ja     803f17 <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803ee5:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  803eea:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  803eec:	c1 ea 10             	shr    $0x10,%edx
+  803eef:	74 26                	je     803f17 <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803ef1:	c1 e2 10             	shl    $0x10,%edx
+  803ef4:	89 d1                	mov    %edx,%ecx
+  803ef6:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803efb:	29 ca                	sub    %ecx,%edx
+  803efd:	eb 1e                	jmp    803f1d <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  803eff:	83 ec 08             	sub    $0x8,%esp
+  803f02:	89 c7                	mov    %eax,%edi
+  803f04:	50                   	push   %eax
+  803f05:	68 e5 4e 80 00       	push   $0x804ee5
+  803f0a:	e8 65 c3 ff ff       	call   800274 <cprintf>
+		return eid;
+  803f0f:	83 c4 10             	add    $0x10,%esp
+  803f12:	e9 6c 01 00 00       	jmp    804083 <fork+0x1f3>
+		return pthread_main_tls;
+  803f17:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803f1d:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  803f20:	c1 e0 04             	shl    $0x4,%eax
+  803f23:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803f28:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  803f2a:	e8 10 fb ff ff       	call   803a3f <pthread_fork_child>
+		return eid;
+  803f2f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  803f32:	e9 4c 01 00 00       	jmp    804083 <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  803f37:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  803f3d:	89 da                	mov    %ebx,%edx
+  803f3f:	89 f8                	mov    %edi,%eax
+  803f41:	e8 af fd ff ff       	call   803cf5 <duppage>
+  803f46:	85 c0                	test   %eax,%eax
+  803f48:	79 28                	jns    803f72 <fork+0xe2>
+  803f4a:	89 c7                	mov    %eax,%edi
+  803f4c:	e9 32 01 00 00       	jmp    804083 <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  803f51:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  803f57:	83 f9 05             	cmp    $0x5,%ecx
+  803f5a:	75 58                	jne    803fb4 <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  803f5c:	b9 05 00 00 00       	mov    $0x5,%ecx
+  803f61:	89 da                	mov    %ebx,%edx
+  803f63:	89 f8                	mov    %edi,%eax
+  803f65:	e8 8b fd ff ff       	call   803cf5 <duppage>
+  803f6a:	85 c0                	test   %eax,%eax
+  803f6c:	0f 88 0f 01 00 00    	js     804081 <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  803f72:	83 c3 01             	add    $0x1,%ebx
+  803f75:	39 de                	cmp    %ebx,%esi
+  803f77:	74 54                	je     803fcd <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  803f79:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  803f80:	f6 c1 05             	test   $0x5,%cl
+  803f83:	74 ed                	je     803f72 <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  803f85:	f6 c5 04             	test   $0x4,%ch
+  803f88:	75 ad                	jne    803f37 <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  803f8a:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  803f90:	74 bf                	je     803f51 <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  803f92:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  803f98:	74 d8                	je     803f72 <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  803f9a:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  803fa0:	89 da                	mov    %ebx,%edx
+  803fa2:	89 f8                	mov    %edi,%eax
+  803fa4:	e8 cd fc ff ff       	call   803c76 <duppage_cow>
+  803fa9:	85 c0                	test   %eax,%eax
+  803fab:	79 c5                	jns    803f72 <fork+0xe2>
+  803fad:	89 c7                	mov    %eax,%edi
+  803faf:	e9 cf 00 00 00       	jmp    804083 <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  803fb4:	68 30 4e 80 00       	push   $0x804e30
+  803fb9:	68 3d 4c 80 00       	push   $0x804c3d
+  803fbe:	68 c6 00 00 00       	push   $0xc6
+  803fc3:	68 da 4e 80 00       	push   $0x804eda
+  803fc8:	e8 cc c1 ff ff       	call   800199 <_panic>
+  803fcd:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  803fd0:	83 c1 01             	add    $0x1,%ecx
+  803fd3:	81 c6 00 04 00 00    	add    $0x400,%esi
+  803fd9:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  803fdf:	74 18                	je     803ff9 <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  803fe1:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  803fe8:	a8 07                	test   $0x7,%al
+  803fea:	74 e4                	je     803fd0 <fork+0x140>
+  803fec:	89 cb                	mov    %ecx,%ebx
+  803fee:	c1 e3 0a             	shl    $0xa,%ebx
+  803ff1:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  803ff4:	e9 7c ff ff ff       	jmp    803f75 <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  803ff9:	83 ec 04             	sub    $0x4,%esp
+  803ffc:	6a 07                	push   $0x7
+  803ffe:	68 00 f0 bf ee       	push   $0xeebff000
+  804003:	ff 75 e4             	push   -0x1c(%ebp)
+  804006:	e8 8b cc ff ff       	call   800c96 <sys_page_alloc>
+  80400b:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80400d:	83 c4 10             	add    $0x10,%esp
+  804010:	85 c0                	test   %eax,%eax
+  804012:	78 34                	js     804048 <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  804014:	83 ec 08             	sub    $0x8,%esp
+  804017:	68 f1 44 80 00       	push   $0x8044f1
+  80401c:	ff 75 e4             	push   -0x1c(%ebp)
+  80401f:	e8 ef cd ff ff       	call   800e13 <sys_env_set_pgfault_upcall>
+  804024:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804026:	83 c4 10             	add    $0x10,%esp
+  804029:	85 c0                	test   %eax,%eax
+  80402b:	78 2e                	js     80405b <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  80402d:	83 ec 08             	sub    $0x8,%esp
+  804030:	6a 02                	push   $0x2
+  804032:	ff 75 e4             	push   -0x1c(%ebp)
+  804035:	e8 41 cd ff ff       	call   800d7b <sys_env_set_status>
+  80403a:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80403c:	83 c4 10             	add    $0x10,%esp
+  80403f:	85 c0                	test   %eax,%eax
+  804041:	78 2b                	js     80406e <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  804043:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804046:	eb 3b                	jmp    804083 <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  804048:	83 ec 08             	sub    $0x8,%esp
+  80404b:	50                   	push   %eax
+  80404c:	68 58 4e 80 00       	push   $0x804e58
+  804051:	e8 1e c2 ff ff       	call   800274 <cprintf>
+		return r;
+  804056:	83 c4 10             	add    $0x10,%esp
+  804059:	eb 28                	jmp    804083 <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  80405b:	83 ec 08             	sub    $0x8,%esp
+  80405e:	50                   	push   %eax
+  80405f:	68 80 4e 80 00       	push   $0x804e80
+  804064:	e8 0b c2 ff ff       	call   800274 <cprintf>
+		return r;
+  804069:	83 c4 10             	add    $0x10,%esp
+  80406c:	eb 15                	jmp    804083 <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  80406e:	83 ec 08             	sub    $0x8,%esp
+  804071:	50                   	push   %eax
+  804072:	68 f5 4e 80 00       	push   $0x804ef5
+  804077:	e8 f8 c1 ff ff       	call   800274 <cprintf>
+		return r;
+  80407c:	83 c4 10             	add    $0x10,%esp
+  80407f:	eb 02                	jmp    804083 <fork+0x1f3>
+  804081:	89 c7                	mov    %eax,%edi
+}
+  804083:	89 f8                	mov    %edi,%eax
+  804085:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804088:	5b                   	pop    %ebx
+  804089:	5e                   	pop    %esi
+  80408a:	5f                   	pop    %edi
+  80408b:	5d                   	pop    %ebp
+  80408c:	c3                   	ret
+
+0080408d <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  80408d:	55                   	push   %ebp
+  80408e:	89 e5                	mov    %esp,%ebp
+  804090:	57                   	push   %edi
+  804091:	56                   	push   %esi
+  804092:	53                   	push   %ebx
+  804093:	83 ec 2c             	sub    $0x2c,%esp
+  804096:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804098:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  80409e:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8040a3:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8040a9:	77 0a                	ja     8040b5 <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8040ab:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  8040b0:	29 c3                	sub    %eax,%ebx
+  8040b2:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  8040b5:	83 ec 0c             	sub    $0xc,%esp
+  8040b8:	68 f3 3d 80 00       	push   $0x803df3
+  8040bd:	e8 f1 03 00 00       	call   8044b3 <set_pgfault_handler>
+  8040c2:	b8 07 00 00 00       	mov    $0x7,%eax
+  8040c7:	cd 30                	int    $0x30
+  8040c9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  8040cc:	83 c4 10             	add    $0x10,%esp
+  8040cf:	85 c0                	test   %eax,%eax
+  8040d1:	78 30                	js     804103 <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  8040d3:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8040d7:	74 42                	je     80411b <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  8040d9:	c1 e3 10             	shl    $0x10,%ebx
+  8040dc:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  8040e1:	29 d8                	sub    %ebx,%eax
+  8040e3:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8040e6:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  8040eb:	29 d8                	sub    %ebx,%eax
+  8040ed:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8040f0:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8040f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8040fa:	89 f7                	mov    %esi,%edi
+  8040fc:	89 d6                	mov    %edx,%esi
+  8040fe:	e9 2c 01 00 00       	jmp    80422f <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  804103:	83 ec 08             	sub    $0x8,%esp
+  804106:	89 c7                	mov    %eax,%edi
+  804108:	50                   	push   %eax
+  804109:	68 e5 4e 80 00       	push   $0x804ee5
+  80410e:	e8 61 c1 ff ff       	call   800274 <cprintf>
+		return eid;
+  804113:	83 c4 10             	add    $0x10,%esp
+  804116:	e9 d5 00 00 00       	jmp    8041f0 <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80411b:	e8 1e cb ff ff       	call   800c3e <sys_getenvid>
+  804120:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804125:	89 c2                	mov    %eax,%edx
+  804127:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804129:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  80412f:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804134:	77 18                	ja     80414e <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804136:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80413b:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  80413d:	c1 e8 10             	shr    $0x10,%eax
+  804140:	74 0c                	je     80414e <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804142:	c1 e0 10             	shl    $0x10,%eax
+  804145:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80414a:	29 c1                	sub    %eax,%ecx
+  80414c:	eb 06                	jmp    804154 <sfork+0xc7>
+		return pthread_main_tls;
+  80414e:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+  804154:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804157:	c1 e0 04             	shl    $0x4,%eax
+  80415a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80415f:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  804161:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  804164:	e9 87 00 00 00       	jmp    8041f0 <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  804169:	f6 c5 04             	test   $0x4,%ch
+  80416c:	74 6c                	je     8041da <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  80416e:	89 ca                	mov    %ecx,%edx
+  804170:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  804176:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  80417c:	74 7c                	je     8041fa <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  80417e:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  804184:	89 da                	mov    %ebx,%edx
+  804186:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804189:	e8 67 fb ff ff       	call   803cf5 <duppage>
+  80418e:	85 c0                	test   %eax,%eax
+  804190:	0f 88 4f 01 00 00    	js     8042e5 <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  804196:	83 c3 01             	add    $0x1,%ebx
+  804199:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  80419c:	74 7a                	je     804218 <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  80419e:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  8041a0:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  8041a7:	f6 c1 01             	test   $0x1,%cl
+  8041aa:	74 ea                	je     804196 <sfork+0x109>
+  8041ac:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8041b2:	74 e2                	je     804196 <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  8041b4:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  8041ba:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  8041bd:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  8041c2:	76 a5                	jbe    804169 <sfork+0xdc>
+  8041c4:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  8041ca:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8041cd:	39 fa                	cmp    %edi,%edx
+  8041cf:	73 9d                	jae    80416e <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  8041d1:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  8041d4:	39 fa                	cmp    %edi,%edx
+  8041d6:	72 96                	jb     80416e <sfork+0xe1>
+  8041d8:	eb 8f                	jmp    804169 <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8041da:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8041e0:	89 da                	mov    %ebx,%edx
+  8041e2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8041e5:	e8 8c fa ff ff       	call   803c76 <duppage_cow>
+  8041ea:	85 c0                	test   %eax,%eax
+  8041ec:	79 a8                	jns    804196 <sfork+0x109>
+  8041ee:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  8041f0:	89 f8                	mov    %edi,%eax
+  8041f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8041f5:	5b                   	pop    %ebx
+  8041f6:	5e                   	pop    %esi
+  8041f7:	5f                   	pop    %edi
+  8041f8:	5d                   	pop    %ebp
+  8041f9:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  8041fa:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  8041ff:	e8 2e fb ff ff       	call   803d32 <cow_copy>
+  804204:	85 c0                	test   %eax,%eax
+  804206:	0f 88 d2 00 00 00    	js     8042de <sfork+0x251>
+				pte = uvpt[pn];
+  80420c:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  804213:	e9 66 ff ff ff       	jmp    80417e <sfork+0xf1>
+  804218:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80421b:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80421e:	83 c6 01             	add    $0x1,%esi
+  804221:	81 c7 00 04 00 00    	add    $0x400,%edi
+  804227:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  80422d:	74 1b                	je     80424a <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  80422f:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  804236:	a8 01                	test   $0x1,%al
+  804238:	74 e4                	je     80421e <sfork+0x191>
+  80423a:	89 f3                	mov    %esi,%ebx
+  80423c:	c1 e3 0a             	shl    $0xa,%ebx
+  80423f:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  804242:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  804245:	e9 4f ff ff ff       	jmp    804199 <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  80424a:	83 ec 04             	sub    $0x4,%esp
+  80424d:	6a 07                	push   $0x7
+  80424f:	68 00 f0 bf ee       	push   $0xeebff000
+  804254:	ff 75 e0             	push   -0x20(%ebp)
+  804257:	e8 3a ca ff ff       	call   800c96 <sys_page_alloc>
+  80425c:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80425e:	83 c4 10             	add    $0x10,%esp
+  804261:	85 c0                	test   %eax,%eax
+  804263:	78 37                	js     80429c <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  804265:	83 ec 08             	sub    $0x8,%esp
+  804268:	68 f1 44 80 00       	push   $0x8044f1
+  80426d:	ff 75 e0             	push   -0x20(%ebp)
+  804270:	e8 9e cb ff ff       	call   800e13 <sys_env_set_pgfault_upcall>
+  804275:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804277:	83 c4 10             	add    $0x10,%esp
+  80427a:	85 c0                	test   %eax,%eax
+  80427c:	78 34                	js     8042b2 <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  80427e:	83 ec 08             	sub    $0x8,%esp
+  804281:	6a 02                	push   $0x2
+  804283:	ff 75 e0             	push   -0x20(%ebp)
+  804286:	e8 f0 ca ff ff       	call   800d7b <sys_env_set_status>
+  80428b:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80428d:	83 c4 10             	add    $0x10,%esp
+  804290:	85 c0                	test   %eax,%eax
+  804292:	78 34                	js     8042c8 <sfork+0x23b>
+	return eid;
+  804294:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  804297:	e9 54 ff ff ff       	jmp    8041f0 <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  80429c:	83 ec 08             	sub    $0x8,%esp
+  80429f:	50                   	push   %eax
+  8042a0:	68 58 4e 80 00       	push   $0x804e58
+  8042a5:	e8 ca bf ff ff       	call   800274 <cprintf>
+		return r;
+  8042aa:	83 c4 10             	add    $0x10,%esp
+  8042ad:	e9 3e ff ff ff       	jmp    8041f0 <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  8042b2:	83 ec 08             	sub    $0x8,%esp
+  8042b5:	50                   	push   %eax
+  8042b6:	68 80 4e 80 00       	push   $0x804e80
+  8042bb:	e8 b4 bf ff ff       	call   800274 <cprintf>
+		return r;
+  8042c0:	83 c4 10             	add    $0x10,%esp
+  8042c3:	e9 28 ff ff ff       	jmp    8041f0 <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  8042c8:	83 ec 08             	sub    $0x8,%esp
+  8042cb:	50                   	push   %eax
+  8042cc:	68 f5 4e 80 00       	push   $0x804ef5
+  8042d1:	e8 9e bf ff ff       	call   800274 <cprintf>
+		return r;
+  8042d6:	83 c4 10             	add    $0x10,%esp
+  8042d9:	e9 12 ff ff ff       	jmp    8041f0 <sfork+0x163>
+  8042de:	89 c7                	mov    %eax,%edi
+  8042e0:	e9 0b ff ff ff       	jmp    8041f0 <sfork+0x163>
+  8042e5:	89 c7                	mov    %eax,%edi
+  8042e7:	e9 04 ff ff ff       	jmp    8041f0 <sfork+0x163>
+
+008042ec <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8042ec:	55                   	push   %ebp
+  8042ed:	89 e5                	mov    %esp,%ebp
+  8042ef:	57                   	push   %edi
+  8042f0:	56                   	push   %esi
+  8042f1:	53                   	push   %ebx
+  8042f2:	83 ec 18             	sub    $0x18,%esp
+  8042f5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8042f8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8042fb:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  8042fe:	85 c0                	test   %eax,%eax
+  804300:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804305:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  804308:	50                   	push   %eax
+  804309:	e8 7e cb ff ff       	call   800e8c <sys_ipc_recv>
+	if (r < 0) {
+  80430e:	83 c4 10             	add    $0x10,%esp
+  804311:	85 c0                	test   %eax,%eax
+  804313:	78 2b                	js     804340 <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  804315:	85 ff                	test   %edi,%edi
+  804317:	74 55                	je     80436e <ipc_recv+0x82>
+  804319:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80431b:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804321:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804326:	77 39                	ja     804361 <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804328:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80432d:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80432f:	c1 e8 10             	shr    $0x10,%eax
+  804332:	74 2d                	je     804361 <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804334:	c1 e0 10             	shl    $0x10,%eax
+  804337:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80433c:	29 c2                	sub    %eax,%edx
+  80433e:	eb 27                	jmp    804367 <ipc_recv+0x7b>
+  804340:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  804342:	83 ec 08             	sub    $0x8,%esp
+  804345:	50                   	push   %eax
+  804346:	68 13 4f 80 00       	push   $0x804f13
+  80434b:	e8 24 bf ff ff       	call   800274 <cprintf>
+		*from_env_store = 0;
+  804350:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  804356:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  80435c:	83 c4 10             	add    $0x10,%esp
+  80435f:	eb 77                	jmp    8043d8 <ipc_recv+0xec>
+		return pthread_main_tls;
+  804361:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  804367:	8b 02                	mov    (%edx),%eax
+  804369:	8b 40 78             	mov    0x78(%eax),%eax
+  80436c:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  80436e:	85 f6                	test   %esi,%esi
+  804370:	74 34                	je     8043a6 <ipc_recv+0xba>
+  804372:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804374:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80437a:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80437f:	77 18                	ja     804399 <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804381:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804386:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804388:	c1 e8 10             	shr    $0x10,%eax
+  80438b:	74 0c                	je     804399 <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80438d:	c1 e0 10             	shl    $0x10,%eax
+  804390:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  804395:	29 c2                	sub    %eax,%edx
+  804397:	eb 06                	jmp    80439f <ipc_recv+0xb3>
+		return pthread_main_tls;
+  804399:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  80439f:	8b 02                	mov    (%edx),%eax
+  8043a1:	8b 40 7c             	mov    0x7c(%eax),%eax
+  8043a4:	89 06                	mov    %eax,(%esi)
+  8043a6:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8043a8:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8043ae:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8043b3:	77 18                	ja     8043cd <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8043b5:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8043ba:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8043bc:	c1 e8 10             	shr    $0x10,%eax
+  8043bf:	74 0c                	je     8043cd <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8043c1:	c1 e0 10             	shl    $0x10,%eax
+  8043c4:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8043c9:	29 c2                	sub    %eax,%edx
+  8043cb:	eb 06                	jmp    8043d3 <ipc_recv+0xe7>
+		return pthread_main_tls;
+  8043cd:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	}
+	return thisenv->env_ipc_value;
+  8043d3:	8b 02                	mov    (%edx),%eax
+  8043d5:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  8043d8:	89 d8                	mov    %ebx,%eax
+  8043da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8043dd:	5b                   	pop    %ebx
+  8043de:	5e                   	pop    %esi
+  8043df:	5f                   	pop    %edi
+  8043e0:	5d                   	pop    %ebp
+  8043e1:	c3                   	ret
+
+008043e2 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8043e2:	55                   	push   %ebp
+  8043e3:	89 e5                	mov    %esp,%ebp
+  8043e5:	57                   	push   %edi
+  8043e6:	56                   	push   %esi
+  8043e7:	53                   	push   %ebx
+  8043e8:	83 ec 0c             	sub    $0xc,%esp
+  8043eb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8043ee:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8043f1:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  8043f4:	85 db                	test   %ebx,%ebx
+  8043f6:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8043fb:	0f 44 d8             	cmove  %eax,%ebx
+  8043fe:	eb 05                	jmp    804405 <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  804400:	e8 65 c8 ff ff       	call   800c6a <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  804405:	57                   	push   %edi
+  804406:	53                   	push   %ebx
+  804407:	ff 75 0c             	push   0xc(%ebp)
+  80440a:	56                   	push   %esi
+  80440b:	e8 4f ca ff ff       	call   800e5f <sys_ipc_try_send>
+		if (r == 0) {
+  804410:	83 c4 10             	add    $0x10,%esp
+  804413:	85 c0                	test   %eax,%eax
+  804415:	74 19                	je     804430 <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  804417:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80441a:	74 e4                	je     804400 <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  80441c:	83 ec 0c             	sub    $0xc,%esp
+  80441f:	50                   	push   %eax
+  804420:	57                   	push   %edi
+  804421:	53                   	push   %ebx
+  804422:	56                   	push   %esi
+  804423:	68 2c 4f 80 00       	push   $0x804f2c
+  804428:	e8 47 be ff ff       	call   800274 <cprintf>
+			return;
+  80442d:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  804430:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804433:	5b                   	pop    %ebx
+  804434:	5e                   	pop    %esi
+  804435:	5f                   	pop    %edi
+  804436:	5d                   	pop    %ebp
+  804437:	c3                   	ret
+
+00804438 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804438:	55                   	push   %ebp
+  804439:	89 e5                	mov    %esp,%ebp
+  80443b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80443e:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  804443:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804446:	c1 e0 04             	shl    $0x4,%eax
+  804449:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80444e:	8b 40 50             	mov    0x50(%eax),%eax
+  804451:	39 c8                	cmp    %ecx,%eax
+  804453:	74 12                	je     804467 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804455:	83 c2 01             	add    $0x1,%edx
+  804458:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  80445e:	75 e3                	jne    804443 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  804460:	b8 00 00 00 00       	mov    $0x0,%eax
+  804465:	eb 0e                	jmp    804475 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  804467:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80446a:	c1 e0 04             	shl    $0x4,%eax
+  80446d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804472:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  804475:	5d                   	pop    %ebp
+  804476:	c3                   	ret
+
+00804477 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804477:	55                   	push   %ebp
+  804478:	89 e5                	mov    %esp,%ebp
+  80447a:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80447d:	89 c2                	mov    %eax,%edx
+  80447f:	c1 ea 16             	shr    $0x16,%edx
+  804482:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  804489:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80448e:	f6 c1 01             	test   $0x1,%cl
+  804491:	74 1c                	je     8044af <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  804493:	c1 e8 0c             	shr    $0xc,%eax
+  804496:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80449d:	a8 01                	test   $0x1,%al
+  80449f:	74 0e                	je     8044af <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8044a1:	c1 e8 0c             	shr    $0xc,%eax
+  8044a4:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  8044ab:	ef 
+  8044ac:	0f b7 d2             	movzwl %dx,%edx
+}
+  8044af:	89 d0                	mov    %edx,%eax
+  8044b1:	5d                   	pop    %ebp
+  8044b2:	c3                   	ret
+
+008044b3 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8044b3:	55                   	push   %ebp
+  8044b4:	89 e5                	mov    %esp,%ebp
+  8044b6:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  8044b9:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  8044c0:	74 0a                	je     8044cc <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8044c2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8044c5:	a3 00 90 80 00       	mov    %eax,0x809000
+}
+  8044ca:	c9                   	leave
+  8044cb:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  8044cc:	83 ec 04             	sub    $0x4,%esp
+  8044cf:	6a 07                	push   $0x7
+  8044d1:	68 00 f0 bf ee       	push   $0xeebff000
+  8044d6:	6a 00                	push   $0x0
+  8044d8:	e8 b9 c7 ff ff       	call   800c96 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8044dd:	83 c4 08             	add    $0x8,%esp
+  8044e0:	68 f1 44 80 00       	push   $0x8044f1
+  8044e5:	6a 00                	push   $0x0
+  8044e7:	e8 27 c9 ff ff       	call   800e13 <sys_env_set_pgfault_upcall>
+  8044ec:	83 c4 10             	add    $0x10,%esp
+  8044ef:	eb d1                	jmp    8044c2 <set_pgfault_handler+0xf>
+
+008044f1 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8044f1:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8044f2:	a1 00 90 80 00       	mov    0x809000,%eax
+	call *%eax
+  8044f7:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8044f9:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  8044fc:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  804500:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  804504:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  804507:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  80450b:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  80450d:	83 c4 08             	add    $0x8,%esp
+	popal
+  804510:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  804511:	83 c4 04             	add    $0x4,%esp
+	popfl
+  804514:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  804515:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  804516:	c3                   	ret
+
+00804517 <udm>:
+  804517:	57                   	push   %edi
+  804518:	56                   	push   %esi
+  804519:	53                   	push   %ebx
+  80451a:	83 ec 20             	sub    $0x20,%esp
+  80451d:	89 44 24 10          	mov    %eax,0x10(%esp)
+  804521:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804525:	8b 44 24 30          	mov    0x30(%esp),%eax
+  804529:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80452d:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804531:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804535:	89 d1                	mov    %edx,%ecx
+  804537:	09 c1                	or     %eax,%ecx
+  804539:	0f 84 91 00 00 00    	je     8045d0 <udm+0xb9>
+  80453f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804544:	ba 00 00 00 00       	mov    $0x0,%edx
+  804549:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80454e:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804555:	00 
+  804556:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80455d:	00 
+  80455e:	eb 08                	jmp    804568 <udm+0x51>
+  804560:	83 e9 01             	sub    $0x1,%ecx
+  804563:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  804566:	74 7c                	je     8045e4 <udm+0xcd>
+  804568:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80456c:	01 c0                	add    %eax,%eax
+  80456e:	89 c6                	mov    %eax,%esi
+  804570:	89 d7                	mov    %edx,%edi
+  804572:	8b 44 24 10          	mov    0x10(%esp),%eax
+  804576:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80457a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80457d:	d3 ea                	shr    %cl,%edx
+  80457f:	f6 c1 20             	test   $0x20,%cl
+  804582:	74 04                	je     804588 <udm+0x71>
+  804584:	89 d0                	mov    %edx,%eax
+  804586:	31 d2                	xor    %edx,%edx
+  804588:	83 e0 01             	and    $0x1,%eax
+  80458b:	89 04 24             	mov    %eax,(%esp)
+  80458e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804595:	00 
+  804596:	8b 04 24             	mov    (%esp),%eax
+  804599:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80459d:	09 f0                	or     %esi,%eax
+  80459f:	09 fa                	or     %edi,%edx
+  8045a1:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8045a5:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8045a9:	39 f0                	cmp    %esi,%eax
+  8045ab:	89 d3                	mov    %edx,%ebx
+  8045ad:	19 fb                	sbb    %edi,%ebx
+  8045af:	72 af                	jb     804560 <udm+0x49>
+  8045b1:	29 f0                	sub    %esi,%eax
+  8045b3:	19 fa                	sbb    %edi,%edx
+  8045b5:	89 cf                	mov    %ecx,%edi
+  8045b7:	c1 ef 05             	shr    $0x5,%edi
+  8045ba:	83 e7 01             	and    $0x1,%edi
+  8045bd:	89 fe                	mov    %edi,%esi
+  8045bf:	83 f6 01             	xor    $0x1,%esi
+  8045c2:	d3 e6                	shl    %cl,%esi
+  8045c4:	d3 e7                	shl    %cl,%edi
+  8045c6:	09 74 24 18          	or     %esi,0x18(%esp)
+  8045ca:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8045ce:	eb 90                	jmp    804560 <udm+0x49>
+  8045d0:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8045d4:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8045d8:	89 f0                	mov    %esi,%eax
+  8045da:	89 fa                	mov    %edi,%edx
+  8045dc:	89 74 24 18          	mov    %esi,0x18(%esp)
+  8045e0:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  8045e4:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  8045e8:	89 01                	mov    %eax,(%ecx)
+  8045ea:	89 51 04             	mov    %edx,0x4(%ecx)
+  8045ed:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8045f1:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8045f5:	83 c4 20             	add    $0x20,%esp
+  8045f8:	5b                   	pop    %ebx
+  8045f9:	5e                   	pop    %esi
+  8045fa:	5f                   	pop    %edi
+  8045fb:	c3                   	ret
+
+008045fc <__udivdi3>:
+  8045fc:	83 ec 18             	sub    $0x18,%esp
+  8045ff:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804603:	50                   	push   %eax
+  804604:	ff 74 24 2c          	push   0x2c(%esp)
+  804608:	ff 74 24 2c          	push   0x2c(%esp)
+  80460c:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804610:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804614:	e8 fe fe ff ff       	call   804517 <udm>
+  804619:	83 c4 24             	add    $0x24,%esp
+  80461c:	c3                   	ret
+
+0080461d <__umoddi3>:
+  80461d:	83 ec 18             	sub    $0x18,%esp
+  804620:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804624:	50                   	push   %eax
+  804625:	ff 74 24 2c          	push   0x2c(%esp)
+  804629:	ff 74 24 2c          	push   0x2c(%esp)
+  80462d:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804631:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804635:	e8 dd fe ff ff       	call   804517 <udm>
+  80463a:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80463e:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804642:	83 c4 24             	add    $0x24,%esp
+  804645:	c3                   	ret
+
+00804646 <__divdi3>:
+  804646:	56                   	push   %esi
+  804647:	53                   	push   %ebx
+  804648:	83 ec 14             	sub    $0x14,%esp
+  80464b:	8b 44 24 20          	mov    0x20(%esp),%eax
+  80464f:	8b 54 24 24          	mov    0x24(%esp),%edx
+  804653:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  804657:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  80465b:	85 d2                	test   %edx,%edx
+  80465d:	78 18                	js     804677 <__divdi3+0x31>
+  80465f:	85 db                	test   %ebx,%ebx
+  804661:	78 3e                	js     8046a1 <__divdi3+0x5b>
+  804663:	83 ec 04             	sub    $0x4,%esp
+  804666:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80466a:	56                   	push   %esi
+  80466b:	53                   	push   %ebx
+  80466c:	51                   	push   %ecx
+  80466d:	e8 a5 fe ff ff       	call   804517 <udm>
+  804672:	83 c4 10             	add    $0x10,%esp
+  804675:	eb 24                	jmp    80469b <__divdi3+0x55>
+  804677:	f7 d8                	neg    %eax
+  804679:	83 d2 00             	adc    $0x0,%edx
+  80467c:	f7 da                	neg    %edx
+  80467e:	85 db                	test   %ebx,%ebx
+  804680:	78 3a                	js     8046bc <__divdi3+0x76>
+  804682:	83 ec 04             	sub    $0x4,%esp
+  804685:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804689:	56                   	push   %esi
+  80468a:	53                   	push   %ebx
+  80468b:	51                   	push   %ecx
+  80468c:	e8 86 fe ff ff       	call   804517 <udm>
+  804691:	83 c4 10             	add    $0x10,%esp
+  804694:	f7 d8                	neg    %eax
+  804696:	83 d2 00             	adc    $0x0,%edx
+  804699:	f7 da                	neg    %edx
+  80469b:	83 c4 14             	add    $0x14,%esp
+  80469e:	5b                   	pop    %ebx
+  80469f:	5e                   	pop    %esi
+  8046a0:	c3                   	ret
+  8046a1:	83 ec 04             	sub    $0x4,%esp
+  8046a4:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8046a8:	56                   	push   %esi
+  8046a9:	f7 d9                	neg    %ecx
+  8046ab:	83 d3 00             	adc    $0x0,%ebx
+  8046ae:	f7 db                	neg    %ebx
+  8046b0:	53                   	push   %ebx
+  8046b1:	51                   	push   %ecx
+  8046b2:	e8 60 fe ff ff       	call   804517 <udm>
+  8046b7:	83 c4 10             	add    $0x10,%esp
+  8046ba:	eb d8                	jmp    804694 <__divdi3+0x4e>
+  8046bc:	83 ec 04             	sub    $0x4,%esp
+  8046bf:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8046c3:	56                   	push   %esi
+  8046c4:	f7 d9                	neg    %ecx
+  8046c6:	83 d3 00             	adc    $0x0,%ebx
+  8046c9:	f7 db                	neg    %ebx
+  8046cb:	53                   	push   %ebx
+  8046cc:	51                   	push   %ecx
+  8046cd:	e8 45 fe ff ff       	call   804517 <udm>
+  8046d2:	83 c4 10             	add    $0x10,%esp
+  8046d5:	eb c4                	jmp    80469b <__divdi3+0x55>
+
+008046d7 <__moddi3>:
+  8046d7:	55                   	push   %ebp
+  8046d8:	57                   	push   %edi
+  8046d9:	56                   	push   %esi
+  8046da:	53                   	push   %ebx
+  8046db:	83 ec 24             	sub    $0x24,%esp
+  8046de:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8046e2:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8046e6:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8046ea:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8046ee:	85 d2                	test   %edx,%edx
+  8046f0:	78 3b                	js     80472d <__moddi3+0x56>
+  8046f2:	83 ec 04             	sub    $0x4,%esp
+  8046f5:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8046f9:	56                   	push   %esi
+  8046fa:	89 ce                	mov    %ecx,%esi
+  8046fc:	f7 de                	neg    %esi
+  8046fe:	89 74 24 08          	mov    %esi,0x8(%esp)
+  804702:	89 de                	mov    %ebx,%esi
+  804704:	83 d6 00             	adc    $0x0,%esi
+  804707:	f7 de                	neg    %esi
+  804709:	89 74 24 14          	mov    %esi,0x14(%esp)
+  80470d:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804711:	0f 48 f1             	cmovs  %ecx,%esi
+  804714:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  804719:	53                   	push   %ebx
+  80471a:	56                   	push   %esi
+  80471b:	e8 f7 fd ff ff       	call   804517 <udm>
+  804720:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804724:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804728:	83 c4 10             	add    $0x10,%esp
+  80472b:	eb 47                	jmp    804774 <__moddi3+0x9d>
+  80472d:	f7 d8                	neg    %eax
+  80472f:	83 d2 00             	adc    $0x0,%edx
+  804732:	f7 da                	neg    %edx
+  804734:	83 ec 04             	sub    $0x4,%esp
+  804737:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80473b:	56                   	push   %esi
+  80473c:	89 cf                	mov    %ecx,%edi
+  80473e:	f7 df                	neg    %edi
+  804740:	89 de                	mov    %ebx,%esi
+  804742:	83 d6 00             	adc    $0x0,%esi
+  804745:	f7 de                	neg    %esi
+  804747:	0f 49 cf             	cmovns %edi,%ecx
+  80474a:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  80474e:	0f 49 de             	cmovns %esi,%ebx
+  804751:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  804755:	ff 74 24 0c          	push   0xc(%esp)
+  804759:	ff 74 24 0c          	push   0xc(%esp)
+  80475d:	e8 b5 fd ff ff       	call   804517 <udm>
+  804762:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804766:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80476a:	f7 d8                	neg    %eax
+  80476c:	83 d2 00             	adc    $0x0,%edx
+  80476f:	f7 da                	neg    %edx
+  804771:	83 c4 10             	add    $0x10,%esp
+  804774:	83 c4 24             	add    $0x24,%esp
+  804777:	5b                   	pop    %ebx
+  804778:	5e                   	pop    %esi
+  804779:	5f                   	pop    %edi
+  80477a:	5d                   	pop    %ebp
+  80477b:	c3                   	ret
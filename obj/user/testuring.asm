@@ -0,0 +1,10240 @@
+
+obj/user/testuring.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 9b 03 00 00       	call   8003cc <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+	return read_tsc() - tsc;
+}
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 38             	sub    $0x38,%esp
+	struct Uring *u = URING;
+	struct UringCqe cqe;
+	unsigned start;
+	int r;
+
+	if ((r = uring_init(u)) < 0)
+  80003c:	68 00 00 00 a0       	push   $0xa0000000
+  800041:	e8 dc 37 00 00       	call   803822 <uring_init>
+  800046:	83 c4 10             	add    $0x10,%esp
+  800049:	85 c0                	test   %eax,%eax
+  80004b:	0f 88 3d 01 00 00    	js     80018e <umain+0x15b>
+		panic("uring_init: %e", r);
+
+	// results come back in order and tagged
+	uring_queue(u, SYS_getenvid, 7, 0, 0, 0, 0, 0);
+  800051:	6a 00                	push   $0x0
+  800053:	6a 00                	push   $0x0
+  800055:	6a 00                	push   $0x0
+  800057:	6a 00                	push   $0x0
+  800059:	6a 00                	push   $0x0
+  80005b:	6a 07                	push   $0x7
+  80005d:	6a 02                	push   $0x2
+  80005f:	68 00 00 00 a0       	push   $0xa0000000
+  800064:	e8 07 38 00 00       	call   803870 <uring_queue>
+	uring_queue(u, SYS_yield, 8, 0, 0, 0, 0, 0);
+  800069:	83 c4 20             	add    $0x20,%esp
+  80006c:	6a 00                	push   $0x0
+  80006e:	6a 00                	push   $0x0
+  800070:	6a 00                	push   $0x0
+  800072:	6a 00                	push   $0x0
+  800074:	6a 00                	push   $0x0
+  800076:	6a 08                	push   $0x8
+  800078:	6a 0b                	push   $0xb
+  80007a:	68 00 00 00 a0       	push   $0xa0000000
+  80007f:	e8 ec 37 00 00       	call   803870 <uring_queue>
+	if ((r = uring_submit(u)) != 2)
+  800084:	83 c4 14             	add    $0x14,%esp
+  800087:	68 00 00 00 a0       	push   $0xa0000000
+  80008c:	e8 55 38 00 00       	call   8038e6 <uring_submit>
+  800091:	83 c4 10             	add    $0x10,%esp
+  800094:	83 f8 02             	cmp    $0x2,%eax
+  800097:	0f 85 03 01 00 00    	jne    8001a0 <umain+0x16d>
+		panic("uring_submit ran %d calls, want 2", r);
+	if (!uring_reap(u, &cqe) || cqe.cqe_data != 7 || cqe.cqe_res != sys_getenvid())
+  80009d:	83 ec 08             	sub    $0x8,%esp
+  8000a0:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8000a3:	50                   	push   %eax
+  8000a4:	68 00 00 00 a0       	push   $0xa0000000
+  8000a9:	e8 67 38 00 00       	call   803915 <uring_reap>
+  8000ae:	83 c4 10             	add    $0x10,%esp
+  8000b1:	85 c0                	test   %eax,%eax
+  8000b3:	0f 84 f9 00 00 00    	je     8001b2 <umain+0x17f>
+  8000b9:	83 7d e0 07          	cmpl   $0x7,-0x20(%ebp)
+  8000bd:	0f 85 ef 00 00 00    	jne    8001b2 <umain+0x17f>
+  8000c3:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8000c6:	e8 49 0e 00 00       	call   800f14 <sys_getenvid>
+  8000cb:	39 c3                	cmp    %eax,%ebx
+  8000cd:	0f 85 df 00 00 00    	jne    8001b2 <umain+0x17f>
+		panic("getenvid completion is wrong");
+	if (!uring_reap(u, &cqe) || cqe.cqe_data != 8 || cqe.cqe_res != -E_INVAL)
+  8000d3:	83 ec 08             	sub    $0x8,%esp
+  8000d6:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8000d9:	50                   	push   %eax
+  8000da:	68 00 00 00 a0       	push   $0xa0000000
+  8000df:	e8 31 38 00 00       	call   803915 <uring_reap>
+  8000e4:	83 c4 10             	add    $0x10,%esp
+  8000e7:	85 c0                	test   %eax,%eax
+  8000e9:	0f 84 d7 00 00 00    	je     8001c6 <umain+0x193>
+  8000ef:	83 7d e0 08          	cmpl   $0x8,-0x20(%ebp)
+  8000f3:	0f 85 cd 00 00 00    	jne    8001c6 <umain+0x193>
+  8000f9:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  8000fd:	0f 85 c3 00 00 00    	jne    8001c6 <umain+0x193>
+		panic("blocking call was not refused");
+	if (uring_reap(u, &cqe))
+  800103:	83 ec 08             	sub    $0x8,%esp
+  800106:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800109:	50                   	push   %eax
+  80010a:	68 00 00 00 a0       	push   $0xa0000000
+  80010f:	e8 01 38 00 00       	call   803915 <uring_reap>
+  800114:	89 c6                	mov    %eax,%esi
+  800116:	83 c4 10             	add    $0x10,%esp
+  800119:	85 c0                	test   %eax,%eax
+  80011b:	0f 85 b9 00 00 00    	jne    8001da <umain+0x1a7>
+		panic("spurious completion");
+	cprintf("uring submit is good\n");
+  800121:	83 ec 0c             	sub    $0xc,%esp
+  800124:	68 0f 4c 80 00       	push   $0x804c0f
+  800129:	e8 1c 04 00 00       	call   80054a <cprintf>
+
+	// without a doorbell the next kernel entry or clock tick runs the call
+	uring_queue(u, SYS_time_msec, 9, 0, 0, 0, 0, 0);
+  80012e:	6a 00                	push   $0x0
+  800130:	6a 00                	push   $0x0
+  800132:	6a 00                	push   $0x0
+  800134:	6a 00                	push   $0x0
+  800136:	6a 00                	push   $0x0
+  800138:	6a 09                	push   $0x9
+  80013a:	6a 0e                	push   $0xe
+  80013c:	68 00 00 00 a0       	push   $0xa0000000
+  800141:	e8 2a 37 00 00       	call   803870 <uring_queue>
+	start = sys_time_msec();
+  800146:	83 c4 30             	add    $0x30,%esp
+  800149:	e8 ab 10 00 00       	call   8011f9 <sys_time_msec>
+  80014e:	89 c3                	mov    %eax,%ebx
+	while (!uring_reap(u, &cqe))
+  800150:	8d 7d e0             	lea    -0x20(%ebp),%edi
+  800153:	83 ec 08             	sub    $0x8,%esp
+  800156:	57                   	push   %edi
+  800157:	68 00 00 00 a0       	push   $0xa0000000
+  80015c:	e8 b4 37 00 00       	call   803915 <uring_reap>
+  800161:	83 c4 10             	add    $0x10,%esp
+  800164:	85 c0                	test   %eax,%eax
+  800166:	0f 85 82 00 00 00    	jne    8001ee <umain+0x1bb>
+		if (sys_time_msec() - start > 1000)
+  80016c:	e8 88 10 00 00       	call   8011f9 <sys_time_msec>
+  800171:	29 d8                	sub    %ebx,%eax
+  800173:	3d e8 03 00 00       	cmp    $0x3e8,%eax
+  800178:	76 d9                	jbe    800153 <umain+0x120>
+			panic("queued call never ran");
+  80017a:	83 ec 04             	sub    $0x4,%esp
+  80017d:	68 25 4c 80 00       	push   $0x804c25
+  800182:	6a 52                	push   $0x52
+  800184:	68 af 4b 80 00       	push   $0x804baf
+  800189:	e8 e1 02 00 00       	call   80046f <_panic>
+		panic("uring_init: %e", r);
+  80018e:	50                   	push   %eax
+  80018f:	68 a0 4b 80 00       	push   $0x804ba0
+  800194:	6a 3e                	push   $0x3e
+  800196:	68 af 4b 80 00       	push   $0x804baf
+  80019b:	e8 cf 02 00 00       	call   80046f <_panic>
+		panic("uring_submit ran %d calls, want 2", r);
+  8001a0:	50                   	push   %eax
+  8001a1:	68 d4 4c 80 00       	push   $0x804cd4
+  8001a6:	6a 44                	push   $0x44
+  8001a8:	68 af 4b 80 00       	push   $0x804baf
+  8001ad:	e8 bd 02 00 00       	call   80046f <_panic>
+		panic("getenvid completion is wrong");
+  8001b2:	83 ec 04             	sub    $0x4,%esp
+  8001b5:	68 c0 4b 80 00       	push   $0x804bc0
+  8001ba:	6a 46                	push   $0x46
+  8001bc:	68 af 4b 80 00       	push   $0x804baf
+  8001c1:	e8 a9 02 00 00       	call   80046f <_panic>
+		panic("blocking call was not refused");
+  8001c6:	83 ec 04             	sub    $0x4,%esp
+  8001c9:	68 dd 4b 80 00       	push   $0x804bdd
+  8001ce:	6a 48                	push   $0x48
+  8001d0:	68 af 4b 80 00       	push   $0x804baf
+  8001d5:	e8 95 02 00 00       	call   80046f <_panic>
+		panic("spurious completion");
+  8001da:	83 ec 04             	sub    $0x4,%esp
+  8001dd:	68 fb 4b 80 00       	push   $0x804bfb
+  8001e2:	6a 4a                	push   $0x4a
+  8001e4:	68 af 4b 80 00       	push   $0x804baf
+  8001e9:	e8 81 02 00 00       	call   80046f <_panic>
+	if (cqe.cqe_data != 9)
+  8001ee:	83 7d e0 09          	cmpl   $0x9,-0x20(%ebp)
+  8001f2:	75 63                	jne    800257 <umain+0x224>
+		panic("time_msec completion is wrong");
+	cprintf("uring deferred call is good\n");
+  8001f4:	83 ec 0c             	sub    $0xc,%esp
+  8001f7:	68 59 4c 80 00       	push   $0x804c59
+  8001fc:	e8 49 03 00 00       	call   80054a <cprintf>
+
+static inline uint64_t
+read_tsc(void)
+{
+	uint64_t tsc;
+	asm volatile("rdtsc" : "=A" (tsc));
+  800201:	0f 31                	rdtsc
+  800203:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800206:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  800209:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NPAGES; i++)
+  80020c:	89 f3                	mov    %esi,%ebx
+		if ((r = uring_queue(u, SYS_page_alloc, i, 0,
+  80020e:	6a 00                	push   $0x0
+  800210:	6a 00                	push   $0x0
+  800212:	6a 07                	push   $0x7
+  800214:	89 d8                	mov    %ebx,%eax
+  800216:	c1 e0 0c             	shl    $0xc,%eax
+  800219:	2d 00 00 00 5f       	sub    $0x5f000000,%eax
+  80021e:	50                   	push   %eax
+  80021f:	6a 00                	push   $0x0
+  800221:	53                   	push   %ebx
+  800222:	6a 04                	push   $0x4
+  800224:	68 00 00 00 a0       	push   $0xa0000000
+  800229:	e8 42 36 00 00       	call   803870 <uring_queue>
+  80022e:	83 c4 20             	add    $0x20,%esp
+  800231:	85 c0                	test   %eax,%eax
+  800233:	78 36                	js     80026b <umain+0x238>
+	for (i = 0; i < NPAGES; i++)
+  800235:	83 c3 01             	add    $0x1,%ebx
+  800238:	83 fb 30             	cmp    $0x30,%ebx
+  80023b:	75 d1                	jne    80020e <umain+0x1db>
+	if ((r = uring_submit(u)) != NPAGES)
+  80023d:	83 ec 0c             	sub    $0xc,%esp
+  800240:	68 00 00 00 a0       	push   $0xa0000000
+  800245:	e8 9c 36 00 00       	call   8038e6 <uring_submit>
+  80024a:	83 c4 10             	add    $0x10,%esp
+  80024d:	83 f8 30             	cmp    $0x30,%eax
+  800250:	75 2b                	jne    80027d <umain+0x24a>
+	for (n = 0; uring_reap(u, &cqe); n++)
+  800252:	8d 7d d8             	lea    -0x28(%ebp),%edi
+  800255:	eb 40                	jmp    800297 <umain+0x264>
+		panic("time_msec completion is wrong");
+  800257:	83 ec 04             	sub    $0x4,%esp
+  80025a:	68 3b 4c 80 00       	push   $0x804c3b
+  80025f:	6a 54                	push   $0x54
+  800261:	68 af 4b 80 00       	push   $0x804baf
+  800266:	e8 04 02 00 00       	call   80046f <_panic>
+			panic("uring_queue: %e", r);
+  80026b:	50                   	push   %eax
+  80026c:	68 76 4c 80 00       	push   $0x804c76
+  800271:	6a 24                	push   $0x24
+  800273:	68 af 4b 80 00       	push   $0x804baf
+  800278:	e8 f2 01 00 00       	call   80046f <_panic>
+		panic("uring_submit ran %d of %d calls", r, NPAGES);
+  80027d:	83 ec 0c             	sub    $0xc,%esp
+  800280:	6a 30                	push   $0x30
+  800282:	50                   	push   %eax
+  800283:	68 f8 4c 80 00       	push   $0x804cf8
+  800288:	6a 26                	push   $0x26
+  80028a:	68 af 4b 80 00       	push   $0x804baf
+  80028f:	e8 db 01 00 00       	call   80046f <_panic>
+	for (n = 0; uring_reap(u, &cqe); n++)
+  800294:	83 c6 01             	add    $0x1,%esi
+  800297:	83 ec 08             	sub    $0x8,%esp
+  80029a:	57                   	push   %edi
+  80029b:	68 00 00 00 a0       	push   $0xa0000000
+  8002a0:	e8 70 36 00 00       	call   803915 <uring_reap>
+  8002a5:	89 c3                	mov    %eax,%ebx
+  8002a7:	83 c4 10             	add    $0x10,%esp
+  8002aa:	85 c0                	test   %eax,%eax
+  8002ac:	74 26                	je     8002d4 <umain+0x2a1>
+		if (cqe.cqe_data != n || cqe.cqe_res != 0)
+  8002ae:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8002b1:	39 f0                	cmp    %esi,%eax
+  8002b3:	75 06                	jne    8002bb <umain+0x288>
+  8002b5:	83 7d dc 00          	cmpl   $0x0,-0x24(%ebp)
+  8002b9:	74 d9                	je     800294 <umain+0x261>
+			panic("completion %d: data %d res %e", n, cqe.cqe_data, cqe.cqe_res);
+  8002bb:	83 ec 08             	sub    $0x8,%esp
+  8002be:	ff 75 dc             	push   -0x24(%ebp)
+  8002c1:	50                   	push   %eax
+  8002c2:	56                   	push   %esi
+  8002c3:	68 86 4c 80 00       	push   $0x804c86
+  8002c8:	6a 29                	push   $0x29
+  8002ca:	68 af 4b 80 00       	push   $0x804baf
+  8002cf:	e8 9b 01 00 00       	call   80046f <_panic>
+	if (n != NPAGES)
+  8002d4:	83 fe 30             	cmp    $0x30,%esi
+  8002d7:	0f 85 c6 00 00 00    	jne    8003a3 <umain+0x370>
+		uring_queue(u, SYS_page_unmap, i, 0,
+  8002dd:	6a 00                	push   $0x0
+  8002df:	6a 00                	push   $0x0
+  8002e1:	6a 00                	push   $0x0
+  8002e3:	89 d8                	mov    %ebx,%eax
+  8002e5:	c1 e0 0c             	shl    $0xc,%eax
+  8002e8:	2d 00 00 00 5f       	sub    $0x5f000000,%eax
+  8002ed:	50                   	push   %eax
+  8002ee:	6a 00                	push   $0x0
+  8002f0:	53                   	push   %ebx
+  8002f1:	6a 06                	push   $0x6
+  8002f3:	68 00 00 00 a0       	push   $0xa0000000
+  8002f8:	e8 73 35 00 00       	call   803870 <uring_queue>
+	for (i = 0; i < NPAGES; i++)
+  8002fd:	83 c3 01             	add    $0x1,%ebx
+  800300:	83 c4 20             	add    $0x20,%esp
+  800303:	83 fb 30             	cmp    $0x30,%ebx
+  800306:	75 d5                	jne    8002dd <umain+0x2aa>
+	uring_submit(u);
+  800308:	83 ec 0c             	sub    $0xc,%esp
+  80030b:	68 00 00 00 a0       	push   $0xa0000000
+  800310:	e8 d1 35 00 00       	call   8038e6 <uring_submit>
+	while (uring_reap(u, &cqe))
+  800315:	83 c4 10             	add    $0x10,%esp
+  800318:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+  80031b:	83 ec 08             	sub    $0x8,%esp
+  80031e:	53                   	push   %ebx
+  80031f:	68 00 00 00 a0       	push   $0xa0000000
+  800324:	e8 ec 35 00 00       	call   803915 <uring_reap>
+  800329:	83 c4 10             	add    $0x10,%esp
+  80032c:	85 c0                	test   %eax,%eax
+  80032e:	75 eb                	jne    80031b <umain+0x2e8>
+  800330:	0f 31                	rdtsc
+	return read_tsc() - tsc;
+  800332:	2b 45 d0             	sub    -0x30(%ebp),%eax
+
+	cprintf("%d page allocs: direct %d cycles, uring %d cycles\n",
+  800335:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800338:	0f 31                	rdtsc
+  80033a:	89 c6                	mov    %eax,%esi
+  80033c:	bb 00 00 00 a1       	mov    $0xa1000000,%ebx
+		if ((r = sys_page_alloc(0, PAGES + i * PGSIZE, PTE_P|PTE_U|PTE_W)) < 0)
+  800341:	83 ec 04             	sub    $0x4,%esp
+  800344:	6a 07                	push   $0x7
+  800346:	53                   	push   %ebx
+  800347:	6a 00                	push   $0x0
+  800349:	e8 1e 0c 00 00       	call   800f6c <sys_page_alloc>
+  80034e:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  800354:	83 c4 10             	add    $0x10,%esp
+  800357:	85 c0                	test   %eax,%eax
+  800359:	78 5f                	js     8003ba <umain+0x387>
+	for (i = 0; i < NPAGES; i++)
+  80035b:	81 fb 00 00 03 a1    	cmp    $0xa1030000,%ebx
+  800361:	75 de                	jne    800341 <umain+0x30e>
+  800363:	bb 00 00 00 a1       	mov    $0xa1000000,%ebx
+		sys_page_unmap(0, PAGES + i * PGSIZE);
+  800368:	83 ec 08             	sub    $0x8,%esp
+  80036b:	53                   	push   %ebx
+  80036c:	6a 00                	push   $0x0
+  80036e:	e8 92 0c 00 00       	call   801005 <sys_page_unmap>
+	for (i = 0; i < NPAGES; i++)
+  800373:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  800379:	83 c4 10             	add    $0x10,%esp
+  80037c:	81 fb 00 00 03 a1    	cmp    $0xa1030000,%ebx
+  800382:	75 e4                	jne    800368 <umain+0x335>
+  800384:	0f 31                	rdtsc
+	cprintf("%d page allocs: direct %d cycles, uring %d cycles\n",
+  800386:	ff 75 d0             	push   -0x30(%ebp)
+	return read_tsc() - tsc;
+  800389:	29 f0                	sub    %esi,%eax
+	cprintf("%d page allocs: direct %d cycles, uring %d cycles\n",
+  80038b:	50                   	push   %eax
+  80038c:	6a 30                	push   $0x30
+  80038e:	68 18 4d 80 00       	push   $0x804d18
+  800393:	e8 b2 01 00 00       	call   80054a <cprintf>
+		NPAGES, (uint32_t) batch_direct(), (uint32_t) batch_uring(u));
+}
+  800398:	83 c4 10             	add    $0x10,%esp
+  80039b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80039e:	5b                   	pop    %ebx
+  80039f:	5e                   	pop    %esi
+  8003a0:	5f                   	pop    %edi
+  8003a1:	5d                   	pop    %ebp
+  8003a2:	c3                   	ret
+		panic("reaped %d of %d completions", n, NPAGES);
+  8003a3:	83 ec 0c             	sub    $0xc,%esp
+  8003a6:	6a 30                	push   $0x30
+  8003a8:	56                   	push   %esi
+  8003a9:	68 a4 4c 80 00       	push   $0x804ca4
+  8003ae:	6a 2b                	push   $0x2b
+  8003b0:	68 af 4b 80 00       	push   $0x804baf
+  8003b5:	e8 b5 00 00 00       	call   80046f <_panic>
+			panic("sys_page_alloc: %e", r);
+  8003ba:	50                   	push   %eax
+  8003bb:	68 c0 4c 80 00       	push   $0x804cc0
+  8003c0:	6a 13                	push   $0x13
+  8003c2:	68 af 4b 80 00       	push   $0x804baf
+  8003c7:	e8 a3 00 00 00       	call   80046f <_panic>
+
+008003cc <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8003cc:	55                   	push   %ebp
+  8003cd:	89 e5                	mov    %esp,%ebp
+  8003cf:	57                   	push   %edi
+  8003d0:	56                   	push   %esi
+  8003d1:	53                   	push   %ebx
+  8003d2:	83 ec 1c             	sub    $0x1c,%esp
+  8003d5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8003d8:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  8003db:	e8 34 0b 00 00       	call   800f14 <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  8003e0:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  8003e3:	89 15 c0 72 80 00    	mov    %edx,0x8072c0
+	thisenv = &envs[ENVX(eid)];
+  8003e9:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8003ee:	89 c1                	mov    %eax,%ecx
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  8003f0:	89 e7                	mov    %esp,%edi
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8003f2:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  8003f8:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8003fd:	77 16                	ja     800415 <libmain+0x49>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8003ff:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800404:	29 f8                	sub    %edi,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  800406:	c1 e8 10             	shr    $0x10,%eax
+  800409:	74 0a                	je     800415 <libmain+0x49>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80040b:	c1 e0 10             	shl    $0x10,%eax
+  80040e:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  800413:	29 c2                	sub    %eax,%edx
+  800415:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  800418:	c1 e0 04             	shl    $0x4,%eax
+  80041b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800420:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800422:	85 db                	test   %ebx,%ebx
+  800424:	7e 07                	jle    80042d <libmain+0x61>
+		binaryname = argv[0];
+  800426:	8b 06                	mov    (%esi),%eax
+  800428:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// call user main routine
+	umain(argc, argv);
+  80042d:	83 ec 08             	sub    $0x8,%esp
+  800430:	56                   	push   %esi
+  800431:	53                   	push   %ebx
+  800432:	e8 fc fb ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800437:	e8 0b 00 00 00       	call   800447 <exit>
+}
+  80043c:	83 c4 10             	add    $0x10,%esp
+  80043f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800442:	5b                   	pop    %ebx
+  800443:	5e                   	pop    %esi
+  800444:	5f                   	pop    %edi
+  800445:	5d                   	pop    %ebp
+  800446:	c3                   	ret
+
+00800447 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800447:	55                   	push   %ebp
+  800448:	89 e5                	mov    %esp,%ebp
+  80044a:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  80044d:	6a 00                	push   $0x0
+  80044f:	e8 15 21 00 00       	call   802569 <fflush>
+	pthread_kill_others();
+  800454:	e8 ba 38 00 00       	call   803d13 <pthread_kill_others>
+	close_all();
+  800459:	e8 ae 11 00 00       	call   80160c <close_all>
+	sys_env_destroy(0);
+  80045e:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800465:	e8 5f 0a 00 00       	call   800ec9 <sys_env_destroy>
+}
+  80046a:	83 c4 10             	add    $0x10,%esp
+  80046d:	c9                   	leave
+  80046e:	c3                   	ret
+
+0080046f <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80046f:	55                   	push   %ebp
+  800470:	89 e5                	mov    %esp,%ebp
+  800472:	56                   	push   %esi
+  800473:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800474:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800477:	8b 35 00 60 80 00    	mov    0x806000,%esi
+  80047d:	e8 92 0a 00 00       	call   800f14 <sys_getenvid>
+  800482:	83 ec 0c             	sub    $0xc,%esp
+  800485:	ff 75 0c             	push   0xc(%ebp)
+  800488:	ff 75 08             	push   0x8(%ebp)
+  80048b:	56                   	push   %esi
+  80048c:	50                   	push   %eax
+  80048d:	68 58 4d 80 00       	push   $0x804d58
+  800492:	e8 b3 00 00 00       	call   80054a <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800497:	83 c4 18             	add    $0x18,%esp
+  80049a:	53                   	push   %ebx
+  80049b:	ff 75 10             	push   0x10(%ebp)
+  80049e:	e8 56 00 00 00       	call   8004f9 <vcprintf>
+	cprintf("\n");
+  8004a3:	c7 04 24 3e 54 80 00 	movl   $0x80543e,(%esp)
+  8004aa:	e8 9b 00 00 00       	call   80054a <cprintf>
+  8004af:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8004b2:	cc                   	int3
+	while (1)
+  8004b3:	eb fd                	jmp    8004b2 <_panic+0x43>
+
+008004b5 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8004b5:	55                   	push   %ebp
+  8004b6:	89 e5                	mov    %esp,%ebp
+  8004b8:	53                   	push   %ebx
+  8004b9:	83 ec 04             	sub    $0x4,%esp
+  8004bc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8004bf:	8b 13                	mov    (%ebx),%edx
+  8004c1:	8d 42 01             	lea    0x1(%edx),%eax
+  8004c4:	89 03                	mov    %eax,(%ebx)
+  8004c6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8004c9:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8004cd:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8004d2:	74 09                	je     8004dd <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8004d4:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8004d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8004db:	c9                   	leave
+  8004dc:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8004dd:	83 ec 08             	sub    $0x8,%esp
+  8004e0:	68 ff 00 00 00       	push   $0xff
+  8004e5:	8d 43 08             	lea    0x8(%ebx),%eax
+  8004e8:	50                   	push   %eax
+  8004e9:	e8 84 09 00 00       	call   800e72 <sys_cputs>
+		b->idx = 0;
+  8004ee:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8004f4:	83 c4 10             	add    $0x10,%esp
+  8004f7:	eb db                	jmp    8004d4 <putch+0x1f>
+
+008004f9 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8004f9:	55                   	push   %ebp
+  8004fa:	89 e5                	mov    %esp,%ebp
+  8004fc:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800502:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800509:	00 00 00 
+	b.cnt = 0;
+  80050c:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800513:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800516:	ff 75 0c             	push   0xc(%ebp)
+  800519:	ff 75 08             	push   0x8(%ebp)
+  80051c:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800522:	50                   	push   %eax
+  800523:	68 b5 04 80 00       	push   $0x8004b5
+  800528:	e8 14 01 00 00       	call   800641 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80052d:	83 c4 08             	add    $0x8,%esp
+  800530:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800536:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80053c:	50                   	push   %eax
+  80053d:	e8 30 09 00 00       	call   800e72 <sys_cputs>
+
+	return b.cnt;
+}
+  800542:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800548:	c9                   	leave
+  800549:	c3                   	ret
+
+0080054a <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80054a:	55                   	push   %ebp
+  80054b:	89 e5                	mov    %esp,%ebp
+  80054d:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800550:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800553:	50                   	push   %eax
+  800554:	ff 75 08             	push   0x8(%ebp)
+  800557:	e8 9d ff ff ff       	call   8004f9 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80055c:	c9                   	leave
+  80055d:	c3                   	ret
+
+0080055e <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80055e:	55                   	push   %ebp
+  80055f:	89 e5                	mov    %esp,%ebp
+  800561:	57                   	push   %edi
+  800562:	56                   	push   %esi
+  800563:	53                   	push   %ebx
+  800564:	83 ec 1c             	sub    $0x1c,%esp
+  800567:	89 c7                	mov    %eax,%edi
+  800569:	89 d6                	mov    %edx,%esi
+  80056b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80056e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800571:	89 d1                	mov    %edx,%ecx
+  800573:	89 c2                	mov    %eax,%edx
+  800575:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800578:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80057b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80057e:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800581:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800584:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80058b:	39 c2                	cmp    %eax,%edx
+  80058d:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800590:	72 3e                	jb     8005d0 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800592:	83 ec 0c             	sub    $0xc,%esp
+  800595:	ff 75 18             	push   0x18(%ebp)
+  800598:	83 eb 01             	sub    $0x1,%ebx
+  80059b:	53                   	push   %ebx
+  80059c:	50                   	push   %eax
+  80059d:	83 ec 08             	sub    $0x8,%esp
+  8005a0:	ff 75 e4             	push   -0x1c(%ebp)
+  8005a3:	ff 75 e0             	push   -0x20(%ebp)
+  8005a6:	ff 75 dc             	push   -0x24(%ebp)
+  8005a9:	ff 75 d8             	push   -0x28(%ebp)
+  8005ac:	e8 5b 44 00 00       	call   804a0c <__udivdi3>
+  8005b1:	83 c4 18             	add    $0x18,%esp
+  8005b4:	52                   	push   %edx
+  8005b5:	50                   	push   %eax
+  8005b6:	89 f2                	mov    %esi,%edx
+  8005b8:	89 f8                	mov    %edi,%eax
+  8005ba:	e8 9f ff ff ff       	call   80055e <printnum>
+  8005bf:	83 c4 20             	add    $0x20,%esp
+  8005c2:	eb 13                	jmp    8005d7 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8005c4:	83 ec 08             	sub    $0x8,%esp
+  8005c7:	56                   	push   %esi
+  8005c8:	ff 75 18             	push   0x18(%ebp)
+  8005cb:	ff d7                	call   *%edi
+  8005cd:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8005d0:	83 eb 01             	sub    $0x1,%ebx
+  8005d3:	85 db                	test   %ebx,%ebx
+  8005d5:	7f ed                	jg     8005c4 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8005d7:	83 ec 08             	sub    $0x8,%esp
+  8005da:	56                   	push   %esi
+  8005db:	83 ec 04             	sub    $0x4,%esp
+  8005de:	ff 75 e4             	push   -0x1c(%ebp)
+  8005e1:	ff 75 e0             	push   -0x20(%ebp)
+  8005e4:	ff 75 dc             	push   -0x24(%ebp)
+  8005e7:	ff 75 d8             	push   -0x28(%ebp)
+  8005ea:	e8 3e 44 00 00       	call   804a2d <__umoddi3>
+  8005ef:	83 c4 14             	add    $0x14,%esp
+  8005f2:	0f be 80 7b 4d 80 00 	movsbl 0x804d7b(%eax),%eax
+  8005f9:	50                   	push   %eax
+  8005fa:	ff d7                	call   *%edi
+}
+  8005fc:	83 c4 10             	add    $0x10,%esp
+  8005ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800602:	5b                   	pop    %ebx
+  800603:	5e                   	pop    %esi
+  800604:	5f                   	pop    %edi
+  800605:	5d                   	pop    %ebp
+  800606:	c3                   	ret
+
+00800607 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800607:	55                   	push   %ebp
+  800608:	89 e5                	mov    %esp,%ebp
+  80060a:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80060d:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800611:	8b 10                	mov    (%eax),%edx
+  800613:	3b 50 04             	cmp    0x4(%eax),%edx
+  800616:	73 0a                	jae    800622 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800618:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80061b:	89 08                	mov    %ecx,(%eax)
+  80061d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800620:	88 02                	mov    %al,(%edx)
+}
+  800622:	5d                   	pop    %ebp
+  800623:	c3                   	ret
+
+00800624 <printfmt>:
+{
+  800624:	55                   	push   %ebp
+  800625:	89 e5                	mov    %esp,%ebp
+  800627:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80062a:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80062d:	50                   	push   %eax
+  80062e:	ff 75 10             	push   0x10(%ebp)
+  800631:	ff 75 0c             	push   0xc(%ebp)
+  800634:	ff 75 08             	push   0x8(%ebp)
+  800637:	e8 05 00 00 00       	call   800641 <vprintfmt>
+}
+  80063c:	83 c4 10             	add    $0x10,%esp
+  80063f:	c9                   	leave
+  800640:	c3                   	ret
+
+00800641 <vprintfmt>:
+{
+  800641:	55                   	push   %ebp
+  800642:	89 e5                	mov    %esp,%ebp
+  800644:	57                   	push   %edi
+  800645:	56                   	push   %esi
+  800646:	53                   	push   %ebx
+  800647:	83 ec 2c             	sub    $0x2c,%esp
+  80064a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80064d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800650:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800653:	eb 0a                	jmp    80065f <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800655:	83 ec 08             	sub    $0x8,%esp
+  800658:	53                   	push   %ebx
+  800659:	50                   	push   %eax
+  80065a:	ff d6                	call   *%esi
+  80065c:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  80065f:	83 c7 01             	add    $0x1,%edi
+  800662:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  800666:	83 f8 25             	cmp    $0x25,%eax
+  800669:	74 0c                	je     800677 <vprintfmt+0x36>
+			if (ch == '\0')
+  80066b:	85 c0                	test   %eax,%eax
+  80066d:	75 e6                	jne    800655 <vprintfmt+0x14>
+}
+  80066f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800672:	5b                   	pop    %ebx
+  800673:	5e                   	pop    %esi
+  800674:	5f                   	pop    %edi
+  800675:	5d                   	pop    %ebp
+  800676:	c3                   	ret
+		padc = ' ';
+  800677:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80067b:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800682:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800689:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800690:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  800695:	8d 47 01             	lea    0x1(%edi),%eax
+  800698:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80069b:	0f b6 17             	movzbl (%edi),%edx
+  80069e:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8006a1:	3c 55                	cmp    $0x55,%al
+  8006a3:	0f 87 c5 03 00 00    	ja     800a6e <vprintfmt+0x42d>
+  8006a9:	0f b6 c0             	movzbl %al,%eax
+  8006ac:	ff 24 85 00 4f 80 00 	jmp    *0x804f00(,%eax,4)
+  8006b3:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  8006b6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8006b9:	eb da                	jmp    800695 <vprintfmt+0x54>
+  8006bb:	0f be d2             	movsbl %dl,%edx
+  8006be:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8006c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006c6:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8006c9:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8006cc:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8006d0:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8006d3:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8006d6:	83 f9 09             	cmp    $0x9,%ecx
+  8006d9:	77 55                	ja     800730 <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  8006db:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8006de:	eb e9                	jmp    8006c9 <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  8006e0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e3:	8b 00                	mov    (%eax),%eax
+  8006e5:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8006e8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006eb:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ee:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  8006f1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8006f4:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8006f8:	79 9b                	jns    800695 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8006fa:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8006fd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800700:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800707:	eb 8c                	jmp    800695 <vprintfmt+0x54>
+			if (width < 0)
+  800709:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80070c:	85 d2                	test   %edx,%edx
+  80070e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800713:	0f 49 c2             	cmovns %edx,%eax
+  800716:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  800719:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80071c:	e9 74 ff ff ff       	jmp    800695 <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  800721:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800724:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80072b:	e9 65 ff ff ff       	jmp    800695 <vprintfmt+0x54>
+  800730:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800733:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800736:	eb bc                	jmp    8006f4 <vprintfmt+0xb3>
+			lflag++;
+  800738:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  80073b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80073e:	e9 52 ff ff ff       	jmp    800695 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800743:	8b 45 14             	mov    0x14(%ebp),%eax
+  800746:	8d 78 04             	lea    0x4(%eax),%edi
+  800749:	83 ec 08             	sub    $0x8,%esp
+  80074c:	53                   	push   %ebx
+  80074d:	ff 30                	push   (%eax)
+  80074f:	ff d6                	call   *%esi
+			break;
+  800751:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800754:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800757:	e9 b1 02 00 00       	jmp    800a0d <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  80075c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80075f:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800762:	8b 10                	mov    (%eax),%edx
+  800764:	89 d0                	mov    %edx,%eax
+  800766:	f7 d8                	neg    %eax
+  800768:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80076b:	83 f8 14             	cmp    $0x14,%eax
+  80076e:	7f 23                	jg     800793 <vprintfmt+0x152>
+  800770:	8b 14 85 60 50 80 00 	mov    0x805060(,%eax,4),%edx
+  800777:	85 d2                	test   %edx,%edx
+  800779:	74 18                	je     800793 <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  80077b:	52                   	push   %edx
+  80077c:	68 cf 51 80 00       	push   $0x8051cf
+  800781:	53                   	push   %ebx
+  800782:	56                   	push   %esi
+  800783:	e8 9c fe ff ff       	call   800624 <printfmt>
+  800788:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80078b:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80078e:	e9 7a 02 00 00       	jmp    800a0d <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  800793:	50                   	push   %eax
+  800794:	68 93 4d 80 00       	push   $0x804d93
+  800799:	53                   	push   %ebx
+  80079a:	56                   	push   %esi
+  80079b:	e8 84 fe ff ff       	call   800624 <printfmt>
+  8007a0:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8007a3:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8007a6:	e9 62 02 00 00       	jmp    800a0d <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8007ab:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ae:	83 c0 04             	add    $0x4,%eax
+  8007b1:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8007b4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b7:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8007b9:	85 c9                	test   %ecx,%ecx
+  8007bb:	b8 8c 4d 80 00       	mov    $0x804d8c,%eax
+  8007c0:	0f 45 c1             	cmovne %ecx,%eax
+  8007c3:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8007c6:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8007ca:	7e 06                	jle    8007d2 <vprintfmt+0x191>
+  8007cc:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8007d0:	75 0b                	jne    8007dd <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8007d2:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8007d5:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8007d8:	89 75 08             	mov    %esi,0x8(%ebp)
+  8007db:	eb 5c                	jmp    800839 <vprintfmt+0x1f8>
+  8007dd:	83 ec 08             	sub    $0x8,%esp
+  8007e0:	ff 75 d0             	push   -0x30(%ebp)
+  8007e3:	ff 75 cc             	push   -0x34(%ebp)
+  8007e6:	e8 20 03 00 00       	call   800b0b <strnlen>
+  8007eb:	89 c2                	mov    %eax,%edx
+  8007ed:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8007f0:	29 d0                	sub    %edx,%eax
+  8007f2:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8007f5:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8007f9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8007fc:	89 75 08             	mov    %esi,0x8(%ebp)
+  8007ff:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800801:	eb 0e                	jmp    800811 <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  800803:	83 ec 08             	sub    $0x8,%esp
+  800806:	53                   	push   %ebx
+  800807:	57                   	push   %edi
+  800808:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80080b:	83 ee 01             	sub    $0x1,%esi
+  80080e:	83 c4 10             	add    $0x10,%esp
+  800811:	85 f6                	test   %esi,%esi
+  800813:	7f ee                	jg     800803 <vprintfmt+0x1c2>
+  800815:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800818:	8b 75 08             	mov    0x8(%ebp),%esi
+  80081b:	85 c0                	test   %eax,%eax
+  80081d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800822:	0f 49 d0             	cmovns %eax,%edx
+  800825:	29 d0                	sub    %edx,%eax
+  800827:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80082a:	eb a6                	jmp    8007d2 <vprintfmt+0x191>
+					putch(ch, putdat);
+  80082c:	83 ec 08             	sub    $0x8,%esp
+  80082f:	53                   	push   %ebx
+  800830:	52                   	push   %edx
+  800831:	ff 55 08             	call   *0x8(%ebp)
+  800834:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800837:	89 f1                	mov    %esi,%ecx
+  800839:	8d 71 01             	lea    0x1(%ecx),%esi
+  80083c:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800840:	0f be d0             	movsbl %al,%edx
+  800843:	85 d2                	test   %edx,%edx
+  800845:	74 28                	je     80086f <vprintfmt+0x22e>
+  800847:	85 ff                	test   %edi,%edi
+  800849:	78 05                	js     800850 <vprintfmt+0x20f>
+  80084b:	83 ef 01             	sub    $0x1,%edi
+  80084e:	78 30                	js     800880 <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800850:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800854:	74 d6                	je     80082c <vprintfmt+0x1eb>
+  800856:	0f be c0             	movsbl %al,%eax
+  800859:	83 e8 20             	sub    $0x20,%eax
+  80085c:	83 f8 5e             	cmp    $0x5e,%eax
+  80085f:	76 cb                	jbe    80082c <vprintfmt+0x1eb>
+					putch('?', putdat);
+  800861:	83 ec 08             	sub    $0x8,%esp
+  800864:	53                   	push   %ebx
+  800865:	6a 3f                	push   $0x3f
+  800867:	ff 55 08             	call   *0x8(%ebp)
+  80086a:	83 c4 10             	add    $0x10,%esp
+  80086d:	eb c8                	jmp    800837 <vprintfmt+0x1f6>
+  80086f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800872:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800875:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800878:	01 d0                	add    %edx,%eax
+  80087a:	29 c8                	sub    %ecx,%eax
+  80087c:	89 c7                	mov    %eax,%edi
+  80087e:	eb 13                	jmp    800893 <vprintfmt+0x252>
+  800880:	8b 75 08             	mov    0x8(%ebp),%esi
+  800883:	eb ed                	jmp    800872 <vprintfmt+0x231>
+				putch(' ', putdat);
+  800885:	83 ec 08             	sub    $0x8,%esp
+  800888:	53                   	push   %ebx
+  800889:	6a 20                	push   $0x20
+  80088b:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80088d:	83 ef 01             	sub    $0x1,%edi
+  800890:	83 c4 10             	add    $0x10,%esp
+  800893:	85 ff                	test   %edi,%edi
+  800895:	7f ee                	jg     800885 <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800897:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80089a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80089d:	e9 6b 01 00 00       	jmp    800a0d <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  8008a2:	83 f9 01             	cmp    $0x1,%ecx
+  8008a5:	7f 1f                	jg     8008c6 <vprintfmt+0x285>
+	else if (lflag)
+  8008a7:	85 c9                	test   %ecx,%ecx
+  8008a9:	74 67                	je     800912 <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  8008ab:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ae:	8b 00                	mov    (%eax),%eax
+  8008b0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8008b3:	89 c1                	mov    %eax,%ecx
+  8008b5:	c1 f9 1f             	sar    $0x1f,%ecx
+  8008b8:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8008bb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008be:	8d 40 04             	lea    0x4(%eax),%eax
+  8008c1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008c4:	eb 17                	jmp    8008dd <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  8008c6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008c9:	8b 50 04             	mov    0x4(%eax),%edx
+  8008cc:	8b 00                	mov    (%eax),%eax
+  8008ce:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8008d1:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8008d4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008d7:	8d 40 08             	lea    0x8(%eax),%eax
+  8008da:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8008dd:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8008e0:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8008e3:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8008e8:	85 c9                	test   %ecx,%ecx
+  8008ea:	0f 89 03 01 00 00    	jns    8009f3 <vprintfmt+0x3b2>
+				putch('-', putdat);
+  8008f0:	83 ec 08             	sub    $0x8,%esp
+  8008f3:	53                   	push   %ebx
+  8008f4:	6a 2d                	push   $0x2d
+  8008f6:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8008f8:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8008fb:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8008fe:	f7 da                	neg    %edx
+  800900:	83 d1 00             	adc    $0x0,%ecx
+  800903:	f7 d9                	neg    %ecx
+  800905:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800908:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80090d:	e9 e1 00 00 00       	jmp    8009f3 <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  800912:	8b 45 14             	mov    0x14(%ebp),%eax
+  800915:	8b 00                	mov    (%eax),%eax
+  800917:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80091a:	89 c1                	mov    %eax,%ecx
+  80091c:	c1 f9 1f             	sar    $0x1f,%ecx
+  80091f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800922:	8b 45 14             	mov    0x14(%ebp),%eax
+  800925:	8d 40 04             	lea    0x4(%eax),%eax
+  800928:	89 45 14             	mov    %eax,0x14(%ebp)
+  80092b:	eb b0                	jmp    8008dd <vprintfmt+0x29c>
+	if (lflag >= 2)
+  80092d:	83 f9 01             	cmp    $0x1,%ecx
+  800930:	7f 1e                	jg     800950 <vprintfmt+0x30f>
+	else if (lflag)
+  800932:	85 c9                	test   %ecx,%ecx
+  800934:	74 32                	je     800968 <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  800936:	8b 45 14             	mov    0x14(%ebp),%eax
+  800939:	8b 10                	mov    (%eax),%edx
+  80093b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800940:	8d 40 04             	lea    0x4(%eax),%eax
+  800943:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800946:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80094b:	e9 a3 00 00 00       	jmp    8009f3 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800950:	8b 45 14             	mov    0x14(%ebp),%eax
+  800953:	8b 10                	mov    (%eax),%edx
+  800955:	8b 48 04             	mov    0x4(%eax),%ecx
+  800958:	8d 40 08             	lea    0x8(%eax),%eax
+  80095b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80095e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800963:	e9 8b 00 00 00       	jmp    8009f3 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800968:	8b 45 14             	mov    0x14(%ebp),%eax
+  80096b:	8b 10                	mov    (%eax),%edx
+  80096d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800972:	8d 40 04             	lea    0x4(%eax),%eax
+  800975:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800978:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80097d:	eb 74                	jmp    8009f3 <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  80097f:	83 f9 01             	cmp    $0x1,%ecx
+  800982:	7f 1b                	jg     80099f <vprintfmt+0x35e>
+	else if (lflag)
+  800984:	85 c9                	test   %ecx,%ecx
+  800986:	74 2c                	je     8009b4 <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  800988:	8b 45 14             	mov    0x14(%ebp),%eax
+  80098b:	8b 10                	mov    (%eax),%edx
+  80098d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800992:	8d 40 04             	lea    0x4(%eax),%eax
+  800995:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800998:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  80099d:	eb 54                	jmp    8009f3 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  80099f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009a2:	8b 10                	mov    (%eax),%edx
+  8009a4:	8b 48 04             	mov    0x4(%eax),%ecx
+  8009a7:	8d 40 08             	lea    0x8(%eax),%eax
+  8009aa:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8009ad:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8009b2:	eb 3f                	jmp    8009f3 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8009b4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009b7:	8b 10                	mov    (%eax),%edx
+  8009b9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009be:	8d 40 04             	lea    0x4(%eax),%eax
+  8009c1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8009c4:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8009c9:	eb 28                	jmp    8009f3 <vprintfmt+0x3b2>
+			putch('0', putdat);
+  8009cb:	83 ec 08             	sub    $0x8,%esp
+  8009ce:	53                   	push   %ebx
+  8009cf:	6a 30                	push   $0x30
+  8009d1:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8009d3:	83 c4 08             	add    $0x8,%esp
+  8009d6:	53                   	push   %ebx
+  8009d7:	6a 78                	push   $0x78
+  8009d9:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8009db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009de:	8b 10                	mov    (%eax),%edx
+  8009e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8009e5:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8009e8:	8d 40 04             	lea    0x4(%eax),%eax
+  8009eb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009ee:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8009f3:	83 ec 0c             	sub    $0xc,%esp
+  8009f6:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8009fa:	50                   	push   %eax
+  8009fb:	ff 75 e0             	push   -0x20(%ebp)
+  8009fe:	57                   	push   %edi
+  8009ff:	51                   	push   %ecx
+  800a00:	52                   	push   %edx
+  800a01:	89 da                	mov    %ebx,%edx
+  800a03:	89 f0                	mov    %esi,%eax
+  800a05:	e8 54 fb ff ff       	call   80055e <printnum>
+			break;
+  800a0a:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800a0d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  800a10:	e9 4a fc ff ff       	jmp    80065f <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800a15:	83 f9 01             	cmp    $0x1,%ecx
+  800a18:	7f 1b                	jg     800a35 <vprintfmt+0x3f4>
+	else if (lflag)
+  800a1a:	85 c9                	test   %ecx,%ecx
+  800a1c:	74 2c                	je     800a4a <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  800a1e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a21:	8b 10                	mov    (%eax),%edx
+  800a23:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a28:	8d 40 04             	lea    0x4(%eax),%eax
+  800a2b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a2e:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800a33:	eb be                	jmp    8009f3 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800a35:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a38:	8b 10                	mov    (%eax),%edx
+  800a3a:	8b 48 04             	mov    0x4(%eax),%ecx
+  800a3d:	8d 40 08             	lea    0x8(%eax),%eax
+  800a40:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a43:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800a48:	eb a9                	jmp    8009f3 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  800a4a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a4d:	8b 10                	mov    (%eax),%edx
+  800a4f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a54:	8d 40 04             	lea    0x4(%eax),%eax
+  800a57:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a5a:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800a5f:	eb 92                	jmp    8009f3 <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  800a61:	83 ec 08             	sub    $0x8,%esp
+  800a64:	53                   	push   %ebx
+  800a65:	6a 25                	push   $0x25
+  800a67:	ff d6                	call   *%esi
+			break;
+  800a69:	83 c4 10             	add    $0x10,%esp
+  800a6c:	eb 9f                	jmp    800a0d <vprintfmt+0x3cc>
+			putch('%', putdat);
+  800a6e:	83 ec 08             	sub    $0x8,%esp
+  800a71:	53                   	push   %ebx
+  800a72:	6a 25                	push   $0x25
+  800a74:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800a76:	83 c4 10             	add    $0x10,%esp
+  800a79:	89 f8                	mov    %edi,%eax
+  800a7b:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800a7f:	74 05                	je     800a86 <vprintfmt+0x445>
+  800a81:	83 e8 01             	sub    $0x1,%eax
+  800a84:	eb f5                	jmp    800a7b <vprintfmt+0x43a>
+  800a86:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800a89:	eb 82                	jmp    800a0d <vprintfmt+0x3cc>
+
+00800a8b <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800a8b:	55                   	push   %ebp
+  800a8c:	89 e5                	mov    %esp,%ebp
+  800a8e:	83 ec 18             	sub    $0x18,%esp
+  800a91:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a94:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800a97:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800a9a:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800a9e:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800aa1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800aa8:	85 c0                	test   %eax,%eax
+  800aaa:	74 26                	je     800ad2 <vsnprintf+0x47>
+  800aac:	85 d2                	test   %edx,%edx
+  800aae:	7e 22                	jle    800ad2 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800ab0:	ff 75 14             	push   0x14(%ebp)
+  800ab3:	ff 75 10             	push   0x10(%ebp)
+  800ab6:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800ab9:	50                   	push   %eax
+  800aba:	68 07 06 80 00       	push   $0x800607
+  800abf:	e8 7d fb ff ff       	call   800641 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800ac4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800ac7:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800aca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800acd:	83 c4 10             	add    $0x10,%esp
+}
+  800ad0:	c9                   	leave
+  800ad1:	c3                   	ret
+		return -E_INVAL;
+  800ad2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ad7:	eb f7                	jmp    800ad0 <vsnprintf+0x45>
+
+00800ad9 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800ad9:	55                   	push   %ebp
+  800ada:	89 e5                	mov    %esp,%ebp
+  800adc:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800adf:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800ae2:	50                   	push   %eax
+  800ae3:	ff 75 10             	push   0x10(%ebp)
+  800ae6:	ff 75 0c             	push   0xc(%ebp)
+  800ae9:	ff 75 08             	push   0x8(%ebp)
+  800aec:	e8 9a ff ff ff       	call   800a8b <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800af1:	c9                   	leave
+  800af2:	c3                   	ret
+
+00800af3 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800af3:	55                   	push   %ebp
+  800af4:	89 e5                	mov    %esp,%ebp
+  800af6:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800af9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800afe:	eb 03                	jmp    800b03 <strlen+0x10>
+		n++;
+  800b00:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800b03:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800b07:	75 f7                	jne    800b00 <strlen+0xd>
+	return n;
+}
+  800b09:	5d                   	pop    %ebp
+  800b0a:	c3                   	ret
+
+00800b0b <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800b0b:	55                   	push   %ebp
+  800b0c:	89 e5                	mov    %esp,%ebp
+  800b0e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b11:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b14:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b19:	eb 03                	jmp    800b1e <strnlen+0x13>
+		n++;
+  800b1b:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b1e:	39 d0                	cmp    %edx,%eax
+  800b20:	74 08                	je     800b2a <strnlen+0x1f>
+  800b22:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800b26:	75 f3                	jne    800b1b <strnlen+0x10>
+  800b28:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800b2a:	89 d0                	mov    %edx,%eax
+  800b2c:	5d                   	pop    %ebp
+  800b2d:	c3                   	ret
+
+00800b2e <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800b2e:	55                   	push   %ebp
+  800b2f:	89 e5                	mov    %esp,%ebp
+  800b31:	53                   	push   %ebx
+  800b32:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b35:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800b38:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b3d:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800b41:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800b44:	83 c0 01             	add    $0x1,%eax
+  800b47:	84 d2                	test   %dl,%dl
+  800b49:	75 f2                	jne    800b3d <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800b4b:	89 c8                	mov    %ecx,%eax
+  800b4d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b50:	c9                   	leave
+  800b51:	c3                   	ret
+
+00800b52 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800b52:	55                   	push   %ebp
+  800b53:	89 e5                	mov    %esp,%ebp
+  800b55:	53                   	push   %ebx
+  800b56:	83 ec 10             	sub    $0x10,%esp
+  800b59:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800b5c:	53                   	push   %ebx
+  800b5d:	e8 91 ff ff ff       	call   800af3 <strlen>
+  800b62:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800b65:	ff 75 0c             	push   0xc(%ebp)
+  800b68:	01 d8                	add    %ebx,%eax
+  800b6a:	50                   	push   %eax
+  800b6b:	e8 be ff ff ff       	call   800b2e <strcpy>
+	return dst;
+}
+  800b70:	89 d8                	mov    %ebx,%eax
+  800b72:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b75:	c9                   	leave
+  800b76:	c3                   	ret
+
+00800b77 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b77:	55                   	push   %ebp
+  800b78:	89 e5                	mov    %esp,%ebp
+  800b7a:	56                   	push   %esi
+  800b7b:	53                   	push   %ebx
+  800b7c:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b7f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800b82:	89 f3                	mov    %esi,%ebx
+  800b84:	03 5d 10             	add    0x10(%ebp),%ebx
+  800b87:	89 f0                	mov    %esi,%eax
+  800b89:	eb 0f                	jmp    800b9a <strncpy+0x23>
+		*dst++ = *src;
+  800b8b:	83 c0 01             	add    $0x1,%eax
+  800b8e:	0f b6 0a             	movzbl (%edx),%ecx
+  800b91:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800b94:	80 f9 01             	cmp    $0x1,%cl
+  800b97:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800b9a:	39 d8                	cmp    %ebx,%eax
+  800b9c:	75 ed                	jne    800b8b <strncpy+0x14>
+	}
+	return ret;
+}
+  800b9e:	89 f0                	mov    %esi,%eax
+  800ba0:	5b                   	pop    %ebx
+  800ba1:	5e                   	pop    %esi
+  800ba2:	5d                   	pop    %ebp
+  800ba3:	c3                   	ret
+
+00800ba4 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800ba4:	55                   	push   %ebp
+  800ba5:	89 e5                	mov    %esp,%ebp
+  800ba7:	56                   	push   %esi
+  800ba8:	53                   	push   %ebx
+  800ba9:	8b 75 08             	mov    0x8(%ebp),%esi
+  800bac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800baf:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800bb2:	89 f0                	mov    %esi,%eax
+  800bb4:	85 d2                	test   %edx,%edx
+  800bb6:	74 21                	je     800bd9 <strlcpy+0x35>
+  800bb8:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800bbc:	89 f2                	mov    %esi,%edx
+  800bbe:	eb 09                	jmp    800bc9 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800bc0:	83 c1 01             	add    $0x1,%ecx
+  800bc3:	83 c2 01             	add    $0x1,%edx
+  800bc6:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800bc9:	39 c2                	cmp    %eax,%edx
+  800bcb:	74 09                	je     800bd6 <strlcpy+0x32>
+  800bcd:	0f b6 19             	movzbl (%ecx),%ebx
+  800bd0:	84 db                	test   %bl,%bl
+  800bd2:	75 ec                	jne    800bc0 <strlcpy+0x1c>
+  800bd4:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800bd6:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800bd9:	29 f0                	sub    %esi,%eax
+}
+  800bdb:	5b                   	pop    %ebx
+  800bdc:	5e                   	pop    %esi
+  800bdd:	5d                   	pop    %ebp
+  800bde:	c3                   	ret
+
+00800bdf <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800bdf:	55                   	push   %ebp
+  800be0:	89 e5                	mov    %esp,%ebp
+  800be2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800be5:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800be8:	eb 06                	jmp    800bf0 <strcmp+0x11>
+		p++, q++;
+  800bea:	83 c1 01             	add    $0x1,%ecx
+  800bed:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800bf0:	0f b6 01             	movzbl (%ecx),%eax
+  800bf3:	84 c0                	test   %al,%al
+  800bf5:	74 04                	je     800bfb <strcmp+0x1c>
+  800bf7:	3a 02                	cmp    (%edx),%al
+  800bf9:	74 ef                	je     800bea <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800bfb:	0f b6 c0             	movzbl %al,%eax
+  800bfe:	0f b6 12             	movzbl (%edx),%edx
+  800c01:	29 d0                	sub    %edx,%eax
+}
+  800c03:	5d                   	pop    %ebp
+  800c04:	c3                   	ret
+
+00800c05 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800c05:	55                   	push   %ebp
+  800c06:	89 e5                	mov    %esp,%ebp
+  800c08:	53                   	push   %ebx
+  800c09:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c0c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c0f:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800c12:	eb 09                	jmp    800c1d <strncmp+0x18>
+		n--, p++, q++;
+  800c14:	83 ea 01             	sub    $0x1,%edx
+  800c17:	83 c0 01             	add    $0x1,%eax
+  800c1a:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800c1d:	85 d2                	test   %edx,%edx
+  800c1f:	74 18                	je     800c39 <strncmp+0x34>
+  800c21:	0f b6 18             	movzbl (%eax),%ebx
+  800c24:	84 db                	test   %bl,%bl
+  800c26:	74 04                	je     800c2c <strncmp+0x27>
+  800c28:	3a 19                	cmp    (%ecx),%bl
+  800c2a:	74 e8                	je     800c14 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800c2c:	0f b6 00             	movzbl (%eax),%eax
+  800c2f:	0f b6 11             	movzbl (%ecx),%edx
+  800c32:	29 d0                	sub    %edx,%eax
+}
+  800c34:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c37:	c9                   	leave
+  800c38:	c3                   	ret
+		return 0;
+  800c39:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c3e:	eb f4                	jmp    800c34 <strncmp+0x2f>
+
+00800c40 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800c40:	55                   	push   %ebp
+  800c41:	89 e5                	mov    %esp,%ebp
+  800c43:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c46:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800c4a:	eb 03                	jmp    800c4f <strchr+0xf>
+  800c4c:	83 c0 01             	add    $0x1,%eax
+  800c4f:	0f b6 10             	movzbl (%eax),%edx
+  800c52:	84 d2                	test   %dl,%dl
+  800c54:	74 06                	je     800c5c <strchr+0x1c>
+		if (*s == c)
+  800c56:	38 ca                	cmp    %cl,%dl
+  800c58:	75 f2                	jne    800c4c <strchr+0xc>
+  800c5a:	eb 05                	jmp    800c61 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800c5c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c61:	5d                   	pop    %ebp
+  800c62:	c3                   	ret
+
+00800c63 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800c63:	55                   	push   %ebp
+  800c64:	89 e5                	mov    %esp,%ebp
+  800c66:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c69:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800c6d:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800c70:	38 ca                	cmp    %cl,%dl
+  800c72:	74 09                	je     800c7d <strfind+0x1a>
+  800c74:	84 d2                	test   %dl,%dl
+  800c76:	74 05                	je     800c7d <strfind+0x1a>
+	for (; *s; s++)
+  800c78:	83 c0 01             	add    $0x1,%eax
+  800c7b:	eb f0                	jmp    800c6d <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800c7d:	5d                   	pop    %ebp
+  800c7e:	c3                   	ret
+
+00800c7f <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800c7f:	55                   	push   %ebp
+  800c80:	89 e5                	mov    %esp,%ebp
+  800c82:	57                   	push   %edi
+  800c83:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800c86:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800c89:	85 c9                	test   %ecx,%ecx
+  800c8b:	74 20                	je     800cad <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800c8d:	89 f8                	mov    %edi,%eax
+  800c8f:	09 c8                	or     %ecx,%eax
+  800c91:	a8 03                	test   $0x3,%al
+  800c93:	75 12                	jne    800ca7 <memset+0x28>
+		c &= 0xFF;
+  800c95:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800c99:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800c9f:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800ca2:	fc                   	cld
+  800ca3:	f3 ab                	rep stos %eax,%es:(%edi)
+  800ca5:	eb 06                	jmp    800cad <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800ca7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800caa:	fc                   	cld
+  800cab:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800cad:	89 f8                	mov    %edi,%eax
+  800caf:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800cb2:	c9                   	leave
+  800cb3:	c3                   	ret
+
+00800cb4 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800cb4:	55                   	push   %ebp
+  800cb5:	89 e5                	mov    %esp,%ebp
+  800cb7:	57                   	push   %edi
+  800cb8:	56                   	push   %esi
+  800cb9:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cbc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800cbf:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800cc2:	39 c6                	cmp    %eax,%esi
+  800cc4:	73 32                	jae    800cf8 <memmove+0x44>
+  800cc6:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800cc9:	39 d0                	cmp    %edx,%eax
+  800ccb:	73 2b                	jae    800cf8 <memmove+0x44>
+		s += n;
+		d += n;
+  800ccd:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800cd0:	89 d6                	mov    %edx,%esi
+  800cd2:	09 fe                	or     %edi,%esi
+  800cd4:	09 ce                	or     %ecx,%esi
+  800cd6:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800cdc:	75 0e                	jne    800cec <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800cde:	83 ef 04             	sub    $0x4,%edi
+  800ce1:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800ce4:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800ce7:	fd                   	std
+  800ce8:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800cea:	eb 09                	jmp    800cf5 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800cec:	83 ef 01             	sub    $0x1,%edi
+  800cef:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800cf2:	fd                   	std
+  800cf3:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800cf5:	fc                   	cld
+  800cf6:	eb 1a                	jmp    800d12 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800cf8:	89 f2                	mov    %esi,%edx
+  800cfa:	09 c2                	or     %eax,%edx
+  800cfc:	09 ca                	or     %ecx,%edx
+  800cfe:	f6 c2 03             	test   $0x3,%dl
+  800d01:	75 0a                	jne    800d0d <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800d03:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800d06:	89 c7                	mov    %eax,%edi
+  800d08:	fc                   	cld
+  800d09:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d0b:	eb 05                	jmp    800d12 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800d0d:	89 c7                	mov    %eax,%edi
+  800d0f:	fc                   	cld
+  800d10:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800d12:	5e                   	pop    %esi
+  800d13:	5f                   	pop    %edi
+  800d14:	5d                   	pop    %ebp
+  800d15:	c3                   	ret
+
+00800d16 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800d16:	55                   	push   %ebp
+  800d17:	89 e5                	mov    %esp,%ebp
+  800d19:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800d1c:	ff 75 10             	push   0x10(%ebp)
+  800d1f:	ff 75 0c             	push   0xc(%ebp)
+  800d22:	ff 75 08             	push   0x8(%ebp)
+  800d25:	e8 8a ff ff ff       	call   800cb4 <memmove>
+}
+  800d2a:	c9                   	leave
+  800d2b:	c3                   	ret
+
+00800d2c <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800d2c:	55                   	push   %ebp
+  800d2d:	89 e5                	mov    %esp,%ebp
+  800d2f:	56                   	push   %esi
+  800d30:	53                   	push   %ebx
+  800d31:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d34:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800d37:	89 c6                	mov    %eax,%esi
+  800d39:	03 75 10             	add    0x10(%ebp),%esi
+  800d3c:	eb 06                	jmp    800d44 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800d3e:	83 c0 01             	add    $0x1,%eax
+  800d41:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800d44:	39 f0                	cmp    %esi,%eax
+  800d46:	74 14                	je     800d5c <memcmp+0x30>
+		if (*s1 != *s2)
+  800d48:	0f b6 08             	movzbl (%eax),%ecx
+  800d4b:	0f b6 1a             	movzbl (%edx),%ebx
+  800d4e:	38 d9                	cmp    %bl,%cl
+  800d50:	74 ec                	je     800d3e <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800d52:	0f b6 c1             	movzbl %cl,%eax
+  800d55:	0f b6 db             	movzbl %bl,%ebx
+  800d58:	29 d8                	sub    %ebx,%eax
+  800d5a:	eb 05                	jmp    800d61 <memcmp+0x35>
+	}
+
+	return 0;
+  800d5c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d61:	5b                   	pop    %ebx
+  800d62:	5e                   	pop    %esi
+  800d63:	5d                   	pop    %ebp
+  800d64:	c3                   	ret
+
+00800d65 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800d65:	55                   	push   %ebp
+  800d66:	89 e5                	mov    %esp,%ebp
+  800d68:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d6b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800d6e:	89 c2                	mov    %eax,%edx
+  800d70:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800d73:	eb 03                	jmp    800d78 <memfind+0x13>
+  800d75:	83 c0 01             	add    $0x1,%eax
+  800d78:	39 d0                	cmp    %edx,%eax
+  800d7a:	73 04                	jae    800d80 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800d7c:	38 08                	cmp    %cl,(%eax)
+  800d7e:	75 f5                	jne    800d75 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800d80:	5d                   	pop    %ebp
+  800d81:	c3                   	ret
+
+00800d82 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800d82:	55                   	push   %ebp
+  800d83:	89 e5                	mov    %esp,%ebp
+  800d85:	57                   	push   %edi
+  800d86:	56                   	push   %esi
+  800d87:	53                   	push   %ebx
+  800d88:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d8b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800d8e:	eb 03                	jmp    800d93 <strtol+0x11>
+		s++;
+  800d90:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800d93:	0f b6 02             	movzbl (%edx),%eax
+  800d96:	3c 20                	cmp    $0x20,%al
+  800d98:	74 f6                	je     800d90 <strtol+0xe>
+  800d9a:	3c 09                	cmp    $0x9,%al
+  800d9c:	74 f2                	je     800d90 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800d9e:	3c 2b                	cmp    $0x2b,%al
+  800da0:	74 2a                	je     800dcc <strtol+0x4a>
+	int neg = 0;
+  800da2:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800da7:	3c 2d                	cmp    $0x2d,%al
+  800da9:	74 2b                	je     800dd6 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800dab:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800db1:	75 0f                	jne    800dc2 <strtol+0x40>
+  800db3:	80 3a 30             	cmpb   $0x30,(%edx)
+  800db6:	74 28                	je     800de0 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800db8:	85 db                	test   %ebx,%ebx
+  800dba:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800dbf:	0f 44 d8             	cmove  %eax,%ebx
+  800dc2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dc7:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800dca:	eb 46                	jmp    800e12 <strtol+0x90>
+		s++;
+  800dcc:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800dcf:	bf 00 00 00 00       	mov    $0x0,%edi
+  800dd4:	eb d5                	jmp    800dab <strtol+0x29>
+		s++, neg = 1;
+  800dd6:	83 c2 01             	add    $0x1,%edx
+  800dd9:	bf 01 00 00 00       	mov    $0x1,%edi
+  800dde:	eb cb                	jmp    800dab <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800de0:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800de4:	74 0e                	je     800df4 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800de6:	85 db                	test   %ebx,%ebx
+  800de8:	75 d8                	jne    800dc2 <strtol+0x40>
+		s++, base = 8;
+  800dea:	83 c2 01             	add    $0x1,%edx
+  800ded:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800df2:	eb ce                	jmp    800dc2 <strtol+0x40>
+		s += 2, base = 16;
+  800df4:	83 c2 02             	add    $0x2,%edx
+  800df7:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800dfc:	eb c4                	jmp    800dc2 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800dfe:	0f be c0             	movsbl %al,%eax
+  800e01:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800e04:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800e07:	7d 3a                	jge    800e43 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800e09:	83 c2 01             	add    $0x1,%edx
+  800e0c:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800e10:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800e12:	0f b6 02             	movzbl (%edx),%eax
+  800e15:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800e18:	89 f3                	mov    %esi,%ebx
+  800e1a:	80 fb 09             	cmp    $0x9,%bl
+  800e1d:	76 df                	jbe    800dfe <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800e1f:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800e22:	89 f3                	mov    %esi,%ebx
+  800e24:	80 fb 19             	cmp    $0x19,%bl
+  800e27:	77 08                	ja     800e31 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800e29:	0f be c0             	movsbl %al,%eax
+  800e2c:	83 e8 57             	sub    $0x57,%eax
+  800e2f:	eb d3                	jmp    800e04 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800e31:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800e34:	89 f3                	mov    %esi,%ebx
+  800e36:	80 fb 19             	cmp    $0x19,%bl
+  800e39:	77 08                	ja     800e43 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800e3b:	0f be c0             	movsbl %al,%eax
+  800e3e:	83 e8 37             	sub    $0x37,%eax
+  800e41:	eb c1                	jmp    800e04 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800e43:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800e47:	74 05                	je     800e4e <strtol+0xcc>
+		*endptr = (char *) s;
+  800e49:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e4c:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800e4e:	89 c8                	mov    %ecx,%eax
+  800e50:	f7 d8                	neg    %eax
+  800e52:	85 ff                	test   %edi,%edi
+  800e54:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800e57:	89 c8                	mov    %ecx,%eax
+  800e59:	5b                   	pop    %ebx
+  800e5a:	5e                   	pop    %esi
+  800e5b:	5f                   	pop    %edi
+  800e5c:	5d                   	pop    %ebp
+  800e5d:	c3                   	ret
+
+00800e5e <atoi>:
+
+int
+atoi(const char* s)
+{
+  800e5e:	55                   	push   %ebp
+  800e5f:	89 e5                	mov    %esp,%ebp
+  800e61:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  800e64:	6a 00                	push   $0x0
+  800e66:	6a 00                	push   $0x0
+  800e68:	ff 75 08             	push   0x8(%ebp)
+  800e6b:	e8 12 ff ff ff       	call   800d82 <strtol>
+}
+  800e70:	c9                   	leave
+  800e71:	c3                   	ret
+
+00800e72 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800e72:	55                   	push   %ebp
+  800e73:	89 e5                	mov    %esp,%ebp
+  800e75:	57                   	push   %edi
+  800e76:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e77:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e7c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e7f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e82:	89 c3                	mov    %eax,%ebx
+  800e84:	89 c7                	mov    %eax,%edi
+  800e86:	6a 00                	push   $0x0
+  800e88:	55                   	push   %ebp
+  800e89:	56                   	push   %esi
+  800e8a:	89 e5                	mov    %esp,%ebp
+  800e8c:	8d 35 94 0e 80 00    	lea    0x800e94,%esi
+  800e92:	0f 34                	sysenter
+
+00800e94 <after_sysenter_label_47>:
+  800e94:	5e                   	pop    %esi
+  800e95:	5d                   	pop    %ebp
+  800e96:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800e99:	5b                   	pop    %ebx
+  800e9a:	5f                   	pop    %edi
+  800e9b:	5d                   	pop    %ebp
+  800e9c:	c3                   	ret
+
+00800e9d <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800e9d:	55                   	push   %ebp
+  800e9e:	89 e5                	mov    %esp,%ebp
+  800ea0:	57                   	push   %edi
+  800ea1:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ea2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ea7:	b8 01 00 00 00       	mov    $0x1,%eax
+  800eac:	89 d1                	mov    %edx,%ecx
+  800eae:	89 d3                	mov    %edx,%ebx
+  800eb0:	89 d7                	mov    %edx,%edi
+  800eb2:	6a 00                	push   $0x0
+  800eb4:	55                   	push   %ebp
+  800eb5:	56                   	push   %esi
+  800eb6:	89 e5                	mov    %esp,%ebp
+  800eb8:	8d 35 c0 0e 80 00    	lea    0x800ec0,%esi
+  800ebe:	0f 34                	sysenter
+
+00800ec0 <after_sysenter_label_128>:
+  800ec0:	5e                   	pop    %esi
+  800ec1:	5d                   	pop    %ebp
+  800ec2:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800ec5:	5b                   	pop    %ebx
+  800ec6:	5f                   	pop    %edi
+  800ec7:	5d                   	pop    %ebp
+  800ec8:	c3                   	ret
+
+00800ec9 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800ec9:	55                   	push   %ebp
+  800eca:	89 e5                	mov    %esp,%ebp
+  800ecc:	57                   	push   %edi
+  800ecd:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ece:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ed6:	b8 03 00 00 00       	mov    $0x3,%eax
+  800edb:	89 cb                	mov    %ecx,%ebx
+  800edd:	89 cf                	mov    %ecx,%edi
+  800edf:	6a 00                	push   $0x0
+  800ee1:	55                   	push   %ebp
+  800ee2:	56                   	push   %esi
+  800ee3:	89 e5                	mov    %esp,%ebp
+  800ee5:	8d 35 ed 0e 80 00    	lea    0x800eed,%esi
+  800eeb:	0f 34                	sysenter
+
+00800eed <after_sysenter_label_212>:
+  800eed:	5e                   	pop    %esi
+  800eee:	5d                   	pop    %ebp
+  800eef:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800ef2:	85 c0                	test   %eax,%eax
+  800ef4:	7f 07                	jg     800efd <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800ef6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ef9:	5b                   	pop    %ebx
+  800efa:	5f                   	pop    %edi
+  800efb:	5d                   	pop    %ebp
+  800efc:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800efd:	83 ec 0c             	sub    $0xc,%esp
+  800f00:	50                   	push   %eax
+  800f01:	6a 03                	push   $0x3
+  800f03:	68 f5 50 80 00       	push   $0x8050f5
+  800f08:	6a 54                	push   $0x54
+  800f0a:	68 12 51 80 00       	push   $0x805112
+  800f0f:	e8 5b f5 ff ff       	call   80046f <_panic>
+
+00800f14 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800f14:	55                   	push   %ebp
+  800f15:	89 e5                	mov    %esp,%ebp
+  800f17:	57                   	push   %edi
+  800f18:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f19:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f1e:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f23:	89 d1                	mov    %edx,%ecx
+  800f25:	89 d3                	mov    %edx,%ebx
+  800f27:	89 d7                	mov    %edx,%edi
+  800f29:	6a 00                	push   $0x0
+  800f2b:	55                   	push   %ebp
+  800f2c:	56                   	push   %esi
+  800f2d:	89 e5                	mov    %esp,%ebp
+  800f2f:	8d 35 37 0f 80 00    	lea    0x800f37,%esi
+  800f35:	0f 34                	sysenter
+
+00800f37 <after_sysenter_label_309>:
+  800f37:	5e                   	pop    %esi
+  800f38:	5d                   	pop    %ebp
+  800f39:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800f3c:	5b                   	pop    %ebx
+  800f3d:	5f                   	pop    %edi
+  800f3e:	5d                   	pop    %ebp
+  800f3f:	c3                   	ret
+
+00800f40 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800f40:	55                   	push   %ebp
+  800f41:	89 e5                	mov    %esp,%ebp
+  800f43:	57                   	push   %edi
+  800f44:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f45:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f4a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800f4f:	89 d1                	mov    %edx,%ecx
+  800f51:	89 d3                	mov    %edx,%ebx
+  800f53:	89 d7                	mov    %edx,%edi
+  800f55:	6a 00                	push   $0x0
+  800f57:	55                   	push   %ebp
+  800f58:	56                   	push   %esi
+  800f59:	89 e5                	mov    %esp,%ebp
+  800f5b:	8d 35 63 0f 80 00    	lea    0x800f63,%esi
+  800f61:	0f 34                	sysenter
+
+00800f63 <after_sysenter_label_391>:
+  800f63:	5e                   	pop    %esi
+  800f64:	5d                   	pop    %ebp
+  800f65:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800f68:	5b                   	pop    %ebx
+  800f69:	5f                   	pop    %edi
+  800f6a:	5d                   	pop    %ebp
+  800f6b:	c3                   	ret
+
+00800f6c <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800f6c:	55                   	push   %ebp
+  800f6d:	89 e5                	mov    %esp,%ebp
+  800f6f:	57                   	push   %edi
+  800f70:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f71:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f74:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f77:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f7c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f81:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f84:	6a 00                	push   $0x0
+  800f86:	55                   	push   %ebp
+  800f87:	56                   	push   %esi
+  800f88:	89 e5                	mov    %esp,%ebp
+  800f8a:	8d 35 92 0f 80 00    	lea    0x800f92,%esi
+  800f90:	0f 34                	sysenter
+
+00800f92 <after_sysenter_label_479>:
+  800f92:	5e                   	pop    %esi
+  800f93:	5d                   	pop    %ebp
+  800f94:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800f97:	85 c0                	test   %eax,%eax
+  800f99:	7f 07                	jg     800fa2 <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800f9b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f9e:	5b                   	pop    %ebx
+  800f9f:	5f                   	pop    %edi
+  800fa0:	5d                   	pop    %ebp
+  800fa1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fa2:	83 ec 0c             	sub    $0xc,%esp
+  800fa5:	50                   	push   %eax
+  800fa6:	6a 04                	push   $0x4
+  800fa8:	68 f5 50 80 00       	push   $0x8050f5
+  800fad:	6a 54                	push   $0x54
+  800faf:	68 12 51 80 00       	push   $0x805112
+  800fb4:	e8 b6 f4 ff ff       	call   80046f <_panic>
+
+00800fb9 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800fb9:	55                   	push   %ebp
+  800fba:	89 e5                	mov    %esp,%ebp
+  800fbc:	57                   	push   %edi
+  800fbd:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fbe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fc4:	b8 05 00 00 00       	mov    $0x5,%eax
+  800fc9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fcc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fcf:	ff 75 18             	push   0x18(%ebp)
+  800fd2:	55                   	push   %ebp
+  800fd3:	56                   	push   %esi
+  800fd4:	89 e5                	mov    %esp,%ebp
+  800fd6:	8d 35 de 0f 80 00    	lea    0x800fde,%esi
+  800fdc:	0f 34                	sysenter
+
+00800fde <after_sysenter_label_593>:
+  800fde:	5e                   	pop    %esi
+  800fdf:	5d                   	pop    %ebp
+  800fe0:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800fe3:	85 c0                	test   %eax,%eax
+  800fe5:	7f 07                	jg     800fee <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800fe7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fea:	5b                   	pop    %ebx
+  800feb:	5f                   	pop    %edi
+  800fec:	5d                   	pop    %ebp
+  800fed:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fee:	83 ec 0c             	sub    $0xc,%esp
+  800ff1:	50                   	push   %eax
+  800ff2:	6a 05                	push   $0x5
+  800ff4:	68 f5 50 80 00       	push   $0x8050f5
+  800ff9:	6a 54                	push   $0x54
+  800ffb:	68 12 51 80 00       	push   $0x805112
+  801000:	e8 6a f4 ff ff       	call   80046f <_panic>
+
+00801005 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  801005:	55                   	push   %ebp
+  801006:	89 e5                	mov    %esp,%ebp
+  801008:	57                   	push   %edi
+  801009:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80100a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80100f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801012:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801015:	b8 06 00 00 00       	mov    $0x6,%eax
+  80101a:	89 df                	mov    %ebx,%edi
+  80101c:	6a 00                	push   $0x0
+  80101e:	55                   	push   %ebp
+  80101f:	56                   	push   %esi
+  801020:	89 e5                	mov    %esp,%ebp
+  801022:	8d 35 2a 10 80 00    	lea    0x80102a,%esi
+  801028:	0f 34                	sysenter
+
+0080102a <after_sysenter_label_704>:
+  80102a:	5e                   	pop    %esi
+  80102b:	5d                   	pop    %ebp
+  80102c:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80102f:	85 c0                	test   %eax,%eax
+  801031:	7f 07                	jg     80103a <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  801033:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801036:	5b                   	pop    %ebx
+  801037:	5f                   	pop    %edi
+  801038:	5d                   	pop    %ebp
+  801039:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80103a:	83 ec 0c             	sub    $0xc,%esp
+  80103d:	50                   	push   %eax
+  80103e:	6a 06                	push   $0x6
+  801040:	68 f5 50 80 00       	push   $0x8050f5
+  801045:	6a 54                	push   $0x54
+  801047:	68 12 51 80 00       	push   $0x805112
+  80104c:	e8 1e f4 ff ff       	call   80046f <_panic>
+
+00801051 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801051:	55                   	push   %ebp
+  801052:	89 e5                	mov    %esp,%ebp
+  801054:	57                   	push   %edi
+  801055:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801056:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80105b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80105e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801061:	b8 08 00 00 00       	mov    $0x8,%eax
+  801066:	89 df                	mov    %ebx,%edi
+  801068:	6a 00                	push   $0x0
+  80106a:	55                   	push   %ebp
+  80106b:	56                   	push   %esi
+  80106c:	89 e5                	mov    %esp,%ebp
+  80106e:	8d 35 76 10 80 00    	lea    0x801076,%esi
+  801074:	0f 34                	sysenter
+
+00801076 <after_sysenter_label_808>:
+  801076:	5e                   	pop    %esi
+  801077:	5d                   	pop    %ebp
+  801078:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80107b:	85 c0                	test   %eax,%eax
+  80107d:	7f 07                	jg     801086 <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  80107f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801082:	5b                   	pop    %ebx
+  801083:	5f                   	pop    %edi
+  801084:	5d                   	pop    %ebp
+  801085:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801086:	83 ec 0c             	sub    $0xc,%esp
+  801089:	50                   	push   %eax
+  80108a:	6a 08                	push   $0x8
+  80108c:	68 f5 50 80 00       	push   $0x8050f5
+  801091:	6a 54                	push   $0x54
+  801093:	68 12 51 80 00       	push   $0x805112
+  801098:	e8 d2 f3 ff ff       	call   80046f <_panic>
+
+0080109d <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80109d:	55                   	push   %ebp
+  80109e:	89 e5                	mov    %esp,%ebp
+  8010a0:	57                   	push   %edi
+  8010a1:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010a2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010aa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ad:	b8 09 00 00 00       	mov    $0x9,%eax
+  8010b2:	89 df                	mov    %ebx,%edi
+  8010b4:	6a 00                	push   $0x0
+  8010b6:	55                   	push   %ebp
+  8010b7:	56                   	push   %esi
+  8010b8:	89 e5                	mov    %esp,%ebp
+  8010ba:	8d 35 c2 10 80 00    	lea    0x8010c2,%esi
+  8010c0:	0f 34                	sysenter
+
+008010c2 <after_sysenter_label_912>:
+  8010c2:	5e                   	pop    %esi
+  8010c3:	5d                   	pop    %ebp
+  8010c4:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8010c7:	85 c0                	test   %eax,%eax
+  8010c9:	7f 07                	jg     8010d2 <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8010cb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8010ce:	5b                   	pop    %ebx
+  8010cf:	5f                   	pop    %edi
+  8010d0:	5d                   	pop    %ebp
+  8010d1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010d2:	83 ec 0c             	sub    $0xc,%esp
+  8010d5:	50                   	push   %eax
+  8010d6:	6a 09                	push   $0x9
+  8010d8:	68 f5 50 80 00       	push   $0x8050f5
+  8010dd:	6a 54                	push   $0x54
+  8010df:	68 12 51 80 00       	push   $0x805112
+  8010e4:	e8 86 f3 ff ff       	call   80046f <_panic>
+
+008010e9 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8010e9:	55                   	push   %ebp
+  8010ea:	89 e5                	mov    %esp,%ebp
+  8010ec:	57                   	push   %edi
+  8010ed:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010fe:	89 df                	mov    %ebx,%edi
+  801100:	6a 00                	push   $0x0
+  801102:	55                   	push   %ebp
+  801103:	56                   	push   %esi
+  801104:	89 e5                	mov    %esp,%ebp
+  801106:	8d 35 0e 11 80 00    	lea    0x80110e,%esi
+  80110c:	0f 34                	sysenter
+
+0080110e <after_sysenter_label_1016>:
+  80110e:	5e                   	pop    %esi
+  80110f:	5d                   	pop    %ebp
+  801110:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801113:	85 c0                	test   %eax,%eax
+  801115:	7f 07                	jg     80111e <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801117:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80111a:	5b                   	pop    %ebx
+  80111b:	5f                   	pop    %edi
+  80111c:	5d                   	pop    %ebp
+  80111d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80111e:	83 ec 0c             	sub    $0xc,%esp
+  801121:	50                   	push   %eax
+  801122:	6a 0a                	push   $0xa
+  801124:	68 f5 50 80 00       	push   $0x8050f5
+  801129:	6a 54                	push   $0x54
+  80112b:	68 12 51 80 00       	push   $0x805112
+  801130:	e8 3a f3 ff ff       	call   80046f <_panic>
+
+00801135 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801135:	55                   	push   %ebp
+  801136:	89 e5                	mov    %esp,%ebp
+  801138:	57                   	push   %edi
+  801139:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80113a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80113d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801140:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801145:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801148:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80114b:	6a 00                	push   $0x0
+  80114d:	55                   	push   %ebp
+  80114e:	56                   	push   %esi
+  80114f:	89 e5                	mov    %esp,%ebp
+  801151:	8d 35 59 11 80 00    	lea    0x801159,%esi
+  801157:	0f 34                	sysenter
+
+00801159 <after_sysenter_label_1126>:
+  801159:	5e                   	pop    %esi
+  80115a:	5d                   	pop    %ebp
+  80115b:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80115e:	5b                   	pop    %ebx
+  80115f:	5f                   	pop    %edi
+  801160:	5d                   	pop    %ebp
+  801161:	c3                   	ret
+
+00801162 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801162:	55                   	push   %ebp
+  801163:	89 e5                	mov    %esp,%ebp
+  801165:	57                   	push   %edi
+  801166:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801167:	8b 55 08             	mov    0x8(%ebp),%edx
+  80116a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80116f:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801174:	89 cb                	mov    %ecx,%ebx
+  801176:	89 cf                	mov    %ecx,%edi
+  801178:	6a 00                	push   $0x0
+  80117a:	55                   	push   %ebp
+  80117b:	56                   	push   %esi
+  80117c:	89 e5                	mov    %esp,%ebp
+  80117e:	8d 35 86 11 80 00    	lea    0x801186,%esi
+  801184:	0f 34                	sysenter
+
+00801186 <after_sysenter_label_1210>:
+  801186:	5e                   	pop    %esi
+  801187:	5d                   	pop    %ebp
+  801188:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80118b:	85 c0                	test   %eax,%eax
+  80118d:	7f 07                	jg     801196 <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  80118f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801192:	5b                   	pop    %ebx
+  801193:	5f                   	pop    %edi
+  801194:	5d                   	pop    %ebp
+  801195:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801196:	83 ec 0c             	sub    $0xc,%esp
+  801199:	50                   	push   %eax
+  80119a:	6a 0d                	push   $0xd
+  80119c:	68 f5 50 80 00       	push   $0x8050f5
+  8011a1:	6a 54                	push   $0x54
+  8011a3:	68 12 51 80 00       	push   $0x805112
+  8011a8:	e8 c2 f2 ff ff       	call   80046f <_panic>
+
+008011ad <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  8011ad:	55                   	push   %ebp
+  8011ae:	89 e5                	mov    %esp,%ebp
+  8011b0:	57                   	push   %edi
+  8011b1:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8011b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011bd:	b8 42 00 00 00       	mov    $0x42,%eax
+  8011c2:	89 df                	mov    %ebx,%edi
+  8011c4:	6a 00                	push   $0x0
+  8011c6:	55                   	push   %ebp
+  8011c7:	56                   	push   %esi
+  8011c8:	89 e5                	mov    %esp,%ebp
+  8011ca:	8d 35 d2 11 80 00    	lea    0x8011d2,%esi
+  8011d0:	0f 34                	sysenter
+
+008011d2 <after_sysenter_label_1311>:
+  8011d2:	5e                   	pop    %esi
+  8011d3:	5d                   	pop    %ebp
+  8011d4:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  8011d7:	85 c0                	test   %eax,%eax
+  8011d9:	7f 07                	jg     8011e2 <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  8011db:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8011de:	5b                   	pop    %ebx
+  8011df:	5f                   	pop    %edi
+  8011e0:	5d                   	pop    %ebp
+  8011e1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011e2:	83 ec 0c             	sub    $0xc,%esp
+  8011e5:	50                   	push   %eax
+  8011e6:	6a 42                	push   $0x42
+  8011e8:	68 f5 50 80 00       	push   $0x8050f5
+  8011ed:	6a 54                	push   $0x54
+  8011ef:	68 12 51 80 00       	push   $0x805112
+  8011f4:	e8 76 f2 ff ff       	call   80046f <_panic>
+
+008011f9 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8011f9:	55                   	push   %ebp
+  8011fa:	89 e5                	mov    %esp,%ebp
+  8011fc:	57                   	push   %edi
+  8011fd:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8011fe:	ba 00 00 00 00       	mov    $0x0,%edx
+  801203:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801208:	89 d1                	mov    %edx,%ecx
+  80120a:	89 d3                	mov    %edx,%ebx
+  80120c:	89 d7                	mov    %edx,%edi
+  80120e:	6a 00                	push   $0x0
+  801210:	55                   	push   %ebp
+  801211:	56                   	push   %esi
+  801212:	89 e5                	mov    %esp,%ebp
+  801214:	8d 35 1c 12 80 00    	lea    0x80121c,%esi
+  80121a:	0f 34                	sysenter
+
+0080121c <after_sysenter_label_1411>:
+  80121c:	5e                   	pop    %esi
+  80121d:	5d                   	pop    %ebp
+  80121e:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801221:	5b                   	pop    %ebx
+  801222:	5f                   	pop    %edi
+  801223:	5d                   	pop    %ebp
+  801224:	c3                   	ret
+
+00801225 <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  801225:	55                   	push   %ebp
+  801226:	89 e5                	mov    %esp,%ebp
+  801228:	57                   	push   %edi
+  801229:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80122a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80122f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801232:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801235:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80123a:	89 df                	mov    %ebx,%edi
+  80123c:	6a 00                	push   $0x0
+  80123e:	55                   	push   %ebp
+  80123f:	56                   	push   %esi
+  801240:	89 e5                	mov    %esp,%ebp
+  801242:	8d 35 4a 12 80 00    	lea    0x80124a,%esi
+  801248:	0f 34                	sysenter
+
+0080124a <after_sysenter_label_1497>:
+  80124a:	5e                   	pop    %esi
+  80124b:	5d                   	pop    %ebp
+  80124c:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  80124f:	5b                   	pop    %ebx
+  801250:	5f                   	pop    %edi
+  801251:	5d                   	pop    %ebp
+  801252:	c3                   	ret
+
+00801253 <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  801253:	55                   	push   %ebp
+  801254:	89 e5                	mov    %esp,%ebp
+  801256:	57                   	push   %edi
+  801257:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801258:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80125d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801260:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801263:	b8 10 00 00 00       	mov    $0x10,%eax
+  801268:	89 df                	mov    %ebx,%edi
+  80126a:	6a 00                	push   $0x0
+  80126c:	55                   	push   %ebp
+  80126d:	56                   	push   %esi
+  80126e:	89 e5                	mov    %esp,%ebp
+  801270:	8d 35 78 12 80 00    	lea    0x801278,%esi
+  801276:	0f 34                	sysenter
+
+00801278 <after_sysenter_label_1583>:
+  801278:	5e                   	pop    %esi
+  801279:	5d                   	pop    %ebp
+  80127a:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  80127d:	5b                   	pop    %ebx
+  80127e:	5f                   	pop    %edi
+  80127f:	5d                   	pop    %ebp
+  801280:	c3                   	ret
+
+00801281 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  801281:	55                   	push   %ebp
+  801282:	89 e5                	mov    %esp,%ebp
+  801284:	57                   	push   %edi
+  801285:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801286:	8b 55 08             	mov    0x8(%ebp),%edx
+  801289:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80128c:	b8 11 00 00 00       	mov    $0x11,%eax
+  801291:	bf 00 00 00 00       	mov    $0x0,%edi
+  801296:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801299:	6a 00                	push   $0x0
+  80129b:	55                   	push   %ebp
+  80129c:	56                   	push   %esi
+  80129d:	89 e5                	mov    %esp,%ebp
+  80129f:	8d 35 a7 12 80 00    	lea    0x8012a7,%esi
+  8012a5:	0f 34                	sysenter
+
+008012a7 <after_sysenter_label_1672>:
+  8012a7:	5e                   	pop    %esi
+  8012a8:	5d                   	pop    %ebp
+  8012a9:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  8012ac:	5b                   	pop    %ebx
+  8012ad:	5f                   	pop    %edi
+  8012ae:	5d                   	pop    %ebp
+  8012af:	c3                   	ret
+
+008012b0 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  8012b0:	55                   	push   %ebp
+  8012b1:	89 e5                	mov    %esp,%ebp
+  8012b3:	57                   	push   %edi
+  8012b4:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8012b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012c0:	b8 12 00 00 00       	mov    $0x12,%eax
+  8012c5:	89 df                	mov    %ebx,%edi
+  8012c7:	6a 00                	push   $0x0
+  8012c9:	55                   	push   %ebp
+  8012ca:	56                   	push   %esi
+  8012cb:	89 e5                	mov    %esp,%ebp
+  8012cd:	8d 35 d5 12 80 00    	lea    0x8012d5,%esi
+  8012d3:	0f 34                	sysenter
+
+008012d5 <after_sysenter_label_1758>:
+  8012d5:	5e                   	pop    %esi
+  8012d6:	5d                   	pop    %ebp
+  8012d7:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  8012da:	5b                   	pop    %ebx
+  8012db:	5f                   	pop    %edi
+  8012dc:	5d                   	pop    %ebp
+  8012dd:	c3                   	ret
+
+008012de <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  8012de:	55                   	push   %ebp
+  8012df:	89 e5                	mov    %esp,%ebp
+  8012e1:	57                   	push   %edi
+  8012e2:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8012e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012eb:	b8 13 00 00 00       	mov    $0x13,%eax
+  8012f0:	89 cb                	mov    %ecx,%ebx
+  8012f2:	89 cf                	mov    %ecx,%edi
+  8012f4:	6a 00                	push   $0x0
+  8012f6:	55                   	push   %ebp
+  8012f7:	56                   	push   %esi
+  8012f8:	89 e5                	mov    %esp,%ebp
+  8012fa:	8d 35 02 13 80 00    	lea    0x801302,%esi
+  801300:	0f 34                	sysenter
+
+00801302 <after_sysenter_label_1842>:
+  801302:	5e                   	pop    %esi
+  801303:	5d                   	pop    %ebp
+  801304:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  801307:	85 c0                	test   %eax,%eax
+  801309:	7f 07                	jg     801312 <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  80130b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80130e:	5b                   	pop    %ebx
+  80130f:	5f                   	pop    %edi
+  801310:	5d                   	pop    %ebp
+  801311:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801312:	83 ec 0c             	sub    $0xc,%esp
+  801315:	50                   	push   %eax
+  801316:	6a 13                	push   $0x13
+  801318:	68 f5 50 80 00       	push   $0x8050f5
+  80131d:	6a 54                	push   $0x54
+  80131f:	68 12 51 80 00       	push   $0x805112
+  801324:	e8 46 f1 ff ff       	call   80046f <_panic>
+
+00801329 <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  801329:	55                   	push   %ebp
+  80132a:	89 e5                	mov    %esp,%ebp
+  80132c:	57                   	push   %edi
+  80132d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80132e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801333:	b8 14 00 00 00       	mov    $0x14,%eax
+  801338:	89 d1                	mov    %edx,%ecx
+  80133a:	89 d3                	mov    %edx,%ebx
+  80133c:	89 d7                	mov    %edx,%edi
+  80133e:	6a 00                	push   $0x0
+  801340:	55                   	push   %ebp
+  801341:	56                   	push   %esi
+  801342:	89 e5                	mov    %esp,%ebp
+  801344:	8d 35 4c 13 80 00    	lea    0x80134c,%esi
+  80134a:	0f 34                	sysenter
+
+0080134c <after_sysenter_label_1939>:
+  80134c:	5e                   	pop    %esi
+  80134d:	5d                   	pop    %ebp
+  80134e:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  801351:	5b                   	pop    %ebx
+  801352:	5f                   	pop    %edi
+  801353:	5d                   	pop    %ebp
+  801354:	c3                   	ret
+
+00801355 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  801355:	55                   	push   %ebp
+  801356:	89 e5                	mov    %esp,%ebp
+  801358:	57                   	push   %edi
+  801359:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80135a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80135d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801360:	b8 15 00 00 00       	mov    $0x15,%eax
+  801365:	bf 00 00 00 00       	mov    $0x0,%edi
+  80136a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80136d:	6a 00                	push   $0x0
+  80136f:	55                   	push   %ebp
+  801370:	56                   	push   %esi
+  801371:	89 e5                	mov    %esp,%ebp
+  801373:	8d 35 7b 13 80 00    	lea    0x80137b,%esi
+  801379:	0f 34                	sysenter
+
+0080137b <after_sysenter_label_2028>:
+  80137b:	5e                   	pop    %esi
+  80137c:	5d                   	pop    %ebp
+  80137d:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  801380:	5b                   	pop    %ebx
+  801381:	5f                   	pop    %edi
+  801382:	5d                   	pop    %ebp
+  801383:	c3                   	ret
+
+00801384 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  801384:	55                   	push   %ebp
+  801385:	89 e5                	mov    %esp,%ebp
+  801387:	57                   	push   %edi
+  801388:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801389:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80138e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801391:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801394:	b8 16 00 00 00       	mov    $0x16,%eax
+  801399:	89 df                	mov    %ebx,%edi
+  80139b:	6a 00                	push   $0x0
+  80139d:	55                   	push   %ebp
+  80139e:	56                   	push   %esi
+  80139f:	89 e5                	mov    %esp,%ebp
+  8013a1:	8d 35 a9 13 80 00    	lea    0x8013a9,%esi
+  8013a7:	0f 34                	sysenter
+
+008013a9 <after_sysenter_label_2114>:
+  8013a9:	5e                   	pop    %esi
+  8013aa:	5d                   	pop    %ebp
+  8013ab:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  8013ae:	5b                   	pop    %ebx
+  8013af:	5f                   	pop    %edi
+  8013b0:	5d                   	pop    %ebp
+  8013b1:	c3                   	ret
+
+008013b2 <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  8013b2:	55                   	push   %ebp
+  8013b3:	89 e5                	mov    %esp,%ebp
+  8013b5:	57                   	push   %edi
+  8013b6:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8013b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013bf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013c2:	b8 17 00 00 00       	mov    $0x17,%eax
+  8013c7:	89 df                	mov    %ebx,%edi
+  8013c9:	6a 00                	push   $0x0
+  8013cb:	55                   	push   %ebp
+  8013cc:	56                   	push   %esi
+  8013cd:	89 e5                	mov    %esp,%ebp
+  8013cf:	8d 35 d7 13 80 00    	lea    0x8013d7,%esi
+  8013d5:	0f 34                	sysenter
+
+008013d7 <after_sysenter_label_2200>:
+  8013d7:	5e                   	pop    %esi
+  8013d8:	5d                   	pop    %ebp
+  8013d9:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  8013dc:	5b                   	pop    %ebx
+  8013dd:	5f                   	pop    %edi
+  8013de:	5d                   	pop    %ebp
+  8013df:	c3                   	ret
+
+008013e0 <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  8013e0:	55                   	push   %ebp
+  8013e1:	89 e5                	mov    %esp,%ebp
+  8013e3:	57                   	push   %edi
+  8013e4:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8013e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013f0:	b8 18 00 00 00       	mov    $0x18,%eax
+  8013f5:	89 df                	mov    %ebx,%edi
+  8013f7:	6a 00                	push   $0x0
+  8013f9:	55                   	push   %ebp
+  8013fa:	56                   	push   %esi
+  8013fb:	89 e5                	mov    %esp,%ebp
+  8013fd:	8d 35 05 14 80 00    	lea    0x801405,%esi
+  801403:	0f 34                	sysenter
+
+00801405 <after_sysenter_label_2286>:
+  801405:	5e                   	pop    %esi
+  801406:	5d                   	pop    %ebp
+  801407:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  80140a:	5b                   	pop    %ebx
+  80140b:	5f                   	pop    %edi
+  80140c:	5d                   	pop    %ebp
+  80140d:	c3                   	ret
+
+0080140e <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80140e:	55                   	push   %ebp
+  80140f:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801411:	8b 45 08             	mov    0x8(%ebp),%eax
+  801414:	05 00 00 00 30       	add    $0x30000000,%eax
+  801419:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80141c:	5d                   	pop    %ebp
+  80141d:	c3                   	ret
+
+0080141e <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80141e:	55                   	push   %ebp
+  80141f:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801421:	8b 45 08             	mov    0x8(%ebp),%eax
+  801424:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801429:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80142e:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801433:	5d                   	pop    %ebp
+  801434:	c3                   	ret
+
+00801435 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801435:	55                   	push   %ebp
+  801436:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801438:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80143d:	eb 02                	jmp    801441 <fd_alloc+0xc>
+  80143f:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801441:	89 c2                	mov    %eax,%edx
+  801443:	c1 ea 16             	shr    $0x16,%edx
+  801446:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80144d:	f6 c2 01             	test   $0x1,%dl
+  801450:	74 2b                	je     80147d <fd_alloc+0x48>
+  801452:	89 c2                	mov    %eax,%edx
+  801454:	c1 ea 0c             	shr    $0xc,%edx
+  801457:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80145e:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801464:	f6 c1 01             	test   $0x1,%cl
+  801467:	74 14                	je     80147d <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801469:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80146f:	75 ce                	jne    80143f <fd_alloc+0xa>
+  801471:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801476:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80147b:	eb 05                	jmp    801482 <fd_alloc+0x4d>
+			return 0;
+  80147d:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801482:	8b 55 08             	mov    0x8(%ebp),%edx
+  801485:	89 02                	mov    %eax,(%edx)
+}
+  801487:	89 c8                	mov    %ecx,%eax
+  801489:	5d                   	pop    %ebp
+  80148a:	c3                   	ret
+
+0080148b <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80148b:	55                   	push   %ebp
+  80148c:	89 e5                	mov    %esp,%ebp
+  80148e:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801491:	83 f8 1f             	cmp    $0x1f,%eax
+  801494:	77 30                	ja     8014c6 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801496:	c1 e0 0c             	shl    $0xc,%eax
+  801499:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80149e:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8014a4:	f6 c2 01             	test   $0x1,%dl
+  8014a7:	74 24                	je     8014cd <fd_lookup+0x42>
+  8014a9:	89 c2                	mov    %eax,%edx
+  8014ab:	c1 ea 0c             	shr    $0xc,%edx
+  8014ae:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8014b5:	f6 c2 01             	test   $0x1,%dl
+  8014b8:	74 1a                	je     8014d4 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8014ba:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8014bd:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8014bf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8014c4:	5d                   	pop    %ebp
+  8014c5:	c3                   	ret
+		return -E_INVAL;
+  8014c6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014cb:	eb f7                	jmp    8014c4 <fd_lookup+0x39>
+		return -E_INVAL;
+  8014cd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014d2:	eb f0                	jmp    8014c4 <fd_lookup+0x39>
+  8014d4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014d9:	eb e9                	jmp    8014c4 <fd_lookup+0x39>
+
+008014db <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8014db:	55                   	push   %ebp
+  8014dc:	89 e5                	mov    %esp,%ebp
+  8014de:	53                   	push   %ebx
+  8014df:	83 ec 04             	sub    $0x4,%esp
+  8014e2:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8014e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014ea:	eb 03                	jmp    8014ef <dev_lookup+0x14>
+  8014ec:	83 c0 01             	add    $0x1,%eax
+  8014ef:	8b 1c 85 9c 51 80 00 	mov    0x80519c(,%eax,4),%ebx
+  8014f6:	85 db                	test   %ebx,%ebx
+  8014f8:	74 0b                	je     801505 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8014fa:	39 13                	cmp    %edx,(%ebx)
+  8014fc:	75 ee                	jne    8014ec <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8014fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801503:	eb 49                	jmp    80154e <dev_lookup+0x73>
+  801505:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801507:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  80150d:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801512:	77 18                	ja     80152c <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801514:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801519:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  80151b:	c1 e8 10             	shr    $0x10,%eax
+  80151e:	74 0c                	je     80152c <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801520:	c1 e0 10             	shl    $0x10,%eax
+  801523:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  801528:	29 c1                	sub    %eax,%ecx
+  80152a:	eb 06                	jmp    801532 <dev_lookup+0x57>
+		return pthread_main_tls;
+  80152c:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801532:	8b 01                	mov    (%ecx),%eax
+  801534:	8b 40 48             	mov    0x48(%eax),%eax
+  801537:	83 ec 04             	sub    $0x4,%esp
+  80153a:	52                   	push   %edx
+  80153b:	50                   	push   %eax
+  80153c:	68 20 51 80 00       	push   $0x805120
+  801541:	e8 04 f0 ff ff       	call   80054a <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801546:	83 c4 10             	add    $0x10,%esp
+  801549:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80154e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801551:	89 1a                	mov    %ebx,(%edx)
+}
+  801553:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801556:	c9                   	leave
+  801557:	c3                   	ret
+
+00801558 <fd_close>:
+{
+  801558:	55                   	push   %ebp
+  801559:	89 e5                	mov    %esp,%ebp
+  80155b:	57                   	push   %edi
+  80155c:	56                   	push   %esi
+  80155d:	53                   	push   %ebx
+  80155e:	83 ec 24             	sub    $0x24,%esp
+  801561:	8b 75 08             	mov    0x8(%ebp),%esi
+  801564:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801567:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80156a:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80156b:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801571:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801574:	50                   	push   %eax
+  801575:	e8 11 ff ff ff       	call   80148b <fd_lookup>
+  80157a:	89 c3                	mov    %eax,%ebx
+  80157c:	83 c4 10             	add    $0x10,%esp
+  80157f:	85 c0                	test   %eax,%eax
+  801581:	78 05                	js     801588 <fd_close+0x30>
+	    || fd != fd2)
+  801583:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801586:	74 16                	je     80159e <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801588:	89 f8                	mov    %edi,%eax
+  80158a:	84 c0                	test   %al,%al
+  80158c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801591:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801594:	89 d8                	mov    %ebx,%eax
+  801596:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801599:	5b                   	pop    %ebx
+  80159a:	5e                   	pop    %esi
+  80159b:	5f                   	pop    %edi
+  80159c:	5d                   	pop    %ebp
+  80159d:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80159e:	83 ec 08             	sub    $0x8,%esp
+  8015a1:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8015a4:	50                   	push   %eax
+  8015a5:	ff 36                	push   (%esi)
+  8015a7:	e8 2f ff ff ff       	call   8014db <dev_lookup>
+  8015ac:	89 c3                	mov    %eax,%ebx
+  8015ae:	83 c4 10             	add    $0x10,%esp
+  8015b1:	85 c0                	test   %eax,%eax
+  8015b3:	78 1a                	js     8015cf <fd_close+0x77>
+		if (dev->dev_close)
+  8015b5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8015b8:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8015bb:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8015c0:	85 c0                	test   %eax,%eax
+  8015c2:	74 0b                	je     8015cf <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8015c4:	83 ec 0c             	sub    $0xc,%esp
+  8015c7:	56                   	push   %esi
+  8015c8:	ff d0                	call   *%eax
+  8015ca:	89 c3                	mov    %eax,%ebx
+  8015cc:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8015cf:	83 ec 08             	sub    $0x8,%esp
+  8015d2:	56                   	push   %esi
+  8015d3:	6a 00                	push   $0x0
+  8015d5:	e8 2b fa ff ff       	call   801005 <sys_page_unmap>
+	return r;
+  8015da:	83 c4 10             	add    $0x10,%esp
+  8015dd:	eb b5                	jmp    801594 <fd_close+0x3c>
+
+008015df <close>:
+
+int
+close(int fdnum)
+{
+  8015df:	55                   	push   %ebp
+  8015e0:	89 e5                	mov    %esp,%ebp
+  8015e2:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8015e5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015e8:	50                   	push   %eax
+  8015e9:	ff 75 08             	push   0x8(%ebp)
+  8015ec:	e8 9a fe ff ff       	call   80148b <fd_lookup>
+  8015f1:	83 c4 10             	add    $0x10,%esp
+  8015f4:	85 c0                	test   %eax,%eax
+  8015f6:	79 02                	jns    8015fa <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8015f8:	c9                   	leave
+  8015f9:	c3                   	ret
+		return fd_close(fd, 1);
+  8015fa:	83 ec 08             	sub    $0x8,%esp
+  8015fd:	6a 01                	push   $0x1
+  8015ff:	ff 75 f4             	push   -0xc(%ebp)
+  801602:	e8 51 ff ff ff       	call   801558 <fd_close>
+  801607:	83 c4 10             	add    $0x10,%esp
+  80160a:	eb ec                	jmp    8015f8 <close+0x19>
+
+0080160c <close_all>:
+
+void
+close_all(void)
+{
+  80160c:	55                   	push   %ebp
+  80160d:	89 e5                	mov    %esp,%ebp
+  80160f:	53                   	push   %ebx
+  801610:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801613:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801618:	83 ec 0c             	sub    $0xc,%esp
+  80161b:	53                   	push   %ebx
+  80161c:	e8 be ff ff ff       	call   8015df <close>
+	for (i = 0; i < MAXFD; i++)
+  801621:	83 c3 01             	add    $0x1,%ebx
+  801624:	83 c4 10             	add    $0x10,%esp
+  801627:	83 fb 20             	cmp    $0x20,%ebx
+  80162a:	75 ec                	jne    801618 <close_all+0xc>
+}
+  80162c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80162f:	c9                   	leave
+  801630:	c3                   	ret
+
+00801631 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801631:	55                   	push   %ebp
+  801632:	89 e5                	mov    %esp,%ebp
+  801634:	57                   	push   %edi
+  801635:	56                   	push   %esi
+  801636:	53                   	push   %ebx
+  801637:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80163a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80163d:	50                   	push   %eax
+  80163e:	ff 75 08             	push   0x8(%ebp)
+  801641:	e8 45 fe ff ff       	call   80148b <fd_lookup>
+  801646:	89 c3                	mov    %eax,%ebx
+  801648:	83 c4 10             	add    $0x10,%esp
+  80164b:	85 c0                	test   %eax,%eax
+  80164d:	78 7f                	js     8016ce <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80164f:	83 ec 0c             	sub    $0xc,%esp
+  801652:	ff 75 0c             	push   0xc(%ebp)
+  801655:	e8 85 ff ff ff       	call   8015df <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80165a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80165d:	c1 e6 0c             	shl    $0xc,%esi
+  801660:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801666:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801669:	89 3c 24             	mov    %edi,(%esp)
+  80166c:	e8 ad fd ff ff       	call   80141e <fd2data>
+  801671:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801673:	89 34 24             	mov    %esi,(%esp)
+  801676:	e8 a3 fd ff ff       	call   80141e <fd2data>
+  80167b:	83 c4 10             	add    $0x10,%esp
+  80167e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801681:	89 d8                	mov    %ebx,%eax
+  801683:	c1 e8 16             	shr    $0x16,%eax
+  801686:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80168d:	a8 01                	test   $0x1,%al
+  80168f:	74 11                	je     8016a2 <dup+0x71>
+  801691:	89 d8                	mov    %ebx,%eax
+  801693:	c1 e8 0c             	shr    $0xc,%eax
+  801696:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80169d:	f6 c2 01             	test   $0x1,%dl
+  8016a0:	75 36                	jne    8016d8 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8016a2:	89 f8                	mov    %edi,%eax
+  8016a4:	c1 e8 0c             	shr    $0xc,%eax
+  8016a7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8016ae:	83 ec 0c             	sub    $0xc,%esp
+  8016b1:	25 07 0e 00 00       	and    $0xe07,%eax
+  8016b6:	50                   	push   %eax
+  8016b7:	56                   	push   %esi
+  8016b8:	6a 00                	push   $0x0
+  8016ba:	57                   	push   %edi
+  8016bb:	6a 00                	push   $0x0
+  8016bd:	e8 f7 f8 ff ff       	call   800fb9 <sys_page_map>
+  8016c2:	89 c3                	mov    %eax,%ebx
+  8016c4:	83 c4 20             	add    $0x20,%esp
+  8016c7:	85 c0                	test   %eax,%eax
+  8016c9:	78 33                	js     8016fe <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8016cb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8016ce:	89 d8                	mov    %ebx,%eax
+  8016d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016d3:	5b                   	pop    %ebx
+  8016d4:	5e                   	pop    %esi
+  8016d5:	5f                   	pop    %edi
+  8016d6:	5d                   	pop    %ebp
+  8016d7:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8016d8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8016df:	83 ec 0c             	sub    $0xc,%esp
+  8016e2:	25 07 0e 00 00       	and    $0xe07,%eax
+  8016e7:	50                   	push   %eax
+  8016e8:	ff 75 d4             	push   -0x2c(%ebp)
+  8016eb:	6a 00                	push   $0x0
+  8016ed:	53                   	push   %ebx
+  8016ee:	6a 00                	push   $0x0
+  8016f0:	e8 c4 f8 ff ff       	call   800fb9 <sys_page_map>
+  8016f5:	89 c3                	mov    %eax,%ebx
+  8016f7:	83 c4 20             	add    $0x20,%esp
+  8016fa:	85 c0                	test   %eax,%eax
+  8016fc:	79 a4                	jns    8016a2 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8016fe:	83 ec 08             	sub    $0x8,%esp
+  801701:	56                   	push   %esi
+  801702:	6a 00                	push   $0x0
+  801704:	e8 fc f8 ff ff       	call   801005 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801709:	83 c4 08             	add    $0x8,%esp
+  80170c:	ff 75 d4             	push   -0x2c(%ebp)
+  80170f:	6a 00                	push   $0x0
+  801711:	e8 ef f8 ff ff       	call   801005 <sys_page_unmap>
+	return r;
+  801716:	83 c4 10             	add    $0x10,%esp
+  801719:	eb b3                	jmp    8016ce <dup+0x9d>
+
+0080171b <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80171b:	55                   	push   %ebp
+  80171c:	89 e5                	mov    %esp,%ebp
+  80171e:	56                   	push   %esi
+  80171f:	53                   	push   %ebx
+  801720:	83 ec 18             	sub    $0x18,%esp
+  801723:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801726:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801729:	50                   	push   %eax
+  80172a:	53                   	push   %ebx
+  80172b:	e8 5b fd ff ff       	call   80148b <fd_lookup>
+  801730:	83 c4 10             	add    $0x10,%esp
+  801733:	85 c0                	test   %eax,%eax
+  801735:	78 3c                	js     801773 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801737:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80173a:	83 ec 08             	sub    $0x8,%esp
+  80173d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801740:	50                   	push   %eax
+  801741:	ff 36                	push   (%esi)
+  801743:	e8 93 fd ff ff       	call   8014db <dev_lookup>
+  801748:	83 c4 10             	add    $0x10,%esp
+  80174b:	85 c0                	test   %eax,%eax
+  80174d:	78 24                	js     801773 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80174f:	8b 46 08             	mov    0x8(%esi),%eax
+  801752:	83 e0 03             	and    $0x3,%eax
+  801755:	83 f8 01             	cmp    $0x1,%eax
+  801758:	74 20                	je     80177a <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80175a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80175d:	8b 40 08             	mov    0x8(%eax),%eax
+  801760:	85 c0                	test   %eax,%eax
+  801762:	74 61                	je     8017c5 <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801764:	83 ec 04             	sub    $0x4,%esp
+  801767:	ff 75 10             	push   0x10(%ebp)
+  80176a:	ff 75 0c             	push   0xc(%ebp)
+  80176d:	56                   	push   %esi
+  80176e:	ff d0                	call   *%eax
+  801770:	83 c4 10             	add    $0x10,%esp
+}
+  801773:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801776:	5b                   	pop    %ebx
+  801777:	5e                   	pop    %esi
+  801778:	5d                   	pop    %ebp
+  801779:	c3                   	ret
+  80177a:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80177c:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801782:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801787:	77 18                	ja     8017a1 <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801789:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80178e:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801790:	c1 e8 10             	shr    $0x10,%eax
+  801793:	74 0c                	je     8017a1 <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801795:	c1 e0 10             	shl    $0x10,%eax
+  801798:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80179d:	29 c2                	sub    %eax,%edx
+  80179f:	eb 06                	jmp    8017a7 <read+0x8c>
+		return pthread_main_tls;
+  8017a1:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8017a7:	8b 02                	mov    (%edx),%eax
+  8017a9:	8b 40 48             	mov    0x48(%eax),%eax
+  8017ac:	83 ec 04             	sub    $0x4,%esp
+  8017af:	53                   	push   %ebx
+  8017b0:	50                   	push   %eax
+  8017b1:	68 61 51 80 00       	push   $0x805161
+  8017b6:	e8 8f ed ff ff       	call   80054a <cprintf>
+		return -E_INVAL;
+  8017bb:	83 c4 10             	add    $0x10,%esp
+  8017be:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017c3:	eb ae                	jmp    801773 <read+0x58>
+		return -E_NOT_SUPP;
+  8017c5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017ca:	eb a7                	jmp    801773 <read+0x58>
+
+008017cc <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8017cc:	55                   	push   %ebp
+  8017cd:	89 e5                	mov    %esp,%ebp
+  8017cf:	57                   	push   %edi
+  8017d0:	56                   	push   %esi
+  8017d1:	53                   	push   %ebx
+  8017d2:	83 ec 0c             	sub    $0xc,%esp
+  8017d5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8017d8:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8017db:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017e0:	eb 02                	jmp    8017e4 <readn+0x18>
+  8017e2:	01 c3                	add    %eax,%ebx
+  8017e4:	39 f3                	cmp    %esi,%ebx
+  8017e6:	73 21                	jae    801809 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8017e8:	83 ec 04             	sub    $0x4,%esp
+  8017eb:	89 f0                	mov    %esi,%eax
+  8017ed:	29 d8                	sub    %ebx,%eax
+  8017ef:	50                   	push   %eax
+  8017f0:	89 d8                	mov    %ebx,%eax
+  8017f2:	03 45 0c             	add    0xc(%ebp),%eax
+  8017f5:	50                   	push   %eax
+  8017f6:	57                   	push   %edi
+  8017f7:	e8 1f ff ff ff       	call   80171b <read>
+		if (m < 0)
+  8017fc:	83 c4 10             	add    $0x10,%esp
+  8017ff:	85 c0                	test   %eax,%eax
+  801801:	78 04                	js     801807 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801803:	75 dd                	jne    8017e2 <readn+0x16>
+  801805:	eb 02                	jmp    801809 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801807:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801809:	89 d8                	mov    %ebx,%eax
+  80180b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80180e:	5b                   	pop    %ebx
+  80180f:	5e                   	pop    %esi
+  801810:	5f                   	pop    %edi
+  801811:	5d                   	pop    %ebp
+  801812:	c3                   	ret
+
+00801813 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801813:	55                   	push   %ebp
+  801814:	89 e5                	mov    %esp,%ebp
+  801816:	56                   	push   %esi
+  801817:	53                   	push   %ebx
+  801818:	83 ec 18             	sub    $0x18,%esp
+  80181b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80181e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801821:	50                   	push   %eax
+  801822:	53                   	push   %ebx
+  801823:	e8 63 fc ff ff       	call   80148b <fd_lookup>
+  801828:	83 c4 10             	add    $0x10,%esp
+  80182b:	85 c0                	test   %eax,%eax
+  80182d:	78 37                	js     801866 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80182f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801832:	83 ec 08             	sub    $0x8,%esp
+  801835:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801838:	50                   	push   %eax
+  801839:	ff 36                	push   (%esi)
+  80183b:	e8 9b fc ff ff       	call   8014db <dev_lookup>
+  801840:	83 c4 10             	add    $0x10,%esp
+  801843:	85 c0                	test   %eax,%eax
+  801845:	78 1f                	js     801866 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801847:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80184b:	74 20                	je     80186d <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80184d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801850:	8b 40 0c             	mov    0xc(%eax),%eax
+  801853:	85 c0                	test   %eax,%eax
+  801855:	74 61                	je     8018b8 <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801857:	83 ec 04             	sub    $0x4,%esp
+  80185a:	ff 75 10             	push   0x10(%ebp)
+  80185d:	ff 75 0c             	push   0xc(%ebp)
+  801860:	56                   	push   %esi
+  801861:	ff d0                	call   *%eax
+  801863:	83 c4 10             	add    $0x10,%esp
+}
+  801866:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801869:	5b                   	pop    %ebx
+  80186a:	5e                   	pop    %esi
+  80186b:	5d                   	pop    %ebp
+  80186c:	c3                   	ret
+  80186d:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80186f:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801875:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80187a:	77 18                	ja     801894 <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80187c:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801881:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801883:	c1 e8 10             	shr    $0x10,%eax
+  801886:	74 0c                	je     801894 <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801888:	c1 e0 10             	shl    $0x10,%eax
+  80188b:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801890:	29 c2                	sub    %eax,%edx
+  801892:	eb 06                	jmp    80189a <write+0x87>
+		return pthread_main_tls;
+  801894:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80189a:	8b 02                	mov    (%edx),%eax
+  80189c:	8b 40 48             	mov    0x48(%eax),%eax
+  80189f:	83 ec 04             	sub    $0x4,%esp
+  8018a2:	53                   	push   %ebx
+  8018a3:	50                   	push   %eax
+  8018a4:	68 7d 51 80 00       	push   $0x80517d
+  8018a9:	e8 9c ec ff ff       	call   80054a <cprintf>
+		return -E_INVAL;
+  8018ae:	83 c4 10             	add    $0x10,%esp
+  8018b1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018b6:	eb ae                	jmp    801866 <write+0x53>
+		return -E_NOT_SUPP;
+  8018b8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018bd:	eb a7                	jmp    801866 <write+0x53>
+
+008018bf <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8018bf:	55                   	push   %ebp
+  8018c0:	89 e5                	mov    %esp,%ebp
+  8018c2:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8018c5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018c8:	50                   	push   %eax
+  8018c9:	ff 75 08             	push   0x8(%ebp)
+  8018cc:	e8 ba fb ff ff       	call   80148b <fd_lookup>
+  8018d1:	83 c4 10             	add    $0x10,%esp
+  8018d4:	85 c0                	test   %eax,%eax
+  8018d6:	78 0e                	js     8018e6 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8018d8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8018db:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018de:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8018e1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018e6:	c9                   	leave
+  8018e7:	c3                   	ret
+
+008018e8 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8018e8:	55                   	push   %ebp
+  8018e9:	89 e5                	mov    %esp,%ebp
+  8018eb:	56                   	push   %esi
+  8018ec:	53                   	push   %ebx
+  8018ed:	83 ec 18             	sub    $0x18,%esp
+  8018f0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018f3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018f6:	50                   	push   %eax
+  8018f7:	53                   	push   %ebx
+  8018f8:	e8 8e fb ff ff       	call   80148b <fd_lookup>
+  8018fd:	83 c4 10             	add    $0x10,%esp
+  801900:	85 c0                	test   %eax,%eax
+  801902:	78 34                	js     801938 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801904:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801907:	83 ec 08             	sub    $0x8,%esp
+  80190a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80190d:	50                   	push   %eax
+  80190e:	ff 36                	push   (%esi)
+  801910:	e8 c6 fb ff ff       	call   8014db <dev_lookup>
+  801915:	83 c4 10             	add    $0x10,%esp
+  801918:	85 c0                	test   %eax,%eax
+  80191a:	78 1c                	js     801938 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80191c:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801920:	74 1d                	je     80193f <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801922:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801925:	8b 40 18             	mov    0x18(%eax),%eax
+  801928:	85 c0                	test   %eax,%eax
+  80192a:	74 5e                	je     80198a <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80192c:	83 ec 08             	sub    $0x8,%esp
+  80192f:	ff 75 0c             	push   0xc(%ebp)
+  801932:	56                   	push   %esi
+  801933:	ff d0                	call   *%eax
+  801935:	83 c4 10             	add    $0x10,%esp
+}
+  801938:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80193b:	5b                   	pop    %ebx
+  80193c:	5e                   	pop    %esi
+  80193d:	5d                   	pop    %ebp
+  80193e:	c3                   	ret
+  80193f:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801941:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801947:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80194c:	77 18                	ja     801966 <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80194e:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801953:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801955:	c1 e8 10             	shr    $0x10,%eax
+  801958:	74 0c                	je     801966 <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80195a:	c1 e0 10             	shl    $0x10,%eax
+  80195d:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801962:	29 c2                	sub    %eax,%edx
+  801964:	eb 06                	jmp    80196c <ftruncate+0x84>
+		return pthread_main_tls;
+  801966:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+			thisenv->env_id, fdnum);
+  80196c:	8b 02                	mov    (%edx),%eax
+  80196e:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801971:	83 ec 04             	sub    $0x4,%esp
+  801974:	53                   	push   %ebx
+  801975:	50                   	push   %eax
+  801976:	68 40 51 80 00       	push   $0x805140
+  80197b:	e8 ca eb ff ff       	call   80054a <cprintf>
+		return -E_INVAL;
+  801980:	83 c4 10             	add    $0x10,%esp
+  801983:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801988:	eb ae                	jmp    801938 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80198a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80198f:	eb a7                	jmp    801938 <ftruncate+0x50>
+
+00801991 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801991:	55                   	push   %ebp
+  801992:	89 e5                	mov    %esp,%ebp
+  801994:	56                   	push   %esi
+  801995:	53                   	push   %ebx
+  801996:	83 ec 18             	sub    $0x18,%esp
+  801999:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80199c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80199f:	50                   	push   %eax
+  8019a0:	ff 75 08             	push   0x8(%ebp)
+  8019a3:	e8 e3 fa ff ff       	call   80148b <fd_lookup>
+  8019a8:	83 c4 10             	add    $0x10,%esp
+  8019ab:	85 c0                	test   %eax,%eax
+  8019ad:	78 49                	js     8019f8 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8019af:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8019b2:	83 ec 08             	sub    $0x8,%esp
+  8019b5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019b8:	50                   	push   %eax
+  8019b9:	ff 36                	push   (%esi)
+  8019bb:	e8 1b fb ff ff       	call   8014db <dev_lookup>
+  8019c0:	83 c4 10             	add    $0x10,%esp
+  8019c3:	85 c0                	test   %eax,%eax
+  8019c5:	78 31                	js     8019f8 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8019c7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019ca:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8019ce:	74 2f                	je     8019ff <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8019d0:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8019d3:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8019da:	00 00 00 
+	stat->st_isdir = 0;
+  8019dd:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8019e4:	00 00 00 
+	stat->st_dev = dev;
+  8019e7:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8019ed:	83 ec 08             	sub    $0x8,%esp
+  8019f0:	53                   	push   %ebx
+  8019f1:	56                   	push   %esi
+  8019f2:	ff 50 14             	call   *0x14(%eax)
+  8019f5:	83 c4 10             	add    $0x10,%esp
+}
+  8019f8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019fb:	5b                   	pop    %ebx
+  8019fc:	5e                   	pop    %esi
+  8019fd:	5d                   	pop    %ebp
+  8019fe:	c3                   	ret
+		return -E_NOT_SUPP;
+  8019ff:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a04:	eb f2                	jmp    8019f8 <fstat+0x67>
+
+00801a06 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801a06:	55                   	push   %ebp
+  801a07:	89 e5                	mov    %esp,%ebp
+  801a09:	56                   	push   %esi
+  801a0a:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801a0b:	83 ec 08             	sub    $0x8,%esp
+  801a0e:	6a 00                	push   $0x0
+  801a10:	ff 75 08             	push   0x8(%ebp)
+  801a13:	e8 4b 03 00 00       	call   801d63 <open>
+  801a18:	89 c3                	mov    %eax,%ebx
+  801a1a:	83 c4 10             	add    $0x10,%esp
+  801a1d:	85 c0                	test   %eax,%eax
+  801a1f:	78 1b                	js     801a3c <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801a21:	83 ec 08             	sub    $0x8,%esp
+  801a24:	ff 75 0c             	push   0xc(%ebp)
+  801a27:	50                   	push   %eax
+  801a28:	e8 64 ff ff ff       	call   801991 <fstat>
+  801a2d:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801a2f:	89 1c 24             	mov    %ebx,(%esp)
+  801a32:	e8 a8 fb ff ff       	call   8015df <close>
+	return r;
+  801a37:	83 c4 10             	add    $0x10,%esp
+  801a3a:	89 f3                	mov    %esi,%ebx
+}
+  801a3c:	89 d8                	mov    %ebx,%eax
+  801a3e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a41:	5b                   	pop    %ebx
+  801a42:	5e                   	pop    %esi
+  801a43:	5d                   	pop    %ebp
+  801a44:	c3                   	ret
+
+00801a45 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801a45:	55                   	push   %ebp
+  801a46:	89 e5                	mov    %esp,%ebp
+  801a48:	56                   	push   %esi
+  801a49:	53                   	push   %ebx
+  801a4a:	89 c6                	mov    %eax,%esi
+  801a4c:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801a4e:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  801a55:	74 27                	je     801a7e <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801a57:	6a 07                	push   $0x7
+  801a59:	68 00 80 80 00       	push   $0x808000
+  801a5e:	56                   	push   %esi
+  801a5f:	ff 35 00 70 80 00    	push   0x807000
+  801a65:	e8 88 2d 00 00       	call   8047f2 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801a6a:	83 c4 0c             	add    $0xc,%esp
+  801a6d:	6a 00                	push   $0x0
+  801a6f:	53                   	push   %ebx
+  801a70:	6a 00                	push   $0x0
+  801a72:	e8 85 2c 00 00       	call   8046fc <ipc_recv>
+}
+  801a77:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a7a:	5b                   	pop    %ebx
+  801a7b:	5e                   	pop    %esi
+  801a7c:	5d                   	pop    %ebp
+  801a7d:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801a7e:	83 ec 0c             	sub    $0xc,%esp
+  801a81:	6a 01                	push   $0x1
+  801a83:	e8 c0 2d 00 00       	call   804848 <ipc_find_env>
+  801a88:	a3 00 70 80 00       	mov    %eax,0x807000
+  801a8d:	83 c4 10             	add    $0x10,%esp
+  801a90:	eb c5                	jmp    801a57 <fsipc+0x12>
+
+00801a92 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801a92:	55                   	push   %ebp
+  801a93:	89 e5                	mov    %esp,%ebp
+  801a95:	53                   	push   %ebx
+  801a96:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801a99:	68 04 70 80 00       	push   $0x807004
+  801a9e:	e8 29 1b 00 00       	call   8035cc <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801aa3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801aa6:	8b 40 0c             	mov    0xc(%eax),%eax
+  801aa9:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.set_size.req_size = newsize;
+  801aae:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ab1:	a3 04 80 80 00       	mov    %eax,0x808004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  801ab6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801abb:	b8 02 00 00 00       	mov    $0x2,%eax
+  801ac0:	e8 80 ff ff ff       	call   801a45 <fsipc>
+  801ac5:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801ac7:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801ace:	e8 66 1b 00 00       	call   803639 <mutex_unlock>
+	return r;
+}
+  801ad3:	89 d8                	mov    %ebx,%eax
+  801ad5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ad8:	c9                   	leave
+  801ad9:	c3                   	ret
+
+00801ada <devfile_flush>:
+{
+  801ada:	55                   	push   %ebp
+  801adb:	89 e5                	mov    %esp,%ebp
+  801add:	53                   	push   %ebx
+  801ade:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  801ae1:	68 04 70 80 00       	push   $0x807004
+  801ae6:	e8 e1 1a 00 00       	call   8035cc <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801aeb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801aee:	8b 40 0c             	mov    0xc(%eax),%eax
+  801af1:	a3 00 80 80 00       	mov    %eax,0x808000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  801af6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801afb:	b8 06 00 00 00       	mov    $0x6,%eax
+  801b00:	e8 40 ff ff ff       	call   801a45 <fsipc>
+  801b05:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801b07:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801b0e:	e8 26 1b 00 00       	call   803639 <mutex_unlock>
+}
+  801b13:	89 d8                	mov    %ebx,%eax
+  801b15:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b18:	c9                   	leave
+  801b19:	c3                   	ret
+
+00801b1a <devfile_stat>:
+{
+  801b1a:	55                   	push   %ebp
+  801b1b:	89 e5                	mov    %esp,%ebp
+  801b1d:	56                   	push   %esi
+  801b1e:	53                   	push   %ebx
+  801b1f:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  801b22:	83 ec 0c             	sub    $0xc,%esp
+  801b25:	68 04 70 80 00       	push   $0x807004
+  801b2a:	e8 9d 1a 00 00       	call   8035cc <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801b2f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b32:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b35:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  801b3a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b3f:	b8 05 00 00 00       	mov    $0x5,%eax
+  801b44:	e8 fc fe ff ff       	call   801a45 <fsipc>
+  801b49:	89 c3                	mov    %eax,%ebx
+  801b4b:	83 c4 10             	add    $0x10,%esp
+  801b4e:	85 c0                	test   %eax,%eax
+  801b50:	79 16                	jns    801b68 <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  801b52:	83 ec 0c             	sub    $0xc,%esp
+  801b55:	68 04 70 80 00       	push   $0x807004
+  801b5a:	e8 da 1a 00 00       	call   803639 <mutex_unlock>
+}
+  801b5f:	89 d8                	mov    %ebx,%eax
+  801b61:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b64:	5b                   	pop    %ebx
+  801b65:	5e                   	pop    %esi
+  801b66:	5d                   	pop    %ebp
+  801b67:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801b68:	83 ec 08             	sub    $0x8,%esp
+  801b6b:	68 00 80 80 00       	push   $0x808000
+  801b70:	56                   	push   %esi
+  801b71:	e8 b8 ef ff ff       	call   800b2e <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  801b76:	a1 80 80 80 00       	mov    0x808080,%eax
+  801b7b:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801b81:	a1 84 80 80 00       	mov    0x808084,%eax
+  801b86:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  801b8c:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  801b8f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b94:	eb bc                	jmp    801b52 <devfile_stat+0x38>
+
+00801b96 <devfile_write>:
+{
+  801b96:	55                   	push   %ebp
+  801b97:	89 e5                	mov    %esp,%ebp
+  801b99:	53                   	push   %ebx
+  801b9a:	83 ec 10             	sub    $0x10,%esp
+  801b9d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  801ba0:	68 04 70 80 00       	push   $0x807004
+  801ba5:	e8 22 1a 00 00       	call   8035cc <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801baa:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bad:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bb0:	a3 00 80 80 00       	mov    %eax,0x808000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801bb5:	83 c4 10             	add    $0x10,%esp
+  801bb8:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  801bbe:	76 3d                	jbe    801bfd <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  801bc0:	b8 00 00 10 00       	mov    $0x100000,%eax
+  801bc5:	39 c3                	cmp    %eax,%ebx
+  801bc7:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  801bca:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801bcd:	a3 08 80 80 00       	mov    %eax,0x808008
+	fsipcbuf.write.req_n = n;
+  801bd2:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	r = fsipc(FSREQ_WRITE, NULL);
+  801bd8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bdd:	b8 04 00 00 00       	mov    $0x4,%eax
+  801be2:	e8 5e fe ff ff       	call   801a45 <fsipc>
+  801be7:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801be9:	83 ec 0c             	sub    $0xc,%esp
+  801bec:	68 04 70 80 00       	push   $0x807004
+  801bf1:	e8 43 1a 00 00       	call   803639 <mutex_unlock>
+}
+  801bf6:	89 d8                	mov    %ebx,%eax
+  801bf8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bfb:	c9                   	leave
+  801bfc:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  801bfd:	83 ec 04             	sub    $0x4,%esp
+  801c00:	53                   	push   %ebx
+  801c01:	ff 75 0c             	push   0xc(%ebp)
+  801c04:	68 0c 80 80 00       	push   $0x80800c
+  801c09:	e8 a6 f0 ff ff       	call   800cb4 <memmove>
+  801c0e:	83 c4 10             	add    $0x10,%esp
+  801c11:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c16:	eb b5                	jmp    801bcd <devfile_write+0x37>
+
+00801c18 <devfile_read>:
+{
+  801c18:	55                   	push   %ebp
+  801c19:	89 e5                	mov    %esp,%ebp
+  801c1b:	57                   	push   %edi
+  801c1c:	56                   	push   %esi
+  801c1d:	53                   	push   %ebx
+  801c1e:	83 ec 0c             	sub    $0xc,%esp
+  801c21:	8b 75 08             	mov    0x8(%ebp),%esi
+  801c24:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801c27:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  801c2a:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801c30:	0f 86 8c 00 00 00    	jbe    801cc2 <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  801c36:	b8 00 00 10 00       	mov    $0x100000,%eax
+  801c3b:	39 c3                	cmp    %eax,%ebx
+  801c3d:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  801c40:	89 f8                	mov    %edi,%eax
+  801c42:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801c45:	eb 0f                	jmp    801c56 <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  801c47:	0f b6 08             	movzbl (%eax),%ecx
+  801c4a:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  801c4c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801c51:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  801c56:	39 d0                	cmp    %edx,%eax
+  801c58:	72 ed                	jb     801c47 <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  801c5a:	83 ec 0c             	sub    $0xc,%esp
+  801c5d:	68 04 70 80 00       	push   $0x807004
+  801c62:	e8 65 19 00 00       	call   8035cc <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801c67:	8b 46 0c             	mov    0xc(%esi),%eax
+  801c6a:	a3 00 80 80 00       	mov    %eax,0x808000
+		fsipcbuf.read.req_n = n;
+  801c6f:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  801c75:	89 3d 08 80 80 00    	mov    %edi,0x808008
+		r = fsipc(FSREQ_READ, NULL);
+  801c7b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c80:	b8 03 00 00 00       	mov    $0x3,%eax
+  801c85:	e8 bb fd ff ff       	call   801a45 <fsipc>
+  801c8a:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  801c8c:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801c93:	e8 a1 19 00 00       	call   803639 <mutex_unlock>
+		assert(r <= (int) n);
+  801c98:	83 c4 10             	add    $0x10,%esp
+  801c9b:	39 f3                	cmp    %esi,%ebx
+  801c9d:	7c 0a                	jl     801ca9 <devfile_read+0x91>
+}
+  801c9f:	89 f0                	mov    %esi,%eax
+  801ca1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ca4:	5b                   	pop    %ebx
+  801ca5:	5e                   	pop    %esi
+  801ca6:	5f                   	pop    %edi
+  801ca7:	5d                   	pop    %ebp
+  801ca8:	c3                   	ret
+		assert(r <= (int) n);
+  801ca9:	68 b0 51 80 00       	push   $0x8051b0
+  801cae:	68 bd 51 80 00       	push   $0x8051bd
+  801cb3:	68 90 00 00 00       	push   $0x90
+  801cb8:	68 d2 51 80 00       	push   $0x8051d2
+  801cbd:	e8 ad e7 ff ff       	call   80046f <_panic>
+	mutex_lock(&fsipc_mu);
+  801cc2:	83 ec 0c             	sub    $0xc,%esp
+  801cc5:	68 04 70 80 00       	push   $0x807004
+  801cca:	e8 fd 18 00 00       	call   8035cc <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801ccf:	8b 46 0c             	mov    0xc(%esi),%eax
+  801cd2:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.read.req_n = n;
+  801cd7:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	fsipcbuf.read.req_va = 0;
+  801cdd:	c7 05 08 80 80 00 00 	movl   $0x0,0x808008
+  801ce4:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  801ce7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cec:	b8 03 00 00 00       	mov    $0x3,%eax
+  801cf1:	e8 4f fd ff ff       	call   801a45 <fsipc>
+  801cf6:	89 c6                	mov    %eax,%esi
+  801cf8:	83 c4 10             	add    $0x10,%esp
+  801cfb:	85 c0                	test   %eax,%eax
+  801cfd:	78 1d                	js     801d1c <devfile_read+0x104>
+		assert(r <= n);
+  801cff:	39 c3                	cmp    %eax,%ebx
+  801d01:	72 2e                	jb     801d31 <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  801d03:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801d08:	7f 40                	jg     801d4a <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801d0a:	83 ec 04             	sub    $0x4,%esp
+  801d0d:	50                   	push   %eax
+  801d0e:	68 00 80 80 00       	push   $0x808000
+  801d13:	57                   	push   %edi
+  801d14:	e8 9b ef ff ff       	call   800cb4 <memmove>
+  801d19:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  801d1c:	83 ec 0c             	sub    $0xc,%esp
+  801d1f:	68 04 70 80 00       	push   $0x807004
+  801d24:	e8 10 19 00 00       	call   803639 <mutex_unlock>
+	return r;
+  801d29:	83 c4 10             	add    $0x10,%esp
+  801d2c:	e9 6e ff ff ff       	jmp    801c9f <devfile_read+0x87>
+		assert(r <= n);
+  801d31:	68 dd 51 80 00       	push   $0x8051dd
+  801d36:	68 bd 51 80 00       	push   $0x8051bd
+  801d3b:	68 99 00 00 00       	push   $0x99
+  801d40:	68 d2 51 80 00       	push   $0x8051d2
+  801d45:	e8 25 e7 ff ff       	call   80046f <_panic>
+		assert(r <= PGSIZE);
+  801d4a:	68 e4 51 80 00       	push   $0x8051e4
+  801d4f:	68 bd 51 80 00       	push   $0x8051bd
+  801d54:	68 9a 00 00 00       	push   $0x9a
+  801d59:	68 d2 51 80 00       	push   $0x8051d2
+  801d5e:	e8 0c e7 ff ff       	call   80046f <_panic>
+
+00801d63 <open>:
+{
+  801d63:	55                   	push   %ebp
+  801d64:	89 e5                	mov    %esp,%ebp
+  801d66:	56                   	push   %esi
+  801d67:	53                   	push   %ebx
+  801d68:	83 ec 1c             	sub    $0x1c,%esp
+  801d6b:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801d6e:	56                   	push   %esi
+  801d6f:	e8 7f ed ff ff       	call   800af3 <strlen>
+  801d74:	83 c4 10             	add    $0x10,%esp
+  801d77:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801d7c:	0f 8f 85 00 00 00    	jg     801e07 <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  801d82:	83 ec 0c             	sub    $0xc,%esp
+  801d85:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d88:	50                   	push   %eax
+  801d89:	e8 a7 f6 ff ff       	call   801435 <fd_alloc>
+  801d8e:	89 c3                	mov    %eax,%ebx
+  801d90:	83 c4 10             	add    $0x10,%esp
+  801d93:	85 c0                	test   %eax,%eax
+  801d95:	78 55                	js     801dec <open+0x89>
+	mutex_lock(&fsipc_mu);
+  801d97:	83 ec 0c             	sub    $0xc,%esp
+  801d9a:	68 04 70 80 00       	push   $0x807004
+  801d9f:	e8 28 18 00 00       	call   8035cc <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  801da4:	83 c4 08             	add    $0x8,%esp
+  801da7:	56                   	push   %esi
+  801da8:	68 00 80 80 00       	push   $0x808000
+  801dad:	e8 7c ed ff ff       	call   800b2e <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801db2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801db5:	a3 00 84 80 00       	mov    %eax,0x808400
+	r = fsipc(FSREQ_OPEN, fd);
+  801dba:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801dbd:	b8 01 00 00 00       	mov    $0x1,%eax
+  801dc2:	e8 7e fc ff ff       	call   801a45 <fsipc>
+  801dc7:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801dc9:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801dd0:	e8 64 18 00 00       	call   803639 <mutex_unlock>
+	if (r < 0) {
+  801dd5:	83 c4 10             	add    $0x10,%esp
+  801dd8:	85 db                	test   %ebx,%ebx
+  801dda:	78 19                	js     801df5 <open+0x92>
+	return fd2num(fd);
+  801ddc:	83 ec 0c             	sub    $0xc,%esp
+  801ddf:	ff 75 f4             	push   -0xc(%ebp)
+  801de2:	e8 27 f6 ff ff       	call   80140e <fd2num>
+  801de7:	89 c3                	mov    %eax,%ebx
+  801de9:	83 c4 10             	add    $0x10,%esp
+}
+  801dec:	89 d8                	mov    %ebx,%eax
+  801dee:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801df1:	5b                   	pop    %ebx
+  801df2:	5e                   	pop    %esi
+  801df3:	5d                   	pop    %ebp
+  801df4:	c3                   	ret
+		fd_close(fd, 0);
+  801df5:	83 ec 08             	sub    $0x8,%esp
+  801df8:	6a 00                	push   $0x0
+  801dfa:	ff 75 f4             	push   -0xc(%ebp)
+  801dfd:	e8 56 f7 ff ff       	call   801558 <fd_close>
+		return r;
+  801e02:	83 c4 10             	add    $0x10,%esp
+  801e05:	eb e5                	jmp    801dec <open+0x89>
+		return -E_BAD_PATH;
+  801e07:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801e0c:	eb de                	jmp    801dec <open+0x89>
+
+00801e0e <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  801e0e:	55                   	push   %ebp
+  801e0f:	89 e5                	mov    %esp,%ebp
+  801e11:	53                   	push   %ebx
+  801e12:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801e15:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e18:	50                   	push   %eax
+  801e19:	ff 75 08             	push   0x8(%ebp)
+  801e1c:	e8 6a f6 ff ff       	call   80148b <fd_lookup>
+  801e21:	89 c3                	mov    %eax,%ebx
+  801e23:	83 c4 10             	add    $0x10,%esp
+  801e26:	85 c0                	test   %eax,%eax
+  801e28:	78 5b                	js     801e85 <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801e2a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e2d:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  801e33:	39 08                	cmp    %ecx,(%eax)
+  801e35:	75 55                	jne    801e8c <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  801e37:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  801e3b:	74 56                	je     801e93 <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  801e3d:	83 ec 0c             	sub    $0xc,%esp
+  801e40:	68 04 70 80 00       	push   $0x807004
+  801e45:	e8 82 17 00 00       	call   8035cc <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  801e4a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e4d:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e50:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.allocate.req_offset = offset;
+  801e55:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e58:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.allocate.req_len = len;
+  801e5d:	8b 45 10             	mov    0x10(%ebp),%eax
+  801e60:	a3 08 80 80 00       	mov    %eax,0x808008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  801e65:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e6a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801e6f:	e8 d1 fb ff ff       	call   801a45 <fsipc>
+  801e74:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801e76:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  801e7d:	e8 b7 17 00 00       	call   803639 <mutex_unlock>
+	return r;
+  801e82:	83 c4 10             	add    $0x10,%esp
+}
+  801e85:	89 d8                	mov    %ebx,%eax
+  801e87:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e8a:	c9                   	leave
+  801e8b:	c3                   	ret
+		return -E_NOT_SUPP;
+  801e8c:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801e91:	eb f2                	jmp    801e85 <fallocate+0x77>
+		return -E_INVAL;
+  801e93:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801e98:	eb eb                	jmp    801e85 <fallocate+0x77>
+
+00801e9a <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  801e9a:	55                   	push   %ebp
+  801e9b:	89 e5                	mov    %esp,%ebp
+  801e9d:	56                   	push   %esi
+  801e9e:	53                   	push   %ebx
+  801e9f:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801ea2:	89 f3                	mov    %esi,%ebx
+  801ea4:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801eaa:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801ead:	eb 06                	jmp    801eb5 <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801eaf:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801eb5:	39 f3                	cmp    %esi,%ebx
+  801eb7:	73 14                	jae    801ecd <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  801eb9:	83 ec 08             	sub    $0x8,%esp
+  801ebc:	53                   	push   %ebx
+  801ebd:	6a 00                	push   $0x0
+  801ebf:	e8 41 f1 ff ff       	call   801005 <sys_page_unmap>
+  801ec4:	83 c4 10             	add    $0x10,%esp
+  801ec7:	85 c0                	test   %eax,%eax
+  801ec9:	79 e4                	jns    801eaf <munmap+0x15>
+  801ecb:	eb 05                	jmp    801ed2 <munmap+0x38>
+			return r;
+	return 0;
+  801ecd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ed2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ed5:	5b                   	pop    %ebx
+  801ed6:	5e                   	pop    %esi
+  801ed7:	5d                   	pop    %ebp
+  801ed8:	c3                   	ret
+
+00801ed9 <mmap>:
+{
+  801ed9:	55                   	push   %ebp
+  801eda:	89 e5                	mov    %esp,%ebp
+  801edc:	57                   	push   %edi
+  801edd:	56                   	push   %esi
+  801ede:	53                   	push   %ebx
+  801edf:	83 ec 24             	sub    $0x24,%esp
+  801ee2:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801ee5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ee8:	50                   	push   %eax
+  801ee9:	ff 75 08             	push   0x8(%ebp)
+  801eec:	e8 9a f5 ff ff       	call   80148b <fd_lookup>
+  801ef1:	83 c4 10             	add    $0x10,%esp
+  801ef4:	85 c0                	test   %eax,%eax
+  801ef6:	0f 88 37 01 00 00    	js     802033 <mmap+0x15a>
+		return NULL;
+  801efc:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801f01:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801f04:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  801f0a:	39 0a                	cmp    %ecx,(%edx)
+  801f0c:	0f 85 05 01 00 00    	jne    802017 <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  801f12:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801f19:	0f 85 1b 01 00 00    	jne    80203a <mmap+0x161>
+  801f1f:	89 f0                	mov    %esi,%eax
+  801f21:	83 e8 01             	sub    $0x1,%eax
+  801f24:	0f 88 17 01 00 00    	js     802041 <mmap+0x168>
+	if (prot & PROT_WRITE)
+  801f2a:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  801f2e:	75 28                	jne    801f58 <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  801f30:	83 ec 0c             	sub    $0xc,%esp
+  801f33:	68 04 70 80 00       	push   $0x807004
+  801f38:	e8 8f 16 00 00       	call   8035cc <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801f3d:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  801f43:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  801f49:	83 c4 10             	add    $0x10,%esp
+  801f4c:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  801f51:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  801f56:	eb 2b                	jmp    801f83 <mmap+0xaa>
+		cow_enable();
+  801f58:	e8 2e 23 00 00       	call   80428b <cow_enable>
+  801f5d:	eb d1                	jmp    801f30 <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  801f5f:	89 c2                	mov    %eax,%edx
+  801f61:	c1 ea 0c             	shr    $0xc,%edx
+  801f64:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  801f6b:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801f71:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  801f77:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  801f7a:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  801f7c:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  801f81:	77 25                	ja     801fa8 <mmap+0xcf>
+  801f83:	89 c2                	mov    %eax,%edx
+  801f85:	29 da                	sub    %ebx,%edx
+  801f87:	39 ca                	cmp    %ecx,%edx
+  801f89:	73 3a                	jae    801fc5 <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  801f8b:	89 c2                	mov    %eax,%edx
+  801f8d:	c1 ea 16             	shr    $0x16,%edx
+  801f90:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801f97:	f6 c2 01             	test   $0x1,%dl
+  801f9a:	75 c3                	jne    801f5f <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  801f9c:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  801fa1:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  801fa6:	eb d4                	jmp    801f7c <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  801fa8:	29 d8                	sub    %ebx,%eax
+  801faa:	39 c8                	cmp    %ecx,%eax
+  801fac:	73 17                	jae    801fc5 <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  801fae:	83 ec 0c             	sub    $0xc,%esp
+  801fb1:	68 04 70 80 00       	push   $0x807004
+  801fb6:	e8 7e 16 00 00       	call   803639 <mutex_unlock>
+		return NULL;
+  801fbb:	83 c4 10             	add    $0x10,%esp
+  801fbe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fc3:	eb 52                	jmp    802017 <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801fc5:	85 db                	test   %ebx,%ebx
+  801fc7:	74 e5                	je     801fae <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801fc9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801fcc:	8b 40 0c             	mov    0xc(%eax),%eax
+  801fcf:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.map.req_offset = offset;
+  801fd4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fd7:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.map.req_len = len;
+  801fdc:	89 35 08 80 80 00    	mov    %esi,0x808008
+	fsipcbuf.map.req_va = va;
+  801fe2:	89 1d 0c 80 80 00    	mov    %ebx,0x80800c
+	fsipcbuf.map.req_prot = prot;
+  801fe8:	8b 45 14             	mov    0x14(%ebp),%eax
+  801feb:	a3 10 80 80 00       	mov    %eax,0x808010
+	r = fsipc(FSREQ_MAP, NULL);
+  801ff0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ff5:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801ffa:	e8 46 fa ff ff       	call   801a45 <fsipc>
+  801fff:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  802001:	83 ec 0c             	sub    $0xc,%esp
+  802004:	68 04 70 80 00       	push   $0x807004
+  802009:	e8 2b 16 00 00       	call   803639 <mutex_unlock>
+	if (r < 0) {
+  80200e:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  802011:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  802013:	85 ff                	test   %edi,%edi
+  802015:	78 08                	js     80201f <mmap+0x146>
+}
+  802017:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80201a:	5b                   	pop    %ebx
+  80201b:	5e                   	pop    %esi
+  80201c:	5f                   	pop    %edi
+  80201d:	5d                   	pop    %ebp
+  80201e:	c3                   	ret
+		munmap((void*) va, len);
+  80201f:	83 ec 08             	sub    $0x8,%esp
+  802022:	56                   	push   %esi
+  802023:	53                   	push   %ebx
+  802024:	e8 71 fe ff ff       	call   801e9a <munmap>
+		return NULL;
+  802029:	83 c4 10             	add    $0x10,%esp
+  80202c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802031:	eb e4                	jmp    802017 <mmap+0x13e>
+		return NULL;
+  802033:	b8 00 00 00 00       	mov    $0x0,%eax
+  802038:	eb dd                	jmp    802017 <mmap+0x13e>
+		return NULL;
+  80203a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80203f:	eb d6                	jmp    802017 <mmap+0x13e>
+  802041:	b8 00 00 00 00       	mov    $0x0,%eax
+  802046:	eb cf                	jmp    802017 <mmap+0x13e>
+
+00802048 <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  802048:	55                   	push   %ebp
+  802049:	89 e5                	mov    %esp,%ebp
+  80204b:	53                   	push   %ebx
+  80204c:	83 ec 10             	sub    $0x10,%esp
+  80204f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802052:	53                   	push   %ebx
+  802053:	e8 9b ea ff ff       	call   800af3 <strlen>
+  802058:	83 c4 10             	add    $0x10,%esp
+  80205b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802060:	7f 42                	jg     8020a4 <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  802062:	83 ec 0c             	sub    $0xc,%esp
+  802065:	68 04 70 80 00       	push   $0x807004
+  80206a:	e8 5d 15 00 00       	call   8035cc <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  80206f:	83 c4 08             	add    $0x8,%esp
+  802072:	53                   	push   %ebx
+  802073:	68 00 80 80 00       	push   $0x808000
+  802078:	e8 b1 ea ff ff       	call   800b2e <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  80207d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802082:	b8 07 00 00 00       	mov    $0x7,%eax
+  802087:	e8 b9 f9 ff ff       	call   801a45 <fsipc>
+  80208c:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80208e:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  802095:	e8 9f 15 00 00       	call   803639 <mutex_unlock>
+	return r;
+  80209a:	83 c4 10             	add    $0x10,%esp
+}
+  80209d:	89 d8                	mov    %ebx,%eax
+  80209f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020a2:	c9                   	leave
+  8020a3:	c3                   	ret
+		return -E_BAD_PATH;
+  8020a4:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8020a9:	eb f2                	jmp    80209d <remove+0x55>
+
+008020ab <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8020ab:	55                   	push   %ebp
+  8020ac:	89 e5                	mov    %esp,%ebp
+  8020ae:	53                   	push   %ebx
+  8020af:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  8020b2:	68 04 70 80 00       	push   $0x807004
+  8020b7:	e8 10 15 00 00       	call   8035cc <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  8020bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020c1:	b8 08 00 00 00       	mov    $0x8,%eax
+  8020c6:	e8 7a f9 ff ff       	call   801a45 <fsipc>
+  8020cb:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8020cd:	c7 04 24 04 70 80 00 	movl   $0x807004,(%esp)
+  8020d4:	e8 60 15 00 00       	call   803639 <mutex_unlock>
+	return r;
+}
+  8020d9:	89 d8                	mov    %ebx,%eax
+  8020db:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020de:	c9                   	leave
+  8020df:	c3                   	ret
+
+008020e0 <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  8020e0:	55                   	push   %ebp
+  8020e1:	89 e5                	mov    %esp,%ebp
+  8020e3:	56                   	push   %esi
+  8020e4:	53                   	push   %ebx
+  8020e5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  8020e8:	83 ec 0c             	sub    $0xc,%esp
+  8020eb:	68 04 70 80 00       	push   $0x807004
+  8020f0:	e8 d7 14 00 00       	call   8035cc <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  8020f5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020f8:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  8020fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  802102:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802107:	e8 39 f9 ff ff       	call   801a45 <fsipc>
+  80210c:	89 c6                	mov    %eax,%esi
+  80210e:	83 c4 10             	add    $0x10,%esp
+  802111:	85 db                	test   %ebx,%ebx
+  802113:	74 7b                	je     802190 <fs_bcstat+0xb0>
+  802115:	85 c0                	test   %eax,%eax
+  802117:	78 77                	js     802190 <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  802119:	a1 00 80 80 00       	mov    0x808000,%eax
+  80211e:	89 03                	mov    %eax,(%ebx)
+  802120:	a1 04 80 80 00       	mov    0x808004,%eax
+  802125:	89 43 04             	mov    %eax,0x4(%ebx)
+  802128:	a1 08 80 80 00       	mov    0x808008,%eax
+  80212d:	89 43 08             	mov    %eax,0x8(%ebx)
+  802130:	a1 0c 80 80 00       	mov    0x80800c,%eax
+  802135:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802138:	a1 10 80 80 00       	mov    0x808010,%eax
+  80213d:	89 43 10             	mov    %eax,0x10(%ebx)
+  802140:	a1 14 80 80 00       	mov    0x808014,%eax
+  802145:	89 43 14             	mov    %eax,0x14(%ebx)
+  802148:	a1 18 80 80 00       	mov    0x808018,%eax
+  80214d:	89 43 18             	mov    %eax,0x18(%ebx)
+  802150:	a1 1c 80 80 00       	mov    0x80801c,%eax
+  802155:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  802158:	a1 20 80 80 00       	mov    0x808020,%eax
+  80215d:	89 43 20             	mov    %eax,0x20(%ebx)
+  802160:	a1 24 80 80 00       	mov    0x808024,%eax
+  802165:	89 43 24             	mov    %eax,0x24(%ebx)
+  802168:	a1 28 80 80 00       	mov    0x808028,%eax
+  80216d:	89 43 28             	mov    %eax,0x28(%ebx)
+  802170:	a1 2c 80 80 00       	mov    0x80802c,%eax
+  802175:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  802178:	a1 30 80 80 00       	mov    0x808030,%eax
+  80217d:	89 43 30             	mov    %eax,0x30(%ebx)
+  802180:	a1 34 80 80 00       	mov    0x808034,%eax
+  802185:	89 43 34             	mov    %eax,0x34(%ebx)
+  802188:	a1 38 80 80 00       	mov    0x808038,%eax
+  80218d:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  802190:	83 ec 0c             	sub    $0xc,%esp
+  802193:	68 04 70 80 00       	push   $0x807004
+  802198:	e8 9c 14 00 00       	call   803639 <mutex_unlock>
+	return r;
+}
+  80219d:	89 f0                	mov    %esi,%eax
+  80219f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021a2:	5b                   	pop    %ebx
+  8021a3:	5e                   	pop    %esi
+  8021a4:	5d                   	pop    %ebp
+  8021a5:	c3                   	ret
+
+008021a6 <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  8021a6:	55                   	push   %ebp
+  8021a7:	89 e5                	mov    %esp,%ebp
+  8021a9:	56                   	push   %esi
+  8021aa:	53                   	push   %ebx
+  8021ab:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  8021ad:	0f b6 10             	movzbl (%eax),%edx
+  8021b0:	80 fa 72             	cmp    $0x72,%dl
+  8021b3:	74 44                	je     8021f9 <parse_mode+0x53>
+  8021b5:	80 fa 77             	cmp    $0x77,%dl
+  8021b8:	74 4b                	je     802205 <parse_mode+0x5f>
+  8021ba:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8021bf:	80 fa 61             	cmp    $0x61,%dl
+  8021c2:	74 09                	je     8021cd <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  8021c4:	89 d8                	mov    %ebx,%eax
+  8021c6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021c9:	5b                   	pop    %ebx
+  8021ca:	5e                   	pop    %esi
+  8021cb:	5d                   	pop    %ebp
+  8021cc:	c3                   	ret
+	switch (mode[0]) {
+  8021cd:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  8021d2:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  8021d7:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  8021d9:	83 ec 08             	sub    $0x8,%esp
+  8021dc:	6a 2b                	push   $0x2b
+  8021de:	50                   	push   %eax
+  8021df:	e8 5c ea ff ff       	call   800c40 <strchr>
+  8021e4:	83 c4 10             	add    $0x10,%esp
+  8021e7:	85 c0                	test   %eax,%eax
+  8021e9:	74 d9                	je     8021c4 <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  8021eb:	83 e3 fc             	and    $0xfffffffc,%ebx
+  8021ee:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  8021f1:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  8021f7:	eb cb                	jmp    8021c4 <parse_mode+0x1e>
+	switch (mode[0]) {
+  8021f9:	ba 01 00 00 00       	mov    $0x1,%edx
+  8021fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802203:	eb d2                	jmp    8021d7 <parse_mode+0x31>
+  802205:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  80220a:	bb 01 03 00 00       	mov    $0x301,%ebx
+  80220f:	eb c6                	jmp    8021d7 <parse_mode+0x31>
+
+00802211 <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  802211:	55                   	push   %ebp
+  802212:	89 e5                	mov    %esp,%ebp
+  802214:	57                   	push   %edi
+  802215:	56                   	push   %esi
+  802216:	53                   	push   %ebx
+  802217:	83 ec 1c             	sub    $0x1c,%esp
+  80221a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80221d:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  802220:	b8 24 60 80 00       	mov    $0x806024,%eax
+  802225:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  80222a:	83 c0 24             	add    $0x24,%eax
+  80222d:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  802231:	74 17                	je     80224a <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  802233:	83 c3 01             	add    $0x1,%ebx
+  802236:	83 fb 10             	cmp    $0x10,%ebx
+  802239:	75 ef                	jne    80222a <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  80223b:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  802240:	89 f0                	mov    %esi,%eax
+  802242:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802245:	5b                   	pop    %ebx
+  802246:	5e                   	pop    %esi
+  802247:	5f                   	pop    %edi
+  802248:	5d                   	pop    %ebp
+  802249:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  80224a:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  802251:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802254:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  802257:	c1 e7 02             	shl    $0x2,%edi
+  80225a:	8d b7 20 60 80 00    	lea    0x806020(%edi),%esi
+  802260:	83 ec 04             	sub    $0x4,%esp
+  802263:	6a 24                	push   $0x24
+  802265:	6a 00                	push   $0x0
+  802267:	56                   	push   %esi
+  802268:	e8 12 ea ff ff       	call   800c7f <memset>
+			streams[i].f_fd = fd;
+  80226d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802270:	89 8f 20 60 80 00    	mov    %ecx,0x806020(%edi)
+			streams[i].f_flags = flags;
+  802276:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802279:	01 d8                	add    %ebx,%eax
+  80227b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80227e:	89 0c 85 24 60 80 00 	mov    %ecx,0x806024(,%eax,4)
+			return &streams[i];
+  802285:	83 c4 10             	add    $0x10,%esp
+  802288:	eb b6                	jmp    802240 <stream_alloc+0x2f>
+
+0080228a <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  80228a:	55                   	push   %ebp
+  80228b:	89 e5                	mov    %esp,%ebp
+  80228d:	53                   	push   %ebx
+  80228e:	83 ec 14             	sub    $0x14,%esp
+  802291:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  802293:	8b 40 18             	mov    0x18(%eax),%eax
+  802296:	39 43 14             	cmp    %eax,0x14(%ebx)
+  802299:	74 4a                	je     8022e5 <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  80229b:	83 ec 08             	sub    $0x8,%esp
+  80229e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022a1:	50                   	push   %eax
+  8022a2:	ff 33                	push   (%ebx)
+  8022a4:	e8 e2 f1 ff ff       	call   80148b <fd_lookup>
+  8022a9:	89 c2                	mov    %eax,%edx
+  8022ab:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8022ae:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  8022b3:	85 d2                	test   %edx,%edx
+  8022b5:	78 41                	js     8022f8 <stream_unread+0x6e>
+  8022b7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8022ba:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  8022c0:	39 0a                	cmp    %ecx,(%edx)
+  8022c2:	75 34                	jne    8022f8 <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  8022c4:	8b 43 14             	mov    0x14(%ebx),%eax
+  8022c7:	03 42 04             	add    0x4(%edx),%eax
+  8022ca:	2b 43 18             	sub    0x18(%ebx),%eax
+  8022cd:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  8022d0:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  8022d7:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  8022de:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022e3:	eb 13                	jmp    8022f8 <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  8022e5:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  8022ec:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  8022f3:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8022f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022fb:	c9                   	leave
+  8022fc:	c3                   	ret
+
+008022fd <stream_drain>:
+{
+  8022fd:	55                   	push   %ebp
+  8022fe:	89 e5                	mov    %esp,%ebp
+  802300:	56                   	push   %esi
+  802301:	53                   	push   %ebx
+  802302:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  802304:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802309:	eb 02                	jmp    80230d <stream_drain+0x10>
+  80230b:	01 c3                	add    %eax,%ebx
+  80230d:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802310:	39 c3                	cmp    %eax,%ebx
+  802312:	73 43                	jae    802357 <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  802314:	83 ec 04             	sub    $0x4,%esp
+  802317:	29 d8                	sub    %ebx,%eax
+  802319:	50                   	push   %eax
+  80231a:	89 d8                	mov    %ebx,%eax
+  80231c:	03 46 0c             	add    0xc(%esi),%eax
+  80231f:	50                   	push   %eax
+  802320:	ff 36                	push   (%esi)
+  802322:	e8 ec f4 ff ff       	call   801813 <write>
+  802327:	83 c4 10             	add    $0x10,%esp
+  80232a:	85 c0                	test   %eax,%eax
+  80232c:	7f dd                	jg     80230b <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  80232e:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  802332:	8b 56 0c             	mov    0xc(%esi),%edx
+  802335:	83 ec 04             	sub    $0x4,%esp
+  802338:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80233b:	29 d8                	sub    %ebx,%eax
+  80233d:	50                   	push   %eax
+  80233e:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  802341:	50                   	push   %eax
+  802342:	52                   	push   %edx
+  802343:	e8 6c e9 ff ff       	call   800cb4 <memmove>
+			f->f_wend -= done;
+  802348:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80234b:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  80234d:	83 c4 10             	add    $0x10,%esp
+  802350:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  802355:	eb 0a                	jmp    802361 <stream_drain+0x64>
+  802357:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  80235c:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  802361:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  802364:	89 d0                	mov    %edx,%eax
+  802366:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802369:	5b                   	pop    %ebx
+  80236a:	5e                   	pop    %esi
+  80236b:	5d                   	pop    %ebp
+  80236c:	c3                   	ret
+
+0080236d <stream_setup>:
+	if (f->f_buf)
+  80236d:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802371:	74 01                	je     802374 <stream_setup+0x7>
+  802373:	c3                   	ret
+{
+  802374:	55                   	push   %ebp
+  802375:	89 e5                	mov    %esp,%ebp
+  802377:	53                   	push   %ebx
+  802378:	83 ec 04             	sub    $0x4,%esp
+  80237b:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  80237d:	8b 40 08             	mov    0x8(%eax),%eax
+  802380:	85 c0                	test   %eax,%eax
+  802382:	74 17                	je     80239b <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  802384:	83 f8 03             	cmp    $0x3,%eax
+  802387:	75 2d                	jne    8023b6 <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  802389:	8d 43 20             	lea    0x20(%ebx),%eax
+  80238c:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  80238f:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  802396:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802399:	c9                   	leave
+  80239a:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  80239b:	83 ec 0c             	sub    $0xc,%esp
+  80239e:	ff 33                	push   (%ebx)
+  8023a0:	e8 63 1c 00 00       	call   804008 <iscons>
+  8023a5:	83 c4 10             	add    $0x10,%esp
+  8023a8:	85 c0                	test   %eax,%eax
+  8023aa:	0f 9f c0             	setg   %al
+  8023ad:	0f b6 c0             	movzbl %al,%eax
+  8023b0:	83 c0 01             	add    $0x1,%eax
+  8023b3:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  8023b6:	83 ec 0c             	sub    $0xc,%esp
+  8023b9:	68 00 10 00 00       	push   $0x1000
+  8023be:	e8 6e 0b 00 00       	call   802f31 <malloc>
+  8023c3:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8023c6:	83 c4 10             	add    $0x10,%esp
+  8023c9:	85 c0                	test   %eax,%eax
+  8023cb:	74 bc                	je     802389 <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  8023cd:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  8023d4:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  8023d8:	eb bc                	jmp    802396 <stream_setup+0x29>
+
+008023da <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  8023da:	55                   	push   %ebp
+  8023db:	89 e5                	mov    %esp,%ebp
+  8023dd:	53                   	push   %ebx
+  8023de:	83 ec 04             	sub    $0x4,%esp
+  8023e1:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  8023e3:	e8 85 ff ff ff       	call   80236d <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  8023e8:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  8023ed:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  8023f1:	74 3d                	je     802430 <stream_fill+0x56>
+  8023f3:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  8023f7:	74 10                	je     802409 <stream_fill+0x2f>
+  8023f9:	89 d8                	mov    %ebx,%eax
+  8023fb:	e8 fd fe ff ff       	call   8022fd <stream_drain>
+		return 0;
+  802400:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  802405:	85 c0                	test   %eax,%eax
+  802407:	78 27                	js     802430 <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  802409:	83 ec 04             	sub    $0x4,%esp
+  80240c:	ff 73 10             	push   0x10(%ebx)
+  80240f:	ff 73 0c             	push   0xc(%ebx)
+  802412:	ff 33                	push   (%ebx)
+  802414:	e8 02 f3 ff ff       	call   80171b <read>
+  802419:	83 c4 10             	add    $0x10,%esp
+  80241c:	85 c0                	test   %eax,%eax
+  80241e:	7e 17                	jle    802437 <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  802420:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  802424:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  80242b:	89 c2                	mov    %eax,%edx
+  80242d:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  802430:	89 d0                	mov    %edx,%eax
+  802432:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802435:	c9                   	leave
+  802436:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  802437:	c1 f8 1f             	sar    $0x1f,%eax
+  80243a:	83 e0 04             	and    $0x4,%eax
+  80243d:	83 c0 04             	add    $0x4,%eax
+  802440:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  802443:	ba 00 00 00 00       	mov    $0x0,%edx
+  802448:	eb e6                	jmp    802430 <stream_fill+0x56>
+
+0080244a <fopen>:
+{
+  80244a:	55                   	push   %ebp
+  80244b:	89 e5                	mov    %esp,%ebp
+  80244d:	57                   	push   %edi
+  80244e:	56                   	push   %esi
+  80244f:	53                   	push   %ebx
+  802450:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  802456:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  802459:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  80245f:	89 f0                	mov    %esi,%eax
+  802461:	e8 40 fd ff ff       	call   8021a6 <parse_mode>
+		return 0;
+  802466:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  80246b:	85 c0                	test   %eax,%eax
+  80246d:	78 2d                	js     80249c <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  80246f:	83 ec 08             	sub    $0x8,%esp
+  802472:	50                   	push   %eax
+  802473:	ff 75 08             	push   0x8(%ebp)
+  802476:	e8 e8 f8 ff ff       	call   801d63 <open>
+  80247b:	89 c7                	mov    %eax,%edi
+  80247d:	83 c4 10             	add    $0x10,%esp
+  802480:	85 c0                	test   %eax,%eax
+  802482:	78 58                	js     8024dc <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  802484:	80 3e 61             	cmpb   $0x61,(%esi)
+  802487:	74 1d                	je     8024a6 <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  802489:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  80248f:	89 f8                	mov    %edi,%eax
+  802491:	e8 7b fd ff ff       	call   802211 <stream_alloc>
+  802496:	89 c3                	mov    %eax,%ebx
+  802498:	85 c0                	test   %eax,%eax
+  80249a:	74 32                	je     8024ce <fopen+0x84>
+}
+  80249c:	89 d8                	mov    %ebx,%eax
+  80249e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024a1:	5b                   	pop    %ebx
+  8024a2:	5e                   	pop    %esi
+  8024a3:	5f                   	pop    %edi
+  8024a4:	5d                   	pop    %ebp
+  8024a5:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  8024a6:	83 ec 08             	sub    $0x8,%esp
+  8024a9:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  8024af:	50                   	push   %eax
+  8024b0:	57                   	push   %edi
+  8024b1:	e8 db f4 ff ff       	call   801991 <fstat>
+  8024b6:	83 c4 10             	add    $0x10,%esp
+  8024b9:	85 c0                	test   %eax,%eax
+  8024bb:	78 cc                	js     802489 <fopen+0x3f>
+		seek(fd, st.st_size);
+  8024bd:	83 ec 08             	sub    $0x8,%esp
+  8024c0:	ff 75 dc             	push   -0x24(%ebp)
+  8024c3:	57                   	push   %edi
+  8024c4:	e8 f6 f3 ff ff       	call   8018bf <seek>
+  8024c9:	83 c4 10             	add    $0x10,%esp
+  8024cc:	eb bb                	jmp    802489 <fopen+0x3f>
+		close(fd);
+  8024ce:	83 ec 0c             	sub    $0xc,%esp
+  8024d1:	57                   	push   %edi
+  8024d2:	e8 08 f1 ff ff       	call   8015df <close>
+  8024d7:	83 c4 10             	add    $0x10,%esp
+  8024da:	eb c0                	jmp    80249c <fopen+0x52>
+		return 0;
+  8024dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024e1:	eb b9                	jmp    80249c <fopen+0x52>
+
+008024e3 <fdopen>:
+{
+  8024e3:	55                   	push   %ebp
+  8024e4:	89 e5                	mov    %esp,%ebp
+  8024e6:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  8024e9:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8024ec:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024ef:	e8 b2 fc ff ff       	call   8021a6 <parse_mode>
+  8024f4:	89 c2                	mov    %eax,%edx
+		return 0;
+  8024f6:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  8024fb:	85 d2                	test   %edx,%edx
+  8024fd:	78 0b                	js     80250a <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  8024ff:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802502:	8b 45 08             	mov    0x8(%ebp),%eax
+  802505:	e8 07 fd ff ff       	call   802211 <stream_alloc>
+}
+  80250a:	c9                   	leave
+  80250b:	c3                   	ret
+
+0080250c <setvbuf>:
+{
+  80250c:	55                   	push   %ebp
+  80250d:	89 e5                	mov    %esp,%ebp
+  80250f:	57                   	push   %edi
+  802510:	56                   	push   %esi
+  802511:	53                   	push   %ebx
+  802512:	8b 45 08             	mov    0x8(%ebp),%eax
+  802515:	8b 55 10             	mov    0x10(%ebp),%edx
+  802518:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  80251b:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  80251f:	75 3a                	jne    80255b <setvbuf+0x4f>
+  802521:	8d 72 ff             	lea    -0x1(%edx),%esi
+  802524:	83 fe 02             	cmp    $0x2,%esi
+  802527:	77 39                	ja     802562 <setvbuf+0x56>
+	f->f_bufmode = mode;
+  802529:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  80252c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802530:	0f 95 c3             	setne  %bl
+  802533:	85 ff                	test   %edi,%edi
+  802535:	0f 95 c1             	setne  %cl
+  802538:	84 cb                	test   %cl,%bl
+  80253a:	74 05                	je     802541 <setvbuf+0x35>
+  80253c:	83 fa 03             	cmp    $0x3,%edx
+  80253f:	75 0a                	jne    80254b <setvbuf+0x3f>
+	return 0;
+  802541:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802546:	5b                   	pop    %ebx
+  802547:	5e                   	pop    %esi
+  802548:	5f                   	pop    %edi
+  802549:	5d                   	pop    %ebp
+  80254a:	c3                   	ret
+		f->f_buf = buf;
+  80254b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80254e:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  802551:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  802554:	b8 00 00 00 00       	mov    $0x0,%eax
+  802559:	eb eb                	jmp    802546 <setvbuf+0x3a>
+		return EOF;
+  80255b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802560:	eb e4                	jmp    802546 <setvbuf+0x3a>
+  802562:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802567:	eb dd                	jmp    802546 <setvbuf+0x3a>
+
+00802569 <fflush>:
+{
+  802569:	55                   	push   %ebp
+  80256a:	89 e5                	mov    %esp,%ebp
+  80256c:	57                   	push   %edi
+  80256d:	56                   	push   %esi
+  80256e:	53                   	push   %ebx
+  80256f:	83 ec 0c             	sub    $0xc,%esp
+  802572:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  802575:	85 db                	test   %ebx,%ebx
+  802577:	74 1a                	je     802593 <fflush+0x2a>
+	stream_unread(f);
+  802579:	89 d8                	mov    %ebx,%eax
+  80257b:	e8 0a fd ff ff       	call   80228a <stream_unread>
+	return stream_drain(f);
+  802580:	89 d8                	mov    %ebx,%eax
+  802582:	e8 76 fd ff ff       	call   8022fd <stream_drain>
+  802587:	89 c7                	mov    %eax,%edi
+}
+  802589:	89 f8                	mov    %edi,%eax
+  80258b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80258e:	5b                   	pop    %ebx
+  80258f:	5e                   	pop    %esi
+  802590:	5f                   	pop    %edi
+  802591:	5d                   	pop    %ebp
+  802592:	c3                   	ret
+  802593:	bb 20 60 80 00       	mov    $0x806020,%ebx
+  802598:	be 60 62 80 00       	mov    $0x806260,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  80259d:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025a2:	eb 03                	jmp    8025a7 <fflush+0x3e>
+  8025a4:	83 c3 24             	add    $0x24,%ebx
+  8025a7:	39 f3                	cmp    %esi,%ebx
+  8025a9:	74 de                	je     802589 <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  8025ab:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  8025af:	74 f3                	je     8025a4 <fflush+0x3b>
+  8025b1:	83 ec 0c             	sub    $0xc,%esp
+  8025b4:	53                   	push   %ebx
+  8025b5:	e8 af ff ff ff       	call   802569 <fflush>
+  8025ba:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  8025bd:	85 c0                	test   %eax,%eax
+  8025bf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8025c4:	0f 48 f8             	cmovs  %eax,%edi
+  8025c7:	eb db                	jmp    8025a4 <fflush+0x3b>
+
+008025c9 <fclose>:
+{
+  8025c9:	55                   	push   %ebp
+  8025ca:	89 e5                	mov    %esp,%ebp
+  8025cc:	56                   	push   %esi
+  8025cd:	53                   	push   %ebx
+  8025ce:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  8025d1:	83 ec 0c             	sub    $0xc,%esp
+  8025d4:	56                   	push   %esi
+  8025d5:	e8 8f ff ff ff       	call   802569 <fflush>
+  8025da:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  8025dc:	83 c4 04             	add    $0x4,%esp
+  8025df:	ff 36                	push   (%esi)
+  8025e1:	e8 f9 ef ff ff       	call   8015df <close>
+  8025e6:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  8025e9:	85 c0                	test   %eax,%eax
+  8025eb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8025f0:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  8025f3:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  8025f7:	75 10                	jne    802609 <fclose+0x40>
+	f->f_flags = 0;
+  8025f9:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  802600:	89 d8                	mov    %ebx,%eax
+  802602:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802605:	5b                   	pop    %ebx
+  802606:	5e                   	pop    %esi
+  802607:	5d                   	pop    %ebp
+  802608:	c3                   	ret
+		free(f->f_buf);
+  802609:	83 ec 0c             	sub    $0xc,%esp
+  80260c:	ff 76 0c             	push   0xc(%esi)
+  80260f:	e8 54 08 00 00       	call   802e68 <free>
+  802614:	83 c4 10             	add    $0x10,%esp
+  802617:	eb e0                	jmp    8025f9 <fclose+0x30>
+
+00802619 <fileno>:
+{
+  802619:	55                   	push   %ebp
+  80261a:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  80261c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80261f:	8b 00                	mov    (%eax),%eax
+}
+  802621:	5d                   	pop    %ebp
+  802622:	c3                   	ret
+
+00802623 <feof>:
+{
+  802623:	55                   	push   %ebp
+  802624:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  802626:	8b 45 08             	mov    0x8(%ebp),%eax
+  802629:	8b 40 04             	mov    0x4(%eax),%eax
+  80262c:	c1 e8 02             	shr    $0x2,%eax
+  80262f:	83 e0 01             	and    $0x1,%eax
+}
+  802632:	5d                   	pop    %ebp
+  802633:	c3                   	ret
+
+00802634 <ferror>:
+{
+  802634:	55                   	push   %ebp
+  802635:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  802637:	8b 45 08             	mov    0x8(%ebp),%eax
+  80263a:	8b 40 04             	mov    0x4(%eax),%eax
+  80263d:	c1 e8 03             	shr    $0x3,%eax
+  802640:	83 e0 01             	and    $0x1,%eax
+}
+  802643:	5d                   	pop    %ebp
+  802644:	c3                   	ret
+
+00802645 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  802645:	55                   	push   %ebp
+  802646:	89 e5                	mov    %esp,%ebp
+  802648:	53                   	push   %ebx
+  802649:	83 ec 04             	sub    $0x4,%esp
+  80264c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  80264f:	8b 43 18             	mov    0x18(%ebx),%eax
+  802652:	39 43 14             	cmp    %eax,0x14(%ebx)
+  802655:	74 15                	je     80266c <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  802657:	8b 53 0c             	mov    0xc(%ebx),%edx
+  80265a:	8b 43 14             	mov    0x14(%ebx),%eax
+  80265d:	8d 48 01             	lea    0x1(%eax),%ecx
+  802660:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  802663:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  802667:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80266a:	c9                   	leave
+  80266b:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  80266c:	89 d8                	mov    %ebx,%eax
+  80266e:	e8 67 fd ff ff       	call   8023da <stream_fill>
+  802673:	85 c0                	test   %eax,%eax
+  802675:	75 e0                	jne    802657 <fgetc+0x12>
+		return EOF;
+  802677:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80267c:	eb e9                	jmp    802667 <fgetc+0x22>
+
+0080267e <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  80267e:	55                   	push   %ebp
+  80267f:	89 e5                	mov    %esp,%ebp
+  802681:	57                   	push   %edi
+  802682:	56                   	push   %esi
+  802683:	53                   	push   %ebx
+  802684:	83 ec 1c             	sub    $0x1c,%esp
+  802687:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  80268a:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  80268f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802692:	83 e8 01             	sub    $0x1,%eax
+  802695:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  802698:	eb 66                	jmp    802700 <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  80269a:	8b 46 14             	mov    0x14(%esi),%eax
+  80269d:	8b 5e 18             	mov    0x18(%esi),%ebx
+  8026a0:	29 c3                	sub    %eax,%ebx
+  8026a2:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8026a5:	29 fa                	sub    %edi,%edx
+  8026a7:	39 d3                	cmp    %edx,%ebx
+  8026a9:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  8026ac:	83 ec 04             	sub    $0x4,%esp
+  8026af:	53                   	push   %ebx
+  8026b0:	6a 0a                	push   $0xa
+  8026b2:	03 46 0c             	add    0xc(%esi),%eax
+  8026b5:	50                   	push   %eax
+  8026b6:	e8 aa e6 ff ff       	call   800d65 <memfind>
+  8026bb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  8026be:	8b 46 0c             	mov    0xc(%esi),%eax
+  8026c1:	8b 4e 14             	mov    0x14(%esi),%ecx
+  8026c4:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  8026c7:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  8026c9:	83 c4 10             	add    $0x10,%esp
+  8026cc:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  8026cf:	74 0b                	je     8026dc <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  8026d1:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8026d4:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8026d7:	29 d3                	sub    %edx,%ebx
+  8026d9:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  8026dc:	83 ec 04             	sub    $0x4,%esp
+  8026df:	53                   	push   %ebx
+  8026e0:	01 c8                	add    %ecx,%eax
+  8026e2:	50                   	push   %eax
+  8026e3:	89 f8                	mov    %edi,%eax
+  8026e5:	03 45 08             	add    0x8(%ebp),%eax
+  8026e8:	50                   	push   %eax
+  8026e9:	e8 c6 e5 ff ff       	call   800cb4 <memmove>
+		f->f_rpos += m;
+  8026ee:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  8026f1:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  8026f3:	83 c4 10             	add    $0x10,%esp
+  8026f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026f9:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  8026fe:	74 1f                	je     80271f <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  802700:	8d 47 01             	lea    0x1(%edi),%eax
+  802703:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  802706:	73 17                	jae    80271f <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802708:	8b 46 18             	mov    0x18(%esi),%eax
+  80270b:	39 46 14             	cmp    %eax,0x14(%esi)
+  80270e:	75 8a                	jne    80269a <fgets+0x1c>
+  802710:	89 f0                	mov    %esi,%eax
+  802712:	e8 c3 fc ff ff       	call   8023da <stream_fill>
+  802717:	85 c0                	test   %eax,%eax
+  802719:	0f 85 7b ff ff ff    	jne    80269a <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  80271f:	85 ff                	test   %edi,%edi
+  802721:	74 0f                	je     802732 <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  802723:	8b 45 08             	mov    0x8(%ebp),%eax
+  802726:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  80272a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80272d:	5b                   	pop    %ebx
+  80272e:	5e                   	pop    %esi
+  80272f:	5f                   	pop    %edi
+  802730:	5d                   	pop    %ebp
+  802731:	c3                   	ret
+		return 0;
+  802732:	b8 00 00 00 00       	mov    $0x0,%eax
+  802737:	eb f1                	jmp    80272a <fgets+0xac>
+
+00802739 <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  802739:	55                   	push   %ebp
+  80273a:	89 e5                	mov    %esp,%ebp
+  80273c:	57                   	push   %edi
+  80273d:	56                   	push   %esi
+  80273e:	53                   	push   %ebx
+  80273f:	83 ec 1c             	sub    $0x1c,%esp
+  802742:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  802745:	89 f0                	mov    %esi,%eax
+  802747:	e8 21 fc ff ff       	call   80236d <stream_setup>
+	want = size * n;
+  80274c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80274f:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802753:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  802756:	bf 00 00 00 00       	mov    $0x0,%edi
+  80275b:	eb 43                	jmp    8027a0 <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  80275d:	29 d3                	sub    %edx,%ebx
+  80275f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802762:	29 f8                	sub    %edi,%eax
+  802764:	39 c3                	cmp    %eax,%ebx
+  802766:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  802769:	83 ec 04             	sub    $0x4,%esp
+  80276c:	53                   	push   %ebx
+  80276d:	03 56 0c             	add    0xc(%esi),%edx
+  802770:	52                   	push   %edx
+  802771:	89 f8                	mov    %edi,%eax
+  802773:	03 45 08             	add    0x8(%ebp),%eax
+  802776:	50                   	push   %eax
+  802777:	e8 38 e5 ff ff       	call   800cb4 <memmove>
+			f->f_rpos += m;
+  80277c:	01 5e 14             	add    %ebx,0x14(%esi)
+  80277f:	83 c4 10             	add    $0x10,%esp
+  802782:	eb 1a                	jmp    80279e <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  802784:	83 ec 04             	sub    $0x4,%esp
+  802787:	53                   	push   %ebx
+  802788:	89 f8                	mov    %edi,%eax
+  80278a:	03 45 08             	add    0x8(%ebp),%eax
+  80278d:	50                   	push   %eax
+  80278e:	ff 36                	push   (%esi)
+  802790:	e8 86 ef ff ff       	call   80171b <read>
+  802795:	89 c3                	mov    %eax,%ebx
+  802797:	83 c4 10             	add    $0x10,%esp
+  80279a:	85 c0                	test   %eax,%eax
+  80279c:	7e 36                	jle    8027d4 <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  80279e:	01 df                	add    %ebx,%edi
+  8027a0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8027a3:	39 c7                	cmp    %eax,%edi
+  8027a5:	73 39                	jae    8027e0 <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  8027a7:	8b 56 14             	mov    0x14(%esi),%edx
+  8027aa:	8b 5e 18             	mov    0x18(%esi),%ebx
+  8027ad:	39 da                	cmp    %ebx,%edx
+  8027af:	72 ac                	jb     80275d <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  8027b1:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8027b4:	29 fb                	sub    %edi,%ebx
+  8027b6:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  8027b9:	72 3e                	jb     8027f9 <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  8027bb:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  8027bf:	74 1f                	je     8027e0 <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  8027c1:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  8027c5:	74 bd                	je     802784 <fread+0x4b>
+  8027c7:	89 f0                	mov    %esi,%eax
+  8027c9:	e8 2f fb ff ff       	call   8022fd <stream_drain>
+  8027ce:	85 c0                	test   %eax,%eax
+  8027d0:	79 b2                	jns    802784 <fread+0x4b>
+  8027d2:	eb 0c                	jmp    8027e0 <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  8027d4:	c1 fb 1f             	sar    $0x1f,%ebx
+  8027d7:	83 e3 04             	and    $0x4,%ebx
+  8027da:	83 c3 04             	add    $0x4,%ebx
+  8027dd:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  8027e0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8027e3:	85 c0                	test   %eax,%eax
+  8027e5:	74 0a                	je     8027f1 <fread+0xb8>
+  8027e7:	89 f8                	mov    %edi,%eax
+  8027e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027ee:	f7 75 0c             	divl   0xc(%ebp)
+}
+  8027f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027f4:	5b                   	pop    %ebx
+  8027f5:	5e                   	pop    %esi
+  8027f6:	5f                   	pop    %edi
+  8027f7:	5d                   	pop    %ebp
+  8027f8:	c3                   	ret
+		} else if (!stream_fill(f))
+  8027f9:	89 f0                	mov    %esi,%eax
+  8027fb:	e8 da fb ff ff       	call   8023da <stream_fill>
+  802800:	85 c0                	test   %eax,%eax
+  802802:	74 dc                	je     8027e0 <fread+0xa7>
+			m = 0;
+  802804:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802809:	eb 93                	jmp    80279e <fread+0x65>
+
+0080280b <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  80280b:	55                   	push   %ebp
+  80280c:	89 e5                	mov    %esp,%ebp
+  80280e:	57                   	push   %edi
+  80280f:	56                   	push   %esi
+  802810:	53                   	push   %ebx
+  802811:	83 ec 1c             	sub    $0x1c,%esp
+  802814:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  802817:	8b 43 04             	mov    0x4(%ebx),%eax
+  80281a:	a8 02                	test   $0x2,%al
+  80281c:	75 13                	jne    802831 <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  80281e:	83 c8 08             	or     $0x8,%eax
+  802821:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  802824:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  802829:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80282c:	5b                   	pop    %ebx
+  80282d:	5e                   	pop    %esi
+  80282e:	5f                   	pop    %edi
+  80282f:	5d                   	pop    %ebp
+  802830:	c3                   	ret
+	stream_setup(f);
+  802831:	89 d8                	mov    %ebx,%eax
+  802833:	e8 35 fb ff ff       	call   80236d <stream_setup>
+	want = size * n;
+  802838:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80283b:	0f af 45 10          	imul   0x10(%ebp),%eax
+  80283f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  802842:	89 d8                	mov    %ebx,%eax
+  802844:	e8 41 fa ff ff       	call   80228a <stream_unread>
+	for (done = 0; done < want; ) {
+  802849:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  80284e:	84 c0                	test   %al,%al
+  802850:	75 7b                	jne    8028cd <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  802852:	be 00 00 00 00       	mov    $0x0,%esi
+  802857:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80285a:	39 fe                	cmp    %edi,%esi
+  80285c:	73 24                	jae    802882 <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  80285e:	83 ec 04             	sub    $0x4,%esp
+  802861:	89 f8                	mov    %edi,%eax
+  802863:	29 f0                	sub    %esi,%eax
+  802865:	50                   	push   %eax
+  802866:	89 f0                	mov    %esi,%eax
+  802868:	03 45 08             	add    0x8(%ebp),%eax
+  80286b:	50                   	push   %eax
+  80286c:	ff 33                	push   (%ebx)
+  80286e:	e8 a0 ef ff ff       	call   801813 <write>
+  802873:	83 c4 10             	add    $0x10,%esp
+  802876:	85 c0                	test   %eax,%eax
+  802878:	7e 04                	jle    80287e <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  80287a:	01 c6                	add    %eax,%esi
+  80287c:	eb dc                	jmp    80285a <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  80287e:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  802882:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802885:	85 c0                	test   %eax,%eax
+  802887:	74 a0                	je     802829 <fwrite+0x1e>
+  802889:	89 f0                	mov    %esi,%eax
+  80288b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802890:	f7 75 0c             	divl   0xc(%ebp)
+  802893:	eb 94                	jmp    802829 <fwrite+0x1e>
+			done += r;
+  802895:	01 c7                	add    %eax,%edi
+			continue;
+  802897:	eb 34                	jmp    8028cd <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  802899:	8b 73 10             	mov    0x10(%ebx),%esi
+  80289c:	29 c6                	sub    %eax,%esi
+  80289e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8028a1:	29 fa                	sub    %edi,%edx
+  8028a3:	39 d6                	cmp    %edx,%esi
+  8028a5:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  8028a8:	83 ec 04             	sub    $0x4,%esp
+  8028ab:	56                   	push   %esi
+  8028ac:	89 fa                	mov    %edi,%edx
+  8028ae:	03 55 08             	add    0x8(%ebp),%edx
+  8028b1:	52                   	push   %edx
+  8028b2:	03 43 0c             	add    0xc(%ebx),%eax
+  8028b5:	50                   	push   %eax
+  8028b6:	e8 f9 e3 ff ff       	call   800cb4 <memmove>
+		f->f_wend += m;
+  8028bb:	89 f0                	mov    %esi,%eax
+  8028bd:	03 43 1c             	add    0x1c(%ebx),%eax
+  8028c0:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  8028c3:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  8028c5:	83 c4 10             	add    $0x10,%esp
+  8028c8:	3b 43 10             	cmp    0x10(%ebx),%eax
+  8028cb:	74 5b                	je     802928 <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  8028cd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8028d0:	39 c7                	cmp    %eax,%edi
+  8028d2:	73 2d                	jae    802901 <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  8028d4:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8028d7:	85 c0                	test   %eax,%eax
+  8028d9:	75 be                	jne    802899 <fwrite+0x8e>
+  8028db:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8028de:	29 fa                	sub    %edi,%edx
+  8028e0:	3b 53 10             	cmp    0x10(%ebx),%edx
+  8028e3:	72 b4                	jb     802899 <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  8028e5:	83 ec 04             	sub    $0x4,%esp
+  8028e8:	52                   	push   %edx
+  8028e9:	89 f8                	mov    %edi,%eax
+  8028eb:	03 45 08             	add    0x8(%ebp),%eax
+  8028ee:	50                   	push   %eax
+  8028ef:	ff 33                	push   (%ebx)
+  8028f1:	e8 1d ef ff ff       	call   801813 <write>
+  8028f6:	83 c4 10             	add    $0x10,%esp
+  8028f9:	85 c0                	test   %eax,%eax
+  8028fb:	7f 98                	jg     802895 <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  8028fd:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  802901:	8b 43 08             	mov    0x8(%ebx),%eax
+  802904:	83 f8 03             	cmp    $0x3,%eax
+  802907:	74 48                	je     802951 <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802909:	83 f8 02             	cmp    $0x2,%eax
+  80290c:	74 27                	je     802935 <fwrite+0x12a>
+	return size ? done / size : 0;
+  80290e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802911:	85 c0                	test   %eax,%eax
+  802913:	0f 84 10 ff ff ff    	je     802829 <fwrite+0x1e>
+  802919:	89 f8                	mov    %edi,%eax
+  80291b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802920:	f7 75 0c             	divl   0xc(%ebp)
+  802923:	e9 01 ff ff ff       	jmp    802829 <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  802928:	89 d8                	mov    %ebx,%eax
+  80292a:	e8 ce f9 ff ff       	call   8022fd <stream_drain>
+  80292f:	85 c0                	test   %eax,%eax
+  802931:	79 9a                	jns    8028cd <fwrite+0xc2>
+  802933:	eb cc                	jmp    802901 <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802935:	83 ec 04             	sub    $0x4,%esp
+  802938:	57                   	push   %edi
+  802939:	6a 0a                	push   $0xa
+  80293b:	ff 75 08             	push   0x8(%ebp)
+  80293e:	e8 22 e4 ff ff       	call   800d65 <memfind>
+  802943:	89 c2                	mov    %eax,%edx
+  802945:	89 f8                	mov    %edi,%eax
+  802947:	03 45 08             	add    0x8(%ebp),%eax
+  80294a:	83 c4 10             	add    $0x10,%esp
+  80294d:	39 c2                	cmp    %eax,%edx
+  80294f:	74 bd                	je     80290e <fwrite+0x103>
+		stream_drain(f);
+  802951:	89 d8                	mov    %ebx,%eax
+  802953:	e8 a5 f9 ff ff       	call   8022fd <stream_drain>
+  802958:	eb b4                	jmp    80290e <fwrite+0x103>
+
+0080295a <fputc>:
+{
+  80295a:	55                   	push   %ebp
+  80295b:	89 e5                	mov    %esp,%ebp
+  80295d:	53                   	push   %ebx
+  80295e:	83 ec 14             	sub    $0x14,%esp
+  802961:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  802964:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  802967:	ff 75 0c             	push   0xc(%ebp)
+  80296a:	6a 01                	push   $0x1
+  80296c:	6a 01                	push   $0x1
+  80296e:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802971:	50                   	push   %eax
+  802972:	e8 94 fe ff ff       	call   80280b <fwrite>
+  802977:	83 c4 10             	add    $0x10,%esp
+  80297a:	0f b6 db             	movzbl %bl,%ebx
+  80297d:	83 f8 01             	cmp    $0x1,%eax
+  802980:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802985:	0f 44 c3             	cmove  %ebx,%eax
+}
+  802988:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80298b:	c9                   	leave
+  80298c:	c3                   	ret
+
+0080298d <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  80298d:	55                   	push   %ebp
+  80298e:	89 e5                	mov    %esp,%ebp
+  802990:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  802993:	ff 75 0c             	push   0xc(%ebp)
+  802996:	ff 75 08             	push   0x8(%ebp)
+  802999:	e8 bc ff ff ff       	call   80295a <fputc>
+}
+  80299e:	83 c4 10             	add    $0x10,%esp
+  8029a1:	c9                   	leave
+  8029a2:	c3                   	ret
+
+008029a3 <fputs>:
+{
+  8029a3:	55                   	push   %ebp
+  8029a4:	89 e5                	mov    %esp,%ebp
+  8029a6:	56                   	push   %esi
+  8029a7:	53                   	push   %ebx
+  8029a8:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  8029ab:	83 ec 0c             	sub    $0xc,%esp
+  8029ae:	56                   	push   %esi
+  8029af:	e8 3f e1 ff ff       	call   800af3 <strlen>
+  8029b4:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  8029b6:	ff 75 0c             	push   0xc(%ebp)
+  8029b9:	50                   	push   %eax
+  8029ba:	6a 01                	push   $0x1
+  8029bc:	56                   	push   %esi
+  8029bd:	e8 49 fe ff ff       	call   80280b <fwrite>
+  8029c2:	83 c4 20             	add    $0x20,%esp
+  8029c5:	39 d8                	cmp    %ebx,%eax
+  8029c7:	0f 95 c0             	setne  %al
+  8029ca:	0f b6 c0             	movzbl %al,%eax
+  8029cd:	f7 d8                	neg    %eax
+}
+  8029cf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8029d2:	5b                   	pop    %ebx
+  8029d3:	5e                   	pop    %esi
+  8029d4:	5d                   	pop    %ebp
+  8029d5:	c3                   	ret
+
+008029d6 <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  8029d6:	55                   	push   %ebp
+  8029d7:	89 e5                	mov    %esp,%ebp
+  8029d9:	53                   	push   %ebx
+  8029da:	83 ec 04             	sub    $0x4,%esp
+  8029dd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8029e0:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  8029e3:	50                   	push   %eax
+  8029e4:	ff 75 0c             	push   0xc(%ebp)
+  8029e7:	53                   	push   %ebx
+  8029e8:	68 8d 29 80 00       	push   $0x80298d
+  8029ed:	e8 4f dc ff ff       	call   800641 <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  8029f2:	8b 43 04             	mov    0x4(%ebx),%eax
+  8029f5:	c1 e0 1c             	shl    $0x1c,%eax
+  8029f8:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  8029fb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029fe:	c9                   	leave
+  8029ff:	c3                   	ret
+
+00802a00 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802a00:	55                   	push   %ebp
+  802a01:	89 e5                	mov    %esp,%ebp
+  802a03:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802a06:	68 f8 51 80 00       	push   $0x8051f8
+  802a0b:	ff 75 0c             	push   0xc(%ebp)
+  802a0e:	e8 1b e1 ff ff       	call   800b2e <strcpy>
+	return 0;
+}
+  802a13:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a18:	c9                   	leave
+  802a19:	c3                   	ret
+
+00802a1a <devsock_close>:
+{
+  802a1a:	55                   	push   %ebp
+  802a1b:	89 e5                	mov    %esp,%ebp
+  802a1d:	53                   	push   %ebx
+  802a1e:	83 ec 10             	sub    $0x10,%esp
+  802a21:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802a24:	53                   	push   %ebx
+  802a25:	e8 5d 1e 00 00       	call   804887 <pageref>
+  802a2a:	89 c2                	mov    %eax,%edx
+  802a2c:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802a2f:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802a34:	83 fa 01             	cmp    $0x1,%edx
+  802a37:	74 05                	je     802a3e <devsock_close+0x24>
+}
+  802a39:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a3c:	c9                   	leave
+  802a3d:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802a3e:	83 ec 0c             	sub    $0xc,%esp
+  802a41:	ff 73 0c             	push   0xc(%ebx)
+  802a44:	e8 b7 02 00 00       	call   802d00 <nsipc_close>
+  802a49:	83 c4 10             	add    $0x10,%esp
+  802a4c:	eb eb                	jmp    802a39 <devsock_close+0x1f>
+
+00802a4e <devsock_write>:
+{
+  802a4e:	55                   	push   %ebp
+  802a4f:	89 e5                	mov    %esp,%ebp
+  802a51:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802a54:	6a 00                	push   $0x0
+  802a56:	ff 75 10             	push   0x10(%ebp)
+  802a59:	ff 75 0c             	push   0xc(%ebp)
+  802a5c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a5f:	ff 70 0c             	push   0xc(%eax)
+  802a62:	e8 79 03 00 00       	call   802de0 <nsipc_send>
+}
+  802a67:	c9                   	leave
+  802a68:	c3                   	ret
+
+00802a69 <devsock_read>:
+{
+  802a69:	55                   	push   %ebp
+  802a6a:	89 e5                	mov    %esp,%ebp
+  802a6c:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802a6f:	6a 00                	push   $0x0
+  802a71:	ff 75 10             	push   0x10(%ebp)
+  802a74:	ff 75 0c             	push   0xc(%ebp)
+  802a77:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a7a:	ff 70 0c             	push   0xc(%eax)
+  802a7d:	e8 ef 02 00 00       	call   802d71 <nsipc_recv>
+}
+  802a82:	c9                   	leave
+  802a83:	c3                   	ret
+
+00802a84 <fd2sockid>:
+{
+  802a84:	55                   	push   %ebp
+  802a85:	89 e5                	mov    %esp,%ebp
+  802a87:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802a8a:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802a8d:	52                   	push   %edx
+  802a8e:	50                   	push   %eax
+  802a8f:	e8 f7 e9 ff ff       	call   80148b <fd_lookup>
+  802a94:	83 c4 10             	add    $0x10,%esp
+  802a97:	85 c0                	test   %eax,%eax
+  802a99:	78 10                	js     802aab <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802a9b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a9e:	8b 0d 60 62 80 00    	mov    0x806260,%ecx
+  802aa4:	39 08                	cmp    %ecx,(%eax)
+  802aa6:	75 05                	jne    802aad <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802aa8:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802aab:	c9                   	leave
+  802aac:	c3                   	ret
+		return -E_NOT_SUPP;
+  802aad:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802ab2:	eb f7                	jmp    802aab <fd2sockid+0x27>
+
+00802ab4 <alloc_sockfd>:
+{
+  802ab4:	55                   	push   %ebp
+  802ab5:	89 e5                	mov    %esp,%ebp
+  802ab7:	56                   	push   %esi
+  802ab8:	53                   	push   %ebx
+  802ab9:	83 ec 1c             	sub    $0x1c,%esp
+  802abc:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802abe:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ac1:	50                   	push   %eax
+  802ac2:	e8 6e e9 ff ff       	call   801435 <fd_alloc>
+  802ac7:	89 c3                	mov    %eax,%ebx
+  802ac9:	83 c4 10             	add    $0x10,%esp
+  802acc:	85 c0                	test   %eax,%eax
+  802ace:	78 43                	js     802b13 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802ad0:	83 ec 04             	sub    $0x4,%esp
+  802ad3:	68 07 04 00 00       	push   $0x407
+  802ad8:	ff 75 f4             	push   -0xc(%ebp)
+  802adb:	6a 00                	push   $0x0
+  802add:	e8 8a e4 ff ff       	call   800f6c <sys_page_alloc>
+  802ae2:	89 c3                	mov    %eax,%ebx
+  802ae4:	83 c4 10             	add    $0x10,%esp
+  802ae7:	85 c0                	test   %eax,%eax
+  802ae9:	78 28                	js     802b13 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802aeb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802aee:	8b 15 60 62 80 00    	mov    0x806260,%edx
+  802af4:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802af6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802af9:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802b00:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802b03:	83 ec 0c             	sub    $0xc,%esp
+  802b06:	50                   	push   %eax
+  802b07:	e8 02 e9 ff ff       	call   80140e <fd2num>
+  802b0c:	89 c3                	mov    %eax,%ebx
+  802b0e:	83 c4 10             	add    $0x10,%esp
+  802b11:	eb 0c                	jmp    802b1f <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802b13:	83 ec 0c             	sub    $0xc,%esp
+  802b16:	56                   	push   %esi
+  802b17:	e8 e4 01 00 00       	call   802d00 <nsipc_close>
+		return r;
+  802b1c:	83 c4 10             	add    $0x10,%esp
+}
+  802b1f:	89 d8                	mov    %ebx,%eax
+  802b21:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b24:	5b                   	pop    %ebx
+  802b25:	5e                   	pop    %esi
+  802b26:	5d                   	pop    %ebp
+  802b27:	c3                   	ret
+
+00802b28 <accept>:
+{
+  802b28:	55                   	push   %ebp
+  802b29:	89 e5                	mov    %esp,%ebp
+  802b2b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802b2e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b31:	e8 4e ff ff ff       	call   802a84 <fd2sockid>
+  802b36:	85 c0                	test   %eax,%eax
+  802b38:	78 1b                	js     802b55 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802b3a:	83 ec 04             	sub    $0x4,%esp
+  802b3d:	ff 75 10             	push   0x10(%ebp)
+  802b40:	ff 75 0c             	push   0xc(%ebp)
+  802b43:	50                   	push   %eax
+  802b44:	e8 0e 01 00 00       	call   802c57 <nsipc_accept>
+  802b49:	83 c4 10             	add    $0x10,%esp
+  802b4c:	85 c0                	test   %eax,%eax
+  802b4e:	78 05                	js     802b55 <accept+0x2d>
+	return alloc_sockfd(r);
+  802b50:	e8 5f ff ff ff       	call   802ab4 <alloc_sockfd>
+}
+  802b55:	c9                   	leave
+  802b56:	c3                   	ret
+
+00802b57 <bind>:
+{
+  802b57:	55                   	push   %ebp
+  802b58:	89 e5                	mov    %esp,%ebp
+  802b5a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802b5d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b60:	e8 1f ff ff ff       	call   802a84 <fd2sockid>
+  802b65:	85 c0                	test   %eax,%eax
+  802b67:	78 12                	js     802b7b <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802b69:	83 ec 04             	sub    $0x4,%esp
+  802b6c:	ff 75 10             	push   0x10(%ebp)
+  802b6f:	ff 75 0c             	push   0xc(%ebp)
+  802b72:	50                   	push   %eax
+  802b73:	e8 31 01 00 00       	call   802ca9 <nsipc_bind>
+  802b78:	83 c4 10             	add    $0x10,%esp
+}
+  802b7b:	c9                   	leave
+  802b7c:	c3                   	ret
+
+00802b7d <shutdown>:
+{
+  802b7d:	55                   	push   %ebp
+  802b7e:	89 e5                	mov    %esp,%ebp
+  802b80:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802b83:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b86:	e8 f9 fe ff ff       	call   802a84 <fd2sockid>
+  802b8b:	85 c0                	test   %eax,%eax
+  802b8d:	78 0f                	js     802b9e <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802b8f:	83 ec 08             	sub    $0x8,%esp
+  802b92:	ff 75 0c             	push   0xc(%ebp)
+  802b95:	50                   	push   %eax
+  802b96:	e8 43 01 00 00       	call   802cde <nsipc_shutdown>
+  802b9b:	83 c4 10             	add    $0x10,%esp
+}
+  802b9e:	c9                   	leave
+  802b9f:	c3                   	ret
+
+00802ba0 <connect>:
+{
+  802ba0:	55                   	push   %ebp
+  802ba1:	89 e5                	mov    %esp,%ebp
+  802ba3:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802ba6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ba9:	e8 d6 fe ff ff       	call   802a84 <fd2sockid>
+  802bae:	85 c0                	test   %eax,%eax
+  802bb0:	78 12                	js     802bc4 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802bb2:	83 ec 04             	sub    $0x4,%esp
+  802bb5:	ff 75 10             	push   0x10(%ebp)
+  802bb8:	ff 75 0c             	push   0xc(%ebp)
+  802bbb:	50                   	push   %eax
+  802bbc:	e8 59 01 00 00       	call   802d1a <nsipc_connect>
+  802bc1:	83 c4 10             	add    $0x10,%esp
+}
+  802bc4:	c9                   	leave
+  802bc5:	c3                   	ret
+
+00802bc6 <listen>:
+{
+  802bc6:	55                   	push   %ebp
+  802bc7:	89 e5                	mov    %esp,%ebp
+  802bc9:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802bcc:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bcf:	e8 b0 fe ff ff       	call   802a84 <fd2sockid>
+  802bd4:	85 c0                	test   %eax,%eax
+  802bd6:	78 0f                	js     802be7 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802bd8:	83 ec 08             	sub    $0x8,%esp
+  802bdb:	ff 75 0c             	push   0xc(%ebp)
+  802bde:	50                   	push   %eax
+  802bdf:	e8 6b 01 00 00       	call   802d4f <nsipc_listen>
+  802be4:	83 c4 10             	add    $0x10,%esp
+}
+  802be7:	c9                   	leave
+  802be8:	c3                   	ret
+
+00802be9 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802be9:	55                   	push   %ebp
+  802bea:	89 e5                	mov    %esp,%ebp
+  802bec:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802bef:	ff 75 10             	push   0x10(%ebp)
+  802bf2:	ff 75 0c             	push   0xc(%ebp)
+  802bf5:	ff 75 08             	push   0x8(%ebp)
+  802bf8:	e8 41 02 00 00       	call   802e3e <nsipc_socket>
+  802bfd:	83 c4 10             	add    $0x10,%esp
+  802c00:	85 c0                	test   %eax,%eax
+  802c02:	78 05                	js     802c09 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802c04:	e8 ab fe ff ff       	call   802ab4 <alloc_sockfd>
+}
+  802c09:	c9                   	leave
+  802c0a:	c3                   	ret
+
+00802c0b <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802c0b:	55                   	push   %ebp
+  802c0c:	89 e5                	mov    %esp,%ebp
+  802c0e:	53                   	push   %ebx
+  802c0f:	83 ec 04             	sub    $0x4,%esp
+  802c12:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802c14:	83 3d 08 70 80 00 00 	cmpl   $0x0,0x807008
+  802c1b:	74 26                	je     802c43 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802c1d:	6a 07                	push   $0x7
+  802c1f:	68 00 90 80 00       	push   $0x809000
+  802c24:	53                   	push   %ebx
+  802c25:	ff 35 08 70 80 00    	push   0x807008
+  802c2b:	e8 c2 1b 00 00       	call   8047f2 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802c30:	83 c4 0c             	add    $0xc,%esp
+  802c33:	6a 00                	push   $0x0
+  802c35:	6a 00                	push   $0x0
+  802c37:	6a 00                	push   $0x0
+  802c39:	e8 be 1a 00 00       	call   8046fc <ipc_recv>
+}
+  802c3e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c41:	c9                   	leave
+  802c42:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802c43:	83 ec 0c             	sub    $0xc,%esp
+  802c46:	6a 02                	push   $0x2
+  802c48:	e8 fb 1b 00 00       	call   804848 <ipc_find_env>
+  802c4d:	a3 08 70 80 00       	mov    %eax,0x807008
+  802c52:	83 c4 10             	add    $0x10,%esp
+  802c55:	eb c6                	jmp    802c1d <nsipc+0x12>
+
+00802c57 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802c57:	55                   	push   %ebp
+  802c58:	89 e5                	mov    %esp,%ebp
+  802c5a:	56                   	push   %esi
+  802c5b:	53                   	push   %ebx
+  802c5c:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802c5f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c62:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802c67:	8b 06                	mov    (%esi),%eax
+  802c69:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802c6e:	b8 01 00 00 00       	mov    $0x1,%eax
+  802c73:	e8 93 ff ff ff       	call   802c0b <nsipc>
+  802c78:	89 c3                	mov    %eax,%ebx
+  802c7a:	85 c0                	test   %eax,%eax
+  802c7c:	79 09                	jns    802c87 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802c7e:	89 d8                	mov    %ebx,%eax
+  802c80:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c83:	5b                   	pop    %ebx
+  802c84:	5e                   	pop    %esi
+  802c85:	5d                   	pop    %ebp
+  802c86:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802c87:	83 ec 04             	sub    $0x4,%esp
+  802c8a:	ff 35 10 90 80 00    	push   0x809010
+  802c90:	68 00 90 80 00       	push   $0x809000
+  802c95:	ff 75 0c             	push   0xc(%ebp)
+  802c98:	e8 17 e0 ff ff       	call   800cb4 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802c9d:	a1 10 90 80 00       	mov    0x809010,%eax
+  802ca2:	89 06                	mov    %eax,(%esi)
+  802ca4:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802ca7:	eb d5                	jmp    802c7e <nsipc_accept+0x27>
+
+00802ca9 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802ca9:	55                   	push   %ebp
+  802caa:	89 e5                	mov    %esp,%ebp
+  802cac:	53                   	push   %ebx
+  802cad:	83 ec 08             	sub    $0x8,%esp
+  802cb0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802cb3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cb6:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802cbb:	53                   	push   %ebx
+  802cbc:	ff 75 0c             	push   0xc(%ebp)
+  802cbf:	68 04 90 80 00       	push   $0x809004
+  802cc4:	e8 eb df ff ff       	call   800cb4 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802cc9:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  802ccf:	b8 02 00 00 00       	mov    $0x2,%eax
+  802cd4:	e8 32 ff ff ff       	call   802c0b <nsipc>
+}
+  802cd9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802cdc:	c9                   	leave
+  802cdd:	c3                   	ret
+
+00802cde <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802cde:	55                   	push   %ebp
+  802cdf:	89 e5                	mov    %esp,%ebp
+  802ce1:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802ce4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ce7:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  802cec:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802cef:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  802cf4:	b8 03 00 00 00       	mov    $0x3,%eax
+  802cf9:	e8 0d ff ff ff       	call   802c0b <nsipc>
+}
+  802cfe:	c9                   	leave
+  802cff:	c3                   	ret
+
+00802d00 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802d00:	55                   	push   %ebp
+  802d01:	89 e5                	mov    %esp,%ebp
+  802d03:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802d06:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d09:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  802d0e:	b8 04 00 00 00       	mov    $0x4,%eax
+  802d13:	e8 f3 fe ff ff       	call   802c0b <nsipc>
+}
+  802d18:	c9                   	leave
+  802d19:	c3                   	ret
+
+00802d1a <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802d1a:	55                   	push   %ebp
+  802d1b:	89 e5                	mov    %esp,%ebp
+  802d1d:	53                   	push   %ebx
+  802d1e:	83 ec 08             	sub    $0x8,%esp
+  802d21:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802d24:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d27:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802d2c:	53                   	push   %ebx
+  802d2d:	ff 75 0c             	push   0xc(%ebp)
+  802d30:	68 04 90 80 00       	push   $0x809004
+  802d35:	e8 7a df ff ff       	call   800cb4 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802d3a:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  802d40:	b8 05 00 00 00       	mov    $0x5,%eax
+  802d45:	e8 c1 fe ff ff       	call   802c0b <nsipc>
+}
+  802d4a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d4d:	c9                   	leave
+  802d4e:	c3                   	ret
+
+00802d4f <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802d4f:	55                   	push   %ebp
+  802d50:	89 e5                	mov    %esp,%ebp
+  802d52:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802d55:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d58:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  802d5d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d60:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  802d65:	b8 06 00 00 00       	mov    $0x6,%eax
+  802d6a:	e8 9c fe ff ff       	call   802c0b <nsipc>
+}
+  802d6f:	c9                   	leave
+  802d70:	c3                   	ret
+
+00802d71 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802d71:	55                   	push   %ebp
+  802d72:	89 e5                	mov    %esp,%ebp
+  802d74:	56                   	push   %esi
+  802d75:	53                   	push   %ebx
+  802d76:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802d79:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d7c:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  802d81:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  802d87:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d8a:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802d8f:	b8 07 00 00 00       	mov    $0x7,%eax
+  802d94:	e8 72 fe ff ff       	call   802c0b <nsipc>
+  802d99:	89 c3                	mov    %eax,%ebx
+  802d9b:	85 c0                	test   %eax,%eax
+  802d9d:	78 22                	js     802dc1 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802d9f:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802da4:	39 c6                	cmp    %eax,%esi
+  802da6:	0f 4e c6             	cmovle %esi,%eax
+  802da9:	39 c3                	cmp    %eax,%ebx
+  802dab:	7f 1d                	jg     802dca <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802dad:	83 ec 04             	sub    $0x4,%esp
+  802db0:	53                   	push   %ebx
+  802db1:	68 00 90 80 00       	push   $0x809000
+  802db6:	ff 75 0c             	push   0xc(%ebp)
+  802db9:	e8 f6 de ff ff       	call   800cb4 <memmove>
+  802dbe:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802dc1:	89 d8                	mov    %ebx,%eax
+  802dc3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802dc6:	5b                   	pop    %ebx
+  802dc7:	5e                   	pop    %esi
+  802dc8:	5d                   	pop    %ebp
+  802dc9:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802dca:	68 04 52 80 00       	push   $0x805204
+  802dcf:	68 bd 51 80 00       	push   $0x8051bd
+  802dd4:	6a 62                	push   $0x62
+  802dd6:	68 19 52 80 00       	push   $0x805219
+  802ddb:	e8 8f d6 ff ff       	call   80046f <_panic>
+
+00802de0 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802de0:	55                   	push   %ebp
+  802de1:	89 e5                	mov    %esp,%ebp
+  802de3:	53                   	push   %ebx
+  802de4:	83 ec 04             	sub    $0x4,%esp
+  802de7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802dea:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ded:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  802df2:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802df8:	7f 2e                	jg     802e28 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802dfa:	83 ec 04             	sub    $0x4,%esp
+  802dfd:	53                   	push   %ebx
+  802dfe:	ff 75 0c             	push   0xc(%ebp)
+  802e01:	68 0c 90 80 00       	push   $0x80900c
+  802e06:	e8 a9 de ff ff       	call   800cb4 <memmove>
+	nsipcbuf.send.req_size = size;
+  802e0b:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  802e11:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e14:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  802e19:	b8 08 00 00 00       	mov    $0x8,%eax
+  802e1e:	e8 e8 fd ff ff       	call   802c0b <nsipc>
+}
+  802e23:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e26:	c9                   	leave
+  802e27:	c3                   	ret
+	assert(size < 1600);
+  802e28:	68 25 52 80 00       	push   $0x805225
+  802e2d:	68 bd 51 80 00       	push   $0x8051bd
+  802e32:	6a 6d                	push   $0x6d
+  802e34:	68 19 52 80 00       	push   $0x805219
+  802e39:	e8 31 d6 ff ff       	call   80046f <_panic>
+
+00802e3e <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802e3e:	55                   	push   %ebp
+  802e3f:	89 e5                	mov    %esp,%ebp
+  802e41:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802e44:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e47:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  802e4c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e4f:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  802e54:	8b 45 10             	mov    0x10(%ebp),%eax
+  802e57:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  802e5c:	b8 09 00 00 00       	mov    $0x9,%eax
+  802e61:	e8 a5 fd ff ff       	call   802c0b <nsipc>
+}
+  802e66:	c9                   	leave
+  802e67:	c3                   	ret
+
+00802e68 <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  802e68:	55                   	push   %ebp
+  802e69:	89 e5                	mov    %esp,%ebp
+  802e6b:	53                   	push   %ebx
+  802e6c:	83 ec 10             	sub    $0x10,%esp
+  802e6f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  802e72:	68 0c 70 80 00       	push   $0x80700c
+  802e77:	e8 50 07 00 00       	call   8035cc <mutex_lock>
+	if (v == 0)
+  802e7c:	83 c4 10             	add    $0x10,%esp
+  802e7f:	85 db                	test   %ebx,%ebx
+  802e81:	0f 84 85 00 00 00    	je     802f0c <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802e87:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802e8d:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802e92:	77 51                	ja     802ee5 <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  802e94:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  802e9a:	89 d8                	mov    %ebx,%eax
+  802e9c:	c1 e8 0c             	shr    $0xc,%eax
+  802e9f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802ea6:	f6 c4 02             	test   $0x2,%ah
+  802ea9:	74 50                	je     802efb <free+0x93>
+		sys_page_unmap(0, c);
+  802eab:	83 ec 08             	sub    $0x8,%esp
+  802eae:	53                   	push   %ebx
+  802eaf:	6a 00                	push   $0x0
+  802eb1:	e8 4f e1 ff ff       	call   801005 <sys_page_unmap>
+		c += PGSIZE;
+  802eb6:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  802ebc:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802ec2:	83 c4 10             	add    $0x10,%esp
+  802ec5:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802eca:	76 ce                	jbe    802e9a <free+0x32>
+  802ecc:	68 6f 52 80 00       	push   $0x80526f
+  802ed1:	68 bd 51 80 00       	push   $0x8051bd
+  802ed6:	68 82 00 00 00       	push   $0x82
+  802edb:	68 62 52 80 00       	push   $0x805262
+  802ee0:	e8 8a d5 ff ff       	call   80046f <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802ee5:	68 34 52 80 00       	push   $0x805234
+  802eea:	68 bd 51 80 00       	push   $0x8051bd
+  802eef:	6a 7b                	push   $0x7b
+  802ef1:	68 62 52 80 00       	push   $0x805262
+  802ef6:	e8 74 d5 ff ff       	call   80046f <_panic>
+	if (--(*ref) == 0)
+  802efb:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  802f01:	83 e8 01             	sub    $0x1,%eax
+  802f04:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  802f0a:	74 15                	je     802f21 <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  802f0c:	83 ec 0c             	sub    $0xc,%esp
+  802f0f:	68 0c 70 80 00       	push   $0x80700c
+  802f14:	e8 20 07 00 00       	call   803639 <mutex_unlock>
+}
+  802f19:	83 c4 10             	add    $0x10,%esp
+  802f1c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f1f:	c9                   	leave
+  802f20:	c3                   	ret
+		sys_page_unmap(0, c);
+  802f21:	83 ec 08             	sub    $0x8,%esp
+  802f24:	53                   	push   %ebx
+  802f25:	6a 00                	push   $0x0
+  802f27:	e8 d9 e0 ff ff       	call   801005 <sys_page_unmap>
+  802f2c:	83 c4 10             	add    $0x10,%esp
+  802f2f:	eb db                	jmp    802f0c <free+0xa4>
+
+00802f31 <malloc>:
+{
+  802f31:	55                   	push   %ebp
+  802f32:	89 e5                	mov    %esp,%ebp
+  802f34:	57                   	push   %edi
+  802f35:	56                   	push   %esi
+  802f36:	53                   	push   %ebx
+  802f37:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  802f3a:	68 0c 70 80 00       	push   $0x80700c
+  802f3f:	e8 88 06 00 00       	call   8035cc <mutex_lock>
+	if (mptr == 0)
+  802f44:	8b 3d 10 70 80 00    	mov    0x807010,%edi
+  802f4a:	83 c4 10             	add    $0x10,%esp
+  802f4d:	85 ff                	test   %edi,%edi
+  802f4f:	74 6c                	je     802fbd <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  802f51:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f54:	83 c0 03             	add    $0x3,%eax
+  802f57:	83 e0 fc             	and    $0xfffffffc,%eax
+  802f5a:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  802f5c:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  802f61:	0f 87 64 01 00 00    	ja     8030cb <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  802f67:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  802f6d:	74 30                	je     802f9f <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  802f6f:	89 f9                	mov    %edi,%ecx
+  802f71:	c1 e9 0c             	shr    $0xc,%ecx
+  802f74:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  802f78:	c1 e8 0c             	shr    $0xc,%eax
+  802f7b:	39 c1                	cmp    %eax,%ecx
+  802f7d:	74 5f                	je     802fde <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  802f7f:	83 ec 0c             	sub    $0xc,%esp
+  802f82:	57                   	push   %edi
+  802f83:	e8 e0 fe ff ff       	call   802e68 <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  802f88:	a1 10 70 80 00       	mov    0x807010,%eax
+  802f8d:	05 00 10 00 00       	add    $0x1000,%eax
+  802f92:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802f97:	a3 10 70 80 00       	mov    %eax,0x807010
+  802f9c:	83 c4 10             	add    $0x10,%esp
+  802f9f:	8b 0d 10 70 80 00    	mov    0x807010,%ecx
+{
+  802fa5:	ba 02 00 00 00       	mov    $0x2,%edx
+  802faa:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  802fae:	8d 7e 04             	lea    0x4(%esi),%edi
+  802fb1:	89 cb                	mov    %ecx,%ebx
+  802fb3:	01 f9                	add    %edi,%ecx
+  802fb5:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802fb8:	e9 8b 00 00 00       	jmp    803048 <malloc+0x117>
+		mptr = mbegin;
+  802fbd:	c7 05 10 70 80 00 00 	movl   $0x8000000,0x807010
+  802fc4:	00 00 08 
+	n = ROUNDUP(n, 4);
+  802fc7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fca:	83 c0 03             	add    $0x3,%eax
+  802fcd:	83 e0 fc             	and    $0xfffffffc,%eax
+  802fd0:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  802fd2:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  802fd7:	76 c6                	jbe    802f9f <malloc+0x6e>
+  802fd9:	e9 d6 00 00 00       	jmp    8030b4 <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  802fde:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802fe4:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  802fe9:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  802fed:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  802ff0:	a3 10 70 80 00       	mov    %eax,0x807010
+			return v;
+  802ff5:	e9 ba 00 00 00       	jmp    8030b4 <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  802ffa:	05 00 10 00 00       	add    $0x1000,%eax
+  802fff:	39 c8                	cmp    %ecx,%eax
+  803001:	0f 83 cb 00 00 00    	jae    8030d2 <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  803007:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  80300c:	77 22                	ja     803030 <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  80300e:	89 c2                	mov    %eax,%edx
+  803010:	c1 ea 16             	shr    $0x16,%edx
+  803013:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80301a:	f6 c2 01             	test   $0x1,%dl
+  80301d:	74 db                	je     802ffa <malloc+0xc9>
+  80301f:	89 c2                	mov    %eax,%edx
+  803021:	c1 ea 0c             	shr    $0xc,%edx
+  803024:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80302b:	f6 c2 01             	test   $0x1,%dl
+  80302e:	74 ca                	je     802ffa <malloc+0xc9>
+		if (mptr == mend) {
+  803030:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803036:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  80303c:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  803040:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  803046:	74 04                	je     80304c <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  803048:	89 d8                	mov    %ebx,%eax
+  80304a:	eb b3                	jmp    802fff <malloc+0xce>
+  80304c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  80304f:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  803054:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  803058:	83 ea 01             	sub    $0x1,%edx
+  80305b:	0f 85 50 ff ff ff    	jne    802fb1 <malloc+0x80>
+  803061:	c7 05 10 70 80 00 00 	movl   $0x8000000,0x807010
+  803068:	00 00 08 
+				return 0;	/* out of address space */
+  80306b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803070:	eb 42                	jmp    8030b4 <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  803072:	85 db                	test   %ebx,%ebx
+  803074:	78 1e                	js     803094 <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  803076:	83 ec 08             	sub    $0x8,%esp
+  803079:	89 d8                	mov    %ebx,%eax
+  80307b:	03 05 10 70 80 00    	add    0x807010,%eax
+  803081:	50                   	push   %eax
+  803082:	6a 00                	push   $0x0
+  803084:	e8 7c df ff ff       	call   801005 <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  803089:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  80308f:	83 c4 10             	add    $0x10,%esp
+  803092:	eb de                	jmp    803072 <malloc+0x141>
+			return 0;	/* out of physical memory */
+  803094:	bf 00 00 00 00       	mov    $0x0,%edi
+  803099:	eb 19                	jmp    8030b4 <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  80309b:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80309e:	8b 3d 10 70 80 00    	mov    0x807010,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  8030a4:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  8030ab:	00 
+	mptr += n;
+  8030ac:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  8030af:	a3 10 70 80 00       	mov    %eax,0x807010
+	mutex_unlock(&malloc_mu);
+  8030b4:	83 ec 0c             	sub    $0xc,%esp
+  8030b7:	68 0c 70 80 00       	push   $0x80700c
+  8030bc:	e8 78 05 00 00       	call   803639 <mutex_unlock>
+}
+  8030c1:	89 f8                	mov    %edi,%eax
+  8030c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030c6:	5b                   	pop    %ebx
+  8030c7:	5e                   	pop    %esi
+  8030c8:	5f                   	pop    %edi
+  8030c9:	5d                   	pop    %ebp
+  8030ca:	c3                   	ret
+		return 0;
+  8030cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030d0:	eb e2                	jmp    8030b4 <malloc+0x183>
+  8030d2:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  8030d6:	74 06                	je     8030de <malloc+0x1ad>
+  8030d8:	89 1d 10 70 80 00    	mov    %ebx,0x807010
+	for (i = 0; i < n + 4; i += PGSIZE){
+  8030de:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8030e3:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8030e6:	39 fb                	cmp    %edi,%ebx
+  8030e8:	73 b1                	jae    80309b <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  8030ea:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  8030f0:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  8030f3:	39 fe                	cmp    %edi,%esi
+  8030f5:	0f 92 c0             	setb   %al
+  8030f8:	0f b6 c0             	movzbl %al,%eax
+  8030fb:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  8030fe:	83 c8 07             	or     $0x7,%eax
+  803101:	50                   	push   %eax
+  803102:	89 d8                	mov    %ebx,%eax
+  803104:	03 05 10 70 80 00    	add    0x807010,%eax
+  80310a:	50                   	push   %eax
+  80310b:	6a 00                	push   $0x0
+  80310d:	e8 5a de ff ff       	call   800f6c <sys_page_alloc>
+  803112:	83 c4 10             	add    $0x10,%esp
+  803115:	85 c0                	test   %eax,%eax
+  803117:	0f 88 55 ff ff ff    	js     803072 <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  80311d:	89 f3                	mov    %esi,%ebx
+  80311f:	eb c5                	jmp    8030e6 <malloc+0x1b5>
+
+00803121 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  803121:	55                   	push   %ebp
+  803122:	89 e5                	mov    %esp,%ebp
+  803124:	56                   	push   %esi
+  803125:	53                   	push   %ebx
+  803126:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803129:	83 ec 0c             	sub    $0xc,%esp
+  80312c:	ff 75 08             	push   0x8(%ebp)
+  80312f:	e8 ea e2 ff ff       	call   80141e <fd2data>
+  803134:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  803136:	83 c4 08             	add    $0x8,%esp
+  803139:	68 87 52 80 00       	push   $0x805287
+  80313e:	53                   	push   %ebx
+  80313f:	e8 ea d9 ff ff       	call   800b2e <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  803144:	8b 46 04             	mov    0x4(%esi),%eax
+  803147:	2b 06                	sub    (%esi),%eax
+  803149:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  80314f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803156:	00 00 00 
+	stat->st_dev = &devpipe;
+  803159:	c7 83 88 00 00 00 7c 	movl   $0x80627c,0x88(%ebx)
+  803160:	62 80 00 
+	return 0;
+}
+  803163:	b8 00 00 00 00       	mov    $0x0,%eax
+  803168:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80316b:	5b                   	pop    %ebx
+  80316c:	5e                   	pop    %esi
+  80316d:	5d                   	pop    %ebp
+  80316e:	c3                   	ret
+
+0080316f <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  80316f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803174:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  803178:	85 c9                	test   %ecx,%ecx
+  80317a:	75 01                	jne    80317d <pipewake+0xe>
+  80317c:	c3                   	ret
+{
+  80317d:	55                   	push   %ebp
+  80317e:	89 e5                	mov    %esp,%ebp
+  803180:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  803183:	68 00 04 00 00       	push   $0x400
+  803188:	52                   	push   %edx
+  803189:	e8 22 e1 ff ff       	call   8012b0 <sys_futex_wake>
+  80318e:	83 c4 10             	add    $0x10,%esp
+}
+  803191:	c9                   	leave
+  803192:	c3                   	ret
+
+00803193 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803193:	55                   	push   %ebp
+  803194:	89 e5                	mov    %esp,%ebp
+  803196:	56                   	push   %esi
+  803197:	53                   	push   %ebx
+  803198:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80319b:	83 ec 0c             	sub    $0xc,%esp
+  80319e:	56                   	push   %esi
+  80319f:	e8 7a e2 ff ff       	call   80141e <fd2data>
+  8031a4:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  8031a6:	83 c4 08             	add    $0x8,%esp
+  8031a9:	56                   	push   %esi
+  8031aa:	6a 00                	push   $0x0
+  8031ac:	e8 54 de ff ff       	call   801005 <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  8031b1:	8d 53 04             	lea    0x4(%ebx),%edx
+  8031b4:	8d 43 08             	lea    0x8(%ebx),%eax
+  8031b7:	e8 b3 ff ff ff       	call   80316f <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  8031bc:	8d 43 0c             	lea    0xc(%ebx),%eax
+  8031bf:	89 da                	mov    %ebx,%edx
+  8031c1:	e8 a9 ff ff ff       	call   80316f <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  8031c6:	89 34 24             	mov    %esi,(%esp)
+  8031c9:	e8 50 e2 ff ff       	call   80141e <fd2data>
+  8031ce:	83 c4 08             	add    $0x8,%esp
+  8031d1:	50                   	push   %eax
+  8031d2:	6a 00                	push   $0x0
+  8031d4:	e8 2c de ff ff       	call   801005 <sys_page_unmap>
+}
+  8031d9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8031dc:	5b                   	pop    %ebx
+  8031dd:	5e                   	pop    %esi
+  8031de:	5d                   	pop    %ebp
+  8031df:	c3                   	ret
+
+008031e0 <_pipeisclosed>:
+{
+  8031e0:	55                   	push   %ebp
+  8031e1:	89 e5                	mov    %esp,%ebp
+  8031e3:	57                   	push   %edi
+  8031e4:	56                   	push   %esi
+  8031e5:	53                   	push   %ebx
+  8031e6:	83 ec 1c             	sub    $0x1c,%esp
+  8031e9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8031ec:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8031ee:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  8031f3:	eb 5d                	jmp    803252 <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  8031f5:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		n = thisenv->env_runs;
+  8031fb:	8b 02                	mov    (%edx),%eax
+  8031fd:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  803200:	83 ec 0c             	sub    $0xc,%esp
+  803203:	ff 75 e0             	push   -0x20(%ebp)
+  803206:	e8 7c 16 00 00       	call   804887 <pageref>
+  80320b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80320e:	89 3c 24             	mov    %edi,(%esp)
+  803211:	e8 71 16 00 00       	call   804887 <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  803216:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803218:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  80321e:	83 c4 10             	add    $0x10,%esp
+  803221:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803227:	77 15                	ja     80323e <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803229:	89 f2                	mov    %esi,%edx
+  80322b:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  80322d:	c1 ea 10             	shr    $0x10,%edx
+  803230:	74 0c                	je     80323e <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803232:	c1 e2 10             	shl    $0x10,%edx
+  803235:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80323a:	29 d1                	sub    %edx,%ecx
+  80323c:	eb 06                	jmp    803244 <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  80323e:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		nn = thisenv->env_runs;
+  803244:	8b 11                	mov    (%ecx),%edx
+  803246:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  803249:	39 d3                	cmp    %edx,%ebx
+  80324b:	74 6e                	je     8032bb <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  80324d:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803250:	74 24                	je     803276 <_pipeisclosed+0x96>
+  803252:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803254:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80325a:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80325f:	77 94                	ja     8031f5 <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803261:	89 f0                	mov    %esi,%eax
+  803263:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803265:	c1 e8 10             	shr    $0x10,%eax
+  803268:	74 8b                	je     8031f5 <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80326a:	c1 e0 10             	shl    $0x10,%eax
+  80326d:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803272:	29 c2                	sub    %eax,%edx
+  803274:	eb 85                	jmp    8031fb <_pipeisclosed+0x1b>
+  803276:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803278:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80327e:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803283:	77 18                	ja     80329d <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803285:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80328a:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80328c:	c1 e8 10             	shr    $0x10,%eax
+  80328f:	74 0c                	je     80329d <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803291:	c1 e0 10             	shl    $0x10,%eax
+  803294:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803299:	29 c2                	sub    %eax,%edx
+  80329b:	eb 06                	jmp    8032a3 <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  80329d:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8032a3:	8b 02                	mov    (%edx),%eax
+  8032a5:	8b 40 58             	mov    0x58(%eax),%eax
+  8032a8:	6a 01                	push   $0x1
+  8032aa:	50                   	push   %eax
+  8032ab:	53                   	push   %ebx
+  8032ac:	68 8e 52 80 00       	push   $0x80528e
+  8032b1:	e8 94 d2 ff ff       	call   80054a <cprintf>
+  8032b6:	83 c4 10             	add    $0x10,%esp
+  8032b9:	eb 97                	jmp    803252 <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  8032bb:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8032be:	0f 94 c0             	sete   %al
+  8032c1:	0f b6 c0             	movzbl %al,%eax
+}
+  8032c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8032c7:	5b                   	pop    %ebx
+  8032c8:	5e                   	pop    %esi
+  8032c9:	5f                   	pop    %edi
+  8032ca:	5d                   	pop    %ebp
+  8032cb:	c3                   	ret
+
+008032cc <devpipe_write>:
+{
+  8032cc:	55                   	push   %ebp
+  8032cd:	89 e5                	mov    %esp,%ebp
+  8032cf:	57                   	push   %edi
+  8032d0:	56                   	push   %esi
+  8032d1:	53                   	push   %ebx
+  8032d2:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  8032d5:	ff 75 08             	push   0x8(%ebp)
+  8032d8:	e8 41 e1 ff ff       	call   80141e <fd2data>
+  8032dd:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8032df:	83 c4 10             	add    $0x10,%esp
+  8032e2:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  8032e9:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  8032ec:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8032ef:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8032f2:	0f 84 96 00 00 00    	je     80338e <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  8032f8:	8d 73 08             	lea    0x8(%ebx),%esi
+  8032fb:	eb 32                	jmp    80332f <devpipe_write+0x63>
+  8032fd:	89 fa                	mov    %edi,%edx
+  8032ff:	89 f0                	mov    %esi,%eax
+  803301:	e8 69 fe ff ff       	call   80316f <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  803306:	8b 43 04             	mov    0x4(%ebx),%eax
+  803309:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  80330c:	ba 01 00 00 00       	mov    $0x1,%edx
+  803311:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  803316:	83 ec 04             	sub    $0x4,%esp
+  803319:	6a 0a                	push   $0xa
+  80331b:	50                   	push   %eax
+  80331c:	53                   	push   %ebx
+  80331d:	e8 5f df ff ff       	call   801281 <sys_futex_wait>
+  803322:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803327:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  80332c:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80332f:	8b 43 04             	mov    0x4(%ebx),%eax
+  803332:	8b 0b                	mov    (%ebx),%ecx
+  803334:	8d 51 20             	lea    0x20(%ecx),%edx
+  803337:	39 d0                	cmp    %edx,%eax
+  803339:	72 1b                	jb     803356 <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  80333b:	89 da                	mov    %ebx,%edx
+  80333d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803340:	e8 9b fe ff ff       	call   8031e0 <_pipeisclosed>
+  803345:	85 c0                	test   %eax,%eax
+  803347:	74 b4                	je     8032fd <devpipe_write+0x31>
+				return 0;
+  803349:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80334e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803351:	5b                   	pop    %ebx
+  803352:	5e                   	pop    %esi
+  803353:	5f                   	pop    %edi
+  803354:	5d                   	pop    %ebp
+  803355:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803356:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803359:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80335c:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  803360:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  803363:	89 c2                	mov    %eax,%edx
+  803365:	c1 fa 1f             	sar    $0x1f,%edx
+  803368:	89 d1                	mov    %edx,%ecx
+  80336a:	c1 e9 1b             	shr    $0x1b,%ecx
+  80336d:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  803370:	83 e2 1f             	and    $0x1f,%edx
+  803373:	29 ca                	sub    %ecx,%edx
+  803375:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  803379:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  80337d:	83 c0 01             	add    $0x1,%eax
+  803380:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  803383:	83 c6 01             	add    $0x1,%esi
+  803386:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803389:	e9 5e ff ff ff       	jmp    8032ec <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  80338e:	8d 53 04             	lea    0x4(%ebx),%edx
+  803391:	8d 43 08             	lea    0x8(%ebx),%eax
+  803394:	e8 d6 fd ff ff       	call   80316f <pipewake>
+	return i;
+  803399:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80339c:	eb b0                	jmp    80334e <devpipe_write+0x82>
+
+0080339e <devpipe_read>:
+{
+  80339e:	55                   	push   %ebp
+  80339f:	89 e5                	mov    %esp,%ebp
+  8033a1:	57                   	push   %edi
+  8033a2:	56                   	push   %esi
+  8033a3:	53                   	push   %ebx
+  8033a4:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  8033a7:	ff 75 08             	push   0x8(%ebp)
+  8033aa:	e8 6f e0 ff ff       	call   80141e <fd2data>
+  8033af:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8033b1:	83 c4 10             	add    $0x10,%esp
+  8033b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8033b9:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8033bc:	74 6c                	je     80342a <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  8033be:	8d 7b 04             	lea    0x4(%ebx),%edi
+  8033c1:	eb 25                	jmp    8033e8 <devpipe_read+0x4a>
+  8033c3:	8b 13                	mov    (%ebx),%edx
+  8033c5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8033ca:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  8033cf:	83 ec 04             	sub    $0x4,%esp
+  8033d2:	6a 0a                	push   $0xa
+  8033d4:	52                   	push   %edx
+  8033d5:	57                   	push   %edi
+  8033d6:	e8 a6 de ff ff       	call   801281 <sys_futex_wait>
+  8033db:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8033e0:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  8033e5:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  8033e8:	8b 03                	mov    (%ebx),%eax
+  8033ea:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8033ed:	75 19                	jne    803408 <devpipe_read+0x6a>
+			if (i > 0)
+  8033ef:	85 f6                	test   %esi,%esi
+  8033f1:	75 3a                	jne    80342d <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  8033f3:	89 da                	mov    %ebx,%edx
+  8033f5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033f8:	e8 e3 fd ff ff       	call   8031e0 <_pipeisclosed>
+  8033fd:	85 c0                	test   %eax,%eax
+  8033ff:	74 c2                	je     8033c3 <devpipe_read+0x25>
+				return 0;
+  803401:	b8 00 00 00 00       	mov    $0x0,%eax
+  803406:	eb 31                	jmp    803439 <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803408:	89 c1                	mov    %eax,%ecx
+  80340a:	c1 f9 1f             	sar    $0x1f,%ecx
+  80340d:	c1 e9 1b             	shr    $0x1b,%ecx
+  803410:	01 c8                	add    %ecx,%eax
+  803412:	83 e0 1f             	and    $0x1f,%eax
+  803415:	29 c8                	sub    %ecx,%eax
+  803417:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  80341c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80341f:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  803422:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  803425:	83 c6 01             	add    $0x1,%esi
+  803428:	eb 8f                	jmp    8033b9 <devpipe_read+0x1b>
+out:
+  80342a:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  80342d:	8d 43 0c             	lea    0xc(%ebx),%eax
+  803430:	89 da                	mov    %ebx,%edx
+  803432:	e8 38 fd ff ff       	call   80316f <pipewake>
+	return i;
+  803437:	89 f0                	mov    %esi,%eax
+}
+  803439:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80343c:	5b                   	pop    %ebx
+  80343d:	5e                   	pop    %esi
+  80343e:	5f                   	pop    %edi
+  80343f:	5d                   	pop    %ebp
+  803440:	c3                   	ret
+
+00803441 <pipe>:
+{
+  803441:	55                   	push   %ebp
+  803442:	89 e5                	mov    %esp,%ebp
+  803444:	56                   	push   %esi
+  803445:	53                   	push   %ebx
+  803446:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803449:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80344c:	50                   	push   %eax
+  80344d:	e8 e3 df ff ff       	call   801435 <fd_alloc>
+  803452:	89 c3                	mov    %eax,%ebx
+  803454:	83 c4 10             	add    $0x10,%esp
+  803457:	85 c0                	test   %eax,%eax
+  803459:	0f 88 23 01 00 00    	js     803582 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80345f:	83 ec 04             	sub    $0x4,%esp
+  803462:	68 07 04 00 00       	push   $0x407
+  803467:	ff 75 f4             	push   -0xc(%ebp)
+  80346a:	6a 00                	push   $0x0
+  80346c:	e8 fb da ff ff       	call   800f6c <sys_page_alloc>
+  803471:	89 c3                	mov    %eax,%ebx
+  803473:	83 c4 10             	add    $0x10,%esp
+  803476:	85 c0                	test   %eax,%eax
+  803478:	0f 88 04 01 00 00    	js     803582 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80347e:	83 ec 0c             	sub    $0xc,%esp
+  803481:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803484:	50                   	push   %eax
+  803485:	e8 ab df ff ff       	call   801435 <fd_alloc>
+  80348a:	89 c3                	mov    %eax,%ebx
+  80348c:	83 c4 10             	add    $0x10,%esp
+  80348f:	85 c0                	test   %eax,%eax
+  803491:	0f 88 db 00 00 00    	js     803572 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803497:	83 ec 04             	sub    $0x4,%esp
+  80349a:	68 07 04 00 00       	push   $0x407
+  80349f:	ff 75 f0             	push   -0x10(%ebp)
+  8034a2:	6a 00                	push   $0x0
+  8034a4:	e8 c3 da ff ff       	call   800f6c <sys_page_alloc>
+  8034a9:	89 c3                	mov    %eax,%ebx
+  8034ab:	83 c4 10             	add    $0x10,%esp
+  8034ae:	85 c0                	test   %eax,%eax
+  8034b0:	0f 88 bc 00 00 00    	js     803572 <pipe+0x131>
+	va = fd2data(fd0);
+  8034b6:	83 ec 0c             	sub    $0xc,%esp
+  8034b9:	ff 75 f4             	push   -0xc(%ebp)
+  8034bc:	e8 5d df ff ff       	call   80141e <fd2data>
+  8034c1:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8034c3:	83 c4 0c             	add    $0xc,%esp
+  8034c6:	68 07 04 00 00       	push   $0x407
+  8034cb:	50                   	push   %eax
+  8034cc:	6a 00                	push   $0x0
+  8034ce:	e8 99 da ff ff       	call   800f6c <sys_page_alloc>
+  8034d3:	89 c3                	mov    %eax,%ebx
+  8034d5:	83 c4 10             	add    $0x10,%esp
+  8034d8:	85 c0                	test   %eax,%eax
+  8034da:	0f 88 82 00 00 00    	js     803562 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8034e0:	83 ec 0c             	sub    $0xc,%esp
+  8034e3:	ff 75 f0             	push   -0x10(%ebp)
+  8034e6:	e8 33 df ff ff       	call   80141e <fd2data>
+  8034eb:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8034f2:	50                   	push   %eax
+  8034f3:	6a 00                	push   $0x0
+  8034f5:	56                   	push   %esi
+  8034f6:	6a 00                	push   $0x0
+  8034f8:	e8 bc da ff ff       	call   800fb9 <sys_page_map>
+  8034fd:	89 c3                	mov    %eax,%ebx
+  8034ff:	83 c4 20             	add    $0x20,%esp
+  803502:	85 c0                	test   %eax,%eax
+  803504:	78 4e                	js     803554 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803506:	a1 7c 62 80 00       	mov    0x80627c,%eax
+  80350b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80350e:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803510:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803513:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80351a:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80351d:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80351f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803522:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803529:	83 ec 0c             	sub    $0xc,%esp
+  80352c:	ff 75 f4             	push   -0xc(%ebp)
+  80352f:	e8 da de ff ff       	call   80140e <fd2num>
+  803534:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803537:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803539:	83 c4 04             	add    $0x4,%esp
+  80353c:	ff 75 f0             	push   -0x10(%ebp)
+  80353f:	e8 ca de ff ff       	call   80140e <fd2num>
+  803544:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803547:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80354a:	83 c4 10             	add    $0x10,%esp
+  80354d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803552:	eb 2e                	jmp    803582 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803554:	83 ec 08             	sub    $0x8,%esp
+  803557:	56                   	push   %esi
+  803558:	6a 00                	push   $0x0
+  80355a:	e8 a6 da ff ff       	call   801005 <sys_page_unmap>
+  80355f:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803562:	83 ec 08             	sub    $0x8,%esp
+  803565:	ff 75 f0             	push   -0x10(%ebp)
+  803568:	6a 00                	push   $0x0
+  80356a:	e8 96 da ff ff       	call   801005 <sys_page_unmap>
+  80356f:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803572:	83 ec 08             	sub    $0x8,%esp
+  803575:	ff 75 f4             	push   -0xc(%ebp)
+  803578:	6a 00                	push   $0x0
+  80357a:	e8 86 da ff ff       	call   801005 <sys_page_unmap>
+  80357f:	83 c4 10             	add    $0x10,%esp
+}
+  803582:	89 d8                	mov    %ebx,%eax
+  803584:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803587:	5b                   	pop    %ebx
+  803588:	5e                   	pop    %esi
+  803589:	5d                   	pop    %ebp
+  80358a:	c3                   	ret
+
+0080358b <pipeisclosed>:
+{
+  80358b:	55                   	push   %ebp
+  80358c:	89 e5                	mov    %esp,%ebp
+  80358e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803591:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803594:	50                   	push   %eax
+  803595:	ff 75 08             	push   0x8(%ebp)
+  803598:	e8 ee de ff ff       	call   80148b <fd_lookup>
+  80359d:	83 c4 10             	add    $0x10,%esp
+  8035a0:	85 c0                	test   %eax,%eax
+  8035a2:	78 18                	js     8035bc <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8035a4:	83 ec 0c             	sub    $0xc,%esp
+  8035a7:	ff 75 f4             	push   -0xc(%ebp)
+  8035aa:	e8 6f de ff ff       	call   80141e <fd2data>
+  8035af:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8035b1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8035b4:	e8 27 fc ff ff       	call   8031e0 <_pipeisclosed>
+  8035b9:	83 c4 10             	add    $0x10,%esp
+}
+  8035bc:	c9                   	leave
+  8035bd:	c3                   	ret
+
+008035be <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  8035be:	55                   	push   %ebp
+  8035bf:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  8035c1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035c4:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8035ca:	5d                   	pop    %ebp
+  8035cb:	c3                   	ret
+
+008035cc <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  8035cc:	55                   	push   %ebp
+  8035cd:	89 e5                	mov    %esp,%ebp
+  8035cf:	56                   	push   %esi
+  8035d0:	53                   	push   %ebx
+  8035d1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  8035d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035d9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8035de:	89 d0                	mov    %edx,%eax
+  8035e0:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  8035e4:	85 c0                	test   %eax,%eax
+  8035e6:	74 2d                	je     803615 <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  8035e8:	83 f8 02             	cmp    $0x2,%eax
+  8035eb:	74 08                	je     8035f5 <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  8035ed:	b8 02 00 00 00       	mov    $0x2,%eax
+  8035f2:	f0 87 03             	lock xchg %eax,(%ebx)
+  8035f5:	be 02 00 00 00       	mov    $0x2,%esi
+  8035fa:	eb 15                	jmp    803611 <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  8035fc:	83 ec 04             	sub    $0x4,%esp
+  8035ff:	6a 00                	push   $0x0
+  803601:	6a 02                	push   $0x2
+  803603:	53                   	push   %ebx
+  803604:	e8 78 dc ff ff       	call   801281 <sys_futex_wait>
+  803609:	89 f0                	mov    %esi,%eax
+  80360b:	f0 87 03             	lock xchg %eax,(%ebx)
+  80360e:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  803611:	85 c0                	test   %eax,%eax
+  803613:	75 e7                	jne    8035fc <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  803615:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803618:	5b                   	pop    %ebx
+  803619:	5e                   	pop    %esi
+  80361a:	5d                   	pop    %ebp
+  80361b:	c3                   	ret
+
+0080361c <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  80361c:	55                   	push   %ebp
+  80361d:	89 e5                	mov    %esp,%ebp
+  80361f:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803622:	b8 00 00 00 00       	mov    $0x0,%eax
+  803627:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80362c:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  803630:	f7 d8                	neg    %eax
+  803632:	19 c0                	sbb    %eax,%eax
+  803634:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  803637:	5d                   	pop    %ebp
+  803638:	c3                   	ret
+
+00803639 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  803639:	55                   	push   %ebp
+  80363a:	89 e5                	mov    %esp,%ebp
+  80363c:	83 ec 08             	sub    $0x8,%esp
+  80363f:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  803642:	b8 00 00 00 00       	mov    $0x0,%eax
+  803647:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  80364a:	83 f8 02             	cmp    $0x2,%eax
+  80364d:	74 02                	je     803651 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  80364f:	c9                   	leave
+  803650:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  803651:	83 ec 08             	sub    $0x8,%esp
+  803654:	6a 01                	push   $0x1
+  803656:	52                   	push   %edx
+  803657:	e8 54 dc ff ff       	call   8012b0 <sys_futex_wake>
+  80365c:	83 c4 10             	add    $0x10,%esp
+}
+  80365f:	eb ee                	jmp    80364f <mutex_unlock+0x16>
+
+00803661 <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  803661:	55                   	push   %ebp
+  803662:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  803664:	8b 45 08             	mov    0x8(%ebp),%eax
+  803667:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  80366d:	5d                   	pop    %ebp
+  80366e:	c3                   	ret
+
+0080366f <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  80366f:	55                   	push   %ebp
+  803670:	89 e5                	mov    %esp,%ebp
+  803672:	57                   	push   %edi
+  803673:	56                   	push   %esi
+  803674:	53                   	push   %ebx
+  803675:	83 ec 18             	sub    $0x18,%esp
+  803678:	8b 75 08             	mov    0x8(%ebp),%esi
+  80367b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  80367e:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  803680:	53                   	push   %ebx
+  803681:	e8 b3 ff ff ff       	call   803639 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  803686:	83 c4 0c             	add    $0xc,%esp
+  803689:	ff 75 10             	push   0x10(%ebp)
+  80368c:	57                   	push   %edi
+  80368d:	56                   	push   %esi
+  80368e:	e8 ee db ff ff       	call   801281 <sys_futex_wait>
+  803693:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  803695:	83 c4 10             	add    $0x10,%esp
+  803698:	be 02 00 00 00       	mov    $0x2,%esi
+  80369d:	eb 10                	jmp    8036af <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  80369f:	83 ec 04             	sub    $0x4,%esp
+  8036a2:	6a 00                	push   $0x0
+  8036a4:	6a 02                	push   $0x2
+  8036a6:	53                   	push   %ebx
+  8036a7:	e8 d5 db ff ff       	call   801281 <sys_futex_wait>
+  8036ac:	83 c4 10             	add    $0x10,%esp
+  8036af:	89 f0                	mov    %esi,%eax
+  8036b1:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  8036b4:	85 c0                	test   %eax,%eax
+  8036b6:	75 e7                	jne    80369f <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  8036b8:	83 ff ec             	cmp    $0xffffffec,%edi
+  8036bb:	74 05                	je     8036c2 <cond_timedwait+0x53>
+  8036bd:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  8036c2:	89 f8                	mov    %edi,%eax
+  8036c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036c7:	5b                   	pop    %ebx
+  8036c8:	5e                   	pop    %esi
+  8036c9:	5f                   	pop    %edi
+  8036ca:	5d                   	pop    %ebp
+  8036cb:	c3                   	ret
+
+008036cc <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  8036cc:	55                   	push   %ebp
+  8036cd:	89 e5                	mov    %esp,%ebp
+  8036cf:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  8036d2:	6a 00                	push   $0x0
+  8036d4:	ff 75 0c             	push   0xc(%ebp)
+  8036d7:	ff 75 08             	push   0x8(%ebp)
+  8036da:	e8 90 ff ff ff       	call   80366f <cond_timedwait>
+}
+  8036df:	83 c4 10             	add    $0x10,%esp
+  8036e2:	c9                   	leave
+  8036e3:	c3                   	ret
+
+008036e4 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  8036e4:	55                   	push   %ebp
+  8036e5:	89 e5                	mov    %esp,%ebp
+  8036e7:	83 ec 10             	sub    $0x10,%esp
+  8036ea:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  8036ed:	ba 01 00 00 00       	mov    $0x1,%edx
+  8036f2:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  8036f6:	6a 01                	push   $0x1
+  8036f8:	50                   	push   %eax
+  8036f9:	e8 b2 db ff ff       	call   8012b0 <sys_futex_wake>
+}
+  8036fe:	83 c4 10             	add    $0x10,%esp
+  803701:	c9                   	leave
+  803702:	c3                   	ret
+
+00803703 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  803703:	55                   	push   %ebp
+  803704:	89 e5                	mov    %esp,%ebp
+  803706:	83 ec 10             	sub    $0x10,%esp
+  803709:	8b 45 08             	mov    0x8(%ebp),%eax
+  80370c:	ba 01 00 00 00       	mov    $0x1,%edx
+  803711:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  803715:	68 00 04 00 00       	push   $0x400
+  80371a:	50                   	push   %eax
+  80371b:	e8 90 db ff ff       	call   8012b0 <sys_futex_wake>
+}
+  803720:	83 c4 10             	add    $0x10,%esp
+  803723:	c9                   	leave
+  803724:	c3                   	ret
+
+00803725 <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  803725:	55                   	push   %ebp
+  803726:	89 e5                	mov    %esp,%ebp
+  803728:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  80372b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80372e:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  803730:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  803737:	5d                   	pop    %ebp
+  803738:	c3                   	ret
+
+00803739 <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  803739:	55                   	push   %ebp
+  80373a:	89 e5                	mov    %esp,%ebp
+  80373c:	53                   	push   %ebx
+  80373d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  803740:	8b 11                	mov    (%ecx),%edx
+  803742:	85 d2                	test   %edx,%edx
+  803744:	74 14                	je     80375a <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  803746:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803749:	89 d0                	mov    %edx,%eax
+  80374b:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  80374f:	39 c2                	cmp    %eax,%edx
+  803751:	75 ed                	jne    803740 <sem_trywait+0x7>
+			return 0;
+  803753:	b8 00 00 00 00       	mov    $0x0,%eax
+  803758:	eb 05                	jmp    80375f <sem_trywait+0x26>
+	return -E_AGAIN;
+  80375a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  80375f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803762:	c9                   	leave
+  803763:	c3                   	ret
+
+00803764 <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  803764:	55                   	push   %ebp
+  803765:	89 e5                	mov    %esp,%ebp
+  803767:	57                   	push   %edi
+  803768:	56                   	push   %esi
+  803769:	53                   	push   %ebx
+  80376a:	83 ec 1c             	sub    $0x1c,%esp
+  80376d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803770:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  803773:	e8 81 da ff ff       	call   8011f9 <sys_time_msec>
+  803778:	01 f8                	add    %edi,%eax
+  80377a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  80377d:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  803782:	eb 28                	jmp    8037ac <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  803784:	b8 01 00 00 00       	mov    $0x1,%eax
+  803789:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  80378e:	83 ec 04             	sub    $0x4,%esp
+  803791:	56                   	push   %esi
+  803792:	6a 00                	push   $0x0
+  803794:	53                   	push   %ebx
+  803795:	e8 e7 da ff ff       	call   801281 <sys_futex_wait>
+  80379a:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  80379f:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  8037a4:	83 c4 10             	add    $0x10,%esp
+  8037a7:	83 f8 ec             	cmp    $0xffffffec,%eax
+  8037aa:	74 2e                	je     8037da <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  8037ac:	83 ec 0c             	sub    $0xc,%esp
+  8037af:	53                   	push   %ebx
+  8037b0:	e8 84 ff ff ff       	call   803739 <sem_trywait>
+  8037b5:	83 c4 10             	add    $0x10,%esp
+  8037b8:	85 c0                	test   %eax,%eax
+  8037ba:	79 19                	jns    8037d5 <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  8037bc:	85 ff                	test   %edi,%edi
+  8037be:	74 c4                	je     803784 <sem_timedwait+0x20>
+  8037c0:	e8 34 da ff ff       	call   8011f9 <sys_time_msec>
+  8037c5:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8037c8:	29 c6                	sub    %eax,%esi
+  8037ca:	85 f6                	test   %esi,%esi
+  8037cc:	7f b6                	jg     803784 <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  8037ce:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  8037d3:	eb 05                	jmp    8037da <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  8037d5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8037da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8037dd:	5b                   	pop    %ebx
+  8037de:	5e                   	pop    %esi
+  8037df:	5f                   	pop    %edi
+  8037e0:	5d                   	pop    %ebp
+  8037e1:	c3                   	ret
+
+008037e2 <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  8037e2:	55                   	push   %ebp
+  8037e3:	89 e5                	mov    %esp,%ebp
+  8037e5:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  8037e8:	6a 00                	push   $0x0
+  8037ea:	ff 75 08             	push   0x8(%ebp)
+  8037ed:	e8 72 ff ff ff       	call   803764 <sem_timedwait>
+}
+  8037f2:	83 c4 10             	add    $0x10,%esp
+  8037f5:	c9                   	leave
+  8037f6:	c3                   	ret
+
+008037f7 <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  8037f7:	55                   	push   %ebp
+  8037f8:	89 e5                	mov    %esp,%ebp
+  8037fa:	83 ec 08             	sub    $0x8,%esp
+  8037fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  803800:	ba 01 00 00 00       	mov    $0x1,%edx
+  803805:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  803809:	8b 50 04             	mov    0x4(%eax),%edx
+  80380c:	85 d2                	test   %edx,%edx
+  80380e:	75 02                	jne    803812 <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  803810:	c9                   	leave
+  803811:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  803812:	83 ec 08             	sub    $0x8,%esp
+  803815:	6a 01                	push   $0x1
+  803817:	50                   	push   %eax
+  803818:	e8 93 da ff ff       	call   8012b0 <sys_futex_wake>
+  80381d:	83 c4 10             	add    $0x10,%esp
+}
+  803820:	eb ee                	jmp    803810 <sem_post+0x19>
+
+00803822 <uring_init>:
+
+// Map a fresh page at u, which must be page-aligned, and register it
+// as this environment's system call ring.
+int
+uring_init(struct Uring *u)
+{
+  803822:	55                   	push   %ebp
+  803823:	89 e5                	mov    %esp,%ebp
+  803825:	56                   	push   %esi
+  803826:	53                   	push   %ebx
+  803827:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+
+	if ((r = sys_page_alloc(0, u, PTE_P|PTE_U|PTE_W)) < 0)
+  80382a:	83 ec 04             	sub    $0x4,%esp
+  80382d:	6a 07                	push   $0x7
+  80382f:	56                   	push   %esi
+  803830:	6a 00                	push   $0x0
+  803832:	e8 35 d7 ff ff       	call   800f6c <sys_page_alloc>
+  803837:	89 c3                	mov    %eax,%ebx
+  803839:	83 c4 10             	add    $0x10,%esp
+  80383c:	85 c0                	test   %eax,%eax
+  80383e:	78 17                	js     803857 <uring_init+0x35>
+		return r;
+	if ((r = sys_uring_setup(u)) < 0) {
+  803840:	83 ec 0c             	sub    $0xc,%esp
+  803843:	56                   	push   %esi
+  803844:	e8 95 da ff ff       	call   8012de <sys_uring_setup>
+  803849:	89 c3                	mov    %eax,%ebx
+  80384b:	83 c4 10             	add    $0x10,%esp
+  80384e:	85 c0                	test   %eax,%eax
+  803850:	78 0e                	js     803860 <uring_init+0x3e>
+		sys_page_unmap(0, u);
+		return r;
+	}
+	return 0;
+  803852:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803857:	89 d8                	mov    %ebx,%eax
+  803859:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80385c:	5b                   	pop    %ebx
+  80385d:	5e                   	pop    %esi
+  80385e:	5d                   	pop    %ebp
+  80385f:	c3                   	ret
+		sys_page_unmap(0, u);
+  803860:	83 ec 08             	sub    $0x8,%esp
+  803863:	56                   	push   %esi
+  803864:	6a 00                	push   $0x0
+  803866:	e8 9a d7 ff ff       	call   801005 <sys_page_unmap>
+		return r;
+  80386b:	83 c4 10             	add    $0x10,%esp
+  80386e:	eb e7                	jmp    803857 <uring_init+0x35>
+
+00803870 <uring_queue>:
+// Returns 0 on success, -E_AGAIN if the queue stays full because the
+// completion queue is full too: reap some completions and try again.
+int
+uring_queue(struct Uring *u, uint32_t op, uint32_t data,
+	    uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
+{
+  803870:	55                   	push   %ebp
+  803871:	89 e5                	mov    %esp,%ebp
+  803873:	53                   	push   %ebx
+  803874:	83 ec 04             	sub    $0x4,%esp
+  803877:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct UringSqe *sqe;
+
+	if (u->sq_tail - u->sq_head == URING_NSQE) {
+  80387a:	8b 43 04             	mov    0x4(%ebx),%eax
+  80387d:	8b 13                	mov    (%ebx),%edx
+  80387f:	29 d0                	sub    %edx,%eax
+  803881:	83 f8 40             	cmp    $0x40,%eax
+  803884:	74 48                	je     8038ce <uring_queue+0x5e>
+		sys_uring_enter();
+		if (u->sq_tail - u->sq_head == URING_NSQE)
+			return -E_AGAIN;
+	}
+	sqe = &u->sq[u->sq_tail % URING_NSQE];
+  803886:	8b 43 04             	mov    0x4(%ebx),%eax
+  803889:	83 e0 3f             	and    $0x3f,%eax
+	sqe->sqe_op = op;
+  80388c:	c1 e0 05             	shl    $0x5,%eax
+  80388f:	01 d8                	add    %ebx,%eax
+  803891:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803894:	89 50 40             	mov    %edx,0x40(%eax)
+	sqe->sqe_arg[0] = a1;
+  803897:	8b 55 14             	mov    0x14(%ebp),%edx
+  80389a:	89 50 44             	mov    %edx,0x44(%eax)
+	sqe->sqe_arg[1] = a2;
+  80389d:	8b 55 18             	mov    0x18(%ebp),%edx
+  8038a0:	89 50 48             	mov    %edx,0x48(%eax)
+	sqe->sqe_arg[2] = a3;
+  8038a3:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  8038a6:	89 50 4c             	mov    %edx,0x4c(%eax)
+	sqe->sqe_arg[3] = a4;
+  8038a9:	8b 55 20             	mov    0x20(%ebp),%edx
+  8038ac:	89 50 50             	mov    %edx,0x50(%eax)
+	sqe->sqe_arg[4] = a5;
+  8038af:	8b 55 24             	mov    0x24(%ebp),%edx
+  8038b2:	89 50 54             	mov    %edx,0x54(%eax)
+	sqe->sqe_data = data;
+  8038b5:	8b 55 10             	mov    0x10(%ebp),%edx
+  8038b8:	89 50 58             	mov    %edx,0x58(%eax)
+	// The kernel may pick the entry up as soon as the tail moves.
+	asm volatile("" ::: "memory");
+	u->sq_tail++;
+  8038bb:	8b 43 04             	mov    0x4(%ebx),%eax
+  8038be:	83 c0 01             	add    $0x1,%eax
+  8038c1:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  8038c4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8038c9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8038cc:	c9                   	leave
+  8038cd:	c3                   	ret
+		sys_uring_enter();
+  8038ce:	e8 56 da ff ff       	call   801329 <sys_uring_enter>
+		if (u->sq_tail - u->sq_head == URING_NSQE)
+  8038d3:	8b 43 04             	mov    0x4(%ebx),%eax
+  8038d6:	8b 13                	mov    (%ebx),%edx
+  8038d8:	29 d0                	sub    %edx,%eax
+  8038da:	83 f8 40             	cmp    $0x40,%eax
+  8038dd:	75 a7                	jne    803886 <uring_queue+0x16>
+			return -E_AGAIN;
+  8038df:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8038e4:	eb e3                	jmp    8038c9 <uring_queue+0x59>
+
+008038e6 <uring_submit>:
+
+// Run all queued calls now.  Returns the number run, < 0 on error.
+int
+uring_submit(struct Uring *u)
+{
+  8038e6:	55                   	push   %ebp
+  8038e7:	89 e5                	mov    %esp,%ebp
+  8038e9:	56                   	push   %esi
+  8038ea:	53                   	push   %ebx
+  8038eb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r, n = 0;
+  8038ee:	be 00 00 00 00       	mov    $0x0,%esi
+
+	while (u->sq_head != u->sq_tail) {
+  8038f3:	eb 02                	jmp    8038f7 <uring_submit+0x11>
+		if ((r = sys_uring_enter()) < 0)
+			return r;
+		if (r == 0)	// completion queue full
+			break;
+		n += r;
+  8038f5:	01 c6                	add    %eax,%esi
+	while (u->sq_head != u->sq_tail) {
+  8038f7:	8b 13                	mov    (%ebx),%edx
+  8038f9:	8b 43 04             	mov    0x4(%ebx),%eax
+  8038fc:	39 c2                	cmp    %eax,%edx
+  8038fe:	74 0f                	je     80390f <uring_submit+0x29>
+		if ((r = sys_uring_enter()) < 0)
+  803900:	e8 24 da ff ff       	call   801329 <sys_uring_enter>
+  803905:	85 c0                	test   %eax,%eax
+  803907:	78 04                	js     80390d <uring_submit+0x27>
+		if (r == 0)	// completion queue full
+  803909:	75 ea                	jne    8038f5 <uring_submit+0xf>
+  80390b:	eb 02                	jmp    80390f <uring_submit+0x29>
+		if ((r = sys_uring_enter()) < 0)
+  80390d:	89 c6                	mov    %eax,%esi
+	}
+	return n;
+}
+  80390f:	89 f0                	mov    %esi,%eax
+  803911:	5b                   	pop    %ebx
+  803912:	5e                   	pop    %esi
+  803913:	5d                   	pop    %ebp
+  803914:	c3                   	ret
+
+00803915 <uring_reap>:
+
+// Take the oldest completion off the queue into *cqe.
+// Returns 1 if there was one, 0 if not.
+int
+uring_reap(struct Uring *u, struct UringCqe *cqe)
+{
+  803915:	55                   	push   %ebp
+  803916:	89 e5                	mov    %esp,%ebp
+  803918:	53                   	push   %ebx
+  803919:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (u->cq_head == u->cq_tail)
+  80391c:	8b 58 08             	mov    0x8(%eax),%ebx
+  80391f:	8b 48 0c             	mov    0xc(%eax),%ecx
+		return 0;
+  803922:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (u->cq_head == u->cq_tail)
+  803927:	39 cb                	cmp    %ecx,%ebx
+  803929:	74 2a                	je     803955 <uring_reap+0x40>
+	*cqe = u->cq[u->cq_head % URING_NCQE];
+  80392b:	8b 50 08             	mov    0x8(%eax),%edx
+  80392e:	83 e2 7f             	and    $0x7f,%edx
+  803931:	8b 8c d0 40 08 00 00 	mov    0x840(%eax,%edx,8),%ecx
+  803938:	8b 9c d0 44 08 00 00 	mov    0x844(%eax,%edx,8),%ebx
+  80393f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803942:	89 0a                	mov    %ecx,(%edx)
+  803944:	89 5a 04             	mov    %ebx,0x4(%edx)
+	asm volatile("" ::: "memory");
+	u->cq_head++;
+  803947:	8b 50 08             	mov    0x8(%eax),%edx
+  80394a:	83 c2 01             	add    $0x1,%edx
+  80394d:	89 50 08             	mov    %edx,0x8(%eax)
+	return 1;
+  803950:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803955:	89 d0                	mov    %edx,%eax
+  803957:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80395a:	c9                   	leave
+  80395b:	c3                   	ret
+
+0080395c <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  80395c:	55                   	push   %ebp
+  80395d:	89 e5                	mov    %esp,%ebp
+  80395f:	57                   	push   %edi
+  803960:	56                   	push   %esi
+  803961:	53                   	push   %ebx
+  803962:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  803965:	68 20 70 80 00       	push   $0x807020
+  80396a:	e8 5d fc ff ff       	call   8035cc <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  80396f:	a1 44 70 80 00       	mov    0x807044,%eax
+  803974:	83 c4 10             	add    $0x10,%esp
+  803977:	85 c0                	test   %eax,%eax
+  803979:	75 19                	jne    803994 <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  80397b:	a1 c0 72 80 00       	mov    0x8072c0,%eax
+  803980:	8b 00                	mov    (%eax),%eax
+  803982:	8b 40 48             	mov    0x48(%eax),%eax
+  803985:	a3 40 70 80 00       	mov    %eax,0x807040
+		threads[0].th_state = PTH_RUNNING;
+  80398a:	c7 05 44 70 80 00 01 	movl   $0x1,0x807044
+  803991:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803994:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  803999:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80399c:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  8039a3:	8b 40 04             	mov    0x4(%eax),%eax
+  8039a6:	85 c0                	test   %eax,%eax
+  8039a8:	0f 84 e4 00 00 00    	je     803a92 <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  8039ae:	83 c3 01             	add    $0x1,%ebx
+  8039b1:	83 fb 20             	cmp    $0x20,%ebx
+  8039b4:	75 e3                	jne    803999 <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  8039b6:	83 ec 0c             	sub    $0xc,%esp
+  8039b9:	68 20 70 80 00       	push   $0x807020
+  8039be:	e8 76 fc ff ff       	call   803639 <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  8039c3:	83 c4 10             	add    $0x10,%esp
+  8039c6:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  8039cb:	e9 b8 00 00 00       	jmp    803a88 <pthread_create+0x12c>
+  8039d0:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  8039d3:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  8039d6:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  8039d8:	39 f3                	cmp    %esi,%ebx
+  8039da:	73 16                	jae    8039f2 <pthread_create+0x96>
+		va -= PGSIZE;
+  8039dc:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  8039e2:	83 ec 08             	sub    $0x8,%esp
+  8039e5:	56                   	push   %esi
+  8039e6:	6a 00                	push   $0x0
+  8039e8:	e8 18 d6 ff ff       	call   801005 <sys_page_unmap>
+  8039ed:	83 c4 10             	add    $0x10,%esp
+  8039f0:	eb e6                	jmp    8039d8 <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  8039f2:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8039f5:	83 ec 08             	sub    $0x8,%esp
+  8039f8:	ff 75 e4             	push   -0x1c(%ebp)
+  8039fb:	6a 00                	push   $0x0
+  8039fd:	e8 03 d6 ff ff       	call   801005 <sys_page_unmap>
+	return r;
+  803a02:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  803a05:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803a08:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803a0f:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  803a16:	eb 70                	jmp    803a88 <pthread_create+0x12c>
+	th->th_fn = fn;
+  803a18:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803a1b:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803a22:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803a25:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  803a28:	8b 55 10             	mov    0x10(%ebp),%edx
+  803a2b:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  803a2e:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  803a35:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  803a3a:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803a3d:	29 c8                	sub    %ecx,%eax
+  803a3f:	85 db                	test   %ebx,%ebx
+  803a41:	0f 44 05 c0 72 80 00 	cmove  0x8072c0,%eax
+	*--esp = t;
+  803a48:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  803a4b:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803a52:	83 ec 04             	sub    $0x4,%esp
+  803a55:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803a5a:	29 ca                	sub    %ecx,%edx
+  803a5c:	52                   	push   %edx
+	*--esp = 0;
+  803a5d:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  803a60:	50                   	push   %eax
+  803a61:	68 b9 3c 80 00       	push   $0x803cb9
+  803a66:	e8 ea d8 ff ff       	call   801355 <sys_thread_create>
+  803a6b:	89 c7                	mov    %eax,%edi
+  803a6d:	83 c4 10             	add    $0x10,%esp
+  803a70:	85 c0                	test   %eax,%eax
+  803a72:	78 91                	js     803a05 <pthread_create+0xa9>
+	th->th_env = id;
+  803a74:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803a77:	89 3c 85 40 70 80 00 	mov    %edi,0x807040(,%eax,4)
+	*tp = t;
+  803a7e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a81:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  803a83:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803a88:	89 f8                	mov    %edi,%eax
+  803a8a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a8d:	5b                   	pop    %ebx
+  803a8e:	5e                   	pop    %esi
+  803a8f:	5f                   	pop    %edi
+  803a90:	5d                   	pop    %ebp
+  803a91:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  803a92:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803a95:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803a9c:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  803aa3:	83 ec 0c             	sub    $0xc,%esp
+  803aa6:	68 20 70 80 00       	push   $0x807020
+  803aab:	e8 89 fb ff ff       	call   803639 <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  803ab0:	89 d9                	mov    %ebx,%ecx
+  803ab2:	c1 e1 10             	shl    $0x10,%ecx
+  803ab5:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  803ab8:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  803abd:	29 c8                	sub    %ecx,%eax
+  803abf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  803ac2:	c1 e8 16             	shr    $0x16,%eax
+  803ac5:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803acc:	83 c4 10             	add    $0x10,%esp
+  803acf:	a8 01                	test   $0x1,%al
+  803ad1:	74 15                	je     803ae8 <pthread_create+0x18c>
+  803ad3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803ad6:	c1 e8 0c             	shr    $0xc,%eax
+  803ad9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803ae0:	a8 01                	test   $0x1,%al
+  803ae2:	0f 85 30 ff ff ff    	jne    803a18 <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803ae8:	83 ec 04             	sub    $0x4,%esp
+  803aeb:	6a 07                	push   $0x7
+  803aed:	ff 75 e4             	push   -0x1c(%ebp)
+  803af0:	6a 00                	push   $0x0
+  803af2:	e8 75 d4 ff ff       	call   800f6c <sys_page_alloc>
+  803af7:	89 c7                	mov    %eax,%edi
+  803af9:	83 c4 10             	add    $0x10,%esp
+  803afc:	85 c0                	test   %eax,%eax
+  803afe:	0f 88 01 ff ff ff    	js     803a05 <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  803b04:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  803b09:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  803b0c:	29 d0                	sub    %edx,%eax
+  803b0e:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  803b11:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803b13:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  803b18:	29 d0                	sub    %edx,%eax
+  803b1a:	89 c7                	mov    %eax,%edi
+  803b1c:	39 fe                	cmp    %edi,%esi
+  803b1e:	0f 83 f4 fe ff ff    	jae    803a18 <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  803b24:	83 ec 04             	sub    $0x4,%esp
+  803b27:	6a 07                	push   $0x7
+  803b29:	56                   	push   %esi
+  803b2a:	6a 00                	push   $0x0
+  803b2c:	e8 3b d4 ff ff       	call   800f6c <sys_page_alloc>
+  803b31:	83 c4 10             	add    $0x10,%esp
+  803b34:	85 c0                	test   %eax,%eax
+  803b36:	0f 88 94 fe ff ff    	js     8039d0 <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803b3c:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803b42:	eb d8                	jmp    803b1c <pthread_create+0x1c0>
+
+00803b44 <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  803b44:	55                   	push   %ebp
+  803b45:	89 e5                	mov    %esp,%ebp
+  803b47:	57                   	push   %edi
+  803b48:	56                   	push   %esi
+  803b49:	53                   	push   %ebx
+  803b4a:	83 ec 0c             	sub    $0xc,%esp
+  803b4d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  803b50:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  803b53:	83 f8 1e             	cmp    $0x1e,%eax
+  803b56:	0f 87 c7 00 00 00    	ja     803c23 <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  803b5c:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803b5e:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803b64:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803b69:	77 12                	ja     803b7d <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803b6b:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803b70:	29 d0                	sub    %edx,%eax
+  803b72:	c1 e8 10             	shr    $0x10,%eax
+  803b75:	39 c3                	cmp    %eax,%ebx
+  803b77:	0f 84 ad 00 00 00    	je     803c2a <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803b7d:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803b80:	8d 3c 85 44 70 80 00 	lea    0x807044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  803b87:	8d 34 85 40 70 80 00 	lea    0x807040(,%eax,4),%esi
+  803b8e:	eb 10                	jmp    803ba0 <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803b90:	83 ec 04             	sub    $0x4,%esp
+  803b93:	6a 00                	push   $0x0
+  803b95:	6a 01                	push   $0x1
+  803b97:	57                   	push   %edi
+  803b98:	e8 e4 d6 ff ff       	call   801281 <sys_futex_wait>
+  803b9d:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  803ba0:	8b 46 04             	mov    0x4(%esi),%eax
+  803ba3:	83 f8 01             	cmp    $0x1,%eax
+  803ba6:	74 e8                	je     803b90 <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  803ba8:	83 f8 02             	cmp    $0x2,%eax
+  803bab:	0f 85 80 00 00 00    	jne    803c31 <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  803bb1:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  803bb4:	c1 e6 02             	shl    $0x2,%esi
+  803bb7:	eb 05                	jmp    803bbe <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  803bb9:	e8 82 d3 ff ff       	call   800f40 <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  803bbe:	8b 8e 40 70 80 00    	mov    0x807040(%esi),%ecx
+  803bc4:	89 ca                	mov    %ecx,%edx
+  803bc6:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  803bcc:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803bcf:	c1 e0 04             	shl    $0x4,%eax
+  803bd2:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803bd7:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  803bda:	39 c1                	cmp    %eax,%ecx
+  803bdc:	75 12                	jne    803bf0 <pthread_join+0xac>
+  803bde:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803be1:	c1 e0 04             	shl    $0x4,%eax
+  803be4:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803be9:	8b 40 54             	mov    0x54(%eax),%eax
+  803bec:	85 c0                	test   %eax,%eax
+  803bee:	75 c9                	jne    803bb9 <pthread_join+0x75>
+	if (ret_store)
+  803bf0:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803bf4:	74 0f                	je     803c05 <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  803bf6:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803bf9:	8b 04 85 50 70 80 00 	mov    0x807050(,%eax,4),%eax
+  803c00:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803c03:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  803c05:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803c08:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803c0f:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  803c16:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c1b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c1e:	5b                   	pop    %ebx
+  803c1f:	5e                   	pop    %esi
+  803c20:	5f                   	pop    %edi
+  803c21:	5d                   	pop    %ebp
+  803c22:	c3                   	ret
+		return -E_INVAL;
+  803c23:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803c28:	eb f1                	jmp    803c1b <pthread_join+0xd7>
+  803c2a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803c2f:	eb ea                	jmp    803c1b <pthread_join+0xd7>
+		return -E_INVAL;
+  803c31:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803c36:	eb e3                	jmp    803c1b <pthread_join+0xd7>
+
+00803c38 <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  803c38:	55                   	push   %ebp
+  803c39:	89 e5                	mov    %esp,%ebp
+  803c3b:	53                   	push   %ebx
+  803c3c:	83 ec 04             	sub    $0x4,%esp
+  803c3f:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803c41:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803c47:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803c4c:	77 0c                	ja     803c5a <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803c4e:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803c53:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  803c55:	c1 e8 10             	shr    $0x10,%eax
+  803c58:	75 0a                	jne    803c64 <pthread_exit+0x2c>
+		exit();
+  803c5a:	e8 e8 c7 ff ff       	call   800447 <exit>
+  803c5f:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  803c64:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  803c6b:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  803c6e:	8d 0c 8d 40 70 80 00 	lea    0x807040(,%ecx,4),%ecx
+  803c75:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803c78:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  803c7b:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  803c82:	83 ec 08             	sub    $0x8,%esp
+  803c85:	6a 20                	push   $0x20
+  803c87:	01 c2                	add    %eax,%edx
+  803c89:	8d 04 95 44 70 80 00 	lea    0x807044(,%edx,4),%eax
+  803c90:	50                   	push   %eax
+  803c91:	e8 1a d6 ff ff       	call   8012b0 <sys_futex_wake>
+	sys_env_destroy(0);
+  803c96:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  803c9d:	e8 27 d2 ff ff       	call   800ec9 <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  803ca2:	83 c4 0c             	add    $0xc,%esp
+  803ca5:	68 a6 52 80 00       	push   $0x8052a6
+  803caa:	68 a5 00 00 00       	push   $0xa5
+  803caf:	68 c0 52 80 00       	push   $0x8052c0
+  803cb4:	e8 b6 c7 ff ff       	call   80046f <_panic>
+
+00803cb9 <pthread_start>:
+{
+  803cb9:	55                   	push   %ebp
+  803cba:	89 e5                	mov    %esp,%ebp
+  803cbc:	53                   	push   %ebx
+  803cbd:	83 ec 04             	sub    $0x4,%esp
+  803cc0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  803cc3:	e8 4c d2 ff ff       	call   800f14 <sys_getenvid>
+  803cc8:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  803ccd:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+	if (t == 0)
+  803cd3:	85 db                	test   %ebx,%ebx
+  803cd5:	74 0c                	je     803ce3 <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803cd7:	89 d9                	mov    %ebx,%ecx
+  803cd9:	c1 e1 10             	shl    $0x10,%ecx
+  803cdc:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803ce1:	29 ca                	sub    %ecx,%edx
+  803ce3:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  803ce6:	c1 e0 04             	shl    $0x4,%eax
+  803ce9:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803cee:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  803cf0:	83 ec 0c             	sub    $0xc,%esp
+  803cf3:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803cfa:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803cfd:	ff 34 95 4c 70 80 00 	push   0x80704c(,%edx,4)
+  803d04:	ff 14 95 48 70 80 00 	call   *0x807048(,%edx,4)
+  803d0b:	89 04 24             	mov    %eax,(%esp)
+  803d0e:	e8 25 ff ff ff       	call   803c38 <pthread_exit>
+
+00803d13 <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  803d13:	55                   	push   %ebp
+  803d14:	89 e5                	mov    %esp,%ebp
+  803d16:	57                   	push   %edi
+  803d17:	56                   	push   %esi
+  803d18:	53                   	push   %ebx
+  803d19:	83 ec 1c             	sub    $0x1c,%esp
+  803d1c:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803d1e:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  803d24:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803d2b:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803d30:	77 0d                	ja     803d3f <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803d32:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803d37:	29 d0                	sub    %edx,%eax
+  803d39:	c1 e8 10             	shr    $0x10,%eax
+  803d3c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  803d3f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803d44:	eb 2f                	jmp    803d75 <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  803d46:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803d4c:	8b 01                	mov    (%ecx),%eax
+  803d4e:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  803d51:	39 c2                	cmp    %eax,%edx
+  803d53:	75 14                	jne    803d69 <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  803d55:	83 ec 0c             	sub    $0xc,%esp
+  803d58:	57                   	push   %edi
+  803d59:	e8 6b d1 ff ff       	call   800ec9 <sys_env_destroy>
+  803d5e:	83 c4 10             	add    $0x10,%esp
+  803d61:	85 c0                	test   %eax,%eax
+  803d63:	0f 88 97 00 00 00    	js     803e00 <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  803d69:	83 c3 01             	add    $0x1,%ebx
+  803d6c:	83 fb 20             	cmp    $0x20,%ebx
+  803d6f:	0f 84 d2 00 00 00    	je     803e47 <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  803d75:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  803d78:	74 ef                	je     803d69 <pthread_kill_others+0x56>
+  803d7a:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803d7d:	8d 04 85 40 70 80 00 	lea    0x807040(,%eax,4),%eax
+  803d84:	8b 40 04             	mov    0x4(%eax),%eax
+  803d87:	83 f8 01             	cmp    $0x1,%eax
+  803d8a:	75 dd                	jne    803d69 <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  803d8c:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803d8f:	8b 3c 85 40 70 80 00 	mov    0x807040(,%eax,4),%edi
+  803d96:	89 fe                	mov    %edi,%esi
+  803d98:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  803d9e:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803da1:	c1 e0 04             	shl    $0x4,%eax
+  803da4:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803da9:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803dac:	39 c7                	cmp    %eax,%edi
+  803dae:	75 b9                	jne    803d69 <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  803db0:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803db3:	c1 e0 04             	shl    $0x4,%eax
+  803db6:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803dbb:	8b 40 54             	mov    0x54(%eax),%eax
+  803dbe:	85 c0                	test   %eax,%eax
+  803dc0:	74 a7                	je     803d69 <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803dc2:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  803dc5:	c1 e0 04             	shl    $0x4,%eax
+  803dc8:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  803dce:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803dd0:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  803dd6:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803ddb:	0f 87 65 ff ff ff    	ja     803d46 <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803de1:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803de6:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  803de8:	c1 e8 10             	shr    $0x10,%eax
+  803deb:	0f 84 55 ff ff ff    	je     803d46 <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803df1:	c1 e0 10             	shl    $0x10,%eax
+  803df4:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  803df9:	29 c1                	sub    %eax,%ecx
+  803dfb:	e9 4c ff ff ff       	jmp    803d4c <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  803e00:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  803e03:	c1 e2 04             	shl    $0x4,%edx
+  803e06:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803e0c:	8b 52 48             	mov    0x48(%edx),%edx
+  803e0f:	39 fa                	cmp    %edi,%edx
+  803e11:	0f 85 52 ff ff ff    	jne    803d69 <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  803e17:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  803e1a:	c1 e2 04             	shl    $0x4,%edx
+  803e1d:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803e23:	8b 52 54             	mov    0x54(%edx),%edx
+  803e26:	85 d2                	test   %edx,%edx
+  803e28:	0f 84 3b ff ff ff    	je     803d69 <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  803e2e:	83 ec 0c             	sub    $0xc,%esp
+  803e31:	50                   	push   %eax
+  803e32:	57                   	push   %edi
+  803e33:	68 d0 52 80 00       	push   $0x8052d0
+  803e38:	68 bb 00 00 00       	push   $0xbb
+  803e3d:	68 c0 52 80 00       	push   $0x8052c0
+  803e42:	e8 28 c6 ff ff       	call   80046f <_panic>
+	}
+}
+  803e47:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e4a:	5b                   	pop    %ebx
+  803e4b:	5e                   	pop    %esi
+  803e4c:	5f                   	pop    %edi
+  803e4d:	5d                   	pop    %ebp
+  803e4e:	c3                   	ret
+
+00803e4f <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  803e4f:	55                   	push   %ebp
+  803e50:	89 e5                	mov    %esp,%ebp
+  803e52:	53                   	push   %ebx
+  803e53:	83 ec 04             	sub    $0x4,%esp
+  803e56:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803e58:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  803e5e:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803e64:	0f 87 85 00 00 00    	ja     803eef <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803e6a:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  803e6f:	29 c3                	sub    %eax,%ebx
+  803e71:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  803e74:	83 ec 04             	sub    $0x4,%esp
+  803e77:	68 80 02 00 00       	push   $0x280
+  803e7c:	6a 00                	push   $0x0
+  803e7e:	68 40 70 80 00       	push   $0x807040
+  803e83:	e8 f7 cd ff ff       	call   800c7f <memset>
+	threads_mu.m_state = 0;
+  803e88:	c7 05 20 70 80 00 00 	movl   $0x0,0x807020
+  803e8f:	00 00 00 
+	if (self != 0) {
+  803e92:	83 c4 10             	add    $0x10,%esp
+  803e95:	85 db                	test   %ebx,%ebx
+  803e97:	74 51                	je     803eea <pthread_fork_child+0x9b>
+  803e99:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803e9b:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803ea1:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803ea6:	77 18                	ja     803ec0 <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803ea8:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803ead:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803eaf:	c1 e8 10             	shr    $0x10,%eax
+  803eb2:	74 0c                	je     803ec0 <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803eb4:	c1 e0 10             	shl    $0x10,%eax
+  803eb7:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803ebc:	29 c2                	sub    %eax,%edx
+  803ebe:	eb 06                	jmp    803ec6 <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  803ec0:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		threads[self].th_env = thisenv->env_id;
+  803ec6:	8b 02                	mov    (%edx),%eax
+  803ec8:	8b 48 48             	mov    0x48(%eax),%ecx
+  803ecb:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803ed2:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803ed5:	89 0c 95 40 70 80 00 	mov    %ecx,0x807040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  803edc:	8d 04 95 40 70 80 00 	lea    0x807040(,%edx,4),%eax
+  803ee3:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  803eea:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803eed:	c9                   	leave
+  803eee:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  803eef:	83 ec 04             	sub    $0x4,%esp
+  803ef2:	68 80 02 00 00       	push   $0x280
+  803ef7:	6a 00                	push   $0x0
+  803ef9:	68 40 70 80 00       	push   $0x807040
+  803efe:	e8 7c cd ff ff       	call   800c7f <memset>
+	threads_mu.m_state = 0;
+  803f03:	c7 05 20 70 80 00 00 	movl   $0x0,0x807020
+  803f0a:	00 00 00 
+  803f0d:	83 c4 10             	add    $0x10,%esp
+  803f10:	eb d8                	jmp    803eea <pthread_fork_child+0x9b>
+
+00803f12 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803f12:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f17:	c3                   	ret
+
+00803f18 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803f18:	55                   	push   %ebp
+  803f19:	89 e5                	mov    %esp,%ebp
+  803f1b:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803f1e:	68 f5 52 80 00       	push   $0x8052f5
+  803f23:	ff 75 0c             	push   0xc(%ebp)
+  803f26:	e8 03 cc ff ff       	call   800b2e <strcpy>
+	return 0;
+}
+  803f2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f30:	c9                   	leave
+  803f31:	c3                   	ret
+
+00803f32 <devcons_write>:
+{
+  803f32:	55                   	push   %ebp
+  803f33:	89 e5                	mov    %esp,%ebp
+  803f35:	57                   	push   %edi
+  803f36:	56                   	push   %esi
+  803f37:	53                   	push   %ebx
+  803f38:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803f3e:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803f43:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803f49:	eb 2e                	jmp    803f79 <devcons_write+0x47>
+		m = n - tot;
+  803f4b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803f4e:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803f50:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803f55:	39 c3                	cmp    %eax,%ebx
+  803f57:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803f5a:	83 ec 04             	sub    $0x4,%esp
+  803f5d:	53                   	push   %ebx
+  803f5e:	89 f0                	mov    %esi,%eax
+  803f60:	03 45 0c             	add    0xc(%ebp),%eax
+  803f63:	50                   	push   %eax
+  803f64:	57                   	push   %edi
+  803f65:	e8 4a cd ff ff       	call   800cb4 <memmove>
+		sys_cputs(buf, m);
+  803f6a:	83 c4 08             	add    $0x8,%esp
+  803f6d:	53                   	push   %ebx
+  803f6e:	57                   	push   %edi
+  803f6f:	e8 fe ce ff ff       	call   800e72 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803f74:	01 de                	add    %ebx,%esi
+  803f76:	83 c4 10             	add    $0x10,%esp
+  803f79:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803f7c:	72 cd                	jb     803f4b <devcons_write+0x19>
+}
+  803f7e:	89 f0                	mov    %esi,%eax
+  803f80:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803f83:	5b                   	pop    %ebx
+  803f84:	5e                   	pop    %esi
+  803f85:	5f                   	pop    %edi
+  803f86:	5d                   	pop    %ebp
+  803f87:	c3                   	ret
+
+00803f88 <devcons_read>:
+{
+  803f88:	55                   	push   %ebp
+  803f89:	89 e5                	mov    %esp,%ebp
+  803f8b:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  803f8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f93:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803f97:	75 07                	jne    803fa0 <devcons_read+0x18>
+  803f99:	eb 1f                	jmp    803fba <devcons_read+0x32>
+		sys_yield();
+  803f9b:	e8 a0 cf ff ff       	call   800f40 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  803fa0:	e8 f8 ce ff ff       	call   800e9d <sys_cgetc>
+  803fa5:	85 c0                	test   %eax,%eax
+  803fa7:	74 f2                	je     803f9b <devcons_read+0x13>
+	if (c < 0)
+  803fa9:	78 0f                	js     803fba <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  803fab:	83 f8 04             	cmp    $0x4,%eax
+  803fae:	74 0c                	je     803fbc <devcons_read+0x34>
+	*(char*)vbuf = c;
+  803fb0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803fb3:	88 02                	mov    %al,(%edx)
+	return 1;
+  803fb5:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803fba:	c9                   	leave
+  803fbb:	c3                   	ret
+		return 0;
+  803fbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fc1:	eb f7                	jmp    803fba <devcons_read+0x32>
+
+00803fc3 <cputchar>:
+{
+  803fc3:	55                   	push   %ebp
+  803fc4:	89 e5                	mov    %esp,%ebp
+  803fc6:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803fc9:	8b 45 08             	mov    0x8(%ebp),%eax
+  803fcc:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803fcf:	6a 01                	push   $0x1
+  803fd1:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803fd4:	50                   	push   %eax
+  803fd5:	e8 98 ce ff ff       	call   800e72 <sys_cputs>
+}
+  803fda:	83 c4 10             	add    $0x10,%esp
+  803fdd:	c9                   	leave
+  803fde:	c3                   	ret
+
+00803fdf <getchar>:
+{
+  803fdf:	55                   	push   %ebp
+  803fe0:	89 e5                	mov    %esp,%ebp
+  803fe2:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803fe5:	6a 01                	push   $0x1
+  803fe7:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803fea:	50                   	push   %eax
+  803feb:	6a 00                	push   $0x0
+  803fed:	e8 29 d7 ff ff       	call   80171b <read>
+	if (r < 0)
+  803ff2:	83 c4 10             	add    $0x10,%esp
+  803ff5:	85 c0                	test   %eax,%eax
+  803ff7:	78 06                	js     803fff <getchar+0x20>
+	if (r < 1)
+  803ff9:	74 06                	je     804001 <getchar+0x22>
+	return c;
+  803ffb:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803fff:	c9                   	leave
+  804000:	c3                   	ret
+		return -E_EOF;
+  804001:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804006:	eb f7                	jmp    803fff <getchar+0x20>
+
+00804008 <iscons>:
+{
+  804008:	55                   	push   %ebp
+  804009:	89 e5                	mov    %esp,%ebp
+  80400b:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80400e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804011:	50                   	push   %eax
+  804012:	ff 75 08             	push   0x8(%ebp)
+  804015:	e8 71 d4 ff ff       	call   80148b <fd_lookup>
+  80401a:	83 c4 10             	add    $0x10,%esp
+  80401d:	85 c0                	test   %eax,%eax
+  80401f:	78 11                	js     804032 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  804021:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804024:	8b 15 98 62 80 00    	mov    0x806298,%edx
+  80402a:	39 10                	cmp    %edx,(%eax)
+  80402c:	0f 94 c0             	sete   %al
+  80402f:	0f b6 c0             	movzbl %al,%eax
+}
+  804032:	c9                   	leave
+  804033:	c3                   	ret
+
+00804034 <opencons>:
+{
+  804034:	55                   	push   %ebp
+  804035:	89 e5                	mov    %esp,%ebp
+  804037:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80403a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80403d:	50                   	push   %eax
+  80403e:	e8 f2 d3 ff ff       	call   801435 <fd_alloc>
+  804043:	83 c4 10             	add    $0x10,%esp
+  804046:	85 c0                	test   %eax,%eax
+  804048:	78 3a                	js     804084 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80404a:	83 ec 04             	sub    $0x4,%esp
+  80404d:	68 07 04 00 00       	push   $0x407
+  804052:	ff 75 f4             	push   -0xc(%ebp)
+  804055:	6a 00                	push   $0x0
+  804057:	e8 10 cf ff ff       	call   800f6c <sys_page_alloc>
+  80405c:	83 c4 10             	add    $0x10,%esp
+  80405f:	85 c0                	test   %eax,%eax
+  804061:	78 21                	js     804084 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  804063:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804066:	8b 15 98 62 80 00    	mov    0x806298,%edx
+  80406c:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80406e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804071:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  804078:	83 ec 0c             	sub    $0xc,%esp
+  80407b:	50                   	push   %eax
+  80407c:	e8 8d d3 ff ff       	call   80140e <fd2num>
+  804081:	83 c4 10             	add    $0x10,%esp
+}
+  804084:	c9                   	leave
+  804085:	c3                   	ret
+
+00804086 <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  804086:	55                   	push   %ebp
+  804087:	89 e5                	mov    %esp,%ebp
+  804089:	57                   	push   %edi
+  80408a:	56                   	push   %esi
+  80408b:	53                   	push   %ebx
+  80408c:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  80408f:	89 d6                	mov    %edx,%esi
+  804091:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  804094:	89 cf                	mov    %ecx,%edi
+  804096:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  804099:	89 fa                	mov    %edi,%edx
+  80409b:	80 ce 08             	or     $0x8,%dh
+  80409e:	f6 c5 08             	test   $0x8,%ch
+  8040a1:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  8040a4:	57                   	push   %edi
+  8040a5:	56                   	push   %esi
+  8040a6:	50                   	push   %eax
+  8040a7:	56                   	push   %esi
+  8040a8:	6a 00                	push   $0x0
+  8040aa:	e8 0a cf ff ff       	call   800fb9 <sys_page_map>
+	if (r < 0) {
+  8040af:	83 c4 20             	add    $0x20,%esp
+  8040b2:	85 c0                	test   %eax,%eax
+  8040b4:	78 27                	js     8040dd <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  8040b6:	83 ec 0c             	sub    $0xc,%esp
+  8040b9:	57                   	push   %edi
+  8040ba:	56                   	push   %esi
+  8040bb:	6a 00                	push   $0x0
+  8040bd:	56                   	push   %esi
+  8040be:	6a 00                	push   $0x0
+  8040c0:	e8 f4 ce ff ff       	call   800fb9 <sys_page_map>
+  8040c5:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  8040c7:	83 c4 20             	add    $0x20,%esp
+  8040ca:	85 c0                	test   %eax,%eax
+  8040cc:	78 24                	js     8040f2 <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  8040ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8040d3:	89 d8                	mov    %ebx,%eax
+  8040d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8040d8:	5b                   	pop    %ebx
+  8040d9:	5e                   	pop    %esi
+  8040da:	5f                   	pop    %edi
+  8040db:	5d                   	pop    %ebp
+  8040dc:	c3                   	ret
+  8040dd:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  8040df:	83 ec 08             	sub    $0x8,%esp
+  8040e2:	50                   	push   %eax
+  8040e3:	68 04 53 80 00       	push   $0x805304
+  8040e8:	e8 5d c4 ff ff       	call   80054a <cprintf>
+		return r;
+  8040ed:	83 c4 10             	add    $0x10,%esp
+  8040f0:	eb e1                	jmp    8040d3 <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  8040f2:	83 ec 08             	sub    $0x8,%esp
+  8040f5:	50                   	push   %eax
+  8040f6:	68 34 53 80 00       	push   $0x805334
+  8040fb:	e8 4a c4 ff ff       	call   80054a <cprintf>
+		return r;
+  804100:	83 c4 10             	add    $0x10,%esp
+  804103:	eb ce                	jmp    8040d3 <duppage_cow+0x4d>
+
+00804105 <duppage>:
+{
+  804105:	55                   	push   %ebp
+  804106:	89 e5                	mov    %esp,%ebp
+  804108:	53                   	push   %ebx
+  804109:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  80410c:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  80410f:	51                   	push   %ecx
+  804110:	52                   	push   %edx
+  804111:	50                   	push   %eax
+  804112:	52                   	push   %edx
+  804113:	6a 00                	push   $0x0
+  804115:	e8 9f ce ff ff       	call   800fb9 <sys_page_map>
+	if (r < 0) {
+  80411a:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  80411d:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  804122:	85 c0                	test   %eax,%eax
+  804124:	78 07                	js     80412d <duppage+0x28>
+}
+  804126:	89 d8                	mov    %ebx,%eax
+  804128:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80412b:	c9                   	leave
+  80412c:	c3                   	ret
+  80412d:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  80412f:	83 ec 08             	sub    $0x8,%esp
+  804132:	50                   	push   %eax
+  804133:	68 04 53 80 00       	push   $0x805304
+  804138:	e8 0d c4 ff ff       	call   80054a <cprintf>
+		return r;
+  80413d:	83 c4 10             	add    $0x10,%esp
+  804140:	eb e4                	jmp    804126 <duppage+0x21>
+
+00804142 <cow_copy>:
+{
+  804142:	55                   	push   %ebp
+  804143:	89 e5                	mov    %esp,%ebp
+  804145:	56                   	push   %esi
+  804146:	53                   	push   %ebx
+  804147:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  804149:	83 ec 04             	sub    $0x4,%esp
+  80414c:	6a 07                	push   $0x7
+  80414e:	68 00 f0 7f 00       	push   $0x7ff000
+  804153:	6a 00                	push   $0x0
+  804155:	e8 12 ce ff ff       	call   800f6c <sys_page_alloc>
+	if (r < 0) {
+  80415a:	83 c4 10             	add    $0x10,%esp
+  80415d:	85 c0                	test   %eax,%eax
+  80415f:	78 58                	js     8041b9 <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  804161:	83 ec 04             	sub    $0x4,%esp
+  804164:	68 00 10 00 00       	push   $0x1000
+  804169:	56                   	push   %esi
+  80416a:	68 00 f0 7f 00       	push   $0x7ff000
+  80416f:	e8 40 cb ff ff       	call   800cb4 <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  804174:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80417b:	56                   	push   %esi
+  80417c:	6a 00                	push   $0x0
+  80417e:	68 00 f0 7f 00       	push   $0x7ff000
+  804183:	6a 00                	push   $0x0
+  804185:	e8 2f ce ff ff       	call   800fb9 <sys_page_map>
+  80418a:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  80418c:	83 c4 20             	add    $0x20,%esp
+  80418f:	85 c0                	test   %eax,%eax
+  804191:	78 3b                	js     8041ce <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  804193:	83 ec 08             	sub    $0x8,%esp
+  804196:	68 00 f0 7f 00       	push   $0x7ff000
+  80419b:	6a 00                	push   $0x0
+  80419d:	e8 63 ce ff ff       	call   801005 <sys_page_unmap>
+  8041a2:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  8041a4:	83 c4 10             	add    $0x10,%esp
+  8041a7:	85 c0                	test   %eax,%eax
+  8041a9:	78 45                	js     8041f0 <cow_copy+0xae>
+	return 0;
+  8041ab:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8041b0:	89 d8                	mov    %ebx,%eax
+  8041b2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8041b5:	5b                   	pop    %ebx
+  8041b6:	5e                   	pop    %esi
+  8041b7:	5d                   	pop    %ebp
+  8041b8:	c3                   	ret
+  8041b9:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  8041bb:	83 ec 08             	sub    $0x8,%esp
+  8041be:	50                   	push   %eax
+  8041bf:	68 24 54 80 00       	push   $0x805424
+  8041c4:	e8 81 c3 ff ff       	call   80054a <cprintf>
+		return r;
+  8041c9:	83 c4 10             	add    $0x10,%esp
+  8041cc:	eb e2                	jmp    8041b0 <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  8041ce:	83 ec 08             	sub    $0x8,%esp
+  8041d1:	50                   	push   %eax
+  8041d2:	68 40 54 80 00       	push   $0x805440
+  8041d7:	e8 6e c3 ff ff       	call   80054a <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  8041dc:	83 c4 08             	add    $0x8,%esp
+  8041df:	68 00 f0 7f 00       	push   $0x7ff000
+  8041e4:	6a 00                	push   $0x0
+  8041e6:	e8 1a ce ff ff       	call   801005 <sys_page_unmap>
+		return r;
+  8041eb:	83 c4 10             	add    $0x10,%esp
+  8041ee:	eb c0                	jmp    8041b0 <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  8041f0:	83 ec 08             	sub    $0x8,%esp
+  8041f3:	50                   	push   %eax
+  8041f4:	68 5c 53 80 00       	push   $0x80535c
+  8041f9:	e8 4c c3 ff ff       	call   80054a <cprintf>
+		return r;
+  8041fe:	83 c4 10             	add    $0x10,%esp
+  804201:	eb ad                	jmp    8041b0 <cow_copy+0x6e>
+
+00804203 <pgfault>:
+{
+  804203:	55                   	push   %ebp
+  804204:	89 e5                	mov    %esp,%ebp
+  804206:	56                   	push   %esi
+  804207:	53                   	push   %ebx
+  804208:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  80420b:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  80420d:	89 d8                	mov    %ebx,%eax
+  80420f:	c1 e8 16             	shr    $0x16,%eax
+  804212:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  804219:	89 de                	mov    %ebx,%esi
+  80421b:	c1 ee 0c             	shr    $0xc,%esi
+  80421e:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  804225:	a8 07                	test   $0x7,%al
+  804227:	74 3b                	je     804264 <pgfault+0x61>
+  804229:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  80422f:	74 33                	je     804264 <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  804231:	83 ec 0c             	sub    $0xc,%esp
+  804234:	68 00 f0 bf ee       	push   $0xeebff000
+  804239:	e8 8e f3 ff ff       	call   8035cc <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  80423e:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  804245:	83 c4 10             	add    $0x10,%esp
+  804248:	f6 c4 08             	test   $0x8,%ah
+  80424b:	75 30                	jne    80427d <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  80424d:	83 ec 0c             	sub    $0xc,%esp
+  804250:	68 00 f0 bf ee       	push   $0xeebff000
+  804255:	e8 df f3 ff ff       	call   803639 <mutex_unlock>
+}
+  80425a:	83 c4 10             	add    $0x10,%esp
+  80425d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804260:	5b                   	pop    %ebx
+  804261:	5e                   	pop    %esi
+  804262:	5d                   	pop    %ebp
+  804263:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  804264:	83 ec 08             	sub    $0x8,%esp
+  804267:	ff 72 28             	push   0x28(%edx)
+  80426a:	51                   	push   %ecx
+  80426b:	50                   	push   %eax
+  80426c:	68 80 53 80 00       	push   $0x805380
+  804271:	6a 3f                	push   $0x3f
+  804273:	68 5a 54 80 00       	push   $0x80545a
+  804278:	e8 f2 c1 ff ff       	call   80046f <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  80427d:	89 d8                	mov    %ebx,%eax
+  80427f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  804284:	e8 b9 fe ff ff       	call   804142 <cow_copy>
+  804289:	eb c2                	jmp    80424d <pgfault+0x4a>
+
+0080428b <cow_enable>:
+{
+  80428b:	55                   	push   %ebp
+  80428c:	89 e5                	mov    %esp,%ebp
+  80428e:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  804291:	68 03 42 80 00       	push   $0x804203
+  804296:	e8 28 06 00 00       	call   8048c3 <set_pgfault_handler>
+}
+  80429b:	83 c4 10             	add    $0x10,%esp
+  80429e:	c9                   	leave
+  80429f:	c3                   	ret
+
+008042a0 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  8042a0:	55                   	push   %ebp
+  8042a1:	89 e5                	mov    %esp,%ebp
+  8042a3:	57                   	push   %edi
+  8042a4:	56                   	push   %esi
+  8042a5:	53                   	push   %ebx
+  8042a6:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  8042a9:	68 03 42 80 00       	push   $0x804203
+  8042ae:	e8 10 06 00 00       	call   8048c3 <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  8042b3:	b8 07 00 00 00       	mov    $0x7,%eax
+  8042b8:	cd 30                	int    $0x30
+  8042ba:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  8042bd:	83 c4 10             	add    $0x10,%esp
+  8042c0:	85 c0                	test   %eax,%eax
+  8042c2:	78 4b                	js     80430f <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  8042c4:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8042c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8042ce:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  8042d1:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8042d5:	0f 85 16 01 00 00    	jne    8043f1 <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8042db:	e8 34 cc ff ff       	call   800f14 <sys_getenvid>
+  8042e0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8042e5:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8042e7:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  8042ed:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8042f3:	77 32                	ja     804327 <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8042f5:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  8042fa:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  8042fc:	c1 ea 10             	shr    $0x10,%edx
+  8042ff:	74 26                	je     804327 <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804301:	c1 e2 10             	shl    $0x10,%edx
+  804304:	89 d1                	mov    %edx,%ecx
+  804306:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80430b:	29 ca                	sub    %ecx,%edx
+  80430d:	eb 1e                	jmp    80432d <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  80430f:	83 ec 08             	sub    $0x8,%esp
+  804312:	89 c7                	mov    %eax,%edi
+  804314:	50                   	push   %eax
+  804315:	68 65 54 80 00       	push   $0x805465
+  80431a:	e8 2b c2 ff ff       	call   80054a <cprintf>
+		return eid;
+  80431f:	83 c4 10             	add    $0x10,%esp
+  804322:	e9 6c 01 00 00       	jmp    804493 <fork+0x1f3>
+		return pthread_main_tls;
+  804327:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80432d:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  804330:	c1 e0 04             	shl    $0x4,%eax
+  804333:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804338:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  80433a:	e8 10 fb ff ff       	call   803e4f <pthread_fork_child>
+		return eid;
+  80433f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804342:	e9 4c 01 00 00       	jmp    804493 <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  804347:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  80434d:	89 da                	mov    %ebx,%edx
+  80434f:	89 f8                	mov    %edi,%eax
+  804351:	e8 af fd ff ff       	call   804105 <duppage>
+  804356:	85 c0                	test   %eax,%eax
+  804358:	79 28                	jns    804382 <fork+0xe2>
+  80435a:	89 c7                	mov    %eax,%edi
+  80435c:	e9 32 01 00 00       	jmp    804493 <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  804361:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  804367:	83 f9 05             	cmp    $0x5,%ecx
+  80436a:	75 58                	jne    8043c4 <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  80436c:	b9 05 00 00 00       	mov    $0x5,%ecx
+  804371:	89 da                	mov    %ebx,%edx
+  804373:	89 f8                	mov    %edi,%eax
+  804375:	e8 8b fd ff ff       	call   804105 <duppage>
+  80437a:	85 c0                	test   %eax,%eax
+  80437c:	0f 88 0f 01 00 00    	js     804491 <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  804382:	83 c3 01             	add    $0x1,%ebx
+  804385:	39 de                	cmp    %ebx,%esi
+  804387:	74 54                	je     8043dd <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  804389:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  804390:	f6 c1 05             	test   $0x5,%cl
+  804393:	74 ed                	je     804382 <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  804395:	f6 c5 04             	test   $0x4,%ch
+  804398:	75 ad                	jne    804347 <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  80439a:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  8043a0:	74 bf                	je     804361 <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  8043a2:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8043a8:	74 d8                	je     804382 <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  8043aa:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  8043b0:	89 da                	mov    %ebx,%edx
+  8043b2:	89 f8                	mov    %edi,%eax
+  8043b4:	e8 cd fc ff ff       	call   804086 <duppage_cow>
+  8043b9:	85 c0                	test   %eax,%eax
+  8043bb:	79 c5                	jns    804382 <fork+0xe2>
+  8043bd:	89 c7                	mov    %eax,%edi
+  8043bf:	e9 cf 00 00 00       	jmp    804493 <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  8043c4:	68 b0 53 80 00       	push   $0x8053b0
+  8043c9:	68 bd 51 80 00       	push   $0x8051bd
+  8043ce:	68 c6 00 00 00       	push   $0xc6
+  8043d3:	68 5a 54 80 00       	push   $0x80545a
+  8043d8:	e8 92 c0 ff ff       	call   80046f <_panic>
+  8043dd:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  8043e0:	83 c1 01             	add    $0x1,%ecx
+  8043e3:	81 c6 00 04 00 00    	add    $0x400,%esi
+  8043e9:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  8043ef:	74 18                	je     804409 <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  8043f1:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  8043f8:	a8 07                	test   $0x7,%al
+  8043fa:	74 e4                	je     8043e0 <fork+0x140>
+  8043fc:	89 cb                	mov    %ecx,%ebx
+  8043fe:	c1 e3 0a             	shl    $0xa,%ebx
+  804401:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  804404:	e9 7c ff ff ff       	jmp    804385 <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  804409:	83 ec 04             	sub    $0x4,%esp
+  80440c:	6a 07                	push   $0x7
+  80440e:	68 00 f0 bf ee       	push   $0xeebff000
+  804413:	ff 75 e4             	push   -0x1c(%ebp)
+  804416:	e8 51 cb ff ff       	call   800f6c <sys_page_alloc>
+  80441b:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80441d:	83 c4 10             	add    $0x10,%esp
+  804420:	85 c0                	test   %eax,%eax
+  804422:	78 34                	js     804458 <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  804424:	83 ec 08             	sub    $0x8,%esp
+  804427:	68 01 49 80 00       	push   $0x804901
+  80442c:	ff 75 e4             	push   -0x1c(%ebp)
+  80442f:	e8 b5 cc ff ff       	call   8010e9 <sys_env_set_pgfault_upcall>
+  804434:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804436:	83 c4 10             	add    $0x10,%esp
+  804439:	85 c0                	test   %eax,%eax
+  80443b:	78 2e                	js     80446b <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  80443d:	83 ec 08             	sub    $0x8,%esp
+  804440:	6a 02                	push   $0x2
+  804442:	ff 75 e4             	push   -0x1c(%ebp)
+  804445:	e8 07 cc ff ff       	call   801051 <sys_env_set_status>
+  80444a:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80444c:	83 c4 10             	add    $0x10,%esp
+  80444f:	85 c0                	test   %eax,%eax
+  804451:	78 2b                	js     80447e <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  804453:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804456:	eb 3b                	jmp    804493 <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  804458:	83 ec 08             	sub    $0x8,%esp
+  80445b:	50                   	push   %eax
+  80445c:	68 d8 53 80 00       	push   $0x8053d8
+  804461:	e8 e4 c0 ff ff       	call   80054a <cprintf>
+		return r;
+  804466:	83 c4 10             	add    $0x10,%esp
+  804469:	eb 28                	jmp    804493 <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  80446b:	83 ec 08             	sub    $0x8,%esp
+  80446e:	50                   	push   %eax
+  80446f:	68 00 54 80 00       	push   $0x805400
+  804474:	e8 d1 c0 ff ff       	call   80054a <cprintf>
+		return r;
+  804479:	83 c4 10             	add    $0x10,%esp
+  80447c:	eb 15                	jmp    804493 <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  80447e:	83 ec 08             	sub    $0x8,%esp
+  804481:	50                   	push   %eax
+  804482:	68 75 54 80 00       	push   $0x805475
+  804487:	e8 be c0 ff ff       	call   80054a <cprintf>
+		return r;
+  80448c:	83 c4 10             	add    $0x10,%esp
+  80448f:	eb 02                	jmp    804493 <fork+0x1f3>
+  804491:	89 c7                	mov    %eax,%edi
+}
+  804493:	89 f8                	mov    %edi,%eax
+  804495:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804498:	5b                   	pop    %ebx
+  804499:	5e                   	pop    %esi
+  80449a:	5f                   	pop    %edi
+  80449b:	5d                   	pop    %ebp
+  80449c:	c3                   	ret
+
+0080449d <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  80449d:	55                   	push   %ebp
+  80449e:	89 e5                	mov    %esp,%ebp
+  8044a0:	57                   	push   %edi
+  8044a1:	56                   	push   %esi
+  8044a2:	53                   	push   %ebx
+  8044a3:	83 ec 2c             	sub    $0x2c,%esp
+  8044a6:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8044a8:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  8044ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8044b3:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8044b9:	77 0a                	ja     8044c5 <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8044bb:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  8044c0:	29 c3                	sub    %eax,%ebx
+  8044c2:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  8044c5:	83 ec 0c             	sub    $0xc,%esp
+  8044c8:	68 03 42 80 00       	push   $0x804203
+  8044cd:	e8 f1 03 00 00       	call   8048c3 <set_pgfault_handler>
+  8044d2:	b8 07 00 00 00       	mov    $0x7,%eax
+  8044d7:	cd 30                	int    $0x30
+  8044d9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  8044dc:	83 c4 10             	add    $0x10,%esp
+  8044df:	85 c0                	test   %eax,%eax
+  8044e1:	78 30                	js     804513 <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  8044e3:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8044e7:	74 42                	je     80452b <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  8044e9:	c1 e3 10             	shl    $0x10,%ebx
+  8044ec:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  8044f1:	29 d8                	sub    %ebx,%eax
+  8044f3:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8044f6:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  8044fb:	29 d8                	sub    %ebx,%eax
+  8044fd:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  804500:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804505:	ba 00 00 00 00       	mov    $0x0,%edx
+  80450a:	89 f7                	mov    %esi,%edi
+  80450c:	89 d6                	mov    %edx,%esi
+  80450e:	e9 2c 01 00 00       	jmp    80463f <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  804513:	83 ec 08             	sub    $0x8,%esp
+  804516:	89 c7                	mov    %eax,%edi
+  804518:	50                   	push   %eax
+  804519:	68 65 54 80 00       	push   $0x805465
+  80451e:	e8 27 c0 ff ff       	call   80054a <cprintf>
+		return eid;
+  804523:	83 c4 10             	add    $0x10,%esp
+  804526:	e9 d5 00 00 00       	jmp    804600 <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80452b:	e8 e4 c9 ff ff       	call   800f14 <sys_getenvid>
+  804530:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804535:	89 c2                	mov    %eax,%edx
+  804537:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804539:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  80453f:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804544:	77 18                	ja     80455e <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804546:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80454b:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  80454d:	c1 e8 10             	shr    $0x10,%eax
+  804550:	74 0c                	je     80455e <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804552:	c1 e0 10             	shl    $0x10,%eax
+  804555:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80455a:	29 c1                	sub    %eax,%ecx
+  80455c:	eb 06                	jmp    804564 <sfork+0xc7>
+		return pthread_main_tls;
+  80455e:	8b 0d c0 72 80 00    	mov    0x8072c0,%ecx
+  804564:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804567:	c1 e0 04             	shl    $0x4,%eax
+  80456a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80456f:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  804571:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  804574:	e9 87 00 00 00       	jmp    804600 <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  804579:	f6 c5 04             	test   $0x4,%ch
+  80457c:	74 6c                	je     8045ea <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  80457e:	89 ca                	mov    %ecx,%edx
+  804580:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  804586:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  80458c:	74 7c                	je     80460a <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  80458e:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  804594:	89 da                	mov    %ebx,%edx
+  804596:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804599:	e8 67 fb ff ff       	call   804105 <duppage>
+  80459e:	85 c0                	test   %eax,%eax
+  8045a0:	0f 88 4f 01 00 00    	js     8046f5 <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  8045a6:	83 c3 01             	add    $0x1,%ebx
+  8045a9:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  8045ac:	74 7a                	je     804628 <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  8045ae:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  8045b0:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  8045b7:	f6 c1 01             	test   $0x1,%cl
+  8045ba:	74 ea                	je     8045a6 <sfork+0x109>
+  8045bc:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8045c2:	74 e2                	je     8045a6 <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  8045c4:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  8045ca:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  8045cd:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  8045d2:	76 a5                	jbe    804579 <sfork+0xdc>
+  8045d4:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  8045da:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8045dd:	39 fa                	cmp    %edi,%edx
+  8045df:	73 9d                	jae    80457e <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  8045e1:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  8045e4:	39 fa                	cmp    %edi,%edx
+  8045e6:	72 96                	jb     80457e <sfork+0xe1>
+  8045e8:	eb 8f                	jmp    804579 <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8045ea:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8045f0:	89 da                	mov    %ebx,%edx
+  8045f2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8045f5:	e8 8c fa ff ff       	call   804086 <duppage_cow>
+  8045fa:	85 c0                	test   %eax,%eax
+  8045fc:	79 a8                	jns    8045a6 <sfork+0x109>
+  8045fe:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  804600:	89 f8                	mov    %edi,%eax
+  804602:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804605:	5b                   	pop    %ebx
+  804606:	5e                   	pop    %esi
+  804607:	5f                   	pop    %edi
+  804608:	5d                   	pop    %ebp
+  804609:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  80460a:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  80460f:	e8 2e fb ff ff       	call   804142 <cow_copy>
+  804614:	85 c0                	test   %eax,%eax
+  804616:	0f 88 d2 00 00 00    	js     8046ee <sfork+0x251>
+				pte = uvpt[pn];
+  80461c:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  804623:	e9 66 ff ff ff       	jmp    80458e <sfork+0xf1>
+  804628:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80462b:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80462e:	83 c6 01             	add    $0x1,%esi
+  804631:	81 c7 00 04 00 00    	add    $0x400,%edi
+  804637:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  80463d:	74 1b                	je     80465a <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  80463f:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  804646:	a8 01                	test   $0x1,%al
+  804648:	74 e4                	je     80462e <sfork+0x191>
+  80464a:	89 f3                	mov    %esi,%ebx
+  80464c:	c1 e3 0a             	shl    $0xa,%ebx
+  80464f:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  804652:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  804655:	e9 4f ff ff ff       	jmp    8045a9 <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  80465a:	83 ec 04             	sub    $0x4,%esp
+  80465d:	6a 07                	push   $0x7
+  80465f:	68 00 f0 bf ee       	push   $0xeebff000
+  804664:	ff 75 e0             	push   -0x20(%ebp)
+  804667:	e8 00 c9 ff ff       	call   800f6c <sys_page_alloc>
+  80466c:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80466e:	83 c4 10             	add    $0x10,%esp
+  804671:	85 c0                	test   %eax,%eax
+  804673:	78 37                	js     8046ac <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  804675:	83 ec 08             	sub    $0x8,%esp
+  804678:	68 01 49 80 00       	push   $0x804901
+  80467d:	ff 75 e0             	push   -0x20(%ebp)
+  804680:	e8 64 ca ff ff       	call   8010e9 <sys_env_set_pgfault_upcall>
+  804685:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804687:	83 c4 10             	add    $0x10,%esp
+  80468a:	85 c0                	test   %eax,%eax
+  80468c:	78 34                	js     8046c2 <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  80468e:	83 ec 08             	sub    $0x8,%esp
+  804691:	6a 02                	push   $0x2
+  804693:	ff 75 e0             	push   -0x20(%ebp)
+  804696:	e8 b6 c9 ff ff       	call   801051 <sys_env_set_status>
+  80469b:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80469d:	83 c4 10             	add    $0x10,%esp
+  8046a0:	85 c0                	test   %eax,%eax
+  8046a2:	78 34                	js     8046d8 <sfork+0x23b>
+	return eid;
+  8046a4:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8046a7:	e9 54 ff ff ff       	jmp    804600 <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  8046ac:	83 ec 08             	sub    $0x8,%esp
+  8046af:	50                   	push   %eax
+  8046b0:	68 d8 53 80 00       	push   $0x8053d8
+  8046b5:	e8 90 be ff ff       	call   80054a <cprintf>
+		return r;
+  8046ba:	83 c4 10             	add    $0x10,%esp
+  8046bd:	e9 3e ff ff ff       	jmp    804600 <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  8046c2:	83 ec 08             	sub    $0x8,%esp
+  8046c5:	50                   	push   %eax
+  8046c6:	68 00 54 80 00       	push   $0x805400
+  8046cb:	e8 7a be ff ff       	call   80054a <cprintf>
+		return r;
+  8046d0:	83 c4 10             	add    $0x10,%esp
+  8046d3:	e9 28 ff ff ff       	jmp    804600 <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  8046d8:	83 ec 08             	sub    $0x8,%esp
+  8046db:	50                   	push   %eax
+  8046dc:	68 75 54 80 00       	push   $0x805475
+  8046e1:	e8 64 be ff ff       	call   80054a <cprintf>
+		return r;
+  8046e6:	83 c4 10             	add    $0x10,%esp
+  8046e9:	e9 12 ff ff ff       	jmp    804600 <sfork+0x163>
+  8046ee:	89 c7                	mov    %eax,%edi
+  8046f0:	e9 0b ff ff ff       	jmp    804600 <sfork+0x163>
+  8046f5:	89 c7                	mov    %eax,%edi
+  8046f7:	e9 04 ff ff ff       	jmp    804600 <sfork+0x163>
+
+008046fc <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8046fc:	55                   	push   %ebp
+  8046fd:	89 e5                	mov    %esp,%ebp
+  8046ff:	57                   	push   %edi
+  804700:	56                   	push   %esi
+  804701:	53                   	push   %ebx
+  804702:	83 ec 18             	sub    $0x18,%esp
+  804705:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804708:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80470b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  80470e:	85 c0                	test   %eax,%eax
+  804710:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804715:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  804718:	50                   	push   %eax
+  804719:	e8 44 ca ff ff       	call   801162 <sys_ipc_recv>
+	if (r < 0) {
+  80471e:	83 c4 10             	add    $0x10,%esp
+  804721:	85 c0                	test   %eax,%eax
+  804723:	78 2b                	js     804750 <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  804725:	85 ff                	test   %edi,%edi
+  804727:	74 55                	je     80477e <ipc_recv+0x82>
+  804729:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80472b:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804731:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804736:	77 39                	ja     804771 <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804738:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80473d:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80473f:	c1 e8 10             	shr    $0x10,%eax
+  804742:	74 2d                	je     804771 <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804744:	c1 e0 10             	shl    $0x10,%eax
+  804747:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80474c:	29 c2                	sub    %eax,%edx
+  80474e:	eb 27                	jmp    804777 <ipc_recv+0x7b>
+  804750:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  804752:	83 ec 08             	sub    $0x8,%esp
+  804755:	50                   	push   %eax
+  804756:	68 93 54 80 00       	push   $0x805493
+  80475b:	e8 ea bd ff ff       	call   80054a <cprintf>
+		*from_env_store = 0;
+  804760:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  804766:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  80476c:	83 c4 10             	add    $0x10,%esp
+  80476f:	eb 77                	jmp    8047e8 <ipc_recv+0xec>
+		return pthread_main_tls;
+  804771:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  804777:	8b 02                	mov    (%edx),%eax
+  804779:	8b 40 78             	mov    0x78(%eax),%eax
+  80477c:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  80477e:	85 f6                	test   %esi,%esi
+  804780:	74 34                	je     8047b6 <ipc_recv+0xba>
+  804782:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804784:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80478a:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80478f:	77 18                	ja     8047a9 <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804791:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  804796:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  804798:	c1 e8 10             	shr    $0x10,%eax
+  80479b:	74 0c                	je     8047a9 <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80479d:	c1 e0 10             	shl    $0x10,%eax
+  8047a0:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8047a5:	29 c2                	sub    %eax,%edx
+  8047a7:	eb 06                	jmp    8047af <ipc_recv+0xb3>
+		return pthread_main_tls;
+  8047a9:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  8047af:	8b 02                	mov    (%edx),%eax
+  8047b1:	8b 40 7c             	mov    0x7c(%eax),%eax
+  8047b4:	89 06                	mov    %eax,(%esi)
+  8047b6:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8047b8:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8047be:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8047c3:	77 18                	ja     8047dd <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8047c5:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8047ca:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8047cc:	c1 e8 10             	shr    $0x10,%eax
+  8047cf:	74 0c                	je     8047dd <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8047d1:	c1 e0 10             	shl    $0x10,%eax
+  8047d4:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8047d9:	29 c2                	sub    %eax,%edx
+  8047db:	eb 06                	jmp    8047e3 <ipc_recv+0xe7>
+		return pthread_main_tls;
+  8047dd:	8b 15 c0 72 80 00    	mov    0x8072c0,%edx
+	}
+	return thisenv->env_ipc_value;
+  8047e3:	8b 02                	mov    (%edx),%eax
+  8047e5:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  8047e8:	89 d8                	mov    %ebx,%eax
+  8047ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8047ed:	5b                   	pop    %ebx
+  8047ee:	5e                   	pop    %esi
+  8047ef:	5f                   	pop    %edi
+  8047f0:	5d                   	pop    %ebp
+  8047f1:	c3                   	ret
+
+008047f2 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8047f2:	55                   	push   %ebp
+  8047f3:	89 e5                	mov    %esp,%ebp
+  8047f5:	57                   	push   %edi
+  8047f6:	56                   	push   %esi
+  8047f7:	53                   	push   %ebx
+  8047f8:	83 ec 0c             	sub    $0xc,%esp
+  8047fb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8047fe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804801:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  804804:	85 db                	test   %ebx,%ebx
+  804806:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80480b:	0f 44 d8             	cmove  %eax,%ebx
+  80480e:	eb 05                	jmp    804815 <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  804810:	e8 2b c7 ff ff       	call   800f40 <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  804815:	57                   	push   %edi
+  804816:	53                   	push   %ebx
+  804817:	ff 75 0c             	push   0xc(%ebp)
+  80481a:	56                   	push   %esi
+  80481b:	e8 15 c9 ff ff       	call   801135 <sys_ipc_try_send>
+		if (r == 0) {
+  804820:	83 c4 10             	add    $0x10,%esp
+  804823:	85 c0                	test   %eax,%eax
+  804825:	74 19                	je     804840 <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  804827:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80482a:	74 e4                	je     804810 <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  80482c:	83 ec 0c             	sub    $0xc,%esp
+  80482f:	50                   	push   %eax
+  804830:	57                   	push   %edi
+  804831:	53                   	push   %ebx
+  804832:	56                   	push   %esi
+  804833:	68 ac 54 80 00       	push   $0x8054ac
+  804838:	e8 0d bd ff ff       	call   80054a <cprintf>
+			return;
+  80483d:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  804840:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804843:	5b                   	pop    %ebx
+  804844:	5e                   	pop    %esi
+  804845:	5f                   	pop    %edi
+  804846:	5d                   	pop    %ebp
+  804847:	c3                   	ret
+
+00804848 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804848:	55                   	push   %ebp
+  804849:	89 e5                	mov    %esp,%ebp
+  80484b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80484e:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  804853:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804856:	c1 e0 04             	shl    $0x4,%eax
+  804859:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80485e:	8b 40 50             	mov    0x50(%eax),%eax
+  804861:	39 c8                	cmp    %ecx,%eax
+  804863:	74 12                	je     804877 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804865:	83 c2 01             	add    $0x1,%edx
+  804868:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  80486e:	75 e3                	jne    804853 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  804870:	b8 00 00 00 00       	mov    $0x0,%eax
+  804875:	eb 0e                	jmp    804885 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  804877:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80487a:	c1 e0 04             	shl    $0x4,%eax
+  80487d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804882:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  804885:	5d                   	pop    %ebp
+  804886:	c3                   	ret
+
+00804887 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804887:	55                   	push   %ebp
+  804888:	89 e5                	mov    %esp,%ebp
+  80488a:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80488d:	89 c2                	mov    %eax,%edx
+  80488f:	c1 ea 16             	shr    $0x16,%edx
+  804892:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  804899:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80489e:	f6 c1 01             	test   $0x1,%cl
+  8048a1:	74 1c                	je     8048bf <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  8048a3:	c1 e8 0c             	shr    $0xc,%eax
+  8048a6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8048ad:	a8 01                	test   $0x1,%al
+  8048af:	74 0e                	je     8048bf <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8048b1:	c1 e8 0c             	shr    $0xc,%eax
+  8048b4:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  8048bb:	ef 
+  8048bc:	0f b7 d2             	movzwl %dx,%edx
+}
+  8048bf:	89 d0                	mov    %edx,%eax
+  8048c1:	5d                   	pop    %ebp
+  8048c2:	c3                   	ret
+
+008048c3 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8048c3:	55                   	push   %ebp
+  8048c4:	89 e5                	mov    %esp,%ebp
+  8048c6:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  8048c9:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  8048d0:	74 0a                	je     8048dc <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8048d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8048d5:	a3 00 a0 80 00       	mov    %eax,0x80a000
+}
+  8048da:	c9                   	leave
+  8048db:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  8048dc:	83 ec 04             	sub    $0x4,%esp
+  8048df:	6a 07                	push   $0x7
+  8048e1:	68 00 f0 bf ee       	push   $0xeebff000
+  8048e6:	6a 00                	push   $0x0
+  8048e8:	e8 7f c6 ff ff       	call   800f6c <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8048ed:	83 c4 08             	add    $0x8,%esp
+  8048f0:	68 01 49 80 00       	push   $0x804901
+  8048f5:	6a 00                	push   $0x0
+  8048f7:	e8 ed c7 ff ff       	call   8010e9 <sys_env_set_pgfault_upcall>
+  8048fc:	83 c4 10             	add    $0x10,%esp
+  8048ff:	eb d1                	jmp    8048d2 <set_pgfault_handler+0xf>
+
+00804901 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804901:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804902:	a1 00 a0 80 00       	mov    0x80a000,%eax
+	call *%eax
+  804907:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804909:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  80490c:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  804910:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  804914:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  804917:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  80491b:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  80491d:	83 c4 08             	add    $0x8,%esp
+	popal
+  804920:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  804921:	83 c4 04             	add    $0x4,%esp
+	popfl
+  804924:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  804925:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  804926:	c3                   	ret
+
+00804927 <udm>:
+  804927:	57                   	push   %edi
+  804928:	56                   	push   %esi
+  804929:	53                   	push   %ebx
+  80492a:	83 ec 20             	sub    $0x20,%esp
+  80492d:	89 44 24 10          	mov    %eax,0x10(%esp)
+  804931:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804935:	8b 44 24 30          	mov    0x30(%esp),%eax
+  804939:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80493d:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804941:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804945:	89 d1                	mov    %edx,%ecx
+  804947:	09 c1                	or     %eax,%ecx
+  804949:	0f 84 91 00 00 00    	je     8049e0 <udm+0xb9>
+  80494f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804954:	ba 00 00 00 00       	mov    $0x0,%edx
+  804959:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80495e:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804965:	00 
+  804966:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80496d:	00 
+  80496e:	eb 08                	jmp    804978 <udm+0x51>
+  804970:	83 e9 01             	sub    $0x1,%ecx
+  804973:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  804976:	74 7c                	je     8049f4 <udm+0xcd>
+  804978:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80497c:	01 c0                	add    %eax,%eax
+  80497e:	89 c6                	mov    %eax,%esi
+  804980:	89 d7                	mov    %edx,%edi
+  804982:	8b 44 24 10          	mov    0x10(%esp),%eax
+  804986:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80498a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80498d:	d3 ea                	shr    %cl,%edx
+  80498f:	f6 c1 20             	test   $0x20,%cl
+  804992:	74 04                	je     804998 <udm+0x71>
+  804994:	89 d0                	mov    %edx,%eax
+  804996:	31 d2                	xor    %edx,%edx
+  804998:	83 e0 01             	and    $0x1,%eax
+  80499b:	89 04 24             	mov    %eax,(%esp)
+  80499e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8049a5:	00 
+  8049a6:	8b 04 24             	mov    (%esp),%eax
+  8049a9:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8049ad:	09 f0                	or     %esi,%eax
+  8049af:	09 fa                	or     %edi,%edx
+  8049b1:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8049b5:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8049b9:	39 f0                	cmp    %esi,%eax
+  8049bb:	89 d3                	mov    %edx,%ebx
+  8049bd:	19 fb                	sbb    %edi,%ebx
+  8049bf:	72 af                	jb     804970 <udm+0x49>
+  8049c1:	29 f0                	sub    %esi,%eax
+  8049c3:	19 fa                	sbb    %edi,%edx
+  8049c5:	89 cf                	mov    %ecx,%edi
+  8049c7:	c1 ef 05             	shr    $0x5,%edi
+  8049ca:	83 e7 01             	and    $0x1,%edi
+  8049cd:	89 fe                	mov    %edi,%esi
+  8049cf:	83 f6 01             	xor    $0x1,%esi
+  8049d2:	d3 e6                	shl    %cl,%esi
+  8049d4:	d3 e7                	shl    %cl,%edi
+  8049d6:	09 74 24 18          	or     %esi,0x18(%esp)
+  8049da:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8049de:	eb 90                	jmp    804970 <udm+0x49>
+  8049e0:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8049e4:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8049e8:	89 f0                	mov    %esi,%eax
+  8049ea:	89 fa                	mov    %edi,%edx
+  8049ec:	89 74 24 18          	mov    %esi,0x18(%esp)
+  8049f0:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  8049f4:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  8049f8:	89 01                	mov    %eax,(%ecx)
+  8049fa:	89 51 04             	mov    %edx,0x4(%ecx)
+  8049fd:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804a01:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804a05:	83 c4 20             	add    $0x20,%esp
+  804a08:	5b                   	pop    %ebx
+  804a09:	5e                   	pop    %esi
+  804a0a:	5f                   	pop    %edi
+  804a0b:	c3                   	ret
+
+00804a0c <__udivdi3>:
+  804a0c:	83 ec 18             	sub    $0x18,%esp
+  804a0f:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804a13:	50                   	push   %eax
+  804a14:	ff 74 24 2c          	push   0x2c(%esp)
+  804a18:	ff 74 24 2c          	push   0x2c(%esp)
+  804a1c:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804a20:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804a24:	e8 fe fe ff ff       	call   804927 <udm>
+  804a29:	83 c4 24             	add    $0x24,%esp
+  804a2c:	c3                   	ret
+
+00804a2d <__umoddi3>:
+  804a2d:	83 ec 18             	sub    $0x18,%esp
+  804a30:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804a34:	50                   	push   %eax
+  804a35:	ff 74 24 2c          	push   0x2c(%esp)
+  804a39:	ff 74 24 2c          	push   0x2c(%esp)
+  804a3d:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804a41:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804a45:	e8 dd fe ff ff       	call   804927 <udm>
+  804a4a:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804a4e:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804a52:	83 c4 24             	add    $0x24,%esp
+  804a55:	c3                   	ret
+
+00804a56 <__divdi3>:
+  804a56:	56                   	push   %esi
+  804a57:	53                   	push   %ebx
+  804a58:	83 ec 14             	sub    $0x14,%esp
+  804a5b:	8b 44 24 20          	mov    0x20(%esp),%eax
+  804a5f:	8b 54 24 24          	mov    0x24(%esp),%edx
+  804a63:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  804a67:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  804a6b:	85 d2                	test   %edx,%edx
+  804a6d:	78 18                	js     804a87 <__divdi3+0x31>
+  804a6f:	85 db                	test   %ebx,%ebx
+  804a71:	78 3e                	js     804ab1 <__divdi3+0x5b>
+  804a73:	83 ec 04             	sub    $0x4,%esp
+  804a76:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804a7a:	56                   	push   %esi
+  804a7b:	53                   	push   %ebx
+  804a7c:	51                   	push   %ecx
+  804a7d:	e8 a5 fe ff ff       	call   804927 <udm>
+  804a82:	83 c4 10             	add    $0x10,%esp
+  804a85:	eb 24                	jmp    804aab <__divdi3+0x55>
+  804a87:	f7 d8                	neg    %eax
+  804a89:	83 d2 00             	adc    $0x0,%edx
+  804a8c:	f7 da                	neg    %edx
+  804a8e:	85 db                	test   %ebx,%ebx
+  804a90:	78 3a                	js     804acc <__divdi3+0x76>
+  804a92:	83 ec 04             	sub    $0x4,%esp
+  804a95:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804a99:	56                   	push   %esi
+  804a9a:	53                   	push   %ebx
+  804a9b:	51                   	push   %ecx
+  804a9c:	e8 86 fe ff ff       	call   804927 <udm>
+  804aa1:	83 c4 10             	add    $0x10,%esp
+  804aa4:	f7 d8                	neg    %eax
+  804aa6:	83 d2 00             	adc    $0x0,%edx
+  804aa9:	f7 da                	neg    %edx
+  804aab:	83 c4 14             	add    $0x14,%esp
+  804aae:	5b                   	pop    %ebx
+  804aaf:	5e                   	pop    %esi
+  804ab0:	c3                   	ret
+  804ab1:	83 ec 04             	sub    $0x4,%esp
+  804ab4:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804ab8:	56                   	push   %esi
+  804ab9:	f7 d9                	neg    %ecx
+  804abb:	83 d3 00             	adc    $0x0,%ebx
+  804abe:	f7 db                	neg    %ebx
+  804ac0:	53                   	push   %ebx
+  804ac1:	51                   	push   %ecx
+  804ac2:	e8 60 fe ff ff       	call   804927 <udm>
+  804ac7:	83 c4 10             	add    $0x10,%esp
+  804aca:	eb d8                	jmp    804aa4 <__divdi3+0x4e>
+  804acc:	83 ec 04             	sub    $0x4,%esp
+  804acf:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804ad3:	56                   	push   %esi
+  804ad4:	f7 d9                	neg    %ecx
+  804ad6:	83 d3 00             	adc    $0x0,%ebx
+  804ad9:	f7 db                	neg    %ebx
+  804adb:	53                   	push   %ebx
+  804adc:	51                   	push   %ecx
+  804add:	e8 45 fe ff ff       	call   804927 <udm>
+  804ae2:	83 c4 10             	add    $0x10,%esp
+  804ae5:	eb c4                	jmp    804aab <__divdi3+0x55>
+
+00804ae7 <__moddi3>:
+  804ae7:	55                   	push   %ebp
+  804ae8:	57                   	push   %edi
+  804ae9:	56                   	push   %esi
+  804aea:	53                   	push   %ebx
+  804aeb:	83 ec 24             	sub    $0x24,%esp
+  804aee:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804af2:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804af6:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  804afa:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  804afe:	85 d2                	test   %edx,%edx
+  804b00:	78 3b                	js     804b3d <__moddi3+0x56>
+  804b02:	83 ec 04             	sub    $0x4,%esp
+  804b05:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804b09:	56                   	push   %esi
+  804b0a:	89 ce                	mov    %ecx,%esi
+  804b0c:	f7 de                	neg    %esi
+  804b0e:	89 74 24 08          	mov    %esi,0x8(%esp)
+  804b12:	89 de                	mov    %ebx,%esi
+  804b14:	83 d6 00             	adc    $0x0,%esi
+  804b17:	f7 de                	neg    %esi
+  804b19:	89 74 24 14          	mov    %esi,0x14(%esp)
+  804b1d:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804b21:	0f 48 f1             	cmovs  %ecx,%esi
+  804b24:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  804b29:	53                   	push   %ebx
+  804b2a:	56                   	push   %esi
+  804b2b:	e8 f7 fd ff ff       	call   804927 <udm>
+  804b30:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804b34:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804b38:	83 c4 10             	add    $0x10,%esp
+  804b3b:	eb 47                	jmp    804b84 <__moddi3+0x9d>
+  804b3d:	f7 d8                	neg    %eax
+  804b3f:	83 d2 00             	adc    $0x0,%edx
+  804b42:	f7 da                	neg    %edx
+  804b44:	83 ec 04             	sub    $0x4,%esp
+  804b47:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804b4b:	56                   	push   %esi
+  804b4c:	89 cf                	mov    %ecx,%edi
+  804b4e:	f7 df                	neg    %edi
+  804b50:	89 de                	mov    %ebx,%esi
+  804b52:	83 d6 00             	adc    $0x0,%esi
+  804b55:	f7 de                	neg    %esi
+  804b57:	0f 49 cf             	cmovns %edi,%ecx
+  804b5a:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  804b5e:	0f 49 de             	cmovns %esi,%ebx
+  804b61:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  804b65:	ff 74 24 0c          	push   0xc(%esp)
+  804b69:	ff 74 24 0c          	push   0xc(%esp)
+  804b6d:	e8 b5 fd ff ff       	call   804927 <udm>
+  804b72:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804b76:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804b7a:	f7 d8                	neg    %eax
+  804b7c:	83 d2 00             	adc    $0x0,%edx
+  804b7f:	f7 da                	neg    %edx
+  804b81:	83 c4 10             	add    $0x10,%esp
+  804b84:	83 c4 24             	add    $0x24,%esp
+  804b87:	5b                   	pop    %ebx
+  804b88:	5e                   	pop    %esi
+  804b89:	5f                   	pop    %edi
+  804b8a:	5d                   	pop    %ebp
+  804b8b:	c3                   	ret
@@ -0,0 +1,9787 @@
+
+obj/user/yield.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 f5 00 00 00       	call   800126 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 0c             	sub    $0xc,%esp
+
+static inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  80003c:	89 e2                	mov    %esp,%edx
+static inline pthread_t
+pthread_self(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80003e:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  800044:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800049:	77 18                	ja     800063 <umain+0x30>
+		return 0;
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80004b:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  800050:	29 d0                	sub    %edx,%eax
+}
+
+static inline struct pthread_tls *
+pthread_tls(pthread_t t)
+{
+	if (t == 0)
+  800052:	c1 e8 10             	shr    $0x10,%eax
+  800055:	74 0c                	je     800063 <umain+0x30>
+		return pthread_main_tls;
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800057:	c1 e0 10             	shl    $0x10,%eax
+  80005a:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80005f:	29 c2                	sub    %eax,%edx
+  800061:	eb 06                	jmp    800069 <umain+0x36>
+		return pthread_main_tls;
+  800063:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	int i;
+
+	cprintf("Hello, I am environment %08x.\n", thisenv->env_id);
+  800069:	8b 02                	mov    (%edx),%eax
+  80006b:	8b 40 48             	mov    0x48(%eax),%eax
+  80006e:	83 ec 08             	sub    $0x8,%esp
+  800071:	50                   	push   %eax
+  800072:	68 c0 47 80 00       	push   $0x8047c0
+  800077:	e8 e2 01 00 00       	call   80025e <cprintf>
+  80007c:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < 5; i++) {
+  80007f:	bb 00 00 00 00       	mov    $0x0,%ebx
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800084:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800089:	bf fc bf bf ee       	mov    $0xeebfbffc,%edi
+  80008e:	eb 25                	jmp    8000b5 <umain+0x82>
+		return pthread_main_tls;
+  800090:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		sys_yield();
+		cprintf("Back in environment %08x, iteration %d.\n",
+			thisenv->env_id, i);
+  800096:	8b 02                	mov    (%edx),%eax
+  800098:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("Back in environment %08x, iteration %d.\n",
+  80009b:	83 ec 04             	sub    $0x4,%esp
+  80009e:	53                   	push   %ebx
+  80009f:	50                   	push   %eax
+  8000a0:	68 e0 47 80 00       	push   $0x8047e0
+  8000a5:	e8 b4 01 00 00       	call   80025e <cprintf>
+	for (i = 0; i < 5; i++) {
+  8000aa:	83 c3 01             	add    $0x1,%ebx
+  8000ad:	83 c4 10             	add    $0x10,%esp
+  8000b0:	83 fb 05             	cmp    $0x5,%ebx
+  8000b3:	74 26                	je     8000db <umain+0xa8>
+		sys_yield();
+  8000b5:	e8 9a 0b 00 00       	call   800c54 <sys_yield>
+  8000ba:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8000bc:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8000c2:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8000c7:	77 c7                	ja     800090 <umain+0x5d>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8000c9:	89 f0                	mov    %esi,%eax
+  8000cb:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8000cd:	c1 e8 10             	shr    $0x10,%eax
+  8000d0:	74 be                	je     800090 <umain+0x5d>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8000d2:	c1 e0 10             	shl    $0x10,%eax
+  8000d5:	89 fa                	mov    %edi,%edx
+  8000d7:	29 c2                	sub    %eax,%edx
+  8000d9:	eb bb                	jmp    800096 <umain+0x63>
+  8000db:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8000dd:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8000e3:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8000e8:	77 18                	ja     800102 <umain+0xcf>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8000ea:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8000ef:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8000f1:	c1 e8 10             	shr    $0x10,%eax
+  8000f4:	74 0c                	je     800102 <umain+0xcf>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8000f6:	c1 e0 10             	shl    $0x10,%eax
+  8000f9:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8000fe:	29 c2                	sub    %eax,%edx
+  800100:	eb 06                	jmp    800108 <umain+0xd5>
+		return pthread_main_tls;
+  800102:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	}
+	cprintf("All done in environment %08x.\n", thisenv->env_id);
+  800108:	8b 02                	mov    (%edx),%eax
+  80010a:	8b 40 48             	mov    0x48(%eax),%eax
+  80010d:	83 ec 08             	sub    $0x8,%esp
+  800110:	50                   	push   %eax
+  800111:	68 0c 48 80 00       	push   $0x80480c
+  800116:	e8 43 01 00 00       	call   80025e <cprintf>
+}
+  80011b:	83 c4 10             	add    $0x10,%esp
+  80011e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800121:	5b                   	pop    %ebx
+  800122:	5e                   	pop    %esi
+  800123:	5f                   	pop    %edi
+  800124:	5d                   	pop    %ebp
+  800125:	c3                   	ret
+
+00800126 <libmain>:
+struct pthread_tls *pthread_main_tls;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800126:	55                   	push   %ebp
+  800127:	89 e5                	mov    %esp,%ebp
+  800129:	57                   	push   %edi
+  80012a:	56                   	push   %esi
+  80012b:	53                   	push   %ebx
+  80012c:	83 ec 1c             	sub    $0x1c,%esp
+  80012f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800132:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	envid_t eid = sys_getenvid();
+  800135:	e8 ee 0a 00 00       	call   800c28 <sys_getenvid>
+	struct pthread_tls tls;
+
+	pthread_main_tls = &tls;
+  80013a:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  80013d:	89 15 c0 62 80 00    	mov    %edx,0x8062c0
+	thisenv = &envs[ENVX(eid)];
+  800143:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800148:	89 c1                	mov    %eax,%ecx
+  80014a:	89 e7                	mov    %esp,%edi
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80014c:	8d 87 00 20 60 11    	lea    0x11602000(%edi),%eax
+  800152:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  800157:	77 16                	ja     80016f <libmain+0x49>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  800159:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80015e:	29 f8                	sub    %edi,%eax
+	if (t == 0)
+  800160:	c1 e8 10             	shr    $0x10,%eax
+  800163:	74 0a                	je     80016f <libmain+0x49>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  800165:	c1 e0 10             	shl    $0x10,%eax
+  800168:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80016d:	29 c2                	sub    %eax,%edx
+  80016f:	8d 04 c9             	lea    (%ecx,%ecx,8),%eax
+  800172:	c1 e0 04             	shl    $0x4,%eax
+  800175:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80017a:	89 02                	mov    %eax,(%edx)
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80017c:	85 db                	test   %ebx,%ebx
+  80017e:	7e 07                	jle    800187 <libmain+0x61>
+		binaryname = argv[0];
+  800180:	8b 06                	mov    (%esi),%eax
+  800182:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  800187:	83 ec 08             	sub    $0x8,%esp
+  80018a:	56                   	push   %esi
+  80018b:	53                   	push   %ebx
+  80018c:	e8 a2 fe ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800191:	e8 0b 00 00 00       	call   8001a1 <exit>
+}
+  800196:	83 c4 10             	add    $0x10,%esp
+  800199:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80019c:	5b                   	pop    %ebx
+  80019d:	5e                   	pop    %esi
+  80019e:	5f                   	pop    %edi
+  80019f:	5d                   	pop    %ebp
+  8001a0:	c3                   	ret
+
+008001a1 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8001a1:	55                   	push   %ebp
+  8001a2:	89 e5                	mov    %esp,%ebp
+  8001a4:	83 ec 14             	sub    $0x14,%esp
+	fflush(0);
+  8001a7:	6a 00                	push   $0x0
+  8001a9:	e8 cf 20 00 00       	call   80227d <fflush>
+	pthread_kill_others();
+  8001ae:	e8 3a 37 00 00       	call   8038ed <pthread_kill_others>
+	close_all();
+  8001b3:	e8 68 11 00 00       	call   801320 <close_all>
+	sys_env_destroy(0);
+  8001b8:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8001bf:	e8 19 0a 00 00       	call   800bdd <sys_env_destroy>
+}
+  8001c4:	83 c4 10             	add    $0x10,%esp
+  8001c7:	c9                   	leave
+  8001c8:	c3                   	ret
+
+008001c9 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8001c9:	55                   	push   %ebp
+  8001ca:	89 e5                	mov    %esp,%ebp
+  8001cc:	53                   	push   %ebx
+  8001cd:	83 ec 04             	sub    $0x4,%esp
+  8001d0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8001d3:	8b 13                	mov    (%ebx),%edx
+  8001d5:	8d 42 01             	lea    0x1(%edx),%eax
+  8001d8:	89 03                	mov    %eax,(%ebx)
+  8001da:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001dd:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001e1:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001e6:	74 09                	je     8001f1 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001e8:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001ec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001ef:	c9                   	leave
+  8001f0:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001f1:	83 ec 08             	sub    $0x8,%esp
+  8001f4:	68 ff 00 00 00       	push   $0xff
+  8001f9:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001fc:	50                   	push   %eax
+  8001fd:	e8 84 09 00 00       	call   800b86 <sys_cputs>
+		b->idx = 0;
+  800202:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800208:	83 c4 10             	add    $0x10,%esp
+  80020b:	eb db                	jmp    8001e8 <putch+0x1f>
+
+0080020d <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80020d:	55                   	push   %ebp
+  80020e:	89 e5                	mov    %esp,%ebp
+  800210:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800216:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80021d:	00 00 00 
+	b.cnt = 0;
+  800220:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800227:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80022a:	ff 75 0c             	push   0xc(%ebp)
+  80022d:	ff 75 08             	push   0x8(%ebp)
+  800230:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800236:	50                   	push   %eax
+  800237:	68 c9 01 80 00       	push   $0x8001c9
+  80023c:	e8 14 01 00 00       	call   800355 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800241:	83 c4 08             	add    $0x8,%esp
+  800244:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80024a:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800250:	50                   	push   %eax
+  800251:	e8 30 09 00 00       	call   800b86 <sys_cputs>
+
+	return b.cnt;
+}
+  800256:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80025c:	c9                   	leave
+  80025d:	c3                   	ret
+
+0080025e <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80025e:	55                   	push   %ebp
+  80025f:	89 e5                	mov    %esp,%ebp
+  800261:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800264:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800267:	50                   	push   %eax
+  800268:	ff 75 08             	push   0x8(%ebp)
+  80026b:	e8 9d ff ff ff       	call   80020d <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800270:	c9                   	leave
+  800271:	c3                   	ret
+
+00800272 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800272:	55                   	push   %ebp
+  800273:	89 e5                	mov    %esp,%ebp
+  800275:	57                   	push   %edi
+  800276:	56                   	push   %esi
+  800277:	53                   	push   %ebx
+  800278:	83 ec 1c             	sub    $0x1c,%esp
+  80027b:	89 c7                	mov    %eax,%edi
+  80027d:	89 d6                	mov    %edx,%esi
+  80027f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800282:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800285:	89 d1                	mov    %edx,%ecx
+  800287:	89 c2                	mov    %eax,%edx
+  800289:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80028c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80028f:	8b 45 10             	mov    0x10(%ebp),%eax
+  800292:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800295:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800298:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80029f:	39 c2                	cmp    %eax,%edx
+  8002a1:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8002a4:	72 3e                	jb     8002e4 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8002a6:	83 ec 0c             	sub    $0xc,%esp
+  8002a9:	ff 75 18             	push   0x18(%ebp)
+  8002ac:	83 eb 01             	sub    $0x1,%ebx
+  8002af:	53                   	push   %ebx
+  8002b0:	50                   	push   %eax
+  8002b1:	83 ec 08             	sub    $0x8,%esp
+  8002b4:	ff 75 e4             	push   -0x1c(%ebp)
+  8002b7:	ff 75 e0             	push   -0x20(%ebp)
+  8002ba:	ff 75 dc             	push   -0x24(%ebp)
+  8002bd:	ff 75 d8             	push   -0x28(%ebp)
+  8002c0:	e8 67 43 00 00       	call   80462c <__udivdi3>
+  8002c5:	83 c4 18             	add    $0x18,%esp
+  8002c8:	52                   	push   %edx
+  8002c9:	50                   	push   %eax
+  8002ca:	89 f2                	mov    %esi,%edx
+  8002cc:	89 f8                	mov    %edi,%eax
+  8002ce:	e8 9f ff ff ff       	call   800272 <printnum>
+  8002d3:	83 c4 20             	add    $0x20,%esp
+  8002d6:	eb 13                	jmp    8002eb <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8002d8:	83 ec 08             	sub    $0x8,%esp
+  8002db:	56                   	push   %esi
+  8002dc:	ff 75 18             	push   0x18(%ebp)
+  8002df:	ff d7                	call   *%edi
+  8002e1:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8002e4:	83 eb 01             	sub    $0x1,%ebx
+  8002e7:	85 db                	test   %ebx,%ebx
+  8002e9:	7f ed                	jg     8002d8 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8002eb:	83 ec 08             	sub    $0x8,%esp
+  8002ee:	56                   	push   %esi
+  8002ef:	83 ec 04             	sub    $0x4,%esp
+  8002f2:	ff 75 e4             	push   -0x1c(%ebp)
+  8002f5:	ff 75 e0             	push   -0x20(%ebp)
+  8002f8:	ff 75 dc             	push   -0x24(%ebp)
+  8002fb:	ff 75 d8             	push   -0x28(%ebp)
+  8002fe:	e8 4a 43 00 00       	call   80464d <__umoddi3>
+  800303:	83 c4 14             	add    $0x14,%esp
+  800306:	0f be 80 35 48 80 00 	movsbl 0x804835(%eax),%eax
+  80030d:	50                   	push   %eax
+  80030e:	ff d7                	call   *%edi
+}
+  800310:	83 c4 10             	add    $0x10,%esp
+  800313:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800316:	5b                   	pop    %ebx
+  800317:	5e                   	pop    %esi
+  800318:	5f                   	pop    %edi
+  800319:	5d                   	pop    %ebp
+  80031a:	c3                   	ret
+
+0080031b <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80031b:	55                   	push   %ebp
+  80031c:	89 e5                	mov    %esp,%ebp
+  80031e:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800321:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800325:	8b 10                	mov    (%eax),%edx
+  800327:	3b 50 04             	cmp    0x4(%eax),%edx
+  80032a:	73 0a                	jae    800336 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80032c:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80032f:	89 08                	mov    %ecx,(%eax)
+  800331:	8b 45 08             	mov    0x8(%ebp),%eax
+  800334:	88 02                	mov    %al,(%edx)
+}
+  800336:	5d                   	pop    %ebp
+  800337:	c3                   	ret
+
+00800338 <printfmt>:
+{
+  800338:	55                   	push   %ebp
+  800339:	89 e5                	mov    %esp,%ebp
+  80033b:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80033e:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800341:	50                   	push   %eax
+  800342:	ff 75 10             	push   0x10(%ebp)
+  800345:	ff 75 0c             	push   0xc(%ebp)
+  800348:	ff 75 08             	push   0x8(%ebp)
+  80034b:	e8 05 00 00 00       	call   800355 <vprintfmt>
+}
+  800350:	83 c4 10             	add    $0x10,%esp
+  800353:	c9                   	leave
+  800354:	c3                   	ret
+
+00800355 <vprintfmt>:
+{
+  800355:	55                   	push   %ebp
+  800356:	89 e5                	mov    %esp,%ebp
+  800358:	57                   	push   %edi
+  800359:	56                   	push   %esi
+  80035a:	53                   	push   %ebx
+  80035b:	83 ec 2c             	sub    $0x2c,%esp
+  80035e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800361:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800364:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800367:	eb 0a                	jmp    800373 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800369:	83 ec 08             	sub    $0x8,%esp
+  80036c:	53                   	push   %ebx
+  80036d:	50                   	push   %eax
+  80036e:	ff d6                	call   *%esi
+  800370:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *fmt++) != '%') {
+  800373:	83 c7 01             	add    $0x1,%edi
+  800376:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+  80037a:	83 f8 25             	cmp    $0x25,%eax
+  80037d:	74 0c                	je     80038b <vprintfmt+0x36>
+			if (ch == '\0')
+  80037f:	85 c0                	test   %eax,%eax
+  800381:	75 e6                	jne    800369 <vprintfmt+0x14>
+}
+  800383:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800386:	5b                   	pop    %ebx
+  800387:	5e                   	pop    %esi
+  800388:	5f                   	pop    %edi
+  800389:	5d                   	pop    %ebp
+  80038a:	c3                   	ret
+		padc = ' ';
+  80038b:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80038f:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800396:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80039d:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8003a4:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *fmt++) {
+  8003a9:	8d 47 01             	lea    0x1(%edi),%eax
+  8003ac:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003af:	0f b6 17             	movzbl (%edi),%edx
+  8003b2:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8003b5:	3c 55                	cmp    $0x55,%al
+  8003b7:	0f 87 c5 03 00 00    	ja     800782 <vprintfmt+0x42d>
+  8003bd:	0f b6 c0             	movzbl %al,%eax
+  8003c0:	ff 24 85 c0 49 80 00 	jmp    *0x8049c0(,%eax,4)
+  8003c7:	88 55 d7             	mov    %dl,-0x29(%ebp)
+  8003ca:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003cd:	eb da                	jmp    8003a9 <vprintfmt+0x54>
+  8003cf:	0f be d2             	movsbl %dl,%edx
+  8003d2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8003d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003da:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8003dd:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003e0:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8003e4:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8003e7:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8003ea:	83 f9 09             	cmp    $0x9,%ecx
+  8003ed:	77 55                	ja     800444 <vprintfmt+0xef>
+			for (precision = 0; ; ++fmt) {
+  8003ef:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8003f2:	eb e9                	jmp    8003dd <vprintfmt+0x88>
+			precision = va_arg(ap, int);
+  8003f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003f7:	8b 00                	mov    (%eax),%eax
+  8003f9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003fc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003ff:	8d 40 04             	lea    0x4(%eax),%eax
+  800402:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *fmt++) {
+  800405:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800408:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80040c:	79 9b                	jns    8003a9 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80040e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800411:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800414:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80041b:	eb 8c                	jmp    8003a9 <vprintfmt+0x54>
+			if (width < 0)
+  80041d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800420:	85 d2                	test   %edx,%edx
+  800422:	b8 00 00 00 00       	mov    $0x0,%eax
+  800427:	0f 49 c2             	cmovns %edx,%eax
+  80042a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *fmt++) {
+  80042d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800430:	e9 74 ff ff ff       	jmp    8003a9 <vprintfmt+0x54>
+		switch (ch = *fmt++) {
+  800435:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800438:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80043f:	e9 65 ff ff ff       	jmp    8003a9 <vprintfmt+0x54>
+  800444:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800447:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80044a:	eb bc                	jmp    800408 <vprintfmt+0xb3>
+			lflag++;
+  80044c:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *fmt++) {
+  80044f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800452:	e9 52 ff ff ff       	jmp    8003a9 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800457:	8b 45 14             	mov    0x14(%ebp),%eax
+  80045a:	8d 78 04             	lea    0x4(%eax),%edi
+  80045d:	83 ec 08             	sub    $0x8,%esp
+  800460:	53                   	push   %ebx
+  800461:	ff 30                	push   (%eax)
+  800463:	ff d6                	call   *%esi
+			break;
+  800465:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800468:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80046b:	e9 b1 02 00 00       	jmp    800721 <vprintfmt+0x3cc>
+			err = va_arg(ap, int);
+  800470:	8b 45 14             	mov    0x14(%ebp),%eax
+  800473:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800476:	8b 10                	mov    (%eax),%edx
+  800478:	89 d0                	mov    %edx,%eax
+  80047a:	f7 d8                	neg    %eax
+  80047c:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80047f:	83 f8 14             	cmp    $0x14,%eax
+  800482:	7f 23                	jg     8004a7 <vprintfmt+0x152>
+  800484:	8b 14 85 20 4b 80 00 	mov    0x804b20(,%eax,4),%edx
+  80048b:	85 d2                	test   %edx,%edx
+  80048d:	74 18                	je     8004a7 <vprintfmt+0x152>
+				printfmt(putch, putdat, "%s", p);
+  80048f:	52                   	push   %edx
+  800490:	68 8f 4c 80 00       	push   $0x804c8f
+  800495:	53                   	push   %ebx
+  800496:	56                   	push   %esi
+  800497:	e8 9c fe ff ff       	call   800338 <printfmt>
+  80049c:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80049f:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8004a2:	e9 7a 02 00 00       	jmp    800721 <vprintfmt+0x3cc>
+				printfmt(putch, putdat, "error %d", err);
+  8004a7:	50                   	push   %eax
+  8004a8:	68 4d 48 80 00       	push   $0x80484d
+  8004ad:	53                   	push   %ebx
+  8004ae:	56                   	push   %esi
+  8004af:	e8 84 fe ff ff       	call   800338 <printfmt>
+  8004b4:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004b7:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8004ba:	e9 62 02 00 00       	jmp    800721 <vprintfmt+0x3cc>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004bf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004c2:	83 c0 04             	add    $0x4,%eax
+  8004c5:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8004c8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004cb:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8004cd:	85 c9                	test   %ecx,%ecx
+  8004cf:	b8 46 48 80 00       	mov    $0x804846,%eax
+  8004d4:	0f 45 c1             	cmovne %ecx,%eax
+  8004d7:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8004da:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004de:	7e 06                	jle    8004e6 <vprintfmt+0x191>
+  8004e0:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8004e4:	75 0b                	jne    8004f1 <vprintfmt+0x19c>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004e6:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8004e9:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8004ec:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004ef:	eb 5c                	jmp    80054d <vprintfmt+0x1f8>
+  8004f1:	83 ec 08             	sub    $0x8,%esp
+  8004f4:	ff 75 d0             	push   -0x30(%ebp)
+  8004f7:	ff 75 cc             	push   -0x34(%ebp)
+  8004fa:	e8 20 03 00 00       	call   80081f <strnlen>
+  8004ff:	89 c2                	mov    %eax,%edx
+  800501:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800504:	29 d0                	sub    %edx,%eax
+  800506:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800509:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80050d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800510:	89 75 08             	mov    %esi,0x8(%ebp)
+  800513:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800515:	eb 0e                	jmp    800525 <vprintfmt+0x1d0>
+					putch(padc, putdat);
+  800517:	83 ec 08             	sub    $0x8,%esp
+  80051a:	53                   	push   %ebx
+  80051b:	57                   	push   %edi
+  80051c:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80051f:	83 ee 01             	sub    $0x1,%esi
+  800522:	83 c4 10             	add    $0x10,%esp
+  800525:	85 f6                	test   %esi,%esi
+  800527:	7f ee                	jg     800517 <vprintfmt+0x1c2>
+  800529:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80052c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80052f:	85 c0                	test   %eax,%eax
+  800531:	ba 00 00 00 00       	mov    $0x0,%edx
+  800536:	0f 49 d0             	cmovns %eax,%edx
+  800539:	29 d0                	sub    %edx,%eax
+  80053b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80053e:	eb a6                	jmp    8004e6 <vprintfmt+0x191>
+					putch(ch, putdat);
+  800540:	83 ec 08             	sub    $0x8,%esp
+  800543:	53                   	push   %ebx
+  800544:	52                   	push   %edx
+  800545:	ff 55 08             	call   *0x8(%ebp)
+  800548:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80054b:	89 f1                	mov    %esi,%ecx
+  80054d:	8d 71 01             	lea    0x1(%ecx),%esi
+  800550:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800554:	0f be d0             	movsbl %al,%edx
+  800557:	85 d2                	test   %edx,%edx
+  800559:	74 28                	je     800583 <vprintfmt+0x22e>
+  80055b:	85 ff                	test   %edi,%edi
+  80055d:	78 05                	js     800564 <vprintfmt+0x20f>
+  80055f:	83 ef 01             	sub    $0x1,%edi
+  800562:	78 30                	js     800594 <vprintfmt+0x23f>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800564:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800568:	74 d6                	je     800540 <vprintfmt+0x1eb>
+  80056a:	0f be c0             	movsbl %al,%eax
+  80056d:	83 e8 20             	sub    $0x20,%eax
+  800570:	83 f8 5e             	cmp    $0x5e,%eax
+  800573:	76 cb                	jbe    800540 <vprintfmt+0x1eb>
+					putch('?', putdat);
+  800575:	83 ec 08             	sub    $0x8,%esp
+  800578:	53                   	push   %ebx
+  800579:	6a 3f                	push   $0x3f
+  80057b:	ff 55 08             	call   *0x8(%ebp)
+  80057e:	83 c4 10             	add    $0x10,%esp
+  800581:	eb c8                	jmp    80054b <vprintfmt+0x1f6>
+  800583:	8b 75 08             	mov    0x8(%ebp),%esi
+  800586:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800589:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80058c:	01 d0                	add    %edx,%eax
+  80058e:	29 c8                	sub    %ecx,%eax
+  800590:	89 c7                	mov    %eax,%edi
+  800592:	eb 13                	jmp    8005a7 <vprintfmt+0x252>
+  800594:	8b 75 08             	mov    0x8(%ebp),%esi
+  800597:	eb ed                	jmp    800586 <vprintfmt+0x231>
+				putch(' ', putdat);
+  800599:	83 ec 08             	sub    $0x8,%esp
+  80059c:	53                   	push   %ebx
+  80059d:	6a 20                	push   $0x20
+  80059f:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8005a1:	83 ef 01             	sub    $0x1,%edi
+  8005a4:	83 c4 10             	add    $0x10,%esp
+  8005a7:	85 ff                	test   %edi,%edi
+  8005a9:	7f ee                	jg     800599 <vprintfmt+0x244>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005ab:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8005ae:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005b1:	e9 6b 01 00 00       	jmp    800721 <vprintfmt+0x3cc>
+	if (lflag >= 2)
+  8005b6:	83 f9 01             	cmp    $0x1,%ecx
+  8005b9:	7f 1f                	jg     8005da <vprintfmt+0x285>
+	else if (lflag)
+  8005bb:	85 c9                	test   %ecx,%ecx
+  8005bd:	74 67                	je     800626 <vprintfmt+0x2d1>
+		return va_arg(*ap, long);
+  8005bf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c2:	8b 00                	mov    (%eax),%eax
+  8005c4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005c7:	89 c1                	mov    %eax,%ecx
+  8005c9:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005cc:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005cf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d2:	8d 40 04             	lea    0x4(%eax),%eax
+  8005d5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005d8:	eb 17                	jmp    8005f1 <vprintfmt+0x29c>
+		return va_arg(*ap, long long);
+  8005da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005dd:	8b 50 04             	mov    0x4(%eax),%edx
+  8005e0:	8b 00                	mov    (%eax),%eax
+  8005e2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005e5:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005e8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005eb:	8d 40 08             	lea    0x8(%eax),%eax
+  8005ee:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005f1:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005f4:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8005f7:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8005fc:	85 c9                	test   %ecx,%ecx
+  8005fe:	0f 89 03 01 00 00    	jns    800707 <vprintfmt+0x3b2>
+				putch('-', putdat);
+  800604:	83 ec 08             	sub    $0x8,%esp
+  800607:	53                   	push   %ebx
+  800608:	6a 2d                	push   $0x2d
+  80060a:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80060c:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80060f:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800612:	f7 da                	neg    %edx
+  800614:	83 d1 00             	adc    $0x0,%ecx
+  800617:	f7 d9                	neg    %ecx
+  800619:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80061c:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800621:	e9 e1 00 00 00       	jmp    800707 <vprintfmt+0x3b2>
+		return va_arg(*ap, int);
+  800626:	8b 45 14             	mov    0x14(%ebp),%eax
+  800629:	8b 00                	mov    (%eax),%eax
+  80062b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80062e:	89 c1                	mov    %eax,%ecx
+  800630:	c1 f9 1f             	sar    $0x1f,%ecx
+  800633:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800636:	8b 45 14             	mov    0x14(%ebp),%eax
+  800639:	8d 40 04             	lea    0x4(%eax),%eax
+  80063c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80063f:	eb b0                	jmp    8005f1 <vprintfmt+0x29c>
+	if (lflag >= 2)
+  800641:	83 f9 01             	cmp    $0x1,%ecx
+  800644:	7f 1e                	jg     800664 <vprintfmt+0x30f>
+	else if (lflag)
+  800646:	85 c9                	test   %ecx,%ecx
+  800648:	74 32                	je     80067c <vprintfmt+0x327>
+		return va_arg(*ap, unsigned long);
+  80064a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064d:	8b 10                	mov    (%eax),%edx
+  80064f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800654:	8d 40 04             	lea    0x4(%eax),%eax
+  800657:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80065a:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80065f:	e9 a3 00 00 00       	jmp    800707 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800664:	8b 45 14             	mov    0x14(%ebp),%eax
+  800667:	8b 10                	mov    (%eax),%edx
+  800669:	8b 48 04             	mov    0x4(%eax),%ecx
+  80066c:	8d 40 08             	lea    0x8(%eax),%eax
+  80066f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800672:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800677:	e9 8b 00 00 00       	jmp    800707 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  80067c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067f:	8b 10                	mov    (%eax),%edx
+  800681:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800686:	8d 40 04             	lea    0x4(%eax),%eax
+  800689:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80068c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800691:	eb 74                	jmp    800707 <vprintfmt+0x3b2>
+	if (lflag >= 2)
+  800693:	83 f9 01             	cmp    $0x1,%ecx
+  800696:	7f 1b                	jg     8006b3 <vprintfmt+0x35e>
+	else if (lflag)
+  800698:	85 c9                	test   %ecx,%ecx
+  80069a:	74 2c                	je     8006c8 <vprintfmt+0x373>
+		return va_arg(*ap, unsigned long);
+  80069c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069f:	8b 10                	mov    (%eax),%edx
+  8006a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006a6:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006ac:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8006b1:	eb 54                	jmp    800707 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  8006b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b6:	8b 10                	mov    (%eax),%edx
+  8006b8:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006bb:	8d 40 08             	lea    0x8(%eax),%eax
+  8006be:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006c1:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8006c6:	eb 3f                	jmp    800707 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  8006c8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006cb:	8b 10                	mov    (%eax),%edx
+  8006cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006d2:	8d 40 04             	lea    0x4(%eax),%eax
+  8006d5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006d8:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8006dd:	eb 28                	jmp    800707 <vprintfmt+0x3b2>
+			putch('0', putdat);
+  8006df:	83 ec 08             	sub    $0x8,%esp
+  8006e2:	53                   	push   %ebx
+  8006e3:	6a 30                	push   $0x30
+  8006e5:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8006e7:	83 c4 08             	add    $0x8,%esp
+  8006ea:	53                   	push   %ebx
+  8006eb:	6a 78                	push   $0x78
+  8006ed:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8006ef:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f2:	8b 10                	mov    (%eax),%edx
+  8006f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8006f9:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006fc:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ff:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800702:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800707:	83 ec 0c             	sub    $0xc,%esp
+  80070a:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80070e:	50                   	push   %eax
+  80070f:	ff 75 e0             	push   -0x20(%ebp)
+  800712:	57                   	push   %edi
+  800713:	51                   	push   %ecx
+  800714:	52                   	push   %edx
+  800715:	89 da                	mov    %ebx,%edx
+  800717:	89 f0                	mov    %esi,%eax
+  800719:	e8 54 fb ff ff       	call   800272 <printnum>
+			break;
+  80071e:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800721:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *fmt++) != '%') {
+  800724:	e9 4a fc ff ff       	jmp    800373 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800729:	83 f9 01             	cmp    $0x1,%ecx
+  80072c:	7f 1b                	jg     800749 <vprintfmt+0x3f4>
+	else if (lflag)
+  80072e:	85 c9                	test   %ecx,%ecx
+  800730:	74 2c                	je     80075e <vprintfmt+0x409>
+		return va_arg(*ap, unsigned long);
+  800732:	8b 45 14             	mov    0x14(%ebp),%eax
+  800735:	8b 10                	mov    (%eax),%edx
+  800737:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80073c:	8d 40 04             	lea    0x4(%eax),%eax
+  80073f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800742:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800747:	eb be                	jmp    800707 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned long long);
+  800749:	8b 45 14             	mov    0x14(%ebp),%eax
+  80074c:	8b 10                	mov    (%eax),%edx
+  80074e:	8b 48 04             	mov    0x4(%eax),%ecx
+  800751:	8d 40 08             	lea    0x8(%eax),%eax
+  800754:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800757:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80075c:	eb a9                	jmp    800707 <vprintfmt+0x3b2>
+		return va_arg(*ap, unsigned int);
+  80075e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800761:	8b 10                	mov    (%eax),%edx
+  800763:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800768:	8d 40 04             	lea    0x4(%eax),%eax
+  80076b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80076e:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800773:	eb 92                	jmp    800707 <vprintfmt+0x3b2>
+			putch(ch, putdat);
+  800775:	83 ec 08             	sub    $0x8,%esp
+  800778:	53                   	push   %ebx
+  800779:	6a 25                	push   $0x25
+  80077b:	ff d6                	call   *%esi
+			break;
+  80077d:	83 c4 10             	add    $0x10,%esp
+  800780:	eb 9f                	jmp    800721 <vprintfmt+0x3cc>
+			putch('%', putdat);
+  800782:	83 ec 08             	sub    $0x8,%esp
+  800785:	53                   	push   %ebx
+  800786:	6a 25                	push   $0x25
+  800788:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80078a:	83 c4 10             	add    $0x10,%esp
+  80078d:	89 f8                	mov    %edi,%eax
+  80078f:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800793:	74 05                	je     80079a <vprintfmt+0x445>
+  800795:	83 e8 01             	sub    $0x1,%eax
+  800798:	eb f5                	jmp    80078f <vprintfmt+0x43a>
+  80079a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80079d:	eb 82                	jmp    800721 <vprintfmt+0x3cc>
+
+0080079f <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80079f:	55                   	push   %ebp
+  8007a0:	89 e5                	mov    %esp,%ebp
+  8007a2:	83 ec 18             	sub    $0x18,%esp
+  8007a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007a8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8007ab:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8007ae:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8007b2:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8007b5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8007bc:	85 c0                	test   %eax,%eax
+  8007be:	74 26                	je     8007e6 <vsnprintf+0x47>
+  8007c0:	85 d2                	test   %edx,%edx
+  8007c2:	7e 22                	jle    8007e6 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8007c4:	ff 75 14             	push   0x14(%ebp)
+  8007c7:	ff 75 10             	push   0x10(%ebp)
+  8007ca:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007cd:	50                   	push   %eax
+  8007ce:	68 1b 03 80 00       	push   $0x80031b
+  8007d3:	e8 7d fb ff ff       	call   800355 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8007d8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007db:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8007de:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007e1:	83 c4 10             	add    $0x10,%esp
+}
+  8007e4:	c9                   	leave
+  8007e5:	c3                   	ret
+		return -E_INVAL;
+  8007e6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007eb:	eb f7                	jmp    8007e4 <vsnprintf+0x45>
+
+008007ed <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8007ed:	55                   	push   %ebp
+  8007ee:	89 e5                	mov    %esp,%ebp
+  8007f0:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8007f3:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8007f6:	50                   	push   %eax
+  8007f7:	ff 75 10             	push   0x10(%ebp)
+  8007fa:	ff 75 0c             	push   0xc(%ebp)
+  8007fd:	ff 75 08             	push   0x8(%ebp)
+  800800:	e8 9a ff ff ff       	call   80079f <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800805:	c9                   	leave
+  800806:	c3                   	ret
+
+00800807 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800807:	55                   	push   %ebp
+  800808:	89 e5                	mov    %esp,%ebp
+  80080a:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80080d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800812:	eb 03                	jmp    800817 <strlen+0x10>
+		n++;
+  800814:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800817:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80081b:	75 f7                	jne    800814 <strlen+0xd>
+	return n;
+}
+  80081d:	5d                   	pop    %ebp
+  80081e:	c3                   	ret
+
+0080081f <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80081f:	55                   	push   %ebp
+  800820:	89 e5                	mov    %esp,%ebp
+  800822:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800825:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800828:	b8 00 00 00 00       	mov    $0x0,%eax
+  80082d:	eb 03                	jmp    800832 <strnlen+0x13>
+		n++;
+  80082f:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800832:	39 d0                	cmp    %edx,%eax
+  800834:	74 08                	je     80083e <strnlen+0x1f>
+  800836:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80083a:	75 f3                	jne    80082f <strnlen+0x10>
+  80083c:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80083e:	89 d0                	mov    %edx,%eax
+  800840:	5d                   	pop    %ebp
+  800841:	c3                   	ret
+
+00800842 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800842:	55                   	push   %ebp
+  800843:	89 e5                	mov    %esp,%ebp
+  800845:	53                   	push   %ebx
+  800846:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800849:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80084c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800851:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800855:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800858:	83 c0 01             	add    $0x1,%eax
+  80085b:	84 d2                	test   %dl,%dl
+  80085d:	75 f2                	jne    800851 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80085f:	89 c8                	mov    %ecx,%eax
+  800861:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800864:	c9                   	leave
+  800865:	c3                   	ret
+
+00800866 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800866:	55                   	push   %ebp
+  800867:	89 e5                	mov    %esp,%ebp
+  800869:	53                   	push   %ebx
+  80086a:	83 ec 10             	sub    $0x10,%esp
+  80086d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800870:	53                   	push   %ebx
+  800871:	e8 91 ff ff ff       	call   800807 <strlen>
+  800876:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800879:	ff 75 0c             	push   0xc(%ebp)
+  80087c:	01 d8                	add    %ebx,%eax
+  80087e:	50                   	push   %eax
+  80087f:	e8 be ff ff ff       	call   800842 <strcpy>
+	return dst;
+}
+  800884:	89 d8                	mov    %ebx,%eax
+  800886:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800889:	c9                   	leave
+  80088a:	c3                   	ret
+
+0080088b <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80088b:	55                   	push   %ebp
+  80088c:	89 e5                	mov    %esp,%ebp
+  80088e:	56                   	push   %esi
+  80088f:	53                   	push   %ebx
+  800890:	8b 75 08             	mov    0x8(%ebp),%esi
+  800893:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800896:	89 f3                	mov    %esi,%ebx
+  800898:	03 5d 10             	add    0x10(%ebp),%ebx
+  80089b:	89 f0                	mov    %esi,%eax
+  80089d:	eb 0f                	jmp    8008ae <strncpy+0x23>
+		*dst++ = *src;
+  80089f:	83 c0 01             	add    $0x1,%eax
+  8008a2:	0f b6 0a             	movzbl (%edx),%ecx
+  8008a5:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8008a8:	80 f9 01             	cmp    $0x1,%cl
+  8008ab:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8008ae:	39 d8                	cmp    %ebx,%eax
+  8008b0:	75 ed                	jne    80089f <strncpy+0x14>
+	}
+	return ret;
+}
+  8008b2:	89 f0                	mov    %esi,%eax
+  8008b4:	5b                   	pop    %ebx
+  8008b5:	5e                   	pop    %esi
+  8008b6:	5d                   	pop    %ebp
+  8008b7:	c3                   	ret
+
+008008b8 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8008b8:	55                   	push   %ebp
+  8008b9:	89 e5                	mov    %esp,%ebp
+  8008bb:	56                   	push   %esi
+  8008bc:	53                   	push   %ebx
+  8008bd:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008c3:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8008c6:	89 f0                	mov    %esi,%eax
+  8008c8:	85 d2                	test   %edx,%edx
+  8008ca:	74 21                	je     8008ed <strlcpy+0x35>
+  8008cc:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8008d0:	89 f2                	mov    %esi,%edx
+  8008d2:	eb 09                	jmp    8008dd <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8008d4:	83 c1 01             	add    $0x1,%ecx
+  8008d7:	83 c2 01             	add    $0x1,%edx
+  8008da:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8008dd:	39 c2                	cmp    %eax,%edx
+  8008df:	74 09                	je     8008ea <strlcpy+0x32>
+  8008e1:	0f b6 19             	movzbl (%ecx),%ebx
+  8008e4:	84 db                	test   %bl,%bl
+  8008e6:	75 ec                	jne    8008d4 <strlcpy+0x1c>
+  8008e8:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8008ea:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8008ed:	29 f0                	sub    %esi,%eax
+}
+  8008ef:	5b                   	pop    %ebx
+  8008f0:	5e                   	pop    %esi
+  8008f1:	5d                   	pop    %ebp
+  8008f2:	c3                   	ret
+
+008008f3 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8008f3:	55                   	push   %ebp
+  8008f4:	89 e5                	mov    %esp,%ebp
+  8008f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008f9:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8008fc:	eb 06                	jmp    800904 <strcmp+0x11>
+		p++, q++;
+  8008fe:	83 c1 01             	add    $0x1,%ecx
+  800901:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800904:	0f b6 01             	movzbl (%ecx),%eax
+  800907:	84 c0                	test   %al,%al
+  800909:	74 04                	je     80090f <strcmp+0x1c>
+  80090b:	3a 02                	cmp    (%edx),%al
+  80090d:	74 ef                	je     8008fe <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80090f:	0f b6 c0             	movzbl %al,%eax
+  800912:	0f b6 12             	movzbl (%edx),%edx
+  800915:	29 d0                	sub    %edx,%eax
+}
+  800917:	5d                   	pop    %ebp
+  800918:	c3                   	ret
+
+00800919 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800919:	55                   	push   %ebp
+  80091a:	89 e5                	mov    %esp,%ebp
+  80091c:	53                   	push   %ebx
+  80091d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800920:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800923:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800926:	eb 09                	jmp    800931 <strncmp+0x18>
+		n--, p++, q++;
+  800928:	83 ea 01             	sub    $0x1,%edx
+  80092b:	83 c0 01             	add    $0x1,%eax
+  80092e:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800931:	85 d2                	test   %edx,%edx
+  800933:	74 18                	je     80094d <strncmp+0x34>
+  800935:	0f b6 18             	movzbl (%eax),%ebx
+  800938:	84 db                	test   %bl,%bl
+  80093a:	74 04                	je     800940 <strncmp+0x27>
+  80093c:	3a 19                	cmp    (%ecx),%bl
+  80093e:	74 e8                	je     800928 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800940:	0f b6 00             	movzbl (%eax),%eax
+  800943:	0f b6 11             	movzbl (%ecx),%edx
+  800946:	29 d0                	sub    %edx,%eax
+}
+  800948:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80094b:	c9                   	leave
+  80094c:	c3                   	ret
+		return 0;
+  80094d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800952:	eb f4                	jmp    800948 <strncmp+0x2f>
+
+00800954 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800954:	55                   	push   %ebp
+  800955:	89 e5                	mov    %esp,%ebp
+  800957:	8b 45 08             	mov    0x8(%ebp),%eax
+  80095a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80095e:	eb 03                	jmp    800963 <strchr+0xf>
+  800960:	83 c0 01             	add    $0x1,%eax
+  800963:	0f b6 10             	movzbl (%eax),%edx
+  800966:	84 d2                	test   %dl,%dl
+  800968:	74 06                	je     800970 <strchr+0x1c>
+		if (*s == c)
+  80096a:	38 ca                	cmp    %cl,%dl
+  80096c:	75 f2                	jne    800960 <strchr+0xc>
+  80096e:	eb 05                	jmp    800975 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800970:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800975:	5d                   	pop    %ebp
+  800976:	c3                   	ret
+
+00800977 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800977:	55                   	push   %ebp
+  800978:	89 e5                	mov    %esp,%ebp
+  80097a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80097d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800981:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800984:	38 ca                	cmp    %cl,%dl
+  800986:	74 09                	je     800991 <strfind+0x1a>
+  800988:	84 d2                	test   %dl,%dl
+  80098a:	74 05                	je     800991 <strfind+0x1a>
+	for (; *s; s++)
+  80098c:	83 c0 01             	add    $0x1,%eax
+  80098f:	eb f0                	jmp    800981 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800991:	5d                   	pop    %ebp
+  800992:	c3                   	ret
+
+00800993 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800993:	55                   	push   %ebp
+  800994:	89 e5                	mov    %esp,%ebp
+  800996:	57                   	push   %edi
+  800997:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80099a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80099d:	85 c9                	test   %ecx,%ecx
+  80099f:	74 20                	je     8009c1 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8009a1:	89 f8                	mov    %edi,%eax
+  8009a3:	09 c8                	or     %ecx,%eax
+  8009a5:	a8 03                	test   $0x3,%al
+  8009a7:	75 12                	jne    8009bb <memset+0x28>
+		c &= 0xFF;
+  8009a9:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8009ad:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8009b3:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8009b6:	fc                   	cld
+  8009b7:	f3 ab                	rep stos %eax,%es:(%edi)
+  8009b9:	eb 06                	jmp    8009c1 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8009bb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8009be:	fc                   	cld
+  8009bf:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8009c1:	89 f8                	mov    %edi,%eax
+  8009c3:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8009c6:	c9                   	leave
+  8009c7:	c3                   	ret
+
+008009c8 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8009c8:	55                   	push   %ebp
+  8009c9:	89 e5                	mov    %esp,%ebp
+  8009cb:	57                   	push   %edi
+  8009cc:	56                   	push   %esi
+  8009cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009d0:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8009d3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8009d6:	39 c6                	cmp    %eax,%esi
+  8009d8:	73 32                	jae    800a0c <memmove+0x44>
+  8009da:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8009dd:	39 d0                	cmp    %edx,%eax
+  8009df:	73 2b                	jae    800a0c <memmove+0x44>
+		s += n;
+		d += n;
+  8009e1:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009e4:	89 d6                	mov    %edx,%esi
+  8009e6:	09 fe                	or     %edi,%esi
+  8009e8:	09 ce                	or     %ecx,%esi
+  8009ea:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8009f0:	75 0e                	jne    800a00 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8009f2:	83 ef 04             	sub    $0x4,%edi
+  8009f5:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009f8:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8009fb:	fd                   	std
+  8009fc:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009fe:	eb 09                	jmp    800a09 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a00:	83 ef 01             	sub    $0x1,%edi
+  800a03:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a06:	fd                   	std
+  800a07:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a09:	fc                   	cld
+  800a0a:	eb 1a                	jmp    800a26 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a0c:	89 f2                	mov    %esi,%edx
+  800a0e:	09 c2                	or     %eax,%edx
+  800a10:	09 ca                	or     %ecx,%edx
+  800a12:	f6 c2 03             	test   $0x3,%dl
+  800a15:	75 0a                	jne    800a21 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a17:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a1a:	89 c7                	mov    %eax,%edi
+  800a1c:	fc                   	cld
+  800a1d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a1f:	eb 05                	jmp    800a26 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a21:	89 c7                	mov    %eax,%edi
+  800a23:	fc                   	cld
+  800a24:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a26:	5e                   	pop    %esi
+  800a27:	5f                   	pop    %edi
+  800a28:	5d                   	pop    %ebp
+  800a29:	c3                   	ret
+
+00800a2a <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a2a:	55                   	push   %ebp
+  800a2b:	89 e5                	mov    %esp,%ebp
+  800a2d:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a30:	ff 75 10             	push   0x10(%ebp)
+  800a33:	ff 75 0c             	push   0xc(%ebp)
+  800a36:	ff 75 08             	push   0x8(%ebp)
+  800a39:	e8 8a ff ff ff       	call   8009c8 <memmove>
+}
+  800a3e:	c9                   	leave
+  800a3f:	c3                   	ret
+
+00800a40 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a40:	55                   	push   %ebp
+  800a41:	89 e5                	mov    %esp,%ebp
+  800a43:	56                   	push   %esi
+  800a44:	53                   	push   %ebx
+  800a45:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a48:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a4b:	89 c6                	mov    %eax,%esi
+  800a4d:	03 75 10             	add    0x10(%ebp),%esi
+  800a50:	eb 06                	jmp    800a58 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a52:	83 c0 01             	add    $0x1,%eax
+  800a55:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a58:	39 f0                	cmp    %esi,%eax
+  800a5a:	74 14                	je     800a70 <memcmp+0x30>
+		if (*s1 != *s2)
+  800a5c:	0f b6 08             	movzbl (%eax),%ecx
+  800a5f:	0f b6 1a             	movzbl (%edx),%ebx
+  800a62:	38 d9                	cmp    %bl,%cl
+  800a64:	74 ec                	je     800a52 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a66:	0f b6 c1             	movzbl %cl,%eax
+  800a69:	0f b6 db             	movzbl %bl,%ebx
+  800a6c:	29 d8                	sub    %ebx,%eax
+  800a6e:	eb 05                	jmp    800a75 <memcmp+0x35>
+	}
+
+	return 0;
+  800a70:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a75:	5b                   	pop    %ebx
+  800a76:	5e                   	pop    %esi
+  800a77:	5d                   	pop    %ebp
+  800a78:	c3                   	ret
+
+00800a79 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a79:	55                   	push   %ebp
+  800a7a:	89 e5                	mov    %esp,%ebp
+  800a7c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a7f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a82:	89 c2                	mov    %eax,%edx
+  800a84:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a87:	eb 03                	jmp    800a8c <memfind+0x13>
+  800a89:	83 c0 01             	add    $0x1,%eax
+  800a8c:	39 d0                	cmp    %edx,%eax
+  800a8e:	73 04                	jae    800a94 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a90:	38 08                	cmp    %cl,(%eax)
+  800a92:	75 f5                	jne    800a89 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a94:	5d                   	pop    %ebp
+  800a95:	c3                   	ret
+
+00800a96 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a96:	55                   	push   %ebp
+  800a97:	89 e5                	mov    %esp,%ebp
+  800a99:	57                   	push   %edi
+  800a9a:	56                   	push   %esi
+  800a9b:	53                   	push   %ebx
+  800a9c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a9f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800aa2:	eb 03                	jmp    800aa7 <strtol+0x11>
+		s++;
+  800aa4:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800aa7:	0f b6 02             	movzbl (%edx),%eax
+  800aaa:	3c 20                	cmp    $0x20,%al
+  800aac:	74 f6                	je     800aa4 <strtol+0xe>
+  800aae:	3c 09                	cmp    $0x9,%al
+  800ab0:	74 f2                	je     800aa4 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800ab2:	3c 2b                	cmp    $0x2b,%al
+  800ab4:	74 2a                	je     800ae0 <strtol+0x4a>
+	int neg = 0;
+  800ab6:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800abb:	3c 2d                	cmp    $0x2d,%al
+  800abd:	74 2b                	je     800aea <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800abf:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800ac5:	75 0f                	jne    800ad6 <strtol+0x40>
+  800ac7:	80 3a 30             	cmpb   $0x30,(%edx)
+  800aca:	74 28                	je     800af4 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800acc:	85 db                	test   %ebx,%ebx
+  800ace:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ad3:	0f 44 d8             	cmove  %eax,%ebx
+  800ad6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800adb:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800ade:	eb 46                	jmp    800b26 <strtol+0x90>
+		s++;
+  800ae0:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800ae3:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ae8:	eb d5                	jmp    800abf <strtol+0x29>
+		s++, neg = 1;
+  800aea:	83 c2 01             	add    $0x1,%edx
+  800aed:	bf 01 00 00 00       	mov    $0x1,%edi
+  800af2:	eb cb                	jmp    800abf <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800af4:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800af8:	74 0e                	je     800b08 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800afa:	85 db                	test   %ebx,%ebx
+  800afc:	75 d8                	jne    800ad6 <strtol+0x40>
+		s++, base = 8;
+  800afe:	83 c2 01             	add    $0x1,%edx
+  800b01:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b06:	eb ce                	jmp    800ad6 <strtol+0x40>
+		s += 2, base = 16;
+  800b08:	83 c2 02             	add    $0x2,%edx
+  800b0b:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b10:	eb c4                	jmp    800ad6 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800b12:	0f be c0             	movsbl %al,%eax
+  800b15:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800b18:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b1b:	7d 3a                	jge    800b57 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800b1d:	83 c2 01             	add    $0x1,%edx
+  800b20:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b24:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800b26:	0f b6 02             	movzbl (%edx),%eax
+  800b29:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b2c:	89 f3                	mov    %esi,%ebx
+  800b2e:	80 fb 09             	cmp    $0x9,%bl
+  800b31:	76 df                	jbe    800b12 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800b33:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b36:	89 f3                	mov    %esi,%ebx
+  800b38:	80 fb 19             	cmp    $0x19,%bl
+  800b3b:	77 08                	ja     800b45 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800b3d:	0f be c0             	movsbl %al,%eax
+  800b40:	83 e8 57             	sub    $0x57,%eax
+  800b43:	eb d3                	jmp    800b18 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b45:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b48:	89 f3                	mov    %esi,%ebx
+  800b4a:	80 fb 19             	cmp    $0x19,%bl
+  800b4d:	77 08                	ja     800b57 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800b4f:	0f be c0             	movsbl %al,%eax
+  800b52:	83 e8 37             	sub    $0x37,%eax
+  800b55:	eb c1                	jmp    800b18 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b57:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b5b:	74 05                	je     800b62 <strtol+0xcc>
+		*endptr = (char *) s;
+  800b5d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b60:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b62:	89 c8                	mov    %ecx,%eax
+  800b64:	f7 d8                	neg    %eax
+  800b66:	85 ff                	test   %edi,%edi
+  800b68:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b6b:	89 c8                	mov    %ecx,%eax
+  800b6d:	5b                   	pop    %ebx
+  800b6e:	5e                   	pop    %esi
+  800b6f:	5f                   	pop    %edi
+  800b70:	5d                   	pop    %ebp
+  800b71:	c3                   	ret
+
+00800b72 <atoi>:
+
+int
+atoi(const char* s)
+{
+  800b72:	55                   	push   %ebp
+  800b73:	89 e5                	mov    %esp,%ebp
+  800b75:	83 ec 0c             	sub    $0xc,%esp
+	return strtol(s, NULL, 0);
+  800b78:	6a 00                	push   $0x0
+  800b7a:	6a 00                	push   $0x0
+  800b7c:	ff 75 08             	push   0x8(%ebp)
+  800b7f:	e8 12 ff ff ff       	call   800a96 <strtol>
+}
+  800b84:	c9                   	leave
+  800b85:	c3                   	ret
+
+00800b86 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800b86:	55                   	push   %ebp
+  800b87:	89 e5                	mov    %esp,%ebp
+  800b89:	57                   	push   %edi
+  800b8a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800b8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b90:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b93:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b96:	89 c3                	mov    %eax,%ebx
+  800b98:	89 c7                	mov    %eax,%edi
+  800b9a:	6a 00                	push   $0x0
+  800b9c:	55                   	push   %ebp
+  800b9d:	56                   	push   %esi
+  800b9e:	89 e5                	mov    %esp,%ebp
+  800ba0:	8d 35 a8 0b 80 00    	lea    0x800ba8,%esi
+  800ba6:	0f 34                	sysenter
+
+00800ba8 <after_sysenter_label_47>:
+  800ba8:	5e                   	pop    %esi
+  800ba9:	5d                   	pop    %ebp
+  800baa:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800bad:	5b                   	pop    %ebx
+  800bae:	5f                   	pop    %edi
+  800baf:	5d                   	pop    %ebp
+  800bb0:	c3                   	ret
+
+00800bb1 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800bb1:	55                   	push   %ebp
+  800bb2:	89 e5                	mov    %esp,%ebp
+  800bb4:	57                   	push   %edi
+  800bb5:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800bb6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bbb:	b8 01 00 00 00       	mov    $0x1,%eax
+  800bc0:	89 d1                	mov    %edx,%ecx
+  800bc2:	89 d3                	mov    %edx,%ebx
+  800bc4:	89 d7                	mov    %edx,%edi
+  800bc6:	6a 00                	push   $0x0
+  800bc8:	55                   	push   %ebp
+  800bc9:	56                   	push   %esi
+  800bca:	89 e5                	mov    %esp,%ebp
+  800bcc:	8d 35 d4 0b 80 00    	lea    0x800bd4,%esi
+  800bd2:	0f 34                	sysenter
+
+00800bd4 <after_sysenter_label_128>:
+  800bd4:	5e                   	pop    %esi
+  800bd5:	5d                   	pop    %ebp
+  800bd6:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800bd9:	5b                   	pop    %ebx
+  800bda:	5f                   	pop    %edi
+  800bdb:	5d                   	pop    %ebp
+  800bdc:	c3                   	ret
+
+00800bdd <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800bdd:	55                   	push   %ebp
+  800bde:	89 e5                	mov    %esp,%ebp
+  800be0:	57                   	push   %edi
+  800be1:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800be2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800be5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bea:	b8 03 00 00 00       	mov    $0x3,%eax
+  800bef:	89 cb                	mov    %ecx,%ebx
+  800bf1:	89 cf                	mov    %ecx,%edi
+  800bf3:	6a 00                	push   $0x0
+  800bf5:	55                   	push   %ebp
+  800bf6:	56                   	push   %esi
+  800bf7:	89 e5                	mov    %esp,%ebp
+  800bf9:	8d 35 01 0c 80 00    	lea    0x800c01,%esi
+  800bff:	0f 34                	sysenter
+
+00800c01 <after_sysenter_label_212>:
+  800c01:	5e                   	pop    %esi
+  800c02:	5d                   	pop    %ebp
+  800c03:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800c06:	85 c0                	test   %eax,%eax
+  800c08:	7f 07                	jg     800c11 <after_sysenter_label_212+0x10>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c0a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c0d:	5b                   	pop    %ebx
+  800c0e:	5f                   	pop    %edi
+  800c0f:	5d                   	pop    %ebp
+  800c10:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c11:	83 ec 0c             	sub    $0xc,%esp
+  800c14:	50                   	push   %eax
+  800c15:	6a 03                	push   $0x3
+  800c17:	68 b5 4b 80 00       	push   $0x804bb5
+  800c1c:	6a 54                	push   $0x54
+  800c1e:	68 d2 4b 80 00       	push   $0x804bd2
+  800c23:	e8 38 30 00 00       	call   803c60 <_panic>
+
+00800c28 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800c28:	55                   	push   %ebp
+  800c29:	89 e5                	mov    %esp,%ebp
+  800c2b:	57                   	push   %edi
+  800c2c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c2d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c32:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c37:	89 d1                	mov    %edx,%ecx
+  800c39:	89 d3                	mov    %edx,%ebx
+  800c3b:	89 d7                	mov    %edx,%edi
+  800c3d:	6a 00                	push   $0x0
+  800c3f:	55                   	push   %ebp
+  800c40:	56                   	push   %esi
+  800c41:	89 e5                	mov    %esp,%ebp
+  800c43:	8d 35 4b 0c 80 00    	lea    0x800c4b,%esi
+  800c49:	0f 34                	sysenter
+
+00800c4b <after_sysenter_label_309>:
+  800c4b:	5e                   	pop    %esi
+  800c4c:	5d                   	pop    %ebp
+  800c4d:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800c50:	5b                   	pop    %ebx
+  800c51:	5f                   	pop    %edi
+  800c52:	5d                   	pop    %ebp
+  800c53:	c3                   	ret
+
+00800c54 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800c54:	55                   	push   %ebp
+  800c55:	89 e5                	mov    %esp,%ebp
+  800c57:	57                   	push   %edi
+  800c58:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c59:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c5e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800c63:	89 d1                	mov    %edx,%ecx
+  800c65:	89 d3                	mov    %edx,%ebx
+  800c67:	89 d7                	mov    %edx,%edi
+  800c69:	6a 00                	push   $0x0
+  800c6b:	55                   	push   %ebp
+  800c6c:	56                   	push   %esi
+  800c6d:	89 e5                	mov    %esp,%ebp
+  800c6f:	8d 35 77 0c 80 00    	lea    0x800c77,%esi
+  800c75:	0f 34                	sysenter
+
+00800c77 <after_sysenter_label_391>:
+  800c77:	5e                   	pop    %esi
+  800c78:	5d                   	pop    %ebp
+  800c79:	83 c4 04             	add    $0x4,%esp
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800c7c:	5b                   	pop    %ebx
+  800c7d:	5f                   	pop    %edi
+  800c7e:	5d                   	pop    %ebp
+  800c7f:	c3                   	ret
+
+00800c80 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c80:	55                   	push   %ebp
+  800c81:	89 e5                	mov    %esp,%ebp
+  800c83:	57                   	push   %edi
+  800c84:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800c85:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c88:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c8b:	b8 04 00 00 00       	mov    $0x4,%eax
+  800c90:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c95:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c98:	6a 00                	push   $0x0
+  800c9a:	55                   	push   %ebp
+  800c9b:	56                   	push   %esi
+  800c9c:	89 e5                	mov    %esp,%ebp
+  800c9e:	8d 35 a6 0c 80 00    	lea    0x800ca6,%esi
+  800ca4:	0f 34                	sysenter
+
+00800ca6 <after_sysenter_label_479>:
+  800ca6:	5e                   	pop    %esi
+  800ca7:	5d                   	pop    %ebp
+  800ca8:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800cab:	85 c0                	test   %eax,%eax
+  800cad:	7f 07                	jg     800cb6 <after_sysenter_label_479+0x10>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800caf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800cb2:	5b                   	pop    %ebx
+  800cb3:	5f                   	pop    %edi
+  800cb4:	5d                   	pop    %ebp
+  800cb5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cb6:	83 ec 0c             	sub    $0xc,%esp
+  800cb9:	50                   	push   %eax
+  800cba:	6a 04                	push   $0x4
+  800cbc:	68 b5 4b 80 00       	push   $0x804bb5
+  800cc1:	6a 54                	push   $0x54
+  800cc3:	68 d2 4b 80 00       	push   $0x804bd2
+  800cc8:	e8 93 2f 00 00       	call   803c60 <_panic>
+
+00800ccd <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800ccd:	55                   	push   %ebp
+  800cce:	89 e5                	mov    %esp,%ebp
+  800cd0:	57                   	push   %edi
+  800cd1:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800cd2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cd5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cd8:	b8 05 00 00 00       	mov    $0x5,%eax
+  800cdd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ce0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ce3:	ff 75 18             	push   0x18(%ebp)
+  800ce6:	55                   	push   %ebp
+  800ce7:	56                   	push   %esi
+  800ce8:	89 e5                	mov    %esp,%ebp
+  800cea:	8d 35 f2 0c 80 00    	lea    0x800cf2,%esi
+  800cf0:	0f 34                	sysenter
+
+00800cf2 <after_sysenter_label_593>:
+  800cf2:	5e                   	pop    %esi
+  800cf3:	5d                   	pop    %ebp
+  800cf4:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800cf7:	85 c0                	test   %eax,%eax
+  800cf9:	7f 07                	jg     800d02 <after_sysenter_label_593+0x10>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800cfb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800cfe:	5b                   	pop    %ebx
+  800cff:	5f                   	pop    %edi
+  800d00:	5d                   	pop    %ebp
+  800d01:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d02:	83 ec 0c             	sub    $0xc,%esp
+  800d05:	50                   	push   %eax
+  800d06:	6a 05                	push   $0x5
+  800d08:	68 b5 4b 80 00       	push   $0x804bb5
+  800d0d:	6a 54                	push   $0x54
+  800d0f:	68 d2 4b 80 00       	push   $0x804bd2
+  800d14:	e8 47 2f 00 00       	call   803c60 <_panic>
+
+00800d19 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800d19:	55                   	push   %ebp
+  800d1a:	89 e5                	mov    %esp,%ebp
+  800d1c:	57                   	push   %edi
+  800d1d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d1e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d23:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d26:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d29:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d2e:	89 df                	mov    %ebx,%edi
+  800d30:	6a 00                	push   $0x0
+  800d32:	55                   	push   %ebp
+  800d33:	56                   	push   %esi
+  800d34:	89 e5                	mov    %esp,%ebp
+  800d36:	8d 35 3e 0d 80 00    	lea    0x800d3e,%esi
+  800d3c:	0f 34                	sysenter
+
+00800d3e <after_sysenter_label_704>:
+  800d3e:	5e                   	pop    %esi
+  800d3f:	5d                   	pop    %ebp
+  800d40:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d43:	85 c0                	test   %eax,%eax
+  800d45:	7f 07                	jg     800d4e <after_sysenter_label_704+0x10>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d47:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d4a:	5b                   	pop    %ebx
+  800d4b:	5f                   	pop    %edi
+  800d4c:	5d                   	pop    %ebp
+  800d4d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d4e:	83 ec 0c             	sub    $0xc,%esp
+  800d51:	50                   	push   %eax
+  800d52:	6a 06                	push   $0x6
+  800d54:	68 b5 4b 80 00       	push   $0x804bb5
+  800d59:	6a 54                	push   $0x54
+  800d5b:	68 d2 4b 80 00       	push   $0x804bd2
+  800d60:	e8 fb 2e 00 00       	call   803c60 <_panic>
+
+00800d65 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800d65:	55                   	push   %ebp
+  800d66:	89 e5                	mov    %esp,%ebp
+  800d68:	57                   	push   %edi
+  800d69:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800d6a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d6f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d72:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d75:	b8 08 00 00 00       	mov    $0x8,%eax
+  800d7a:	89 df                	mov    %ebx,%edi
+  800d7c:	6a 00                	push   $0x0
+  800d7e:	55                   	push   %ebp
+  800d7f:	56                   	push   %esi
+  800d80:	89 e5                	mov    %esp,%ebp
+  800d82:	8d 35 8a 0d 80 00    	lea    0x800d8a,%esi
+  800d88:	0f 34                	sysenter
+
+00800d8a <after_sysenter_label_808>:
+  800d8a:	5e                   	pop    %esi
+  800d8b:	5d                   	pop    %ebp
+  800d8c:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800d8f:	85 c0                	test   %eax,%eax
+  800d91:	7f 07                	jg     800d9a <after_sysenter_label_808+0x10>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800d93:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d96:	5b                   	pop    %ebx
+  800d97:	5f                   	pop    %edi
+  800d98:	5d                   	pop    %ebp
+  800d99:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d9a:	83 ec 0c             	sub    $0xc,%esp
+  800d9d:	50                   	push   %eax
+  800d9e:	6a 08                	push   $0x8
+  800da0:	68 b5 4b 80 00       	push   $0x804bb5
+  800da5:	6a 54                	push   $0x54
+  800da7:	68 d2 4b 80 00       	push   $0x804bd2
+  800dac:	e8 af 2e 00 00       	call   803c60 <_panic>
+
+00800db1 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800db1:	55                   	push   %ebp
+  800db2:	89 e5                	mov    %esp,%ebp
+  800db4:	57                   	push   %edi
+  800db5:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800db6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dbb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dbe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dc1:	b8 09 00 00 00       	mov    $0x9,%eax
+  800dc6:	89 df                	mov    %ebx,%edi
+  800dc8:	6a 00                	push   $0x0
+  800dca:	55                   	push   %ebp
+  800dcb:	56                   	push   %esi
+  800dcc:	89 e5                	mov    %esp,%ebp
+  800dce:	8d 35 d6 0d 80 00    	lea    0x800dd6,%esi
+  800dd4:	0f 34                	sysenter
+
+00800dd6 <after_sysenter_label_912>:
+  800dd6:	5e                   	pop    %esi
+  800dd7:	5d                   	pop    %ebp
+  800dd8:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800ddb:	85 c0                	test   %eax,%eax
+  800ddd:	7f 07                	jg     800de6 <after_sysenter_label_912+0x10>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800ddf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800de2:	5b                   	pop    %ebx
+  800de3:	5f                   	pop    %edi
+  800de4:	5d                   	pop    %ebp
+  800de5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800de6:	83 ec 0c             	sub    $0xc,%esp
+  800de9:	50                   	push   %eax
+  800dea:	6a 09                	push   $0x9
+  800dec:	68 b5 4b 80 00       	push   $0x804bb5
+  800df1:	6a 54                	push   $0x54
+  800df3:	68 d2 4b 80 00       	push   $0x804bd2
+  800df8:	e8 63 2e 00 00       	call   803c60 <_panic>
+
+00800dfd <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800dfd:	55                   	push   %ebp
+  800dfe:	89 e5                	mov    %esp,%ebp
+  800e00:	57                   	push   %edi
+  800e01:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e02:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e07:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e0a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e0d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e12:	89 df                	mov    %ebx,%edi
+  800e14:	6a 00                	push   $0x0
+  800e16:	55                   	push   %ebp
+  800e17:	56                   	push   %esi
+  800e18:	89 e5                	mov    %esp,%ebp
+  800e1a:	8d 35 22 0e 80 00    	lea    0x800e22,%esi
+  800e20:	0f 34                	sysenter
+
+00800e22 <after_sysenter_label_1016>:
+  800e22:	5e                   	pop    %esi
+  800e23:	5d                   	pop    %ebp
+  800e24:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e27:	85 c0                	test   %eax,%eax
+  800e29:	7f 07                	jg     800e32 <after_sysenter_label_1016+0x10>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800e2b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e2e:	5b                   	pop    %ebx
+  800e2f:	5f                   	pop    %edi
+  800e30:	5d                   	pop    %ebp
+  800e31:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e32:	83 ec 0c             	sub    $0xc,%esp
+  800e35:	50                   	push   %eax
+  800e36:	6a 0a                	push   $0xa
+  800e38:	68 b5 4b 80 00       	push   $0x804bb5
+  800e3d:	6a 54                	push   $0x54
+  800e3f:	68 d2 4b 80 00       	push   $0x804bd2
+  800e44:	e8 17 2e 00 00       	call   803c60 <_panic>
+
+00800e49 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800e49:	55                   	push   %ebp
+  800e4a:	89 e5                	mov    %esp,%ebp
+  800e4c:	57                   	push   %edi
+  800e4d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e4e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e51:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e54:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800e59:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e5c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e5f:	6a 00                	push   $0x0
+  800e61:	55                   	push   %ebp
+  800e62:	56                   	push   %esi
+  800e63:	89 e5                	mov    %esp,%ebp
+  800e65:	8d 35 6d 0e 80 00    	lea    0x800e6d,%esi
+  800e6b:	0f 34                	sysenter
+
+00800e6d <after_sysenter_label_1126>:
+  800e6d:	5e                   	pop    %esi
+  800e6e:	5d                   	pop    %ebp
+  800e6f:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800e72:	5b                   	pop    %ebx
+  800e73:	5f                   	pop    %edi
+  800e74:	5d                   	pop    %ebp
+  800e75:	c3                   	ret
+
+00800e76 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800e76:	55                   	push   %ebp
+  800e77:	89 e5                	mov    %esp,%ebp
+  800e79:	57                   	push   %edi
+  800e7a:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800e7b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e7e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e83:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e88:	89 cb                	mov    %ecx,%ebx
+  800e8a:	89 cf                	mov    %ecx,%edi
+  800e8c:	6a 00                	push   $0x0
+  800e8e:	55                   	push   %ebp
+  800e8f:	56                   	push   %esi
+  800e90:	89 e5                	mov    %esp,%ebp
+  800e92:	8d 35 9a 0e 80 00    	lea    0x800e9a,%esi
+  800e98:	0f 34                	sysenter
+
+00800e9a <after_sysenter_label_1210>:
+  800e9a:	5e                   	pop    %esi
+  800e9b:	5d                   	pop    %ebp
+  800e9c:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800e9f:	85 c0                	test   %eax,%eax
+  800ea1:	7f 07                	jg     800eaa <after_sysenter_label_1210+0x10>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800ea3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ea6:	5b                   	pop    %ebx
+  800ea7:	5f                   	pop    %edi
+  800ea8:	5d                   	pop    %ebp
+  800ea9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eaa:	83 ec 0c             	sub    $0xc,%esp
+  800ead:	50                   	push   %eax
+  800eae:	6a 0d                	push   $0xd
+  800eb0:	68 b5 4b 80 00       	push   $0x804bb5
+  800eb5:	6a 54                	push   $0x54
+  800eb7:	68 d2 4b 80 00       	push   $0x804bd2
+  800ebc:	e8 9f 2d 00 00       	call   803c60 <_panic>
+
+00800ec1 <sys_exec>:
+
+int
+sys_exec(const char *pathname, const char *argv[])
+{
+  800ec1:	55                   	push   %ebp
+  800ec2:	89 e5                	mov    %esp,%ebp
+  800ec4:	57                   	push   %edi
+  800ec5:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ec6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ecb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ece:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ed1:	b8 42 00 00 00       	mov    $0x42,%eax
+  800ed6:	89 df                	mov    %ebx,%edi
+  800ed8:	6a 00                	push   $0x0
+  800eda:	55                   	push   %ebp
+  800edb:	56                   	push   %esi
+  800edc:	89 e5                	mov    %esp,%ebp
+  800ede:	8d 35 e6 0e 80 00    	lea    0x800ee6,%esi
+  800ee4:	0f 34                	sysenter
+
+00800ee6 <after_sysenter_label_1311>:
+  800ee6:	5e                   	pop    %esi
+  800ee7:	5d                   	pop    %ebp
+  800ee8:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  800eeb:	85 c0                	test   %eax,%eax
+  800eed:	7f 07                	jg     800ef6 <after_sysenter_label_1311+0x10>
+	return syscall(SYS_exec, 1, (uint32_t)pathname, (uint32_t)argv, 0, 0, 0);
+}
+  800eef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ef2:	5b                   	pop    %ebx
+  800ef3:	5f                   	pop    %edi
+  800ef4:	5d                   	pop    %ebp
+  800ef5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ef6:	83 ec 0c             	sub    $0xc,%esp
+  800ef9:	50                   	push   %eax
+  800efa:	6a 42                	push   $0x42
+  800efc:	68 b5 4b 80 00       	push   $0x804bb5
+  800f01:	6a 54                	push   $0x54
+  800f03:	68 d2 4b 80 00       	push   $0x804bd2
+  800f08:	e8 53 2d 00 00       	call   803c60 <_panic>
+
+00800f0d <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800f0d:	55                   	push   %ebp
+  800f0e:	89 e5                	mov    %esp,%ebp
+  800f10:	57                   	push   %edi
+  800f11:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f12:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f17:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800f1c:	89 d1                	mov    %edx,%ecx
+  800f1e:	89 d3                	mov    %edx,%ebx
+  800f20:	89 d7                	mov    %edx,%edi
+  800f22:	6a 00                	push   $0x0
+  800f24:	55                   	push   %ebp
+  800f25:	56                   	push   %esi
+  800f26:	89 e5                	mov    %esp,%ebp
+  800f28:	8d 35 30 0f 80 00    	lea    0x800f30,%esi
+  800f2e:	0f 34                	sysenter
+
+00800f30 <after_sysenter_label_1411>:
+  800f30:	5e                   	pop    %esi
+  800f31:	5d                   	pop    %ebp
+  800f32:	83 c4 04             	add    $0x4,%esp
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800f35:	5b                   	pop    %ebx
+  800f36:	5f                   	pop    %edi
+  800f37:	5d                   	pop    %ebp
+  800f38:	c3                   	ret
+
+00800f39 <sys_net_try_send>:
+
+int
+sys_net_try_send(const uint8_t* buf, size_t length)
+{
+  800f39:	55                   	push   %ebp
+  800f3a:	89 e5                	mov    %esp,%ebp
+  800f3c:	57                   	push   %edi
+  800f3d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f3e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f43:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f46:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f49:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f4e:	89 df                	mov    %ebx,%edi
+  800f50:	6a 00                	push   $0x0
+  800f52:	55                   	push   %ebp
+  800f53:	56                   	push   %esi
+  800f54:	89 e5                	mov    %esp,%ebp
+  800f56:	8d 35 5e 0f 80 00    	lea    0x800f5e,%esi
+  800f5c:	0f 34                	sysenter
+
+00800f5e <after_sysenter_label_1497>:
+  800f5e:	5e                   	pop    %esi
+  800f5f:	5d                   	pop    %ebp
+  800f60:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_send, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  800f63:	5b                   	pop    %ebx
+  800f64:	5f                   	pop    %edi
+  800f65:	5d                   	pop    %ebp
+  800f66:	c3                   	ret
+
+00800f67 <sys_net_try_recv>:
+
+int
+sys_net_try_recv(uint8_t* buf, size_t length)
+{
+  800f67:	55                   	push   %ebp
+  800f68:	89 e5                	mov    %esp,%ebp
+  800f6a:	57                   	push   %edi
+  800f6b:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f6c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f71:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f74:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f77:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f7c:	89 df                	mov    %ebx,%edi
+  800f7e:	6a 00                	push   $0x0
+  800f80:	55                   	push   %ebp
+  800f81:	56                   	push   %esi
+  800f82:	89 e5                	mov    %esp,%ebp
+  800f84:	8d 35 8c 0f 80 00    	lea    0x800f8c,%esi
+  800f8a:	0f 34                	sysenter
+
+00800f8c <after_sysenter_label_1583>:
+  800f8c:	5e                   	pop    %esi
+  800f8d:	5d                   	pop    %ebp
+  800f8e:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_net_try_recv, 0, (uint32_t)buf, length, 0, 0, 0);
+}
+  800f91:	5b                   	pop    %ebx
+  800f92:	5f                   	pop    %edi
+  800f93:	5d                   	pop    %ebp
+  800f94:	c3                   	ret
+
+00800f95 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t timeout)
+{
+  800f95:	55                   	push   %ebp
+  800f96:	89 e5                	mov    %esp,%ebp
+  800f98:	57                   	push   %edi
+  800f99:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800f9a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f9d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa0:	b8 11 00 00 00       	mov    $0x11,%eax
+  800fa5:	bf 00 00 00 00       	mov    $0x0,%edi
+  800faa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fad:	6a 00                	push   $0x0
+  800faf:	55                   	push   %ebp
+  800fb0:	56                   	push   %esi
+  800fb1:	89 e5                	mov    %esp,%ebp
+  800fb3:	8d 35 bb 0f 80 00    	lea    0x800fbb,%esi
+  800fb9:	0f 34                	sysenter
+
+00800fbb <after_sysenter_label_1672>:
+  800fbb:	5e                   	pop    %esi
+  800fbc:	5d                   	pop    %ebp
+  800fbd:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wait, 0, (uint32_t)addr, val, timeout, 0, 0);
+}
+  800fc0:	5b                   	pop    %ebx
+  800fc1:	5f                   	pop    %edi
+  800fc2:	5d                   	pop    %ebp
+  800fc3:	c3                   	ret
+
+00800fc4 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  800fc4:	55                   	push   %ebp
+  800fc5:	89 e5                	mov    %esp,%ebp
+  800fc7:	57                   	push   %edi
+  800fc8:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800fc9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fce:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fd4:	b8 12 00 00 00       	mov    $0x12,%eax
+  800fd9:	89 df                	mov    %ebx,%edi
+  800fdb:	6a 00                	push   $0x0
+  800fdd:	55                   	push   %ebp
+  800fde:	56                   	push   %esi
+  800fdf:	89 e5                	mov    %esp,%ebp
+  800fe1:	8d 35 e9 0f 80 00    	lea    0x800fe9,%esi
+  800fe7:	0f 34                	sysenter
+
+00800fe9 <after_sysenter_label_1758>:
+  800fe9:	5e                   	pop    %esi
+  800fea:	5d                   	pop    %ebp
+  800feb:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_futex_wake, 0, (uint32_t)addr, n, 0, 0, 0);
+}
+  800fee:	5b                   	pop    %ebx
+  800fef:	5f                   	pop    %edi
+  800ff0:	5d                   	pop    %ebp
+  800ff1:	c3                   	ret
+
+00800ff2 <sys_uring_setup>:
+
+int
+sys_uring_setup(struct Uring *u)
+{
+  800ff2:	55                   	push   %ebp
+  800ff3:	89 e5                	mov    %esp,%ebp
+  800ff5:	57                   	push   %edi
+  800ff6:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  800ff7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ffa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fff:	b8 13 00 00 00       	mov    $0x13,%eax
+  801004:	89 cb                	mov    %ecx,%ebx
+  801006:	89 cf                	mov    %ecx,%edi
+  801008:	6a 00                	push   $0x0
+  80100a:	55                   	push   %ebp
+  80100b:	56                   	push   %esi
+  80100c:	89 e5                	mov    %esp,%ebp
+  80100e:	8d 35 16 10 80 00    	lea    0x801016,%esi
+  801014:	0f 34                	sysenter
+
+00801016 <after_sysenter_label_1842>:
+  801016:	5e                   	pop    %esi
+  801017:	5d                   	pop    %ebp
+  801018:	83 c4 04             	add    $0x4,%esp
+	if(check && ret > 0)
+  80101b:	85 c0                	test   %eax,%eax
+  80101d:	7f 07                	jg     801026 <after_sysenter_label_1842+0x10>
+	return syscall(SYS_uring_setup, 1, (uint32_t)u, 0, 0, 0, 0);
+}
+  80101f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801022:	5b                   	pop    %ebx
+  801023:	5f                   	pop    %edi
+  801024:	5d                   	pop    %ebp
+  801025:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801026:	83 ec 0c             	sub    $0xc,%esp
+  801029:	50                   	push   %eax
+  80102a:	6a 13                	push   $0x13
+  80102c:	68 b5 4b 80 00       	push   $0x804bb5
+  801031:	6a 54                	push   $0x54
+  801033:	68 d2 4b 80 00       	push   $0x804bd2
+  801038:	e8 23 2c 00 00       	call   803c60 <_panic>
+
+0080103d <sys_uring_enter>:
+
+int
+sys_uring_enter(void)
+{
+  80103d:	55                   	push   %ebp
+  80103e:	89 e5                	mov    %esp,%ebp
+  801040:	57                   	push   %edi
+  801041:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  801042:	ba 00 00 00 00       	mov    $0x0,%edx
+  801047:	b8 14 00 00 00       	mov    $0x14,%eax
+  80104c:	89 d1                	mov    %edx,%ecx
+  80104e:	89 d3                	mov    %edx,%ebx
+  801050:	89 d7                	mov    %edx,%edi
+  801052:	6a 00                	push   $0x0
+  801054:	55                   	push   %ebp
+  801055:	56                   	push   %esi
+  801056:	89 e5                	mov    %esp,%ebp
+  801058:	8d 35 60 10 80 00    	lea    0x801060,%esi
+  80105e:	0f 34                	sysenter
+
+00801060 <after_sysenter_label_1939>:
+  801060:	5e                   	pop    %esi
+  801061:	5d                   	pop    %ebp
+  801062:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_uring_enter, 0, 0, 0, 0, 0, 0);
+}
+  801065:	5b                   	pop    %ebx
+  801066:	5f                   	pop    %edi
+  801067:	5d                   	pop    %ebp
+  801068:	c3                   	ret
+
+00801069 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void (*entry)(void), uintptr_t esp, uintptr_t uxstacktop)
+{
+  801069:	55                   	push   %ebp
+  80106a:	89 e5                	mov    %esp,%ebp
+  80106c:	57                   	push   %edi
+  80106d:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80106e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801071:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801074:	b8 15 00 00 00       	mov    $0x15,%eax
+  801079:	bf 00 00 00 00       	mov    $0x0,%edi
+  80107e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801081:	6a 00                	push   $0x0
+  801083:	55                   	push   %ebp
+  801084:	56                   	push   %esi
+  801085:	89 e5                	mov    %esp,%ebp
+  801087:	8d 35 8f 10 80 00    	lea    0x80108f,%esi
+  80108d:	0f 34                	sysenter
+
+0080108f <after_sysenter_label_2028>:
+  80108f:	5e                   	pop    %esi
+  801090:	5d                   	pop    %ebp
+  801091:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_thread_create, 0, (uint32_t)entry, esp, uxstacktop, 0, 0);
+}
+  801094:	5b                   	pop    %ebx
+  801095:	5f                   	pop    %edi
+  801096:	5d                   	pop    %ebp
+  801097:	c3                   	ret
+
+00801098 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile uint32_t *counter)
+{
+  801098:	55                   	push   %ebp
+  801099:	89 e5                	mov    %esp,%ebp
+  80109b:	57                   	push   %edi
+  80109c:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  80109d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010a2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a8:	b8 16 00 00 00       	mov    $0x16,%eax
+  8010ad:	89 df                	mov    %ebx,%edi
+  8010af:	6a 00                	push   $0x0
+  8010b1:	55                   	push   %ebp
+  8010b2:	56                   	push   %esi
+  8010b3:	89 e5                	mov    %esp,%ebp
+  8010b5:	8d 35 bd 10 80 00    	lea    0x8010bd,%esi
+  8010bb:	0f 34                	sysenter
+
+008010bd <after_sysenter_label_2114>:
+  8010bd:	5e                   	pop    %esi
+  8010be:	5d                   	pop    %ebp
+  8010bf:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_irq_listen, 0, irq, (uint32_t)counter, 0, 0, 0);
+}
+  8010c2:	5b                   	pop    %ebx
+  8010c3:	5f                   	pop    %edi
+  8010c4:	5d                   	pop    %ebp
+  8010c5:	c3                   	ret
+
+008010c6 <sys_pci_storage>:
+
+int
+sys_pci_storage(int i, struct PciDev *pd)
+{
+  8010c6:	55                   	push   %ebp
+  8010c7:	89 e5                	mov    %esp,%ebp
+  8010c9:	57                   	push   %edi
+  8010ca:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010d6:	b8 17 00 00 00       	mov    $0x17,%eax
+  8010db:	89 df                	mov    %ebx,%edi
+  8010dd:	6a 00                	push   $0x0
+  8010df:	55                   	push   %ebp
+  8010e0:	56                   	push   %esi
+  8010e1:	89 e5                	mov    %esp,%ebp
+  8010e3:	8d 35 eb 10 80 00    	lea    0x8010eb,%esi
+  8010e9:	0f 34                	sysenter
+
+008010eb <after_sysenter_label_2200>:
+  8010eb:	5e                   	pop    %esi
+  8010ec:	5d                   	pop    %ebp
+  8010ed:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_pci_storage, 0, i, (uint32_t)pd, 0, 0, 0);
+}
+  8010f0:	5b                   	pop    %ebx
+  8010f1:	5f                   	pop    %edi
+  8010f2:	5d                   	pop    %ebp
+  8010f3:	c3                   	ret
+
+008010f4 <sys_dma_map>:
+
+int
+sys_dma_map(void *va, size_t npages)
+{
+  8010f4:	55                   	push   %ebp
+  8010f5:	89 e5                	mov    %esp,%ebp
+  8010f7:	57                   	push   %edi
+  8010f8:	53                   	push   %ebx
+	asm volatile("pushl %[a5];"
+  8010f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010fe:	8b 55 08             	mov    0x8(%ebp),%edx
+  801101:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801104:	b8 18 00 00 00       	mov    $0x18,%eax
+  801109:	89 df                	mov    %ebx,%edi
+  80110b:	6a 00                	push   $0x0
+  80110d:	55                   	push   %ebp
+  80110e:	56                   	push   %esi
+  80110f:	89 e5                	mov    %esp,%ebp
+  801111:	8d 35 19 11 80 00    	lea    0x801119,%esi
+  801117:	0f 34                	sysenter
+
+00801119 <after_sysenter_label_2286>:
+  801119:	5e                   	pop    %esi
+  80111a:	5d                   	pop    %ebp
+  80111b:	83 c4 04             	add    $0x4,%esp
+	return syscall(SYS_dma_map, 0, (uint32_t)va, npages, 0, 0, 0);
+}
+  80111e:	5b                   	pop    %ebx
+  80111f:	5f                   	pop    %edi
+  801120:	5d                   	pop    %ebp
+  801121:	c3                   	ret
+
+00801122 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801122:	55                   	push   %ebp
+  801123:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801125:	8b 45 08             	mov    0x8(%ebp),%eax
+  801128:	05 00 00 00 30       	add    $0x30000000,%eax
+  80112d:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801130:	5d                   	pop    %ebp
+  801131:	c3                   	ret
+
+00801132 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801132:	55                   	push   %ebp
+  801133:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801135:	8b 45 08             	mov    0x8(%ebp),%eax
+  801138:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80113d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801142:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801147:	5d                   	pop    %ebp
+  801148:	c3                   	ret
+
+00801149 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801149:	55                   	push   %ebp
+  80114a:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80114c:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801151:	eb 02                	jmp    801155 <fd_alloc+0xc>
+  801153:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801155:	89 c2                	mov    %eax,%edx
+  801157:	c1 ea 16             	shr    $0x16,%edx
+  80115a:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801161:	f6 c2 01             	test   $0x1,%dl
+  801164:	74 2b                	je     801191 <fd_alloc+0x48>
+  801166:	89 c2                	mov    %eax,%edx
+  801168:	c1 ea 0c             	shr    $0xc,%edx
+  80116b:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801172:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801178:	f6 c1 01             	test   $0x1,%cl
+  80117b:	74 14                	je     801191 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80117d:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801183:	75 ce                	jne    801153 <fd_alloc+0xa>
+  801185:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80118a:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80118f:	eb 05                	jmp    801196 <fd_alloc+0x4d>
+			return 0;
+  801191:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801196:	8b 55 08             	mov    0x8(%ebp),%edx
+  801199:	89 02                	mov    %eax,(%edx)
+}
+  80119b:	89 c8                	mov    %ecx,%eax
+  80119d:	5d                   	pop    %ebp
+  80119e:	c3                   	ret
+
+0080119f <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80119f:	55                   	push   %ebp
+  8011a0:	89 e5                	mov    %esp,%ebp
+  8011a2:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8011a5:	83 f8 1f             	cmp    $0x1f,%eax
+  8011a8:	77 30                	ja     8011da <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8011aa:	c1 e0 0c             	shl    $0xc,%eax
+  8011ad:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8011b2:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8011b8:	f6 c2 01             	test   $0x1,%dl
+  8011bb:	74 24                	je     8011e1 <fd_lookup+0x42>
+  8011bd:	89 c2                	mov    %eax,%edx
+  8011bf:	c1 ea 0c             	shr    $0xc,%edx
+  8011c2:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8011c9:	f6 c2 01             	test   $0x1,%dl
+  8011cc:	74 1a                	je     8011e8 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8011ce:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8011d1:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8011d3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011d8:	5d                   	pop    %ebp
+  8011d9:	c3                   	ret
+		return -E_INVAL;
+  8011da:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011df:	eb f7                	jmp    8011d8 <fd_lookup+0x39>
+		return -E_INVAL;
+  8011e1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011e6:	eb f0                	jmp    8011d8 <fd_lookup+0x39>
+  8011e8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011ed:	eb e9                	jmp    8011d8 <fd_lookup+0x39>
+
+008011ef <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8011ef:	55                   	push   %ebp
+  8011f0:	89 e5                	mov    %esp,%ebp
+  8011f2:	53                   	push   %ebx
+  8011f3:	83 ec 04             	sub    $0x4,%esp
+  8011f6:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8011f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011fe:	eb 03                	jmp    801203 <dev_lookup+0x14>
+  801200:	83 c0 01             	add    $0x1,%eax
+  801203:	8b 1c 85 5c 4c 80 00 	mov    0x804c5c(,%eax,4),%ebx
+  80120a:	85 db                	test   %ebx,%ebx
+  80120c:	74 0b                	je     801219 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80120e:	39 13                	cmp    %edx,(%ebx)
+  801210:	75 ee                	jne    801200 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801212:	b8 00 00 00 00       	mov    $0x0,%eax
+  801217:	eb 49                	jmp    801262 <dev_lookup+0x73>
+  801219:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80121b:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  801221:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801226:	77 18                	ja     801240 <dev_lookup+0x51>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801228:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80122d:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  80122f:	c1 e8 10             	shr    $0x10,%eax
+  801232:	74 0c                	je     801240 <dev_lookup+0x51>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  801234:	c1 e0 10             	shl    $0x10,%eax
+  801237:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80123c:	29 c1                	sub    %eax,%ecx
+  80123e:	eb 06                	jmp    801246 <dev_lookup+0x57>
+		return pthread_main_tls;
+  801240:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801246:	8b 01                	mov    (%ecx),%eax
+  801248:	8b 40 48             	mov    0x48(%eax),%eax
+  80124b:	83 ec 04             	sub    $0x4,%esp
+  80124e:	52                   	push   %edx
+  80124f:	50                   	push   %eax
+  801250:	68 e0 4b 80 00       	push   $0x804be0
+  801255:	e8 04 f0 ff ff       	call   80025e <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80125a:	83 c4 10             	add    $0x10,%esp
+  80125d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801262:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801265:	89 1a                	mov    %ebx,(%edx)
+}
+  801267:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80126a:	c9                   	leave
+  80126b:	c3                   	ret
+
+0080126c <fd_close>:
+{
+  80126c:	55                   	push   %ebp
+  80126d:	89 e5                	mov    %esp,%ebp
+  80126f:	57                   	push   %edi
+  801270:	56                   	push   %esi
+  801271:	53                   	push   %ebx
+  801272:	83 ec 24             	sub    $0x24,%esp
+  801275:	8b 75 08             	mov    0x8(%ebp),%esi
+  801278:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80127b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80127e:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80127f:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801285:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801288:	50                   	push   %eax
+  801289:	e8 11 ff ff ff       	call   80119f <fd_lookup>
+  80128e:	89 c3                	mov    %eax,%ebx
+  801290:	83 c4 10             	add    $0x10,%esp
+  801293:	85 c0                	test   %eax,%eax
+  801295:	78 05                	js     80129c <fd_close+0x30>
+	    || fd != fd2)
+  801297:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80129a:	74 16                	je     8012b2 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80129c:	89 f8                	mov    %edi,%eax
+  80129e:	84 c0                	test   %al,%al
+  8012a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012a5:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8012a8:	89 d8                	mov    %ebx,%eax
+  8012aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012ad:	5b                   	pop    %ebx
+  8012ae:	5e                   	pop    %esi
+  8012af:	5f                   	pop    %edi
+  8012b0:	5d                   	pop    %ebp
+  8012b1:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8012b2:	83 ec 08             	sub    $0x8,%esp
+  8012b5:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8012b8:	50                   	push   %eax
+  8012b9:	ff 36                	push   (%esi)
+  8012bb:	e8 2f ff ff ff       	call   8011ef <dev_lookup>
+  8012c0:	89 c3                	mov    %eax,%ebx
+  8012c2:	83 c4 10             	add    $0x10,%esp
+  8012c5:	85 c0                	test   %eax,%eax
+  8012c7:	78 1a                	js     8012e3 <fd_close+0x77>
+		if (dev->dev_close)
+  8012c9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8012cc:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8012cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8012d4:	85 c0                	test   %eax,%eax
+  8012d6:	74 0b                	je     8012e3 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8012d8:	83 ec 0c             	sub    $0xc,%esp
+  8012db:	56                   	push   %esi
+  8012dc:	ff d0                	call   *%eax
+  8012de:	89 c3                	mov    %eax,%ebx
+  8012e0:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8012e3:	83 ec 08             	sub    $0x8,%esp
+  8012e6:	56                   	push   %esi
+  8012e7:	6a 00                	push   $0x0
+  8012e9:	e8 2b fa ff ff       	call   800d19 <sys_page_unmap>
+	return r;
+  8012ee:	83 c4 10             	add    $0x10,%esp
+  8012f1:	eb b5                	jmp    8012a8 <fd_close+0x3c>
+
+008012f3 <close>:
+
+int
+close(int fdnum)
+{
+  8012f3:	55                   	push   %ebp
+  8012f4:	89 e5                	mov    %esp,%ebp
+  8012f6:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8012f9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8012fc:	50                   	push   %eax
+  8012fd:	ff 75 08             	push   0x8(%ebp)
+  801300:	e8 9a fe ff ff       	call   80119f <fd_lookup>
+  801305:	83 c4 10             	add    $0x10,%esp
+  801308:	85 c0                	test   %eax,%eax
+  80130a:	79 02                	jns    80130e <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80130c:	c9                   	leave
+  80130d:	c3                   	ret
+		return fd_close(fd, 1);
+  80130e:	83 ec 08             	sub    $0x8,%esp
+  801311:	6a 01                	push   $0x1
+  801313:	ff 75 f4             	push   -0xc(%ebp)
+  801316:	e8 51 ff ff ff       	call   80126c <fd_close>
+  80131b:	83 c4 10             	add    $0x10,%esp
+  80131e:	eb ec                	jmp    80130c <close+0x19>
+
+00801320 <close_all>:
+
+void
+close_all(void)
+{
+  801320:	55                   	push   %ebp
+  801321:	89 e5                	mov    %esp,%ebp
+  801323:	53                   	push   %ebx
+  801324:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801327:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80132c:	83 ec 0c             	sub    $0xc,%esp
+  80132f:	53                   	push   %ebx
+  801330:	e8 be ff ff ff       	call   8012f3 <close>
+	for (i = 0; i < MAXFD; i++)
+  801335:	83 c3 01             	add    $0x1,%ebx
+  801338:	83 c4 10             	add    $0x10,%esp
+  80133b:	83 fb 20             	cmp    $0x20,%ebx
+  80133e:	75 ec                	jne    80132c <close_all+0xc>
+}
+  801340:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801343:	c9                   	leave
+  801344:	c3                   	ret
+
+00801345 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801345:	55                   	push   %ebp
+  801346:	89 e5                	mov    %esp,%ebp
+  801348:	57                   	push   %edi
+  801349:	56                   	push   %esi
+  80134a:	53                   	push   %ebx
+  80134b:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80134e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801351:	50                   	push   %eax
+  801352:	ff 75 08             	push   0x8(%ebp)
+  801355:	e8 45 fe ff ff       	call   80119f <fd_lookup>
+  80135a:	89 c3                	mov    %eax,%ebx
+  80135c:	83 c4 10             	add    $0x10,%esp
+  80135f:	85 c0                	test   %eax,%eax
+  801361:	78 7f                	js     8013e2 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801363:	83 ec 0c             	sub    $0xc,%esp
+  801366:	ff 75 0c             	push   0xc(%ebp)
+  801369:	e8 85 ff ff ff       	call   8012f3 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80136e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801371:	c1 e6 0c             	shl    $0xc,%esi
+  801374:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80137a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80137d:	89 3c 24             	mov    %edi,(%esp)
+  801380:	e8 ad fd ff ff       	call   801132 <fd2data>
+  801385:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801387:	89 34 24             	mov    %esi,(%esp)
+  80138a:	e8 a3 fd ff ff       	call   801132 <fd2data>
+  80138f:	83 c4 10             	add    $0x10,%esp
+  801392:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801395:	89 d8                	mov    %ebx,%eax
+  801397:	c1 e8 16             	shr    $0x16,%eax
+  80139a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8013a1:	a8 01                	test   $0x1,%al
+  8013a3:	74 11                	je     8013b6 <dup+0x71>
+  8013a5:	89 d8                	mov    %ebx,%eax
+  8013a7:	c1 e8 0c             	shr    $0xc,%eax
+  8013aa:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8013b1:	f6 c2 01             	test   $0x1,%dl
+  8013b4:	75 36                	jne    8013ec <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8013b6:	89 f8                	mov    %edi,%eax
+  8013b8:	c1 e8 0c             	shr    $0xc,%eax
+  8013bb:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8013c2:	83 ec 0c             	sub    $0xc,%esp
+  8013c5:	25 07 0e 00 00       	and    $0xe07,%eax
+  8013ca:	50                   	push   %eax
+  8013cb:	56                   	push   %esi
+  8013cc:	6a 00                	push   $0x0
+  8013ce:	57                   	push   %edi
+  8013cf:	6a 00                	push   $0x0
+  8013d1:	e8 f7 f8 ff ff       	call   800ccd <sys_page_map>
+  8013d6:	89 c3                	mov    %eax,%ebx
+  8013d8:	83 c4 20             	add    $0x20,%esp
+  8013db:	85 c0                	test   %eax,%eax
+  8013dd:	78 33                	js     801412 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8013df:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8013e2:	89 d8                	mov    %ebx,%eax
+  8013e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013e7:	5b                   	pop    %ebx
+  8013e8:	5e                   	pop    %esi
+  8013e9:	5f                   	pop    %edi
+  8013ea:	5d                   	pop    %ebp
+  8013eb:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8013ec:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8013f3:	83 ec 0c             	sub    $0xc,%esp
+  8013f6:	25 07 0e 00 00       	and    $0xe07,%eax
+  8013fb:	50                   	push   %eax
+  8013fc:	ff 75 d4             	push   -0x2c(%ebp)
+  8013ff:	6a 00                	push   $0x0
+  801401:	53                   	push   %ebx
+  801402:	6a 00                	push   $0x0
+  801404:	e8 c4 f8 ff ff       	call   800ccd <sys_page_map>
+  801409:	89 c3                	mov    %eax,%ebx
+  80140b:	83 c4 20             	add    $0x20,%esp
+  80140e:	85 c0                	test   %eax,%eax
+  801410:	79 a4                	jns    8013b6 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801412:	83 ec 08             	sub    $0x8,%esp
+  801415:	56                   	push   %esi
+  801416:	6a 00                	push   $0x0
+  801418:	e8 fc f8 ff ff       	call   800d19 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80141d:	83 c4 08             	add    $0x8,%esp
+  801420:	ff 75 d4             	push   -0x2c(%ebp)
+  801423:	6a 00                	push   $0x0
+  801425:	e8 ef f8 ff ff       	call   800d19 <sys_page_unmap>
+	return r;
+  80142a:	83 c4 10             	add    $0x10,%esp
+  80142d:	eb b3                	jmp    8013e2 <dup+0x9d>
+
+0080142f <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80142f:	55                   	push   %ebp
+  801430:	89 e5                	mov    %esp,%ebp
+  801432:	56                   	push   %esi
+  801433:	53                   	push   %ebx
+  801434:	83 ec 18             	sub    $0x18,%esp
+  801437:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80143a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80143d:	50                   	push   %eax
+  80143e:	53                   	push   %ebx
+  80143f:	e8 5b fd ff ff       	call   80119f <fd_lookup>
+  801444:	83 c4 10             	add    $0x10,%esp
+  801447:	85 c0                	test   %eax,%eax
+  801449:	78 3c                	js     801487 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80144b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80144e:	83 ec 08             	sub    $0x8,%esp
+  801451:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801454:	50                   	push   %eax
+  801455:	ff 36                	push   (%esi)
+  801457:	e8 93 fd ff ff       	call   8011ef <dev_lookup>
+  80145c:	83 c4 10             	add    $0x10,%esp
+  80145f:	85 c0                	test   %eax,%eax
+  801461:	78 24                	js     801487 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801463:	8b 46 08             	mov    0x8(%esi),%eax
+  801466:	83 e0 03             	and    $0x3,%eax
+  801469:	83 f8 01             	cmp    $0x1,%eax
+  80146c:	74 20                	je     80148e <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80146e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801471:	8b 40 08             	mov    0x8(%eax),%eax
+  801474:	85 c0                	test   %eax,%eax
+  801476:	74 61                	je     8014d9 <read+0xaa>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801478:	83 ec 04             	sub    $0x4,%esp
+  80147b:	ff 75 10             	push   0x10(%ebp)
+  80147e:	ff 75 0c             	push   0xc(%ebp)
+  801481:	56                   	push   %esi
+  801482:	ff d0                	call   *%eax
+  801484:	83 c4 10             	add    $0x10,%esp
+}
+  801487:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80148a:	5b                   	pop    %ebx
+  80148b:	5e                   	pop    %esi
+  80148c:	5d                   	pop    %ebp
+  80148d:	c3                   	ret
+  80148e:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801490:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801496:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80149b:	77 18                	ja     8014b5 <read+0x86>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80149d:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8014a2:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8014a4:	c1 e8 10             	shr    $0x10,%eax
+  8014a7:	74 0c                	je     8014b5 <read+0x86>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8014a9:	c1 e0 10             	shl    $0x10,%eax
+  8014ac:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8014b1:	29 c2                	sub    %eax,%edx
+  8014b3:	eb 06                	jmp    8014bb <read+0x8c>
+		return pthread_main_tls;
+  8014b5:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8014bb:	8b 02                	mov    (%edx),%eax
+  8014bd:	8b 40 48             	mov    0x48(%eax),%eax
+  8014c0:	83 ec 04             	sub    $0x4,%esp
+  8014c3:	53                   	push   %ebx
+  8014c4:	50                   	push   %eax
+  8014c5:	68 21 4c 80 00       	push   $0x804c21
+  8014ca:	e8 8f ed ff ff       	call   80025e <cprintf>
+		return -E_INVAL;
+  8014cf:	83 c4 10             	add    $0x10,%esp
+  8014d2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014d7:	eb ae                	jmp    801487 <read+0x58>
+		return -E_NOT_SUPP;
+  8014d9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8014de:	eb a7                	jmp    801487 <read+0x58>
+
+008014e0 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8014e0:	55                   	push   %ebp
+  8014e1:	89 e5                	mov    %esp,%ebp
+  8014e3:	57                   	push   %edi
+  8014e4:	56                   	push   %esi
+  8014e5:	53                   	push   %ebx
+  8014e6:	83 ec 0c             	sub    $0xc,%esp
+  8014e9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8014ec:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8014ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014f4:	eb 02                	jmp    8014f8 <readn+0x18>
+  8014f6:	01 c3                	add    %eax,%ebx
+  8014f8:	39 f3                	cmp    %esi,%ebx
+  8014fa:	73 21                	jae    80151d <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8014fc:	83 ec 04             	sub    $0x4,%esp
+  8014ff:	89 f0                	mov    %esi,%eax
+  801501:	29 d8                	sub    %ebx,%eax
+  801503:	50                   	push   %eax
+  801504:	89 d8                	mov    %ebx,%eax
+  801506:	03 45 0c             	add    0xc(%ebp),%eax
+  801509:	50                   	push   %eax
+  80150a:	57                   	push   %edi
+  80150b:	e8 1f ff ff ff       	call   80142f <read>
+		if (m < 0)
+  801510:	83 c4 10             	add    $0x10,%esp
+  801513:	85 c0                	test   %eax,%eax
+  801515:	78 04                	js     80151b <readn+0x3b>
+			return m;
+		if (m == 0)
+  801517:	75 dd                	jne    8014f6 <readn+0x16>
+  801519:	eb 02                	jmp    80151d <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80151b:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80151d:	89 d8                	mov    %ebx,%eax
+  80151f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801522:	5b                   	pop    %ebx
+  801523:	5e                   	pop    %esi
+  801524:	5f                   	pop    %edi
+  801525:	5d                   	pop    %ebp
+  801526:	c3                   	ret
+
+00801527 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801527:	55                   	push   %ebp
+  801528:	89 e5                	mov    %esp,%ebp
+  80152a:	56                   	push   %esi
+  80152b:	53                   	push   %ebx
+  80152c:	83 ec 18             	sub    $0x18,%esp
+  80152f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801532:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801535:	50                   	push   %eax
+  801536:	53                   	push   %ebx
+  801537:	e8 63 fc ff ff       	call   80119f <fd_lookup>
+  80153c:	83 c4 10             	add    $0x10,%esp
+  80153f:	85 c0                	test   %eax,%eax
+  801541:	78 37                	js     80157a <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801543:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801546:	83 ec 08             	sub    $0x8,%esp
+  801549:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80154c:	50                   	push   %eax
+  80154d:	ff 36                	push   (%esi)
+  80154f:	e8 9b fc ff ff       	call   8011ef <dev_lookup>
+  801554:	83 c4 10             	add    $0x10,%esp
+  801557:	85 c0                	test   %eax,%eax
+  801559:	78 1f                	js     80157a <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80155b:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80155f:	74 20                	je     801581 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801561:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801564:	8b 40 0c             	mov    0xc(%eax),%eax
+  801567:	85 c0                	test   %eax,%eax
+  801569:	74 61                	je     8015cc <write+0xa5>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80156b:	83 ec 04             	sub    $0x4,%esp
+  80156e:	ff 75 10             	push   0x10(%ebp)
+  801571:	ff 75 0c             	push   0xc(%ebp)
+  801574:	56                   	push   %esi
+  801575:	ff d0                	call   *%eax
+  801577:	83 c4 10             	add    $0x10,%esp
+}
+  80157a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80157d:	5b                   	pop    %ebx
+  80157e:	5e                   	pop    %esi
+  80157f:	5d                   	pop    %ebp
+  801580:	c3                   	ret
+  801581:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801583:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  801589:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80158e:	77 18                	ja     8015a8 <write+0x81>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801590:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801595:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801597:	c1 e8 10             	shr    $0x10,%eax
+  80159a:	74 0c                	je     8015a8 <write+0x81>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80159c:	c1 e0 10             	shl    $0x10,%eax
+  80159f:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8015a4:	29 c2                	sub    %eax,%edx
+  8015a6:	eb 06                	jmp    8015ae <write+0x87>
+		return pthread_main_tls;
+  8015a8:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8015ae:	8b 02                	mov    (%edx),%eax
+  8015b0:	8b 40 48             	mov    0x48(%eax),%eax
+  8015b3:	83 ec 04             	sub    $0x4,%esp
+  8015b6:	53                   	push   %ebx
+  8015b7:	50                   	push   %eax
+  8015b8:	68 3d 4c 80 00       	push   $0x804c3d
+  8015bd:	e8 9c ec ff ff       	call   80025e <cprintf>
+		return -E_INVAL;
+  8015c2:	83 c4 10             	add    $0x10,%esp
+  8015c5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015ca:	eb ae                	jmp    80157a <write+0x53>
+		return -E_NOT_SUPP;
+  8015cc:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015d1:	eb a7                	jmp    80157a <write+0x53>
+
+008015d3 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8015d3:	55                   	push   %ebp
+  8015d4:	89 e5                	mov    %esp,%ebp
+  8015d6:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8015d9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015dc:	50                   	push   %eax
+  8015dd:	ff 75 08             	push   0x8(%ebp)
+  8015e0:	e8 ba fb ff ff       	call   80119f <fd_lookup>
+  8015e5:	83 c4 10             	add    $0x10,%esp
+  8015e8:	85 c0                	test   %eax,%eax
+  8015ea:	78 0e                	js     8015fa <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8015ec:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8015ef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015f2:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8015f5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015fa:	c9                   	leave
+  8015fb:	c3                   	ret
+
+008015fc <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8015fc:	55                   	push   %ebp
+  8015fd:	89 e5                	mov    %esp,%ebp
+  8015ff:	56                   	push   %esi
+  801600:	53                   	push   %ebx
+  801601:	83 ec 18             	sub    $0x18,%esp
+  801604:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801607:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80160a:	50                   	push   %eax
+  80160b:	53                   	push   %ebx
+  80160c:	e8 8e fb ff ff       	call   80119f <fd_lookup>
+  801611:	83 c4 10             	add    $0x10,%esp
+  801614:	85 c0                	test   %eax,%eax
+  801616:	78 34                	js     80164c <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801618:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80161b:	83 ec 08             	sub    $0x8,%esp
+  80161e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801621:	50                   	push   %eax
+  801622:	ff 36                	push   (%esi)
+  801624:	e8 c6 fb ff ff       	call   8011ef <dev_lookup>
+  801629:	83 c4 10             	add    $0x10,%esp
+  80162c:	85 c0                	test   %eax,%eax
+  80162e:	78 1c                	js     80164c <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801630:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801634:	74 1d                	je     801653 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801636:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801639:	8b 40 18             	mov    0x18(%eax),%eax
+  80163c:	85 c0                	test   %eax,%eax
+  80163e:	74 5e                	je     80169e <ftruncate+0xa2>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801640:	83 ec 08             	sub    $0x8,%esp
+  801643:	ff 75 0c             	push   0xc(%ebp)
+  801646:	56                   	push   %esi
+  801647:	ff d0                	call   *%eax
+  801649:	83 c4 10             	add    $0x10,%esp
+}
+  80164c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80164f:	5b                   	pop    %ebx
+  801650:	5e                   	pop    %esi
+  801651:	5d                   	pop    %ebp
+  801652:	c3                   	ret
+  801653:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  801655:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80165b:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  801660:	77 18                	ja     80167a <ftruncate+0x7e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  801662:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  801667:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  801669:	c1 e8 10             	shr    $0x10,%eax
+  80166c:	74 0c                	je     80167a <ftruncate+0x7e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  80166e:	c1 e0 10             	shl    $0x10,%eax
+  801671:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  801676:	29 c2                	sub    %eax,%edx
+  801678:	eb 06                	jmp    801680 <ftruncate+0x84>
+		return pthread_main_tls;
+  80167a:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+			thisenv->env_id, fdnum);
+  801680:	8b 02                	mov    (%edx),%eax
+  801682:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801685:	83 ec 04             	sub    $0x4,%esp
+  801688:	53                   	push   %ebx
+  801689:	50                   	push   %eax
+  80168a:	68 00 4c 80 00       	push   $0x804c00
+  80168f:	e8 ca eb ff ff       	call   80025e <cprintf>
+		return -E_INVAL;
+  801694:	83 c4 10             	add    $0x10,%esp
+  801697:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80169c:	eb ae                	jmp    80164c <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80169e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016a3:	eb a7                	jmp    80164c <ftruncate+0x50>
+
+008016a5 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8016a5:	55                   	push   %ebp
+  8016a6:	89 e5                	mov    %esp,%ebp
+  8016a8:	56                   	push   %esi
+  8016a9:	53                   	push   %ebx
+  8016aa:	83 ec 18             	sub    $0x18,%esp
+  8016ad:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016b0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016b3:	50                   	push   %eax
+  8016b4:	ff 75 08             	push   0x8(%ebp)
+  8016b7:	e8 e3 fa ff ff       	call   80119f <fd_lookup>
+  8016bc:	83 c4 10             	add    $0x10,%esp
+  8016bf:	85 c0                	test   %eax,%eax
+  8016c1:	78 49                	js     80170c <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016c3:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8016c6:	83 ec 08             	sub    $0x8,%esp
+  8016c9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016cc:	50                   	push   %eax
+  8016cd:	ff 36                	push   (%esi)
+  8016cf:	e8 1b fb ff ff       	call   8011ef <dev_lookup>
+  8016d4:	83 c4 10             	add    $0x10,%esp
+  8016d7:	85 c0                	test   %eax,%eax
+  8016d9:	78 31                	js     80170c <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8016db:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016de:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8016e2:	74 2f                	je     801713 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8016e4:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8016e7:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8016ee:	00 00 00 
+	stat->st_isdir = 0;
+  8016f1:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8016f8:	00 00 00 
+	stat->st_dev = dev;
+  8016fb:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801701:	83 ec 08             	sub    $0x8,%esp
+  801704:	53                   	push   %ebx
+  801705:	56                   	push   %esi
+  801706:	ff 50 14             	call   *0x14(%eax)
+  801709:	83 c4 10             	add    $0x10,%esp
+}
+  80170c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80170f:	5b                   	pop    %ebx
+  801710:	5e                   	pop    %esi
+  801711:	5d                   	pop    %ebp
+  801712:	c3                   	ret
+		return -E_NOT_SUPP;
+  801713:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801718:	eb f2                	jmp    80170c <fstat+0x67>
+
+0080171a <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80171a:	55                   	push   %ebp
+  80171b:	89 e5                	mov    %esp,%ebp
+  80171d:	56                   	push   %esi
+  80171e:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80171f:	83 ec 08             	sub    $0x8,%esp
+  801722:	6a 00                	push   $0x0
+  801724:	ff 75 08             	push   0x8(%ebp)
+  801727:	e8 4b 03 00 00       	call   801a77 <open>
+  80172c:	89 c3                	mov    %eax,%ebx
+  80172e:	83 c4 10             	add    $0x10,%esp
+  801731:	85 c0                	test   %eax,%eax
+  801733:	78 1b                	js     801750 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801735:	83 ec 08             	sub    $0x8,%esp
+  801738:	ff 75 0c             	push   0xc(%ebp)
+  80173b:	50                   	push   %eax
+  80173c:	e8 64 ff ff ff       	call   8016a5 <fstat>
+  801741:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801743:	89 1c 24             	mov    %ebx,(%esp)
+  801746:	e8 a8 fb ff ff       	call   8012f3 <close>
+	return r;
+  80174b:	83 c4 10             	add    $0x10,%esp
+  80174e:	89 f3                	mov    %esi,%ebx
+}
+  801750:	89 d8                	mov    %ebx,%eax
+  801752:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801755:	5b                   	pop    %ebx
+  801756:	5e                   	pop    %esi
+  801757:	5d                   	pop    %ebp
+  801758:	c3                   	ret
+
+00801759 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801759:	55                   	push   %ebp
+  80175a:	89 e5                	mov    %esp,%ebp
+  80175c:	56                   	push   %esi
+  80175d:	53                   	push   %ebx
+  80175e:	89 c6                	mov    %eax,%esi
+  801760:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801762:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  801769:	74 27                	je     801792 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80176b:	6a 07                	push   $0x7
+  80176d:	68 00 70 80 00       	push   $0x807000
+  801772:	56                   	push   %esi
+  801773:	ff 35 00 60 80 00    	push   0x806000
+  801779:	e8 94 2c 00 00       	call   804412 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  80177e:	83 c4 0c             	add    $0xc,%esp
+  801781:	6a 00                	push   $0x0
+  801783:	53                   	push   %ebx
+  801784:	6a 00                	push   $0x0
+  801786:	e8 91 2b 00 00       	call   80431c <ipc_recv>
+}
+  80178b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80178e:	5b                   	pop    %ebx
+  80178f:	5e                   	pop    %esi
+  801790:	5d                   	pop    %ebp
+  801791:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801792:	83 ec 0c             	sub    $0xc,%esp
+  801795:	6a 01                	push   $0x1
+  801797:	e8 cc 2c 00 00       	call   804468 <ipc_find_env>
+  80179c:	a3 00 60 80 00       	mov    %eax,0x806000
+  8017a1:	83 c4 10             	add    $0x10,%esp
+  8017a4:	eb c5                	jmp    80176b <fsipc+0x12>
+
+008017a6 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8017a6:	55                   	push   %ebp
+  8017a7:	89 e5                	mov    %esp,%ebp
+  8017a9:	53                   	push   %ebx
+  8017aa:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  8017ad:	68 04 60 80 00       	push   $0x806004
+  8017b2:	e8 29 1b 00 00       	call   8032e0 <mutex_lock>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8017b7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017ba:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017bd:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  8017c2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8017c5:	a3 04 70 80 00       	mov    %eax,0x807004
+	r = fsipc(FSREQ_SET_SIZE, NULL);
+  8017ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017cf:	b8 02 00 00 00       	mov    $0x2,%eax
+  8017d4:	e8 80 ff ff ff       	call   801759 <fsipc>
+  8017d9:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8017db:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  8017e2:	e8 66 1b 00 00       	call   80334d <mutex_unlock>
+	return r;
+}
+  8017e7:	89 d8                	mov    %ebx,%eax
+  8017e9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017ec:	c9                   	leave
+  8017ed:	c3                   	ret
+
+008017ee <devfile_flush>:
+{
+  8017ee:	55                   	push   %ebp
+  8017ef:	89 e5                	mov    %esp,%ebp
+  8017f1:	53                   	push   %ebx
+  8017f2:	83 ec 10             	sub    $0x10,%esp
+	mutex_lock(&fsipc_mu);
+  8017f5:	68 04 60 80 00       	push   $0x806004
+  8017fa:	e8 e1 1a 00 00       	call   8032e0 <mutex_lock>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8017ff:	8b 45 08             	mov    0x8(%ebp),%eax
+  801802:	8b 40 0c             	mov    0xc(%eax),%eax
+  801805:	a3 00 70 80 00       	mov    %eax,0x807000
+	r = fsipc(FSREQ_FLUSH, NULL);
+  80180a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80180f:	b8 06 00 00 00       	mov    $0x6,%eax
+  801814:	e8 40 ff ff ff       	call   801759 <fsipc>
+  801819:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  80181b:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801822:	e8 26 1b 00 00       	call   80334d <mutex_unlock>
+}
+  801827:	89 d8                	mov    %ebx,%eax
+  801829:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80182c:	c9                   	leave
+  80182d:	c3                   	ret
+
+0080182e <devfile_stat>:
+{
+  80182e:	55                   	push   %ebp
+  80182f:	89 e5                	mov    %esp,%ebp
+  801831:	56                   	push   %esi
+  801832:	53                   	push   %ebx
+  801833:	8b 75 0c             	mov    0xc(%ebp),%esi
+	mutex_lock(&fsipc_mu);
+  801836:	83 ec 0c             	sub    $0xc,%esp
+  801839:	68 04 60 80 00       	push   $0x806004
+  80183e:	e8 9d 1a 00 00       	call   8032e0 <mutex_lock>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801843:	8b 45 08             	mov    0x8(%ebp),%eax
+  801846:	8b 40 0c             	mov    0xc(%eax),%eax
+  801849:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) >= 0) {
+  80184e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801853:	b8 05 00 00 00       	mov    $0x5,%eax
+  801858:	e8 fc fe ff ff       	call   801759 <fsipc>
+  80185d:	89 c3                	mov    %eax,%ebx
+  80185f:	83 c4 10             	add    $0x10,%esp
+  801862:	85 c0                	test   %eax,%eax
+  801864:	79 16                	jns    80187c <devfile_stat+0x4e>
+	mutex_unlock(&fsipc_mu);
+  801866:	83 ec 0c             	sub    $0xc,%esp
+  801869:	68 04 60 80 00       	push   $0x806004
+  80186e:	e8 da 1a 00 00       	call   80334d <mutex_unlock>
+}
+  801873:	89 d8                	mov    %ebx,%eax
+  801875:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801878:	5b                   	pop    %ebx
+  801879:	5e                   	pop    %esi
+  80187a:	5d                   	pop    %ebp
+  80187b:	c3                   	ret
+		strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80187c:	83 ec 08             	sub    $0x8,%esp
+  80187f:	68 00 70 80 00       	push   $0x807000
+  801884:	56                   	push   %esi
+  801885:	e8 b8 ef ff ff       	call   800842 <strcpy>
+		st->st_size = fsipcbuf.statRet.ret_size;
+  80188a:	a1 80 70 80 00       	mov    0x807080,%eax
+  80188f:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801895:	a1 84 70 80 00       	mov    0x807084,%eax
+  80189a:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  8018a0:	83 c4 10             	add    $0x10,%esp
+		r = 0;
+  8018a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018a8:	eb bc                	jmp    801866 <devfile_stat+0x38>
+
+008018aa <devfile_write>:
+{
+  8018aa:	55                   	push   %ebp
+  8018ab:	89 e5                	mov    %esp,%ebp
+  8018ad:	53                   	push   %ebx
+  8018ae:	83 ec 10             	sub    $0x10,%esp
+  8018b1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	mutex_lock(&fsipc_mu);
+  8018b4:	68 04 60 80 00       	push   $0x806004
+  8018b9:	e8 22 1a 00 00       	call   8032e0 <mutex_lock>
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8018be:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018c1:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018c4:	a3 00 70 80 00       	mov    %eax,0x807000
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  8018c9:	83 c4 10             	add    $0x10,%esp
+  8018cc:	81 fb f4 0f 00 00    	cmp    $0xff4,%ebx
+  8018d2:	76 3d                	jbe    801911 <devfile_write+0x67>
+		n = MIN(n, FSBULK_MAX);
+  8018d4:	b8 00 00 10 00       	mov    $0x100000,%eax
+  8018d9:	39 c3                	cmp    %eax,%ebx
+  8018db:	0f 47 d8             	cmova  %eax,%ebx
+		fsipcbuf.write.req_va = (uintptr_t) buf;
+  8018de:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8018e1:	a3 08 70 80 00       	mov    %eax,0x807008
+	fsipcbuf.write.req_n = n;
+  8018e6:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	r = fsipc(FSREQ_WRITE, NULL);
+  8018ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018f1:	b8 04 00 00 00       	mov    $0x4,%eax
+  8018f6:	e8 5e fe ff ff       	call   801759 <fsipc>
+  8018fb:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  8018fd:	83 ec 0c             	sub    $0xc,%esp
+  801900:	68 04 60 80 00       	push   $0x806004
+  801905:	e8 43 1a 00 00       	call   80334d <mutex_unlock>
+}
+  80190a:	89 d8                	mov    %ebx,%eax
+  80190c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80190f:	c9                   	leave
+  801910:	c3                   	ret
+		memmove(fsipcbuf.write.req_buf, buf, n);
+  801911:	83 ec 04             	sub    $0x4,%esp
+  801914:	53                   	push   %ebx
+  801915:	ff 75 0c             	push   0xc(%ebp)
+  801918:	68 0c 70 80 00       	push   $0x80700c
+  80191d:	e8 a6 f0 ff ff       	call   8009c8 <memmove>
+  801922:	83 c4 10             	add    $0x10,%esp
+  801925:	b8 00 00 00 00       	mov    $0x0,%eax
+  80192a:	eb b5                	jmp    8018e1 <devfile_write+0x37>
+
+0080192c <devfile_read>:
+{
+  80192c:	55                   	push   %ebp
+  80192d:	89 e5                	mov    %esp,%ebp
+  80192f:	57                   	push   %edi
+  801930:	56                   	push   %esi
+  801931:	53                   	push   %ebx
+  801932:	83 ec 0c             	sub    $0xc,%esp
+  801935:	8b 75 08             	mov    0x8(%ebp),%esi
+  801938:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80193b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (n > PGSIZE) {
+  80193e:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801944:	0f 86 8c 00 00 00    	jbe    8019d6 <devfile_read+0xaa>
+		n = MIN(n, FSBULK_MAX);
+  80194a:	b8 00 00 10 00       	mov    $0x100000,%eax
+  80194f:	39 c3                	cmp    %eax,%ebx
+  801951:	0f 47 d8             	cmova  %eax,%ebx
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  801954:	89 f8                	mov    %edi,%eax
+  801956:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801959:	eb 0f                	jmp    80196a <devfile_read+0x3e>
+			*(volatile char*) va = *(volatile char*) va;
+  80195b:	0f b6 08             	movzbl (%eax),%ecx
+  80195e:	88 08                	mov    %cl,(%eax)
+		     va = ROUNDDOWN(va, PGSIZE) + PGSIZE)
+  801960:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801965:	05 00 10 00 00       	add    $0x1000,%eax
+		for (va = (uintptr_t) buf; va < (uintptr_t) buf + n;
+  80196a:	39 d0                	cmp    %edx,%eax
+  80196c:	72 ed                	jb     80195b <devfile_read+0x2f>
+		mutex_lock(&fsipc_mu);
+  80196e:	83 ec 0c             	sub    $0xc,%esp
+  801971:	68 04 60 80 00       	push   $0x806004
+  801976:	e8 65 19 00 00       	call   8032e0 <mutex_lock>
+		fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80197b:	8b 46 0c             	mov    0xc(%esi),%eax
+  80197e:	a3 00 70 80 00       	mov    %eax,0x807000
+		fsipcbuf.read.req_n = n;
+  801983:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+		fsipcbuf.read.req_va = (uintptr_t) buf;
+  801989:	89 3d 08 70 80 00    	mov    %edi,0x807008
+		r = fsipc(FSREQ_READ, NULL);
+  80198f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801994:	b8 03 00 00 00       	mov    $0x3,%eax
+  801999:	e8 bb fd ff ff       	call   801759 <fsipc>
+  80199e:	89 c6                	mov    %eax,%esi
+		mutex_unlock(&fsipc_mu);
+  8019a0:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  8019a7:	e8 a1 19 00 00       	call   80334d <mutex_unlock>
+		assert(r <= (int) n);
+  8019ac:	83 c4 10             	add    $0x10,%esp
+  8019af:	39 f3                	cmp    %esi,%ebx
+  8019b1:	7c 0a                	jl     8019bd <devfile_read+0x91>
+}
+  8019b3:	89 f0                	mov    %esi,%eax
+  8019b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019b8:	5b                   	pop    %ebx
+  8019b9:	5e                   	pop    %esi
+  8019ba:	5f                   	pop    %edi
+  8019bb:	5d                   	pop    %ebp
+  8019bc:	c3                   	ret
+		assert(r <= (int) n);
+  8019bd:	68 70 4c 80 00       	push   $0x804c70
+  8019c2:	68 7d 4c 80 00       	push   $0x804c7d
+  8019c7:	68 90 00 00 00       	push   $0x90
+  8019cc:	68 92 4c 80 00       	push   $0x804c92
+  8019d1:	e8 8a 22 00 00       	call   803c60 <_panic>
+	mutex_lock(&fsipc_mu);
+  8019d6:	83 ec 0c             	sub    $0xc,%esp
+  8019d9:	68 04 60 80 00       	push   $0x806004
+  8019de:	e8 fd 18 00 00       	call   8032e0 <mutex_lock>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8019e3:	8b 46 0c             	mov    0xc(%esi),%eax
+  8019e6:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  8019eb:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	fsipcbuf.read.req_va = 0;
+  8019f1:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  8019f8:	00 00 00 
+	if ((r = fsipc(FSREQ_READ, NULL)) >= 0) {
+  8019fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a00:	b8 03 00 00 00       	mov    $0x3,%eax
+  801a05:	e8 4f fd ff ff       	call   801759 <fsipc>
+  801a0a:	89 c6                	mov    %eax,%esi
+  801a0c:	83 c4 10             	add    $0x10,%esp
+  801a0f:	85 c0                	test   %eax,%eax
+  801a11:	78 1d                	js     801a30 <devfile_read+0x104>
+		assert(r <= n);
+  801a13:	39 c3                	cmp    %eax,%ebx
+  801a15:	72 2e                	jb     801a45 <devfile_read+0x119>
+		assert(r <= PGSIZE);
+  801a17:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801a1c:	7f 40                	jg     801a5e <devfile_read+0x132>
+		memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801a1e:	83 ec 04             	sub    $0x4,%esp
+  801a21:	50                   	push   %eax
+  801a22:	68 00 70 80 00       	push   $0x807000
+  801a27:	57                   	push   %edi
+  801a28:	e8 9b ef ff ff       	call   8009c8 <memmove>
+  801a2d:	83 c4 10             	add    $0x10,%esp
+	mutex_unlock(&fsipc_mu);
+  801a30:	83 ec 0c             	sub    $0xc,%esp
+  801a33:	68 04 60 80 00       	push   $0x806004
+  801a38:	e8 10 19 00 00       	call   80334d <mutex_unlock>
+	return r;
+  801a3d:	83 c4 10             	add    $0x10,%esp
+  801a40:	e9 6e ff ff ff       	jmp    8019b3 <devfile_read+0x87>
+		assert(r <= n);
+  801a45:	68 9d 4c 80 00       	push   $0x804c9d
+  801a4a:	68 7d 4c 80 00       	push   $0x804c7d
+  801a4f:	68 99 00 00 00       	push   $0x99
+  801a54:	68 92 4c 80 00       	push   $0x804c92
+  801a59:	e8 02 22 00 00       	call   803c60 <_panic>
+		assert(r <= PGSIZE);
+  801a5e:	68 a4 4c 80 00       	push   $0x804ca4
+  801a63:	68 7d 4c 80 00       	push   $0x804c7d
+  801a68:	68 9a 00 00 00       	push   $0x9a
+  801a6d:	68 92 4c 80 00       	push   $0x804c92
+  801a72:	e8 e9 21 00 00       	call   803c60 <_panic>
+
+00801a77 <open>:
+{
+  801a77:	55                   	push   %ebp
+  801a78:	89 e5                	mov    %esp,%ebp
+  801a7a:	56                   	push   %esi
+  801a7b:	53                   	push   %ebx
+  801a7c:	83 ec 1c             	sub    $0x1c,%esp
+  801a7f:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801a82:	56                   	push   %esi
+  801a83:	e8 7f ed ff ff       	call   800807 <strlen>
+  801a88:	83 c4 10             	add    $0x10,%esp
+  801a8b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801a90:	0f 8f 85 00 00 00    	jg     801b1b <open+0xa4>
+	if ((r = fd_alloc(&fd)) < 0)
+  801a96:	83 ec 0c             	sub    $0xc,%esp
+  801a99:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a9c:	50                   	push   %eax
+  801a9d:	e8 a7 f6 ff ff       	call   801149 <fd_alloc>
+  801aa2:	89 c3                	mov    %eax,%ebx
+  801aa4:	83 c4 10             	add    $0x10,%esp
+  801aa7:	85 c0                	test   %eax,%eax
+  801aa9:	78 55                	js     801b00 <open+0x89>
+	mutex_lock(&fsipc_mu);
+  801aab:	83 ec 0c             	sub    $0xc,%esp
+  801aae:	68 04 60 80 00       	push   $0x806004
+  801ab3:	e8 28 18 00 00       	call   8032e0 <mutex_lock>
+	strcpy(fsipcbuf.open.req_path, path);
+  801ab8:	83 c4 08             	add    $0x8,%esp
+  801abb:	56                   	push   %esi
+  801abc:	68 00 70 80 00       	push   $0x807000
+  801ac1:	e8 7c ed ff ff       	call   800842 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801ac6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ac9:	a3 00 74 80 00       	mov    %eax,0x807400
+	r = fsipc(FSREQ_OPEN, fd);
+  801ace:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801ad1:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ad6:	e8 7e fc ff ff       	call   801759 <fsipc>
+  801adb:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801add:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801ae4:	e8 64 18 00 00       	call   80334d <mutex_unlock>
+	if (r < 0) {
+  801ae9:	83 c4 10             	add    $0x10,%esp
+  801aec:	85 db                	test   %ebx,%ebx
+  801aee:	78 19                	js     801b09 <open+0x92>
+	return fd2num(fd);
+  801af0:	83 ec 0c             	sub    $0xc,%esp
+  801af3:	ff 75 f4             	push   -0xc(%ebp)
+  801af6:	e8 27 f6 ff ff       	call   801122 <fd2num>
+  801afb:	89 c3                	mov    %eax,%ebx
+  801afd:	83 c4 10             	add    $0x10,%esp
+}
+  801b00:	89 d8                	mov    %ebx,%eax
+  801b02:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b05:	5b                   	pop    %ebx
+  801b06:	5e                   	pop    %esi
+  801b07:	5d                   	pop    %ebp
+  801b08:	c3                   	ret
+		fd_close(fd, 0);
+  801b09:	83 ec 08             	sub    $0x8,%esp
+  801b0c:	6a 00                	push   $0x0
+  801b0e:	ff 75 f4             	push   -0xc(%ebp)
+  801b11:	e8 56 f7 ff ff       	call   80126c <fd_close>
+		return r;
+  801b16:	83 c4 10             	add    $0x10,%esp
+  801b19:	eb e5                	jmp    801b00 <open+0x89>
+		return -E_BAD_PATH;
+  801b1b:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801b20:	eb de                	jmp    801b00 <open+0x89>
+
+00801b22 <fallocate>:
+// Give file fdnum disk blocks for bytes [offset, offset+len),
+// extending it if necessary, so that later writes to the range
+// neither allocate nor fail for lack of space.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  801b22:	55                   	push   %ebp
+  801b23:	89 e5                	mov    %esp,%ebp
+  801b25:	53                   	push   %ebx
+  801b26:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801b29:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b2c:	50                   	push   %eax
+  801b2d:	ff 75 08             	push   0x8(%ebp)
+  801b30:	e8 6a f6 ff ff       	call   80119f <fd_lookup>
+  801b35:	89 c3                	mov    %eax,%ebx
+  801b37:	83 c4 10             	add    $0x10,%esp
+  801b3a:	85 c0                	test   %eax,%eax
+  801b3c:	78 5b                	js     801b99 <fallocate+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801b3e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b41:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  801b47:	39 08                	cmp    %ecx,(%eax)
+  801b49:	75 55                	jne    801ba0 <fallocate+0x7e>
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  801b4b:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  801b4f:	74 56                	je     801ba7 <fallocate+0x85>
+		return -E_INVAL;
+	mutex_lock(&fsipc_mu);
+  801b51:	83 ec 0c             	sub    $0xc,%esp
+  801b54:	68 04 60 80 00       	push   $0x806004
+  801b59:	e8 82 17 00 00       	call   8032e0 <mutex_lock>
+	fsipcbuf.allocate.req_fileid = fd->fd_file.id;
+  801b5e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b61:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b64:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.allocate.req_offset = offset;
+  801b69:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b6c:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.allocate.req_len = len;
+  801b71:	8b 45 10             	mov    0x10(%ebp),%eax
+  801b74:	a3 08 70 80 00       	mov    %eax,0x807008
+	r = fsipc(FSREQ_ALLOCATE, NULL);
+  801b79:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b7e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801b83:	e8 d1 fb ff ff       	call   801759 <fsipc>
+  801b88:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801b8a:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801b91:	e8 b7 17 00 00       	call   80334d <mutex_unlock>
+	return r;
+  801b96:	83 c4 10             	add    $0x10,%esp
+}
+  801b99:	89 d8                	mov    %ebx,%eax
+  801b9b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b9e:	c9                   	leave
+  801b9f:	c3                   	ret
+		return -E_NOT_SUPP;
+  801ba0:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801ba5:	eb f2                	jmp    801b99 <fallocate+0x77>
+		return -E_INVAL;
+  801ba7:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801bac:	eb eb                	jmp    801b99 <fallocate+0x77>
+
+00801bae <munmap>:
+}
+
+// Remove the pages covering [addr, addr+len) from our address space.
+int
+munmap(void *addr, size_t len)
+{
+  801bae:	55                   	push   %ebp
+  801baf:	89 e5                	mov    %esp,%ebp
+  801bb1:	56                   	push   %esi
+  801bb2:	53                   	push   %ebx
+  801bb3:	8b 75 08             	mov    0x8(%ebp),%esi
+	uintptr_t va;
+	int r;
+
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801bb6:	89 f3                	mov    %esi,%ebx
+  801bb8:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801bbe:	03 75 0c             	add    0xc(%ebp),%esi
+	for (va = ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801bc1:	eb 06                	jmp    801bc9 <munmap+0x1b>
+	     va < (uintptr_t) addr + len; va += PGSIZE)
+  801bc3:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801bc9:	39 f3                	cmp    %esi,%ebx
+  801bcb:	73 14                	jae    801be1 <munmap+0x33>
+		if ((r = sys_page_unmap(0, (void*) va)) < 0)
+  801bcd:	83 ec 08             	sub    $0x8,%esp
+  801bd0:	53                   	push   %ebx
+  801bd1:	6a 00                	push   $0x0
+  801bd3:	e8 41 f1 ff ff       	call   800d19 <sys_page_unmap>
+  801bd8:	83 c4 10             	add    $0x10,%esp
+  801bdb:	85 c0                	test   %eax,%eax
+  801bdd:	79 e4                	jns    801bc3 <munmap+0x15>
+  801bdf:	eb 05                	jmp    801be6 <munmap+0x38>
+			return r;
+	return 0;
+  801be1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801be6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801be9:	5b                   	pop    %ebx
+  801bea:	5e                   	pop    %esi
+  801beb:	5d                   	pop    %ebp
+  801bec:	c3                   	ret
+
+00801bed <mmap>:
+{
+  801bed:	55                   	push   %ebp
+  801bee:	89 e5                	mov    %esp,%ebp
+  801bf0:	57                   	push   %edi
+  801bf1:	56                   	push   %esi
+  801bf2:	53                   	push   %ebx
+  801bf3:	83 ec 24             	sub    $0x24,%esp
+  801bf6:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801bf9:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801bfc:	50                   	push   %eax
+  801bfd:	ff 75 08             	push   0x8(%ebp)
+  801c00:	e8 9a f5 ff ff       	call   80119f <fd_lookup>
+  801c05:	83 c4 10             	add    $0x10,%esp
+  801c08:	85 c0                	test   %eax,%eax
+  801c0a:	0f 88 37 01 00 00    	js     801d47 <mmap+0x15a>
+		return NULL;
+  801c10:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801c15:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801c18:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  801c1e:	39 0a                	cmp    %ecx,(%edx)
+  801c20:	0f 85 05 01 00 00    	jne    801d2b <mmap+0x13e>
+	if (PGOFF(offset) || len == 0 || len > MMAPLIM - MMAPBASE)
+  801c26:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801c2d:	0f 85 1b 01 00 00    	jne    801d4e <mmap+0x161>
+  801c33:	89 f0                	mov    %esi,%eax
+  801c35:	83 e8 01             	sub    $0x1,%eax
+  801c38:	0f 88 17 01 00 00    	js     801d55 <mmap+0x168>
+	if (prot & PROT_WRITE)
+  801c3e:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  801c42:	75 28                	jne    801c6c <mmap+0x7f>
+	mutex_lock(&fsipc_mu);
+  801c44:	83 ec 0c             	sub    $0xc,%esp
+  801c47:	68 04 60 80 00       	push   $0x806004
+  801c4c:	e8 8f 16 00 00       	call   8032e0 <mutex_lock>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801c51:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  801c57:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  801c5d:	83 c4 10             	add    $0x10,%esp
+  801c60:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+  801c65:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  801c6a:	eb 2b                	jmp    801c97 <mmap+0xaa>
+		cow_enable();
+  801c6c:	e8 3a 22 00 00       	call   803eab <cow_enable>
+  801c71:	eb d1                	jmp    801c44 <mmap+0x57>
+		if (uvpt[PGNUM(va)] & PTE_P)
+  801c73:	89 c2                	mov    %eax,%edx
+  801c75:	c1 ea 0c             	shr    $0xc,%edx
+  801c78:	8b 3c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edi
+			start = va + PGSIZE;
+  801c7f:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801c85:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  801c8b:	0f 45 da             	cmovne %edx,%ebx
+		va += PGSIZE;
+  801c8e:	89 d0                	mov    %edx,%eax
+	for (start = va = MMAPBASE; va < MMAPLIM && va - start < n; ) {
+  801c90:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  801c95:	77 25                	ja     801cbc <mmap+0xcf>
+  801c97:	89 c2                	mov    %eax,%edx
+  801c99:	29 da                	sub    %ebx,%edx
+  801c9b:	39 ca                	cmp    %ecx,%edx
+  801c9d:	73 3a                	jae    801cd9 <mmap+0xec>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  801c9f:	89 c2                	mov    %eax,%edx
+  801ca1:	c1 ea 16             	shr    $0x16,%edx
+  801ca4:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801cab:	f6 c2 01             	test   $0x1,%dl
+  801cae:	75 c3                	jne    801c73 <mmap+0x86>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE;
+  801cb0:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  801cb5:	05 00 00 40 00       	add    $0x400000,%eax
+			continue;
+  801cba:	eb d4                	jmp    801c90 <mmap+0xa3>
+	return va - start >= n ? start : 0;
+  801cbc:	29 d8                	sub    %ebx,%eax
+  801cbe:	39 c8                	cmp    %ecx,%eax
+  801cc0:	73 17                	jae    801cd9 <mmap+0xec>
+		mutex_unlock(&fsipc_mu);
+  801cc2:	83 ec 0c             	sub    $0xc,%esp
+  801cc5:	68 04 60 80 00       	push   $0x806004
+  801cca:	e8 7e 16 00 00       	call   80334d <mutex_unlock>
+		return NULL;
+  801ccf:	83 c4 10             	add    $0x10,%esp
+  801cd2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cd7:	eb 52                	jmp    801d2b <mmap+0x13e>
+	if ((va = mmap_find(ROUNDUP(len, PGSIZE))) == 0) {
+  801cd9:	85 db                	test   %ebx,%ebx
+  801cdb:	74 e5                	je     801cc2 <mmap+0xd5>
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801cdd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801ce0:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ce3:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  801ce8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ceb:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_len = len;
+  801cf0:	89 35 08 70 80 00    	mov    %esi,0x807008
+	fsipcbuf.map.req_va = va;
+  801cf6:	89 1d 0c 70 80 00    	mov    %ebx,0x80700c
+	fsipcbuf.map.req_prot = prot;
+  801cfc:	8b 45 14             	mov    0x14(%ebp),%eax
+  801cff:	a3 10 70 80 00       	mov    %eax,0x807010
+	r = fsipc(FSREQ_MAP, NULL);
+  801d04:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d09:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801d0e:	e8 46 fa ff ff       	call   801759 <fsipc>
+  801d13:	89 c7                	mov    %eax,%edi
+	mutex_unlock(&fsipc_mu);
+  801d15:	83 ec 0c             	sub    $0xc,%esp
+  801d18:	68 04 60 80 00       	push   $0x806004
+  801d1d:	e8 2b 16 00 00       	call   80334d <mutex_unlock>
+	if (r < 0) {
+  801d22:	83 c4 10             	add    $0x10,%esp
+	return (void*) va;
+  801d25:	89 d8                	mov    %ebx,%eax
+	if (r < 0) {
+  801d27:	85 ff                	test   %edi,%edi
+  801d29:	78 08                	js     801d33 <mmap+0x146>
+}
+  801d2b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d2e:	5b                   	pop    %ebx
+  801d2f:	5e                   	pop    %esi
+  801d30:	5f                   	pop    %edi
+  801d31:	5d                   	pop    %ebp
+  801d32:	c3                   	ret
+		munmap((void*) va, len);
+  801d33:	83 ec 08             	sub    $0x8,%esp
+  801d36:	56                   	push   %esi
+  801d37:	53                   	push   %ebx
+  801d38:	e8 71 fe ff ff       	call   801bae <munmap>
+		return NULL;
+  801d3d:	83 c4 10             	add    $0x10,%esp
+  801d40:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d45:	eb e4                	jmp    801d2b <mmap+0x13e>
+		return NULL;
+  801d47:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d4c:	eb dd                	jmp    801d2b <mmap+0x13e>
+		return NULL;
+  801d4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d53:	eb d6                	jmp    801d2b <mmap+0x13e>
+  801d55:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d5a:	eb cf                	jmp    801d2b <mmap+0x13e>
+
+00801d5c <remove>:
+
+// Remove the file or empty directory 'path'.
+int
+remove(const char *path)
+{
+  801d5c:	55                   	push   %ebp
+  801d5d:	89 e5                	mov    %esp,%ebp
+  801d5f:	53                   	push   %ebx
+  801d60:	83 ec 10             	sub    $0x10,%esp
+  801d63:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  801d66:	53                   	push   %ebx
+  801d67:	e8 9b ea ff ff       	call   800807 <strlen>
+  801d6c:	83 c4 10             	add    $0x10,%esp
+  801d6f:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801d74:	7f 42                	jg     801db8 <remove+0x5c>
+		return -E_BAD_PATH;
+	mutex_lock(&fsipc_mu);
+  801d76:	83 ec 0c             	sub    $0xc,%esp
+  801d79:	68 04 60 80 00       	push   $0x806004
+  801d7e:	e8 5d 15 00 00       	call   8032e0 <mutex_lock>
+	strcpy(fsipcbuf.remove.req_path, path);
+  801d83:	83 c4 08             	add    $0x8,%esp
+  801d86:	53                   	push   %ebx
+  801d87:	68 00 70 80 00       	push   $0x807000
+  801d8c:	e8 b1 ea ff ff       	call   800842 <strcpy>
+	r = fsipc(FSREQ_REMOVE, NULL);
+  801d91:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d96:	b8 07 00 00 00       	mov    $0x7,%eax
+  801d9b:	e8 b9 f9 ff ff       	call   801759 <fsipc>
+  801da0:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801da2:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801da9:	e8 9f 15 00 00       	call   80334d <mutex_unlock>
+	return r;
+  801dae:	83 c4 10             	add    $0x10,%esp
+}
+  801db1:	89 d8                	mov    %ebx,%eax
+  801db3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801db6:	c9                   	leave
+  801db7:	c3                   	ret
+		return -E_BAD_PATH;
+  801db8:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801dbd:	eb f2                	jmp    801db1 <remove+0x55>
+
+00801dbf <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801dbf:	55                   	push   %ebp
+  801dc0:	89 e5                	mov    %esp,%ebp
+  801dc2:	53                   	push   %ebx
+  801dc3:	83 ec 10             	sub    $0x10,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801dc6:	68 04 60 80 00       	push   $0x806004
+  801dcb:	e8 10 15 00 00       	call   8032e0 <mutex_lock>
+	r = fsipc(FSREQ_SYNC, NULL);
+  801dd0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dd5:	b8 08 00 00 00       	mov    $0x8,%eax
+  801dda:	e8 7a f9 ff ff       	call   801759 <fsipc>
+  801ddf:	89 c3                	mov    %eax,%ebx
+	mutex_unlock(&fsipc_mu);
+  801de1:	c7 04 24 04 60 80 00 	movl   $0x806004,(%esp)
+  801de8:	e8 60 15 00 00       	call   80334d <mutex_unlock>
+	return r;
+}
+  801ded:	89 d8                	mov    %ebx,%eax
+  801def:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801df2:	c9                   	leave
+  801df3:	c3                   	ret
+
+00801df4 <fs_bcstat>:
+
+// Fetch the file server's block cache counters.  If budget is not 0,
+// first resize the cache to hold that many blocks.
+int
+fs_bcstat(uint32_t budget, struct BcStat *st)
+{
+  801df4:	55                   	push   %ebp
+  801df5:	89 e5                	mov    %esp,%ebp
+  801df7:	56                   	push   %esi
+  801df8:	53                   	push   %ebx
+  801df9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	mutex_lock(&fsipc_mu);
+  801dfc:	83 ec 0c             	sub    $0xc,%esp
+  801dff:	68 04 60 80 00       	push   $0x806004
+  801e04:	e8 d7 14 00 00       	call   8032e0 <mutex_lock>
+	fsipcbuf.bcstat.req_budget = budget;
+  801e09:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e0c:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) >= 0 && st)
+  801e11:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e16:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801e1b:	e8 39 f9 ff ff       	call   801759 <fsipc>
+  801e20:	89 c6                	mov    %eax,%esi
+  801e22:	83 c4 10             	add    $0x10,%esp
+  801e25:	85 db                	test   %ebx,%ebx
+  801e27:	74 7b                	je     801ea4 <fs_bcstat+0xb0>
+  801e29:	85 c0                	test   %eax,%eax
+  801e2b:	78 77                	js     801ea4 <fs_bcstat+0xb0>
+		*st = fsipcbuf.bcstatRet;
+  801e2d:	a1 00 70 80 00       	mov    0x807000,%eax
+  801e32:	89 03                	mov    %eax,(%ebx)
+  801e34:	a1 04 70 80 00       	mov    0x807004,%eax
+  801e39:	89 43 04             	mov    %eax,0x4(%ebx)
+  801e3c:	a1 08 70 80 00       	mov    0x807008,%eax
+  801e41:	89 43 08             	mov    %eax,0x8(%ebx)
+  801e44:	a1 0c 70 80 00       	mov    0x80700c,%eax
+  801e49:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801e4c:	a1 10 70 80 00       	mov    0x807010,%eax
+  801e51:	89 43 10             	mov    %eax,0x10(%ebx)
+  801e54:	a1 14 70 80 00       	mov    0x807014,%eax
+  801e59:	89 43 14             	mov    %eax,0x14(%ebx)
+  801e5c:	a1 18 70 80 00       	mov    0x807018,%eax
+  801e61:	89 43 18             	mov    %eax,0x18(%ebx)
+  801e64:	a1 1c 70 80 00       	mov    0x80701c,%eax
+  801e69:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  801e6c:	a1 20 70 80 00       	mov    0x807020,%eax
+  801e71:	89 43 20             	mov    %eax,0x20(%ebx)
+  801e74:	a1 24 70 80 00       	mov    0x807024,%eax
+  801e79:	89 43 24             	mov    %eax,0x24(%ebx)
+  801e7c:	a1 28 70 80 00       	mov    0x807028,%eax
+  801e81:	89 43 28             	mov    %eax,0x28(%ebx)
+  801e84:	a1 2c 70 80 00       	mov    0x80702c,%eax
+  801e89:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  801e8c:	a1 30 70 80 00       	mov    0x807030,%eax
+  801e91:	89 43 30             	mov    %eax,0x30(%ebx)
+  801e94:	a1 34 70 80 00       	mov    0x807034,%eax
+  801e99:	89 43 34             	mov    %eax,0x34(%ebx)
+  801e9c:	a1 38 70 80 00       	mov    0x807038,%eax
+  801ea1:	89 43 38             	mov    %eax,0x38(%ebx)
+	mutex_unlock(&fsipc_mu);
+  801ea4:	83 ec 0c             	sub    $0xc,%esp
+  801ea7:	68 04 60 80 00       	push   $0x806004
+  801eac:	e8 9c 14 00 00       	call   80334d <mutex_unlock>
+	return r;
+}
+  801eb1:	89 f0                	mov    %esi,%eax
+  801eb3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801eb6:	5b                   	pop    %ebx
+  801eb7:	5e                   	pop    %esi
+  801eb8:	5d                   	pop    %ebp
+  801eb9:	c3                   	ret
+
+00801eba <parse_mode>:
+FILE *const stdin = &streams[0];
+FILE *const stdout = &streams[1];
+
+static int
+parse_mode(const char *mode, int *flags_store)
+{
+  801eba:	55                   	push   %ebp
+  801ebb:	89 e5                	mov    %esp,%ebp
+  801ebd:	56                   	push   %esi
+  801ebe:	53                   	push   %ebx
+  801ebf:	89 d6                	mov    %edx,%esi
+	int omode;
+
+	switch (mode[0]) {
+  801ec1:	0f b6 10             	movzbl (%eax),%edx
+  801ec4:	80 fa 72             	cmp    $0x72,%dl
+  801ec7:	74 44                	je     801f0d <parse_mode+0x53>
+  801ec9:	80 fa 77             	cmp    $0x77,%dl
+  801ecc:	74 4b                	je     801f19 <parse_mode+0x5f>
+  801ece:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801ed3:	80 fa 61             	cmp    $0x61,%dl
+  801ed6:	74 09                	je     801ee1 <parse_mode+0x27>
+	if (strchr(mode, '+')) {
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+		*flags_store = F_READ|F_WRITE;
+	}
+	return omode;
+}
+  801ed8:	89 d8                	mov    %ebx,%eax
+  801eda:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801edd:	5b                   	pop    %ebx
+  801ede:	5e                   	pop    %esi
+  801edf:	5d                   	pop    %ebp
+  801ee0:	c3                   	ret
+	switch (mode[0]) {
+  801ee1:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT;
+  801ee6:	bb 01 01 00 00       	mov    $0x101,%ebx
+		*flags_store = F_READ;
+  801eeb:	89 16                	mov    %edx,(%esi)
+	if (strchr(mode, '+')) {
+  801eed:	83 ec 08             	sub    $0x8,%esp
+  801ef0:	6a 2b                	push   $0x2b
+  801ef2:	50                   	push   %eax
+  801ef3:	e8 5c ea ff ff       	call   800954 <strchr>
+  801ef8:	83 c4 10             	add    $0x10,%esp
+  801efb:	85 c0                	test   %eax,%eax
+  801efd:	74 d9                	je     801ed8 <parse_mode+0x1e>
+		omode = (omode & ~O_ACCMODE) | O_RDWR;
+  801eff:	83 e3 fc             	and    $0xfffffffc,%ebx
+  801f02:	83 cb 02             	or     $0x2,%ebx
+		*flags_store = F_READ|F_WRITE;
+  801f05:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+  801f0b:	eb cb                	jmp    801ed8 <parse_mode+0x1e>
+	switch (mode[0]) {
+  801f0d:	ba 01 00 00 00       	mov    $0x1,%edx
+  801f12:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f17:	eb d2                	jmp    801eeb <parse_mode+0x31>
+  801f19:	ba 02 00 00 00       	mov    $0x2,%edx
+		omode = O_WRONLY|O_CREAT|O_TRUNC;
+  801f1e:	bb 01 03 00 00       	mov    $0x301,%ebx
+  801f23:	eb c6                	jmp    801eeb <parse_mode+0x31>
+
+00801f25 <stream_alloc>:
+
+static FILE*
+stream_alloc(int fd, int flags)
+{
+  801f25:	55                   	push   %ebp
+  801f26:	89 e5                	mov    %esp,%ebp
+  801f28:	57                   	push   %edi
+  801f29:	56                   	push   %esi
+  801f2a:	53                   	push   %ebx
+  801f2b:	83 ec 1c             	sub    $0x1c,%esp
+  801f2e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801f31:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	int i;
+
+	for (i = 0; i < FOPEN_MAX; i++)
+  801f34:	b8 24 50 80 00       	mov    $0x805024,%eax
+  801f39:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!streams[i].f_flags) {
+  801f3e:	83 c0 24             	add    $0x24,%eax
+  801f41:	83 78 dc 00          	cmpl   $0x0,-0x24(%eax)
+  801f45:	74 17                	je     801f5e <stream_alloc+0x39>
+	for (i = 0; i < FOPEN_MAX; i++)
+  801f47:	83 c3 01             	add    $0x1,%ebx
+  801f4a:	83 fb 10             	cmp    $0x10,%ebx
+  801f4d:	75 ef                	jne    801f3e <stream_alloc+0x19>
+			memset(&streams[i], 0, sizeof streams[i]);
+			streams[i].f_fd = fd;
+			streams[i].f_flags = flags;
+			return &streams[i];
+		}
+	return 0;
+  801f4f:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  801f54:	89 f0                	mov    %esi,%eax
+  801f56:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f59:	5b                   	pop    %ebx
+  801f5a:	5e                   	pop    %esi
+  801f5b:	5f                   	pop    %edi
+  801f5c:	5d                   	pop    %ebp
+  801f5d:	c3                   	ret
+			memset(&streams[i], 0, sizeof streams[i]);
+  801f5e:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  801f65:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801f68:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  801f6b:	c1 e7 02             	shl    $0x2,%edi
+  801f6e:	8d b7 20 50 80 00    	lea    0x805020(%edi),%esi
+  801f74:	83 ec 04             	sub    $0x4,%esp
+  801f77:	6a 24                	push   $0x24
+  801f79:	6a 00                	push   $0x0
+  801f7b:	56                   	push   %esi
+  801f7c:	e8 12 ea ff ff       	call   800993 <memset>
+			streams[i].f_fd = fd;
+  801f81:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801f84:	89 8f 20 50 80 00    	mov    %ecx,0x805020(%edi)
+			streams[i].f_flags = flags;
+  801f8a:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  801f8d:	01 d8                	add    %ebx,%eax
+  801f8f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801f92:	89 0c 85 24 50 80 00 	mov    %ecx,0x805024(,%eax,4)
+			return &streams[i];
+  801f99:	83 c4 10             	add    $0x10,%esp
+  801f9c:	eb b6                	jmp    801f54 <stream_alloc+0x2f>
+
+00801f9e <stream_unread>:
+// (say, a child after fork) starts where this stream left off.
+// Pipes and the console cannot give input back; it stays buffered.
+// Returns 1 if no input is left in the buffer, 0 if some stays.
+static bool
+stream_unread(FILE *f)
+{
+  801f9e:	55                   	push   %ebp
+  801f9f:	89 e5                	mov    %esp,%ebp
+  801fa1:	53                   	push   %ebx
+  801fa2:	83 ec 14             	sub    $0x14,%esp
+  801fa5:	89 c3                	mov    %eax,%ebx
+	struct Fd *fd;
+
+	if (f->f_rpos == f->f_rend) {
+  801fa7:	8b 40 18             	mov    0x18(%eax),%eax
+  801faa:	39 43 14             	cmp    %eax,0x14(%ebx)
+  801fad:	74 4a                	je     801ff9 <stream_unread+0x5b>
+		f->f_rpos = f->f_rend = 0;
+		return 1;
+	}
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801faf:	83 ec 08             	sub    $0x8,%esp
+  801fb2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fb5:	50                   	push   %eax
+  801fb6:	ff 33                	push   (%ebx)
+  801fb8:	e8 e2 f1 ff ff       	call   80119f <fd_lookup>
+  801fbd:	89 c2                	mov    %eax,%edx
+  801fbf:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801fc2:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (fd_lookup(f->f_fd, &fd) < 0 || fd->fd_dev_id != devfile.dev_id)
+  801fc7:	85 d2                	test   %edx,%edx
+  801fc9:	78 41                	js     80200c <stream_unread+0x6e>
+  801fcb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801fce:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  801fd4:	39 0a                	cmp    %ecx,(%edx)
+  801fd6:	75 34                	jne    80200c <stream_unread+0x6e>
+	fd->fd_offset -= f->f_rend - f->f_rpos;
+  801fd8:	8b 43 14             	mov    0x14(%ebx),%eax
+  801fdb:	03 42 04             	add    0x4(%edx),%eax
+  801fde:	2b 43 18             	sub    0x18(%ebx),%eax
+  801fe1:	89 42 04             	mov    %eax,0x4(%edx)
+	f->f_rpos = f->f_rend = 0;
+  801fe4:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  801feb:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	return 1;
+  801ff2:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ff7:	eb 13                	jmp    80200c <stream_unread+0x6e>
+		f->f_rpos = f->f_rend = 0;
+  801ff9:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  802000:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+		return 1;
+  802007:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80200c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80200f:	c9                   	leave
+  802010:	c3                   	ret
+
+00802011 <stream_drain>:
+{
+  802011:	55                   	push   %ebp
+  802012:	89 e5                	mov    %esp,%ebp
+  802014:	56                   	push   %esi
+  802015:	53                   	push   %ebx
+  802016:	89 c6                	mov    %eax,%esi
+	for (done = 0; done < f->f_wend; done += r)
+  802018:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80201d:	eb 02                	jmp    802021 <stream_drain+0x10>
+  80201f:	01 c3                	add    %eax,%ebx
+  802021:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802024:	39 c3                	cmp    %eax,%ebx
+  802026:	73 43                	jae    80206b <stream_drain+0x5a>
+		if ((r = write(f->f_fd, f->f_buf + done, f->f_wend - done)) <= 0) {
+  802028:	83 ec 04             	sub    $0x4,%esp
+  80202b:	29 d8                	sub    %ebx,%eax
+  80202d:	50                   	push   %eax
+  80202e:	89 d8                	mov    %ebx,%eax
+  802030:	03 46 0c             	add    0xc(%esi),%eax
+  802033:	50                   	push   %eax
+  802034:	ff 36                	push   (%esi)
+  802036:	e8 ec f4 ff ff       	call   801527 <write>
+  80203b:	83 c4 10             	add    $0x10,%esp
+  80203e:	85 c0                	test   %eax,%eax
+  802040:	7f dd                	jg     80201f <stream_drain+0xe>
+			f->f_flags |= F_ERR;
+  802042:	83 4e 04 08          	orl    $0x8,0x4(%esi)
+			memmove(f->f_buf, f->f_buf + done, f->f_wend - done);
+  802046:	8b 56 0c             	mov    0xc(%esi),%edx
+  802049:	83 ec 04             	sub    $0x4,%esp
+  80204c:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80204f:	29 d8                	sub    %ebx,%eax
+  802051:	50                   	push   %eax
+  802052:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  802055:	50                   	push   %eax
+  802056:	52                   	push   %edx
+  802057:	e8 6c e9 ff ff       	call   8009c8 <memmove>
+			f->f_wend -= done;
+  80205c:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80205f:	29 d8                	sub    %ebx,%eax
+			return EOF;
+  802061:	83 c4 10             	add    $0x10,%esp
+  802064:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  802069:	eb 0a                	jmp    802075 <stream_drain+0x64>
+  80206b:	b8 00 00 00 00       	mov    $0x0,%eax
+	return 0;
+  802070:	ba 00 00 00 00       	mov    $0x0,%edx
+			f->f_wend -= done;
+  802075:	89 46 1c             	mov    %eax,0x1c(%esi)
+}
+  802078:	89 d0                	mov    %edx,%eax
+  80207a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80207d:	5b                   	pop    %ebx
+  80207e:	5e                   	pop    %esi
+  80207f:	5d                   	pop    %ebp
+  802080:	c3                   	ret
+
+00802081 <stream_setup>:
+	if (f->f_buf)
+  802081:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802085:	74 01                	je     802088 <stream_setup+0x7>
+  802087:	c3                   	ret
+{
+  802088:	55                   	push   %ebp
+  802089:	89 e5                	mov    %esp,%ebp
+  80208b:	53                   	push   %ebx
+  80208c:	83 ec 04             	sub    $0x4,%esp
+  80208f:	89 c3                	mov    %eax,%ebx
+	if (!f->f_bufmode)
+  802091:	8b 40 08             	mov    0x8(%eax),%eax
+  802094:	85 c0                	test   %eax,%eax
+  802096:	74 17                	je     8020af <stream_setup+0x2e>
+	if (f->f_bufmode != _IONBF
+  802098:	83 f8 03             	cmp    $0x3,%eax
+  80209b:	75 2d                	jne    8020ca <stream_setup+0x49>
+		f->f_buf = &f->f_ch;
+  80209d:	8d 43 20             	lea    0x20(%ebx),%eax
+  8020a0:	89 43 0c             	mov    %eax,0xc(%ebx)
+		f->f_bufsize = 1;
+  8020a3:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+}
+  8020aa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020ad:	c9                   	leave
+  8020ae:	c3                   	ret
+		f->f_bufmode = iscons(f->f_fd) > 0 ? _IOLBF : _IOFBF;
+  8020af:	83 ec 0c             	sub    $0xc,%esp
+  8020b2:	ff 33                	push   (%ebx)
+  8020b4:	e8 29 1b 00 00       	call   803be2 <iscons>
+  8020b9:	83 c4 10             	add    $0x10,%esp
+  8020bc:	85 c0                	test   %eax,%eax
+  8020be:	0f 9f c0             	setg   %al
+  8020c1:	0f b6 c0             	movzbl %al,%eax
+  8020c4:	83 c0 01             	add    $0x1,%eax
+  8020c7:	89 43 08             	mov    %eax,0x8(%ebx)
+	    && (f->f_buf = malloc(STREAM_BUFSIZE))) {
+  8020ca:	83 ec 0c             	sub    $0xc,%esp
+  8020cd:	68 00 10 00 00       	push   $0x1000
+  8020d2:	e8 6e 0b 00 00       	call   802c45 <malloc>
+  8020d7:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8020da:	83 c4 10             	add    $0x10,%esp
+  8020dd:	85 c0                	test   %eax,%eax
+  8020df:	74 bc                	je     80209d <stream_setup+0x1c>
+		f->f_bufsize = STREAM_BUFSIZE;
+  8020e1:	c7 43 10 00 10 00 00 	movl   $0x1000,0x10(%ebx)
+		f->f_flags |= F_MALLOC;
+  8020e8:	83 4b 04 10          	orl    $0x10,0x4(%ebx)
+  8020ec:	eb bc                	jmp    8020aa <stream_setup+0x29>
+
+008020ee <stream_fill>:
+
+// Refill f's buffer.  Returns the number of bytes now buffered,
+// or 0 at end of file or on error.
+static size_t
+stream_fill(FILE *f)
+{
+  8020ee:	55                   	push   %ebp
+  8020ef:	89 e5                	mov    %esp,%ebp
+  8020f1:	53                   	push   %ebx
+  8020f2:	83 ec 04             	sub    $0x4,%esp
+  8020f5:	89 c3                	mov    %eax,%ebx
+	ssize_t r;
+
+	stream_setup(f);
+  8020f7:	e8 85 ff ff ff       	call   802081 <stream_setup>
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+		return 0;
+  8020fc:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  802101:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  802105:	74 3d                	je     802144 <stream_fill+0x56>
+  802107:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  80210b:	74 10                	je     80211d <stream_fill+0x2f>
+  80210d:	89 d8                	mov    %ebx,%eax
+  80210f:	e8 fd fe ff ff       	call   802011 <stream_drain>
+		return 0;
+  802114:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(f->f_flags & F_READ) || (f->f_wend && stream_drain(f) < 0))
+  802119:	85 c0                	test   %eax,%eax
+  80211b:	78 27                	js     802144 <stream_fill+0x56>
+	if ((r = read(f->f_fd, f->f_buf, f->f_bufsize)) <= 0) {
+  80211d:	83 ec 04             	sub    $0x4,%esp
+  802120:	ff 73 10             	push   0x10(%ebx)
+  802123:	ff 73 0c             	push   0xc(%ebx)
+  802126:	ff 33                	push   (%ebx)
+  802128:	e8 02 f3 ff ff       	call   80142f <read>
+  80212d:	83 c4 10             	add    $0x10,%esp
+  802130:	85 c0                	test   %eax,%eax
+  802132:	7e 17                	jle    80214b <stream_fill+0x5d>
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+		return 0;
+	}
+	f->f_flags &= ~F_EOF;
+  802134:	83 63 04 fb          	andl   $0xfffffffb,0x4(%ebx)
+	f->f_rpos = 0;
+  802138:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	f->f_rend = r;
+  80213f:	89 c2                	mov    %eax,%edx
+  802141:	89 43 18             	mov    %eax,0x18(%ebx)
+	return r;
+}
+  802144:	89 d0                	mov    %edx,%eax
+  802146:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802149:	c9                   	leave
+  80214a:	c3                   	ret
+		f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  80214b:	c1 f8 1f             	sar    $0x1f,%eax
+  80214e:	83 e0 04             	and    $0x4,%eax
+  802151:	83 c0 04             	add    $0x4,%eax
+  802154:	09 43 04             	or     %eax,0x4(%ebx)
+		return 0;
+  802157:	ba 00 00 00 00       	mov    $0x0,%edx
+  80215c:	eb e6                	jmp    802144 <stream_fill+0x56>
+
+0080215e <fopen>:
+{
+  80215e:	55                   	push   %ebp
+  80215f:	89 e5                	mov    %esp,%ebp
+  802161:	57                   	push   %edi
+  802162:	56                   	push   %esi
+  802163:	53                   	push   %ebx
+  802164:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  80216a:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  80216d:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  802173:	89 f0                	mov    %esi,%eax
+  802175:	e8 40 fd ff ff       	call   801eba <parse_mode>
+		return 0;
+  80217a:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((omode = parse_mode(mode, &flags)) < 0)
+  80217f:	85 c0                	test   %eax,%eax
+  802181:	78 2d                	js     8021b0 <fopen+0x52>
+	if ((fd = open(path, omode)) < 0)
+  802183:	83 ec 08             	sub    $0x8,%esp
+  802186:	50                   	push   %eax
+  802187:	ff 75 08             	push   0x8(%ebp)
+  80218a:	e8 e8 f8 ff ff       	call   801a77 <open>
+  80218f:	89 c7                	mov    %eax,%edi
+  802191:	83 c4 10             	add    $0x10,%esp
+  802194:	85 c0                	test   %eax,%eax
+  802196:	78 58                	js     8021f0 <fopen+0x92>
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  802198:	80 3e 61             	cmpb   $0x61,(%esi)
+  80219b:	74 1d                	je     8021ba <fopen+0x5c>
+	if (!(f = stream_alloc(fd, flags)))
+  80219d:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+  8021a3:	89 f8                	mov    %edi,%eax
+  8021a5:	e8 7b fd ff ff       	call   801f25 <stream_alloc>
+  8021aa:	89 c3                	mov    %eax,%ebx
+  8021ac:	85 c0                	test   %eax,%eax
+  8021ae:	74 32                	je     8021e2 <fopen+0x84>
+}
+  8021b0:	89 d8                	mov    %ebx,%eax
+  8021b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021b5:	5b                   	pop    %ebx
+  8021b6:	5e                   	pop    %esi
+  8021b7:	5f                   	pop    %edi
+  8021b8:	5d                   	pop    %ebp
+  8021b9:	c3                   	ret
+	if (mode[0] == 'a' && fstat(fd, &st) >= 0)
+  8021ba:	83 ec 08             	sub    $0x8,%esp
+  8021bd:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  8021c3:	50                   	push   %eax
+  8021c4:	57                   	push   %edi
+  8021c5:	e8 db f4 ff ff       	call   8016a5 <fstat>
+  8021ca:	83 c4 10             	add    $0x10,%esp
+  8021cd:	85 c0                	test   %eax,%eax
+  8021cf:	78 cc                	js     80219d <fopen+0x3f>
+		seek(fd, st.st_size);
+  8021d1:	83 ec 08             	sub    $0x8,%esp
+  8021d4:	ff 75 dc             	push   -0x24(%ebp)
+  8021d7:	57                   	push   %edi
+  8021d8:	e8 f6 f3 ff ff       	call   8015d3 <seek>
+  8021dd:	83 c4 10             	add    $0x10,%esp
+  8021e0:	eb bb                	jmp    80219d <fopen+0x3f>
+		close(fd);
+  8021e2:	83 ec 0c             	sub    $0xc,%esp
+  8021e5:	57                   	push   %edi
+  8021e6:	e8 08 f1 ff ff       	call   8012f3 <close>
+  8021eb:	83 c4 10             	add    $0x10,%esp
+  8021ee:	eb c0                	jmp    8021b0 <fopen+0x52>
+		return 0;
+  8021f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8021f5:	eb b9                	jmp    8021b0 <fopen+0x52>
+
+008021f7 <fdopen>:
+{
+  8021f7:	55                   	push   %ebp
+  8021f8:	89 e5                	mov    %esp,%ebp
+  8021fa:	83 ec 18             	sub    $0x18,%esp
+	if (parse_mode(mode, &flags) < 0)
+  8021fd:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802200:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802203:	e8 b2 fc ff ff       	call   801eba <parse_mode>
+  802208:	89 c2                	mov    %eax,%edx
+		return 0;
+  80220a:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (parse_mode(mode, &flags) < 0)
+  80220f:	85 d2                	test   %edx,%edx
+  802211:	78 0b                	js     80221e <fdopen+0x27>
+	return stream_alloc(fd, flags);
+  802213:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802216:	8b 45 08             	mov    0x8(%ebp),%eax
+  802219:	e8 07 fd ff ff       	call   801f25 <stream_alloc>
+}
+  80221e:	c9                   	leave
+  80221f:	c3                   	ret
+
+00802220 <setvbuf>:
+{
+  802220:	55                   	push   %ebp
+  802221:	89 e5                	mov    %esp,%ebp
+  802223:	57                   	push   %edi
+  802224:	56                   	push   %esi
+  802225:	53                   	push   %ebx
+  802226:	8b 45 08             	mov    0x8(%ebp),%eax
+  802229:	8b 55 10             	mov    0x10(%ebp),%edx
+  80222c:	8b 7d 14             	mov    0x14(%ebp),%edi
+	if (f->f_buf || mode < _IOFBF || mode > _IONBF)
+  80222f:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802233:	75 3a                	jne    80226f <setvbuf+0x4f>
+  802235:	8d 72 ff             	lea    -0x1(%edx),%esi
+  802238:	83 fe 02             	cmp    $0x2,%esi
+  80223b:	77 39                	ja     802276 <setvbuf+0x56>
+	f->f_bufmode = mode;
+  80223d:	89 50 08             	mov    %edx,0x8(%eax)
+	if (buf && size && mode != _IONBF) {
+  802240:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802244:	0f 95 c3             	setne  %bl
+  802247:	85 ff                	test   %edi,%edi
+  802249:	0f 95 c1             	setne  %cl
+  80224c:	84 cb                	test   %cl,%bl
+  80224e:	74 05                	je     802255 <setvbuf+0x35>
+  802250:	83 fa 03             	cmp    $0x3,%edx
+  802253:	75 0a                	jne    80225f <setvbuf+0x3f>
+	return 0;
+  802255:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80225a:	5b                   	pop    %ebx
+  80225b:	5e                   	pop    %esi
+  80225c:	5f                   	pop    %edi
+  80225d:	5d                   	pop    %ebp
+  80225e:	c3                   	ret
+		f->f_buf = buf;
+  80225f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802262:	89 48 0c             	mov    %ecx,0xc(%eax)
+		f->f_bufsize = size;
+  802265:	89 78 10             	mov    %edi,0x10(%eax)
+	return 0;
+  802268:	b8 00 00 00 00       	mov    $0x0,%eax
+  80226d:	eb eb                	jmp    80225a <setvbuf+0x3a>
+		return EOF;
+  80226f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802274:	eb e4                	jmp    80225a <setvbuf+0x3a>
+  802276:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80227b:	eb dd                	jmp    80225a <setvbuf+0x3a>
+
+0080227d <fflush>:
+{
+  80227d:	55                   	push   %ebp
+  80227e:	89 e5                	mov    %esp,%ebp
+  802280:	57                   	push   %edi
+  802281:	56                   	push   %esi
+  802282:	53                   	push   %ebx
+  802283:	83 ec 0c             	sub    $0xc,%esp
+  802286:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!f) {
+  802289:	85 db                	test   %ebx,%ebx
+  80228b:	74 1a                	je     8022a7 <fflush+0x2a>
+	stream_unread(f);
+  80228d:	89 d8                	mov    %ebx,%eax
+  80228f:	e8 0a fd ff ff       	call   801f9e <stream_unread>
+	return stream_drain(f);
+  802294:	89 d8                	mov    %ebx,%eax
+  802296:	e8 76 fd ff ff       	call   802011 <stream_drain>
+  80229b:	89 c7                	mov    %eax,%edi
+}
+  80229d:	89 f8                	mov    %edi,%eax
+  80229f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022a2:	5b                   	pop    %ebx
+  8022a3:	5e                   	pop    %esi
+  8022a4:	5f                   	pop    %edi
+  8022a5:	5d                   	pop    %ebp
+  8022a6:	c3                   	ret
+  8022a7:	bb 20 50 80 00       	mov    $0x805020,%ebx
+  8022ac:	be 60 52 80 00       	mov    $0x805260,%esi
+		for (r = 0, i = 0; i < FOPEN_MAX; i++)
+  8022b1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022b6:	eb 03                	jmp    8022bb <fflush+0x3e>
+  8022b8:	83 c3 24             	add    $0x24,%ebx
+  8022bb:	39 f3                	cmp    %esi,%ebx
+  8022bd:	74 de                	je     80229d <fflush+0x20>
+			if (streams[i].f_flags && fflush(&streams[i]) < 0)
+  8022bf:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  8022c3:	74 f3                	je     8022b8 <fflush+0x3b>
+  8022c5:	83 ec 0c             	sub    $0xc,%esp
+  8022c8:	53                   	push   %ebx
+  8022c9:	e8 af ff ff ff       	call   80227d <fflush>
+  8022ce:	83 c4 10             	add    $0x10,%esp
+				r = EOF;
+  8022d1:	85 c0                	test   %eax,%eax
+  8022d3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8022d8:	0f 48 f8             	cmovs  %eax,%edi
+  8022db:	eb db                	jmp    8022b8 <fflush+0x3b>
+
+008022dd <fclose>:
+{
+  8022dd:	55                   	push   %ebp
+  8022de:	89 e5                	mov    %esp,%ebp
+  8022e0:	56                   	push   %esi
+  8022e1:	53                   	push   %ebx
+  8022e2:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = fflush(f);
+  8022e5:	83 ec 0c             	sub    $0xc,%esp
+  8022e8:	56                   	push   %esi
+  8022e9:	e8 8f ff ff ff       	call   80227d <fflush>
+  8022ee:	89 c3                	mov    %eax,%ebx
+	if (close(f->f_fd) < 0)
+  8022f0:	83 c4 04             	add    $0x4,%esp
+  8022f3:	ff 36                	push   (%esi)
+  8022f5:	e8 f9 ef ff ff       	call   8012f3 <close>
+  8022fa:	83 c4 10             	add    $0x10,%esp
+		r = EOF;
+  8022fd:	85 c0                	test   %eax,%eax
+  8022ff:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802304:	0f 48 d8             	cmovs  %eax,%ebx
+	if (f->f_flags & F_MALLOC)
+  802307:	f6 46 04 10          	testb  $0x10,0x4(%esi)
+  80230b:	75 10                	jne    80231d <fclose+0x40>
+	f->f_flags = 0;
+  80230d:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+}
+  802314:	89 d8                	mov    %ebx,%eax
+  802316:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802319:	5b                   	pop    %ebx
+  80231a:	5e                   	pop    %esi
+  80231b:	5d                   	pop    %ebp
+  80231c:	c3                   	ret
+		free(f->f_buf);
+  80231d:	83 ec 0c             	sub    $0xc,%esp
+  802320:	ff 76 0c             	push   0xc(%esi)
+  802323:	e8 54 08 00 00       	call   802b7c <free>
+  802328:	83 c4 10             	add    $0x10,%esp
+  80232b:	eb e0                	jmp    80230d <fclose+0x30>
+
+0080232d <fileno>:
+{
+  80232d:	55                   	push   %ebp
+  80232e:	89 e5                	mov    %esp,%ebp
+	return f->f_fd;
+  802330:	8b 45 08             	mov    0x8(%ebp),%eax
+  802333:	8b 00                	mov    (%eax),%eax
+}
+  802335:	5d                   	pop    %ebp
+  802336:	c3                   	ret
+
+00802337 <feof>:
+{
+  802337:	55                   	push   %ebp
+  802338:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_EOF) != 0;
+  80233a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80233d:	8b 40 04             	mov    0x4(%eax),%eax
+  802340:	c1 e8 02             	shr    $0x2,%eax
+  802343:	83 e0 01             	and    $0x1,%eax
+}
+  802346:	5d                   	pop    %ebp
+  802347:	c3                   	ret
+
+00802348 <ferror>:
+{
+  802348:	55                   	push   %ebp
+  802349:	89 e5                	mov    %esp,%ebp
+	return (f->f_flags & F_ERR) != 0;
+  80234b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80234e:	8b 40 04             	mov    0x4(%eax),%eax
+  802351:	c1 e8 03             	shr    $0x3,%eax
+  802354:	83 e0 01             	and    $0x1,%eax
+}
+  802357:	5d                   	pop    %ebp
+  802358:	c3                   	ret
+
+00802359 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+  802359:	55                   	push   %ebp
+  80235a:	89 e5                	mov    %esp,%ebp
+  80235c:	53                   	push   %ebx
+  80235d:	83 ec 04             	sub    $0x4,%esp
+  802360:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802363:	8b 43 18             	mov    0x18(%ebx),%eax
+  802366:	39 43 14             	cmp    %eax,0x14(%ebx)
+  802369:	74 15                	je     802380 <fgetc+0x27>
+		return EOF;
+	return (unsigned char) f->f_buf[f->f_rpos++];
+  80236b:	8b 53 0c             	mov    0xc(%ebx),%edx
+  80236e:	8b 43 14             	mov    0x14(%ebx),%eax
+  802371:	8d 48 01             	lea    0x1(%eax),%ecx
+  802374:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  802377:	0f b6 04 02          	movzbl (%edx,%eax,1),%eax
+}
+  80237b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80237e:	c9                   	leave
+  80237f:	c3                   	ret
+	if (f->f_rpos == f->f_rend && !stream_fill(f))
+  802380:	89 d8                	mov    %ebx,%eax
+  802382:	e8 67 fd ff ff       	call   8020ee <stream_fill>
+  802387:	85 c0                	test   %eax,%eax
+  802389:	75 e0                	jne    80236b <fgetc+0x12>
+		return EOF;
+  80238b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802390:	eb e9                	jmp    80237b <fgetc+0x22>
+
+00802392 <fgets>:
+
+// Read a line of at most n-1 characters, keeping the newline.
+char*
+fgets(char *s, int n, FILE *f)
+{
+  802392:	55                   	push   %ebp
+  802393:	89 e5                	mov    %esp,%ebp
+  802395:	57                   	push   %edi
+  802396:	56                   	push   %esi
+  802397:	53                   	push   %ebx
+  802398:	83 ec 1c             	sub    $0x1c,%esp
+  80239b:	8b 75 10             	mov    0x10(%ebp),%esi
+	size_t len, m;
+	char *nl;
+
+	for (len = 0; len + 1 < n; ) {
+  80239e:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+			break;
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  8023a3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023a6:	83 e8 01             	sub    $0x1,%eax
+  8023a9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (len = 0; len + 1 < n; ) {
+  8023ac:	eb 66                	jmp    802414 <fgets+0x82>
+		m = MIN(f->f_rend - f->f_rpos, n - 1 - len);
+  8023ae:	8b 46 14             	mov    0x14(%esi),%eax
+  8023b1:	8b 5e 18             	mov    0x18(%esi),%ebx
+  8023b4:	29 c3                	sub    %eax,%ebx
+  8023b6:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8023b9:	29 fa                	sub    %edi,%edx
+  8023bb:	39 d3                	cmp    %edx,%ebx
+  8023bd:	0f 47 da             	cmova  %edx,%ebx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  8023c0:	83 ec 04             	sub    $0x4,%esp
+  8023c3:	53                   	push   %ebx
+  8023c4:	6a 0a                	push   $0xa
+  8023c6:	03 46 0c             	add    0xc(%esi),%eax
+  8023c9:	50                   	push   %eax
+  8023ca:	e8 aa e6 ff ff       	call   800a79 <memfind>
+  8023cf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		    != f->f_buf + f->f_rpos + m)
+  8023d2:	8b 46 0c             	mov    0xc(%esi),%eax
+  8023d5:	8b 4e 14             	mov    0x14(%esi),%ecx
+  8023d8:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+  8023db:	01 c2                	add    %eax,%edx
+		if ((nl = memfind(f->f_buf + f->f_rpos, '\n', m))
+  8023dd:	83 c4 10             	add    $0x10,%esp
+  8023e0:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  8023e3:	74 0b                	je     8023f0 <fgets+0x5e>
+			m = nl - (f->f_buf + f->f_rpos) + 1;
+  8023e5:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8023e8:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8023eb:	29 d3                	sub    %edx,%ebx
+  8023ed:	83 c3 01             	add    $0x1,%ebx
+		memmove(s + len, f->f_buf + f->f_rpos, m);
+  8023f0:	83 ec 04             	sub    $0x4,%esp
+  8023f3:	53                   	push   %ebx
+  8023f4:	01 c8                	add    %ecx,%eax
+  8023f6:	50                   	push   %eax
+  8023f7:	89 f8                	mov    %edi,%eax
+  8023f9:	03 45 08             	add    0x8(%ebp),%eax
+  8023fc:	50                   	push   %eax
+  8023fd:	e8 c6 e5 ff ff       	call   8009c8 <memmove>
+		f->f_rpos += m;
+  802402:	01 5e 14             	add    %ebx,0x14(%esi)
+		len += m;
+  802405:	01 df                	add    %ebx,%edi
+		if (s[len - 1] == '\n')
+  802407:	83 c4 10             	add    $0x10,%esp
+  80240a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80240d:	80 7c 38 ff 0a       	cmpb   $0xa,-0x1(%eax,%edi,1)
+  802412:	74 1f                	je     802433 <fgets+0xa1>
+	for (len = 0; len + 1 < n; ) {
+  802414:	8d 47 01             	lea    0x1(%edi),%eax
+  802417:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  80241a:	73 17                	jae    802433 <fgets+0xa1>
+		if (f->f_rpos == f->f_rend && !stream_fill(f))
+  80241c:	8b 46 18             	mov    0x18(%esi),%eax
+  80241f:	39 46 14             	cmp    %eax,0x14(%esi)
+  802422:	75 8a                	jne    8023ae <fgets+0x1c>
+  802424:	89 f0                	mov    %esi,%eax
+  802426:	e8 c3 fc ff ff       	call   8020ee <stream_fill>
+  80242b:	85 c0                	test   %eax,%eax
+  80242d:	0f 85 7b ff ff ff    	jne    8023ae <fgets+0x1c>
+			break;
+	}
+	if (len == 0)
+  802433:	85 ff                	test   %edi,%edi
+  802435:	74 0f                	je     802446 <fgets+0xb4>
+		return 0;
+	s[len] = 0;
+  802437:	8b 45 08             	mov    0x8(%ebp),%eax
+  80243a:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	return s;
+}
+  80243e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802441:	5b                   	pop    %ebx
+  802442:	5e                   	pop    %esi
+  802443:	5f                   	pop    %edi
+  802444:	5d                   	pop    %ebp
+  802445:	c3                   	ret
+		return 0;
+  802446:	b8 00 00 00 00       	mov    $0x0,%eax
+  80244b:	eb f1                	jmp    80243e <fgets+0xac>
+
+0080244d <fread>:
+
+size_t
+fread(void *buf, size_t size, size_t n, FILE *f)
+{
+  80244d:	55                   	push   %ebp
+  80244e:	89 e5                	mov    %esp,%ebp
+  802450:	57                   	push   %edi
+  802451:	56                   	push   %esi
+  802452:	53                   	push   %ebx
+  802453:	83 ec 1c             	sub    $0x1c,%esp
+  802456:	8b 75 14             	mov    0x14(%ebp),%esi
+	size_t want, done, m;
+	ssize_t r;
+
+	stream_setup(f);
+  802459:	89 f0                	mov    %esi,%eax
+  80245b:	e8 21 fc ff ff       	call   802081 <stream_setup>
+	want = size * n;
+  802460:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802463:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802467:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (done = 0; done < want; done += m) {
+  80246a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80246f:	eb 43                	jmp    8024b4 <fread+0x67>
+		if (f->f_rpos < f->f_rend) {
+			m = MIN(f->f_rend - f->f_rpos, want - done);
+  802471:	29 d3                	sub    %edx,%ebx
+  802473:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802476:	29 f8                	sub    %edi,%eax
+  802478:	39 c3                	cmp    %eax,%ebx
+  80247a:	0f 47 d8             	cmova  %eax,%ebx
+			memmove((char *) buf + done, f->f_buf + f->f_rpos, m);
+  80247d:	83 ec 04             	sub    $0x4,%esp
+  802480:	53                   	push   %ebx
+  802481:	03 56 0c             	add    0xc(%esi),%edx
+  802484:	52                   	push   %edx
+  802485:	89 f8                	mov    %edi,%eax
+  802487:	03 45 08             	add    0x8(%ebp),%eax
+  80248a:	50                   	push   %eax
+  80248b:	e8 38 e5 ff ff       	call   8009c8 <memmove>
+			f->f_rpos += m;
+  802490:	01 5e 14             	add    %ebx,0x14(%esi)
+  802493:	83 c4 10             	add    $0x10,%esp
+  802496:	eb 1a                	jmp    8024b2 <fread+0x65>
+		} else if (want - done >= f->f_bufsize) {
+			// Large reads skip the buffer.
+			if (!(f->f_flags & F_READ)
+			    || (f->f_wend && stream_drain(f) < 0))
+				break;
+			if ((r = read(f->f_fd, (char *) buf + done, want - done)) <= 0) {
+  802498:	83 ec 04             	sub    $0x4,%esp
+  80249b:	53                   	push   %ebx
+  80249c:	89 f8                	mov    %edi,%eax
+  80249e:	03 45 08             	add    0x8(%ebp),%eax
+  8024a1:	50                   	push   %eax
+  8024a2:	ff 36                	push   (%esi)
+  8024a4:	e8 86 ef ff ff       	call   80142f <read>
+  8024a9:	89 c3                	mov    %eax,%ebx
+  8024ab:	83 c4 10             	add    $0x10,%esp
+  8024ae:	85 c0                	test   %eax,%eax
+  8024b0:	7e 36                	jle    8024e8 <fread+0x9b>
+	for (done = 0; done < want; done += m) {
+  8024b2:	01 df                	add    %ebx,%edi
+  8024b4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8024b7:	39 c7                	cmp    %eax,%edi
+  8024b9:	73 39                	jae    8024f4 <fread+0xa7>
+		if (f->f_rpos < f->f_rend) {
+  8024bb:	8b 56 14             	mov    0x14(%esi),%edx
+  8024be:	8b 5e 18             	mov    0x18(%esi),%ebx
+  8024c1:	39 da                	cmp    %ebx,%edx
+  8024c3:	72 ac                	jb     802471 <fread+0x24>
+		} else if (want - done >= f->f_bufsize) {
+  8024c5:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8024c8:	29 fb                	sub    %edi,%ebx
+  8024ca:	3b 5e 10             	cmp    0x10(%esi),%ebx
+  8024cd:	72 3e                	jb     80250d <fread+0xc0>
+			if (!(f->f_flags & F_READ)
+  8024cf:	f6 46 04 01          	testb  $0x1,0x4(%esi)
+  8024d3:	74 1f                	je     8024f4 <fread+0xa7>
+			    || (f->f_wend && stream_drain(f) < 0))
+  8024d5:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  8024d9:	74 bd                	je     802498 <fread+0x4b>
+  8024db:	89 f0                	mov    %esi,%eax
+  8024dd:	e8 2f fb ff ff       	call   802011 <stream_drain>
+  8024e2:	85 c0                	test   %eax,%eax
+  8024e4:	79 b2                	jns    802498 <fread+0x4b>
+  8024e6:	eb 0c                	jmp    8024f4 <fread+0xa7>
+				f->f_flags |= r < 0 ? F_ERR : F_EOF;
+  8024e8:	c1 fb 1f             	sar    $0x1f,%ebx
+  8024eb:	83 e3 04             	and    $0x4,%ebx
+  8024ee:	83 c3 04             	add    $0x4,%ebx
+  8024f1:	09 5e 04             	or     %ebx,0x4(%esi)
+		} else if (!stream_fill(f))
+			break;
+		else
+			m = 0;
+	}
+	return size ? done / size : 0;
+  8024f4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024f7:	85 c0                	test   %eax,%eax
+  8024f9:	74 0a                	je     802505 <fread+0xb8>
+  8024fb:	89 f8                	mov    %edi,%eax
+  8024fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  802502:	f7 75 0c             	divl   0xc(%ebp)
+}
+  802505:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802508:	5b                   	pop    %ebx
+  802509:	5e                   	pop    %esi
+  80250a:	5f                   	pop    %edi
+  80250b:	5d                   	pop    %ebp
+  80250c:	c3                   	ret
+		} else if (!stream_fill(f))
+  80250d:	89 f0                	mov    %esi,%eax
+  80250f:	e8 da fb ff ff       	call   8020ee <stream_fill>
+  802514:	85 c0                	test   %eax,%eax
+  802516:	74 dc                	je     8024f4 <fread+0xa7>
+			m = 0;
+  802518:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80251d:	eb 93                	jmp    8024b2 <fread+0x65>
+
+0080251f <fwrite>:
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+}
+
+size_t
+fwrite(const void *buf, size_t size, size_t n, FILE *f)
+{
+  80251f:	55                   	push   %ebp
+  802520:	89 e5                	mov    %esp,%ebp
+  802522:	57                   	push   %edi
+  802523:	56                   	push   %esi
+  802524:	53                   	push   %ebx
+  802525:	83 ec 1c             	sub    $0x1c,%esp
+  802528:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	const char *p = buf;
+	size_t want, done, m;
+	ssize_t r;
+
+	if (!(f->f_flags & F_WRITE)) {
+  80252b:	8b 43 04             	mov    0x4(%ebx),%eax
+  80252e:	a8 02                	test   $0x2,%al
+  802530:	75 13                	jne    802545 <fwrite+0x26>
+		f->f_flags |= F_ERR;
+  802532:	83 c8 08             	or     $0x8,%eax
+  802535:	89 43 04             	mov    %eax,0x4(%ebx)
+		return 0;
+  802538:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	if (f->f_bufmode == _IONBF
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+		stream_drain(f);
+	return size ? done / size : 0;
+}
+  80253d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802540:	5b                   	pop    %ebx
+  802541:	5e                   	pop    %esi
+  802542:	5f                   	pop    %edi
+  802543:	5d                   	pop    %ebp
+  802544:	c3                   	ret
+	stream_setup(f);
+  802545:	89 d8                	mov    %ebx,%eax
+  802547:	e8 35 fb ff ff       	call   802081 <stream_setup>
+	want = size * n;
+  80254c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80254f:	0f af 45 10          	imul   0x10(%ebp),%eax
+  802553:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!stream_unread(f)) {
+  802556:	89 d8                	mov    %ebx,%eax
+  802558:	e8 41 fa ff ff       	call   801f9e <stream_unread>
+	for (done = 0; done < want; ) {
+  80255d:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!stream_unread(f)) {
+  802562:	84 c0                	test   %al,%al
+  802564:	75 7b                	jne    8025e1 <fwrite+0xc2>
+		for (done = 0; done < want; done += r)
+  802566:	be 00 00 00 00       	mov    $0x0,%esi
+  80256b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80256e:	39 fe                	cmp    %edi,%esi
+  802570:	73 24                	jae    802596 <fwrite+0x77>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  802572:	83 ec 04             	sub    $0x4,%esp
+  802575:	89 f8                	mov    %edi,%eax
+  802577:	29 f0                	sub    %esi,%eax
+  802579:	50                   	push   %eax
+  80257a:	89 f0                	mov    %esi,%eax
+  80257c:	03 45 08             	add    0x8(%ebp),%eax
+  80257f:	50                   	push   %eax
+  802580:	ff 33                	push   (%ebx)
+  802582:	e8 a0 ef ff ff       	call   801527 <write>
+  802587:	83 c4 10             	add    $0x10,%esp
+  80258a:	85 c0                	test   %eax,%eax
+  80258c:	7e 04                	jle    802592 <fwrite+0x73>
+		for (done = 0; done < want; done += r)
+  80258e:	01 c6                	add    %eax,%esi
+  802590:	eb dc                	jmp    80256e <fwrite+0x4f>
+				f->f_flags |= F_ERR;
+  802592:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+		return size ? done / size : 0;
+  802596:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802599:	85 c0                	test   %eax,%eax
+  80259b:	74 a0                	je     80253d <fwrite+0x1e>
+  80259d:	89 f0                	mov    %esi,%eax
+  80259f:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025a4:	f7 75 0c             	divl   0xc(%ebp)
+  8025a7:	eb 94                	jmp    80253d <fwrite+0x1e>
+			done += r;
+  8025a9:	01 c7                	add    %eax,%edi
+			continue;
+  8025ab:	eb 34                	jmp    8025e1 <fwrite+0xc2>
+		m = MIN(f->f_bufsize - f->f_wend, want - done);
+  8025ad:	8b 73 10             	mov    0x10(%ebx),%esi
+  8025b0:	29 c6                	sub    %eax,%esi
+  8025b2:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8025b5:	29 fa                	sub    %edi,%edx
+  8025b7:	39 d6                	cmp    %edx,%esi
+  8025b9:	0f 47 f2             	cmova  %edx,%esi
+		memmove(f->f_buf + f->f_wend, p + done, m);
+  8025bc:	83 ec 04             	sub    $0x4,%esp
+  8025bf:	56                   	push   %esi
+  8025c0:	89 fa                	mov    %edi,%edx
+  8025c2:	03 55 08             	add    0x8(%ebp),%edx
+  8025c5:	52                   	push   %edx
+  8025c6:	03 43 0c             	add    0xc(%ebx),%eax
+  8025c9:	50                   	push   %eax
+  8025ca:	e8 f9 e3 ff ff       	call   8009c8 <memmove>
+		f->f_wend += m;
+  8025cf:	89 f0                	mov    %esi,%eax
+  8025d1:	03 43 1c             	add    0x1c(%ebx),%eax
+  8025d4:	89 43 1c             	mov    %eax,0x1c(%ebx)
+		done += m;
+  8025d7:	01 f7                	add    %esi,%edi
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  8025d9:	83 c4 10             	add    $0x10,%esp
+  8025dc:	3b 43 10             	cmp    0x10(%ebx),%eax
+  8025df:	74 5b                	je     80263c <fwrite+0x11d>
+	for (done = 0; done < want; ) {
+  8025e1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8025e4:	39 c7                	cmp    %eax,%edi
+  8025e6:	73 2d                	jae    802615 <fwrite+0xf6>
+		if (f->f_wend == 0 && want - done >= f->f_bufsize) {
+  8025e8:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8025eb:	85 c0                	test   %eax,%eax
+  8025ed:	75 be                	jne    8025ad <fwrite+0x8e>
+  8025ef:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8025f2:	29 fa                	sub    %edi,%edx
+  8025f4:	3b 53 10             	cmp    0x10(%ebx),%edx
+  8025f7:	72 b4                	jb     8025ad <fwrite+0x8e>
+			if ((r = write(f->f_fd, p + done, want - done)) <= 0) {
+  8025f9:	83 ec 04             	sub    $0x4,%esp
+  8025fc:	52                   	push   %edx
+  8025fd:	89 f8                	mov    %edi,%eax
+  8025ff:	03 45 08             	add    0x8(%ebp),%eax
+  802602:	50                   	push   %eax
+  802603:	ff 33                	push   (%ebx)
+  802605:	e8 1d ef ff ff       	call   801527 <write>
+  80260a:	83 c4 10             	add    $0x10,%esp
+  80260d:	85 c0                	test   %eax,%eax
+  80260f:	7f 98                	jg     8025a9 <fwrite+0x8a>
+				f->f_flags |= F_ERR;
+  802611:	83 4b 04 08          	orl    $0x8,0x4(%ebx)
+	if (f->f_bufmode == _IONBF
+  802615:	8b 43 08             	mov    0x8(%ebx),%eax
+  802618:	83 f8 03             	cmp    $0x3,%eax
+  80261b:	74 48                	je     802665 <fwrite+0x146>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  80261d:	83 f8 02             	cmp    $0x2,%eax
+  802620:	74 27                	je     802649 <fwrite+0x12a>
+	return size ? done / size : 0;
+  802622:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802625:	85 c0                	test   %eax,%eax
+  802627:	0f 84 10 ff ff ff    	je     80253d <fwrite+0x1e>
+  80262d:	89 f8                	mov    %edi,%eax
+  80262f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802634:	f7 75 0c             	divl   0xc(%ebp)
+  802637:	e9 01 ff ff ff       	jmp    80253d <fwrite+0x1e>
+		if (f->f_wend == f->f_bufsize && stream_drain(f) < 0)
+  80263c:	89 d8                	mov    %ebx,%eax
+  80263e:	e8 ce f9 ff ff       	call   802011 <stream_drain>
+  802643:	85 c0                	test   %eax,%eax
+  802645:	79 9a                	jns    8025e1 <fwrite+0xc2>
+  802647:	eb cc                	jmp    802615 <fwrite+0xf6>
+	    || (f->f_bufmode == _IOLBF && memfind(p, '\n', done) != p + done))
+  802649:	83 ec 04             	sub    $0x4,%esp
+  80264c:	57                   	push   %edi
+  80264d:	6a 0a                	push   $0xa
+  80264f:	ff 75 08             	push   0x8(%ebp)
+  802652:	e8 22 e4 ff ff       	call   800a79 <memfind>
+  802657:	89 c2                	mov    %eax,%edx
+  802659:	89 f8                	mov    %edi,%eax
+  80265b:	03 45 08             	add    0x8(%ebp),%eax
+  80265e:	83 c4 10             	add    $0x10,%esp
+  802661:	39 c2                	cmp    %eax,%edx
+  802663:	74 bd                	je     802622 <fwrite+0x103>
+		stream_drain(f);
+  802665:	89 d8                	mov    %ebx,%eax
+  802667:	e8 a5 f9 ff ff       	call   802011 <stream_drain>
+  80266c:	eb b4                	jmp    802622 <fwrite+0x103>
+
+0080266e <fputc>:
+{
+  80266e:	55                   	push   %ebp
+  80266f:	89 e5                	mov    %esp,%ebp
+  802671:	53                   	push   %ebx
+  802672:	83 ec 14             	sub    $0x14,%esp
+  802675:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	char ch = c;
+  802678:	88 5d f7             	mov    %bl,-0x9(%ebp)
+	return fwrite(&ch, 1, 1, f) == 1 ? (unsigned char) c : EOF;
+  80267b:	ff 75 0c             	push   0xc(%ebp)
+  80267e:	6a 01                	push   $0x1
+  802680:	6a 01                	push   $0x1
+  802682:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802685:	50                   	push   %eax
+  802686:	e8 94 fe ff ff       	call   80251f <fwrite>
+  80268b:	83 c4 10             	add    $0x10,%esp
+  80268e:	0f b6 db             	movzbl %bl,%ebx
+  802691:	83 f8 01             	cmp    $0x1,%eax
+  802694:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802699:	0f 44 c3             	cmove  %ebx,%eax
+}
+  80269c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80269f:	c9                   	leave
+  8026a0:	c3                   	ret
+
+008026a1 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  8026a1:	55                   	push   %ebp
+  8026a2:	89 e5                	mov    %esp,%ebp
+  8026a4:	83 ec 10             	sub    $0x10,%esp
+	fputc(ch, (FILE *) thunk);
+  8026a7:	ff 75 0c             	push   0xc(%ebp)
+  8026aa:	ff 75 08             	push   0x8(%ebp)
+  8026ad:	e8 bc ff ff ff       	call   80266e <fputc>
+}
+  8026b2:	83 c4 10             	add    $0x10,%esp
+  8026b5:	c9                   	leave
+  8026b6:	c3                   	ret
+
+008026b7 <fputs>:
+{
+  8026b7:	55                   	push   %ebp
+  8026b8:	89 e5                	mov    %esp,%ebp
+  8026ba:	56                   	push   %esi
+  8026bb:	53                   	push   %ebx
+  8026bc:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t n = strlen(s);
+  8026bf:	83 ec 0c             	sub    $0xc,%esp
+  8026c2:	56                   	push   %esi
+  8026c3:	e8 3f e1 ff ff       	call   800807 <strlen>
+  8026c8:	89 c3                	mov    %eax,%ebx
+	return fwrite(s, 1, n, f) == n ? 0 : EOF;
+  8026ca:	ff 75 0c             	push   0xc(%ebp)
+  8026cd:	50                   	push   %eax
+  8026ce:	6a 01                	push   $0x1
+  8026d0:	56                   	push   %esi
+  8026d1:	e8 49 fe ff ff       	call   80251f <fwrite>
+  8026d6:	83 c4 20             	add    $0x20,%esp
+  8026d9:	39 d8                	cmp    %ebx,%eax
+  8026db:	0f 95 c0             	setne  %al
+  8026de:	0f b6 c0             	movzbl %al,%eax
+  8026e1:	f7 d8                	neg    %eax
+}
+  8026e3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026e6:	5b                   	pop    %ebx
+  8026e7:	5e                   	pop    %esi
+  8026e8:	5d                   	pop    %ebp
+  8026e9:	c3                   	ret
+
+008026ea <sfprintf>:
+
+// Formatted output to a stream.  (fprintf takes a file descriptor.)
+int
+sfprintf(FILE *f, const char *fmt, ...)
+{
+  8026ea:	55                   	push   %ebp
+  8026eb:	89 e5                	mov    %esp,%ebp
+  8026ed:	53                   	push   %ebx
+  8026ee:	83 ec 04             	sub    $0x4,%esp
+  8026f1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8026f4:	8d 45 10             	lea    0x10(%ebp),%eax
+	vprintfmt(putch, f, fmt, ap);
+  8026f7:	50                   	push   %eax
+  8026f8:	ff 75 0c             	push   0xc(%ebp)
+  8026fb:	53                   	push   %ebx
+  8026fc:	68 a1 26 80 00       	push   $0x8026a1
+  802701:	e8 4f dc ff ff       	call   800355 <vprintfmt>
+	va_end(ap);
+	return ferror(f) ? EOF : 0;
+  802706:	8b 43 04             	mov    0x4(%ebx),%eax
+  802709:	c1 e0 1c             	shl    $0x1c,%eax
+  80270c:	c1 f8 1f             	sar    $0x1f,%eax
+}
+  80270f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802712:	c9                   	leave
+  802713:	c3                   	ret
+
+00802714 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802714:	55                   	push   %ebp
+  802715:	89 e5                	mov    %esp,%ebp
+  802717:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  80271a:	68 b8 4c 80 00       	push   $0x804cb8
+  80271f:	ff 75 0c             	push   0xc(%ebp)
+  802722:	e8 1b e1 ff ff       	call   800842 <strcpy>
+	return 0;
+}
+  802727:	b8 00 00 00 00       	mov    $0x0,%eax
+  80272c:	c9                   	leave
+  80272d:	c3                   	ret
+
+0080272e <devsock_close>:
+{
+  80272e:	55                   	push   %ebp
+  80272f:	89 e5                	mov    %esp,%ebp
+  802731:	53                   	push   %ebx
+  802732:	83 ec 10             	sub    $0x10,%esp
+  802735:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802738:	53                   	push   %ebx
+  802739:	e8 69 1d 00 00       	call   8044a7 <pageref>
+  80273e:	89 c2                	mov    %eax,%edx
+  802740:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802743:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802748:	83 fa 01             	cmp    $0x1,%edx
+  80274b:	74 05                	je     802752 <devsock_close+0x24>
+}
+  80274d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802750:	c9                   	leave
+  802751:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802752:	83 ec 0c             	sub    $0xc,%esp
+  802755:	ff 73 0c             	push   0xc(%ebx)
+  802758:	e8 b7 02 00 00       	call   802a14 <nsipc_close>
+  80275d:	83 c4 10             	add    $0x10,%esp
+  802760:	eb eb                	jmp    80274d <devsock_close+0x1f>
+
+00802762 <devsock_write>:
+{
+  802762:	55                   	push   %ebp
+  802763:	89 e5                	mov    %esp,%ebp
+  802765:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802768:	6a 00                	push   $0x0
+  80276a:	ff 75 10             	push   0x10(%ebp)
+  80276d:	ff 75 0c             	push   0xc(%ebp)
+  802770:	8b 45 08             	mov    0x8(%ebp),%eax
+  802773:	ff 70 0c             	push   0xc(%eax)
+  802776:	e8 79 03 00 00       	call   802af4 <nsipc_send>
+}
+  80277b:	c9                   	leave
+  80277c:	c3                   	ret
+
+0080277d <devsock_read>:
+{
+  80277d:	55                   	push   %ebp
+  80277e:	89 e5                	mov    %esp,%ebp
+  802780:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802783:	6a 00                	push   $0x0
+  802785:	ff 75 10             	push   0x10(%ebp)
+  802788:	ff 75 0c             	push   0xc(%ebp)
+  80278b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80278e:	ff 70 0c             	push   0xc(%eax)
+  802791:	e8 ef 02 00 00       	call   802a85 <nsipc_recv>
+}
+  802796:	c9                   	leave
+  802797:	c3                   	ret
+
+00802798 <fd2sockid>:
+{
+  802798:	55                   	push   %ebp
+  802799:	89 e5                	mov    %esp,%ebp
+  80279b:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  80279e:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8027a1:	52                   	push   %edx
+  8027a2:	50                   	push   %eax
+  8027a3:	e8 f7 e9 ff ff       	call   80119f <fd_lookup>
+  8027a8:	83 c4 10             	add    $0x10,%esp
+  8027ab:	85 c0                	test   %eax,%eax
+  8027ad:	78 10                	js     8027bf <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8027af:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027b2:	8b 0d 60 52 80 00    	mov    0x805260,%ecx
+  8027b8:	39 08                	cmp    %ecx,(%eax)
+  8027ba:	75 05                	jne    8027c1 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8027bc:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8027bf:	c9                   	leave
+  8027c0:	c3                   	ret
+		return -E_NOT_SUPP;
+  8027c1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8027c6:	eb f7                	jmp    8027bf <fd2sockid+0x27>
+
+008027c8 <alloc_sockfd>:
+{
+  8027c8:	55                   	push   %ebp
+  8027c9:	89 e5                	mov    %esp,%ebp
+  8027cb:	56                   	push   %esi
+  8027cc:	53                   	push   %ebx
+  8027cd:	83 ec 1c             	sub    $0x1c,%esp
+  8027d0:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8027d2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8027d5:	50                   	push   %eax
+  8027d6:	e8 6e e9 ff ff       	call   801149 <fd_alloc>
+  8027db:	89 c3                	mov    %eax,%ebx
+  8027dd:	83 c4 10             	add    $0x10,%esp
+  8027e0:	85 c0                	test   %eax,%eax
+  8027e2:	78 43                	js     802827 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8027e4:	83 ec 04             	sub    $0x4,%esp
+  8027e7:	68 07 04 00 00       	push   $0x407
+  8027ec:	ff 75 f4             	push   -0xc(%ebp)
+  8027ef:	6a 00                	push   $0x0
+  8027f1:	e8 8a e4 ff ff       	call   800c80 <sys_page_alloc>
+  8027f6:	89 c3                	mov    %eax,%ebx
+  8027f8:	83 c4 10             	add    $0x10,%esp
+  8027fb:	85 c0                	test   %eax,%eax
+  8027fd:	78 28                	js     802827 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8027ff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802802:	8b 15 60 52 80 00    	mov    0x805260,%edx
+  802808:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  80280a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80280d:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802814:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802817:	83 ec 0c             	sub    $0xc,%esp
+  80281a:	50                   	push   %eax
+  80281b:	e8 02 e9 ff ff       	call   801122 <fd2num>
+  802820:	89 c3                	mov    %eax,%ebx
+  802822:	83 c4 10             	add    $0x10,%esp
+  802825:	eb 0c                	jmp    802833 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802827:	83 ec 0c             	sub    $0xc,%esp
+  80282a:	56                   	push   %esi
+  80282b:	e8 e4 01 00 00       	call   802a14 <nsipc_close>
+		return r;
+  802830:	83 c4 10             	add    $0x10,%esp
+}
+  802833:	89 d8                	mov    %ebx,%eax
+  802835:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802838:	5b                   	pop    %ebx
+  802839:	5e                   	pop    %esi
+  80283a:	5d                   	pop    %ebp
+  80283b:	c3                   	ret
+
+0080283c <accept>:
+{
+  80283c:	55                   	push   %ebp
+  80283d:	89 e5                	mov    %esp,%ebp
+  80283f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802842:	8b 45 08             	mov    0x8(%ebp),%eax
+  802845:	e8 4e ff ff ff       	call   802798 <fd2sockid>
+  80284a:	85 c0                	test   %eax,%eax
+  80284c:	78 1b                	js     802869 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  80284e:	83 ec 04             	sub    $0x4,%esp
+  802851:	ff 75 10             	push   0x10(%ebp)
+  802854:	ff 75 0c             	push   0xc(%ebp)
+  802857:	50                   	push   %eax
+  802858:	e8 0e 01 00 00       	call   80296b <nsipc_accept>
+  80285d:	83 c4 10             	add    $0x10,%esp
+  802860:	85 c0                	test   %eax,%eax
+  802862:	78 05                	js     802869 <accept+0x2d>
+	return alloc_sockfd(r);
+  802864:	e8 5f ff ff ff       	call   8027c8 <alloc_sockfd>
+}
+  802869:	c9                   	leave
+  80286a:	c3                   	ret
+
+0080286b <bind>:
+{
+  80286b:	55                   	push   %ebp
+  80286c:	89 e5                	mov    %esp,%ebp
+  80286e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802871:	8b 45 08             	mov    0x8(%ebp),%eax
+  802874:	e8 1f ff ff ff       	call   802798 <fd2sockid>
+  802879:	85 c0                	test   %eax,%eax
+  80287b:	78 12                	js     80288f <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80287d:	83 ec 04             	sub    $0x4,%esp
+  802880:	ff 75 10             	push   0x10(%ebp)
+  802883:	ff 75 0c             	push   0xc(%ebp)
+  802886:	50                   	push   %eax
+  802887:	e8 31 01 00 00       	call   8029bd <nsipc_bind>
+  80288c:	83 c4 10             	add    $0x10,%esp
+}
+  80288f:	c9                   	leave
+  802890:	c3                   	ret
+
+00802891 <shutdown>:
+{
+  802891:	55                   	push   %ebp
+  802892:	89 e5                	mov    %esp,%ebp
+  802894:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802897:	8b 45 08             	mov    0x8(%ebp),%eax
+  80289a:	e8 f9 fe ff ff       	call   802798 <fd2sockid>
+  80289f:	85 c0                	test   %eax,%eax
+  8028a1:	78 0f                	js     8028b2 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8028a3:	83 ec 08             	sub    $0x8,%esp
+  8028a6:	ff 75 0c             	push   0xc(%ebp)
+  8028a9:	50                   	push   %eax
+  8028aa:	e8 43 01 00 00       	call   8029f2 <nsipc_shutdown>
+  8028af:	83 c4 10             	add    $0x10,%esp
+}
+  8028b2:	c9                   	leave
+  8028b3:	c3                   	ret
+
+008028b4 <connect>:
+{
+  8028b4:	55                   	push   %ebp
+  8028b5:	89 e5                	mov    %esp,%ebp
+  8028b7:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8028ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028bd:	e8 d6 fe ff ff       	call   802798 <fd2sockid>
+  8028c2:	85 c0                	test   %eax,%eax
+  8028c4:	78 12                	js     8028d8 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8028c6:	83 ec 04             	sub    $0x4,%esp
+  8028c9:	ff 75 10             	push   0x10(%ebp)
+  8028cc:	ff 75 0c             	push   0xc(%ebp)
+  8028cf:	50                   	push   %eax
+  8028d0:	e8 59 01 00 00       	call   802a2e <nsipc_connect>
+  8028d5:	83 c4 10             	add    $0x10,%esp
+}
+  8028d8:	c9                   	leave
+  8028d9:	c3                   	ret
+
+008028da <listen>:
+{
+  8028da:	55                   	push   %ebp
+  8028db:	89 e5                	mov    %esp,%ebp
+  8028dd:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8028e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028e3:	e8 b0 fe ff ff       	call   802798 <fd2sockid>
+  8028e8:	85 c0                	test   %eax,%eax
+  8028ea:	78 0f                	js     8028fb <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8028ec:	83 ec 08             	sub    $0x8,%esp
+  8028ef:	ff 75 0c             	push   0xc(%ebp)
+  8028f2:	50                   	push   %eax
+  8028f3:	e8 6b 01 00 00       	call   802a63 <nsipc_listen>
+  8028f8:	83 c4 10             	add    $0x10,%esp
+}
+  8028fb:	c9                   	leave
+  8028fc:	c3                   	ret
+
+008028fd <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8028fd:	55                   	push   %ebp
+  8028fe:	89 e5                	mov    %esp,%ebp
+  802900:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802903:	ff 75 10             	push   0x10(%ebp)
+  802906:	ff 75 0c             	push   0xc(%ebp)
+  802909:	ff 75 08             	push   0x8(%ebp)
+  80290c:	e8 41 02 00 00       	call   802b52 <nsipc_socket>
+  802911:	83 c4 10             	add    $0x10,%esp
+  802914:	85 c0                	test   %eax,%eax
+  802916:	78 05                	js     80291d <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802918:	e8 ab fe ff ff       	call   8027c8 <alloc_sockfd>
+}
+  80291d:	c9                   	leave
+  80291e:	c3                   	ret
+
+0080291f <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80291f:	55                   	push   %ebp
+  802920:	89 e5                	mov    %esp,%ebp
+  802922:	53                   	push   %ebx
+  802923:	83 ec 04             	sub    $0x4,%esp
+  802926:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802928:	83 3d 08 60 80 00 00 	cmpl   $0x0,0x806008
+  80292f:	74 26                	je     802957 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802931:	6a 07                	push   $0x7
+  802933:	68 00 80 80 00       	push   $0x808000
+  802938:	53                   	push   %ebx
+  802939:	ff 35 08 60 80 00    	push   0x806008
+  80293f:	e8 ce 1a 00 00       	call   804412 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802944:	83 c4 0c             	add    $0xc,%esp
+  802947:	6a 00                	push   $0x0
+  802949:	6a 00                	push   $0x0
+  80294b:	6a 00                	push   $0x0
+  80294d:	e8 ca 19 00 00       	call   80431c <ipc_recv>
+}
+  802952:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802955:	c9                   	leave
+  802956:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802957:	83 ec 0c             	sub    $0xc,%esp
+  80295a:	6a 02                	push   $0x2
+  80295c:	e8 07 1b 00 00       	call   804468 <ipc_find_env>
+  802961:	a3 08 60 80 00       	mov    %eax,0x806008
+  802966:	83 c4 10             	add    $0x10,%esp
+  802969:	eb c6                	jmp    802931 <nsipc+0x12>
+
+0080296b <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  80296b:	55                   	push   %ebp
+  80296c:	89 e5                	mov    %esp,%ebp
+  80296e:	56                   	push   %esi
+  80296f:	53                   	push   %ebx
+  802970:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802973:	8b 45 08             	mov    0x8(%ebp),%eax
+  802976:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  80297b:	8b 06                	mov    (%esi),%eax
+  80297d:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802982:	b8 01 00 00 00       	mov    $0x1,%eax
+  802987:	e8 93 ff ff ff       	call   80291f <nsipc>
+  80298c:	89 c3                	mov    %eax,%ebx
+  80298e:	85 c0                	test   %eax,%eax
+  802990:	79 09                	jns    80299b <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802992:	89 d8                	mov    %ebx,%eax
+  802994:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802997:	5b                   	pop    %ebx
+  802998:	5e                   	pop    %esi
+  802999:	5d                   	pop    %ebp
+  80299a:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80299b:	83 ec 04             	sub    $0x4,%esp
+  80299e:	ff 35 10 80 80 00    	push   0x808010
+  8029a4:	68 00 80 80 00       	push   $0x808000
+  8029a9:	ff 75 0c             	push   0xc(%ebp)
+  8029ac:	e8 17 e0 ff ff       	call   8009c8 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8029b1:	a1 10 80 80 00       	mov    0x808010,%eax
+  8029b6:	89 06                	mov    %eax,(%esi)
+  8029b8:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8029bb:	eb d5                	jmp    802992 <nsipc_accept+0x27>
+
+008029bd <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8029bd:	55                   	push   %ebp
+  8029be:	89 e5                	mov    %esp,%ebp
+  8029c0:	53                   	push   %ebx
+  8029c1:	83 ec 08             	sub    $0x8,%esp
+  8029c4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8029c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029ca:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8029cf:	53                   	push   %ebx
+  8029d0:	ff 75 0c             	push   0xc(%ebp)
+  8029d3:	68 04 80 80 00       	push   $0x808004
+  8029d8:	e8 eb df ff ff       	call   8009c8 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8029dd:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  8029e3:	b8 02 00 00 00       	mov    $0x2,%eax
+  8029e8:	e8 32 ff ff ff       	call   80291f <nsipc>
+}
+  8029ed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029f0:	c9                   	leave
+  8029f1:	c3                   	ret
+
+008029f2 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8029f2:	55                   	push   %ebp
+  8029f3:	89 e5                	mov    %esp,%ebp
+  8029f5:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8029f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029fb:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  802a00:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a03:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802a08:	b8 03 00 00 00       	mov    $0x3,%eax
+  802a0d:	e8 0d ff ff ff       	call   80291f <nsipc>
+}
+  802a12:	c9                   	leave
+  802a13:	c3                   	ret
+
+00802a14 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802a14:	55                   	push   %ebp
+  802a15:	89 e5                	mov    %esp,%ebp
+  802a17:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802a1a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a1d:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  802a22:	b8 04 00 00 00       	mov    $0x4,%eax
+  802a27:	e8 f3 fe ff ff       	call   80291f <nsipc>
+}
+  802a2c:	c9                   	leave
+  802a2d:	c3                   	ret
+
+00802a2e <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802a2e:	55                   	push   %ebp
+  802a2f:	89 e5                	mov    %esp,%ebp
+  802a31:	53                   	push   %ebx
+  802a32:	83 ec 08             	sub    $0x8,%esp
+  802a35:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802a38:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a3b:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802a40:	53                   	push   %ebx
+  802a41:	ff 75 0c             	push   0xc(%ebp)
+  802a44:	68 04 80 80 00       	push   $0x808004
+  802a49:	e8 7a df ff ff       	call   8009c8 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802a4e:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  802a54:	b8 05 00 00 00       	mov    $0x5,%eax
+  802a59:	e8 c1 fe ff ff       	call   80291f <nsipc>
+}
+  802a5e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a61:	c9                   	leave
+  802a62:	c3                   	ret
+
+00802a63 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802a63:	55                   	push   %ebp
+  802a64:	89 e5                	mov    %esp,%ebp
+  802a66:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802a69:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a6c:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802a71:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a74:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802a79:	b8 06 00 00 00       	mov    $0x6,%eax
+  802a7e:	e8 9c fe ff ff       	call   80291f <nsipc>
+}
+  802a83:	c9                   	leave
+  802a84:	c3                   	ret
+
+00802a85 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802a85:	55                   	push   %ebp
+  802a86:	89 e5                	mov    %esp,%ebp
+  802a88:	56                   	push   %esi
+  802a89:	53                   	push   %ebx
+  802a8a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802a8d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a90:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  802a95:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  802a9b:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a9e:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802aa3:	b8 07 00 00 00       	mov    $0x7,%eax
+  802aa8:	e8 72 fe ff ff       	call   80291f <nsipc>
+  802aad:	89 c3                	mov    %eax,%ebx
+  802aaf:	85 c0                	test   %eax,%eax
+  802ab1:	78 22                	js     802ad5 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802ab3:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802ab8:	39 c6                	cmp    %eax,%esi
+  802aba:	0f 4e c6             	cmovle %esi,%eax
+  802abd:	39 c3                	cmp    %eax,%ebx
+  802abf:	7f 1d                	jg     802ade <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802ac1:	83 ec 04             	sub    $0x4,%esp
+  802ac4:	53                   	push   %ebx
+  802ac5:	68 00 80 80 00       	push   $0x808000
+  802aca:	ff 75 0c             	push   0xc(%ebp)
+  802acd:	e8 f6 de ff ff       	call   8009c8 <memmove>
+  802ad2:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802ad5:	89 d8                	mov    %ebx,%eax
+  802ad7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ada:	5b                   	pop    %ebx
+  802adb:	5e                   	pop    %esi
+  802adc:	5d                   	pop    %ebp
+  802add:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802ade:	68 c4 4c 80 00       	push   $0x804cc4
+  802ae3:	68 7d 4c 80 00       	push   $0x804c7d
+  802ae8:	6a 62                	push   $0x62
+  802aea:	68 d9 4c 80 00       	push   $0x804cd9
+  802aef:	e8 6c 11 00 00       	call   803c60 <_panic>
+
+00802af4 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802af4:	55                   	push   %ebp
+  802af5:	89 e5                	mov    %esp,%ebp
+  802af7:	53                   	push   %ebx
+  802af8:	83 ec 04             	sub    $0x4,%esp
+  802afb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802afe:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b01:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802b06:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802b0c:	7f 2e                	jg     802b3c <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802b0e:	83 ec 04             	sub    $0x4,%esp
+  802b11:	53                   	push   %ebx
+  802b12:	ff 75 0c             	push   0xc(%ebp)
+  802b15:	68 0c 80 80 00       	push   $0x80800c
+  802b1a:	e8 a9 de ff ff       	call   8009c8 <memmove>
+	nsipcbuf.send.req_size = size;
+  802b1f:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802b25:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b28:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802b2d:	b8 08 00 00 00       	mov    $0x8,%eax
+  802b32:	e8 e8 fd ff ff       	call   80291f <nsipc>
+}
+  802b37:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b3a:	c9                   	leave
+  802b3b:	c3                   	ret
+	assert(size < 1600);
+  802b3c:	68 e5 4c 80 00       	push   $0x804ce5
+  802b41:	68 7d 4c 80 00       	push   $0x804c7d
+  802b46:	6a 6d                	push   $0x6d
+  802b48:	68 d9 4c 80 00       	push   $0x804cd9
+  802b4d:	e8 0e 11 00 00       	call   803c60 <_panic>
+
+00802b52 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802b52:	55                   	push   %ebp
+  802b53:	89 e5                	mov    %esp,%ebp
+  802b55:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802b58:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b5b:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  802b60:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b63:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802b68:	8b 45 10             	mov    0x10(%ebp),%eax
+  802b6b:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802b70:	b8 09 00 00 00       	mov    $0x9,%eax
+  802b75:	e8 a5 fd ff ff       	call   80291f <nsipc>
+}
+  802b7a:	c9                   	leave
+  802b7b:	c3                   	ret
+
+00802b7c <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  802b7c:	55                   	push   %ebp
+  802b7d:	89 e5                	mov    %esp,%ebp
+  802b7f:	53                   	push   %ebx
+  802b80:	83 ec 10             	sub    $0x10,%esp
+  802b83:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	mutex_lock(&malloc_mu);
+  802b86:	68 0c 60 80 00       	push   $0x80600c
+  802b8b:	e8 50 07 00 00       	call   8032e0 <mutex_lock>
+	if (v == 0)
+  802b90:	83 c4 10             	add    $0x10,%esp
+  802b93:	85 db                	test   %ebx,%ebx
+  802b95:	0f 84 85 00 00 00    	je     802c20 <free+0xa4>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802b9b:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802ba1:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802ba6:	77 51                	ja     802bf9 <free+0x7d>
+	c = ROUNDDOWN(v, PGSIZE);
+  802ba8:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  802bae:	89 d8                	mov    %ebx,%eax
+  802bb0:	c1 e8 0c             	shr    $0xc,%eax
+  802bb3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802bba:	f6 c4 02             	test   $0x2,%ah
+  802bbd:	74 50                	je     802c0f <free+0x93>
+		sys_page_unmap(0, c);
+  802bbf:	83 ec 08             	sub    $0x8,%esp
+  802bc2:	53                   	push   %ebx
+  802bc3:	6a 00                	push   $0x0
+  802bc5:	e8 4f e1 ff ff       	call   800d19 <sys_page_unmap>
+		c += PGSIZE;
+  802bca:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  802bd0:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802bd6:	83 c4 10             	add    $0x10,%esp
+  802bd9:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802bde:	76 ce                	jbe    802bae <free+0x32>
+  802be0:	68 2f 4d 80 00       	push   $0x804d2f
+  802be5:	68 7d 4c 80 00       	push   $0x804c7d
+  802bea:	68 82 00 00 00       	push   $0x82
+  802bef:	68 22 4d 80 00       	push   $0x804d22
+  802bf4:	e8 67 10 00 00       	call   803c60 <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802bf9:	68 f4 4c 80 00       	push   $0x804cf4
+  802bfe:	68 7d 4c 80 00       	push   $0x804c7d
+  802c03:	6a 7b                	push   $0x7b
+  802c05:	68 22 4d 80 00       	push   $0x804d22
+  802c0a:	e8 51 10 00 00       	call   803c60 <_panic>
+	if (--(*ref) == 0)
+  802c0f:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  802c15:	83 e8 01             	sub    $0x1,%eax
+  802c18:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  802c1e:	74 15                	je     802c35 <free+0xb9>
+	free_locked(v);
+	mutex_unlock(&malloc_mu);
+  802c20:	83 ec 0c             	sub    $0xc,%esp
+  802c23:	68 0c 60 80 00       	push   $0x80600c
+  802c28:	e8 20 07 00 00       	call   80334d <mutex_unlock>
+}
+  802c2d:	83 c4 10             	add    $0x10,%esp
+  802c30:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c33:	c9                   	leave
+  802c34:	c3                   	ret
+		sys_page_unmap(0, c);
+  802c35:	83 ec 08             	sub    $0x8,%esp
+  802c38:	53                   	push   %ebx
+  802c39:	6a 00                	push   $0x0
+  802c3b:	e8 d9 e0 ff ff       	call   800d19 <sys_page_unmap>
+  802c40:	83 c4 10             	add    $0x10,%esp
+  802c43:	eb db                	jmp    802c20 <free+0xa4>
+
+00802c45 <malloc>:
+{
+  802c45:	55                   	push   %ebp
+  802c46:	89 e5                	mov    %esp,%ebp
+  802c48:	57                   	push   %edi
+  802c49:	56                   	push   %esi
+  802c4a:	53                   	push   %ebx
+  802c4b:	83 ec 28             	sub    $0x28,%esp
+	mutex_lock(&malloc_mu);
+  802c4e:	68 0c 60 80 00       	push   $0x80600c
+  802c53:	e8 88 06 00 00       	call   8032e0 <mutex_lock>
+	if (mptr == 0)
+  802c58:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+  802c5e:	83 c4 10             	add    $0x10,%esp
+  802c61:	85 ff                	test   %edi,%edi
+  802c63:	74 6c                	je     802cd1 <malloc+0x8c>
+	n = ROUNDUP(n, 4);
+  802c65:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c68:	83 c0 03             	add    $0x3,%eax
+  802c6b:	83 e0 fc             	and    $0xfffffffc,%eax
+  802c6e:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  802c70:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  802c75:	0f 87 64 01 00 00    	ja     802ddf <malloc+0x19a>
+	if ((uintptr_t) mptr % PGSIZE){
+  802c7b:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  802c81:	74 30                	je     802cb3 <malloc+0x6e>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  802c83:	89 f9                	mov    %edi,%ecx
+  802c85:	c1 e9 0c             	shr    $0xc,%ecx
+  802c88:	8d 44 07 03          	lea    0x3(%edi,%eax,1),%eax
+  802c8c:	c1 e8 0c             	shr    $0xc,%eax
+  802c8f:	39 c1                	cmp    %eax,%ecx
+  802c91:	74 5f                	je     802cf2 <malloc+0xad>
+		free(mptr);	/* drop reference to this page */
+  802c93:	83 ec 0c             	sub    $0xc,%esp
+  802c96:	57                   	push   %edi
+  802c97:	e8 e0 fe ff ff       	call   802b7c <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  802c9c:	a1 10 60 80 00       	mov    0x806010,%eax
+  802ca1:	05 00 10 00 00       	add    $0x1000,%eax
+  802ca6:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802cab:	a3 10 60 80 00       	mov    %eax,0x806010
+  802cb0:	83 c4 10             	add    $0x10,%esp
+  802cb3:	8b 0d 10 60 80 00    	mov    0x806010,%ecx
+{
+  802cb9:	ba 02 00 00 00       	mov    $0x2,%edx
+  802cbe:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  802cc2:	8d 7e 04             	lea    0x4(%esi),%edi
+  802cc5:	89 cb                	mov    %ecx,%ebx
+  802cc7:	01 f9                	add    %edi,%ecx
+  802cc9:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802ccc:	e9 8b 00 00 00       	jmp    802d5c <malloc+0x117>
+		mptr = mbegin;
+  802cd1:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  802cd8:	00 00 08 
+	n = ROUNDUP(n, 4);
+  802cdb:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cde:	83 c0 03             	add    $0x3,%eax
+  802ce1:	83 e0 fc             	and    $0xfffffffc,%eax
+  802ce4:	89 c6                	mov    %eax,%esi
+	if (n >= MAXMALLOC)
+  802ce6:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+  802ceb:	76 c6                	jbe    802cb3 <malloc+0x6e>
+  802ced:	e9 d6 00 00 00       	jmp    802dc8 <malloc+0x183>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  802cf2:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802cf8:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+			(*ref)++;
+  802cfd:	83 40 fc 01          	addl   $0x1,-0x4(%eax)
+			mptr += n;
+  802d01:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  802d04:	a3 10 60 80 00       	mov    %eax,0x806010
+			return v;
+  802d09:	e9 ba 00 00 00       	jmp    802dc8 <malloc+0x183>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  802d0e:	05 00 10 00 00       	add    $0x1000,%eax
+  802d13:	39 c8                	cmp    %ecx,%eax
+  802d15:	0f 83 cb 00 00 00    	jae    802de6 <malloc+0x1a1>
+		if (va >= (uintptr_t) mend
+  802d1b:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  802d20:	77 22                	ja     802d44 <malloc+0xff>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  802d22:	89 c2                	mov    %eax,%edx
+  802d24:	c1 ea 16             	shr    $0x16,%edx
+  802d27:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802d2e:	f6 c2 01             	test   $0x1,%dl
+  802d31:	74 db                	je     802d0e <malloc+0xc9>
+  802d33:	89 c2                	mov    %eax,%edx
+  802d35:	c1 ea 0c             	shr    $0xc,%edx
+  802d38:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802d3f:	f6 c2 01             	test   $0x1,%dl
+  802d42:	74 ca                	je     802d0e <malloc+0xc9>
+		if (mptr == mend) {
+  802d44:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802d4a:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  802d50:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  802d54:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  802d5a:	74 04                	je     802d60 <malloc+0x11b>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  802d5c:	89 d8                	mov    %ebx,%eax
+  802d5e:	eb b3                	jmp    802d13 <malloc+0xce>
+  802d60:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  802d63:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  802d68:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  802d6c:	83 ea 01             	sub    $0x1,%edx
+  802d6f:	0f 85 50 ff ff ff    	jne    802cc5 <malloc+0x80>
+  802d75:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  802d7c:	00 00 08 
+				return 0;	/* out of address space */
+  802d7f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d84:	eb 42                	jmp    802dc8 <malloc+0x183>
+			for (; i >= 0; i -= PGSIZE)
+  802d86:	85 db                	test   %ebx,%ebx
+  802d88:	78 1e                	js     802da8 <malloc+0x163>
+				sys_page_unmap(0, mptr + i);
+  802d8a:	83 ec 08             	sub    $0x8,%esp
+  802d8d:	89 d8                	mov    %ebx,%eax
+  802d8f:	03 05 10 60 80 00    	add    0x806010,%eax
+  802d95:	50                   	push   %eax
+  802d96:	6a 00                	push   $0x0
+  802d98:	e8 7c df ff ff       	call   800d19 <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  802d9d:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  802da3:	83 c4 10             	add    $0x10,%esp
+  802da6:	eb de                	jmp    802d86 <malloc+0x141>
+			return 0;	/* out of physical memory */
+  802da8:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dad:	eb 19                	jmp    802dc8 <malloc+0x183>
+	ref = (uint32_t*) (mptr + i - 4);
+  802daf:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802db2:	8b 3d 10 60 80 00    	mov    0x806010,%edi
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  802db8:	c7 44 1f fc 02 00 00 	movl   $0x2,-0x4(%edi,%ebx,1)
+  802dbf:	00 
+	mptr += n;
+  802dc0:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  802dc3:	a3 10 60 80 00       	mov    %eax,0x806010
+	mutex_unlock(&malloc_mu);
+  802dc8:	83 ec 0c             	sub    $0xc,%esp
+  802dcb:	68 0c 60 80 00       	push   $0x80600c
+  802dd0:	e8 78 05 00 00       	call   80334d <mutex_unlock>
+}
+  802dd5:	89 f8                	mov    %edi,%eax
+  802dd7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802dda:	5b                   	pop    %ebx
+  802ddb:	5e                   	pop    %esi
+  802ddc:	5f                   	pop    %edi
+  802ddd:	5d                   	pop    %ebp
+  802dde:	c3                   	ret
+		return 0;
+  802ddf:	bf 00 00 00 00       	mov    $0x0,%edi
+  802de4:	eb e2                	jmp    802dc8 <malloc+0x183>
+  802de6:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  802dea:	74 06                	je     802df2 <malloc+0x1ad>
+  802dec:	89 1d 10 60 80 00    	mov    %ebx,0x806010
+	for (i = 0; i < n + 4; i += PGSIZE){
+  802df2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802df7:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  802dfa:	39 fb                	cmp    %edi,%ebx
+  802dfc:	73 b1                	jae    802daf <malloc+0x16a>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  802dfe:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  802e04:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  802e07:	39 fe                	cmp    %edi,%esi
+  802e09:	0f 92 c0             	setb   %al
+  802e0c:	0f b6 c0             	movzbl %al,%eax
+  802e0f:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  802e12:	83 c8 07             	or     $0x7,%eax
+  802e15:	50                   	push   %eax
+  802e16:	89 d8                	mov    %ebx,%eax
+  802e18:	03 05 10 60 80 00    	add    0x806010,%eax
+  802e1e:	50                   	push   %eax
+  802e1f:	6a 00                	push   $0x0
+  802e21:	e8 5a de ff ff       	call   800c80 <sys_page_alloc>
+  802e26:	83 c4 10             	add    $0x10,%esp
+  802e29:	85 c0                	test   %eax,%eax
+  802e2b:	0f 88 55 ff ff ff    	js     802d86 <malloc+0x141>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  802e31:	89 f3                	mov    %esi,%ebx
+  802e33:	eb c5                	jmp    802dfa <malloc+0x1b5>
+
+00802e35 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802e35:	55                   	push   %ebp
+  802e36:	89 e5                	mov    %esp,%ebp
+  802e38:	56                   	push   %esi
+  802e39:	53                   	push   %ebx
+  802e3a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802e3d:	83 ec 0c             	sub    $0xc,%esp
+  802e40:	ff 75 08             	push   0x8(%ebp)
+  802e43:	e8 ea e2 ff ff       	call   801132 <fd2data>
+  802e48:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802e4a:	83 c4 08             	add    $0x8,%esp
+  802e4d:	68 47 4d 80 00       	push   $0x804d47
+  802e52:	53                   	push   %ebx
+  802e53:	e8 ea d9 ff ff       	call   800842 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802e58:	8b 46 04             	mov    0x4(%esi),%eax
+  802e5b:	2b 06                	sub    (%esi),%eax
+  802e5d:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802e63:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802e6a:	00 00 00 
+	stat->st_dev = &devpipe;
+  802e6d:	c7 83 88 00 00 00 7c 	movl   $0x80527c,0x88(%ebx)
+  802e74:	52 80 00 
+	return 0;
+}
+  802e77:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e7c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e7f:	5b                   	pop    %ebx
+  802e80:	5e                   	pop    %esi
+  802e81:	5d                   	pop    %ebp
+  802e82:	c3                   	ret
+
+00802e83 <pipewake>:
+// Atomically add inc to *addr.  Returns the value *addr held before
+// the addition.  Being a locked instruction, it is also a full barrier.
+static inline uint32_t
+atomic_add(volatile uint32_t *addr, uint32_t inc)
+{
+	asm volatile("lock; xaddl %0, %1"
+  802e83:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802e88:	f0 0f c1 08          	lock xadd %ecx,(%eax)
+	if (atomic_add(nwait, 0))
+  802e8c:	85 c9                	test   %ecx,%ecx
+  802e8e:	75 01                	jne    802e91 <pipewake+0xe>
+  802e90:	c3                   	ret
+{
+  802e91:	55                   	push   %ebp
+  802e92:	89 e5                	mov    %esp,%ebp
+  802e94:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((volatile uint32_t *) pos, NENV);
+  802e97:	68 00 04 00 00       	push   $0x400
+  802e9c:	52                   	push   %edx
+  802e9d:	e8 22 e1 ff ff       	call   800fc4 <sys_futex_wake>
+  802ea2:	83 c4 10             	add    $0x10,%esp
+}
+  802ea5:	c9                   	leave
+  802ea6:	c3                   	ret
+
+00802ea7 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802ea7:	55                   	push   %ebp
+  802ea8:	89 e5                	mov    %esp,%ebp
+  802eaa:	56                   	push   %esi
+  802eab:	53                   	push   %ebx
+  802eac:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802eaf:	83 ec 0c             	sub    $0xc,%esp
+  802eb2:	56                   	push   %esi
+  802eb3:	e8 7a e2 ff ff       	call   801132 <fd2data>
+  802eb8:	89 c3                	mov    %eax,%ebx
+
+	// Kick sleepers on the other end so they recheck for eof.  If
+	// they look before our data page is gone too, they catch it on
+	// their next PIPEWAIT timeout.
+	(void) sys_page_unmap(0, fd);
+  802eba:	83 c4 08             	add    $0x8,%esp
+  802ebd:	56                   	push   %esi
+  802ebe:	6a 00                	push   $0x0
+  802ec0:	e8 54 de ff ff       	call   800d19 <sys_page_unmap>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  802ec5:	8d 53 04             	lea    0x4(%ebx),%edx
+  802ec8:	8d 43 08             	lea    0x8(%ebx),%eax
+  802ecb:	e8 b3 ff ff ff       	call   802e83 <pipewake>
+	pipewake(&p->p_wwait, &p->p_rpos);
+  802ed0:	8d 43 0c             	lea    0xc(%ebx),%eax
+  802ed3:	89 da                	mov    %ebx,%edx
+  802ed5:	e8 a9 ff ff ff       	call   802e83 <pipewake>
+	return sys_page_unmap(0, fd2data(fd));
+  802eda:	89 34 24             	mov    %esi,(%esp)
+  802edd:	e8 50 e2 ff ff       	call   801132 <fd2data>
+  802ee2:	83 c4 08             	add    $0x8,%esp
+  802ee5:	50                   	push   %eax
+  802ee6:	6a 00                	push   $0x0
+  802ee8:	e8 2c de ff ff       	call   800d19 <sys_page_unmap>
+}
+  802eed:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ef0:	5b                   	pop    %ebx
+  802ef1:	5e                   	pop    %esi
+  802ef2:	5d                   	pop    %ebp
+  802ef3:	c3                   	ret
+
+00802ef4 <_pipeisclosed>:
+{
+  802ef4:	55                   	push   %ebp
+  802ef5:	89 e5                	mov    %esp,%ebp
+  802ef7:	57                   	push   %edi
+  802ef8:	56                   	push   %esi
+  802ef9:	53                   	push   %ebx
+  802efa:	83 ec 1c             	sub    $0x1c,%esp
+  802efd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802f00:	89 d7                	mov    %edx,%edi
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802f02:	be ff df bf ee       	mov    $0xeebfdfff,%esi
+  802f07:	eb 5d                	jmp    802f66 <_pipeisclosed+0x72>
+		return pthread_main_tls;
+  802f09:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		n = thisenv->env_runs;
+  802f0f:	8b 02                	mov    (%edx),%eax
+  802f11:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802f14:	83 ec 0c             	sub    $0xc,%esp
+  802f17:	ff 75 e0             	push   -0x20(%ebp)
+  802f1a:	e8 88 15 00 00       	call   8044a7 <pageref>
+  802f1f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802f22:	89 3c 24             	mov    %edi,(%esp)
+  802f25:	e8 7d 15 00 00       	call   8044a7 <pageref>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  802f2a:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802f2c:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  802f32:	83 c4 10             	add    $0x10,%esp
+  802f35:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  802f3b:	77 15                	ja     802f52 <_pipeisclosed+0x5e>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802f3d:	89 f2                	mov    %esi,%edx
+  802f3f:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  802f41:	c1 ea 10             	shr    $0x10,%edx
+  802f44:	74 0c                	je     802f52 <_pipeisclosed+0x5e>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802f46:	c1 e2 10             	shl    $0x10,%edx
+  802f49:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  802f4e:	29 d1                	sub    %edx,%ecx
+  802f50:	eb 06                	jmp    802f58 <_pipeisclosed+0x64>
+		return pthread_main_tls;
+  802f52:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		nn = thisenv->env_runs;
+  802f58:	8b 11                	mov    (%ecx),%edx
+  802f5a:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  802f5d:	39 d3                	cmp    %edx,%ebx
+  802f5f:	74 6e                	je     802fcf <_pipeisclosed+0xdb>
+		if (n != nn && ret == 1)
+  802f61:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802f64:	74 24                	je     802f8a <_pipeisclosed+0x96>
+  802f66:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802f68:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802f6e:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802f73:	77 94                	ja     802f09 <_pipeisclosed+0x15>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802f75:	89 f0                	mov    %esi,%eax
+  802f77:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  802f79:	c1 e8 10             	shr    $0x10,%eax
+  802f7c:	74 8b                	je     802f09 <_pipeisclosed+0x15>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802f7e:	c1 e0 10             	shl    $0x10,%eax
+  802f81:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802f86:	29 c2                	sub    %eax,%edx
+  802f88:	eb 85                	jmp    802f0f <_pipeisclosed+0x1b>
+  802f8a:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  802f8c:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  802f92:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  802f97:	77 18                	ja     802fb1 <_pipeisclosed+0xbd>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  802f99:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  802f9e:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  802fa0:	c1 e8 10             	shr    $0x10,%eax
+  802fa3:	74 0c                	je     802fb1 <_pipeisclosed+0xbd>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  802fa5:	c1 e0 10             	shl    $0x10,%eax
+  802fa8:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  802fad:	29 c2                	sub    %eax,%edx
+  802faf:	eb 06                	jmp    802fb7 <_pipeisclosed+0xc3>
+		return pthread_main_tls;
+  802fb1:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802fb7:	8b 02                	mov    (%edx),%eax
+  802fb9:	8b 40 58             	mov    0x58(%eax),%eax
+  802fbc:	6a 01                	push   $0x1
+  802fbe:	50                   	push   %eax
+  802fbf:	53                   	push   %ebx
+  802fc0:	68 4e 4d 80 00       	push   $0x804d4e
+  802fc5:	e8 94 d2 ff ff       	call   80025e <cprintf>
+  802fca:	83 c4 10             	add    $0x10,%esp
+  802fcd:	eb 97                	jmp    802f66 <_pipeisclosed+0x72>
+		ret = pageref(fd) == pageref(p);
+  802fcf:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802fd2:	0f 94 c0             	sete   %al
+  802fd5:	0f b6 c0             	movzbl %al,%eax
+}
+  802fd8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fdb:	5b                   	pop    %ebx
+  802fdc:	5e                   	pop    %esi
+  802fdd:	5f                   	pop    %edi
+  802fde:	5d                   	pop    %ebp
+  802fdf:	c3                   	ret
+
+00802fe0 <devpipe_write>:
+{
+  802fe0:	55                   	push   %ebp
+  802fe1:	89 e5                	mov    %esp,%ebp
+  802fe3:	57                   	push   %edi
+  802fe4:	56                   	push   %esi
+  802fe5:	53                   	push   %ebx
+  802fe6:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802fe9:	ff 75 08             	push   0x8(%ebp)
+  802fec:	e8 41 e1 ff ff       	call   801132 <fd2data>
+  802ff1:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802ff3:	83 c4 10             	add    $0x10,%esp
+  802ff6:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			pipewake(&p->p_rwait, &p->p_wpos);
+  802ffd:	8d 78 04             	lea    0x4(%eax),%edi
+	for (i = 0; i < n; i++) {
+  803000:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803003:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803006:	0f 84 96 00 00 00    	je     8030a2 <devpipe_write+0xc2>
+			pipewake(&p->p_rwait, &p->p_wpos);
+  80300c:	8d 73 08             	lea    0x8(%ebx),%esi
+  80300f:	eb 32                	jmp    803043 <devpipe_write+0x63>
+  803011:	89 fa                	mov    %edi,%edx
+  803013:	89 f0                	mov    %esi,%eax
+  803015:	e8 69 fe ff ff       	call   802e83 <pipewake>
+				  p->p_wpos - sizeof(p->p_buf));
+  80301a:	8b 43 04             	mov    0x4(%ebx),%eax
+  80301d:	83 e8 20             	sub    $0x20,%eax
+	asm volatile("lock; xaddl %0, %1"
+  803020:	ba 01 00 00 00       	mov    $0x1,%edx
+  803025:	f0 0f c1 53 0c       	lock xadd %edx,0xc(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  80302a:	83 ec 04             	sub    $0x4,%esp
+  80302d:	6a 0a                	push   $0xa
+  80302f:	50                   	push   %eax
+  803030:	53                   	push   %ebx
+  803031:	e8 5f df ff ff       	call   800f95 <sys_futex_wait>
+  803036:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80303b:	f0 0f c1 43 0c       	lock xadd %eax,0xc(%ebx)
+}
+  803040:	83 c4 10             	add    $0x10,%esp
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  803043:	8b 43 04             	mov    0x4(%ebx),%eax
+  803046:	8b 0b                	mov    (%ebx),%ecx
+  803048:	8d 51 20             	lea    0x20(%ecx),%edx
+  80304b:	39 d0                	cmp    %edx,%eax
+  80304d:	72 1b                	jb     80306a <devpipe_write+0x8a>
+			if (_pipeisclosed(fd, p))
+  80304f:	89 da                	mov    %ebx,%edx
+  803051:	8b 45 08             	mov    0x8(%ebp),%eax
+  803054:	e8 9b fe ff ff       	call   802ef4 <_pipeisclosed>
+  803059:	85 c0                	test   %eax,%eax
+  80305b:	74 b4                	je     803011 <devpipe_write+0x31>
+				return 0;
+  80305d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803062:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803065:	5b                   	pop    %ebx
+  803066:	5e                   	pop    %esi
+  803067:	5f                   	pop    %edi
+  803068:	5d                   	pop    %ebp
+  803069:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80306a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80306d:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803070:	0f b6 0c 31          	movzbl (%ecx,%esi,1),%ecx
+  803074:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+  803077:	89 c2                	mov    %eax,%edx
+  803079:	c1 fa 1f             	sar    $0x1f,%edx
+  80307c:	89 d1                	mov    %edx,%ecx
+  80307e:	c1 e9 1b             	shr    $0x1b,%ecx
+  803081:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  803084:	83 e2 1f             	and    $0x1f,%edx
+  803087:	29 ca                	sub    %ecx,%edx
+  803089:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+  80308d:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+		p->p_wpos++;
+  803091:	83 c0 01             	add    $0x1,%eax
+  803094:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  803097:	83 c6 01             	add    $0x1,%esi
+  80309a:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  80309d:	e9 5e ff ff ff       	jmp    803000 <devpipe_write+0x20>
+	pipewake(&p->p_rwait, &p->p_wpos);
+  8030a2:	8d 53 04             	lea    0x4(%ebx),%edx
+  8030a5:	8d 43 08             	lea    0x8(%ebx),%eax
+  8030a8:	e8 d6 fd ff ff       	call   802e83 <pipewake>
+	return i;
+  8030ad:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8030b0:	eb b0                	jmp    803062 <devpipe_write+0x82>
+
+008030b2 <devpipe_read>:
+{
+  8030b2:	55                   	push   %ebp
+  8030b3:	89 e5                	mov    %esp,%ebp
+  8030b5:	57                   	push   %edi
+  8030b6:	56                   	push   %esi
+  8030b7:	53                   	push   %ebx
+  8030b8:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  8030bb:	ff 75 08             	push   0x8(%ebp)
+  8030be:	e8 6f e0 ff ff       	call   801132 <fd2data>
+  8030c3:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8030c5:	83 c4 10             	add    $0x10,%esp
+  8030c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8030cd:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8030d0:	74 6c                	je     80313e <devpipe_read+0x8c>
+			pipesleep(&p->p_rwait, &p->p_wpos, p->p_rpos);
+  8030d2:	8d 7b 04             	lea    0x4(%ebx),%edi
+  8030d5:	eb 25                	jmp    8030fc <devpipe_read+0x4a>
+  8030d7:	8b 13                	mov    (%ebx),%edx
+  8030d9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8030de:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+	sys_futex_wait((volatile uint32_t *) pos, val, PIPEWAIT);
+  8030e3:	83 ec 04             	sub    $0x4,%esp
+  8030e6:	6a 0a                	push   $0xa
+  8030e8:	52                   	push   %edx
+  8030e9:	57                   	push   %edi
+  8030ea:	e8 a6 de ff ff       	call   800f95 <sys_futex_wait>
+  8030ef:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8030f4:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+  8030f9:	83 c4 10             	add    $0x10,%esp
+		while (p->p_rpos == p->p_wpos) {
+  8030fc:	8b 03                	mov    (%ebx),%eax
+  8030fe:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803101:	75 19                	jne    80311c <devpipe_read+0x6a>
+			if (i > 0)
+  803103:	85 f6                	test   %esi,%esi
+  803105:	75 3a                	jne    803141 <devpipe_read+0x8f>
+			if (_pipeisclosed(fd, p))
+  803107:	89 da                	mov    %ebx,%edx
+  803109:	8b 45 08             	mov    0x8(%ebp),%eax
+  80310c:	e8 e3 fd ff ff       	call   802ef4 <_pipeisclosed>
+  803111:	85 c0                	test   %eax,%eax
+  803113:	74 c2                	je     8030d7 <devpipe_read+0x25>
+				return 0;
+  803115:	b8 00 00 00 00       	mov    $0x0,%eax
+  80311a:	eb 31                	jmp    80314d <devpipe_read+0x9b>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80311c:	89 c1                	mov    %eax,%ecx
+  80311e:	c1 f9 1f             	sar    $0x1f,%ecx
+  803121:	c1 e9 1b             	shr    $0x1b,%ecx
+  803124:	01 c8                	add    %ecx,%eax
+  803126:	83 e0 1f             	and    $0x1f,%eax
+  803129:	29 c8                	sub    %ecx,%eax
+  80312b:	0f b6 44 03 10       	movzbl 0x10(%ebx,%eax,1),%eax
+  803130:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803133:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  803136:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  803139:	83 c6 01             	add    $0x1,%esi
+  80313c:	eb 8f                	jmp    8030cd <devpipe_read+0x1b>
+out:
+  80313e:	8b 75 10             	mov    0x10(%ebp),%esi
+	pipewake(&p->p_wwait, &p->p_rpos);
+  803141:	8d 43 0c             	lea    0xc(%ebx),%eax
+  803144:	89 da                	mov    %ebx,%edx
+  803146:	e8 38 fd ff ff       	call   802e83 <pipewake>
+	return i;
+  80314b:	89 f0                	mov    %esi,%eax
+}
+  80314d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803150:	5b                   	pop    %ebx
+  803151:	5e                   	pop    %esi
+  803152:	5f                   	pop    %edi
+  803153:	5d                   	pop    %ebp
+  803154:	c3                   	ret
+
+00803155 <pipe>:
+{
+  803155:	55                   	push   %ebp
+  803156:	89 e5                	mov    %esp,%ebp
+  803158:	56                   	push   %esi
+  803159:	53                   	push   %ebx
+  80315a:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80315d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803160:	50                   	push   %eax
+  803161:	e8 e3 df ff ff       	call   801149 <fd_alloc>
+  803166:	89 c3                	mov    %eax,%ebx
+  803168:	83 c4 10             	add    $0x10,%esp
+  80316b:	85 c0                	test   %eax,%eax
+  80316d:	0f 88 23 01 00 00    	js     803296 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803173:	83 ec 04             	sub    $0x4,%esp
+  803176:	68 07 04 00 00       	push   $0x407
+  80317b:	ff 75 f4             	push   -0xc(%ebp)
+  80317e:	6a 00                	push   $0x0
+  803180:	e8 fb da ff ff       	call   800c80 <sys_page_alloc>
+  803185:	89 c3                	mov    %eax,%ebx
+  803187:	83 c4 10             	add    $0x10,%esp
+  80318a:	85 c0                	test   %eax,%eax
+  80318c:	0f 88 04 01 00 00    	js     803296 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803192:	83 ec 0c             	sub    $0xc,%esp
+  803195:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803198:	50                   	push   %eax
+  803199:	e8 ab df ff ff       	call   801149 <fd_alloc>
+  80319e:	89 c3                	mov    %eax,%ebx
+  8031a0:	83 c4 10             	add    $0x10,%esp
+  8031a3:	85 c0                	test   %eax,%eax
+  8031a5:	0f 88 db 00 00 00    	js     803286 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8031ab:	83 ec 04             	sub    $0x4,%esp
+  8031ae:	68 07 04 00 00       	push   $0x407
+  8031b3:	ff 75 f0             	push   -0x10(%ebp)
+  8031b6:	6a 00                	push   $0x0
+  8031b8:	e8 c3 da ff ff       	call   800c80 <sys_page_alloc>
+  8031bd:	89 c3                	mov    %eax,%ebx
+  8031bf:	83 c4 10             	add    $0x10,%esp
+  8031c2:	85 c0                	test   %eax,%eax
+  8031c4:	0f 88 bc 00 00 00    	js     803286 <pipe+0x131>
+	va = fd2data(fd0);
+  8031ca:	83 ec 0c             	sub    $0xc,%esp
+  8031cd:	ff 75 f4             	push   -0xc(%ebp)
+  8031d0:	e8 5d df ff ff       	call   801132 <fd2data>
+  8031d5:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8031d7:	83 c4 0c             	add    $0xc,%esp
+  8031da:	68 07 04 00 00       	push   $0x407
+  8031df:	50                   	push   %eax
+  8031e0:	6a 00                	push   $0x0
+  8031e2:	e8 99 da ff ff       	call   800c80 <sys_page_alloc>
+  8031e7:	89 c3                	mov    %eax,%ebx
+  8031e9:	83 c4 10             	add    $0x10,%esp
+  8031ec:	85 c0                	test   %eax,%eax
+  8031ee:	0f 88 82 00 00 00    	js     803276 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8031f4:	83 ec 0c             	sub    $0xc,%esp
+  8031f7:	ff 75 f0             	push   -0x10(%ebp)
+  8031fa:	e8 33 df ff ff       	call   801132 <fd2data>
+  8031ff:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803206:	50                   	push   %eax
+  803207:	6a 00                	push   $0x0
+  803209:	56                   	push   %esi
+  80320a:	6a 00                	push   $0x0
+  80320c:	e8 bc da ff ff       	call   800ccd <sys_page_map>
+  803211:	89 c3                	mov    %eax,%ebx
+  803213:	83 c4 20             	add    $0x20,%esp
+  803216:	85 c0                	test   %eax,%eax
+  803218:	78 4e                	js     803268 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80321a:	a1 7c 52 80 00       	mov    0x80527c,%eax
+  80321f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803222:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803224:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803227:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80322e:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803231:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803233:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803236:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80323d:	83 ec 0c             	sub    $0xc,%esp
+  803240:	ff 75 f4             	push   -0xc(%ebp)
+  803243:	e8 da de ff ff       	call   801122 <fd2num>
+  803248:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80324b:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80324d:	83 c4 04             	add    $0x4,%esp
+  803250:	ff 75 f0             	push   -0x10(%ebp)
+  803253:	e8 ca de ff ff       	call   801122 <fd2num>
+  803258:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80325b:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80325e:	83 c4 10             	add    $0x10,%esp
+  803261:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803266:	eb 2e                	jmp    803296 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803268:	83 ec 08             	sub    $0x8,%esp
+  80326b:	56                   	push   %esi
+  80326c:	6a 00                	push   $0x0
+  80326e:	e8 a6 da ff ff       	call   800d19 <sys_page_unmap>
+  803273:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803276:	83 ec 08             	sub    $0x8,%esp
+  803279:	ff 75 f0             	push   -0x10(%ebp)
+  80327c:	6a 00                	push   $0x0
+  80327e:	e8 96 da ff ff       	call   800d19 <sys_page_unmap>
+  803283:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803286:	83 ec 08             	sub    $0x8,%esp
+  803289:	ff 75 f4             	push   -0xc(%ebp)
+  80328c:	6a 00                	push   $0x0
+  80328e:	e8 86 da ff ff       	call   800d19 <sys_page_unmap>
+  803293:	83 c4 10             	add    $0x10,%esp
+}
+  803296:	89 d8                	mov    %ebx,%eax
+  803298:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80329b:	5b                   	pop    %ebx
+  80329c:	5e                   	pop    %esi
+  80329d:	5d                   	pop    %ebp
+  80329e:	c3                   	ret
+
+0080329f <pipeisclosed>:
+{
+  80329f:	55                   	push   %ebp
+  8032a0:	89 e5                	mov    %esp,%ebp
+  8032a2:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8032a5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8032a8:	50                   	push   %eax
+  8032a9:	ff 75 08             	push   0x8(%ebp)
+  8032ac:	e8 ee de ff ff       	call   80119f <fd_lookup>
+  8032b1:	83 c4 10             	add    $0x10,%esp
+  8032b4:	85 c0                	test   %eax,%eax
+  8032b6:	78 18                	js     8032d0 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8032b8:	83 ec 0c             	sub    $0xc,%esp
+  8032bb:	ff 75 f4             	push   -0xc(%ebp)
+  8032be:	e8 6f de ff ff       	call   801132 <fd2data>
+  8032c3:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8032c5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8032c8:	e8 27 fc ff ff       	call   802ef4 <_pipeisclosed>
+  8032cd:	83 c4 10             	add    $0x10,%esp
+}
+  8032d0:	c9                   	leave
+  8032d1:	c3                   	ret
+
+008032d2 <mutex_init>:
+// Mutex
+// --------------------------------------------------------------
+
+void
+mutex_init(struct mutex *m)
+{
+  8032d2:	55                   	push   %ebp
+  8032d3:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  8032d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032d8:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8032de:	5d                   	pop    %ebp
+  8032df:	c3                   	ret
+
+008032e0 <mutex_lock>:
+// Acquire m, sleeping while somebody else holds it.
+// Once we have had to wait we always take the lock in state 2, since
+// other envs may have queued up behind us.
+void
+mutex_lock(struct mutex *m)
+{
+  8032e0:	55                   	push   %ebp
+  8032e1:	89 e5                	mov    %esp,%ebp
+  8032e3:	56                   	push   %esi
+  8032e4:	53                   	push   %ebx
+  8032e5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  8032e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032ed:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8032f2:	89 d0                	mov    %edx,%eax
+  8032f4:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  8032f8:	85 c0                	test   %eax,%eax
+  8032fa:	74 2d                	je     803329 <mutex_lock+0x49>
+		return;
+	if (c != 2)
+  8032fc:	83 f8 02             	cmp    $0x2,%eax
+  8032ff:	74 08                	je     803309 <mutex_lock+0x29>
+	asm volatile("lock; xchgl %0, %1"
+  803301:	b8 02 00 00 00       	mov    $0x2,%eax
+  803306:	f0 87 03             	lock xchg %eax,(%ebx)
+  803309:	be 02 00 00 00       	mov    $0x2,%esi
+  80330e:	eb 15                	jmp    803325 <mutex_lock+0x45>
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+		sys_futex_wait(&m->m_state, 2, 0);
+  803310:	83 ec 04             	sub    $0x4,%esp
+  803313:	6a 00                	push   $0x0
+  803315:	6a 02                	push   $0x2
+  803317:	53                   	push   %ebx
+  803318:	e8 78 dc ff ff       	call   800f95 <sys_futex_wait>
+  80331d:	89 f0                	mov    %esi,%eax
+  80331f:	f0 87 03             	lock xchg %eax,(%ebx)
+  803322:	83 c4 10             	add    $0x10,%esp
+	while (c != 0) {
+  803325:	85 c0                	test   %eax,%eax
+  803327:	75 e7                	jne    803310 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  803329:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80332c:	5b                   	pop    %ebx
+  80332d:	5e                   	pop    %esi
+  80332e:	5d                   	pop    %ebp
+  80332f:	c3                   	ret
+
+00803330 <mutex_trylock>:
+
+// Acquire m if it is free.
+// Returns 0 on success, -E_AGAIN if the mutex is held.
+int
+mutex_trylock(struct mutex *m)
+{
+  803330:	55                   	push   %ebp
+  803331:	89 e5                	mov    %esp,%ebp
+  803333:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1"
+  803336:	b8 00 00 00 00       	mov    $0x0,%eax
+  80333b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803340:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_AGAIN;
+  803344:	f7 d8                	neg    %eax
+  803346:	19 c0                	sbb    %eax,%eax
+  803348:	83 e0 ed             	and    $0xffffffed,%eax
+}
+  80334b:	5d                   	pop    %ebp
+  80334c:	c3                   	ret
+
+0080334d <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  80334d:	55                   	push   %ebp
+  80334e:	89 e5                	mov    %esp,%ebp
+  803350:	83 ec 08             	sub    $0x8,%esp
+  803353:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1"
+  803356:	b8 00 00 00 00       	mov    $0x0,%eax
+  80335b:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  80335e:	83 f8 02             	cmp    $0x2,%eax
+  803361:	74 02                	je     803365 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  803363:	c9                   	leave
+  803364:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  803365:	83 ec 08             	sub    $0x8,%esp
+  803368:	6a 01                	push   $0x1
+  80336a:	52                   	push   %edx
+  80336b:	e8 54 dc ff ff       	call   800fc4 <sys_futex_wake>
+  803370:	83 c4 10             	add    $0x10,%esp
+}
+  803373:	eb ee                	jmp    803363 <mutex_unlock+0x16>
+
+00803375 <cond_init>:
+// Condition variable
+// --------------------------------------------------------------
+
+void
+cond_init(struct cond *c)
+{
+  803375:	55                   	push   %ebp
+  803376:	89 e5                	mov    %esp,%ebp
+	c->c_seq = 0;
+  803378:	8b 45 08             	mov    0x8(%ebp),%eax
+  80337b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803381:	5d                   	pop    %ebp
+  803382:	c3                   	ret
+
+00803383 <cond_timedwait>:
+// Like any condition variable, wakeups may be spurious, so callers must
+// recheck their predicate.
+// Returns 0 on wakeup, -E_TIMEOUT on timeout.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  803383:	55                   	push   %ebp
+  803384:	89 e5                	mov    %esp,%ebp
+  803386:	57                   	push   %edi
+  803387:	56                   	push   %esi
+  803388:	53                   	push   %ebx
+  803389:	83 ec 18             	sub    $0x18,%esp
+  80338c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80338f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint32_t seq;
+	int r;
+
+	seq = c->c_seq;
+  803392:	8b 3e                	mov    (%esi),%edi
+	mutex_unlock(m);
+  803394:	53                   	push   %ebx
+  803395:	e8 b3 ff ff ff       	call   80334d <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  80339a:	83 c4 0c             	add    $0xc,%esp
+  80339d:	ff 75 10             	push   0x10(%ebp)
+  8033a0:	57                   	push   %edi
+  8033a1:	56                   	push   %esi
+  8033a2:	e8 ee db ff ff       	call   800f95 <sys_futex_wait>
+  8033a7:	89 c7                	mov    %eax,%edi
+	// Another waiter may be woken while we hold m, so lock as contended.
+	while (xchg(&m->m_state, 2) != 0)
+  8033a9:	83 c4 10             	add    $0x10,%esp
+  8033ac:	be 02 00 00 00       	mov    $0x2,%esi
+  8033b1:	eb 10                	jmp    8033c3 <cond_timedwait+0x40>
+		sys_futex_wait(&m->m_state, 2, 0);
+  8033b3:	83 ec 04             	sub    $0x4,%esp
+  8033b6:	6a 00                	push   $0x0
+  8033b8:	6a 02                	push   $0x2
+  8033ba:	53                   	push   %ebx
+  8033bb:	e8 d5 db ff ff       	call   800f95 <sys_futex_wait>
+  8033c0:	83 c4 10             	add    $0x10,%esp
+  8033c3:	89 f0                	mov    %esi,%eax
+  8033c5:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&m->m_state, 2) != 0)
+  8033c8:	85 c0                	test   %eax,%eax
+  8033ca:	75 e7                	jne    8033b3 <cond_timedwait+0x30>
+	return r == -E_TIMEOUT ? r : 0;
+  8033cc:	83 ff ec             	cmp    $0xffffffec,%edi
+  8033cf:	74 05                	je     8033d6 <cond_timedwait+0x53>
+  8033d1:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  8033d6:	89 f8                	mov    %edi,%eax
+  8033d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033db:	5b                   	pop    %ebx
+  8033dc:	5e                   	pop    %esi
+  8033dd:	5f                   	pop    %edi
+  8033de:	5d                   	pop    %ebp
+  8033df:	c3                   	ret
+
+008033e0 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  8033e0:	55                   	push   %ebp
+  8033e1:	89 e5                	mov    %esp,%ebp
+  8033e3:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, 0);
+  8033e6:	6a 00                	push   $0x0
+  8033e8:	ff 75 0c             	push   0xc(%ebp)
+  8033eb:	ff 75 08             	push   0x8(%ebp)
+  8033ee:	e8 90 ff ff ff       	call   803383 <cond_timedwait>
+}
+  8033f3:	83 c4 10             	add    $0x10,%esp
+  8033f6:	c9                   	leave
+  8033f7:	c3                   	ret
+
+008033f8 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  8033f8:	55                   	push   %ebp
+  8033f9:	89 e5                	mov    %esp,%ebp
+  8033fb:	83 ec 10             	sub    $0x10,%esp
+  8033fe:	8b 45 08             	mov    0x8(%ebp),%eax
+	asm volatile("lock; xaddl %0, %1"
+  803401:	ba 01 00 00 00       	mov    $0x1,%edx
+  803406:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, 1);
+  80340a:	6a 01                	push   $0x1
+  80340c:	50                   	push   %eax
+  80340d:	e8 b2 db ff ff       	call   800fc4 <sys_futex_wake>
+}
+  803412:	83 c4 10             	add    $0x10,%esp
+  803415:	c9                   	leave
+  803416:	c3                   	ret
+
+00803417 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  803417:	55                   	push   %ebp
+  803418:	89 e5                	mov    %esp,%ebp
+  80341a:	83 ec 10             	sub    $0x10,%esp
+  80341d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803420:	ba 01 00 00 00       	mov    $0x1,%edx
+  803425:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&c->c_seq, 1);
+	sys_futex_wake(&c->c_seq, NENV);
+  803429:	68 00 04 00 00       	push   $0x400
+  80342e:	50                   	push   %eax
+  80342f:	e8 90 db ff ff       	call   800fc4 <sys_futex_wake>
+}
+  803434:	83 c4 10             	add    $0x10,%esp
+  803437:	c9                   	leave
+  803438:	c3                   	ret
+
+00803439 <sem_init>:
+// Counting semaphore
+// --------------------------------------------------------------
+
+void
+sem_init(struct semaphore *s, uint32_t count)
+{
+  803439:	55                   	push   %ebp
+  80343a:	89 e5                	mov    %esp,%ebp
+  80343c:	8b 45 08             	mov    0x8(%ebp),%eax
+	s->s_count = count;
+  80343f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803442:	89 10                	mov    %edx,(%eax)
+	s->s_waiters = 0;
+  803444:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  80344b:	5d                   	pop    %ebp
+  80344c:	c3                   	ret
+
+0080344d <sem_trywait>:
+
+// Take one unit if one is available.
+// Returns 0 on success, -E_AGAIN if the count is zero.
+int
+sem_trywait(struct semaphore *s)
+{
+  80344d:	55                   	push   %ebp
+  80344e:	89 e5                	mov    %esp,%ebp
+  803450:	53                   	push   %ebx
+  803451:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	uint32_t c;
+
+	while ((c = s->s_count) > 0)
+  803454:	8b 11                	mov    (%ecx),%edx
+  803456:	85 d2                	test   %edx,%edx
+  803458:	74 14                	je     80346e <sem_trywait+0x21>
+		if (cmpxchg(&s->s_count, c, c - 1) == c)
+  80345a:	8d 5a ff             	lea    -0x1(%edx),%ebx
+	asm volatile("lock; cmpxchgl %2, %1"
+  80345d:	89 d0                	mov    %edx,%eax
+  80345f:	f0 0f b1 19          	lock cmpxchg %ebx,(%ecx)
+  803463:	39 c2                	cmp    %eax,%edx
+  803465:	75 ed                	jne    803454 <sem_trywait+0x7>
+			return 0;
+  803467:	b8 00 00 00 00       	mov    $0x0,%eax
+  80346c:	eb 05                	jmp    803473 <sem_trywait+0x26>
+	return -E_AGAIN;
+  80346e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+}
+  803473:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803476:	c9                   	leave
+  803477:	c3                   	ret
+
+00803478 <sem_timedwait>:
+// Take one unit, sleeping up to msec milliseconds (0 means forever)
+// for one to become available.
+// Returns 0 on success, -E_TIMEOUT on timeout.
+int
+sem_timedwait(struct semaphore *s, uint32_t msec)
+{
+  803478:	55                   	push   %ebp
+  803479:	89 e5                	mov    %esp,%ebp
+  80347b:	57                   	push   %edi
+  80347c:	56                   	push   %esi
+  80347d:	53                   	push   %ebx
+  80347e:	83 ec 1c             	sub    $0x1c,%esp
+  803481:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803484:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t end = sys_time_msec() + msec;
+  803487:	e8 81 da ff ff       	call   800f0d <sys_time_msec>
+  80348c:	01 f8                	add    %edi,%eax
+  80348e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t left = 0;
+  803491:	be 00 00 00 00       	mov    $0x0,%esi
+	int r;
+
+	while (sem_trywait(s) < 0) {
+  803496:	eb 28                	jmp    8034c0 <sem_timedwait+0x48>
+	asm volatile("lock; xaddl %0, %1"
+  803498:	b8 01 00 00 00       	mov    $0x1,%eax
+  80349d:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+		// Register before sleeping, so a sem_post that increments
+		// the count after our sem_trywait sees us and wakes us.
+		// If it ran before we registered, the count is no longer
+		// zero and sys_futex_wait fails with -E_AGAIN at once.
+		atomic_add(&s->s_waiters, 1);
+		r = sys_futex_wait(&s->s_count, 0, left);
+  8034a2:	83 ec 04             	sub    $0x4,%esp
+  8034a5:	56                   	push   %esi
+  8034a6:	6a 00                	push   $0x0
+  8034a8:	53                   	push   %ebx
+  8034a9:	e8 e7 da ff ff       	call   800f95 <sys_futex_wait>
+  8034ae:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8034b3:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+		atomic_add(&s->s_waiters, -1);
+		if (r == -E_TIMEOUT)
+  8034b8:	83 c4 10             	add    $0x10,%esp
+  8034bb:	83 f8 ec             	cmp    $0xffffffec,%eax
+  8034be:	74 2e                	je     8034ee <sem_timedwait+0x76>
+	while (sem_trywait(s) < 0) {
+  8034c0:	83 ec 0c             	sub    $0xc,%esp
+  8034c3:	53                   	push   %ebx
+  8034c4:	e8 84 ff ff ff       	call   80344d <sem_trywait>
+  8034c9:	83 c4 10             	add    $0x10,%esp
+  8034cc:	85 c0                	test   %eax,%eax
+  8034ce:	79 19                	jns    8034e9 <sem_timedwait+0x71>
+		if (msec && (int32_t) (left = end - sys_time_msec()) <= 0)
+  8034d0:	85 ff                	test   %edi,%edi
+  8034d2:	74 c4                	je     803498 <sem_timedwait+0x20>
+  8034d4:	e8 34 da ff ff       	call   800f0d <sys_time_msec>
+  8034d9:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8034dc:	29 c6                	sub    %eax,%esi
+  8034de:	85 f6                	test   %esi,%esi
+  8034e0:	7f b6                	jg     803498 <sem_timedwait+0x20>
+			return -E_TIMEOUT;
+  8034e2:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  8034e7:	eb 05                	jmp    8034ee <sem_timedwait+0x76>
+			return r;
+	}
+	return 0;
+  8034e9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8034ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034f1:	5b                   	pop    %ebx
+  8034f2:	5e                   	pop    %esi
+  8034f3:	5f                   	pop    %edi
+  8034f4:	5d                   	pop    %ebp
+  8034f5:	c3                   	ret
+
+008034f6 <sem_wait>:
+
+void
+sem_wait(struct semaphore *s)
+{
+  8034f6:	55                   	push   %ebp
+  8034f7:	89 e5                	mov    %esp,%ebp
+  8034f9:	83 ec 10             	sub    $0x10,%esp
+	sem_timedwait(s, 0);
+  8034fc:	6a 00                	push   $0x0
+  8034fe:	ff 75 08             	push   0x8(%ebp)
+  803501:	e8 72 ff ff ff       	call   803478 <sem_timedwait>
+}
+  803506:	83 c4 10             	add    $0x10,%esp
+  803509:	c9                   	leave
+  80350a:	c3                   	ret
+
+0080350b <sem_post>:
+
+void
+sem_post(struct semaphore *s)
+{
+  80350b:	55                   	push   %ebp
+  80350c:	89 e5                	mov    %esp,%ebp
+  80350e:	83 ec 08             	sub    $0x8,%esp
+  803511:	8b 45 08             	mov    0x8(%ebp),%eax
+  803514:	ba 01 00 00 00       	mov    $0x1,%edx
+  803519:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	atomic_add(&s->s_count, 1);
+	if (s->s_waiters)
+  80351d:	8b 50 04             	mov    0x4(%eax),%edx
+  803520:	85 d2                	test   %edx,%edx
+  803522:	75 02                	jne    803526 <sem_post+0x1b>
+		sys_futex_wake(&s->s_count, 1);
+}
+  803524:	c9                   	leave
+  803525:	c3                   	ret
+		sys_futex_wake(&s->s_count, 1);
+  803526:	83 ec 08             	sub    $0x8,%esp
+  803529:	6a 01                	push   $0x1
+  80352b:	50                   	push   %eax
+  80352c:	e8 93 da ff ff       	call   800fc4 <sys_futex_wake>
+  803531:	83 c4 10             	add    $0x10,%esp
+}
+  803534:	eb ee                	jmp    803524 <sem_post+0x19>
+
+00803536 <pthread_create>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if all PTHREAD_MAX slots or all envs are in use.
+//	-E_NO_MEM on memory exhaustion.
+int
+pthread_create(pthread_t *tp, void *(*fn)(void *), void *arg)
+{
+  803536:	55                   	push   %ebp
+  803537:	89 e5                	mov    %esp,%ebp
+  803539:	57                   	push   %edi
+  80353a:	56                   	push   %esi
+  80353b:	53                   	push   %ebx
+  80353c:	83 ec 28             	sub    $0x28,%esp
+	uint32_t *esp;
+	pthread_t t;
+	envid_t id;
+	int r;
+
+	mutex_lock(&threads_mu);
+  80353f:	68 20 60 80 00       	push   $0x806020
+  803544:	e8 97 fd ff ff       	call   8032e0 <mutex_lock>
+	if (threads[0].th_state == PTH_FREE) {
+  803549:	a1 44 60 80 00       	mov    0x806044,%eax
+  80354e:	83 c4 10             	add    $0x10,%esp
+  803551:	85 c0                	test   %eax,%eax
+  803553:	75 19                	jne    80356e <pthread_create+0x38>
+		threads[0].th_env = pthread_tls(0)->tls_env->env_id;
+  803555:	a1 c0 62 80 00       	mov    0x8062c0,%eax
+  80355a:	8b 00                	mov    (%eax),%eax
+  80355c:	8b 40 48             	mov    0x48(%eax),%eax
+  80355f:	a3 40 60 80 00       	mov    %eax,0x806040
+		threads[0].th_state = PTH_RUNNING;
+  803564:	c7 05 44 60 80 00 01 	movl   $0x1,0x806044
+  80356b:	00 00 00 
+	}
+	for (t = 1; t < PTHREAD_MAX; t++)
+  80356e:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if (threads[t].th_state == PTH_FREE)
+  803573:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803576:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  80357d:	8b 40 04             	mov    0x4(%eax),%eax
+  803580:	85 c0                	test   %eax,%eax
+  803582:	0f 84 e4 00 00 00    	je     80366c <pthread_create+0x136>
+	for (t = 1; t < PTHREAD_MAX; t++)
+  803588:	83 c3 01             	add    $0x1,%ebx
+  80358b:	83 fb 20             	cmp    $0x20,%ebx
+  80358e:	75 e3                	jne    803573 <pthread_create+0x3d>
+			break;
+	if (t == PTHREAD_MAX) {
+		mutex_unlock(&threads_mu);
+  803590:	83 ec 0c             	sub    $0xc,%esp
+  803593:	68 20 60 80 00       	push   $0x806020
+  803598:	e8 b0 fd ff ff       	call   80334d <mutex_unlock>
+		return -E_NO_FREE_ENV;
+  80359d:	83 c4 10             	add    $0x10,%esp
+  8035a0:	bf fb ff ff ff       	mov    $0xfffffffb,%edi
+  8035a5:	e9 b8 00 00 00       	jmp    803662 <pthread_create+0x12c>
+  8035aa:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  8035ad:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  8035b0:	89 c7                	mov    %eax,%edi
+	while (va > top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE) {
+  8035b2:	39 f3                	cmp    %esi,%ebx
+  8035b4:	73 16                	jae    8035cc <pthread_create+0x96>
+		va -= PGSIZE;
+  8035b6:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+		sys_page_unmap(0, (void *) va);
+  8035bc:	83 ec 08             	sub    $0x8,%esp
+  8035bf:	56                   	push   %esi
+  8035c0:	6a 00                	push   $0x0
+  8035c2:	e8 52 d7 ff ff       	call   800d19 <sys_page_unmap>
+  8035c7:	83 c4 10             	add    $0x10,%esp
+  8035ca:	eb e6                	jmp    8035b2 <pthread_create+0x7c>
+	sys_page_unmap(0, (void *) (top - PGSIZE));
+  8035cc:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8035cf:	83 ec 08             	sub    $0x8,%esp
+  8035d2:	ff 75 e4             	push   -0x1c(%ebp)
+  8035d5:	6a 00                	push   $0x0
+  8035d7:	e8 3d d7 ff ff       	call   800d19 <sys_page_unmap>
+	return r;
+  8035dc:	83 c4 10             	add    $0x10,%esp
+	th->th_env = id;
+	*tp = t;
+	return 0;
+
+err:
+	th->th_state = PTH_FREE;
+  8035df:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8035e2:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  8035e9:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return r;
+  8035f0:	eb 70                	jmp    803662 <pthread_create+0x12c>
+	th->th_fn = fn;
+  8035f2:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8035f5:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  8035fc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8035ff:	89 50 08             	mov    %edx,0x8(%eax)
+	th->th_arg = arg;
+  803602:	8b 55 10             	mov    0x10(%ebp),%edx
+  803605:	89 50 0c             	mov    %edx,0xc(%eax)
+	th->th_ret = NULL;
+  803608:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  80360f:	b8 fc bf bf ee       	mov    $0xeebfbffc,%eax
+  803614:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803617:	29 c8                	sub    %ecx,%eax
+  803619:	85 db                	test   %ebx,%ebx
+  80361b:	0f 44 05 c0 62 80 00 	cmove  0x8062c0,%eax
+	*--esp = t;
+  803622:	89 58 fc             	mov    %ebx,-0x4(%eax)
+	*--esp = 0;
+  803625:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  80362c:	83 ec 04             	sub    $0x4,%esp
+  80362f:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803634:	29 ca                	sub    %ecx,%edx
+  803636:	52                   	push   %edx
+	*--esp = 0;
+  803637:	83 e8 08             	sub    $0x8,%eax
+	if ((id = sys_thread_create((void (*)(void)) pthread_start,
+  80363a:	50                   	push   %eax
+  80363b:	68 93 38 80 00       	push   $0x803893
+  803640:	e8 24 da ff ff       	call   801069 <sys_thread_create>
+  803645:	89 c7                	mov    %eax,%edi
+  803647:	83 c4 10             	add    $0x10,%esp
+  80364a:	85 c0                	test   %eax,%eax
+  80364c:	78 91                	js     8035df <pthread_create+0xa9>
+	th->th_env = id;
+  80364e:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803651:	89 3c 85 40 60 80 00 	mov    %edi,0x806040(,%eax,4)
+	*tp = t;
+  803658:	8b 45 08             	mov    0x8(%ebp),%eax
+  80365b:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  80365d:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803662:	89 f8                	mov    %edi,%eax
+  803664:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803667:	5b                   	pop    %ebx
+  803668:	5e                   	pop    %esi
+  803669:	5f                   	pop    %edi
+  80366a:	5d                   	pop    %ebp
+  80366b:	c3                   	ret
+	th->th_state = PTH_RUNNING;
+  80366c:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80366f:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  803676:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	mutex_unlock(&threads_mu);
+  80367d:	83 ec 0c             	sub    $0xc,%esp
+  803680:	68 20 60 80 00       	push   $0x806020
+  803685:	e8 c3 fc ff ff       	call   80334d <mutex_unlock>
+	uintptr_t top = PTHREAD_TOP(t), va;
+  80368a:	89 d9                	mov    %ebx,%ecx
+  80368c:	c1 e1 10             	shl    $0x10,%ecx
+  80368f:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	va = top - PGSIZE;
+  803692:	b8 00 d0 bf ee       	mov    $0xeebfd000,%eax
+  803697:	29 c8                	sub    %ecx,%eax
+  803699:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
+  80369c:	c1 e8 16             	shr    $0x16,%eax
+  80369f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8036a6:	83 c4 10             	add    $0x10,%esp
+  8036a9:	a8 01                	test   $0x1,%al
+  8036ab:	74 15                	je     8036c2 <pthread_create+0x18c>
+  8036ad:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8036b0:	c1 e8 0c             	shr    $0xc,%eax
+  8036b3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8036ba:	a8 01                	test   $0x1,%al
+  8036bc:	0f 85 30 ff ff ff    	jne    8035f2 <pthread_create+0xbc>
+	if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  8036c2:	83 ec 04             	sub    $0x4,%esp
+  8036c5:	6a 07                	push   $0x7
+  8036c7:	ff 75 e4             	push   -0x1c(%ebp)
+  8036ca:	6a 00                	push   $0x0
+  8036cc:	e8 af d5 ff ff       	call   800c80 <sys_page_alloc>
+  8036d1:	89 c7                	mov    %eax,%edi
+  8036d3:	83 c4 10             	add    $0x10,%esp
+  8036d6:	85 c0                	test   %eax,%eax
+  8036d8:	0f 88 01 ff ff ff    	js     8035df <pthread_create+0xa9>
+	for (va = top - 2 * PGSIZE - PTHREAD_STKPAGES * PGSIZE;
+  8036de:	b8 00 40 bf ee       	mov    $0xeebf4000,%eax
+  8036e3:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8036e6:	29 d0                	sub    %edx,%eax
+  8036e8:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8036eb:	89 c6                	mov    %eax,%esi
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  8036ed:	b8 00 c0 bf ee       	mov    $0xeebfc000,%eax
+  8036f2:	29 d0                	sub    %edx,%eax
+  8036f4:	89 c7                	mov    %eax,%edi
+  8036f6:	39 fe                	cmp    %edi,%esi
+  8036f8:	0f 83 f4 fe ff ff    	jae    8035f2 <pthread_create+0xbc>
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  8036fe:	83 ec 04             	sub    $0x4,%esp
+  803701:	6a 07                	push   $0x7
+  803703:	56                   	push   %esi
+  803704:	6a 00                	push   $0x0
+  803706:	e8 75 d5 ff ff       	call   800c80 <sys_page_alloc>
+  80370b:	83 c4 10             	add    $0x10,%esp
+  80370e:	85 c0                	test   %eax,%eax
+  803710:	0f 88 94 fe ff ff    	js     8035aa <pthread_create+0x74>
+	     va < top - 2 * PGSIZE; va += PGSIZE)
+  803716:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80371c:	eb d8                	jmp    8036f6 <pthread_create+0x1c0>
+
+0080371e <pthread_join>:
+// *ret_store if ret_store is not null.
+//
+// Returns 0 on success, -E_INVAL if t is not a joinable thread.
+int
+pthread_join(pthread_t t, void **ret_store)
+{
+  80371e:	55                   	push   %ebp
+  80371f:	89 e5                	mov    %esp,%ebp
+  803721:	57                   	push   %edi
+  803722:	56                   	push   %esi
+  803723:	53                   	push   %ebx
+  803724:	83 ec 0c             	sub    $0xc,%esp
+  803727:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct pthread *th = &threads[t];
+	uint32_t state;
+
+	if (t <= 0 || t >= PTHREAD_MAX || t == pthread_self())
+  80372a:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  80372d:	83 f8 1e             	cmp    $0x1e,%eax
+  803730:	0f 87 c7 00 00 00    	ja     8037fd <pthread_join+0xdf>
+	asm volatile("movl %%esp,%0" : "=r" (esp));
+  803736:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803738:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  80373e:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803743:	77 12                	ja     803757 <pthread_join+0x39>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803745:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80374a:	29 d0                	sub    %edx,%eax
+  80374c:	c1 e8 10             	shr    $0x10,%eax
+  80374f:	39 c3                	cmp    %eax,%ebx
+  803751:	0f 84 ad 00 00 00    	je     803804 <pthread_join+0xe6>
+		return -E_INVAL;
+	while ((state = th->th_state) == PTH_RUNNING)
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  803757:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80375a:	8d 3c 85 44 60 80 00 	lea    0x806044(,%eax,4),%edi
+	while ((state = th->th_state) == PTH_RUNNING)
+  803761:	8d 34 85 40 60 80 00 	lea    0x806040(,%eax,4),%esi
+  803768:	eb 10                	jmp    80377a <pthread_join+0x5c>
+		sys_futex_wait(&th->th_state, PTH_RUNNING, 0);
+  80376a:	83 ec 04             	sub    $0x4,%esp
+  80376d:	6a 00                	push   $0x0
+  80376f:	6a 01                	push   $0x1
+  803771:	57                   	push   %edi
+  803772:	e8 1e d8 ff ff       	call   800f95 <sys_futex_wait>
+  803777:	83 c4 10             	add    $0x10,%esp
+	while ((state = th->th_state) == PTH_RUNNING)
+  80377a:	8b 46 04             	mov    0x4(%esi),%eax
+  80377d:	83 f8 01             	cmp    $0x1,%eax
+  803780:	74 e8                	je     80376a <pthread_join+0x4c>
+	if (state != PTH_DONE)
+  803782:	83 f8 02             	cmp    $0x2,%eax
+  803785:	0f 85 80 00 00 00    	jne    80380b <pthread_join+0xed>
+		return -E_INVAL;
+
+	// The slot's stacks are reused as they are, so make sure the
+	// thread has stopped running on them.
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  80378b:	8d 34 9b             	lea    (%ebx,%ebx,4),%esi
+  80378e:	c1 e6 02             	shl    $0x2,%esi
+  803791:	eb 05                	jmp    803798 <pthread_join+0x7a>
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+		sys_yield();
+  803793:	e8 bc d4 ff ff       	call   800c54 <sys_yield>
+	while (envs[ENVX(th->th_env)].env_id == th->th_env
+  803798:	8b 8e 40 60 80 00    	mov    0x806040(%esi),%ecx
+  80379e:	89 ca                	mov    %ecx,%edx
+  8037a0:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8037a6:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8037a9:	c1 e0 04             	shl    $0x4,%eax
+  8037ac:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8037b1:	8b 40 48             	mov    0x48(%eax),%eax
+	       && envs[ENVX(th->th_env)].env_status != ENV_FREE)
+  8037b4:	39 c1                	cmp    %eax,%ecx
+  8037b6:	75 12                	jne    8037ca <pthread_join+0xac>
+  8037b8:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8037bb:	c1 e0 04             	shl    $0x4,%eax
+  8037be:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8037c3:	8b 40 54             	mov    0x54(%eax),%eax
+  8037c6:	85 c0                	test   %eax,%eax
+  8037c8:	75 c9                	jne    803793 <pthread_join+0x75>
+	if (ret_store)
+  8037ca:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8037ce:	74 0f                	je     8037df <pthread_join+0xc1>
+		*ret_store = th->th_ret;
+  8037d0:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8037d3:	8b 04 85 50 60 80 00 	mov    0x806050(,%eax,4),%eax
+  8037da:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8037dd:	89 07                	mov    %eax,(%edi)
+	th->th_state = PTH_FREE;
+  8037df:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8037e2:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  8037e9:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 0;
+  8037f0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8037f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8037f8:	5b                   	pop    %ebx
+  8037f9:	5e                   	pop    %esi
+  8037fa:	5f                   	pop    %edi
+  8037fb:	5d                   	pop    %ebp
+  8037fc:	c3                   	ret
+		return -E_INVAL;
+  8037fd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803802:	eb f1                	jmp    8037f5 <pthread_join+0xd7>
+  803804:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803809:	eb ea                	jmp    8037f5 <pthread_join+0xd7>
+		return -E_INVAL;
+  80380b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803810:	eb e3                	jmp    8037f5 <pthread_join+0xd7>
+
+00803812 <pthread_exit>:
+
+// End the calling thread, making 'ret' its pthread_join result.
+// In the main thread this is exit().
+void
+pthread_exit(void *ret)
+{
+  803812:	55                   	push   %ebp
+  803813:	89 e5                	mov    %esp,%ebp
+  803815:	53                   	push   %ebx
+  803816:	83 ec 04             	sub    $0x4,%esp
+  803819:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80381b:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803821:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803826:	77 0c                	ja     803834 <pthread_exit+0x22>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803828:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80382d:	29 d0                	sub    %edx,%eax
+	pthread_t t = pthread_self();
+	struct pthread *th = &threads[t];
+
+	if (t == 0)
+  80382f:	c1 e8 10             	shr    $0x10,%eax
+  803832:	75 0a                	jne    80383e <pthread_exit+0x2c>
+		exit();
+  803834:	e8 68 c9 ff ff       	call   8001a1 <exit>
+  803839:	b8 00 00 00 00       	mov    $0x0,%eax
+	th->th_ret = ret;
+  80383e:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  803845:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  803848:	8d 0c 8d 40 60 80 00 	lea    0x806040(,%ecx,4),%ecx
+  80384f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803852:	89 59 10             	mov    %ebx,0x10(%ecx)
+	th->th_state = PTH_DONE;
+  803855:	c7 41 04 02 00 00 00 	movl   $0x2,0x4(%ecx)
+	sys_futex_wake(&th->th_state, PTHREAD_MAX);
+  80385c:	83 ec 08             	sub    $0x8,%esp
+  80385f:	6a 20                	push   $0x20
+  803861:	01 c2                	add    %eax,%edx
+  803863:	8d 04 95 44 60 80 00 	lea    0x806044(,%edx,4),%eax
+  80386a:	50                   	push   %eax
+  80386b:	e8 54 d7 ff ff       	call   800fc4 <sys_futex_wake>
+	sys_env_destroy(0);
+  803870:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  803877:	e8 61 d3 ff ff       	call   800bdd <sys_env_destroy>
+	panic("pthread_exit: still alive");
+  80387c:	83 c4 0c             	add    $0xc,%esp
+  80387f:	68 66 4d 80 00       	push   $0x804d66
+  803884:	68 a5 00 00 00       	push   $0xa5
+  803889:	68 80 4d 80 00       	push   $0x804d80
+  80388e:	e8 cd 03 00 00       	call   803c60 <_panic>
+
+00803893 <pthread_start>:
+{
+  803893:	55                   	push   %ebp
+  803894:	89 e5                	mov    %esp,%ebp
+  803896:	53                   	push   %ebx
+  803897:	83 ec 04             	sub    $0x4,%esp
+  80389a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	pthread_tls(t)->tls_env = &envs[ENVX(sys_getenvid())];
+  80389d:	e8 86 d3 ff ff       	call   800c28 <sys_getenvid>
+  8038a2:	25 ff 03 00 00       	and    $0x3ff,%eax
+		return pthread_main_tls;
+  8038a7:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	if (t == 0)
+  8038ad:	85 db                	test   %ebx,%ebx
+  8038af:	74 0c                	je     8038bd <pthread_start+0x2a>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8038b1:	89 d9                	mov    %ebx,%ecx
+  8038b3:	c1 e1 10             	shl    $0x10,%ecx
+  8038b6:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8038bb:	29 ca                	sub    %ecx,%edx
+  8038bd:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8038c0:	c1 e0 04             	shl    $0x4,%eax
+  8038c3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8038c8:	89 02                	mov    %eax,(%edx)
+	pthread_exit(threads[t].th_fn(threads[t].th_arg));
+  8038ca:	83 ec 0c             	sub    $0xc,%esp
+  8038cd:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  8038d4:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  8038d7:	ff 34 95 4c 60 80 00 	push   0x80604c(,%edx,4)
+  8038de:	ff 14 95 48 60 80 00 	call   *0x806048(,%edx,4)
+  8038e5:	89 04 24             	mov    %eax,(%esp)
+  8038e8:	e8 25 ff ff ff       	call   803812 <pthread_exit>
+
+008038ed <pthread_kill_others>:
+// The kernel lets any thread destroy another that shares its page
+// directory, so this works from any thread, not just the main one.
+// A failure means the thread had already gone away by itself.
+void
+pthread_kill_others(void)
+{
+  8038ed:	55                   	push   %ebp
+  8038ee:	89 e5                	mov    %esp,%ebp
+  8038f0:	57                   	push   %edi
+  8038f1:	56                   	push   %esi
+  8038f2:	53                   	push   %ebx
+  8038f3:	83 ec 1c             	sub    $0x1c,%esp
+  8038f6:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8038f8:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+		return 0;
+  8038fe:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803905:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  80390a:	77 0d                	ja     803919 <pthread_kill_others+0x2c>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  80390c:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803911:	29 d0                	sub    %edx,%eax
+  803913:	c1 e8 10             	shr    $0x10,%eax
+  803916:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pthread_t t, self = pthread_self();
+	envid_t id;
+	int r;
+
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  803919:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80391e:	eb 2f                	jmp    80394f <pthread_kill_others+0x62>
+		return pthread_main_tls;
+  803920:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803926:	8b 01                	mov    (%ecx),%eax
+  803928:	8b 40 60             	mov    0x60(%eax),%eax
+		if (t == self || threads[t].th_state != PTH_RUNNING
+		    || !pthread_ours(&threads[t]))
+  80392b:	39 c2                	cmp    %eax,%edx
+  80392d:	75 14                	jne    803943 <pthread_kill_others+0x56>
+			continue;
+		id = threads[t].th_env;
+		if ((r = sys_env_destroy(id)) < 0
+  80392f:	83 ec 0c             	sub    $0xc,%esp
+  803932:	57                   	push   %edi
+  803933:	e8 a5 d2 ff ff       	call   800bdd <sys_env_destroy>
+  803938:	83 c4 10             	add    $0x10,%esp
+  80393b:	85 c0                	test   %eax,%eax
+  80393d:	0f 88 97 00 00 00    	js     8039da <pthread_kill_others+0xed>
+	for (t = 0; t < PTHREAD_MAX; t++) {
+  803943:	83 c3 01             	add    $0x1,%ebx
+  803946:	83 fb 20             	cmp    $0x20,%ebx
+  803949:	0f 84 d2 00 00 00    	je     803a21 <pthread_kill_others+0x134>
+		if (t == self || threads[t].th_state != PTH_RUNNING
+  80394f:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  803952:	74 ef                	je     803943 <pthread_kill_others+0x56>
+  803954:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803957:	8d 04 85 40 60 80 00 	lea    0x806040(,%eax,4),%eax
+  80395e:	8b 40 04             	mov    0x4(%eax),%eax
+  803961:	83 f8 01             	cmp    $0x1,%eax
+  803964:	75 dd                	jne    803943 <pthread_kill_others+0x56>
+	const volatile struct Env *e = &envs[ENVX(th->th_env)];
+  803966:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803969:	8b 3c 85 40 60 80 00 	mov    0x806040(,%eax,4),%edi
+  803970:	89 fe                	mov    %edi,%esi
+  803972:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  803978:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  80397b:	c1 e0 04             	shl    $0x4,%eax
+  80397e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803983:	8b 40 48             	mov    0x48(%eax),%eax
+		&& e->env_pgdir == thisenv->env_pgdir;
+  803986:	39 c7                	cmp    %eax,%edi
+  803988:	75 b9                	jne    803943 <pthread_kill_others+0x56>
+	return e->env_id == th->th_env && e->env_status != ENV_FREE
+  80398a:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  80398d:	c1 e0 04             	shl    $0x4,%eax
+  803990:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803995:	8b 40 54             	mov    0x54(%eax),%eax
+  803998:	85 c0                	test   %eax,%eax
+  80399a:	74 a7                	je     803943 <pthread_kill_others+0x56>
+		&& e->env_pgdir == thisenv->env_pgdir;
+  80399c:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  80399f:	c1 e0 04             	shl    $0x4,%eax
+  8039a2:	8b 90 60 00 c0 ee    	mov    -0x113fffa0(%eax),%edx
+  8039a8:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8039aa:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  8039b0:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8039b5:	0f 87 65 ff ff ff    	ja     803920 <pthread_kill_others+0x33>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8039bb:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8039c0:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  8039c2:	c1 e8 10             	shr    $0x10,%eax
+  8039c5:	0f 84 55 ff ff ff    	je     803920 <pthread_kill_others+0x33>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8039cb:	c1 e0 10             	shl    $0x10,%eax
+  8039ce:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  8039d3:	29 c1                	sub    %eax,%ecx
+  8039d5:	e9 4c ff ff ff       	jmp    803926 <pthread_kill_others+0x39>
+		    && envs[ENVX(id)].env_id == id
+  8039da:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  8039dd:	c1 e2 04             	shl    $0x4,%edx
+  8039e0:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8039e6:	8b 52 48             	mov    0x48(%edx),%edx
+  8039e9:	39 fa                	cmp    %edi,%edx
+  8039eb:	0f 85 52 ff ff ff    	jne    803943 <pthread_kill_others+0x56>
+		    && envs[ENVX(id)].env_status != ENV_FREE)
+  8039f1:	8d 14 f6             	lea    (%esi,%esi,8),%edx
+  8039f4:	c1 e2 04             	shl    $0x4,%edx
+  8039f7:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8039fd:	8b 52 54             	mov    0x54(%edx),%edx
+  803a00:	85 d2                	test   %edx,%edx
+  803a02:	0f 84 3b ff ff ff    	je     803943 <pthread_kill_others+0x56>
+			panic("pthread_kill_others: thread %08x: %e", id, r);
+  803a08:	83 ec 0c             	sub    $0xc,%esp
+  803a0b:	50                   	push   %eax
+  803a0c:	57                   	push   %edi
+  803a0d:	68 90 4d 80 00       	push   $0x804d90
+  803a12:	68 bb 00 00 00       	push   $0xbb
+  803a17:	68 80 4d 80 00       	push   $0x804d80
+  803a1c:	e8 3f 02 00 00       	call   803c60 <_panic>
+	}
+}
+  803a21:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a24:	5b                   	pop    %ebx
+  803a25:	5e                   	pop    %esi
+  803a26:	5f                   	pop    %edi
+  803a27:	5d                   	pop    %ebp
+  803a28:	c3                   	ret
+
+00803a29 <pthread_fork_child>:
+
+// In a freshly forked child, forget the parent's threads: the child
+// is just the one thread that called fork.
+void
+pthread_fork_child(void)
+{
+  803a29:	55                   	push   %ebp
+  803a2a:	89 e5                	mov    %esp,%ebp
+  803a2c:	53                   	push   %ebx
+  803a2d:	83 ec 04             	sub    $0x4,%esp
+  803a30:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803a32:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+  803a38:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803a3e:	0f 87 85 00 00 00    	ja     803ac9 <pthread_fork_child+0xa0>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803a44:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  803a49:	29 c3                	sub    %eax,%ebx
+  803a4b:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+
+	memset(threads, 0, sizeof(threads));
+  803a4e:	83 ec 04             	sub    $0x4,%esp
+  803a51:	68 80 02 00 00       	push   $0x280
+  803a56:	6a 00                	push   $0x0
+  803a58:	68 40 60 80 00       	push   $0x806040
+  803a5d:	e8 31 cf ff ff       	call   800993 <memset>
+	threads_mu.m_state = 0;
+  803a62:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  803a69:	00 00 00 
+	if (self != 0) {
+  803a6c:	83 c4 10             	add    $0x10,%esp
+  803a6f:	85 db                	test   %ebx,%ebx
+  803a71:	74 51                	je     803ac4 <pthread_fork_child+0x9b>
+  803a73:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803a75:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  803a7b:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  803a80:	77 18                	ja     803a9a <pthread_fork_child+0x71>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803a82:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  803a87:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  803a89:	c1 e8 10             	shr    $0x10,%eax
+  803a8c:	74 0c                	je     803a9a <pthread_fork_child+0x71>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803a8e:	c1 e0 10             	shl    $0x10,%eax
+  803a91:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803a96:	29 c2                	sub    %eax,%edx
+  803a98:	eb 06                	jmp    803aa0 <pthread_fork_child+0x77>
+		return pthread_main_tls;
+  803a9a:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		threads[self].th_env = thisenv->env_id;
+  803aa0:	8b 02                	mov    (%edx),%eax
+  803aa2:	8b 48 48             	mov    0x48(%eax),%ecx
+  803aa5:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803aac:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803aaf:	89 0c 95 40 60 80 00 	mov    %ecx,0x806040(,%edx,4)
+		threads[self].th_state = PTH_RUNNING;
+  803ab6:	8d 04 95 40 60 80 00 	lea    0x806040(,%edx,4),%eax
+  803abd:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	}
+}
+  803ac4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803ac7:	c9                   	leave
+  803ac8:	c3                   	ret
+	memset(threads, 0, sizeof(threads));
+  803ac9:	83 ec 04             	sub    $0x4,%esp
+  803acc:	68 80 02 00 00       	push   $0x280
+  803ad1:	6a 00                	push   $0x0
+  803ad3:	68 40 60 80 00       	push   $0x806040
+  803ad8:	e8 b6 ce ff ff       	call   800993 <memset>
+	threads_mu.m_state = 0;
+  803add:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  803ae4:	00 00 00 
+  803ae7:	83 c4 10             	add    $0x10,%esp
+  803aea:	eb d8                	jmp    803ac4 <pthread_fork_child+0x9b>
+
+00803aec <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803aec:	b8 00 00 00 00       	mov    $0x0,%eax
+  803af1:	c3                   	ret
+
+00803af2 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803af2:	55                   	push   %ebp
+  803af3:	89 e5                	mov    %esp,%ebp
+  803af5:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803af8:	68 b5 4d 80 00       	push   $0x804db5
+  803afd:	ff 75 0c             	push   0xc(%ebp)
+  803b00:	e8 3d cd ff ff       	call   800842 <strcpy>
+	return 0;
+}
+  803b05:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b0a:	c9                   	leave
+  803b0b:	c3                   	ret
+
+00803b0c <devcons_write>:
+{
+  803b0c:	55                   	push   %ebp
+  803b0d:	89 e5                	mov    %esp,%ebp
+  803b0f:	57                   	push   %edi
+  803b10:	56                   	push   %esi
+  803b11:	53                   	push   %ebx
+  803b12:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803b18:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803b1d:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803b23:	eb 2e                	jmp    803b53 <devcons_write+0x47>
+		m = n - tot;
+  803b25:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803b28:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803b2a:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803b2f:	39 c3                	cmp    %eax,%ebx
+  803b31:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803b34:	83 ec 04             	sub    $0x4,%esp
+  803b37:	53                   	push   %ebx
+  803b38:	89 f0                	mov    %esi,%eax
+  803b3a:	03 45 0c             	add    0xc(%ebp),%eax
+  803b3d:	50                   	push   %eax
+  803b3e:	57                   	push   %edi
+  803b3f:	e8 84 ce ff ff       	call   8009c8 <memmove>
+		sys_cputs(buf, m);
+  803b44:	83 c4 08             	add    $0x8,%esp
+  803b47:	53                   	push   %ebx
+  803b48:	57                   	push   %edi
+  803b49:	e8 38 d0 ff ff       	call   800b86 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803b4e:	01 de                	add    %ebx,%esi
+  803b50:	83 c4 10             	add    $0x10,%esp
+  803b53:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803b56:	72 cd                	jb     803b25 <devcons_write+0x19>
+}
+  803b58:	89 f0                	mov    %esi,%eax
+  803b5a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803b5d:	5b                   	pop    %ebx
+  803b5e:	5e                   	pop    %esi
+  803b5f:	5f                   	pop    %edi
+  803b60:	5d                   	pop    %ebp
+  803b61:	c3                   	ret
+
+00803b62 <devcons_read>:
+{
+  803b62:	55                   	push   %ebp
+  803b63:	89 e5                	mov    %esp,%ebp
+  803b65:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  803b68:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b6d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803b71:	75 07                	jne    803b7a <devcons_read+0x18>
+  803b73:	eb 1f                	jmp    803b94 <devcons_read+0x32>
+		sys_yield();
+  803b75:	e8 da d0 ff ff       	call   800c54 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  803b7a:	e8 32 d0 ff ff       	call   800bb1 <sys_cgetc>
+  803b7f:	85 c0                	test   %eax,%eax
+  803b81:	74 f2                	je     803b75 <devcons_read+0x13>
+	if (c < 0)
+  803b83:	78 0f                	js     803b94 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  803b85:	83 f8 04             	cmp    $0x4,%eax
+  803b88:	74 0c                	je     803b96 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  803b8a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803b8d:	88 02                	mov    %al,(%edx)
+	return 1;
+  803b8f:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803b94:	c9                   	leave
+  803b95:	c3                   	ret
+		return 0;
+  803b96:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b9b:	eb f7                	jmp    803b94 <devcons_read+0x32>
+
+00803b9d <cputchar>:
+{
+  803b9d:	55                   	push   %ebp
+  803b9e:	89 e5                	mov    %esp,%ebp
+  803ba0:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803ba3:	8b 45 08             	mov    0x8(%ebp),%eax
+  803ba6:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803ba9:	6a 01                	push   $0x1
+  803bab:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803bae:	50                   	push   %eax
+  803baf:	e8 d2 cf ff ff       	call   800b86 <sys_cputs>
+}
+  803bb4:	83 c4 10             	add    $0x10,%esp
+  803bb7:	c9                   	leave
+  803bb8:	c3                   	ret
+
+00803bb9 <getchar>:
+{
+  803bb9:	55                   	push   %ebp
+  803bba:	89 e5                	mov    %esp,%ebp
+  803bbc:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803bbf:	6a 01                	push   $0x1
+  803bc1:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803bc4:	50                   	push   %eax
+  803bc5:	6a 00                	push   $0x0
+  803bc7:	e8 63 d8 ff ff       	call   80142f <read>
+	if (r < 0)
+  803bcc:	83 c4 10             	add    $0x10,%esp
+  803bcf:	85 c0                	test   %eax,%eax
+  803bd1:	78 06                	js     803bd9 <getchar+0x20>
+	if (r < 1)
+  803bd3:	74 06                	je     803bdb <getchar+0x22>
+	return c;
+  803bd5:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803bd9:	c9                   	leave
+  803bda:	c3                   	ret
+		return -E_EOF;
+  803bdb:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803be0:	eb f7                	jmp    803bd9 <getchar+0x20>
+
+00803be2 <iscons>:
+{
+  803be2:	55                   	push   %ebp
+  803be3:	89 e5                	mov    %esp,%ebp
+  803be5:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803be8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803beb:	50                   	push   %eax
+  803bec:	ff 75 08             	push   0x8(%ebp)
+  803bef:	e8 ab d5 ff ff       	call   80119f <fd_lookup>
+  803bf4:	83 c4 10             	add    $0x10,%esp
+  803bf7:	85 c0                	test   %eax,%eax
+  803bf9:	78 11                	js     803c0c <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803bfb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803bfe:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  803c04:	39 10                	cmp    %edx,(%eax)
+  803c06:	0f 94 c0             	sete   %al
+  803c09:	0f b6 c0             	movzbl %al,%eax
+}
+  803c0c:	c9                   	leave
+  803c0d:	c3                   	ret
+
+00803c0e <opencons>:
+{
+  803c0e:	55                   	push   %ebp
+  803c0f:	89 e5                	mov    %esp,%ebp
+  803c11:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803c14:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803c17:	50                   	push   %eax
+  803c18:	e8 2c d5 ff ff       	call   801149 <fd_alloc>
+  803c1d:	83 c4 10             	add    $0x10,%esp
+  803c20:	85 c0                	test   %eax,%eax
+  803c22:	78 3a                	js     803c5e <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803c24:	83 ec 04             	sub    $0x4,%esp
+  803c27:	68 07 04 00 00       	push   $0x407
+  803c2c:	ff 75 f4             	push   -0xc(%ebp)
+  803c2f:	6a 00                	push   $0x0
+  803c31:	e8 4a d0 ff ff       	call   800c80 <sys_page_alloc>
+  803c36:	83 c4 10             	add    $0x10,%esp
+  803c39:	85 c0                	test   %eax,%eax
+  803c3b:	78 21                	js     803c5e <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803c3d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803c40:	8b 15 98 52 80 00    	mov    0x805298,%edx
+  803c46:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803c48:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803c4b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803c52:	83 ec 0c             	sub    $0xc,%esp
+  803c55:	50                   	push   %eax
+  803c56:	e8 c7 d4 ff ff       	call   801122 <fd2num>
+  803c5b:	83 c4 10             	add    $0x10,%esp
+}
+  803c5e:	c9                   	leave
+  803c5f:	c3                   	ret
+
+00803c60 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  803c60:	55                   	push   %ebp
+  803c61:	89 e5                	mov    %esp,%ebp
+  803c63:	56                   	push   %esi
+  803c64:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  803c65:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  803c68:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  803c6e:	e8 b5 cf ff ff       	call   800c28 <sys_getenvid>
+  803c73:	83 ec 0c             	sub    $0xc,%esp
+  803c76:	ff 75 0c             	push   0xc(%ebp)
+  803c79:	ff 75 08             	push   0x8(%ebp)
+  803c7c:	56                   	push   %esi
+  803c7d:	50                   	push   %eax
+  803c7e:	68 c4 4d 80 00       	push   $0x804dc4
+  803c83:	e8 d6 c5 ff ff       	call   80025e <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  803c88:	83 c4 18             	add    $0x18,%esp
+  803c8b:	53                   	push   %ebx
+  803c8c:	ff 75 10             	push   0x10(%ebp)
+  803c8f:	e8 79 c5 ff ff       	call   80020d <vcprintf>
+	cprintf("\n");
+  803c94:	c7 04 24 22 4f 80 00 	movl   $0x804f22,(%esp)
+  803c9b:	e8 be c5 ff ff       	call   80025e <cprintf>
+  803ca0:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  803ca3:	cc                   	int3
+	while (1)
+  803ca4:	eb fd                	jmp    803ca3 <_panic+0x43>
+
+00803ca6 <duppage_cow>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage_cow(envid_t envid, unsigned pn, int perm)
+{
+  803ca6:	55                   	push   %ebp
+  803ca7:	89 e5                	mov    %esp,%ebp
+  803ca9:	57                   	push   %edi
+  803caa:	56                   	push   %esi
+  803cab:	53                   	push   %ebx
+  803cac:	83 ec 18             	sub    $0x18,%esp
+	int is_cow;
+	int r;
+	void* va = (void*)(pn << PGSHIFT);
+  803caf:	89 d6                	mov    %edx,%esi
+  803cb1:	c1 e6 0c             	shl    $0xc,%esi
+
+	perm &= ~PTE_W;
+  803cb4:	89 cf                	mov    %ecx,%edi
+  803cb6:	83 e7 fd             	and    $0xfffffffd,%edi
+	is_cow = perm & PTE_COW;
+	if (!is_cow) {
+		perm |= PTE_COW;
+  803cb9:	89 fa                	mov    %edi,%edx
+  803cbb:	80 ce 08             	or     $0x8,%dh
+  803cbe:	f6 c5 08             	test   $0x8,%ch
+  803cc1:	0f 44 fa             	cmove  %edx,%edi
+	}
+
+	r = sys_page_map(0, va, envid, va, perm);
+  803cc4:	57                   	push   %edi
+  803cc5:	56                   	push   %esi
+  803cc6:	50                   	push   %eax
+  803cc7:	56                   	push   %esi
+  803cc8:	6a 00                	push   $0x0
+  803cca:	e8 fe cf ff ff       	call   800ccd <sys_page_map>
+	if (r < 0) {
+  803ccf:	83 c4 20             	add    $0x20,%esp
+  803cd2:	85 c0                	test   %eax,%eax
+  803cd4:	78 27                	js     803cfd <duppage_cow+0x57>
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+		return r;
+	}
+
+	// TODO: is it safe to check is_cow to avoid map?
+	r = sys_page_map(0, va, 0, va, perm);
+  803cd6:	83 ec 0c             	sub    $0xc,%esp
+  803cd9:	57                   	push   %edi
+  803cda:	56                   	push   %esi
+  803cdb:	6a 00                	push   $0x0
+  803cdd:	56                   	push   %esi
+  803cde:	6a 00                	push   $0x0
+  803ce0:	e8 e8 cf ff ff       	call   800ccd <sys_page_map>
+  803ce5:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803ce7:	83 c4 20             	add    $0x20,%esp
+  803cea:	85 c0                	test   %eax,%eax
+  803cec:	78 24                	js     803d12 <duppage_cow+0x6c>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+		return r;
+	}
+	return 0;
+  803cee:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803cf3:	89 d8                	mov    %ebx,%eax
+  803cf5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803cf8:	5b                   	pop    %ebx
+  803cf9:	5e                   	pop    %esi
+  803cfa:	5f                   	pop    %edi
+  803cfb:	5d                   	pop    %ebp
+  803cfc:	c3                   	ret
+  803cfd:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803cff:	83 ec 08             	sub    $0x8,%esp
+  803d02:	50                   	push   %eax
+  803d03:	68 e8 4d 80 00       	push   $0x804de8
+  803d08:	e8 51 c5 ff ff       	call   80025e <cprintf>
+		return r;
+  803d0d:	83 c4 10             	add    $0x10,%esp
+  803d10:	eb e1                	jmp    803cf3 <duppage_cow+0x4d>
+		cprintf("sys_page_map remap child failed: %e.\n", r);
+  803d12:	83 ec 08             	sub    $0x8,%esp
+  803d15:	50                   	push   %eax
+  803d16:	68 18 4e 80 00       	push   $0x804e18
+  803d1b:	e8 3e c5 ff ff       	call   80025e <cprintf>
+		return r;
+  803d20:	83 c4 10             	add    $0x10,%esp
+  803d23:	eb ce                	jmp    803cf3 <duppage_cow+0x4d>
+
+00803d25 <duppage>:
+{
+  803d25:	55                   	push   %ebp
+  803d26:	89 e5                	mov    %esp,%ebp
+  803d28:	53                   	push   %ebx
+  803d29:	83 ec 10             	sub    $0x10,%esp
+	void* va = (void*)(pn << PGSHIFT);
+  803d2c:	c1 e2 0c             	shl    $0xc,%edx
+	r = sys_page_map(0, va, envid, va, perm);
+  803d2f:	51                   	push   %ecx
+  803d30:	52                   	push   %edx
+  803d31:	50                   	push   %eax
+  803d32:	52                   	push   %edx
+  803d33:	6a 00                	push   $0x0
+  803d35:	e8 93 cf ff ff       	call   800ccd <sys_page_map>
+	if (r < 0) {
+  803d3a:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  803d3d:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (r < 0) {
+  803d42:	85 c0                	test   %eax,%eax
+  803d44:	78 07                	js     803d4d <duppage+0x28>
+}
+  803d46:	89 d8                	mov    %ebx,%eax
+  803d48:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803d4b:	c9                   	leave
+  803d4c:	c3                   	ret
+  803d4d:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_map from parent to child failed: %e.\n", r);
+  803d4f:	83 ec 08             	sub    $0x8,%esp
+  803d52:	50                   	push   %eax
+  803d53:	68 e8 4d 80 00       	push   $0x804de8
+  803d58:	e8 01 c5 ff ff       	call   80025e <cprintf>
+		return r;
+  803d5d:	83 c4 10             	add    $0x10,%esp
+  803d60:	eb e4                	jmp    803d46 <duppage+0x21>
+
+00803d62 <cow_copy>:
+{
+  803d62:	55                   	push   %ebp
+  803d63:	89 e5                	mov    %esp,%ebp
+  803d65:	56                   	push   %esi
+  803d66:	53                   	push   %ebx
+  803d67:	89 c6                	mov    %eax,%esi
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  803d69:	83 ec 04             	sub    $0x4,%esp
+  803d6c:	6a 07                	push   $0x7
+  803d6e:	68 00 f0 7f 00       	push   $0x7ff000
+  803d73:	6a 00                	push   $0x0
+  803d75:	e8 06 cf ff ff       	call   800c80 <sys_page_alloc>
+	if (r < 0) {
+  803d7a:	83 c4 10             	add    $0x10,%esp
+  803d7d:	85 c0                	test   %eax,%eax
+  803d7f:	78 58                	js     803dd9 <cow_copy+0x77>
+	memmove(PFTEMP, (void*)addr, PGSIZE);
+  803d81:	83 ec 04             	sub    $0x4,%esp
+  803d84:	68 00 10 00 00       	push   $0x1000
+  803d89:	56                   	push   %esi
+  803d8a:	68 00 f0 7f 00       	push   $0x7ff000
+  803d8f:	e8 34 cc ff ff       	call   8009c8 <memmove>
+	r = sys_page_map(0, PFTEMP, 0, (void*)addr, PTE_P | PTE_U | PTE_W);
+  803d94:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  803d9b:	56                   	push   %esi
+  803d9c:	6a 00                	push   $0x0
+  803d9e:	68 00 f0 7f 00       	push   $0x7ff000
+  803da3:	6a 00                	push   $0x0
+  803da5:	e8 23 cf ff ff       	call   800ccd <sys_page_map>
+  803daa:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803dac:	83 c4 20             	add    $0x20,%esp
+  803daf:	85 c0                	test   %eax,%eax
+  803db1:	78 3b                	js     803dee <cow_copy+0x8c>
+	r = sys_page_unmap(0, PFTEMP);
+  803db3:	83 ec 08             	sub    $0x8,%esp
+  803db6:	68 00 f0 7f 00       	push   $0x7ff000
+  803dbb:	6a 00                	push   $0x0
+  803dbd:	e8 57 cf ff ff       	call   800d19 <sys_page_unmap>
+  803dc2:	89 c3                	mov    %eax,%ebx
+	if (r < 0) {
+  803dc4:	83 c4 10             	add    $0x10,%esp
+  803dc7:	85 c0                	test   %eax,%eax
+  803dc9:	78 45                	js     803e10 <cow_copy+0xae>
+	return 0;
+  803dcb:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803dd0:	89 d8                	mov    %ebx,%eax
+  803dd2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803dd5:	5b                   	pop    %ebx
+  803dd6:	5e                   	pop    %esi
+  803dd7:	5d                   	pop    %ebp
+  803dd8:	c3                   	ret
+  803dd9:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_page_alloc failed, %e.\n", r);
+  803ddb:	83 ec 08             	sub    $0x8,%esp
+  803dde:	50                   	push   %eax
+  803ddf:	68 08 4f 80 00       	push   $0x804f08
+  803de4:	e8 75 c4 ff ff       	call   80025e <cprintf>
+		return r;
+  803de9:	83 c4 10             	add    $0x10,%esp
+  803dec:	eb e2                	jmp    803dd0 <cow_copy+0x6e>
+		cprintf("sys_page_map failed, %e.\n", r);
+  803dee:	83 ec 08             	sub    $0x8,%esp
+  803df1:	50                   	push   %eax
+  803df2:	68 24 4f 80 00       	push   $0x804f24
+  803df7:	e8 62 c4 ff ff       	call   80025e <cprintf>
+		sys_page_unmap(0, PFTEMP);
+  803dfc:	83 c4 08             	add    $0x8,%esp
+  803dff:	68 00 f0 7f 00       	push   $0x7ff000
+  803e04:	6a 00                	push   $0x0
+  803e06:	e8 0e cf ff ff       	call   800d19 <sys_page_unmap>
+		return r;
+  803e0b:	83 c4 10             	add    $0x10,%esp
+  803e0e:	eb c0                	jmp    803dd0 <cow_copy+0x6e>
+		cprintf("sys_page_unmap PFTEMP failed, %e.\n", r);
+  803e10:	83 ec 08             	sub    $0x8,%esp
+  803e13:	50                   	push   %eax
+  803e14:	68 40 4e 80 00       	push   $0x804e40
+  803e19:	e8 40 c4 ff ff       	call   80025e <cprintf>
+		return r;
+  803e1e:	83 c4 10             	add    $0x10,%esp
+  803e21:	eb ad                	jmp    803dd0 <cow_copy+0x6e>
+
+00803e23 <pgfault>:
+{
+  803e23:	55                   	push   %ebp
+  803e24:	89 e5                	mov    %esp,%ebp
+  803e26:	56                   	push   %esi
+  803e27:	53                   	push   %ebx
+  803e28:	8b 55 08             	mov    0x8(%ebp),%edx
+	uintptr_t addr = utf->utf_fault_va;
+  803e2b:	8b 1a                	mov    (%edx),%ebx
+	pde_t pde = uvpd[PDX(addr)];
+  803e2d:	89 d8                	mov    %ebx,%eax
+  803e2f:	c1 e8 16             	shr    $0x16,%eax
+  803e32:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+	pte_t pte = uvpt[addr >> PGSHIFT];
+  803e39:	89 de                	mov    %ebx,%esi
+  803e3b:	c1 ee 0c             	shr    $0xc,%esi
+  803e3e:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+	if (!((pde & (PTE_P | PTE_U | PTE_W)) &&
+  803e45:	a8 07                	test   $0x7,%al
+  803e47:	74 3b                	je     803e84 <pgfault+0x61>
+  803e49:	f7 c1 05 08 00 00    	test   $0x805,%ecx
+  803e4f:	74 33                	je     803e84 <pgfault+0x61>
+	mutex_lock(COW_LOCK);
+  803e51:	83 ec 0c             	sub    $0xc,%esp
+  803e54:	68 00 f0 bf ee       	push   $0xeebff000
+  803e59:	e8 82 f4 ff ff       	call   8032e0 <mutex_lock>
+	if (uvpt[addr >> PGSHIFT] & PTE_COW)
+  803e5e:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  803e65:	83 c4 10             	add    $0x10,%esp
+  803e68:	f6 c4 08             	test   $0x8,%ah
+  803e6b:	75 30                	jne    803e9d <pgfault+0x7a>
+	mutex_unlock(COW_LOCK);
+  803e6d:	83 ec 0c             	sub    $0xc,%esp
+  803e70:	68 00 f0 bf ee       	push   $0xeebff000
+  803e75:	e8 d3 f4 ff ff       	call   80334d <mutex_unlock>
+}
+  803e7a:	83 c4 10             	add    $0x10,%esp
+  803e7d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803e80:	5b                   	pop    %ebx
+  803e81:	5e                   	pop    %esi
+  803e82:	5d                   	pop    %ebp
+  803e83:	c3                   	ret
+		panic("Not COW page, pde: 0x%x, pte: 0x%x, eip: %p.\n", pde, pte, utf->utf_eip);
+  803e84:	83 ec 08             	sub    $0x8,%esp
+  803e87:	ff 72 28             	push   0x28(%edx)
+  803e8a:	51                   	push   %ecx
+  803e8b:	50                   	push   %eax
+  803e8c:	68 64 4e 80 00       	push   $0x804e64
+  803e91:	6a 3f                	push   $0x3f
+  803e93:	68 3e 4f 80 00       	push   $0x804f3e
+  803e98:	e8 c3 fd ff ff       	call   803c60 <_panic>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  803e9d:	89 d8                	mov    %ebx,%eax
+  803e9f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		cow_copy(addr);
+  803ea4:	e8 b9 fe ff ff       	call   803d62 <cow_copy>
+  803ea9:	eb c2                	jmp    803e6d <pgfault+0x4a>
+
+00803eab <cow_enable>:
+{
+  803eab:	55                   	push   %ebp
+  803eac:	89 e5                	mov    %esp,%ebp
+  803eae:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  803eb1:	68 23 3e 80 00       	push   $0x803e23
+  803eb6:	e8 28 06 00 00       	call   8044e3 <set_pgfault_handler>
+}
+  803ebb:	83 c4 10             	add    $0x10,%esp
+  803ebe:	c9                   	leave
+  803ebf:	c3                   	ret
+
+00803ec0 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  803ec0:	55                   	push   %ebp
+  803ec1:	89 e5                	mov    %esp,%ebp
+  803ec3:	57                   	push   %edi
+  803ec4:	56                   	push   %esi
+  803ec5:	53                   	push   %ebx
+  803ec6:	83 ec 28             	sub    $0x28,%esp
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  803ec9:	68 23 3e 80 00       	push   $0x803e23
+  803ece:	e8 10 06 00 00       	call   8044e3 <set_pgfault_handler>
+// it before the child gets to pop it.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  803ed3:	b8 07 00 00 00       	mov    $0x7,%eax
+  803ed8:	cd 30                	int    $0x30
+  803eda:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  803edd:	83 c4 10             	add    $0x10,%esp
+  803ee0:	85 c0                	test   %eax,%eax
+  803ee2:	78 4b                	js     803f2f <fork+0x6f>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  803ee4:	be 00 04 00 00       	mov    $0x400,%esi
+		return eid;
+	}
+
+	// parent
+	// iterate each pde, map writable pages
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  803ee9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803eee:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	if (eid == 0) {
+  803ef1:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  803ef5:	0f 85 16 01 00 00    	jne    804011 <fork+0x151>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803efb:	e8 28 cd ff ff       	call   800c28 <sys_getenvid>
+  803f00:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803f05:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  803f07:	8d 91 00 20 60 11    	lea    0x11602000(%ecx),%edx
+  803f0d:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  803f13:	77 32                	ja     803f47 <fork+0x87>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  803f15:	ba ff df bf ee       	mov    $0xeebfdfff,%edx
+  803f1a:	29 ca                	sub    %ecx,%edx
+	if (t == 0)
+  803f1c:	c1 ea 10             	shr    $0x10,%edx
+  803f1f:	74 26                	je     803f47 <fork+0x87>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  803f21:	c1 e2 10             	shl    $0x10,%edx
+  803f24:	89 d1                	mov    %edx,%ecx
+  803f26:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  803f2b:	29 ca                	sub    %ecx,%edx
+  803f2d:	eb 1e                	jmp    803f4d <fork+0x8d>
+		cprintf("fork failed, %e", eid);
+  803f2f:	83 ec 08             	sub    $0x8,%esp
+  803f32:	89 c7                	mov    %eax,%edi
+  803f34:	50                   	push   %eax
+  803f35:	68 49 4f 80 00       	push   $0x804f49
+  803f3a:	e8 1f c3 ff ff       	call   80025e <cprintf>
+		return eid;
+  803f3f:	83 c4 10             	add    $0x10,%esp
+  803f42:	e9 6c 01 00 00       	jmp    8040b3 <fork+0x1f3>
+		return pthread_main_tls;
+  803f47:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803f4d:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  803f50:	c1 e0 04             	shl    $0x4,%eax
+  803f53:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803f58:	89 02                	mov    %eax,(%edx)
+		pthread_fork_child();
+  803f5a:	e8 ca fa ff ff       	call   803a29 <pthread_fork_child>
+		return eid;
+  803f5f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  803f62:	e9 4c 01 00 00       	jmp    8040b3 <fork+0x1f3>
+				int pn = pdeno * NPDENTRIES + pteno;
+				pte_t pte = uvpt[pn];
+				if (pte & (PTE_P | PTE_U)) {
+					if (pte & PTE_SHARE) {
+						// PTE_SHARE keep shared
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  803f67:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  803f6d:	89 da                	mov    %ebx,%edx
+  803f6f:	89 f8                	mov    %edi,%eax
+  803f71:	e8 af fd ff ff       	call   803d25 <duppage>
+  803f76:	85 c0                	test   %eax,%eax
+  803f78:	79 28                	jns    803fa2 <fork+0xe2>
+  803f7a:	89 c7                	mov    %eax,%edi
+  803f7c:	e9 32 01 00 00       	jmp    8040b3 <fork+0x1f3>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+							return r;
+						}
+					} else {
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  803f81:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  803f87:	83 f9 05             	cmp    $0x5,%ecx
+  803f8a:	75 58                	jne    803fe4 <fork+0x124>
+						if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  803f8c:	b9 05 00 00 00       	mov    $0x5,%ecx
+  803f91:	89 da                	mov    %ebx,%edx
+  803f93:	89 f8                	mov    %edi,%eax
+  803f95:	e8 8b fd ff ff       	call   803d25 <duppage>
+  803f9a:	85 c0                	test   %eax,%eax
+  803f9c:	0f 88 0f 01 00 00    	js     8040b1 <fork+0x1f1>
+			for (int pteno = 0; pteno < entry_num; ++pteno) {
+  803fa2:	83 c3 01             	add    $0x1,%ebx
+  803fa5:	39 de                	cmp    %ebx,%esi
+  803fa7:	74 54                	je     803ffd <fork+0x13d>
+				pte_t pte = uvpt[pn];
+  803fa9:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+				if (pte & (PTE_P | PTE_U)) {
+  803fb0:	f6 c1 05             	test   $0x5,%cl
+  803fb3:	74 ed                	je     803fa2 <fork+0xe2>
+					if (pte & PTE_SHARE) {
+  803fb5:	f6 c5 04             	test   $0x4,%ch
+  803fb8:	75 ad                	jne    803f67 <fork+0xa7>
+					} else if (pte & PTE_W || pte & PTE_COW) {
+  803fba:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  803fc0:	74 bf                	je     803f81 <fork+0xc1>
+						if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  803fc2:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  803fc8:	74 d8                	je     803fa2 <fork+0xe2>
+						int perm = (pte & PTE_SYSCALL) & ~PTE_W;
+  803fca:	81 e1 05 0e 00 00    	and    $0xe05,%ecx
+						if ((r = duppage_cow(eid, pn, perm)) < 0) {
+  803fd0:	89 da                	mov    %ebx,%edx
+  803fd2:	89 f8                	mov    %edi,%eax
+  803fd4:	e8 cd fc ff ff       	call   803ca6 <duppage_cow>
+  803fd9:	85 c0                	test   %eax,%eax
+  803fdb:	79 c5                	jns    803fa2 <fork+0xe2>
+  803fdd:	89 c7                	mov    %eax,%edi
+  803fdf:	e9 cf 00 00 00       	jmp    8040b3 <fork+0x1f3>
+						assert((PTE_P | PTE_U) == (PTE_SYSCALL & pte));
+  803fe4:	68 94 4e 80 00       	push   $0x804e94
+  803fe9:	68 7d 4c 80 00       	push   $0x804c7d
+  803fee:	68 c6 00 00 00       	push   $0xc6
+  803ff3:	68 3e 4f 80 00       	push   $0x804f3e
+  803ff8:	e8 63 fc ff ff       	call   803c60 <_panic>
+  803ffd:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804000:	83 c1 01             	add    $0x1,%ecx
+  804003:	81 c6 00 04 00 00    	add    $0x400,%esi
+  804009:	81 f9 bb 03 00 00    	cmp    $0x3bb,%ecx
+  80400f:	74 18                	je     804029 <fork+0x169>
+		if (uvpd[pdeno] & (PTE_P | PTE_W | PTE_U)) {
+  804011:	8b 04 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%eax
+  804018:	a8 07                	test   $0x7,%al
+  80401a:	74 e4                	je     804000 <fork+0x140>
+  80401c:	89 cb                	mov    %ecx,%ebx
+  80401e:	c1 e3 0a             	shl    $0xa,%ebx
+  804021:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  804024:	e9 7c ff ff ff       	jmp    803fa5 <fork+0xe5>
+			}
+		}
+	}
+
+	// map user exception stack for child
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  804029:	83 ec 04             	sub    $0x4,%esp
+  80402c:	6a 07                	push   $0x7
+  80402e:	68 00 f0 bf ee       	push   $0xeebff000
+  804033:	ff 75 e4             	push   -0x1c(%ebp)
+  804036:	e8 45 cc ff ff       	call   800c80 <sys_page_alloc>
+  80403b:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80403d:	83 c4 10             	add    $0x10,%esp
+  804040:	85 c0                	test   %eax,%eax
+  804042:	78 34                	js     804078 <fork+0x1b8>
+		cprintf("map user exception stack failed, %e.\n", r);
+		return r;
+	}
+	extern void _pgfault_upcall(void);
+	// set the pgfault_handler for child
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  804044:	83 ec 08             	sub    $0x8,%esp
+  804047:	68 21 45 80 00       	push   $0x804521
+  80404c:	ff 75 e4             	push   -0x1c(%ebp)
+  80404f:	e8 a9 cd ff ff       	call   800dfd <sys_env_set_pgfault_upcall>
+  804054:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  804056:	83 c4 10             	add    $0x10,%esp
+  804059:	85 c0                	test   %eax,%eax
+  80405b:	78 2e                	js     80408b <fork+0x1cb>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+		return r;
+	}
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  80405d:	83 ec 08             	sub    $0x8,%esp
+  804060:	6a 02                	push   $0x2
+  804062:	ff 75 e4             	push   -0x1c(%ebp)
+  804065:	e8 fb cc ff ff       	call   800d65 <sys_env_set_status>
+  80406a:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80406c:	83 c4 10             	add    $0x10,%esp
+  80406f:	85 c0                	test   %eax,%eax
+  804071:	78 2b                	js     80409e <fork+0x1de>
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+  804073:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804076:	eb 3b                	jmp    8040b3 <fork+0x1f3>
+		cprintf("map user exception stack failed, %e.\n", r);
+  804078:	83 ec 08             	sub    $0x8,%esp
+  80407b:	50                   	push   %eax
+  80407c:	68 bc 4e 80 00       	push   $0x804ebc
+  804081:	e8 d8 c1 ff ff       	call   80025e <cprintf>
+		return r;
+  804086:	83 c4 10             	add    $0x10,%esp
+  804089:	eb 28                	jmp    8040b3 <fork+0x1f3>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  80408b:	83 ec 08             	sub    $0x8,%esp
+  80408e:	50                   	push   %eax
+  80408f:	68 e4 4e 80 00       	push   $0x804ee4
+  804094:	e8 c5 c1 ff ff       	call   80025e <cprintf>
+		return r;
+  804099:	83 c4 10             	add    $0x10,%esp
+  80409c:	eb 15                	jmp    8040b3 <fork+0x1f3>
+		cprintf("set child status failed, %e.\n", r);
+  80409e:	83 ec 08             	sub    $0x8,%esp
+  8040a1:	50                   	push   %eax
+  8040a2:	68 59 4f 80 00       	push   $0x804f59
+  8040a7:	e8 b2 c1 ff ff       	call   80025e <cprintf>
+		return r;
+  8040ac:	83 c4 10             	add    $0x10,%esp
+  8040af:	eb 02                	jmp    8040b3 <fork+0x1f3>
+  8040b1:	89 c7                	mov    %eax,%edi
+}
+  8040b3:	89 f8                	mov    %edi,%eax
+  8040b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8040b8:	5b                   	pop    %ebx
+  8040b9:	5e                   	pop    %esi
+  8040ba:	5f                   	pop    %edi
+  8040bb:	5d                   	pop    %ebp
+  8040bc:	c3                   	ret
+
+008040bd <sfork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+sfork(void)
+{
+  8040bd:	55                   	push   %ebp
+  8040be:	89 e5                	mov    %esp,%ebp
+  8040c0:	57                   	push   %edi
+  8040c1:	56                   	push   %esi
+  8040c2:	53                   	push   %ebx
+  8040c3:	83 ec 2c             	sub    $0x2c,%esp
+  8040c6:	89 e0                	mov    %esp,%eax
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8040c8:	8d 90 00 20 60 11    	lea    0x11602000(%eax),%edx
+		return 0;
+  8040ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8040d3:	81 fa ff ff 1f 00    	cmp    $0x1fffff,%edx
+  8040d9:	77 0a                	ja     8040e5 <sfork+0x28>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8040db:	bb ff df bf ee       	mov    $0xeebfdfff,%ebx
+  8040e0:	29 c3                	sub    %eax,%ebx
+  8040e2:	c1 eb 10             	shr    $0x10,%ebx
+	pthread_t self = pthread_self();
+	int r;
+	envid_t eid;
+	set_pgfault_handler(pgfault);
+  8040e5:	83 ec 0c             	sub    $0xc,%esp
+  8040e8:	68 23 3e 80 00       	push   $0x803e23
+  8040ed:	e8 f1 03 00 00       	call   8044e3 <set_pgfault_handler>
+  8040f2:	b8 07 00 00 00       	mov    $0x7,%eax
+  8040f7:	cd 30                	int    $0x30
+  8040f9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	eid = sys_exofork();
+	if (eid < 0) {
+  8040fc:	83 c4 10             	add    $0x10,%esp
+  8040ff:	85 c0                	test   %eax,%eax
+  804101:	78 30                	js     804133 <sfork+0x76>
+		cprintf("fork failed, %e", eid);
+		return eid;
+	}
+	// child
+	if (eid == 0) {
+  804103:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  804107:	74 42                	je     80414b <sfork+0x8e>
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  804109:	c1 e3 10             	shl    $0x10,%ebx
+  80410c:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  804111:	29 d8                	sub    %ebx,%eax
+  804113:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  804116:	b8 00 e0 be ee       	mov    $0xeebee000,%eax
+  80411b:	29 d8                	sub    %ebx,%eax
+  80411d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  804120:	be 00 04 00 00       	mov    $0x400,%esi
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return eid;
+	}
+
+	// parent
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  804125:	ba 00 00 00 00       	mov    $0x0,%edx
+  80412a:	89 f7                	mov    %esi,%edi
+  80412c:	89 d6                	mov    %edx,%esi
+  80412e:	e9 2c 01 00 00       	jmp    80425f <sfork+0x1a2>
+		cprintf("fork failed, %e", eid);
+  804133:	83 ec 08             	sub    $0x8,%esp
+  804136:	89 c7                	mov    %eax,%edi
+  804138:	50                   	push   %eax
+  804139:	68 49 4f 80 00       	push   $0x804f49
+  80413e:	e8 1b c1 ff ff       	call   80025e <cprintf>
+		return eid;
+  804143:	83 c4 10             	add    $0x10,%esp
+  804146:	e9 d5 00 00 00       	jmp    804220 <sfork+0x163>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80414b:	e8 d8 ca ff ff       	call   800c28 <sys_getenvid>
+  804150:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804155:	89 c2                	mov    %eax,%edx
+  804157:	89 e1                	mov    %esp,%ecx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  804159:	8d 81 00 20 60 11    	lea    0x11602000(%ecx),%eax
+  80415f:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804164:	77 18                	ja     80417e <sfork+0xc1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804166:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80416b:	29 c8                	sub    %ecx,%eax
+	if (t == 0)
+  80416d:	c1 e8 10             	shr    $0x10,%eax
+  804170:	74 0c                	je     80417e <sfork+0xc1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804172:	c1 e0 10             	shl    $0x10,%eax
+  804175:	b9 fc bf bf ee       	mov    $0xeebfbffc,%ecx
+  80417a:	29 c1                	sub    %eax,%ecx
+  80417c:	eb 06                	jmp    804184 <sfork+0xc7>
+		return pthread_main_tls;
+  80417e:	8b 0d c0 62 80 00    	mov    0x8062c0,%ecx
+  804184:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804187:	c1 e0 04             	shl    $0x4,%eax
+  80418a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80418f:	89 01                	mov    %eax,(%ecx)
+		return eid;
+  804191:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  804194:	e9 87 00 00 00       	jmp    804220 <sfork+0x163>
+				continue;
+			// the child gets its own user exception stack
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+				continue;
+			}
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  804199:	f6 c5 04             	test   $0x4,%ch
+  80419c:	74 6c                	je     80420a <sfork+0x14d>
+				}
+				continue;
+			}
+			// a page still copy-on-write from an earlier fork would
+			// come apart at the first write; take our own copy first
+			if ((pte & PTE_COW) && !(pte & PTE_SHARE)) {
+  80419e:	89 ca                	mov    %ecx,%edx
+  8041a0:	81 e2 00 0c 00 00    	and    $0xc00,%edx
+  8041a6:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+  8041ac:	74 7c                	je     80422a <sfork+0x16d>
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+					return r;
+				}
+				pte = uvpt[pn];
+			}
+			if ((r = duppage(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  8041ae:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  8041b4:	89 da                	mov    %ebx,%edx
+  8041b6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8041b9:	e8 67 fb ff ff       	call   803d25 <duppage>
+  8041be:	85 c0                	test   %eax,%eax
+  8041c0:	0f 88 4f 01 00 00    	js     804315 <sfork+0x258>
+		for (int pteno = 0; pteno < entry_num; ++pteno) {
+  8041c6:	83 c3 01             	add    $0x1,%ebx
+  8041c9:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  8041cc:	74 7a                	je     804248 <sfork+0x18b>
+			int pn = pdeno * NPDENTRIES + pteno;
+  8041ce:	89 de                	mov    %ebx,%esi
+			pte_t pte = uvpt[pn];
+  8041d0:	8b 0c 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%ecx
+			if (pn == ((UXSTACKTOP - PGSIZE) >> PGSHIFT)) {
+  8041d7:	f6 c1 01             	test   $0x1,%cl
+  8041da:	74 ea                	je     8041c6 <sfork+0x109>
+  8041dc:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8041e2:	74 e2                	je     8041c6 <sfork+0x109>
+	return (va < USTACKTOP && va >= USTACKTOP - PTHREAD_SLOT)
+  8041e4:	8d 83 12 14 01 00    	lea    0x11412(%ebx),%eax
+  8041ea:	c1 e0 0c             	shl    $0xc,%eax
+		|| (va < PTHREAD_TOP(t) && va >= PTHREAD_TOP(t) - PTHREAD_SLOT);
+  8041ed:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  8041f2:	76 a5                	jbe    804199 <sfork+0xdc>
+  8041f4:	8d 90 00 e0 be ee    	lea    -0x11412000(%eax),%edx
+  8041fa:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8041fd:	39 fa                	cmp    %edi,%edx
+  8041ff:	73 9d                	jae    80419e <sfork+0xe1>
+			if (sfork_stack(pn, self) && !(pte & PTE_SHARE)) {
+  804201:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  804204:	39 fa                	cmp    %edi,%edx
+  804206:	72 96                	jb     80419e <sfork+0xe1>
+  804208:	eb 8f                	jmp    804199 <sfork+0xdc>
+				if ((r = duppage_cow(eid, pn, pte & PTE_SYSCALL)) < 0) {
+  80420a:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+  804210:	89 da                	mov    %ebx,%edx
+  804212:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804215:	e8 8c fa ff ff       	call   803ca6 <duppage_cow>
+  80421a:	85 c0                	test   %eax,%eax
+  80421c:	79 a8                	jns    8041c6 <sfork+0x109>
+  80421e:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+		cprintf("set child status failed, %e.\n", r);
+		return r;
+	}
+	return eid;
+}
+  804220:	89 f8                	mov    %edi,%eax
+  804222:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804225:	5b                   	pop    %ebx
+  804226:	5e                   	pop    %esi
+  804227:	5f                   	pop    %edi
+  804228:	5d                   	pop    %ebp
+  804229:	c3                   	ret
+				if ((r = cow_copy(pn << PGSHIFT)) < 0) {
+  80422a:	2d 00 20 41 11       	sub    $0x11412000,%eax
+  80422f:	e8 2e fb ff ff       	call   803d62 <cow_copy>
+  804234:	85 c0                	test   %eax,%eax
+  804236:	0f 88 d2 00 00 00    	js     80430e <sfork+0x251>
+				pte = uvpt[pn];
+  80423c:	8b 0c b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%ecx
+  804243:	e9 66 ff ff ff       	jmp    8041ae <sfork+0xf1>
+  804248:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80424b:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	for (int pdeno = 0; pdeno <= PDX(UTOP-1); ++pdeno) {
+  80424e:	83 c6 01             	add    $0x1,%esi
+  804251:	81 c7 00 04 00 00    	add    $0x400,%edi
+  804257:	81 fe bb 03 00 00    	cmp    $0x3bb,%esi
+  80425d:	74 1b                	je     80427a <sfork+0x1bd>
+		if (!(uvpd[pdeno] & PTE_P))
+  80425f:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  804266:	a8 01                	test   $0x1,%al
+  804268:	74 e4                	je     80424e <sfork+0x191>
+  80426a:	89 f3                	mov    %esi,%ebx
+  80426c:	c1 e3 0a             	shl    $0xa,%ebx
+  80426f:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  804272:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  804275:	e9 4f ff ff ff       	jmp    8041c9 <sfork+0x10c>
+	r = sys_page_alloc(eid, (void*)(UXSTACKTOP -PGSIZE), PTE_P | PTE_U | PTE_W);
+  80427a:	83 ec 04             	sub    $0x4,%esp
+  80427d:	6a 07                	push   $0x7
+  80427f:	68 00 f0 bf ee       	push   $0xeebff000
+  804284:	ff 75 e0             	push   -0x20(%ebp)
+  804287:	e8 f4 c9 ff ff       	call   800c80 <sys_page_alloc>
+  80428c:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  80428e:	83 c4 10             	add    $0x10,%esp
+  804291:	85 c0                	test   %eax,%eax
+  804293:	78 37                	js     8042cc <sfork+0x20f>
+	r = sys_env_set_pgfault_upcall(eid, _pgfault_upcall);
+  804295:	83 ec 08             	sub    $0x8,%esp
+  804298:	68 21 45 80 00       	push   $0x804521
+  80429d:	ff 75 e0             	push   -0x20(%ebp)
+  8042a0:	e8 58 cb ff ff       	call   800dfd <sys_env_set_pgfault_upcall>
+  8042a5:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8042a7:	83 c4 10             	add    $0x10,%esp
+  8042aa:	85 c0                	test   %eax,%eax
+  8042ac:	78 34                	js     8042e2 <sfork+0x225>
+	r = sys_env_set_status(eid, ENV_RUNNABLE);
+  8042ae:	83 ec 08             	sub    $0x8,%esp
+  8042b1:	6a 02                	push   $0x2
+  8042b3:	ff 75 e0             	push   -0x20(%ebp)
+  8042b6:	e8 aa ca ff ff       	call   800d65 <sys_env_set_status>
+  8042bb:	89 c7                	mov    %eax,%edi
+	if (r < 0) {
+  8042bd:	83 c4 10             	add    $0x10,%esp
+  8042c0:	85 c0                	test   %eax,%eax
+  8042c2:	78 34                	js     8042f8 <sfork+0x23b>
+	return eid;
+  8042c4:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8042c7:	e9 54 ff ff ff       	jmp    804220 <sfork+0x163>
+		cprintf("map user exception stack failed, %e.\n", r);
+  8042cc:	83 ec 08             	sub    $0x8,%esp
+  8042cf:	50                   	push   %eax
+  8042d0:	68 bc 4e 80 00       	push   $0x804ebc
+  8042d5:	e8 84 bf ff ff       	call   80025e <cprintf>
+		return r;
+  8042da:	83 c4 10             	add    $0x10,%esp
+  8042dd:	e9 3e ff ff ff       	jmp    804220 <sfork+0x163>
+		cprintf("env set pgfault upcall failed, %e.\n", r);
+  8042e2:	83 ec 08             	sub    $0x8,%esp
+  8042e5:	50                   	push   %eax
+  8042e6:	68 e4 4e 80 00       	push   $0x804ee4
+  8042eb:	e8 6e bf ff ff       	call   80025e <cprintf>
+		return r;
+  8042f0:	83 c4 10             	add    $0x10,%esp
+  8042f3:	e9 28 ff ff ff       	jmp    804220 <sfork+0x163>
+		cprintf("set child status failed, %e.\n", r);
+  8042f8:	83 ec 08             	sub    $0x8,%esp
+  8042fb:	50                   	push   %eax
+  8042fc:	68 59 4f 80 00       	push   $0x804f59
+  804301:	e8 58 bf ff ff       	call   80025e <cprintf>
+		return r;
+  804306:	83 c4 10             	add    $0x10,%esp
+  804309:	e9 12 ff ff ff       	jmp    804220 <sfork+0x163>
+  80430e:	89 c7                	mov    %eax,%edi
+  804310:	e9 0b ff ff ff       	jmp    804220 <sfork+0x163>
+  804315:	89 c7                	mov    %eax,%edi
+  804317:	e9 04 ff ff ff       	jmp    804220 <sfork+0x163>
+
+0080431c <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80431c:	55                   	push   %ebp
+  80431d:	89 e5                	mov    %esp,%ebp
+  80431f:	57                   	push   %edi
+  804320:	56                   	push   %esi
+  804321:	53                   	push   %ebx
+  804322:	83 ec 18             	sub    $0x18,%esp
+  804325:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804328:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80432b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  80432e:	85 c0                	test   %eax,%eax
+  804330:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804335:	0f 44 c2             	cmove  %edx,%eax
+	}
+	r = sys_ipc_recv(pg);
+  804338:	50                   	push   %eax
+  804339:	e8 38 cb ff ff       	call   800e76 <sys_ipc_recv>
+	if (r < 0) {
+  80433e:	83 c4 10             	add    $0x10,%esp
+  804341:	85 c0                	test   %eax,%eax
+  804343:	78 2b                	js     804370 <ipc_recv+0x54>
+		cprintf("sys_ipc_recv failed, %e\n", r);
+		*from_env_store = 0;
+		*perm_store = 0;
+		return r;
+	}
+	if (from_env_store) {
+  804345:	85 ff                	test   %edi,%edi
+  804347:	74 55                	je     80439e <ipc_recv+0x82>
+  804349:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  80434b:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  804351:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  804356:	77 39                	ja     804391 <ipc_recv+0x75>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  804358:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  80435d:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  80435f:	c1 e8 10             	shr    $0x10,%eax
+  804362:	74 2d                	je     804391 <ipc_recv+0x75>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  804364:	c1 e0 10             	shl    $0x10,%eax
+  804367:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  80436c:	29 c2                	sub    %eax,%edx
+  80436e:	eb 27                	jmp    804397 <ipc_recv+0x7b>
+  804370:	89 c3                	mov    %eax,%ebx
+		cprintf("sys_ipc_recv failed, %e\n", r);
+  804372:	83 ec 08             	sub    $0x8,%esp
+  804375:	50                   	push   %eax
+  804376:	68 77 4f 80 00       	push   $0x804f77
+  80437b:	e8 de be ff ff       	call   80025e <cprintf>
+		*from_env_store = 0;
+  804380:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		*perm_store = 0;
+  804386:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		return r;
+  80438c:	83 c4 10             	add    $0x10,%esp
+  80438f:	eb 77                	jmp    804408 <ipc_recv+0xec>
+		return pthread_main_tls;
+  804391:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		*from_env_store = thisenv->env_ipc_from;
+  804397:	8b 02                	mov    (%edx),%eax
+  804399:	8b 40 78             	mov    0x78(%eax),%eax
+  80439c:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  80439e:	85 f6                	test   %esi,%esi
+  8043a0:	74 34                	je     8043d6 <ipc_recv+0xba>
+  8043a2:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8043a4:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8043aa:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8043af:	77 18                	ja     8043c9 <ipc_recv+0xad>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8043b1:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8043b6:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8043b8:	c1 e8 10             	shr    $0x10,%eax
+  8043bb:	74 0c                	je     8043c9 <ipc_recv+0xad>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8043bd:	c1 e0 10             	shl    $0x10,%eax
+  8043c0:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8043c5:	29 c2                	sub    %eax,%edx
+  8043c7:	eb 06                	jmp    8043cf <ipc_recv+0xb3>
+		return pthread_main_tls;
+  8043c9:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+		*perm_store = thisenv->env_ipc_perm;
+  8043cf:	8b 02                	mov    (%edx),%eax
+  8043d1:	8b 40 7c             	mov    0x7c(%eax),%eax
+  8043d4:	89 06                	mov    %eax,(%esi)
+  8043d6:	89 e2                	mov    %esp,%edx
+	if (esp >= USTACKTOP || esp < PTHREAD_BASE)
+  8043d8:	8d 82 00 20 60 11    	lea    0x11602000(%edx),%eax
+  8043de:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+  8043e3:	77 18                	ja     8043fd <ipc_recv+0xe1>
+	return (USTACKTOP - 1 - esp) / PTHREAD_SLOT;
+  8043e5:	b8 ff df bf ee       	mov    $0xeebfdfff,%eax
+  8043ea:	29 d0                	sub    %edx,%eax
+	if (t == 0)
+  8043ec:	c1 e8 10             	shr    $0x10,%eax
+  8043ef:	74 0c                	je     8043fd <ipc_recv+0xe1>
+	return (struct pthread_tls *) (PTHREAD_TOP(t) - 2 * PGSIZE) - 1;
+  8043f1:	c1 e0 10             	shl    $0x10,%eax
+  8043f4:	ba fc bf bf ee       	mov    $0xeebfbffc,%edx
+  8043f9:	29 c2                	sub    %eax,%edx
+  8043fb:	eb 06                	jmp    804403 <ipc_recv+0xe7>
+		return pthread_main_tls;
+  8043fd:	8b 15 c0 62 80 00    	mov    0x8062c0,%edx
+	}
+	return thisenv->env_ipc_value;
+  804403:	8b 02                	mov    (%edx),%eax
+  804405:	8b 58 74             	mov    0x74(%eax),%ebx
+}
+  804408:	89 d8                	mov    %ebx,%eax
+  80440a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80440d:	5b                   	pop    %ebx
+  80440e:	5e                   	pop    %esi
+  80440f:	5f                   	pop    %edi
+  804410:	5d                   	pop    %ebp
+  804411:	c3                   	ret
+
+00804412 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  804412:	55                   	push   %ebp
+  804413:	89 e5                	mov    %esp,%ebp
+  804415:	57                   	push   %edi
+  804416:	56                   	push   %esi
+  804417:	53                   	push   %ebx
+  804418:	83 ec 0c             	sub    $0xc,%esp
+  80441b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80441e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804421:	8b 7d 14             	mov    0x14(%ebp),%edi
+	int r;
+	if (pg == NULL) {
+		pg = (void*)UTOP;
+  804424:	85 db                	test   %ebx,%ebx
+  804426:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80442b:	0f 44 d8             	cmove  %eax,%ebx
+  80442e:	eb 05                	jmp    804435 <ipc_send+0x23>
+	while (true) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+		if (r == 0) {
+			break;
+		} else if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  804430:	e8 1f c8 ff ff       	call   800c54 <sys_yield>
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  804435:	57                   	push   %edi
+  804436:	53                   	push   %ebx
+  804437:	ff 75 0c             	push   0xc(%ebp)
+  80443a:	56                   	push   %esi
+  80443b:	e8 09 ca ff ff       	call   800e49 <sys_ipc_try_send>
+		if (r == 0) {
+  804440:	83 c4 10             	add    $0x10,%esp
+  804443:	85 c0                	test   %eax,%eax
+  804445:	74 19                	je     804460 <ipc_send+0x4e>
+		} else if (r == -E_IPC_NOT_RECV) {
+  804447:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80444a:	74 e4                	je     804430 <ipc_send+0x1e>
+		} else {
+			cprintf("send failed, eid: 0x%x, pg: %d, perm: 0x%x, err: %e \n", to_env, pg, perm, r);
+  80444c:	83 ec 0c             	sub    $0xc,%esp
+  80444f:	50                   	push   %eax
+  804450:	57                   	push   %edi
+  804451:	53                   	push   %ebx
+  804452:	56                   	push   %esi
+  804453:	68 90 4f 80 00       	push   $0x804f90
+  804458:	e8 01 be ff ff       	call   80025e <cprintf>
+			return;
+  80445d:	83 c4 20             	add    $0x20,%esp
+		}
+	}
+}
+  804460:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804463:	5b                   	pop    %ebx
+  804464:	5e                   	pop    %esi
+  804465:	5f                   	pop    %edi
+  804466:	5d                   	pop    %ebp
+  804467:	c3                   	ret
+
+00804468 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804468:	55                   	push   %ebp
+  804469:	89 e5                	mov    %esp,%ebp
+  80446b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80446e:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  804473:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804476:	c1 e0 04             	shl    $0x4,%eax
+  804479:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80447e:	8b 40 50             	mov    0x50(%eax),%eax
+  804481:	39 c8                	cmp    %ecx,%eax
+  804483:	74 12                	je     804497 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804485:	83 c2 01             	add    $0x1,%edx
+  804488:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  80448e:	75 e3                	jne    804473 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  804490:	b8 00 00 00 00       	mov    $0x0,%eax
+  804495:	eb 0e                	jmp    8044a5 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  804497:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80449a:	c1 e0 04             	shl    $0x4,%eax
+  80449d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8044a2:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8044a5:	5d                   	pop    %ebp
+  8044a6:	c3                   	ret
+
+008044a7 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8044a7:	55                   	push   %ebp
+  8044a8:	89 e5                	mov    %esp,%ebp
+  8044aa:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8044ad:	89 c2                	mov    %eax,%edx
+  8044af:	c1 ea 16             	shr    $0x16,%edx
+  8044b2:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8044b9:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8044be:	f6 c1 01             	test   $0x1,%cl
+  8044c1:	74 1c                	je     8044df <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  8044c3:	c1 e8 0c             	shr    $0xc,%eax
+  8044c6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8044cd:	a8 01                	test   $0x1,%al
+  8044cf:	74 0e                	je     8044df <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8044d1:	c1 e8 0c             	shr    $0xc,%eax
+  8044d4:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  8044db:	ef 
+  8044dc:	0f b7 d2             	movzwl %dx,%edx
+}
+  8044df:	89 d0                	mov    %edx,%eax
+  8044e1:	5d                   	pop    %ebp
+  8044e2:	c3                   	ret
+
+008044e3 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8044e3:	55                   	push   %ebp
+  8044e4:	89 e5                	mov    %esp,%ebp
+  8044e6:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  8044e9:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  8044f0:	74 0a                	je     8044fc <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8044f2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8044f5:	a3 00 90 80 00       	mov    %eax,0x809000
+}
+  8044fa:	c9                   	leave
+  8044fb:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U | PTE_W | PTE_P);
+  8044fc:	83 ec 04             	sub    $0x4,%esp
+  8044ff:	6a 07                	push   $0x7
+  804501:	68 00 f0 bf ee       	push   $0xeebff000
+  804506:	6a 00                	push   $0x0
+  804508:	e8 73 c7 ff ff       	call   800c80 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  80450d:	83 c4 08             	add    $0x8,%esp
+  804510:	68 21 45 80 00       	push   $0x804521
+  804515:	6a 00                	push   $0x0
+  804517:	e8 e1 c8 ff ff       	call   800dfd <sys_env_set_pgfault_upcall>
+  80451c:	83 c4 10             	add    $0x10,%esp
+  80451f:	eb d1                	jmp    8044f2 <set_pgfault_handler+0xf>
+
+00804521 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804521:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804522:	a1 00 90 80 00       	mov    0x809000,%eax
+	call *%eax
+  804527:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804529:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// get eip
+	movl 0x28(%esp), %eax
+  80452c:	8b 44 24 28          	mov    0x28(%esp),%eax
+	// get esp
+	movl 0x30(%esp), %ebx
+  804530:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+	subl $4, %ebx
+  804534:	83 eb 04             	sub    $0x4,%ebx
+	movl %ebx, 0x30(%esp)
+  804537:	89 5c 24 30          	mov    %ebx,0x30(%esp)
+	movl %eax, (%ebx)
+  80453b:	89 03                	mov    %eax,(%ebx)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	addl $8, %esp
+  80453d:	83 c4 08             	add    $0x8,%esp
+	popal
+  804540:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	addl $4, %esp
+  804541:	83 c4 04             	add    $0x4,%esp
+	popfl
+  804544:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	popl %esp
+  804545:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	ret
+  804546:	c3                   	ret
+
+00804547 <udm>:
+  804547:	57                   	push   %edi
+  804548:	56                   	push   %esi
+  804549:	53                   	push   %ebx
+  80454a:	83 ec 20             	sub    $0x20,%esp
+  80454d:	89 44 24 10          	mov    %eax,0x10(%esp)
+  804551:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804555:	8b 44 24 30          	mov    0x30(%esp),%eax
+  804559:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80455d:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804561:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804565:	89 d1                	mov    %edx,%ecx
+  804567:	09 c1                	or     %eax,%ecx
+  804569:	0f 84 91 00 00 00    	je     804600 <udm+0xb9>
+  80456f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804574:	ba 00 00 00 00       	mov    $0x0,%edx
+  804579:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80457e:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804585:	00 
+  804586:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80458d:	00 
+  80458e:	eb 08                	jmp    804598 <udm+0x51>
+  804590:	83 e9 01             	sub    $0x1,%ecx
+  804593:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  804596:	74 7c                	je     804614 <udm+0xcd>
+  804598:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80459c:	01 c0                	add    %eax,%eax
+  80459e:	89 c6                	mov    %eax,%esi
+  8045a0:	89 d7                	mov    %edx,%edi
+  8045a2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8045a6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8045aa:	0f ad d0             	shrd   %cl,%edx,%eax
+  8045ad:	d3 ea                	shr    %cl,%edx
+  8045af:	f6 c1 20             	test   $0x20,%cl
+  8045b2:	74 04                	je     8045b8 <udm+0x71>
+  8045b4:	89 d0                	mov    %edx,%eax
+  8045b6:	31 d2                	xor    %edx,%edx
+  8045b8:	83 e0 01             	and    $0x1,%eax
+  8045bb:	89 04 24             	mov    %eax,(%esp)
+  8045be:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8045c5:	00 
+  8045c6:	8b 04 24             	mov    (%esp),%eax
+  8045c9:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8045cd:	09 f0                	or     %esi,%eax
+  8045cf:	09 fa                	or     %edi,%edx
+  8045d1:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8045d5:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8045d9:	39 f0                	cmp    %esi,%eax
+  8045db:	89 d3                	mov    %edx,%ebx
+  8045dd:	19 fb                	sbb    %edi,%ebx
+  8045df:	72 af                	jb     804590 <udm+0x49>
+  8045e1:	29 f0                	sub    %esi,%eax
+  8045e3:	19 fa                	sbb    %edi,%edx
+  8045e5:	89 cf                	mov    %ecx,%edi
+  8045e7:	c1 ef 05             	shr    $0x5,%edi
+  8045ea:	83 e7 01             	and    $0x1,%edi
+  8045ed:	89 fe                	mov    %edi,%esi
+  8045ef:	83 f6 01             	xor    $0x1,%esi
+  8045f2:	d3 e6                	shl    %cl,%esi
+  8045f4:	d3 e7                	shl    %cl,%edi
+  8045f6:	09 74 24 18          	or     %esi,0x18(%esp)
+  8045fa:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8045fe:	eb 90                	jmp    804590 <udm+0x49>
+  804600:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804604:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  804608:	89 f0                	mov    %esi,%eax
+  80460a:	89 fa                	mov    %edi,%edx
+  80460c:	89 74 24 18          	mov    %esi,0x18(%esp)
+  804610:	89 7c 24 1c          	mov    %edi,0x1c(%esp)
+  804614:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  804618:	89 01                	mov    %eax,(%ecx)
+  80461a:	89 51 04             	mov    %edx,0x4(%ecx)
+  80461d:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804621:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804625:	83 c4 20             	add    $0x20,%esp
+  804628:	5b                   	pop    %ebx
+  804629:	5e                   	pop    %esi
+  80462a:	5f                   	pop    %edi
+  80462b:	c3                   	ret
+
+0080462c <__udivdi3>:
+  80462c:	83 ec 18             	sub    $0x18,%esp
+  80462f:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804633:	50                   	push   %eax
+  804634:	ff 74 24 2c          	push   0x2c(%esp)
+  804638:	ff 74 24 2c          	push   0x2c(%esp)
+  80463c:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804640:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804644:	e8 fe fe ff ff       	call   804547 <udm>
+  804649:	83 c4 24             	add    $0x24,%esp
+  80464c:	c3                   	ret
+
+0080464d <__umoddi3>:
+  80464d:	83 ec 18             	sub    $0x18,%esp
+  804650:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804654:	50                   	push   %eax
+  804655:	ff 74 24 2c          	push   0x2c(%esp)
+  804659:	ff 74 24 2c          	push   0x2c(%esp)
+  80465d:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804661:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804665:	e8 dd fe ff ff       	call   804547 <udm>
+  80466a:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80466e:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804672:	83 c4 24             	add    $0x24,%esp
+  804675:	c3                   	ret
+
+00804676 <__divdi3>:
+  804676:	56                   	push   %esi
+  804677:	53                   	push   %ebx
+  804678:	83 ec 14             	sub    $0x14,%esp
+  80467b:	8b 44 24 20          	mov    0x20(%esp),%eax
+  80467f:	8b 54 24 24          	mov    0x24(%esp),%edx
+  804683:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  804687:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  80468b:	85 d2                	test   %edx,%edx
+  80468d:	78 18                	js     8046a7 <__divdi3+0x31>
+  80468f:	85 db                	test   %ebx,%ebx
+  804691:	78 3e                	js     8046d1 <__divdi3+0x5b>
+  804693:	83 ec 04             	sub    $0x4,%esp
+  804696:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80469a:	56                   	push   %esi
+  80469b:	53                   	push   %ebx
+  80469c:	51                   	push   %ecx
+  80469d:	e8 a5 fe ff ff       	call   804547 <udm>
+  8046a2:	83 c4 10             	add    $0x10,%esp
+  8046a5:	eb 24                	jmp    8046cb <__divdi3+0x55>
+  8046a7:	f7 d8                	neg    %eax
+  8046a9:	83 d2 00             	adc    $0x0,%edx
+  8046ac:	f7 da                	neg    %edx
+  8046ae:	85 db                	test   %ebx,%ebx
+  8046b0:	78 3a                	js     8046ec <__divdi3+0x76>
+  8046b2:	83 ec 04             	sub    $0x4,%esp
+  8046b5:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8046b9:	56                   	push   %esi
+  8046ba:	53                   	push   %ebx
+  8046bb:	51                   	push   %ecx
+  8046bc:	e8 86 fe ff ff       	call   804547 <udm>
+  8046c1:	83 c4 10             	add    $0x10,%esp
+  8046c4:	f7 d8                	neg    %eax
+  8046c6:	83 d2 00             	adc    $0x0,%edx
+  8046c9:	f7 da                	neg    %edx
+  8046cb:	83 c4 14             	add    $0x14,%esp
+  8046ce:	5b                   	pop    %ebx
+  8046cf:	5e                   	pop    %esi
+  8046d0:	c3                   	ret
+  8046d1:	83 ec 04             	sub    $0x4,%esp
+  8046d4:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8046d8:	56                   	push   %esi
+  8046d9:	f7 d9                	neg    %ecx
+  8046db:	83 d3 00             	adc    $0x0,%ebx
+  8046de:	f7 db                	neg    %ebx
+  8046e0:	53                   	push   %ebx
+  8046e1:	51                   	push   %ecx
+  8046e2:	e8 60 fe ff ff       	call   804547 <udm>
+  8046e7:	83 c4 10             	add    $0x10,%esp
+  8046ea:	eb d8                	jmp    8046c4 <__divdi3+0x4e>
+  8046ec:	83 ec 04             	sub    $0x4,%esp
+  8046ef:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8046f3:	56                   	push   %esi
+  8046f4:	f7 d9                	neg    %ecx
+  8046f6:	83 d3 00             	adc    $0x0,%ebx
+  8046f9:	f7 db                	neg    %ebx
+  8046fb:	53                   	push   %ebx
+  8046fc:	51                   	push   %ecx
+  8046fd:	e8 45 fe ff ff       	call   804547 <udm>
+  804702:	83 c4 10             	add    $0x10,%esp
+  804705:	eb c4                	jmp    8046cb <__divdi3+0x55>
+
+00804707 <__moddi3>:
+  804707:	55                   	push   %ebp
+  804708:	57                   	push   %edi
+  804709:	56                   	push   %esi
+  80470a:	53                   	push   %ebx
+  80470b:	83 ec 24             	sub    $0x24,%esp
+  80470e:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804712:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804716:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  80471a:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  80471e:	85 d2                	test   %edx,%edx
+  804720:	78 3b                	js     80475d <__moddi3+0x56>
+  804722:	83 ec 04             	sub    $0x4,%esp
+  804725:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804729:	56                   	push   %esi
+  80472a:	89 ce                	mov    %ecx,%esi
+  80472c:	f7 de                	neg    %esi
+  80472e:	89 74 24 08          	mov    %esi,0x8(%esp)
+  804732:	89 de                	mov    %ebx,%esi
+  804734:	83 d6 00             	adc    $0x0,%esi
+  804737:	f7 de                	neg    %esi
+  804739:	89 74 24 14          	mov    %esi,0x14(%esp)
+  80473d:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804741:	0f 48 f1             	cmovs  %ecx,%esi
+  804744:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  804749:	53                   	push   %ebx
+  80474a:	56                   	push   %esi
+  80474b:	e8 f7 fd ff ff       	call   804547 <udm>
+  804750:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804754:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804758:	83 c4 10             	add    $0x10,%esp
+  80475b:	eb 47                	jmp    8047a4 <__moddi3+0x9d>
+  80475d:	f7 d8                	neg    %eax
+  80475f:	83 d2 00             	adc    $0x0,%edx
+  804762:	f7 da                	neg    %edx
+  804764:	83 ec 04             	sub    $0x4,%esp
+  804767:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80476b:	56                   	push   %esi
+  80476c:	89 cf                	mov    %ecx,%edi
+  80476e:	f7 df                	neg    %edi
+  804770:	89 de                	mov    %ebx,%esi
+  804772:	83 d6 00             	adc    $0x0,%esi
+  804775:	f7 de                	neg    %esi
+  804777:	0f 49 cf             	cmovns %edi,%ecx
+  80477a:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  80477e:	0f 49 de             	cmovns %esi,%ebx
+  804781:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  804785:	ff 74 24 0c          	push   0xc(%esp)
+  804789:	ff 74 24 0c          	push   0xc(%esp)
+  80478d:	e8 b5 fd ff ff       	call   804547 <udm>
+  804792:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804796:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80479a:	f7 d8                	neg    %eax
+  80479c:	83 d2 00             	adc    $0x0,%edx
+  80479f:	f7 da                	neg    %edx
+  8047a1:	83 c4 10             	add    $0x10,%esp
+  8047a4:	83 c4 24             	add    $0x24,%esp
+  8047a7:	5b                   	pop    %ebx
+  8047a8:	5e                   	pop    %esi
+  8047a9:	5f                   	pop    %edi
+  8047aa:	5d                   	pop    %ebp
+  8047ab:	c3                   	ret
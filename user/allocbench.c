@@ -0,0 +1,63 @@
+// Stress the file server's block allocator: grow several files side by
+// side one block at a time, so that every write allocates, then free
+// everything and do it again.  The last round preallocates the files
+// with fallocate first.
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NFILES		4
+#define FILEBLOCKS	64
+#define NROUNDS		4
+
+static char buf[BLKSIZE];
+
+void
+umain(int argc, char **argv)
+{
+	char path[MAXNAMELEN];
+	struct BcStat before, after;
+	int fd[NFILES];
+	uint64_t tsc;
+	unsigned start;
+	int round, i, j, r;
+
+	for (i = 0; i < NFILES; i++) {
+		snprintf(path, sizeof path, "/allocbench%d", i);
+		if ((fd[i] = open(path, O_RDWR|O_CREAT|O_TRUNC)) < 0)
+			panic("open %s: %e", path, fd[i]);
+	}
+	memset(buf, 0xa5, sizeof buf);
+
+	for (round = 0; round <= NROUNDS; round++) {
+		fs_bcstat(0, &before);
+		start = sys_time_msec();
+		tsc = read_tsc();
+		for (i = 0; round == NROUNDS && i < NFILES; i++)
+			if ((r = fallocate(fd[i], 0, FILEBLOCKS * BLKSIZE)) < 0)
+				panic("fallocate: %e", r);
+		for (j = 0; j < FILEBLOCKS; j++)
+			for (i = 0; i < NFILES; i++)
+				if ((r = write(fd[i], buf, sizeof buf)) != sizeof buf)
+					panic("write: %e", r);
+		if ((r = sync()) < 0)
+			panic("sync: %e", r);
+		fs_bcstat(0, &after);
+		cprintf("round %d%s: %d blocks, %d cycles/block, %d ms, "
+			"%d written back in %d writes\n",
+			round, round == NROUNDS ? " (fallocate)" : "",
+			NFILES * FILEBLOCKS,
+			(uint32_t) ((read_tsc() - tsc) / (NFILES * FILEBLOCKS)),
+			sys_time_msec() - start,
+			after.bs_writebacks - before.bs_writebacks,
+			after.bs_writes - before.bs_writes);
+
+		for (i = 0; i < NFILES; i++) {
+			if ((r = ftruncate(fd[i], 0)) < 0)
+				panic("ftruncate: %e", r);
+			seek(fd[i], 0);
+		}
+	}
+	for (i = 0; i < NFILES; i++)
+		close(fd[i]);
+}
@@ -0,0 +1,54 @@
+// Create many files in one directory, then look each of them up again,
+// to measure directory lookup cost as the directory grows.
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NFILES	10000
+
+static void
+report(const char *what, int n, uint64_t cycles, unsigned msec)
+{
+	cprintf("%s: %d files, %d cycles/file, %d ms\n",
+		what, n, (uint32_t) (cycles / n), msec);
+}
+
+void
+umain(int argc, char **argv)
+{
+	char path[MAXNAMELEN];
+	uint64_t tsc;
+	unsigned start;
+	int i, n, fd;
+
+	n = argc > 1 ? strtol(argv[1], 0, 0) : NFILES;
+
+	start = sys_time_msec();
+	tsc = read_tsc();
+	for (i = 0; i < n; i++) {
+		snprintf(path, sizeof path, "/dirbench.%d", i);
+		if ((fd = open(path, O_RDWR|O_CREAT|O_EXCL)) < 0)
+			panic("create %s: %e", path, fd);
+		close(fd);
+	}
+	report("create", n, read_tsc() - tsc, sys_time_msec() - start);
+
+	start = sys_time_msec();
+	tsc = read_tsc();
+	for (i = n - 1; i >= 0; i--) {
+		snprintf(path, sizeof path, "/dirbench.%d", i);
+		if ((fd = open(path, O_RDONLY)) < 0)
+			panic("open %s: %e", path, fd);
+		close(fd);
+	}
+	report("lookup", n, read_tsc() - tsc, sys_time_msec() - start);
+
+	start = sys_time_msec();
+	tsc = read_tsc();
+	for (i = 0; i < n; i++) {
+		snprintf(path, sizeof path, "/dirbench.missing.%d", i);
+		if ((fd = open(path, O_RDONLY)) != -E_NOT_FOUND)
+			panic("open %s: got %e", path, fd);
+	}
+	report("miss  ", n, read_tsc() - tsc, sys_time_msec() - start);
+}
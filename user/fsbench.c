@@ -0,0 +1,202 @@
+// Measure file server throughput: write a large file, then read it
+// back sequentially and in a scattered order through a small block
+// cache, so that reads have to go to the disk.  Then read it with
+// several asynchronous reads in flight, with a single large read, and
+// through mmap, which maps the cache pages instead of copying them.
+// Finally report what the file server's I/O queue did with it all.
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define FILENAME	"/fsbench"
+#define FILESIZE	(1024 * 1024)
+#define NBLOCKS		(FILESIZE / BLKSIZE)
+#define COLDCACHE	32		// blocks; smaller than the file
+#define AIODEPTH	8		// asynchronous reads in flight
+
+static char buf[BLKSIZE];
+
+static void
+report(const char *what, uint64_t cycles, unsigned msec,
+       struct BcStat *before, struct BcStat *after)
+{
+	cprintf("%s: %d KB, %d cycles/block, %d ms, "
+		"%d faults, %d blocks read ahead, %d written back in %d writes\n",
+		what, FILESIZE / 1024, (uint32_t) (cycles / NBLOCKS), msec,
+		after->bs_misses - before->bs_misses,
+		after->bs_readahead - before->bs_readahead,
+		after->bs_writebacks - before->bs_writebacks,
+		after->bs_writes - before->bs_writes);
+}
+
+static void
+bench_write(int fd)
+{
+	struct BcStat before, after;
+	uint64_t tsc;
+	unsigned start;
+	int i, r;
+
+	memset(buf, 0x5a, sizeof buf);
+	fs_bcstat(0, &before);
+	start = sys_time_msec();
+	tsc = read_tsc();
+	for (i = 0; i < FILESIZE; i += r)
+		if ((r = write(fd, buf, MIN(sizeof buf, FILESIZE - i))) < 0)
+			panic("write: %e", r);
+	if ((r = sync()) < 0)
+		panic("sync: %e", r);
+	fs_bcstat(0, &after);
+	report("write     ", read_tsc() - tsc, sys_time_msec() - start,
+	       &before, &after);
+}
+
+// Read block order[i] for every i.
+static void
+bench_read(int fd, const char *what, const uint32_t *order)
+{
+	struct BcStat before, after;
+	uint64_t tsc;
+	unsigned start;
+	int i, r;
+
+	fs_bcstat(0, &before);
+	start = sys_time_msec();
+	tsc = read_tsc();
+	for (i = 0; i < NBLOCKS; i++) {
+		seek(fd, order[i] * BLKSIZE);
+		if ((r = readn(fd, buf, BLKSIZE)) != BLKSIZE)
+			panic("read block %d: got %d", order[i], r);
+		if (buf[0] != 0x5a)
+			panic("read block %d: bad data", order[i]);
+	}
+	fs_bcstat(0, &after);
+	report(what, read_tsc() - tsc, sys_time_msec() - start,
+	       &before, &after);
+}
+
+// Read block order[i] for every i, keeping AIODEPTH reads in flight.
+// Each read in flight has a buffer of its own, cleared before the read
+// is issued, so the data check sees what that read brought in.
+static void
+bench_aio(int fd, const char *what, const uint32_t *order)
+{
+	static char bufs[AIODEPTH][BLKSIZE];
+	int slot_of[AIO_MAX], free_slots[AIODEPTH], nfree;
+	struct BcStat before, after;
+	uint64_t tsc;
+	unsigned start;
+	int issued, done, id, slot, r;
+
+	for (nfree = 0; nfree < AIODEPTH; nfree++)
+		free_slots[nfree] = nfree;
+	fs_bcstat(0, &before);
+	start = sys_time_msec();
+	tsc = read_tsc();
+	for (issued = done = 0; done < NBLOCKS; done++) {
+		for (; issued < NBLOCKS && nfree > 0; issued++) {
+			slot = free_slots[--nfree];
+			bufs[slot][0] = bufs[slot][BLKSIZE - 1] = 0;
+			if ((id = aio_read(fd, bufs[slot], BLKSIZE, order[issued] * BLKSIZE)) < 0)
+				panic("aio_read block %d: %e", order[issued], id);
+			slot_of[id] = slot;
+		}
+		if ((r = aio_reap(&id)) != BLKSIZE)
+			panic("aio read: got %d", r);
+		slot = slot_of[id];
+		if (bufs[slot][0] != 0x5a || bufs[slot][BLKSIZE - 1] != 0x5a)
+			panic("aio read: bad data");
+		free_slots[nfree++] = slot;
+	}
+	fs_bcstat(0, &after);
+	report(what, read_tsc() - tsc, sys_time_msec() - start,
+	       &before, &after);
+}
+
+// Read the whole file with one read call.
+static void
+bench_bulk(int fd, const char *what)
+{
+	static char big[FILESIZE];
+	struct BcStat before, after;
+	uint64_t tsc;
+	unsigned start;
+	int i, r;
+
+	fs_bcstat(0, &before);
+	start = sys_time_msec();
+	tsc = read_tsc();
+	seek(fd, 0);
+	if ((r = readn(fd, big, FILESIZE)) != FILESIZE)
+		panic("bulk read: got %d", r);
+	fs_bcstat(0, &after);
+	report(what, read_tsc() - tsc, sys_time_msec() - start,
+	       &before, &after);
+	for (i = 0; i < FILESIZE; i += BLKSIZE)
+		if (big[i] != 0x5a)
+			panic("bulk read block %d: bad data", i / BLKSIZE);
+}
+
+// Map the whole file, then touch block order[i] for every i.
+static void
+bench_mmap(int fd, const char *what, const uint32_t *order)
+{
+	struct BcStat before, after;
+	uint64_t tsc;
+	unsigned start;
+	char *p;
+	int i, r;
+
+	fs_bcstat(0, &before);
+	start = sys_time_msec();
+	tsc = read_tsc();
+	if ((p = mmap(fd, 0, FILESIZE, PROT_READ)) == NULL)
+		panic("mmap %s failed", FILENAME);
+	for (i = 0; i < NBLOCKS; i++)
+		if (p[order[i] * BLKSIZE] != 0x5a)
+			panic("mmap block %d: bad data", order[i]);
+	if ((r = munmap(p, FILESIZE)) < 0)
+		panic("munmap: %e", r);
+	fs_bcstat(0, &after);
+	report(what, read_tsc() - tsc, sys_time_msec() - start,
+	       &before, &after);
+}
+
+void
+umain(int argc, char **argv)
+{
+	static uint32_t order[NBLOCKS];
+	struct BcStat st, after;
+	int fd, i, r;
+
+	if ((r = fs_bcstat(0, &st)) < 0)
+		panic("fs_bcstat: %e", r);
+	if ((fd = open(FILENAME, O_RDWR|O_CREAT|O_TRUNC)) < 0)
+		panic("open %s: %e", FILENAME, fd);
+
+	bench_write(fd);
+
+	if ((r = fs_bcstat(COLDCACHE, NULL)) < 0)
+		panic("fs_bcstat %d: %e", COLDCACHE, r);
+	for (i = 0; i < NBLOCKS; i++)
+		order[i] = i;
+	bench_read(fd, "sequential", order);
+	for (i = 0; i < NBLOCKS; i++)
+		order[i] = (i * 97) % NBLOCKS;
+	bench_read(fd, "scattered ", order);
+	bench_aio(fd, "aio       ", order);
+	bench_bulk(fd, "bulk      ");
+	bench_mmap(fd, "mmap      ", order);
+
+	fs_bcstat(0, &after);
+	cprintf("I/O queue: %d requests, %d merged, %d transfers, "
+		"%d past deadline, depth %d (max %d)\n",
+		after.bs_ioqueued - st.bs_ioqueued,
+		after.bs_iomerged - st.bs_iomerged,
+		after.bs_iodispatched - st.bs_iodispatched,
+		after.bs_ioexpired - st.bs_ioexpired,
+		after.bs_iodepth, after.bs_iomaxdepth);
+	fs_bcstat(st.bs_budget, NULL);
+	ftruncate(fd, 0);
+	close(fd);
+}
@@ -0,0 +1,125 @@
+// Measure file server latency under load from several clients: some
+// read a large file through a small block cache, so that their
+// requests wait on the disk, while others keep re-reading one cached
+// block.  Prints latency percentiles for the cached reads.
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define COLDFILE	"/fsclients.cold"
+#define HOTFILE		"/fsclients.hot"
+#define COLDSIZE	(1024 * 1024)
+#define COLDBLOCKS	(COLDSIZE / BLKSIZE)
+#define COLDCACHE	32		// blocks; smaller than the cold file
+#define NCOLD		2		// clients reading from the disk
+#define NHOT		2		// clients reading a cached block
+#define NCOLDPASSES	4
+#define NHOTREADS	2000
+
+static char buf[BLKSIZE];
+
+static int
+open_or_die(const char *path, int mode)
+{
+	int fd;
+
+	if ((fd = open(path, mode)) < 0)
+		panic("open %s: %e", path, fd);
+	return fd;
+}
+
+static void
+cold_client(int id)
+{
+	int fd, pass, i, r;
+
+	fd = open_or_die(COLDFILE, O_RDONLY);
+	for (pass = 0; pass < NCOLDPASSES; pass++)
+		for (i = 0; i < COLDBLOCKS; i++) {
+			// Scattered, so that read-ahead does not help.
+			seek(fd, ((i * 97 + id * 31) % COLDBLOCKS) * BLKSIZE);
+			if ((r = readn(fd, buf, BLKSIZE)) != BLKSIZE)
+				panic("cold read: got %d", r);
+		}
+	close(fd);
+}
+
+static void
+hot_client(int id)
+{
+	static uint64_t lat[NHOTREADS];
+	uint64_t tsc;
+	int fd, i, j, r;
+
+	fd = open_or_die(HOTFILE, O_RDONLY);
+	for (i = 0; i < NHOTREADS; i++) {
+		tsc = read_tsc();
+		seek(fd, 0);
+		if ((r = readn(fd, buf, BLKSIZE)) != BLKSIZE)
+			panic("hot read: got %d", r);
+		lat[i] = read_tsc() - tsc;
+	}
+	close(fd);
+
+	// Insertion sort; NHOTREADS is small.
+	for (i = 1; i < NHOTREADS; i++)
+		for (j = i; j > 0 && lat[j - 1] > lat[j]; j--) {
+			tsc = lat[j];
+			lat[j] = lat[j - 1];
+			lat[j - 1] = tsc;
+		}
+	cprintf("hot client %d: %d reads, cycles p50 %u p90 %u p99 %u max %u\n",
+		id, NHOTREADS,
+		(uint32_t) lat[NHOTREADS / 2],
+		(uint32_t) lat[NHOTREADS * 90 / 100],
+		(uint32_t) lat[NHOTREADS * 99 / 100],
+		(uint32_t) lat[NHOTREADS - 1]);
+}
+
+void
+umain(int argc, char **argv)
+{
+	envid_t kids[NCOLD + NHOT];
+	struct BcStat st;
+	unsigned start;
+	int fd, i, r;
+
+	memset(buf, 0x5a, sizeof buf);
+	fd = open_or_die(COLDFILE, O_RDWR|O_CREAT|O_TRUNC);
+	for (i = 0; i < COLDBLOCKS; i++)
+		if ((r = write(fd, buf, BLKSIZE)) != BLKSIZE)
+			panic("write %s: %e", COLDFILE, r);
+	close(fd);
+	fd = open_or_die(HOTFILE, O_RDWR|O_CREAT|O_TRUNC);
+	if ((r = write(fd, buf, BLKSIZE)) != BLKSIZE)
+		panic("write %s: %e", HOTFILE, r);
+	close(fd);
+	if ((r = sync()) < 0)
+		panic("sync: %e", r);
+
+	if ((r = fs_bcstat(0, &st)) < 0)
+		panic("fs_bcstat: %e", r);
+	if ((r = fs_bcstat(COLDCACHE, NULL)) < 0)
+		panic("fs_bcstat %d: %e", COLDCACHE, r);
+
+	start = sys_time_msec();
+	for (i = 0; i < NCOLD + NHOT; i++) {
+		if ((kids[i] = fork()) < 0)
+			panic("fork: %e", kids[i]);
+		if (kids[i] == 0) {
+			if (i < NCOLD)
+				cold_client(i);
+			else
+				hot_client(i - NCOLD);
+			exit();
+		}
+	}
+	for (i = 0; i < NCOLD + NHOT; i++)
+		wait(kids[i]);
+	cprintf("%d cold and %d hot clients done in %d ms\n",
+		NCOLD, NHOT, sys_time_msec() - start);
+
+	fs_bcstat(st.bs_budget, NULL);
+	fd = open_or_die(COLDFILE, O_RDWR|O_TRUNC);
+	close(fd);
+}
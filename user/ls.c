@@ -22,18 +22,20 @@ ls(const char *path, const char *prefix)
 void
 lsdir(const char *path, const char *prefix)
 {
-	int fd, n;
+	FILE *d;
 	struct File f;
+	size_t n;
 
-	if ((fd = open(path, O_RDONLY)) < 0)
-		panic("open %s: %e", path, fd);
-	while ((n = readn(fd, &f, sizeof f)) == sizeof f)
+	if (!(d = fopen(path, "r")))
+		panic("open %s failed", path);
+	while ((n = fread(&f, 1, sizeof f, d)) == sizeof f)
 		if (f.f_name[0])
 			ls1(prefix, f.f_type==FTYPE_DIR, f.f_size, f.f_name);
 	if (n > 0)
 		panic("short read in directory %s", path);
-	if (n < 0)
-		panic("error reading directory %s: %e", path, n);
+	if (ferror(d))
+		panic("error reading directory %s", path);
+	fclose(d);
 }
 
 void
@@ -42,24 +44,24 @@ ls1(const char *prefix, bool isdir, off_t size, const char *name)
 	const char *sep;
 
 	if(flag['l'])
-		printf("%11d %c ", size, isdir ? 'd' : '-');
+		sfprintf(stdout, "%11d %c ", size, isdir ? 'd' : '-');
 	if(prefix) {
 		if (prefix[0] && prefix[strlen(prefix)-1] != '/')
 			sep = "/";
 		else
 			sep = "";
-		printf("%s%s", prefix, sep);
+		sfprintf(stdout, "%s%s", prefix, sep);
 	}
-	printf("%s", name);
+	fputs(name, stdout);
 	if(flag['F'] && isdir)
-		printf("/");
-	printf("\n");
+		fputc('/', stdout);
+	fputc('\n', stdout);
 }
 
 void
 usage(void)
 {
-	printf("usage: ls [-dFl] [file...]\n");
+	sfprintf(stdout, "usage: ls [-dFl] [file...]\n");
 	exit();
 }
 
@@ -0,0 +1,101 @@
+// Compare the cost of passing small messages through an SPSC ring
+// against passing one page per message with ipc_send.
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define RINGVA	((void *) 0xA0000000)
+#define PAGEVA	((void *) 0xB0000000)
+#define MSGSIZE	64
+#define NSLOTS	256
+#define NMSG	20000
+
+struct msg {
+	uint32_t seq;
+	uint8_t payload[MSGSIZE - sizeof(uint32_t)];
+};
+
+static void
+report(const char *what, uint64_t cycles, unsigned msec)
+{
+	cprintf("%s: %d messages, %d cycles/msg, %d ms\n",
+		what, NMSG, (uint32_t) (cycles / NMSG), msec);
+}
+
+static void
+bench_ring(void)
+{
+	struct Ring r;
+	struct msg *m;
+	uint64_t tsc;
+	unsigned start;
+	envid_t child;
+	int i;
+
+	if ((i = ring_create(&r, RINGVA, sizeof(struct msg), NSLOTS, RING_PRODUCER)) < 0)
+		panic("ring_create: %e", i);
+	if ((child = fork()) < 0)
+		panic("fork: %e", child);
+	if (child == 0) {
+		if ((i = ring_attach(&r, RINGVA, RING_CONSUMER)) < 0)
+			panic("ring_attach: %e", i);
+		for (i = 0; i < NMSG; i++) {
+			m = ring_front(&r);
+			if (m->seq != i)
+				panic("ring: got message %d, want %d", m->seq, i);
+			ring_pop(&r);
+		}
+		ring_flush(&r);
+		exit();
+	}
+
+	start = sys_time_msec();
+	tsc = read_tsc();
+	for (i = 0; i < NMSG; i++) {
+		m = ring_alloc(&r);
+		m->seq = i;
+		ring_push(&r);
+	}
+	ring_flush(&r);
+	wait(child);
+	report("ring", read_tsc() - tsc, sys_time_msec() - start);
+}
+
+static void
+bench_ipc(void)
+{
+	struct msg *m = PAGEVA;
+	uint64_t tsc;
+	unsigned start;
+	envid_t child;
+	int i, r;
+
+	if ((child = fork()) < 0)
+		panic("fork: %e", child);
+	if (child == 0) {
+		for (i = 0; i < NMSG; i++) {
+			ipc_recv(NULL, PAGEVA, NULL);
+			if (m->seq != i)
+				panic("ipc: got message %d, want %d", m->seq, i);
+		}
+		exit();
+	}
+
+	start = sys_time_msec();
+	tsc = read_tsc();
+	for (i = 0; i < NMSG; i++) {
+		if ((r = sys_page_alloc(0, PAGEVA, PTE_P|PTE_U|PTE_W)) < 0)
+			panic("sys_page_alloc: %e", r);
+		m->seq = i;
+		ipc_send(child, 0, PAGEVA, PTE_P|PTE_U|PTE_W);
+	}
+	wait(child);
+	report("ipc ", read_tsc() - tsc, sys_time_msec() - start);
+}
+
+void
+umain(int argc, char **argv)
+{
+	bench_ring();
+	bench_ipc();
+}
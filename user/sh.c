@@ -263,6 +263,24 @@ usage(void)
 	exit();
 }
 
+// Read the next command line.  Scripts are read through the stdin
+// stream, a buffer at a time rather than a byte at a time.
+char*
+getcmd(int interactive)
+{
+	static char buf[BUFSIZ];
+	int n;
+
+	if (interactive)
+		return readline("$ ");
+	if (!fgets(buf, sizeof buf, stdin))
+		return NULL;
+	n = strlen(buf);
+	while (n > 0 && (buf[n-1] == '\n' || buf[n-1] == '\r'))
+		buf[--n] = 0;
+	return buf;
+}
+
 void
 umain(int argc, char **argv)
 {
@@ -301,7 +319,7 @@ umain(int argc, char **argv)
 	while (1) {
 		char *buf;
 
-		buf = readline(interactive ? "$ " : NULL);
+		buf = getcmd(interactive);
 		if (buf == NULL) {
 			if (debug)
 				cprintf("EXITING\n");
@@ -315,6 +333,8 @@ umain(int argc, char **argv)
 			printf("# %s\n", buf);
 		if (debug)
 			cprintf("BEFORE FORK\n");
+		// Hand unread script input back to fd 0 for the child.
+		fflush(stdin);
 		if ((r = fork()) < 0)
 			panic("fork: %e", r);
 		if (debug)
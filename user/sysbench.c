@@ -0,0 +1,55 @@
+// Measure system call latency through the int 0x30 trap gate and
+// through the sysenter fast path that the library uses by default.
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NCALLS	100000
+#define VA	((char *) 0xA0000000)
+#define VA2	((char *) 0xA0001000)
+
+static envid_t
+getenvid_trap(void)
+{
+	envid_t ret;
+
+	asm volatile("int %1"
+		     : "=a" (ret)
+		     : "i" (T_SYSCALL), "a" (SYS_getenvid)
+		     : "cc", "memory");
+	return ret;
+}
+
+void
+umain(int argc, char **argv)
+{
+	uint64_t tsc, trap, fast;
+	int i, r;
+
+	// five-argument calls take their last argument from the user stack
+	if ((r = sys_page_alloc(0, VA, PTE_P|PTE_U|PTE_W)) < 0)
+		panic("sys_page_alloc: %e", r);
+	strcpy(VA, "sysenter");
+	if ((r = sys_page_map(0, VA, 0, VA2, PTE_P|PTE_U)) < 0)
+		panic("sys_page_map: %e", r);
+	if (strcmp(VA2, "sysenter") != 0 || (uvpt[PGNUM(VA2)] & PTE_W))
+		panic("sys_page_map through sysenter is wrong");
+	sys_page_unmap(0, VA2);
+	sys_page_unmap(0, VA);
+
+	if (getenvid_trap() != sys_getenvid())
+		panic("int 0x30 and sysenter disagree");
+
+	tsc = read_tsc();
+	for (i = 0; i < NCALLS; i++)
+		getenvid_trap();
+	trap = read_tsc() - tsc;
+
+	tsc = read_tsc();
+	for (i = 0; i < NCALLS; i++)
+		sys_getenvid();
+	fast = read_tsc() - tsc;
+
+	cprintf("sys_getenvid: int 0x30 %d cycles, sysenter %d cycles\n",
+		(uint32_t) (trap / NCALLS), (uint32_t) (fast / NCALLS));
+}
@@ -0,0 +1,72 @@
+#include <inc/lib.h>
+
+#define VA	((void *) 0xA0000000)
+#define NCHILD	4
+#define NITER	1000
+
+struct shared {
+	struct mutex mu;
+	struct cond cv;
+	struct semaphore done;
+	int counter;
+	int ready;
+};
+
+void
+umain(int argc, char **argv)
+{
+	struct shared *sh = VA;
+	uint32_t word = 0;
+	unsigned start;
+	int i, j, r;
+
+	// a mismatched value must not sleep
+	if ((r = sys_futex_wait(&word, 1, 0)) != -E_AGAIN)
+		panic("futex_wait with stale value returned %e", r);
+
+	// a matching value sleeps until the timeout
+	start = sys_time_msec();
+	if ((r = sys_futex_wait(&word, 0, 50)) != -E_TIMEOUT)
+		panic("futex_wait timeout returned %e", r);
+	if (sys_time_msec() - start < 50)
+		panic("futex_wait woke up too early");
+	cprintf("futex timeout is good\n");
+
+	if ((r = sys_page_alloc(0, VA, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+		panic("sys_page_alloc: %e", r);
+	sem_init(&sh->done, 0);
+
+	for (i = 0; i < NCHILD; i++) {
+		if ((r = fork()) < 0)
+			panic("fork: %e", r);
+		if (r == 0) {
+			// wait for the parent's go signal
+			mutex_lock(&sh->mu);
+			while (!sh->ready)
+				cond_wait(&sh->cv, &sh->mu);
+			mutex_unlock(&sh->mu);
+
+			for (j = 0; j < NITER; j++) {
+				mutex_lock(&sh->mu);
+				sh->counter++;
+				if (j % 100 == 0)
+					sys_yield();
+				mutex_unlock(&sh->mu);
+			}
+			sem_post(&sh->done);
+			exit();
+		}
+	}
+
+	mutex_lock(&sh->mu);
+	sh->ready = 1;
+	cond_broadcast(&sh->cv);
+	mutex_unlock(&sh->mu);
+
+	for (i = 0; i < NCHILD; i++)
+		sem_wait(&sh->done);
+
+	if (sh->counter != NCHILD * NITER)
+		panic("counter is %d, want %d", sh->counter, NCHILD * NITER);
+	cprintf("futex mutex/cond/sem are good\n");
+}
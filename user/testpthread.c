@@ -0,0 +1,72 @@
+#include <inc/lib.h>
+
+#define NTHREAD	4
+#define NITER	1000
+
+static struct mutex mu;
+static volatile int counter;
+static volatile int shared;
+
+static void *
+worker(void *arg)
+{
+	int i, id = (int) arg;
+
+	if (thisenv->env_id != sys_getenvid())
+		panic("thread %d: thisenv is not private", id);
+	for (i = 0; i < NITER; i++) {
+		mutex_lock(&mu);
+		counter++;
+		mutex_unlock(&mu);
+	}
+	// pages mapped by one thread are visible to all
+	if (id == 0)
+		sys_page_alloc(0, (void *) 0xA0000000, PTE_P|PTE_U|PTE_W);
+	return (void *) (id + 100);
+}
+
+void
+umain(int argc, char **argv)
+{
+	pthread_t t[NTHREAD];
+	void *ret;
+	int i, r, local = 0;
+	envid_t child;
+
+	for (i = 0; i < NTHREAD; i++)
+		if ((r = pthread_create(&t[i], worker, (void *) i)) < 0)
+			panic("pthread_create: %e", r);
+	for (i = 0; i < NTHREAD; i++) {
+		if ((r = pthread_join(t[i], &ret)) < 0)
+			panic("pthread_join: %e", r);
+		if ((int) ret != i + 100)
+			panic("thread %d returned %d", i, (int) ret);
+	}
+	if (counter != NTHREAD * NITER)
+		panic("counter is %d, want %d", counter, NTHREAD * NITER);
+	if (!(uvpt[PGNUM(0xA0000000)] & PTE_P))
+		panic("thread's mapping is not shared");
+	if (thisenv->env_id != sys_getenvid())
+		panic("main thread's thisenv changed");
+	cprintf("pthread is good\n");
+
+	// slots are reused after join
+	if ((r = pthread_create(&t[0], worker, (void *) 1)) < 0
+	    || (r = pthread_join(t[0], NULL)) < 0)
+		panic("reusing a thread slot: %e", r);
+
+	// sfork shares globals but not the stack
+	if ((child = sfork()) < 0)
+		panic("sfork: %e", child);
+	if (child == 0) {
+		if (thisenv->env_id != sys_getenvid())
+			panic("sfork child: thisenv is not private");
+		local = 1;
+		shared = 1;
+		exit();
+	}
+	wait(child);
+	if (shared != 1 || local != 0)
+		panic("sfork: shared %d local %d", shared, local);
+	cprintf("sfork is good\n");
+}
@@ -0,0 +1,89 @@
+// Test the asynchronous system call ring, and time a batch of page
+// allocations issued through it against the same calls made directly.
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define URING	((struct Uring *) 0xA0000000)
+#define PAGES	((char *) 0xA1000000)
+#define NPAGES	48
+
+static uint64_t
+batch_direct(void)
+{
+	uint64_t tsc = read_tsc();
+	int i, r;
+
+	for (i = 0; i < NPAGES; i++)
+		if ((r = sys_page_alloc(0, PAGES + i * PGSIZE, PTE_P|PTE_U|PTE_W)) < 0)
+			panic("sys_page_alloc: %e", r);
+	for (i = 0; i < NPAGES; i++)
+		sys_page_unmap(0, PAGES + i * PGSIZE);
+	return read_tsc() - tsc;
+}
+
+static uint64_t
+batch_uring(struct Uring *u)
+{
+	struct UringCqe cqe;
+	uint64_t tsc = read_tsc();
+	int i, n, r;
+
+	for (i = 0; i < NPAGES; i++)
+		if ((r = uring_queue(u, SYS_page_alloc, i, 0,
+				     (uint32_t) (PAGES + i * PGSIZE),
+				     PTE_P|PTE_U|PTE_W, 0, 0)) < 0)
+			panic("uring_queue: %e", r);
+	if ((r = uring_submit(u)) != NPAGES)
+		panic("uring_submit ran %d of %d calls", r, NPAGES);
+	for (n = 0; uring_reap(u, &cqe); n++)
+		if (cqe.cqe_data != n || cqe.cqe_res != 0)
+			panic("completion %d: data %d res %e", n, cqe.cqe_data, cqe.cqe_res);
+	if (n != NPAGES)
+		panic("reaped %d of %d completions", n, NPAGES);
+	for (i = 0; i < NPAGES; i++)
+		uring_queue(u, SYS_page_unmap, i, 0,
+			    (uint32_t) (PAGES + i * PGSIZE), 0, 0, 0);
+	uring_submit(u);
+	while (uring_reap(u, &cqe))
+		;
+	return read_tsc() - tsc;
+}
+
+void
+umain(int argc, char **argv)
+{
+	struct Uring *u = URING;
+	struct UringCqe cqe;
+	unsigned start;
+	int r;
+
+	if ((r = uring_init(u)) < 0)
+		panic("uring_init: %e", r);
+
+	// results come back in order and tagged
+	uring_queue(u, SYS_getenvid, 7, 0, 0, 0, 0, 0);
+	uring_queue(u, SYS_yield, 8, 0, 0, 0, 0, 0);
+	if ((r = uring_submit(u)) != 2)
+		panic("uring_submit ran %d calls, want 2", r);
+	if (!uring_reap(u, &cqe) || cqe.cqe_data != 7 || cqe.cqe_res != sys_getenvid())
+		panic("getenvid completion is wrong");
+	if (!uring_reap(u, &cqe) || cqe.cqe_data != 8 || cqe.cqe_res != -E_INVAL)
+		panic("blocking call was not refused");
+	if (uring_reap(u, &cqe))
+		panic("spurious completion");
+	cprintf("uring submit is good\n");
+
+	// without a doorbell the next kernel entry or clock tick runs the call
+	uring_queue(u, SYS_time_msec, 9, 0, 0, 0, 0, 0);
+	start = sys_time_msec();
+	while (!uring_reap(u, &cqe))
+		if (sys_time_msec() - start > 1000)
+			panic("queued call never ran");
+	if (cqe.cqe_data != 9)
+		panic("time_msec completion is wrong");
+	cprintf("uring deferred call is good\n");
+
+	cprintf("%d page allocs: direct %d cycles, uring %d cycles\n",
+		NPAGES, (uint32_t) batch_direct(), (uint32_t) batch_uring(u));
+}